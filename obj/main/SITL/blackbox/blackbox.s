@@ -0,0 +1,10491 @@
+	.file	"blackbox.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/blackbox/blackbox.c"
+	.section	.text.blackboxInit,"ax",@progbits
+	.p2align 4
+	.globl	blackboxInit
+	.type	blackboxInit, @function
+blackboxInit:
+.LFB0:
+	.file 1 ".//src/main/blackbox/blackbox.c"
+	.loc 1 107 1 view -0
+	.cfi_startproc
+	.loc 1 108 5 view .LVU1
+	.loc 1 107 1 is_stmt 0 view .LVU2
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 108 20 view .LVU3
+	xorl	%r8d, %r8d
+	xorl	%esi, %esi
+	movl	$2, %ecx
+	movl	$115200, %edx
+	movl	$64, %edi
+	call	openSerialPort@PLT
+.LVL0:
+	.loc 1 110 59 view .LVU4
+	testq	%rax, %rax
+	.loc 1 108 18 view .LVU5
+	movq	%rax, blackboxPort(%rip)
+	.loc 1 110 5 is_stmt 1 view .LVU6
+	.loc 1 110 59 is_stmt 0 view .LVU7
+	setne	%al
+	movzbl	%al, %eax
+	.loc 1 110 19 view .LVU8
+	movl	%eax, blackboxState(%rip)
+	.loc 1 111 1 view .LVU9
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	blackboxInit, .-blackboxInit
+	.section	.text.blackboxLogIteration,"ax",@progbits
+	.p2align 4
+	.globl	blackboxLogIteration
+	.type	blackboxLogIteration, @function
+blackboxLogIteration:
+.LVL1:
+.LFB4:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU11
+	.loc 1 183 5 view .LVU12
+	.loc 1 184 5 view .LVU13
+	.loc 1 186 5 view .LVU14
+	.loc 1 186 8 is_stmt 0 view .LVU15
+	cmpl	$3, blackboxState(%rip)
+	jne	.L4
+	.loc 1 190 5 is_stmt 1 view .LVU16
+	.loc 1 190 22 is_stmt 0 view .LVU17
+	movl	loopIteration(%rip), %ecx
+	.loc 1 190 39 view .LVU18
+	movzbl	396+masterConfig(%rip), %esi
+	.loc 1 190 25 view .LVU19
+	xorl	%edx, %edx
+	.loc 1 190 22 view .LVU20
+	leal	1(%rcx), %eax
+	movl	%eax, loopIteration(%rip)
+	.loc 1 190 25 view .LVU21
+	movl	%ecx, %eax
+	divl	%esi
+	.loc 1 190 8 view .LVU22
+	testl	%edx, %edx
+	jne	.L4
+	.loc 1 194 5 is_stmt 1 view .LVU23
+	.loc 1 194 37 is_stmt 0 view .LVU24
+	movzbl	frameQueueHead(%rip), %eax
+	.loc 1 194 32 view .LVU25
+	leal	1(%rax), %r8d
+	.loc 1 194 14 view .LVU26
+	andl	$7, %r8d
+.LVL2:
+	.loc 1 195 5 is_stmt 1 view .LVU27
+	.loc 1 195 8 is_stmt 0 view .LVU28
+	cmpb	%r8b, frameQueueTail(%rip)
+	je	.L4
+	.loc 1 200 5 is_stmt 1 view .LVU29
+.LVL3:
+	.loc 1 202 5 view .LVU30
+	.loc 1 203 5 view .LVU31
+	.loc 1 202 26 is_stmt 0 view .LVU32
+	movzbl	%al, %edx
+	movd	%ecx, %xmm0
+	movd	%edi, %xmm1
+	.loc 1 204 5 view .LVU33
+	movl	axisPID(%rip), %ecx
+	.loc 1 202 26 view .LVU34
+	leaq	(%rdx,%rdx,2), %rsi
+	punpckldq	%xmm1, %xmm0
+	leaq	(%rdx,%rsi,4), %rdx
+	leaq	frameQueue(%rip), %rsi
+	movq	%xmm0, (%rsi,%rdx,4)
+	.loc 1 204 5 is_stmt 1 view .LVU35
+	leaq	(%rax,%rax,2), %rdx
+	leaq	(%rax,%rdx,4), %rdx
+	.loc 1 208 36 is_stmt 0 view .LVU36
+	movzbl	encoder(%rip), %eax
+.LVL4:
+	.loc 1 208 36 view .LVU37
+	salq	$2, %rdx
+	.loc 1 204 5 view .LVU38
+	movl	%ecx, 8(%rdx,%rsi)
+	movzwl	4+axisPID(%rip), %ecx
+	movw	%cx, 12(%rdx,%rsi)
+	.loc 1 205 5 is_stmt 1 view .LVU39
+	movq	rcCommand(%rip), %rcx
+	movq	%rcx, 14(%rdx,%rsi)
+	.loc 1 206 5 view .LVU40
+	movl	gyroData(%rip), %ecx
+	movl	%ecx, 22(%rdx,%rsi)
+	movzwl	4+gyroData(%rip), %ecx
+	movw	%cx, 26(%rdx,%rsi)
+	.loc 1 207 5 view .LVU41
+	movl	accSmooth(%rip), %ecx
+	movl	%ecx, 28(%rdx,%rsi)
+	movzwl	4+accSmooth(%rip), %ecx
+	movw	%cx, 32(%rdx,%rsi)
+	.loc 1 208 5 view .LVU42
+.LVL5:
+	.loc 1 208 27 view .LVU43
+	testb	%al, %al
+	je	.L13
+	.loc 1 209 29 is_stmt 0 view .LVU44
+	addq	%rax, %rax
+	leaq	34(%rsi,%rdx), %rdx
+	leaq	motor(%rip), %rsi
+	cmpl	$8, %eax
+	jnb	.L9
+	testb	$4, %al
+	jne	.L17
+	testl	%eax, %eax
+	je	.L13
+	movzbl	motor(%rip), %ecx
+	movb	%cl, (%rdx)
+	testb	$2, %al
+	je	.L13
+	movzwl	-2(%rsi,%rax), %ecx
+	movw	%cx, -2(%rdx,%rax)
+.LVL6:
+.L13:
+	.loc 1 212 5 is_stmt 1 view .LVU45
+	.loc 1 212 20 is_stmt 0 view .LVU46
+	movb	%r8b, frameQueueHead(%rip)
+	ret
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 213 1 view .LVU47
+	ret
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 209 29 view .LVU48
+	movq	motor(%rip), %rcx
+	leaq	8(%rdx), %rdi
+.LVL9:
+	.loc 1 209 29 view .LVU49
+	andq	$-8, %rdi
+	movq	%rcx, (%rdx)
+	movq	-8(%rsi,%rax), %rcx
+	movq	%rcx, -8(%rdx,%rax)
+.LVL10:
+	.loc 1 209 29 view .LVU50
+	subq	%rdi, %rdx
+	leal	(%rax,%rdx), %ecx
+	subq	%rdx, %rsi
+	movl	%ecx, %eax
+	shrl	$3, %eax
+	movl	%eax, %ecx
+	rep movsq
+.LVL11:
+	.loc 1 209 29 view .LVU51
+	jmp	.L13
+.LVL12:
+.L17:
+	.loc 1 209 29 view .LVU52
+	movl	motor(%rip), %ecx
+	movl	%ecx, (%rdx)
+	movl	-4(%rsi,%rax), %ecx
+	movl	%ecx, -4(%rdx,%rax)
+.LVL13:
+	.loc 1 209 29 view .LVU53
+	jmp	.L13
+	.cfi_endproc
+.LFE4:
+	.size	blackboxLogIteration, .-blackboxLogIteration
+	.section	.rodata.handleBlackbox.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"H Product:Cleanflight\nH Data version:%d\nH I interval:%d\nH Looptime:%d\nH Rate denom:%d\nH Motors:%d\n"
+	.section	.text.handleBlackbox,"ax",@progbits
+	.p2align 4
+	.globl	handleBlackbox
+	.type	handleBlackbox, @function
+handleBlackbox:
+.LFB5:
+	.loc 1 216 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 217 5 view .LVU55
+	movl	blackboxState(%rip), %eax
+	.loc 1 216 1 is_stmt 0 view .LVU56
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 217 5 view .LVU57
+	cmpl	$2, %eax
+	je	.L19
+	cmpl	$3, %eax
+	je	.L20
+	cmpl	$1, %eax
+	je	.L28
+.L18:
+	.loc 1 242 1 view .LVU58
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.cfi_restore_state
+	.loc 1 222 13 is_stmt 1 view .LVU59
+	.loc 1 222 16 is_stmt 0 view .LVU60
+	testb	$4, armingFlags(%rip)
+	je	.L18
+	.loc 1 223 17 is_stmt 1 view .LVU61
+.LBB8:
+.LBI8:
+	.loc 1 113 13 view .LVU62
+.LBB9:
+	.loc 1 115 5 view .LVU63
+	.loc 1 115 35 is_stmt 0 view .LVU64
+	call	getMotorCount@PLT
+.LVL14:
+	.loc 1 115 5 view .LVU65
+	leaq	encoder(%rip), %rdi
+	.loc 1 117 5 view .LVU66
+	leaq	header(%rip), %rbx
+	.loc 1 115 5 view .LVU67
+	movzbl	%al, %esi
+	call	blackboxEncoderInit@PLT
+.LVL15:
+	.loc 1 117 5 is_stmt 1 view .LVU68
+	movzbl	encoder(%rip), %eax
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movzbl	396+masterConfig(%rip), %r9d
+	movl	targetPidLooptime(%rip), %r8d
+	movl	$1, %edx
+	movq	%rbx, %rdi
+	movl	$32, %ecx
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	leaq	.LC0(%rip), %rsi
+	xorl	%eax, %eax
+	call	tfp_sprintf@PLT
+.LVL16:
+	.loc 1 130 5 view .LVU69
+	.loc 1 130 20 is_stmt 0 view .LVU70
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL17:
+	.loc 1 131 20 view .LVU71
+	movb	$0, headerPosition(%rip)
+	.loc 1 130 18 view .LVU72
+	movb	%al, headerLength(%rip)
+	.loc 1 131 5 is_stmt 1 view .LVU73
+	.loc 1 133 5 view .LVU74
+	.loc 1 138 1 is_stmt 0 view .LVU75
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	.loc 1 133 37 view .LVU76
+	movb	$0, frameQueueTail(%rip)
+	.loc 1 138 1 view .LVU77
+	popq	%rdx
+	.cfi_def_cfa_offset 16
+	.loc 1 133 20 view .LVU78
+	movb	$0, frameQueueHead(%rip)
+	.loc 1 134 5 is_stmt 1 view .LVU79
+.LBE9:
+.LBE8:
+	.loc 1 242 1 is_stmt 0 view .LVU80
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LBB11:
+.LBB10:
+	.loc 1 134 24 view .LVU81
+	movb	$0, encodedFrameLength(%rip)
+	.loc 1 135 5 is_stmt 1 view .LVU82
+	.loc 1 135 19 is_stmt 0 view .LVU83
+	movl	$0, loopIteration(%rip)
+	.loc 1 137 5 is_stmt 1 view .LVU84
+	.loc 1 137 19 is_stmt 0 view .LVU85
+	movl	$2, blackboxState(%rip)
+.LBE10:
+.LBE11:
+	.loc 1 242 1 view .LVU86
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.cfi_restore_state
+	.loc 1 233 13 is_stmt 1 view .LVU87
+	.loc 1 233 16 is_stmt 0 view .LVU88
+	testb	$4, armingFlags(%rip)
+	jne	.L29
+	.loc 1 235 17 is_stmt 1 view .LVU89
+	.loc 1 235 31 is_stmt 0 view .LVU90
+	movl	$1, blackboxState(%rip)
+	.loc 1 236 17 is_stmt 1 view .LVU91
+	.loc 1 242 1 is_stmt 0 view .LVU92
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.cfi_restore_state
+	.loc 1 229 13 is_stmt 1 view .LVU93
+.LBB12:
+.LBI12:
+	.loc 1 140 13 view .LVU94
+.LBB13:
+	.loc 1 142 5 view .LVU95
+	.loc 1 142 35 is_stmt 0 view .LVU96
+	movzbl	headerLength(%rip), %ebx
+	movzbl	headerPosition(%rip), %eax
+	.loc 1 143 26 view .LVU97
+	movq	blackboxPort(%rip), %rdi
+	.loc 1 142 35 view .LVU98
+	subl	%eax, %ebx
+.LVL18:
+	.loc 1 143 5 is_stmt 1 view .LVU99
+	.loc 1 143 26 is_stmt 0 view .LVU100
+	call	serialTxBytesFree@PLT
+.LVL19:
+	.loc 1 145 5 is_stmt 1 view .LVU101
+	.loc 1 149 51 is_stmt 0 view .LVU102
+	movzbl	headerPosition(%rip), %esi
+	.loc 1 149 5 view .LVU103
+	movq	blackboxPort(%rip), %rdi
+	cmpl	%eax, %ebx
+	cmova	%eax, %ebx
+.LVL20:
+	.loc 1 149 5 is_stmt 1 view .LVU104
+	.loc 1 149 51 is_stmt 0 view .LVU105
+	leaq	header(%rip), %rax
+.LVL21:
+	.loc 1 149 51 view .LVU106
+	addq	%rax, %rsi
+	.loc 1 149 5 view .LVU107
+	movl	%ebx, %edx
+	call	serialWriteBuf@PLT
+.LVL22:
+	.loc 1 150 5 is_stmt 1 view .LVU108
+	.loc 1 150 20 is_stmt 0 view .LVU109
+	addb	headerPosition(%rip), %bl
+.LVL23:
+	.loc 1 152 8 view .LVU110
+	cmpb	headerLength(%rip), %bl
+	.loc 1 150 20 view .LVU111
+	movb	%bl, headerPosition(%rip)
+	.loc 1 152 5 is_stmt 1 view .LVU112
+	.loc 1 152 8 is_stmt 0 view .LVU113
+	jne	.L18
+	.loc 1 153 9 is_stmt 1 view .LVU114
+	.loc 1 153 23 is_stmt 0 view .LVU115
+	movl	$3, blackboxState(%rip)
+.LBE13:
+.LBE12:
+	.loc 1 242 1 view .LVU116
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.cfi_restore_state
+.LBB14:
+.LBB15:
+	.loc 1 159 5 is_stmt 1 view .LVU117
+	.loc 1 160 9 view .LVU118
+	.loc 1 160 12 is_stmt 0 view .LVU119
+	cmpb	$0, encodedFrameLength(%rip)
+	je	.L25
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.loc 1 168 9 is_stmt 1 view .LVU120
+	.loc 1 168 13 is_stmt 0 view .LVU121
+	movq	blackboxPort(%rip), %rdi
+	call	serialTxBytesFree@PLT
+.LVL25:
+	.loc 1 168 45 view .LVU122
+	movzbl	encodedFrameLength(%rip), %edx
+	.loc 1 168 12 view .LVU123
+	cmpl	%edx, %eax
+	jb	.L18
+	.loc 1 172 9 is_stmt 1 view .LVU124
+	movq	blackboxPort(%rip), %rdi
+	leaq	encodedFrame(%rip), %rsi
+	call	serialWriteBuf@PLT
+.LVL26:
+	.loc 1 173 9 view .LVU125
+	.loc 1 173 28 is_stmt 0 view .LVU126
+	movb	$0, encodedFrameLength(%rip)
+	.loc 1 159 11 is_stmt 1 view .LVU127
+	.loc 1 159 5 view .LVU128
+	.loc 1 160 9 view .LVU129
+.L25:
+	.loc 1 161 13 view .LVU130
+	.loc 1 161 32 is_stmt 0 view .LVU131
+	movzbl	frameQueueTail(%rip), %eax
+	.loc 1 161 16 view .LVU132
+	cmpb	frameQueueHead(%rip), %al
+	je	.L18
+	.loc 1 164 13 is_stmt 1 view .LVU133
+	.loc 1 164 64 is_stmt 0 view .LVU134
+	leaq	(%rax,%rax,2), %rdx
+	.loc 1 164 34 view .LVU135
+	leaq	encoder(%rip), %rdi
+	.loc 1 164 64 view .LVU136
+	leaq	(%rax,%rdx,4), %rdx
+	leaq	frameQueue(%rip), %rax
+	leaq	(%rax,%rdx,4), %rsi
+	.loc 1 164 34 view .LVU137
+	leaq	encodedFrame(%rip), %rdx
+	call	blackboxEncodeFrame@PLT
+.LVL27:
+	.loc 1 164 32 view .LVU138
+	movb	%al, encodedFrameLength(%rip)
+	.loc 1 165 13 is_stmt 1 view .LVU139
+	.loc 1 165 46 is_stmt 0 view .LVU140
+	movzbl	frameQueueTail(%rip), %eax
+	addl	$1, %eax
+	.loc 1 165 51 view .LVU141
+	andl	$7, %eax
+	movb	%al, frameQueueTail(%rip)
+	jmp	.L26
+.LBE15:
+.LBE14:
+	.cfi_endproc
+.LFE5:
+	.size	handleBlackbox, .-handleBlackbox
+	.section	.bss.headerPosition,"aw",@nobits
+	.type	headerPosition, @object
+	.size	headerPosition, 1
+headerPosition:
+	.zero	1
+	.section	.bss.headerLength,"aw",@nobits
+	.type	headerLength, @object
+	.size	headerLength, 1
+headerLength:
+	.zero	1
+	.section	.bss.header,"aw",@nobits
+	.align 32
+	.type	header, @object
+	.size	header, 128
+header:
+	.zero	128
+	.section	.bss.encodedFrameLength,"aw",@nobits
+	.type	encodedFrameLength, @object
+	.size	encodedFrameLength, 1
+encodedFrameLength:
+	.zero	1
+	.section	.bss.encodedFrame,"aw",@nobits
+	.align 32
+	.type	encodedFrame, @object
+	.size	encodedFrame, 74
+encodedFrame:
+	.zero	74
+	.section	.bss.encoder,"aw",@nobits
+	.align 32
+	.type	encoder, @object
+	.size	encoder, 112
+encoder:
+	.zero	112
+	.section	.bss.loopIteration,"aw",@nobits
+	.align 4
+	.type	loopIteration, @object
+	.size	loopIteration, 4
+loopIteration:
+	.zero	4
+	.section	.bss.frameQueueTail,"aw",@nobits
+	.type	frameQueueTail, @object
+	.size	frameQueueTail, 1
+frameQueueTail:
+	.zero	1
+	.section	.bss.frameQueueHead,"aw",@nobits
+	.type	frameQueueHead, @object
+	.size	frameQueueHead, 1
+frameQueueHead:
+	.zero	1
+	.section	.bss.frameQueue,"aw",@nobits
+	.align 32
+	.type	frameQueue, @object
+	.size	frameQueue, 416
+frameQueue:
+	.zero	416
+	.section	.bss.blackboxPort,"aw",@nobits
+	.align 8
+	.type	blackboxPort, @object
+	.size	blackboxPort, 8
+blackboxPort:
+	.zero	8
+	.section	.bss.blackboxState,"aw",@nobits
+	.align 4
+	.type	blackboxState, @object
+	.size	blackboxState, 4
+blackboxState:
+	.zero	4
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/common/color.h"
+	.file 7 ".//src/main/flight/flight.h"
+	.file 8 ".//src/main/common/ring_buffer.h"
+	.file 9 ".//src/main/drivers/serial.h"
+	.file 10 ".//src/main/drivers/pwm_rx.h"
+	.file 11 ".//src/main/sensors/sensors.h"
+	.file 12 ".//src/main/sensors/acceleration.h"
+	.file 13 ".//src/main/sensors/barometer.h"
+	.file 14 ".//src/main/sensors/boardalignment.h"
+	.file 15 ".//src/main/sensors/battery.h"
+	.file 16 ".//src/main/sensors/gyro.h"
+	.file 17 ".//src/main/io/serial.h"
+	.file 18 ".//src/main/io/escservo.h"
+	.file 19 ".//src/main/io/gimbal.h"
+	.file 20 ".//src/main/rx/rx.h"
+	.file 21 ".//src/main/io/rc_controls.h"
+	.file 22 ".//src/main/telemetry/telemetry.h"
+	.file 23 ".//src/main/flight/mixer.h"
+	.file 24 ".//src/main/flight/failsafe.h"
+	.file 25 ".//src/main/config/runtime_config.h"
+	.file 26 ".//src/main/config/config_profile.h"
+	.file 27 ".//src/main/config/config_master.h"
+	.file 28 ".//src/main/blackbox/blackbox_encoding.h"
+	.file 29 "/usr/include/string.h"
+	.file 30 ".//src/main/common/printf.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x187a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF1261
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL7
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF880
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF881
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF882
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF883
+	.uleb128 0x3
+	.long	.LASF885
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF884
+	.uleb128 0x3
+	.long	.LASF886
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF887
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF888
+	.uleb128 0x3
+	.long	.LASF889
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF890
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF891
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF892
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0x7
+	.long	0xb5
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF893
+	.uleb128 0x12
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF894
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x3
+	.long	.LASF895
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x3
+	.long	.LASF896
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x24
+	.long	0xe5
+	.uleb128 0x12
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF898
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF899
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x3
+	.long	.LASF900
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x6
+	.byte	0x15
+	.long	0x142
+	.uleb128 0x2
+	.long	.LASF901
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF902
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF903
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x7
+	.byte	0x15
+	.long	0x190
+	.uleb128 0x2
+	.long	.LASF904
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF905
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF906
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF907
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF908
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF911
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF912
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF913
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF914
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF920
+	.byte	0x50
+	.byte	0x7
+	.byte	0x23
+	.byte	0x10
+	.long	0x210
+	.uleb128 0xc
+	.string	"P8"
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0x210
+	.byte	0
+	.uleb128 0xc
+	.string	"I8"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xd
+	.long	0x210
+	.byte	0xa
+	.uleb128 0xc
+	.string	"D8"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xd
+	.long	0x210
+	.byte	0x14
+	.uleb128 0xc
+	.string	"P_f"
+	.byte	0x7
+	.byte	0x28
+	.byte	0xb
+	.long	0x220
+	.byte	0x20
+	.uleb128 0xc
+	.string	"I_f"
+	.byte	0x7
+	.byte	0x29
+	.byte	0xb
+	.long	0x220
+	.byte	0x2c
+	.uleb128 0xc
+	.string	"D_f"
+	.byte	0x7
+	.byte	0x2a
+	.byte	0xb
+	.long	0x220
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF915
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xb
+	.long	0x230
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF916
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x230
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF917
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x220
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	0x230
+	.long	0x230
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF918
+	.uleb128 0x3
+	.long	.LASF919
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x190
+	.uleb128 0x6
+	.long	.LASF921
+	.byte	0x6
+	.byte	0x7
+	.byte	0x57
+	.byte	0x10
+	.long	0x278
+	.uleb128 0x1
+	.long	.LASF922
+	.byte	0x7
+	.byte	0x58
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF923
+	.byte	0x7
+	.byte	0x59
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0xc
+	.string	"yaw"
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF924
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x3
+	.long	0x243
+	.uleb128 0x19
+	.byte	0x6
+	.byte	0x5d
+	.long	0x2a1
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x5e
+	.long	0x2a1
+	.uleb128 0x1b
+	.long	.LASF925
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x278
+	.byte	0
+	.uleb128 0x8
+	.long	0xcd
+	.long	0x2b1
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF926
+	.byte	0x7
+	.byte	0x60
+	.byte	0x3
+	.long	0x284
+	.uleb128 0x6
+	.long	.LASF927
+	.byte	0x4
+	.byte	0x7
+	.byte	0x62
+	.byte	0x10
+	.long	0x2e5
+	.uleb128 0x1
+	.long	.LASF922
+	.byte	0x7
+	.byte	0x63
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF923
+	.byte	0x7
+	.byte	0x64
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF928
+	.byte	0x7
+	.byte	0x65
+	.byte	0x3
+	.long	0x2bd
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x67
+	.long	0x30e
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x68
+	.long	0x30e
+	.uleb128 0x1b
+	.long	.LASF925
+	.byte	0x69
+	.byte	0x1d
+	.long	0x2e5
+	.byte	0
+	.uleb128 0x8
+	.long	0xcd
+	.long	0x31e
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF929
+	.byte	0x7
+	.byte	0x6a
+	.byte	0x3
+	.long	0x2f1
+	.uleb128 0xf
+	.long	.LASF930
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x10
+	.long	0x2a1
+	.uleb128 0xf
+	.long	.LASF931
+	.byte	0x7
+	.byte	0x80
+	.byte	0x27
+	.long	0x2a1
+	.uleb128 0xf
+	.long	.LASF932
+	.byte	0x7
+	.byte	0x82
+	.byte	0x10
+	.long	0x2a1
+	.uleb128 0x6
+	.long	.LASF933
+	.byte	0x10
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x10
+	.long	0x39d
+	.uleb128 0x1
+	.long	.LASF934
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x17
+	.long	0x39d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF935
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xe
+	.long	0xfb
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF936
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xe
+	.long	0xfb
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF937
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xe
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF938
+	.byte	0x8
+	.byte	0x20
+	.byte	0xe
+	.long	0xfb
+	.byte	0xe
+	.byte	0
+	.uleb128 0x7
+	.long	0xf1
+	.uleb128 0x3
+	.long	.LASF939
+	.byte	0x8
+	.byte	0x21
+	.byte	0x3
+	.long	0x34e
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x9
+	.byte	0x16
+	.long	0x3c6
+	.uleb128 0x2
+	.long	.LASF940
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF941
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF942
+	.byte	0x9
+	.byte	0x19
+	.byte	0x3
+	.long	0x3ae
+	.uleb128 0x25
+	.long	.LASF947
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xe
+	.long	0x3fd
+	.uleb128 0x2
+	.long	.LASF943
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF944
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF945
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF946
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF947
+	.byte	0x9
+	.byte	0x20
+	.byte	0x3
+	.long	0x3d2
+	.uleb128 0x3
+	.long	.LASF948
+	.byte	0x9
+	.byte	0x22
+	.byte	0x10
+	.long	0x415
+	.uleb128 0x7
+	.long	0x41a
+	.uleb128 0x10
+	.long	0x425
+	.uleb128 0x4
+	.long	0xfb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF949
+	.byte	0x9
+	.byte	0x23
+	.byte	0x10
+	.long	0x431
+	.uleb128 0x7
+	.long	0x436
+	.uleb128 0x10
+	.long	0x446
+	.uleb128 0x4
+	.long	0x446
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x7
+	.long	0xf6
+	.uleb128 0x6
+	.long	.LASF950
+	.byte	0x40
+	.byte	0x9
+	.byte	0x25
+	.byte	0x10
+	.long	0x4c1
+	.uleb128 0x1
+	.long	.LASF951
+	.byte	0x9
+	.byte	0x27
+	.byte	0x24
+	.long	0x563
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF952
+	.byte	0x9
+	.byte	0x29
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF953
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x10
+	.long	0x3fd
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF954
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x17
+	.long	0x3c6
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF955
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xe
+	.long	0x107
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x12
+	.long	0x3a2
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF957
+	.byte	0x9
+	.byte	0x30
+	.byte	0x12
+	.long	0x3a2
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF958
+	.byte	0x9
+	.byte	0x33
+	.byte	0x1e
+	.long	0x409
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF959
+	.byte	0x58
+	.byte	0x9
+	.byte	0x36
+	.byte	0x8
+	.long	0x55e
+	.uleb128 0x1
+	.long	.LASF960
+	.byte	0x9
+	.byte	0x37
+	.byte	0xc
+	.long	0x589
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF961
+	.byte	0x9
+	.byte	0x39
+	.byte	0x10
+	.long	0x59d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF962
+	.byte	0x9
+	.byte	0x3b
+	.byte	0xf
+	.long	0x5b1
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF963
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xc
+	.long	0x5c6
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF964
+	.byte	0x9
+	.byte	0x40
+	.byte	0xb
+	.long	0x5e1
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF965
+	.byte	0x9
+	.byte	0x42
+	.byte	0xc
+	.long	0x5f6
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF966
+	.byte	0x9
+	.byte	0x45
+	.byte	0xb
+	.long	0x60f
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0x9
+	.byte	0x47
+	.byte	0xc
+	.long	0x629
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x9
+	.byte	0x49
+	.byte	0x10
+	.long	0x64c
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x10
+	.long	0x665
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xc
+	.long	0x5c6
+	.byte	0x50
+	.byte	0
+	.uleb128 0x12
+	.long	0x4c1
+	.uleb128 0x7
+	.long	0x55e
+	.uleb128 0x3
+	.long	.LASF971
+	.byte	0x9
+	.byte	0x34
+	.byte	0x3
+	.long	0x44b
+	.uleb128 0x10
+	.long	0x584
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x7
+	.long	0x568
+	.uleb128 0x7
+	.long	0x574
+	.uleb128 0x11
+	.long	0x107
+	.long	0x59d
+	.uleb128 0x4
+	.long	0x584
+	.byte	0
+	.uleb128 0x7
+	.long	0x58e
+	.uleb128 0x11
+	.long	0xe5
+	.long	0x5b1
+	.uleb128 0x4
+	.long	0x584
+	.byte	0
+	.uleb128 0x7
+	.long	0x5a2
+	.uleb128 0x10
+	.long	0x5c6
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x7
+	.long	0x5b6
+	.uleb128 0x11
+	.long	0x5da
+	.long	0x5da
+	.uleb128 0x4
+	.long	0x584
+	.byte	0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF972
+	.uleb128 0x7
+	.long	0x5cb
+	.uleb128 0x10
+	.long	0x5f6
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x3fd
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e6
+	.uleb128 0x11
+	.long	0x5da
+	.long	0x60f
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x425
+	.byte	0
+	.uleb128 0x7
+	.long	0x5fb
+	.uleb128 0x10
+	.long	0x629
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x446
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x7
+	.long	0x614
+	.uleb128 0x11
+	.long	0x107
+	.long	0x647
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x647
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x7
+	.long	0xe5
+	.uleb128 0x7
+	.long	0x62e
+	.uleb128 0x11
+	.long	0x647
+	.long	0x665
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x7
+	.long	0x651
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0xa
+	.byte	0x14
+	.long	0x682
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF974
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF975
+	.byte	0xa
+	.byte	0x17
+	.byte	0x3
+	.long	0x66a
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0xb
+	.byte	0x26
+	.long	0x6d0
+	.uleb128 0x2
+	.long	.LASF976
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF977
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF978
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF979
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF980
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF983
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF984
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF985
+	.byte	0xb
+	.byte	0x30
+	.byte	0x3
+	.long	0x68e
+	.uleb128 0x6
+	.long	.LASF986
+	.byte	0xc
+	.byte	0xb
+	.byte	0x32
+	.byte	0x10
+	.long	0x711
+	.uleb128 0x1
+	.long	.LASF987
+	.byte	0xb
+	.byte	0x33
+	.byte	0x14
+	.long	0x6d0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF988
+	.byte	0xb
+	.byte	0x34
+	.byte	0x14
+	.long	0x6d0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF989
+	.byte	0xb
+	.byte	0x35
+	.byte	0x14
+	.long	0x6d0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF990
+	.byte	0xb
+	.byte	0x36
+	.byte	0x3
+	.long	0x6dc
+	.uleb128 0x6
+	.long	.LASF991
+	.byte	0x10
+	.byte	0xb
+	.byte	0x39
+	.byte	0x10
+	.long	0x779
+	.uleb128 0x1
+	.long	.LASF992
+	.byte	0xb
+	.byte	0x3a
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF993
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF994
+	.byte	0xb
+	.byte	0x3c
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF995
+	.byte	0xb
+	.byte	0x3d
+	.byte	0xd
+	.long	0xe5
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2a1
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0xb
+	.byte	0x3f
+	.byte	0xd
+	.long	0xd9
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF998
+	.byte	0xb
+	.byte	0x40
+	.byte	0x3
+	.long	0x71d
+	.uleb128 0x6
+	.long	.LASF999
+	.byte	0x2
+	.byte	0xc
+	.byte	0x27
+	.byte	0x10
+	.long	0x7aa
+	.uleb128 0xc
+	.string	"xy"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0xc
+	.string	"z"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1000
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x3
+	.long	0x785
+	.uleb128 0x6
+	.long	.LASF1001
+	.byte	0x10
+	.byte	0xd
+	.byte	0x1f
+	.byte	0x10
+	.long	0x7f8
+	.uleb128 0x1
+	.long	.LASF1002
+	.byte	0xd
+	.byte	0x20
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0xd
+	.byte	0x21
+	.byte	0xb
+	.long	0x230
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0xd
+	.byte	0x22
+	.byte	0xb
+	.long	0x230
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1005
+	.byte	0xd
+	.byte	0x23
+	.byte	0xb
+	.long	0x230
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1006
+	.byte	0xd
+	.byte	0x24
+	.byte	0x3
+	.long	0x7b6
+	.uleb128 0x6
+	.long	.LASF1007
+	.byte	0x6
+	.byte	0xe
+	.byte	0x14
+	.byte	0x10
+	.long	0x839
+	.uleb128 0x1
+	.long	.LASF1008
+	.byte	0xe
+	.byte	0x15
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1009
+	.byte	0xe
+	.byte	0x16
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1010
+	.byte	0xe
+	.byte	0x17
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1011
+	.byte	0xe
+	.byte	0x18
+	.byte	0x3
+	.long	0x804
+	.uleb128 0x6
+	.long	.LASF1012
+	.byte	0xa
+	.byte	0xf
+	.byte	0x18
+	.byte	0x10
+	.long	0x8a1
+	.uleb128 0x1
+	.long	.LASF1013
+	.byte	0xf
+	.byte	0x19
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1014
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1015
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1016
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1017
+	.byte	0xf
+	.byte	0x1e
+	.byte	0xe
+	.long	0xfb
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1018
+	.byte	0xf
+	.byte	0x21
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1019
+	.byte	0xf
+	.byte	0x22
+	.byte	0x3
+	.long	0x845
+	.uleb128 0x6
+	.long	.LASF1020
+	.byte	0x8
+	.byte	0x10
+	.byte	0x24
+	.byte	0x10
+	.long	0x8ef
+	.uleb128 0x1
+	.long	.LASF1021
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1022
+	.byte	0x10
+	.byte	0x26
+	.byte	0xe
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1023
+	.byte	0x10
+	.byte	0x27
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1024
+	.byte	0x10
+	.byte	0x28
+	.byte	0xe
+	.long	0xfb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1025
+	.byte	0x10
+	.byte	0x29
+	.byte	0x3
+	.long	0x8ad
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x11
+	.byte	0x14
+	.long	0x937
+	.uleb128 0x2
+	.long	.LASF1026
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1028
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1034
+	.byte	0x11
+	.byte	0x1d
+	.byte	0x3
+	.long	0x8fb
+	.uleb128 0x6
+	.long	.LASF1035
+	.byte	0x18
+	.byte	0x11
+	.byte	0x80
+	.byte	0x10
+	.long	0x99f
+	.uleb128 0x1
+	.long	.LASF1036
+	.byte	0x11
+	.byte	0x81
+	.byte	0xd
+	.long	0x99f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1037
+	.byte	0x11
+	.byte	0x82
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1038
+	.byte	0x11
+	.byte	0x83
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1039
+	.byte	0x11
+	.byte	0x84
+	.byte	0xe
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1040
+	.byte	0x11
+	.byte	0x85
+	.byte	0xe
+	.long	0x107
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0x11
+	.byte	0x87
+	.byte	0xd
+	.long	0xe5
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x9af
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1042
+	.byte	0x11
+	.byte	0x88
+	.byte	0x3
+	.long	0x943
+	.uleb128 0x6
+	.long	.LASF1043
+	.byte	0x6
+	.byte	0x12
+	.byte	0x14
+	.byte	0x10
+	.long	0x9f0
+	.uleb128 0x1
+	.long	.LASF1044
+	.byte	0x12
+	.byte	0x15
+	.byte	0xe
+	.long	0xfb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1045
+	.byte	0x12
+	.byte	0x16
+	.byte	0xe
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1046
+	.byte	0x12
+	.byte	0x17
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1047
+	.byte	0x12
+	.byte	0x18
+	.byte	0x3
+	.long	0x9bb
+	.uleb128 0x6
+	.long	.LASF1048
+	.byte	0x1
+	.byte	0x13
+	.byte	0x1a
+	.byte	0x10
+	.long	0xa17
+	.uleb128 0x1
+	.long	.LASF1049
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1050
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0x9fc
+	.uleb128 0x6
+	.long	.LASF1051
+	.byte	0x12
+	.byte	0x14
+	.byte	0x3d
+	.byte	0x10
+	.long	0xa7f
+	.uleb128 0x1
+	.long	.LASF1052
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xd
+	.long	0xa7f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0x14
+	.byte	0x40
+	.byte	0xe
+	.long	0xfb
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0x14
+	.byte	0x41
+	.byte	0xe
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0x14
+	.byte	0x42
+	.byte	0xe
+	.long	0xfb
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0x14
+	.byte	0x43
+	.byte	0xd
+	.long	0xe5
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0xa8f
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1058
+	.byte	0x14
+	.byte	0x44
+	.byte	0x3
+	.long	0xa23
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x15
+	.byte	0x14
+	.long	0xb31
+	.uleb128 0x2
+	.long	.LASF1059
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1060
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1061
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1062
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1063
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1066
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1067
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1068
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1069
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1071
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1072
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1073
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1074
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1077
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1078
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1079
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1080
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1081
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1082
+	.byte	0x15
+	.byte	0x2d
+	.byte	0x3
+	.long	0xa9b
+	.uleb128 0x6
+	.long	.LASF1083
+	.byte	0x8
+	.byte	0x15
+	.byte	0x65
+	.byte	0x10
+	.long	0xb7f
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x15
+	.byte	0x66
+	.byte	0xd
+	.long	0xb31
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x15
+	.byte	0x67
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x15
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x15
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1088
+	.byte	0x15
+	.byte	0x6f
+	.byte	0x3
+	.long	0xb3d
+	.uleb128 0x6
+	.long	.LASF1089
+	.byte	0x6
+	.byte	0x15
+	.byte	0x73
+	.byte	0x10
+	.long	0xbe7
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x15
+	.byte	0x74
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0x15
+	.byte	0x75
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x15
+	.byte	0x76
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x15
+	.byte	0x77
+	.byte	0xd
+	.long	0xe5
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0x15
+	.byte	0x78
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1095
+	.byte	0x15
+	.byte	0x79
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1096
+	.byte	0x15
+	.byte	0x7a
+	.byte	0x3
+	.long	0xb8b
+	.uleb128 0x8
+	.long	0xcd
+	.long	0xc03
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1097
+	.byte	0x15
+	.byte	0x7c
+	.byte	0x10
+	.long	0xbf3
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x16
+	.byte	0x1c
+	.long	0xc33
+	.uleb128 0x2
+	.long	.LASF1098
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1099
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1100
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1101
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1102
+	.byte	0x16
+	.byte	0x21
+	.byte	0x3
+	.long	0xc0f
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x16
+	.byte	0x23
+	.long	0xc57
+	.uleb128 0x2
+	.long	.LASF1103
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1104
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1105
+	.byte	0x16
+	.byte	0x26
+	.byte	0x3
+	.long	0xc3f
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x16
+	.byte	0x28
+	.long	0xc7b
+	.uleb128 0x2
+	.long	.LASF1106
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1107
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1108
+	.byte	0x16
+	.byte	0x2b
+	.byte	0x3
+	.long	0xc63
+	.uleb128 0x6
+	.long	.LASF1109
+	.byte	0x20
+	.byte	0x16
+	.byte	0x2c
+	.byte	0x10
+	.long	0xcfd
+	.uleb128 0x1
+	.long	.LASF1110
+	.byte	0x16
+	.byte	0x2d
+	.byte	0x19
+	.long	0xc33
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1111
+	.byte	0x16
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0x16
+	.byte	0x2f
+	.byte	0x17
+	.long	0x3c6
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0x16
+	.byte	0x30
+	.byte	0x8
+	.long	0x230
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1114
+	.byte	0x16
+	.byte	0x31
+	.byte	0xb
+	.long	0x230
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1115
+	.byte	0x16
+	.byte	0x32
+	.byte	0x1b
+	.long	0xc57
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0x16
+	.byte	0x33
+	.byte	0x11
+	.long	0xc7b
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0x16
+	.byte	0x34
+	.byte	0xe
+	.long	0xfb
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1118
+	.byte	0x16
+	.byte	0x35
+	.byte	0x3
+	.long	0xc87
+	.uleb128 0x6
+	.long	.LASF1119
+	.byte	0x10
+	.byte	0x17
+	.byte	0x34
+	.byte	0x10
+	.long	0xd4b
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x17
+	.byte	0x35
+	.byte	0xb
+	.long	0x230
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF922
+	.byte	0x17
+	.byte	0x36
+	.byte	0xb
+	.long	0x230
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF923
+	.byte	0x17
+	.byte	0x37
+	.byte	0xb
+	.long	0x230
+	.byte	0x8
+	.uleb128 0xc
+	.string	"yaw"
+	.byte	0x17
+	.byte	0x38
+	.byte	0xb
+	.long	0x230
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1119
+	.byte	0x17
+	.byte	0x39
+	.byte	0x3
+	.long	0xd09
+	.uleb128 0x6
+	.long	.LASF1121
+	.byte	0x2
+	.byte	0x17
+	.byte	0x42
+	.byte	0x10
+	.long	0xd7f
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0x17
+	.byte	0x43
+	.byte	0xc
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x17
+	.byte	0x44
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1124
+	.byte	0x17
+	.byte	0x45
+	.byte	0x3
+	.long	0xd57
+	.uleb128 0x6
+	.long	.LASF1125
+	.byte	0x8
+	.byte	0x17
+	.byte	0x47
+	.byte	0x10
+	.long	0xdcd
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x17
+	.byte	0x48
+	.byte	0xe
+	.long	0xfb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x17
+	.byte	0x49
+	.byte	0xe
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x17
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x17
+	.byte	0x4b
+	.byte	0xe
+	.long	0xfb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1130
+	.byte	0x17
+	.byte	0x4c
+	.byte	0x3
+	.long	0xd8b
+	.uleb128 0x6
+	.long	.LASF1131
+	.byte	0x1
+	.byte	0x17
+	.byte	0x4e
+	.byte	0x10
+	.long	0xdf4
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x17
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1131
+	.byte	0x17
+	.byte	0x50
+	.byte	0x3
+	.long	0xdd9
+	.uleb128 0x6
+	.long	.LASF1133
+	.byte	0x8
+	.byte	0x17
+	.byte	0x54
+	.byte	0x10
+	.long	0xe4f
+	.uleb128 0xc
+	.string	"min"
+	.byte	0x17
+	.byte	0x55
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0xc
+	.string	"max"
+	.byte	0x17
+	.byte	0x56
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0x17
+	.byte	0x57
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x17
+	.byte	0x58
+	.byte	0xc
+	.long	0xc1
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x17
+	.byte	0x59
+	.byte	0xc
+	.long	0xc1
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1133
+	.byte	0x17
+	.byte	0x5a
+	.byte	0x3
+	.long	0xe00
+	.uleb128 0x8
+	.long	0xcd
+	.long	0xe6b
+	.uleb128 0x9
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1137
+	.byte	0x17
+	.byte	0x64
+	.byte	0x10
+	.long	0xe5b
+	.uleb128 0x8
+	.long	0xcd
+	.long	0xe87
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1138
+	.byte	0x8
+	.byte	0x18
+	.byte	0x16
+	.byte	0x10
+	.long	0xed6
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x18
+	.byte	0x17
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x18
+	.byte	0x18
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x18
+	.byte	0x19
+	.byte	0xe
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x18
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x18
+	.byte	0x1b
+	.byte	0xe
+	.long	0xfb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1144
+	.byte	0x18
+	.byte	0x1c
+	.byte	0x3
+	.long	0xe87
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x19
+	.byte	0x15
+	.long	0xf00
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1148
+	.byte	0x19
+	.byte	0x1b
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x1c
+	.long	.LASF1149
+	.value	0x218
+	.byte	0x1a
+	.byte	0x14
+	.long	0x104f
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0x1a
+	.byte	0x15
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0x1a
+	.byte	0x17
+	.byte	0x12
+	.long	0x237
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x19
+	.long	0xbe7
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1154
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0xe
+	.long	0xfb
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0xd
+	.long	0xcd
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x19
+	.long	0x31e
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0x1a
+	.byte	0x24
+	.byte	0xd
+	.long	0xe5
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xb
+	.long	0x230
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x13
+	.long	0x7aa
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x17
+	.long	0x7f8
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x1f
+	.long	0x104f
+	.byte	0x84
+	.uleb128 0x5
+	.long	.LASF1163
+	.byte	0x1a
+	.byte	0x30
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c4
+	.uleb128 0x5
+	.long	.LASF1164
+	.byte	0x1a
+	.byte	0x31
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c5
+	.uleb128 0x5
+	.long	.LASF1165
+	.byte	0x1a
+	.byte	0x32
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c6
+	.uleb128 0x5
+	.long	.LASF1166
+	.byte	0x1a
+	.byte	0x33
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c7
+	.uleb128 0x5
+	.long	.LASF1167
+	.byte	0x1a
+	.byte	0x35
+	.byte	0xe
+	.long	0xfb
+	.value	0x1c8
+	.uleb128 0x5
+	.long	.LASF1168
+	.byte	0x1a
+	.byte	0x36
+	.byte	0xd
+	.long	0xe5
+	.value	0x1ca
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x12
+	.long	0x105f
+	.value	0x1cc
+	.uleb128 0x5
+	.long	.LASF1170
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0x16
+	.long	0xed6
+	.value	0x20c
+	.uleb128 0x5
+	.long	.LASF1171
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0x13
+	.long	0xd7f
+	.value	0x214
+	.uleb128 0x5
+	.long	.LASF1172
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x14
+	.long	0xa17
+	.value	0x216
+	.byte	0
+	.uleb128 0x8
+	.long	0xb7f
+	.long	0x105f
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x8
+	.long	0xe4f
+	.long	0x106f
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1173
+	.byte	0x1a
+	.byte	0x47
+	.byte	0x3
+	.long	0xf0c
+	.uleb128 0x1c
+	.long	.LASF1174
+	.value	0x7dc
+	.byte	0x1b
+	.byte	0x17
+	.long	0x12b2
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x1b
+	.byte	0x18
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x1b
+	.byte	0x19
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfb
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1178
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1179
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0xd
+	.long	0xe5
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1180
+	.byte	0x1b
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1181
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe5
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1182
+	.byte	0x1b
+	.byte	0x20
+	.byte	0x12
+	.long	0x12b2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1183
+	.byte	0x1b
+	.byte	0x23
+	.byte	0x19
+	.long	0x9f0
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF1184
+	.byte	0x1b
+	.byte	0x24
+	.byte	0x16
+	.long	0xdcd
+	.byte	0xd6
+	.uleb128 0x1
+	.long	.LASF1185
+	.byte	0x1b
+	.byte	0x26
+	.byte	0xe
+	.long	0xfb
+	.byte	0xde
+	.uleb128 0x1
+	.long	.LASF1186
+	.byte	0x1b
+	.byte	0x27
+	.byte	0xe
+	.long	0xfb
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x1b
+	.byte	0x28
+	.byte	0xe
+	.long	0xfb
+	.byte	0xe2
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x1b
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x711
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x1b
+	.byte	0x2d
+	.byte	0x16
+	.long	0x839
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x1b
+	.byte	0x2f
+	.byte	0xc
+	.long	0xc1
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF1191
+	.byte	0x1b
+	.byte	0x30
+	.byte	0xd
+	.long	0xe5
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF1192
+	.byte	0x1b
+	.byte	0x31
+	.byte	0xe
+	.long	0xfb
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF1193
+	.byte	0x1b
+	.byte	0x32
+	.byte	0xe
+	.long	0xfb
+	.byte	0xfa
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x1b
+	.byte	0x33
+	.byte	0xe
+	.long	0xfb
+	.byte	0xfc
+	.uleb128 0x1
+	.long	.LASF1195
+	.byte	0x1b
+	.byte	0x34
+	.byte	0xd
+	.long	0xe5
+	.byte	0xfe
+	.uleb128 0x5
+	.long	.LASF1196
+	.byte	0x1b
+	.byte	0x35
+	.byte	0xe
+	.long	0xfb
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF1197
+	.byte	0x1b
+	.byte	0x36
+	.byte	0xe
+	.long	0xfb
+	.value	0x102
+	.uleb128 0x5
+	.long	.LASF1198
+	.byte	0x1b
+	.byte	0x38
+	.byte	0x12
+	.long	0x8ef
+	.value	0x104
+	.uleb128 0x5
+	.long	.LASF1199
+	.byte	0x1b
+	.byte	0x3a
+	.byte	0xe
+	.long	0xfb
+	.value	0x10c
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x2b1
+	.value	0x10e
+	.uleb128 0x5
+	.long	.LASF1201
+	.byte	0x1b
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x2b1
+	.value	0x114
+	.uleb128 0x5
+	.long	.LASF1202
+	.byte	0x1b
+	.byte	0x3d
+	.byte	0x14
+	.long	0x779
+	.value	0x11c
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0x1b
+	.byte	0x3f
+	.byte	0x15
+	.long	0x8a1
+	.value	0x12c
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0x1b
+	.byte	0x41
+	.byte	0x10
+	.long	0xa8f
+	.value	0x136
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0x1b
+	.byte	0x42
+	.byte	0x1a
+	.long	0x682
+	.value	0x148
+	.uleb128 0x5
+	.long	.LASF1206
+	.byte	0x1b
+	.byte	0x44
+	.byte	0xd
+	.long	0xe5
+	.value	0x14c
+	.uleb128 0x5
+	.long	.LASF1207
+	.byte	0x1b
+	.byte	0x45
+	.byte	0xd
+	.long	0xe5
+	.value	0x14d
+	.uleb128 0x5
+	.long	.LASF1208
+	.byte	0x1b
+	.byte	0x46
+	.byte	0xd
+	.long	0xe5
+	.value	0x14e
+	.uleb128 0x5
+	.long	.LASF1209
+	.byte	0x1b
+	.byte	0x48
+	.byte	0x16
+	.long	0xdf4
+	.value	0x14f
+	.uleb128 0x5
+	.long	.LASF1210
+	.byte	0x1b
+	.byte	0x49
+	.byte	0xc
+	.long	0xc1
+	.value	0x150
+	.uleb128 0x5
+	.long	.LASF1211
+	.byte	0x1b
+	.byte	0x4f
+	.byte	0x14
+	.long	0x9af
+	.value	0x154
+	.uleb128 0x5
+	.long	.LASF1212
+	.byte	0x1b
+	.byte	0x51
+	.byte	0x17
+	.long	0xcfd
+	.value	0x16c
+	.uleb128 0x5
+	.long	.LASF1213
+	.byte	0x1b
+	.byte	0x53
+	.byte	0xd
+	.long	0xe5
+	.value	0x18c
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x1b
+	.byte	0x5a
+	.byte	0xf
+	.long	0x12c2
+	.value	0x190
+	.uleb128 0x5
+	.long	.LASF1215
+	.byte	0x1b
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe5
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x8
+	.long	0xd4b
+	.long	0x12c2
+	.uleb128 0x9
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0x106f
+	.long	0x12d2
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1174
+	.byte	0x1b
+	.byte	0x5c
+	.byte	0x3
+	.long	0x107b
+	.uleb128 0xf
+	.long	.LASF1216
+	.byte	0x1b
+	.byte	0x5e
+	.byte	0x11
+	.long	0x12d2
+	.uleb128 0x6
+	.long	.LASF1217
+	.byte	0x34
+	.byte	0x1c
+	.byte	0x22
+	.byte	0x10
+	.long	0x1353
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x1c
+	.byte	0x23
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x1c
+	.byte	0x24
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF932
+	.byte	0x1c
+	.byte	0x25
+	.byte	0xd
+	.long	0x2a1
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0x1c
+	.byte	0x26
+	.byte	0xd
+	.long	0xbf3
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF930
+	.byte	0x1c
+	.byte	0x27
+	.byte	0xd
+	.long	0x2a1
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF931
+	.byte	0x1c
+	.byte	0x28
+	.byte	0xd
+	.long	0x2a1
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x1c
+	.byte	0x29
+	.byte	0xd
+	.long	0xe77
+	.byte	0x22
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1220
+	.byte	0x1c
+	.byte	0x2a
+	.byte	0x3
+	.long	0x12ea
+	.uleb128 0x12
+	.long	0x1353
+	.uleb128 0x6
+	.long	.LASF1221
+	.byte	0x70
+	.byte	0x1c
+	.byte	0x2c
+	.byte	0x10
+	.long	0x13a6
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0x1c
+	.byte	0x2d
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x1c
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x1c
+	.byte	0x2f
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0x1c
+	.byte	0x30
+	.byte	0x15
+	.long	0x13a6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0x1353
+	.long	0x13b6
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1226
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x3
+	.long	0x1364
+	.uleb128 0xf
+	.long	.LASF1227
+	.byte	0x1
+	.byte	0x51
+	.byte	0x11
+	.long	0x107
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x1
+	.byte	0x53
+	.long	0x13f2
+	.uleb128 0x2
+	.long	.LASF1228
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1229
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1230
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1231
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1232
+	.byte	0x1
+	.byte	0x58
+	.byte	0x3
+	.long	0x13ce
+	.uleb128 0xd
+	.long	.LASF1233
+	.byte	0x5a
+	.byte	0x18
+	.long	0x13f2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blackboxState
+	.uleb128 0xd
+	.long	.LASF1234
+	.byte	0x5b
+	.byte	0x16
+	.long	0x584
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blackboxPort
+	.uleb128 0x8
+	.long	0x1353
+	.long	0x1438
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1235
+	.byte	0x5d
+	.byte	0x18
+	.long	0x1428
+	.uleb128 0x9
+	.byte	0x3
+	.quad	frameQueue
+	.uleb128 0xd
+	.long	.LASF1236
+	.byte	0x5e
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	frameQueueHead
+	.uleb128 0xd
+	.long	.LASF1237
+	.byte	0x5f
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	frameQueueTail
+	.uleb128 0xd
+	.long	.LASF1218
+	.byte	0x60
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x9
+	.byte	0x3
+	.quad	loopIteration
+	.uleb128 0xd
+	.long	.LASF1238
+	.byte	0x62
+	.byte	0x1a
+	.long	0x13b6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encoder
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x14b1
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x49
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1239
+	.byte	0x63
+	.byte	0x10
+	.long	0x14a1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encodedFrame
+	.uleb128 0xd
+	.long	.LASF1240
+	.byte	0x64
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encodedFrameLength
+	.uleb128 0x8
+	.long	0xb5
+	.long	0x14eb
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1241
+	.byte	0x66
+	.byte	0xd
+	.long	0x14db
+	.uleb128 0x9
+	.byte	0x3
+	.quad	header
+	.uleb128 0xd
+	.long	.LASF1242
+	.byte	0x67
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	headerLength
+	.uleb128 0xd
+	.long	.LASF1243
+	.byte	0x68
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	headerPosition
+	.uleb128 0x13
+	.long	.LASF1244
+	.byte	0x1c
+	.byte	0x41
+	.byte	0x9
+	.long	0xe5
+	.long	0x154a
+	.uleb128 0x4
+	.long	0x154a
+	.uleb128 0x4
+	.long	0x154f
+	.uleb128 0x4
+	.long	0x647
+	.byte	0
+	.uleb128 0x7
+	.long	0x13b6
+	.uleb128 0x7
+	.long	0x135f
+	.uleb128 0x15
+	.long	.LASF1247
+	.byte	0x9
+	.byte	0x59
+	.long	0x156f
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0x4
+	.long	0x446
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1245
+	.byte	0x9
+	.byte	0x58
+	.byte	0xa
+	.long	0x107
+	.long	0x1585
+	.uleb128 0x4
+	.long	0x584
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1246
+	.byte	0x1d
+	.value	0x197
+	.byte	0xf
+	.long	0x113
+	.long	0x159c
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1248
+	.byte	0x1e
+	.byte	0x6f
+	.long	0x15b3
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1249
+	.byte	0x1c
+	.byte	0x40
+	.long	0x15c9
+	.uleb128 0x4
+	.long	0x154a
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1262
+	.byte	0x17
+	.byte	0x69
+	.byte	0x9
+	.long	0xe5
+	.uleb128 0x13
+	.long	.LASF1250
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xe
+	.long	0xae
+	.long	0x15f5
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x4
+	.long	0x15f5
+	.uleb128 0x4
+	.long	0x113
+	.byte	0
+	.uleb128 0x7
+	.long	0x15fa
+	.uleb128 0x29
+	.uleb128 0x13
+	.long	.LASF1251
+	.byte	0x11
+	.byte	0x8d
+	.byte	0xf
+	.long	0x584
+	.long	0x1625
+	.uleb128 0x4
+	.long	0x937
+	.uleb128 0x4
+	.long	0x409
+	.uleb128 0x4
+	.long	0x107
+	.uleb128 0x4
+	.long	0x3fd
+	.uleb128 0x4
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1252
+	.byte	0xd7
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x179a
+	.uleb128 0x2a
+	.long	0x1831
+	.quad	.LBI8
+	.byte	.LVU62
+	.long	.LLRL4
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x11
+	.long	0x16cb
+	.uleb128 0x16
+	.quad	.LVL14
+	.long	0x15c9
+	.uleb128 0x17
+	.quad	.LVL15
+	.long	0x15b3
+	.long	0x1686
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encoder
+	.byte	0
+	.uleb128 0x17
+	.quad	.LVL16
+	.long	0x159c
+	.long	0x16b6
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL17
+	.long	0x1585
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x180f
+	.quad	.LBI12
+	.byte	.LVU94
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.byte	0x1
+	.byte	0xe5
+	.byte	0xd
+	.long	0x172c
+	.uleb128 0x1e
+	.long	0x181c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1e
+	.long	0x1826
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x16
+	.quad	.LVL19
+	.long	0x156f
+	.uleb128 0x14
+	.quad	.LVL22
+	.long	0x1554
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	0x1809
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.byte	0x1
+	.byte	0xef
+	.byte	0xd
+	.uleb128 0x16
+	.quad	.LVL25
+	.long	0x156f
+	.uleb128 0x17
+	.quad	.LVL26
+	.long	0x1554
+	.long	0x1770
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encodedFrame
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL27
+	.long	0x152a
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encoder
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	encodedFrame
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1253
+	.byte	0xb4
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1804
+	.uleb128 0x2d
+	.long	.LASF1263
+	.byte	0x1
+	.byte	0xb4
+	.byte	0x24
+	.long	0x107
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x18
+	.long	.LASF1254
+	.byte	0xb6
+	.byte	0x16
+	.long	0x1804
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x18
+	.long	.LASF1255
+	.byte	0xb7
+	.byte	0xd
+	.long	0xe5
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.long	.LASF1256
+	.byte	0xb8
+	.byte	0xd
+	.long	0xe5
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x7
+	.long	0x1353
+	.uleb128 0x1f
+	.long	.LASF1259
+	.byte	0x9d
+	.uleb128 0x2e
+	.long	.LASF1264
+	.byte	0x1
+	.byte	0x8c
+	.byte	0xd
+	.byte	0x1
+	.long	0x1831
+	.uleb128 0x20
+	.long	.LASF1257
+	.byte	0x8e
+	.long	0x107
+	.uleb128 0x20
+	.long	.LASF1258
+	.byte	0x8f
+	.long	0x107
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1260
+	.byte	0x71
+	.uleb128 0x2f
+	.long	.LASF1265
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x6
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x14
+	.quad	.LVL0
+	.long	0x15fb
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0xe1
+	.byte	0x39
+	.byte	0x24
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS5:
+	.uleb128 .LVU99
+	.uleb128 .LVU110
+.LLST5:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL23-.LVL18
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU101
+	.uleb128 .LVU106
+.LLST6:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL21-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL6-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL1
+	.uleb128 .LVL7-.LVL1
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL7-.LVL1
+	.uleb128 .LVL9-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.LVL1
+	.uleb128 .LVL12-.LVL1
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL12-.LVL1
+	.uleb128 .LFE4-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU30
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+	.uleb128 .LVU50
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+.LLST1:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x13
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1e
+	.byte	0x3
+	.quad	frameQueue
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LVL6-.LVL3
+	.uleb128 0x1c
+	.byte	0x3
+	.quad	frameQueueHead
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1e
+	.byte	0x3
+	.quad	frameQueue
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL3
+	.uleb128 .LVL10-.LVL3
+	.uleb128 0x1c
+	.byte	0x3
+	.quad	frameQueueHead
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1e
+	.byte	0x3
+	.quad	frameQueue
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL3
+	.uleb128 .LVL13-.LVL3
+	.uleb128 0x1c
+	.byte	0x3
+	.quad	frameQueueHead
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1e
+	.byte	0x3
+	.quad	frameQueue
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU27
+	.uleb128 .LVU47
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL7-.LVL2
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL8-.LVL2
+	.uleb128 .LFE4-.LVL2
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+	.uleb128 .LVU48
+	.uleb128 .LVU51
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LFE4-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x4c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x5
+	.quad	.LBB8
+	.byte	0x4
+	.uleb128 .LBB8-.LBB8
+	.uleb128 .LBE8-.LBB8
+	.byte	0x4
+	.uleb128 .LBB11-.LBB8
+	.uleb128 .LBE11-.LBB8
+	.byte	0
+.LLRL7:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 31 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.file 34 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 36 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 37 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 42 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2a
+	.file 43 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 47 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF732
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF733
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 51 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x33
+	.file 52 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 53 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 54 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF764
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 55 ".//src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF774
+	.byte	0x4
+	.byte	0x4
+	.file 57 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 58 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF779
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x13
+	.byte	0x4
+	.file 59 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 60 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF854
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF858
+	.byte	0x4
+	.file 61 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 62 ".//src/main/config/config.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF868
+	.byte	0x4
+	.file 63 ".//src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF879
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF706
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF709
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF731
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF708
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF731
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF744
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF769
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF773
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF778
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.printf.h.106.e4436cd231e08efb64f4e6d3908f2921,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF782
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF787
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF791
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF794
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF801
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF815
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF857
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox_encoding.h.22.3c84c4885cb0eeaab86256bf50e23944,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF877
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF856:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF957:
+	.string	"txBuffer"
+.LASF948:
+	.string	"serialReceiveCallbackPtr"
+.LASF787:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1201:
+	.string	"magZero"
+.LASF1178:
+	.string	"gyro_sync"
+.LASF894:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF921:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF900:
+	.string	"size_t"
+.LASF1206:
+	.string	"retarded_arm"
+.LASF820:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF1070:
+	.string	"BOXPASSTHRU"
+.LASF1218:
+	.string	"loopIteration"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"ACC "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF736:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1038:
+	.string	"cli_baudrate"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF937:
+	.string	"tail"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF764:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF863:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF786:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF814:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF896:
+	.string	"int32_t"
+.LASF905:
+	.string	"PIDPITCH"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1028:
+	.string	"FUNCTION_CLI"
+.LASF828:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1176:
+	.string	"enabledFeatures"
+.LASF1243:
+	.string	"headerPosition"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1183:
+	.string	"escAndServoConfig"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF813:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF778:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1241:
+	.string	"header"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF976:
+	.string	"ALIGN_DEFAULT"
+.LASF1238:
+	.string	"encoder"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF1059:
+	.string	"BOXARM"
+.LASF757:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF818:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1230:
+	.string	"BLACKBOX_STATE_SEND_HEADER"
+.LASF879:
+	.string	"BLACKBOX_HEADER_SIZE 128"
+.LASF823:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF954:
+	.string	"inversion"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF751:
+	.string	"USE_GYRO_SITL "
+.LASF832:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF803:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF810:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF843:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF741:
+	.string	"__enable_irq() "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF508:
+	.string	"__wur "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF924:
+	.string	"flightDynamicsTrims_def_t"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1129:
+	.string	"deadband3d_throttle"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF775:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF922:
+	.string	"roll"
+.LASF1007:
+	.string	"boardAlignment_s"
+.LASF1011:
+	.string	"boardAlignment_t"
+.LASF1119:
+	.string	"motorMixer_t"
+.LASF743:
+	.string	"U_ID_1 0"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"_GCC_SIZE_T "
+.LASF1264:
+	.string	"sendHeader"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF993:
+	.string	"accHardware"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF932:
+	.string	"axisPID"
+.LASF904:
+	.string	"PIDROLL"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1003:
+	.string	"baro_noise_lpf"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF871:
+	.string	"BLACKBOX_DATA_VERSION 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF715:
+	.string	"_T_SIZE "
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF911:
+	.string	"PIDLEVEL"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF958:
+	.string	"callback"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1245:
+	.string	"serialTxBytesFree"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF933:
+	.string	"ringBuffer_s"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF733:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF984:
+	.string	"CW270_DEG_FLIP"
+.LASF867:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1210:
+	.string	"fixedwing_althold_dir"
+.LASF1097:
+	.string	"rcCommand"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF886:
+	.string	"__uint8_t"
+.LASF975:
+	.string	"inputFilteringMode_e"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1141:
+	.string	"failsafe_throttle"
+.LASF981:
+	.string	"CW0_DEG_FLIP"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF999:
+	.string	"accDeadband_s"
+.LASF1000:
+	.string	"accDeadband_t"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1128:
+	.string	"neutral3d"
+.LASF753:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF864:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF713:
+	.string	"_SYS_SIZE_T_H "
+.LASF1094:
+	.string	"rollPitchRate"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1251:
+	.string	"openSerialPort"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF892:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF986:
+	.string	"sensorAlignmentConfig_s"
+.LASF990:
+	.string	"sensorAlignmentConfig_t"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF785:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1145:
+	.string	"OK_TO_ARM"
+.LASF847:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1170:
+	.string	"failsafeConfig"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF906:
+	.string	"PIDYAW"
+.LASF1263:
+	.string	"currentTime"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF1142:
+	.string	"failsafe_min_usec"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1033:
+	.string	"FUNCTION_BLACKBOX"
+.LASF950:
+	.string	"serialPort"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1224:
+	.string	"frameIndex"
+.LASF822:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF800:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF966:
+	.string	"setRxFrameCallback"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF728:
+	.string	"__need_size_t"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF936:
+	.string	"head"
+.LASF1010:
+	.string	"yawDegrees"
+.LASF1079:
+	.string	"BOXAUTOTUNE"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1013:
+	.string	"vbatscale"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF917:
+	.string	"dterm_lpf_hz"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1240:
+	.string	"encodedFrameLength"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF798:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1082:
+	.string	"boxId_e"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1233:
+	.string	"blackboxState"
+.LASF884:
+	.string	"signed char"
+.LASF829:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF897:
+	.string	"uint8_t"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1191:
+	.string	"acc_hardware"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1095:
+	.string	"yawRate"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1153:
+	.string	"dynThrPID"
+.LASF994:
+	.string	"baroHardware"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1148:
+	.string	"armingFlags"
+.LASF869:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1189:
+	.string	"boardAlignment"
+.LASF765:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1078:
+	.string	"BOXTELEMETRY"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF880:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1223:
+	.string	"historyLength"
+.LASF1246:
+	.string	"strlen"
+.LASF1092:
+	.string	"thrMid8"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1029:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF760:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF699:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1167:
+	.string	"throttle_correction_angle"
+.LASF732:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF756:
+	.string	"USE_USART1 "
+.LASF1123:
+	.string	"tri_unarmed_servo"
+.LASF853:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1086:
+	.string	"rangeStartStep"
+.LASF390:
+	.string	"bool _Bool"
+.LASF805:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF940:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1164:
+	.string	"yaw_deadband"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1237:
+	.string	"frameQueueTail"
+.LASF799:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF972:
+	.string	"_Bool"
+.LASF783:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF838:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF719:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF729:
+	.string	"NULL"
+.LASF977:
+	.string	"CW0_DEG"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF840:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF746:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1065:
+	.string	"BOXHEADADJ"
+.LASF914:
+	.string	"PID_ITEM_COUNT"
+.LASF893:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF876:
+	.string	"BLACKBOX_MARKER_INTER_FRAME 'P'"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1069:
+	.string	"BOXGPSHOLD"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF708:
+	.string	"__need_size_t "
+.LASF1127:
+	.string	"deadband3d_high"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF916:
+	.string	"H_level"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF851:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF889:
+	.string	"__uint16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF709:
+	.string	"__need_NULL "
+.LASF1043:
+	.string	"escAndServoConfig_s"
+.LASF1047:
+	.string	"escAndServoConfig_t"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF748:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1076:
+	.string	"BOXGOV"
+.LASF710:
+	.string	"__size_t__ "
+.LASF1172:
+	.string	"gimbalConfig"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF780:
+	.string	"__TFP_PRINTF__ "
+.LASF1055:
+	.string	"mincheck"
+.LASF964:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF738:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF1146:
+	.string	"PREVENT_ARMING"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1068:
+	.string	"BOXGPSHOME"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1154:
+	.string	"tpa_breakpoint"
+.LASF739:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF909:
+	.string	"PIDPOSR"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF796:
+	.string	"LON 1"
+.LASF745:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1001:
+	.string	"barometerConfig_s"
+.LASF1006:
+	.string	"barometerConfig_t"
+.LASF1258:
+	.string	"bytesFree"
+.LASF1248:
+	.string	"tfp_sprintf"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1120:
+	.string	"throttle"
+.LASF811:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1249:
+	.string	"blackboxEncoderInit"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1002:
+	.string	"baro_sample_count"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF770:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF726:
+	.string	"_SIZET_ "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF794:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF824:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF696:
+	.string	"__GNUC_VA_LIST "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1162:
+	.string	"modeActivationConditions"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1066:
+	.string	"BOXCAMSTAB"
+.LASF727:
+	.string	"__size_t "
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF927:
+	.string	"rollAndPitchTrims_s"
+.LASF929:
+	.string	"rollAndPitchTrims_t"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF749:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF934:
+	.string	"buffer"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF795:
+	.string	"LAT 0"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1182:
+	.string	"customMixer"
+.LASF961:
+	.string	"serialTotalBytesWaiting"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1135:
+	.string	"rate"
+.LASF1152:
+	.string	"controlRateConfig"
+.LASF1244:
+	.string	"blackboxEncodeFrame"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1225:
+	.string	"history"
+.LASF730:
+	.string	"NULL ((void *)0)"
+.LASF1179:
+	.string	"gyro_sync_denom"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF716:
+	.string	"__SIZE_T "
+.LASF878:
+	.string	"BLACKBOX_QUEUE_SIZE 8"
+.LASF750:
+	.string	"GYRO "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF855:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1256:
+	.string	"index"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF862:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF945:
+	.string	"MODE_RXTX"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1008:
+	.string	"rollDegrees"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1166:
+	.string	"alt_hold_fast_change"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1112:
+	.string	"frsky_inversion"
+.LASF956:
+	.string	"rxBuffer"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1083:
+	.string	"modeActivationCondition_s"
+.LASF1088:
+	.string	"modeActivationCondition_t"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1158:
+	.string	"accz_lpf_cutoff"
+.LASF883:
+	.string	"long unsigned int"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF875:
+	.string	"BLACKBOX_MARKER_INTRA_FRAME 'I'"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1009:
+	.string	"pitchDegrees"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF987:
+	.string	"gyro_align"
+.LASF1132:
+	.string	"flaps_speed"
+.LASF967:
+	.string	"writeBuf"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1209:
+	.string	"airplaneConfig"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF714:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1136:
+	.string	"forwardFromChannel"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF744:
+	.string	"U_ID_2 0"
+.LASF991:
+	.string	"knownSensors_s"
+.LASF998:
+	.string	"knownSensors_t"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF806:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1052:
+	.string	"rcmap"
+.LASF1204:
+	.string	"rxConfig"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1188:
+	.string	"sensorAlignmentConfig"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF982:
+	.string	"CW90_DEG_FLIP"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1049:
+	.string	"gimbal_flags"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1102:
+	.string	"telemetryProvider_e"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF989:
+	.string	"mag_align"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF754:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1265:
+	.string	"blackboxInit"
+.LASF758:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF693:
+	.string	"_STDARG_H "
+.LASF980:
+	.string	"CW270_DEG"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF821:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF970:
+	.string	"txCommit"
+.LASF1208:
+	.string	"small_angle"
+.LASF1126:
+	.string	"deadband3d_low"
+.LASF865:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1195:
+	.string	"attitude_estimator"
+.LASF1103:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1215:
+	.string	"current_profile_index"
+.LASF1034:
+	.string	"serialPortFunction_e"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF697:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1106:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1015:
+	.string	"vbatmincellvoltage"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF834:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF846:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF1234:
+	.string	"blackboxPort"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1161:
+	.string	"acc_unarmedcal"
+.LASF891:
+	.string	"__uint32_t"
+.LASF717:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF935:
+	.string	"mask"
+.LASF734:
+	.string	"_STRINGS_H 1"
+.LASF946:
+	.string	"MODE_SBUS"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1192:
+	.string	"gyro_lpf"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1169:
+	.string	"servoConf"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF848:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF949:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF1216:
+	.string	"masterConfig"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1016:
+	.string	"currentMeterScale"
+.LASF844:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1190:
+	.string	"yaw_control_direction"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF735:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF959:
+	.string	"serialPortVTable"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF995:
+	.string	"calibrated"
+.LASF985:
+	.string	"sensor_align_e"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1194:
+	.string	"gyro_cmpfm_factor"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1160:
+	.string	"barometerConfig"
+.LASF1053:
+	.string	"serialrx_provider"
+.LASF1017:
+	.string	"currentMeterOffset"
+.LASF462:
+	.string	"__PMT"
+.LASF1207:
+	.string	"disarm_kill_switch"
+.LASF1202:
+	.string	"knownSensors"
+.LASF705:
+	.string	"_VA_LIST_T_H "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF947:
+	.string	"portMode_t"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1222:
+	.string	"motorCount"
+.LASF1109:
+	.string	"telemetryConfig_s"
+.LASF1118:
+	.string	"telemetryConfig_t"
+.LASF1035:
+	.string	"serialConfig_s"
+.LASF1042:
+	.string	"serialConfig_t"
+.LASF1214:
+	.string	"profile"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF793:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF918:
+	.string	"float"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF807:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1257:
+	.string	"count"
+.LASF772:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1100:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1122:
+	.string	"yaw_direction"
+.LASF358:
+	.string	"__k8 1"
+.LASF969:
+	.string	"txReserve"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF784:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF882:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1198:
+	.string	"gyroConfig"
+.LASF704:
+	.string	"_VA_LIST_DEFINED "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1143:
+	.string	"failsafe_max_usec"
+.LASF1199:
+	.string	"max_angle_inclination"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1254:
+	.string	"frame"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF825:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1026:
+	.string	"FUNCTION_NONE"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1125:
+	.string	"flight3DConfig_s"
+.LASF1130:
+	.string	"flight3DConfig_t"
+.LASF910:
+	.string	"PIDNAVR"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1057:
+	.string	"rssi_channel"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF849:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF962:
+	.string	"serialRead"
+.LASF722:
+	.string	"_SIZE_T_DECLARED "
+.LASF1239:
+	.string	"encodedFrame"
+.LASF792:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF767:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1139:
+	.string	"failsafe_delay"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1085:
+	.string	"auxChannelIndex"
+.LASF845:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF831:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF391:
+	.string	"true 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1193:
+	.string	"gyro_cmpf_factor"
+.LASF833:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1004:
+	.string	"baro_cf_vel"
+.LASF1005:
+	.string	"baro_cf_alt"
+.LASF1157:
+	.string	"acc_lpf_hz"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF858:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1062:
+	.string	"BOXBARO"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1253:
+	.string	"blackboxLogIteration"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF766:
+	.string	"HSV_HUE_MAX 359"
+.LASF1181:
+	.string	"emf_avoidance"
+.LASF1037:
+	.string	"msp_baudrate"
+.LASF1073:
+	.string	"BOXLEDLOW"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF700:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF951:
+	.string	"vTable"
+.LASF724:
+	.string	"___int_size_t_h "
+.LASF842:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF759:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF920:
+	.string	"pidProfile_s"
+.LASF919:
+	.string	"pidProfile_t"
+.LASF1116:
+	.string	"frsky_unit"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF860:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF721:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF776:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF771:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF996:
+	.string	"gyroZero"
+.LASF1213:
+	.string	"blackbox_rate_denom"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF712:
+	.string	"_SIZE_T "
+.LASF1074:
+	.string	"BOXLLIGHTS"
+.LASF827:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF997:
+	.string	"baroGroundPressure"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1185:
+	.string	"motor_pwm_rate"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF790:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1021:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF791:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1174:
+	.string	"master_t"
+.LASF963:
+	.string	"serialSetBaudRate"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1184:
+	.string	"flight3DConfig"
+.LASF1024:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1089:
+	.string	"controlRateConfig_s"
+.LASF1080:
+	.string	"BOXSONAR"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF761:
+	.string	"BLACKBOX "
+.LASF1115:
+	.string	"frsky_coordinate_format"
+.LASF701:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1203:
+	.string	"batteryConfig"
+.LASF1121:
+	.string	"mixerConfig_s"
+.LASF1124:
+	.string	"mixerConfig_t"
+.LASF1054:
+	.string	"midrc"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF983:
+	.string	"CW180_DEG_FLIP"
+.LASF1040:
+	.string	"gps_passthrough_baudrate"
+.LASF938:
+	.string	"highWaterMark"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF779:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF870:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1111:
+	.string	"telemetry_switch"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF839:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF885:
+	.string	"__int8_t"
+.LASF913:
+	.string	"PIDVEL"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF907:
+	.string	"PIDALT"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF852:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1228:
+	.string	"BLACKBOX_STATE_DISABLED"
+.LASF1061:
+	.string	"BOXHORIZON"
+.LASF942:
+	.string	"serialInversion_e"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF873:
+	.string	"BLACKBOX_I_INTERVAL 32"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF720:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF955:
+	.string	"baudRate"
+.LASF768:
+	.string	"HSV_VALUE_MAX 255"
+.LASF898:
+	.string	"uint16_t"
+.LASF773:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF1197:
+	.string	"dcm_ki"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF973:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1196:
+	.string	"dcm_kp"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1056:
+	.string	"maxcheck"
+.LASF1030:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF1081:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1105:
+	.string	"frskyGpsCoordFormat_e"
+.LASF1107:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF868:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1090:
+	.string	"rcRate8"
+.LASF1067:
+	.string	"BOXCAMTRIG"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1168:
+	.string	"throttle_correction_value"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1212:
+	.string	"telemetryConfig"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1247:
+	.string	"serialWriteBuf"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF694:
+	.string	"_ANSI_STDARG_H_ "
+.LASF1227:
+	.string	"targetPidLooptime"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1236:
+	.string	"frameQueueHead"
+.LASF740:
+	.string	"__disable_irq() "
+.LASF1147:
+	.string	"ARMED"
+.LASF1261:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF912:
+	.string	"PIDMAG"
+.LASF1046:
+	.string	"mincommand"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF971:
+	.string	"serialPort_t"
+.LASF718:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1018:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF877:
+	.string	"BLACKBOX_MAX_FRAME_SIZE (1 + 5 + 5 + (3 + 4 + 3 + 3 + BLACKBOX_MAX_MOTORS) * 3)"
+.LASF960:
+	.string	"serialWrite"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF815:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF1133:
+	.string	"servoParam_t"
+.LASF887:
+	.string	"__int16_t"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF819:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1221:
+	.string	"blackboxEncoder_s"
+.LASF1226:
+	.string	"blackboxEncoder_t"
+.LASF707:
+	.string	"_STRING_H 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF854:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF1072:
+	.string	"BOXLEDMAX"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1177:
+	.string	"looptime"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF926:
+	.string	"flightDynamicsTrims_t"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF1217:
+	.string	"blackboxFrame_s"
+.LASF1020:
+	.string	"gyroConfig_s"
+.LASF1025:
+	.string	"gyroConfig_t"
+.LASF1041:
+	.string	"reboot_character"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF763:
+	.string	"FAST_MATH "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1117:
+	.string	"batterySize"
+.LASF801:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF925:
+	.string	"values"
+.LASF903:
+	.string	"RGB_BLUE"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF930:
+	.string	"gyroData"
+.LASF1134:
+	.string	"middle"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF837:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1096:
+	.string	"controlRateConfig_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF816:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1151:
+	.string	"pidProfile"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF974:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF859:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF830:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF1163:
+	.string	"deadband"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF931:
+	.string	"accSmooth"
+.LASF769:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1252:
+	.string	"handleBlackbox"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF941:
+	.string	"SERIAL_INVERTED"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1150:
+	.string	"pidController"
+.LASF836:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1200:
+	.string	"accZero"
+.LASF908:
+	.string	"PIDPOS"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF774:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF1260:
+	.string	"startBlackbox"
+.LASF1165:
+	.string	"alt_hold_deadband"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1093:
+	.string	"thrExpo8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF888:
+	.string	"short int"
+.LASF939:
+	.string	"ringBuffer_t"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1113:
+	.string	"gpsNoFixLatitude"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1232:
+	.string	"blackboxState_e"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF953:
+	.string	"mode"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF992:
+	.string	"gyroHardware"
+.LASF817:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1012:
+	.string	"batteryConfig_s"
+.LASF1019:
+	.string	"batteryConfig_t"
+.LASF1137:
+	.string	"motor"
+.LASF1187:
+	.string	"servo_pwm_rate"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF943:
+	.string	"MODE_RX"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF895:
+	.string	"int16_t"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1114:
+	.string	"gpsNoFixLongitude"
+.LASF742:
+	.string	"U_ID_0 0x5349544c"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1144:
+	.string	"failsafeConfig_t"
+.LASF747:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1014:
+	.string	"vbatmaxcellvoltage"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1262:
+	.string	"getMotorCount"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1156:
+	.string	"accelerometerTrims"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF1045:
+	.string	"maxthrottle"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF872:
+	.string	"BLACKBOX_MAX_MOTORS 8"
+.LASF711:
+	.string	"__SIZE_T__ "
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF812:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1205:
+	.string	"inputFilteringMode"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF731:
+	.string	"__need_NULL"
+.LASF1155:
+	.string	"mag_declination"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1022:
+	.string	"soft_gyro_lpf_hz"
+.LASF703:
+	.string	"_VA_LIST "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1039:
+	.string	"gps_baudrate"
+.LASF392:
+	.string	"false 0"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF1131:
+	.string	"airplaneConfig_t"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1110:
+	.string	"telemetry_provider"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF988:
+	.string	"acc_align"
+.LASF781:
+	.string	"printf tfp_printf"
+.LASF1091:
+	.string	"rcExpo8"
+.LASF1044:
+	.string	"minthrottle"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF706:
+	.string	"__va_list__ "
+.LASF1250:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF826:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF1175:
+	.string	"mixerConfiguration"
+.LASF782:
+	.string	"sprintf tfp_sprintf"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1060:
+	.string	"BOXANGLE"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1023:
+	.string	"soft_gyro_notch_hz"
+.LASF1036:
+	.string	"serial_port_scenario"
+.LASF1242:
+	.string	"headerLength"
+.LASF1027:
+	.string	"FUNCTION_MSP"
+.LASF901:
+	.string	"RGB_RED"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF857:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1084:
+	.string	"modeId"
+.LASF944:
+	.string	"MODE_TX"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1048:
+	.string	"gimbalConfig_s"
+.LASF1050:
+	.string	"gimbalConfig_t"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF899:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF804:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1231:
+	.string	"BLACKBOX_STATE_RUNNING"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF1259:
+	.string	"sendQueuedFrames"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1075:
+	.string	"BOXCALIB"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1211:
+	.string	"serialConfig"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1087:
+	.string	"rangeEndStep"
+.LASF1159:
+	.string	"accDeadband"
+.LASF1180:
+	.string	"pid_process_denom"
+.LASF809:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF874:
+	.string	"BLACKBOX_MARKER_HEADER 'H'"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF866:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1064:
+	.string	"BOXHEADFREE"
+.LASF881:
+	.string	"short unsigned int"
+.LASF965:
+	.string	"setMode"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF968:
+	.string	"readBuf"
+.LASF923:
+	.string	"pitch"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF915:
+	.string	"A_level"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1140:
+	.string	"failsafe_off_delay"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF695:
+	.string	"__need___va_list"
+.LASF1108:
+	.string	"frskyUnit_e"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF788:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1051:
+	.string	"rxConfig_s"
+.LASF1058:
+	.string	"rxConfig_t"
+.LASF835:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1220:
+	.string	"blackboxFrame_t"
+.LASF808:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF928:
+	.string	"rollAndPitchTrims_t_def"
+.LASF1219:
+	.string	"time"
+.LASF1104:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF698:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF890:
+	.string	"__int32_t"
+.LASF850:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1149:
+	.string	"profile_s"
+.LASF1173:
+	.string	"profile_t"
+.LASF789:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF755:
+	.string	"USE_BARO_SITL "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1101:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF777:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF979:
+	.string	"CW180_DEG"
+.LASF1032:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1186:
+	.string	"dshot_rate"
+.LASF1171:
+	.string	"mixerConfig"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF802:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF723:
+	.string	"__DEFINED_size_t "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF902:
+	.string	"RGB_GREEN"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1031:
+	.string	"FUNCTION_GPS"
+.LASF797:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1138:
+	.string	"failsafeConfig_s"
+.LASF952:
+	.string	"identifier"
+.LASF978:
+	.string	"CW90_DEG"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1077:
+	.string	"BOXOSD"
+.LASF702:
+	.string	"_VA_LIST_ "
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1071:
+	.string	"BOXBEEPERON"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1229:
+	.string	"BLACKBOX_STATE_STOPPED"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF762:
+	.string	"PROFILING "
+.LASF1063:
+	.string	"BOXMAG"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1099:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF1235:
+	.string	"frameQueue"
+.LASF737:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF861:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF1098:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF841:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1255:
+	.string	"nextHead"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/blackbox/blackbox.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14540 @@
+	.file	"blackbox_encoding.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/blackbox/blackbox_encoding.c"
+	.section	.text.writeFields,"ax",@progbits
+	.p2align 4
+	.type	writeFields, @function
+writeFields:
+.LVL0:
+.LFB3:
+	.file 1 ".//src/main/blackbox/blackbox_encoding.c"
+	.loc 1 78 1 view -0
+	.cfi_startproc
+	.loc 1 79 5 view .LVU1
+	.loc 1 78 1 is_stmt 0 view .LVU2
+	movq	%rdi, %rax
+	movl	%ecx, %r9d
+	movq	%rdx, %rdi
+.LVL1:
+.LBB46:
+.LBI46:
+	.loc 1 66 17 is_stmt 1 view .LVU3
+.LBB47:
+	.loc 1 68 5 view .LVU4
+	.loc 1 70 5 view .LVU5
+	.loc 1 70 27 view .LVU6
+.LBE47:
+.LBE46:
+	.loc 1 78 1 is_stmt 0 view .LVU7
+	movl	$8, %ecx
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+.LBB57:
+.LBB56:
+	.loc 1 71 9 is_stmt 1 view .LVU8
+	.loc 1 71 67 is_stmt 0 view .LVU9
+	movswl	(%rdi,%rcx), %edx
+	.loc 1 71 46 view .LVU10
+	movswl	(%rsi,%rcx), %r8d
+	.loc 1 71 18 view .LVU11
+	subl	%edx, %r8d
+.LVL3:
+.LBB48:
+.LBI48:
+	.loc 1 60 17 is_stmt 1 view .LVU12
+.LBB49:
+	.loc 1 63 5 view .LVU13
+	.loc 1 63 53 is_stmt 0 view .LVU14
+	leal	(%r8,%r8), %edx
+	.loc 1 63 78 view .LVU15
+	sarl	$31, %r8d
+.LVL4:
+	.loc 1 63 12 view .LVU16
+	xorl	%r8d, %edx
+.LVL5:
+.LBB50:
+.LBI50:
+	.loc 1 49 17 is_stmt 1 view .LVU17
+.LBB51:
+	.loc 1 51 5 view .LVU18
+	.loc 1 51 18 view .LVU19
+	cmpl	$127, %edx
+	jbe	.L18
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 52 9 view .LVU20
+	.loc 1 52 21 is_stmt 0 view .LVU21
+	movl	%edx, %r8d
+	.loc 1 52 16 view .LVU22
+	addq	$1, %rax
+.LVL7:
+	.loc 1 53 15 view .LVU23
+	shrl	$7, %edx
+.LVL8:
+	.loc 1 52 21 view .LVU24
+	orl	$-128, %r8d
+	movb	%r8b, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU25
+.LVL9:
+	.loc 1 51 18 view .LVU26
+	cmpl	$127, %edx
+	ja	.L3
+.L18:
+	.loc 1 51 18 is_stmt 0 view .LVU27
+	movq	%rax, %r8
+	.loc 1 55 5 is_stmt 1 view .LVU28
+.LVL10:
+	.loc 1 55 5 is_stmt 0 view .LVU29
+.LBE51:
+.LBE50:
+.LBE49:
+.LBE48:
+	.loc 1 70 27 view .LVU30
+	addq	$2, %rcx
+.LVL11:
+.LBB55:
+.LBB54:
+.LBB53:
+.LBB52:
+	.loc 1 55 12 view .LVU31
+	addq	$1, %rax
+.LVL12:
+	.loc 1 55 15 view .LVU32
+	movb	%dl, (%r8)
+	.loc 1 57 5 is_stmt 1 view .LVU33
+.LVL13:
+	.loc 1 57 5 is_stmt 0 view .LVU34
+.LBE52:
+.LBE53:
+.LBE54:
+.LBE55:
+	.loc 1 70 41 is_stmt 1 view .LVU35
+	.loc 1 70 27 view .LVU36
+	cmpq	$14, %rcx
+	jne	.L4
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 70 27 is_stmt 0 view .LVU37
+.LBE56:
+.LBE57:
+.LBB58:
+.LBB59:
+	.loc 1 71 9 is_stmt 1 view .LVU38
+	.loc 1 71 67 is_stmt 0 view .LVU39
+	movswl	(%rdi,%rcx), %edx
+	.loc 1 71 46 view .LVU40
+	movswl	(%rsi,%rcx), %r8d
+	.loc 1 71 18 view .LVU41
+	subl	%edx, %r8d
+.LVL15:
+.LBB60:
+.LBI60:
+	.loc 1 60 17 is_stmt 1 view .LVU42
+.LBB61:
+	.loc 1 63 5 view .LVU43
+	.loc 1 63 53 is_stmt 0 view .LVU44
+	leal	(%r8,%r8), %edx
+	.loc 1 63 78 view .LVU45
+	sarl	$31, %r8d
+.LVL16:
+	.loc 1 63 12 view .LVU46
+	xorl	%r8d, %edx
+.LVL17:
+.LBB62:
+.LBI62:
+	.loc 1 49 17 is_stmt 1 view .LVU47
+.LBB63:
+	.loc 1 51 5 view .LVU48
+	.loc 1 51 18 view .LVU49
+	cmpl	$127, %edx
+	jbe	.L19
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.loc 1 52 9 view .LVU50
+	.loc 1 52 21 is_stmt 0 view .LVU51
+	movl	%edx, %r8d
+	.loc 1 52 16 view .LVU52
+	addq	$1, %rax
+.LVL19:
+	.loc 1 53 15 view .LVU53
+	shrl	$7, %edx
+.LVL20:
+	.loc 1 52 21 view .LVU54
+	orl	$-128, %r8d
+	movb	%r8b, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU55
+.LVL21:
+	.loc 1 51 18 view .LVU56
+	cmpl	$127, %edx
+	ja	.L6
+.L19:
+	.loc 1 51 18 is_stmt 0 view .LVU57
+	movq	%rax, %r8
+	.loc 1 55 5 is_stmt 1 view .LVU58
+.LVL22:
+	.loc 1 55 5 is_stmt 0 view .LVU59
+.LBE63:
+.LBE62:
+.LBE61:
+.LBE60:
+	.loc 1 70 27 view .LVU60
+	addq	$2, %rcx
+.LVL23:
+.LBB67:
+.LBB66:
+.LBB65:
+.LBB64:
+	.loc 1 55 12 view .LVU61
+	addq	$1, %rax
+.LVL24:
+	.loc 1 55 15 view .LVU62
+	movb	%dl, (%r8)
+	.loc 1 57 5 is_stmt 1 view .LVU63
+.LVL25:
+	.loc 1 57 5 is_stmt 0 view .LVU64
+.LBE64:
+.LBE65:
+.LBE66:
+.LBE67:
+	.loc 1 70 41 is_stmt 1 view .LVU65
+	.loc 1 70 27 view .LVU66
+	cmpq	$22, %rcx
+	jne	.L7
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 70 27 is_stmt 0 view .LVU67
+.LBE59:
+.LBE58:
+.LBB68:
+.LBB69:
+	.loc 1 71 9 is_stmt 1 view .LVU68
+	.loc 1 71 67 is_stmt 0 view .LVU69
+	movswl	(%rdi,%rcx), %edx
+	.loc 1 71 46 view .LVU70
+	movswl	(%rsi,%rcx), %r8d
+	.loc 1 71 18 view .LVU71
+	subl	%edx, %r8d
+.LVL27:
+.LBB70:
+.LBI70:
+	.loc 1 60 17 is_stmt 1 view .LVU72
+.LBB71:
+	.loc 1 63 5 view .LVU73
+	.loc 1 63 53 is_stmt 0 view .LVU74
+	leal	(%r8,%r8), %edx
+	.loc 1 63 78 view .LVU75
+	sarl	$31, %r8d
+.LVL28:
+	.loc 1 63 12 view .LVU76
+	xorl	%r8d, %edx
+.LVL29:
+.LBB72:
+.LBI72:
+	.loc 1 49 17 is_stmt 1 view .LVU77
+.LBB73:
+	.loc 1 51 5 view .LVU78
+	.loc 1 51 18 view .LVU79
+	cmpl	$127, %edx
+	jbe	.L20
+.LVL30:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 52 9 view .LVU80
+	.loc 1 52 21 is_stmt 0 view .LVU81
+	movl	%edx, %r8d
+	.loc 1 52 16 view .LVU82
+	addq	$1, %rax
+.LVL31:
+	.loc 1 53 15 view .LVU83
+	shrl	$7, %edx
+.LVL32:
+	.loc 1 52 21 view .LVU84
+	orl	$-128, %r8d
+	movb	%r8b, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU85
+.LVL33:
+	.loc 1 51 18 view .LVU86
+	cmpl	$127, %edx
+	ja	.L9
+.L20:
+	.loc 1 51 18 is_stmt 0 view .LVU87
+	movq	%rax, %r8
+	.loc 1 55 5 is_stmt 1 view .LVU88
+.LVL34:
+	.loc 1 55 5 is_stmt 0 view .LVU89
+.LBE73:
+.LBE72:
+.LBE71:
+.LBE70:
+	.loc 1 70 27 view .LVU90
+	addq	$2, %rcx
+.LVL35:
+.LBB77:
+.LBB76:
+.LBB75:
+.LBB74:
+	.loc 1 55 12 view .LVU91
+	addq	$1, %rax
+.LVL36:
+	.loc 1 55 15 view .LVU92
+	movb	%dl, (%r8)
+	.loc 1 57 5 is_stmt 1 view .LVU93
+.LVL37:
+	.loc 1 57 5 is_stmt 0 view .LVU94
+.LBE74:
+.LBE75:
+.LBE76:
+.LBE77:
+	.loc 1 70 41 is_stmt 1 view .LVU95
+	.loc 1 70 27 view .LVU96
+	cmpq	$28, %rcx
+	jne	.L10
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 70 27 is_stmt 0 view .LVU97
+.LBE69:
+.LBE68:
+.LBB78:
+.LBB79:
+	.loc 1 71 9 is_stmt 1 view .LVU98
+	.loc 1 71 67 is_stmt 0 view .LVU99
+	movswl	(%rdi,%rcx), %edx
+	.loc 1 71 46 view .LVU100
+	movswl	(%rsi,%rcx), %r8d
+	.loc 1 71 18 view .LVU101
+	subl	%edx, %r8d
+.LVL39:
+.LBB80:
+.LBI80:
+	.loc 1 60 17 is_stmt 1 view .LVU102
+.LBB81:
+	.loc 1 63 5 view .LVU103
+	.loc 1 63 53 is_stmt 0 view .LVU104
+	leal	(%r8,%r8), %edx
+	.loc 1 63 78 view .LVU105
+	sarl	$31, %r8d
+.LVL40:
+	.loc 1 63 12 view .LVU106
+	xorl	%r8d, %edx
+.LVL41:
+.LBB82:
+.LBI82:
+	.loc 1 49 17 is_stmt 1 view .LVU107
+.LBB83:
+	.loc 1 51 5 view .LVU108
+	.loc 1 51 18 view .LVU109
+	cmpl	$127, %edx
+	jbe	.L21
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 52 9 view .LVU110
+	.loc 1 52 21 is_stmt 0 view .LVU111
+	movl	%edx, %r8d
+	.loc 1 52 16 view .LVU112
+	addq	$1, %rax
+.LVL43:
+	.loc 1 53 15 view .LVU113
+	shrl	$7, %edx
+.LVL44:
+	.loc 1 52 21 view .LVU114
+	orl	$-128, %r8d
+	movb	%r8b, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU115
+.LVL45:
+	.loc 1 51 18 view .LVU116
+	cmpl	$127, %edx
+	ja	.L12
+.L21:
+	.loc 1 51 18 is_stmt 0 view .LVU117
+	movq	%rax, %r8
+	.loc 1 55 5 is_stmt 1 view .LVU118
+.LVL46:
+	.loc 1 55 5 is_stmt 0 view .LVU119
+.LBE83:
+.LBE82:
+.LBE81:
+.LBE80:
+	.loc 1 70 27 view .LVU120
+	addq	$2, %rcx
+.LVL47:
+.LBB87:
+.LBB86:
+.LBB85:
+.LBB84:
+	.loc 1 55 12 view .LVU121
+	addq	$1, %rax
+.LVL48:
+	.loc 1 55 15 view .LVU122
+	movb	%dl, (%r8)
+	.loc 1 57 5 is_stmt 1 view .LVU123
+.LVL49:
+	.loc 1 57 5 is_stmt 0 view .LVU124
+.LBE84:
+.LBE85:
+.LBE86:
+.LBE87:
+	.loc 1 70 41 is_stmt 1 view .LVU125
+	.loc 1 70 27 view .LVU126
+	cmpq	$34, %rcx
+	jne	.L13
+	.loc 1 74 5 view .LVU127
+.LVL50:
+	.loc 1 74 5 is_stmt 0 view .LVU128
+.LBE79:
+.LBE78:
+	.loc 1 83 5 is_stmt 1 view .LVU129
+.LBB88:
+.LBI88:
+	.loc 1 66 17 view .LVU130
+.LBB89:
+	.loc 1 70 27 view .LVU131
+	testb	%r9b, %r9b
+	je	.L1
+	movzbl	%r9b, %r9d
+	.loc 1 70 27 is_stmt 0 view .LVU132
+	xorl	%r8d, %r8d
+	addq	%r9, %r9
+.LVL51:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 71 9 is_stmt 1 view .LVU133
+	.loc 1 71 67 is_stmt 0 view .LVU134
+	movswl	34(%rdi,%r8), %edx
+	.loc 1 71 46 view .LVU135
+	movswl	34(%rsi,%r8), %ecx
+	.loc 1 71 18 view .LVU136
+	subl	%edx, %ecx
+.LVL52:
+.LBB90:
+.LBI90:
+	.loc 1 60 17 is_stmt 1 view .LVU137
+.LBB91:
+	.loc 1 63 5 view .LVU138
+	.loc 1 63 53 is_stmt 0 view .LVU139
+	leal	(%rcx,%rcx), %edx
+	.loc 1 63 78 view .LVU140
+	sarl	$31, %ecx
+.LVL53:
+	.loc 1 63 12 view .LVU141
+	xorl	%ecx, %edx
+.LVL54:
+.LBB92:
+.LBI92:
+	.loc 1 49 17 is_stmt 1 view .LVU142
+.LBB93:
+	.loc 1 51 5 view .LVU143
+	.loc 1 51 18 view .LVU144
+	cmpl	$127, %edx
+	jbe	.L23
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 52 9 view .LVU145
+	.loc 1 52 21 is_stmt 0 view .LVU146
+	movl	%edx, %ecx
+	.loc 1 52 16 view .LVU147
+	addq	$1, %rax
+.LVL56:
+	.loc 1 53 15 view .LVU148
+	shrl	$7, %edx
+.LVL57:
+	.loc 1 52 21 view .LVU149
+	orl	$-128, %ecx
+	movb	%cl, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU150
+.LVL58:
+	.loc 1 51 18 view .LVU151
+	cmpl	$127, %edx
+	ja	.L16
+.L23:
+	.loc 1 51 18 is_stmt 0 view .LVU152
+	movq	%rax, %rcx
+	.loc 1 55 5 is_stmt 1 view .LVU153
+.LBE93:
+.LBE92:
+.LBE91:
+.LBE90:
+	.loc 1 70 27 is_stmt 0 view .LVU154
+	addq	$2, %r8
+.LVL59:
+.LBB97:
+.LBB96:
+.LBB95:
+.LBB94:
+	.loc 1 55 12 view .LVU155
+	addq	$1, %rax
+.LVL60:
+	.loc 1 55 15 view .LVU156
+	movb	%dl, (%rcx)
+	.loc 1 57 5 is_stmt 1 view .LVU157
+.LVL61:
+	.loc 1 57 5 is_stmt 0 view .LVU158
+.LBE94:
+.LBE95:
+.LBE96:
+.LBE97:
+	.loc 1 70 41 is_stmt 1 view .LVU159
+	.loc 1 70 27 view .LVU160
+	cmpq	%r9, %r8
+	jne	.L17
+.LVL62:
+.L1:
+	.loc 1 70 27 is_stmt 0 view .LVU161
+.LBE89:
+.LBE88:
+	.loc 1 86 1 view .LVU162
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	writeFields, .-writeFields
+	.section	.text.readFields,"ax",@progbits
+	.p2align 4
+	.type	readFields, @function
+readFields:
+.LVL63:
+.LFB7:
+	.loc 1 134 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 135 5 view .LVU164
+	.loc 1 134 1 is_stmt 0 view .LVU165
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LBB128:
+.LBB129:
+.LBB130:
+.LBB131:
+.LBB132:
+.LBB133:
+	.loc 1 95 39 view .LVU166
+	movl	8(%rdi), %r8d
+.LBE133:
+.LBE132:
+.LBE131:
+.LBE130:
+.LBE129:
+.LBE128:
+	.loc 1 134 1 view .LVU167
+	movq	%rsi, %r9
+	movq	%rdx, %r10
+.LVL64:
+.LBB162:
+.LBI128:
+	.loc 1 119 13 is_stmt 1 view .LVU168
+.LBB156:
+	.loc 1 121 5 view .LVU169
+	.loc 1 122 5 view .LVU170
+	.loc 1 124 5 view .LVU171
+	.loc 1 124 27 view .LVU172
+.LBE156:
+.LBE162:
+	.loc 1 134 1 is_stmt 0 view .LVU173
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+.LBB163:
+.LBB157:
+.LBB150:
+.LBB144:
+.LBB139:
+.LBB134:
+	.loc 1 95 19 view .LVU174
+	movl	12(%rdi), %eax
+.LBE134:
+.LBE139:
+.LBE144:
+.LBE150:
+.LBE157:
+.LBE163:
+	.loc 1 134 1 view .LVU175
+	movl	%ecx, %r11d
+.LBB164:
+.LBB158:
+.LBB151:
+.LBB145:
+.LBB140:
+.LBB135:
+	.loc 1 95 19 view .LVU176
+	movl	$8, %esi
+.LVL65:
+	.loc 1 95 19 view .LVU177
+.LBE135:
+.LBE140:
+.LBE145:
+.LBE151:
+.LBE158:
+.LBE164:
+	.loc 1 134 1 view .LVU178
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+.LBB165:
+.LBB159:
+	.loc 1 125 9 is_stmt 1 view .LVU179
+	.loc 1 125 28 is_stmt 0 view .LVU180
+	movswl	(%r10,%rsi), %r13d
+.LVL67:
+.LBB152:
+.LBI130:
+	.loc 1 112 16 is_stmt 1 view .LVU181
+.LBB146:
+	.loc 1 114 5 view .LVU182
+.LBB141:
+.LBI132:
+	.loc 1 88 17 view .LVU183
+.LBB136:
+	.loc 1 94 35 view .LVU184
+	movl	%eax, %edx
+.LBE136:
+.LBE141:
+.LBE146:
+.LBE152:
+	.loc 1 125 28 is_stmt 0 view .LVU185
+	xorl	%ecx, %ecx
+.LBB153:
+.LBB147:
+.LBB142:
+.LBB137:
+	.loc 1 90 14 view .LVU186
+	xorl	%r12d, %r12d
+.LVL68:
+.L39:
+	.loc 1 90 14 view .LVU187
+	movl	%edx, %eax
+.LVL69:
+	.loc 1 95 9 is_stmt 1 view .LVU188
+	.loc 1 95 12 is_stmt 0 view .LVU189
+	cmpl	%r8d, %edx
+	jnb	.L87
+	.loc 1 100 9 is_stmt 1 view .LVU190
+	.loc 1 100 22 is_stmt 0 view .LVU191
+	movq	(%rdi), %rbx
+.LVL70:
+	.loc 1 100 45 view .LVU192
+	leal	1(%rdx), %eax
+.LVL71:
+	.loc 1 100 45 view .LVU193
+	movl	%eax, 12(%rdi)
+	.loc 1 100 14 view .LVU194
+	movzbl	(%rbx,%rdx), %ebp
+.LVL72:
+	.loc 1 101 9 is_stmt 1 view .LVU195
+	.loc 1 101 18 is_stmt 0 view .LVU196
+	movl	%ebp, %ebx
+	andl	$127, %ebx
+	.loc 1 101 42 view .LVU197
+	sall	%cl, %ebx
+	.loc 1 101 15 view .LVU198
+	orl	%ebx, %r12d
+.LVL73:
+	.loc 1 103 9 is_stmt 1 view .LVU199
+	.loc 1 103 12 is_stmt 0 view .LVU200
+	testb	%bpl, %bpl
+	jns	.L38
+	.loc 1 94 49 is_stmt 1 view .LVU201
+.LVL74:
+	.loc 1 94 35 view .LVU202
+	addl	$7, %ecx
+	addq	$1, %rdx
+.LVL75:
+	.loc 1 94 35 is_stmt 0 view .LVU203
+	cmpl	$35, %ecx
+	jne	.L39
+	.loc 1 108 5 is_stmt 1 view .LVU204
+	.loc 1 108 23 is_stmt 0 view .LVU205
+	movb	$1, 17(%rdi)
+	.loc 1 109 5 is_stmt 1 view .LVU206
+.LVL76:
+	.loc 1 109 5 is_stmt 0 view .LVU207
+.LBE137:
+.LBE142:
+	.loc 1 116 5 is_stmt 1 view .LVU208
+	.loc 1 116 5 is_stmt 0 view .LVU209
+.LBE147:
+.LBE153:
+	.loc 1 126 9 is_stmt 1 view .LVU210
+.L37:
+	.loc 1 129 9 view .LVU211
+	.loc 1 129 23 is_stmt 0 view .LVU212
+	movw	%r13w, (%r9,%rsi)
+	.loc 1 124 41 is_stmt 1 view .LVU213
+.LVL77:
+	.loc 1 124 27 view .LVU214
+	addq	$2, %rsi
+.LVL78:
+	.loc 1 124 27 is_stmt 0 view .LVU215
+	cmpq	$14, %rsi
+	jne	.L42
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 124 27 view .LVU216
+.LBE159:
+.LBE165:
+.LBB166:
+.LBB167:
+	.loc 1 125 9 is_stmt 1 view .LVU217
+	.loc 1 125 28 is_stmt 0 view .LVU218
+	movswl	(%r10,%rsi), %r13d
+.LVL80:
+.LBB168:
+.LBI168:
+	.loc 1 112 16 is_stmt 1 view .LVU219
+.LBB169:
+	.loc 1 114 5 view .LVU220
+.LBB170:
+.LBI170:
+	.loc 1 88 17 view .LVU221
+.LBB171:
+	.loc 1 94 35 view .LVU222
+	movl	%eax, %edx
+.LBE171:
+.LBE170:
+.LBE169:
+.LBE168:
+	.loc 1 125 28 is_stmt 0 view .LVU223
+	xorl	%ecx, %ecx
+.LBB179:
+.LBB176:
+.LBB174:
+.LBB172:
+	.loc 1 90 14 view .LVU224
+	xorl	%r12d, %r12d
+.LVL81:
+.L46:
+	.loc 1 90 14 view .LVU225
+	movl	%edx, %eax
+.LVL82:
+	.loc 1 95 9 is_stmt 1 view .LVU226
+	.loc 1 95 12 is_stmt 0 view .LVU227
+	cmpl	%r8d, %edx
+	jnb	.L88
+	.loc 1 100 9 is_stmt 1 view .LVU228
+	.loc 1 100 22 is_stmt 0 view .LVU229
+	movq	(%rdi), %rbx
+.LVL83:
+	.loc 1 100 45 view .LVU230
+	leal	1(%rdx), %eax
+.LVL84:
+	.loc 1 100 45 view .LVU231
+	movl	%eax, 12(%rdi)
+	.loc 1 100 14 view .LVU232
+	movzbl	(%rbx,%rdx), %ebp
+.LVL85:
+	.loc 1 101 9 is_stmt 1 view .LVU233
+	.loc 1 101 18 is_stmt 0 view .LVU234
+	movl	%ebp, %ebx
+	andl	$127, %ebx
+	.loc 1 101 42 view .LVU235
+	sall	%cl, %ebx
+	.loc 1 101 15 view .LVU236
+	orl	%ebx, %r12d
+.LVL86:
+	.loc 1 103 9 is_stmt 1 view .LVU237
+	.loc 1 103 12 is_stmt 0 view .LVU238
+	testb	%bpl, %bpl
+	jns	.L45
+	.loc 1 94 49 is_stmt 1 view .LVU239
+.LVL87:
+	.loc 1 94 35 view .LVU240
+	addl	$7, %ecx
+	addq	$1, %rdx
+.LVL88:
+	.loc 1 94 35 is_stmt 0 view .LVU241
+	cmpl	$35, %ecx
+	jne	.L46
+	.loc 1 108 5 is_stmt 1 view .LVU242
+	.loc 1 108 23 is_stmt 0 view .LVU243
+	movb	$1, 17(%rdi)
+	.loc 1 109 5 is_stmt 1 view .LVU244
+.LVL89:
+	.loc 1 109 5 is_stmt 0 view .LVU245
+.LBE172:
+.LBE174:
+	.loc 1 116 5 is_stmt 1 view .LVU246
+	.loc 1 116 5 is_stmt 0 view .LVU247
+.LBE176:
+.LBE179:
+	.loc 1 126 9 is_stmt 1 view .LVU248
+.L44:
+	.loc 1 129 9 view .LVU249
+	.loc 1 129 23 is_stmt 0 view .LVU250
+	movw	%r13w, (%r9,%rsi)
+	.loc 1 124 41 is_stmt 1 view .LVU251
+.LVL90:
+	.loc 1 124 27 view .LVU252
+	addq	$2, %rsi
+.LVL91:
+	.loc 1 124 27 is_stmt 0 view .LVU253
+	cmpq	$22, %rsi
+	jne	.L49
+.LVL92:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 124 27 view .LVU254
+.LBE167:
+.LBE166:
+.LBB184:
+.LBB185:
+	.loc 1 125 9 is_stmt 1 view .LVU255
+	.loc 1 125 28 is_stmt 0 view .LVU256
+	movswl	(%r10,%rsi), %r13d
+.LVL93:
+.LBB186:
+.LBI186:
+	.loc 1 112 16 is_stmt 1 view .LVU257
+.LBB187:
+	.loc 1 114 5 view .LVU258
+.LBB188:
+.LBI188:
+	.loc 1 88 17 view .LVU259
+.LBB189:
+	.loc 1 94 35 view .LVU260
+	movl	%eax, %edx
+.LBE189:
+.LBE188:
+.LBE187:
+.LBE186:
+	.loc 1 125 28 is_stmt 0 view .LVU261
+	xorl	%ecx, %ecx
+.LBB197:
+.LBB194:
+.LBB192:
+.LBB190:
+	.loc 1 90 14 view .LVU262
+	xorl	%r12d, %r12d
+.LVL94:
+.L53:
+	.loc 1 90 14 view .LVU263
+	movl	%edx, %eax
+.LVL95:
+	.loc 1 95 9 is_stmt 1 view .LVU264
+	.loc 1 95 12 is_stmt 0 view .LVU265
+	cmpl	%r8d, %edx
+	jnb	.L89
+	.loc 1 100 9 is_stmt 1 view .LVU266
+	.loc 1 100 22 is_stmt 0 view .LVU267
+	movq	(%rdi), %rbx
+.LVL96:
+	.loc 1 100 45 view .LVU268
+	leal	1(%rdx), %eax
+	movl	%eax, 12(%rdi)
+	.loc 1 100 14 view .LVU269
+	movzbl	(%rbx,%rdx), %ebp
+.LVL97:
+	.loc 1 101 9 is_stmt 1 view .LVU270
+	.loc 1 101 18 is_stmt 0 view .LVU271
+	movl	%ebp, %ebx
+	andl	$127, %ebx
+	.loc 1 101 42 view .LVU272
+	sall	%cl, %ebx
+	.loc 1 101 15 view .LVU273
+	orl	%ebx, %r12d
+.LVL98:
+	.loc 1 103 9 is_stmt 1 view .LVU274
+	.loc 1 103 12 is_stmt 0 view .LVU275
+	testb	%bpl, %bpl
+	jns	.L52
+	.loc 1 94 49 is_stmt 1 view .LVU276
+.LVL99:
+	.loc 1 94 35 view .LVU277
+	addl	$7, %ecx
+	addq	$1, %rdx
+.LVL100:
+	.loc 1 94 35 is_stmt 0 view .LVU278
+	cmpl	$35, %ecx
+	jne	.L53
+	.loc 1 108 5 is_stmt 1 view .LVU279
+	.loc 1 108 23 is_stmt 0 view .LVU280
+	movb	$1, 17(%rdi)
+	.loc 1 109 5 is_stmt 1 view .LVU281
+.LVL101:
+	.loc 1 109 5 is_stmt 0 view .LVU282
+.LBE190:
+.LBE192:
+	.loc 1 116 5 is_stmt 1 view .LVU283
+	.loc 1 116 5 is_stmt 0 view .LVU284
+.LBE194:
+.LBE197:
+	.loc 1 126 9 is_stmt 1 view .LVU285
+.L51:
+	.loc 1 129 9 view .LVU286
+	.loc 1 129 23 is_stmt 0 view .LVU287
+	movw	%r13w, (%r9,%rsi)
+	.loc 1 124 41 is_stmt 1 view .LVU288
+.LVL102:
+	.loc 1 124 27 view .LVU289
+	addq	$2, %rsi
+.LVL103:
+	.loc 1 124 27 is_stmt 0 view .LVU290
+	cmpq	$28, %rsi
+	jne	.L56
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.loc 1 124 27 view .LVU291
+.LBE185:
+.LBE184:
+.LBB201:
+.LBB202:
+	.loc 1 125 9 is_stmt 1 view .LVU292
+	.loc 1 125 28 is_stmt 0 view .LVU293
+	movswl	(%r10,%rsi), %r12d
+.LVL105:
+.LBB203:
+.LBI203:
+	.loc 1 112 16 is_stmt 1 view .LVU294
+.LBB204:
+	.loc 1 114 5 view .LVU295
+.LBB205:
+.LBI205:
+	.loc 1 88 17 view .LVU296
+.LBB206:
+	.loc 1 94 35 view .LVU297
+.LBE206:
+.LBE205:
+.LBE204:
+.LBE203:
+	.loc 1 125 28 is_stmt 0 view .LVU298
+	xorl	%ecx, %ecx
+.LBB214:
+.LBB211:
+.LBB209:
+.LBB207:
+	.loc 1 90 14 view .LVU299
+	xorl	%ebp, %ebp
+.LVL106:
+.L60:
+	.loc 1 95 9 is_stmt 1 view .LVU300
+	.loc 1 95 12 is_stmt 0 view .LVU301
+	cmpl	%r8d, %eax
+	jnb	.L90
+	.loc 1 100 9 is_stmt 1 view .LVU302
+	.loc 1 100 22 is_stmt 0 view .LVU303
+	movq	(%rdi), %rdx
+	.loc 1 100 45 view .LVU304
+	leal	1(%rax), %ebx
+	movl	%ebx, 12(%rdi)
+	.loc 1 100 14 view .LVU305
+	movzbl	(%rdx,%rax), %ebx
+.LVL107:
+	.loc 1 101 9 is_stmt 1 view .LVU306
+	.loc 1 101 18 is_stmt 0 view .LVU307
+	movl	%ebx, %edx
+	andl	$127, %edx
+	.loc 1 101 42 view .LVU308
+	sall	%cl, %edx
+	.loc 1 101 15 view .LVU309
+	orl	%edx, %ebp
+.LVL108:
+	.loc 1 103 9 is_stmt 1 view .LVU310
+	.loc 1 103 12 is_stmt 0 view .LVU311
+	testb	%bl, %bl
+	jns	.L59
+	.loc 1 94 49 is_stmt 1 view .LVU312
+	.loc 1 94 35 view .LVU313
+	addl	$7, %ecx
+	addq	$1, %rax
+	.loc 1 94 35 is_stmt 0 view .LVU314
+	cmpl	$35, %ecx
+	jne	.L60
+	.loc 1 108 5 is_stmt 1 view .LVU315
+	.loc 1 108 23 is_stmt 0 view .LVU316
+	movb	$1, 17(%rdi)
+	.loc 1 109 5 is_stmt 1 view .LVU317
+.LVL109:
+	.loc 1 109 5 is_stmt 0 view .LVU318
+.LBE207:
+.LBE209:
+	.loc 1 116 5 is_stmt 1 view .LVU319
+	.loc 1 116 5 is_stmt 0 view .LVU320
+.LBE211:
+.LBE214:
+	.loc 1 126 9 is_stmt 1 view .LVU321
+.L62:
+	.loc 1 129 9 view .LVU322
+	.loc 1 129 23 is_stmt 0 view .LVU323
+	movw	%r12w, (%r9,%rsi)
+	.loc 1 124 41 is_stmt 1 view .LVU324
+.LVL110:
+	.loc 1 124 27 view .LVU325
+	addq	$2, %rsi
+.LVL111:
+	.loc 1 124 27 is_stmt 0 view .LVU326
+	cmpq	$34, %rsi
+	je	.L64
+.LVL112:
+.L91:
+	.loc 1 124 27 view .LVU327
+.LBE202:
+.LBE201:
+.LBB219:
+.LBB220:
+.LBB221:
+.LBB222:
+.LBB223:
+.LBB224:
+	.loc 1 95 19 view .LVU328
+	movl	12(%rdi), %eax
+	jmp	.L65
+.LVL113:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 95 19 view .LVU329
+.LBE224:
+.LBE223:
+.LBE222:
+.LBE221:
+.LBE220:
+.LBE219:
+.LBB237:
+.LBB217:
+.LBB215:
+.LBB212:
+.LBB210:
+.LBB208:
+	.loc 1 96 13 is_stmt 1 view .LVU330
+	.loc 1 96 29 is_stmt 0 view .LVU331
+	movb	$1, 16(%rdi)
+	.loc 1 97 13 is_stmt 1 view .LVU332
+.LVL114:
+	.loc 1 97 13 is_stmt 0 view .LVU333
+.LBE208:
+.LBE210:
+	.loc 1 116 5 is_stmt 1 view .LVU334
+	.loc 1 116 5 is_stmt 0 view .LVU335
+.LBE212:
+.LBE215:
+	.loc 1 126 9 is_stmt 1 view .LVU336
+	.loc 1 129 9 view .LVU337
+	.loc 1 129 23 is_stmt 0 view .LVU338
+	movw	%r12w, (%r9,%rsi)
+	.loc 1 124 41 is_stmt 1 view .LVU339
+.LVL115:
+	.loc 1 124 27 view .LVU340
+	addq	$2, %rsi
+.LVL116:
+	.loc 1 124 27 is_stmt 0 view .LVU341
+	cmpq	$34, %rsi
+	jne	.L91
+.LVL117:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.loc 1 124 27 view .LVU342
+.LBE217:
+.LBE237:
+	.loc 1 139 5 is_stmt 1 view .LVU343
+.LBB238:
+.LBI219:
+	.loc 1 119 13 view .LVU344
+.LBB235:
+	.loc 1 124 27 view .LVU345
+	movzbl	%r11b, %ebp
+	xorl	%ebx, %ebx
+	addq	%rbp, %rbp
+	testb	%r11b, %r11b
+	je	.L35
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.loc 1 125 9 view .LVU346
+	.loc 1 125 28 is_stmt 0 view .LVU347
+	movswl	34(%r10,%rbx), %r12d
+.LVL119:
+.LBB232:
+.LBI221:
+	.loc 1 112 16 is_stmt 1 view .LVU348
+.LBB229:
+	.loc 1 114 5 view .LVU349
+.LBB227:
+.LBI223:
+	.loc 1 88 17 view .LVU350
+.LBB225:
+	.loc 1 94 35 view .LVU351
+	movl	12(%rdi), %eax
+	.loc 1 95 19 is_stmt 0 view .LVU352
+	xorl	%ecx, %ecx
+	.loc 1 90 14 view .LVU353
+	xorl	%r11d, %r11d
+.LVL120:
+.L70:
+	.loc 1 95 9 is_stmt 1 view .LVU354
+	.loc 1 95 12 is_stmt 0 view .LVU355
+	cmpl	%r8d, %eax
+	jnb	.L92
+	.loc 1 100 9 is_stmt 1 view .LVU356
+	.loc 1 100 22 is_stmt 0 view .LVU357
+	movq	(%rdi), %rdx
+	.loc 1 100 45 view .LVU358
+	leal	1(%rax), %esi
+	movl	%esi, 12(%rdi)
+	.loc 1 100 14 view .LVU359
+	movzbl	(%rdx,%rax), %esi
+.LVL121:
+	.loc 1 101 9 is_stmt 1 view .LVU360
+	.loc 1 101 18 is_stmt 0 view .LVU361
+	movl	%esi, %edx
+	andl	$127, %edx
+	.loc 1 101 42 view .LVU362
+	sall	%cl, %edx
+	.loc 1 101 15 view .LVU363
+	orl	%edx, %r11d
+.LVL122:
+	.loc 1 103 9 is_stmt 1 view .LVU364
+	.loc 1 103 12 is_stmt 0 view .LVU365
+	testb	%sil, %sil
+	jns	.L69
+	.loc 1 94 49 is_stmt 1 view .LVU366
+	.loc 1 94 35 view .LVU367
+	addl	$7, %ecx
+	addq	$1, %rax
+	.loc 1 94 35 is_stmt 0 view .LVU368
+	cmpl	$35, %ecx
+	jne	.L70
+	.loc 1 108 5 is_stmt 1 view .LVU369
+	.loc 1 108 23 is_stmt 0 view .LVU370
+	movb	$1, 17(%rdi)
+	.loc 1 109 5 is_stmt 1 view .LVU371
+.LVL123:
+	.loc 1 109 5 is_stmt 0 view .LVU372
+.LBE225:
+.LBE227:
+	.loc 1 116 5 is_stmt 1 view .LVU373
+	.loc 1 116 5 is_stmt 0 view .LVU374
+.LBE229:
+.LBE232:
+	.loc 1 126 9 is_stmt 1 view .LVU375
+.L68:
+	.loc 1 129 9 view .LVU376
+	.loc 1 129 23 is_stmt 0 view .LVU377
+	movw	%r12w, 34(%r9,%rbx)
+	.loc 1 124 41 is_stmt 1 view .LVU378
+.LVL124:
+	.loc 1 124 27 view .LVU379
+	addq	$2, %rbx
+.LVL125:
+	.loc 1 124 27 is_stmt 0 view .LVU380
+	cmpq	%rbp, %rbx
+	jne	.L74
+.LVL126:
+.L35:
+	.loc 1 124 27 view .LVU381
+.LBE235:
+.LBE238:
+	.loc 1 140 1 view .LVU382
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.cfi_restore_state
+.LBB239:
+.LBB182:
+.LBB180:
+.LBB177:
+.LBB175:
+.LBB173:
+	.loc 1 96 13 is_stmt 1 view .LVU383
+	.loc 1 96 29 is_stmt 0 view .LVU384
+	movb	$1, 16(%rdi)
+	.loc 1 97 13 is_stmt 1 view .LVU385
+.LVL128:
+	.loc 1 97 13 is_stmt 0 view .LVU386
+.LBE173:
+.LBE175:
+	.loc 1 116 5 is_stmt 1 view .LVU387
+	.loc 1 116 5 is_stmt 0 view .LVU388
+.LBE177:
+.LBE180:
+	.loc 1 126 9 is_stmt 1 view .LVU389
+	jmp	.L44
+.LVL129:
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	.loc 1 126 9 is_stmt 0 view .LVU390
+.LBE182:
+.LBE239:
+.LBB240:
+.LBB160:
+.LBB154:
+.LBB148:
+.LBB143:
+.LBB138:
+	.loc 1 96 13 is_stmt 1 view .LVU391
+	.loc 1 96 29 is_stmt 0 view .LVU392
+	movb	$1, 16(%rdi)
+	.loc 1 97 13 is_stmt 1 view .LVU393
+.LVL130:
+	.loc 1 97 13 is_stmt 0 view .LVU394
+.LBE138:
+.LBE143:
+	.loc 1 116 5 is_stmt 1 view .LVU395
+	.loc 1 116 5 is_stmt 0 view .LVU396
+.LBE148:
+.LBE154:
+	.loc 1 126 9 is_stmt 1 view .LVU397
+	jmp	.L37
+.LVL131:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.loc 1 126 9 is_stmt 0 view .LVU398
+.LBE160:
+.LBE240:
+.LBB241:
+.LBB200:
+.LBB198:
+.LBB195:
+.LBB193:
+.LBB191:
+	.loc 1 96 13 is_stmt 1 view .LVU399
+	.loc 1 96 29 is_stmt 0 view .LVU400
+	movb	$1, 16(%rdi)
+	.loc 1 97 13 is_stmt 1 view .LVU401
+.LVL132:
+	.loc 1 97 13 is_stmt 0 view .LVU402
+.LBE191:
+.LBE193:
+	.loc 1 116 5 is_stmt 1 view .LVU403
+	.loc 1 116 5 is_stmt 0 view .LVU404
+.LBE195:
+.LBE198:
+	.loc 1 126 9 is_stmt 1 view .LVU405
+	jmp	.L51
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+.LBB199:
+.LBB196:
+	.loc 1 116 5 view .LVU406
+	.loc 1 116 45 is_stmt 0 view .LVU407
+	movl	%r12d, %edx
+	.loc 1 116 29 view .LVU408
+	shrl	%r12d
+	.loc 1 116 45 view .LVU409
+	andl	$1, %edx
+	.loc 1 116 37 view .LVU410
+	negl	%edx
+	.loc 1 116 35 view .LVU411
+	xorl	%r12d, %edx
+.LBE196:
+.LBE199:
+	.loc 1 125 15 view .LVU412
+	addl	%r13d, %edx
+.LVL134:
+	.loc 1 126 9 is_stmt 1 view .LVU413
+	.loc 1 126 30 is_stmt 0 view .LVU414
+	leal	32768(%rdx), %ecx
+	.loc 1 126 12 view .LVU415
+	cmpl	$65535, %ecx
+	jbe	.L55
+	.loc 1 127 13 is_stmt 1 view .LVU416
+	.loc 1 127 31 is_stmt 0 view .LVU417
+	movb	$1, 17(%rdi)
+.L55:
+	.loc 1 129 23 view .LVU418
+	movl	%edx, %r13d
+	jmp	.L51
+.LVL135:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 129 23 view .LVU419
+.LBE200:
+.LBE241:
+.LBB242:
+.LBB183:
+.LBB181:
+.LBB178:
+	.loc 1 116 5 is_stmt 1 view .LVU420
+	.loc 1 116 45 is_stmt 0 view .LVU421
+	movl	%r12d, %edx
+	.loc 1 116 29 view .LVU422
+	shrl	%r12d
+	.loc 1 116 45 view .LVU423
+	andl	$1, %edx
+	.loc 1 116 37 view .LVU424
+	negl	%edx
+	.loc 1 116 35 view .LVU425
+	xorl	%r12d, %edx
+.LBE178:
+.LBE181:
+	.loc 1 125 15 view .LVU426
+	addl	%r13d, %edx
+.LVL136:
+	.loc 1 126 9 is_stmt 1 view .LVU427
+	.loc 1 126 30 is_stmt 0 view .LVU428
+	leal	32768(%rdx), %ecx
+	.loc 1 126 12 view .LVU429
+	cmpl	$65535, %ecx
+	jbe	.L48
+	.loc 1 127 13 is_stmt 1 view .LVU430
+	.loc 1 127 31 is_stmt 0 view .LVU431
+	movb	$1, 17(%rdi)
+.L48:
+	.loc 1 129 23 view .LVU432
+	movl	%edx, %r13d
+	jmp	.L44
+.LVL137:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 129 23 view .LVU433
+.LBE183:
+.LBE242:
+.LBB243:
+.LBB161:
+.LBB155:
+.LBB149:
+	.loc 1 116 5 is_stmt 1 view .LVU434
+	.loc 1 116 45 is_stmt 0 view .LVU435
+	movl	%r12d, %edx
+	.loc 1 116 29 view .LVU436
+	shrl	%r12d
+	.loc 1 116 45 view .LVU437
+	andl	$1, %edx
+	.loc 1 116 37 view .LVU438
+	negl	%edx
+	.loc 1 116 35 view .LVU439
+	xorl	%r12d, %edx
+.LBE149:
+.LBE155:
+	.loc 1 125 15 view .LVU440
+	addl	%r13d, %edx
+.LVL138:
+	.loc 1 126 9 is_stmt 1 view .LVU441
+	.loc 1 126 30 is_stmt 0 view .LVU442
+	leal	32768(%rdx), %ecx
+	.loc 1 126 12 view .LVU443
+	cmpl	$65535, %ecx
+	jbe	.L41
+	.loc 1 127 13 is_stmt 1 view .LVU444
+	.loc 1 127 31 is_stmt 0 view .LVU445
+	movb	$1, 17(%rdi)
+.L41:
+	.loc 1 129 23 view .LVU446
+	movl	%edx, %r13d
+	jmp	.L37
+.LVL139:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 129 23 view .LVU447
+.LBE161:
+.LBE243:
+.LBB244:
+.LBB218:
+.LBB216:
+.LBB213:
+	.loc 1 116 5 is_stmt 1 view .LVU448
+	.loc 1 116 45 is_stmt 0 view .LVU449
+	movl	%ebp, %eax
+	.loc 1 116 29 view .LVU450
+	shrl	%ebp
+	.loc 1 116 45 view .LVU451
+	andl	$1, %eax
+	.loc 1 116 37 view .LVU452
+	negl	%eax
+	.loc 1 116 35 view .LVU453
+	xorl	%ebp, %eax
+.LBE213:
+.LBE216:
+	.loc 1 125 15 view .LVU454
+	addl	%r12d, %eax
+.LVL140:
+	.loc 1 126 9 is_stmt 1 view .LVU455
+	.loc 1 126 30 is_stmt 0 view .LVU456
+	leal	32768(%rax), %edx
+	.loc 1 126 12 view .LVU457
+	cmpl	$65535, %edx
+	jbe	.L63
+	.loc 1 127 13 is_stmt 1 view .LVU458
+	.loc 1 127 31 is_stmt 0 view .LVU459
+	movb	$1, 17(%rdi)
+.L63:
+	.loc 1 129 23 view .LVU460
+	movl	%eax, %r12d
+	jmp	.L62
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 1 129 23 view .LVU461
+.LBE218:
+.LBE244:
+.LBB245:
+.LBB236:
+.LBB233:
+.LBB230:
+.LBB228:
+.LBB226:
+	.loc 1 96 13 is_stmt 1 view .LVU462
+	.loc 1 96 29 is_stmt 0 view .LVU463
+	movb	$1, 16(%rdi)
+	.loc 1 97 13 is_stmt 1 view .LVU464
+.LVL142:
+	.loc 1 97 13 is_stmt 0 view .LVU465
+.LBE226:
+.LBE228:
+	.loc 1 116 5 is_stmt 1 view .LVU466
+	.loc 1 116 5 is_stmt 0 view .LVU467
+.LBE230:
+.LBE233:
+	.loc 1 126 9 is_stmt 1 view .LVU468
+	jmp	.L68
+.LVL143:
+	.p2align 4,,10
+	.p2align 3
+.L69:
+.LBB234:
+.LBB231:
+	.loc 1 116 5 view .LVU469
+	.loc 1 116 45 is_stmt 0 view .LVU470
+	movl	%r11d, %eax
+	.loc 1 116 29 view .LVU471
+	shrl	%r11d
+	.loc 1 116 45 view .LVU472
+	andl	$1, %eax
+	.loc 1 116 37 view .LVU473
+	negl	%eax
+	.loc 1 116 35 view .LVU474
+	xorl	%r11d, %eax
+.LBE231:
+.LBE234:
+	.loc 1 125 15 view .LVU475
+	addl	%r12d, %eax
+.LVL144:
+	.loc 1 126 9 is_stmt 1 view .LVU476
+	.loc 1 126 30 is_stmt 0 view .LVU477
+	leal	32768(%rax), %edx
+	.loc 1 126 12 view .LVU478
+	cmpl	$65535, %edx
+	jbe	.L73
+	.loc 1 127 13 is_stmt 1 view .LVU479
+	.loc 1 127 31 is_stmt 0 view .LVU480
+	movb	$1, 17(%rdi)
+.L73:
+	.loc 1 129 23 view .LVU481
+	movl	%eax, %r12d
+	jmp	.L68
+.LBE236:
+.LBE245:
+	.cfi_endproc
+.LFE7:
+	.size	readFields, .-readFields
+	.section	.text.blackboxEncoderInit,"ax",@progbits
+	.p2align 4
+	.globl	blackboxEncoderInit
+	.type	blackboxEncoderInit, @function
+blackboxEncoderInit:
+.LVL145:
+.LFB11:
+	.loc 1 167 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 168 5 view .LVU483
+	movq	$0, 1(%rdi)
+	.loc 1 167 1 is_stmt 0 view .LVU484
+	movq	%rdi, %rdx
+	.loc 1 168 5 view .LVU485
+	leaq	9(%rdi), %rdi
+.LVL146:
+	.loc 1 168 5 view .LVU486
+	movq	$0, 95(%rdi)
+	movl	%edx, %eax
+	andq	$-8, %rdi
+	subl	%edi, %eax
+	leal	112(%rax), %ecx
+	xorl	%eax, %eax
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 169 5 is_stmt 1 view .LVU487
+	.loc 1 169 55 is_stmt 0 view .LVU488
+	movl	$8, %eax
+	cmpb	%al, %sil
+	cmova	%eax, %esi
+.LVL147:
+	.loc 1 169 25 view .LVU489
+	movb	%sil, (%rdx)
+	.loc 1 170 1 view .LVU490
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	blackboxEncoderInit, .-blackboxEncoderInit
+	.section	.text.blackboxEncodeFrame,"ax",@progbits
+	.p2align 4
+	.globl	blackboxEncodeFrame
+	.type	blackboxEncodeFrame, @function
+blackboxEncodeFrame:
+.LVL148:
+.LFB12:
+	.loc 1 176 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 176 1 is_stmt 0 view .LVU492
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 180 8 view .LVU493
+	cmpb	$0, 1(%rdi)
+	.loc 1 176 1 view .LVU494
+	movq	%rdi, %r10
+	.loc 1 177 5 is_stmt 1 view .LVU495
+.LVL149:
+	.loc 1 178 5 view .LVU496
+	.loc 1 180 5 view .LVU497
+	.loc 1 176 1 is_stmt 0 view .LVU498
+	movq	%rdx, %r11
+	.loc 1 188 18 view .LVU499
+	leaq	1(%rdx), %rax
+	.loc 1 180 8 view .LVU500
+	je	.L95
+	.loc 1 180 37 discriminator 1 view .LVU501
+	testb	$31, 4(%rdi)
+	jne	.L96
+.L95:
+	.loc 1 181 9 is_stmt 1 view .LVU502
+.LVL150:
+	.loc 1 181 21 is_stmt 0 view .LVU503
+	movb	$73, (%r11)
+	.loc 1 182 9 is_stmt 1 view .LVU504
+	.loc 1 182 51 is_stmt 0 view .LVU505
+	movl	(%rsi), %edx
+.LVL151:
+.LBB260:
+.LBI260:
+	.loc 1 49 17 is_stmt 1 view .LVU506
+.LBB261:
+	.loc 1 51 5 view .LVU507
+	.loc 1 51 18 view .LVU508
+	cmpl	$127, %edx
+	jbe	.L97
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.loc 1 52 9 view .LVU509
+	.loc 1 52 21 is_stmt 0 view .LVU510
+	movl	%edx, %ecx
+	.loc 1 52 16 view .LVU511
+	addq	$1, %rax
+.LVL153:
+	.loc 1 53 15 view .LVU512
+	shrl	$7, %edx
+.LVL154:
+	.loc 1 52 21 view .LVU513
+	orl	$-128, %ecx
+	movb	%cl, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU514
+.LVL155:
+	.loc 1 51 18 view .LVU515
+	cmpl	$127, %edx
+	ja	.L98
+.LVL156:
+.L97:
+	.loc 1 55 5 view .LVU516
+	.loc 1 55 15 is_stmt 0 view .LVU517
+	movb	%dl, (%rax)
+	.loc 1 55 12 view .LVU518
+	leaq	1(%rax), %rdi
+.LVL157:
+	.loc 1 57 5 is_stmt 1 view .LVU519
+	.loc 1 57 5 is_stmt 0 view .LVU520
+.LBE261:
+.LBE260:
+	.loc 1 183 9 is_stmt 1 view .LVU521
+	.loc 1 183 51 is_stmt 0 view .LVU522
+	movl	4(%rsi), %eax
+.LVL158:
+.LBB262:
+.LBI262:
+	.loc 1 49 17 is_stmt 1 view .LVU523
+.LBB263:
+	.loc 1 51 18 view .LVU524
+	cmpl	$127, %eax
+	jbe	.L99
+.LVL159:
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	.loc 1 52 9 view .LVU525
+	.loc 1 52 21 is_stmt 0 view .LVU526
+	movl	%eax, %edx
+	.loc 1 52 16 view .LVU527
+	addq	$1, %rdi
+.LVL160:
+	.loc 1 53 15 view .LVU528
+	shrl	$7, %eax
+.LVL161:
+	.loc 1 52 21 view .LVU529
+	orl	$-128, %edx
+	movb	%dl, -1(%rdi)
+	.loc 1 53 9 is_stmt 1 view .LVU530
+.LVL162:
+	.loc 1 51 18 view .LVU531
+	cmpl	$127, %eax
+	ja	.L100
+.L99:
+	.loc 1 55 5 view .LVU532
+.LVL163:
+	.loc 1 55 15 is_stmt 0 view .LVU533
+	movb	%al, (%rdi)
+	.loc 1 57 5 is_stmt 1 view .LVU534
+.LVL164:
+	.loc 1 57 5 is_stmt 0 view .LVU535
+.LBE263:
+.LBE262:
+	.loc 1 184 9 is_stmt 1 view .LVU536
+	.loc 1 184 20 is_stmt 0 view .LVU537
+	movzbl	(%r10), %ecx
+	leaq	zeroFrame(%rip), %rdx
+.LBB265:
+.LBB264:
+	.loc 1 55 12 view .LVU538
+	addq	$1, %rdi
+.LVL165:
+	.loc 1 55 12 view .LVU539
+.LBE264:
+.LBE265:
+	.loc 1 184 20 view .LVU540
+	call	writeFields
+.LVL166:
+	.loc 1 186 9 is_stmt 1 view .LVU541
+	.loc 1 194 5 view .LVU542
+.LBB266:
+.LBI266:
+	.loc 1 151 13 view .LVU543
+.LBB267:
+	.loc 1 153 5 view .LVU544
+	.loc 1 153 16 is_stmt 0 view .LVU545
+	movl	56(%r10), %edx
+	movdqu	8(%r10), %xmm0
+	movdqu	24(%r10), %xmm1
+	movdqu	40(%r10), %xmm2
+	movl	%edx, 108(%r10)
+	.loc 1 154 5 is_stmt 1 view .LVU546
+	.loc 1 153 16 is_stmt 0 view .LVU547
+	movups	%xmm0, 60(%r10)
+	movups	%xmm1, 76(%r10)
+	movups	%xmm2, 92(%r10)
+	.loc 1 154 16 view .LVU548
+	movdqu	(%rsi), %xmm3
+	movups	%xmm3, 8(%r10)
+	movdqu	16(%rsi), %xmm4
+	movups	%xmm4, 24(%r10)
+	movdqu	32(%rsi), %xmm5
+	movups	%xmm5, 40(%r10)
+	movl	48(%rsi), %edx
+	movl	%edx, 56(%r10)
+	.loc 1 156 5 is_stmt 1 view .LVU549
+	.loc 1 154 16 is_stmt 0 view .LVU550
+	xorl	%edx, %edx
+.LVL167:
+.L101:
+	.loc 1 157 9 is_stmt 1 view .LVU551
+	.loc 1 157 25 is_stmt 0 view .LVU552
+	addl	$1, %edx
+.LBE267:
+.LBE266:
+	.loc 1 195 24 view .LVU553
+	addl	$1, 4(%r10)
+	.loc 1 197 21 view .LVU554
+	subl	%r11d, %eax
+.LVL168:
+.LBB271:
+.LBB268:
+	.loc 1 157 25 view .LVU555
+	movb	%dl, 1(%r10)
+.LVL169:
+	.loc 1 157 25 view .LVU556
+.LBE268:
+.LBE271:
+	.loc 1 195 5 is_stmt 1 view .LVU557
+	.loc 1 197 5 view .LVU558
+	.loc 1 198 1 is_stmt 0 view .LVU559
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL170:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.cfi_restore_state
+	.loc 1 188 9 is_stmt 1 view .LVU560
+	.loc 1 188 21 is_stmt 0 view .LVU561
+	movb	$80, (%rdx)
+	.loc 1 189 9 is_stmt 1 view .LVU562
+	.loc 1 189 20 is_stmt 0 view .LVU563
+	movl	(%rsi), %edx
+.LVL171:
+	.loc 1 189 20 view .LVU564
+	subl	8(%rdi), %edx
+.LVL172:
+.LBB272:
+.LBI272:
+	.loc 1 49 17 is_stmt 1 view .LVU565
+.LBB273:
+	.loc 1 51 5 view .LVU566
+	.loc 1 51 18 view .LVU567
+	cmpl	$127, %edx
+	jbe	.L102
+.LVL173:
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 52 9 view .LVU568
+	.loc 1 52 21 is_stmt 0 view .LVU569
+	movl	%edx, %ecx
+	.loc 1 52 16 view .LVU570
+	addq	$1, %rax
+.LVL174:
+	.loc 1 53 15 view .LVU571
+	shrl	$7, %edx
+.LVL175:
+	.loc 1 52 21 view .LVU572
+	orl	$-128, %ecx
+	movb	%cl, -1(%rax)
+	.loc 1 53 9 is_stmt 1 view .LVU573
+.LVL176:
+	.loc 1 51 18 view .LVU574
+	cmpl	$127, %edx
+	ja	.L103
+.LVL177:
+.L102:
+	.loc 1 55 5 view .LVU575
+	.loc 1 55 15 is_stmt 0 view .LVU576
+	movb	%dl, (%rax)
+.LBE273:
+.LBE272:
+.LBB275:
+.LBB276:
+	.loc 1 144 8 view .LVU577
+	cmpb	$1, 1(%r10)
+.LBE276:
+.LBE275:
+.LBB278:
+.LBB274:
+	.loc 1 55 12 view .LVU578
+	leaq	1(%rax), %rdi
+.LVL178:
+	.loc 1 57 5 is_stmt 1 view .LVU579
+	.loc 1 57 5 is_stmt 0 view .LVU580
+.LBE274:
+.LBE278:
+	.loc 1 190 9 is_stmt 1 view .LVU581
+	.loc 1 190 49 is_stmt 0 view .LVU582
+	movl	4(%rsi), %edx
+.LVL179:
+.LBB279:
+.LBI275:
+	.loc 1 142 17 is_stmt 1 view .LVU583
+.LBB277:
+	.loc 1 144 5 view .LVU584
+	.loc 1 145 26 is_stmt 0 view .LVU585
+	movl	12(%r10), %eax
+	.loc 1 144 8 view .LVU586
+	jbe	.L105
+	.loc 1 148 5 is_stmt 1 view .LVU587
+	.loc 1 148 28 is_stmt 0 view .LVU588
+	addl	%eax, %eax
+	subl	64(%r10), %eax
+.L105:
+.LVL180:
+	.loc 1 148 28 view .LVU589
+.LBE277:
+.LBE279:
+	.loc 1 190 56 view .LVU590
+	subl	%eax, %edx
+.LVL181:
+.LBB280:
+.LBI280:
+	.loc 1 60 17 is_stmt 1 view .LVU591
+.LBB281:
+	.loc 1 63 5 view .LVU592
+	.loc 1 63 53 is_stmt 0 view .LVU593
+	leal	(%rdx,%rdx), %eax
+	.loc 1 63 78 view .LVU594
+	sarl	$31, %edx
+.LVL182:
+	.loc 1 63 12 view .LVU595
+	xorl	%edx, %eax
+.LVL183:
+.LBB282:
+.LBI282:
+	.loc 1 49 17 is_stmt 1 view .LVU596
+.LBB283:
+	.loc 1 51 5 view .LVU597
+	.loc 1 51 18 view .LVU598
+	cmpl	$127, %eax
+	jbe	.L106
+.LVL184:
+	.p2align 4,,10
+	.p2align 3
+.L107:
+	.loc 1 52 9 view .LVU599
+	.loc 1 52 21 is_stmt 0 view .LVU600
+	movl	%eax, %edx
+	.loc 1 52 16 view .LVU601
+	addq	$1, %rdi
+.LVL185:
+	.loc 1 53 15 view .LVU602
+	shrl	$7, %eax
+.LVL186:
+	.loc 1 52 21 view .LVU603
+	orl	$-128, %edx
+	movb	%dl, -1(%rdi)
+	.loc 1 53 9 is_stmt 1 view .LVU604
+.LVL187:
+	.loc 1 51 18 view .LVU605
+	cmpl	$127, %eax
+	ja	.L107
+.L106:
+	.loc 1 55 5 view .LVU606
+.LVL188:
+	.loc 1 55 15 is_stmt 0 view .LVU607
+	movb	%al, (%rdi)
+	.loc 1 57 5 is_stmt 1 view .LVU608
+.LVL189:
+	.loc 1 57 5 is_stmt 0 view .LVU609
+.LBE283:
+.LBE282:
+.LBE281:
+.LBE280:
+	.loc 1 191 9 is_stmt 1 view .LVU610
+	.loc 1 191 20 is_stmt 0 view .LVU611
+	movzbl	(%r10), %ecx
+	.loc 1 177 28 view .LVU612
+	leaq	8(%r10), %rdx
+.LBB287:
+.LBB286:
+.LBB285:
+.LBB284:
+	.loc 1 55 12 view .LVU613
+	addq	$1, %rdi
+.LVL190:
+	.loc 1 55 12 view .LVU614
+.LBE284:
+.LBE285:
+.LBE286:
+.LBE287:
+	.loc 1 191 20 view .LVU615
+	call	writeFields
+.LVL191:
+.LBB288:
+.LBB269:
+	.loc 1 153 16 view .LVU616
+	movdqu	8(%r10), %xmm6
+	movdqu	24(%r10), %xmm7
+	movl	56(%r10), %ecx
+	.loc 1 156 9 view .LVU617
+	movzbl	1(%r10), %edx
+	.loc 1 156 9 view .LVU618
+.LBE269:
+.LBE288:
+	.loc 1 194 5 is_stmt 1 view .LVU619
+.LVL192:
+.LBB289:
+	.loc 1 151 13 view .LVU620
+.LBB270:
+	.loc 1 153 5 view .LVU621
+	.loc 1 153 16 is_stmt 0 view .LVU622
+	movups	%xmm6, 60(%r10)
+	movdqu	40(%r10), %xmm6
+	movl	%ecx, 108(%r10)
+	.loc 1 154 5 is_stmt 1 view .LVU623
+	.loc 1 153 16 is_stmt 0 view .LVU624
+	movups	%xmm7, 76(%r10)
+	movups	%xmm6, 92(%r10)
+	.loc 1 154 16 view .LVU625
+	movdqu	(%rsi), %xmm7
+	movups	%xmm7, 8(%r10)
+	movdqu	16(%rsi), %xmm0
+	movups	%xmm0, 24(%r10)
+	movdqu	32(%rsi), %xmm1
+	movups	%xmm1, 40(%r10)
+	movl	48(%rsi), %ecx
+	movl	%ecx, 56(%r10)
+	.loc 1 156 5 is_stmt 1 view .LVU626
+	.loc 1 156 8 is_stmt 0 view .LVU627
+	cmpb	$1, %dl
+	jbe	.L101
+.LVL193:
+	.loc 1 156 8 view .LVU628
+.LBE270:
+.LBE289:
+	.loc 1 195 5 is_stmt 1 view .LVU629
+	.loc 1 195 24 is_stmt 0 view .LVU630
+	addl	$1, 4(%r10)
+	.loc 1 197 5 is_stmt 1 view .LVU631
+	.loc 1 197 21 is_stmt 0 view .LVU632
+	subl	%r11d, %eax
+.LVL194:
+	.loc 1 198 1 view .LVU633
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	blackboxEncodeFrame, .-blackboxEncodeFrame
+	.section	.text.blackboxDecoderInit,"ax",@progbits
+	.p2align 4
+	.globl	blackboxDecoderInit
+	.type	blackboxDecoderInit, @function
+blackboxDecoderInit:
+.LVL195:
+.LFB13:
+	.loc 1 201 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 5 view .LVU635
+	movq	$0, 1(%rdi)
+	.loc 1 201 1 is_stmt 0 view .LVU636
+	movq	%rdi, %rdx
+	.loc 1 202 5 view .LVU637
+	leaq	9(%rdi), %rdi
+.LVL196:
+	.loc 1 202 5 view .LVU638
+	movq	$0, 91(%rdi)
+	movl	%edx, %eax
+	andq	$-8, %rdi
+	subl	%edi, %eax
+	leal	108(%rax), %ecx
+	xorl	%eax, %eax
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 203 5 is_stmt 1 view .LVU639
+	.loc 1 203 55 is_stmt 0 view .LVU640
+	movl	$8, %eax
+	cmpb	%al, %sil
+	cmova	%eax, %esi
+.LVL197:
+	.loc 1 203 25 view .LVU641
+	movb	%sil, (%rdx)
+	.loc 1 204 1 view .LVU642
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	blackboxDecoderInit, .-blackboxDecoderInit
+	.section	.text.blackboxDecodeFrame,"ax",@progbits
+	.p2align 4
+	.globl	blackboxDecodeFrame
+	.type	blackboxDecodeFrame, @function
+blackboxDecodeFrame:
+.LVL198:
+.LFB14:
+	.loc 1 212 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 213 5 view .LVU644
+	.loc 1 214 5 view .LVU645
+	.loc 1 215 5 view .LVU646
+	.loc 1 216 5 view .LVU647
+	.loc 1 218 5 view .LVU648
+	.loc 1 218 15 is_stmt 0 view .LVU649
+	movl	$0, (%r8)
+	.loc 1 220 5 is_stmt 1 view .LVU650
+	.loc 1 220 8 is_stmt 0 view .LVU651
+	testl	%edx, %edx
+	je	.L169
+	.loc 1 212 1 view .LVU652
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 229 5 view .LVU653
+	pxor	%xmm0, %xmm0
+	.loc 1 212 1 view .LVU654
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%r8, %r14
+	.loc 1 224 5 is_stmt 1 view .LVU655
+	.loc 1 212 1 is_stmt 0 view .LVU656
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edx, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 229 5 view .LVU657
+	movl	$0, 48(%rcx)
+	movups	%xmm0, (%rcx)
+	movups	%xmm0, 16(%rcx)
+	movups	%xmm0, 32(%rcx)
+	.loc 1 230 12 view .LVU658
+	movzbl	(%rsi), %r15d
+	.loc 1 224 5 view .LVU659
+	movq	$0, 16(%rsp)
+	.loc 1 225 5 is_stmt 1 view .LVU660
+	.loc 1 225 17 is_stmt 0 view .LVU661
+	movq	%rsi, (%rsp)
+	.loc 1 226 5 is_stmt 1 view .LVU662
+	.loc 1 226 19 is_stmt 0 view .LVU663
+	movl	%edx, 8(%rsp)
+	.loc 1 227 5 is_stmt 1 view .LVU664
+	.loc 1 227 21 is_stmt 0 view .LVU665
+	movl	$1, 12(%rsp)
+	.loc 1 229 5 is_stmt 1 view .LVU666
+	.loc 1 230 5 view .LVU667
+.LVL199:
+	.loc 1 232 5 view .LVU668
+	cmpb	$73, %r15b
+	je	.L150
+	cmpb	$80, %r15b
+	jne	.L121
+	xorl	%ecx, %ecx
+.LVL200:
+	.loc 1 232 5 is_stmt 0 view .LVU669
+	movl	$1, %eax
+	xorl	%esi, %esi
+.LVL201:
+	.loc 1 232 5 view .LVU670
+	xorl	%edi, %edi
+.LVL202:
+.L120:
+	.loc 1 232 5 view .LVU671
+	movl	%eax, %edx
+.LVL203:
+.LBB306:
+.LBB307:
+	.loc 1 95 9 is_stmt 1 view .LVU672
+	.loc 1 95 12 is_stmt 0 view .LVU673
+	cmpl	%ebp, %eax
+	jnb	.L170
+	.loc 1 100 9 is_stmt 1 view .LVU674
+	.loc 1 100 14 is_stmt 0 view .LVU675
+	movzbl	0(%r13,%rax), %r8d
+.LVL204:
+	.loc 1 101 9 is_stmt 1 view .LVU676
+	.loc 1 100 45 is_stmt 0 view .LVU677
+	leal	1(%rax), %edx
+	.loc 1 101 18 view .LVU678
+	movl	%r8d, %esi
+	andl	$127, %esi
+	.loc 1 101 42 view .LVU679
+	sall	%cl, %esi
+	.loc 1 101 15 view .LVU680
+	orl	%esi, %edi
+.LVL205:
+	.loc 1 103 9 is_stmt 1 view .LVU681
+	.loc 1 103 12 is_stmt 0 view .LVU682
+	testb	%r8b, %r8b
+	jns	.L136
+	.loc 1 94 49 is_stmt 1 view .LVU683
+.LVL206:
+	.loc 1 94 35 view .LVU684
+	addq	$1, %rax
+.LVL207:
+	.loc 1 94 35 is_stmt 0 view .LVU685
+	addl	$7, %ecx
+	movl	$1, %esi
+	cmpq	$6, %rax
+	jne	.L120
+	movl	%edx, 12(%rsp)
+.LVL208:
+.L135:
+	.loc 1 94 35 view .LVU686
+.LBE307:
+.LBE306:
+	.loc 1 242 17 is_stmt 1 view .LVU687
+	.loc 1 242 34 is_stmt 0 view .LVU688
+	movb	$1, 17(%rsp)
+	xorl	%edi, %edi
+.L137:
+	.loc 1 244 13 is_stmt 1 view .LVU689
+	.loc 1 244 60 is_stmt 0 view .LVU690
+	addl	4(%rbx), %edi
+.LBB310:
+.LBB311:
+	.loc 1 145 26 view .LVU691
+	movl	8(%rbx), %r9d
+.LBE311:
+.LBE310:
+	.loc 1 244 34 view .LVU692
+	movl	%edi, (%r12)
+	.loc 1 245 13 is_stmt 1 view .LVU693
+.LVL209:
+.LBB313:
+.LBI310:
+	.loc 1 142 17 view .LVU694
+.LBB312:
+	.loc 1 144 5 view .LVU695
+	.loc 1 144 8 is_stmt 0 view .LVU696
+	cmpb	$1, 1(%rbx)
+	jbe	.L138
+	.loc 1 148 5 is_stmt 1 view .LVU697
+	.loc 1 148 28 is_stmt 0 view .LVU698
+	addl	%r9d, %r9d
+	subl	60(%rbx), %r9d
+.L138:
+.LVL210:
+	.loc 1 148 28 view .LVU699
+.LBE312:
+.LBE313:
+.LBB314:
+.LBI314:
+	.loc 1 112 16 is_stmt 1 view .LVU700
+.LBB315:
+	.loc 1 114 5 view .LVU701
+.LBB316:
+.LBI316:
+	.loc 1 88 17 view .LVU702
+.LBB317:
+	.loc 1 94 35 view .LVU703
+	movl	%edx, %esi
+.LBE317:
+.LBE316:
+.LBE315:
+.LBE314:
+	.loc 1 242 34 is_stmt 0 view .LVU704
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+.LBB325:
+.LBB322:
+.LBB320:
+.LBB318:
+	.loc 1 90 14 view .LVU705
+	xorl	%r8d, %r8d
+	addq	%r13, %rsi
+.LVL211:
+.L144:
+	.loc 1 95 9 is_stmt 1 view .LVU706
+	.loc 1 95 12 is_stmt 0 view .LVU707
+	cmpl	%ebp, %edx
+	jnb	.L171
+	.loc 1 100 9 is_stmt 1 view .LVU708
+	.loc 1 100 14 is_stmt 0 view .LVU709
+	movzbl	(%rsi), %edi
+.LVL212:
+	.loc 1 101 9 is_stmt 1 view .LVU710
+	.loc 1 100 45 is_stmt 0 view .LVU711
+	addl	$1, %edx
+	.loc 1 101 18 view .LVU712
+	movl	%edi, %eax
+	andl	$127, %eax
+	.loc 1 101 42 view .LVU713
+	sall	%cl, %eax
+	.loc 1 101 15 view .LVU714
+	orl	%eax, %r8d
+.LVL213:
+	.loc 1 103 9 is_stmt 1 view .LVU715
+	.loc 1 103 12 is_stmt 0 view .LVU716
+	testb	%dil, %dil
+	jns	.L172
+	.loc 1 94 49 is_stmt 1 view .LVU717
+	.loc 1 94 35 view .LVU718
+	addl	$7, %ecx
+	addq	$1, %rsi
+	movl	$1, %eax
+	cmpl	$35, %ecx
+	jne	.L144
+	movl	%edx, 12(%rsp)
+	.loc 1 108 5 view .LVU719
+	.loc 1 108 23 is_stmt 0 view .LVU720
+	movb	$1, 17(%rsp)
+	.loc 1 109 5 is_stmt 1 view .LVU721
+.LVL214:
+.L143:
+	.loc 1 109 5 is_stmt 0 view .LVU722
+.LBE318:
+.LBE320:
+	.loc 1 116 5 is_stmt 1 view .LVU723
+	.loc 1 116 5 is_stmt 0 view .LVU724
+.LBE322:
+.LBE325:
+	.loc 1 245 25 view .LVU725
+	movl	%r9d, 4(%r12)
+	.loc 1 246 13 is_stmt 1 view .LVU726
+	movzbl	(%rbx), %ecx
+	.loc 1 214 28 is_stmt 0 view .LVU727
+	leaq	4(%rbx), %rdx
+	.loc 1 246 13 view .LVU728
+	movq	%rsp, %rdi
+	movq	%r12, %rsi
+	call	readFields
+.LVL215:
+	.loc 1 247 13 is_stmt 1 view .LVU729
+	jmp	.L132
+.LVL216:
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.loc 1 232 5 is_stmt 0 view .LVU730
+	xorl	%ecx, %ecx
+.LVL217:
+	.loc 1 232 5 view .LVU731
+	movl	$1, %eax
+	xorl	%esi, %esi
+.LVL218:
+	.loc 1 232 5 view .LVU732
+	xorl	%r8d, %r8d
+.LVL219:
+.L119:
+	.loc 1 232 5 view .LVU733
+	movl	%eax, %edx
+.LVL220:
+.LBB326:
+.LBB327:
+	.loc 1 95 9 is_stmt 1 view .LVU734
+	.loc 1 95 12 is_stmt 0 view .LVU735
+	cmpl	%ebp, %eax
+	jnb	.L173
+	.loc 1 100 9 is_stmt 1 view .LVU736
+	.loc 1 100 14 is_stmt 0 view .LVU737
+	movzbl	0(%r13,%rax), %edi
+.LVL221:
+	.loc 1 101 9 is_stmt 1 view .LVU738
+	.loc 1 100 45 is_stmt 0 view .LVU739
+	leal	1(%rax), %edx
+	.loc 1 101 18 view .LVU740
+	movl	%edi, %esi
+	andl	$127, %esi
+	.loc 1 101 42 view .LVU741
+	sall	%cl, %esi
+	.loc 1 101 15 view .LVU742
+	orl	%esi, %r8d
+.LVL222:
+	.loc 1 103 9 is_stmt 1 view .LVU743
+	.loc 1 103 12 is_stmt 0 view .LVU744
+	testb	%dil, %dil
+	jns	.L174
+	.loc 1 94 49 is_stmt 1 view .LVU745
+.LVL223:
+	.loc 1 94 35 view .LVU746
+	addq	$1, %rax
+.LVL224:
+	.loc 1 94 35 is_stmt 0 view .LVU747
+	addl	$7, %ecx
+	movl	$1, %esi
+	cmpq	$6, %rax
+	jne	.L119
+	movl	%edx, 12(%rsp)
+	.loc 1 108 5 is_stmt 1 view .LVU748
+	.loc 1 97 20 is_stmt 0 view .LVU749
+	xorl	%r8d, %r8d
+.LVL225:
+	.loc 1 108 23 view .LVU750
+	movb	$1, 17(%rsp)
+	.loc 1 109 5 is_stmt 1 view .LVU751
+.LVL226:
+.L124:
+	.loc 1 109 5 is_stmt 0 view .LVU752
+	movl	%edx, %esi
+.LBE327:
+.LBE326:
+	.loc 1 234 34 view .LVU753
+	movl	%r8d, (%r12)
+	.loc 1 235 13 is_stmt 1 view .LVU754
+.LVL227:
+.LBB330:
+.LBI330:
+	.loc 1 88 17 view .LVU755
+.LBB331:
+	.loc 1 94 35 view .LVU756
+.LBE331:
+.LBE330:
+	.loc 1 234 34 is_stmt 0 view .LVU757
+	xorl	%ecx, %ecx
+	xorl	%eax, %eax
+	addq	%r13, %rsi
+.LBB334:
+.LBB332:
+	.loc 1 90 14 view .LVU758
+	xorl	%r8d, %r8d
+.LVL228:
+.L131:
+	.loc 1 95 9 is_stmt 1 view .LVU759
+	.loc 1 95 12 is_stmt 0 view .LVU760
+	cmpl	%ebp, %edx
+	jnb	.L175
+	.loc 1 100 9 is_stmt 1 view .LVU761
+	.loc 1 100 14 is_stmt 0 view .LVU762
+	movzbl	(%rsi), %edi
+.LVL229:
+	.loc 1 101 9 is_stmt 1 view .LVU763
+	.loc 1 100 45 is_stmt 0 view .LVU764
+	addl	$1, %edx
+	.loc 1 101 18 view .LVU765
+	movl	%edi, %eax
+	andl	$127, %eax
+	.loc 1 101 42 view .LVU766
+	sall	%cl, %eax
+	.loc 1 101 15 view .LVU767
+	orl	%eax, %r8d
+.LVL230:
+	.loc 1 103 9 is_stmt 1 view .LVU768
+	.loc 1 103 12 is_stmt 0 view .LVU769
+	testb	%dil, %dil
+	jns	.L176
+	.loc 1 94 49 is_stmt 1 view .LVU770
+	.loc 1 94 35 view .LVU771
+	addl	$7, %ecx
+	addq	$1, %rsi
+	movl	$1, %eax
+	cmpl	$35, %ecx
+	jne	.L131
+	movl	%edx, 12(%rsp)
+	.loc 1 108 5 view .LVU772
+	.loc 1 108 23 is_stmt 0 view .LVU773
+	movb	$1, 17(%rsp)
+	.loc 1 109 5 is_stmt 1 view .LVU774
+.LVL231:
+.L128:
+	.loc 1 97 20 is_stmt 0 view .LVU775
+	xorl	%r8d, %r8d
+.LVL232:
+.L130:
+	.loc 1 97 20 view .LVU776
+.LBE332:
+.LBE334:
+	.loc 1 235 25 view .LVU777
+	movl	%r8d, 4(%r12)
+	.loc 1 236 13 is_stmt 1 view .LVU778
+	movzbl	(%rbx), %ecx
+	movq	%rsp, %rdi
+	leaq	zeroFrame(%rip), %rdx
+	movq	%r12, %rsi
+	call	readFields
+.LVL233:
+	.loc 1 237 13 view .LVU779
+.L132:
+	.loc 1 254 5 view .LVU780
+	.loc 1 254 8 is_stmt 0 view .LVU781
+	cmpb	$0, 17(%rsp)
+	jne	.L121
+	.loc 1 254 26 discriminator 1 view .LVU782
+	cmpb	$0, 16(%rsp)
+	.loc 1 221 16 discriminator 1 view .LVU783
+	movl	$2, %eax
+	.loc 1 254 26 discriminator 1 view .LVU784
+	jne	.L116
+	.loc 1 254 55 discriminator 2 view .LVU785
+	movl	12(%rsp), %eax
+	.loc 1 254 46 discriminator 2 view .LVU786
+	cmpl	%ebp, %eax
+	jnb	.L146
+	.loc 1 254 98 discriminator 3 view .LVU787
+	movl	%eax, %edx
+	.loc 1 254 91 discriminator 3 view .LVU788
+	movzbl	0(%r13,%rdx), %edx
+.LVL234:
+.LBB335:
+.LBI335:
+	.loc 1 161 12 is_stmt 1 discriminator 3 view .LVU789
+.LBB336:
+	.loc 1 163 5 discriminator 3 view .LVU790
+	.loc 1 163 39 is_stmt 0 discriminator 3 view .LVU791
+	leal	-72(%rdx), %ecx
+	cmpb	$1, %cl
+	jbe	.L146
+	cmpb	$80, %dl
+	jne	.L121
+.LVL235:
+.L146:
+	.loc 1 163 39 discriminator 3 view .LVU792
+.LBE336:
+.LBE335:
+	.loc 1 264 5 is_stmt 1 view .LVU793
+	.loc 1 264 15 is_stmt 0 view .LVU794
+	movl	%eax, (%r14)
+	.loc 1 266 5 is_stmt 1 view .LVU795
+	.loc 1 266 8 is_stmt 0 view .LVU796
+	cmpb	$73, %r15b
+	je	.L177
+	.loc 1 268 12 is_stmt 1 view .LVU797
+	.loc 1 268 23 is_stmt 0 view .LVU798
+	movzbl	1(%rbx), %edx
+	.loc 1 269 16 view .LVU799
+	movl	$1, %eax
+	.loc 1 268 15 view .LVU800
+	testb	%dl, %dl
+	je	.L116
+	.loc 1 272 5 is_stmt 1 view .LVU801
+.LVL236:
+.LBB337:
+.LBI337:
+	.loc 1 151 13 view .LVU802
+.LBB338:
+	.loc 1 153 5 view .LVU803
+	.loc 1 153 16 is_stmt 0 view .LVU804
+	movl	52(%rbx), %eax
+	movdqu	4(%rbx), %xmm1
+	movdqu	20(%rbx), %xmm2
+	movdqu	36(%rbx), %xmm3
+	movl	%eax, 104(%rbx)
+	.loc 1 154 5 is_stmt 1 view .LVU805
+	.loc 1 153 16 is_stmt 0 view .LVU806
+	movups	%xmm1, 56(%rbx)
+	movups	%xmm2, 72(%rbx)
+	movups	%xmm3, 88(%rbx)
+	.loc 1 154 16 view .LVU807
+	movdqu	(%r12), %xmm4
+	movups	%xmm4, 4(%rbx)
+	movdqu	16(%r12), %xmm5
+	movups	%xmm5, 20(%rbx)
+	movdqu	32(%r12), %xmm6
+	movups	%xmm6, 36(%rbx)
+	movl	48(%r12), %eax
+	movl	%eax, 52(%rbx)
+	.loc 1 156 5 is_stmt 1 view .LVU808
+	.loc 1 156 8 is_stmt 0 view .LVU809
+	cmpb	$1, %dl
+	je	.L148
+.LBE338:
+.LBE337:
+	.loc 1 274 12 view .LVU810
+	xorl	%eax, %eax
+.LVL237:
+.L178:
+	.loc 1 275 1 view .LVU811
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL238:
+	.loc 1 275 1 view .LVU812
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL239:
+	.loc 1 275 1 view .LVU813
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL240:
+	.loc 1 275 1 view .LVU814
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL241:
+	.loc 1 275 1 view .LVU815
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL242:
+	.loc 1 275 1 view .LVU816
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL243:
+	.loc 1 275 1 view .LVU817
+	ret
+.LVL244:
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 221 16 view .LVU818
+	movl	$2, %eax
+	.loc 1 275 1 view .LVU819
+	ret
+.LVL245:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.cfi_def_cfa_offset 96
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	.loc 1 255 9 is_stmt 1 view .LVU820
+	.loc 1 255 32 is_stmt 0 view .LVU821
+	movb	$0, 1(%rbx)
+	.loc 1 256 9 is_stmt 1 view .LVU822
+	.loc 1 257 16 is_stmt 0 view .LVU823
+	movl	$3, %eax
+	.loc 1 256 19 view .LVU824
+	movl	$1, (%r14)
+	.loc 1 257 9 is_stmt 1 view .LVU825
+.L116:
+	.loc 1 275 1 is_stmt 0 view .LVU826
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL246:
+	.loc 1 275 1 view .LVU827
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL247:
+	.loc 1 275 1 view .LVU828
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL248:
+	.loc 1 275 1 view .LVU829
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL249:
+	.loc 1 275 1 view .LVU830
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL250:
+	.loc 1 275 1 view .LVU831
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL251:
+	.loc 1 275 1 view .LVU832
+	ret
+.LVL252:
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	.cfi_restore_state
+	.loc 1 267 9 is_stmt 1 view .LVU833
+	.loc 1 272 5 view .LVU834
+.LBB341:
+	.loc 1 151 13 view .LVU835
+.LBB339:
+	.loc 1 153 5 view .LVU836
+	.loc 1 153 16 is_stmt 0 view .LVU837
+	movdqu	4(%rbx), %xmm7
+	movl	52(%rbx), %eax
+	.loc 1 154 16 view .LVU838
+	xorl	%edx, %edx
+	.loc 1 153 16 view .LVU839
+	movdqu	36(%rbx), %xmm1
+	movups	%xmm7, 56(%rbx)
+	movdqu	20(%rbx), %xmm7
+	movl	%eax, 104(%rbx)
+	.loc 1 154 5 is_stmt 1 view .LVU840
+	.loc 1 153 16 is_stmt 0 view .LVU841
+	movups	%xmm7, 72(%rbx)
+	movups	%xmm1, 88(%rbx)
+	.loc 1 154 16 view .LVU842
+	movdqu	(%r12), %xmm2
+	movups	%xmm2, 4(%rbx)
+	movdqu	16(%r12), %xmm3
+	movups	%xmm3, 20(%rbx)
+	movdqu	32(%r12), %xmm4
+	movups	%xmm4, 36(%rbx)
+	movl	48(%r12), %eax
+	movl	%eax, 52(%rbx)
+	.loc 1 156 5 is_stmt 1 view .LVU843
+.LVL253:
+.L148:
+	.loc 1 157 9 view .LVU844
+	.loc 1 157 25 is_stmt 0 view .LVU845
+	addl	$1, %edx
+.LBE339:
+.LBE341:
+	.loc 1 274 12 view .LVU846
+	xorl	%eax, %eax
+.LBB342:
+.LBB340:
+	.loc 1 157 25 view .LVU847
+	movb	%dl, 1(%rbx)
+	jmp	.L178
+.LVL254:
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.loc 1 157 25 view .LVU848
+	testb	%al, %al
+	je	.L127
+	movl	%edx, 12(%rsp)
+.L127:
+.LBE340:
+.LBE342:
+.LBB343:
+.LBB333:
+	.loc 1 96 13 is_stmt 1 view .LVU849
+	.loc 1 96 29 is_stmt 0 view .LVU850
+	movb	$1, 16(%rsp)
+	.loc 1 97 13 is_stmt 1 view .LVU851
+	.loc 1 97 20 is_stmt 0 view .LVU852
+	jmp	.L128
+.LVL255:
+	.p2align 4,,10
+	.p2align 3
+.L173:
+	.loc 1 97 20 view .LVU853
+	testb	%sil, %sil
+	je	.L152
+	movl	%eax, 12(%rsp)
+.L123:
+.LBE333:
+.LBE343:
+.LBB344:
+.LBB328:
+	.loc 1 96 13 is_stmt 1 view .LVU854
+	.loc 1 96 29 is_stmt 0 view .LVU855
+	movb	$1, 16(%rsp)
+	.loc 1 97 13 is_stmt 1 view .LVU856
+	.loc 1 97 20 is_stmt 0 view .LVU857
+	xorl	%r8d, %r8d
+.LVL256:
+	.loc 1 97 20 view .LVU858
+	jmp	.L124
+.LVL257:
+	.p2align 4,,10
+	.p2align 3
+.L170:
+	.loc 1 97 20 view .LVU859
+	testb	%sil, %sil
+	je	.L153
+	movl	%eax, 12(%rsp)
+.L134:
+.LBE328:
+.LBE344:
+.LBB345:
+.LBB308:
+	.loc 1 96 13 is_stmt 1 view .LVU860
+	.loc 1 96 29 is_stmt 0 view .LVU861
+	movb	$1, 16(%rsp)
+	.loc 1 97 13 is_stmt 1 view .LVU862
+.LVL258:
+	.loc 1 97 13 is_stmt 0 view .LVU863
+.LBE308:
+.LBE345:
+	.loc 1 241 13 is_stmt 1 view .LVU864
+	jmp	.L135
+.LVL259:
+	.p2align 4,,10
+	.p2align 3
+.L171:
+	.loc 1 241 13 is_stmt 0 view .LVU865
+	testb	%al, %al
+	je	.L140
+	movl	%edx, 12(%rsp)
+.L140:
+.LBB346:
+.LBB323:
+.LBB321:
+.LBB319:
+	.loc 1 96 13 is_stmt 1 view .LVU866
+	.loc 1 96 29 is_stmt 0 view .LVU867
+	movb	$1, 16(%rsp)
+	.loc 1 97 13 is_stmt 1 view .LVU868
+	.loc 1 97 20 is_stmt 0 view .LVU869
+	jmp	.L143
+.LVL260:
+	.p2align 4,,10
+	.p2align 3
+.L174:
+	.loc 1 97 20 view .LVU870
+	movl	%edx, 12(%rsp)
+	jmp	.L124
+.LVL261:
+	.p2align 4,,10
+	.p2align 3
+.L136:
+	.loc 1 97 20 view .LVU871
+	movl	%edx, 12(%rsp)
+.LVL262:
+	.loc 1 97 20 view .LVU872
+.LBE319:
+.LBE321:
+.LBE323:
+.LBE346:
+	.loc 1 241 13 is_stmt 1 view .LVU873
+	.loc 1 241 16 is_stmt 0 view .LVU874
+	testl	%edi, %edi
+	jne	.L137
+	jmp	.L135
+.LVL263:
+	.p2align 4,,10
+	.p2align 3
+.L172:
+.LBB347:
+.LBB324:
+	.loc 1 116 45 view .LVU875
+	movl	%r8d, %eax
+	.loc 1 116 29 view .LVU876
+	shrl	%r8d
+.LVL264:
+	.loc 1 116 29 view .LVU877
+	movl	%edx, 12(%rsp)
+	.loc 1 116 45 view .LVU878
+	andl	$1, %eax
+.LVL265:
+	.loc 1 116 37 view .LVU879
+	negl	%eax
+	.loc 1 116 35 view .LVU880
+	xorl	%r8d, %eax
+.LBE324:
+.LBE347:
+	.loc 1 245 81 view .LVU881
+	addl	%eax, %r9d
+	jmp	.L143
+.LVL266:
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	.loc 1 245 81 view .LVU882
+	movl	%edx, 12(%rsp)
+	jmp	.L130
+.LVL267:
+.L152:
+.LBB348:
+.LBB329:
+	.loc 1 95 12 view .LVU883
+	movl	$1, %edx
+	jmp	.L123
+.LVL268:
+.L153:
+	.loc 1 95 12 view .LVU884
+.LBE329:
+.LBE348:
+.LBB349:
+.LBB309:
+	movl	$1, %edx
+	jmp	.L134
+.LBE309:
+.LBE349:
+	.cfi_endproc
+.LFE14:
+	.size	blackboxDecodeFrame, .-blackboxDecodeFrame
+	.section	.bss.zeroFrame,"aw",@nobits
+	.align 32
+	.type	zeroFrame, @object
+	.size	zeroFrame, 52
+zeroFrame:
+	.zero	52
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/blackbox/blackbox_encoding.h"
+	.file 7 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x131e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF807
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL181
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF729
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF730
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF731
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF732
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF733
+	.uleb128 0x9
+	.long	.LASF734
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x9
+	.long	.LASF735
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF736
+	.uleb128 0x9
+	.long	.LASF737
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	.LASF738
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF739
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF740
+	.uleb128 0x9
+	.long	.LASF741
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x16
+	.long	0x9f
+	.uleb128 0x9
+	.long	.LASF742
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x16
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF744
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF745
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x12
+	.long	.LASF754
+	.byte	0x34
+	.byte	0x6
+	.byte	0x22
+	.long	0x14d
+	.uleb128 0x7
+	.long	.LASF746
+	.byte	0x6
+	.byte	0x23
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF747
+	.byte	0x6
+	.byte	0x24
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF748
+	.byte	0x6
+	.byte	0x25
+	.byte	0xd
+	.long	0x14d
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF749
+	.byte	0x6
+	.byte	0x26
+	.byte	0xd
+	.long	0x15d
+	.byte	0xe
+	.uleb128 0x7
+	.long	.LASF750
+	.byte	0x6
+	.byte	0x27
+	.byte	0xd
+	.long	0x14d
+	.byte	0x16
+	.uleb128 0x7
+	.long	.LASF751
+	.byte	0x6
+	.byte	0x28
+	.byte	0xd
+	.long	0x14d
+	.byte	0x1c
+	.uleb128 0x7
+	.long	.LASF752
+	.byte	0x6
+	.byte	0x29
+	.byte	0xd
+	.long	0x16d
+	.byte	0x22
+	.byte	0
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x15d
+	.uleb128 0x14
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x16d
+	.uleb128 0x14
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x17d
+	.uleb128 0x14
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF753
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x16
+	.long	0x17d
+	.uleb128 0x12
+	.long	.LASF755
+	.byte	0x70
+	.byte	0x6
+	.byte	0x2c
+	.long	0x1cf
+	.uleb128 0x7
+	.long	.LASF756
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF757
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF758
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF759
+	.byte	0x6
+	.byte	0x30
+	.byte	0x15
+	.long	0x1cf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	0x17d
+	.long	0x1df
+	.uleb128 0x14
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF760
+	.byte	0x6
+	.byte	0x31
+	.byte	0x3
+	.long	0x18e
+	.uleb128 0x24
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0x212
+	.uleb128 0x15
+	.long	.LASF761
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF762
+	.byte	0x1
+	.uleb128 0x15
+	.long	.LASF763
+	.byte	0x2
+	.uleb128 0x15
+	.long	.LASF764
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF765
+	.byte	0x6
+	.byte	0x38
+	.byte	0x3
+	.long	0x1eb
+	.uleb128 0x12
+	.long	.LASF766
+	.byte	0x6c
+	.byte	0x6
+	.byte	0x3a
+	.long	0x252
+	.uleb128 0x7
+	.long	.LASF756
+	.byte	0x6
+	.byte	0x3b
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF757
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF759
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x15
+	.long	0x1cf
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF767
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x3
+	.long	0x21e
+	.uleb128 0x12
+	.long	.LASF768
+	.byte	0x18
+	.byte	0x1
+	.byte	0x27
+	.long	0x2ac
+	.uleb128 0x7
+	.long	.LASF769
+	.byte	0x1
+	.byte	0x28
+	.byte	0x14
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF770
+	.byte	0x1
+	.byte	0x29
+	.byte	0xe
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF771
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x7
+	.long	.LASF772
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x9
+	.long	0x2b1
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF773
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x9
+	.long	0x2b1
+	.byte	0x11
+	.byte	0
+	.uleb128 0xa
+	.long	0xc8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF774
+	.uleb128 0x9
+	.long	.LASF775
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x3
+	.long	0x25e
+	.uleb128 0x1a
+	.long	.LASF779
+	.byte	0x2f
+	.byte	0x18
+	.long	0x17d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	zeroFrame
+	.uleb128 0x25
+	.long	.LASF808
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x2f9
+	.uleb128 0x17
+	.long	0x96
+	.uleb128 0x17
+	.long	0x7c
+	.uleb128 0x17
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF784
+	.byte	0xd2
+	.byte	0x18
+	.long	0x212
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x611
+	.uleb128 0x8
+	.long	.LASF776
+	.byte	0xd2
+	.byte	0x3f
+	.long	0x611
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x8
+	.long	.LASF769
+	.byte	0xd2
+	.byte	0x57
+	.long	0x2ac
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x8
+	.long	.LASF770
+	.byte	0xd2
+	.byte	0x66
+	.long	0xcd
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x8
+	.long	.LASF777
+	.byte	0xd3
+	.byte	0x1a
+	.long	0x616
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x8
+	.long	.LASF778
+	.byte	0xd3
+	.byte	0x2b
+	.long	0x61b
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x1a
+	.long	.LASF780
+	.byte	0xd5
+	.byte	0x16
+	.long	0x2b8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x10
+	.long	.LASF781
+	.byte	0xd6
+	.byte	0x1c
+	.long	0x620
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x10
+	.long	.LASF782
+	.byte	0xd7
+	.byte	0xe
+	.long	0xcd
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x10
+	.long	.LASF783
+	.byte	0xd8
+	.byte	0xd
+	.long	0xbc
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x11
+	.long	0xe7a
+	.long	.LLRL153
+	.byte	0xf0
+	.byte	0x1e
+	.long	0x403
+	.uleb128 0x3
+	.long	0xe89
+	.uleb128 0x5
+	.long	.LLRL153
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST156
+	.long	.LVUS156
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x92b
+	.quad	.LBI310
+	.value	.LVU694
+	.long	.LLRL157
+	.byte	0xf5
+	.byte	0x1b
+	.long	0x437
+	.uleb128 0x1
+	.long	0x945
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x1
+	.long	0x93a
+	.long	.LLST159
+	.long	.LVUS159
+	.byte	0
+	.uleb128 0xb
+	.long	0xe54
+	.quad	.LBI314
+	.value	.LVU700
+	.long	.LLRL160
+	.byte	0xf5
+	.byte	0x53
+	.long	0x4b9
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x5
+	.long	.LLRL160
+	.uleb128 0x26
+	.long	0xe6e
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI316
+	.value	.LVU702
+	.long	.LLRL162
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x5
+	.long	.LLRL162
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xe7a
+	.long	.LLRL167
+	.byte	0xea
+	.byte	0x24
+	.long	0x4fb
+	.uleb128 0x3
+	.long	0xe89
+	.uleb128 0x5
+	.long	.LLRL167
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST170
+	.long	.LVUS170
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0xe7a
+	.quad	.LBI330
+	.value	.LVU755
+	.long	.LLRL171
+	.byte	0xeb
+	.byte	0x1b
+	.long	0x54f
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x5
+	.long	.LLRL171
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x8e4
+	.quad	.LBI335
+	.value	.LVU789
+	.quad	.LBB335
+	.quad	.LBE335-.LBB335
+	.byte	0xfe
+	.byte	0x4e
+	.long	0x582
+	.uleb128 0x1
+	.long	0x8f3
+	.long	.LLST176
+	.long	.LVUS176
+	.byte	0
+	.uleb128 0x27
+	.long	0x8ff
+	.quad	.LBI337
+	.value	.LVU802
+	.long	.LLRL177
+	.byte	0x1
+	.value	0x110
+	.byte	0x5
+	.long	0x5c5
+	.uleb128 0x1
+	.long	0x91f
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x1
+	.long	0x914
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x1
+	.long	0x909
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL215
+	.long	0x951
+	.long	0x5e9
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL233
+	.long	0x951
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	zeroFrame
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x252
+	.uleb128 0xa
+	.long	0x17d
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0xa
+	.long	0x189
+	.uleb128 0x1f
+	.long	.LASF788
+	.byte	0xc8
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x668
+	.uleb128 0x8
+	.long	.LASF776
+	.byte	0xc8
+	.byte	0x2d
+	.long	0x611
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x8
+	.long	.LASF756
+	.byte	0xc8
+	.byte	0x3e
+	.long	0xbc
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF785
+	.byte	0xaf
+	.byte	0x9
+	.long	0xbc
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x897
+	.uleb128 0x8
+	.long	.LASF786
+	.byte	0xaf
+	.byte	0x30
+	.long	0x897
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x18
+	.long	.LASF777
+	.byte	0xaf
+	.byte	0x50
+	.long	0x620
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.long	.LASF787
+	.byte	0xaf
+	.byte	0x60
+	.long	0x89c
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x10
+	.long	.LASF781
+	.byte	0xb1
+	.byte	0x1c
+	.long	0x620
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x10
+	.long	.LASF771
+	.byte	0xb2
+	.byte	0xe
+	.long	0x89c
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1c
+	.long	0x12fd
+	.quad	.LBI260
+	.value	.LVU506
+	.quad	.LBB260
+	.quad	.LBE260-.LBB260
+	.byte	0xb6
+	.byte	0x14
+	.long	0x722
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0xb
+	.long	0x12fd
+	.quad	.LBI262
+	.value	.LVU523
+	.long	.LLRL124
+	.byte	0xb7
+	.byte	0x14
+	.long	0x756
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0xb
+	.long	0x8ff
+	.quad	.LBI266
+	.value	.LVU543
+	.long	.LLRL127
+	.byte	0xc2
+	.byte	0x5
+	.long	0x797
+	.uleb128 0x1
+	.long	0x91f
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x1
+	.long	0x914
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x1
+	.long	0x909
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.uleb128 0xb
+	.long	0x12fd
+	.quad	.LBI272
+	.value	.LVU565
+	.long	.LLRL131
+	.byte	0xbd
+	.byte	0x14
+	.long	0x7cb
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST133
+	.long	.LVUS133
+	.byte	0
+	.uleb128 0xb
+	.long	0x92b
+	.quad	.LBI275
+	.value	.LVU583
+	.long	.LLRL134
+	.byte	0xbe
+	.byte	0x3a
+	.long	0x7ff
+	.uleb128 0x1
+	.long	0x945
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x1
+	.long	0x93a
+	.long	.LLST136
+	.long	.LVUS136
+	.byte	0
+	.uleb128 0xb
+	.long	0x12d7
+	.quad	.LBI280
+	.value	.LVU591
+	.long	.LLRL137
+	.byte	0xbe
+	.byte	0x14
+	.long	0x863
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI282
+	.value	.LVU596
+	.long	.LLRL140
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL166
+	.long	0xeb6
+	.long	0x882
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	zeroFrame
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL191
+	.long	0xeb6
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7a
+	.sleb128 8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1df
+	.uleb128 0xa
+	.long	0xbc
+	.uleb128 0x1f
+	.long	.LASF789
+	.byte	0xa6
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8e4
+	.uleb128 0x8
+	.long	.LASF786
+	.byte	0xa6
+	.byte	0x2d
+	.long	0x897
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x8
+	.long	.LASF756
+	.byte	0xa6
+	.byte	0x3e
+	.long	0xbc
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF791
+	.byte	0xa1
+	.byte	0xc
+	.long	0x2b1
+	.long	0x8ff
+	.uleb128 0x6
+	.long	.LASF790
+	.byte	0xa1
+	.byte	0x1d
+	.long	0xbc
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF794
+	.byte	0x97
+	.long	0x92b
+	.uleb128 0x6
+	.long	.LASF759
+	.byte	0x97
+	.byte	0x2a
+	.long	0x616
+	.uleb128 0x6
+	.long	.LASF757
+	.byte	0x97
+	.byte	0x3c
+	.long	0x89c
+	.uleb128 0x6
+	.long	.LASF777
+	.byte	0x97
+	.byte	0x62
+	.long	0x620
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF792
+	.byte	0x8e
+	.byte	0x11
+	.long	0xcd
+	.long	0x951
+	.uleb128 0x6
+	.long	.LASF759
+	.byte	0x8e
+	.byte	0x34
+	.long	0x620
+	.uleb128 0x6
+	.long	.LASF757
+	.byte	0x8e
+	.byte	0x45
+	.long	0xbc
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x1
+	.byte	0x85
+	.byte	0xd
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdf8
+	.uleb128 0x18
+	.long	.LASF780
+	.byte	0x85
+	.byte	0x2a
+	.long	0xdf8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.long	.LASF777
+	.byte	0x85
+	.byte	0x43
+	.long	0x616
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x8
+	.long	.LASF793
+	.byte	0x85
+	.byte	0x61
+	.long	0x620
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x8
+	.long	.LASF756
+	.byte	0x85
+	.byte	0x75
+	.long	0xbc
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xb
+	.long	0xdfd
+	.quad	.LBI128
+	.value	.LVU168
+	.long	.LLRL53
+	.byte	0x87
+	.byte	0x5
+	.long	0xaa9
+	.uleb128 0x1
+	.long	0xe28
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x1
+	.long	0xe1d
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0xe12
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x1
+	.long	0xe07
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x5
+	.long	.LLRL53
+	.uleb128 0x2
+	.long	0xe33
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0xe3e
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x4
+	.long	0xe54
+	.quad	.LBI130
+	.value	.LVU181
+	.long	.LLRL60
+	.byte	0x7d
+	.byte	0x26
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x5
+	.long	.LLRL60
+	.uleb128 0x2
+	.long	0xe6e
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI132
+	.value	.LVU183
+	.long	.LLRL63
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x5
+	.long	.LLRL63
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xdfd
+	.long	.LLRL68
+	.byte	0x88
+	.byte	0x5
+	.long	0xb73
+	.uleb128 0x3
+	.long	0xe28
+	.uleb128 0x3
+	.long	0xe1d
+	.uleb128 0x3
+	.long	0xe12
+	.uleb128 0x3
+	.long	0xe07
+	.uleb128 0x5
+	.long	.LLRL68
+	.uleb128 0x2
+	.long	0xe33
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x2
+	.long	0xe3e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x4
+	.long	0xe54
+	.quad	.LBI168
+	.value	.LVU219
+	.long	.LLRL71
+	.byte	0x7d
+	.byte	0x26
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x5
+	.long	.LLRL71
+	.uleb128 0x2
+	.long	0xe6e
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI170
+	.value	.LVU221
+	.long	.LLRL74
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x5
+	.long	.LLRL74
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xdfd
+	.long	.LLRL79
+	.byte	0x89
+	.byte	0x5
+	.long	0xc3d
+	.uleb128 0x3
+	.long	0xe28
+	.uleb128 0x3
+	.long	0xe1d
+	.uleb128 0x3
+	.long	0xe12
+	.uleb128 0x3
+	.long	0xe07
+	.uleb128 0x5
+	.long	.LLRL79
+	.uleb128 0x2
+	.long	0xe33
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0xe3e
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x4
+	.long	0xe54
+	.quad	.LBI186
+	.value	.LVU257
+	.long	.LLRL82
+	.byte	0x7d
+	.byte	0x26
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x5
+	.long	.LLRL82
+	.uleb128 0x2
+	.long	0xe6e
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI188
+	.value	.LVU259
+	.long	.LLRL85
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x5
+	.long	.LLRL85
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xdfd
+	.long	.LLRL90
+	.byte	0x8a
+	.byte	0x5
+	.long	0xd07
+	.uleb128 0x3
+	.long	0xe28
+	.uleb128 0x3
+	.long	0xe1d
+	.uleb128 0x3
+	.long	0xe12
+	.uleb128 0x3
+	.long	0xe07
+	.uleb128 0x5
+	.long	.LLRL90
+	.uleb128 0x2
+	.long	0xe33
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x2
+	.long	0xe3e
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x4
+	.long	0xe54
+	.quad	.LBI203
+	.value	.LVU294
+	.long	.LLRL93
+	.byte	0x7d
+	.byte	0x26
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x5
+	.long	.LLRL93
+	.uleb128 0x2
+	.long	0xe6e
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI205
+	.value	.LVU296
+	.long	.LLRL96
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x5
+	.long	.LLRL96
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xdfd
+	.quad	.LBI219
+	.value	.LVU344
+	.long	.LLRL101
+	.byte	0x8b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0xe28
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x1
+	.long	0xe1d
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x1
+	.long	0xe12
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0xe07
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x5
+	.long	.LLRL101
+	.uleb128 0x2
+	.long	0xe33
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x2
+	.long	0xe3e
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x4
+	.long	0xe54
+	.quad	.LBI221
+	.value	.LVU348
+	.long	.LLRL108
+	.byte	0x7d
+	.byte	0x26
+	.uleb128 0x1
+	.long	0xe63
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x5
+	.long	.LLRL108
+	.uleb128 0x2
+	.long	0xe6e
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x4
+	.long	0xe7a
+	.quad	.LBI223
+	.value	.LVU350
+	.long	.LLRL111
+	.byte	0x72
+	.byte	0x16
+	.uleb128 0x1
+	.long	0xe89
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x5
+	.long	.LLRL111
+	.uleb128 0x2
+	.long	0xe94
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x2
+	.long	0xe9f
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2
+	.long	0xeaa
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2b8
+	.uleb128 0x20
+	.long	.LASF795
+	.byte	0x77
+	.long	0xe4a
+	.uleb128 0x6
+	.long	.LASF780
+	.byte	0x77
+	.byte	0x2f
+	.long	0xdf8
+	.uleb128 0x6
+	.long	.LASF796
+	.byte	0x77
+	.byte	0x40
+	.long	0xe4a
+	.uleb128 0x6
+	.long	.LASF797
+	.byte	0x77
+	.byte	0x57
+	.long	0xe4f
+	.uleb128 0x6
+	.long	.LASF798
+	.byte	0x77
+	.byte	0x6c
+	.long	0xbc
+	.uleb128 0xe
+	.long	.LASF799
+	.byte	0x79
+	.byte	0xd
+	.long	0xb0
+	.uleb128 0xe
+	.long	.LASF800
+	.byte	0x7a
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0xa
+	.long	0x9f
+	.uleb128 0xa
+	.long	0xab
+	.uleb128 0xf
+	.long	.LASF801
+	.byte	0x70
+	.byte	0x10
+	.long	0xb0
+	.long	0xe7a
+	.uleb128 0x6
+	.long	.LASF780
+	.byte	0x70
+	.byte	0x2f
+	.long	0xdf8
+	.uleb128 0xe
+	.long	.LASF799
+	.byte	0x72
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF802
+	.byte	0x58
+	.byte	0x11
+	.long	0xcd
+	.long	0xeb6
+	.uleb128 0x6
+	.long	.LASF780
+	.byte	0x58
+	.byte	0x32
+	.long	0xdf8
+	.uleb128 0xe
+	.long	.LASF799
+	.byte	0x5a
+	.byte	0xe
+	.long	0xcd
+	.uleb128 0xe
+	.long	.LASF803
+	.byte	0x5b
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0xe
+	.long	.LASF790
+	.byte	0x5c
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF810
+	.byte	0x1
+	.byte	0x4d
+	.byte	0x11
+	.long	0x89c
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1290
+	.uleb128 0x8
+	.long	.LASF787
+	.byte	0x4d
+	.byte	0x26
+	.long	0x89c
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x18
+	.long	.LASF777
+	.byte	0x4d
+	.byte	0x45
+	.long	0x620
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.long	.LASF793
+	.byte	0x4d
+	.byte	0x63
+	.long	0x620
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x8
+	.long	.LASF756
+	.byte	0x4d
+	.byte	0x77
+	.long	0xbc
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xb
+	.long	0x1290
+	.quad	.LBI46
+	.value	.LVU3
+	.long	.LLRL3
+	.byte	0x4f
+	.byte	0xe
+	.long	0xfdf
+	.uleb128 0x1
+	.long	0x12c0
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0x12b5
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1
+	.long	0x12aa
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x129f
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x5
+	.long	.LLRL3
+	.uleb128 0x2
+	.long	0x12cb
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x4
+	.long	0x12d7
+	.quad	.LBI48
+	.value	.LVU12
+	.long	.LLRL9
+	.byte	0x47
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI50
+	.value	.LVU17
+	.long	.LLRL12
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x1290
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.byte	0x50
+	.long	0x1083
+	.uleb128 0x3
+	.long	0x12c0
+	.uleb128 0x3
+	.long	0x12b5
+	.uleb128 0x3
+	.long	0x12aa
+	.uleb128 0x1
+	.long	0x129f
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x12cb
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.long	0x12d7
+	.quad	.LBI60
+	.value	.LVU42
+	.long	.LLRL17
+	.byte	0x47
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI62
+	.value	.LVU47
+	.long	.LLRL20
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x1290
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0x51
+	.long	0x1127
+	.uleb128 0x3
+	.long	0x12c0
+	.uleb128 0x3
+	.long	0x12b5
+	.uleb128 0x3
+	.long	0x12aa
+	.uleb128 0x1
+	.long	0x129f
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x2
+	.long	0x12cb
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x4
+	.long	0x12d7
+	.quad	.LBI70
+	.value	.LVU72
+	.long	.LLRL25
+	.byte	0x47
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI72
+	.value	.LVU77
+	.long	.LLRL28
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x1290
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.byte	0x52
+	.long	0x11cb
+	.uleb128 0x3
+	.long	0x12c0
+	.uleb128 0x3
+	.long	0x12b5
+	.uleb128 0x3
+	.long	0x12aa
+	.uleb128 0x1
+	.long	0x129f
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2
+	.long	0x12cb
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.long	0x12d7
+	.quad	.LBI80
+	.value	.LVU102
+	.long	.LLRL33
+	.byte	0x47
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI82
+	.value	.LVU107
+	.long	.LLRL36
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	0x1290
+	.quad	.LBI88
+	.value	.LVU130
+	.quad	.LBB88
+	.quad	.LBE88-.LBB88
+	.byte	0x1
+	.byte	0x53
+	.byte	0xe
+	.uleb128 0x1
+	.long	0x12c0
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x12b5
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0x12aa
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0x129f
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x2
+	.long	0x12cb
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x4
+	.long	0x12d7
+	.quad	.LBI90
+	.value	.LVU137
+	.long	.LLRL44
+	.byte	0x47
+	.byte	0x12
+	.uleb128 0x1
+	.long	0x12f1
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x1
+	.long	0x12e6
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x4
+	.long	0x12fd
+	.quad	.LBI92
+	.value	.LVU142
+	.long	.LLRL47
+	.byte	0x3f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1315
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x130a
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF804
+	.byte	0x42
+	.byte	0x11
+	.long	0x89c
+	.long	0x12d7
+	.uleb128 0x6
+	.long	.LASF787
+	.byte	0x42
+	.byte	0x2b
+	.long	0x89c
+	.uleb128 0x6
+	.long	.LASF796
+	.byte	0x42
+	.byte	0x42
+	.long	0xe4f
+	.uleb128 0x6
+	.long	.LASF797
+	.byte	0x42
+	.byte	0x59
+	.long	0xe4f
+	.uleb128 0x6
+	.long	.LASF798
+	.byte	0x42
+	.byte	0x6e
+	.long	0xbc
+	.uleb128 0xe
+	.long	.LASF800
+	.byte	0x44
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF805
+	.byte	0x3c
+	.byte	0x11
+	.long	0x89c
+	.long	0x12fd
+	.uleb128 0x6
+	.long	.LASF787
+	.byte	0x3c
+	.byte	0x28
+	.long	0x89c
+	.uleb128 0x6
+	.long	.LASF799
+	.byte	0x3c
+	.byte	0x38
+	.long	0xb0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF806
+	.byte	0x1
+	.byte	0x31
+	.byte	0x11
+	.long	0x89c
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF787
+	.byte	0x31
+	.byte	0x2a
+	.long	0x89c
+	.uleb128 0x6
+	.long	.LASF799
+	.byte	0x31
+	.byte	0x3b
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS145:
+	.uleb128 0
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST145:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL202-.LVL198
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-.LVL198
+	.uleb128 .LVL238-.LVL198
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL238-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL246-.LVL198
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL246-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS146:
+	.uleb128 0
+	.uleb128 .LVU670
+	.uleb128 .LVU670
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU732
+	.uleb128 .LVU732
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU830
+	.uleb128 .LVU830
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST146:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL201-.LVL198
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL201-.LVL198
+	.uleb128 .LVL216-.LVL198
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL216-.LVL198
+	.uleb128 .LVL218-.LVL198
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL218-.LVL198
+	.uleb128 .LVL241-.LVL198
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL241-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL249-.LVL198
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL249-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS147:
+	.uleb128 0
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU813
+	.uleb128 .LVU813
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU828
+	.uleb128 .LVU828
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST147:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL202-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL202-.LVL198
+	.uleb128 .LVL216-.LVL198
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL216-.LVL198
+	.uleb128 .LVL219-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL219-.LVL198
+	.uleb128 .LVL239-.LVL198
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL239-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL247-.LVL198
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL247-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS148:
+	.uleb128 0
+	.uleb128 .LVU669
+	.uleb128 .LVU669
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU731
+	.uleb128 .LVU731
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST148:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL200-.LVL198
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL200-.LVL198
+	.uleb128 .LVL216-.LVL198
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL216-.LVL198
+	.uleb128 .LVL217-.LVL198
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL217-.LVL198
+	.uleb128 .LVL240-.LVL198
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL240-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL248-.LVL198
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL248-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS149:
+	.uleb128 0
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU816
+	.uleb128 .LVU816
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU831
+	.uleb128 .LVU831
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST149:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL202-.LVL198
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL202-.LVL198
+	.uleb128 .LVL216-.LVL198
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL216-.LVL198
+	.uleb128 .LVL219-.LVL198
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL219-.LVL198
+	.uleb128 .LVL242-.LVL198
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL242-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL250-.LVL198
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL250-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU646
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU818
+	.uleb128 .LVU818
+	.uleb128 .LVU820
+	.uleb128 .LVU820
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST150:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL202-.LVL198
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL198
+	.uleb128 .LVL238-.LVL198
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.LVL198
+	.uleb128 .LVL244-.LVL198
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL244-.LVL198
+	.uleb128 .LVL245-.LVL198
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL245-.LVL198
+	.uleb128 .LVL246-.LVL198
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL246-.LVL198
+	.uleb128 .LVL252-.LVL198
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL198
+	.uleb128 .LFE14-.LVL198
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU863
+	.uleb128 .LVU865
+	.uleb128 .LVU872
+	.uleb128 .LVU875
+.LLST151:
+	.byte	0x6
+	.quad	.LVL258
+	.byte	0x4
+	.uleb128 .LVL258-.LVL258
+	.uleb128 .LVL259-.LVL258
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL262-.LVL258
+	.uleb128 .LVL263-.LVL258
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU668
+	.uleb128 .LVU817
+	.uleb128 .LVU820
+	.uleb128 .LVU832
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST152:
+	.byte	0x6
+	.quad	.LVL199
+	.byte	0x4
+	.uleb128 .LVL199-.LVL199
+	.uleb128 .LVL243-.LVL199
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL245-.LVL199
+	.uleb128 .LVL251-.LVL199
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL199
+	.uleb128 .LFE14-.LVL199
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU672
+	.uleb128 .LVU686
+	.uleb128 .LVU859
+	.uleb128 .LVU863
+	.uleb128 .LVU871
+	.uleb128 .LVU872
+	.uleb128 .LVU884
+	.uleb128 0
+.LLST154:
+	.byte	0x6
+	.quad	.LVL203
+	.byte	0x4
+	.uleb128 .LVL203-.LVL203
+	.uleb128 .LVL208-.LVL203
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL257-.LVL203
+	.uleb128 .LVL258-.LVL203
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL261-.LVL203
+	.uleb128 .LVL262-.LVL203
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL268-.LVL203
+	.uleb128 .LFE14-.LVL203
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU672
+	.uleb128 .LVU684
+	.uleb128 .LVU684
+	.uleb128 .LVU685
+	.uleb128 .LVU859
+	.uleb128 .LVU863
+	.uleb128 .LVU871
+	.uleb128 .LVU872
+	.uleb128 .LVU884
+	.uleb128 0
+.LLST155:
+	.byte	0x6
+	.quad	.LVL203
+	.byte	0x4
+	.uleb128 .LVL203-.LVL203
+	.uleb128 .LVL206-.LVL203
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.LVL203
+	.uleb128 .LVL207-.LVL203
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL257-.LVL203
+	.uleb128 .LVL258-.LVL203
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL261-.LVL203
+	.uleb128 .LVL262-.LVL203
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL268-.LVL203
+	.uleb128 .LFE14-.LVL203
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU676
+	.uleb128 .LVU686
+	.uleb128 .LVU871
+	.uleb128 .LVU872
+.LLST156:
+	.byte	0x6
+	.quad	.LVL204
+	.byte	0x4
+	.uleb128 .LVL204-.LVL204
+	.uleb128 .LVL208-.LVL204
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL261-.LVL204
+	.uleb128 .LVL262-.LVL204
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU694
+	.uleb128 .LVU699
+.LLST158:
+	.byte	0x8
+	.quad	.LVL209
+	.uleb128 .LVL210-.LVL209
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU694
+	.uleb128 .LVU699
+.LLST159:
+	.byte	0x8
+	.quad	.LVL209
+	.uleb128 .LVL210-.LVL209
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU699
+	.uleb128 .LVU724
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+	.uleb128 .LVU875
+	.uleb128 .LVU882
+.LLST161:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL214-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL210
+	.uleb128 .LVL260-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.LVL210
+	.uleb128 .LVL266-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU702
+	.uleb128 .LVU722
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+	.uleb128 .LVU875
+	.uleb128 .LVU882
+.LLST163:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL214-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL210
+	.uleb128 .LVL260-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.LVL210
+	.uleb128 .LVL266-.LVL210
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU703
+	.uleb128 .LVU706
+	.uleb128 .LVU706
+	.uleb128 .LVU722
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+	.uleb128 .LVU875
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU879
+.LLST164:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL211-.LVL210
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL211-.LVL210
+	.uleb128 .LVL214-.LVL210
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL259-.LVL210
+	.uleb128 .LVL260-.LVL210
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL263-.LVL210
+	.uleb128 .LVL264-.LVL210
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL264-.LVL210
+	.uleb128 .LVL265-.LVL210
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU703
+	.uleb128 .LVU722
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+	.uleb128 .LVU875
+	.uleb128 .LVU882
+.LLST165:
+	.byte	0x6
+	.quad	.LVL210
+	.byte	0x4
+	.uleb128 .LVL210-.LVL210
+	.uleb128 .LVL214-.LVL210
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL210
+	.uleb128 .LVL260-.LVL210
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.LVL210
+	.uleb128 .LVL266-.LVL210
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU710
+	.uleb128 .LVU722
+	.uleb128 .LVU875
+	.uleb128 .LVU882
+.LLST166:
+	.byte	0x6
+	.quad	.LVL212
+	.byte	0x4
+	.uleb128 .LVL212-.LVL212
+	.uleb128 .LVL214-.LVL212
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-.LVL212
+	.uleb128 .LVL266-.LVL212
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU734
+	.uleb128 .LVU750
+	.uleb128 .LVU853
+	.uleb128 .LVU858
+	.uleb128 .LVU870
+	.uleb128 .LVU871
+	.uleb128 .LVU883
+	.uleb128 .LVU884
+.LLST168:
+	.byte	0x6
+	.quad	.LVL220
+	.byte	0x4
+	.uleb128 .LVL220-.LVL220
+	.uleb128 .LVL225-.LVL220
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL255-.LVL220
+	.uleb128 .LVL256-.LVL220
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL260-.LVL220
+	.uleb128 .LVL261-.LVL220
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL267-.LVL220
+	.uleb128 .LVL268-.LVL220
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU734
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU747
+	.uleb128 .LVU853
+	.uleb128 .LVU859
+	.uleb128 .LVU870
+	.uleb128 .LVU871
+	.uleb128 .LVU883
+	.uleb128 .LVU884
+.LLST169:
+	.byte	0x6
+	.quad	.LVL220
+	.byte	0x4
+	.uleb128 .LVL220-.LVL220
+	.uleb128 .LVL223-.LVL220
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.LVL220
+	.uleb128 .LVL224-.LVL220
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-.LVL220
+	.uleb128 .LVL257-.LVL220
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.LVL220
+	.uleb128 .LVL261-.LVL220
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.LVL220
+	.uleb128 .LVL268-.LVL220
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU738
+	.uleb128 .LVU752
+	.uleb128 .LVU870
+	.uleb128 .LVU871
+.LLST170:
+	.byte	0x6
+	.quad	.LVL221
+	.byte	0x4
+	.uleb128 .LVL221-.LVL221
+	.uleb128 .LVL226-.LVL221
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL260-.LVL221
+	.uleb128 .LVL261-.LVL221
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU755
+	.uleb128 .LVU776
+	.uleb128 .LVU848
+	.uleb128 .LVU853
+	.uleb128 .LVU882
+	.uleb128 .LVU883
+.LLST172:
+	.byte	0x6
+	.quad	.LVL227
+	.byte	0x4
+	.uleb128 .LVL227-.LVL227
+	.uleb128 .LVL232-.LVL227
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.LVL227
+	.uleb128 .LVL255-.LVL227
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL266-.LVL227
+	.uleb128 .LVL267-.LVL227
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU756
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 .LVU776
+	.uleb128 .LVU848
+	.uleb128 .LVU853
+	.uleb128 .LVU882
+	.uleb128 .LVU883
+.LLST173:
+	.byte	0x6
+	.quad	.LVL227
+	.byte	0x4
+	.uleb128 .LVL227-.LVL227
+	.uleb128 .LVL228-.LVL227
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL228-.LVL227
+	.uleb128 .LVL232-.LVL227
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL254-.LVL227
+	.uleb128 .LVL255-.LVL227
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL266-.LVL227
+	.uleb128 .LVL267-.LVL227
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU756
+	.uleb128 .LVU776
+	.uleb128 .LVU848
+	.uleb128 .LVU853
+	.uleb128 .LVU882
+	.uleb128 .LVU883
+.LLST174:
+	.byte	0x6
+	.quad	.LVL227
+	.byte	0x4
+	.uleb128 .LVL227-.LVL227
+	.uleb128 .LVL232-.LVL227
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.LVL227
+	.uleb128 .LVL255-.LVL227
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL266-.LVL227
+	.uleb128 .LVL267-.LVL227
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU763
+	.uleb128 .LVU775
+	.uleb128 .LVU882
+	.uleb128 .LVU883
+.LLST175:
+	.byte	0x6
+	.quad	.LVL229
+	.byte	0x4
+	.uleb128 .LVL229-.LVL229
+	.uleb128 .LVL231-.LVL229
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL266-.LVL229
+	.uleb128 .LVL267-.LVL229
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU789
+	.uleb128 .LVU792
+.LLST176:
+	.byte	0x8
+	.quad	.LVL234
+	.uleb128 .LVL235-.LVL234
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU802
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU818
+	.uleb128 .LVU835
+	.uleb128 .LVU848
+.LLST178:
+	.byte	0x6
+	.quad	.LVL236
+	.byte	0x4
+	.uleb128 .LVL236-.LVL236
+	.uleb128 .LVL240-.LVL236
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL240-.LVL236
+	.uleb128 .LVL244-.LVL236
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL236
+	.uleb128 .LVL254-.LVL236
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU802
+	.uleb128 .LVU811
+	.uleb128 .LVU835
+	.uleb128 .LVU848
+.LLST179:
+	.byte	0x6
+	.quad	.LVL236
+	.byte	0x4
+	.uleb128 .LVL236-.LVL236
+	.uleb128 .LVL237-.LVL236
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL236
+	.uleb128 .LVL254-.LVL236
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU802
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU818
+	.uleb128 .LVU835
+	.uleb128 .LVU848
+.LLST180:
+	.byte	0x6
+	.quad	.LVL236
+	.byte	0x4
+	.uleb128 .LVL236-.LVL236
+	.uleb128 .LVL238-.LVL236
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.LVL236
+	.uleb128 .LVL244-.LVL236
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL236
+	.uleb128 .LVL254-.LVL236
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 0
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 0
+.LLST143:
+	.byte	0x6
+	.quad	.LVL195
+	.byte	0x4
+	.uleb128 .LVL195-.LVL195
+	.uleb128 .LVL196-.LVL195
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL196-.LVL195
+	.uleb128 .LFE13-.LVL195
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS144:
+	.uleb128 0
+	.uleb128 .LVU641
+	.uleb128 .LVU641
+	.uleb128 0
+.LLST144:
+	.byte	0x6
+	.quad	.LVL195
+	.byte	0x4
+	.uleb128 .LVL195-.LVL195
+	.uleb128 .LVL197-.LVL195
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL197-.LVL195
+	.uleb128 .LFE13-.LVL195
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 0
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 0
+.LLST118:
+	.byte	0x6
+	.quad	.LVL148
+	.byte	0x4
+	.uleb128 .LVL148-.LVL148
+	.uleb128 .LVL157-.LVL148
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL157-.LVL148
+	.uleb128 .LVL170-.LVL148
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL170-.LVL148
+	.uleb128 .LVL178-.LVL148
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL178-.LVL148
+	.uleb128 .LFE12-.LVL148
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS119:
+	.uleb128 0
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 0
+.LLST119:
+	.byte	0x6
+	.quad	.LVL148
+	.byte	0x4
+	.uleb128 .LVL148-.LVL148
+	.uleb128 .LVL151-.LVL148
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL151-.LVL148
+	.uleb128 .LVL170-.LVL148
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL170-.LVL148
+	.uleb128 .LVL171-.LVL148
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL171-.LVL148
+	.uleb128 .LFE12-.LVL148
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU496
+	.uleb128 .LVU519
+	.uleb128 .LVU519
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU579
+	.uleb128 .LVU579
+	.uleb128 0
+.LLST120:
+	.byte	0x6
+	.quad	.LVL149
+	.byte	0x4
+	.uleb128 .LVL149-.LVL149
+	.uleb128 .LVL157-.LVL149
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL149
+	.uleb128 .LVL170-.LVL149
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL170-.LVL149
+	.uleb128 .LVL178-.LVL149
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.LVL149
+	.uleb128 .LFE12-.LVL149
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU497
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU520
+	.uleb128 .LVU520
+	.uleb128 .LVU525
+	.uleb128 .LVU535
+	.uleb128 .LVU539
+	.uleb128 .LVU539
+	.uleb128 .LVU541
+	.uleb128 .LVU541
+	.uleb128 .LVU555
+	.uleb128 .LVU560
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU599
+	.uleb128 .LVU609
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU633
+.LLST121:
+	.byte	0x6
+	.quad	.LVL149
+	.byte	0x4
+	.uleb128 .LVL149-.LVL149
+	.uleb128 .LVL150-.LVL149
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL150-.LVL149
+	.uleb128 .LVL151-.LVL149
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.LVL149
+	.uleb128 .LVL157-.LVL149
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL149
+	.uleb128 .LVL159-.LVL149
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL164-.LVL149
+	.uleb128 .LVL165-.LVL149
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.LVL149
+	.uleb128 .LVL166-1-.LVL149
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL166-.LVL149
+	.uleb128 .LVL168-.LVL149
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL170-.LVL149
+	.uleb128 .LVL170-.LVL149
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL170-.LVL149
+	.uleb128 .LVL171-.LVL149
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL149
+	.uleb128 .LVL178-.LVL149
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.LVL149
+	.uleb128 .LVL184-.LVL149
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL189-.LVL149
+	.uleb128 .LVL190-.LVL149
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.LVL149
+	.uleb128 .LVL191-1-.LVL149
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL191-.LVL149
+	.uleb128 .LVL194-.LVL149
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU506
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+	.uleb128 .LVU520
+.LLST122:
+	.byte	0x6
+	.quad	.LVL151
+	.byte	0x4
+	.uleb128 .LVL151-.LVL151
+	.uleb128 .LVL154-.LVL151
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL155-.LVL151
+	.uleb128 .LVL157-.LVL151
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU506
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU520
+.LLST123:
+	.byte	0x6
+	.quad	.LVL151
+	.byte	0x4
+	.uleb128 .LVL151-.LVL151
+	.uleb128 .LVL152-.LVL151
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL151
+	.uleb128 .LVL156-.LVL151
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-.LVL151
+	.uleb128 .LVL157-.LVL151
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU523
+	.uleb128 .LVU529
+	.uleb128 .LVU531
+	.uleb128 .LVU535
+.LLST125:
+	.byte	0x6
+	.quad	.LVL158
+	.byte	0x4
+	.uleb128 .LVL158-.LVL158
+	.uleb128 .LVL161-.LVL158
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL162-.LVL158
+	.uleb128 .LVL164-.LVL158
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU523
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU535
+.LLST126:
+	.byte	0x6
+	.quad	.LVL158
+	.byte	0x4
+	.uleb128 .LVL158-.LVL158
+	.uleb128 .LVL163-.LVL158
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL163-.LVL158
+	.uleb128 .LVL164-.LVL158
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU543
+	.uleb128 .LVU556
+	.uleb128 .LVU620
+	.uleb128 .LVU628
+.LLST128:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL169-.LVL166
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL192-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU543
+	.uleb128 .LVU556
+	.uleb128 .LVU620
+	.uleb128 .LVU628
+.LLST129:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL169-.LVL166
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU543
+	.uleb128 .LVU556
+	.uleb128 .LVU620
+	.uleb128 .LVU628
+.LLST130:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL169-.LVL166
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU565
+	.uleb128 .LVU572
+	.uleb128 .LVU574
+	.uleb128 .LVU580
+.LLST132:
+	.byte	0x6
+	.quad	.LVL172
+	.byte	0x4
+	.uleb128 .LVL172-.LVL172
+	.uleb128 .LVL175-.LVL172
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL176-.LVL172
+	.uleb128 .LVL178-.LVL172
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU565
+	.uleb128 .LVU568
+	.uleb128 .LVU568
+	.uleb128 .LVU575
+	.uleb128 .LVU579
+	.uleb128 .LVU580
+.LLST133:
+	.byte	0x6
+	.quad	.LVL172
+	.byte	0x4
+	.uleb128 .LVL172-.LVL172
+	.uleb128 .LVL173-.LVL172
+	.uleb128 0x3
+	.byte	0x7b
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL173-.LVL172
+	.uleb128 .LVL177-.LVL172
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL178-.LVL172
+	.uleb128 .LVL178-.LVL172
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU583
+	.uleb128 .LVU589
+.LLST135:
+	.byte	0x8
+	.quad	.LVL179
+	.uleb128 .LVL180-.LVL179
+	.uleb128 0x2
+	.byte	0x7a
+	.sleb128 1
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU583
+	.uleb128 .LVU589
+.LLST136:
+	.byte	0x8
+	.quad	.LVL179
+	.uleb128 .LVL180-.LVL179
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU591
+	.uleb128 .LVU595
+.LLST138:
+	.byte	0x8
+	.quad	.LVL181
+	.uleb128 .LVL182-.LVL181
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU591
+	.uleb128 .LVU599
+.LLST139:
+	.byte	0x8
+	.quad	.LVL181
+	.uleb128 .LVL184-.LVL181
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU596
+	.uleb128 .LVU603
+	.uleb128 .LVU605
+	.uleb128 .LVU609
+.LLST141:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL186-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL187-.LVL183
+	.uleb128 .LVL189-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU596
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 .LVU609
+.LLST142:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL188-.LVL183
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL188-.LVL183
+	.uleb128 .LVL189-.LVL183
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 0
+.LLST116:
+	.byte	0x6
+	.quad	.LVL145
+	.byte	0x4
+	.uleb128 .LVL145-.LVL145
+	.uleb128 .LVL146-.LVL145
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL146-.LVL145
+	.uleb128 .LFE11-.LVL145
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS117:
+	.uleb128 0
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 0
+.LLST117:
+	.byte	0x6
+	.quad	.LVL145
+	.byte	0x4
+	.uleb128 .LVL145-.LVL145
+	.uleb128 .LVL147-.LVL145
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL147-.LVL145
+	.uleb128 .LFE11-.LVL145
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST50:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL65-.LVL63
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL65-.LVL63
+	.uleb128 .LFE7-.LVL63
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST51:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL66-.LVL63
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.LVL63
+	.uleb128 .LFE7-.LVL63
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 0
+.LLST52:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL66-.LVL63
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL66-.LVL63
+	.uleb128 .LFE7-.LVL63
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU168
+	.uleb128 .LVU216
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+	.uleb128 .LVU433
+	.uleb128 .LVU447
+.LLST54:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL79-.LVL64
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL64
+	.uleb128 .LVL131-.LVL64
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL64
+	.uleb128 .LVL139-.LVL64
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU168
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU216
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+	.uleb128 .LVU433
+	.uleb128 .LVU447
+.LLST55:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL66-.LVL64
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.LVL64
+	.uleb128 .LVL79-.LVL64
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL64
+	.uleb128 .LVL131-.LVL64
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL64
+	.uleb128 .LVL139-.LVL64
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU168
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU216
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+	.uleb128 .LVU433
+	.uleb128 .LVU447
+.LLST56:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL65-.LVL64
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.LVL64
+	.uleb128 .LVL79-.LVL64
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL64
+	.uleb128 .LVL131-.LVL64
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL64
+	.uleb128 .LVL139-.LVL64
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU168
+	.uleb128 .LVU216
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+	.uleb128 .LVU433
+	.uleb128 .LVU447
+.LLST57:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL79-.LVL64
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-.LVL64
+	.uleb128 .LVL131-.LVL64
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-.LVL64
+	.uleb128 .LVL139-.LVL64
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+	.uleb128 .LVU396
+	.uleb128 .LVU398
+	.uleb128 .LVU441
+	.uleb128 .LVU447
+.LLST58:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL76-.LVL76
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.LVL76
+	.uleb128 .LVL131-.LVL76
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.LVL76
+	.uleb128 .LVL139-.LVL76
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU172
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU216
+	.uleb128 .LVU390
+	.uleb128 .LVU398
+	.uleb128 .LVU433
+	.uleb128 .LVU447
+.LLST59:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL66-.LVL64
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.LVL64
+	.uleb128 .LVL77-.LVL64
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -8
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-.LVL64
+	.uleb128 .LVL78-.LVL64
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -8
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.LVL64
+	.uleb128 .LVL79-.LVL64
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -10
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL64
+	.uleb128 .LVL131-.LVL64
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -8
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL64
+	.uleb128 .LVL139-.LVL64
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -8
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU181
+	.uleb128 .LVU209
+	.uleb128 .LVU390
+	.uleb128 .LVU396
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST61:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL76-.LVL67
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-.LVL67
+	.uleb128 .LVL130-.LVL67
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-.LVL67
+	.uleb128 .LVL137-.LVL67
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU207
+	.uleb128 .LVU209
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+	.uleb128 .LVU433
+	.uleb128 .LVU435
+.LLST62:
+	.byte	0x8
+	.quad	.LVL76
+	.uleb128 .LVL76-.LVL76
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL130
+	.uleb128 .LVL130-.LVL130
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL137
+	.uleb128 .LVL137-.LVL137
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU183
+	.uleb128 .LVU207
+	.uleb128 .LVU390
+	.uleb128 .LVU394
+.LLST64:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL76-.LVL67
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-.LVL67
+	.uleb128 .LVL130-.LVL67
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+	.uleb128 .LVU207
+	.uleb128 .LVU390
+	.uleb128 .LVU394
+.LLST65:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL68-.LVL67
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.LVL67
+	.uleb128 .LVL76-.LVL67
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL129-.LVL67
+	.uleb128 .LVL130-.LVL67
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU184
+	.uleb128 .LVU187
+	.uleb128 .LVU188
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU203
+	.uleb128 .LVU390
+	.uleb128 .LVU394
+.LLST66:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL68-.LVL67
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.LVL67
+	.uleb128 .LVL70-.LVL67
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL67
+	.uleb128 .LVL71-.LVL67
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.LVL67
+	.uleb128 .LVL74-.LVL67
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.LVL67
+	.uleb128 .LVL75-.LVL67
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL67
+	.uleb128 .LVL130-.LVL67
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU195
+	.uleb128 .LVU207
+.LLST67:
+	.byte	0x8
+	.quad	.LVL72
+	.uleb128 .LVL76-.LVL72
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU247
+	.uleb128 .LVU249
+	.uleb128 .LVU388
+	.uleb128 .LVU390
+	.uleb128 .LVU427
+	.uleb128 .LVU433
+.LLST69:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL89-.LVL89
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.LVL89
+	.uleb128 .LVL129-.LVL89
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL89
+	.uleb128 .LVL137-.LVL89
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU216
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU254
+	.uleb128 .LVU383
+	.uleb128 .LVU390
+	.uleb128 .LVU419
+	.uleb128 .LVU433
+.LLST70:
+	.byte	0x6
+	.quad	.LVL79
+	.byte	0x4
+	.uleb128 .LVL79-.LVL79
+	.uleb128 .LVL90-.LVL79
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL79
+	.uleb128 .LVL91-.LVL79
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.LVL79
+	.uleb128 .LVL92-.LVL79
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -16
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL79
+	.uleb128 .LVL129-.LVL79
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.LVL79
+	.uleb128 .LVL137-.LVL79
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU219
+	.uleb128 .LVU247
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+.LLST72:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL89-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL127-.LVL80
+	.uleb128 .LVL128-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-.LVL80
+	.uleb128 .LVL135-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU245
+	.uleb128 .LVU247
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+.LLST73:
+	.byte	0x8
+	.quad	.LVL89
+	.uleb128 .LVL89-.LVL89
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL128
+	.uleb128 .LVL128-.LVL128
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL135
+	.uleb128 .LVL135-.LVL135
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU221
+	.uleb128 .LVU245
+	.uleb128 .LVU383
+	.uleb128 .LVU386
+.LLST75:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL89-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL127-.LVL80
+	.uleb128 .LVL128-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU226
+	.uleb128 .LVU245
+	.uleb128 .LVU383
+	.uleb128 .LVU386
+.LLST76:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.LVL80
+	.uleb128 .LVL89-.LVL80
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL127-.LVL80
+	.uleb128 .LVL128-.LVL80
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU222
+	.uleb128 .LVU225
+	.uleb128 .LVU226
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU383
+	.uleb128 .LVU386
+.LLST77:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.LVL80
+	.uleb128 .LVL83-.LVL80
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL80
+	.uleb128 .LVL84-.LVL80
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL80
+	.uleb128 .LVL87-.LVL80
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.LVL80
+	.uleb128 .LVL88-.LVL80
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL80
+	.uleb128 .LVL128-.LVL80
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU233
+	.uleb128 .LVU245
+.LLST78:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL89-.LVL85
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU284
+	.uleb128 .LVU286
+	.uleb128 .LVU404
+	.uleb128 .LVU406
+	.uleb128 .LVU413
+	.uleb128 .LVU419
+.LLST80:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL101-.LVL101
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.LVL101
+	.uleb128 .LVL133-.LVL101
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.LVL101
+	.uleb128 .LVL135-.LVL101
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU254
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU291
+	.uleb128 .LVU398
+	.uleb128 .LVU419
+.LLST81:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL102-.LVL92
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -22
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.LVL92
+	.uleb128 .LVL103-.LVL92
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -22
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL92
+	.uleb128 .LVL104-.LVL92
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -24
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL92
+	.uleb128 .LVL135-.LVL92
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -22
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU257
+	.uleb128 .LVU284
+	.uleb128 .LVU398
+	.uleb128 .LVU404
+	.uleb128 .LVU406
+	.uleb128 .LVU407
+.LLST83:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL101-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.LVL93
+	.uleb128 .LVL132-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL133-.LVL93
+	.uleb128 .LVL133-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU282
+	.uleb128 .LVU284
+	.uleb128 .LVU402
+	.uleb128 .LVU404
+	.uleb128 .LVU406
+	.uleb128 .LVU407
+.LLST84:
+	.byte	0x8
+	.quad	.LVL101
+	.uleb128 .LVL101-.LVL101
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL132
+	.uleb128 .LVL132-.LVL132
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL133
+	.uleb128 .LVL133-.LVL133
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU259
+	.uleb128 .LVU282
+	.uleb128 .LVU398
+	.uleb128 .LVU402
+.LLST86:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL101-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.LVL93
+	.uleb128 .LVL132-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU282
+	.uleb128 .LVU398
+	.uleb128 .LVU402
+.LLST87:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.LVL93
+	.uleb128 .LVL101-.LVL93
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL131-.LVL93
+	.uleb128 .LVL132-.LVL93
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU260
+	.uleb128 .LVU263
+	.uleb128 .LVU264
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU278
+	.uleb128 .LVU398
+	.uleb128 .LVU402
+.LLST88:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.LVL93
+	.uleb128 .LVL96-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.LVL93
+	.uleb128 .LVL99-.LVL93
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 0
+	.byte	0x20
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.LVL93
+	.uleb128 .LVL100-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL93
+	.uleb128 .LVL132-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU270
+	.uleb128 .LVU282
+.LLST89:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL101-.LVL97
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU320
+	.uleb128 .LVU322
+	.uleb128 .LVU335
+	.uleb128 .LVU342
+	.uleb128 .LVU455
+	.uleb128 .LVU461
+.LLST91:
+	.byte	0x6
+	.quad	.LVL109
+	.byte	0x4
+	.uleb128 .LVL109-.LVL109
+	.uleb128 .LVL109-.LVL109
+	.uleb128 0x9
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.LVL109
+	.uleb128 .LVL117-.LVL109
+	.uleb128 0x9
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.LVL109
+	.uleb128 .LVL141-.LVL109
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU291
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU329
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU342
+	.uleb128 .LVU447
+	.uleb128 .LVU461
+.LLST92:
+	.byte	0x6
+	.quad	.LVL104
+	.byte	0x4
+	.uleb128 .LVL104-.LVL104
+	.uleb128 .LVL110-.LVL104
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.LVL104
+	.uleb128 .LVL111-.LVL104
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.LVL104
+	.uleb128 .LVL112-.LVL104
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -30
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.LVL104
+	.uleb128 .LVL115-.LVL104
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.LVL104
+	.uleb128 .LVL116-.LVL104
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL104
+	.uleb128 .LVL117-.LVL104
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 -30
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.LVL104
+	.uleb128 .LVL141-.LVL104
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU294
+	.uleb128 .LVU320
+	.uleb128 .LVU329
+	.uleb128 .LVU335
+	.uleb128 .LVU447
+	.uleb128 .LVU449
+.LLST94:
+	.byte	0x6
+	.quad	.LVL105
+	.byte	0x4
+	.uleb128 .LVL105-.LVL105
+	.uleb128 .LVL109-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.LVL105
+	.uleb128 .LVL114-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL139-.LVL105
+	.uleb128 .LVL139-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU318
+	.uleb128 .LVU320
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU447
+	.uleb128 .LVU449
+.LLST95:
+	.byte	0x8
+	.quad	.LVL109
+	.uleb128 .LVL109-.LVL109
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL114
+	.uleb128 .LVL114-.LVL114
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL139
+	.uleb128 .LVL139-.LVL139
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU296
+	.uleb128 .LVU318
+	.uleb128 .LVU329
+	.uleb128 .LVU333
+.LLST97:
+	.byte	0x6
+	.quad	.LVL105
+	.byte	0x4
+	.uleb128 .LVL105-.LVL105
+	.uleb128 .LVL109-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.LVL105
+	.uleb128 .LVL114-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU318
+	.uleb128 .LVU329
+	.uleb128 .LVU333
+.LLST98:
+	.byte	0x6
+	.quad	.LVL105
+	.byte	0x4
+	.uleb128 .LVL105-.LVL105
+	.uleb128 .LVL106-.LVL105
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL106-.LVL105
+	.uleb128 .LVL109-.LVL105
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL113-.LVL105
+	.uleb128 .LVL114-.LVL105
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU297
+	.uleb128 .LVU300
+.LLST99:
+	.byte	0x8
+	.quad	.LVL105
+	.uleb128 .LVL106-.LVL105
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU306
+	.uleb128 .LVU318
+.LLST100:
+	.byte	0x8
+	.quad	.LVL107
+	.uleb128 .LVL109-.LVL107
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU344
+	.uleb128 .LVU346
+.LLST102:
+	.byte	0x8
+	.quad	.LVL117
+	.uleb128 .LVL118-.LVL117
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU344
+	.uleb128 .LVU383
+	.uleb128 .LVU461
+	.uleb128 0
+.LLST103:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL127-.LVL117
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL117
+	.uleb128 .LFE7-.LVL117
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 34
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU344
+	.uleb128 .LVU383
+	.uleb128 .LVU461
+	.uleb128 0
+.LLST104:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL127-.LVL117
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL117
+	.uleb128 .LFE7-.LVL117
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 34
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU344
+	.uleb128 .LVU383
+	.uleb128 .LVU461
+	.uleb128 0
+.LLST105:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL127-.LVL117
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL141-.LVL117
+	.uleb128 .LFE7-.LVL117
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU374
+	.uleb128 .LVU376
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST106:
+	.byte	0x6
+	.quad	.LVL123
+	.byte	0x4
+	.uleb128 .LVL123-.LVL123
+	.uleb128 .LVL123-.LVL123
+	.uleb128 0x9
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.LVL123
+	.uleb128 .LVL143-.LVL123
+	.uleb128 0x9
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL123
+	.uleb128 .LFE7-.LVL123
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU345
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU381
+	.uleb128 .LVU461
+	.uleb128 0
+.LLST107:
+	.byte	0x6
+	.quad	.LVL117
+	.byte	0x4
+	.uleb128 .LVL117-.LVL117
+	.uleb128 .LVL118-.LVL117
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.LVL117
+	.uleb128 .LVL124-.LVL117
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.LVL117
+	.uleb128 .LVL125-.LVL117
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.LVL117
+	.uleb128 .LVL126-.LVL117
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.LVL117
+	.uleb128 .LFE7-.LVL117
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU348
+	.uleb128 .LVU374
+	.uleb128 .LVU461
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+.LLST109:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL123-.LVL119
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL141-.LVL119
+	.uleb128 .LVL142-.LVL119
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL143-.LVL119
+	.uleb128 .LVL143-.LVL119
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU372
+	.uleb128 .LVU374
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+.LLST110:
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL123-.LVL123
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL142
+	.uleb128 .LVL142-.LVL142
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL143
+	.uleb128 .LVL143-.LVL143
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU350
+	.uleb128 .LVU372
+	.uleb128 .LVU461
+	.uleb128 .LVU465
+.LLST112:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL123-.LVL119
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL141-.LVL119
+	.uleb128 .LVL142-.LVL119
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU351
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU372
+	.uleb128 .LVU461
+	.uleb128 .LVU465
+.LLST113:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL120-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.LVL119
+	.uleb128 .LVL123-.LVL119
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL141-.LVL119
+	.uleb128 .LVL142-.LVL119
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU351
+	.uleb128 .LVU354
+.LLST114:
+	.byte	0x8
+	.quad	.LVL119
+	.uleb128 .LVL120-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU360
+	.uleb128 .LVU372
+.LLST115:
+	.byte	0x8
+	.quad	.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU37
+	.uleb128 .LVU128
+	.uleb128 .LVU133
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL14-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL0
+	.uleb128 .LVL51-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LFE3-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LFE3-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU3
+	.uleb128 .LVU37
+.LLST4:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL14-.LVL1
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU3
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU37
+.LLST5:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.LVL1
+	.uleb128 .LVL14-.LVL1
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU3
+	.uleb128 .LVU37
+.LLST6:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL14-.LVL1
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU3
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU37
+.LLST7:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL6-.LVL1
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.LVL1
+	.uleb128 .LVL7-.LVL1
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL1
+	.uleb128 .LVL10-.LVL1
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.LVL1
+	.uleb128 .LVL12-.LVL1
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL1
+	.uleb128 .LVL14-.LVL1
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU36
+.LLST8:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL2-.LVL1
+	.uleb128 .LVL11-.LVL1
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -8
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL1
+	.uleb128 .LVL13-.LVL1
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -10
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU20
+.LLST10:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LVL6-.LVL3
+	.uleb128 0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU12
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+.LLST11:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL6-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.LVL3
+	.uleb128 .LVL7-.LVL3
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL3
+	.uleb128 .LVL10-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.LVL3
+	.uleb128 .LVL12-.LVL3
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL3
+	.uleb128 .LVL13-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU17
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU34
+.LLST13:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL8-.LVL5
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.LVL5
+	.uleb128 .LVL13-.LVL5
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU17
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+.LLST14:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL5
+	.uleb128 .LVL10-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.LVL5
+	.uleb128 .LVL12-.LVL5
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LVL13-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU37
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU67
+.LLST15:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL18-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.LVL14
+	.uleb128 .LVL19-.LVL14
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL14
+	.uleb128 .LVL22-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.LVL14
+	.uleb128 .LVL24-.LVL14
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL14
+	.uleb128 .LVL26-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU37
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU66
+.LLST16:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL23-.LVL14
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL14
+	.uleb128 .LVL25-.LVL14
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -16
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU42
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU50
+.LLST18:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL18-.LVL15
+	.uleb128 0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU42
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU64
+.LLST19:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL18-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.LVL15
+	.uleb128 .LVL19-.LVL15
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL15
+	.uleb128 .LVL22-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.LVL15
+	.uleb128 .LVL24-.LVL15
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL15
+	.uleb128 .LVL25-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU47
+	.uleb128 .LVU54
+	.uleb128 .LVU56
+	.uleb128 .LVU64
+.LLST21:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL20-.LVL17
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL21-.LVL17
+	.uleb128 .LVL25-.LVL17
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU47
+	.uleb128 .LVU51
+	.uleb128 .LVU51
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU64
+.LLST22:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.LVL17
+	.uleb128 .LVL19-.LVL17
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL17
+	.uleb128 .LVL22-.LVL17
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.LVL17
+	.uleb128 .LVL24-.LVL17
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL17
+	.uleb128 .LVL25-.LVL17
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU67
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU97
+.LLST23:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.LVL26
+	.uleb128 .LVL31-.LVL26
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL26
+	.uleb128 .LVL34-.LVL26
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.LVL26
+	.uleb128 .LVL36-.LVL26
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL26
+	.uleb128 .LVL38-.LVL26
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU67
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU96
+.LLST24:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL35-.LVL26
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -22
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL26
+	.uleb128 .LVL37-.LVL26
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -24
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU72
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 .LVU80
+.LLST26:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL28-.LVL27
+	.uleb128 .LVL30-.LVL27
+	.uleb128 0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU72
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+.LLST27:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL30-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.LVL27
+	.uleb128 .LVL31-.LVL27
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL27
+	.uleb128 .LVL34-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.LVL27
+	.uleb128 .LVL36-.LVL27
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL27
+	.uleb128 .LVL37-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU77
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+	.uleb128 .LVU94
+.LLST29:
+	.byte	0x6
+	.quad	.LVL29
+	.byte	0x4
+	.uleb128 .LVL29-.LVL29
+	.uleb128 .LVL32-.LVL29
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL33-.LVL29
+	.uleb128 .LVL37-.LVL29
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+.LLST30:
+	.byte	0x6
+	.quad	.LVL29
+	.byte	0x4
+	.uleb128 .LVL29-.LVL29
+	.uleb128 .LVL30-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL29
+	.uleb128 .LVL34-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL34-.LVL29
+	.uleb128 .LVL36-.LVL29
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL29
+	.uleb128 .LVL37-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU97
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU128
+.LLST31:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL42-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL43-.LVL38
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL38
+	.uleb128 .LVL46-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.LVL38
+	.uleb128 .LVL48-.LVL38
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL38
+	.uleb128 .LVL50-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU97
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU126
+.LLST32:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL47-.LVL38
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -28
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL38
+	.uleb128 .LVL49-.LVL38
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 -30
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU102
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU110
+.LLST34:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL40-.LVL39
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL40-.LVL39
+	.uleb128 .LVL42-.LVL39
+	.uleb128 0x1c
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU102
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+.LLST35:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL42-.LVL39
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.LVL39
+	.uleb128 .LVL43-.LVL39
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL39
+	.uleb128 .LVL46-.LVL39
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.LVL39
+	.uleb128 .LVL48-.LVL39
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL39
+	.uleb128 .LVL49-.LVL39
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU107
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU124
+.LLST37:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL44-.LVL41
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL45-.LVL41
+	.uleb128 .LVL49-.LVL41
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU107
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+.LLST38:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL43-.LVL41
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL41
+	.uleb128 .LVL46-.LVL41
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.LVL41
+	.uleb128 .LVL48-.LVL41
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL41
+	.uleb128 .LVL49-.LVL41
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+.LLST39:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LVL51-.LVL50
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST40:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LFE3-.LVL50
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 34
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST41:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LFE3-.LVL50
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 34
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU130
+	.uleb128 .LVU145
+	.uleb128 .LVU158
+	.uleb128 .LVU161
+.LLST42:
+	.byte	0x6
+	.quad	.LVL50
+	.byte	0x4
+	.uleb128 .LVL50-.LVL50
+	.uleb128 .LVL55-.LVL50
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.LVL50
+	.uleb128 .LVL62-.LVL50
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 .LVU155
+	.uleb128 .LVU155
+	.uleb128 .LVU160
+.LLST43:
+	.byte	0x6
+	.quad	.LVL50
+	.byte	0x4
+	.uleb128 .LVL50-.LVL50
+	.uleb128 .LVL51-.LVL50
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.LVL50
+	.uleb128 .LVL59-.LVL50
+	.uleb128 0x5
+	.byte	0x78
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL50
+	.uleb128 .LVL61-.LVL50
+	.uleb128 0x5
+	.byte	0x78
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU137
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU145
+.LLST45:
+	.byte	0x6
+	.quad	.LVL52
+	.byte	0x4
+	.uleb128 .LVL52-.LVL52
+	.uleb128 .LVL53-.LVL52
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL53-.LVL52
+	.uleb128 .LVL55-.LVL52
+	.uleb128 0x20
+	.byte	0x74
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x75
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU137
+	.uleb128 .LVU145
+.LLST46:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL55-.LVL52
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU142
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU158
+.LLST48:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL58-.LVL54
+	.uleb128 .LVL61-.LVL54
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU142
+	.uleb128 .LVU158
+.LLST49:
+	.byte	0x8
+	.quad	.LVL54
+	.uleb128 .LVL61-.LVL54
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x7c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB46
+	.byte	0x4
+	.uleb128 .LBB46-.LBB46
+	.uleb128 .LBE46-.LBB46
+	.byte	0x4
+	.uleb128 .LBB57-.LBB46
+	.uleb128 .LBE57-.LBB46
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB48
+	.byte	0x4
+	.uleb128 .LBB48-.LBB48
+	.uleb128 .LBE48-.LBB48
+	.byte	0x4
+	.uleb128 .LBB55-.LBB48
+	.uleb128 .LBE55-.LBB48
+	.byte	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB50
+	.byte	0x4
+	.uleb128 .LBB50-.LBB50
+	.uleb128 .LBE50-.LBB50
+	.byte	0x4
+	.uleb128 .LBB53-.LBB50
+	.uleb128 .LBE53-.LBB50
+	.byte	0
+.LLRL17:
+	.byte	0x5
+	.quad	.LBB60
+	.byte	0x4
+	.uleb128 .LBB60-.LBB60
+	.uleb128 .LBE60-.LBB60
+	.byte	0x4
+	.uleb128 .LBB67-.LBB60
+	.uleb128 .LBE67-.LBB60
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB62
+	.byte	0x4
+	.uleb128 .LBB62-.LBB62
+	.uleb128 .LBE62-.LBB62
+	.byte	0x4
+	.uleb128 .LBB65-.LBB62
+	.uleb128 .LBE65-.LBB62
+	.byte	0
+.LLRL25:
+	.byte	0x5
+	.quad	.LBB70
+	.byte	0x4
+	.uleb128 .LBB70-.LBB70
+	.uleb128 .LBE70-.LBB70
+	.byte	0x4
+	.uleb128 .LBB77-.LBB70
+	.uleb128 .LBE77-.LBB70
+	.byte	0
+.LLRL28:
+	.byte	0x5
+	.quad	.LBB72
+	.byte	0x4
+	.uleb128 .LBB72-.LBB72
+	.uleb128 .LBE72-.LBB72
+	.byte	0x4
+	.uleb128 .LBB75-.LBB72
+	.uleb128 .LBE75-.LBB72
+	.byte	0
+.LLRL33:
+	.byte	0x5
+	.quad	.LBB80
+	.byte	0x4
+	.uleb128 .LBB80-.LBB80
+	.uleb128 .LBE80-.LBB80
+	.byte	0x4
+	.uleb128 .LBB87-.LBB80
+	.uleb128 .LBE87-.LBB80
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB82
+	.byte	0x4
+	.uleb128 .LBB82-.LBB82
+	.uleb128 .LBE82-.LBB82
+	.byte	0x4
+	.uleb128 .LBB85-.LBB82
+	.uleb128 .LBE85-.LBB82
+	.byte	0
+.LLRL44:
+	.byte	0x5
+	.quad	.LBB90
+	.byte	0x4
+	.uleb128 .LBB90-.LBB90
+	.uleb128 .LBE90-.LBB90
+	.byte	0x4
+	.uleb128 .LBB97-.LBB90
+	.uleb128 .LBE97-.LBB90
+	.byte	0
+.LLRL47:
+	.byte	0x5
+	.quad	.LBB92
+	.byte	0x4
+	.uleb128 .LBB92-.LBB92
+	.uleb128 .LBE92-.LBB92
+	.byte	0x4
+	.uleb128 .LBB95-.LBB92
+	.uleb128 .LBE95-.LBB92
+	.byte	0
+.LLRL53:
+	.byte	0x5
+	.quad	.LBB128
+	.byte	0x4
+	.uleb128 .LBB128-.LBB128
+	.uleb128 .LBE128-.LBB128
+	.byte	0x4
+	.uleb128 .LBB162-.LBB128
+	.uleb128 .LBE162-.LBB128
+	.byte	0x4
+	.uleb128 .LBB163-.LBB128
+	.uleb128 .LBE163-.LBB128
+	.byte	0x4
+	.uleb128 .LBB164-.LBB128
+	.uleb128 .LBE164-.LBB128
+	.byte	0x4
+	.uleb128 .LBB165-.LBB128
+	.uleb128 .LBE165-.LBB128
+	.byte	0x4
+	.uleb128 .LBB240-.LBB128
+	.uleb128 .LBE240-.LBB128
+	.byte	0x4
+	.uleb128 .LBB243-.LBB128
+	.uleb128 .LBE243-.LBB128
+	.byte	0
+.LLRL60:
+	.byte	0x5
+	.quad	.LBB130
+	.byte	0x4
+	.uleb128 .LBB130-.LBB130
+	.uleb128 .LBE130-.LBB130
+	.byte	0x4
+	.uleb128 .LBB150-.LBB130
+	.uleb128 .LBE150-.LBB130
+	.byte	0x4
+	.uleb128 .LBB151-.LBB130
+	.uleb128 .LBE151-.LBB130
+	.byte	0x4
+	.uleb128 .LBB152-.LBB130
+	.uleb128 .LBE152-.LBB130
+	.byte	0x4
+	.uleb128 .LBB153-.LBB130
+	.uleb128 .LBE153-.LBB130
+	.byte	0x4
+	.uleb128 .LBB154-.LBB130
+	.uleb128 .LBE154-.LBB130
+	.byte	0x4
+	.uleb128 .LBB155-.LBB130
+	.uleb128 .LBE155-.LBB130
+	.byte	0
+.LLRL63:
+	.byte	0x5
+	.quad	.LBB132
+	.byte	0x4
+	.uleb128 .LBB132-.LBB132
+	.uleb128 .LBE132-.LBB132
+	.byte	0x4
+	.uleb128 .LBB139-.LBB132
+	.uleb128 .LBE139-.LBB132
+	.byte	0x4
+	.uleb128 .LBB140-.LBB132
+	.uleb128 .LBE140-.LBB132
+	.byte	0x4
+	.uleb128 .LBB141-.LBB132
+	.uleb128 .LBE141-.LBB132
+	.byte	0x4
+	.uleb128 .LBB142-.LBB132
+	.uleb128 .LBE142-.LBB132
+	.byte	0x4
+	.uleb128 .LBB143-.LBB132
+	.uleb128 .LBE143-.LBB132
+	.byte	0
+.LLRL68:
+	.byte	0x5
+	.quad	.LBB166
+	.byte	0x4
+	.uleb128 .LBB166-.LBB166
+	.uleb128 .LBE166-.LBB166
+	.byte	0x4
+	.uleb128 .LBB239-.LBB166
+	.uleb128 .LBE239-.LBB166
+	.byte	0x4
+	.uleb128 .LBB242-.LBB166
+	.uleb128 .LBE242-.LBB166
+	.byte	0
+.LLRL71:
+	.byte	0x5
+	.quad	.LBB168
+	.byte	0x4
+	.uleb128 .LBB168-.LBB168
+	.uleb128 .LBE168-.LBB168
+	.byte	0x4
+	.uleb128 .LBB179-.LBB168
+	.uleb128 .LBE179-.LBB168
+	.byte	0x4
+	.uleb128 .LBB180-.LBB168
+	.uleb128 .LBE180-.LBB168
+	.byte	0x4
+	.uleb128 .LBB181-.LBB168
+	.uleb128 .LBE181-.LBB168
+	.byte	0
+.LLRL74:
+	.byte	0x5
+	.quad	.LBB170
+	.byte	0x4
+	.uleb128 .LBB170-.LBB170
+	.uleb128 .LBE170-.LBB170
+	.byte	0x4
+	.uleb128 .LBB174-.LBB170
+	.uleb128 .LBE174-.LBB170
+	.byte	0x4
+	.uleb128 .LBB175-.LBB170
+	.uleb128 .LBE175-.LBB170
+	.byte	0
+.LLRL79:
+	.byte	0x5
+	.quad	.LBB184
+	.byte	0x4
+	.uleb128 .LBB184-.LBB184
+	.uleb128 .LBE184-.LBB184
+	.byte	0x4
+	.uleb128 .LBB241-.LBB184
+	.uleb128 .LBE241-.LBB184
+	.byte	0
+.LLRL82:
+	.byte	0x5
+	.quad	.LBB186
+	.byte	0x4
+	.uleb128 .LBB186-.LBB186
+	.uleb128 .LBE186-.LBB186
+	.byte	0x4
+	.uleb128 .LBB197-.LBB186
+	.uleb128 .LBE197-.LBB186
+	.byte	0x4
+	.uleb128 .LBB198-.LBB186
+	.uleb128 .LBE198-.LBB186
+	.byte	0x4
+	.uleb128 .LBB199-.LBB186
+	.uleb128 .LBE199-.LBB186
+	.byte	0
+.LLRL85:
+	.byte	0x5
+	.quad	.LBB188
+	.byte	0x4
+	.uleb128 .LBB188-.LBB188
+	.uleb128 .LBE188-.LBB188
+	.byte	0x4
+	.uleb128 .LBB192-.LBB188
+	.uleb128 .LBE192-.LBB188
+	.byte	0x4
+	.uleb128 .LBB193-.LBB188
+	.uleb128 .LBE193-.LBB188
+	.byte	0
+.LLRL90:
+	.byte	0x5
+	.quad	.LBB201
+	.byte	0x4
+	.uleb128 .LBB201-.LBB201
+	.uleb128 .LBE201-.LBB201
+	.byte	0x4
+	.uleb128 .LBB237-.LBB201
+	.uleb128 .LBE237-.LBB201
+	.byte	0x4
+	.uleb128 .LBB244-.LBB201
+	.uleb128 .LBE244-.LBB201
+	.byte	0
+.LLRL93:
+	.byte	0x5
+	.quad	.LBB203
+	.byte	0x4
+	.uleb128 .LBB203-.LBB203
+	.uleb128 .LBE203-.LBB203
+	.byte	0x4
+	.uleb128 .LBB214-.LBB203
+	.uleb128 .LBE214-.LBB203
+	.byte	0x4
+	.uleb128 .LBB215-.LBB203
+	.uleb128 .LBE215-.LBB203
+	.byte	0x4
+	.uleb128 .LBB216-.LBB203
+	.uleb128 .LBE216-.LBB203
+	.byte	0
+.LLRL96:
+	.byte	0x5
+	.quad	.LBB205
+	.byte	0x4
+	.uleb128 .LBB205-.LBB205
+	.uleb128 .LBE205-.LBB205
+	.byte	0x4
+	.uleb128 .LBB209-.LBB205
+	.uleb128 .LBE209-.LBB205
+	.byte	0x4
+	.uleb128 .LBB210-.LBB205
+	.uleb128 .LBE210-.LBB205
+	.byte	0
+.LLRL101:
+	.byte	0x5
+	.quad	.LBB219
+	.byte	0x4
+	.uleb128 .LBB219-.LBB219
+	.uleb128 .LBE219-.LBB219
+	.byte	0x4
+	.uleb128 .LBB238-.LBB219
+	.uleb128 .LBE238-.LBB219
+	.byte	0x4
+	.uleb128 .LBB245-.LBB219
+	.uleb128 .LBE245-.LBB219
+	.byte	0
+.LLRL108:
+	.byte	0x5
+	.quad	.LBB221
+	.byte	0x4
+	.uleb128 .LBB221-.LBB221
+	.uleb128 .LBE221-.LBB221
+	.byte	0x4
+	.uleb128 .LBB232-.LBB221
+	.uleb128 .LBE232-.LBB221
+	.byte	0x4
+	.uleb128 .LBB233-.LBB221
+	.uleb128 .LBE233-.LBB221
+	.byte	0x4
+	.uleb128 .LBB234-.LBB221
+	.uleb128 .LBE234-.LBB221
+	.byte	0
+.LLRL111:
+	.byte	0x5
+	.quad	.LBB223
+	.byte	0x4
+	.uleb128 .LBB223-.LBB223
+	.uleb128 .LBE223-.LBB223
+	.byte	0x4
+	.uleb128 .LBB227-.LBB223
+	.uleb128 .LBE227-.LBB223
+	.byte	0x4
+	.uleb128 .LBB228-.LBB223
+	.uleb128 .LBE228-.LBB223
+	.byte	0
+.LLRL124:
+	.byte	0x5
+	.quad	.LBB262
+	.byte	0x4
+	.uleb128 .LBB262-.LBB262
+	.uleb128 .LBE262-.LBB262
+	.byte	0x4
+	.uleb128 .LBB265-.LBB262
+	.uleb128 .LBE265-.LBB262
+	.byte	0
+.LLRL127:
+	.byte	0x5
+	.quad	.LBB266
+	.byte	0x4
+	.uleb128 .LBB266-.LBB266
+	.uleb128 .LBE266-.LBB266
+	.byte	0x4
+	.uleb128 .LBB271-.LBB266
+	.uleb128 .LBE271-.LBB266
+	.byte	0x4
+	.uleb128 .LBB288-.LBB266
+	.uleb128 .LBE288-.LBB266
+	.byte	0x4
+	.uleb128 .LBB289-.LBB266
+	.uleb128 .LBE289-.LBB266
+	.byte	0
+.LLRL131:
+	.byte	0x5
+	.quad	.LBB272
+	.byte	0x4
+	.uleb128 .LBB272-.LBB272
+	.uleb128 .LBE272-.LBB272
+	.byte	0x4
+	.uleb128 .LBB278-.LBB272
+	.uleb128 .LBE278-.LBB272
+	.byte	0
+.LLRL134:
+	.byte	0x5
+	.quad	.LBB275
+	.byte	0x4
+	.uleb128 .LBB275-.LBB275
+	.uleb128 .LBE275-.LBB275
+	.byte	0x4
+	.uleb128 .LBB279-.LBB275
+	.uleb128 .LBE279-.LBB275
+	.byte	0
+.LLRL137:
+	.byte	0x5
+	.quad	.LBB280
+	.byte	0x4
+	.uleb128 .LBB280-.LBB280
+	.uleb128 .LBE280-.LBB280
+	.byte	0x4
+	.uleb128 .LBB287-.LBB280
+	.uleb128 .LBE287-.LBB280
+	.byte	0
+.LLRL140:
+	.byte	0x5
+	.quad	.LBB282
+	.byte	0x4
+	.uleb128 .LBB282-.LBB282
+	.uleb128 .LBE282-.LBB282
+	.byte	0x4
+	.uleb128 .LBB285-.LBB282
+	.uleb128 .LBE285-.LBB282
+	.byte	0
+.LLRL153:
+	.byte	0x5
+	.quad	.LBB306
+	.byte	0x4
+	.uleb128 .LBB306-.LBB306
+	.uleb128 .LBE306-.LBB306
+	.byte	0x4
+	.uleb128 .LBB345-.LBB306
+	.uleb128 .LBE345-.LBB306
+	.byte	0x4
+	.uleb128 .LBB349-.LBB306
+	.uleb128 .LBE349-.LBB306
+	.byte	0
+.LLRL157:
+	.byte	0x5
+	.quad	.LBB310
+	.byte	0x4
+	.uleb128 .LBB310-.LBB310
+	.uleb128 .LBE310-.LBB310
+	.byte	0x4
+	.uleb128 .LBB313-.LBB310
+	.uleb128 .LBE313-.LBB310
+	.byte	0
+.LLRL160:
+	.byte	0x5
+	.quad	.LBB314
+	.byte	0x4
+	.uleb128 .LBB314-.LBB314
+	.uleb128 .LBE314-.LBB314
+	.byte	0x4
+	.uleb128 .LBB325-.LBB314
+	.uleb128 .LBE325-.LBB314
+	.byte	0x4
+	.uleb128 .LBB346-.LBB314
+	.uleb128 .LBE346-.LBB314
+	.byte	0x4
+	.uleb128 .LBB347-.LBB314
+	.uleb128 .LBE347-.LBB314
+	.byte	0
+.LLRL162:
+	.byte	0x5
+	.quad	.LBB316
+	.byte	0x4
+	.uleb128 .LBB316-.LBB316
+	.uleb128 .LBE316-.LBB316
+	.byte	0x4
+	.uleb128 .LBB320-.LBB316
+	.uleb128 .LBE320-.LBB316
+	.byte	0x4
+	.uleb128 .LBB321-.LBB316
+	.uleb128 .LBE321-.LBB316
+	.byte	0
+.LLRL167:
+	.byte	0x5
+	.quad	.LBB326
+	.byte	0x4
+	.uleb128 .LBB326-.LBB326
+	.uleb128 .LBE326-.LBB326
+	.byte	0x4
+	.uleb128 .LBB344-.LBB326
+	.uleb128 .LBE344-.LBB326
+	.byte	0x4
+	.uleb128 .LBB348-.LBB326
+	.uleb128 .LBE348-.LBB326
+	.byte	0
+.LLRL171:
+	.byte	0x5
+	.quad	.LBB330
+	.byte	0x4
+	.uleb128 .LBB330-.LBB330
+	.uleb128 .LBE330-.LBB330
+	.byte	0x4
+	.uleb128 .LBB334-.LBB330
+	.uleb128 .LBE334-.LBB330
+	.byte	0x4
+	.uleb128 .LBB343-.LBB330
+	.uleb128 .LBE343-.LBB330
+	.byte	0
+.LLRL177:
+	.byte	0x5
+	.quad	.LBB337
+	.byte	0x4
+	.uleb128 .LBB337-.LBB337
+	.uleb128 .LBE337-.LBB337
+	.byte	0x4
+	.uleb128 .LBB341-.LBB337
+	.uleb128 .LBE341-.LBB337
+	.byte	0x4
+	.uleb128 .LBB342-.LBB337
+	.uleb128 .LBE342-.LBB337
+	.byte	0
+.LLRL181:
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.file 11 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF728
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox_encoding.h.22.3c84c4885cb0eeaab86256bf50e23944,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF727
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF772:
+	.string	"overrun"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF745:
+	.string	"size_t"
+.LASF779:
+	.string	"zeroFrame"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF746:
+	.string	"loopIteration"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF791:
+	.string	"isMarker"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF742:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF741:
+	.string	"int16_t"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF786:
+	.string	"encoder"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF748:
+	.string	"axisPID"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF809:
+	.string	"readFields"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF749:
+	.string	"rcCommand"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF715:
+	.string	"NULL"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF802:
+	.string	"readUnsignedVB"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF768:
+	.string	"blackboxReader_s"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF739:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF758:
+	.string	"frameIndex"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF759:
+	.string	"history"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF733:
+	.string	"signed char"
+.LASF743:
+	.string	"uint8_t"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF805:
+	.string	"writeSignedVB"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF729:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF803:
+	.string	"byteIndex"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF774:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF799:
+	.string	"value"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF726:
+	.string	"BLACKBOX_MARKER_INTER_FRAME 'P'"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF783:
+	.string	"marker"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF810:
+	.string	"writeFields"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF766:
+	.string	"blackboxDecoder_s"
+.LASF767:
+	.string	"blackboxDecoder_t"
+.LASF789:
+	.string	"blackboxEncoderInit"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF390:
+	.string	"bool _Bool"
+.LASF763:
+	.string	"BLACKBOX_DECODE_INCOMPLETE"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF734:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF787:
+	.string	"buffer"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF806:
+	.string	"writeUnsignedVB"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF785:
+	.string	"blackboxEncodeFrame"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF780:
+	.string	"reader"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF800:
+	.string	"index"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF738:
+	.string	"__uint32_t"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF724:
+	.string	"BLACKBOX_MARKER_HEADER 'H'"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF728:
+	.string	"VB_MAX_BYTES 5"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF776:
+	.string	"decoder"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF725:
+	.string	"BLACKBOX_MARKER_INTRA_FRAME 'I'"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF777:
+	.string	"frame"
+.LASF462:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF798:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF731:
+	.string	"unsigned int"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF771:
+	.string	"position"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF793:
+	.string	"prediction"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF755:
+	.string	"blackboxEncoder_s"
+.LASF760:
+	.string	"blackboxEncoder_t"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF794:
+	.string	"pushHistory"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF797:
+	.string	"predictions"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF764:
+	.string	"BLACKBOX_DECODE_CORRUPT"
+.LASF740:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF765:
+	.string	"blackboxDecodeResult_e"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF781:
+	.string	"previous"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF730:
+	.string	"short unsigned int"
+.LASF762:
+	.string	"BLACKBOX_DECODE_SKIPPED"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF782:
+	.string	"iterationDelta"
+.LASF801:
+	.string	"readSignedVB"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF778:
+	.string	"consumed"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF804:
+	.string	"writeFieldDeltas"
+.LASF761:
+	.string	"BLACKBOX_DECODE_FRAME"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF379:
+	.string	"SITL 1"
+.LASF723:
+	.string	"BLACKBOX_I_INTERVAL 32"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF770:
+	.string	"length"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF756:
+	.string	"motorCount"
+.LASF757:
+	.string	"historyLength"
+.LASF732:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF784:
+	.string	"blackboxDecodeFrame"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF807:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF773:
+	.string	"malformed"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF808:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF727:
+	.string	"BLACKBOX_MAX_FRAME_SIZE (1 + 5 + 5 + (3 + 4 + 3 + 3 + BLACKBOX_MAX_MOTORS) * 3)"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF735:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF754:
+	.string	"blackboxFrame_s"
+.LASF792:
+	.string	"predictTime"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF796:
+	.string	"values"
+.LASF775:
+	.string	"blackboxReader_t"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF750:
+	.string	"gyroData"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF795:
+	.string	"readFieldDeltas"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF751:
+	.string	"accSmooth"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF790:
+	.string	"byte"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF736:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF752:
+	.string	"motor"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF722:
+	.string	"BLACKBOX_MAX_MOTORS 8"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF744:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF753:
+	.string	"blackboxFrame_t"
+.LASF747:
+	.string	"time"
+.LASF737:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF721:
+	.string	"BLACKBOX_DATA_VERSION 1"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF769:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF788:
+	.string	"blackboxDecoderInit"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/blackbox/blackbox_encoding.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4760 @@
+	.file	"boot_timing.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/boot_timing.c"
+	.section	.text.bootStageEnd,"ax",@progbits
+	.p2align 4
+	.globl	bootStageEnd
+	.type	bootStageEnd, @function
+bootStageEnd:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/common/boot_timing.c"
+	.loc 1 45 1 view -0
+	.cfi_startproc
+	.loc 1 46 5 view .LVU1
+	.loc 1 45 1 is_stmt 0 view .LVU2
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 45 1 view .LVU3
+	movl	%edi, %ebx
+	.loc 1 46 31 view .LVU4
+	call	millis@PLT
+.LVL1:
+	.loc 1 46 29 view .LVU5
+	movl	%ebx, %edx
+	.loc 1 46 31 view .LVU6
+	movl	%eax, %ecx
+	.loc 1 46 29 view .LVU7
+	leaq	bootStageEndedAt(%rip), %rax
+	movl	%ecx, (%rax,%rdx,4)
+	.loc 1 48 5 is_stmt 1 view .LVU8
+	.loc 1 48 8 is_stmt 0 view .LVU9
+	cmpl	$6, %ebx
+	je	.L5
+	.loc 1 51 1 view .LVU10
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL2:
+	.loc 1 51 1 view .LVU11
+	ret
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.cfi_restore_state
+	.loc 1 49 9 is_stmt 1 view .LVU12
+	.loc 1 49 22 is_stmt 0 view .LVU13
+	movb	$1, bootComplete(%rip)
+	.loc 1 51 1 view .LVU14
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL4:
+	.loc 1 51 1 view .LVU15
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	bootStageEnd, .-bootStageEnd
+	.section	.text.isBootComplete,"ax",@progbits
+	.p2align 4
+	.globl	isBootComplete
+	.type	isBootComplete, @function
+isBootComplete:
+.LFB1:
+	.loc 1 54 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 55 5 view .LVU17
+	.loc 1 56 1 is_stmt 0 view .LVU18
+	movzbl	bootComplete(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	isBootComplete, .-isBootComplete
+	.section	.text.getBootStageName,"ax",@progbits
+	.p2align 4
+	.globl	getBootStageName
+	.type	getBootStageName, @function
+getBootStageName:
+.LVL5:
+.LFB2:
+	.loc 1 59 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 60 5 view .LVU20
+	.loc 1 60 26 is_stmt 0 view .LVU21
+	movl	%edi, %edi
+	.loc 1 60 26 view .LVU22
+	leaq	bootStageNames(%rip), %rax
+	movq	(%rax,%rdi,8), %rax
+	.loc 1 61 1 view .LVU23
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	getBootStageName, .-getBootStageName
+	.section	.text.getBootStageMilliseconds,"ax",@progbits
+	.p2align 4
+	.globl	getBootStageMilliseconds
+	.type	getBootStageMilliseconds, @function
+getBootStageMilliseconds:
+.LVL6:
+.LFB3:
+	.loc 1 64 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 65 5 view .LVU25
+	.loc 1 65 8 is_stmt 0 view .LVU26
+	testl	%edi, %edi
+	je	.L12
+	.loc 1 68 5 is_stmt 1 view .LVU27
+	.loc 1 68 25 is_stmt 0 view .LVU28
+	leaq	bootStageEndedAt(%rip), %rax
+	movl	%edi, %edx
+	movl	(%rax,%rdx,4), %ecx
+	.loc 1 68 51 view .LVU29
+	leal	-1(%rdi), %edx
+	movl	(%rax,%rdx,4), %edx
+	.loc 1 71 36 view .LVU30
+	movl	%ecx, %eax
+	subl	%edx, %eax
+	cmpl	%edx, %ecx
+	movl	$0, %edx
+	cmovb	%edx, %eax
+	.loc 1 72 1 view .LVU31
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 66 9 is_stmt 1 view .LVU32
+	.loc 1 66 32 is_stmt 0 view .LVU33
+	movl	bootStageEndedAt(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	getBootStageMilliseconds, .-getBootStageMilliseconds
+	.section	.bss.bootComplete,"aw",@nobits
+	.type	bootComplete, @object
+	.size	bootComplete, 1
+bootComplete:
+	.zero	1
+	.section	.bss.bootStageEndedAt,"aw",@nobits
+	.align 16
+	.type	bootStageEndedAt, @object
+	.size	bootStageEndedAt, 28
+bootStageEndedAt:
+	.zero	28
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"system"
+.LC1:
+	.string	"buses"
+.LC2:
+	.string	"sensors"
+.LC3:
+	.string	"signal"
+.LC4:
+	.string	"outputs"
+.LC5:
+	.string	"features"
+.LC6:
+	.string	"calibration"
+	.section	.data.rel.ro.local.bootStageNames,"aw"
+	.align 32
+	.type	bootStageNames, @object
+	.size	bootStageNames, 56
+bootStageNames:
+	.quad	.LC0
+	.quad	.LC1
+	.quad	.LC2
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 ".//src/main/common/boot_timing.h"
+	.file 5 ".//src/main/drivers/system.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x20a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xa
+	.long	.LASF748
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL1
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF722
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF723
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF724
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF725
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF726
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF727
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF730
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF728
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF729
+	.uleb128 0x4
+	.long	0x72
+	.uleb128 0x3
+	.long	.LASF731
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x5f
+	.uleb128 0xc
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x4
+	.byte	0x15
+	.byte	0xe
+	.long	0xc9
+	.uleb128 0x2
+	.long	.LASF732
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF733
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF734
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF735
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF736
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF739
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF740
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x3
+	.long	0x8a
+	.uleb128 0x6
+	.long	0xef
+	.long	0xe4
+	.uleb128 0x7
+	.long	0x43
+	.byte	0
+	.uleb128 0x4
+	.long	0xd5
+	.uleb128 0xd
+	.byte	0x8
+	.long	0x79
+	.uleb128 0x4
+	.long	0xe9
+	.uleb128 0x5
+	.long	.LASF741
+	.byte	0x1b
+	.byte	0x1b
+	.long	0xe4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bootStageNames
+	.uleb128 0x6
+	.long	0x7e
+	.long	0x118
+	.uleb128 0x7
+	.long	0x43
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF742
+	.byte	0x25
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bootStageEndedAt
+	.uleb128 0x5
+	.long	.LASF743
+	.byte	0x26
+	.byte	0xc
+	.long	0x142
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bootComplete
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF744
+	.uleb128 0xe
+	.long	.LASF749
+	.byte	0x5
+	.byte	0x19
+	.byte	0xa
+	.long	0x7e
+	.uleb128 0x8
+	.long	.LASF745
+	.byte	0x3f
+	.byte	0xa
+	.long	0x7e
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x184
+	.uleb128 0x9
+	.long	.LASF747
+	.byte	0x3f
+	.byte	0x2f
+	.long	0xc9
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF746
+	.byte	0x3a
+	.byte	0xd
+	.long	0xe9
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b3
+	.uleb128 0x9
+	.long	.LASF747
+	.byte	0x3a
+	.byte	0x2a
+	.long	0xc9
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF750
+	.byte	0x1
+	.byte	0x35
+	.byte	0x5
+	.long	0x142
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x10
+	.long	.LASF751
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x6
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x11
+	.long	.LASF747
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x1f
+	.long	0xc9
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x12
+	.quad	.LVL1
+	.long	0x149
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 6
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x5c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 6 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 23 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.file 24 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 25 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF702
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF721
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF747:
+	.string	"stage"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF715:
+	.string	"USE_USART2 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"millis"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF379:
+	.string	"SITL 1"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF724:
+	.string	"unsigned int"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF698:
+	.string	"__disable_irq() "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF693:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF732:
+	.string	"BOOT_STAGE_SYSTEM"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF735:
+	.string	"BOOT_STAGE_SIGNAL"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF731:
+	.string	"uint32_t"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF721:
+	.string	"FAST_MATH "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF718:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF700:
+	.string	"U_ID_0 0x5349544c"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF743:
+	.string	"bootComplete"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF701:
+	.string	"U_ID_1 0"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF697:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF508:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF708:
+	.string	"GYRO "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF744:
+	.string	"_Bool"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF695:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF746:
+	.string	"getBootStageName"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF714:
+	.string	"USE_USART1 "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF729:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF707:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF696:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF23:
+	.string	"_LP64 1"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF549:
+	.string	"__stub_stty "
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF751:
+	.string	"bootStageEnd"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF462:
+	.string	"__PMT"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF699:
+	.string	"__enable_irq() "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF706:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF710:
+	.string	"ACC "
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF717:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF740:
+	.string	"bootStage_e"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF737:
+	.string	"BOOT_STAGE_FEATURES"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF712:
+	.string	"BARO "
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF741:
+	.string	"bootStageNames"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF704:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF702:
+	.string	"U_ID_2 0"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF705:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF727:
+	.string	"short int"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF728:
+	.string	"long int"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF738:
+	.string	"BOOT_STAGE_CALIBRATION"
+.LASF371:
+	.string	"__linux 1"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF711:
+	.string	"USE_ACC_SITL "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF391:
+	.string	"true 1"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF739:
+	.string	"BOOT_STAGE_COUNT"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF734:
+	.string	"BOOT_STAGE_SENSORS"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF713:
+	.string	"USE_BARO_SITL "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF472:
+	.string	"__P(args) args"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF725:
+	.string	"long unsigned int"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF374:
+	.string	"__unix 1"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF703:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF716:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF358:
+	.string	"__k8 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF722:
+	.string	"unsigned char"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF730:
+	.string	"__uint32_t"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF748:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF733:
+	.string	"BOOT_STAGE_BUSES"
+.LASF736:
+	.string	"BOOT_STAGE_OUTPUTS"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF750:
+	.string	"isBootComplete"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF745:
+	.string	"getBootStageMilliseconds"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF509:
+	.string	"__always_inline"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF709:
+	.string	"USE_GYRO_SITL "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF719:
+	.string	"BLACKBOX "
+.LASF742:
+	.string	"bootStageEndedAt"
+.LASF726:
+	.string	"signed char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF723:
+	.string	"short unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF694:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF720:
+	.string	"PROFILING "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF392:
+	.string	"false 0"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF376:
+	.string	"unix 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/common/boot_timing.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
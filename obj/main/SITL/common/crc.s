@@ -0,0 +1,5234 @@
+	.file	"crc.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/crc.c"
+	.section	.text.crc8DvbS2,"ax",@progbits
+	.p2align 4
+	.globl	crc8DvbS2
+	.type	crc8DvbS2, @function
+crc8DvbS2:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/common/crc.c"
+	.loc 1 73 1 view -0
+	.cfi_startproc
+	.loc 1 74 5 view .LVU1
+	.loc 1 74 9 is_stmt 0 view .LVU2
+	movl	%esi, %eax
+	movl	$8, %ecx
+	xorl	%edi, %eax
+.LVL1:
+	.loc 1 75 5 is_stmt 1 view .LVU3
+.LBB5:
+	.loc 1 75 10 view .LVU4
+	.loc 1 75 27 view .LVU5
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 76 9 view .LVU6
+	.loc 1 77 17 is_stmt 0 view .LVU7
+	leal	(%rax,%rax), %edx
+	leal	(%rax,%rax), %esi
+	xorl	$-43, %edx
+	testb	%al, %al
+	movl	%edx, %eax
+.LVL2:
+	.loc 1 77 17 view .LVU8
+	cmovns	%esi, %eax
+.LVL3:
+	.loc 1 75 35 is_stmt 1 view .LVU9
+	.loc 1 75 27 view .LVU10
+	subl	$1, %ecx
+	jne	.L4
+.LBE5:
+	.loc 1 82 5 view .LVU11
+	.loc 1 83 1 is_stmt 0 view .LVU12
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	crc8DvbS2, .-crc8DvbS2
+	.section	.text.crc8DvbS2Buffer,"ax",@progbits
+	.p2align 4
+	.globl	crc8DvbS2Buffer
+	.type	crc8DvbS2Buffer, @function
+crc8DvbS2Buffer:
+.LVL4:
+.LFB1:
+	.loc 1 86 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 1 is_stmt 0 view .LVU14
+	movl	%edi, %eax
+	.loc 1 87 5 is_stmt 1 view .LVU15
+.LVL5:
+	.loc 1 87 12 view .LVU16
+	.loc 1 87 18 is_stmt 0 view .LVU17
+	leal	-1(%rdx), %ecx
+.LVL6:
+	.loc 1 87 12 view .LVU18
+	testl	%edx, %edx
+	je	.L7
+	leaq	1(%rsi,%rcx), %r8
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 88 9 is_stmt 1 view .LVU19
+	.loc 1 88 35 is_stmt 0 view .LVU20
+	addq	$1, %rsi
+.LVL8:
+.LBB6:
+.LBI6:
+	.loc 1 72 9 is_stmt 1 view .LVU21
+.LBB7:
+	.loc 1 74 5 view .LVU22
+	.loc 1 74 9 is_stmt 0 view .LVU23
+	movl	$8, %ecx
+	xorb	-1(%rsi), %al
+.LVL9:
+	.loc 1 75 5 is_stmt 1 view .LVU24
+.LBB8:
+	.loc 1 75 10 view .LVU25
+	.loc 1 75 27 view .LVU26
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 76 9 view .LVU27
+	.loc 1 79 17 is_stmt 0 view .LVU28
+	leal	(%rax,%rax), %edi
+	movl	%edi, %edx
+	xorl	$-43, %edx
+	testb	%al, %al
+	movl	%edi, %eax
+.LVL10:
+	.loc 1 79 17 view .LVU29
+	cmovs	%edx, %eax
+.LVL11:
+	.loc 1 75 35 is_stmt 1 view .LVU30
+	.loc 1 75 27 view .LVU31
+	subl	$1, %ecx
+	jne	.L11
+.LVL12:
+	.loc 1 75 27 is_stmt 0 view .LVU32
+.LBE8:
+.LBE7:
+.LBE6:
+	.loc 1 87 12 is_stmt 1 view .LVU33
+	.loc 1 87 12 is_stmt 0 view .LVU34
+	cmpq	%r8, %rsi
+	jne	.L12
+.LVL13:
+.L7:
+	.loc 1 91 1 view .LVU35
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	crc8DvbS2Buffer, .-crc8DvbS2Buffer
+	.section	.text.crc32Stm32,"ax",@progbits
+	.p2align 4
+	.globl	crc32Stm32
+	.type	crc32Stm32, @function
+crc32Stm32:
+.LVL14:
+.LFB2:
+	.loc 1 98 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 5 view .LVU37
+	.loc 1 98 1 is_stmt 0 view .LVU38
+	movl	%edi, %eax
+	.loc 1 99 12 is_stmt 1 view .LVU39
+.LVL15:
+	.loc 1 99 12 is_stmt 0 view .LVU40
+	testl	%edx, %edx
+	je	.L22
+	.loc 1 98 1 view .LVU41
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leal	-1(%rdx), %ecx
+	leaq	crc32Table(%rip), %r8
+	leaq	4(%rsi,%rcx,4), %rdi
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+.LBB9:
+	.loc 1 100 9 is_stmt 1 view .LVU42
+	.loc 1 100 18 is_stmt 0 view .LVU43
+	movl	(%rsi), %edx
+	.loc 1 102 20 view .LVU44
+	movl	%eax, %ecx
+	.loc 1 100 30 view .LVU45
+	addq	$4, %rsi
+.LVL17:
+	.loc 1 102 9 is_stmt 1 view .LVU46
+	.loc 1 102 20 is_stmt 0 view .LVU47
+	sall	$8, %ecx
+	.loc 1 102 59 view .LVU48
+	xorl	%edx, %eax
+.LVL18:
+	.loc 1 103 60 view .LVU49
+	movl	%edx, %r9d
+	.loc 1 104 66 view .LVU50
+	movzbl	%dh, %ebx
+	.loc 1 102 51 view .LVU51
+	shrl	$24, %eax
+	.loc 1 103 60 view .LVU52
+	shrl	$16, %r9d
+	.loc 1 102 13 view .LVU53
+	xorl	(%r8,%rax,4), %ecx
+.LVL19:
+	.loc 1 103 9 is_stmt 1 view .LVU54
+	.loc 1 103 20 is_stmt 0 view .LVU55
+	movl	%ecx, %eax
+	.loc 1 103 44 view .LVU56
+	shrl	$24, %ecx
+.LVL20:
+	.loc 1 103 51 view .LVU57
+	xorl	%r9d, %ecx
+	.loc 1 103 20 view .LVU58
+	sall	$8, %eax
+.LVL21:
+	.loc 1 103 38 view .LVU59
+	movzbl	%cl, %ecx
+	.loc 1 103 13 view .LVU60
+	xorl	(%r8,%rcx,4), %eax
+.LVL22:
+	.loc 1 104 9 is_stmt 1 view .LVU61
+	.loc 1 104 20 is_stmt 0 view .LVU62
+	movl	%eax, %ecx
+	.loc 1 104 44 view .LVU63
+	shrl	$24, %eax
+.LVL23:
+	.loc 1 104 51 view .LVU64
+	xorl	%ebx, %eax
+	.loc 1 104 20 view .LVU65
+	sall	$8, %ecx
+.LVL24:
+	.loc 1 104 13 view .LVU66
+	xorl	(%r8,%rax,4), %ecx
+.LVL25:
+	.loc 1 105 9 is_stmt 1 view .LVU67
+	.loc 1 105 20 is_stmt 0 view .LVU68
+	movl	%ecx, %eax
+	.loc 1 105 44 view .LVU69
+	shrl	$24, %ecx
+.LVL26:
+	.loc 1 105 51 view .LVU70
+	xorl	%ecx, %edx
+.LVL27:
+	.loc 1 105 20 view .LVU71
+	sall	$8, %eax
+.LVL28:
+	.loc 1 105 38 view .LVU72
+	movzbl	%dl, %edx
+	.loc 1 105 13 view .LVU73
+	xorl	(%r8,%rdx,4), %eax
+.LVL29:
+	.loc 1 105 13 view .LVU74
+.LBE9:
+	.loc 1 99 12 is_stmt 1 view .LVU75
+	cmpq	%rdi, %rsi
+	jne	.L18
+	.loc 1 108 1 is_stmt 0 view .LVU76
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.LVL30:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.cfi_restore 3
+	.loc 1 108 1 view .LVU77
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	crc32Stm32, .-crc32Stm32
+	.section	.rodata.crc32Table,"a"
+	.align 32
+	.type	crc32Table, @object
+	.size	crc32Table, 1024
+crc32Table:
+	.long	0
+	.long	79764919
+	.long	159529838
+	.long	222504665
+	.long	319059676
+	.long	398814059
+	.long	445009330
+	.long	507990021
+	.long	638119352
+	.long	583659535
+	.long	797628118
+	.long	726387553
+	.long	890018660
+	.long	835552979
+	.long	1015980042
+	.long	944750013
+	.long	1276238704
+	.long	1221641927
+	.long	1167319070
+	.long	1095957929
+	.long	1595256236
+	.long	1540665371
+	.long	1452775106
+	.long	1381403509
+	.long	1780037320
+	.long	1859660671
+	.long	1671105958
+	.long	1733955601
+	.long	2031960084
+	.long	2111593891
+	.long	1889500026
+	.long	1952343757
+	.long	-1742489888
+	.long	-1662866601
+	.long	-1851683442
+	.long	-1788833735
+	.long	-1960329156
+	.long	-1880695413
+	.long	-2103051438
+	.long	-2040207643
+	.long	-1104454824
+	.long	-1159051537
+	.long	-1213636554
+	.long	-1284997759
+	.long	-1389417084
+	.long	-1444007885
+	.long	-1532160278
+	.long	-1603531939
+	.long	-734892656
+	.long	-789352409
+	.long	-575645954
+	.long	-646886583
+	.long	-952755380
+	.long	-1007220997
+	.long	-827056094
+	.long	-898286187
+	.long	-231047128
+	.long	-151282273
+	.long	-71779514
+	.long	-8804623
+	.long	-515967244
+	.long	-436212925
+	.long	-390279782
+	.long	-327299027
+	.long	881225847
+	.long	809987520
+	.long	1023691545
+	.long	969234094
+	.long	662832811
+	.long	591600412
+	.long	771767749
+	.long	717299826
+	.long	311336399
+	.long	374308984
+	.long	453813921
+	.long	533576470
+	.long	25881363
+	.long	88864420
+	.long	134795389
+	.long	214552010
+	.long	2023205639
+	.long	2086057648
+	.long	1897238633
+	.long	1976864222
+	.long	1804852699
+	.long	1867694188
+	.long	1645340341
+	.long	1724971778
+	.long	1587496639
+	.long	1516133128
+	.long	1461550545
+	.long	1406951526
+	.long	1302016099
+	.long	1230646740
+	.long	1142491917
+	.long	1087903418
+	.long	-1398421865
+	.long	-1469785312
+	.long	-1524105735
+	.long	-1578704818
+	.long	-1079922613
+	.long	-1151291908
+	.long	-1239184603
+	.long	-1293773166
+	.long	-1968362705
+	.long	-1905510760
+	.long	-2094067647
+	.long	-2014441994
+	.long	-1716953613
+	.long	-1654112188
+	.long	-1876203875
+	.long	-1796572374
+	.long	-525066777
+	.long	-462094256
+	.long	-382327159
+	.long	-302564546
+	.long	-206542021
+	.long	-143559028
+	.long	-97365931
+	.long	-17609246
+	.long	-960696225
+	.long	-1031934488
+	.long	-817968335
+	.long	-872425850
+	.long	-709327229
+	.long	-780559564
+	.long	-600130067
+	.long	-654598054
+	.long	1762451694
+	.long	1842216281
+	.long	1619975040
+	.long	1682949687
+	.long	2047383090
+	.long	2127137669
+	.long	1938468188
+	.long	2001449195
+	.long	1325665622
+	.long	1271206113
+	.long	1183200824
+	.long	1111960463
+	.long	1543535498
+	.long	1489069629
+	.long	1434599652
+	.long	1363369299
+	.long	622672798
+	.long	568075817
+	.long	748617968
+	.long	677256519
+	.long	907627842
+	.long	853037301
+	.long	1067152940
+	.long	995781531
+	.long	51762726
+	.long	131386257
+	.long	177728840
+	.long	240578815
+	.long	269590778
+	.long	349224269
+	.long	429104020
+	.long	491947555
+	.long	-248556018
+	.long	-168932423
+	.long	-122852000
+	.long	-60002089
+	.long	-500490030
+	.long	-420856475
+	.long	-341238852
+	.long	-278395381
+	.long	-685261898
+	.long	-739858943
+	.long	-559578920
+	.long	-630940305
+	.long	-1004286614
+	.long	-1058877219
+	.long	-845023740
+	.long	-916395085
+	.long	-1119974018
+	.long	-1174433591
+	.long	-1262701040
+	.long	-1333941337
+	.long	-1371866206
+	.long	-1426332139
+	.long	-1481064244
+	.long	-1552294533
+	.long	-1690935098
+	.long	-1611170447
+	.long	-1833673816
+	.long	-1770699233
+	.long	-2009983462
+	.long	-1930228819
+	.long	-2119160460
+	.long	-2056179517
+	.long	1569362073
+	.long	1498123566
+	.long	1409854455
+	.long	1355396672
+	.long	1317987909
+	.long	1246755826
+	.long	1192025387
+	.long	1137557660
+	.long	2072149281
+	.long	2135122070
+	.long	1912620623
+	.long	1992383480
+	.long	1753615357
+	.long	1816598090
+	.long	1627664531
+	.long	1707420964
+	.long	295390185
+	.long	358241886
+	.long	404320391
+	.long	483945776
+	.long	43990325
+	.long	106832002
+	.long	186451547
+	.long	266083308
+	.long	932423249
+	.long	861060070
+	.long	1041341759
+	.long	986742920
+	.long	613929101
+	.long	542559546
+	.long	756411363
+	.long	701822548
+	.long	-978770311
+	.long	-1050133554
+	.long	-869589737
+	.long	-924188512
+	.long	-693284699
+	.long	-764654318
+	.long	-550540341
+	.long	-605129092
+	.long	-475935807
+	.long	-413084042
+	.long	-366743377
+	.long	-287118056
+	.long	-257573603
+	.long	-194731862
+	.long	-114850189
+	.long	-35218492
+	.long	-1984365303
+	.long	-1921392450
+	.long	-2143631769
+	.long	-2063868976
+	.long	-1698919467
+	.long	-1635936670
+	.long	-1824608069
+	.long	-1744851700
+	.long	-1347415887
+	.long	-1418654458
+	.long	-1506661409
+	.long	-1561119128
+	.long	-1129027987
+	.long	-1200260134
+	.long	-1254728445
+	.long	-1309196108
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2a1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF707
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL13
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF690
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF691
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF692
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF693
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF694
+	.uleb128 0x2
+	.long	.LASF696
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF695
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF697
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF698
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF699
+	.uleb128 0x2
+	.long	.LASF700
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF701
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0xd
+	.long	0xa2
+	.long	0xb7
+	.uleb128 0xe
+	.long	0x43
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0xf
+	.long	.LASF708
+	.byte	0x1
+	.byte	0x19
+	.byte	0x17
+	.long	0xb7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	crc32Table
+	.uleb128 0x6
+	.long	.LASF704
+	.byte	0x61
+	.byte	0xa
+	.long	0x96
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x153
+	.uleb128 0x7
+	.string	"crc"
+	.byte	0x61
+	.byte	0x1e
+	.long	0x96
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x3
+	.long	.LASF702
+	.byte	0x61
+	.byte	0x33
+	.long	0x153
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x3
+	.long	.LASF703
+	.byte	0x61
+	.byte	0x42
+	.long	0x96
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x10
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x11
+	.long	.LASF709
+	.byte	0x1
+	.byte	0x64
+	.byte	0x12
+	.long	0x96
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xa2
+	.uleb128 0x6
+	.long	.LASF705
+	.byte	0x55
+	.byte	0x9
+	.long	0x85
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x212
+	.uleb128 0x7
+	.string	"crc"
+	.byte	0x55
+	.byte	0x21
+	.long	0x85
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3
+	.long	.LASF702
+	.byte	0x55
+	.byte	0x35
+	.long	0x212
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x3
+	.long	.LASF706
+	.byte	0x55
+	.byte	0x44
+	.long	0x96
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.long	0x217
+	.quad	.LBI6
+	.byte	.LVU21
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.byte	0x1
+	.byte	0x58
+	.byte	0xf
+	.uleb128 0x4
+	.long	0x234
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x4
+	.long	0x228
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.long	0x240
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0xa
+	.long	0x241
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x91
+	.uleb128 0x13
+	.long	.LASF710
+	.byte	0x1
+	.byte	0x48
+	.byte	0x9
+	.long	0x85
+	.byte	0x1
+	.long	0x24f
+	.uleb128 0x14
+	.string	"crc"
+	.byte	0x1
+	.byte	0x48
+	.byte	0x1b
+	.long	0x85
+	.uleb128 0x15
+	.long	.LASF702
+	.byte	0x1
+	.byte	0x48
+	.byte	0x28
+	.long	0x85
+	.uleb128 0x16
+	.uleb128 0x17
+	.string	"bit"
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x217
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x4
+	.long	0x228
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.long	0x234
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.long	0x240
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0xa
+	.long	0x241
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU49
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU59
+	.uleb128 .LVU61
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL16-.LVL14
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.LVL14
+	.uleb128 .LVL18-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL19-.LVL14
+	.uleb128 .LVL20-.LVL14
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL20-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.LVL14
+	.uleb128 .LVL23-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL23-.LVL14
+	.uleb128 .LVL24-.LVL14
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL25-.LVL14
+	.uleb128 .LVL26-.LVL14
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL26-.LVL14
+	.uleb128 .LVL28-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-.LVL14
+	.uleb128 .LFE2-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LFE2-.LVL14
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU77
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-.LVL14
+	.uleb128 .LVL16-.LVL14
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.LVL14
+	.uleb128 .LFE2-.LVL14
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU46
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU77
+.LLST12:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL27-.LVL17
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL27-.LVL17
+	.uleb128 .LVL30-.LVL17
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 -4
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU24
+	.uleb128 .LVU32
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL5-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-.LVL4
+	.uleb128 .LVL9-.LVL4
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.LVL4
+	.uleb128 .LFE1-.LVL4
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL8-.LVL4
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.LVL4
+	.uleb128 .LFE1-.LVL4
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU35
+.LLST5:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 .LVL13-.LVL4
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU21
+	.uleb128 .LVU32
+.LLST6:
+	.byte	0x8
+	.quad	.LVL8
+	.uleb128 .LVL12-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 -1
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU21
+	.uleb128 .LVU29
+	.uleb128 .LVU30
+	.uleb128 .LVU32
+.LLST7:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL8
+	.uleb128 .LVL12-.LVL8
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+.LLST8:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LVL9-.LVL9
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 .LVU8
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+.LLST2:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL1-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x4c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL13:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 4 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.file 6 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF391
+	.file 8 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x9
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF445
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF518
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF536
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF559
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF445
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF619
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF623
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF687
+	.byte	0x4
+	.file 20 ".//src/main/common/crc.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF688
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF689
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF444
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF455
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF456
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF517
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF535
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF544
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF558
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF574
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF616
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF618
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF622
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF686
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF631:
+	.string	"INT16_MAX (32767)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF389:
+	.string	"_STDINT_H 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF577:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF480:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF506:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF670:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF703:
+	.string	"wordCount"
+.LASF664:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF487:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF710:
+	.string	"crc8DvbS2"
+.LASF629:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF456:
+	.string	"_SYS_CDEFS_H 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF513:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF421:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF379:
+	.string	"SITL 1"
+.LASF511:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF491:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF709:
+	.string	"word"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF409:
+	.string	"__USE_LARGEFILE64"
+.LASF549:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF520:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF692:
+	.string	"unsigned int"
+.LASF455:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF637:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF430:
+	.string	"_POSIX_SOURCE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF624:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF636:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF478:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF451:
+	.string	"__GNU_LIBRARY__"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF538:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF539:
+	.string	"__stub_fchflags "
+.LASF532:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF476:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF435:
+	.string	"__USE_POSIX2 1"
+.LASF428:
+	.string	"__USE_ISOC95 1"
+.LASF618:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF626:
+	.string	"INT8_MIN (-128)"
+.LASF519:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF543:
+	.string	"__stub_sigreturn "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF562:
+	.string	"__S32_TYPE int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF466:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF607:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF492:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF411:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF508:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF647:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF669:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF403:
+	.string	"__USE_UNIX98"
+.LASF448:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF440:
+	.string	"_ATFILE_SOURCE"
+.LASF682:
+	.string	"UINT16_C(c) c"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF465:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF644:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF678:
+	.string	"INT16_C(c) c"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF396:
+	.string	"__USE_ISOCXX11"
+.LASF689:
+	.string	"CRC8_DVB_S2_POLYNOMIAL 0xD5"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF517:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF701:
+	.string	"uint32_t"
+.LASF687:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF648:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF458:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF660:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF645:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF507:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF599:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF656:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF617:
+	.string	"_BITS_TIME64_H 1"
+.LASF418:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF542:
+	.string	"__stub_setlogin "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF559:
+	.string	"_BITS_TYPES_H 1"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF685:
+	.string	"INTMAX_C(c) c ## L"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF546:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF400:
+	.string	"__USE_POSIX199506"
+.LASF526:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF484:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF614:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF468:
+	.string	"__PMT(args) args"
+.LASF580:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF503:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF588:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF540:
+	.string	"__stub_gtty "
+.LASF575:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF600:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF518:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF623:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF591:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF490:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF657:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF438:
+	.string	"__USE_XOPEN2K 1"
+.LASF627:
+	.string	"INT16_MIN (-32767-1)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF427:
+	.string	"__USE_ISOC99 1"
+.LASF582:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF416:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF563:
+	.string	"__U32_TYPE unsigned int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF395:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF394:
+	.string	"__USE_ISOC99"
+.LASF436:
+	.string	"__USE_POSIX199309 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF659:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF634:
+	.string	"UINT8_MAX (255)"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF661:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF472:
+	.string	"__BEGIN_DECLS "
+.LASF609:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF601:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF630:
+	.string	"INT8_MAX (127)"
+.LASF530:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF425:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF613:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF654:
+	.string	"INT_FAST8_MAX (127)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF642:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF639:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF688:
+	.string	"CRC32_STM32_INIT 0xFFFFFFFF"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF429:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF683:
+	.string	"UINT32_C(c) c ## U"
+.LASF510:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF671:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF445:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF603:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF608:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF471:
+	.string	"__ptr_t void *"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF699:
+	.string	"char"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF675:
+	.string	"WINT_MIN (0u)"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF700:
+	.string	"uint8_t"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF665:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF662:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF482:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF523:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF597:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF437:
+	.string	"__USE_POSIX199506 1"
+.LASF604:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF702:
+	.string	"data"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF521:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF621:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF505:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF423:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF628:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF399:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF574:
+	.string	"__STD_TYPE typedef"
+.LASF583:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF447:
+	.string	"__USE_ATFILE 1"
+.LASF404:
+	.string	"__USE_XOPEN2K"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF560:
+	.string	"__S16_TYPE short int"
+.LASF584:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF444:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF522:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF23:
+	.string	"_LP64 1"
+.LASF392:
+	.string	"_FEATURES_H 1"
+.LASF589:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF585:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF564:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF544:
+	.string	"__stub_stty "
+.LASF417:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF643:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF677:
+	.string	"INT8_C(c) c"
+.LASF561:
+	.string	"__U16_TYPE unsigned short int"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF616:
+	.string	"__FD_SETSIZE 1024"
+.LASF651:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF407:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF457:
+	.string	"__PMT"
+.LASF567:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF516:
+	.string	"__attribute_copy__"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF500:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF619:
+	.string	"__STD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF573:
+	.string	"__U64_TYPE unsigned long int"
+.LASF452:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF481:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF570:
+	.string	"__SLONG32_TYPE int"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF410:
+	.string	"__USE_FILE_OFFSET64"
+.LASF646:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF641:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF433:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF622:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF592:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF415:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF545:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF460:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF475:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF615:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF497:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF504:
+	.string	"__always_inline"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF434:
+	.string	"__USE_POSIX 1"
+.LASF612:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF667:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF495:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF635:
+	.string	"UINT16_MAX (65535)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF674:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF535:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF515:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF681:
+	.string	"UINT8_C(c) c"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF594:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF514:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF477:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF474:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF593:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF441:
+	.string	"_ATFILE_SOURCE 1"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF461:
+	.string	"__LEAF , __leaf__"
+.LASF531:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF680:
+	.string	"INT64_C(c) c ## L"
+.LASF469:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF496:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF533:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF569:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF470:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF494:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF390:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF568:
+	.string	"__SWORD_TYPE long int"
+.LASF695:
+	.string	"short int"
+.LASF658:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF454:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF398:
+	.string	"__USE_POSIX2"
+.LASF698:
+	.string	"long int"
+.LASF620:
+	.string	"_BITS_WCHAR_H 1"
+.LASF586:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF655:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF663:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF706:
+	.string	"length"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF489:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF581:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF596:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF686:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF676:
+	.string	"WINT_MAX (4294967295u)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF412:
+	.string	"__USE_ATFILE"
+.LASF406:
+	.string	"__USE_XOPEN2K8"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF483:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF401:
+	.string	"__USE_XOPEN"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF672:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF432:
+	.string	"_POSIX_C_SOURCE"
+.LASF463:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF572:
+	.string	"__S64_TYPE long int"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF696:
+	.string	"__uint8_t"
+.LASF595:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF439:
+	.string	"__USE_XOPEN2K8 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF493:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF704:
+	.string	"crc32Stm32"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF424:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF442:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF537:
+	.string	"__stub___compat_bdflush "
+.LASF571:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF467:
+	.string	"__P(args) args"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF453:
+	.string	"__GLIBC__ 2"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF693:
+	.string	"long unsigned int"
+.LASF527:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF652:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF374:
+	.string	"__unix 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF598:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF525:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF486:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF566:
+	.string	"__SQUAD_TYPE long int"
+.LASF405:
+	.string	"__USE_XOPEN2KXSI"
+.LASF488:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF358:
+	.string	"__k8 1"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF512:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF498:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF690:
+	.string	"unsigned char"
+.LASF449:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF632:
+	.string	"INT32_MAX (2147483647)"
+.LASF697:
+	.string	"__uint32_t"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF509:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF668:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF534:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF679:
+	.string	"INT32_C(c) c"
+.LASF414:
+	.string	"__USE_GNU"
+.LASF707:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF462:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF625:
+	.string	"__intptr_t_defined "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF422:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF576:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF638:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF431:
+	.string	"_POSIX_SOURCE 1"
+.LASF450:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF547:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF579:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF501:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF565:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF402:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF650:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF708:
+	.string	"crc32Table"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF391:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF649:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF473:
+	.string	"__END_DECLS "
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF605:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF705:
+	.string	"crc8DvbS2Buffer"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF666:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF408:
+	.string	"__USE_LARGEFILE"
+.LASF684:
+	.string	"UINT64_C(c) c ## UL"
+.LASF694:
+	.string	"signed char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF446:
+	.string	"__USE_MISC 1"
+.LASF691:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF611:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF548:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF541:
+	.string	"__stub_revoke "
+.LASF602:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF479:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF673:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF524:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF587:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF393:
+	.string	"__USE_ISOC11"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF578:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF610:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF459:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF485:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF536:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF443:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF606:
+	.string	"__TIMER_T_TYPE void *"
+.LASF633:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF464:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF376:
+	.string	"unix 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF397:
+	.string	"__USE_POSIX"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF419:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF640:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF590:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF499:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/common/crc.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10665 @@
+	.file	"maths.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/maths.c"
+	.section	.text.applyDeadband,"ax",@progbits
+	.p2align 4
+	.globl	applyDeadband
+	.type	applyDeadband, @function
+applyDeadband:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/common/maths.c"
+	.loc 1 28 1 view -0
+	.cfi_startproc
+	.loc 1 29 5 view .LVU1
+	.loc 1 29 32 is_stmt 0 view .LVU2
+	movl	%edi, %eax
+	negl	%eax
+	cmovs	%edi, %eax
+	.loc 1 30 15 view .LVU3
+	xorl	%edx, %edx
+	.loc 1 29 8 view .LVU4
+	cmpl	%esi, %eax
+	jl	.L1
+	.loc 1 31 12 is_stmt 1 view .LVU5
+	.loc 1 31 15 is_stmt 0 view .LVU6
+	testl	%edi, %edi
+	jle	.L3
+	.loc 1 32 9 is_stmt 1 view .LVU7
+	.loc 1 32 15 is_stmt 0 view .LVU8
+	movl	%edi, %edx
+	subl	%esi, %edx
+.LVL1:
+.L1:
+	.loc 1 37 1 view .LVU9
+	movl	%edx, %eax
+	ret
+.LVL2:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 33 12 is_stmt 1 view .LVU10
+	.loc 1 34 15 is_stmt 0 view .LVU11
+	addl	%edi, %esi
+.LVL3:
+	.loc 1 34 15 view .LVU12
+	testl	%edi, %edi
+	cmovne	%esi, %edx
+	.loc 1 37 1 view .LVU13
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	applyDeadband, .-applyDeadband
+	.section	.text.constrain,"ax",@progbits
+	.p2align 4
+	.globl	constrain
+	.type	constrain, @function
+constrain:
+.LVL4:
+.LFB1:
+	.loc 1 40 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 41 5 view .LVU15
+	cmpl	%edx, %edi
+	movl	%esi, %eax
+	cmovle	%edi, %edx
+.LVL5:
+	.loc 1 41 5 is_stmt 0 view .LVU16
+	cmpl	%esi, %edi
+	cmovge	%edx, %eax
+	.loc 1 47 1 view .LVU17
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	constrain, .-constrain
+	.section	.text.constrainf,"ax",@progbits
+	.p2align 4
+	.globl	constrainf
+	.type	constrainf, @function
+constrainf:
+.LVL6:
+.LFB2:
+	.loc 1 50 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 51 5 view .LVU19
+	.loc 1 51 8 is_stmt 0 view .LVU20
+	comiss	%xmm0, %xmm1
+	ja	.L13
+	.loc 1 53 10 is_stmt 1 view .LVU21
+	.loc 1 56 16 is_stmt 0 view .LVU22
+	minss	%xmm0, %xmm2
+.LVL7:
+	.loc 1 56 16 view .LVU23
+	movaps	%xmm2, %xmm0
+.LVL8:
+	.loc 1 56 16 view .LVU24
+	ret
+.LVL9:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 52 16 view .LVU25
+	movaps	%xmm1, %xmm0
+.LVL10:
+	.loc 1 57 1 view .LVU26
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	constrainf, .-constrainf
+	.section	.text.devClear,"ax",@progbits
+	.p2align 4
+	.globl	devClear
+	.type	devClear, @function
+devClear:
+.LVL11:
+.LFB3:
+	.loc 1 60 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 61 5 view .LVU28
+	.loc 1 61 14 is_stmt 0 view .LVU29
+	movl	$0, 16(%rdi)
+	.loc 1 62 1 view .LVU30
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	devClear, .-devClear
+	.section	.text.devPush,"ax",@progbits
+	.p2align 4
+	.globl	devPush
+	.type	devPush, @function
+devPush:
+.LVL12:
+.LFB4:
+	.loc 1 65 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 5 view .LVU32
+	.loc 1 66 13 is_stmt 0 view .LVU33
+	movl	16(%rdi), %eax
+	addl	$1, %eax
+	movl	%eax, 16(%rdi)
+	.loc 1 67 5 is_stmt 1 view .LVU34
+	.loc 1 67 8 is_stmt 0 view .LVU35
+	cmpl	$1, %eax
+	je	.L20
+	.loc 1 71 9 is_stmt 1 view .LVU36
+	.loc 1 71 26 is_stmt 0 view .LVU37
+	movss	(%rdi), %xmm3
+	.loc 1 71 40 view .LVU38
+	movaps	%xmm0, %xmm2
+	.loc 1 71 55 view .LVU39
+	pxor	%xmm4, %xmm4
+	cvtsi2ssl	%eax, %xmm4
+	.loc 1 71 40 view .LVU40
+	subss	%xmm3, %xmm2
+	.loc 1 71 55 view .LVU41
+	movaps	%xmm2, %xmm1
+	divss	%xmm4, %xmm1
+	.loc 1 71 35 view .LVU42
+	addss	%xmm3, %xmm1
+	.loc 1 72 60 view .LVU43
+	subss	%xmm1, %xmm0
+.LVL13:
+	.loc 1 71 21 view .LVU44
+	movss	%xmm1, 4(%rdi)
+	.loc 1 72 9 is_stmt 1 view .LVU45
+	.loc 1 68 21 is_stmt 0 view .LVU46
+	movss	%xmm1, (%rdi)
+	.loc 1 72 55 view .LVU47
+	mulss	%xmm2, %xmm0
+	.loc 1 72 35 view .LVU48
+	addss	8(%rdi), %xmm0
+	.loc 1 72 21 view .LVU49
+	movss	%xmm0, 12(%rdi)
+	.loc 1 73 9 is_stmt 1 view .LVU50
+	.loc 1 74 9 view .LVU51
+	.loc 1 69 21 is_stmt 0 view .LVU52
+	movss	%xmm0, 8(%rdi)
+	.loc 1 76 1 view .LVU53
+	ret
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.loc 1 68 9 is_stmt 1 view .LVU54
+	movaps	%xmm0, %xmm1
+	.loc 1 68 35 is_stmt 0 view .LVU55
+	movss	%xmm0, 4(%rdi)
+	.loc 1 69 9 is_stmt 1 view .LVU56
+	pxor	%xmm0, %xmm0
+.LVL15:
+	.loc 1 68 21 is_stmt 0 view .LVU57
+	movss	%xmm1, (%rdi)
+	.loc 1 69 21 view .LVU58
+	movss	%xmm0, 8(%rdi)
+	.loc 1 76 1 view .LVU59
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	devPush, .-devPush
+	.section	.text.devVariance,"ax",@progbits
+	.p2align 4
+	.globl	devVariance
+	.type	devVariance, @function
+devVariance:
+.LVL16:
+.LFB5:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 5 view .LVU61
+	.loc 1 80 17 is_stmt 0 view .LVU62
+	movl	16(%rdi), %eax
+	.loc 1 80 59 view .LVU63
+	pxor	%xmm0, %xmm0
+	cmpl	$1, %eax
+	jle	.L21
+	.loc 1 80 54 discriminator 1 view .LVU64
+	subl	$1, %eax
+	.loc 1 80 42 discriminator 1 view .LVU65
+	pxor	%xmm1, %xmm1
+	.loc 1 80 59 discriminator 1 view .LVU66
+	movss	12(%rdi), %xmm0
+	.loc 1 80 42 discriminator 1 view .LVU67
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 80 59 discriminator 1 view .LVU68
+	divss	%xmm1, %xmm0
+.L21:
+	.loc 1 81 1 view .LVU69
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	devVariance, .-devVariance
+	.section	.text.devStandardDeviation,"ax",@progbits
+	.p2align 4
+	.globl	devStandardDeviation
+	.type	devStandardDeviation, @function
+devStandardDeviation:
+.LVL17:
+.LFB6:
+	.loc 1 84 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 85 5 view .LVU71
+.LBB4:
+.LBI4:
+	.loc 1 78 7 view .LVU72
+.LBB5:
+	.loc 1 80 5 view .LVU73
+	.loc 1 80 17 is_stmt 0 view .LVU74
+	movl	16(%rdi), %eax
+	.loc 1 80 59 view .LVU75
+	cmpl	$1, %eax
+	jle	.L29
+	.loc 1 80 54 view .LVU76
+	subl	$1, %eax
+	.loc 1 80 42 view .LVU77
+	pxor	%xmm1, %xmm1
+	.loc 1 80 59 view .LVU78
+	movss	12(%rdi), %xmm0
+	.loc 1 80 42 view .LVU79
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 80 59 view .LVU80
+	divss	%xmm1, %xmm0
+.LVL18:
+	.loc 1 80 59 view .LVU81
+	pxor	%xmm1, %xmm1
+	ucomiss	%xmm0, %xmm1
+	ja	.L31
+.LBE5:
+.LBE4:
+	.loc 1 85 12 view .LVU82
+	sqrtss	%xmm0, %xmm0
+	ret
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+.LBB7:
+.LBB6:
+	.loc 1 85 12 view .LVU83
+	pxor	%xmm0, %xmm0
+.LVL20:
+	.loc 1 85 12 view .LVU84
+.LBE6:
+.LBE7:
+	.loc 1 86 1 view .LVU85
+	ret
+.L31:
+	.loc 1 85 12 view .LVU86
+	jmp	sqrtf@PLT
+.LVL21:
+	.loc 1 85 12 view .LVU87
+	.cfi_endproc
+.LFE6:
+	.size	devStandardDeviation, .-devStandardDeviation
+	.section	.text.degreesToRadians,"ax",@progbits
+	.p2align 4
+	.globl	degreesToRadians
+	.type	degreesToRadians, @function
+degreesToRadians:
+.LVL22:
+.LFB7:
+	.loc 1 89 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 90 5 view .LVU89
+	.loc 1 90 20 is_stmt 0 view .LVU90
+	movswl	%di, %edi
+	.loc 1 90 20 view .LVU91
+	pxor	%xmm0, %xmm0
+	cvtsi2sdl	%edi, %xmm0
+	mulsd	.LC1(%rip), %xmm0
+	cvtsd2ss	%xmm0, %xmm0
+	.loc 1 91 1 view .LVU92
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	degreesToRadians, .-degreesToRadians
+	.section	.text.scaleRange,"ax",@progbits
+	.p2align 4
+	.globl	scaleRange
+	.type	scaleRange, @function
+scaleRange:
+.LVL23:
+.LFB8:
+	.loc 1 93 73 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 94 5 view .LVU94
+	.loc 1 94 78 is_stmt 0 view .LVU95
+	movslq	%esi, %rsi
+.LVL24:
+	.loc 1 95 5 is_stmt 1 view .LVU96
+	.loc 1 96 5 view .LVU97
+	.loc 1 94 19 is_stmt 0 view .LVU98
+	movslq	%r8d, %rax
+	.loc 1 94 63 view .LVU99
+	movslq	%edi, %rdi
+	.loc 1 94 40 view .LVU100
+	movslq	%ecx, %r8
+.LVL25:
+	.loc 1 94 76 view .LVU101
+	subq	%rsi, %rdi
+.LVL26:
+	.loc 1 94 38 view .LVU102
+	subq	%r8, %rax
+.LVL27:
+	.loc 1 94 14 view .LVU103
+	imulq	%rdi, %rax
+.LVL28:
+	.loc 1 95 18 view .LVU104
+	movslq	%edx, %rdi
+	.loc 1 95 14 view .LVU105
+	subq	%rsi, %rdi
+.LVL29:
+	.loc 1 96 16 view .LVU106
+	cqto
+.LVL30:
+	.loc 1 96 16 view .LVU107
+	idivq	%rdi
+.LVL31:
+	.loc 1 96 44 view .LVU108
+	addl	%ecx, %eax
+	.loc 1 97 1 view .LVU109
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	scaleRange, .-scaleRange
+	.section	.text.sin_approx,"ax",@progbits
+	.p2align 4
+	.globl	sin_approx
+	.type	sin_approx, @function
+sin_approx:
+.LVL32:
+.LFB9:
+	.loc 1 113 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 115 5 view .LVU111
+	.loc 1 113 1 is_stmt 0 view .LVU112
+	movaps	%xmm0, %xmm1
+	.loc 1 115 97 view .LVU113
+	pxor	%xmm3, %xmm3
+	.loc 1 115 33 view .LVU114
+	movss	.LC4(%rip), %xmm0
+.LVL33:
+	.loc 1 115 97 view .LVU115
+	movss	.LC2(%rip), %xmm2
+	comiss	%xmm3, %xmm1
+	.loc 1 115 33 view .LVU116
+	mulss	%xmm1, %xmm0
+	.loc 1 115 97 view .LVU117
+	jnb	.L35
+	movss	.LC3(%rip), %xmm2
+.L35:
+.LVL34:
+	.loc 1 116 5 is_stmt 1 discriminator 4 view .LVU118
+	.loc 1 115 77 is_stmt 0 discriminator 4 view .LVU119
+	addss	%xmm2, %xmm0
+.LVL35:
+	.loc 1 115 13 discriminator 4 view .LVU120
+	cvttss2sil	%xmm0, %eax
+.LVL36:
+	.loc 1 116 16 discriminator 4 view .LVU121
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC5(%rip), %xmm0
+	.loc 1 116 7 discriminator 4 view .LVU122
+	subss	%xmm0, %xmm1
+.LVL37:
+	.loc 1 117 5 is_stmt 1 discriminator 4 view .LVU123
+	.loc 1 117 8 is_stmt 0 discriminator 4 view .LVU124
+	comiss	.LC6(%rip), %xmm1
+	jbe	.L45
+	.loc 1 118 9 is_stmt 1 view .LVU125
+	.loc 1 118 11 is_stmt 0 view .LVU126
+	movss	.LC7(%rip), %xmm0
+	subss	%xmm1, %xmm0
+	movaps	%xmm0, %xmm1
+.LVL38:
+.L39:
+	.loc 1 123 5 is_stmt 1 view .LVU127
+	.loc 1 123 11 is_stmt 0 view .LVU128
+	movaps	%xmm1, %xmm2
+	.loc 1 124 72 view .LVU129
+	movss	.LC10(%rip), %xmm0
+	.loc 1 123 11 view .LVU130
+	mulss	%xmm1, %xmm2
+.LVL39:
+	.loc 1 124 5 is_stmt 1 view .LVU131
+	.loc 1 124 72 is_stmt 0 view .LVU132
+	mulss	%xmm2, %xmm0
+	.loc 1 124 67 view .LVU133
+	addss	.LC11(%rip), %xmm0
+	.loc 1 124 48 view .LVU134
+	mulss	%xmm2, %xmm0
+	.loc 1 124 18 view .LVU135
+	mulss	%xmm1, %xmm2
+.LVL40:
+	.loc 1 124 43 view .LVU136
+	subss	.LC12(%rip), %xmm0
+	.loc 1 124 23 view .LVU137
+	mulss	%xmm2, %xmm0
+	.loc 1 124 14 view .LVU138
+	addss	%xmm1, %xmm0
+	.loc 1 125 1 view .LVU139
+	ret
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 119 12 is_stmt 1 view .LVU140
+	.loc 1 119 15 is_stmt 0 view .LVU141
+	movss	.LC8(%rip), %xmm0
+	comiss	%xmm1, %xmm0
+	jbe	.L39
+	.loc 1 120 9 is_stmt 1 view .LVU142
+	.loc 1 120 11 is_stmt 0 view .LVU143
+	movss	.LC9(%rip), %xmm0
+	subss	%xmm1, %xmm0
+	movaps	%xmm0, %xmm1
+.LVL42:
+	.loc 1 120 11 view .LVU144
+	jmp	.L39
+	.cfi_endproc
+.LFE9:
+	.size	sin_approx, .-sin_approx
+	.section	.text.cos_approx,"ax",@progbits
+	.p2align 4
+	.globl	cos_approx
+	.type	cos_approx, @function
+cos_approx:
+.LVL43:
+.LFB10:
+	.loc 1 128 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 5 view .LVU146
+	.loc 1 129 12 is_stmt 0 view .LVU147
+	movss	.LC6(%rip), %xmm1
+.LBB10:
+.LBB11:
+	.loc 1 115 97 view .LVU148
+	pxor	%xmm3, %xmm3
+	movss	.LC2(%rip), %xmm2
+.LBE11:
+.LBE10:
+	.loc 1 129 12 view .LVU149
+	addss	%xmm0, %xmm1
+.LVL44:
+.LBB14:
+.LBI10:
+	.loc 1 112 7 is_stmt 1 view .LVU150
+.LBB12:
+	.loc 1 115 5 view .LVU151
+	.loc 1 115 33 is_stmt 0 view .LVU152
+	movss	.LC4(%rip), %xmm0
+.LVL45:
+	.loc 1 115 33 view .LVU153
+	mulss	%xmm1, %xmm0
+	.loc 1 115 97 view .LVU154
+	comiss	%xmm3, %xmm1
+	jnb	.L47
+	movss	.LC3(%rip), %xmm2
+.L47:
+.LVL46:
+	.loc 1 116 5 is_stmt 1 view .LVU155
+	.loc 1 115 77 is_stmt 0 view .LVU156
+	addss	%xmm2, %xmm0
+.LVL47:
+	.loc 1 115 13 view .LVU157
+	cvttss2sil	%xmm0, %eax
+.LVL48:
+	.loc 1 116 16 view .LVU158
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	mulss	.LC5(%rip), %xmm0
+	.loc 1 116 7 view .LVU159
+	subss	%xmm0, %xmm1
+.LVL49:
+	.loc 1 117 5 is_stmt 1 view .LVU160
+	.loc 1 117 8 is_stmt 0 view .LVU161
+	comiss	.LC6(%rip), %xmm1
+	jbe	.L57
+	.loc 1 118 9 is_stmt 1 view .LVU162
+	.loc 1 118 11 is_stmt 0 view .LVU163
+	movss	.LC7(%rip), %xmm0
+	subss	%xmm1, %xmm0
+	movaps	%xmm0, %xmm1
+.LVL50:
+.L51:
+	.loc 1 123 5 is_stmt 1 view .LVU164
+	.loc 1 123 11 is_stmt 0 view .LVU165
+	movaps	%xmm1, %xmm2
+	.loc 1 124 72 view .LVU166
+	movss	.LC10(%rip), %xmm0
+	.loc 1 123 11 view .LVU167
+	mulss	%xmm1, %xmm2
+.LVL51:
+	.loc 1 124 5 is_stmt 1 view .LVU168
+	.loc 1 124 72 is_stmt 0 view .LVU169
+	mulss	%xmm2, %xmm0
+	.loc 1 124 67 view .LVU170
+	addss	.LC11(%rip), %xmm0
+	.loc 1 124 48 view .LVU171
+	mulss	%xmm2, %xmm0
+	.loc 1 124 18 view .LVU172
+	mulss	%xmm1, %xmm2
+	.loc 1 124 43 view .LVU173
+	subss	.LC12(%rip), %xmm0
+	.loc 1 124 23 view .LVU174
+	mulss	%xmm2, %xmm0
+	.loc 1 124 14 view .LVU175
+	addss	%xmm1, %xmm0
+.LBE12:
+.LBE14:
+	.loc 1 130 1 view .LVU176
+	ret
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+.LBB15:
+.LBB13:
+	.loc 1 119 12 is_stmt 1 view .LVU177
+	.loc 1 119 15 is_stmt 0 view .LVU178
+	movss	.LC8(%rip), %xmm0
+	comiss	%xmm1, %xmm0
+	jbe	.L51
+	.loc 1 120 9 is_stmt 1 view .LVU179
+	.loc 1 120 11 is_stmt 0 view .LVU180
+	movss	.LC9(%rip), %xmm0
+	subss	%xmm1, %xmm0
+	movaps	%xmm0, %xmm1
+.LVL53:
+	.loc 1 120 11 view .LVU181
+	jmp	.L51
+.LBE13:
+.LBE15:
+	.cfi_endproc
+.LFE10:
+	.size	cos_approx, .-cos_approx
+	.section	.text.atan2_approx,"ax",@progbits
+	.p2align 4
+	.globl	atan2_approx
+	.type	atan2_approx, @function
+atan2_approx:
+.LVL54:
+.LFB11:
+	.loc 1 142 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 143 5 view .LVU183
+	.loc 1 143 11 is_stmt 0 view .LVU184
+	movss	.LC13(%rip), %xmm3
+	movaps	%xmm1, %xmm5
+	.loc 1 142 1 view .LVU185
+	movaps	%xmm0, %xmm4
+	.loc 1 143 11 view .LVU186
+	andps	%xmm3, %xmm5
+.LVL55:
+	.loc 1 144 5 is_stmt 1 view .LVU187
+	.loc 1 144 11 is_stmt 0 view .LVU188
+	andps	%xmm4, %xmm3
+.LVL56:
+	.loc 1 145 5 is_stmt 1 view .LVU189
+	.loc 1 148 8 is_stmt 0 view .LVU190
+	pxor	%xmm0, %xmm0
+.LVL57:
+	.loc 1 145 38 view .LVU191
+	movaps	%xmm5, %xmm2
+	maxss	%xmm3, %xmm2
+.LVL58:
+	.loc 1 146 5 is_stmt 1 view .LVU192
+	.loc 1 148 5 view .LVU193
+	.loc 1 148 8 is_stmt 0 view .LVU194
+	comiss	%xmm0, %xmm2
+	jbe	.L61
+	.loc 1 149 9 is_stmt 1 view .LVU195
+	.loc 1 149 37 is_stmt 0 view .LVU196
+	movaps	%xmm5, %xmm0
+	minss	%xmm3, %xmm0
+	.loc 1 149 15 view .LVU197
+	divss	%xmm2, %xmm0
+	movaps	%xmm0, %xmm2
+.LVL59:
+.L61:
+	.loc 1 152 5 is_stmt 1 view .LVU198
+	.loc 1 152 40 is_stmt 0 view .LVU199
+	movss	.LC14(%rip), %xmm0
+	.loc 1 153 37 view .LVU200
+	movss	.LC20(%rip), %xmm6
+	.loc 1 155 8 view .LVU201
+	comiss	%xmm5, %xmm3
+	.loc 1 152 14 view .LVU202
+	movss	.LC19(%rip), %xmm7
+	.loc 1 152 40 view .LVU203
+	mulss	%xmm2, %xmm0
+	.loc 1 152 48 view .LVU204
+	subss	.LC15(%rip), %xmm0
+	.loc 1 153 37 view .LVU205
+	mulss	%xmm2, %xmm6
+	.loc 1 153 45 view .LVU206
+	addss	.LC21(%rip), %xmm6
+	.loc 1 152 71 view .LVU207
+	mulss	%xmm2, %xmm0
+	.loc 1 152 79 view .LVU208
+	subss	.LC16(%rip), %xmm0
+	.loc 1 152 103 view .LVU209
+	mulss	%xmm2, %xmm0
+	.loc 1 152 111 view .LVU210
+	subss	.LC17(%rip), %xmm0
+	.loc 1 152 132 view .LVU211
+	mulss	%xmm2, %xmm0
+	.loc 1 152 140 view .LVU212
+	subss	.LC18(%rip), %xmm0
+	.loc 1 153 68 view .LVU213
+	mulss	%xmm6, %xmm2
+.LVL60:
+	.loc 1 153 76 view .LVU214
+	addss	.LC22(%rip), %xmm2
+	.loc 1 152 14 view .LVU215
+	xorps	%xmm7, %xmm0
+	.loc 1 152 12 view .LVU216
+	divss	%xmm2, %xmm0
+.LVL61:
+	.loc 1 155 5 is_stmt 1 view .LVU217
+	.loc 1 155 8 is_stmt 0 view .LVU218
+	jbe	.L65
+	.loc 1 156 9 is_stmt 1 view .LVU219
+	.loc 1 156 16 is_stmt 0 view .LVU220
+	movss	.LC6(%rip), %xmm2
+	subss	%xmm0, %xmm2
+	movaps	%xmm2, %xmm0
+.LVL62:
+.L65:
+	.loc 1 158 5 is_stmt 1 view .LVU221
+	.loc 1 158 8 is_stmt 0 view .LVU222
+	pxor	%xmm2, %xmm2
+	comiss	%xmm1, %xmm2
+	jbe	.L67
+	.loc 1 159 9 is_stmt 1 view .LVU223
+	.loc 1 159 16 is_stmt 0 view .LVU224
+	movss	.LC7(%rip), %xmm1
+.LVL63:
+	.loc 1 159 16 view .LVU225
+	subss	%xmm0, %xmm1
+	movaps	%xmm1, %xmm0
+.LVL64:
+.L67:
+	.loc 1 161 5 is_stmt 1 view .LVU226
+	.loc 1 161 8 is_stmt 0 view .LVU227
+	pxor	%xmm1, %xmm1
+	comiss	%xmm4, %xmm1
+	ja	.L79
+	.loc 1 165 1 view .LVU228
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 162 9 is_stmt 1 view .LVU229
+	.loc 1 162 16 is_stmt 0 view .LVU230
+	xorps	%xmm7, %xmm0
+.LVL65:
+	.loc 1 164 5 is_stmt 1 view .LVU231
+	.loc 1 165 1 is_stmt 0 view .LVU232
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	atan2_approx, .-atan2_approx
+	.section	.text.acos_approx,"ax",@progbits
+	.p2align 4
+	.globl	acos_approx
+	.type	acos_approx, @function
+acos_approx:
+.LVL66:
+.LFB12:
+	.loc 1 169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 170 5 view .LVU234
+	.loc 1 170 11 is_stmt 0 view .LVU235
+	movaps	%xmm0, %xmm3
+	.loc 1 169 1 view .LVU236
+	movaps	%xmm0, %xmm2
+	pxor	%xmm1, %xmm1
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 170 11 view .LVU237
+	andps	.LC13(%rip), %xmm3
+.LVL67:
+	.loc 1 171 5 is_stmt 1 view .LVU238
+	.loc 1 171 20 is_stmt 0 view .LVU239
+	movss	.LC22(%rip), %xmm0
+.LVL68:
+	.loc 1 171 20 view .LVU240
+	subss	%xmm3, %xmm0
+	ucomiss	%xmm0, %xmm1
+	ja	.L88
+	movaps	%xmm0, %xmm1
+	sqrtss	%xmm1, %xmm1
+.LVL69:
+.L83:
+	.loc 1 171 111 view .LVU241
+	movss	.LC23(%rip), %xmm0
+	mulss	%xmm3, %xmm0
+	.loc 1 171 96 view .LVU242
+	addss	.LC24(%rip), %xmm0
+	.loc 1 171 82 view .LVU243
+	mulss	%xmm3, %xmm0
+	.loc 1 171 75 view .LVU244
+	subss	.LC25(%rip), %xmm0
+	.loc 1 171 60 view .LVU245
+	mulss	%xmm3, %xmm0
+	.loc 1 171 53 view .LVU246
+	addss	.LC26(%rip), %xmm0
+	.loc 1 171 11 view .LVU247
+	mulss	%xmm1, %xmm0
+.LVL70:
+	.loc 1 173 5 is_stmt 1 view .LVU248
+	.loc 1 173 8 is_stmt 0 view .LVU249
+	pxor	%xmm1, %xmm1
+	comiss	%xmm2, %xmm1
+	ja	.L90
+	.loc 1 177 1 view .LVU250
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.cfi_restore_state
+	.loc 1 174 9 is_stmt 1 view .LVU251
+	.loc 1 174 40 is_stmt 0 view .LVU252
+	movss	.LC7(%rip), %xmm1
+	.loc 1 177 1 view .LVU253
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 174 40 view .LVU254
+	subss	%xmm0, %xmm1
+	movaps	%xmm1, %xmm0
+.LVL71:
+	.loc 1 177 1 view .LVU255
+	ret
+.LVL72:
+.L88:
+	.cfi_restore_state
+	.loc 1 177 1 view .LVU256
+	movss	%xmm2, 12(%rsp)
+	movss	%xmm3, 8(%rsp)
+	.loc 1 171 20 view .LVU257
+	call	sqrtf@PLT
+.LVL73:
+	.loc 1 171 20 view .LVU258
+	movss	12(%rsp), %xmm2
+	movss	8(%rsp), %xmm3
+	movaps	%xmm0, %xmm1
+	jmp	.L83
+	.cfi_endproc
+.LFE12:
+	.size	acos_approx, .-acos_approx
+	.section	.text.invSqrt_approx,"ax",@progbits
+	.p2align 4
+	.globl	invSqrt_approx
+	.type	invSqrt_approx, @function
+invSqrt_approx:
+.LVL74:
+.LFB13:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU260
+	.loc 1 182 11 is_stmt 0 view .LVU261
+	movss	.LC2(%rip), %xmm1
+	.loc 1 187 31 view .LVU262
+	movd	%xmm0, %eax
+	movl	$1597463007, %edx
+	shrl	%eax
+	.loc 1 182 11 view .LVU263
+	mulss	%xmm0, %xmm1
+.LVL75:
+	.loc 1 183 5 is_stmt 1 view .LVU264
+	.loc 1 184 5 view .LVU265
+	.loc 1 186 5 view .LVU266
+	.loc 1 187 5 view .LVU267
+	.loc 1 188 5 view .LVU268
+	.loc 1 190 5 view .LVU269
+	subl	%eax, %edx
+.LVL76:
+	.loc 1 190 19 is_stmt 0 view .LVU270
+	movss	.LC27(%rip), %xmm0
+.LVL77:
+	.loc 1 190 19 view .LVU271
+	movd	%edx, %xmm3
+	movaps	%xmm0, %xmm2
+	.loc 1 190 27 view .LVU272
+	movaps	%xmm1, %xmm4
+	mulss	%xmm3, %xmm4
+	.loc 1 190 31 view .LVU273
+	mulss	%xmm3, %xmm4
+	.loc 1 190 19 view .LVU274
+	subss	%xmm4, %xmm2
+	.loc 1 190 11 view .LVU275
+	mulss	%xmm3, %xmm2
+	.loc 1 191 5 is_stmt 1 view .LVU276
+	.loc 1 192 5 view .LVU277
+	.loc 1 191 27 is_stmt 0 view .LVU278
+	mulss	%xmm2, %xmm1
+.LVL78:
+	.loc 1 191 31 view .LVU279
+	mulss	%xmm2, %xmm1
+	.loc 1 191 19 view .LVU280
+	subss	%xmm1, %xmm0
+	.loc 1 191 11 view .LVU281
+	mulss	%xmm2, %xmm0
+	.loc 1 193 1 view .LVU282
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	invSqrt_approx, .-invSqrt_approx
+	.section	.text.pressureToAltitude,"ax",@progbits
+	.p2align 4
+	.globl	pressureToAltitude
+	.type	pressureToAltitude, @function
+pressureToAltitude:
+.LVL79:
+.LFB16:
+	.loc 1 237 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 238 5 view .LVU284
+.LBB20:
+.LBI20:
+	.loc 1 199 14 view .LVU285
+.LBB21:
+	.loc 1 201 5 view .LVU286
+	.loc 1 202 5 view .LVU287
+	.loc 1 203 5 view .LVU288
+	.loc 1 205 5 view .LVU289
+	divss	.LC28(%rip), %xmm0
+.LVL80:
+	.loc 1 205 5 is_stmt 0 view .LVU290
+	movd	%xmm0, %eax
+.LVL81:
+	.loc 1 206 5 is_stmt 1 view .LVU291
+	.loc 1 206 32 is_stmt 0 view .LVU292
+	movl	%eax, %edx
+	.loc 1 207 18 view .LVU293
+	andl	$8388607, %eax
+	orl	$1065353216, %eax
+	.loc 1 206 32 view .LVU294
+	shrl	$23, %edx
+	movd	%eax, %xmm2
+	.loc 1 210 8 view .LVU295
+	comiss	.LC29(%rip), %xmm2
+	.loc 1 206 16 view .LVU296
+	movzbl	%dl, %edx
+.LVL82:
+	.loc 1 207 5 is_stmt 1 view .LVU297
+	.loc 1 208 5 view .LVU298
+	.loc 1 210 5 view .LVU299
+	.loc 1 210 8 is_stmt 0 view .LVU300
+	ja	.L93
+	movss	.LC2(%rip), %xmm1
+	.loc 1 206 14 view .LVU301
+	leal	-127(%rdx), %eax
+.LVL83:
+.L94:
+	.loc 1 215 5 is_stmt 1 view .LVU302
+	.loc 1 215 12 is_stmt 0 view .LVU303
+	movss	.LC22(%rip), %xmm0
+.LVL84:
+	.loc 1 215 12 view .LVU304
+	movaps	%xmm2, %xmm4
+.LBE21:
+.LBE20:
+.LBB24:
+.LBB25:
+	.loc 1 225 72 view .LVU305
+	pxor	%xmm6, %xmm6
+	movaps	%xmm1, %xmm5
+.LBE25:
+.LBE24:
+.LBB27:
+.LBB22:
+	.loc 1 217 74 view .LVU306
+	movss	.LC30(%rip), %xmm3
+	.loc 1 215 25 view .LVU307
+	addss	%xmm0, %xmm2
+	.loc 1 215 12 view .LVU308
+	subss	%xmm0, %xmm4
+	.loc 1 215 7 view .LVU309
+	divss	%xmm2, %xmm4
+.LVL85:
+	.loc 1 216 5 is_stmt 1 view .LVU310
+	.loc 1 216 8 is_stmt 0 view .LVU311
+	movaps	%xmm4, %xmm2
+	mulss	%xmm4, %xmm2
+.LVL86:
+	.loc 1 217 5 is_stmt 1 view .LVU312
+	.loc 1 217 17 is_stmt 0 view .LVU313
+	addss	%xmm4, %xmm4
+	.loc 1 217 74 view .LVU314
+	mulss	%xmm2, %xmm3
+	.loc 1 217 69 view .LVU315
+	addss	.LC31(%rip), %xmm3
+	.loc 1 217 54 view .LVU316
+	mulss	%xmm2, %xmm3
+	.loc 1 217 49 view .LVU317
+	addss	.LC32(%rip), %xmm3
+	.loc 1 217 34 view .LVU318
+	mulss	%xmm2, %xmm3
+	.loc 1 217 104 view .LVU319
+	pxor	%xmm2, %xmm2
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 217 29 view .LVU320
+	addss	%xmm0, %xmm3
+	.loc 1 217 21 view .LVU321
+	mulss	%xmm4, %xmm3
+	.loc 1 217 104 view .LVU322
+	movss	.LC33(%rip), %xmm4
+	mulss	%xmm4, %xmm2
+	.loc 1 217 93 view .LVU323
+	addss	%xmm2, %xmm3
+.LBE22:
+.LBE27:
+	.loc 1 238 20 view .LVU324
+	mulss	.LC34(%rip), %xmm3
+.LVL87:
+.LBB28:
+.LBI24:
+	.loc 1 223 14 is_stmt 1 view .LVU325
+.LBB26:
+	.loc 1 225 5 view .LVU326
+	.loc 1 225 29 is_stmt 0 view .LVU327
+	movss	.LC35(%rip), %xmm2
+	mulss	%xmm3, %xmm2
+	.loc 1 225 72 view .LVU328
+	comiss	%xmm6, %xmm3
+	jnb	.L95
+	movss	.LC3(%rip), %xmm5
+.L95:
+	.loc 1 225 52 view .LVU329
+	addss	%xmm5, %xmm2
+	.loc 1 225 13 view .LVU330
+	cvttss2sil	%xmm2, %eax
+.LVL88:
+	.loc 1 226 5 is_stmt 1 view .LVU331
+	.loc 1 226 21 is_stmt 0 view .LVU332
+	pxor	%xmm2, %xmm2
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 231 25 view .LVU333
+	sall	$23, %eax
+.LVL89:
+	.loc 1 226 21 view .LVU334
+	mulss	%xmm4, %xmm2
+	.loc 1 226 11 view .LVU335
+	subss	%xmm2, %xmm3
+.LVL90:
+	.loc 1 227 5 is_stmt 1 view .LVU336
+	.loc 1 228 5 view .LVU337
+	.loc 1 230 5 view .LVU338
+	.loc 1 231 5 view .LVU339
+	.loc 1 232 5 view .LVU340
+	.loc 1 233 5 view .LVU341
+	.loc 1 227 126 is_stmt 0 view .LVU342
+	movss	.LC36(%rip), %xmm2
+	mulss	%xmm3, %xmm2
+	.loc 1 227 122 view .LVU343
+	addss	.LC37(%rip), %xmm2
+	.loc 1 227 108 view .LVU344
+	mulss	%xmm3, %xmm2
+	.loc 1 227 104 view .LVU345
+	addss	.LC38(%rip), %xmm2
+	.loc 1 227 90 view .LVU346
+	mulss	%xmm3, %xmm2
+	.loc 1 227 86 view .LVU347
+	addss	.LC39(%rip), %xmm2
+	.loc 1 227 73 view .LVU348
+	mulss	%xmm3, %xmm2
+	.loc 1 227 69 view .LVU349
+	addss	.LC40(%rip), %xmm2
+	.loc 1 227 57 view .LVU350
+	mulss	%xmm3, %xmm2
+	.loc 1 227 53 view .LVU351
+	addss	%xmm2, %xmm1
+	.loc 1 227 41 view .LVU352
+	mulss	%xmm3, %xmm1
+	.loc 1 227 37 view .LVU353
+	addss	%xmm0, %xmm1
+	.loc 1 227 29 view .LVU354
+	mulss	%xmm3, %xmm1
+	.loc 1 227 25 view .LVU355
+	addss	%xmm0, %xmm1
+	.loc 1 231 10 view .LVU356
+	movd	%xmm1, %ecx
+	addl	%ecx, %eax
+.LBE26:
+.LBE28:
+	.loc 1 238 18 view .LVU357
+	movd	%eax, %xmm7
+	subss	%xmm7, %xmm0
+	.loc 1 238 78 view .LVU358
+	mulss	.LC41(%rip), %xmm0
+	.loc 1 239 1 view .LVU359
+	ret
+.LVL91:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+.LBB29:
+.LBB23:
+	.loc 1 211 9 is_stmt 1 view .LVU360
+	.loc 1 211 11 is_stmt 0 view .LVU361
+	movss	.LC2(%rip), %xmm1
+	.loc 1 212 17 view .LVU362
+	leal	-126(%rdx), %eax
+	.loc 1 211 11 view .LVU363
+	mulss	%xmm1, %xmm2
+	.loc 1 212 9 is_stmt 1 view .LVU364
+.LVL92:
+	.loc 1 212 9 is_stmt 0 view .LVU365
+	jmp	.L94
+.LBE23:
+.LBE29:
+	.cfi_endproc
+.LFE16:
+	.size	pressureToAltitude, .-pressureToAltitude
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	-1571644103
+	.long	1066524486
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC2:
+	.long	1056964608
+	.align 4
+.LC3:
+	.long	-1090519040
+	.align 4
+.LC4:
+	.long	1042479491
+	.align 4
+.LC5:
+	.long	1086918619
+	.align 4
+.LC6:
+	.long	1070141403
+	.align 4
+.LC7:
+	.long	1078530011
+	.align 4
+.LC8:
+	.long	-1077342245
+	.align 4
+.LC9:
+	.long	-1068953637
+	.align 4
+.LC10:
+	.long	-1186863214
+	.align 4
+.LC11:
+	.long	1007169687
+	.align 4
+.LC12:
+	.long	1042982933
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC13:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4
+	.align 4
+.LC14:
+	.long	1028524345
+	.align 4
+.LC15:
+	.long	1050588643
+	.align 4
+.LC16:
+	.long	1041693320
+	.align 4
+.LC17:
+	.long	1065352773
+	.align 4
+.LC18:
+	.long	883482535
+	.section	.rodata.cst16
+	.align 16
+.LC19:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4
+	.align 4
+.LC20:
+	.long	1059388313
+	.align 4
+.LC21:
+	.long	1041670761
+	.align 4
+.LC22:
+	.long	1065353216
+	.align 4
+.LC23:
+	.long	-1130795472
+	.align 4
+.LC24:
+	.long	1033377319
+	.align 4
+.LC25:
+	.long	1046033540
+	.align 4
+.LC26:
+	.long	1070140836
+	.align 4
+.LC27:
+	.long	1069547520
+	.align 4
+.LC28:
+	.long	1204151936
+	.align 4
+.LC29:
+	.long	1068827891
+	.align 4
+.LC30:
+	.long	1041385765
+	.align 4
+.LC31:
+	.long	1045220557
+	.align 4
+.LC32:
+	.long	1051372203
+	.align 4
+.LC33:
+	.long	1060205080
+	.align 4
+.LC34:
+	.long	1044569265
+	.align 4
+.LC35:
+	.long	1069066811
+	.align 4
+.LC36:
+	.long	961547521
+	.align 4
+.LC37:
+	.long	985008993
+	.align 4
+.LC38:
+	.long	1007192201
+	.align 4
+.LC39:
+	.long	1026206379
+	.align 4
+.LC40:
+	.long	1042983595
+	.align 4
+.LC41:
+	.long	1250379984
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/common/maths.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x79a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF1227
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL46
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1171
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1172
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1173
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1174
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1175
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1176
+	.uleb128 0x6
+	.long	.LASF1178
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x6b
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1177
+	.uleb128 0x6
+	.long	.LASF1179
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x35
+	.uleb128 0x6
+	.long	.LASF1180
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1181
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1182
+	.uleb128 0x6
+	.long	.LASF1183
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x6
+	.long	.LASF1184
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x72
+	.uleb128 0x6
+	.long	.LASF1185
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1186
+	.uleb128 0x18
+	.long	.LASF1191
+	.byte	0x14
+	.byte	0x5
+	.byte	0x25
+	.byte	0x10
+	.long	0x10a
+	.uleb128 0xc
+	.long	.LASF1187
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1188
+	.byte	0x13
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0xc
+	.long	.LASF1189
+	.byte	0x1b
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF1190
+	.byte	0x23
+	.long	0x2e
+	.byte	0xc
+	.uleb128 0x19
+	.string	"m_n"
+	.byte	0x5
+	.byte	0x28
+	.byte	0x9
+	.long	0x35
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1191
+	.byte	0x5
+	.byte	0x29
+	.byte	0x3
+	.long	0xc3
+	.uleb128 0x1a
+	.long	.LASF1207
+	.byte	0x6
+	.byte	0x8f
+	.byte	0xe
+	.long	0x2e
+	.long	0x12c
+	.uleb128 0x1b
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1197
+	.byte	0xec
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x21c
+	.uleb128 0x7
+	.long	.LASF1199
+	.byte	0xec
+	.byte	0x20
+	.long	0x2e
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x10
+	.long	0x25c
+	.quad	.LBI20
+	.byte	.LVU285
+	.long	.LLRL35
+	.byte	0xee
+	.byte	0x2b
+	.long	0x1c7
+	.uleb128 0x9
+	.long	0x26a
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0xe
+	.long	.LLRL35
+	.uleb128 0x2
+	.long	0x273
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x27e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1c
+	.long	0x289
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x2
+	.long	0x292
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x2
+	.long	0x29b
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x21c
+	.quad	.LBI24
+	.byte	.LVU325
+	.long	.LLRL41
+	.byte	0xee
+	.byte	0x14
+	.uleb128 0x9
+	.long	0x22a
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xe
+	.long	.LLRL41
+	.uleb128 0x2
+	.long	0x233
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x2
+	.long	0x23c
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x1d
+	.long	0x245
+	.uleb128 0x2
+	.long	0x250
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1194
+	.byte	0xdf
+	.long	0x2e
+	.long	0x25c
+	.uleb128 0xd
+	.string	"x"
+	.byte	0xdf
+	.byte	0x1f
+	.long	0x2e
+	.uleb128 0x8
+	.string	"k"
+	.byte	0xe1
+	.byte	0xd
+	.long	0xa4
+	.uleb128 0x8
+	.string	"r"
+	.byte	0xe2
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1192
+	.byte	0xe3
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1193
+	.byte	0xe4
+	.byte	0xe
+	.long	0xb0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1195
+	.byte	0xc7
+	.long	0x2e
+	.long	0x2a6
+	.uleb128 0xd
+	.string	"x"
+	.byte	0xc7
+	.byte	0x1f
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1193
+	.byte	0xc9
+	.byte	0xe
+	.long	0xb0
+	.uleb128 0xa
+	.long	.LASF1196
+	.byte	0xca
+	.byte	0xd
+	.long	0xa4
+	.uleb128 0x8
+	.string	"m"
+	.byte	0xcb
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x8
+	.string	"z"
+	.byte	0xcb
+	.byte	0xe
+	.long	0x2e
+	.uleb128 0x8
+	.string	"z2"
+	.byte	0xcb
+	.byte	0x11
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1198
+	.byte	0xb4
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x308
+	.uleb128 0x4
+	.string	"x"
+	.byte	0xb4
+	.byte	0x1c
+	.long	0x2e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0xb6
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x8
+	.string	"y"
+	.byte	0xb7
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x5
+	.long	.LASF1193
+	.byte	0xb8
+	.byte	0xe
+	.long	0xb0
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0xa8
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36e
+	.uleb128 0x4
+	.string	"x"
+	.byte	0xa8
+	.byte	0x19
+	.long	0x2e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x5
+	.long	.LASF1202
+	.byte	0xaa
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x5
+	.long	.LASF1192
+	.byte	0xab
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x1e
+	.quad	.LVL73
+	.long	0x116
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0x8d
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3fe
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x2e
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x8d
+	.byte	0x23
+	.long	0x2e
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x5
+	.long	.LASF1202
+	.byte	0x8f
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0x90
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0x91
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x5
+	.long	.LASF1192
+	.byte	0x92
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1206
+	.byte	0x7f
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x473
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x7f
+	.byte	0x18
+	.long	0x2e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x11
+	.long	0x473
+	.quad	.LBI10
+	.byte	.LVU150
+	.long	.LLRL18
+	.byte	0x81
+	.byte	0xc
+	.uleb128 0x9
+	.long	0x481
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xe
+	.long	.LLRL18
+	.uleb128 0x2
+	.long	0x48a
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x2
+	.long	0x495
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1208
+	.byte	0x70
+	.long	0x2e
+	.long	0x4a0
+	.uleb128 0xd
+	.string	"x"
+	.byte	0x70
+	.byte	0x18
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1209
+	.byte	0x73
+	.byte	0xd
+	.long	0xa4
+	.uleb128 0x8
+	.string	"x2"
+	.byte	0x7b
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0x5d
+	.byte	0x5
+	.long	0x35
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x533
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x5d
+	.byte	0x14
+	.long	0x35
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xf
+	.long	.LASF1212
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.long	.LASF1211
+	.byte	0x5d
+	.byte	0x27
+	.long	0x35
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xf
+	.long	.LASF1213
+	.byte	0x5d
+	.byte	0x33
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x7
+	.long	.LASF1214
+	.byte	0x5d
+	.byte	0x40
+	.long	0x35
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x14
+	.string	"a"
+	.byte	0x5e
+	.long	0x8a
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x14
+	.string	"b"
+	.byte	0x5f
+	.long	0x8a
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0x58
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x562
+	.uleb128 0xf
+	.long	.LASF1216
+	.byte	0x58
+	.byte	0x20
+	.long	0x98
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x53
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ca
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x53
+	.byte	0x25
+	.long	0x5ca
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x10
+	.long	0x5d0
+	.quad	.LBI4
+	.byte	.LVU72
+	.long	.LLRL7
+	.byte	0x55
+	.byte	0xc
+	.long	0x5bc
+	.uleb128 0x9
+	.long	0x5de
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL21
+	.long	0x116
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.long	0x10a
+	.uleb128 0x13
+	.long	.LASF1218
+	.byte	0x4e
+	.long	0x2e
+	.long	0x5ea
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x4e
+	.byte	0x1c
+	.long	0x5ca
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1219
+	.byte	0x40
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x625
+	.uleb128 0xb
+	.string	"dev"
+	.byte	0x40
+	.byte	0x17
+	.long	0x5ca
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x40
+	.byte	0x22
+	.long	0x2e
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1220
+	.byte	0x3b
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x64f
+	.uleb128 0xb
+	.string	"dev"
+	.byte	0x3b
+	.byte	0x18
+	.long	0x5ca
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x31
+	.byte	0x7
+	.long	0x2e
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a4
+	.uleb128 0x4
+	.string	"amt"
+	.byte	0x31
+	.byte	0x18
+	.long	0x2e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xb
+	.string	"low"
+	.byte	0x31
+	.byte	0x23
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.long	.LASF1222
+	.byte	0x31
+	.byte	0x2e
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x27
+	.byte	0x5
+	.long	0x35
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f3
+	.uleb128 0xb
+	.string	"amt"
+	.byte	0x27
+	.byte	0x13
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.string	"low"
+	.byte	0x27
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.long	.LASF1222
+	.byte	0x27
+	.byte	0x25
+	.long	0x35
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x1b
+	.byte	0x9
+	.long	0xa4
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x73b
+	.uleb128 0x7
+	.long	.LASF1225
+	.byte	0x1b
+	.byte	0x1f
+	.long	0xa4
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	.LASF1226
+	.byte	0x1b
+	.byte	0x2e
+	.long	0xa4
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x21
+	.long	0x5d0
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75e
+	.uleb128 0x22
+	.long	0x5de
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x23
+	.long	0x473
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x9
+	.long	0x481
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	0x48a
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	0x495
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST34:
+	.byte	0x6
+	.quad	.LVL79
+	.byte	0x4
+	.uleb128 .LVL79-.LVL79
+	.uleb128 .LVL80-.LVL79
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL80-.LVL79
+	.uleb128 .LFE16-.LVL79
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU285
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU313
+	.uleb128 .LVU360
+	.uleb128 0
+.LLST36:
+	.byte	0x6
+	.quad	.LVL79
+	.byte	0x4
+	.uleb128 .LVL79-.LVL79
+	.uleb128 .LVL80-.LVL79
+	.uleb128 0xc
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x47c5e680
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.LVL79
+	.uleb128 .LVL84-.LVL79
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL84-.LVL79
+	.uleb128 .LVL86-.LVL79
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x47c5e680
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.LVL79
+	.uleb128 .LFE16-.LVL79
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU291
+	.uleb128 .LVU298
+.LLST37:
+	.byte	0x8
+	.quad	.LVL81
+	.uleb128 .LVL82-.LVL81
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU297
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU313
+	.uleb128 .LVU360
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 0
+.LLST38:
+	.byte	0x6
+	.quad	.LVL82
+	.byte	0x4
+	.uleb128 .LVL82-.LVL82
+	.uleb128 .LVL83-.LVL82
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 -127
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL82
+	.uleb128 .LVL86-.LVL82
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.LVL82
+	.uleb128 .LVL92-.LVL82
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 -127
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.LVL82
+	.uleb128 .LFE16-.LVL82
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU310
+	.uleb128 .LVU313
+.LLST39:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL86-.LVL85
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU312
+	.uleb128 .LVU313
+.LLST40:
+	.byte	0x8
+	.quad	.LVL86
+	.uleb128 .LVL86-.LVL86
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU325
+	.uleb128 .LVU336
+.LLST42:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL90-.LVL87
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU331
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 .LVU336
+.LLST43:
+	.byte	0x6
+	.quad	.LVL88
+	.byte	0x4
+	.uleb128 .LVL88-.LVL88
+	.uleb128 .LVL89-.LVL88
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.LVL88
+	.uleb128 .LVL90-.LVL88
+	.uleb128 0x14
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3fb8aa3b
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU336
+	.uleb128 .LVU342
+.LLST44:
+	.byte	0x8
+	.quad	.LVL90
+	.uleb128 .LVL90-.LVL90
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU339
+	.uleb128 .LVU340
+.LLST45:
+	.byte	0x8
+	.quad	.LVL90
+	.uleb128 .LVL90-.LVL90
+	.uleb128 0x60
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x39500d01
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3ab60b61
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3c088889
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3d2aaaab
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3e2aaaab
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f000000
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x22
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x22
+	.byte	0xa9
+	.uleb128 0x3c
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 0
+.LLST31:
+	.byte	0x6
+	.quad	.LVL74
+	.byte	0x4
+	.uleb128 .LVL74-.LVL74
+	.uleb128 .LVL77-.LVL74
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL77-.LVL74
+	.uleb128 .LFE13-.LVL74
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU264
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL75
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL78-.LVL75
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL78-.LVL75
+	.uleb128 .LFE13-.LVL75
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f000000
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU267
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL75
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL75-.LVL75
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL76-.LVL75
+	.uleb128 0xb
+	.byte	0xc
+	.long	0x5f3759df
+	.byte	0x81
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL75
+	.uleb128 .LFE13-.LVL75
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL66
+	.byte	0x4
+	.uleb128 .LVL66-.LVL66
+	.uleb128 .LVL68-.LVL66
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL68-.LVL66
+	.uleb128 .LVL69-.LVL66
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL69-.LVL66
+	.uleb128 .LVL72-.LVL66
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.LVL66
+	.uleb128 .LVL73-1-.LVL66
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL73-1-.LVL66
+	.uleb128 .LFE12-.LVL66
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU238
+	.uleb128 .LVU241
+	.uleb128 .LVU256
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL69-.LVL67
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL72-.LVL67
+	.uleb128 .LVL73-1-.LVL67
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL73-1-.LVL67
+	.uleb128 .LFE12-.LVL67
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU248
+	.uleb128 .LVU255
+.LLST30:
+	.byte	0x8
+	.quad	.LVL70
+	.uleb128 .LVL71-.LVL70
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 0
+.LLST22:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL57-.LVL54
+	.uleb128 .LFE11-.LVL54
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 0
+.LLST23:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL63-.LVL54
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL63-.LVL54
+	.uleb128 .LFE11-.LVL54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST24:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LFE11-.LVL55
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST25:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LFE11-.LVL56
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU192
+	.uleb128 .LVU214
+.LLST26:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL60-.LVL58
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU217
+	.uleb128 .LVU231
+.LLST27:
+	.byte	0x8
+	.quad	.LVL61
+	.uleb128 .LVL65-.LVL61
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL45-.LVL43
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL45-.LVL43
+	.uleb128 .LFE10-.LVL43
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU150
+	.uleb128 .LVU169
+	.uleb128 .LVU177
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL51-.LVL44
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL52-.LVL44
+	.uleb128 .LVL53-.LVL44
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL53-.LVL44
+	.uleb128 .LFE10-.LVL44
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 .LVU169
+	.uleb128 .LVU177
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL46
+	.byte	0x4
+	.uleb128 .LVL46-.LVL46
+	.uleb128 .LVL47-.LVL46
+	.uleb128 0xc
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL46
+	.uleb128 .LVL48-.LVL46
+	.uleb128 0x14
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3e22f983
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL46
+	.uleb128 .LVL51-.LVL46
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.LVL46
+	.uleb128 .LFE10-.LVL46
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU168
+	.uleb128 .LVU169
+.LLST21:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL51-.LVL51
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL26-.LVL23
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.LVL23
+	.uleb128 .LFE8-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL30-.LVL23
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL30-.LVL23
+	.uleb128 .LFE8-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL25-.LVL23
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL25-.LVL23
+	.uleb128 .LVL27-.LVL23
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL27-.LVL23
+	.uleb128 .LFE8-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x1e
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL24
+	.uleb128 .LVL26-.LVL24
+	.uleb128 0x1e
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL24
+	.uleb128 .LVL27-.LVL24
+	.uleb128 0x1f
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL24
+	.uleb128 .LVL28-.LVL24
+	.uleb128 0x20
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL24
+	.uleb128 .LVL31-.LVL24
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL31-.LVL24
+	.uleb128 .LFE8-.LVL24
+	.uleb128 0x20
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1c
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU97
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL29-.LVL24
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL24
+	.uleb128 .LFE8-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL21-1-.LVL17
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-1-.LVL17
+	.uleb128 .LFE6-.LVL17
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU72
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+.LLST8:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.LVL17
+	.uleb128 .LVL20-.LVL17
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL13-.LVL12
+	.uleb128 .LVL14-.LVL12
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL15-.LVL12
+	.uleb128 .LFE4-.LVL12
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL8-.LVL6
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL8-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL6
+	.uleb128 .LVL10-.LVL6
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL10-.LVL6
+	.uleb128 .LFE2-.LVL6
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL7-.LVL6
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL7-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL6
+	.uleb128 .LFE2-.LVL6
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL5-.LVL4
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.LVL4
+	.uleb128 .LFE1-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU10
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL32
+	.byte	0x4
+	.uleb128 .LVL32-.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL33-.LVL32
+	.uleb128 .LVL42-.LVL32
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL42-.LVL32
+	.uleb128 .LFE9-.LVL32
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0xc
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL34
+	.uleb128 .LVL36-.LVL34
+	.uleb128 0x14
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3e22f983
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL34
+	.uleb128 .LFE9-.LVL34
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU131
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU140
+.LLST16:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL40-.LVL39
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL40-.LVL39
+	.uleb128 .LVL41-.LVL39
+	.uleb128 0x6
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x10c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL7:
+	.byte	0x5
+	.quad	.LBB4
+	.byte	0x4
+	.uleb128 .LBB4-.LBB4
+	.uleb128 .LBE4-.LBB4
+	.byte	0x4
+	.uleb128 .LBB7-.LBB4
+	.uleb128 .LBE7-.LBB4
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB10
+	.byte	0x4
+	.uleb128 .LBB10-.LBB10
+	.uleb128 .LBE10-.LBB10
+	.byte	0x4
+	.uleb128 .LBB14-.LBB10
+	.uleb128 .LBE14-.LBB10
+	.byte	0x4
+	.uleb128 .LBB15-.LBB10
+	.uleb128 .LBE15-.LBB10
+	.byte	0
+.LLRL35:
+	.byte	0x5
+	.quad	.LBB20
+	.byte	0x4
+	.uleb128 .LBB20-.LBB20
+	.uleb128 .LBE20-.LBB20
+	.byte	0x4
+	.uleb128 .LBB27-.LBB20
+	.uleb128 .LBE27-.LBB20
+	.byte	0x4
+	.uleb128 .LBB29-.LBB20
+	.uleb128 .LBE29-.LBB20
+	.byte	0
+.LLRL41:
+	.byte	0x5
+	.quad	.LBB24
+	.byte	0x4
+	.uleb128 .LBB24-.LBB24
+	.uleb128 .LBE24-.LBB24
+	.byte	0x4
+	.uleb128 .LBB28-.LBB24
+	.uleb128 .LBE28-.LBB24
+	.byte	0
+.LLRL46:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB8
+	.uleb128 .LFE8-.LFB8
+	.byte	0x7
+	.quad	.LFB9
+	.uleb128 .LFE9-.LFB9
+	.byte	0x7
+	.quad	.LFB10
+	.uleb128 .LFE10-.LFB10
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 23 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 27 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1000
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1027
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 37 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.file 38 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 39 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1170
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF992
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1029
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1056
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1120
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1130
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1149
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1156
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF800:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1096:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF793:
+	.string	"__DECL_SIMD_atan "
+.LASF995:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1203:
+	.string	"atan2_approx"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF963:
+	.string	"__DECL_SIMD_asinh "
+.LASF1003:
+	.string	"__HAVE_FLOAT64 1"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1138:
+	.string	"ACC "
+.LASF961:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1015:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1041:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF849:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1213:
+	.string	"destMin"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF815:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1184:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF883:
+	.string	"__DECL_SIMD_atan2 "
+.LASF775:
+	.string	"__DECL_SIMD_powl "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1133:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF834:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF807:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1111:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1183:
+	.string	"int16_t"
+.LASF1068:
+	.string	"__MATHDECL_1_IMPL"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1024:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1143:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF778:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1120:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF851:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF802:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1127:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1137:
+	.string	"USE_GYRO_SITL "
+.LASF783:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF472:
+	.string	"__P(args) args"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1110:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1153:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF926:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1114:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1086:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1062:
+	.string	"_Mdouble_ _Float128"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1002:
+	.string	"__HAVE_FLOAT32 1"
+.LASF984:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF791:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1205:
+	.string	"ratio"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF745:
+	.string	"__DECL_SIMD_sincosl "
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF761:
+	.string	"__DECL_SIMD_logf64x "
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_log1p "
+.LASF1084:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1220:
+	.string	"devClear"
+.LASF782:
+	.string	"__DECL_SIMD_powf128x "
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF715:
+	.string	"NULL"
+.LASF1129:
+	.string	"U_ID_1 0"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1064:
+	.string	"_Mdouble_ _Float32x"
+.LASF1169:
+	.string	"ATAN_POLY_COEF6 0.1471039133652469f"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1192:
+	.string	"result"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1088:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1193:
+	.string	"bits"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1139:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF850:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1036:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1224:
+	.string	"applyDeadband"
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1181:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1029:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1071:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1100:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1051:
+	.string	"_Mdouble_ float"
+.LASF953:
+	.string	"__DECL_SIMD_tanh "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1063:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF924:
+	.string	"__DECL_SIMD_atanhf "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1045:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF835:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1048:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF813:
+	.string	"__DECL_SIMD_hypot "
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1194:
+	.string	"exp_approx"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF847:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF869:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF725:
+	.string	"__DECL_SIMD_cosl "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1091:
+	.string	"FP_SUBNORMAL 3"
+.LASF1222:
+	.string	"high"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1070:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1013:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF755:
+	.string	"__DECL_SIMD_logl "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF902:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF939:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF906:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1176:
+	.string	"signed char"
+.LASF904:
+	.string	"__DECL_SIMD_log2f "
+.LASF696:
+	.string	"__size_t__ "
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1017:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1187:
+	.string	"m_oldM"
+.LASF912:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1097:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1145:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF898:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1054:
+	.string	"_Mdouble_ long double"
+.LASF1173:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF763:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1146:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1047:
+	.string	"_Mdouble_"
+.LASF1210:
+	.string	"scaleRange"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1151:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1119:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1023:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1026:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF812:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1217:
+	.string	"devStandardDeviation"
+.LASF1225:
+	.string	"value"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1223:
+	.string	"constrain"
+.LASF1199:
+	.string	"pressure"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF999:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1106:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF788:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF884:
+	.string	"__DECL_SIMD_atan2f "
+.LASF825:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1094:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1154:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF734:
+	.string	"__DECL_SIMD_sinf "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1134:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1089:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF839:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF789:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF829:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF727:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1124:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF964:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1018:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF937:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF945:
+	.string	"__DECL_SIMD_erfl "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1090:
+	.string	"FP_ZERO 2"
+.LASF1125:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1046:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1116:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1131:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF767:
+	.string	"__DECL_SIMD_expf32 "
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF810:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF841:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1198:
+	.string	"invSqrt_approx"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF909:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1189:
+	.string	"m_oldS"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF975:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF863:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1135:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF797:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF925:
+	.string	"__DECL_SIMD_atanhl "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1035:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF726:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF910:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1043:
+	.string	"_Mdouble_ double"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1066:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF974:
+	.string	"__DECL_SIMD_erfcf "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF915:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF911:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF786:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF768:
+	.string	"__DECL_SIMD_expf64 "
+.LASF803:
+	.string	"__DECL_SIMD_asin "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1215:
+	.string	"degreesToRadians"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1056:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1147:
+	.string	"BLACKBOX "
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF852:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF824:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1095:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF781:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF905:
+	.string	"__DECL_SIMD_log2l "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF929:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF960:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1027:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1164:
+	.string	"ATAN_POLY_COEF1 3.14551665884836e-07f"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF732:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF833:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF989:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF729:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF777:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1130:
+	.string	"U_ID_2 0"
+.LASF934:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1014:
+	.string	"__f32(x) x ##f32"
+.LASF1170:
+	.string	"ATAN_POLY_COEF7 0.6444640676891548f"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF896:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF766:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1211:
+	.string	"srcMax"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1037:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1085:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1166:
+	.string	"ATAN_POLY_COEF3 0.14744007058297684f"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1099:
+	.string	"MATH_ERRNO 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1144:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF991:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF992:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1020:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF784:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF754:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1117:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF894:
+	.string	"__DECL_SIMD_log10f "
+.LASF895:
+	.string	"__DECL_SIMD_log10l "
+.LASF885:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1069:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF773:
+	.string	"__DECL_SIMD_pow "
+.LASF1201:
+	.string	"acos_approx"
+.LASF1019:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1212:
+	.string	"srcMin"
+.LASF735:
+	.string	"__DECL_SIMD_sinl "
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1108:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1180:
+	.string	"__uint32_t"
+.LASF1221:
+	.string	"constrainf"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1165:
+	.string	"ATAN_POLY_COEF2 0.99997356613987f"
+.LASF1103:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF873:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF723:
+	.string	"__DECL_SIMD_cos "
+.LASF1012:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1159:
+	.string	"M_2PI_F (2.0f * M_PI_F)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF739:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF864:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1121:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1186:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1105:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF462:
+	.string	"__PMT"
+.LASF1078:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF780:
+	.string	"__DECL_SIMD_powf32x "
+.LASF933:
+	.string	"__DECL_SIMD_acosh "
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF900:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF982:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1061:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF998:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1157:
+	.string	"M_PI_F 3.14159265358979323846f"
+.LASF801:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1057:
+	.string	"_Mdouble_ _Float32"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF770:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1101:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1107:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF853:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF919:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF854:
+	.string	"__DECL_SIMD_expm1f "
+.LASF994:
+	.string	"__HAVE_FLOAT128 1"
+.LASF897:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1172:
+	.string	"unsigned int"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF958:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF903:
+	.string	"__DECL_SIMD_log2 "
+.LASF874:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1042:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1118:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF988:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1162:
+	.string	"SIN_POLY_COEF5 8.312366210e-3f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1122:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF893:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF769:
+	.string	"__DECL_SIMD_expf128 "
+.LASF908:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF744:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1216:
+	.string	"degrees"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF774:
+	.string	"__DECL_SIMD_powf "
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1142:
+	.string	"USE_USART1 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF776:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1200:
+	.string	"halfX"
+.LASF1150:
+	.string	"sq(x) ((x)*(x))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF771:
+	.string	"__DECL_SIMD_expf64x "
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF758:
+	.string	"__DECL_SIMD_logf64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1083:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF956:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF740:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1005:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1202:
+	.string	"absX"
+.LASF1204:
+	.string	"absY"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF935:
+	.string	"__DECL_SIMD_acoshl "
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF859:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF822:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1167:
+	.string	"ATAN_POLY_COEF4 0.3099814292351353f"
+.LASF1182:
+	.string	"char"
+.LASF765:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF990:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF698:
+	.string	"_SIZE_T "
+.LASF948:
+	.string	"__DECL_SIMD_erff64 "
+.LASF844:
+	.string	"__DECL_SIMD_coshf "
+.LASF759:
+	.string	"__DECL_SIMD_logf128 "
+.LASF779:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1191:
+	.string	"stdev_t"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1132:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF809:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1174:
+	.string	"short unsigned int"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF940:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF917:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1136:
+	.string	"GYRO "
+.LASF753:
+	.string	"__DECL_SIMD_log "
+.LASF1209:
+	.string	"turns"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1113:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF721:
+	.string	"_MATH_H 1"
+.LASF987:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF997:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF756:
+	.string	"__DECL_SIMD_logf16 "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF986:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1030:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF811:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF916:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1093:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF954:
+	.string	"__DECL_SIMD_tanhf "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1140:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF796:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1128:
+	.string	"U_ID_0 0x5349544c"
+.LASF983:
+	.string	"__DECL_SIMD_tan "
+.LASF748:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1087:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1098:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1175:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF901:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF865:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF742:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1031:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF785:
+	.string	"__DECL_SIMD_acosl "
+.LASF946:
+	.string	"__DECL_SIMD_erff16 "
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1040:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1038:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF713:
+	.string	"__size_t "
+.LASF887:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF823:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1196:
+	.string	"exponent"
+.LASF1126:
+	.string	"__disable_irq() "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1227:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF965:
+	.string	"__DECL_SIMD_asinhl "
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF731:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF979:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF722:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1178:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF855:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF764:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF746:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF952:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1058:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF993:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF792:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF875:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1149:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF944:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1214:
+	.string	"destMax"
+.LASF806:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1206:
+	.string	"cos_approx"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF733:
+	.string	"__DECL_SIMD_sin "
+.LASF1092:
+	.string	"FP_NORMAL 4"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1022:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1000:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1004:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1226:
+	.string	"deadband"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF996:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1163:
+	.string	"SIN_POLY_COEF7 -1.849218155e-4f"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF724:
+	.string	"__DECL_SIMD_cosf "
+.LASF747:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1141:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1055:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF737:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF794:
+	.string	"__DECL_SIMD_atanf "
+.LASF1156:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF923:
+	.string	"__DECL_SIMD_atanh "
+.LASF914:
+	.string	"__DECL_SIMD_log1pf "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1177:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF985:
+	.string	"__DECL_SIMD_tanl "
+.LASF943:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF842:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF949:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF845:
+	.string	"__DECL_SIMD_coshl "
+.LASF814:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1115:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1034:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF848:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF772:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF808:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF973:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1072:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF738:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1016:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1152:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF951:
+	.string	"__DECL_SIMD_erff64x "
+.LASF891:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1039:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF798:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1195:
+	.string	"log_approx"
+.LASF1028:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF843:
+	.string	"__DECL_SIMD_cosh "
+.LASF886:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1208:
+	.string	"sin_approx"
+.LASF1158:
+	.string	"M_PI_2_F (M_PI_F / 2.0f)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF805:
+	.string	"__DECL_SIMD_asinl "
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF959:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF955:
+	.string	"__DECL_SIMD_tanhl "
+.LASF799:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF957:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF857:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF846:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1001:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1185:
+	.string	"uint32_t"
+.LASF1155:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF743:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF907:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1032:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF736:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF947:
+	.string	"__DECL_SIMD_erff32 "
+.LASF930:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1033:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1188:
+	.string	"m_newM"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF787:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF741:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF1190:
+	.string	"m_newS"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1171:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1060:
+	.string	"_Mdouble_ _Float64"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1160:
+	.string	"M_LN2_F 0.69314718f"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF804:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF795:
+	.string	"__DECL_SIMD_atanl "
+.LASF757:
+	.string	"__DECL_SIMD_logf32 "
+.LASF950:
+	.string	"__DECL_SIMD_erff32x "
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF730:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1044:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1161:
+	.string	"SIN_POLY_COEF3 -1.666568107e-1f"
+.LASF1179:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1021:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1112:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF790:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF760:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1197:
+	.string	"pressureToAltitude"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1168:
+	.string	"ATAN_POLY_COEF5 0.05030176425872175f"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF1052:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1219:
+	.string	"devPush"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1207:
+	.string	"sqrtf"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1109:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1102:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1148:
+	.string	"PROFILING "
+.LASF1218:
+	.string	"devVariance"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1123:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF728:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/common/maths.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9982 @@
+	.file	"printf.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/printf.c"
+	.section	.text.putchw,"ax",@progbits
+	.p2align 4
+	.type	putchw, @function
+putchw:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/common/printf.c"
+	.loc 1 60 1 view -0
+	.cfi_startproc
+	.loc 1 60 1 is_stmt 0 view .LVU1
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r8, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 64 14 view .LVU2
+	leaq	1(%r8), %r12
+	.loc 1 60 1 view .LVU3
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	.loc 1 61 5 is_stmt 1 view .LVU4
+	.loc 1 60 1 is_stmt 0 view .LVU5
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 61 10 view .LVU6
+	cmpb	$1, %cl
+	.loc 1 64 12 view .LVU7
+	movsbl	(%r8), %esi
+.LVL1:
+	.loc 1 61 10 view .LVU8
+	sbbl	%r15d, %r15d
+	andl	$-16, %r15d
+	addl	$48, %r15d
+.LVL2:
+	.loc 1 62 5 is_stmt 1 view .LVU9
+	.loc 1 63 5 view .LVU10
+	.loc 1 64 5 view .LVU11
+	.loc 1 64 17 view .LVU12
+	.loc 1 64 17 is_stmt 0 view .LVU13
+	testl	%edx, %edx
+	jle	.L3
+	.loc 1 64 17 discriminator 4 view .LVU14
+	testb	%sil, %sil
+	je	.L3
+	.loc 1 64 14 view .LVU15
+	movq	%r12, %rax
+	jmp	.L4
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 64 17 view .LVU16
+	testl	%edx, %edx
+	jle	.L6
+.L4:
+	.loc 1 65 9 is_stmt 1 view .LVU17
+	.loc 1 64 14 is_stmt 0 view .LVU18
+	addq	$1, %rax
+.LVL4:
+	.loc 1 64 14 view .LVU19
+	movl	%edx, %r14d
+	.loc 1 65 10 view .LVU20
+	subl	$1, %edx
+.LVL5:
+	.loc 1 64 17 is_stmt 1 view .LVU21
+	.loc 1 64 17 is_stmt 0 view .LVU22
+	cmpb	$0, -1(%rax)
+	jne	.L28
+.L6:
+	.loc 1 66 16 is_stmt 1 view .LVU23
+	.loc 1 66 13 is_stmt 0 view .LVU24
+	subl	$2, %r14d
+.LVL6:
+	.loc 1 66 16 view .LVU25
+	testl	%edx, %edx
+	je	.L10
+.LVL7:
+.L12:
+	.loc 1 67 9 view .LVU26
+	movsbl	%r15b, %r15d
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 67 9 is_stmt 1 view .LVU27
+	movl	%r15d, %esi
+	movq	%rbx, %rdi
+	call	*%rbp
+.LVL9:
+	.loc 1 66 16 view .LVU28
+	subl	$1, %r14d
+.LVL10:
+	.loc 1 66 16 is_stmt 0 view .LVU29
+	jnb	.L8
+	.loc 1 68 16 view .LVU30
+	movsbl	0(%r13), %esi
+.LVL11:
+.L7:
+	.loc 1 68 12 is_stmt 1 view .LVU31
+	.loc 1 68 12 is_stmt 0 view .LVU32
+	testb	%sil, %sil
+	je	.L1
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 69 9 is_stmt 1 view .LVU33
+	.loc 1 68 21 is_stmt 0 view .LVU34
+	addq	$1, %r12
+.LVL13:
+	.loc 1 69 9 view .LVU35
+	movq	%rbx, %rdi
+	call	*%rbp
+.LVL14:
+	.loc 1 68 12 is_stmt 1 view .LVU36
+	.loc 1 68 16 is_stmt 0 view .LVU37
+	movsbl	-1(%r12), %esi
+.LVL15:
+	.loc 1 68 12 view .LVU38
+	testb	%sil, %sil
+	jne	.L10
+.LVL16:
+.L1:
+	.loc 1 70 1 view .LVU39
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL17:
+	.loc 1 70 1 view .LVU40
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL18:
+	.loc 1 70 1 view .LVU41
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL19:
+	.loc 1 70 1 view .LVU42
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.cfi_restore_state
+	.loc 1 66 16 is_stmt 1 view .LVU43
+	.loc 1 66 13 is_stmt 0 view .LVU44
+	leal	-1(%rdx), %r14d
+.LVL21:
+	.loc 1 66 16 view .LVU45
+	testl	%edx, %edx
+	jg	.L12
+	jmp	.L7
+	.cfi_endproc
+.LFE11:
+	.size	putchw, .-putchw
+	.section	.text.putcp,"ax",@progbits
+	.p2align 4
+	.type	putcp, @function
+putcp:
+.LVL22:
+.LFB15:
+	.loc 1 167 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 168 5 view .LVU47
+	.loc 1 168 7 is_stmt 0 view .LVU48
+	movq	(%rdi), %rax
+	.loc 1 168 22 view .LVU49
+	leaq	1(%rax), %rdx
+	movq	%rdx, (%rdi)
+	.loc 1 168 25 view .LVU50
+	movb	%sil, (%rax)
+	.loc 1 169 1 view .LVU51
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	putcp, .-putcp
+	.section	.text._putc,"ax",@progbits
+	.p2align 4
+	.type	_putc, @function
+_putc:
+.LVL23:
+.LFB17:
+	.loc 1 183 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 184 5 view .LVU53
+	.loc 1 185 5 view .LVU54
+	movq	printfSerialPort(%rip), %rdi
+.LVL24:
+	.loc 1 185 5 is_stmt 0 view .LVU55
+	movzbl	%sil, %esi
+	.loc 1 185 5 view .LVU56
+	jmp	serialWrite@PLT
+.LVL25:
+	.loc 1 185 5 view .LVU57
+	.cfi_endproc
+.LFE17:
+	.size	_putc, .-_putc
+	.section	.text.tfp_format,"ax",@progbits
+	.p2align 4
+	.globl	tfp_format
+	.type	tfp_format, @function
+tfp_format:
+.LVL26:
+.LFB12:
+	.loc 1 73 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 74 5 view .LVU59
+	.loc 1 76 5 view .LVU60
+	.loc 1 78 5 view .LVU61
+	.loc 1 78 12 view .LVU62
+	.loc 1 73 1 is_stmt 0 view .LVU63
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 78 23 view .LVU64
+	leaq	1(%rdx), %rax
+	.loc 1 73 1 view .LVU65
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rsi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 78 23 view .LVU66
+	movq	%rax, 8(%rsp)
+	.loc 1 78 16 view .LVU67
+	movsbl	(%rdx), %esi
+.LVL27:
+	.loc 1 78 12 view .LVU68
+	testb	%sil, %sil
+	je	.L31
+	movq	%rdi, %rbp
+	movq	%rcx, %r12
+	leaq	.L76(%rip), %r13
+	jmp	.L32
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L95:
+.LBB6:
+	.loc 1 141 17 view .LVU69
+	movq	%rbp, %rdi
+	call	*%rbx
+.LVL29:
+.L96:
+	.loc 1 142 17 is_stmt 1 view .LVU70
+.LBE6:
+	.loc 1 78 23 is_stmt 0 view .LVU71
+	movq	8(%rsp), %rdx
+.L35:
+	.loc 1 78 12 is_stmt 1 view .LVU72
+	.loc 1 78 23 is_stmt 0 view .LVU73
+	leaq	1(%rdx), %rax
+	movq	%rax, 8(%rsp)
+	.loc 1 78 16 view .LVU74
+	movsbl	(%rdx), %esi
+.LVL30:
+	.loc 1 78 12 view .LVU75
+	testb	%sil, %sil
+	je	.L31
+.L32:
+	.loc 1 79 9 is_stmt 1 view .LVU76
+	.loc 1 79 12 is_stmt 0 view .LVU77
+	cmpb	$37, %sil
+	jne	.L95
+.LBB7:
+	.loc 1 82 13 is_stmt 1 view .LVU78
+.LVL31:
+	.loc 1 84 13 view .LVU79
+	.loc 1 86 13 view .LVU80
+	.loc 1 87 23 is_stmt 0 view .LVU81
+	leaq	2(%rdx), %rax
+	.loc 1 86 17 view .LVU82
+	movl	$0, 16(%rsp)
+	.loc 1 87 13 is_stmt 1 view .LVU83
+	.loc 1 82 18 is_stmt 0 view .LVU84
+	xorl	%r14d, %r14d
+	.loc 1 87 23 view .LVU85
+	movq	%rax, 8(%rsp)
+	.loc 1 87 16 view .LVU86
+	movzbl	1(%rdx), %eax
+.LVL32:
+	.loc 1 88 13 is_stmt 1 view .LVU87
+	.loc 1 88 16 is_stmt 0 view .LVU88
+	cmpb	$48, %al
+	jne	.L36
+	.loc 1 89 17 is_stmt 1 view .LVU89
+	.loc 1 89 27 is_stmt 0 view .LVU90
+	leaq	3(%rdx), %rax
+.LVL33:
+	.loc 1 90 20 view .LVU91
+	movl	$1, %r14d
+	.loc 1 89 27 view .LVU92
+	movq	%rax, 8(%rsp)
+.LVL34:
+	.loc 1 89 20 view .LVU93
+	movzbl	2(%rdx), %eax
+.LVL35:
+	.loc 1 90 17 is_stmt 1 view .LVU94
+.L36:
+	.loc 1 92 13 view .LVU95
+	.loc 1 92 27 is_stmt 0 view .LVU96
+	leal	-48(%rax), %edx
+	.loc 1 92 16 view .LVU97
+	cmpb	$9, %dl
+	jbe	.L98
+.L37:
+	.loc 1 96 13 is_stmt 1 view .LVU98
+	.loc 1 96 16 is_stmt 0 view .LVU99
+	cmpb	$108, %al
+	je	.L99
+.L33:
+	.loc 1 101 13 is_stmt 1 view .LVU100
+	cmpb	$120, %al
+	jg	.L96
+	cmpb	$87, %al
+	jle	.L100
+	leal	-88(%rax), %edx
+	cmpb	$32, %dl
+	ja	.L96
+	movzbl	%dl, %edx
+	movslq	0(%r13,%rdx,4), %rdx
+	addq	%r13, %rdx
+	jmp	*%rdx
+	.section	.rodata.tfp_format,"a",@progbits
+	.align 4
+	.align 4
+.L76:
+	.long	.L66-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L48-.L76
+	.long	.L57-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L46-.L76
+	.long	.L96-.L76
+	.long	.L52-.L76
+	.long	.L96-.L76
+	.long	.L96-.L76
+	.long	.L66-.L76
+	.section	.text.tfp_format
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	testb	%al, %al
+	je	.L31
+	cmpb	$37, %al
+	jne	.L96
+.LVL36:
+.L42:
+	.loc 1 141 17 view .LVU101
+	movl	$37, %esi
+	jmp	.L95
+.LVL37:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.loc 1 97 17 view .LVU102
+	.loc 1 97 27 is_stmt 0 view .LVU103
+	movq	8(%rsp), %rax
+.LVL38:
+	.loc 1 97 27 view .LVU104
+	leaq	1(%rax), %rdx
+	movq	%rdx, 8(%rsp)
+	.loc 1 97 20 view .LVU105
+	movzbl	(%rax), %eax
+.LVL39:
+	.loc 1 98 17 is_stmt 1 view .LVU106
+	.loc 1 101 13 view .LVU107
+	cmpb	$120, %al
+	jg	.L35
+	cmpb	$87, %al
+	jle	.L101
+	leal	-88(%rax), %ecx
+	cmpb	$32, %cl
+	ja	.L35
+	leaq	.L44(%rip), %rsi
+	movzbl	%cl, %ecx
+	movslq	(%rsi,%rcx,4), %rcx
+	addq	%rsi, %rcx
+	jmp	*%rcx
+	.section	.rodata.tfp_format
+	.align 4
+	.align 4
+.L44:
+	.long	.L43-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L48-.L44
+	.long	.L47-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L46-.L44
+	.long	.L35-.L44
+	.long	.L45-.L44
+	.long	.L35-.L44
+	.long	.L35-.L44
+	.long	.L43-.L44
+	.section	.text.tfp_format
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	testb	%al, %al
+	je	.L31
+	cmpb	$37, %al
+	je	.L42
+	jmp	.L35
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.loc 1 93 17 view .LVU108
+	.loc 1 93 22 is_stmt 0 view .LVU109
+	movsbl	%al, %edi
+	leaq	16(%rsp), %rcx
+	leaq	8(%rsp), %rsi
+	movl	$10, %edx
+	call	a2i@PLT
+.LVL41:
+	.loc 1 93 22 view .LVU110
+	jmp	.L37
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 93 22 view .LVU111
+.LBE7:
+	.loc 1 149 1 view .LVU112
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL43:
+	.loc 1 149 1 view .LVU113
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.cfi_restore_state
+.LBB8:
+	.loc 1 127 17 is_stmt 1 view .LVU114
+	.loc 1 131 21 view .LVU115
+	xorl	%esi, %esi
+	cmpb	$88, %al
+	movl	(%r12), %eax
+.LVL45:
+	.loc 1 131 21 is_stmt 0 view .LVU116
+	sete	%sil
+	cmpl	$47, %eax
+	ja	.L67
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.L68:
+	movl	(%rdx), %edi
+	leaq	20(%rsp), %r15
+	movl	%esi, %edx
+	movl	$16, %esi
+	movq	%r15, %rcx
+	call	ui2a@PLT
+.LVL46:
+	jmp	.L65
+.LVL47:
+.L46:
+	.loc 1 138 17 is_stmt 1 view .LVU117
+	movl	(%r12), %eax
+.LVL48:
+	.loc 1 138 17 is_stmt 0 view .LVU118
+	cmpl	$47, %eax
+	ja	.L71
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.L72:
+	movq	(%rdx), %r8
+	xorl	%ecx, %ecx
+.LVL49:
+.L97:
+	.loc 1 138 17 view .LVU119
+	movl	16(%rsp), %edx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	putchw
+.LVL50:
+	.loc 1 139 17 is_stmt 1 view .LVU120
+.LBE8:
+	.loc 1 78 23 is_stmt 0 view .LVU121
+	movq	8(%rsp), %rdx
+.LBB9:
+	.loc 1 139 17 view .LVU122
+	jmp	.L35
+.LVL51:
+.L48:
+	.loc 1 135 17 is_stmt 1 view .LVU123
+	.loc 1 135 35 is_stmt 0 view .LVU124
+	movl	(%r12), %eax
+.LVL52:
+	.loc 1 135 35 view .LVU125
+	cmpl	$47, %eax
+	ja	.L69
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.L70:
+	.loc 1 135 17 view .LVU126
+	movsbl	(%rdx), %esi
+	movq	%rbp, %rdi
+	call	*%rbx
+.LVL53:
+	.loc 1 136 17 is_stmt 1 view .LVU127
+.LBE9:
+	.loc 1 78 23 is_stmt 0 view .LVU128
+	movq	8(%rsp), %rdx
+.LBB10:
+	.loc 1 136 17 view .LVU129
+	jmp	.L35
+.LVL54:
+.L43:
+	.loc 1 128 21 is_stmt 1 view .LVU130
+	xorl	%esi, %esi
+	cmpb	$88, %al
+	movl	(%r12), %eax
+.LVL55:
+	.loc 1 128 21 is_stmt 0 view .LVU131
+	sete	%sil
+	cmpl	$47, %eax
+	ja	.L63
+	movl	%eax, %edx
+.LVL56:
+	.loc 1 128 21 view .LVU132
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.LVL57:
+.L64:
+	.loc 1 128 21 view .LVU133
+	movq	(%rdx), %rdi
+	leaq	20(%rsp), %r15
+	movl	%esi, %edx
+	movl	$16, %esi
+	movq	%r15, %rcx
+	call	uli2a@PLT
+.LVL58:
+	jmp	.L65
+.LVL59:
+.L52:
+	.loc 1 110 25 is_stmt 1 view .LVU134
+	movl	(%r12), %eax
+.LVL60:
+	.loc 1 110 25 is_stmt 0 view .LVU135
+	cmpl	$47, %eax
+	ja	.L53
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.L54:
+	movl	(%rdx), %edi
+	leaq	20(%rsp), %r15
+	xorl	%edx, %edx
+	movl	$10, %esi
+	movq	%r15, %rcx
+	call	ui2a@PLT
+.LVL61:
+	.loc 1 111 21 is_stmt 1 view .LVU136
+	jmp	.L65
+.LVL62:
+.L57:
+	.loc 1 116 21 view .LVU137
+	.loc 1 107 25 is_stmt 0 view .LVU138
+	movl	(%r12), %eax
+.LVL63:
+	.loc 1 120 25 is_stmt 1 view .LVU139
+	cmpl	$47, %eax
+	ja	.L58
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.L62:
+	leaq	20(%rsp), %r15
+	movl	(%rdx), %edi
+	movq	%r15, %rsi
+	call	i2a@PLT
+.LVL64:
+	.loc 1 121 21 view .LVU140
+	jmp	.L65
+.LVL65:
+.L45:
+	.loc 1 106 21 view .LVU141
+	.loc 1 107 25 view .LVU142
+	movl	(%r12), %eax
+.LVL66:
+	.loc 1 107 25 is_stmt 0 view .LVU143
+	cmpl	$47, %eax
+	ja	.L49
+	movl	%eax, %edx
+.LVL67:
+	.loc 1 107 25 view .LVU144
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.LVL68:
+.L50:
+	.loc 1 107 25 view .LVU145
+	movq	(%rdx), %rdi
+	leaq	20(%rsp), %r15
+	xorl	%edx, %edx
+	movl	$10, %esi
+	movq	%r15, %rcx
+	call	uli2a@PLT
+.LVL69:
+	jmp	.L65
+.LVL70:
+.L47:
+	.loc 1 116 21 is_stmt 1 view .LVU146
+	.loc 1 107 25 is_stmt 0 view .LVU147
+	movl	(%r12), %eax
+.LVL71:
+	.loc 1 117 25 is_stmt 1 view .LVU148
+	.loc 1 117 29 is_stmt 0 view .LVU149
+	cmpl	$47, %eax
+	ja	.L55
+	movl	%eax, %edx
+.LVL72:
+	.loc 1 117 29 view .LVU150
+	addl	$8, %eax
+	addq	16(%r12), %rdx
+	movl	%eax, (%r12)
+.LVL73:
+.L60:
+	.loc 1 117 25 view .LVU151
+	leaq	20(%rsp), %r15
+	movq	(%rdx), %rdi
+	movq	%r15, %rsi
+	call	li2a@PLT
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.loc 1 132 17 is_stmt 1 view .LVU152
+	movsbl	%r14b, %ecx
+	movq	%r15, %r8
+	jmp	.L97
+.LVL75:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.loc 1 138 17 is_stmt 0 view .LVU153
+	movq	8(%r12), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+	jmp	.L72
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.loc 1 135 35 view .LVU154
+	movq	8(%r12), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+	jmp	.L70
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 117 29 view .LVU155
+	movq	8(%r12), %rdx
+.LVL77:
+	.loc 1 117 29 view .LVU156
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+.LVL78:
+	.loc 1 117 29 view .LVU157
+	jmp	.L60
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 107 25 view .LVU158
+	movq	8(%r12), %rdx
+.LVL80:
+	.loc 1 107 25 view .LVU159
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+.LVL81:
+	.loc 1 107 25 view .LVU160
+	jmp	.L50
+.LVL82:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+	.loc 1 120 25 view .LVU161
+	movq	8(%r12), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+	jmp	.L62
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 110 25 view .LVU162
+	movq	8(%r12), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+	jmp	.L54
+.LVL83:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.loc 1 128 21 view .LVU163
+	movq	8(%r12), %rdx
+.LVL84:
+	.loc 1 128 21 view .LVU164
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+.LVL85:
+	.loc 1 128 21 view .LVU165
+	jmp	.L64
+.LVL86:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 131 21 view .LVU166
+	movq	8(%r12), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%r12)
+	jmp	.L68
+.LBE10:
+	.cfi_endproc
+.LFE12:
+	.size	tfp_format, .-tfp_format
+	.section	.text.init_printf,"ax",@progbits
+	.p2align 4
+	.globl	init_printf
+	.type	init_printf, @function
+init_printf:
+.LVL87:
+.LFB13:
+	.loc 1 152 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 153 5 view .LVU168
+	.loc 1 153 17 is_stmt 0 view .LVU169
+	movq	%rsi, stdout_putf(%rip)
+	.loc 1 154 5 is_stmt 1 view .LVU170
+	.loc 1 154 17 is_stmt 0 view .LVU171
+	movq	%rdi, stdout_putp(%rip)
+	.loc 1 155 1 view .LVU172
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	init_printf, .-init_printf
+	.section	.text.tfp_printf,"ax",@progbits
+	.p2align 4
+	.globl	tfp_printf
+	.type	tfp_printf, @function
+tfp_printf:
+.LVL88:
+.LFB14:
+	.loc 1 158 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 158 1 is_stmt 0 view .LVU174
+	subq	$216, %rsp
+	.cfi_def_cfa_offset 224
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L106
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L106:
+	.loc 1 159 5 is_stmt 1 view .LVU175
+	.loc 1 160 4 view .LVU176
+	leaq	224(%rsp), %rax
+	.loc 1 161 5 is_stmt 0 view .LVU177
+	movq	%rdi, %rdx
+	movq	stdout_putf(%rip), %rsi
+	movq	stdout_putp(%rip), %rdi
+.LVL89:
+	.loc 1 160 4 view .LVU178
+	movq	%rax, 16(%rsp)
+	.loc 1 161 5 view .LVU179
+	leaq	8(%rsp), %rcx
+	.loc 1 160 4 view .LVU180
+	leaq	32(%rsp), %rax
+	movl	$8, 8(%rsp)
+	movl	$48, 12(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 1 161 5 is_stmt 1 view .LVU181
+	call	tfp_format
+.LVL90:
+	.loc 1 162 4 view .LVU182
+	.loc 1 163 5 view .LVU183
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	.loc 1 163 12 discriminator 1 view .LVU184
+	.loc 1 163 13 is_stmt 0 discriminator 1 view .LVU185
+	movq	printfSerialPort(%rip), %rdi
+	call	isSerialTransmitBufferEmpty@PLT
+.LVL91:
+	.loc 1 163 12 discriminator 1 view .LVU186
+	testb	%al, %al
+	je	.L105
+	.loc 1 164 1 view .LVU187
+	addq	$216, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	tfp_printf, .-tfp_printf
+	.section	.text.tfp_sprintf,"ax",@progbits
+	.p2align 4
+	.globl	tfp_sprintf
+	.type	tfp_sprintf, @function
+tfp_sprintf:
+.LVL92:
+.LFB16:
+	.loc 1 172 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 172 1 is_stmt 0 view .LVU189
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 240
+	movq	%rdi, 8(%rsp)
+	movq	%rdx, 64(%rsp)
+	movq	%rcx, 72(%rsp)
+	movq	%r8, 80(%rsp)
+	movq	%r9, 88(%rsp)
+	testb	%al, %al
+	je	.L112
+	movaps	%xmm0, 96(%rsp)
+	movaps	%xmm1, 112(%rsp)
+	movaps	%xmm2, 128(%rsp)
+	movaps	%xmm3, 144(%rsp)
+	movaps	%xmm4, 160(%rsp)
+	movaps	%xmm5, 176(%rsp)
+	movaps	%xmm6, 192(%rsp)
+	movaps	%xmm7, 208(%rsp)
+.L112:
+	.loc 1 173 5 is_stmt 1 view .LVU190
+	.loc 1 175 4 view .LVU191
+	leaq	240(%rsp), %rax
+	.loc 1 176 5 is_stmt 0 view .LVU192
+	leaq	24(%rsp), %rcx
+	movq	%rsi, %rdx
+	.loc 1 175 4 view .LVU193
+	movl	$16, 24(%rsp)
+	movq	%rax, 32(%rsp)
+	.loc 1 176 5 view .LVU194
+	leaq	8(%rsp), %rdi
+.LVL93:
+	.loc 1 175 4 view .LVU195
+	leaq	48(%rsp), %rax
+	.loc 1 176 5 view .LVU196
+	leaq	putcp(%rip), %rsi
+.LVL94:
+	.loc 1 175 4 view .LVU197
+	movq	%rax, 40(%rsp)
+	.loc 1 176 5 is_stmt 1 view .LVU198
+	.loc 1 175 4 is_stmt 0 view .LVU199
+	movl	$48, 28(%rsp)
+	.loc 1 176 5 view .LVU200
+	call	tfp_format
+.LVL95:
+	.loc 1 177 5 is_stmt 1 view .LVU201
+.LBB11:
+.LBI11:
+	.loc 1 166 13 view .LVU202
+.LBB12:
+	.loc 1 168 5 view .LVU203
+	.loc 1 168 7 is_stmt 0 view .LVU204
+	movq	8(%rsp), %rax
+	.loc 1 168 25 view .LVU205
+	movb	$0, (%rax)
+.LVL96:
+	.loc 1 168 25 view .LVU206
+.LBE12:
+.LBE11:
+	.loc 1 178 4 is_stmt 1 view .LVU207
+	.loc 1 179 1 is_stmt 0 view .LVU208
+	addq	$232, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	tfp_sprintf, .-tfp_sprintf
+	.section	.text.initPrintfSupport,"ax",@progbits
+	.p2align 4
+	.globl	initPrintfSupport
+	.type	initPrintfSupport, @function
+initPrintfSupport:
+.LFB18:
+	.loc 1 189 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 190 5 view .LVU210
+.LVL97:
+.LBB13:
+.LBI13:
+	.loc 1 151 6 view .LVU211
+.LBB14:
+	.loc 1 153 5 view .LVU212
+	.loc 1 153 17 is_stmt 0 view .LVU213
+	leaq	_putc(%rip), %rax
+	.loc 1 154 17 view .LVU214
+	movq	$0, stdout_putp(%rip)
+	.loc 1 153 17 view .LVU215
+	movq	%rax, stdout_putf(%rip)
+	.loc 1 154 5 is_stmt 1 view .LVU216
+.LVL98:
+	.loc 1 154 5 is_stmt 0 view .LVU217
+.LBE14:
+.LBE13:
+	.loc 1 191 1 view .LVU218
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	initPrintfSupport, .-initPrintfSupport
+	.section	.text.setPrintfSerialPort,"ax",@progbits
+	.p2align 4
+	.globl	setPrintfSerialPort
+	.type	setPrintfSerialPort, @function
+setPrintfSerialPort:
+.LVL99:
+.LFB19:
+	.loc 1 211 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 212 5 view .LVU220
+	.loc 1 212 22 is_stmt 0 view .LVU221
+	movq	%rdi, printfSerialPort(%rip)
+	.loc 1 213 1 view .LVU222
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	setPrintfSerialPort, .-setPrintfSerialPort
+	.section	.bss.stdout_putp,"aw",@nobits
+	.align 8
+	.type	stdout_putp, @object
+	.size	stdout_putp, 8
+stdout_putp:
+	.zero	8
+	.section	.bss.stdout_putf,"aw",@nobits
+	.align 8
+	.type	stdout_putf, @object
+	.size	stdout_putf, 8
+stdout_putf:
+	.zero	8
+	.section	.bss.printfSerialPort,"aw",@nobits
+	.align 8
+	.type	printfSerialPort, @object
+	.size	printfSerialPort, 8
+printfSerialPort:
+	.zero	8
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 5 "<built-in>"
+	.file 6 ".//src/main/common/ring_buffer.h"
+	.file 7 ".//src/main/drivers/serial.h"
+	.file 8 ".//src/main/io/serial.h"
+	.file 9 ".//src/main/common/typeconversion.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xb22
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1047
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL25
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF960
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF961
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF962
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF963
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF964
+	.uleb128 0x5
+	.long	.LASF966
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF965
+	.uleb128 0x5
+	.long	.LASF967
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF968
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF969
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF970
+	.uleb128 0x5
+	.long	.LASF971
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x23
+	.long	0x98
+	.uleb128 0x17
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF972
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF973
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF974
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1b
+	.long	0xd2
+	.uleb128 0x24
+	.long	.LASF1048
+	.long	0xdb
+	.uleb128 0x18
+	.long	0xeb
+	.long	0xeb
+	.uleb128 0x19
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1049
+	.byte	0x18
+	.byte	0x5
+	.byte	0
+	.long	0x120
+	.uleb128 0xe
+	.long	.LASF975
+	.long	0x3c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF976
+	.long	0x3c
+	.byte	0x4
+	.uleb128 0xe
+	.long	.LASF977
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF978
+	.long	0x8a
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF979
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0xc6
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF980
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF981
+	.uleb128 0x14
+	.long	.LASF998
+	.byte	0x10
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x10
+	.long	0x189
+	.uleb128 0x3
+	.long	.LASF982
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x17
+	.long	0x189
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF983
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xe
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF984
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xe
+	.long	0xae
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF985
+	.byte	0x6
+	.byte	0x1f
+	.byte	0xe
+	.long	0xae
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF986
+	.byte	0x6
+	.byte	0x20
+	.byte	0xe
+	.long	0xae
+	.byte	0xe
+	.byte	0
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF987
+	.byte	0x6
+	.byte	0x21
+	.byte	0x3
+	.long	0x13a
+	.uleb128 0x1a
+	.long	0x3c
+	.byte	0x7
+	.byte	0x16
+	.long	0x1b2
+	.uleb128 0x6
+	.long	.LASF988
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF989
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF990
+	.byte	0x7
+	.byte	0x19
+	.byte	0x3
+	.long	0x19a
+	.uleb128 0x26
+	.long	.LASF995
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0x7
+	.byte	0x1b
+	.byte	0xe
+	.long	0x1e9
+	.uleb128 0x6
+	.long	.LASF991
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF992
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF993
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF994
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF995
+	.byte	0x7
+	.byte	0x20
+	.byte	0x3
+	.long	0x1be
+	.uleb128 0x5
+	.long	.LASF996
+	.byte	0x7
+	.byte	0x22
+	.byte	0x10
+	.long	0x201
+	.uleb128 0x4
+	.long	0x206
+	.uleb128 0xa
+	.long	0x211
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF997
+	.byte	0x7
+	.byte	0x23
+	.byte	0x10
+	.long	0x21d
+	.uleb128 0x4
+	.long	0x222
+	.uleb128 0xa
+	.long	0x232
+	.uleb128 0x1
+	.long	0x232
+	.uleb128 0x1
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x14
+	.long	.LASF999
+	.byte	0x40
+	.byte	0x7
+	.byte	0x25
+	.byte	0x10
+	.long	0x2ad
+	.uleb128 0x3
+	.long	.LASF1000
+	.byte	0x7
+	.byte	0x27
+	.byte	0x24
+	.long	0x34f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1001
+	.byte	0x7
+	.byte	0x29
+	.byte	0xd
+	.long	0x98
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1002
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x10
+	.long	0x1e9
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1003
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x17
+	.long	0x1b2
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1004
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xe
+	.long	0xba
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1005
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x12
+	.long	0x18e
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1006
+	.byte	0x7
+	.byte	0x30
+	.byte	0x12
+	.long	0x18e
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1007
+	.byte	0x7
+	.byte	0x33
+	.byte	0x1e
+	.long	0x1f5
+	.byte	0x38
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1008
+	.byte	0x58
+	.byte	0x7
+	.byte	0x36
+	.byte	0x8
+	.long	0x34a
+	.uleb128 0x3
+	.long	.LASF1009
+	.byte	0x7
+	.byte	0x37
+	.byte	0xc
+	.long	0x375
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1010
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x389
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1011
+	.byte	0x7
+	.byte	0x3b
+	.byte	0xf
+	.long	0x39d
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1012
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xc
+	.long	0x3b2
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1013
+	.byte	0x7
+	.byte	0x40
+	.byte	0xb
+	.long	0x3cd
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1014
+	.byte	0x7
+	.byte	0x42
+	.byte	0xc
+	.long	0x3e2
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1015
+	.byte	0x7
+	.byte	0x45
+	.byte	0xb
+	.long	0x3fb
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1016
+	.byte	0x7
+	.byte	0x47
+	.byte	0xc
+	.long	0x415
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1017
+	.byte	0x7
+	.byte	0x49
+	.byte	0x10
+	.long	0x438
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1018
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x10
+	.long	0x451
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1019
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xc
+	.long	0x3b2
+	.byte	0x50
+	.byte	0
+	.uleb128 0x17
+	.long	0x2ad
+	.uleb128 0x4
+	.long	0x34a
+	.uleb128 0x5
+	.long	.LASF1020
+	.byte	0x7
+	.byte	0x34
+	.byte	0x3
+	.long	0x237
+	.uleb128 0xa
+	.long	0x370
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	0x354
+	.uleb128 0x4
+	.long	0x360
+	.uleb128 0xb
+	.long	0xba
+	.long	0x389
+	.uleb128 0x1
+	.long	0x370
+	.byte	0
+	.uleb128 0x4
+	.long	0x37a
+	.uleb128 0xb
+	.long	0x98
+	.long	0x39d
+	.uleb128 0x1
+	.long	0x370
+	.byte	0
+	.uleb128 0x4
+	.long	0x38e
+	.uleb128 0xa
+	.long	0x3b2
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	0x3a2
+	.uleb128 0xb
+	.long	0x3c6
+	.long	0x3c6
+	.uleb128 0x1
+	.long	0x370
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1021
+	.uleb128 0x4
+	.long	0x3b7
+	.uleb128 0xa
+	.long	0x3e2
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x1e9
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d2
+	.uleb128 0xb
+	.long	0x3c6
+	.long	0x3fb
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x211
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e7
+	.uleb128 0xa
+	.long	0x415
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x232
+	.uleb128 0x1
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	0x400
+	.uleb128 0xb
+	.long	0xba
+	.long	0x433
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x433
+	.uleb128 0x1
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x4
+	.long	0x41a
+	.uleb128 0xb
+	.long	0x433
+	.long	0x451
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	0x43d
+	.uleb128 0x1a
+	.long	0x3c
+	.byte	0x8
+	.byte	0x14
+	.long	0x492
+	.uleb128 0x6
+	.long	.LASF1022
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1023
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF1024
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF1025
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF1026
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1027
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1028
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1029
+	.byte	0x40
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1031
+	.byte	0x33
+	.byte	0x16
+	.long	0x370
+	.uleb128 0x9
+	.byte	0x3
+	.quad	printfSerialPort
+	.uleb128 0x5
+	.long	.LASF1030
+	.byte	0x1
+	.byte	0x37
+	.byte	0x10
+	.long	0x4b3
+	.uleb128 0x4
+	.long	0x4b8
+	.uleb128 0xa
+	.long	0x4c8
+	.uleb128 0x1
+	.long	0x8a
+	.uleb128 0x1
+	.long	0x91
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1032
+	.byte	0x38
+	.byte	0xe
+	.long	0x4a7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	stdout_putf
+	.uleb128 0x15
+	.long	.LASF1033
+	.byte	0x39
+	.byte	0xe
+	.long	0x8a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	stdout_putp
+	.uleb128 0xf
+	.long	.LASF1009
+	.byte	0x7
+	.byte	0x51
+	.long	0x508
+	.uleb128 0x1
+	.long	0x370
+	.uleb128 0x1
+	.long	0x98
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1013
+	.byte	0x7
+	.byte	0x56
+	.byte	0x5
+	.long	0x3c6
+	.long	0x51e
+	.uleb128 0x1
+	.long	0x370
+	.byte	0
+	.uleb128 0x28
+	.string	"i2a"
+	.byte	0x9
+	.byte	0x16
+	.byte	0x6
+	.long	0x535
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x8c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1034
+	.byte	0x9
+	.byte	0x14
+	.long	0x54b
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x8c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1035
+	.byte	0x9
+	.byte	0x15
+	.long	0x56b
+	.uleb128 0x1
+	.long	0x3c
+	.uleb128 0x1
+	.long	0x3c
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x8c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1036
+	.byte	0x9
+	.byte	0x13
+	.long	0x58b
+	.uleb128 0x1
+	.long	0x43
+	.uleb128 0x1
+	.long	0x3c
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x8c
+	.byte	0
+	.uleb128 0x29
+	.string	"a2i"
+	.byte	0x9
+	.byte	0x17
+	.byte	0x6
+	.long	0x91
+	.long	0x5b0
+	.uleb128 0x1
+	.long	0x91
+	.uleb128 0x1
+	.long	0x5b0
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x5b5
+	.byte	0
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x4
+	.long	0x70
+	.uleb128 0xd
+	.long	.LASF1037
+	.byte	0xd2
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e5
+	.uleb128 0x2a
+	.long	.LASF999
+	.byte	0x1
+	.byte	0xd2
+	.byte	0x28
+	.long	0x370
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1038
+	.byte	0xbc
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x63e
+	.uleb128 0x2b
+	.long	0x7e1
+	.quad	.LBI13
+	.byte	.LVU211
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x5
+	.uleb128 0x10
+	.long	0x7f9
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x10
+	.long	0x7ee
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1045
+	.byte	0xb6
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x695
+	.uleb128 0x8
+	.string	"p"
+	.byte	0xb6
+	.byte	0x19
+	.long	0x8a
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x8
+	.string	"c"
+	.byte	0xb6
+	.byte	0x21
+	.long	0x91
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2c
+	.quad	.LVL25
+	.long	0x4f2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1039
+	.byte	0xab
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x755
+	.uleb128 0x8
+	.string	"s"
+	.byte	0xab
+	.byte	0x18
+	.long	0x8c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x8
+	.string	"fmt"
+	.byte	0xab
+	.byte	0x21
+	.long	0x8c
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1c
+	.uleb128 0x11
+	.string	"va"
+	.byte	0xad
+	.byte	0xd
+	.long	0x120
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x2d
+	.long	0x755
+	.quad	.LBI11
+	.byte	.LVU202
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.byte	0x1
+	.byte	0xb1
+	.byte	0x5
+	.long	0x724
+	.uleb128 0x10
+	.long	0x76b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x10
+	.long	0x762
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL95
+	.long	0x805
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	putcp
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1050
+	.byte	0x1
+	.byte	0xa6
+	.byte	0xd
+	.byte	0x1
+	.long	0x775
+	.uleb128 0x1e
+	.string	"p"
+	.byte	0xa6
+	.byte	0x19
+	.long	0x8a
+	.uleb128 0x1e
+	.string	"c"
+	.byte	0xa6
+	.byte	0x21
+	.long	0x91
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1040
+	.byte	0x9d
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e1
+	.uleb128 0x8
+	.string	"fmt"
+	.byte	0x9d
+	.byte	0x17
+	.long	0x8c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1c
+	.uleb128 0x11
+	.string	"va"
+	.byte	0x9f
+	.byte	0xd
+	.long	0x120
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x9
+	.quad	.LVL90
+	.long	0x805
+	.long	0x7d3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL91
+	.long	0x508
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1041
+	.byte	0x1
+	.byte	0x97
+	.byte	0x6
+	.byte	0x1
+	.long	0x805
+	.uleb128 0x1f
+	.long	.LASF1042
+	.byte	0x97
+	.byte	0x18
+	.long	0x8a
+	.uleb128 0x1f
+	.long	.LASF1043
+	.byte	0x97
+	.byte	0x25
+	.long	0x4b3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1044
+	.byte	0x48
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ea
+	.uleb128 0x12
+	.long	.LASF1042
+	.byte	0x48
+	.byte	0x17
+	.long	0x8a
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x12
+	.long	.LASF1043
+	.byte	0x48
+	.byte	0x23
+	.long	0x4a7
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.string	"fmt"
+	.byte	0x48
+	.byte	0x2f
+	.long	0x8c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.string	"va"
+	.byte	0x48
+	.byte	0x3c
+	.long	0x9ea
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x11
+	.string	"bf"
+	.byte	0x4a
+	.byte	0xa
+	.long	0x9ef
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0xc
+	.string	"ch"
+	.byte	0x4c
+	.byte	0xa
+	.long	0x91
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x31
+	.long	.LASF1051
+	.byte	0x1
+	.byte	0x94
+	.byte	0x3
+	.quad	.L33
+	.uleb128 0x32
+	.long	.LLRL15
+	.uleb128 0xc
+	.string	"lz"
+	.byte	0x52
+	.byte	0x12
+	.long	0x91
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xc
+	.string	"lng"
+	.byte	0x54
+	.byte	0x12
+	.long	0x91
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x11
+	.string	"w"
+	.byte	0x56
+	.byte	0x11
+	.long	0x70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x16
+	.quad	.LVL29
+	.long	0x8e7
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL41
+	.long	0x58b
+	.long	0x90c
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL46
+	.long	0x54b
+	.long	0x929
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL50
+	.long	0x9ff
+	.long	0x947
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL53
+	.long	0x95b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL58
+	.long	0x56b
+	.long	0x978
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL61
+	.long	0x54b
+	.long	0x99a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL64
+	.long	0x51e
+	.long	0x9b2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL69
+	.long	0x56b
+	.long	0x9d4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL74
+	.long	0x535
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xeb
+	.uleb128 0x18
+	.long	0x91
+	.long	0x9ff
+	.uleb128 0x19
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1046
+	.byte	0x3b
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xad5
+	.uleb128 0x12
+	.long	.LASF1042
+	.byte	0x3b
+	.byte	0x1a
+	.long	0x8a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x12
+	.long	.LASF1043
+	.byte	0x3b
+	.byte	0x26
+	.long	0x4a7
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x8
+	.string	"n"
+	.byte	0x3b
+	.byte	0x30
+	.long	0x70
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x8
+	.string	"z"
+	.byte	0x3b
+	.byte	0x38
+	.long	0x91
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x8
+	.string	"bf"
+	.byte	0x3b
+	.byte	0x41
+	.long	0x8c
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xc
+	.string	"fc"
+	.byte	0x3d
+	.byte	0xa
+	.long	0x91
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xc
+	.string	"ch"
+	.byte	0x3e
+	.byte	0xa
+	.long	0x91
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xc
+	.string	"p"
+	.byte	0x3f
+	.byte	0xb
+	.long	0x8c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x16
+	.quad	.LVL9
+	.long	0xac4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x33
+	.quad	.LVL14
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x755
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaff
+	.uleb128 0x13
+	.long	0x762
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x13
+	.long	0x76b
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x35
+	.long	0x7e1
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x13
+	.long	0x7ee
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x13
+	.long	0x7f9
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS23:
+	.uleb128 .LVU211
+	.uleb128 .LVU217
+.LLST23:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL98-.LVL97
+	.uleb128 0xa
+	.byte	0x3
+	.quad	_putc
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU211
+	.uleb128 .LVU217
+.LLST24:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL98-.LVL97
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL24-.LVL23
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.LVL23
+	.uleb128 .LFE17-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL25-1-.LVL23
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL25-1-.LVL23
+	.uleb128 .LFE17-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU201
+.LLST19:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL93-.LVL92
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-.LVL92
+	.uleb128 .LVL95-1-.LVL92
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL94-.LVL92
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.LVL92
+	.uleb128 .LVL95-1-.LVL92
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-1-.LVL92
+	.uleb128 .LFE16-.LVL92
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+.LLST21:
+	.byte	0x8
+	.quad	.LVL95
+	.uleb128 .LVL96-.LVL95
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+.LLST22:
+	.byte	0x8
+	.quad	.LVL95
+	.uleb128 .LVL96-.LVL95
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL88
+	.byte	0x4
+	.uleb128 .LVL88-.LVL88
+	.uleb128 .LVL89-.LVL88
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL89-.LVL88
+	.uleb128 .LVL90-1-.LVL88
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL90-1-.LVL88
+	.uleb128 .LFE14-.LVL88
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL42-.LVL26
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL42-.LVL26
+	.uleb128 .LVL44-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL26
+	.uleb128 .LFE12-.LVL26
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL27-.LVL26
+	.uleb128 .LVL43-.LVL26
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.LVL26
+	.uleb128 .LVL44-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL26
+	.uleb128 .LFE12-.LVL26
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LFE12-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL42-.LVL26
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL42-.LVL26
+	.uleb128 .LVL44-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL26
+	.uleb128 .LFE12-.LVL26
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU68
+	.uleb128 .LVU69
+	.uleb128 .LVU75
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+	.uleb128 .LVU94
+	.uleb128 .LVU104
+	.uleb128 .LVU106
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU123
+	.uleb128 .LVU125
+	.uleb128 .LVU130
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 .LVU145
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU155
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU157
+	.uleb128 .LVU158
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU160
+	.uleb128 .LVU163
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU165
+.LLST14:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.LVL27
+	.uleb128 .LVL32-.LVL27
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.LVL27
+	.uleb128 .LVL33-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL33-.LVL27
+	.uleb128 .LVL34-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 1
+	.byte	0x4
+	.uleb128 .LVL35-.LVL27
+	.uleb128 .LVL38-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.LVL27
+	.uleb128 .LVL41-1-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL41-.LVL27
+	.uleb128 .LVL42-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL44-.LVL27
+	.uleb128 .LVL45-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.LVL27
+	.uleb128 .LVL48-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.LVL27
+	.uleb128 .LVL52-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-.LVL27
+	.uleb128 .LVL55-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.LVL27
+	.uleb128 .LVL56-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL56-.LVL27
+	.uleb128 .LVL57-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL59-.LVL27
+	.uleb128 .LVL60-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.LVL27
+	.uleb128 .LVL63-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.LVL27
+	.uleb128 .LVL66-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.LVL27
+	.uleb128 .LVL67-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL67-.LVL27
+	.uleb128 .LVL68-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL70-.LVL27
+	.uleb128 .LVL71-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL71-.LVL27
+	.uleb128 .LVL72-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL72-.LVL27
+	.uleb128 .LVL73-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL76-.LVL27
+	.uleb128 .LVL77-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL77-.LVL27
+	.uleb128 .LVL78-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL79-.LVL27
+	.uleb128 .LVL80-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL80-.LVL27
+	.uleb128 .LVL81-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL83-.LVL27
+	.uleb128 .LVL84-.LVL27
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x4
+	.uleb128 .LVL84-.LVL27
+	.uleb128 .LVL85-.LVL27
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x31
+	.byte	0x1c
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU79
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL31
+	.byte	0x4
+	.uleb128 .LVL31-.LVL31
+	.uleb128 .LVL35-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL31
+	.uleb128 .LVL42-.LVL31
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL44-.LVL31
+	.uleb128 .LFE12-.LVL31
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU80
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+	.uleb128 .LVU117
+	.uleb128 .LVU130
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU152
+	.uleb128 .LVU155
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU163
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL31
+	.byte	0x4
+	.uleb128 .LVL31-.LVL31
+	.uleb128 .LVL36-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL31
+	.uleb128 .LVL39-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL31
+	.uleb128 .LVL40-.LVL31
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL31
+	.uleb128 .LVL42-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL31
+	.uleb128 .LVL47-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.LVL31
+	.uleb128 .LVL59-.LVL31
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL31
+	.uleb128 .LVL65-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.LVL31
+	.uleb128 .LVL74-.LVL31
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL31
+	.uleb128 .LVL82-.LVL31
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.LVL31
+	.uleb128 .LVL83-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL31
+	.uleb128 .LVL86-.LVL31
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.LVL31
+	.uleb128 .LFE12-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL17-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.LVL0
+	.uleb128 .LVL20-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LVL20-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU31
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL5-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LVL6-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.LVL0
+	.uleb128 .LVL10-.LVL0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL10-.LVL0
+	.uleb128 .LVL11-.LVL0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LVL21-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL21-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL20-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+	.uleb128 .LVU37
+	.uleb128 .LVU42
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL8-.LVL0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL8-.LVL0
+	.uleb128 .LVL11-.LVL0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL11-.LVL0
+	.uleb128 .LVL13-.LVL0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL13-.LVL0
+	.uleb128 .LVL14-.LVL0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.LVL0
+	.uleb128 .LVL19-.LVL0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL20-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU9
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL11-.LVL2
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL2
+	.uleb128 .LVL20-.LVL2
+	.uleb128 0x16
+	.byte	0x9
+	.byte	0xff
+	.byte	0x30
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9
+	.byte	0xf0
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL2
+	.uleb128 .LFE11-.LVL2
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU32
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+.LLST6:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL12-.LVL11
+	.uleb128 .LVL14-1-.LVL11
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL15-.LVL11
+	.uleb128 .LVL16-.LVL11
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU11
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU26
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL2-.LVL2
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL3-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL2
+	.uleb128 .LVL7-.LVL2
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.LVL2
+	.uleb128 .LFE11-.LVL2
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xac
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB6
+	.byte	0x4
+	.uleb128 .LBB6-.LBB6
+	.uleb128 .LBE6-.LBB6
+	.byte	0x4
+	.uleb128 .LBB7-.LBB6
+	.uleb128 .LBE7-.LBB6
+	.byte	0x4
+	.uleb128 .LBB8-.LBB6
+	.uleb128 .LBE8-.LBB6
+	.byte	0x4
+	.uleb128 .LBB9-.LBB6
+	.uleb128 .LBE9-.LBB6
+	.byte	0x4
+	.uleb128 .LBB10-.LBB6
+	.uleb128 .LBE10-.LBB6
+	.byte	0
+.LLRL25:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF750
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF786
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF829
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF831
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF707
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF832
+	.file 38 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF833
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF850
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF863
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF868
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF871
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF872
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF891
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF910
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF911
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF915
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x4
+	.file 58 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3a
+	.file 59 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 60 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.file 61 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF953
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 62 ".//src/main/common/printf.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF694
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF706
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF709
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF744
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF745
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF746
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF748
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF759
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF778
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF785
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF807
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF837
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF839
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF849
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF862
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF884
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF902
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF906
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF909
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF707
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF914
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF925
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF944
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF952
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF956
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.printf.h.106.e4436cd231e08efb64f4e6d3908f2921,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF959
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF820:
+	.string	"__nlink_t_defined "
+.LASF1006:
+	.string	"txBuffer"
+.LASF902:
+	.string	"__ONCE_ALIGNMENT "
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF930:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF898:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF789:
+	.string	"__HAVE_FLOAT64 1"
+.LASF959:
+	.string	"sprintf tfp_sprintf"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF794:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF854:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF801:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1001:
+	.string	"identifier"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF985:
+	.string	"tail"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF857:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF829:
+	.string	"__clockid_t_defined 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1024:
+	.string	"FUNCTION_CLI"
+.LASF866:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF928:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF996:
+	.string	"serialReceiveCallbackPtr"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF778:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF753:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF938:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF762:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1003:
+	.string	"inversion"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF932:
+	.string	"USE_GYRO_SITL "
+.LASF824:
+	.string	"__id_t_defined "
+.LASF788:
+	.string	"__HAVE_FLOAT32 1"
+.LASF876:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF864:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1043:
+	.string	"putf"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF832:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF922:
+	.string	"__enable_irq() "
+.LASF897:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF711:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1042:
+	.string	"putp"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF826:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF746:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF803:
+	.string	"__f64x(x) x ##f64x"
+.LASF879:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"_GCC_SIZE_T "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF740:
+	.string	"___int_wchar_t_h "
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF715:
+	.string	"_T_SIZE "
+.LASF830:
+	.string	"__time_t_defined 1"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1007:
+	.string	"callback"
+.LASF843:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1026:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF998:
+	.string	"ringBuffer_s"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF951:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF908:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF747:
+	.string	"NULL"
+.LASF924:
+	.string	"U_ID_1 0"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF890:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF904:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF777:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF934:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF783:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF713:
+	.string	"_SYS_SIZE_T_H "
+.LASF834:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF795:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF969:
+	.string	"long int"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF848:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF868:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF919:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF710:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1029:
+	.string	"FUNCTION_BLACKBOX"
+.LASF999:
+	.string	"serialPort"
+.LASF837:
+	.string	"__PDP_ENDIAN 3412"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF765:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF984:
+	.string	"head"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF799:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF874:
+	.string	"__NFDBITS"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF812:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF903:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF964:
+	.string	"signed char"
+.LASF971:
+	.string	"uint8_t"
+.LASF846:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1051:
+	.string	"abort"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF815:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF960:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1025:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1015:
+	.string	"setRxFrameCallback"
+.LASF723:
+	.string	"__DEFINED_size_t "
+.LASF875:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF895:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF937:
+	.string	"USE_USART1 "
+.LASF877:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF823:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF988:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF883:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF974:
+	.string	"__gnuc_va_list"
+.LASF1021:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF719:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF927:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF909:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF785:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF708:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF926:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF956:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF707:
+	.string	"__need_size_t "
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF967:
+	.string	"__uint16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF871:
+	.string	"__timeval_defined 1"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF757:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF929:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF809:
+	.string	"__lldiv_t_defined 1"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF888:
+	.string	"__fsfilcnt_t_defined "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1013:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF976:
+	.string	"fp_offset"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF805:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF804:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF770:
+	.string	"__W_CONTINUED 0xffff"
+.LASF816:
+	.string	"__ino_t_defined "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF920:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF851:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF892:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF878:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF855:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1041:
+	.string	"init_printf"
+.LASF1035:
+	.string	"ui2a"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF741:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF728:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF704:
+	.string	"_VA_LIST_DEFINED "
+.LASF872:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF776:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1037:
+	.string	"setPrintfSerialPort"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF828:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF696:
+	.string	"__GNUC_VA_LIST "
+.LASF390:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF966:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF736:
+	.string	"_BSD_WCHAR_T_ "
+.LASF982:
+	.string	"buffer"
+.LASF810:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1049:
+	.string	"__va_list_tag"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1010:
+	.string	"serialTotalBytesWaiting"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1038:
+	.string	"initPrintfSupport"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF748:
+	.string	"NULL ((void *)0)"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF893:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF853:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF793:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF993:
+	.string	"MODE_RXTX"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1036:
+	.string	"uli2a"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF880:
+	.string	"NFDBITS __NFDBITS"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1005:
+	.string	"rxBuffer"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"WUNTRACED 2"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF987:
+	.string	"ringBuffer_t"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF896:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1016:
+	.string	"writeBuf"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF714:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF792:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF945:
+	.string	"UNUSED(x) (void)(x)"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF925:
+	.string	"U_ID_2 0"
+.LASF958:
+	.string	"printf tfp_printf"
+.LASF873:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF709:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF754:
+	.string	"WEXITED 4"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF814:
+	.string	"_SYS_TYPES_H 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF935:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF939:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF859:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF693:
+	.string	"_STDARG_H "
+.LASF954:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF806:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1034:
+	.string	"li2a"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1031:
+	.string	"printfSerialPort"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF697:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF952:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF775:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF863:
+	.string	"_SYS_SELECT_H 1"
+.LASF732:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF900:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF910:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF968:
+	.string	"__uint32_t"
+.LASF717:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF827:
+	.string	"__key_t_defined "
+.LASF980:
+	.string	"long long int"
+.LASF994:
+	.string	"MODE_SBUS"
+.LASF979:
+	.string	"va_list"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF729:
+	.string	"__wchar_t__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF997:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF847:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF798:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1008:
+	.string	"serialPortVTable"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1040:
+	.string	"tfp_printf"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF842:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF983:
+	.string	"mask"
+.LASF462:
+	.string	"__PMT"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF705:
+	.string	"_VA_LIST_T_H "
+.LASF1048:
+	.string	"__builtin_va_list"
+.LASF905:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF858:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF995:
+	.string	"portMode_t"
+.LASF784:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF975:
+	.string	"gp_offset"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF955:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF860:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF1018:
+	.string	"txReserve"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF790:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF780:
+	.string	"__HAVE_FLOAT128 1"
+.LASF861:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF767:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF962:
+	.string	"unsigned int"
+.LASF911:
+	.string	"__have_pthread_attr_t 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF948:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF743:
+	.string	"_WCHAR_T_DECLARED "
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF917:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1022:
+	.string	"FUNCTION_NONE"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF835:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1044:
+	.string	"tfp_format"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF913:
+	.string	"alloca"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1011:
+	.string	"serialRead"
+.LASF722:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF977:
+	.string	"overflow_arg_area"
+.LASF862:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF392:
+	.string	"false 0"
+.LASF1039:
+	.string	"tfp_sprintf"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF867:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF933:
+	.string	"ACC "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF761:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF943:
+	.string	"PROFILING "
+.LASF760:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF797:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF774:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF724:
+	.string	"___int_size_t_h "
+.LASF731:
+	.string	"_WCHAR_T "
+.LASF940:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF791:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1019:
+	.string	"txCommit"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF721:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF808:
+	.string	"__ldiv_t_defined 1"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF869:
+	.string	"____sigset_t_defined "
+.LASF970:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF712:
+	.string	"_SIZE_T "
+.LASF739:
+	.string	"_WCHAR_T_H "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF849:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1012:
+	.string	"serialSetBaudRate"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF961:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF716:
+	.string	"__SIZE_T "
+.LASF942:
+	.string	"BLACKBOX "
+.LASF833:
+	.string	"_ENDIAN_H 1"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF931:
+	.string	"GYRO "
+.LASF921:
+	.string	"__disable_irq() "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF986:
+	.string	"highWaterMark"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF772:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF734:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF850:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF742:
+	.string	"_GCC_WCHAR_T "
+.LASF755:
+	.string	"WCONTINUED 8"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF870:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF990:
+	.string	"serialInversion_e"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF981:
+	.string	"long long unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF796:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF771:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF978:
+	.string	"reg_save_area"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF720:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1004:
+	.string	"baudRate"
+.LASF825:
+	.string	"__ssize_t_defined "
+.LASF972:
+	.string	"uint16_t"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF699:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF957:
+	.string	"__TFP_PRINTF__ "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF865:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF831:
+	.string	"__timer_t_defined 1"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF766:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF817:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF836:
+	.string	"__BIG_ENDIAN 4321"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF907:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF700:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF727:
+	.string	"__size_t "
+.LASF882:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF738:
+	.string	"_WCHAR_T_DEFINED "
+.LASF694:
+	.string	"_ANSI_STDARG_H_ "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1047:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF758:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1020:
+	.string	"serialPort_t"
+.LASF718:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF749:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF915:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF891:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF733:
+	.string	"_T_WCHAR "
+.LASF1009:
+	.string	"serialWrite"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF701:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF750:
+	.string	"_STDLIB_H 1"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF884:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF779:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF735:
+	.string	"_WCHAR_T_ "
+.LASF822:
+	.string	"__off_t_defined "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF944:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF737:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF901:
+	.string	"__LOCK_ALIGNMENT "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF782:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF726:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF821:
+	.string	"__uid_t_defined "
+.LASF845:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF912:
+	.string	"_ALLOCA_H 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF786:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF800:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF769:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF989:
+	.string	"SERIAL_INVERTED"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF756:
+	.string	"WNOWAIT 0x01000000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF953:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF936:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF965:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF838:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1002:
+	.string	"mode"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF886:
+	.string	"__blkcnt_t_defined "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF856:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF885:
+	.string	"__blksize_t_defined "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF991:
+	.string	"MODE_RX"
+.LASF1033:
+	.string	"stdout_putp"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF949:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF923:
+	.string	"U_ID_0 0x5349544c"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF751:
+	.string	"WNOHANG 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1046:
+	.string	"putchw"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF950:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF730:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1045:
+	.string	"_putc"
+.LASF744:
+	.string	"__DEFINED_wchar_t "
+.LASF813:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF802:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF946:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF703:
+	.string	"_VA_LIST "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF773:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF906:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF899:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF852:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF698:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF706:
+	.string	"__va_list__ "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF844:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF941:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF759:
+	.string	"__WCLONE 0x80000000"
+.LASF1023:
+	.string	"FUNCTION_MSP"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF787:
+	.string	"__HAVE_FLOAT16 0"
+.LASF992:
+	.string	"MODE_TX"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF745:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF839:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF973:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF764:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF841:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF768:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF819:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1014:
+	.string	"setMode"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1017:
+	.string	"readBuf"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF695:
+	.string	"__need___va_list"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF763:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF818:
+	.string	"__gid_t_defined "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF811:
+	.string	"EXIT_FAILURE 1"
+.LASF807:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1000:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1028:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF889:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1032:
+	.string	"stdout_putf"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF947:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF840:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1027:
+	.string	"FUNCTION_GPS"
+.LASF881:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF914:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF894:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF702:
+	.string	"_VA_LIST_ "
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF963:
+	.string	"long unsigned int"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1030:
+	.string	"putcf"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF918:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF1050:
+	.string	"putcp"
+.LASF887:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	".//src/main/common/printf.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
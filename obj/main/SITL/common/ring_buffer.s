@@ -0,0 +1,7690 @@
+	.file	"ring_buffer.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/ring_buffer.c"
+	.section	.text.ringBufferInit,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferInit
+	.type	ringBufferInit, @function
+ringBufferInit:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/common/ring_buffer.c"
+	.loc 1 32 1 view -0
+	.cfi_startproc
+	.loc 1 33 5 view .LVU1
+	.loc 1 34 29 is_stmt 0 view .LVU2
+	subl	$1, %edx
+.LVL1:
+.LBB18:
+.LBB19:
+	.loc 1 41 22 view .LVU3
+	xorl	%eax, %eax
+.LBE19:
+.LBE18:
+	.loc 1 33 24 view .LVU4
+	movq	%rsi, (%rdi)
+	.loc 1 34 5 is_stmt 1 view .LVU5
+	.loc 1 34 29 is_stmt 0 view .LVU6
+	movw	%dx, 8(%rdi)
+	.loc 1 35 5 is_stmt 1 view .LVU7
+.LVL2:
+.LBB21:
+.LBI18:
+	.loc 1 39 6 view .LVU8
+.LBB20:
+	.loc 1 41 5 view .LVU9
+	.loc 1 42 5 view .LVU10
+	.loc 1 43 5 view .LVU11
+	.loc 1 41 22 is_stmt 0 view .LVU12
+	movw	%ax, 10(%rdi)
+	.loc 1 42 22 view .LVU13
+	movl	$0, 12(%rdi)
+.LVL3:
+	.loc 1 42 22 view .LVU14
+.LBE20:
+.LBE21:
+	.loc 1 36 1 view .LVU15
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	ringBufferInit, .-ringBufferInit
+	.section	.text.ringBufferReset,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferReset
+	.type	ringBufferReset, @function
+ringBufferReset:
+.LVL4:
+.LFB1:
+	.loc 1 40 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 41 5 view .LVU17
+	.loc 1 42 5 view .LVU18
+	.loc 1 43 31 is_stmt 0 view .LVU19
+	xorl	%eax, %eax
+	.loc 1 41 22 view .LVU20
+	movl	$0, 10(%rdi)
+	.loc 1 43 5 is_stmt 1 view .LVU21
+	.loc 1 43 31 is_stmt 0 view .LVU22
+	movw	%ax, 14(%rdi)
+	.loc 1 44 1 view .LVU23
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	ringBufferReset, .-ringBufferReset
+	.section	.text.ringBufferSize,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferSize
+	.type	ringBufferSize, @function
+ringBufferSize:
+.LVL5:
+.LFB2:
+	.loc 1 47 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 48 5 view .LVU25
+	.loc 1 48 29 is_stmt 0 view .LVU26
+	movzwl	8(%rdi), %eax
+	addl	$1, %eax
+	.loc 1 49 1 view .LVU27
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	ringBufferSize, .-ringBufferSize
+	.section	.text.ringBufferCount,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferCount
+	.type	ringBufferCount, @function
+ringBufferCount:
+.LVL6:
+.LFB3:
+	.loc 1 52 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 53 5 view .LVU29
+	.loc 1 53 23 is_stmt 0 view .LVU30
+	movzwl	10(%rdi), %eax
+	.loc 1 53 65 view .LVU31
+	movzwl	12(%rdi), %edx
+	.loc 1 53 12 view .LVU32
+	subl	%edx, %eax
+	.loc 1 53 65 view .LVU33
+	.loc 1 54 1 view .LVU34
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	ringBufferCount, .-ringBufferCount
+	.section	.text.ringBufferFree,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferFree
+	.type	ringBufferFree, @function
+ringBufferFree:
+.LVL7:
+.LFB4:
+	.loc 1 57 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 58 5 view .LVU36
+.LBB26:
+.LBI26:
+	.loc 1 46 10 view .LVU37
+.LBB27:
+	.loc 1 48 5 view .LVU38
+	.loc 1 48 5 is_stmt 0 view .LVU39
+.LBE27:
+.LBE26:
+.LBB29:
+.LBI29:
+	.loc 1 51 10 is_stmt 1 view .LVU40
+.LBB30:
+	.loc 1 53 5 view .LVU41
+.LBE30:
+.LBE29:
+.LBB33:
+.LBB28:
+	.loc 1 48 29 is_stmt 0 view .LVU42
+	movzwl	8(%rdi), %ecx
+.LBE28:
+.LBE33:
+.LBB34:
+.LBB31:
+	.loc 1 53 23 view .LVU43
+	movzwl	10(%rdi), %edx
+	.loc 1 53 65 view .LVU44
+	movzwl	12(%rdi), %eax
+.LBE31:
+.LBE34:
+	.loc 1 58 39 view .LVU45
+	leal	1(%rax,%rcx), %eax
+	subl	%edx, %eax
+.LBB35:
+.LBB32:
+	.loc 1 53 65 view .LVU46
+.LVL8:
+	.loc 1 53 65 view .LVU47
+.LBE32:
+.LBE35:
+	.loc 1 59 1 view .LVU48
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	ringBufferFree, .-ringBufferFree
+	.section	.text.ringBufferPut,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferPut
+	.type	ringBufferPut, @function
+ringBufferPut:
+.LVL9:
+.LFB6:
+	.loc 1 71 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 72 5 view .LVU50
+	.loc 1 72 14 is_stmt 0 view .LVU51
+	movzwl	10(%rdi), %eax
+.LVL10:
+	.loc 1 74 5 is_stmt 1 view .LVU52
+	.loc 1 74 27 is_stmt 0 view .LVU53
+	movzwl	12(%rdi), %ecx
+	.loc 1 74 9 view .LVU54
+	movl	%eax, %r8d
+	.loc 1 74 80 view .LVU55
+	movzwl	8(%rdi), %edx
+	.loc 1 74 9 view .LVU56
+	subl	%ecx, %r8d
+	.loc 1 75 15 view .LVU57
+	xorl	%ecx, %ecx
+	.loc 1 74 8 view .LVU58
+	cmpw	%r8w, %dx
+	jnb	.L11
+	.loc 1 83 1 view .LVU59
+	movl	%ecx, %eax
+.LVL11:
+	.loc 1 83 1 view .LVU60
+	ret
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 78 5 is_stmt 1 view .LVU61
+	.loc 1 78 29 is_stmt 0 view .LVU62
+	andl	%eax, %edx
+	.loc 1 79 49 view .LVU63
+	addl	$1, %eax
+.LVL13:
+	.loc 1 78 29 view .LVU64
+	movzwl	%dx, %edx
+	.loc 1 78 23 view .LVU65
+	addq	(%rdi), %rdx
+	.loc 1 78 49 view .LVU66
+	movb	%sil, (%rdx)
+.LVL14:
+	.loc 1 79 5 is_stmt 1 view .LVU67
+	movw	%ax, 10(%rdi)
+	.loc 1 80 5 view .LVU68
+.LVL15:
+.LBB38:
+.LBI38:
+	.loc 1 61 13 view .LVU69
+.LBB39:
+	.loc 1 63 5 view .LVU70
+	.loc 1 63 29 is_stmt 0 view .LVU71
+	movzwl	12(%rdi), %edx
+	.loc 1 63 14 view .LVU72
+	subl	%edx, %eax
+.LVL16:
+	.loc 1 65 5 is_stmt 1 view .LVU73
+	.loc 1 63 29 is_stmt 0 view .LVU74
+	.loc 1 65 8 view .LVU75
+	cmpw	%ax, 14(%rdi)
+	jnb	.L9
+	.loc 1 66 9 is_stmt 1 view .LVU76
+	.loc 1 66 35 is_stmt 0 view .LVU77
+	movw	%ax, 14(%rdi)
+.L9:
+	.loc 1 66 35 view .LVU78
+.LBE39:
+.LBE38:
+	.loc 1 82 11 view .LVU79
+	movl	$1, %ecx
+	.loc 1 83 1 view .LVU80
+	movl	%ecx, %eax
+.LVL17:
+	.loc 1 83 1 view .LVU81
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	ringBufferPut, .-ringBufferPut
+	.section	.text.ringBufferWrite,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferWrite
+	.type	ringBufferWrite, @function
+ringBufferWrite:
+.LVL18:
+.LFB7:
+	.loc 1 86 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 87 5 view .LVU83
+	.loc 1 86 1 is_stmt 0 view .LVU84
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rsi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 87 14 view .LVU85
+	movzwl	10(%rdi), %r13d
+.LVL19:
+	.loc 1 88 5 is_stmt 1 view .LVU86
+.LBB46:
+.LBI46:
+	.loc 1 46 10 view .LVU87
+.LBB47:
+	.loc 1 48 5 view .LVU88
+	.loc 1 48 22 is_stmt 0 view .LVU89
+	movzwl	8(%rdi), %eax
+.LVL20:
+	.loc 1 48 22 view .LVU90
+.LBE47:
+.LBE46:
+	.loc 1 88 73 view .LVU91
+	movzwl	12(%rdi), %ebx
+.LVL21:
+	.loc 1 89 5 is_stmt 1 view .LVU92
+	.loc 1 88 14 is_stmt 0 view .LVU93
+	subl	%r13d, %ebx
+.LVL22:
+	.loc 1 89 39 view .LVU94
+	movzwl	8(%rdi), %ebp
+	.loc 1 88 14 view .LVU95
+	leal	1(%rbx,%rax), %ebx
+	.loc 1 89 14 view .LVU96
+	movl	%ebp, %edi
+.LVL23:
+	.loc 1 89 14 view .LVU97
+	andl	%r13d, %edi
+.LVL24:
+	.loc 1 90 5 is_stmt 1 view .LVU98
+	.loc 1 92 5 view .LVU99
+	cmpw	%dx, %bx
+	cmova	%edx, %ebx
+.LVL25:
+	.loc 1 96 5 view .LVU100
+.LBB48:
+.LBI48:
+	.loc 1 46 10 view .LVU101
+.LBB49:
+	.loc 1 48 5 view .LVU102
+	.loc 1 48 5 is_stmt 0 view .LVU103
+.LBE49:
+.LBE48:
+	.loc 1 97 5 is_stmt 1 view .LVU104
+.LBB51:
+.LBB50:
+	.loc 1 48 29 is_stmt 0 view .LVU105
+	addl	$1, %ebp
+.LVL26:
+	.loc 1 48 29 view .LVU106
+.LBE50:
+.LBE51:
+	.loc 1 96 11 view .LVU107
+	subl	%edi, %ebp
+	.loc 1 101 5 view .LVU108
+	movzwl	%di, %edi
+	.loc 1 101 5 view .LVU109
+	cmpw	%bx, %bp
+	cmova	%ebx, %ebp
+.LVL27:
+	.loc 1 101 5 is_stmt 1 view .LVU110
+	.loc 1 101 23 is_stmt 0 view .LVU111
+	addq	(%r12), %rdi
+.LVL28:
+	.loc 1 104 49 view .LVU112
+	addl	%ebx, %r13d
+.LVL29:
+	.loc 1 101 5 view .LVU113
+	movzwl	%bp, %r15d
+	.loc 1 102 63 view .LVU114
+	movzwl	%bp, %ebp
+	.loc 1 101 5 view .LVU115
+	movq	%r15, %rdx
+	call	memcpy@PLT
+.LVL30:
+	.loc 1 102 5 is_stmt 1 view .LVU116
+	.loc 1 102 63 is_stmt 0 view .LVU117
+	movzwl	%bx, %edx
+	.loc 1 102 5 view .LVU118
+	movq	(%r12), %rdi
+	.loc 1 102 48 view .LVU119
+	leaq	(%r14,%r15), %rsi
+	.loc 1 102 63 view .LVU120
+	subl	%ebp, %edx
+	.loc 1 102 5 view .LVU121
+	movslq	%edx, %rdx
+	call	memcpy@PLT
+.LVL31:
+	.loc 1 104 5 is_stmt 1 view .LVU122
+	movw	%r13w, 10(%r12)
+	.loc 1 105 5 view .LVU123
+.LVL32:
+.LBB52:
+.LBI52:
+	.loc 1 61 13 view .LVU124
+.LBB53:
+	.loc 1 63 5 view .LVU125
+	.loc 1 63 29 is_stmt 0 view .LVU126
+	movzwl	12(%r12), %eax
+	.loc 1 63 14 view .LVU127
+	subl	%eax, %r13d
+.LVL33:
+	.loc 1 65 5 is_stmt 1 view .LVU128
+	.loc 1 63 29 is_stmt 0 view .LVU129
+	.loc 1 65 8 view .LVU130
+	cmpw	%r13w, 14(%r12)
+	jnb	.L12
+	.loc 1 66 9 is_stmt 1 view .LVU131
+	.loc 1 66 35 is_stmt 0 view .LVU132
+	movw	%r13w, 14(%r12)
+.LVL34:
+	.loc 1 66 35 view .LVU133
+.LBE53:
+.LBE52:
+	.loc 1 107 5 is_stmt 1 view .LVU134
+.L12:
+	.loc 1 108 1 is_stmt 0 view .LVU135
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+	movl	%ebx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL35:
+	.loc 1 108 1 view .LVU136
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL36:
+	.loc 1 108 1 view .LVU137
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL37:
+	.loc 1 108 1 view .LVU138
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL38:
+	.loc 1 108 1 view .LVU139
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL39:
+	.loc 1 108 1 view .LVU140
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	ringBufferWrite, .-ringBufferWrite
+	.section	.text.ringBufferWritePointer,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferWritePointer
+	.type	ringBufferWritePointer, @function
+ringBufferWritePointer:
+.LVL40:
+.LFB8:
+	.loc 1 112 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 113 5 view .LVU142
+.LBB54:
+.LBB55:
+	.loc 1 48 22 is_stmt 0 view .LVU143
+	movzwl	8(%rdi), %r9d
+.LBE55:
+.LBE54:
+	.loc 1 112 1 view .LVU144
+	movq	%rsi, %r8
+	.loc 1 113 14 view .LVU145
+	movzwl	10(%rdi), %esi
+.LVL41:
+	.loc 1 114 5 is_stmt 1 view .LVU146
+.LBB57:
+.LBI54:
+	.loc 1 46 10 view .LVU147
+.LBB56:
+	.loc 1 48 5 view .LVU148
+	.loc 1 48 5 is_stmt 0 view .LVU149
+.LBE56:
+.LBE57:
+	.loc 1 114 73 view .LVU150
+	movzwl	12(%rdi), %edx
+.LVL42:
+	.loc 1 115 5 is_stmt 1 view .LVU151
+	.loc 1 114 14 is_stmt 0 view .LVU152
+	subl	%esi, %edx
+.LVL43:
+	.loc 1 115 39 view .LVU153
+	movzwl	8(%rdi), %ecx
+	.loc 1 114 14 view .LVU154
+	leal	1(%rdx,%r9), %edx
+	.loc 1 115 14 view .LVU155
+	movl	%ecx, %eax
+.LBB58:
+.LBB59:
+	.loc 1 48 29 view .LVU156
+	addl	$1, %ecx
+.LBE59:
+.LBE58:
+	.loc 1 115 14 view .LVU157
+	andl	%esi, %eax
+.LVL44:
+	.loc 1 117 5 is_stmt 1 view .LVU158
+.LBB61:
+.LBI58:
+	.loc 1 46 10 view .LVU159
+.LBB60:
+	.loc 1 48 5 view .LVU160
+	.loc 1 48 5 is_stmt 0 view .LVU161
+.LBE60:
+.LBE61:
+	.loc 1 118 5 is_stmt 1 view .LVU162
+	.loc 1 117 46 is_stmt 0 view .LVU163
+	subl	%eax, %ecx
+	.loc 1 122 23 view .LVU164
+	movzwl	%ax, %eax
+	.loc 1 122 23 view .LVU165
+	cmpw	%cx, %dx
+	cmova	%ecx, %edx
+	movw	%dx, (%r8)
+	.loc 1 122 5 is_stmt 1 view .LVU166
+	.loc 1 122 12 is_stmt 0 view .LVU167
+	addq	(%rdi), %rax
+.LVL45:
+	.loc 1 123 1 view .LVU168
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	ringBufferWritePointer, .-ringBufferWritePointer
+	.section	.text.ringBufferProduce,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferProduce
+	.type	ringBufferProduce, @function
+ringBufferProduce:
+.LVL46:
+.LFB9:
+	.loc 1 126 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 5 view .LVU170
+	.loc 1 127 14 is_stmt 0 view .LVU171
+	addw	10(%rdi), %si
+.LVL47:
+	.loc 1 129 5 is_stmt 1 view .LVU172
+	movw	%si, 10(%rdi)
+	.loc 1 130 5 view .LVU173
+.LVL48:
+.LBB64:
+.LBI64:
+	.loc 1 61 13 view .LVU174
+.LBB65:
+	.loc 1 63 5 view .LVU175
+	.loc 1 63 29 is_stmt 0 view .LVU176
+	movzwl	12(%rdi), %eax
+	.loc 1 63 14 view .LVU177
+	subl	%eax, %esi
+.LVL49:
+	.loc 1 65 5 is_stmt 1 view .LVU178
+	.loc 1 63 29 is_stmt 0 view .LVU179
+	.loc 1 65 8 view .LVU180
+	cmpw	%si, 14(%rdi)
+	jnb	.L16
+	.loc 1 66 9 is_stmt 1 view .LVU181
+	.loc 1 66 35 is_stmt 0 view .LVU182
+	movw	%si, 14(%rdi)
+.LVL50:
+.L16:
+	.loc 1 66 35 view .LVU183
+.LBE65:
+.LBE64:
+	.loc 1 131 1 view .LVU184
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	ringBufferProduce, .-ringBufferProduce
+	.section	.text.ringBufferProduceUpTo,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferProduceUpTo
+	.type	ringBufferProduceUpTo, @function
+ringBufferProduceUpTo:
+.LVL51:
+.LFB10:
+	.loc 1 138 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 139 5 view .LVU186
+.LBB70:
+.LBI70:
+	.loc 1 125 6 view .LVU187
+.LBB71:
+	.loc 1 127 5 view .LVU188
+.LBE71:
+.LBE70:
+	.loc 1 139 42 is_stmt 0 view .LVU189
+	subw	10(%rdi), %si
+.LVL52:
+.LBB75:
+.LBB74:
+	.loc 1 127 14 view .LVU190
+	andw	8(%rdi), %si
+.LVL53:
+	.loc 1 127 14 view .LVU191
+	addw	10(%rdi), %si
+.LVL54:
+	.loc 1 129 5 is_stmt 1 view .LVU192
+	movw	%si, 10(%rdi)
+.LVL55:
+	.loc 1 130 5 view .LVU193
+.LBB72:
+.LBI72:
+	.loc 1 61 13 view .LVU194
+.LBB73:
+	.loc 1 63 5 view .LVU195
+	.loc 1 63 29 is_stmt 0 view .LVU196
+	movzwl	12(%rdi), %eax
+	.loc 1 63 14 view .LVU197
+	subl	%eax, %esi
+.LVL56:
+	.loc 1 65 5 is_stmt 1 view .LVU198
+	.loc 1 63 29 is_stmt 0 view .LVU199
+	.loc 1 65 8 view .LVU200
+	cmpw	%si, 14(%rdi)
+	jnb	.L18
+	.loc 1 66 9 is_stmt 1 view .LVU201
+	.loc 1 66 35 is_stmt 0 view .LVU202
+	movw	%si, 14(%rdi)
+.LVL57:
+.L18:
+	.loc 1 66 35 view .LVU203
+.LBE73:
+.LBE72:
+.LBE74:
+.LBE75:
+	.loc 1 140 1 view .LVU204
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	ringBufferProduceUpTo, .-ringBufferProduceUpTo
+	.section	.text.ringBufferGet,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferGet
+	.type	ringBufferGet, @function
+ringBufferGet:
+.LVL58:
+.LFB11:
+	.loc 1 143 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 5 view .LVU206
+	.loc 1 144 14 is_stmt 0 view .LVU207
+	movzwl	12(%rdi), %eax
+.LVL59:
+	.loc 1 146 5 is_stmt 1 view .LVU208
+	.loc 1 146 9 is_stmt 0 view .LVU209
+	movzwl	10(%rdi), %ecx
+	.loc 1 147 15 view .LVU210
+	xorl	%edx, %edx
+	.loc 1 146 9 view .LVU211
+	.loc 1 146 8 view .LVU212
+	cmpw	%ax, %cx
+	je	.L20
+	.loc 1 150 5 is_stmt 1 view .LVU213
+	.loc 1 150 37 is_stmt 0 view .LVU214
+	movzwl	8(%rdi), %edx
+	andl	%eax, %edx
+	.loc 1 151 49 view .LVU215
+	addl	$1, %eax
+.LVL60:
+	.loc 1 150 37 view .LVU216
+	movzwl	%dx, %edx
+	.loc 1 150 31 view .LVU217
+	addq	(%rdi), %rdx
+	movzbl	(%rdx), %edx
+	.loc 1 150 11 view .LVU218
+	movb	%dl, (%rsi)
+.LVL61:
+	.loc 1 151 5 is_stmt 1 view .LVU219
+	.loc 1 153 11 is_stmt 0 view .LVU220
+	movl	$1, %edx
+	.loc 1 151 5 view .LVU221
+	movw	%ax, 12(%rdi)
+	.loc 1 153 5 is_stmt 1 view .LVU222
+.L20:
+	.loc 1 154 1 is_stmt 0 view .LVU223
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	ringBufferGet, .-ringBufferGet
+	.section	.text.ringBufferRead,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferRead
+	.type	ringBufferRead, @function
+ringBufferRead:
+.LVL62:
+.LFB12:
+	.loc 1 157 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 158 5 view .LVU225
+	.loc 1 157 1 is_stmt 0 view .LVU226
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdi, %r12
+	movq	%rsi, %rdi
+.LVL63:
+	.loc 1 157 1 view .LVU227
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 158 14 view .LVU228
+	movzwl	12(%r12), %r13d
+.LVL64:
+	.loc 1 159 5 is_stmt 1 view .LVU229
+	.loc 1 159 22 is_stmt 0 view .LVU230
+	movzwl	10(%r12), %ebp
+.LVL65:
+	.loc 1 160 5 is_stmt 1 view .LVU231
+	.loc 1 159 14 is_stmt 0 view .LVU232
+	subl	%r13d, %ebp
+.LVL66:
+	.loc 1 160 39 view .LVU233
+	movzwl	8(%r12), %ebx
+	.loc 1 160 14 view .LVU234
+	movl	%ebx, %esi
+.LVL67:
+	.loc 1 160 14 view .LVU235
+	andl	%r13d, %esi
+.LVL68:
+	.loc 1 161 5 is_stmt 1 view .LVU236
+	.loc 1 163 5 view .LVU237
+	cmpw	%dx, %bp
+	cmova	%edx, %ebp
+.LVL69:
+	.loc 1 167 5 view .LVU238
+.LBB76:
+.LBI76:
+	.loc 1 46 10 view .LVU239
+.LBB77:
+	.loc 1 48 5 view .LVU240
+	.loc 1 48 5 is_stmt 0 view .LVU241
+.LBE77:
+.LBE76:
+	.loc 1 168 5 is_stmt 1 view .LVU242
+.LBB79:
+.LBB78:
+	.loc 1 48 29 is_stmt 0 view .LVU243
+	addl	$1, %ebx
+.LVL70:
+	.loc 1 48 29 view .LVU244
+.LBE78:
+.LBE79:
+	.loc 1 167 11 view .LVU245
+	subl	%esi, %ebx
+	.loc 1 172 5 view .LVU246
+	movzwl	%si, %esi
+	.loc 1 172 5 view .LVU247
+	cmpw	%bp, %bx
+	cmova	%ebp, %ebx
+.LVL71:
+	.loc 1 172 5 is_stmt 1 view .LVU248
+	.loc 1 172 35 is_stmt 0 view .LVU249
+	addq	(%r12), %rsi
+.LVL72:
+	.loc 1 175 49 view .LVU250
+	addl	%ebp, %r13d
+.LVL73:
+	.loc 1 172 5 view .LVU251
+	movzwl	%bx, %r14d
+	.loc 1 173 69 view .LVU252
+	movzwl	%bx, %ebx
+	.loc 1 172 5 view .LVU253
+	movq	%r14, %rdx
+.LVL74:
+	.loc 1 172 5 view .LVU254
+	call	memcpy@PLT
+.LVL75:
+	.loc 1 173 69 view .LVU255
+	movzwl	%bp, %edx
+	.loc 1 173 5 view .LVU256
+	movq	(%r12), %rsi
+	.loc 1 172 5 view .LVU257
+	movq	%rax, %rdi
+	.loc 1 173 5 is_stmt 1 view .LVU258
+	.loc 1 173 69 is_stmt 0 view .LVU259
+	subl	%ebx, %edx
+	.loc 1 173 17 view .LVU260
+	addq	%r14, %rdi
+	.loc 1 173 5 view .LVU261
+	movslq	%edx, %rdx
+	call	memcpy@PLT
+.LVL76:
+	.loc 1 175 5 is_stmt 1 view .LVU262
+	.loc 1 178 1 is_stmt 0 view .LVU263
+	movl	%ebp, %eax
+	.loc 1 175 5 view .LVU264
+	movw	%r13w, 12(%r12)
+	.loc 1 177 5 is_stmt 1 view .LVU265
+	.loc 1 178 1 is_stmt 0 view .LVU266
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL77:
+	.loc 1 178 1 view .LVU267
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL78:
+	.loc 1 178 1 view .LVU268
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL79:
+	.loc 1 178 1 view .LVU269
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL80:
+	.loc 1 178 1 view .LVU270
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	ringBufferRead, .-ringBufferRead
+	.section	.text.ringBufferReadPointer,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferReadPointer
+	.type	ringBufferReadPointer, @function
+ringBufferReadPointer:
+.LVL81:
+.LFB13:
+	.loc 1 182 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 183 5 view .LVU272
+	.loc 1 182 1 is_stmt 0 view .LVU273
+	movq	%rsi, %r8
+	.loc 1 183 14 view .LVU274
+	movzwl	12(%rdi), %esi
+.LVL82:
+	.loc 1 184 5 is_stmt 1 view .LVU275
+	.loc 1 184 22 is_stmt 0 view .LVU276
+	movzwl	10(%rdi), %ecx
+.LVL83:
+	.loc 1 185 5 is_stmt 1 view .LVU277
+	.loc 1 184 14 is_stmt 0 view .LVU278
+	subl	%esi, %ecx
+.LVL84:
+	.loc 1 185 39 view .LVU279
+	movzwl	8(%rdi), %edx
+	.loc 1 185 14 view .LVU280
+	movl	%edx, %eax
+.LBB80:
+.LBB81:
+	.loc 1 48 29 view .LVU281
+	addl	$1, %edx
+.LBE81:
+.LBE80:
+	.loc 1 185 14 view .LVU282
+	andl	%esi, %eax
+.LVL85:
+	.loc 1 187 5 is_stmt 1 view .LVU283
+.LBB83:
+.LBI80:
+	.loc 1 46 10 view .LVU284
+.LBB82:
+	.loc 1 48 5 view .LVU285
+	.loc 1 48 5 is_stmt 0 view .LVU286
+.LBE82:
+.LBE83:
+	.loc 1 188 5 is_stmt 1 view .LVU287
+	.loc 1 187 46 is_stmt 0 view .LVU288
+	subl	%eax, %edx
+	.loc 1 192 29 view .LVU289
+	movzwl	%ax, %eax
+	.loc 1 192 29 view .LVU290
+	cmpw	%cx, %dx
+	cmova	%ecx, %edx
+	movw	%dx, (%r8)
+	.loc 1 192 5 is_stmt 1 view .LVU291
+	.loc 1 192 12 is_stmt 0 view .LVU292
+	addq	(%rdi), %rax
+.LVL86:
+	.loc 1 193 1 view .LVU293
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	ringBufferReadPointer, .-ringBufferReadPointer
+	.section	.text.ringBufferConsume,"ax",@progbits
+	.p2align 4
+	.globl	ringBufferConsume
+	.type	ringBufferConsume, @function
+ringBufferConsume:
+.LVL87:
+.LFB14:
+	.loc 1 196 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 197 5 view .LVU295
+	.loc 1 197 61 is_stmt 0 view .LVU296
+	addw	12(%rdi), %si
+.LVL88:
+	.loc 1 197 5 view .LVU297
+	movw	%si, 12(%rdi)
+	.loc 1 198 1 view .LVU298
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	ringBufferConsume, .-ringBufferConsume
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 ".//src/main/common/ring_buffer.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x9ae
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF768
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL62
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF724
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF725
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF726
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF727
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF728
+	.uleb128 0xa
+	.long	.LASF730
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF729
+	.uleb128 0xa
+	.long	.LASF731
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF732
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF733
+	.uleb128 0xa
+	.long	.LASF734
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x1e
+	.long	0x87
+	.uleb128 0x14
+	.long	0x87
+	.uleb128 0xa
+	.long	.LASF735
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF736
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x1f
+	.long	.LASF769
+	.byte	0x10
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x10
+	.long	0xff
+	.uleb128 0xc
+	.long	.LASF737
+	.byte	0x1c
+	.byte	0x17
+	.long	0xff
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF738
+	.byte	0x1d
+	.byte	0xe
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0xc
+	.long	.LASF739
+	.byte	0x1e
+	.byte	0xe
+	.long	0x9d
+	.byte	0xa
+	.uleb128 0xc
+	.long	.LASF740
+	.byte	0x1f
+	.byte	0xe
+	.long	0x9d
+	.byte	0xc
+	.uleb128 0xc
+	.long	.LASF741
+	.byte	0x20
+	.byte	0xe
+	.long	0x9d
+	.byte	0xe
+	.byte	0
+	.uleb128 0x6
+	.long	0x93
+	.uleb128 0xa
+	.long	.LASF742
+	.byte	0x5
+	.byte	0x21
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x14
+	.long	0x104
+	.uleb128 0x20
+	.long	.LASF761
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.long	0x7e
+	.long	0x135
+	.uleb128 0x11
+	.long	0x7e
+	.uleb128 0x11
+	.long	0x135
+	.uleb128 0x11
+	.long	0xa9
+	.byte	0
+	.uleb128 0x6
+	.long	0x13a
+	.uleb128 0x21
+	.uleb128 0x12
+	.long	.LASF754
+	.byte	0xc3
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x178
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0xc3
+	.byte	0x26
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.long	.LASF744
+	.byte	0xc3
+	.byte	0x3b
+	.long	0x9d
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x6
+	.long	0x104
+	.uleb128 0x7
+	.long	.LASF747
+	.byte	0xb5
+	.byte	0x10
+	.long	0x217
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x217
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0xb5
+	.byte	0x3a
+	.long	0x21c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.long	.LASF745
+	.byte	0xb5
+	.byte	0x50
+	.long	0x221
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2
+	.long	.LASF740
+	.byte	0xb7
+	.long	0x9d
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0xb8
+	.long	0x9d
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0xb9
+	.long	0x9d
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xd
+	.long	0x81d
+	.quad	.LBI80
+	.byte	.LVU284
+	.long	.LLRL59
+	.byte	0xbb
+	.byte	0x13
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0x6
+	.long	0x110
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF748
+	.byte	0x9c
+	.byte	0xa
+	.long	0x9d
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x32f
+	.uleb128 0x4
+	.long	.LASF743
+	.byte	0x9c
+	.byte	0x27
+	.long	0x178
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x4
+	.long	.LASF749
+	.byte	0x9c
+	.byte	0x3c
+	.long	0x32f
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x4
+	.long	.LASF750
+	.byte	0x9c
+	.byte	0x4b
+	.long	0x9d
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2
+	.long	.LASF740
+	.byte	0x9e
+	.long	0x9d
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0x9f
+	.long	0x9d
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0xa0
+	.long	0x9d
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0xa1
+	.long	0x9d
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0xe
+	.long	0x81d
+	.quad	.LBI76
+	.byte	.LVU239
+	.long	.LLRL53
+	.byte	0xa7
+	.byte	0xd
+	.long	0x2ee
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL75
+	.long	0x9a6
+	.long	0x30d
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL76
+	.long	0x9a6
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xf
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x87
+	.uleb128 0x7
+	.long	.LASF752
+	.byte	0x8e
+	.byte	0x5
+	.long	0x382
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x382
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x8e
+	.byte	0x21
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.long	.LASF749
+	.byte	0x8e
+	.byte	0x36
+	.long	0x32f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF740
+	.byte	0x90
+	.long	0x9d
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF753
+	.uleb128 0x12
+	.long	.LASF755
+	.byte	0x89
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44f
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x89
+	.byte	0x2a
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.long	.LASF746
+	.byte	0x89
+	.byte	0x3f
+	.long	0x9d
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0xd
+	.long	0x44f
+	.quad	.LBI70
+	.byte	.LVU187
+	.long	.LLRL38
+	.byte	0x8b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x464
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x459
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x22
+	.long	.LLRL38
+	.uleb128 0xb
+	.long	0x46f
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x13
+	.long	0x75e
+	.quad	.LBI72
+	.byte	.LVU194
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0x82
+	.uleb128 0x1
+	.long	0x776
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1
+	.long	0x76b
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xb
+	.long	0x781
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF764
+	.byte	0x7d
+	.long	0x47a
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x7d
+	.byte	0x26
+	.long	0x178
+	.uleb128 0x9
+	.long	.LASF744
+	.byte	0x7d
+	.byte	0x3b
+	.long	0x9d
+	.uleb128 0x18
+	.long	.LASF739
+	.byte	0x7f
+	.long	0x9d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF756
+	.byte	0x6f
+	.byte	0xa
+	.long	0x32f
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x6f
+	.byte	0x2f
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.long	.LASF745
+	.byte	0x6f
+	.byte	0x45
+	.long	0x221
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2
+	.long	.LASF739
+	.byte	0x71
+	.long	0x9d
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	.LASF757
+	.byte	0x72
+	.long	0x9d
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x73
+	.long	0x9d
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xe
+	.long	0x81d
+	.quad	.LBI54
+	.byte	.LVU147
+	.long	.LLRL28
+	.byte	0x72
+	.byte	0x1a
+	.long	0x517
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0xd
+	.long	0x81d
+	.quad	.LBI58
+	.byte	.LVU159
+	.long	.LLRL30
+	.byte	0x75
+	.byte	0x13
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF758
+	.byte	0x55
+	.byte	0xa
+	.long	0x9d
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6c9
+	.uleb128 0x4
+	.long	.LASF743
+	.byte	0x55
+	.byte	0x28
+	.long	0x178
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x4
+	.long	.LASF749
+	.byte	0x55
+	.byte	0x43
+	.long	0x217
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	.LASF744
+	.byte	0x55
+	.byte	0x52
+	.long	0x9d
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x2
+	.long	.LASF739
+	.byte	0x57
+	.long	0x9d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x2
+	.long	.LASF757
+	.byte	0x58
+	.long	0x9d
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x59
+	.long	0x9d
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x5a
+	.long	0x9d
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x19
+	.long	0x81d
+	.quad	.LBI46
+	.byte	.LVU87
+	.quad	.LBB46
+	.quad	.LBE46-.LBB46
+	.byte	0x58
+	.byte	0x1a
+	.long	0x60e
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0xe
+	.long	0x81d
+	.quad	.LBI48
+	.byte	.LVU101
+	.long	.LLRL19
+	.byte	0x60
+	.byte	0xd
+	.long	0x634
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x19
+	.long	0x75e
+	.quad	.LBI52
+	.byte	.LVU124
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.byte	0x69
+	.byte	0x5
+	.long	0x680
+	.uleb128 0x1
+	.long	0x776
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0x76b
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xb
+	.long	0x781
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL30
+	.long	0x9a6
+	.long	0x69e
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LVL31
+	.long	0x9a6
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x22
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF759
+	.byte	0x46
+	.byte	0x5
+	.long	0x382
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75e
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x46
+	.byte	0x21
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.long	.LASF749
+	.byte	0x46
+	.byte	0x35
+	.long	0x87
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF739
+	.byte	0x48
+	.long	0x9d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x13
+	.long	0x75e
+	.quad	.LBI38
+	.byte	.LVU69
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.byte	0x50
+	.uleb128 0x1
+	.long	0x776
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1
+	.long	0x76b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xb
+	.long	0x781
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF770
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xd
+	.byte	0x1
+	.long	0x78c
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x3d
+	.byte	0x2f
+	.long	0x178
+	.uleb128 0x9
+	.long	.LASF739
+	.byte	0x3d
+	.byte	0x44
+	.long	0x9d
+	.uleb128 0x18
+	.long	.LASF744
+	.byte	0x3f
+	.long	0x9d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF760
+	.byte	0x38
+	.byte	0xa
+	.long	0x9d
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x803
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x38
+	.byte	0x2d
+	.long	0x21c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.long	0x81d
+	.quad	.LBI26
+	.byte	.LVU37
+	.long	.LLRL3
+	.byte	0x3a
+	.byte	0xc
+	.long	0x7e0
+	.uleb128 0x1
+	.long	0x82b
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0xd
+	.long	0x803
+	.quad	.LBI29
+	.byte	.LVU40
+	.long	.LLRL5
+	.byte	0x3a
+	.byte	0x29
+	.uleb128 0x1
+	.long	0x811
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF762
+	.byte	0x33
+	.long	0x9d
+	.long	0x81d
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x33
+	.byte	0x2e
+	.long	0x21c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF763
+	.byte	0x2e
+	.long	0x9d
+	.long	0x837
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x2e
+	.byte	0x2d
+	.long	0x21c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF765
+	.byte	0x27
+	.long	0x84d
+	.uleb128 0x9
+	.long	.LASF743
+	.byte	0x27
+	.byte	0x24
+	.long	0x178
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF766
+	.byte	0x1f
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b9
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x1f
+	.byte	0x23
+	.long	0x178
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.long	.LASF737
+	.byte	0x1f
+	.byte	0x41
+	.long	0xff
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.long	.LASF767
+	.byte	0x1f
+	.byte	0x52
+	.long	0x9d
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xd
+	.long	0x837
+	.quad	.LBI18
+	.byte	.LVU8
+	.long	.LLRL1
+	.byte	0x23
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x841
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x837
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8dc
+	.uleb128 0x10
+	.long	0x841
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xf
+	.long	0x81d
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ff
+	.uleb128 0x10
+	.long	0x82b
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xf
+	.long	0x803
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x922
+	.uleb128 0x10
+	.long	0x811
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xf
+	.long	0x44f
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9a6
+	.uleb128 0x10
+	.long	0x459
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.long	0x464
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xb
+	.long	0x46f
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x13
+	.long	0x75e
+	.quad	.LBI64
+	.byte	.LVU174
+	.quad	.LBB64
+	.quad	.LBE64-.LBB64
+	.byte	0x82
+	.uleb128 0x1
+	.long	0x776
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x76b
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xb
+	.long	0x781
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF761
+	.long	.LASF771
+	.byte	0x7
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 0
+.LLST61:
+	.byte	0x6
+	.quad	.LVL87
+	.byte	0x4
+	.uleb128 .LVL87-.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL88-.LVL87
+	.uleb128 .LFE14-.LVL87
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 0
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 0
+.LLST55:
+	.byte	0x6
+	.quad	.LVL81
+	.byte	0x4
+	.uleb128 .LVL81-.LVL81
+	.uleb128 .LVL82-.LVL81
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-.LVL81
+	.uleb128 .LFE13-.LVL81
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU275
+	.uleb128 0
+.LLST56:
+	.byte	0x8
+	.quad	.LVL82
+	.uleb128 .LFE13-.LVL82
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+.LLST57:
+	.byte	0x8
+	.quad	.LVL83
+	.uleb128 .LVL84-.LVL83
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU283
+	.uleb128 .LVU293
+.LLST58:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL86-.LVL85
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU284
+	.uleb128 .LVU286
+.LLST60:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL85-.LVL85
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 0
+.LLST46:
+	.byte	0x6
+	.quad	.LVL62
+	.byte	0x4
+	.uleb128 .LVL62-.LVL62
+	.uleb128 .LVL63-.LVL62
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-.LVL62
+	.uleb128 .LVL79-.LVL62
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL79-.LVL62
+	.uleb128 .LFE12-.LVL62
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU255
+	.uleb128 .LVU255
+	.uleb128 0
+.LLST47:
+	.byte	0x6
+	.quad	.LVL62
+	.byte	0x4
+	.uleb128 .LVL62-.LVL62
+	.uleb128 .LVL67-.LVL62
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL67-.LVL62
+	.uleb128 .LVL75-1-.LVL62
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-1-.LVL62
+	.uleb128 .LFE12-.LVL62
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 0
+.LLST48:
+	.byte	0x6
+	.quad	.LVL62
+	.byte	0x4
+	.uleb128 .LVL62-.LVL62
+	.uleb128 .LVL74-.LVL62
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL62
+	.uleb128 .LFE12-.LVL62
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU229
+	.uleb128 .LVU251
+	.uleb128 .LVU251
+	.uleb128 .LVU255
+.LLST49:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL73-.LVL64
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL73-.LVL64
+	.uleb128 .LVL75-1-.LVL64
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 12
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU231
+	.uleb128 .LVU233
+	.uleb128 .LVU238
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 0
+.LLST50:
+	.byte	0x6
+	.quad	.LVL65
+	.byte	0x4
+	.uleb128 .LVL65-.LVL65
+	.uleb128 .LVL66-.LVL65
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.LVL65
+	.uleb128 .LVL78-.LVL65
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL78-.LVL65
+	.uleb128 .LFE12-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU236
+	.uleb128 .LVU250
+.LLST51:
+	.byte	0x8
+	.quad	.LVL68
+	.uleb128 .LVL72-.LVL68
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU241
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU270
+.LLST52:
+	.byte	0x6
+	.quad	.LVL69
+	.byte	0x4
+	.uleb128 .LVL69-.LVL69
+	.uleb128 .LVL70-.LVL69
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL69
+	.uleb128 .LVL71-.LVL69
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x94
+	.byte	0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL71-.LVL69
+	.uleb128 .LVL77-.LVL69
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL77-.LVL69
+	.uleb128 .LVL80-.LVL69
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+.LLST54:
+	.byte	0x8
+	.quad	.LVL69
+	.uleb128 .LVL69-.LVL69
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU208
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST45:
+	.byte	0x6
+	.quad	.LVL59
+	.byte	0x4
+	.uleb128 .LVL59-.LVL59
+	.uleb128 .LVL60-.LVL59
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.LVL59
+	.uleb128 .LVL61-.LVL59
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 12
+	.byte	0
+.LVUS37:
+	.uleb128 0
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST37:
+	.byte	0x6
+	.quad	.LVL51
+	.byte	0x4
+	.uleb128 .LVL51-.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-.LVL51
+	.uleb128 .LFE10-.LVL51
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+.LLST39:
+	.byte	0x6
+	.quad	.LVL51
+	.byte	0x4
+	.uleb128 .LVL51-.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0xd
+	.byte	0x74
+	.sleb128 0
+	.byte	0x75
+	.sleb128 10
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 8
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL51
+	.uleb128 .LVL53-.LVL51
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x75
+	.sleb128 10
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 8
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL51
+	.uleb128 .LVL54-.LVL51
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL51
+	.uleb128 .LVL55-.LVL51
+	.uleb128 0xe
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x75
+	.sleb128 10
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1c
+	.byte	0x75
+	.sleb128 8
+	.byte	0x94
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU187
+	.uleb128 .LVU203
+.LLST40:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL57-.LVL51
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU192
+	.uleb128 .LVU198
+.LLST41:
+	.byte	0x8
+	.quad	.LVL54
+	.uleb128 .LVL56-.LVL54
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU194
+	.uleb128 .LVU198
+.LLST42:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU194
+	.uleb128 .LVU203
+.LLST43:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL57-.LVL55
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU198
+	.uleb128 .LVU203
+.LLST44:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LVL57-.LVL56
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL40
+	.byte	0x4
+	.uleb128 .LVL40-.LVL40
+	.uleb128 .LVL41-.LVL40
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.LVL40
+	.uleb128 .LFE8-.LVL40
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU146
+	.uleb128 0
+.LLST25:
+	.byte	0x8
+	.quad	.LVL41
+	.uleb128 .LFE8-.LVL41
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU151
+	.uleb128 .LVU153
+.LLST26:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL43-.LVL42
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU158
+	.uleb128 .LVU168
+.LLST27:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL45-.LVL44
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU147
+	.uleb128 .LVU149
+.LLST29:
+	.byte	0x8
+	.quad	.LVL41
+	.uleb128 .LVL41-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST31:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL23-.LVL18
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL23-.LVL18
+	.uleb128 .LVL37-.LVL18
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL37-.LVL18
+	.uleb128 .LFE7-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL30-1-.LVL18
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-1-.LVL18
+	.uleb128 .LVL38-.LVL18
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL38-.LVL18
+	.uleb128 .LFE7-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL25-.LVL18
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL25-.LVL18
+	.uleb128 .LVL35-.LVL18
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.LVL18
+	.uleb128 .LFE7-.LVL18
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU86
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU116
+.LLST14:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL29-.LVL19
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL29-.LVL19
+	.uleb128 .LVL30-1-.LVL19
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 10
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+.LLST15:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU98
+	.uleb128 .LVU112
+.LLST16:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LVL28-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU103
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU140
+.LLST17:
+	.byte	0x6
+	.quad	.LVL25
+	.byte	0x4
+	.uleb128 .LVL25-.LVL25
+	.uleb128 .LVL26-.LVL25
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL25
+	.uleb128 .LVL27-.LVL25
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 8
+	.byte	0x94
+	.byte	0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL25
+	.uleb128 .LVL36-.LVL25
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL36-.LVL25
+	.uleb128 .LVL39-.LVL25
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+.LLST18:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU101
+	.uleb128 .LVU103
+.LLST20:
+	.byte	0x8
+	.quad	.LVL25
+	.uleb128 .LVL25-.LVL25
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+.LLST21:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU124
+	.uleb128 .LVU133
+.LLST22:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-.LVL32
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU128
+	.uleb128 .LVU133
+.LLST23:
+	.byte	0x8
+	.quad	.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU52
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU67
+.LLST7:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL12-.LVL10
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 10
+	.byte	0x4
+	.uleb128 .LVL12-.LVL10
+	.uleb128 .LVL13-.LVL10
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.LVL10
+	.uleb128 .LVL14-.LVL10
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 10
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU69
+	.uleb128 .LVU73
+.LLST8:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST9:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LFE6-.LVL15
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU73
+	.uleb128 .LVU81
+.LLST10:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU37
+	.uleb128 .LVU39
+.LLST4:
+	.byte	0x8
+	.quad	.LVL7
+	.uleb128 .LVL7-.LVL7
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU39
+	.uleb128 .LVU47
+.LLST6:
+	.byte	0x8
+	.quad	.LVL7
+	.uleb128 .LVL8-.LVL7
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU8
+	.uleb128 .LVU14
+.LLST2:
+	.byte	0x8
+	.quad	.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL46
+	.byte	0x4
+	.uleb128 .LVL46-.LVL46
+	.uleb128 .LVL47-.LVL46
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-.LVL46
+	.uleb128 .LFE9-.LVL46
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU172
+	.uleb128 .LVU178
+.LLST33:
+	.byte	0x8
+	.quad	.LVL47
+	.uleb128 .LVL49-.LVL47
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU174
+	.uleb128 .LVU178
+.LLST34:
+	.byte	0x8
+	.quad	.LVL48
+	.uleb128 .LVL49-.LVL48
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU174
+	.uleb128 .LVU183
+.LLST35:
+	.byte	0x8
+	.quad	.LVL48
+	.uleb128 .LVL50-.LVL48
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU178
+	.uleb128 .LVU183
+.LLST36:
+	.byte	0x8
+	.quad	.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xfc
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x5
+	.quad	.LBB18
+	.byte	0x4
+	.uleb128 .LBB18-.LBB18
+	.uleb128 .LBE18-.LBB18
+	.byte	0x4
+	.uleb128 .LBB21-.LBB18
+	.uleb128 .LBE21-.LBB18
+	.byte	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB26
+	.byte	0x4
+	.uleb128 .LBB26-.LBB26
+	.uleb128 .LBE26-.LBB26
+	.byte	0x4
+	.uleb128 .LBB33-.LBB26
+	.uleb128 .LBE33-.LBB26
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB29
+	.byte	0x4
+	.uleb128 .LBB29-.LBB29
+	.uleb128 .LBE29-.LBB29
+	.byte	0x4
+	.uleb128 .LBB34-.LBB29
+	.uleb128 .LBE34-.LBB29
+	.byte	0x4
+	.uleb128 .LBB35-.LBB29
+	.uleb128 .LBE35-.LBB29
+	.byte	0
+.LLRL19:
+	.byte	0x5
+	.quad	.LBB48
+	.byte	0x4
+	.uleb128 .LBB48-.LBB48
+	.uleb128 .LBE48-.LBB48
+	.byte	0x4
+	.uleb128 .LBB51-.LBB48
+	.uleb128 .LBE51-.LBB48
+	.byte	0
+.LLRL28:
+	.byte	0x5
+	.quad	.LBB54
+	.byte	0x4
+	.uleb128 .LBB54-.LBB54
+	.uleb128 .LBE54-.LBB54
+	.byte	0x4
+	.uleb128 .LBB57-.LBB54
+	.uleb128 .LBE57-.LBB54
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB58
+	.byte	0x4
+	.uleb128 .LBB58-.LBB58
+	.uleb128 .LBE58-.LBB58
+	.byte	0x4
+	.uleb128 .LBB61-.LBB58
+	.uleb128 .LBE61-.LBB58
+	.byte	0
+.LLRL38:
+	.byte	0x5
+	.quad	.LBB70
+	.byte	0x4
+	.uleb128 .LBB70-.LBB70
+	.uleb128 .LBE70-.LBB70
+	.byte	0x4
+	.uleb128 .LBB75-.LBB70
+	.uleb128 .LBE75-.LBB70
+	.byte	0
+.LLRL53:
+	.byte	0x5
+	.quad	.LBB76
+	.byte	0x4
+	.uleb128 .LBB76-.LBB76
+	.uleb128 .LBE76-.LBB76
+	.byte	0x4
+	.uleb128 .LBB79-.LBB76
+	.uleb128 .LBE79-.LBB76
+	.byte	0
+.LLRL59:
+	.byte	0x5
+	.quad	.LBB80
+	.byte	0x4
+	.uleb128 .LBB80-.LBB80
+	.uleb128 .LBE80-.LBB80
+	.byte	0x4
+	.uleb128 .LBB83-.LBB80
+	.uleb128 .LBE83-.LBB80
+	.byte	0
+.LLRL62:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB8
+	.uleb128 .LFE8-.LFB8
+	.byte	0x7
+	.quad	.LFB9
+	.uleb128 .LFE9-.LFB9
+	.byte	0x7
+	.quad	.LFB10
+	.uleb128 .LFE10-.LFB10
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.file 11 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 27 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF723
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF751:
+	.string	"chunk"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF736:
+	.string	"size_t"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF740:
+	.string	"tail"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF745:
+	.string	"contiguous"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF391:
+	.string	"true 1"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF760:
+	.string	"ringBufferFree"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF769:
+	.string	"ringBuffer_s"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF715:
+	.string	"NULL"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF732:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF764:
+	.string	"ringBufferProduce"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF739:
+	.string	"head"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF728:
+	.string	"signed char"
+.LASF734:
+	.string	"uint8_t"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF753:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF747:
+	.string	"ringBufferReadPointer"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF731:
+	.string	"__uint16_t"
+.LASF770:
+	.string	"updateHighWaterMark"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF771:
+	.string	"__builtin_memcpy"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF757:
+	.string	"bytesFree"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF390:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF730:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF737:
+	.string	"buffer"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF717:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF746:
+	.string	"index"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF748:
+	.string	"ringBufferRead"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF742:
+	.string	"ringBuffer_t"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF765:
+	.string	"ringBufferReset"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF714:
+	.string	"__need_size_t"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF738:
+	.string	"mask"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF752:
+	.string	"ringBufferGet"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF721:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF462:
+	.string	"__PMT"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF763:
+	.string	"ringBufferSize"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF744:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF762:
+	.string	"ringBufferCount"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF726:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF723:
+	.string	"publishIndex(index,value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF724:
+	.string	"unsigned char"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF546:
+	.string	"__stub_revoke "
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF733:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF725:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF741:
+	.string	"highWaterMark"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF767:
+	.string	"size"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF379:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF735:
+	.string	"uint16_t"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF727:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF768:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF743:
+	.string	"ringBuffer"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF758:
+	.string	"ringBufferWrite"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF754:
+	.string	"ringBufferConsume"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF750:
+	.string	"maxCount"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF729:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF759:
+	.string	"ringBufferPut"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF761:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF722:
+	.string	"loadIndex(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF766:
+	.string	"ringBufferInit"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF756:
+	.string	"ringBufferWritePointer"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF755:
+	.string	"ringBufferProduceUpTo"
+.LASF749:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/common/ring_buffer.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
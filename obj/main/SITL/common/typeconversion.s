@@ -0,0 +1,13021 @@
+	.file	"typeconversion.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/common/typeconversion.c"
+	.section	.rodata._i2a.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	.section	.text._i2a,"ax",@progbits
+	.p2align 4
+	.type	_i2a, @function
+_i2a:
+.LVL0:
+.LFB6:
+	.file 1 ".//src/main/common/typeconversion.c"
+	.loc 1 126 1 view -0
+	.cfi_startproc
+	.loc 1 127 5 view .LVU1
+	.loc 1 126 1 is_stmt 0 view .LVU2
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC0(%rip), %rcx
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%edx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 127 8 view .LVU3
+	cmpl	%edx, %edi
+	jnb	.L9
+.LVL1:
+.L2:
+	.loc 1 129 5 is_stmt 1 view .LVU4
+	.loc 1 129 48 is_stmt 0 view .LVU5
+	movl	%ebp, %eax
+	xorl	%edx, %edx
+	divl	%ebx
+	.loc 1 129 8 view .LVU6
+	movzbl	(%rcx,%rdx), %eax
+	movb	%al, (%rsi)
+	.loc 1 130 5 is_stmt 1 view .LVU7
+	.loc 1 131 1 is_stmt 0 view .LVU8
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 130 14 view .LVU9
+	leaq	1(%rsi), %rax
+	.loc 1 131 1 view .LVU10
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL2:
+	.loc 1 131 1 view .LVU11
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL3:
+	.loc 1 131 1 view .LVU12
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL4:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.cfi_restore_state
+	.loc 1 128 9 is_stmt 1 view .LVU13
+	.loc 1 128 13 is_stmt 0 view .LVU14
+	movl	%edi, %eax
+	xorl	%edx, %edx
+.LVL5:
+	.loc 1 128 13 view .LVU15
+	divl	%ebx
+	movl	%eax, %r12d
+.LVL6:
+.LBB6:
+.LBI6:
+	.loc 1 125 14 is_stmt 1 view .LVU16
+.LBB7:
+	.loc 1 127 5 view .LVU17
+	.loc 1 127 8 is_stmt 0 view .LVU18
+	cmpl	%ebx, %eax
+	jnb	.L10
+.LVL7:
+.L3:
+	.loc 1 129 5 is_stmt 1 view .LVU19
+	.loc 1 129 48 is_stmt 0 view .LVU20
+	movl	%r12d, %eax
+	xorl	%edx, %edx
+	.loc 1 130 14 view .LVU21
+	addq	$1, %rsi
+.LVL8:
+	.loc 1 129 48 view .LVU22
+	divl	%ebx
+	.loc 1 129 8 view .LVU23
+	movzbl	(%rcx,%rdx), %eax
+	movb	%al, -1(%rsi)
+	.loc 1 130 5 is_stmt 1 view .LVU24
+.LVL9:
+	.loc 1 130 5 is_stmt 0 view .LVU25
+	jmp	.L2
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 128 9 is_stmt 1 view .LVU26
+	.loc 1 128 13 is_stmt 0 view .LVU27
+	xorl	%edx, %edx
+	divl	%ebx
+.LVL11:
+	.loc 1 128 13 view .LVU28
+	movl	%eax, %r13d
+.LVL12:
+.LBB8:
+.LBI8:
+	.loc 1 125 14 is_stmt 1 view .LVU29
+.LBB9:
+	.loc 1 127 5 view .LVU30
+	.loc 1 127 8 is_stmt 0 view .LVU31
+	cmpl	%ebx, %eax
+	jnb	.L11
+.LVL13:
+.L4:
+	.loc 1 129 5 is_stmt 1 view .LVU32
+	.loc 1 129 48 is_stmt 0 view .LVU33
+	movl	%r13d, %eax
+	xorl	%edx, %edx
+	leaq	.LC0(%rip), %rcx
+	.loc 1 130 14 view .LVU34
+	addq	$1, %rsi
+.LVL14:
+	.loc 1 129 48 view .LVU35
+	divl	%ebx
+	.loc 1 129 8 view .LVU36
+	movzbl	(%rcx,%rdx), %eax
+	movb	%al, -1(%rsi)
+	.loc 1 130 5 is_stmt 1 view .LVU37
+.LVL15:
+	.loc 1 130 5 is_stmt 0 view .LVU38
+	jmp	.L3
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 128 9 is_stmt 1 view .LVU39
+	.loc 1 128 13 is_stmt 0 view .LVU40
+	xorl	%edx, %edx
+	divl	%ebx
+.LVL17:
+	.loc 1 128 13 view .LVU41
+	movl	%ebx, %edx
+	movl	%eax, %edi
+.LVL18:
+	.loc 1 128 13 view .LVU42
+	call	_i2a
+.LVL19:
+	.loc 1 128 13 view .LVU43
+	movq	%rax, %rsi
+.LVL20:
+	.loc 1 128 13 view .LVU44
+	jmp	.L4
+.LBE9:
+.LBE8:
+.LBE7:
+.LBE6:
+	.cfi_endproc
+.LFE6:
+	.size	_i2a, .-_i2a
+	.section	.text.uli2a,"ax",@progbits
+	.p2align 4
+	.globl	uli2a
+	.type	uli2a, @function
+uli2a:
+.LVL21:
+.LFB0:
+	.loc 1 26 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 27 5 view .LVU46
+	.loc 1 28 5 view .LVU47
+	.loc 1 29 5 view .LVU48
+	.loc 1 29 20 view .LVU49
+	.loc 1 26 1 is_stmt 0 view .LVU50
+	movl	%esi, %r10d
+	movq	%rcx, %r9
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 26 1 view .LVU51
+	movl	%edx, %r11d
+	movq	%r10, %r8
+	.loc 1 28 18 view .LVU52
+	movl	$1, %ecx
+.LVL22:
+	.loc 1 29 20 view .LVU53
+	cmpq	%r10, %rdi
+	jb	.L20
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 30 9 is_stmt 1 view .LVU54
+	.loc 1 30 11 is_stmt 0 view .LVU55
+	imull	%r8d, %ecx
+.LVL24:
+	.loc 1 29 20 is_stmt 1 view .LVU56
+	.loc 1 29 16 is_stmt 0 view .LVU57
+	movq	%rdi, %rax
+	xorl	%edx, %edx
+	movl	%ecx, %esi
+	divq	%rsi
+	.loc 1 29 20 view .LVU58
+	cmpq	%r10, %rax
+	jnb	.L14
+	.loc 1 31 14 is_stmt 1 view .LVU59
+	testl	%ecx, %ecx
+	je	.L27
+.LVL25:
+.L13:
+	.loc 1 27 9 is_stmt 0 view .LVU60
+	xorl	%r10d, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L19:
+.LVL26:
+.LBB10:
+	.loc 1 32 9 is_stmt 1 view .LVU61
+	.loc 1 33 9 view .LVU62
+	.loc 1 33 13 is_stmt 0 view .LVU63
+	movq	%rdi, %rax
+	xorl	%edx, %edx
+	divq	%rsi
+.LVL27:
+	.loc 1 33 13 view .LVU64
+	movq	%rdx, %rdi
+	movq	%rax, %rsi
+	.loc 1 34 9 is_stmt 1 view .LVU65
+	.loc 1 34 11 is_stmt 0 view .LVU66
+	xorl	%edx, %edx
+.LVL28:
+	.loc 1 34 11 view .LVU67
+	movl	%ecx, %eax
+	divl	%r8d
+.LVL29:
+	.loc 1 35 9 is_stmt 1 view .LVU68
+	.loc 1 35 12 is_stmt 0 view .LVU69
+	testl	%r10d, %r10d
+	jne	.L16
+	testl	%esi, %esi
+	jg	.L16
+	.loc 1 35 26 discriminator 1 view .LVU70
+	cmpl	%r8d, %ecx
+	jnb	.L22
+	.loc 1 36 25 view .LVU71
+	addl	$48, %esi
+	.loc 1 36 16 view .LVU72
+	leaq	1(%r9), %rbx
+.LVL30:
+	.loc 1 36 25 view .LVU73
+	movb	%sil, (%r9)
+	.loc 1 37 13 is_stmt 1 view .LVU74
+.LVL31:
+	.loc 1 37 13 is_stmt 0 view .LVU75
+.LBE10:
+	.loc 1 31 14 is_stmt 1 view .LVU76
+.L15:
+	.loc 1 40 5 view .LVU77
+	.loc 1 40 9 is_stmt 0 view .LVU78
+	movb	$0, (%rbx)
+	.loc 1 41 1 view .LVU79
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL32:
+	.loc 1 41 1 view .LVU80
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+.LBB11:
+	.loc 1 36 13 is_stmt 1 view .LVU81
+	.loc 1 36 25 is_stmt 0 view .LVU82
+	cmpl	$9, %esi
+	jle	.L23
+	.loc 1 36 25 discriminator 1 view .LVU83
+	cmpl	$1, %r11d
+	sbbl	%edx, %edx
+	andl	$32, %edx
+	addl	$55, %edx
+.L18:
+	.loc 1 36 25 discriminator 8 view .LVU84
+	addl	%esi, %edx
+	.loc 1 36 16 discriminator 8 view .LVU85
+	leaq	1(%r9), %rbx
+.LVL34:
+	.loc 1 37 13 discriminator 8 view .LVU86
+	addl	$1, %r10d
+.LVL35:
+	.loc 1 36 25 discriminator 8 view .LVU87
+	movb	%dl, (%r9)
+	.loc 1 37 13 is_stmt 1 discriminator 8 view .LVU88
+.LVL36:
+	.loc 1 37 13 is_stmt 0 discriminator 8 view .LVU89
+.LBE11:
+	.loc 1 31 14 is_stmt 1 discriminator 8 view .LVU90
+	cmpl	%r8d, %ecx
+	jb	.L15
+.LBB12:
+	.loc 1 36 16 is_stmt 0 view .LVU91
+	movq	%rbx, %r9
+.LVL37:
+.L17:
+	.loc 1 36 16 view .LVU92
+.LBE12:
+	.loc 1 28 18 view .LVU93
+	movl	%eax, %esi
+	movq	%rsi, %rcx
+	jmp	.L19
+	.p2align 4,,10
+	.p2align 3
+.L22:
+.LBB13:
+	.loc 1 28 18 view .LVU94
+	xorl	%r10d, %r10d
+.LVL38:
+	.loc 1 28 18 view .LVU95
+	jmp	.L17
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 28 18 view .LVU96
+.LBE13:
+	.loc 1 31 14 view .LVU97
+	movq	%r9, %rbx
+	.loc 1 40 5 is_stmt 1 view .LVU98
+	.loc 1 40 9 is_stmt 0 view .LVU99
+	movb	$0, (%rbx)
+	.loc 1 41 1 view .LVU100
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.cfi_restore_state
+	.loc 1 41 1 view .LVU101
+	movl	$1, %esi
+.LVL41:
+	.loc 1 41 1 view .LVU102
+	jmp	.L13
+.LVL42:
+.L23:
+.LBB14:
+	.loc 1 36 25 view .LVU103
+	movl	$48, %edx
+	jmp	.L18
+.LBE14:
+	.cfi_endproc
+.LFE0:
+	.size	uli2a, .-uli2a
+	.section	.text.li2a,"ax",@progbits
+	.p2align 4
+	.globl	li2a
+	.type	li2a, @function
+li2a:
+.LVL43:
+.LFB1:
+	.loc 1 44 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 45 5 view .LVU105
+	.loc 1 44 1 is_stmt 0 view .LVU106
+	movq	%rsi, %rcx
+	.loc 1 45 8 view .LVU107
+	testq	%rdi, %rdi
+	jns	.L29
+	.loc 1 46 9 is_stmt 1 view .LVU108
+	.loc 1 47 15 is_stmt 0 view .LVU109
+	movb	$45, (%rsi)
+	.loc 1 46 13 view .LVU110
+	negq	%rdi
+.LVL44:
+	.loc 1 47 9 is_stmt 1 view .LVU111
+	.loc 1 47 12 is_stmt 0 view .LVU112
+	addq	$1, %rcx
+.LVL45:
+.L29:
+	.loc 1 49 5 is_stmt 1 view .LVU113
+	xorl	%edx, %edx
+	movl	$10, %esi
+	jmp	uli2a
+.LVL46:
+	.loc 1 49 5 is_stmt 0 view .LVU114
+	.cfi_endproc
+.LFE1:
+	.size	li2a, .-li2a
+	.section	.text.ui2a,"ax",@progbits
+	.p2align 4
+	.globl	ui2a
+	.type	ui2a, @function
+ui2a:
+.LVL47:
+.LFB2:
+	.loc 1 55 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 56 5 view .LVU116
+	.loc 1 57 5 view .LVU117
+	.loc 1 58 5 view .LVU118
+	.loc 1 58 20 view .LVU119
+	.loc 1 55 1 is_stmt 0 view .LVU120
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 55 1 view .LVU121
+	movq	%rcx, %r9
+	movl	%edx, %ebx
+	.loc 1 57 18 view .LVU122
+	movl	$1, %ecx
+.LVL48:
+	.loc 1 58 20 view .LVU123
+	cmpl	%esi, %edi
+	jb	.L31
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 59 9 is_stmt 1 view .LVU124
+	.loc 1 59 11 is_stmt 0 view .LVU125
+	imull	%esi, %ecx
+.LVL50:
+	.loc 1 58 20 is_stmt 1 view .LVU126
+	.loc 1 58 16 is_stmt 0 view .LVU127
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%ecx
+	.loc 1 58 20 view .LVU128
+	cmpl	%esi, %eax
+	jnb	.L32
+	.loc 1 60 14 is_stmt 1 view .LVU129
+	testl	%ecx, %ecx
+	je	.L45
+.LVL51:
+.L31:
+	.loc 1 56 9 is_stmt 0 view .LVU130
+	xorl	%r10d, %r10d
+	.p2align 4,,10
+	.p2align 3
+.L37:
+.LVL52:
+.LBB15:
+	.loc 1 61 9 is_stmt 1 view .LVU131
+	.loc 1 62 9 view .LVU132
+	.loc 1 62 13 is_stmt 0 view .LVU133
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%ecx
+.LVL53:
+	.loc 1 62 13 view .LVU134
+	movl	%edx, %edi
+	movl	%eax, %r8d
+	.loc 1 63 9 is_stmt 1 view .LVU135
+	.loc 1 63 11 is_stmt 0 view .LVU136
+	xorl	%edx, %edx
+.LVL54:
+	.loc 1 63 11 view .LVU137
+	movl	%ecx, %eax
+	divl	%esi
+.LVL55:
+	.loc 1 64 9 is_stmt 1 view .LVU138
+	.loc 1 64 12 is_stmt 0 view .LVU139
+	testl	%r10d, %r10d
+	jne	.L34
+	testl	%r8d, %r8d
+	jg	.L34
+	.loc 1 64 26 discriminator 1 view .LVU140
+	cmpl	%esi, %ecx
+	jnb	.L40
+	.loc 1 65 25 view .LVU141
+	addl	$48, %r8d
+	.loc 1 65 16 view .LVU142
+	leaq	1(%r9), %r11
+.LVL56:
+	.loc 1 65 25 view .LVU143
+	movb	%r8b, (%r9)
+	.loc 1 66 13 is_stmt 1 view .LVU144
+.LVL57:
+	.loc 1 66 13 is_stmt 0 view .LVU145
+.LBE15:
+	.loc 1 60 14 is_stmt 1 view .LVU146
+.L33:
+	.loc 1 69 5 view .LVU147
+	.loc 1 69 9 is_stmt 0 view .LVU148
+	movb	$0, (%r11)
+	.loc 1 70 1 view .LVU149
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL58:
+	.loc 1 70 1 view .LVU150
+	ret
+.LVL59:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.cfi_restore_state
+.LBB16:
+	.loc 1 65 13 is_stmt 1 view .LVU151
+	.loc 1 65 25 is_stmt 0 view .LVU152
+	cmpl	$9, %r8d
+	jle	.L41
+	.loc 1 65 25 discriminator 1 view .LVU153
+	cmpl	$1, %ebx
+	sbbl	%edx, %edx
+	andl	$32, %edx
+	addl	$55, %edx
+.L36:
+	.loc 1 65 25 discriminator 8 view .LVU154
+	addl	%r8d, %edx
+	.loc 1 65 16 discriminator 8 view .LVU155
+	leaq	1(%r9), %r11
+.LVL60:
+	.loc 1 66 13 discriminator 8 view .LVU156
+	addl	$1, %r10d
+.LVL61:
+	.loc 1 65 25 discriminator 8 view .LVU157
+	movb	%dl, (%r9)
+	.loc 1 66 13 is_stmt 1 discriminator 8 view .LVU158
+.LVL62:
+	.loc 1 66 13 is_stmt 0 discriminator 8 view .LVU159
+.LBE16:
+	.loc 1 60 14 is_stmt 1 discriminator 8 view .LVU160
+	cmpl	%esi, %ecx
+	jb	.L33
+.LBB17:
+	.loc 1 65 16 is_stmt 0 view .LVU161
+	movq	%r11, %r9
+	.loc 1 65 16 view .LVU162
+.LBE17:
+	.loc 1 57 18 view .LVU163
+	movl	%eax, %ecx
+	jmp	.L37
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+.LBB18:
+	.loc 1 57 18 view .LVU164
+	xorl	%r10d, %r10d
+.LVL64:
+	.loc 1 57 18 view .LVU165
+.LBE18:
+	movl	%eax, %ecx
+	jmp	.L37
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 60 14 view .LVU166
+	movq	%r9, %r11
+	.loc 1 69 5 is_stmt 1 view .LVU167
+	.loc 1 69 9 is_stmt 0 view .LVU168
+	movb	$0, (%r11)
+	.loc 1 70 1 view .LVU169
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL66:
+	.loc 1 70 1 view .LVU170
+	ret
+.LVL67:
+.L41:
+	.cfi_restore_state
+.LBB19:
+	.loc 1 65 25 view .LVU171
+	movl	$48, %edx
+	jmp	.L36
+.LBE19:
+	.cfi_endproc
+.LFE2:
+	.size	ui2a, .-ui2a
+	.section	.text.i2a,"ax",@progbits
+	.p2align 4
+	.globl	i2a
+	.type	i2a, @function
+i2a:
+.LVL68:
+.LFB3:
+	.loc 1 73 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 74 5 view .LVU173
+	.loc 1 73 1 is_stmt 0 view .LVU174
+	movq	%rsi, %rcx
+	.loc 1 74 8 view .LVU175
+	testl	%edi, %edi
+	jns	.L47
+	.loc 1 75 9 is_stmt 1 view .LVU176
+	.loc 1 76 15 is_stmt 0 view .LVU177
+	movb	$45, (%rsi)
+	.loc 1 75 13 view .LVU178
+	negl	%edi
+.LVL69:
+	.loc 1 76 9 is_stmt 1 view .LVU179
+	.loc 1 76 12 is_stmt 0 view .LVU180
+	addq	$1, %rcx
+.LVL70:
+.L47:
+	.loc 1 78 5 is_stmt 1 view .LVU181
+	xorl	%edx, %edx
+	movl	$10, %esi
+	jmp	ui2a
+.LVL71:
+	.loc 1 78 5 is_stmt 0 view .LVU182
+	.cfi_endproc
+.LFE3:
+	.size	i2a, .-i2a
+	.section	.text.a2d,"ax",@progbits
+	.p2align 4
+	.globl	a2d
+	.type	a2d, @function
+a2d:
+.LVL72:
+.LFB4:
+	.loc 1 82 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 83 5 view .LVU184
+	.loc 1 83 19 is_stmt 0 view .LVU185
+	leal	-48(%rdi), %eax
+	.loc 1 83 8 view .LVU186
+	cmpb	$9, %al
+	jbe	.L53
+	.loc 1 85 10 is_stmt 1 view .LVU187
+	.loc 1 85 24 is_stmt 0 view .LVU188
+	leal	-97(%rdi), %eax
+	.loc 1 85 13 view .LVU189
+	cmpb	$5, %al
+	jbe	.L54
+	.loc 1 87 10 is_stmt 1 view .LVU190
+	.loc 1 87 24 is_stmt 0 view .LVU191
+	leal	-65(%rdi), %eax
+	.loc 1 87 13 view .LVU192
+	cmpb	$5, %al
+	ja	.L52
+	.loc 1 88 9 is_stmt 1 view .LVU193
+	.loc 1 88 25 is_stmt 0 view .LVU194
+	subl	$55, %edi
+.LVL73:
+	.loc 1 88 25 view .LVU195
+	movsbl	%dil, %eax
+	ret
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 86 9 is_stmt 1 view .LVU196
+	.loc 1 86 25 is_stmt 0 view .LVU197
+	subl	$87, %edi
+.LVL75:
+	.loc 1 86 25 view .LVU198
+	movsbl	%dil, %eax
+	ret
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 84 9 is_stmt 1 view .LVU199
+	.loc 1 84 19 is_stmt 0 view .LVU200
+	movsbl	%al, %eax
+	ret
+.L52:
+	.loc 1 90 16 view .LVU201
+	movl	$-1, %eax
+	.loc 1 91 1 view .LVU202
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	a2d, .-a2d
+	.section	.text.a2i,"ax",@progbits
+	.p2align 4
+	.globl	a2i
+	.type	a2i, @function
+a2i:
+.LVL77:
+.LFB5:
+	.loc 1 94 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 95 5 view .LVU204
+	.loc 1 98 11 is_stmt 0 view .LVU205
+	movl	%edi, %eax
+	.loc 1 95 11 view .LVU206
+	movq	(%rsi), %r8
+.LVL78:
+	.loc 1 96 5 is_stmt 1 view .LVU207
+	.loc 1 97 5 view .LVU208
+	.loc 1 98 5 view .LVU209
+	.loc 1 94 1 is_stmt 0 view .LVU210
+	movq	%rsi, %r10
+	.loc 1 96 9 view .LVU211
+	xorl	%edi, %edi
+.LVL79:
+	.loc 1 98 11 view .LVU212
+	jmp	.L56
+.LVL80:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+.LBB22:
+.LBB23:
+	.loc 1 85 10 is_stmt 1 view .LVU213
+	.loc 1 85 24 is_stmt 0 view .LVU214
+	leal	-97(%rax), %r9d
+	.loc 1 85 13 view .LVU215
+	cmpb	$5, %r9b
+	jbe	.L64
+	.loc 1 87 10 is_stmt 1 view .LVU216
+	.loc 1 87 24 is_stmt 0 view .LVU217
+	leal	-65(%rax), %r9d
+	.loc 1 87 13 view .LVU218
+	cmpb	$5, %r9b
+	ja	.L62
+	.loc 1 88 9 is_stmt 1 view .LVU219
+	.loc 1 88 25 is_stmt 0 view .LVU220
+	subl	$55, %esi
+.L61:
+.LVL81:
+	.loc 1 88 25 view .LVU221
+.LBE23:
+.LBE22:
+	.loc 1 98 30 view .LVU222
+	testl	%esi, %esi
+	js	.L62
+	.loc 1 99 9 is_stmt 1 view .LVU223
+	.loc 1 99 12 is_stmt 0 view .LVU224
+	cmpl	%esi, %edx
+	jl	.L62
+.L65:
+	.loc 1 101 9 is_stmt 1 view .LVU225
+	.loc 1 101 19 is_stmt 0 view .LVU226
+	imull	%edx, %edi
+.LVL82:
+	.loc 1 102 12 view .LVU227
+	movzbl	(%r8), %eax
+.LVL83:
+	.loc 1 102 16 view .LVU228
+	addq	$1, %r8
+.LVL84:
+	.loc 1 101 13 view .LVU229
+	addl	%esi, %edi
+.LVL85:
+	.loc 1 102 9 is_stmt 1 view .LVU230
+.L56:
+	.loc 1 98 30 view .LVU231
+.LBB27:
+.LBB24:
+	.loc 1 83 19 is_stmt 0 view .LVU232
+	leal	-48(%rax), %r9d
+.LBE24:
+.LBE27:
+	.loc 1 98 21 view .LVU233
+	movsbl	%al, %esi
+.LVL86:
+.LBB28:
+.LBI22:
+	.loc 1 81 5 is_stmt 1 view .LVU234
+.LBB25:
+	.loc 1 83 5 view .LVU235
+	.loc 1 83 8 is_stmt 0 view .LVU236
+	cmpb	$9, %r9b
+	ja	.L58
+	.loc 1 84 9 is_stmt 1 view .LVU237
+	.loc 1 84 19 is_stmt 0 view .LVU238
+	subl	$48, %esi
+.LVL87:
+	.loc 1 84 19 view .LVU239
+.LBE25:
+.LBE28:
+	.loc 1 99 9 is_stmt 1 view .LVU240
+	.loc 1 99 12 is_stmt 0 view .LVU241
+	cmpl	%esi, %edx
+	jge	.L65
+.LVL88:
+.L62:
+	.loc 1 104 5 is_stmt 1 view .LVU242
+	.loc 1 104 10 is_stmt 0 view .LVU243
+	movq	%r8, (%r10)
+	.loc 1 105 5 is_stmt 1 view .LVU244
+	.loc 1 105 11 is_stmt 0 view .LVU245
+	movl	%edi, (%rcx)
+	.loc 1 106 5 is_stmt 1 view .LVU246
+	.loc 1 107 1 is_stmt 0 view .LVU247
+	ret
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+.LBB29:
+.LBB26:
+	.loc 1 86 9 is_stmt 1 view .LVU248
+	.loc 1 86 25 is_stmt 0 view .LVU249
+	subl	$87, %esi
+	jmp	.L61
+.LBE26:
+.LBE29:
+	.cfi_endproc
+.LFE5:
+	.size	a2i, .-a2i
+	.section	.text.itoa,"ax",@progbits
+	.p2align 4
+	.globl	itoa
+	.type	itoa, @function
+itoa:
+.LVL90:
+.LFB7:
+	.loc 1 134 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 135 5 view .LVU251
+	.loc 1 134 1 is_stmt 0 view .LVU252
+	movl	%edx, %r8d
+	.loc 1 135 20 view .LVU253
+	subl	$2, %edx
+.LVL91:
+	.loc 1 134 1 view .LVU254
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 134 1 view .LVU255
+	movl	%edi, %r9d
+	.loc 1 135 8 view .LVU256
+	cmpl	$35, %edx
+	movl	$10, %edx
+	.loc 1 134 1 view .LVU257
+	movq	%rsi, %r10
+	.loc 1 135 8 view .LVU258
+	cmovnb	%edx, %r8d
+.LVL92:
+	.loc 1 137 5 is_stmt 1 view .LVU259
+	.loc 1 137 8 is_stmt 0 view .LVU260
+	testl	%edi, %edi
+	js	.L80
+	.loc 1 141 9 is_stmt 1 view .LVU261
+.LVL93:
+.LBB40:
+.LBI40:
+	.loc 1 125 14 view .LVU262
+.LBB41:
+	.loc 1 127 5 view .LVU263
+	movq	%rsi, %rcx
+	leaq	.LC0(%rip), %rsi
+.LVL94:
+	.loc 1 127 8 is_stmt 0 view .LVU264
+	cmpl	%r8d, %edi
+	jnb	.L81
+.LVL95:
+.L72:
+	.loc 1 129 5 is_stmt 1 view .LVU265
+	.loc 1 129 48 is_stmt 0 view .LVU266
+	movl	%r9d, %eax
+	xorl	%edx, %edx
+.LBE41:
+.LBE40:
+	.loc 1 141 27 view .LVU267
+	movb	$0, 1(%rcx)
+.LBB48:
+.LBB46:
+	.loc 1 129 48 view .LVU268
+	divl	%r8d
+	.loc 1 129 8 view .LVU269
+	movzbl	(%rsi,%rdx), %eax
+	movb	%al, (%rcx)
+	.loc 1 130 5 is_stmt 1 view .LVU270
+.LVL96:
+	.loc 1 130 5 is_stmt 0 view .LVU271
+.LBE46:
+.LBE48:
+	.loc 1 142 5 is_stmt 1 view .LVU272
+	.loc 1 143 1 is_stmt 0 view .LVU273
+	movq	%r10, %rax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL97:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	.loc 1 138 9 is_stmt 1 view .LVU274
+	.loc 1 139 10 is_stmt 0 view .LVU275
+	negl	%r9d
+	.loc 1 138 12 view .LVU276
+	movb	$45, (%rsi)
+	.loc 1 139 9 is_stmt 1 view .LVU277
+.LVL98:
+	.loc 1 139 10 is_stmt 0 view .LVU278
+	leaq	1(%rsi), %rcx
+.LVL99:
+.LBB49:
+.LBI49:
+	.loc 1 125 14 is_stmt 1 view .LVU279
+.LBB50:
+	.loc 1 127 5 view .LVU280
+	leaq	.LC0(%rip), %rsi
+.LVL100:
+	.loc 1 127 8 is_stmt 0 view .LVU281
+	cmpl	%r8d, %r9d
+	jb	.L72
+	.loc 1 128 9 is_stmt 1 view .LVU282
+	.loc 1 128 13 is_stmt 0 view .LVU283
+	movl	%r9d, %eax
+	xorl	%edx, %edx
+	divl	%r8d
+	movl	%eax, %r11d
+.LVL101:
+.LBB51:
+.LBI51:
+	.loc 1 125 14 is_stmt 1 view .LVU284
+.LBB52:
+	.loc 1 127 5 view .LVU285
+	.loc 1 127 8 is_stmt 0 view .LVU286
+	cmpl	%r8d, %eax
+	jnb	.L82
+.LVL102:
+.L70:
+	.loc 1 129 5 is_stmt 1 view .LVU287
+	.loc 1 129 48 is_stmt 0 view .LVU288
+	leaq	.LC0(%rip), %rsi
+	jmp	.L73
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.loc 1 129 48 view .LVU289
+.LBE52:
+.LBE51:
+.LBE50:
+.LBE49:
+.LBB56:
+.LBB47:
+	.loc 1 128 9 is_stmt 1 view .LVU290
+	.loc 1 128 13 is_stmt 0 view .LVU291
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%r8d
+	movl	%eax, %r11d
+.LVL104:
+.LBB42:
+.LBI42:
+	.loc 1 125 14 is_stmt 1 view .LVU292
+.LBB43:
+	.loc 1 127 5 view .LVU293
+	.loc 1 127 8 is_stmt 0 view .LVU294
+	cmpl	%r8d, %eax
+	jnb	.L83
+.LVL105:
+.L73:
+	.loc 1 129 5 is_stmt 1 view .LVU295
+	.loc 1 129 48 is_stmt 0 view .LVU296
+	movl	%r11d, %eax
+	xorl	%edx, %edx
+	.loc 1 130 14 view .LVU297
+	addq	$1, %rcx
+.LVL106:
+	.loc 1 129 48 view .LVU298
+	divl	%r8d
+	.loc 1 129 8 view .LVU299
+	movzbl	(%rsi,%rdx), %eax
+	movb	%al, -1(%rcx)
+	.loc 1 130 5 is_stmt 1 view .LVU300
+.LVL107:
+	.loc 1 130 5 is_stmt 0 view .LVU301
+	jmp	.L72
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.loc 1 128 9 is_stmt 1 view .LVU302
+	.loc 1 128 13 is_stmt 0 view .LVU303
+	xorl	%edx, %edx
+	divl	%r8d
+.LVL109:
+	.loc 1 128 13 view .LVU304
+	movl	%eax, %ebx
+.LVL110:
+.LBB44:
+.LBI44:
+	.loc 1 125 14 is_stmt 1 view .LVU305
+.LBB45:
+	.loc 1 127 5 view .LVU306
+	.loc 1 127 8 is_stmt 0 view .LVU307
+	cmpl	%r8d, %eax
+	jnb	.L84
+.LVL111:
+.L74:
+	.loc 1 129 5 is_stmt 1 view .LVU308
+	.loc 1 129 48 is_stmt 0 view .LVU309
+	movl	%ebx, %eax
+	xorl	%edx, %edx
+	leaq	.LC0(%rip), %rsi
+	.loc 1 130 14 view .LVU310
+	addq	$1, %rcx
+.LVL112:
+	.loc 1 129 48 view .LVU311
+	divl	%r8d
+	.loc 1 129 8 view .LVU312
+	movzbl	(%rsi,%rdx), %eax
+	movb	%al, -1(%rcx)
+	.loc 1 130 5 is_stmt 1 view .LVU313
+.LVL113:
+	.loc 1 130 5 is_stmt 0 view .LVU314
+	jmp	.L73
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.loc 1 128 9 is_stmt 1 view .LVU315
+	.loc 1 128 13 is_stmt 0 view .LVU316
+	xorl	%edx, %edx
+	movq	%r10, %rsi
+	divl	%r8d
+.LVL115:
+	.loc 1 128 13 view .LVU317
+	movl	%r8d, %edx
+	movl	%eax, %edi
+.LVL116:
+	.loc 1 128 13 view .LVU318
+	call	_i2a
+.LVL117:
+	.loc 1 128 13 view .LVU319
+	movq	%rax, %rcx
+.LVL118:
+	.loc 1 128 13 view .LVU320
+	jmp	.L74
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	.loc 1 128 13 view .LVU321
+.LBE45:
+.LBE44:
+.LBE43:
+.LBE42:
+.LBE47:
+.LBE56:
+.LBB57:
+.LBB55:
+.LBB54:
+.LBB53:
+	.loc 1 128 9 is_stmt 1 view .LVU322
+	.loc 1 128 13 is_stmt 0 view .LVU323
+	xorl	%edx, %edx
+	movq	%rcx, %rsi
+	divl	%r8d
+.LVL120:
+	.loc 1 128 13 view .LVU324
+	movl	%r8d, %edx
+	movl	%eax, %edi
+.LVL121:
+	.loc 1 128 13 view .LVU325
+	call	_i2a
+.LVL122:
+	.loc 1 128 13 view .LVU326
+	movq	%rax, %rcx
+.LVL123:
+	.loc 1 128 13 view .LVU327
+	jmp	.L70
+.LBE53:
+.LBE54:
+.LBE55:
+.LBE57:
+	.cfi_endproc
+.LFE7:
+	.size	itoa, .-itoa
+	.section	.text.ftoa,"ax",@progbits
+	.p2align 4
+	.globl	ftoa
+	.type	ftoa, @function
+ftoa:
+.LVL124:
+.LFB8:
+	.loc 1 148 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 149 5 view .LVU329
+	.loc 1 150 5 view .LVU330
+	.loc 1 151 5 view .LVU331
+	.loc 1 148 1 is_stmt 0 view .LVU332
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 155 8 view .LVU333
+	pxor	%xmm1, %xmm1
+	.loc 1 148 1 view .LVU334
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 155 8 view .LVU335
+	comiss	%xmm1, %xmm0
+	.loc 1 151 10 view .LVU336
+	movq	$0, 8(%rsp)
+	movl	$0, 16(%rsp)
+	.loc 1 152 5 is_stmt 1 view .LVU337
+.LVL125:
+	.loc 1 153 5 view .LVU338
+	.loc 1 155 5 view .LVU339
+	.loc 1 155 8 is_stmt 0 view .LVU340
+	jbe	.L100
+	.loc 1 156 9 is_stmt 1 view .LVU341
+	.loc 1 156 11 is_stmt 0 view .LVU342
+	addss	.LC2(%rip), %xmm0
+.LVL126:
+.L88:
+	.loc 1 160 5 is_stmt 1 view .LVU343
+	.loc 1 160 25 is_stmt 0 view .LVU344
+	mulss	.LC3(%rip), %xmm0
+.LVL127:
+	.loc 1 160 11 view .LVU345
+	cvttss2sil	%xmm0, %r8d
+.LVL128:
+	.loc 1 162 5 is_stmt 1 view .LVU346
+	movl	%r8d, %r9d
+	negl	%r9d
+	cmovs	%r8d, %r9d
+.LVL129:
+.LBB64:
+.LBI64:
+	.loc 1 133 7 view .LVU347
+.LBB65:
+	.loc 1 135 5 view .LVU348
+	.loc 1 137 5 view .LVU349
+	.loc 1 141 9 view .LVU350
+.LBB66:
+.LBI66:
+	.loc 1 125 14 view .LVU351
+.LBB67:
+	.loc 1 127 5 view .LVU352
+	.loc 1 127 8 is_stmt 0 view .LVU353
+	cmpl	$9, %r9d
+	jg	.L102
+	leaq	20(%rsp), %rbp
+.LVL130:
+	.loc 1 127 8 view .LVU354
+	movl	%r9d, %r10d
+	leaq	.LC0(%rip), %rcx
+	movq	%rbp, %rdx
+.LVL131:
+.L89:
+	.loc 1 129 5 is_stmt 1 view .LVU355
+	.loc 1 129 51 is_stmt 0 view .LVU356
+	movl	$3435973837, %eax
+.LBE67:
+.LBE66:
+	.loc 1 141 27 view .LVU357
+	movb	$0, 1(%rdx)
+.LBE65:
+.LBE64:
+	.loc 1 169 9 view .LVU358
+	movq	%rbp, %rdi
+.LBB85:
+.LBB82:
+.LBB79:
+.LBB76:
+	.loc 1 129 51 view .LVU359
+	imulq	%r10, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	.loc 1 129 48 view .LVU360
+	subl	%eax, %r9d
+.LVL132:
+	.loc 1 129 8 view .LVU361
+	movzbl	(%rcx,%r9), %eax
+	movb	%al, (%rdx)
+	.loc 1 130 5 is_stmt 1 view .LVU362
+.LVL133:
+	.loc 1 130 5 is_stmt 0 view .LVU363
+.LBE76:
+.LBE79:
+	.loc 1 142 5 is_stmt 1 view .LVU364
+	.loc 1 142 5 is_stmt 0 view .LVU365
+.LBE82:
+.LBE85:
+	.loc 1 164 5 is_stmt 1 view .LVU366
+	.loc 1 165 23 is_stmt 0 view .LVU367
+	movl	%r8d, %eax
+	sarl	$31, %eax
+	andl	$13, %eax
+	addl	$32, %eax
+	movb	%al, 8(%rsp)
+	.loc 1 169 5 is_stmt 1 view .LVU368
+	.loc 1 169 9 is_stmt 0 view .LVU369
+	call	strlen@PLT
+.LVL134:
+	.loc 1 169 8 view .LVU370
+	cmpq	$1, %rax
+	je	.L103
+	.loc 1 174 12 is_stmt 1 view .LVU371
+	.loc 1 174 15 is_stmt 0 view .LVU372
+	cmpq	$2, %rax
+	je	.L104
+	.loc 1 178 12 is_stmt 1 view .LVU373
+	.loc 1 178 15 is_stmt 0 view .LVU374
+	cmpq	$3, %rax
+	je	.L105
+	.loc 1 182 9 is_stmt 1 view .LVU375
+	leaq	8(%rsp), %r12
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	strcat@PLT
+.LVL135:
+.L93:
+	.loc 1 185 5 view .LVU376
+	.loc 1 185 18 is_stmt 0 view .LVU377
+	movq	%r12, %rdi
+	call	strlen@PLT
+.LVL136:
+	.loc 1 187 5 is_stmt 1 view .LVU378
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	.loc 1 185 16 is_stmt 0 view .LVU379
+	leal	-3(%rax), %ebp
+	.loc 1 187 5 view .LVU380
+	movzbl	%bpl, %ebp
+	movq	%rbp, %rdx
+	call	strncpy@PLT
+.LVL137:
+	.loc 1 188 5 is_stmt 1 view .LVU381
+	.loc 1 188 29 is_stmt 0 view .LVU382
+	movb	$0, (%rbx,%rbp)
+	.loc 1 189 5 is_stmt 1 view .LVU383
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL138:
+	.loc 1 190 5 is_stmt 0 view .LVU384
+	leaq	(%r12,%rbp), %rsi
+	.loc 1 189 5 view .LVU385
+	movb	$46, (%rbx,%rax)
+	.loc 1 190 5 is_stmt 1 view .LVU386
+	leaq	1(%rbx,%rax), %rdi
+	call	strcpy@PLT
+.LVL139:
+	.loc 1 192 5 view .LVU387
+	.loc 1 193 1 is_stmt 0 view .LVU388
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL140:
+	.loc 1 193 1 view .LVU389
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L105:
+	.cfi_restore_state
+	.loc 1 179 9 is_stmt 1 view .LVU390
+	.loc 1 180 9 is_stmt 0 view .LVU391
+	leaq	8(%rsp), %r12
+	movq	%rbp, %rsi
+	.loc 1 179 23 view .LVU392
+	movb	$48, 9(%rsp)
+	.loc 1 180 9 is_stmt 1 view .LVU393
+	movq	%r12, %rdi
+	call	strcat@PLT
+.LVL142:
+	jmp	.L93
+.LVL143:
+	.p2align 4,,10
+	.p2align 3
+.L100:
+	.loc 1 158 9 view .LVU394
+	.loc 1 158 11 is_stmt 0 view .LVU395
+	subss	.LC2(%rip), %xmm0
+.LVL144:
+	.loc 1 158 11 view .LVU396
+	jmp	.L88
+.LVL145:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+.LBB86:
+.LBB83:
+.LBB80:
+.LBB77:
+	.loc 1 128 9 is_stmt 1 view .LVU397
+	.loc 1 128 13 is_stmt 0 view .LVU398
+	movl	%r9d, %r10d
+	movl	$3435973837, %edi
+.LBB68:
+.LBB69:
+	leaq	20(%rsp), %rbp
+.LVL146:
+	.loc 1 128 13 view .LVU399
+.LBE69:
+.LBE68:
+	movq	%r10, %r12
+.LBB73:
+.LBB70:
+	movq	%rbp, %rdx
+.LBE70:
+.LBE73:
+	imulq	%rdi, %r12
+	shrq	$35, %r12
+.LVL147:
+.LBB74:
+.LBI68:
+	.loc 1 125 14 is_stmt 1 view .LVU400
+.LBB71:
+	.loc 1 127 5 view .LVU401
+	movl	%r12d, %r11d
+	.loc 1 127 8 is_stmt 0 view .LVU402
+	cmpl	$99, %r9d
+	jg	.L106
+.LVL148:
+.L90:
+	.loc 1 129 5 is_stmt 1 view .LVU403
+	.loc 1 129 51 is_stmt 0 view .LVU404
+	movl	$3435973837, %eax
+	.loc 1 129 48 view .LVU405
+	leaq	.LC0(%rip), %rcx
+	.loc 1 130 14 view .LVU406
+	addq	$1, %rdx
+.LVL149:
+	.loc 1 129 51 view .LVU407
+	imulq	%r11, %rax
+	shrq	$35, %rax
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+	.loc 1 129 48 view .LVU408
+	subl	%eax, %r12d
+.LVL150:
+	.loc 1 129 8 view .LVU409
+	movzbl	(%rcx,%r12), %eax
+	movb	%al, -1(%rdx)
+	.loc 1 130 5 is_stmt 1 view .LVU410
+.LVL151:
+	.loc 1 130 5 is_stmt 0 view .LVU411
+	jmp	.L89
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 130 5 view .LVU412
+.LBE71:
+.LBE74:
+.LBE77:
+.LBE80:
+.LBE83:
+.LBE86:
+	.loc 1 170 9 is_stmt 1 view .LVU413
+	.loc 1 171 9 view .LVU414
+	.loc 1 173 9 is_stmt 0 view .LVU415
+	leaq	8(%rsp), %r12
+	.loc 1 170 23 view .LVU416
+	movzwl	.LC4(%rip), %eax
+	.loc 1 173 9 view .LVU417
+	movq	%rbp, %rsi
+	.loc 1 172 23 view .LVU418
+	movb	$48, 11(%rsp)
+	.loc 1 173 9 view .LVU419
+	movq	%r12, %rdi
+	.loc 1 170 23 view .LVU420
+	movw	%ax, 9(%rsp)
+	.loc 1 172 9 is_stmt 1 view .LVU421
+	.loc 1 173 9 view .LVU422
+	call	strcat@PLT
+.LVL153:
+	jmp	.L93
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.loc 1 175 9 view .LVU423
+	.loc 1 176 9 view .LVU424
+	.loc 1 177 9 is_stmt 0 view .LVU425
+	leaq	8(%rsp), %r12
+	.loc 1 175 23 view .LVU426
+	movzwl	.LC4(%rip), %eax
+	.loc 1 177 9 view .LVU427
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	.loc 1 175 23 view .LVU428
+	movw	%ax, 9(%rsp)
+	.loc 1 177 9 is_stmt 1 view .LVU429
+	call	strcat@PLT
+.LVL154:
+	jmp	.L93
+.LVL155:
+	.p2align 4,,10
+	.p2align 3
+.L106:
+.LBB87:
+.LBB84:
+.LBB81:
+.LBB78:
+.LBB75:
+.LBB72:
+	.loc 1 128 9 view .LVU430
+	.loc 1 128 13 is_stmt 0 view .LVU431
+	imulq	%r11, %rdi
+	movl	$10, %edx
+.LVL156:
+	.loc 1 128 13 view .LVU432
+	movq	%rbp, %rsi
+	shrq	$35, %rdi
+	call	_i2a
+.LVL157:
+	movq	%rax, %rdx
+.LVL158:
+	.loc 1 128 13 view .LVU433
+	jmp	.L90
+.LBE72:
+.LBE75:
+.LBE78:
+.LBE81:
+.LBE84:
+.LBE87:
+	.cfi_endproc
+.LFE8:
+	.size	ftoa, .-ftoa
+	.section	.text.fastA2F,"ax",@progbits
+	.p2align 4
+	.globl	fastA2F
+	.type	fastA2F, @function
+fastA2F:
+.LVL159:
+.LFB9:
+	.loc 1 207 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 208 5 view .LVU435
+	.loc 1 209 5 view .LVU436
+	.loc 1 212 5 view .LVU437
+	.loc 1 212 25 view .LVU438
+	.loc 1 212 14 is_stmt 0 view .LVU439
+	movzbl	(%rdi), %edx
+	.loc 1 207 1 view .LVU440
+	movq	%rdi, %rax
+	.loc 1 212 25 view .LVU441
+	cmpb	$32, %dl
+	jne	.L149
+.LVL160:
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	.loc 1 213 9 is_stmt 1 view .LVU442
+	.loc 1 212 14 is_stmt 0 view .LVU443
+	movzbl	1(%rax), %edx
+	.loc 1 213 11 view .LVU444
+	addq	$1, %rax
+.LVL161:
+	.loc 1 212 25 is_stmt 1 view .LVU445
+	cmpb	$32, %dl
+	je	.L146
+.L149:
+	.loc 1 212 25 is_stmt 0 view .LVU446
+	cmpb	$9, %dl
+	je	.L146
+	.loc 1 217 5 is_stmt 1 view .LVU447
+.LVL162:
+	.loc 1 218 5 view .LVU448
+	.loc 1 218 8 is_stmt 0 view .LVU449
+	cmpb	$45, %dl
+	je	.L150
+	.loc 1 222 12 is_stmt 1 view .LVU450
+	.loc 1 222 15 is_stmt 0 view .LVU451
+	cmpb	$43, %dl
+	.loc 1 217 10 view .LVU452
+	movss	.LC6(%rip), %xmm0
+	.loc 1 223 11 view .LVU453
+	sete	%dl
+	movzbl	%dl, %edx
+	addq	%rdx, %rax
+.LVL163:
+.L112:
+	.loc 1 227 5 is_stmt 1 view .LVU454
+	.loc 1 228 5 view .LVU455
+	.loc 1 228 25 view .LVU456
+	.loc 1 228 14 is_stmt 0 view .LVU457
+	movzbl	(%rax), %edx
+	.loc 1 227 11 view .LVU458
+	pxor	%xmm1, %xmm1
+	.loc 1 228 25 view .LVU459
+	leal	-48(%rdx), %ecx
+	cmpb	$9, %cl
+	ja	.L113
+	movss	.LC7(%rip), %xmm2
+.LVL164:
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	.loc 1 229 9 is_stmt 1 view .LVU460
+	.loc 1 229 23 is_stmt 0 view .LVU461
+	mulss	%xmm2, %xmm1
+.LVL165:
+	.loc 1 229 31 view .LVU462
+	subl	$48, %edx
+	pxor	%xmm3, %xmm3
+	.loc 1 230 11 view .LVU463
+	addq	$1, %rax
+.LVL166:
+	.loc 1 229 31 view .LVU464
+	movsbl	%dl, %edx
+	cvtsi2ssl	%edx, %xmm3
+	.loc 1 228 14 view .LVU465
+	movzbl	(%rax), %edx
+	.loc 1 228 25 view .LVU466
+	leal	-48(%rdx), %ecx
+	.loc 1 229 15 view .LVU467
+	addss	%xmm3, %xmm1
+.LVL167:
+	.loc 1 230 9 is_stmt 1 view .LVU468
+	.loc 1 228 25 view .LVU469
+	cmpb	$9, %cl
+	jbe	.L114
+.LVL168:
+.L113:
+	.loc 1 234 5 view .LVU470
+	.loc 1 234 8 is_stmt 0 view .LVU471
+	cmpb	$46, %dl
+	je	.L151
+	.loc 1 247 10 view .LVU472
+	movzbl	(%rax), %edx
+.L116:
+.LVL169:
+	.loc 1 246 5 is_stmt 1 view .LVU473
+	.loc 1 247 5 view .LVU474
+	.loc 1 247 21 is_stmt 0 view .LVU475
+	andl	$-33, %edx
+	.loc 1 247 8 view .LVU476
+	cmpb	$69, %dl
+	jne	.L129
+.LBB88:
+	.loc 1 248 9 is_stmt 1 view .LVU477
+	.loc 1 249 9 view .LVU478
+.LVL170:
+	.loc 1 252 9 view .LVU479
+	.loc 1 253 9 view .LVU480
+	.loc 1 253 13 is_stmt 0 view .LVU481
+	movsbl	1(%rax), %edx
+	.loc 1 253 12 view .LVU482
+	cmpb	$45, %dl
+	je	.L152
+	.loc 1 257 16 is_stmt 1 view .LVU483
+	.loc 1 257 19 is_stmt 0 view .LVU484
+	cmpb	$43, %dl
+	je	.L122
+	.loc 1 249 11 view .LVU485
+	leaq	1(%rax), %rsi
+.LVL171:
+	.loc 1 262 9 is_stmt 1 view .LVU486
+	.loc 1 263 9 view .LVU487
+	.loc 1 263 29 view .LVU488
+	leal	-48(%rdx), %eax
+	.loc 1 252 14 is_stmt 0 view .LVU489
+	xorl	%edi, %edi
+	.loc 1 263 29 view .LVU490
+	cmpb	$9, %al
+	ja	.L135
+.LVL172:
+.L120:
+	.loc 1 262 15 view .LVU491
+	xorl	%ecx, %ecx
+.LVL173:
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	.loc 1 264 13 is_stmt 1 view .LVU492
+	.loc 1 264 27 is_stmt 0 view .LVU493
+	leal	(%rcx,%rcx,4), %eax
+	.loc 1 265 15 view .LVU494
+	addq	$1, %rsi
+.LVL174:
+	.loc 1 264 19 view .LVU495
+	leal	-48(%rdx,%rax,2), %ecx
+.LVL175:
+	.loc 1 265 13 is_stmt 1 view .LVU496
+	.loc 1 263 29 view .LVU497
+	.loc 1 263 18 is_stmt 0 view .LVU498
+	movsbl	(%rsi), %edx
+	.loc 1 263 29 view .LVU499
+	leal	-48(%rdx), %eax
+	cmpb	$9, %al
+	jbe	.L124
+	.loc 1 267 9 is_stmt 1 view .LVU500
+	.loc 1 267 12 is_stmt 0 view .LVU501
+	movl	$308, %eax
+	cmpl	%eax, %ecx
+	cmovbe	%ecx, %eax
+.LVL176:
+	.loc 1 272 22 is_stmt 1 view .LVU502
+	cmpl	$7, %ecx
+	jbe	.L136
+	movss	.LC6(%rip), %xmm3
+	movss	.LC8(%rip), %xmm2
+	.loc 1 267 12 is_stmt 0 view .LVU503
+	movl	%eax, %edx
+.LVL177:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.loc 1 273 13 is_stmt 1 view .LVU504
+	.loc 1 273 19 is_stmt 0 view .LVU505
+	mulss	%xmm2, %xmm3
+.LVL178:
+	.loc 1 274 13 is_stmt 1 view .LVU506
+	.loc 1 274 19 is_stmt 0 view .LVU507
+	subl	$8, %edx
+.LVL179:
+	.loc 1 272 22 is_stmt 1 view .LVU508
+	cmpl	$7, %edx
+	ja	.L126
+	.loc 1 274 19 is_stmt 0 view .LVU509
+	andl	$7, %eax
+.LVL180:
+.L125:
+	.loc 1 276 22 is_stmt 1 view .LVU510
+	testl	%eax, %eax
+	je	.L127
+	movss	.LC7(%rip), %xmm2
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	.loc 1 277 13 view .LVU511
+	.loc 1 277 19 is_stmt 0 view .LVU512
+	mulss	%xmm2, %xmm3
+.LVL181:
+	.loc 1 278 13 is_stmt 1 view .LVU513
+	.loc 1 276 22 view .LVU514
+	subl	$1, %eax
+.LVL182:
+	.loc 1 276 22 is_stmt 0 view .LVU515
+	jne	.L128
+.L127:
+.LVL183:
+	.loc 1 276 22 view .LVU516
+.LBE88:
+	.loc 1 283 5 is_stmt 1 view .LVU517
+	.loc 1 283 43 is_stmt 0 view .LVU518
+	testl	%edi, %edi
+	je	.L123
+.LVL184:
+.L121:
+	.loc 1 283 43 discriminator 1 view .LVU519
+	divss	%xmm3, %xmm1
+.LVL185:
+.L129:
+	.loc 1 283 17 discriminator 4 view .LVU520
+	mulss	%xmm1, %xmm0
+.LVL186:
+	.loc 1 284 1 discriminator 4 view .LVU521
+	ret
+.LVL187:
+	.p2align 4,,10
+	.p2align 3
+.L151:
+.LBB89:
+	.loc 1 235 9 is_stmt 1 view .LVU522
+	.loc 1 236 9 view .LVU523
+	.loc 1 238 18 is_stmt 0 view .LVU524
+	movzbl	1(%rax), %edx
+	.loc 1 236 11 view .LVU525
+	leaq	1(%rax), %rcx
+.LVL188:
+	.loc 1 238 9 is_stmt 1 view .LVU526
+	.loc 1 238 29 view .LVU527
+	leal	-48(%rdx), %eax
+	cmpb	$9, %al
+	.loc 1 236 11 is_stmt 0 view .LVU528
+	movq	%rcx, %rax
+	.loc 1 238 29 view .LVU529
+	ja	.L116
+	.loc 1 235 15 view .LVU530
+	movss	.LC7(%rip), %xmm2
+	movaps	%xmm2, %xmm4
+.LVL189:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+	.loc 1 239 13 is_stmt 1 view .LVU531
+	.loc 1 239 33 is_stmt 0 view .LVU532
+	subl	$48, %edx
+	pxor	%xmm3, %xmm3
+	.loc 1 241 15 view .LVU533
+	addq	$1, %rax
+.LVL190:
+	.loc 1 239 33 view .LVU534
+	movsbl	%dl, %edx
+	cvtsi2ssl	%edx, %xmm3
+	.loc 1 238 18 view .LVU535
+	movzbl	(%rax), %edx
+	.loc 1 238 29 view .LVU536
+	leal	-48(%rdx), %ecx
+	.loc 1 239 33 view .LVU537
+	divss	%xmm4, %xmm3
+	.loc 1 240 19 view .LVU538
+	mulss	%xmm2, %xmm4
+.LVL191:
+	.loc 1 239 19 view .LVU539
+	addss	%xmm3, %xmm1
+.LVL192:
+	.loc 1 240 13 is_stmt 1 view .LVU540
+	.loc 1 241 13 view .LVU541
+	.loc 1 238 29 view .LVU542
+	cmpb	$9, %cl
+	jbe	.L117
+	jmp	.L116
+.LVL193:
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.loc 1 238 29 is_stmt 0 view .LVU543
+.LBE89:
+	.loc 1 219 9 is_stmt 1 view .LVU544
+	.loc 1 220 9 view .LVU545
+	.loc 1 219 14 is_stmt 0 view .LVU546
+	movss	.LC5(%rip), %xmm0
+	.loc 1 220 11 view .LVU547
+	addq	$1, %rax
+.LVL194:
+	.loc 1 220 11 view .LVU548
+	jmp	.L112
+.LVL195:
+.L135:
+.LBB90:
+	.loc 1 263 29 view .LVU549
+	movss	.LC6(%rip), %xmm3
+.LVL196:
+.L123:
+	.loc 1 263 29 view .LVU550
+.LBE90:
+	.loc 1 283 43 view .LVU551
+	mulss	%xmm3, %xmm1
+.LVL197:
+	.loc 1 283 17 view .LVU552
+	mulss	%xmm1, %xmm0
+.LVL198:
+	.loc 1 284 1 view .LVU553
+	ret
+.LVL199:
+	.p2align 4,,10
+	.p2align 3
+.L152:
+.LBB91:
+	.loc 1 254 13 is_stmt 1 view .LVU554
+	.loc 1 255 13 view .LVU555
+	.loc 1 263 18 is_stmt 0 view .LVU556
+	movsbl	2(%rax), %edx
+	.loc 1 255 15 view .LVU557
+	leaq	2(%rax), %rsi
+.LVL200:
+	.loc 1 262 9 is_stmt 1 view .LVU558
+	.loc 1 263 9 view .LVU559
+	.loc 1 263 29 view .LVU560
+	.loc 1 254 18 is_stmt 0 view .LVU561
+	movl	$1, %edi
+	.loc 1 263 29 view .LVU562
+	movss	.LC6(%rip), %xmm3
+	leal	-48(%rdx), %eax
+	cmpb	$9, %al
+	jbe	.L120
+	jmp	.L121
+.LVL201:
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	.loc 1 258 13 is_stmt 1 view .LVU563
+	.loc 1 263 18 is_stmt 0 view .LVU564
+	movsbl	2(%rax), %edx
+	.loc 1 258 15 view .LVU565
+	leaq	2(%rax), %rsi
+.LVL202:
+	.loc 1 262 9 is_stmt 1 view .LVU566
+	.loc 1 263 9 view .LVU567
+	.loc 1 263 29 view .LVU568
+	leal	-48(%rdx), %eax
+	cmpb	$9, %al
+	ja	.L135
+	.loc 1 252 14 is_stmt 0 view .LVU569
+	xorl	%edi, %edi
+	jmp	.L120
+.LVL203:
+.L136:
+	.loc 1 272 22 view .LVU570
+	movss	.LC6(%rip), %xmm3
+	jmp	.L125
+.LBE91:
+	.cfi_endproc
+.LFE9:
+	.size	fastA2F, .-fastA2F
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC2:
+	.long	973279855
+	.align 4
+.LC3:
+	.long	1148846080
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC4:
+	.byte	48
+	.byte	48
+	.section	.rodata.cst4
+	.align 4
+.LC5:
+	.long	-1082130432
+	.align 4
+.LC6:
+	.long	1065353216
+	.align 4
+.LC7:
+	.long	1092616192
+	.align 4
+.LC8:
+	.long	1287568416
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xa49
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1179
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL74
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1138
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1139
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1140
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1141
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1142
+	.uleb128 0x9
+	.long	.LASF1144
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1143
+	.uleb128 0x9
+	.long	.LASF1145
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1146
+	.uleb128 0xe
+	.long	0x83
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1147
+	.uleb128 0x1f
+	.long	0x83
+	.uleb128 0x9
+	.long	.LASF1148
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF1149
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x9
+	.long	.LASF1150
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0xe
+	.long	0x8a
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1151
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1152
+	.uleb128 0x15
+	.long	.LASF1153
+	.byte	0x90
+	.long	0x7e
+	.long	0xe4
+	.uleb128 0x7
+	.long	0x7e
+	.uleb128 0x7
+	.long	0xb3
+	.uleb128 0x7
+	.long	0xa7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1154
+	.byte	0x95
+	.long	0x7e
+	.long	0xfd
+	.uleb128 0x7
+	.long	0x7e
+	.uleb128 0x7
+	.long	0xb3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1155
+	.byte	0x6
+	.value	0x197
+	.byte	0xf
+	.long	0xa7
+	.long	0x114
+	.uleb128 0x7
+	.long	0xb3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1162
+	.byte	0xce
+	.long	0xb8
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d4
+	.uleb128 0x3
+	.string	"p"
+	.byte	0xce
+	.byte	0x1b
+	.long	0xb3
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x5
+	.long	.LASF1156
+	.byte	0xd0
+	.byte	0x9
+	.long	0x70
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x5
+	.long	.LASF1157
+	.byte	0xd1
+	.byte	0xb
+	.long	0xb8
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x5
+	.long	.LASF1158
+	.byte	0xd1
+	.byte	0x11
+	.long	0xb8
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x5
+	.long	.LASF1159
+	.byte	0xd1
+	.byte	0x18
+	.long	0xb8
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x21
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.long	0x1ba
+	.uleb128 0x5
+	.long	.LASF1160
+	.byte	0xeb
+	.byte	0xf
+	.long	0xb8
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.uleb128 0x10
+	.long	.LLRL71
+	.uleb128 0x5
+	.long	.LASF1161
+	.byte	0xf8
+	.byte	0x16
+	.long	0x3c
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1163
+	.byte	0x93
+	.long	0x7e
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x448
+	.uleb128 0x3
+	.string	"x"
+	.byte	0x93
+	.byte	0x12
+	.long	0xb8
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x17
+	.long	.LASF1164
+	.byte	0x93
+	.byte	0x1b
+	.long	0x7e
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x5
+	.long	.LASF1158
+	.byte	0x95
+	.byte	0xd
+	.long	0x8f
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x11
+	.long	.LASF1165
+	.byte	0x96
+	.byte	0xa
+	.long	0x448
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x11
+	.long	.LASF1166
+	.byte	0x97
+	.byte	0xa
+	.long	0x448
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x11
+	.long	.LASF1167
+	.byte	0x98
+	.byte	0xb
+	.long	0x7e
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+2612
+	.sleb128 0
+	.uleb128 0x5
+	.long	.LASF1168
+	.byte	0x99
+	.byte	0xd
+	.long	0x9b
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x18
+	.long	0x458
+	.quad	.LBI64
+	.byte	.LVU347
+	.long	.LLRL54
+	.byte	0xa2
+	.byte	0x5
+	.long	0x34c
+	.uleb128 0x1
+	.long	0x47b
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0x472
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x1
+	.long	0x469
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0xa
+	.long	0x487
+	.quad	.LBI66
+	.byte	.LVU351
+	.long	.LLRL58
+	.byte	0x8d
+	.byte	0xa
+	.uleb128 0x1
+	.long	0x4aa
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xa
+	.long	0x487
+	.quad	.LBI68
+	.byte	.LVU400
+	.long	.LLRL62
+	.byte	0x80
+	.byte	0xd
+	.uleb128 0x1
+	.long	0x4aa
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xb
+	.quad	.LVL157
+	.long	0x487
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.byte	0x7b
+	.sleb128 0
+	.byte	0xc
+	.long	0xcccccccd
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x23
+	.byte	0x25
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL134
+	.long	0xfd
+	.long	0x364
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL135
+	.long	0xe4
+	.long	0x382
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL136
+	.long	0xfd
+	.long	0x39a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL137
+	.long	0xc6
+	.long	0x3be
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL138
+	.long	0xa3a
+	.long	0x3d6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL139
+	.long	0xa43
+	.long	0x3f1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL142
+	.long	0xe4
+	.long	0x40f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL153
+	.long	0xe4
+	.long	0x42d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL154
+	.long	0xe4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x83
+	.long	0x458
+	.uleb128 0x23
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1169
+	.byte	0x1
+	.byte	0x85
+	.byte	0x7
+	.long	0x7e
+	.byte	0x1
+	.long	0x487
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x85
+	.byte	0x10
+	.long	0x70
+	.uleb128 0xc
+	.string	"a"
+	.byte	0x85
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x19
+	.long	.LASF1170
+	.byte	0x85
+	.byte	0x20
+	.long	0x70
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1180
+	.byte	0x1
+	.byte	0x7d
+	.byte	0xe
+	.long	0x7e
+	.byte	0x1
+	.long	0x4b6
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x7d
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0xc
+	.string	"a"
+	.byte	0x7d
+	.byte	0x25
+	.long	0x7e
+	.uleb128 0x19
+	.long	.LASF1170
+	.byte	0x7d
+	.byte	0x31
+	.long	0x3c
+	.byte	0
+	.uleb128 0x26
+	.string	"a2i"
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x6
+	.long	0x83
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x571
+	.uleb128 0x3
+	.string	"ch"
+	.byte	0x5d
+	.byte	0xf
+	.long	0x83
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x3
+	.string	"src"
+	.byte	0x5d
+	.byte	0x1a
+	.long	0x571
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x12
+	.long	.LASF1170
+	.byte	0x5d
+	.byte	0x23
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x12
+	.long	.LASF1171
+	.byte	0x5d
+	.byte	0x2e
+	.long	0x576
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x5f
+	.byte	0xb
+	.long	0x7e
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x8
+	.string	"num"
+	.byte	0x60
+	.byte	0x9
+	.long	0x70
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x5
+	.long	.LASF1172
+	.byte	0x61
+	.byte	0x9
+	.long	0x70
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xa
+	.long	0x57b
+	.quad	.LBI22
+	.byte	.LVU234
+	.long	.LLRL32
+	.byte	0x62
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x58c
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x7e
+	.uleb128 0xe
+	.long	0x70
+	.uleb128 0x27
+	.string	"a2d"
+	.byte	0x1
+	.byte	0x51
+	.byte	0x5
+	.long	0x70
+	.byte	0x1
+	.long	0x597
+	.uleb128 0xc
+	.string	"ch"
+	.byte	0x51
+	.byte	0xe
+	.long	0x83
+	.byte	0
+	.uleb128 0x28
+	.string	"i2a"
+	.byte	0x1
+	.byte	0x48
+	.byte	0x6
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f4
+	.uleb128 0x3
+	.string	"num"
+	.byte	0x48
+	.byte	0xe
+	.long	0x70
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x3
+	.string	"bf"
+	.byte	0x48
+	.byte	0x19
+	.long	0x7e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1a
+	.quad	.LVL71
+	.long	0x5f4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1173
+	.byte	0x36
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x687
+	.uleb128 0x3
+	.string	"num"
+	.byte	0x36
+	.byte	0x18
+	.long	0x3c
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x12
+	.long	.LASF1170
+	.byte	0x36
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.string	"uc"
+	.byte	0x36
+	.byte	0x34
+	.long	0x70
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x3
+	.string	"bf"
+	.byte	0x36
+	.byte	0x3e
+	.long	0x7e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x8
+	.string	"n"
+	.byte	0x38
+	.byte	0x9
+	.long	0x70
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x8
+	.string	"d"
+	.byte	0x39
+	.byte	0x12
+	.long	0x3c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x10
+	.long	.LLRL23
+	.uleb128 0x1b
+	.string	"dgt"
+	.byte	0x3d
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1174
+	.byte	0x2b
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6e1
+	.uleb128 0x3
+	.string	"num"
+	.byte	0x2b
+	.byte	0x10
+	.long	0x77
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.string	"bf"
+	.byte	0x2b
+	.byte	0x1b
+	.long	0x7e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1a
+	.quad	.LVL46
+	.long	0x6e1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1175
+	.byte	0x19
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77a
+	.uleb128 0x3
+	.string	"num"
+	.byte	0x19
+	.byte	0x1e
+	.long	0x43
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x17
+	.long	.LASF1170
+	.byte	0x19
+	.byte	0x30
+	.long	0x3c
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x3
+	.string	"uc"
+	.byte	0x19
+	.byte	0x3a
+	.long	0x70
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x3
+	.string	"bf"
+	.byte	0x19
+	.byte	0x44
+	.long	0x7e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.string	"n"
+	.byte	0x1b
+	.byte	0x9
+	.long	0x70
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x8
+	.string	"d"
+	.byte	0x1c
+	.byte	0x12
+	.long	0x3c
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x10
+	.long	.LLRL15
+	.uleb128 0x1b
+	.string	"dgt"
+	.byte	0x20
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x487
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x866
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1
+	.long	0x4aa
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.long	0x487
+	.quad	.LBI6
+	.byte	.LVU16
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x1
+	.long	0x4aa
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xf
+	.long	0x487
+	.quad	.LBI8
+	.byte	.LVU29
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x1
+	.long	0x4aa
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xb
+	.quad	.LVL19
+	.long	0x487
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x57b
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x88f
+	.uleb128 0x1
+	.long	0x58c
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x14
+	.long	0x458
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa34
+	.uleb128 0x1
+	.long	0x469
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x472
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1
+	.long	0x47b
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x18
+	.long	0x487
+	.quad	.LBI40
+	.byte	.LVU262
+	.long	.LLRL37
+	.byte	0x8d
+	.byte	0xa
+	.long	0x9a8
+	.uleb128 0xd
+	.long	0x4aa
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xf
+	.long	0x487
+	.quad	.LBI42
+	.byte	.LVU292
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.uleb128 0xd
+	.long	0x4aa
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0xf
+	.long	0x487
+	.quad	.LBI44
+	.byte	.LVU305
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.uleb128 0xd
+	.long	0x4aa
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xb
+	.quad	.LVL117
+	.long	0x487
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7a
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x487
+	.quad	.LBI49
+	.byte	.LVU279
+	.long	.LLRL44
+	.byte	0x8b
+	.byte	0xa
+	.uleb128 0xd
+	.long	0x4aa
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0xa
+	.long	0x487
+	.quad	.LBI51
+	.byte	.LVU284
+	.long	.LLRL47
+	.byte	0x80
+	.byte	0xd
+	.uleb128 0xd
+	.long	0x4aa
+	.uleb128 0x1
+	.long	0x4a1
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x498
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0xb
+	.quad	.LVL122
+	.long	0x487
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7a
+	.sleb128 1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x9e
+	.uleb128 0x2
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1155
+	.long	.LASF1177
+	.uleb128 0x1c
+	.long	.LASF1176
+	.long	.LASF1178
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 128
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU442
+	.uleb128 .LVU442
+	.uleb128 .LVU464
+	.uleb128 .LVU464
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU520
+	.uleb128 .LVU522
+	.uleb128 .LVU526
+	.uleb128 .LVU526
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU558
+	.uleb128 .LVU558
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 0
+.LLST66:
+	.byte	0x6
+	.quad	.LVL159
+	.byte	0x4
+	.uleb128 .LVL159-.LVL159
+	.uleb128 .LVL160-.LVL159
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL160-.LVL159
+	.uleb128 .LVL166-.LVL159
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL166-.LVL159
+	.uleb128 .LVL167-.LVL159
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.LVL159
+	.uleb128 .LVL170-.LVL159
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL170-.LVL159
+	.uleb128 .LVL171-.LVL159
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL159
+	.uleb128 .LVL174-.LVL159
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL174-.LVL159
+	.uleb128 .LVL175-.LVL159
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL175-.LVL159
+	.uleb128 .LVL185-.LVL159
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL187-.LVL159
+	.uleb128 .LVL188-.LVL159
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.LVL159
+	.uleb128 .LVL189-.LVL159
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL189-.LVL159
+	.uleb128 .LVL190-.LVL159
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL190-.LVL159
+	.uleb128 .LVL192-.LVL159
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL159
+	.uleb128 .LVL195-.LVL159
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.LVL159
+	.uleb128 .LVL199-.LVL159
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL199-.LVL159
+	.uleb128 .LVL200-.LVL159
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL159
+	.uleb128 .LVL201-.LVL159
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL201-.LVL159
+	.uleb128 .LVL202-.LVL159
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL159
+	.uleb128 .LFE9-.LVL159
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU436
+	.uleb128 .LVU491
+	.uleb128 .LVU516
+	.uleb128 .LVU519
+	.uleb128 .LVU522
+	.uleb128 .LVU550
+	.uleb128 .LVU554
+	.uleb128 .LVU555
+	.uleb128 .LVU555
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 .LVU570
+.LLST67:
+	.byte	0x6
+	.quad	.LVL159
+	.byte	0x4
+	.uleb128 .LVL159-.LVL159
+	.uleb128 .LVL172-.LVL159
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.LVL159
+	.uleb128 .LVL184-.LVL159
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL187-.LVL159
+	.uleb128 .LVL196-.LVL159
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.LVL159
+	.uleb128 .LVL199-.LVL159
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.LVL159
+	.uleb128 .LVL201-.LVL159
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL159
+	.uleb128 .LVL203-.LVL159
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU448
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU521
+	.uleb128 .LVU522
+	.uleb128 .LVU543
+	.uleb128 .LVU543
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU553
+	.uleb128 .LVU554
+	.uleb128 0
+.LLST68:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL163-.LVL162
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x4
+	.uleb128 .LVL163-.LVL162
+	.uleb128 .LVL186-.LVL162
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL187-.LVL162
+	.uleb128 .LVL193-.LVL162
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL193-.LVL162
+	.uleb128 .LVL193-.LVL162
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x4
+	.uleb128 .LVL193-.LVL162
+	.uleb128 .LVL195-.LVL162
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0xbf800000
+	.byte	0x4
+	.uleb128 .LVL195-.LVL162
+	.uleb128 .LVL198-.LVL162
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL199-.LVL162
+	.uleb128 .LFE9-.LVL162
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU455
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU462
+	.uleb128 .LVU468
+	.uleb128 .LVU470
+	.uleb128 .LVU473
+	.uleb128 .LVU520
+	.uleb128 .LVU527
+	.uleb128 .LVU543
+	.uleb128 .LVU549
+	.uleb128 .LVU552
+	.uleb128 .LVU554
+	.uleb128 0
+.LLST69:
+	.byte	0x6
+	.quad	.LVL163
+	.byte	0x4
+	.uleb128 .LVL163-.LVL163
+	.uleb128 .LVL164-.LVL163
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL164-.LVL163
+	.uleb128 .LVL165-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL167-.LVL163
+	.uleb128 .LVL168-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL169-.LVL163
+	.uleb128 .LVL185-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL188-.LVL163
+	.uleb128 .LVL193-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL195-.LVL163
+	.uleb128 .LVL197-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL199-.LVL163
+	.uleb128 .LFE9-.LVL163
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU474
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU519
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU554
+	.uleb128 0
+.LLST70:
+	.byte	0x6
+	.quad	.LVL169
+	.byte	0x4
+	.uleb128 .LVL169-.LVL169
+	.uleb128 .LVL177-.LVL169
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x4
+	.uleb128 .LVL177-.LVL169
+	.uleb128 .LVL184-.LVL169
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL195-.LVL169
+	.uleb128 .LVL196-.LVL169
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0x4
+	.uleb128 .LVL199-.LVL169
+	.uleb128 .LFE9-.LVL169
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3f800000
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU523
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU539
+	.uleb128 .LVU541
+	.uleb128 .LVU543
+.LLST73:
+	.byte	0x6
+	.quad	.LVL187
+	.byte	0x4
+	.uleb128 .LVL187-.LVL187
+	.uleb128 .LVL189-.LVL187
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x41200000
+	.byte	0x4
+	.uleb128 .LVL189-.LVL187
+	.uleb128 .LVL191-.LVL187
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL192-.LVL187
+	.uleb128 .LVL193-.LVL187
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU487
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU514
+	.uleb128 .LVU514
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU516
+	.uleb128 .LVU549
+	.uleb128 .LVU550
+	.uleb128 .LVU559
+	.uleb128 .LVU563
+	.uleb128 .LVU567
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 0
+.LLST72:
+	.byte	0x6
+	.quad	.LVL171
+	.byte	0x4
+	.uleb128 .LVL171-.LVL171
+	.uleb128 .LVL173-.LVL171
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL173-.LVL171
+	.uleb128 .LVL176-.LVL171
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL176-.LVL171
+	.uleb128 .LVL177-.LVL171
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL177-.LVL171
+	.uleb128 .LVL180-.LVL171
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL180-.LVL171
+	.uleb128 .LVL181-.LVL171
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL181-.LVL171
+	.uleb128 .LVL182-.LVL171
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL182-.LVL171
+	.uleb128 .LVL183-.LVL171
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.LVL171
+	.uleb128 .LVL196-.LVL171
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL171
+	.uleb128 .LVL201-.LVL171
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL202-.LVL171
+	.uleb128 .LVL203-.LVL171
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.LVL171
+	.uleb128 .LFE9-.LVL171
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU343
+	.uleb128 .LVU343
+	.uleb128 .LVU345
+	.uleb128 .LVU394
+	.uleb128 .LVU397
+.LLST50:
+	.byte	0x6
+	.quad	.LVL124
+	.byte	0x4
+	.uleb128 .LVL124-.LVL124
+	.uleb128 .LVL126-.LVL124
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL126-.LVL124
+	.uleb128 .LVL127-.LVL124
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL143-.LVL124
+	.uleb128 .LVL145-.LVL124
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 0
+.LLST51:
+	.byte	0x6
+	.quad	.LVL124
+	.byte	0x4
+	.uleb128 .LVL124-.LVL124
+	.uleb128 .LVL131-.LVL124
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL131-.LVL124
+	.uleb128 .LVL140-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.LVL124
+	.uleb128 .LVL141-.LVL124
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL141-.LVL124
+	.uleb128 .LFE8-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU346
+	.uleb128 .LVU370
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST52:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL134-1-.LVL128
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL145-.LVL128
+	.uleb128 .LVL152-.LVL128
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL155-.LVL128
+	.uleb128 .LFE8-.LVL128
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU378
+	.uleb128 .LVU381
+.LLST53:
+	.byte	0x8
+	.quad	.LVL136
+	.uleb128 .LVL137-1-.LVL136
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU347
+	.uleb128 .LVU365
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST55:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU347
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU365
+	.uleb128 .LVU397
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 0
+.LLST56:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL130-.LVL129
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL146-.LVL129
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LVL156-.LVL129
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL156-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU347
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU365
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST57:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL132-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL132-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x13
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x78
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU351
+	.uleb128 .LVU363
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST59:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU351
+	.uleb128 .LVU354
+	.uleb128 .LVU354
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU363
+	.uleb128 .LVU397
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU411
+	.uleb128 .LVU411
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 0
+.LLST60:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL130-.LVL129
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL130-.LVL129
+	.uleb128 .LVL131-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL131-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL146-.LVL129
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL146-.LVL129
+	.uleb128 .LVL151-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL151-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LVL156-.LVL129
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL156-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU351
+	.uleb128 .LVU361
+	.uleb128 .LVU361
+	.uleb128 .LVU363
+	.uleb128 .LVU397
+	.uleb128 .LVU412
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST61:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL132-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL132-.LVL129
+	.uleb128 .LVL133-.LVL129
+	.uleb128 0x13
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x78
+	.sleb128 0
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.LVL129
+	.uleb128 .LVL152-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL155-.LVL129
+	.uleb128 .LFE8-.LVL129
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU400
+	.uleb128 .LVU411
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST63:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL151-.LVL147
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL147
+	.uleb128 .LFE8-.LVL147
+	.uleb128 0x2
+	.byte	0x3a
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU400
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU411
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 0
+.LLST64:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL148-.LVL147
+	.uleb128 .LVL149-.LVL147
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL149-.LVL147
+	.uleb128 .LVL151-.LVL147
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL147
+	.uleb128 .LVL156-.LVL147
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL156-.LVL147
+	.uleb128 .LVL158-.LVL147
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.LVL147
+	.uleb128 .LFE8-.LVL147
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU400
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+	.uleb128 .LVU430
+	.uleb128 0
+.LLST65:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL150-.LVL147
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL150-.LVL147
+	.uleb128 .LVL151-.LVL147
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL155-.LVL147
+	.uleb128 .LFE8-.LVL147
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU228
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL77
+	.byte	0x4
+	.uleb128 .LVL77-.LVL77
+	.uleb128 .LVL79-.LVL77
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.LVL77
+	.uleb128 .LVL83-.LVL77
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.LVL77
+	.uleb128 .LFE5-.LVL77
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL77
+	.byte	0x4
+	.uleb128 .LVL77-.LVL77
+	.uleb128 .LVL80-.LVL77
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL80-.LVL77
+	.uleb128 .LFE5-.LVL77
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU207
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL78
+	.byte	0x4
+	.uleb128 .LVL78-.LVL78
+	.uleb128 .LVL84-.LVL78
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL84-.LVL78
+	.uleb128 .LVL85-.LVL78
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.LVL78
+	.uleb128 .LFE5-.LVL78
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU227
+	.uleb128 .LVU230
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL78
+	.byte	0x4
+	.uleb128 .LVL78-.LVL78
+	.uleb128 .LVL80-.LVL78
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.LVL78
+	.uleb128 .LVL82-.LVL78
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL85-.LVL78
+	.uleb128 .LFE5-.LVL78
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU221
+	.uleb128 .LVU231
+	.uleb128 .LVU239
+	.uleb128 .LVU242
+.LLST31:
+	.byte	0x6
+	.quad	.LVL81
+	.byte	0x4
+	.uleb128 .LVL81-.LVL81
+	.uleb128 .LVL85-.LVL81
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL87-.LVL81
+	.uleb128 .LVL88-.LVL81
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU213
+	.uleb128 .LVU221
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+	.uleb128 .LVU248
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.LVL80
+	.uleb128 .LVL87-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL89-.LVL80
+	.uleb128 .LFE5-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU182
+.LLST24:
+	.byte	0x6
+	.quad	.LVL68
+	.byte	0x4
+	.uleb128 .LVL68-.LVL68
+	.uleb128 .LVL69-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL69-.LVL68
+	.uleb128 .LVL71-1-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU182
+.LLST25:
+	.byte	0x6
+	.quad	.LVL68
+	.byte	0x4
+	.uleb128 .LVL68-.LVL68
+	.uleb128 .LVL69-.LVL68
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL69-.LVL68
+	.uleb128 .LVL70-.LVL68
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL68
+	.uleb128 .LVL71-1-.LVL68
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL51-.LVL47
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.LVL47
+	.uleb128 .LVL53-.LVL47
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL47
+	.uleb128 .LVL54-.LVL47
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL54-.LVL47
+	.uleb128 .LFE2-.LVL47
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL49-.LVL47
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL49-.LVL47
+	.uleb128 .LVL58-.LVL47
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL58-.LVL47
+	.uleb128 .LVL59-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL47
+	.uleb128 .LVL66-.LVL47
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL66-.LVL47
+	.uleb128 .LVL67-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.LVL47
+	.uleb128 .LFE2-.LVL47
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU130
+	.uleb128 .LVU131
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL48-.LVL47
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL48-.LVL47
+	.uleb128 .LVL51-.LVL47
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL52-.LVL47
+	.uleb128 .LVL56-.LVL47
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL56-.LVL47
+	.uleb128 .LVL59-.LVL47
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL59-.LVL47
+	.uleb128 .LVL60-.LVL47
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL60-.LVL47
+	.uleb128 .LVL63-.LVL47
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL63-.LVL47
+	.uleb128 .LFE2-.LVL47
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU117
+	.uleb128 .LVU130
+	.uleb128 .LVU131
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL51-.LVL47
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL47
+	.uleb128 .LVL57-.LVL47
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL57-.LVL47
+	.uleb128 .LVL57-.LVL47
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL47
+	.uleb128 .LVL61-.LVL47
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL61-.LVL47
+	.uleb128 .LVL62-.LVL47
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL47
+	.uleb128 .LVL65-.LVL47
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL65-.LVL47
+	.uleb128 .LVL67-.LVL47
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.LVL47
+	.uleb128 .LFE2-.LVL47
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU118
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU130
+	.uleb128 .LVU131
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 0
+.LLST22:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL49-.LVL47
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.LVL47
+	.uleb128 .LVL51-.LVL47
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL52-.LVL47
+	.uleb128 .LVL55-.LVL47
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL55-.LVL47
+	.uleb128 .LVL65-.LVL47
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.LVL47
+	.uleb128 .LVL67-.LVL47
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL67-.LVL47
+	.uleb128 .LFE2-.LVL47
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU114
+.LLST16:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL46-1-.LVL43
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+.LLST17:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL45-.LVL43
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.LVL43
+	.uleb128 .LVL46-1-.LVL43
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL25-.LVL21
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.LVL21
+	.uleb128 .LVL27-.LVL21
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL21
+	.uleb128 .LVL28-.LVL21
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL28-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL40-.LVL21
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL40-.LVL21
+	.uleb128 .LVL41-.LVL21
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL40-.LVL21
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL40-.LVL21
+	.uleb128 .LVL42-.LVL21
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL22-.LVL21
+	.uleb128 .LVL25-.LVL21
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL26-.LVL21
+	.uleb128 .LVL30-.LVL21
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL30-.LVL21
+	.uleb128 .LVL32-.LVL21
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL33-.LVL21
+	.uleb128 .LVL34-.LVL21
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL34-.LVL21
+	.uleb128 .LVL37-.LVL21
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU47
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU95
+	.uleb128 .LVU96
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL25-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL21
+	.uleb128 .LVL31-.LVL21
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL31-.LVL21
+	.uleb128 .LVL31-.LVL21
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL21
+	.uleb128 .LVL35-.LVL21
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL35-.LVL21
+	.uleb128 .LVL36-.LVL21
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL21
+	.uleb128 .LVL38-.LVL21
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL39-.LVL21
+	.uleb128 .LVL42-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU48
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 .LVU60
+	.uleb128 .LVU61
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL25-.LVL21
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL26-.LVL21
+	.uleb128 .LVL29-.LVL21
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL29-.LVL21
+	.uleb128 .LVL39-.LVL21
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.LVL21
+	.uleb128 .LVL40-.LVL21
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL40-.LVL21
+	.uleb128 .LVL42-.LVL21
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL21
+	.uleb128 .LFE0-.LVL21
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LVL7-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.LVL0
+	.uleb128 .LVL10-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.LVL0
+	.uleb128 .LVL13-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.LVL0
+	.uleb128 .LVL16-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.LVL0
+	.uleb128 .LVL18-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.LVL0
+	.uleb128 .LFE6-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL7-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.LVL0
+	.uleb128 .LVL9-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL0
+	.uleb128 .LVL13-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.LVL0
+	.uleb128 .LVL16-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL0
+	.uleb128 .LVL19-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL0
+	.uleb128 .LFE6-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU4
+	.uleb128 .LVU4
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LVL5-.LVL0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LFE6-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU16
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL10-.LVL6
+	.uleb128 .LFE6-.LVL6
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU16
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL8-.LVL6
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL6
+	.uleb128 .LVL13-.LVL6
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.LVL6
+	.uleb128 .LVL15-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL6
+	.uleb128 .LVL19-1-.LVL6
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL6
+	.uleb128 .LFE6-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU16
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL7-.LVL6
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL10-.LVL6
+	.uleb128 .LVL11-.LVL6
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL6
+	.uleb128 .LFE6-.LVL6
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU29
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.LVL12
+	.uleb128 .LFE6-.LVL12
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU29
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL14-.LVL12
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL14-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL12
+	.uleb128 .LVL19-1-.LVL12
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL12
+	.uleb128 .LVL20-.LVL12
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL12
+	.uleb128 .LFE6-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL16-.LVL12
+	.uleb128 .LVL17-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL17-.LVL12
+	.uleb128 .LFE6-.LVL12
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 0
+.LLST26:
+	.byte	0x6
+	.quad	.LVL72
+	.byte	0x4
+	.uleb128 .LVL72-.LVL72
+	.uleb128 .LVL73-.LVL72
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.LVL72
+	.uleb128 .LVL74-.LVL72
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.LVL72
+	.uleb128 .LVL75-.LVL72
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-.LVL72
+	.uleb128 .LVL76-.LVL72
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL72
+	.uleb128 .LFE4-.LVL72
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 0
+.LLST34:
+	.byte	0x6
+	.quad	.LVL90
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL95-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-.LVL90
+	.uleb128 .LVL97-.LVL90
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.LVL90
+	.uleb128 .LVL102-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL102-.LVL90
+	.uleb128 .LVL103-.LVL90
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL90
+	.uleb128 .LVL105-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-.LVL90
+	.uleb128 .LVL108-.LVL90
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL90
+	.uleb128 .LVL111-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL111-.LVL90
+	.uleb128 .LVL114-.LVL90
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL114-.LVL90
+	.uleb128 .LVL116-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-.LVL90
+	.uleb128 .LVL119-.LVL90
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL119-.LVL90
+	.uleb128 .LVL121-.LVL90
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL121-.LVL90
+	.uleb128 .LFE7-.LVL90
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 0
+.LLST35:
+	.byte	0x6
+	.quad	.LVL90
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL94-.LVL90
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.LVL90
+	.uleb128 .LVL95-.LVL90
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL95-.LVL90
+	.uleb128 .LVL97-.LVL90
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL97-.LVL90
+	.uleb128 .LVL100-.LVL90
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL100-.LVL90
+	.uleb128 .LVL103-.LVL90
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL103-.LVL90
+	.uleb128 .LVL105-.LVL90
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL105-.LVL90
+	.uleb128 .LVL108-.LVL90
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL108-.LVL90
+	.uleb128 .LVL111-.LVL90
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-.LVL90
+	.uleb128 .LVL114-.LVL90
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL114-.LVL90
+	.uleb128 .LVL117-1-.LVL90
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL117-1-.LVL90
+	.uleb128 .LFE7-.LVL90
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU259
+.LLST36:
+	.byte	0x6
+	.quad	.LVL90
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL91-.LVL90
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL91-.LVL90
+	.uleb128 .LVL92-.LVL90
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU271
+	.uleb128 .LVU289
+	.uleb128 .LVU295
+	.uleb128 .LVU301
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU321
+.LLST38:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL94-.LVL93
+	.uleb128 .LVL96-.LVL93
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL103-.LVL93
+	.uleb128 .LVL105-.LVL93
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL107-.LVL93
+	.uleb128 .LVL111-.LVL93
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-.LVL93
+	.uleb128 .LVL114-.LVL93
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL114-.LVL93
+	.uleb128 .LVL117-1-.LVL93
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL117-1-.LVL93
+	.uleb128 .LVL119-.LVL93
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU262
+	.uleb128 .LVU265
+	.uleb128 .LVU289
+	.uleb128 .LVU295
+	.uleb128 .LVU302
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU321
+.LLST39:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL95-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.LVL93
+	.uleb128 .LVL105-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL108-.LVL93
+	.uleb128 .LVL111-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL111-.LVL93
+	.uleb128 .LVL114-.LVL93
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL114-.LVL93
+	.uleb128 .LVL116-.LVL93
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-.LVL93
+	.uleb128 .LVL119-.LVL93
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU292
+	.uleb128 .LVU298
+	.uleb128 .LVU298
+	.uleb128 .LVU301
+	.uleb128 .LVU302
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU321
+.LLST40:
+	.byte	0x6
+	.quad	.LVL104
+	.byte	0x4
+	.uleb128 .LVL104-.LVL104
+	.uleb128 .LVL106-.LVL104
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL106-.LVL104
+	.uleb128 .LVL107-.LVL104
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL104
+	.uleb128 .LVL111-.LVL104
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-.LVL104
+	.uleb128 .LVL113-.LVL104
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL113-.LVL104
+	.uleb128 .LVL117-1-.LVL104
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL117-1-.LVL104
+	.uleb128 .LVL119-.LVL104
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU292
+	.uleb128 .LVU295
+	.uleb128 .LVU302
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU321
+.LLST41:
+	.byte	0x6
+	.quad	.LVL104
+	.byte	0x4
+	.uleb128 .LVL104-.LVL104
+	.uleb128 .LVL105-.LVL104
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.LVL104
+	.uleb128 .LVL109-.LVL104
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-.LVL104
+	.uleb128 .LVL119-.LVL104
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU305
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU314
+	.uleb128 .LVU315
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU321
+.LLST42:
+	.byte	0x6
+	.quad	.LVL110
+	.byte	0x4
+	.uleb128 .LVL110-.LVL110
+	.uleb128 .LVL112-.LVL110
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL112-.LVL110
+	.uleb128 .LVL113-.LVL110
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL114-.LVL110
+	.uleb128 .LVL117-1-.LVL110
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL117-1-.LVL110
+	.uleb128 .LVL118-.LVL110
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL118-.LVL110
+	.uleb128 .LVL119-.LVL110
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU305
+	.uleb128 .LVU308
+	.uleb128 .LVU308
+	.uleb128 .LVU314
+	.uleb128 .LVU315
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU321
+.LLST43:
+	.byte	0x6
+	.quad	.LVL110
+	.byte	0x4
+	.uleb128 .LVL110-.LVL110
+	.uleb128 .LVL111-.LVL110
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL111-.LVL110
+	.uleb128 .LVL113-.LVL110
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL114-.LVL110
+	.uleb128 .LVL115-.LVL110
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.LVL110
+	.uleb128 .LVL119-.LVL110
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU279
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU289
+	.uleb128 .LVU321
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST45:
+	.byte	0x6
+	.quad	.LVL99
+	.byte	0x4
+	.uleb128 .LVL99-.LVL99
+	.uleb128 .LVL102-.LVL99
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL102-.LVL99
+	.uleb128 .LVL103-.LVL99
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.LVL99
+	.uleb128 .LVL122-1-.LVL99
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL122-1-.LVL99
+	.uleb128 .LFE7-.LVL99
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU278
+	.uleb128 .LVU289
+	.uleb128 .LVU321
+	.uleb128 0
+.LLST46:
+	.byte	0x6
+	.quad	.LVL98
+	.byte	0x4
+	.uleb128 .LVL98-.LVL98
+	.uleb128 .LVL103-.LVL98
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL119-.LVL98
+	.uleb128 .LFE7-.LVL98
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU284
+	.uleb128 .LVU289
+	.uleb128 .LVU321
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 0
+.LLST48:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL103-.LVL101
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL119-.LVL101
+	.uleb128 .LVL122-1-.LVL101
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL122-1-.LVL101
+	.uleb128 .LVL123-.LVL101
+	.uleb128 0x3
+	.byte	0x7a
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL123-.LVL101
+	.uleb128 .LFE7-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU284
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU289
+	.uleb128 .LVU321
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 0
+.LLST49:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL102-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.LVL101
+	.uleb128 .LVL103-.LVL101
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL119-.LVL101
+	.uleb128 .LVL120-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL120-.LVL101
+	.uleb128 .LFE7-.LVL101
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xbc
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB10
+	.byte	0x4
+	.uleb128 .LBB10-.LBB10
+	.uleb128 .LBE10-.LBB10
+	.byte	0x4
+	.uleb128 .LBB11-.LBB10
+	.uleb128 .LBE11-.LBB10
+	.byte	0x4
+	.uleb128 .LBB12-.LBB10
+	.uleb128 .LBE12-.LBB10
+	.byte	0x4
+	.uleb128 .LBB13-.LBB10
+	.uleb128 .LBE13-.LBB10
+	.byte	0x4
+	.uleb128 .LBB14-.LBB10
+	.uleb128 .LBE14-.LBB10
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB15
+	.byte	0x4
+	.uleb128 .LBB15-.LBB15
+	.uleb128 .LBE15-.LBB15
+	.byte	0x4
+	.uleb128 .LBB16-.LBB15
+	.uleb128 .LBE16-.LBB15
+	.byte	0x4
+	.uleb128 .LBB17-.LBB15
+	.uleb128 .LBE17-.LBB15
+	.byte	0x4
+	.uleb128 .LBB18-.LBB15
+	.uleb128 .LBE18-.LBB15
+	.byte	0x4
+	.uleb128 .LBB19-.LBB15
+	.uleb128 .LBE19-.LBB15
+	.byte	0
+.LLRL32:
+	.byte	0x5
+	.quad	.LBB22
+	.byte	0x4
+	.uleb128 .LBB22-.LBB22
+	.uleb128 .LBE22-.LBB22
+	.byte	0x4
+	.uleb128 .LBB27-.LBB22
+	.uleb128 .LBE27-.LBB22
+	.byte	0x4
+	.uleb128 .LBB28-.LBB22
+	.uleb128 .LBE28-.LBB22
+	.byte	0x4
+	.uleb128 .LBB29-.LBB22
+	.uleb128 .LBE29-.LBB22
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB40
+	.byte	0x4
+	.uleb128 .LBB40-.LBB40
+	.uleb128 .LBE40-.LBB40
+	.byte	0x4
+	.uleb128 .LBB48-.LBB40
+	.uleb128 .LBE48-.LBB40
+	.byte	0x4
+	.uleb128 .LBB56-.LBB40
+	.uleb128 .LBE56-.LBB40
+	.byte	0
+.LLRL44:
+	.byte	0x5
+	.quad	.LBB49
+	.byte	0x4
+	.uleb128 .LBB49-.LBB49
+	.uleb128 .LBE49-.LBB49
+	.byte	0x4
+	.uleb128 .LBB57-.LBB49
+	.uleb128 .LBE57-.LBB49
+	.byte	0
+.LLRL47:
+	.byte	0x5
+	.quad	.LBB51
+	.byte	0x4
+	.uleb128 .LBB51-.LBB51
+	.uleb128 .LBE51-.LBB51
+	.byte	0x4
+	.uleb128 .LBB54-.LBB51
+	.uleb128 .LBE54-.LBB51
+	.byte	0
+.LLRL54:
+	.byte	0x5
+	.quad	.LBB64
+	.byte	0x4
+	.uleb128 .LBB64-.LBB64
+	.uleb128 .LBE64-.LBB64
+	.byte	0x4
+	.uleb128 .LBB85-.LBB64
+	.uleb128 .LBE85-.LBB64
+	.byte	0x4
+	.uleb128 .LBB86-.LBB64
+	.uleb128 .LBE86-.LBB64
+	.byte	0x4
+	.uleb128 .LBB87-.LBB64
+	.uleb128 .LBE87-.LBB64
+	.byte	0
+.LLRL58:
+	.byte	0x5
+	.quad	.LBB66
+	.byte	0x4
+	.uleb128 .LBB66-.LBB66
+	.uleb128 .LBE66-.LBB66
+	.byte	0x4
+	.uleb128 .LBB79-.LBB66
+	.uleb128 .LBE79-.LBB66
+	.byte	0x4
+	.uleb128 .LBB80-.LBB66
+	.uleb128 .LBE80-.LBB66
+	.byte	0x4
+	.uleb128 .LBB81-.LBB66
+	.uleb128 .LBE81-.LBB66
+	.byte	0
+.LLRL62:
+	.byte	0x5
+	.quad	.LBB68
+	.byte	0x4
+	.uleb128 .LBB68-.LBB68
+	.uleb128 .LBE68-.LBB68
+	.byte	0x4
+	.uleb128 .LBB73-.LBB68
+	.uleb128 .LBE73-.LBB68
+	.byte	0x4
+	.uleb128 .LBB74-.LBB68
+	.uleb128 .LBE74-.LBB68
+	.byte	0x4
+	.uleb128 .LBB75-.LBB68
+	.uleb128 .LBE75-.LBB68
+	.byte	0
+.LLRL71:
+	.byte	0x5
+	.quad	.LBB88
+	.byte	0x4
+	.uleb128 .LBB88-.LBB88
+	.uleb128 .LBE88-.LBB88
+	.byte	0x4
+	.uleb128 .LBB90-.LBB88
+	.uleb128 .LBE90-.LBB88
+	.byte	0x4
+	.uleb128 .LBB91-.LBB88
+	.uleb128 .LBE91-.LBB88
+	.byte	0
+.LLRL74:
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB8
+	.uleb128 .LFE8-.LFB8
+	.byte	0x7
+	.quad	.LFB9
+	.uleb128 .LFE9-.LFB9
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF391
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF445
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF518
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF536
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF559
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF445
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF619
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF623
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF687
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF713
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF714
+	.byte	0x4
+	.byte	0x4
+	.file 25 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF995
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF518
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1022
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x22
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 36 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 37 ".//src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1137
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF444
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF455
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF456
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF517
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF535
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF544
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF558
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF574
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF616
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF618
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF622
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF686
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF558
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF690
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF708
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF709
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF711
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF712
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF689
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF709
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF712
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF987
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF994
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1016
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1024
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1051
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1054
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1115
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1123
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.df293132ceab5572a941cf7402f7191e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1135
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF632:
+	.string	"INT32_MAX (2147483647)"
+.LASF795:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1091:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF720:
+	.string	"__DECL_SIMD_cosl "
+.LASF443:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF788:
+	.string	"__DECL_SIMD_atan "
+.LASF990:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF958:
+	.string	"__DECL_SIMD_asinh "
+.LASF1150:
+	.string	"size_t"
+.LASF894:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1003:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF956:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF825:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1010:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF543:
+	.string	"__stub_sigreturn "
+.LASF407:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1036:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF505:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF923:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF844:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF419:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF814:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF480:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF810:
+	.string	"__DECL_SIMD_hypotl "
+.LASF678:
+	.string	"INT16_C(c) c"
+.LASF1148:
+	.string	"int32_t"
+.LASF451:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF878:
+	.string	"__DECL_SIMD_atan2 "
+.LASF770:
+	.string	"__DECL_SIMD_powl "
+.LASF832:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF779:
+	.string	"__DECL_SIMD_acosf "
+.LASF829:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF802:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1106:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1063:
+	.string	"__MATHDECL_1_IMPL"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1019:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF773:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1115:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF846:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1167:
+	.string	"decimalPoint"
+.LASF797:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1005:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF494:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1157:
+	.string	"sign"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF619:
+	.string	"__STD_TYPE"
+.LASF1099:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF657:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF744:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF467:
+	.string	"__P(args) args"
+.LASF918:
+	.string	"__DECL_SIMD_atanh "
+.LASF972:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1105:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1127:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF692:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF587:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF921:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1134:
+	.string	"acos_approx(x) acosf(x)"
+.LASF1109:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF985:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1081:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF661:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF997:
+	.string	"__HAVE_FLOAT32 1"
+.LASF979:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF786:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF682:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF626:
+	.string	"INT8_MIN (-128)"
+.LASF1162:
+	.string	"fastA2F"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF571:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF455:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF482:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF696:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF398:
+	.string	"__USE_POSIX2"
+.LASF740:
+	.string	"__DECL_SIMD_sincosl "
+.LASF635:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF656:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF756:
+	.string	"__DECL_SIMD_logf64x "
+.LASF527:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF652:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_log1p "
+.LASF1079:
+	.string	"__MATHCALL_NARROW"
+.LASF410:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF714:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1072:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1104:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF397:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF777:
+	.string	"__DECL_SIMD_powf128x "
+.LASF670:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF962:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF710:
+	.string	"NULL"
+.LASF617:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1059:
+	.string	"_Mdouble_ _Float32x"
+.LASF673:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF539:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1083:
+	.string	"FP_NAN 0"
+.LASF596:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF421:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF401:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF406:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__always_inline"
+.LASF694:
+	.string	"_SYS_SIZE_T_H "
+.LASF845:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1031:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF417:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF647:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF453:
+	.string	"__GLIBC__ 2"
+.LASF1004:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1146:
+	.string	"long int"
+.LASF445:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1024:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1071:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF422:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF439:
+	.string	"__USE_XOPEN2K8 1"
+.LASF605:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1066:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1095:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1046:
+	.string	"_Mdouble_ float"
+.LASF948:
+	.string	"__DECL_SIMD_tanh "
+.LASF691:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF919:
+	.string	"__DECL_SIMD_atanhf "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF616:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1040:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF830:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1043:
+	.string	"__MATH_PRECNAME"
+.LASF601:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1169:
+	.string	"itoa"
+.LASF808:
+	.string	"__DECL_SIMD_hypot "
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF663:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF595:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF501:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF469:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF842:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF864:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF525:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1090:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF490:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1086:
+	.string	"FP_SUBNORMAL 3"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1065:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1008:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF750:
+	.string	"__DECL_SIMD_logl "
+.LASF390:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF897:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF483:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF711:
+	.string	"NULL ((void *)0)"
+.LASF598:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF450:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF460:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1142:
+	.string	"signed char"
+.LASF567:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1149:
+	.string	"uint8_t"
+.LASF1045:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF561:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF471:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1012:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF576:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF518:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF461:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF781:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF907:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF444:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF592:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1159:
+	.string	"scale"
+.LASF915:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF594:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF893:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1049:
+	.string	"_Mdouble_ long double"
+.LASF705:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF427:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF468:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF648:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF758:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1135:
+	.string	"invSqrt_approx(x) (1.0f / sqrtf(x))"
+.LASF704:
+	.string	"__DEFINED_size_t "
+.LASF713:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1042:
+	.string	"_Mdouble_"
+.LASF565:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF916:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1114:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1018:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF627:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1021:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF965:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1116:
+	.string	"UNUSED(x) (void)(x)"
+.LASF807:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF512:
+	.string	"__restrict_arr __restrict"
+.LASF537:
+	.string	"__stub___compat_bdflush "
+.LASF700:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1101:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1158:
+	.string	"value"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF603:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF975:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF414:
+	.string	"__USE_GNU"
+.LASF449:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF643:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF851:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF491:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF641:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF994:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF548:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF783:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF542:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF689:
+	.string	"__need_size_t "
+.LASF879:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1092:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1089:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF564:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF586:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF416:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1054:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF961:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF509:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF429:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF687:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1177:
+	.string	"__builtin_strlen"
+.LASF1128:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF729:
+	.string	"__DECL_SIMD_sinf "
+.LASF404:
+	.string	"__USE_XOPEN2K"
+.LASF477:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF440:
+	.string	"_ATFILE_SOURCE"
+.LASF618:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF405:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF857:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1084:
+	.string	"FP_INFINITE 1"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF507:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF834:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF824:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF436:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF654:
+	.string	"INT_FAST8_MAX (127)"
+.LASF642:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF722:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1125:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF959:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF822:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF683:
+	.string	"UINT32_C(c) c ## U"
+.LASF662:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_POSIX199309"
+.LASF633:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF855:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1013:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF745:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF932:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF940:
+	.string	"__DECL_SIMD_erfl "
+.LASF672:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1085:
+	.string	"FP_ZERO 2"
+.LASF408:
+	.string	"__USE_LARGEFILE"
+.LASF1041:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF665:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF403:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1111:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF762:
+	.string	"__DECL_SIMD_expf32 "
+.LASF805:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF727:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1173:
+	.string	"ui2a"
+.LASF580:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF709:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF610:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF933:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF650:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF476:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF612:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF602:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF904:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF970:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1120:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF858:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1144:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF828:
+	.string	"__DECL_SIMD_exp10 "
+.LASF792:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF613:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF920:
+	.string	"__DECL_SIMD_atanhl "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1030:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF721:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1044:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF905:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF549:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF489:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1038:
+	.string	"_Mdouble_ double"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1061:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF969:
+	.string	"__DECL_SIMD_erfcf "
+.LASF660:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF910:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1172:
+	.string	"digit"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF906:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF499:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF510:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF763:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_asin "
+.LASF437:
+	.string	"__USE_POSIX199506 1"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1051:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF570:
+	.string	"__SLONG32_TYPE int"
+.LASF996:
+	.string	"__HAVE_FLOAT16 0"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF591:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1002:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF391:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF883:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF847:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF393:
+	.string	"__USE_ISOC11"
+.LASF1175:
+	.string	"uli2a"
+.LASF819:
+	.string	"__DECL_SIMD_exp2f "
+.LASF496:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF873:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF624:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF900:
+	.string	"__DECL_SIMD_log2l "
+.LASF547:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF924:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF955:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1022:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF957:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF666:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF835:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF593:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF815:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF559:
+	.string	"_BITS_TYPES_H 1"
+.LASF634:
+	.string	"UINT8_MAX (255)"
+.LASF671:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF462:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF430:
+	.string	"_POSIX_SOURCE"
+.LASF775:
+	.string	"__DECL_SIMD_powf32x "
+.LASF428:
+	.string	"__USE_ISOC95 1"
+.LASF1176:
+	.string	"strcpy"
+.LASF528:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF739:
+	.string	"__DECL_SIMD_sincosf "
+.LASF695:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1001:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF984:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF934:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF724:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF481:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF772:
+	.string	"__DECL_SIMD_powf32 "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF929:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF853:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF463:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF891:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF690:
+	.string	"__need_NULL "
+.LASF392:
+	.string	"_FEATURES_H 1"
+.LASF425:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF761:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1032:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1080:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF519:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF681:
+	.string	"UINT8_C(c) c"
+.LASF776:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1094:
+	.string	"MATH_ERRNO 1"
+.LASF493:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF575:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF871:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF986:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF987:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1015:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1174:
+	.string	"li2a"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF749:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF412:
+	.string	"__USE_ATFILE"
+.LASF1100:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1112:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF890:
+	.string	"__DECL_SIMD_log10l "
+.LASF880:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1064:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF611:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1123:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF768:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1014:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF730:
+	.string	"__DECL_SIMD_sinl "
+.LASF521:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF659:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF872:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1103:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF473:
+	.string	"__END_DECLS "
+.LASF698:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF931:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1098:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF868:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF833:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF530:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF535:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1034:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF389:
+	.string	"_STDINT_H 1"
+.LASF718:
+	.string	"__DECL_SIMD_cos "
+.LASF1132:
+	.string	"cos_approx(x) cosf(x)"
+.LASF1007:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1178:
+	.string	"__builtin_strcpy"
+.LASF649:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF734:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF859:
+	.string	"__DECL_SIMD_sinhf "
+.LASF516:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1152:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF466:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF747:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF497:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF515:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF457:
+	.string	"__PMT"
+.LASF1073:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF928:
+	.string	"__DECL_SIMD_acosh "
+.LASF1048:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF895:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF977:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1056:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF993:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF796:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1052:
+	.string	"_Mdouble_ _Float32"
+.LASF597:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF653:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF441:
+	.string	"_ATFILE_SOURCE 1"
+.LASF566:
+	.string	"__SQUAD_TYPE long int"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF765:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF415:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF532:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF848:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF922:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF914:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF630:
+	.string	"INT8_MAX (127)"
+.LASF849:
+	.string	"__DECL_SIMD_expm1f "
+.LASF989:
+	.string	"__HAVE_FLOAT128 1"
+.LASF892:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF831:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1140:
+	.string	"unsigned int"
+.LASF479:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1119:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF458:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF963:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF953:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1060:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF898:
+	.string	"__DECL_SIMD_log2 "
+.LASF869:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF411:
+	.string	"__USE_MISC"
+.LASF1037:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1124:
+	.string	"sq(x) ((x)*(x))"
+.LASF1113:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF438:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF757:
+	.string	"__DECL_SIMD_logf128x "
+.LASF604:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF983:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF563:
+	.string	"__U32_TYPE unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF488:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF764:
+	.string	"__DECL_SIMD_expf128 "
+.LASF903:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1168:
+	.string	"dpLocation"
+.LASF492:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF514:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF540:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF645:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF600:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF638:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF820:
+	.string	"__DECL_SIMD_exp2l "
+.LASF503:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF769:
+	.string	"__DECL_SIMD_powf "
+.LASF1102:
+	.string	"M_PI 3.14159265358979323846"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF677:
+	.string	"INT8_C(c) c"
+.LASF569:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF615:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF452:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF579:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF771:
+	.string	"__DECL_SIMD_powf16 "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF464:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF520:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF766:
+	.string	"__DECL_SIMD_expf64x "
+.LASF470:
+	.string	"__STRING(x) #x"
+.LASF753:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1138:
+	.string	"unsigned char"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF517:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF746:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF951:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1122:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF735:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1000:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1078:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF913:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF930:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1131:
+	.string	"sin_approx(x) sinf(x)"
+.LASF702:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF854:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF817:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF541:
+	.string	"__stub_revoke "
+.LASF524:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1147:
+	.string	"char"
+.LASF760:
+	.string	"__DECL_SIMD_expl "
+.LASF465:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF526:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF693:
+	.string	"_SIZE_T "
+.LASF943:
+	.string	"__DECL_SIMD_erff64 "
+.LASF839:
+	.string	"__DECL_SIMD_coshf "
+.LASF754:
+	.string	"__DECL_SIMD_logf128 "
+.LASF774:
+	.string	"__DECL_SIMD_powf128 "
+.LASF901:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1136:
+	.string	"white_space(c) ((c) == ' ' || (c) == '\\t')"
+.LASF640:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF485:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF637:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF863:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1164:
+	.string	"floatString"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF804:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF1163:
+	.string	"ftoa"
+.LASF1139:
+	.string	"short unsigned int"
+.LASF823:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF697:
+	.string	"__SIZE_T "
+.LASF935:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF912:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF748:
+	.string	"__DECL_SIMD_log "
+.LASF780:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF395:
+	.string	"__USE_ISOC95"
+.LASF1108:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF668:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF394:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF716:
+	.string	"_MATH_H 1"
+.LASF982:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF402:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF992:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF980:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF971:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF472:
+	.string	"__BEGIN_DECLS "
+.LASF751:
+	.string	"__DECL_SIMD_logf16 "
+.LASF778:
+	.string	"__DECL_SIMD_acos "
+.LASF500:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF981:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF625:
+	.string	"__intptr_t_defined "
+.LASF806:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF588:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF585:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF911:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF607:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF949:
+	.string	"__DECL_SIMD_tanhf "
+.LASF379:
+	.string	"SITL 1"
+.LASF791:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF396:
+	.string	"__USE_ISOCXX11"
+.LASF701:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF978:
+	.string	"__DECL_SIMD_tan "
+.LASF743:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF573:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1082:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1093:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1141:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF896:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF433:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF861:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF860:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF418:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF400:
+	.string	"__USE_POSIX199506"
+.LASF679:
+	.string	"INT32_C(c) c"
+.LASF737:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1026:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF684:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1068:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF941:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1035:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF442:
+	.string	"__WORDSIZE 64"
+.LASF1033:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF708:
+	.string	"__size_t "
+.LASF882:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF544:
+	.string	"__stub_stty "
+.LASF818:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF478:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF813:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1179:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF572:
+	.string	"__S64_TYPE long int"
+.LASF531:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF699:
+	.string	"_BSD_SIZE_T_ "
+.LASF475:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF712:
+	.string	"__need_NULL"
+.LASF686:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF726:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF874:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF998:
+	.string	"__HAVE_FLOAT64 1"
+.LASF974:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF562:
+	.string	"__S32_TYPE int"
+.LASF717:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF636:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF784:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1153:
+	.string	"strncpy"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF850:
+	.string	"__DECL_SIMD_expm1l "
+.LASF674:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF546:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF688:
+	.string	"_STRING_H 1"
+.LASF759:
+	.string	"__DECL_SIMD_expf "
+.LASF620:
+	.string	"_BITS_WCHAR_H 1"
+.LASF741:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF947:
+	.string	"__DECL_SIMD_erff128x "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1053:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF988:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF787:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF870:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF812:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF939:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF801:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF991:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF926:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF964:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF538:
+	.string	"__stub_chflags "
+.LASF707:
+	.string	"_SIZET_ "
+.LASF606:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF728:
+	.string	"__DECL_SIMD_sin "
+.LASF1087:
+	.string	"FP_NORMAL 4"
+.LASF1133:
+	.string	"atan2_approx(y,x) atan2f(y, x)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1156:
+	.string	"frac"
+.LASF1017:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF599:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF577:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF995:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF508:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF413:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF646:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF999:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1009:
+	.string	"__f32(x) x ##f32"
+.LASF498:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1069:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF658:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1161:
+	.string	"expon"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF719:
+	.string	"__DECL_SIMD_cosf "
+.LASF742:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF446:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1050:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF732:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF789:
+	.string	"__DECL_SIMD_atanf "
+.LASF1130:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF909:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1057:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1143:
+	.string	"short int"
+.LASF456:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1096:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF938:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF423:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF511:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF837:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF821:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF622:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF486:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF944:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF884:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF523:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF840:
+	.string	"__DECL_SIMD_coshl "
+.LASF809:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1171:
+	.string	"nump"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1110:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF534:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1029:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF484:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1121:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF584:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF843:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF767:
+	.string	"__DECL_SIMD_expf128x "
+.LASF487:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF568:
+	.string	"__SWORD_TYPE long int"
+.LASF803:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF495:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF968:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF581:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF434:
+	.string	"__USE_POSIX 1"
+.LASF574:
+	.string	"__STD_TYPE typedef"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF667:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1067:
+	.string	"__MATHCALL"
+.LASF664:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF899:
+	.string	"__DECL_SIMD_log2f "
+.LASF533:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF733:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1088:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1011:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1117:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1126:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF946:
+	.string	"__DECL_SIMD_erff64x "
+.LASF886:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF560:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF676:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1155:
+	.string	"strlen"
+.LASF793:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1023:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF838:
+	.string	"__DECL_SIMD_cosh "
+.LASF881:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF502:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF447:
+	.string	"__USE_ATFILE 1"
+.LASF506:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF889:
+	.string	"__DECL_SIMD_log10f "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1165:
+	.string	"intString1"
+.LASF1166:
+	.string	"intString2"
+.LASF800:
+	.string	"__DECL_SIMD_asinl "
+.LASF1075:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF522:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF703:
+	.string	"_SIZE_T_DECLARED "
+.LASF954:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF589:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF629:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF950:
+	.string	"__DECL_SIMD_tanhl "
+.LASF794:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF454:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF424:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF706:
+	.string	"_GCC_SIZE_T "
+.LASF917:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF952:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1180:
+	.string	"_i2a"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF852:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF644:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF841:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1129:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF865:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF578:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF639:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1070:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF738:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF651:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF474:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF431:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF435:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF590:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF902:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF529:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF631:
+	.string	"INT16_MAX (32767)"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1027:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF582:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF731:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF583:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF942:
+	.string	"__DECL_SIMD_erff32 "
+.LASF925:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1028:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1154:
+	.string	"strcat"
+.LASF782:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF459:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF736:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF960:
+	.string	"__DECL_SIMD_asinhl "
+.LASF623:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1151:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1055:
+	.string	"_Mdouble_ _Float64"
+.LASF655:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF448:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1170:
+	.string	"base"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF609:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF621:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF973:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF799:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF790:
+	.string	"__DECL_SIMD_atanl "
+.LASF752:
+	.string	"__DECL_SIMD_logf32 "
+.LASF945:
+	.string	"__DECL_SIMD_erff32x "
+.LASF885:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF725:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1039:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1145:
+	.string	"__int32_t"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF536:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1137:
+	.string	"valid_digit(c) ((c) >= '0' && (c) <= '9')"
+.LASF1016:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF628:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1107:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1160:
+	.string	"pow10"
+.LASF785:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF409:
+	.string	"__USE_LARGEFILE64"
+.LASF811:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF755:
+	.string	"__DECL_SIMD_logf32x "
+.LASF675:
+	.string	"WINT_MIN (0u)"
+.LASF680:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1118:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1025:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1058:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF862:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF715:
+	.string	"_STRINGS_H 1"
+.LASF1047:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF545:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF614:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF669:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1097:
+	.string	"M_E 2.7182818284590452354"
+.LASF432:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF608:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF685:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF513:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF723:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/common/typeconversion.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
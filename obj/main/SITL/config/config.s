@@ -0,0 +1,14544 @@
+	.file	"config.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/config/config.c"
+	.section	.rodata.resetConf.str1.1,"aMS",@progbits,1
+.LC21:
+	.string	"AETR1234"
+	.section	.text.resetConf,"ax",@progbits
+	.p2align 4
+	.type	resetConf, @function
+resetConf:
+.LFB9:
+	.file 1 ".//src/main/config/config.c"
+	.loc 1 303 1 view -0
+	.cfi_startproc
+	.loc 1 304 5 view .LVU1
+	.loc 1 305 5 view .LVU2
+	.loc 1 308 5 is_stmt 0 view .LVU3
+	leaq	8+masterConfig(%rip), %rdi
+	.loc 1 303 1 view .LVU4
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 308 5 view .LVU5
+	leaq	masterConfig(%rip), %rcx
+	.loc 1 305 12 view .LVU6
+	movabsq	$7234017283807649310, %rax
+	.loc 1 308 5 view .LVU7
+	andq	$-8, %rdi
+	.loc 1 305 12 view .LVU8
+	movq	%rax, 8(%rsp)
+	.loc 1 308 5 is_stmt 1 view .LVU9
+	xorl	%eax, %eax
+.LBB76:
+.LBB77:
+	.loc 1 248 36 is_stmt 0 view .LVU10
+	movdqa	.LC5(%rip), %xmm0
+.LBE77:
+.LBE76:
+	.loc 1 308 5 view .LVU11
+	subq	%rdi, %rcx
+	.loc 1 346 50 view .LVU12
+	movl	$400, %r8d
+	.loc 1 308 5 view .LVU13
+	movq	$0, masterConfig(%rip)
+	.loc 1 321 36 view .LVU14
+	movl	$250, %esi
+	.loc 1 308 5 view .LVU15
+	addl	$2012, %ecx
+	.loc 1 353 36 view .LVU16
+	movl	$1900, %r9d
+	.loc 1 308 5 view .LVU17
+	movq	$0, 2004+masterConfig(%rip)
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 309 5 is_stmt 1 view .LVU18
+.LVL0:
+.LBB80:
+.LBI80:
+	.loc 1 296 13 view .LVU19
+.LBB81:
+	.loc 1 298 5 view .LVU20
+	.loc 1 298 20 is_stmt 0 view .LVU21
+	leaq	400+masterConfig(%rip), %rax
+.LBE81:
+.LBE80:
+	.loc 1 335 40 view .LVU22
+	movl	$500, %edi
+	.loc 1 346 50 view .LVU23
+	movw	%r8w, 304+masterConfig(%rip)
+.LBB83:
+.LBB82:
+	.loc 1 298 20 view .LVU24
+	movq	%rax, currentProfile(%rip)
+.LVL1:
+	.loc 1 298 20 view .LVU25
+.LBE82:
+.LBE83:
+	.loc 1 311 5 is_stmt 1 view .LVU26
+	.loc 1 323 25 is_stmt 0 view .LVU27
+	movl	.LC0(%rip), %eax
+	.loc 1 335 40 view .LVU28
+	movw	%di, 268+masterConfig(%rip)
+.LBB84:
+.LBB85:
+	.loc 1 275 45 view .LVU29
+	movl	$39, %edi
+.LBE85:
+.LBE84:
+	.loc 1 323 25 view .LVU30
+	movl	%eax, 256+masterConfig(%rip)
+	.loc 1 325 27 view .LVU31
+	movl	.LC1(%rip), %eax
+	.loc 1 321 36 view .LVU32
+	movw	%si, 252+masterConfig(%rip)
+	.loc 1 325 27 view .LVU33
+	movl	%eax, 248+masterConfig(%rip)
+	.loc 1 342 42 view .LVU34
+	movzwl	.LC2(%rip), %eax
+	.loc 1 353 36 view .LVU35
+	movw	%r9w, 324+masterConfig(%rip)
+	.loc 1 342 42 view .LVU36
+	movw	%ax, 300+masterConfig(%rip)
+	.loc 1 351 33 view .LVU37
+	movl	.LC3(%rip), %eax
+.LBB89:
+.LBB78:
+	.loc 1 248 36 view .LVU38
+	movups	%xmm0, 208+masterConfig(%rip)
+.LBE78:
+.LBE89:
+	.loc 1 351 33 view .LVU39
+	movl	%eax, 320+masterConfig(%rip)
+	.loc 1 359 37 view .LVU40
+	movzwl	.LC4(%rip), %eax
+	.loc 1 311 37 view .LVU41
+	movb	$3, masterConfig(%rip)
+	.loc 1 312 5 is_stmt 1 view .LVU42
+	.loc 1 316 5 view .LVU43
+.LVL2:
+.LBB90:
+.LBI90:
+	.loc 1 716 6 view .LVU44
+.LBB91:
+	.loc 1 718 5 view .LVU45
+.LBE91:
+.LBE90:
+	.loc 1 359 37 is_stmt 0 view .LVU46
+	movw	%ax, 333+masterConfig(%rip)
+	.loc 1 374 29 view .LVU47
+	movl	.LC6(%rip), %eax
+.LBB93:
+.LBB92:
+	.loc 1 718 34 view .LVU48
+	movl	$2, 4+masterConfig(%rip)
+.LVL3:
+	.loc 1 718 34 view .LVU49
+.LBE92:
+.LBE93:
+	.loc 1 319 5 is_stmt 1 view .LVU50
+	.loc 1 320 5 view .LVU51
+	.loc 1 321 5 view .LVU52
+	.loc 1 322 5 view .LVU53
+	.loc 1 323 5 view .LVU54
+	.loc 1 324 5 view .LVU55
+	.loc 1 325 5 view .LVU56
+	.loc 1 327 5 view .LVU57
+	.loc 1 329 5 view .LVU58
+	.loc 1 331 5 view .LVU59
+	.loc 1 332 5 view .LVU60
+	.loc 1 333 5 view .LVU61
+	.loc 1 334 5 view .LVU62
+	.loc 1 335 5 view .LVU63
+	.loc 1 336 5 view .LVU64
+	.loc 1 336 40 is_stmt 0 view .LVU65
+	movb	$1, 246+masterConfig(%rip)
+	.loc 1 337 5 is_stmt 1 view .LVU66
+	.loc 1 337 62 is_stmt 0 view .LVU67
+	movb	$32, 260+masterConfig(%rip)
+	.loc 1 338 5 is_stmt 1 view .LVU68
+	.loc 1 339 5 view .LVU69
+	.loc 1 340 5 view .LVU70
+	.loc 1 342 5 view .LVU71
+	.loc 1 343 5 view .LVU72
+	.loc 1 344 5 view .LVU73
+	.loc 1 344 51 is_stmt 0 view .LVU74
+	movb	$33, 302+masterConfig(%rip)
+	.loc 1 345 5 is_stmt 1 view .LVU75
+	.loc 1 346 5 view .LVU76
+	.loc 1 348 5 view .LVU77
+	.loc 1 350 5 view .LVU78
+	.loc 1 351 5 view .LVU79
+	.loc 1 352 5 view .LVU80
+	.loc 1 353 5 view .LVU81
+	.loc 1 354 5 view .LVU82
+	.loc 1 356 5 view .LVU83
+	.loc 1 358 5 view .LVU84
+	.loc 1 359 5 view .LVU85
+	.loc 1 360 5 view .LVU86
+	.loc 1 362 5 view .LVU87
+	.loc 1 363 5 view .LVU88
+	.loc 1 363 40 is_stmt 0 view .LVU89
+	movb	$1, 336+masterConfig(%rip)
+	.loc 1 366 5 is_stmt 1 view .LVU90
+.LVL4:
+.LBB94:
+.LBI76:
+	.loc 1 246 6 view .LVU91
+.LBB79:
+	.loc 1 248 5 view .LVU92
+	.loc 1 249 5 view .LVU93
+	.loc 1 250 5 view .LVU94
+	.loc 1 250 5 is_stmt 0 view .LVU95
+.LBE79:
+.LBE94:
+	.loc 1 367 5 is_stmt 1 view .LVU96
+	.loc 1 372 5 view .LVU97
+	.loc 1 374 5 view .LVU98
+	.loc 1 375 5 view .LVU99
+	.loc 1 374 29 is_stmt 0 view .LVU100
+	movl	%eax, 224+masterConfig(%rip)
+	.loc 1 384 5 is_stmt 1 view .LVU101
+.LVL5:
+.LBB95:
+.LBI84:
+	.loc 1 273 6 view .LVU102
+.LBB86:
+	.loc 1 275 5 view .LVU103
+	.loc 1 275 45 is_stmt 0 view .LVU104
+	call	lookupScenarioIndex@PLT
+.LVL6:
+	.loc 1 276 45 view .LVU105
+	movl	$16, %edi
+	.loc 1 275 43 view .LVU106
+	movb	%al, 340+masterConfig(%rip)
+	.loc 1 276 5 is_stmt 1 view .LVU107
+	.loc 1 276 45 is_stmt 0 view .LVU108
+	call	lookupScenarioIndex@PLT
+.LVL7:
+.LBE86:
+.LBE95:
+	.loc 1 394 19 view .LVU109
+	movq	currentProfile(%rip), %rdi
+.LBB96:
+.LBB87:
+	.loc 1 287 32 view .LVU110
+	movdqa	.LC7(%rip), %xmm0
+	.loc 1 292 36 view .LVU111
+	movb	$82, 360+masterConfig(%rip)
+	.loc 1 276 43 view .LVU112
+	movb	%al, 341+masterConfig(%rip)
+	.loc 1 287 5 is_stmt 1 view .LVU113
+	.loc 1 288 5 view .LVU114
+	.loc 1 289 5 view .LVU115
+	.loc 1 290 5 view .LVU116
+.LBE87:
+.LBE96:
+	.loc 1 387 28 is_stmt 0 view .LVU117
+	movl	.LC8(%rip), %eax
+	.loc 1 386 27 view .LVU118
+	movl	$3500, %r10d
+	.loc 1 402 36 view .LVU119
+	movl	$1500, %r11d
+.LBB97:
+.LBB88:
+	.loc 1 287 32 view .LVU120
+	movups	%xmm0, 344+masterConfig(%rip)
+	.loc 1 292 5 is_stmt 1 view .LVU121
+.LVL8:
+	.loc 1 292 5 is_stmt 0 view .LVU122
+.LBE88:
+.LBE97:
+	.loc 1 386 5 is_stmt 1 view .LVU123
+.LBB98:
+.LBB99:
+	.loc 1 174 26 is_stmt 0 view .LVU124
+	movdqa	.LC10(%rip), %xmm0
+.LBE99:
+.LBE98:
+	.loc 1 409 5 view .LVU125
+	addq	$96, %rdi
+	.loc 1 387 28 view .LVU126
+	movl	%eax, 10+masterConfig(%rip)
+.LBB106:
+.LBB100:
+	.loc 1 193 29 view .LVU127
+	movzwl	.LC9(%rip), %eax
+.LBE100:
+.LBE106:
+	.loc 1 392 38 view .LVU128
+	movb	$1, 396+masterConfig(%rip)
+.LBB107:
+.LBB101:
+	.loc 1 193 29 view .LVU129
+	movw	%ax, -76(%rdi)
+	.loc 1 200 28 view .LVU130
+	movq	.LC11(%rip), %rax
+.LBE101:
+.LBE107:
+	.loc 1 386 27 view .LVU131
+	movw	%r10w, 8+masterConfig(%rip)
+	.loc 1 387 5 is_stmt 1 view .LVU132
+	.loc 1 388 5 view .LVU133
+	.loc 1 389 5 view .LVU134
+	.loc 1 390 5 view .LVU135
+	.loc 1 392 5 view .LVU136
+	.loc 1 394 5 view .LVU137
+.LBB108:
+.LBB102:
+	.loc 1 200 28 is_stmt 0 view .LVU138
+	movq	%rax, -73(%rdi)
+	.loc 1 211 26 view .LVU139
+	movq	.LC14(%rip), %rax
+	.loc 1 174 26 view .LVU140
+	movups	%xmm0, -92(%rdi)
+	.loc 1 203 27 view .LVU141
+	movaps	.LC12(%rip), %xmm0
+	.loc 1 211 26 view .LVU142
+	movq	%rax, -28(%rdi)
+.LBE102:
+.LBE108:
+	.loc 1 397 47 view .LVU143
+	movl	.LC16(%rip), %eax
+.LBB109:
+.LBB103:
+	.loc 1 203 27 view .LVU144
+	movups	%xmm0, -60(%rdi)
+	movaps	.LC13(%rip), %xmm0
+.LBE103:
+.LBE109:
+	.loc 1 402 36 view .LVU145
+	movw	%r11w, -4(%rdi)
+	.loc 1 397 47 view .LVU146
+	movl	%eax, -12(%rdi)
+	.loc 1 394 35 view .LVU147
+	movb	$0, -96(%rdi)
+	.loc 1 395 5 is_stmt 1 view .LVU148
+.LVL9:
+.LBB110:
+.LBI98:
+	.loc 1 172 13 view .LVU149
+.LBB104:
+	.loc 1 174 5 view .LVU150
+	.loc 1 175 5 view .LVU151
+	.loc 1 176 5 view .LVU152
+	.loc 1 177 5 view .LVU153
+	.loc 1 178 5 view .LVU154
+	.loc 1 179 5 view .LVU155
+	.loc 1 180 5 view .LVU156
+	.loc 1 181 5 view .LVU157
+	.loc 1 182 5 view .LVU158
+	.loc 1 183 5 view .LVU159
+	.loc 1 184 5 view .LVU160
+	.loc 1 185 5 view .LVU161
+	.loc 1 186 5 view .LVU162
+	.loc 1 187 5 view .LVU163
+	.loc 1 188 5 view .LVU164
+	.loc 1 189 5 view .LVU165
+	.loc 1 190 5 view .LVU166
+	.loc 1 191 5 view .LVU167
+	.loc 1 192 5 view .LVU168
+	.loc 1 193 5 view .LVU169
+	.loc 1 194 5 view .LVU170
+	.loc 1 195 5 view .LVU171
+	.loc 1 196 5 view .LVU172
+	.loc 1 197 5 view .LVU173
+	.loc 1 197 30 is_stmt 0 view .LVU174
+	movb	$100, -65(%rdi)
+	.loc 1 198 5 is_stmt 1 view .LVU175
+	.loc 1 199 5 view .LVU176
+	.loc 1 200 5 view .LVU177
+	.loc 1 201 5 view .LVU178
+	.loc 1 201 28 is_stmt 0 view .LVU179
+	movb	$1, -63(%rdi)
+	.loc 1 203 5 is_stmt 1 view .LVU180
+	.loc 1 204 5 view .LVU181
+	.loc 1 205 5 view .LVU182
+	.loc 1 206 5 view .LVU183
+	.loc 1 207 5 view .LVU184
+	.loc 1 208 5 view .LVU185
+	.loc 1 209 5 view .LVU186
+	.loc 1 210 5 view .LVU187
+	.loc 1 213 25 is_stmt 0 view .LVU188
+	movl	$0x40400000, -20(%rdi)
+	.loc 1 215 30 view .LVU189
+	movb	$0, -16(%rdi)
+.LBE104:
+.LBE110:
+	.loc 1 399 53 view .LVU190
+	movw	$0, -8(%rdi)
+	.loc 1 401 31 view .LVU191
+	movb	$0, -6(%rdi)
+.LBB111:
+.LBB105:
+	.loc 1 203 27 view .LVU192
+	movups	%xmm0, -44(%rdi)
+	.loc 1 211 5 is_stmt 1 view .LVU193
+	.loc 1 212 5 view .LVU194
+	.loc 1 213 5 view .LVU195
+	.loc 1 215 5 view .LVU196
+.LVL10:
+	.loc 1 215 5 is_stmt 0 view .LVU197
+.LBE105:
+.LBE111:
+	.loc 1 397 5 is_stmt 1 view .LVU198
+	.loc 1 398 5 view .LVU199
+	.loc 1 399 5 view .LVU200
+	.loc 1 400 5 view .LVU201
+	.loc 1 401 5 view .LVU202
+	.loc 1 402 5 view .LVU203
+	.loc 1 403 5 view .LVU204
+	.loc 1 404 5 view .LVU205
+	.loc 1 409 5 view .LVU206
+	call	resetRollAndPitchTrims@PLT
+.LVL11:
+	.loc 1 411 5 view .LVU207
+	.loc 1 411 19 is_stmt 0 view .LVU208
+	movq	currentProfile(%rip), %rax
+	.loc 1 411 37 view .LVU209
+	xorl	%edx, %edx
+	.loc 1 422 5 view .LVU210
+	leaq	310+masterConfig(%rip), %rsi
+	leaq	.LC21(%rip), %rdi
+	.loc 1 411 37 view .LVU211
+	movw	%dx, 94(%rax)
+	.loc 1 412 5 is_stmt 1 view .LVU212
+	.loc 1 414 36 is_stmt 0 view .LVU213
+	movzwl	.LC18(%rip), %edx
+	.loc 1 412 32 view .LVU214
+	movb	$15, 100(%rax)
+	.loc 1 413 5 is_stmt 1 view .LVU215
+	.loc 1 414 36 is_stmt 0 view .LVU216
+	movw	%dx, 108(%rax)
+.LBB112:
+.LBB113:
+	.loc 1 234 37 view .LVU217
+	movq	.LC19(%rip), %rdx
+.LBE113:
+.LBE112:
+	.loc 1 413 37 view .LVU218
+	movl	$0x40a00000, 104(%rax)
+	.loc 1 414 5 is_stmt 1 view .LVU219
+	.loc 1 415 5 view .LVU220
+	.loc 1 417 5 view .LVU221
+.LVL12:
+.LBB115:
+.LBI112:
+	.loc 1 231 6 view .LVU222
+.LBB114:
+	.loc 1 233 5 view .LVU223
+	.loc 1 234 37 is_stmt 0 view .LVU224
+	movq	%rdx, 116(%rax)
+	.loc 1 233 40 view .LVU225
+	movb	$21, 112(%rax)
+	.loc 1 234 5 is_stmt 1 view .LVU226
+	.loc 1 235 5 view .LVU227
+	.loc 1 236 5 view .LVU228
+	.loc 1 236 34 is_stmt 0 view .LVU229
+	movl	$0x3f770a3d, 124(%rax)
+.LVL13:
+	.loc 1 236 34 view .LVU230
+.LBE114:
+.LBE115:
+	.loc 1 419 5 is_stmt 1 view .LVU231
+	.loc 1 419 36 is_stmt 0 view .LVU232
+	movb	$1, 128(%rax)
+	.loc 1 422 5 is_stmt 1 view .LVU233
+	call	parseRcChannels@PLT
+.LVL14:
+	.loc 1 423 5 view .LVU234
+	.loc 1 423 30 is_stmt 0 view .LVU235
+	movl	.LC22(%rip), %eax
+	.loc 1 428 47 view .LVU236
+	movl	$800, %ecx
+	.loc 1 423 19 view .LVU237
+	movq	currentProfile(%rip), %r8
+	.loc 1 424 5 is_stmt 1 view .LVU238
+	.loc 1 425 5 view .LVU239
+	.loc 1 426 5 view .LVU240
+	movl	.LC23(%rip), %esi
+	leaq	8(%rsp), %rdx
+	leaq	16(%rsp), %rdi
+	.loc 1 427 47 is_stmt 0 view .LVU241
+	movb	$0, 458(%r8)
+	.loc 1 428 47 view .LVU242
+	movw	%cx, 456(%r8)
+	.loc 1 423 30 view .LVU243
+	movl	%eax, 452(%r8)
+	.loc 1 427 5 is_stmt 1 view .LVU244
+	.loc 1 428 5 view .LVU245
+	.loc 1 431 5 view .LVU246
+	.loc 1 432 5 view .LVU247
+	.loc 1 433 5 view .LVU248
+	.loc 1 434 5 view .LVU249
+	.loc 1 435 5 view .LVU250
+	.loc 1 431 51 is_stmt 0 view .LVU251
+	movabsq	$595323806364518410, %rax
+	movq	%rax, 524(%r8)
+	.loc 1 438 5 is_stmt 1 view .LVU252
+.LVL15:
+	.loc 1 438 19 view .LVU253
+	leaq	460(%r8), %rax
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 439 9 discriminator 3 view .LVU254
+	.loc 1 440 9 discriminator 3 view .LVU255
+	.loc 1 441 45 is_stmt 0 discriminator 3 view .LVU256
+	movl	$1500, %ecx
+	.loc 1 438 19 discriminator 3 view .LVU257
+	addq	$1, %rdx
+.LVL17:
+	.loc 1 439 42 discriminator 3 view .LVU258
+	movl	%esi, (%rax)
+	.loc 1 441 9 is_stmt 1 discriminator 3 view .LVU259
+	.loc 1 438 19 is_stmt 0 discriminator 3 view .LVU260
+	addq	$8, %rax
+	.loc 1 441 45 discriminator 3 view .LVU261
+	movw	%cx, -4(%rax)
+	.loc 1 442 9 is_stmt 1 discriminator 3 view .LVU262
+	.loc 1 442 43 is_stmt 0 discriminator 3 view .LVU263
+	movzbl	-1(%rdx), %ecx
+	.loc 1 443 57 discriminator 3 view .LVU264
+	movb	$-1, -1(%rax)
+	.loc 1 442 43 discriminator 3 view .LVU265
+	movb	%cl, -2(%rax)
+	.loc 1 443 9 is_stmt 1 discriminator 3 view .LVU266
+	.loc 1 438 25 discriminator 3 view .LVU267
+.LVL18:
+	.loc 1 438 19 discriminator 3 view .LVU268
+	cmpq	%rdi, %rdx
+	jne	.L2
+	.loc 1 446 5 view .LVU269
+	.loc 1 447 51 is_stmt 0 view .LVU270
+	movzwl	.LC24(%rip), %eax
+	.loc 1 446 47 view .LVU271
+	movb	$1, 532(%r8)
+	.loc 1 447 5 is_stmt 1 view .LVU272
+	.loc 1 450 5 view .LVU273
+	.loc 1 447 51 is_stmt 0 view .LVU274
+	movw	%ax, 533(%r8)
+	.loc 1 457 5 is_stmt 1 view .LVU275
+.LVL19:
+	.loc 1 457 19 view .LVU276
+	leaq	16+masterConfig(%rip), %rax
+	leaq	192(%rax), %rdx
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 458 9 discriminator 3 view .LVU277
+	.loc 1 458 46 is_stmt 0 discriminator 3 view .LVU278
+	movl	$0x00000000, (%rax)
+	.loc 1 457 26 is_stmt 1 discriminator 3 view .LVU279
+.LVL21:
+	.loc 1 457 19 discriminator 3 view .LVU280
+	addq	$16, %rax
+.LVL22:
+	.loc 1 457 19 is_stmt 0 discriminator 3 view .LVU281
+	cmpq	%rax, %rdx
+	jne	.L3
+.LVL23:
+	.loc 1 466 19 is_stmt 1 view .LVU282
+	.loc 1 467 9 view .LVU283
+	movq	(%r8), %rax
+	leaq	944+masterConfig(%rip), %rdi
+	leaq	936+masterConfig(%rip), %rcx
+	movq	%r8, %rsi
+	andq	$-8, %rdi
+	movq	%rax, 936+masterConfig(%rip)
+	subq	%rdi, %rcx
+	movq	528(%r8), %rdx
+	subq	%rcx, %rsi
+	addl	$536, %ecx
+	movq	%rdx, 1464+masterConfig(%rip)
+	shrl	$3, %ecx
+	rep movsq
+	.loc 1 466 25 view .LVU284
+.LVL24:
+	.loc 1 466 19 view .LVU285
+	.loc 1 467 9 view .LVU286
+	leaq	1480+masterConfig(%rip), %rdi
+	leaq	1472+masterConfig(%rip), %rcx
+	movq	%r8, %rsi
+	andq	$-8, %rdi
+	movq	(%r8), %rdx
+	subq	%rdi, %rcx
+	subq	%rcx, %rsi
+	addl	$536, %ecx
+	movq	%rdx, 1472+masterConfig(%rip)
+	movq	528(%r8), %rax
+	shrl	$3, %ecx
+	movq	%rax, 2000+masterConfig(%rip)
+	rep movsq
+	.loc 1 466 25 view .LVU287
+.LVL25:
+	.loc 1 466 19 view .LVU288
+	.loc 1 468 1 is_stmt 0 view .LVU289
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	resetConf, .-resetConf
+	.section	.text.resetBarometerConfig,"ax",@progbits
+	.p2align 4
+	.globl	resetBarometerConfig
+	.type	resetBarometerConfig, @function
+resetBarometerConfig:
+.LVL26:
+.LFB2:
+	.loc 1 232 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 233 5 view .LVU291
+	.loc 1 234 37 is_stmt 0 view .LVU292
+	movq	.LC19(%rip), %rax
+	.loc 1 233 40 view .LVU293
+	movb	$21, (%rdi)
+	.loc 1 234 5 is_stmt 1 view .LVU294
+	.loc 1 235 5 view .LVU295
+	.loc 1 236 34 is_stmt 0 view .LVU296
+	movl	$0x3f770a3d, 12(%rdi)
+	.loc 1 234 37 view .LVU297
+	movq	%rax, 4(%rdi)
+	.loc 1 236 5 is_stmt 1 view .LVU298
+	.loc 1 237 1 is_stmt 0 view .LVU299
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	resetBarometerConfig, .-resetBarometerConfig
+	.section	.text.resetSensorAlignment,"ax",@progbits
+	.p2align 4
+	.globl	resetSensorAlignment
+	.type	resetSensorAlignment, @function
+resetSensorAlignment:
+.LVL27:
+.LFB3:
+	.loc 1 240 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 241 5 view .LVU301
+	.loc 1 242 5 view .LVU302
+	.loc 1 241 39 is_stmt 0 view .LVU303
+	movq	$0, (%rdi)
+	.loc 1 243 5 is_stmt 1 view .LVU304
+	.loc 1 243 38 is_stmt 0 view .LVU305
+	movl	$0, 8(%rdi)
+	.loc 1 244 1 view .LVU306
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	resetSensorAlignment, .-resetSensorAlignment
+	.section	.text.resetEscAndServoConfig,"ax",@progbits
+	.p2align 4
+	.globl	resetEscAndServoConfig
+	.type	resetEscAndServoConfig, @function
+resetEscAndServoConfig:
+.LVL28:
+.LFB4:
+	.loc 1 247 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 5 view .LVU308
+	.loc 1 249 5 view .LVU309
+	.loc 1 248 36 is_stmt 0 view .LVU310
+	movl	.LC26(%rip), %eax
+	movl	%eax, (%rdi)
+	.loc 1 250 5 is_stmt 1 view .LVU311
+	.loc 1 250 35 is_stmt 0 view .LVU312
+	movl	$1000, %eax
+	movw	%ax, 4(%rdi)
+	.loc 1 251 1 view .LVU313
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	resetEscAndServoConfig, .-resetEscAndServoConfig
+	.section	.text.resetFlight3DConfig,"ax",@progbits
+	.p2align 4
+	.globl	resetFlight3DConfig
+	.type	resetFlight3DConfig, @function
+resetFlight3DConfig:
+.LVL29:
+.LFB5:
+	.loc 1 254 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 255 5 view .LVU315
+	.loc 1 256 5 view .LVU316
+	.loc 1 257 5 view .LVU317
+	.loc 1 258 5 view .LVU318
+	.loc 1 255 36 is_stmt 0 view .LVU319
+	movq	.LC27(%rip), %rax
+	movq	%rax, (%rdi)
+	.loc 1 259 1 view .LVU320
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	resetFlight3DConfig, .-resetFlight3DConfig
+	.section	.text.resetTelemetryConfig,"ax",@progbits
+	.p2align 4
+	.globl	resetTelemetryConfig
+	.type	resetTelemetryConfig, @function
+resetTelemetryConfig:
+.LVL30:
+.LFB6:
+	.loc 1 262 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 263 5 view .LVU322
+	.loc 1 270 34 is_stmt 0 view .LVU323
+	xorl	%eax, %eax
+	.loc 1 263 41 view .LVU324
+	movl	$0, (%rdi)
+	.loc 1 264 5 is_stmt 1 view .LVU325
+	.loc 1 264 38 is_stmt 0 view .LVU326
+	movl	$0, 8(%rdi)
+	.loc 1 265 5 is_stmt 1 view .LVU327
+	.loc 1 265 39 is_stmt 0 view .LVU328
+	movb	$0, 4(%rdi)
+	.loc 1 266 5 is_stmt 1 view .LVU329
+	.loc 1 267 5 view .LVU330
+	.loc 1 266 39 is_stmt 0 view .LVU331
+	movq	$0, 12(%rdi)
+	.loc 1 268 5 is_stmt 1 view .LVU332
+	.loc 1 269 5 view .LVU333
+	.loc 1 268 46 is_stmt 0 view .LVU334
+	movq	$0, 20(%rdi)
+	.loc 1 270 5 is_stmt 1 view .LVU335
+	.loc 1 270 34 is_stmt 0 view .LVU336
+	movw	%ax, 28(%rdi)
+	.loc 1 271 1 view .LVU337
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	resetTelemetryConfig, .-resetTelemetryConfig
+	.section	.text.resetSerialConfig,"ax",@progbits
+	.p2align 4
+	.globl	resetSerialConfig
+	.type	resetSerialConfig, @function
+resetSerialConfig:
+.LVL31:
+.LFB7:
+	.loc 1 274 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 275 5 view .LVU339
+	.loc 1 274 1 is_stmt 0 view .LVU340
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 274 1 view .LVU341
+	movq	%rdi, %rbx
+	.loc 1 275 45 view .LVU342
+	movl	$39, %edi
+.LVL32:
+	.loc 1 275 45 view .LVU343
+	call	lookupScenarioIndex@PLT
+.LVL33:
+	.loc 1 276 45 view .LVU344
+	movl	$16, %edi
+	.loc 1 275 43 view .LVU345
+	movb	%al, (%rbx)
+	.loc 1 276 5 is_stmt 1 view .LVU346
+	.loc 1 276 45 is_stmt 0 view .LVU347
+	call	lookupScenarioIndex@PLT
+.LVL34:
+	.loc 1 287 32 view .LVU348
+	movdqa	.LC7(%rip), %xmm0
+	.loc 1 292 36 view .LVU349
+	movb	$82, 20(%rbx)
+	.loc 1 276 43 view .LVU350
+	movb	%al, 1(%rbx)
+	.loc 1 287 5 is_stmt 1 view .LVU351
+	.loc 1 288 5 view .LVU352
+	.loc 1 289 5 view .LVU353
+	.loc 1 290 5 view .LVU354
+	.loc 1 287 32 is_stmt 0 view .LVU355
+	movups	%xmm0, 4(%rbx)
+	.loc 1 292 5 is_stmt 1 view .LVU356
+	.loc 1 293 1 is_stmt 0 view .LVU357
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL35:
+	.loc 1 293 1 view .LVU358
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	resetSerialConfig, .-resetSerialConfig
+	.section	.text.activateConfig,"ax",@progbits
+	.p2align 4
+	.globl	activateConfig
+	.type	activateConfig, @function
+activateConfig:
+.LFB11:
+	.loc 1 477 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 478 5 view .LVU360
+	.loc 1 480 5 view .LVU361
+	.loc 1 477 1 is_stmt 0 view .LVU362
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 480 5 view .LVU363
+	movq	currentProfile(%rip), %rax
+	.loc 1 481 5 view .LVU364
+	leaq	208+masterConfig(%rip), %rbx
+	.loc 1 480 5 view .LVU365
+	leaq	84(%rax), %rdi
+	call	generatePitchCurve@PLT
+.LVL36:
+	.loc 1 481 5 is_stmt 1 view .LVU366
+	movq	currentProfile(%rip), %rax
+	movq	%rbx, %rsi
+	leaq	84(%rax), %rdi
+	call	generateThrottleCurve@PLT
+.LVL37:
+	.loc 1 482 5 view .LVU367
+	.loc 1 482 39 is_stmt 0 view .LVU368
+	movq	currentProfile(%rip), %rax
+	leaq	132(%rax), %rdi
+	.loc 1 482 5 view .LVU369
+	call	useRcControlsConfig@PLT
+.LVL38:
+	.loc 1 484 5 is_stmt 1 view .LVU370
+	leaq	52(%rbx), %rdi
+	call	useGyroConfig@PLT
+.LVL39:
+	.loc 1 488 5 view .LVU371
+	.loc 1 488 36 is_stmt 0 view .LVU372
+	movq	currentProfile(%rip), %rax
+	.loc 1 488 5 view .LVU373
+	movzbl	(%rax), %edi
+	call	setPIDController@PLT
+.LVL40:
+	.loc 1 493 5 is_stmt 1 view .LVU374
+	movq	currentProfile(%rip), %rax
+	leaq	524(%rax), %rdi
+	call	useFailsafeConfig@PLT
+.LVL41:
+	.loc 1 494 5 view .LVU375
+	leaq	62(%rbx), %rdi
+	call	setAccelerationTrims@PLT
+.LVL42:
+	.loc 1 495 5 view .LVU376
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	leaq	102(%rbx), %r9
+	movq	%rbx, %rdx
+	.loc 1 502 28 is_stmt 0 view .LVU377
+	movq	currentProfile(%rip), %rax
+	.loc 1 495 5 view .LVU378
+	leaq	127(%rbx), %r8
+	leaq	6(%rbx), %rsi
+	leaq	532(%rax), %rcx
+	.loc 1 496 27 view .LVU379
+	leaq	460(%rax), %rdi
+	.loc 1 495 5 view .LVU380
+	addq	$534, %rax
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	call	mixerUseConfigs@PLT
+.LVL43:
+	.loc 1 505 5 is_stmt 1 view .LVU381
+	.loc 1 506 5 view .LVU382
+	.loc 1 505 39 is_stmt 0 view .LVU383
+	movzwl	250+masterConfig(%rip), %eax
+	pxor	%xmm0, %xmm0
+	.loc 1 506 40 view .LVU384
+	pxor	%xmm1, %xmm1
+	.loc 1 510 49 view .LVU385
+	movq	currentProfile(%rip), %rsi
+	.loc 1 514 5 view .LVU386
+	leaq	imuRuntimeConfig.0(%rip), %rdi
+	.loc 1 505 39 view .LVU387
+	cvtsi2ssl	%eax, %xmm0
+	.loc 1 506 40 view .LVU388
+	movzwl	252+masterConfig(%rip), %eax
+	.loc 1 514 5 view .LVU389
+	leaq	108(%rsi), %rdx
+	addq	$4, %rsi
+	.loc 1 506 40 view .LVU390
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 507 41 view .LVU391
+	movzbl	254+masterConfig(%rip), %eax
+	movb	%al, 12+imuRuntimeConfig.0(%rip)
+	.loc 1 508 43 view .LVU392
+	movzwl	256+masterConfig(%rip), %eax
+	.loc 1 505 39 view .LVU393
+	unpcklps	%xmm1, %xmm0
+	movlps	%xmm0, 4+imuRuntimeConfig.0(%rip)
+	.loc 1 507 5 is_stmt 1 view .LVU394
+	.loc 1 508 5 view .LVU395
+	.loc 1 509 5 view .LVU396
+	.loc 1 508 43 is_stmt 0 view .LVU397
+	movd	%eax, %xmm0
+	.loc 1 509 43 view .LVU398
+	movzwl	258+masterConfig(%rip), %eax
+	.loc 1 508 51 view .LVU399
+	movd	%eax, %xmm2
+	.loc 1 510 33 view .LVU400
+	movzbl	96(%rsi), %eax
+	movb	124(%rsi), %ah
+	.loc 1 508 51 view .LVU401
+	punpckldq	%xmm2, %xmm0
+	.loc 1 510 33 view .LVU402
+	movw	%ax, imuRuntimeConfig.0(%rip)
+	.loc 1 512 34 view .LVU403
+	movzbl	334+masterConfig(%rip), %eax
+	.loc 1 508 51 view .LVU404
+	cvtdq2ps	%xmm0, %xmm0
+	divps	.LC30(%rip), %xmm0
+	.loc 1 508 29 view .LVU405
+	movlps	%xmm0, 16+imuRuntimeConfig.0(%rip)
+	.loc 1 510 5 is_stmt 1 view .LVU406
+	.loc 1 511 5 view .LVU407
+	.loc 1 511 70 view .LVU408
+	.loc 1 512 5 view .LVU409
+	.loc 1 512 34 is_stmt 0 view .LVU410
+	movb	%al, 24+imuRuntimeConfig.0(%rip)
+	.loc 1 514 5 is_stmt 1 view .LVU411
+	call	configureImu@PLT
+.LVL44:
+	.loc 1 515 5 view .LVU412
+	.loc 1 515 71 is_stmt 0 view .LVU413
+	movq	currentProfile(%rip), %rdi
+	.loc 1 515 5 view .LVU414
+	leaq	112(%rdi), %rsi
+	addq	$4, %rdi
+	call	configureAltitudeHold@PLT
+.LVL45:
+	.loc 1 517 5 is_stmt 1 view .LVU415
+	.loc 1 517 47 is_stmt 0 view .LVU416
+	movq	currentProfile(%rip), %rax
+	.loc 1 517 5 view .LVU417
+	movzwl	456(%rax), %edi
+	call	calculateThrottleAngleScale@PLT
+.LVL46:
+	.loc 1 518 5 is_stmt 1 view .LVU418
+	movq	currentProfile(%rip), %rax
+	movss	104(%rax), %xmm0
+	call	calculateAccZLowPassFilterRCTimeConstant@PLT
+.LVL47:
+	.loc 1 521 5 view .LVU419
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	movq	currentProfile(%rip), %rax
+	popq	%rdx
+	.cfi_def_cfa_offset 16
+	.loc 1 523 1 is_stmt 0 view .LVU420
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	.loc 1 521 5 view .LVU421
+	leaq	112(%rax), %rdi
+	jmp	useBarometerConfig@PLT
+.LVL48:
+	.cfi_endproc
+.LFE11:
+	.size	activateConfig, .-activateConfig
+	.section	.text.validateAndFixConfig,"ax",@progbits
+	.p2align 4
+	.globl	validateAndFixConfig
+	.type	validateAndFixConfig, @function
+validateAndFixConfig:
+.LFB12:
+	.loc 1 526 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 527 5 view .LVU423
+.LVL49:
+.LBB144:
+.LBI144:
+	.loc 1 711 5 view .LVU424
+.LBB145:
+	.loc 1 713 5 view .LVU425
+	.loc 1 713 24 is_stmt 0 view .LVU426
+	movl	4+masterConfig(%rip), %eax
+.LVL50:
+	.loc 1 713 24 view .LVU427
+.LBE145:
+.LBE144:
+	.loc 1 526 1 view .LVU428
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 527 9 view .LVU429
+	testl	$24585, %eax
+	je	.L30
+.L18:
+	.loc 1 531 5 is_stmt 1 view .LVU430
+.LVL51:
+.LBB146:
+.LBI146:
+	.loc 1 711 5 view .LVU431
+.LBB147:
+	.loc 1 713 5 view .LVU432
+	.loc 1 713 5 is_stmt 0 view .LVU433
+.LBE147:
+.LBE146:
+	.loc 1 531 8 view .LVU434
+	testb	$1, %al
+	je	.L19
+	.loc 1 532 9 is_stmt 1 view .LVU435
+.LVL52:
+.LBB148:
+.LBI148:
+	.loc 1 721 6 view .LVU436
+.LBB149:
+	.loc 1 723 5 view .LVU437
+	.loc 1 723 34 is_stmt 0 view .LVU438
+	andb	$-33, %ah
+	movl	%eax, 4+masterConfig(%rip)
+.LVL53:
+.L19:
+	.loc 1 723 34 view .LVU439
+.LBE149:
+.LBE148:
+	.loc 1 535 5 is_stmt 1 view .LVU440
+.LBB150:
+.LBI150:
+	.loc 1 711 5 view .LVU441
+.LBB151:
+	.loc 1 713 5 view .LVU442
+	.loc 1 713 5 is_stmt 0 view .LVU443
+.LBE151:
+.LBE150:
+	.loc 1 535 8 view .LVU444
+	testb	$64, %ah
+	jne	.L20
+	.loc 1 541 5 is_stmt 1 view .LVU445
+.LVL54:
+.LBB152:
+.LBI152:
+	.loc 1 711 5 view .LVU446
+.LBB153:
+	.loc 1 713 5 view .LVU447
+	.loc 1 713 5 is_stmt 0 view .LVU448
+.LBE153:
+.LBE152:
+	.loc 1 541 8 view .LVU449
+	testb	$8, %al
+	je	.L22
+	.loc 1 542 9 is_stmt 1 view .LVU450
+	.loc 1 543 9 view .LVU451
+.LVL55:
+.LBB155:
+.LBI155:
+	.loc 1 721 6 view .LVU452
+.LBB156:
+	.loc 1 723 5 view .LVU453
+	.loc 1 723 34 is_stmt 0 view .LVU454
+	andl	$-8194, %eax
+	movl	%eax, 4+masterConfig(%rip)
+.LVL56:
+	.loc 1 723 34 view .LVU455
+.LBE156:
+.LBE155:
+	.loc 1 546 5 is_stmt 1 view .LVU456
+.LBB157:
+.LBI157:
+	.loc 1 711 5 view .LVU457
+.LBB158:
+	.loc 1 713 5 view .LVU458
+.L24:
+	.loc 1 713 5 is_stmt 0 view .LVU459
+.LBE158:
+.LBE157:
+	.loc 1 583 5 is_stmt 1 view .LVU460
+	leaq	310+masterConfig(%rip), %rdi
+	.loc 1 586 5 is_stmt 0 view .LVU461
+	leaq	340+masterConfig(%rip), %rbx
+	.loc 1 583 5 view .LVU462
+	call	useRxConfig@PLT
+.LVL57:
+	.loc 1 585 5 is_stmt 1 view .LVU463
+	.loc 1 586 5 view .LVU464
+	movq	%rbx, %rdi
+	call	applySerialConfigToPortFunctions@PLT
+.LVL58:
+	.loc 1 588 5 view .LVU465
+	.loc 1 588 10 is_stmt 0 view .LVU466
+	movq	%rbx, %rdi
+	call	isSerialConfigValid@PLT
+.LVL59:
+	.loc 1 588 8 view .LVU467
+	testb	%al, %al
+	je	.L31
+	.loc 1 591 1 view .LVU468
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL60:
+	.loc 1 591 1 view .LVU469
+	ret
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.cfi_restore_state
+	.loc 1 536 9 is_stmt 1 view .LVU470
+	.loc 1 537 9 view .LVU471
+	.loc 1 538 9 view .LVU472
+.LBB160:
+.LBI160:
+	.loc 1 721 6 view .LVU473
+.LBB161:
+	.loc 1 723 5 view .LVU474
+	.loc 1 723 34 is_stmt 0 view .LVU475
+	andl	$-8202, %eax
+	movl	%eax, 4+masterConfig(%rip)
+.LVL62:
+	.loc 1 723 34 view .LVU476
+.LBE161:
+.LBE160:
+	.loc 1 541 5 is_stmt 1 view .LVU477
+.LBB162:
+	.loc 1 711 5 view .LVU478
+.LBB154:
+	.loc 1 713 5 view .LVU479
+.L22:
+	.loc 1 713 5 is_stmt 0 view .LVU480
+.LBE154:
+.LBE162:
+	.loc 1 546 5 is_stmt 1 view .LVU481
+.LBB163:
+	.loc 1 711 5 view .LVU482
+.LBB159:
+	.loc 1 713 5 view .LVU483
+	.loc 1 713 5 is_stmt 0 view .LVU484
+.LBE159:
+.LBE163:
+	.loc 1 546 8 view .LVU485
+	testb	$32, %ah
+	je	.L24
+	.loc 1 560 9 is_stmt 1 view .LVU486
+.LVL63:
+.LBB164:
+.LBI164:
+	.loc 1 721 6 view .LVU487
+.LBB165:
+	.loc 1 723 5 view .LVU488
+	.loc 1 723 34 is_stmt 0 view .LVU489
+	andl	$-65, %eax
+	movl	%eax, 4+masterConfig(%rip)
+	.loc 1 724 1 view .LVU490
+	jmp	.L24
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 724 1 view .LVU491
+.LBE165:
+.LBE164:
+	.loc 1 589 9 is_stmt 1 view .LVU492
+.LBB166:
+.LBI166:
+	.loc 1 273 6 view .LVU493
+.LBB167:
+	.loc 1 275 5 view .LVU494
+	.loc 1 275 45 is_stmt 0 view .LVU495
+	movl	$39, %edi
+	call	lookupScenarioIndex@PLT
+.LVL65:
+	.loc 1 276 45 view .LVU496
+	movl	$16, %edi
+	.loc 1 275 43 view .LVU497
+	movb	%al, 340+masterConfig(%rip)
+	.loc 1 276 5 is_stmt 1 view .LVU498
+	.loc 1 276 45 is_stmt 0 view .LVU499
+	call	lookupScenarioIndex@PLT
+.LVL66:
+	.loc 1 287 32 view .LVU500
+	movdqa	.LC7(%rip), %xmm0
+.LBE167:
+.LBE166:
+	.loc 1 591 1 view .LVU501
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL67:
+.LBB169:
+.LBB168:
+	.loc 1 292 36 view .LVU502
+	movb	$82, 360+masterConfig(%rip)
+	.loc 1 276 43 view .LVU503
+	movb	%al, 341+masterConfig(%rip)
+	.loc 1 287 5 is_stmt 1 view .LVU504
+	.loc 1 288 5 view .LVU505
+	.loc 1 289 5 view .LVU506
+	.loc 1 290 5 view .LVU507
+	.loc 1 287 32 is_stmt 0 view .LVU508
+	movups	%xmm0, 344+masterConfig(%rip)
+	.loc 1 292 5 is_stmt 1 view .LVU509
+.LVL68:
+	.loc 1 292 5 is_stmt 0 view .LVU510
+.LBE168:
+.LBE169:
+	.loc 1 591 1 view .LVU511
+	ret
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	.loc 1 528 9 is_stmt 1 view .LVU512
+.LBB170:
+.LBI170:
+	.loc 1 716 6 view .LVU513
+.LBB171:
+	.loc 1 718 5 view .LVU514
+	.loc 1 718 34 is_stmt 0 view .LVU515
+	orb	$32, %ah
+	movl	%eax, 4+masterConfig(%rip)
+	.loc 1 719 1 view .LVU516
+	jmp	.L18
+.LBE171:
+.LBE170:
+	.cfi_endproc
+.LFE12:
+	.size	validateAndFixConfig, .-validateAndFixConfig
+	.section	.text.initEEPROM,"ax",@progbits
+	.p2align 4
+	.globl	initEEPROM
+	.type	initEEPROM, @function
+initEEPROM:
+.LFB13:
+	.loc 1 594 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 596 5 view .LVU518
+	.loc 1 597 5 view .LVU519
+	.loc 1 599 5 view .LVU520
+	.loc 1 594 1 is_stmt 0 view .LVU521
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 599 5 view .LVU522
+	movl	$131858522, %r8d
+	movl	$2048, %ecx
+	movl	$4096, %edx
+	pushq	$2012
+	.cfi_def_cfa_offset 24
+	leaq	configSections(%rip), %r9
+	leaq	sitlFlash(%rip), %rsi
+	pushq	$14
+	.cfi_def_cfa_offset 32
+	leaq	configStorage(%rip), %rdi
+	call	configStorageInit@PLT
+.LVL70:
+	.loc 1 601 1 view .LVU523
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	initEEPROM, .-initEEPROM
+	.section	.text.readEEPROM,"ax",@progbits
+	.p2align 4
+	.globl	readEEPROM
+	.type	readEEPROM, @function
+readEEPROM:
+.LFB15:
+	.loc 1 616 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 618 5 view .LVU525
+.LBB178:
+.LBI178:
+	.loc 1 471 12 view .LVU526
+.LBB179:
+	.loc 1 473 5 view .LVU527
+.LBE179:
+.LBE178:
+	.loc 1 616 1 is_stmt 0 view .LVU528
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB183:
+.LBB180:
+	.loc 1 473 12 view .LVU529
+	leaq	configStorage(%rip), %rbp
+.LBE180:
+.LBE183:
+	.loc 1 616 1 view .LVU530
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+.LBB184:
+.LBB181:
+	.loc 1 473 12 view .LVU531
+	movq	%rbp, %rdi
+.LBE181:
+.LBE184:
+	.loc 1 616 1 view .LVU532
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB185:
+.LBB182:
+	.loc 1 473 12 view .LVU533
+	call	configStorageStoredSectionCount@PLT
+.LVL71:
+.LBE182:
+.LBE185:
+	.loc 1 618 8 view .LVU534
+	cmpb	$14, %al
+	je	.L35
+	.loc 1 619 9 is_stmt 1 view .LVU535
+	movl	$10, %edi
+	call	failureMode@PLT
+.LVL72:
+.L35:
+	.loc 1 622 5 view .LVU536
+	leaq	masterConfig(%rip), %rbx
+	movq	%rbp, %rdi
+	movq	%rbx, %rsi
+	call	configStorageLoad@PLT
+.LVL73:
+	.loc 1 624 5 view .LVU537
+.LBB186:
+.LBI186:
+	.loc 1 603 13 view .LVU538
+.LBB187:
+	.loc 1 606 5 view .LVU539
+	.loc 1 606 21 is_stmt 0 view .LVU540
+	movzbl	2008+masterConfig(%rip), %eax
+	.loc 1 606 8 view .LVU541
+	cmpb	$2, %al
+	ja	.L36
+	imulq	$536, %rax, %rax
+	addq	$400, %rax
+.L37:
+	.loc 1 609 5 is_stmt 1 view .LVU542
+.LVL74:
+.LBB188:
+.LBI188:
+	.loc 1 296 13 view .LVU543
+.LBB189:
+	.loc 1 298 5 view .LVU544
+	.loc 1 298 22 is_stmt 0 view .LVU545
+	addq	%rax, %rbx
+	movq	%rbx, currentProfile(%rip)
+.LVL75:
+	.loc 1 298 22 view .LVU546
+.LBE189:
+.LBE188:
+	.loc 1 611 5 is_stmt 1 view .LVU547
+	call	validateAndFixConfig
+.LVL76:
+	.loc 1 612 5 view .LVU548
+.LBE187:
+.LBE186:
+	.loc 1 625 1 is_stmt 0 view .LVU549
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LBB191:
+.LBB190:
+	.loc 1 612 5 view .LVU550
+	jmp	activateConfig
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.cfi_restore_state
+	.loc 1 607 9 is_stmt 1 view .LVU551
+	.loc 1 607 44 is_stmt 0 view .LVU552
+	movb	$0, 2008+masterConfig(%rip)
+	movl	$400, %eax
+	jmp	.L37
+.LBE190:
+.LBE191:
+	.cfi_endproc
+.LFE15:
+	.size	readEEPROM, .-readEEPROM
+	.section	.text.readEEPROMAndNotify,"ax",@progbits
+	.p2align 4
+	.globl	readEEPROMAndNotify
+	.type	readEEPROMAndNotify, @function
+readEEPROMAndNotify:
+.LFB16:
+	.loc 1 628 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 630 5 view .LVU554
+	.loc 1 628 1 is_stmt 0 view .LVU555
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 630 5 view .LVU556
+	call	readEEPROM
+.LVL78:
+	.loc 1 631 5 is_stmt 1 view .LVU557
+	movl	$1, %edx
+	movl	$20, %esi
+	movl	$15, %edi
+	.loc 1 632 1 is_stmt 0 view .LVU558
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 631 5 view .LVU559
+	jmp	blinkLedAndSoundBeeper@PLT
+.LVL79:
+	.cfi_endproc
+.LFE16:
+	.size	readEEPROMAndNotify, .-readEEPROMAndNotify
+	.section	.text.writeEEPROM,"ax",@progbits
+	.p2align 4
+	.globl	writeEEPROM
+	.type	writeEEPROM, @function
+writeEEPROM:
+.LFB17:
+	.loc 1 635 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 636 5 view .LVU561
+	.loc 1 635 1 is_stmt 0 view .LVU562
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 636 5 view .LVU563
+	leaq	configStorage(%rip), %rbx
+	leaq	masterConfig(%rip), %rsi
+	movq	%rbx, %rdi
+	call	configStorageStartSave@PLT
+.LVL80:
+	.loc 1 637 5 is_stmt 1 view .LVU564
+	.loc 1 637 11 is_stmt 0 view .LVU565
+	jmp	.L45
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.loc 1 638 9 is_stmt 1 view .LVU566
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	configStorageProcess@PLT
+.LVL81:
+.L45:
+	.loc 1 637 12 view .LVU567
+	movq	%rbx, %rdi
+	call	configStorageIsSaving@PLT
+.LVL82:
+	testb	%al, %al
+	jne	.L46
+	.loc 1 642 5 view .LVU568
+	.loc 1 642 8 is_stmt 0 view .LVU569
+	cmpl	$3, 176+configStorage(%rip)
+	je	.L48
+.LBB192:
+.LBI192:
+	.loc 1 471 12 is_stmt 1 view .LVU570
+.LBB193:
+	.loc 1 473 5 view .LVU571
+	.loc 1 473 12 is_stmt 0 view .LVU572
+	movq	%rbx, %rdi
+	call	configStorageStoredSectionCount@PLT
+.LVL83:
+.LBE193:
+.LBE192:
+	.loc 1 642 54 view .LVU573
+	cmpb	$14, %al
+	je	.L50
+.L48:
+	.loc 1 643 9 is_stmt 1 view .LVU574
+	movl	$10, %edi
+	.loc 1 645 1 is_stmt 0 view .LVU575
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 643 9 view .LVU576
+	jmp	failureMode@PLT
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.cfi_restore_state
+	.loc 1 645 1 view .LVU577
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	writeEEPROM, .-writeEEPROM
+	.section	.text.requestEEPROMWrite,"ax",@progbits
+	.p2align 4
+	.globl	requestEEPROMWrite
+	.type	requestEEPROMWrite, @function
+requestEEPROMWrite:
+.LFB18:
+	.loc 1 649 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 650 5 view .LVU579
+	leaq	masterConfig(%rip), %rsi
+	leaq	configStorage(%rip), %rdi
+	jmp	configStorageStartSave@PLT
+.LVL85:
+	.cfi_endproc
+.LFE18:
+	.size	requestEEPROMWrite, .-requestEEPROMWrite
+	.section	.text.isEEPROMWritePending,"ax",@progbits
+	.p2align 4
+	.globl	isEEPROMWritePending
+	.type	isEEPROMWritePending, @function
+isEEPROMWritePending:
+.LFB19:
+	.loc 1 655 1 view -0
+	.cfi_startproc
+	.loc 1 656 4 view .LVU581
+	.loc 1 656 9 is_stmt 0 view .LVU582
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 658 26 view .LVU583
+	movl	176+configStorage(%rip), %edx
+	.loc 1 656 9 view .LVU584
+	shrb	$2, %al
+	xorl	$1, %eax
+	andl	$1, %eax
+.LVL86:
+	.loc 1 658 5 is_stmt 1 view .LVU585
+	cmpl	$1, %edx
+	je	.L52
+	cmpl	$2, %edx
+	je	.L54
+	testl	%edx, %edx
+	je	.L59
+	.loc 1 668 11 is_stmt 0 view .LVU586
+	xorl	%eax, %eax
+.LVL87:
+.L52:
+	.loc 1 669 1 view .LVU587
+	ret
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 658 5 view .LVU588
+	movl	$1, %eax
+.LVL89:
+	.loc 1 658 5 view .LVU589
+	ret
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.loc 1 660 13 is_stmt 1 view .LVU590
+	.loc 1 660 47 is_stmt 0 view .LVU591
+	movzbl	180+configStorage(%rip), %edx
+	xorl	$1, %edx
+	andl	%edx, %eax
+.LVL91:
+	.loc 1 660 47 view .LVU592
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	isEEPROMWritePending, .-isEEPROMWritePending
+	.section	.text.processEEPROMWrite,"ax",@progbits
+	.p2align 4
+	.globl	processEEPROMWrite
+	.type	processEEPROMWrite, @function
+processEEPROMWrite:
+.LFB20:
+	.loc 1 673 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 674 5 view .LVU594
+	movzbl	armingFlags(%rip), %esi
+	leaq	configStorage(%rip), %rdi
+	shrb	$2, %sil
+	xorl	$1, %esi
+	andl	$1, %esi
+	jmp	configStorageProcess@PLT
+.LVL92:
+	.cfi_endproc
+.LFE20:
+	.size	processEEPROMWrite, .-processEEPROMWrite
+	.section	.text.ensureEEPROMContainsValidData,"ax",@progbits
+	.p2align 4
+	.globl	ensureEEPROMContainsValidData
+	.type	ensureEEPROMContainsValidData, @function
+ensureEEPROMContainsValidData:
+.LFB21:
+	.loc 1 679 1 view -0
+	.cfi_startproc
+	.loc 1 680 5 view .LVU596
+.LBB194:
+.LBI194:
+	.loc 1 471 12 view .LVU597
+.LBB195:
+	.loc 1 473 5 view .LVU598
+.LBE195:
+.LBE194:
+	.loc 1 679 1 is_stmt 0 view .LVU599
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB197:
+.LBB196:
+	.loc 1 473 12 view .LVU600
+	leaq	configStorage(%rip), %rbx
+	movq	%rbx, %rdi
+	call	configStorageStoredSectionCount@PLT
+.LVL93:
+.LBE196:
+.LBE197:
+	.loc 1 680 8 view .LVU601
+	cmpb	$14, %al
+	je	.L61
+	.loc 1 684 5 is_stmt 1 view .LVU602
+	call	resetConf
+.LVL94:
+	.loc 1 685 5 view .LVU603
+	movq	%rbx, %rdi
+	leaq	masterConfig(%rip), %rsi
+	call	configStorageLoad@PLT
+.LVL95:
+	.loc 1 686 5 view .LVU604
+	.loc 1 687 1 is_stmt 0 view .LVU605
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 686 5 view .LVU606
+	jmp	writeEEPROM
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.cfi_restore_state
+	.loc 1 687 1 view .LVU607
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	ensureEEPROMContainsValidData, .-ensureEEPROMContainsValidData
+	.section	.text.resetEEPROM,"ax",@progbits
+	.p2align 4
+	.globl	resetEEPROM
+	.type	resetEEPROM, @function
+resetEEPROM:
+.LFB22:
+	.loc 1 690 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 691 5 view .LVU609
+	.loc 1 690 1 is_stmt 0 view .LVU610
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 691 5 view .LVU611
+	call	resetConf
+.LVL97:
+	.loc 1 692 5 is_stmt 1 view .LVU612
+	.loc 1 693 1 is_stmt 0 view .LVU613
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 692 5 view .LVU614
+	jmp	writeEEPROM
+.LVL98:
+	.cfi_endproc
+.LFE22:
+	.size	resetEEPROM, .-resetEEPROM
+	.section	.text.saveConfigAndNotify,"ax",@progbits
+	.p2align 4
+	.globl	saveConfigAndNotify
+	.type	saveConfigAndNotify, @function
+saveConfigAndNotify:
+.LFB23:
+	.loc 1 697 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 698 5 view .LVU616
+.LBB204:
+.LBI204:
+	.loc 1 603 13 view .LVU617
+.LBB205:
+	.loc 1 606 5 view .LVU618
+	.loc 1 606 21 is_stmt 0 view .LVU619
+	movzbl	2008+masterConfig(%rip), %eax
+.LBE205:
+.LBE204:
+	.loc 1 697 1 view .LVU620
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB210:
+.LBB208:
+	.loc 1 606 8 view .LVU621
+	cmpb	$2, %al
+	ja	.L67
+	imulq	$536, %rax, %rax
+	addq	$400, %rax
+.L68:
+	.loc 1 609 5 is_stmt 1 view .LVU622
+.LVL99:
+.LBB206:
+.LBI206:
+	.loc 1 296 13 view .LVU623
+.LBB207:
+	.loc 1 298 5 view .LVU624
+	.loc 1 298 22 is_stmt 0 view .LVU625
+	leaq	masterConfig(%rip), %rbx
+	addq	%rbx, %rax
+	movq	%rax, currentProfile(%rip)
+.LVL100:
+	.loc 1 298 22 view .LVU626
+.LBE207:
+.LBE206:
+	.loc 1 611 5 is_stmt 1 view .LVU627
+	call	validateAndFixConfig
+.LVL101:
+	.loc 1 612 5 view .LVU628
+	call	activateConfig
+.LVL102:
+.LBE208:
+.LBE210:
+	.loc 1 699 5 view .LVU629
+.LBB211:
+.LBI211:
+	.loc 1 648 6 view .LVU630
+.LBB212:
+	.loc 1 650 5 view .LVU631
+	movq	%rbx, %rsi
+	leaq	configStorage(%rip), %rdi
+	call	configStorageStartSave@PLT
+.LVL103:
+.LBE212:
+.LBE211:
+	.loc 1 700 5 view .LVU632
+	movl	$1, %edx
+	movl	$20, %esi
+	.loc 1 701 1 is_stmt 0 view .LVU633
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 700 5 view .LVU634
+	movl	$15, %edi
+	jmp	blinkLedAndSoundBeeper@PLT
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.cfi_restore_state
+.LBB213:
+.LBB209:
+	.loc 1 607 9 is_stmt 1 view .LVU635
+	.loc 1 607 44 is_stmt 0 view .LVU636
+	movb	$0, 2008+masterConfig(%rip)
+	movl	$400, %eax
+	jmp	.L68
+.LBE209:
+.LBE213:
+	.cfi_endproc
+.LFE23:
+	.size	saveConfigAndNotify, .-saveConfigAndNotify
+	.section	.text.changeProfile,"ax",@progbits
+	.p2align 4
+	.globl	changeProfile
+	.type	changeProfile, @function
+changeProfile:
+.LVL105:
+.LFB24:
+	.loc 1 704 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 705 5 view .LVU638
+	.loc 1 704 1 is_stmt 0 view .LVU639
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 704 1 view .LVU640
+	movl	%edi, %ebx
+	.loc 1 705 40 view .LVU641
+	movb	%dil, 2008+masterConfig(%rip)
+	.loc 1 706 5 is_stmt 1 view .LVU642
+	call	writeEEPROM
+.LVL106:
+	.loc 1 707 5 view .LVU643
+	call	readEEPROM
+.LVL107:
+	.loc 1 708 5 view .LVU644
+	.loc 1 708 48 is_stmt 0 view .LVU645
+	leal	1(%rbx), %edx
+	.loc 1 708 5 view .LVU646
+	movl	$40, %esi
+	.loc 1 709 1 view .LVU647
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	.loc 1 708 5 view .LVU648
+	movzbl	%dl, %edx
+	movl	$2, %edi
+	jmp	blinkLedAndSoundBeeper@PLT
+.LVL108:
+	.cfi_endproc
+.LFE24:
+	.size	changeProfile, .-changeProfile
+	.section	.text.feature,"ax",@progbits
+	.p2align 4
+	.globl	feature
+	.type	feature, @function
+feature:
+.LVL109:
+.LFB25:
+	.loc 1 712 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 713 5 view .LVU650
+	.loc 1 713 41 is_stmt 0 view .LVU651
+	andl	4+masterConfig(%rip), %edi
+.LVL110:
+	.loc 1 713 41 view .LVU652
+	setne	%al
+	.loc 1 714 1 view .LVU653
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	feature, .-feature
+	.section	.text.featureSet,"ax",@progbits
+	.p2align 4
+	.globl	featureSet
+	.type	featureSet, @function
+featureSet:
+.LVL111:
+.LFB26:
+	.loc 1 717 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 718 5 view .LVU655
+	.loc 1 718 34 is_stmt 0 view .LVU656
+	orl	%edi, 4+masterConfig(%rip)
+	.loc 1 719 1 view .LVU657
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	featureSet, .-featureSet
+	.section	.text.featureClear,"ax",@progbits
+	.p2align 4
+	.globl	featureClear
+	.type	featureClear, @function
+featureClear:
+.LVL112:
+.LFB27:
+	.loc 1 722 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 723 5 view .LVU659
+	.loc 1 723 37 is_stmt 0 view .LVU660
+	notl	%edi
+.LVL113:
+	.loc 1 723 34 view .LVU661
+	andl	%edi, 4+masterConfig(%rip)
+	.loc 1 724 1 view .LVU662
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	featureClear, .-featureClear
+	.section	.text.featureClearAll,"ax",@progbits
+	.p2align 4
+	.globl	featureClearAll
+	.type	featureClearAll, @function
+featureClearAll:
+.LFB28:
+	.loc 1 727 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 728 5 view .LVU664
+	.loc 1 728 34 is_stmt 0 view .LVU665
+	movl	$0, 4+masterConfig(%rip)
+	.loc 1 729 1 view .LVU666
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	featureClearAll, .-featureClearAll
+	.section	.text.featureMask,"ax",@progbits
+	.p2align 4
+	.globl	featureMask
+	.type	featureMask, @function
+featureMask:
+.LFB29:
+	.loc 1 732 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 733 5 view .LVU668
+	.loc 1 734 1 is_stmt 0 view .LVU669
+	movl	4+masterConfig(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	featureMask, .-featureMask
+	.section	.bss.imuRuntimeConfig.0,"aw",@nobits
+	.align 16
+	.type	imuRuntimeConfig.0, @object
+	.size	imuRuntimeConfig.0, 28
+imuRuntimeConfig.0:
+	.zero	28
+	.section	.bss.configStorage,"aw",@nobits
+	.align 32
+	.type	configStorage, @object
+	.size	configStorage, 344
+configStorage:
+	.zero	344
+	.section	.rodata.configSections,"a"
+	.align 32
+	.type	configSections, @object
+	.size	configSections, 56
+configSections:
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	1
+	.zero	1
+	.value	16
+	.byte	2
+	.zero	1
+	.value	208
+	.byte	3
+	.zero	1
+	.value	228
+	.byte	4
+	.zero	1
+	.value	270
+	.byte	5
+	.zero	1
+	.value	300
+	.byte	6
+	.zero	1
+	.value	310
+	.byte	7
+	.zero	1
+	.value	335
+	.byte	9
+	.zero	1
+	.value	340
+	.byte	10
+	.zero	1
+	.value	364
+	.byte	12
+	.zero	1
+	.value	400
+	.byte	13
+	.zero	1
+	.value	936
+	.byte	14
+	.zero	1
+	.value	1472
+	.byte	15
+	.zero	1
+	.value	2008
+	.comm	currentProfile,8,8
+	.comm	masterConfig,2012,32
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.value	2500
+	.value	50
+	.align 4
+.LC1:
+	.value	42
+	.value	600
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC2:
+	.byte	110
+	.byte	43
+	.section	.rodata.cst4
+	.align 4
+.LC3:
+	.value	1500
+	.value	1100
+	.section	.rodata.cst2
+	.align 2
+.LC4:
+	.byte	1
+	.byte	25
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC5:
+	.value	1150
+	.value	1850
+	.value	1000
+	.value	1406
+	.value	1514
+	.value	1460
+	.value	50
+	.value	400
+	.section	.rodata.cst4
+	.align 4
+.LC6:
+	.value	600
+	.value	50
+	.section	.rodata.cst16
+	.align 16
+.LC7:
+	.long	115200
+	.long	115200
+	.long	115200
+	.long	115200
+	.section	.rodata.cst4
+	.align 4
+.LC8:
+	.byte	0
+	.byte	1
+	.byte	1
+	.byte	0
+	.section	.rodata.cst2
+	.align 2
+.LC9:
+	.byte	20
+	.byte	10
+	.section	.rodata.cst16
+	.align 16
+.LC10:
+	.byte	40
+	.byte	40
+	.byte	85
+	.byte	50
+	.byte	11
+	.byte	20
+	.byte	14
+	.byte	90
+	.byte	40
+	.byte	120
+	.byte	30
+	.byte	30
+	.byte	45
+	.byte	0
+	.byte	0
+	.byte	8
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.byte	45
+	.byte	23
+	.byte	23
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	45
+	.byte	80
+	.section	.rodata.cst16
+	.align 16
+.LC12:
+	.long	1075838976
+	.long	1075838976
+	.long	1090519040
+	.long	1058642330
+	.align 16
+.LC13:
+	.long	1058642330
+	.long	1056964608
+	.long	1031127695
+	.long	1031127695
+	.section	.rodata.cst8
+	.align 8
+.LC14:
+	.long	1028443341
+	.long	1084227584
+	.section	.rodata.cst4
+	.align 4
+.LC16:
+	.byte	90
+	.byte	65
+	.byte	50
+	.byte	0
+	.set	.LC18,.LC10
+	.section	.rodata.cst8
+	.align 8
+.LC19:
+	.long	1058642330
+	.long	1065101558
+	.section	.rodata.cst4
+	.align 4
+.LC22:
+	.byte	0
+	.byte	0
+	.byte	40
+	.byte	1
+	.align 4
+.LC23:
+	.value	1020
+	.value	2000
+	.section	.rodata.cst2
+	.align 2
+.LC24:
+	.byte	1
+	.byte	1
+	.set	.LC26,.LC5
+	.section	.rodata.cst8
+	.align 8
+.LC27:
+	.value	1406
+	.value	1514
+	.value	1460
+	.value	50
+	.section	.rodata.cst16
+	.align 16
+.LC30:
+	.long	1176256512
+	.long	1176256512
+	.long	1065353216
+	.long	1065353216
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "/usr/include/stdint.h"
+	.file 7 ".//src/main/common/color.h"
+	.file 8 ".//src/main/flight/flight.h"
+	.file 9 ".//src/main/drivers/pwm_rx.h"
+	.file 10 ".//src/main/sensors/sensors.h"
+	.file 11 ".//src/main/sensors/gyro.h"
+	.file 12 ".//src/main/sensors/acceleration.h"
+	.file 13 ".//src/main/sensors/barometer.h"
+	.file 14 ".//src/main/drivers/serial.h"
+	.file 15 ".//src/main/io/serial.h"
+	.file 16 ".//src/main/telemetry/telemetry.h"
+	.file 17 ".//src/main/flight/mixer.h"
+	.file 18 ".//src/main/sensors/boardalignment.h"
+	.file 19 ".//src/main/sensors/battery.h"
+	.file 20 ".//src/main/io/gimbal.h"
+	.file 21 ".//src/main/io/escservo.h"
+	.file 22 ".//src/main/rx/rx.h"
+	.file 23 ".//src/main/io/rc_controls.h"
+	.file 24 ".//src/main/flight/failsafe.h"
+	.file 25 ".//src/main/flight/imu.h"
+	.file 26 ".//src/main/config/runtime_config.h"
+	.file 27 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 28 ".//src/main/config/config.h"
+	.file 29 ".//src/main/config/config_profile.h"
+	.file 30 ".//src/main/config/config_master.h"
+	.file 31 ".//src/main/config/config_storage.h"
+	.file 32 "/usr/include/string.h"
+	.file 33 ".//src/main/io/statusindicator.h"
+	.file 34 ".//src/main/drivers/system.h"
+	.file 35 ".//src/main/flight/altitudehold.h"
+	.file 36 ".//src/main/io/rc_curves.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x25ad
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF1408
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL37
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF913
+	.uleb128 0x4
+	.long	.LASF918
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF914
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF915
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF916
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF917
+	.uleb128 0x4
+	.long	.LASF919
+	.byte	0x3
+	.byte	0x25
+	.byte	0x15
+	.long	0x70
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF920
+	.uleb128 0x4
+	.long	.LASF921
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x4
+	.long	.LASF922
+	.byte	0x3
+	.byte	0x27
+	.byte	0x1a
+	.long	0x8f
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF923
+	.uleb128 0x4
+	.long	.LASF924
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x56
+	.uleb128 0x4
+	.long	.LASF925
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x48
+	.uleb128 0x4
+	.long	.LASF926
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF927
+	.uleb128 0x1d
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF928
+	.byte	0x4
+	.byte	0x18
+	.byte	0x12
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF929
+	.byte	0x4
+	.byte	0x19
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF930
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x13
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF931
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x1d
+	.long	0xec
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0x5
+	.byte	0x19
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF933
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0xae
+	.uleb128 0x4
+	.long	.LASF934
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x41
+	.uleb128 0x7
+	.long	0xc3
+	.uleb128 0xe
+	.long	0xec
+	.long	0x131
+	.uleb128 0x31
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1215
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0x10
+	.long	0x126
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x7
+	.byte	0x15
+	.long	0x15b
+	.uleb128 0x1
+	.long	.LASF935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF936
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF937
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x8
+	.byte	0x15
+	.long	0x1a9
+	.uleb128 0x1
+	.long	.LASF938
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF939
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF940
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF941
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF942
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF945
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF946
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF947
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF948
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF954
+	.byte	0x50
+	.byte	0x8
+	.byte	0x23
+	.long	0x228
+	.uleb128 0xf
+	.string	"P8"
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0x228
+	.byte	0
+	.uleb128 0xf
+	.string	"I8"
+	.byte	0x8
+	.byte	0x25
+	.byte	0xd
+	.long	0x228
+	.byte	0xa
+	.uleb128 0xf
+	.string	"D8"
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0x228
+	.byte	0x14
+	.uleb128 0xf
+	.string	"P_f"
+	.byte	0x8
+	.byte	0x28
+	.byte	0xb
+	.long	0x238
+	.byte	0x20
+	.uleb128 0xf
+	.string	"I_f"
+	.byte	0x8
+	.byte	0x29
+	.byte	0xb
+	.long	0x238
+	.byte	0x2c
+	.uleb128 0xf
+	.string	"D_f"
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xb
+	.long	0x238
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF949
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xb
+	.long	0x248
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF950
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xb
+	.long	0x248
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF951
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0xec
+	.byte	0x4c
+	.byte	0
+	.uleb128 0xe
+	.long	0xec
+	.long	0x238
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x9
+	.byte	0
+	.uleb128 0xe
+	.long	0x248
+	.long	0x248
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x2
+	.byte	0
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF952
+	.uleb128 0x4
+	.long	.LASF953
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x1a9
+	.uleb128 0x8
+	.long	.LASF955
+	.byte	0x6
+	.byte	0x8
+	.byte	0x57
+	.long	0x28f
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x8
+	.byte	0x58
+	.byte	0xd
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF957
+	.byte	0x8
+	.byte	0x59
+	.byte	0xd
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0xf
+	.string	"yaw"
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xd
+	.long	0xd4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF958
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x3
+	.long	0x25b
+	.uleb128 0x25
+	.byte	0x6
+	.byte	0x5d
+	.long	0x2b8
+	.uleb128 0x26
+	.string	"raw"
+	.byte	0x5e
+	.long	0x2b8
+	.uleb128 0x27
+	.long	.LASF959
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x28f
+	.byte	0
+	.uleb128 0xe
+	.long	0xd4
+	.long	0x2c8
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF960
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x29b
+	.uleb128 0x8
+	.long	.LASF961
+	.byte	0x4
+	.byte	0x8
+	.byte	0x62
+	.long	0x2fb
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x8
+	.byte	0x63
+	.byte	0xd
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF957
+	.byte	0x8
+	.byte	0x64
+	.byte	0xd
+	.long	0xd4
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF962
+	.byte	0x8
+	.byte	0x65
+	.byte	0x3
+	.long	0x2d4
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x67
+	.long	0x324
+	.uleb128 0x26
+	.string	"raw"
+	.byte	0x68
+	.long	0x324
+	.uleb128 0x27
+	.long	.LASF959
+	.byte	0x69
+	.byte	0x1d
+	.long	0x2fb
+	.byte	0
+	.uleb128 0xe
+	.long	0xd4
+	.long	0x334
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF963
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x3
+	.long	0x307
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x9
+	.byte	0x14
+	.long	0x358
+	.uleb128 0x1
+	.long	.LASF964
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF965
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF966
+	.byte	0x9
+	.byte	0x17
+	.byte	0x3
+	.long	0x340
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0xa
+	.byte	0x26
+	.long	0x3a6
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF971
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF974
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF975
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF976
+	.byte	0xa
+	.byte	0x30
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x8
+	.long	.LASF977
+	.byte	0xc
+	.byte	0xa
+	.byte	0x32
+	.long	0x3e6
+	.uleb128 0x2
+	.long	.LASF978
+	.byte	0xa
+	.byte	0x33
+	.byte	0x14
+	.long	0x3a6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF979
+	.byte	0xa
+	.byte	0x34
+	.byte	0x14
+	.long	0x3a6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF980
+	.byte	0xa
+	.byte	0x35
+	.byte	0x14
+	.long	0x3a6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF981
+	.byte	0xa
+	.byte	0x36
+	.byte	0x3
+	.long	0x3b2
+	.uleb128 0x8
+	.long	.LASF982
+	.byte	0x10
+	.byte	0xa
+	.byte	0x39
+	.long	0x44d
+	.uleb128 0x2
+	.long	.LASF983
+	.byte	0xa
+	.byte	0x3a
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF984
+	.byte	0xa
+	.byte	0x3b
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF985
+	.byte	0xa
+	.byte	0x3c
+	.byte	0xd
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF986
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xd
+	.long	0xec
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF987
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2b8
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF988
+	.byte	0xa
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe0
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF989
+	.byte	0xa
+	.byte	0x40
+	.byte	0x3
+	.long	0x3f2
+	.uleb128 0x8
+	.long	.LASF990
+	.byte	0x8
+	.byte	0xb
+	.byte	0x24
+	.long	0x49a
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0xb
+	.byte	0x26
+	.byte	0xe
+	.long	0xfd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF993
+	.byte	0xb
+	.byte	0x27
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF994
+	.byte	0xb
+	.byte	0x28
+	.byte	0xe
+	.long	0xfd
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF995
+	.byte	0xb
+	.byte	0x29
+	.byte	0x3
+	.long	0x459
+	.uleb128 0x20
+	.long	.LASF1066
+	.long	0x5d
+	.byte	0xc
+	.byte	0x15
+	.long	0x4f2
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF998
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF999
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1000
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1005
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1006
+	.byte	0x2
+	.byte	0xc
+	.byte	0x27
+	.long	0x516
+	.uleb128 0xf
+	.string	"xy"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0xf
+	.string	"z"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1007
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x3
+	.long	0x4f2
+	.uleb128 0x8
+	.long	.LASF1008
+	.byte	0x10
+	.byte	0xd
+	.byte	0x1f
+	.long	0x563
+	.uleb128 0x2
+	.long	.LASF1009
+	.byte	0xd
+	.byte	0x20
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1010
+	.byte	0xd
+	.byte	0x21
+	.byte	0xb
+	.long	0x248
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1011
+	.byte	0xd
+	.byte	0x22
+	.byte	0xb
+	.long	0x248
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1012
+	.byte	0xd
+	.byte	0x23
+	.byte	0xb
+	.long	0x248
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1013
+	.byte	0xd
+	.byte	0x24
+	.byte	0x3
+	.long	0x522
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0xe
+	.byte	0x16
+	.long	0x587
+	.uleb128 0x1
+	.long	.LASF1014
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1015
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1016
+	.byte	0xe
+	.byte	0x19
+	.byte	0x3
+	.long	0x56f
+	.uleb128 0x7
+	.long	0xf8
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1017
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0xf
+	.byte	0x14
+	.long	0x5db
+	.uleb128 0x1
+	.long	.LASF1018
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1019
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1020
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1021
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1022
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1023
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1024
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1025
+	.byte	0x40
+	.byte	0
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0xf
+	.byte	0x2c
+	.long	0x623
+	.uleb128 0x1
+	.long	.LASF1026
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1027
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1028
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1029
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1030
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1031
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1032
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1033
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1034
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1035
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1036
+	.byte	0xf
+	.byte	0x38
+	.byte	0x3
+	.long	0x5db
+	.uleb128 0x8
+	.long	.LASF1037
+	.byte	0x18
+	.byte	0xf
+	.byte	0x80
+	.long	0x68a
+	.uleb128 0x2
+	.long	.LASF1038
+	.byte	0xf
+	.byte	0x81
+	.byte	0xd
+	.long	0x68a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1039
+	.byte	0xf
+	.byte	0x82
+	.byte	0xe
+	.long	0x109
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1040
+	.byte	0xf
+	.byte	0x83
+	.byte	0xe
+	.long	0x109
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1041
+	.byte	0xf
+	.byte	0x84
+	.byte	0xe
+	.long	0x109
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1042
+	.byte	0xf
+	.byte	0x85
+	.byte	0xe
+	.long	0x109
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1043
+	.byte	0xf
+	.byte	0x87
+	.byte	0xd
+	.long	0xec
+	.byte	0x14
+	.byte	0
+	.uleb128 0xe
+	.long	0xec
+	.long	0x69a
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1044
+	.byte	0xf
+	.byte	0x88
+	.byte	0x3
+	.long	0x62f
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x10
+	.byte	0x1c
+	.long	0x6ca
+	.uleb128 0x1
+	.long	.LASF1045
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1046
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1047
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1048
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1049
+	.byte	0x10
+	.byte	0x21
+	.byte	0x3
+	.long	0x6a6
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x10
+	.byte	0x23
+	.long	0x6ee
+	.uleb128 0x1
+	.long	.LASF1050
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1051
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1052
+	.byte	0x10
+	.byte	0x26
+	.byte	0x3
+	.long	0x6d6
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x10
+	.byte	0x28
+	.long	0x712
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1055
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x3
+	.long	0x6fa
+	.uleb128 0x8
+	.long	.LASF1056
+	.byte	0x20
+	.byte	0x10
+	.byte	0x2c
+	.long	0x793
+	.uleb128 0x2
+	.long	.LASF1057
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x19
+	.long	0x6ca
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1058
+	.byte	0x10
+	.byte	0x2e
+	.byte	0xd
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1059
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x17
+	.long	0x587
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1060
+	.byte	0x10
+	.byte	0x30
+	.byte	0x8
+	.long	0x248
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1061
+	.byte	0x10
+	.byte	0x31
+	.byte	0xb
+	.long	0x248
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1062
+	.byte	0x10
+	.byte	0x32
+	.byte	0x1b
+	.long	0x6ee
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1063
+	.byte	0x10
+	.byte	0x33
+	.byte	0x11
+	.long	0x712
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1064
+	.byte	0x10
+	.byte	0x34
+	.byte	0xe
+	.long	0xfd
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1065
+	.byte	0x10
+	.byte	0x35
+	.byte	0x3
+	.long	0x71e
+	.uleb128 0x20
+	.long	.LASF1067
+	.long	0x5d
+	.byte	0x11
+	.byte	0x18
+	.long	0x839
+	.uleb128 0x1
+	.long	.LASF1068
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1070
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1074
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1075
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1076
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1077
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1079
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1080
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1088
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x17
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1091
+	.byte	0x10
+	.byte	0x11
+	.byte	0x34
+	.long	0x87a
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x11
+	.byte	0x35
+	.byte	0xb
+	.long	0x248
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x11
+	.byte	0x36
+	.byte	0xb
+	.long	0x248
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF957
+	.byte	0x11
+	.byte	0x37
+	.byte	0xb
+	.long	0x248
+	.byte	0x8
+	.uleb128 0xf
+	.string	"yaw"
+	.byte	0x11
+	.byte	0x38
+	.byte	0xb
+	.long	0x248
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1091
+	.byte	0x11
+	.byte	0x39
+	.byte	0x3
+	.long	0x839
+	.uleb128 0x8
+	.long	.LASF1093
+	.byte	0x2
+	.byte	0x11
+	.byte	0x42
+	.long	0x8ad
+	.uleb128 0x2
+	.long	.LASF1094
+	.byte	0x11
+	.byte	0x43
+	.byte	0xc
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1095
+	.byte	0x11
+	.byte	0x44
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1096
+	.byte	0x11
+	.byte	0x45
+	.byte	0x3
+	.long	0x886
+	.uleb128 0x8
+	.long	.LASF1097
+	.byte	0x8
+	.byte	0x11
+	.byte	0x47
+	.long	0x8fa
+	.uleb128 0x2
+	.long	.LASF1098
+	.byte	0x11
+	.byte	0x48
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1099
+	.byte	0x11
+	.byte	0x49
+	.byte	0xe
+	.long	0xfd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1100
+	.byte	0x11
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1101
+	.byte	0x11
+	.byte	0x4b
+	.byte	0xe
+	.long	0xfd
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1102
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x3
+	.long	0x8b9
+	.uleb128 0x8
+	.long	.LASF1103
+	.byte	0x1
+	.byte	0x11
+	.byte	0x4e
+	.long	0x920
+	.uleb128 0x2
+	.long	.LASF1104
+	.byte	0x11
+	.byte	0x4f
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1103
+	.byte	0x11
+	.byte	0x50
+	.byte	0x3
+	.long	0x906
+	.uleb128 0x8
+	.long	.LASF1105
+	.byte	0x8
+	.byte	0x11
+	.byte	0x54
+	.long	0x97a
+	.uleb128 0xf
+	.string	"min"
+	.byte	0x11
+	.byte	0x55
+	.byte	0xd
+	.long	0xd4
+	.byte	0
+	.uleb128 0xf
+	.string	"max"
+	.byte	0x11
+	.byte	0x56
+	.byte	0xd
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1106
+	.byte	0x11
+	.byte	0x57
+	.byte	0xd
+	.long	0xd4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1107
+	.byte	0x11
+	.byte	0x58
+	.byte	0xc
+	.long	0xc8
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1108
+	.byte	0x11
+	.byte	0x59
+	.byte	0xc
+	.long	0xc8
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1105
+	.byte	0x11
+	.byte	0x5a
+	.byte	0x3
+	.long	0x92c
+	.uleb128 0x8
+	.long	.LASF1109
+	.byte	0x6
+	.byte	0x12
+	.byte	0x14
+	.long	0x9ba
+	.uleb128 0x2
+	.long	.LASF1110
+	.byte	0x12
+	.byte	0x15
+	.byte	0xd
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1111
+	.byte	0x12
+	.byte	0x16
+	.byte	0xd
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x12
+	.byte	0x17
+	.byte	0xd
+	.long	0xd4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1113
+	.byte	0x12
+	.byte	0x18
+	.byte	0x3
+	.long	0x986
+	.uleb128 0x8
+	.long	.LASF1114
+	.byte	0xa
+	.byte	0x13
+	.byte	0x18
+	.long	0xa21
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x13
+	.byte	0x19
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1116
+	.byte	0x13
+	.byte	0x1a
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1117
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xd
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1118
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x13
+	.byte	0x1e
+	.byte	0xe
+	.long	0xfd
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1120
+	.byte	0x13
+	.byte	0x21
+	.byte	0xd
+	.long	0xec
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1121
+	.byte	0x13
+	.byte	0x22
+	.byte	0x3
+	.long	0x9c6
+	.uleb128 0x20
+	.long	.LASF1122
+	.long	0x5d
+	.byte	0x14
+	.byte	0x14
+	.long	0xa4f
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1126
+	.byte	0x1
+	.byte	0x14
+	.byte	0x1a
+	.long	0xa69
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x14
+	.byte	0x1b
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1128
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x3
+	.long	0xa4f
+	.uleb128 0x8
+	.long	.LASF1129
+	.byte	0x6
+	.byte	0x15
+	.byte	0x14
+	.long	0xaa9
+	.uleb128 0x2
+	.long	.LASF1130
+	.byte	0x15
+	.byte	0x15
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x15
+	.byte	0x16
+	.byte	0xe
+	.long	0xfd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x15
+	.byte	0x17
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1133
+	.byte	0x15
+	.byte	0x18
+	.byte	0x3
+	.long	0xa75
+	.uleb128 0x8
+	.long	.LASF1134
+	.byte	0x12
+	.byte	0x16
+	.byte	0x3d
+	.long	0xb10
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0x16
+	.byte	0x3e
+	.byte	0xd
+	.long	0xb10
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x16
+	.byte	0x3f
+	.byte	0xd
+	.long	0xec
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1137
+	.byte	0x16
+	.byte	0x40
+	.byte	0xe
+	.long	0xfd
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1138
+	.byte	0x16
+	.byte	0x41
+	.byte	0xe
+	.long	0xfd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1139
+	.byte	0x16
+	.byte	0x42
+	.byte	0xe
+	.long	0xfd
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1140
+	.byte	0x16
+	.byte	0x43
+	.byte	0xd
+	.long	0xec
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0xec
+	.long	0xb20
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1141
+	.byte	0x16
+	.byte	0x44
+	.byte	0x3
+	.long	0xab5
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x17
+	.byte	0x14
+	.long	0xbc2
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1146
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1149
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1154
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x16
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1165
+	.byte	0x17
+	.byte	0x2d
+	.byte	0x3
+	.long	0xb2c
+	.uleb128 0x20
+	.long	.LASF1166
+	.long	0x5d
+	.byte	0x17
+	.byte	0x34
+	.long	0xc26
+	.uleb128 0x1
+	.long	.LASF1167
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1168
+	.byte	0x1
+	.uleb128 0x32
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1172
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1178
+	.byte	0x8
+	.byte	0x17
+	.byte	0x65
+	.long	0xc67
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0x17
+	.byte	0x66
+	.byte	0xd
+	.long	0xbc2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x17
+	.byte	0x67
+	.byte	0xd
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x17
+	.byte	0x6d
+	.byte	0xd
+	.long	0xec
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1182
+	.byte	0x17
+	.byte	0x6e
+	.byte	0xd
+	.long	0xec
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1183
+	.byte	0x17
+	.byte	0x6f
+	.byte	0x3
+	.long	0xc26
+	.uleb128 0x8
+	.long	.LASF1184
+	.byte	0x6
+	.byte	0x17
+	.byte	0x73
+	.long	0xcce
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x17
+	.byte	0x74
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x17
+	.byte	0x75
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0x17
+	.byte	0x76
+	.byte	0xd
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0x17
+	.byte	0x77
+	.byte	0xd
+	.long	0xec
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1189
+	.byte	0x17
+	.byte	0x78
+	.byte	0xd
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1190
+	.byte	0x17
+	.byte	0x79
+	.byte	0xd
+	.long	0xec
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1191
+	.byte	0x17
+	.byte	0x7a
+	.byte	0x3
+	.long	0xc73
+	.uleb128 0x8
+	.long	.LASF1192
+	.byte	0x8
+	.byte	0x18
+	.byte	0x16
+	.long	0xd28
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x18
+	.byte	0x17
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x18
+	.byte	0x18
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x18
+	.byte	0x19
+	.byte	0xe
+	.long	0xfd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x18
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x18
+	.byte	0x1b
+	.byte	0xe
+	.long	0xfd
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1198
+	.byte	0x18
+	.byte	0x1c
+	.byte	0x3
+	.long	0xcda
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x19
+	.byte	0x1d
+	.long	0xd52
+	.uleb128 0x1
+	.long	.LASF1199
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1200
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1202
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x23
+	.long	0xdc7
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0x19
+	.byte	0x24
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0x19
+	.byte	0x25
+	.byte	0xd
+	.long	0xec
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x19
+	.byte	0x26
+	.byte	0xb
+	.long	0x248
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1206
+	.byte	0x19
+	.byte	0x27
+	.byte	0xb
+	.long	0x248
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x19
+	.byte	0x28
+	.byte	0xd
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1208
+	.byte	0x19
+	.byte	0x29
+	.byte	0xb
+	.long	0x248
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1209
+	.byte	0x19
+	.byte	0x2a
+	.byte	0xb
+	.long	0x248
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1210
+	.byte	0x19
+	.byte	0x2b
+	.byte	0xc
+	.long	0xc8
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1211
+	.byte	0x19
+	.byte	0x2c
+	.byte	0x3
+	.long	0xd52
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x1a
+	.byte	0x15
+	.long	0xdf1
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1216
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0x10
+	.long	0xec
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x1c
+	.byte	0x14
+	.long	0xe9e
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x80
+	.uleb128 0x17
+	.long	.LASF1225
+	.value	0x100
+	.uleb128 0x17
+	.long	.LASF1226
+	.value	0x200
+	.uleb128 0x17
+	.long	.LASF1227
+	.value	0x400
+	.uleb128 0x17
+	.long	.LASF1228
+	.value	0x800
+	.uleb128 0x17
+	.long	.LASF1229
+	.value	0x1000
+	.uleb128 0x17
+	.long	.LASF1230
+	.value	0x2000
+	.uleb128 0x17
+	.long	.LASF1231
+	.value	0x4000
+	.uleb128 0x17
+	.long	.LASF1232
+	.value	0x8000
+	.uleb128 0x1e
+	.long	.LASF1233
+	.long	0x10000
+	.uleb128 0x1e
+	.long	.LASF1234
+	.long	0x20000
+	.uleb128 0x1e
+	.long	.LASF1235
+	.long	0x40000
+	.uleb128 0x1e
+	.long	.LASF1236
+	.long	0x80000
+	.uleb128 0x1e
+	.long	.LASF1237
+	.long	0x100000
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1238
+	.value	0x218
+	.byte	0x1d
+	.byte	0x14
+	.long	0xfe1
+	.uleb128 0x2
+	.long	.LASF1239
+	.byte	0x1d
+	.byte	0x15
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1240
+	.byte	0x1d
+	.byte	0x17
+	.byte	0x12
+	.long	0x24f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1241
+	.byte	0x1d
+	.byte	0x19
+	.byte	0x19
+	.long	0xcce
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x1d
+	.byte	0x1b
+	.byte	0xd
+	.long	0xec
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1243
+	.byte	0x1d
+	.byte	0x1c
+	.byte	0xe
+	.long	0xfd
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1244
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0xd
+	.long	0xd4
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1245
+	.byte	0x1d
+	.byte	0x21
+	.byte	0x19
+	.long	0x334
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0x1d
+	.byte	0x24
+	.byte	0xd
+	.long	0xec
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1246
+	.byte	0x1d
+	.byte	0x25
+	.byte	0xb
+	.long	0x248
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1247
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x13
+	.long	0x516
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1248
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x17
+	.long	0x563
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xec
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1249
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0x1f
+	.long	0xfe1
+	.byte	0x84
+	.uleb128 0x6
+	.long	.LASF1250
+	.byte	0x1d
+	.byte	0x30
+	.byte	0xd
+	.long	0xec
+	.value	0x1c4
+	.uleb128 0x6
+	.long	.LASF1251
+	.byte	0x1d
+	.byte	0x31
+	.byte	0xd
+	.long	0xec
+	.value	0x1c5
+	.uleb128 0x6
+	.long	.LASF1252
+	.byte	0x1d
+	.byte	0x32
+	.byte	0xd
+	.long	0xec
+	.value	0x1c6
+	.uleb128 0x6
+	.long	.LASF1253
+	.byte	0x1d
+	.byte	0x33
+	.byte	0xd
+	.long	0xec
+	.value	0x1c7
+	.uleb128 0x6
+	.long	.LASF1254
+	.byte	0x1d
+	.byte	0x35
+	.byte	0xe
+	.long	0xfd
+	.value	0x1c8
+	.uleb128 0x6
+	.long	.LASF1255
+	.byte	0x1d
+	.byte	0x36
+	.byte	0xd
+	.long	0xec
+	.value	0x1ca
+	.uleb128 0x6
+	.long	.LASF1256
+	.byte	0x1d
+	.byte	0x39
+	.byte	0x12
+	.long	0xff1
+	.value	0x1cc
+	.uleb128 0x6
+	.long	.LASF1257
+	.byte	0x1d
+	.byte	0x3c
+	.byte	0x16
+	.long	0xd28
+	.value	0x20c
+	.uleb128 0x6
+	.long	.LASF1258
+	.byte	0x1d
+	.byte	0x3f
+	.byte	0x13
+	.long	0x8ad
+	.value	0x214
+	.uleb128 0x6
+	.long	.LASF1259
+	.byte	0x1d
+	.byte	0x42
+	.byte	0x14
+	.long	0xa69
+	.value	0x216
+	.byte	0
+	.uleb128 0xe
+	.long	0xc67
+	.long	0xff1
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x27
+	.byte	0
+	.uleb128 0xe
+	.long	0x97a
+	.long	0x1001
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1260
+	.byte	0x1d
+	.byte	0x47
+	.byte	0x3
+	.long	0xe9e
+	.uleb128 0x24
+	.long	.LASF1261
+	.value	0x7dc
+	.byte	0x1e
+	.byte	0x17
+	.long	0x1244
+	.uleb128 0x2
+	.long	.LASF1262
+	.byte	0x1e
+	.byte	0x18
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1263
+	.byte	0x1e
+	.byte	0x19
+	.byte	0xe
+	.long	0x109
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1264
+	.byte	0x1e
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1265
+	.byte	0x1e
+	.byte	0x1b
+	.byte	0xd
+	.long	0xec
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1266
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0xd
+	.long	0xec
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1267
+	.byte	0x1e
+	.byte	0x1d
+	.byte	0xd
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1268
+	.byte	0x1e
+	.byte	0x1e
+	.byte	0xd
+	.long	0xec
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1269
+	.byte	0x1e
+	.byte	0x20
+	.byte	0x12
+	.long	0x1244
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1270
+	.byte	0x1e
+	.byte	0x23
+	.byte	0x19
+	.long	0xaa9
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF1271
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x16
+	.long	0x8fa
+	.byte	0xd6
+	.uleb128 0x2
+	.long	.LASF1272
+	.byte	0x1e
+	.byte	0x26
+	.byte	0xe
+	.long	0xfd
+	.byte	0xde
+	.uleb128 0x2
+	.long	.LASF1273
+	.byte	0x1e
+	.byte	0x27
+	.byte	0xe
+	.long	0xfd
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF1274
+	.byte	0x1e
+	.byte	0x28
+	.byte	0xe
+	.long	0xfd
+	.byte	0xe2
+	.uleb128 0x2
+	.long	.LASF1275
+	.byte	0x1e
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x3e6
+	.byte	0xe4
+	.uleb128 0x2
+	.long	.LASF1276
+	.byte	0x1e
+	.byte	0x2d
+	.byte	0x16
+	.long	0x9ba
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF1277
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0xc
+	.long	0xc8
+	.byte	0xf6
+	.uleb128 0x2
+	.long	.LASF1278
+	.byte	0x1e
+	.byte	0x30
+	.byte	0xd
+	.long	0xec
+	.byte	0xf7
+	.uleb128 0x2
+	.long	.LASF1279
+	.byte	0x1e
+	.byte	0x31
+	.byte	0xe
+	.long	0xfd
+	.byte	0xf8
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x1e
+	.byte	0x32
+	.byte	0xe
+	.long	0xfd
+	.byte	0xfa
+	.uleb128 0x2
+	.long	.LASF1206
+	.byte	0x1e
+	.byte	0x33
+	.byte	0xe
+	.long	0xfd
+	.byte	0xfc
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x1e
+	.byte	0x34
+	.byte	0xd
+	.long	0xec
+	.byte	0xfe
+	.uleb128 0x6
+	.long	.LASF1208
+	.byte	0x1e
+	.byte	0x35
+	.byte	0xe
+	.long	0xfd
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1209
+	.byte	0x1e
+	.byte	0x36
+	.byte	0xe
+	.long	0xfd
+	.value	0x102
+	.uleb128 0x6
+	.long	.LASF1280
+	.byte	0x1e
+	.byte	0x38
+	.byte	0x12
+	.long	0x49a
+	.value	0x104
+	.uleb128 0x6
+	.long	.LASF1281
+	.byte	0x1e
+	.byte	0x3a
+	.byte	0xe
+	.long	0xfd
+	.value	0x10c
+	.uleb128 0x6
+	.long	.LASF1282
+	.byte	0x1e
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x2c8
+	.value	0x10e
+	.uleb128 0x6
+	.long	.LASF1283
+	.byte	0x1e
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x2c8
+	.value	0x114
+	.uleb128 0x6
+	.long	.LASF1284
+	.byte	0x1e
+	.byte	0x3d
+	.byte	0x14
+	.long	0x44d
+	.value	0x11c
+	.uleb128 0x6
+	.long	.LASF1285
+	.byte	0x1e
+	.byte	0x3f
+	.byte	0x15
+	.long	0xa21
+	.value	0x12c
+	.uleb128 0x6
+	.long	.LASF1286
+	.byte	0x1e
+	.byte	0x41
+	.byte	0x10
+	.long	0xb20
+	.value	0x136
+	.uleb128 0x6
+	.long	.LASF1287
+	.byte	0x1e
+	.byte	0x42
+	.byte	0x1a
+	.long	0x358
+	.value	0x148
+	.uleb128 0x6
+	.long	.LASF1288
+	.byte	0x1e
+	.byte	0x44
+	.byte	0xd
+	.long	0xec
+	.value	0x14c
+	.uleb128 0x6
+	.long	.LASF1289
+	.byte	0x1e
+	.byte	0x45
+	.byte	0xd
+	.long	0xec
+	.value	0x14d
+	.uleb128 0x6
+	.long	.LASF1210
+	.byte	0x1e
+	.byte	0x46
+	.byte	0xd
+	.long	0xec
+	.value	0x14e
+	.uleb128 0x6
+	.long	.LASF1290
+	.byte	0x1e
+	.byte	0x48
+	.byte	0x16
+	.long	0x920
+	.value	0x14f
+	.uleb128 0x6
+	.long	.LASF1291
+	.byte	0x1e
+	.byte	0x49
+	.byte	0xc
+	.long	0xc8
+	.value	0x150
+	.uleb128 0x6
+	.long	.LASF1292
+	.byte	0x1e
+	.byte	0x4f
+	.byte	0x14
+	.long	0x69a
+	.value	0x154
+	.uleb128 0x6
+	.long	.LASF1293
+	.byte	0x1e
+	.byte	0x51
+	.byte	0x17
+	.long	0x793
+	.value	0x16c
+	.uleb128 0x6
+	.long	.LASF1294
+	.byte	0x1e
+	.byte	0x53
+	.byte	0xd
+	.long	0xec
+	.value	0x18c
+	.uleb128 0x6
+	.long	.LASF1295
+	.byte	0x1e
+	.byte	0x5a
+	.byte	0xf
+	.long	0x1254
+	.value	0x190
+	.uleb128 0x6
+	.long	.LASF1296
+	.byte	0x1e
+	.byte	0x5b
+	.byte	0xd
+	.long	0xec
+	.value	0x7d8
+	.byte	0
+	.uleb128 0xe
+	.long	0x87a
+	.long	0x1254
+	.uleb128 0x10
+	.long	0x41
+	.byte	0xb
+	.byte	0
+	.uleb128 0xe
+	.long	0x1001
+	.long	0x1264
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1261
+	.byte	0x1e
+	.byte	0x5c
+	.byte	0x3
+	.long	0x100d
+	.uleb128 0x1f
+	.long	.LASF1297
+	.byte	0x1e
+	.byte	0x5e
+	.byte	0x11
+	.long	0x1264
+	.uleb128 0x1f
+	.long	.LASF1298
+	.byte	0x1e
+	.byte	0x5f
+	.byte	0x13
+	.long	0x1288
+	.uleb128 0x7
+	.long	0x1001
+	.uleb128 0x8
+	.long	.LASF1299
+	.byte	0x4
+	.byte	0x1f
+	.byte	0x33
+	.long	0x12b3
+	.uleb128 0xf
+	.string	"id"
+	.byte	0x1f
+	.byte	0x34
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1300
+	.byte	0x1f
+	.byte	0x35
+	.byte	0xe
+	.long	0xfd
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1301
+	.byte	0x1f
+	.byte	0x36
+	.byte	0x3
+	.long	0x128d
+	.uleb128 0x1d
+	.long	0x12b3
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x1f
+	.byte	0x38
+	.long	0x12e8
+	.uleb128 0x1
+	.long	.LASF1302
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1303
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1304
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1305
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1306
+	.byte	0x1f
+	.byte	0x3d
+	.byte	0x3
+	.long	0x12c4
+	.uleb128 0x24
+	.long	.LASF1307
+	.value	0x158
+	.byte	0x1f
+	.byte	0x3f
+	.long	0x1420
+	.uleb128 0x2
+	.long	.LASF1308
+	.byte	0x1f
+	.byte	0x40
+	.byte	0xf
+	.long	0x115
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1309
+	.byte	0x1f
+	.byte	0x41
+	.byte	0xe
+	.long	0x109
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1310
+	.byte	0x1f
+	.byte	0x42
+	.byte	0xe
+	.long	0xfd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1311
+	.byte	0x1f
+	.byte	0x43
+	.byte	0xe
+	.long	0x109
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1312
+	.byte	0x1f
+	.byte	0x44
+	.byte	0x23
+	.long	0x1420
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1313
+	.byte	0x1f
+	.byte	0x45
+	.byte	0xd
+	.long	0xec
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1314
+	.byte	0x1f
+	.byte	0x46
+	.byte	0xe
+	.long	0xfd
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1315
+	.byte	0x1f
+	.byte	0x48
+	.byte	0xc
+	.long	0xc8
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1316
+	.byte	0x1f
+	.byte	0x49
+	.byte	0xe
+	.long	0xfd
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1317
+	.byte	0x1f
+	.byte	0x4a
+	.byte	0xe
+	.long	0x109
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1318
+	.byte	0x1f
+	.byte	0x4b
+	.byte	0x9
+	.long	0x598
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1319
+	.byte	0x1f
+	.byte	0x4c
+	.byte	0x14
+	.long	0x1425
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1320
+	.byte	0x1f
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x12e8
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF1321
+	.byte	0x1f
+	.byte	0x4f
+	.byte	0x9
+	.long	0x598
+	.byte	0xb4
+	.uleb128 0x2
+	.long	.LASF1322
+	.byte	0x1f
+	.byte	0x50
+	.byte	0xe
+	.long	0x109
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x1f
+	.byte	0x51
+	.byte	0xd
+	.long	0xec
+	.byte	0xbc
+	.uleb128 0x2
+	.long	.LASF1324
+	.byte	0x1f
+	.byte	0x54
+	.byte	0x14
+	.long	0x593
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF1325
+	.byte	0x1f
+	.byte	0x55
+	.byte	0x9
+	.long	0x598
+	.byte	0xc8
+	.uleb128 0x2
+	.long	.LASF1326
+	.byte	0x1f
+	.byte	0x56
+	.byte	0xd
+	.long	0xec
+	.byte	0xc9
+	.uleb128 0x2
+	.long	.LASF1327
+	.byte	0x1f
+	.byte	0x57
+	.byte	0xe
+	.long	0x109
+	.byte	0xcc
+	.uleb128 0x2
+	.long	.LASF1328
+	.byte	0x1f
+	.byte	0x58
+	.byte	0xe
+	.long	0x109
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF1329
+	.byte	0x1f
+	.byte	0x59
+	.byte	0x14
+	.long	0x1425
+	.byte	0xd8
+	.byte	0
+	.uleb128 0x7
+	.long	0x12bf
+	.uleb128 0xe
+	.long	0x593
+	.long	0x1435
+	.uleb128 0x10
+	.long	0x41
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1330
+	.byte	0x1f
+	.byte	0x5a
+	.byte	0x3
+	.long	0x12f4
+	.uleb128 0x1d
+	.long	0x1435
+	.uleb128 0x28
+	.long	0x1270
+	.byte	0x6d
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig
+	.uleb128 0x28
+	.long	0x127c
+	.byte	0x6e
+	.byte	0xc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentProfile
+	.uleb128 0xb
+	.long	0x5d
+	.byte	0x1
+	.byte	0x76
+	.long	0x14d4
+	.uleb128 0x1
+	.long	.LASF1331
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1332
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1333
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1334
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1335
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1338
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1339
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1340
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1341
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1342
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1343
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1344
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1345
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1346
+	.byte	0xf
+	.byte	0
+	.uleb128 0xe
+	.long	0x12bf
+	.long	0x14e4
+	.uleb128 0x10
+	.long	0x41
+	.byte	0xd
+	.byte	0
+	.uleb128 0x1d
+	.long	0x14d4
+	.uleb128 0x29
+	.long	.LASF1347
+	.byte	0x8a
+	.byte	0x25
+	.long	0x14e4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configSections
+	.uleb128 0x29
+	.long	.LASF1348
+	.byte	0xa3
+	.byte	0x18
+	.long	0x1435
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configStorage
+	.uleb128 0x18
+	.long	.LASF1351
+	.byte	0x20
+	.byte	0x2b
+	.byte	0xe
+	.long	0xba
+	.long	0x1533
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x1533
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x7
+	.long	0x1538
+	.uleb128 0x33
+	.uleb128 0x9
+	.long	.LASF1349
+	.byte	0x16
+	.byte	0x57
+	.long	0x154f
+	.uleb128 0x3
+	.long	0x121
+	.uleb128 0x3
+	.long	0x154f
+	.byte	0
+	.uleb128 0x7
+	.long	0xb20
+	.uleb128 0x9
+	.long	.LASF1350
+	.byte	0x8
+	.byte	0x8c
+	.long	0x1565
+	.uleb128 0x3
+	.long	0x1565
+	.byte	0
+	.uleb128 0x7
+	.long	0x334
+	.uleb128 0x18
+	.long	.LASF1352
+	.byte	0x20
+	.byte	0x3d
+	.byte	0xe
+	.long	0xba
+	.long	0x158a
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x48
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1353
+	.byte	0x1f
+	.byte	0x63
+	.byte	0x5
+	.long	0x598
+	.long	0x15a0
+	.uleb128 0x3
+	.long	0x15a0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1441
+	.uleb128 0x18
+	.long	.LASF1354
+	.byte	0x1f
+	.byte	0x62
+	.byte	0x16
+	.long	0x12e8
+	.long	0x15c0
+	.uleb128 0x3
+	.long	0x15c0
+	.uleb128 0x3
+	.long	0x598
+	.byte	0
+	.uleb128 0x7
+	.long	0x1435
+	.uleb128 0x9
+	.long	.LASF1355
+	.byte	0x1f
+	.byte	0x61
+	.long	0x15db
+	.uleb128 0x3
+	.long	0x15c0
+	.uleb128 0x3
+	.long	0x1533
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1356
+	.byte	0x21
+	.byte	0x14
+	.long	0x15f6
+	.uleb128 0x3
+	.long	0xec
+	.uleb128 0x3
+	.long	0xec
+	.uleb128 0x3
+	.long	0xec
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1357
+	.byte	0x1f
+	.byte	0x5e
+	.byte	0x9
+	.long	0xec
+	.long	0x160c
+	.uleb128 0x3
+	.long	0x15a0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1358
+	.byte	0x1f
+	.byte	0x5f
+	.long	0x1622
+	.uleb128 0x3
+	.long	0x15a0
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1359
+	.byte	0x22
+	.byte	0x1f
+	.long	0x1633
+	.uleb128 0x3
+	.long	0xec
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1360
+	.byte	0x1f
+	.byte	0x5c
+	.long	0x1667
+	.uleb128 0x3
+	.long	0x15c0
+	.uleb128 0x3
+	.long	0x115
+	.uleb128 0x3
+	.long	0x109
+	.uleb128 0x3
+	.long	0xfd
+	.uleb128 0x3
+	.long	0x109
+	.uleb128 0x3
+	.long	0x1420
+	.uleb128 0x3
+	.long	0xec
+	.uleb128 0x3
+	.long	0xfd
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1361
+	.byte	0xf
+	.byte	0x96
+	.byte	0x5
+	.long	0x598
+	.long	0x167d
+	.uleb128 0x3
+	.long	0x167d
+	.byte	0
+	.uleb128 0x7
+	.long	0x69a
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0xf
+	.byte	0x95
+	.long	0x1693
+	.uleb128 0x3
+	.long	0x167d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x16
+	.byte	0x4f
+	.long	0x16a4
+	.uleb128 0x3
+	.long	0x154f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1364
+	.byte	0xd
+	.byte	0x2b
+	.long	0x16b5
+	.uleb128 0x3
+	.long	0x16b5
+	.byte	0
+	.uleb128 0x7
+	.long	0x563
+	.uleb128 0x9
+	.long	.LASF1365
+	.byte	0x19
+	.byte	0x34
+	.long	0x16cb
+	.uleb128 0x3
+	.long	0x248
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1366
+	.byte	0x19
+	.byte	0x32
+	.long	0x16dc
+	.uleb128 0x3
+	.long	0xfd
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1367
+	.byte	0x23
+	.byte	0x12
+	.long	0x16f2
+	.uleb128 0x3
+	.long	0x16f2
+	.uleb128 0x3
+	.long	0x16b5
+	.byte	0
+	.uleb128 0x7
+	.long	0x24f
+	.uleb128 0x9
+	.long	.LASF1368
+	.byte	0x19
+	.byte	0x2e
+	.long	0x1712
+	.uleb128 0x3
+	.long	0x1712
+	.uleb128 0x3
+	.long	0x16f2
+	.uleb128 0x3
+	.long	0x1717
+	.byte	0
+	.uleb128 0x7
+	.long	0xdc7
+	.uleb128 0x7
+	.long	0x516
+	.uleb128 0x9
+	.long	.LASF1369
+	.byte	0x1
+	.byte	0x49
+	.long	0x174b
+	.uleb128 0x3
+	.long	0x174b
+	.uleb128 0x3
+	.long	0x1750
+	.uleb128 0x3
+	.long	0x1755
+	.uleb128 0x3
+	.long	0x175a
+	.uleb128 0x3
+	.long	0x175f
+	.uleb128 0x3
+	.long	0x154f
+	.uleb128 0x3
+	.long	0x1764
+	.byte	0
+	.uleb128 0x7
+	.long	0x97a
+	.uleb128 0x7
+	.long	0x8fa
+	.uleb128 0x7
+	.long	0xaa9
+	.uleb128 0x7
+	.long	0x8ad
+	.uleb128 0x7
+	.long	0x920
+	.uleb128 0x7
+	.long	0xa69
+	.uleb128 0x9
+	.long	.LASF1370
+	.byte	0xc
+	.byte	0x2f
+	.long	0x177a
+	.uleb128 0x3
+	.long	0x177a
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c8
+	.uleb128 0x9
+	.long	.LASF1371
+	.byte	0x18
+	.byte	0x34
+	.long	0x1790
+	.uleb128 0x3
+	.long	0x1790
+	.byte	0
+	.uleb128 0x7
+	.long	0xd28
+	.uleb128 0x9
+	.long	.LASF1372
+	.byte	0x1
+	.byte	0x48
+	.long	0x17a6
+	.uleb128 0x3
+	.long	0x48
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1373
+	.byte	0xb
+	.byte	0x2b
+	.long	0x17b7
+	.uleb128 0x3
+	.long	0x17b7
+	.byte	0
+	.uleb128 0x7
+	.long	0x49a
+	.uleb128 0x9
+	.long	.LASF1374
+	.byte	0x17
+	.byte	0x84
+	.long	0x17cd
+	.uleb128 0x3
+	.long	0x17cd
+	.byte	0
+	.uleb128 0x7
+	.long	0xc67
+	.uleb128 0x9
+	.long	.LASF1375
+	.byte	0x24
+	.byte	0x1a
+	.long	0x17e8
+	.uleb128 0x3
+	.long	0x17e8
+	.uleb128 0x3
+	.long	0x1755
+	.byte	0
+	.uleb128 0x7
+	.long	0xcce
+	.uleb128 0x9
+	.long	.LASF1376
+	.byte	0x24
+	.byte	0x19
+	.long	0x17fe
+	.uleb128 0x3
+	.long	0x17e8
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1377
+	.byte	0xf
+	.byte	0x8a
+	.byte	0x9
+	.long	0xec
+	.long	0x1814
+	.uleb128 0x3
+	.long	0x623
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF1409
+	.byte	0x1
+	.value	0x2db
+	.byte	0xa
+	.long	0x109
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2a
+	.long	.LASF1388
+	.value	0x2d6
+	.uleb128 0x21
+	.long	.LASF1378
+	.value	0x2d1
+	.long	0x1852
+	.uleb128 0x19
+	.long	.LASF1380
+	.value	0x2d1
+	.byte	0x1c
+	.long	0x109
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1379
+	.value	0x2cc
+	.long	0x186a
+	.uleb128 0x19
+	.long	.LASF1380
+	.value	0x2cc
+	.byte	0x1a
+	.long	0x109
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1381
+	.byte	0x1
+	.value	0x2c7
+	.byte	0x5
+	.long	0x598
+	.byte	0x1
+	.long	0x1889
+	.uleb128 0x19
+	.long	.LASF1380
+	.value	0x2c7
+	.byte	0x16
+	.long	0x109
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1382
+	.value	0x2bf
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18ef
+	.uleb128 0x36
+	.long	.LASF1398
+	.byte	0x1
+	.value	0x2bf
+	.byte	0x1c
+	.long	0xec
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xc
+	.quad	.LVL106
+	.long	0x1b17
+	.uleb128 0xc
+	.quad	.LVL107
+	.long	0x1c25
+	.uleb128 0x1a
+	.quad	.LVL108
+	.long	0x15db
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1383
+	.value	0x2b8
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19db
+	.uleb128 0x11
+	.long	0x1d0c
+	.quad	.LBI204
+	.value	.LVU617
+	.long	.LLRL32
+	.value	0x2ba
+	.byte	0x5
+	.long	0x1975
+	.uleb128 0x12
+	.long	0x2304
+	.quad	.LBI206
+	.value	.LVU623
+	.quad	.LBB206
+	.quad	.LBE206-.LBB206
+	.value	0x261
+	.byte	0x5
+	.long	0x195a
+	.uleb128 0xa
+	.long	0x2312
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL101
+	.long	0x1d73
+	.uleb128 0xc
+	.quad	.LVL102
+	.long	0x202d
+	.byte	0
+	.uleb128 0x12
+	.long	0x1b10
+	.quad	.LBI211
+	.value	.LVU630
+	.quad	.LBB211
+	.quad	.LBE211-.LBB211
+	.value	0x2bb
+	.byte	0x5
+	.long	0x19bd
+	.uleb128 0x14
+	.quad	.LVL103
+	.long	0x15c5
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configStorage
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL104
+	.long	0x15db
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x44
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1384
+	.value	0x2b1
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a13
+	.uleb128 0xc
+	.quad	.LVL97
+	.long	0x216a
+	.uleb128 0x22
+	.quad	.LVL98
+	.long	0x1b17
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1385
+	.value	0x2a6
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a9f
+	.uleb128 0x11
+	.long	0x215c
+	.quad	.LBI194
+	.value	.LVU597
+	.long	.LLRL31
+	.value	0x2a8
+	.byte	0x9
+	.long	0x1a5f
+	.uleb128 0x14
+	.quad	.LVL93
+	.long	0x15f6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL94
+	.long	0x216a
+	.uleb128 0xd
+	.quad	.LVL95
+	.long	0x160c
+	.long	0x1a91
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL96
+	.long	0x1b17
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1386
+	.value	0x2a0
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ad8
+	.uleb128 0x1a
+	.quad	.LVL92
+	.long	0x15a5
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configStorage
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1410
+	.byte	0x1
+	.value	0x28e
+	.byte	0x5
+	.long	0x598
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b10
+	.uleb128 0x2b
+	.long	.LASF1387
+	.value	0x290
+	.byte	0x9
+	.long	0x598
+	.long	.LLST30
+	.long	.LVUS30
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1389
+	.value	0x288
+	.uleb128 0x13
+	.long	.LASF1390
+	.value	0x27a
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1bdd
+	.uleb128 0x12
+	.long	0x215c
+	.quad	.LBI192
+	.value	.LVU570
+	.quad	.LBB192
+	.quad	.LBE192-.LBB192
+	.value	0x282
+	.byte	0x3a
+	.long	0x1b6f
+	.uleb128 0x14
+	.quad	.LVL83
+	.long	0x15f6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL80
+	.long	0x15c5
+	.long	0x1b94
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL81
+	.long	0x15a5
+	.long	0x1bb1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL82
+	.long	0x158a
+	.long	0x1bc9
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL84
+	.long	0x1622
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1391
+	.value	0x273
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c25
+	.uleb128 0xc
+	.quad	.LVL78
+	.long	0x1c25
+	.uleb128 0x1a
+	.quad	.LVL79
+	.long	0x15db
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x44
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1392
+	.value	0x267
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d0c
+	.uleb128 0x11
+	.long	0x215c
+	.quad	.LBI178
+	.value	.LVU526
+	.long	.LLRL27
+	.value	0x26a
+	.byte	0xa
+	.long	0x1c71
+	.uleb128 0x14
+	.quad	.LVL71
+	.long	0x15f6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1d0c
+	.quad	.LBI186
+	.value	.LVU538
+	.long	.LLRL28
+	.value	0x270
+	.byte	0x5
+	.long	0x1cda
+	.uleb128 0x12
+	.long	0x2304
+	.quad	.LBI188
+	.value	.LVU543
+	.quad	.LBB188
+	.quad	.LBE188-.LBB188
+	.value	0x261
+	.byte	0x5
+	.long	0x1cbf
+	.uleb128 0xa
+	.long	0x2312
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL76
+	.long	0x1d73
+	.uleb128 0x22
+	.quad	.LVL77
+	.long	0x202d
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL72
+	.long	0x1622
+	.long	0x1cf1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL73
+	.long	0x160c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1411
+	.byte	0x1
+	.value	0x25b
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x13
+	.long	.LASF1393
+	.value	0x251
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d73
+	.uleb128 0x14
+	.quad	.LVL70
+	.long	0x1633
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configStorage
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x800
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x5
+	.byte	0xc
+	.long	0x7dc005a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configSections
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1394
+	.value	0x20d
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x202d
+	.uleb128 0x2b
+	.long	.LASF1292
+	.value	0x249
+	.byte	0x15
+	.long	0x167d
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x12
+	.long	0x186a
+	.quad	.LBI144
+	.value	.LVU424
+	.quad	.LBB144
+	.quad	.LBE144-.LBB144
+	.value	0x20f
+	.byte	0xb
+	.long	0x1dd8
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.uleb128 0x12
+	.long	0x186a
+	.quad	.LBI146
+	.value	.LVU431
+	.quad	.LBB146
+	.quad	.LBE146-.LBB146
+	.value	0x213
+	.byte	0x9
+	.long	0x1e0c
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x12
+	.long	0x183a
+	.quad	.LBI148
+	.value	.LVU436
+	.quad	.LBB148
+	.quad	.LBE148-.LBB148
+	.value	0x214
+	.byte	0x9
+	.long	0x1e40
+	.uleb128 0xa
+	.long	0x1845
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x12
+	.long	0x186a
+	.quad	.LBI150
+	.value	.LVU441
+	.quad	.LBB150
+	.quad	.LBE150-.LBB150
+	.value	0x217
+	.byte	0x9
+	.long	0x1e74
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x11
+	.long	0x186a
+	.quad	.LBI152
+	.value	.LVU446
+	.long	.LLRL18
+	.value	0x21d
+	.byte	0x9
+	.long	0x1e9c
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x12
+	.long	0x183a
+	.quad	.LBI155
+	.value	.LVU452
+	.quad	.LBB155
+	.quad	.LBE155-.LBB155
+	.value	0x21f
+	.byte	0x9
+	.long	0x1ed0
+	.uleb128 0xa
+	.long	0x1845
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x11
+	.long	0x186a
+	.quad	.LBI157
+	.value	.LVU457
+	.long	.LLRL21
+	.value	0x222
+	.byte	0x9
+	.long	0x1ef8
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x12
+	.long	0x183a
+	.quad	.LBI160
+	.value	.LVU473
+	.quad	.LBB160
+	.quad	.LBE160-.LBB160
+	.value	0x21a
+	.byte	0x9
+	.long	0x1f2c
+	.uleb128 0xa
+	.long	0x1845
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.uleb128 0x12
+	.long	0x183a
+	.quad	.LBI164
+	.value	.LVU487
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.value	0x230
+	.byte	0x9
+	.long	0x1f60
+	.uleb128 0xa
+	.long	0x1845
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.uleb128 0x11
+	.long	0x231f
+	.quad	.LBI166
+	.value	.LVU493
+	.long	.LLRL25
+	.value	0x24d
+	.byte	0x9
+	.long	0x1fb3
+	.uleb128 0xa
+	.long	0x232a
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xd
+	.quad	.LVL65
+	.long	0x17fe
+	.long	0x1f9f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x27
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL66
+	.long	0x17fe
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x1852
+	.quad	.LBI170
+	.value	.LVU513
+	.quad	.LBB170
+	.quad	.LBE170-.LBB170
+	.value	0x210
+	.byte	0x9
+	.long	0x1fe1
+	.uleb128 0x39
+	.long	0x185d
+	.value	0x2000
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL57
+	.long	0x1693
+	.long	0x2000
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig+310
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL58
+	.long	0x1682
+	.long	0x2018
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL59
+	.long	0x1667
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1395
+	.value	0x1dc
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x215c
+	.uleb128 0x2c
+	.long	.LASF1396
+	.value	0x1de
+	.byte	0x1f
+	.long	0xdc7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	imuRuntimeConfig.0
+	.uleb128 0xc
+	.quad	.LVL36
+	.long	0x17ed
+	.uleb128 0xd
+	.quad	.LVL37
+	.long	0x17d2
+	.long	0x2085
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL38
+	.long	0x17bc
+	.uleb128 0xd
+	.quad	.LVL39
+	.long	0x17a6
+	.long	0x20aa
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 52
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL40
+	.long	0x1795
+	.uleb128 0xc
+	.quad	.LVL41
+	.long	0x177f
+	.uleb128 0xd
+	.quad	.LVL42
+	.long	0x1769
+	.long	0x20dc
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 62
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL43
+	.long	0x171c
+	.long	0x2108
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 127
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 102
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL44
+	.long	0x16f7
+	.long	0x2127
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	imuRuntimeConfig.0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL45
+	.long	0x16dc
+	.uleb128 0xc
+	.quad	.LVL46
+	.long	0x16cb
+	.uleb128 0xc
+	.quad	.LVL47
+	.long	0x16ba
+	.uleb128 0x22
+	.quad	.LVL48
+	.long	0x16a4
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1412
+	.byte	0x1
+	.value	0x1d7
+	.byte	0xc
+	.long	0x598
+	.byte	0x1
+	.uleb128 0x3b
+	.long	.LASF1413
+	.byte	0x1
+	.value	0x12e
+	.byte	0xd
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22f4
+	.uleb128 0x3c
+	.string	"i"
+	.byte	0x1
+	.value	0x130
+	.byte	0x9
+	.long	0x48
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x2c
+	.long	.LASF1397
+	.value	0x131
+	.byte	0xc
+	.long	0x22f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	0x236a
+	.quad	.LBI76
+	.value	.LVU91
+	.long	.LLRL1
+	.value	0x16e
+	.byte	0x5
+	.long	0x21d3
+	.uleb128 0xa
+	.long	0x2374
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.uleb128 0x11
+	.long	0x2304
+	.quad	.LBI80
+	.value	.LVU19
+	.long	.LLRL3
+	.value	0x135
+	.byte	0x5
+	.long	0x21fb
+	.uleb128 0xa
+	.long	0x2312
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x11
+	.long	0x231f
+	.quad	.LBI84
+	.value	.LVU102
+	.long	.LLRL5
+	.value	0x180
+	.byte	0x5
+	.long	0x224e
+	.uleb128 0xa
+	.long	0x232a
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xd
+	.quad	.LVL6
+	.long	0x17fe
+	.long	0x223a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x27
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL7
+	.long	0x17fe
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1852
+	.quad	.LBI90
+	.value	.LVU44
+	.long	.LLRL7
+	.value	0x13c
+	.byte	0x5
+	.long	0x2276
+	.uleb128 0xa
+	.long	0x185d
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x11
+	.long	0x23b1
+	.quad	.LBI98
+	.value	.LVU149
+	.long	.LLRL9
+	.value	0x18b
+	.byte	0x5
+	.long	0x2296
+	.uleb128 0x3d
+	.long	0x23bb
+	.byte	0
+	.uleb128 0x11
+	.long	0x239b
+	.quad	.LBI112
+	.value	.LVU222
+	.long	.LLRL10
+	.value	0x1a1
+	.byte	0x5
+	.long	0x22be
+	.uleb128 0xa
+	.long	0x23a5
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL11
+	.long	0x1554
+	.uleb128 0x14
+	.quad	.LVL14
+	.long	0x1539
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig+310
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xc8
+	.long	0x2304
+	.uleb128 0x10
+	.long	0x41
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1405
+	.byte	0x1
+	.value	0x128
+	.byte	0xd
+	.byte	0x1
+	.long	0x231f
+	.uleb128 0x19
+	.long	.LASF1398
+	.value	0x128
+	.byte	0x20
+	.long	0xec
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1399
+	.value	0x111
+	.long	0x2337
+	.uleb128 0x19
+	.long	.LASF1292
+	.value	0x111
+	.byte	0x28
+	.long	0x167d
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1400
+	.value	0x105
+	.long	0x234f
+	.uleb128 0x19
+	.long	.LASF1293
+	.value	0x105
+	.byte	0x2e
+	.long	0x234f
+	.byte	0
+	.uleb128 0x7
+	.long	0x793
+	.uleb128 0x23
+	.long	.LASF1401
+	.byte	0xfd
+	.long	0x236a
+	.uleb128 0x1b
+	.long	.LASF1271
+	.byte	0xfd
+	.byte	0x2c
+	.long	0x1750
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1402
+	.byte	0xf6
+	.long	0x2380
+	.uleb128 0x1b
+	.long	.LASF1270
+	.byte	0xf6
+	.byte	0x32
+	.long	0x1755
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1403
+	.byte	0xef
+	.long	0x2396
+	.uleb128 0x1b
+	.long	.LASF1275
+	.byte	0xef
+	.byte	0x34
+	.long	0x2396
+	.byte	0
+	.uleb128 0x7
+	.long	0x3e6
+	.uleb128 0x23
+	.long	.LASF1404
+	.byte	0xe7
+	.long	0x23b1
+	.uleb128 0x1b
+	.long	.LASF1248
+	.byte	0xe7
+	.byte	0x2e
+	.long	0x16b5
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1406
+	.byte	0xac
+	.long	0x23c7
+	.uleb128 0x1b
+	.long	.LASF1240
+	.byte	0xac
+	.byte	0x2b
+	.long	0x16f2
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1407
+	.byte	0xa5
+	.long	0x23dd
+	.uleb128 0x1b
+	.long	.LASF1245
+	.byte	0xa5
+	.byte	0x3c
+	.long	0x177a
+	.byte	0
+	.uleb128 0x16
+	.long	0x239b
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2400
+	.uleb128 0x1c
+	.long	0x23a5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x2380
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2423
+	.uleb128 0x1c
+	.long	0x238a
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x236a
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2446
+	.uleb128 0x1c
+	.long	0x2374
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x2354
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2469
+	.uleb128 0x1c
+	.long	0x235e
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x2337
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x248c
+	.uleb128 0x1c
+	.long	0x2342
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x231f
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x24e0
+	.uleb128 0xa
+	.long	0x232a
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xd
+	.quad	.LVL33
+	.long	0x17fe
+	.long	0x24cc
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x27
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL34
+	.long	0x17fe
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x1b10
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2524
+	.uleb128 0x1a
+	.quad	.LVL85
+	.long	0x15c5
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configStorage
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x186a
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x254d
+	.uleb128 0xa
+	.long	0x187c
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x16
+	.long	0x1852
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2570
+	.uleb128 0x1c
+	.long	0x185d
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x183a
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2599
+	.uleb128 0xa
+	.long	0x1845
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.uleb128 0x3f
+	.long	0x1833
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 0
+.LLST34:
+	.byte	0x6
+	.quad	.LVL105
+	.byte	0x4
+	.uleb128 .LVL105-.LVL105
+	.uleb128 .LVL106-1-.LVL105
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL106-1-.LVL105
+	.uleb128 .LFE24-.LVL105
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU623
+	.uleb128 .LVU626
+.LLST33:
+	.byte	0x8
+	.quad	.LVL99
+	.uleb128 .LVL100-.LVL99
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig+2008
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU585
+	.uleb128 .LVU587
+	.uleb128 .LVU588
+	.uleb128 .LVU589
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+.LLST30:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL87-.LVL86
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.LVL86
+	.uleb128 .LVL89-.LVL86
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.LVL86
+	.uleb128 .LVL91-.LVL86
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU543
+	.uleb128 .LVU546
+.LLST29:
+	.byte	0x8
+	.quad	.LVL74
+	.uleb128 .LVL75-.LVL74
+	.uleb128 0x9
+	.byte	0x3
+	.quad	masterConfig+2008
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU464
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU470
+	.uleb128 .LVU491
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU512
+.LLST13:
+	.byte	0x6
+	.quad	.LVL57
+	.byte	0x4
+	.uleb128 .LVL57-.LVL57
+	.uleb128 .LVL60-.LVL57
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.LVL57
+	.uleb128 .LVL61-.LVL57
+	.uleb128 0xa
+	.byte	0x3
+	.quad	masterConfig+340
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.LVL57
+	.uleb128 .LVL67-.LVL57
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL67-.LVL57
+	.uleb128 .LVL69-.LVL57
+	.uleb128 0xa
+	.byte	0x3
+	.quad	masterConfig+340
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU424
+	.uleb128 .LVU427
+.LLST14:
+	.byte	0x8
+	.quad	.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x2000
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU431
+	.uleb128 .LVU433
+.LLST15:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL51-.LVL51
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU436
+	.uleb128 .LVU439
+.LLST16:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL53-.LVL52
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x2000
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU441
+	.uleb128 .LVU443
+.LLST17:
+	.byte	0x8
+	.quad	.LVL53
+	.uleb128 .LVL53-.LVL53
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x4000
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU446
+	.uleb128 .LVU448
+	.uleb128 .LVU478
+	.uleb128 .LVU480
+.LLST19:
+	.byte	0x8
+	.quad	.LVL54
+	.uleb128 .LVL54-.LVL54
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL62
+	.uleb128 .LVL62-.LVL62
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU452
+	.uleb128 .LVU455
+.LLST20:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU457
+	.uleb128 .LVU459
+	.uleb128 .LVU482
+	.uleb128 .LVU484
+.LLST22:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LVL56-.LVL56
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x2000
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL62
+	.uleb128 .LVL62-.LVL62
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x2000
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU473
+	.uleb128 .LVU476
+.LLST23:
+	.byte	0x8
+	.quad	.LVL61
+	.uleb128 .LVL62-.LVL61
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU487
+	.uleb128 .LVU491
+.LLST24:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL64-.LVL63
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU493
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU510
+.LLST26:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL67-.LVL64
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL67-.LVL64
+	.uleb128 .LVL68-.LVL64
+	.uleb128 0xa
+	.byte	0x3
+	.quad	masterConfig+340
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU253
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU258
+	.uleb128 .LVU276
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU281
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL15
+	.uleb128 .LVL20-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.LVL15
+	.uleb128 .LVL21-.LVL15
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	masterConfig+16
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL15
+	.uleb128 .LVL22-.LVL15
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	masterConfig+16
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL15
+	.uleb128 .LVL23-.LVL15
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	masterConfig+32
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL15
+	.uleb128 .LVL24-.LVL15
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL15
+	.uleb128 .LVL25-.LVL15
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL15
+	.uleb128 .LFE9-.LVL15
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU91
+	.uleb128 .LVU95
+.LLST2:
+	.byte	0x8
+	.quad	.LVL4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 0xa
+	.byte	0x3
+	.quad	masterConfig+208
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU19
+	.uleb128 .LVU25
+.LLST4:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU102
+	.uleb128 .LVU122
+.LLST6:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL8-.LVL5
+	.uleb128 0xa
+	.byte	0x3
+	.quad	masterConfig+340
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU44
+	.uleb128 .LVU49
+.LLST8:
+	.byte	0x8
+	.quad	.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU222
+	.uleb128 .LVU230
+.LLST11:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x4
+	.byte	0x70
+	.sleb128 112
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU343
+	.uleb128 .LVU343
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL31
+	.byte	0x4
+	.uleb128 .LVL31-.LVL31
+	.uleb128 .LVL32-.LVL31
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.LVL31
+	.uleb128 .LVL35-.LVL31
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.LVL31
+	.uleb128 .LFE7-.LVL31
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 0
+.LLST35:
+	.byte	0x6
+	.quad	.LVL109
+	.byte	0x4
+	.uleb128 .LVL109-.LVL109
+	.uleb128 .LVL110-.LVL109
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.LVL109
+	.uleb128 .LFE25-.LVL109
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 0
+.LLST36:
+	.byte	0x6
+	.quad	.LVL112
+	.byte	0x4
+	.uleb128 .LVL112-.LVL112
+	.uleb128 .LVL113-.LVL112
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.LVL112
+	.uleb128 .LFE27-.LVL112
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 0
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x1ac
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x5
+	.quad	.LBB76
+	.byte	0x4
+	.uleb128 .LBB76-.LBB76
+	.uleb128 .LBE76-.LBB76
+	.byte	0x4
+	.uleb128 .LBB89-.LBB76
+	.uleb128 .LBE89-.LBB76
+	.byte	0x4
+	.uleb128 .LBB94-.LBB76
+	.uleb128 .LBE94-.LBB76
+	.byte	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB80
+	.byte	0x4
+	.uleb128 .LBB80-.LBB80
+	.uleb128 .LBE80-.LBB80
+	.byte	0x4
+	.uleb128 .LBB83-.LBB80
+	.uleb128 .LBE83-.LBB80
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB84
+	.byte	0x4
+	.uleb128 .LBB84-.LBB84
+	.uleb128 .LBE84-.LBB84
+	.byte	0x4
+	.uleb128 .LBB95-.LBB84
+	.uleb128 .LBE95-.LBB84
+	.byte	0x4
+	.uleb128 .LBB96-.LBB84
+	.uleb128 .LBE96-.LBB84
+	.byte	0x4
+	.uleb128 .LBB97-.LBB84
+	.uleb128 .LBE97-.LBB84
+	.byte	0
+.LLRL7:
+	.byte	0x5
+	.quad	.LBB90
+	.byte	0x4
+	.uleb128 .LBB90-.LBB90
+	.uleb128 .LBE90-.LBB90
+	.byte	0x4
+	.uleb128 .LBB93-.LBB90
+	.uleb128 .LBE93-.LBB90
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB98
+	.byte	0x4
+	.uleb128 .LBB98-.LBB98
+	.uleb128 .LBE98-.LBB98
+	.byte	0x4
+	.uleb128 .LBB106-.LBB98
+	.uleb128 .LBE106-.LBB98
+	.byte	0x4
+	.uleb128 .LBB107-.LBB98
+	.uleb128 .LBE107-.LBB98
+	.byte	0x4
+	.uleb128 .LBB108-.LBB98
+	.uleb128 .LBE108-.LBB98
+	.byte	0x4
+	.uleb128 .LBB109-.LBB98
+	.uleb128 .LBE109-.LBB98
+	.byte	0x4
+	.uleb128 .LBB110-.LBB98
+	.uleb128 .LBE110-.LBB98
+	.byte	0x4
+	.uleb128 .LBB111-.LBB98
+	.uleb128 .LBE111-.LBB98
+	.byte	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB112
+	.byte	0x4
+	.uleb128 .LBB112-.LBB112
+	.uleb128 .LBE112-.LBB112
+	.byte	0x4
+	.uleb128 .LBB115-.LBB112
+	.uleb128 .LBE115-.LBB112
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB152
+	.byte	0x4
+	.uleb128 .LBB152-.LBB152
+	.uleb128 .LBE152-.LBB152
+	.byte	0x4
+	.uleb128 .LBB162-.LBB152
+	.uleb128 .LBE162-.LBB152
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB157
+	.byte	0x4
+	.uleb128 .LBB157-.LBB157
+	.uleb128 .LBE157-.LBB157
+	.byte	0x4
+	.uleb128 .LBB163-.LBB157
+	.uleb128 .LBE163-.LBB157
+	.byte	0
+.LLRL25:
+	.byte	0x5
+	.quad	.LBB166
+	.byte	0x4
+	.uleb128 .LBB166-.LBB166
+	.uleb128 .LBE166-.LBB166
+	.byte	0x4
+	.uleb128 .LBB169-.LBB166
+	.uleb128 .LBE169-.LBB166
+	.byte	0
+.LLRL27:
+	.byte	0x5
+	.quad	.LBB178
+	.byte	0x4
+	.uleb128 .LBB178-.LBB178
+	.uleb128 .LBE178-.LBB178
+	.byte	0x4
+	.uleb128 .LBB183-.LBB178
+	.uleb128 .LBE183-.LBB178
+	.byte	0x4
+	.uleb128 .LBB184-.LBB178
+	.uleb128 .LBE184-.LBB178
+	.byte	0x4
+	.uleb128 .LBB185-.LBB178
+	.uleb128 .LBE185-.LBB178
+	.byte	0
+.LLRL28:
+	.byte	0x5
+	.quad	.LBB186
+	.byte	0x4
+	.uleb128 .LBB186-.LBB186
+	.uleb128 .LBE186-.LBB186
+	.byte	0x4
+	.uleb128 .LBB191-.LBB186
+	.uleb128 .LBE191-.LBB186
+	.byte	0
+.LLRL31:
+	.byte	0x5
+	.quad	.LBB194
+	.byte	0x4
+	.uleb128 .LBB194-.LBB194
+	.uleb128 .LBE194-.LBB194
+	.byte	0x4
+	.uleb128 .LBB197-.LBB194
+	.uleb128 .LBE197-.LBB194
+	.byte	0
+.LLRL32:
+	.byte	0x5
+	.quad	.LBB204
+	.byte	0x4
+	.uleb128 .LBB204-.LBB204
+	.uleb128 .LBE204-.LBB204
+	.byte	0x4
+	.uleb128 .LBB210-.LBB204
+	.uleb128 .LBE210-.LBB204
+	.byte	0x4
+	.uleb128 .LBB213-.LBB204
+	.uleb128 .LBE213-.LBB204
+	.byte	0
+.LLRL37:
+	.byte	0x7
+	.quad	.LFB9
+	.uleb128 .LFE9-.LFB9
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 37 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF451
+	.file 41 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 42 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2a
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF505
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF578
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF596
+	.file 47 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2f
+	.file 48 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF619
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF505
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF679
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF683
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF684
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF747
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 55 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 56 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 57 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 58 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF796
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 59 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x22
+	.byte	0x4
+	.file 60 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 61 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF805
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x4
+	.file 62 ".//src/main/drivers/pwm_dshot.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF818
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xe
+	.file 63 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF819
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 64 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 65 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF891
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0x4
+	.file 66 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF912
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF448
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF504
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF515
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF516
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF577
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF604
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF614
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF618
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF634
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF676
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF678
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF682
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF746
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF450
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF610
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF614
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF618
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF750
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF448
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF782
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF790
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF795
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF804
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pwm_dshot.h.20.485dcb41a32f1d4cb454127a39399118,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF812
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF817
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF822
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF826
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF829
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_curves.h.20.bb55f38eb1f046d20ce020bb2f322596,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF869
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF883
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_storage.h.42.6f8ad26f0224a762e0a24d0e65392aaa,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF906
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF825:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF692:
+	.string	"INT32_MAX (2147483647)"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF817:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF827:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF634:
+	.string	"__STD_TYPE typedef"
+.LASF861:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1265:
+	.string	"gyro_sync"
+.LASF928:
+	.string	"int8_t"
+.LASF1171:
+	.string	"AUX2"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF812:
+	.string	"DSHOT_DEFAULT_RATE 600"
+.LASF955:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF918:
+	.string	"size_t"
+.LASF1288:
+	.string	"retarded_arm"
+.LASF753:
+	.string	"_STRINGS_H 1"
+.LASF1363:
+	.string	"useRxConfig"
+.LASF1153:
+	.string	"BOXPASSTHRU"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"ACC "
+.LASF1374:
+	.string	"useRcControlsConfig"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1411:
+	.string	"applyConfig"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1346:
+	.string	"CONFIG_SECTION_PROFILE_SELECTION"
+.LASF1333:
+	.string	"CONFIG_SECTION_ESC_AND_SERVO"
+.LASF755:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1040:
+	.string	"cli_baudrate"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF467:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF970:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF565:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF796:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF765:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF896:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF1084:
+	.string	"MULTITYPE_VTAIL4"
+.LASF816:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF1375:
+	.string	"generateThrottleCurve"
+.LASF479:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1217:
+	.string	"FEATURE_RX_PPM"
+.LASF484:
+	.string	"_DEFAULT_SOURCE"
+.LASF540:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1307:
+	.string	"configStorage_s"
+.LASF1330:
+	.string	"configStorage_t"
+.LASF1049:
+	.string	"telemetryProvider_e"
+.LASF738:
+	.string	"INT16_C(c) c"
+.LASF930:
+	.string	"int32_t"
+.LASF939:
+	.string	"PIDPITCH"
+.LASF452:
+	.string	"_FEATURES_H 1"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1020:
+	.string	"FUNCTION_CLI"
+.LASF842:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1263:
+	.string	"enabledFeatures"
+.LASF888:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1349:
+	.string	"parseRcChannels"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1270:
+	.string	"escAndServoConfig"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF728:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF804:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF873:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF967:
+	.string	"ALIGN_DEFAULT"
+.LASF733:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1353:
+	.string	"configStorageIsSaving"
+.LASF1142:
+	.string	"BOXARM"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1069:
+	.string	"MULTITYPE_QUADP"
+.LASF391:
+	.string	"true 1"
+.LASF832:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF552:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1070:
+	.string	"MULTITYPE_QUADX"
+.LASF667:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF843:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF707:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF533:
+	.string	"__END_DECLS "
+.LASF554:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF770:
+	.string	"USE_GYRO_SITL "
+.LASF654:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF871:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF469:
+	.string	"__USE_LARGEFILE64"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF679:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF878:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1131:
+	.string	"maxthrottle"
+.LASF1320:
+	.string	"state"
+.LASF527:
+	.string	"__P(args) args"
+.LASF857:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF760:
+	.string	"__enable_irq() "
+.LASF1122:
+	.string	"GimbalFlags"
+.LASF409:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1036:
+	.string	"serialPortFunctionScenario_e"
+.LASF958:
+	.string	"flightDynamicsTrims_def_t"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1101:
+	.string	"deadband3d_throttle"
+.LASF1388:
+	.string	"featureClearAll"
+.LASF647:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF801:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF868:
+	.string	"PITCH_LOOKUP_LENGTH 7"
+.LASF1400:
+	.string	"resetTelemetryConfig"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1340:
+	.string	"CONFIG_SECTION_SERIAL"
+.LASF1030:
+	.string	"SCENARIO_MSP_ONLY"
+.LASF444:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF956:
+	.string	"roll"
+.LASF1109:
+	.string	"boardAlignment_s"
+.LASF1113:
+	.string	"boardAlignment_t"
+.LASF1091:
+	.string	"motorMixer_t"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF423:
+	.string	"_GCC_SIZE_T "
+.LASF1401:
+	.string	"resetFlight3DConfig"
+.LASF1234:
+	.string	"FEATURE_DISPLAY"
+.LASF984:
+	.string	"accHardware"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1335:
+	.string	"CONFIG_SECTION_CALIBRATION"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF938:
+	.string	"PIDROLL"
+.LASF631:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1010:
+	.string	"baro_noise_lpf"
+.LASF515:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1253:
+	.string	"alt_hold_fast_change"
+.LASF1305:
+	.string	"CONFIG_STORAGE_FAILED"
+.LASF885:
+	.string	"LON 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF413:
+	.string	"_T_SIZE "
+.LASF592:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1379:
+	.string	"featureSet"
+.LASF945:
+	.string	"PIDLEVEL"
+.LASF695:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF716:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF455:
+	.string	"__USE_ISOC95"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF717:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF819:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF406:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF712:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF454:
+	.string	"__USE_ISOC99"
+.LASF470:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1373:
+	.string	"useGyroConfig"
+.LASF1403:
+	.string	"resetSensorAlignment"
+.LASF975:
+	.string	"CW270_DEG_FLIP"
+.LASF900:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1291:
+	.string	"fixedwing_althold_dir"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1327:
+	.string	"recordOffset"
+.LASF457:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF547:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF445:
+	.string	"NULL"
+.LASF762:
+	.string	"U_ID_1 0"
+.LASF1339:
+	.string	"CONFIG_SECTION_GPS"
+.LASF537:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF921:
+	.string	"__uint8_t"
+.LASF966:
+	.string	"inputFilteringMode_e"
+.LASF903:
+	.string	"CONFIG_STORAGE_HEADER_SIZE 8"
+.LASF1195:
+	.string	"failsafe_throttle"
+.LASF972:
+	.string	"CW0_DEG_FLIP"
+.LASF1317:
+	.string	"endOffset"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF656:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1230:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF789:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1006:
+	.string	"accDeadband_s"
+.LASF1007:
+	.string	"accDeadband_t"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1100:
+	.string	"neutral3d"
+.LASF772:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1227:
+	.string	"FEATURE_TELEMETRY"
+.LASF897:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF996:
+	.string	"ACC_DEFAULT"
+.LASF564:
+	.string	"__always_inline"
+.LASF411:
+	.string	"_SYS_SIZE_T_H "
+.LASF1189:
+	.string	"rollPitchRate"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF477:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF688:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF513:
+	.string	"__GLIBC__ 2"
+.LASF481:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1313:
+	.string	"sectionCount"
+.LASF913:
+	.string	"long int"
+.LASF505:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF869:
+	.string	"THROTTLE_LOOKUP_LENGTH 12"
+.LASF977:
+	.string	"sensorAlignmentConfig_s"
+.LASF981:
+	.string	"sensorAlignmentConfig_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF482:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF499:
+	.string	"__USE_XOPEN2K8 1"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF815:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1212:
+	.string	"OK_TO_ARM"
+.LASF401:
+	.string	"_PTRDIFF_T_ "
+.LASF408:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1005:
+	.string	"ACC_NONE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1257:
+	.string	"failsafeConfig"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF940:
+	.string	"PIDYAW"
+.LASF754:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF676:
+	.string	"__FD_SETSIZE 1024"
+.LASF1196:
+	.string	"failsafe_min_usec"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1025:
+	.string	"FUNCTION_BLACKBOX"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF661:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1303:
+	.string	"CONFIG_STORAGE_ERASING"
+.LASF882:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF889:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1407:
+	.string	"resetAccelerometerTrims"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF655:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF561:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1310:
+	.string	"pageSize"
+.LASF420:
+	.string	"_SIZE_T_DECLARED "
+.LASF529:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF652:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF836:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1072:
+	.string	"MULTITYPE_GIMBAL"
+.LASF1112:
+	.string	"yawDegrees"
+.LASF1162:
+	.string	"BOXAUTOTUNE"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF730:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF581:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1115:
+	.string	"vbatscale"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF951:
+	.string	"dterm_lpf_hz"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1233:
+	.string	"FEATURE_LED_STRIP"
+.LASF450:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF637:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1383:
+	.string	"saveConfigAndNotify"
+.LASF887:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF468:
+	.string	"__USE_LARGEFILE"
+.LASF1004:
+	.string	"ACC_FAKE"
+.LASF794:
+	.string	"HSV_VALUE_MAX 255"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF510:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF520:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF542:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF798:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF920:
+	.string	"signed char"
+.LASF1222:
+	.string	"FEATURE_SERVO_TILT"
+.LASF931:
+	.string	"uint8_t"
+.LASF1278:
+	.string	"acc_hardware"
+.LASF621:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1190:
+	.string	"yawRate"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1168:
+	.string	"PITCH"
+.LASF985:
+	.string	"baroHardware"
+.LASF1368:
+	.string	"configureImu"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF508:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF549:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1216:
+	.string	"armingFlags"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF521:
+	.string	"__LEAF , __leaf__"
+.LASF1086:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF1276:
+	.string	"boardAlignment"
+.LASF1391:
+	.string	"readEEPROMAndNotify"
+.LASF504:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1386:
+	.string	"processEEPROMWrite"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1161:
+	.string	"BOXTELEMETRY"
+.LASF1035:
+	.string	"SCENARIO_BLACKBOX_ONLY"
+.LASF480:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF915:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF487:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1187:
+	.string	"thrMid8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF518:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF708:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1021:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF779:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF421:
+	.string	"__DEFINED_size_t "
+.LASF619:
+	.string	"_BITS_TYPES_H 1"
+.LASF526:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1031:
+	.string	"SCENARIO_MSP_CLI_GPS_PASTHROUGH"
+.LASF1254:
+	.string	"throttle_correction_angle"
+.LASF1081:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF485:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1384:
+	.string	"resetEEPROM"
+.LASF1357:
+	.string	"configStorageStoredSectionCount"
+.LASF775:
+	.string	"USE_USART1 "
+.LASF1095:
+	.string	"tri_unarmed_servo"
+.LASF1322:
+	.string	"eraseOffset"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1002:
+	.string	"ACC_SPI_MPU6000"
+.LASF390:
+	.string	"bool _Bool"
+.LASF742:
+	.string	"UINT16_C(c) c"
+.LASF1082:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF1397:
+	.string	"servoRates"
+.LASF1014:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1251:
+	.string	"yaw_deadband"
+.LASF687:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF867:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1306:
+	.string	"configStorageState_e"
+.LASF1017:
+	.string	"_Bool"
+.LASF813:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1003:
+	.string	"ACC_SPI_MPU6500"
+.LASF566:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1218:
+	.string	"FEATURE_VBAT"
+.LASF852:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF711:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF417:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF968:
+	.string	"CW0_DEG"
+.LASF752:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF663:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF758:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF703:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1148:
+	.string	"BOXHEADADJ"
+.LASF948:
+	.string	"PID_ITEM_COUNT"
+.LASF927:
+	.string	"char"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF639:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1228:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1318:
+	.string	"appendable"
+.LASF1152:
+	.string	"BOXGPSHOLD"
+.LASF1381:
+	.string	"feature"
+.LASF602:
+	.string	"__stub_setlogin "
+.LASF1000:
+	.string	"ACC_BMA280"
+.LASF749:
+	.string	"__need_size_t "
+.LASF1099:
+	.string	"deadband3d_high"
+.LASF853:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF624:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF646:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF476:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1406:
+	.string	"resetPidProfile"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF739:
+	.string	"INT32_C(c) c"
+.LASF569:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF950:
+	.string	"H_level"
+.LASF747:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF496:
+	.string	"__USE_POSIX199309 1"
+.LASF924:
+	.string	"__uint16_t"
+.LASF555:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1034:
+	.string	"SCENARIO_TELEMETRY_ONLY"
+.LASF464:
+	.string	"__USE_XOPEN2K"
+.LASF743:
+	.string	"UINT32_C(c) c ## U"
+.LASF500:
+	.string	"_ATFILE_SOURCE"
+.LASF999:
+	.string	"ACC_MMA8452"
+.LASF750:
+	.string	"__need_NULL "
+.LASF1087:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF1133:
+	.string	"escAndServoConfig_t"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF767:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF567:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF603:
+	.string	"__stub_sigreturn "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1159:
+	.string	"BOXGOV"
+.LASF1259:
+	.string	"gimbalConfig"
+.LASF714:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF910:
+	.string	"EEPROM_CONF_VERSION 90"
+.LASF1138:
+	.string	"mincheck"
+.LASF1399:
+	.string	"resetSerialConfig"
+.LASF757:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF627:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1213:
+	.string	"PREVENT_ARMING"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1151:
+	.string	"BOXGPSHOME"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF635:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF906:
+	.string	"CONFIG_STORAGE_COMPACTED_SIZE(size,sectionCount) (CONFIG_STORAGE_HEADER_SIZE + (size) + (sectionCount) * (CONFIG_STORAGE_RECORD_HEADER_SIZE + 3))"
+.LASF606:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF722:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF459:
+	.string	"__USE_POSIX199309"
+.LASF693:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF371:
+	.string	"__linux 1"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1395:
+	.string	"activateConfig"
+.LASF732:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1143:
+	.string	"BOXANGLE"
+.LASF1243:
+	.string	"tpa_breakpoint"
+.LASF1360:
+	.string	"configStorageInit"
+.LASF943:
+	.string	"PIDPOSR"
+.LASF1365:
+	.string	"calculateAccZLowPassFilterRCTimeConstant"
+.LASF435:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1301:
+	.string	"configStorageSection_t"
+.LASF463:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF562:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1224:
+	.string	"FEATURE_GPS"
+.LASF764:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF677:
+	.string	"_BITS_TIME64_H 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF577:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1008:
+	.string	"barometerConfig_s"
+.LASF1013:
+	.string	"barometerConfig_t"
+.LASF439:
+	.string	"__INT_WCHAR_T_H "
+.LASF837:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF625:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF426:
+	.string	"__need_size_t"
+.LASF1092:
+	.string	"throttle"
+.LASF879:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF670:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF856:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1009:
+	.string	"baro_sample_count"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF797:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF461:
+	.string	"__USE_XOPEN"
+.LASF710:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF536:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF821:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF672:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF662:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF838:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1249:
+	.string	"modeActivationConditions"
+.LASF578:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1149:
+	.string	"BOXCAMSTAB"
+.LASF651:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF961:
+	.string	"rollAndPitchTrims_s"
+.LASF963:
+	.string	"rollAndPitchTrims_t"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1323:
+	.string	"attemptsRemaining"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF768:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1155:
+	.string	"BOXLEDMAX"
+.LASF720:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1332:
+	.string	"CONFIG_SECTION_MIXER"
+.LASF884:
+	.string	"LAT 0"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1343:
+	.string	"CONFIG_SECTION_PROFILE_1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF811:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF590:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF528:
+	.string	"__PMT(args) args"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF503:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1269:
+	.string	"customMixer"
+.LASF822:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF543:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1385:
+	.string	"ensureEEPROMContainsValidData"
+.LASF1124:
+	.string	"GIMBAL_MIXTILT"
+.LASF1231:
+	.string	"FEATURE_RX_MSP"
+.LASF1107:
+	.string	"rate"
+.LASF1241:
+	.string	"controlRateConfig"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF713:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF446:
+	.string	"NULL ((void *)0)"
+.LASF1266:
+	.string	"gyro_sync_denom"
+.LASF489:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF414:
+	.string	"__SIZE_T "
+.LASF633:
+	.string	"__U64_TYPE unsigned long int"
+.LASF769:
+	.string	"GYRO "
+.LASF559:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF447:
+	.string	"__need_NULL"
+.LASF402:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF745:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1033:
+	.string	"SCENARIO_SERIAL_RX_ONLY"
+.LASF824:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF451:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF630:
+	.string	"__SLONG32_TYPE int"
+.LASF735:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF473:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF895:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF453:
+	.string	"__USE_ISOC11"
+.LASF1110:
+	.string	"rollDegrees"
+.LASF556:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF682:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF684:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1221:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1059:
+	.string	"frsky_inversion"
+.LASF659:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1285:
+	.string	"batteryConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1166:
+	.string	"rc_alias"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1178:
+	.string	"modeActivationCondition_s"
+.LASF1183:
+	.string	"modeActivationCondition_t"
+.LASF653:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF809:
+	.string	"DSHOT_DISARMED 0"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1246:
+	.string	"accz_lpf_cutoff"
+.LASF914:
+	.string	"long unsigned int"
+.LASF694:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1237:
+	.string	"FEATURE_DSHOT"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1071:
+	.string	"MULTITYPE_BI"
+.LASF1111:
+	.string	"pitchDegrees"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF978:
+	.string	"gyro_align"
+.LASF1104:
+	.string	"flaps_speed"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1290:
+	.string	"airplaneConfig"
+.LASF588:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF412:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1308:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1108:
+	.string	"forwardFromChannel"
+.LASF1215:
+	.string	"sitlFlash"
+.LASF471:
+	.string	"__USE_MISC"
+.LASF1312:
+	.string	"sections"
+.LASF783:
+	.string	"UNUSED(x) (void)(x)"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF763:
+	.string	"U_ID_2 0"
+.LASF982:
+	.string	"knownSensors_s"
+.LASF989:
+	.string	"knownSensors_t"
+.LASF572:
+	.string	"__restrict_arr __restrict"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1369:
+	.string	"mixerUseConfigs"
+.LASF1409:
+	.string	"featureMask"
+.LASF874:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1135:
+	.string	"rcmap"
+.LASF1286:
+	.string	"rxConfig"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1275:
+	.string	"sensorAlignmentConfig"
+.LASF448:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF973:
+	.string	"CW90_DEG_FLIP"
+.LASF1079:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF553:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1127:
+	.string	"gimbal_flags"
+.LASF657:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1080:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF934:
+	.string	"uintptr_t"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF980:
+	.string	"mag_align"
+.LASF1347:
+	.string	"configSections"
+.LASF806:
+	.string	"DSHOT_FRAME_BITS 16"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1066:
+	.string	"AccelSensors"
+.LASF777:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF761:
+	.string	"U_ID_0 0x5349544c"
+.LASF971:
+	.string	"CW270_DEG"
+.LASF403:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF835:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF519:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1210:
+	.string	"small_angle"
+.LASF1098:
+	.string	"deadband3d_low"
+.LASF398:
+	.string	"_T_PTRDIFF_ "
+.LASF898:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF550:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF472:
+	.string	"__USE_ATFILE"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF683:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF492:
+	.string	"_POSIX_C_SOURCE"
+.LASF1207:
+	.string	"attitude_estimator"
+.LASF1050:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF854:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1223:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1296:
+	.string	"current_profile_index"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF671:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF790:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF1336:
+	.string	"CONFIG_SECTION_BATTERY"
+.LASF1053:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF430:
+	.string	"_T_WCHAR_ "
+.LASF1117:
+	.string	"vbatmincellvoltage"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF373:
+	.string	"linux 1"
+.LASF1123:
+	.string	"GIMBAL_NORMAL"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF458:
+	.string	"__USE_POSIX2"
+.LASF860:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF1371:
+	.string	"useFailsafeConfig"
+.LASF1204:
+	.string	"acc_unarmedcal"
+.LASF686:
+	.string	"INT8_MIN (-128)"
+.LASF926:
+	.string	"__uint32_t"
+.LASF674:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF415:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1380:
+	.string	"mask"
+.LASF1341:
+	.string	"CONFIG_SECTION_TELEMETRY"
+.LASF1302:
+	.string	"CONFIG_STORAGE_IDLE"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF427:
+	.string	"__wchar_t__ "
+.LASF1279:
+	.string	"gyro_lpf"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1256:
+	.string	"servoConf"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF862:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF449:
+	.string	"_STDINT_H 1"
+.LASF1297:
+	.string	"masterConfig"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1068:
+	.string	"MULTITYPE_TRI"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1392:
+	.string	"readEEPROM"
+.LASF1118:
+	.string	"currentMeterScale"
+.LASF858:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1277:
+	.string	"yaw_control_direction"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1181:
+	.string	"rangeStartStep"
+.LASF576:
+	.string	"__attribute_copy__"
+.LASF1201:
+	.string	"ATTITUDE_ESTIMATOR_COUNT"
+.LASF912:
+	.string	"CONFIG_SECTION_COUNT (sizeof(configSections) / sizeof(configSections[0]))"
+.LASF432:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF986:
+	.string	"calibrated"
+.LASF1225:
+	.string	"FEATURE_FAILSAFE"
+.LASF976:
+	.string	"sensor_align_e"
+.LASF904:
+	.string	"CONFIG_STORAGE_RECORD_HEADER_SIZE 8"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1206:
+	.string	"gyro_cmpfm_factor"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1405:
+	.string	"setProfile"
+.LASF1248:
+	.string	"barometerConfig"
+.LASF865:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1136:
+	.string	"serialrx_provider"
+.LASF1119:
+	.string	"currentMeterOffset"
+.LASF1309:
+	.string	"slotSize"
+.LASF1289:
+	.string	"disarm_kill_switch"
+.LASF1284:
+	.string	"knownSensors"
+.LASF850:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1229:
+	.string	"FEATURE_3D"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF665:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1165:
+	.string	"boxId_e"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1056:
+	.string	"telemetryConfig_s"
+.LASF1065:
+	.string	"telemetryConfig_t"
+.LASF1083:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF1037:
+	.string	"serialConfig_s"
+.LASF1044:
+	.string	"serialConfig_t"
+.LASF1295:
+	.string	"profile"
+.LASF1348:
+	.string	"configStorage"
+.LASF438:
+	.string	"___int_wchar_t_h "
+.LASF626:
+	.string	"__SQUAD_TYPE long int"
+.LASF629:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1085:
+	.string	"MULTITYPE_HEX6H"
+.LASF952:
+	.string	"float"
+.LASF465:
+	.string	"__USE_XOPEN2KXSI"
+.LASF998:
+	.string	"ACC_MPU6050"
+.LASF475:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1367:
+	.string	"configureAltitudeHold"
+.LASF875:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF531:
+	.string	"__ptr_t void *"
+.LASF799:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1047:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1077:
+	.string	"MULTITYPE_HEX6X"
+.LASF1094:
+	.string	"yaw_direction"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF1283:
+	.string	"magZero"
+.LASF587:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF814:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1319:
+	.string	"stored"
+.LASF917:
+	.string	"unsigned int"
+.LASF681:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF786:
+	.string	"UNIT_TESTED "
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1404:
+	.string	"resetBarometerConfig"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF397:
+	.string	"_PTRDIFF_T "
+.LASF1280:
+	.string	"gyroConfig"
+.LASF901:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1350:
+	.string	"resetRollAndPitchTrims"
+.LASF1199:
+	.string	"ATTITUDE_ESTIMATOR_COMPLEMENTARY"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF441:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1197:
+	.string	"failsafe_max_usec"
+.LASF1281:
+	.string	"max_angle_inclination"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF498:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF834:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF636:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF839:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF623:
+	.string	"__U32_TYPE unsigned int"
+.LASF490:
+	.string	"_POSIX_SOURCE"
+.LASF1018:
+	.string	"FUNCTION_NONE"
+.LASF1328:
+	.string	"dataOffset"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF548:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF642:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF724:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1097:
+	.string	"flight3DConfig_s"
+.LASF1102:
+	.string	"flight3DConfig_t"
+.LASF944:
+	.string	"PIDNAVR"
+.LASF574:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF600:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF705:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1140:
+	.string	"rssi_channel"
+.LASF660:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF698:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF863:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF791:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF563:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF793:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1193:
+	.string	"failsafe_delay"
+.LASF1316:
+	.string	"sequence"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1180:
+	.string	"auxChannelIndex"
+.LASF859:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF737:
+	.string	"INT8_C(c) c"
+.LASF845:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF405:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1300:
+	.string	"offset"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF512:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1125:
+	.string	"GIMBAL_FORWARDAUX"
+.LASF1205:
+	.string	"gyro_cmpf_factor"
+.LASF847:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1032:
+	.string	"SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH"
+.LASF1011:
+	.string	"baro_cf_vel"
+.LASF1232:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1012:
+	.string	"baro_cf_alt"
+.LASF1203:
+	.string	"acc_lpf_hz"
+.LASF1376:
+	.string	"generatePitchCurve"
+.LASF1378:
+	.string	"featureClear"
+.LASF891:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1145:
+	.string	"BOXBARO"
+.LASF524:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF579:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF792:
+	.string	"HSV_HUE_MAX 359"
+.LASF1268:
+	.string	"emf_avoidance"
+.LASF1039:
+	.string	"msp_baudrate"
+.LASF1156:
+	.string	"BOXLEDLOW"
+.LASF396:
+	.string	"_ANSI_STDDEF_H "
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF673:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF422:
+	.string	"___int_size_t_h "
+.LASF640:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF530:
+	.string	"__STRING(x) #x"
+.LASF429:
+	.string	"_WCHAR_T "
+.LASF778:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF954:
+	.string	"pidProfile_s"
+.LASF953:
+	.string	"pidProfile_t"
+.LASF1063:
+	.string	"frsky_unit"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF893:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF751:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF802:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF404:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1311:
+	.string	"layout"
+.LASF575:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF987:
+	.string	"gyroZero"
+.LASF1294:
+	.string	"blackbox_rate_denom"
+.LASF525:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF586:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF410:
+	.string	"_SIZE_T "
+.LASF437:
+	.string	"_WCHAR_T_H "
+.LASF534:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1157:
+	.string	"BOXLLIGHTS"
+.LASF841:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF988:
+	.string	"baroGroundPressure"
+.LASF726:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF701:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF700:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1272:
+	.string	"motor_pwm_rate"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF828:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF545:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF991:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF829:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF648:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1261:
+	.string	"master_t"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1271:
+	.string	"flight3DConfig"
+.LASF994:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1089:
+	.string	"MULTITYPE_CUSTOM"
+.LASF1184:
+	.string	"controlRateConfig_s"
+.LASF1163:
+	.string	"BOXSONAR"
+.LASF1304:
+	.string	"CONFIG_STORAGE_WRITING"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF780:
+	.string	"BLACKBOX "
+.LASF558:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1062:
+	.string	"frsky_coordinate_format"
+.LASF1315:
+	.string	"activeSlot"
+.LASF1382:
+	.string	"changeProfile"
+.LASF1393:
+	.string	"initEEPROM"
+.LASF591:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1093:
+	.string	"mixerConfig_s"
+.LASF1096:
+	.string	"mixerConfig_t"
+.LASF1137:
+	.string	"midrc"
+.LASF1236:
+	.string	"FEATURE_ONESHOT125"
+.LASF974:
+	.string	"CW180_DEG_FLIP"
+.LASF1042:
+	.string	"gps_passthrough_baudrate"
+.LASF807:
+	.string	"DSHOT_FRAME_TRAILING_SLOTS 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF462:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1067:
+	.string	"MultiType"
+.LASF805:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF1372:
+	.string	"setPIDController"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1058:
+	.string	"telemetry_switch"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF532:
+	.string	"__BEGIN_DECLS "
+.LASF1202:
+	.string	"imuRuntimeConfig_s"
+.LASF440:
+	.string	"_GCC_WCHAR_T "
+.LASF702:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF399:
+	.string	"_T_PTRDIFF "
+.LASF709:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF715:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF589:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF560:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF497:
+	.string	"__USE_POSIX199506 1"
+.LASF919:
+	.string	"__int8_t"
+.LASF947:
+	.string	"PIDVEL"
+.LASF685:
+	.string	"__intptr_t_defined "
+.LASF941:
+	.string	"PIDALT"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF866:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1314:
+	.string	"size"
+.LASF1144:
+	.string	"BOXHORIZON"
+.LASF1016:
+	.string	"serialInversion_e"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF773:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF456:
+	.string	"__USE_ISOCXX11"
+.LASF418:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF932:
+	.string	"uint16_t"
+.LASF800:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF1209:
+	.string	"dcm_ki"
+.LASF400:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF964:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF1377:
+	.string	"lookupScenarioIndex"
+.LASF706:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1208:
+	.string	"dcm_kp"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF493:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF675:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1390:
+	.string	"writeEEPROM"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF787:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1338:
+	.string	"CONFIG_SECTION_AIRPLANE"
+.LASF1139:
+	.string	"maxcheck"
+.LASF1022:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF1026:
+	.string	"SCENARIO_UNUSED"
+.LASF1164:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF460:
+	.string	"__USE_POSIX199506"
+.LASF1052:
+	.string	"frskyGpsCoordFormat_e"
+.LASF1054:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF538:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1185:
+	.string	"rcRate8"
+.LASF1150:
+	.string	"BOXCAMTRIG"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1255:
+	.string	"throttle_correction_value"
+.LASF502:
+	.string	"__WORDSIZE 64"
+.LASF1293:
+	.string	"telemetryConfig"
+.LASF425:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF604:
+	.string	"__stub_stty "
+.LASF810:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF644:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF759:
+	.string	"__disable_irq() "
+.LASF1214:
+	.string	"ARMED"
+.LASF820:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF1408:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF946:
+	.string	"PIDMAG"
+.LASF1132:
+	.string	"mincommand"
+.LASF632:
+	.string	"__S64_TYPE long int"
+.LASF416:
+	.string	"_BSD_SIZE_T_ "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF535:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF808:
+	.string	"DSHOT_FRAME_SLOTS (DSHOT_FRAME_BITS + DSHOT_FRAME_TRAILING_SLOTS)"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1120:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF1352:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF908:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 400"
+.LASF431:
+	.string	"_T_WCHAR "
+.LASF622:
+	.string	"__S32_TYPE int"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF696:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF883:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF1105:
+	.string	"servoParam_t"
+.LASF922:
+	.string	"__int16_t"
+.LASF557:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF833:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1412:
+	.string	"isEEPROMContentValid"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF649:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF734:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF748:
+	.string	"_STRING_H 1"
+.LASF1242:
+	.string	"dynThrPID"
+.LASF680:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF823:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF740:
+	.string	"INT64_C(c) c ## L"
+.LASF1361:
+	.string	"isSerialConfigValid"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF434:
+	.string	"_BSD_WCHAR_T_ "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1264:
+	.string	"looptime"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF960:
+	.string	"flightDynamicsTrims_t"
+.LASF1387:
+	.string	"eraseAllowed"
+.LASF1355:
+	.string	"configStorageStartSave"
+.LASF990:
+	.string	"gyroConfig_s"
+.LASF995:
+	.string	"gyroConfig_t"
+.LASF1043:
+	.string	"reboot_character"
+.LASF1358:
+	.string	"configStorageLoad"
+.LASF782:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1027:
+	.string	"SCENARIO_CLI_ONLY"
+.LASF1064:
+	.string	"batterySize"
+.LASF890:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF959:
+	.string	"values"
+.LASF937:
+	.string	"RGB_BLUE"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF905:
+	.string	"CONFIG_STORAGE_MAX_SECTIONS 16"
+.LASF1106:
+	.string	"middle"
+.LASF1169:
+	.string	"THROTTLE"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF851:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1191:
+	.string	"controlRateConfig_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF598:
+	.string	"__stub_chflags "
+.LASF474:
+	.string	"__USE_GNU"
+.LASF1321:
+	.string	"spareErased"
+.LASF424:
+	.string	"_SIZET_ "
+.LASF666:
+	.string	"__TIMER_T_TYPE void *"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF830:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF541:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF846:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1074:
+	.string	"MULTITYPE_HEX6"
+.LASF1240:
+	.string	"pidProfile"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF965:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF585:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF892:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF568:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF997:
+	.string	"ACC_ADXL345"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF844:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF1250:
+	.string	"deadband"
+.LASF1219:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF795:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1398:
+	.string	"profileIndex"
+.LASF1015:
+	.string	"SERIAL_INVERTED"
+.LASF718:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1239:
+	.string	"pidController"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1282:
+	.string	"accZero"
+.LASF942:
+	.string	"PIDPOS"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1235:
+	.string	"FEATURE_BLACKBOX"
+.LASF1370:
+	.string	"setAccelerationTrims"
+.LASF506:
+	.string	"__USE_MISC 1"
+.LASF1252:
+	.string	"alt_hold_deadband"
+.LASF1366:
+	.string	"calculateThrottleAngleScale"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1331:
+	.string	"CONFIG_SECTION_SYSTEM"
+.LASF594:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1188:
+	.string	"thrExpo8"
+.LASF744:
+	.string	"UINT64_C(c) c ## UL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF923:
+	.string	"short int"
+.LASF394:
+	.string	"_STDDEF_H "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1060:
+	.string	"gpsNoFixLatitude"
+.LASF1226:
+	.string	"FEATURE_SONAR"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF571:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF721:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF516:
+	.string	"_SYS_CDEFS_H 1"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF690:
+	.string	"INT8_MAX (127)"
+.LASF983:
+	.string	"gyroHardware"
+.LASF831:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1114:
+	.string	"batteryConfig_s"
+.LASF1121:
+	.string	"batteryConfig_t"
+.LASF1274:
+	.string	"servo_pwm_rate"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF929:
+	.string	"int16_t"
+.LASF1088:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF1073:
+	.string	"MULTITYPE_Y6"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF776:
+	.string	"USE_USART2 "
+.LASF583:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1061:
+	.string	"gpsNoFixLongitude"
+.LASF1344:
+	.string	"CONFIG_SECTION_PROFILE_2"
+.LASF1345:
+	.string	"CONFIG_SECTION_PROFILE_3"
+.LASF511:
+	.string	"__GNU_LIBRARY__"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF766:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF580:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF407:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF618:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1359:
+	.string	"failureMode"
+.LASF1116:
+	.string	"vbatmaxcellvoltage"
+.LASF601:
+	.string	"__stub_revoke "
+.LASF544:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF788:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF436:
+	.string	"_WCHAR_T_DEFINED "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1245:
+	.string	"accelerometerTrims"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF628:
+	.string	"__SWORD_TYPE long int"
+.LASF1090:
+	.string	"MULTITYPE_LAST"
+.LASF551:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF428:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF881:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF433:
+	.string	"_WCHAR_T_ "
+.LASF880:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF641:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF494:
+	.string	"__USE_POSIX 1"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF727:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1287:
+	.string	"inputFilteringMode"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1244:
+	.string	"mag_declination"
+.LASF593:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF442:
+	.string	"__DEFINED_wchar_t "
+.LASF517:
+	.string	"__PMT"
+.LASF992:
+	.string	"soft_gyro_lpf_hz"
+.LASF784:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF907:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1200:
+	.string	"ATTITUDE_ESTIMATOR_QUATERNION"
+.LASF1041:
+	.string	"gps_baudrate"
+.LASF392:
+	.string	"false 0"
+.LASF620:
+	.string	"__S16_TYPE short int"
+.LASF1103:
+	.string	"airplaneConfig_t"
+.LASF1337:
+	.string	"CONFIG_SECTION_RX"
+.LASF736:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1342:
+	.string	"CONFIG_SECTION_LED_STRIP"
+.LASF1057:
+	.string	"telemetry_provider"
+.LASF483:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF697:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF979:
+	.string	"acc_align"
+.LASF1186:
+	.string	"rcExpo8"
+.LASF1130:
+	.string	"minthrottle"
+.LASF507:
+	.string	"__USE_ATFILE 1"
+.LASF488:
+	.string	"__USE_ISOC95 1"
+.LASF1354:
+	.string	"configStorageProcess"
+.LASF741:
+	.string	"UINT8_C(c) c"
+.LASF746:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1334:
+	.string	"CONFIG_SECTION_SENSORS"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1351:
+	.string	"memcpy"
+.LASF1329:
+	.string	"written"
+.LASF840:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF1262:
+	.string	"mixerConfiguration"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1029:
+	.string	"SCENARIO_GPS_PASSTHROUGH_ONLY"
+.LASF582:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF466:
+	.string	"__USE_XOPEN2K8"
+.LASF658:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF570:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF689:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF993:
+	.string	"soft_gyro_notch_hz"
+.LASF1038:
+	.string	"serial_port_scenario"
+.LASF1001:
+	.string	"ACC_LSM303DLHC"
+.LASF1362:
+	.string	"applySerialConfigToPortFunctions"
+.LASF514:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1019:
+	.string	"FUNCTION_MSP"
+.LASF935:
+	.string	"RGB_RED"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF826:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF725:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1179:
+	.string	"modeId"
+.LASF1356:
+	.string	"blinkLedAndSoundBeeper"
+.LASF1126:
+	.string	"gimbalConfig_s"
+.LASF1128:
+	.string	"gimbalConfig_t"
+.LASF1364:
+	.string	"useBarometerConfig"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF443:
+	.string	"_BSD_WCHAR_T_"
+.LASF597:
+	.string	"__stub___compat_bdflush "
+.LASF704:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF678:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF664:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF669:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF933:
+	.string	"uint32_t"
+.LASF486:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF909:
+	.string	"CONFIG_SLOT_SIZE (FLASH_TO_RESERVE_FOR_CONFIG / CONFIG_STORAGE_SLOT_COUNT)"
+.LASF638:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF699:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF872:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF539:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1078:
+	.string	"MULTITYPE_OCTOX8"
+.LASF1076:
+	.string	"MULTITYPE_Y4"
+.LASF491:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF495:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF650:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF546:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1158:
+	.string	"BOXCALIB"
+.LASF691:
+	.string	"INT16_MAX (32767)"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF731:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF595:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1292:
+	.string	"serialConfig"
+.LASF1298:
+	.string	"currentProfile"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1182:
+	.string	"rangeEndStep"
+.LASF1247:
+	.string	"accDeadband"
+.LASF1267:
+	.string	"pid_process_denom"
+.LASF877:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF523:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF848:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1402:
+	.string	"resetEscAndServoConfig"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF419:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF376:
+	.string	"unix 1"
+.LASF902:
+	.string	"CONFIG_STORAGE_SLOT_COUNT 2"
+.LASF1147:
+	.string	"BOXHEADFREE"
+.LASF916:
+	.string	"short unsigned int"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1167:
+	.string	"ROLL"
+.LASF864:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF957:
+	.string	"pitch"
+.LASF1129:
+	.string	"escAndServoConfig_s"
+.LASF899:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1170:
+	.string	"AUX1"
+.LASF949:
+	.string	"A_level"
+.LASF1172:
+	.string	"AUX3"
+.LASF1173:
+	.string	"AUX4"
+.LASF1174:
+	.string	"AUX5"
+.LASF1175:
+	.string	"AUX6"
+.LASF1176:
+	.string	"AUX7"
+.LASF1177:
+	.string	"AUX8"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1194:
+	.string	"failsafe_off_delay"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1055:
+	.string	"frskyUnit_e"
+.LASF1211:
+	.string	"imuRuntimeConfig_t"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF818:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1410:
+	.string	"isEEPROMWritePending"
+.LASF1134:
+	.string	"rxConfig_s"
+.LASF1141:
+	.string	"rxConfig_t"
+.LASF849:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF876:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF962:
+	.string	"rollAndPitchTrims_t_def"
+.LASF1299:
+	.string	"configStorageSection_s"
+.LASF1051:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF723:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF925:
+	.string	"__int32_t"
+.LASF599:
+	.string	"__stub_fchflags "
+.LASF596:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1238:
+	.string	"profile_s"
+.LASF1260:
+	.string	"profile_t"
+.LASF522:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1389:
+	.string	"requestEEPROMWrite"
+.LASF774:
+	.string	"USE_BARO_SITL "
+.LASF645:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF395:
+	.string	"_STDDEF_H_ "
+.LASF501:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1048:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF803:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF911:
+	.string	"CONFIG_LAYOUT (EEPROM_CONF_VERSION | (uint32_t)sizeof(master_t) << 16)"
+.LASF1028:
+	.string	"SCENARIO_GPS_ONLY"
+.LASF1220:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1024:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF643:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1273:
+	.string	"dshot_rate"
+.LASF1258:
+	.string	"mixerConfig"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF785:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1394:
+	.string	"validateAndFixConfig"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF870:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF1324:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF936:
+	.string	"RGB_GREEN"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1023:
+	.string	"FUNCTION_GPS"
+.LASF886:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF605:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1192:
+	.string	"failsafeConfig_s"
+.LASF1198:
+	.string	"failsafeConfig_t"
+.LASF969:
+	.string	"CW90_DEG"
+.LASF729:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1160:
+	.string	"BOXOSD"
+.LASF1325:
+	.string	"compacting"
+.LASF1075:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF584:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1154:
+	.string	"BOXBEEPERON"
+.LASF668:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF719:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1326:
+	.string	"sectionIndex"
+.LASF1413:
+	.string	"resetConf"
+.LASF781:
+	.string	"PROFILING "
+.LASF1146:
+	.string	"BOXMAG"
+.LASF573:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1396:
+	.string	"imuRuntimeConfig"
+.LASF1046:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF756:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF894:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF1045:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF855:
+	.string	"YAW_CE (3 << (2 * YAW))"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/config/config.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
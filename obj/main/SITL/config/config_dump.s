@@ -0,0 +1,12578 @@
+	.file	"config_dump.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/config/config_dump.c"
+	.section	.text.configDumpValueSize,"ax",@progbits
+	.p2align 4
+	.globl	configDumpValueSize
+	.type	configDumpValueSize, @function
+configDumpValueSize:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/config/config_dump.c"
+	.loc 1 63 1 view -0
+	.cfi_startproc
+	.loc 1 64 5 view .LVU1
+	cmpb	$32, %dil
+	ja	.L2
+	leaq	.L4(%rip), %rdx
+	movzbl	%dil, %edi
+	.loc 1 64 5 is_stmt 0 view .LVU2
+	movslq	(%rdx,%rdi,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.configDumpValueSize,"a",@progbits
+	.align 4
+	.align 4
+.L4:
+	.long	.L2-.L4
+	.long	.L6-.L4
+	.long	.L6-.L4
+	.long	.L2-.L4
+	.long	.L7-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L7-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L3-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L2-.L4
+	.long	.L3-.L4
+	.section	.text.configDumpValueSize
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 77 5 is_stmt 1 view .LVU3
+	.loc 1 77 12 is_stmt 0 view .LVU4
+	xorl	%eax, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 75 13 is_stmt 1 view .LVU5
+	.loc 1 75 20 is_stmt 0 view .LVU6
+	movl	$4, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 64 5 view .LVU7
+	movl	$2, %eax
+	.loc 1 78 1 view .LVU8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	.loc 1 67 20 view .LVU9
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	configDumpValueSize, .-configDumpValueSize
+	.section	.text.configDumpEncodeRecord,"ax",@progbits
+	.p2align 4
+	.globl	configDumpEncodeRecord
+	.type	configDumpEncodeRecord, @function
+configDumpEncodeRecord:
+.LVL2:
+.LFB1:
+	.loc 1 82 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 83 5 view .LVU11
+	.loc 1 83 46 is_stmt 0 view .LVU12
+	movzbl	3(%rsi), %eax
+.LVL3:
+.LBB4:
+.LBI4:
+	.loc 1 62 9 is_stmt 1 view .LVU13
+.LBB5:
+	.loc 1 64 5 view .LVU14
+.LBE5:
+.LBE4:
+	.loc 1 88 9 is_stmt 0 view .LVU15
+	movl	4(%rsi), %r8d
+	.loc 1 82 1 view .LVU16
+	movq	%rsi, %rdx
+.LBB12:
+.LBB6:
+	.loc 1 64 5 view .LVU17
+	cmpb	$32, %al
+	ja	.L19
+	leaq	.L12(%rip), %rsi
+.LVL4:
+	.loc 1 64 5 view .LVU18
+	movzbl	%al, %ecx
+	movslq	(%rsi,%rcx,4), %rcx
+	addq	%rsi, %rcx
+	jmp	*%rcx
+	.section	.rodata.configDumpEncodeRecord,"a",@progbits
+	.align 4
+	.align 4
+.L12:
+	.long	.L19-.L12
+	.long	.L14-.L12
+	.long	.L14-.L12
+	.long	.L19-.L12
+	.long	.L13-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L13-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L11-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L19-.L12
+	.long	.L11-.L12
+	.section	.text.configDumpEncodeRecord
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	movl	$4, %r9d
+	xorl	%esi, %esi
+.LVL5:
+.L10:
+	.loc 1 64 5 view .LVU19
+.LBE6:
+.LBE12:
+	.loc 1 90 9 is_stmt 1 view .LVU20
+	.loc 1 93 5 view .LVU21
+	.loc 1 93 15 is_stmt 0 view .LVU22
+	movzwl	(%rdx), %eax
+	movb	%al, (%rdi)
+	.loc 1 94 5 is_stmt 1 view .LVU23
+	.loc 1 94 15 is_stmt 0 view .LVU24
+	movzwl	(%rdx), %eax
+	movb	%ah, 1(%rdi)
+	.loc 1 95 5 is_stmt 1 view .LVU25
+	.loc 1 95 23 is_stmt 0 view .LVU26
+	movzbl	2(%rdx), %eax
+	.loc 1 95 15 view .LVU27
+	movb	%al, 2(%rdi)
+	.loc 1 96 5 is_stmt 1 view .LVU28
+	.loc 1 96 23 is_stmt 0 view .LVU29
+	movzbl	3(%rdx), %eax
+	.loc 1 96 15 view .LVU30
+	movb	%al, 3(%rdi)
+	.loc 1 97 5 is_stmt 1 view .LVU31
+.LVL6:
+	.loc 1 97 19 view .LVU32
+	testb	%sil, %sil
+	je	.L9
+.L16:
+.LBB13:
+.LBB7:
+	.loc 1 75 20 is_stmt 0 discriminator 3 view .LVU33
+	xorl	%eax, %eax
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 75 20 discriminator 3 view .LVU34
+.LBE7:
+.LBE13:
+	.loc 1 98 9 is_stmt 1 discriminator 3 view .LVU35
+	.loc 1 98 37 is_stmt 0 discriminator 3 view .LVU36
+	leal	0(,%rax,8), %ecx
+	.loc 1 98 31 discriminator 3 view .LVU37
+	movl	%r8d, %edx
+	shrl	%cl, %edx
+	.loc 1 98 23 discriminator 3 view .LVU38
+	movb	%dl, 4(%rdi,%rax)
+	.loc 1 97 28 is_stmt 1 discriminator 3 view .LVU39
+.LVL8:
+	.loc 1 97 19 discriminator 3 view .LVU40
+	addq	$1, %rax
+.LVL9:
+	.loc 1 97 19 is_stmt 0 discriminator 3 view .LVU41
+	cmpb	%sil, %al
+	jb	.L17
+.LVL10:
+.L9:
+	.loc 1 102 1 view .LVU42
+	movl	%r9d, %eax
+	ret
+.LVL11:
+.L11:
+.LBB14:
+.LBB8:
+	.loc 1 75 13 is_stmt 1 view .LVU43
+	.loc 1 75 13 is_stmt 0 view .LVU44
+.LBE8:
+.LBE14:
+	.loc 1 84 5 is_stmt 1 view .LVU45
+	.loc 1 85 5 view .LVU46
+	.loc 1 87 5 view .LVU47
+	movl	$8, %r9d
+.LBB15:
+.LBB9:
+	.loc 1 75 20 is_stmt 0 view .LVU48
+	movl	$4, %esi
+.LBE9:
+.LBE15:
+	.loc 1 87 8 view .LVU49
+	cmpb	$32, %al
+	jne	.L10
+.LVL12:
+	.loc 1 93 5 is_stmt 1 view .LVU50
+	.loc 1 93 15 is_stmt 0 view .LVU51
+	movzwl	(%rdx), %eax
+	.loc 1 96 15 view .LVU52
+	movl	$8, %r9d
+.LBB16:
+.LBB10:
+	.loc 1 75 20 view .LVU53
+	movl	$4, %esi
+.LBE10:
+.LBE16:
+	.loc 1 93 15 view .LVU54
+	movb	%al, (%rdi)
+	.loc 1 94 5 is_stmt 1 view .LVU55
+	.loc 1 94 15 is_stmt 0 view .LVU56
+	movzwl	(%rdx), %eax
+	movb	%ah, 1(%rdi)
+	.loc 1 95 5 is_stmt 1 view .LVU57
+	.loc 1 95 23 is_stmt 0 view .LVU58
+	movzbl	2(%rdx), %eax
+	.loc 1 95 15 view .LVU59
+	movb	%al, 2(%rdi)
+	.loc 1 96 5 is_stmt 1 view .LVU60
+	.loc 1 96 23 is_stmt 0 view .LVU61
+	movzbl	3(%rdx), %eax
+	.loc 1 96 15 view .LVU62
+	movb	%al, 3(%rdi)
+	.loc 1 97 5 is_stmt 1 view .LVU63
+.LVL13:
+	.loc 1 97 19 view .LVU64
+	jmp	.L16
+.LVL14:
+.L14:
+.LBB17:
+.LBB11:
+	.loc 1 64 5 is_stmt 0 view .LVU65
+	movl	$5, %r9d
+	.loc 1 67 20 view .LVU66
+	movl	$1, %esi
+	jmp	.L10
+.L13:
+	.loc 1 64 5 view .LVU67
+	movl	$6, %r9d
+	.loc 1 71 20 view .LVU68
+	movl	$2, %esi
+	jmp	.L10
+.LBE11:
+.LBE17:
+	.cfi_endproc
+.LFE1:
+	.size	configDumpEncodeRecord, .-configDumpEncodeRecord
+	.section	.text.configDumpDecodeRecord,"ax",@progbits
+	.p2align 4
+	.globl	configDumpDecodeRecord
+	.type	configDumpDecodeRecord, @function
+configDumpDecodeRecord:
+.LVL15:
+.LFB2:
+	.loc 1 106 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 107 5 view .LVU70
+	.loc 1 108 5 view .LVU71
+	.loc 1 109 5 view .LVU72
+	.loc 1 111 5 view .LVU73
+	.loc 1 106 1 is_stmt 0 view .LVU74
+	movq	%rdx, %r8
+	.loc 1 112 16 view .LVU75
+	xorl	%eax, %eax
+	.loc 1 111 8 view .LVU76
+	cmpw	$3, %si
+	jbe	.L21
+	.loc 1 115 5 is_stmt 1 view .LVU77
+.LVL16:
+.LBB20:
+.LBI20:
+	.loc 1 62 9 view .LVU78
+.LBB21:
+	.loc 1 64 5 view .LVU79
+	cmpb	$32, 3(%rdi)
+	ja	.L33
+	movzbl	3(%rdi), %eax
+	leaq	.L24(%rip), %rdx
+.LVL17:
+	.loc 1 64 5 is_stmt 0 view .LVU80
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.configDumpDecodeRecord,"a",@progbits
+	.align 4
+	.align 4
+.L24:
+	.long	.L33-.L24
+	.long	.L26-.L24
+	.long	.L26-.L24
+	.long	.L33-.L24
+	.long	.L25-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L25-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L34-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L33-.L24
+	.long	.L34-.L24
+	.section	.text.configDumpDecodeRecord
+	.p2align 4,,10
+	.p2align 3
+.L33:
+.LBE21:
+.LBE20:
+	.loc 1 112 16 view .LVU81
+	xorl	%eax, %eax
+.LVL18:
+.L21:
+	.loc 1 147 1 view .LVU82
+	ret
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+.LBB26:
+.LBB22:
+	.loc 1 71 13 is_stmt 1 view .LVU83
+	.loc 1 71 13 is_stmt 0 view .LVU84
+.LBE22:
+.LBE26:
+	.loc 1 116 5 is_stmt 1 view .LVU85
+.LBB27:
+.LBB23:
+	.loc 1 64 5 is_stmt 0 view .LVU86
+	movl	$5, %edx
+	.loc 1 71 20 view .LVU87
+	movl	$2, %r9d
+.LVL20:
+.L23:
+	.loc 1 71 20 view .LVU88
+.LBE23:
+.LBE27:
+	.loc 1 116 29 discriminator 1 view .LVU89
+	movzwl	%si, %esi
+	.loc 1 112 16 discriminator 1 view .LVU90
+	xorl	%eax, %eax
+	.loc 1 116 19 discriminator 1 view .LVU91
+	cmpl	%edx, %esi
+	jle	.L21
+	.loc 1 120 5 is_stmt 1 view .LVU92
+	movzwl	(%rdi), %eax
+	.loc 1 107 14 is_stmt 0 view .LVU93
+	xorl	%esi, %esi
+.LVL21:
+	.loc 1 120 16 view .LVU94
+	movw	%ax, (%r8)
+	.loc 1 121 5 is_stmt 1 view .LVU95
+	.loc 1 121 34 is_stmt 0 view .LVU96
+	movzbl	2(%rdi), %eax
+	.loc 1 121 26 view .LVU97
+	movb	%al, 2(%r8)
+	.loc 1 122 5 is_stmt 1 view .LVU98
+	.loc 1 122 26 is_stmt 0 view .LVU99
+	movzbl	3(%rdi), %r10d
+	.loc 1 122 18 view .LVU100
+	xorl	%eax, %eax
+	movb	%r10b, 3(%r8)
+	.loc 1 124 5 is_stmt 1 view .LVU101
+.LVL22:
+	.loc 1 124 19 view .LVU102
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 125 9 discriminator 3 view .LVU103
+	.loc 1 125 17 is_stmt 0 discriminator 3 view .LVU104
+	movzbl	4(%rdi,%rax), %edx
+	.loc 1 125 47 discriminator 3 view .LVU105
+	leal	0(,%rax,8), %ecx
+	.loc 1 124 19 discriminator 3 view .LVU106
+	addq	$1, %rax
+.LVL23:
+	.loc 1 125 41 discriminator 3 view .LVU107
+	sall	%cl, %edx
+	.loc 1 125 14 discriminator 3 view .LVU108
+	orl	%edx, %esi
+.LVL24:
+	.loc 1 124 28 is_stmt 1 discriminator 3 view .LVU109
+	.loc 1 124 19 discriminator 3 view .LVU110
+	cmpb	%r9b, %al
+	jb	.L27
+	.loc 1 128 5 view .LVU111
+	cmpb	$8, %r10b
+	je	.L28
+	cmpb	$32, %r10b
+	je	.L29
+	.loc 1 130 39 is_stmt 0 view .LVU112
+	movsbl	%sil, %eax
+	cmpb	$2, %r10b
+	cmovne	%esi, %eax
+	movl	%eax, 4(%r8)
+.LVL25:
+.L31:
+	.loc 1 146 5 is_stmt 1 view .LVU113
+	.loc 1 146 14 is_stmt 0 view .LVU114
+	leal	4(%r9), %eax
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+.LBB28:
+.LBB24:
+	.loc 1 64 5 view .LVU115
+	movl	$7, %edx
+	movl	$4, %r9d
+	jmp	.L23
+.LVL27:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 64 5 view .LVU116
+.LBE24:
+.LBE28:
+	.loc 1 138 13 is_stmt 1 view .LVU117
+	movl	%esi, 4(%r8)
+	.loc 1 139 13 view .LVU118
+	jmp	.L31
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 134 13 view .LVU119
+	.loc 1 134 39 is_stmt 0 view .LVU120
+	movswl	%si, %esi
+.LVL28:
+	.loc 1 134 39 view .LVU121
+	movl	%esi, 4(%r8)
+	.loc 1 135 13 is_stmt 1 view .LVU122
+	jmp	.L31
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+.LBB29:
+.LBB25:
+	.loc 1 64 5 is_stmt 0 view .LVU123
+	movl	$4, %edx
+	.loc 1 67 20 view .LVU124
+	movl	$1, %r9d
+	jmp	.L23
+.LBE25:
+.LBE29:
+	.cfi_endproc
+.LFE2:
+	.size	configDumpDecodeRecord, .-configDumpDecodeRecord
+	.section	.text.configDumpIndexCount,"ax",@progbits
+	.p2align 4
+	.globl	configDumpIndexCount
+	.type	configDumpIndexCount, @function
+configDumpIndexCount:
+.LFB3:
+	.loc 1 151 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 152 5 view .LVU126
+	.loc 1 152 29 is_stmt 0 view .LVU127
+	movzwl	configValueCount(%rip), %eax
+	leal	(%rax,%rax,2), %eax
+	.loc 1 153 1 view .LVU128
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	configDumpIndexCount, .-configDumpIndexCount
+	.section	.text.configDumpGetRecord,"ax",@progbits
+	.p2align 4
+	.globl	configDumpGetRecord
+	.type	configDumpGetRecord, @function
+configDumpGetRecord:
+.LVL30:
+.LFB4:
+	.loc 1 157 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 157 1 is_stmt 0 view .LVU130
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 157 1 view .LVU131
+	movl	%esi, %eax
+	.loc 1 158 5 is_stmt 1 view .LVU132
+	.loc 1 157 1 is_stmt 0 view .LVU133
+	movq	%rdx, %rbx
+	xorl	%edx, %edx
+.LVL31:
+	.loc 1 157 1 view .LVU134
+	divw	configValueCount(%rip)
+.LVL32:
+	.loc 1 159 5 is_stmt 1 view .LVU135
+	.loc 1 161 5 view .LVU136
+	.loc 1 162 15 is_stmt 0 view .LVU137
+	xorl	%r8d, %r8d
+	.loc 1 161 8 view .LVU138
+	cmpb	$2, %al
+	ja	.L38
+	.loc 1 161 37 discriminator 1 view .LVU139
+	movzwl	%dx, %esi
+.LVL33:
+	.loc 1 161 37 discriminator 1 view .LVU140
+	leaq	configValues(%rip), %r9
+	leaq	(%rsi,%rsi,2), %rcx
+	movzbl	10(%r9,%rcx,8), %ecx
+	.loc 1 161 60 discriminator 1 view .LVU141
+	testb	$64, %cl
+	je	.L45
+	testb	%al, %al
+	jne	.L38
+.L45:
+	.loc 1 165 5 is_stmt 1 view .LVU142
+	.loc 1 165 23 is_stmt 0 view .LVU143
+	leaq	(%rsi,%rsi,2), %rsi
+	.loc 1 159 26 view .LVU144
+	movzwl	%dx, %edx
+	.loc 1 165 16 view .LVU145
+	movzwl	8(%r9,%rsi,8), %esi
+	.loc 1 159 26 view .LVU146
+	leaq	(%rdx,%rdx,2), %rdx
+	.loc 1 165 16 view .LVU147
+	movw	%si, (%rbx)
+	.loc 1 166 5 is_stmt 1 view .LVU148
+	.loc 1 166 26 is_stmt 0 view .LVU149
+	xorl	%esi, %esi
+	testb	%cl, %cl
+	cmovs	%eax, %esi
+	.loc 1 167 32 view .LVU150
+	andl	$63, %ecx
+	.loc 1 168 21 view .LVU151
+	movzbl	%al, %eax
+	.loc 1 167 32 view .LVU152
+	movb	%cl, 3(%rbx)
+	.loc 1 166 26 view .LVU153
+	movb	%sil, 2(%rbx)
+	.loc 1 167 5 is_stmt 1 view .LVU154
+	.loc 1 168 5 view .LVU155
+	.loc 1 159 26 is_stmt 0 view .LVU156
+	leaq	(%r9,%rdx,8), %rsi
+	.loc 1 168 21 view .LVU157
+	movl	%eax, %edx
+	call	configValueGet@PLT
+.LVL34:
+	.loc 1 169 11 view .LVU158
+	movl	$1, %r8d
+	.loc 1 168 21 view .LVU159
+	movl	%eax, 4(%rbx)
+	.loc 1 169 5 is_stmt 1 view .LVU160
+.L38:
+	.loc 1 170 1 is_stmt 0 view .LVU161
+	movl	%r8d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL35:
+	.loc 1 170 1 view .LVU162
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	configDumpGetRecord, .-configDumpGetRecord
+	.section	.text.configDumpApplyRecord,"ax",@progbits
+	.p2align 4
+	.globl	configDumpApplyRecord
+	.type	configDumpApplyRecord, @function
+configDumpApplyRecord:
+.LVL36:
+.LFB5:
+	.loc 1 173 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 174 5 view .LVU164
+	.loc 1 173 1 is_stmt 0 view .LVU165
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 174 34 view .LVU166
+	movzwl	(%rsi), %edi
+.LVL37:
+	.loc 1 174 34 view .LVU167
+	call	findConfigValueById@PLT
+.LVL38:
+	.loc 1 175 5 is_stmt 1 view .LVU168
+	.loc 1 175 23 is_stmt 0 view .LVU169
+	movl	4(%rbx), %r13d
+.LVL39:
+	.loc 1 177 5 is_stmt 1 view .LVU170
+	.loc 1 177 8 is_stmt 0 view .LVU171
+	testq	%rax, %rax
+	je	.L57
+	movq	%rax, %rbp
+	.loc 1 181 5 is_stmt 1 view .LVU172
+	.loc 1 181 15 is_stmt 0 view .LVU173
+	movzbl	2(%rbx), %eax
+.LVL40:
+	.loc 1 181 8 view .LVU174
+	cmpb	$2, %al
+	ja	.L53
+	.loc 1 181 45 discriminator 1 view .LVU175
+	movzbl	10(%rbp), %edx
+	.loc 1 181 68 discriminator 1 view .LVU176
+	testb	$64, %dl
+	je	.L58
+	testb	%al, %al
+	jne	.L53
+.L58:
+	.loc 1 186 5 is_stmt 1 view .LVU177
+	.loc 1 186 8 is_stmt 0 view .LVU178
+	andl	$32, %edx
+	.loc 1 186 44 view .LVU179
+	movzbl	3(%rbx), %eax
+	.loc 1 186 8 view .LVU180
+	je	.L55
+	.loc 1 186 35 discriminator 1 view .LVU181
+	cmpb	$32, %al
+	je	.L56
+	.loc 1 187 9 is_stmt 1 view .LVU182
+	.loc 1 187 30 is_stmt 0 view .LVU183
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	4(%rbx), %xmm1
+	movd	%xmm1, %r13d
+.L56:
+	.loc 1 192 5 is_stmt 1 view .LVU184
+.LVL41:
+	.loc 1 192 10 is_stmt 0 view .LVU185
+	movl	%r13d, %esi
+	movq	%rbp, %rdi
+	call	isConfigValueInRange@PLT
+.LVL42:
+	.loc 1 192 8 view .LVU186
+	testb	%al, %al
+	je	.L53
+	.loc 1 196 5 is_stmt 1 view .LVU187
+	movzbl	2(%rbx), %edx
+	movl	%r13d, %ecx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	configValueSet@PLT
+.LVL43:
+	.loc 1 197 5 view .LVU188
+	.loc 1 198 1 is_stmt 0 view .LVU189
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 197 12 view .LVU190
+	xorl	%eax, %eax
+	.loc 1 198 1 view .LVU191
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL44:
+	.loc 1 198 1 view .LVU192
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL45:
+	.loc 1 198 1 view .LVU193
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL46:
+	.loc 1 198 1 view .LVU194
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL47:
+	.loc 1 198 1 view .LVU195
+	ret
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.cfi_restore_state
+	.loc 1 198 1 view .LVU196
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 182 16 view .LVU197
+	movl	$2, %eax
+	.loc 1 198 1 view .LVU198
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL49:
+	.loc 1 198 1 view .LVU199
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL50:
+	.loc 1 198 1 view .LVU200
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL51:
+	.loc 1 198 1 view .LVU201
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL52:
+	.loc 1 198 1 view .LVU202
+	ret
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.cfi_restore_state
+	.loc 1 188 12 is_stmt 1 discriminator 1 view .LVU203
+	.loc 1 188 43 is_stmt 0 discriminator 1 view .LVU204
+	cmpb	$32, %al
+	jne	.L56
+	.loc 1 189 9 is_stmt 1 view .LVU205
+	.loc 1 189 30 is_stmt 0 view .LVU206
+	movss	4(%rbx), %xmm0
+	call	lrintf@PLT
+.LVL54:
+	.loc 1 189 28 view .LVU207
+	movl	%eax, %r13d
+	.loc 1 189 28 view .LVU208
+	jmp	.L56
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 1 198 1 view .LVU209
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	.loc 1 178 16 view .LVU210
+	movl	$1, %eax
+.LVL56:
+	.loc 1 198 1 view .LVU211
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL57:
+	.loc 1 198 1 view .LVU212
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL58:
+	.loc 1 198 1 view .LVU213
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	configDumpApplyRecord, .-configDumpApplyRecord
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/drivers/serial.h"
+	.file 6 ".//src/main/drivers/pwm_rx.h"
+	.file 7 ".//src/main/flight/flight.h"
+	.file 8 ".//src/main/flight/mixer.h"
+	.file 9 ".//src/main/flight/failsafe.h"
+	.file 10 ".//src/main/rx/rx.h"
+	.file 11 ".//src/main/io/escservo.h"
+	.file 12 ".//src/main/io/gimbal.h"
+	.file 13 ".//src/main/io/rc_controls.h"
+	.file 14 ".//src/main/io/serial.h"
+	.file 15 ".//src/main/sensors/battery.h"
+	.file 16 ".//src/main/sensors/boardalignment.h"
+	.file 17 ".//src/main/sensors/sensors.h"
+	.file 18 ".//src/main/sensors/acceleration.h"
+	.file 19 ".//src/main/sensors/gyro.h"
+	.file 20 ".//src/main/sensors/barometer.h"
+	.file 21 ".//src/main/telemetry/telemetry.h"
+	.file 22 ".//src/main/config/config_profile.h"
+	.file 23 ".//src/main/config/config_master.h"
+	.file 24 ".//src/main/config/config_values.h"
+	.file 25 ".//src/main/config/config_dump.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x13a2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF1572
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL22
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1261
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1262
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1263
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1264
+	.uleb128 0x3
+	.long	.LASF1266
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1265
+	.uleb128 0x3
+	.long	.LASF1267
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1268
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1269
+	.uleb128 0x3
+	.long	.LASF1270
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1271
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1272
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1273
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1274
+	.uleb128 0xc
+	.long	0xae
+	.uleb128 0x3
+	.long	.LASF1275
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x3
+	.long	.LASF1276
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x3
+	.long	.LASF1277
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0xc
+	.long	0xd2
+	.uleb128 0x3
+	.long	.LASF1278
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0xc
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1279
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0xc
+	.long	0xf4
+	.uleb128 0x3
+	.long	.LASF1280
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0xd
+	.long	0xb5
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1281
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1282
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x5
+	.byte	0x16
+	.long	0x13c
+	.uleb128 0x2
+	.long	.LASF1283
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1284
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1285
+	.byte	0x5
+	.byte	0x19
+	.byte	0x3
+	.long	0x124
+	.uleb128 0xd
+	.long	0xef
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1286
+	.uleb128 0xd
+	.long	0xe3
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x6
+	.byte	0x14
+	.long	0x171
+	.uleb128 0x2
+	.long	.LASF1287
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1288
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1289
+	.byte	0x6
+	.byte	0x17
+	.byte	0x3
+	.long	0x159
+	.uleb128 0x5
+	.long	.LASF1294
+	.byte	0x50
+	.byte	0x7
+	.byte	0x23
+	.long	0x1fc
+	.uleb128 0x6
+	.string	"P8"
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0x1fc
+	.byte	0
+	.uleb128 0x6
+	.string	"I8"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xd
+	.long	0x1fc
+	.byte	0xa
+	.uleb128 0x6
+	.string	"D8"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xd
+	.long	0x1fc
+	.byte	0x14
+	.uleb128 0x6
+	.string	"P_f"
+	.byte	0x7
+	.byte	0x28
+	.byte	0xb
+	.long	0x20c
+	.byte	0x20
+	.uleb128 0x6
+	.string	"I_f"
+	.byte	0x7
+	.byte	0x29
+	.byte	0xb
+	.long	0x20c
+	.byte	0x2c
+	.uleb128 0x6
+	.string	"D_f"
+	.byte	0x7
+	.byte	0x2a
+	.byte	0xb
+	.long	0x20c
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1290
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xb
+	.long	0x116
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1291
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x116
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1292
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x8
+	.long	0xe3
+	.long	0x20c
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	0x116
+	.long	0x21c
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1293
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x17d
+	.uleb128 0x5
+	.long	.LASF1295
+	.byte	0x6
+	.byte	0x7
+	.byte	0x57
+	.long	0x25c
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0x7
+	.byte	0x58
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0x7
+	.byte	0x59
+	.byte	0xd
+	.long	0xc6
+	.byte	0x2
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1298
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x3
+	.long	0x228
+	.uleb128 0x13
+	.byte	0x6
+	.byte	0x7
+	.byte	0x5d
+	.long	0x287
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0x5e
+	.long	0x287
+	.uleb128 0x11
+	.long	.LASF1299
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x25c
+	.byte	0
+	.uleb128 0x8
+	.long	0xc6
+	.long	0x297
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1300
+	.byte	0x7
+	.byte	0x60
+	.byte	0x3
+	.long	0x268
+	.uleb128 0x5
+	.long	.LASF1301
+	.byte	0x4
+	.byte	0x7
+	.byte	0x62
+	.long	0x2ca
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0x7
+	.byte	0x63
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0x7
+	.byte	0x64
+	.byte	0xd
+	.long	0xc6
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1302
+	.byte	0x7
+	.byte	0x65
+	.byte	0x3
+	.long	0x2a3
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.byte	0x67
+	.long	0x2f5
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0x68
+	.long	0x2f5
+	.uleb128 0x11
+	.long	.LASF1299
+	.byte	0x7
+	.byte	0x69
+	.byte	0x1d
+	.long	0x2ca
+	.byte	0
+	.uleb128 0x8
+	.long	0xc6
+	.long	0x305
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1303
+	.byte	0x7
+	.byte	0x6a
+	.byte	0x3
+	.long	0x2d6
+	.uleb128 0x5
+	.long	.LASF1304
+	.byte	0x10
+	.byte	0x8
+	.byte	0x34
+	.long	0x352
+	.uleb128 0x1
+	.long	.LASF1305
+	.byte	0x8
+	.byte	0x35
+	.byte	0xb
+	.long	0x116
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0x8
+	.byte	0x36
+	.byte	0xb
+	.long	0x116
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0x8
+	.byte	0x37
+	.byte	0xb
+	.long	0x116
+	.byte	0x8
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x8
+	.byte	0x38
+	.byte	0xb
+	.long	0x116
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1304
+	.byte	0x8
+	.byte	0x39
+	.byte	0x3
+	.long	0x311
+	.uleb128 0x5
+	.long	.LASF1306
+	.byte	0x2
+	.byte	0x8
+	.byte	0x42
+	.long	0x385
+	.uleb128 0x1
+	.long	.LASF1307
+	.byte	0x8
+	.byte	0x43
+	.byte	0xc
+	.long	0xba
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1308
+	.byte	0x8
+	.byte	0x44
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1309
+	.byte	0x8
+	.byte	0x45
+	.byte	0x3
+	.long	0x35e
+	.uleb128 0x5
+	.long	.LASF1310
+	.byte	0x8
+	.byte	0x8
+	.byte	0x47
+	.long	0x3d2
+	.uleb128 0x1
+	.long	.LASF1311
+	.byte	0x8
+	.byte	0x48
+	.byte	0xe
+	.long	0xf4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1312
+	.byte	0x8
+	.byte	0x49
+	.byte	0xe
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1313
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xe
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1314
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xe
+	.long	0xf4
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1315
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x3
+	.long	0x391
+	.uleb128 0x5
+	.long	.LASF1316
+	.byte	0x1
+	.byte	0x8
+	.byte	0x4e
+	.long	0x3f8
+	.uleb128 0x1
+	.long	.LASF1317
+	.byte	0x8
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1316
+	.byte	0x8
+	.byte	0x50
+	.byte	0x3
+	.long	0x3de
+	.uleb128 0x5
+	.long	.LASF1318
+	.byte	0x8
+	.byte	0x8
+	.byte	0x54
+	.long	0x452
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x8
+	.byte	0x55
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x8
+	.byte	0x56
+	.byte	0xd
+	.long	0xc6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1319
+	.byte	0x8
+	.byte	0x57
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1320
+	.byte	0x8
+	.byte	0x58
+	.byte	0xc
+	.long	0xba
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0x8
+	.byte	0x59
+	.byte	0xc
+	.long	0xba
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1318
+	.byte	0x8
+	.byte	0x5a
+	.byte	0x3
+	.long	0x404
+	.uleb128 0x5
+	.long	.LASF1322
+	.byte	0x8
+	.byte	0x9
+	.byte	0x16
+	.long	0x4ac
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0x9
+	.byte	0x17
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1324
+	.byte	0x9
+	.byte	0x18
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1325
+	.byte	0x9
+	.byte	0x19
+	.byte	0xe
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1326
+	.byte	0x9
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1327
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xe
+	.long	0xf4
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1328
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x3
+	.long	0x45e
+	.uleb128 0x5
+	.long	.LASF1329
+	.byte	0x12
+	.byte	0xa
+	.byte	0x3d
+	.long	0x513
+	.uleb128 0x1
+	.long	.LASF1330
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0x513
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1331
+	.byte	0xa
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1332
+	.byte	0xa
+	.byte	0x40
+	.byte	0xe
+	.long	0xf4
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1333
+	.byte	0xa
+	.byte	0x41
+	.byte	0xe
+	.long	0xf4
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1334
+	.byte	0xa
+	.byte	0x42
+	.byte	0xe
+	.long	0xf4
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1335
+	.byte	0xa
+	.byte	0x43
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0xe3
+	.long	0x523
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1336
+	.byte	0xa
+	.byte	0x44
+	.byte	0x3
+	.long	0x4b8
+	.uleb128 0x5
+	.long	.LASF1337
+	.byte	0x6
+	.byte	0xb
+	.byte	0x14
+	.long	0x563
+	.uleb128 0x1
+	.long	.LASF1338
+	.byte	0xb
+	.byte	0x15
+	.byte	0xe
+	.long	0xf4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1339
+	.byte	0xb
+	.byte	0x16
+	.byte	0xe
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1340
+	.byte	0xb
+	.byte	0x17
+	.byte	0xe
+	.long	0xf4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1341
+	.byte	0xb
+	.byte	0x18
+	.byte	0x3
+	.long	0x52f
+	.uleb128 0x5
+	.long	.LASF1342
+	.byte	0x1
+	.byte	0xc
+	.byte	0x1a
+	.long	0x589
+	.uleb128 0x1
+	.long	.LASF1343
+	.byte	0xc
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1344
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x3
+	.long	0x56f
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0xd
+	.byte	0x14
+	.long	0x62b
+	.uleb128 0x2
+	.long	.LASF1345
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1346
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1347
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1348
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1349
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1352
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1353
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1354
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1355
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1356
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1357
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1358
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1359
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1360
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1361
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1362
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1363
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1364
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1365
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1366
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1367
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1368
+	.byte	0xd
+	.byte	0x2d
+	.byte	0x3
+	.long	0x595
+	.uleb128 0x5
+	.long	.LASF1369
+	.byte	0x8
+	.byte	0xd
+	.byte	0x65
+	.long	0x678
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0xd
+	.byte	0x66
+	.byte	0xd
+	.long	0x62b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0xd
+	.byte	0x67
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0xd
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0xd
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1374
+	.byte	0xd
+	.byte	0x6f
+	.byte	0x3
+	.long	0x637
+	.uleb128 0x5
+	.long	.LASF1375
+	.byte	0x6
+	.byte	0xd
+	.byte	0x73
+	.long	0x6df
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0xd
+	.byte	0x74
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0xd
+	.byte	0x75
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0xd
+	.byte	0x76
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0xd
+	.byte	0x77
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0xd
+	.byte	0x78
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0xd
+	.byte	0x79
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1382
+	.byte	0xd
+	.byte	0x7a
+	.byte	0x3
+	.long	0x684
+	.uleb128 0x5
+	.long	.LASF1383
+	.byte	0x18
+	.byte	0xe
+	.byte	0x80
+	.long	0x746
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0xe
+	.byte	0x81
+	.byte	0xd
+	.long	0x746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0xe
+	.byte	0x82
+	.byte	0xe
+	.long	0x105
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0xe
+	.byte	0x83
+	.byte	0xe
+	.long	0x105
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0xe
+	.byte	0x84
+	.byte	0xe
+	.long	0x105
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0xe
+	.byte	0x85
+	.byte	0xe
+	.long	0x105
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0xe
+	.byte	0x87
+	.byte	0xd
+	.long	0xe3
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0xe3
+	.long	0x756
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1390
+	.byte	0xe
+	.byte	0x88
+	.byte	0x3
+	.long	0x6eb
+	.uleb128 0x5
+	.long	.LASF1391
+	.byte	0xa
+	.byte	0xf
+	.byte	0x18
+	.long	0x7bd
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0xf
+	.byte	0x19
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xe
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0xf
+	.byte	0x1e
+	.byte	0xe
+	.long	0xf4
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0xf
+	.byte	0x21
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1398
+	.byte	0xf
+	.byte	0x22
+	.byte	0x3
+	.long	0x762
+	.uleb128 0x5
+	.long	.LASF1399
+	.byte	0x6
+	.byte	0x10
+	.byte	0x14
+	.long	0x7fd
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x10
+	.byte	0x15
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x10
+	.byte	0x16
+	.byte	0xd
+	.long	0xc6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x10
+	.byte	0x17
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1403
+	.byte	0x10
+	.byte	0x18
+	.byte	0x3
+	.long	0x7c9
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x11
+	.byte	0x26
+	.long	0x84b
+	.uleb128 0x2
+	.long	.LASF1404
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1405
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1406
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1408
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1411
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1412
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1413
+	.byte	0x11
+	.byte	0x30
+	.byte	0x3
+	.long	0x809
+	.uleb128 0x5
+	.long	.LASF1414
+	.byte	0xc
+	.byte	0x11
+	.byte	0x32
+	.long	0x88b
+	.uleb128 0x1
+	.long	.LASF1415
+	.byte	0x11
+	.byte	0x33
+	.byte	0x14
+	.long	0x84b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1416
+	.byte	0x11
+	.byte	0x34
+	.byte	0x14
+	.long	0x84b
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1417
+	.byte	0x11
+	.byte	0x35
+	.byte	0x14
+	.long	0x84b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1418
+	.byte	0x11
+	.byte	0x36
+	.byte	0x3
+	.long	0x857
+	.uleb128 0x5
+	.long	.LASF1419
+	.byte	0x10
+	.byte	0x11
+	.byte	0x39
+	.long	0x8f2
+	.uleb128 0x1
+	.long	.LASF1420
+	.byte	0x11
+	.byte	0x3a
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1421
+	.byte	0x11
+	.byte	0x3b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x11
+	.byte	0x3c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x11
+	.byte	0x3e
+	.byte	0xd
+	.long	0x287
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x11
+	.byte	0x3f
+	.byte	0xd
+	.long	0xd2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1426
+	.byte	0x11
+	.byte	0x40
+	.byte	0x3
+	.long	0x897
+	.uleb128 0x5
+	.long	.LASF1427
+	.byte	0x2
+	.byte	0x12
+	.byte	0x27
+	.long	0x922
+	.uleb128 0x6
+	.string	"xy"
+	.byte	0x12
+	.byte	0x28
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x12
+	.byte	0x29
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1428
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x3
+	.long	0x8fe
+	.uleb128 0x5
+	.long	.LASF1429
+	.byte	0x8
+	.byte	0x13
+	.byte	0x24
+	.long	0x96f
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x13
+	.byte	0x25
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0x13
+	.byte	0x26
+	.byte	0xe
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1432
+	.byte	0x13
+	.byte	0x27
+	.byte	0xe
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x13
+	.byte	0x28
+	.byte	0xe
+	.long	0xf4
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1434
+	.byte	0x13
+	.byte	0x29
+	.byte	0x3
+	.long	0x92e
+	.uleb128 0x5
+	.long	.LASF1435
+	.byte	0x10
+	.byte	0x14
+	.byte	0x1f
+	.long	0x9bc
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x14
+	.byte	0x20
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1437
+	.byte	0x14
+	.byte	0x21
+	.byte	0xb
+	.long	0x116
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x14
+	.byte	0x22
+	.byte	0xb
+	.long	0x116
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x14
+	.byte	0x23
+	.byte	0xb
+	.long	0x116
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1440
+	.byte	0x14
+	.byte	0x24
+	.byte	0x3
+	.long	0x97b
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x15
+	.byte	0x1c
+	.long	0x9ec
+	.uleb128 0x2
+	.long	.LASF1441
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1442
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1443
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1444
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1445
+	.byte	0x15
+	.byte	0x21
+	.byte	0x3
+	.long	0x9c8
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x15
+	.byte	0x23
+	.long	0xa10
+	.uleb128 0x2
+	.long	.LASF1446
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1447
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1448
+	.byte	0x15
+	.byte	0x26
+	.byte	0x3
+	.long	0x9f8
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x15
+	.byte	0x28
+	.long	0xa34
+	.uleb128 0x2
+	.long	.LASF1449
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1450
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1451
+	.byte	0x15
+	.byte	0x2b
+	.byte	0x3
+	.long	0xa1c
+	.uleb128 0x5
+	.long	.LASF1452
+	.byte	0x20
+	.byte	0x15
+	.byte	0x2c
+	.long	0xab5
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x15
+	.byte	0x2d
+	.byte	0x19
+	.long	0x9ec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x15
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x17
+	.long	0x13c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x15
+	.byte	0x30
+	.byte	0x8
+	.long	0x116
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0x15
+	.byte	0x31
+	.byte	0xb
+	.long	0x116
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x15
+	.byte	0x32
+	.byte	0x1b
+	.long	0xa10
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0x15
+	.byte	0x33
+	.byte	0x11
+	.long	0xa34
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x15
+	.byte	0x34
+	.byte	0xe
+	.long	0xf4
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1461
+	.byte	0x15
+	.byte	0x35
+	.byte	0x3
+	.long	0xa40
+	.uleb128 0x18
+	.long	.LASF1462
+	.value	0x218
+	.byte	0x16
+	.byte	0x14
+	.long	0xc04
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x16
+	.byte	0x15
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x16
+	.byte	0x17
+	.byte	0x12
+	.long	0x21c
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x16
+	.byte	0x19
+	.byte	0x19
+	.long	0x6df
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x16
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x16
+	.byte	0x1c
+	.byte	0xe
+	.long	0xf4
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0x16
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc6
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0x16
+	.byte	0x21
+	.byte	0x19
+	.long	0x305
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1470
+	.byte	0x16
+	.byte	0x24
+	.byte	0xd
+	.long	0xe3
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1471
+	.byte	0x16
+	.byte	0x25
+	.byte	0xb
+	.long	0x116
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0x16
+	.byte	0x26
+	.byte	0x13
+	.long	0x922
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x16
+	.byte	0x28
+	.byte	0x17
+	.long	0x9bc
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x16
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x16
+	.byte	0x2d
+	.byte	0x1f
+	.long	0xc04
+	.byte	0x84
+	.uleb128 0x4
+	.long	.LASF1476
+	.byte	0x16
+	.byte	0x30
+	.byte	0xd
+	.long	0xe3
+	.value	0x1c4
+	.uleb128 0x4
+	.long	.LASF1477
+	.byte	0x16
+	.byte	0x31
+	.byte	0xd
+	.long	0xe3
+	.value	0x1c5
+	.uleb128 0x4
+	.long	.LASF1478
+	.byte	0x16
+	.byte	0x32
+	.byte	0xd
+	.long	0xe3
+	.value	0x1c6
+	.uleb128 0x4
+	.long	.LASF1479
+	.byte	0x16
+	.byte	0x33
+	.byte	0xd
+	.long	0xe3
+	.value	0x1c7
+	.uleb128 0x4
+	.long	.LASF1480
+	.byte	0x16
+	.byte	0x35
+	.byte	0xe
+	.long	0xf4
+	.value	0x1c8
+	.uleb128 0x4
+	.long	.LASF1481
+	.byte	0x16
+	.byte	0x36
+	.byte	0xd
+	.long	0xe3
+	.value	0x1ca
+	.uleb128 0x4
+	.long	.LASF1482
+	.byte	0x16
+	.byte	0x39
+	.byte	0x12
+	.long	0xc14
+	.value	0x1cc
+	.uleb128 0x4
+	.long	.LASF1483
+	.byte	0x16
+	.byte	0x3c
+	.byte	0x16
+	.long	0x4ac
+	.value	0x20c
+	.uleb128 0x4
+	.long	.LASF1484
+	.byte	0x16
+	.byte	0x3f
+	.byte	0x13
+	.long	0x385
+	.value	0x214
+	.uleb128 0x4
+	.long	.LASF1485
+	.byte	0x16
+	.byte	0x42
+	.byte	0x14
+	.long	0x589
+	.value	0x216
+	.byte	0
+	.uleb128 0x8
+	.long	0x678
+	.long	0xc14
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x8
+	.long	0x452
+	.long	0xc24
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1486
+	.byte	0x16
+	.byte	0x47
+	.byte	0x3
+	.long	0xac1
+	.uleb128 0x18
+	.long	.LASF1487
+	.value	0x7dc
+	.byte	0x17
+	.byte	0x17
+	.long	0xe67
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0x17
+	.byte	0x18
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0x17
+	.byte	0x19
+	.byte	0xe
+	.long	0x105
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0x17
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0x17
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x17
+	.byte	0x1c
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x17
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x17
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe3
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x17
+	.byte	0x20
+	.byte	0x12
+	.long	0xe67
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x17
+	.byte	0x23
+	.byte	0x19
+	.long	0x563
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x17
+	.byte	0x24
+	.byte	0x16
+	.long	0x3d2
+	.byte	0xd6
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0x17
+	.byte	0x26
+	.byte	0xe
+	.long	0xf4
+	.byte	0xde
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0x17
+	.byte	0x27
+	.byte	0xe
+	.long	0xf4
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0x17
+	.byte	0x28
+	.byte	0xe
+	.long	0xf4
+	.byte	0xe2
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0x17
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x88b
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x17
+	.byte	0x2d
+	.byte	0x16
+	.long	0x7fd
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xc
+	.long	0xba
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x17
+	.byte	0x30
+	.byte	0xd
+	.long	0xe3
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0x17
+	.byte	0x31
+	.byte	0xe
+	.long	0xf4
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0x17
+	.byte	0x32
+	.byte	0xe
+	.long	0xf4
+	.byte	0xfa
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x17
+	.byte	0x33
+	.byte	0xe
+	.long	0xf4
+	.byte	0xfc
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x17
+	.byte	0x34
+	.byte	0xd
+	.long	0xe3
+	.byte	0xfe
+	.uleb128 0x4
+	.long	.LASF1509
+	.byte	0x17
+	.byte	0x35
+	.byte	0xe
+	.long	0xf4
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1510
+	.byte	0x17
+	.byte	0x36
+	.byte	0xe
+	.long	0xf4
+	.value	0x102
+	.uleb128 0x4
+	.long	.LASF1511
+	.byte	0x17
+	.byte	0x38
+	.byte	0x12
+	.long	0x96f
+	.value	0x104
+	.uleb128 0x4
+	.long	.LASF1512
+	.byte	0x17
+	.byte	0x3a
+	.byte	0xe
+	.long	0xf4
+	.value	0x10c
+	.uleb128 0x4
+	.long	.LASF1513
+	.byte	0x17
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x297
+	.value	0x10e
+	.uleb128 0x4
+	.long	.LASF1514
+	.byte	0x17
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x297
+	.value	0x114
+	.uleb128 0x4
+	.long	.LASF1515
+	.byte	0x17
+	.byte	0x3d
+	.byte	0x14
+	.long	0x8f2
+	.value	0x11c
+	.uleb128 0x4
+	.long	.LASF1516
+	.byte	0x17
+	.byte	0x3f
+	.byte	0x15
+	.long	0x7bd
+	.value	0x12c
+	.uleb128 0x4
+	.long	.LASF1517
+	.byte	0x17
+	.byte	0x41
+	.byte	0x10
+	.long	0x523
+	.value	0x136
+	.uleb128 0x4
+	.long	.LASF1518
+	.byte	0x17
+	.byte	0x42
+	.byte	0x1a
+	.long	0x171
+	.value	0x148
+	.uleb128 0x4
+	.long	.LASF1519
+	.byte	0x17
+	.byte	0x44
+	.byte	0xd
+	.long	0xe3
+	.value	0x14c
+	.uleb128 0x4
+	.long	.LASF1520
+	.byte	0x17
+	.byte	0x45
+	.byte	0xd
+	.long	0xe3
+	.value	0x14d
+	.uleb128 0x4
+	.long	.LASF1521
+	.byte	0x17
+	.byte	0x46
+	.byte	0xd
+	.long	0xe3
+	.value	0x14e
+	.uleb128 0x4
+	.long	.LASF1522
+	.byte	0x17
+	.byte	0x48
+	.byte	0x16
+	.long	0x3f8
+	.value	0x14f
+	.uleb128 0x4
+	.long	.LASF1523
+	.byte	0x17
+	.byte	0x49
+	.byte	0xc
+	.long	0xba
+	.value	0x150
+	.uleb128 0x4
+	.long	.LASF1524
+	.byte	0x17
+	.byte	0x4f
+	.byte	0x14
+	.long	0x756
+	.value	0x154
+	.uleb128 0x4
+	.long	.LASF1525
+	.byte	0x17
+	.byte	0x51
+	.byte	0x17
+	.long	0xab5
+	.value	0x16c
+	.uleb128 0x4
+	.long	.LASF1526
+	.byte	0x17
+	.byte	0x53
+	.byte	0xd
+	.long	0xe3
+	.value	0x18c
+	.uleb128 0x4
+	.long	.LASF1527
+	.byte	0x17
+	.byte	0x5a
+	.byte	0xf
+	.long	0xe77
+	.value	0x190
+	.uleb128 0x4
+	.long	.LASF1528
+	.byte	0x17
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe3
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x8
+	.long	0x352
+	.long	0xe77
+	.uleb128 0xa
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0xc24
+	.long	0xe87
+	.uleb128 0xa
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1487
+	.byte	0x17
+	.byte	0x5c
+	.byte	0x3
+	.long	0xc30
+	.uleb128 0xc
+	.long	0xe87
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x18
+	.byte	0x14
+	.long	0xed4
+	.uleb128 0x2
+	.long	.LASF1529
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1530
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1531
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1532
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1533
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1534
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1535
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0x80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1537
+	.byte	0x18
+	.byte	0x18
+	.byte	0x23
+	.long	0xf2e
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x18
+	.byte	0x24
+	.byte	0x11
+	.long	0x111
+	.byte	0
+	.uleb128 0x6
+	.string	"id"
+	.byte	0x18
+	.byte	0x25
+	.byte	0x14
+	.long	0x100
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x18
+	.byte	0x26
+	.byte	0x13
+	.long	0xef
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x18
+	.byte	0x27
+	.byte	0x14
+	.long	0x100
+	.byte	0xc
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x18
+	.byte	0x28
+	.byte	0x13
+	.long	0xde
+	.byte	0x10
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x18
+	.byte	0x29
+	.byte	0x13
+	.long	0xde
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1541
+	.byte	0x18
+	.byte	0x2a
+	.byte	0x3
+	.long	0xed4
+	.uleb128 0xc
+	.long	0xf2e
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x18
+	.byte	0x2c
+	.long	0xf60
+	.uleb128 0x11
+	.long	.LASF1542
+	.byte	0x18
+	.byte	0x2d
+	.byte	0xd
+	.long	0xd2
+	.uleb128 0x11
+	.long	.LASF1543
+	.byte	0x18
+	.byte	0x2e
+	.byte	0xb
+	.long	0x116
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1544
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x3
+	.long	0xf3f
+	.uleb128 0x8
+	.long	0xf3a
+	.long	0xf77
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0xc
+	.long	0xf6c
+	.uleb128 0x19
+	.long	.LASF1545
+	.byte	0x31
+	.byte	0x1c
+	.long	0xf77
+	.uleb128 0x19
+	.long	.LASF1546
+	.byte	0x32
+	.byte	0x17
+	.long	0x100
+	.uleb128 0x5
+	.long	.LASF1547
+	.byte	0x8
+	.byte	0x19
+	.byte	0x25
+	.long	0xfd2
+	.uleb128 0x6
+	.string	"id"
+	.byte	0x19
+	.byte	0x26
+	.byte	0xe
+	.long	0xf4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x19
+	.byte	0x27
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x19
+	.byte	0x28
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x19
+	.byte	0x29
+	.byte	0x17
+	.long	0xf60
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1550
+	.byte	0x19
+	.byte	0x2a
+	.byte	0x3
+	.long	0xf92
+	.uleb128 0xc
+	.long	0xfd2
+	.uleb128 0xb
+	.long	0x3c
+	.byte	0x19
+	.byte	0x2c
+	.long	0x1001
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1552
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1553
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1554
+	.byte	0x19
+	.byte	0x30
+	.byte	0x3
+	.long	0xfe3
+	.uleb128 0x21
+	.long	.LASF1573
+	.byte	0x18
+	.byte	0x39
+	.byte	0x6
+	.long	0x102e
+	.uleb128 0x9
+	.long	0x102e
+	.uleb128 0x9
+	.long	0x1033
+	.uleb128 0x9
+	.long	0xe3
+	.uleb128 0x9
+	.long	0xf60
+	.byte	0
+	.uleb128 0xd
+	.long	0xe87
+	.uleb128 0xd
+	.long	0xf3a
+	.uleb128 0x14
+	.long	.LASF1555
+	.byte	0x3a
+	.byte	0x5
+	.long	0x14d
+	.long	0x1052
+	.uleb128 0x9
+	.long	0x1033
+	.uleb128 0x9
+	.long	0xf60
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1556
+	.byte	0x1a
+	.value	0x13d
+	.byte	0x11
+	.long	0xa7
+	.long	0x1069
+	.uleb128 0x9
+	.long	0x116
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1557
+	.byte	0x34
+	.byte	0x16
+	.long	0x1033
+	.long	0x107e
+	.uleb128 0x9
+	.long	0xf4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1558
+	.byte	0x38
+	.byte	0x13
+	.long	0xf60
+	.long	0x109d
+	.uleb128 0x9
+	.long	0x109d
+	.uleb128 0x9
+	.long	0x1033
+	.uleb128 0x9
+	.long	0xe3
+	.byte	0
+	.uleb128 0xd
+	.long	0xe93
+	.uleb128 0x12
+	.long	.LASF1562
+	.byte	0xac
+	.byte	0x14
+	.long	0x1001
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x116c
+	.uleb128 0xe
+	.long	.LASF1559
+	.byte	0xac
+	.byte	0x34
+	.long	0x102e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xe
+	.long	.LASF1560
+	.byte	0xac
+	.byte	0x56
+	.long	0x116c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xf
+	.long	.LASF1549
+	.byte	0xae
+	.byte	0x1a
+	.long	0x1033
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xf
+	.long	.LASF1561
+	.byte	0xaf
+	.byte	0x17
+	.long	0xf60
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x15
+	.quad	.LVL38
+	.long	0x1069
+	.uleb128 0x1a
+	.quad	.LVL42
+	.long	0x1038
+	.long	0x113a
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL43
+	.long	0x100d
+	.long	0x115e
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL54
+	.long	0x1052
+	.byte	0
+	.uleb128 0xd
+	.long	0xfde
+	.uleb128 0x12
+	.long	.LASF1563
+	.byte	0x9c
+	.byte	0x5
+	.long	0x14d
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11f8
+	.uleb128 0xe
+	.long	.LASF1559
+	.byte	0x9c
+	.byte	0x29
+	.long	0x109d
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xe
+	.long	.LASF1564
+	.byte	0x9c
+	.byte	0x3a
+	.long	0xf4
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xe
+	.long	.LASF1560
+	.byte	0x9c
+	.byte	0x55
+	.long	0x11f8
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xf
+	.long	.LASF1548
+	.byte	0x9e
+	.byte	0xd
+	.long	0xe3
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x23
+	.long	.LASF1549
+	.byte	0x1
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x1033
+	.uleb128 0x15
+	.quad	.LVL34
+	.long	0x107e
+	.byte	0
+	.uleb128 0xd
+	.long	0xfd2
+	.uleb128 0x24
+	.long	.LASF1574
+	.byte	0x1
+	.byte	0x96
+	.byte	0xa
+	.long	0xf4
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x12
+	.long	.LASF1565
+	.byte	0x69
+	.byte	0x9
+	.long	0xe3
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12c8
+	.uleb128 0x1b
+	.long	.LASF1570
+	.byte	0x69
+	.byte	0x2f
+	.long	0x148
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.long	.LASF1566
+	.byte	0x69
+	.byte	0x40
+	.long	0xf4
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xe
+	.long	.LASF1560
+	.byte	0x69
+	.byte	0x5c
+	.long	0x11f8
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.long	.LASF1567
+	.byte	0x6b
+	.byte	0xe
+	.long	0x105
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xf
+	.long	.LASF1568
+	.byte	0x6c
+	.byte	0xd
+	.long	0xe3
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0x6d
+	.long	0xe3
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1d
+	.long	0x1362
+	.quad	.LBI20
+	.byte	.LVU78
+	.long	.LLRL12
+	.byte	0x73
+	.byte	0xc
+	.uleb128 0x16
+	.long	0x1373
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1569
+	.byte	0x51
+	.byte	0x9
+	.long	0xe3
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1362
+	.uleb128 0x1b
+	.long	.LASF1570
+	.byte	0x51
+	.byte	0x29
+	.long	0x154
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.long	.LASF1560
+	.byte	0x51
+	.byte	0x4b
+	.long	0x116c
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xf
+	.long	.LASF1568
+	.byte	0x53
+	.byte	0xd
+	.long	0xe3
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.long	.LASF1567
+	.byte	0x54
+	.byte	0xe
+	.long	0x105
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0x55
+	.long	0xe3
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1d
+	.long	0x1362
+	.quad	.LBI4
+	.byte	.LVU13
+	.long	.LLRL5
+	.byte	0x53
+	.byte	0x14
+	.uleb128 0x16
+	.long	0x1373
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1571
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x9
+	.long	0xe3
+	.byte	0x1
+	.long	0x1380
+	.uleb128 0x26
+	.long	.LASF1539
+	.byte	0x1
+	.byte	0x3e
+	.byte	0x25
+	.long	0xe3
+	.byte	0
+	.uleb128 0x27
+	.long	0x1362
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x16
+	.long	0x1373
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL37-.LVL36
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-.LVL36
+	.uleb128 .LVL46-.LVL36
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL46-.LVL36
+	.uleb128 .LVL48-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL36
+	.uleb128 .LVL51-.LVL36
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL51-.LVL36
+	.uleb128 .LVL53-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL36
+	.uleb128 .LVL58-.LVL36
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL58-.LVL36
+	.uleb128 .LFE5-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL38-1-.LVL36
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-1-.LVL36
+	.uleb128 .LVL44-.LVL36
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL44-.LVL36
+	.uleb128 .LVL48-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL36
+	.uleb128 .LVL49-.LVL36
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL49-.LVL36
+	.uleb128 .LVL53-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL36
+	.uleb128 .LVL57-.LVL36
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.LVL36
+	.uleb128 .LFE5-.LVL36
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU168
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU193
+	.uleb128 .LVU196
+	.uleb128 .LVU200
+	.uleb128 .LVU203
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+.LLST20:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.LVL38
+	.uleb128 .LVL45-.LVL38
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL48-.LVL38
+	.uleb128 .LVL50-.LVL38
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL53-.LVL38
+	.uleb128 .LVL55-.LVL38
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL55-.LVL38
+	.uleb128 .LVL56-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU185
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU202
+.LLST21:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL47-.LVL41
+	.uleb128 0x2
+	.byte	0x5d
+	.byte	0xf0
+	.byte	0x4
+	.uleb128 .LVL48-.LVL41
+	.uleb128 .LVL52-.LVL41
+	.uleb128 0x2
+	.byte	0x5d
+	.byte	0xf0
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU158
+	.uleb128 .LVU158
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL34-1-.LVL30
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-1-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL33-.LVL30
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL31-.LVL30
+	.uleb128 .LVL35-.LVL30
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU135
+	.uleb128 .LVU158
+.LLST17:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL34-1-.LVL32
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL18-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-.LVL15
+	.uleb128 .LVL19-.LVL15
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.LVL15
+	.uleb128 .LVL21-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL15
+	.uleb128 .LVL27-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL27-.LVL15
+	.uleb128 .LVL29-.LVL15
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL15
+	.uleb128 .LFE2-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-.LVL15
+	.uleb128 .LFE2-.LVL15
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU71
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU113
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL22-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL15
+	.uleb128 .LVL25-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.LVL15
+	.uleb128 .LVL27-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL15
+	.uleb128 .LVL28-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL29-.LVL15
+	.uleb128 .LFE2-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU84
+	.uleb128 .LVU88
+.LLST10:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+.LLST11:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU78
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL16
+	.byte	0x4
+	.uleb128 .LVL16-.LVL16
+	.uleb128 .LVL18-.LVL16
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 3
+	.byte	0x4
+	.uleb128 .LVL19-.LVL16
+	.uleb128 .LVL19-.LVL16
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 3
+	.byte	0x4
+	.uleb128 .LVL26-.LVL16
+	.uleb128 .LVL27-.LVL16
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 3
+	.byte	0x4
+	.uleb128 .LVL29-.LVL16
+	.uleb128 .LFE2-.LVL16
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 3
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL7-.LVL2
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.LVL2
+	.uleb128 .LVL11-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL2
+	.uleb128 .LFE1-.LVL2
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU44
+	.uleb128 .LVU65
+.LLST2:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU21
+	.uleb128 .LVU43
+	.uleb128 .LVU50
+	.uleb128 .LVU65
+.LLST3:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LVL14-.LVL5
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU41
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+.LLST4:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL7-.LVL6
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL6
+	.uleb128 .LVL8-.LVL6
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL8-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL6
+	.uleb128 .LVL14-.LVL6
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU43
+	.uleb128 .LVU44
+	.uleb128 .LVU65
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL5-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL3
+	.uleb128 .LVL11-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-.LVL3
+	.uleb128 .LFE1-.LVL3
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LFE0-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x7c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB4
+	.byte	0x4
+	.uleb128 .LBB4-.LBB4
+	.uleb128 .LBE4-.LBB4
+	.byte	0x4
+	.uleb128 .LBB12-.LBB4
+	.uleb128 .LBE12-.LBB4
+	.byte	0x4
+	.uleb128 .LBB13-.LBB4
+	.uleb128 .LBE13-.LBB4
+	.byte	0x4
+	.uleb128 .LBB14-.LBB4
+	.uleb128 .LBE14-.LBB4
+	.byte	0x4
+	.uleb128 .LBB15-.LBB4
+	.uleb128 .LBE15-.LBB4
+	.byte	0x4
+	.uleb128 .LBB16-.LBB4
+	.uleb128 .LBE16-.LBB4
+	.byte	0x4
+	.uleb128 .LBB17-.LBB4
+	.uleb128 .LBE17-.LBB4
+	.byte	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB20
+	.byte	0x4
+	.uleb128 .LBB20-.LBB20
+	.uleb128 .LBE20-.LBB20
+	.byte	0x4
+	.uleb128 .LBB26-.LBB20
+	.uleb128 .LBE26-.LBB20
+	.byte	0x4
+	.uleb128 .LBB27-.LBB20
+	.uleb128 .LBE27-.LBB20
+	.byte	0x4
+	.uleb128 .LBB28-.LBB20
+	.uleb128 .LBE28-.LBB20
+	.byte	0x4
+	.uleb128 .LBB29-.LBB20
+	.uleb128 .LBE29-.LBB20
+	.byte	0
+.LLRL22:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 27 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.file 30 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1f
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 32 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 33 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x21
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 36 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x26
+	.file 39 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 43 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 44 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x31
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1000
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1027
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 57 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.file 58 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 59 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 60 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1150
+	.byte	0x4
+	.file 61 ".//src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 62 ".//src/main/common/color.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 63 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.file 64 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1163
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 65 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1171
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x4
+	.file 66 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 67 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1242
+	.byte	0x4
+	.file 68 ".//src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1243
+	.byte	0x4
+	.file 69 ".//src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 70 ".//src/main/config/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 71 ".//src/main/config/config.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1255
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF992
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1029
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1056
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1120
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1130
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1149
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1157
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1162
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1167
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1170
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1187
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1194
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1216
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1219
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1233
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1236
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1241
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1245
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1254
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_values.h.32.11f6a86bb47beeedafaf69664c3a4228,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1257
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_dump.h.32.5e23d98a241c71458dcd7c8003f01eee,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1260
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1337:
+	.string	"escAndServoConfig_s"
+.LASF1341:
+	.string	"escAndServoConfig_t"
+.LASF1200:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1212:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1161:
+	.string	"HSV_VALUE_MAX 255"
+.LASF754:
+	.string	"__DECL_SIMD_logf "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1100:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF987:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1166:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1218:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF863:
+	.string	"__DECL_SIMD_sinh "
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1389:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF791:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1233:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1468:
+	.string	"mag_declination"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1388:
+	.string	"gps_passthrough_baudrate"
+.LASF1223:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF907:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF764:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF983:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1227:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1339:
+	.string	"maxthrottle"
+.LASF1532:
+	.string	"VAR_INT16"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1267:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1555:
+	.string	"isConfigValueInRange"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1286:
+	.string	"_Bool"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1256:
+	.string	"VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)"
+.LASF722:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1300:
+	.string	"flightDynamicsTrims_t"
+.LASF1130:
+	.string	"U_ID_2 0"
+.LASF1290:
+	.string	"A_level"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1032:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1497:
+	.string	"flight3DConfig"
+.LASF1215:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1546:
+	.string	"configValueCount"
+.LASF1325:
+	.string	"failsafe_throttle"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1304:
+	.string	"motorMixer_t"
+.LASF1283:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1410:
+	.string	"CW90_DEG_FLIP"
+.LASF946:
+	.string	"__DECL_SIMD_erff16 "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1520:
+	.string	"disarm_kill_switch"
+.LASF1230:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF1016:
+	.string	"__f32x(x) x ##f32x"
+.LASF1412:
+	.string	"CW270_DEG_FLIP"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF768:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1545:
+	.string	"configValues"
+.LASF1314:
+	.string	"deadband3d_throttle"
+.LASF1402:
+	.string	"yawDegrees"
+.LASF934:
+	.string	"__DECL_SIMD_acoshf "
+.LASF739:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF865:
+	.string	"__DECL_SIMD_sinhl "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF727:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1279:
+	.string	"uint16_t"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1319:
+	.string	"middle"
+.LASF1469:
+	.string	"accelerometerTrims"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1521:
+	.string	"small_angle"
+.LASF1288:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF746:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF885:
+	.string	"__DECL_SIMD_atan2l "
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1095:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF721:
+	.string	"_MATH_H 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF735:
+	.string	"__DECL_SIMD_sinl "
+.LASF1152:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1443:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF1110:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1477:
+	.string	"yaw_deadband"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1219:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1382:
+	.string	"controlRateConfig_t"
+.LASF756:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1511:
+	.string	"gyroConfig"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1366:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1522:
+	.string	"airplaneConfig"
+.LASF1017:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1429:
+	.string	"gyroConfig_s"
+.LASF812:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1013:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF755:
+	.string	"__DECL_SIMD_logl "
+.LASF1029:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1154:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1448:
+	.string	"frskyGpsCoordFormat_e"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF992:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1238:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF763:
+	.string	"__DECL_SIMD_exp "
+.LASF1383:
+	.string	"serialConfig_s"
+.LASF973:
+	.string	"__DECL_SIMD_erfc "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF855:
+	.string	"__DECL_SIMD_expm1l "
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1047:
+	.string	"_Mdouble_"
+.LASF1277:
+	.string	"int32_t"
+.LASF995:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1174:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1149:
+	.string	"FAST_MATH "
+.LASF1140:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF947:
+	.string	"__DECL_SIMD_erff32 "
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF765:
+	.string	"__DECL_SIMD_expl "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1493:
+	.string	"pid_process_denom"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF509:
+	.string	"__always_inline"
+.LASF829:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1001:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1146:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1184:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1299:
+	.string	"values"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1349:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1048:
+	.string	"__MATH_PRECNAME"
+.LASF898:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1225:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1058:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1081:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1051:
+	.string	"_Mdouble_ float"
+.LASF1544:
+	.string	"int_float_value_t"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1425:
+	.string	"baroGroundPressure"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1035:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1498:
+	.string	"motor_pwm_rate"
+.LASF823:
+	.string	"__DECL_SIMD_exp2 "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF935:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1084:
+	.string	"__MATHCALL_NARROW"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1069:
+	.string	"__MATHDECL_1"
+.LASF1247:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1359:
+	.string	"BOXLEDLOW"
+.LASF1329:
+	.string	"rxConfig_s"
+.LASF1336:
+	.string	"rxConfig_t"
+.LASF1564:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1134:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF944:
+	.string	"__DECL_SIMD_erff "
+.LASF1186:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF1305:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1005:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1424:
+	.string	"gyroZero"
+.LASF1258:
+	.string	"CONFIG_DUMP_FORMAT_VERSION 1"
+.LASF1347:
+	.string	"BOXHORIZON"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1191:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1494:
+	.string	"emf_avoidance"
+.LASF916:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1409:
+	.string	"CW0_DEG_FLIP"
+.LASF811:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1335:
+	.string	"rssi_channel"
+.LASF1036:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1292:
+	.string	"dterm_lpf_hz"
+.LASF1324:
+	.string	"failsafe_off_delay"
+.LASF1381:
+	.string	"yawRate"
+.LASF1096:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1519:
+	.string	"retarded_arm"
+.LASF1137:
+	.string	"USE_GYRO_SITL "
+.LASF1229:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1360:
+	.string	"BOXLLIGHTS"
+.LASF997:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1093:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1348:
+	.string	"BOXBARO"
+.LASF1470:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1313:
+	.string	"neutral3d"
+.LASF1138:
+	.string	"ACC "
+.LASF1378:
+	.string	"thrMid8"
+.LASF1133:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF848:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1231:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF1524:
+	.string	"serialConfig"
+.LASF924:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF782:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1539:
+	.string	"type"
+.LASF1264:
+	.string	"long unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1405:
+	.string	"CW0_DEG"
+.LASF1245:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF1296:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1332:
+	.string	"midrc"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1239:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1298:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1268:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1270:
+	.string	"__uint16_t"
+.LASF1020:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1208:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF392:
+	.string	"false 0"
+.LASF849:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1141:
+	.string	"USE_BARO_SITL "
+.LASF816:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF358:
+	.string	"__k8 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF894:
+	.string	"__DECL_SIMD_log10f "
+.LASF1408:
+	.string	"CW270_DEG"
+.LASF1505:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1456:
+	.string	"gpsNoFixLatitude"
+.LASF1106:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1148:
+	.string	"PROFILING "
+.LASF788:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF850:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1105:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF779:
+	.string	"__DECL_SIMD_powf128 "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1098:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1150:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1113:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1261:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1488:
+	.string	"mixerConfiguration"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF911:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1558:
+	.string	"configValueGet"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1026:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1473:
+	.string	"barometerConfig"
+.LASF1513:
+	.string	"accZero"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1213:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1272:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1203:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1281:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1393:
+	.string	"vbatmaxcellvoltage"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1345:
+	.string	"BOXARM"
+.LASF1571:
+	.string	"configDumpValueSize"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1136:
+	.string	"GYRO "
+.LASF1333:
+	.string	"mincheck"
+.LASF945:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1463:
+	.string	"pidController"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1167:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1124:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1565:
+	.string	"configDumpDecodeRecord"
+.LASF1361:
+	.string	"BOXCALIB"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1194:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1222:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1145:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1318:
+	.string	"servoParam_t"
+.LASF902:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1404:
+	.string	"ALIGN_DEFAULT"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF1165:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1357:
+	.string	"BOXBEEPERON"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF508:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1433:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF796:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1099:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1055:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1092:
+	.string	"FP_NORMAL 4"
+.LASF1373:
+	.string	"rangeEndStep"
+.LASF1540:
+	.string	"offset"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF806:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1496:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1043:
+	.string	"_Mdouble_ double"
+.LASF1287:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1211:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1343:
+	.string	"gimbal_flags"
+.LASF1536:
+	.string	"PROFILE_VALUE"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF844:
+	.string	"__DECL_SIMD_coshf "
+.LASF1560:
+	.string	"record"
+.LASF925:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF376:
+	.string	"unix 1"
+.LASF1178:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF917:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1465:
+	.string	"controlRateConfig"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1045:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1467:
+	.string	"tpa_breakpoint"
+.LASF1563:
+	.string	"configDumpGetRecord"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1131:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1549:
+	.string	"value"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF732:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF895:
+	.string	"__DECL_SIMD_log10l "
+.LASF1450:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF1574:
+	.string	"configDumpIndexCount"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1452:
+	.string	"telemetryConfig_s"
+.LASF1461:
+	.string	"telemetryConfig_t"
+.LASF772:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1198:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1078:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF988:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1185:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF901:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF804:
+	.string	"__DECL_SIMD_asinf "
+.LASF1528:
+	.string	"current_profile_index"
+.LASF1568:
+	.string	"size"
+.LASF1224:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1499:
+	.string	"dshot_rate"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF1423:
+	.string	"calibrated"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1046:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1059:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF771:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF724:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1003:
+	.string	"__HAVE_FLOAT64 1"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1112:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF783:
+	.string	"__DECL_SIMD_acos "
+.LASF1123:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1278:
+	.string	"uint8_t"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1449:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1531:
+	.string	"VAR_UINT16"
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF789:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1501:
+	.string	"sensorAlignmentConfig"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF963:
+	.string	"__DECL_SIMD_asinh "
+.LASF1181:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1116:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1364:
+	.string	"BOXTELEMETRY"
+.LASF991:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF790:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1216:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1368:
+	.string	"boxId_e"
+.LASF1135:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF694:
+	.string	"__need_size_t "
+.LASF1089:
+	.string	"FP_INFINITE 1"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1158:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF733:
+	.string	"__DECL_SIMD_sin "
+.LASF1530:
+	.string	"VAR_INT8"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF929:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF999:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1176:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1205:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1514:
+	.string	"magZero"
+.LASF1094:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1183:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF776:
+	.string	"__DECL_SIMD_powf16 "
+.LASF807:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1024:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1533:
+	.string	"VAR_UINT32"
+.LASF1169:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF845:
+	.string	"__DECL_SIMD_coshl "
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1063:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1187:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1254:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF761:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1172:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1052:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1573:
+	.string	"configValueSet"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1132:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1572:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1550:
+	.string	"configDumpRecord_t"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1321:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1226:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF1447:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1000:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF856:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1316:
+	.string	"airplaneConfig_t"
+.LASF1372:
+	.string	"rangeStartStep"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF998:
+	.string	"__f128(x) x ##f128"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1054:
+	.string	"_Mdouble_ long double"
+.LASF736:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1474:
+	.string	"acc_unarmedcal"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1369:
+	.string	"modeActivationCondition_s"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1483:
+	.string	"failsafeConfig"
+.LASF984:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1308:
+	.string	"tri_unarmed_servo"
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1414:
+	.string	"sensorAlignmentConfig_s"
+.LASF1418:
+	.string	"sensorAlignmentConfig_t"
+.LASF1201:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1491:
+	.string	"gyro_sync"
+.LASF725:
+	.string	"__DECL_SIMD_cosl "
+.LASF843:
+	.string	"__DECL_SIMD_cosh "
+.LASF1295:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1037:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF715:
+	.string	"NULL"
+.LASF1529:
+	.string	"VAR_UINT8"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1209:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF1297:
+	.string	"pitch"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1396:
+	.string	"currentMeterOffset"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1350:
+	.string	"BOXHEADFREE"
+.LASF462:
+	.string	"__PMT"
+.LASF1526:
+	.string	"blackbox_rate_denom"
+.LASF1454:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1294:
+	.string	"pidProfile_s"
+.LASF1293:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1455:
+	.string	"frsky_inversion"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1417:
+	.string	"mag_align"
+.LASF904:
+	.string	"__DECL_SIMD_log2f "
+.LASF1547:
+	.string	"configDumpRecord_s"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF953:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF753:
+	.string	"__DECL_SIMD_log "
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF996:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1030:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1255:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1400:
+	.string	"rollDegrees"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1322:
+	.string	"failsafeConfig_s"
+.LASF1328:
+	.string	"failsafeConfig_t"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF757:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF893:
+	.string	"__DECL_SIMD_log10 "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF802:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF801:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF472:
+	.string	"__P(args) args"
+.LASF1210:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1012:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1427:
+	.string	"accDeadband_s"
+.LASF853:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1307:
+	.string	"yaw_direction"
+.LASF1062:
+	.string	"_Mdouble_ _Float128"
+.LASF1534:
+	.string	"VAR_FLOAT"
+.LASF1485:
+	.string	"gimbalConfig"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1442:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF919:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1538:
+	.string	"name"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1122:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1275:
+	.string	"int8_t"
+.LASF1234:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF1155:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF915:
+	.string	"__DECL_SIMD_log1pl "
+.LASF797:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF747:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF717:
+	.string	"__need_NULL"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1083:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1064:
+	.string	"_Mdouble_ _Float32x"
+.LASF1159:
+	.string	"HSV_HUE_MAX 359"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1362:
+	.string	"BOXGOV"
+.LASF864:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1027:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF809:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF777:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1232:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF908:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF793:
+	.string	"__DECL_SIMD_atan "
+.LASF839:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1070:
+	.string	"__MATHDECL_ALIAS"
+.LASF1525:
+	.string	"telemetryConfig"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1291:
+	.string	"H_level"
+.LASF1480:
+	.string	"throttle_correction_angle"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF810:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1415:
+	.string	"gyro_align"
+.LASF913:
+	.string	"__DECL_SIMD_log1p "
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF1437:
+	.string	"baro_noise_lpf"
+.LASF985:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF794:
+	.string	"__DECL_SIMD_atanf "
+.LASF1071:
+	.string	"__MATHDECL"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1262:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1265:
+	.string	"signed char"
+.LASF1326:
+	.string	"failsafe_min_usec"
+.LASF758:
+	.string	"__DECL_SIMD_logf64 "
+.LASF741:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF857:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1374:
+	.string	"modeActivationCondition_t"
+.LASF696:
+	.string	"__size_t__ "
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1086:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1251:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1306:
+	.string	"mixerConfig_s"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1385:
+	.string	"msp_baudrate"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1384:
+	.string	"serial_port_scenario"
+.LASF1284:
+	.string	"SERIAL_INVERTED"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1151:
+	.string	"sq(x) ((x)*(x))"
+.LASF737:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF909:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF1015:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1399:
+	.string	"boardAlignment_s"
+.LASF1403:
+	.string	"boardAlignment_t"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1117:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1352:
+	.string	"BOXCAMSTAB"
+.LASF1386:
+	.string	"cli_baudrate"
+.LASF905:
+	.string	"__DECL_SIMD_log2l "
+.LASF750:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1202:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1327:
+	.string	"failsafe_max_usec"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1004:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1541:
+	.string	"configValue_t"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1535:
+	.string	"MASTER_VALUE"
+.LASF1445:
+	.string	"telemetryProvider_e"
+.LASF1056:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1142:
+	.string	"USE_USART1 "
+.LASF1039:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1147:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1101:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1340:
+	.string	"mincommand"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1419:
+	.string	"knownSensors_s"
+.LASF1426:
+	.string	"knownSensors_t"
+.LASF1120:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1108:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1252:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1034:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1143:
+	.string	"USE_USART2 "
+.LASF939:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1392:
+	.string	"vbatscale"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1090:
+	.string	"FP_ZERO 2"
+.LASF1436:
+	.string	"baro_sample_count"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1220:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF766:
+	.string	"__DECL_SIMD_expf16 "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1257:
+	.string	"SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)"
+.LASF1199:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1168:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1242:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF1567:
+	.string	"bits"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1438:
+	.string	"baro_cf_vel"
+.LASF1566:
+	.string	"length"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1273:
+	.string	"long int"
+.LASF1207:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1241:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF1260:
+	.string	"CONFIG_DUMP_RECORD_MAX_SIZE (CONFIG_DUMP_RECORD_HEADER_SIZE + 4)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1542:
+	.string	"int_value"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF869:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1489:
+	.string	"enabledFeatures"
+.LASF1515:
+	.string	"knownSensors"
+.LASF1363:
+	.string	"BOXOSD"
+.LASF1441:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1458:
+	.string	"frsky_coordinate_format"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1416:
+	.string	"acc_align"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1556:
+	.string	"lrintf"
+.LASF1228:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1038:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1486:
+	.string	"profile_t"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1391:
+	.string	"batteryConfig_s"
+.LASF1398:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF873:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1504:
+	.string	"acc_hardware"
+.LASF1139:
+	.string	"USE_ACC_SITL "
+.LASF1044:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1280:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF805:
+	.string	"__DECL_SIMD_asinl "
+.LASF1171:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1018:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1111:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF903:
+	.string	"__DECL_SIMD_log2 "
+.LASF910:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF922:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1355:
+	.string	"BOXGPSHOLD"
+.LASF1121:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF1019:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1502:
+	.string	"boardAlignment"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1460:
+	.string	"batterySize"
+.LASF1289:
+	.string	"inputFilteringMode_e"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF485:
+	.string	"__flexarr []"
+.LASF1021:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF773:
+	.string	"__DECL_SIMD_pow "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1472:
+	.string	"accDeadband"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1107:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1351:
+	.string	"BOXHEADADJ"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1506:
+	.string	"gyro_cmpf_factor"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF742:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1434:
+	.string	"gyroConfig_t"
+.LASF1354:
+	.string	"BOXGPSHOME"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF1119:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1127:
+	.string	"__enable_irq() "
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1188:
+	.string	"LAT 0"
+.LASF1500:
+	.string	"servo_pwm_rate"
+.LASF1274:
+	.string	"char"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF899:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1377:
+	.string	"rcExpo8"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF959:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1243:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF729:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF896:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF813:
+	.string	"__DECL_SIMD_hypot "
+.LASF1195:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1246:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1358:
+	.string	"BOXLEDMAX"
+.LASF1342:
+	.string	"gimbalConfig_s"
+.LASF1431:
+	.string	"soft_gyro_lpf_hz"
+.LASF769:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1439:
+	.string	"baro_cf_alt"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF728:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF900:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF792:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1561:
+	.string	"newValue"
+.LASF391:
+	.string	"true 1"
+.LASF730:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1214:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF784:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1457:
+	.string	"gpsNoFixLongitude"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF770:
+	.string	"__DECL_SIMD_expf32x "
+.LASF967:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1109:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1177:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1002:
+	.string	"__HAVE_FLOAT32 1"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF713:
+	.string	"__size_t "
+.LASF695:
+	.string	"__need_NULL "
+.LASF872:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1164:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1317:
+	.string	"flaps_speed"
+.LASF1033:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF808:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1411:
+	.string	"CW180_DEG_FLIP"
+.LASF1240:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF1484:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF964:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1523:
+	.string	"fixedwing_althold_dir"
+.LASF1570:
+	.string	"buffer"
+.LASF1061:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1453:
+	.string	"telemetry_provider"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1552:
+	.string	"CONFIG_DUMP_UNKNOWN_VALUE"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1250:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF834:
+	.string	"__DECL_SIMD_exp10f "
+.LASF767:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1346:
+	.string	"BOXANGLE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1173:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1249:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1023:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF798:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF990:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF933:
+	.string	"__DECL_SIMD_acosh "
+.LASF1237:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF989:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1428:
+	.string	"accDeadband_t"
+.LASF1397:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF1204:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1435:
+	.string	"barometerConfig_s"
+.LASF1440:
+	.string	"barometerConfig_t"
+.LASF371:
+	.string	"__linux 1"
+.LASF1085:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1370:
+	.string	"modeId"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1118:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1088:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1516:
+	.string	"batteryConfig"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1518:
+	.string	"inputFilteringMode"
+.LASF1334:
+	.string	"maxcheck"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF846:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF943:
+	.string	"__DECL_SIMD_erf "
+.LASF1104:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1344:
+	.string	"gimbalConfig_t"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1406:
+	.string	"CW90_DEG"
+.LASF1559:
+	.string	"config"
+.LASF1537:
+	.string	"configValue_s"
+.LASF1413:
+	.string	"sensor_align_e"
+.LASF759:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1302:
+	.string	"rollAndPitchTrims_t_def"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1507:
+	.string	"gyro_cmpfm_factor"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1462:
+	.string	"profile_s"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF854:
+	.string	"__DECL_SIMD_expm1f "
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF760:
+	.string	"__DECL_SIMD_logf32x "
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1401:
+	.string	"pitchDegrees"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF948:
+	.string	"__DECL_SIMD_erff64 "
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1115:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1282:
+	.string	"double"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF786:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1446:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1022:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1379:
+	.string	"thrExpo8"
+.LASF1042:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF956:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1248:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1259:
+	.string	"CONFIG_DUMP_RECORD_HEADER_SIZE 4"
+.LASF1103:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1444:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1367:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1271:
+	.string	"__int32_t"
+.LASF1517:
+	.string	"rxConfig"
+.LASF1097:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1553:
+	.string	"CONFIG_DUMP_OUT_OF_RANGE"
+.LASF1478:
+	.string	"alt_hold_deadband"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF971:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1253:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1153:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1466:
+	.string	"dynThrPID"
+.LASF785:
+	.string	"__DECL_SIMD_acosl "
+.LASF1206:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1387:
+	.string	"gps_baudrate"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF774:
+	.string	"__DECL_SIMD_powf "
+.LASF1041:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1197:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF780:
+	.string	"__DECL_SIMD_powf32x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1432:
+	.string	"soft_gyro_notch_hz"
+.LASF1380:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1236:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_asin "
+.LASF1217:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1451:
+	.string	"frskyUnit_e"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1072:
+	.string	"__MATHCALL"
+.LASF897:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF965:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1156:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1365:
+	.string	"BOXAUTOTUNE"
+.LASF1482:
+	.string	"servoConf"
+.LASF1390:
+	.string	"serialConfig_t"
+.LASF950:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF923:
+	.string	"__DECL_SIMD_atanh "
+.LASF1192:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1481:
+	.string	"throttle_correction_value"
+.LASF1543:
+	.string	"float_value"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF835:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1014:
+	.string	"__f32(x) x ##f32"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF852:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF814:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1196:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF799:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1091:
+	.string	"FP_SUBNORMAL 3"
+.LASF1312:
+	.string	"deadband3d_high"
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1066:
+	.string	"_Mdouble_ _Float64x"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF951:
+	.string	"__DECL_SIMD_erff64x "
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1430:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF1512:
+	.string	"max_angle_inclination"
+.LASF1331:
+	.string	"serialrx_provider"
+.LASF778:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF744:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1551:
+	.string	"CONFIG_DUMP_APPLIED"
+.LASF994:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1510:
+	.string	"dcm_ki"
+.LASF1163:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF800:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1509:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1189:
+	.string	"LON 1"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1276:
+	.string	"int16_t"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF824:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF740:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1301:
+	.string	"rollAndPitchTrims_s"
+.LASF1303:
+	.string	"rollAndPitchTrims_t"
+.LASF1309:
+	.string	"mixerConfig_t"
+.LASF993:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1323:
+	.string	"failsafe_delay"
+.LASF1125:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1179:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1395:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1285:
+	.string	"serialInversion_e"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1057:
+	.string	"_Mdouble_ _Float32"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1492:
+	.string	"gyro_sync_denom"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF914:
+	.string	"__DECL_SIMD_log1pf "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1371:
+	.string	"auxChannelIndex"
+.LASF851:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF858:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF833:
+	.string	"__DECL_SIMD_exp10 "
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF847:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF821:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1170:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1375:
+	.string	"controlRateConfig_s"
+.LASF738:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF954:
+	.string	"__DECL_SIMD_tanhf "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF986:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1310:
+	.string	"flight3DConfig_s"
+.LASF1315:
+	.string	"flight3DConfig_t"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF1557:
+	.string	"findConfigValueById"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1376:
+	.string	"rcRate8"
+.LASF781:
+	.string	"__DECL_SIMD_powf64x "
+.LASF731:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF795:
+	.string	"__DECL_SIMD_atanl "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF974:
+	.string	"__DECL_SIMD_erfcf "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1562:
+	.string	"configDumpApplyRecord"
+.LASF926:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF906:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF949:
+	.string	"__DECL_SIMD_erff128 "
+.LASF832:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF734:
+	.string	"__DECL_SIMD_sinf "
+.LASF866:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF723:
+	.string	"__DECL_SIMD_cos "
+.LASF787:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1235:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF874:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF775:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF957:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1490:
+	.string	"looptime"
+.LASF1060:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1157:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1475:
+	.string	"modeActivationConditions"
+.LASF1330:
+	.string	"rcmap"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1420:
+	.string	"gyroHardware"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1193:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1464:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1479:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1114:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1144:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF815:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF726:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1422:
+	.string	"baroHardware"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1129:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1190:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1180:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1126:
+	.string	"__disable_irq() "
+.LASF883:
+	.string	"__DECL_SIMD_atan2 "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF745:
+	.string	"__DECL_SIMD_sincosl "
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF952:
+	.string	"__DECL_SIMD_erff128x "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1028:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1025:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1471:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1508:
+	.string	"attitude_estimator"
+.LASF1269:
+	.string	"short int"
+.LASF1421:
+	.string	"accHardware"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF825:
+	.string	"__DECL_SIMD_exp2l "
+.LASF762:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1554:
+	.string	"configDumpResult_e"
+.LASF1040:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1503:
+	.string	"yaw_control_direction"
+.LASF1266:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1175:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF1569:
+	.string	"configDumpEncodeRecord"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1162:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1311:
+	.string	"deadband3d_low"
+.LASF1160:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1495:
+	.string	"customMixer"
+.LASF1263:
+	.string	"unsigned int"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF982:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1087:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1244:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1221:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF884:
+	.string	"__DECL_SIMD_atan2f "
+.LASF743:
+	.string	"__DECL_SIMD_sincos "
+.LASF1338:
+	.string	"minthrottle"
+.LASF955:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1356:
+	.string	"BOXPASSTHRU"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1459:
+	.string	"frsky_unit"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1476:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF886:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1320:
+	.string	"rate"
+.LASF1548:
+	.string	"profileIndex"
+.LASF1353:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1527:
+	.string	"profile"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1068:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1182:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1031:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF975:
+	.string	"__DECL_SIMD_erfcl "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1407:
+	.string	"CW180_DEG"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1487:
+	.string	"master_t"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1102:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF969:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1394:
+	.string	"vbatmincellvoltage"
+.LASF1128:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/config/config_dump.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
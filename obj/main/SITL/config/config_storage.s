@@ -0,0 +1,15418 @@
+	.file	"config_storage.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/config/config_storage.c"
+	.section	.text.isSectionChanged,"ax",@progbits
+	.p2align 4
+	.type	isSectionChanged, @function
+isSectionChanged:
+.LVL0:
+.LFB15:
+	.file 1 ".//src/main/config/config_storage.c"
+	.loc 1 263 1 view -0
+	.cfi_startproc
+	.loc 1 264 5 view .LVU1
+	.loc 1 264 28 is_stmt 0 view .LVU2
+	movzbl	%sil, %edx
+	.loc 1 263 1 view .LVU3
+	movq	%rdi, %rax
+	.loc 1 264 28 view .LVU4
+	movq	48(%rdi,%rdx,8), %rdi
+.LVL1:
+	.loc 1 265 9 view .LVU5
+	testq	%rdi, %rdi
+	je	.L7
+.LVL2:
+.LBB67:
+.LBI67:
+	.loc 1 59 17 is_stmt 1 discriminator 2 view .LVU6
+.LBB68:
+	.loc 1 61 5 discriminator 2 view .LVU7
+.LBE68:
+.LBE67:
+	.loc 1 263 1 is_stmt 0 discriminator 2 view .LVU8
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	leal	1(%rsi), %edx
+.LBB71:
+.LBB69:
+	.loc 1 61 63 discriminator 2 view .LVU9
+	movq	24(%rax), %rcx
+	.loc 1 61 14 discriminator 2 view .LVU10
+	cmpb	32(%rax), %dl
+	jb	.L13
+	.loc 1 61 14 view .LVU11
+	movzwl	34(%rax), %edx
+.L4:
+.LVL3:
+	.loc 1 63 5 is_stmt 1 view .LVU12
+	.loc 1 63 35 is_stmt 0 view .LVU13
+	movzbl	%sil, %esi
+	.loc 1 63 42 view .LVU14
+	movzwl	2(%rcx,%rsi,4), %esi
+.LVL4:
+	.loc 1 63 16 view .LVU15
+	subl	%esi, %edx
+.LVL5:
+	.loc 1 63 16 view .LVU16
+.LBE69:
+.LBE71:
+	.loc 1 265 12 view .LVU17
+	addq	192(%rax), %rsi
+	movzwl	%dx, %edx
+	call	memcmp@PLT
+.LVL6:
+	.loc 1 265 9 view .LVU18
+	testl	%eax, %eax
+	setne	%dl
+	.loc 1 266 1 view .LVU19
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	movl	%edx, %eax
+	ret
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+.LBB72:
+.LBB70:
+	.loc 1 61 73 view .LVU20
+	movzbl	%dl, %edx
+	.loc 1 61 14 view .LVU21
+	movzwl	2(%rcx,%rdx,4), %edx
+	jmp	.L4
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_def_cfa_offset 8
+	.loc 1 61 14 view .LVU22
+.LBE70:
+.LBE72:
+	.loc 1 266 1 view .LVU23
+	movl	$1, %eax
+.LVL9:
+	.loc 1 266 1 view .LVU24
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	isSectionChanged, .-isSectionChanged
+	.section	.text.beginSave,"ax",@progbits
+	.p2align 4
+	.type	beginSave, @function
+beginSave:
+.LVL10:
+.LFB18:
+	.loc 1 293 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 294 5 view .LVU26
+	.loc 1 295 5 view .LVU27
+	.loc 1 297 5 view .LVU28
+	.loc 1 293 1 is_stmt 0 view .LVU29
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	.loc 1 297 5 view .LVU30
+	addq	$224, %rdi
+.LVL11:
+	.loc 1 297 5 view .LVU31
+	movl	%ebx, %eax
+	.loc 1 293 1 view .LVU32
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 297 5 view .LVU33
+	movq	$0, -8(%rdi)
+	movq	$0, 112(%rdi)
+	andq	$-8, %rdi
+	subl	%edi, %eax
+	leal	344(%rax), %ecx
+	xorl	%eax, %eax
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 298 5 is_stmt 1 view .LVU34
+	.loc 1 300 25 is_stmt 0 view .LVU35
+	movb	$0, 200(%rbx)
+	.loc 1 298 25 view .LVU36
+	movl	$0, 208(%rbx)
+	.loc 1 300 5 is_stmt 1 view .LVU37
+	.loc 1 301 5 view .LVU38
+	.loc 1 301 8 is_stmt 0 view .LVU39
+	cmpb	$0, 44(%rbx)
+	je	.L15
+.LVL12:
+	.loc 1 302 31 is_stmt 1 view .LVU40
+	.loc 1 302 40 is_stmt 0 view .LVU41
+	movzbl	32(%rbx), %r15d
+	.loc 1 302 31 view .LVU42
+	testb	%r15b, %r15b
+	je	.L16
+	movzbl	%r15b, %r13d
+	xorl	%ebp, %ebp
+	.loc 1 294 14 view .LVU43
+	xorl	%r12d, %r12d
+.LBB81:
+.LBB82:
+	.loc 1 61 39 view .LVU44
+	movzbl	%r15b, %r14d
+	jmp	.L20
+.LVL13:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 61 14 view .LVU45
+	movzwl	2(%rcx,%rdx,4), %eax
+.L19:
+.LVL14:
+	.loc 1 63 5 is_stmt 1 view .LVU46
+	.loc 1 63 5 is_stmt 0 view .LVU47
+.LBE82:
+.LBE81:
+.LBB85:
+.LBI85:
+	.loc 1 66 17 is_stmt 1 view .LVU48
+.LBB86:
+	.loc 1 68 5 view .LVU49
+	.loc 1 68 5 is_stmt 0 view .LVU50
+.LBE86:
+.LBE85:
+.LBB88:
+.LBB83:
+	.loc 1 63 16 view .LVU51
+	subw	2(%rcx,%rbp,4), %ax
+.LVL15:
+	.loc 1 63 16 view .LVU52
+.LBE83:
+.LBE88:
+	.loc 1 304 31 view .LVU53
+	movzwl	%ax, %eax
+.LBB89:
+.LBB87:
+	.loc 1 68 23 view .LVU54
+	addl	$3, %eax
+	.loc 1 68 28 view .LVU55
+	andl	$-4, %eax
+.LBE87:
+.LBE89:
+	.loc 1 304 28 view .LVU56
+	leal	8(%r12,%rax), %r12d
+.LVL16:
+.L17:
+	.loc 1 302 61 is_stmt 1 discriminator 2 view .LVU57
+	.loc 1 302 31 discriminator 2 view .LVU58
+	.loc 1 302 31 is_stmt 0 discriminator 2 view .LVU59
+	movq	%rdx, %rbp
+	cmpq	%rdx, %r13
+	je	.L48
+.LVL17:
+.L20:
+	.loc 1 303 13 is_stmt 1 view .LVU60
+	.loc 1 303 17 is_stmt 0 view .LVU61
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	call	isSectionChanged
+.LVL18:
+	leaq	1(%rbp), %rdx
+	.loc 1 303 16 view .LVU62
+	testb	%al, %al
+	je	.L17
+	.loc 1 304 17 is_stmt 1 view .LVU63
+.LVL19:
+.LBB90:
+.LBI81:
+	.loc 1 59 17 view .LVU64
+.LBB84:
+	.loc 1 61 5 view .LVU65
+	.loc 1 61 14 is_stmt 0 view .LVU66
+	leal	1(%rbp), %eax
+	.loc 1 61 63 view .LVU67
+	movq	24(%rbx), %rcx
+	.loc 1 61 14 view .LVU68
+	cmpl	%r14d, %eax
+	jl	.L49
+	movzwl	34(%rbx), %eax
+	jmp	.L19
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.loc 1 61 14 view .LVU69
+.LBE84:
+.LBE90:
+	.loc 1 309 9 is_stmt 1 view .LVU70
+	.loc 1 309 29 is_stmt 0 view .LVU71
+	movb	$1, 200(%rbx)
+	.loc 1 312 5 is_stmt 1 view .LVU72
+.LVL21:
+.L22:
+	.loc 1 323 5 view .LVU73
+	.loc 1 325 8 is_stmt 0 view .LVU74
+	cmpb	$0, 180(%rbx)
+	.loc 1 324 27 view .LVU75
+	movb	$0, 201(%rbx)
+	.loc 1 323 27 view .LVU76
+	movl	$8, 204(%rbx)
+	.loc 1 324 5 is_stmt 1 view .LVU77
+	.loc 1 325 5 view .LVU78
+	.loc 1 325 8 is_stmt 0 view .LVU79
+	jne	.L26
+	.loc 1 328 9 is_stmt 1 view .LVU80
+	.loc 1 328 12 is_stmt 0 view .LVU81
+	cmpl	$1, 176(%rbx)
+	je	.L30
+	.loc 1 329 13 is_stmt 1 view .LVU82
+	.loc 1 329 34 is_stmt 0 view .LVU83
+	movl	$0, 184(%rbx)
+.L30:
+	.loc 1 331 9 is_stmt 1 view .LVU84
+.LBB91:
+.LBB92:
+	.loc 1 290 1 is_stmt 0 view .LVU85
+	movl	$1, %eax
+	jmp	.L29
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 290 1 view .LVU86
+.LBE92:
+.LBE91:
+	.loc 1 307 9 is_stmt 1 view .LVU87
+	.loc 1 307 38 is_stmt 0 view .LVU88
+	movl	40(%rbx), %eax
+	.loc 1 307 50 view .LVU89
+	addl	%eax, %r12d
+.LVL23:
+	.loc 1 307 63 view .LVU90
+	cmpl	%r12d, 8(%rbx)
+	.loc 1 307 29 view .LVU91
+	setb	200(%rbx)
+	.loc 1 312 5 is_stmt 1 view .LVU92
+	.loc 1 312 8 is_stmt 0 view .LVU93
+	jb	.L22
+	.loc 1 313 9 is_stmt 1 view .LVU94
+	.loc 1 313 31 is_stmt 0 view .LVU95
+	movl	%eax, 204(%rbx)
+	.loc 1 314 9 is_stmt 1 view .LVU96
+.LVL24:
+.LBB95:
+.LBI95:
+	.loc 1 269 16 view .LVU97
+.LBB96:
+	.loc 1 271 5 view .LVU98
+	.loc 1 271 66 view .LVU99
+	.loc 1 271 66 is_stmt 0 view .LVU100
+	movzbl	%r15b, %r14d
+.LBE96:
+.LBE95:
+	.loc 1 313 31 view .LVU101
+	xorl	%ebp, %ebp
+	jmp	.L23
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+.LBB100:
+.LBB97:
+	.loc 1 272 9 is_stmt 1 view .LVU102
+	.loc 1 271 66 view .LVU103
+	addl	$1, %ebp
+.LVL26:
+	.loc 1 271 66 is_stmt 0 view .LVU104
+	cmpl	%ebp, %r14d
+	je	.L50
+.LVL27:
+.L23:
+	.loc 1 271 70 view .LVU105
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	movl	%ebp, %r12d
+.LVL28:
+	.loc 1 271 70 view .LVU106
+	call	isSectionChanged
+.LVL29:
+	.loc 1 271 66 view .LVU107
+	testb	%al, %al
+	je	.L25
+.LVL30:
+.L24:
+	.loc 1 274 5 is_stmt 1 view .LVU108
+	.loc 1 274 5 is_stmt 0 view .LVU109
+.LBE97:
+.LBE100:
+	.loc 1 314 31 view .LVU110
+	movb	%r12b, 201(%rbx)
+	.loc 1 315 9 is_stmt 1 view .LVU111
+	.loc 1 315 12 is_stmt 0 view .LVU112
+	cmpb	%r12b, %r15b
+	je	.L51
+.LVL31:
+.L26:
+	.loc 1 318 13 is_stmt 1 view .LVU113
+	.loc 1 313 31 is_stmt 0 view .LVU114
+	movl	$2, %eax
+.L29:
+	.loc 1 318 28 view .LVU115
+	movl	%eax, 176(%rbx)
+	.loc 1 333 1 view .LVU116
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL32:
+	.loc 1 333 1 view .LVU117
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL33:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	.loc 1 307 9 is_stmt 1 view .LVU118
+	.loc 1 307 38 is_stmt 0 view .LVU119
+	movl	40(%rbx), %eax
+	.loc 1 307 63 view .LVU120
+	cmpl	%eax, 8(%rbx)
+	.loc 1 307 29 view .LVU121
+	setb	200(%rbx)
+	.loc 1 312 5 is_stmt 1 view .LVU122
+	.loc 1 312 8 is_stmt 0 view .LVU123
+	jb	.L22
+	.loc 1 313 9 is_stmt 1 view .LVU124
+	.loc 1 313 31 is_stmt 0 view .LVU125
+	movl	%eax, 204(%rbx)
+	.loc 1 314 9 is_stmt 1 view .LVU126
+.LVL34:
+.LBB101:
+	.loc 1 269 16 view .LVU127
+.LBB98:
+	.loc 1 271 5 view .LVU128
+	.loc 1 271 66 view .LVU129
+	.loc 1 274 5 view .LVU130
+	.loc 1 274 5 is_stmt 0 view .LVU131
+.LBE98:
+.LBE101:
+	.loc 1 314 31 view .LVU132
+	movb	$0, 201(%rbx)
+	.loc 1 315 9 is_stmt 1 view .LVU133
+.LVL35:
+.LBB102:
+.LBB93:
+	.loc 1 281 27 view .LVU134
+.L32:
+	.loc 1 287 5 view .LVU135
+	.loc 1 288 5 view .LVU136
+	.loc 1 288 19 is_stmt 0 view .LVU137
+	movq	$0, 192(%rbx)
+	.loc 1 289 5 is_stmt 1 view .LVU138
+	.loc 1 290 1 is_stmt 0 view .LVU139
+	xorl	%eax, %eax
+	jmp	.L29
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.loc 1 290 1 view .LVU140
+.LBE93:
+.LBE102:
+.LBB103:
+.LBB99:
+	.loc 1 272 14 view .LVU141
+	addl	$1, %r12d
+.LVL37:
+	.loc 1 272 14 view .LVU142
+	jmp	.L24
+.LVL38:
+.L51:
+	.loc 1 272 14 view .LVU143
+	movq	%rbx, %rax
+	leaq	(%rbx,%r13,8), %rcx
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LVL39:
+	.loc 1 272 14 view .LVU144
+.LBE99:
+.LBE103:
+.LBB104:
+.LBB94:
+	.loc 1 282 9 is_stmt 1 view .LVU145
+	.loc 1 282 29 is_stmt 0 view .LVU146
+	movq	216(%rax), %rdx
+	.loc 1 282 12 view .LVU147
+	testq	%rdx, %rdx
+	je	.L27
+	.loc 1 283 13 is_stmt 1 view .LVU148
+	.loc 1 283 36 is_stmt 0 view .LVU149
+	movq	%rdx, 48(%rax)
+.L27:
+	.loc 1 281 57 is_stmt 1 view .LVU150
+.LVL40:
+	.loc 1 281 27 view .LVU151
+	addq	$8, %rax
+.LVL41:
+	.loc 1 281 27 is_stmt 0 view .LVU152
+	cmpq	%rcx, %rax
+	jne	.L28
+	jmp	.L32
+.LBE94:
+.LBE104:
+	.cfi_endproc
+.LFE18:
+	.size	beginSave, .-beginSave
+	.section	.text.eraseStep,"ax",@progbits
+	.p2align 4
+	.type	eraseStep, @function
+eraseStep:
+.LVL42:
+.LFB23:
+	.loc 1 389 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 390 5 view .LVU154
+	.loc 1 392 5 view .LVU155
+.LBB121:
+.LBI121:
+	.loc 1 366 13 view .LVU156
+.LBB122:
+	.loc 1 368 5 view .LVU157
+.LBE122:
+.LBE121:
+	.loc 1 389 1 is_stmt 0 view .LVU158
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB124:
+.LBB123:
+	.loc 1 368 5 view .LVU159
+	call	FLASH_Unlock@PLT
+.LVL43:
+	.loc 1 368 5 view .LVU160
+.LBE123:
+.LBE124:
+	.loc 1 393 5 is_stmt 1 view .LVU161
+.LBB125:
+.LBI125:
+	.loc 1 49 16 view .LVU162
+.LBB126:
+	.loc 1 51 5 view .LVU163
+	.loc 1 51 5 is_stmt 0 view .LVU164
+.LBE126:
+.LBE125:
+.LBB129:
+.LBI129:
+	.loc 1 44 18 is_stmt 1 view .LVU165
+.LBB130:
+	.loc 1 46 5 view .LVU166
+	.loc 1 46 5 is_stmt 0 view .LVU167
+.LBE130:
+.LBE129:
+.LBB132:
+.LBB127:
+	.loc 1 51 41 view .LVU168
+	xorl	%edi, %edi
+	cmpb	$1, 36(%rbx)
+.LBE127:
+.LBE132:
+	.loc 1 393 80 view .LVU169
+	movl	184(%rbx), %eax
+.LBB133:
+.LBB128:
+	.loc 1 51 41 view .LVU170
+	setne	%dil
+.LBE128:
+.LBE133:
+.LBB134:
+.LBB131:
+	.loc 1 46 36 view .LVU171
+	imull	8(%rbx), %edi
+.LBE131:
+.LBE134:
+	.loc 1 393 14 view .LVU172
+	addq	(%rbx), %rax
+	addq	%rax, %rdi
+	call	FLASH_ErasePage@PLT
+.LVL44:
+	movl	%eax, %ebp
+.LVL45:
+	.loc 1 394 5 is_stmt 1 view .LVU173
+	call	FLASH_Lock@PLT
+.LVL46:
+	.loc 1 396 5 view .LVU174
+	.loc 1 396 8 is_stmt 0 view .LVU175
+	cmpl	$4, %ebp
+	je	.L53
+	.loc 1 397 9 is_stmt 1 view .LVU176
+	.loc 1 397 12 is_stmt 0 view .LVU177
+	cmpq	$0, 192(%rbx)
+	je	.L54
+	.loc 1 398 13 is_stmt 1 view .LVU178
+.LVL47:
+.LBB135:
+.LBI135:
+	.loc 1 336 13 view .LVU179
+.LBB136:
+	.loc 1 338 5 view .LVU180
+	.loc 1 338 8 is_stmt 0 view .LVU181
+	cmpb	$0, 200(%rbx)
+	jne	.L60
+	.loc 1 342 9 is_stmt 1 view .LVU182
+	.loc 1 342 29 is_stmt 0 view .LVU183
+	movb	$0, 44(%rbx)
+.L56:
+	.loc 1 345 5 is_stmt 1 view .LVU184
+	.loc 1 345 16 is_stmt 0 view .LVU185
+	movzbl	188(%rbx), %eax
+	.loc 1 345 8 view .LVU186
+	testb	%al, %al
+	je	.L54
+	.loc 1 350 5 is_stmt 1 view .LVU187
+	.loc 1 350 31 is_stmt 0 view .LVU188
+	subl	$1, %eax
+	.loc 1 351 5 view .LVU189
+	movq	%rbx, %rdi
+	.loc 1 350 31 view .LVU190
+	movb	%al, 188(%rbx)
+	.loc 1 351 5 is_stmt 1 view .LVU191
+.LBE136:
+.LBE135:
+	.loc 1 412 1 is_stmt 0 view .LVU192
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL48:
+	.loc 1 412 1 view .LVU193
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL49:
+.LBB140:
+.LBB137:
+	.loc 1 351 5 view .LVU194
+	jmp	beginSave
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.cfi_restore_state
+	.loc 1 351 5 view .LVU195
+.LBE137:
+.LBE140:
+.LBB141:
+.LBI141:
+	.loc 1 388 13 is_stmt 1 view .LVU196
+.LBB142:
+	.loc 1 405 5 view .LVU197
+	.loc 1 405 36 is_stmt 0 view .LVU198
+	movzwl	12(%rbx), %eax
+	.loc 1 405 26 view .LVU199
+	addl	184(%rbx), %eax
+	movl	%eax, 184(%rbx)
+	.loc 1 406 5 is_stmt 1 view .LVU200
+	.loc 1 406 8 is_stmt 0 view .LVU201
+	cmpl	8(%rbx), %eax
+	jb	.L52
+	.loc 1 410 5 is_stmt 1 view .LVU202
+	.loc 1 411 61 is_stmt 0 view .LVU203
+	xorl	%eax, %eax
+	cmpq	$0, 192(%rbx)
+	.loc 1 410 26 view .LVU204
+	movb	$1, 180(%rbx)
+	.loc 1 411 5 is_stmt 1 view .LVU205
+	.loc 1 411 61 is_stmt 0 view .LVU206
+	setne	%al
+	addl	%eax, %eax
+	movl	%eax, 176(%rbx)
+.LVL51:
+.L52:
+	.loc 1 411 61 view .LVU207
+.LBE142:
+.LBE141:
+	.loc 1 412 1 view .LVU208
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL52:
+	.loc 1 412 1 view .LVU209
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL53:
+	.loc 1 412 1 view .LVU210
+	ret
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore_state
+.LBB143:
+.LBB138:
+	.loc 1 346 9 is_stmt 1 view .LVU211
+	.loc 1 346 24 is_stmt 0 view .LVU212
+	movl	$3, 176(%rbx)
+	.loc 1 347 9 is_stmt 1 view .LVU213
+.LBE138:
+.LBE143:
+	.loc 1 412 1 is_stmt 0 view .LVU214
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL55:
+	.loc 1 412 1 view .LVU215
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL56:
+	.loc 1 412 1 view .LVU216
+	ret
+.LVL57:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.cfi_restore_state
+.LBB144:
+.LBB139:
+	.loc 1 339 9 is_stmt 1 view .LVU217
+	.loc 1 339 30 is_stmt 0 view .LVU218
+	movb	$0, 180(%rbx)
+	.loc 1 340 9 is_stmt 1 view .LVU219
+	.loc 1 340 30 is_stmt 0 view .LVU220
+	movl	$0, 184(%rbx)
+	jmp	.L56
+.LBE139:
+.LBE144:
+	.cfi_endproc
+.LFE23:
+	.size	eraseStep, .-eraseStep
+	.section	.text.configStorageInit,"ax",@progbits
+	.p2align 4
+	.globl	configStorageInit
+	.type	configStorageInit, @function
+configStorageInit:
+.LVL58:
+.LFB12:
+	.loc 1 199 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 200 5 view .LVU222
+	.loc 1 201 5 view .LVU223
+	.loc 1 203 5 view .LVU224
+	.loc 1 199 1 is_stmt 0 view .LVU225
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 203 5 view .LVU226
+	xorl	%eax, %eax
+	.loc 1 199 1 view .LVU227
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	%edx, %r14d
+	movl	%ecx, %edx
+.LVL59:
+	.loc 1 199 1 view .LVU228
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	.loc 1 203 5 view .LVU229
+	addq	$8, %rdi
+.LVL60:
+	.loc 1 203 5 view .LVU230
+	movq	%rbx, %rcx
+.LVL61:
+	.loc 1 199 1 view .LVU231
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	.loc 1 199 1 view .LVU232
+	movl	256(%rsp), %r10d
+	.loc 1 203 5 view .LVU233
+	movq	$0, 328(%rdi)
+.LVL62:
+	.loc 1 203 5 view .LVU234
+	andq	$-8, %rdi
+	subq	%rdi, %rcx
+	addl	$344, %ecx
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 204 5 is_stmt 1 view .LVU235
+	.loc 1 209 69 is_stmt 0 view .LVU236
+	movl	$16, %eax
+	.loc 1 206 23 view .LVU237
+	movw	%dx, 12(%rbx)
+	.loc 1 209 69 view .LVU238
+	cmpb	%al, %r10b
+	.loc 1 204 22 view .LVU239
+	movq	%rsi, (%rbx)
+	.loc 1 205 5 is_stmt 1 view .LVU240
+	.loc 1 209 69 is_stmt 0 view .LVU241
+	cmova	%eax, %r10d
+	.loc 1 205 23 view .LVU242
+	movl	%r14d, 8(%rbx)
+	.loc 1 206 5 is_stmt 1 view .LVU243
+	.loc 1 207 5 view .LVU244
+	.loc 1 217 15 is_stmt 0 view .LVU245
+	xorl	%edi, %edi
+	.loc 1 207 21 view .LVU246
+	movl	%r8d, 16(%rbx)
+	.loc 1 208 5 is_stmt 1 view .LVU247
+	.loc 1 209 27 is_stmt 0 view .LVU248
+	movb	%r10b, 32(%rbx)
+	.loc 1 210 19 view .LVU249
+	movl	264(%rsp), %eax
+	.loc 1 211 25 view .LVU250
+	movl	$-1, %r10d
+	.loc 1 208 23 view .LVU251
+	movq	%r9, 24(%rbx)
+	.loc 1 209 5 is_stmt 1 view .LVU252
+	.loc 1 210 5 view .LVU253
+	.loc 1 210 19 is_stmt 0 view .LVU254
+	movw	%ax, 34(%rbx)
+	.loc 1 211 5 is_stmt 1 view .LVU255
+	.loc 1 211 25 is_stmt 0 view .LVU256
+	movb	$-1, 36(%rbx)
+	.loc 1 217 5 is_stmt 1 view .LVU257
+.LVL63:
+	.loc 1 217 25 view .LVU258
+.L64:
+	.loc 1 218 9 view .LVU259
+.LBB177:
+.LBI177:
+	.loc 1 103 12 view .LVU260
+.LBB178:
+	.loc 1 105 5 view .LVU261
+.LBB179:
+.LBI179:
+	.loc 1 44 18 view .LVU262
+.LBB180:
+	.loc 1 46 5 view .LVU263
+	.loc 1 46 36 is_stmt 0 view .LVU264
+	movl	%ecx, %eax
+.LBE180:
+.LBE179:
+	.loc 1 105 14 view .LVU265
+	movl	(%rax,%rsi), %edx
+.LVL64:
+	.loc 1 107 5 is_stmt 1 view .LVU266
+.LBB181:
+.LBB182:
+	.loc 1 96 34 is_stmt 0 view .LVU267
+	movl	%edx, %eax
+	movzwl	%dx, %r9d
+.LVL65:
+	.loc 1 96 34 view .LVU268
+.LBE182:
+.LBI181:
+	.loc 1 94 17 is_stmt 1 view .LVU269
+.LBB183:
+	.loc 1 96 5 view .LVU270
+	.loc 1 96 34 is_stmt 0 view .LVU271
+	notl	%eax
+	.loc 1 96 54 view .LVU272
+	sall	$16, %eax
+	.loc 1 96 21 view .LVU273
+	orl	%r9d, %eax
+.LBE183:
+.LBE181:
+	.loc 1 107 43 view .LVU274
+	cmpl	%edx, %eax
+	jne	.L62
+	testl	%r9d, %r9d
+	je	.L62
+	.loc 1 111 5 is_stmt 1 view .LVU275
+.LVL66:
+	.loc 1 112 5 view .LVU276
+	.loc 1 112 5 is_stmt 0 view .LVU277
+.LBE178:
+.LBE177:
+	.loc 1 222 9 is_stmt 1 view .LVU278
+	.loc 1 222 12 is_stmt 0 view .LVU279
+	testb	%r10b, %r10b
+	js	.L63
+	.loc 1 222 59 discriminator 1 view .LVU280
+	movl	%edx, %eax
+	subw	38(%rbx), %ax
+	.loc 1 222 37 discriminator 1 view .LVU281
+	testw	%ax, %ax
+	jle	.L62
+.L63:
+	.loc 1 223 13 is_stmt 1 view .LVU282
+	.loc 1 223 33 is_stmt 0 view .LVU283
+	movb	%dil, 36(%rbx)
+	.loc 1 224 13 is_stmt 1 view .LVU284
+	.loc 1 223 33 is_stmt 0 view .LVU285
+	movl	%edi, %r10d
+	.loc 1 224 31 view .LVU286
+	movw	%dx, 38(%rbx)
+.LVL67:
+.L62:
+	.loc 1 217 34 is_stmt 1 discriminator 2 view .LVU287
+	.loc 1 217 25 discriminator 2 view .LVU288
+	addl	%r14d, %ecx
+	testb	%dil, %dil
+	jne	.L121
+	.loc 1 217 34 is_stmt 0 view .LVU289
+	movl	$1, %edi
+.LVL68:
+	.loc 1 217 34 view .LVU290
+	jmp	.L64
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.loc 1 228 5 is_stmt 1 view .LVU291
+	.loc 1 228 8 is_stmt 0 view .LVU292
+	testb	%r10b, %r10b
+	jns	.L122
+.LVL70:
+.L65:
+	.loc 1 232 5 is_stmt 1 view .LVU293
+.LBB184:
+.LBI184:
+	.loc 1 49 16 view .LVU294
+.LBB185:
+	.loc 1 51 5 view .LVU295
+	.loc 1 51 5 is_stmt 0 view .LVU296
+.LBE185:
+.LBE184:
+.LBB192:
+.LBI192:
+	.loc 1 44 18 is_stmt 1 view .LVU297
+.LBB193:
+	.loc 1 46 5 view .LVU298
+.LBE193:
+.LBE192:
+.LBB199:
+.LBB186:
+	.loc 1 51 41 is_stmt 0 view .LVU299
+	xorl	%edx, %edx
+	cmpb	$1, %r10b
+	setne	%dl
+.LBE186:
+.LBE199:
+.LBB200:
+.LBB194:
+	.loc 1 46 36 view .LVU300
+	imull	%r14d, %edx
+	.loc 1 46 29 view .LVU301
+	addq	%rsi, %rdx
+.LVL71:
+	.loc 1 46 29 view .LVU302
+.LBE194:
+.LBE200:
+.LBB201:
+.LBI201:
+	.loc 1 115 12 is_stmt 1 view .LVU303
+.LBB202:
+	.loc 1 117 5 view .LVU304
+	.loc 1 119 35 is_stmt 0 view .LVU305
+	shrl	$2, %r14d
+.LVL72:
+	.loc 1 117 21 view .LVU306
+	movq	%rdx, %rax
+.LVL73:
+	.loc 1 119 5 is_stmt 1 view .LVU307
+	.loc 1 119 35 view .LVU308
+	je	.L88
+.LVL74:
+.L72:
+	.loc 1 119 35 is_stmt 0 view .LVU309
+	leal	0(,%r14,4), %ecx
+	addq	%rdx, %rcx
+	jmp	.L90
+.LVL75:
+	.p2align 4,,10
+	.p2align 3
+.L123:
+	.loc 1 119 49 is_stmt 1 view .LVU310
+	.loc 1 119 35 view .LVU311
+	cmpq	%rcx, %rax
+	je	.L88
+.L90:
+	.loc 1 120 9 view .LVU312
+	movq	%rax, %rdx
+	.loc 1 120 18 is_stmt 0 view .LVU313
+	addq	$4, %rax
+.LVL76:
+	.loc 1 120 12 view .LVU314
+	cmpl	$-1, (%rdx)
+	je	.L123
+	.loc 1 121 19 view .LVU315
+	xorl	%eax, %eax
+.LVL77:
+.L89:
+	.loc 1 121 19 view .LVU316
+.LBE202:
+.LBE201:
+	.loc 1 232 26 view .LVU317
+	movb	%al, 180(%rbx)
+	.loc 1 233 5 is_stmt 1 view .LVU318
+	.loc 1 233 20 is_stmt 0 view .LVU319
+	movl	$0, 176(%rbx)
+	.loc 1 234 1 view .LVU320
+	addq	$200, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL78:
+	.loc 1 234 1 view .LVU321
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L122:
+	.cfi_restore_state
+	.loc 1 229 9 is_stmt 1 view .LVU322
+.LBB206:
+.LBI206:
+	.loc 1 143 13 view .LVU323
+.LBB207:
+	.loc 1 145 5 view .LVU324
+.LBB208:
+.LBI208:
+	.loc 1 44 18 view .LVU325
+.LBB209:
+	.loc 1 46 5 view .LVU326
+	.loc 1 46 36 is_stmt 0 view .LVU327
+	movsbl	%r10b, %edx
+.LBE209:
+.LBE208:
+	.loc 1 151 5 view .LVU328
+	leaq	64(%rsp), %r13
+	movl	$16, %ecx
+	xorl	%eax, %eax
+.LBB212:
+.LBB210:
+	.loc 1 46 36 view .LVU329
+	imull	%r14d, %edx
+.LBE210:
+.LBE212:
+	.loc 1 151 5 view .LVU330
+	movq	%r13, %rdi
+.LVL80:
+	.loc 1 151 5 view .LVU331
+	rep stosq
+.LBB213:
+.LBB211:
+	.loc 1 46 29 view .LVU332
+	addq	%rsi, %rdx
+.LVL81:
+	.loc 1 46 29 view .LVU333
+.LBE211:
+.LBE213:
+	.loc 1 146 5 is_stmt 1 view .LVU334
+	.loc 1 147 4 view .LVU335
+	.loc 1 148 5 view .LVU336
+	.loc 1 149 5 view .LVU337
+	.loc 1 151 5 view .LVU338
+	.loc 1 153 5 view .LVU339
+	.loc 1 153 8 is_stmt 0 view .LVU340
+	cmpl	4(%rdx), %r8d
+	jne	.L65
+	.loc 1 157 23 is_stmt 1 view .LVU341
+	cmpl	$15, %r14d
+	jbe	.L65
+	.loc 1 147 9 is_stmt 0 view .LVU342
+	xorl	%r10d, %r10d
+.LBB214:
+.LBB215:
+.LBB216:
+	.loc 1 90 12 view .LVU343
+	leaq	60(%rsp), %rax
+	movl	%r14d, 44(%rsp)
+.LBE216:
+.LBE215:
+.LBE214:
+	.loc 1 157 33 view .LVU344
+	movl	%r14d, %esi
+.LVL82:
+	.loc 1 148 14 view .LVU345
+	movl	$8, %r15d
+.LBB243:
+.LBB220:
+.LBB217:
+	.loc 1 90 12 view .LVU346
+	movq	%rax, 32(%rsp)
+	movl	%r15d, %r14d
+.LVL83:
+	.loc 1 90 12 view .LVU347
+	movb	%r10b, 43(%rsp)
+	movq	%r13, %r15
+	movq	%rdx, 24(%rsp)
+	jmp	.L87
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.loc 1 90 12 view .LVU348
+.LBE217:
+.LBE220:
+.LBE243:
+	.loc 1 157 23 is_stmt 1 view .LVU349
+	.loc 1 157 33 is_stmt 0 view .LVU350
+	movl	8(%rbx), %esi
+	.loc 1 157 19 view .LVU351
+	leal	8(%r14), %eax
+	.loc 1 157 23 view .LVU352
+	cmpl	%eax, %esi
+	jb	.L124
+.LVL85:
+.L87:
+.LBB244:
+	.loc 1 158 9 is_stmt 1 view .LVU353
+	.loc 1 158 52 is_stmt 0 view .LVU354
+	movq	24(%rsp), %rdi
+	movl	%r14d, %eax
+	addq	%rdi, %rax
+	.loc 1 159 18 view .LVU355
+	movl	4(%rax), %edi
+	.loc 1 158 18 view .LVU356
+	movl	(%rax), %r13d
+.LVL86:
+	.loc 1 159 9 is_stmt 1 view .LVU357
+	.loc 1 159 18 is_stmt 0 view .LVU358
+	movl	%edi, 20(%rsp)
+.LVL87:
+	.loc 1 160 9 is_stmt 1 view .LVU359
+	.loc 1 161 32 is_stmt 0 view .LVU360
+	movl	%r13d, %r12d
+	.loc 1 160 63 view .LVU361
+	leaq	8(%rax), %rdi
+.LVL88:
+	.loc 1 160 63 view .LVU362
+	movq	%rdi, 8(%rsp)
+.LVL89:
+	.loc 1 161 9 is_stmt 1 view .LVU363
+	.loc 1 161 32 is_stmt 0 view .LVU364
+	shrl	$16, %r12d
+.LVL90:
+	.loc 1 163 9 is_stmt 1 view .LVU365
+	.loc 1 163 12 is_stmt 0 view .LVU366
+	cmpl	$-1, %r13d
+	je	.L125
+	.loc 1 170 9 is_stmt 1 view .LVU367
+	.loc 1 170 12 is_stmt 0 view .LVU368
+	testl	%r12d, %r12d
+	je	.L74
+.LVL91:
+.LBB221:
+.LBI221:
+	.loc 1 66 17 is_stmt 1 view .LVU369
+.LBB222:
+	.loc 1 68 5 view .LVU370
+	.loc 1 68 23 is_stmt 0 view .LVU371
+	leal	3(%r12), %ebp
+.LVL92:
+	.loc 1 68 28 view .LVU372
+	movl	%ebp, %eax
+.LVL93:
+	.loc 1 68 28 view .LVU373
+	andl	$-4, %eax
+.LBE222:
+.LBE221:
+	.loc 1 170 33 view .LVU374
+	leal	8(%r14,%rax), %r14d
+.LVL94:
+	.loc 1 170 23 view .LVU375
+	cmpl	%r14d, %esi
+	jb	.L74
+	.loc 1 174 9 is_stmt 1 view .LVU376
+.LBB223:
+.LBB218:
+	.loc 1 90 12 is_stmt 0 view .LVU377
+	movq	32(%rsp), %rsi
+	movl	$1, %edx
+	movl	$-1, %edi
+.LVL95:
+	.loc 1 90 12 view .LVU378
+	movl	%r13d, 60(%rsp)
+.LVL96:
+	.loc 1 90 12 view .LVU379
+.LBE218:
+.LBI215:
+	.loc 1 77 17 is_stmt 1 view .LVU380
+.LBB219:
+	.loc 1 79 5 view .LVU381
+	.loc 1 80 5 view .LVU382
+	.loc 1 90 5 view .LVU383
+	.loc 1 90 12 is_stmt 0 view .LVU384
+	call	crc32Stm32@PLT
+.LVL97:
+	.loc 1 80 37 view .LVU385
+	movq	%rbp, %rdx
+	.loc 1 90 12 view .LVU386
+	movq	8(%rsp), %rsi
+	.loc 1 80 37 view .LVU387
+	salq	$47, %rdx
+	.loc 1 90 12 view .LVU388
+	movl	%eax, %edi
+	shrq	$49, %rdx
+	call	crc32Stm32@PLT
+.LVL98:
+	.loc 1 90 12 view .LVU389
+.LBE219:
+.LBE223:
+	.loc 1 183 20 view .LVU390
+	movl	%r13d, %esi
+	andl	$128, %esi
+	.loc 1 174 12 view .LVU391
+	cmpl	%eax, 20(%rsp)
+	je	.L126
+	.loc 1 183 9 is_stmt 1 view .LVU392
+	.loc 1 183 12 is_stmt 0 view .LVU393
+	testl	%esi, %esi
+	je	.L81
+.LVL99:
+	.loc 1 184 35 is_stmt 1 view .LVU394
+	.loc 1 184 44 is_stmt 0 view .LVU395
+	movzbl	32(%rbx), %edx
+	.loc 1 184 35 view .LVU396
+	testb	%dl, %dl
+	je	.L84
+.LVL100:
+.L91:
+	.loc 1 184 35 view .LVU397
+	leaq	0(,%rdx,8), %rcx
+.LBB224:
+.LBB225:
+.LBB226:
+	.loc 1 132 20 view .LVU398
+	xorl	%eax, %eax
+.LVL101:
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	.loc 1 132 20 view .LVU399
+.LBE226:
+.LBE225:
+.LBE224:
+	.loc 1 185 17 is_stmt 1 view .LVU400
+	.loc 1 185 26 is_stmt 0 view .LVU401
+	movq	(%r15,%rax), %rdx
+	.loc 1 185 20 view .LVU402
+	testq	%rdx, %rdx
+	je	.L85
+	.loc 1 186 21 is_stmt 1 view .LVU403
+	.loc 1 186 44 is_stmt 0 view .LVU404
+	movq	%rdx, 48(%rbx,%rax)
+.L85:
+	.loc 1 184 65 is_stmt 1 view .LVU405
+.LVL102:
+	.loc 1 184 35 view .LVU406
+	addq	$8, %rax
+.LVL103:
+	.loc 1 184 35 is_stmt 0 view .LVU407
+	cmpq	%rcx, %rax
+	jne	.L86
+.LVL104:
+.L84:
+	.loc 1 189 13 is_stmt 1 view .LVU408
+	movl	$16, %ecx
+	xorl	%eax, %eax
+	movq	%r15, %rdi
+	.loc 1 190 26 is_stmt 0 view .LVU409
+	movb	$0, 43(%rsp)
+.LVL105:
+	.loc 1 189 13 view .LVU410
+	rep stosq
+	.loc 1 190 13 is_stmt 1 view .LVU411
+.LVL106:
+	.loc 1 190 13 is_stmt 0 view .LVU412
+	jmp	.L81
+.LVL107:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+.LBB236:
+	.loc 1 175 13 is_stmt 1 view .LVU413
+.LBB229:
+.LBB227:
+	.loc 1 131 36 is_stmt 0 view .LVU414
+	movzbl	32(%rbx), %edx
+	movl	%r13d, %ecx
+	andl	$127, %ecx
+.LVL108:
+	.loc 1 131 36 view .LVU415
+.LBE227:
+.LBI225:
+	.loc 1 127 15 is_stmt 1 view .LVU416
+.LBB228:
+	.loc 1 129 5 view .LVU417
+	.loc 1 131 5 view .LVU418
+	.loc 1 131 27 view .LVU419
+	testb	%dl, %dl
+	je	.L76
+	.loc 1 132 20 is_stmt 0 view .LVU420
+	movq	24(%rbx), %rdi
+	movzbl	%dl, %ebp
+	xorl	%eax, %eax
+	jmp	.L80
+.LVL109:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.loc 1 131 57 is_stmt 1 view .LVU421
+	.loc 1 131 27 view .LVU422
+	addq	$1, %rax
+.LVL110:
+	.loc 1 131 27 is_stmt 0 view .LVU423
+	cmpq	%rax, %rbp
+	je	.L79
+.LVL111:
+.L80:
+	.loc 1 132 9 is_stmt 1 view .LVU424
+	.loc 1 132 12 is_stmt 0 view .LVU425
+	cmpb	(%rdi,%rax,4), %cl
+	jne	.L77
+	.loc 1 133 13 is_stmt 1 view .LVU426
+.LVL112:
+	.loc 1 133 13 is_stmt 0 view .LVU427
+.LBE228:
+.LBE229:
+	.loc 1 176 13 is_stmt 1 view .LVU428
+	.loc 1 176 16 is_stmt 0 view .LVU429
+	testb	%al, %al
+	js	.L79
+.LBB230:
+.LBB231:
+	.loc 1 61 26 view .LVU430
+	leal	1(%rax), %ebp
+	.loc 1 61 39 view .LVU431
+	movzbl	%dl, %ecx
+.LBE231:
+.LBE230:
+	.loc 1 176 41 view .LVU432
+	movslq	%eax, %r13
+.LVL113:
+.LBB234:
+.LBI230:
+	.loc 1 59 17 is_stmt 1 view .LVU433
+.LBB232:
+	.loc 1 61 5 view .LVU434
+	.loc 1 61 14 is_stmt 0 view .LVU435
+	cmpl	%ecx, %ebp
+	jge	.L82
+	movzwl	6(%rdi,%rax,4), %ecx
+.L83:
+.LVL114:
+	.loc 1 63 5 is_stmt 1 view .LVU436
+	.loc 1 63 16 is_stmt 0 view .LVU437
+	subw	2(%rdi,%rax,4), %cx
+.LVL115:
+	.loc 1 63 16 view .LVU438
+.LBE232:
+.LBE234:
+	.loc 1 176 30 view .LVU439
+	cmpw	%r12w, %cx
+	jne	.L79
+	.loc 1 177 17 is_stmt 1 view .LVU440
+	.loc 1 177 32 is_stmt 0 view .LVU441
+	movq	8(%rsp), %rax
+.LVL116:
+	.loc 1 178 30 view .LVU442
+	movb	$1, 43(%rsp)
+.LVL117:
+	.loc 1 177 32 view .LVU443
+	movq	%rax, 64(%rsp,%r13,8)
+	.loc 1 178 17 is_stmt 1 view .LVU444
+.LVL118:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 178 17 is_stmt 0 view .LVU445
+.LBE236:
+	.loc 1 183 9 is_stmt 1 view .LVU446
+	.loc 1 183 12 is_stmt 0 view .LVU447
+	testl	%esi, %esi
+	je	.L81
+	jmp	.L91
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.loc 1 183 12 view .LVU448
+.LBE244:
+.LBE207:
+.LBE206:
+.LBB251:
+.LBB187:
+	.loc 1 51 41 view .LVU449
+	movl	44(%rsp), %r14d
+.LVL120:
+.L120:
+	.loc 1 51 41 view .LVU450
+.LBE187:
+.LBE251:
+	.loc 1 232 5 is_stmt 1 view .LVU451
+.LBB252:
+	.loc 1 49 16 view .LVU452
+.LBB188:
+	.loc 1 51 5 view .LVU453
+	.loc 1 51 5 is_stmt 0 view .LVU454
+.LBE188:
+.LBE252:
+.LBB253:
+	.loc 1 44 18 is_stmt 1 view .LVU455
+.LBB195:
+	.loc 1 46 5 view .LVU456
+.LBE195:
+.LBE253:
+.LBB254:
+.LBB189:
+	.loc 1 51 41 is_stmt 0 view .LVU457
+	xorl	%edx, %edx
+	cmpb	$1, 36(%rbx)
+	setne	%dl
+.LBE189:
+.LBE254:
+.LBB255:
+.LBB196:
+	.loc 1 46 36 view .LVU458
+	imull	8(%rbx), %edx
+	.loc 1 46 29 view .LVU459
+	addq	(%rbx), %rdx
+.LVL121:
+	.loc 1 46 29 view .LVU460
+.LBE196:
+.LBE255:
+.LBB256:
+	.loc 1 115 12 is_stmt 1 view .LVU461
+.LBB203:
+	.loc 1 117 5 view .LVU462
+	.loc 1 119 17 is_stmt 0 view .LVU463
+	shrl	$2, %r14d
+.LVL122:
+	.loc 1 117 21 view .LVU464
+	movq	%rdx, %rax
+.LVL123:
+	.loc 1 119 5 is_stmt 1 view .LVU465
+	.loc 1 119 35 view .LVU466
+	jmp	.L72
+.LVL124:
+.L82:
+	.loc 1 119 35 is_stmt 0 view .LVU467
+.LBE203:
+.LBE256:
+.LBB257:
+.LBB248:
+.LBB245:
+.LBB237:
+.LBB235:
+.LBB233:
+	.loc 1 61 14 view .LVU468
+	movzwl	34(%rbx), %ecx
+	jmp	.L83
+.LVL125:
+	.p2align 4,,10
+	.p2align 3
+.L88:
+	.loc 1 61 14 view .LVU469
+.LBE233:
+.LBE235:
+.LBE237:
+.LBE245:
+.LBE248:
+.LBE257:
+.LBB258:
+.LBB204:
+	.loc 1 124 11 view .LVU470
+	movl	$1, %eax
+.LVL126:
+	.loc 1 124 11 view .LVU471
+	jmp	.L89
+.LVL127:
+.L125:
+	.loc 1 124 11 view .LVU472
+.LBE204:
+.LBE258:
+.LBB259:
+.LBB249:
+.LBB246:
+	.loc 1 164 32 view .LVU473
+	movzbl	43(%rsp), %r10d
+	movl	%r14d, %r15d
+	movl	44(%rsp), %r14d
+.LVL128:
+	.loc 1 164 13 is_stmt 1 view .LVU474
+	.loc 1 164 32 is_stmt 0 view .LVU475
+	movl	%r15d, 40(%rbx)
+.LVL129:
+	.loc 1 165 13 is_stmt 1 view .LVU476
+	.loc 1 165 49 is_stmt 0 view .LVU477
+	testb	%r10b, %r10b
+	jne	.L94
+.LVL130:
+.LBB238:
+.LBI238:
+	.loc 1 115 12 is_stmt 1 view .LVU478
+.LBB239:
+	.loc 1 117 5 view .LVU479
+	.loc 1 119 5 view .LVU480
+	.loc 1 119 5 is_stmt 0 view .LVU481
+.LBE239:
+.LBE238:
+	.loc 1 165 52 view .LVU482
+	subl	%r15d, %esi
+.LVL131:
+.LBB241:
+.LBB240:
+	.loc 1 119 35 is_stmt 1 view .LVU483
+	shrl	$2, %esi
+.LVL132:
+	.loc 1 119 35 is_stmt 0 view .LVU484
+	je	.L95
+	leal	0(,%rsi,4), %edx
+	addq	%rax, %rdx
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.loc 1 120 9 is_stmt 1 view .LVU485
+	.loc 1 120 18 is_stmt 0 view .LVU486
+	addq	$4, %rax
+.LVL134:
+	.loc 1 120 12 view .LVU487
+	cmpl	$-1, -4(%rax)
+	jne	.L69
+	.loc 1 119 49 is_stmt 1 view .LVU488
+	.loc 1 119 35 view .LVU489
+	cmpq	%rdx, %rax
+	jne	.L71
+.L95:
+	.loc 1 124 11 is_stmt 0 view .LVU490
+	movl	$1, %r10d
+.LVL135:
+	.loc 1 124 11 view .LVU491
+	jmp	.L69
+.L94:
+.LBE240:
+.LBE241:
+	xorl	%r10d, %r10d
+.L69:
+	.loc 1 165 33 view .LVU492
+	movb	%r10b, 44(%rbx)
+	.loc 1 166 13 is_stmt 1 view .LVU493
+	jmp	.L120
+.LVL136:
+.L124:
+	.loc 1 166 13 is_stmt 0 view .LVU494
+.LBE246:
+.LBE249:
+.LBE259:
+	.loc 1 232 5 is_stmt 1 view .LVU495
+.LBB260:
+	.loc 1 49 16 view .LVU496
+.LBB190:
+	.loc 1 51 5 view .LVU497
+	.loc 1 51 5 is_stmt 0 view .LVU498
+.LBE190:
+.LBE260:
+.LBB261:
+	.loc 1 44 18 is_stmt 1 view .LVU499
+.LBB197:
+	.loc 1 46 5 view .LVU500
+.LBE197:
+.LBE261:
+.LBB262:
+.LBB191:
+	.loc 1 51 41 is_stmt 0 view .LVU501
+	xorl	%edx, %edx
+	cmpb	$1, 36(%rbx)
+	movl	44(%rsp), %r14d
+	setne	%dl
+.LBE191:
+.LBE262:
+.LBB263:
+.LBB198:
+	.loc 1 46 36 view .LVU502
+	imull	%esi, %edx
+	.loc 1 46 29 view .LVU503
+	addq	(%rbx), %rdx
+.LVL137:
+	.loc 1 46 29 view .LVU504
+.LBE198:
+.LBE263:
+.LBB264:
+	.loc 1 115 12 is_stmt 1 view .LVU505
+.LBB205:
+	.loc 1 117 5 view .LVU506
+	.loc 1 119 17 is_stmt 0 view .LVU507
+	shrl	$2, %r14d
+.LVL138:
+	.loc 1 117 21 view .LVU508
+	movq	%rdx, %rax
+.LVL139:
+	.loc 1 119 5 is_stmt 1 view .LVU509
+	.loc 1 119 35 view .LVU510
+	jmp	.L72
+.LVL140:
+.L76:
+	.loc 1 119 35 is_stmt 0 view .LVU511
+.LBE205:
+.LBE264:
+.LBB265:
+.LBB250:
+.LBB247:
+.LBB242:
+	.loc 1 176 13 is_stmt 1 view .LVU512
+	.loc 1 176 13 is_stmt 0 view .LVU513
+.LBE242:
+	.loc 1 183 9 is_stmt 1 view .LVU514
+	.loc 1 183 12 is_stmt 0 view .LVU515
+	testl	%esi, %esi
+	je	.L81
+	jmp	.L84
+.LBE247:
+.LBE250:
+.LBE265:
+	.cfi_endproc
+.LFE12:
+	.size	configStorageInit, .-configStorageInit
+	.section	.text.configStorageStoredSectionCount,"ax",@progbits
+	.p2align 4
+	.globl	configStorageStoredSectionCount
+	.type	configStorageStoredSectionCount, @function
+configStorageStoredSectionCount:
+.LVL141:
+.LFB13:
+	.loc 1 238 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 239 5 view .LVU517
+	.loc 1 240 5 view .LVU518
+	.loc 1 242 5 view .LVU519
+	.loc 1 242 27 view .LVU520
+	.loc 1 242 36 is_stmt 0 view .LVU521
+	movzbl	32(%rdi), %eax
+	.loc 1 242 27 view .LVU522
+	testb	%al, %al
+	je	.L127
+	leaq	(%rdi,%rax,8), %rdx
+	.loc 1 239 13 view .LVU523
+	xorl	%eax, %eax
+.LVL142:
+	.p2align 4,,10
+	.p2align 3
+.L130:
+	.loc 1 243 9 is_stmt 1 view .LVU524
+	.loc 1 244 18 is_stmt 0 view .LVU525
+	cmpq	$1, 48(%rdi)
+	sbbb	$-1, %al
+.LVL143:
+	.loc 1 242 57 is_stmt 1 view .LVU526
+	.loc 1 242 27 view .LVU527
+	addq	$8, %rdi
+.LVL144:
+	.loc 1 242 27 is_stmt 0 view .LVU528
+	cmpq	%rdi, %rdx
+	jne	.L130
+.LVL145:
+.L127:
+	.loc 1 248 1 view .LVU529
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	configStorageStoredSectionCount, .-configStorageStoredSectionCount
+	.section	.text.configStorageLoad,"ax",@progbits
+	.p2align 4
+	.globl	configStorageLoad
+	.type	configStorageLoad, @function
+configStorageLoad:
+.LVL146:
+.LFB14:
+	.loc 1 252 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 253 5 view .LVU531
+	.loc 1 255 5 view .LVU532
+	.loc 1 255 27 view .LVU533
+	.loc 1 255 36 is_stmt 0 view .LVU534
+	movzbl	32(%rdi), %eax
+	.loc 1 255 27 view .LVU535
+	testb	%al, %al
+	je	.L148
+	.loc 1 252 1 view .LVU536
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	xorl	%ebx, %ebx
+	jmp	.L136
+.LVL147:
+	.p2align 4,,10
+	.p2align 3
+.L152:
+.LBB268:
+.LBB269:
+	.loc 1 61 14 view .LVU537
+	movzwl	6(%rcx,%rdi,4), %edx
+.L139:
+.LVL148:
+	.loc 1 63 5 is_stmt 1 view .LVU538
+	.loc 1 63 42 is_stmt 0 view .LVU539
+	movzwl	2(%rcx,%rdi,4), %edi
+	movq	%rdi, %rax
+.LVL149:
+	.loc 1 63 42 view .LVU540
+.LBE269:
+.LBE268:
+	.loc 1 257 13 view .LVU541
+	addq	%rbp, %rdi
+.LBB272:
+.LBB270:
+	.loc 1 63 16 view .LVU542
+	subl	%eax, %edx
+.LVL150:
+	.loc 1 63 16 view .LVU543
+.LBE270:
+.LBE272:
+	.loc 1 257 13 view .LVU544
+	movzwl	%dx, %edx
+	call	memcpy@PLT
+.LVL151:
+	movzbl	32(%r12), %eax
+.LVL152:
+.L137:
+	.loc 1 255 57 is_stmt 1 discriminator 2 view .LVU545
+	addl	$1, %ebx
+.LVL153:
+	.loc 1 255 27 discriminator 2 view .LVU546
+	cmpb	%al, %bl
+	jnb	.L151
+.LVL154:
+.L136:
+	.loc 1 256 9 view .LVU547
+	.loc 1 256 28 is_stmt 0 view .LVU548
+	movzbl	%bl, %ecx
+	movzbl	%bl, %edx
+	movq	48(%r12,%rcx,8), %rsi
+	.loc 1 256 12 view .LVU549
+	testq	%rsi, %rsi
+	je	.L137
+	.loc 1 257 13 is_stmt 1 view .LVU550
+.LVL155:
+.LBB273:
+.LBI268:
+	.loc 1 59 17 view .LVU551
+.LBB271:
+	.loc 1 61 5 view .LVU552
+	.loc 1 61 26 is_stmt 0 view .LVU553
+	addl	$1, %edx
+	.loc 1 61 63 view .LVU554
+	movq	24(%r12), %rcx
+	.loc 1 61 73 view .LVU555
+	movzbl	%bl, %edi
+	.loc 1 61 14 view .LVU556
+	cmpl	%eax, %edx
+	jl	.L152
+	movzwl	34(%r12), %edx
+	jmp	.L139
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.loc 1 61 14 view .LVU557
+.LBE271:
+.LBE273:
+	.loc 1 260 1 view .LVU558
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL157:
+	.loc 1 260 1 view .LVU559
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL158:
+	.loc 1 260 1 view .LVU560
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL159:
+	.loc 1 260 1 view .LVU561
+	ret
+.LVL160:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 260 1 view .LVU562
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	configStorageLoad, .-configStorageLoad
+	.section	.text.configStorageStartSave,"ax",@progbits
+	.p2align 4
+	.globl	configStorageStartSave
+	.type	configStorageStartSave, @function
+configStorageStartSave:
+.LVL161:
+.LFB20:
+	.loc 1 359 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 360 5 view .LVU564
+	.loc 1 360 19 is_stmt 0 view .LVU565
+	movq	%rsi, 192(%rdi)
+	.loc 1 361 5 is_stmt 1 view .LVU566
+	.loc 1 361 32 is_stmt 0 view .LVU567
+	movb	$3, 188(%rdi)
+	.loc 1 363 5 is_stmt 1 view .LVU568
+	jmp	beginSave
+.LVL162:
+	.loc 1 363 5 is_stmt 0 view .LVU569
+	.cfi_endproc
+.LFE20:
+	.size	configStorageStartSave, .-configStorageStartSave
+	.section	.text.configStorageProcess,"ax",@progbits
+	.p2align 4
+	.globl	configStorageProcess
+	.type	configStorageProcess, @function
+configStorageProcess:
+.LVL163:
+.LFB26:
+	.loc 1 508 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 509 5 view .LVU571
+	.loc 1 508 1 is_stmt 0 view .LVU572
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	.loc 1 509 20 view .LVU573
+	movl	176(%rdi), %eax
+	.loc 1 509 5 view .LVU574
+	cmpl	$1, %eax
+	je	.L155
+	cmpl	$2, %eax
+	je	.L156
+	testl	%eax, %eax
+	je	.L235
+.LVL164:
+.L154:
+	.loc 1 534 1 view .LVU575
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL165:
+	.loc 1 534 1 view .LVU576
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL166:
+	.p2align 4,,10
+	.p2align 3
+.L155:
+	.cfi_restore_state
+	.loc 1 520 13 is_stmt 1 view .LVU577
+	.loc 1 520 16 is_stmt 0 view .LVU578
+	testb	%sil, %sil
+	je	.L154
+	.loc 1 521 17 is_stmt 1 view .LVU579
+	call	eraseStep
+.LVL167:
+	.loc 1 533 19 is_stmt 0 view .LVU580
+	movl	176(%r14), %eax
+	jmp	.L154
+.LVL168:
+	.p2align 4,,10
+	.p2align 3
+.L235:
+	.loc 1 511 13 is_stmt 1 view .LVU581
+	.loc 1 511 38 is_stmt 0 view .LVU582
+	cmpb	$1, 180(%rdi)
+	je	.L158
+	testb	%sil, %sil
+	jne	.L236
+.L158:
+.LBB345:
+.LBB346:
+.LBB347:
+.LBB348:
+	.loc 1 421 18 view .LVU583
+	xorl	%eax, %eax
+.LBE348:
+.LBE347:
+.LBE346:
+.LBE345:
+	.loc 1 533 5 is_stmt 1 view .LVU584
+.LVL169:
+.L241:
+	.loc 1 534 1 is_stmt 0 view .LVU585
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL170:
+	.loc 1 534 1 view .LVU586
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL171:
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	.cfi_restore_state
+	.loc 1 526 13 is_stmt 1 view .LVU587
+.LBB481:
+.LBI345:
+	.loc 1 438 13 view .LVU588
+.LBB473:
+	.loc 1 440 5 view .LVU589
+	.loc 1 440 13 is_stmt 0 view .LVU590
+	movzbl	201(%rdi), %eax
+	.loc 1 441 53 view .LVU591
+	movq	24(%rdi), %rdx
+.LBB389:
+.LBB390:
+	.loc 1 61 39 view .LVU592
+	movzbl	32(%r14), %r9d
+.LBE390:
+.LBE389:
+	.loc 1 440 13 view .LVU593
+	movq	%rax, %r13
+.LVL172:
+	.loc 1 441 5 is_stmt 1 view .LVU594
+	.loc 1 441 63 is_stmt 0 view .LVU595
+	salq	$2, %rax
+.LVL173:
+	.loc 1 441 63 view .LVU596
+	leaq	(%rdx,%rax), %r15
+	.loc 1 442 21 view .LVU597
+	movzbl	%r13b, %ecx
+.LBB396:
+.LBB391:
+	.loc 1 61 39 view .LVU598
+	movl	%r9d, %r12d
+.LBE391:
+.LBE396:
+	.loc 1 441 70 view .LVU599
+	movzwl	2(%r15), %esi
+.LVL174:
+.LBB397:
+.LBB392:
+	.loc 1 61 26 view .LVU600
+	leal	1(%rcx), %r10d
+.LBE392:
+.LBE397:
+	.loc 1 442 21 view .LVU601
+	movl	%ecx, 20(%rsp)
+	.loc 1 441 70 view .LVU602
+	movq	%rsi, %rdi
+.LVL175:
+	.loc 1 441 20 view .LVU603
+	addq	192(%r14), %rsi
+.LVL176:
+	.loc 1 442 5 is_stmt 1 view .LVU604
+.LBB398:
+.LBI389:
+	.loc 1 59 17 view .LVU605
+.LBB393:
+	.loc 1 61 5 view .LVU606
+	.loc 1 61 14 is_stmt 0 view .LVU607
+	cmpl	%r9d, %r10d
+	jl	.L237
+	movzwl	34(%r14), %edx
+.L160:
+.LVL177:
+	.loc 1 63 5 is_stmt 1 view .LVU608
+.LBE393:
+.LBE398:
+.LBB399:
+.LBB400:
+.LBB401:
+.LBB402:
+	.loc 1 51 19 is_stmt 0 view .LVU609
+	movzbl	36(%r14), %eax
+.LBE402:
+.LBE401:
+	.loc 1 56 40 view .LVU610
+	movzbl	200(%r14), %r9d
+.LBE400:
+.LBE399:
+.LBB413:
+.LBB394:
+	.loc 1 63 16 view .LVU611
+	subl	%edi, %edx
+.LVL178:
+	.loc 1 63 16 view .LVU612
+.LBE394:
+.LBE413:
+	.loc 1 443 5 is_stmt 1 view .LVU613
+.LBB414:
+.LBI399:
+	.loc 1 54 18 view .LVU614
+.LBB411:
+	.loc 1 56 5 view .LVU615
+.LBB405:
+.LBB403:
+	.loc 1 51 19 is_stmt 0 view .LVU616
+	movl	%eax, %edi
+.LBE403:
+.LBE405:
+	.loc 1 56 12 view .LVU617
+	testb	%r9b, %r9b
+	je	.L162
+.LVL179:
+.LBB406:
+.LBI401:
+	.loc 1 49 16 is_stmt 1 view .LVU618
+.LBB404:
+	.loc 1 51 5 view .LVU619
+	.loc 1 51 41 is_stmt 0 view .LVU620
+	xorl	%eax, %eax
+	cmpb	$1, %dil
+	setne	%al
+.L162:
+.LVL180:
+	.loc 1 51 41 view .LVU621
+.LBE404:
+.LBE406:
+.LBB407:
+.LBI407:
+	.loc 1 44 18 is_stmt 1 view .LVU622
+.LBB408:
+	.loc 1 46 5 view .LVU623
+	.loc 1 46 45 is_stmt 0 view .LVU624
+	movl	8(%r14), %edi
+.LVL181:
+	.loc 1 46 45 view .LVU625
+.LBE408:
+.LBE407:
+.LBE411:
+.LBE414:
+	.loc 1 443 56 view .LVU626
+	movl	204(%r14), %ebx
+	.loc 1 448 61 view .LVU627
+	movzwl	%dx, %ebp
+.LBB415:
+.LBB412:
+.LBB410:
+.LBB409:
+	.loc 1 46 36 view .LVU628
+	imull	%edi, %eax
+.LBE409:
+.LBE410:
+.LBE412:
+.LBE415:
+	.loc 1 443 56 view .LVU629
+	movq	%rbx, %r10
+	.loc 1 443 15 view .LVU630
+	addq	(%r14), %rbx
+	addq	%rax, %rbx
+.LVL182:
+	.loc 1 444 5 is_stmt 1 view .LVU631
+	.loc 1 444 58 is_stmt 0 view .LVU632
+	leaq	8(%rbx), %rax
+	movq	%rax, 8(%rsp)
+.LVL183:
+	.loc 1 445 5 is_stmt 1 view .LVU633
+	.loc 1 446 5 view .LVU634
+	.loc 1 448 5 view .LVU635
+	.loc 1 448 16 is_stmt 0 view .LVU636
+	movl	208(%r14), %eax
+.LVL184:
+	.loc 1 448 8 view .LVU637
+	testl	%eax, %eax
+	jne	.L163
+.LVL185:
+.LBB416:
+.LBI416:
+	.loc 1 66 17 is_stmt 1 view .LVU638
+.LBB417:
+	.loc 1 68 5 view .LVU639
+	.loc 1 68 23 is_stmt 0 view .LVU640
+	leal	3(%rbp), %r11d
+	.loc 1 68 28 view .LVU641
+	andl	$-4, %r11d
+.LBE417:
+.LBE416:
+	.loc 1 448 59 view .LVU642
+	leal	8(%r10,%r11), %r10d
+	.loc 1 448 34 view .LVU643
+	cmpl	%r10d, %edi
+	jnb	.L163
+	.loc 1 449 9 is_stmt 1 view .LVU644
+	.loc 1 449 12 is_stmt 0 view .LVU645
+	testb	%r9b, %r9b
+	je	.L164
+.LVL186:
+.L228:
+.LBB418:
+.LBB419:
+.LBB420:
+	.loc 1 346 9 is_stmt 1 view .LVU646
+	.loc 1 346 24 is_stmt 0 view .LVU647
+	movl	$3, 176(%r14)
+	.loc 1 347 9 is_stmt 1 view .LVU648
+.LBE420:
+.LBE419:
+.LBE418:
+.LBE473:
+.LBE481:
+	.loc 1 534 1 is_stmt 0 view .LVU649
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB482:
+.LBB474:
+.LBB427:
+.LBB422:
+.LBB421:
+	.loc 1 347 9 view .LVU650
+	movl	$3, %eax
+.LBE421:
+.LBE422:
+.LBE427:
+.LBE474:
+.LBE482:
+	.loc 1 534 1 view .LVU651
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL187:
+	.loc 1 534 1 view .LVU652
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL188:
+	.p2align 4,,10
+	.p2align 3
+.L237:
+	.cfi_restore_state
+.LBB483:
+.LBB475:
+.LBB428:
+.LBB395:
+	.loc 1 61 14 view .LVU653
+	movzwl	6(%rdx,%rax), %edx
+	jmp	.L160
+.LVL189:
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.loc 1 61 14 view .LVU654
+.LBE395:
+.LBE428:
+	.loc 1 460 5 is_stmt 1 view .LVU655
+	.loc 1 460 8 is_stmt 0 view .LVU656
+	cmpl	%ebp, %eax
+	jb	.L238
+	.loc 1 473 9 view .LVU657
+	movq	8(%rsp), %rdi
+	movzwl	%dx, %edx
+	movb	%r9b, 24(%rsp)
+	.loc 1 473 5 is_stmt 1 view .LVU658
+	.loc 1 473 9 is_stmt 0 view .LVU659
+	call	memcmp@PLT
+.LVL190:
+	.loc 1 473 8 view .LVU660
+	movzbl	24(%rsp), %r9d
+	testl	%eax, %eax
+	jne	.L239
+	.loc 1 478 5 is_stmt 1 view .LVU661
+	.loc 1 478 46 is_stmt 0 view .LVU662
+	addl	$1, %r13d
+.LVL191:
+.LBB429:
+.LBI429:
+	.loc 1 269 16 is_stmt 1 view .LVU663
+.LBB430:
+	.loc 1 271 5 view .LVU664
+	.loc 1 271 66 view .LVU665
+	.loc 1 271 42 is_stmt 0 view .LVU666
+	cmpb	%r12b, %r13b
+	jnb	.L177
+	testb	%r9b, %r9b
+	jne	.L177
+	.p2align 4,,10
+	.p2align 3
+.L178:
+	.loc 1 271 70 view .LVU667
+	movzbl	%r13b, %esi
+	movq	%r14, %rdi
+	call	isSectionChanged
+.LVL192:
+	.loc 1 271 66 view .LVU668
+	testb	%al, %al
+	jne	.L177
+	.loc 1 272 9 is_stmt 1 view .LVU669
+	.loc 1 272 14 is_stmt 0 view .LVU670
+	addl	$1, %r13d
+.LVL193:
+	.loc 1 271 66 is_stmt 1 view .LVU671
+	.loc 1 271 42 is_stmt 0 view .LVU672
+	cmpb	%r12b, %r13b
+	jb	.L178
+.L177:
+	.loc 1 274 5 is_stmt 1 view .LVU673
+.LVL194:
+	.loc 1 274 5 is_stmt 0 view .LVU674
+.LBE430:
+.LBE429:
+	.loc 1 479 5 is_stmt 1 view .LVU675
+.LBB431:
+.LBI431:
+	.loc 1 71 17 view .LVU676
+.LBB432:
+	.loc 1 73 5 view .LVU677
+.LBE432:
+.LBE431:
+	.loc 1 479 55 is_stmt 0 view .LVU678
+	cmpb	%r13b, %r12b
+.LBB436:
+.LBB433:
+	.loc 1 73 40 view .LVU679
+	movl	%ebp, %eax
+.LBE433:
+.LBE436:
+.LBB437:
+.LBB438:
+	.loc 1 90 12 view .LVU680
+	leaq	44(%rsp), %rsi
+	movl	$1, %edx
+.LBE438:
+.LBE437:
+	.loc 1 479 55 view .LVU681
+	sete	%r12b
+.LVL195:
+.LBB442:
+.LBB434:
+	.loc 1 73 40 view .LVU682
+	sall	$16, %eax
+.LBE434:
+.LBE442:
+.LBB443:
+.LBB439:
+	.loc 1 80 32 view .LVU683
+	addl	$3, %ebp
+	.loc 1 90 12 view .LVU684
+	movl	$-1, %edi
+.LBE439:
+.LBE443:
+	.loc 1 479 55 view .LVU685
+	sall	$7, %r12d
+	orb	(%r15), %r12b
+.LBB444:
+.LBB435:
+	.loc 1 73 23 view .LVU686
+	movzbl	%r12b, %r12d
+	orl	%eax, %r12d
+.LVL196:
+	.loc 1 73 23 view .LVU687
+.LBE435:
+.LBE444:
+	.loc 1 481 5 is_stmt 1 view .LVU688
+	movl	%r12d, 44(%rsp)
+.LVL197:
+.LBB445:
+.LBI437:
+	.loc 1 77 17 view .LVU689
+.LBB440:
+	.loc 1 79 5 view .LVU690
+	.loc 1 80 5 view .LVU691
+	.loc 1 90 5 view .LVU692
+	.loc 1 90 12 is_stmt 0 view .LVU693
+	call	crc32Stm32@PLT
+.LVL198:
+	.loc 1 80 37 view .LVU694
+	movq	%rbp, %rdx
+	.loc 1 90 12 view .LVU695
+	movq	8(%rsp), %rsi
+	.loc 1 80 37 view .LVU696
+	salq	$47, %rdx
+	.loc 1 90 12 view .LVU697
+	movl	%eax, %edi
+	shrq	$49, %rdx
+	call	crc32Stm32@PLT
+.LVL199:
+.LBE440:
+.LBE445:
+	.loc 1 481 10 view .LVU698
+	leaq	4(%rbx), %rdi
+.LBB446:
+.LBB441:
+	.loc 1 90 12 view .LVU699
+	movl	%eax, %r15d
+.LVL200:
+	.loc 1 90 12 view .LVU700
+.LBE441:
+.LBE446:
+	.loc 1 481 10 view .LVU701
+	movq	%rdi, 24(%rsp)
+.LVL201:
+.LBB447:
+.LBI447:
+	.loc 1 377 12 is_stmt 1 view .LVU702
+.LBB448:
+	.loc 1 379 5 view .LVU703
+	.loc 1 381 5 view .LVU704
+.LBB449:
+.LBI449:
+	.loc 1 366 13 view .LVU705
+.LBB450:
+	.loc 1 368 5 view .LVU706
+	call	FLASH_Unlock@PLT
+.LVL202:
+	.loc 1 368 5 is_stmt 0 view .LVU707
+.LBE450:
+.LBE449:
+	.loc 1 382 5 is_stmt 1 view .LVU708
+	.loc 1 382 14 is_stmt 0 view .LVU709
+	movq	24(%rsp), %rdi
+	movl	%r15d, %esi
+	call	FLASH_ProgramWord@PLT
+.LVL203:
+	.loc 1 383 5 is_stmt 1 view .LVU710
+	.loc 1 382 14 is_stmt 0 view .LVU711
+	movl	%eax, 24(%rsp)
+.LVL204:
+	.loc 1 383 5 view .LVU712
+	call	FLASH_Lock@PLT
+.LVL205:
+	.loc 1 385 5 is_stmt 1 view .LVU713
+	.loc 1 385 37 is_stmt 0 view .LVU714
+	cmpl	$4, 24(%rsp)
+	je	.L240
+.LVL206:
+.L187:
+	.loc 1 385 37 view .LVU715
+.LBE448:
+.LBE447:
+.LBB452:
+.LBB385:
+	.loc 1 426 9 is_stmt 1 view .LVU716
+.LBB349:
+.LBI349:
+	.loc 1 336 13 view .LVU717
+.LBB350:
+	.loc 1 338 5 view .LVU718
+	.loc 1 338 8 is_stmt 0 view .LVU719
+	cmpb	$0, 200(%r14)
+	je	.L190
+.LVL207:
+.L232:
+	.loc 1 339 9 is_stmt 1 view .LVU720
+	.loc 1 339 30 is_stmt 0 view .LVU721
+	movb	$0, 180(%r14)
+	.loc 1 340 9 is_stmt 1 view .LVU722
+	.loc 1 340 30 is_stmt 0 view .LVU723
+	movl	$0, 184(%r14)
+.L191:
+	.loc 1 345 5 is_stmt 1 view .LVU724
+	.loc 1 345 16 is_stmt 0 view .LVU725
+	movzbl	188(%r14), %eax
+	.loc 1 345 8 view .LVU726
+	testb	%al, %al
+	je	.L228
+	.loc 1 350 5 is_stmt 1 view .LVU727
+	.loc 1 350 31 is_stmt 0 view .LVU728
+	subl	$1, %eax
+	.loc 1 351 5 view .LVU729
+	movq	%r14, %rdi
+	.loc 1 350 31 view .LVU730
+	movb	%al, 188(%r14)
+	.loc 1 351 5 is_stmt 1 view .LVU731
+	call	beginSave
+.LVL208:
+.L229:
+	.loc 1 351 5 is_stmt 0 view .LVU732
+.LBE350:
+.LBE349:
+.LBE385:
+.LBE452:
+.LBE475:
+.LBE483:
+	.loc 1 533 19 view .LVU733
+	movl	176(%r14), %eax
+	jmp	.L154
+.LVL209:
+	.p2align 4,,10
+	.p2align 3
+.L238:
+.LBB484:
+.LBB476:
+.LBB453:
+	.loc 1 461 9 is_stmt 1 view .LVU734
+	.loc 1 463 61 is_stmt 0 view .LVU735
+	subl	%eax, %ebp
+	.loc 1 463 40 view .LVU736
+	movl	%eax, %edi
+	.loc 1 463 132 view .LVU737
+	movl	$4, %eax
+	.loc 1 461 18 view .LVU738
+	movl	$-1, 44(%rsp)
+	.loc 1 463 9 is_stmt 1 view .LVU739
+	.loc 1 463 132 is_stmt 0 view .LVU740
+	cmpl	%eax, %ebp
+	.loc 1 463 9 view .LVU741
+	leaq	44(%rsp), %r9
+	.loc 1 463 132 view .LVU742
+	cmova	%eax, %ebp
+	.loc 1 463 31 view .LVU743
+	addq	%rdi, %rsi
+.LVL210:
+	.loc 1 463 9 view .LVU744
+	testl	%ebp, %ebp
+	je	.L167
+	xorl	%eax, %eax
+.LVL211:
+.L166:
+	.loc 1 463 9 view .LVU745
+	movl	%eax, %edx
+	addl	$1, %eax
+	movzbl	(%rsi,%rdx), %ecx
+	movb	%cl, (%r9,%rdx)
+	cmpl	%ebp, %eax
+	jb	.L166
+.L167:
+	.loc 1 464 9 is_stmt 1 view .LVU746
+	.loc 1 464 14 is_stmt 0 view .LVU747
+	movq	8(%rsp), %rbx
+.LVL212:
+	.loc 1 464 14 view .LVU748
+	movl	44(%rsp), %r12d
+	addq	%rdi, %rbx
+.LVL213:
+.LBB423:
+.LBI423:
+	.loc 1 377 12 is_stmt 1 view .LVU749
+.LBB424:
+	.loc 1 379 5 view .LVU750
+	.loc 1 381 5 view .LVU751
+.LBB425:
+.LBI425:
+	.loc 1 366 13 view .LVU752
+.LBB426:
+	.loc 1 368 5 view .LVU753
+	call	FLASH_Unlock@PLT
+.LVL214:
+.LBE426:
+.LBE425:
+	.loc 1 382 5 view .LVU754
+	.loc 1 382 14 is_stmt 0 view .LVU755
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	call	FLASH_ProgramWord@PLT
+.LVL215:
+	movl	%eax, %ebp
+.LVL216:
+	.loc 1 383 5 is_stmt 1 view .LVU756
+	call	FLASH_Lock@PLT
+.LVL217:
+	.loc 1 385 5 view .LVU757
+	.loc 1 385 37 is_stmt 0 view .LVU758
+	cmpl	$4, %ebp
+	jne	.L187
+	cmpl	(%rbx), %r12d
+	jne	.L187
+.LVL218:
+	.loc 1 385 37 view .LVU759
+.LBE424:
+.LBE423:
+	.loc 1 468 9 is_stmt 1 view .LVU760
+	.loc 1 468 29 is_stmt 0 view .LVU761
+	addl	$4, 208(%r14)
+	.loc 1 469 9 is_stmt 1 view .LVU762
+.LBE453:
+.LBE476:
+.LBE484:
+	.loc 1 533 19 is_stmt 0 view .LVU763
+	movl	176(%r14), %eax
+.LBB485:
+.LBB477:
+.LBB454:
+	.loc 1 469 9 view .LVU764
+	jmp	.L154
+.LVL219:
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	.loc 1 469 9 view .LVU765
+.LBE454:
+	.loc 1 474 9 is_stmt 1 view .LVU766
+.LBB455:
+.LBI455:
+	.loc 1 336 13 view .LVU767
+.LBB456:
+	.loc 1 338 5 view .LVU768
+	.loc 1 338 8 is_stmt 0 view .LVU769
+	testb	%r9b, %r9b
+	jne	.L232
+.LVL220:
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	.loc 1 338 8 view .LVU770
+.LBE456:
+.LBE455:
+.LBB457:
+.LBB386:
+.LBB352:
+.LBB351:
+	.loc 1 342 9 is_stmt 1 view .LVU771
+	.loc 1 342 29 is_stmt 0 view .LVU772
+	movb	$0, 44(%r14)
+	jmp	.L191
+.LVL221:
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	.loc 1 342 29 view .LVU773
+.LBE351:
+.LBE352:
+.LBE386:
+.LBE457:
+.LBE477:
+.LBE485:
+	.loc 1 514 13 is_stmt 1 view .LVU774
+	.loc 1 514 34 is_stmt 0 view .LVU775
+	movl	$0, 184(%rdi)
+	.loc 1 515 13 is_stmt 1 view .LVU776
+	.loc 1 515 28 is_stmt 0 view .LVU777
+	movl	$1, 176(%rdi)
+	.loc 1 516 13 is_stmt 1 view .LVU778
+	call	eraseStep
+.LVL222:
+	.loc 1 517 13 view .LVU779
+	.loc 1 533 19 is_stmt 0 view .LVU780
+	movl	176(%r14), %eax
+	.loc 1 517 13 view .LVU781
+	jmp	.L154
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L164:
+.LBB486:
+.LBB478:
+	.loc 1 455 9 is_stmt 1 view .LVU782
+	.loc 1 455 29 is_stmt 0 view .LVU783
+	movb	$0, 44(%r14)
+	.loc 1 456 9 is_stmt 1 view .LVU784
+	movq	%r14, %rdi
+	call	beginSave
+.LVL224:
+	.loc 1 457 9 view .LVU785
+.LBE478:
+.LBE486:
+	.loc 1 533 19 is_stmt 0 view .LVU786
+	movl	176(%r14), %eax
+.LBB487:
+.LBB479:
+	.loc 1 457 9 view .LVU787
+	jmp	.L154
+.LVL225:
+	.p2align 4,,10
+	.p2align 3
+.L240:
+.LBB458:
+.LBB451:
+	.loc 1 385 37 view .LVU788
+	cmpl	%r15d, 4(%rbx)
+	jne	.L187
+.LVL226:
+	.loc 1 385 37 view .LVU789
+.LBE451:
+.LBE458:
+.LBB459:
+.LBI459:
+	.loc 1 377 12 is_stmt 1 view .LVU790
+.LBB460:
+	.loc 1 379 5 view .LVU791
+	.loc 1 381 5 view .LVU792
+.LBB461:
+.LBI461:
+	.loc 1 366 13 view .LVU793
+.LBB462:
+	.loc 1 368 5 view .LVU794
+	call	FLASH_Unlock@PLT
+.LVL227:
+.LBE462:
+.LBE461:
+	.loc 1 382 5 view .LVU795
+	.loc 1 382 14 is_stmt 0 view .LVU796
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	call	FLASH_ProgramWord@PLT
+.LVL228:
+	movl	%eax, %r15d
+.LVL229:
+	.loc 1 383 5 is_stmt 1 view .LVU797
+	call	FLASH_Lock@PLT
+.LVL230:
+	.loc 1 385 5 view .LVU798
+	.loc 1 385 37 is_stmt 0 view .LVU799
+	cmpl	$4, %r15d
+	jne	.L187
+	cmpl	(%rbx), %r12d
+	jne	.L187
+.LVL231:
+	.loc 1 385 37 view .LVU800
+.LBE460:
+.LBE459:
+	.loc 1 486 5 is_stmt 1 view .LVU801
+	.loc 1 486 29 is_stmt 0 view .LVU802
+	movslq	20(%rsp), %rax
+	movq	8(%rsp), %rbx
+.LVL232:
+.LBB463:
+.LBB464:
+	.loc 1 68 28 view .LVU803
+	andl	$-4, %ebp
+.LBE464:
+.LBE463:
+	.loc 1 486 29 view .LVU804
+	movq	%rbx, 216(%r14,%rax,8)
+	.loc 1 487 5 is_stmt 1 view .LVU805
+.LVL233:
+.LBB466:
+.LBI463:
+	.loc 1 66 17 view .LVU806
+.LBB465:
+	.loc 1 68 5 view .LVU807
+	.loc 1 68 5 is_stmt 0 view .LVU808
+.LBE465:
+.LBE466:
+	.loc 1 487 27 view .LVU809
+	movl	204(%r14), %eax
+	.loc 1 491 23 view .LVU810
+	movzbl	32(%r14), %edx
+	.loc 1 488 27 view .LVU811
+	movb	%r13b, 201(%r14)
+	.loc 1 489 25 view .LVU812
+	movl	$0, 208(%r14)
+	.loc 1 487 27 view .LVU813
+	leal	8(%rbp,%rax), %esi
+	movl	%esi, 204(%r14)
+	.loc 1 488 5 is_stmt 1 view .LVU814
+	.loc 1 489 5 view .LVU815
+	.loc 1 491 5 view .LVU816
+	.loc 1 491 8 is_stmt 0 view .LVU817
+	cmpb	%dl, %r13b
+	jb	.L229
+	.loc 1 495 5 is_stmt 1 view .LVU818
+	.loc 1 495 8 is_stmt 0 view .LVU819
+	cmpb	$0, 200(%r14)
+	jne	.L184
+.LVL234:
+.LBB467:
+.LBB468:
+	.loc 1 281 27 is_stmt 1 view .LVU820
+	movq	%r14, %rax
+	leaq	(%r14,%rdx,8), %rcx
+	testb	%dl, %dl
+	je	.L189
+.LVL235:
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	.loc 1 282 9 view .LVU821
+	.loc 1 282 29 is_stmt 0 view .LVU822
+	movq	216(%rax), %rdx
+	.loc 1 282 12 view .LVU823
+	testq	%rdx, %rdx
+	je	.L195
+	.loc 1 283 13 is_stmt 1 view .LVU824
+	.loc 1 283 36 is_stmt 0 view .LVU825
+	movq	%rdx, 48(%rax)
+.L195:
+	.loc 1 281 57 is_stmt 1 view .LVU826
+.LVL236:
+	.loc 1 281 27 view .LVU827
+	addq	$8, %rax
+.LVL237:
+	.loc 1 281 27 is_stmt 0 view .LVU828
+	cmpq	%rcx, %rax
+	jne	.L196
+.LVL238:
+.L189:
+	.loc 1 287 24 view .LVU829
+	movl	%esi, 40(%r14)
+.LBE468:
+.LBE467:
+.LBB470:
+.LBB387:
+	.loc 1 421 18 view .LVU830
+	xorl	%eax, %eax
+.LVL239:
+	.loc 1 421 18 view .LVU831
+.LBE387:
+.LBE470:
+.LBE479:
+.LBE487:
+	.loc 1 533 5 is_stmt 1 view .LVU832
+.LBB488:
+.LBB480:
+.LBB471:
+.LBB469:
+	.loc 1 288 19 is_stmt 0 view .LVU833
+	movq	$0, 192(%r14)
+	.loc 1 289 20 view .LVU834
+	movl	$0, 176(%r14)
+	jmp	.L241
+.LVL240:
+	.p2align 4,,10
+	.p2align 3
+.L184:
+	.loc 1 289 20 view .LVU835
+.LBE469:
+.LBE471:
+	.loc 1 496 9 is_stmt 1 view .LVU836
+.LBB472:
+.LBI347:
+	.loc 1 415 13 view .LVU837
+.LBB388:
+	.loc 1 417 5 view .LVU838
+.LBB353:
+.LBI353:
+	.loc 1 49 16 view .LVU839
+.LBB354:
+	.loc 1 51 5 view .LVU840
+	.loc 1 51 5 is_stmt 0 view .LVU841
+.LBE354:
+.LBE353:
+	.loc 1 418 5 is_stmt 1 view .LVU842
+.LBB357:
+.LBB355:
+	.loc 1 51 19 is_stmt 0 view .LVU843
+	movzbl	36(%r14), %eax
+.LBE355:
+.LBE357:
+	.loc 1 421 18 view .LVU844
+	movl	$1, %ebx
+.LBB358:
+.LBB356:
+	.loc 1 51 41 view .LVU845
+	cmpb	$1, %al
+	setne	8(%rsp)
+.LVL241:
+	.loc 1 51 41 view .LVU846
+.LBE356:
+.LBE358:
+	.loc 1 418 14 view .LVU847
+	testb	%al, %al
+	js	.L186
+.LVL242:
+	.loc 1 420 5 is_stmt 1 view .LVU848
+	.loc 1 418 14 is_stmt 0 view .LVU849
+	movzwl	38(%r14), %eax
+	leal	1(%rax), %ebx
+	movl	$1, %eax
+	testw	%bx, %bx
+	cmove	%eax, %ebx
+.LVL243:
+.L186:
+	.loc 1 424 5 is_stmt 1 view .LVU850
+.LBB359:
+.LBB360:
+	.loc 1 46 36 is_stmt 0 view .LVU851
+	movzbl	8(%rsp), %r15d
+.LBE360:
+.LBE359:
+	.loc 1 424 10 view .LVU852
+	movq	(%r14), %rax
+	movl	16(%r14), %r13d
+.LVL244:
+.LBB362:
+.LBI359:
+	.loc 1 44 18 is_stmt 1 view .LVU853
+.LBB361:
+	.loc 1 46 5 view .LVU854
+	.loc 1 46 36 is_stmt 0 view .LVU855
+	movl	%r15d, %edx
+	imull	8(%r14), %edx
+.LBE361:
+.LBE362:
+	.loc 1 424 10 view .LVU856
+	leaq	4(%rdx,%rax), %r12
+.LVL245:
+.LBB363:
+.LBI363:
+	.loc 1 377 12 is_stmt 1 view .LVU857
+.LBB364:
+	.loc 1 379 5 view .LVU858
+	.loc 1 381 5 view .LVU859
+.LBB365:
+.LBI365:
+	.loc 1 366 13 view .LVU860
+.LBB366:
+	.loc 1 368 5 view .LVU861
+	call	FLASH_Unlock@PLT
+.LVL246:
+	.loc 1 368 5 is_stmt 0 view .LVU862
+.LBE366:
+.LBE365:
+	.loc 1 382 5 is_stmt 1 view .LVU863
+	.loc 1 382 14 is_stmt 0 view .LVU864
+	movl	%r13d, %esi
+	movq	%r12, %rdi
+	call	FLASH_ProgramWord@PLT
+.LVL247:
+	movl	%eax, %ebp
+.LVL248:
+	.loc 1 383 5 is_stmt 1 view .LVU865
+	call	FLASH_Lock@PLT
+.LVL249:
+	.loc 1 385 5 view .LVU866
+	.loc 1 385 37 is_stmt 0 view .LVU867
+	cmpl	$4, %ebp
+	jne	.L187
+	cmpl	(%r12), %r13d
+	jne	.L187
+.LVL250:
+	.loc 1 385 37 view .LVU868
+.LBE364:
+.LBE363:
+.LBB367:
+.LBI367:
+	.loc 1 94 17 is_stmt 1 view .LVU869
+.LBB368:
+	.loc 1 96 5 view .LVU870
+	.loc 1 96 34 is_stmt 0 view .LVU871
+	movl	%ebx, %ebp
+.LBE368:
+.LBE367:
+.LBB371:
+.LBB372:
+	.loc 1 46 36 view .LVU872
+	imull	8(%r14), %r15d
+.LBE372:
+.LBE371:
+.LBB375:
+.LBB369:
+	.loc 1 96 21 view .LVU873
+	movzwl	%bx, %eax
+.LBE369:
+.LBE375:
+.LBB376:
+.LBB373:
+	.loc 1 46 29 view .LVU874
+	addq	(%r14), %r15
+.LBE373:
+.LBE376:
+.LBB377:
+.LBB370:
+	.loc 1 96 34 view .LVU875
+	notl	%ebp
+	.loc 1 96 54 view .LVU876
+	sall	$16, %ebp
+	.loc 1 96 21 view .LVU877
+	orl	%eax, %ebp
+.LVL251:
+	.loc 1 96 21 view .LVU878
+.LBE370:
+.LBE377:
+.LBB378:
+.LBI371:
+	.loc 1 44 18 is_stmt 1 view .LVU879
+.LBB374:
+	.loc 1 46 5 view .LVU880
+	.loc 1 46 5 is_stmt 0 view .LVU881
+.LBE374:
+.LBE378:
+.LBB379:
+.LBI379:
+	.loc 1 377 12 is_stmt 1 view .LVU882
+.LBB380:
+	.loc 1 379 5 view .LVU883
+	.loc 1 381 5 view .LVU884
+.LBB381:
+.LBI381:
+	.loc 1 366 13 view .LVU885
+.LBB382:
+	.loc 1 368 5 view .LVU886
+	call	FLASH_Unlock@PLT
+.LVL252:
+.LBE382:
+.LBE381:
+	.loc 1 382 5 view .LVU887
+	.loc 1 382 14 is_stmt 0 view .LVU888
+	movl	%ebp, %esi
+	movq	%r15, %rdi
+	call	FLASH_ProgramWord@PLT
+.LVL253:
+	movl	%eax, %r12d
+.LVL254:
+	.loc 1 383 5 is_stmt 1 view .LVU889
+	call	FLASH_Lock@PLT
+.LVL255:
+	.loc 1 385 5 view .LVU890
+	.loc 1 385 37 is_stmt 0 view .LVU891
+	cmpl	$4, %r12d
+	jne	.L187
+	cmpl	(%r15), %ebp
+	jne	.L187
+.LVL256:
+	.loc 1 385 37 view .LVU892
+.LBE380:
+.LBE379:
+	.loc 1 430 5 is_stmt 1 view .LVU893
+	.loc 1 430 25 is_stmt 0 view .LVU894
+	movzbl	8(%rsp), %eax
+	.loc 1 434 5 view .LVU895
+	leaq	56(%r14), %rdi
+	.loc 1 431 23 view .LVU896
+	movw	%bx, 38(%r14)
+	.loc 1 434 5 view .LVU897
+	andq	$-8, %rdi
+	.loc 1 432 25 view .LVU898
+	movb	$1, 44(%r14)
+	.loc 1 430 25 view .LVU899
+	movb	%al, 36(%r14)
+	.loc 1 431 5 is_stmt 1 view .LVU900
+	.loc 1 432 5 view .LVU901
+	.loc 1 433 5 view .LVU902
+	.loc 1 434 5 is_stmt 0 view .LVU903
+	movl	%r14d, %eax
+	subl	%edi, %eax
+	.loc 1 433 26 view .LVU904
+	movb	$0, 180(%r14)
+	.loc 1 434 5 is_stmt 1 view .LVU905
+	leal	176(%rax), %ecx
+	xorl	%eax, %eax
+	movq	$0, 48(%r14)
+	movq	$0, 168(%r14)
+	shrl	$3, %ecx
+	rep stosq
+	.loc 1 435 5 view .LVU906
+.LVL257:
+.LBB383:
+.LBI383:
+	.loc 1 277 13 view .LVU907
+.LBB384:
+	.loc 1 279 5 view .LVU908
+	.loc 1 281 5 view .LVU909
+	.loc 1 281 27 view .LVU910
+	movq	%r14, %rax
+	.loc 1 281 36 is_stmt 0 view .LVU911
+	movzbl	32(%r14), %edx
+	leaq	(%r14,%rdx,8), %rcx
+	.loc 1 281 27 view .LVU912
+	testb	%dl, %dl
+	je	.L194
+.LVL258:
+	.p2align 4,,10
+	.p2align 3
+.L193:
+	.loc 1 282 9 is_stmt 1 view .LVU913
+	.loc 1 282 29 is_stmt 0 view .LVU914
+	movq	216(%rax), %rdx
+	.loc 1 282 12 view .LVU915
+	testq	%rdx, %rdx
+	je	.L192
+	.loc 1 283 13 is_stmt 1 view .LVU916
+	.loc 1 283 36 is_stmt 0 view .LVU917
+	movq	%rdx, 48(%rax)
+.L192:
+	.loc 1 281 57 is_stmt 1 view .LVU918
+.LVL259:
+	.loc 1 281 27 view .LVU919
+	addq	$8, %rax
+.LVL260:
+	.loc 1 281 27 is_stmt 0 view .LVU920
+	cmpq	%rcx, %rax
+	jne	.L193
+.LVL261:
+.L194:
+	.loc 1 287 5 is_stmt 1 view .LVU921
+	.loc 1 287 33 is_stmt 0 view .LVU922
+	movl	204(%r14), %esi
+	.loc 1 288 5 is_stmt 1 view .LVU923
+	.loc 1 289 5 view .LVU924
+	.loc 1 290 1 is_stmt 0 view .LVU925
+	jmp	.L189
+.LBE384:
+.LBE383:
+.LBE388:
+.LBE472:
+.LBE480:
+.LBE488:
+	.cfi_endproc
+.LFE26:
+	.size	configStorageProcess, .-configStorageProcess
+	.section	.text.configStorageIsSaving,"ax",@progbits
+	.p2align 4
+	.globl	configStorageIsSaving
+	.type	configStorageIsSaving, @function
+configStorageIsSaving:
+.LVL262:
+.LFB27:
+	.loc 1 538 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 539 5 view .LVU927
+	xorl	%eax, %eax
+	.loc 1 539 26 is_stmt 0 view .LVU928
+	cmpq	$0, 192(%rdi)
+	je	.L242
+	.loc 1 539 26 discriminator 1 view .LVU929
+	cmpl	$3, 176(%rdi)
+	setne	%al
+.L242:
+	.loc 1 540 1 view .LVU930
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	configStorageIsSaving, .-configStorageIsSaving
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/include/stdint.h"
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 7 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 8 ".//src/main/config/config_storage.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 ".//src/main/common/crc.h"
+	.file 11 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1a02
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF883
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL171
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF770
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF771
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF772
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF773
+	.uleb128 0x7
+	.long	.LASF775
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF774
+	.uleb128 0x7
+	.long	.LASF776
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x7
+	.long	.LASF777
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF778
+	.uleb128 0x7
+	.long	.LASF779
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	.LASF780
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF781
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF782
+	.uleb128 0x7
+	.long	.LASF783
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x7
+	.long	.LASF784
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x7
+	.long	.LASF785
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x1c
+	.long	0xc3
+	.uleb128 0x7
+	.long	.LASF786
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF787
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x1c
+	.long	0xe0
+	.uleb128 0x7
+	.long	.LASF788
+	.byte	0x5
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x7
+	.long	.LASF789
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0x21
+	.long	0x3c
+	.byte	0x7
+	.byte	0x3d
+	.long	0x133
+	.uleb128 0x12
+	.long	.LASF790
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF791
+	.byte	0x2
+	.uleb128 0x12
+	.long	.LASF792
+	.byte	0x3
+	.uleb128 0x12
+	.long	.LASF793
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF794
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF795
+	.byte	0x7
+	.byte	0x43
+	.byte	0x3
+	.long	0x109
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF796
+	.uleb128 0x31
+	.long	.LASF804
+	.byte	0x4
+	.byte	0x8
+	.byte	0x33
+	.byte	0x10
+	.long	0x16c
+	.uleb128 0x32
+	.string	"id"
+	.byte	0x8
+	.byte	0x34
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF797
+	.byte	0x35
+	.byte	0xe
+	.long	0xd4
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF798
+	.byte	0x8
+	.byte	0x36
+	.byte	0x3
+	.long	0x146
+	.uleb128 0x1c
+	.long	0x16c
+	.uleb128 0x21
+	.long	0x3c
+	.byte	0x8
+	.byte	0x38
+	.long	0x1a1
+	.uleb128 0x12
+	.long	.LASF799
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF800
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF801
+	.byte	0x2
+	.uleb128 0x12
+	.long	.LASF802
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF803
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x3
+	.long	0x17d
+	.uleb128 0x33
+	.long	.LASF805
+	.value	0x158
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x10
+	.long	0x2c4
+	.uleb128 0x4
+	.long	.LASF806
+	.byte	0x40
+	.byte	0xf
+	.long	0xf1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF807
+	.byte	0x41
+	.byte	0xe
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF808
+	.byte	0x42
+	.byte	0xe
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF809
+	.byte	0x43
+	.byte	0xe
+	.long	0xe0
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF810
+	.byte	0x44
+	.byte	0x23
+	.long	0x2c4
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF811
+	.byte	0x45
+	.byte	0xd
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF812
+	.byte	0x46
+	.byte	0xe
+	.long	0xd4
+	.byte	0x22
+	.uleb128 0x4
+	.long	.LASF813
+	.byte	0x48
+	.byte	0xc
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF814
+	.byte	0x49
+	.byte	0xe
+	.long	0xd4
+	.byte	0x26
+	.uleb128 0x4
+	.long	.LASF815
+	.byte	0x4a
+	.byte	0xe
+	.long	0xe0
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF816
+	.byte	0x4b
+	.byte	0x9
+	.long	0x2c9
+	.byte	0x2c
+	.uleb128 0x4
+	.long	.LASF817
+	.byte	0x4c
+	.byte	0x14
+	.long	0x2d0
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF818
+	.byte	0x4e
+	.byte	0x1a
+	.long	0x1a1
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF819
+	.byte	0x4f
+	.byte	0x9
+	.long	0x2c9
+	.byte	0xb4
+	.uleb128 0x4
+	.long	.LASF820
+	.byte	0x50
+	.byte	0xe
+	.long	0xe0
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF821
+	.byte	0x51
+	.byte	0xd
+	.long	0xc3
+	.byte	0xbc
+	.uleb128 0x4
+	.long	.LASF822
+	.byte	0x54
+	.byte	0x14
+	.long	0x2e0
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF823
+	.byte	0x55
+	.byte	0x9
+	.long	0x2c9
+	.byte	0xc8
+	.uleb128 0x4
+	.long	.LASF824
+	.byte	0x56
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc9
+	.uleb128 0x4
+	.long	.LASF825
+	.byte	0x57
+	.byte	0xe
+	.long	0xe0
+	.byte	0xcc
+	.uleb128 0x4
+	.long	.LASF826
+	.byte	0x58
+	.byte	0xe
+	.long	0xe0
+	.byte	0xd0
+	.uleb128 0x4
+	.long	.LASF827
+	.byte	0x59
+	.byte	0x14
+	.long	0x2d0
+	.byte	0xd8
+	.byte	0
+	.uleb128 0x16
+	.long	0x178
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF828
+	.uleb128 0x34
+	.long	0x2e0
+	.long	0x2e0
+	.uleb128 0x35
+	.long	0x43
+	.byte	0xf
+	.byte	0
+	.uleb128 0x16
+	.long	0xcf
+	.uleb128 0x7
+	.long	.LASF829
+	.byte	0x8
+	.byte	0x5a
+	.byte	0x3
+	.long	0x1ad
+	.uleb128 0x1c
+	.long	0x2e5
+	.uleb128 0x19
+	.long	.LASF832
+	.byte	0x7
+	.byte	0x48
+	.byte	0xe
+	.long	0x133
+	.long	0x311
+	.uleb128 0xa
+	.long	0xf1
+	.uleb128 0xa
+	.long	0xe0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF830
+	.byte	0x45
+	.uleb128 0x22
+	.long	.LASF831
+	.byte	0x46
+	.uleb128 0x19
+	.long	.LASF833
+	.byte	0x7
+	.byte	0x47
+	.byte	0xe
+	.long	0x133
+	.long	0x333
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF834
+	.byte	0x9
+	.byte	0x40
+	.byte	0xc
+	.long	0x88
+	.long	0x353
+	.uleb128 0xa
+	.long	0x353
+	.uleb128 0xa
+	.long	0x353
+	.uleb128 0xa
+	.long	0xfd
+	.byte	0
+	.uleb128 0x16
+	.long	0x358
+	.uleb128 0x36
+	.uleb128 0x19
+	.long	.LASF835
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0xa2
+	.long	0x379
+	.uleb128 0xa
+	.long	0xa2
+	.uleb128 0xa
+	.long	0x353
+	.uleb128 0xa
+	.long	0xfd
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF836
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xa
+	.long	0xe0
+	.long	0x399
+	.uleb128 0xa
+	.long	0xe0
+	.uleb128 0xa
+	.long	0x399
+	.uleb128 0xa
+	.long	0xe0
+	.byte	0
+	.uleb128 0x16
+	.long	0xec
+	.uleb128 0x19
+	.long	.LASF837
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa2
+	.long	0x3be
+	.uleb128 0xa
+	.long	0xa2
+	.uleb128 0xa
+	.long	0x88
+	.uleb128 0xa
+	.long	0xfd
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF838
+	.value	0x219
+	.byte	0x5
+	.long	0x2c9
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f0
+	.uleb128 0x37
+	.long	.LASF840
+	.byte	0x1
+	.value	0x219
+	.byte	0x32
+	.long	0x3f0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x16
+	.long	0x2f1
+	.uleb128 0x23
+	.long	.LASF839
+	.value	0x1fb
+	.byte	0x16
+	.long	0x1a1
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xca6
+	.uleb128 0x17
+	.long	.LASF840
+	.value	0x1fb
+	.byte	0x3c
+	.long	0xca6
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x17
+	.long	.LASF841
+	.value	0x1fb
+	.byte	0x49
+	.long	0x2c9
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x5
+	.long	0xcab
+	.quad	.LBI345
+	.value	.LVU588
+	.long	.LLRL105
+	.value	0x20e
+	.byte	0xd
+	.long	0xc84
+	.uleb128 0x1
+	.long	0xcb6
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x8
+	.long	.LLRL105
+	.uleb128 0x2
+	.long	0xcc2
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x2
+	.long	0xcce
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x24
+	.long	0xcda
+	.uleb128 0x2
+	.long	0xce6
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x2
+	.long	0xcf2
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x2
+	.long	0xcfe
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x2
+	.long	0xd0a
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x5
+	.long	0xd25
+	.quad	.LBI347
+	.value	.LVU837
+	.long	.LLRL113
+	.value	0x1f0
+	.byte	0x9
+	.long	0x783
+	.uleb128 0x1
+	.long	0xd30
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x8
+	.long	.LLRL113
+	.uleb128 0x2
+	.long	0xd3c
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x2
+	.long	0xd48
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x5
+	.long	0xe15
+	.quad	.LBI349
+	.value	.LVU717
+	.long	.LLRL117
+	.value	0x1aa
+	.byte	0x9
+	.long	0x540
+	.uleb128 0x1
+	.long	0xe20
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x14
+	.quad	.LVL208
+	.long	0xe2d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1867
+	.quad	.LBI353
+	.value	.LVU839
+	.long	.LLRL119
+	.value	0x1a1
+	.byte	0x14
+	.long	0x568
+	.uleb128 0x1
+	.long	0x1876
+	.long	.LLST120
+	.long	.LVUS120
+	.byte	0
+	.uleb128 0x5
+	.long	0x1882
+	.quad	.LBI359
+	.value	.LVU853
+	.long	.LLRL121
+	.value	0x1a8
+	.byte	0x16
+	.long	0x595
+	.uleb128 0xd
+	.long	0x189c
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST122
+	.long	.LVUS122
+	.byte	0
+	.uleb128 0xe
+	.long	0xd79
+	.quad	.LBI363
+	.value	.LVU857
+	.quad	.LBB363
+	.quad	.LBE363-.LBB363
+	.value	0x1a8
+	.byte	0xa
+	.long	0x642
+	.uleb128 0x1
+	.long	0xd95
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0xd89
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x2
+	.long	0xda1
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0xe
+	.long	0xdae
+	.quad	.LBI365
+	.value	.LVU860
+	.quad	.LBB365
+	.quad	.LBE365-.LBB365
+	.value	0x17d
+	.byte	0x5
+	.long	0x616
+	.uleb128 0x9
+	.quad	.LVL246
+	.long	0x311
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL247
+	.long	0x2f6
+	.long	0x634
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL249
+	.long	0x317
+	.byte	0
+	.uleb128 0x5
+	.long	0x1778
+	.quad	.LBI367
+	.value	.LVU869
+	.long	.LLRL126
+	.value	0x1a9
+	.byte	0x11
+	.long	0x66a
+	.uleb128 0x1
+	.long	0x1787
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0x5
+	.long	0x1882
+	.quad	.LBI371
+	.value	.LVU879
+	.long	.LLRL128
+	.value	0x1a9
+	.byte	0x11
+	.long	0x697
+	.uleb128 0xd
+	.long	0x189c
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.uleb128 0xe
+	.long	0xd79
+	.quad	.LBI379
+	.value	.LVU882
+	.quad	.LBB379
+	.quad	.LBE379-.LBB379
+	.value	0x1a9
+	.byte	0x11
+	.long	0x744
+	.uleb128 0x1
+	.long	0xd95
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x1
+	.long	0xd89
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x2
+	.long	0xda1
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0xe
+	.long	0xdae
+	.quad	.LBI381
+	.value	.LVU885
+	.quad	.LBB381
+	.quad	.LBE381-.LBB381
+	.value	0x17d
+	.byte	0x5
+	.long	0x718
+	.uleb128 0x9
+	.quad	.LVL252
+	.long	0x311
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL253
+	.long	0x2f6
+	.long	0x736
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL255
+	.long	0x317
+	.byte	0
+	.uleb128 0x25
+	.long	0xf7b
+	.quad	.LBI383
+	.value	.LVU907
+	.quad	.LBB383
+	.quad	.LBE383-.LBB383
+	.value	0x1b3
+	.byte	0x5
+	.uleb128 0x1
+	.long	0xf86
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x2
+	.long	0xf92
+	.long	.LLST134
+	.long	.LVUS134
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x181b
+	.quad	.LBI389
+	.value	.LVU605
+	.long	.LLRL135
+	.value	0x1ba
+	.byte	0x15
+	.long	0x7cb
+	.uleb128 0x1
+	.long	0x1835
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x8
+	.long	.LLRL135
+	.uleb128 0x2
+	.long	0x1840
+	.long	.LLST138
+	.long	.LVUS138
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x184c
+	.quad	.LBI399
+	.value	.LVU614
+	.long	.LLRL139
+	.value	0x1bb
+	.byte	0x18
+	.long	0x84a
+	.uleb128 0x1
+	.long	0x185b
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x18
+	.long	0x1867
+	.quad	.LBI401
+	.value	.LVU618
+	.long	.LLRL141
+	.byte	0x38
+	.byte	0x37
+	.long	0x819
+	.uleb128 0x1
+	.long	0x1876
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.uleb128 0x1d
+	.long	0x1882
+	.quad	.LBI407
+	.value	.LVU622
+	.long	.LLRL143
+	.byte	0x38
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x189c
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x1800
+	.quad	.LBI416
+	.value	.LVU638
+	.quad	.LBB416
+	.quad	.LBE416-.LBB416
+	.value	0x1c0
+	.byte	0x3d
+	.long	0x876
+	.uleb128 0xd
+	.long	0x180f
+	.byte	0
+	.uleb128 0x26
+	.long	0xd16
+	.long	.LLRL146
+	.long	0x94c
+	.uleb128 0x27
+	.long	0xd17
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x1e
+	.long	0xe15
+	.long	.LLRL147
+	.value	0x1d1
+	.byte	0xd
+	.long	0x8a2
+	.uleb128 0xd
+	.long	0xe20
+	.byte	0
+	.uleb128 0x25
+	.long	0xd79
+	.quad	.LBI423
+	.value	.LVU749
+	.quad	.LBB423
+	.quad	.LBE423-.LBB423
+	.value	0x1d0
+	.byte	0xe
+	.uleb128 0x1
+	.long	0xd95
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x1
+	.long	0xd89
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x2
+	.long	0xda1
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xe
+	.long	0xdae
+	.quad	.LBI425
+	.value	.LVU752
+	.quad	.LBB425
+	.quad	.LBE425-.LBB425
+	.value	0x17d
+	.byte	0x5
+	.long	0x91f
+	.uleb128 0x9
+	.quad	.LVL214
+	.long	0x311
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL215
+	.long	0x2f6
+	.long	0x93d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL217
+	.long	0x317
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xf9f
+	.quad	.LBI429
+	.value	.LVU663
+	.quad	.LBB429
+	.quad	.LBE429-.LBB429
+	.value	0x1de
+	.byte	0xc
+	.long	0x9aa
+	.uleb128 0x1
+	.long	0xfbb
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x1
+	.long	0xfaf
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x14
+	.quad	.LVL192
+	.long	0xfc8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x17da
+	.quad	.LBI431
+	.value	.LVU676
+	.long	.LLRL153
+	.value	0x1df
+	.byte	0xe
+	.long	0x9d7
+	.uleb128 0xd
+	.long	0x17f4
+	.uleb128 0x1
+	.long	0x17e9
+	.long	.LLST154
+	.long	.LVUS154
+	.byte	0
+	.uleb128 0x5
+	.long	0x1793
+	.quad	.LBI437
+	.value	.LVU689
+	.long	.LLRL155
+	.value	0x1e1
+	.byte	0xa
+	.long	0xa77
+	.uleb128 0xd
+	.long	0x17b8
+	.uleb128 0x1
+	.long	0x17ad
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x1
+	.long	0x17a2
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x8
+	.long	.LLRL155
+	.uleb128 0x2
+	.long	0x17c3
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x2
+	.long	0x17ce
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x15
+	.quad	.LVL198
+	.long	0x379
+	.long	0xa53
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL199
+	.long	0x379
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x24
+	.byte	0x8
+	.byte	0x31
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xd79
+	.quad	.LBI447
+	.value	.LVU702
+	.long	.LLRL160
+	.value	0x1e1
+	.byte	0xa
+	.long	0xb20
+	.uleb128 0x1
+	.long	0xd95
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x1
+	.long	0xd89
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x8
+	.long	.LLRL160
+	.uleb128 0x2
+	.long	0xda1
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0xe
+	.long	0xdae
+	.quad	.LBI449
+	.value	.LVU705
+	.quad	.LBB449
+	.quad	.LBE449-.LBB449
+	.value	0x17d
+	.byte	0x5
+	.long	0xaf1
+	.uleb128 0x9
+	.quad	.LVL202
+	.long	0x311
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL203
+	.long	0x2f6
+	.long	0xb11
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL205
+	.long	0x317
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xe15
+	.quad	.LBI455
+	.value	.LVU767
+	.quad	.LBB455
+	.quad	.LBE455-.LBB455
+	.value	0x1da
+	.byte	0x9
+	.long	0xb54
+	.uleb128 0x1
+	.long	0xe20
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.uleb128 0xe
+	.long	0xd79
+	.quad	.LBI459
+	.value	.LVU790
+	.quad	.LBB459
+	.quad	.LBE459-.LBB459
+	.value	0x1e1
+	.byte	0x4b
+	.long	0xc01
+	.uleb128 0x1
+	.long	0xd95
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x1
+	.long	0xd89
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x2
+	.long	0xda1
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0xe
+	.long	0xdae
+	.quad	.LBI461
+	.value	.LVU793
+	.quad	.LBB461
+	.quad	.LBE461-.LBB461
+	.value	0x17d
+	.byte	0x5
+	.long	0xbd5
+	.uleb128 0x9
+	.quad	.LVL227
+	.long	0x311
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL228
+	.long	0x2f6
+	.long	0xbf3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL230
+	.long	0x317
+	.byte	0
+	.uleb128 0x5
+	.long	0x1800
+	.quad	.LBI463
+	.value	.LVU806
+	.long	.LLRL168
+	.value	0x1e7
+	.byte	0x1e
+	.long	0xc21
+	.uleb128 0xd
+	.long	0x180f
+	.byte	0
+	.uleb128 0x1e
+	.long	0xf7b
+	.long	.LLRL169
+	.value	0x1f2
+	.byte	0x9
+	.long	0xc4a
+	.uleb128 0xd
+	.long	0xf86
+	.uleb128 0x8
+	.long	.LLRL169
+	.uleb128 0x2
+	.long	0xf92
+	.long	.LLST170
+	.long	.LVUS170
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL190
+	.long	0x19f3
+	.long	0xc6e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL224
+	.long	0xe2d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL167
+	.long	0xd55
+	.uleb128 0x14
+	.quad	.LVL222
+	.long	0xd55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x2e5
+	.uleb128 0x1a
+	.long	.LASF849
+	.value	0x1b6
+	.long	0xd25
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x1b6
+	.byte	0x28
+	.long	0xca6
+	.uleb128 0xc
+	.long	.LASF842
+	.value	0x1b8
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF843
+	.value	0x1b9
+	.byte	0x14
+	.long	0x2e0
+	.uleb128 0xc
+	.long	.LASF812
+	.value	0x1ba
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0xc
+	.long	.LASF844
+	.value	0x1bb
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0xc
+	.long	.LASF845
+	.value	0x1bc
+	.byte	0x14
+	.long	0x2e0
+	.uleb128 0xc
+	.long	.LASF846
+	.value	0x1bd
+	.byte	0xe
+	.long	0xe0
+	.uleb128 0xc
+	.long	.LASF847
+	.value	0x1be
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF848
+	.value	0x1cd
+	.byte	0x12
+	.long	0xe0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF850
+	.value	0x19f
+	.long	0xd55
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x19f
+	.byte	0x32
+	.long	0xca6
+	.uleb128 0xc
+	.long	.LASF851
+	.value	0x1a1
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF814
+	.value	0x1a2
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF852
+	.value	0x184
+	.long	0xd79
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x184
+	.byte	0x28
+	.long	0xca6
+	.uleb128 0xc
+	.long	.LASF853
+	.value	0x186
+	.byte	0x12
+	.long	0x133
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF857
+	.value	0x179
+	.byte	0xc
+	.long	0x2c9
+	.long	0xdae
+	.uleb128 0x13
+	.long	.LASF806
+	.value	0x179
+	.byte	0x22
+	.long	0xf1
+	.uleb128 0x13
+	.long	.LASF848
+	.value	0x179
+	.byte	0x34
+	.long	0xe0
+	.uleb128 0xc
+	.long	.LASF853
+	.value	0x17b
+	.byte	0x12
+	.long	0x133
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF884
+	.byte	0x1
+	.value	0x16e
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x39
+	.long	.LASF859
+	.byte	0x1
+	.value	0x166
+	.byte	0x6
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe15
+	.uleb128 0x17
+	.long	.LASF840
+	.value	0x166
+	.byte	0x2e
+	.long	0xca6
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x17
+	.long	.LASF822
+	.value	0x166
+	.byte	0x43
+	.long	0x353
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x29
+	.quad	.LVL162
+	.long	0xe2d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF854
+	.value	0x150
+	.long	0xe2d
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x150
+	.byte	0x2a
+	.long	0xca6
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF885
+	.byte	0x1
+	.value	0x124
+	.byte	0xd
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf7b
+	.uleb128 0x17
+	.long	.LASF840
+	.value	0x124
+	.byte	0x28
+	.long	0xca6
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2a
+	.long	.LASF855
+	.value	0x126
+	.byte	0xe
+	.long	0xe0
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2a
+	.long	.LASF842
+	.value	0x127
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x5
+	.long	0x181b
+	.quad	.LBI81
+	.value	.LVU64
+	.long	.LLRL9
+	.value	0x130
+	.byte	0x2a
+	.long	0xec8
+	.uleb128 0xd
+	.long	0x1835
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x8
+	.long	.LLRL9
+	.uleb128 0x2
+	.long	0x1840
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1800
+	.quad	.LBI85
+	.value	.LVU48
+	.long	.LLRL12
+	.value	0x130
+	.byte	0x1f
+	.long	0xee8
+	.uleb128 0xd
+	.long	0x180f
+	.byte	0
+	.uleb128 0x1e
+	.long	0xf7b
+	.long	.LLRL13
+	.value	0x13c
+	.byte	0xd
+	.long	0xf11
+	.uleb128 0xd
+	.long	0xf86
+	.uleb128 0x8
+	.long	.LLRL13
+	.uleb128 0x2
+	.long	0xf92
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xf9f
+	.quad	.LBI95
+	.value	.LVU97
+	.long	.LLRL15
+	.value	0x13a
+	.byte	0x21
+	.long	0xf60
+	.uleb128 0x1
+	.long	0xfbb
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1
+	.long	0xfaf
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x14
+	.quad	.LVL29
+	.long	0xfc8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL18
+	.long	0xfc8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF856
+	.value	0x115
+	.long	0xf9f
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x115
+	.byte	0x2b
+	.long	0xca6
+	.uleb128 0xc
+	.long	.LASF842
+	.value	0x117
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF858
+	.value	0x10d
+	.byte	0x10
+	.long	0xc3
+	.long	0xfc8
+	.uleb128 0x13
+	.long	.LASF840
+	.value	0x10d
+	.byte	0x3a
+	.long	0x3f0
+	.uleb128 0x13
+	.long	.LASF842
+	.value	0x10d
+	.byte	0x4b
+	.long	0xc3
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF886
+	.byte	0x1
+	.value	0x106
+	.byte	0xc
+	.long	0x2c9
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1069
+	.uleb128 0x17
+	.long	.LASF840
+	.value	0x106
+	.byte	0x34
+	.long	0x3f0
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x17
+	.long	.LASF842
+	.value	0x106
+	.byte	0x45
+	.long	0xc3
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.long	0x181b
+	.quad	.LBI67
+	.value	.LVU6
+	.long	.LLRL2
+	.value	0x109
+	.byte	0x5c
+	.long	0x105b
+	.uleb128 0x1
+	.long	0x1835
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.long	.LLRL2
+	.uleb128 0x2
+	.long	0x1840
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL6
+	.long	0x19f3
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF860
+	.byte	0xfb
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1114
+	.uleb128 0xf
+	.long	.LASF840
+	.byte	0xfb
+	.byte	0x2f
+	.long	0x3f0
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0xf
+	.long	.LASF822
+	.byte	0xfb
+	.byte	0x3e
+	.long	0xa2
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1b
+	.long	.LASF842
+	.byte	0xfd
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x5
+	.long	0x181b
+	.quad	.LBI268
+	.value	.LVU551
+	.long	.LLRL97
+	.value	0x101
+	.byte	0x5f
+	.long	0x1106
+	.uleb128 0x1
+	.long	0x1835
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x8
+	.long	.LLRL97
+	.uleb128 0x2
+	.long	0x1840
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL151
+	.long	0x19fc
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF861
+	.byte	0x1
+	.byte	0xed
+	.byte	0x9
+	.long	0xc3
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1170
+	.uleb128 0xf
+	.long	.LASF840
+	.byte	0xed
+	.byte	0x40
+	.long	0x3f0
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x1b
+	.long	.LASF862
+	.byte	0xef
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x1b
+	.long	.LASF842
+	.byte	0xf0
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF863
+	.byte	0xc5
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x164a
+	.uleb128 0xf
+	.long	.LASF840
+	.byte	0xc5
+	.byte	0x29
+	.long	0xca6
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xf
+	.long	.LASF806
+	.byte	0xc5
+	.byte	0x3c
+	.long	0xf1
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0xf
+	.long	.LASF807
+	.byte	0xc5
+	.byte	0x4e
+	.long	0xe0
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xf
+	.long	.LASF808
+	.byte	0xc5
+	.byte	0x61
+	.long	0xd4
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xf
+	.long	.LASF809
+	.byte	0xc6
+	.byte	0x12
+	.long	0xe0
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0xf
+	.long	.LASF810
+	.byte	0xc6
+	.byte	0x38
+	.long	0x2c4
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xf
+	.long	.LASF811
+	.byte	0xc6
+	.byte	0x4a
+	.long	0xc3
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xf
+	.long	.LASF812
+	.byte	0xc6
+	.byte	0x61
+	.long	0xd4
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1b
+	.long	.LASF814
+	.byte	0xc8
+	.byte	0xe
+	.long	0xd4
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1b
+	.long	.LASF851
+	.byte	0xc9
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x20
+	.long	0x1737
+	.quad	.LBI177
+	.value	.LVU260
+	.quad	.LBB177
+	.quad	.LBE177-.LBB177
+	.byte	0xda
+	.byte	0xe
+	.long	0x130c
+	.uleb128 0x1
+	.long	0x1746
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x175c
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0x1751
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x1767
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x20
+	.long	0x1882
+	.quad	.LBI179
+	.value	.LVU262
+	.quad	.LBB179
+	.quad	.LBE179-.LBB179
+	.byte	0x69
+	.byte	0x44
+	.long	0x12db
+	.uleb128 0x1
+	.long	0x189c
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xd
+	.long	0x1891
+	.byte	0
+	.uleb128 0x3d
+	.long	0x1778
+	.quad	.LBI181
+	.value	.LVU269
+	.quad	.LBB181
+	.quad	.LBE181-.LBB181
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x1787
+	.long	.LLST44
+	.long	.LVUS44
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x1867
+	.quad	.LBI184
+	.value	.LVU294
+	.long	.LLRL45
+	.byte	0xe8
+	.byte	0x3a
+	.long	0x1333
+	.uleb128 0x1
+	.long	0x1876
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.uleb128 0x18
+	.long	0x1882
+	.quad	.LBI192
+	.value	.LVU297
+	.long	.LLRL47
+	.byte	0xe8
+	.byte	0x1c
+	.long	0x1367
+	.uleb128 0x1
+	.long	0x189c
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x18
+	.long	0x1706
+	.quad	.LBI201
+	.value	.LVU303
+	.long	.LLRL50
+	.byte	0xe8
+	.byte	0x1c
+	.long	0x13ae
+	.uleb128 0x1
+	.long	0x1720
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x1
+	.long	0x1715
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x8
+	.long	.LLRL50
+	.uleb128 0x2
+	.long	0x172b
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x164a
+	.quad	.LBI206
+	.value	.LVU323
+	.long	.LLRL54
+	.byte	0xe5
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x1657
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x8
+	.long	.LLRL54
+	.uleb128 0x2
+	.long	0x1662
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x27
+	.long	0x166d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x2
+	.long	0x1678
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x2
+	.long	0x1683
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x2
+	.long	0x168e
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x18
+	.long	0x1882
+	.quad	.LBI208
+	.value	.LVU325
+	.long	.LLRL60
+	.byte	0x91
+	.byte	0x16
+	.long	0x1446
+	.uleb128 0x1
+	.long	0x189c
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.uleb128 0x3e
+	.long	0x1699
+	.long	.LLRL63
+	.uleb128 0x2
+	.long	0x169a
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2
+	.long	0x16a5
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x2
+	.long	0x16b0
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	0x16bb
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x18
+	.long	0x1793
+	.quad	.LBI215
+	.value	.LVU380
+	.long	.LLRL68
+	.byte	0xae
+	.byte	0xd
+	.long	0x152b
+	.uleb128 0x1
+	.long	0x17b8
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1
+	.long	0x17ad
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x1
+	.long	0x17a2
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x8
+	.long	.LLRL72
+	.uleb128 0x2
+	.long	0x17c3
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x2
+	.long	0x17ce
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x15
+	.quad	.LVL97
+	.long	0x379
+	.long	0x1507
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL98
+	.long	0x379
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x24
+	.byte	0x8
+	.byte	0x31
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	0x1800
+	.quad	.LBI221
+	.value	.LVU369
+	.quad	.LBB221
+	.quad	.LBE221-.LBB221
+	.byte	0xaa
+	.byte	0x23
+	.long	0x155e
+	.uleb128 0x1
+	.long	0x180f
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x26
+	.long	0x16c6
+	.long	.LLRL76
+	.long	0x1603
+	.uleb128 0x2
+	.long	0x16c7
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x18
+	.long	0x16d5
+	.quad	.LBI225
+	.value	.LVU416
+	.long	.LLRL78
+	.byte	0xaf
+	.byte	0x1e
+	.long	0x15bf
+	.uleb128 0x1
+	.long	0x16ef
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1
+	.long	0x16e4
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x8
+	.long	.LLRL81
+	.uleb128 0x2
+	.long	0x16fa
+	.long	.LLST82
+	.long	.LVUS82
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x181b
+	.quad	.LBI230
+	.value	.LVU433
+	.long	.LLRL83
+	.byte	0xb0
+	.byte	0x29
+	.uleb128 0x1
+	.long	0x1835
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x1
+	.long	0x182a
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x8
+	.long	.LLRL83
+	.uleb128 0x2
+	.long	0x1840
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x1706
+	.quad	.LBI238
+	.value	.LVU478
+	.long	.LLRL87
+	.byte	0xa5
+	.byte	0x34
+	.uleb128 0x1
+	.long	0x1720
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x1
+	.long	0x1715
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x8
+	.long	.LLRL87
+	.uleb128 0x2
+	.long	0x172b
+	.long	.LLST90
+	.long	.LVUS90
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF864
+	.byte	0x1
+	.byte	0x8f
+	.byte	0xd
+	.byte	0x1
+	.long	0x16d5
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x8f
+	.byte	0x26
+	.long	0xca6
+	.uleb128 0xb
+	.long	.LASF851
+	.byte	0x91
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0xb
+	.long	.LASF865
+	.byte	0x92
+	.byte	0x14
+	.long	0x2d0
+	.uleb128 0xb
+	.long	.LASF866
+	.byte	0x93
+	.byte	0x9
+	.long	0x2c9
+	.uleb128 0xb
+	.long	.LASF797
+	.byte	0x94
+	.byte	0xe
+	.long	0xe0
+	.uleb128 0xb
+	.long	.LASF842
+	.byte	0x95
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF846
+	.byte	0x9e
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0x2c
+	.string	"crc"
+	.byte	0x9f
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0xb
+	.long	.LASF822
+	.byte	0xa0
+	.byte	0x18
+	.long	0x2e0
+	.uleb128 0xb
+	.long	.LASF812
+	.byte	0xa1
+	.byte	0x12
+	.long	0xd4
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF843
+	.byte	0xaf
+	.byte	0x14
+	.long	0xab
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF867
+	.byte	0x7f
+	.byte	0xf
+	.long	0xab
+	.long	0x1706
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x7f
+	.byte	0x32
+	.long	0x3f0
+	.uleb128 0x40
+	.string	"id"
+	.byte	0x1
+	.byte	0x7f
+	.byte	0x43
+	.long	0xc3
+	.uleb128 0xb
+	.long	.LASF842
+	.byte	0x81
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF868
+	.byte	0x73
+	.byte	0xc
+	.long	0x2c9
+	.long	0x1737
+	.uleb128 0x6
+	.long	.LASF806
+	.byte	0x73
+	.byte	0x1f
+	.long	0xf1
+	.uleb128 0x6
+	.long	.LASF869
+	.byte	0x73
+	.byte	0x31
+	.long	0xe0
+	.uleb128 0xb
+	.long	.LASF848
+	.byte	0x75
+	.byte	0x15
+	.long	0x399
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF870
+	.byte	0x67
+	.byte	0xc
+	.long	0x2c9
+	.long	0x1773
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x67
+	.byte	0x32
+	.long	0x3f0
+	.uleb128 0x6
+	.long	.LASF851
+	.byte	0x67
+	.byte	0x43
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF814
+	.byte	0x67
+	.byte	0x53
+	.long	0x1773
+	.uleb128 0xb
+	.long	.LASF848
+	.byte	0x69
+	.byte	0xe
+	.long	0xe0
+	.byte	0
+	.uleb128 0x16
+	.long	0xd4
+	.uleb128 0x10
+	.long	.LASF871
+	.byte	0x5e
+	.byte	0x11
+	.long	0xe0
+	.long	0x1793
+	.uleb128 0x6
+	.long	.LASF814
+	.byte	0x5e
+	.byte	0x25
+	.long	0xd4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF872
+	.byte	0x4d
+	.byte	0x11
+	.long	0xe0
+	.long	0x17da
+	.uleb128 0x6
+	.long	.LASF846
+	.byte	0x4d
+	.byte	0x24
+	.long	0xe0
+	.uleb128 0x6
+	.long	.LASF822
+	.byte	0x4d
+	.byte	0x3b
+	.long	0x2e0
+	.uleb128 0x6
+	.long	.LASF812
+	.byte	0x4d
+	.byte	0x4a
+	.long	0xd4
+	.uleb128 0xb
+	.long	.LASF848
+	.byte	0x4f
+	.byte	0x15
+	.long	0x399
+	.uleb128 0xb
+	.long	.LASF873
+	.byte	0x50
+	.byte	0xe
+	.long	0xe0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF874
+	.byte	0x47
+	.byte	0x11
+	.long	0xe0
+	.long	0x1800
+	.uleb128 0x6
+	.long	.LASF875
+	.byte	0x47
+	.byte	0x26
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF812
+	.byte	0x47
+	.byte	0x3b
+	.long	0xd4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF876
+	.byte	0x42
+	.byte	0x11
+	.long	0xe0
+	.long	0x181b
+	.uleb128 0x6
+	.long	.LASF812
+	.byte	0x42
+	.byte	0x25
+	.long	0xd4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF877
+	.byte	0x3b
+	.byte	0x11
+	.long	0xd4
+	.long	0x184c
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x3b
+	.byte	0x34
+	.long	0x3f0
+	.uleb128 0x6
+	.long	.LASF842
+	.byte	0x3b
+	.byte	0x45
+	.long	0xc3
+	.uleb128 0x2c
+	.string	"end"
+	.byte	0x3d
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF878
+	.byte	0x36
+	.byte	0x12
+	.long	0xf1
+	.long	0x1867
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x36
+	.byte	0x37
+	.long	0x3f0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF879
+	.byte	0x31
+	.byte	0x10
+	.long	0xc3
+	.long	0x1882
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x31
+	.byte	0x31
+	.long	0x3f0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF880
+	.byte	0x2c
+	.byte	0x12
+	.long	0xf1
+	.long	0x18a8
+	.uleb128 0x6
+	.long	.LASF840
+	.byte	0x2c
+	.byte	0x35
+	.long	0x3f0
+	.uleb128 0x6
+	.long	.LASF851
+	.byte	0x2c
+	.byte	0x46
+	.long	0xc3
+	.byte	0
+	.uleb128 0x41
+	.long	0xd55
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19f3
+	.uleb128 0x1
+	.long	0xd60
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x2
+	.long	0xd6c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x5
+	.long	0xdae
+	.quad	.LBI121
+	.value	.LVU156
+	.long	.LLRL20
+	.value	0x188
+	.byte	0x5
+	.long	0x1905
+	.uleb128 0x9
+	.quad	.LVL43
+	.long	0x311
+	.byte	0
+	.uleb128 0x5
+	.long	0x1867
+	.quad	.LBI125
+	.value	.LVU162
+	.long	.LLRL21
+	.value	0x189
+	.byte	0x33
+	.long	0x192d
+	.uleb128 0x1
+	.long	0x1876
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0x5
+	.long	0x1882
+	.quad	.LBI129
+	.value	.LVU165
+	.long	.LLRL23
+	.value	0x189
+	.byte	0x1e
+	.long	0x1962
+	.uleb128 0x1
+	.long	0x189c
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1
+	.long	0x1891
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.uleb128 0x5
+	.long	0xe15
+	.quad	.LBI135
+	.value	.LVU179
+	.long	.LLRL26
+	.value	0x18e
+	.byte	0xd
+	.long	0x199f
+	.uleb128 0x1
+	.long	0xe20
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x29
+	.quad	.LVL50
+	.long	0xe2d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xd55
+	.quad	.LBI141
+	.value	.LVU196
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.value	0x184
+	.byte	0xd
+	.long	0x19d8
+	.uleb128 0x1
+	.long	0xd60
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x24
+	.long	0xd6c
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL44
+	.long	0x31d
+	.uleb128 0x9
+	.quad	.LVL46
+	.long	0x317
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF834
+	.long	.LASF881
+	.uleb128 0x2d
+	.long	.LASF835
+	.long	.LASF882
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS103:
+	.uleb128 0
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU586
+	.uleb128 .LVU586
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 0
+.LLST103:
+	.byte	0x6
+	.quad	.LVL163
+	.byte	0x4
+	.uleb128 .LVL163-.LVL163
+	.uleb128 .LVL164-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL164-.LVL163
+	.uleb128 .LVL165-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL165-.LVL163
+	.uleb128 .LVL166-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.LVL163
+	.uleb128 .LVL167-1-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL167-1-.LVL163
+	.uleb128 .LVL168-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL168-.LVL163
+	.uleb128 .LVL169-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL169-.LVL163
+	.uleb128 .LVL170-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL170-.LVL163
+	.uleb128 .LVL171-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL163
+	.uleb128 .LVL175-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL175-.LVL163
+	.uleb128 .LVL187-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL187-.LVL163
+	.uleb128 .LVL188-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.LVL163
+	.uleb128 .LVL221-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL221-.LVL163
+	.uleb128 .LVL222-1-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL163
+	.uleb128 .LFE26-.LVL163
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS104:
+	.uleb128 0
+	.uleb128 .LVU575
+	.uleb128 .LVU575
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU581
+	.uleb128 .LVU581
+	.uleb128 .LVU585
+	.uleb128 .LVU585
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU773
+	.uleb128 .LVU773
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 0
+.LLST104:
+	.byte	0x6
+	.quad	.LVL163
+	.byte	0x4
+	.uleb128 .LVL163-.LVL163
+	.uleb128 .LVL164-.LVL163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-.LVL163
+	.uleb128 .LVL166-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL166-.LVL163
+	.uleb128 .LVL167-1-.LVL163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL167-1-.LVL163
+	.uleb128 .LVL168-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.LVL163
+	.uleb128 .LVL169-.LVL163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL169-.LVL163
+	.uleb128 .LVL171-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL163
+	.uleb128 .LVL174-.LVL163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL174-.LVL163
+	.uleb128 .LVL221-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL221-.LVL163
+	.uleb128 .LVL222-1-.LVL163
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL163
+	.uleb128 .LFE26-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU588
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU773
+	.uleb128 .LVU782
+	.uleb128 .LVU831
+	.uleb128 .LVU835
+	.uleb128 0
+.LLST106:
+	.byte	0x6
+	.quad	.LVL171
+	.byte	0x4
+	.uleb128 .LVL171-.LVL171
+	.uleb128 .LVL175-.LVL171
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL175-.LVL171
+	.uleb128 .LVL187-.LVL171
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL187-.LVL171
+	.uleb128 .LVL188-.LVL171
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL188-.LVL171
+	.uleb128 .LVL221-.LVL171
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL223-.LVL171
+	.uleb128 .LVL239-.LVL171
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL240-.LVL171
+	.uleb128 .LFE26-.LVL171
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU594
+	.uleb128 .LVU596
+	.uleb128 .LVU596
+	.uleb128 .LVU646
+	.uleb128 .LVU653
+	.uleb128 .LVU663
+	.uleb128 .LVU734
+	.uleb128 .LVU770
+	.uleb128 .LVU782
+	.uleb128 .LVU788
+.LLST107:
+	.byte	0x6
+	.quad	.LVL172
+	.byte	0x4
+	.uleb128 .LVL172-.LVL172
+	.uleb128 .LVL173-.LVL172
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL173-.LVL172
+	.uleb128 .LVL186-.LVL172
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL188-.LVL172
+	.uleb128 .LVL191-.LVL172
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL209-.LVL172
+	.uleb128 .LVL220-.LVL172
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL223-.LVL172
+	.uleb128 .LVL225-.LVL172
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU604
+	.uleb128 .LVU646
+	.uleb128 .LVU653
+	.uleb128 .LVU660
+	.uleb128 .LVU734
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU745
+	.uleb128 .LVU782
+	.uleb128 .LVU785
+.LLST108:
+	.byte	0x6
+	.quad	.LVL176
+	.byte	0x4
+	.uleb128 .LVL176-.LVL176
+	.uleb128 .LVL186-.LVL176
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL188-.LVL176
+	.uleb128 .LVL190-1-.LVL176
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL209-.LVL176
+	.uleb128 .LVL210-.LVL176
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL210-.LVL176
+	.uleb128 .LVL211-.LVL176
+	.uleb128 0xe
+	.byte	0x7f
+	.sleb128 2
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x7e
+	.sleb128 192
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.LVL176
+	.uleb128 .LVL224-1-.LVL176
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS109:
+	.uleb128 .LVU631
+	.uleb128 .LVU646
+	.uleb128 .LVU654
+	.uleb128 .LVU715
+	.uleb128 .LVU734
+	.uleb128 .LVU748
+	.uleb128 .LVU748
+	.uleb128 .LVU765
+	.uleb128 .LVU765
+	.uleb128 .LVU770
+	.uleb128 .LVU782
+	.uleb128 .LVU803
+	.uleb128 .LVU803
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU846
+.LLST109:
+	.byte	0x6
+	.quad	.LVL182
+	.byte	0x4
+	.uleb128 .LVL182-.LVL182
+	.uleb128 .LVL186-.LVL182
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL189-.LVL182
+	.uleb128 .LVL206-.LVL182
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL209-.LVL182
+	.uleb128 .LVL212-.LVL182
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL212-.LVL182
+	.uleb128 .LVL219-.LVL182
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL219-.LVL182
+	.uleb128 .LVL220-.LVL182
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL223-.LVL182
+	.uleb128 .LVL232-.LVL182
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL232-.LVL182
+	.uleb128 .LVL238-.LVL182
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL240-.LVL182
+	.uleb128 .LVL241-.LVL182
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU633
+	.uleb128 .LVU637
+	.uleb128 .LVU637
+	.uleb128 .LVU646
+	.uleb128 .LVU654
+	.uleb128 .LVU715
+	.uleb128 .LVU734
+	.uleb128 .LVU770
+	.uleb128 .LVU782
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU846
+.LLST110:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL184-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL184-.LVL183
+	.uleb128 .LVL186-.LVL183
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL189-.LVL183
+	.uleb128 .LVL206-.LVL183
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL209-.LVL183
+	.uleb128 .LVL220-.LVL183
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL223-.LVL183
+	.uleb128 .LVL238-.LVL183
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL240-.LVL183
+	.uleb128 .LVL241-.LVL183
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU687
+	.uleb128 .LVU715
+	.uleb128 .LVU788
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU857
+.LLST111:
+	.byte	0x6
+	.quad	.LVL196
+	.byte	0x4
+	.uleb128 .LVL196-.LVL196
+	.uleb128 .LVL206-.LVL196
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL225-.LVL196
+	.uleb128 .LVL238-.LVL196
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL240-.LVL196
+	.uleb128 .LVL245-.LVL196
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU674
+	.uleb128 .LVU715
+	.uleb128 .LVU788
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU853
+	.uleb128 .LVU853
+	.uleb128 .LVU862
+.LLST112:
+	.byte	0x6
+	.quad	.LVL194
+	.byte	0x4
+	.uleb128 .LVL194-.LVL194
+	.uleb128 .LVL206-.LVL194
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL225-.LVL194
+	.uleb128 .LVL238-.LVL194
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL240-.LVL194
+	.uleb128 .LVL244-.LVL194
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL244-.LVL194
+	.uleb128 .LVL246-1-.LVL194
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 201
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU837
+	.uleb128 0
+.LLST114:
+	.byte	0x8
+	.quad	.LVL240
+	.uleb128 .LFE26-.LVL240
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU841
+	.uleb128 .LVU846
+.LLST115:
+	.byte	0x8
+	.quad	.LVL240
+	.uleb128 .LVL241-.LVL240
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU848
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 0
+.LLST116:
+	.byte	0x6
+	.quad	.LVL242
+	.byte	0x4
+	.uleb128 .LVL242-.LVL242
+	.uleb128 .LVL243-.LVL242
+	.uleb128 0x7
+	.byte	0x7e
+	.sleb128 38
+	.byte	0x94
+	.byte	0x2
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL243-.LVL242
+	.uleb128 .LFE26-.LVL242
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU717
+	.uleb128 .LVU720
+.LLST118:
+	.byte	0x8
+	.quad	.LVL206
+	.uleb128 .LVL207-.LVL206
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU839
+	.uleb128 .LVU841
+.LLST120:
+	.byte	0x8
+	.quad	.LVL240
+	.uleb128 .LVL240-.LVL240
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU853
+	.uleb128 .LVU855
+.LLST122:
+	.byte	0x8
+	.quad	.LVL244
+	.uleb128 .LVL244-.LVL244
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU857
+	.uleb128 .LVU868
+.LLST123:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL250-.LVL245
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU857
+	.uleb128 .LVU868
+.LLST124:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL250-.LVL245
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU865
+	.uleb128 .LVU866
+	.uleb128 .LVU866
+	.uleb128 .LVU868
+.LLST125:
+	.byte	0x6
+	.quad	.LVL248
+	.byte	0x4
+	.uleb128 .LVL248-.LVL248
+	.uleb128 .LVL249-1-.LVL248
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-1-.LVL248
+	.uleb128 .LVL250-.LVL248
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU868
+	.uleb128 .LVU878
+.LLST127:
+	.byte	0x8
+	.quad	.LVL250
+	.uleb128 .LVL251-.LVL250
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU878
+	.uleb128 .LVU881
+.LLST129:
+	.byte	0x8
+	.quad	.LVL251
+	.uleb128 .LVL251-.LVL251
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU881
+	.uleb128 .LVU892
+.LLST130:
+	.byte	0x8
+	.quad	.LVL251
+	.uleb128 .LVL256-.LVL251
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU881
+	.uleb128 .LVU892
+.LLST131:
+	.byte	0x8
+	.quad	.LVL251
+	.uleb128 .LVL256-.LVL251
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU889
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU892
+.LLST132:
+	.byte	0x6
+	.quad	.LVL254
+	.byte	0x4
+	.uleb128 .LVL254-.LVL254
+	.uleb128 .LVL255-1-.LVL254
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL255-1-.LVL254
+	.uleb128 .LVL256-.LVL254
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU907
+	.uleb128 0
+.LLST133:
+	.byte	0x8
+	.quad	.LVL257
+	.uleb128 .LFE26-.LVL257
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU910
+	.uleb128 .LVU913
+	.uleb128 .LVU913
+	.uleb128 .LVU919
+	.uleb128 .LVU919
+	.uleb128 .LVU920
+	.uleb128 .LVU920
+	.uleb128 .LVU921
+.LLST134:
+	.byte	0x6
+	.quad	.LVL257
+	.byte	0x4
+	.uleb128 .LVL257-.LVL257
+	.uleb128 .LVL258-.LVL257
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL258-.LVL257
+	.uleb128 .LVL259-.LVL257
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL257
+	.uleb128 .LVL260-.LVL257
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.LVL257
+	.uleb128 .LVL261-.LVL257
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU605
+	.uleb128 .LVU612
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+.LLST136:
+	.byte	0x6
+	.quad	.LVL176
+	.byte	0x4
+	.uleb128 .LVL176-.LVL176
+	.uleb128 .LVL178-.LVL176
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL188-.LVL176
+	.uleb128 .LVL189-.LVL176
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU605
+	.uleb128 .LVU612
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+.LLST137:
+	.byte	0x6
+	.quad	.LVL176
+	.byte	0x4
+	.uleb128 .LVL176-.LVL176
+	.uleb128 .LVL178-.LVL176
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL188-.LVL176
+	.uleb128 .LVL189-.LVL176
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU608
+	.uleb128 .LVU612
+.LLST138:
+	.byte	0x8
+	.quad	.LVL177
+	.uleb128 .LVL178-.LVL177
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU614
+	.uleb128 .LVU625
+.LLST140:
+	.byte	0x8
+	.quad	.LVL178
+	.uleb128 .LVL181-.LVL178
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU618
+	.uleb128 .LVU620
+.LLST142:
+	.byte	0x8
+	.quad	.LVL179
+	.uleb128 .LVL179-.LVL179
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU621
+	.uleb128 .LVU625
+.LLST144:
+	.byte	0x8
+	.quad	.LVL180
+	.uleb128 .LVL181-.LVL180
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU621
+	.uleb128 .LVU625
+.LLST145:
+	.byte	0x8
+	.quad	.LVL180
+	.uleb128 .LVL181-.LVL180
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU749
+	.uleb128 .LVU759
+.LLST148:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL218-.LVL213
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU749
+	.uleb128 .LVU759
+.LLST149:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL218-.LVL213
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU756
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU759
+.LLST150:
+	.byte	0x6
+	.quad	.LVL216
+	.byte	0x4
+	.uleb128 .LVL216-.LVL216
+	.uleb128 .LVL217-1-.LVL216
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL217-1-.LVL216
+	.uleb128 .LVL218-.LVL216
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU663
+	.uleb128 .LVU674
+.LLST151:
+	.byte	0x8
+	.quad	.LVL191
+	.uleb128 .LVL194-.LVL191
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU663
+	.uleb128 .LVU674
+.LLST152:
+	.byte	0x8
+	.quad	.LVL191
+	.uleb128 .LVL194-.LVL191
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU676
+	.uleb128 .LVU682
+.LLST154:
+	.byte	0x8
+	.quad	.LVL194
+	.uleb128 .LVL195-.LVL194
+	.uleb128 0x13
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x29
+	.byte	0x37
+	.byte	0x24
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU689
+	.uleb128 .LVU700
+.LLST156:
+	.byte	0x8
+	.quad	.LVL197
+	.uleb128 .LVL200-.LVL197
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU689
+	.uleb128 .LVU700
+.LLST157:
+	.byte	0x8
+	.quad	.LVL197
+	.uleb128 .LVL200-.LVL197
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU691
+	.uleb128 .LVU715
+	.uleb128 .LVU788
+	.uleb128 .LVU829
+	.uleb128 .LVU835
+	.uleb128 .LVU846
+.LLST158:
+	.byte	0x6
+	.quad	.LVL197
+	.byte	0x4
+	.uleb128 .LVL197-.LVL197
+	.uleb128 .LVL206-.LVL197
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL225-.LVL197
+	.uleb128 .LVL238-.LVL197
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL240-.LVL197
+	.uleb128 .LVL241-.LVL197
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU692
+	.uleb128 .LVU700
+.LLST159:
+	.byte	0x8
+	.quad	.LVL197
+	.uleb128 .LVL200-.LVL197
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x32
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU702
+	.uleb128 .LVU707
+	.uleb128 .LVU707
+	.uleb128 .LVU715
+	.uleb128 .LVU788
+	.uleb128 .LVU789
+.LLST161:
+	.byte	0x6
+	.quad	.LVL201
+	.byte	0x4
+	.uleb128 .LVL201-.LVL201
+	.uleb128 .LVL202-1-.LVL201
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL202-1-.LVL201
+	.uleb128 .LVL206-.LVL201
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL225-.LVL201
+	.uleb128 .LVL226-.LVL201
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU702
+	.uleb128 .LVU707
+	.uleb128 .LVU707
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU715
+	.uleb128 .LVU788
+	.uleb128 .LVU789
+.LLST162:
+	.byte	0x6
+	.quad	.LVL201
+	.byte	0x4
+	.uleb128 .LVL201-.LVL201
+	.uleb128 .LVL202-1-.LVL201
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-1-.LVL201
+	.uleb128 .LVL204-.LVL201
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL204-.LVL201
+	.uleb128 .LVL206-.LVL201
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.LVL201
+	.uleb128 .LVL226-.LVL201
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU710
+	.uleb128 .LVU712
+.LLST163:
+	.byte	0x8
+	.quad	.LVL203
+	.uleb128 .LVL204-.LVL203
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU767
+	.uleb128 .LVU770
+.LLST164:
+	.byte	0x8
+	.quad	.LVL219
+	.uleb128 .LVL220-.LVL219
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU789
+	.uleb128 .LVU800
+.LLST165:
+	.byte	0x8
+	.quad	.LVL226
+	.uleb128 .LVL231-.LVL226
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU789
+	.uleb128 .LVU800
+.LLST166:
+	.byte	0x8
+	.quad	.LVL226
+	.uleb128 .LVL231-.LVL226
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU797
+	.uleb128 .LVU798
+	.uleb128 .LVU798
+	.uleb128 .LVU800
+.LLST167:
+	.byte	0x6
+	.quad	.LVL229
+	.byte	0x4
+	.uleb128 .LVL229-.LVL229
+	.uleb128 .LVL230-1-.LVL229
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL230-1-.LVL229
+	.uleb128 .LVL231-.LVL229
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU820
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU828
+	.uleb128 .LVU828
+	.uleb128 .LVU829
+.LLST170:
+	.byte	0x6
+	.quad	.LVL234
+	.byte	0x4
+	.uleb128 .LVL234-.LVL234
+	.uleb128 .LVL235-.LVL234
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL235-.LVL234
+	.uleb128 .LVL236-.LVL234
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL234
+	.uleb128 .LVL237-.LVL234
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.LVL234
+	.uleb128 .LVL238-.LVL234
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 0
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 0
+.LLST101:
+	.byte	0x6
+	.quad	.LVL161
+	.byte	0x4
+	.uleb128 .LVL161-.LVL161
+	.uleb128 .LVL162-1-.LVL161
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL162-1-.LVL161
+	.uleb128 .LFE20-.LVL161
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 0
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 0
+.LLST102:
+	.byte	0x6
+	.quad	.LVL161
+	.byte	0x4
+	.uleb128 .LVL161-.LVL161
+	.uleb128 .LVL162-1-.LVL161
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL162-1-.LVL161
+	.uleb128 .LFE20-.LVL161
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL32-.LVL10
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL32-.LVL10
+	.uleb128 .LVL33-.LVL10
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL10
+	.uleb128 .LFE18-.LVL10
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU27
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 .LVU73
+	.uleb128 .LVU86
+	.uleb128 .LVU90
+	.uleb128 .LVU118
+	.uleb128 .LVU135
+.LLST7:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL13-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL10
+	.uleb128 .LVL20-.LVL10
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL20-.LVL10
+	.uleb128 .LVL21-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL10
+	.uleb128 .LVL23-.LVL10
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL33-.LVL10
+	.uleb128 .LVL35-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+	.uleb128 .LVU59
+	.uleb128 .LVU60
+	.uleb128 .LVU86
+	.uleb128 .LVU102
+	.uleb128 .LVU118
+	.uleb128 .LVU135
+.LLST8:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL12
+	.uleb128 .LVL17-.LVL12
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL12
+	.uleb128 .LVL25-.LVL12
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL12
+	.uleb128 .LVL35-.LVL12
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU45
+	.uleb128 .LVU47
+	.uleb128 .LVU64
+	.uleb128 .LVU69
+.LLST10:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.LVL13
+	.uleb128 .LVL20-.LVL13
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU46
+	.uleb128 .LVU52
+.LLST11:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU144
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU152
+	.uleb128 .LVU152
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL35-.LVL35
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL41-.LVL35
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL35
+	.uleb128 .LFE18-.LVL35
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU97
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+	.uleb128 .LVU127
+	.uleb128 .LVU131
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+.LLST16:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL25-.LVL24
+	.uleb128 .LVL26-.LVL24
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL24
+	.uleb128 .LVL27-.LVL24
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL24
+	.uleb128 .LVL30-.LVL24
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL34-.LVL24
+	.uleb128 .LVL34-.LVL24
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL24
+	.uleb128 .LVL37-.LVL24
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU97
+	.uleb128 .LVU109
+	.uleb128 .LVU127
+	.uleb128 .LVU131
+	.uleb128 .LVU140
+	.uleb128 .LVU143
+.LLST17:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL30-.LVL24
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.LVL24
+	.uleb128 .LVL34-.LVL24
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL36-.LVL24
+	.uleb128 .LVL38-.LVL24
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL6-1-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-1-.LVL0
+	.uleb128 .LVL7-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL0
+	.uleb128 .LVL9-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-.LVL0
+	.uleb128 .LFE15-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LVL7-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL0
+	.uleb128 .LFE15-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU6
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+.LLST3:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-.LVL2
+	.uleb128 .LVL8-.LVL2
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU6
+	.uleb128 .LVU15
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+.LLST4:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL7-.LVL2
+	.uleb128 .LVL8-.LVL2
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU12
+	.uleb128 .LVU16
+.LLST5:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL5-.LVL3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS94:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU561
+	.uleb128 .LVU561
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 0
+.LLST94:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL147-.LVL146
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL147-.LVL146
+	.uleb128 .LVL159-.LVL146
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL159-.LVL146
+	.uleb128 .LVL160-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.LVL146
+	.uleb128 .LFE14-.LVL146
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU560
+	.uleb128 .LVU560
+	.uleb128 .LVU562
+	.uleb128 .LVU562
+	.uleb128 0
+.LLST95:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL147-.LVL146
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL147-.LVL146
+	.uleb128 .LVL158-.LVL146
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL158-.LVL146
+	.uleb128 .LVL160-.LVL146
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-.LVL146
+	.uleb128 .LFE14-.LVL146
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU533
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU559
+	.uleb128 .LVU562
+	.uleb128 0
+.LLST96:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL147-.LVL146
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.LVL146
+	.uleb128 .LVL157-.LVL146
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL160-.LVL146
+	.uleb128 .LFE14-.LVL146
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU537
+	.uleb128 .LVU540
+	.uleb128 .LVU551
+	.uleb128 .LVU557
+.LLST98:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL149-.LVL147
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL155-.LVL147
+	.uleb128 .LVL156-.LVL147
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU537
+	.uleb128 .LVU540
+	.uleb128 .LVU551
+	.uleb128 .LVU557
+.LLST99:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL149-.LVL147
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL155-.LVL147
+	.uleb128 .LVL156-.LVL147
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU538
+	.uleb128 .LVU543
+.LLST100:
+	.byte	0x8
+	.quad	.LVL148
+	.uleb128 .LVL150-.LVL148
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS91:
+	.uleb128 0
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 0
+.LLST91:
+	.byte	0x6
+	.quad	.LVL141
+	.byte	0x4
+	.uleb128 .LVL141-.LVL141
+	.uleb128 .LVL142-.LVL141
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL142-.LVL141
+	.uleb128 .LFE13-.LVL141
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU518
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU529
+.LLST92:
+	.byte	0x6
+	.quad	.LVL141
+	.byte	0x4
+	.uleb128 .LVL141-.LVL141
+	.uleb128 .LVL142-.LVL141
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.LVL141
+	.uleb128 .LVL145-.LVL141
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU520
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU528
+	.uleb128 .LVU528
+	.uleb128 .LVU529
+.LLST93:
+	.byte	0x6
+	.quad	.LVL141
+	.byte	0x4
+	.uleb128 .LVL141-.LVL141
+	.uleb128 .LVL142-.LVL141
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.LVL141
+	.uleb128 .LVL143-.LVL141
+	.uleb128 0x9
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL141
+	.uleb128 .LVL144-.LVL141
+	.uleb128 0xb
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL141
+	.uleb128 .LVL145-.LVL141
+	.uleb128 0xd
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x1c
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL60-.LVL58
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL60-.LVL58
+	.uleb128 .LVL78-.LVL58
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.LVL58
+	.uleb128 .LVL79-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL74-.LVL58
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL74-.LVL58
+	.uleb128 .LVL79-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL58
+	.uleb128 .LVL82-.LVL58
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL82-.LVL58
+	.uleb128 .LVL84-.LVL58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL84-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU347
+	.uleb128 .LVU347
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 0
+.LLST31:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL59-.LVL58
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL59-.LVL58
+	.uleb128 .LVL72-.LVL58
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL72-.LVL58
+	.uleb128 .LVL74-.LVL58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL74-.LVL58
+	.uleb128 .LVL79-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL58
+	.uleb128 .LVL83-.LVL58
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL83-.LVL58
+	.uleb128 .LVL84-.LVL58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL84-.LVL58
+	.uleb128 .LVL125-.LVL58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.byte	0x4
+	.uleb128 .LVL125-.LVL58
+	.uleb128 .LVL127-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL61-.LVL58
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL61-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL74-.LVL58
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL74-.LVL58
+	.uleb128 .LVL79-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL58
+	.uleb128 .LVL84-.LVL58
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL84-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 0
+.LLST34:
+	.byte	0x6
+	.quad	.LVL58
+	.byte	0x4
+	.uleb128 .LVL58-.LVL58
+	.uleb128 .LVL63-.LVL58
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL63-.LVL58
+	.uleb128 .LVL74-.LVL58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL74-.LVL58
+	.uleb128 .LVL79-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL58
+	.uleb128 .LVL84-.LVL58
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0x4
+	.uleb128 .LVL84-.LVL58
+	.uleb128 .LFE12-.LVL58
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU234
+.LLST35:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL62-.LVL58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+.LVUS36:
+	.uleb128 0
+	.uleb128 .LVU234
+.LLST36:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL62-.LVL58
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 8
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU276
+	.uleb128 .LVU287
+.LLST37:
+	.byte	0x8
+	.quad	.LVL66
+	.uleb128 .LVL67-.LVL66
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU258
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU290
+	.uleb128 .LVU291
+	.uleb128 .LVU293
+	.uleb128 .LVU322
+	.uleb128 .LVU331
+.LLST38:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL63-.LVL63
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL67-.LVL63
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.LVL63
+	.uleb128 .LVL68-.LVL63
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.LVL63
+	.uleb128 .LVL70-.LVL63
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL63
+	.uleb128 .LVL80-.LVL63
+	.uleb128 0xf
+	.byte	0x31
+	.byte	0x32
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU261
+	.uleb128 .LVU277
+.LLST39:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL66-.LVL63
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU260
+	.uleb128 .LVU277
+.LLST40:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL66-.LVL63
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+4644
+	.sleb128 0
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU260
+	.uleb128 .LVU277
+.LLST41:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL66-.LVL63
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU266
+	.uleb128 .LVU277
+.LLST42:
+	.byte	0x8
+	.quad	.LVL64
+	.uleb128 .LVL66-.LVL64
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+.LLST43:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL63-.LVL63
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU268
+	.uleb128 .LVU271
+.LLST44:
+	.byte	0x8
+	.quad	.LVL65
+	.uleb128 .LVL65-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU294
+	.uleb128 .LVU296
+	.uleb128 .LVU452
+	.uleb128 .LVU454
+	.uleb128 .LVU496
+	.uleb128 .LVU498
+.LLST46:
+	.byte	0x8
+	.quad	.LVL70
+	.uleb128 .LVL70-.LVL70
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x8
+	.quad	.LVL120
+	.uleb128 .LVL120-.LVL120
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x8
+	.quad	.LVL136
+	.uleb128 .LVL136-.LVL136
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU296
+	.uleb128 .LVU302
+	.uleb128 .LVU454
+	.uleb128 .LVU460
+	.uleb128 .LVU498
+	.uleb128 .LVU504
+.LLST48:
+	.byte	0x6
+	.quad	.LVL70
+	.byte	0x4
+	.uleb128 .LVL70-.LVL70
+	.uleb128 .LVL71-.LVL70
+	.uleb128 0x8
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.LVL70
+	.uleb128 .LVL121-.LVL70
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL70
+	.uleb128 .LVL137-.LVL70
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU296
+	.uleb128 .LVU302
+	.uleb128 .LVU454
+	.uleb128 .LVU460
+	.uleb128 .LVU498
+	.uleb128 .LVU504
+.LLST49:
+	.byte	0x6
+	.quad	.LVL70
+	.byte	0x4
+	.uleb128 .LVL70-.LVL70
+	.uleb128 .LVL71-.LVL70
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL120-.LVL70
+	.uleb128 .LVL121-.LVL70
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL136-.LVL70
+	.uleb128 .LVL137-.LVL70
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU302
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU308
+	.uleb128 .LVU460
+	.uleb128 .LVU464
+	.uleb128 .LVU466
+	.uleb128 .LVU467
+	.uleb128 .LVU504
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU511
+.LLST51:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL72-.LVL71
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL72-.LVL71
+	.uleb128 .LVL73-.LVL71
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL121-.LVL71
+	.uleb128 .LVL122-.LVL71
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL123-.LVL71
+	.uleb128 .LVL124-.LVL71
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL137-.LVL71
+	.uleb128 .LVL138-.LVL71
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL138-.LVL71
+	.uleb128 .LVL139-.LVL71
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.byte	0x4
+	.uleb128 .LVL139-.LVL71
+	.uleb128 .LVL140-.LVL71
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU302
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+	.uleb128 .LVU460
+	.uleb128 .LVU467
+	.uleb128 .LVU504
+	.uleb128 .LVU511
+.LLST52:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL74-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL71
+	.uleb128 .LVL75-.LVL71
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL121-.LVL71
+	.uleb128 .LVL124-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL137-.LVL71
+	.uleb128 .LVL140-.LVL71
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU307
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU316
+	.uleb128 .LVU465
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU471
+	.uleb128 .LVU509
+	.uleb128 .LVU511
+.LLST53:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL74-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL73
+	.uleb128 .LVL77-.LVL73
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL123-.LVL73
+	.uleb128 .LVL124-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL125-.LVL73
+	.uleb128 .LVL126-.LVL73
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL139-.LVL73
+	.uleb128 .LVL140-.LVL73
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU323
+	.uleb128 .LVU450
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST55:
+	.byte	0x6
+	.quad	.LVL79
+	.byte	0x4
+	.uleb128 .LVL79-.LVL79
+	.uleb128 .LVL120-.LVL79
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL124-.LVL79
+	.uleb128 .LVL125-.LVL79
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.LVL79
+	.uleb128 .LVL136-.LVL79
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.LVL79
+	.uleb128 .LFE12-.LVL79
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU333
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 0
+.LLST56:
+	.byte	0x6
+	.quad	.LVL81
+	.byte	0x4
+	.uleb128 .LVL81-.LVL81
+	.uleb128 .LVL84-.LVL81
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL84-.LVL81
+	.uleb128 .LVL125-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x4
+	.uleb128 .LVL127-.LVL81
+	.uleb128 .LFE12-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU336
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU410
+	.uleb128 .LVU412
+	.uleb128 .LVU413
+	.uleb128 .LVU413
+	.uleb128 .LVU443
+	.uleb128 .LVU445
+	.uleb128 .LVU450
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST57:
+	.byte	0x6
+	.quad	.LVL81
+	.byte	0x4
+	.uleb128 .LVL81-.LVL81
+	.uleb128 .LVL84-.LVL81
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL81
+	.uleb128 .LVL105-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0x4
+	.uleb128 .LVL106-.LVL81
+	.uleb128 .LVL107-.LVL81
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.LVL81
+	.uleb128 .LVL117-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0x4
+	.uleb128 .LVL118-.LVL81
+	.uleb128 .LVL120-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0x4
+	.uleb128 .LVL124-.LVL81
+	.uleb128 .LVL125-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0x4
+	.uleb128 .LVL127-.LVL81
+	.uleb128 .LVL136-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0x4
+	.uleb128 .LVL140-.LVL81
+	.uleb128 .LFE12-.LVL81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -213
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU337
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU375
+	.uleb128 .LVU472
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU494
+.LLST58:
+	.byte	0x6
+	.quad	.LVL81
+	.byte	0x4
+	.uleb128 .LVL81-.LVL81
+	.uleb128 .LVL84-.LVL81
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL81
+	.uleb128 .LVL94-.LVL81
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL127-.LVL81
+	.uleb128 .LVL128-.LVL81
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL128-.LVL81
+	.uleb128 .LVL136-.LVL81
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU394
+	.uleb128 .LVU399
+	.uleb128 .LVU399
+	.uleb128 .LVU406
+	.uleb128 .LVU406
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+.LLST59:
+	.byte	0x6
+	.quad	.LVL99
+	.byte	0x4
+	.uleb128 .LVL99-.LVL99
+	.uleb128 .LVL101-.LVL99
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.LVL99
+	.uleb128 .LVL102-.LVL99
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL102-.LVL99
+	.uleb128 .LVL103-.LVL99
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL99
+	.uleb128 .LVL104-.LVL99
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU325
+	.uleb128 .LVU333
+.LLST61:
+	.byte	0x8
+	.quad	.LVL79
+	.uleb128 .LVL81-.LVL79
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 36
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU325
+	.uleb128 .LVU333
+.LLST62:
+	.byte	0x8
+	.quad	.LVL79
+	.uleb128 .LVL81-.LVL79
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU357
+	.uleb128 .LVU397
+	.uleb128 .LVU413
+	.uleb128 .LVU433
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU472
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST64:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL100-.LVL86
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL107-.LVL86
+	.uleb128 .LVL113-.LVL86
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL119-.LVL86
+	.uleb128 .LVL120-.LVL86
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL127-.LVL86
+	.uleb128 .LVL136-.LVL86
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL140-.LVL86
+	.uleb128 .LFE12-.LVL86
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU359
+	.uleb128 .LVU362
+	.uleb128 .LVU362
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST65:
+	.byte	0x6
+	.quad	.LVL84
+	.byte	0x4
+	.uleb128 .LVL84-.LVL84
+	.uleb128 .LVL85-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0x4
+	.uleb128 .LVL87-.LVL84
+	.uleb128 .LVL88-.LVL84
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.LVL84
+	.uleb128 .LVL93-.LVL84
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL93-.LVL84
+	.uleb128 .LVL95-.LVL84
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 -4
+	.byte	0x4
+	.uleb128 .LVL95-.LVL84
+	.uleb128 .LVL96-.LVL84
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1c
+	.byte	0x4
+	.uleb128 .LVL96-.LVL84
+	.uleb128 .LVL119-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0x4
+	.uleb128 .LVL119-.LVL84
+	.uleb128 .LVL120-.LVL84
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 -4
+	.byte	0x4
+	.uleb128 .LVL124-.LVL84
+	.uleb128 .LVL125-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0x4
+	.uleb128 .LVL127-.LVL84
+	.uleb128 .LVL129-.LVL84
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL129-.LVL84
+	.uleb128 .LVL136-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0x4
+	.uleb128 .LVL140-.LVL84
+	.uleb128 .LFE12-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU363
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST66:
+	.byte	0x6
+	.quad	.LVL84
+	.byte	0x4
+	.uleb128 .LVL84-.LVL84
+	.uleb128 .LVL85-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL89-.LVL84
+	.uleb128 .LVL95-.LVL84
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-.LVL84
+	.uleb128 .LVL119-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL119-.LVL84
+	.uleb128 .LVL120-.LVL84
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL124-.LVL84
+	.uleb128 .LVL125-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL127-.LVL84
+	.uleb128 .LVL136-.LVL84
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL140-.LVL84
+	.uleb128 .LFE12-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU365
+	.uleb128 .LVU450
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU494
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST67:
+	.byte	0x6
+	.quad	.LVL84
+	.byte	0x4
+	.uleb128 .LVL84-.LVL84
+	.uleb128 .LVL85-.LVL84
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL90-.LVL84
+	.uleb128 .LVL120-.LVL84
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL124-.LVL84
+	.uleb128 .LVL125-.LVL84
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL127-.LVL84
+	.uleb128 .LVL136-.LVL84
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL140-.LVL84
+	.uleb128 .LFE12-.LVL84
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU379
+	.uleb128 .LVU389
+.LLST69:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL98-.LVL96
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU379
+	.uleb128 .LVU389
+.LLST70:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL98-.LVL96
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU379
+	.uleb128 .LVU385
+.LLST71:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL97-1-.LVL96
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU348
+	.uleb128 .LVU353
+	.uleb128 .LVU382
+	.uleb128 .LVU448
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU494
+	.uleb128 0
+.LLST73:
+	.byte	0x6
+	.quad	.LVL84
+	.byte	0x4
+	.uleb128 .LVL84-.LVL84
+	.uleb128 .LVL85-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL96-.LVL84
+	.uleb128 .LVL119-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL124-.LVL84
+	.uleb128 .LVL125-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL136-.LVL84
+	.uleb128 .LFE12-.LVL84
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU383
+	.uleb128 .LVU389
+.LLST74:
+	.byte	0x8
+	.quad	.LVL96
+	.uleb128 .LVL98-.LVL96
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x32
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU369
+	.uleb128 .LVU372
+.LLST75:
+	.byte	0x8
+	.quad	.LVL91
+	.uleb128 .LVL92-.LVL91
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU427
+	.uleb128 .LVU442
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+	.uleb128 .LVU511
+	.uleb128 0
+.LLST77:
+	.byte	0x6
+	.quad	.LVL112
+	.byte	0x4
+	.uleb128 .LVL112-.LVL112
+	.uleb128 .LVL116-.LVL112
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL124-.LVL112
+	.uleb128 .LVL125-.LVL112
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL140-.LVL112
+	.uleb128 .LFE12-.LVL112
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU415
+	.uleb128 .LVU427
+.LLST79:
+	.byte	0x8
+	.quad	.LVL108
+	.uleb128 .LVL112-.LVL108
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x7f
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU414
+	.uleb128 .LVU427
+.LLST80:
+	.byte	0x8
+	.quad	.LVL107
+	.uleb128 .LVL112-.LVL107
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU419
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU423
+	.uleb128 .LVU424
+	.uleb128 .LVU427
+.LLST82:
+	.byte	0x6
+	.quad	.LVL108
+	.byte	0x4
+	.uleb128 .LVL108-.LVL108
+	.uleb128 .LVL109-.LVL108
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.LVL108
+	.uleb128 .LVL109-.LVL108
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-.LVL108
+	.uleb128 .LVL110-.LVL108
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.LVL108
+	.uleb128 .LVL112-.LVL108
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU433
+	.uleb128 .LVU437
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+.LLST84:
+	.byte	0x6
+	.quad	.LVL113
+	.byte	0x4
+	.uleb128 .LVL113-.LVL113
+	.uleb128 .LVL114-.LVL113
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL124-.LVL113
+	.uleb128 .LVL125-.LVL113
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU433
+	.uleb128 .LVU437
+	.uleb128 .LVU467
+	.uleb128 .LVU469
+.LLST85:
+	.byte	0x6
+	.quad	.LVL113
+	.byte	0x4
+	.uleb128 .LVL113-.LVL113
+	.uleb128 .LVL114-.LVL113
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL124-.LVL113
+	.uleb128 .LVL125-.LVL113
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU436
+	.uleb128 .LVU438
+.LLST86:
+	.byte	0x8
+	.quad	.LVL114
+	.uleb128 .LVL115-.LVL114
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU478
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU485
+.LLST88:
+	.byte	0x6
+	.quad	.LVL130
+	.byte	0x4
+	.uleb128 .LVL130-.LVL130
+	.uleb128 .LVL131-.LVL130
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL130
+	.uleb128 .LVL132-.LVL130
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.LVL130
+	.uleb128 .LVL133-.LVL130
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU478
+	.uleb128 .LVU485
+	.uleb128 .LVU485
+	.uleb128 .LVU491
+.LLST89:
+	.byte	0x6
+	.quad	.LVL130
+	.byte	0x4
+	.uleb128 .LVL130-.LVL130
+	.uleb128 .LVL133-.LVL130
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-.LVL130
+	.uleb128 .LVL135-.LVL130
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU480
+	.uleb128 .LVU491
+.LLST90:
+	.byte	0x8
+	.quad	.LVL130
+	.uleb128 .LVL135-.LVL130
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU215
+	.uleb128 .LVU215
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL43-1-.LVL42
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-1-.LVL42
+	.uleb128 .LVL48-.LVL42
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.LVL42
+	.uleb128 .LVL50-1-.LVL42
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-1-.LVL42
+	.uleb128 .LVL50-.LVL42
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL42
+	.uleb128 .LVL52-.LVL42
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL52-.LVL42
+	.uleb128 .LVL54-.LVL42
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.LVL42
+	.uleb128 .LVL55-.LVL42
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.LVL42
+	.uleb128 .LVL57-.LVL42
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.LVL42
+	.uleb128 .LFE23-.LVL42
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU173
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU210
+	.uleb128 .LVU211
+	.uleb128 .LVU216
+	.uleb128 .LVU217
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL45
+	.byte	0x4
+	.uleb128 .LVL45-.LVL45
+	.uleb128 .LVL46-1-.LVL45
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-1-.LVL45
+	.uleb128 .LVL49-.LVL45
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.LVL45
+	.uleb128 .LVL53-.LVL45
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.LVL45
+	.uleb128 .LVL56-.LVL45
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL57-.LVL45
+	.uleb128 .LFE23-.LVL45
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+.LLST22:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LVL43-.LVL43
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU164
+	.uleb128 .LVU167
+.LLST24:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LVL43-.LVL43
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU164
+	.uleb128 .LVU167
+.LLST25:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LVL43-.LVL43
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU179
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU217
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL48-.LVL47
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL48-.LVL47
+	.uleb128 .LVL50-1-.LVL47
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL50-1-.LVL47
+	.uleb128 .LVL50-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.LVL47
+	.uleb128 .LFE23-.LVL47
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU195
+	.uleb128 .LVU207
+.LLST28:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LVL51-.LVL50
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xac
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x5
+	.quad	.LBB67
+	.byte	0x4
+	.uleb128 .LBB67-.LBB67
+	.uleb128 .LBE67-.LBB67
+	.byte	0x4
+	.uleb128 .LBB71-.LBB67
+	.uleb128 .LBE71-.LBB67
+	.byte	0x4
+	.uleb128 .LBB72-.LBB67
+	.uleb128 .LBE72-.LBB67
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB81
+	.byte	0x4
+	.uleb128 .LBB81-.LBB81
+	.uleb128 .LBE81-.LBB81
+	.byte	0x4
+	.uleb128 .LBB88-.LBB81
+	.uleb128 .LBE88-.LBB81
+	.byte	0x4
+	.uleb128 .LBB90-.LBB81
+	.uleb128 .LBE90-.LBB81
+	.byte	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB85
+	.byte	0x4
+	.uleb128 .LBB85-.LBB85
+	.uleb128 .LBE85-.LBB85
+	.byte	0x4
+	.uleb128 .LBB89-.LBB85
+	.uleb128 .LBE89-.LBB85
+	.byte	0
+.LLRL13:
+	.byte	0x5
+	.quad	.LBB91
+	.byte	0x4
+	.uleb128 .LBB91-.LBB91
+	.uleb128 .LBE91-.LBB91
+	.byte	0x4
+	.uleb128 .LBB102-.LBB91
+	.uleb128 .LBE102-.LBB91
+	.byte	0x4
+	.uleb128 .LBB104-.LBB91
+	.uleb128 .LBE104-.LBB91
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB95
+	.byte	0x4
+	.uleb128 .LBB95-.LBB95
+	.uleb128 .LBE95-.LBB95
+	.byte	0x4
+	.uleb128 .LBB100-.LBB95
+	.uleb128 .LBE100-.LBB95
+	.byte	0x4
+	.uleb128 .LBB101-.LBB95
+	.uleb128 .LBE101-.LBB95
+	.byte	0x4
+	.uleb128 .LBB103-.LBB95
+	.uleb128 .LBE103-.LBB95
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB121
+	.byte	0x4
+	.uleb128 .LBB121-.LBB121
+	.uleb128 .LBE121-.LBB121
+	.byte	0x4
+	.uleb128 .LBB124-.LBB121
+	.uleb128 .LBE124-.LBB121
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB125
+	.byte	0x4
+	.uleb128 .LBB125-.LBB125
+	.uleb128 .LBE125-.LBB125
+	.byte	0x4
+	.uleb128 .LBB132-.LBB125
+	.uleb128 .LBE132-.LBB125
+	.byte	0x4
+	.uleb128 .LBB133-.LBB125
+	.uleb128 .LBE133-.LBB125
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB129
+	.byte	0x4
+	.uleb128 .LBB129-.LBB129
+	.uleb128 .LBE129-.LBB129
+	.byte	0x4
+	.uleb128 .LBB134-.LBB129
+	.uleb128 .LBE134-.LBB129
+	.byte	0
+.LLRL26:
+	.byte	0x5
+	.quad	.LBB135
+	.byte	0x4
+	.uleb128 .LBB135-.LBB135
+	.uleb128 .LBE135-.LBB135
+	.byte	0x4
+	.uleb128 .LBB140-.LBB135
+	.uleb128 .LBE140-.LBB135
+	.byte	0x4
+	.uleb128 .LBB143-.LBB135
+	.uleb128 .LBE143-.LBB135
+	.byte	0x4
+	.uleb128 .LBB144-.LBB135
+	.uleb128 .LBE144-.LBB135
+	.byte	0
+.LLRL45:
+	.byte	0x5
+	.quad	.LBB184
+	.byte	0x4
+	.uleb128 .LBB184-.LBB184
+	.uleb128 .LBE184-.LBB184
+	.byte	0x4
+	.uleb128 .LBB199-.LBB184
+	.uleb128 .LBE199-.LBB184
+	.byte	0x4
+	.uleb128 .LBB251-.LBB184
+	.uleb128 .LBE251-.LBB184
+	.byte	0x4
+	.uleb128 .LBB252-.LBB184
+	.uleb128 .LBE252-.LBB184
+	.byte	0x4
+	.uleb128 .LBB254-.LBB184
+	.uleb128 .LBE254-.LBB184
+	.byte	0x4
+	.uleb128 .LBB260-.LBB184
+	.uleb128 .LBE260-.LBB184
+	.byte	0x4
+	.uleb128 .LBB262-.LBB184
+	.uleb128 .LBE262-.LBB184
+	.byte	0
+.LLRL47:
+	.byte	0x5
+	.quad	.LBB192
+	.byte	0x4
+	.uleb128 .LBB192-.LBB192
+	.uleb128 .LBE192-.LBB192
+	.byte	0x4
+	.uleb128 .LBB200-.LBB192
+	.uleb128 .LBE200-.LBB192
+	.byte	0x4
+	.uleb128 .LBB253-.LBB192
+	.uleb128 .LBE253-.LBB192
+	.byte	0x4
+	.uleb128 .LBB255-.LBB192
+	.uleb128 .LBE255-.LBB192
+	.byte	0x4
+	.uleb128 .LBB261-.LBB192
+	.uleb128 .LBE261-.LBB192
+	.byte	0x4
+	.uleb128 .LBB263-.LBB192
+	.uleb128 .LBE263-.LBB192
+	.byte	0
+.LLRL50:
+	.byte	0x5
+	.quad	.LBB201
+	.byte	0x4
+	.uleb128 .LBB201-.LBB201
+	.uleb128 .LBE201-.LBB201
+	.byte	0x4
+	.uleb128 .LBB256-.LBB201
+	.uleb128 .LBE256-.LBB201
+	.byte	0x4
+	.uleb128 .LBB258-.LBB201
+	.uleb128 .LBE258-.LBB201
+	.byte	0x4
+	.uleb128 .LBB264-.LBB201
+	.uleb128 .LBE264-.LBB201
+	.byte	0
+.LLRL54:
+	.byte	0x5
+	.quad	.LBB206
+	.byte	0x4
+	.uleb128 .LBB206-.LBB206
+	.uleb128 .LBE206-.LBB206
+	.byte	0x4
+	.uleb128 .LBB257-.LBB206
+	.uleb128 .LBE257-.LBB206
+	.byte	0x4
+	.uleb128 .LBB259-.LBB206
+	.uleb128 .LBE259-.LBB206
+	.byte	0x4
+	.uleb128 .LBB265-.LBB206
+	.uleb128 .LBE265-.LBB206
+	.byte	0
+.LLRL60:
+	.byte	0x5
+	.quad	.LBB208
+	.byte	0x4
+	.uleb128 .LBB208-.LBB208
+	.uleb128 .LBE208-.LBB208
+	.byte	0x4
+	.uleb128 .LBB212-.LBB208
+	.uleb128 .LBE212-.LBB208
+	.byte	0x4
+	.uleb128 .LBB213-.LBB208
+	.uleb128 .LBE213-.LBB208
+	.byte	0
+.LLRL63:
+	.byte	0x5
+	.quad	.LBB214
+	.byte	0x4
+	.uleb128 .LBB214-.LBB214
+	.uleb128 .LBE214-.LBB214
+	.byte	0x4
+	.uleb128 .LBB243-.LBB214
+	.uleb128 .LBE243-.LBB214
+	.byte	0x4
+	.uleb128 .LBB244-.LBB214
+	.uleb128 .LBE244-.LBB214
+	.byte	0x4
+	.uleb128 .LBB245-.LBB214
+	.uleb128 .LBE245-.LBB214
+	.byte	0x4
+	.uleb128 .LBB246-.LBB214
+	.uleb128 .LBE246-.LBB214
+	.byte	0x4
+	.uleb128 .LBB247-.LBB214
+	.uleb128 .LBE247-.LBB214
+	.byte	0
+.LLRL68:
+	.byte	0x5
+	.quad	.LBB215
+	.byte	0x4
+	.uleb128 .LBB215-.LBB215
+	.uleb128 .LBE215-.LBB215
+	.byte	0x4
+	.uleb128 .LBB220-.LBB215
+	.uleb128 .LBE220-.LBB215
+	.byte	0x4
+	.uleb128 .LBB223-.LBB215
+	.uleb128 .LBE223-.LBB215
+	.byte	0
+.LLRL72:
+	.byte	0x5
+	.quad	.LBB216
+	.byte	0x4
+	.uleb128 .LBB216-.LBB216
+	.uleb128 .LBE216-.LBB216
+	.byte	0x4
+	.uleb128 .LBB217-.LBB216
+	.uleb128 .LBE217-.LBB216
+	.byte	0x4
+	.uleb128 .LBB218-.LBB216
+	.uleb128 .LBE218-.LBB216
+	.byte	0x4
+	.uleb128 .LBB219-.LBB216
+	.uleb128 .LBE219-.LBB216
+	.byte	0
+.LLRL76:
+	.byte	0x5
+	.quad	.LBB224
+	.byte	0x4
+	.uleb128 .LBB224-.LBB224
+	.uleb128 .LBE224-.LBB224
+	.byte	0x4
+	.uleb128 .LBB236-.LBB224
+	.uleb128 .LBE236-.LBB224
+	.byte	0x4
+	.uleb128 .LBB237-.LBB224
+	.uleb128 .LBE237-.LBB224
+	.byte	0x4
+	.uleb128 .LBB242-.LBB224
+	.uleb128 .LBE242-.LBB224
+	.byte	0
+.LLRL78:
+	.byte	0x5
+	.quad	.LBB225
+	.byte	0x4
+	.uleb128 .LBB225-.LBB225
+	.uleb128 .LBE225-.LBB225
+	.byte	0x4
+	.uleb128 .LBB229-.LBB225
+	.uleb128 .LBE229-.LBB225
+	.byte	0
+.LLRL81:
+	.byte	0x5
+	.quad	.LBB226
+	.byte	0x4
+	.uleb128 .LBB226-.LBB226
+	.uleb128 .LBE226-.LBB226
+	.byte	0x4
+	.uleb128 .LBB227-.LBB226
+	.uleb128 .LBE227-.LBB226
+	.byte	0x4
+	.uleb128 .LBB228-.LBB226
+	.uleb128 .LBE228-.LBB226
+	.byte	0
+.LLRL83:
+	.byte	0x5
+	.quad	.LBB230
+	.byte	0x4
+	.uleb128 .LBB230-.LBB230
+	.uleb128 .LBE230-.LBB230
+	.byte	0x4
+	.uleb128 .LBB234-.LBB230
+	.uleb128 .LBE234-.LBB230
+	.byte	0x4
+	.uleb128 .LBB235-.LBB230
+	.uleb128 .LBE235-.LBB230
+	.byte	0
+.LLRL87:
+	.byte	0x5
+	.quad	.LBB238
+	.byte	0x4
+	.uleb128 .LBB238-.LBB238
+	.uleb128 .LBE238-.LBB238
+	.byte	0x4
+	.uleb128 .LBB241-.LBB238
+	.uleb128 .LBE241-.LBB238
+	.byte	0
+.LLRL97:
+	.byte	0x5
+	.quad	.LBB268
+	.byte	0x4
+	.uleb128 .LBB268-.LBB268
+	.uleb128 .LBE268-.LBB268
+	.byte	0x4
+	.uleb128 .LBB272-.LBB268
+	.uleb128 .LBE272-.LBB268
+	.byte	0x4
+	.uleb128 .LBB273-.LBB268
+	.uleb128 .LBE273-.LBB268
+	.byte	0
+.LLRL105:
+	.byte	0x5
+	.quad	.LBB345
+	.byte	0x4
+	.uleb128 .LBB345-.LBB345
+	.uleb128 .LBE345-.LBB345
+	.byte	0x4
+	.uleb128 .LBB481-.LBB345
+	.uleb128 .LBE481-.LBB345
+	.byte	0x4
+	.uleb128 .LBB482-.LBB345
+	.uleb128 .LBE482-.LBB345
+	.byte	0x4
+	.uleb128 .LBB483-.LBB345
+	.uleb128 .LBE483-.LBB345
+	.byte	0x4
+	.uleb128 .LBB484-.LBB345
+	.uleb128 .LBE484-.LBB345
+	.byte	0x4
+	.uleb128 .LBB485-.LBB345
+	.uleb128 .LBE485-.LBB345
+	.byte	0x4
+	.uleb128 .LBB486-.LBB345
+	.uleb128 .LBE486-.LBB345
+	.byte	0x4
+	.uleb128 .LBB487-.LBB345
+	.uleb128 .LBE487-.LBB345
+	.byte	0x4
+	.uleb128 .LBB488-.LBB345
+	.uleb128 .LBE488-.LBB345
+	.byte	0
+.LLRL113:
+	.byte	0x5
+	.quad	.LBB347
+	.byte	0x4
+	.uleb128 .LBB347-.LBB347
+	.uleb128 .LBE347-.LBB347
+	.byte	0x4
+	.uleb128 .LBB452-.LBB347
+	.uleb128 .LBE452-.LBB347
+	.byte	0x4
+	.uleb128 .LBB457-.LBB347
+	.uleb128 .LBE457-.LBB347
+	.byte	0x4
+	.uleb128 .LBB470-.LBB347
+	.uleb128 .LBE470-.LBB347
+	.byte	0x4
+	.uleb128 .LBB472-.LBB347
+	.uleb128 .LBE472-.LBB347
+	.byte	0
+.LLRL117:
+	.byte	0x5
+	.quad	.LBB349
+	.byte	0x4
+	.uleb128 .LBB349-.LBB349
+	.uleb128 .LBE349-.LBB349
+	.byte	0x4
+	.uleb128 .LBB352-.LBB349
+	.uleb128 .LBE352-.LBB349
+	.byte	0
+.LLRL119:
+	.byte	0x5
+	.quad	.LBB353
+	.byte	0x4
+	.uleb128 .LBB353-.LBB353
+	.uleb128 .LBE353-.LBB353
+	.byte	0x4
+	.uleb128 .LBB357-.LBB353
+	.uleb128 .LBE357-.LBB353
+	.byte	0x4
+	.uleb128 .LBB358-.LBB353
+	.uleb128 .LBE358-.LBB353
+	.byte	0
+.LLRL121:
+	.byte	0x5
+	.quad	.LBB359
+	.byte	0x4
+	.uleb128 .LBB359-.LBB359
+	.uleb128 .LBE359-.LBB359
+	.byte	0x4
+	.uleb128 .LBB362-.LBB359
+	.uleb128 .LBE362-.LBB359
+	.byte	0
+.LLRL126:
+	.byte	0x5
+	.quad	.LBB367
+	.byte	0x4
+	.uleb128 .LBB367-.LBB367
+	.uleb128 .LBE367-.LBB367
+	.byte	0x4
+	.uleb128 .LBB375-.LBB367
+	.uleb128 .LBE375-.LBB367
+	.byte	0x4
+	.uleb128 .LBB377-.LBB367
+	.uleb128 .LBE377-.LBB367
+	.byte	0
+.LLRL128:
+	.byte	0x5
+	.quad	.LBB371
+	.byte	0x4
+	.uleb128 .LBB371-.LBB371
+	.uleb128 .LBE371-.LBB371
+	.byte	0x4
+	.uleb128 .LBB376-.LBB371
+	.uleb128 .LBE376-.LBB371
+	.byte	0x4
+	.uleb128 .LBB378-.LBB371
+	.uleb128 .LBE378-.LBB371
+	.byte	0
+.LLRL135:
+	.byte	0x5
+	.quad	.LBB389
+	.byte	0x4
+	.uleb128 .LBB389-.LBB389
+	.uleb128 .LBE389-.LBB389
+	.byte	0x4
+	.uleb128 .LBB396-.LBB389
+	.uleb128 .LBE396-.LBB389
+	.byte	0x4
+	.uleb128 .LBB397-.LBB389
+	.uleb128 .LBE397-.LBB389
+	.byte	0x4
+	.uleb128 .LBB398-.LBB389
+	.uleb128 .LBE398-.LBB389
+	.byte	0x4
+	.uleb128 .LBB413-.LBB389
+	.uleb128 .LBE413-.LBB389
+	.byte	0x4
+	.uleb128 .LBB428-.LBB389
+	.uleb128 .LBE428-.LBB389
+	.byte	0
+.LLRL139:
+	.byte	0x5
+	.quad	.LBB399
+	.byte	0x4
+	.uleb128 .LBB399-.LBB399
+	.uleb128 .LBE399-.LBB399
+	.byte	0x4
+	.uleb128 .LBB414-.LBB399
+	.uleb128 .LBE414-.LBB399
+	.byte	0x4
+	.uleb128 .LBB415-.LBB399
+	.uleb128 .LBE415-.LBB399
+	.byte	0
+.LLRL141:
+	.byte	0x5
+	.quad	.LBB401
+	.byte	0x4
+	.uleb128 .LBB401-.LBB401
+	.uleb128 .LBE401-.LBB401
+	.byte	0x4
+	.uleb128 .LBB405-.LBB401
+	.uleb128 .LBE405-.LBB401
+	.byte	0x4
+	.uleb128 .LBB406-.LBB401
+	.uleb128 .LBE406-.LBB401
+	.byte	0
+.LLRL143:
+	.byte	0x5
+	.quad	.LBB407
+	.byte	0x4
+	.uleb128 .LBB407-.LBB407
+	.uleb128 .LBE407-.LBB407
+	.byte	0x4
+	.uleb128 .LBB410-.LBB407
+	.uleb128 .LBE410-.LBB407
+	.byte	0
+.LLRL146:
+	.byte	0x5
+	.quad	.LBB418
+	.byte	0x4
+	.uleb128 .LBB418-.LBB418
+	.uleb128 .LBE418-.LBB418
+	.byte	0x4
+	.uleb128 .LBB427-.LBB418
+	.uleb128 .LBE427-.LBB418
+	.byte	0x4
+	.uleb128 .LBB453-.LBB418
+	.uleb128 .LBE453-.LBB418
+	.byte	0x4
+	.uleb128 .LBB454-.LBB418
+	.uleb128 .LBE454-.LBB418
+	.byte	0
+.LLRL147:
+	.byte	0x5
+	.quad	.LBB419
+	.byte	0x4
+	.uleb128 .LBB419-.LBB419
+	.uleb128 .LBE419-.LBB419
+	.byte	0x4
+	.uleb128 .LBB422-.LBB419
+	.uleb128 .LBE422-.LBB419
+	.byte	0
+.LLRL153:
+	.byte	0x5
+	.quad	.LBB431
+	.byte	0x4
+	.uleb128 .LBB431-.LBB431
+	.uleb128 .LBE431-.LBB431
+	.byte	0x4
+	.uleb128 .LBB436-.LBB431
+	.uleb128 .LBE436-.LBB431
+	.byte	0x4
+	.uleb128 .LBB442-.LBB431
+	.uleb128 .LBE442-.LBB431
+	.byte	0x4
+	.uleb128 .LBB444-.LBB431
+	.uleb128 .LBE444-.LBB431
+	.byte	0
+.LLRL155:
+	.byte	0x5
+	.quad	.LBB437
+	.byte	0x4
+	.uleb128 .LBB437-.LBB437
+	.uleb128 .LBE437-.LBB437
+	.byte	0x4
+	.uleb128 .LBB443-.LBB437
+	.uleb128 .LBE443-.LBB437
+	.byte	0x4
+	.uleb128 .LBB445-.LBB437
+	.uleb128 .LBE445-.LBB437
+	.byte	0x4
+	.uleb128 .LBB446-.LBB437
+	.uleb128 .LBE446-.LBB437
+	.byte	0
+.LLRL160:
+	.byte	0x5
+	.quad	.LBB447
+	.byte	0x4
+	.uleb128 .LBB447-.LBB447
+	.uleb128 .LBE447-.LBB447
+	.byte	0x4
+	.uleb128 .LBB458-.LBB447
+	.uleb128 .LBE458-.LBB447
+	.byte	0
+.LLRL168:
+	.byte	0x5
+	.quad	.LBB463
+	.byte	0x4
+	.uleb128 .LBB463-.LBB463
+	.uleb128 .LBE463-.LBB463
+	.byte	0x4
+	.uleb128 .LBB466-.LBB463
+	.uleb128 .LBE466-.LBB463
+	.byte	0
+.LLRL169:
+	.byte	0x5
+	.quad	.LBB467
+	.byte	0x4
+	.uleb128 .LBB467-.LBB467
+	.uleb128 .LBE467-.LBB467
+	.byte	0x4
+	.uleb128 .LBB471-.LBB467
+	.uleb128 .LBE471-.LBB467
+	.byte	0
+.LLRL171:
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 31 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF750
+	.byte	0x4
+	.file 32 ".//src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.21a8e51ff4e49de8dae92488305a5e6a,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF758
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_storage.h.42.6f8ad26f0224a762e0a24d0e65392aaa,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF763
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF783:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF852:
+	.string	"eraseStep"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF789:
+	.string	"size_t"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF831:
+	.string	"FLASH_Lock"
+.LASF884:
+	.string	"unlockFlash"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF844:
+	.string	"record"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"configStorage_s"
+.LASF829:
+	.string	"configStorage_t"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF762:
+	.string	"CONFIG_STORAGE_MAX_SECTIONS 16"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF791:
+	.string	"FLASH_ERROR_PG"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF784:
+	.string	"int16_t"
+.LASF846:
+	.string	"header"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF838:
+	.string	"configStorageIsSaving"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF737:
+	.string	"USE_GYRO_SITL "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF795:
+	.string	"FLASH_Status"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF818:
+	.string	"state"
+.LASF472:
+	.string	"__P(args) args"
+.LASF727:
+	.string	"__enable_irq() "
+.LASF755:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF857:
+	.string	"programWord"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF760:
+	.string	"CONFIG_STORAGE_HEADER_SIZE 8"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF729:
+	.string	"U_ID_1 0"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF825:
+	.string	"recordOffset"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF715:
+	.string	"NULL"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF866:
+	.string	"groupPending"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF739:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF811:
+	.string	"sectionCount"
+.LASF781:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF864:
+	.string	"scanLog"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF724:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF800:
+	.string	"CONFIG_STORAGE_ERASING"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF808:
+	.string	"pageSize"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF817:
+	.string	"stored"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF790:
+	.string	"FLASH_BUSY"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF881:
+	.string	"__builtin_memcmp"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF774:
+	.string	"signed char"
+.LASF785:
+	.string	"uint8_t"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF815:
+	.string	"endOffset"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF770:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF746:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF742:
+	.string	"USE_USART1 "
+.LASF820:
+	.string	"eraseOffset"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF885:
+	.string	"beginSave"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF828:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF732:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF845:
+	.string	"recordData"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF725:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF779:
+	.string	"__uint16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF734:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF877:
+	.string	"sectionSize"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF882:
+	.string	"__builtin_memcpy"
+.LASF756:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF696:
+	.string	"__size_t__ "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF873:
+	.string	"wordCount"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF863:
+	.string	"configStorageInit"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF731:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF849:
+	.string	"writeStep"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF802:
+	.string	"CONFIG_STORAGE_FAILED"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF841:
+	.string	"eraseAllowed"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF776:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF735:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF775:
+	.string	"__int8_t"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF736:
+	.string	"GYRO "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF842:
+	.string	"index"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF794:
+	.string	"FLASH_TIMEOUT"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF843:
+	.string	"section"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF806:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF810:
+	.string	"sections"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF730:
+	.string	"U_ID_2 0"
+.LASF832:
+	.string	"FLASH_ProgramWord"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF821:
+	.string	"attemptsRemaining"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF788:
+	.string	"uintptr_t"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF744:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF865:
+	.string	"group"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF871:
+	.string	"commitWord"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF780:
+	.string	"__uint32_t"
+.LASF752:
+	.string	"M_PI 3.14159265358979323846f"
+.LASF754:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF799:
+	.string	"CONFIG_STORAGE_IDLE"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF830:
+	.string	"FLASH_Unlock"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF835:
+	.string	"memcpy"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF721:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF761:
+	.string	"CONFIG_STORAGE_RECORD_HEADER_SIZE 8"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF836:
+	.string	"crc32Stm32"
+.LASF809:
+	.string	"layout"
+.LASF840:
+	.string	"storage"
+.LASF462:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF765:
+	.string	"COMMIT_WORD_OFFSET 0"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF862:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF886:
+	.string	"isSectionChanged"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF764:
+	.string	"CONFIG_STORAGE_WRITE_ATTEMPTS 3"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF772:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF722:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF826:
+	.string	"dataOffset"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF392:
+	.string	"false 0"
+.LASF814:
+	.string	"sequence"
+.LASF793:
+	.string	"FLASH_COMPLETE"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF797:
+	.string	"offset"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF738:
+	.string	"ACC "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF751:
+	.string	"sq(x) ((x)*(x))"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF867:
+	.string	"findSection"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF390:
+	.string	"bool _Bool"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF745:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF782:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF827:
+	.string	"written"
+.LASF833:
+	.string	"FLASH_ErasePage"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF848:
+	.string	"word"
+.LASF801:
+	.string	"CONFIG_STORAGE_WRITING"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF747:
+	.string	"BLACKBOX "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF813:
+	.string	"activeSlot"
+.LASF726:
+	.string	"__disable_irq() "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF876:
+	.string	"recordSize"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF743:
+	.string	"USE_USART2 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF803:
+	.string	"configStorageState_e"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF858:
+	.string	"nextSectionToWrite"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF768:
+	.string	"RECORD_ID_MASK 0x7F"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF812:
+	.string	"size"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF740:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF870:
+	.string	"readCommitWord"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF869:
+	.string	"length"
+.LASF786:
+	.string	"uint16_t"
+.LASF769:
+	.string	"RECORD_LAST 0x80"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF773:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF758:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF872:
+	.string	"recordCrc"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF855:
+	.string	"appendSize"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF807:
+	.string	"slotSize"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF883:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF837:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF777:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF723:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF874:
+	.string	"recordHeader"
+.LASF859:
+	.string	"configStorageStartSave"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF860:
+	.string	"configStorageLoad"
+.LASF749:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF834:
+	.string	"memcmp"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF819:
+	.string	"spareErased"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF741:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF778:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF750:
+	.string	"CRC32_STM32_INIT 0xFFFFFFFF"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF868:
+	.string	"isErased"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF728:
+	.string	"U_ID_0 0x5349544c"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF733:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF856:
+	.string	"completeSave"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF875:
+	.string	"idAndFlags"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF766:
+	.string	"LAYOUT_WORD_OFFSET 4"
+.LASF880:
+	.string	"slotAddress"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF839:
+	.string	"configStorageProcess"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF861:
+	.string	"configStorageStoredSectionCount"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF853:
+	.string	"status"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF771:
+	.string	"short unsigned int"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF787:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF878:
+	.string	"targetAddress"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF850:
+	.string	"commitCompactedSlot"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF796:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF879:
+	.string	"spareSlot"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF851:
+	.string	"slot"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF804:
+	.string	"configStorageSection_s"
+.LASF798:
+	.string	"configStorageSection_t"
+.LASF854:
+	.string	"restartSave"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF763:
+	.string	"CONFIG_STORAGE_COMPACTED_SIZE(size,sectionCount) (CONFIG_STORAGE_HEADER_SIZE + (size) + (sectionCount) * (CONFIG_STORAGE_RECORD_HEADER_SIZE + 3))"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF757:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF767:
+	.string	"RECORD_CRC_OFFSET 4"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF847:
+	.string	"next"
+.LASF822:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF823:
+	.string	"compacting"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF753:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF824:
+	.string	"sectionIndex"
+.LASF759:
+	.string	"CONFIG_STORAGE_SLOT_COUNT 2"
+.LASF748:
+	.string	"PROFILING "
+.LASF792:
+	.string	"FLASH_ERROR_WRP"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF816:
+	.string	"appendable"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/config/config_storage.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
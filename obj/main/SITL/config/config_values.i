@@ -0,0 +1,6091 @@
+# 0 ".//src/main/config/config_values.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "cleanflight"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "954f0a5"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 ".//src/main/config/config_values.c"
+# 18 ".//src/main/config/config_values.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 19 ".//src/main/config/config_values.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 20 ".//src/main/config/config_values.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 21 ".//src/main/config/config_values.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 22 ".//src/main/config/config_values.c" 2
+
+# 1 ".//src/main/platform.h" 1
+# 18 ".//src/main/platform.h"
+       
+# 49 ".//src/main/platform.h"
+# 1 ".//src/main/target/SITL/sitl_mcu.h" 1
+# 18 ".//src/main/target/SITL/sitl_mcu.h"
+       
+# 27 ".//src/main/target/SITL/sitl_mcu.h"
+
+# 27 ".//src/main/target/SITL/sitl_mcu.h"
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef struct {
+    uint32_t BSRR;
+    uint32_t BRR;
+    uint32_t ODR;
+    uint32_t IDR;
+} GPIO_TypeDef;
+
+extern GPIO_TypeDef sitlGpio[3];
+#define GPIOA (&sitlGpio[0])
+#define GPIOB (&sitlGpio[1])
+#define GPIOC (&sitlGpio[2])
+
+typedef struct {
+    uint8_t index;
+} USART_TypeDef;
+
+extern USART_TypeDef sitlUsart[2];
+#define USART1 (&sitlUsart[0])
+#define USART2 (&sitlUsart[1])
+
+typedef struct {
+    uint8_t unused;
+} TIM_TypeDef, SPI_TypeDef, I2C_TypeDef, DMA_Channel_TypeDef;
+
+typedef int IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+
+
+extern uint8_t sitlFlash[];
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+
+#define __disable_irq() 
+#define __enable_irq() 
+
+
+#define U_ID_0 0x5349544c
+#define U_ID_1 0
+#define U_ID_2 0
+# 50 ".//src/main/platform.h" 2
+
+
+
+# 1 ".//src/main/target/SITL/target.h" 1
+# 18 ".//src/main/target/SITL/target.h"
+       
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+
+
+#define FLASH_PAGE_COUNT 4
+#define FLASH_PAGE_SIZE ((uint16_t)0x800)
+#define FLASH_TO_RESERVE_FOR_CONFIG 0x2000
+#define CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)
+
+#define GYRO 
+#define USE_GYRO_SITL 
+
+#define ACC 
+#define USE_ACC_SITL 
+
+#define BARO 
+#define USE_BARO_SITL 
+
+
+#define USE_USART1 
+#define USE_USART2 
+#define SERIAL_PORT_COUNT 2
+#define SITL_TCP_BASE_PORT 5760
+
+#define SENSORS_SET (SENSOR_ACC | SENSOR_BARO)
+
+#define BLACKBOX 
+#define PROFILING 
+#define FAST_MATH 
+# 54 ".//src/main/platform.h" 2
+# 24 ".//src/main/config/config_values.c" 2
+
+# 1 ".//src/main/common/axis.h" 1
+# 18 ".//src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+#define XYZ_AXIS_COUNT 3
+# 26 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/common/maths.h" 1
+# 18 ".//src/main/common/maths.h"
+       
+
+
+#define sq(x) ((x)*(x))
+
+
+
+#define M_PI 3.14159265358979323846f
+
+
+#define RADX10 (M_PI / 1800.0f)
+#define RAD (M_PI / 180.0f)
+
+#define DEG2RAD(degrees) (degrees * RAD)
+
+#define min(a,b) ((a) < (b) ? (a) : (b))
+#define max(a,b) ((a) > (b) ? (a) : (b))
+#define abs(x) ((x) > 0 ? (x) : -(x))
+
+typedef struct stdev_t
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+int32_t applyDeadband(int32_t value, int32_t deadband);
+
+int constrain(int amt, int low, int high);
+float constrainf(float amt, float low, float high);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+
+
+float pressureToAltitude(float pressure);
+
+
+
+
+
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+float invSqrt_approx(float x);
+# 27 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/common/color.h" 1
+# 18 ".//src/main/common/color.h"
+       
+
+
+typedef enum {
+    RGB_RED = 0,
+    RGB_GREEN,
+    RGB_BLUE
+} colorComponent_e;
+
+#define RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)
+
+struct rgbColor24bpp_s {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+typedef union {
+    struct rgbColor24bpp_s rgb;
+    uint8_t raw[(RGB_BLUE + 1)];
+} rgbColor24bpp_t;
+
+#define HSV_HUE_MAX 359
+#define HSV_SATURATION_MAX 255
+#define HSV_VALUE_MAX 255
+
+typedef enum {
+    HSV_HUE = 0,
+    HSV_SATURATION,
+    HSV_VALUE
+} hsvColorComponent_e;
+
+#define HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)
+
+typedef struct hsvColor_s {
+    uint16_t h;
+    uint8_t s;
+    uint8_t v;
+} hsvColor_t;
+# 28 ".//src/main/config/config_values.c" 2
+
+# 1 ".//src/main/drivers/accgyro.h" 1
+# 18 ".//src/main/drivers/accgyro.h"
+       
+
+extern uint16_t acc_1G;
+
+typedef void (*sensorInitFuncPtr)(void);
+typedef void (*sensorReadFuncPtr)(int16_t *data);
+
+typedef struct gyro_s {
+    sensorInitFuncPtr init;
+    sensorReadFuncPtr read;
+    sensorReadFuncPtr temperature;
+    float scale;
+    uint32_t samplePeriod;
+} gyro_t;
+
+typedef struct acc_s {
+    sensorInitFuncPtr init;
+    sensorReadFuncPtr read;
+    char revisionCode;
+} acc_t;
+# 30 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/drivers/serial.h" 1
+# 18 ".//src/main/drivers/serial.h"
+       
+
+# 1 ".//src/main/common/ring_buffer.h" 1
+# 18 ".//src/main/common/ring_buffer.h"
+       
+
+#define RING_BUFFER_MAX_SIZE 32768
+
+
+
+
+
+
+typedef struct ringBuffer_s {
+    volatile uint8_t *buffer;
+    uint16_t mask;
+    uint16_t head;
+    uint16_t tail;
+    uint16_t highWaterMark;
+} ringBuffer_t;
+
+void ringBufferInit(ringBuffer_t *ringBuffer, volatile uint8_t *buffer, uint16_t size);
+void ringBufferReset(ringBuffer_t *ringBuffer);
+uint16_t ringBufferSize(const ringBuffer_t *ringBuffer);
+
+
+uint16_t ringBufferCount(const ringBuffer_t *ringBuffer);
+uint16_t ringBufferFree(const ringBuffer_t *ringBuffer);
+
+
+
+# 44 ".//src/main/common/ring_buffer.h" 3 4
+_Bool 
+# 44 ".//src/main/common/ring_buffer.h"
+    ringBufferPut(ringBuffer_t *ringBuffer, uint8_t data);
+uint16_t ringBufferWrite(ringBuffer_t *ringBuffer, const uint8_t *data, uint16_t count);
+uint8_t *ringBufferWritePointer(ringBuffer_t *ringBuffer, uint16_t *contiguous);
+void ringBufferProduce(ringBuffer_t *ringBuffer, uint16_t count);
+void ringBufferProduceUpTo(ringBuffer_t *ringBuffer, uint16_t index);
+
+
+
+# 51 ".//src/main/common/ring_buffer.h" 3 4
+_Bool 
+# 51 ".//src/main/common/ring_buffer.h"
+    ringBufferGet(ringBuffer_t *ringBuffer, uint8_t *data);
+uint16_t ringBufferRead(ringBuffer_t *ringBuffer, uint8_t *data, uint16_t maxCount);
+const uint8_t *ringBufferReadPointer(const ringBuffer_t *ringBuffer, uint16_t *contiguous);
+void ringBufferConsume(ringBuffer_t *ringBuffer, uint16_t count);
+# 21 ".//src/main/drivers/serial.h" 2
+
+typedef enum {
+    SERIAL_NOT_INVERTED = 0,
+    SERIAL_INVERTED
+} serialInversion_e;
+
+typedef enum portMode_t {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX,
+    MODE_SBUS = 1 << 2,
+} portMode_t;
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data);
+typedef void (*serialReceiveFrameCallbackPtr)(const uint8_t *frame, uint8_t length);
+
+typedef struct serialPort {
+
+    const struct serialPortVTable *vTable;
+
+    uint8_t identifier;
+    portMode_t mode;
+    serialInversion_e inversion;
+    uint32_t baudRate;
+
+
+    ringBuffer_t rxBuffer;
+    ringBuffer_t txBuffer;
+
+
+    serialReceiveCallbackPtr callback;
+} serialPort_t;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalBytesWaiting)(serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 64 ".//src/main/drivers/serial.h" 3 4
+   _Bool 
+# 64 ".//src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_t mode);
+
+
+    
+# 69 ".//src/main/drivers/serial.h" 3 4
+   _Bool 
+# 69 ".//src/main/drivers/serial.h"
+        (*setRxFrameCallback)(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
+
+    void (*writeBuf)(serialPort_t *instance, const uint8_t *data, uint32_t count);
+
+    uint32_t (*readBuf)(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+
+
+    uint8_t *(*txReserve)(serialPort_t *instance, uint32_t count);
+
+    void (*txCommit)(serialPort_t *instance, uint32_t count);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialTotalBytesWaiting(serialPort_t *instance);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_t mode);
+
+# 86 ".//src/main/drivers/serial.h" 3 4
+_Bool 
+# 86 ".//src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(serialPort_t *instance);
+
+# 87 ".//src/main/drivers/serial.h" 3 4
+_Bool 
+# 87 ".//src/main/drivers/serial.h"
+    serialSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
+uint32_t serialTxBytesFree(serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count);
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+uint8_t *serialTxReserve(serialPort_t *instance, uint32_t count);
+void serialTxCommit(serialPort_t *instance, uint32_t count);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+
+void serialBufferWrite(serialPort_t *instance, const uint8_t *data, uint32_t count);
+uint32_t serialBufferRead(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+uint8_t *serialBufferTxReserve(serialPort_t *instance, uint32_t count);
+void serialBufferTxCommit(serialPort_t *instance, uint32_t count);
+# 31 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/drivers/pwm_rx.h" 1
+# 18 ".//src/main/drivers/pwm_rx.h"
+       
+
+typedef enum {
+    INPUT_FILTERING_DISABLED = 0,
+    INPUT_FILTERING_ENABLED
+} inputFilteringMode_e;
+
+
+struct timerHardware_s;
+
+void ppmInConfig(const struct timerHardware_s *timerHardwarePtr);
+void pwmInConfig(const struct timerHardware_s *timerHardwarePtr, uint8_t channel);
+
+uint16_t pwmRead(uint8_t channel);
+
+
+# 33 ".//src/main/drivers/pwm_rx.h" 3 4
+_Bool 
+# 33 ".//src/main/drivers/pwm_rx.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+void pwmRxInit(inputFilteringMode_e initialInputFilteringMode);
+# 32 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/flight/flight.h" 1
+# 18 ".//src/main/flight/flight.h"
+       
+
+
+typedef enum {
+    PIDROLL,
+    PIDPITCH,
+    PIDYAW,
+    PIDALT,
+    PIDPOS,
+    PIDPOSR,
+    PIDNAVR,
+    PIDLEVEL,
+    PIDMAG,
+    PIDVEL,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+typedef struct pidProfile_s {
+    uint8_t P8[PID_ITEM_COUNT];
+    uint8_t I8[PID_ITEM_COUNT];
+    uint8_t D8[PID_ITEM_COUNT];
+
+    float P_f[3];
+    float I_f[3];
+    float D_f[3];
+    float A_level;
+    float H_level;
+
+    uint8_t dterm_lpf_hz;
+} pidProfile_t;
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH,
+} angle_index_t;
+
+#define ANGLE_INDEX_COUNT 2
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+#define FLIGHT_DYNAMICS_INDEX_COUNT 3
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+typedef struct rollAndPitchTrims_s {
+    int16_t roll;
+    int16_t pitch;
+} rollAndPitchTrims_t_def;
+
+typedef union {
+    int16_t raw[2];
+    rollAndPitchTrims_t_def values;
+} rollAndPitchTrims_t;
+
+typedef struct rollAndPitchInclination_s {
+
+    int16_t rollDeciDegrees;
+    int16_t pitchDeciDegrees;
+} rollAndPitchInclination_t_def;
+
+typedef union {
+    int16_t raw[2];
+    rollAndPitchInclination_t_def values;
+} rollAndPitchInclination_t;
+
+
+#define DEGREES_TO_DECIDEGREES(angle) (angle * 10)
+#define DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)
+
+extern rollAndPitchInclination_t inclination;
+
+extern int16_t gyroData[3];
+extern int16_t gyroZero[3];
+
+extern int16_t gyroADC[3], accADC[3], accSmooth[3];
+extern int32_t accSum[3];
+extern int16_t axisPID[3];
+
+extern int16_t heading, magHold;
+
+extern int32_t EstAlt;
+extern int32_t AltHold;
+extern int32_t EstAlt;
+extern int32_t vario;
+
+void setPIDController(int type);
+void resetRollAndPitchTrims(rollAndPitchTrims_t *rollAndPitchTrims);
+void resetErrorAngle(void);
+void resetErrorGyro(void);
+# 33 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/flight/mixer.h" 1
+# 18 ".//src/main/flight/mixer.h"
+       
+
+#define MAX_SUPPORTED_MOTORS 12
+#define MAX_SUPPORTED_SERVOS 8
+
+
+typedef enum MultiType
+{
+    MULTITYPE_TRI = 1,
+    MULTITYPE_QUADP = 2,
+    MULTITYPE_QUADX = 3,
+    MULTITYPE_BI = 4,
+    MULTITYPE_GIMBAL = 5,
+    MULTITYPE_Y6 = 6,
+    MULTITYPE_HEX6 = 7,
+    MULTITYPE_FLYING_WING = 8,
+    MULTITYPE_Y4 = 9,
+    MULTITYPE_HEX6X = 10,
+    MULTITYPE_OCTOX8 = 11,
+    MULTITYPE_OCTOFLATP = 12,
+    MULTITYPE_OCTOFLATX = 13,
+    MULTITYPE_AIRPLANE = 14,
+    MULTITYPE_HELI_120_CCPM = 15,
+    MULTITYPE_HELI_90_DEG = 16,
+    MULTITYPE_VTAIL4 = 17,
+    MULTITYPE_HEX6H = 18,
+    MULTITYPE_PPM_TO_SERVO = 19,
+    MULTITYPE_DUALCOPTER = 20,
+    MULTITYPE_SINGLECOPTER = 21,
+    MULTITYPE_CUSTOM = 22,
+    MULTITYPE_LAST = 23
+} MultiType;
+
+
+typedef struct motorMixer_t {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+
+typedef struct mixer_t {
+    uint8_t numberMotor;
+    uint8_t useServo;
+    const motorMixer_t *motor;
+} mixer_t;
+
+typedef struct mixerConfig_s {
+    int8_t yaw_direction;
+    uint8_t tri_unarmed_servo;
+} mixerConfig_t;
+
+typedef struct flight3DConfig_s {
+    uint16_t deadband3d_low;
+    uint16_t deadband3d_high;
+    uint16_t neutral3d;
+    uint16_t deadband3d_throttle;
+} flight3DConfig_t;
+
+typedef struct airplaneConfig_t {
+    uint8_t flaps_speed;
+} airplaneConfig_t;
+
+#define CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF
+
+typedef struct servoParam_t {
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+    int8_t forwardFromChannel;
+} servoParam_t;
+
+
+typedef struct mixerSaturation_s {
+    uint32_t mixCount;
+    uint32_t pidScaledCount;
+    uint32_t loweredCount;
+    uint32_t raisedCount;
+} mixerSaturation_t;
+
+extern int16_t motor[12];
+extern int16_t motor_disarmed[12];
+extern int16_t servo[8];
+
+
+# 104 ".//src/main/flight/mixer.h" 3 4
+_Bool 
+# 104 ".//src/main/flight/mixer.h"
+    isMixerUsingServos(void);
+uint8_t getMotorCount(void);
+void writeAllMotors(int16_t mc);
+void mixerLoadMix(int index, motorMixer_t *customMixers);
+void mixerResetMotors(void);
+void mixTable(void);
+void writeServos(void);
+void writeMotors(void);
+const mixerSaturation_t *getMixerSaturation(void);
+void mixerResetSaturation(void);
+# 34 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/flight/navigation.h" 1
+# 18 ".//src/main/flight/navigation.h"
+       
+
+
+typedef enum {
+    NAV_MODE_NONE = 0,
+    NAV_MODE_POSHOLD,
+    NAV_MODE_WP
+} navigationMode_e;
+
+typedef struct gpsProfile_s {
+    uint16_t gps_wp_radius;
+    uint8_t gps_lpf;
+    uint8_t nav_slew_rate;
+    uint8_t nav_controls_heading;
+    uint16_t nav_speed_min;
+    uint16_t nav_speed_max;
+    uint16_t ap_mode;
+} gpsProfile_t;
+
+extern int16_t GPS_angle[2];
+
+extern int32_t GPS_home[2];
+extern int32_t GPS_hold[2];
+
+extern uint16_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+
+extern navigationMode_e nav_mode;
+
+void GPS_reset_home_position(void);
+void GPS_reset_nav(void);
+void GPS_set_next_wp(int32_t* lat, int32_t* lon);
+void gpsUseProfile(gpsProfile_t *gpsProfileToUse);
+void gpsUsePIDs(pidProfile_t *pidProfile);
+void updateGpsStateForHomeAndHoldMode(void);
+void updateGpsWaypointsAndMode(void);
+
+void onGpsNewData(void);
+# 35 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/flight/failsafe.h" 1
+# 18 ".//src/main/flight/failsafe.h"
+       
+
+#define FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)
+
+typedef struct failsafeConfig_s {
+    uint8_t failsafe_delay;
+    uint8_t failsafe_off_delay;
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_min_usec;
+    uint16_t failsafe_max_usec;
+} failsafeConfig_t;
+
+typedef struct failsafeVTable_s {
+    void (*reset)(void);
+    
+# 32 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 32 ".//src/main/flight/failsafe.h"
+        (*shouldForceLanding)(
+# 32 ".//src/main/flight/failsafe.h" 3 4
+                              _Bool 
+# 32 ".//src/main/flight/failsafe.h"
+                                   armed);
+    
+# 33 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 33 ".//src/main/flight/failsafe.h"
+        (*hasTimerElapsed)(void);
+    
+# 34 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 34 ".//src/main/flight/failsafe.h"
+        (*shouldHaveCausedLandingByNow)(void);
+    void (*incrementCounter)(void);
+    void (*updateState)(void);
+    
+# 37 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 37 ".//src/main/flight/failsafe.h"
+        (*isIdle)(void);
+    void (*checkPulse)(uint8_t channel, uint16_t pulseDuration);
+    
+# 39 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 39 ".//src/main/flight/failsafe.h"
+        (*isEnabled)(void);
+    void (*enable)(void);
+
+} failsafeVTable_t;
+
+typedef struct failsafe_s {
+    const failsafeVTable_t *vTable;
+
+    int16_t counter;
+    int16_t events;
+    
+# 49 ".//src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 49 ".//src/main/flight/failsafe.h"
+        enabled;
+} failsafe_t;
+
+void useFailsafeConfig(failsafeConfig_t *failsafeConfigToUse);
+# 36 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/rx/rx.h" 1
+# 18 ".//src/main/rx/rx.h"
+       
+
+#define PWM_RANGE_ZERO 0
+#define PWM_RANGE_MIN 1000
+#define PWM_RANGE_MAX 2000
+#define PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))
+
+#define DEFAULT_SERVO_MIN 1020
+#define DEFAULT_SERVO_MIDDLE 1500
+#define DEFAULT_SERVO_MAX 2000
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_PROVIDER_MAX = SERIALRX_SUMD
+} SerialRXType;
+
+#define SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)
+
+#define MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12
+#define MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8
+#define MAX_SUPPORTED_RC_CHANNEL_COUNT (18)
+
+#define NON_AUX_CHANNEL_COUNT 4
+#define MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)
+
+
+
+
+
+
+#define MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT
+
+
+extern const char rcChannelLetters[];
+
+extern int16_t rcData[(18)];
+
+#define MAX_MAPPABLE_RX_INPUTS 8
+
+typedef struct rxConfig_s {
+    uint8_t rcmap[8];
+    uint8_t serialrx_provider;
+    uint16_t midrc;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint8_t rssi_channel;
+} rxConfig_t;
+
+#define REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    uint8_t auxChannelCount;
+} rxRuntimeConfig_t;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void useRxConfig(rxConfig_t *rxConfigToUse);
+
+typedef uint16_t (*rcReadRawDataPtr)(rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
+
+void updateRx(void);
+
+# 84 ".//src/main/rx/rx.h" 3 4
+_Bool 
+# 84 ".//src/main/rx/rx.h"
+    shouldProcessRx(uint32_t currentTime);
+void calculateRxChannelsAndUpdateFailsafe(uint32_t currentTime);
+
+void parseRcChannels(const char *input, rxConfig_t *rxConfig);
+
+# 88 ".//src/main/rx/rx.h" 3 4
+_Bool 
+# 88 ".//src/main/rx/rx.h"
+    isSerialRxFrameComplete(rxConfig_t *rxConfig);
+
+void updateRSSI(uint32_t currentTime);
+# 37 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/escservo.h" 1
+# 18 ".//src/main/io/escservo.h"
+       
+
+typedef struct escAndServoConfig_s {
+    uint16_t minthrottle;
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+} escAndServoConfig_t;
+# 38 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/gps.h" 1
+# 18 ".//src/main/io/gps.h"
+       
+
+#define LAT 0
+#define LON 1
+
+#define GPS_DEGREES_DIVIDER 10000000L
+
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX
+} gpsProvider_e;
+
+#define GPS_PROVIDER_MAX GPS_UBLOX
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN
+} sbasMode_e;
+
+#define SBAS_MODE_MAX SBAS_GAGAN
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_ON = 0,
+    GPS_AUTOCONFIG_OFF
+} gpsAutoConfig_e;
+#define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e gpsAutoConfig;
+} gpsConfig_t;
+
+typedef enum {
+    GPS_PASSTHROUGH_ENABLED = 1,
+    GPS_PASSTHROUGH_NO_GPS,
+    GPS_PASSTHROUGH_NO_SERIAL_PORT
+} gpsEnablePassthroughResult_e;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef enum {
+    GPS_MESSAGE_STATE_IDLE = 0,
+    GPS_MESSAGE_STATE_INIT,
+    GPS_MESSAGE_STATE_SBAS,
+    GPS_MESSAGE_STATE_MAX = GPS_MESSAGE_STATE_SBAS
+} gpsMessageState_e;
+
+#define GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)
+
+typedef struct gpsData_t {
+    uint8_t state;
+    uint8_t baudrateIndex;
+    int errors;
+    uint32_t lastMessage;
+    uint32_t lastLastMessage;
+
+    uint32_t state_position;
+    uint32_t state_ts;
+    gpsMessageState_e messageState;
+} gpsData_t;
+
+extern gpsData_t gpsData;
+extern int32_t GPS_coord[2];
+
+extern uint8_t GPS_numSat;
+extern uint16_t GPS_hdop;
+extern uint8_t GPS_update;
+
+extern uint16_t GPS_altitude;
+extern uint16_t GPS_speed;
+extern uint16_t GPS_ground_course;
+extern uint8_t GPS_numCh;
+extern uint8_t GPS_svinfo_chn[16];
+extern uint8_t GPS_svinfo_svid[16];
+extern uint8_t GPS_svinfo_quality[16];
+extern uint8_t GPS_svinfo_cno[16];
+
+void gpsThread(void);
+
+# 112 ".//src/main/io/gps.h" 3 4
+_Bool 
+# 112 ".//src/main/io/gps.h"
+    gpsNewFrame(uint8_t c);
+gpsEnablePassthroughResult_e gpsEnablePassthrough(void);
+void updateGpsIndicator(uint32_t currentTime);
+# 39 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/gimbal.h" 1
+# 18 ".//src/main/io/gimbal.h"
+       
+
+typedef enum GimbalFlags {
+    GIMBAL_NORMAL = 1 << 0,
+    GIMBAL_MIXTILT = 1 << 1,
+    GIMBAL_FORWARDAUX = 1 << 2,
+} GimbalFlags;
+
+typedef struct gimbalConfig_s {
+    uint8_t gimbal_flags;
+} gimbalConfig_t;
+# 40 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/rc_controls.h" 1
+# 18 ".//src/main/io/rc_controls.h"
+       
+
+typedef enum {
+    BOXARM = 0,
+    BOXANGLE,
+    BOXHORIZON,
+    BOXBARO,
+
+    BOXMAG,
+    BOXHEADFREE,
+    BOXHEADADJ,
+    BOXCAMSTAB,
+    BOXCAMTRIG,
+    BOXGPSHOME,
+    BOXGPSHOLD,
+    BOXPASSTHRU,
+    BOXBEEPERON,
+    BOXLEDMAX,
+    BOXLEDLOW,
+    BOXLLIGHTS,
+    BOXCALIB,
+    BOXGOV,
+    BOXOSD,
+    BOXTELEMETRY,
+    BOXAUTOTUNE,
+    BOXSONAR,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+extern uint32_t rcModeActivationMask;
+
+#define IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)
+#define ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8
+} rc_alias_e;
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+#define ROL_LO (1 << (2 * ROLL))
+#define ROL_CE (3 << (2 * ROLL))
+#define ROL_HI (2 << (2 * ROLL))
+#define PIT_LO (1 << (2 * PITCH))
+#define PIT_CE (3 << (2 * PITCH))
+#define PIT_HI (2 << (2 * PITCH))
+#define YAW_LO (1 << (2 * YAW))
+#define YAW_CE (3 << (2 * YAW))
+#define YAW_HI (2 << (2 * YAW))
+#define THR_LO (1 << (2 * THROTTLE))
+#define THR_CE (3 << (2 * THROTTLE))
+#define THR_HI (2 << (2 * THROTTLE))
+
+#define MAX_MODE_ACTIVATION_CONDITION_COUNT 40
+
+
+
+
+
+
+#define CHANNEL_RANGE_MIN 900
+#define CHANNEL_RANGE_MAX 2100
+
+#define MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)
+#define CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)
+
+#define MIN_MODE_RANGE_STEP 0
+#define MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+
+
+
+
+
+    uint8_t rangeStartStep;
+    uint8_t rangeEndStep;
+} modeActivationCondition_t;
+
+#define IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)
+
+typedef struct controlRateConfig_s {
+    uint8_t rcRate8;
+    uint8_t rcExpo8;
+    uint8_t thrMid8;
+    uint8_t thrExpo8;
+    uint8_t rollPitchRate;
+    uint8_t yawRate;
+} controlRateConfig_t;
+
+extern int16_t rcCommand[4];
+
+
+# 126 ".//src/main/io/rc_controls.h" 3 4
+_Bool 
+# 126 ".//src/main/io/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+throttleStatus_e calculateThrottleStatus(rxConfig_t *rxConfig, uint16_t deadband3d_throttle);
+void processRcStickPositions(rxConfig_t *rxConfig, throttleStatus_e throttleStatus, 
+# 128 ".//src/main/io/rc_controls.h" 3 4
+                                                                                   _Bool 
+# 128 ".//src/main/io/rc_controls.h"
+                                                                                        retarded_arm, 
+# 128 ".//src/main/io/rc_controls.h" 3 4
+                                                                                                      _Bool 
+# 128 ".//src/main/io/rc_controls.h"
+                                                                                                           disarm_kill_switch);
+
+
+void updateActivatedModes(modeActivationCondition_t *modeActivationConditions);
+void useRcControlsConfig(modeActivationCondition_t *modeActivationConditions);
+# 41 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/serial.h" 1
+# 18 ".//src/main/io/serial.h"
+       
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_CLI = (1 << 1),
+    FUNCTION_TELEMETRY = (1 << 2),
+    FUNCTION_SERIAL_RX = (1 << 3),
+    FUNCTION_GPS = (1 << 4),
+    FUNCTION_GPS_PASSTHROUGH = (1 << 5),
+    FUNCTION_BLACKBOX = (1 << 6)
+} serialPortFunction_e;
+
+typedef enum {
+    NO_AUTOBAUD = 0,
+    AUTOBAUD
+} autoBaud_e;
+
+typedef struct functionConstraint_s {
+    serialPortFunction_e function;
+    uint32_t minBaudRate;
+    uint32_t maxBaudRate;
+    autoBaud_e autoBaud;
+    uint8_t requiredSerialPortFeatures;
+} functionConstraint_t;
+
+typedef enum {
+    SCENARIO_UNUSED = FUNCTION_NONE,
+
+    SCENARIO_CLI_ONLY = FUNCTION_CLI,
+    SCENARIO_GPS_ONLY = FUNCTION_GPS,
+    SCENARIO_GPS_PASSTHROUGH_ONLY = FUNCTION_GPS_PASSTHROUGH,
+    SCENARIO_MSP_ONLY = FUNCTION_MSP,
+    SCENARIO_MSP_CLI_GPS_PASTHROUGH = FUNCTION_CLI | FUNCTION_MSP | FUNCTION_GPS_PASSTHROUGH,
+    SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH = FUNCTION_MSP | FUNCTION_CLI | FUNCTION_TELEMETRY | FUNCTION_GPS_PASSTHROUGH,
+    SCENARIO_SERIAL_RX_ONLY = FUNCTION_SERIAL_RX,
+    SCENARIO_TELEMETRY_ONLY = FUNCTION_TELEMETRY,
+    SCENARIO_BLACKBOX_ONLY = FUNCTION_BLACKBOX,
+} serialPortFunctionScenario_e;
+
+#define SERIAL_PORT_SCENARIO_COUNT 10
+#define SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)
+extern const serialPortFunctionScenario_e serialPortScenarios[10];
+
+typedef enum {
+    SERIAL_PORT_1 = 0,
+    SERIAL_PORT_2,
+# 74 ".//src/main/io/serial.h"
+} serialPortIndex_e;
+# 90 ".//src/main/io/serial.h"
+typedef enum {
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_SOFTSERIAL1,
+    SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+#define SERIAL_PORT_IDENTIFIER_COUNT 5
+
+
+
+typedef enum {
+    SPF_NONE = 0,
+    SPF_SUPPORTS_CALLBACK = (1 << 0),
+    SPF_SUPPORTS_SBUS_MODE = (1 << 1),
+    SPF_IS_SOFTWARE_INVERTABLE = (1 << 2)
+} serialPortFeature_t;
+
+typedef struct serialPortConstraint_s {
+    const serialPortIdentifier_e identifier;
+    uint32_t minBaudRate;
+    uint32_t maxBaudRate;
+    serialPortFeature_t feature;
+} serialPortConstraint_t;
+
+typedef struct serialPortFunction_s {
+    serialPortIdentifier_e identifier;
+    serialPort_t *port;
+    serialPortFunctionScenario_e scenario;
+    serialPortFunction_e currentFunction;
+} serialPortFunction_t;
+
+typedef struct serialPortFunctionList_s {
+    uint8_t serialPortCount;
+    serialPortFunction_t *functions;
+} serialPortFunctionList_t;
+
+typedef struct serialConfig_s {
+    uint8_t serial_port_scenario[2];
+    uint32_t msp_baudrate;
+    uint32_t cli_baudrate;
+    uint32_t gps_baudrate;
+    uint32_t gps_passthrough_baudrate;
+
+    uint8_t reboot_character;
+} serialConfig_t;
+
+uint8_t lookupScenarioIndex(serialPortFunctionScenario_e scenario);
+
+serialPort_t *findOpenSerialPort(uint16_t functionMask);
+serialPort_t *openSerialPort(serialPortFunction_e functionMask, serialReceiveCallbackPtr callback, uint32_t baudRate, portMode_t mode, serialInversion_e inversion);
+
+
+# 143 ".//src/main/io/serial.h" 3 4
+_Bool 
+# 143 ".//src/main/io/serial.h"
+    canOpenSerialPort(serialPortFunction_e function);
+void beginSerialPortFunction(serialPort_t *port, serialPortFunction_e function);
+void endSerialPortFunction(serialPort_t *port, serialPortFunction_e function);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+void applySerialConfigToPortFunctions(serialConfig_t *serialConfig);
+
+# 150 ".//src/main/io/serial.h" 3 4
+_Bool 
+# 150 ".//src/main/io/serial.h"
+    isSerialConfigValid(serialConfig_t *serialConfig);
+
+# 151 ".//src/main/io/serial.h" 3 4
+_Bool 
+# 151 ".//src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+
+# 152 ".//src/main/io/serial.h" 3 4
+_Bool 
+# 152 ".//src/main/io/serial.h"
+    isSerialPortFunctionShared(serialPortFunction_e functionToUse, uint16_t functionMask);
+
+const serialPortFunctionList_t *getSerialPortFunctionList(void);
+
+void evaluateOtherData(uint8_t sr);
+void handleSerial(void);
+# 42 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/io/ledstrip.h" 1
+# 18 ".//src/main/io/ledstrip.h"
+       
+
+#define MAX_LED_STRIP_LENGTH 32
+
+#define LED_X_BIT_OFFSET 4
+#define LED_Y_BIT_OFFSET 0
+
+#define LED_XY_MASK (0x0F)
+
+#define GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)
+#define GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)
+
+#define CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)
+#define CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)
+
+#define CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))
+
+typedef enum {
+    LED_DISABLED = 0,
+    LED_DIRECTION_NORTH = (1 << 0),
+    LED_DIRECTION_EAST = (1 << 1),
+    LED_DIRECTION_SOUTH = (1 << 2),
+    LED_DIRECTION_WEST = (1 << 3),
+    LED_DIRECTION_UP = (1 << 4),
+    LED_DIRECTION_DOWN = (1 << 5),
+    LED_FUNCTION_INDICATOR = (1 << 6),
+    LED_FUNCTION_WARNING = (1 << 7),
+    LED_FUNCTION_FLIGHT_MODE = (1 << 8),
+    LED_FUNCTION_ARM_STATE = (1 << 9),
+    LED_FUNCTION_THROTTLE = (1 << 10)
+} ledFlag_e;
+
+#define LED_DIRECTION_BIT_OFFSET 0
+#define LED_DIRECTION_MASK 0x3F
+#define LED_FUNCTION_BIT_OFFSET 6
+#define LED_FUNCTION_MASK 0x7C0
+
+
+typedef struct ledConfig_s {
+    uint8_t xy;
+    uint16_t flags;
+} ledConfig_t;
+
+extern uint8_t ledCount;
+
+#define CONFIGURABLE_COLOR_COUNT 16
+
+
+
+# 66 ".//src/main/io/ledstrip.h" 3 4
+_Bool 
+# 66 ".//src/main/io/ledstrip.h"
+    parseLedStripConfig(uint8_t ledIndex, const char *config);
+void updateLedStrip(void);
+
+void applyDefaultLedStripConfig(ledConfig_t *ledConfig);
+void generateLedConfig(uint8_t ledIndex, char *ledConfigBuffer, size_t bufferSize);
+
+
+# 72 ".//src/main/io/ledstrip.h" 3 4
+_Bool 
+# 72 ".//src/main/io/ledstrip.h"
+    parseColor(uint8_t index, char *colorConfig);
+void applyDefaultColors(hsvColor_t *colors, uint8_t colorCount);
+
+void ledStripEnable(void);
+# 43 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/battery.h" 1
+# 18 ".//src/main/sensors/battery.h"
+       
+
+#define VBAT_SCALE_DEFAULT 110
+#define VBAT_SCALE_MIN 0
+#define VBAT_SCALE_MAX 255
+
+typedef struct batteryConfig_s {
+    uint8_t vbatscale;
+    uint8_t vbatmaxcellvoltage;
+    uint8_t vbatmincellvoltage;
+
+    uint16_t currentMeterScale;
+    uint16_t currentMeterOffset;
+
+
+    uint8_t multiwiiCurrentMeterOutput;
+} batteryConfig_t;
+
+extern uint8_t vbat;
+extern uint8_t batteryCellCount;
+extern uint16_t batteryWarningVoltage;
+extern int32_t amperage;
+extern int32_t mAhDrawn;
+
+uint16_t batteryAdcToVoltage(uint16_t src);
+
+# 43 ".//src/main/sensors/battery.h" 3 4
+_Bool 
+# 43 ".//src/main/sensors/battery.h"
+    shouldSoundBatteryAlarm(void);
+void updateBatteryVoltage(void);
+void batteryInit(batteryConfig_t *initialBatteryConfig);
+
+void updateCurrentMeter(int32_t lastUpdateAt);
+int32_t currentMeterToCentiamps(uint16_t src);
+
+uint32_t calculateBatteryPercentage(void);
+# 44 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/boardalignment.h" 1
+# 18 ".//src/main/sensors/boardalignment.h"
+       
+
+typedef struct boardAlignment_s {
+    int16_t rollDegrees;
+    int16_t pitchDegrees;
+    int16_t yawDegrees;
+} boardAlignment_t;
+
+void alignSensors(int16_t *src, int16_t *dest, uint8_t rotation);
+void initBoardAlignment(boardAlignment_t *boardAlignment);
+# 45 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/sensors.h" 1
+# 18 ".//src/main/sensors/sensors.h"
+       
+
+#define CALIBRATING_GYRO_CYCLES 1000
+#define CALIBRATING_ACC_CYCLES 400
+#define CALIBRATING_BARO_CYCLES 200
+
+
+#define CHECKING_GYRO_CYCLES 100
+#define CHECKING_BARO_CYCLES 40
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_SONAR = 1 << 4,
+    SENSOR_GPS = 1 << 5,
+    SENSOR_GPSMAG = 1 << 6,
+} sensors_e;
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef struct sensorAlignmentConfig_s {
+    sensor_align_e gyro_align;
+    sensor_align_e acc_align;
+    sensor_align_e mag_align;
+} sensorAlignmentConfig_t;
+
+
+typedef struct knownSensors_s {
+    uint8_t gyroHardware;
+    uint8_t accHardware;
+    uint8_t baroHardware;
+    uint8_t calibrated;
+    int16_t gyroZero[3];
+    int32_t baroGroundPressure;
+} knownSensors_t;
+
+extern int16_t heading;
+# 46 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/acceleration.h" 1
+# 18 ".//src/main/sensors/acceleration.h"
+       
+
+
+typedef enum AccelSensors {
+    ACC_DEFAULT = 0,
+    ACC_ADXL345 = 1,
+    ACC_MPU6050 = 2,
+    ACC_MMA8452 = 3,
+    ACC_BMA280 = 4,
+    ACC_LSM303DLHC = 5,
+    ACC_SPI_MPU6000 = 6,
+    ACC_SPI_MPU6500 = 7,
+    ACC_FAKE = 8,
+    ACC_NONE = 9
+} AccelSensors;
+
+extern uint8_t accHardware;
+extern sensor_align_e accAlign;
+extern acc_t acc;
+extern uint16_t acc_1G;
+
+typedef struct accDeadband_s {
+    uint8_t xy;
+    uint8_t z;
+} accDeadband_t;
+
+
+# 44 ".//src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 44 ".//src/main/sensors/acceleration.h"
+    isAccelerationCalibrationComplete(void);
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void updateAccelerationReadings(rollAndPitchTrims_t *rollAndPitchTrims);
+void setAccelerationTrims(flightDynamicsTrims_t *accelerationTrimsToUse);
+# 47 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/gyro.h" 1
+# 18 ".//src/main/sensors/gyro.h"
+       
+
+
+typedef enum {
+    GYRO_DEFAULT = 0,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_SPI_MPU6000,
+    GYRO_SPI_MPU6500,
+    GYRO_FAKE
+} gyroSensor_e;
+
+extern gyro_t gyro;
+extern uint8_t gyroHardware;
+extern sensor_align_e gyroAlign;
+
+typedef struct gyroConfig_s {
+    uint8_t gyroMovementCalibrationThreshold;
+    uint16_t soft_gyro_lpf_hz;
+    uint16_t soft_gyro_notch_hz;
+    uint16_t soft_gyro_notch_cutoff_hz;
+} gyroConfig_t;
+
+void useGyroConfig(gyroConfig_t *gyroConfigToUse);
+void gyroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void gyroStartBootCalibration(knownSensors_t *knownSensorsToUse);
+void gyroAccumulateSample(void);
+void gyroGetADC(void);
+
+# 48 ".//src/main/sensors/gyro.h" 3 4
+_Bool 
+# 48 ".//src/main/sensors/gyro.h"
+    isGyroCalibrationComplete(void);
+# 48 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/sensors/barometer.h" 1
+# 18 ".//src/main/sensors/barometer.h"
+       
+
+#define BARO_SAMPLE_COUNT_MAX 48
+
+
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE,
+    BARO_BMP085,
+    BARO_MS5611,
+    BARO_FAKE
+} baroSensor_e;
+
+typedef struct barometerConfig_s {
+    uint8_t baro_sample_count;
+    float baro_noise_lpf;
+    float baro_cf_vel;
+    float baro_cf_alt;
+} barometerConfig_t;
+
+extern uint8_t baroHardware;
+extern int32_t BaroAlt;
+extern int32_t baroTemperature;
+
+
+void useBarometerConfig(barometerConfig_t *barometerConfigToUse);
+
+# 44 ".//src/main/sensors/barometer.h" 3 4
+_Bool 
+# 44 ".//src/main/sensors/barometer.h"
+    isBaroCalibrationComplete(void);
+void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void baroStartBootCalibration(knownSensors_t *knownSensorsToUse);
+void baroUpdate(uint32_t currentTime);
+
+# 48 ".//src/main/sensors/barometer.h" 3 4
+_Bool 
+# 48 ".//src/main/sensors/barometer.h"
+    isBaroReady(void);
+int32_t baroCalculateAltitude(void);
+void performBaroCalibrationCycle(void);
+# 49 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/flight/imu.h" 1
+# 18 ".//src/main/flight/imu.h"
+       
+
+extern int32_t errorVelocityI;
+extern uint8_t velocityControl;
+extern int32_t setVelocity;
+extern int32_t altHoldThrottleAdjustment;
+extern int16_t throttleAngleCorrection;
+extern uint32_t accTimeSum;
+extern int accSumCount;
+extern float accVelScale;
+
+typedef enum {
+    ATTITUDE_ESTIMATOR_COMPLEMENTARY = 0,
+    ATTITUDE_ESTIMATOR_QUATERNION,
+    ATTITUDE_ESTIMATOR_COUNT
+} attitudeEstimator_e;
+
+typedef struct imuRuntimeConfig_s {
+    uint8_t acc_lpf_hz;
+    uint8_t acc_unarmedcal;
+    float gyro_cmpf_factor;
+    float gyro_cmpfm_factor;
+    uint8_t attitude_estimator;
+    float dcm_kp;
+    float dcm_ki;
+    int8_t small_angle;
+} imuRuntimeConfig_t;
+
+void configureImu(imuRuntimeConfig_t *initialImuRuntimeConfig, pidProfile_t *initialPidProfile, accDeadband_t *initialAccDeadband);
+
+void calculateEstimatedAltitude(uint32_t currentTime);
+void computeIMU(rollAndPitchTrims_t *accelerometerTrims, uint8_t mixerConfiguration);
+void calculateThrottleAngleScale(uint16_t throttle_correction_angle);
+int16_t calculateThrottleAngleCorrection(uint8_t throttle_correction_value);
+void calculateAccZLowPassFilterRCTimeConstant(float accz_lpf_cutoff);
+
+void accSum_reset(void);
+# 50 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/telemetry/telemetry.h" 1
+# 26 ".//src/main/telemetry/telemetry.h"
+#define TELEMETRY_COMMON_H_ 
+
+typedef enum {
+    TELEMETRY_PROVIDER_FRSKY = 0,
+    TELEMETRY_PROVIDER_HOTT,
+    TELEMETRY_PROVIDER_MSP,
+    TELEMETRY_PROVIDER_MAX = TELEMETRY_PROVIDER_MSP
+} telemetryProvider_e;
+
+typedef enum {
+    FRSKY_FORMAT_DMS = 0,
+    FRSKY_FORMAT_NMEA
+} frskyGpsCoordFormat_e;
+
+typedef enum {
+    FRSKY_UNIT_METRICS = 0,
+    FRSKY_UNIT_IMPERIALS
+} frskyUnit_e;
+typedef struct telemetryConfig_s {
+    telemetryProvider_e telemetry_provider;
+    uint8_t telemetry_switch;
+    serialInversion_e frsky_inversion;
+ float gpsNoFixLatitude;
+    float gpsNoFixLongitude;
+    frskyGpsCoordFormat_e frsky_coordinate_format;
+    frskyUnit_e frsky_unit;
+    uint16_t batterySize;
+} telemetryConfig_t;
+
+void checkTelemetryState(void);
+void handleTelemetry(void);
+
+uint32_t getTelemetryProviderBaudRate(void);
+void useTelemetryConfig(telemetryConfig_t *telemetryConfig);
+# 51 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/blackbox/blackbox.h" 1
+# 18 ".//src/main/blackbox/blackbox.h"
+       
+
+#define BLACKBOX_BAUDRATE 115200
+#define BLACKBOX_RATE_DENOM_MAX 32
+
+void blackboxInit(void);
+void blackboxLogIteration(uint32_t currentTime);
+void handleBlackbox(void);
+# 52 ".//src/main/config/config_values.c" 2
+
+# 1 ".//src/main/config/runtime_config.h" 1
+# 18 ".//src/main/config/runtime_config.h"
+       
+
+
+typedef enum {
+    OK_TO_ARM = (1 << 0),
+    PREVENT_ARMING = (1 << 1),
+    ARMED = (1 << 2)
+} armingFlag_e;
+
+extern uint8_t armingFlags;
+
+#define DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))
+#define ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)
+#define ARMING_FLAG(mask) (armingFlags & mask)
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    MAG_MODE = (1 << 2),
+    BARO_MODE = (1 << 3),
+    GPS_HOME_MODE = (1 << 4),
+    GPS_HOLD_MODE = (1 << 5),
+    HEADFREE_MODE = (1 << 6),
+    AUTOTUNE_MODE = (1 << 7),
+    PASSTHRU_MODE = (1 << 8),
+    SONAR_MODE = (1 << 9),
+} flightModeFlags_e;
+
+extern uint16_t flightModeFlags;
+
+#define DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))
+#define ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)
+#define FLIGHT_MODE(mask) (flightModeFlags & mask)
+
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING = (1 << 4),
+} stateFlags_t;
+
+#define DISABLE_STATE(mask) (stateFlags &= ~(mask))
+#define ENABLE_STATE(mask) (stateFlags |= mask)
+#define STATE(mask) (stateFlags & mask)
+
+extern uint8_t stateFlags;
+
+
+
+# 67 ".//src/main/config/runtime_config.h" 3 4
+_Bool 
+# 67 ".//src/main/config/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+
+void mwDisarm(void);
+# 54 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/config/config.h" 1
+# 18 ".//src/main/config/config.h"
+       
+
+typedef enum {
+    FEATURE_RX_PPM = 1 << 0,
+    FEATURE_VBAT = 1 << 1,
+    FEATURE_INFLIGHT_ACC_CAL = 1 << 2,
+    FEATURE_RX_SERIAL = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_SERVO_TILT = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_FAILSAFE = 1 << 8,
+    FEATURE_SONAR = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_CURRENT_METER = 1 << 11,
+    FEATURE_3D = 1 << 12,
+    FEATURE_RX_PARALLEL_PWM = 1 << 13,
+    FEATURE_RX_MSP = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DISPLAY = 1 << 17,
+    FEATURE_BLACKBOX = 1 << 18,
+    FEATURE_ONESHOT125 = 1 << 19,
+    FEATURE_DSHOT = 1 << 20
+} features_e;
+
+
+# 44 ".//src/main/config/config.h" 3 4
+_Bool 
+# 44 ".//src/main/config/config.h"
+    feature(uint32_t mask);
+void featureSet(uint32_t mask);
+void featureClear(uint32_t mask);
+void featureClearAll(void);
+uint32_t featureMask(void);
+
+void copyCurrentProfileToProfileSlot(uint8_t profileSlotIndex);
+
+void initEEPROM(void);
+void resetEEPROM(void);
+void readEEPROM(void);
+void readEEPROMAndNotify(void);
+void writeEEPROM();
+void requestEEPROMWrite(void);
+
+# 58 ".//src/main/config/config.h" 3 4
+_Bool 
+# 58 ".//src/main/config/config.h"
+    isEEPROMWritePending(void);
+void processEEPROMWrite(void);
+void ensureEEPROMContainsValidData(void);
+void saveConfigAndNotify(void);
+void changeProfile(uint8_t profileIndex);
+
+
+# 64 ".//src/main/config/config.h" 3 4
+_Bool 
+# 64 ".//src/main/config/config.h"
+    canSoftwareSerialBeUsed(void);
+# 55 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/config/config_profile.h" 1
+# 18 ".//src/main/config/config_profile.h"
+       
+
+typedef struct profile_s {
+    uint8_t pidController;
+
+    pidProfile_t pidProfile;
+
+    controlRateConfig_t controlRateConfig;
+
+    uint8_t dynThrPID;
+    uint16_t tpa_breakpoint;
+
+    int16_t mag_declination;
+
+
+    rollAndPitchTrims_t accelerometerTrims;
+
+
+    uint8_t acc_lpf_hz;
+    float accz_lpf_cutoff;
+    accDeadband_t accDeadband;
+
+    barometerConfig_t barometerConfig;
+
+
+    uint8_t acc_unarmedcal;
+
+    modeActivationCondition_t modeActivationConditions[40];
+
+
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t alt_hold_deadband;
+    uint8_t alt_hold_fast_change;
+
+    uint16_t throttle_correction_angle;
+    uint8_t throttle_correction_value;
+
+
+    servoParam_t servoConf[8];
+
+
+    failsafeConfig_t failsafeConfig;
+
+
+    mixerConfig_t mixerConfig;
+
+
+    gimbalConfig_t gimbalConfig;
+
+
+
+
+} profile_t;
+# 56 ".//src/main/config/config_values.c" 2
+# 1 ".//src/main/config/config_master.h" 1
+# 18 ".//src/main/config/config_master.h"
+       
+
+#define MAX_PROFILE_COUNT 3
+
+
+typedef struct master_t {
+    uint8_t mixerConfiguration;
+    uint32_t enabledFeatures;
+    uint16_t looptime;
+    uint8_t gyro_sync;
+    uint8_t gyro_sync_denom;
+    uint8_t pid_process_denom;
+    uint8_t emf_avoidance;
+
+    motorMixer_t customMixer[12];
+
+
+    escAndServoConfig_t escAndServoConfig;
+    flight3DConfig_t flight3DConfig;
+
+    uint16_t motor_pwm_rate;
+    uint16_t dshot_rate;
+    uint16_t servo_pwm_rate;
+
+
+
+    sensorAlignmentConfig_t sensorAlignmentConfig;
+    boardAlignment_t boardAlignment;
+
+    int8_t yaw_control_direction;
+    uint8_t acc_hardware;
+    uint16_t gyro_lpf;
+    uint16_t gyro_cmpf_factor;
+    uint16_t gyro_cmpfm_factor;
+    uint8_t attitude_estimator;
+    uint16_t dcm_kp;
+    uint16_t dcm_ki;
+
+    gyroConfig_t gyroConfig;
+
+    uint16_t max_angle_inclination;
+    flightDynamicsTrims_t accZero;
+    flightDynamicsTrims_t magZero;
+    knownSensors_t knownSensors;
+
+    batteryConfig_t batteryConfig;
+
+    rxConfig_t rxConfig;
+    inputFilteringMode_e inputFilteringMode;
+
+    uint8_t retarded_arm;
+    uint8_t disarm_kill_switch;
+    uint8_t small_angle;
+
+    airplaneConfig_t airplaneConfig;
+    int8_t fixedwing_althold_dir;
+
+
+
+
+
+    serialConfig_t serialConfig;
+
+    telemetryConfig_t telemetryConfig;
+
+    uint8_t blackbox_rate_denom;
+
+
+
+
+
+
+    profile_t profile[3];
+    uint8_t current_profile_index;
+} master_t;
+
+extern master_t masterConfig;
+extern profile_t *currentProfile;
+# 57 ".//src/main/config/config_values.c" 2
+
+# 1 ".//src/main/config/config_values.h" 1
+# 18 ".//src/main/config/config_values.h"
+       
+
+typedef enum {
+    VAR_UINT8 = (1 << 0),
+    VAR_INT8 = (1 << 1),
+    VAR_UINT16 = (1 << 2),
+    VAR_INT16 = (1 << 3),
+    VAR_UINT32 = (1 << 4),
+    VAR_FLOAT = (1 << 5),
+
+    MASTER_VALUE = (1 << 6),
+    PROFILE_VALUE = (1 << 7)
+} configValueFlag_e;
+
+#define VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)
+#define SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)
+
+typedef struct configValue_s {
+    const char *name;
+    const uint16_t id;
+    const uint8_t type;
+    const uint16_t offset;
+    const int32_t min;
+    const int32_t max;
+} configValue_t;
+
+typedef union {
+    int32_t int_value;
+    float float_value;
+} int_float_value_t;
+
+extern const configValue_t configValues[];
+extern const uint16_t configValueCount;
+
+const configValue_t *findConfigValueById(uint16_t id);
+const configValue_t *findConfigValueByName(const char *name);
+
+void *configValuePointer(master_t *config, const configValue_t *value, uint8_t profileIndex);
+int_float_value_t configValueGet(const master_t *config, const configValue_t *value, uint8_t profileIndex);
+void configValueSet(master_t *config, const configValue_t *value, uint8_t profileIndex, int_float_value_t newValue);
+
+# 58 ".//src/main/config/config_values.h" 3 4
+_Bool 
+# 58 ".//src/main/config/config_values.h"
+    isConfigValueInRange(const configValue_t *value, int_float_value_t newValue);
+# 59 ".//src/main/config/config_values.c" 2
+
+
+const configValue_t configValues[] = {
+    { "looptime", 1, VAR_UINT16 | MASTER_VALUE, 
+# 62 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 62 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 62 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 62 ".//src/main/config/config_values.c"
+                                                                    looptime
+# 62 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 62 ".//src/main/config/config_values.c"
+                                                                                                , 0, 9000 },
+    { "gyro_sync", 2, VAR_UINT8 | MASTER_VALUE, 
+# 63 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 63 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 63 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 63 ".//src/main/config/config_values.c"
+                                                                    gyro_sync
+# 63 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 63 ".//src/main/config/config_values.c"
+                                                                                                 , 0, 1 },
+    { "gyro_sync_denom", 3, VAR_UINT8 | MASTER_VALUE, 
+# 64 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 64 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 64 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 64 ".//src/main/config/config_values.c"
+                                                                    gyro_sync_denom
+# 64 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 64 ".//src/main/config/config_values.c"
+                                                                                                       , 1, 32 },
+    { "pid_process_denom", 4, VAR_UINT8 | MASTER_VALUE, 
+# 65 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 65 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 65 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 65 ".//src/main/config/config_values.c"
+                                                                    pid_process_denom
+# 65 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 65 ".//src/main/config/config_values.c"
+                                                                                                         , 1, 16 },
+    { "emf_avoidance", 5, VAR_UINT8 | MASTER_VALUE, 
+# 66 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 66 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 66 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 66 ".//src/main/config/config_values.c"
+                                                                    emf_avoidance
+# 66 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 66 ".//src/main/config/config_values.c"
+                                                                                                     , 0, 1 },
+
+    { "mid_rc", 6, VAR_UINT16 | MASTER_VALUE, 
+# 68 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 68 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 68 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 68 ".//src/main/config/config_values.c"
+                                                                    rxConfig.midrc
+# 68 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 68 ".//src/main/config/config_values.c"
+                                                                                                      , 1200, 1700 },
+    { "min_check", 7, VAR_UINT16 | MASTER_VALUE, 
+# 69 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 69 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 69 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 69 ".//src/main/config/config_values.c"
+                                                                    rxConfig.mincheck
+# 69 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 69 ".//src/main/config/config_values.c"
+                                                                                                         , 0, 2000 },
+    { "max_check", 8, VAR_UINT16 | MASTER_VALUE, 
+# 70 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 70 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 70 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 70 ".//src/main/config/config_values.c"
+                                                                    rxConfig.maxcheck
+# 70 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 70 ".//src/main/config/config_values.c"
+                                                                                                         , 0, 2000 },
+    { "rssi_channel", 9, VAR_INT8 | MASTER_VALUE, 
+# 71 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 71 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 71 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 71 ".//src/main/config/config_values.c"
+                                                                    rxConfig.rssi_channel
+# 71 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 71 ".//src/main/config/config_values.c"
+                                                                                                             , 0, (18) },
+    { "input_filtering_mode", 10, VAR_INT8 | MASTER_VALUE, 
+# 72 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 72 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 72 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 72 ".//src/main/config/config_values.c"
+                                                                    inputFilteringMode
+# 72 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 72 ".//src/main/config/config_values.c"
+                                                                                                          , 0, 1 },
+
+    { "min_throttle", 11, VAR_UINT16 | MASTER_VALUE, 
+# 74 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 74 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 74 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 74 ".//src/main/config/config_values.c"
+                                                                    escAndServoConfig.minthrottle
+# 74 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 74 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 2000 },
+    { "max_throttle", 12, VAR_UINT16 | MASTER_VALUE, 
+# 75 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 75 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 75 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 75 ".//src/main/config/config_values.c"
+                                                                    escAndServoConfig.maxthrottle
+# 75 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 75 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 2000 },
+    { "min_command", 13, VAR_UINT16 | MASTER_VALUE, 
+# 76 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 76 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 76 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 76 ".//src/main/config/config_values.c"
+                                                                    escAndServoConfig.mincommand
+# 76 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 76 ".//src/main/config/config_values.c"
+                                                                                                                    , 0, 2000 },
+
+    { "3d_deadband_low", 14, VAR_UINT16 | MASTER_VALUE, 
+# 78 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 78 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 78 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 78 ".//src/main/config/config_values.c"
+                                                                    flight3DConfig.deadband3d_low
+# 78 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 78 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 2000 },
+    { "3d_deadband_high", 15, VAR_UINT16 | MASTER_VALUE, 
+# 79 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 79 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 79 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 79 ".//src/main/config/config_values.c"
+                                                                    flight3DConfig.deadband3d_high
+# 79 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 79 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 2000 },
+    { "3d_neutral", 16, VAR_UINT16 | MASTER_VALUE, 
+# 80 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 80 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 80 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 80 ".//src/main/config/config_values.c"
+                                                                    flight3DConfig.neutral3d
+# 80 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 80 ".//src/main/config/config_values.c"
+                                                                                                                , 0, 2000 },
+    { "3d_deadband_throttle", 17, VAR_UINT16 | MASTER_VALUE, 
+# 81 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 81 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 81 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 81 ".//src/main/config/config_values.c"
+                                                                    flight3DConfig.deadband3d_throttle
+# 81 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 81 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, 2000 },
+
+    { "motor_pwm_rate", 18, VAR_UINT16 | MASTER_VALUE, 
+# 83 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 83 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 83 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 83 ".//src/main/config/config_values.c"
+                                                                    motor_pwm_rate
+# 83 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 83 ".//src/main/config/config_values.c"
+                                                                                                      , 50, 32000 },
+    { "dshot_rate", 152, VAR_UINT16 | MASTER_VALUE, 
+# 84 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 84 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 84 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 84 ".//src/main/config/config_values.c"
+                                                                    dshot_rate
+# 84 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 84 ".//src/main/config/config_values.c"
+                                                                                                  , 150, 1200 },
+    { "servo_pwm_rate", 19, VAR_UINT16 | MASTER_VALUE, 
+# 85 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 85 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 85 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 85 ".//src/main/config/config_values.c"
+                                                                    servo_pwm_rate
+# 85 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 85 ".//src/main/config/config_values.c"
+                                                                                                      , 50, 498 },
+
+    { "retarded_arm", 20, VAR_UINT8 | MASTER_VALUE, 
+# 87 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 87 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 87 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 87 ".//src/main/config/config_values.c"
+                                                                    retarded_arm
+# 87 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 87 ".//src/main/config/config_values.c"
+                                                                                                    , 0, 1 },
+    { "disarm_kill_switch", 21, VAR_UINT8 | MASTER_VALUE, 
+# 88 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 88 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 88 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 88 ".//src/main/config/config_values.c"
+                                                                    disarm_kill_switch
+# 88 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 88 ".//src/main/config/config_values.c"
+                                                                                                          , 0, 1 },
+    { "small_angle", 22, VAR_UINT8 | MASTER_VALUE, 
+# 89 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 89 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 89 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 89 ".//src/main/config/config_values.c"
+                                                                    small_angle
+# 89 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 89 ".//src/main/config/config_values.c"
+                                                                                                   , 0, 180 },
+
+    { "flaps_speed", 23, VAR_UINT8 | MASTER_VALUE, 
+# 91 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 91 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 91 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 91 ".//src/main/config/config_values.c"
+                                                                    airplaneConfig.flaps_speed
+# 91 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 91 ".//src/main/config/config_values.c"
+                                                                                                                  , 0, 100 },
+
+    { "fixedwing_althold_dir", 24, VAR_INT8 | MASTER_VALUE, 
+# 93 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 93 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 93 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 93 ".//src/main/config/config_values.c"
+                                                                    fixedwing_althold_dir
+# 93 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 93 ".//src/main/config/config_values.c"
+                                                                                                             , -1, 1 },
+
+    { "serial_port_1_scenario", 25, VAR_UINT8 | MASTER_VALUE, 
+# 95 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 95 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 95 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 95 ".//src/main/config/config_values.c"
+                                                                    serialConfig.serial_port_scenario[0]
+# 95 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 95 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, (10 - 1) },
+    { "serial_port_2_scenario", 26, VAR_UINT8 | MASTER_VALUE, 
+# 96 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 96 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 96 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 96 ".//src/main/config/config_values.c"
+                                                                    serialConfig.serial_port_scenario[1]
+# 96 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 96 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, (10 - 1) },
+# 105 ".//src/main/config/config_values.c"
+    { "reboot_character", 30, VAR_UINT8 | MASTER_VALUE, 
+# 105 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 105 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 105 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 105 ".//src/main/config/config_values.c"
+                                                                    serialConfig.reboot_character
+# 105 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 105 ".//src/main/config/config_values.c"
+                                                                                                                     , 48, 126 },
+    { "msp_baudrate", 31, VAR_UINT32 | MASTER_VALUE, 
+# 106 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 106 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 106 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 106 ".//src/main/config/config_values.c"
+                                                                    serialConfig.msp_baudrate
+# 106 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 106 ".//src/main/config/config_values.c"
+                                                                                                                 , 1200, 115200 },
+    { "cli_baudrate", 32, VAR_UINT32 | MASTER_VALUE, 
+# 107 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 107 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 107 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 107 ".//src/main/config/config_values.c"
+                                                                    serialConfig.cli_baudrate
+# 107 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 107 ".//src/main/config/config_values.c"
+                                                                                                                 , 1200, 115200 },
+# 134 ".//src/main/config/config_values.c"
+    { "serialrx_provider", 52, VAR_UINT8 | MASTER_VALUE, 
+# 134 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 134 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 134 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 134 ".//src/main/config/config_values.c"
+                                                                    rxConfig.serialrx_provider
+# 134 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 134 ".//src/main/config/config_values.c"
+                                                                                                                  , 0, SERIALRX_PROVIDER_MAX },
+
+    { "telemetry_provider", 53, VAR_UINT8 | MASTER_VALUE, 
+# 136 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 136 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 136 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 136 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.telemetry_provider
+# 136 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 136 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, TELEMETRY_PROVIDER_MAX },
+    { "telemetry_switch", 54, VAR_UINT8 | MASTER_VALUE, 
+# 137 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 137 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 137 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 137 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.telemetry_switch
+# 137 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 137 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 1 },
+    { "frsky_inversion", 55, VAR_UINT8 | MASTER_VALUE, 
+# 138 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 138 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 138 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 138 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.frsky_inversion
+# 138 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 138 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 1 },
+    { "frsky_default_lattitude", 56, VAR_FLOAT | MASTER_VALUE, 
+# 139 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 139 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 139 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 139 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.gpsNoFixLatitude
+# 139 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 139 ".//src/main/config/config_values.c"
+                                                                                                                        , -90, 90 },
+    { "frsky_default_longitude", 57, VAR_FLOAT | MASTER_VALUE, 
+# 140 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 140 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 140 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 140 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.gpsNoFixLongitude
+# 140 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 140 ".//src/main/config/config_values.c"
+                                                                                                                         , -180, 180 },
+    { "frsky_coordinates_format", 58, VAR_UINT8 | MASTER_VALUE, 
+# 141 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 141 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 141 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 141 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.frsky_coordinate_format
+# 141 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 141 ".//src/main/config/config_values.c"
+                                                                                                                               , 0, FRSKY_FORMAT_NMEA },
+    { "frsky_unit", 59, VAR_UINT8 | MASTER_VALUE, 
+# 142 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 142 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 142 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 142 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.frsky_unit
+# 142 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 142 ".//src/main/config/config_values.c"
+                                                                                                                  , 0, FRSKY_UNIT_IMPERIALS },
+    { "frsky_battery_size", 60, VAR_UINT16 | MASTER_VALUE, 
+# 143 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 143 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 143 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 143 ".//src/main/config/config_values.c"
+                                                                    telemetryConfig.batterySize
+# 143 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 143 ".//src/main/config/config_values.c"
+                                                                                                                   , 0, 20000 },
+
+    { "blackbox_rate_denom", 61, VAR_UINT8 | MASTER_VALUE, 
+# 145 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 145 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 145 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 145 ".//src/main/config/config_values.c"
+                                                                    blackbox_rate_denom
+# 145 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 145 ".//src/main/config/config_values.c"
+                                                                                                           , 1, 32 },
+
+    { "vbat_scale", 62, VAR_UINT8 | MASTER_VALUE, 
+# 147 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 147 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 147 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 147 ".//src/main/config/config_values.c"
+                                                                    batteryConfig.vbatscale
+# 147 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 147 ".//src/main/config/config_values.c"
+                                                                                                               , 0, 255 },
+    { "vbat_max_cell_voltage", 63, VAR_UINT8 | MASTER_VALUE, 
+# 148 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 148 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 148 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 148 ".//src/main/config/config_values.c"
+                                                                    batteryConfig.vbatmaxcellvoltage
+# 148 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 148 ".//src/main/config/config_values.c"
+                                                                                                                        , 10, 50 },
+    { "vbat_min_cell_voltage", 64, VAR_UINT8 | MASTER_VALUE, 
+# 149 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 149 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 149 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 149 ".//src/main/config/config_values.c"
+                                                                    batteryConfig.vbatmincellvoltage
+# 149 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 149 ".//src/main/config/config_values.c"
+                                                                                                                        , 10, 50 },
+    { "current_meter_scale", 65, VAR_UINT16 | MASTER_VALUE, 
+# 150 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 150 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 150 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 150 ".//src/main/config/config_values.c"
+                                                                    batteryConfig.currentMeterScale
+# 150 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 150 ".//src/main/config/config_values.c"
+                                                                                                                       , 1, 10000 },
+    { "current_meter_offset", 66, VAR_UINT16 | MASTER_VALUE, 
+# 151 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 151 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 151 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 151 ".//src/main/config/config_values.c"
+                                                                    batteryConfig.currentMeterOffset
+# 151 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 151 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 1650 },
+    { "multiwii_current_meter_output", 67, VAR_UINT8 | MASTER_VALUE, 
+# 152 ".//src/main/config/config_values.c" 3 4
+                                                                       __builtin_offsetof (
+# 152 ".//src/main/config/config_values.c"
+                                                                       master_t
+# 152 ".//src/main/config/config_values.c" 3 4
+                                                                       , 
+# 152 ".//src/main/config/config_values.c"
+                                                                       batteryConfig.multiwiiCurrentMeterOutput
+# 152 ".//src/main/config/config_values.c" 3 4
+                                                                       )
+# 152 ".//src/main/config/config_values.c"
+                                                                                                                                   , 0, 1 },
+
+
+    { "align_gyro", 68, VAR_UINT8 | MASTER_VALUE, 
+# 155 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 155 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 155 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 155 ".//src/main/config/config_values.c"
+                                                                    sensorAlignmentConfig.gyro_align
+# 155 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 155 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 8 },
+    { "align_acc", 69, VAR_UINT8 | MASTER_VALUE, 
+# 156 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 156 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 156 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 156 ".//src/main/config/config_values.c"
+                                                                    sensorAlignmentConfig.acc_align
+# 156 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 156 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 8 },
+    { "align_mag", 70, VAR_UINT8 | MASTER_VALUE, 
+# 157 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 157 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 157 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 157 ".//src/main/config/config_values.c"
+                                                                    sensorAlignmentConfig.mag_align
+# 157 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 157 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 8 },
+
+    { "align_board_roll", 71, VAR_INT16 | MASTER_VALUE, 
+# 159 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 159 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 159 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 159 ".//src/main/config/config_values.c"
+                                                                    boardAlignment.rollDegrees
+# 159 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 159 ".//src/main/config/config_values.c"
+                                                                                                                  , -180, 360 },
+    { "align_board_pitch", 72, VAR_INT16 | MASTER_VALUE, 
+# 160 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 160 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 160 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 160 ".//src/main/config/config_values.c"
+                                                                    boardAlignment.pitchDegrees
+# 160 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 160 ".//src/main/config/config_values.c"
+                                                                                                                   , -180, 360 },
+    { "align_board_yaw", 73, VAR_INT16 | MASTER_VALUE, 
+# 161 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 161 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 161 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 161 ".//src/main/config/config_values.c"
+                                                                    boardAlignment.yawDegrees
+# 161 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 161 ".//src/main/config/config_values.c"
+                                                                                                                 , -180, 360 },
+
+    { "max_angle_inclination", 74, VAR_UINT16 | MASTER_VALUE, 
+# 163 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 163 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 163 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 163 ".//src/main/config/config_values.c"
+                                                                    max_angle_inclination
+# 163 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 163 ".//src/main/config/config_values.c"
+                                                                                                             , 100, 900 },
+
+    { "gyro_lpf", 75, VAR_UINT16 | MASTER_VALUE, 
+# 165 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 165 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 165 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 165 ".//src/main/config/config_values.c"
+                                                                    gyro_lpf
+# 165 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 165 ".//src/main/config/config_values.c"
+                                                                                                , 0, 256 },
+    { "moron_threshold", 76, VAR_UINT8 | MASTER_VALUE, 
+# 166 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 166 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 166 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 166 ".//src/main/config/config_values.c"
+                                                                    gyroConfig.gyroMovementCalibrationThreshold
+# 166 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 166 ".//src/main/config/config_values.c"
+                                                                                                                                   , 0, 128 },
+    { "gyro_soft_lpf_hz", 77, VAR_UINT16 | MASTER_VALUE, 
+# 167 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 167 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 167 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 167 ".//src/main/config/config_values.c"
+                                                                    gyroConfig.soft_gyro_lpf_hz
+# 167 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 167 ".//src/main/config/config_values.c"
+                                                                                                                   , 0, 500 },
+    { "gyro_notch_hz", 78, VAR_UINT16 | MASTER_VALUE, 
+# 168 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 168 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 168 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 168 ".//src/main/config/config_values.c"
+                                                                    gyroConfig.soft_gyro_notch_hz
+# 168 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 168 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 500 },
+    { "gyro_notch_cutoff_hz", 79, VAR_UINT16 | MASTER_VALUE, 
+# 169 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 169 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 169 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 169 ".//src/main/config/config_values.c"
+                                                                    gyroConfig.soft_gyro_notch_cutoff_hz
+# 169 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 169 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 500 },
+    { "gyro_cmpf_factor", 80, VAR_UINT16 | MASTER_VALUE, 
+# 170 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 170 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 170 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 170 ".//src/main/config/config_values.c"
+                                                                    gyro_cmpf_factor
+# 170 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 170 ".//src/main/config/config_values.c"
+                                                                                                        , 100, 1000 },
+    { "gyro_cmpfm_factor", 81, VAR_UINT16 | MASTER_VALUE, 
+# 171 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 171 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 171 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 171 ".//src/main/config/config_values.c"
+                                                                    gyro_cmpfm_factor
+# 171 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 171 ".//src/main/config/config_values.c"
+                                                                                                         , 100, 1000 },
+    { "attitude_estimator", 82, VAR_UINT8 | MASTER_VALUE, 
+# 172 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 172 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 172 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 172 ".//src/main/config/config_values.c"
+                                                                    attitude_estimator
+# 172 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 172 ".//src/main/config/config_values.c"
+                                                                                                          , 0, ATTITUDE_ESTIMATOR_COUNT - 1 },
+    { "dcm_kp", 83, VAR_UINT16 | MASTER_VALUE, 
+# 173 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 173 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 173 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 173 ".//src/main/config/config_values.c"
+                                                                    dcm_kp
+# 173 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 173 ".//src/main/config/config_values.c"
+                                                                                              , 0, 20000 },
+    { "dcm_ki", 84, VAR_UINT16 | MASTER_VALUE, 
+# 174 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 174 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 174 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 174 ".//src/main/config/config_values.c"
+                                                                    dcm_ki
+# 174 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 174 ".//src/main/config/config_values.c"
+                                                                                              , 0, 20000 },
+
+    { "alt_hold_deadband", 85, VAR_UINT8 | PROFILE_VALUE, 
+# 176 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 176 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 176 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 176 ".//src/main/config/config_values.c"
+                                                                    profile[0].alt_hold_deadband
+# 176 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 176 ".//src/main/config/config_values.c"
+                                                                                                                    , 1, 250 },
+    { "alt_hold_fast_change", 86, VAR_UINT8 | PROFILE_VALUE, 
+# 177 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 177 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 177 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 177 ".//src/main/config/config_values.c"
+                                                                    profile[0].alt_hold_fast_change
+# 177 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 177 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 1 },
+
+    { "throttle_correction_value", 87, VAR_UINT8 | PROFILE_VALUE, 
+# 179 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 179 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 179 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 179 ".//src/main/config/config_values.c"
+                                                                    profile[0].throttle_correction_value
+# 179 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 179 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 150 },
+    { "throttle_correction_angle", 88, VAR_UINT16 | PROFILE_VALUE, 
+# 180 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 180 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 180 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 180 ".//src/main/config/config_values.c"
+                                                                    profile[0].throttle_correction_angle
+# 180 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 180 ".//src/main/config/config_values.c"
+                                                                                                                            , 1, 900 },
+
+    { "deadband", 89, VAR_UINT8 | PROFILE_VALUE, 
+# 182 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 182 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 182 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 182 ".//src/main/config/config_values.c"
+                                                                    profile[0].deadband
+# 182 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 182 ".//src/main/config/config_values.c"
+                                                                                                           , 0, 32 },
+    { "yaw_deadband", 90, VAR_UINT8 | PROFILE_VALUE, 
+# 183 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 183 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 183 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 183 ".//src/main/config/config_values.c"
+                                                                    profile[0].yaw_deadband
+# 183 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 183 ".//src/main/config/config_values.c"
+                                                                                                               , 0, 100 },
+    { "yaw_control_direction", 91, VAR_INT8 | MASTER_VALUE, 
+# 184 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 184 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 184 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 184 ".//src/main/config/config_values.c"
+                                                                    yaw_control_direction
+# 184 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 184 ".//src/main/config/config_values.c"
+                                                                                                             , -1, 1 },
+
+    { "yaw_direction", 92, VAR_INT8 | PROFILE_VALUE, 
+# 186 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 186 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 186 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 186 ".//src/main/config/config_values.c"
+                                                                    profile[0].mixerConfig.yaw_direction
+# 186 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 186 ".//src/main/config/config_values.c"
+                                                                                                                            , -1, 1 },
+    { "tri_unarmed_servo", 93, VAR_INT8 | PROFILE_VALUE, 
+# 187 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 187 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 187 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 187 ".//src/main/config/config_values.c"
+                                                                    profile[0].mixerConfig.tri_unarmed_servo
+# 187 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 187 ".//src/main/config/config_values.c"
+                                                                                                                                , 0, 1 },
+
+    { "rc_rate", 94, VAR_UINT8 | PROFILE_VALUE, 
+# 189 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 189 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 189 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 189 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.rcRate8
+# 189 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 189 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 250 },
+    { "rc_expo", 95, VAR_UINT8 | PROFILE_VALUE, 
+# 190 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 190 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 190 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 190 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.rcExpo8
+# 190 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 190 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 100 },
+    { "thr_mid", 96, VAR_UINT8 | PROFILE_VALUE, 
+# 191 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 191 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 191 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 191 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.thrMid8
+# 191 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 191 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 100 },
+    { "thr_expo", 97, VAR_UINT8 | PROFILE_VALUE, 
+# 192 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 192 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 192 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 192 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.thrExpo8
+# 192 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 192 ".//src/main/config/config_values.c"
+                                                                                                                             , 0, 100 },
+    { "roll_pitch_rate", 98, VAR_UINT8 | PROFILE_VALUE, 
+# 193 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 193 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 193 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 193 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.rollPitchRate
+# 193 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 193 ".//src/main/config/config_values.c"
+                                                                                                                                  , 0, 100 },
+    { "yaw_rate", 99, VAR_UINT8 | PROFILE_VALUE, 
+# 194 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 194 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 194 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 194 ".//src/main/config/config_values.c"
+                                                                    profile[0].controlRateConfig.yawRate
+# 194 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 194 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 100 },
+    { "tpa_rate", 100, VAR_UINT8 | PROFILE_VALUE, 
+# 195 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 195 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 195 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 195 ".//src/main/config/config_values.c"
+                                                                    profile[0].dynThrPID
+# 195 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 195 ".//src/main/config/config_values.c"
+                                                                                                            , 0, 100},
+    { "tpa_breakpoint", 101, VAR_UINT16 | PROFILE_VALUE, 
+# 196 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 196 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 196 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 196 ".//src/main/config/config_values.c"
+                                                                    profile[0].tpa_breakpoint
+# 196 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 196 ".//src/main/config/config_values.c"
+                                                                                                                 , 1000, 2000},
+
+    { "failsafe_delay", 102, VAR_UINT8 | PROFILE_VALUE, 
+# 198 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 198 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 198 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 198 ".//src/main/config/config_values.c"
+                                                                    profile[0].failsafeConfig.failsafe_delay
+# 198 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 198 ".//src/main/config/config_values.c"
+                                                                                                                                , 0, 200 },
+    { "failsafe_off_delay", 103, VAR_UINT8 | PROFILE_VALUE, 
+# 199 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 199 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 199 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 199 ".//src/main/config/config_values.c"
+                                                                    profile[0].failsafeConfig.failsafe_off_delay
+# 199 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 199 ".//src/main/config/config_values.c"
+                                                                                                                                    , 0, 200 },
+    { "failsafe_throttle", 104, VAR_UINT16 | PROFILE_VALUE, 
+# 200 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 200 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 200 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 200 ".//src/main/config/config_values.c"
+                                                                    profile[0].failsafeConfig.failsafe_throttle
+# 200 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 200 ".//src/main/config/config_values.c"
+                                                                                                                                   , 1000, 2000 },
+    { "failsafe_min_usec", 105, VAR_UINT16 | PROFILE_VALUE, 
+# 201 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 201 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 201 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 201 ".//src/main/config/config_values.c"
+                                                                    profile[0].failsafeConfig.failsafe_min_usec
+# 201 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 201 ".//src/main/config/config_values.c"
+                                                                                                                                   , 100, 2000 },
+    { "failsafe_max_usec", 106, VAR_UINT16 | PROFILE_VALUE, 
+# 202 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 202 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 202 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 202 ".//src/main/config/config_values.c"
+                                                                    profile[0].failsafeConfig.failsafe_max_usec
+# 202 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 202 ".//src/main/config/config_values.c"
+                                                                                                                                   , 100, 2000 + (2000 - 1000) },
+
+    { "gimbal_flags", 107, VAR_UINT8 | PROFILE_VALUE, 
+# 204 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 204 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 204 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 204 ".//src/main/config/config_values.c"
+                                                                    profile[0].gimbalConfig.gimbal_flags
+# 204 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 204 ".//src/main/config/config_values.c"
+                                                                                                                            , 0, 255},
+
+    { "acc_hardware", 108, VAR_UINT8 | MASTER_VALUE, 
+# 206 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 206 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 206 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 206 ".//src/main/config/config_values.c"
+                                                                    acc_hardware
+# 206 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 206 ".//src/main/config/config_values.c"
+                                                                                                    , 0, 5 },
+    { "acc_lpf_hz", 109, VAR_UINT8 | PROFILE_VALUE, 
+# 207 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 207 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 207 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 207 ".//src/main/config/config_values.c"
+                                                                    profile[0].acc_lpf_hz
+# 207 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 207 ".//src/main/config/config_values.c"
+                                                                                                             , 0, 250 },
+    { "accxy_deadband", 110, VAR_UINT8 | PROFILE_VALUE, 
+# 208 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 208 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 208 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 208 ".//src/main/config/config_values.c"
+                                                                    profile[0].accDeadband.xy
+# 208 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 208 ".//src/main/config/config_values.c"
+                                                                                                                 , 0, 100 },
+    { "accz_deadband", 111, VAR_UINT8 | PROFILE_VALUE, 
+# 209 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 209 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 209 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 209 ".//src/main/config/config_values.c"
+                                                                    profile[0].accDeadband.z
+# 209 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 209 ".//src/main/config/config_values.c"
+                                                                                                                , 0, 100 },
+    { "accz_lpf_cutoff", 112, VAR_FLOAT | PROFILE_VALUE, 
+# 210 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 210 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 210 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 210 ".//src/main/config/config_values.c"
+                                                                    profile[0].accz_lpf_cutoff
+# 210 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 210 ".//src/main/config/config_values.c"
+                                                                                                                  , 1, 20 },
+    { "acc_unarmedcal", 113, VAR_UINT8 | PROFILE_VALUE, 
+# 211 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 211 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 211 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 211 ".//src/main/config/config_values.c"
+                                                                    profile[0].acc_unarmedcal
+# 211 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 211 ".//src/main/config/config_values.c"
+                                                                                                                 , 0, 1 },
+    { "acc_trim_pitch", 114, VAR_INT16 | PROFILE_VALUE, 
+# 212 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 212 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 212 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 212 ".//src/main/config/config_values.c"
+                                                                    profile[0].accelerometerTrims.values.pitch
+# 212 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 212 ".//src/main/config/config_values.c"
+                                                                                                                                  , -300, 300 },
+    { "acc_trim_roll", 115, VAR_INT16 | PROFILE_VALUE, 
+# 213 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 213 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 213 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 213 ".//src/main/config/config_values.c"
+                                                                    profile[0].accelerometerTrims.values.roll
+# 213 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 213 ".//src/main/config/config_values.c"
+                                                                                                                                 , -300, 300 },
+
+    { "baro_tab_size", 116, VAR_UINT8 | PROFILE_VALUE, 
+# 215 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 215 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 215 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 215 ".//src/main/config/config_values.c"
+                                                                    profile[0].barometerConfig.baro_sample_count
+# 215 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 215 ".//src/main/config/config_values.c"
+                                                                                                                                    , 0, 48 },
+    { "baro_noise_lpf", 117, VAR_FLOAT | PROFILE_VALUE, 
+# 216 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 216 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 216 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 216 ".//src/main/config/config_values.c"
+                                                                    profile[0].barometerConfig.baro_noise_lpf
+# 216 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 216 ".//src/main/config/config_values.c"
+                                                                                                                                 , 0, 1 },
+    { "baro_cf_vel", 118, VAR_FLOAT | PROFILE_VALUE, 
+# 217 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 217 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 217 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 217 ".//src/main/config/config_values.c"
+                                                                    profile[0].barometerConfig.baro_cf_vel
+# 217 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 217 ".//src/main/config/config_values.c"
+                                                                                                                              , 0, 1 },
+    { "baro_cf_alt", 119, VAR_FLOAT | PROFILE_VALUE, 
+# 218 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 218 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 218 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 218 ".//src/main/config/config_values.c"
+                                                                    profile[0].barometerConfig.baro_cf_alt
+# 218 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 218 ".//src/main/config/config_values.c"
+                                                                                                                              , 0, 1 },
+
+    { "mag_declination", 120, VAR_INT16 | PROFILE_VALUE, 
+# 220 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 220 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 220 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 220 ".//src/main/config/config_values.c"
+                                                                    profile[0].mag_declination
+# 220 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 220 ".//src/main/config/config_values.c"
+                                                                                                                  , -18000, 18000 },
+
+    { "pid_controller", 121, VAR_UINT8 | PROFILE_VALUE, 
+# 222 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 222 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 222 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 222 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidController
+# 222 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 222 ".//src/main/config/config_values.c"
+                                                                                                                , 0, 2 },
+
+    { "p_pitch", 122, VAR_UINT8 | PROFILE_VALUE, 
+# 224 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 224 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 224 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 224 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[PITCH]
+# 224 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 224 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 200 },
+    { "i_pitch", 123, VAR_UINT8 | PROFILE_VALUE, 
+# 225 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 225 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 225 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 225 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[PITCH]
+# 225 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 225 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 200 },
+    { "d_pitch", 124, VAR_UINT8 | PROFILE_VALUE, 
+# 226 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 226 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 226 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 226 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[PITCH]
+# 226 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 226 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 200 },
+    { "p_roll", 125, VAR_UINT8 | PROFILE_VALUE, 
+# 227 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 227 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 227 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 227 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[ROLL]
+# 227 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 227 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 200 },
+    { "i_roll", 126, VAR_UINT8 | PROFILE_VALUE, 
+# 228 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 228 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 228 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 228 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[ROLL]
+# 228 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 228 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 200 },
+    { "d_roll", 127, VAR_UINT8 | PROFILE_VALUE, 
+# 229 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 229 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 229 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 229 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[ROLL]
+# 229 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 229 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 200 },
+    { "p_yaw", 128, VAR_UINT8 | PROFILE_VALUE, 
+# 230 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 230 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 230 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 230 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[YAW]
+# 230 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 230 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 200 },
+    { "i_yaw", 129, VAR_UINT8 | PROFILE_VALUE, 
+# 231 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 231 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 231 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 231 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[YAW]
+# 231 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 231 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 200 },
+    { "d_yaw", 130, VAR_UINT8 | PROFILE_VALUE, 
+# 232 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 232 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 232 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 232 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[YAW]
+# 232 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 232 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 200 },
+
+    { "p_pitchf", 131, VAR_FLOAT | PROFILE_VALUE, 
+# 234 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 234 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 234 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 234 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P_f[PITCH]
+# 234 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 234 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 100 },
+    { "i_pitchf", 132, VAR_FLOAT | PROFILE_VALUE, 
+# 235 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 235 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 235 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 235 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I_f[PITCH]
+# 235 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 235 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 100 },
+    { "d_pitchf", 133, VAR_FLOAT | PROFILE_VALUE, 
+# 236 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 236 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 236 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 236 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D_f[PITCH]
+# 236 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 236 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 100 },
+    { "p_rollf", 134, VAR_FLOAT | PROFILE_VALUE, 
+# 237 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 237 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 237 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 237 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P_f[ROLL]
+# 237 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 237 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 100 },
+    { "i_rollf", 135, VAR_FLOAT | PROFILE_VALUE, 
+# 238 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 238 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 238 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 238 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I_f[ROLL]
+# 238 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 238 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 100 },
+    { "d_rollf", 136, VAR_FLOAT | PROFILE_VALUE, 
+# 239 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 239 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 239 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 239 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D_f[ROLL]
+# 239 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 239 ".//src/main/config/config_values.c"
+                                                                                                                       , 0, 100 },
+    { "p_yawf", 137, VAR_FLOAT | PROFILE_VALUE, 
+# 240 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 240 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 240 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 240 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P_f[YAW]
+# 240 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 240 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 100 },
+    { "i_yawf", 138, VAR_FLOAT | PROFILE_VALUE, 
+# 241 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 241 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 241 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 241 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I_f[YAW]
+# 241 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 241 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 100 },
+    { "d_yawf", 139, VAR_FLOAT | PROFILE_VALUE, 
+# 242 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 242 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 242 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 242 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D_f[YAW]
+# 242 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 242 ".//src/main/config/config_values.c"
+                                                                                                                      , 0, 100 },
+
+    { "dterm_lpf_hz", 140, VAR_UINT8 | PROFILE_VALUE, 
+# 244 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 244 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 244 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 244 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.dterm_lpf_hz
+# 244 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 244 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, 250 },
+
+    { "level_horizon", 141, VAR_FLOAT | PROFILE_VALUE, 
+# 246 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 246 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 246 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 246 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.H_level
+# 246 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 246 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 10 },
+    { "level_angle", 142, VAR_FLOAT | PROFILE_VALUE, 
+# 247 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 247 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 247 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 247 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.A_level
+# 247 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 247 ".//src/main/config/config_values.c"
+                                                                                                                     , 0, 10 },
+
+    { "p_alt", 143, VAR_UINT8 | PROFILE_VALUE, 
+# 249 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 249 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 249 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 249 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[PIDALT]
+# 249 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 249 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+    { "i_alt", 144, VAR_UINT8 | PROFILE_VALUE, 
+# 250 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 250 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 250 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 250 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[PIDALT]
+# 250 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 250 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+    { "d_alt", 145, VAR_UINT8 | PROFILE_VALUE, 
+# 251 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 251 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 251 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 251 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[PIDALT]
+# 251 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 251 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+
+    { "p_level", 146, VAR_UINT8 | PROFILE_VALUE, 
+# 253 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 253 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 253 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 253 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[PIDLEVEL]
+# 253 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 253 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, 200 },
+    { "i_level", 147, VAR_UINT8 | PROFILE_VALUE, 
+# 254 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 254 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 254 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 254 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[PIDLEVEL]
+# 254 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 254 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, 200 },
+    { "d_level", 148, VAR_UINT8 | PROFILE_VALUE, 
+# 255 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 255 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 255 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 255 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[PIDLEVEL]
+# 255 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 255 ".//src/main/config/config_values.c"
+                                                                                                                          , 0, 200 },
+
+    { "p_vel", 149, VAR_UINT8 | PROFILE_VALUE, 
+# 257 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 257 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 257 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 257 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.P8[PIDVEL]
+# 257 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 257 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+    { "i_vel", 150, VAR_UINT8 | PROFILE_VALUE, 
+# 258 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 258 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 258 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 258 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.I8[PIDVEL]
+# 258 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 258 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+    { "d_vel", 151, VAR_UINT8 | PROFILE_VALUE, 
+# 259 ".//src/main/config/config_values.c" 3 4
+                                                                    __builtin_offsetof (
+# 259 ".//src/main/config/config_values.c"
+                                                                    master_t
+# 259 ".//src/main/config/config_values.c" 3 4
+                                                                    , 
+# 259 ".//src/main/config/config_values.c"
+                                                                    profile[0].pidProfile.D8[PIDVEL]
+# 259 ".//src/main/config/config_values.c" 3 4
+                                                                    )
+# 259 ".//src/main/config/config_values.c"
+                                                                                                                        , 0, 200 },
+};
+
+const uint16_t configValueCount = sizeof(configValues) / sizeof(configValue_t);
+
+const configValue_t *findConfigValueById(uint16_t id)
+{
+    uint16_t i;
+
+    for (i = 0; i < configValueCount; i++) {
+        if (configValues[i].id == id) {
+            return &configValues[i];
+        }
+    }
+    return 
+# 273 ".//src/main/config/config_values.c" 3 4
+          ((void *)0)
+# 273 ".//src/main/config/config_values.c"
+              ;
+}
+
+const configValue_t *findConfigValueByName(const char *name)
+{
+    uint16_t i;
+
+    for (i = 0; i < configValueCount; i++) {
+        if (strcasecmp(configValues[i].name, name) == 0) {
+            return &configValues[i];
+        }
+    }
+    return 
+# 285 ".//src/main/config/config_values.c" 3 4
+          ((void *)0)
+# 285 ".//src/main/config/config_values.c"
+              ;
+}
+
+void *configValuePointer(master_t *config, const configValue_t *value, uint8_t profileIndex)
+{
+    uint8_t *ptr = (uint8_t *)config + value->offset;
+
+    if (value->type & PROFILE_VALUE) {
+        ptr += sizeof(profile_t) * profileIndex;
+    }
+    return ptr;
+}
+
+int_float_value_t configValueGet(const master_t *config, const configValue_t *value, uint8_t profileIndex)
+{
+    int_float_value_t result;
+    const void *ptr = configValuePointer((master_t *)config, value, profileIndex);
+
+    switch (value->type & (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)) {
+        case VAR_UINT8:
+            result.int_value = *(uint8_t *)ptr;
+            break;
+
+        case VAR_INT8:
+            result.int_value = *(int8_t *)ptr;
+            break;
+
+        case VAR_UINT16:
+            result.int_value = *(uint16_t *)ptr;
+            break;
+
+        case VAR_INT16:
+            result.int_value = *(int16_t *)ptr;
+            break;
+
+        case VAR_UINT32:
+            result.int_value = *(uint32_t *)ptr;
+            break;
+
+        case VAR_FLOAT:
+        default:
+            result.float_value = *(float *)ptr;
+            break;
+    }
+    return result;
+}
+
+void configValueSet(master_t *config, const configValue_t *value, uint8_t profileIndex, int_float_value_t newValue)
+{
+    void *ptr = configValuePointer(config, value, profileIndex);
+
+    switch (value->type & (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)) {
+        case VAR_UINT8:
+        case VAR_INT8:
+            *(char *)ptr = (char)newValue.int_value;
+            break;
+
+        case VAR_UINT16:
+        case VAR_INT16:
+            *(short *)ptr = (short)newValue.int_value;
+            break;
+
+        case VAR_UINT32:
+            *(int *)ptr = (int)newValue.int_value;
+            break;
+
+        case VAR_FLOAT:
+            *(float *)ptr = (float)newValue.float_value;
+            break;
+    }
+}
+
+
+# 357 ".//src/main/config/config_values.c" 3 4
+_Bool 
+# 357 ".//src/main/config/config_values.c"
+    isConfigValueInRange(const configValue_t *value, int_float_value_t newValue)
+{
+    if (value->type & VAR_FLOAT) {
+        return newValue.float_value >= value->min && newValue.float_value <= value->max;
+    }
+    return newValue.int_value >= value->min && newValue.int_value <= value->max;
+}
@@ -0,0 +1,11441 @@
+	.file	"config_values.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/config/config_values.c"
+	.section	.text.findConfigValueById,"ax",@progbits
+	.p2align 4
+	.globl	findConfigValueById
+	.type	findConfigValueById, @function
+findConfigValueById:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/config/config_values.c"
+	.loc 1 265 1 view -0
+	.cfi_startproc
+	.loc 1 266 5 view .LVU1
+	.loc 1 268 5 view .LVU2
+	.loc 1 268 19 view .LVU3
+	leaq	8+configValues(%rip), %rdx
+	.loc 1 265 1 is_stmt 0 view .LVU4
+	xorl	%eax, %eax
+	jmp	.L4
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L2:
+	.loc 1 268 40 is_stmt 1 discriminator 2 view .LVU5
+	.loc 1 268 19 discriminator 2 view .LVU6
+	addl	$1, %eax
+.LVL2:
+	.loc 1 268 19 is_stmt 0 discriminator 2 view .LVU7
+	addq	$24, %rdx
+	cmpl	$130, %eax
+	je	.L7
+.LVL3:
+.L4:
+	.loc 1 269 9 is_stmt 1 view .LVU8
+	.loc 1 269 12 is_stmt 0 view .LVU9
+	cmpw	%di, (%rdx)
+	jne	.L2
+	.loc 1 270 13 is_stmt 1 view .LVU10
+	.loc 1 270 20 is_stmt 0 view .LVU11
+	cltq
+.LVL4:
+	.loc 1 270 20 view .LVU12
+	leaq	(%rax,%rax,2), %rdx
+	leaq	configValues(%rip), %rax
+	leaq	(%rax,%rdx,8), %rax
+	ret
+.L7:
+	.loc 1 273 11 view .LVU13
+	xorl	%eax, %eax
+	.loc 1 274 1 view .LVU14
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	findConfigValueById, .-findConfigValueById
+	.section	.text.findConfigValueByName,"ax",@progbits
+	.p2align 4
+	.globl	findConfigValueByName
+	.type	findConfigValueByName, @function
+findConfigValueByName:
+.LVL5:
+.LFB1:
+	.loc 1 277 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 278 5 view .LVU16
+	.loc 1 280 5 view .LVU17
+	.loc 1 280 19 view .LVU18
+	.loc 1 277 1 is_stmt 0 view .LVU19
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	configValues(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%r13, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	xorl	%ebx, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	jmp	.L11
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 280 40 is_stmt 1 discriminator 2 view .LVU20
+	.loc 1 280 19 discriminator 2 view .LVU21
+	addl	$1, %ebx
+.LVL7:
+	.loc 1 280 19 is_stmt 0 discriminator 2 view .LVU22
+	addq	$24, %rbp
+	cmpl	$130, %ebx
+	je	.L14
+.LVL8:
+.L11:
+	.loc 1 281 9 is_stmt 1 view .LVU23
+	.loc 1 281 13 is_stmt 0 view .LVU24
+	movq	0(%rbp), %rdi
+	movq	%r12, %rsi
+	call	strcasecmp@PLT
+.LVL9:
+	.loc 1 281 12 view .LVU25
+	testl	%eax, %eax
+	jne	.L9
+	.loc 1 282 13 is_stmt 1 view .LVU26
+	.loc 1 282 20 is_stmt 0 view .LVU27
+	movslq	%ebx, %rbx
+.LVL10:
+	.loc 1 286 1 view .LVU28
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 282 20 view .LVU29
+	leaq	(%rbx,%rbx,2), %rax
+	.loc 1 286 1 view .LVU30
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	.loc 1 282 20 view .LVU31
+	leaq	0(%r13,%rax,8), %rax
+	.loc 1 286 1 view .LVU32
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL11:
+	.loc 1 286 1 view .LVU33
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL12:
+.L14:
+	.cfi_restore_state
+	.loc 1 286 1 view .LVU34
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	.loc 1 285 11 view .LVU35
+	xorl	%eax, %eax
+	.loc 1 286 1 view .LVU36
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL13:
+	.loc 1 286 1 view .LVU37
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	findConfigValueByName, .-findConfigValueByName
+	.section	.text.configValuePointer,"ax",@progbits
+	.p2align 4
+	.globl	configValuePointer
+	.type	configValuePointer, @function
+configValuePointer:
+.LVL14:
+.LFB2:
+	.loc 1 289 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 290 5 view .LVU39
+	.loc 1 290 45 is_stmt 0 view .LVU40
+	movzwl	12(%rsi), %eax
+	.loc 1 290 14 view .LVU41
+	addq	%rdi, %rax
+.LVL15:
+	.loc 1 292 5 is_stmt 1 view .LVU42
+	.loc 1 292 8 is_stmt 0 view .LVU43
+	cmpb	$0, 10(%rsi)
+	js	.L17
+	.loc 1 296 1 view .LVU44
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 293 9 is_stmt 1 view .LVU45
+	.loc 1 293 34 is_stmt 0 view .LVU46
+	movzbl	%dl, %edx
+	.loc 1 293 34 view .LVU47
+	imulq	$536, %rdx, %rdx
+.LVL16:
+	.loc 1 293 13 view .LVU48
+	addq	%rdx, %rax
+.LVL17:
+	.loc 1 295 5 is_stmt 1 view .LVU49
+	.loc 1 296 1 is_stmt 0 view .LVU50
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	configValuePointer, .-configValuePointer
+	.section	.text.configValueGet,"ax",@progbits
+	.p2align 4
+	.globl	configValueGet
+	.type	configValueGet, @function
+configValueGet:
+.LVL18:
+.LFB3:
+	.loc 1 299 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 300 5 view .LVU52
+	.loc 1 301 5 view .LVU53
+.LBB6:
+.LBI6:
+	.loc 1 288 7 view .LVU54
+.LBB7:
+	.loc 1 290 5 view .LVU55
+	.loc 1 290 45 is_stmt 0 view .LVU56
+	movzwl	12(%rsi), %eax
+	.loc 1 290 14 view .LVU57
+	addq	%rax, %rdi
+.LVL19:
+	.loc 1 292 5 is_stmt 1 view .LVU58
+	.loc 1 292 14 is_stmt 0 view .LVU59
+	movzbl	10(%rsi), %eax
+	.loc 1 292 8 view .LVU60
+	testb	%al, %al
+	jns	.L19
+	.loc 1 293 9 is_stmt 1 view .LVU61
+	.loc 1 293 34 is_stmt 0 view .LVU62
+	movzbl	%dl, %edx
+	.loc 1 293 34 view .LVU63
+	imulq	$536, %rdx, %rdx
+.LVL20:
+	.loc 1 293 13 view .LVU64
+	addq	%rdx, %rdi
+.LVL21:
+.L19:
+	.loc 1 295 5 is_stmt 1 view .LVU65
+	.loc 1 295 5 is_stmt 0 view .LVU66
+.LBE7:
+.LBE6:
+	.loc 1 303 5 is_stmt 1 view .LVU67
+	andl	$63, %eax
+	cmpb	$16, %al
+	ja	.L20
+	.loc 1 303 5 is_stmt 0 view .LVU68
+	leaq	.L22(%rip), %rdx
+	movzbl	%al, %eax
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.configValueGet,"a",@progbits
+	.align 4
+	.align 4
+.L22:
+	.long	.L20-.L22
+	.long	.L26-.L22
+	.long	.L25-.L22
+	.long	.L20-.L22
+	.long	.L24-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L23-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.long	.L20-.L22
+	.section	.text.configValueGet
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.loc 1 326 13 is_stmt 1 view .LVU69
+	.loc 1 326 32 is_stmt 0 view .LVU70
+	movl	(%rdi), %eax
+.LVL22:
+	.loc 1 327 13 is_stmt 1 view .LVU71
+	.loc 1 329 5 view .LVU72
+	.loc 1 330 1 is_stmt 0 view .LVU73
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.loc 1 317 13 is_stmt 1 view .LVU74
+	.loc 1 317 32 is_stmt 0 view .LVU75
+	movswl	(%rdi), %eax
+.LVL23:
+	.loc 1 318 13 is_stmt 1 view .LVU76
+	ret
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.loc 1 305 13 view .LVU77
+	.loc 1 305 32 is_stmt 0 view .LVU78
+	movzbl	(%rdi), %eax
+.LVL25:
+	.loc 1 306 13 is_stmt 1 view .LVU79
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 309 13 view .LVU80
+	.loc 1 309 32 is_stmt 0 view .LVU81
+	movsbl	(%rdi), %eax
+.LVL27:
+	.loc 1 310 13 is_stmt 1 view .LVU82
+	ret
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.loc 1 313 13 view .LVU83
+	.loc 1 313 32 is_stmt 0 view .LVU84
+	movzwl	(%rdi), %eax
+.LVL29:
+	.loc 1 314 13 is_stmt 1 view .LVU85
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	configValueGet, .-configValueGet
+	.section	.text.configValueSet,"ax",@progbits
+	.p2align 4
+	.globl	configValueSet
+	.type	configValueSet, @function
+configValueSet:
+.LVL30:
+.LFB4:
+	.loc 1 333 1 view -0
+	.cfi_startproc
+	.loc 1 334 5 view .LVU87
+.LBB8:
+.LBI8:
+	.loc 1 288 7 view .LVU88
+.LBB9:
+	.loc 1 290 5 view .LVU89
+	.loc 1 290 45 is_stmt 0 view .LVU90
+	movzwl	12(%rsi), %eax
+	.loc 1 290 14 view .LVU91
+	addq	%rax, %rdi
+.LVL31:
+	.loc 1 292 5 is_stmt 1 view .LVU92
+	.loc 1 292 14 is_stmt 0 view .LVU93
+	movzbl	10(%rsi), %eax
+	.loc 1 292 8 view .LVU94
+	testb	%al, %al
+	jns	.L29
+	.loc 1 293 9 is_stmt 1 view .LVU95
+	.loc 1 293 34 is_stmt 0 view .LVU96
+	movzbl	%dl, %edx
+	.loc 1 293 34 view .LVU97
+	imulq	$536, %rdx, %rdx
+.LVL32:
+	.loc 1 293 13 view .LVU98
+	addq	%rdx, %rdi
+.LVL33:
+.L29:
+	.loc 1 295 5 is_stmt 1 view .LVU99
+	.loc 1 295 5 is_stmt 0 view .LVU100
+.LBE9:
+.LBE8:
+	.loc 1 336 5 is_stmt 1 view .LVU101
+	andl	$63, %eax
+	cmpb	$32, %al
+	ja	.L28
+	.loc 1 336 5 is_stmt 0 view .LVU102
+	leaq	.L32(%rip), %rdx
+	movzbl	%al, %eax
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.configValueSet,"a",@progbits
+	.align 4
+	.align 4
+.L32:
+	.long	.L28-.L32
+	.long	.L35-.L32
+	.long	.L35-.L32
+	.long	.L28-.L32
+	.long	.L34-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L34-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L31-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L28-.L32
+	.long	.L31-.L32
+	.section	.text.configValueSet
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 352 13 is_stmt 1 view .LVU103
+	.loc 1 352 27 is_stmt 0 view .LVU104
+	movl	%ecx, (%rdi)
+	.loc 1 353 13 is_stmt 1 view .LVU105
+.L28:
+	.loc 1 355 1 is_stmt 0 view .LVU106
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 344 13 is_stmt 1 view .LVU107
+	.loc 1 344 29 is_stmt 0 view .LVU108
+	movw	%cx, (%rdi)
+	.loc 1 345 13 is_stmt 1 view .LVU109
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 339 13 view .LVU110
+	.loc 1 339 28 is_stmt 0 view .LVU111
+	movb	%cl, (%rdi)
+	.loc 1 340 13 is_stmt 1 view .LVU112
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	configValueSet, .-configValueSet
+	.section	.text.isConfigValueInRange,"ax",@progbits
+	.p2align 4
+	.globl	isConfigValueInRange
+	.type	isConfigValueInRange, @function
+isConfigValueInRange:
+.LVL34:
+.LFB5:
+	.loc 1 358 1 view -0
+	.cfi_startproc
+	.loc 1 359 5 view .LVU114
+	.loc 1 360 45 is_stmt 0 view .LVU115
+	movl	16(%rdi), %edx
+	.loc 1 359 8 view .LVU116
+	testb	$32, 10(%rdi)
+	jne	.L46
+	.loc 1 362 5 is_stmt 1 view .LVU117
+	xorl	%eax, %eax
+	.loc 1 362 45 is_stmt 0 view .LVU118
+	cmpl	%edx, %esi
+	jl	.L36
+	.loc 1 362 45 discriminator 1 view .LVU119
+	cmpl	%esi, 20(%rdi)
+	setge	%al
+.L36:
+	.loc 1 363 1 view .LVU120
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.loc 1 360 9 is_stmt 1 view .LVU121
+	.loc 1 360 37 is_stmt 0 view .LVU122
+	pxor	%xmm1, %xmm1
+	.loc 1 360 24 view .LVU123
+	movd	%esi, %xmm0
+	.loc 1 360 37 view .LVU124
+	cvtsi2ssl	%edx, %xmm1
+	.loc 1 360 51 view .LVU125
+	comiss	%xmm1, %xmm0
+	jb	.L45
+	.loc 1 360 75 discriminator 1 view .LVU126
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	20(%rdi), %xmm1
+	.loc 1 360 51 discriminator 1 view .LVU127
+	comiss	%xmm0, %xmm1
+	setnb	%al
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.loc 1 360 51 discriminator 1 view .LVU128
+	xorl	%eax, %eax
+	.loc 1 360 51 view .LVU129
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	isConfigValueInRange, .-isConfigValueInRange
+	.globl	configValueCount
+	.section	.rodata.configValueCount,"a"
+	.align 2
+	.type	configValueCount, @object
+	.size	configValueCount, 2
+configValueCount:
+	.value	130
+	.globl	configValues
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"looptime"
+.LC1:
+	.string	"gyro_sync"
+.LC2:
+	.string	"gyro_sync_denom"
+.LC3:
+	.string	"pid_process_denom"
+.LC4:
+	.string	"emf_avoidance"
+.LC5:
+	.string	"mid_rc"
+.LC6:
+	.string	"min_check"
+.LC7:
+	.string	"max_check"
+.LC8:
+	.string	"rssi_channel"
+.LC9:
+	.string	"input_filtering_mode"
+.LC10:
+	.string	"min_throttle"
+.LC11:
+	.string	"max_throttle"
+.LC12:
+	.string	"min_command"
+.LC13:
+	.string	"3d_deadband_low"
+.LC14:
+	.string	"3d_deadband_high"
+.LC15:
+	.string	"3d_neutral"
+.LC16:
+	.string	"3d_deadband_throttle"
+.LC17:
+	.string	"motor_pwm_rate"
+.LC18:
+	.string	"dshot_rate"
+.LC19:
+	.string	"servo_pwm_rate"
+.LC20:
+	.string	"retarded_arm"
+.LC21:
+	.string	"disarm_kill_switch"
+.LC22:
+	.string	"small_angle"
+.LC23:
+	.string	"flaps_speed"
+.LC24:
+	.string	"fixedwing_althold_dir"
+.LC25:
+	.string	"serial_port_1_scenario"
+.LC26:
+	.string	"serial_port_2_scenario"
+.LC27:
+	.string	"reboot_character"
+.LC28:
+	.string	"msp_baudrate"
+.LC29:
+	.string	"cli_baudrate"
+.LC30:
+	.string	"serialrx_provider"
+.LC31:
+	.string	"telemetry_provider"
+.LC32:
+	.string	"telemetry_switch"
+.LC33:
+	.string	"frsky_inversion"
+.LC34:
+	.string	"frsky_default_lattitude"
+.LC35:
+	.string	"frsky_default_longitude"
+.LC36:
+	.string	"frsky_coordinates_format"
+.LC37:
+	.string	"frsky_unit"
+.LC38:
+	.string	"frsky_battery_size"
+.LC39:
+	.string	"blackbox_rate_denom"
+.LC40:
+	.string	"vbat_scale"
+.LC41:
+	.string	"vbat_max_cell_voltage"
+.LC42:
+	.string	"vbat_min_cell_voltage"
+.LC43:
+	.string	"current_meter_scale"
+.LC44:
+	.string	"current_meter_offset"
+.LC45:
+	.string	"multiwii_current_meter_output"
+.LC46:
+	.string	"align_gyro"
+.LC47:
+	.string	"align_acc"
+.LC48:
+	.string	"align_mag"
+.LC49:
+	.string	"align_board_roll"
+.LC50:
+	.string	"align_board_pitch"
+.LC51:
+	.string	"align_board_yaw"
+.LC52:
+	.string	"max_angle_inclination"
+.LC53:
+	.string	"gyro_lpf"
+.LC54:
+	.string	"moron_threshold"
+.LC55:
+	.string	"gyro_soft_lpf_hz"
+.LC56:
+	.string	"gyro_notch_hz"
+.LC57:
+	.string	"gyro_notch_cutoff_hz"
+.LC58:
+	.string	"gyro_cmpf_factor"
+.LC59:
+	.string	"gyro_cmpfm_factor"
+.LC60:
+	.string	"attitude_estimator"
+.LC61:
+	.string	"dcm_kp"
+.LC62:
+	.string	"dcm_ki"
+.LC63:
+	.string	"alt_hold_deadband"
+.LC64:
+	.string	"alt_hold_fast_change"
+.LC65:
+	.string	"throttle_correction_value"
+.LC66:
+	.string	"throttle_correction_angle"
+.LC67:
+	.string	"deadband"
+.LC68:
+	.string	"yaw_deadband"
+.LC69:
+	.string	"yaw_control_direction"
+.LC70:
+	.string	"yaw_direction"
+.LC71:
+	.string	"tri_unarmed_servo"
+.LC72:
+	.string	"rc_rate"
+.LC73:
+	.string	"rc_expo"
+.LC74:
+	.string	"thr_mid"
+.LC75:
+	.string	"thr_expo"
+.LC76:
+	.string	"roll_pitch_rate"
+.LC77:
+	.string	"yaw_rate"
+.LC78:
+	.string	"tpa_rate"
+.LC79:
+	.string	"tpa_breakpoint"
+.LC80:
+	.string	"failsafe_delay"
+.LC81:
+	.string	"failsafe_off_delay"
+.LC82:
+	.string	"failsafe_throttle"
+.LC83:
+	.string	"failsafe_min_usec"
+.LC84:
+	.string	"failsafe_max_usec"
+.LC85:
+	.string	"gimbal_flags"
+.LC86:
+	.string	"acc_hardware"
+.LC87:
+	.string	"acc_lpf_hz"
+.LC88:
+	.string	"accxy_deadband"
+.LC89:
+	.string	"accz_deadband"
+.LC90:
+	.string	"accz_lpf_cutoff"
+.LC91:
+	.string	"acc_unarmedcal"
+.LC92:
+	.string	"acc_trim_pitch"
+.LC93:
+	.string	"acc_trim_roll"
+.LC94:
+	.string	"baro_tab_size"
+.LC95:
+	.string	"baro_noise_lpf"
+.LC96:
+	.string	"baro_cf_vel"
+.LC97:
+	.string	"baro_cf_alt"
+.LC98:
+	.string	"mag_declination"
+.LC99:
+	.string	"pid_controller"
+.LC100:
+	.string	"p_pitch"
+.LC101:
+	.string	"i_pitch"
+.LC102:
+	.string	"d_pitch"
+.LC103:
+	.string	"p_roll"
+.LC104:
+	.string	"i_roll"
+.LC105:
+	.string	"d_roll"
+.LC106:
+	.string	"p_yaw"
+.LC107:
+	.string	"i_yaw"
+.LC108:
+	.string	"d_yaw"
+.LC109:
+	.string	"p_pitchf"
+.LC110:
+	.string	"i_pitchf"
+.LC111:
+	.string	"d_pitchf"
+.LC112:
+	.string	"p_rollf"
+.LC113:
+	.string	"i_rollf"
+.LC114:
+	.string	"d_rollf"
+.LC115:
+	.string	"p_yawf"
+.LC116:
+	.string	"i_yawf"
+.LC117:
+	.string	"d_yawf"
+.LC118:
+	.string	"dterm_lpf_hz"
+.LC119:
+	.string	"level_horizon"
+.LC120:
+	.string	"level_angle"
+.LC121:
+	.string	"p_alt"
+.LC122:
+	.string	"i_alt"
+.LC123:
+	.string	"d_alt"
+.LC124:
+	.string	"p_level"
+.LC125:
+	.string	"i_level"
+.LC126:
+	.string	"d_level"
+.LC127:
+	.string	"p_vel"
+.LC128:
+	.string	"i_vel"
+.LC129:
+	.string	"d_vel"
+	.section	.data.rel.ro.local.configValues,"aw"
+	.align 32
+	.type	configValues, @object
+	.size	configValues, 3120
+configValues:
+	.quad	.LC0
+	.value	1
+	.byte	68
+	.zero	1
+	.value	8
+	.zero	2
+	.long	0
+	.long	9000
+	.quad	.LC1
+	.value	2
+	.byte	65
+	.zero	1
+	.value	10
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC2
+	.value	3
+	.byte	65
+	.zero	1
+	.value	11
+	.zero	2
+	.long	1
+	.long	32
+	.quad	.LC3
+	.value	4
+	.byte	65
+	.zero	1
+	.value	12
+	.zero	2
+	.long	1
+	.long	16
+	.quad	.LC4
+	.value	5
+	.byte	65
+	.zero	1
+	.value	13
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC5
+	.value	6
+	.byte	68
+	.zero	1
+	.value	320
+	.zero	2
+	.long	1200
+	.long	1700
+	.quad	.LC6
+	.value	7
+	.byte	68
+	.zero	1
+	.value	322
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC7
+	.value	8
+	.byte	68
+	.zero	1
+	.value	324
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC8
+	.value	9
+	.byte	66
+	.zero	1
+	.value	326
+	.zero	2
+	.long	0
+	.long	18
+	.quad	.LC9
+	.value	10
+	.byte	66
+	.zero	1
+	.value	328
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC10
+	.value	11
+	.byte	68
+	.zero	1
+	.value	208
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC11
+	.value	12
+	.byte	68
+	.zero	1
+	.value	210
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC12
+	.value	13
+	.byte	68
+	.zero	1
+	.value	212
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC13
+	.value	14
+	.byte	68
+	.zero	1
+	.value	214
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC14
+	.value	15
+	.byte	68
+	.zero	1
+	.value	216
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC15
+	.value	16
+	.byte	68
+	.zero	1
+	.value	218
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC16
+	.value	17
+	.byte	68
+	.zero	1
+	.value	220
+	.zero	2
+	.long	0
+	.long	2000
+	.quad	.LC17
+	.value	18
+	.byte	68
+	.zero	1
+	.value	222
+	.zero	2
+	.long	50
+	.long	32000
+	.quad	.LC18
+	.value	152
+	.byte	68
+	.zero	1
+	.value	224
+	.zero	2
+	.long	150
+	.long	1200
+	.quad	.LC19
+	.value	19
+	.byte	68
+	.zero	1
+	.value	226
+	.zero	2
+	.long	50
+	.long	498
+	.quad	.LC20
+	.value	20
+	.byte	65
+	.zero	1
+	.value	332
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC21
+	.value	21
+	.byte	65
+	.zero	1
+	.value	333
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC22
+	.value	22
+	.byte	65
+	.zero	1
+	.value	334
+	.zero	2
+	.long	0
+	.long	180
+	.quad	.LC23
+	.value	23
+	.byte	65
+	.zero	1
+	.value	335
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC24
+	.value	24
+	.byte	66
+	.zero	1
+	.value	336
+	.zero	2
+	.long	-1
+	.long	1
+	.quad	.LC25
+	.value	25
+	.byte	65
+	.zero	1
+	.value	340
+	.zero	2
+	.long	0
+	.long	9
+	.quad	.LC26
+	.value	26
+	.byte	65
+	.zero	1
+	.value	341
+	.zero	2
+	.long	0
+	.long	9
+	.quad	.LC27
+	.value	30
+	.byte	65
+	.zero	1
+	.value	360
+	.zero	2
+	.long	48
+	.long	126
+	.quad	.LC28
+	.value	31
+	.byte	80
+	.zero	1
+	.value	344
+	.zero	2
+	.long	1200
+	.long	115200
+	.quad	.LC29
+	.value	32
+	.byte	80
+	.zero	1
+	.value	348
+	.zero	2
+	.long	1200
+	.long	115200
+	.quad	.LC30
+	.value	52
+	.byte	65
+	.zero	1
+	.value	318
+	.zero	2
+	.long	0
+	.long	3
+	.quad	.LC31
+	.value	53
+	.byte	65
+	.zero	1
+	.value	364
+	.zero	2
+	.long	0
+	.long	2
+	.quad	.LC32
+	.value	54
+	.byte	65
+	.zero	1
+	.value	368
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC33
+	.value	55
+	.byte	65
+	.zero	1
+	.value	372
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC34
+	.value	56
+	.byte	96
+	.zero	1
+	.value	376
+	.zero	2
+	.long	-90
+	.long	90
+	.quad	.LC35
+	.value	57
+	.byte	96
+	.zero	1
+	.value	380
+	.zero	2
+	.long	-180
+	.long	180
+	.quad	.LC36
+	.value	58
+	.byte	65
+	.zero	1
+	.value	384
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC37
+	.value	59
+	.byte	65
+	.zero	1
+	.value	388
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC38
+	.value	60
+	.byte	68
+	.zero	1
+	.value	392
+	.zero	2
+	.long	0
+	.long	20000
+	.quad	.LC39
+	.value	61
+	.byte	65
+	.zero	1
+	.value	396
+	.zero	2
+	.long	1
+	.long	32
+	.quad	.LC40
+	.value	62
+	.byte	65
+	.zero	1
+	.value	300
+	.zero	2
+	.long	0
+	.long	255
+	.quad	.LC41
+	.value	63
+	.byte	65
+	.zero	1
+	.value	301
+	.zero	2
+	.long	10
+	.long	50
+	.quad	.LC42
+	.value	64
+	.byte	65
+	.zero	1
+	.value	302
+	.zero	2
+	.long	10
+	.long	50
+	.quad	.LC43
+	.value	65
+	.byte	68
+	.zero	1
+	.value	304
+	.zero	2
+	.long	1
+	.long	10000
+	.quad	.LC44
+	.value	66
+	.byte	68
+	.zero	1
+	.value	306
+	.zero	2
+	.long	0
+	.long	1650
+	.quad	.LC45
+	.value	67
+	.byte	65
+	.zero	1
+	.value	308
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC46
+	.value	68
+	.byte	65
+	.zero	1
+	.value	228
+	.zero	2
+	.long	0
+	.long	8
+	.quad	.LC47
+	.value	69
+	.byte	65
+	.zero	1
+	.value	232
+	.zero	2
+	.long	0
+	.long	8
+	.quad	.LC48
+	.value	70
+	.byte	65
+	.zero	1
+	.value	236
+	.zero	2
+	.long	0
+	.long	8
+	.quad	.LC49
+	.value	71
+	.byte	72
+	.zero	1
+	.value	240
+	.zero	2
+	.long	-180
+	.long	360
+	.quad	.LC50
+	.value	72
+	.byte	72
+	.zero	1
+	.value	242
+	.zero	2
+	.long	-180
+	.long	360
+	.quad	.LC51
+	.value	73
+	.byte	72
+	.zero	1
+	.value	244
+	.zero	2
+	.long	-180
+	.long	360
+	.quad	.LC52
+	.value	74
+	.byte	68
+	.zero	1
+	.value	268
+	.zero	2
+	.long	100
+	.long	900
+	.quad	.LC53
+	.value	75
+	.byte	68
+	.zero	1
+	.value	248
+	.zero	2
+	.long	0
+	.long	256
+	.quad	.LC54
+	.value	76
+	.byte	65
+	.zero	1
+	.value	260
+	.zero	2
+	.long	0
+	.long	128
+	.quad	.LC55
+	.value	77
+	.byte	68
+	.zero	1
+	.value	262
+	.zero	2
+	.long	0
+	.long	500
+	.quad	.LC56
+	.value	78
+	.byte	68
+	.zero	1
+	.value	264
+	.zero	2
+	.long	0
+	.long	500
+	.quad	.LC57
+	.value	79
+	.byte	68
+	.zero	1
+	.value	266
+	.zero	2
+	.long	0
+	.long	500
+	.quad	.LC58
+	.value	80
+	.byte	68
+	.zero	1
+	.value	250
+	.zero	2
+	.long	100
+	.long	1000
+	.quad	.LC59
+	.value	81
+	.byte	68
+	.zero	1
+	.value	252
+	.zero	2
+	.long	100
+	.long	1000
+	.quad	.LC60
+	.value	82
+	.byte	65
+	.zero	1
+	.value	254
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC61
+	.value	83
+	.byte	68
+	.zero	1
+	.value	256
+	.zero	2
+	.long	0
+	.long	20000
+	.quad	.LC62
+	.value	84
+	.byte	68
+	.zero	1
+	.value	258
+	.zero	2
+	.long	0
+	.long	20000
+	.quad	.LC63
+	.value	85
+	.byte	-127
+	.zero	1
+	.value	854
+	.zero	2
+	.long	1
+	.long	250
+	.quad	.LC64
+	.value	86
+	.byte	-127
+	.zero	1
+	.value	855
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC65
+	.value	87
+	.byte	-127
+	.zero	1
+	.value	858
+	.zero	2
+	.long	0
+	.long	150
+	.quad	.LC66
+	.value	88
+	.byte	-124
+	.zero	1
+	.value	856
+	.zero	2
+	.long	1
+	.long	900
+	.quad	.LC67
+	.value	89
+	.byte	-127
+	.zero	1
+	.value	852
+	.zero	2
+	.long	0
+	.long	32
+	.quad	.LC68
+	.value	90
+	.byte	-127
+	.zero	1
+	.value	853
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC69
+	.value	91
+	.byte	66
+	.zero	1
+	.value	246
+	.zero	2
+	.long	-1
+	.long	1
+	.quad	.LC70
+	.value	92
+	.byte	-126
+	.zero	1
+	.value	932
+	.zero	2
+	.long	-1
+	.long	1
+	.quad	.LC71
+	.value	93
+	.byte	-126
+	.zero	1
+	.value	933
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC72
+	.value	94
+	.byte	-127
+	.zero	1
+	.value	484
+	.zero	2
+	.long	0
+	.long	250
+	.quad	.LC73
+	.value	95
+	.byte	-127
+	.zero	1
+	.value	485
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC74
+	.value	96
+	.byte	-127
+	.zero	1
+	.value	486
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC75
+	.value	97
+	.byte	-127
+	.zero	1
+	.value	487
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC76
+	.value	98
+	.byte	-127
+	.zero	1
+	.value	488
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC77
+	.value	99
+	.byte	-127
+	.zero	1
+	.value	489
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC78
+	.value	100
+	.byte	-127
+	.zero	1
+	.value	490
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC79
+	.value	101
+	.byte	-124
+	.zero	1
+	.value	492
+	.zero	2
+	.long	1000
+	.long	2000
+	.quad	.LC80
+	.value	102
+	.byte	-127
+	.zero	1
+	.value	924
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC81
+	.value	103
+	.byte	-127
+	.zero	1
+	.value	925
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC82
+	.value	104
+	.byte	-124
+	.zero	1
+	.value	926
+	.zero	2
+	.long	1000
+	.long	2000
+	.quad	.LC83
+	.value	105
+	.byte	-124
+	.zero	1
+	.value	928
+	.zero	2
+	.long	100
+	.long	2000
+	.quad	.LC84
+	.value	106
+	.byte	-124
+	.zero	1
+	.value	930
+	.zero	2
+	.long	100
+	.long	3000
+	.quad	.LC85
+	.value	107
+	.byte	-127
+	.zero	1
+	.value	934
+	.zero	2
+	.long	0
+	.long	255
+	.quad	.LC86
+	.value	108
+	.byte	65
+	.zero	1
+	.value	247
+	.zero	2
+	.long	0
+	.long	5
+	.quad	.LC87
+	.value	109
+	.byte	-127
+	.zero	1
+	.value	500
+	.zero	2
+	.long	0
+	.long	250
+	.quad	.LC88
+	.value	110
+	.byte	-127
+	.zero	1
+	.value	508
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC89
+	.value	111
+	.byte	-127
+	.zero	1
+	.value	509
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC90
+	.value	112
+	.byte	-96
+	.zero	1
+	.value	504
+	.zero	2
+	.long	1
+	.long	20
+	.quad	.LC91
+	.value	113
+	.byte	-127
+	.zero	1
+	.value	528
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC92
+	.value	114
+	.byte	-120
+	.zero	1
+	.value	498
+	.zero	2
+	.long	-300
+	.long	300
+	.quad	.LC93
+	.value	115
+	.byte	-120
+	.zero	1
+	.value	496
+	.zero	2
+	.long	-300
+	.long	300
+	.quad	.LC94
+	.value	116
+	.byte	-127
+	.zero	1
+	.value	512
+	.zero	2
+	.long	0
+	.long	48
+	.quad	.LC95
+	.value	117
+	.byte	-96
+	.zero	1
+	.value	516
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC96
+	.value	118
+	.byte	-96
+	.zero	1
+	.value	520
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC97
+	.value	119
+	.byte	-96
+	.zero	1
+	.value	524
+	.zero	2
+	.long	0
+	.long	1
+	.quad	.LC98
+	.value	120
+	.byte	-120
+	.zero	1
+	.value	494
+	.zero	2
+	.long	-18000
+	.long	18000
+	.quad	.LC99
+	.value	121
+	.byte	-127
+	.zero	1
+	.value	400
+	.zero	2
+	.long	0
+	.long	2
+	.quad	.LC100
+	.value	122
+	.byte	-127
+	.zero	1
+	.value	405
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC101
+	.value	123
+	.byte	-127
+	.zero	1
+	.value	415
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC102
+	.value	124
+	.byte	-127
+	.zero	1
+	.value	425
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC103
+	.value	125
+	.byte	-127
+	.zero	1
+	.value	404
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC104
+	.value	126
+	.byte	-127
+	.zero	1
+	.value	414
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC105
+	.value	127
+	.byte	-127
+	.zero	1
+	.value	424
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC106
+	.value	128
+	.byte	-127
+	.zero	1
+	.value	406
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC107
+	.value	129
+	.byte	-127
+	.zero	1
+	.value	416
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC108
+	.value	130
+	.byte	-127
+	.zero	1
+	.value	426
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC109
+	.value	131
+	.byte	-96
+	.zero	1
+	.value	440
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC110
+	.value	132
+	.byte	-96
+	.zero	1
+	.value	452
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC111
+	.value	133
+	.byte	-96
+	.zero	1
+	.value	464
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC112
+	.value	134
+	.byte	-96
+	.zero	1
+	.value	436
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC113
+	.value	135
+	.byte	-96
+	.zero	1
+	.value	448
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC114
+	.value	136
+	.byte	-96
+	.zero	1
+	.value	460
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC115
+	.value	137
+	.byte	-96
+	.zero	1
+	.value	444
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC116
+	.value	138
+	.byte	-96
+	.zero	1
+	.value	456
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC117
+	.value	139
+	.byte	-96
+	.zero	1
+	.value	468
+	.zero	2
+	.long	0
+	.long	100
+	.quad	.LC118
+	.value	140
+	.byte	-127
+	.zero	1
+	.value	480
+	.zero	2
+	.long	0
+	.long	250
+	.quad	.LC119
+	.value	141
+	.byte	-96
+	.zero	1
+	.value	476
+	.zero	2
+	.long	0
+	.long	10
+	.quad	.LC120
+	.value	142
+	.byte	-96
+	.zero	1
+	.value	472
+	.zero	2
+	.long	0
+	.long	10
+	.quad	.LC121
+	.value	143
+	.byte	-127
+	.zero	1
+	.value	407
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC122
+	.value	144
+	.byte	-127
+	.zero	1
+	.value	417
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC123
+	.value	145
+	.byte	-127
+	.zero	1
+	.value	427
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC124
+	.value	146
+	.byte	-127
+	.zero	1
+	.value	411
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC125
+	.value	147
+	.byte	-127
+	.zero	1
+	.value	421
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC126
+	.value	148
+	.byte	-127
+	.zero	1
+	.value	431
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC127
+	.value	149
+	.byte	-127
+	.zero	1
+	.value	413
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC128
+	.value	150
+	.byte	-127
+	.zero	1
+	.value	423
+	.zero	2
+	.long	0
+	.long	200
+	.quad	.LC129
+	.value	151
+	.byte	-127
+	.zero	1
+	.value	433
+	.zero	2
+	.long	0
+	.long	200
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/common/color.h"
+	.file 6 ".//src/main/drivers/serial.h"
+	.file 7 ".//src/main/drivers/pwm_rx.h"
+	.file 8 ".//src/main/flight/flight.h"
+	.file 9 ".//src/main/flight/mixer.h"
+	.file 10 ".//src/main/flight/failsafe.h"
+	.file 11 ".//src/main/rx/rx.h"
+	.file 12 ".//src/main/io/escservo.h"
+	.file 13 ".//src/main/io/gimbal.h"
+	.file 14 ".//src/main/io/rc_controls.h"
+	.file 15 ".//src/main/io/serial.h"
+	.file 16 ".//src/main/sensors/battery.h"
+	.file 17 ".//src/main/sensors/boardalignment.h"
+	.file 18 ".//src/main/sensors/sensors.h"
+	.file 19 ".//src/main/sensors/acceleration.h"
+	.file 20 ".//src/main/sensors/gyro.h"
+	.file 21 ".//src/main/sensors/barometer.h"
+	.file 22 ".//src/main/flight/imu.h"
+	.file 23 ".//src/main/telemetry/telemetry.h"
+	.file 24 ".//src/main/config/config_profile.h"
+	.file 25 ".//src/main/config/config_master.h"
+	.file 26 ".//src/main/config/config_values.h"
+	.file 27 "/usr/include/strings.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1453
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF1230
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL22
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF892
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF893
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF894
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF895
+	.uleb128 0x3
+	.long	.LASF897
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF896
+	.uleb128 0x3
+	.long	.LASF898
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF899
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF900
+	.uleb128 0x3
+	.long	.LASF901
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF902
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF903
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF904
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF905
+	.uleb128 0xb
+	.long	0xb0
+	.uleb128 0x3
+	.long	.LASF906
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x3
+	.long	.LASF907
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x3
+	.long	.LASF908
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0xb
+	.long	0xd4
+	.uleb128 0x3
+	.long	.LASF909
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0xb
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF910
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0xb
+	.long	0xf6
+	.uleb128 0x3
+	.long	.LASF911
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0xe
+	.long	0xb7
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF912
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x5
+	.byte	0x15
+	.long	0x13d
+	.uleb128 0x2
+	.long	.LASF913
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF914
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF915
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x6
+	.byte	0x16
+	.long	0x155
+	.uleb128 0x2
+	.long	.LASF916
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF917
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF918
+	.byte	0x6
+	.byte	0x19
+	.byte	0x3
+	.long	0x13d
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF919
+	.uleb128 0xe
+	.long	0xe5
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x7
+	.byte	0x14
+	.long	0x185
+	.uleb128 0x2
+	.long	.LASF920
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF921
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF922
+	.byte	0x7
+	.byte	0x17
+	.byte	0x3
+	.long	0x16d
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x8
+	.byte	0x15
+	.long	0x1df
+	.uleb128 0x2
+	.long	.LASF923
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF924
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF925
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF926
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF927
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF929
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF930
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF931
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF932
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF933
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF938
+	.byte	0x50
+	.byte	0x8
+	.byte	0x23
+	.long	0x25e
+	.uleb128 0x6
+	.string	"P8"
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0x25e
+	.byte	0
+	.uleb128 0x6
+	.string	"I8"
+	.byte	0x8
+	.byte	0x25
+	.byte	0xd
+	.long	0x25e
+	.byte	0xa
+	.uleb128 0x6
+	.string	"D8"
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0x25e
+	.byte	0x14
+	.uleb128 0x6
+	.string	"P_f"
+	.byte	0x8
+	.byte	0x28
+	.byte	0xb
+	.long	0x26e
+	.byte	0x20
+	.uleb128 0x6
+	.string	"I_f"
+	.byte	0x8
+	.byte	0x29
+	.byte	0xb
+	.long	0x26e
+	.byte	0x2c
+	.uleb128 0x6
+	.string	"D_f"
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xb
+	.long	0x26e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF934
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xb
+	.long	0x118
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF935
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xb
+	.long	0x118
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF936
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x26e
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	0x118
+	.long	0x27e
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF937
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x1df
+	.uleb128 0x5
+	.long	.LASF939
+	.byte	0x6
+	.byte	0x8
+	.byte	0x57
+	.long	0x2be
+	.uleb128 0x1
+	.long	.LASF940
+	.byte	0x8
+	.byte	0x58
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF941
+	.byte	0x8
+	.byte	0x59
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF942
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x3
+	.long	0x28a
+	.uleb128 0x12
+	.byte	0x6
+	.byte	0x8
+	.byte	0x5d
+	.long	0x2e9
+	.uleb128 0x16
+	.string	"raw"
+	.byte	0x5e
+	.long	0x2e9
+	.uleb128 0xf
+	.long	.LASF943
+	.byte	0x8
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x2be
+	.byte	0
+	.uleb128 0x8
+	.long	0xc8
+	.long	0x2f9
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF944
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x2ca
+	.uleb128 0x5
+	.long	.LASF945
+	.byte	0x4
+	.byte	0x8
+	.byte	0x62
+	.long	0x32c
+	.uleb128 0x1
+	.long	.LASF940
+	.byte	0x8
+	.byte	0x63
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF941
+	.byte	0x8
+	.byte	0x64
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF946
+	.byte	0x8
+	.byte	0x65
+	.byte	0x3
+	.long	0x305
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x8
+	.byte	0x67
+	.long	0x357
+	.uleb128 0x16
+	.string	"raw"
+	.byte	0x68
+	.long	0x357
+	.uleb128 0xf
+	.long	.LASF943
+	.byte	0x8
+	.byte	0x69
+	.byte	0x1d
+	.long	0x32c
+	.byte	0
+	.uleb128 0x8
+	.long	0xc8
+	.long	0x367
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF947
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x3
+	.long	0x338
+	.uleb128 0x5
+	.long	.LASF948
+	.byte	0x10
+	.byte	0x9
+	.byte	0x34
+	.long	0x3b4
+	.uleb128 0x1
+	.long	.LASF949
+	.byte	0x9
+	.byte	0x35
+	.byte	0xb
+	.long	0x118
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF940
+	.byte	0x9
+	.byte	0x36
+	.byte	0xb
+	.long	0x118
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF941
+	.byte	0x9
+	.byte	0x37
+	.byte	0xb
+	.long	0x118
+	.byte	0x8
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0x9
+	.byte	0x38
+	.byte	0xb
+	.long	0x118
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF948
+	.byte	0x9
+	.byte	0x39
+	.byte	0x3
+	.long	0x373
+	.uleb128 0x5
+	.long	.LASF950
+	.byte	0x2
+	.byte	0x9
+	.byte	0x42
+	.long	0x3e7
+	.uleb128 0x1
+	.long	.LASF951
+	.byte	0x9
+	.byte	0x43
+	.byte	0xc
+	.long	0xbc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF952
+	.byte	0x9
+	.byte	0x44
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF953
+	.byte	0x9
+	.byte	0x45
+	.byte	0x3
+	.long	0x3c0
+	.uleb128 0x5
+	.long	.LASF954
+	.byte	0x8
+	.byte	0x9
+	.byte	0x47
+	.long	0x434
+	.uleb128 0x1
+	.long	.LASF955
+	.byte	0x9
+	.byte	0x48
+	.byte	0xe
+	.long	0xf6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x9
+	.byte	0x49
+	.byte	0xe
+	.long	0xf6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF957
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xe
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF958
+	.byte	0x9
+	.byte	0x4b
+	.byte	0xe
+	.long	0xf6
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF959
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x3
+	.long	0x3f3
+	.uleb128 0x5
+	.long	.LASF960
+	.byte	0x1
+	.byte	0x9
+	.byte	0x4e
+	.long	0x45a
+	.uleb128 0x1
+	.long	.LASF961
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF960
+	.byte	0x9
+	.byte	0x50
+	.byte	0x3
+	.long	0x440
+	.uleb128 0x5
+	.long	.LASF962
+	.byte	0x8
+	.byte	0x9
+	.byte	0x54
+	.long	0x4b4
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x9
+	.byte	0x55
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x9
+	.byte	0x56
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF963
+	.byte	0x9
+	.byte	0x57
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF964
+	.byte	0x9
+	.byte	0x58
+	.byte	0xc
+	.long	0xbc
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF965
+	.byte	0x9
+	.byte	0x59
+	.byte	0xc
+	.long	0xbc
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF962
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x3
+	.long	0x466
+	.uleb128 0x5
+	.long	.LASF966
+	.byte	0x8
+	.byte	0xa
+	.byte	0x16
+	.long	0x50e
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0xa
+	.byte	0x17
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0xa
+	.byte	0x18
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0xa
+	.byte	0x19
+	.byte	0xe
+	.long	0xf6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF971
+	.byte	0xa
+	.byte	0x1b
+	.byte	0xe
+	.long	0xf6
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF972
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x3
+	.long	0x4c0
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0xb
+	.byte	0x1d
+	.long	0x54a
+	.uleb128 0x2
+	.long	.LASF973
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF974
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF976
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF977
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF978
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF979
+	.byte	0x12
+	.byte	0xb
+	.byte	0x3d
+	.long	0x5a5
+	.uleb128 0x1
+	.long	.LASF980
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xd
+	.long	0x5a5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF981
+	.byte	0xb
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF982
+	.byte	0xb
+	.byte	0x40
+	.byte	0xe
+	.long	0xf6
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF983
+	.byte	0xb
+	.byte	0x41
+	.byte	0xe
+	.long	0xf6
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF984
+	.byte	0xb
+	.byte	0x42
+	.byte	0xe
+	.long	0xf6
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF985
+	.byte	0xb
+	.byte	0x43
+	.byte	0xd
+	.long	0xe5
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x5b5
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF986
+	.byte	0xb
+	.byte	0x44
+	.byte	0x3
+	.long	0x54a
+	.uleb128 0x5
+	.long	.LASF987
+	.byte	0x6
+	.byte	0xc
+	.byte	0x14
+	.long	0x5f5
+	.uleb128 0x1
+	.long	.LASF988
+	.byte	0xc
+	.byte	0x15
+	.byte	0xe
+	.long	0xf6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF989
+	.byte	0xc
+	.byte	0x16
+	.byte	0xe
+	.long	0xf6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF990
+	.byte	0xc
+	.byte	0x17
+	.byte	0xe
+	.long	0xf6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF991
+	.byte	0xc
+	.byte	0x18
+	.byte	0x3
+	.long	0x5c1
+	.uleb128 0x5
+	.long	.LASF992
+	.byte	0x1
+	.byte	0xd
+	.byte	0x1a
+	.long	0x61b
+	.uleb128 0x1
+	.long	.LASF993
+	.byte	0xd
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF994
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x3
+	.long	0x601
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0xe
+	.byte	0x14
+	.long	0x6bd
+	.uleb128 0x2
+	.long	.LASF995
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF996
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF997
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF999
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1002
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1003
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1004
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1005
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1007
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1009
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1010
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1011
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1012
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1013
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1014
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1015
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1016
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1017
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1018
+	.byte	0xe
+	.byte	0x2d
+	.byte	0x3
+	.long	0x627
+	.uleb128 0x1f
+	.long	.LASF1231
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0xe
+	.byte	0x34
+	.byte	0xe
+	.long	0x724
+	.uleb128 0x2
+	.long	.LASF1019
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1020
+	.byte	0x1
+	.uleb128 0x20
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1021
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1022
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1025
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1026
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1028
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1030
+	.byte	0x8
+	.byte	0xe
+	.byte	0x65
+	.long	0x765
+	.uleb128 0x1
+	.long	.LASF1031
+	.byte	0xe
+	.byte	0x66
+	.byte	0xd
+	.long	0x6bd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1032
+	.byte	0xe
+	.byte	0x67
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1033
+	.byte	0xe
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1034
+	.byte	0xe
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1035
+	.byte	0xe
+	.byte	0x6f
+	.byte	0x3
+	.long	0x724
+	.uleb128 0x5
+	.long	.LASF1036
+	.byte	0x6
+	.byte	0xe
+	.byte	0x73
+	.long	0x7cc
+	.uleb128 0x1
+	.long	.LASF1037
+	.byte	0xe
+	.byte	0x74
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1038
+	.byte	0xe
+	.byte	0x75
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1039
+	.byte	0xe
+	.byte	0x76
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1040
+	.byte	0xe
+	.byte	0x77
+	.byte	0xd
+	.long	0xe5
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0xe
+	.byte	0x78
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1042
+	.byte	0xe
+	.byte	0x79
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1043
+	.byte	0xe
+	.byte	0x7a
+	.byte	0x3
+	.long	0x771
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0xf
+	.byte	0x14
+	.long	0x814
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1045
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1046
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1047
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1048
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1049
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1050
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1051
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1052
+	.byte	0x18
+	.byte	0xf
+	.byte	0x80
+	.long	0x86f
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0xf
+	.byte	0x81
+	.byte	0xd
+	.long	0x86f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0xf
+	.byte	0x82
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0xf
+	.byte	0x83
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0xf
+	.byte	0x84
+	.byte	0xe
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0xf
+	.byte	0x85
+	.byte	0xe
+	.long	0x107
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0xf
+	.byte	0x87
+	.byte	0xd
+	.long	0xe5
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.long	0x87f
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1059
+	.byte	0xf
+	.byte	0x88
+	.byte	0x3
+	.long	0x814
+	.uleb128 0x5
+	.long	.LASF1060
+	.byte	0xa
+	.byte	0x10
+	.byte	0x18
+	.long	0x8e6
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x10
+	.byte	0x19
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0x10
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xe
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0x10
+	.byte	0x1e
+	.byte	0xe
+	.long	0xf6
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1066
+	.byte	0x10
+	.byte	0x21
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1067
+	.byte	0x10
+	.byte	0x22
+	.byte	0x3
+	.long	0x88b
+	.uleb128 0x5
+	.long	.LASF1068
+	.byte	0x6
+	.byte	0x11
+	.byte	0x14
+	.long	0x926
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0x11
+	.byte	0x15
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1070
+	.byte	0x11
+	.byte	0x16
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0x11
+	.byte	0x17
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1072
+	.byte	0x11
+	.byte	0x18
+	.byte	0x3
+	.long	0x8f2
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x12
+	.byte	0x26
+	.long	0x974
+	.uleb128 0x2
+	.long	.LASF1073
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1074
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1077
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1080
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1081
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1082
+	.byte	0x12
+	.byte	0x30
+	.byte	0x3
+	.long	0x932
+	.uleb128 0x5
+	.long	.LASF1083
+	.byte	0xc
+	.byte	0x12
+	.byte	0x32
+	.long	0x9b4
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x12
+	.byte	0x33
+	.byte	0x14
+	.long	0x974
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x12
+	.byte	0x34
+	.byte	0x14
+	.long	0x974
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x12
+	.byte	0x35
+	.byte	0x14
+	.long	0x974
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1087
+	.byte	0x12
+	.byte	0x36
+	.byte	0x3
+	.long	0x980
+	.uleb128 0x5
+	.long	.LASF1088
+	.byte	0x10
+	.byte	0x12
+	.byte	0x39
+	.long	0xa1b
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0x12
+	.byte	0x3a
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x12
+	.byte	0x3b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0x12
+	.byte	0x3c
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x12
+	.byte	0x3d
+	.byte	0xd
+	.long	0xe5
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x12
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2e9
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0x12
+	.byte	0x3f
+	.byte	0xd
+	.long	0xd4
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1095
+	.byte	0x12
+	.byte	0x40
+	.byte	0x3
+	.long	0x9c0
+	.uleb128 0x5
+	.long	.LASF1096
+	.byte	0x2
+	.byte	0x13
+	.byte	0x27
+	.long	0xa4b
+	.uleb128 0x6
+	.string	"xy"
+	.byte	0x13
+	.byte	0x28
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x13
+	.byte	0x29
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1097
+	.byte	0x13
+	.byte	0x2a
+	.byte	0x3
+	.long	0xa27
+	.uleb128 0x5
+	.long	.LASF1098
+	.byte	0x8
+	.byte	0x14
+	.byte	0x24
+	.long	0xa98
+	.uleb128 0x1
+	.long	.LASF1099
+	.byte	0x14
+	.byte	0x25
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1100
+	.byte	0x14
+	.byte	0x26
+	.byte	0xe
+	.long	0xf6
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x14
+	.byte	0x27
+	.byte	0xe
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1102
+	.byte	0x14
+	.byte	0x28
+	.byte	0xe
+	.long	0xf6
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1103
+	.byte	0x14
+	.byte	0x29
+	.byte	0x3
+	.long	0xa57
+	.uleb128 0x5
+	.long	.LASF1104
+	.byte	0x10
+	.byte	0x15
+	.byte	0x1f
+	.long	0xae5
+	.uleb128 0x1
+	.long	.LASF1105
+	.byte	0x15
+	.byte	0x20
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1106
+	.byte	0x15
+	.byte	0x21
+	.byte	0xb
+	.long	0x118
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0x15
+	.byte	0x22
+	.byte	0xb
+	.long	0x118
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1108
+	.byte	0x15
+	.byte	0x23
+	.byte	0xb
+	.long	0x118
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x15
+	.byte	0x24
+	.byte	0x3
+	.long	0xaa4
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x16
+	.byte	0x1d
+	.long	0xb0f
+	.uleb128 0x2
+	.long	.LASF1110
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1111
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x17
+	.byte	0x1c
+	.long	0xb33
+	.uleb128 0x2
+	.long	.LASF1113
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1114
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1116
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1117
+	.byte	0x17
+	.byte	0x21
+	.byte	0x3
+	.long	0xb0f
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x17
+	.byte	0x23
+	.long	0xb57
+	.uleb128 0x2
+	.long	.LASF1118
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1120
+	.byte	0x17
+	.byte	0x26
+	.byte	0x3
+	.long	0xb3f
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x17
+	.byte	0x28
+	.long	0xb7b
+	.uleb128 0x2
+	.long	.LASF1121
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1122
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1123
+	.byte	0x17
+	.byte	0x2b
+	.byte	0x3
+	.long	0xb63
+	.uleb128 0x5
+	.long	.LASF1124
+	.byte	0x20
+	.byte	0x17
+	.byte	0x2c
+	.long	0xbfc
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x17
+	.byte	0x2d
+	.byte	0x19
+	.long	0xb33
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x17
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x17
+	.byte	0x2f
+	.byte	0x17
+	.long	0x155
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x17
+	.byte	0x30
+	.byte	0x8
+	.long	0x118
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x17
+	.byte	0x31
+	.byte	0xb
+	.long	0x118
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x17
+	.byte	0x32
+	.byte	0x1b
+	.long	0xb57
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x17
+	.byte	0x33
+	.byte	0x11
+	.long	0xb7b
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x17
+	.byte	0x34
+	.byte	0xe
+	.long	0xf6
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1133
+	.byte	0x17
+	.byte	0x35
+	.byte	0x3
+	.long	0xb87
+	.uleb128 0x17
+	.long	.LASF1134
+	.value	0x218
+	.byte	0x18
+	.byte	0x14
+	.long	0xd4b
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x18
+	.byte	0x15
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x18
+	.byte	0x17
+	.byte	0x12
+	.long	0x27e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x18
+	.byte	0x19
+	.byte	0x19
+	.long	0x7cc
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x18
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x18
+	.byte	0x1c
+	.byte	0xe
+	.long	0xf6
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x18
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc8
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x18
+	.byte	0x21
+	.byte	0x19
+	.long	0x367
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x18
+	.byte	0x24
+	.byte	0xd
+	.long	0xe5
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x18
+	.byte	0x25
+	.byte	0xb
+	.long	0x118
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x18
+	.byte	0x26
+	.byte	0x13
+	.long	0xa4b
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x18
+	.byte	0x28
+	.byte	0x17
+	.long	0xae5
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1146
+	.byte	0x18
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0x18
+	.byte	0x2d
+	.byte	0x1f
+	.long	0xd4b
+	.byte	0x84
+	.uleb128 0x4
+	.long	.LASF1148
+	.byte	0x18
+	.byte	0x30
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c4
+	.uleb128 0x4
+	.long	.LASF1149
+	.byte	0x18
+	.byte	0x31
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c5
+	.uleb128 0x4
+	.long	.LASF1150
+	.byte	0x18
+	.byte	0x32
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c6
+	.uleb128 0x4
+	.long	.LASF1151
+	.byte	0x18
+	.byte	0x33
+	.byte	0xd
+	.long	0xe5
+	.value	0x1c7
+	.uleb128 0x4
+	.long	.LASF1152
+	.byte	0x18
+	.byte	0x35
+	.byte	0xe
+	.long	0xf6
+	.value	0x1c8
+	.uleb128 0x4
+	.long	.LASF1153
+	.byte	0x18
+	.byte	0x36
+	.byte	0xd
+	.long	0xe5
+	.value	0x1ca
+	.uleb128 0x4
+	.long	.LASF1154
+	.byte	0x18
+	.byte	0x39
+	.byte	0x12
+	.long	0xd5b
+	.value	0x1cc
+	.uleb128 0x4
+	.long	.LASF1155
+	.byte	0x18
+	.byte	0x3c
+	.byte	0x16
+	.long	0x50e
+	.value	0x20c
+	.uleb128 0x4
+	.long	.LASF1156
+	.byte	0x18
+	.byte	0x3f
+	.byte	0x13
+	.long	0x3e7
+	.value	0x214
+	.uleb128 0x4
+	.long	.LASF1157
+	.byte	0x18
+	.byte	0x42
+	.byte	0x14
+	.long	0x61b
+	.value	0x216
+	.byte	0
+	.uleb128 0x8
+	.long	0x765
+	.long	0xd5b
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x8
+	.long	0x4b4
+	.long	0xd6b
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1158
+	.byte	0x18
+	.byte	0x47
+	.byte	0x3
+	.long	0xc08
+	.uleb128 0x17
+	.long	.LASF1159
+	.value	0x7dc
+	.byte	0x19
+	.byte	0x17
+	.long	0xfae
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x19
+	.byte	0x18
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x19
+	.byte	0x19
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x19
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf6
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x19
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe5
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x19
+	.byte	0x1c
+	.byte	0xd
+	.long	0xe5
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x19
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0x19
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe5
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1167
+	.byte	0x19
+	.byte	0x20
+	.byte	0x12
+	.long	0xfae
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1168
+	.byte	0x19
+	.byte	0x23
+	.byte	0x19
+	.long	0x5f5
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0x19
+	.byte	0x24
+	.byte	0x16
+	.long	0x434
+	.byte	0xd6
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0x19
+	.byte	0x26
+	.byte	0xe
+	.long	0xf6
+	.byte	0xde
+	.uleb128 0x1
+	.long	.LASF1171
+	.byte	0x19
+	.byte	0x27
+	.byte	0xe
+	.long	0xf6
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF1172
+	.byte	0x19
+	.byte	0x28
+	.byte	0xe
+	.long	0xf6
+	.byte	0xe2
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x19
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x9b4
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0x19
+	.byte	0x2d
+	.byte	0x16
+	.long	0x926
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x19
+	.byte	0x2f
+	.byte	0xc
+	.long	0xbc
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x19
+	.byte	0x30
+	.byte	0xd
+	.long	0xe5
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x19
+	.byte	0x31
+	.byte	0xe
+	.long	0xf6
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF1178
+	.byte	0x19
+	.byte	0x32
+	.byte	0xe
+	.long	0xf6
+	.byte	0xfa
+	.uleb128 0x1
+	.long	.LASF1179
+	.byte	0x19
+	.byte	0x33
+	.byte	0xe
+	.long	0xf6
+	.byte	0xfc
+	.uleb128 0x1
+	.long	.LASF1180
+	.byte	0x19
+	.byte	0x34
+	.byte	0xd
+	.long	0xe5
+	.byte	0xfe
+	.uleb128 0x4
+	.long	.LASF1181
+	.byte	0x19
+	.byte	0x35
+	.byte	0xe
+	.long	0xf6
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1182
+	.byte	0x19
+	.byte	0x36
+	.byte	0xe
+	.long	0xf6
+	.value	0x102
+	.uleb128 0x4
+	.long	.LASF1183
+	.byte	0x19
+	.byte	0x38
+	.byte	0x12
+	.long	0xa98
+	.value	0x104
+	.uleb128 0x4
+	.long	.LASF1184
+	.byte	0x19
+	.byte	0x3a
+	.byte	0xe
+	.long	0xf6
+	.value	0x10c
+	.uleb128 0x4
+	.long	.LASF1185
+	.byte	0x19
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x2f9
+	.value	0x10e
+	.uleb128 0x4
+	.long	.LASF1186
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x2f9
+	.value	0x114
+	.uleb128 0x4
+	.long	.LASF1187
+	.byte	0x19
+	.byte	0x3d
+	.byte	0x14
+	.long	0xa1b
+	.value	0x11c
+	.uleb128 0x4
+	.long	.LASF1188
+	.byte	0x19
+	.byte	0x3f
+	.byte	0x15
+	.long	0x8e6
+	.value	0x12c
+	.uleb128 0x4
+	.long	.LASF1189
+	.byte	0x19
+	.byte	0x41
+	.byte	0x10
+	.long	0x5b5
+	.value	0x136
+	.uleb128 0x4
+	.long	.LASF1190
+	.byte	0x19
+	.byte	0x42
+	.byte	0x1a
+	.long	0x185
+	.value	0x148
+	.uleb128 0x4
+	.long	.LASF1191
+	.byte	0x19
+	.byte	0x44
+	.byte	0xd
+	.long	0xe5
+	.value	0x14c
+	.uleb128 0x4
+	.long	.LASF1192
+	.byte	0x19
+	.byte	0x45
+	.byte	0xd
+	.long	0xe5
+	.value	0x14d
+	.uleb128 0x4
+	.long	.LASF1193
+	.byte	0x19
+	.byte	0x46
+	.byte	0xd
+	.long	0xe5
+	.value	0x14e
+	.uleb128 0x4
+	.long	.LASF1194
+	.byte	0x19
+	.byte	0x48
+	.byte	0x16
+	.long	0x45a
+	.value	0x14f
+	.uleb128 0x4
+	.long	.LASF1195
+	.byte	0x19
+	.byte	0x49
+	.byte	0xc
+	.long	0xbc
+	.value	0x150
+	.uleb128 0x4
+	.long	.LASF1196
+	.byte	0x19
+	.byte	0x4f
+	.byte	0x14
+	.long	0x87f
+	.value	0x154
+	.uleb128 0x4
+	.long	.LASF1197
+	.byte	0x19
+	.byte	0x51
+	.byte	0x17
+	.long	0xbfc
+	.value	0x16c
+	.uleb128 0x4
+	.long	.LASF1198
+	.byte	0x19
+	.byte	0x53
+	.byte	0xd
+	.long	0xe5
+	.value	0x18c
+	.uleb128 0x4
+	.long	.LASF1199
+	.byte	0x19
+	.byte	0x5a
+	.byte	0xf
+	.long	0xfbe
+	.value	0x190
+	.uleb128 0x4
+	.long	.LASF1200
+	.byte	0x19
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe5
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x8
+	.long	0x3b4
+	.long	0xfbe
+	.uleb128 0x9
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0xd6b
+	.long	0xfce
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1159
+	.byte	0x19
+	.byte	0x5c
+	.byte	0x3
+	.long	0xd77
+	.uleb128 0xb
+	.long	0xfce
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0x1a
+	.byte	0x14
+	.long	0x101b
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1202
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1206
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1208
+	.byte	0x80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1209
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x23
+	.long	0x1075
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x11
+	.long	0x113
+	.byte	0
+	.uleb128 0x6
+	.string	"id"
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x14
+	.long	0x102
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x13
+	.long	0xf1
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x1a
+	.byte	0x27
+	.byte	0x14
+	.long	0x102
+	.byte	0xc
+	.uleb128 0x6
+	.string	"min"
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x13
+	.long	0xe0
+	.byte	0x10
+	.uleb128 0x6
+	.string	"max"
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x13
+	.long	0xe0
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1213
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x3
+	.long	0x101b
+	.uleb128 0xb
+	.long	0x1075
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x2c
+	.long	0x10a7
+	.uleb128 0xf
+	.long	.LASF1214
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0xd
+	.long	0xd4
+	.uleb128 0xf
+	.long	.LASF1215
+	.byte	0x1a
+	.byte	0x2e
+	.byte	0xb
+	.long	0x118
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1216
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x3
+	.long	0x1086
+	.uleb128 0x8
+	.long	0x1081
+	.long	0x10be
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0xb
+	.long	0x10b3
+	.uleb128 0x18
+	.long	.LASF1217
+	.byte	0x31
+	.byte	0x1c
+	.long	0x10be
+	.uleb128 0x18
+	.long	.LASF1218
+	.byte	0x32
+	.byte	0x17
+	.long	0x102
+	.uleb128 0x8
+	.long	0x1081
+	.long	0x10e9
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x81
+	.byte	0
+	.uleb128 0xb
+	.long	0x10d9
+	.uleb128 0x22
+	.long	0x10c3
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x15
+	.long	0x10e9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configValues
+	.uleb128 0x23
+	.long	0x10ce
+	.byte	0x1
+	.value	0x106
+	.byte	0x10
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configValueCount
+	.uleb128 0x24
+	.long	.LASF1226
+	.byte	0x1b
+	.byte	0x74
+	.byte	0xc
+	.long	0x94
+	.long	0x1132
+	.uleb128 0x19
+	.long	0x113
+	.uleb128 0x19
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1223
+	.value	0x165
+	.byte	0x5
+	.long	0x161
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1177
+	.uleb128 0x13
+	.long	.LASF1221
+	.value	0x165
+	.byte	0x2f
+	.long	0x1177
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF1219
+	.value	0x165
+	.byte	0x48
+	.long	0x10a7
+	.long	.LLST21
+	.long	.LVUS21
+	.byte	0
+	.uleb128 0xe
+	.long	0x1081
+	.uleb128 0x25
+	.long	.LASF1232
+	.byte	0x1
+	.value	0x14c
+	.byte	0x6
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1250
+	.uleb128 0xc
+	.long	.LASF1220
+	.value	0x14c
+	.byte	0x1f
+	.long	0x1250
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x13
+	.long	.LASF1221
+	.value	0x14c
+	.byte	0x3c
+	.long	0x1177
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF1222
+	.value	0x14c
+	.byte	0x4b
+	.long	0xe5
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xc
+	.long	.LASF1219
+	.value	0x14c
+	.byte	0x6b
+	.long	0x10a7
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x11
+	.string	"ptr"
+	.value	0x14e
+	.byte	0xb
+	.long	0xae
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x1a
+	.long	0x1338
+	.quad	.LBI8
+	.byte	.LVU88
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.value	0x14e
+	.byte	0x11
+	.uleb128 0xd
+	.long	0x135e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xd
+	.long	0x1354
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xd
+	.long	0x134a
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x14
+	.long	0x1368
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xfce
+	.uleb128 0x10
+	.long	.LASF1224
+	.value	0x12a
+	.byte	0x13
+	.long	0x10a7
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x132d
+	.uleb128 0xc
+	.long	.LASF1220
+	.value	0x12a
+	.byte	0x32
+	.long	0x132d
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x13
+	.long	.LASF1221
+	.value	0x12a
+	.byte	0x4f
+	.long	0x1177
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xc
+	.long	.LASF1222
+	.value	0x12a
+	.byte	0x5e
+	.long	0xe5
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x26
+	.long	.LASF1225
+	.byte	0x1
+	.value	0x12c
+	.byte	0x17
+	.long	0x10a7
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x11
+	.string	"ptr"
+	.value	0x12d
+	.byte	0x11
+	.long	0x1332
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1a
+	.long	0x1338
+	.quad	.LBI6
+	.byte	.LVU54
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.value	0x12d
+	.byte	0x17
+	.uleb128 0xd
+	.long	0x135e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xd
+	.long	0x1354
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xd
+	.long	0x134a
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x14
+	.long	0x1368
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xfda
+	.uleb128 0xe
+	.long	0x1337
+	.uleb128 0x27
+	.uleb128 0x28
+	.long	.LASF1227
+	.byte	0x1
+	.value	0x120
+	.byte	0x7
+	.long	0xae
+	.byte	0x1
+	.long	0x1376
+	.uleb128 0x15
+	.long	.LASF1220
+	.byte	0x24
+	.long	0x1250
+	.uleb128 0x15
+	.long	.LASF1221
+	.byte	0x41
+	.long	0x1177
+	.uleb128 0x15
+	.long	.LASF1222
+	.byte	0x50
+	.long	0xe5
+	.uleb128 0x29
+	.string	"ptr"
+	.byte	0x1
+	.value	0x122
+	.byte	0xe
+	.long	0x168
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1228
+	.value	0x114
+	.byte	0x16
+	.long	0x1177
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13d3
+	.uleb128 0xc
+	.long	.LASF1210
+	.value	0x114
+	.byte	0x38
+	.long	0x113
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x11
+	.string	"i"
+	.value	0x116
+	.byte	0xe
+	.long	0xf6
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2a
+	.quad	.LVL9
+	.long	0x1117
+	.uleb128 0x2b
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1229
+	.value	0x108
+	.byte	0x16
+	.long	0x1177
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1416
+	.uleb128 0x2c
+	.string	"id"
+	.byte	0x1
+	.value	0x108
+	.byte	0x33
+	.long	0xf6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x11
+	.string	"i"
+	.value	0x10a
+	.byte	0xe
+	.long	0xf6
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1338
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1b
+	.long	0x134a
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1b
+	.long	0x1354
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xd
+	.long	0x135e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x14
+	.long	0x1368
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 288
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL34-.LVL34
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LFE5-.LVL34
+	.uleb128 0x3
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL32-.LVL30
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL32-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL30-.LVL30
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LFE4-.LVL30
+	.uleb128 0x3
+	.byte	0x52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU100
+	.uleb128 0
+.LLST16:
+	.byte	0x8
+	.quad	.LVL33
+	.uleb128 .LFE4-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU88
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU100
+.LLST17:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL32-.LVL30
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL32-.LVL30
+	.uleb128 .LVL33-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU88
+	.uleb128 .LVU100
+.LLST18:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL33-.LVL30
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU88
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU100
+.LLST19:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-.LVL30
+	.uleb128 .LVL33-.LVL30
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU92
+	.uleb128 .LVU100
+.LLST20:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL33-.LVL31
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.LVL18
+	.uleb128 .LFE3-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL20-.LVL18
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.LVL18
+	.uleb128 .LFE3-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU71
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU77
+	.uleb128 .LVU79
+	.uleb128 .LVU80
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL22-.LVL22
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL23-.LVL22
+	.uleb128 .LVL24-.LVL22
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL25-.LVL22
+	.uleb128 .LVL26-.LVL22
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL27-.LVL22
+	.uleb128 .LVL28-.LVL22
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL29-.LVL22
+	.uleb128 .LFE3-.LVL22
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU66
+	.uleb128 0
+.LLST8:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LFE3-.LVL21
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU54
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+.LLST9:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL20-.LVL18
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.LVL18
+	.uleb128 .LVL21-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU54
+	.uleb128 .LVU66
+.LLST10:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL21-.LVL18
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU54
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU66
+.LLST11:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.LVL18
+	.uleb128 .LVL21-.LVL18
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU58
+	.uleb128 .LVU66
+.LLST12:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL21-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL12-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LVL13-.LVL5
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL13-.LVL5
+	.uleb128 .LFE1-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU28
+.LLST2:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL5
+	.uleb128 .LVL10-.LVL5
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 .LVU7
+	.uleb128 .LVU8
+	.uleb128 .LVU12
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL16-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.LVL14
+	.uleb128 .LFE2-.LVL14
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU42
+	.uleb128 0
+.LLST4:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LFE2-.LVL15
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x7c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL22:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 28 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.file 31 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 33 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 34 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 39 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x27
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 44 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 45 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x30
+	.file 49 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 50 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 51 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF783
+	.byte	0x4
+	.file 52 ".//src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 53 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.file 54 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF797
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 55 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF805
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xc
+	.byte	0x4
+	.file 56 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 57 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF877
+	.byte	0x4
+	.file 58 ".//src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 59 ".//src/main/config/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 60 ".//src/main/config/config.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF705
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF724
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF741
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF742
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF743
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF745
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF747
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF750
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF706
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF725
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF743
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF745
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF747
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF782
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.21a8e51ff4e49de8dae92488305a5e6a,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF791
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF796
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF801
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF804
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF821
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF828
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF850
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF875
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF879
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_values.h.32.11f6a86bb47beeedafaf69664c3a4228,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF891
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF803:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF821:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF844:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1163:
+	.string	"gyro_sync"
+.LASF906:
+	.string	"int8_t"
+.LASF1023:
+	.string	"AUX2"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF939:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF880:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1191:
+	.string	"retarded_arm"
+.LASF810:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF1006:
+	.string	"BOXPASSTHRU"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"ACC "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF755:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1055:
+	.string	"cli_baudrate"
+.LASF1199:
+	.string	"profile"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1076:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF783:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF884:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF874:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF866:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF908:
+	.string	"int32_t"
+.LASF924:
+	.string	"PIDPITCH"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1046:
+	.string	"FUNCTION_CLI"
+.LASF818:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1161:
+	.string	"enabledFeatures"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1168:
+	.string	"escAndServoConfig"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1203:
+	.string	"VAR_UINT16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF728:
+	.string	"_WCHAR_T "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1073:
+	.string	"ALIGN_DEFAULT"
+.LASF747:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF776:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF808:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF770:
+	.string	"USE_GYRO_SITL "
+.LASF829:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF855:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF862:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1220:
+	.string	"config"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF840:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF760:
+	.string	"__enable_irq() "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF788:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF708:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF942:
+	.string	"flightDynamicsTrims_def_t"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF958:
+	.string	"deadband3d_throttle"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF743:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF940:
+	.string	"roll"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF1211:
+	.string	"type"
+.LASF1068:
+	.string	"boardAlignment_s"
+.LASF1072:
+	.string	"boardAlignment_t"
+.LASF948:
+	.string	"motorMixer_t"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1229:
+	.string	"findConfigValueById"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1090:
+	.string	"accHardware"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF923:
+	.string	"PIDROLL"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1106:
+	.string	"baro_noise_lpf"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF823:
+	.string	"LON 1"
+.LASF974:
+	.string	"SERIALRX_SPEKTRUM2048"
+.LASF712:
+	.string	"_T_SIZE "
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF930:
+	.string	"PIDLEVEL"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1205:
+	.string	"VAR_UINT32"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF752:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1081:
+	.string	"CW270_DEG_FLIP"
+.LASF888:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1195:
+	.string	"fixedwing_althold_dir"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF762:
+	.string	"U_ID_1 0"
+.LASF1226:
+	.string	"strcasecmp"
+.LASF898:
+	.string	"__uint8_t"
+.LASF922:
+	.string	"inputFilteringMode_e"
+.LASF969:
+	.string	"failsafe_throttle"
+.LASF1078:
+	.string	"CW0_DEG_FLIP"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1225:
+	.string	"result"
+.LASF693:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF819:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1096:
+	.string	"accDeadband_s"
+.LASF995:
+	.string	"BOXARM"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF957:
+	.string	"neutral3d"
+.LASF772:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF885:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1041:
+	.string	"rollPitchRate"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF904:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1083:
+	.string	"sensorAlignmentConfig_s"
+.LASF1087:
+	.string	"sensorAlignmentConfig_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF873:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF757:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF700:
+	.string	"_PTRDIFF_T_ "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1155:
+	.string	"failsafeConfig"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF925:
+	.string	"PIDYAW"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF970:
+	.string	"failsafe_min_usec"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1051:
+	.string	"FUNCTION_BLACKBOX"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF812:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF827:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF725:
+	.string	"__need_size_t"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1071:
+	.string	"yawDegrees"
+.LASF1015:
+	.string	"BOXAUTOTUNE"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1061:
+	.string	"vbatscale"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF936:
+	.string	"dterm_lpf_hz"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF722:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF825:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF795:
+	.string	"HSV_VALUE_MAX 255"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF799:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF896:
+	.string	"signed char"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF909:
+	.string	"uint8_t"
+.LASF1176:
+	.string	"acc_hardware"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1042:
+	.string	"yawRate"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF836:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1020:
+	.string	"PITCH"
+.LASF1091:
+	.string	"baroHardware"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF878:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1174:
+	.string	"boardAlignment"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF734:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1014:
+	.string	"BOXTELEMETRY"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF892:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1039:
+	.string	"thrMid8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1047:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF779:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF720:
+	.string	"__DEFINED_size_t "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1152:
+	.string	"throttle_correction_angle"
+.LASF751:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF796:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF775:
+	.string	"USE_USART1 "
+.LASF952:
+	.string	"tri_unarmed_servo"
+.LASF850:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1033:
+	.string	"rangeStartStep"
+.LASF390:
+	.string	"bool _Bool"
+.LASF857:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF916:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1149:
+	.string	"yaw_deadband"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF826:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF919:
+	.string	"_Bool"
+.LASF871:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF716:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF744:
+	.string	"NULL"
+.LASF1074:
+	.string	"CW0_DEG"
+.LASF1221:
+	.string	"value"
+.LASF837:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF765:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1001:
+	.string	"BOXHEADADJ"
+.LASF933:
+	.string	"PID_ITEM_COUNT"
+.LASF905:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1215:
+	.string	"float_value"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1005:
+	.string	"BOXGPSHOLD"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF749:
+	.string	"__need_size_t "
+.LASF956:
+	.string	"deadband3d_high"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1227:
+	.string	"configValuePointer"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF935:
+	.string	"H_level"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF848:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF901:
+	.string	"__uint16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF750:
+	.string	"__need_NULL "
+.LASF987:
+	.string	"escAndServoConfig_s"
+.LASF991:
+	.string	"escAndServoConfig_t"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF789:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1012:
+	.string	"BOXGOV"
+.LASF707:
+	.string	"__size_t__ "
+.LASF1157:
+	.string	"gimbalConfig"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF767:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF983:
+	.string	"mincheck"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1004:
+	.string	"BOXGPSHOME"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1139:
+	.string	"tpa_breakpoint"
+.LASF758:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF928:
+	.string	"PIDPOSR"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF764:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF735:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1228:
+	.string	"findConfigValueByName"
+.LASF865:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1104:
+	.string	"barometerConfig_s"
+.LASF1109:
+	.string	"barometerConfig_t"
+.LASF738:
+	.string	"__INT_WCHAR_T_H "
+.LASF813:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF949:
+	.string	"throttle"
+.LASF863:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF839:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1105:
+	.string	"baro_sample_count"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF798:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF723:
+	.string	"_SIZET_ "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF852:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1067:
+	.string	"batteryConfig_t"
+.LASF814:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1147:
+	.string	"modeActivationConditions"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1002:
+	.string	"BOXCAMSTAB"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF945:
+	.string	"rollAndPitchTrims_s"
+.LASF947:
+	.string	"rollAndPitchTrims_t"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF835:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1223:
+	.string	"isConfigValueInRange"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF733:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1008:
+	.string	"BOXLEDMAX"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF822:
+	.string	"LAT 0"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF890:
+	.string	"VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)"
+.LASF853:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF964:
+	.string	"rate"
+.LASF1137:
+	.string	"controlRateConfig"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF745:
+	.string	"NULL ((void *)0)"
+.LASF1164:
+	.string	"gyro_sync_denom"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF713:
+	.string	"__SIZE_T "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF768:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF701:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1202:
+	.string	"VAR_INT8"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF802:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1232:
+	.string	"configValueSet"
+.LASF883:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1069:
+	.string	"rollDegrees"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1151:
+	.string	"alt_hold_fast_change"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1127:
+	.string	"frsky_inversion"
+.LASF1188:
+	.string	"batteryConfig"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1231:
+	.string	"rc_alias"
+.LASF1219:
+	.string	"newValue"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1030:
+	.string	"modeActivationCondition_s"
+.LASF1035:
+	.string	"modeActivationCondition_t"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1143:
+	.string	"accz_lpf_cutoff"
+.LASF895:
+	.string	"long unsigned int"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1070:
+	.string	"pitchDegrees"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1084:
+	.string	"gyro_align"
+.LASF961:
+	.string	"flaps_speed"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1194:
+	.string	"airplaneConfig"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1201:
+	.string	"VAR_UINT8"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF965:
+	.string	"forwardFromChannel"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF763:
+	.string	"U_ID_2 0"
+.LASF1088:
+	.string	"knownSensors_s"
+.LASF1095:
+	.string	"knownSensors_t"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF858:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF980:
+	.string	"rcmap"
+.LASF1189:
+	.string	"rxConfig"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1173:
+	.string	"sensorAlignmentConfig"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1079:
+	.string	"CW90_DEG_FLIP"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF993:
+	.string	"gimbal_flags"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1117:
+	.string	"telemetryProvider_e"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1086:
+	.string	"mag_align"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF777:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF1077:
+	.string	"CW270_DEG"
+.LASF702:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF811:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1193:
+	.string	"small_angle"
+.LASF955:
+	.string	"deadband3d_low"
+.LASF697:
+	.string	"_T_PTRDIFF_ "
+.LASF886:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF929:
+	.string	"PIDNAVR"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1180:
+	.string	"attitude_estimator"
+.LASF1118:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1200:
+	.string	"current_profile_index"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1121:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF729:
+	.string	"_T_WCHAR_ "
+.LASF1063:
+	.string	"vbatmincellvoltage"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1218:
+	.string	"configValueCount"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF843:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1146:
+	.string	"acc_unarmedcal"
+.LASF903:
+	.string	"__uint32_t"
+.LASF785:
+	.string	"M_PI 3.14159265358979323846f"
+.LASF711:
+	.string	"_T_SIZE_ "
+.LASF714:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF753:
+	.string	"_STRINGS_H 1"
+.LASF710:
+	.string	"_SYS_SIZE_T_H "
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF726:
+	.string	"__wchar_t__ "
+.LASF1177:
+	.string	"gyro_lpf"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1154:
+	.string	"servoConf"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1207:
+	.string	"MASTER_VALUE"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF845:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1064:
+	.string	"currentMeterScale"
+.LASF841:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1175:
+	.string	"yaw_control_direction"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF754:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1112:
+	.string	"ATTITUDE_ESTIMATOR_COUNT"
+.LASF731:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1092:
+	.string	"calibrated"
+.LASF1082:
+	.string	"sensor_align_e"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1179:
+	.string	"gyro_cmpfm_factor"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1145:
+	.string	"barometerConfig"
+.LASF981:
+	.string	"serialrx_provider"
+.LASF1065:
+	.string	"currentMeterOffset"
+.LASF462:
+	.string	"__PMT"
+.LASF1192:
+	.string	"disarm_kill_switch"
+.LASF1187:
+	.string	"knownSensors"
+.LASF833:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF973:
+	.string	"SERIALRX_SPEKTRUM1024"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1018:
+	.string	"boxId_e"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1111:
+	.string	"ATTITUDE_ESTIMATOR_QUATERNION"
+.LASF1133:
+	.string	"telemetryConfig_t"
+.LASF1052:
+	.string	"serialConfig_s"
+.LASF1059:
+	.string	"serialConfig_t"
+.LASF976:
+	.string	"SERIALRX_SUMD"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF977:
+	.string	"SERIALRX_SUMH"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF912:
+	.string	"float"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF695:
+	.string	"_ANSI_STDDEF_H "
+.LASF859:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF800:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1115:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF951:
+	.string	"yaw_direction"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF1186:
+	.string	"magZero"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF872:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF894:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF815:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1183:
+	.string	"gyroConfig"
+.LASF889:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1110:
+	.string	"ATTITUDE_ESTIMATOR_COMPLEMENTARY"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF740:
+	.string	"_WCHAR_T_DECLARED "
+.LASF971:
+	.string	"failsafe_max_usec"
+.LASF1184:
+	.string	"max_angle_inclination"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1209:
+	.string	"configValue_s"
+.LASF1213:
+	.string	"configValue_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1044:
+	.string	"FUNCTION_NONE"
+.LASF698:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF696:
+	.string	"_PTRDIFF_T "
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF954:
+	.string	"flight3DConfig_s"
+.LASF959:
+	.string	"flight3DConfig_t"
+.LASF921:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF985:
+	.string	"rssi_channel"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF846:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF792:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF719:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF851:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF794:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF967:
+	.string	"failsafe_delay"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1032:
+	.string	"auxChannelIndex"
+.LASF842:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF704:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1212:
+	.string	"offset"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1178:
+	.string	"gyro_cmpf_factor"
+.LASF830:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1107:
+	.string	"baro_cf_vel"
+.LASF1108:
+	.string	"baro_cf_alt"
+.LASF1142:
+	.string	"acc_lpf_hz"
+.LASF784:
+	.string	"sq(x) ((x)*(x))"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF805:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF998:
+	.string	"BOXBARO"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF793:
+	.string	"HSV_HUE_MAX 359"
+.LASF1166:
+	.string	"emf_avoidance"
+.LASF1054:
+	.string	"msp_baudrate"
+.LASF1009:
+	.string	"BOXLEDLOW"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF746:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF721:
+	.string	"___int_size_t_h "
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF778:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF938:
+	.string	"pidProfile_s"
+.LASF937:
+	.string	"pidProfile_t"
+.LASF1131:
+	.string	"frsky_unit"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF881:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF718:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF703:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1093:
+	.string	"gyroZero"
+.LASF1198:
+	.string	"blackbox_rate_denom"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF709:
+	.string	"_SIZE_T "
+.LASF736:
+	.string	"_WCHAR_T_H "
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF1010:
+	.string	"BOXLLIGHTS"
+.LASF817:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1094:
+	.string	"baroGroundPressure"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1170:
+	.string	"motor_pwm_rate"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF869:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1099:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF870:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1159:
+	.string	"master_t"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1169:
+	.string	"flight3DConfig"
+.LASF1102:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1036:
+	.string	"controlRateConfig_s"
+.LASF1016:
+	.string	"BOXSONAR"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF780:
+	.string	"BLACKBOX "
+.LASF1130:
+	.string	"frsky_coordinate_format"
+.LASF769:
+	.string	"GYRO "
+.LASF759:
+	.string	"__disable_irq() "
+.LASF950:
+	.string	"mixerConfig_s"
+.LASF953:
+	.string	"mixerConfig_t"
+.LASF982:
+	.string	"midrc"
+.LASF1124:
+	.string	"telemetryConfig_s"
+.LASF1080:
+	.string	"CW180_DEG_FLIP"
+.LASF1217:
+	.string	"configValues"
+.LASF1057:
+	.string	"gps_passthrough_baudrate"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1126:
+	.string	"telemetry_switch"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF739:
+	.string	"_GCC_WCHAR_T "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF897:
+	.string	"__int8_t"
+.LASF932:
+	.string	"PIDVEL"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF926:
+	.string	"PIDALT"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF849:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF997:
+	.string	"BOXHORIZON"
+.LASF918:
+	.string	"serialInversion_e"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF773:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF717:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF910:
+	.string	"uint16_t"
+.LASF801:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF1182:
+	.string	"dcm_ki"
+.LASF699:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF920:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1181:
+	.string	"dcm_kp"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1214:
+	.string	"int_value"
+.LASF791:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF984:
+	.string	"maxcheck"
+.LASF1048:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF1017:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1208:
+	.string	"PROFILE_VALUE"
+.LASF1120:
+	.string	"frskyGpsCoordFormat_e"
+.LASF1122:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1037:
+	.string	"rcRate8"
+.LASF1003:
+	.string	"BOXCAMTRIG"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1153:
+	.string	"throttle_correction_value"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1197:
+	.string	"telemetryConfig"
+.LASF724:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF879:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1216:
+	.string	"int_float_value_t"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1230:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF931:
+	.string	"PIDMAG"
+.LASF990:
+	.string	"mincommand"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF715:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1066:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF730:
+	.string	"_T_WCHAR "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF867:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF962:
+	.string	"servoParam_t"
+.LASF899:
+	.string	"__int16_t"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF809:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF748:
+	.string	"_STRING_H 1"
+.LASF1138:
+	.string	"dynThrPID"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF877:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1162:
+	.string	"looptime"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF944:
+	.string	"flightDynamicsTrims_t"
+.LASF1098:
+	.string	"gyroConfig_s"
+.LASF1103:
+	.string	"gyroConfig_t"
+.LASF1058:
+	.string	"reboot_character"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF782:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1132:
+	.string	"batterySize"
+.LASF828:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF943:
+	.string	"values"
+.LASF915:
+	.string	"RGB_BLUE"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF963:
+	.string	"middle"
+.LASF1021:
+	.string	"THROTTLE"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF834:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1043:
+	.string	"controlRateConfig_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF806:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1136:
+	.string	"pidProfile"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF820:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF1148:
+	.string	"deadband"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1210:
+	.string	"name"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1222:
+	.string	"profileIndex"
+.LASF917:
+	.string	"SERIAL_INVERTED"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1135:
+	.string	"pidController"
+.LASF1185:
+	.string	"accZero"
+.LASF927:
+	.string	"PIDPOS"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF797:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF1150:
+	.string	"alt_hold_deadband"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1040:
+	.string	"thrExpo8"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF900:
+	.string	"short int"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1128:
+	.string	"gpsNoFixLatitude"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF1089:
+	.string	"gyroHardware"
+.LASF807:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1060:
+	.string	"batteryConfig_s"
+.LASF978:
+	.string	"SERIALRX_PROVIDER_MAX"
+.LASF1172:
+	.string	"servo_pwm_rate"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF907:
+	.string	"int16_t"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1129:
+	.string	"gpsNoFixLongitude"
+.LASF761:
+	.string	"U_ID_0 0x5349544c"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF766:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF706:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1097:
+	.string	"accDeadband_t"
+.LASF1062:
+	.string	"vbatmaxcellvoltage"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1141:
+	.string	"accelerometerTrims"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF989:
+	.string	"maxthrottle"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF727:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF864:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1206:
+	.string	"VAR_FLOAT"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1190:
+	.string	"inputFilteringMode"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1140:
+	.string	"mag_declination"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF741:
+	.string	"__DEFINED_wchar_t "
+.LASF1100:
+	.string	"soft_gyro_lpf_hz"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1007:
+	.string	"BOXBEEPERON"
+.LASF392:
+	.string	"false 0"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF960:
+	.string	"airplaneConfig_t"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1204:
+	.string	"VAR_INT16"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1125:
+	.string	"telemetry_provider"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1085:
+	.string	"acc_align"
+.LASF1038:
+	.string	"rcExpo8"
+.LASF988:
+	.string	"minthrottle"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF732:
+	.string	"_WCHAR_T_ "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF737:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF816:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF1160:
+	.string	"mixerConfiguration"
+.LASF996:
+	.string	"BOXANGLE"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1101:
+	.string	"soft_gyro_notch_hz"
+.LASF1053:
+	.string	"serial_port_scenario"
+.LASF1045:
+	.string	"FUNCTION_MSP"
+.LASF913:
+	.string	"RGB_RED"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF804:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1031:
+	.string	"modeId"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF992:
+	.string	"gimbalConfig_s"
+.LASF994:
+	.string	"gimbalConfig_t"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF742:
+	.string	"_BSD_WCHAR_T_"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF911:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF856:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1011:
+	.string	"BOXCALIB"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1196:
+	.string	"serialConfig"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1034:
+	.string	"rangeEndStep"
+.LASF1144:
+	.string	"accDeadband"
+.LASF1165:
+	.string	"pid_process_denom"
+.LASF861:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF831:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1000:
+	.string	"BOXHEADFREE"
+.LASF893:
+	.string	"short unsigned int"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1019:
+	.string	"ROLL"
+.LASF847:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF941:
+	.string	"pitch"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF887:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1022:
+	.string	"AUX1"
+.LASF934:
+	.string	"A_level"
+.LASF1024:
+	.string	"AUX3"
+.LASF1025:
+	.string	"AUX4"
+.LASF1026:
+	.string	"AUX5"
+.LASF1027:
+	.string	"AUX6"
+.LASF1028:
+	.string	"AUX7"
+.LASF1029:
+	.string	"AUX8"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF968:
+	.string	"failsafe_off_delay"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1123:
+	.string	"frskyUnit_e"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF876:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF979:
+	.string	"rxConfig_s"
+.LASF986:
+	.string	"rxConfig_t"
+.LASF832:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF860:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF946:
+	.string	"rollAndPitchTrims_t_def"
+.LASF705:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1119:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF787:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF902:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1134:
+	.string	"profile_s"
+.LASF1158:
+	.string	"profile_t"
+.LASF868:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF774:
+	.string	"USE_BARO_SITL "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF694:
+	.string	"_STDDEF_H_ "
+.LASF1116:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1167:
+	.string	"customMixer"
+.LASF1050:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF790:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1171:
+	.string	"dshot_rate"
+.LASF1156:
+	.string	"mixerConfig"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1224:
+	.string	"configValueGet"
+.LASF854:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF975:
+	.string	"SERIALRX_SBUS"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF914:
+	.string	"RGB_GREEN"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1049:
+	.string	"FUNCTION_GPS"
+.LASF824:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF875:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF966:
+	.string	"failsafeConfig_s"
+.LASF972:
+	.string	"failsafeConfig_t"
+.LASF1056:
+	.string	"gps_baudrate"
+.LASF1075:
+	.string	"CW90_DEG"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1013:
+	.string	"BOXOSD"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF786:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF781:
+	.string	"PROFILING "
+.LASF999:
+	.string	"BOXMAG"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1114:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF756:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF882:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF1113:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF891:
+	.string	"SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)"
+.LASF838:
+	.string	"YAW_CE (3 << (2 * YAW))"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/config/config_values.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14448 @@
+	.file	"altitudehold.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/flight/altitudehold.c"
+	.section	.text.configureAltitudeHold,"ax",@progbits
+	.p2align 4
+	.globl	configureAltitudeHold
+	.type	configureAltitudeHold, @function
+configureAltitudeHold:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/flight/altitudehold.c"
+	.loc 1 74 1 view -0
+	.cfi_startproc
+	.loc 1 75 5 view .LVU1
+	.loc 1 75 16 is_stmt 0 view .LVU2
+	movq	%rdi, pidProfile(%rip)
+	.loc 1 76 5 is_stmt 1 view .LVU3
+	.loc 1 76 21 is_stmt 0 view .LVU4
+	movq	%rsi, barometerConfig(%rip)
+	.loc 1 77 1 view .LVU5
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	configureAltitudeHold, .-configureAltitudeHold
+	.section	.text.applyAltHold,"ax",@progbits
+	.p2align 4
+	.globl	applyAltHold
+	.type	applyAltHold, @function
+applyAltHold:
+.LFB14:
+	.loc 1 132 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 5 view .LVU7
+	.loc 1 133 8 is_stmt 0 view .LVU8
+	testb	$16, stateFlags(%rip)
+	je	.L4
+	.loc 1 134 9 is_stmt 1 view .LVU9
+.LBB12:
+.LBI12:
+	.loc 1 122 13 view .LVU10
+.LBB13:
+	.loc 1 128 5 view .LVU11
+	.loc 1 128 22 is_stmt 0 view .LVU12
+	movsbw	320+masterConfig(%rip), %ax
+	imulw	altHoldThrottleAdjustment(%rip), %ax
+	addw	%ax, 2+rcCommand(%rip)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L4:
+.LBE13:
+.LBE12:
+	.loc 1 136 9 is_stmt 1 view .LVU13
+.LBB14:
+.LBI14:
+	.loc 1 89 13 view .LVU14
+.LBB15:
+	.loc 1 91 5 view .LVU15
+	.loc 1 93 5 view .LVU16
+.LBE15:
+.LBE14:
+	.loc 1 132 1 is_stmt 0 view .LVU17
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB18:
+.LBB16:
+	.loc 1 95 74 view .LVU18
+	movswl	6+rcCommand(%rip), %eax
+	.loc 1 95 85 view .LVU19
+	movswl	initialThrottleHold(%rip), %edi
+	.loc 1 93 23 view .LVU20
+	movq	currentProfile(%rip), %rsi
+	.loc 1 95 74 view .LVU21
+	movl	%eax, %r8d
+	.loc 1 95 85 view .LVU22
+	subl	%edi, %eax
+	.loc 1 95 108 view .LVU23
+	movl	%eax, %edx
+	.loc 1 95 172 view .LVU24
+	movzbl	454(%rsi), %r10d
+	.loc 1 95 108 view .LVU25
+	negl	%edx
+	cmovs	%eax, %edx
+	.loc 1 93 8 view .LVU26
+	cmpb	$0, 455(%rsi)
+	.loc 1 95 172 view .LVU27
+	movl	%r10d, %ecx
+	.loc 1 93 8 view .LVU28
+	jne	.L15
+	.loc 1 108 9 is_stmt 1 view .LVU29
+	.loc 1 108 12 is_stmt 0 view .LVU30
+	cmpl	%r10d, %edx
+	jle	.L10
+	.loc 1 110 13 is_stmt 1 view .LVU31
+	.loc 1 110 71 is_stmt 0 view .LVU32
+	movl	%eax, %edx
+	.loc 1 111 29 view .LVU33
+	movb	$1, velocityControl(%rip)
+	.loc 1 110 71 view .LVU34
+	shrl	$31, %edx
+	.loc 1 112 30 view .LVU35
+	movb	$1, isAltHoldChanged.6(%rip)
+	.loc 1 110 71 view .LVU36
+	addl	%edx, %eax
+	sarl	%eax
+	.loc 1 110 25 view .LVU37
+	movl	%eax, setVelocity(%rip)
+	.loc 1 111 13 is_stmt 1 view .LVU38
+	.loc 1 112 13 view .LVU39
+.L11:
+	.loc 1 118 9 view .LVU40
+	.loc 1 118 31 is_stmt 0 view .LVU41
+	movzwl	210+masterConfig(%rip), %edx
+	movzwl	208+masterConfig(%rip), %esi
+	addl	altHoldThrottleAdjustment(%rip), %edi
+	call	constrain@PLT
+.LVL1:
+	.loc 1 118 29 view .LVU42
+	movw	%ax, 6+rcCommand(%rip)
+.L3:
+.LBE16:
+.LBE18:
+	.loc 1 138 1 view .LVU43
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+.LBB19:
+.LBB17:
+	.loc 1 95 9 is_stmt 1 view .LVU44
+	.loc 1 95 12 is_stmt 0 view .LVU45
+	cmpl	%r10d, %edx
+	jle	.L7
+	.loc 1 96 13 is_stmt 1 view .LVU46
+	.loc 1 98 33 is_stmt 0 view .LVU47
+	movl	%r10d, %eax
+	.loc 1 97 30 view .LVU48
+	movb	$1, isAltHoldChanged.6(%rip)
+	.loc 1 96 28 view .LVU49
+	movl	$0, errorVelocityI(%rip)
+	.loc 1 97 13 is_stmt 1 view .LVU50
+	.loc 1 98 13 view .LVU51
+	.loc 1 98 33 is_stmt 0 view .LVU52
+	negl	%eax
+	cmpw	%di, %r8w
+	cmovg	%eax, %ecx
+	addl	%ecx, %r8d
+	movw	%r8w, 6+rcCommand(%rip)
+	jmp	.L3
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 113 16 is_stmt 1 view .LVU53
+	.loc 1 113 19 is_stmt 0 view .LVU54
+	cmpb	$0, isAltHoldChanged.6(%rip)
+	je	.L11
+	.loc 1 114 13 is_stmt 1 view .LVU55
+	.loc 1 114 21 is_stmt 0 view .LVU56
+	movl	EstAlt(%rip), %eax
+	.loc 1 115 29 view .LVU57
+	movb	$0, velocityControl(%rip)
+	.loc 1 116 30 view .LVU58
+	movb	$0, isAltHoldChanged.6(%rip)
+	.loc 1 114 21 view .LVU59
+	movl	%eax, AltHold(%rip)
+	.loc 1 115 13 is_stmt 1 view .LVU60
+	.loc 1 116 13 view .LVU61
+	jmp	.L11
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.loc 1 100 13 view .LVU62
+	.loc 1 100 16 is_stmt 0 view .LVU63
+	cmpb	$0, isAltHoldChanged.6(%rip)
+	je	.L11
+	.loc 1 101 17 is_stmt 1 view .LVU64
+	.loc 1 101 25 is_stmt 0 view .LVU65
+	movl	EstAlt(%rip), %eax
+	.loc 1 102 34 view .LVU66
+	movb	$0, isAltHoldChanged.6(%rip)
+	.loc 1 101 25 view .LVU67
+	movl	%eax, AltHold(%rip)
+	.loc 1 102 17 is_stmt 1 view .LVU68
+	.loc 1 104 13 view .LVU69
+	jmp	.L11
+.LBE17:
+.LBE19:
+	.cfi_endproc
+.LFE14:
+	.size	applyAltHold, .-applyAltHold
+	.section	.text.updateAltHoldState,"ax",@progbits
+	.p2align 4
+	.globl	updateAltHoldState
+	.type	updateAltHoldState, @function
+updateAltHoldState:
+.LFB15:
+	.loc 1 141 1 view -0
+	.cfi_startproc
+	.loc 1 143 5 view .LVU71
+	.loc 1 144 26 is_stmt 0 view .LVU72
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 143 8 view .LVU73
+	testb	$8, rcModeActivationMask(%rip)
+	je	.L19
+	.loc 1 148 5 is_stmt 1 view .LVU74
+	.loc 1 148 8 is_stmt 0 view .LVU75
+	testb	$8, %al
+	jne	.L16
+	.loc 1 149 9 is_stmt 1 view .LVU76
+	.loc 1 152 24 is_stmt 0 view .LVU77
+	movl	$0, errorVelocityI(%rip)
+	.loc 1 149 26 view .LVU78
+	orl	$8, %eax
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 150 9 is_stmt 1 view .LVU79
+	.loc 1 150 17 is_stmt 0 view .LVU80
+	movl	EstAlt(%rip), %eax
+	.loc 1 153 35 view .LVU81
+	movl	$0, altHoldThrottleAdjustment(%rip)
+	.loc 1 150 17 view .LVU82
+	movl	%eax, AltHold(%rip)
+	.loc 1 151 9 is_stmt 1 view .LVU83
+	.loc 1 151 29 is_stmt 0 view .LVU84
+	movzwl	6+rcCommand(%rip), %eax
+	movw	%ax, initialThrottleHold(%rip)
+	.loc 1 152 9 is_stmt 1 view .LVU85
+	.loc 1 153 9 view .LVU86
+.L16:
+	.loc 1 155 1 is_stmt 0 view .LVU87
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.loc 1 144 9 is_stmt 1 view .LVU88
+	.loc 1 144 26 is_stmt 0 view .LVU89
+	andl	$-9, %eax
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 145 9 is_stmt 1 view .LVU90
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	updateAltHoldState, .-updateAltHoldState
+	.section	.text.updateSonarAltHoldState,"ax",@progbits
+	.p2align 4
+	.globl	updateSonarAltHoldState
+	.type	updateSonarAltHoldState, @function
+updateSonarAltHoldState:
+.LFB16:
+	.loc 1 158 1 view -0
+	.cfi_startproc
+	.loc 1 160 5 view .LVU92
+	.loc 1 161 26 is_stmt 0 view .LVU93
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 160 8 view .LVU94
+	testb	$32, 2+rcModeActivationMask(%rip)
+	je	.L23
+	.loc 1 165 5 is_stmt 1 view .LVU95
+	.loc 1 165 8 is_stmt 0 view .LVU96
+	testb	$2, %ah
+	jne	.L20
+	.loc 1 166 9 is_stmt 1 view .LVU97
+	.loc 1 169 24 is_stmt 0 view .LVU98
+	movl	$0, errorVelocityI(%rip)
+	.loc 1 166 26 view .LVU99
+	orb	$2, %ah
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 167 9 is_stmt 1 view .LVU100
+	.loc 1 167 17 is_stmt 0 view .LVU101
+	movl	EstAlt(%rip), %eax
+	.loc 1 170 35 view .LVU102
+	movl	$0, altHoldThrottleAdjustment(%rip)
+	.loc 1 167 17 view .LVU103
+	movl	%eax, AltHold(%rip)
+	.loc 1 168 9 is_stmt 1 view .LVU104
+	.loc 1 168 29 is_stmt 0 view .LVU105
+	movzwl	6+rcCommand(%rip), %eax
+	movw	%ax, initialThrottleHold(%rip)
+	.loc 1 169 9 is_stmt 1 view .LVU106
+	.loc 1 170 9 view .LVU107
+.L20:
+	.loc 1 172 1 is_stmt 0 view .LVU108
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.loc 1 161 9 is_stmt 1 view .LVU109
+	.loc 1 161 26 is_stmt 0 view .LVU110
+	andb	$-3, %ah
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 162 9 is_stmt 1 view .LVU111
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	updateSonarAltHoldState, .-updateSonarAltHoldState
+	.section	.text.isThrustFacingDownwards,"ax",@progbits
+	.p2align 4
+	.globl	isThrustFacingDownwards
+	.type	isThrustFacingDownwards, @function
+isThrustFacingDownwards:
+.LVL2:
+.LFB17:
+	.loc 1 175 1 view -0
+	.cfi_startproc
+	.loc 1 176 5 view .LVU113
+	.loc 1 176 95 is_stmt 0 view .LVU114
+	movzwl	(%rdi), %edx
+	movl	%edx, %eax
+	negw	%ax
+	cmovs	%edx, %eax
+	xorl	%edx, %edx
+	.loc 1 176 143 view .LVU115
+	cmpw	$799, %ax
+	ja	.L24
+	.loc 1 176 231 discriminator 1 view .LVU116
+	movzwl	2(%rdi), %edx
+	movl	%edx, %eax
+	negw	%ax
+	cmovs	%edx, %eax
+	.loc 1 176 143 discriminator 1 view .LVU117
+	cmpw	$799, %ax
+	setbe	%dl
+.L24:
+	.loc 1 177 1 view .LVU118
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	isThrustFacingDownwards, .-isThrustFacingDownwards
+	.section	.text.calculateTiltAngle,"ax",@progbits
+	.p2align 4
+	.globl	calculateTiltAngle
+	.type	calculateTiltAngle, @function
+calculateTiltAngle:
+.LVL3:
+.LFB18:
+	.loc 1 180 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 181 5 view .LVU120
+	.loc 1 181 228 is_stmt 0 view .LVU121
+	movzwl	2(%rdi), %edx
+	.loc 1 181 97 view .LVU122
+	movzwl	(%rdi), %ecx
+	.loc 1 181 228 view .LVU123
+	movl	%edx, %eax
+	negw	%ax
+	cmovs	%edx, %eax
+	.loc 1 181 97 view .LVU124
+	movl	%ecx, %edx
+	negw	%dx
+	cmovs	%ecx, %edx
+	.loc 1 181 401 view .LVU125
+	cmpw	%dx, %ax
+	cmovb	%edx, %eax
+	.loc 1 182 1 view .LVU126
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	calculateTiltAngle, .-calculateTiltAngle
+	.section	.text.calculateAltHoldThrottleAdjustment,"ax",@progbits
+	.p2align 4
+	.globl	calculateAltHoldThrottleAdjustment
+	.type	calculateAltHoldThrottleAdjustment, @function
+calculateAltHoldThrottleAdjustment:
+.LVL4:
+.LFB19:
+	.loc 1 186 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 187 5 view .LVU128
+	.loc 1 188 5 view .LVU129
+	.loc 1 189 5 view .LVU130
+	.loc 1 191 5 view .LVU131
+.LBB26:
+.LBI26:
+	.loc 1 174 5 view .LVU132
+.LBB27:
+	.loc 1 176 5 view .LVU133
+.LBE27:
+.LBE26:
+	.loc 1 186 1 is_stmt 0 view .LVU134
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+.LBB32:
+.LBB28:
+	.loc 1 176 95 view .LVU135
+	movzwl	inclination(%rip), %eax
+.LBE28:
+.LBE32:
+	.loc 1 186 1 view .LVU136
+	movss	%xmm0, 8(%rsp)
+.LBB33:
+.LBB29:
+	.loc 1 176 95 view .LVU137
+	movl	%eax, %edx
+.LBE29:
+.LBE33:
+	.loc 1 186 1 view .LVU138
+	movss	%xmm1, 12(%rsp)
+.LBB34:
+.LBB30:
+	.loc 1 176 95 view .LVU139
+	negw	%dx
+	cmovs	%eax, %edx
+.LBE30:
+.LBE34:
+	.loc 1 192 16 view .LVU140
+	xorl	%eax, %eax
+.LBB35:
+.LBB31:
+	.loc 1 176 143 view .LVU141
+	cmpw	$799, %dx
+	ja	.L28
+	.loc 1 176 231 view .LVU142
+	movzwl	2+inclination(%rip), %ecx
+	movl	%ecx, %edx
+	negw	%dx
+	cmovs	%ecx, %edx
+	.loc 1 176 143 view .LVU143
+	cmpw	$799, %dx
+	ja	.L28
+.LBE31:
+.LBE35:
+.LBB36:
+.LBB37:
+	.loc 1 197 8 view .LVU144
+	cmpb	$0, velocityControl(%rip)
+	.loc 1 202 16 view .LVU145
+	movl	setVelocity(%rip), %ebx
+	movl	%edi, %ebp
+.LVL5:
+	.loc 1 202 16 view .LVU146
+.LBE37:
+.LBI36:
+	.loc 1 185 9 is_stmt 1 view .LVU147
+.LBB38:
+	.loc 1 197 5 view .LVU148
+	.loc 1 197 8 is_stmt 0 view .LVU149
+	je	.L35
+.LVL6:
+.L31:
+	.loc 1 207 5 is_stmt 1 view .LVU150
+	.loc 1 208 39 is_stmt 0 view .LVU151
+	movq	pidProfile(%rip), %rax
+	.loc 1 207 11 view .LVU152
+	subl	%ebp, %ebx
+.LVL7:
+	.loc 1 208 5 is_stmt 1 view .LVU153
+	.loc 1 208 14 is_stmt 0 view .LVU154
+	movl	$-300, %esi
+	.loc 1 208 39 view .LVU155
+	movzbl	9(%rax), %edx
+	.loc 1 208 48 view .LVU156
+	imull	%ebx, %edx
+	.loc 1 208 14 view .LVU157
+	testl	%edx, %edx
+	leal	31(%rdx), %edi
+	cmovns	%edx, %edi
+	movl	$300, %edx
+	sarl	$5, %edi
+	call	constrain@PLT
+.LVL8:
+	.loc 1 212 22 view .LVU158
+	movl	$1638400, %edx
+	movl	$-1638400, %esi
+	.loc 1 208 14 view .LVU159
+	movl	%eax, %ebp
+.LVL9:
+	.loc 1 211 5 is_stmt 1 view .LVU160
+	.loc 1 211 38 is_stmt 0 view .LVU161
+	movq	pidProfile(%rip), %rax
+.LVL10:
+	.loc 1 211 38 view .LVU162
+	movzbl	19(%rax), %edi
+	.loc 1 211 47 view .LVU163
+	imull	%ebx, %edi
+	.loc 1 211 20 view .LVU164
+	addl	errorVelocityI(%rip), %edi
+	movl	%edi, errorVelocityI(%rip)
+	.loc 1 212 5 is_stmt 1 view .LVU165
+	.loc 1 212 22 is_stmt 0 view .LVU166
+	call	constrain@PLT
+.LVL11:
+	.loc 1 216 48 view .LVU167
+	pxor	%xmm0, %xmm0
+	.loc 1 216 60 view .LVU168
+	movss	8(%rsp), %xmm1
+	addss	12(%rsp), %xmm1
+	.loc 1 213 30 view .LVU169
+	testl	%eax, %eax
+	leal	8191(%rax), %ebx
+.LVL12:
+	.loc 1 212 20 view .LVU170
+	movl	%eax, errorVelocityI(%rip)
+	.loc 1 213 5 is_stmt 1 view .LVU171
+	.loc 1 216 15 is_stmt 0 view .LVU172
+	movl	$150, %edx
+	.loc 1 213 30 view .LVU173
+	cmovs	%ebx, %eax
+	.loc 1 216 15 view .LVU174
+	movl	$-150, %esi
+	.loc 1 213 30 view .LVU175
+	sarl	$13, %eax
+	.loc 1 213 12 view .LVU176
+	addl	%eax, %ebp
+.LVL13:
+	.loc 1 216 5 is_stmt 1 view .LVU177
+	.loc 1 216 39 is_stmt 0 view .LVU178
+	movq	pidProfile(%rip), %rax
+	movzbl	29(%rax), %eax
+	.loc 1 216 48 view .LVU179
+	cvtsi2ssl	%eax, %xmm0
+	mulss	%xmm1, %xmm0
+	.loc 1 216 72 view .LVU180
+	mulss	.LC0(%rip), %xmm0
+	.loc 1 216 15 view .LVU181
+	cvttss2sil	%xmm0, %edi
+	call	constrain@PLT
+.LVL14:
+	movl	%eax, %edx
+	.loc 1 216 12 view .LVU182
+	movl	%ebp, %eax
+	subl	%edx, %eax
+.LVL15:
+	.loc 1 218 5 is_stmt 1 view .LVU183
+.L28:
+	.loc 1 218 5 is_stmt 0 view .LVU184
+.LBE38:
+.LBE36:
+	.loc 1 219 1 view .LVU185
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL16:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.cfi_restore_state
+.LBB40:
+.LBB39:
+	.loc 1 198 9 is_stmt 1 view .LVU186
+	.loc 1 198 17 is_stmt 0 view .LVU187
+	movl	$500, %edx
+	movl	AltHold(%rip), %edi
+.LVL17:
+	.loc 1 198 17 view .LVU188
+	movl	$-500, %esi
+	subl	EstAlt(%rip), %edi
+	call	constrain@PLT
+.LVL18:
+	.loc 1 199 17 view .LVU189
+	movl	$10, %esi
+	.loc 1 198 17 view .LVU190
+	movl	%eax, %edi
+.LVL19:
+	.loc 1 199 9 is_stmt 1 view .LVU191
+	.loc 1 199 17 is_stmt 0 view .LVU192
+	call	applyDeadband@PLT
+.LVL20:
+	.loc 1 200 18 view .LVU193
+	movl	$-300, %esi
+	.loc 1 199 17 view .LVU194
+	movl	%eax, %edx
+.LVL21:
+	.loc 1 200 9 is_stmt 1 view .LVU195
+	.loc 1 200 43 is_stmt 0 view .LVU196
+	movq	pidProfile(%rip), %rax
+.LVL22:
+	.loc 1 200 43 view .LVU197
+	movzbl	3(%rax), %eax
+	.loc 1 200 52 view .LVU198
+	imull	%edx, %eax
+	.loc 1 200 18 view .LVU199
+	movl	$300, %edx
+.LVL23:
+	.loc 1 200 18 view .LVU200
+	testl	%eax, %eax
+	leal	127(%rax), %edi
+	cmovns	%eax, %edi
+	sarl	$7, %edi
+	call	constrain@PLT
+.LVL24:
+	movl	%eax, %ebx
+.LVL25:
+	.loc 1 200 18 view .LVU201
+	jmp	.L31
+.LBE39:
+.LBE40:
+	.cfi_endproc
+.LFE19:
+	.size	calculateAltHoldThrottleAdjustment, .-calculateAltHoldThrottleAdjustment
+	.section	.text.calculateEstimatedAltitude,"ax",@progbits
+	.p2align 4
+	.globl	calculateEstimatedAltitude
+	.type	calculateEstimatedAltitude, @function
+calculateEstimatedAltitude:
+.LVL26:
+.LFB20:
+	.loc 1 222 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 223 5 view .LVU203
+	.loc 1 224 5 view .LVU204
+	.loc 1 225 5 view .LVU205
+	.loc 1 226 5 view .LVU206
+	.loc 1 227 5 view .LVU207
+	.loc 1 228 5 view .LVU208
+	.loc 1 229 5 view .LVU209
+	.loc 1 230 5 view .LVU210
+	.loc 1 231 5 view .LVU211
+	.loc 1 232 5 view .LVU212
+	.loc 1 233 5 view .LVU213
+	.loc 1 235 5 view .LVU214
+	.loc 1 236 5 view .LVU215
+	.loc 1 244 5 view .LVU216
+	.loc 1 222 1 is_stmt 0 view .LVU217
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 244 11 view .LVU218
+	movl	%edi, %ebx
+	subl	previousTime.5(%rip), %ebx
+.LVL27:
+	.loc 1 245 5 is_stmt 1 view .LVU219
+	.loc 1 245 8 is_stmt 0 view .LVU220
+	cmpl	$24999, %ebx
+	ja	.L54
+.LVL28:
+.L36:
+	.loc 1 327 1 view .LVU221
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL29:
+	.loc 1 327 1 view .LVU222
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL30:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.cfi_restore_state
+	.loc 1 248 5 is_stmt 1 view .LVU223
+	.loc 1 248 18 is_stmt 0 view .LVU224
+	movl	%edi, previousTime.5(%rip)
+	.loc 1 251 5 is_stmt 1 view .LVU225
+	.loc 1 251 10 is_stmt 0 view .LVU226
+	call	isBaroCalibrationComplete@PLT
+.LVL31:
+	.loc 1 251 8 view .LVU227
+	testb	%al, %al
+	je	.L55
+.L39:
+	.loc 1 257 5 is_stmt 1 view .LVU228
+	.loc 1 257 15 is_stmt 0 view .LVU229
+	call	baroCalculateAltitude@PLT
+.LVL32:
+	.loc 1 267 5 is_stmt 1 view .LVU230
+	.loc 1 267 22 is_stmt 0 view .LVU231
+	movl	sonarAlt(%rip), %edx
+	leal	-1(%rdx), %ecx
+	.loc 1 267 8 view .LVU232
+	cmpl	$198, %ecx
+	ja	.L40
+	.loc 1 268 9 is_stmt 1 view .LVU233
+	movss	.LC3(%rip), %xmm6
+	.loc 1 268 34 is_stmt 0 view .LVU234
+	subl	%edx, %eax
+	movl	%eax, baroAlt_offset.2(%rip)
+	.loc 1 269 9 is_stmt 1 view .LVU235
+	movl	%edx, %eax
+	movd	%xmm6, %r14d
+.L41:
+	.loc 1 281 16 is_stmt 0 view .LVU236
+	pxor	%xmm2, %xmm2
+	.loc 1 281 35 view .LVU237
+	pxor	%xmm1, %xmm1
+	.loc 1 278 21 view .LVU238
+	pxor	%xmm0, %xmm0
+	.loc 1 269 17 view .LVU239
+	movl	%eax, BaroAlt(%rip)
+	.loc 1 278 5 is_stmt 1 view .LVU240
+	.loc 1 281 35 is_stmt 0 view .LVU241
+	cvtsi2ssl	accSumCount(%rip), %xmm1
+	.loc 1 278 21 view .LVU242
+	movl	accTimeSum(%rip), %eax
+	.loc 1 278 8 view .LVU243
+	movss	.LC4(%rip), %xmm3
+	.loc 1 286 77 view .LVU244
+	movd	%r14d, %xmm5
+	.loc 1 281 16 view .LVU245
+	cvtsi2ssl	8+accSum(%rip), %xmm2
+	.loc 1 278 21 view .LVU246
+	cvtsi2ssq	%rax, %xmm0
+	.loc 1 286 38 view .LVU247
+	movq	barometerConfig(%rip), %rax
+	movss	12(%rax), %xmm4
+	.loc 1 281 14 view .LVU248
+	divss	%xmm1, %xmm2
+	.loc 1 285 43 view .LVU249
+	movss	vel.4(%rip), %xmm1
+	.loc 1 278 8 view .LVU250
+	mulss	%xmm0, %xmm3
+.LVL33:
+	.loc 1 281 5 is_stmt 1 view .LVU251
+	.loc 1 286 77 is_stmt 0 view .LVU252
+	subss	%xmm4, %xmm5
+	.loc 1 281 14 view .LVU253
+	movd	%xmm2, %r15d
+.LVL34:
+	.loc 1 282 5 is_stmt 1 view .LVU254
+	.loc 1 282 24 is_stmt 0 view .LVU255
+	mulss	accVelScale(%rip), %xmm2
+.LVL35:
+	.loc 1 282 13 view .LVU256
+	mulss	%xmm0, %xmm2
+.LVL36:
+	.loc 1 285 5 is_stmt 1 view .LVU257
+	.loc 1 286 5 view .LVU258
+	.loc 1 285 24 is_stmt 0 view .LVU259
+	movss	.LC5(%rip), %xmm0
+	mulss	%xmm2, %xmm0
+	.loc 1 285 32 view .LVU260
+	mulss	%xmm3, %xmm0
+	.loc 1 285 43 view .LVU261
+	mulss	%xmm1, %xmm3
+.LVL37:
+	.loc 1 287 9 view .LVU262
+	addss	%xmm2, %xmm1
+	movss	%xmm1, vel.4(%rip)
+	.loc 1 285 37 view .LVU263
+	addss	%xmm3, %xmm0
+	.loc 1 286 54 view .LVU264
+	pxor	%xmm3, %xmm3
+	.loc 1 285 12 view .LVU265
+	addss	accAlt.3(%rip), %xmm0
+	.loc 1 286 54 view .LVU266
+	cvtsi2ssl	%edx, %xmm3
+	.loc 1 286 21 view .LVU267
+	mulss	%xmm4, %xmm0
+	.loc 1 286 69 view .LVU268
+	mulss	%xmm5, %xmm3
+	.loc 1 286 52 view .LVU269
+	addss	%xmm3, %xmm0
+	.loc 1 286 12 view .LVU270
+	movss	%xmm0, accAlt.3(%rip)
+	.loc 1 287 5 is_stmt 1 view .LVU271
+	.loc 1 295 5 view .LVU272
+	call	accSum_reset@PLT
+.LVL38:
+	.loc 1 298 5 view .LVU273
+	.loc 1 298 10 is_stmt 0 view .LVU274
+	call	isBaroCalibrationComplete@PLT
+.LVL39:
+	.loc 1 298 8 view .LVU275
+	testb	%al, %al
+	je	.L36
+	.loc 1 303 5 is_stmt 1 view .LVU276
+	.loc 1 303 22 is_stmt 0 view .LVU277
+	movl	sonarAlt(%rip), %esi
+	.loc 1 305 16 view .LVU278
+	movl	BaroAlt(%rip), %eax
+	.loc 1 303 22 view .LVU279
+	leal	-1(%rsi), %edx
+	.loc 1 305 16 view .LVU280
+	movl	%eax, %ecx
+	.loc 1 303 8 view .LVU281
+	cmpl	$198, %edx
+	ja	.L56
+.L45:
+	.loc 1 310 24 view .LVU282
+	movl	%eax, %edx
+	.loc 1 310 39 view .LVU283
+	pxor	%xmm0, %xmm0
+	.loc 1 310 52 view .LVU284
+	pxor	%xmm1, %xmm1
+	.loc 1 310 24 view .LVU285
+	subl	lastBaroAlt.1(%rip), %edx
+	.loc 1 310 39 view .LVU286
+	cvtsi2ssl	%edx, %xmm0
+	.loc 1 313 15 view .LVU287
+	movl	$-1500, %esi
+	movl	$1500, %edx
+	movl	%ecx, EstAlt(%rip)
+	.loc 1 310 5 is_stmt 1 view .LVU288
+	.loc 1 310 39 is_stmt 0 view .LVU289
+	mulss	.LC6(%rip), %xmm0
+	.loc 1 310 52 view .LVU290
+	cvtsi2ssq	%rbx, %xmm1
+	.loc 1 311 17 view .LVU291
+	movl	%eax, lastBaroAlt.1(%rip)
+	.loc 1 310 52 view .LVU292
+	divss	%xmm1, %xmm0
+	.loc 1 310 13 view .LVU293
+	cvttss2sil	%xmm0, %edi
+.LVL40:
+	.loc 1 311 5 is_stmt 1 view .LVU294
+	.loc 1 313 5 view .LVU295
+	.loc 1 313 15 is_stmt 0 view .LVU296
+	call	constrain@PLT
+.LVL41:
+	.loc 1 314 15 view .LVU297
+	movl	$10, %esi
+	.loc 1 313 15 view .LVU298
+	movl	%eax, %edi
+.LVL42:
+	.loc 1 314 5 is_stmt 1 view .LVU299
+	.loc 1 314 15 is_stmt 0 view .LVU300
+	call	applyDeadband@PLT
+.LVL43:
+	.loc 1 318 5 is_stmt 1 view .LVU301
+	.loc 1 318 32 is_stmt 0 view .LVU302
+	movq	barometerConfig(%rip), %rdx
+	.loc 1 318 56 view .LVU303
+	pxor	%xmm0, %xmm0
+	.loc 1 318 64 view .LVU304
+	movd	%r14d, %xmm1
+	.loc 1 318 56 view .LVU305
+	cvtsi2ssl	%eax, %xmm0
+	.loc 1 318 32 view .LVU306
+	movss	8(%rdx), %xmm2
+	.loc 1 318 64 view .LVU307
+	subss	%xmm2, %xmm1
+	.loc 1 318 15 view .LVU308
+	mulss	vel.4(%rip), %xmm2
+	.loc 1 318 56 view .LVU309
+	mulss	%xmm1, %xmm0
+	.loc 1 318 46 view .LVU310
+	addss	%xmm2, %xmm0
+	.loc 1 318 9 view .LVU311
+	movss	%xmm0, vel.4(%rip)
+	.loc 1 319 5 is_stmt 1 view .LVU312
+	.loc 1 319 15 is_stmt 0 view .LVU313
+	call	lrintf@PLT
+.LVL44:
+	.loc 1 322 13 view .LVU314
+	movl	$5, %esi
+	movl	%eax, %edi
+	.loc 1 319 13 view .LVU315
+	movl	%eax, %ebx
+.LVL45:
+	.loc 1 322 5 is_stmt 1 view .LVU316
+	.loc 1 322 13 is_stmt 0 view .LVU317
+	call	applyDeadband@PLT
+.LVL46:
+	.loc 1 324 33 view .LVU318
+	movss	accZ_old.0(%rip), %xmm1
+	movd	%r15d, %xmm0
+	movl	%ebx, %edi
+	.loc 1 322 11 view .LVU319
+	movl	%eax, vario(%rip)
+	.loc 1 324 5 is_stmt 1 view .LVU320
+	.loc 1 324 33 is_stmt 0 view .LVU321
+	call	calculateAltHoldThrottleAdjustment
+.LVL47:
+	.loc 1 327 1 view .LVU322
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	.loc 1 326 14 view .LVU323
+	movl	%r15d, accZ_old.0(%rip)
+	.loc 1 324 31 view .LVU324
+	movl	%eax, altHoldThrottleAdjustment(%rip)
+	.loc 1 326 5 is_stmt 1 view .LVU325
+	.loc 1 327 1 is_stmt 0 view .LVU326
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL48:
+	.loc 1 327 1 view .LVU327
+	ret
+.LVL49:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.cfi_restore_state
+	.loc 1 271 9 is_stmt 1 view .LVU328
+	.loc 1 271 17 is_stmt 0 view .LVU329
+	subl	baroAlt_offset.2(%rip), %eax
+	.loc 1 272 9 is_stmt 1 view .LVU330
+	.loc 1 272 12 is_stmt 0 view .LVU331
+	testl	%edx, %edx
+	jle	.L48
+	.loc 1 273 13 is_stmt 1 view .LVU332
+	.loc 1 274 68 is_stmt 0 view .LVU333
+	movss	.LC3(%rip), %xmm7
+	.loc 1 273 36 view .LVU334
+	movl	$300, %ecx
+	.loc 1 274 60 view .LVU335
+	pxor	%xmm2, %xmm2
+	.loc 1 273 48 view .LVU336
+	pxor	%xmm1, %xmm1
+	.loc 1 274 60 view .LVU337
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 273 36 view .LVU338
+	subl	%edx, %ecx
+	.loc 1 274 68 view .LVU339
+	movaps	%xmm7, %xmm0
+	.loc 1 273 48 view .LVU340
+	cvtsi2ssl	%ecx, %xmm1
+	.loc 1 273 29 view .LVU341
+	divss	.LC2(%rip), %xmm1
+.LVL50:
+	.loc 1 274 13 is_stmt 1 view .LVU342
+	.loc 1 274 68 is_stmt 0 view .LVU343
+	movd	%xmm7, %r14d
+	subss	%xmm1, %xmm0
+	.loc 1 274 60 view .LVU344
+	mulss	%xmm2, %xmm0
+	.loc 1 274 32 view .LVU345
+	pxor	%xmm2, %xmm2
+	cvtsi2ssl	%edx, %xmm2
+	mulss	%xmm2, %xmm1
+.LVL51:
+	.loc 1 274 50 view .LVU346
+	addss	%xmm1, %xmm0
+	.loc 1 274 21 view .LVU347
+	cvttss2sil	%xmm0, %edx
+	movl	%edx, %eax
+	jmp	.L41
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.loc 1 307 9 is_stmt 1 view .LVU348
+	.loc 1 307 16 is_stmt 0 view .LVU349
+	cvttss2sil	accAlt.3(%rip), %ecx
+	jmp	.L45
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 307 16 view .LVU350
+	movss	.LC3(%rip), %xmm7
+	movl	%eax, %edx
+	movd	%xmm7, %r14d
+	jmp	.L41
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 252 9 is_stmt 1 view .LVU351
+	call	performBaroCalibrationCycle@PLT
+.LVL54:
+	.loc 1 253 9 view .LVU352
+	.loc 1 253 13 is_stmt 0 view .LVU353
+	movl	$0x00000000, vel.4(%rip)
+	.loc 1 254 9 is_stmt 1 view .LVU354
+	.loc 1 254 16 is_stmt 0 view .LVU355
+	movl	$0x00000000, accAlt.3(%rip)
+	jmp	.L39
+	.cfi_endproc
+.LFE20:
+	.size	calculateEstimatedAltitude, .-calculateEstimatedAltitude
+	.section	.bss.accZ_old.0,"aw",@nobits
+	.align 4
+	.type	accZ_old.0, @object
+	.size	accZ_old.0, 4
+accZ_old.0:
+	.zero	4
+	.section	.bss.lastBaroAlt.1,"aw",@nobits
+	.align 4
+	.type	lastBaroAlt.1, @object
+	.size	lastBaroAlt.1, 4
+lastBaroAlt.1:
+	.zero	4
+	.section	.bss.baroAlt_offset.2,"aw",@nobits
+	.align 4
+	.type	baroAlt_offset.2, @object
+	.size	baroAlt_offset.2, 4
+baroAlt_offset.2:
+	.zero	4
+	.section	.bss.accAlt.3,"aw",@nobits
+	.align 4
+	.type	accAlt.3, @object
+	.size	accAlt.3, 4
+accAlt.3:
+	.zero	4
+	.section	.bss.vel.4,"aw",@nobits
+	.align 4
+	.type	vel.4, @object
+	.size	vel.4, 4
+vel.4:
+	.zero	4
+	.section	.bss.previousTime.5,"aw",@nobits
+	.align 4
+	.type	previousTime.5, @object
+	.size	previousTime.5, 4
+previousTime.5:
+	.zero	4
+	.section	.bss.isAltHoldChanged.6,"aw",@nobits
+	.type	isAltHoldChanged.6, @object
+	.size	isAltHoldChanged.6, 1
+isAltHoldChanged.6:
+	.zero	1
+	.section	.bss.initialThrottleHold,"aw",@nobits
+	.align 2
+	.type	initialThrottleHold, @object
+	.size	initialThrottleHold, 2
+initialThrottleHold:
+	.zero	2
+	.comm	pidProfile,8,8
+	.comm	barometerConfig,8,8
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	989855744
+	.align 4
+.LC2:
+	.long	1120403456
+	.align 4
+.LC3:
+	.long	1065353216
+	.align 4
+.LC4:
+	.long	897988541
+	.align 4
+.LC5:
+	.long	1056964608
+	.align 4
+.LC6:
+	.long	1232348160
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/drivers/serial.h"
+	.file 6 ".//src/main/drivers/pwm_rx.h"
+	.file 7 ".//src/main/common/color.h"
+	.file 8 ".//src/main/flight/flight.h"
+	.file 9 ".//src/main/sensors/sensors.h"
+	.file 10 ".//src/main/sensors/acceleration.h"
+	.file 11 ".//src/main/sensors/barometer.h"
+	.file 12 ".//src/main/sensors/battery.h"
+	.file 13 ".//src/main/sensors/boardalignment.h"
+	.file 14 ".//src/main/sensors/gyro.h"
+	.file 15 ".//src/main/sensors/sonar.h"
+	.file 16 ".//src/main/io/escservo.h"
+	.file 17 ".//src/main/io/gimbal.h"
+	.file 18 ".//src/main/io/serial.h"
+	.file 19 ".//src/main/flight/failsafe.h"
+	.file 20 ".//src/main/flight/imu.h"
+	.file 21 ".//src/main/flight/mixer.h"
+	.file 22 ".//src/main/telemetry/telemetry.h"
+	.file 23 ".//src/main/rx/rx.h"
+	.file 24 ".//src/main/io/rc_controls.h"
+	.file 25 ".//src/main/config/runtime_config.h"
+	.file 26 ".//src/main/config/config_profile.h"
+	.file 27 ".//src/main/config/config_master.h"
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 29 ".//src/main/common/maths.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x16d3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF1780
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL21
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1415
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1416
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1417
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1418
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1419
+	.uleb128 0x3
+	.long	.LASF1421
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1420
+	.uleb128 0x3
+	.long	.LASF1422
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1423
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x7c
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1424
+	.uleb128 0x3
+	.long	.LASF1425
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x3
+	.long	.LASF1426
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1427
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1428
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1429
+	.uleb128 0x3
+	.long	.LASF1430
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1431
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1432
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF1433
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1434
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1435
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1436
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1437
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1438
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x5
+	.byte	0x16
+	.long	0x131
+	.uleb128 0x2
+	.long	.LASF1439
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1440
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1441
+	.byte	0x5
+	.byte	0x19
+	.byte	0x3
+	.long	0x119
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1442
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x6
+	.byte	0x14
+	.long	0x15c
+	.uleb128 0x2
+	.long	.LASF1443
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1444
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1445
+	.byte	0x6
+	.byte	0x17
+	.byte	0x3
+	.long	0x144
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x7
+	.byte	0x15
+	.long	0x186
+	.uleb128 0x2
+	.long	.LASF1446
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1447
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1448
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x8
+	.byte	0x15
+	.long	0x1d4
+	.uleb128 0x2
+	.long	.LASF1449
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1450
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1451
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1452
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1453
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1455
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1456
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1457
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1458
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1459
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1464
+	.byte	0x50
+	.byte	0x8
+	.byte	0x23
+	.long	0x253
+	.uleb128 0xa
+	.string	"P8"
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0x253
+	.byte	0
+	.uleb128 0xa
+	.string	"I8"
+	.byte	0x8
+	.byte	0x25
+	.byte	0xd
+	.long	0x253
+	.byte	0xa
+	.uleb128 0xa
+	.string	"D8"
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0x253
+	.byte	0x14
+	.uleb128 0xa
+	.string	"P_f"
+	.byte	0x8
+	.byte	0x28
+	.byte	0xb
+	.long	0x263
+	.byte	0x20
+	.uleb128 0xa
+	.string	"I_f"
+	.byte	0x8
+	.byte	0x29
+	.byte	0xb
+	.long	0x263
+	.byte	0x2c
+	.uleb128 0xa
+	.string	"D_f"
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xb
+	.long	0x263
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xb
+	.long	0x2e
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xb
+	.long	0x2e
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4c
+	.byte	0
+	.uleb128 0xb
+	.long	0xe0
+	.long	0x263
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x9
+	.byte	0
+	.uleb128 0xb
+	.long	0x2e
+	.long	0x273
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1463
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x1d4
+	.uleb128 0x5
+	.long	.LASF1465
+	.byte	0x6
+	.byte	0x8
+	.byte	0x57
+	.long	0x2b3
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x8
+	.byte	0x58
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x8
+	.byte	0x59
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0xa
+	.string	"yaw"
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1468
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x3
+	.long	0x27f
+	.uleb128 0x15
+	.byte	0x6
+	.byte	0x5d
+	.long	0x2dc
+	.uleb128 0x16
+	.string	"raw"
+	.byte	0x5e
+	.long	0x2dc
+	.uleb128 0x17
+	.long	.LASF1469
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x2b3
+	.byte	0
+	.uleb128 0xb
+	.long	0xc8
+	.long	0x2ec
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1470
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x2bf
+	.uleb128 0x5
+	.long	.LASF1471
+	.byte	0x4
+	.byte	0x8
+	.byte	0x62
+	.long	0x31f
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x8
+	.byte	0x63
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x8
+	.byte	0x64
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1472
+	.byte	0x8
+	.byte	0x65
+	.byte	0x3
+	.long	0x2f8
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x67
+	.long	0x348
+	.uleb128 0x16
+	.string	"raw"
+	.byte	0x68
+	.long	0x348
+	.uleb128 0x17
+	.long	.LASF1469
+	.byte	0x69
+	.byte	0x1d
+	.long	0x31f
+	.byte	0
+	.uleb128 0xb
+	.long	0xc8
+	.long	0x358
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1473
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x3
+	.long	0x32b
+	.uleb128 0x5
+	.long	.LASF1474
+	.byte	0x4
+	.byte	0x8
+	.byte	0x6c
+	.long	0x38b
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0x8
+	.byte	0x6f
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1477
+	.byte	0x8
+	.byte	0x70
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x72
+	.long	0x3b4
+	.uleb128 0x16
+	.string	"raw"
+	.byte	0x73
+	.long	0x348
+	.uleb128 0x17
+	.long	.LASF1469
+	.byte	0x74
+	.byte	0x23
+	.long	0x38b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1478
+	.byte	0x8
+	.byte	0x75
+	.byte	0x3
+	.long	0x397
+	.uleb128 0x6
+	.long	.LASF1479
+	.byte	0x8
+	.byte	0x7b
+	.byte	0x22
+	.long	0x3b4
+	.uleb128 0xb
+	.long	0xd4
+	.long	0x3dc
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1480
+	.byte	0x8
+	.byte	0x81
+	.byte	0x10
+	.long	0x3cc
+	.uleb128 0x6
+	.long	.LASF1481
+	.byte	0x8
+	.byte	0x86
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1482
+	.byte	0x8
+	.byte	0x87
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1483
+	.byte	0x8
+	.byte	0x89
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x9
+	.byte	0x22
+	.long	0x44e
+	.uleb128 0x2
+	.long	.LASF1484
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1485
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1486
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1487
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1488
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1490
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1491
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1492
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1493
+	.byte	0x9
+	.byte	0x2c
+	.byte	0x3
+	.long	0x40c
+	.uleb128 0x5
+	.long	.LASF1494
+	.byte	0xc
+	.byte	0x9
+	.byte	0x2e
+	.long	0x48e
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x14
+	.long	0x44e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x9
+	.byte	0x30
+	.byte	0x14
+	.long	0x44e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x9
+	.byte	0x31
+	.byte	0x14
+	.long	0x44e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0x9
+	.byte	0x32
+	.byte	0x3
+	.long	0x45a
+	.uleb128 0x5
+	.long	.LASF1499
+	.byte	0x2
+	.byte	0xa
+	.byte	0x27
+	.long	0x4be
+	.uleb128 0xa
+	.string	"xy"
+	.byte	0xa
+	.byte	0x28
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0xa
+	.string	"z"
+	.byte	0xa
+	.byte	0x29
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x3
+	.long	0x49a
+	.uleb128 0x5
+	.long	.LASF1501
+	.byte	0x10
+	.byte	0xb
+	.byte	0x16
+	.long	0x50b
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0xb
+	.byte	0x17
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0xb
+	.byte	0x18
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0xb
+	.byte	0x19
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xb
+	.long	0x2e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1506
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x3
+	.long	0x4ca
+	.uleb128 0x6
+	.long	.LASF1507
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF1508
+	.byte	0xa
+	.byte	0xc
+	.byte	0x18
+	.long	0x57e
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0xc
+	.byte	0x19
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0xc
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0xc
+	.byte	0x1e
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0xc
+	.byte	0x21
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1515
+	.byte	0xc
+	.byte	0x22
+	.byte	0x3
+	.long	0x523
+	.uleb128 0x5
+	.long	.LASF1516
+	.byte	0x6
+	.byte	0xd
+	.byte	0x14
+	.long	0x5be
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0xd
+	.byte	0x15
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0xd
+	.byte	0x16
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0xd
+	.byte	0x17
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1520
+	.byte	0xd
+	.byte	0x18
+	.byte	0x3
+	.long	0x58a
+	.uleb128 0x5
+	.long	.LASF1521
+	.byte	0x8
+	.byte	0xe
+	.byte	0x17
+	.long	0x60b
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0xe
+	.byte	0x18
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0xe
+	.byte	0x19
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1526
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x3
+	.long	0x5ca
+	.uleb128 0x6
+	.long	.LASF1527
+	.byte	0xf
+	.byte	0x14
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF1528
+	.byte	0x6
+	.byte	0x10
+	.byte	0x14
+	.long	0x657
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x10
+	.byte	0x15
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x10
+	.byte	0x16
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x10
+	.byte	0x17
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1532
+	.byte	0x10
+	.byte	0x18
+	.byte	0x3
+	.long	0x623
+	.uleb128 0x5
+	.long	.LASF1533
+	.byte	0x1
+	.byte	0x11
+	.byte	0x1a
+	.long	0x67d
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x11
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1535
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x3
+	.long	0x663
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x12
+	.byte	0x14
+	.long	0x6c5
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1537
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1539
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1540
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1541
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1542
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1544
+	.byte	0x18
+	.byte	0x12
+	.byte	0x80
+	.long	0x720
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x12
+	.byte	0x81
+	.byte	0xd
+	.long	0x720
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x12
+	.byte	0x82
+	.byte	0xe
+	.long	0xf8
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x12
+	.byte	0x83
+	.byte	0xe
+	.long	0xf8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x12
+	.byte	0x84
+	.byte	0xe
+	.long	0xf8
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x12
+	.byte	0x85
+	.byte	0xe
+	.long	0xf8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x12
+	.byte	0x87
+	.byte	0xd
+	.long	0xe0
+	.byte	0x14
+	.byte	0
+	.uleb128 0xb
+	.long	0xe0
+	.long	0x730
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1551
+	.byte	0x12
+	.byte	0x88
+	.byte	0x3
+	.long	0x6c5
+	.uleb128 0x5
+	.long	.LASF1552
+	.byte	0x8
+	.byte	0x13
+	.byte	0x16
+	.long	0x78a
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x13
+	.byte	0x17
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x13
+	.byte	0x18
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x13
+	.byte	0x19
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x13
+	.byte	0x1a
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1558
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0x73c
+	.uleb128 0x6
+	.long	.LASF1559
+	.byte	0x14
+	.byte	0x14
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1560
+	.byte	0x14
+	.byte	0x15
+	.byte	0x10
+	.long	0xe0
+	.uleb128 0x6
+	.long	.LASF1561
+	.byte	0x14
+	.byte	0x16
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1562
+	.byte	0x14
+	.byte	0x17
+	.byte	0x10
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1563
+	.byte	0x14
+	.byte	0x19
+	.byte	0x11
+	.long	0xf8
+	.uleb128 0x6
+	.long	.LASF1564
+	.byte	0x14
+	.byte	0x1a
+	.byte	0xc
+	.long	0x9b
+	.uleb128 0x6
+	.long	.LASF1565
+	.byte	0x14
+	.byte	0x1b
+	.byte	0xe
+	.long	0x2e
+	.uleb128 0x5
+	.long	.LASF1566
+	.byte	0x10
+	.byte	0x15
+	.byte	0x34
+	.long	0x82b
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x15
+	.byte	0x35
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x15
+	.byte	0x36
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x15
+	.byte	0x37
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xa
+	.string	"yaw"
+	.byte	0x15
+	.byte	0x38
+	.byte	0xb
+	.long	0x2e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1566
+	.byte	0x15
+	.byte	0x39
+	.byte	0x3
+	.long	0x7ea
+	.uleb128 0x5
+	.long	.LASF1568
+	.byte	0x2
+	.byte	0x15
+	.byte	0x42
+	.long	0x85e
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x15
+	.byte	0x43
+	.byte	0xc
+	.long	0xbc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x15
+	.byte	0x44
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1571
+	.byte	0x15
+	.byte	0x45
+	.byte	0x3
+	.long	0x837
+	.uleb128 0x5
+	.long	.LASF1572
+	.byte	0x8
+	.byte	0x15
+	.byte	0x47
+	.long	0x8ab
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x15
+	.byte	0x48
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x15
+	.byte	0x49
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x15
+	.byte	0x4a
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x15
+	.byte	0x4b
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1577
+	.byte	0x15
+	.byte	0x4c
+	.byte	0x3
+	.long	0x86a
+	.uleb128 0x5
+	.long	.LASF1578
+	.byte	0x1
+	.byte	0x15
+	.byte	0x4e
+	.long	0x8d1
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x15
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1578
+	.byte	0x15
+	.byte	0x50
+	.byte	0x3
+	.long	0x8b7
+	.uleb128 0x5
+	.long	.LASF1580
+	.byte	0x8
+	.byte	0x15
+	.byte	0x54
+	.long	0x92b
+	.uleb128 0xa
+	.string	"min"
+	.byte	0x15
+	.byte	0x55
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0xa
+	.string	"max"
+	.byte	0x15
+	.byte	0x56
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x15
+	.byte	0x57
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x15
+	.byte	0x58
+	.byte	0xc
+	.long	0xbc
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x15
+	.byte	0x59
+	.byte	0xc
+	.long	0xbc
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1580
+	.byte	0x15
+	.byte	0x5a
+	.byte	0x3
+	.long	0x8dd
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x16
+	.byte	0x1c
+	.long	0x95b
+	.uleb128 0x2
+	.long	.LASF1584
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1585
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1586
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1587
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1588
+	.byte	0x16
+	.byte	0x21
+	.byte	0x3
+	.long	0x937
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x16
+	.byte	0x23
+	.long	0x97f
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1591
+	.byte	0x16
+	.byte	0x26
+	.byte	0x3
+	.long	0x967
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x16
+	.byte	0x28
+	.long	0x9a3
+	.uleb128 0x2
+	.long	.LASF1592
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1593
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1594
+	.byte	0x16
+	.byte	0x2b
+	.byte	0x3
+	.long	0x98b
+	.uleb128 0x5
+	.long	.LASF1595
+	.byte	0x20
+	.byte	0x16
+	.byte	0x2c
+	.long	0xa24
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x16
+	.byte	0x2d
+	.byte	0x19
+	.long	0x95b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x16
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x16
+	.byte	0x2f
+	.byte	0x17
+	.long	0x131
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x16
+	.byte	0x30
+	.byte	0x8
+	.long	0x2e
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x16
+	.byte	0x31
+	.byte	0xb
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x16
+	.byte	0x32
+	.byte	0x1b
+	.long	0x97f
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x16
+	.byte	0x33
+	.byte	0x11
+	.long	0x9a3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x16
+	.byte	0x34
+	.byte	0xe
+	.long	0xec
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1604
+	.byte	0x16
+	.byte	0x35
+	.byte	0x3
+	.long	0x9af
+	.uleb128 0x5
+	.long	.LASF1605
+	.byte	0x12
+	.byte	0x17
+	.byte	0x3d
+	.long	0xa8b
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xd
+	.long	0xa8b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x17
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x17
+	.byte	0x40
+	.byte	0xe
+	.long	0xec
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x17
+	.byte	0x41
+	.byte	0xe
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x17
+	.byte	0x42
+	.byte	0xe
+	.long	0xec
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x17
+	.byte	0x43
+	.byte	0xd
+	.long	0xe0
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	0xe0
+	.long	0xa9b
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1612
+	.byte	0x17
+	.byte	0x44
+	.byte	0x3
+	.long	0xa30
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x18
+	.byte	0x14
+	.long	0xb3d
+	.uleb128 0x2
+	.long	.LASF1613
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1614
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1615
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1623
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1625
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1630
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1631
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1632
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1634
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0x18
+	.byte	0x2d
+	.byte	0x3
+	.long	0xaa7
+	.uleb128 0x6
+	.long	.LASF1637
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x11
+	.long	0xf8
+	.uleb128 0x29
+	.long	.LASF1781
+	.byte	0x7
+	.byte	0x4
+	.long	0x43
+	.byte	0x18
+	.byte	0x34
+	.byte	0xe
+	.long	0xbb0
+	.uleb128 0x2
+	.long	.LASF1638
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1639
+	.byte	0x1
+	.uleb128 0x2a
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1640
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1643
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1644
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1645
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1646
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1647
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1648
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1649
+	.byte	0x8
+	.byte	0x18
+	.byte	0x65
+	.long	0xbf1
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x18
+	.byte	0x66
+	.byte	0xd
+	.long	0xb3d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x18
+	.byte	0x67
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x18
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x18
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1654
+	.byte	0x18
+	.byte	0x6f
+	.byte	0x3
+	.long	0xbb0
+	.uleb128 0x5
+	.long	.LASF1655
+	.byte	0x6
+	.byte	0x18
+	.byte	0x73
+	.long	0xc58
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x18
+	.byte	0x74
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x18
+	.byte	0x75
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x18
+	.byte	0x76
+	.byte	0xd
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x18
+	.byte	0x77
+	.byte	0xd
+	.long	0xe0
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x18
+	.byte	0x78
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x18
+	.byte	0x79
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x18
+	.byte	0x7a
+	.byte	0x3
+	.long	0xbfd
+	.uleb128 0xb
+	.long	0xc8
+	.long	0xc74
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1663
+	.byte	0x18
+	.byte	0x7c
+	.byte	0x10
+	.long	0xc64
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x19
+	.byte	0x21
+	.long	0xcca
+	.uleb128 0x2
+	.long	.LASF1664
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1665
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1666
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1667
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1670
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1671
+	.byte	0x80
+	.uleb128 0x1c
+	.long	.LASF1672
+	.value	0x100
+	.uleb128 0x1c
+	.long	.LASF1673
+	.value	0x200
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1674
+	.byte	0x19
+	.byte	0x2e
+	.byte	0x11
+	.long	0xec
+	.uleb128 0x9
+	.long	0x43
+	.byte	0x19
+	.byte	0x34
+	.long	0xd00
+	.uleb128 0x2
+	.long	.LASF1675
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1676
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1678
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1679
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1680
+	.byte	0x19
+	.byte	0x40
+	.byte	0x10
+	.long	0xe0
+	.uleb128 0x1d
+	.long	.LASF1681
+	.value	0x218
+	.byte	0x1a
+	.byte	0x14
+	.long	0xe4f
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x1a
+	.byte	0x15
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x1a
+	.byte	0x17
+	.byte	0x12
+	.long	0x273
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x19
+	.long	0xc58
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0xe
+	.long	0xec
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc8
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x19
+	.long	0x358
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x1a
+	.byte	0x24
+	.byte	0xd
+	.long	0xe0
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xb
+	.long	0x2e
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x13
+	.long	0x4be
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x17
+	.long	0x50b
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x1f
+	.long	0xe4f
+	.byte	0x84
+	.uleb128 0x4
+	.long	.LASF1695
+	.byte	0x1a
+	.byte	0x30
+	.byte	0xd
+	.long	0xe0
+	.value	0x1c4
+	.uleb128 0x4
+	.long	.LASF1696
+	.byte	0x1a
+	.byte	0x31
+	.byte	0xd
+	.long	0xe0
+	.value	0x1c5
+	.uleb128 0x4
+	.long	.LASF1697
+	.byte	0x1a
+	.byte	0x32
+	.byte	0xd
+	.long	0xe0
+	.value	0x1c6
+	.uleb128 0x4
+	.long	.LASF1698
+	.byte	0x1a
+	.byte	0x33
+	.byte	0xd
+	.long	0xe0
+	.value	0x1c7
+	.uleb128 0x4
+	.long	.LASF1699
+	.byte	0x1a
+	.byte	0x35
+	.byte	0xe
+	.long	0xec
+	.value	0x1c8
+	.uleb128 0x4
+	.long	.LASF1700
+	.byte	0x1a
+	.byte	0x36
+	.byte	0xd
+	.long	0xe0
+	.value	0x1ca
+	.uleb128 0x4
+	.long	.LASF1701
+	.byte	0x1a
+	.byte	0x39
+	.byte	0x12
+	.long	0xe5f
+	.value	0x1cc
+	.uleb128 0x4
+	.long	.LASF1702
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0x16
+	.long	0x78a
+	.value	0x20c
+	.uleb128 0x4
+	.long	.LASF1703
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0x13
+	.long	0x85e
+	.value	0x214
+	.uleb128 0x4
+	.long	.LASF1704
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x14
+	.long	0x67d
+	.value	0x216
+	.byte	0
+	.uleb128 0xb
+	.long	0xbf1
+	.long	0xe5f
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x27
+	.byte	0
+	.uleb128 0xb
+	.long	0x92b
+	.long	0xe6f
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1705
+	.byte	0x1a
+	.byte	0x47
+	.byte	0x3
+	.long	0xd0c
+	.uleb128 0x1d
+	.long	.LASF1706
+	.value	0x7cc
+	.byte	0x1b
+	.byte	0x15
+	.long	0x1097
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x1b
+	.byte	0x16
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x1b
+	.byte	0x17
+	.byte	0xe
+	.long	0xf8
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x1b
+	.byte	0x18
+	.byte	0xe
+	.long	0xec
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x1b
+	.byte	0x19
+	.byte	0xd
+	.long	0xe0
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0xd
+	.long	0xe0
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0xd
+	.long	0xe0
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x12
+	.long	0x1097
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x1b
+	.byte	0x21
+	.byte	0x19
+	.long	0x657
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x1b
+	.byte	0x22
+	.byte	0x16
+	.long	0x8ab
+	.byte	0xd6
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x1b
+	.byte	0x24
+	.byte	0xe
+	.long	0xec
+	.byte	0xde
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x1b
+	.byte	0x25
+	.byte	0xe
+	.long	0xec
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x1b
+	.byte	0x29
+	.byte	0x1d
+	.long	0x48e
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x1b
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5be
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x1b
+	.byte	0x2c
+	.byte	0xc
+	.long	0xbc
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x1b
+	.byte	0x2d
+	.byte	0xd
+	.long	0xe0
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x1b
+	.byte	0x2e
+	.byte	0xe
+	.long	0xec
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x1b
+	.byte	0x2f
+	.byte	0xe
+	.long	0xec
+	.byte	0xfa
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x1b
+	.byte	0x30
+	.byte	0xe
+	.long	0xec
+	.byte	0xfc
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x1b
+	.byte	0x31
+	.byte	0xd
+	.long	0xe0
+	.byte	0xfe
+	.uleb128 0x4
+	.long	.LASF1727
+	.byte	0x1b
+	.byte	0x32
+	.byte	0xe
+	.long	0xec
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1728
+	.byte	0x1b
+	.byte	0x33
+	.byte	0xe
+	.long	0xec
+	.value	0x102
+	.uleb128 0x4
+	.long	.LASF1729
+	.byte	0x1b
+	.byte	0x35
+	.byte	0x12
+	.long	0x60b
+	.value	0x104
+	.uleb128 0x4
+	.long	.LASF1730
+	.byte	0x1b
+	.byte	0x37
+	.byte	0xe
+	.long	0xec
+	.value	0x10c
+	.uleb128 0x4
+	.long	.LASF1731
+	.byte	0x1b
+	.byte	0x38
+	.byte	0x1b
+	.long	0x2ec
+	.value	0x10e
+	.uleb128 0x4
+	.long	.LASF1732
+	.byte	0x1b
+	.byte	0x39
+	.byte	0x1b
+	.long	0x2ec
+	.value	0x114
+	.uleb128 0x4
+	.long	.LASF1733
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0x15
+	.long	0x57e
+	.value	0x11a
+	.uleb128 0x4
+	.long	.LASF1734
+	.byte	0x1b
+	.byte	0x3d
+	.byte	0x10
+	.long	0xa9b
+	.value	0x124
+	.uleb128 0x4
+	.long	.LASF1735
+	.byte	0x1b
+	.byte	0x3e
+	.byte	0x1a
+	.long	0x15c
+	.value	0x138
+	.uleb128 0x4
+	.long	.LASF1736
+	.byte	0x1b
+	.byte	0x40
+	.byte	0xd
+	.long	0xe0
+	.value	0x13c
+	.uleb128 0x4
+	.long	.LASF1737
+	.byte	0x1b
+	.byte	0x41
+	.byte	0xd
+	.long	0xe0
+	.value	0x13d
+	.uleb128 0x4
+	.long	.LASF1738
+	.byte	0x1b
+	.byte	0x42
+	.byte	0xd
+	.long	0xe0
+	.value	0x13e
+	.uleb128 0x4
+	.long	.LASF1739
+	.byte	0x1b
+	.byte	0x44
+	.byte	0x16
+	.long	0x8d1
+	.value	0x13f
+	.uleb128 0x4
+	.long	.LASF1740
+	.byte	0x1b
+	.byte	0x45
+	.byte	0xc
+	.long	0xbc
+	.value	0x140
+	.uleb128 0x4
+	.long	.LASF1741
+	.byte	0x1b
+	.byte	0x4b
+	.byte	0x14
+	.long	0x730
+	.value	0x144
+	.uleb128 0x4
+	.long	.LASF1742
+	.byte	0x1b
+	.byte	0x4d
+	.byte	0x17
+	.long	0xa24
+	.value	0x15c
+	.uleb128 0x4
+	.long	.LASF1743
+	.byte	0x1b
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe0
+	.value	0x17c
+	.uleb128 0x4
+	.long	.LASF1744
+	.byte	0x1b
+	.byte	0x56
+	.byte	0xf
+	.long	0x10a7
+	.value	0x180
+	.uleb128 0x4
+	.long	.LASF1745
+	.byte	0x1b
+	.byte	0x57
+	.byte	0xd
+	.long	0xe0
+	.value	0x7c8
+	.byte	0
+	.uleb128 0xb
+	.long	0x82b
+	.long	0x10a7
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	0xe6f
+	.long	0x10b7
+	.uleb128 0xc
+	.long	0x4a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1706
+	.byte	0x1b
+	.byte	0x58
+	.byte	0x3
+	.long	0xe7b
+	.uleb128 0x6
+	.long	.LASF1746
+	.byte	0x1b
+	.byte	0x5a
+	.byte	0x11
+	.long	0x10b7
+	.uleb128 0x6
+	.long	.LASF1747
+	.byte	0x1b
+	.byte	0x5b
+	.byte	0x13
+	.long	0x10db
+	.uleb128 0x13
+	.long	0xe6f
+	.uleb128 0x1e
+	.long	.LASF1692
+	.byte	0x46
+	.byte	0x14
+	.long	0x10f5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	barometerConfig
+	.uleb128 0x13
+	.long	0x50b
+	.uleb128 0x1e
+	.long	.LASF1683
+	.byte	0x47
+	.byte	0xf
+	.long	0x110f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pidProfile
+	.uleb128 0x13
+	.long	0x273
+	.uleb128 0xe
+	.long	.LASF1755
+	.byte	0x51
+	.byte	0x10
+	.long	0xc8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	initialThrottleHold
+	.uleb128 0x2b
+	.long	.LASF1752
+	.byte	0x1c
+	.value	0x13d
+	.byte	0x11
+	.long	0xae
+	.long	0x1140
+	.uleb128 0x10
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1748
+	.byte	0x14
+	.byte	0x36
+	.uleb128 0x20
+	.long	.LASF1750
+	.byte	0x26
+	.byte	0x9
+	.long	0xd4
+	.uleb128 0x1f
+	.long	.LASF1749
+	.byte	0xb
+	.byte	0x27
+	.uleb128 0x20
+	.long	.LASF1751
+	.byte	0x22
+	.byte	0x5
+	.long	0x13d
+	.uleb128 0x21
+	.long	.LASF1753
+	.byte	0x2b
+	.byte	0x9
+	.long	0xd4
+	.long	0x117e
+	.uleb128 0x10
+	.long	0xd4
+	.uleb128 0x10
+	.long	0xd4
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1754
+	.byte	0x2d
+	.byte	0x5
+	.long	0x9b
+	.long	0x119d
+	.uleb128 0x10
+	.long	0x9b
+	.uleb128 0x10
+	.long	0x9b
+	.uleb128 0x10
+	.long	0x9b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1774
+	.byte	0xdd
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1393
+	.uleb128 0x2c
+	.long	.LASF1782
+	.byte	0x1
+	.byte	0xdd
+	.byte	0x2a
+	.long	0xf8
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xe
+	.long	.LASF1756
+	.byte	0xdf
+	.byte	0x15
+	.long	0xf8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	previousTime.5
+	.uleb128 0x11
+	.long	.LASF1757
+	.byte	0xe0
+	.byte	0xe
+	.long	0xf8
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x11
+	.long	.LASF1758
+	.byte	0xe1
+	.byte	0xd
+	.long	0xd4
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x2d
+	.string	"dt"
+	.byte	0x1
+	.byte	0xe2
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x11
+	.long	.LASF1759
+	.byte	0xe3
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x11
+	.long	.LASF1760
+	.byte	0xe4
+	.byte	0xd
+	.long	0xd4
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x11
+	.long	.LASF1761
+	.byte	0xe5
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xe
+	.long	.LASF1762
+	.byte	0xe6
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accZ_old.0
+	.uleb128 0x2e
+	.string	"vel"
+	.byte	0x1
+	.byte	0xe7
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vel.4
+	.uleb128 0xe
+	.long	.LASF1763
+	.byte	0xe8
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accAlt.3
+	.uleb128 0xe
+	.long	.LASF1764
+	.byte	0xe9
+	.byte	0x14
+	.long	0xd4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lastBaroAlt.1
+	.uleb128 0xe
+	.long	.LASF1765
+	.byte	0xeb
+	.byte	0x14
+	.long	0xd4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroAlt_offset.2
+	.uleb128 0x11
+	.long	.LASF1766
+	.byte	0xec
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xf
+	.quad	.LVL31
+	.long	0x1159
+	.uleb128 0xf
+	.quad	.LVL32
+	.long	0x1147
+	.uleb128 0xf
+	.quad	.LVL38
+	.long	0x1140
+	.uleb128 0xf
+	.quad	.LVL39
+	.long	0x1159
+	.uleb128 0xd
+	.quad	.LVL41
+	.long	0x117e
+	.long	0x1325
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xfa24
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x5dc
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL43
+	.long	0x1164
+	.long	0x133c
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL44
+	.long	0x1129
+	.uleb128 0xd
+	.quad	.LVL46
+	.long	0x1164
+	.long	0x1366
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL47
+	.long	0x1393
+	.long	0x1385
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL54
+	.long	0x1152
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1767
+	.byte	0xb9
+	.byte	0x9
+	.long	0xd4
+	.long	0x13e2
+	.uleb128 0x14
+	.long	.LASF1760
+	.byte	0xb9
+	.byte	0x34
+	.long	0xd4
+	.uleb128 0x14
+	.long	.LASF1761
+	.byte	0xb9
+	.byte	0x43
+	.long	0x2e
+	.uleb128 0x14
+	.long	.LASF1762
+	.byte	0xb9
+	.byte	0x53
+	.long	0x2e
+	.uleb128 0x19
+	.long	.LASF1768
+	.byte	0xbb
+	.long	0xd4
+	.uleb128 0x19
+	.long	.LASF1769
+	.byte	0xbc
+	.long	0xd4
+	.uleb128 0x19
+	.long	.LASF1770
+	.byte	0xbd
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF1783
+	.byte	0x1
+	.byte	0xb3
+	.byte	0x9
+	.long	0xc8
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1412
+	.uleb128 0x1a
+	.long	.LASF1479
+	.byte	0xb3
+	.byte	0x37
+	.long	0x1412
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x13
+	.long	0x3b4
+	.uleb128 0x22
+	.long	.LASF1771
+	.byte	0xae
+	.byte	0x5
+	.long	0x13d
+	.long	0x1432
+	.uleb128 0x14
+	.long	.LASF1479
+	.byte	0xae
+	.byte	0x38
+	.long	0x1412
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1772
+	.byte	0x9d
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x23
+	.long	.LASF1773
+	.byte	0x8c
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x18
+	.long	.LASF1775
+	.byte	0x83
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14c7
+	.uleb128 0x30
+	.long	0x14c7
+	.quad	.LBI12
+	.byte	.LVU10
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.byte	0x1
+	.byte	0x86
+	.byte	0x9
+	.uleb128 0x24
+	.long	0x14d0
+	.quad	.LBI14
+	.byte	.LVU14
+	.long	.LLRL0
+	.byte	0x88
+	.uleb128 0x25
+	.long	.LLRL0
+	.uleb128 0xf
+	.quad	.LVL1
+	.long	0x117e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1784
+	.byte	0x1
+	.byte	0x7a
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x32
+	.long	.LASF1785
+	.byte	0x1
+	.byte	0x59
+	.byte	0xd
+	.byte	0x1
+	.long	0x14f3
+	.uleb128 0xe
+	.long	.LASF1776
+	.byte	0x5b
+	.byte	0x14
+	.long	0xe0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	isAltHoldChanged.6
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1777
+	.byte	0x49
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x152a
+	.uleb128 0x1a
+	.long	.LASF1778
+	.byte	0x49
+	.byte	0x2a
+	.long	0x110f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1a
+	.long	.LASF1779
+	.byte	0x49
+	.byte	0x50
+	.long	0x10f5
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x33
+	.long	0x1417
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x154d
+	.uleb128 0x34
+	.long	0x1426
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x35
+	.long	0x1393
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x12
+	.long	0x13a2
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.long	0x13ad
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x12
+	.long	0x13b8
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x36
+	.long	0x13c3
+	.byte	0
+	.uleb128 0x26
+	.long	0x13cd
+	.uleb128 0x26
+	.long	0x13d7
+	.uleb128 0x37
+	.long	0x1417
+	.quad	.LBI26
+	.byte	.LVU132
+	.long	.LLRL4
+	.byte	0x1
+	.byte	0xbf
+	.byte	0xa
+	.long	0x15ba
+	.uleb128 0x38
+	.long	0x1426
+	.byte	0
+	.uleb128 0x24
+	.long	0x1393
+	.quad	.LBI36
+	.byte	.LVU147
+	.long	.LLRL5
+	.byte	0xb9
+	.uleb128 0x12
+	.long	0x13b8
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x12
+	.long	0x13ad
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x12
+	.long	0x13a2
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x25
+	.long	.LLRL9
+	.uleb128 0x1b
+	.long	0x13c3
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1b
+	.long	0x13cd
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1b
+	.long	0x13d7
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xd
+	.quad	.LVL8
+	.long	0x117e
+	.long	0x1640
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xfed4
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12c
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL11
+	.long	0x117e
+	.long	0x1661
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x49
+	.byte	0x40
+	.byte	0x24
+	.byte	0x1f
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0x49
+	.byte	0x40
+	.byte	0x24
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL14
+	.long	0x117e
+	.long	0x1680
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xff6a
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x96
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL18
+	.long	0x117e
+	.long	0x16a0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xfe0c
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1f4
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL20
+	.long	0x1164
+	.long	0x16b7
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL24
+	.long	0x117e
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xfed4
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x12c
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.LVL26
+	.uleb128 .LVL31-1-.LVL26
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-1-.LVL26
+	.uleb128 .LFE20-.LVL26
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU219
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU316
+	.uleb128 .LVU328
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL29-.LVL27
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.LVL27
+	.uleb128 .LVL45-.LVL27
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL49-.LVL27
+	.uleb128 .LFE20-.LVL27
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU294
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU314
+.LLST15:
+	.byte	0x6
+	.quad	.LVL40
+	.byte	0x4
+	.uleb128 .LVL40-.LVL40
+	.uleb128 .LVL41-1-.LVL40
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.LVL40
+	.uleb128 .LVL43-1-.LVL40
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.LVL40
+	.uleb128 .LVL44-1-.LVL40
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU251
+	.uleb128 .LVU262
+.LLST16:
+	.byte	0x8
+	.quad	.LVL33
+	.uleb128 .LVL37-.LVL33
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU257
+	.uleb128 .LVU273
+.LLST17:
+	.byte	0x8
+	.quad	.LVL36
+	.uleb128 .LVL38-1-.LVL36
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU316
+	.uleb128 .LVU318
+.LLST18:
+	.byte	0x8
+	.quad	.LVL45
+	.uleb128 .LVL46-1-.LVL45
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU254
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 .LVU327
+	.uleb128 .LVU327
+	.uleb128 .LVU328
+	.uleb128 .LVU348
+	.uleb128 .LVU350
+.LLST19:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL35-.LVL34
+	.uleb128 .LVL48-.LVL34
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL34
+	.uleb128 .LVL49-.LVL34
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accZ_old.0
+	.byte	0x4
+	.uleb128 .LVL52-.LVL34
+	.uleb128 .LVL53-.LVL34
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU342
+	.uleb128 .LVU346
+.LLST20:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LVL51-.LVL50
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 .LVL9-.LVL4
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.LVL4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 .LVL17-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.LVL4
+	.uleb128 .LFE19-.LVL4
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 .LVL18-1-.LVL4
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL18-1-.LVL4
+	.uleb128 .LFE19-.LVL4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL6-.LVL4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0x4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 .LVL18-1-.LVL4
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL18-1-.LVL4
+	.uleb128 .LFE19-.LVL4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU184
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL15-.LVL5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0x4
+	.uleb128 .LVL16-.LVL5
+	.uleb128 .LVL18-1-.LVL5
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL18-1-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU184
+	.uleb128 .LVU186
+	.uleb128 .LVU189
+	.uleb128 .LVU189
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL15-.LVL5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL16-.LVL5
+	.uleb128 .LVL18-1-.LVL5
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL18-1-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU184
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL9-.LVL5
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.LVL5
+	.uleb128 .LVL15-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL5
+	.uleb128 .LVL17-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU160
+	.uleb128 .LVU162
+	.uleb128 .LVU162
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+.LLST10:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL10-.LVL9
+	.uleb128 .LVL15-.LVL9
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.LVL9
+	.uleb128 .LVL15-.LVL9
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU153
+	.uleb128 .LVU170
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+	.uleb128 .LVU195
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU200
+.LLST11:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL12-.LVL7
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL19-.LVL7
+	.uleb128 .LVL20-1-.LVL7
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL21-.LVL7
+	.uleb128 .LVL22-.LVL7
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.LVL7
+	.uleb128 .LVL23-.LVL7
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU150
+	.uleb128 .LVU153
+	.uleb128 .LVU201
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL7-.LVL6
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.LVL6
+	.uleb128 .LFE19-.LVL6
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x9c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x5
+	.quad	.LBB14
+	.byte	0x4
+	.uleb128 .LBB14-.LBB14
+	.uleb128 .LBE14-.LBB14
+	.byte	0x4
+	.uleb128 .LBB18-.LBB14
+	.uleb128 .LBE18-.LBB14
+	.byte	0x4
+	.uleb128 .LBB19-.LBB14
+	.uleb128 .LBE19-.LBB14
+	.byte	0
+.LLRL4:
+	.byte	0x5
+	.quad	.LBB26
+	.byte	0x4
+	.uleb128 .LBB26-.LBB26
+	.uleb128 .LBE26-.LBB26
+	.byte	0x4
+	.uleb128 .LBB32-.LBB26
+	.uleb128 .LBE32-.LBB26
+	.byte	0x4
+	.uleb128 .LBB33-.LBB26
+	.uleb128 .LBE33-.LBB26
+	.byte	0x4
+	.uleb128 .LBB34-.LBB26
+	.uleb128 .LBE34-.LBB26
+	.byte	0x4
+	.uleb128 .LBB35-.LBB26
+	.uleb128 .LBE35-.LBB26
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB36
+	.byte	0x4
+	.uleb128 .LBB36-.LBB36
+	.uleb128 .LBE36-.LBB36
+	.byte	0x4
+	.uleb128 .LBB40-.LBB36
+	.uleb128 .LBE40-.LBB36
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB37
+	.byte	0x4
+	.uleb128 .LBB37-.LBB37
+	.uleb128 .LBE37-.LBB37
+	.byte	0x4
+	.uleb128 .LBB38-.LBB37
+	.uleb128 .LBE38-.LBB37
+	.byte	0x4
+	.uleb128 .LBB39-.LBB37
+	.uleb128 .LBE39-.LBB37
+	.byte	0
+.LLRL21:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 30 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.file 33 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 35 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 36 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 39 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 46 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 47 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 52 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 57 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 74 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x4b
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4e
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1179
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 84 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x54
+	.file 85 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 86 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.file 87 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1314
+	.byte	0x4
+	.file 88 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.file 89 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1315
+	.byte	0x4
+	.byte	0x4
+	.file 90 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 91 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1320
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1333
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x11
+	.byte	0x4
+	.file 92 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 93 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1361
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 94 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1365
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 95 ".//src/main/config/config.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1414
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1178
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1181
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1183
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1208
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1211
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1223
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1233
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1272
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.df293132ceab5572a941cf7402f7191e,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1284
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1294
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1313
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1319
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1325
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1329
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.99147b604c3c17d87d371a4dbbfdb583,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1332
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1336
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1343
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1346
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1360
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1364
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1381
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1403
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1528:
+	.string	"escAndServoConfig_s"
+.LASF1532:
+	.string	"escAndServoConfig_t"
+.LASF1356:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1399:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1324:
+	.string	"HSV_VALUE_MAX 255"
+.LASF935:
+	.string	"__DECL_SIMD_logf "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1140:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1168:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1345:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF1320:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF1447:
+	.string	"RGB_GREEN"
+.LASF1450:
+	.string	"PIDPITCH"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1362:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1044:
+	.string	"__DECL_SIMD_sinh "
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1283:
+	.string	"acos_approx(x) acosf(x)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1550:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF972:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1360:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1549:
+	.string	"gps_passthrough_baudrate"
+.LASF1350:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF1244:
+	.string	"FP_NORMAL 4"
+.LASF1108:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1088:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF945:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1358:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF1048:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1164:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1530:
+	.string	"maxthrottle"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1422:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1562:
+	.string	"altHoldThrottleAdjustment"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1442:
+	.string	"_Bool"
+.LASF903:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1470:
+	.string	"flightDynamicsTrims_t"
+.LASF1294:
+	.string	"U_ID_2 0"
+.LASF1460:
+	.string	"A_level"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1184:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1040:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1716:
+	.string	"flight3DConfig"
+.LASF1449:
+	.string	"PIDROLL"
+.LASF1402:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1555:
+	.string	"failsafe_throttle"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1566:
+	.string	"motorMixer_t"
+.LASF1439:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1490:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1737:
+	.string	"disarm_kill_switch"
+.LASF1357:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF1492:
+	.string	"CW270_DEG_FLIP"
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF949:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1637:
+	.string	"rcModeActivationMask"
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF1576:
+	.string	"deadband3d_throttle"
+.LASF1519:
+	.string	"yawDegrees"
+.LASF1115:
+	.string	"__DECL_SIMD_acoshf "
+.LASF920:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1456:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1046:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1248:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF933:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1448:
+	.string	"RGB_BLUE"
+.LASF1434:
+	.string	"uint16_t"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1581:
+	.string	"middle"
+.LASF1688:
+	.string	"accelerometerTrims"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1738:
+	.string	"small_angle"
+.LASF1444:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1066:
+	.string	"__DECL_SIMD_atan2l "
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1247:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF902:
+	.string	"_MATH_H 1"
+.LASF1225:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF916:
+	.string	"__DECL_SIMD_sinl "
+.LASF1274:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1586:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1169:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1669:
+	.string	"GPS_HOLD_MODE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1155:
+	.string	"__DECL_SIMD_erfcf "
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1677:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1662:
+	.string	"controlRateConfig_t"
+.LASF937:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1729:
+	.string	"gyroConfig"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1756:
+	.string	"previousTime"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1634:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1739:
+	.string	"airplaneConfig"
+.LASF1341:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1458:
+	.string	"PIDVEL"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1521:
+	.string	"gyroConfig_s"
+.LASF993:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1782:
+	.string	"currentTime"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF936:
+	.string	"__DECL_SIMD_logl "
+.LASF1276:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1591:
+	.string	"frskyGpsCoordFormat_e"
+.LASF1481:
+	.string	"EstAlt"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1331:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1747:
+	.string	"currentProfile"
+.LASF944:
+	.string	"__DECL_SIMD_exp "
+.LASF1544:
+	.string	"serialConfig_s"
+.LASF1551:
+	.string	"serialConfig_t"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1036:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF1432:
+	.string	"int32_t"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1368:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1313:
+	.string	"FAST_MATH "
+.LASF1304:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1128:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF946:
+	.string	"__DECL_SIMD_expl "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1712:
+	.string	"pid_process_denom"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1306:
+	.string	"USE_USART1 "
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1785:
+	.string	"applyMultirotorAltHold"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1310:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1565:
+	.string	"accVelScale"
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1256:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1378:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1469:
+	.string	"values"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1281:
+	.string	"cos_approx(x) cosf(x)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1755:
+	.string	"initialThrottleHold"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1200:
+	.string	"__MATH_PRECNAME"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1230:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1352:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1210:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1232:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1203:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1438:
+	.string	"double"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1187:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1717:
+	.string	"motor_pwm_rate"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_acoshl "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1221:
+	.string	"__MATHDECL_1"
+.LASF1405:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1004:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1457:
+	.string	"PIDMAG"
+.LASF1612:
+	.string	"rxConfig_t"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1307:
+	.string	"USE_USART2 "
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1125:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF1567:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1540:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1615:
+	.string	"BOXHORIZON"
+.LASF1068:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1340:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1713:
+	.string	"emf_avoidance"
+.LASF1097:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1489:
+	.string	"CW0_DEG_FLIP"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1611:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1462:
+	.string	"dterm_lpf_hz"
+.LASF1554:
+	.string	"failsafe_off_delay"
+.LASF1661:
+	.string	"yawRate"
+.LASF1195:
+	.string	"_Mdouble_ double"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1736:
+	.string	"retarded_arm"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1452:
+	.string	"PIDALT"
+.LASF1133:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1628:
+	.string	"BOXLLIGHTS"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1245:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1616:
+	.string	"BOXBARO"
+.LASF1689:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1575:
+	.string	"neutral3d"
+.LASF1302:
+	.string	"ACC "
+.LASF1631:
+	.string	"BOXOSD"
+.LASF1454:
+	.string	"PIDPOSR"
+.LASF1297:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1546:
+	.string	"msp_baudrate"
+.LASF1741:
+	.string	"serialConfig"
+.LASF1105:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1762:
+	.string	"accZ_old"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF963:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF899:
+	.string	"alloca"
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1485:
+	.string	"CW0_DEG"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF1466:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1608:
+	.string	"midrc"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1332:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1468:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1423:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1425:
+	.string	"__uint16_t"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1395:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF392:
+	.string	"false 0"
+.LASF1030:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1305:
+	.string	"USE_BARO_SITL "
+.LASF997:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1543:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF1748:
+	.string	"accSum_reset"
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF938:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1723:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1599:
+	.string	"gpsNoFixLatitude"
+.LASF1258:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF969:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1031:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1765:
+	.string	"baroAlt_offset"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF960:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1687:
+	.string	"mag_declination"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF1220:
+	.string	"__MATHDECL_1_IMPL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1265:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1234:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1665:
+	.string	"HORIZON_MODE"
+.LASF1416:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1707:
+	.string	"mixerConfiguration"
+.LASF961:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1092:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1178:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1289:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1692:
+	.string	"barometerConfig"
+.LASF1731:
+	.string	"accZero"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF1400:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1382:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1427:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1390:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1415:
+	.string	"float"
+.LASF1721:
+	.string	"yaw_control_direction"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1510:
+	.string	"vbatmaxcellvoltage"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1613:
+	.string	"BOXARM"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF1223:
+	.string	"__MATHDECL"
+.LASF1300:
+	.string	"GYRO "
+.LASF1609:
+	.string	"mincheck"
+.LASF1126:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1682:
+	.string	"pidController"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1329:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1288:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF987:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1629:
+	.string	"BOXCALIB"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1343:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1536:
+	.string	"FUNCTION_NONE"
+.LASF1262:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1580:
+	.string	"servoParam_t"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1484:
+	.string	"ALIGN_DEFAULT"
+.LASF1327:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1625:
+	.string	"BOXBEEPERON"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF508:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1641:
+	.string	"AUX1"
+.LASF1642:
+	.string	"AUX2"
+.LASF977:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1644:
+	.string	"AUX4"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1646:
+	.string	"AUX6"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1648:
+	.string	"AUX8"
+.LASF1610:
+	.string	"maxcheck"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF1653:
+	.string	"rangeEndStep"
+.LASF1638:
+	.string	"ROLL"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1715:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1374:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1443:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF999:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1751:
+	.string	"isBaroCalibrationComplete"
+.LASF1398:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1534:
+	.string	"gimbal_flags"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1696:
+	.string	"yaw_deadband"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1617:
+	.string	"BOXMAG"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1025:
+	.string	"__DECL_SIMD_coshf "
+.LASF1034:
+	.string	"__DECL_SIMD_expm1 "
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1106:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF376:
+	.string	"unix 1"
+.LASF1372:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1098:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1684:
+	.string	"controlRateConfig"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1157:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1325:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1197:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1686:
+	.string	"tpa_breakpoint"
+.LASF1057:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1295:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF1477:
+	.string	"rollAndPitchInclination_t_def"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1095:
+	.string	"__DECL_SIMD_log1pf "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF913:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1076:
+	.string	"__DECL_SIMD_log10l "
+.LASF1593:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1595:
+	.string	"telemetryConfig_s"
+.LASF1604:
+	.string	"telemetryConfig_t"
+.LASF1413:
+	.string	"BARO_UPDATE_FREQUENCY_40HZ (1000 * 25)"
+.LASF953:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1385:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1451:
+	.string	"PIDYAW"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF904:
+	.string	"__DECL_SIMD_cos "
+.LASF1188:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1251:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1379:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF985:
+	.string	"__DECL_SIMD_asinf "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1745:
+	.string	"current_profile_index"
+.LASF1351:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1605:
+	.string	"rxConfig_s"
+.LASF1667:
+	.string	"BARO_MODE"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1227:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1198:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1211:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF952:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF905:
+	.string	"__DECL_SIMD_cosf "
+.LASF1371:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1301:
+	.string	"USE_GYRO_SITL "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1673:
+	.string	"SONAR_MODE"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1264:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1769:
+	.string	"error"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1666:
+	.string	"MAG_MODE"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1433:
+	.string	"uint8_t"
+.LASF1186:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1592:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1346:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF1746:
+	.string	"masterConfig"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1522:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1643:
+	.string	"AUX3"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF970:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1719:
+	.string	"sensorAlignmentConfig"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF957:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1124:
+	.string	"__DECL_SIMD_erf "
+.LASF1639:
+	.string	"PITCH"
+.LASF1375:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1632:
+	.string	"BOXTELEMETRY"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1321:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF971:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1403:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1636:
+	.string	"boxId_e"
+.LASF1299:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF693:
+	.string	"__need_size_t "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1024:
+	.string	"__DECL_SIMD_cosh "
+.LASF1233:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF914:
+	.string	"__DECL_SIMD_sin "
+.LASF1538:
+	.string	"FUNCTION_CLI"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF927:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1771:
+	.string	"isThrustFacingDownwards"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1507:
+	.string	"BaroAlt"
+.LASF1370:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1392:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1732:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1777:
+	.string	"configureAltitudeHold"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1377:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF988:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1766:
+	.string	"sonarTransition"
+.LASF1784:
+	.string	"applyFixedWingAltHold"
+.LASF1026:
+	.string	"__DECL_SIMD_coshl "
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1215:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1319:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1412:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1007:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF942:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1338:
+	.string	"LON 1"
+.LASF1366:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1381:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1204:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1296:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1780:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1658:
+	.string	"thrMid8"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1583:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1353:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF1590:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1148:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1354:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1037:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1652:
+	.string	"rangeStartStep"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1207:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF1117:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1524:
+	.string	"soft_gyro_notch_hz"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1693:
+	.string	"acc_unarmedcal"
+.LASF1774:
+	.string	"calculateEstimatedAltitude"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1158:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1649:
+	.string	"modeActivationCondition_s"
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1702:
+	.string	"failsafeConfig"
+.LASF1165:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF1309:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1570:
+	.string	"tri_unarmed_servo"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1494:
+	.string	"sensorAlignmentConfig_s"
+.LASF1498:
+	.string	"sensorAlignmentConfig_t"
+.LASF1388:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1710:
+	.string	"gyro_sync"
+.LASF906:
+	.string	"__DECL_SIMD_cosl "
+.LASF1465:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1775:
+	.string	"applyAltHold"
+.LASF1189:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF733:
+	.string	"NULL"
+.LASF1675:
+	.string	"GPS_FIX_HOME"
+.LASF1315:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF1396:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF1467:
+	.string	"pitch"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1236:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF462:
+	.string	"__PMT"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1743:
+	.string	"blackbox_rate_denom"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1282:
+	.string	"atan2_approx(y,x) atan2f(y, x)"
+.LASF1597:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1464:
+	.string	"pidProfile_s"
+.LASF1463:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1132:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1759:
+	.string	"vel_acc"
+.LASF1257:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1537:
+	.string	"FUNCTION_MSP"
+.LASF1497:
+	.string	"mag_align"
+.LASF1085:
+	.string	"__DECL_SIMD_log2f "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1190:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1218:
+	.string	"_Mdouble_ _Float64x"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1134:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1760:
+	.string	"vel_tmp"
+.LASF934:
+	.string	"__DECL_SIMD_log "
+.LASF1243:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1182:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF808:
+	.string	"__off_t_defined "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1167:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF975:
+	.string	"__DECL_SIMD_atanf "
+.LASF1517:
+	.string	"rollDegrees"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1552:
+	.string	"failsafeConfig_s"
+.LASF1558:
+	.string	"failsafeConfig_t"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1074:
+	.string	"__DECL_SIMD_log10 "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF983:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF982:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF472:
+	.string	"__P(args) args"
+.LASF1397:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1499:
+	.string	"accDeadband_s"
+.LASF1500:
+	.string	"accDeadband_t"
+.LASF1569:
+	.string	"yaw_direction"
+.LASF1214:
+	.string	"_Mdouble_ _Float128"
+.LASF1704:
+	.string	"gimbalConfig"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1339:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1772:
+	.string	"updateSonarAltHoldState"
+.LASF1768:
+	.string	"result"
+.LASF1585:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF1318:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1100:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1286:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1430:
+	.string	"int8_t"
+.LASF1334:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF1561:
+	.string	"setVelocity"
+.LASF1783:
+	.string	"calculateTiltAngle"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1277:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1096:
+	.string	"__DECL_SIMD_log1pl "
+.LASF978:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1676:
+	.string	"GPS_FIX"
+.LASF928:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF735:
+	.string	"__need_NULL"
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1663:
+	.string	"rcCommand"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1513:
+	.string	"currentMeterOffset"
+.LASF1314:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1045:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1179:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF990:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF958:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1359:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF1089:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF974:
+	.string	"__DECL_SIMD_atan "
+.LASF1280:
+	.string	"sin_approx(x) sinf(x)"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1779:
+	.string	"intialBarometerConfig"
+.LASF1222:
+	.string	"__MATHDECL_ALIAS"
+.LASF1742:
+	.string	"telemetryConfig"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1461:
+	.string	"H_level"
+.LASF1699:
+	.string	"throttle_correction_angle"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1670:
+	.string	"HEADFREE_MODE"
+.LASF991:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1322:
+	.string	"HSV_HUE_MAX 359"
+.LASF1495:
+	.string	"gyro_align"
+.LASF1268:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1094:
+	.string	"__DECL_SIMD_log1p "
+.LASF1503:
+	.string	"baro_noise_lpf"
+.LASF1166:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1252:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1431:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1417:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1476:
+	.string	"pitchDeciDegrees"
+.LASF1420:
+	.string	"signed char"
+.LASF1556:
+	.string	"failsafe_min_usec"
+.LASF939:
+	.string	"__DECL_SIMD_logf64 "
+.LASF922:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1038:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1654:
+	.string	"modeActivationCondition_t"
+.LASF696:
+	.string	"__size_t__ "
+.LASF1474:
+	.string	"rollAndPitchInclination_s"
+.LASF1478:
+	.string	"rollAndPitchInclination_t"
+.LASF1238:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1409:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1568:
+	.string	"mixerConfig_s"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1482:
+	.string	"AltHold"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1440:
+	.string	"SERIAL_INVERTED"
+.LASF1118:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1273:
+	.string	"sq(x) ((x)*(x))"
+.LASF918:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1090:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1226:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1516:
+	.string	"boardAlignment_s"
+.LASF1520:
+	.string	"boardAlignment_t"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1479:
+	.string	"inclination"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1269:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1620:
+	.string	"BOXCAMSTAB"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1547:
+	.string	"cli_baudrate"
+.LASF1086:
+	.string	"__DECL_SIMD_log2l "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1389:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1557:
+	.string	"failsafe_max_usec"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1261:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1539:
+	.string	"FUNCTION_TELEMETRY"
+.LASF1475:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1607:
+	.string	"serialrx_provider"
+.LASF1588:
+	.string	"telemetryProvider_e"
+.LASF1208:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF1691:
+	.string	"accDeadband"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1311:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1525:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF1253:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF930:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1531:
+	.string	"mincommand"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1618:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1260:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1410:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1177:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF931:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1509:
+	.string	"vbatscale"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1242:
+	.string	"FP_ZERO 2"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1502:
+	.string	"baro_sample_count"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1093:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1347:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF947:
+	.string	"__DECL_SIMD_expf16 "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1386:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1650:
+	.string	"modeId"
+.LASF1333:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1578:
+	.string	"airplaneConfig_t"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1504:
+	.string	"baro_cf_vel"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1680:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1428:
+	.string	"long int"
+.LASF1394:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1488:
+	.string	"CW270_DEG"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1050:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1753:
+	.string	"applyDeadband"
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1708:
+	.string	"enabledFeatures"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1584:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1601:
+	.string	"frsky_coordinate_format"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1496:
+	.string	"acc_align"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1209:
+	.string	"_Mdouble_ _Float32"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1752:
+	.string	"lrintf"
+.LASF1355:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1553:
+	.string	"failsafe_delay"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1480:
+	.string	"accSum"
+.LASF1508:
+	.string	"batteryConfig_s"
+.LASF1515:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1054:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1559:
+	.string	"errorVelocityI"
+.LASF1722:
+	.string	"acc_hardware"
+.LASF1303:
+	.string	"USE_ACC_SITL "
+.LASF1196:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1563:
+	.string	"accTimeSum"
+.LASF1435:
+	.string	"uint32_t"
+.LASF1598:
+	.string	"frsky_inversion"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1564:
+	.string	"accSumCount"
+.LASF986:
+	.string	"__DECL_SIMD_asinl "
+.LASF1764:
+	.string	"lastBaroAlt"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1263:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1084:
+	.string	"__DECL_SIMD_log2 "
+.LASF1091:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1778:
+	.string	"initialPidProfile"
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1623:
+	.string	"BOXGPSHOLD"
+.LASF1285:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1720:
+	.string	"boardAlignment"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1603:
+	.string	"batterySize"
+.LASF1445:
+	.string	"inputFilteringMode_e"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF485:
+	.string	"__flexarr []"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF954:
+	.string	"__DECL_SIMD_pow "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1312:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1259:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1619:
+	.string	"BOXHEADADJ"
+.LASF1757:
+	.string	"dTime"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1706:
+	.string	"master_t"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1724:
+	.string	"gyro_cmpf_factor"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF923:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1526:
+	.string	"gyroConfig_t"
+.LASF1317:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF1075:
+	.string	"__DECL_SIMD_log10f "
+.LASF1622:
+	.string	"BOXGPSHOME"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF1241:
+	.string	"FP_INFINITE 1"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1749:
+	.string	"performBaroCalibrationCycle"
+.LASF1414:
+	.string	"DEGREES_80_IN_DECIDEGREES 800"
+.LASF1199:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1776:
+	.string	"isAltHoldChanged"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1337:
+	.string	"LAT 0"
+.LASF1718:
+	.string	"servo_pwm_rate"
+.LASF1429:
+	.string	"char"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1453:
+	.string	"PIDPOS"
+.LASF1080:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1657:
+	.string	"rcExpo8"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1365:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF910:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1077:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF994:
+	.string	"__DECL_SIMD_hypot "
+.LASF1181:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1404:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1626:
+	.string	"BOXLEDMAX"
+.LASF1523:
+	.string	"soft_gyro_lpf_hz"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1505:
+	.string	"baro_cf_alt"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF909:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1081:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF973:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF391:
+	.string	"true 1"
+.LASF911:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1401:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF965:
+	.string	"__DECL_SIMD_acosf "
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1380:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1600:
+	.string	"gpsNoFixLongitude"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1761:
+	.string	"accZ_tmp"
+.LASF951:
+	.string	"__DECL_SIMD_expf32x "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF713:
+	.string	"__size_t "
+.LASF695:
+	.string	"__need_NULL "
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1363:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1326:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1579:
+	.string	"flaps_speed"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1160:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF989:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1491:
+	.string	"CW180_DEG_FLIP"
+.LASF1284:
+	.string	"invSqrt_approx(x) (1.0f / sqrtf(x))"
+.LASF1703:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1145:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1740:
+	.string	"fixedwing_althold_dir"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1668:
+	.string	"GPS_HOME_MODE"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1213:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1596:
+	.string	"telemetry_provider"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1408:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1560:
+	.string	"velocityControl"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF1212:
+	.string	"_Mdouble_ _Float64"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1015:
+	.string	"__DECL_SIMD_exp10f "
+.LASF948:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1614:
+	.string	"BOXANGLE"
+.LASF1664:
+	.string	"ANGLE_MODE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1250:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1407:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1070:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF979:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1287:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1114:
+	.string	"__DECL_SIMD_acosh "
+.LASF1330:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1472:
+	.string	"rollAndPitchTrims_t_def"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1514:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF1391:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1501:
+	.string	"barometerConfig_s"
+.LASF1506:
+	.string	"barometerConfig_t"
+.LASF371:
+	.string	"__linux 1"
+.LASF1237:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1270:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1240:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1733:
+	.string	"batteryConfig"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF810:
+	.string	"__id_t_defined "
+.LASF1735:
+	.string	"inputFilteringMode"
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1027:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1533:
+	.string	"gimbalConfig_s"
+.LASF1535:
+	.string	"gimbalConfig_t"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1486:
+	.string	"CW90_DEG"
+.LASF1763:
+	.string	"accAlt"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1170:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1493:
+	.string	"sensor_align_e"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF940:
+	.string	"__DECL_SIMD_logf128 "
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1725:
+	.string	"gyro_cmpfm_factor"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF1640:
+	.string	"THROTTLE"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1681:
+	.string	"profile_s"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF964:
+	.string	"__DECL_SIMD_acos "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1035:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF941:
+	.string	"__DECL_SIMD_logf32x "
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1518:
+	.string	"pitchDegrees"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1175:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1129:
+	.string	"__DECL_SIMD_erff64 "
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1267:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF967:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1589:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1174:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1659:
+	.string	"thrExpo8"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1194:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1137:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1406:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF1678:
+	.string	"SMALL_ANGLE"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1387:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1255:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1587:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1635:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1426:
+	.string	"__int32_t"
+.LASF1734:
+	.string	"rxConfig"
+.LASF1249:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1630:
+	.string	"BOXGOV"
+.LASF1697:
+	.string	"alt_hold_deadband"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1411:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1228:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1275:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1701:
+	.string	"servoConf"
+.LASF1685:
+	.string	"dynThrPID"
+.LASF966:
+	.string	"__DECL_SIMD_acosl "
+.LASF1393:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF1361:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1548:
+	.string	"gps_baudrate"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1679:
+	.string	"FIXED_WING"
+.LASF1144:
+	.string	"__DECL_SIMD_asinh "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1191:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1671:
+	.string	"AUTOTUNE_MODE"
+.LASF955:
+	.string	"__DECL_SIMD_powf "
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1193:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF1176:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1660:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1336:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF992:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1349:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF984:
+	.string	"__DECL_SIMD_asin "
+.LASF1344:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1594:
+	.string	"frskyUnit_e"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1224:
+	.string	"__MATHCALL"
+.LASF1078:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1483:
+	.string	"vario"
+.LASF1146:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF1014:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1278:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1216:
+	.string	"_Mdouble_ _Float32x"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1633:
+	.string	"BOXAUTOTUNE"
+.LASF1271:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1291:
+	.string	"__enable_irq() "
+.LASF1131:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1104:
+	.string	"__DECL_SIMD_atanh "
+.LASF917:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1627:
+	.string	"BOXLEDLOW"
+.LASF1645:
+	.string	"AUX5"
+.LASF1700:
+	.string	"throttle_correction_value"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF1647:
+	.string	"AUX7"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1154:
+	.string	"__DECL_SIMD_erfc "
+.LASF1674:
+	.string	"flightModeFlags"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1545:
+	.string	"serial_port_scenario"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1328:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1781:
+	.string	"rc_alias"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1272:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1033:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF995:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1383:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1541:
+	.string	"FUNCTION_GPS"
+.LASF980:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1574:
+	.string	"deadband3d_high"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1246:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1298:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1773:
+	.string	"updateAltHoldState"
+.LASF1437:
+	.string	"long long unsigned int"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1730:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF959:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF925:
+	.string	"__DECL_SIMD_sincosf "
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1367:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1728:
+	.string	"dcm_ki"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF981:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1727:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1770:
+	.string	"setVel"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1005:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF921:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1471:
+	.string	"rollAndPitchTrims_s"
+.LASF1473:
+	.string	"rollAndPitchTrims_t"
+.LASF1571:
+	.string	"mixerConfig_t"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1602:
+	.string	"frsky_unit"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1373:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1512:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1441:
+	.string	"serialInversion_e"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1711:
+	.string	"gyro_sync_denom"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1127:
+	.string	"__DECL_SIMD_erff16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1651:
+	.string	"auxChannelIndex"
+.LASF1032:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1028:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1364:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1655:
+	.string	"controlRateConfig_s"
+.LASF919:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1446:
+	.string	"RGB_RED"
+.LASF1135:
+	.string	"__DECL_SIMD_tanhf "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+.LASF1572:
+	.string	"flight3DConfig_s"
+.LASF1577:
+	.string	"flight3DConfig_t"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1705:
+	.string	"profile_t"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1656:
+	.string	"rcRate8"
+.LASF962:
+	.string	"__DECL_SIMD_powf64x "
+.LASF912:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF976:
+	.string	"__DECL_SIMD_atanl "
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1107:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1087:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1130:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF915:
+	.string	"__DECL_SIMD_sinf "
+.LASF1047:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1750:
+	.string	"baroCalculateAltitude"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF968:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1316:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1335:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1055:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF956:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF1436:
+	.string	"long long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1138:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF1709:
+	.string	"looptime"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1279:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1694:
+	.string	"modeActivationConditions"
+.LASF1606:
+	.string	"rcmap"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1342:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1455:
+	.string	"PIDNAVR"
+.LASF1683:
+	.string	"pidProfile"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1384:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1698:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1266:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1308:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF996:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1419:
+	.string	"long unsigned int"
+.LASF1206:
+	.string	"_Mdouble_ long double"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1293:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1290:
+	.string	"__disable_irq() "
+.LASF1459:
+	.string	"PID_ITEM_COUNT"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2 "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF926:
+	.string	"__DECL_SIMD_sincosl "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1180:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1690:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1726:
+	.string	"attitude_estimator"
+.LASF1424:
+	.string	"short int"
+.LASF1542:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1006:
+	.string	"__DECL_SIMD_exp2l "
+.LASF943:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1192:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1758:
+	.string	"baroVel"
+.LASF1421:
+	.string	"__int8_t"
+.LASF1767:
+	.string	"calculateAltHoldThrottleAdjustment"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1369:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1573:
+	.string	"deadband3d_low"
+.LASF1323:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1714:
+	.string	"customMixer"
+.LASF1418:
+	.string	"unsigned int"
+.LASF998:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1239:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1348:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF1527:
+	.string	"sonarAlt"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2f "
+.LASF924:
+	.string	"__DECL_SIMD_sincos "
+.LASF1529:
+	.string	"minthrottle"
+.LASF1136:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1624:
+	.string	"BOXPASSTHRU"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1185:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1695:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF950:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1582:
+	.string	"rate"
+.LASF1621:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1744:
+	.string	"profile"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1672:
+	.string	"PASSTHRU_MODE"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1376:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1183:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1156:
+	.string	"__DECL_SIMD_erfcl "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1487:
+	.string	"CW180_DEG"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1754:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1254:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1150:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1511:
+	.string	"vbatmincellvoltage"
+.LASF1292:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1056:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/flight/altitudehold.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
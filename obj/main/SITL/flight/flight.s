@@ -0,0 +1,27625 @@
+	.file	"flight.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/flight/flight.c"
+	.section	.text.resolveAxisSetpoints,"ax",@progbits
+	.p2align 4
+	.type	resolveAxisSetpoints, @function
+resolveAxisSetpoints:
+.LFB11:
+	.file 1 ".//src/main/flight/flight.c"
+	.loc 1 298 1 view -0
+	.cfi_startproc
+	.loc 1 299 4 view .LVU1
+.LVL0:
+	.loc 1 300 5 view .LVU2
+	.loc 1 301 5 view .LVU3
+	.loc 1 303 5 view .LVU4
+	.loc 1 303 8 is_stmt 0 view .LVU5
+	cmpb	$0, axisSetpointsValid(%rip)
+	.loc 1 303 51 view .LVU6
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 303 93 view .LVU7
+	movzbl	armingFlags(%rip), %ecx
+	.loc 1 303 8 view .LVU8
+	je	.L2
+	.loc 1 303 28 discriminator 1 view .LVU9
+	cmpw	%ax, setpointFlightModes(%rip)
+	je	.L10
+.L2:
+	movl	%eax, %edx
+	movl	%eax, %esi
+	andl	$1, %edx
+	andl	$2, %esi
+.LVL1:
+	.loc 1 312 9 is_stmt 1 view .LVU10
+	.loc 1 313 9 view .LVU11
+	.loc 1 313 12 is_stmt 0 view .LVU12
+	cmpb	$0, pidControllerType(%rip)
+	jne	.L11
+	.loc 1 314 13 is_stmt 1 view .LVU13
+	testw	%si, %si
+	movl	$2, %esi
+	cmovne	%esi, %edx
+	movl	%edx, %esi
+.LVL2:
+.L5:
+	.loc 1 326 38 is_stmt 0 view .LVU14
+	movb	%sil, axisSetpoints(%rip)
+	.loc 1 327 38 view .LVU15
+	movb	$0, 1+axisSetpoints(%rip)
+.LVL3:
+	.loc 1 326 9 is_stmt 1 view .LVU16
+	.loc 1 333 36 is_stmt 0 view .LVU17
+	movb	$0, 5+axisSetpoints(%rip)
+	.loc 1 335 25 view .LVU18
+	movw	%ax, setpointFlightModes(%rip)
+	.loc 1 336 25 view .LVU19
+	movb	%cl, setpointArmingFlags(%rip)
+	.loc 1 337 24 view .LVU20
+	movb	$1, axisSetpointsValid(%rip)
+	.loc 1 326 38 view .LVU21
+	movb	%dl, 2+axisSetpoints(%rip)
+	.loc 1 327 9 is_stmt 1 view .LVU22
+	.loc 1 311 48 view .LVU23
+.LVL4:
+	.loc 1 311 31 view .LVU24
+	.loc 1 332 5 view .LVU25
+	.loc 1 333 5 view .LVU26
+	.loc 1 335 5 view .LVU27
+	.loc 1 336 5 view .LVU28
+	.loc 1 337 5 view .LVU29
+	.loc 1 338 5 view .LVU30
+	.loc 1 327 38 is_stmt 0 view .LVU31
+	xorl	%edx, %edx
+.LVL5:
+	.loc 1 327 38 view .LVU32
+	movw	%dx, 3+axisSetpoints(%rip)
+	.loc 1 338 11 view .LVU33
+	movl	$1, %edx
+.LVL6:
+.L1:
+	.loc 1 339 1 view .LVU34
+	movl	%edx, %eax
+	ret
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.loc 1 320 13 is_stmt 1 view .LVU35
+	.loc 1 320 16 is_stmt 0 view .LVU36
+	testw	%dx, %dx
+	je	.L12
+	movl	$1, %esi
+	.loc 1 321 26 view .LVU37
+	movl	$1, %edx
+	jmp	.L5
+.LVL8:
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 304 15 discriminator 2 view .LVU38
+	xorl	%edx, %edx
+	.loc 1 303 70 discriminator 2 view .LVU39
+	cmpb	%cl, setpointArmingFlags(%rip)
+	jne	.L2
+	jmp	.L1
+.LVL9:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 322 20 is_stmt 1 view .LVU40
+	.loc 1 322 23 is_stmt 0 view .LVU41
+	testw	%si, %si
+	setne	%sil
+	addl	%esi, %esi
+.LVL10:
+	.loc 1 326 9 is_stmt 1 view .LVU42
+	.loc 1 327 9 view .LVU43
+	.loc 1 311 48 view .LVU44
+	.loc 1 311 31 view .LVU45
+	.loc 1 312 9 view .LVU46
+	.loc 1 313 9 view .LVU47
+	.loc 1 320 13 view .LVU48
+	.loc 1 322 20 view .LVU49
+	.loc 1 322 23 is_stmt 0 view .LVU50
+	movl	%esi, %edx
+	jmp	.L5
+	.cfi_endproc
+.LFE11:
+	.size	resolveAxisSetpoints, .-resolveAxisSetpoints
+	.section	.text.initIntegerRateKernel,"ax",@progbits
+	.p2align 4
+	.type	initIntegerRateKernel, @function
+initIntegerRateKernel:
+.LVL11:
+.LFB15:
+	.loc 1 431 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 432 5 view .LVU52
+.LBB150:
+.LBI150:
+	.loc 1 202 13 view .LVU53
+	.loc 1 204 5 view .LVU54
+.LBB151:
+.LBI151:
+	.loc 1 184 13 view .LVU55
+.LBB152:
+	.loc 1 186 5 view .LVU56
+	.loc 1 188 5 view .LVU57
+	.loc 1 190 17 is_stmt 0 view .LVU58
+	pxor	%xmm0, %xmm0
+	.loc 1 188 17 view .LVU59
+	movl	$1, 16(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU60
+	.loc 1 190 17 is_stmt 0 view .LVU61
+	movups	%xmm0, (%rdi)
+.LBE152:
+.LBE151:
+.LBE150:
+.LBB155:
+.LBB156:
+.LBB157:
+	movups	%xmm0, 24(%rdi)
+.LBE157:
+.LBE156:
+.LBE155:
+.LBB160:
+.LBB161:
+.LBB162:
+	movups	%xmm0, 48(%rdi)
+.LBE162:
+.LBE161:
+.LBE160:
+.LBB165:
+.LBB166:
+.LBB167:
+	movups	%xmm0, 72(%rdi)
+.LBE167:
+.LBE166:
+.LBE165:
+.LBB170:
+.LBB171:
+.LBB172:
+	movups	%xmm0, 96(%rdi)
+.LBE172:
+.LBE171:
+.LBE170:
+.LBB175:
+.LBB176:
+.LBB177:
+	movups	%xmm0, 120(%rdi)
+.LBE177:
+.LBE176:
+.LBE175:
+.LBB180:
+.LBB181:
+.LBB182:
+	movups	%xmm0, 144(%rdi)
+.LBE182:
+.LBE181:
+.LBE180:
+.LBB185:
+.LBB186:
+.LBB187:
+	movups	%xmm0, 168(%rdi)
+.LBE187:
+.LBE186:
+.LBE185:
+.LBB190:
+.LBB191:
+.LBB192:
+	movups	%xmm0, 192(%rdi)
+.LBE192:
+.LBE191:
+.LBE190:
+.LBB195:
+.LBB196:
+.LBB197:
+	movups	%xmm0, 216(%rdi)
+.LBE197:
+.LBE196:
+.LBE195:
+.LBB200:
+.LBB154:
+.LBB153:
+	.loc 1 189 18 view .LVU62
+	movb	$0, 20(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU63
+	.loc 1 191 5 view .LVU64
+	.loc 1 193 5 view .LVU65
+	.loc 1 195 12 view .LVU66
+.LVL12:
+	.loc 1 195 12 is_stmt 0 view .LVU67
+.LBE153:
+.LBE154:
+.LBE200:
+	.loc 1 433 5 is_stmt 1 view .LVU68
+.LBB201:
+.LBI155:
+	.loc 1 202 13 view .LVU69
+	.loc 1 204 5 view .LVU70
+.LBB159:
+.LBI156:
+	.loc 1 184 13 view .LVU71
+.LBB158:
+	.loc 1 186 5 view .LVU72
+	.loc 1 188 5 view .LVU73
+	.loc 1 188 17 is_stmt 0 view .LVU74
+	movl	$1, 40(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU75
+	.loc 1 189 18 is_stmt 0 view .LVU76
+	movb	$0, 44(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU77
+	.loc 1 191 5 view .LVU78
+	.loc 1 193 5 view .LVU79
+	.loc 1 195 12 view .LVU80
+.LVL13:
+	.loc 1 195 12 is_stmt 0 view .LVU81
+.LBE158:
+.LBE159:
+.LBE201:
+	.loc 1 434 5 is_stmt 1 view .LVU82
+.LBB202:
+.LBI160:
+	.loc 1 202 13 view .LVU83
+	.loc 1 204 5 view .LVU84
+.LBB164:
+.LBI161:
+	.loc 1 184 13 view .LVU85
+.LBB163:
+	.loc 1 186 5 view .LVU86
+	.loc 1 188 5 view .LVU87
+	.loc 1 188 17 is_stmt 0 view .LVU88
+	movl	$1, 64(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU89
+	.loc 1 189 18 is_stmt 0 view .LVU90
+	movb	$0, 68(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU91
+	.loc 1 191 5 view .LVU92
+	.loc 1 193 5 view .LVU93
+	.loc 1 195 12 view .LVU94
+.LVL14:
+	.loc 1 195 12 is_stmt 0 view .LVU95
+.LBE163:
+.LBE164:
+.LBE202:
+	.loc 1 435 5 is_stmt 1 view .LVU96
+.LBB203:
+.LBI165:
+	.loc 1 202 13 view .LVU97
+	.loc 1 204 5 view .LVU98
+.LBB169:
+.LBI166:
+	.loc 1 184 13 view .LVU99
+.LBB168:
+	.loc 1 186 5 view .LVU100
+	.loc 1 188 5 view .LVU101
+	.loc 1 188 17 is_stmt 0 view .LVU102
+	movl	$1, 88(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU103
+	.loc 1 189 18 is_stmt 0 view .LVU104
+	movb	$0, 92(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU105
+	.loc 1 191 5 view .LVU106
+	.loc 1 193 5 view .LVU107
+	.loc 1 195 12 view .LVU108
+.LVL15:
+	.loc 1 195 12 is_stmt 0 view .LVU109
+.LBE168:
+.LBE169:
+.LBE203:
+	.loc 1 436 5 is_stmt 1 view .LVU110
+.LBB204:
+.LBI170:
+	.loc 1 202 13 view .LVU111
+	.loc 1 204 5 view .LVU112
+.LBB174:
+.LBI171:
+	.loc 1 184 13 view .LVU113
+.LBB173:
+	.loc 1 186 5 view .LVU114
+	.loc 1 188 5 view .LVU115
+	.loc 1 188 17 is_stmt 0 view .LVU116
+	movl	$1, 112(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU117
+	.loc 1 189 18 is_stmt 0 view .LVU118
+	movb	$0, 116(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU119
+	.loc 1 191 5 view .LVU120
+	.loc 1 193 5 view .LVU121
+	.loc 1 195 12 view .LVU122
+.LVL16:
+	.loc 1 195 12 is_stmt 0 view .LVU123
+.LBE173:
+.LBE174:
+.LBE204:
+	.loc 1 437 5 is_stmt 1 view .LVU124
+.LBB205:
+.LBI175:
+	.loc 1 202 13 view .LVU125
+	.loc 1 204 5 view .LVU126
+.LBB179:
+.LBI176:
+	.loc 1 184 13 view .LVU127
+.LBB178:
+	.loc 1 186 5 view .LVU128
+	.loc 1 188 5 view .LVU129
+	.loc 1 188 17 is_stmt 0 view .LVU130
+	movl	$1, 136(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU131
+	.loc 1 189 18 is_stmt 0 view .LVU132
+	movb	$0, 140(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU133
+	.loc 1 191 5 view .LVU134
+	.loc 1 193 5 view .LVU135
+	.loc 1 195 12 view .LVU136
+.LVL17:
+	.loc 1 195 12 is_stmt 0 view .LVU137
+.LBE178:
+.LBE179:
+.LBE205:
+	.loc 1 438 5 is_stmt 1 view .LVU138
+.LBB206:
+.LBI180:
+	.loc 1 202 13 view .LVU139
+	.loc 1 204 5 view .LVU140
+.LBB184:
+.LBI181:
+	.loc 1 184 13 view .LVU141
+.LBB183:
+	.loc 1 186 5 view .LVU142
+	.loc 1 188 5 view .LVU143
+	.loc 1 188 17 is_stmt 0 view .LVU144
+	movl	$1, 160(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU145
+	.loc 1 189 18 is_stmt 0 view .LVU146
+	movb	$0, 164(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU147
+	.loc 1 191 5 view .LVU148
+	.loc 1 193 5 view .LVU149
+	.loc 1 195 12 view .LVU150
+.LVL18:
+	.loc 1 195 12 is_stmt 0 view .LVU151
+.LBE183:
+.LBE184:
+.LBE206:
+	.loc 1 439 5 is_stmt 1 view .LVU152
+.LBB207:
+.LBI185:
+	.loc 1 202 13 view .LVU153
+	.loc 1 204 5 view .LVU154
+.LBB189:
+.LBI186:
+	.loc 1 184 13 view .LVU155
+.LBB188:
+	.loc 1 186 5 view .LVU156
+	.loc 1 188 5 view .LVU157
+	.loc 1 188 17 is_stmt 0 view .LVU158
+	movl	$1, 184(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU159
+	.loc 1 189 18 is_stmt 0 view .LVU160
+	movb	$0, 188(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU161
+	.loc 1 191 5 view .LVU162
+	.loc 1 193 5 view .LVU163
+	.loc 1 195 12 view .LVU164
+.LVL19:
+	.loc 1 195 12 is_stmt 0 view .LVU165
+.LBE188:
+.LBE189:
+.LBE207:
+	.loc 1 440 5 is_stmt 1 view .LVU166
+.LBB208:
+.LBI190:
+	.loc 1 202 13 view .LVU167
+	.loc 1 204 5 view .LVU168
+.LBB194:
+.LBI191:
+	.loc 1 184 13 view .LVU169
+.LBB193:
+	.loc 1 186 5 view .LVU170
+	.loc 1 188 5 view .LVU171
+	.loc 1 188 17 is_stmt 0 view .LVU172
+	movl	$1, 208(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU173
+	.loc 1 189 18 is_stmt 0 view .LVU174
+	movb	$0, 212(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU175
+	.loc 1 191 5 view .LVU176
+	.loc 1 193 5 view .LVU177
+	.loc 1 195 12 view .LVU178
+.LVL20:
+	.loc 1 195 12 is_stmt 0 view .LVU179
+.LBE193:
+.LBE194:
+.LBE208:
+	.loc 1 441 5 is_stmt 1 view .LVU180
+.LBB209:
+.LBI195:
+	.loc 1 202 13 view .LVU181
+	.loc 1 204 5 view .LVU182
+.LBB199:
+.LBI196:
+	.loc 1 184 13 view .LVU183
+.LBB198:
+	.loc 1 186 5 view .LVU184
+	.loc 1 188 5 view .LVU185
+	.loc 1 188 17 is_stmt 0 view .LVU186
+	movl	$1, 232(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU187
+	.loc 1 189 18 is_stmt 0 view .LVU188
+	movb	$0, 236(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU189
+	.loc 1 191 5 view .LVU190
+	.loc 1 193 5 view .LVU191
+	.loc 1 195 12 view .LVU192
+.LVL21:
+	.loc 1 195 12 is_stmt 0 view .LVU193
+.LBE198:
+.LBE199:
+.LBE209:
+	.loc 1 442 5 is_stmt 1 view .LVU194
+.LBB210:
+.LBI210:
+	.loc 1 202 13 view .LVU195
+	.loc 1 204 5 view .LVU196
+.LBB211:
+.LBI211:
+	.loc 1 184 13 view .LVU197
+.LBB212:
+	.loc 1 186 5 view .LVU198
+	.loc 1 188 5 view .LVU199
+	.loc 1 188 17 is_stmt 0 view .LVU200
+	movl	$1, 256(%rdi)
+	.loc 1 189 5 is_stmt 1 view .LVU201
+	.loc 1 189 18 is_stmt 0 view .LVU202
+	movb	$0, 260(%rdi)
+	.loc 1 190 5 is_stmt 1 view .LVU203
+	.loc 1 191 5 view .LVU204
+	.loc 1 190 17 is_stmt 0 view .LVU205
+	movups	%xmm0, 240(%rdi)
+	.loc 1 193 5 is_stmt 1 view .LVU206
+	.loc 1 195 12 view .LVU207
+.LVL22:
+	.loc 1 195 12 is_stmt 0 view .LVU208
+.LBE212:
+.LBE211:
+.LBE210:
+	.loc 1 443 5 is_stmt 1 view .LVU209
+	.loc 1 444 5 view .LVU210
+	.loc 1 445 5 view .LVU211
+	.loc 1 446 5 view .LVU212
+	.loc 1 447 5 view .LVU213
+	.loc 1 448 5 view .LVU214
+	.loc 1 449 5 view .LVU215
+	.loc 1 450 5 view .LVU216
+	.loc 1 451 5 view .LVU217
+	.loc 1 452 5 view .LVU218
+	.loc 1 453 5 view .LVU219
+	.loc 1 447 25 is_stmt 0 view .LVU220
+	movq	.LC1(%rip), %rax
+	.loc 1 443 33 view .LVU221
+	movdqa	.LC0(%rip), %xmm0
+	.loc 1 447 25 view .LVU222
+	movq	%rax, 296(%rdi)
+	.loc 1 449 34 view .LVU223
+	movabsq	$6442450943, %rax
+	movq	%rax, 304(%rdi)
+	.loc 1 443 33 view .LVU224
+	movups	%xmm0, 264(%rdi)
+	movups	%xmm0, 280(%rdi)
+	.loc 1 454 1 view .LVU225
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	initIntegerRateKernel, .-initIntegerRateKernel
+	.section	.text.updateDTermFilter,"ax",@progbits
+	.p2align 4
+	.type	updateDTermFilter, @function
+updateDTermFilter:
+.LVL23:
+.LFB10:
+	.loc 1 268 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 269 5 view .LVU227
+	.loc 1 271 5 view .LVU228
+	.loc 1 271 20 is_stmt 0 view .LVU229
+	movzbl	76(%rdi), %esi
+	.loc 1 272 15 view .LVU230
+	xorl	%eax, %eax
+	.loc 1 271 8 view .LVU231
+	testb	%sil, %sil
+	je	.L23
+	.loc 1 271 38 discriminator 1 view .LVU232
+	movl	targetPidLooptime(%rip), %edx
+	.loc 1 271 35 discriminator 1 view .LVU233
+	testl	%edx, %edx
+	je	.L23
+	.loc 1 275 8 view .LVU234
+	cmpb	dtermFilterCutoff(%rip), %sil
+	.loc 1 268 1 view .LVU235
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 275 5 is_stmt 1 view .LVU236
+	.loc 1 275 8 is_stmt 0 view .LVU237
+	je	.L26
+.L16:
+.LVL24:
+	.loc 1 277 13 is_stmt 1 view .LVU238
+	leaq	32+axisStates(%rip), %rdi
+.LVL25:
+	.loc 1 277 13 is_stmt 0 view .LVU239
+	call	biquadFilterFixedInitLPF@PLT
+.LVL26:
+	.loc 1 276 38 is_stmt 1 view .LVU240
+	.loc 1 276 29 view .LVU241
+	.loc 1 277 13 view .LVU242
+	movzbl	76(%rbx), %esi
+	movl	targetPidLooptime(%rip), %edx
+	leaq	104+axisStates(%rip), %rdi
+	call	biquadFilterFixedInitLPF@PLT
+.LVL27:
+	.loc 1 276 38 view .LVU243
+	.loc 1 276 29 view .LVU244
+	.loc 1 277 13 view .LVU245
+	movzbl	76(%rbx), %esi
+	movl	targetPidLooptime(%rip), %edx
+	leaq	176+axisStates(%rip), %rdi
+	call	biquadFilterFixedInitLPF@PLT
+.LVL28:
+	.loc 1 276 38 view .LVU246
+	.loc 1 276 29 view .LVU247
+	.loc 1 279 9 view .LVU248
+	.loc 1 279 27 is_stmt 0 view .LVU249
+	movzbl	76(%rbx), %eax
+	movb	%al, dtermFilterCutoff(%rip)
+	.loc 1 280 9 is_stmt 1 view .LVU250
+	.loc 1 280 33 is_stmt 0 view .LVU251
+	movl	targetPidLooptime(%rip), %eax
+	movl	%eax, dtermFilterSamplePeriod(%rip)
+.LVL29:
+.L17:
+	.loc 1 282 11 view .LVU252
+	movl	$1, %eax
+	.loc 1 283 1 view .LVU253
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL30:
+	.loc 1 283 1 view .LVU254
+	ret
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.cfi_restore 3
+	.loc 1 283 1 view .LVU255
+	ret
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L26:
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 275 55 discriminator 1 view .LVU256
+	cmpl	dtermFilterSamplePeriod(%rip), %edx
+	jne	.L16
+	jmp	.L17
+	.cfi_endproc
+.LFE10:
+	.size	updateDTermFilter, .-updateDTermFilter
+	.section	.text.pidRateKernel,"ax",@progbits
+	.p2align 4
+	.type	pidRateKernel, @function
+pidRateKernel:
+.LVL33:
+.LFB14:
+	.loc 1 387 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 388 5 view .LVU258
+	.loc 1 389 5 view .LVU259
+	.loc 1 390 5 view .LVU260
+	.loc 1 391 5 view .LVU261
+	.loc 1 393 5 view .LVU262
+	.loc 1 387 1 is_stmt 0 view .LVU263
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 393 33 view .LVU264
+	leaq	gyroData(%rip), %rax
+	.loc 1 387 1 view .LVU265
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB251:
+.LBB252:
+	.loc 1 258 36 view .LVU266
+	leaq	rateKernels(%rip), %r12
+.LBE252:
+.LBE251:
+	.loc 1 387 1 view .LVU267
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movslq	%edi, %rbx
+	movq	%rsi, %rdi
+.LVL34:
+	.loc 1 387 1 view .LVU268
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 393 33 view .LVU269
+	movswq	(%rax,%rbx,2), %rcx
+.LBB258:
+.LBB253:
+	.loc 1 258 36 view .LVU270
+	imulq	$312, %rbx, %rax
+.LBE253:
+.LBE258:
+	.loc 1 394 18 view .LVU271
+	movq	(%rdi), %r10
+	.loc 1 387 1 view .LVU272
+	movl	%edx, 12(%rsp)
+	.loc 1 393 33 view .LVU273
+	movq	%rcx, %r8
+.LVL35:
+.LBB259:
+.LBI251:
+	.loc 1 256 16 is_stmt 1 view .LVU274
+.LBB254:
+	.loc 1 258 5 view .LVU275
+	.loc 1 258 36 is_stmt 0 view .LVU276
+	addq	%r12, %rax
+	movslq	16(%rax), %rdx
+.LVL36:
+	.loc 1 258 36 view .LVU277
+.LBE254:
+.LBE259:
+	.loc 1 402 49 view .LVU278
+	movq	264(%rax), %r11
+	.loc 1 404 45 view .LVU279
+	movq	272(%rax), %rbp
+.LBB260:
+.LBB255:
+	.loc 1 258 13 view .LVU280
+	imulq	%rcx, %rdx
+.LVL37:
+	.loc 1 260 5 is_stmt 1 view .LVU281
+	.loc 1 260 86 is_stmt 0 view .LVU282
+	movzbl	20(%rax), %ecx
+.LVL38:
+	.loc 1 260 86 view .LVU283
+.LBE255:
+.LBE260:
+	.loc 1 401 17 view .LVU284
+	movq	%r11, %r9
+	negq	%r9
+.LBB261:
+.LBB256:
+	.loc 1 260 47 view .LVU285
+	movq	%rdx, %rsi
+.LVL39:
+	.loc 1 260 21 view .LVU286
+	addq	(%rax), %rdx
+.LVL40:
+	.loc 1 260 47 view .LVU287
+	sarq	$63, %rsi
+.LVL41:
+	.loc 1 260 54 view .LVU288
+	andq	8(%rax), %rsi
+	.loc 1 260 35 view .LVU289
+	addq	%rdx, %rsi
+.LBE256:
+.LBE261:
+	.loc 1 397 28 view .LVU290
+	movsbq	308(%rax), %rdx
+.LBB262:
+.LBB257:
+	.loc 1 260 78 view .LVU291
+	sarq	%cl, %rsi
+.LVL42:
+	.loc 1 260 78 view .LVU292
+.LBE257:
+.LBE262:
+	.loc 1 394 5 is_stmt 1 view .LVU293
+	.loc 1 397 5 view .LVU294
+.LBB263:
+.LBI263:
+	.loc 1 256 16 view .LVU295
+.LBB264:
+	.loc 1 258 5 view .LVU296
+	.loc 1 258 36 is_stmt 0 view .LVU297
+	movslq	40(%rax), %rcx
+.LBE264:
+.LBE263:
+	.loc 1 397 46 view .LVU298
+	imulq	%r10, %rdx
+	.loc 1 397 13 view .LVU299
+	subq	%rsi, %rdx
+.LBB267:
+.LBB265:
+	.loc 1 258 13 view .LVU300
+	imulq	%rcx, %rdx
+.LVL43:
+	.loc 1 260 5 is_stmt 1 view .LVU301
+	.loc 1 260 47 is_stmt 0 view .LVU302
+	movq	%rdx, %rcx
+	.loc 1 260 21 view .LVU303
+	addq	24(%rax), %rdx
+.LVL44:
+	.loc 1 260 47 view .LVU304
+	sarq	$63, %rcx
+.LVL45:
+	.loc 1 260 54 view .LVU305
+	andq	32(%rax), %rcx
+	.loc 1 260 35 view .LVU306
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU307
+	movzbl	44(%rax), %ecx
+	.loc 1 260 78 view .LVU308
+	sarq	%cl, %rdx
+.LBE265:
+.LBE267:
+	.loc 1 394 11 view .LVU309
+	movq	%r10, %rcx
+.LBB268:
+.LBB266:
+	.loc 1 260 78 view .LVU310
+	movq	%rdx, (%rsp)
+.LVL46:
+	.loc 1 260 78 view .LVU311
+.LBE266:
+.LBE268:
+	.loc 1 401 5 is_stmt 1 view .LVU312
+.LBB269:
+.LBI269:
+	.loc 1 256 16 view .LVU313
+.LBB270:
+	.loc 1 258 5 view .LVU314
+	.loc 1 258 36 is_stmt 0 view .LVU315
+	movslq	64(%rax), %rdx
+.LVL47:
+	.loc 1 258 36 view .LVU316
+.LBE270:
+.LBE269:
+	.loc 1 394 11 view .LVU317
+	subq	%rsi, %rcx
+.LVL48:
+.LBB272:
+.LBB271:
+	.loc 1 258 13 view .LVU318
+	imulq	%rdx, %rcx
+.LVL49:
+	.loc 1 260 5 is_stmt 1 view .LVU319
+	.loc 1 260 47 is_stmt 0 view .LVU320
+	movq	%rcx, %rdx
+	.loc 1 260 21 view .LVU321
+	addq	48(%rax), %rcx
+.LVL50:
+	.loc 1 260 47 view .LVU322
+	sarq	$63, %rdx
+.LVL51:
+	.loc 1 260 54 view .LVU323
+	andq	56(%rax), %rdx
+	.loc 1 260 35 view .LVU324
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU325
+	movzbl	68(%rax), %ecx
+	.loc 1 260 78 view .LVU326
+	sarq	%cl, %rdx
+.LVL52:
+	.loc 1 260 78 view .LVU327
+.LBE271:
+.LBE272:
+.LBB273:
+.LBI273:
+	.loc 1 174 16 is_stmt 1 view .LVU328
+.LBB274:
+	.loc 1 176 5 view .LVU329
+.LBE274:
+.LBE273:
+.LBB275:
+.LBB276:
+	.loc 1 258 36 is_stmt 0 view .LVU330
+	movslq	88(%rax), %rcx
+	cmpq	%rdx, %r11
+	cmovg	%rdx, %r11
+.LVL53:
+	.loc 1 258 36 view .LVU331
+	cmpq	%rdx, %r9
+	cmovle	%r11, %r9
+.LVL54:
+	.loc 1 258 36 view .LVU332
+.LBE276:
+.LBE275:
+	.loc 1 403 5 is_stmt 1 view .LVU333
+	.loc 1 403 25 is_stmt 0 view .LVU334
+	movq	%rbp, %r11
+	negq	%r11
+.LVL55:
+.LBB279:
+.LBI275:
+	.loc 1 256 16 is_stmt 1 view .LVU335
+.LBB277:
+	.loc 1 258 5 view .LVU336
+	.loc 1 258 13 is_stmt 0 view .LVU337
+	imulq	%r9, %rcx
+.LVL56:
+	.loc 1 260 5 is_stmt 1 view .LVU338
+	.loc 1 260 5 is_stmt 0 view .LVU339
+.LBE277:
+.LBE279:
+	.loc 1 403 42 view .LVU340
+	leaq	axisStates(%rip), %r9
+.LVL57:
+.LBB280:
+.LBB278:
+	.loc 1 260 47 view .LVU341
+	movq	%rcx, %rdx
+.LVL58:
+	.loc 1 260 21 view .LVU342
+	addq	72(%rax), %rcx
+	.loc 1 260 47 view .LVU343
+	sarq	$63, %rdx
+	.loc 1 260 54 view .LVU344
+	andq	80(%rax), %rdx
+	.loc 1 260 35 view .LVU345
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU346
+	movzbl	92(%rax), %ecx
+	.loc 1 260 78 view .LVU347
+	sarq	%cl, %rdx
+.LBE278:
+.LBE280:
+	.loc 1 403 42 view .LVU348
+	leaq	(%rbx,%rbx,8), %rcx
+	leaq	(%r9,%rcx,8), %rcx
+	.loc 1 403 25 view .LVU349
+	addq	(%rcx), %rdx
+.LVL59:
+.LBB281:
+.LBI281:
+	.loc 1 174 16 is_stmt 1 view .LVU350
+.LBB282:
+	.loc 1 176 5 view .LVU351
+	cmpq	%rdx, %rbp
+	cmovg	%rdx, %rbp
+.LVL60:
+	.loc 1 176 5 is_stmt 0 view .LVU352
+	cmpq	%rdx, %r11
+.LBE282:
+.LBE281:
+	.loc 1 405 50 view .LVU353
+	movl	%r8d, %edx
+.LVL61:
+	.loc 1 405 50 view .LVU354
+	cmovle	%rbp, %r11
+.LVL62:
+	.loc 1 405 50 view .LVU355
+	negw	%dx
+	cmovs	%r8d, %edx
+	.loc 1 403 23 view .LVU356
+	movq	%r11, (%rcx)
+	.loc 1 405 5 is_stmt 1 view .LVU357
+	.loc 1 405 50 is_stmt 0 view .LVU358
+	movzwl	%dx, %edx
+	.loc 1 405 8 view .LVU359
+	cmpl	300(%rax), %edx
+	jg	.L30
+	.loc 1 405 139 discriminator 1 view .LVU360
+	leaq	rcCommand(%rip), %rdx
+	.loc 1 405 147 discriminator 1 view .LVU361
+	movzwl	(%rdx,%rbx,2), %ecx
+	movl	%ecx, %edx
+	negw	%dx
+	cmovs	%ecx, %edx
+	movzwl	%dx, %edx
+	.loc 1 405 101 discriminator 1 view .LVU362
+	cmpl	304(%rax), %edx
+	jg	.L30
+.LVL63:
+.L31:
+	.loc 1 408 5 is_stmt 1 view .LVU363
+.LBB283:
+.LBI283:
+	.loc 1 256 16 view .LVU364
+.LBB284:
+	.loc 1 258 5 view .LVU365
+	.loc 1 258 36 is_stmt 0 view .LVU366
+	imulq	$312, %rbx, %rax
+.LBE284:
+.LBE283:
+	.loc 1 410 53 view .LVU367
+	movswq	20(%rdi), %r14
+	.loc 1 410 104 view .LVU368
+	movswq	22(%rdi), %r15
+.LBB288:
+.LBB285:
+	.loc 1 258 36 view .LVU369
+	addq	%r12, %rax
+	movslq	112(%rax), %rcx
+.LBE285:
+.LBE288:
+.LBB289:
+.LBB290:
+	movslq	232(%rax), %r13
+.LBE290:
+.LBE289:
+.LBB293:
+.LBB286:
+	.loc 1 258 13 view .LVU370
+	imulq	%r11, %rcx
+.LVL64:
+	.loc 1 260 5 is_stmt 1 view .LVU371
+	.loc 1 260 5 is_stmt 0 view .LVU372
+.LBE286:
+.LBE293:
+.LBB294:
+.LBI294:
+	.loc 1 256 16 is_stmt 1 view .LVU373
+.LBB295:
+	.loc 1 258 5 view .LVU374
+.LBE295:
+.LBE294:
+	.loc 1 410 69 is_stmt 0 view .LVU375
+	movslq	8(%rdi), %r11
+	.loc 1 410 97 view .LVU376
+	imulq	%r15, %r11
+.LBB298:
+.LBB287:
+	.loc 1 260 47 view .LVU377
+	movq	%rcx, %rdx
+	.loc 1 260 21 view .LVU378
+	addq	96(%rax), %rcx
+.LVL65:
+	.loc 1 260 47 view .LVU379
+	sarq	$63, %rdx
+.LVL66:
+	.loc 1 260 54 view .LVU380
+	andq	104(%rax), %rdx
+	.loc 1 260 35 view .LVU381
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU382
+	movzbl	116(%rax), %ecx
+	.loc 1 260 78 view .LVU383
+	sarq	%cl, %rdx
+.LBE287:
+.LBE298:
+.LBB299:
+.LBB296:
+	.loc 1 258 36 view .LVU384
+	movslq	136(%rax), %rcx
+	.loc 1 258 13 view .LVU385
+	imulq	%rcx, %rdx
+.LVL67:
+	.loc 1 260 5 is_stmt 1 view .LVU386
+	.loc 1 260 5 is_stmt 0 view .LVU387
+.LBE296:
+.LBE299:
+	.loc 1 410 5 is_stmt 1 view .LVU388
+.LBB300:
+.LBI289:
+	.loc 1 256 16 view .LVU389
+.LBB291:
+	.loc 1 258 5 view .LVU390
+.LBE291:
+.LBE300:
+	.loc 1 410 23 is_stmt 0 view .LVU391
+	movslq	12(%rdi), %rcx
+	.loc 1 410 46 view .LVU392
+	imulq	%r14, %rcx
+	.loc 1 410 14 view .LVU393
+	addq	%r11, %rcx
+.LBB301:
+.LBB292:
+	.loc 1 260 86 view .LVU394
+	movzbl	236(%rax), %r11d
+	.loc 1 258 13 view .LVU395
+	imulq	%r13, %rcx
+.LVL68:
+	.loc 1 260 5 is_stmt 1 view .LVU396
+	.loc 1 260 47 is_stmt 0 view .LVU397
+	movq	%rcx, %rbp
+	.loc 1 260 21 view .LVU398
+	addq	216(%rax), %rcx
+	.loc 1 260 47 view .LVU399
+	sarq	$63, %rbp
+	.loc 1 260 54 view .LVU400
+	andq	224(%rax), %rbp
+	.loc 1 260 35 view .LVU401
+	addq	%rcx, %rbp
+	.loc 1 260 78 view .LVU402
+	movl	%r11d, %ecx
+	sarq	%cl, %rbp
+.LBE292:
+.LBE301:
+	.loc 1 410 11 view .LVU403
+	movq	(%rsp), %rcx
+	addq	%rcx, %rbp
+.LVL69:
+	.loc 1 412 5 is_stmt 1 view .LVU404
+.LBB302:
+.LBI302:
+	.loc 1 256 16 view .LVU405
+.LBB303:
+	.loc 1 258 5 view .LVU406
+.LBE303:
+.LBE302:
+.LBB306:
+.LBB297:
+	.loc 1 260 47 is_stmt 0 view .LVU407
+	movq	%rdx, %rcx
+	.loc 1 260 21 view .LVU408
+	addq	120(%rax), %rdx
+.LVL70:
+	.loc 1 260 47 view .LVU409
+	sarq	$63, %rcx
+.LVL71:
+	.loc 1 260 54 view .LVU410
+	andq	128(%rax), %rcx
+	.loc 1 260 35 view .LVU411
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU412
+	movzbl	140(%rax), %ecx
+	.loc 1 260 78 view .LVU413
+	sarq	%cl, %rdx
+.LBE297:
+.LBE306:
+	.loc 1 412 22 view .LVU414
+	movslq	16(%rdi), %rcx
+	.loc 1 412 74 view .LVU415
+	imulq	%r15, %rdx
+	.loc 1 412 45 view .LVU416
+	imulq	%r14, %rcx
+	.loc 1 412 13 view .LVU417
+	addq	%rcx, %rdx
+.LBB307:
+.LBB304:
+	.loc 1 260 78 view .LVU418
+	movl	%r11d, %ecx
+	.loc 1 258 13 view .LVU419
+	imulq	%r13, %rdx
+.LVL72:
+	.loc 1 260 5 is_stmt 1 view .LVU420
+	.loc 1 260 47 is_stmt 0 view .LVU421
+	movq	%rdx, %r13
+	.loc 1 260 21 view .LVU422
+	addq	216(%rax), %rdx
+.LVL73:
+	.loc 1 260 47 view .LVU423
+	sarq	$63, %r13
+.LVL74:
+	.loc 1 260 54 view .LVU424
+	andq	224(%rax), %r13
+	.loc 1 260 35 view .LVU425
+	addq	%rdx, %r13
+.LBE304:
+.LBE307:
+	.loc 1 415 64 view .LVU426
+	movsbq	310(%rax), %rdx
+.LBB308:
+.LBB305:
+	.loc 1 260 78 view .LVU427
+	sarq	%cl, %r13
+.LVL75:
+	.loc 1 260 78 view .LVU428
+.LBE305:
+.LBE308:
+	.loc 1 415 5 is_stmt 1 view .LVU429
+	.loc 1 415 20 is_stmt 0 view .LVU430
+	movsbq	309(%rax), %rcx
+	.loc 1 415 85 view .LVU431
+	imulq	%rsi, %rdx
+	.loc 1 415 38 view .LVU432
+	imulq	%r10, %rcx
+	.loc 1 418 44 view .LVU433
+	movq	280(%rax), %r10
+.LVL76:
+	.loc 1 417 13 view .LVU434
+	movq	%r10, %r11
+	.loc 1 415 56 view .LVU435
+	addq	%rdx, %rcx
+	.loc 1 416 21 view .LVU436
+	movsbl	311(%rax), %edx
+	.loc 1 417 13 view .LVU437
+	negq	%r11
+	.loc 1 416 35 view .LVU438
+	imull	%r8d, %edx
+	movslq	%edx, %rdx
+	.loc 1 415 12 view .LVU439
+	leaq	(%rcx,%rdx), %r8
+.LVL77:
+	.loc 1 417 5 is_stmt 1 view .LVU440
+.LBB309:
+.LBI309:
+	.loc 1 256 16 view .LVU441
+.LBB310:
+	.loc 1 258 5 view .LVU442
+.LBE310:
+.LBE309:
+	.loc 1 417 48 is_stmt 0 view .LVU443
+	leaq	(%rbx,%rbx,8), %rdx
+.LBB313:
+.LBB311:
+	.loc 1 258 36 view .LVU444
+	movslq	160(%rax), %rcx
+.LBE311:
+.LBE313:
+	.loc 1 417 48 view .LVU445
+	salq	$3, %rdx
+	.loc 1 417 13 view .LVU446
+	movq	%r8, %rsi
+.LVL78:
+	.loc 1 417 48 view .LVU447
+	leaq	(%r9,%rdx), %rdi
+.LVL79:
+	.loc 1 417 13 view .LVU448
+	subq	8(%rdi), %rsi
+.LBB314:
+.LBB312:
+	.loc 1 258 13 view .LVU449
+	imulq	%rcx, %rsi
+.LVL80:
+	.loc 1 260 5 is_stmt 1 view .LVU450
+	.loc 1 260 47 is_stmt 0 view .LVU451
+	movq	%rsi, %rcx
+	.loc 1 260 21 view .LVU452
+	addq	144(%rax), %rsi
+.LVL81:
+	.loc 1 260 47 view .LVU453
+	sarq	$63, %rcx
+.LVL82:
+	.loc 1 260 54 view .LVU454
+	andq	152(%rax), %rcx
+	.loc 1 260 35 view .LVU455
+	addq	%rcx, %rsi
+	.loc 1 260 86 view .LVU456
+	movzbl	164(%rax), %ecx
+	.loc 1 260 78 view .LVU457
+	sarq	%cl, %rsi
+.LVL83:
+	.loc 1 260 78 view .LVU458
+.LBE312:
+.LBE314:
+.LBB315:
+.LBI315:
+	.loc 1 174 16 is_stmt 1 view .LVU459
+.LBB316:
+	.loc 1 176 5 view .LVU460
+.LBE316:
+.LBE315:
+.LBB317:
+.LBB318:
+	.loc 1 258 36 is_stmt 0 view .LVU461
+	movslq	184(%rax), %rcx
+	cmpq	%rsi, %r10
+	cmovg	%rsi, %r10
+.LVL84:
+	.loc 1 258 36 view .LVU462
+	cmpq	%rsi, %r11
+	cmovle	%r10, %r11
+.LVL85:
+	.loc 1 258 36 view .LVU463
+.LBE318:
+.LBE317:
+	.loc 1 419 5 is_stmt 1 view .LVU464
+.LBB321:
+.LBI317:
+	.loc 1 256 16 view .LVU465
+.LBB319:
+	.loc 1 258 5 view .LVU466
+	.loc 1 258 13 is_stmt 0 view .LVU467
+	imulq	%r11, %rcx
+.LVL86:
+	.loc 1 260 5 is_stmt 1 view .LVU468
+	.loc 1 260 47 is_stmt 0 view .LVU469
+	movq	%rcx, %rsi
+	.loc 1 260 21 view .LVU470
+	addq	168(%rax), %rcx
+.LVL87:
+	.loc 1 260 47 view .LVU471
+	sarq	$63, %rsi
+.LVL88:
+	.loc 1 260 54 view .LVU472
+	andq	176(%rax), %rsi
+	.loc 1 260 35 view .LVU473
+	addq	%rcx, %rsi
+	.loc 1 260 86 view .LVU474
+	movzbl	188(%rax), %ecx
+.LBE319:
+.LBE321:
+	.loc 1 420 23 view .LVU475
+	movq	%r8, 8(%rdi)
+.LBB322:
+.LBB320:
+	.loc 1 260 78 view .LVU476
+	sarq	%cl, %rsi
+.LVL89:
+	.loc 1 260 78 view .LVU477
+.LBE320:
+.LBE322:
+	.loc 1 420 5 is_stmt 1 view .LVU478
+	.loc 1 422 5 view .LVU479
+.LBB323:
+.LBI323:
+	.loc 1 365 16 view .LVU480
+.LBB324:
+	.loc 1 367 5 view .LVU481
+	.loc 1 369 5 view .LVU482
+	.loc 1 369 8 is_stmt 0 view .LVU483
+	cmpb	$0, 12(%rsp)
+	jne	.L38
+	.loc 1 376 5 is_stmt 1 view .LVU484
+	.loc 1 376 21 is_stmt 0 view .LVU485
+	movq	16(%rdi), %rcx
+	.loc 1 376 30 view .LVU486
+	movq	24(%rdi), %rax
+	.loc 1 378 19 view .LVU487
+	movq	%rsi, %xmm0
+	movq	%rcx, %xmm1
+	.loc 1 376 30 view .LVU488
+	addq	%rcx, %rax
+	.loc 1 378 19 view .LVU489
+	punpcklqdq	%xmm1, %xmm0
+	.loc 1 376 14 view .LVU490
+	addq	%rsi, %rax
+.LVL90:
+	.loc 1 377 5 is_stmt 1 view .LVU491
+	.loc 1 378 5 view .LVU492
+	.loc 1 378 19 is_stmt 0 view .LVU493
+	movups	%xmm0, 16(%r9,%rdx)
+	.loc 1 379 5 is_stmt 1 view .LVU494
+.LVL91:
+.L34:
+	.loc 1 379 5 is_stmt 0 view .LVU495
+.LBE324:
+.LBE323:
+	.loc 1 423 5 is_stmt 1 view .LVU496
+	.loc 1 423 80 is_stmt 0 view .LVU497
+	imulq	$312, %rbx, %rbx
+.LVL92:
+	.loc 1 423 80 view .LVU498
+	addq	%r12, %rbx
+.LBB330:
+.LBB331:
+	.loc 1 258 36 view .LVU499
+	movslq	208(%rbx), %rdx
+.LBE331:
+.LBE330:
+	.loc 1 423 80 view .LVU500
+	movq	288(%rbx), %rsi
+.LBB335:
+.LBB332:
+	.loc 1 260 86 view .LVU501
+	movzbl	212(%rbx), %ecx
+	.loc 1 258 13 view .LVU502
+	imulq	%rax, %rdx
+.LBE332:
+.LBE335:
+	.loc 1 423 13 view .LVU503
+	movq	%rsi, %rdi
+	negq	%rdi
+.LVL93:
+.LBB336:
+.LBI330:
+	.loc 1 256 16 is_stmt 1 view .LVU504
+.LBB333:
+	.loc 1 258 5 view .LVU505
+	.loc 1 260 5 view .LVU506
+	.loc 1 260 47 is_stmt 0 view .LVU507
+	movq	%rdx, %rax
+.LVL94:
+	.loc 1 260 21 view .LVU508
+	addq	192(%rbx), %rdx
+.LVL95:
+	.loc 1 260 47 view .LVU509
+	sarq	$63, %rax
+.LVL96:
+	.loc 1 260 54 view .LVU510
+	andq	200(%rbx), %rax
+	.loc 1 260 35 view .LVU511
+	addq	%rdx, %rax
+.LBE333:
+.LBE336:
+.LBB337:
+.LBB338:
+	.loc 1 258 36 view .LVU512
+	movslq	256(%rbx), %rdx
+.LBE338:
+.LBE337:
+.LBB341:
+.LBB334:
+	.loc 1 260 78 view .LVU513
+	sarq	%cl, %rax
+.LVL97:
+	.loc 1 260 78 view .LVU514
+.LBE334:
+.LBE341:
+.LBB342:
+.LBI342:
+	.loc 1 174 16 is_stmt 1 view .LVU515
+.LBB343:
+	.loc 1 176 5 view .LVU516
+.LBE343:
+.LBE342:
+.LBB344:
+.LBB339:
+	.loc 1 260 86 is_stmt 0 view .LVU517
+	movzbl	260(%rbx), %ecx
+	cmpq	%rax, %rsi
+	cmovg	%rax, %rsi
+.LVL98:
+	.loc 1 260 86 view .LVU518
+	cmpq	%rax, %rdi
+.LBE339:
+.LBE344:
+	.loc 1 426 102 view .LVU519
+	movslq	296(%rbx), %rax
+.LVL99:
+	.loc 1 426 102 view .LVU520
+	cmovle	%rsi, %rdi
+.LVL100:
+	.loc 1 426 5 is_stmt 1 view .LVU521
+	.loc 1 426 39 is_stmt 0 view .LVU522
+	addq	%r13, %rbp
+.LVL101:
+	.loc 1 426 74 view .LVU523
+	movl	%eax, %esi
+	negl	%esi
+	.loc 1 426 12 view .LVU524
+	addq	%rdi, %rbp
+	movslq	%esi, %rsi
+.LVL102:
+.LBB345:
+.LBI337:
+	.loc 1 256 16 is_stmt 1 view .LVU525
+.LBB340:
+	.loc 1 258 5 view .LVU526
+	.loc 1 258 13 is_stmt 0 view .LVU527
+	imulq	%rdx, %rbp
+.LVL103:
+	.loc 1 260 5 is_stmt 1 view .LVU528
+	.loc 1 260 47 is_stmt 0 view .LVU529
+	movq	%rbp, %rdx
+	.loc 1 260 21 view .LVU530
+	addq	240(%rbx), %rbp
+.LVL104:
+	.loc 1 260 47 view .LVU531
+	sarq	$63, %rdx
+.LVL105:
+	.loc 1 260 54 view .LVU532
+	andq	248(%rbx), %rdx
+	.loc 1 260 35 view .LVU533
+	addq	%rbp, %rdx
+	.loc 1 260 78 view .LVU534
+	sarq	%cl, %rdx
+.LVL106:
+	.loc 1 260 78 view .LVU535
+.LBE340:
+.LBE345:
+.LBB346:
+.LBI346:
+	.loc 1 174 16 is_stmt 1 view .LVU536
+.LBB347:
+	.loc 1 176 5 view .LVU537
+	.loc 1 176 5 is_stmt 0 view .LVU538
+	cmpq	%rdx, %rax
+	cmovg	%rdx, %rax
+	cmpq	%rdx, %rsi
+.LBE347:
+.LBE346:
+	.loc 1 426 12 view .LVU539
+	cmovg	%rsi, %rax
+	.loc 1 427 1 view .LVU540
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL107:
+	.loc 1 427 1 view .LVU541
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.cfi_restore_state
+	.loc 1 406 9 is_stmt 1 view .LVU542
+	.loc 1 406 27 is_stmt 0 view .LVU543
+	leaq	(%rbx,%rbx,8), %rax
+.LVL109:
+	.loc 1 406 27 view .LVU544
+	xorl	%r11d, %r11d
+	movq	$0, (%r9,%rax,8)
+	jmp	.L31
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+.LBB348:
+.LBB329:
+	.loc 1 370 9 is_stmt 1 view .LVU545
+.LBB325:
+.LBI325:
+	.loc 1 174 16 view .LVU546
+.LBB326:
+	.loc 1 176 5 view .LVU547
+	.loc 1 178 13 is_stmt 0 view .LVU548
+	movl	$1073741824, %eax
+.LBE326:
+.LBE325:
+	.loc 1 370 24 view .LVU549
+	leaq	32(%r9,%rdx), %rdi
+.LBB328:
+.LBB327:
+	.loc 1 178 13 view .LVU550
+	cmpq	%rax, %rsi
+	cmovg	%rax, %rsi
+.LVL111:
+	.loc 1 178 13 view .LVU551
+.LBE327:
+.LBE328:
+	.loc 1 370 24 view .LVU552
+	movq	$-1073741824, %rax
+	cmpq	%rax, %rsi
+	cmovl	%rax, %rsi
+	call	biquadFilterFixedApply@PLT
+.LVL112:
+	.loc 1 370 18 view .LVU553
+	leaq	(%rax,%rax,2), %rdx
+.LVL113:
+	.loc 1 372 9 is_stmt 1 view .LVU554
+	.loc 1 372 26 is_stmt 0 view .LVU555
+	leaq	536870912(%rdx), %rax
+	.loc 1 372 56 view .LVU556
+	shrq	$63, %rdx
+.LVL114:
+	.loc 1 372 44 view .LVU557
+	subq	%rdx, %rax
+.LVL115:
+	.loc 1 372 62 view .LVU558
+	sarq	$30, %rax
+	jmp	.L34
+.LBE329:
+.LBE348:
+	.cfi_endproc
+.LFE14:
+	.size	pidRateKernel, .-pidRateKernel
+	.section	.text.pidScaleInitFloat,"ax",@progbits
+	.p2align 4
+	.type	pidScaleInitFloat, @function
+pidScaleInitFloat:
+.LVL116:
+.LFB6:
+	.loc 1 218 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 219 5 view .LVU560
+	.loc 1 220 5 view .LVU561
+	.loc 1 218 1 is_stmt 0 view .LVU562
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 221 20 view .LVU563
+	movl	$24, %ebx
+	.loc 1 218 1 view .LVU564
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 220 22 view .LVU565
+	leaq	28(%rsp), %rdi
+.LVL117:
+	.loc 1 220 22 view .LVU566
+	movss	%xmm0, 12(%rsp)
+	call	frexpf@PLT
+.LVL118:
+	.loc 1 221 5 is_stmt 1 view .LVU567
+	.loc 1 223 14 is_stmt 0 view .LVU568
+	movss	12(%rsp), %xmm1
+	.loc 1 221 20 view .LVU569
+	subl	28(%rsp), %ebx
+	.loc 1 223 14 view .LVU570
+	pxor	%xmm2, %xmm2
+	.loc 1 221 9 view .LVU571
+	subl	%r12d, %ebx
+.LVL119:
+	.loc 1 223 5 is_stmt 1 view .LVU572
+	.loc 1 223 14 is_stmt 0 view .LVU573
+	movl	$0, %edx
+	ucomiss	%xmm2, %xmm1
+	setnp	%al
+	cmovne	%edx, %eax
+	.loc 1 223 8 view .LVU574
+	testb	%al, %al
+	jne	.L44
+	cmpl	$62, %ebx
+	jg	.L44
+	.loc 1 225 12 is_stmt 1 view .LVU575
+	.loc 1 225 15 is_stmt 0 view .LVU576
+	testl	%ebx, %ebx
+	js	.L49
+	.loc 1 228 9 is_stmt 1 view .LVU577
+	.loc 1 228 29 is_stmt 0 view .LVU578
+	movl	$24, %edi
+	call	ldexpf@PLT
+.LVL120:
+	.loc 1 228 29 view .LVU579
+	call	lrintf@PLT
+.LVL121:
+.LBB349:
+.LBI349:
+	.loc 1 184 13 is_stmt 1 view .LVU580
+.LBB350:
+	.loc 1 186 5 view .LVU581
+	.loc 1 188 5 view .LVU582
+	.loc 1 190 17 is_stmt 0 view .LVU583
+	pxor	%xmm0, %xmm0
+.LBE350:
+.LBE349:
+	.loc 1 228 9 view .LVU584
+	movb	%bl, 20(%rbp)
+	movl	%eax, 16(%rbp)
+.LBB352:
+.LBB351:
+	.loc 1 189 5 is_stmt 1 view .LVU585
+	.loc 1 190 5 view .LVU586
+	.loc 1 191 5 view .LVU587
+	.loc 1 190 17 is_stmt 0 view .LVU588
+	movups	%xmm0, 0(%rbp)
+	.loc 1 193 5 is_stmt 1 view .LVU589
+	.loc 1 195 12 view .LVU590
+	.loc 1 195 15 is_stmt 0 view .LVU591
+	testl	%ebx, %ebx
+	je	.L39
+	.loc 1 196 9 is_stmt 1 view .LVU592
+	.loc 1 186 35 is_stmt 0 view .LVU593
+	movl	%ebx, %ecx
+	movl	$1, %eax
+.LVL122:
+	.loc 1 197 29 view .LVU594
+	movq	$-1, 8(%rbp)
+	.loc 1 186 35 view .LVU595
+	salq	%cl, %rax
+	.loc 1 196 37 view .LVU596
+	sarq	%rax
+	movq	%rax, 0(%rbp)
+	.loc 1 197 9 is_stmt 1 view .LVU597
+.LVL123:
+	.loc 1 197 9 is_stmt 0 view .LVU598
+.LBE351:
+.LBE352:
+	.loc 1 230 1 view .LVU599
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL124:
+	.loc 1 230 1 view .LVU600
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL125:
+	.loc 1 230 1 view .LVU601
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL126:
+	.loc 1 230 1 view .LVU602
+	ret
+.LVL127:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.cfi_restore_state
+	.loc 1 224 9 is_stmt 1 view .LVU603
+.LBB353:
+.LBI353:
+	.loc 1 184 13 view .LVU604
+.LBB354:
+	.loc 1 186 5 view .LVU605
+	.loc 1 188 5 view .LVU606
+	.loc 1 188 17 is_stmt 0 view .LVU607
+	movl	$0, 16(%rbp)
+	.loc 1 189 5 is_stmt 1 view .LVU608
+	.loc 1 190 17 is_stmt 0 view .LVU609
+	pxor	%xmm0, %xmm0
+.LVL128:
+	.loc 1 189 18 view .LVU610
+	movb	$0, 20(%rbp)
+	.loc 1 190 5 is_stmt 1 view .LVU611
+	.loc 1 191 5 view .LVU612
+	.loc 1 190 17 is_stmt 0 view .LVU613
+	movups	%xmm0, 0(%rbp)
+	.loc 1 193 5 is_stmt 1 view .LVU614
+	.loc 1 195 12 view .LVU615
+.LVL129:
+.L39:
+	.loc 1 195 12 is_stmt 0 view .LVU616
+.LBE354:
+.LBE353:
+	.loc 1 230 1 view .LVU617
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL130:
+	.loc 1 230 1 view .LVU618
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL131:
+	.loc 1 230 1 view .LVU619
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL132:
+	.loc 1 230 1 view .LVU620
+	ret
+.LVL133:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+	.loc 1 226 9 is_stmt 1 view .LVU621
+	.loc 1 226 29 is_stmt 0 view .LVU622
+	leal	24(%rbx), %edi
+	call	ldexpf@PLT
+.LVL134:
+	.loc 1 226 29 view .LVU623
+	call	lrintf@PLT
+.LVL135:
+.LBB355:
+.LBI355:
+	.loc 1 184 13 is_stmt 1 view .LVU624
+.LBB356:
+	.loc 1 186 5 view .LVU625
+	.loc 1 188 5 view .LVU626
+	.loc 1 190 17 is_stmt 0 view .LVU627
+	pxor	%xmm0, %xmm0
+	.loc 1 189 18 view .LVU628
+	movb	$0, 20(%rbp)
+.LBE356:
+.LBE355:
+	.loc 1 226 9 view .LVU629
+	movl	%eax, 16(%rbp)
+.LBB358:
+.LBB357:
+	.loc 1 189 5 is_stmt 1 view .LVU630
+	.loc 1 190 5 view .LVU631
+	.loc 1 191 5 view .LVU632
+	.loc 1 190 17 is_stmt 0 view .LVU633
+	movups	%xmm0, 0(%rbp)
+	.loc 1 193 5 is_stmt 1 view .LVU634
+	.loc 1 195 12 view .LVU635
+.LBE357:
+.LBE358:
+	.loc 1 230 1 is_stmt 0 view .LVU636
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL136:
+	.loc 1 230 1 view .LVU637
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL137:
+	.loc 1 230 1 view .LVU638
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL138:
+	.loc 1 230 1 view .LVU639
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	pidScaleInitFloat, .-pidScaleInitFloat
+	.section	.text.pidBaseflight,"ax",@progbits
+	.p2align 4
+	.type	pidBaseflight, @function
+pidBaseflight:
+.LVL139:
+.LFB19:
+	.loc 1 548 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 548 1 is_stmt 0 view .LVU641
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%edx, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 176
+	.loc 1 548 1 view .LVU642
+	movq	%rsi, 24(%rsp)
+	movq	%rcx, 40(%rsp)
+	.loc 1 549 5 is_stmt 1 view .LVU643
+	.loc 1 550 5 view .LVU644
+	.loc 1 551 5 view .LVU645
+	.loc 1 552 5 view .LVU646
+	.loc 1 553 4 view .LVU647
+	.loc 1 553 26 is_stmt 0 view .LVU648
+	call	updateDTermFilter
+.LVL140:
+	.loc 1 553 26 view .LVU649
+	movl	%eax, %ebp
+.LVL141:
+	.loc 1 555 5 is_stmt 1 view .LVU650
+	.loc 1 555 9 is_stmt 0 view .LVU651
+	call	resolveAxisSetpoints
+.LVL142:
+	.loc 1 555 8 view .LVU652
+	testb	%al, %al
+	jne	.L51
+	.loc 1 558 5 is_stmt 1 view .LVU653
+.LVL143:
+.LBB402:
+.LBI402:
+	.loc 1 515 13 view .LVU654
+.LBB403:
+	.loc 1 517 5 view .LVU655
+	.loc 1 518 5 view .LVU656
+	.loc 1 519 5 view .LVU657
+	.loc 1 521 5 view .LVU658
+	movl	40(%rbx), %edx
+	.loc 1 524 31 is_stmt 0 view .LVU659
+	movq	68(%rbx), %xmm0
+	.loc 1 521 5 view .LVU660
+	movq	32(%rbx), %rax
+	.loc 1 523 5 view .LVU661
+	movq	56(%rbx), %rcx
+	.loc 1 521 5 view .LVU662
+	movl	%edx, 72(%rsp)
+	.loc 1 522 5 is_stmt 1 view .LVU663
+	movq	44(%rbx), %rdx
+	movaps	%xmm0, %xmm2
+	.loc 1 526 27 is_stmt 0 view .LVU664
+	movss	24+gyro(%rip), %xmm1
+	.loc 1 528 8 view .LVU665
+	cmpb	$0, baseflightGainsValid(%rip)
+	movlps	%xmm0, 8(%rsp)
+	.loc 1 522 5 view .LVU666
+	movq	%rdx, 76(%rsp)
+	movl	52(%rbx), %edx
+	.loc 1 521 5 view .LVU667
+	movq	%rax, 64(%rsp)
+	movl	12(%rsp), %r14d
+	.loc 1 522 5 view .LVU668
+	movl	%edx, 84(%rsp)
+	.loc 1 523 5 is_stmt 1 view .LVU669
+	movl	64(%rbx), %edx
+	movq	%rcx, 88(%rsp)
+	movl	%edx, 96(%rsp)
+	.loc 1 524 5 view .LVU670
+	.loc 1 525 5 view .LVU671
+	.loc 1 524 19 is_stmt 0 view .LVU672
+	movlps	%xmm0, 100(%rsp)
+	.loc 1 526 5 is_stmt 1 view .LVU673
+	.loc 1 526 21 is_stmt 0 view .LVU674
+	movss	%xmm1, 108(%rsp)
+	.loc 1 528 5 is_stmt 1 view .LVU675
+	.loc 1 528 8 is_stmt 0 view .LVU676
+	je	.L55
+	.loc 1 528 33 view .LVU677
+	movq	72(%rsp), %rdx
+	xorq	baseflightGainsConverted(%rip), %rax
+	xorq	8+baseflightGainsConverted(%rip), %rdx
+	orq	%rax, %rdx
+	je	.L76
+.L55:
+	leaq	936+rateKernels(%rip), %r13
+.L53:
+	leaq	64(%rsp), %r12
+	movb	%bpl, 35(%rsp)
+	leaq	rateKernels(%rip), %rbx
+.LVL144:
+	.loc 1 528 33 view .LVU678
+	movq	%r12, 16(%rsp)
+	movq	%r12, %rbp
+.LVL145:
+	.loc 1 528 33 view .LVU679
+	movss	%xmm1, 8(%rsp)
+	movss	%xmm2, 36(%rsp)
+.L58:
+.LVL146:
+	.loc 1 533 9 is_stmt 1 view .LVU680
+	.loc 1 534 9 view .LVU681
+	movss	8(%rsp), %xmm0
+	movq	%rbx, %rdi
+	movl	$24, %esi
+	.loc 1 532 25 is_stmt 0 view .LVU682
+	addq	$4, %rbp
+	.loc 1 534 9 view .LVU683
+	call	pidScaleInitFloat
+.LVL147:
+	.loc 1 535 9 is_stmt 1 view .LVU684
+	movss	-4(%rbp), %xmm0
+	leaq	24(%rbx), %rdi
+	xorl	%esi, %esi
+	call	pidScaleInitFloat
+.LVL148:
+	.loc 1 536 9 view .LVU685
+	movss	8(%rbp), %xmm0
+	leaq	48(%rbx), %rdi
+	xorl	%esi, %esi
+	call	pidScaleInitFloat
+.LVL149:
+	.loc 1 537 9 view .LVU686
+	movss	20(%rbp), %xmm0
+	movl	$4, %esi
+	leaq	168(%rbx), %rdi
+	.loc 1 532 25 is_stmt 0 view .LVU687
+	addq	$312, %rbx
+.LVL150:
+	.loc 1 537 9 view .LVU688
+	call	pidScaleInitFloat
+.LVL151:
+	.loc 1 532 34 is_stmt 1 view .LVU689
+	.loc 1 532 25 view .LVU690
+	cmpq	%rbx, %r13
+	jne	.L58
+	.loc 1 539 5 is_stmt 0 view .LVU691
+	movss	36(%rsp), %xmm2
+	.loc 1 539 5 is_stmt 1 view .LVU692
+	xorl	%esi, %esi
+	movzbl	35(%rsp), %ebp
+	leaq	baseflightALevel(%rip), %rdi
+	movaps	%xmm2, %xmm0
+	call	pidScaleInitFloat
+.LVL152:
+	.loc 1 540 5 view .LVU693
+	xorl	%esi, %esi
+	movd	%r14d, %xmm0
+	leaq	baseflightHLevel(%rip), %rdi
+	call	pidScaleInitFloat
+.LVL153:
+	.loc 1 542 5 view .LVU694
+	.loc 1 542 30 is_stmt 0 view .LVU695
+	movdqa	64(%rsp), %xmm7
+	movdqa	80(%rsp), %xmm3
+	.loc 1 543 26 view .LVU696
+	movb	$1, baseflightGainsValid(%rip)
+	.loc 1 542 30 view .LVU697
+	movdqa	96(%rsp), %xmm4
+	movaps	%xmm7, baseflightGainsConverted(%rip)
+	movaps	%xmm3, 16+baseflightGainsConverted(%rip)
+	movaps	%xmm4, 32+baseflightGainsConverted(%rip)
+	.loc 1 543 5 is_stmt 1 view .LVU698
+.LVL154:
+.L57:
+	.loc 1 543 5 is_stmt 0 view .LVU699
+.LBE403:
+.LBE402:
+	.loc 1 560 5 is_stmt 1 view .LVU700
+	movzwl	cycleTime(%rip), %edx
+	movq	%rdx, %rsi
+.LVL155:
+.LBB412:
+.LBI412:
+	.loc 1 247 13 view .LVU701
+.LBB413:
+	.loc 1 250 5 view .LVU702
+.LBB414:
+.LBI414:
+	.loc 1 232 16 view .LVU703
+.LBB415:
+	.loc 1 234 5 view .LVU704
+	.loc 1 236 5 view .LVU705
+	.loc 1 236 12 view .LVU706
+	testl	%edx, %edx
+	je	.L67
+	movl	%edx, %eax
+	.loc 1 234 13 is_stmt 0 view .LVU707
+	xorl	%ebx, %ebx
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.loc 1 237 9 is_stmt 1 view .LVU708
+	.loc 1 237 15 is_stmt 0 view .LVU709
+	addl	$1, %ebx
+.LVL157:
+	.loc 1 238 9 is_stmt 1 view .LVU710
+	.loc 1 236 12 view .LVU711
+	shrl	%eax
+.LVL158:
+	.loc 1 236 12 is_stmt 0 view .LVU712
+	jne	.L60
+.LBE415:
+.LBE414:
+	.loc 1 250 28 view .LVU713
+	movzbl	%bl, %ebx
+	.loc 1 250 26 view .LVU714
+	addl	$26, %ebx
+.LVL159:
+.L59:
+.LBB418:
+.LBB416:
+	.loc 1 240 5 is_stmt 1 view .LVU715
+.LBE416:
+.LBE418:
+	.loc 1 250 9 is_stmt 0 view .LVU716
+	leal	-21(%rbx), %ecx
+.LVL160:
+	.loc 1 252 5 is_stmt 1 view .LVU717
+	.loc 1 252 47 is_stmt 0 view .LVU718
+	movl	$1000000, %eax
+	.loc 1 252 71 view .LVU719
+	shrl	%edx
+.LVL161:
+	.loc 1 252 47 view .LVU720
+	salq	%cl, %rax
+	.loc 1 252 57 view .LVU721
+	addq	%rdx, %rax
+	.loc 1 252 76 view .LVU722
+	xorl	%edx, %edx
+	divq	%rsi
+	.loc 1 252 5 view .LVU723
+	movl	%eax, 36(%rsp)
+.LVL162:
+.LBB419:
+.LBI419:
+	.loc 1 184 13 is_stmt 1 view .LVU724
+.LBB420:
+	.loc 1 186 5 view .LVU725
+	.loc 1 188 5 view .LVU726
+	.loc 1 189 5 view .LVU727
+	.loc 1 190 5 view .LVU728
+	.loc 1 191 5 view .LVU729
+	.loc 1 193 5 view .LVU730
+	.loc 1 195 12 view .LVU731
+	.loc 1 195 15 is_stmt 0 view .LVU732
+	subb	$13, %bl
+.LVL163:
+	.loc 1 195 15 view .LVU733
+	je	.L68
+	.loc 1 196 9 is_stmt 1 view .LVU734
+	.loc 1 186 35 is_stmt 0 view .LVU735
+	movl	$1, %edx
+	movl	%ebx, %ecx
+.LVL164:
+	.loc 1 197 29 view .LVU736
+	movq	$-1, %r9
+	.loc 1 186 35 view .LVU737
+	salq	%cl, %rdx
+	.loc 1 196 37 view .LVU738
+	movq	%rdx, %rsi
+.LVL165:
+	.loc 1 196 37 view .LVU739
+	shrq	$63, %rsi
+	addq	%rdx, %rsi
+	sarq	%rsi
+.LVL166:
+	.loc 1 197 9 is_stmt 1 view .LVU740
+.L61:
+	.loc 1 197 9 is_stmt 0 view .LVU741
+.LBE420:
+.LBE419:
+.LBE413:
+.LBE412:
+	.loc 1 562 5 is_stmt 1 view .LVU742
+	.loc 1 563 22 is_stmt 0 view .LVU743
+	movl	$1, %edx
+.LBB426:
+	.loc 1 607 25 view .LVU744
+	xorl	%r14d, %r14d
+	movzbl	%bpl, %edi
+	movb	%bl, 35(%rsp)
+	leaq	rateKernels(%rip), %r13
+	movq	%r14, %rbx
+.LVL167:
+	.loc 1 607 25 view .LVU745
+	movl	%edi, 8(%rsp)
+.LBE426:
+	.loc 1 566 15 view .LVU746
+	xorl	%ebp, %ebp
+	leaq	axisSetpoints(%rip), %r12
+	movq	%r13, %r14
+	.loc 1 562 5 view .LVU747
+	pxor	%xmm0, %xmm0
+	movq	%rax, 56(%rsp)
+	movq	%r12, %r13
+	movq	%rsi, %r12
+	movaps	%xmm0, 64(%rsp)
+	movq	$0, 80(%rsp)
+	.loc 1 563 5 is_stmt 1 view .LVU748
+.LBB465:
+	.loc 1 574 25 is_stmt 0 view .LVU749
+	movzbl	0(%r13), %esi
+.LVL168:
+	.loc 1 574 25 view .LVU750
+.LBE465:
+	.loc 1 563 22 view .LVU751
+	movw	%dx, 86(%rsp)
+	.loc 1 566 5 is_stmt 1 view .LVU752
+.LVL169:
+	.loc 1 566 25 view .LVU753
+.LBB466:
+	.loc 1 568 9 view .LVU754
+	.loc 1 570 9 view .LVU755
+	.loc 1 576 39 is_stmt 0 view .LVU756
+	movzwl	%r15w, %edx
+	movq	%r9, %r15
+.LVL170:
+.LBB427:
+.LBB428:
+	.loc 1 350 12 view .LVU757
+	movl	%edx, %edi
+	movl	%edx, 52(%rsp)
+.LVL171:
+	.loc 1 350 12 view .LVU758
+.LBE428:
+.LBE427:
+	.loc 1 574 13 is_stmt 1 view .LVU759
+.LBB434:
+.LBB429:
+	.loc 1 350 12 is_stmt 0 view .LVU760
+	negl	%edi
+	movl	%edi, 48(%rsp)
+.LBE429:
+.LBE434:
+	.loc 1 574 16 view .LVU761
+	testb	%sil, %sil
+	jne	.L63
+.LVL172:
+.L77:
+	.loc 1 574 57 discriminator 1 view .LVU762
+	cmpb	$0, 1(%r13)
+	jne	.L63
+	.loc 1 585 28 view .LVU763
+	xorl	%edx, %edx
+.L64:
+.LVL173:
+	.loc 1 593 17 is_stmt 1 view .LVU764
+.LBB435:
+.LBI435:
+	.loc 1 256 16 view .LVU765
+.LBB436:
+	.loc 1 258 5 view .LVU766
+.LBE436:
+.LBE435:
+	.loc 1 593 70 is_stmt 0 view .LVU767
+	movq	24(%rsp), %rax
+	.loc 1 593 103 view .LVU768
+	leaq	rcCommand(%rip), %rdi
+	movswl	(%rdi,%rbx), %ecx
+	.loc 1 593 70 view .LVU769
+	movzbl	4(%rax), %eax
+	.loc 1 593 43 view .LVU770
+	addl	$20, %eax
+	.loc 1 593 92 view .LVU771
+	imull	%ecx, %eax
+.LBB439:
+.LBB437:
+	.loc 1 258 36 view .LVU772
+	movslq	16+baseflightStickScale(%rip), %rcx
+.LBE437:
+.LBE439:
+	.loc 1 593 34 view .LVU773
+	cltq
+.LBB440:
+.LBB438:
+	.loc 1 258 13 view .LVU774
+	imulq	%rcx, %rax
+.LVL174:
+	.loc 1 260 5 is_stmt 1 view .LVU775
+	.loc 1 260 47 is_stmt 0 view .LVU776
+	movq	%rax, %rcx
+	.loc 1 260 21 view .LVU777
+	addq	baseflightStickScale(%rip), %rax
+.LVL175:
+	.loc 1 260 47 view .LVU778
+	sarq	$63, %rcx
+.LVL176:
+	.loc 1 260 54 view .LVU779
+	andq	8+baseflightStickScale(%rip), %rcx
+	.loc 1 260 35 view .LVU780
+	addq	%rcx, %rax
+	.loc 1 260 86 view .LVU781
+	movzbl	20+baseflightStickScale(%rip), %ecx
+	.loc 1 260 78 view .LVU782
+	sarq	%cl, %rax
+.LVL177:
+	.loc 1 260 78 view .LVU783
+.LBE438:
+.LBE440:
+	.loc 1 593 32 view .LVU784
+	movq	%rax, 64(%rsp)
+	.loc 1 595 17 is_stmt 1 view .LVU785
+	.loc 1 595 20 is_stmt 0 view .LVU786
+	cmpb	$2, %sil
+	jne	.L65
+	.loc 1 597 21 is_stmt 1 view .LVU787
+.LVL178:
+.LBB441:
+.LBI441:
+	.loc 1 256 16 view .LVU788
+.LBB442:
+	.loc 1 258 5 view .LVU789
+	.loc 1 258 36 is_stmt 0 view .LVU790
+	movslq	16+baseflightHLevel(%rip), %rcx
+	.loc 1 258 13 view .LVU791
+	imulq	%rdx, %rcx
+.LVL179:
+	.loc 1 260 5 is_stmt 1 view .LVU792
+	.loc 1 260 47 is_stmt 0 view .LVU793
+	movq	%rcx, %rdx
+.LVL180:
+	.loc 1 260 21 view .LVU794
+	addq	baseflightHLevel(%rip), %rcx
+	.loc 1 260 47 view .LVU795
+	sarq	$63, %rdx
+	.loc 1 260 54 view .LVU796
+	andq	8+baseflightHLevel(%rip), %rdx
+	.loc 1 260 35 view .LVU797
+	addq	%rcx, %rdx
+	.loc 1 260 86 view .LVU798
+	movzbl	20+baseflightHLevel(%rip), %ecx
+	.loc 1 260 78 view .LVU799
+	sarq	%cl, %rdx
+.LBE442:
+.LBE441:
+	.loc 1 597 36 view .LVU800
+	addq	%rax, %rdx
+	movq	%rdx, 64(%rsp)
+.LVL181:
+.L65:
+	.loc 1 604 9 is_stmt 1 discriminator 2 view .LVU801
+	.loc 1 607 25 is_stmt 0 discriminator 2 view .LVU802
+	movl	8(%rsp), %edx
+	movq	16(%rsp), %rsi
+	movl	%ebp, %edi
+.LBE466:
+	.loc 1 566 25 discriminator 2 view .LVU803
+	addq	$2, %r13
+.LBB467:
+	.loc 1 604 50 discriminator 2 view .LVU804
+	movzwl	cycleTime(%rip), %eax
+	.loc 1 605 40 discriminator 2 view .LVU805
+	movq	%r12, 144(%r14)
+.LBE467:
+	.loc 1 566 25 discriminator 2 view .LVU806
+	addq	$312, %r14
+.LBB468:
+	.loc 1 605 40 discriminator 2 view .LVU807
+	movq	%r15, -160(%r14)
+	.loc 1 604 50 discriminator 2 view .LVU808
+	movl	%eax, -224(%r14)
+	.loc 1 605 9 is_stmt 1 discriminator 2 view .LVU809
+	.loc 1 605 40 is_stmt 0 discriminator 2 view .LVU810
+	movl	36(%rsp), %eax
+	movl	%eax, -152(%r14)
+	movzbl	35(%rsp), %eax
+	movb	%al, -148(%r14)
+	.loc 1 607 9 is_stmt 1 discriminator 2 view .LVU811
+	.loc 1 607 25 is_stmt 0 discriminator 2 view .LVU812
+	call	pidRateKernel
+.LVL182:
+	.loc 1 607 23 discriminator 2 view .LVU813
+	leaq	axisPID(%rip), %rdi
+	movw	%ax, (%rdi,%rbx)
+.LBE468:
+	.loc 1 566 34 is_stmt 1 discriminator 2 view .LVU814
+.LVL183:
+	.loc 1 566 25 discriminator 2 view .LVU815
+	addq	$2, %rbx
+.LBB469:
+	.loc 1 568 9 discriminator 2 view .LVU816
+.LVL184:
+	.loc 1 570 9 discriminator 2 view .LVU817
+	.loc 1 570 12 is_stmt 0 discriminator 2 view .LVU818
+	cmpl	$1, %ebp
+	je	.L66
+	.loc 1 574 25 view .LVU819
+	movzbl	0(%r13), %esi
+.LBE469:
+	.loc 1 566 34 view .LVU820
+	movl	$1, %ebp
+.LVL185:
+.LBB470:
+	.loc 1 574 13 is_stmt 1 view .LVU821
+	.loc 1 574 16 is_stmt 0 view .LVU822
+	testb	%sil, %sil
+	je	.L77
+.LVL186:
+.L63:
+	.loc 1 576 17 is_stmt 1 view .LVU823
+.LBB443:
+.LBI427:
+	.loc 1 342 16 view .LVU824
+.LBB430:
+	.loc 1 344 5 view .LVU825
+	.loc 1 350 5 view .LVU826
+	.loc 1 344 43 is_stmt 0 view .LVU827
+	leaq	rcCommand(%rip), %rax
+	.loc 1 350 12 view .LVU828
+	movl	52(%rsp), %edx
+	movl	48(%rsp), %esi
+	.loc 1 344 43 view .LVU829
+	movswl	(%rax,%rbx), %edi
+.LVL187:
+	.loc 1 350 12 view .LVU830
+	call	constrain@PLT
+.LVL188:
+	.loc 1 350 12 view .LVU831
+.LBE430:
+.LBE443:
+.LBB444:
+.LBI444:
+	.loc 1 256 16 is_stmt 1 view .LVU832
+.LBB445:
+	.loc 1 258 5 view .LVU833
+.LBE445:
+.LBE444:
+.LBB449:
+.LBB431:
+	.loc 1 351 30 is_stmt 0 view .LVU834
+	leaq	inclination(%rip), %rsi
+.LBE431:
+.LBE449:
+.LBB450:
+.LBB446:
+	.loc 1 260 86 view .LVU835
+	movzbl	20+baseflightAngleScale(%rip), %ecx
+.LBE446:
+.LBE450:
+.LBB451:
+.LBB432:
+	.loc 1 351 30 view .LVU836
+	movswl	(%rsi,%rbx), %edx
+	.loc 1 351 53 view .LVU837
+	movq	40(%rsp), %rsi
+	.loc 1 351 13 view .LVU838
+	subl	%edx, %eax
+.LVL189:
+	.loc 1 351 53 view .LVU839
+	movswl	(%rsi,%rbx), %edx
+.LBE432:
+.LBE451:
+	.loc 1 588 25 view .LVU840
+	movzbl	0(%r13), %esi
+.LBB452:
+.LBB433:
+	.loc 1 351 37 view .LVU841
+	addl	%edx, %eax
+.LBE433:
+.LBE452:
+.LBB453:
+.LBB447:
+	.loc 1 258 36 view .LVU842
+	movslq	16+baseflightAngleScale(%rip), %rdx
+.LBE447:
+.LBE453:
+	.loc 1 576 30 view .LVU843
+	cltq
+.LBB454:
+.LBB448:
+	.loc 1 258 13 view .LVU844
+	imulq	%rdx, %rax
+.LVL190:
+	.loc 1 260 5 is_stmt 1 view .LVU845
+	.loc 1 260 47 is_stmt 0 view .LVU846
+	cqto
+	.loc 1 260 21 view .LVU847
+	addq	baseflightAngleScale(%rip), %rax
+.LVL191:
+	.loc 1 260 54 view .LVU848
+	andq	8+baseflightAngleScale(%rip), %rdx
+	.loc 1 260 35 view .LVU849
+	addq	%rax, %rdx
+	.loc 1 260 78 view .LVU850
+	sarq	%cl, %rdx
+.LVL192:
+	.loc 1 260 78 view .LVU851
+.LBE448:
+.LBE454:
+	.loc 1 588 13 is_stmt 1 view .LVU852
+	.loc 1 588 16 is_stmt 0 view .LVU853
+	cmpb	$1, %sil
+	jne	.L64
+	.loc 1 590 17 is_stmt 1 view .LVU854
+.LVL193:
+.LBB455:
+.LBI455:
+	.loc 1 256 16 view .LVU855
+.LBB456:
+	.loc 1 258 5 view .LVU856
+	.loc 1 258 36 is_stmt 0 view .LVU857
+	movslq	16+baseflightALevel(%rip), %rax
+	.loc 1 260 86 view .LVU858
+	movzbl	20+baseflightALevel(%rip), %ecx
+	.loc 1 258 13 view .LVU859
+	imulq	%rax, %rdx
+.LVL194:
+	.loc 1 260 5 is_stmt 1 view .LVU860
+	.loc 1 260 47 is_stmt 0 view .LVU861
+	movq	%rdx, %rax
+	.loc 1 260 21 view .LVU862
+	addq	baseflightALevel(%rip), %rdx
+	.loc 1 260 47 view .LVU863
+	sarq	$63, %rax
+	.loc 1 260 54 view .LVU864
+	andq	8+baseflightALevel(%rip), %rax
+	.loc 1 260 35 view .LVU865
+	addq	%rdx, %rax
+	.loc 1 260 78 view .LVU866
+	sarq	%cl, %rax
+	movq	%rax, 64(%rsp)
+.LBE456:
+.LBE455:
+	jmp	.L65
+.LVL195:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.loc 1 572 66 view .LVU867
+	movq	24(%rsp), %rcx
+	movzbl	35(%rsp), %ebx
+	.loc 1 607 25 view .LVU868
+	movl	$2, %edi
+	.loc 1 572 93 view .LVU869
+	movswl	4+rcCommand(%rip), %r8d
+	.loc 1 572 66 view .LVU870
+	movq	56(%rsp), %rax
+	.loc 1 572 13 is_stmt 1 view .LVU871
+.LVL196:
+.LBB457:
+.LBI457:
+	.loc 1 256 16 view .LVU872
+.LBB458:
+	.loc 1 258 5 view .LVU873
+.LBE458:
+.LBE457:
+	.loc 1 572 66 is_stmt 0 view .LVU874
+	movzbl	5(%rcx), %ecx
+.LVL197:
+	.loc 1 607 25 view .LVU875
+	movl	8(%rsp), %edx
+	.loc 1 605 40 view .LVU876
+	movq	%r12, 768+rateKernels(%rip)
+.LVL198:
+	.loc 1 607 25 view .LVU877
+	movq	16(%rsp), %rsi
+	.loc 1 605 40 view .LVU878
+	movq	%r15, 776+rateKernels(%rip)
+	.loc 1 572 39 view .LVU879
+	addl	$10, %ecx
+.LVL199:
+	.loc 1 605 40 view .LVU880
+	movb	%bl, 788+rateKernels(%rip)
+	.loc 1 572 82 view .LVU881
+	imull	%r8d, %ecx
+.LVL200:
+.LBB462:
+.LBB459:
+	.loc 1 258 36 view .LVU882
+	movslq	16+baseflightStickScale(%rip), %r8
+.LBE459:
+.LBE462:
+	.loc 1 605 40 view .LVU883
+	movl	%eax, 784+rateKernels(%rip)
+	.loc 1 572 30 view .LVU884
+	movslq	%ecx, %rcx
+.LBB463:
+.LBB460:
+	.loc 1 258 13 view .LVU885
+	imulq	%r8, %rcx
+.LVL201:
+	.loc 1 260 5 is_stmt 1 view .LVU886
+	.loc 1 260 47 is_stmt 0 view .LVU887
+	movq	%rcx, %r8
+	.loc 1 260 21 view .LVU888
+	addq	baseflightStickScale(%rip), %rcx
+	.loc 1 260 47 view .LVU889
+	sarq	$63, %r8
+	.loc 1 260 54 view .LVU890
+	andq	8+baseflightStickScale(%rip), %r8
+	.loc 1 260 35 view .LVU891
+	addq	%rcx, %r8
+	.loc 1 260 86 view .LVU892
+	movzbl	20+baseflightStickScale(%rip), %ecx
+	.loc 1 260 78 view .LVU893
+	sarq	%cl, %r8
+.LBE460:
+.LBE463:
+	.loc 1 604 50 view .LVU894
+	movzwl	cycleTime(%rip), %ecx
+.LBB464:
+.LBB461:
+	.loc 1 260 78 view .LVU895
+	movq	%r8, 64(%rsp)
+.LBE461:
+.LBE464:
+	.loc 1 604 9 is_stmt 1 view .LVU896
+	.loc 1 604 50 is_stmt 0 view .LVU897
+	movl	%ecx, 712+rateKernels(%rip)
+	.loc 1 605 9 is_stmt 1 view .LVU898
+	.loc 1 607 9 view .LVU899
+	.loc 1 607 25 is_stmt 0 view .LVU900
+	call	pidRateKernel
+.LVL202:
+	.loc 1 607 23 view .LVU901
+	movw	%ax, 4+axisPID(%rip)
+.LBE470:
+	.loc 1 566 34 is_stmt 1 view .LVU902
+.LVL203:
+	.loc 1 566 25 view .LVU903
+	.loc 1 609 1 is_stmt 0 view .LVU904
+	addq	$120, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL204:
+	.loc 1 609 1 view .LVU905
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL205:
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	.cfi_restore_state
+.LBB471:
+.LBB424:
+.LBB422:
+.LBB421:
+	.loc 1 191 25 view .LVU906
+	xorl	%r9d, %r9d
+	.loc 1 190 17 view .LVU907
+	xorl	%esi, %esi
+.LVL206:
+	.loc 1 190 17 view .LVU908
+	jmp	.L61
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.loc 1 190 17 view .LVU909
+.LBE421:
+.LBE422:
+.LBE424:
+.LBE471:
+.LBB472:
+.LBB404:
+	.loc 1 528 33 view .LVU910
+	movq	80(%rsp), %rax
+	xorq	24+baseflightGainsConverted(%rip), %rcx
+	xorq	16+baseflightGainsConverted(%rip), %rax
+	orq	%rax, %rcx
+	jne	.L55
+	movq	104(%rsp), %rax
+	movq	96(%rsp), %rdx
+	xorq	40+baseflightGainsConverted(%rip), %rax
+	xorq	32+baseflightGainsConverted(%rip), %rdx
+	orq	%rdx, %rax
+	jne	.L55
+	leaq	64(%rsp), %rax
+	movq	%rax, 16(%rsp)
+	jmp	.L57
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.loc 1 528 33 view .LVU911
+	leaq	rateKernels(%rip), %rdx
+	movdqa	.LC4(%rip), %xmm6
+	movdqa	.LC5(%rip), %xmm5
+	movdqa	.LC6(%rip), %xmm4
+	movdqa	.LC7(%rip), %xmm3
+	leaq	936(%rdx), %r13
+	movdqa	.LC8(%rip), %xmm2
+	movdqa	.LC9(%rip), %xmm1
+.L54:
+.LVL209:
+	.loc 1 528 33 view .LVU912
+.LBE404:
+.LBE472:
+.LBB473:
+.LBB474:
+	.loc 1 490 9 is_stmt 1 view .LVU913
+	.loc 1 491 9 view .LVU914
+	movq	%rdx, %rdi
+	.loc 1 489 25 is_stmt 0 view .LVU915
+	addq	$312, %rdx
+.LVL210:
+	.loc 1 491 9 view .LVU916
+	call	initIntegerRateKernel
+.LVL211:
+	.loc 1 496 9 is_stmt 1 view .LVU917
+.LBB475:
+.LBI475:
+	.loc 1 184 13 view .LVU918
+.LBB476:
+	.loc 1 186 5 view .LVU919
+	.loc 1 188 5 view .LVU920
+	.loc 1 189 18 is_stmt 0 view .LVU921
+	movb	$21, -196(%rdx)
+	.loc 1 188 17 view .LVU922
+	movl	$1, -200(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU923
+	.loc 1 190 5 view .LVU924
+	.loc 1 191 5 view .LVU925
+	.loc 1 193 5 view .LVU926
+	.loc 1 195 12 view .LVU927
+	.loc 1 196 9 view .LVU928
+	.loc 1 197 9 view .LVU929
+	.loc 1 196 21 is_stmt 0 view .LVU930
+	movups	%xmm6, -216(%rdx)
+.LVL212:
+	.loc 1 196 21 view .LVU931
+.LBE476:
+.LBE475:
+	.loc 1 497 9 is_stmt 1 view .LVU932
+.LBB477:
+.LBI477:
+	.loc 1 184 13 view .LVU933
+.LBB478:
+	.loc 1 186 5 view .LVU934
+	.loc 1 188 5 view .LVU935
+	.loc 1 188 17 is_stmt 0 view .LVU936
+	movl	$1125899907, -176(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU937
+	.loc 1 189 18 is_stmt 0 view .LVU938
+	movb	$29, -172(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU939
+	.loc 1 191 5 view .LVU940
+	.loc 1 193 5 view .LVU941
+	.loc 1 195 12 view .LVU942
+	.loc 1 196 9 view .LVU943
+	.loc 1 197 9 view .LVU944
+	.loc 1 196 21 is_stmt 0 view .LVU945
+	movups	%xmm5, -192(%rdx)
+.LVL213:
+	.loc 1 196 21 view .LVU946
+.LBE478:
+.LBE477:
+	.loc 1 499 9 is_stmt 1 view .LVU947
+.LBB479:
+.LBI479:
+	.loc 1 184 13 view .LVU948
+.LBB480:
+	.loc 1 186 5 view .LVU949
+	.loc 1 188 5 view .LVU950
+	.loc 1 188 17 is_stmt 0 view .LVU951
+	movl	$-1431655766, -104(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU952
+	.loc 1 189 18 is_stmt 0 view .LVU953
+	movb	$28, -100(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU954
+	.loc 1 191 5 view .LVU955
+	.loc 1 193 5 view .LVU956
+	.loc 1 195 12 view .LVU957
+	.loc 1 196 9 view .LVU958
+	.loc 1 197 9 view .LVU959
+	.loc 1 196 21 is_stmt 0 view .LVU960
+	movups	%xmm4, -120(%rdx)
+.LVL214:
+	.loc 1 196 21 view .LVU961
+.LBE480:
+.LBE479:
+	.loc 1 500 9 is_stmt 1 view .LVU962
+.LBB481:
+.LBI481:
+	.loc 1 184 13 view .LVU963
+.LBB482:
+	.loc 1 186 5 view .LVU964
+	.loc 1 188 5 view .LVU965
+	.loc 1 188 17 is_stmt 0 view .LVU966
+	movl	$1, -56(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU967
+	.loc 1 189 18 is_stmt 0 view .LVU968
+	movb	$24, -52(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU969
+	.loc 1 191 5 view .LVU970
+	.loc 1 193 5 view .LVU971
+	.loc 1 195 12 view .LVU972
+	.loc 1 196 9 view .LVU973
+	.loc 1 197 9 view .LVU974
+	.loc 1 196 21 is_stmt 0 view .LVU975
+	movups	%xmm3, -72(%rdx)
+.LVL215:
+	.loc 1 196 21 view .LVU976
+.LBE482:
+.LBE481:
+	.loc 1 501 9 is_stmt 1 view .LVU977
+	.loc 1 502 9 view .LVU978
+	.loc 1 503 9 view .LVU979
+	.loc 1 504 9 view .LVU980
+	.loc 1 501 37 is_stmt 0 view .LVU981
+	movups	%xmm2, -48(%rdx)
+	movups	%xmm1, -32(%rdx)
+	.loc 1 505 9 is_stmt 1 view .LVU982
+	.loc 1 505 29 is_stmt 0 view .LVU983
+	movl	$1000, -16(%rdx)
+	.loc 1 506 9 is_stmt 1 view .LVU984
+	.loc 1 506 36 is_stmt 0 view .LVU985
+	movb	$1, -2(%rdx)
+	.loc 1 489 34 is_stmt 1 view .LVU986
+.LVL216:
+	.loc 1 489 25 view .LVU987
+	cmpq	%r13, %rdx
+	jne	.L54
+	.loc 1 509 5 view .LVU988
+.LVL217:
+.LBB483:
+.LBI483:
+	.loc 1 184 13 view .LVU989
+.LBB484:
+	.loc 1 186 5 view .LVU990
+	.loc 1 188 5 view .LVU991
+.LBE484:
+.LBE483:
+.LBE474:
+.LBE473:
+.LBB505:
+.LBB405:
+	.loc 1 521 5 is_stmt 0 view .LVU992
+	movq	32(%rbx), %rax
+.LBE405:
+.LBE505:
+.LBB506:
+.LBB499:
+.LBB488:
+.LBB485:
+	.loc 1 196 21 view .LVU993
+	movdqa	.LC10(%rip), %xmm0
+	.loc 1 188 17 view .LVU994
+	movl	$1374389535, 16+baseflightStickScale(%rip)
+	.loc 1 189 5 is_stmt 1 view .LVU995
+.LBE485:
+.LBE488:
+.LBE499:
+.LBE506:
+.LBB507:
+.LBB406:
+	.loc 1 526 27 is_stmt 0 view .LVU996
+	movss	24+gyro(%rip), %xmm1
+.LBE406:
+.LBE507:
+.LBB508:
+.LBB500:
+.LBB489:
+.LBB486:
+	.loc 1 189 18 view .LVU997
+	movb	$12, 20+baseflightStickScale(%rip)
+	.loc 1 190 5 is_stmt 1 view .LVU998
+	.loc 1 191 5 view .LVU999
+	.loc 1 193 5 view .LVU1000
+	.loc 1 195 12 view .LVU1001
+	.loc 1 196 9 view .LVU1002
+	.loc 1 197 9 view .LVU1003
+.LBE486:
+.LBE489:
+.LBE500:
+.LBE508:
+.LBB509:
+.LBB407:
+	.loc 1 521 5 is_stmt 0 view .LVU1004
+	movq	%rax, 64(%rsp)
+	movl	40(%rbx), %eax
+.LBE407:
+.LBE509:
+.LBB510:
+.LBB501:
+.LBB490:
+.LBB487:
+	.loc 1 196 21 view .LVU1005
+	movaps	%xmm0, baseflightStickScale(%rip)
+.LVL218:
+	.loc 1 196 21 view .LVU1006
+.LBE487:
+.LBE490:
+	.loc 1 510 5 is_stmt 1 view .LVU1007
+.LBB491:
+.LBI491:
+	.loc 1 184 13 view .LVU1008
+.LBB492:
+	.loc 1 186 5 view .LVU1009
+	.loc 1 188 5 view .LVU1010
+	.loc 1 196 21 is_stmt 0 view .LVU1011
+	movdqa	.LC11(%rip), %xmm0
+.LBE492:
+.LBE491:
+.LBE501:
+.LBE510:
+.LBB511:
+.LBB408:
+	.loc 1 521 5 view .LVU1012
+	movl	%eax, 72(%rsp)
+	.loc 1 522 5 view .LVU1013
+	movq	44(%rbx), %rax
+.LBE408:
+.LBE511:
+.LBB512:
+.LBB502:
+.LBB496:
+.LBB493:
+	.loc 1 196 21 view .LVU1014
+	movaps	%xmm0, baseflightAngleScale(%rip)
+.LBE493:
+.LBE496:
+.LBE502:
+.LBE512:
+.LBB513:
+.LBB409:
+	.loc 1 524 31 view .LVU1015
+	movq	68(%rbx), %xmm0
+	.loc 1 522 5 view .LVU1016
+	movq	%rax, 76(%rsp)
+	movl	52(%rbx), %eax
+	movlps	%xmm0, 8(%rsp)
+	movaps	%xmm0, %xmm2
+	movl	12(%rsp), %r14d
+	movl	%eax, 84(%rsp)
+	.loc 1 523 5 view .LVU1017
+	movq	56(%rbx), %rax
+.LBE409:
+.LBE513:
+.LBB514:
+.LBB503:
+.LBB497:
+.LBB494:
+	.loc 1 188 17 view .LVU1018
+	movl	$214748365, 16+baseflightAngleScale(%rip)
+	.loc 1 189 5 is_stmt 1 view .LVU1019
+.LBE494:
+.LBE497:
+.LBE503:
+.LBE514:
+.LBB515:
+.LBB410:
+	.loc 1 523 5 is_stmt 0 view .LVU1020
+	movq	%rax, 88(%rsp)
+	movl	64(%rbx), %eax
+.LBE410:
+.LBE515:
+.LBB516:
+.LBB504:
+.LBB498:
+.LBB495:
+	.loc 1 189 18 view .LVU1021
+	movb	$7, 20+baseflightAngleScale(%rip)
+	.loc 1 190 5 is_stmt 1 view .LVU1022
+	.loc 1 191 5 view .LVU1023
+	.loc 1 193 5 view .LVU1024
+	.loc 1 195 12 view .LVU1025
+	.loc 1 196 9 view .LVU1026
+	.loc 1 197 9 view .LVU1027
+.LVL219:
+	.loc 1 197 9 is_stmt 0 view .LVU1028
+.LBE495:
+.LBE498:
+	.loc 1 512 5 is_stmt 1 view .LVU1029
+	.loc 1 512 5 is_stmt 0 view .LVU1030
+.LBE504:
+.LBE516:
+	.loc 1 558 5 is_stmt 1 view .LVU1031
+.LBB517:
+	.loc 1 515 13 view .LVU1032
+.LBB411:
+	.loc 1 517 5 view .LVU1033
+	.loc 1 518 5 view .LVU1034
+	.loc 1 519 5 view .LVU1035
+	.loc 1 521 5 view .LVU1036
+	.loc 1 522 5 view .LVU1037
+	.loc 1 523 5 view .LVU1038
+	movl	%eax, 96(%rsp)
+	.loc 1 524 5 view .LVU1039
+	.loc 1 525 5 view .LVU1040
+	.loc 1 524 19 is_stmt 0 view .LVU1041
+	movlps	%xmm0, 100(%rsp)
+	.loc 1 526 5 is_stmt 1 view .LVU1042
+	.loc 1 526 21 is_stmt 0 view .LVU1043
+	movss	%xmm1, 108(%rsp)
+	.loc 1 528 5 is_stmt 1 view .LVU1044
+	jmp	.L53
+.LVL220:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 528 5 is_stmt 0 view .LVU1045
+.LBE411:
+.LBE517:
+.LBB518:
+.LBB425:
+.LBB423:
+.LBB417:
+	.loc 1 236 12 view .LVU1046
+	movl	$26, %ebx
+	jmp	.L59
+.LBE417:
+.LBE423:
+.LBE425:
+.LBE518:
+	.cfi_endproc
+.LFE19:
+	.size	pidBaseflight, .-pidBaseflight
+	.section	.text.pidRewrite,"ax",@progbits
+	.p2align 4
+	.type	pidRewrite, @function
+pidRewrite:
+.LVL221:
+.LFB23:
+	.loc 1 736 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 736 1 is_stmt 0 view .LVU1048
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.loc 1 736 1 view .LVU1049
+	movq	%rsi, 24(%rsp)
+	movq	%rcx, 32(%rsp)
+	.loc 1 737 5 is_stmt 1 view .LVU1050
+	.loc 1 738 5 view .LVU1051
+	.loc 1 739 5 view .LVU1052
+	.loc 1 740 4 view .LVU1053
+	.loc 1 740 26 is_stmt 0 view .LVU1054
+	call	updateDTermFilter
+.LVL222:
+	.loc 1 740 26 view .LVU1055
+	movzbl	%al, %ebp
+.LVL223:
+	.loc 1 742 5 is_stmt 1 view .LVU1056
+	.loc 1 742 9 is_stmt 0 view .LVU1057
+	call	resolveAxisSetpoints
+.LVL224:
+	.loc 1 742 8 view .LVU1058
+	testb	%al, %al
+	jne	.L79
+.L82:
+	.loc 1 746 5 is_stmt 1 view .LVU1059
+	.loc 1 747 22 is_stmt 0 view .LVU1060
+	movl	$1, %eax
+.LBB538:
+	.loc 1 760 30 view .LVU1061
+	movzwl	%r12w, %edi
+	movl	%ebp, 20(%rsp)
+	.loc 1 787 25 view .LVU1062
+	xorl	%ebx, %ebx
+	movl	%edi, 44(%rsp)
+	leaq	rateKernels(%rip), %r15
+	leaq	axisSetpoints(%rip), %r14
+.LBE538:
+	.loc 1 746 5 view .LVU1063
+	pxor	%xmm0, %xmm0
+	movq	$0, 64(%rsp)
+	.loc 1 747 5 is_stmt 1 view .LVU1064
+.LBB547:
+.LBB539:
+.LBB540:
+	.loc 1 344 43 is_stmt 0 view .LVU1065
+	leaq	rcCommand(%rip), %r12
+.LVL225:
+	.loc 1 344 43 view .LVU1066
+.LBE540:
+.LBE539:
+.LBE547:
+	.loc 1 747 22 view .LVU1067
+	movw	%ax, 70(%rsp)
+	.loc 1 750 5 is_stmt 1 view .LVU1068
+.LVL226:
+	.loc 1 750 25 view .LVU1069
+	leaq	48(%rsp), %rax
+	movq	%rax, 8(%rsp)
+.LBB548:
+.LBB544:
+.LBB541:
+	.loc 1 350 12 is_stmt 0 view .LVU1070
+	movl	%edi, %eax
+	negl	%eax
+.LBE541:
+.LBE544:
+.LBE548:
+	.loc 1 746 5 view .LVU1071
+	movaps	%xmm0, 48(%rsp)
+.LBB549:
+.LBB545:
+.LBB542:
+	.loc 1 350 12 view .LVU1072
+	movl	%eax, 40(%rsp)
+	movq	%r13, %rax
+	movq	%r14, %r13
+.LVL227:
+	.loc 1 350 12 view .LVU1073
+	movq	%rbx, %r14
+	movq	%r15, %rbx
+	movq	%rax, %r15
+.LVL228:
+.L80:
+	.loc 1 350 12 view .LVU1074
+	movl	%r14d, %ebp
+.LVL229:
+	.loc 1 350 12 view .LVU1075
+.LBE542:
+.LBE545:
+	.loc 1 752 9 is_stmt 1 view .LVU1076
+	.loc 1 754 9 view .LVU1077
+	.loc 1 754 12 is_stmt 0 view .LVU1078
+	cmpq	$2, %r14
+	je	.L92
+	.loc 1 757 13 is_stmt 1 view .LVU1079
+.LVL230:
+	.loc 1 758 13 view .LVU1080
+	.loc 1 758 16 is_stmt 0 view .LVU1081
+	cmpb	$0, 0(%r13)
+	jne	.L85
+	.loc 1 758 57 discriminator 1 view .LVU1082
+	cmpb	$0, 1(%r13)
+	jne	.L85
+	.loc 1 769 17 is_stmt 1 view .LVU1083
+	.loc 1 769 62 is_stmt 0 view .LVU1084
+	movq	24(%rsp), %rax
+	.loc 1 769 95 view .LVU1085
+	leaq	rcCommand(%rip), %rdx
+	movswl	(%rdx,%r14,2), %edx
+	.loc 1 769 62 view .LVU1086
+	movzbl	4(%rax), %eax
+	.loc 1 769 35 view .LVU1087
+	addl	$27, %eax
+	.loc 1 769 84 view .LVU1088
+	imull	%edx, %eax
+	.loc 1 769 103 view .LVU1089
+	sarl	$4, %eax
+	cltq
+	movq	%rax, 48(%rsp)
+	.loc 1 770 17 is_stmt 1 view .LVU1090
+.LVL231:
+.L84:
+	.loc 1 779 9 discriminator 2 view .LVU1091
+	.loc 1 779 50 is_stmt 0 discriminator 2 view .LVU1092
+	movzbl	(%r15,%r14), %eax
+	.loc 1 784 65 discriminator 2 view .LVU1093
+	xorl	%edx, %edx
+	.loc 1 787 25 discriminator 2 view .LVU1094
+	movl	%ebp, %edi
+.LBE549:
+	.loc 1 750 25 discriminator 2 view .LVU1095
+	addq	$312, %rbx
+	addq	$2, %r13
+.LBB550:
+	.loc 1 779 50 discriminator 2 view .LVU1096
+	movl	%eax, -272(%rbx)
+	.loc 1 780 9 is_stmt 1 discriminator 2 view .LVU1097
+	.loc 1 780 50 is_stmt 0 discriminator 2 view .LVU1098
+	movzwl	cycleTime(%rip), %eax
+	movl	%eax, -248(%rbx)
+	.loc 1 781 9 is_stmt 1 discriminator 2 view .LVU1099
+	.loc 1 780 50 is_stmt 0 discriminator 2 view .LVU1100
+	movl	%eax, %esi
+	.loc 1 781 66 discriminator 2 view .LVU1101
+	movzbl	10(%r15,%r14), %eax
+	.loc 1 784 65 discriminator 2 view .LVU1102
+	shrw	$4, %si
+	.loc 1 781 66 discriminator 2 view .LVU1103
+	movl	%eax, -224(%rbx)
+	.loc 1 784 9 is_stmt 1 discriminator 2 view .LVU1104
+	.loc 1 784 65 is_stmt 0 discriminator 2 view .LVU1105
+	movl	$-1, %eax
+	divw	%si
+	.loc 1 787 25 discriminator 2 view .LVU1106
+	movl	20(%rsp), %edx
+	movq	8(%rsp), %rsi
+	.loc 1 784 65 discriminator 2 view .LVU1107
+	movzwl	%ax, %eax
+	movl	%eax, -152(%rbx)
+	.loc 1 785 9 is_stmt 1 discriminator 2 view .LVU1108
+	.loc 1 785 50 is_stmt 0 discriminator 2 view .LVU1109
+	movzbl	20(%r15,%r14), %eax
+	movl	%eax, -104(%rbx)
+	.loc 1 787 9 is_stmt 1 discriminator 2 view .LVU1110
+	.loc 1 787 25 is_stmt 0 discriminator 2 view .LVU1111
+	call	pidRateKernel
+.LVL232:
+	.loc 1 787 23 discriminator 2 view .LVU1112
+	leaq	axisPID(%rip), %rcx
+	movw	%ax, (%rcx,%r14,2)
+.LBE550:
+	.loc 1 750 34 is_stmt 1 discriminator 2 view .LVU1113
+.LVL233:
+	.loc 1 750 25 discriminator 2 view .LVU1114
+	addq	$1, %r14
+	cmpq	$3, %r14
+	jne	.L80
+	.loc 1 789 1 is_stmt 0 view .LVU1115
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL234:
+	.loc 1 789 1 view .LVU1116
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL235:
+	.loc 1 789 1 view .LVU1117
+	ret
+.LVL236:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.cfi_restore_state
+.LBB551:
+	.loc 1 760 17 is_stmt 1 view .LVU1118
+.LBB546:
+.LBI539:
+	.loc 1 342 16 view .LVU1119
+.LBB543:
+	.loc 1 344 5 view .LVU1120
+	.loc 1 350 5 view .LVU1121
+	.loc 1 344 43 is_stmt 0 view .LVU1122
+	movswl	(%r12,%r14,2), %edi
+	.loc 1 350 12 view .LVU1123
+	movl	44(%rsp), %edx
+	movl	40(%rsp), %esi
+	.loc 1 344 13 view .LVU1124
+	addl	%edi, %edi
+	.loc 1 350 12 view .LVU1125
+	call	constrain@PLT
+.LVL237:
+	.loc 1 351 30 view .LVU1126
+	leaq	inclination(%rip), %rcx
+	movswl	(%rcx,%r14,2), %edx
+	.loc 1 351 53 view .LVU1127
+	movq	32(%rsp), %rcx
+	.loc 1 351 13 view .LVU1128
+	subl	%edx, %eax
+	.loc 1 351 53 view .LVU1129
+	movswl	(%rcx,%r14,2), %edx
+	.loc 1 351 37 view .LVU1130
+	leal	(%rax,%rdx), %esi
+.LVL238:
+	.loc 1 351 37 view .LVU1131
+.LBE543:
+.LBE546:
+	.loc 1 768 13 is_stmt 1 view .LVU1132
+	.loc 1 768 25 is_stmt 0 view .LVU1133
+	movzbl	0(%r13), %eax
+	.loc 1 768 16 view .LVU1134
+	cmpb	$1, %al
+	je	.L87
+	.loc 1 769 17 is_stmt 1 view .LVU1135
+	.loc 1 769 62 is_stmt 0 view .LVU1136
+	movq	24(%rsp), %rcx
+	.loc 1 769 95 view .LVU1137
+	movswl	(%r12,%r14,2), %edi
+	.loc 1 769 62 view .LVU1138
+	movzbl	4(%rcx), %edx
+	.loc 1 769 35 view .LVU1139
+	addl	$27, %edx
+	.loc 1 769 84 view .LVU1140
+	imull	%edi, %edx
+	.loc 1 769 103 view .LVU1141
+	sarl	$4, %edx
+	movslq	%edx, %rdx
+	.loc 1 769 32 view .LVU1142
+	movq	%rdx, 48(%rsp)
+	.loc 1 770 17 is_stmt 1 view .LVU1143
+	.loc 1 770 20 is_stmt 0 view .LVU1144
+	cmpb	$2, %al
+	jne	.L84
+	.loc 1 772 21 is_stmt 1 view .LVU1145
+	.loc 1 772 67 is_stmt 0 view .LVU1146
+	movzbl	17(%r15), %eax
+	.loc 1 772 51 view .LVU1147
+	imull	%esi, %eax
+	.loc 1 772 79 view .LVU1148
+	sarl	$8, %eax
+	cltq
+	.loc 1 772 36 view .LVU1149
+	addq	%rdx, %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L84
+	.p2align 4,,10
+	.p2align 3
+.L87:
+	.loc 1 775 17 is_stmt 1 view .LVU1150
+	.loc 1 775 62 is_stmt 0 view .LVU1151
+	movzbl	7(%r15), %eax
+	.loc 1 775 46 view .LVU1152
+	imull	%esi, %eax
+	.loc 1 775 74 view .LVU1153
+	sarl	$4, %eax
+	cltq
+	movq	%rax, 48(%rsp)
+	jmp	.L84
+.LVL239:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 1 755 13 is_stmt 1 view .LVU1154
+	.loc 1 755 59 is_stmt 0 view .LVU1155
+	movq	24(%rsp), %rax
+	.loc 1 755 86 view .LVU1156
+	movswl	4+rcCommand(%rip), %edx
+	.loc 1 755 59 view .LVU1157
+	movzbl	5(%rax), %eax
+	.loc 1 755 32 view .LVU1158
+	addl	$27, %eax
+	.loc 1 755 75 view .LVU1159
+	imull	%edx, %eax
+	.loc 1 755 93 view .LVU1160
+	sarl	$5, %eax
+	cltq
+	movq	%rax, 48(%rsp)
+	jmp	.L84
+.LVL240:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 755 93 view .LVU1161
+	leaq	rateKernels(%rip), %rdx
+	movdqa	.LC13(%rip), %xmm2
+	movzwl	.LC14(%rip), %ecx
+.LBE551:
+.LBB552:
+.LBB553:
+.LBB554:
+.LBB555:
+	.loc 1 190 17 view .LVU1162
+	pxor	%xmm1, %xmm1
+	leaq	936(%rdx), %rsi
+.L81:
+.LVL241:
+	.loc 1 190 17 view .LVU1163
+.LBE555:
+.LBE554:
+	.loc 1 715 9 is_stmt 1 view .LVU1164
+	.loc 1 716 9 view .LVU1165
+	movq	%rdx, %rdi
+	.loc 1 714 25 is_stmt 0 view .LVU1166
+	addq	$312, %rdx
+.LVL242:
+	.loc 1 716 9 view .LVU1167
+	call	initIntegerRateKernel
+.LVL243:
+	.loc 1 719 9 is_stmt 1 view .LVU1168
+.LBB557:
+.LBI557:
+	.loc 1 184 13 view .LVU1169
+.LBB558:
+	.loc 1 186 5 view .LVU1170
+	.loc 1 188 5 view .LVU1171
+	.loc 1 189 18 is_stmt 0 view .LVU1172
+	movb	$2, -292(%rdx)
+	.loc 1 188 17 view .LVU1173
+	movl	$1, -296(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1174
+	.loc 1 190 5 view .LVU1175
+	.loc 1 191 5 view .LVU1176
+	.loc 1 193 5 view .LVU1177
+	.loc 1 194 9 view .LVU1178
+	.loc 1 190 17 is_stmt 0 view .LVU1179
+	movups	%xmm2, -312(%rdx)
+.LVL244:
+	.loc 1 190 17 view .LVU1180
+.LBE558:
+.LBE557:
+	.loc 1 720 9 is_stmt 1 view .LVU1181
+.LBB559:
+.LBI554:
+	.loc 1 184 13 view .LVU1182
+.LBB556:
+	.loc 1 186 5 view .LVU1183
+	.loc 1 188 5 view .LVU1184
+	.loc 1 188 17 is_stmt 0 view .LVU1185
+	movl	$0, -272(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1186
+	.loc 1 189 18 is_stmt 0 view .LVU1187
+	movb	$7, -268(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1188
+	.loc 1 191 5 view .LVU1189
+	.loc 1 190 17 is_stmt 0 view .LVU1190
+	movups	%xmm1, -288(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1191
+	.loc 1 195 12 view .LVU1192
+.LVL245:
+	.loc 1 195 12 is_stmt 0 view .LVU1193
+.LBE556:
+.LBE559:
+	.loc 1 723 9 is_stmt 1 view .LVU1194
+.LBB560:
+.LBI560:
+	.loc 1 184 13 view .LVU1195
+.LBB561:
+	.loc 1 186 5 view .LVU1196
+	.loc 1 188 5 view .LVU1197
+	.loc 1 188 17 is_stmt 0 view .LVU1198
+	movl	$0, -248(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1199
+	.loc 1 189 18 is_stmt 0 view .LVU1200
+	movb	$11, -244(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1201
+	.loc 1 191 5 view .LVU1202
+	.loc 1 190 17 is_stmt 0 view .LVU1203
+	movups	%xmm1, -264(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1204
+	.loc 1 195 12 view .LVU1205
+.LVL246:
+	.loc 1 195 12 is_stmt 0 view .LVU1206
+.LBE561:
+.LBE560:
+	.loc 1 724 9 is_stmt 1 view .LVU1207
+.LBB562:
+.LBI562:
+	.loc 1 184 13 view .LVU1208
+.LBB563:
+	.loc 1 186 5 view .LVU1209
+	.loc 1 188 5 view .LVU1210
+	.loc 1 188 17 is_stmt 0 view .LVU1211
+	movl	$0, -224(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1212
+	.loc 1 189 18 is_stmt 0 view .LVU1213
+	movb	$0, -220(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1214
+	.loc 1 191 5 view .LVU1215
+	.loc 1 190 17 is_stmt 0 view .LVU1216
+	movups	%xmm1, -240(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1217
+	.loc 1 195 12 view .LVU1218
+.LVL247:
+	.loc 1 195 12 is_stmt 0 view .LVU1219
+.LBE563:
+.LBE562:
+	.loc 1 725 9 is_stmt 1 view .LVU1220
+.LBB564:
+.LBI564:
+	.loc 1 184 13 view .LVU1221
+.LBB565:
+	.loc 1 186 5 view .LVU1222
+	.loc 1 188 5 view .LVU1223
+	.loc 1 188 17 is_stmt 0 view .LVU1224
+	movl	$1, -200(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1225
+	.loc 1 189 18 is_stmt 0 view .LVU1226
+	movb	$13, -196(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1227
+	.loc 1 191 5 view .LVU1228
+	.loc 1 190 17 is_stmt 0 view .LVU1229
+	movups	%xmm1, -216(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1230
+	.loc 1 195 12 view .LVU1231
+.LVL248:
+	.loc 1 195 12 is_stmt 0 view .LVU1232
+.LBE565:
+.LBE564:
+	.loc 1 726 9 is_stmt 1 view .LVU1233
+.LBB566:
+.LBI566:
+	.loc 1 184 13 view .LVU1234
+.LBB567:
+	.loc 1 186 5 view .LVU1235
+	.loc 1 188 5 view .LVU1236
+	.loc 1 188 17 is_stmt 0 view .LVU1237
+	movl	$0, -152(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1238
+	.loc 1 189 18 is_stmt 0 view .LVU1239
+	movb	$6, -148(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1240
+	.loc 1 191 5 view .LVU1241
+	.loc 1 190 17 is_stmt 0 view .LVU1242
+	movups	%xmm1, -168(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1243
+	.loc 1 195 12 view .LVU1244
+.LVL249:
+	.loc 1 195 12 is_stmt 0 view .LVU1245
+.LBE567:
+.LBE566:
+	.loc 1 727 9 is_stmt 1 view .LVU1246
+.LBB568:
+.LBI568:
+	.loc 1 184 13 view .LVU1247
+.LBB569:
+	.loc 1 186 5 view .LVU1248
+	.loc 1 188 5 view .LVU1249
+	.loc 1 188 17 is_stmt 0 view .LVU1250
+	movl	$0, -104(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1251
+	.loc 1 189 18 is_stmt 0 view .LVU1252
+	movb	$8, -100(%rdx)
+	.loc 1 190 5 is_stmt 1 view .LVU1253
+	.loc 1 191 5 view .LVU1254
+	.loc 1 190 17 is_stmt 0 view .LVU1255
+	movups	%xmm1, -120(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1256
+	.loc 1 195 12 view .LVU1257
+.LVL250:
+	.loc 1 195 12 is_stmt 0 view .LVU1258
+.LBE569:
+.LBE568:
+	.loc 1 728 9 is_stmt 1 view .LVU1259
+	.loc 1 728 33 is_stmt 0 view .LVU1260
+	movq	$2097152, -40(%rdx)
+	.loc 1 729 9 is_stmt 1 view .LVU1261
+	.loc 1 730 9 view .LVU1262
+	.loc 1 729 33 is_stmt 0 view .LVU1263
+	movw	%cx, -3(%rdx)
+	.loc 1 714 34 is_stmt 1 view .LVU1264
+.LVL251:
+	.loc 1 714 25 view .LVU1265
+	cmpq	%rsi, %rdx
+	jne	.L81
+	jmp	.L82
+.LBE553:
+.LBE552:
+	.cfi_endproc
+.LFE23:
+	.size	pidRewrite, .-pidRewrite
+	.section	.text.pidMultiWii,"ax",@progbits
+	.p2align 4
+	.type	pidMultiWii, @function
+pidMultiWii:
+.LVL252:
+.LFB21:
+	.loc 1 645 1 view -0
+	.cfi_startproc
+	.loc 1 645 1 is_stmt 0 view .LVU1267
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leaq	axisSetpoints(%rip), %r15
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.loc 1 645 1 view .LVU1268
+	movq	%rcx, 24(%rsp)
+	.loc 1 646 5 is_stmt 1 view .LVU1269
+	.loc 1 647 5 view .LVU1270
+	.loc 1 648 5 view .LVU1271
+	.loc 1 649 4 view .LVU1272
+	.loc 1 649 26 is_stmt 0 view .LVU1273
+	call	updateDTermFilter
+.LVL253:
+	.loc 1 649 26 view .LVU1274
+	movzbl	%al, %ebp
+.LVL254:
+	.loc 1 651 5 is_stmt 1 view .LVU1275
+	.loc 1 653 5 view .LVU1276
+	.loc 1 653 9 is_stmt 0 view .LVU1277
+	call	resolveAxisSetpoints
+.LVL255:
+	.loc 1 653 8 view .LVU1278
+	testb	%al, %al
+	jne	.L109
+.L95:
+	.loc 1 657 5 is_stmt 1 view .LVU1279
+	.loc 1 660 59 is_stmt 0 view .LVU1280
+	movzwl	2+rcCommand(%rip), %eax
+	.loc 1 660 121 view .LVU1281
+	movswl	rcCommand(%rip), %edi
+	.loc 1 657 5 view .LVU1282
+	pxor	%xmm0, %xmm0
+	movq	$0, 64(%rsp)
+	.loc 1 660 5 is_stmt 1 view .LVU1283
+	.loc 1 657 5 is_stmt 0 view .LVU1284
+	movaps	%xmm0, 48(%rsp)
+	leaq	rateKernels(%rip), %r14
+	.loc 1 660 59 view .LVU1285
+	movl	%eax, %edx
+	negw	%dx
+	cmovs	%eax, %edx
+	.loc 1 660 129 view .LVU1286
+	movl	%edi, %eax
+	negw	%ax
+	cmovs	%edi, %eax
+	.loc 1 660 224 view .LVU1287
+	cmpw	%ax, %dx
+	cmovnb	%edx, %eax
+.LBB592:
+	.loc 1 703 25 view .LVU1288
+	xorl	%r13d, %r13d
+	movl	%r13d, %r9d
+.LBE592:
+	.loc 1 660 224 view .LVU1289
+	movw	%ax, 46(%rsp)
+.LVL256:
+	.loc 1 661 5 is_stmt 1 view .LVU1290
+	.loc 1 661 25 view .LVU1291
+.LBB605:
+	.loc 1 662 9 view .LVU1292
+	.loc 1 664 9 view .LVU1293
+	leaq	48(%rsp), %rax
+.LVL257:
+	.loc 1 664 9 is_stmt 0 view .LVU1294
+	movq	%rax, 8(%rsp)
+	.loc 1 666 26 view .LVU1295
+	movzwl	%r12w, %eax
+	.loc 1 677 54 view .LVU1296
+	leaq	errorAngleI(%rip), %r12
+.LVL258:
+	.loc 1 666 26 view .LVU1297
+	movl	%eax, 36(%rsp)
+.LBB593:
+.LBB594:
+	.loc 1 350 12 view .LVU1298
+	negl	%eax
+.LVL259:
+	.loc 1 350 12 view .LVU1299
+.LBE594:
+.LBE593:
+	.loc 1 664 12 view .LVU1300
+	cmpb	$0, (%r15,%r13,2)
+.LBB600:
+.LBB595:
+	.loc 1 350 12 view .LVU1301
+	movl	%eax, 40(%rsp)
+.LBE595:
+.LBE600:
+	.loc 1 664 12 view .LVU1302
+	jne	.L101
+.LVL260:
+.L110:
+	.loc 1 681 13 is_stmt 1 view .LVU1303
+	.loc 1 681 61 is_stmt 0 view .LVU1304
+	leal	(%rdi,%rdi,4), %eax
+	.loc 1 681 81 view .LVU1305
+	movzbl	(%rbx,%r13), %esi
+	.loc 1 682 31 view .LVU1306
+	movl	%edi, 56(%rsp)
+	.loc 1 681 61 view .LVU1307
+	sall	$4, %eax
+	.loc 1 681 65 view .LVU1308
+	cltd
+	idivl	%esi
+	cltq
+	movq	%rax, 48(%rsp)
+	.loc 1 682 13 is_stmt 1 view .LVU1309
+	.loc 1 684 9 view .LVU1310
+.LVL261:
+.L102:
+	.loc 1 684 9 is_stmt 0 view .LVU1311
+	xorl	%eax, %eax
+	movl	$500, %edx
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 686 35 discriminator 2 view .LVU1312
+	movw	%ax, 68(%rsp)
+	.loc 1 699 41 discriminator 2 view .LVU1313
+	leaq	dynP8(%rip), %rax
+	.loc 1 703 25 discriminator 2 view .LVU1314
+	movq	8(%rsp), %rsi
+	movl	%r9d, %edi
+	.loc 1 699 41 discriminator 2 view .LVU1315
+	movzbl	(%rax,%r13), %eax
+	.loc 1 687 34 discriminator 2 view .LVU1316
+	movw	%dx, 70(%rsp)
+	.loc 1 699 9 is_stmt 1 discriminator 2 view .LVU1317
+	.loc 1 703 25 is_stmt 0 discriminator 2 view .LVU1318
+	movl	%ebp, %edx
+	.loc 1 699 48 discriminator 2 view .LVU1319
+	imull	$3355444, %eax, %eax
+	.loc 1 699 34 discriminator 2 view .LVU1320
+	movl	%eax, 40(%r14)
+	.loc 1 700 9 is_stmt 1 discriminator 2 view .LVU1321
+	.loc 1 700 68 is_stmt 0 discriminator 2 view .LVU1322
+	movzbl	10(%rbx,%r13), %eax
+	movl	%eax, 136(%r14)
+	.loc 1 701 9 is_stmt 1 discriminator 2 view .LVU1323
+	.loc 1 701 42 is_stmt 0 discriminator 2 view .LVU1324
+	leaq	dynD8(%rip), %rax
+	movzbl	(%rax,%r13), %eax
+	.loc 1 701 36 discriminator 2 view .LVU1325
+	negl	%eax
+	movl	%eax, 208(%r14)
+	.loc 1 703 9 is_stmt 1 discriminator 2 view .LVU1326
+	.loc 1 703 25 is_stmt 0 discriminator 2 view .LVU1327
+	call	pidRateKernel
+.LVL262:
+	.loc 1 703 23 discriminator 2 view .LVU1328
+	leaq	axisPID(%rip), %rcx
+	movw	%ax, (%rcx,%r13,2)
+.LBE605:
+	.loc 1 661 34 is_stmt 1 discriminator 2 view .LVU1329
+.LVL263:
+	.loc 1 661 25 discriminator 2 view .LVU1330
+	addq	$1, %r13
+.LVL264:
+	.loc 1 661 25 is_stmt 0 discriminator 2 view .LVU1331
+	cmpq	$3, %r13
+	je	.L93
+	.loc 1 661 25 view .LVU1332
+	addq	$312, %r14
+.LBB606:
+.LBB601:
+.LBB596:
+	.loc 1 344 43 view .LVU1333
+	leaq	rcCommand(%rip), %rax
+.LBE596:
+.LBE601:
+	.loc 1 664 12 view .LVU1334
+	cmpb	$0, (%r15,%r13,2)
+	movl	%r13d, %r9d
+.LVL265:
+	.loc 1 662 9 is_stmt 1 view .LVU1335
+	.loc 1 664 9 view .LVU1336
+.LBB602:
+.LBB597:
+	.loc 1 344 43 is_stmt 0 view .LVU1337
+	movswl	(%rax,%r13,2), %edi
+.LBE597:
+.LBE602:
+	.loc 1 664 12 view .LVU1338
+	je	.L110
+.LVL266:
+.L101:
+.LBB603:
+.LBB598:
+	.loc 1 350 12 view .LVU1339
+	movl	36(%rsp), %edx
+	movl	40(%rsp), %esi
+	.loc 1 344 13 view .LVU1340
+	addl	%edi, %edi
+	movl	%r13d, 32(%rsp)
+.LBE598:
+.LBE603:
+	.loc 1 666 13 is_stmt 1 view .LVU1341
+.LVL267:
+.LBB604:
+.LBI593:
+	.loc 1 342 16 view .LVU1342
+.LBB599:
+	.loc 1 344 5 view .LVU1343
+	.loc 1 350 5 view .LVU1344
+	.loc 1 350 12 is_stmt 0 view .LVU1345
+	call	constrain@PLT
+.LVL268:
+	.loc 1 351 30 view .LVU1346
+	leaq	inclination(%rip), %rcx
+	movswl	(%rcx,%r13,2), %edx
+	.loc 1 351 53 view .LVU1347
+	movq	24(%rsp), %rcx
+	.loc 1 351 13 view .LVU1348
+	subl	%edx, %eax
+	.loc 1 351 53 view .LVU1349
+	movswl	(%rcx,%r13,2), %edx
+	.loc 1 351 37 view .LVU1350
+	leal	(%rax,%rdx), %r10d
+.LVL269:
+	.loc 1 351 37 view .LVU1351
+.LBE599:
+.LBE604:
+	.loc 1 674 13 is_stmt 1 view .LVU1352
+	.loc 1 675 13 view .LVU1353
+	.loc 1 675 98 is_stmt 0 view .LVU1354
+	movzbl	27(%rbx), %eax
+	.loc 1 674 39 view .LVU1355
+	movl	%r10d, 20(%rsp)
+	.loc 1 675 28 view .LVU1356
+	leal	(%rax,%rax,4), %edx
+	.loc 1 674 55 view .LVU1357
+	movzbl	7(%rbx), %eax
+	.loc 1 675 28 view .LVU1358
+	movl	%edx, %esi
+	.loc 1 674 39 view .LVU1359
+	imull	%r10d, %eax
+	.loc 1 675 28 view .LVU1360
+	negl	%esi
+	.loc 1 674 66 view .LVU1361
+	movslq	%eax, %rdi
+	sarl	$31, %eax
+	imulq	$1374389535, %rdi, %rdi
+	sarq	$37, %rdi
+	subl	%eax, %edi
+	.loc 1 675 28 view .LVU1362
+	call	constrain@PLT
+.LVL270:
+	.loc 1 677 33 view .LVU1363
+	movl	20(%rsp), %edi
+	movl	$10000, %edx
+	addl	(%r12,%r13,4), %edi
+	movl	$-10000, %esi
+	.loc 1 675 26 view .LVU1364
+	movl	%eax, 60(%rsp)
+	.loc 1 677 13 is_stmt 1 view .LVU1365
+	.loc 1 677 33 is_stmt 0 view .LVU1366
+	call	constrain@PLT
+.LVL271:
+	.loc 1 680 21 view .LVU1367
+	movzbl	(%r15,%r13,2), %esi
+	.loc 1 680 12 view .LVU1368
+	movl	32(%rsp), %r9d
+	.loc 1 677 33 view .LVU1369
+	movl	%eax, %edx
+	.loc 1 677 31 view .LVU1370
+	movl	%eax, (%r12,%r13,4)
+	.loc 1 678 13 is_stmt 1 view .LVU1371
+	.loc 1 678 63 is_stmt 0 view .LVU1372
+	movzbl	17(%rbx), %eax
+	.loc 1 678 47 view .LVU1373
+	imull	%edx, %eax
+	.loc 1 678 75 view .LVU1374
+	sarl	$12, %eax
+	.loc 1 680 12 view .LVU1375
+	cmpb	$1, %sil
+	.loc 1 678 75 view .LVU1376
+	movl	%eax, 64(%rsp)
+	.loc 1 680 9 is_stmt 1 view .LVU1377
+	.loc 1 680 12 is_stmt 0 view .LVU1378
+	jne	.L111
+	.loc 1 680 12 view .LVU1379
+	movl	$500, %eax
+	xorl	%edx, %edx
+	jmp	.L103
+.LVL272:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.loc 1 680 12 view .LVU1380
+.LBE606:
+	.loc 1 705 1 view .LVU1381
+	addq	$88, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL273:
+	.loc 1 705 1 view .LVU1382
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL274:
+	.loc 1 705 1 view .LVU1383
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL275:
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.cfi_restore_state
+	.loc 1 705 1 view .LVU1384
+	movdqa	.LC13(%rip), %xmm2
+	movdqa	.LC15(%rip), %xmm6
+	leaq	rateKernels(%rip), %rdx
+	.loc 1 653 8 view .LVU1385
+	xorl	%ecx, %ecx
+	movdqa	.LC16(%rip), %xmm1
+	movdqa	.LC17(%rip), %xmm5
+.LBB607:
+.LBB608:
+.LBB609:
+.LBB610:
+.LBB611:
+	.loc 1 190 17 view .LVU1386
+	pxor	%xmm3, %xmm3
+	leaq	axisSetpoints(%rip), %r15
+	movdqa	.LC18(%rip), %xmm4
+.L100:
+.LVL276:
+	.loc 1 190 17 view .LVU1387
+.LBE611:
+.LBE610:
+	.loc 1 621 8 is_stmt 1 view .LVU1388
+	.loc 1 621 43 is_stmt 0 view .LVU1389
+	movzbl	(%r15,%rcx,2), %esi
+.LVL277:
+	.loc 1 623 9 is_stmt 1 view .LVU1390
+	.loc 1 624 9 view .LVU1391
+	movq	%rdx, %rdi
+	call	initIntegerRateKernel
+.LVL278:
+	.loc 1 627 9 view .LVU1392
+.LBB614:
+.LBI614:
+	.loc 1 184 13 view .LVU1393
+.LBB615:
+	.loc 1 186 5 view .LVU1394
+	.loc 1 188 5 view .LVU1395
+.LBE615:
+.LBE614:
+	.loc 1 621 13 is_stmt 0 view .LVU1396
+	xorl	%eax, %eax
+.LBB619:
+.LBB616:
+	.loc 1 189 18 view .LVU1397
+	movb	$2, 20(%rdx)
+.LBE616:
+.LBE619:
+	.loc 1 621 13 view .LVU1398
+	cmpb	$1, %sil
+.LBB620:
+.LBB617:
+	.loc 1 188 17 view .LVU1399
+	movl	$1, 16(%rdx)
+	.loc 1 189 5 is_stmt 1 view .LVU1400
+	.loc 1 190 5 view .LVU1401
+	.loc 1 191 5 view .LVU1402
+	.loc 1 193 5 view .LVU1403
+	.loc 1 194 9 view .LVU1404
+.LBE617:
+.LBE620:
+	.loc 1 621 13 is_stmt 0 view .LVU1405
+	setne	%al
+.LBB621:
+.LBB622:
+	.loc 1 188 17 view .LVU1406
+	movl	$0, 40(%rdx)
+	.loc 1 189 18 view .LVU1407
+	movb	$28, 44(%rdx)
+.LBE622:
+.LBE621:
+.LBB624:
+.LBB612:
+	.loc 1 188 17 view .LVU1408
+	movl	%eax, 64(%rdx)
+	.loc 1 189 18 view .LVU1409
+	movb	$0, 68(%rdx)
+.LBE612:
+.LBE624:
+.LBB625:
+.LBB626:
+	.loc 1 188 17 view .LVU1410
+	movl	$34359739, 112(%rdx)
+	.loc 1 189 18 view .LVU1411
+	movb	$32, 116(%rdx)
+.LBE626:
+.LBE625:
+.LBB628:
+.LBB629:
+	.loc 1 188 17 view .LVU1412
+	movl	$0, 136(%rdx)
+	.loc 1 189 18 view .LVU1413
+	movb	$6, 140(%rdx)
+.LBE629:
+.LBE628:
+.LBB631:
+.LBB632:
+	.loc 1 188 17 view .LVU1414
+	movl	$1, 160(%rdx)
+	.loc 1 189 18 view .LVU1415
+	movb	$2, 164(%rdx)
+.LBE632:
+.LBE631:
+.LBB634:
+.LBB635:
+	.loc 1 188 17 view .LVU1416
+	movl	$0, 208(%rdx)
+	.loc 1 189 18 view .LVU1417
+	movb	$5, 212(%rdx)
+.LBE635:
+.LBE634:
+.LBB637:
+.LBB638:
+	.loc 1 188 17 view .LVU1418
+	movl	$8589935, 232(%rdx)
+	.loc 1 189 18 view .LVU1419
+	movb	$32, 236(%rdx)
+.LBE638:
+.LBE637:
+	.loc 1 635 33 view .LVU1420
+	movq	$16000, 272(%rdx)
+.LBB640:
+.LBB618:
+	.loc 1 190 17 view .LVU1421
+	movups	%xmm2, (%rdx)
+.LVL279:
+	.loc 1 190 17 view .LVU1422
+.LBE618:
+.LBE640:
+	.loc 1 628 9 is_stmt 1 view .LVU1423
+.LBB641:
+.LBI621:
+	.loc 1 184 13 view .LVU1424
+.LBB623:
+	.loc 1 186 5 view .LVU1425
+	.loc 1 188 5 view .LVU1426
+	.loc 1 189 5 view .LVU1427
+	.loc 1 190 5 view .LVU1428
+	.loc 1 191 5 view .LVU1429
+	.loc 1 193 5 view .LVU1430
+	.loc 1 194 9 view .LVU1431
+	.loc 1 190 17 is_stmt 0 view .LVU1432
+	movups	%xmm6, 24(%rdx)
+.LVL280:
+	.loc 1 190 17 view .LVU1433
+.LBE623:
+.LBE641:
+	.loc 1 629 9 is_stmt 1 view .LVU1434
+.LBB642:
+.LBI610:
+	.loc 1 184 13 view .LVU1435
+.LBB613:
+	.loc 1 186 5 view .LVU1436
+	.loc 1 188 5 view .LVU1437
+	.loc 1 189 5 view .LVU1438
+	.loc 1 190 5 view .LVU1439
+	.loc 1 191 5 view .LVU1440
+	.loc 1 190 17 is_stmt 0 view .LVU1441
+	movups	%xmm3, 48(%rdx)
+	.loc 1 193 5 is_stmt 1 view .LVU1442
+	.loc 1 195 12 view .LVU1443
+.LVL281:
+	.loc 1 195 12 is_stmt 0 view .LVU1444
+.LBE613:
+.LBE642:
+	.loc 1 630 9 is_stmt 1 view .LVU1445
+.LBB643:
+.LBI625:
+	.loc 1 184 13 view .LVU1446
+.LBB627:
+	.loc 1 186 5 view .LVU1447
+	.loc 1 188 5 view .LVU1448
+	.loc 1 189 5 view .LVU1449
+	.loc 1 190 5 view .LVU1450
+	.loc 1 191 5 view .LVU1451
+	.loc 1 193 5 view .LVU1452
+	.loc 1 194 9 view .LVU1453
+	.loc 1 190 17 is_stmt 0 view .LVU1454
+	movups	%xmm1, 96(%rdx)
+.LVL282:
+	.loc 1 190 17 view .LVU1455
+.LBE627:
+.LBE643:
+	.loc 1 631 9 is_stmt 1 view .LVU1456
+.LBB644:
+.LBI628:
+	.loc 1 184 13 view .LVU1457
+.LBB630:
+	.loc 1 186 5 view .LVU1458
+	.loc 1 188 5 view .LVU1459
+	.loc 1 189 5 view .LVU1460
+	.loc 1 190 5 view .LVU1461
+	.loc 1 191 5 view .LVU1462
+	.loc 1 193 5 view .LVU1463
+	.loc 1 194 9 view .LVU1464
+	.loc 1 190 17 is_stmt 0 view .LVU1465
+	movups	%xmm5, 120(%rdx)
+.LVL283:
+	.loc 1 190 17 view .LVU1466
+.LBE630:
+.LBE644:
+	.loc 1 632 9 is_stmt 1 view .LVU1467
+.LBB645:
+.LBI631:
+	.loc 1 184 13 view .LVU1468
+.LBB633:
+	.loc 1 186 5 view .LVU1469
+	.loc 1 188 5 view .LVU1470
+	.loc 1 189 5 view .LVU1471
+	.loc 1 190 5 view .LVU1472
+	.loc 1 191 5 view .LVU1473
+	.loc 1 193 5 view .LVU1474
+	.loc 1 194 9 view .LVU1475
+	.loc 1 190 17 is_stmt 0 view .LVU1476
+	movups	%xmm2, 144(%rdx)
+.LVL284:
+	.loc 1 190 17 view .LVU1477
+.LBE633:
+.LBE645:
+	.loc 1 633 9 is_stmt 1 view .LVU1478
+.LBB646:
+.LBI634:
+	.loc 1 184 13 view .LVU1479
+.LBB636:
+	.loc 1 186 5 view .LVU1480
+	.loc 1 188 5 view .LVU1481
+	.loc 1 189 5 view .LVU1482
+	.loc 1 190 5 view .LVU1483
+	.loc 1 191 5 view .LVU1484
+	.loc 1 193 5 view .LVU1485
+	.loc 1 194 9 view .LVU1486
+	.loc 1 190 17 is_stmt 0 view .LVU1487
+	movups	%xmm4, 192(%rdx)
+.LVL285:
+	.loc 1 190 17 view .LVU1488
+.LBE636:
+.LBE646:
+	.loc 1 634 9 is_stmt 1 view .LVU1489
+.LBB647:
+.LBI637:
+	.loc 1 184 13 view .LVU1490
+.LBB639:
+	.loc 1 186 5 view .LVU1491
+	.loc 1 188 5 view .LVU1492
+	.loc 1 189 5 view .LVU1493
+	.loc 1 190 5 view .LVU1494
+	.loc 1 191 5 view .LVU1495
+	.loc 1 193 5 view .LVU1496
+	.loc 1 194 9 view .LVU1497
+	.loc 1 190 17 is_stmt 0 view .LVU1498
+	movups	%xmm1, 216(%rdx)
+.LVL286:
+	.loc 1 190 17 view .LVU1499
+.LBE639:
+.LBE647:
+	.loc 1 635 9 is_stmt 1 view .LVU1500
+	.loc 1 636 9 view .LVU1501
+	.loc 1 636 58 is_stmt 0 view .LVU1502
+	je	.L112
+	.loc 1 636 37 view .LVU1503
+	movl	$2560, 300(%rdx)
+	.loc 1 637 9 is_stmt 1 view .LVU1504
+	.loc 1 637 73 is_stmt 0 view .LVU1505
+	cmpq	$2, %rcx
+	jne	.L99
+	.loc 1 637 38 view .LVU1506
+	movl	$100, 928+rateKernels(%rip)
+	.loc 1 638 9 is_stmt 1 view .LVU1507
+	.loc 1 638 33 is_stmt 0 view .LVU1508
+	movb	$0, 932+rateKernels(%rip)
+	.loc 1 639 9 is_stmt 1 view .LVU1509
+	.loc 1 639 29 is_stmt 0 view .LVU1510
+	movb	$1, 935+rateKernels(%rip)
+.LBE609:
+	.loc 1 619 34 is_stmt 1 view .LVU1511
+.LVL287:
+	.loc 1 619 25 view .LVU1512
+	jmp	.L95
+.LVL288:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.loc 1 619 25 is_stmt 0 view .LVU1513
+	addq	$1, %rcx
+.LVL289:
+.LBB648:
+	.loc 1 638 33 view .LVU1514
+	movb	$0, 308(%rdx)
+.LBE648:
+	.loc 1 619 25 view .LVU1515
+	addq	$312, %rdx
+.LVL290:
+.LBB649:
+	.loc 1 636 37 view .LVU1516
+	movl	$2147483647, -12(%rdx)
+	.loc 1 637 9 is_stmt 1 view .LVU1517
+	.loc 1 637 38 is_stmt 0 view .LVU1518
+	movl	$2147483647, -8(%rdx)
+	.loc 1 638 9 is_stmt 1 view .LVU1519
+	.loc 1 639 9 view .LVU1520
+	.loc 1 639 29 is_stmt 0 view .LVU1521
+	movb	$1, -1(%rdx)
+.LBE649:
+	.loc 1 619 34 is_stmt 1 view .LVU1522
+.LVL291:
+	.loc 1 619 25 view .LVU1523
+	cmpq	$3, %rcx
+	jne	.L100
+	jmp	.L95
+.LVL292:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+.LBB650:
+	.loc 1 637 38 is_stmt 0 view .LVU1524
+	movl	$2147483647, 304(%rdx)
+	.loc 1 638 9 is_stmt 1 view .LVU1525
+.LBE650:
+	.loc 1 619 25 is_stmt 0 view .LVU1526
+	addq	$1, %rcx
+.LVL293:
+	.loc 1 619 25 view .LVU1527
+	addq	$312, %rdx
+.LVL294:
+.LBB651:
+	.loc 1 638 33 view .LVU1528
+	movb	$0, -4(%rdx)
+	.loc 1 639 9 is_stmt 1 view .LVU1529
+	.loc 1 639 29 is_stmt 0 view .LVU1530
+	movb	$1, -1(%rdx)
+.LBE651:
+	.loc 1 619 34 is_stmt 1 view .LVU1531
+.LVL295:
+	.loc 1 619 25 view .LVU1532
+	jmp	.L100
+.LVL296:
+.L111:
+	.loc 1 619 25 is_stmt 0 view .LVU1533
+.LBE608:
+.LBE607:
+.LBB652:
+	.loc 1 681 13 is_stmt 1 view .LVU1534
+	.loc 1 681 49 is_stmt 0 view .LVU1535
+	leaq	rcCommand(%rip), %rax
+	.loc 1 681 81 view .LVU1536
+	movzbl	(%rbx,%r13), %r10d
+	.loc 1 681 30 view .LVU1537
+	movswl	(%rax,%r13,2), %edi
+	.loc 1 681 61 view .LVU1538
+	imull	$80, %edi, %eax
+	.loc 1 682 31 view .LVU1539
+	movl	%edi, 56(%rsp)
+	.loc 1 681 65 view .LVU1540
+	cltd
+	idivl	%r10d
+	cltq
+	movq	%rax, 48(%rsp)
+	.loc 1 682 13 is_stmt 1 view .LVU1541
+	.loc 1 684 9 view .LVU1542
+	cmpb	$2, %sil
+	jne	.L102
+	.loc 1 686 17 view .LVU1543
+	.loc 1 686 41 is_stmt 0 view .LVU1544
+	movzwl	46(%rsp), %edx
+	movl	$500, %eax
+	subl	%edx, %eax
+	.loc 1 687 17 is_stmt 1 view .LVU1545
+	.loc 1 688 17 view .LVU1546
+	jmp	.L103
+.LBE652:
+	.cfi_endproc
+.LFE21:
+	.size	pidMultiWii, .-pidMultiWii
+	.section	.text.resetRollAndPitchTrims,"ax",@progbits
+	.p2align 4
+	.globl	resetRollAndPitchTrims
+	.type	resetRollAndPitchTrims, @function
+resetRollAndPitchTrims:
+.LVL297:
+.LFB0:
+	.loc 1 154 1 view -0
+	.cfi_startproc
+	.loc 1 155 5 view .LVU1548
+	.loc 1 156 5 view .LVU1549
+	.loc 1 155 36 is_stmt 0 view .LVU1550
+	movl	$0, (%rdi)
+	.loc 1 157 1 view .LVU1551
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	resetRollAndPitchTrims, .-resetRollAndPitchTrims
+	.section	.text.resetErrorAngle,"ax",@progbits
+	.p2align 4
+	.globl	resetErrorAngle
+	.type	resetErrorAngle, @function
+resetErrorAngle:
+.LFB1:
+	.loc 1 160 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 161 5 view .LVU1553
+	.loc 1 162 5 view .LVU1554
+	.loc 1 161 23 is_stmt 0 view .LVU1555
+	movq	$0, errorAngleI(%rip)
+	.loc 1 163 1 view .LVU1556
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	resetErrorAngle, .-resetErrorAngle
+	.section	.text.resetErrorGyro,"ax",@progbits
+	.p2align 4
+	.globl	resetErrorGyro
+	.type	resetErrorGyro, @function
+resetErrorGyro:
+.LFB2:
+	.loc 1 166 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 167 5 view .LVU1558
+	.loc 1 167 33 is_stmt 0 view .LVU1559
+	movq	$0, axisStates(%rip)
+	.loc 1 168 5 is_stmt 1 view .LVU1560
+	.loc 1 168 34 is_stmt 0 view .LVU1561
+	movq	$0, 72+axisStates(%rip)
+	.loc 1 169 5 is_stmt 1 view .LVU1562
+	.loc 1 169 32 is_stmt 0 view .LVU1563
+	movq	$0, 144+axisStates(%rip)
+	.loc 1 170 1 view .LVU1564
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	resetErrorGyro, .-resetErrorGyro
+	.section	.text.setPIDController,"ax",@progbits
+	.p2align 4
+	.globl	setPIDController
+	.type	setPIDController, @function
+setPIDController:
+.LVL298:
+.LFB24:
+	.loc 1 792 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 793 5 view .LVU1566
+	leaq	pidRewrite(%rip), %rdx
+	movl	$1, %eax
+	cmpl	$1, %edi
+	je	.L117
+	cmpl	$2, %edi
+	leaq	pidMultiWii(%rip), %rax
+	leaq	pidBaseflight(%rip), %rdx
+	cmovne	%rax, %rdx
+	sete	%al
+	addl	%eax, %eax
+.L117:
+	.loc 1 796 28 is_stmt 0 view .LVU1567
+	movq	%rdx, pid_controller(%rip)
+.LBB655:
+.LBB656:
+	.loc 1 458 5 view .LVU1568
+	leaq	axisStates(%rip), %rdx
+	movl	$27, %ecx
+.LBE656:
+.LBE655:
+	.loc 1 797 31 view .LVU1569
+	movb	%al, pidControllerType(%rip)
+	.loc 1 807 5 is_stmt 1 view .LVU1570
+.LBB659:
+.LBB657:
+	.loc 1 458 5 is_stmt 0 view .LVU1571
+	movq	%rdx, %rdi
+.LVL299:
+	.loc 1 458 5 view .LVU1572
+	xorl	%eax, %eax
+	rep stosq
+.LBE657:
+.LBE659:
+	.loc 1 807 24 view .LVU1573
+	movb	$0, axisSetpointsValid(%rip)
+	.loc 1 810 5 is_stmt 1 view .LVU1574
+.LBB660:
+.LBI655:
+	.loc 1 456 13 view .LVU1575
+.LBB658:
+	.loc 1 458 5 view .LVU1576
+	.loc 1 459 5 view .LVU1577
+	.loc 1 459 23 is_stmt 0 view .LVU1578
+	movb	$0, dtermFilterCutoff(%rip)
+.LBE658:
+.LBE660:
+	.loc 1 811 1 view .LVU1579
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	setPIDController, .-setPIDController
+	.section	.bss.baseflightAngleScale,"aw",@nobits
+	.align 16
+	.type	baseflightAngleScale, @object
+	.size	baseflightAngleScale, 24
+baseflightAngleScale:
+	.zero	24
+	.section	.bss.baseflightStickScale,"aw",@nobits
+	.align 16
+	.type	baseflightStickScale, @object
+	.size	baseflightStickScale, 24
+baseflightStickScale:
+	.zero	24
+	.section	.bss.baseflightHLevel,"aw",@nobits
+	.align 16
+	.type	baseflightHLevel, @object
+	.size	baseflightHLevel, 24
+baseflightHLevel:
+	.zero	24
+	.section	.bss.baseflightALevel,"aw",@nobits
+	.align 16
+	.type	baseflightALevel, @object
+	.size	baseflightALevel, 24
+baseflightALevel:
+	.zero	24
+	.section	.bss.baseflightGainsValid,"aw",@nobits
+	.type	baseflightGainsValid, @object
+	.size	baseflightGainsValid, 1
+baseflightGainsValid:
+	.zero	1
+	.section	.bss.baseflightGainsConverted,"aw",@nobits
+	.align 32
+	.type	baseflightGainsConverted, @object
+	.size	baseflightGainsConverted, 48
+baseflightGainsConverted:
+	.zero	48
+	.globl	rcAliasToAngleIndexMap
+	.section	.rodata.rcAliasToAngleIndexMap,"a"
+	.align 8
+	.type	rcAliasToAngleIndexMap, @object
+	.size	rcAliasToAngleIndexMap, 8
+rcAliasToAngleIndexMap:
+	.long	0
+	.long	1
+	.globl	pid_controller
+	.section	.data.rel.local.pid_controller,"aw"
+	.align 8
+	.type	pid_controller, @object
+	.size	pid_controller, 8
+pid_controller:
+	.quad	pidMultiWii
+	.section	.bss.setpointArmingFlags,"aw",@nobits
+	.type	setpointArmingFlags, @object
+	.size	setpointArmingFlags, 1
+setpointArmingFlags:
+	.zero	1
+	.section	.bss.setpointFlightModes,"aw",@nobits
+	.align 2
+	.type	setpointFlightModes, @object
+	.size	setpointFlightModes, 2
+setpointFlightModes:
+	.zero	2
+	.section	.bss.axisSetpointsValid,"aw",@nobits
+	.type	axisSetpointsValid, @object
+	.size	axisSetpointsValid, 1
+axisSetpointsValid:
+	.zero	1
+	.section	.bss.axisSetpoints,"aw",@nobits
+	.type	axisSetpoints, @object
+	.size	axisSetpoints, 6
+axisSetpoints:
+	.zero	6
+	.section	.bss.pidControllerType,"aw",@nobits
+	.type	pidControllerType, @object
+	.size	pidControllerType, 1
+pidControllerType:
+	.zero	1
+	.section	.bss.dtermFilterSamplePeriod,"aw",@nobits
+	.align 4
+	.type	dtermFilterSamplePeriod, @object
+	.size	dtermFilterSamplePeriod, 4
+dtermFilterSamplePeriod:
+	.zero	4
+	.section	.bss.dtermFilterCutoff,"aw",@nobits
+	.type	dtermFilterCutoff, @object
+	.size	dtermFilterCutoff, 1
+dtermFilterCutoff:
+	.zero	1
+	.section	.bss.errorAngleI,"aw",@nobits
+	.align 8
+	.type	errorAngleI, @object
+	.size	errorAngleI, 8
+errorAngleI:
+	.zero	8
+	.section	.bss.axisStates,"aw",@nobits
+	.align 32
+	.type	axisStates, @object
+	.size	axisStates, 216
+axisStates:
+	.zero	216
+	.section	.bss.rateKernels,"aw",@nobits
+	.align 32
+	.type	rateKernels, @object
+	.size	rateKernels, 936
+rateKernels:
+	.zero	936
+	.comm	dynD8,3,1
+	.comm	dynI8,3,1
+	.comm	dynP8,3,1
+	.comm	axisPID,6,2
+	.comm	magHold,2,2
+	.comm	heading,2,2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	2147483647
+	.quad	2147483647
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	2147483647
+	.long	2147483647
+	.section	.rodata.cst16
+	.align 16
+.LC4:
+	.quad	1048576
+	.quad	-1
+	.align 16
+.LC5:
+	.quad	268435456
+	.quad	-1
+	.align 16
+.LC6:
+	.quad	134217728
+	.quad	-1
+	.align 16
+.LC7:
+	.quad	8388608
+	.quad	-1
+	.align 16
+.LC8:
+	.quad	68719476736
+	.quad	4194304000000000
+	.align 16
+.LC9:
+	.quad	274877906944
+	.quad	5033164800
+	.align 16
+.LC10:
+	.quad	2048
+	.quad	-1
+	.align 16
+.LC11:
+	.quad	64
+	.quad	-1
+	.align 16
+.LC13:
+	.quad	0
+	.quad	3
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC14:
+	.byte	1
+	.byte	-1
+	.section	.rodata.cst16
+	.align 16
+.LC15:
+	.quad	0
+	.quad	268435455
+	.align 16
+.LC16:
+	.quad	0
+	.quad	4294967295
+	.align 16
+.LC17:
+	.quad	0
+	.quad	63
+	.align 16
+.LC18:
+	.quad	0
+	.quad	31
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/common/filter.h"
+	.file 7 ".//src/main/config/runtime_config.h"
+	.file 8 ".//src/main/drivers/accgyro.h"
+	.file 9 ".//src/main/sensors/sensors.h"
+	.file 10 ".//src/main/sensors/gyro.h"
+	.file 11 ".//src/main/io/rc_controls.h"
+	.file 12 ".//src/main/flight/flight.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 14 "/usr/include/string.h"
+	.file 15 ".//src/main/common/maths.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x31ec
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3c
+	.long	.LASF1495
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL391
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1235
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1236
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1237
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1238
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1239
+	.uleb128 0x8
+	.long	.LASF1241
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x5d
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1240
+	.uleb128 0x8
+	.long	.LASF1242
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x8
+	.long	.LASF1243
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x7c
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1244
+	.uleb128 0x8
+	.long	.LASF1245
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x43
+	.uleb128 0x8
+	.long	.LASF1246
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	.LASF1247
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x8
+	.long	.LASF1248
+	.byte	0x2
+	.byte	0x2c
+	.byte	0x19
+	.long	0xba
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1249
+	.uleb128 0x8
+	.long	.LASF1250
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x3e
+	.byte	0x8
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1251
+	.uleb128 0x8
+	.long	.LASF1252
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x51
+	.uleb128 0x8
+	.long	.LASF1253
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x8
+	.long	.LASF1254
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0x8
+	.long	.LASF1255
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x8
+	.long	.LASF1256
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x8
+	.long	.LASF1257
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x8
+	.long	.LASF1258
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x8
+	.long	.LASF1259
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0xc1
+	.uleb128 0x8
+	.long	.LASF1260
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1261
+	.uleb128 0x11
+	.long	0xe2
+	.long	0x159
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1277
+	.byte	0x28
+	.byte	0x6
+	.byte	0x22
+	.long	0x1ba
+	.uleb128 0xe
+	.string	"b0"
+	.byte	0x6
+	.byte	0x23
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0xe
+	.string	"b1"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x11
+	.long	0xee
+	.byte	0x4
+	.uleb128 0xe
+	.string	"b2"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x15
+	.long	0xee
+	.byte	0x8
+	.uleb128 0xe
+	.string	"a1"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x19
+	.long	0xee
+	.byte	0xc
+	.uleb128 0xe
+	.string	"a2"
+	.byte	0x6
+	.byte	0x23
+	.byte	0x1d
+	.long	0xee
+	.byte	0x10
+	.uleb128 0xe
+	.string	"d1"
+	.byte	0x6
+	.byte	0x24
+	.byte	0xd
+	.long	0xfa
+	.byte	0x18
+	.uleb128 0xe
+	.string	"d2"
+	.byte	0x6
+	.byte	0x24
+	.byte	0x11
+	.long	0xfa
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1262
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3
+	.long	0x159
+	.uleb128 0x16
+	.long	.LASF1273
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x10
+	.long	0x106
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0x7
+	.byte	0x21
+	.long	0x21c
+	.uleb128 0x5
+	.long	.LASF1263
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1264
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1265
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1266
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1267
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1268
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1269
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1270
+	.byte	0x80
+	.uleb128 0x2f
+	.long	.LASF1271
+	.value	0x100
+	.uleb128 0x2f
+	.long	.LASF1272
+	.value	0x200
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1274
+	.byte	0x7
+	.byte	0x2e
+	.byte	0x11
+	.long	0x112
+	.uleb128 0x8
+	.long	.LASF1275
+	.byte	0x8
+	.byte	0x16
+	.byte	0x10
+	.long	0x234
+	.uleb128 0xb
+	.long	0x239
+	.uleb128 0x3f
+	.uleb128 0x8
+	.long	.LASF1276
+	.byte	0x8
+	.byte	0x17
+	.byte	0x10
+	.long	0x246
+	.uleb128 0xb
+	.long	0x24b
+	.uleb128 0x30
+	.long	0x256
+	.uleb128 0xa
+	.long	0x256
+	.byte	0
+	.uleb128 0xb
+	.long	0xe2
+	.uleb128 0x1a
+	.long	.LASF1278
+	.byte	0x20
+	.byte	0x8
+	.byte	0x19
+	.long	0x2a9
+	.uleb128 0x7
+	.long	.LASF1279
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x17
+	.long	0x228
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1280
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x17
+	.long	0x23a
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1281
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x17
+	.long	0x23a
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1282
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xb
+	.long	0x35
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF1283
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xe
+	.long	0x11e
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1284
+	.byte	0x8
+	.byte	0x1f
+	.byte	0x3
+	.long	0x25b
+	.uleb128 0x11
+	.long	0xe2
+	.long	0x2c5
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1285
+	.byte	0x9
+	.byte	0x42
+	.byte	0x10
+	.long	0xe2
+	.uleb128 0x16
+	.long	.LASF1286
+	.byte	0xa
+	.byte	0x20
+	.byte	0xf
+	.long	0x2a9
+	.uleb128 0x40
+	.long	.LASF1496
+	.byte	0x7
+	.byte	0x4
+	.long	0x4a
+	.byte	0xb
+	.byte	0x34
+	.byte	0xe
+	.long	0x338
+	.uleb128 0x5
+	.long	.LASF1287
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1288
+	.byte	0x1
+	.uleb128 0x41
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1289
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1290
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF1293
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF1294
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1295
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF1296
+	.byte	0xa
+	.uleb128 0x5
+	.long	.LASF1297
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1298
+	.byte	0x6
+	.byte	0xb
+	.byte	0x73
+	.long	0x393
+	.uleb128 0x7
+	.long	.LASF1299
+	.byte	0xb
+	.byte	0x74
+	.byte	0xd
+	.long	0x106
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1300
+	.byte	0xb
+	.byte	0x75
+	.byte	0xd
+	.long	0x106
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF1301
+	.byte	0xb
+	.byte	0x76
+	.byte	0xd
+	.long	0x106
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF1302
+	.byte	0xb
+	.byte	0x77
+	.byte	0xd
+	.long	0x106
+	.byte	0x3
+	.uleb128 0x7
+	.long	.LASF1303
+	.byte	0xb
+	.byte	0x78
+	.byte	0xd
+	.long	0x106
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF1304
+	.byte	0xb
+	.byte	0x79
+	.byte	0xd
+	.long	0x106
+	.byte	0x5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1305
+	.byte	0xb
+	.byte	0x7a
+	.byte	0x3
+	.long	0x338
+	.uleb128 0x16
+	.long	.LASF1306
+	.byte	0xb
+	.byte	0x7c
+	.byte	0x10
+	.long	0x149
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0xc
+	.byte	0x15
+	.long	0x3f9
+	.uleb128 0x5
+	.long	.LASF1307
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1308
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1309
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1310
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1311
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF1314
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF1315
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1316
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF1317
+	.byte	0xa
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1318
+	.byte	0x50
+	.byte	0xc
+	.byte	0x23
+	.long	0x478
+	.uleb128 0xe
+	.string	"P8"
+	.byte	0xc
+	.byte	0x24
+	.byte	0xd
+	.long	0x478
+	.byte	0
+	.uleb128 0xe
+	.string	"I8"
+	.byte	0xc
+	.byte	0x25
+	.byte	0xd
+	.long	0x478
+	.byte	0xa
+	.uleb128 0xe
+	.string	"D8"
+	.byte	0xc
+	.byte	0x26
+	.byte	0xd
+	.long	0x478
+	.byte	0x14
+	.uleb128 0xe
+	.string	"P_f"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xb
+	.long	0x488
+	.byte	0x20
+	.uleb128 0xe
+	.string	"I_f"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xb
+	.long	0x488
+	.byte	0x2c
+	.uleb128 0xe
+	.string	"D_f"
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xb
+	.long	0x488
+	.byte	0x38
+	.uleb128 0x7
+	.long	.LASF1319
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xb
+	.long	0x35
+	.byte	0x44
+	.uleb128 0x7
+	.long	.LASF1320
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xb
+	.long	0x35
+	.byte	0x48
+	.uleb128 0x7
+	.long	.LASF1321
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xd
+	.long	0x106
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x11
+	.long	0x106
+	.long	0x488
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x11
+	.long	0x35
+	.long	0x498
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1322
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x3f9
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0xc
+	.byte	0x31
+	.long	0x4bc
+	.uleb128 0x5
+	.long	.LASF1323
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1324
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1325
+	.byte	0xc
+	.byte	0x34
+	.byte	0x3
+	.long	0x4a4
+	.uleb128 0x1f
+	.long	0x4bc
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0xc
+	.byte	0x39
+	.long	0x4eb
+	.uleb128 0x5
+	.long	.LASF1326
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1327
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1328
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1329
+	.byte	0x4
+	.byte	0xc
+	.byte	0x62
+	.long	0x512
+	.uleb128 0x7
+	.long	.LASF1330
+	.byte	0xc
+	.byte	0x63
+	.byte	0xd
+	.long	0xe2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1331
+	.byte	0xc
+	.byte	0x64
+	.byte	0xd
+	.long	0xe2
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1332
+	.byte	0xc
+	.byte	0x65
+	.byte	0x3
+	.long	0x4eb
+	.uleb128 0x31
+	.byte	0x67
+	.long	0x53a
+	.uleb128 0x32
+	.string	"raw"
+	.byte	0x68
+	.long	0x53a
+	.uleb128 0x33
+	.long	.LASF1333
+	.byte	0x69
+	.byte	0x1d
+	.long	0x512
+	.byte	0
+	.uleb128 0x11
+	.long	0xe2
+	.long	0x54a
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1334
+	.byte	0xc
+	.byte	0x6a
+	.byte	0x3
+	.long	0x51e
+	.uleb128 0x1a
+	.long	.LASF1335
+	.byte	0x4
+	.byte	0xc
+	.byte	0x6c
+	.long	0x57d
+	.uleb128 0x7
+	.long	.LASF1336
+	.byte	0xc
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1337
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xd
+	.long	0xe2
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1338
+	.byte	0xc
+	.byte	0x70
+	.byte	0x3
+	.long	0x556
+	.uleb128 0x31
+	.byte	0x72
+	.long	0x5a5
+	.uleb128 0x32
+	.string	"raw"
+	.byte	0x73
+	.long	0x53a
+	.uleb128 0x33
+	.long	.LASF1333
+	.byte	0x74
+	.byte	0x23
+	.long	0x57d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1339
+	.byte	0xc
+	.byte	0x75
+	.byte	0x3
+	.long	0x589
+	.uleb128 0x16
+	.long	.LASF1340
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x22
+	.long	0x5a5
+	.uleb128 0x16
+	.long	.LASF1341
+	.byte	0xc
+	.byte	0x7d
+	.byte	0x10
+	.long	0x2b5
+	.uleb128 0x16
+	.long	.LASF1342
+	.byte	0xc
+	.byte	0x82
+	.byte	0x10
+	.long	0x2b5
+	.uleb128 0x16
+	.long	.LASF1343
+	.byte	0xc
+	.byte	0x84
+	.byte	0x19
+	.long	0xe2
+	.uleb128 0x11
+	.long	0xee
+	.long	0x5f1
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1344
+	.byte	0x1
+	.byte	0x2b
+	.byte	0x11
+	.long	0x112
+	.uleb128 0x16
+	.long	.LASF1345
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x11
+	.long	0x11e
+	.uleb128 0x25
+	.long	0x2c5
+	.byte	0x2e
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	heading
+	.uleb128 0x25
+	.long	0x5d5
+	.byte	0x2e
+	.byte	0x12
+	.uleb128 0x9
+	.byte	0x3
+	.quad	magHold
+	.uleb128 0x25
+	.long	0x5c9
+	.byte	0x2f
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisPID
+	.uleb128 0x11
+	.long	0x106
+	.long	0x64c
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1346
+	.byte	0x30
+	.byte	0x9
+	.long	0x63c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dynP8
+	.uleb128 0x21
+	.long	.LASF1347
+	.byte	0x30
+	.byte	0x13
+	.long	0x63c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dynI8
+	.uleb128 0x21
+	.long	.LASF1348
+	.byte	0x30
+	.byte	0x1d
+	.long	0x63c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dynD8
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0x1
+	.byte	0x32
+	.long	0x6a9
+	.uleb128 0x5
+	.long	.LASF1349
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1350
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1351
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0x1
+	.byte	0x39
+	.long	0x6c7
+	.uleb128 0x5
+	.long	.LASF1352
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1353
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1354
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1355
+	.byte	0x2
+	.byte	0x1
+	.byte	0x3f
+	.long	0x6ee
+	.uleb128 0x7
+	.long	.LASF1356
+	.byte	0x1
+	.byte	0x40
+	.byte	0xd
+	.long	0x106
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1357
+	.byte	0x1
+	.byte	0x41
+	.byte	0x9
+	.long	0x6ee
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1358
+	.uleb128 0x8
+	.long	.LASF1359
+	.byte	0x1
+	.byte	0x42
+	.byte	0x3
+	.long	0x6c7
+	.uleb128 0x1f
+	.long	0x6f5
+	.uleb128 0x1d
+	.long	0x4a
+	.byte	0x1
+	.byte	0x44
+	.long	0x724
+	.uleb128 0x5
+	.long	.LASF1360
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1361
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1362
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1363
+	.byte	0x1
+	.byte	0x48
+	.byte	0x3
+	.long	0x706
+	.uleb128 0x1a
+	.long	.LASF1364
+	.byte	0x18
+	.byte	0x1
+	.byte	0x4b
+	.long	0x771
+	.uleb128 0x7
+	.long	.LASF1365
+	.byte	0x1
+	.byte	0x4c
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1366
+	.byte	0x1
+	.byte	0x4d
+	.byte	0xd
+	.long	0xfa
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1367
+	.byte	0x1
+	.byte	0x4e
+	.byte	0xd
+	.long	0xee
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1368
+	.byte	0x1
+	.byte	0x4f
+	.byte	0xd
+	.long	0x106
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1369
+	.byte	0x1
+	.byte	0x50
+	.byte	0x3
+	.long	0x730
+	.uleb128 0x1f
+	.long	0x771
+	.uleb128 0x42
+	.long	.LASF1370
+	.value	0x138
+	.byte	0x1
+	.byte	0x57
+	.byte	0x10
+	.long	0x884
+	.uleb128 0x7
+	.long	.LASF1371
+	.byte	0x1
+	.byte	0x58
+	.byte	0x10
+	.long	0x771
+	.byte	0
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x1
+	.byte	0x59
+	.byte	0x10
+	.long	0x771
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF1372
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x10
+	.long	0x884
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF1373
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x10
+	.long	0x884
+	.byte	0x60
+	.uleb128 0x7
+	.long	.LASF1374
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x10
+	.long	0x884
+	.byte	0x90
+	.uleb128 0xe
+	.string	"D"
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x10
+	.long	0x771
+	.byte	0xc0
+	.uleb128 0x7
+	.long	.LASF1375
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x10
+	.long	0x771
+	.byte	0xd8
+	.uleb128 0x7
+	.long	.LASF1376
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x10
+	.long	0x771
+	.byte	0xf0
+	.uleb128 0x17
+	.long	.LASF1377
+	.byte	0x60
+	.byte	0xd
+	.long	0xfa
+	.value	0x108
+	.uleb128 0x17
+	.long	.LASF1378
+	.byte	0x61
+	.byte	0xd
+	.long	0xfa
+	.value	0x110
+	.uleb128 0x17
+	.long	.LASF1379
+	.byte	0x62
+	.byte	0xd
+	.long	0xfa
+	.value	0x118
+	.uleb128 0x17
+	.long	.LASF1380
+	.byte	0x63
+	.byte	0xd
+	.long	0xfa
+	.value	0x120
+	.uleb128 0x17
+	.long	.LASF1381
+	.byte	0x64
+	.byte	0xd
+	.long	0xee
+	.value	0x128
+	.uleb128 0x17
+	.long	.LASF1382
+	.byte	0x65
+	.byte	0xd
+	.long	0xee
+	.value	0x12c
+	.uleb128 0x17
+	.long	.LASF1383
+	.byte	0x66
+	.byte	0xd
+	.long	0xee
+	.value	0x130
+	.uleb128 0x17
+	.long	.LASF1384
+	.byte	0x67
+	.byte	0xc
+	.long	0xd6
+	.value	0x134
+	.uleb128 0x17
+	.long	.LASF1385
+	.byte	0x68
+	.byte	0xc
+	.long	0xd6
+	.value	0x135
+	.uleb128 0x17
+	.long	.LASF1386
+	.byte	0x69
+	.byte	0xc
+	.long	0xd6
+	.value	0x136
+	.uleb128 0x17
+	.long	.LASF1387
+	.byte	0x6a
+	.byte	0xc
+	.long	0xd6
+	.value	0x137
+	.byte	0
+	.uleb128 0x11
+	.long	0x771
+	.long	0x894
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1388
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x3
+	.long	0x782
+	.uleb128 0x1f
+	.long	0x894
+	.uleb128 0x1a
+	.long	.LASF1389
+	.byte	0x18
+	.byte	0x1
+	.byte	0x6e
+	.long	0x900
+	.uleb128 0x7
+	.long	.LASF1356
+	.byte	0x1
+	.byte	0x6f
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1390
+	.byte	0x1
+	.byte	0x70
+	.byte	0xd
+	.long	0xee
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1391
+	.byte	0x1
+	.byte	0x71
+	.byte	0xd
+	.long	0xee
+	.byte	0xc
+	.uleb128 0x7
+	.long	.LASF1392
+	.byte	0x1
+	.byte	0x72
+	.byte	0xd
+	.long	0xee
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1393
+	.byte	0x1
+	.byte	0x73
+	.byte	0xd
+	.long	0xe2
+	.byte	0x14
+	.uleb128 0x7
+	.long	.LASF1394
+	.byte	0x1
+	.byte	0x74
+	.byte	0xd
+	.long	0xe2
+	.byte	0x16
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1395
+	.byte	0x1
+	.byte	0x75
+	.byte	0x3
+	.long	0x8a5
+	.uleb128 0x1f
+	.long	0x900
+	.uleb128 0x1a
+	.long	.LASF1396
+	.byte	0x48
+	.byte	0x1
+	.byte	0x77
+	.long	0x95f
+	.uleb128 0x7
+	.long	.LASF1397
+	.byte	0x1
+	.byte	0x78
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1398
+	.byte	0x1
+	.byte	0x79
+	.byte	0xd
+	.long	0xfa
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1399
+	.byte	0x1
+	.byte	0x7a
+	.byte	0xd
+	.long	0xfa
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1400
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x15
+	.long	0xfa
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF1401
+	.byte	0x1
+	.byte	0x7b
+	.byte	0x19
+	.long	0x1ba
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1402
+	.byte	0x1
+	.byte	0x7c
+	.byte	0x3
+	.long	0x911
+	.uleb128 0x11
+	.long	0x894
+	.long	0x97b
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1403
+	.byte	0x7e
+	.byte	0x18
+	.long	0x96b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rateKernels
+	.uleb128 0x11
+	.long	0x95f
+	.long	0x9a0
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1404
+	.byte	0x7f
+	.byte	0x17
+	.long	0x990
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisStates
+	.uleb128 0x18
+	.long	.LASF1405
+	.byte	0x81
+	.byte	0x10
+	.long	0x5e1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	errorAngleI
+	.uleb128 0x18
+	.long	.LASF1406
+	.byte	0x83
+	.byte	0x10
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dtermFilterCutoff
+	.uleb128 0x18
+	.long	.LASF1407
+	.byte	0x84
+	.byte	0x11
+	.long	0x11e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dtermFilterSamplePeriod
+	.uleb128 0x18
+	.long	.LASF1408
+	.byte	0x89
+	.byte	0x10
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pidControllerType
+	.uleb128 0x11
+	.long	0x6f5
+	.long	0xa19
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1409
+	.byte	0x8c
+	.byte	0x1a
+	.long	0xa09
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisSetpoints
+	.uleb128 0x18
+	.long	.LASF1410
+	.byte	0x8d
+	.byte	0xc
+	.long	0x6ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisSetpointsValid
+	.uleb128 0x18
+	.long	.LASF1411
+	.byte	0x8e
+	.byte	0x11
+	.long	0x112
+	.uleb128 0x9
+	.byte	0x3
+	.quad	setpointFlightModes
+	.uleb128 0x18
+	.long	.LASF1412
+	.byte	0x8f
+	.byte	0x10
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	setpointArmingFlags
+	.uleb128 0x8
+	.long	.LASF1413
+	.byte	0x1
+	.byte	0x94
+	.byte	0x10
+	.long	0xa79
+	.uleb128 0xb
+	.long	0xa7e
+	.uleb128 0x30
+	.long	0xa98
+	.uleb128 0xa
+	.long	0xa98
+	.uleb128 0xa
+	.long	0xa9d
+	.uleb128 0xa
+	.long	0x112
+	.uleb128 0xa
+	.long	0xaa2
+	.byte	0
+	.uleb128 0xb
+	.long	0x498
+	.uleb128 0xb
+	.long	0x393
+	.uleb128 0xb
+	.long	0x54a
+	.uleb128 0x21
+	.long	.LASF1414
+	.byte	0x97
+	.byte	0x16
+	.long	0xa6d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pid_controller
+	.uleb128 0x11
+	.long	0x4c8
+	.long	0xacc
+	.uleb128 0x12
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1f
+	.long	0xabc
+	.uleb128 0x21
+	.long	.LASF1415
+	.byte	0xac
+	.byte	0x15
+	.long	0xacc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcAliasToAngleIndexMap
+	.uleb128 0x43
+	.long	.LASF1416
+	.byte	0x30
+	.byte	0x1
+	.value	0x1d6
+	.byte	0x10
+	.long	0xb3d
+	.uleb128 0x26
+	.string	"P_f"
+	.value	0x1d7
+	.long	0x488
+	.byte	0
+	.uleb128 0x26
+	.string	"I_f"
+	.value	0x1d8
+	.long	0x488
+	.byte	0xc
+	.uleb128 0x26
+	.string	"D_f"
+	.value	0x1d9
+	.long	0x488
+	.byte	0x18
+	.uleb128 0x27
+	.long	.LASF1319
+	.value	0x1da
+	.long	0x35
+	.byte	0x24
+	.uleb128 0x27
+	.long	.LASF1320
+	.value	0x1db
+	.long	0x35
+	.byte	0x28
+	.uleb128 0x27
+	.long	.LASF1417
+	.value	0x1dc
+	.long	0x35
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF1418
+	.byte	0x1
+	.value	0x1dd
+	.byte	0x3
+	.long	0xae6
+	.uleb128 0x1c
+	.long	.LASF1419
+	.value	0x1df
+	.byte	0x1a
+	.long	0xb3d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightGainsConverted
+	.uleb128 0x1c
+	.long	.LASF1420
+	.value	0x1e0
+	.byte	0xc
+	.long	0x6ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightGainsValid
+	.uleb128 0x1c
+	.long	.LASF1421
+	.value	0x1e1
+	.byte	0x13
+	.long	0x771
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightALevel
+	.uleb128 0x1c
+	.long	.LASF1422
+	.value	0x1e1
+	.byte	0x25
+	.long	0x771
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightHLevel
+	.uleb128 0x1c
+	.long	.LASF1423
+	.value	0x1e2
+	.byte	0x13
+	.long	0x771
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightStickScale
+	.uleb128 0x1c
+	.long	.LASF1424
+	.value	0x1e2
+	.byte	0x29
+	.long	0x771
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightAngleScale
+	.uleb128 0x45
+	.long	.LASF1425
+	.byte	0xd
+	.value	0x13d
+	.byte	0x11
+	.long	0xba
+	.long	0xbe5
+	.uleb128 0xa
+	.long	0x35
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1426
+	.byte	0xd
+	.byte	0x65
+	.byte	0xe
+	.long	0x35
+	.long	0xc00
+	.uleb128 0xa
+	.long	0x35
+	.uleb128 0xa
+	.long	0x9b
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1427
+	.byte	0xd
+	.byte	0x62
+	.byte	0xe
+	.long	0x35
+	.long	0xc1b
+	.uleb128 0xa
+	.long	0x35
+	.uleb128 0xa
+	.long	0xc1b
+	.byte	0
+	.uleb128 0xb
+	.long	0x9b
+	.uleb128 0x1e
+	.long	.LASF1428
+	.byte	0xe
+	.byte	0x40
+	.byte	0xc
+	.long	0x9b
+	.long	0xc40
+	.uleb128 0xa
+	.long	0xc40
+	.uleb128 0xa
+	.long	0xc40
+	.uleb128 0xa
+	.long	0x136
+	.byte	0
+	.uleb128 0xb
+	.long	0xc45
+	.uleb128 0x46
+	.uleb128 0x1e
+	.long	.LASF1429
+	.byte	0xe
+	.byte	0x2b
+	.byte	0xe
+	.long	0xcd
+	.long	0xc66
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0xa
+	.long	0xc40
+	.uleb128 0xa
+	.long	0x136
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1430
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x9
+	.long	0xfa
+	.long	0xc81
+	.uleb128 0xa
+	.long	0xc81
+	.uleb128 0xa
+	.long	0xee
+	.byte	0
+	.uleb128 0xb
+	.long	0x1ba
+	.uleb128 0x47
+	.long	.LASF1497
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x6
+	.long	0xca2
+	.uleb128 0xa
+	.long	0xc81
+	.uleb128 0xa
+	.long	0x112
+	.uleb128 0xa
+	.long	0x11e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1431
+	.byte	0xf
+	.byte	0x2d
+	.byte	0x5
+	.long	0x9b
+	.long	0xcc2
+	.uleb128 0xa
+	.long	0x9b
+	.uleb128 0xa
+	.long	0x9b
+	.uleb128 0xa
+	.long	0x9b
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1432
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xe
+	.long	0xcd
+	.long	0xce2
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0xa
+	.long	0x9b
+	.uleb128 0xa
+	.long	0x136
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1498
+	.byte	0x1
+	.value	0x317
+	.byte	0x6
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd2d
+	.uleb128 0xc
+	.long	.LASF1433
+	.value	0x317
+	.byte	0x1b
+	.long	0x9b
+	.long	.LLST389
+	.long	.LVUS389
+	.uleb128 0x49
+	.long	0x1ffa
+	.quad	.LBI655
+	.value	.LVU1575
+	.long	.LLRL390
+	.byte	0x1
+	.value	0x32a
+	.byte	0x5
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1443
+	.value	0x2de
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11e5
+	.uleb128 0xc
+	.long	.LASF1434
+	.value	0x2de
+	.byte	0x26
+	.long	0xa98
+	.long	.LLST270
+	.long	.LVUS270
+	.uleb128 0xc
+	.long	.LASF1435
+	.value	0x2de
+	.byte	0x47
+	.long	0xa9d
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0xc
+	.long	.LASF1436
+	.value	0x2de
+	.byte	0x63
+	.long	0x112
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0xc
+	.long	.LASF1437
+	.value	0x2df
+	.byte	0x1e
+	.long	0xaa2
+	.long	.LLST273
+	.long	.LVUS273
+	.uleb128 0x9
+	.long	.LASF1438
+	.value	0x2e1
+	.byte	0xd
+	.long	0xee
+	.long	.LLST274
+	.long	.LVUS274
+	.uleb128 0x9
+	.long	.LASF1439
+	.value	0x2e2
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST275
+	.long	.LVUS275
+	.uleb128 0x1c
+	.long	.LASF1440
+	.value	0x2e3
+	.byte	0x14
+	.long	0x900
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x9
+	.long	.LASF1441
+	.value	0x2e4
+	.byte	0x9
+	.long	0x6ee
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x28
+	.long	.LLRL277
+	.long	0xea3
+	.uleb128 0x9
+	.long	.LASF1356
+	.value	0x2f0
+	.byte	0x22
+	.long	0x11e5
+	.long	.LLST278
+	.long	.LVUS278
+	.uleb128 0x6
+	.long	0x2d0d
+	.quad	.LBI539
+	.value	.LVU1119
+	.long	.LLRL279
+	.value	0x2f8
+	.byte	0x1e
+	.long	0xe7d
+	.uleb128 0x1
+	.long	0x2d40
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x1
+	.long	0x2d34
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x1
+	.long	0x2d28
+	.long	.LLST282
+	.long	.LVUS282
+	.uleb128 0x1
+	.long	0x2d1c
+	.long	.LLST283
+	.long	.LVUS283
+	.uleb128 0x4
+	.long	.LLRL279
+	.uleb128 0x34
+	.long	0x2d4c
+	.uleb128 0x13
+	.quad	.LVL237
+	.long	0xca2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL232
+	.long	0x25ed
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x11ea
+	.quad	.LBB552
+	.quad	.LBE552-.LBB552
+	.value	0x2e7
+	.long	0x11bf
+	.uleb128 0x2
+	.long	0x11f5
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x2
+	.long	0x1201
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI554
+	.value	.LVU1182
+	.long	.LLRL286
+	.value	0x2d0
+	.byte	0x9
+	.long	0xf3a
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0x4
+	.long	.LLRL286
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST291
+	.long	.LVUS291
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI557
+	.value	.LVU1169
+	.quad	.LBB557
+	.quad	.LBE557-.LBB557
+	.value	0x2cf
+	.byte	0x9
+	.long	0xfa2
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST292
+	.long	.LVUS292
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST292
+	.long	.LVUS292
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST295
+	.long	.LVUS295
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST296
+	.long	.LVUS296
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI560
+	.value	.LVU1195
+	.quad	.LBB560
+	.quad	.LBE560-.LBB560
+	.value	0x2d3
+	.byte	0x9
+	.long	0x100a
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST301
+	.long	.LVUS301
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI562
+	.value	.LVU1208
+	.quad	.LBB562
+	.quad	.LBE562-.LBB562
+	.value	0x2d4
+	.byte	0x9
+	.long	0x1072
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST306
+	.long	.LVUS306
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI564
+	.value	.LVU1221
+	.quad	.LBB564
+	.quad	.LBE564-.LBB564
+	.value	0x2d5
+	.byte	0x9
+	.long	0x10da
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST309
+	.long	.LVUS309
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST310
+	.long	.LVUS310
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST311
+	.long	.LVUS311
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI566
+	.value	.LVU1234
+	.quad	.LBB566
+	.quad	.LBE566-.LBB566
+	.value	0x2d6
+	.byte	0x9
+	.long	0x1142
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST313
+	.long	.LVUS313
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST315
+	.long	.LVUS315
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST316
+	.long	.LVUS316
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI568
+	.value	.LVU1247
+	.quad	.LBB568
+	.quad	.LBE568-.LBB568
+	.value	0x2d7
+	.byte	0x9
+	.long	0x11aa
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST318
+	.long	.LVUS318
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST317
+	.long	.LVUS317
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST321
+	.long	.LVUS321
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL243
+	.long	0x2004
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL222
+	.long	0x2db2
+	.long	0x11d7
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL224
+	.long	0x2d59
+	.byte	0
+	.uleb128 0xb
+	.long	0x701
+	.uleb128 0x23
+	.long	.LASF1446
+	.value	0x2c5
+	.long	0x120e
+	.uleb128 0x10
+	.long	.LASF1442
+	.value	0x2c7
+	.byte	0x16
+	.long	0x120e
+	.uleb128 0x10
+	.long	.LASF1439
+	.value	0x2c8
+	.byte	0x9
+	.long	0x9b
+	.byte	0
+	.uleb128 0xb
+	.long	0x894
+	.uleb128 0x22
+	.long	.LASF1444
+	.value	0x283
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1758
+	.uleb128 0xc
+	.long	.LASF1434
+	.value	0x283
+	.byte	0x27
+	.long	0xa98
+	.long	.LLST322
+	.long	.LVUS322
+	.uleb128 0xc
+	.long	.LASF1435
+	.value	0x283
+	.byte	0x48
+	.long	0xa9d
+	.long	.LLST323
+	.long	.LVUS323
+	.uleb128 0xc
+	.long	.LASF1436
+	.value	0x284
+	.byte	0x12
+	.long	0x112
+	.long	.LLST324
+	.long	.LVUS324
+	.uleb128 0xc
+	.long	.LASF1437
+	.value	0x284
+	.byte	0x3e
+	.long	0xaa2
+	.long	.LLST325
+	.long	.LVUS325
+	.uleb128 0x9
+	.long	.LASF1439
+	.value	0x286
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x9
+	.long	.LASF1445
+	.value	0x286
+	.byte	0xf
+	.long	0x9b
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x9
+	.long	.LASF1438
+	.value	0x287
+	.byte	0xd
+	.long	0xee
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x1c
+	.long	.LASF1440
+	.value	0x288
+	.byte	0x14
+	.long	0x900
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x9
+	.long	.LASF1441
+	.value	0x289
+	.byte	0x9
+	.long	0x6ee
+	.long	.LLST329
+	.long	.LVUS329
+	.uleb128 0x28
+	.long	.LLRL330
+	.long	0x13c1
+	.uleb128 0x9
+	.long	.LASF1356
+	.value	0x296
+	.byte	0x22
+	.long	0x11e5
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x6
+	.long	0x2d0d
+	.quad	.LBI593
+	.value	.LVU1342
+	.long	.LLRL332
+	.value	0x29a
+	.byte	0x1a
+	.long	0x1377
+	.uleb128 0x1
+	.long	0x2d40
+	.long	.LLST333
+	.long	.LVUS333
+	.uleb128 0x1
+	.long	0x2d34
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x1
+	.long	0x2d28
+	.long	.LLST335
+	.long	.LVUS335
+	.uleb128 0x1
+	.long	0x2d1c
+	.long	.LLST336
+	.long	.LVUS336
+	.uleb128 0x4
+	.long	.LLRL332
+	.uleb128 0x34
+	.long	0x2d4c
+	.uleb128 0x13
+	.quad	.LVL268
+	.long	0xca2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL262
+	.long	0x25ed
+	.long	0x1397
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -136
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL270
+	.long	0xca2
+	.uleb128 0x13
+	.quad	.LVL271
+	.long	0xca2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xb
+	.value	0xd8f0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2710
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x1758
+	.quad	.LBB607
+	.quad	.LBE607-.LBB607
+	.value	0x28e
+	.long	0x1732
+	.uleb128 0x2
+	.long	0x1763
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x2
+	.long	0x176f
+	.long	.LLST338
+	.long	.LVUS338
+	.uleb128 0x4a
+	.long	0x177b
+	.long	.LLRL339
+	.uleb128 0x2
+	.long	0x177c
+	.long	.LLST340
+	.long	.LVUS340
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI610
+	.value	.LVU1435
+	.long	.LLRL341
+	.value	0x275
+	.byte	0x9
+	.long	0x146e
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x4
+	.long	.LLRL341
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST346
+	.long	.LVUS346
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI614
+	.value	.LVU1393
+	.long	.LLRL347
+	.value	0x273
+	.byte	0x9
+	.long	0x14d0
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST349
+	.long	.LVUS349
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST351
+	.long	.LVUS351
+	.uleb128 0x4
+	.long	.LLRL347
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST352
+	.long	.LVUS352
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI621
+	.value	.LVU1424
+	.long	.LLRL353
+	.value	0x274
+	.byte	0x9
+	.long	0x1532
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST355
+	.long	.LVUS355
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST356
+	.long	.LVUS356
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST357
+	.long	.LVUS357
+	.uleb128 0x4
+	.long	.LLRL353
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST358
+	.long	.LVUS358
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI625
+	.value	.LVU1446
+	.long	.LLRL359
+	.value	0x276
+	.byte	0x9
+	.long	0x1594
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST360
+	.long	.LVUS360
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST361
+	.long	.LVUS361
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST363
+	.long	.LVUS363
+	.uleb128 0x4
+	.long	.LLRL359
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST364
+	.long	.LVUS364
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI628
+	.value	.LVU1457
+	.long	.LLRL365
+	.value	0x277
+	.byte	0x9
+	.long	0x15f6
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST366
+	.long	.LVUS366
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST367
+	.long	.LVUS367
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST369
+	.long	.LVUS369
+	.uleb128 0x4
+	.long	.LLRL365
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST370
+	.long	.LVUS370
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI631
+	.value	.LVU1468
+	.long	.LLRL371
+	.value	0x278
+	.byte	0x9
+	.long	0x1658
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST373
+	.long	.LVUS373
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST375
+	.long	.LVUS375
+	.uleb128 0x4
+	.long	.LLRL371
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST376
+	.long	.LVUS376
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI634
+	.value	.LVU1479
+	.long	.LLRL377
+	.value	0x279
+	.byte	0x9
+	.long	0x16ba
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST378
+	.long	.LVUS378
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST379
+	.long	.LVUS379
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST381
+	.long	.LVUS381
+	.uleb128 0x4
+	.long	.LLRL377
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST382
+	.long	.LVUS382
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI637
+	.value	.LVU1490
+	.long	.LLRL383
+	.value	0x27a
+	.byte	0x9
+	.long	0x171c
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST384
+	.long	.LVUS384
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST385
+	.long	.LVUS385
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST386
+	.long	.LVUS386
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x4
+	.long	.LLRL383
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST388
+	.long	.LVUS388
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL278
+	.long	0x2004
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL253
+	.long	0x2db2
+	.long	0x174a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL255
+	.long	0x2d59
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1447
+	.value	0x266
+	.long	0x178a
+	.uleb128 0x10
+	.long	.LASF1442
+	.value	0x268
+	.byte	0x16
+	.long	0x120e
+	.uleb128 0x10
+	.long	.LASF1439
+	.value	0x269
+	.byte	0x9
+	.long	0x9b
+	.uleb128 0x4b
+	.uleb128 0x10
+	.long	.LASF1448
+	.value	0x26d
+	.byte	0xd
+	.long	0x6ee
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1449
+	.value	0x222
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f9a
+	.uleb128 0xc
+	.long	.LASF1434
+	.value	0x222
+	.byte	0x29
+	.long	0xa98
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0xc
+	.long	.LASF1435
+	.value	0x222
+	.byte	0x4a
+	.long	0xa9d
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0xc
+	.long	.LASF1436
+	.value	0x223
+	.byte	0x12
+	.long	0x112
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0xc
+	.long	.LASF1437
+	.value	0x223
+	.byte	0x3e
+	.long	0xaa2
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x1c
+	.long	.LASF1440
+	.value	0x225
+	.byte	0x14
+	.long	0x900
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x9
+	.long	.LASF1450
+	.value	0x226
+	.byte	0x10
+	.long	0x771
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x9
+	.long	.LASF1438
+	.value	0x227
+	.byte	0xd
+	.long	0xfa
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x9
+	.long	.LASF1439
+	.value	0x228
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x9
+	.long	.LASF1441
+	.value	0x229
+	.byte	0x9
+	.long	0x6ee
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x28
+	.long	.LLRL212
+	.long	0x1aa0
+	.uleb128 0x9
+	.long	.LASF1356
+	.value	0x238
+	.byte	0x22
+	.long	0x11e5
+	.long	.LLST213
+	.long	.LVUS213
+	.uleb128 0x6
+	.long	0x2d0d
+	.quad	.LBI427
+	.value	.LVU824
+	.long	.LLRL214
+	.value	0x240
+	.byte	0x27
+	.long	0x18f6
+	.uleb128 0x1
+	.long	0x2d40
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x1
+	.long	0x2d34
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x1
+	.long	0x2d28
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x1
+	.long	0x2d1c
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x4
+	.long	.LLRL214
+	.uleb128 0x2
+	.long	0x2d4c
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x13
+	.quad	.LVL188
+	.long	0xca2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI435
+	.value	.LVU765
+	.long	.LLRL220
+	.value	0x251
+	.byte	0x22
+	.long	0x1936
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x24
+	.long	0x2e65
+	.uleb128 0x4
+	.long	.LLRL220
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x2e56
+	.quad	.LBI441
+	.value	.LVU788
+	.quad	.LBB441
+	.quad	.LBE441-.LBB441
+	.value	0x255
+	.byte	0x27
+	.long	0x1984
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST225
+	.long	.LVUS225
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI444
+	.value	.LVU832
+	.long	.LLRL226
+	.value	0x240
+	.byte	0x1e
+	.long	0x19c4
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x24
+	.long	0x2e65
+	.uleb128 0x4
+	.long	.LLRL226
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST228
+	.long	.LVUS228
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x2e56
+	.quad	.LBI455
+	.value	.LVU855
+	.quad	.LBB455
+	.quad	.LBE455-.LBB455
+	.value	0x24e
+	.byte	0x22
+	.long	0x1a12
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST230
+	.long	.LVUS230
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST231
+	.long	.LVUS231
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI457
+	.value	.LVU872
+	.long	.LLRL232
+	.value	0x23c
+	.byte	0x1e
+	.long	0x1a52
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x24
+	.long	0x2e65
+	.uleb128 0x4
+	.long	.LLRL232
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST234
+	.long	.LVUS234
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL182
+	.long	0x25ed
+	.long	0x1a7b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL202
+	.long	0x25ed
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -160
+	.byte	0x6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1f9a
+	.quad	.LBI402
+	.value	.LVU654
+	.long	.LLRL192
+	.value	0x22e
+	.byte	0x5
+	.long	0x1bc5
+	.uleb128 0x1
+	.long	0x1fa5
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x4
+	.long	.LLRL192
+	.uleb128 0x4c
+	.long	0x1fb1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x2
+	.long	0x1fbd
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x2
+	.long	0x1fc9
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0xf
+	.quad	.LVL147
+	.long	0x2f06
+	.long	0x1b16
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -168
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL148
+	.long	0x2f06
+	.long	0x1b33
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL149
+	.long	0x2f06
+	.long	0x1b50
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 48
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL151
+	.long	0x2f06
+	.long	0x1b6e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -144
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL152
+	.long	0x2f06
+	.long	0x1b9c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightALevel
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -140
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL153
+	.long	0x2f06
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baseflightHLevel
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xe
+	.uleb128 0x35
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e8f
+	.quad	.LBI412
+	.value	.LVU701
+	.long	.LLRL196
+	.value	0x230
+	.byte	0x5
+	.long	0x1cca
+	.uleb128 0x1
+	.long	0x2ea4
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x1
+	.long	0x2eba
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0x1
+	.long	0x2ec5
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x1
+	.long	0x2eaf
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x1
+	.long	0x2e99
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x4
+	.long	.LLRL196
+	.uleb128 0x2
+	.long	0x2ed0
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x29
+	.long	0x2ee1
+	.quad	.LBI414
+	.value	.LVU703
+	.long	.LLRL203
+	.byte	0xfa
+	.byte	0x1c
+	.long	0x1c6c
+	.uleb128 0x1
+	.long	0x2eef
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x4
+	.long	.LLRL203
+	.uleb128 0x2
+	.long	0x2efa
+	.long	.LLST205
+	.long	.LVUS205
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI419
+	.value	.LVU724
+	.long	.LLRL206
+	.byte	0xfc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x4
+	.long	.LLRL206
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST211
+	.long	.LVUS211
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	0x1fd6
+	.long	.LLRL235
+	.byte	0x1
+	.value	0x22c
+	.byte	0x9
+	.long	0x1f74
+	.uleb128 0x4
+	.long	.LLRL235
+	.uleb128 0x2
+	.long	0x1fe1
+	.long	.LLST236
+	.long	.LVUS236
+	.uleb128 0x2
+	.long	0x1fed
+	.long	.LLST237
+	.long	.LVUS237
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI475
+	.value	.LVU918
+	.quad	.LBB475
+	.quad	.LBE475-.LBB475
+	.value	0x1f0
+	.byte	0x9
+	.long	0x1d62
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST239
+	.long	.LVUS239
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST240
+	.long	.LVUS240
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST242
+	.long	.LVUS242
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI477
+	.value	.LVU933
+	.quad	.LBB477
+	.quad	.LBE477-.LBB477
+	.value	0x1f1
+	.byte	0x9
+	.long	0x1dca
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST247
+	.long	.LVUS247
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI479
+	.value	.LVU948
+	.quad	.LBB479
+	.quad	.LBE479-.LBB479
+	.value	0x1f3
+	.byte	0x9
+	.long	0x1e32
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST252
+	.long	.LVUS252
+	.byte	0
+	.uleb128 0xd
+	.long	0x3124
+	.quad	.LBI481
+	.value	.LVU963
+	.quad	.LBB481
+	.quad	.LBE481-.LBB481
+	.value	0x1f4
+	.byte	0x9
+	.long	0x1e9a
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST255
+	.long	.LVUS255
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST256
+	.long	.LVUS256
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST257
+	.long	.LVUS257
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI483
+	.value	.LVU989
+	.long	.LLRL258
+	.value	0x1fd
+	.byte	0x5
+	.long	0x1efc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST259
+	.long	.LVUS259
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST261
+	.long	.LVUS261
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x4
+	.long	.LLRL258
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST263
+	.long	.LVUS263
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3124
+	.quad	.LBI491
+	.value	.LVU1008
+	.long	.LLRL264
+	.value	0x1fe
+	.byte	0x5
+	.long	0x1f5e
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST265
+	.long	.LVUS265
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x4
+	.long	.LLRL264
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL211
+	.long	0x2004
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL140
+	.long	0x2db2
+	.long	0x1f8c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL142
+	.long	0x2d59
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1451
+	.value	0x203
+	.long	0x1fd6
+	.uleb128 0x1b
+	.long	.LASF1434
+	.value	0x203
+	.byte	0x32
+	.long	0xa98
+	.uleb128 0x10
+	.long	.LASF1452
+	.value	0x205
+	.byte	0x17
+	.long	0xb3d
+	.uleb128 0x10
+	.long	.LASF1442
+	.value	0x206
+	.byte	0x16
+	.long	0x120e
+	.uleb128 0x10
+	.long	.LASF1439
+	.value	0x207
+	.byte	0x9
+	.long	0x9b
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1453
+	.value	0x1e4
+	.long	0x1ffa
+	.uleb128 0x10
+	.long	.LASF1442
+	.value	0x1e6
+	.byte	0x16
+	.long	0x120e
+	.uleb128 0x10
+	.long	.LASF1439
+	.value	0x1e7
+	.byte	0x9
+	.long	0x9b
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1499
+	.byte	0x1
+	.value	0x1c8
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x22
+	.long	.LASF1454
+	.value	0x1ae
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25ed
+	.uleb128 0x4f
+	.long	.LASF1442
+	.byte	0x1
+	.value	0x1ae
+	.byte	0x34
+	.long	0x120e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI150
+	.value	.LVU53
+	.long	.LLRL2
+	.value	0x1b0
+	.byte	0x5
+	.long	0x20b4
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI151
+	.value	.LVU55
+	.long	.LLRL2
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x4
+	.long	.LLRL2
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI155
+	.value	.LVU69
+	.long	.LLRL9
+	.value	0x1b1
+	.byte	0x5
+	.long	0x2138
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI156
+	.value	.LVU71
+	.long	.LLRL9
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.long	.LLRL9
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI160
+	.value	.LVU83
+	.long	.LLRL16
+	.value	0x1b2
+	.byte	0x5
+	.long	0x21bc
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI161
+	.value	.LVU85
+	.long	.LLRL16
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x4
+	.long	.LLRL16
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI165
+	.value	.LVU97
+	.long	.LLRL23
+	.value	0x1b3
+	.byte	0x5
+	.long	0x2240
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI166
+	.value	.LVU99
+	.long	.LLRL23
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x4
+	.long	.LLRL23
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI170
+	.value	.LVU111
+	.long	.LLRL30
+	.value	0x1b4
+	.byte	0x5
+	.long	0x22c4
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI171
+	.value	.LVU113
+	.long	.LLRL30
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x4
+	.long	.LLRL30
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI175
+	.value	.LVU125
+	.long	.LLRL37
+	.value	0x1b5
+	.byte	0x5
+	.long	0x2348
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI176
+	.value	.LVU127
+	.long	.LLRL37
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x4
+	.long	.LLRL37
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST43
+	.long	.LVUS43
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI180
+	.value	.LVU139
+	.long	.LLRL44
+	.value	0x1b6
+	.byte	0x5
+	.long	0x23cc
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI181
+	.value	.LVU141
+	.long	.LLRL44
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x4
+	.long	.LLRL44
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI185
+	.value	.LVU153
+	.long	.LLRL51
+	.value	0x1b7
+	.byte	0x5
+	.long	0x2450
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI186
+	.value	.LVU155
+	.long	.LLRL51
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x4
+	.long	.LLRL51
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI190
+	.value	.LVU167
+	.long	.LLRL58
+	.value	0x1b8
+	.byte	0x5
+	.long	0x24d4
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI191
+	.value	.LVU169
+	.long	.LLRL58
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x4
+	.long	.LLRL58
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x310e
+	.quad	.LBI195
+	.value	.LVU181
+	.long	.LLRL65
+	.value	0x1b9
+	.byte	0x5
+	.long	0x2558
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x19
+	.long	0x3124
+	.quad	.LBI196
+	.value	.LVU183
+	.long	.LLRL65
+	.byte	0xcc
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x4
+	.long	.LLRL65
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	0x310e
+	.quad	.LBI210
+	.value	.LVU195
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.value	0x1ba
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x3118
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x50
+	.long	0x3124
+	.quad	.LBI211
+	.value	.LVU197
+	.quad	.LBB211
+	.quad	.LBE211-.LBB211
+	.byte	0x1
+	.byte	0xcc
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1469
+	.value	0x182
+	.byte	0x10
+	.long	0xe2
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2cbe
+	.uleb128 0xc
+	.long	.LASF1439
+	.value	0x182
+	.byte	0x22
+	.long	0x9b
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0xc
+	.long	.LASF1440
+	.value	0x182
+	.byte	0x3e
+	.long	0x2cbe
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0xc
+	.long	.LASF1441
+	.value	0x182
+	.byte	0x49
+	.long	0x6ee
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x9
+	.long	.LASF1442
+	.value	0x184
+	.byte	0x1c
+	.long	0x2cc3
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x9
+	.long	.LASF1455
+	.value	0x185
+	.byte	0x15
+	.long	0x2cc8
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x9
+	.long	.LASF1456
+	.value	0x186
+	.byte	0xd
+	.long	0xfa
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x9
+	.long	.LASF1457
+	.value	0x186
+	.byte	0x17
+	.long	0xfa
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x9
+	.long	.LASF1458
+	.value	0x186
+	.byte	0x1e
+	.long	0xfa
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x9
+	.long	.LASF1459
+	.value	0x186
+	.byte	0x29
+	.long	0xfa
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x9
+	.long	.LASF1460
+	.value	0x186
+	.byte	0x31
+	.long	0xfa
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x9
+	.long	.LASF1461
+	.value	0x186
+	.byte	0x38
+	.long	0xfa
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x9
+	.long	.LASF1462
+	.value	0x187
+	.byte	0xd
+	.long	0xfa
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x9
+	.long	.LASF1463
+	.value	0x187
+	.byte	0x14
+	.long	0xfa
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x9
+	.long	.LASF1464
+	.value	0x187
+	.byte	0x1b
+	.long	0xfa
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI251
+	.value	.LVU274
+	.long	.LLRL94
+	.value	0x189
+	.byte	0x10
+	.long	0x276f
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x4
+	.long	.LLRL94
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI263
+	.value	.LVU295
+	.long	.LLRL98
+	.value	0x18d
+	.byte	0xd
+	.long	0x27b7
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x4
+	.long	.LLRL98
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST101
+	.long	.LVUS101
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI269
+	.value	.LVU313
+	.long	.LLRL102
+	.value	0x191
+	.byte	0x11
+	.long	0x27ff
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x4
+	.long	.LLRL102
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3166
+	.quad	.LBI273
+	.value	.LVU328
+	.quad	.LBB273
+	.quad	.LBE273-.LBB273
+	.value	0x191
+	.byte	0x11
+	.long	0x284d
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI275
+	.value	.LVU335
+	.long	.LLRL109
+	.value	0x193
+	.byte	0x39
+	.long	0x2895
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x4
+	.long	.LLRL109
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST112
+	.long	.LVUS112
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3166
+	.quad	.LBI281
+	.value	.LVU350
+	.quad	.LBB281
+	.quad	.LBE281-.LBB281
+	.value	0x193
+	.byte	0x19
+	.long	0x28e3
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST115
+	.long	.LVUS115
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI283
+	.value	.LVU364
+	.long	.LLRL116
+	.value	0x198
+	.byte	0xd
+	.long	0x292b
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x4
+	.long	.LLRL116
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI289
+	.value	.LVU389
+	.long	.LLRL120
+	.value	0x19a
+	.byte	0xe
+	.long	0x2973
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x4
+	.long	.LLRL120
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI294
+	.value	.LVU373
+	.long	.LLRL124
+	.value	0x198
+	.byte	0xd
+	.long	0x29bb
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x4
+	.long	.LLRL124
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI302
+	.value	.LVU405
+	.long	.LLRL128
+	.value	0x19c
+	.byte	0xd
+	.long	0x2a03
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x4
+	.long	.LLRL128
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST131
+	.long	.LVUS131
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI309
+	.value	.LVU441
+	.long	.LLRL132
+	.value	0x1a1
+	.byte	0xd
+	.long	0x2a4b
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x4
+	.long	.LLRL132
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST135
+	.long	.LVUS135
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3166
+	.quad	.LBI315
+	.value	.LVU459
+	.quad	.LBB315
+	.quad	.LBE315-.LBB315
+	.value	0x1a1
+	.byte	0xd
+	.long	0x2a99
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST138
+	.long	.LVUS138
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI317
+	.value	.LVU465
+	.long	.LLRL139
+	.value	0x1a3
+	.byte	0xd
+	.long	0x2ae1
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x4
+	.long	.LLRL139
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2ccd
+	.quad	.LBI323
+	.value	.LVU480
+	.long	.LLRL143
+	.value	0x1a6
+	.byte	0x10
+	.long	0x2b9d
+	.uleb128 0x1
+	.long	0x2cf4
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x1
+	.long	0x2ce8
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x1
+	.long	0x2cdc
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0x4
+	.long	.LLRL143
+	.uleb128 0x2
+	.long	0x2d00
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x6
+	.long	0x3166
+	.quad	.LBI325
+	.value	.LVU546
+	.long	.LLRL148
+	.value	0x173
+	.byte	0x11
+	.long	0x2b76
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST151
+	.long	.LVUS151
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL112
+	.long	0xc66
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x13
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	axisStates+32
+	.byte	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI330
+	.value	.LVU504
+	.long	.LLRL152
+	.value	0x1a7
+	.byte	0xd
+	.long	0x2be5
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x1
+	.long	0x2e65
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x4
+	.long	.LLRL152
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST155
+	.long	.LVUS155
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e56
+	.quad	.LBI337
+	.value	.LVU525
+	.long	.LLRL156
+	.value	0x1aa
+	.byte	0xc
+	.long	0x2c25
+	.uleb128 0x1
+	.long	0x2e71
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x24
+	.long	0x2e65
+	.uleb128 0x4
+	.long	.LLRL156
+	.uleb128 0x2
+	.long	0x2e7d
+	.long	.LLST158
+	.long	.LVUS158
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3166
+	.quad	.LBI342
+	.value	.LVU515
+	.quad	.LBB342
+	.quad	.LBE342-.LBB342
+	.value	0x1a7
+	.byte	0xd
+	.long	0x2c73
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST161
+	.long	.LVUS161
+	.byte	0
+	.uleb128 0x36
+	.long	0x3166
+	.quad	.LBI346
+	.value	.LVU536
+	.quad	.LBB346
+	.quad	.LBE346-.LBB346
+	.value	0x1aa
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x318a
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x1
+	.long	0x317f
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x1
+	.long	0x3174
+	.long	.LLST164
+	.long	.LVUS164
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x90c
+	.uleb128 0xb
+	.long	0x8a0
+	.uleb128 0xb
+	.long	0x95f
+	.uleb128 0x2b
+	.long	.LASF1465
+	.value	0x16d
+	.long	0xfa
+	.long	0x2d0d
+	.uleb128 0x1b
+	.long	.LASF1455
+	.value	0x16d
+	.byte	0x2c
+	.long	0x2cc8
+	.uleb128 0x1b
+	.long	.LASF1460
+	.value	0x16d
+	.byte	0x3b
+	.long	0xfa
+	.uleb128 0x1b
+	.long	.LASF1441
+	.value	0x16d
+	.byte	0x46
+	.long	0x6ee
+	.uleb128 0x10
+	.long	.LASF1461
+	.value	0x16f
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1466
+	.value	0x156
+	.long	0xee
+	.long	0x2d59
+	.uleb128 0x1b
+	.long	.LASF1439
+	.value	0x156
+	.byte	0x22
+	.long	0x9b
+	.uleb128 0x1b
+	.long	.LASF1467
+	.value	0x156
+	.byte	0x2c
+	.long	0x9b
+	.uleb128 0x1b
+	.long	.LASF1436
+	.value	0x156
+	.byte	0x41
+	.long	0x112
+	.uleb128 0x1b
+	.long	.LASF1437
+	.value	0x156
+	.byte	0x6d
+	.long	0xaa2
+	.uleb128 0x10
+	.long	.LASF1468
+	.value	0x158
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1470
+	.value	0x129
+	.byte	0xc
+	.long	0x6ee
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2db2
+	.uleb128 0x51
+	.long	.LASF1471
+	.byte	0x1
+	.value	0x12b
+	.byte	0x9
+	.long	0x6ee
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1356
+	.value	0x12c
+	.byte	0xd
+	.long	0x106
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x9
+	.long	.LASF1439
+	.value	0x12d
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1472
+	.value	0x10b
+	.byte	0xc
+	.long	0x6ee
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e56
+	.uleb128 0xc
+	.long	.LASF1434
+	.value	0x10b
+	.byte	0x2c
+	.long	0xa98
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x9
+	.long	.LASF1439
+	.value	0x10d
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0xf
+	.quad	.LVL26
+	.long	0xc86
+	.long	0x2e1b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisStates+32
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL27
+	.long	0xc86
+	.long	0x2e3a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisStates+104
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL28
+	.long	0xc86
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisStates+176
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1473
+	.value	0x100
+	.long	0xfa
+	.long	0x2e8a
+	.uleb128 0x1b
+	.long	.LASF1474
+	.value	0x100
+	.byte	0x21
+	.long	0xfa
+	.uleb128 0x1b
+	.long	.LASF1282
+	.value	0x100
+	.byte	0x3a
+	.long	0x2e8a
+	.uleb128 0x10
+	.long	.LASF1475
+	.value	0x102
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0xb
+	.long	0x77d
+	.uleb128 0x2c
+	.long	.LASF1476
+	.byte	0xf7
+	.long	0x2edc
+	.uleb128 0x14
+	.long	.LASF1282
+	.byte	0xf7
+	.byte	0x2b
+	.long	0x2edc
+	.uleb128 0x14
+	.long	.LASF1477
+	.byte	0xf7
+	.byte	0x3b
+	.long	0x11e
+	.uleb128 0x14
+	.long	.LASF1478
+	.byte	0xf7
+	.byte	0x4f
+	.long	0x11e
+	.uleb128 0x14
+	.long	.LASF1479
+	.byte	0xf7
+	.byte	0x64
+	.long	0x106
+	.uleb128 0x14
+	.long	.LASF1480
+	.byte	0xf8
+	.byte	0xd
+	.long	0x9b
+	.uleb128 0x2d
+	.long	.LASF1368
+	.byte	0xfa
+	.byte	0x9
+	.long	0x9b
+	.byte	0
+	.uleb128 0xb
+	.long	0x771
+	.uleb128 0x37
+	.long	.LASF1481
+	.byte	0xe8
+	.long	0x106
+	.long	0x2f06
+	.uleb128 0x14
+	.long	.LASF1474
+	.byte	0xe8
+	.byte	0x23
+	.long	0x11e
+	.uleb128 0x2d
+	.long	.LASF1482
+	.byte	0xea
+	.byte	0xd
+	.long	0x106
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF1483
+	.byte	0x1
+	.byte	0xd9
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x310e
+	.uleb128 0x2e
+	.long	.LASF1282
+	.byte	0x2b
+	.long	0x2edc
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x2e
+	.long	.LASF1367
+	.byte	0x38
+	.long	0x35
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x2e
+	.long	.LASF1480
+	.byte	0x42
+	.long	0x9b
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x18
+	.long	.LASF1484
+	.byte	0xdb
+	.byte	0x9
+	.long	0x9b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x38
+	.long	.LASF1485
+	.byte	0xdc
+	.byte	0xb
+	.long	0x35
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x38
+	.long	.LASF1368
+	.byte	0xdd
+	.byte	0x9
+	.long	0x9b
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x29
+	.long	0x3124
+	.quad	.LBI349
+	.value	.LVU580
+	.long	.LLRL170
+	.byte	0xe4
+	.byte	0x9
+	.long	0x2fef
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x4
+	.long	.LLRL170
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST175
+	.long	.LVUS175
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.long	0x3124
+	.quad	.LBI353
+	.value	.LVU604
+	.quad	.LBB353
+	.quad	.LBE353-.LBB353
+	.byte	0x1
+	.byte	0xe0
+	.byte	0x9
+	.long	0x3057
+	.uleb128 0x1
+	.long	0x314f
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x1
+	.long	0x3144
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x2
+	.long	0x315a
+	.long	.LLST180
+	.long	.LVUS180
+	.byte	0
+	.uleb128 0x29
+	.long	0x3124
+	.quad	.LBI355
+	.value	.LVU624
+	.long	.LLRL181
+	.byte	0xe2
+	.byte	0x9
+	.long	0x30a3
+	.uleb128 0x39
+	.long	0x314f
+	.byte	0x2
+	.uleb128 0x39
+	.long	0x3144
+	.byte	0
+	.uleb128 0x1
+	.long	0x3139
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x1
+	.long	0x312e
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x4
+	.long	.LLRL181
+	.uleb128 0x54
+	.long	0x315a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL118
+	.long	0xc00
+	.long	0x30c4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL120
+	.long	0xbe5
+	.long	0x30db
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x48
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL121
+	.long	0xbce
+	.uleb128 0xf
+	.quad	.LVL134
+	.long	0xbe5
+	.long	0x3100
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL135
+	.long	0xbce
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1486
+	.byte	0xca
+	.long	0x3124
+	.uleb128 0x14
+	.long	.LASF1282
+	.byte	0xca
+	.byte	0x2e
+	.long	0x2edc
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1487
+	.byte	0xb8
+	.long	0x3166
+	.uleb128 0x14
+	.long	.LASF1282
+	.byte	0xb8
+	.byte	0x26
+	.long	0x2edc
+	.uleb128 0x14
+	.long	.LASF1367
+	.byte	0xb8
+	.byte	0x35
+	.long	0xee
+	.uleb128 0x14
+	.long	.LASF1368
+	.byte	0xb8
+	.byte	0x43
+	.long	0x106
+	.uleb128 0x14
+	.long	.LASF1488
+	.byte	0xb8
+	.byte	0x58
+	.long	0x724
+	.uleb128 0x2d
+	.long	.LASF1489
+	.byte	0xba
+	.byte	0xd
+	.long	0xfa
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1490
+	.byte	0xae
+	.long	0xfa
+	.long	0x3196
+	.uleb128 0x3a
+	.string	"amt"
+	.byte	0xae
+	.byte	0x24
+	.long	0xfa
+	.uleb128 0x3a
+	.string	"low"
+	.byte	0xae
+	.byte	0x31
+	.long	0xfa
+	.uleb128 0x14
+	.long	.LASF1491
+	.byte	0xae
+	.byte	0x3e
+	.long	0xfa
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF1492
+	.byte	0xa5
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3b
+	.long	.LASF1493
+	.byte	0x9f
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x55
+	.long	.LASF1500
+	.byte	0x1
+	.byte	0x99
+	.byte	0x6
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x56
+	.long	.LASF1494
+	.byte	0x1
+	.byte	0x99
+	.byte	0x32
+	.long	0xaa2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 217
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS389:
+	.uleb128 0
+	.uleb128 .LVU1572
+	.uleb128 .LVU1572
+	.uleb128 0
+.LLST389:
+	.byte	0x6
+	.quad	.LVL298
+	.byte	0x4
+	.uleb128 .LVL298-.LVL298
+	.uleb128 .LVL299-.LVL298
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL299-.LVL298
+	.uleb128 .LFE24-.LVL298
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS270:
+	.uleb128 0
+	.uleb128 .LVU1055
+	.uleb128 .LVU1055
+	.uleb128 .LVU1073
+	.uleb128 .LVU1073
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1118
+	.uleb128 .LVU1118
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 0
+.LLST270:
+	.byte	0x6
+	.quad	.LVL221
+	.byte	0x4
+	.uleb128 .LVL221-.LVL221
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 .LVL227-.LVL221
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL227-.LVL221
+	.uleb128 .LVL228-.LVL221
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL228-.LVL221
+	.uleb128 .LVL235-.LVL221
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL235-.LVL221
+	.uleb128 .LVL236-.LVL221
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL221
+	.uleb128 .LVL240-.LVL221
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL240-.LVL221
+	.uleb128 .LFE23-.LVL221
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS271:
+	.uleb128 0
+	.uleb128 .LVU1055
+	.uleb128 .LVU1055
+	.uleb128 0
+.LLST271:
+	.byte	0x6
+	.quad	.LVL221
+	.byte	0x4
+	.uleb128 .LVL221-.LVL221
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 .LFE23-.LVL221
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS272:
+	.uleb128 0
+	.uleb128 .LVU1055
+	.uleb128 .LVU1055
+	.uleb128 .LVU1066
+	.uleb128 .LVU1066
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 0
+.LLST272:
+	.byte	0x6
+	.quad	.LVL221
+	.byte	0x4
+	.uleb128 .LVL221-.LVL221
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 .LVL225-.LVL221
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL225-.LVL221
+	.uleb128 .LVL228-.LVL221
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL228-.LVL221
+	.uleb128 .LVL240-.LVL221
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0x4
+	.uleb128 .LVL240-.LVL221
+	.uleb128 .LFE23-.LVL221
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS273:
+	.uleb128 0
+	.uleb128 .LVU1055
+	.uleb128 .LVU1055
+	.uleb128 0
+.LLST273:
+	.byte	0x6
+	.quad	.LVL221
+	.byte	0x4
+	.uleb128 .LVL221-.LVL221
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL222-1-.LVL221
+	.uleb128 .LFE23-.LVL221
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU1080
+	.uleb128 .LVU1091
+	.uleb128 .LVU1118
+	.uleb128 .LVU1131
+	.uleb128 .LVU1131
+	.uleb128 .LVU1154
+.LLST274:
+	.byte	0x6
+	.quad	.LVL230
+	.byte	0x4
+	.uleb128 .LVL230-.LVL230
+	.uleb128 .LVL231-.LVL230
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL230
+	.uleb128 .LVL238-.LVL230
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.LVL230
+	.uleb128 .LVL239-.LVL230
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU1069
+	.uleb128 .LVU1074
+	.uleb128 .LVU1075
+	.uleb128 .LVU1114
+	.uleb128 .LVU1114
+	.uleb128 .LVU1116
+	.uleb128 .LVU1118
+	.uleb128 .LVU1161
+.LLST275:
+	.byte	0x6
+	.quad	.LVL226
+	.byte	0x4
+	.uleb128 .LVL226-.LVL226
+	.uleb128 .LVL228-.LVL226
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.LVL226
+	.uleb128 .LVL233-.LVL226
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL233-.LVL226
+	.uleb128 .LVL234-.LVL226
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL226
+	.uleb128 .LVL240-.LVL226
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU1056
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1161
+	.uleb128 .LVU1161
+	.uleb128 0
+.LLST276:
+	.byte	0x6
+	.quad	.LVL223
+	.byte	0x4
+	.uleb128 .LVL223-.LVL223
+	.uleb128 .LVL228-.LVL223
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL228-.LVL223
+	.uleb128 .LVL240-.LVL223
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x4
+	.uleb128 .LVL240-.LVL223
+	.uleb128 .LFE23-.LVL223
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS278:
+	.uleb128 .LVU1077
+	.uleb128 .LVU1116
+	.uleb128 .LVU1118
+	.uleb128 .LVU1161
+.LLST278:
+	.byte	0x6
+	.quad	.LVL229
+	.byte	0x4
+	.uleb128 .LVL229-.LVL229
+	.uleb128 .LVL234-.LVL229
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL229
+	.uleb128 .LVL240-.LVL229
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1131
+.LLST280:
+	.byte	0x8
+	.quad	.LVL236
+	.uleb128 .LVL238-.LVL236
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1131
+.LLST281:
+	.byte	0x8
+	.quad	.LVL236
+	.uleb128 .LVL238-.LVL236
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1131
+.LLST282:
+	.byte	0x8
+	.quad	.LVL236
+	.uleb128 .LVL238-.LVL236
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU1119
+	.uleb128 .LVU1131
+.LLST283:
+	.byte	0x8
+	.quad	.LVL236
+	.uleb128 .LVL238-.LVL236
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU1165
+	.uleb128 .LVU1167
+	.uleb128 .LVU1167
+	.uleb128 0
+.LLST284:
+	.byte	0x6
+	.quad	.LVL241
+	.byte	0x4
+	.uleb128 .LVL241-.LVL241
+	.uleb128 .LVL242-.LVL241
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL242-.LVL241
+	.uleb128 .LFE23-.LVL241
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU1163
+	.uleb128 .LVU1167
+	.uleb128 .LVU1167
+	.uleb128 .LVU1265
+.LLST285:
+	.byte	0x6
+	.quad	.LVL241
+	.byte	0x4
+	.uleb128 .LVL241-.LVL241
+	.uleb128 .LVL242-.LVL241
+	.uleb128 0x17
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL242-.LVL241
+	.uleb128 .LVL251-.LVL241
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU1182
+	.uleb128 .LVU1193
+.LLST287:
+	.byte	0x8
+	.quad	.LVL244
+	.uleb128 .LVL245-.LVL244
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU1182
+	.uleb128 .LVU1193
+.LLST288:
+	.byte	0x8
+	.quad	.LVL244
+	.uleb128 .LVL245-.LVL244
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU1182
+	.uleb128 .LVU1193
+.LLST290:
+	.byte	0x8
+	.quad	.LVL244
+	.uleb128 .LVL245-.LVL244
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+24
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU1184
+	.uleb128 .LVU1193
+.LLST291:
+	.byte	0x8
+	.quad	.LVL244
+	.uleb128 .LVL245-.LVL244
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7f
+	.byte	0x9f
+	.byte	0
+.LVUS292:
+	.uleb128 .LVU1169
+	.uleb128 .LVU1180
+.LLST292:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU1169
+	.uleb128 .LVU1180
+.LLST293:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU1169
+	.uleb128 .LVU1180
+.LLST295:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU1171
+	.uleb128 .LVU1180
+.LLST296:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU1195
+	.uleb128 .LVU1206
+.LLST297:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL246-.LVL245
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU1195
+	.uleb128 .LVU1206
+.LLST298:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL246-.LVL245
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU1195
+	.uleb128 .LVU1206
+.LLST300:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL246-.LVL245
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+48
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU1197
+	.uleb128 .LVU1206
+.LLST301:
+	.byte	0x8
+	.quad	.LVL245
+	.uleb128 .LVL246-.LVL245
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x7ff
+	.byte	0x9f
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU1208
+	.uleb128 .LVU1219
+.LLST302:
+	.byte	0x8
+	.quad	.LVL246
+	.uleb128 .LVL247-.LVL246
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU1208
+	.uleb128 .LVU1219
+.LLST305:
+	.byte	0x8
+	.quad	.LVL246
+	.uleb128 .LVL247-.LVL246
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+72
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU1210
+	.uleb128 .LVU1219
+.LLST306:
+	.byte	0x8
+	.quad	.LVL246
+	.uleb128 .LVL247-.LVL246
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1232
+.LLST307:
+	.byte	0x8
+	.quad	.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1232
+.LLST308:
+	.byte	0x8
+	.quad	.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x2
+	.byte	0x3d
+	.byte	0x9f
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1232
+.LLST309:
+	.byte	0x8
+	.quad	.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU1221
+	.uleb128 .LVU1232
+.LLST310:
+	.byte	0x8
+	.quad	.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU1223
+	.uleb128 .LVU1232
+.LLST311:
+	.byte	0x8
+	.quad	.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1fff
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1245
+.LLST312:
+	.byte	0x8
+	.quad	.LVL248
+	.uleb128 .LVL249-.LVL248
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS313:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1245
+.LLST313:
+	.byte	0x8
+	.quad	.LVL248
+	.uleb128 .LVL249-.LVL248
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU1234
+	.uleb128 .LVU1245
+.LLST315:
+	.byte	0x8
+	.quad	.LVL248
+	.uleb128 .LVL249-.LVL248
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+144
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU1236
+	.uleb128 .LVU1245
+.LLST316:
+	.byte	0x8
+	.quad	.LVL248
+	.uleb128 .LVL249-.LVL248
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU1247
+	.uleb128 .LVU1258
+.LLST317:
+	.byte	0x8
+	.quad	.LVL249
+	.uleb128 .LVL250-.LVL249
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU1247
+	.uleb128 .LVU1258
+.LLST318:
+	.byte	0x8
+	.quad	.LVL249
+	.uleb128 .LVL250-.LVL249
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU1247
+	.uleb128 .LVU1258
+.LLST320:
+	.byte	0x8
+	.quad	.LVL249
+	.uleb128 .LVL250-.LVL249
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+192
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU1249
+	.uleb128 .LVU1258
+.LLST321:
+	.byte	0x8
+	.quad	.LVL249
+	.uleb128 .LVL250-.LVL249
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS322:
+	.uleb128 0
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 .LVU1382
+	.uleb128 .LVU1382
+	.uleb128 .LVU1384
+	.uleb128 .LVU1384
+	.uleb128 0
+.LLST322:
+	.byte	0x6
+	.quad	.LVL252
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 .LVL273-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL273-.LVL252
+	.uleb128 .LVL275-.LVL252
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.LVL252
+	.uleb128 .LFE21-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS323:
+	.uleb128 0
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 0
+.LLST323:
+	.byte	0x6
+	.quad	.LVL252
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 .LFE21-.LVL252
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS324:
+	.uleb128 0
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 .LVU1297
+	.uleb128 .LVU1297
+	.uleb128 .LVU1299
+	.uleb128 .LVU1299
+	.uleb128 .LVU1384
+	.uleb128 .LVU1384
+	.uleb128 .LVU1533
+	.uleb128 .LVU1533
+	.uleb128 0
+.LLST324:
+	.byte	0x6
+	.quad	.LVL252
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 .LVL258-.LVL252
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL258-.LVL252
+	.uleb128 .LVL259-.LVL252
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL259-.LVL252
+	.uleb128 .LVL275-.LVL252
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x4
+	.uleb128 .LVL275-.LVL252
+	.uleb128 .LVL296-.LVL252
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL296-.LVL252
+	.uleb128 .LFE21-.LVL252
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0
+.LVUS325:
+	.uleb128 0
+	.uleb128 .LVU1274
+	.uleb128 .LVU1274
+	.uleb128 0
+.LLST325:
+	.byte	0x6
+	.quad	.LVL252
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL253-1-.LVL252
+	.uleb128 .LFE21-.LVL252
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU1291
+	.uleb128 .LVU1292
+	.uleb128 .LVU1292
+	.uleb128 .LVU1311
+	.uleb128 .LVU1311
+	.uleb128 .LVU1330
+	.uleb128 .LVU1330
+	.uleb128 .LVU1331
+	.uleb128 .LVU1335
+	.uleb128 .LVU1346
+	.uleb128 .LVU1346
+	.uleb128 .LVU1380
+	.uleb128 .LVU1533
+	.uleb128 0
+.LLST326:
+	.byte	0x6
+	.quad	.LVL256
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL256-.LVL256
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL261-.LVL256
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL261-.LVL256
+	.uleb128 .LVL263-.LVL256
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL263-.LVL256
+	.uleb128 .LVL264-.LVL256
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.LVL256
+	.uleb128 .LVL268-1-.LVL256
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL268-1-.LVL256
+	.uleb128 .LVL272-.LVL256
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL296-.LVL256
+	.uleb128 .LFE21-.LVL256
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU1290
+	.uleb128 .LVU1294
+	.uleb128 .LVU1294
+	.uleb128 .LVU1384
+	.uleb128 .LVU1533
+	.uleb128 0
+.LLST327:
+	.byte	0x6
+	.quad	.LVL256
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL257-.LVL256
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL257-.LVL256
+	.uleb128 .LVL275-.LVL256
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -98
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL296-.LVL256
+	.uleb128 .LFE21-.LVL256
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -98
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU1351
+	.uleb128 .LVU1363
+	.uleb128 .LVU1363
+	.uleb128 .LVU1380
+	.uleb128 .LVU1533
+	.uleb128 0
+.LLST328:
+	.byte	0x6
+	.quad	.LVL269
+	.byte	0x4
+	.uleb128 .LVL269-.LVL269
+	.uleb128 .LVL270-1-.LVL269
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL270-1-.LVL269
+	.uleb128 .LVL272-.LVL269
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x4
+	.uleb128 .LVL296-.LVL269
+	.uleb128 .LFE21-.LVL269
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0
+.LVUS329:
+	.uleb128 .LVU1275
+	.uleb128 .LVU1383
+	.uleb128 .LVU1384
+	.uleb128 0
+.LLST329:
+	.byte	0x6
+	.quad	.LVL254
+	.byte	0x4
+	.uleb128 .LVL254-.LVL254
+	.uleb128 .LVL274-.LVL254
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL275-.LVL254
+	.uleb128 .LFE21-.LVL254
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU1293
+	.uleb128 .LVU1303
+	.uleb128 .LVU1336
+	.uleb128 .LVU1339
+.LLST331:
+	.byte	0x6
+	.quad	.LVL256
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL260-.LVL256
+	.uleb128 0x15
+	.byte	0x79
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.LVL256
+	.uleb128 .LVL266-.LVL256
+	.uleb128 0x15
+	.byte	0x79
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS333:
+	.uleb128 .LVU1342
+	.uleb128 .LVU1351
+.LLST333:
+	.byte	0x8
+	.quad	.LVL267
+	.uleb128 .LVL269-.LVL267
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU1342
+	.uleb128 .LVU1351
+.LLST334:
+	.byte	0x8
+	.quad	.LVL267
+	.uleb128 .LVL269-.LVL267
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU1342
+	.uleb128 .LVU1351
+.LLST335:
+	.byte	0x8
+	.quad	.LVL267
+	.uleb128 .LVL269-.LVL267
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS336:
+	.uleb128 .LVU1342
+	.uleb128 .LVU1351
+.LLST336:
+	.byte	0x8
+	.quad	.LVL267
+	.uleb128 .LVL269-.LVL267
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU1391
+	.uleb128 .LVU1516
+	.uleb128 .LVU1516
+	.uleb128 .LVU1524
+	.uleb128 .LVU1524
+	.uleb128 .LVU1528
+	.uleb128 .LVU1528
+	.uleb128 .LVU1533
+.LLST337:
+	.byte	0x6
+	.quad	.LVL277
+	.byte	0x4
+	.uleb128 .LVL277-.LVL277
+	.uleb128 .LVL290-.LVL277
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL290-.LVL277
+	.uleb128 .LVL292-.LVL277
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL292-.LVL277
+	.uleb128 .LVL294-.LVL277
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL294-.LVL277
+	.uleb128 .LVL296-.LVL277
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU1387
+	.uleb128 .LVU1512
+	.uleb128 .LVU1512
+	.uleb128 .LVU1513
+	.uleb128 .LVU1513
+	.uleb128 .LVU1514
+	.uleb128 .LVU1524
+	.uleb128 .LVU1527
+.LLST338:
+	.byte	0x6
+	.quad	.LVL276
+	.byte	0x4
+	.uleb128 .LVL276-.LVL276
+	.uleb128 .LVL287-.LVL276
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL287-.LVL276
+	.uleb128 .LVL288-.LVL276
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL288-.LVL276
+	.uleb128 .LVL289-.LVL276
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL292-.LVL276
+	.uleb128 .LVL293-.LVL276
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU1390
+	.uleb128 .LVU1533
+.LLST340:
+	.byte	0x8
+	.quad	.LVL277
+	.uleb128 .LVL296-.LVL277
+	.uleb128 0x8
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1444
+.LLST342:
+	.byte	0x8
+	.quad	.LVL280
+	.uleb128 .LVL281-.LVL280
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1444
+.LLST344:
+	.byte	0x8
+	.quad	.LVL280
+	.uleb128 .LVL281-.LVL280
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU1435
+	.uleb128 .LVU1444
+.LLST345:
+	.byte	0x8
+	.quad	.LVL280
+	.uleb128 .LVL281-.LVL280
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+48
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU1437
+	.uleb128 .LVU1444
+.LLST346:
+	.byte	0x8
+	.quad	.LVL280
+	.uleb128 .LVL281-.LVL280
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU1393
+	.uleb128 .LVU1422
+.LLST348:
+	.byte	0x8
+	.quad	.LVL278
+	.uleb128 .LVL279-.LVL278
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU1393
+	.uleb128 .LVU1422
+.LLST349:
+	.byte	0x8
+	.quad	.LVL278
+	.uleb128 .LVL279-.LVL278
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS351:
+	.uleb128 .LVU1393
+	.uleb128 .LVU1422
+.LLST351:
+	.byte	0x8
+	.quad	.LVL278
+	.uleb128 .LVL279-.LVL278
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU1395
+	.uleb128 .LVU1422
+.LLST352:
+	.byte	0x8
+	.quad	.LVL278
+	.uleb128 .LVL279-.LVL278
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1433
+.LLST354:
+	.byte	0x8
+	.quad	.LVL279
+	.uleb128 .LVL280-.LVL279
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS355:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1433
+.LLST355:
+	.byte	0x8
+	.quad	.LVL279
+	.uleb128 .LVL280-.LVL279
+	.uleb128 0x2
+	.byte	0x4c
+	.byte	0x9f
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1433
+.LLST356:
+	.byte	0x8
+	.quad	.LVL279
+	.uleb128 .LVL280-.LVL279
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS357:
+	.uleb128 .LVU1424
+	.uleb128 .LVU1433
+.LLST357:
+	.byte	0x8
+	.quad	.LVL279
+	.uleb128 .LVL280-.LVL279
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+24
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU1426
+	.uleb128 .LVU1433
+.LLST358:
+	.byte	0x8
+	.quad	.LVL279
+	.uleb128 .LVL280-.LVL279
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xfffffff
+	.byte	0x9f
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU1446
+	.uleb128 .LVU1455
+.LLST360:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL282-.LVL281
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU1446
+	.uleb128 .LVU1455
+.LLST361:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL282-.LVL281
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU1446
+	.uleb128 .LVU1455
+.LLST362:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL282-.LVL281
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x20c49bb
+	.byte	0x9f
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU1446
+	.uleb128 .LVU1455
+.LLST363:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL282-.LVL281
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS364:
+	.uleb128 .LVU1448
+	.uleb128 .LVU1455
+.LLST364:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL282-.LVL281
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x9f
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1466
+.LLST366:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL283-.LVL282
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS367:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1466
+.LLST367:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL283-.LVL282
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1466
+.LLST368:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL283-.LVL282
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS369:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1466
+.LLST369:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL283-.LVL282
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS370:
+	.uleb128 .LVU1459
+	.uleb128 .LVU1466
+.LLST370:
+	.byte	0x8
+	.quad	.LVL282
+	.uleb128 .LVL283-.LVL282
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x9f
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1477
+.LLST372:
+	.byte	0x8
+	.quad	.LVL283
+	.uleb128 .LVL284-.LVL283
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS373:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1477
+.LLST373:
+	.byte	0x8
+	.quad	.LVL283
+	.uleb128 .LVL284-.LVL283
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU1468
+	.uleb128 .LVU1477
+.LLST375:
+	.byte	0x8
+	.quad	.LVL283
+	.uleb128 .LVL284-.LVL283
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+144
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS376:
+	.uleb128 .LVU1470
+	.uleb128 .LVU1477
+.LLST376:
+	.byte	0x8
+	.quad	.LVL283
+	.uleb128 .LVL284-.LVL283
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS378:
+	.uleb128 .LVU1479
+	.uleb128 .LVU1488
+.LLST378:
+	.byte	0x8
+	.quad	.LVL284
+	.uleb128 .LVL285-.LVL284
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS379:
+	.uleb128 .LVU1479
+	.uleb128 .LVU1488
+.LLST379:
+	.byte	0x8
+	.quad	.LVL284
+	.uleb128 .LVL285-.LVL284
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS380:
+	.uleb128 .LVU1479
+	.uleb128 .LVU1488
+.LLST380:
+	.byte	0x8
+	.quad	.LVL284
+	.uleb128 .LVL285-.LVL284
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU1479
+	.uleb128 .LVU1488
+.LLST381:
+	.byte	0x8
+	.quad	.LVL284
+	.uleb128 .LVL285-.LVL284
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+192
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU1481
+	.uleb128 .LVU1488
+.LLST382:
+	.byte	0x8
+	.quad	.LVL284
+	.uleb128 .LVL285-.LVL284
+	.uleb128 0x2
+	.byte	0x4f
+	.byte	0x9f
+	.byte	0
+.LVUS384:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1499
+.LLST384:
+	.byte	0x8
+	.quad	.LVL285
+	.uleb128 .LVL286-.LVL285
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1499
+.LLST385:
+	.byte	0x8
+	.quad	.LVL285
+	.uleb128 .LVL286-.LVL285
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS386:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1499
+.LLST386:
+	.byte	0x8
+	.quad	.LVL285
+	.uleb128 .LVL286-.LVL285
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x83126f
+	.byte	0x9f
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU1490
+	.uleb128 .LVU1499
+.LLST387:
+	.byte	0x8
+	.quad	.LVL285
+	.uleb128 .LVL286-.LVL285
+	.uleb128 0x17
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+216
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU1492
+	.uleb128 .LVU1499
+.LLST388:
+	.byte	0x8
+	.quad	.LVL285
+	.uleb128 .LVL286-.LVL285
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 0
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU909
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST184:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 .LVL144-.LVL139
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.LVL139
+	.uleb128 .LVL207-.LVL139
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.LVL139
+	.uleb128 .LVL220-.LVL139
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL220-.LVL139
+	.uleb128 .LFE19-.LVL139
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 0
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 0
+.LLST185:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 .LFE19-.LVL139
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.byte	0
+.LVUS186:
+	.uleb128 0
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU757
+	.uleb128 .LVU757
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU906
+	.uleb128 .LVU906
+	.uleb128 0
+.LLST186:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 .LVL170-.LVL139
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL170-.LVL139
+	.uleb128 .LVL172-.LVL139
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL172-.LVL139
+	.uleb128 .LVL205-.LVL139
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0x4
+	.uleb128 .LVL205-.LVL139
+	.uleb128 .LFE19-.LVL139
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS187:
+	.uleb128 0
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 0
+.LLST187:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL140-1-.LVL139
+	.uleb128 .LFE19-.LVL139
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU727
+	.uleb128 .LVU728
+	.uleb128 .LVU728
+	.uleb128 .LVU729
+	.uleb128 .LVU729
+	.uleb128 .LVU730
+	.uleb128 .LVU730
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU740
+	.uleb128 .LVU740
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU745
+	.uleb128 .LVU745
+	.uleb128 .LVU750
+	.uleb128 .LVU750
+	.uleb128 .LVU762
+	.uleb128 .LVU762
+	.uleb128 .LVU904
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST188:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL162-.LVL162
+	.uleb128 0x7
+	.byte	0x93
+	.uleb128 0x10
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL162-.LVL162
+	.uleb128 0xc
+	.byte	0x93
+	.uleb128 0x10
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -13
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL162-.LVL162
+	.uleb128 0x10
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -13
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL163-.LVL162
+	.uleb128 0x12
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -13
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL163-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x10
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL166-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0xf
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL166-.LVL162
+	.uleb128 .LVL167-.LVL162
+	.uleb128 0xe
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x59
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL167-.LVL162
+	.uleb128 .LVL168-.LVL162
+	.uleb128 0x10
+	.byte	0x54
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x59
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -141
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL168-.LVL162
+	.uleb128 .LVL172-.LVL162
+	.uleb128 0x10
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x59
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -141
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL172-.LVL162
+	.uleb128 .LVL203-.LVL162
+	.uleb128 0x12
+	.byte	0x5c
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x5f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -140
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -141
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x10
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x53
+	.byte	0x93
+	.uleb128 0x1
+	.byte	0x93
+	.uleb128 0x3
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU764
+	.uleb128 .LVU794
+	.uleb128 .LVU851
+	.uleb128 .LVU860
+.LLST189:
+	.byte	0x6
+	.quad	.LVL173
+	.byte	0x4
+	.uleb128 .LVL173-.LVL173
+	.uleb128 .LVL180-.LVL173
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL192-.LVL173
+	.uleb128 .LVL194-.LVL173
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU753
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU815
+	.uleb128 .LVU815
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU867
+	.uleb128 .LVU867
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 .LVU906
+.LLST190:
+	.byte	0x6
+	.quad	.LVL169
+	.byte	0x4
+	.uleb128 .LVL169-.LVL169
+	.uleb128 .LVL171-.LVL169
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL169
+	.uleb128 .LVL183-.LVL169
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL183-.LVL169
+	.uleb128 .LVL185-.LVL169
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.LVL169
+	.uleb128 .LVL195-.LVL169
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL195-.LVL169
+	.uleb128 .LVL203-.LVL169
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.LVL169
+	.uleb128 .LVL205-.LVL169
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU650
+	.uleb128 .LVU652
+	.uleb128 .LVU652
+	.uleb128 .LVU679
+	.uleb128 .LVU679
+	.uleb128 .LVU699
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+.LLST191:
+	.byte	0x6
+	.quad	.LVL141
+	.byte	0x4
+	.uleb128 .LVL141-.LVL141
+	.uleb128 .LVL142-1-.LVL141
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL142-1-.LVL141
+	.uleb128 .LVL145-.LVL141
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL145-.LVL141
+	.uleb128 .LVL154-.LVL141
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -141
+	.byte	0x4
+	.uleb128 .LVL207-.LVL141
+	.uleb128 .LVL220-.LVL141
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS213:
+	.uleb128 .LVU755
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU762
+	.uleb128 .LVU817
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU823
+	.uleb128 .LVU867
+	.uleb128 .LVU905
+.LLST213:
+	.byte	0x6
+	.quad	.LVL169
+	.byte	0x4
+	.uleb128 .LVL169-.LVL169
+	.uleb128 .LVL171-.LVL169
+	.uleb128 0xa
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL171-.LVL169
+	.uleb128 .LVL172-.LVL169
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.LVL169
+	.uleb128 .LVL185-.LVL169
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.LVL169
+	.uleb128 .LVL186-.LVL169
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL169
+	.uleb128 .LVL204-.LVL169
+	.uleb128 0x15
+	.byte	0x76
+	.sleb128 1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	axisSetpoints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU824
+	.uleb128 .LVU831
+.LLST215:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL188-.LVL186
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU824
+	.uleb128 .LVU831
+.LLST216:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL188-.LVL186
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU824
+	.uleb128 .LVU831
+.LLST217:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL188-.LVL186
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU824
+	.uleb128 .LVU831
+.LLST218:
+	.byte	0x8
+	.quad	.LVL186
+	.uleb128 .LVL188-.LVL186
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU830
+	.uleb128 .LVU831
+.LLST219:
+	.byte	0x8
+	.quad	.LVL187
+	.uleb128 .LVL188-1-.LVL187
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU765
+	.uleb128 .LVU783
+.LLST221:
+	.byte	0x8
+	.quad	.LVL173
+	.uleb128 .LVL177-.LVL173
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightStickScale
+	.byte	0x9f
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU775
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU779
+.LLST222:
+	.byte	0x6
+	.quad	.LVL174
+	.byte	0x4
+	.uleb128 .LVL174-.LVL174
+	.uleb128 .LVL175-.LVL174
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL175-.LVL174
+	.uleb128 .LVL176-.LVL174
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU788
+	.uleb128 .LVU793
+.LLST223:
+	.byte	0x8
+	.quad	.LVL178
+	.uleb128 .LVL179-.LVL178
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightHLevel
+	.byte	0x9f
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU788
+	.uleb128 .LVU793
+.LLST224:
+	.byte	0x8
+	.quad	.LVL178
+	.uleb128 .LVL179-.LVL178
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU792
+	.uleb128 .LVU793
+.LLST225:
+	.byte	0x8
+	.quad	.LVL179
+	.uleb128 .LVL179-.LVL179
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU831
+	.uleb128 .LVU851
+.LLST227:
+	.byte	0x8
+	.quad	.LVL188
+	.uleb128 .LVL192-.LVL188
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightAngleScale
+	.byte	0x9f
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU845
+	.uleb128 .LVU848
+.LLST228:
+	.byte	0x8
+	.quad	.LVL190
+	.uleb128 .LVL191-.LVL190
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU855
+	.uleb128 .LVU861
+.LLST229:
+	.byte	0x8
+	.quad	.LVL193
+	.uleb128 .LVL194-.LVL193
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightALevel
+	.byte	0x9f
+	.byte	0
+.LVUS230:
+	.uleb128 .LVU855
+	.uleb128 .LVU860
+.LLST230:
+	.byte	0x8
+	.quad	.LVL193
+	.uleb128 .LVL194-.LVL193
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU860
+	.uleb128 .LVU861
+.LLST231:
+	.byte	0x8
+	.quad	.LVL194
+	.uleb128 .LVL194-.LVL194
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU872
+	.uleb128 .LVU887
+.LLST233:
+	.byte	0x8
+	.quad	.LVL196
+	.uleb128 .LVL201-.LVL196
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightStickScale
+	.byte	0x9f
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU886
+	.uleb128 .LVU887
+.LLST234:
+	.byte	0x8
+	.quad	.LVL201
+	.uleb128 .LVL201-.LVL201
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU654
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU699
+	.uleb128 .LVU909
+	.uleb128 .LVU911
+	.uleb128 .LVU1032
+	.uleb128 .LVU1045
+.LLST193:
+	.byte	0x6
+	.quad	.LVL143
+	.byte	0x4
+	.uleb128 .LVL143-.LVL143
+	.uleb128 .LVL144-.LVL143
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL144-.LVL143
+	.uleb128 .LVL154-.LVL143
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL207-.LVL143
+	.uleb128 .LVL208-.LVL143
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL219-.LVL143
+	.uleb128 .LVL220-.LVL143
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU681
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU699
+.LLST194:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL150-.LVL146
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.LVL146
+	.uleb128 .LVL154-.LVL146
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels+312
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU680
+	.uleb128 .LVU688
+	.uleb128 .LVU688
+	.uleb128 .LVU690
+.LLST195:
+	.byte	0x6
+	.quad	.LVL146
+	.byte	0x4
+	.uleb128 .LVL146-.LVL146
+	.uleb128 .LVL150-.LVL146
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.LVL146
+	.uleb128 .LVL151-.LVL146
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels+312
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU702
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST197:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL166-.LVL155
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xf4240
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL155
+	.uleb128 .LVL207-.LVL155
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xf4240
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xf4240
+	.byte	0x9f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU702
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST198:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL166-.LVL155
+	.uleb128 0x2
+	.byte	0x4a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL155
+	.uleb128 .LVL207-.LVL155
+	.uleb128 0x2
+	.byte	0x4a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x2
+	.byte	0x4a
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU702
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST199:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL166-.LVL155
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL155
+	.uleb128 .LVL207-.LVL155
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x9f
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU701
+	.uleb128 .LVU720
+	.uleb128 .LVU720
+	.uleb128 .LVU739
+	.uleb128 .LVU906
+	.uleb128 .LVU908
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST200:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL161-.LVL155
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL161-.LVL155
+	.uleb128 .LVL165-.LVL155
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL205-.LVL155
+	.uleb128 .LVL206-.LVL155
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU701
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST201:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL166-.LVL155
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6151
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL205-.LVL155
+	.uleb128 .LVL207-.LVL155
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6151
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6151
+	.sleb128 0
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU717
+	.uleb128 .LVU736
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST202:
+	.byte	0x6
+	.quad	.LVL160
+	.byte	0x4
+	.uleb128 .LVL160-.LVL160
+	.uleb128 .LVL164-.LVL160
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL205-.LVL160
+	.uleb128 .LVL207-.LVL160
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU703
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU711
+	.uleb128 .LVU711
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU715
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST204:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL156-.LVL155
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL156-.LVL155
+	.uleb128 .LVL157-.LVL155
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-.LVL155
+	.uleb128 .LVL158-.LVL155
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL155
+	.uleb128 .LVL159-.LVL155
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU705
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU715
+	.uleb128 .LVU1045
+	.uleb128 0
+.LLST205:
+	.byte	0x6
+	.quad	.LVL155
+	.byte	0x4
+	.uleb128 .LVL155-.LVL155
+	.uleb128 .LVL156-.LVL155
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.LVL155
+	.uleb128 .LVL159-.LVL155
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL220-.LVL155
+	.uleb128 .LFE19-.LVL155
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU724
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST207:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU724
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST208:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL163-.LVL162
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU724
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST209:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU724
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST210:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6151
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+6151
+	.sleb128 0
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU726
+	.uleb128 .LVU733
+	.uleb128 .LVU733
+	.uleb128 .LVU741
+	.uleb128 .LVU906
+	.uleb128 .LVU909
+.LLST211:
+	.byte	0x6
+	.quad	.LVL162
+	.byte	0x4
+	.uleb128 .LVL162-.LVL162
+	.uleb128 .LVL163-.LVL162
+	.uleb128 0x10
+	.byte	0x31
+	.byte	0x73
+	.sleb128 -13
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.LVL162
+	.uleb128 .LVL166-.LVL162
+	.uleb128 0x10
+	.byte	0x31
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL162
+	.uleb128 .LVL207-.LVL162
+	.uleb128 0x10
+	.byte	0x31
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU914
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU1030
+.LLST236:
+	.byte	0x6
+	.quad	.LVL209
+	.byte	0x4
+	.uleb128 .LVL209-.LVL209
+	.uleb128 .LVL210-.LVL209
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL210-.LVL209
+	.uleb128 .LVL219-.LVL209
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS237:
+	.uleb128 .LVU912
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU987
+.LLST237:
+	.byte	0x6
+	.quad	.LVL209
+	.byte	0x4
+	.uleb128 .LVL209-.LVL209
+	.uleb128 .LVL210-.LVL209
+	.uleb128 0x17
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.LVL209
+	.uleb128 .LVL216-.LVL209
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU918
+	.uleb128 .LVU931
+.LLST238:
+	.byte	0x8
+	.quad	.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS239:
+	.uleb128 .LVU918
+	.uleb128 .LVU931
+.LLST239:
+	.byte	0x8
+	.quad	.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x2
+	.byte	0x45
+	.byte	0x9f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU918
+	.uleb128 .LVU931
+.LLST240:
+	.byte	0x8
+	.quad	.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU918
+	.uleb128 .LVU931
+.LLST241:
+	.byte	0x8
+	.quad	.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU920
+	.uleb128 .LVU931
+.LLST242:
+	.byte	0x8
+	.quad	.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1fffff
+	.byte	0x9f
+	.byte	0
+.LVUS243:
+	.uleb128 .LVU933
+	.uleb128 .LVU946
+.LLST243:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU933
+	.uleb128 .LVU946
+.LLST244:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x2
+	.byte	0x4d
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU933
+	.uleb128 .LVU946
+.LLST245:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x431bde83
+	.byte	0x9f
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU933
+	.uleb128 .LVU946
+.LLST246:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS247:
+	.uleb128 .LVU935
+	.uleb128 .LVU946
+.LLST247:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x1fffffff
+	.byte	0x9f
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+.LLST248:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+.LLST249:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x2
+	.byte	0x4c
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+.LLST250:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0xaaaaaaaa
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU948
+	.uleb128 .LVU961
+.LLST251:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+192
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU950
+	.uleb128 .LVU961
+.LLST252:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL214-.LVL213
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xfffffff
+	.byte	0x9f
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU963
+	.uleb128 .LVU976
+.LLST253:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU963
+	.uleb128 .LVU976
+.LLST254:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x2
+	.byte	0x48
+	.byte	0x9f
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU963
+	.uleb128 .LVU976
+.LLST255:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU963
+	.uleb128 .LVU976
+.LLST256:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x2b
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x138
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+240
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU965
+	.uleb128 .LVU976
+.LLST257:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xffffff
+	.byte	0x9f
+	.byte	0
+.LVUS259:
+	.uleb128 .LVU989
+	.uleb128 .LVU1006
+.LLST259:
+	.byte	0x8
+	.quad	.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS260:
+	.uleb128 .LVU989
+	.uleb128 .LVU1006
+.LLST260:
+	.byte	0x8
+	.quad	.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS261:
+	.uleb128 .LVU989
+	.uleb128 .LVU1006
+.LLST261:
+	.byte	0x8
+	.quad	.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x51eb851f
+	.byte	0x9f
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU989
+	.uleb128 .LVU1006
+.LLST262:
+	.byte	0x8
+	.quad	.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightStickScale
+	.byte	0x9f
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU991
+	.uleb128 .LVU1006
+.LLST263:
+	.byte	0x8
+	.quad	.LVL217
+	.uleb128 .LVL218-.LVL217
+	.uleb128 0x4
+	.byte	0xa
+	.value	0xfff
+	.byte	0x9f
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1028
+.LLST265:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1028
+.LLST266:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1028
+.LLST267:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x6
+	.byte	0xc
+	.long	0xccccccd
+	.byte	0x9f
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1028
+.LLST268:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0xa
+	.byte	0x3
+	.quad	baseflightAngleScale
+	.byte	0x9f
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU1010
+	.uleb128 .LVU1028
+.LLST269:
+	.byte	0x8
+	.quad	.LVL218
+	.uleb128 .LVL219-.LVL218
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7f
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU53
+	.uleb128 .LVU67
+.LLST3:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+.LLST4:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+.LLST6:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU55
+	.uleb128 .LVU67
+.LLST7:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU57
+	.uleb128 .LVU67
+.LLST8:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU69
+	.uleb128 .LVU81
+.LLST10:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU71
+	.uleb128 .LVU81
+.LLST11:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU71
+	.uleb128 .LVU81
+.LLST13:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU71
+	.uleb128 .LVU81
+.LLST14:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 24
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU73
+	.uleb128 .LVU81
+.LLST15:
+	.byte	0x8
+	.quad	.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU83
+	.uleb128 .LVU95
+.LLST17:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU85
+	.uleb128 .LVU95
+.LLST18:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU85
+	.uleb128 .LVU95
+.LLST20:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU85
+	.uleb128 .LVU95
+.LLST21:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 48
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU87
+	.uleb128 .LVU95
+.LLST22:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU97
+	.uleb128 .LVU109
+.LLST24:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 72
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU99
+	.uleb128 .LVU109
+.LLST25:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU99
+	.uleb128 .LVU109
+.LLST27:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU99
+	.uleb128 .LVU109
+.LLST28:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 72
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU101
+	.uleb128 .LVU109
+.LLST29:
+	.byte	0x8
+	.quad	.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU111
+	.uleb128 .LVU123
+.LLST31:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU113
+	.uleb128 .LVU123
+.LLST32:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU113
+	.uleb128 .LVU123
+.LLST34:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU113
+	.uleb128 .LVU123
+.LLST35:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 96
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU115
+	.uleb128 .LVU123
+.LLST36:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU125
+	.uleb128 .LVU137
+.LLST38:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 120
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU127
+	.uleb128 .LVU137
+.LLST39:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU127
+	.uleb128 .LVU137
+.LLST41:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU127
+	.uleb128 .LVU137
+.LLST42:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 120
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU129
+	.uleb128 .LVU137
+.LLST43:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL17-.LVL16
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU139
+	.uleb128 .LVU151
+.LLST45:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 144
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU141
+	.uleb128 .LVU151
+.LLST46:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU141
+	.uleb128 .LVU151
+.LLST48:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU141
+	.uleb128 .LVU151
+.LLST49:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 144
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU143
+	.uleb128 .LVU151
+.LLST50:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU153
+	.uleb128 .LVU165
+.LLST52:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 168
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+.LLST53:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+.LLST55:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU155
+	.uleb128 .LVU165
+.LLST56:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 168
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU157
+	.uleb128 .LVU165
+.LLST57:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU167
+	.uleb128 .LVU179
+.LLST59:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 192
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU169
+	.uleb128 .LVU179
+.LLST60:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU169
+	.uleb128 .LVU179
+.LLST62:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU169
+	.uleb128 .LVU179
+.LLST63:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 192
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU171
+	.uleb128 .LVU179
+.LLST64:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU181
+	.uleb128 .LVU193
+.LLST66:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 216
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU183
+	.uleb128 .LVU193
+.LLST67:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU183
+	.uleb128 .LVU193
+.LLST69:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU183
+	.uleb128 .LVU193
+.LLST70:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 216
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU185
+	.uleb128 .LVU193
+.LLST71:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU195
+	.uleb128 .LVU208
+.LLST72:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 240
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU197
+	.uleb128 .LVU208
+.LLST73:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU197
+	.uleb128 .LVU208
+.LLST75:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU197
+	.uleb128 .LVU208
+.LLST76:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 240
+	.byte	0x9f
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU199
+	.uleb128 .LVU208
+.LLST77:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST80:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.LVL33
+	.uleb128 .LVL92-.LVL33
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL92-.LVL33
+	.uleb128 .LFE14-.LVL33
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU542
+	.uleb128 .LVU542
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 0
+.LLST81:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL39-.LVL33
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.LVL33
+	.uleb128 .LVL79-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL79-.LVL33
+	.uleb128 .LVL108-.LVL33
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL33
+	.uleb128 .LVL110-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.LVL33
+	.uleb128 .LFE14-.LVL33
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 0
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 0
+.LLST82:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL36-.LVL33
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL36-.LVL33
+	.uleb128 .LFE14-.LVL33
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU259
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST83:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.LVL33
+	.uleb128 .LVL92-.LVL33
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.LVL33
+	.uleb128 .LFE14-.LVL33
+	.uleb128 0x18
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU260
+	.uleb128 .LVU268
+	.uleb128 .LVU268
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 0
+.LLST84:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x16
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.LVL33
+	.uleb128 .LVL92-.LVL33
+	.uleb128 0x16
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.LVL33
+	.uleb128 .LFE14-.LVL33
+	.uleb128 0x17
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU292
+	.uleb128 .LVU447
+	.uleb128 .LVU542
+	.uleb128 .LVU545
+.LLST85:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL78-.LVL42
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL108-.LVL42
+	.uleb128 .LVL110-.LVL42
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU294
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU447
+	.uleb128 .LVU542
+	.uleb128 .LVU545
+.LLST86:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL48-.LVL42
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL42
+	.uleb128 .LVL49-.LVL42
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL49-.LVL42
+	.uleb128 .LVL76-.LVL42
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL42
+	.uleb128 .LVL78-.LVL42
+	.uleb128 0x7
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL42
+	.uleb128 .LVL110-.LVL42
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU332
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU434
+	.uleb128 .LVU434
+	.uleb128 .LVU447
+	.uleb128 .LVU542
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU545
+.LLST87:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL57-.LVL54
+	.uleb128 .LVL58-.LVL54
+	.uleb128 0x25
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x71
+	.sleb128 0
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL54
+	.uleb128 .LVL63-.LVL54
+	.uleb128 0xc4
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL54
+	.uleb128 .LVL76-.LVL54
+	.uleb128 0x166
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL54
+	.uleb128 .LVL78-.LVL54
+	.uleb128 0x16c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x75
+	.sleb128 0
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL108-.LVL54
+	.uleb128 .LVL109-.LVL54
+	.uleb128 0xc4
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x70
+	.sleb128 264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x70
+	.sleb128 56
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x70
+	.sleb128 48
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x70
+	.sleb128 68
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.LVL54
+	.uleb128 .LVL110-.LVL54
+	.uleb128 0x166
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x108
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x44
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU440
+	.uleb128 .LVU495
+	.uleb128 .LVU545
+	.uleb128 .LVU553
+.LLST88:
+	.byte	0x6
+	.quad	.LVL77
+	.byte	0x4
+	.uleb128 .LVL77-.LVL77
+	.uleb128 .LVL91-.LVL77
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL110-.LVL77
+	.uleb128 .LVL112-1-.LVL77
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU463
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU495
+	.uleb128 .LVU545
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU553
+.LLST89:
+	.byte	0x6
+	.quad	.LVL85
+	.byte	0x4
+	.uleb128 .LVL85-.LVL85
+	.uleb128 .LVL89-.LVL85
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL89-.LVL85
+	.uleb128 .LVL91-.LVL85
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL110-.LVL85
+	.uleb128 .LVL111-.LVL85
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL111-.LVL85
+	.uleb128 .LVL112-1-.LVL85
+	.uleb128 0x55
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb0
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xa8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU495
+	.uleb128 .LVU508
+.LLST90:
+	.byte	0x8
+	.quad	.LVL91
+	.uleb128 .LVL94-.LVL91
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU311
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU523
+	.uleb128 .LVU542
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 0
+.LLST91:
+	.byte	0x6
+	.quad	.LVL46
+	.byte	0x4
+	.uleb128 .LVL46-.LVL46
+	.uleb128 .LVL47-.LVL46
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL47-.LVL46
+	.uleb128 .LVL69-.LVL46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL69-.LVL46
+	.uleb128 .LVL101-.LVL46
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL108-.LVL46
+	.uleb128 .LVL110-.LVL46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL110-.LVL46
+	.uleb128 .LFE14-.LVL46
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU387
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU410
+	.uleb128 .LVU428
+	.uleb128 .LVU541
+	.uleb128 .LVU545
+	.uleb128 0
+.LLST92:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL70-.LVL67
+	.uleb128 0x5b
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+128
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+140
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL67
+	.uleb128 .LVL71-.LVL67
+	.uleb128 0x5b
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+128
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+140
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.LVL67
+	.uleb128 .LVL107-.LVL67
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL110-.LVL67
+	.uleb128 .LFE14-.LVL67
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU521
+	.uleb128 .LVU542
+.LLST93:
+	.byte	0x8
+	.quad	.LVL100
+	.uleb128 .LVL108-.LVL100
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU274
+	.uleb128 .LVU292
+.LLST95:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU274
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU292
+.LLST96:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL38-.LVL35
+	.uleb128 0x9
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x9
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU281
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 .LVU288
+	.uleb128 .LVU288
+	.uleb128 .LVU292
+.LLST97:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL40-.LVL37
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-.LVL37
+	.uleb128 .LVL41-.LVL37
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.LVL37
+	.uleb128 .LVL42-.LVL37
+	.uleb128 0xe
+	.byte	0x70
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x78
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU295
+	.uleb128 .LVU311
+.LLST99:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL46-.LVL42
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+24
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU295
+	.uleb128 .LVU311
+.LLST100:
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL46-.LVL42
+	.uleb128 0x25
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+308
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU301
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU305
+	.uleb128 .LVU305
+	.uleb128 .LVU311
+.LLST101:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL45-.LVL43
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL45-.LVL43
+	.uleb128 .LVL46-.LVL43
+	.uleb128 0x1d
+	.byte	0x70
+	.sleb128 308
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 40
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU313
+	.uleb128 .LVU327
+.LLST103:
+	.byte	0x8
+	.quad	.LVL46
+	.uleb128 .LVL52-.LVL46
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+48
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU313
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU327
+.LLST104:
+	.byte	0x6
+	.quad	.LVL46
+	.byte	0x4
+	.uleb128 .LVL46-.LVL46
+	.uleb128 .LVL48-.LVL46
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL46
+	.uleb128 .LVL49-.LVL46
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL49-.LVL46
+	.uleb128 .LVL52-.LVL46
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU319
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU327
+.LLST105:
+	.byte	0x6
+	.quad	.LVL49
+	.byte	0x4
+	.uleb128 .LVL49-.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL50-.LVL49
+	.uleb128 .LVL51-.LVL49
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL51-.LVL49
+	.uleb128 .LVL52-.LVL49
+	.uleb128 0x12
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 64
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU327
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU332
+.LLST106:
+	.byte	0x6
+	.quad	.LVL52
+	.byte	0x4
+	.uleb128 .LVL52-.LVL52
+	.uleb128 .LVL53-.LVL52
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL53-.LVL52
+	.uleb128 .LVL54-.LVL52
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 264
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST107:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL54-.LVL52
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU327
+	.uleb128 .LVU332
+.LLST108:
+	.byte	0x8
+	.quad	.LVL52
+	.uleb128 .LVL54-.LVL52
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU335
+	.uleb128 .LVU339
+.LLST110:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+72
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU335
+	.uleb128 .LVU339
+.LLST111:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU338
+	.uleb128 .LVU339
+.LLST112:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LVL56-.LVL56
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU350
+	.uleb128 .LVU352
+	.uleb128 .LVU352
+	.uleb128 .LVU355
+.LLST113:
+	.byte	0x6
+	.quad	.LVL59
+	.byte	0x4
+	.uleb128 .LVL59-.LVL59
+	.uleb128 .LVL60-.LVL59
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL60-.LVL59
+	.uleb128 .LVL62-.LVL59
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 272
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU350
+	.uleb128 .LVU355
+.LLST114:
+	.byte	0x8
+	.quad	.LVL59
+	.uleb128 .LVL62-.LVL59
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU350
+	.uleb128 .LVU354
+.LLST115:
+	.byte	0x8
+	.quad	.LVL59
+	.uleb128 .LVL61-.LVL59
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU364
+	.uleb128 .LVU372
+.LLST117:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL64-.LVL63
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU364
+	.uleb128 .LVU372
+.LLST118:
+	.byte	0x8
+	.quad	.LVL63
+	.uleb128 .LVL64-.LVL63
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU371
+	.uleb128 .LVU372
+.LLST119:
+	.byte	0x8
+	.quad	.LVL64
+	.uleb128 .LVL64-.LVL64
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU389
+	.uleb128 .LVU397
+.LLST121:
+	.byte	0x8
+	.quad	.LVL67
+	.uleb128 .LVL68-.LVL67
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+216
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU389
+	.uleb128 .LVU397
+.LLST122:
+	.byte	0x8
+	.quad	.LVL67
+	.uleb128 .LVL68-.LVL67
+	.uleb128 0x1c
+	.byte	0x75
+	.sleb128 12
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x75
+	.sleb128 8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU396
+	.uleb128 .LVU397
+.LLST123:
+	.byte	0x8
+	.quad	.LVL68
+	.uleb128 .LVL68-.LVL68
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU372
+	.uleb128 .LVU387
+.LLST125:
+	.byte	0x8
+	.quad	.LVL64
+	.uleb128 .LVL67-.LVL64
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU372
+	.uleb128 .LVU379
+	.uleb128 .LVU379
+	.uleb128 .LVU380
+.LLST126:
+	.byte	0x6
+	.quad	.LVL64
+	.byte	0x4
+	.uleb128 .LVL64-.LVL64
+	.uleb128 .LVL65-.LVL64
+	.uleb128 0x5b
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+104
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+116
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.LVL64
+	.uleb128 .LVL66-.LVL64
+	.uleb128 0x5b
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+104
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+96
+	.byte	0x22
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+116
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU386
+	.uleb128 .LVU387
+.LLST127:
+	.byte	0x8
+	.quad	.LVL67
+	.uleb128 .LVL67-.LVL67
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU405
+	.uleb128 .LVU428
+.LLST129:
+	.byte	0x8
+	.quad	.LVL69
+	.uleb128 .LVL75-.LVL69
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+216
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU405
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU410
+.LLST130:
+	.byte	0x6
+	.quad	.LVL69
+	.byte	0x4
+	.uleb128 .LVL69-.LVL69
+	.uleb128 .LVL70-.LVL69
+	.uleb128 0x6c
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+128
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+140
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x75
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL69
+	.uleb128 .LVL71-.LVL69
+	.uleb128 0x6c
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+128
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+120
+	.byte	0x22
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x22
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+140
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x75
+	.sleb128 16
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU420
+	.uleb128 .LVU423
+	.uleb128 .LVU423
+	.uleb128 .LVU424
+.LLST131:
+	.byte	0x6
+	.quad	.LVL72
+	.byte	0x4
+	.uleb128 .LVL72-.LVL72
+	.uleb128 .LVL73-.LVL72
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL73-.LVL72
+	.uleb128 .LVL74-.LVL72
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU441
+	.uleb128 .LVU458
+.LLST133:
+	.byte	0x8
+	.quad	.LVL77
+	.uleb128 .LVL83-.LVL77
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+144
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU441
+	.uleb128 .LVU458
+.LLST134:
+	.byte	0x8
+	.quad	.LVL77
+	.uleb128 .LVL83-.LVL77
+	.uleb128 0x1a
+	.byte	0x78
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates+8
+	.byte	0x22
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU450
+	.uleb128 .LVU453
+	.uleb128 .LVU453
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU458
+.LLST135:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL81-.LVL80
+	.uleb128 .LVL82-.LVL80
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL82-.LVL80
+	.uleb128 .LVL83-.LVL80
+	.uleb128 0x13
+	.byte	0x78
+	.sleb128 0
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x70
+	.sleb128 160
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 .LVU463
+.LLST136:
+	.byte	0x6
+	.quad	.LVL83
+	.byte	0x4
+	.uleb128 .LVL83-.LVL83
+	.uleb128 .LVL84-.LVL83
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL84-.LVL83
+	.uleb128 .LVL85-.LVL83
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 280
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU458
+	.uleb128 .LVU463
+.LLST137:
+	.byte	0x8
+	.quad	.LVL83
+	.uleb128 .LVL85-.LVL83
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU458
+	.uleb128 .LVU463
+.LLST138:
+	.byte	0x8
+	.quad	.LVL83
+	.uleb128 .LVL85-.LVL83
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU465
+	.uleb128 .LVU477
+.LLST140:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL89-.LVL85
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+168
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU465
+	.uleb128 .LVU477
+.LLST141:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL89-.LVL85
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU477
+.LLST142:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL87-.LVL86
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL87-.LVL86
+	.uleb128 .LVL88-.LVL86
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL88-.LVL86
+	.uleb128 .LVL89-.LVL86
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 184
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU480
+	.uleb128 .LVU495
+	.uleb128 .LVU545
+	.uleb128 0
+.LLST144:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL91-.LVL89
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL110-.LVL89
+	.uleb128 .LFE14-.LVL89
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU480
+	.uleb128 .LVU495
+	.uleb128 .LVU545
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU553
+.LLST145:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL91-.LVL89
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL110-.LVL89
+	.uleb128 .LVL111-.LVL89
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL111-.LVL89
+	.uleb128 .LVL112-1-.LVL89
+	.uleb128 0x55
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x26
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb0
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xb8
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xa8
+	.byte	0x6
+	.byte	0x22
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU480
+	.uleb128 .LVU495
+	.uleb128 .LVU545
+	.uleb128 0
+.LLST146:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL91-.LVL89
+	.uleb128 0x16
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.LVL89
+	.uleb128 .LFE14-.LVL89
+	.uleb128 0x17
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x8
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	axisStates
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU491
+	.uleb128 .LVU495
+	.uleb128 .LVU554
+	.uleb128 .LVU557
+	.uleb128 .LVU557
+	.uleb128 .LVU558
+.LLST147:
+	.byte	0x6
+	.quad	.LVL90
+	.byte	0x4
+	.uleb128 .LVL90-.LVL90
+	.uleb128 .LVL91-.LVL90
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL113-.LVL90
+	.uleb128 .LVL114-.LVL90
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL114-.LVL90
+	.uleb128 .LVL115-.LVL90
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -536870912
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU546
+	.uleb128 .LVU548
+.LLST149:
+	.byte	0x8
+	.quad	.LVL110
+	.uleb128 .LVL110-.LVL110
+	.uleb128 0x4
+	.byte	0x40
+	.byte	0x4a
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU546
+	.uleb128 .LVU548
+.LLST150:
+	.byte	0x8
+	.quad	.LVL110
+	.uleb128 .LVL110-.LVL110
+	.uleb128 0x5
+	.byte	0x40
+	.byte	0x4a
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU546
+	.uleb128 .LVU548
+.LLST151:
+	.byte	0x8
+	.quad	.LVL110
+	.uleb128 .LVL110-.LVL110
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU504
+	.uleb128 .LVU514
+.LLST153:
+	.byte	0x8
+	.quad	.LVL93
+	.uleb128 .LVL97-.LVL93
+	.uleb128 0x18
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+192
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU504
+	.uleb128 .LVU508
+.LLST154:
+	.byte	0x8
+	.quad	.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU506
+	.uleb128 .LVU509
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+.LLST155:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL95-.LVL93
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL95-.LVL93
+	.uleb128 .LVL96-.LVL93
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU525
+	.uleb128 .LVU535
+.LLST157:
+	.byte	0x8
+	.quad	.LVL102
+	.uleb128 .LVL106-.LVL102
+	.uleb128 0x18
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x138
+	.byte	0x1e
+	.byte	0x3
+	.quad	rateKernels+240
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU528
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU532
+.LLST158:
+	.byte	0x6
+	.quad	.LVL103
+	.byte	0x4
+	.uleb128 .LVL103-.LVL103
+	.uleb128 .LVL104-.LVL103
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL104-.LVL103
+	.uleb128 .LVL105-.LVL103
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU514
+	.uleb128 .LVU518
+	.uleb128 .LVU518
+	.uleb128 .LVU521
+.LLST159:
+	.byte	0x6
+	.quad	.LVL97
+	.byte	0x4
+	.uleb128 .LVL97-.LVL97
+	.uleb128 .LVL98-.LVL97
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL98-.LVL97
+	.uleb128 .LVL100-.LVL97
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 288
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU514
+	.uleb128 .LVU521
+.LLST160:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL100-.LVL97
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU514
+	.uleb128 .LVU520
+.LLST161:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL99-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU535
+	.uleb128 .LVU538
+.LLST162:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL106-.LVL106
+	.uleb128 0x9
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU535
+	.uleb128 .LVU538
+.LLST163:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL106-.LVL106
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS164:
+	.uleb128 .LVU535
+	.uleb128 .LVU538
+.LLST164:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL106-.LVL106
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU40
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL1
+	.uleb128 .LVL5-.LVL1
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-.LVL1
+	.uleb128 .LVL6-.LVL1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	axisSetpoints+2
+	.byte	0x4
+	.uleb128 .LVL7-.LVL1
+	.uleb128 .LVL8-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL1
+	.uleb128 .LVL10-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL1
+	.uleb128 .LVL10-.LVL1
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.LVL1
+	.uleb128 .LFE11-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU10
+	.uleb128 .LVU14
+	.uleb128 .LVU24
+	.uleb128 .LVU34
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU40
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL1
+	.uleb128 .LVL6-.LVL1
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL1
+	.uleb128 .LVL8-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.LVL1
+	.uleb128 .LVL10-.LVL1
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL1
+	.uleb128 .LFE11-.LVL1
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU255
+	.uleb128 .LVU255
+	.uleb128 .LVU256
+	.uleb128 .LVU256
+	.uleb128 0
+.LLST78:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL25-.LVL23
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL25-.LVL23
+	.uleb128 .LVL30-.LVL23
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL30-.LVL23
+	.uleb128 .LVL31-.LVL23
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL23
+	.uleb128 .LVL32-.LVL23
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.LVL23
+	.uleb128 .LFE10-.LVL23
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU238
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU247
+	.uleb128 .LVU247
+	.uleb128 .LVU252
+.LLST79:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL26-.LVL24
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL24
+	.uleb128 .LVL27-.LVL24
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL24
+	.uleb128 .LVL28-.LVL24
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL24
+	.uleb128 .LVL29-.LVL24
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 0
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU619
+	.uleb128 .LVU619
+	.uleb128 .LVU621
+	.uleb128 .LVU621
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 0
+.LLST165:
+	.byte	0x6
+	.quad	.LVL116
+	.byte	0x4
+	.uleb128 .LVL116-.LVL116
+	.uleb128 .LVL117-.LVL116
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL117-.LVL116
+	.uleb128 .LVL125-.LVL116
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL125-.LVL116
+	.uleb128 .LVL127-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL116
+	.uleb128 .LVL131-.LVL116
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL131-.LVL116
+	.uleb128 .LVL133-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.LVL116
+	.uleb128 .LVL137-.LVL116
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL137-.LVL116
+	.uleb128 .LFE6-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 0
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 0
+.LLST166:
+	.byte	0x6
+	.quad	.LVL116
+	.byte	0x4
+	.uleb128 .LVL116-.LVL116
+	.uleb128 .LVL118-1-.LVL116
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL118-1-.LVL116
+	.uleb128 .LFE6-.LVL116
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+.LVUS167:
+	.uleb128 0
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU603
+	.uleb128 .LVU603
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU621
+	.uleb128 .LVU621
+	.uleb128 .LVU639
+	.uleb128 .LVU639
+	.uleb128 0
+.LLST167:
+	.byte	0x6
+	.quad	.LVL116
+	.byte	0x4
+	.uleb128 .LVL116-.LVL116
+	.uleb128 .LVL118-1-.LVL116
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL118-1-.LVL116
+	.uleb128 .LVL126-.LVL116
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL126-.LVL116
+	.uleb128 .LVL127-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL127-.LVL116
+	.uleb128 .LVL132-.LVL116
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL132-.LVL116
+	.uleb128 .LVL133-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.LVL116
+	.uleb128 .LVL138-.LVL116
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL138-.LVL116
+	.uleb128 .LFE6-.LVL116
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU567
+	.uleb128 .LVU579
+	.uleb128 .LVU603
+	.uleb128 .LVU610
+	.uleb128 .LVU621
+	.uleb128 .LVU623
+.LLST168:
+	.byte	0x6
+	.quad	.LVL118
+	.byte	0x4
+	.uleb128 .LVL118-.LVL118
+	.uleb128 .LVL120-1-.LVL118
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL127-.LVL118
+	.uleb128 .LVL128-.LVL118
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL133-.LVL118
+	.uleb128 .LVL134-1-.LVL118
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU572
+	.uleb128 .LVU600
+	.uleb128 .LVU603
+	.uleb128 .LVU618
+	.uleb128 .LVU621
+	.uleb128 .LVU637
+.LLST169:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL124-.LVL119
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL127-.LVL119
+	.uleb128 .LVL130-.LVL119
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.LVL119
+	.uleb128 .LVL136-.LVL119
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU580
+	.uleb128 .LVU598
+.LLST171:
+	.byte	0x8
+	.quad	.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU580
+	.uleb128 .LVU598
+.LLST172:
+	.byte	0x8
+	.quad	.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU580
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 .LVU598
+.LLST173:
+	.byte	0x6
+	.quad	.LVL121
+	.byte	0x4
+	.uleb128 .LVL121-.LVL121
+	.uleb128 .LVL122-.LVL121
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL122-.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 16
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU580
+	.uleb128 .LVU598
+.LLST174:
+	.byte	0x8
+	.quad	.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU582
+	.uleb128 .LVU598
+.LLST175:
+	.byte	0x8
+	.quad	.LVL121
+	.uleb128 .LVL123-.LVL121
+	.uleb128 0xd
+	.byte	0x31
+	.byte	0x73
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU604
+	.uleb128 .LVU616
+.LLST176:
+	.byte	0x8
+	.quad	.LVL127
+	.uleb128 .LVL129-.LVL127
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU604
+	.uleb128 .LVU616
+.LLST179:
+	.byte	0x8
+	.quad	.LVL127
+	.uleb128 .LVL129-.LVL127
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU606
+	.uleb128 .LVU616
+.LLST180:
+	.byte	0x8
+	.quad	.LVL127
+	.uleb128 .LVL129-.LVL127
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU624
+	.uleb128 0
+.LLST182:
+	.byte	0x8
+	.quad	.LVL135
+	.uleb128 .LFE6-.LVL135
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU624
+	.uleb128 .LVU638
+	.uleb128 .LVU638
+	.uleb128 0
+.LLST183:
+	.byte	0x6
+	.quad	.LVL135
+	.byte	0x4
+	.uleb128 .LVL135-.LVL135
+	.uleb128 .LVL137-.LVL135
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL137-.LVL135
+	.uleb128 .LFE6-.LVL135
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xdc
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x5
+	.quad	.LBB150
+	.byte	0x4
+	.uleb128 .LBB150-.LBB150
+	.uleb128 .LBE150-.LBB150
+	.byte	0x4
+	.uleb128 .LBB200-.LBB150
+	.uleb128 .LBE200-.LBB150
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB155
+	.byte	0x4
+	.uleb128 .LBB155-.LBB155
+	.uleb128 .LBE155-.LBB155
+	.byte	0x4
+	.uleb128 .LBB201-.LBB155
+	.uleb128 .LBE201-.LBB155
+	.byte	0
+.LLRL16:
+	.byte	0x5
+	.quad	.LBB160
+	.byte	0x4
+	.uleb128 .LBB160-.LBB160
+	.uleb128 .LBE160-.LBB160
+	.byte	0x4
+	.uleb128 .LBB202-.LBB160
+	.uleb128 .LBE202-.LBB160
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB165
+	.byte	0x4
+	.uleb128 .LBB165-.LBB165
+	.uleb128 .LBE165-.LBB165
+	.byte	0x4
+	.uleb128 .LBB203-.LBB165
+	.uleb128 .LBE203-.LBB165
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB170
+	.byte	0x4
+	.uleb128 .LBB170-.LBB170
+	.uleb128 .LBE170-.LBB170
+	.byte	0x4
+	.uleb128 .LBB204-.LBB170
+	.uleb128 .LBE204-.LBB170
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB175
+	.byte	0x4
+	.uleb128 .LBB175-.LBB175
+	.uleb128 .LBE175-.LBB175
+	.byte	0x4
+	.uleb128 .LBB205-.LBB175
+	.uleb128 .LBE205-.LBB175
+	.byte	0
+.LLRL44:
+	.byte	0x5
+	.quad	.LBB180
+	.byte	0x4
+	.uleb128 .LBB180-.LBB180
+	.uleb128 .LBE180-.LBB180
+	.byte	0x4
+	.uleb128 .LBB206-.LBB180
+	.uleb128 .LBE206-.LBB180
+	.byte	0
+.LLRL51:
+	.byte	0x5
+	.quad	.LBB185
+	.byte	0x4
+	.uleb128 .LBB185-.LBB185
+	.uleb128 .LBE185-.LBB185
+	.byte	0x4
+	.uleb128 .LBB207-.LBB185
+	.uleb128 .LBE207-.LBB185
+	.byte	0
+.LLRL58:
+	.byte	0x5
+	.quad	.LBB190
+	.byte	0x4
+	.uleb128 .LBB190-.LBB190
+	.uleb128 .LBE190-.LBB190
+	.byte	0x4
+	.uleb128 .LBB208-.LBB190
+	.uleb128 .LBE208-.LBB190
+	.byte	0
+.LLRL65:
+	.byte	0x5
+	.quad	.LBB195
+	.byte	0x4
+	.uleb128 .LBB195-.LBB195
+	.uleb128 .LBE195-.LBB195
+	.byte	0x4
+	.uleb128 .LBB209-.LBB195
+	.uleb128 .LBE209-.LBB195
+	.byte	0
+.LLRL94:
+	.byte	0x5
+	.quad	.LBB251
+	.byte	0x4
+	.uleb128 .LBB251-.LBB251
+	.uleb128 .LBE251-.LBB251
+	.byte	0x4
+	.uleb128 .LBB258-.LBB251
+	.uleb128 .LBE258-.LBB251
+	.byte	0x4
+	.uleb128 .LBB259-.LBB251
+	.uleb128 .LBE259-.LBB251
+	.byte	0x4
+	.uleb128 .LBB260-.LBB251
+	.uleb128 .LBE260-.LBB251
+	.byte	0x4
+	.uleb128 .LBB261-.LBB251
+	.uleb128 .LBE261-.LBB251
+	.byte	0x4
+	.uleb128 .LBB262-.LBB251
+	.uleb128 .LBE262-.LBB251
+	.byte	0
+.LLRL98:
+	.byte	0x5
+	.quad	.LBB263
+	.byte	0x4
+	.uleb128 .LBB263-.LBB263
+	.uleb128 .LBE263-.LBB263
+	.byte	0x4
+	.uleb128 .LBB267-.LBB263
+	.uleb128 .LBE267-.LBB263
+	.byte	0x4
+	.uleb128 .LBB268-.LBB263
+	.uleb128 .LBE268-.LBB263
+	.byte	0
+.LLRL102:
+	.byte	0x5
+	.quad	.LBB269
+	.byte	0x4
+	.uleb128 .LBB269-.LBB269
+	.uleb128 .LBE269-.LBB269
+	.byte	0x4
+	.uleb128 .LBB272-.LBB269
+	.uleb128 .LBE272-.LBB269
+	.byte	0
+.LLRL109:
+	.byte	0x5
+	.quad	.LBB275
+	.byte	0x4
+	.uleb128 .LBB275-.LBB275
+	.uleb128 .LBE275-.LBB275
+	.byte	0x4
+	.uleb128 .LBB279-.LBB275
+	.uleb128 .LBE279-.LBB275
+	.byte	0x4
+	.uleb128 .LBB280-.LBB275
+	.uleb128 .LBE280-.LBB275
+	.byte	0
+.LLRL116:
+	.byte	0x5
+	.quad	.LBB283
+	.byte	0x4
+	.uleb128 .LBB283-.LBB283
+	.uleb128 .LBE283-.LBB283
+	.byte	0x4
+	.uleb128 .LBB288-.LBB283
+	.uleb128 .LBE288-.LBB283
+	.byte	0x4
+	.uleb128 .LBB293-.LBB283
+	.uleb128 .LBE293-.LBB283
+	.byte	0x4
+	.uleb128 .LBB298-.LBB283
+	.uleb128 .LBE298-.LBB283
+	.byte	0
+.LLRL120:
+	.byte	0x5
+	.quad	.LBB289
+	.byte	0x4
+	.uleb128 .LBB289-.LBB289
+	.uleb128 .LBE289-.LBB289
+	.byte	0x4
+	.uleb128 .LBB300-.LBB289
+	.uleb128 .LBE300-.LBB289
+	.byte	0x4
+	.uleb128 .LBB301-.LBB289
+	.uleb128 .LBE301-.LBB289
+	.byte	0
+.LLRL124:
+	.byte	0x5
+	.quad	.LBB294
+	.byte	0x4
+	.uleb128 .LBB294-.LBB294
+	.uleb128 .LBE294-.LBB294
+	.byte	0x4
+	.uleb128 .LBB299-.LBB294
+	.uleb128 .LBE299-.LBB294
+	.byte	0x4
+	.uleb128 .LBB306-.LBB294
+	.uleb128 .LBE306-.LBB294
+	.byte	0
+.LLRL128:
+	.byte	0x5
+	.quad	.LBB302
+	.byte	0x4
+	.uleb128 .LBB302-.LBB302
+	.uleb128 .LBE302-.LBB302
+	.byte	0x4
+	.uleb128 .LBB307-.LBB302
+	.uleb128 .LBE307-.LBB302
+	.byte	0x4
+	.uleb128 .LBB308-.LBB302
+	.uleb128 .LBE308-.LBB302
+	.byte	0
+.LLRL132:
+	.byte	0x5
+	.quad	.LBB309
+	.byte	0x4
+	.uleb128 .LBB309-.LBB309
+	.uleb128 .LBE309-.LBB309
+	.byte	0x4
+	.uleb128 .LBB313-.LBB309
+	.uleb128 .LBE313-.LBB309
+	.byte	0x4
+	.uleb128 .LBB314-.LBB309
+	.uleb128 .LBE314-.LBB309
+	.byte	0
+.LLRL139:
+	.byte	0x5
+	.quad	.LBB317
+	.byte	0x4
+	.uleb128 .LBB317-.LBB317
+	.uleb128 .LBE317-.LBB317
+	.byte	0x4
+	.uleb128 .LBB321-.LBB317
+	.uleb128 .LBE321-.LBB317
+	.byte	0x4
+	.uleb128 .LBB322-.LBB317
+	.uleb128 .LBE322-.LBB317
+	.byte	0
+.LLRL143:
+	.byte	0x5
+	.quad	.LBB323
+	.byte	0x4
+	.uleb128 .LBB323-.LBB323
+	.uleb128 .LBE323-.LBB323
+	.byte	0x4
+	.uleb128 .LBB348-.LBB323
+	.uleb128 .LBE348-.LBB323
+	.byte	0
+.LLRL148:
+	.byte	0x5
+	.quad	.LBB325
+	.byte	0x4
+	.uleb128 .LBB325-.LBB325
+	.uleb128 .LBE325-.LBB325
+	.byte	0x4
+	.uleb128 .LBB328-.LBB325
+	.uleb128 .LBE328-.LBB325
+	.byte	0
+.LLRL152:
+	.byte	0x5
+	.quad	.LBB330
+	.byte	0x4
+	.uleb128 .LBB330-.LBB330
+	.uleb128 .LBE330-.LBB330
+	.byte	0x4
+	.uleb128 .LBB335-.LBB330
+	.uleb128 .LBE335-.LBB330
+	.byte	0x4
+	.uleb128 .LBB336-.LBB330
+	.uleb128 .LBE336-.LBB330
+	.byte	0x4
+	.uleb128 .LBB341-.LBB330
+	.uleb128 .LBE341-.LBB330
+	.byte	0
+.LLRL156:
+	.byte	0x5
+	.quad	.LBB337
+	.byte	0x4
+	.uleb128 .LBB337-.LBB337
+	.uleb128 .LBE337-.LBB337
+	.byte	0x4
+	.uleb128 .LBB344-.LBB337
+	.uleb128 .LBE344-.LBB337
+	.byte	0x4
+	.uleb128 .LBB345-.LBB337
+	.uleb128 .LBE345-.LBB337
+	.byte	0
+.LLRL170:
+	.byte	0x5
+	.quad	.LBB349
+	.byte	0x4
+	.uleb128 .LBB349-.LBB349
+	.uleb128 .LBE349-.LBB349
+	.byte	0x4
+	.uleb128 .LBB352-.LBB349
+	.uleb128 .LBE352-.LBB349
+	.byte	0
+.LLRL181:
+	.byte	0x5
+	.quad	.LBB355
+	.byte	0x4
+	.uleb128 .LBB355-.LBB355
+	.uleb128 .LBE355-.LBB355
+	.byte	0x4
+	.uleb128 .LBB358-.LBB355
+	.uleb128 .LBE358-.LBB355
+	.byte	0
+.LLRL192:
+	.byte	0x5
+	.quad	.LBB402
+	.byte	0x4
+	.uleb128 .LBB402-.LBB402
+	.uleb128 .LBE402-.LBB402
+	.byte	0x4
+	.uleb128 .LBB472-.LBB402
+	.uleb128 .LBE472-.LBB402
+	.byte	0x4
+	.uleb128 .LBB505-.LBB402
+	.uleb128 .LBE505-.LBB402
+	.byte	0x4
+	.uleb128 .LBB507-.LBB402
+	.uleb128 .LBE507-.LBB402
+	.byte	0x4
+	.uleb128 .LBB509-.LBB402
+	.uleb128 .LBE509-.LBB402
+	.byte	0x4
+	.uleb128 .LBB511-.LBB402
+	.uleb128 .LBE511-.LBB402
+	.byte	0x4
+	.uleb128 .LBB513-.LBB402
+	.uleb128 .LBE513-.LBB402
+	.byte	0x4
+	.uleb128 .LBB515-.LBB402
+	.uleb128 .LBE515-.LBB402
+	.byte	0x4
+	.uleb128 .LBB517-.LBB402
+	.uleb128 .LBE517-.LBB402
+	.byte	0
+.LLRL196:
+	.byte	0x5
+	.quad	.LBB412
+	.byte	0x4
+	.uleb128 .LBB412-.LBB412
+	.uleb128 .LBE412-.LBB412
+	.byte	0x4
+	.uleb128 .LBB471-.LBB412
+	.uleb128 .LBE471-.LBB412
+	.byte	0x4
+	.uleb128 .LBB518-.LBB412
+	.uleb128 .LBE518-.LBB412
+	.byte	0
+.LLRL203:
+	.byte	0x5
+	.quad	.LBB414
+	.byte	0x4
+	.uleb128 .LBB414-.LBB414
+	.uleb128 .LBE414-.LBB414
+	.byte	0x4
+	.uleb128 .LBB418-.LBB414
+	.uleb128 .LBE418-.LBB414
+	.byte	0x4
+	.uleb128 .LBB423-.LBB414
+	.uleb128 .LBE423-.LBB414
+	.byte	0
+.LLRL206:
+	.byte	0x5
+	.quad	.LBB419
+	.byte	0x4
+	.uleb128 .LBB419-.LBB419
+	.uleb128 .LBE419-.LBB419
+	.byte	0x4
+	.uleb128 .LBB422-.LBB419
+	.uleb128 .LBE422-.LBB419
+	.byte	0
+.LLRL212:
+	.byte	0x5
+	.quad	.LBB426
+	.byte	0x4
+	.uleb128 .LBB426-.LBB426
+	.uleb128 .LBE426-.LBB426
+	.byte	0x4
+	.uleb128 .LBB465-.LBB426
+	.uleb128 .LBE465-.LBB426
+	.byte	0x4
+	.uleb128 .LBB466-.LBB426
+	.uleb128 .LBE466-.LBB426
+	.byte	0x4
+	.uleb128 .LBB467-.LBB426
+	.uleb128 .LBE467-.LBB426
+	.byte	0x4
+	.uleb128 .LBB468-.LBB426
+	.uleb128 .LBE468-.LBB426
+	.byte	0x4
+	.uleb128 .LBB469-.LBB426
+	.uleb128 .LBE469-.LBB426
+	.byte	0x4
+	.uleb128 .LBB470-.LBB426
+	.uleb128 .LBE470-.LBB426
+	.byte	0
+.LLRL214:
+	.byte	0x5
+	.quad	.LBB427
+	.byte	0x4
+	.uleb128 .LBB427-.LBB427
+	.uleb128 .LBE427-.LBB427
+	.byte	0x4
+	.uleb128 .LBB434-.LBB427
+	.uleb128 .LBE434-.LBB427
+	.byte	0x4
+	.uleb128 .LBB443-.LBB427
+	.uleb128 .LBE443-.LBB427
+	.byte	0x4
+	.uleb128 .LBB449-.LBB427
+	.uleb128 .LBE449-.LBB427
+	.byte	0x4
+	.uleb128 .LBB451-.LBB427
+	.uleb128 .LBE451-.LBB427
+	.byte	0x4
+	.uleb128 .LBB452-.LBB427
+	.uleb128 .LBE452-.LBB427
+	.byte	0
+.LLRL220:
+	.byte	0x5
+	.quad	.LBB435
+	.byte	0x4
+	.uleb128 .LBB435-.LBB435
+	.uleb128 .LBE435-.LBB435
+	.byte	0x4
+	.uleb128 .LBB439-.LBB435
+	.uleb128 .LBE439-.LBB435
+	.byte	0x4
+	.uleb128 .LBB440-.LBB435
+	.uleb128 .LBE440-.LBB435
+	.byte	0
+.LLRL226:
+	.byte	0x5
+	.quad	.LBB444
+	.byte	0x4
+	.uleb128 .LBB444-.LBB444
+	.uleb128 .LBE444-.LBB444
+	.byte	0x4
+	.uleb128 .LBB450-.LBB444
+	.uleb128 .LBE450-.LBB444
+	.byte	0x4
+	.uleb128 .LBB453-.LBB444
+	.uleb128 .LBE453-.LBB444
+	.byte	0x4
+	.uleb128 .LBB454-.LBB444
+	.uleb128 .LBE454-.LBB444
+	.byte	0
+.LLRL232:
+	.byte	0x5
+	.quad	.LBB457
+	.byte	0x4
+	.uleb128 .LBB457-.LBB457
+	.uleb128 .LBE457-.LBB457
+	.byte	0x4
+	.uleb128 .LBB462-.LBB457
+	.uleb128 .LBE462-.LBB457
+	.byte	0x4
+	.uleb128 .LBB463-.LBB457
+	.uleb128 .LBE463-.LBB457
+	.byte	0x4
+	.uleb128 .LBB464-.LBB457
+	.uleb128 .LBE464-.LBB457
+	.byte	0
+.LLRL235:
+	.byte	0x5
+	.quad	.LBB473
+	.byte	0x4
+	.uleb128 .LBB473-.LBB473
+	.uleb128 .LBE473-.LBB473
+	.byte	0x4
+	.uleb128 .LBB506-.LBB473
+	.uleb128 .LBE506-.LBB473
+	.byte	0x4
+	.uleb128 .LBB508-.LBB473
+	.uleb128 .LBE508-.LBB473
+	.byte	0x4
+	.uleb128 .LBB510-.LBB473
+	.uleb128 .LBE510-.LBB473
+	.byte	0x4
+	.uleb128 .LBB512-.LBB473
+	.uleb128 .LBE512-.LBB473
+	.byte	0x4
+	.uleb128 .LBB514-.LBB473
+	.uleb128 .LBE514-.LBB473
+	.byte	0x4
+	.uleb128 .LBB516-.LBB473
+	.uleb128 .LBE516-.LBB473
+	.byte	0
+.LLRL258:
+	.byte	0x5
+	.quad	.LBB483
+	.byte	0x4
+	.uleb128 .LBB483-.LBB483
+	.uleb128 .LBE483-.LBB483
+	.byte	0x4
+	.uleb128 .LBB488-.LBB483
+	.uleb128 .LBE488-.LBB483
+	.byte	0x4
+	.uleb128 .LBB489-.LBB483
+	.uleb128 .LBE489-.LBB483
+	.byte	0x4
+	.uleb128 .LBB490-.LBB483
+	.uleb128 .LBE490-.LBB483
+	.byte	0
+.LLRL264:
+	.byte	0x5
+	.quad	.LBB491
+	.byte	0x4
+	.uleb128 .LBB491-.LBB491
+	.uleb128 .LBE491-.LBB491
+	.byte	0x4
+	.uleb128 .LBB496-.LBB491
+	.uleb128 .LBE496-.LBB491
+	.byte	0x4
+	.uleb128 .LBB497-.LBB491
+	.uleb128 .LBE497-.LBB491
+	.byte	0x4
+	.uleb128 .LBB498-.LBB491
+	.uleb128 .LBE498-.LBB491
+	.byte	0
+.LLRL277:
+	.byte	0x5
+	.quad	.LBB538
+	.byte	0x4
+	.uleb128 .LBB538-.LBB538
+	.uleb128 .LBE538-.LBB538
+	.byte	0x4
+	.uleb128 .LBB547-.LBB538
+	.uleb128 .LBE547-.LBB538
+	.byte	0x4
+	.uleb128 .LBB548-.LBB538
+	.uleb128 .LBE548-.LBB538
+	.byte	0x4
+	.uleb128 .LBB549-.LBB538
+	.uleb128 .LBE549-.LBB538
+	.byte	0x4
+	.uleb128 .LBB550-.LBB538
+	.uleb128 .LBE550-.LBB538
+	.byte	0x4
+	.uleb128 .LBB551-.LBB538
+	.uleb128 .LBE551-.LBB538
+	.byte	0
+.LLRL279:
+	.byte	0x5
+	.quad	.LBB539
+	.byte	0x4
+	.uleb128 .LBB539-.LBB539
+	.uleb128 .LBE539-.LBB539
+	.byte	0x4
+	.uleb128 .LBB544-.LBB539
+	.uleb128 .LBE544-.LBB539
+	.byte	0x4
+	.uleb128 .LBB545-.LBB539
+	.uleb128 .LBE545-.LBB539
+	.byte	0x4
+	.uleb128 .LBB546-.LBB539
+	.uleb128 .LBE546-.LBB539
+	.byte	0
+.LLRL286:
+	.byte	0x5
+	.quad	.LBB554
+	.byte	0x4
+	.uleb128 .LBB554-.LBB554
+	.uleb128 .LBE554-.LBB554
+	.byte	0x4
+	.uleb128 .LBB559-.LBB554
+	.uleb128 .LBE559-.LBB554
+	.byte	0
+.LLRL330:
+	.byte	0x5
+	.quad	.LBB592
+	.byte	0x4
+	.uleb128 .LBB592-.LBB592
+	.uleb128 .LBE592-.LBB592
+	.byte	0x4
+	.uleb128 .LBB605-.LBB592
+	.uleb128 .LBE605-.LBB592
+	.byte	0x4
+	.uleb128 .LBB606-.LBB592
+	.uleb128 .LBE606-.LBB592
+	.byte	0x4
+	.uleb128 .LBB652-.LBB592
+	.uleb128 .LBE652-.LBB592
+	.byte	0
+.LLRL332:
+	.byte	0x5
+	.quad	.LBB593
+	.byte	0x4
+	.uleb128 .LBB593-.LBB593
+	.uleb128 .LBE593-.LBB593
+	.byte	0x4
+	.uleb128 .LBB600-.LBB593
+	.uleb128 .LBE600-.LBB593
+	.byte	0x4
+	.uleb128 .LBB601-.LBB593
+	.uleb128 .LBE601-.LBB593
+	.byte	0x4
+	.uleb128 .LBB602-.LBB593
+	.uleb128 .LBE602-.LBB593
+	.byte	0x4
+	.uleb128 .LBB603-.LBB593
+	.uleb128 .LBE603-.LBB593
+	.byte	0x4
+	.uleb128 .LBB604-.LBB593
+	.uleb128 .LBE604-.LBB593
+	.byte	0
+.LLRL339:
+	.byte	0x5
+	.quad	.LBB609
+	.byte	0x4
+	.uleb128 .LBB609-.LBB609
+	.uleb128 .LBE609-.LBB609
+	.byte	0x4
+	.uleb128 .LBB648-.LBB609
+	.uleb128 .LBE648-.LBB609
+	.byte	0x4
+	.uleb128 .LBB649-.LBB609
+	.uleb128 .LBE649-.LBB609
+	.byte	0x4
+	.uleb128 .LBB650-.LBB609
+	.uleb128 .LBE650-.LBB609
+	.byte	0x4
+	.uleb128 .LBB651-.LBB609
+	.uleb128 .LBE651-.LBB609
+	.byte	0
+.LLRL341:
+	.byte	0x5
+	.quad	.LBB610
+	.byte	0x4
+	.uleb128 .LBB610-.LBB610
+	.uleb128 .LBE610-.LBB610
+	.byte	0x4
+	.uleb128 .LBB624-.LBB610
+	.uleb128 .LBE624-.LBB610
+	.byte	0x4
+	.uleb128 .LBB642-.LBB610
+	.uleb128 .LBE642-.LBB610
+	.byte	0
+.LLRL347:
+	.byte	0x5
+	.quad	.LBB614
+	.byte	0x4
+	.uleb128 .LBB614-.LBB614
+	.uleb128 .LBE614-.LBB614
+	.byte	0x4
+	.uleb128 .LBB619-.LBB614
+	.uleb128 .LBE619-.LBB614
+	.byte	0x4
+	.uleb128 .LBB620-.LBB614
+	.uleb128 .LBE620-.LBB614
+	.byte	0x4
+	.uleb128 .LBB640-.LBB614
+	.uleb128 .LBE640-.LBB614
+	.byte	0
+.LLRL353:
+	.byte	0x5
+	.quad	.LBB621
+	.byte	0x4
+	.uleb128 .LBB621-.LBB621
+	.uleb128 .LBE621-.LBB621
+	.byte	0x4
+	.uleb128 .LBB641-.LBB621
+	.uleb128 .LBE641-.LBB621
+	.byte	0
+.LLRL359:
+	.byte	0x5
+	.quad	.LBB625
+	.byte	0x4
+	.uleb128 .LBB625-.LBB625
+	.uleb128 .LBE625-.LBB625
+	.byte	0x4
+	.uleb128 .LBB643-.LBB625
+	.uleb128 .LBE643-.LBB625
+	.byte	0
+.LLRL365:
+	.byte	0x5
+	.quad	.LBB628
+	.byte	0x4
+	.uleb128 .LBB628-.LBB628
+	.uleb128 .LBE628-.LBB628
+	.byte	0x4
+	.uleb128 .LBB644-.LBB628
+	.uleb128 .LBE644-.LBB628
+	.byte	0
+.LLRL371:
+	.byte	0x5
+	.quad	.LBB631
+	.byte	0x4
+	.uleb128 .LBB631-.LBB631
+	.uleb128 .LBE631-.LBB631
+	.byte	0x4
+	.uleb128 .LBB645-.LBB631
+	.uleb128 .LBE645-.LBB631
+	.byte	0
+.LLRL377:
+	.byte	0x5
+	.quad	.LBB634
+	.byte	0x4
+	.uleb128 .LBB634-.LBB634
+	.uleb128 .LBE634-.LBB634
+	.byte	0x4
+	.uleb128 .LBB646-.LBB634
+	.uleb128 .LBE646-.LBB634
+	.byte	0
+.LLRL383:
+	.byte	0x5
+	.quad	.LBB637
+	.byte	0x4
+	.uleb128 .LBB637-.LBB637
+	.uleb128 .LBE637-.LBB637
+	.byte	0x4
+	.uleb128 .LBB647-.LBB637
+	.uleb128 .LBE647-.LBB637
+	.byte	0
+.LLRL390:
+	.byte	0x5
+	.quad	.LBB655
+	.byte	0x4
+	.uleb128 .LBB655-.LBB655
+	.uleb128 .LBE655-.LBB655
+	.byte	0x4
+	.uleb128 .LBB659-.LBB655
+	.uleb128 .LBE659-.LBB655
+	.byte	0x4
+	.uleb128 .LBB660-.LBB655
+	.uleb128 .LBE660-.LBB655
+	.byte	0
+.LLRL391:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB10
+	.uleb128 .LFE10-.LFB10
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 35 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1000
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1027
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 44 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.file 45 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 46 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 47 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 48 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1158
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1166
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 49 ".//src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 50 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 ".//src/main/flight/autotune.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1234
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF992
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1029
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1056
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1120
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1130
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1149
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1157
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1165
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1175
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1191
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1196
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1218
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1222
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1229
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1451:
+	.string	"convertBaseflightGains"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF1191:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF800:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1096:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF725:
+	.string	"__DECL_SIMD_cosl "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1252:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF793:
+	.string	"__DECL_SIMD_atan "
+.LASF995:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1386:
+	.string	"dMeasurementWeight"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF963:
+	.string	"__DECL_SIMD_asinh "
+.LASF1260:
+	.string	"size_t"
+.LASF1489:
+	.string	"lowBits"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1015:
+	.string	"__f64(x) x ##f64"
+.LASF1346:
+	.string	"dynP8"
+.LASF810:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1350:
+	.string	"PID_CONTROLLER_REWRITE"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1442:
+	.string	"kernel"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1041:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF857:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1405:
+	.string	"errorAngleI"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1154:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1344:
+	.string	"cycleTime"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF815:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1254:
+	.string	"int32_t"
+.LASF1308:
+	.string	"PIDPITCH"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1188:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF883:
+	.string	"__DECL_SIMD_atan2 "
+.LASF775:
+	.string	"__DECL_SIMD_powl "
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF784:
+	.string	"__DECL_SIMD_acosf "
+.LASF834:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF807:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1253:
+	.string	"int16_t"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1024:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1392:
+	.string	"levelI"
+.LASF1454:
+	.string	"initIntegerRateKernel"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF924:
+	.string	"__DECL_SIMD_atanhf "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF778:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1324:
+	.string	"AI_PITCH"
+.LASF1456:
+	.string	"measured"
+.LASF851:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1391:
+	.string	"levelP"
+.LASF802:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1268:
+	.string	"GPS_HOLD_MODE"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1380:
+	.string	"DLimit"
+.LASF1127:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1137:
+	.string	"USE_GYRO_SITL "
+.LASF1197:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1002:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1357:
+	.string	"autotune"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1455:
+	.string	"state"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF472:
+	.string	"__P(args) args"
+.LASF730:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1208:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1110:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1291:
+	.string	"AUX2"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1337:
+	.string	"pitchDeciDegrees"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF770:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1492:
+	.string	"resetErrorGyro"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1382:
+	.string	"integratorResetGyro"
+.LASF1330:
+	.string	"roll"
+.LASF1114:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF990:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1433:
+	.string	"type"
+.LASF1427:
+	.string	"frexpf"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF984:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF791:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1142:
+	.string	"USE_USART1 "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1307:
+	.string	"PIDROLL"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1027:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1336:
+	.string	"rollDeciDegrees"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1314:
+	.string	"PIDLEVEL"
+.LASF1225:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF745:
+	.string	"__DECL_SIMD_sincosl "
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF761:
+	.string	"__DECL_SIMD_logf64x "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1230:
+	.string	"DTERM_FILTER_INPUT_LIMIT (1 << 30)"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_log1p "
+.LASF1084:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1410:
+	.string	"axisSetpointsValid"
+.LASF758:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1077:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF1371:
+	.string	"measurement"
+.LASF782:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF715:
+	.string	"NULL"
+.LASF1129:
+	.string	"U_ID_1 0"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1430:
+	.string	"biquadFilterFixedApply"
+.LASF1215:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1138:
+	.string	"ACC "
+.LASF1379:
+	.string	"deltaStepLimit"
+.LASF1378:
+	.string	"integratorLimit"
+.LASF1202:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1389:
+	.string	"pidAxisInput_s"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1468:
+	.string	"stick"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1304:
+	.string	"yawRate"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1189:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1192:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1139:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF997:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1071:
+	.string	"__MATHDECL"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1303:
+	.string	"rollPitchRate"
+.LASF850:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1036:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1086:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1249:
+	.string	"long int"
+.LASF1470:
+	.string	"resolveAxisSetpoints"
+.LASF1222:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1437:
+	.string	"angleTrim"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1100:
+	.string	"MATH_ERREXCEPT 2"
+.LASF863:
+	.string	"__DECL_SIMD_sinh "
+.LASF1051:
+	.string	"_Mdouble_ float"
+.LASF953:
+	.string	"__DECL_SIMD_tanh "
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF788:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1309:
+	.string	"PIDYAW"
+.LASF1398:
+	.string	"lastDInput"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1045:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF835:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1048:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1182:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1446:
+	.string	"initRewriteKernels"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1368:
+	.string	"shift"
+.LASF1238:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1390:
+	.string	"feedForward"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1481:
+	.string	"bitLength"
+.LASF869:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF914:
+	.string	"__DECL_SIMD_log1pf "
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1394:
+	.string	"rateWeight"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1457:
+	.string	"error"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1101:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1422:
+	.string	"baseflightHLevel"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1187:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1491:
+	.string	"high"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1321:
+	.string	"dterm_lpf_hz"
+.LASF1070:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1013:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF731:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF902:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF939:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1175:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1220:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1240:
+	.string	"signed char"
+.LASF904:
+	.string	"__DECL_SIMD_log2f "
+.LASF1256:
+	.string	"uint8_t"
+.LASF1233:
+	.string	"MULTIWII_P_SHIFT 28"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1017:
+	.string	"__f64x(x) x ##f64x"
+.LASF1288:
+	.string	"PITCH"
+.LASF1181:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1408:
+	.string	"pidControllerType"
+.LASF1273:
+	.string	"armingFlags"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1078:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF786:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1276:
+	.string	"sensorReadFuncPtr"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1282:
+	.string	"scale"
+.LASF1195:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1145:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1421:
+	.string	"baseflightALevel"
+.LASF1054:
+	.string	"_Mdouble_ long double"
+.LASF1237:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1353:
+	.string	"PID_SETPOINT_ANGLE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1301:
+	.string	"thrMid8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF763:
+	.string	"__DECL_SIMD_exp "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1212:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1146:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1480:
+	.string	"fractionBitsAdded"
+.LASF1354:
+	.string	"PID_SETPOINT_HORIZON"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1458:
+	.string	"increment"
+.LASF1162:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1040:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1160:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1119:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1023:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1445:
+	.string	"prop"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1358:
+	.string	"_Bool"
+.LASF812:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1194:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1106:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1474:
+	.string	"value"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1205:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1397:
+	.string	"integrator"
+.LASF1431:
+	.string	"constrain"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1317:
+	.string	"PID_ITEM_COUNT"
+.LASF1251:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1416:
+	.string	"baseflightGains_s"
+.LASF1418:
+	.string	"baseflightGains_t"
+.LASF895:
+	.string	"__DECL_SIMD_log10l "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1412:
+	.string	"setpointArmingFlags"
+.LASF1286:
+	.string	"gyro"
+.LASF1376:
+	.string	"output"
+.LASF1210:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1343:
+	.string	"magHold"
+.LASF1231:
+	.string	"PID_RECIPROCAL(divisor,shift) ((int32_t)((((int64_t)1 << (shift)) + (divisor) - 1) / (divisor)))"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1035:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF884:
+	.string	"__DECL_SIMD_atan2f "
+.LASF825:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1094:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1088:
+	.string	"FP_NAN 0"
+.LASF1409:
+	.string	"axisSetpoints"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF903:
+	.string	"__DECL_SIMD_log2 "
+.LASF374:
+	.string	"__unix 1"
+.LASF1320:
+	.string	"H_level"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1245:
+	.string	"__uint16_t"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF734:
+	.string	"__DECL_SIMD_sinf "
+.LASF1361:
+	.string	"PID_ROUND_TOWARDS_ZERO"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1227:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1461:
+	.string	"deltaSum"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1134:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1265:
+	.string	"MAG_MODE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1186:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF1223:
+	.string	"LAT 0"
+.LASF839:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF789:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1477:
+	.string	"numerator"
+.LASF1266:
+	.string	"BARO_MODE"
+.LASF727:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1111:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1327:
+	.string	"FD_PITCH"
+.LASF1269:
+	.string	"HEADFREE_MODE"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1018:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1132:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF937:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF945:
+	.string	"__DECL_SIMD_erfl "
+.LASF1128:
+	.string	"U_ID_0 0x5349544c"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1090:
+	.string	"FP_ZERO 2"
+.LASF1125:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF1312:
+	.string	"PIDPOSR"
+.LASF1046:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1396:
+	.string	"pidAxisState_s"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1116:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1131:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1211:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF767:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1091:
+	.string	"FP_SUBNORMAL 3"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF849:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF841:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1216:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1168:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1097:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1440:
+	.string	"input"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1414:
+	.string	"pid_controller"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1447:
+	.string	"initMultiWiiKernels"
+.LASF1207:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1120:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1219:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1057:
+	.string	"_Mdouble_ _Float32"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1029:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF909:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF874:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1034:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF975:
+	.string	"__DECL_SIMD_erfcl "
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF390:
+	.string	"bool _Bool"
+.LASF713:
+	.string	"__size_t "
+.LASF1218:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1329:
+	.string	"rollAndPitchTrims_s"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1242:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF917:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF872:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1135:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF1271:
+	.string	"PASSTHRU_MODE"
+.LASF925:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1476:
+	.string	"pidScaleInitRatio"
+.LASF1413:
+	.string	"pidControllerFuncPtr"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF726:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF811:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1486:
+	.string	"pidScaleInitIdentity"
+.LASF1043:
+	.string	"_Mdouble_ double"
+.LASF1228:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1488:
+	.string	"rounding"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1066:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF974:
+	.string	"__DECL_SIMD_erfcf "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1435:
+	.string	"controlRateConfig"
+.LASF915:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1241:
+	.string	"__int8_t"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF1364:
+	.string	"pidScale_s"
+.LASF1369:
+	.string	"pidScale_t"
+.LASF993:
+	.string	"_BITS_FLOATN_H "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1037:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF768:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF803:
+	.string	"__DECL_SIMD_asin "
+.LASF1443:
+	.string	"pidRewrite"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1467:
+	.string	"stickScale"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1056:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1147:
+	.string	"BLACKBOX "
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1362:
+	.string	"PID_ROUND_NEAREST"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1170:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF852:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF824:
+	.string	"__DECL_SIMD_exp2f "
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1163:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1471:
+	.string	"autotuning"
+.LASF1198:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF905:
+	.string	"__DECL_SIMD_log2l "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF929:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF960:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF926:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1496:
+	.string	"rc_alias"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1250:
+	.string	"__uint64_t"
+.LASF855:
+	.string	"__DECL_SIMD_expm1l "
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1478:
+	.string	"denominator"
+.LASF1403:
+	.string	"rateKernels"
+.LASF1235:
+	.string	"long unsigned int"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF732:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF833:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1351:
+	.string	"PID_CONTROLLER_BASEFLIGHT"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1393:
+	.string	"levelWeight"
+.LASF729:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF777:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1130:
+	.string	"U_ID_2 0"
+.LASF934:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1014:
+	.string	"__f32(x) x ##f32"
+.LASF1032:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1452:
+	.string	"gains"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF896:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF766:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF898:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1085:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF992:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF781:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1311:
+	.string	"PIDPOS"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1328:
+	.string	"FD_YAW"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF847:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1124:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF1089:
+	.string	"FP_INFINITE 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1338:
+	.string	"rollAndPitchInclination_t_def"
+.LASF1144:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1366:
+	.string	"negativeBias"
+.LASF1217:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF991:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF754:
+	.string	"__DECL_SIMD_logf "
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF894:
+	.string	"__DECL_SIMD_log10f "
+.LASF1173:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF983:
+	.string	"__DECL_SIMD_tan "
+.LASF1360:
+	.string	"PID_ROUND_DOWN"
+.LASF1105:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1117:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF885:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1069:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1497:
+	.string	"biquadFilterFixedInitLPF"
+.LASF1157:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF773:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1019:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF735:
+	.string	"__DECL_SIMD_sinl "
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1108:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1247:
+	.string	"__uint32_t"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1068:
+	.string	"__MATHDECL_1_IMPL"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1103:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF873:
+	.string	"__DECL_SIMD_cbrt "
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1401:
+	.string	"dtermFilter"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1383:
+	.string	"integratorResetStick"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1213:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1479:
+	.string	"gainBits"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF723:
+	.string	"__DECL_SIMD_cos "
+.LASF1012:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1483:
+	.string	"pidScaleInitFloat"
+.LASF1469:
+	.string	"pidRateKernel"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1209:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF739:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1429:
+	.string	"memcpy"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1121:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1261:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1334:
+	.string	"rollAndPitchTrims_t"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1473:
+	.string	"pidScale"
+.LASF1279:
+	.string	"init"
+.LASF1200:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF462:
+	.string	"__PMT"
+.LASF755:
+	.string	"__DECL_SIMD_logl "
+.LASF780:
+	.string	"__DECL_SIMD_powf32x "
+.LASF933:
+	.string	"__DECL_SIMD_acosh "
+.LASF964:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF900:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1061:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF998:
+	.string	"__f128(x) x ##f128"
+.LASF1406:
+	.string	"dtermFilterCutoff"
+.LASF1272:
+	.string	"SONAR_MODE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF801:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1020:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1221:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1107:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF853:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF919:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1064:
+	.string	"_Mdouble_ _Float32x"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1280:
+	.string	"read"
+.LASF854:
+	.string	"__DECL_SIMD_expm1f "
+.LASF994:
+	.string	"__HAVE_FLOAT128 1"
+.LASF897:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1239:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1153:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1407:
+	.string	"dtermFilterSamplePeriod"
+.LASF954:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1425:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1042:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF989:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1229:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF1436:
+	.string	"max_angle_inclination"
+.LASF1118:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF988:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1185:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1122:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF893:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF886:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF769:
+	.string	"__DECL_SIMD_expf128 "
+.LASF908:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1313:
+	.string	"PIDNAVR"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1466:
+	.string	"getErrorAngle"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1490:
+	.string	"constrain64"
+.LASF1214:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1201:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF774:
+	.string	"__DECL_SIMD_powf "
+.LASF1438:
+	.string	"errorAngle"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1465:
+	.string	"smoothDelta"
+.LASF1426:
+	.string	"ldexpf"
+.LASF1169:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1098:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF391:
+	.string	"true 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF776:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1335:
+	.string	"rollAndPitchInclination_s"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1339:
+	.string	"rollAndPitchInclination_t"
+.LASF1159:
+	.string	"sq(x) ((x)*(x))"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1275:
+	.string	"sensorInitFuncPtr"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1464:
+	.string	"DTerm"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1083:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF956:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1348:
+	.string	"dynD8"
+.LASF1156:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF740:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1005:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1318:
+	.string	"pidProfile_s"
+.LASF1322:
+	.string	"pidProfile_t"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF935:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1424:
+	.string	"baseflightAngleScale"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF765:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF948:
+	.string	"__DECL_SIMD_erff64 "
+.LASF844:
+	.string	"__DECL_SIMD_coshf "
+.LASF759:
+	.string	"__DECL_SIMD_logf128 "
+.LASF779:
+	.string	"__DECL_SIMD_powf128 "
+.LASF906:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF911:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1115:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF809:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1298:
+	.string	"controlRateConfig_s"
+.LASF1305:
+	.string	"controlRateConfig_t"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1475:
+	.string	"product"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1136:
+	.string	"GYRO "
+.LASF1325:
+	.string	"angle_index_t"
+.LASF785:
+	.string	"__DECL_SIMD_acosl "
+.LASF1482:
+	.string	"length"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1113:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF721:
+	.string	"_MATH_H 1"
+.LASF1143:
+	.string	"USE_USART2 "
+.LASF987:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1498:
+	.string	"setPIDController"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1441:
+	.string	"useDTermFilter"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1387:
+	.string	"dGyroWeight"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF756:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1204:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1448:
+	.string	"gyroLoop"
+.LASF783:
+	.string	"__DECL_SIMD_acos "
+.LASF797:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1263:
+	.string	"ANGLE_MODE"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1449:
+	.string	"pidBaseflight"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF986:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1316:
+	.string	"PIDVEL"
+.LASF1352:
+	.string	"PID_SETPOINT_RATE"
+.LASF1310:
+	.string	"PIDALT"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1395:
+	.string	"pidAxisInput_t"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF916:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1402:
+	.string	"pidAxisState_t"
+.LASF1093:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1326:
+	.string	"FD_ROLL"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1140:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF796:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF753:
+	.string	"__DECL_SIMD_log "
+.LASF1381:
+	.string	"outputLimit"
+.LASF1257:
+	.string	"uint16_t"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1087:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1277:
+	.string	"biquadFilterFixed_s"
+.LASF1262:
+	.string	"biquadFilterFixed_t"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF901:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF805:
+	.string	"__DECL_SIMD_asinl "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1199:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1411:
+	.string	"setpointFlightModes"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF865:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF899:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1166:
+	.string	"BIQUAD_FIXED_FRACTION_BITS 30"
+.LASF1224:
+	.string	"LON 1"
+.LASF1460:
+	.string	"delta"
+.LASF1278:
+	.string	"gyro_s"
+.LASF742:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1031:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1299:
+	.string	"rcRate8"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF946:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1404:
+	.string	"axisStates"
+.LASF1171:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF1158:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1038:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1345:
+	.string	"targetPidLooptime"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF823:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1267:
+	.string	"GPS_HOME_MODE"
+.LASF1484:
+	.string	"exponent"
+.LASF1150:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1126:
+	.string	"__disable_irq() "
+.LASF1373:
+	.string	"integratorOutput"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1495:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1315:
+	.string	"PIDMAG"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1172:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1432:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1285:
+	.string	"heading"
+.LASF1226:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1003:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1363:
+	.string	"pidRounding_e"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1439:
+	.string	"axis"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF722:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF744:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1243:
+	.string	"__int16_t"
+.LASF1179:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1453:
+	.string	"initBaseflightKernels"
+.LASF1281:
+	.string	"temperature"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF764:
+	.string	"__DECL_SIMD_expf "
+.LASF1462:
+	.string	"PTerm"
+.LASF746:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF952:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1058:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1399:
+	.string	"delta1"
+.LASF1400:
+	.string	"delta2"
+.LASF1500:
+	.string	"resetRollAndPitchTrims"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF792:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1178:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1149:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1283:
+	.string	"samplePeriod"
+.LASF1333:
+	.string	"values"
+.LASF944:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1341:
+	.string	"gyroData"
+.LASF1289:
+	.string	"THROTTLE"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF996:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1428:
+	.string	"memcmp"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF969:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1184:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1176:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1232:
+	.string	"Q24_ONE (1 << 24)"
+.LASF733:
+	.string	"__DECL_SIMD_sin "
+.LASF1092:
+	.string	"FP_NORMAL 4"
+.LASF1434:
+	.string	"pidProfile"
+.LASF724:
+	.string	"__DECL_SIMD_cosf "
+.LASF1347:
+	.string	"dynI8"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1264:
+	.string	"HORIZON_MODE"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1022:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1183:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1000:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1167:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1485:
+	.string	"mantissa"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1004:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1493:
+	.string	"resetErrorAngle"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1047:
+	.string	"_Mdouble_"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1385:
+	.string	"dSetpointWeight"
+.LASF747:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1274:
+	.string	"flightModeFlags"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1141:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1055:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF737:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1165:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF923:
+	.string	"__DECL_SIMD_atanh "
+.LASF1302:
+	.string	"thrExpo8"
+.LASF1062:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1244:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF985:
+	.string	"__DECL_SIMD_tanl "
+.LASF943:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF771:
+	.string	"__DECL_SIMD_expf64x "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1259:
+	.string	"uint64_t"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1284:
+	.string	"gyro_t"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1177:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1161:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1450:
+	.string	"inverseDT"
+.LASF1372:
+	.string	"integratorStep"
+.LASF949:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1472:
+	.string	"updateDTermFilter"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF845:
+	.string	"__DECL_SIMD_coshl "
+.LASF814:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1133:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1463:
+	.string	"ITerm"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1323:
+	.string	"AI_ROLL"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1155:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF848:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF1444:
+	.string	"pidMultiWii"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF772:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF1419:
+	.string	"baseflightGainsConverted"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1190:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF973:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1072:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF738:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1016:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1151:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF951:
+	.string	"__DECL_SIMD_erff64x "
+.LASF392:
+	.string	"false 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1039:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF798:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1248:
+	.string	"__int64_t"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1028:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF843:
+	.string	"__DECL_SIMD_cosh "
+.LASF1300:
+	.string	"rcExpo8"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF794:
+	.string	"__DECL_SIMD_atanf "
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1340:
+	.string	"inclination"
+.LASF1494:
+	.string	"rollAndPitchTrims"
+.LASF1417:
+	.string	"gyroScale"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF846:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1193:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1377:
+	.string	"integratorStepLimit"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF959:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF955:
+	.string	"__DECL_SIMD_tanhl "
+.LASF806:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF799:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1384:
+	.string	"pSetpointWeight"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF382:
+	.string	"__REVISION__ \"7510219\""
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF957:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF829:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF999:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1001:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1258:
+	.string	"uint32_t"
+.LASF1164:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF743:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF907:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF813:
+	.string	"__DECL_SIMD_hypot "
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF736:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1499:
+	.string	"resetAxisStates"
+.LASF947:
+	.string	"__DECL_SIMD_erff32 "
+.LASF930:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1033:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF787:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF741:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF965:
+	.string	"__DECL_SIMD_asinhl "
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1236:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1287:
+	.string	"ROLL"
+.LASF1060:
+	.string	"_Mdouble_ _Float64"
+.LASF1331:
+	.string	"pitch"
+.LASF1349:
+	.string	"PID_CONTROLLER_MULTIWII"
+.LASF1174:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1290:
+	.string	"AUX1"
+.LASF1319:
+	.string	"A_level"
+.LASF1292:
+	.string	"AUX3"
+.LASF1293:
+	.string	"AUX4"
+.LASF1294:
+	.string	"AUX5"
+.LASF1295:
+	.string	"AUX6"
+.LASF1296:
+	.string	"AUX7"
+.LASF1297:
+	.string	"AUX8"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1367:
+	.string	"gain"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1099:
+	.string	"MATH_ERRNO 1"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF804:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF795:
+	.string	"__DECL_SIMD_atanl "
+.LASF757:
+	.string	"__DECL_SIMD_logf32 "
+.LASF950:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1332:
+	.string	"rollAndPitchTrims_t_def"
+.LASF1044:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1246:
+	.string	"__int32_t"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1255:
+	.string	"int64_t"
+.LASF1375:
+	.string	"blend"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1423:
+	.string	"baseflightStickScale"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF864:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1356:
+	.string	"setpoint"
+.LASF1021:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1095:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1026:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1112:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1234:
+	.string	"GYRO_I_MAX 256"
+.LASF790:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1365:
+	.string	"bias"
+.LASF1306:
+	.string	"rcCommand"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1415:
+	.string	"rcAliasToAngleIndexMap"
+.LASF1355:
+	.string	"pidAxisSetpoint_s"
+.LASF1359:
+	.string	"pidAxisSetpoint_t"
+.LASF760:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1487:
+	.string	"pidScaleInit"
+.LASF1374:
+	.string	"deltaStep"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1152:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1030:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1063:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF1052:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1420:
+	.string	"baseflightGainsValid"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1196:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF1203:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF910:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1270:
+	.string	"AUTOTUNE_MODE"
+.LASF808:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1109:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1102:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1148:
+	.string	"PROFILING "
+.LASF1370:
+	.string	"pidRateKernel_s"
+.LASF1388:
+	.string	"pidRateKernel_t"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1459:
+	.string	"dInput"
+.LASF1342:
+	.string	"axisPID"
+.LASF1123:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF728:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1180:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF1206:
+	.string	"YAW_CE (3 << (2 * YAW))"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/flight/flight.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,17206 @@
+	.file	"imu.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/flight/imu.c"
+	.section	.text.calculateHeading.isra.0,"ax",@progbits
+	.p2align 4
+	.type	calculateHeading.isra.0, @function
+calculateHeading.isra.0:
+.LFB20:
+	.file 1 ".//src/main/flight/imu.c"
+	.loc 1 338 16 view -0
+	.cfi_startproc
+.LVL0:
+	.loc 1 340 5 view .LVU1
+	.loc 1 341 5 view .LVU2
+	.loc 1 343 5 view .LVU3
+	.loc 1 338 16 is_stmt 0 view .LVU4
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 340 27 view .LVU5
+	movss	rMat(%rip), %xmm4
+	.loc 1 340 52 view .LVU6
+	movss	4+rMat(%rip), %xmm3
+	.loc 1 340 77 view .LVU7
+	movss	8+rMat(%rip), %xmm5
+	.loc 1 340 52 view .LVU8
+	mulss	%xmm1, %xmm3
+	.loc 1 340 27 view .LVU9
+	mulss	%xmm0, %xmm4
+	.loc 1 341 27 view .LVU10
+	mulss	12+rMat(%rip), %xmm0
+.LVL1:
+	.loc 1 340 77 view .LVU11
+	mulss	%xmm2, %xmm5
+	.loc 1 341 77 view .LVU12
+	mulss	20+rMat(%rip), %xmm2
+	.loc 1 340 39 view .LVU13
+	addss	%xmm3, %xmm4
+	.loc 1 341 52 view .LVU14
+	movss	16+rMat(%rip), %xmm3
+	mulss	%xmm1, %xmm3
+	.loc 1 343 12 view .LVU15
+	addss	%xmm5, %xmm4
+	movaps	%xmm4, %xmm1
+	.loc 1 341 39 view .LVU16
+	addss	%xmm3, %xmm0
+	.loc 1 341 11 view .LVU17
+	addss	%xmm2, %xmm0
+	.loc 1 343 12 view .LVU18
+	call	atan2_approx@PLT
+.LVL2:
+.LBB4:
+.LBI4:
+	.loc 1 324 16 is_stmt 1 view .LVU19
+.LBB5:
+	.loc 1 326 5 view .LVU20
+	.loc 1 328 5 view .LVU21
+	.loc 1 329 5 view .LVU22
+	.loc 1 328 28 is_stmt 0 view .LVU23
+	mulss	.LC0(%rip), %xmm0
+.LVL3:
+	.loc 1 328 44 view .LVU24
+	pxor	%xmm1, %xmm1
+	cvtss2sd	magneticDeclination(%rip), %xmm1
+	.loc 1 328 28 view .LVU25
+	cvtss2sd	%xmm0, %xmm0
+.LVL4:
+	.loc 1 328 38 view .LVU26
+	divsd	.LC1(%rip), %xmm0
+.LVL5:
+	.loc 1 328 44 view .LVU27
+	addsd	%xmm1, %xmm0
+	.loc 1 328 67 view .LVU28
+	divsd	.LC2(%rip), %xmm0
+	.loc 1 328 11 view .LVU29
+	cvtsd2ss	%xmm0, %xmm0
+	.loc 1 329 12 view .LVU30
+	call	lrintf@PLT
+.LVL6:
+	.loc 1 330 5 is_stmt 1 view .LVU31
+	.loc 1 331 14 is_stmt 0 view .LVU32
+	testw	%ax, %ax
+	leal	360(%rax), %edx
+	cmovs	%edx, %eax
+.LVL7:
+	.loc 1 331 14 view .LVU33
+.LBE5:
+.LBE4:
+	.loc 1 344 1 view .LVU34
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	calculateHeading.isra.0, .-calculateHeading.isra.0
+	.section	.text.configureImu,"ax",@progbits
+	.p2align 4
+	.globl	configureImu
+	.type	configureImu, @function
+configureImu:
+.LVL8:
+.LFB0:
+	.loc 1 107 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 108 5 view .LVU36
+	.loc 1 108 22 is_stmt 0 view .LVU37
+	movq	%rdi, imuRuntimeConfig(%rip)
+	.loc 1 109 5 is_stmt 1 view .LVU38
+	.loc 1 109 16 is_stmt 0 view .LVU39
+	movq	%rsi, pidProfile(%rip)
+	.loc 1 110 5 is_stmt 1 view .LVU40
+	.loc 1 110 17 is_stmt 0 view .LVU41
+	movq	%rdx, accDeadband(%rip)
+	.loc 1 111 5 is_stmt 1 view .LVU42
+	.loc 1 111 26 is_stmt 0 view .LVU43
+	movb	$0, imuFilterInitialised(%rip)
+	.loc 1 112 1 view .LVU44
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	configureImu, .-configureImu
+	.section	.text.imuInit,"ax",@progbits
+	.p2align 4
+	.globl	imuInit
+	.type	imuInit, @function
+imuInit:
+.LFB2:
+	.loc 1 132 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 5 view .LVU46
+	.loc 1 132 1 is_stmt 0 view .LVU47
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 133 18 view .LVU48
+	movzwl	acc_1G(%rip), %eax
+	pxor	%xmm2, %xmm2
+	.loc 1 133 48 view .LVU49
+	pxor	%xmm0, %xmm0
+	.loc 1 133 18 view .LVU50
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 133 66 view .LVU51
+	movq	imuRuntimeConfig(%rip), %rax
+	.loc 1 133 48 view .LVU52
+	movsbl	24(%rax), %eax
+	cvtsi2sdl	%eax, %xmm0
+	mulsd	.LC3(%rip), %xmm0
+	.loc 1 133 18 view .LVU53
+	movss	%xmm2, 12(%rsp)
+	.loc 1 133 34 view .LVU54
+	cvtsd2ss	%xmm0, %xmm0
+	call	cosf@PLT
+.LVL9:
+	.loc 1 133 18 view .LVU55
+	mulss	12(%rsp), %xmm0
+	call	lrintf@PLT
+.LVL10:
+	.loc 1 134 28 view .LVU56
+	movss	.LC4(%rip), %xmm0
+	divss	12(%rsp), %xmm0
+	.loc 1 134 37 view .LVU57
+	divss	.LC5(%rip), %xmm0
+	.loc 1 134 17 view .LVU58
+	movss	%xmm0, accVelScale(%rip)
+	.loc 1 135 24 view .LVU59
+	pxor	%xmm0, %xmm0
+	.loc 1 135 48 view .LVU60
+	movsd	.LC6(%rip), %xmm1
+	.loc 1 137 5 view .LVU61
+	leaq	mahonyEstimator(%rip), %rdi
+	.loc 1 135 24 view .LVU62
+	cvtss2sd	24+gyro(%rip), %xmm0
+	.loc 1 135 31 view .LVU63
+	mulsd	.LC3(%rip), %xmm0
+	.loc 1 133 16 view .LVU64
+	movw	%ax, smallAngle(%rip)
+	.loc 1 134 5 is_stmt 1 view .LVU65
+	.loc 1 135 5 view .LVU66
+	.loc 1 135 48 is_stmt 0 view .LVU67
+	mulsd	%xmm0, %xmm1
+	.loc 1 136 40 view .LVU68
+	cvtsd2ss	%xmm0, %xmm0
+	movss	%xmm0, gyroScaleRadPerSecond(%rip)
+	.loc 1 135 48 view .LVU69
+	cvtsd2ss	%xmm1, %xmm1
+	movss	%xmm1, gyroScaleRad(%rip)
+	.loc 1 136 5 is_stmt 1 view .LVU70
+	.loc 1 137 5 view .LVU71
+	call	mahonyReset@PLT
+.LVL11:
+	.loc 1 138 5 view .LVU72
+	.loc 1 138 19 is_stmt 0 view .LVU73
+	movb	$0, mahonyAligned(%rip)
+	.loc 1 139 1 view .LVU74
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	imuInit, .-imuInit
+	.section	.text.calculateThrottleAngleScale,"ax",@progbits
+	.p2align 4
+	.globl	calculateThrottleAngleScale
+	.type	calculateThrottleAngleScale, @function
+calculateThrottleAngleScale:
+.LVL12:
+.LFB3:
+	.loc 1 142 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 143 5 view .LVU76
+	.loc 1 143 52 is_stmt 0 view .LVU77
+	movzwl	%di, %edi
+	.loc 1 143 52 view .LVU78
+	pxor	%xmm1, %xmm1
+	movss	.LC7(%rip), %xmm0
+	cvtsi2ssl	%edi, %xmm1
+	divss	%xmm1, %xmm0
+	cvtss2sd	%xmm0, %xmm0
+	.loc 1 143 42 view .LVU79
+	mulsd	.LC8(%rip), %xmm0
+	cvtsd2ss	%xmm0, %xmm0
+	movss	%xmm0, throttleAngleScale(%rip)
+	.loc 1 144 1 view .LVU80
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	calculateThrottleAngleScale, .-calculateThrottleAngleScale
+	.section	.text.calculateAccZLowPassFilterRCTimeConstant,"ax",@progbits
+	.p2align 4
+	.globl	calculateAccZLowPassFilterRCTimeConstant
+	.type	calculateAccZLowPassFilterRCTimeConstant, @function
+calculateAccZLowPassFilterRCTimeConstant:
+.LVL13:
+.LFB4:
+	.loc 1 147 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 148 5 view .LVU82
+	.loc 1 148 26 is_stmt 0 view .LVU83
+	cvtss2sd	%xmm0, %xmm0
+.LVL14:
+	.loc 1 148 26 view .LVU84
+	mulsd	.LC1(%rip), %xmm0
+	.loc 1 148 19 view .LVU85
+	movsd	.LC9(%rip), %xmm1
+	divsd	%xmm0, %xmm1
+	cvtsd2ss	%xmm1, %xmm1
+	movss	%xmm1, fc_acc(%rip)
+	.loc 1 149 1 view .LVU86
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	calculateAccZLowPassFilterRCTimeConstant, .-calculateAccZLowPassFilterRCTimeConstant
+	.section	.text.normalizeV,"ax",@progbits
+	.p2align 4
+	.globl	normalizeV
+	.type	normalizeV, @function
+normalizeV:
+.LVL15:
+.LFB6:
+	.loc 1 194 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 195 5 view .LVU88
+	.loc 1 194 1 is_stmt 0 view .LVU89
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 195 30 view .LVU90
+	movss	(%rdi), %xmm0
+	.loc 1 195 48 view .LVU91
+	movss	4(%rdi), %xmm2
+	.loc 1 195 66 view .LVU92
+	movss	8(%rdi), %xmm1
+	.loc 1 195 34 view .LVU93
+	mulss	%xmm0, %xmm0
+	.loc 1 195 52 view .LVU94
+	mulss	%xmm2, %xmm2
+	.loc 1 195 70 view .LVU95
+	mulss	%xmm1, %xmm1
+	.loc 1 195 43 view .LVU96
+	addss	%xmm2, %xmm0
+	.loc 1 195 11 view .LVU97
+	addss	%xmm1, %xmm0
+.LVL16:
+	.loc 1 197 5 is_stmt 1 view .LVU98
+	.loc 1 197 8 is_stmt 0 view .LVU99
+	pxor	%xmm1, %xmm1
+	ucomiss	%xmm1, %xmm0
+	jp	.L13
+	jne	.L13
+	.loc 1 203 1 view .LVU100
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+.LBB6:
+	.loc 1 198 9 is_stmt 1 view .LVU101
+	.loc 1 198 27 is_stmt 0 view .LVU102
+	call	invSqrt_approx@PLT
+.LVL18:
+	.loc 1 199 9 is_stmt 1 view .LVU103
+	.loc 1 200 9 view .LVU104
+	.loc 1 199 22 is_stmt 0 view .LVU105
+	movq	(%rbx), %xmm1
+	.loc 1 199 26 view .LVU106
+	movaps	%xmm0, %xmm2
+	shufps	$0xe0, %xmm2, %xmm2
+	mulps	%xmm2, %xmm1
+	.loc 1 199 17 view .LVU107
+	movlps	%xmm1, 0(%rbp)
+	.loc 1 201 9 is_stmt 1 view .LVU108
+	.loc 1 201 26 is_stmt 0 view .LVU109
+	mulss	8(%rbx), %xmm0
+.LVL19:
+	.loc 1 201 17 view .LVU110
+	movss	%xmm0, 8(%rbp)
+.LBE6:
+	.loc 1 203 1 view .LVU111
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL20:
+	.loc 1 203 1 view .LVU112
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL21:
+	.loc 1 203 1 view .LVU113
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	normalizeV, .-normalizeV
+	.section	.text.rotateV,"ax",@progbits
+	.p2align 4
+	.globl	rotateV
+	.type	rotateV, @function
+rotateV:
+.LVL22:
+.LFB7:
+	.loc 1 207 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 208 5 view .LVU115
+	.loc 1 207 1 is_stmt 0 view .LVU116
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LVL23:
+	.loc 1 207 1 view .LVU117
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 208 22 view .LVU118
+	movq	(%rdi), %xmm3
+	.loc 1 215 12 view .LVU119
+	movss	(%rsi), %xmm0
+	.loc 1 208 22 view .LVU120
+	movaps	%xmm3, %xmm5
+	movaps	%xmm3, %xmm15
+	movlps	%xmm3, 56(%rsp)
+	shufps	$0xe0, %xmm5, %xmm5
+	movlps	%xmm5, 8(%rsp)
+	movss	8(%rdi), %xmm5
+	shufps	$0xe5, %xmm15, %xmm15
+	movlps	%xmm15, 48(%rsp)
+.LVL24:
+	.loc 1 211 5 is_stmt 1 view .LVU121
+	.loc 1 212 5 view .LVU122
+	.loc 1 213 5 view .LVU123
+	.loc 1 215 5 view .LVU124
+	movaps	%xmm5, %xmm4
+	movss	%xmm5, 44(%rsp)
+.LVL25:
+	.loc 1 215 5 is_stmt 0 view .LVU125
+	shufps	$0xe0, %xmm4, %xmm4
+	movlps	%xmm4, 16(%rsp)
+	.loc 1 215 12 view .LVU126
+	call	cos_approx@PLT
+.LVL26:
+	.loc 1 215 12 view .LVU127
+	movss	%xmm0, 40(%rsp)
+.LVL27:
+	.loc 1 216 5 is_stmt 1 view .LVU128
+	.loc 1 216 12 is_stmt 0 view .LVU129
+	movss	0(%rbp), %xmm0
+.LVL28:
+	.loc 1 216 12 view .LVU130
+	call	sin_approx@PLT
+.LVL29:
+	movss	%xmm0, 36(%rsp)
+.LVL30:
+	.loc 1 217 5 is_stmt 1 view .LVU131
+	.loc 1 217 12 is_stmt 0 view .LVU132
+	movss	4(%rbp), %xmm0
+.LVL31:
+	.loc 1 217 12 view .LVU133
+	call	cos_approx@PLT
+.LVL32:
+	movss	%xmm0, 32(%rsp)
+.LVL33:
+	.loc 1 218 5 is_stmt 1 view .LVU134
+	.loc 1 218 12 is_stmt 0 view .LVU135
+	movss	4(%rbp), %xmm0
+.LVL34:
+	.loc 1 218 12 view .LVU136
+	call	sin_approx@PLT
+.LVL35:
+	movss	%xmm0, 28(%rsp)
+.LVL36:
+	.loc 1 219 5 is_stmt 1 view .LVU137
+	.loc 1 219 12 is_stmt 0 view .LVU138
+	movss	8(%rbp), %xmm0
+.LVL37:
+	.loc 1 219 12 view .LVU139
+	call	cos_approx@PLT
+.LVL38:
+	movss	%xmm0, 24(%rsp)
+.LVL39:
+	.loc 1 220 5 is_stmt 1 view .LVU140
+	.loc 1 220 12 is_stmt 0 view .LVU141
+	movss	8(%rbp), %xmm0
+.LVL40:
+	.loc 1 220 12 view .LVU142
+	call	sin_approx@PLT
+.LVL41:
+	.loc 1 224 14 view .LVU143
+	movss	36(%rsp), %xmm1
+	.loc 1 222 14 view .LVU144
+	movss	24(%rsp), %xmm7
+	movss	40(%rsp), %xmm2
+	.loc 1 230 38 view .LVU145
+	movss	28(%rsp), %xmm6
+	.loc 1 220 12 view .LVU146
+	movaps	%xmm0, %xmm11
+.LVL42:
+	.loc 1 222 5 is_stmt 1 view .LVU147
+	.loc 1 224 14 is_stmt 0 view .LVU148
+	movaps	%xmm1, %xmm10
+	.loc 1 225 14 view .LVU149
+	movaps	%xmm1, %xmm8
+	.loc 1 227 22 view .LVU150
+	movss	32(%rsp), %xmm4
+	.loc 1 237 42 view .LVU151
+	movq	48(%rsp), %xmm15
+	.loc 1 224 14 view .LVU152
+	mulss	%xmm7, %xmm10
+	.loc 1 222 14 view .LVU153
+	movaps	%xmm2, %xmm13
+	.loc 1 223 14 view .LVU154
+	movaps	%xmm2, %xmm9
+	.loc 1 237 20 view .LVU155
+	movq	8(%rsp), %xmm3
+	.loc 1 225 14 view .LVU156
+	mulss	%xmm0, %xmm8
+	.loc 1 231 38 view .LVU157
+	movaps	%xmm6, %xmm12
+	.loc 1 237 64 view .LVU158
+	movq	16(%rsp), %xmm5
+	.loc 1 222 14 view .LVU159
+	mulss	%xmm7, %xmm13
+.LVL43:
+	.loc 1 223 5 is_stmt 1 view .LVU160
+	.loc 1 223 14 is_stmt 0 view .LVU161
+	mulss	%xmm0, %xmm9
+.LVL44:
+	.loc 1 224 5 is_stmt 1 view .LVU162
+	.loc 1 225 5 view .LVU163
+	.loc 1 227 5 view .LVU164
+	.loc 1 228 5 view .LVU165
+	.loc 1 229 5 view .LVU166
+	.loc 1 230 5 view .LVU167
+	.loc 1 231 5 view .LVU168
+	.loc 1 232 5 view .LVU169
+	.loc 1 233 5 view .LVU170
+	.loc 1 234 5 view .LVU171
+	.loc 1 235 5 view .LVU172
+	.loc 1 237 5 view .LVU173
+	.loc 1 238 5 view .LVU174
+	.loc 1 230 38 is_stmt 0 view .LVU175
+	movaps	%xmm6, %xmm0
+.LVL45:
+	.loc 1 227 22 view .LVU176
+	mulss	%xmm4, %xmm7
+.LVL46:
+	.loc 1 230 38 view .LVU177
+	mulss	%xmm10, %xmm0
+	.loc 1 231 38 view .LVU178
+	mulss	%xmm8, %xmm12
+	.loc 1 235 22 view .LVU179
+	mulss	%xmm4, %xmm2
+	.loc 1 231 26 view .LVU180
+	movaps	%xmm13, %xmm14
+	.loc 1 230 26 view .LVU181
+	addss	%xmm9, %xmm0
+.LVL47:
+	.loc 1 234 40 view .LVU182
+	mulss	%xmm6, %xmm9
+.LVL48:
+	.loc 1 231 26 view .LVU183
+	subss	%xmm12, %xmm14
+.LVL49:
+	.loc 1 228 17 view .LVU184
+	movss	.LC11(%rip), %xmm12
+	.loc 1 232 17 view .LVU185
+	xorps	%xmm12, %xmm1
+.LVL50:
+	.loc 1 232 23 view .LVU186
+	mulss	%xmm4, %xmm1
+	.loc 1 237 42 view .LVU187
+	unpcklps	%xmm14, %xmm0
+.LVL51:
+	.loc 1 237 42 view .LVU188
+	mulps	%xmm15, %xmm0
+	.loc 1 228 17 view .LVU189
+	movaps	%xmm4, %xmm15
+	.loc 1 234 28 view .LVU190
+	addss	%xmm10, %xmm9
+.LVL52:
+	.loc 1 228 17 view .LVU191
+	xorps	%xmm12, %xmm15
+	.loc 1 228 23 view .LVU192
+	mulss	%xmm11, %xmm15
+	.loc 1 237 20 view .LVU193
+	unpcklps	%xmm15, %xmm7
+.LVL53:
+	.loc 1 237 20 view .LVU194
+	mulps	%xmm3, %xmm7
+	.loc 1 239 42 view .LVU195
+	movq	56(%rsp), %xmm3
+	.loc 1 237 32 view .LVU196
+	addps	%xmm7, %xmm0
+	.loc 1 233 40 view .LVU197
+	movaps	%xmm13, %xmm7
+	mulss	%xmm6, %xmm7
+	.loc 1 233 28 view .LVU198
+	subss	%xmm7, %xmm8
+.LVL54:
+	.loc 1 237 64 view .LVU199
+	unpcklps	%xmm9, %xmm8
+.LVL55:
+	.loc 1 237 64 view .LVU200
+	mulps	%xmm5, %xmm8
+	.loc 1 239 42 view .LVU201
+	movaps	%xmm3, %xmm5
+	shufps	$0xe5, %xmm5, %xmm5
+	.loc 1 239 20 view .LVU202
+	mulss	%xmm6, %xmm3
+	.loc 1 239 42 view .LVU203
+	mulss	%xmm5, %xmm1
+	.loc 1 239 64 view .LVU204
+	movss	44(%rsp), %xmm5
+	mulss	%xmm5, %xmm2
+	.loc 1 237 54 view .LVU205
+	addps	%xmm8, %xmm0
+	.loc 1 239 32 view .LVU206
+	addss	%xmm3, %xmm1
+	.loc 1 237 10 view .LVU207
+	movlps	%xmm0, (%rbx)
+	.loc 1 239 5 is_stmt 1 view .LVU208
+	.loc 1 239 54 is_stmt 0 view .LVU209
+	addss	%xmm2, %xmm1
+	.loc 1 239 10 view .LVU210
+	movss	%xmm1, 8(%rbx)
+.LVL56:
+	.loc 1 240 1 view .LVU211
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL57:
+	.loc 1 240 1 view .LVU212
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL58:
+	.loc 1 240 1 view .LVU213
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	rotateV, .-rotateV
+	.section	.text.accSum_reset,"ax",@progbits
+	.p2align 4
+	.globl	accSum_reset
+	.type	accSum_reset, @function
+accSum_reset:
+.LFB8:
+	.loc 1 243 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 244 5 view .LVU215
+	.loc 1 245 5 view .LVU216
+	.loc 1 244 15 is_stmt 0 view .LVU217
+	movq	$0, accSum(%rip)
+	.loc 1 246 5 is_stmt 1 view .LVU218
+	.loc 1 246 15 is_stmt 0 view .LVU219
+	movl	$0, 8+accSum(%rip)
+	.loc 1 247 5 is_stmt 1 view .LVU220
+	.loc 1 247 17 is_stmt 0 view .LVU221
+	movl	$0, accSumCount(%rip)
+	.loc 1 248 5 is_stmt 1 view .LVU222
+	.loc 1 248 16 is_stmt 0 view .LVU223
+	movl	$0, accTimeSum(%rip)
+	.loc 1 249 1 view .LVU224
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	accSum_reset, .-accSum_reset
+	.section	.text.acc_calc,"ax",@progbits
+	.p2align 4
+	.globl	acc_calc
+	.type	acc_calc, @function
+acc_calc:
+.LVL59:
+.LFB11:
+	.loc 1 289 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 290 5 view .LVU226
+	.loc 1 291 5 view .LVU227
+	.loc 1 292 5 view .LVU228
+	.loc 1 293 5 view .LVU229
+	.loc 1 296 5 view .LVU230
+	.loc 1 289 1 is_stmt 0 view .LVU231
+	movl	%edi, %eax
+	.loc 1 296 10 view .LVU232
+	pxor	%xmm1, %xmm1
+	.loc 1 289 1 view .LVU233
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 299 32 view .LVU234
+	pxor	%xmm0, %xmm0
+	.loc 1 296 10 view .LVU235
+	cvtsi2ssq	%rax, %xmm1
+	.loc 1 289 1 view .LVU236
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	.loc 1 299 60 view .LVU237
+	pxor	%xmm3, %xmm3
+	.loc 1 299 88 view .LVU238
+	pxor	%xmm2, %xmm2
+	.loc 1 289 1 view .LVU239
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 289 1 view .LVU240
+	movq	%rax, %rbx
+	.loc 1 299 32 view .LVU241
+	movswl	accSmooth(%rip), %eax
+	movss	rMat(%rip), %xmm4
+	.loc 1 299 60 view .LVU242
+	movss	4+rMat(%rip), %xmm5
+	.loc 1 299 32 view .LVU243
+	cvtsi2ssl	%eax, %xmm0
+	.loc 1 299 60 view .LVU244
+	movswl	2+accSmooth(%rip), %eax
+	.loc 1 300 60 view .LVU245
+	movss	16+rMat(%rip), %xmm6
+	.loc 1 296 8 view .LVU246
+	mulss	.LC12(%rip), %xmm1
+.LVL60:
+	.loc 1 299 5 is_stmt 1 view .LVU247
+	.loc 1 299 60 is_stmt 0 view .LVU248
+	cvtsi2ssl	%eax, %xmm3
+	.loc 1 299 88 view .LVU249
+	movswl	4+accSmooth(%rip), %eax
+	.loc 1 299 32 view .LVU250
+	mulss	%xmm0, %xmm4
+	.loc 1 299 88 view .LVU251
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 303 25 view .LVU252
+	movq	imuRuntimeConfig(%rip), %rax
+	.loc 1 299 60 view .LVU253
+	mulss	%xmm3, %xmm5
+	.loc 1 303 8 view .LVU254
+	cmpb	$1, 1(%rax)
+	.loc 1 300 60 view .LVU255
+	mulss	%xmm3, %xmm6
+	.loc 1 301 60 view .LVU256
+	mulss	28+rMat(%rip), %xmm3
+	.loc 1 299 47 view .LVU257
+	addss	%xmm5, %xmm4
+	.loc 1 299 88 view .LVU258
+	movss	8+rMat(%rip), %xmm5
+	mulss	%xmm2, %xmm5
+	.loc 1 299 75 view .LVU259
+	addss	%xmm4, %xmm5
+.LVL61:
+	.loc 1 300 5 is_stmt 1 view .LVU260
+	.loc 1 300 32 is_stmt 0 view .LVU261
+	movss	12+rMat(%rip), %xmm4
+	mulss	%xmm0, %xmm4
+	.loc 1 301 32 view .LVU262
+	mulss	24+rMat(%rip), %xmm0
+	.loc 1 300 47 view .LVU263
+	addss	%xmm6, %xmm4
+	.loc 1 300 88 view .LVU264
+	movss	20+rMat(%rip), %xmm6
+	.loc 1 301 47 view .LVU265
+	addss	%xmm3, %xmm0
+	.loc 1 300 88 view .LVU266
+	mulss	%xmm2, %xmm6
+	.loc 1 301 88 view .LVU267
+	mulss	32+rMat(%rip), %xmm2
+	.loc 1 300 75 view .LVU268
+	addss	%xmm6, %xmm4
+	.loc 1 301 75 view .LVU269
+	addss	%xmm2, %xmm0
+	.loc 1 300 75 view .LVU270
+	movd	%xmm4, %r14d
+.LVL62:
+	.loc 1 301 5 is_stmt 1 view .LVU271
+	.loc 1 303 5 view .LVU272
+	.loc 1 303 8 is_stmt 0 view .LVU273
+	je	.L25
+	.loc 1 310 9 is_stmt 1 view .LVU274
+	.loc 1 310 23 is_stmt 0 view .LVU275
+	movzwl	acc_1G(%rip), %eax
+	pxor	%xmm2, %xmm2
+	cvtsi2ssl	%eax, %xmm2
+	subss	%xmm2, %xmm0
+.LVL63:
+.L23:
+	.loc 1 312 5 is_stmt 1 view .LVU276
+	.loc 1 312 47 is_stmt 0 view .LVU277
+	movss	fc_acc(%rip), %xmm3
+	.loc 1 312 71 view .LVU278
+	movss	accz_smooth.0(%rip), %xmm2
+	.loc 1 315 66 view .LVU279
+	movq	accDeadband(%rip), %rax
+	.loc 1 312 47 view .LVU280
+	addss	%xmm1, %xmm3
+	.loc 1 312 71 view .LVU281
+	subss	%xmm2, %xmm0
+.LVL64:
+	.loc 1 315 18 view .LVU282
+	movzbl	(%rax), %ebp
+	.loc 1 312 37 view .LVU283
+	divss	%xmm3, %xmm1
+.LVL65:
+	.loc 1 312 54 view .LVU284
+	mulss	%xmm0, %xmm1
+	.loc 1 315 32 view .LVU285
+	movaps	%xmm5, %xmm0
+	.loc 1 312 31 view .LVU286
+	addss	%xmm2, %xmm1
+	.loc 1 312 17 view .LVU287
+	movss	%xmm1, accz_smooth.0(%rip)
+	.loc 1 315 5 is_stmt 1 view .LVU288
+	.loc 1 315 32 is_stmt 0 view .LVU289
+	call	lrintf@PLT
+.LVL66:
+	.loc 1 315 18 view .LVU290
+	movl	%ebp, %esi
+	movl	%eax, %edi
+	call	applyDeadband@PLT
+.LVL67:
+	.loc 1 315 15 view .LVU291
+	addl	%eax, accSum(%rip)
+	.loc 1 316 5 is_stmt 1 view .LVU292
+	.loc 1 316 32 is_stmt 0 view .LVU293
+	movd	%r14d, %xmm0
+	.loc 1 316 66 view .LVU294
+	movq	accDeadband(%rip), %rax
+	.loc 1 316 18 view .LVU295
+	movzbl	(%rax), %ebp
+	.loc 1 316 32 view .LVU296
+	call	lrintf@PLT
+.LVL68:
+	.loc 1 316 18 view .LVU297
+	movl	%eax, %edi
+	movl	%ebp, %esi
+	call	applyDeadband@PLT
+.LVL69:
+	.loc 1 316 15 view .LVU298
+	addl	%eax, 4+accSum(%rip)
+	.loc 1 317 5 is_stmt 1 view .LVU299
+	.loc 1 317 64 is_stmt 0 view .LVU300
+	movq	accDeadband(%rip), %rax
+	.loc 1 317 32 view .LVU301
+	movss	accz_smooth.0(%rip), %xmm0
+	.loc 1 317 18 view .LVU302
+	movzbl	1(%rax), %ebp
+	.loc 1 317 32 view .LVU303
+	call	lrintf@PLT
+.LVL70:
+	.loc 1 317 18 view .LVU304
+	movl	%eax, %edi
+	movl	%ebp, %esi
+	call	applyDeadband@PLT
+.LVL71:
+	.loc 1 320 16 view .LVU305
+	addl	%ebx, accTimeSum(%rip)
+	.loc 1 322 1 view .LVU306
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL72:
+	.loc 1 317 15 view .LVU307
+	addl	%eax, 8+accSum(%rip)
+	.loc 1 320 5 is_stmt 1 view .LVU308
+	.loc 1 321 5 view .LVU309
+	.loc 1 322 1 is_stmt 0 view .LVU310
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	.loc 1 321 16 view .LVU311
+	addl	$1, accSumCount(%rip)
+	.loc 1 322 1 view .LVU312
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL73:
+	.loc 1 322 1 view .LVU313
+	ret
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.cfi_restore_state
+	.loc 1 304 9 is_stmt 1 view .LVU314
+	.loc 1 305 38 is_stmt 0 view .LVU315
+	movl	accZoffset.1(%rip), %eax
+	.loc 1 304 12 view .LVU316
+	testb	$4, armingFlags(%rip)
+	jne	.L22
+	.loc 1 305 13 is_stmt 1 view .LVU317
+	.loc 1 306 13 view .LVU318
+	.loc 1 305 38 is_stmt 0 view .LVU319
+	testl	%eax, %eax
+	leal	63(%rax), %edx
+	.loc 1 306 24 view .LVU320
+	pxor	%xmm2, %xmm2
+	.loc 1 305 38 view .LVU321
+	cmovns	%eax, %edx
+	sarl	$6, %edx
+	.loc 1 305 24 view .LVU322
+	subl	%edx, %eax
+	.loc 1 306 24 view .LVU323
+	cvtsi2ssl	%eax, %xmm2
+	addss	%xmm0, %xmm2
+	cvttss2sil	%xmm2, %eax
+	movl	%eax, accZoffset.1(%rip)
+.L22:
+	.loc 1 308 9 is_stmt 1 view .LVU324
+	.loc 1 308 37 is_stmt 0 view .LVU325
+	testl	%eax, %eax
+	leal	63(%rax), %edx
+	.loc 1 308 23 view .LVU326
+	pxor	%xmm2, %xmm2
+	.loc 1 308 37 view .LVU327
+	cmovs	%edx, %eax
+	sarl	$6, %eax
+	.loc 1 308 23 view .LVU328
+	cvtsi2ssl	%eax, %xmm2
+	subss	%xmm2, %xmm0
+.LVL75:
+	.loc 1 308 23 view .LVU329
+	jmp	.L23
+	.cfi_endproc
+.LFE11:
+	.size	acc_calc, .-acc_calc
+	.section	.text.computeIMU,"ax",@progbits
+	.p2align 4
+	.globl	computeIMU
+	.type	computeIMU, @function
+computeIMU:
+.LVL76:
+.LFB5:
+	.loc 1 152 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 153 5 view .LVU331
+.LBB33:
+.LBI33:
+	.loc 1 114 13 view .LVU332
+.LBB34:
+	.loc 1 116 5 view .LVU333
+	.loc 1 118 5 view .LVU334
+.LBE34:
+.LBE33:
+	.loc 1 152 1 is_stmt 0 view .LVU335
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%esi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+.LBB36:
+.LBB35:
+	.loc 1 118 8 view .LVU336
+	cmpb	$0, imuFilterInitialised(%rip)
+	.loc 1 118 55 view .LVU337
+	movl	targetPidLooptime(%rip), %edx
+	.loc 1 118 8 view .LVU338
+	je	.L27
+	.loc 1 118 30 view .LVU339
+	cmpl	%edx, imuFilterSamplePeriod(%rip)
+	je	.L28
+.L27:
+	leaq	accFilter(%rip), %rbx
+	leaq	24(%rbx), %r12
+.LVL77:
+.L30:
+	.loc 1 123 9 is_stmt 1 view .LVU340
+	.loc 1 123 57 is_stmt 0 view .LVU341
+	movq	imuRuntimeConfig(%rip), %rax
+	.loc 1 123 9 view .LVU342
+	movq	%rbx, %rdi
+	.loc 1 122 25 view .LVU343
+	addq	$8, %rbx
+.LVL78:
+	.loc 1 123 9 view .LVU344
+	movzbl	(%rax), %esi
+	call	pt1FilterInit@PLT
+.LVL79:
+	.loc 1 122 34 is_stmt 1 view .LVU345
+	.loc 1 122 25 view .LVU346
+	.loc 1 125 5 is_stmt 0 view .LVU347
+	movl	targetPidLooptime(%rip), %edx
+	.loc 1 122 25 view .LVU348
+	cmpq	%rbx, %r12
+	jne	.L30
+	.loc 1 125 5 is_stmt 1 view .LVU349
+	movl	$23, %esi
+	leaq	triYawGyroFilter(%rip), %rdi
+	call	pt1FilterInit@PLT
+.LVL80:
+	.loc 1 127 5 view .LVU350
+	.loc 1 127 27 is_stmt 0 view .LVU351
+	movl	targetPidLooptime(%rip), %eax
+	.loc 1 128 26 view .LVU352
+	movb	$1, imuFilterInitialised(%rip)
+	.loc 1 127 27 view .LVU353
+	movl	%eax, imuFilterSamplePeriod(%rip)
+	.loc 1 128 5 is_stmt 1 view .LVU354
+.L28:
+.LBE35:
+.LBE36:
+	.loc 1 155 5 view .LVU355
+	call	gyroGetADC@PLT
+.LVL81:
+	.loc 1 156 5 view .LVU356
+	.loc 1 156 9 is_stmt 0 view .LVU357
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL82:
+	.loc 1 156 8 view .LVU358
+	testb	%al, %al
+	jne	.L75
+	.loc 1 160 9 is_stmt 1 view .LVU359
+	.loc 1 161 9 view .LVU360
+	.loc 1 160 19 is_stmt 0 view .LVU361
+	movl	$0, accADC(%rip)
+	.loc 1 162 9 is_stmt 1 view .LVU362
+	.loc 1 162 19 is_stmt 0 view .LVU363
+	xorl	%eax, %eax
+	movw	%ax, 4+accADC(%rip)
+.LVL83:
+.L48:
+	.loc 1 165 5 is_stmt 1 view .LVU364
+	.loc 1 166 5 view .LVU365
+	.loc 1 165 32 is_stmt 0 view .LVU366
+	movl	gyroADC(%rip), %eax
+	.loc 1 165 23 view .LVU367
+	movl	%eax, gyroData(%rip)
+	.loc 1 168 5 is_stmt 1 view .LVU368
+	.loc 1 169 76 is_stmt 0 view .LVU369
+	movswl	4+gyroADC(%rip), %eax
+	.loc 1 168 8 view .LVU370
+	cmpb	$1, %bpl
+	je	.L76
+.L62:
+	.loc 1 169 26 view .LVU371
+	movw	%ax, 4+gyroData(%rip)
+	.loc 1 173 1 view .LVU372
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L75:
+	.cfi_restore_state
+	.loc 1 157 9 is_stmt 1 view .LVU373
+	movq	%r13, %rdi
+.LBB37:
+.LBB38:
+	.loc 1 405 13 is_stmt 0 view .LVU374
+	xorl	%r14d, %r14d
+	.loc 1 420 29 view .LVU375
+	xorl	%r13d, %r13d
+.LVL85:
+	.loc 1 420 29 view .LVU376
+.LBE38:
+.LBE37:
+	.loc 1 157 9 view .LVU377
+	call	updateAccelerationReadings@PLT
+.LVL86:
+	.loc 1 158 9 is_stmt 1 view .LVU378
+.LBB96:
+.LBI37:
+	.loc 1 402 13 view .LVU379
+.LBB94:
+	.loc 1 404 5 view .LVU380
+	.loc 1 405 5 view .LVU381
+	.loc 1 406 5 view .LVU382
+	.loc 1 407 5 view .LVU383
+	.loc 1 408 5 view .LVU384
+	.loc 1 409 5 view .LVU385
+	leaq	16(%rsp), %rbx
+	leaq	accSmooth(%rip), %r15
+	.loc 1 409 25 is_stmt 0 view .LVU386
+	call	micros@PLT
+.LVL87:
+	.loc 1 410 5 is_stmt 1 view .LVU387
+	.loc 1 411 5 view .LVU388
+	.loc 1 412 5 view .LVU389
+	.loc 1 413 5 view .LVU390
+	.loc 1 414 20 is_stmt 0 view .LVU391
+	pxor	%xmm6, %xmm6
+	.loc 1 414 11 view .LVU392
+	movss	gyroScaleRad(%rip), %xmm1
+	.loc 1 420 29 view .LVU393
+	movq	imuRuntimeConfig(%rip), %rcx
+	.loc 1 413 12 view .LVU394
+	movl	%eax, %r12d
+	subl	previousT.4(%rip), %r12d
+.LVL88:
+	.loc 1 414 5 is_stmt 1 view .LVU395
+	.loc 1 415 15 is_stmt 0 view .LVU396
+	movl	%eax, previousT.4(%rip)
+	leaq	gyroADC(%rip), %rsi
+	.loc 1 414 20 view .LVU397
+	movl	%r12d, %edx
+	leaq	accADC(%rip), %r8
+	cvtsi2ssq	%rdx, %xmm6
+	.loc 1 414 11 view .LVU398
+	mulss	%xmm6, %xmm1
+.LVL89:
+	.loc 1 415 5 is_stmt 1 view .LVU399
+	.loc 1 418 5 view .LVU400
+	.loc 1 418 25 view .LVU401
+	.loc 1 414 20 is_stmt 0 view .LVU402
+	movss	%xmm6, 8(%rsp)
+.LVL90:
+.L36:
+	.loc 1 419 9 is_stmt 1 view .LVU403
+	.loc 1 419 50 is_stmt 0 view .LVU404
+	movswl	(%rsi,%r13), %eax
+	pxor	%xmm0, %xmm0
+	.loc 1 420 12 view .LVU405
+	cmpb	$0, (%rcx)
+	.loc 1 421 77 view .LVU406
+	movswl	(%r8,%r13), %edx
+	.loc 1 419 50 view .LVU407
+	cvtsi2ssl	%eax, %xmm0
+	mulss	%xmm1, %xmm0
+	.loc 1 419 34 view .LVU408
+	movss	%xmm0, (%rbx,%r13,2)
+	.loc 1 420 9 is_stmt 1 view .LVU409
+	.loc 1 420 12 is_stmt 0 view .LVU410
+	jne	.L77
+	.loc 1 423 13 is_stmt 1 view .LVU411
+	.loc 1 423 29 is_stmt 0 view .LVU412
+	movw	%dx, (%r15,%r13)
+.L35:
+	.loc 1 425 9 is_stmt 1 view .LVU413
+	.loc 1 425 44 is_stmt 0 view .LVU414
+	imull	%edx, %edx
+	.loc 1 418 25 view .LVU415
+	addq	$2, %r13
+.LVL91:
+	.loc 1 425 16 view .LVU416
+	addl	%edx, %r14d
+.LVL92:
+	.loc 1 418 34 is_stmt 1 view .LVU417
+	.loc 1 418 25 view .LVU418
+	cmpq	$6, %r13
+	jne	.L36
+	.loc 1 427 5 view .LVU419
+	.loc 1 427 30 is_stmt 0 view .LVU420
+	movzwl	acc_1G(%rip), %edi
+	.loc 1 427 21 view .LVU421
+	imull	$100, %r14d, %eax
+.LVL93:
+	.loc 1 429 5 is_stmt 1 view .LVU422
+	.loc 1 427 46 is_stmt 0 view .LVU423
+	imull	%edi, %edi
+.LVL94:
+	.loc 1 427 12 view .LVU424
+	cltd
+	idivl	%edi
+.LVL95:
+	.loc 1 429 8 view .LVU425
+	cmpb	$1, 12(%rcx)
+.LBB39:
+.LBB40:
+	.loc 1 370 40 view .LVU426
+	leal	-73(%rax), %r14d
+.LBE40:
+.LBE39:
+	.loc 1 429 8 view .LVU427
+	je	.L78
+	.loc 1 437 5 is_stmt 1 view .LVU428
+	leaq	EstG(%rip), %r13
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	rotateV
+.LVL96:
+	.loc 1 443 5 view .LVU429
+	.loc 1 445 5 view .LVU430
+	.loc 1 445 8 is_stmt 0 view .LVU431
+	cmpw	$59, %r14w
+	jbe	.L49
+.LVL97:
+.L53:
+	.loc 1 450 5 is_stmt 1 view .LVU432
+.LBB49:
+.LBI49:
+	.loc 1 346 13 view .LVU433
+.LBB50:
+	.loc 1 348 5 view .LVU434
+	.loc 1 348 19 is_stmt 0 view .LVU435
+	movswl	smallAngle(%rip), %edx
+	pxor	%xmm0, %xmm0
+.LBB51:
+.LBB52:
+	.loc 1 349 21 view .LVU436
+	movzbl	stateFlags(%rip), %eax
+.LBE52:
+.LBE51:
+	.loc 1 348 15 view .LVU437
+	movss	8+EstG(%rip), %xmm1
+	.loc 1 348 19 view .LVU438
+	cvtsi2ssl	%edx, %xmm0
+	.loc 1 351 21 view .LVU439
+	movl	%eax, %edx
+	orl	$8, %eax
+	andl	$-9, %edx
+	comiss	%xmm0, %xmm1
+.LBE50:
+.LBE49:
+	.loc 1 453 25 view .LVU440
+	movss	4+EstG(%rip), %xmm0
+.LBB54:
+.LBB53:
+	.loc 1 351 21 view .LVU441
+	cmovbe	%edx, %eax
+	movb	%al, stateFlags(%rip)
+.LBE53:
+.LBE54:
+	.loc 1 453 5 is_stmt 1 view .LVU442
+	.loc 1 453 25 is_stmt 0 view .LVU443
+	call	atan2_approx@PLT
+.LVL98:
+	.loc 1 454 62 view .LVU444
+	movss	4+EstG(%rip), %xmm1
+	.loc 1 453 23 view .LVU445
+	movss	%xmm0, anglerad(%rip)
+	.loc 1 454 5 is_stmt 1 view .LVU446
+	.loc 1 454 84 is_stmt 0 view .LVU447
+	movss	8+EstG(%rip), %xmm0
+	.loc 1 454 65 view .LVU448
+	mulss	%xmm1, %xmm1
+	.loc 1 454 87 view .LVU449
+	mulss	%xmm0, %xmm0
+	.loc 1 454 26 view .LVU450
+	addss	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	ucomiss	%xmm1, %xmm0
+	ja	.L79
+	sqrtss	%xmm1, %xmm1
+.L57:
+	movss	EstG(%rip), %xmm0
+	xorps	.LC11(%rip), %xmm0
+	call	atan2_approx@PLT
+.LVL99:
+.LBB55:
+.LBB56:
+	.loc 1 357 57 view .LVU451
+	movl	anglerad(%rip), %r14d
+.LVL100:
+	.loc 1 357 57 view .LVU452
+.LBE56:
+.LBE55:
+	.loc 1 454 26 view .LVU453
+	movd	%xmm0, %r13d
+	.loc 1 454 24 view .LVU454
+	movss	%xmm0, 4+anglerad(%rip)
+	.loc 1 455 5 is_stmt 1 view .LVU455
+.LBB59:
+.LBI55:
+	.loc 1 355 13 view .LVU456
+.LBB57:
+	.loc 1 357 5 view .LVU457
+	.loc 1 357 57 is_stmt 0 view .LVU458
+	pxor	%xmm0, %xmm0
+	movd	%r14d, %xmm7
+	cvtss2sd	%xmm7, %xmm0
+	.loc 1 357 67 view .LVU459
+	mulsd	.LC8(%rip), %xmm0
+	.loc 1 357 42 view .LVU460
+	cvtsd2ss	%xmm0, %xmm0
+	call	lrintf@PLT
+.LVL101:
+	.loc 1 358 58 view .LVU461
+	movd	%r13d, %xmm7
+	pxor	%xmm0, %xmm0
+	cvtss2sd	%xmm7, %xmm0
+	.loc 1 358 69 view .LVU462
+	mulsd	.LC8(%rip), %xmm0
+	.loc 1 357 40 view .LVU463
+	movw	%ax, inclination(%rip)
+	.loc 1 358 5 is_stmt 1 view .LVU464
+	.loc 1 358 43 is_stmt 0 view .LVU465
+	cvtsd2ss	%xmm0, %xmm0
+	call	lrintf@PLT
+.LVL102:
+.LBE57:
+.LBE59:
+.LBB60:
+.LBB61:
+	.loc 1 254 24 view .LVU466
+	movd	%r14d, %xmm0
+.LBE61:
+.LBE60:
+.LBB64:
+.LBB58:
+	.loc 1 358 41 view .LVU467
+	movw	%ax, 2+inclination(%rip)
+.LBE58:
+.LBE64:
+	.loc 1 457 5 is_stmt 1 view .LVU468
+.LVL103:
+.LBB65:
+.LBI60:
+	.loc 1 252 13 view .LVU469
+.LBB62:
+	.loc 1 254 5 view .LVU470
+	.loc 1 254 24 is_stmt 0 view .LVU471
+	call	cos_approx@PLT
+.LVL104:
+	.loc 1 254 24 view .LVU472
+	movss	%xmm0, 12(%rsp)
+.LVL105:
+	.loc 1 255 5 is_stmt 1 view .LVU473
+	.loc 1 255 22 is_stmt 0 view .LVU474
+	movd	%r14d, %xmm0
+.LVL106:
+	.loc 1 255 22 view .LVU475
+	call	sin_approx@PLT
+.LVL107:
+	movss	%xmm0, 8(%rsp)
+.LVL108:
+	.loc 1 256 5 is_stmt 1 view .LVU476
+	.loc 1 256 25 is_stmt 0 view .LVU477
+	movd	%r13d, %xmm0
+.LVL109:
+	.loc 1 256 25 view .LVU478
+	call	cos_approx@PLT
+.LVL110:
+	movss	%xmm0, 4(%rsp)
+.LVL111:
+	.loc 1 257 5 is_stmt 1 view .LVU479
+	.loc 1 257 23 is_stmt 0 view .LVU480
+	movd	%r13d, %xmm0
+.LVL112:
+	.loc 1 257 23 view .LVU481
+	call	sin_approx@PLT
+.LVL113:
+	.loc 1 259 5 is_stmt 1 view .LVU482
+	.loc 1 260 5 view .LVU483
+	.loc 1 260 28 is_stmt 0 view .LVU484
+	movss	8(%rsp), %xmm2
+	.loc 1 259 16 view .LVU485
+	movss	4(%rsp), %xmm3
+.LBE62:
+.LBE65:
+	.loc 1 459 9 view .LVU486
+	movl	$8, %edi
+.LBB66:
+.LBB63:
+	.loc 1 263 16 view .LVU487
+	movl	$0x00000000, 12+rMat(%rip)
+	.loc 1 261 28 view .LVU488
+	movss	12(%rsp), %xmm1
+	.loc 1 260 28 view .LVU489
+	movaps	%xmm2, %xmm5
+	.loc 1 259 16 view .LVU490
+	movaps	%xmm3, %xmm4
+	.loc 1 260 28 view .LVU491
+	mulss	%xmm0, %xmm5
+	.loc 1 264 16 view .LVU492
+	movss	%xmm1, 16+rMat(%rip)
+	.loc 1 259 16 view .LVU493
+	unpcklps	%xmm5, %xmm4
+	movlps	%xmm4, rMat(%rip)
+	.loc 1 261 5 is_stmt 1 view .LVU494
+	.loc 1 261 28 is_stmt 0 view .LVU495
+	movaps	%xmm1, %xmm4
+	mulss	%xmm0, %xmm4
+	.loc 1 267 18 view .LVU496
+	xorps	.LC11(%rip), %xmm0
+.LVL114:
+	.loc 1 269 30 view .LVU497
+	mulss	%xmm3, %xmm1
+	.loc 1 267 16 view .LVU498
+	movss	%xmm0, 24+rMat(%rip)
+	.loc 1 261 16 view .LVU499
+	movss	%xmm4, 8+rMat(%rip)
+	.loc 1 263 5 is_stmt 1 view .LVU500
+	.loc 1 264 5 view .LVU501
+	.loc 1 265 5 view .LVU502
+	.loc 1 265 18 is_stmt 0 view .LVU503
+	movaps	%xmm2, %xmm4
+	xorps	.LC11(%rip), %xmm4
+	.loc 1 268 30 view .LVU504
+	mulss	%xmm3, %xmm2
+	.loc 1 269 16 view .LVU505
+	movss	%xmm1, 32+rMat(%rip)
+	.loc 1 265 16 view .LVU506
+	movss	%xmm4, 20+rMat(%rip)
+	.loc 1 267 5 is_stmt 1 view .LVU507
+	.loc 1 268 5 view .LVU508
+	.loc 1 268 16 is_stmt 0 view .LVU509
+	movss	%xmm2, 28+rMat(%rip)
+	.loc 1 269 5 is_stmt 1 view .LVU510
+.LVL115:
+	.loc 1 269 5 is_stmt 0 view .LVU511
+.LBE63:
+.LBE66:
+	.loc 1 459 5 is_stmt 1 view .LVU512
+	.loc 1 459 9 is_stmt 0 view .LVU513
+	call	sensors@PLT
+.LVL116:
+.LBB67:
+	.loc 1 460 9 view .LVU514
+	movq	%rbx, %rsi
+.LBE67:
+	.loc 1 459 8 view .LVU515
+	testb	%al, %al
+	jne	.L80
+	.loc 1 468 9 is_stmt 1 view .LVU516
+	leaq	EstN.2(%rip), %rbx
+	movq	%rbx, %rdi
+	call	rotateV
+.LVL117:
+	.loc 1 469 9 view .LVU517
+	movq	%rbx, %rsi
+	movq	%rbx, %rdi
+	call	normalizeV
+.LVL118:
+	.loc 1 470 9 view .LVU518
+	.loc 1 470 19 is_stmt 0 view .LVU519
+	movss	8+EstN.2(%rip), %xmm2
+	movss	4+EstN.2(%rip), %xmm1
+	movss	EstN.2(%rip), %xmm0
+	call	calculateHeading.isra.0
+.LVL119:
+.L60:
+.LBB68:
+	.loc 1 466 17 view .LVU520
+	movw	%ax, heading(%rip)
+.LBE68:
+	.loc 1 473 5 is_stmt 1 view .LVU521
+	.loc 1 473 34 is_stmt 0 view .LVU522
+	pxor	%xmm1, %xmm1
+	cwtl
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 473 33 view .LVU523
+	xorps	.LC11(%rip), %xmm1
+	cvtss2sd	%xmm1, %xmm1
+	.loc 1 473 49 view .LVU524
+	mulsd	.LC3(%rip), %xmm1
+	.loc 1 473 5 view .LVU525
+	cvtsd2ss	%xmm1, %xmm1
+.LVL120:
+.LBB69:
+.LBI69:
+	.loc 1 273 13 is_stmt 1 view .LVU526
+.LBB70:
+	.loc 1 275 5 view .LVU527
+	.loc 1 275 23 is_stmt 0 view .LVU528
+	movaps	%xmm1, %xmm0
+	movss	%xmm1, 8(%rsp)
+	call	cos_approx@PLT
+.LVL121:
+	.loc 1 276 21 view .LVU529
+	movss	8(%rsp), %xmm1
+	.loc 1 275 23 view .LVU530
+	movss	%xmm0, 4(%rsp)
+.LVL122:
+	.loc 1 276 5 is_stmt 1 view .LVU531
+	.loc 1 276 21 is_stmt 0 view .LVU532
+	movaps	%xmm1, %xmm0
+.LVL123:
+	.loc 1 276 21 view .LVU533
+	call	sin_approx@PLT
+.LVL124:
+	.loc 1 277 5 is_stmt 1 view .LVU534
+	.loc 1 279 5 view .LVU535
+	.loc 1 279 25 view .LVU536
+	leaq	rMat(%rip), %rax
+	movss	4(%rsp), %xmm4
+	leaq	12(%rax), %rdx
+.LVL125:
+.L61:
+.LBB71:
+	.loc 1 280 9 view .LVU537
+	.loc 1 280 15 is_stmt 0 view .LVU538
+	movss	(%rax), %xmm1
+.LVL126:
+	.loc 1 281 9 is_stmt 1 view .LVU539
+	.loc 1 281 15 is_stmt 0 view .LVU540
+	movss	12(%rax), %xmm2
+.LVL127:
+	.loc 1 282 9 is_stmt 1 view .LVU541
+	.loc 1 282 35 is_stmt 0 view .LVU542
+	movaps	%xmm4, %xmm3
+	.loc 1 282 49 view .LVU543
+	movaps	%xmm0, %xmm5
+.LBE71:
+	.loc 1 279 25 view .LVU544
+	addq	$4, %rax
+.LVL128:
+.LBB72:
+	.loc 1 282 35 view .LVU545
+	mulss	%xmm1, %xmm3
+	.loc 1 282 49 view .LVU546
+	mulss	%xmm2, %xmm5
+	.loc 1 283 33 view .LVU547
+	mulss	%xmm0, %xmm1
+.LVL129:
+	.loc 1 283 49 view .LVU548
+	mulss	%xmm4, %xmm2
+.LVL130:
+	.loc 1 282 39 view .LVU549
+	subss	%xmm5, %xmm3
+	.loc 1 283 37 view .LVU550
+	addss	%xmm2, %xmm1
+	.loc 1 282 23 view .LVU551
+	movss	%xmm3, -4(%rax)
+.LVL131:
+	.loc 1 283 9 is_stmt 1 view .LVU552
+	.loc 1 283 23 is_stmt 0 view .LVU553
+	movss	%xmm1, 8(%rax)
+.LVL132:
+	.loc 1 283 23 view .LVU554
+.LBE72:
+	.loc 1 279 34 is_stmt 1 view .LVU555
+	.loc 1 279 25 view .LVU556
+	cmpq	%rax, %rdx
+	jne	.L61
+.LVL133:
+	.loc 1 279 25 is_stmt 0 view .LVU557
+.LBE70:
+.LBE69:
+	.loc 1 475 5 is_stmt 1 view .LVU558
+	movl	%r12d, %edi
+	call	acc_calc
+.LVL134:
+	jmp	.L48
+.LVL135:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.loc 1 421 31 is_stmt 0 view .LVU559
+	pxor	%xmm0, %xmm0
+	leaq	accFilter(%rip), %rax
+	movss	%xmm1, 4(%rsp)
+	.loc 1 421 13 is_stmt 1 view .LVU560
+	.loc 1 421 31 is_stmt 0 view .LVU561
+	cvtsi2ssl	%edx, %xmm0
+	leaq	(%rax,%r13,4), %rdi
+	call	pt1FilterApply@PLT
+.LVL136:
+	call	lrintf@PLT
+.LVL137:
+	.loc 1 429 25 view .LVU562
+	movq	imuRuntimeConfig(%rip), %rcx
+	movss	4(%rsp), %xmm1
+	leaq	accADC(%rip), %r8
+	.loc 1 421 29 view .LVU563
+	movw	%ax, (%r15,%r13)
+	movswl	%ax, %edx
+	leaq	gyroADC(%rip), %rsi
+	jmp	.L35
+.LVL138:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.loc 1 421 29 view .LVU564
+.LBE94:
+.LBE96:
+	.loc 1 169 9 is_stmt 1 view .LVU565
+	.loc 1 169 28 is_stmt 0 view .LVU566
+	pxor	%xmm0, %xmm0
+	leaq	triYawGyroFilter(%rip), %rdi
+	cvtsi2ssl	%eax, %xmm0
+	call	pt1FilterApply@PLT
+.LVL139:
+	call	lrintf@PLT
+.LVL140:
+	jmp	.L62
+.LVL141:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+.LBB97:
+.LBB95:
+.LBB73:
+	.loc 1 460 9 is_stmt 1 view .LVU567
+	leaq	EstM.3(%rip), %rbx
+	movq	%rbx, %rdi
+	call	rotateV
+.LVL142:
+	.loc 1 462 9 view .LVU568
+	.loc 1 462 78 is_stmt 0 view .LVU569
+	movq	imuRuntimeConfig(%rip), %rax
+	leaq	magADC(%rip), %rdx
+	.loc 1 462 98 view .LVU570
+	movss	.LC13(%rip), %xmm1
+	leaq	12(%rbx), %rsi
+	.loc 1 462 78 view .LVU571
+	movss	8(%rax), %xmm3
+	movq	%rbx, %rax
+	.loc 1 462 98 view .LVU572
+	movaps	%xmm3, %xmm0
+	addss	%xmm1, %xmm0
+	.loc 1 462 15 view .LVU573
+	divss	%xmm0, %xmm1
+.LVL143:
+	.loc 1 463 9 is_stmt 1 view .LVU574
+	.loc 1 463 29 view .LVU575
+.L59:
+	.loc 1 464 13 view .LVU576
+	.loc 1 464 42 is_stmt 0 view .LVU577
+	movss	(%rax), %xmm0
+	.loc 1 464 80 view .LVU578
+	movswl	(%rdx), %ecx
+	pxor	%xmm2, %xmm2
+	.loc 1 463 29 view .LVU579
+	addq	$4, %rax
+.LVL144:
+	.loc 1 463 29 view .LVU580
+	addq	$2, %rdx
+	.loc 1 464 42 view .LVU581
+	mulss	%xmm3, %xmm0
+	.loc 1 464 80 view .LVU582
+	cvtsi2ssl	%ecx, %xmm2
+	addss	%xmm2, %xmm0
+	.loc 1 464 96 view .LVU583
+	mulss	%xmm1, %xmm0
+	.loc 1 464 26 view .LVU584
+	movss	%xmm0, -4(%rax)
+	.loc 1 463 38 is_stmt 1 view .LVU585
+.LVL145:
+	.loc 1 463 29 view .LVU586
+	cmpq	%rsi, %rax
+	jne	.L59
+	.loc 1 466 9 view .LVU587
+	.loc 1 466 19 is_stmt 0 view .LVU588
+	movss	8+EstM.3(%rip), %xmm2
+	movss	4+EstM.3(%rip), %xmm1
+.LVL146:
+	.loc 1 466 19 view .LVU589
+	movss	EstM.3(%rip), %xmm0
+	call	calculateHeading.isra.0
+.LVL147:
+	.loc 1 466 19 view .LVU590
+.LBE73:
+	jmp	.L60
+.LVL148:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 443 71 view .LVU591
+	movq	imuRuntimeConfig(%rip), %rax
+	.loc 1 443 90 view .LVU592
+	movss	.LC13(%rip), %xmm1
+	leaq	accSmooth(%rip), %rdx
+	leaq	12(%r13), %rsi
+	.loc 1 443 71 view .LVU593
+	movss	4(%rax), %xmm3
+	movq	%r13, %rax
+	.loc 1 443 90 view .LVU594
+	movaps	%xmm3, %xmm0
+	addss	%xmm1, %xmm0
+	.loc 1 443 11 view .LVU595
+	divss	%xmm0, %xmm1
+.LVL149:
+.L52:
+	.loc 1 447 13 is_stmt 1 view .LVU596
+	.loc 1 447 42 is_stmt 0 view .LVU597
+	movss	(%rax), %xmm0
+	.loc 1 447 79 view .LVU598
+	movswl	(%rdx), %ecx
+	pxor	%xmm2, %xmm2
+	.loc 1 446 29 view .LVU599
+	addq	$4, %rax
+.LVL150:
+	.loc 1 446 29 view .LVU600
+	addq	$2, %rdx
+	.loc 1 447 42 view .LVU601
+	mulss	%xmm3, %xmm0
+	.loc 1 447 79 view .LVU602
+	cvtsi2ssl	%ecx, %xmm2
+	addss	%xmm2, %xmm0
+	.loc 1 447 98 view .LVU603
+	mulss	%xmm1, %xmm0
+	.loc 1 447 26 view .LVU604
+	movss	%xmm0, -4(%rax)
+	.loc 1 446 38 is_stmt 1 view .LVU605
+.LVL151:
+	.loc 1 446 29 view .LVU606
+	cmpq	%rax, %rsi
+	jne	.L52
+	jmp	.L53
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 430 9 view .LVU607
+.LBB74:
+.LBI39:
+	.loc 1 365 13 view .LVU608
+.LBB45:
+	.loc 1 367 5 view .LVU609
+	.loc 1 368 5 view .LVU610
+	.loc 1 369 5 view .LVU611
+	.loc 1 370 4 view .LVU612
+	.loc 1 371 4 view .LVU613
+	.loc 1 371 18 is_stmt 0 view .LVU614
+	movl	$8, %edi
+	call	sensors@PLT
+.LVL153:
+	.loc 1 371 18 view .LVU615
+	leaq	28(%rsp), %rdi
+	leaq	40(%rsp), %rdx
+	.loc 1 375 40 view .LVU616
+	movss	gyroScaleRadPerSecond(%rip), %xmm1
+	.loc 1 371 18 view .LVU617
+	movl	%eax, %r9d
+.LVL154:
+	.loc 1 372 5 is_stmt 1 view .LVU618
+	.loc 1 374 5 view .LVU619
+	.loc 1 374 25 view .LVU620
+	leaq	52(%rsp), %rcx
+	.loc 1 375 40 is_stmt 0 view .LVU621
+	xorl	%eax, %eax
+.LVL155:
+	.loc 1 375 40 view .LVU622
+	leaq	magADC(%rip), %r8
+	leaq	gyroADC(%rip), %rsi
+.LVL156:
+.L38:
+	.loc 1 375 9 is_stmt 1 view .LVU623
+	.loc 1 375 40 is_stmt 0 view .LVU624
+	movswl	(%rsi,%rax), %r10d
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%r10d, %xmm0
+	.loc 1 376 19 view .LVU625
+	movswl	(%r15,%rax), %r10d
+	.loc 1 375 40 view .LVU626
+	mulss	%xmm1, %xmm0
+	.loc 1 375 24 view .LVU627
+	movss	%xmm0, (%rdi,%rax,2)
+	.loc 1 376 9 is_stmt 1 view .LVU628
+	.loc 1 376 19 is_stmt 0 view .LVU629
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%r10d, %xmm0
+	.loc 1 377 19 view .LVU630
+	movswl	(%r8,%rax), %r10d
+	.loc 1 376 19 view .LVU631
+	movss	%xmm0, (%rdx,%rax,2)
+	.loc 1 377 9 is_stmt 1 view .LVU632
+	.loc 1 377 19 is_stmt 0 view .LVU633
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%r10d, %xmm0
+	movss	%xmm0, (%rcx,%rax,2)
+	.loc 1 374 34 is_stmt 1 view .LVU634
+.LVL157:
+	.loc 1 374 25 view .LVU635
+	addq	$2, %rax
+.LVL158:
+	.loc 1 374 25 is_stmt 0 view .LVU636
+	cmpq	$6, %rax
+	jne	.L38
+	.loc 1 380 5 is_stmt 1 view .LVU637
+	.loc 1 380 8 is_stmt 0 view .LVU638
+	cmpb	$0, mahonyAligned(%rip)
+	je	.L81
+	.loc 1 384 9 is_stmt 1 view .LVU639
+	xorl	%eax, %eax
+.LVL159:
+	.loc 1 384 9 is_stmt 0 view .LVU640
+	testb	%r9b, %r9b
+	cmove	%rax, %rcx
+	cmpw	$59, %r14w
+	cmova	%rax, %rdx
+.L42:
+	.loc 1 384 9 view .LVU641
+	movss	8(%rsp), %xmm0
+	.loc 1 384 98 view .LVU642
+	movq	imuRuntimeConfig(%rip), %rax
+	.loc 1 384 9 view .LVU643
+	leaq	mahonyEstimator(%rip), %rbx
+	movq	%rdi, %rsi
+	mulss	.LC12(%rip), %xmm0
+	movq	%rbx, %rdi
+	movss	20(%rax), %xmm2
+	movss	16(%rax), %xmm1
+	call	mahonyUpdate@PLT
+.LVL160:
+.L41:
+	.loc 1 388 5 is_stmt 1 view .LVU644
+	movl	60+mahonyEstimator(%rip), %eax
+	movdqu	28+mahonyEstimator(%rip), %xmm7
+	.loc 1 392 38 is_stmt 0 view .LVU645
+	pxor	%xmm0, %xmm0
+	.loc 1 395 25 view .LVU646
+	movq	%rbx, %rdi
+	.loc 1 388 5 view .LVU647
+	movl	%eax, 32+rMat(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU648
+.LVL161:
+	.loc 1 391 25 view .LVU649
+	.loc 1 392 38 is_stmt 0 view .LVU650
+	movzwl	acc_1G(%rip), %eax
+	.loc 1 388 5 view .LVU651
+	movaps	%xmm7, rMat(%rip)
+	movdqu	44+mahonyEstimator(%rip), %xmm7
+	.loc 1 392 38 view .LVU652
+	cvtsi2ssl	%eax, %xmm0
+	.loc 1 392 9 is_stmt 1 view .LVU653
+	.loc 1 391 34 view .LVU654
+.LVL162:
+	.loc 1 391 25 view .LVU655
+	.loc 1 392 9 view .LVU656
+	.loc 1 388 5 is_stmt 0 view .LVU657
+	movaps	%xmm7, 16+rMat(%rip)
+	.loc 1 392 38 view .LVU658
+	movq	24+rMat(%rip), %xmm2
+	movaps	%xmm0, %xmm1
+	shufps	$0xe0, %xmm1, %xmm1
+	mulss	32+rMat(%rip), %xmm0
+	mulps	%xmm2, %xmm1
+	.loc 1 392 22 view .LVU659
+	movss	%xmm0, 8+EstG(%rip)
+	movlps	%xmm1, EstG(%rip)
+	.loc 1 391 34 is_stmt 1 view .LVU660
+.LVL163:
+	.loc 1 391 25 view .LVU661
+	.loc 1 392 9 view .LVU662
+	.loc 1 391 34 view .LVU663
+	.loc 1 391 25 view .LVU664
+	.loc 1 395 5 view .LVU665
+	.loc 1 395 25 is_stmt 0 view .LVU666
+	call	mahonyGetRoll@PLT
+.LVL164:
+	.loc 1 396 26 view .LVU667
+	movq	%rbx, %rdi
+	.loc 1 395 23 view .LVU668
+	movss	%xmm0, anglerad(%rip)
+	.loc 1 396 5 is_stmt 1 view .LVU669
+	.loc 1 396 26 is_stmt 0 view .LVU670
+	call	mahonyGetPitch@PLT
+.LVL165:
+	.loc 1 399 35 view .LVU671
+	movq	%rbx, %rdi
+	.loc 1 396 24 view .LVU672
+	movss	%xmm0, 4+anglerad(%rip)
+	.loc 1 399 5 is_stmt 1 view .LVU673
+	.loc 1 399 35 is_stmt 0 view .LVU674
+	call	mahonyGetYaw@PLT
+.LVL166:
+.LBB41:
+.LBI41:
+	.loc 1 324 16 is_stmt 1 view .LVU675
+.LBB42:
+	.loc 1 326 5 view .LVU676
+	.loc 1 328 5 view .LVU677
+	.loc 1 329 5 view .LVU678
+	.loc 1 328 28 is_stmt 0 view .LVU679
+	mulss	.LC14(%rip), %xmm0
+.LVL167:
+	.loc 1 328 44 view .LVU680
+	pxor	%xmm1, %xmm1
+	cvtss2sd	magneticDeclination(%rip), %xmm1
+	.loc 1 328 28 view .LVU681
+	cvtss2sd	%xmm0, %xmm0
+.LVL168:
+	.loc 1 328 38 view .LVU682
+	divsd	.LC1(%rip), %xmm0
+.LVL169:
+	.loc 1 328 44 view .LVU683
+	addsd	%xmm1, %xmm0
+	.loc 1 328 67 view .LVU684
+	divsd	.LC2(%rip), %xmm0
+	.loc 1 328 11 view .LVU685
+	cvtsd2ss	%xmm0, %xmm0
+	.loc 1 329 12 view .LVU686
+	call	lrintf@PLT
+.LVL170:
+	.loc 1 330 5 is_stmt 1 view .LVU687
+.LBE42:
+.LBE41:
+.LBE45:
+.LBE74:
+.LBB75:
+.LBB76:
+	.loc 1 348 19 is_stmt 0 view .LVU688
+	pxor	%xmm0, %xmm0
+	.loc 1 351 21 view .LVU689
+	movss	8+EstG(%rip), %xmm1
+.LBE76:
+.LBE75:
+.LBB82:
+.LBB46:
+.LBB44:
+.LBB43:
+	.loc 1 331 14 view .LVU690
+	testw	%ax, %ax
+	leal	360(%rax), %edx
+	cmovs	%edx, %eax
+.LVL171:
+	.loc 1 333 5 is_stmt 1 view .LVU691
+	.loc 1 333 5 is_stmt 0 view .LVU692
+.LBE43:
+.LBE44:
+.LBE46:
+.LBE82:
+.LBB83:
+.LBB79:
+	.loc 1 348 19 view .LVU693
+	movswl	smallAngle(%rip), %edx
+	cvtsi2ssl	%edx, %xmm0
+.LBE79:
+.LBE83:
+.LBB84:
+.LBB47:
+	.loc 1 399 13 view .LVU694
+	movw	%ax, heading(%rip)
+.LVL172:
+	.loc 1 399 13 view .LVU695
+.LBE47:
+.LBE84:
+	.loc 1 431 9 is_stmt 1 view .LVU696
+.LBB85:
+.LBI75:
+	.loc 1 346 13 view .LVU697
+.LBB80:
+	.loc 1 348 5 view .LVU698
+.LBB77:
+.LBB78:
+	.loc 1 349 21 is_stmt 0 view .LVU699
+	movzbl	stateFlags(%rip), %eax
+.LBE78:
+.LBE77:
+	.loc 1 351 21 view .LVU700
+	movl	%eax, %edx
+	orl	$8, %eax
+	andl	$-9, %edx
+	comiss	%xmm0, %xmm1
+.LBE80:
+.LBE85:
+.LBB86:
+.LBB87:
+	.loc 1 357 57 view .LVU701
+	pxor	%xmm0, %xmm0
+	cvtss2sd	anglerad(%rip), %xmm0
+	.loc 1 357 67 view .LVU702
+	mulsd	.LC8(%rip), %xmm0
+.LBE87:
+.LBE86:
+.LBB90:
+.LBB81:
+	.loc 1 351 21 view .LVU703
+	cmovbe	%edx, %eax
+	movb	%al, stateFlags(%rip)
+.LBE81:
+.LBE90:
+	.loc 1 432 9 is_stmt 1 view .LVU704
+.LBB91:
+.LBI86:
+	.loc 1 355 13 view .LVU705
+.LBB88:
+	.loc 1 357 5 view .LVU706
+	.loc 1 357 42 is_stmt 0 view .LVU707
+	cvtsd2ss	%xmm0, %xmm0
+	call	lrintf@PLT
+.LVL173:
+	.loc 1 358 58 view .LVU708
+	pxor	%xmm0, %xmm0
+	cvtss2sd	4+anglerad(%rip), %xmm0
+	.loc 1 358 69 view .LVU709
+	mulsd	.LC8(%rip), %xmm0
+	.loc 1 357 40 view .LVU710
+	movw	%ax, inclination(%rip)
+	.loc 1 358 5 is_stmt 1 view .LVU711
+	.loc 1 358 43 is_stmt 0 view .LVU712
+	cvtsd2ss	%xmm0, %xmm0
+	call	lrintf@PLT
+.LVL174:
+.LBE88:
+.LBE91:
+	.loc 1 433 9 view .LVU713
+	movl	%r12d, %edi
+.LBB92:
+.LBB89:
+	.loc 1 358 41 view .LVU714
+	movw	%ax, 2+inclination(%rip)
+.LBE89:
+.LBE92:
+	.loc 1 433 9 is_stmt 1 view .LVU715
+	call	acc_calc
+.LVL175:
+	.loc 1 434 9 view .LVU716
+	jmp	.L48
+.LVL176:
+.L81:
+.LBB93:
+.LBB48:
+	.loc 1 380 24 is_stmt 0 view .LVU717
+	cmpw	$59, %r14w
+	jbe	.L82
+	.loc 1 384 9 is_stmt 1 view .LVU718
+	xorl	%eax, %eax
+.LVL177:
+	.loc 1 384 9 is_stmt 0 view .LVU719
+	testb	%r9b, %r9b
+	cmove	%rax, %rcx
+	xorl	%edx, %edx
+	jmp	.L42
+.LVL178:
+.L82:
+	.loc 1 381 9 is_stmt 1 view .LVU720
+	leaq	mahonyEstimator(%rip), %rbx
+	movq	%rdx, %rsi
+	movq	%rbx, %rdi
+	call	mahonyAlignToAccelerometer@PLT
+.LVL179:
+	.loc 1 382 9 view .LVU721
+	.loc 1 382 23 is_stmt 0 view .LVU722
+	movb	$1, mahonyAligned(%rip)
+	jmp	.L41
+.LVL180:
+.L79:
+	.loc 1 382 23 view .LVU723
+.LBE48:
+.LBE93:
+	.loc 1 454 26 view .LVU724
+	movaps	%xmm1, %xmm0
+	call	sqrtf@PLT
+.LVL181:
+	movaps	%xmm0, %xmm1
+	jmp	.L57
+.LBE95:
+.LBE97:
+	.cfi_endproc
+.LFE5:
+	.size	computeIMU, .-computeIMU
+	.section	.text.calculateThrottleAngleCorrection,"ax",@progbits
+	.p2align 4
+	.globl	calculateThrottleAngleCorrection
+	.type	calculateThrottleAngleCorrection, @function
+calculateThrottleAngleCorrection:
+.LVL182:
+.LFB18:
+	.loc 1 480 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 481 5 view .LVU726
+	.loc 1 480 1 is_stmt 0 view .LVU727
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edi, %ebx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 481 50 view .LVU728
+	movss	EstG(%rip), %xmm0
+	.loc 1 481 72 view .LVU729
+	movss	4+EstG(%rip), %xmm2
+	.loc 1 481 24 view .LVU730
+	movss	8+EstG(%rip), %xmm1
+	.loc 1 481 75 view .LVU731
+	mulss	%xmm2, %xmm2
+	.loc 1 481 53 view .LVU732
+	mulss	%xmm0, %xmm0
+	.loc 1 481 97 view .LVU733
+	movss	%xmm1, 12(%rsp)
+	.loc 1 481 64 view .LVU734
+	addss	%xmm2, %xmm0
+	.loc 1 481 97 view .LVU735
+	movaps	%xmm1, %xmm2
+	mulss	%xmm1, %xmm2
+	.loc 1 481 29 view .LVU736
+	addss	%xmm2, %xmm0
+	call	invSqrt_approx@PLT
+.LVL183:
+	.loc 1 481 11 view .LVU737
+	movss	12(%rsp), %xmm1
+	xorl	%eax, %eax
+	mulss	%xmm1, %xmm0
+.LVL184:
+	.loc 1 483 5 is_stmt 1 view .LVU738
+	.loc 1 483 8 is_stmt 0 view .LVU739
+	movss	.LC15(%rip), %xmm1
+	comiss	%xmm0, %xmm1
+	jnb	.L83
+	.loc 1 486 5 is_stmt 1 view .LVU740
+	.loc 1 486 24 is_stmt 0 view .LVU741
+	call	acos_approx@PLT
+.LVL185:
+	.loc 1 486 17 view .LVU742
+	mulss	throttleAngleScale(%rip), %xmm0
+	call	lrintf@PLT
+.LVL186:
+	.loc 1 487 5 is_stmt 1 view .LVU743
+	.loc 1 489 5 view .LVU744
+	.loc 1 489 12 is_stmt 0 view .LVU745
+	movzbl	%bl, %edi
+	pxor	%xmm3, %xmm3
+	.loc 1 489 64 view .LVU746
+	pxor	%xmm0, %xmm0
+	.loc 1 487 8 view .LVU747
+	movl	$900, %edx
+	.loc 1 489 12 view .LVU748
+	cvtsi2ssl	%edi, %xmm3
+	.loc 1 487 8 view .LVU749
+	cmpl	%edx, %eax
+	cmovg	%edx, %eax
+.LVL187:
+	.loc 1 489 12 view .LVU750
+	movss	%xmm3, 12(%rsp)
+	.loc 1 489 64 view .LVU751
+	cvtsi2sdl	%eax, %xmm0
+	divsd	.LC16(%rip), %xmm0
+	.loc 1 489 47 view .LVU752
+	cvtsd2ss	%xmm0, %xmm0
+	call	sin_approx@PLT
+.LVL188:
+	.loc 1 489 12 view .LVU753
+	mulss	12(%rsp), %xmm0
+	call	lrintf@PLT
+.LVL189:
+.L83:
+	.loc 1 490 1 view .LVU754
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	calculateThrottleAngleCorrection, .-calculateThrottleAngleCorrection
+	.section	.bss.accz_smooth.0,"aw",@nobits
+	.align 4
+	.type	accz_smooth.0, @object
+	.size	accz_smooth.0, 4
+accz_smooth.0:
+	.zero	4
+	.section	.bss.accZoffset.1,"aw",@nobits
+	.align 4
+	.type	accZoffset.1, @object
+	.size	accZoffset.1, 4
+accZoffset.1:
+	.zero	4
+	.section	.data.EstN.2,"aw"
+	.align 8
+	.type	EstN.2, @object
+	.size	EstN.2, 12
+EstN.2:
+	.long	1065353216
+	.long	0
+	.long	0
+	.section	.bss.EstM.3,"aw",@nobits
+	.align 8
+	.type	EstM.3, @object
+	.size	EstM.3, 12
+EstM.3:
+	.zero	12
+	.section	.bss.previousT.4,"aw",@nobits
+	.align 4
+	.type	previousT.4, @object
+	.size	previousT.4, 4
+previousT.4:
+	.zero	4
+	.comm	EstG,12,8
+	.section	.bss.imuFilterInitialised,"aw",@nobits
+	.type	imuFilterInitialised, @object
+	.size	imuFilterInitialised, 1
+imuFilterInitialised:
+	.zero	1
+	.section	.bss.imuFilterSamplePeriod,"aw",@nobits
+	.align 4
+	.type	imuFilterSamplePeriod, @object
+	.size	imuFilterSamplePeriod, 4
+imuFilterSamplePeriod:
+	.zero	4
+	.section	.bss.triYawGyroFilter,"aw",@nobits
+	.align 8
+	.type	triYawGyroFilter, @object
+	.size	triYawGyroFilter, 8
+triYawGyroFilter:
+	.zero	8
+	.section	.bss.accFilter,"aw",@nobits
+	.align 16
+	.type	accFilter, @object
+	.size	accFilter, 24
+accFilter:
+	.zero	24
+	.comm	accDeadband,8,8
+	.comm	pidProfile,8,8
+	.comm	imuRuntimeConfig,8,8
+	.globl	anglerad
+	.section	.bss.anglerad,"aw",@nobits
+	.align 8
+	.type	anglerad, @object
+	.size	anglerad, 8
+anglerad:
+	.zero	8
+	.globl	inclination
+	.section	.bss.inclination,"aw",@nobits
+	.align 2
+	.type	inclination, @object
+	.size	inclination, 4
+inclination:
+	.zero	4
+	.globl	gyroZero
+	.section	.bss.gyroZero,"aw",@nobits
+	.align 2
+	.type	gyroZero, @object
+	.size	gyroZero, 6
+gyroZero:
+	.zero	6
+	.globl	gyroData
+	.section	.bss.gyroData,"aw",@nobits
+	.align 4
+	.type	gyroData, @object
+	.size	gyroData, 6
+gyroData:
+	.zero	6
+	.section	.bss.mahonyAligned,"aw",@nobits
+	.type	mahonyAligned, @object
+	.size	mahonyAligned, 1
+mahonyAligned:
+	.zero	1
+	.section	.bss.mahonyEstimator,"aw",@nobits
+	.align 32
+	.type	mahonyEstimator, @object
+	.size	mahonyEstimator, 64
+mahonyEstimator:
+	.zero	64
+	.comm	rMat,36,32
+	.section	.bss.gyroScaleRadPerSecond,"aw",@nobits
+	.align 4
+	.type	gyroScaleRadPerSecond, @object
+	.size	gyroScaleRadPerSecond, 4
+gyroScaleRadPerSecond:
+	.zero	4
+	.comm	gyroScaleRad,4,4
+	.globl	magneticDeclination
+	.section	.bss.magneticDeclination,"aw",@nobits
+	.align 4
+	.type	magneticDeclination, @object
+	.size	magneticDeclination, 4
+magneticDeclination:
+	.zero	4
+	.globl	altHoldThrottleAdjustment
+	.section	.bss.altHoldThrottleAdjustment,"aw",@nobits
+	.align 4
+	.type	altHoldThrottleAdjustment, @object
+	.size	altHoldThrottleAdjustment, 4
+altHoldThrottleAdjustment:
+	.zero	4
+	.comm	fc_acc,4,4
+	.comm	throttleAngleScale,4,4
+	.globl	vario
+	.section	.bss.vario,"aw",@nobits
+	.align 4
+	.type	vario, @object
+	.size	vario, 4
+vario:
+	.zero	4
+	.globl	errorVelocityI
+	.section	.bss.errorVelocityI,"aw",@nobits
+	.align 4
+	.type	errorVelocityI, @object
+	.size	errorVelocityI, 4
+errorVelocityI:
+	.zero	4
+	.globl	velocityControl
+	.section	.bss.velocityControl,"aw",@nobits
+	.type	velocityControl, @object
+	.size	velocityControl, 1
+velocityControl:
+	.zero	1
+	.globl	setVelocity
+	.section	.bss.setVelocity,"aw",@nobits
+	.align 4
+	.type	setVelocity, @object
+	.size	setVelocity, 4
+setVelocity:
+	.zero	4
+	.comm	AltHold,4,4
+	.comm	EstAlt,4,4
+	.globl	smallAngle
+	.section	.bss.smallAngle,"aw",@nobits
+	.align 2
+	.type	smallAngle, @object
+	.size	smallAngle, 2
+smallAngle:
+	.zero	2
+	.comm	accVelScale,4,4
+	.globl	accSumCount
+	.section	.bss.accSumCount,"aw",@nobits
+	.align 4
+	.type	accSumCount, @object
+	.size	accSumCount, 4
+accSumCount:
+	.zero	4
+	.globl	accTimeSum
+	.section	.bss.accTimeSum,"aw",@nobits
+	.align 4
+	.type	accTimeSum, @object
+	.size	accTimeSum, 4
+accTimeSum:
+	.zero	4
+	.comm	accSum,12,8
+	.comm	accSmooth,6,2
+	.comm	accADC,6,2
+	.comm	gyroADC,6,2
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1155596288
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC1:
+	.long	1413754136
+	.long	1074340347
+	.align 8
+.LC2:
+	.long	0
+	.long	1076101120
+	.align 8
+.LC3:
+	.long	-1571644103
+	.long	1066524486
+	.section	.rodata.cst4
+	.align 4
+.LC4:
+	.long	1092413450
+	.align 4
+.LC5:
+	.long	1176256512
+	.section	.rodata.cst8
+	.align 8
+.LC6:
+	.long	-1610612736
+	.long	1051772663
+	.section	.rodata.cst4
+	.align 4
+.LC7:
+	.long	1147207680
+	.section	.rodata.cst8
+	.align 8
+.LC8:
+	.long	-1870767813
+	.long	1082255273
+	.align 8
+.LC9:
+	.long	0
+	.long	1071644672
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC11:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4
+	.align 4
+.LC12:
+	.long	897988541
+	.align 4
+.LC13:
+	.long	1065353216
+	.align 4
+.LC14:
+	.long	-991887360
+	.align 4
+.LC15:
+	.long	1014350479
+	.section	.rodata.cst8
+	.align 8
+.LC16:
+	.long	-451941470
+	.long	1083578077
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/common/filter.h"
+	.file 6 ".//src/main/common/axis.h"
+	.file 7 ".//src/main/flight/flight.h"
+	.file 8 ".//src/main/sensors/sensors.h"
+	.file 9 ".//src/main/drivers/accgyro.h"
+	.file 10 ".//src/main/sensors/gyro.h"
+	.file 11 ".//src/main/sensors/compass.h"
+	.file 12 ".//src/main/sensors/acceleration.h"
+	.file 13 ".//src/main/config/runtime_config.h"
+	.file 14 ".//src/main/flight/mahony.h"
+	.file 15 ".//src/main/flight/imu.h"
+	.file 16 ".//src/main/common/maths.h"
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 18 ".//src/main/flight/mixer.h"
+	.file 19 ".//src/main/drivers/system.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1b9d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x38
+	.long	.LASF1437
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL72
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1179
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1180
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1181
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1182
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1183
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1184
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x64
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1185
+	.uleb128 0x5
+	.long	.LASF1187
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF1188
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x83
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1189
+	.uleb128 0x5
+	.long	.LASF1190
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF1191
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1192
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1193
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1194
+	.uleb128 0x5
+	.long	.LASF1195
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1196
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1197
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x96
+	.uleb128 0x5
+	.long	.LASF1198
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF1199
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x2a
+	.long	0x2e
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x6
+	.byte	0x14
+	.long	0x128
+	.uleb128 0x24
+	.string	"X"
+	.byte	0
+	.uleb128 0x24
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x24
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0x5
+	.byte	0x14
+	.long	0x14d
+	.uleb128 0x6
+	.long	.LASF1201
+	.byte	0x5
+	.byte	0x15
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.string	"k"
+	.byte	0x5
+	.byte	0x16
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1202
+	.byte	0x5
+	.byte	0x17
+	.byte	0x3
+	.long	0x128
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x7
+	.byte	0x15
+	.long	0x1a7
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1206
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1207
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0xa
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1215
+	.byte	0x50
+	.byte	0x7
+	.byte	0x23
+	.long	0x226
+	.uleb128 0xb
+	.string	"P8"
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0x226
+	.byte	0
+	.uleb128 0xb
+	.string	"I8"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xd
+	.long	0x226
+	.byte	0xa
+	.uleb128 0xb
+	.string	"D8"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xd
+	.long	0x226
+	.byte	0x14
+	.uleb128 0xb
+	.string	"P_f"
+	.byte	0x7
+	.byte	0x28
+	.byte	0xb
+	.long	0x236
+	.byte	0x20
+	.uleb128 0xb
+	.string	"I_f"
+	.byte	0x7
+	.byte	0x29
+	.byte	0xb
+	.long	0x236
+	.byte	0x2c
+	.uleb128 0xb
+	.string	"D_f"
+	.byte	0x7
+	.byte	0x2a
+	.byte	0xb
+	.long	0x236
+	.byte	0x38
+	.uleb128 0x6
+	.long	.LASF1216
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xb
+	.long	0x2e
+	.byte	0x44
+	.uleb128 0x6
+	.long	.LASF1217
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xb
+	.long	0x2e
+	.byte	0x48
+	.uleb128 0x6
+	.long	.LASF1218
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe7
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x15
+	.long	0xe7
+	.long	0x236
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x9
+	.byte	0
+	.uleb128 0x15
+	.long	0x2e
+	.long	0x246
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1219
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x1a7
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x7
+	.byte	0x31
+	.long	0x26a
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x1
+	.byte	0
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x7
+	.byte	0x39
+	.long	0x288
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1225
+	.byte	0xc
+	.byte	0x7
+	.byte	0x41
+	.long	0x2b6
+	.uleb128 0xb
+	.string	"X"
+	.byte	0x7
+	.byte	0x42
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.string	"Y"
+	.byte	0x7
+	.byte	0x43
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0xb
+	.string	"Z"
+	.byte	0x7
+	.byte	0x44
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1226
+	.byte	0x7
+	.byte	0x45
+	.byte	0x3
+	.long	0x288
+	.uleb128 0x21
+	.byte	0xc
+	.byte	0x47
+	.long	0x2dc
+	.uleb128 0x1c
+	.string	"A"
+	.byte	0x48
+	.byte	0xb
+	.long	0x236
+	.uleb128 0x1c
+	.string	"V"
+	.byte	0x49
+	.byte	0x15
+	.long	0x2b6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1227
+	.byte	0x7
+	.byte	0x4a
+	.byte	0x3
+	.long	0x2c2
+	.uleb128 0x12
+	.long	.LASF1228
+	.byte	0xc
+	.byte	0x7
+	.byte	0x4c
+	.long	0x31c
+	.uleb128 0x6
+	.long	.LASF1229
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1230
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0xb
+	.string	"yaw"
+	.byte	0x7
+	.byte	0x4f
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1231
+	.byte	0x7
+	.byte	0x50
+	.byte	0x3
+	.long	0x2e8
+	.uleb128 0x21
+	.byte	0xc
+	.byte	0x52
+	.long	0x346
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x53
+	.byte	0xb
+	.long	0x236
+	.uleb128 0x25
+	.long	.LASF1232
+	.byte	0x54
+	.byte	0x13
+	.long	0x31c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1233
+	.byte	0x7
+	.byte	0x55
+	.byte	0x3
+	.long	0x328
+	.uleb128 0x15
+	.long	0xcf
+	.long	0x362
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1234
+	.byte	0x4
+	.byte	0x7
+	.byte	0x62
+	.long	0x389
+	.uleb128 0x6
+	.long	.LASF1229
+	.byte	0x7
+	.byte	0x63
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1230
+	.byte	0x7
+	.byte	0x64
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1235
+	.byte	0x7
+	.byte	0x65
+	.byte	0x3
+	.long	0x362
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x67
+	.long	0x3b3
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x68
+	.byte	0xd
+	.long	0x3b3
+	.uleb128 0x25
+	.long	.LASF1236
+	.byte	0x69
+	.byte	0x1d
+	.long	0x389
+	.byte	0
+	.uleb128 0x15
+	.long	0xcf
+	.long	0x3c3
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1237
+	.byte	0x7
+	.byte	0x6a
+	.byte	0x3
+	.long	0x395
+	.uleb128 0x12
+	.long	.LASF1238
+	.byte	0x4
+	.byte	0x7
+	.byte	0x6c
+	.long	0x3f6
+	.uleb128 0x6
+	.long	.LASF1239
+	.byte	0x7
+	.byte	0x6e
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1240
+	.byte	0x7
+	.byte	0x6f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1241
+	.byte	0x7
+	.byte	0x70
+	.byte	0x3
+	.long	0x3cf
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x72
+	.long	0x420
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x73
+	.byte	0xd
+	.long	0x3b3
+	.uleb128 0x25
+	.long	.LASF1236
+	.byte	0x74
+	.byte	0x23
+	.long	0x3f6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1242
+	.byte	0x7
+	.byte	0x75
+	.byte	0x3
+	.long	0x402
+	.uleb128 0x9
+	.long	.LASF1243
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x22
+	.long	0x420
+	.uleb128 0x9
+	.long	.LASF1244
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x10
+	.long	0x352
+	.uleb128 0x9
+	.long	.LASF1245
+	.byte	0x7
+	.byte	0x7e
+	.byte	0x10
+	.long	0x352
+	.uleb128 0x9
+	.long	.LASF1246
+	.byte	0x7
+	.byte	0x80
+	.byte	0x10
+	.long	0x352
+	.uleb128 0x9
+	.long	.LASF1247
+	.byte	0x7
+	.byte	0x80
+	.byte	0x1c
+	.long	0x352
+	.uleb128 0x9
+	.long	.LASF1248
+	.byte	0x7
+	.byte	0x80
+	.byte	0x27
+	.long	0x352
+	.uleb128 0x15
+	.long	0xdb
+	.long	0x484
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1249
+	.byte	0x7
+	.byte	0x81
+	.byte	0x10
+	.long	0x474
+	.uleb128 0x9
+	.long	.LASF1250
+	.byte	0x7
+	.byte	0x84
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0x9
+	.long	.LASF1251
+	.byte	0x7
+	.byte	0x86
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF1252
+	.byte	0x7
+	.byte	0x87
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF1253
+	.byte	0x7
+	.byte	0x89
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x8
+	.byte	0x18
+	.long	0x4f6
+	.uleb128 0x1
+	.long	.LASF1254
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1255
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1256
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1257
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1260
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1261
+	.byte	0x9
+	.byte	0x14
+	.byte	0x11
+	.long	0xf3
+	.uleb128 0x5
+	.long	.LASF1262
+	.byte	0x9
+	.byte	0x16
+	.byte	0x10
+	.long	0x50e
+	.uleb128 0xd
+	.long	0x513
+	.uleb128 0x3a
+	.uleb128 0x5
+	.long	.LASF1263
+	.byte	0x9
+	.byte	0x17
+	.byte	0x10
+	.long	0x520
+	.uleb128 0xd
+	.long	0x525
+	.uleb128 0x3b
+	.long	0x530
+	.uleb128 0x3
+	.long	0x530
+	.byte	0
+	.uleb128 0xd
+	.long	0xcf
+	.uleb128 0x12
+	.long	.LASF1264
+	.byte	0x20
+	.byte	0x9
+	.byte	0x19
+	.long	0x583
+	.uleb128 0x6
+	.long	.LASF1265
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x17
+	.long	0x502
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1266
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x17
+	.long	0x514
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1267
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x17
+	.long	0x514
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1268
+	.byte	0x9
+	.byte	0x1d
+	.byte	0xb
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1269
+	.byte	0x9
+	.byte	0x1e
+	.byte	0xe
+	.long	0xff
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1270
+	.byte	0x9
+	.byte	0x1f
+	.byte	0x3
+	.long	0x535
+	.uleb128 0x9
+	.long	.LASF1271
+	.byte	0xa
+	.byte	0x14
+	.byte	0xf
+	.long	0x583
+	.uleb128 0x9
+	.long	.LASF1272
+	.byte	0xb
+	.byte	0x19
+	.byte	0x10
+	.long	0x352
+	.uleb128 0x12
+	.long	.LASF1273
+	.byte	0x2
+	.byte	0xc
+	.byte	0x27
+	.long	0x5cb
+	.uleb128 0xb
+	.string	"xy"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xd
+	.long	0xe7
+	.byte	0
+	.uleb128 0xb
+	.string	"z"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xd
+	.long	0xe7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1274
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x3
+	.long	0x5a7
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xd
+	.byte	0x15
+	.long	0x5f5
+	.uleb128 0x1
+	.long	.LASF1275
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1276
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1277
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1278
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x10
+	.long	0xe7
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xd
+	.byte	0x34
+	.long	0x62b
+	.uleb128 0x1
+	.long	.LASF1279
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1280
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1281
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1282
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1283
+	.byte	0x10
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1284
+	.byte	0xd
+	.byte	0x40
+	.byte	0x10
+	.long	0xe7
+	.uleb128 0x3c
+	.long	.LASF1438
+	.byte	0x7
+	.byte	0x4
+	.long	0x4a
+	.byte	0x12
+	.byte	0x18
+	.byte	0xe
+	.long	0x6d4
+	.uleb128 0x1
+	.long	.LASF1285
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1286
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1287
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1288
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1291
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1292
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1293
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1294
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1295
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1298
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1299
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1300
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1301
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1302
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1303
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1304
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1305
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1306
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1307
+	.byte	0x17
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1308
+	.byte	0x40
+	.byte	0xe
+	.byte	0x15
+	.long	0x745
+	.uleb128 0xb
+	.string	"q0"
+	.byte	0xe
+	.byte	0x16
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.string	"q1"
+	.byte	0xe
+	.byte	0x16
+	.byte	0xf
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0xb
+	.string	"q2"
+	.byte	0xe
+	.byte	0x16
+	.byte	0x13
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xb
+	.string	"q3"
+	.byte	0xe
+	.byte	0x16
+	.byte	0x17
+	.long	0x2e
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF1309
+	.byte	0xe
+	.byte	0x17
+	.byte	0xb
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1310
+	.byte	0xe
+	.byte	0x17
+	.byte	0x16
+	.long	0x2e
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF1311
+	.byte	0xe
+	.byte	0x17
+	.byte	0x21
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1312
+	.byte	0xe
+	.byte	0x18
+	.byte	0xb
+	.long	0x745
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x15
+	.long	0x2e
+	.long	0x75b
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1313
+	.byte	0xe
+	.byte	0x19
+	.byte	0x3
+	.long	0x6d4
+	.uleb128 0x2a
+	.long	0x75b
+	.uleb128 0x9
+	.long	.LASF1314
+	.byte	0xf
+	.byte	0x14
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF1315
+	.byte	0xf
+	.byte	0x15
+	.byte	0x10
+	.long	0xe7
+	.uleb128 0x9
+	.long	.LASF1316
+	.byte	0xf
+	.byte	0x16
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF1317
+	.byte	0xf
+	.byte	0x17
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF1318
+	.byte	0xf
+	.byte	0x19
+	.byte	0x11
+	.long	0xff
+	.uleb128 0x9
+	.long	.LASF1319
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xc
+	.long	0xa2
+	.uleb128 0x9
+	.long	.LASF1320
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0x2e
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xf
+	.byte	0x1d
+	.long	0x7de
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1322
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1324
+	.byte	0x1c
+	.byte	0xf
+	.byte	0x23
+	.long	0x853
+	.uleb128 0x6
+	.long	.LASF1325
+	.byte	0xf
+	.byte	0x24
+	.byte	0xd
+	.long	0xe7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1326
+	.byte	0xf
+	.byte	0x25
+	.byte	0xd
+	.long	0xe7
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF1327
+	.byte	0xf
+	.byte	0x26
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF1328
+	.byte	0xf
+	.byte	0x27
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1329
+	.byte	0xf
+	.byte	0x28
+	.byte	0xd
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF1330
+	.byte	0xf
+	.byte	0x29
+	.byte	0xb
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1331
+	.byte	0xf
+	.byte	0x2a
+	.byte	0xb
+	.long	0x2e
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF1332
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xc
+	.long	0xc3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1333
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x3
+	.long	0x7de
+	.uleb128 0x9
+	.long	.LASF1334
+	.byte	0x1
+	.byte	0x31
+	.byte	0x11
+	.long	0xff
+	.uleb128 0xc
+	.long	0x450
+	.byte	0x33
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroADC
+	.uleb128 0xc
+	.long	0x45c
+	.byte	0x33
+	.byte	0x15
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accADC
+	.uleb128 0xc
+	.long	0x468
+	.byte	0x33
+	.byte	0x20
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accSmooth
+	.uleb128 0xc
+	.long	0x484
+	.byte	0x34
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accSum
+	.uleb128 0xc
+	.long	0x79c
+	.byte	0x36
+	.byte	0xa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accTimeSum
+	.uleb128 0xc
+	.long	0x7a8
+	.byte	0x37
+	.byte	0x5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accSumCount
+	.uleb128 0xc
+	.long	0x7b4
+	.byte	0x38
+	.byte	0x7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accVelScale
+	.uleb128 0x11
+	.long	.LASF1335
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	smallAngle
+	.uleb128 0xc
+	.long	0x49c
+	.byte	0x3c
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstAlt
+	.uleb128 0xc
+	.long	0x4a8
+	.byte	0x3d
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	AltHold
+	.uleb128 0xc
+	.long	0x784
+	.byte	0x3e
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	setVelocity
+	.uleb128 0xc
+	.long	0x778
+	.byte	0x3f
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	velocityControl
+	.uleb128 0xc
+	.long	0x76c
+	.byte	0x40
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	errorVelocityI
+	.uleb128 0xc
+	.long	0x4b4
+	.byte	0x42
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vario
+	.uleb128 0x11
+	.long	.LASF1336
+	.byte	0x44
+	.byte	0x7
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	throttleAngleScale
+	.uleb128 0x11
+	.long	.LASF1337
+	.byte	0x45
+	.byte	0x7
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	fc_acc
+	.uleb128 0xc
+	.long	0x790
+	.byte	0x47
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	altHoldThrottleAdjustment
+	.uleb128 0x11
+	.long	.LASF1338
+	.byte	0x49
+	.byte	0x7
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	magneticDeclination
+	.uleb128 0x11
+	.long	.LASF1339
+	.byte	0x4a
+	.byte	0x7
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroScaleRad
+	.uleb128 0x17
+	.long	.LASF1340
+	.byte	0x4b
+	.byte	0xe
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroScaleRadPerSecond
+	.uleb128 0x11
+	.long	.LASF1312
+	.byte	0x4e
+	.byte	0x7
+	.long	0x745
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rMat
+	.uleb128 0x17
+	.long	.LASF1341
+	.byte	0x50
+	.byte	0x1a
+	.long	0x75b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mahonyEstimator
+	.uleb128 0x17
+	.long	.LASF1342
+	.byte	0x51
+	.byte	0xc
+	.long	0xa16
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mahonyAligned
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1343
+	.uleb128 0xc
+	.long	0x438
+	.byte	0x56
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroData
+	.uleb128 0xc
+	.long	0x444
+	.byte	0x57
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroZero
+	.uleb128 0xc
+	.long	0x42c
+	.byte	0x59
+	.byte	0x1b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	inclination
+	.uleb128 0x15
+	.long	0x2e
+	.long	0xa60
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1344
+	.byte	0x5a
+	.byte	0x7
+	.long	0xa50
+	.uleb128 0x9
+	.byte	0x3
+	.quad	anglerad
+	.uleb128 0x11
+	.long	.LASF1345
+	.byte	0x5e
+	.byte	0x15
+	.long	0xa8a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	imuRuntimeConfig
+	.uleb128 0xd
+	.long	0x853
+	.uleb128 0x11
+	.long	.LASF1346
+	.byte	0x5f
+	.byte	0xf
+	.long	0xaa4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pidProfile
+	.uleb128 0xd
+	.long	0x246
+	.uleb128 0x11
+	.long	.LASF1347
+	.byte	0x60
+	.byte	0x10
+	.long	0xabe
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accDeadband
+	.uleb128 0xd
+	.long	0x5cb
+	.uleb128 0x15
+	.long	0x14d
+	.long	0xad3
+	.uleb128 0x13
+	.long	0x51
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1348
+	.byte	0x65
+	.byte	0x14
+	.long	0xac3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accFilter
+	.uleb128 0x17
+	.long	.LASF1349
+	.byte	0x66
+	.byte	0x14
+	.long	0x14d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	triYawGyroFilter
+	.uleb128 0x17
+	.long	.LASF1350
+	.byte	0x67
+	.byte	0x11
+	.long	0xff
+	.uleb128 0x9
+	.byte	0x3
+	.quad	imuFilterSamplePeriod
+	.uleb128 0x17
+	.long	.LASF1351
+	.byte	0x68
+	.byte	0xc
+	.long	0xa16
+	.uleb128 0x9
+	.byte	0x3
+	.quad	imuFilterInitialised
+	.uleb128 0x11
+	.long	.LASF1352
+	.byte	0xbe
+	.byte	0xd
+	.long	0x2dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstG
+	.uleb128 0xe
+	.long	.LASF1353
+	.byte	0x10
+	.byte	0x44
+	.byte	0x7
+	.long	0x2e
+	.long	0xb52
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1354
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x9
+	.long	0xdb
+	.long	0xb6d
+	.uleb128 0x3
+	.long	0xdb
+	.uleb128 0x3
+	.long	0xdb
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1355
+	.byte	0x10
+	.byte	0x45
+	.byte	0x7
+	.long	0x2e
+	.long	0xb83
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1356
+	.byte	0x10
+	.byte	0x41
+	.byte	0x7
+	.long	0x2e
+	.long	0xb99
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1357
+	.byte	0x10
+	.byte	0x42
+	.byte	0x7
+	.long	0x2e
+	.long	0xbaf
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1358
+	.byte	0xe
+	.byte	0x25
+	.byte	0x7
+	.long	0x2e
+	.long	0xbc5
+	.uleb128 0x3
+	.long	0xbc5
+	.byte	0
+	.uleb128 0xd
+	.long	0x767
+	.uleb128 0xe
+	.long	.LASF1359
+	.byte	0xe
+	.byte	0x24
+	.byte	0x7
+	.long	0x2e
+	.long	0xbe0
+	.uleb128 0x3
+	.long	0xbc5
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1360
+	.byte	0xe
+	.byte	0x23
+	.byte	0x7
+	.long	0x2e
+	.long	0xbf6
+	.uleb128 0x3
+	.long	0xbc5
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1361
+	.byte	0xe
+	.byte	0x21
+	.long	0xc25
+	.uleb128 0x3
+	.long	0xc25
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0xc2a
+	.uleb128 0x3
+	.long	0xc2a
+	.uleb128 0x3
+	.long	0xc2a
+	.byte	0
+	.uleb128 0xd
+	.long	0x75b
+	.uleb128 0xd
+	.long	0x10b
+	.uleb128 0x1d
+	.long	.LASF1362
+	.byte	0xe
+	.byte	0x1c
+	.long	0xc45
+	.uleb128 0x3
+	.long	0xc25
+	.uleb128 0x3
+	.long	0xc2a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1363
+	.byte	0x11
+	.byte	0x8f
+	.byte	0xe
+	.long	0x2e
+	.long	0xc5b
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1364
+	.byte	0x10
+	.byte	0x43
+	.byte	0x7
+	.long	0x2e
+	.long	0xc76
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF1439
+	.byte	0x13
+	.byte	0x18
+	.byte	0xa
+	.long	0xff
+	.uleb128 0x1d
+	.long	.LASF1365
+	.byte	0x5
+	.byte	0x1f
+	.long	0xc9d
+	.uleb128 0x3
+	.long	0xc9d
+	.uleb128 0x3
+	.long	0xf3
+	.uleb128 0x3
+	.long	0xff
+	.byte	0
+	.uleb128 0xd
+	.long	0x14d
+	.uleb128 0xe
+	.long	.LASF1366
+	.byte	0x5
+	.byte	0x20
+	.byte	0x7
+	.long	0x2e
+	.long	0xcbd
+	.uleb128 0x3
+	.long	0xc9d
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1367
+	.byte	0xc
+	.byte	0x2e
+	.long	0xcce
+	.uleb128 0x3
+	.long	0xcce
+	.byte	0
+	.uleb128 0xd
+	.long	0x3c3
+	.uleb128 0xe
+	.long	.LASF1368
+	.byte	0xd
+	.byte	0x43
+	.byte	0x5
+	.long	0xa16
+	.long	0xce9
+	.uleb128 0x3
+	.long	0xff
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1440
+	.byte	0xa
+	.byte	0x21
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1369
+	.byte	0xe
+	.byte	0x1b
+	.long	0xd02
+	.uleb128 0x3
+	.long	0xc25
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1370
+	.byte	0x11
+	.value	0x13d
+	.byte	0x11
+	.long	0xb5
+	.long	0xd19
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1371
+	.byte	0x11
+	.byte	0x3e
+	.byte	0xf
+	.long	0x2e
+	.long	0xd2f
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF1441
+	.byte	0x1
+	.value	0x1df
+	.byte	0x9
+	.long	0xcf
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdd0
+	.uleb128 0x2b
+	.long	.LASF1395
+	.value	0x1df
+	.byte	0x32
+	.long	0xe7
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x26
+	.long	.LASF1372
+	.value	0x1e1
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x26
+	.long	.LASF1373
+	.value	0x1e6
+	.byte	0x9
+	.long	0xa2
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x4
+	.quad	.LVL183
+	.long	0xb6d
+	.uleb128 0x4
+	.quad	.LVL185
+	.long	0xb3c
+	.uleb128 0x4
+	.quad	.LVL186
+	.long	0xd02
+	.uleb128 0x4
+	.quad	.LVL188
+	.long	0xb83
+	.uleb128 0x4
+	.quad	.LVL189
+	.long	0xd02
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1384
+	.value	0x192
+	.long	0xe80
+	.uleb128 0xa
+	.long	.LASF1374
+	.value	0x194
+	.byte	0xd
+	.long	0xdb
+	.uleb128 0xa
+	.long	.LASF1375
+	.value	0x195
+	.byte	0xd
+	.long	0xdb
+	.uleb128 0x1e
+	.long	.LASF1376
+	.value	0x196
+	.byte	0x18
+	.long	0x2dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstM.3
+	.uleb128 0x1e
+	.long	.LASF1377
+	.value	0x197
+	.byte	0x18
+	.long	0x2dc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstN.2
+	.uleb128 0x1e
+	.long	.LASF1378
+	.value	0x198
+	.byte	0x15
+	.long	0xff
+	.uleb128 0x9
+	.byte	0x3
+	.quad	previousT.4
+	.uleb128 0xa
+	.long	.LASF1379
+	.value	0x199
+	.byte	0xe
+	.long	0xff
+	.uleb128 0xa
+	.long	.LASF1380
+	.value	0x19a
+	.byte	0xe
+	.long	0xff
+	.uleb128 0xa
+	.long	.LASF1268
+	.value	0x19b
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1381
+	.value	0x19c
+	.byte	0x11
+	.long	0x346
+	.uleb128 0xa
+	.long	.LASF1382
+	.value	0x1bb
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x2c
+	.uleb128 0xa
+	.long	.LASF1383
+	.value	0x1ce
+	.byte	0xf
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1385
+	.value	0x16d
+	.long	0xeec
+	.uleb128 0x28
+	.long	.LASF1380
+	.value	0x16d
+	.byte	0x35
+	.long	0xff
+	.uleb128 0x28
+	.long	.LASF1375
+	.value	0x16d
+	.byte	0x45
+	.long	0xdb
+	.uleb128 0xa
+	.long	.LASF1386
+	.value	0x16f
+	.byte	0xb
+	.long	0x236
+	.uleb128 0x18
+	.string	"acc"
+	.value	0x170
+	.byte	0xb
+	.long	0x236
+	.uleb128 0x18
+	.string	"mag"
+	.value	0x171
+	.byte	0xb
+	.long	0x236
+	.uleb128 0xa
+	.long	.LASF1387
+	.value	0x172
+	.byte	0x9
+	.long	0xa16
+	.uleb128 0xa
+	.long	.LASF1388
+	.value	0x173
+	.byte	0x9
+	.long	0xa16
+	.uleb128 0xa
+	.long	.LASF1374
+	.value	0x174
+	.byte	0x9
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1389
+	.value	0x163
+	.uleb128 0x2d
+	.long	.LASF1390
+	.value	0x15a
+	.uleb128 0x2e
+	.long	.LASF1391
+	.value	0x152
+	.long	0xcf
+	.long	0xf2c
+	.uleb128 0x2f
+	.string	"vec"
+	.value	0x152
+	.byte	0x2e
+	.long	0xf2c
+	.uleb128 0x18
+	.string	"Xh"
+	.value	0x154
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x18
+	.string	"Yh"
+	.value	0x155
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xd
+	.long	0x2dc
+	.uleb128 0x2e
+	.long	.LASF1392
+	.value	0x144
+	.long	0xcf
+	.long	0xf64
+	.uleb128 0x28
+	.long	.LASF1393
+	.value	0x144
+	.byte	0x29
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1394
+	.value	0x146
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x18
+	.string	"hd"
+	.value	0x148
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF1407
+	.byte	0x1
+	.value	0x120
+	.byte	0x6
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1063
+	.uleb128 0x2b
+	.long	.LASF1380
+	.value	0x120
+	.byte	0x18
+	.long	0xff
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1e
+	.long	.LASF1396
+	.value	0x122
+	.byte	0x14
+	.long	0xdb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accZoffset.1
+	.uleb128 0x1e
+	.long	.LASF1397
+	.value	0x123
+	.byte	0x12
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accz_smooth.0
+	.uleb128 0x42
+	.string	"dT"
+	.byte	0x1
+	.value	0x124
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x26
+	.long	.LASF1398
+	.value	0x125
+	.byte	0x11
+	.long	0x2dc
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x4
+	.quad	.LVL66
+	.long	0xd02
+	.uleb128 0x8
+	.quad	.LVL67
+	.long	0xb52
+	.long	0x1010
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL68
+	.long	0xd02
+	.long	0x1029
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL69
+	.long	0xb52
+	.long	0x1041
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL70
+	.long	0xd02
+	.uleb128 0x19
+	.quad	.LVL71
+	.long	0xb52
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1399
+	.value	0x111
+	.long	0x10b5
+	.uleb128 0x2f
+	.string	"yaw"
+	.value	0x111
+	.byte	0x2f
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1400
+	.value	0x113
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1401
+	.value	0x114
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1374
+	.value	0x115
+	.byte	0x9
+	.long	0xa2
+	.uleb128 0x2c
+	.uleb128 0x18
+	.string	"x"
+	.value	0x118
+	.byte	0xf
+	.long	0x2e
+	.uleb128 0x18
+	.string	"y"
+	.value	0x119
+	.byte	0xf
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1402
+	.byte	0xfc
+	.long	0x1104
+	.uleb128 0x31
+	.long	.LASF1229
+	.byte	0xfc
+	.byte	0x2d
+	.long	0x2e
+	.uleb128 0x31
+	.long	.LASF1230
+	.byte	0xfc
+	.byte	0x39
+	.long	0x2e
+	.uleb128 0x29
+	.long	.LASF1403
+	.byte	0xfe
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x29
+	.long	.LASF1404
+	.byte	0xff
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1405
+	.value	0x100
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0xa
+	.long	.LASF1406
+	.value	0x101
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1442
+	.byte	0x1
+	.byte	0xf2
+	.byte	0x6
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1b
+	.long	.LASF1408
+	.byte	0xce
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1292
+	.uleb128 0x32
+	.string	"v"
+	.byte	0xce
+	.byte	0x20
+	.long	0x1292
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1f
+	.long	.LASF1409
+	.byte	0xce
+	.byte	0x30
+	.long	0x1297
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xf
+	.long	.LASF1410
+	.byte	0xd0
+	.byte	0x16
+	.long	0x288
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x44
+	.string	"mat"
+	.byte	0x1
+	.byte	0xd3
+	.byte	0xb
+	.long	0x745
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xf
+	.long	.LASF1411
+	.byte	0xd4
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xf
+	.long	.LASF1412
+	.byte	0xd4
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xf
+	.long	.LASF1413
+	.byte	0xd4
+	.byte	0x17
+	.long	0x2e
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xf
+	.long	.LASF1414
+	.byte	0xd4
+	.byte	0x1d
+	.long	0x2e
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xf
+	.long	.LASF1415
+	.byte	0xd4
+	.byte	0x23
+	.long	0x2e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xf
+	.long	.LASF1416
+	.byte	0xd4
+	.byte	0x29
+	.long	0x2e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xf
+	.long	.LASF1417
+	.byte	0xd5
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xf
+	.long	.LASF1418
+	.byte	0xd5
+	.byte	0x15
+	.long	0x2e
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xf
+	.long	.LASF1419
+	.byte	0xd5
+	.byte	0x1f
+	.long	0x2e
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xf
+	.long	.LASF1420
+	.byte	0xd5
+	.byte	0x29
+	.long	0x2e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0xb99
+	.uleb128 0x4
+	.quad	.LVL29
+	.long	0xb83
+	.uleb128 0x4
+	.quad	.LVL32
+	.long	0xb99
+	.uleb128 0x4
+	.quad	.LVL35
+	.long	0xb83
+	.uleb128 0x4
+	.quad	.LVL38
+	.long	0xb99
+	.uleb128 0x4
+	.quad	.LVL41
+	.long	0xb83
+	.byte	0
+	.uleb128 0xd
+	.long	0x288
+	.uleb128 0xd
+	.long	0x346
+	.uleb128 0x1b
+	.long	.LASF1421
+	.byte	0xc1
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1324
+	.uleb128 0x32
+	.string	"src"
+	.byte	0xc1
+	.byte	0x23
+	.long	0x1292
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x1f
+	.long	.LASF1422
+	.byte	0xc1
+	.byte	0x3a
+	.long	0x1292
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.long	.LASF1423
+	.byte	0xc3
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x45
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0xf
+	.long	.LASF1424
+	.byte	0xc6
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4
+	.quad	.LVL18
+	.long	0xb6d
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1425
+	.byte	0x97
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19f1
+	.uleb128 0x1f
+	.long	.LASF1426
+	.byte	0x97
+	.byte	0x26
+	.long	0xcce
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1f
+	.long	.LASF1427
+	.byte	0x97
+	.byte	0x42
+	.long	0xe7
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x33
+	.long	0x1a9f
+	.quad	.LBI33
+	.value	.LVU332
+	.long	.LLRL30
+	.byte	0x99
+	.byte	0x5
+	.long	0x13cb
+	.uleb128 0x20
+	.long	.LLRL30
+	.uleb128 0x7
+	.long	0x1aa9
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.quad	.LVL79
+	.long	0xc82
+	.long	0x13a9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -8
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL80
+	.long	0xc82
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	triYawGyroFilter
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x47
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	0xdd0
+	.quad	.LBI37
+	.value	.LVU379
+	.long	.LLRL32
+	.byte	0x9e
+	.byte	0x9
+	.long	0x1987
+	.uleb128 0x20
+	.long	.LLRL32
+	.uleb128 0x7
+	.long	0xddb
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x7
+	.long	0xde7
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x7
+	.long	0xe35
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x7
+	.long	0xe41
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x7
+	.long	0xe4d
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x22
+	.long	0xe59
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x7
+	.long	0xe65
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x1a
+	.long	0xe80
+	.quad	.LBI39
+	.value	.LVU608
+	.long	.LLRL39
+	.value	0x1ae
+	.byte	0x9
+	.long	0x15bd
+	.uleb128 0x16
+	.long	0xe97
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x16
+	.long	0xe8b
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x20
+	.long	.LLRL39
+	.uleb128 0x22
+	.long	0xea3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x22
+	.long	0xeaf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x22
+	.long	0xebb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x7
+	.long	0xec7
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x7
+	.long	0xed3
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x7
+	.long	0xedf
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x1a
+	.long	0xf31
+	.quad	.LBI41
+	.value	.LVU675
+	.long	.LLRL45
+	.value	0x18f
+	.byte	0xf
+	.long	0x1510
+	.uleb128 0x16
+	.long	0xf40
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x20
+	.long	.LLRL45
+	.uleb128 0x7
+	.long	0xf4c
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x7
+	.long	0xf58
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x4
+	.quad	.LVL170
+	.long	0xd02
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL153
+	.long	0xcd3
+	.long	0x1527
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL160
+	.long	0xbf6
+	.long	0x1558
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -120
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x358637bd
+	.byte	0x1e
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL164
+	.long	0xbe0
+	.long	0x1570
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL165
+	.long	0xbca
+	.long	0x1588
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL166
+	.long	0xbaf
+	.long	0x15a0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL179
+	.long	0xc2f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xef3
+	.quad	.LBI49
+	.value	.LVU433
+	.long	.LLRL49
+	.value	0x1c2
+	.byte	0x5
+	.long	0x15ed
+	.uleb128 0x34
+	.long	0xef3
+	.quad	.LBB51
+	.quad	.LBE51-.LBB51
+	.byte	0
+	.uleb128 0x1a
+	.long	0xeec
+	.quad	.LBI55
+	.value	.LVU456
+	.long	.LLRL50
+	.value	0x1c7
+	.byte	0x5
+	.long	0x1622
+	.uleb128 0x4
+	.quad	.LVL101
+	.long	0xd02
+	.uleb128 0x4
+	.quad	.LVL102
+	.long	0xd02
+	.byte	0
+	.uleb128 0x1a
+	.long	0x10b5
+	.quad	.LBI60
+	.value	.LVU469
+	.long	.LLRL51
+	.value	0x1c9
+	.byte	0x5
+	.long	0x16f1
+	.uleb128 0x16
+	.long	0x10ca
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x16
+	.long	0x10bf
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x20
+	.long	.LLRL51
+	.uleb128 0x7
+	.long	0x10d5
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x7
+	.long	0x10e0
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x7
+	.long	0x10eb
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x7
+	.long	0x10f7
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x8
+	.quad	.LVL104
+	.long	0xb99
+	.long	0x16a8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL107
+	.long	0xb83
+	.long	0x16c1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL110
+	.long	0xb99
+	.long	0x16da
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL113
+	.long	0xb83
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0xe71
+	.long	.LLRL58
+	.long	0x1741
+	.uleb128 0x7
+	.long	0xe72
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x8
+	.quad	.LVL142
+	.long	0x111e
+	.long	0x1723
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL147
+	.long	0x1af9
+	.uleb128 0x36
+	.long	0xf09
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstM.3
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0x1063
+	.quad	.LBI69
+	.value	.LVU526
+	.quad	.LBB69
+	.quad	.LBE69-.LBB69
+	.value	0x1d9
+	.byte	0x5
+	.long	0x17f8
+	.uleb128 0x16
+	.long	0x106e
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x7
+	.long	0x107a
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x7
+	.long	0x1086
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x7
+	.long	0x1092
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x35
+	.long	0x109e
+	.long	.LLRL64
+	.long	0x17c3
+	.uleb128 0x7
+	.long	0x109f
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x7
+	.long	0x10a9
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL121
+	.long	0xb99
+	.long	0x17df
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -120
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL124
+	.long	0xb83
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -120
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0xef3
+	.quad	.LBI75
+	.value	.LVU697
+	.long	.LLRL67
+	.value	0x1af
+	.byte	0x9
+	.long	0x1828
+	.uleb128 0x34
+	.long	0xef3
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.byte	0
+	.uleb128 0x1a
+	.long	0xeec
+	.quad	.LBI86
+	.value	.LVU705
+	.long	.LLRL68
+	.value	0x1b0
+	.byte	0x9
+	.long	0x185d
+	.uleb128 0x4
+	.quad	.LVL173
+	.long	0xd02
+	.uleb128 0x4
+	.quad	.LVL174
+	.long	0xd02
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL87
+	.long	0xc76
+	.uleb128 0x8
+	.quad	.LVL96
+	.long	0x111e
+	.long	0x1888
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL98
+	.long	0xc5b
+	.uleb128 0x4
+	.quad	.LVL99
+	.long	0xc5b
+	.uleb128 0x8
+	.quad	.LVL116
+	.long	0xcd3
+	.long	0x18b9
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL117
+	.long	0x111e
+	.long	0x18d8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL118
+	.long	0x129c
+	.long	0x18f6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL119
+	.long	0x1af9
+	.long	0x1917
+	.uleb128 0x36
+	.long	0xf09
+	.uleb128 0x9
+	.byte	0x3
+	.quad	EstN.2
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL134
+	.long	0xf64
+	.long	0x192f
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL136
+	.long	0xca2
+	.long	0x1953
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xe
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x3
+	.quad	accFilter
+	.byte	0x22
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL137
+	.long	0xd02
+	.uleb128 0x8
+	.quad	.LVL175
+	.long	0xf64
+	.long	0x1978
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL181
+	.long	0xc45
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL81
+	.long	0xce9
+	.uleb128 0x8
+	.quad	.LVL82
+	.long	0xcd3
+	.long	0x19ab
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL86
+	.long	0xcbd
+	.long	0x19c4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL139
+	.long	0xca2
+	.long	0x19e3
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	triYawGyroFilter
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL140
+	.long	0xd02
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1428
+	.byte	0x92
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a21
+	.uleb128 0x1f
+	.long	.LASF1429
+	.byte	0x92
+	.byte	0x35
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1430
+	.byte	0x8d
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a4b
+	.uleb128 0x23
+	.long	.LASF1433
+	.byte	0x8d
+	.byte	0x2b
+	.long	0xf3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF1443
+	.byte	0x1
+	.byte	0x83
+	.byte	0x6
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a9f
+	.uleb128 0x4
+	.quad	.LVL9
+	.long	0xd19
+	.uleb128 0x4
+	.quad	.LVL10
+	.long	0xd02
+	.uleb128 0x19
+	.quad	.LVL11
+	.long	0xcf1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mahonyEstimator
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1431
+	.byte	0x72
+	.long	0x1ab5
+	.uleb128 0x29
+	.long	.LASF1374
+	.byte	0x74
+	.byte	0x9
+	.long	0xa2
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1432
+	.byte	0x6a
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1af9
+	.uleb128 0x23
+	.long	.LASF1434
+	.byte	0x6a
+	.byte	0x27
+	.long	0xa8a
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x23
+	.long	.LASF1435
+	.byte	0x6a
+	.byte	0x4e
+	.long	0xaa4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x23
+	.long	.LASF1436
+	.byte	0x6a
+	.byte	0x70
+	.long	0xabe
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x47
+	.long	0xefa
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x7
+	.long	0xf15
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x7
+	.long	0xf20
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x16
+	.long	0xf09
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x37
+	.long	0xf31
+	.quad	.LBI4
+	.value	.LVU19
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.value	0x157
+	.byte	0xc
+	.long	0x1b92
+	.uleb128 0x16
+	.long	0xf40
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x7
+	.long	0xf4c
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x7
+	.long	0xf58
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x4
+	.quad	.LVL6
+	.long	0xd02
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL2
+	.long	0xc5b
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 346
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x80
+	.uleb128 0x13
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU737
+	.uleb128 .LVU737
+	.uleb128 0
+.LLST69:
+	.byte	0x6
+	.quad	.LVL182
+	.byte	0x4
+	.uleb128 .LVL182-.LVL182
+	.uleb128 .LVL183-1-.LVL182
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL183-1-.LVL182
+	.uleb128 .LFE18-.LVL182
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU738
+	.uleb128 .LVU742
+.LLST70:
+	.byte	0x8
+	.quad	.LVL184
+	.uleb128 .LVL185-1-.LVL184
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU743
+	.uleb128 .LVU744
+	.uleb128 .LVU744
+	.uleb128 .LVU750
+.LLST71:
+	.byte	0x6
+	.quad	.LVL186
+	.byte	0x4
+	.uleb128 .LVL186-.LVL186
+	.uleb128 .LVL186-.LVL186
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL186-.LVL186
+	.uleb128 .LVL187-.LVL186
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x12
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0xa
+	.value	0x384
+	.byte	0x16
+	.byte	0x14
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST25:
+	.byte	0x6
+	.quad	.LVL59
+	.byte	0x4
+	.uleb128 .LVL59-.LVL59
+	.uleb128 .LVL66-1-.LVL59
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL66-1-.LVL59
+	.uleb128 .LVL72-.LVL59
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL72-.LVL59
+	.uleb128 .LVL74-.LVL59
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.LVL59
+	.uleb128 .LFE11-.LVL59
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU247
+	.uleb128 .LVU284
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST26:
+	.byte	0x6
+	.quad	.LVL60
+	.byte	0x4
+	.uleb128 .LVL60-.LVL60
+	.uleb128 .LVL65-.LVL60
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL74-.LVL60
+	.uleb128 .LFE11-.LVL60
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU260
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU282
+	.uleb128 .LVU282
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU313
+	.uleb128 .LVU314
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL61
+	.byte	0x4
+	.uleb128 .LVL61-.LVL61
+	.uleb128 .LVL62-.LVL61
+	.uleb128 0x5
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL62-.LVL61
+	.uleb128 .LVL62-.LVL61
+	.uleb128 0x8
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL62-.LVL61
+	.uleb128 .LVL63-.LVL61
+	.uleb128 0x9
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL63-.LVL61
+	.uleb128 .LVL64-.LVL61
+	.uleb128 0x9
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL64-.LVL61
+	.uleb128 .LVL66-1-.LVL61
+	.uleb128 0x8
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL66-1-.LVL61
+	.uleb128 .LVL73-.LVL61
+	.uleb128 0x7
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x5e
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL74-.LVL61
+	.uleb128 .LVL75-.LVL61
+	.uleb128 0x9
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL75-.LVL61
+	.uleb128 .LFE11-.LVL61
+	.uleb128 0x9
+	.byte	0x66
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x65
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL26-1-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-1-.LVL22
+	.uleb128 .LVL57-.LVL22
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.LVL22
+	.uleb128 .LFE7-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL26-1-.LVL22
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-1-.LVL22
+	.uleb128 .LVL58-.LVL22
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL58-.LVL22
+	.uleb128 .LFE7-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU121
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU127
+.LLST13:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 0
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL24-.LVL22
+	.uleb128 .LVL25-.LVL22
+	.uleb128 0xa
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -52
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL25-.LVL22
+	.uleb128 .LVL26-1-.LVL22
+	.uleb128 0x8
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x75
+	.sleb128 4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU182
+	.uleb128 .LVU182
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0xc
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x20
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x17
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x1c
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x1a
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x18
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x28
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x14
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x36
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x10
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x41
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0xc
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL44-.LVL44
+	.uleb128 0x4f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL45-.LVL44
+	.uleb128 0x5d
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL45-.LVL44
+	.uleb128 .LVL46-.LVL44
+	.uleb128 0x5d
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL46-.LVL44
+	.uleb128 .LVL47-.LVL44
+	.uleb128 0x56
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL47-.LVL44
+	.uleb128 .LVL48-.LVL44
+	.uleb128 0x4b
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL48-.LVL44
+	.uleb128 .LVL49-.LVL44
+	.uleb128 0x51
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL49-.LVL44
+	.uleb128 .LVL50-.LVL44
+	.uleb128 0x46
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL50-.LVL44
+	.uleb128 .LVL51-.LVL44
+	.uleb128 0x48
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x61
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL51-.LVL44
+	.uleb128 .LVL52-.LVL44
+	.uleb128 0x59
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL52-.LVL44
+	.uleb128 .LVL53-.LVL44
+	.uleb128 0x48
+	.byte	0x68
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL53-.LVL44
+	.uleb128 .LVL54-.LVL44
+	.uleb128 0x52
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL54-.LVL44
+	.uleb128 .LVL55-.LVL44
+	.uleb128 0x47
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x69
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL55-.LVL44
+	.uleb128 .LFE7-.LVL44
+	.uleb128 0x58
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -72
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x67
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0xa5
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x6a
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU128
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL28-.LVL27
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL28-.LVL27
+	.uleb128 .LFE7-.LVL27
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU131
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL31-.LVL30
+	.uleb128 .LFE7-.LVL30
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU134
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL34-.LVL33
+	.uleb128 .LFE7-.LVL33
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL37-.LVL36
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL37-.LVL36
+	.uleb128 .LFE7-.LVL36
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL40-.LVL39
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL40-.LVL39
+	.uleb128 .LFE7-.LVL39
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU147
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL45-.LVL42
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL45-.LVL42
+	.uleb128 .LFE7-.LVL42
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU160
+	.uleb128 0
+.LLST21:
+	.byte	0x8
+	.quad	.LVL43
+	.uleb128 .LFE7-.LVL43
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU162
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST22:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL48-.LVL44
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL48-.LVL44
+	.uleb128 .LFE7-.LVL44
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST23:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LFE7-.LVL44
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU164
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL54-.LVL44
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL54-.LVL44
+	.uleb128 .LFE7-.LVL44
+	.uleb128 0xa
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL17-.LVL15
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.LVL15
+	.uleb128 .LVL20-.LVL15
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.LVL15
+	.uleb128 .LFE6-.LVL15
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL18-1-.LVL15
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-1-.LVL15
+	.uleb128 .LVL21-.LVL15
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL21-.LVL15
+	.uleb128 .LFE6-.LVL15
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU98
+	.uleb128 .LVU103
+.LLST9:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL18-1-.LVL16
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU103
+	.uleb128 .LVU110
+.LLST10:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-.LVL18
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU378
+	.uleb128 .LVU378
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.LVL76
+	.uleb128 .LVL83-.LVL76
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL83-.LVL76
+	.uleb128 .LVL84-.LVL76
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL76
+	.uleb128 .LVL85-.LVL76
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL85-.LVL76
+	.uleb128 .LVL86-1-.LVL76
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL86-1-.LVL76
+	.uleb128 .LFE5-.LVL76
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU340
+	.uleb128 .LVU340
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL77-.LVL76
+	.uleb128 .LFE5-.LVL76
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU340
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU346
+.LLST31:
+	.byte	0x6
+	.quad	.LVL77
+	.byte	0x4
+	.uleb128 .LVL77-.LVL77
+	.uleb128 .LVL78-.LVL77
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	accFilter
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.LVL77
+	.uleb128 .LVL79-1-.LVL77
+	.uleb128 0xf
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	accFilter
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-1-.LVL77
+	.uleb128 .LVL79-.LVL77
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	accFilter+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU401
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU416
+	.uleb128 .LVU416
+	.uleb128 .LVU418
+	.uleb128 .LVU559
+	.uleb128 .LVU564
+	.uleb128 .LVU575
+	.uleb128 .LVU576
+	.uleb128 .LVU576
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU586
+	.uleb128 .LVU596
+	.uleb128 .LVU600
+	.uleb128 .LVU600
+	.uleb128 .LVU606
+.LLST33:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL90-.LVL89
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL89
+	.uleb128 .LVL91-.LVL89
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.LVL89
+	.uleb128 .LVL92-.LVL89
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.LVL89
+	.uleb128 .LVL138-.LVL89
+	.uleb128 0x5
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL89
+	.uleb128 .LVL143-.LVL89
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL89
+	.uleb128 .LVL144-.LVL89
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	EstM.3
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL89
+	.uleb128 .LVL145-.LVL89
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	EstM.3+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL149-.LVL89
+	.uleb128 .LVL150-.LVL89
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	EstG
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL150-.LVL89
+	.uleb128 .LVL151-.LVL89
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	EstG+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU382
+	.uleb128 .LVU403
+	.uleb128 .LVU403
+	.uleb128 .LVU422
+	.uleb128 .LVU422
+	.uleb128 .LVU424
+	.uleb128 .LVU425
+	.uleb128 .LVU429
+	.uleb128 .LVU429
+	.uleb128 .LVU452
+	.uleb128 .LVU559
+	.uleb128 .LVU564
+	.uleb128 .LVU591
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 0
+.LLST34:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL90-.LVL86
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL86
+	.uleb128 .LVL93-.LVL86
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL93-.LVL86
+	.uleb128 .LVL94-.LVL86
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.LVL86
+	.uleb128 .LVL96-1-.LVL86
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL96-1-.LVL86
+	.uleb128 .LVL100-.LVL86
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 73
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.LVL86
+	.uleb128 .LVL138-.LVL86
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL148-.LVL86
+	.uleb128 .LVL152-.LVL86
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 73
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL86
+	.uleb128 .LVL153-1-.LVL86
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL153-1-.LVL86
+	.uleb128 .LFE5-.LVL86
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 73
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU387
+	.uleb128 .LVU403
+.LLST35:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL90-.LVL87
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU395
+	.uleb128 .LVU564
+	.uleb128 .LVU567
+	.uleb128 0
+.LLST36:
+	.byte	0x6
+	.quad	.LVL88
+	.byte	0x4
+	.uleb128 .LVL88-.LVL88
+	.uleb128 .LVL138-.LVL88
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL141-.LVL88
+	.uleb128 .LFE5-.LVL88
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU399
+	.uleb128 .LVU403
+.LLST37:
+	.byte	0x8
+	.quad	.LVL89
+	.uleb128 .LVL90-.LVL89
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU591
+	.uleb128 .LVU596
+.LLST38:
+	.byte	0x6
+	.quad	.LVL96
+	.byte	0x4
+	.uleb128 .LVL96-.LVL96
+	.uleb128 .LVL97-.LVL96
+	.uleb128 0x20
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x3
+	.quad	imuRuntimeConfig
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x22
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.LVL96
+	.uleb128 .LVL149-.LVL96
+	.uleb128 0x20
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x3
+	.quad	imuRuntimeConfig
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x22
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU608
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU695
+	.uleb128 .LVU717
+	.uleb128 .LVU723
+.LLST40:
+	.byte	0x6
+	.quad	.LVL152
+	.byte	0x4
+	.uleb128 .LVL152-.LVL152
+	.uleb128 .LVL153-1-.LVL152
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL153-1-.LVL152
+	.uleb128 .LVL172-.LVL152
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 73
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.LVL152
+	.uleb128 .LVL180-.LVL152
+	.uleb128 0x4
+	.byte	0x7e
+	.sleb128 73
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU608
+	.uleb128 .LVU695
+	.uleb128 .LVU717
+	.uleb128 .LVU723
+.LLST41:
+	.byte	0x6
+	.quad	.LVL152
+	.byte	0x4
+	.uleb128 .LVL152-.LVL152
+	.uleb128 .LVL172-.LVL152
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL176-.LVL152
+	.uleb128 .LVL180-.LVL152
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU613
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU723
+.LLST42:
+	.byte	0x6
+	.quad	.LVL152
+	.byte	0x4
+	.uleb128 .LVL152-.LVL152
+	.uleb128 .LVL153-1-.LVL152
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 -73
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x2c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-1-.LVL152
+	.uleb128 .LVL180-.LVL152
+	.uleb128 0xa
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x2c
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU618
+	.uleb128 .LVU622
+	.uleb128 .LVU622
+	.uleb128 .LVU644
+	.uleb128 .LVU717
+	.uleb128 .LVU721
+.LLST43:
+	.byte	0x6
+	.quad	.LVL154
+	.byte	0x4
+	.uleb128 .LVL154-.LVL154
+	.uleb128 .LVL155-.LVL154
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL155-.LVL154
+	.uleb128 .LVL160-1-.LVL154
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL176-.LVL154
+	.uleb128 .LVL179-1-.LVL154
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU620
+	.uleb128 .LVU623
+	.uleb128 .LVU623
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 .LVU636
+	.uleb128 .LVU636
+	.uleb128 .LVU640
+	.uleb128 .LVU649
+	.uleb128 .LVU655
+	.uleb128 .LVU655
+	.uleb128 .LVU661
+	.uleb128 .LVU661
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU695
+	.uleb128 .LVU717
+	.uleb128 .LVU719
+	.uleb128 .LVU720
+	.uleb128 .LVU721
+.LLST44:
+	.byte	0x6
+	.quad	.LVL154
+	.byte	0x4
+	.uleb128 .LVL154-.LVL154
+	.uleb128 .LVL156-.LVL154
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.LVL154
+	.uleb128 .LVL157-.LVL154
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL154
+	.uleb128 .LVL158-.LVL154
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL154
+	.uleb128 .LVL159-.LVL154
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.LVL154
+	.uleb128 .LVL162-.LVL154
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.LVL154
+	.uleb128 .LVL163-.LVL154
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.LVL154
+	.uleb128 .LVL163-.LVL154
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL163-.LVL154
+	.uleb128 .LVL172-.LVL154
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.LVL154
+	.uleb128 .LVL177-.LVL154
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.LVL154
+	.uleb128 .LVL179-1-.LVL154
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU675
+	.uleb128 .LVU680
+.LLST46:
+	.byte	0x8
+	.quad	.LVL166
+	.uleb128 .LVL167-.LVL166
+	.uleb128 0x5
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU687
+	.uleb128 .LVU692
+.LLST47:
+	.byte	0x8
+	.quad	.LVL170
+	.uleb128 .LVL171-.LVL170
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU678
+	.uleb128 .LVU680
+	.uleb128 .LVU682
+	.uleb128 .LVU683
+.LLST48:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL167-.LVL166
+	.uleb128 0x37
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc4e10000
+	.byte	0x1e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0x54442d18
+	.long	0x400921fb
+	.byte	0x1b
+	.byte	0x3
+	.quad	magneticDeclination
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x22
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0
+	.long	0x40240000
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL168-.LVL166
+	.uleb128 .LVL169-.LVL166
+	.uleb128 0x2d
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0x54442d18
+	.long	0x400921fb
+	.byte	0x1b
+	.byte	0x3
+	.quad	magneticDeclination
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x22
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0
+	.long	0x40240000
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU469
+	.uleb128 .LVU511
+.LLST52:
+	.byte	0x8
+	.quad	.LVL103
+	.uleb128 .LVL115-.LVL103
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU469
+	.uleb128 .LVU472
+	.uleb128 .LVU472
+	.uleb128 .LVU511
+.LLST53:
+	.byte	0x6
+	.quad	.LVL103
+	.byte	0x4
+	.uleb128 .LVL103-.LVL103
+	.uleb128 .LVL104-1-.LVL103
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL104-1-.LVL103
+	.uleb128 .LVL115-.LVL103
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU473
+	.uleb128 .LVU475
+	.uleb128 .LVU475
+	.uleb128 .LVU511
+.LLST54:
+	.byte	0x6
+	.quad	.LVL105
+	.byte	0x4
+	.uleb128 .LVL105-.LVL105
+	.uleb128 .LVL106-.LVL105
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL106-.LVL105
+	.uleb128 .LVL115-.LVL105
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU476
+	.uleb128 .LVU478
+	.uleb128 .LVU478
+	.uleb128 .LVU511
+.LLST55:
+	.byte	0x6
+	.quad	.LVL108
+	.byte	0x4
+	.uleb128 .LVL108-.LVL108
+	.uleb128 .LVL109-.LVL108
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL109-.LVL108
+	.uleb128 .LVL115-.LVL108
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU479
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU511
+.LLST56:
+	.byte	0x6
+	.quad	.LVL111
+	.byte	0x4
+	.uleb128 .LVL111-.LVL111
+	.uleb128 .LVL112-.LVL111
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL112-.LVL111
+	.uleb128 .LVL115-.LVL111
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU482
+	.uleb128 .LVU497
+.LLST57:
+	.byte	0x8
+	.quad	.LVL113
+	.uleb128 .LVL114-.LVL113
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU574
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU590
+.LLST59:
+	.byte	0x6
+	.quad	.LVL143
+	.byte	0x4
+	.uleb128 .LVL143-.LVL143
+	.uleb128 .LVL146-.LVL143
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL146-.LVL143
+	.uleb128 .LVL147-1-.LVL143
+	.uleb128 0x14
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x22
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU526
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU557
+.LLST60:
+	.byte	0x6
+	.quad	.LVL120
+	.byte	0x4
+	.uleb128 .LVL120-.LVL120
+	.uleb128 .LVL121-1-.LVL120
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL121-1-.LVL120
+	.uleb128 .LVL133-.LVL120
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU531
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU557
+.LLST61:
+	.byte	0x6
+	.quad	.LVL122
+	.byte	0x4
+	.uleb128 .LVL122-.LVL122
+	.uleb128 .LVL123-.LVL122
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL123-.LVL122
+	.uleb128 .LVL133-.LVL122
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU534
+	.uleb128 .LVU557
+.LLST62:
+	.byte	0x8
+	.quad	.LVL124
+	.uleb128 .LVL133-.LVL124
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU536
+	.uleb128 .LVU537
+	.uleb128 .LVU537
+	.uleb128 .LVU545
+	.uleb128 .LVU545
+	.uleb128 .LVU556
+.LLST63:
+	.byte	0x6
+	.quad	.LVL124
+	.byte	0x4
+	.uleb128 .LVL124-.LVL124
+	.uleb128 .LVL125-.LVL124
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL125-.LVL124
+	.uleb128 .LVL128-.LVL124
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rMat
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.LVL124
+	.uleb128 .LVL132-.LVL124
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rMat+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU539
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU552
+.LLST65:
+	.byte	0x6
+	.quad	.LVL126
+	.byte	0x4
+	.uleb128 .LVL126-.LVL126
+	.uleb128 .LVL129-.LVL126
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL129-.LVL126
+	.uleb128 .LVL131-.LVL126
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 -4
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU541
+	.uleb128 .LVU549
+	.uleb128 .LVU549
+	.uleb128 .LVU554
+.LLST66:
+	.byte	0x6
+	.quad	.LVL127
+	.byte	0x4
+	.uleb128 .LVL127-.LVL127
+	.uleb128 .LVL130-.LVL127
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL130-.LVL127
+	.uleb128 .LVL132-.LVL127
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 8
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL14-.LVL13
+	.uleb128 .LFE4-.LVL13
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU2
+	.uleb128 .LVU11
+.LLST0:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x33
+	.byte	0x3
+	.quad	rMat
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x3
+	.quad	rMat+4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	rMat+8
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU3
+	.uleb128 .LVU11
+.LLST1:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x33
+	.byte	0x3
+	.quad	rMat+12
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x3
+	.quad	rMat+16
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x3
+	.quad	rMat+20
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU1
+	.uleb128 0
+.LLST2:
+	.byte	0x8
+	.quad	.LVL0
+	.uleb128 .LFE20-.LVL0
+	.uleb128 0x6
+	.byte	0xfa
+	.long	0xf09
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU19
+	.uleb128 .LVU24
+.LLST3:
+	.byte	0x8
+	.quad	.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU31
+	.uleb128 .LVU33
+.LLST4:
+	.byte	0x8
+	.quad	.LVL6
+	.uleb128 .LVL7-.LVL6
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU22
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+.LLST5:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x37
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x44e10000
+	.byte	0x1e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0x54442d18
+	.long	0x400921fb
+	.byte	0x1b
+	.byte	0x3
+	.quad	magneticDeclination
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x22
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0
+	.long	0x40240000
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0x2d
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x35
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0x54442d18
+	.long	0x400921fb
+	.byte	0x1b
+	.byte	0x3
+	.quad	magneticDeclination
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x22
+	.byte	0xa4
+	.uleb128 0x35
+	.byte	0x8
+	.long	0
+	.long	0x40240000
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xcc
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB33
+	.byte	0x4
+	.uleb128 .LBB33-.LBB33
+	.uleb128 .LBE33-.LBB33
+	.byte	0x4
+	.uleb128 .LBB36-.LBB33
+	.uleb128 .LBE36-.LBB33
+	.byte	0
+.LLRL32:
+	.byte	0x5
+	.quad	.LBB37
+	.byte	0x4
+	.uleb128 .LBB37-.LBB37
+	.uleb128 .LBE37-.LBB37
+	.byte	0x4
+	.uleb128 .LBB96-.LBB37
+	.uleb128 .LBE96-.LBB37
+	.byte	0x4
+	.uleb128 .LBB97-.LBB37
+	.uleb128 .LBE97-.LBB37
+	.byte	0
+.LLRL39:
+	.byte	0x5
+	.quad	.LBB39
+	.byte	0x4
+	.uleb128 .LBB39-.LBB39
+	.uleb128 .LBE39-.LBB39
+	.byte	0x4
+	.uleb128 .LBB74-.LBB39
+	.uleb128 .LBE74-.LBB39
+	.byte	0x4
+	.uleb128 .LBB82-.LBB39
+	.uleb128 .LBE82-.LBB39
+	.byte	0x4
+	.uleb128 .LBB84-.LBB39
+	.uleb128 .LBE84-.LBB39
+	.byte	0x4
+	.uleb128 .LBB93-.LBB39
+	.uleb128 .LBE93-.LBB39
+	.byte	0
+.LLRL45:
+	.byte	0x5
+	.quad	.LBB41
+	.byte	0x4
+	.uleb128 .LBB41-.LBB41
+	.uleb128 .LBE41-.LBB41
+	.byte	0x4
+	.uleb128 .LBB44-.LBB41
+	.uleb128 .LBE44-.LBB41
+	.byte	0
+.LLRL49:
+	.byte	0x5
+	.quad	.LBB49
+	.byte	0x4
+	.uleb128 .LBB49-.LBB49
+	.uleb128 .LBE49-.LBB49
+	.byte	0x4
+	.uleb128 .LBB54-.LBB49
+	.uleb128 .LBE54-.LBB49
+	.byte	0
+.LLRL50:
+	.byte	0x5
+	.quad	.LBB55
+	.byte	0x4
+	.uleb128 .LBB55-.LBB55
+	.uleb128 .LBE55-.LBB55
+	.byte	0x4
+	.uleb128 .LBB59-.LBB55
+	.uleb128 .LBE59-.LBB55
+	.byte	0x4
+	.uleb128 .LBB64-.LBB55
+	.uleb128 .LBE64-.LBB55
+	.byte	0
+.LLRL51:
+	.byte	0x5
+	.quad	.LBB60
+	.byte	0x4
+	.uleb128 .LBB60-.LBB60
+	.uleb128 .LBE60-.LBB60
+	.byte	0x4
+	.uleb128 .LBB65-.LBB60
+	.uleb128 .LBE65-.LBB60
+	.byte	0x4
+	.uleb128 .LBB66-.LBB60
+	.uleb128 .LBE66-.LBB60
+	.byte	0
+.LLRL58:
+	.byte	0x5
+	.quad	.LBB67
+	.byte	0x4
+	.uleb128 .LBB67-.LBB67
+	.uleb128 .LBE67-.LBB67
+	.byte	0x4
+	.uleb128 .LBB68-.LBB67
+	.uleb128 .LBE68-.LBB67
+	.byte	0x4
+	.uleb128 .LBB73-.LBB67
+	.uleb128 .LBE73-.LBB67
+	.byte	0
+.LLRL64:
+	.byte	0x5
+	.quad	.LBB71
+	.byte	0x4
+	.uleb128 .LBB71-.LBB71
+	.uleb128 .LBE71-.LBB71
+	.byte	0x4
+	.uleb128 .LBB72-.LBB71
+	.uleb128 .LBE72-.LBB71
+	.byte	0
+.LLRL67:
+	.byte	0x5
+	.quad	.LBB75
+	.byte	0x4
+	.uleb128 .LBB75-.LBB75
+	.uleb128 .LBE75-.LBB75
+	.byte	0x4
+	.uleb128 .LBB83-.LBB75
+	.uleb128 .LBE83-.LBB75
+	.byte	0x4
+	.uleb128 .LBB85-.LBB75
+	.uleb128 .LBE85-.LBB75
+	.byte	0x4
+	.uleb128 .LBB90-.LBB75
+	.uleb128 .LBE90-.LBB75
+	.byte	0
+.LLRL68:
+	.byte	0x5
+	.quad	.LBB86
+	.byte	0x4
+	.uleb128 .LBB86-.LBB86
+	.uleb128 .LBE86-.LBB86
+	.byte	0x4
+	.uleb128 .LBB91-.LBB86
+	.uleb128 .LBE91-.LBB86
+	.byte	0x4
+	.uleb128 .LBB92-.LBB86
+	.uleb128 .LBE92-.LBB86
+	.byte	0
+.LLRL72:
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB8
+	.uleb128 .LFE8-.LFB8
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 36 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 41 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2a
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1000
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1027
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 50 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.file 51 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 52 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1157
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x4
+	.file 53 ".//src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1165
+	.byte	0x4
+	.file 54 ".//src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1178
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF992
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1029
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1056
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1120
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1130
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1149
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1156
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1161
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.99147b604c3c17d87d371a4dbbfdb583,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1164
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1174
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1177
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1174:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1430:
+	.string	"calculateThrottleAngleScale"
+.LASF1195:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF793:
+	.string	"__DECL_SIMD_atan "
+.LASF751:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1364:
+	.string	"atan2_approx"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF963:
+	.string	"__DECL_SIMD_asinh "
+.LASF1003:
+	.string	"__HAVE_FLOAT64 1"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1314:
+	.string	"errorVelocityI"
+.LASF1072:
+	.string	"__MATHCALL"
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF961:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1283:
+	.string	"FIXED_WING"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1175:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF854:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1096:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1041:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1170:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF849:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF815:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1204:
+	.string	"PIDPITCH"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF883:
+	.string	"__DECL_SIMD_atan2 "
+.LASF775:
+	.string	"__DECL_SIMD_powl "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF837:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF784:
+	.string	"__DECL_SIMD_acosf "
+.LASF834:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF807:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1111:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1196:
+	.string	"int16_t"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1139:
+	.string	"USE_ACC_SITL "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF924:
+	.string	"__DECL_SIMD_atanhf "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1143:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF778:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1221:
+	.string	"AI_PITCH"
+.LASF1120:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1351:
+	.string	"imuFilterInitialised"
+.LASF851:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1350:
+	.string	"imuFilterSamplePeriod"
+.LASF1287:
+	.string	"MULTITYPE_QUADX"
+.LASF802:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1127:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1137:
+	.string	"USE_GYRO_SITL "
+.LASF1178:
+	.string	"TRICOPTER_YAW_GYRO_LPF_HZ 23"
+.LASF1002:
+	.string	"__HAVE_FLOAT32 1"
+.LASF783:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF794:
+	.string	"__DECL_SIMD_atanf "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1201:
+	.string	"state"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF472:
+	.string	"__P(args) args"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1110:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1153:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1240:
+	.string	"pitchDeciDegrees"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1301:
+	.string	"MULTITYPE_VTAIL4"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF770:
+	.string	"__DECL_SIMD_expf32x "
+.LASF926:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1288:
+	.string	"MULTITYPE_BI"
+.LASF1365:
+	.string	"pt1FilterInit"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1229:
+	.string	"roll"
+.LASF1406:
+	.string	"sinePitch"
+.LASF1114:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF990:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1086:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF984:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1297:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF791:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1354:
+	.string	"applyDeadband"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1031:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1203:
+	.string	"PIDROLL"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1239:
+	.string	"rollDeciDegrees"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1210:
+	.string	"PIDLEVEL"
+.LASF745:
+	.string	"__DECL_SIMD_sincosl "
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF761:
+	.string	"__DECL_SIMD_logf64x "
+.LASF916:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1084:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1046:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF782:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF715:
+	.string	"NULL"
+.LASF1129:
+	.string	"U_ID_1 0"
+.LASF1161:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1404:
+	.string	"sineRoll"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1247:
+	.string	"accADC"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1088:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1104:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1273:
+	.string	"accDeadband_s"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1171:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF850:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1036:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1272:
+	.string	"magADC"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1408:
+	.string	"rotateV"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1193:
+	.string	"long int"
+.LASF1256:
+	.string	"SENSOR_BARO"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1029:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1071:
+	.string	"__MATHDECL"
+.LASF1338:
+	.string	"magneticDeclination"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1100:
+	.string	"MATH_ERREXCEPT 2"
+.LASF863:
+	.string	"__DECL_SIMD_sinh "
+.LASF1275:
+	.string	"OK_TO_ARM"
+.LASF953:
+	.string	"__DECL_SIMD_tanh "
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1252:
+	.string	"AltHold"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1205:
+	.string	"PIDYAW"
+.LASF1121:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1045:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF835:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1048:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF813:
+	.string	"__DECL_SIMD_hypot "
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1182:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF847:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF869:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF914:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1051:
+	.string	"_Mdouble_ float"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1095:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1289:
+	.string	"MULTITYPE_GIMBAL"
+.LASF1394:
+	.string	"head"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF725:
+	.string	"__DECL_SIMD_cosl "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1218:
+	.string	"dterm_lpf_hz"
+.LASF1070:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1013:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF755:
+	.string	"__DECL_SIMD_logl "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF902:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF939:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF844:
+	.string	"__DECL_SIMD_coshf "
+.LASF1427:
+	.string	"mixerConfiguration"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1015:
+	.string	"__f64(x) x ##f64"
+.LASF1098:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1159:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1185:
+	.string	"signed char"
+.LASF904:
+	.string	"__DECL_SIMD_log2f "
+.LASF1198:
+	.string	"uint8_t"
+.LASF1421:
+	.string	"normalizeV"
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1017:
+	.string	"__f64x(x) x ##f64x"
+.LASF1432:
+	.string	"configureImu"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1278:
+	.string	"armingFlags"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF786:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1263:
+	.string	"sensorReadFuncPtr"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1268:
+	.string	"scale"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1145:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF898:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1054:
+	.string	"_Mdouble_ long double"
+.LASF1181:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1393:
+	.string	"headingRad"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF763:
+	.string	"__DECL_SIMD_exp "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1407:
+	.string	"acc_calc"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1146:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1439:
+	.string	"micros"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1433:
+	.string	"throttle_correction_angle"
+.LASF1298:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF1047:
+	.string	"_Mdouble_"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1151:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1401:
+	.string	"sineYaw"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1119:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1023:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1299:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1026:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1343:
+	.string	"_Bool"
+.LASF812:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1164:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1372:
+	.string	"cosZ"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1389:
+	.string	"updateInclination"
+.LASF1371:
+	.string	"cosf"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1213:
+	.string	"PID_ITEM_COUNT"
+.LASF1194:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF999:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1367:
+	.string	"updateAccelerationReadings"
+.LASF1271:
+	.string	"gyro"
+.LASF1411:
+	.string	"cosx"
+.LASF1413:
+	.string	"cosy"
+.LASF1415:
+	.string	"cosz"
+.LASF788:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1035:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF694:
+	.string	"__need_size_t "
+.LASF884:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1361:
+	.string	"mahonyUpdate"
+.LASF1094:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF903:
+	.string	"__DECL_SIMD_log2 "
+.LASF374:
+	.string	"__unix 1"
+.LASF1217:
+	.string	"H_level"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1286:
+	.string	"MULTITYPE_QUADP"
+.LASF1190:
+	.string	"__uint16_t"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF734:
+	.string	"__DECL_SIMD_sinf "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF985:
+	.string	"__DECL_SIMD_tanl "
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1304:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1134:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1089:
+	.string	"FP_INFINITE 1"
+.LASF1381:
+	.string	"deltaGyroAngle"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1339:
+	.string	"gyroScaleRad"
+.LASF839:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF789:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF829:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1412:
+	.string	"sinx"
+.LASF1414:
+	.string	"siny"
+.LASF1416:
+	.string	"sinz"
+.LASF727:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1276:
+	.string	"PREVENT_ARMING"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1223:
+	.string	"FD_PITCH"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1018:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1319:
+	.string	"accSumCount"
+.LASF1106:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1337:
+	.string	"fc_acc"
+.LASF1090:
+	.string	"FP_ZERO 2"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1125:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF1208:
+	.string	"PIDPOSR"
+.LASF1428:
+	.string	"calculateAccZLowPassFilterRCTimeConstant"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF1317:
+	.string	"altHoldThrottleAdjustment"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1116:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1131:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF767:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1091:
+	.string	"FP_SUBNORMAL 3"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1424:
+	.string	"invLength"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1167:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1355:
+	.string	"invSqrt_approx"
+.LASF1362:
+	.string	"mahonyAlignToAccelerometer"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1158:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF801:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1057:
+	.string	"_Mdouble_ _Float32"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF909:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1034:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF975:
+	.string	"__DECL_SIMD_erfcl "
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF390:
+	.string	"bool _Bool"
+.LASF713:
+	.string	"__size_t "
+.LASF1234:
+	.string	"rollAndPitchTrims_s"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1135:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF797:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF925:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1024:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1316:
+	.string	"setVelocity"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF811:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF910:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1043:
+	.string	"_Mdouble_ double"
+.LASF1335:
+	.string	"smallAngle"
+.LASF957:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1279:
+	.string	"GPS_FIX_HOME"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1066:
+	.string	"_Mdouble_ _Float64x"
+.LASF739:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF974:
+	.string	"__DECL_SIMD_erfcf "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1152:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF915:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF781:
+	.string	"__DECL_SIMD_powf64x "
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF1238:
+	.string	"rollAndPitchInclination_s"
+.LASF1242:
+	.string	"rollAndPitchInclination_t"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF768:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF803:
+	.string	"__DECL_SIMD_asin "
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1056:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1249:
+	.string	"accSum"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1169:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF852:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF824:
+	.string	"__DECL_SIMD_exp2f "
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1154:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF905:
+	.string	"__DECL_SIMD_log2l "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF929:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1423:
+	.string	"lengthSquared"
+.LASF1027:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF855:
+	.string	"__DECL_SIMD_expm1l "
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1246:
+	.string	"gyroADC"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1429:
+	.string	"accz_lpf_cutoff"
+.LASF1184:
+	.string	"long unsigned int"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF1441:
+	.string	"calculateThrottleAngleCorrection"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1403:
+	.string	"cosineRoll"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF732:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF780:
+	.string	"__DECL_SIMD_powf32x "
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF833:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1260:
+	.string	"SENSOR_GPSMAG"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1417:
+	.string	"coszcosx"
+.LASF1093:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF729:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF777:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1130:
+	.string	"U_ID_2 0"
+.LASF934:
+	.string	"__DECL_SIMD_acoshf "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1431:
+	.string	"updateImuFilters"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1197:
+	.string	"int32_t"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1405:
+	.string	"cosinePitch"
+.LASF1225:
+	.string	"fp_vector"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1309:
+	.string	"integralX"
+.LASF1310:
+	.string	"integralY"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1037:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1085:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1097:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1296:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF1207:
+	.string	"PIDPOS"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1224:
+	.string	"FD_YAW"
+.LASF1391:
+	.string	"calculateHeading"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1155:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1124:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1140:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1336:
+	.string	"throttleAngleScale"
+.LASF1241:
+	.string	"rollAndPitchInclination_t_def"
+.LASF1387:
+	.string	"useAcc"
+.LASF1373:
+	.string	"angle"
+.LASF874:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF991:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF992:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF754:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF894:
+	.string	"__DECL_SIMD_log10f "
+.LASF1172:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1281:
+	.string	"CALIBRATE_MAG"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF983:
+	.string	"__DECL_SIMD_tan "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1105:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1117:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1329:
+	.string	"attitude_estimator"
+.LASF895:
+	.string	"__DECL_SIMD_log10l "
+.LASF885:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1069:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1342:
+	.string	"mahonyAligned"
+.LASF1382:
+	.string	"invGyroComplimentaryFilterFactor"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF773:
+	.string	"__DECL_SIMD_pow "
+.LASF1353:
+	.string	"acos_approx"
+.LASF1019:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF735:
+	.string	"__DECL_SIMD_sinl "
+.LASF1419:
+	.string	"coszsinx"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1425:
+	.string	"computeIMU"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1326:
+	.string	"acc_unarmedcal"
+.LASF1108:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1192:
+	.string	"__uint32_t"
+.LASF959:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1068:
+	.string	"__MATHDECL_1_IMPL"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1103:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1107:
+	.string	"M_PI 3.14159265358979323846"
+.LASF873:
+	.string	"__DECL_SIMD_cbrt "
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1039:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF825:
+	.string	"__DECL_SIMD_exp2l "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF723:
+	.string	"__DECL_SIMD_cos "
+.LASF1285:
+	.string	"MULTITYPE_TRI"
+.LASF1012:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1327:
+	.string	"gyro_cmpf_factor"
+.LASF1254:
+	.string	"SENSOR_GYRO"
+.LASF1434:
+	.string	"initialImuRuntimeConfig"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1359:
+	.string	"mahonyGetPitch"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1323:
+	.string	"ATTITUDE_ESTIMATOR_COUNT"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1180:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1237:
+	.string	"rollAndPitchTrims_t"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1375:
+	.string	"accMag"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1328:
+	.string	"gyro_cmpfm_factor"
+.LASF804:
+	.string	"__DECL_SIMD_asinf "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1368:
+	.string	"sensors"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1379:
+	.string	"currentT"
+.LASF1265:
+	.string	"init"
+.LASF462:
+	.string	"__PMT"
+.LASF1078:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1284:
+	.string	"stateFlags"
+.LASF933:
+	.string	"__DECL_SIMD_acosh "
+.LASF964:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF900:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1318:
+	.string	"accTimeSum"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1061:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF998:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1322:
+	.string	"ATTITUDE_ESTIMATOR_QUATERNION"
+.LASF1300:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF1020:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1160:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1302:
+	.string	"MULTITYPE_HEX6H"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF853:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1233:
+	.string	"fp_angles_t"
+.LASF1294:
+	.string	"MULTITYPE_HEX6X"
+.LASF919:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1064:
+	.string	"_Mdouble_ _Float32x"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1266:
+	.string	"read"
+.LASF1261:
+	.string	"acc_1G"
+.LASF994:
+	.string	"__HAVE_FLOAT128 1"
+.LASF897:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1183:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1390:
+	.string	"updateSmallAngleState"
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1348:
+	.string	"accFilter"
+.LASF1370:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1042:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF989:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1118:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF988:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1122:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1418:
+	.string	"sinzcosx"
+.LASF893:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF769:
+	.string	"__DECL_SIMD_expf128 "
+.LASF908:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1209:
+	.string	"PIDNAVR"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF896:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF774:
+	.string	"__DECL_SIMD_powf "
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1227:
+	.string	"t_fp_vector"
+.LASF1168:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1052:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF391:
+	.string	"true 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1231:
+	.string	"fp_angles_def"
+.LASF1410:
+	.string	"v_tmp"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF776:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1138:
+	.string	"ACC "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF736:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1325:
+	.string	"acc_lpf_hz"
+.LASF1150:
+	.string	"sq(x) ((x)*(x))"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1262:
+	.string	"sensorInitFuncPtr"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1083:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1280:
+	.string	"GPS_FIX"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1303:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF956:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1176:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1255:
+	.string	"SENSOR_ACC"
+.LASF740:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1005:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1215:
+	.string	"pidProfile_s"
+.LASF1219:
+	.string	"pidProfile_t"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1388:
+	.string	"useMag"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF935:
+	.string	"__DECL_SIMD_acoshl "
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF822:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF546:
+	.string	"__stub_revoke "
+.LASF1157:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1245:
+	.string	"gyroZero"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF765:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF948:
+	.string	"__DECL_SIMD_erff64 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF759:
+	.string	"__DECL_SIMD_logf128 "
+.LASF779:
+	.string	"__DECL_SIMD_powf128 "
+.LASF906:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF911:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1253:
+	.string	"vario"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF947:
+	.string	"__DECL_SIMD_erff32 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF809:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF1377:
+	.string	"EstN"
+.LASF1306:
+	.string	"MULTITYPE_CUSTOM"
+.LASF742:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF828:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1147:
+	.string	"BLACKBOX "
+.LASF917:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1136:
+	.string	"GYRO "
+.LASF753:
+	.string	"__DECL_SIMD_log "
+.LASF785:
+	.string	"__DECL_SIMD_acosl "
+.LASF1420:
+	.string	"sinzsinx"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1113:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1270:
+	.string	"gyro_t"
+.LASF1435:
+	.string	"initialPidProfile"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1438:
+	.string	"MultiType"
+.LASF997:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1258:
+	.string	"SENSOR_SONAR"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF899:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF756:
+	.string	"__DECL_SIMD_logf16 "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF986:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1186:
+	.string	"__int8_t"
+.LASF1212:
+	.string	"PIDVEL"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1206:
+	.string	"PIDALT"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1313:
+	.string	"mahonyEstimator_t"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1222:
+	.string	"FD_ROLL"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1396:
+	.string	"accZoffset"
+.LASF954:
+	.string	"__DECL_SIMD_tanhf "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF379:
+	.string	"SITL 1"
+.LASF796:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1128:
+	.string	"U_ID_0 0x5349544c"
+.LASF1199:
+	.string	"uint16_t"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1331:
+	.string	"dcm_ki"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1087:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1330:
+	.string	"dcm_kp"
+.LASF1214:
+	.string	"pt1Filter_s"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF901:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF805:
+	.string	"__DECL_SIMD_asinl "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1115:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF865:
+	.string	"__DECL_SIMD_sinhl "
+.LASF887:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1409:
+	.string	"delta"
+.LASF1264:
+	.string	"gyro_s"
+.LASF808:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1347:
+	.string	"accDeadband"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1040:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1395:
+	.string	"throttle_correction_value"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1038:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1312:
+	.string	"rMat"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1334:
+	.string	"targetPidLooptime"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF823:
+	.string	"__DECL_SIMD_exp2 "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1385:
+	.string	"getEstimatedAttitudeQuaternion"
+.LASF1126:
+	.string	"__disable_irq() "
+.LASF1277:
+	.string	"ARMED"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1437:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1211:
+	.string	"PIDMAG"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF965:
+	.string	"__DECL_SIMD_asinhl "
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1187:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF731:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF945:
+	.string	"__DECL_SIMD_erfl "
+.LASF1250:
+	.string	"heading"
+.LASF1341:
+	.string	"mahonyEstimator"
+.LASF1251:
+	.string	"EstAlt"
+.LASF1374:
+	.string	"axis"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF722:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF744:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1188:
+	.string	"__int16_t"
+.LASF1109:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1384:
+	.string	"getEstimatedAttitude"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1267:
+	.string	"temperature"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF764:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF726:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1422:
+	.string	"dest"
+.LASF952:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1058:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF993:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF792:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1162:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1149:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1269:
+	.string	"samplePeriod"
+.LASF1236:
+	.string	"values"
+.LASF944:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1363:
+	.string	"sqrtf"
+.LASF1244:
+	.string	"gyroData"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1357:
+	.string	"cos_approx"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1380:
+	.string	"deltaT"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF766:
+	.string	"__DECL_SIMD_expf16 "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1392:
+	.string	"headingFromRadians"
+.LASF1291:
+	.string	"MULTITYPE_HEX6"
+.LASF1092:
+	.string	"FP_NORMAL 4"
+.LASF1346:
+	.string	"pidProfile"
+.LASF1232:
+	.string	"angles"
+.LASF1399:
+	.string	"rotateRotationMatrixAroundZ"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1022:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1000:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1166:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1004:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1014:
+	.string	"__f32(x) x ##f32"
+.LASF1443:
+	.string	"imuInit"
+.LASF1248:
+	.string	"accSmooth"
+.LASF1311:
+	.string	"integralZ"
+.LASF996:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF724:
+	.string	"__DECL_SIMD_cosf "
+.LASF747:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1141:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1055:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF737:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1156:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF923:
+	.string	"__DECL_SIMD_atanh "
+.LASF1340:
+	.string	"gyroScaleRadPerSecond"
+.LASF1062:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1189:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1101:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF943:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF771:
+	.string	"__DECL_SIMD_expf64x "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1397:
+	.string	"accz_smooth"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1305:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF1290:
+	.string	"MULTITYPE_Y6"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF949:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF845:
+	.string	"__DECL_SIMD_coshl "
+.LASF814:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1133:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1274:
+	.string	"accDeadband_t"
+.LASF1220:
+	.string	"AI_ROLL"
+.LASF1320:
+	.string	"accVelScale"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1259:
+	.string	"SENSOR_GPS"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF848:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF1386:
+	.string	"gyroRate"
+.LASF1426:
+	.string	"accelerometerTrims"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF772:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF1307:
+	.string	"MULTITYPE_LAST"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1402:
+	.string	"computeTiltRotationMatrix"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF973:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF721:
+	.string	"_MATH_H 1"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF946:
+	.string	"__DECL_SIMD_erff16 "
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF738:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1016:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1366:
+	.string	"pt1FilterApply"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF951:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1442:
+	.string	"accSum_reset"
+.LASF758:
+	.string	"__DECL_SIMD_logf64 "
+.LASF891:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF798:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF746:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1028:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF843:
+	.string	"__DECL_SIMD_cosh "
+.LASF886:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1356:
+	.string	"sin_approx"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1400:
+	.string	"cosineYaw"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1243:
+	.string	"inclination"
+.LASF1398:
+	.string	"accel_ned"
+.LASF1369:
+	.string	"mahonyReset"
+.LASF995:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1163:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF955:
+	.string	"__DECL_SIMD_tanhl "
+.LASF806:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF799:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF810:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF913:
+	.string	"__DECL_SIMD_log1p "
+.LASF1436:
+	.string	"initialAccDeadband"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF857:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF846:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1001:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1200:
+	.string	"uint32_t"
+.LASF800:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF743:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1332:
+	.string	"small_angle"
+.LASF1295:
+	.string	"MULTITYPE_OCTOX8"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1308:
+	.string	"mahonyEstimator_s"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF907:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF987:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1032:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1282:
+	.string	"SMALL_ANGLE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1358:
+	.string	"mahonyGetYaw"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF969:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF733:
+	.string	"__DECL_SIMD_sin "
+.LASF1033:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF787:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF741:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1228:
+	.string	"fp_angles"
+.LASF1179:
+	.string	"float"
+.LASF1226:
+	.string	"t_fp_vector_def"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1060:
+	.string	"_Mdouble_ _Float64"
+.LASF1230:
+	.string	"pitch"
+.LASF1352:
+	.string	"EstG"
+.LASF1173:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1132:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1216:
+	.string	"A_level"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1376:
+	.string	"EstM"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1099:
+	.string	"MATH_ERRNO 1"
+.LASF1324:
+	.string	"imuRuntimeConfig_s"
+.LASF1333:
+	.string	"imuRuntimeConfig_t"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1165:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1360:
+	.string	"mahonyGetRoll"
+.LASF1315:
+	.string	"velocityControl"
+.LASF795:
+	.string	"__DECL_SIMD_atanl "
+.LASF757:
+	.string	"__DECL_SIMD_logf32 "
+.LASF950:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1235:
+	.string	"rollAndPitchTrims_t_def"
+.LASF730:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1044:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1191:
+	.string	"__int32_t"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1344:
+	.string	"anglerad"
+.LASF864:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1142:
+	.string	"USE_USART1 "
+.LASF1021:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1321:
+	.string	"ATTITUDE_ESTIMATOR_COMPLEMENTARY"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1383:
+	.string	"invGyroComplimentaryFilter_M_Factor"
+.LASF1112:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF790:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF760:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1030:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1177:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1063:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1257:
+	.string	"SENSOR_MAG"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF1349:
+	.string	"triYawGyroFilter"
+.LASF1202:
+	.string	"pt1Filter_t"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1378:
+	.string	"previousT"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1102:
+	.string	"M_E 2.7182818284590452354"
+.LASF1292:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF1293:
+	.string	"MULTITYPE_Y4"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1148:
+	.string	"PROFILING "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1345:
+	.string	"imuRuntimeConfig"
+.LASF1440:
+	.string	"gyroGetADC"
+.LASF1123:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF728:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1144:
+	.string	"SERIAL_PORT_COUNT 2"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/flight/imu.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10683 @@
+	.file	"mahony.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/flight/mahony.c"
+	.section	.text.mahonyComputeRotationMatrix,"ax",@progbits
+	.p2align 4
+	.type	mahonyComputeRotationMatrix, @function
+mahonyComputeRotationMatrix:
+.LVL0:
+.LFB0:
+	.file 1 ".//src/main/flight/mahony.c"
+	.loc 1 31 1 view -0
+	.cfi_startproc
+	.loc 1 32 5 view .LVU1
+	.loc 1 32 27 is_stmt 0 view .LVU2
+	movss	4(%rdi), %xmm1
+.LVL1:
+	.loc 1 33 5 is_stmt 1 view .LVU3
+	.loc 1 33 27 is_stmt 0 view .LVU4
+	movss	8(%rdi), %xmm0
+.LVL2:
+	.loc 1 34 5 is_stmt 1 view .LVU5
+	.loc 1 34 27 is_stmt 0 view .LVU6
+	movss	12(%rdi), %xmm2
+.LVL3:
+	.loc 1 36 5 is_stmt 1 view .LVU7
+	.loc 1 36 27 is_stmt 0 view .LVU8
+	movss	(%rdi), %xmm8
+	.loc 1 36 11 view .LVU9
+	movaps	%xmm1, %xmm4
+	.loc 1 37 11 view .LVU10
+	movaps	%xmm0, %xmm6
+	.loc 1 40 11 view .LVU11
+	movaps	%xmm1, %xmm7
+	.loc 1 36 11 view .LVU12
+	mulss	%xmm8, %xmm4
+.LVL4:
+	.loc 1 37 5 is_stmt 1 view .LVU13
+	.loc 1 41 11 is_stmt 0 view .LVU14
+	movaps	%xmm0, %xmm5
+	.loc 1 39 11 view .LVU15
+	movaps	%xmm1, %xmm9
+	.loc 1 37 11 view .LVU16
+	mulss	%xmm8, %xmm6
+.LVL5:
+	.loc 1 38 5 is_stmt 1 view .LVU17
+	.loc 1 40 11 is_stmt 0 view .LVU18
+	mulss	%xmm2, %xmm7
+	.loc 1 38 11 view .LVU19
+	mulss	%xmm2, %xmm8
+.LVL6:
+	.loc 1 39 5 is_stmt 1 view .LVU20
+	.loc 1 41 11 is_stmt 0 view .LVU21
+	mulss	%xmm2, %xmm5
+	.loc 1 34 11 view .LVU22
+	mulss	%xmm2, %xmm2
+.LVL7:
+	.loc 1 32 11 view .LVU23
+	mulss	%xmm1, %xmm1
+.LVL8:
+	.loc 1 39 11 view .LVU24
+	mulss	%xmm0, %xmm9
+.LVL9:
+	.loc 1 40 5 is_stmt 1 view .LVU25
+	.loc 1 41 5 view .LVU26
+	.loc 1 43 5 view .LVU27
+	.loc 1 33 11 is_stmt 0 view .LVU28
+	mulss	%xmm0, %xmm0
+.LVL10:
+	.loc 1 43 55 view .LVU29
+	movaps	%xmm2, %xmm3
+	addss	%xmm2, %xmm3
+	.loc 1 44 5 is_stmt 1 view .LVU30
+	.loc 1 45 5 view .LVU31
+	.loc 1 47 5 view .LVU32
+	.loc 1 48 5 view .LVU33
+	.loc 1 48 41 is_stmt 0 view .LVU34
+	movaps	%xmm1, %xmm2
+.LVL11:
+	.loc 1 48 41 view .LVU35
+	addss	%xmm1, %xmm2
+	.loc 1 48 34 view .LVU36
+	movss	.LC0(%rip), %xmm1
+.LVL12:
+	.loc 1 43 41 view .LVU37
+	addss	%xmm0, %xmm0
+.LVL13:
+	.loc 1 48 34 view .LVU38
+	movaps	%xmm1, %xmm10
+	subss	%xmm2, %xmm10
+	.loc 1 49 5 is_stmt 1 view .LVU39
+	.loc 1 51 5 view .LVU40
+	.loc 1 52 5 view .LVU41
+	.loc 1 44 42 is_stmt 0 view .LVU42
+	movaps	%xmm9, %xmm2
+	subss	%xmm8, %xmm2
+	.loc 1 43 34 view .LVU43
+	subss	%xmm0, %xmm1
+	.loc 1 47 42 view .LVU44
+	addss	%xmm9, %xmm8
+.LVL14:
+	.loc 1 44 34 view .LVU45
+	addss	%xmm2, %xmm2
+	.loc 1 43 48 view .LVU46
+	subss	%xmm3, %xmm1
+	.loc 1 47 34 view .LVU47
+	addss	%xmm8, %xmm8
+	.loc 1 44 34 view .LVU48
+	movaps	%xmm2, %xmm11
+	.loc 1 45 42 view .LVU49
+	movaps	%xmm6, %xmm2
+	addss	%xmm7, %xmm2
+	.loc 1 43 27 view .LVU50
+	unpcklps	%xmm11, %xmm1
+	.loc 1 51 42 view .LVU51
+	subss	%xmm6, %xmm7
+.LVL15:
+	.loc 1 45 34 view .LVU52
+	addss	%xmm2, %xmm2
+	.loc 1 43 27 view .LVU53
+	unpcklps	%xmm8, %xmm2
+	movlhps	%xmm2, %xmm1
+	.loc 1 48 48 view .LVU54
+	movaps	%xmm10, %xmm2
+	.loc 1 53 48 view .LVU55
+	subss	%xmm0, %xmm10
+	.loc 1 43 27 view .LVU56
+	movups	%xmm1, 28(%rdi)
+	.loc 1 49 42 view .LVU57
+	movaps	%xmm5, %xmm1
+	.loc 1 48 48 view .LVU58
+	subss	%xmm3, %xmm2
+	.loc 1 49 42 view .LVU59
+	subss	%xmm4, %xmm1
+	.loc 1 52 42 view .LVU60
+	addss	%xmm5, %xmm4
+.LVL16:
+	.loc 1 53 27 view .LVU61
+	movss	%xmm10, 60(%rdi)
+	.loc 1 49 34 view .LVU62
+	movaps	%xmm1, %xmm3
+	.loc 1 52 34 view .LVU63
+	addss	%xmm4, %xmm4
+	.loc 1 49 34 view .LVU64
+	addss	%xmm1, %xmm3
+	.loc 1 51 42 view .LVU65
+	movaps	%xmm7, %xmm1
+	.loc 1 51 34 view .LVU66
+	addss	%xmm7, %xmm1
+	.loc 1 43 27 view .LVU67
+	unpcklps	%xmm3, %xmm2
+	unpcklps	%xmm4, %xmm1
+	movlhps	%xmm1, %xmm2
+	movups	%xmm2, 44(%rdi)
+	.loc 1 53 5 is_stmt 1 view .LVU68
+	.loc 1 54 1 is_stmt 0 view .LVU69
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	mahonyComputeRotationMatrix, .-mahonyComputeRotationMatrix
+	.section	.text.mahonyReset,"ax",@progbits
+	.p2align 4
+	.globl	mahonyReset
+	.type	mahonyReset, @function
+mahonyReset:
+.LVL17:
+.LFB1:
+	.loc 1 57 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 58 5 view .LVU71
+	.loc 1 59 5 view .LVU72
+	.loc 1 60 5 view .LVU73
+	.loc 1 61 5 view .LVU74
+	.loc 1 63 5 view .LVU75
+	.loc 1 64 5 view .LVU76
+	.loc 1 65 5 view .LVU77
+	.loc 1 67 5 view .LVU78
+	.loc 1 58 19 is_stmt 0 view .LVU79
+	movss	.LC1(%rip), %xmm0
+	movups	%xmm0, (%rdi)
+	movaps	.LC2(%rip), %xmm0
+	movups	%xmm0, 16(%rdi)
+	movups	%xmm0, 32(%rdi)
+	movups	%xmm0, 48(%rdi)
+.LVL18:
+	.loc 1 68 1 view .LVU80
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	mahonyReset, .-mahonyReset
+	.section	.text.mahonyAlignToAccelerometer,"ax",@progbits
+	.p2align 4
+	.globl	mahonyAlignToAccelerometer
+	.type	mahonyAlignToAccelerometer, @function
+mahonyAlignToAccelerometer:
+.LVL19:
+.LFB2:
+	.loc 1 75 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 76 5 view .LVU82
+	.loc 1 75 1 is_stmt 0 view .LVU83
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 76 29 view .LVU84
+	movss	4(%rsi), %xmm2
+	movss	8(%rsi), %xmm1
+	movaps	%xmm2, %xmm0
+	movss	%xmm1, 16(%rsp)
+	movss	%xmm2, 12(%rsp)
+	call	atan2f@PLT
+.LVL20:
+	.loc 1 77 59 view .LVU85
+	movss	12(%rsp), %xmm2
+	.loc 1 77 77 view .LVU86
+	movss	16(%rsp), %xmm1
+	.loc 1 76 11 view .LVU87
+	movss	.LC3(%rip), %xmm3
+	.loc 1 77 59 view .LVU88
+	mulss	%xmm2, %xmm2
+	.loc 1 77 77 view .LVU89
+	mulss	%xmm1, %xmm1
+	.loc 1 76 11 view .LVU90
+	mulss	%xmm0, %xmm3
+.LVL21:
+	.loc 1 77 5 is_stmt 1 view .LVU91
+	pxor	%xmm0, %xmm0
+	.loc 1 77 30 is_stmt 0 view .LVU92
+	addss	%xmm2, %xmm1
+	ucomiss	%xmm1, %xmm0
+	ja	.L9
+	sqrtss	%xmm1, %xmm1
+.LVL22:
+.L7:
+	.loc 1 77 30 view .LVU93
+	leaq	28(%rsp), %r12
+	leaq	24(%rsp), %r13
+	movaps	%xmm3, %xmm0
+	movss	%xmm1, 20(%rsp)
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	sincosf@PLT
+.LVL23:
+	movss	0(%rbp), %xmm0
+	movss	24(%rsp), %xmm2
+	movss	.LC5(%rip), %xmm5
+	movss	28(%rsp), %xmm3
+	movss	20(%rsp), %xmm1
+	xorps	%xmm5, %xmm0
+	movss	%xmm2, 16(%rsp)
+	movss	%xmm3, 12(%rsp)
+	call	atan2f@PLT
+.LVL24:
+	.loc 1 77 11 view .LVU94
+	mulss	.LC3(%rip), %xmm0
+	movq	%r12, %rdi
+	movq	%r13, %rsi
+	call	sincosf@PLT
+.LVL25:
+	.loc 1 86 32 view .LVU95
+	movss	16(%rsp), %xmm2
+	.loc 1 91 5 view .LVU96
+	movq	%rbx, %rdi
+	movss	24(%rsp), %xmm1
+	.loc 1 87 30 view .LVU97
+	movss	12(%rsp), %xmm3
+	movss	28(%rsp), %xmm4
+.LVL26:
+	.loc 1 78 5 is_stmt 1 view .LVU98
+	.loc 1 79 5 view .LVU99
+	.loc 1 80 5 view .LVU100
+	.loc 1 81 5 view .LVU101
+	.loc 1 83 5 view .LVU102
+.LBB8:
+.LBI8:
+	.loc 1 56 6 view .LVU103
+.LBB9:
+	.loc 1 58 5 view .LVU104
+	.loc 1 59 5 view .LVU105
+	.loc 1 60 5 view .LVU106
+	.loc 1 61 5 view .LVU107
+	.loc 1 63 5 view .LVU108
+	.loc 1 64 5 view .LVU109
+.LBE9:
+.LBE8:
+	.loc 1 89 21 is_stmt 0 view .LVU110
+	movss	.LC5(%rip), %xmm5
+.LBB12:
+.LBB10:
+	.loc 1 63 26 view .LVU111
+	movq	$0, 16(%rbx)
+	.loc 1 65 5 is_stmt 1 view .LVU112
+.LBE10:
+.LBE12:
+	.loc 1 86 32 is_stmt 0 view .LVU113
+	movaps	%xmm2, %xmm0
+.LBB13:
+.LBB11:
+	.loc 1 65 26 view .LVU114
+	movl	$0x00000000, 24(%rbx)
+	.loc 1 67 5 is_stmt 1 view .LVU115
+.LVL27:
+	.loc 1 67 5 is_stmt 0 view .LVU116
+.LBE11:
+.LBE13:
+	.loc 1 86 5 is_stmt 1 view .LVU117
+	.loc 1 87 5 view .LVU118
+	.loc 1 88 5 view .LVU119
+	.loc 1 89 5 view .LVU120
+	.loc 1 86 32 is_stmt 0 view .LVU121
+	mulss	%xmm1, %xmm0
+	.loc 1 87 30 view .LVU122
+	mulss	%xmm3, %xmm1
+.LVL28:
+	.loc 1 89 21 view .LVU123
+	xorps	%xmm5, %xmm3
+.LVL29:
+	.loc 1 88 32 view .LVU124
+	mulss	%xmm4, %xmm2
+.LVL30:
+	.loc 1 89 31 view .LVU125
+	mulss	%xmm4, %xmm3
+	.loc 1 86 19 view .LVU126
+	unpcklps	%xmm1, %xmm0
+	unpcklps	%xmm3, %xmm2
+	movlhps	%xmm2, %xmm0
+	movups	%xmm0, (%rbx)
+	.loc 1 91 5 is_stmt 1 view .LVU127
+	.loc 1 92 1 is_stmt 0 view .LVU128
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL31:
+	.loc 1 92 1 view .LVU129
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL32:
+	.loc 1 92 1 view .LVU130
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	.loc 1 91 5 view .LVU131
+	jmp	mahonyComputeRotationMatrix
+.LVL33:
+.L9:
+	.cfi_restore_state
+	.loc 1 77 30 view .LVU132
+	movaps	%xmm1, %xmm0
+	movss	%xmm3, 12(%rsp)
+	call	sqrtf@PLT
+.LVL34:
+	.loc 1 77 30 view .LVU133
+	movss	12(%rsp), %xmm3
+	movaps	%xmm0, %xmm1
+	jmp	.L7
+	.cfi_endproc
+.LFE2:
+	.size	mahonyAlignToAccelerometer, .-mahonyAlignToAccelerometer
+	.section	.text.mahonyUpdate,"ax",@progbits
+	.p2align 4
+	.globl	mahonyUpdate
+	.type	mahonyUpdate, @function
+mahonyUpdate:
+.LVL35:
+.LFB3:
+	.loc 1 95 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU135
+	.loc 1 95 1 is_stmt 0 view .LVU136
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movaps	%xmm0, %xmm4
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 96 11 view .LVU137
+	movss	(%rsi), %xmm5
+.LVL36:
+	.loc 1 97 5 is_stmt 1 view .LVU138
+	.loc 1 97 11 is_stmt 0 view .LVU139
+	movss	4(%rsi), %xmm6
+.LVL37:
+	.loc 1 98 5 is_stmt 1 view .LVU140
+	.loc 1 98 11 is_stmt 0 view .LVU141
+	movss	8(%rsi), %xmm8
+.LVL38:
+	.loc 1 99 5 is_stmt 1 view .LVU142
+	.loc 1 100 5 view .LVU143
+	.loc 1 101 4 view .LVU144
+	.loc 1 105 5 view .LVU145
+	.loc 1 105 8 is_stmt 0 view .LVU146
+	testq	%rcx, %rcx
+	je	.L47
+	.loc 1 105 20 discriminator 1 view .LVU147
+	movss	(%rcx), %xmm3
+	.loc 1 105 13 discriminator 1 view .LVU148
+	pxor	%xmm0, %xmm0
+.LVL39:
+	.loc 1 105 38 discriminator 1 view .LVU149
+	movss	4(%rcx), %xmm7
+	.loc 1 105 56 discriminator 1 view .LVU150
+	movss	8(%rcx), %xmm10
+	.loc 1 105 13 discriminator 1 view .LVU151
+	ucomiss	%xmm0, %xmm3
+	jp	.L15
+	jne	.L15
+	.loc 1 105 32 discriminator 2 view .LVU152
+	ucomiss	%xmm0, %xmm7
+	jp	.L15
+	jne	.L15
+	.loc 1 105 50 discriminator 3 view .LVU153
+	ucomiss	%xmm0, %xmm10
+	jp	.L15
+	jne	.L15
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 122 5 is_stmt 1 view .LVU154
+	.loc 1 122 8 is_stmt 0 view .LVU155
+	testq	%rbp, %rbp
+	je	.L49
+	.loc 1 99 33 view .LVU156
+	pxor	%xmm7, %xmm7
+	.loc 1 101 9 view .LVU157
+	xorl	%eax, %eax
+	movss	.LC5(%rip), %xmm3
+	.loc 1 99 22 view .LVU158
+	movaps	%xmm7, %xmm9
+	.loc 1 99 11 view .LVU159
+	movaps	%xmm7, %xmm10
+.LVL40:
+.L13:
+	.loc 1 122 20 discriminator 1 view .LVU160
+	movss	0(%rbp), %xmm0
+	.loc 1 122 13 discriminator 1 view .LVU161
+	pxor	%xmm13, %xmm13
+	.loc 1 122 38 discriminator 1 view .LVU162
+	movss	4(%rbp), %xmm11
+	.loc 1 122 56 discriminator 1 view .LVU163
+	movss	8(%rbp), %xmm12
+	.loc 1 122 13 discriminator 1 view .LVU164
+	ucomiss	%xmm13, %xmm0
+	jp	.L21
+	jne	.L21
+	.loc 1 122 32 discriminator 2 view .LVU165
+	ucomiss	%xmm13, %xmm11
+	jp	.L21
+	jne	.L21
+	.loc 1 122 50 discriminator 3 view .LVU166
+	ucomiss	%xmm13, %xmm12
+	jp	.L21
+	jne	.L21
+.LVL41:
+	.loc 1 134 5 is_stmt 1 view .LVU167
+	.loc 1 137 22 is_stmt 0 view .LVU168
+	movss	16(%rbx), %xmm15
+	.loc 1 148 20 view .LVU169
+	movss	20(%rbx), %xmm14
+	.loc 1 149 20 view .LVU170
+	movss	24(%rbx), %xmm13
+	.loc 1 137 22 view .LVU171
+	movaps	%xmm15, %xmm12
+	.loc 1 148 20 view .LVU172
+	movaps	%xmm14, %xmm11
+	.loc 1 149 20 view .LVU173
+	movaps	%xmm13, %xmm0
+	.loc 1 134 8 view .LVU174
+	testb	%al, %al
+	je	.L14
+	jmp	.L20
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+.LBB14:
+	.loc 1 106 9 is_stmt 1 view .LVU175
+	.loc 1 106 42 is_stmt 0 view .LVU176
+	movss	28(%rbx), %xmm0
+	.loc 1 106 75 view .LVU177
+	movss	32(%rbx), %xmm9
+	.loc 1 110 12 view .LVU178
+	pxor	%xmm11, %xmm11
+	.loc 1 106 75 view .LVU179
+	mulss	%xmm7, %xmm9
+	.loc 1 106 42 view .LVU180
+	mulss	%xmm3, %xmm0
+	.loc 1 107 42 view .LVU181
+	mulss	40(%rbx), %xmm3
+	.loc 1 107 75 view .LVU182
+	mulss	44(%rbx), %xmm7
+	.loc 1 106 51 view .LVU183
+	addss	%xmm9, %xmm0
+	.loc 1 106 108 view .LVU184
+	movss	36(%rbx), %xmm9
+	mulss	%xmm10, %xmm9
+	.loc 1 107 108 view .LVU185
+	mulss	48(%rbx), %xmm10
+	.loc 1 106 15 view .LVU186
+	addss	%xmm9, %xmm0
+.LVL43:
+	.loc 1 107 9 is_stmt 1 view .LVU187
+	.loc 1 107 42 is_stmt 0 view .LVU188
+	movaps	%xmm3, %xmm9
+	.loc 1 107 51 view .LVU189
+	addss	%xmm7, %xmm9
+	.loc 1 108 30 view .LVU190
+	mulss	%xmm0, %xmm0
+.LVL44:
+	.loc 1 107 15 view .LVU191
+	addss	%xmm10, %xmm9
+.LVL45:
+	.loc 1 108 9 is_stmt 1 view .LVU192
+	.loc 1 108 40 is_stmt 0 view .LVU193
+	movaps	%xmm9, %xmm3
+	mulss	%xmm9, %xmm3
+	.loc 1 108 15 view .LVU194
+	addss	%xmm3, %xmm0
+.LVL46:
+	.loc 1 110 9 is_stmt 1 view .LVU195
+	.loc 1 110 12 is_stmt 0 view .LVU196
+	comiss	%xmm11, %xmm0
+	jbe	.L47
+	movss	%xmm2, 36(%rsp)
+	movss	%xmm1, 32(%rsp)
+	movss	%xmm4, 28(%rsp)
+	movss	%xmm9, 24(%rsp)
+	movss	%xmm8, 20(%rsp)
+	movss	%xmm6, 16(%rsp)
+	movss	%xmm5, 12(%rsp)
+.LBB15:
+	.loc 1 111 13 is_stmt 1 view .LVU197
+	.loc 1 111 35 is_stmt 0 view .LVU198
+	call	invSqrt_approx@PLT
+.LVL47:
+	.loc 1 111 29 view .LVU199
+	movss	24(%rsp), %xmm9
+	.loc 1 113 41 view .LVU200
+	movss	52(%rbx), %xmm10
+	.loc 1 111 29 view .LVU201
+	movss	.LC5(%rip), %xmm3
+	.loc 1 113 16 view .LVU202
+	pxor	%xmm11, %xmm11
+.LBE15:
+.LBE14:
+	.loc 1 122 8 view .LVU203
+	testq	%rbp, %rbp
+	movss	12(%rsp), %xmm5
+	movss	16(%rsp), %xmm6
+.LBB20:
+.LBB16:
+	.loc 1 111 29 view .LVU204
+	movaps	%xmm9, %xmm7
+	.loc 1 114 41 view .LVU205
+	movss	56(%rbx), %xmm9
+.LBE16:
+.LBE20:
+	.loc 1 122 8 view .LVU206
+	movss	20(%rsp), %xmm8
+.LBB21:
+.LBB17:
+	.loc 1 116 28 view .LVU207
+	movl	$1, %eax
+	.loc 1 111 29 view .LVU208
+	xorps	%xmm3, %xmm7
+.LBE17:
+.LBE21:
+	.loc 1 122 8 view .LVU209
+	movss	28(%rsp), %xmm4
+	movss	32(%rsp), %xmm1
+.LBB22:
+.LBB18:
+	.loc 1 111 19 view .LVU210
+	mulss	%xmm0, %xmm7
+.LVL48:
+	.loc 1 113 13 is_stmt 1 view .LVU211
+.LBE18:
+.LBE22:
+	.loc 1 122 8 is_stmt 0 view .LVU212
+	movss	36(%rsp), %xmm2
+.LBB23:
+.LBB19:
+	.loc 1 113 41 view .LVU213
+	mulss	%xmm7, %xmm10
+	.loc 1 114 41 view .LVU214
+	mulss	%xmm7, %xmm9
+	.loc 1 115 41 view .LVU215
+	mulss	60(%rbx), %xmm7
+.LVL49:
+	.loc 1 113 16 view .LVU216
+	addss	%xmm11, %xmm10
+.LVL50:
+	.loc 1 114 13 is_stmt 1 view .LVU217
+	.loc 1 114 16 is_stmt 0 view .LVU218
+	addss	%xmm11, %xmm9
+.LVL51:
+	.loc 1 115 13 is_stmt 1 view .LVU219
+	.loc 1 115 16 is_stmt 0 view .LVU220
+	addss	%xmm11, %xmm7
+.LVL52:
+	.loc 1 116 13 is_stmt 1 view .LVU221
+	.loc 1 116 13 is_stmt 0 view .LVU222
+.LBE19:
+.LBE23:
+	.loc 1 122 5 is_stmt 1 view .LVU223
+	.loc 1 122 8 is_stmt 0 view .LVU224
+	jne	.L13
+	.loc 1 122 8 view .LVU225
+	movss	16(%rbx), %xmm15
+	movss	20(%rbx), %xmm14
+	movss	24(%rbx), %xmm13
+	jmp	.L20
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+.LBB24:
+	.loc 1 123 61 view .LVU226
+	mulss	%xmm11, %xmm11
+	movaps	%xmm3, 48(%rsp)
+	.loc 1 123 43 view .LVU227
+	mulss	%xmm0, %xmm0
+	movss	%xmm2, 44(%rsp)
+	.loc 1 123 79 view .LVU228
+	mulss	%xmm12, %xmm12
+	movss	%xmm1, 40(%rsp)
+	movss	%xmm4, 36(%rsp)
+	movss	%xmm7, 32(%rsp)
+	movss	%xmm9, 28(%rsp)
+	.loc 1 123 52 view .LVU229
+	addss	%xmm11, %xmm0
+	movss	%xmm10, 24(%rsp)
+	movss	%xmm8, 20(%rsp)
+	movss	%xmm6, 16(%rsp)
+	.loc 1 123 21 view .LVU230
+	addss	%xmm12, %xmm0
+	movss	%xmm5, 12(%rsp)
+	.loc 1 123 9 is_stmt 1 view .LVU231
+	.loc 1 123 21 is_stmt 0 view .LVU232
+	call	invSqrt_approx@PLT
+.LVL54:
+	.loc 1 124 9 is_stmt 1 view .LVU233
+	.loc 1 124 15 is_stmt 0 view .LVU234
+	movss	0(%rbp), %xmm14
+	movaps	48(%rsp), %xmm3
+	.loc 1 125 15 view .LVU235
+	movss	4(%rbp), %xmm13
+	.loc 1 128 39 view .LVU236
+	movss	60(%rbx), %xmm11
+	.loc 1 124 15 view .LVU237
+	mulss	%xmm0, %xmm14
+.LVL55:
+	.loc 1 125 9 is_stmt 1 view .LVU238
+	.loc 1 128 48 is_stmt 0 view .LVU239
+	movss	56(%rbx), %xmm15
+	.loc 1 128 12 view .LVU240
+	movss	24(%rsp), %xmm10
+	.loc 1 125 15 view .LVU241
+	mulss	%xmm0, %xmm13
+.LVL56:
+	.loc 1 126 9 is_stmt 1 view .LVU242
+	.loc 1 128 19 is_stmt 0 view .LVU243
+	movaps	%xmm11, %xmm12
+	.loc 1 129 12 view .LVU244
+	movss	28(%rsp), %xmm9
+	.loc 1 130 12 view .LVU245
+	movss	32(%rsp), %xmm7
+	.loc 1 126 15 view .LVU246
+	mulss	8(%rbp), %xmm0
+.LVL57:
+	.loc 1 128 9 is_stmt 1 view .LVU247
+	movss	12(%rsp), %xmm5
+	movss	16(%rsp), %xmm6
+	movss	20(%rsp), %xmm8
+	movss	36(%rsp), %xmm4
+	movss	40(%rsp), %xmm1
+	.loc 1 129 48 is_stmt 0 view .LVU248
+	mulss	%xmm14, %xmm11
+	movss	44(%rsp), %xmm2
+	.loc 1 128 19 view .LVU249
+	mulss	%xmm13, %xmm12
+	.loc 1 128 48 view .LVU250
+	mulss	%xmm0, %xmm15
+	.loc 1 128 43 view .LVU251
+	subss	%xmm15, %xmm12
+	movss	16(%rbx), %xmm15
+	.loc 1 128 12 view .LVU252
+	addss	%xmm12, %xmm10
+.LVL58:
+	.loc 1 129 9 is_stmt 1 view .LVU253
+	.loc 1 129 39 is_stmt 0 view .LVU254
+	movss	52(%rbx), %xmm12
+	.loc 1 129 19 view .LVU255
+	mulss	%xmm12, %xmm0
+.LVL59:
+	.loc 1 130 48 view .LVU256
+	mulss	%xmm13, %xmm12
+	movss	24(%rbx), %xmm13
+.LVL60:
+	.loc 1 129 43 view .LVU257
+	subss	%xmm11, %xmm0
+	.loc 1 129 12 view .LVU258
+	addss	%xmm0, %xmm9
+.LVL61:
+	.loc 1 130 9 is_stmt 1 view .LVU259
+	.loc 1 130 19 is_stmt 0 view .LVU260
+	movss	56(%rbx), %xmm0
+	mulss	%xmm14, %xmm0
+	movss	20(%rbx), %xmm14
+.LVL62:
+	.loc 1 130 43 view .LVU261
+	subss	%xmm12, %xmm0
+	.loc 1 130 12 view .LVU262
+	addss	%xmm0, %xmm7
+.LVL63:
+	.loc 1 131 9 is_stmt 1 view .LVU263
+	.loc 1 131 9 is_stmt 0 view .LVU264
+.LBE24:
+	.loc 1 134 5 is_stmt 1 view .LVU265
+.L20:
+	.loc 1 136 9 view .LVU266
+	.loc 1 149 20 is_stmt 0 view .LVU267
+	movaps	%xmm13, %xmm0
+	.loc 1 136 12 view .LVU268
+	pxor	%xmm13, %xmm13
+	.loc 1 137 22 view .LVU269
+	movaps	%xmm15, %xmm12
+	.loc 1 136 12 view .LVU270
+	comiss	%xmm13, %xmm2
+	.loc 1 148 20 view .LVU271
+	movaps	%xmm14, %xmm11
+	.loc 1 136 12 view .LVU272
+	jbe	.L26
+	.loc 1 137 13 is_stmt 1 view .LVU273
+	.loc 1 137 40 is_stmt 0 view .LVU274
+	movaps	%xmm2, %xmm13
+	mulss	%xmm10, %xmm13
+	.loc 1 137 45 view .LVU275
+	mulss	%xmm4, %xmm13
+	.loc 1 137 34 view .LVU276
+	addss	%xmm13, %xmm12
+	.loc 1 138 40 view .LVU277
+	movaps	%xmm2, %xmm13
+	mulss	%xmm9, %xmm13
+	.loc 1 139 40 view .LVU278
+	mulss	%xmm7, %xmm2
+	.loc 1 137 34 view .LVU279
+	movss	%xmm12, 16(%rbx)
+	.loc 1 138 13 is_stmt 1 view .LVU280
+	.loc 1 138 45 is_stmt 0 view .LVU281
+	mulss	%xmm4, %xmm13
+	.loc 1 139 45 view .LVU282
+	mulss	%xmm4, %xmm2
+	.loc 1 138 34 view .LVU283
+	addss	%xmm13, %xmm11
+	.loc 1 139 34 view .LVU284
+	addss	%xmm2, %xmm0
+	.loc 1 138 34 view .LVU285
+	movss	%xmm11, 20(%rbx)
+	.loc 1 139 13 is_stmt 1 view .LVU286
+	.loc 1 139 34 is_stmt 0 view .LVU287
+	movss	%xmm0, 24(%rbx)
+.L26:
+	.loc 1 142 9 is_stmt 1 view .LVU288
+	.loc 1 142 18 is_stmt 0 view .LVU289
+	mulss	%xmm1, %xmm10
+	.loc 1 143 18 view .LVU290
+	mulss	%xmm1, %xmm9
+	.loc 1 144 18 view .LVU291
+	mulss	%xmm7, %xmm1
+	.loc 1 142 12 view .LVU292
+	addss	%xmm10, %xmm5
+.LVL64:
+	.loc 1 143 9 is_stmt 1 view .LVU293
+	.loc 1 143 12 is_stmt 0 view .LVU294
+	addss	%xmm9, %xmm6
+.LVL65:
+	.loc 1 144 9 is_stmt 1 view .LVU295
+	.loc 1 144 12 is_stmt 0 view .LVU296
+	addss	%xmm1, %xmm8
+.LVL66:
+.L14:
+	.loc 1 147 5 is_stmt 1 view .LVU297
+	.loc 1 148 8 is_stmt 0 view .LVU298
+	addss	%xmm11, %xmm6
+.LVL67:
+	.loc 1 147 8 view .LVU299
+	addss	%xmm12, %xmm5
+.LVL68:
+	.loc 1 148 5 is_stmt 1 view .LVU300
+	.loc 1 149 5 view .LVU301
+	.loc 1 157 11 is_stmt 0 view .LVU302
+	movss	4(%rbx), %xmm7
+	.loc 1 152 16 view .LVU303
+	mulss	.LC3(%rip), %xmm4
+	.loc 1 158 11 view .LVU304
+	movss	8(%rbx), %xmm2
+	.loc 1 149 8 view .LVU305
+	addss	%xmm0, %xmm8
+.LVL69:
+	.loc 1 152 5 is_stmt 1 view .LVU306
+	.loc 1 159 53 is_stmt 0 view .LVU307
+	movss	12(%rbx), %xmm9
+	.loc 1 159 23 view .LVU308
+	xorps	%xmm7, %xmm3
+	movaps	%xmm3, %xmm1
+	.loc 1 160 57 view .LVU309
+	movaps	%xmm9, %xmm10
+	.loc 1 153 8 view .LVU310
+	mulss	%xmm4, %xmm6
+.LVL70:
+	.loc 1 152 8 view .LVU311
+	mulss	%xmm4, %xmm5
+.LVL71:
+	.loc 1 153 5 is_stmt 1 view .LVU312
+	.loc 1 154 5 view .LVU313
+	.loc 1 154 8 is_stmt 0 view .LVU314
+	mulss	%xmm8, %xmm4
+.LVL72:
+	.loc 1 156 5 is_stmt 1 view .LVU315
+	.loc 1 156 11 is_stmt 0 view .LVU316
+	movss	(%rbx), %xmm8
+.LVL73:
+	.loc 1 157 5 is_stmt 1 view .LVU317
+	.loc 1 158 5 view .LVU318
+	.loc 1 159 5 view .LVU319
+	.loc 1 160 5 view .LVU320
+	.loc 1 161 5 view .LVU321
+	.loc 1 162 5 view .LVU322
+	.loc 1 160 57 is_stmt 0 view .LVU323
+	mulss	%xmm6, %xmm10
+	.loc 1 159 37 view .LVU324
+	movaps	%xmm6, %xmm0
+	mulss	%xmm2, %xmm0
+	.loc 1 159 27 view .LVU325
+	mulss	%xmm5, %xmm1
+	.loc 1 160 36 view .LVU326
+	movaps	%xmm4, %xmm3
+	mulss	%xmm2, %xmm3
+	.loc 1 159 32 view .LVU327
+	subss	%xmm0, %xmm1
+	.loc 1 159 58 view .LVU328
+	movaps	%xmm9, %xmm0
+	mulss	%xmm4, %xmm0
+	.loc 1 161 57 view .LVU329
+	mulss	%xmm5, %xmm9
+	.loc 1 159 42 view .LVU330
+	subss	%xmm0, %xmm1
+	.loc 1 160 26 view .LVU331
+	movaps	%xmm5, %xmm0
+	mulss	%xmm8, %xmm0
+	.loc 1 162 46 view .LVU332
+	mulss	%xmm2, %xmm5
+.LVL74:
+	.loc 1 160 31 view .LVU333
+	addss	%xmm0, %xmm3
+	.loc 1 161 26 view .LVU334
+	movaps	%xmm6, %xmm0
+	mulss	%xmm8, %xmm0
+	.loc 1 162 36 view .LVU335
+	mulss	%xmm7, %xmm6
+.LVL75:
+	.loc 1 160 41 view .LVU336
+	subss	%xmm10, %xmm3
+	.loc 1 161 36 view .LVU337
+	movaps	%xmm4, %xmm10
+	mulss	%xmm7, %xmm10
+	.loc 1 159 19 view .LVU338
+	movups	(%rbx), %xmm7
+.LVL76:
+	.loc 1 162 26 view .LVU339
+	mulss	%xmm8, %xmm4
+.LVL77:
+	.loc 1 159 19 view .LVU340
+	unpcklps	%xmm3, %xmm1
+	.loc 1 161 31 view .LVU341
+	subss	%xmm10, %xmm0
+	.loc 1 162 31 view .LVU342
+	addss	%xmm6, %xmm4
+	.loc 1 161 41 view .LVU343
+	addss	%xmm9, %xmm0
+	.loc 1 162 41 view .LVU344
+	subss	%xmm5, %xmm4
+	.loc 1 159 19 view .LVU345
+	unpcklps	%xmm4, %xmm0
+	movlhps	%xmm0, %xmm1
+	addps	%xmm7, %xmm1
+	movaps	%xmm1, %xmm4
+	movaps	%xmm1, %xmm0
+	movaps	%xmm1, %xmm3
+	movups	%xmm1, (%rbx)
+.LVL78:
+	.loc 1 164 5 is_stmt 1 view .LVU346
+	.loc 1 164 46 is_stmt 0 view .LVU347
+	mulss	%xmm1, %xmm0
+	shufps	$85, %xmm1, %xmm4
+	unpckhps	%xmm1, %xmm3
+	movaps	%xmm1, %xmm2
+.LVL79:
+	.loc 1 164 78 view .LVU348
+	mulss	%xmm4, %xmm4
+	shufps	$255, %xmm1, %xmm2
+	.loc 1 164 110 view .LVU349
+	mulss	%xmm3, %xmm3
+	.loc 1 164 142 view .LVU350
+	mulss	%xmm2, %xmm2
+	.loc 1 164 62 view .LVU351
+	addss	%xmm4, %xmm0
+	.loc 1 164 94 view .LVU352
+	addss	%xmm3, %xmm0
+	.loc 1 164 17 view .LVU353
+	addss	%xmm2, %xmm0
+	call	invSqrt_approx@PLT
+.LVL80:
+	.loc 1 165 5 is_stmt 1 view .LVU354
+	.loc 1 166 5 view .LVU355
+	.loc 1 167 5 view .LVU356
+	.loc 1 168 5 view .LVU357
+	.loc 1 165 19 is_stmt 0 view .LVU358
+	movups	(%rbx), %xmm5
+	.loc 1 170 5 view .LVU359
+	movq	%rbx, %rdi
+	.loc 1 165 19 view .LVU360
+	shufps	$0, %xmm0, %xmm0
+.LVL81:
+	.loc 1 165 19 view .LVU361
+	mulps	%xmm5, %xmm0
+	movups	%xmm0, (%rbx)
+	.loc 1 170 5 is_stmt 1 view .LVU362
+	.loc 1 171 1 is_stmt 0 view .LVU363
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL82:
+	.loc 1 171 1 view .LVU364
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL83:
+	.loc 1 170 5 view .LVU365
+	jmp	mahonyComputeRotationMatrix
+.LVL84:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.cfi_restore_state
+	.loc 1 147 20 view .LVU366
+	movss	16(%rbx), %xmm12
+	.loc 1 148 20 view .LVU367
+	movss	20(%rbx), %xmm11
+	movss	.LC5(%rip), %xmm3
+	.loc 1 149 20 view .LVU368
+	movss	24(%rbx), %xmm0
+	jmp	.L14
+	.cfi_endproc
+.LFE3:
+	.size	mahonyUpdate, .-mahonyUpdate
+	.section	.text.mahonyGetRoll,"ax",@progbits
+	.p2align 4
+	.globl	mahonyGetRoll
+	.type	mahonyGetRoll, @function
+mahonyGetRoll:
+.LVL85:
+.LFB4:
+	.loc 1 174 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 175 5 view .LVU370
+	.loc 1 175 12 is_stmt 0 view .LVU371
+	movss	56(%rdi), %xmm0
+	movss	60(%rdi), %xmm1
+	jmp	atan2_approx@PLT
+.LVL86:
+	.loc 1 175 12 view .LVU372
+	.cfi_endproc
+.LFE4:
+	.size	mahonyGetRoll, .-mahonyGetRoll
+	.section	.text.mahonyGetPitch,"ax",@progbits
+	.p2align 4
+	.globl	mahonyGetPitch
+	.type	mahonyGetPitch, @function
+mahonyGetPitch:
+.LVL87:
+.LFB5:
+	.loc 1 179 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 180 5 view .LVU374
+	.loc 1 179 1 is_stmt 0 view .LVU375
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 180 73 view .LVU376
+	movss	56(%rdi), %xmm1
+	.loc 1 180 121 view .LVU377
+	movss	60(%rdi), %xmm0
+	.loc 1 180 77 view .LVU378
+	mulss	%xmm1, %xmm1
+	.loc 1 180 125 view .LVU379
+	mulss	%xmm0, %xmm0
+	.loc 1 180 12 view .LVU380
+	addss	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	ucomiss	%xmm1, %xmm0
+	ja	.L56
+	sqrtss	%xmm1, %xmm1
+.LVL88:
+.L54:
+	.loc 1 180 12 view .LVU381
+	movss	52(%rdi), %xmm0
+	xorps	.LC5(%rip), %xmm0
+	.loc 1 181 1 view .LVU382
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 180 12 view .LVU383
+	jmp	atan2_approx@PLT
+.LVL89:
+.L56:
+	.cfi_restore_state
+	.loc 1 180 12 view .LVU384
+	movaps	%xmm1, %xmm0
+	movq	%rdi, 8(%rsp)
+	call	sqrtf@PLT
+.LVL90:
+	.loc 1 180 12 view .LVU385
+	movq	8(%rsp), %rdi
+	movaps	%xmm0, %xmm1
+	jmp	.L54
+	.cfi_endproc
+.LFE5:
+	.size	mahonyGetPitch, .-mahonyGetPitch
+	.section	.text.mahonyGetYaw,"ax",@progbits
+	.p2align 4
+	.globl	mahonyGetYaw
+	.type	mahonyGetYaw, @function
+mahonyGetYaw:
+.LVL91:
+.LFB6:
+	.loc 1 185 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 186 5 view .LVU387
+	.loc 1 186 12 is_stmt 0 view .LVU388
+	movss	40(%rdi), %xmm0
+	movss	28(%rdi), %xmm1
+	jmp	atan2_approx@PLT
+.LVL92:
+	.loc 1 186 12 view .LVU389
+	.cfi_endproc
+.LFE6:
+	.size	mahonyGetYaw, .-mahonyGetYaw
+	.set	.LC0,.LC1
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC1:
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	0
+	.align 16
+.LC2:
+	.long	0
+	.long	0
+	.long	0
+	.long	1065353216
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC3:
+	.long	1056964608
+	.section	.rodata.cst16
+	.align 16
+.LC5:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 2 ".//src/main/flight/mahony.h"
+	.file 3 ".//src/main/common/maths.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 5 ".//src/main/common/axis.h"
+	.file 6 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7a5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1232
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL48
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1185
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1186
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1187
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1188
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1189
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1190
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1191
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1192
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1193
+	.uleb128 0x13
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1194
+	.uleb128 0x1b
+	.byte	0x7
+	.byte	0x4
+	.long	0x43
+	.byte	0x5
+	.byte	0x14
+	.byte	0xe
+	.long	0x9b
+	.uleb128 0xf
+	.string	"X"
+	.byte	0
+	.uleb128 0xf
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xf
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1233
+	.byte	0x40
+	.byte	0x2
+	.byte	0x15
+	.byte	0x10
+	.long	0x101
+	.uleb128 0xc
+	.string	"q0"
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.string	"q1"
+	.byte	0xf
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0xc
+	.string	"q2"
+	.byte	0x13
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0xc
+	.string	"q3"
+	.byte	0x17
+	.long	0x2e
+	.byte	0xc
+	.uleb128 0xd
+	.long	.LASF1195
+	.byte	0x17
+	.byte	0xb
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0xd
+	.long	.LASF1196
+	.byte	0x17
+	.byte	0x16
+	.long	0x2e
+	.byte	0x14
+	.uleb128 0xd
+	.long	.LASF1197
+	.byte	0x17
+	.byte	0x21
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0xd
+	.long	.LASF1198
+	.byte	0x18
+	.byte	0xb
+	.long	0x101
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x1d
+	.long	0x2e
+	.long	0x115
+	.uleb128 0x14
+	.long	0x4a
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1234
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0x9b
+	.uleb128 0x13
+	.long	0x115
+	.uleb128 0x8
+	.long	.LASF1199
+	.byte	0x3
+	.byte	0x43
+	.byte	0x7
+	.long	0x2e
+	.long	0x141
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1200
+	.byte	0x3
+	.byte	0x45
+	.byte	0x7
+	.long	0x2e
+	.long	0x157
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1201
+	.byte	0x4
+	.byte	0x40
+	.byte	0xf
+	.long	0x2e
+	.long	0x16d
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1202
+	.byte	0x4
+	.byte	0x3e
+	.byte	0xf
+	.long	0x2e
+	.long	0x183
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1203
+	.byte	0x4
+	.byte	0x8f
+	.byte	0xe
+	.long	0x2e
+	.long	0x199
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1204
+	.byte	0x4
+	.byte	0x3b
+	.byte	0xf
+	.long	0x2e
+	.long	0x1b4
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1205
+	.byte	0xb8
+	.long	0x2e
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f5
+	.uleb128 0x9
+	.long	.LASF1207
+	.byte	0xb8
+	.byte	0x2d
+	.long	0x1f5
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x11
+	.quad	.LVL92
+	.long	0x126
+	.byte	0
+	.uleb128 0x12
+	.long	0x121
+	.uleb128 0x10
+	.long	.LASF1206
+	.byte	0xb2
+	.long	0x2e
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x248
+	.uleb128 0x9
+	.long	.LASF1207
+	.byte	0xb2
+	.byte	0x2f
+	.long	0x1f5
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x11
+	.quad	.LVL89
+	.long	0x126
+	.uleb128 0xb
+	.quad	.LVL90
+	.long	0x183
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1208
+	.byte	0xad
+	.long	0x2e
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x289
+	.uleb128 0x9
+	.long	.LASF1207
+	.byte	0xad
+	.byte	0x2e
+	.long	0x1f5
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x11
+	.quad	.LVL86
+	.long	0x126
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1215
+	.byte	0x5e
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4d1
+	.uleb128 0x9
+	.long	.LASF1207
+	.byte	0x5e
+	.byte	0x26
+	.long	0x4d1
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xa
+	.string	"dT"
+	.byte	0x5e
+	.byte	0x37
+	.long	0x2e
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xa
+	.string	"kp"
+	.byte	0x5e
+	.byte	0x41
+	.long	0x2e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xa
+	.string	"ki"
+	.byte	0x5e
+	.byte	0x4b
+	.long	0x2e
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x9
+	.long	.LASF1209
+	.byte	0x5e
+	.byte	0x5c
+	.long	0x4d6
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xa
+	.string	"acc"
+	.byte	0x5e
+	.byte	0x6f
+	.long	0x4d6
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xa
+	.string	"mag"
+	.byte	0x5e
+	.byte	0x81
+	.long	0x4d6
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1
+	.string	"gx"
+	.byte	0x60
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1
+	.string	"gy"
+	.byte	0x61
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1
+	.string	"gz"
+	.byte	0x62
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1
+	.string	"ex"
+	.byte	0x63
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1
+	.string	"ey"
+	.byte	0x63
+	.byte	0x16
+	.long	0x2e
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1
+	.string	"ez"
+	.byte	0x63
+	.byte	0x21
+	.long	0x2e
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x4
+	.long	.LASF1210
+	.byte	0x64
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.long	.LASF1211
+	.byte	0x65
+	.byte	0x9
+	.long	0x4db
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1
+	.string	"qa"
+	.byte	0x9c
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1
+	.string	"qb"
+	.byte	0x9d
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x1
+	.string	"qc"
+	.byte	0x9e
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1f
+	.long	.LLRL36
+	.long	0x456
+	.uleb128 0x1
+	.string	"hx"
+	.byte	0x6a
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.string	"hy"
+	.byte	0x6b
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x4
+	.long	.LASF1212
+	.byte	0x6c
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x20
+	.long	.LLRL40
+	.uleb128 0x4
+	.long	.LASF1213
+	.byte	0x6f
+	.byte	0x13
+	.long	0x2e
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0xb
+	.quad	.LVL47
+	.long	0x141
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.long	0x4af
+	.uleb128 0x1
+	.string	"ax"
+	.byte	0x7c
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x1
+	.string	"ay"
+	.byte	0x7d
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x1
+	.string	"az"
+	.byte	0x7e
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xb
+	.quad	.LVL54
+	.long	0x141
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL80
+	.long	0x141
+	.uleb128 0x22
+	.quad	.LVL84
+	.long	0x66f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x115
+	.uleb128 0x12
+	.long	0x74
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1214
+	.uleb128 0x15
+	.long	.LASF1216
+	.byte	0x4a
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x656
+	.uleb128 0x9
+	.long	.LASF1207
+	.byte	0x4a
+	.byte	0x34
+	.long	0x4d1
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xa
+	.string	"acc"
+	.byte	0x4a
+	.byte	0x4c
+	.long	0x4d6
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x4
+	.long	.LASF1217
+	.byte	0x4c
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x3
+	.long	.LASF1222
+	.byte	0x4d
+	.long	0x2e
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0x4e
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0x4f
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x4
+	.long	.LASF1220
+	.byte	0x50
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.long	.LASF1221
+	.byte	0x51
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x23
+	.long	0x656
+	.quad	.LBI8
+	.byte	.LVU103
+	.long	.LLRL16
+	.byte	0x1
+	.byte	0x53
+	.byte	0x5
+	.long	0x5b4
+	.uleb128 0x24
+	.long	0x663
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL20
+	.long	0x199
+	.long	0x5d9
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -68
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -64
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL23
+	.long	0x79d
+	.long	0x5f7
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL24
+	.long	0x199
+	.long	0x612
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -60
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL25
+	.long	0x79d
+	.long	0x630
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL33
+	.long	0x66f
+	.long	0x648
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xb
+	.quad	.LVL34
+	.long	0x183
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1235
+	.byte	0x1
+	.byte	0x38
+	.byte	0x6
+	.byte	0x1
+	.long	0x66f
+	.uleb128 0x16
+	.long	.LASF1207
+	.byte	0x38
+	.byte	0x25
+	.long	0x4d1
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1236
+	.byte	0x1
+	.byte	0x1e
+	.byte	0xd
+	.byte	0x1
+	.long	0x6e2
+	.uleb128 0x16
+	.long	.LASF1207
+	.byte	0x1e
+	.byte	0x3c
+	.long	0x4d1
+	.uleb128 0x3
+	.long	.LASF1223
+	.byte	0x20
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1224
+	.byte	0x21
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1225
+	.byte	0x22
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1226
+	.byte	0x24
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1227
+	.byte	0x25
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1228
+	.byte	0x26
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1229
+	.byte	0x27
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1230
+	.byte	0x28
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1231
+	.byte	0x29
+	.long	0x2e
+	.byte	0
+	.uleb128 0x17
+	.long	0x66f
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77a
+	.uleb128 0x18
+	.long	0x67c
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.long	0x687
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x6
+	.long	0x691
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	0x69b
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.long	0x6a5
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x6
+	.long	0x6af
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	0x6b9
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x6
+	.long	0x6c3
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x6
+	.long	0x6cd
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x6
+	.long	0x6d7
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x17
+	.long	0x656
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79d
+	.uleb128 0x18
+	.long	0x663
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1237
+	.long	.LASF1238
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU389
+	.uleb128 .LVU389
+	.uleb128 0
+.LLST47:
+	.byte	0x6
+	.quad	.LVL91
+	.byte	0x4
+	.uleb128 .LVL91-.LVL91
+	.uleb128 .LVL92-1-.LVL91
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-1-.LVL91
+	.uleb128 .LFE6-.LVL91
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU384
+	.uleb128 .LVU384
+	.uleb128 .LVU385
+	.uleb128 .LVU385
+	.uleb128 0
+.LLST46:
+	.byte	0x6
+	.quad	.LVL87
+	.byte	0x4
+	.uleb128 .LVL87-.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.LVL87
+	.uleb128 .LVL89-.LVL87
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.LVL87
+	.uleb128 .LVL90-1-.LVL87
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-1-.LVL87
+	.uleb128 .LFE5-.LVL87
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU372
+	.uleb128 .LVU372
+	.uleb128 0
+.LLST45:
+	.byte	0x6
+	.quad	.LVL85
+	.byte	0x4
+	.uleb128 .LVL85-.LVL85
+	.uleb128 .LVL86-1-.LVL85
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL86-1-.LVL85
+	.uleb128 .LFE4-.LVL85
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU364
+	.uleb128 .LVU364
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL82-.LVL35
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL82-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL39-.LVL35
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL39-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL53-.LVL35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x4
+	.uleb128 .LVL53-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL53-.LVL35
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x4
+	.uleb128 .LVL53-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL53-.LVL35
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0x4
+	.uleb128 .LVL53-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x3
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST22:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU365
+	.uleb128 .LVU365
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST23:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL83-.LVL35
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL83-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL40-.LVL35
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL40-.LVL35
+	.uleb128 .LVL42-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL35
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL35
+	.uleb128 .LVL84-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL35
+	.uleb128 .LFE3-.LVL35
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU138
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU293
+	.uleb128 .LVU333
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST25:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL40-.LVL36
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL42-.LVL36
+	.uleb128 .LVL47-1-.LVL36
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL36
+	.uleb128 .LVL53-.LVL36
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x4
+	.uleb128 .LVL64-.LVL36
+	.uleb128 .LVL74-.LVL36
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0x4
+	.uleb128 .LVL84-.LVL36
+	.uleb128 .LFE3-.LVL36
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU140
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+	.uleb128 .LVU301
+	.uleb128 .LVU311
+	.uleb128 .LVU313
+	.uleb128 .LVU336
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST26:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL40-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL42-.LVL37
+	.uleb128 .LVL47-1-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL37
+	.uleb128 .LVL53-.LVL37
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x4
+	.uleb128 .LVL65-.LVL37
+	.uleb128 .LVL67-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL68-.LVL37
+	.uleb128 .LVL70-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL71-.LVL37
+	.uleb128 .LVL75-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL84-.LVL37
+	.uleb128 .LFE3-.LVL37
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU142
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+	.uleb128 .LVU297
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU340
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL47-1-.LVL38
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL38
+	.uleb128 .LVL53-.LVL38
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL66-.LVL38
+	.uleb128 .LVL72-.LVL38
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL72-.LVL38
+	.uleb128 .LVL77-.LVL38
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL84-.LVL38
+	.uleb128 .LFE3-.LVL38
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU143
+	.uleb128 .LVU160
+	.uleb128 .LVU167
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU226
+	.uleb128 .LVU253
+	.uleb128 .LVU266
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL41-.LVL38
+	.uleb128 .LVL42-.LVL38
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL50-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL50-.LVL38
+	.uleb128 .LVL53-.LVL38
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL58-.LVL38
+	.uleb128 .LVL63-.LVL38
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL84-.LVL38
+	.uleb128 .LFE3-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU143
+	.uleb128 .LVU160
+	.uleb128 .LVU167
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU226
+	.uleb128 .LVU259
+	.uleb128 .LVU266
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST29:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL41-.LVL38
+	.uleb128 .LVL42-.LVL38
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL51-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL51-.LVL38
+	.uleb128 .LVL53-.LVL38
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL61-.LVL38
+	.uleb128 .LVL63-.LVL38
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL84-.LVL38
+	.uleb128 .LFE3-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU143
+	.uleb128 .LVU160
+	.uleb128 .LVU167
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU226
+	.uleb128 .LVU263
+	.uleb128 .LVU266
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL41-.LVL38
+	.uleb128 .LVL42-.LVL38
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL52-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL52-.LVL38
+	.uleb128 .LVL53-.LVL38
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL63-.LVL38
+	.uleb128 .LVL63-.LVL38
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL84-.LVL38
+	.uleb128 .LFE3-.LVL38
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU233
+	.uleb128 .LVU247
+	.uleb128 .LVU354
+	.uleb128 .LVU361
+.LLST31:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL80-.LVL54
+	.uleb128 .LVL81-.LVL54
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU145
+	.uleb128 .LVU160
+	.uleb128 .LVU167
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+	.uleb128 .LVU264
+	.uleb128 .LVU266
+	.uleb128 .LVU366
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL38
+	.byte	0x4
+	.uleb128 .LVL38-.LVL38
+	.uleb128 .LVL40-.LVL38
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL38
+	.uleb128 .LVL42-.LVL38
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.LVL38
+	.uleb128 .LVL52-.LVL38
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL38
+	.uleb128 .LVL53-.LVL38
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL38
+	.uleb128 .LVL63-.LVL38
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL38
+	.uleb128 .LFE3-.LVL38
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU317
+	.uleb128 .LVU354
+.LLST33:
+	.byte	0x8
+	.quad	.LVL73
+	.uleb128 .LVL80-1-.LVL73
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU318
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU346
+.LLST34:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL76-.LVL73
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL76-.LVL73
+	.uleb128 .LVL78-.LVL73
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU319
+	.uleb128 .LVU348
+.LLST35:
+	.byte	0x8
+	.quad	.LVL73
+	.uleb128 .LVL79-.LVL73
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU187
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU199
+.LLST37:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL47-1-.LVL43
+	.uleb128 0x24
+	.byte	0x73
+	.sleb128 28
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x72
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x73
+	.sleb128 32
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x72
+	.sleb128 4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x73
+	.sleb128 36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x72
+	.sleb128 8
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU192
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU226
+.LLST38:
+	.byte	0x6
+	.quad	.LVL45
+	.byte	0x4
+	.uleb128 .LVL45-.LVL45
+	.uleb128 .LVL47-1-.LVL45
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL45
+	.uleb128 .LVL53-.LVL45
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU195
+	.uleb128 .LVU199
+.LLST39:
+	.byte	0x8
+	.quad	.LVL46
+	.uleb128 .LVL47-1-.LVL46
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU211
+	.uleb128 .LVU216
+.LLST41:
+	.byte	0x8
+	.quad	.LVL48
+	.uleb128 .LVL49-.LVL48
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU238
+	.uleb128 .LVU261
+.LLST42:
+	.byte	0x8
+	.quad	.LVL55
+	.uleb128 .LVL62-.LVL55
+	.uleb128 0x1
+	.byte	0x6f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU242
+	.uleb128 .LVU257
+.LLST43:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LVL60-.LVL56
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU247
+	.uleb128 .LVU256
+.LLST44:
+	.byte	0x8
+	.quad	.LVL57
+	.uleb128 .LVL59-.LVL57
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL20-1-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-1-.LVL19
+	.uleb128 .LVL31-.LVL19
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.LVL19
+	.uleb128 .LVL33-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.LVL19
+	.uleb128 .LFE2-.LVL19
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL20-1-.LVL19
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-1-.LVL19
+	.uleb128 .LVL32-.LVL19
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL32-.LVL19
+	.uleb128 .LVL33-.LVL19
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL19
+	.uleb128 .LFE2-.LVL19
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU133
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL33-.LVL21
+	.uleb128 .LVL34-1-.LVL21
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL34-1-.LVL21
+	.uleb128 .LFE2-.LVL21
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU99
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU132
+.LLST12:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL30-.LVL26
+	.uleb128 .LVL33-.LVL26
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU100
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU132
+.LLST13:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL29-.LVL26
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL29-.LVL26
+	.uleb128 .LVL33-.LVL26
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU101
+	.uleb128 .LVU123
+.LLST14:
+	.byte	0x8
+	.quad	.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU102
+	.uleb128 .LVU132
+.LLST15:
+	.byte	0x8
+	.quad	.LVL26
+	.uleb128 .LVL33-1-.LVL26
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU103
+	.uleb128 .LVU116
+.LLST17:
+	.byte	0x8
+	.quad	.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU3
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL8-.LVL1
+	.uleb128 0x6
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL1
+	.uleb128 .LVL12-.LVL1
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL12-.LVL1
+	.uleb128 .LFE0-.LVL1
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU5
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL10-.LVL2
+	.uleb128 0x6
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL2
+	.uleb128 .LVL13-.LVL2
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL13-.LVL2
+	.uleb128 .LFE0-.LVL2
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 8
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU7
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL7-.LVL3
+	.uleb128 0x6
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL3
+	.uleb128 .LVL11-.LVL3
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL11-.LVL3
+	.uleb128 .LFE0-.LVL3
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 12
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU13
+	.uleb128 .LVU61
+	.uleb128 .LVU61
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL16-.LVL4
+	.uleb128 .LFE0-.LVL4
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU17
+	.uleb128 0
+.LLST4:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LFE0-.LVL5
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU20
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL14-.LVL6
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0x4
+	.uleb128 .LVL14-.LVL6
+	.uleb128 .LFE0-.LVL6
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 12
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU25
+	.uleb128 0
+.LLST6:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LFE0-.LVL9
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU26
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL15-.LVL9
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL15-.LVL9
+	.uleb128 .LFE0-.LVL9
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 4
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x75
+	.sleb128 12
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU27
+	.uleb128 0
+.LLST8:
+	.byte	0x8
+	.quad	.LVL9
+	.uleb128 .LFE0-.LVL9
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x8c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL16:
+	.byte	0x5
+	.quad	.LBB8
+	.byte	0x4
+	.uleb128 .LBB8-.LBB8
+	.uleb128 .LBE8-.LBB8
+	.byte	0x4
+	.uleb128 .LBB12-.LBB8
+	.uleb128 .LBE12-.LBB8
+	.byte	0x4
+	.uleb128 .LBB13-.LBB8
+	.uleb128 .LBE13-.LBB8
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB14
+	.byte	0x4
+	.uleb128 .LBB14-.LBB14
+	.uleb128 .LBE14-.LBB14
+	.byte	0x4
+	.uleb128 .LBB20-.LBB14
+	.uleb128 .LBE20-.LBB14
+	.byte	0x4
+	.uleb128 .LBB21-.LBB14
+	.uleb128 .LBE21-.LBB14
+	.byte	0x4
+	.uleb128 .LBB22-.LBB14
+	.uleb128 .LBE22-.LBB14
+	.byte	0x4
+	.uleb128 .LBB23-.LBB14
+	.uleb128 .LBE23-.LBB14
+	.byte	0
+.LLRL40:
+	.byte	0x5
+	.quad	.LBB15
+	.byte	0x4
+	.uleb128 .LBB15-.LBB15
+	.uleb128 .LBE15-.LBB15
+	.byte	0x4
+	.uleb128 .LBB16-.LBB15
+	.uleb128 .LBE16-.LBB15
+	.byte	0x4
+	.uleb128 .LBB17-.LBB15
+	.uleb128 .LBE17-.LBB15
+	.byte	0x4
+	.uleb128 .LBB18-.LBB15
+	.uleb128 .LBE18-.LBB15
+	.byte	0x4
+	.uleb128 .LBB19-.LBB15
+	.uleb128 .LBE19-.LBB15
+	.byte	0
+.LLRL48:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1027
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1054
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 36 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.file 37 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1177
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF705
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF724
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF741
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF742
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF743
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF745
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF747
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1019
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1026
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1048
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1053
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1056
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1058
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1073
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1073
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1083
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1086
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1108
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1110
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1147
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1157
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1176
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1184
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF827:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1123:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1238:
+	.string	"__builtin_sincosf"
+.LASF752:
+	.string	"__DECL_SIMD_cosl "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1022:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1199:
+	.string	"atan2_approx"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF990:
+	.string	"__DECL_SIMD_asinh "
+.LASF1030:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1219:
+	.string	"sineRoll"
+.LASF1211:
+	.string	"haveCorrection"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1035:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF969:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF988:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF857:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1042:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1068:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF955:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF876:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF846:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF842:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF849:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF910:
+	.string	"__DECL_SIMD_atan2 "
+.LASF802:
+	.string	"__DECL_SIMD_powl "
+.LASF1160:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF864:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF861:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF834:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1138:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1095:
+	.string	"__MATHDECL_1_IMPL"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1051:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF747:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF848:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF919:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1170:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF805:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF890:
+	.string	"__DECL_SIMD_sinh "
+.LASF1147:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF878:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF829:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1154:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1164:
+	.string	"USE_GYRO_SITL "
+.LASF810:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1131:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF757:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1004:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1137:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1181:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF708:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1222:
+	.string	"halfPitch"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF959:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF953:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF743:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1221:
+	.string	"sinePitch"
+.LASF1141:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1017:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1113:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF701:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1029:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1011:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF722:
+	.string	"_GCC_SIZE_T "
+.LASF818:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF712:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF788:
+	.string	"__DECL_SIMD_logf64x "
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF943:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1148:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF940:
+	.string	"__DECL_SIMD_log1p "
+.LASF1111:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1104:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1136:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF809:
+	.string	"__DECL_SIMD_powf128x "
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF994:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF744:
+	.string	"NULL"
+.LASF1156:
+	.string	"U_ID_1 0"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF761:
+	.string	"__DECL_SIMD_sinf "
+.LASF1091:
+	.string	"_Mdouble_ _Float32x"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF859:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1115:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1071:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1166:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF710:
+	.string	"_SYS_SIZE_T_H "
+.LASF877:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1063:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF772:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1036:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1192:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF971:
+	.string	"__DECL_SIMD_erff "
+.LASF1225:
+	.string	"q3q3"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1056:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1103:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1098:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF700:
+	.string	"_PTRDIFF_T_ "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1090:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1197:
+	.string	"integralZ"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF951:
+	.string	"__DECL_SIMD_atanhf "
+.LASF980:
+	.string	"__DECL_SIMD_tanh "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1072:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1075:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF840:
+	.string	"__DECL_SIMD_hypot "
+.LASF1106:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF874:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF896:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1078:
+	.string	"_Mdouble_ float"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1127:
+	.string	"MATH_ERREXCEPT 2"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1128:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1118:
+	.string	"FP_SUBNORMAL 3"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1097:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1040:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF782:
+	.string	"__DECL_SIMD_logl "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF929:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF966:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF776:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1190:
+	.string	"signed char"
+.LASF931:
+	.string	"__DECL_SIMD_log2f "
+.LASF950:
+	.string	"__DECL_SIMD_atanh "
+.LASF707:
+	.string	"__size_t__ "
+.LASF1077:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1044:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF858:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1105:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF813:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF939:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1124:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF947:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1172:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF925:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1081:
+	.string	"_Mdouble_ long double"
+.LASF1186:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF790:
+	.string	"__DECL_SIMD_exp "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1173:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF862:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1074:
+	.string	"_Mdouble_"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF999:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1179:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF948:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF819:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1146:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1050:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1053:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF997:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1237:
+	.string	"sincosf"
+.LASF1214:
+	.string	"_Bool"
+.LASF839:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF920:
+	.string	"__DECL_SIMD_log10 "
+.LASF716:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1202:
+	.string	"cosf"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF883:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1026:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1133:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1209:
+	.string	"gyro"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF815:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF820:
+	.string	"__DECL_SIMD_atan "
+.LASF911:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1215:
+	.string	"mahonyUpdate"
+.LASF1121:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1086:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF993:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1182:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1201:
+	.string	"sinf"
+.LASF1116:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF866:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF816:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF856:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1213:
+	.string	"ezEarth"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF754:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1151:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF991:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF854:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF985:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF887:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1045:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF777:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF964:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF972:
+	.string	"__DECL_SIMD_erfl "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1117:
+	.string	"FP_ZERO 2"
+.LASF1152:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1073:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1143:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1161:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1158:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF794:
+	.string	"__DECL_SIMD_expf32 "
+.LASF905:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF837:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF868:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF738:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1200:
+	.string	"invSqrt_approx"
+.LASF725:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF965:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF936:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1002:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF724:
+	.string	"__size_t "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF899:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1162:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF733:
+	.string	"_BSD_WCHAR_T_ "
+.LASF952:
+	.string	"__DECL_SIMD_atanhl "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1062:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF753:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1076:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF937:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1070:
+	.string	"_Mdouble_ double"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1093:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1001:
+	.string	"__DECL_SIMD_erfcf "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF942:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF745:
+	.string	"NULL ((void *)0)"
+.LASF1085:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF938:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF795:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF830:
+	.string	"__DECL_SIMD_asin "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1094:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1083:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1174:
+	.string	"BLACKBOX "
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1034:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF915:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF879:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF851:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1122:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF808:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF932:
+	.string	"__DECL_SIMD_log2l "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF956:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF987:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1054:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF989:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF867:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF847:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1218:
+	.string	"cosineRoll"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF759:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF860:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1212:
+	.string	"bxSquared"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF711:
+	.string	"_T_SIZE_ "
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1033:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1016:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF756:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF804:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1157:
+	.string	"U_ID_2 0"
+.LASF961:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF779:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF923:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1195:
+	.string	"integralX"
+.LASF1196:
+	.string	"integralY"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1064:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1112:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1126:
+	.string	"MATH_ERRNO 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1003:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1167:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF1171:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF903:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF765:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1018:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF702:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1019:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1047:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF811:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF921:
+	.string	"__DECL_SIMD_log10f "
+.LASF697:
+	.string	"_T_PTRDIFF_ "
+.LASF796:
+	.string	"__DECL_SIMD_expf128 "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1132:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1144:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF693:
+	.string	"_STDDEF_H "
+.LASF922:
+	.string	"__DECL_SIMD_log10l "
+.LASF912:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1096:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF729:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1046:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF909:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF762:
+	.string	"__DECL_SIMD_sinl "
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF904:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1135:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF714:
+	.string	"_SIZE_T_ "
+.LASF1216:
+	.string	"mahonyAlignToAccelerometer"
+.LASF963:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1130:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF900:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF865:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF726:
+	.string	"__wchar_t__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF852:
+	.string	"__DECL_SIMD_exp2l "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF750:
+	.string	"__DECL_SIMD_cos "
+.LASF1039:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF766:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF891:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1206:
+	.string	"mahonyGetPitch"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF731:
+	.string	"__WCHAR_T "
+.LASF1194:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF824:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF831:
+	.string	"__DECL_SIMD_asinf "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF462:
+	.string	"__PMT"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF807:
+	.string	"__DECL_SIMD_powf32x "
+.LASF960:
+	.string	"__DECL_SIMD_acosh "
+.LASF1080:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF927:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1009:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1088:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1025:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF828:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1084:
+	.string	"_Mdouble_ _Float32"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1008:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF797:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1226:
+	.string	"q0q1"
+.LASF1227:
+	.string	"q0q2"
+.LASF1228:
+	.string	"q0q3"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1134:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF880:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF954:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF946:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1007:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF881:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1021:
+	.string	"__HAVE_FLOAT128 1"
+.LASF924:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF863:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1188:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF995:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF981:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1092:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF930:
+	.string	"__DECL_SIMD_log2 "
+.LASF901:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1069:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF740:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1145:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF789:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1015:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1217:
+	.string	"halfRoll"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1149:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF698:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF696:
+	.string	"_PTRDIFF_T "
+.LASF935:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF771:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF719:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF801:
+	.string	"__DECL_SIMD_powf "
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1169:
+	.string	"USE_USART1 "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF391:
+	.string	"true 1"
+.LASF704:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF803:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1165:
+	.string	"ACC "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1178:
+	.string	"sq(x) ((x)*(x))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF974:
+	.string	"__DECL_SIMD_erff32 "
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF798:
+	.string	"__DECL_SIMD_expf64x "
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF785:
+	.string	"__DECL_SIMD_logf64 "
+.LASF888:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1038:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF778:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF721:
+	.string	"___int_size_t_h "
+.LASF983:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF728:
+	.string	"_WCHAR_T "
+.LASF767:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1032:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1110:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF945:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF962:
+	.string	"__DECL_SIMD_acoshl "
+.LASF718:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF886:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF703:
+	.string	"_GCC_PTRDIFF_T "
+.LASF546:
+	.string	"__stub_revoke "
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1193:
+	.string	"char"
+.LASF792:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF709:
+	.string	"_SIZE_T "
+.LASF736:
+	.string	"_WCHAR_T_H "
+.LASF871:
+	.string	"__DECL_SIMD_coshf "
+.LASF786:
+	.string	"__DECL_SIMD_logf128 "
+.LASF806:
+	.string	"__DECL_SIMD_powf128 "
+.LASF933:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1159:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF895:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF836:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1187:
+	.string	"short unsigned int"
+.LASF855:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF713:
+	.string	"__SIZE_T "
+.LASF967:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF944:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1163:
+	.string	"GYRO "
+.LASF780:
+	.string	"__DECL_SIMD_log "
+.LASF812:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF975:
+	.string	"__DECL_SIMD_erff64 "
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1140:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF748:
+	.string	"_MATH_H 1"
+.LASF1024:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF926:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF783:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1220:
+	.string	"cosinePitch"
+.LASF739:
+	.string	"_GCC_WCHAR_T "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1236:
+	.string	"mahonyComputeRotationMatrix"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1013:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF838:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1234:
+	.string	"mahonyEstimator_t"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1120:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF695:
+	.string	"_ANSI_STDDEF_H "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF379:
+	.string	"SITL 1"
+.LASF823:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF717:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1155:
+	.string	"U_ID_0 0x5349544c"
+.LASF1010:
+	.string	"__DECL_SIMD_tan "
+.LASF775:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF699:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1114:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1125:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF928:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF832:
+	.string	"__DECL_SIMD_asinl "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF893:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF892:
+	.string	"__DECL_SIMD_sinhl "
+.LASF914:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF769:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1058:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1100:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF973:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1067:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1177:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1065:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1198:
+	.string	"rMat"
+.LASF735:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF549:
+	.string	"__stub_stty "
+.LASF850:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF720:
+	.string	"__DEFINED_size_t "
+.LASF1153:
+	.string	"__disable_irq() "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF845:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1232:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF715:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF746:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF758:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF906:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF730:
+	.string	"_T_WCHAR "
+.LASF1006:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF749:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1223:
+	.string	"q1q1"
+.LASF1229:
+	.string	"q1q2"
+.LASF1230:
+	.string	"q1q3"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF882:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF791:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF773:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1052:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF979:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF800:
+	.string	"__DECL_SIMD_pow "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1020:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF732:
+	.string	"_WCHAR_T_ "
+.LASF902:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF998:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1176:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF844:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF898:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF734:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF833:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF908:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1023:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF958:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF996:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF793:
+	.string	"__DECL_SIMD_expf16 "
+.LASF723:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF760:
+	.string	"__DECL_SIMD_sin "
+.LASF1119:
+	.string	"FP_NORMAL 4"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1049:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1027:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1031:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1041:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1101:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF889:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF751:
+	.string	"__DECL_SIMD_cosf "
+.LASF774:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1168:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1082:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF764:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF821:
+	.string	"__DECL_SIMD_atanf "
+.LASF1184:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF941:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1089:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1191:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1012:
+	.string	"__DECL_SIMD_tanl "
+.LASF970:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF869:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF853:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF976:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF916:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF872:
+	.string	"__DECL_SIMD_coshl "
+.LASF841:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF706:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1142:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1061:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF799:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF835:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF727:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1000:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF885:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1099:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF741:
+	.string	"__DEFINED_wchar_t "
+.LASF1043:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1180:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF978:
+	.string	"__DECL_SIMD_erff64x "
+.LASF918:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1066:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF825:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1055:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF870:
+	.string	"__DECL_SIMD_cosh "
+.LASF913:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1037:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF737:
+	.string	"___int_wchar_t_h "
+.LASF1235:
+	.string	"mahonyReset"
+.LASF1107:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1108:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF986:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF982:
+	.string	"__DECL_SIMD_tanhl "
+.LASF826:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF949:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF984:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF884:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF742:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF873:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1028:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1183:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF897:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1102:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF770:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1233:
+	.string	"mahonyEstimator_s"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF934:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1014:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1059:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF763:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1205:
+	.string	"mahonyGetYaw"
+.LASF957:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1060:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF814:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF768:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF992:
+	.string	"__DECL_SIMD_asinhl "
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1185:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1087:
+	.string	"_Mdouble_ _Float64"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1005:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1208:
+	.string	"mahonyGetRoll"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF822:
+	.string	"__DECL_SIMD_atanl "
+.LASF784:
+	.string	"__DECL_SIMD_logf32 "
+.LASF977:
+	.string	"__DECL_SIMD_erff32x "
+.LASF917:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF705:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1224:
+	.string	"q2q2"
+.LASF1231:
+	.string	"q2q3"
+.LASF1207:
+	.string	"estimator"
+.LASF907:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1048:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF694:
+	.string	"_STDDEF_H_ "
+.LASF1139:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF817:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF843:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1109:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF787:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1210:
+	.string	"recipNorm"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1057:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF894:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1079:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1204:
+	.string	"atan2f"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1203:
+	.string	"sqrtf"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1129:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF968:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1189:
+	.string	"long unsigned int"
+.LASF1175:
+	.string	"PROFILING "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1150:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF755:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/flight/mahony.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19948 @@
+	.file	"mixer.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/flight/mixer.c"
+	.section	.text.loadMotorMixWeights,"ax",@progbits
+	.p2align 4
+	.type	loadMotorMixWeights, @function
+loadMotorMixWeights:
+.LVL0:
+.LFB16:
+	.file 1 ".//src/main/flight/mixer.c"
+	.loc 1 279 1 view -0
+	.cfi_startproc
+	.loc 1 280 5 view .LVU1
+	.loc 1 279 1 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 280 27 view .LVU3
+	movzbl	%dil, %ebx
+.LVL1:
+.LBB43:
+.LBI43:
+	.loc 1 273 16 is_stmt 1 view .LVU4
+.LBB44:
+	.loc 1 275 5 view .LVU5
+.LBE44:
+.LBE43:
+	.loc 1 280 37 is_stmt 0 view .LVU6
+	salq	$4, %rbx
+	.loc 1 279 1 view .LVU7
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB47:
+.LBB45:
+	.loc 1 275 12 view .LVU8
+	movss	.LC0(%rip), %xmm0
+	mulss	(%rsi), %xmm0
+	call	lrintf@PLT
+.LVL2:
+	.loc 1 275 12 view .LVU9
+.LBE45:
+.LBE47:
+.LBB48:
+.LBB49:
+	movss	.LC0(%rip), %xmm0
+	mulss	4(%rbp), %xmm0
+.LBE49:
+.LBE48:
+	.loc 1 280 37 view .LVU10
+	leaq	motorMixWeights(%rip), %rdx
+	addq	%rdx, %rbx
+.LBB52:
+.LBB46:
+	.loc 1 275 12 view .LVU11
+	movl	%eax, (%rbx)
+.LBE46:
+.LBE52:
+	.loc 1 281 5 is_stmt 1 view .LVU12
+.LVL3:
+.LBB53:
+.LBI48:
+	.loc 1 273 16 view .LVU13
+.LBB50:
+	.loc 1 275 5 view .LVU14
+	.loc 1 275 12 is_stmt 0 view .LVU15
+	call	lrintf@PLT
+.LVL4:
+	.loc 1 275 12 view .LVU16
+.LBE50:
+.LBE53:
+.LBB54:
+.LBB55:
+	movss	.LC0(%rip), %xmm0
+	mulss	8(%rbp), %xmm0
+.LBE55:
+.LBE54:
+.LBB58:
+.LBB51:
+	movl	%eax, 4(%rbx)
+.LBE51:
+.LBE58:
+	.loc 1 282 5 is_stmt 1 view .LVU17
+.LVL5:
+.LBB59:
+.LBI54:
+	.loc 1 273 16 view .LVU18
+.LBB56:
+	.loc 1 275 5 view .LVU19
+	.loc 1 275 12 is_stmt 0 view .LVU20
+	call	lrintf@PLT
+.LVL6:
+	.loc 1 275 12 view .LVU21
+.LBE56:
+.LBE59:
+.LBB60:
+.LBB61:
+	movss	.LC0(%rip), %xmm0
+	mulss	12(%rbp), %xmm0
+.LBE61:
+.LBE60:
+.LBB63:
+.LBB57:
+	movl	%eax, 8(%rbx)
+.LBE57:
+.LBE63:
+	.loc 1 283 5 is_stmt 1 view .LVU22
+.LVL7:
+.LBB64:
+.LBI60:
+	.loc 1 273 16 view .LVU23
+.LBB62:
+	.loc 1 275 5 view .LVU24
+	.loc 1 275 12 is_stmt 0 view .LVU25
+	call	lrintf@PLT
+.LVL8:
+	.loc 1 275 12 view .LVU26
+	movl	%eax, 12(%rbx)
+.LBE62:
+.LBE64:
+	.loc 1 284 1 view .LVU27
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL9:
+	.loc 1 284 1 view .LVU28
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	loadMotorMixWeights, .-loadMotorMixWeights
+	.section	.text.mixerUseConfigs,"ax",@progbits
+	.p2align 4
+	.globl	mixerUseConfigs
+	.type	mixerUseConfigs, @function
+mixerUseConfigs:
+.LVL10:
+.LFB11:
+	.loc 1 219 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 220 5 view .LVU30
+	.loc 1 226 18 is_stmt 0 view .LVU31
+	movq	8(%rsp), %rax
+	.loc 1 220 15 view .LVU32
+	movq	%rdi, servoConf(%rip)
+	.loc 1 221 5 is_stmt 1 view .LVU33
+	.loc 1 221 20 is_stmt 0 view .LVU34
+	movq	%rsi, flight3DConfig(%rip)
+	.loc 1 222 5 is_stmt 1 view .LVU35
+	.loc 1 222 23 is_stmt 0 view .LVU36
+	movq	%rdx, escAndServoConfig(%rip)
+	.loc 1 223 5 is_stmt 1 view .LVU37
+	.loc 1 223 17 is_stmt 0 view .LVU38
+	movq	%rcx, mixerConfig(%rip)
+	.loc 1 224 5 is_stmt 1 view .LVU39
+	.loc 1 224 20 is_stmt 0 view .LVU40
+	movq	%r8, airplaneConfig(%rip)
+	.loc 1 225 5 is_stmt 1 view .LVU41
+	.loc 1 225 14 is_stmt 0 view .LVU42
+	movq	%r9, rxConfig(%rip)
+	.loc 1 226 5 is_stmt 1 view .LVU43
+	.loc 1 226 18 is_stmt 0 view .LVU44
+	movq	%rax, gimbalConfig(%rip)
+	.loc 1 227 1 view .LVU45
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	mixerUseConfigs, .-mixerUseConfigs
+	.section	.text.determineServoMiddleOrForwardFromChannel,"ax",@progbits
+	.p2align 4
+	.globl	determineServoMiddleOrForwardFromChannel
+	.type	determineServoMiddleOrForwardFromChannel, @function
+determineServoMiddleOrForwardFromChannel:
+.LVL11:
+.LFB12:
+	.loc 1 230 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 231 5 view .LVU47
+	.loc 1 231 45 is_stmt 0 view .LVU48
+	movq	servoConf(%rip), %rax
+	movslq	%edi, %rdx
+	leaq	(%rax,%rdx,8), %rdx
+	.loc 1 231 13 view .LVU49
+	movzbl	7(%rdx), %eax
+.LVL12:
+	.loc 1 233 5 is_stmt 1 view .LVU50
+	.loc 1 233 8 is_stmt 0 view .LVU51
+	cmpb	$-1, %al
+	je	.L6
+	.loc 1 233 47 discriminator 1 view .LVU52
+	cmpb	rxRuntimeConfig(%rip), %al
+	jb	.L12
+.L6:
+	.loc 1 237 5 is_stmt 1 view .LVU53
+	.loc 1 241 12 is_stmt 0 view .LVU54
+	movl	$1500, %eax
+.LVL13:
+	.loc 1 237 8 view .LVU55
+	cmpl	$7, %edi
+	jle	.L13
+	.loc 1 242 1 view .LVU56
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 238 9 is_stmt 1 view .LVU57
+	.loc 1 238 29 is_stmt 0 view .LVU58
+	movzwl	4(%rdx), %eax
+	.loc 1 242 1 view .LVU59
+	ret
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 234 9 is_stmt 1 view .LVU60
+	.loc 1 234 22 is_stmt 0 view .LVU61
+	leaq	rcData(%rip), %rdx
+	movzwl	(%rdx,%rax,2), %eax
+.LVL15:
+	.loc 1 234 22 view .LVU62
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	determineServoMiddleOrForwardFromChannel, .-determineServoMiddleOrForwardFromChannel
+	.section	.text.servoDirection,"ax",@progbits
+	.p2align 4
+	.globl	servoDirection
+	.type	servoDirection, @function
+servoDirection:
+.LVL16:
+.LFB13:
+	.loc 1 245 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 252 5 view .LVU64
+	.loc 1 252 22 is_stmt 0 view .LVU65
+	movq	servoConf(%rip), %rax
+	.loc 1 252 18 view .LVU66
+	movslq	%edi, %rdi
+	.loc 1 252 22 view .LVU67
+	movsbl	6(%rax,%rdi,8), %eax
+	.loc 1 252 28 view .LVU68
+	andl	%esi, %eax
+	.loc 1 253 16 view .LVU69
+	cmpl	$1, %eax
+	sbbl	%eax, %eax
+	andl	$2, %eax
+	subl	$1, %eax
+	.loc 1 256 1 view .LVU70
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	servoDirection, .-servoDirection
+	.section	.text.mixerInit,"ax",@progbits
+	.p2align 4
+	.globl	mixerInit
+	.type	mixerInit, @function
+mixerInit:
+.LVL17:
+.LFB14:
+	.loc 1 261 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 262 5 view .LVU72
+	.loc 1 261 1 is_stmt 0 view .LVU73
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 262 31 view .LVU74
+	movl	%edi, currentMixerConfiguration(%rip)
+	.loc 1 264 5 is_stmt 1 view .LVU75
+	.loc 1 267 49 is_stmt 0 view .LVU76
+	movl	%edi, %edi
+.LVL18:
+	.loc 1 267 49 view .LVU77
+	leaq	mixers(%rip), %rax
+	salq	$4, %rdi
+	.loc 1 264 18 view .LVU78
+	movq	%rsi, customMixers(%rip)
+	.loc 1 267 5 is_stmt 1 view .LVU79
+	.loc 1 267 49 is_stmt 0 view .LVU80
+	movzbl	1(%rax,%rdi), %eax
+	.loc 1 269 9 view .LVU81
+	movl	$32, %edi
+	.loc 1 267 49 view .LVU82
+	movl	%eax, useServo(%rip)
+	.loc 1 269 5 is_stmt 1 view .LVU83
+	.loc 1 269 9 is_stmt 0 view .LVU84
+	call	feature@PLT
+.LVL19:
+	.loc 1 269 8 view .LVU85
+	testb	%al, %al
+	je	.L17
+	.loc 1 270 9 is_stmt 1 view .LVU86
+	.loc 1 270 18 is_stmt 0 view .LVU87
+	movl	$1, useServo(%rip)
+.L17:
+	.loc 1 271 1 view .LVU88
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	mixerInit, .-mixerInit
+	.section	.text.mixerUsePWMOutputConfiguration,"ax",@progbits
+	.p2align 4
+	.globl	mixerUsePWMOutputConfiguration
+	.type	mixerUsePWMOutputConfiguration, @function
+mixerUsePWMOutputConfiguration:
+.LVL20:
+.LFB17:
+	.loc 1 287 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 288 5 view .LVU90
+	.loc 1 290 5 view .LVU91
+	.loc 1 287 1 is_stmt 0 view .LVU92
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 290 16 view .LVU93
+	movzbl	(%rdi), %eax
+	movb	%al, servoCount(%rip)
+	.loc 1 292 5 is_stmt 1 view .LVU94
+	.loc 1 292 35 is_stmt 0 view .LVU95
+	movl	currentMixerConfiguration(%rip), %eax
+	.loc 1 292 8 view .LVU96
+	cmpl	$22, %eax
+	je	.L51
+	.loc 1 303 9 is_stmt 1 view .LVU97
+	.loc 1 303 56 is_stmt 0 view .LVU98
+	leaq	mixers(%rip), %rdx
+	salq	$4, %rax
+	addq	%rdx, %rax
+	movzbl	(%rax), %edx
+	.loc 1 305 46 view .LVU99
+	movq	8(%rax), %rbp
+	.loc 1 303 21 view .LVU100
+	movb	%dl, numberMotor(%rip)
+	.loc 1 305 9 is_stmt 1 view .LVU101
+	.loc 1 305 12 is_stmt 0 view .LVU102
+	testq	%rbp, %rbp
+	je	.L30
+.LVL21:
+	.loc 1 306 27 is_stmt 1 view .LVU103
+	movzbl	%dl, %r12d
+	testb	%dl, %dl
+	je	.L30
+	.loc 1 306 20 is_stmt 0 view .LVU104
+	xorl	%ebx, %ebx
+.LVL22:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.loc 1 307 17 is_stmt 1 discriminator 3 view .LVU105
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	.loc 1 306 43 is_stmt 0 discriminator 3 view .LVU106
+	addl	$1, %ebx
+.LVL23:
+	.loc 1 306 27 discriminator 3 view .LVU107
+	addq	$16, %rbp
+	.loc 1 307 17 discriminator 3 view .LVU108
+	call	loadMotorMixWeights
+.LVL24:
+	.loc 1 306 43 is_stmt 1 discriminator 3 view .LVU109
+	.loc 1 306 27 discriminator 3 view .LVU110
+	cmpl	%r12d, %ebx
+	jne	.L31
+.LVL25:
+.L30:
+	.loc 1 312 5 view .LVU111
+	.loc 1 312 9 is_stmt 0 view .LVU112
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL26:
+	.loc 1 312 8 view .LVU113
+	testb	%al, %al
+	je	.L28
+	.loc 1 313 9 is_stmt 1 view .LVU114
+	.loc 1 313 25 is_stmt 0 view .LVU115
+	movzbl	numberMotor(%rip), %edx
+	.loc 1 313 12 view .LVU116
+	cmpb	$1, %dl
+	jbe	.L28
+.LVL27:
+	.loc 1 314 27 is_stmt 1 view .LVU117
+	leal	-1(%rdx), %esi
+	leaq	4+motorMixWeights(%rip), %rax
+	.loc 1 316 41 is_stmt 0 view .LVU118
+	pxor	%xmm2, %xmm2
+	salq	$4, %rsi
+	leaq	16(%rax), %rdx
+	addq	%rdx, %rsi
+.LVL28:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 315 17 is_stmt 1 discriminator 3 view .LVU119
+	.loc 1 316 35 is_stmt 0 discriminator 3 view .LVU120
+	movq	(%rax), %xmm0
+	.loc 1 316 17 is_stmt 1 discriminator 3 view .LVU121
+	.loc 1 316 41 is_stmt 0 discriminator 3 view .LVU122
+	movdqa	%xmm2, %xmm1
+	.loc 1 317 40 discriminator 3 view .LVU123
+	movl	8(%rax), %ecx
+	.loc 1 314 27 discriminator 3 view .LVU124
+	addq	$16, %rax
+.LVL29:
+	.loc 1 316 41 discriminator 3 view .LVU125
+	pcmpgtd	%xmm0, %xmm1
+	.loc 1 317 40 discriminator 3 view .LVU126
+	movl	%ecx, %edx
+	shrl	$31, %edx
+	addl	%ecx, %edx
+	.loc 1 316 41 discriminator 3 view .LVU127
+	psubd	%xmm1, %xmm0
+	.loc 1 317 40 discriminator 3 view .LVU128
+	sarl	%edx
+	movl	%edx, -8(%rax)
+	.loc 1 316 41 discriminator 3 view .LVU129
+	psrad	$1, %xmm0
+	movq	%xmm0, -16(%rax)
+	.loc 1 317 17 is_stmt 1 discriminator 3 view .LVU130
+	.loc 1 314 43 discriminator 3 view .LVU131
+.LVL30:
+	.loc 1 314 27 discriminator 3 view .LVU132
+	cmpq	%rsi, %rax
+	jne	.L34
+.L28:
+	.loc 1 323 5 view .LVU133
+	.loc 1 323 60 is_stmt 0 view .LVU134
+	movl	currentMixerConfiguration(%rip), %edx
+	.loc 1 325 21 view .LVU135
+	movzbl	stateFlags(%rip), %eax
+	.loc 1 323 8 view .LVU136
+	cmpl	$8, %edx
+	je	.L32
+	cmpl	$14, %edx
+	je	.L32
+	.loc 1 327 9 is_stmt 1 view .LVU137
+	.loc 1 327 21 is_stmt 0 view .LVU138
+	andl	$-17, %eax
+.L36:
+	leaq	motor_disarmed(%rip), %rbx
+	movb	%al, stateFlags(%rip)
+.LVL31:
+.LBB67:
+.LBB68:
+	.loc 1 336 19 is_stmt 1 view .LVU139
+	leaq	24(%rbx), %rbp
+	jmp	.L35
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 337 65 is_stmt 0 view .LVU140
+	movq	flight3DConfig(%rip), %rax
+	.loc 1 336 19 view .LVU141
+	addq	$2, %rbx
+.LVL33:
+	.loc 1 337 27 view .LVU142
+	movzwl	4(%rax), %eax
+	movw	%ax, -2(%rbx)
+	.loc 1 336 26 is_stmt 1 view .LVU143
+.LVL34:
+	.loc 1 336 19 view .LVU144
+	cmpq	%rbp, %rbx
+	je	.L52
+.L35:
+.LVL35:
+	.loc 1 337 9 view .LVU145
+	.loc 1 337 29 is_stmt 0 view .LVU146
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL36:
+	.loc 1 337 27 view .LVU147
+	testb	%al, %al
+	jne	.L53
+	.loc 1 337 96 view .LVU148
+	movq	escAndServoConfig(%rip), %rax
+	.loc 1 336 19 view .LVU149
+	addq	$2, %rbx
+.LVL37:
+	.loc 1 337 27 view .LVU150
+	movzwl	4(%rax), %eax
+	movw	%ax, -2(%rbx)
+	.loc 1 336 26 is_stmt 1 view .LVU151
+.LVL38:
+	.loc 1 336 19 view .LVU152
+	cmpq	%rbp, %rbx
+	jne	.L35
+.L52:
+.LBE68:
+.LBE67:
+	.loc 1 330 1 is_stmt 0 view .LVU153
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.cfi_restore_state
+	.loc 1 325 9 is_stmt 1 view .LVU154
+	.loc 1 325 21 is_stmt 0 view .LVU155
+	orl	$16, %eax
+	jmp	.L36
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+	.loc 1 294 9 is_stmt 1 view .LVU156
+	movq	customMixers(%rip), %rbx
+	.loc 1 294 21 is_stmt 0 view .LVU157
+	movb	$0, numberMotor(%rip)
+	.loc 1 295 9 is_stmt 1 view .LVU158
+.LVL40:
+	.loc 1 295 23 view .LVU159
+	.loc 1 297 16 is_stmt 0 view .LVU160
+	xorl	%r12d, %r12d
+	leaq	192(%rbx), %r13
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 297 13 is_stmt 1 view .LVU161
+	.loc 1 297 16 is_stmt 0 view .LVU162
+	movd	%r12d, %xmm3
+	ucomiss	(%rbx), %xmm3
+	jp	.L25
+	je	.L30
+.L25:
+	.loc 1 299 13 is_stmt 1 discriminator 2 view .LVU163
+	movzbl	numberMotor(%rip), %edi
+	movq	%rbx, %rsi
+	.loc 1 295 23 is_stmt 0 discriminator 2 view .LVU164
+	addq	$16, %rbx
+.LVL42:
+	.loc 1 299 13 discriminator 2 view .LVU165
+	movl	%edi, %ebp
+	call	loadMotorMixWeights
+.LVL43:
+	.loc 1 300 13 is_stmt 1 discriminator 2 view .LVU166
+	.loc 1 300 24 is_stmt 0 discriminator 2 view .LVU167
+	addl	$1, %ebp
+	movb	%bpl, numberMotor(%rip)
+	.loc 1 295 30 is_stmt 1 discriminator 2 view .LVU168
+.LVL44:
+	.loc 1 295 23 discriminator 2 view .LVU169
+	cmpq	%r13, %rbx
+	jne	.L29
+	jmp	.L30
+	.cfi_endproc
+.LFE17:
+	.size	mixerUsePWMOutputConfiguration, .-mixerUsePWMOutputConfiguration
+	.section	.text.mixerResetMotors,"ax",@progbits
+	.p2align 4
+	.globl	mixerResetMotors
+	.type	mixerResetMotors, @function
+mixerResetMotors:
+.LFB18:
+	.loc 1 333 1 view -0
+	.cfi_startproc
+	.loc 1 334 5 view .LVU171
+	.loc 1 336 5 view .LVU172
+.LVL45:
+	.loc 1 336 19 view .LVU173
+	.loc 1 333 1 is_stmt 0 view .LVU174
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	leaq	motor_disarmed(%rip), %rbx
+	leaq	24(%rbx), %rbp
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	jmp	.L57
+.LVL46:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.loc 1 337 65 discriminator 1 view .LVU175
+	movq	flight3DConfig(%rip), %rax
+	.loc 1 336 19 discriminator 1 view .LVU176
+	addq	$2, %rbx
+.LVL47:
+	.loc 1 337 27 discriminator 1 view .LVU177
+	movzwl	4(%rax), %eax
+	movw	%ax, -2(%rbx)
+	.loc 1 336 26 is_stmt 1 discriminator 1 view .LVU178
+.LVL48:
+	.loc 1 336 19 discriminator 1 view .LVU179
+	cmpq	%rbp, %rbx
+	je	.L60
+.L57:
+.LVL49:
+	.loc 1 337 9 view .LVU180
+	.loc 1 337 29 is_stmt 0 view .LVU181
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL50:
+	.loc 1 337 27 view .LVU182
+	testb	%al, %al
+	jne	.L61
+	.loc 1 337 96 discriminator 2 view .LVU183
+	movq	escAndServoConfig(%rip), %rax
+	.loc 1 336 19 discriminator 2 view .LVU184
+	addq	$2, %rbx
+.LVL51:
+	.loc 1 337 27 discriminator 2 view .LVU185
+	movzwl	4(%rax), %eax
+	movw	%ax, -2(%rbx)
+	.loc 1 336 26 is_stmt 1 discriminator 2 view .LVU186
+.LVL52:
+	.loc 1 336 19 discriminator 2 view .LVU187
+	cmpq	%rbp, %rbx
+	jne	.L57
+.L60:
+	.loc 1 338 1 is_stmt 0 view .LVU188
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	mixerResetMotors, .-mixerResetMotors
+	.section	.text.mixerLoadMix,"ax",@progbits
+	.p2align 4
+	.globl	mixerLoadMix
+	.type	mixerLoadMix, @function
+mixerLoadMix:
+.LVL53:
+.LFB19:
+	.loc 1 341 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 342 5 view .LVU190
+	.loc 1 345 5 view .LVU191
+	.loc 1 345 10 is_stmt 0 view .LVU192
+	addl	$1, %edi
+.LVL54:
+	.loc 1 347 5 is_stmt 1 view .LVU193
+	.loc 1 347 19 view .LVU194
+	movq	%rsi, %rax
+	leaq	192(%rsi), %rdx
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.loc 1 348 9 discriminator 3 view .LVU195
+	.loc 1 348 34 is_stmt 0 discriminator 3 view .LVU196
+	movl	$0x00000000, (%rax)
+	.loc 1 347 26 is_stmt 1 discriminator 3 view .LVU197
+.LVL56:
+	.loc 1 347 19 discriminator 3 view .LVU198
+	addq	$16, %rax
+.LVL57:
+	.loc 1 347 19 is_stmt 0 discriminator 3 view .LVU199
+	cmpq	%rdx, %rax
+	jne	.L63
+	.loc 1 351 5 is_stmt 1 view .LVU200
+	.loc 1 351 22 is_stmt 0 view .LVU201
+	movslq	%edi, %rdi
+	.loc 1 351 22 view .LVU202
+	leaq	mixers(%rip), %rax
+.LVL58:
+	.loc 1 351 22 view .LVU203
+	salq	$4, %rdi
+.LVL59:
+	.loc 1 351 22 view .LVU204
+	addq	%rdi, %rax
+	movq	8(%rax), %rcx
+	.loc 1 351 8 view .LVU205
+	testq	%rcx, %rcx
+	je	.L62
+.LVL60:
+	.loc 1 352 23 is_stmt 1 view .LVU206
+	.loc 1 352 38 is_stmt 0 view .LVU207
+	movzbl	(%rax), %edx
+	.loc 1 352 23 view .LVU208
+	testb	%dl, %dl
+	je	.L62
+	salq	$4, %rdx
+	xorl	%eax, %eax
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.loc 1 353 13 is_stmt 1 discriminator 3 view .LVU209
+	.loc 1 353 29 is_stmt 0 discriminator 3 view .LVU210
+	movdqu	(%rcx,%rax), %xmm0
+	movups	%xmm0, (%rsi,%rax)
+	.loc 1 352 53 is_stmt 1 discriminator 3 view .LVU211
+.LVL62:
+	.loc 1 352 23 discriminator 3 view .LVU212
+	addq	$16, %rax
+.LVL63:
+	.loc 1 352 23 is_stmt 0 discriminator 3 view .LVU213
+	cmpq	%rdx, %rax
+	jne	.L65
+.LVL64:
+.L62:
+	.loc 1 355 1 view .LVU214
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	mixerLoadMix, .-mixerLoadMix
+	.section	.text.writeServos,"ax",@progbits
+	.p2align 4
+	.globl	writeServos
+	.type	writeServos, @function
+writeServos:
+.LFB21:
+	.loc 1 364 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 365 5 view .LVU216
+	.loc 1 365 8 is_stmt 0 view .LVU217
+	movl	useServo(%rip), %eax
+	testl	%eax, %eax
+	je	.L90
+	.loc 1 368 5 is_stmt 1 view .LVU218
+	.loc 1 364 1 is_stmt 0 view .LVU219
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 368 5 view .LVU220
+	cmpl	$21, currentMixerConfiguration(%rip)
+	ja	.L77
+	movl	currentMixerConfiguration(%rip), %eax
+	leaq	.L79(%rip), %rdx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.writeServos,"a",@progbits
+	.align 4
+	.align 4
+.L79:
+	.long	.L77-.L79
+	.long	.L83-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L80-.L79
+	.long	.L93-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L81-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L78-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L77-.L79
+	.long	.L80-.L79
+	.long	.L78-.L79
+	.section	.text.writeServos
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.loc 1 411 13 is_stmt 1 view .LVU221
+	.loc 1 411 17 is_stmt 0 view .LVU222
+	movl	$32, %edi
+	call	feature@PLT
+.LVL65:
+	.loc 1 411 16 view .LVU223
+	testb	%al, %al
+	jne	.L93
+	.loc 1 416 1 view .LVU224
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.cfi_restore_state
+	.loc 1 370 13 is_stmt 1 view .LVU225
+	movzwl	8+servo(%rip), %esi
+	xorl	%edi, %edi
+	call	pwmWriteServo@PLT
+.LVL66:
+	.loc 1 371 13 view .LVU226
+	movzwl	10+servo(%rip), %esi
+	movl	$1, %edi
+	.loc 1 416 1 is_stmt 0 view .LVU227
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 371 13 view .LVU228
+	jmp	pwmWriteServo@PLT
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.cfi_restore_state
+	.loc 1 403 13 is_stmt 1 view .LVU229
+	movzwl	6+servo(%rip), %esi
+	xorl	%edi, %edi
+	call	pwmWriteServo@PLT
+.LVL68:
+	.loc 1 404 13 view .LVU230
+	movzwl	8+servo(%rip), %esi
+	movl	$1, %edi
+	call	pwmWriteServo@PLT
+.LVL69:
+	.loc 1 405 13 view .LVU231
+	movzwl	10+servo(%rip), %esi
+	movl	$2, %edi
+	call	pwmWriteServo@PLT
+.LVL70:
+	.loc 1 406 13 view .LVU232
+	movzwl	12+servo(%rip), %esi
+	movl	$3, %edi
+	.loc 1 416 1 is_stmt 0 view .LVU233
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 406 13 view .LVU234
+	jmp	pwmWriteServo@PLT
+.LVL71:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.cfi_restore_state
+	.loc 1 412 17 is_stmt 1 view .LVU235
+.LBB73:
+.LBI73:
+	.loc 1 357 13 view .LVU236
+.LBB74:
+	.loc 1 359 5 view .LVU237
+	movzwl	servo(%rip), %esi
+	xorl	%edi, %edi
+	call	pwmWriteServo@PLT
+.LVL72:
+	.loc 1 360 5 view .LVU238
+	movzwl	2+servo(%rip), %esi
+	movl	$1, %edi
+.LBE74:
+.LBE73:
+	.loc 1 416 1 is_stmt 0 view .LVU239
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LBB76:
+.LBB75:
+	.loc 1 360 5 view .LVU240
+	jmp	pwmWriteServo@PLT
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.cfi_restore_state
+.LBE75:
+.LBE76:
+	.loc 1 388 13 is_stmt 1 view .LVU241
+	movzwl	6+servo(%rip), %esi
+	xorl	%edi, %edi
+	call	pwmWriteServo@PLT
+.LVL74:
+	.loc 1 389 13 view .LVU242
+	movzwl	8+servo(%rip), %esi
+	movl	$1, %edi
+	.loc 1 416 1 is_stmt 0 view .LVU243
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 389 13 view .LVU244
+	jmp	pwmWriteServo@PLT
+.LVL75:
+	.p2align 4,,10
+	.p2align 3
+.L83:
+	.cfi_restore_state
+	.loc 1 375 13 is_stmt 1 view .LVU245
+	.loc 1 380 17 view .LVU246
+	.loc 1 380 20 is_stmt 0 view .LVU247
+	movzbl	armingFlags(%rip), %eax
+	movq	mixerConfig(%rip), %rdx
+	andl	$4, %eax
+	orb	1(%rdx), %al
+	je	.L84
+	.loc 1 377 17 is_stmt 1 view .LVU248
+	movzwl	10+servo(%rip), %esi
+	xorl	%edi, %edi
+	.loc 1 416 1 is_stmt 0 view .LVU249
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 377 17 view .LVU250
+	jmp	pwmWriteServo@PLT
+.LVL76:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.cfi_def_cfa_offset 16
+	.loc 1 383 21 is_stmt 1 view .LVU251
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+	.loc 1 416 1 is_stmt 0 view .LVU252
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 383 21 view .LVU253
+	jmp	pwmWriteServo@PLT
+.LVL77:
+	.cfi_endproc
+.LFE21:
+	.size	writeServos, .-writeServos
+	.section	.text.writeMotors,"ax",@progbits
+	.p2align 4
+	.globl	writeMotors
+	.type	writeMotors, @function
+writeMotors:
+.LFB22:
+	.loc 1 419 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 420 5 view .LVU255
+	.loc 1 422 5 view .LVU256
+.LVL78:
+	.loc 1 422 19 view .LVU257
+	.loc 1 419 1 is_stmt 0 view .LVU258
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 422 19 view .LVU259
+	cmpb	$0, numberMotor(%rip)
+	je	.L95
+	.loc 1 422 12 view .LVU260
+	xorl	%ebx, %ebx
+	leaq	motor(%rip), %rbp
+.LVL79:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.loc 1 423 9 is_stmt 1 discriminator 3 view .LVU261
+	.loc 1 423 31 is_stmt 0 discriminator 3 view .LVU262
+	movzbl	%bl, %eax
+	movzbl	%bl, %edi
+	.loc 1 422 35 discriminator 3 view .LVU263
+	addl	$1, %ebx
+.LVL80:
+	.loc 1 423 9 discriminator 3 view .LVU264
+	movzwl	0(%rbp,%rax,2), %esi
+	call	pwmWriteMotor@PLT
+.LVL81:
+	.loc 1 422 35 is_stmt 1 discriminator 3 view .LVU265
+	.loc 1 422 19 discriminator 3 view .LVU266
+	cmpb	numberMotor(%rip), %bl
+	jb	.L96
+.LVL82:
+.L95:
+	.loc 1 426 5 view .LVU267
+	.loc 1 426 9 is_stmt 0 view .LVU268
+	movl	$524288, %edi
+	call	feature@PLT
+.LVL83:
+	.loc 1 426 8 view .LVU269
+	testb	%al, %al
+	jne	.L98
+	.loc 1 426 40 discriminator 1 view .LVU270
+	movl	$1048576, %edi
+	call	feature@PLT
+.LVL84:
+	.loc 1 426 37 discriminator 1 view .LVU271
+	testb	%al, %al
+	je	.L101
+.L98:
+	.loc 1 427 9 is_stmt 1 view .LVU272
+	movzbl	numberMotor(%rip), %edi
+	.loc 1 429 1 is_stmt 0 view .LVU273
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	.loc 1 427 9 view .LVU274
+	jmp	pwmCompleteMotorUpdate@PLT
+.LVL85:
+	.p2align 4,,10
+	.p2align 3
+.L101:
+	.cfi_restore_state
+	.loc 1 429 1 view .LVU275
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	writeMotors, .-writeMotors
+	.section	.text.writeAllMotors,"ax",@progbits
+	.p2align 4
+	.globl	writeAllMotors
+	.type	writeAllMotors, @function
+writeAllMotors:
+.LVL86:
+.LFB23:
+	.loc 1 432 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 433 5 view .LVU277
+	.loc 1 436 5 view .LVU278
+	.loc 1 436 19 view .LVU279
+	movzbl	numberMotor(%rip), %edx
+	testb	%dl, %dl
+	je	.L103
+	leaq	motor(%rip), %rax
+	leaq	(%rax,%rdx,2), %rdx
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L104:
+	.loc 1 437 9 discriminator 3 view .LVU280
+	.loc 1 437 18 is_stmt 0 discriminator 3 view .LVU281
+	movw	%di, (%rax)
+	.loc 1 436 35 is_stmt 1 discriminator 3 view .LVU282
+.LVL88:
+	.loc 1 436 19 discriminator 3 view .LVU283
+	addq	$2, %rax
+.LVL89:
+	.loc 1 436 19 is_stmt 0 discriminator 3 view .LVU284
+	cmpq	%rdx, %rax
+	jne	.L104
+.LVL90:
+.L103:
+	.loc 1 438 5 is_stmt 1 view .LVU285
+	jmp	writeMotors
+.LVL91:
+	.loc 1 438 5 is_stmt 0 view .LVU286
+	.cfi_endproc
+.LFE23:
+	.size	writeAllMotors, .-writeAllMotors
+	.section	.text.mixTable,"ax",@progbits
+	.p2align 4
+	.globl	mixTable
+	.type	mixTable, @function
+mixTable:
+.LFB27:
+	.loc 1 561 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 562 5 view .LVU288
+	.loc 1 563 5 view .LVU289
+	.loc 1 565 4 view .LVU290
+	.loc 1 561 1 is_stmt 0 view .LVU291
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 565 45 view .LVU292
+	testb	$4, armingFlags(%rip)
+	jne	.L307
+.L110:
+	.loc 1 567 5 is_stmt 1 discriminator 8 view .LVU293
+.LVL92:
+.LBB143:
+.LBI143:
+	.loc 1 488 13 discriminator 8 view .LVU294
+.LBB144:
+	.loc 1 490 5 discriminator 8 view .LVU295
+	.loc 1 490 9 is_stmt 0 discriminator 8 view .LVU296
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL93:
+	.loc 1 490 8 discriminator 8 view .LVU297
+	testb	%al, %al
+	je	.L111
+	.loc 1 491 9 is_stmt 1 view .LVU298
+	.loc 1 491 42 is_stmt 0 view .LVU299
+	movq	rxConfig(%rip), %rax
+	.loc 1 491 20 view .LVU300
+	movswl	6+rcData(%rip), %edx
+	.loc 1 492 40 view .LVU301
+	movq	flight3DConfig(%rip), %rcx
+	.loc 1 493 43 view .LVU302
+	movq	escAndServoConfig(%rip), %rsi
+	.loc 1 491 42 view .LVU303
+	movzwl	10(%rax), %eax
+	.loc 1 491 12 view .LVU304
+	cmpl	%eax, %edx
+	jle	.L112
+	.loc 1 492 13 is_stmt 1 view .LVU305
+	.loc 1 492 40 is_stmt 0 view .LVU306
+	movswl	2(%rcx), %ebx
+.LVL94:
+	.loc 1 493 13 is_stmt 1 view .LVU307
+.LBE144:
+.LBE143:
+	.loc 1 569 21 is_stmt 0 view .LVU308
+	movzbl	numberMotor(%rip), %ecx
+.LBB148:
+.LBB145:
+	.loc 1 493 43 view .LVU309
+	movswl	2(%rsi), %ebp
+.LVL95:
+	.loc 1 493 43 view .LVU310
+.LBE145:
+.LBE148:
+	.loc 1 569 5 is_stmt 1 view .LVU311
+	.loc 1 569 8 is_stmt 0 view .LVU312
+	cmpb	$3, %cl
+	jbe	.L114
+.L309:
+	.loc 1 571 9 is_stmt 1 view .LVU313
+	.loc 1 571 166 is_stmt 0 view .LVU314
+	movzwl	4+rcCommand(%rip), %edx
+	.loc 1 571 24 view .LVU315
+	movswl	4+axisPID(%rip), %edi
+	movl	$-100, %esi
+	.loc 1 571 166 view .LVU316
+	movl	%edx, %eax
+	negw	%ax
+	cmovs	%edx, %eax
+	movzwl	%ax, %eax
+	.loc 1 571 24 view .LVU317
+	leal	100(%rax), %edx
+	subl	%eax, %esi
+	call	constrain@PLT
+.LVL96:
+	.loc 1 575 21 view .LVU318
+	movzbl	numberMotor(%rip), %ecx
+	.loc 1 575 5 is_stmt 1 view .LVU319
+	.loc 1 571 22 is_stmt 0 view .LVU320
+	movw	%ax, 4+axisPID(%rip)
+	.loc 1 575 25 view .LVU321
+	cmpb	$1, %cl
+	ja	.L308
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.loc 1 579 5 is_stmt 1 view .LVU322
+	cmpl	$21, currentMixerConfiguration(%rip)
+	ja	.L128
+	movl	currentMixerConfiguration(%rip), %eax
+	leaq	.L130(%rip), %rdx
+	movslq	(%rdx,%rax,4), %rax
+	addq	%rdx, %rax
+	jmp	*%rax
+	.section	.rodata.mixTable,"a",@progbits
+	.align 4
+	.align 4
+.L130:
+	.long	.L128-.L130
+	.long	.L136-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L135-.L130
+	.long	.L134-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L133-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L132-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L128-.L130
+	.long	.L131-.L130
+	.long	.L129-.L130
+	.section	.text.mixTable
+.LVL97:
+	.p2align 4,,10
+	.p2align 3
+.L111:
+.LBB149:
+.LBB146:
+	.loc 1 499 9 view .LVU323
+	.loc 1 499 39 is_stmt 0 view .LVU324
+	movq	escAndServoConfig(%rip), %rax
+	movswl	(%rax), %ebx
+.LVL98:
+	.loc 1 500 9 is_stmt 1 view .LVU325
+	.loc 1 500 39 is_stmt 0 view .LVU326
+	movswl	2(%rax), %ebp
+.LVL99:
+.L113:
+	.loc 1 500 39 view .LVU327
+.LBE146:
+.LBE149:
+	.loc 1 569 5 is_stmt 1 view .LVU328
+	.loc 1 569 21 is_stmt 0 view .LVU329
+	movzbl	numberMotor(%rip), %ecx
+	.loc 1 569 8 view .LVU330
+	cmpb	$3, %cl
+	ja	.L309
+.L114:
+	.loc 1 575 5 is_stmt 1 view .LVU331
+	.loc 1 575 25 is_stmt 0 view .LVU332
+	cmpb	$1, %cl
+	jbe	.L115
+.L308:
+	.loc 1 575 25 view .LVU333
+	testb	%r12b, %r12b
+	je	.L115
+	.loc 1 576 9 is_stmt 1 view .LVU334
+.LBB150:
+.LBB151:
+	.loc 1 516 31 is_stmt 0 view .LVU335
+	movq	mixerConfig(%rip), %rax
+.LBE151:
+.LBE150:
+	.loc 1 576 9 view .LVU336
+	movswl	%bp, %r11d
+	movswl	%bx, %esi
+.LVL100:
+.LBB155:
+.LBI150:
+	.loc 1 510 13 is_stmt 1 view .LVU337
+.LBB152:
+	.loc 1 512 5 view .LVU338
+	.loc 1 513 5 view .LVU339
+	.loc 1 514 5 view .LVU340
+	.loc 1 515 5 view .LVU341
+	.loc 1 513 28 is_stmt 0 view .LVU342
+	xorl	%edi, %edi
+	.loc 1 515 13 view .LVU343
+	movl	%r11d, %r14d
+	movl	%r11d, 12(%rsp)
+	.loc 1 513 13 view .LVU344
+	xorl	%r8d, %r8d
+	leaq	16(%rsp), %r9
+	.loc 1 516 31 view .LVU345
+	movsbl	(%rax), %r10d
+	.loc 1 516 56 view .LVU346
+	movswl	4+axisPID(%rip), %eax
+	.loc 1 515 13 view .LVU347
+	subl	%esi, %r14d
+.LVL101:
+	.loc 1 516 5 is_stmt 1 view .LVU348
+	leaq	4+motorMixWeights(%rip), %rdx
+	.loc 1 520 29 is_stmt 0 view .LVU349
+	addl	$1, mixerSaturation(%rip)
+	.loc 1 523 29 view .LVU350
+	movswl	2+axisPID(%rip), %r13d
+	.loc 1 516 19 view .LVU351
+	negl	%r10d
+	.loc 1 523 73 view .LVU352
+	movswl	axisPID(%rip), %r12d
+	.loc 1 516 13 view .LVU353
+	imull	%eax, %r10d
+.LVL102:
+	.loc 1 517 5 is_stmt 1 view .LVU354
+	.loc 1 518 5 view .LVU355
+	.loc 1 520 5 view .LVU356
+	.loc 1 522 5 view .LVU357
+	.loc 1 522 19 view .LVU358
+	.loc 1 523 73 is_stmt 0 view .LVU359
+	xorl	%eax, %eax
+	jmp	.L117
+.LVL103:
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	.loc 1 523 73 view .LVU360
+	cmpl	%r11d, %r8d
+	cmovg	%r11d, %r8d
+.LVL104:
+	.loc 1 527 9 is_stmt 1 view .LVU361
+	cmpl	%r11d, %edi
+	cmovl	%r11d, %edi
+.LVL105:
+	.loc 1 522 35 view .LVU362
+	.loc 1 522 19 view .LVU363
+	addq	$1, %rax
+.LVL106:
+	.loc 1 522 19 is_stmt 0 view .LVU364
+	addq	$16, %rdx
+	cmpl	%ecx, %eax
+	jnb	.L310
+.LVL107:
+.L117:
+	.loc 1 523 9 is_stmt 1 view .LVU365
+	.loc 1 523 80 is_stmt 0 view .LVU366
+	movl	(%rdx), %r15d
+	.loc 1 523 37 view .LVU367
+	movl	4(%rdx), %r11d
+	.loc 1 523 80 view .LVU368
+	imull	%r12d, %r15d
+	.loc 1 523 37 view .LVU369
+	imull	%r13d, %r11d
+	.loc 1 523 64 view .LVU370
+	addl	%r15d, %r11d
+	.loc 1 524 23 view .LVU371
+	movl	8(%rdx), %r15d
+	imull	%r10d, %r15d
+	.loc 1 524 48 view .LVU372
+	leal	2048(%r11,%r15), %r11d
+	.loc 1 524 67 view .LVU373
+	sarl	$12, %r11d
+	.loc 1 523 19 view .LVU374
+	movl	%r11d, (%r9,%rax,4)
+	.loc 1 525 9 is_stmt 1 view .LVU375
+	.loc 1 525 12 is_stmt 0 view .LVU376
+	testq	%rax, %rax
+	jne	.L311
+	.loc 1 522 19 view .LVU377
+	addq	$1, %rax
+.LVL108:
+	.loc 1 524 67 view .LVU378
+	movl	%r11d, %r8d
+.LVL109:
+	.loc 1 524 67 view .LVU379
+	movl	%r11d, %edi
+.LVL110:
+	.loc 1 522 35 is_stmt 1 view .LVU380
+	.loc 1 522 19 view .LVU381
+	addq	$16, %rdx
+	cmpl	%ecx, %eax
+	jb	.L117
+.LVL111:
+.L310:
+	.loc 1 531 19 is_stmt 0 view .LVU382
+	subl	%r8d, %edi
+.LVL112:
+	.loc 1 531 19 view .LVU383
+	movl	12(%rsp), %r11d
+	.loc 1 531 5 is_stmt 1 view .LVU384
+	.loc 1 531 8 is_stmt 0 view .LVU385
+	cmpl	%edi, %r14d
+	jge	.L118
+	.loc 1 531 8 view .LVU386
+	movq	%r9, %r8
+.LVL113:
+	.loc 1 532 16 view .LVU387
+	xorl	%r10d, %r10d
+.LVL114:
+	.p2align 4,,10
+	.p2align 3
+.L119:
+	.loc 1 533 13 is_stmt 1 view .LVU388
+	.loc 1 533 35 is_stmt 0 view .LVU389
+	movl	(%r8), %eax
+	.loc 1 532 39 view .LVU390
+	addl	$1, %r10d
+	.loc 1 532 23 view .LVU391
+	addq	$4, %r8
+	.loc 1 533 35 view .LVU392
+	imull	%r14d, %eax
+	.loc 1 533 49 view .LVU393
+	cltd
+	idivl	%edi
+	.loc 1 533 23 view .LVU394
+	movl	%eax, -4(%r8)
+	.loc 1 532 39 is_stmt 1 view .LVU395
+	.loc 1 532 23 view .LVU396
+	cmpl	%ecx, %r10d
+	jb	.L119
+	.loc 1 534 9 view .LVU397
+	.loc 1 534 39 is_stmt 0 view .LVU398
+	addl	$1, 4+mixerSaturation(%rip)
+.LVL115:
+	.loc 1 537 19 is_stmt 1 view .LVU399
+.L118:
+	.loc 1 538 31 is_stmt 0 view .LVU400
+	movswl	6+rcCommand(%rip), %r13d
+	xorl	%edx, %edx
+	xorl	%r12d, %r12d
+	xorl	%r10d, %r10d
+	leaq	motorMixWeights(%rip), %rdi
+	leaq	motor(%rip), %r8
+	jmp	.L122
+.LVL116:
+	.p2align 4,,10
+	.p2align 3
+.L313:
+	.loc 1 538 31 view .LVU401
+	cmpl	%eax, %r10d
+	cmovg	%eax, %r10d
+.LVL117:
+	.loc 1 542 20 view .LVU402
+	cmpl	%r12d, %eax
+	jle	.L121
+.L120:
+.LVL118:
+	.loc 1 543 13 is_stmt 1 view .LVU403
+	.loc 1 540 28 is_stmt 0 view .LVU404
+	movl	%eax, %r12d
+.LVL119:
+.L121:
+	.loc 1 537 35 is_stmt 1 view .LVU405
+	.loc 1 537 19 view .LVU406
+	addq	$1, %rdx
+.LVL120:
+	.loc 1 537 19 is_stmt 0 view .LVU407
+	addq	$16, %rdi
+	cmpl	%ecx, %edx
+	jnb	.L312
+.LVL121:
+.L122:
+	.loc 1 538 9 is_stmt 1 view .LVU408
+	.loc 1 538 42 is_stmt 0 view .LVU409
+	movl	(%rdi), %eax
+	imull	%r13d, %eax
+	.loc 1 538 72 view .LVU410
+	addl	$2048, %eax
+	.loc 1 538 91 view .LVU411
+	sarl	$12, %eax
+	.loc 1 539 17 view .LVU412
+	addw	(%r9,%rdx,4), %ax
+	.loc 1 538 18 view .LVU413
+	movw	%ax, (%r8,%rdx,2)
+	.loc 1 540 9 is_stmt 1 view .LVU414
+	.loc 1 540 28 is_stmt 0 view .LVU415
+	cwtl
+	.loc 1 540 12 view .LVU416
+	testq	%rdx, %rdx
+	jne	.L313
+	.loc 1 541 20 view .LVU417
+	movl	%eax, %r10d
+.LVL122:
+	.loc 1 541 20 view .LVU418
+	jmp	.L120
+.LVL123:
+.L135:
+	.loc 1 541 20 view .LVU419
+.LBE152:
+.LBE155:
+	.loc 1 581 13 is_stmt 1 view .LVU420
+.LBB156:
+.LBI156:
+	.loc 1 244 5 view .LVU421
+.LBB157:
+	.loc 1 252 5 view .LVU422
+	.loc 1 252 18 is_stmt 0 view .LVU423
+	movq	servoConf(%rip), %rdi
+.LBE157:
+.LBE156:
+	.loc 1 581 62 view .LVU424
+	movzwl	4+axisPID(%rip), %esi
+.LBB160:
+.LBB158:
+	.loc 1 252 22 view .LVU425
+	movzbl	38(%rdi), %ecx
+	.loc 1 252 8 view .LVU426
+	movl	%ecx, %eax
+	andl	$2, %eax
+	cmpb	$1, %al
+	sbbl	%edx, %edx
+.LBE158:
+.LBE160:
+.LBB161:
+.LBB162:
+	andl	$1, %ecx
+.LBE162:
+.LBE161:
+.LBB165:
+.LBB159:
+	andl	$2, %edx
+	subl	$1, %edx
+.LVL124:
+	.loc 1 252 8 view .LVU427
+.LBE159:
+.LBE165:
+	.loc 1 581 62 view .LVU428
+	imull	%esi, %edx
+.LVL125:
+.LBB166:
+.LBI161:
+	.loc 1 244 5 is_stmt 1 view .LVU429
+.LBB163:
+	.loc 1 252 5 view .LVU430
+	.loc 1 252 8 is_stmt 0 view .LVU431
+	cmpb	$1, %cl
+.LBE163:
+.LBE166:
+	.loc 1 581 62 view .LVU432
+	movzwl	2+axisPID(%rip), %ecx
+.LBB167:
+.LBB164:
+	.loc 1 252 8 view .LVU433
+	sbbl	%eax, %eax
+	andl	$2, %eax
+	subl	$1, %eax
+.LVL126:
+	.loc 1 252 8 view .LVU434
+.LBE164:
+.LBE167:
+	.loc 1 581 62 view .LVU435
+	imull	%ecx, %eax
+	addl	%edx, %eax
+.LVL127:
+.LBB168:
+.LBI168:
+	.loc 1 229 9 is_stmt 1 view .LVU436
+.LBB169:
+	.loc 1 231 5 view .LVU437
+	.loc 1 231 13 is_stmt 0 view .LVU438
+	movzbl	39(%rdi), %edx
+.LVL128:
+	.loc 1 233 5 is_stmt 1 view .LVU439
+	.loc 1 233 8 is_stmt 0 view .LVU440
+	cmpb	$-1, %dl
+	je	.L139
+	.loc 1 233 47 view .LVU441
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L314
+.L139:
+	.loc 1 237 5 is_stmt 1 view .LVU442
+	.loc 1 238 9 view .LVU443
+	.loc 1 238 29 is_stmt 0 view .LVU444
+	movzwl	36(%rdi), %edx
+.LVL129:
+.L140:
+	.loc 1 238 29 view .LVU445
+.LBE169:
+.LBE168:
+	.loc 1 581 104 view .LVU446
+	addl	%eax, %edx
+.LBB171:
+.LBB172:
+	.loc 1 252 22 view .LVU447
+	movzbl	46(%rdi), %eax
+.LBE172:
+.LBE171:
+	.loc 1 581 104 view .LVU448
+	movw	%dx, 8+servo(%rip)
+	.loc 1 582 13 is_stmt 1 view .LVU449
+.LVL130:
+.LBB174:
+.LBI171:
+	.loc 1 244 5 view .LVU450
+.LBB173:
+	.loc 1 252 5 view .LVU451
+	movl	%esi, %edx
+	negl	%edx
+	testb	$2, %al
+	cmovne	%edx, %esi
+.LVL131:
+	.loc 1 252 5 is_stmt 0 view .LVU452
+.LBE173:
+.LBE174:
+.LBB175:
+.LBI175:
+	.loc 1 244 5 is_stmt 1 view .LVU453
+.LBB176:
+	.loc 1 252 5 view .LVU454
+	movl	%ecx, %edx
+	negl	%edx
+	testb	$1, %al
+	cmovne	%edx, %ecx
+.LVL132:
+	.loc 1 252 5 is_stmt 0 view .LVU455
+.LBE176:
+.LBE175:
+.LBB177:
+.LBB178:
+	.loc 1 231 13 view .LVU456
+	movzbl	47(%rdi), %edx
+.LBE178:
+.LBE177:
+	.loc 1 582 62 view .LVU457
+	leal	(%rsi,%rcx), %eax
+.LVL133:
+.LBB181:
+.LBI177:
+	.loc 1 229 9 is_stmt 1 view .LVU458
+.LBB179:
+	.loc 1 231 5 view .LVU459
+	.loc 1 233 5 view .LVU460
+	.loc 1 233 8 is_stmt 0 view .LVU461
+	cmpb	$-1, %dl
+	je	.L143
+	.loc 1 233 47 view .LVU462
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L315
+.L143:
+	.loc 1 237 5 is_stmt 1 view .LVU463
+	.loc 1 238 9 view .LVU464
+	.loc 1 238 29 is_stmt 0 view .LVU465
+	movzwl	44(%rdi), %edx
+.LVL134:
+.L147:
+	.loc 1 238 29 view .LVU466
+.LBE179:
+.LBE181:
+	.loc 1 586 62 view .LVU467
+	addl	%edx, %eax
+	movw	%ax, 10+servo(%rip)
+	.loc 1 587 13 is_stmt 1 view .LVU468
+	.p2align 4,,10
+	.p2align 3
+.L128:
+	.loc 1 637 5 view .LVU469
+	.loc 1 637 9 is_stmt 0 view .LVU470
+	movl	$32, %edi
+	call	feature@PLT
+.LVL135:
+	.loc 1 637 8 view .LVU471
+	testb	%al, %al
+.LBB182:
+.LBB183:
+	.loc 1 231 45 view .LVU472
+	movq	servoConf(%rip), %rax
+.LBE183:
+.LBE182:
+	.loc 1 637 8 view .LVU473
+	je	.L194
+	.loc 1 639 9 is_stmt 1 view .LVU474
+.LVL136:
+.LBB186:
+.LBI182:
+	.loc 1 229 9 view .LVU475
+.LBB184:
+	.loc 1 231 5 view .LVU476
+	.loc 1 231 13 is_stmt 0 view .LVU477
+	movzbl	7(%rax), %edx
+.LVL137:
+	.loc 1 233 5 is_stmt 1 view .LVU478
+	.loc 1 233 8 is_stmt 0 view .LVU479
+	cmpb	$-1, %dl
+	je	.L195
+	.loc 1 233 47 view .LVU480
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L316
+.L195:
+	.loc 1 237 5 is_stmt 1 view .LVU481
+	.loc 1 238 9 view .LVU482
+	.loc 1 238 29 is_stmt 0 view .LVU483
+	movzwl	4(%rax), %edi
+.L196:
+.LVL138:
+	.loc 1 238 29 view .LVU484
+.LBE184:
+.LBE186:
+.LBB187:
+.LBB188:
+	.loc 1 231 13 view .LVU485
+	movzbl	15(%rax), %edx
+.LBE188:
+.LBE187:
+	.loc 1 639 18 view .LVU486
+	movw	%di, servo(%rip)
+	.loc 1 640 9 is_stmt 1 view .LVU487
+.LVL139:
+.LBB191:
+.LBI187:
+	.loc 1 229 9 view .LVU488
+.LBB189:
+	.loc 1 231 5 view .LVU489
+	.loc 1 233 5 view .LVU490
+	.loc 1 233 8 is_stmt 0 view .LVU491
+	cmpb	$-1, %dl
+	je	.L197
+	.loc 1 233 47 view .LVU492
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L317
+.L197:
+	.loc 1 237 5 is_stmt 1 view .LVU493
+	.loc 1 238 9 view .LVU494
+	.loc 1 238 29 is_stmt 0 view .LVU495
+	movzwl	12(%rax), %r8d
+.L198:
+.LVL140:
+	.loc 1 238 29 view .LVU496
+.LBE189:
+.LBE191:
+	.loc 1 640 18 view .LVU497
+	movw	%r8w, 2+servo(%rip)
+	.loc 1 642 9 is_stmt 1 view .LVU498
+	.loc 1 642 12 is_stmt 0 view .LVU499
+	testb	$-128, rcModeActivationMask(%rip)
+	je	.L194
+	.loc 1 643 13 is_stmt 1 view .LVU500
+	.loc 1 644 151 is_stmt 0 view .LVU501
+	movswl	inclination(%rip), %edx
+	.loc 1 644 104 view .LVU502
+	movsbl	14(%rax), %esi
+	.loc 1 644 31 view .LVU503
+	movsbl	6(%rax), %ecx
+	.loc 1 644 79 view .LVU504
+	movswl	2+inclination(%rip), %r9d
+	.loc 1 644 131 view .LVU505
+	imull	%edx, %esi
+	.loc 1 645 168 view .LVU506
+	movslq	%esi, %rdx
+	sarl	$31, %esi
+	imulq	$1374389535, %rdx, %rdx
+	sarq	$36, %rdx
+	subl	%esi, %edx
+	.loc 1 643 16 view .LVU507
+	movq	gimbalConfig(%rip), %rsi
+	testb	$2, (%rsi)
+	je	.L200
+	.loc 1 644 17 is_stmt 1 view .LVU508
+	.loc 1 644 30 is_stmt 0 view .LVU509
+	negl	%ecx
+	.loc 1 644 59 view .LVU510
+	imull	%r9d, %ecx
+	.loc 1 644 97 view .LVU511
+	movslq	%ecx, %rsi
+	sarl	$31, %ecx
+	imulq	$1374389535, %rsi, %rsi
+	sarq	$36, %rsi
+	subl	%ecx, %esi
+	.loc 1 644 26 view .LVU512
+	movl	%esi, %ecx
+	subl	%edx, %ecx
+	.loc 1 645 102 view .LVU513
+	addl	%esi, %edx
+	.loc 1 644 26 view .LVU514
+	subl	%ecx, %edi
+	.loc 1 645 26 view .LVU515
+	addl	%r8d, %edx
+	.loc 1 644 26 view .LVU516
+	movw	%di, servo(%rip)
+	.loc 1 645 17 is_stmt 1 view .LVU517
+	.loc 1 645 26 is_stmt 0 view .LVU518
+	movw	%dx, 2+servo(%rip)
+.LVL141:
+	.loc 1 654 19 is_stmt 1 view .LVU519
+	.p2align 4,,10
+	.p2align 3
+.L194:
+	.loc 1 654 19 is_stmt 0 view .LVU520
+	leaq	servo(%rip), %r13
+.LBB192:
+.LBB193:
+	xorl	%r12d, %r12d
+	jmp	.L202
+	.p2align 4,,10
+	.p2align 3
+.L318:
+.LVL142:
+	.loc 1 654 19 view .LVU521
+.LBE193:
+.LBE192:
+	.loc 1 655 67 view .LVU522
+	movq	servoConf(%rip), %rax
+.LVL143:
+.L202:
+	.loc 1 655 9 is_stmt 1 discriminator 3 view .LVU523
+	.loc 1 655 67 is_stmt 0 discriminator 3 view .LVU524
+	addq	%r12, %rax
+	.loc 1 655 20 discriminator 3 view .LVU525
+	movswl	0(%r13), %edi
+	.loc 1 654 19 discriminator 3 view .LVU526
+	addq	$8, %r12
+.LVL144:
+	.loc 1 654 19 discriminator 3 view .LVU527
+	addq	$2, %r13
+	.loc 1 655 20 discriminator 3 view .LVU528
+	movswl	2(%rax), %edx
+	movswl	(%rax), %esi
+	call	constrain@PLT
+.LVL145:
+	.loc 1 655 18 discriminator 3 view .LVU529
+	movw	%ax, -2(%r13)
+	.loc 1 654 25 is_stmt 1 discriminator 3 view .LVU530
+.LVL146:
+	.loc 1 654 19 discriminator 3 view .LVU531
+	cmpq	$64, %r12
+	jne	.L318
+	.loc 1 658 5 view .LVU532
+	.loc 1 658 8 is_stmt 0 view .LVU533
+	movq	gimbalConfig(%rip), %rax
+	testb	$4, (%rax)
+	je	.L203
+.LBB196:
+	.loc 1 661 9 is_stmt 1 view .LVU534
+	.loc 1 661 40 is_stmt 0 view .LVU535
+	movzbl	servoCount(%rip), %r15d
+	.loc 1 671 59 view .LVU536
+	movw	%bx, 12(%rsp)
+	.loc 1 664 17 view .LVU537
+	movl	$4, %eax
+	.loc 1 671 59 view .LVU538
+	leaq	rcData(%rip), %r14
+	.loc 1 661 40 view .LVU539
+	leal	-4(%r15), %r12d
+.LVL147:
+	.loc 1 664 9 is_stmt 1 view .LVU540
+	.loc 1 666 9 view .LVU541
+	.loc 1 667 9 view .LVU542
+	.loc 1 667 43 view .LVU543
+	movsbl	%r12b, %r13d
+.LVL148:
+.L205:
+	.loc 1 668 13 view .LVU544
+	.loc 1 668 16 is_stmt 0 view .LVU545
+	testl	%r13d, %r13d
+	js	.L204
+	.loc 1 671 13 is_stmt 1 view .LVU546
+	movzwl	(%r14,%rax,2), %esi
+	.loc 1 671 73 is_stmt 0 view .LVU547
+	leal	1(%rax), %ebx
+.LVL149:
+	.loc 1 671 13 view .LVU548
+	movzbl	%r12b, %edi
+	call	pwmWriteServo@PLT
+.LVL150:
+	.loc 1 671 73 view .LVU549
+	movzbl	%bl, %eax
+.LVL151:
+.L204:
+	.loc 1 667 59 is_stmt 1 discriminator 2 view .LVU550
+	.loc 1 667 43 discriminator 2 view .LVU551
+	addl	$1, %r12d
+.LVL152:
+	.loc 1 667 43 is_stmt 0 discriminator 2 view .LVU552
+	addl	$1, %r13d
+	cmpb	%r12b, %r15b
+	jne	.L205
+	movswl	12(%rsp), %ebx
+.LVL153:
+.L203:
+	.loc 1 667 43 discriminator 2 view .LVU553
+.LBE196:
+	.loc 1 675 19 is_stmt 1 view .LVU554
+	.loc 1 576 9 is_stmt 0 view .LVU555
+	xorl	%r13d, %r13d
+	.loc 1 675 19 view .LVU556
+	cmpb	$0, numberMotor(%rip)
+	leaq	motor(%rip), %r12
+	.loc 1 684 38 view .LVU557
+	leaq	motor_disarmed(%rip), %r14
+	.loc 1 675 19 view .LVU558
+	jne	.L209
+	jmp	.L109
+.LVL154:
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	.loc 1 683 9 is_stmt 1 view .LVU559
+	.loc 1 683 12 is_stmt 0 view .LVU560
+	testb	$4, armingFlags(%rip)
+	jne	.L208
+	.loc 1 684 13 is_stmt 1 view .LVU561
+	.loc 1 684 22 is_stmt 0 view .LVU562
+	movzwl	(%r14,%r13,2), %eax
+	movw	%ax, (%r12)
+.L208:
+	.loc 1 675 35 is_stmt 1 discriminator 2 view .LVU563
+.LVL155:
+	.loc 1 675 19 discriminator 2 view .LVU564
+	movzbl	numberMotor(%rip), %eax
+	addq	$1, %r13
+.LVL156:
+	.loc 1 675 19 is_stmt 0 discriminator 2 view .LVU565
+	addq	$2, %r12
+	cmpl	%eax, %r13d
+	jnb	.L109
+.LVL157:
+.L209:
+	.loc 1 676 9 is_stmt 1 view .LVU566
+	.loc 1 676 20 is_stmt 0 view .LVU567
+	movswl	(%r12), %edi
+	movl	%ebp, %edx
+	movl	%ebx, %esi
+	call	constrain@PLT
+.LVL158:
+	.loc 1 677 14 view .LVU568
+	movl	$4096, %edi
+	.loc 1 676 18 view .LVU569
+	movw	%ax, (%r12)
+	.loc 1 677 9 is_stmt 1 view .LVU570
+	.loc 1 677 14 is_stmt 0 view .LVU571
+	call	feature@PLT
+.LVL159:
+	.loc 1 677 12 view .LVU572
+	testb	%al, %al
+	jne	.L206
+	.loc 1 677 66 discriminator 1 view .LVU573
+	movq	rxConfig(%rip), %rax
+	.loc 1 677 44 discriminator 1 view .LVU574
+	movswl	6+rcData(%rip), %edx
+	.loc 1 677 66 discriminator 1 view .LVU575
+	movzwl	12(%rax), %eax
+	.loc 1 677 34 discriminator 1 view .LVU576
+	cmpl	%eax, %edx
+	jge	.L206
+	.loc 1 678 13 is_stmt 1 view .LVU577
+	.loc 1 678 18 is_stmt 0 view .LVU578
+	movl	$16, %edi
+	call	feature@PLT
+.LVL160:
+	.loc 1 678 16 view .LVU579
+	testb	%al, %al
+	.loc 1 679 45 view .LVU580
+	movq	escAndServoConfig(%rip), %rax
+	.loc 1 678 16 view .LVU581
+	jne	.L207
+	.loc 1 679 17 is_stmt 1 view .LVU582
+	.loc 1 679 26 is_stmt 0 view .LVU583
+	movzwl	(%rax), %eax
+	movw	%ax, (%r12)
+	jmp	.L206
+.LVL161:
+	.p2align 4,,10
+	.p2align 3
+.L109:
+	.loc 1 687 1 view .LVU584
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL162:
+	.loc 1 687 1 view .LVU585
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL163:
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	.cfi_restore_state
+	.loc 1 681 17 is_stmt 1 view .LVU586
+	.loc 1 681 26 is_stmt 0 view .LVU587
+	movzwl	4(%rax), %eax
+	movw	%ax, (%r12)
+	jmp	.L206
+.LVL164:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+.LBB197:
+.LBB147:
+	.loc 1 495 13 is_stmt 1 view .LVU588
+	.loc 1 495 43 is_stmt 0 view .LVU589
+	movswl	4(%rsi), %ebx
+.LVL165:
+	.loc 1 496 13 is_stmt 1 view .LVU590
+	.loc 1 496 40 is_stmt 0 view .LVU591
+	movswl	(%rcx), %ebp
+.LVL166:
+	.loc 1 496 40 view .LVU592
+	jmp	.L113
+.LVL167:
+	.p2align 4,,10
+	.p2align 3
+.L307:
+	.loc 1 496 40 view .LVU593
+.LBE147:
+.LBE197:
+	.loc 1 565 49 discriminator 1 view .LVU594
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL168:
+	movl	%eax, %r12d
+	.loc 1 565 45 discriminator 1 view .LVU595
+	testb	%al, %al
+	jne	.L110
+	.loc 1 565 100 discriminator 4 view .LVU596
+	movq	rxConfig(%rip), %rax
+	.loc 1 565 78 discriminator 4 view .LVU597
+	movswl	6+rcData(%rip), %edx
+	.loc 1 565 100 discriminator 4 view .LVU598
+	movzwl	12(%rax), %eax
+	.loc 1 565 69 discriminator 4 view .LVU599
+	cmpl	%eax, %edx
+	setge	%r12b
+	jmp	.L110
+.LVL169:
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	.loc 1 647 17 is_stmt 1 view .LVU600
+	.loc 1 647 56 is_stmt 0 view .LVU601
+	imull	%r9d, %ecx
+	.loc 1 648 26 view .LVU602
+	addl	%edx, %r8d
+	movw	%r8w, 2+servo(%rip)
+	.loc 1 647 94 view .LVU603
+	movslq	%ecx, %rsi
+	sarl	$31, %ecx
+	imulq	$1374389535, %rsi, %rsi
+	sarq	$36, %rsi
+	subl	%ecx, %esi
+	.loc 1 647 26 view .LVU604
+	addl	%esi, %edi
+	movw	%di, servo(%rip)
+	.loc 1 648 17 is_stmt 1 view .LVU605
+.LVL170:
+	.loc 1 654 19 view .LVU606
+	jmp	.L194
+.LVL171:
+.L133:
+	.loc 1 599 13 view .LVU607
+.LBB198:
+.LBB199:
+	.loc 1 447 37 is_stmt 0 view .LVU608
+	movq	escAndServoConfig(%rip), %rax
+.LBE199:
+.LBE198:
+	.loc 1 599 16 view .LVU609
+	testb	$4, armingFlags(%rip)
+	jne	.L164
+	.loc 1 600 17 is_stmt 1 view .LVU610
+	.loc 1 600 45 is_stmt 0 view .LVU611
+	movzwl	4(%rax), %eax
+.L165:
+.LBB217:
+.LBB218:
+	.loc 1 252 18 view .LVU612
+	movq	servoConf(%rip), %rsi
+.LBE218:
+.LBE217:
+	.loc 1 600 26 view .LVU613
+	movw	%ax, 14+servo(%rip)
+	.loc 1 603 13 is_stmt 1 view .LVU614
+	.loc 1 603 22 is_stmt 0 view .LVU615
+	movw	%ax, motor(%rip)
+	.loc 1 604 13 is_stmt 1 view .LVU616
+.LBB221:
+.LBB219:
+	.loc 1 252 22 is_stmt 0 view .LVU617
+	movzbl	30(%rsi), %edx
+	movl	%edx, %eax
+	andl	$1, %eax
+	.loc 1 252 8 view .LVU618
+	cmpb	$1, %al
+	sbbl	%ecx, %ecx
+	andl	$2, %ecx
+	subl	$1, %ecx
+.LBE219:
+.LBE221:
+	.loc 1 604 16 view .LVU619
+	testb	$1, 1+flightModeFlags(%rip)
+	je	.L166
+	.loc 1 606 17 is_stmt 1 view .LVU620
+.LVL172:
+.LBB222:
+.LBI217:
+	.loc 1 244 5 view .LVU621
+.LBB220:
+	.loc 1 252 5 view .LVU622
+	.loc 1 252 5 is_stmt 0 view .LVU623
+.LBE220:
+.LBE222:
+	.loc 1 606 70 view .LVU624
+	movzwl	2+rcCommand(%rip), %eax
+.LBB223:
+.LBB224:
+	.loc 1 252 8 view .LVU625
+	andl	$2, %edx
+.LBE224:
+.LBE223:
+	.loc 1 606 70 view .LVU626
+	movzwl	rcCommand(%rip), %edi
+	imull	%eax, %ecx
+.LVL173:
+.LBB226:
+.LBI223:
+	.loc 1 244 5 is_stmt 1 view .LVU627
+.LBB225:
+	.loc 1 252 5 view .LVU628
+	.loc 1 252 8 is_stmt 0 view .LVU629
+	cmpb	$1, %dl
+	sbbl	%edx, %edx
+	andl	$2, %edx
+	subl	$1, %edx
+.LVL174:
+.L306:
+	.loc 1 252 8 view .LVU630
+.LBE225:
+.LBE226:
+	.loc 1 610 68 view .LVU631
+	imull	%edi, %edx
+	movl	%eax, %r8d
+	negl	%r8d
+	addl	%edx, %ecx
+	.loc 1 611 17 is_stmt 1 view .LVU632
+.LVL175:
+.LBB227:
+.LBI227:
+	.loc 1 244 5 view .LVU633
+.LBB228:
+	.loc 1 252 5 view .LVU634
+	.loc 1 252 22 is_stmt 0 view .LVU635
+	movzbl	38(%rsi), %edx
+	testb	$1, %dl
+	cmovne	%r8d, %eax
+.LVL176:
+	.loc 1 252 22 view .LVU636
+.LBE228:
+.LBE227:
+.LBB229:
+.LBI229:
+	.loc 1 244 5 is_stmt 1 view .LVU637
+.LBB230:
+	.loc 1 252 5 view .LVU638
+	movl	%edi, %r8d
+	negl	%r8d
+	andl	$2, %edx
+.LBE230:
+.LBE229:
+.LBB231:
+.LBB232:
+	.loc 1 231 13 is_stmt 0 view .LVU639
+	movzbl	31(%rsi), %edx
+	cmovne	%r8d, %edi
+.LVL177:
+	.loc 1 231 13 view .LVU640
+.LBE232:
+.LBE231:
+	.loc 1 611 68 view .LVU641
+	addl	%edi, %eax
+	.loc 1 613 13 is_stmt 1 view .LVU642
+.LVL178:
+.LBB235:
+.LBI231:
+	.loc 1 229 9 view .LVU643
+.LBB233:
+	.loc 1 231 5 view .LVU644
+	.loc 1 233 5 view .LVU645
+	.loc 1 233 8 is_stmt 0 view .LVU646
+	cmpb	$-1, %dl
+	je	.L176
+	.loc 1 233 47 view .LVU647
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L319
+.L176:
+	.loc 1 237 5 is_stmt 1 view .LVU648
+	.loc 1 238 9 view .LVU649
+	.loc 1 238 29 is_stmt 0 view .LVU650
+	movzwl	28(%rsi), %edx
+.LVL179:
+.L177:
+	.loc 1 238 29 view .LVU651
+.LBE233:
+.LBE235:
+	.loc 1 613 22 view .LVU652
+	addl	%ecx, %edx
+	movw	%dx, 6+servo(%rip)
+	.loc 1 614 13 is_stmt 1 view .LVU653
+.LVL180:
+.LBB236:
+.LBI236:
+	.loc 1 229 9 view .LVU654
+.LBB237:
+	.loc 1 231 5 view .LVU655
+	.loc 1 231 13 is_stmt 0 view .LVU656
+	movzbl	39(%rsi), %edx
+.LVL181:
+	.loc 1 233 5 is_stmt 1 view .LVU657
+	.loc 1 233 8 is_stmt 0 view .LVU658
+	cmpb	$-1, %dl
+	je	.L178
+	.loc 1 233 47 view .LVU659
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L320
+.L178:
+	.loc 1 237 5 is_stmt 1 view .LVU660
+	.loc 1 238 9 view .LVU661
+	.loc 1 238 29 is_stmt 0 view .LVU662
+	movzwl	36(%rsi), %edx
+.LVL182:
+.L179:
+	.loc 1 238 29 view .LVU663
+.LBE237:
+.LBE236:
+	.loc 1 614 22 view .LVU664
+	addl	%edx, %eax
+	movw	%ax, 8+servo(%rip)
+	.loc 1 615 13 is_stmt 1 view .LVU665
+	jmp	.L128
+.L132:
+	.loc 1 595 13 view .LVU666
+.LBB239:
+.LBI198:
+	.loc 1 441 13 view .LVU667
+.LBB213:
+	.loc 1 443 5 view .LVU668
+.LVL183:
+	.loc 1 444 5 view .LVU669
+	.loc 1 446 5 view .LVU670
+	.loc 1 447 37 is_stmt 0 view .LVU671
+	movq	escAndServoConfig(%rip), %rax
+	.loc 1 446 8 view .LVU672
+	testb	$4, armingFlags(%rip)
+	jne	.L152
+	.loc 1 447 9 is_stmt 1 view .LVU673
+	.loc 1 447 37 is_stmt 0 view .LVU674
+	movzwl	4(%rax), %eax
+.L153:
+	.loc 1 447 18 view .LVU675
+	movw	%ax, 14+servo(%rip)
+	.loc 1 450 5 is_stmt 1 view .LVU676
+.LBB200:
+.LBB201:
+.LBB202:
+	.loc 1 231 45 is_stmt 0 view .LVU677
+	movq	servoConf(%rip), %rsi
+.LBE202:
+.LBE201:
+.LBE200:
+	.loc 1 450 14 view .LVU678
+	movw	%ax, motor(%rip)
+	.loc 1 452 5 is_stmt 1 view .LVU679
+	.loc 1 452 23 is_stmt 0 view .LVU680
+	movq	airplaneConfig(%rip), %rax
+	.loc 1 452 8 view .LVU681
+	cmpb	$0, (%rax)
+	jne	.L321
+.L154:
+	.loc 1 469 5 is_stmt 1 view .LVU682
+	.loc 1 469 8 is_stmt 0 view .LVU683
+	testb	$1, 1+flightModeFlags(%rip)
+	je	.L159
+	.loc 1 470 9 is_stmt 1 view .LVU684
+	.loc 1 472 18 is_stmt 0 view .LVU685
+	movzwl	4+rcCommand(%rip), %eax
+	.loc 1 470 29 view .LVU686
+	movd	rcCommand(%rip), %xmm0
+	.loc 1 471 9 is_stmt 1 view .LVU687
+	.loc 1 472 18 is_stmt 0 view .LVU688
+	movw	%ax, 10+servo(%rip)
+	.loc 1 470 29 view .LVU689
+	pshuflw	$224, %xmm0, %xmm0
+	.loc 1 473 29 view .LVU690
+	movzwl	2+rcCommand(%rip), %eax
+	.loc 1 470 18 view .LVU691
+	movd	%xmm0, 6+servo(%rip)
+	.loc 1 472 9 is_stmt 1 view .LVU692
+	.loc 1 473 9 view .LVU693
+.LVL184:
+	.loc 1 481 19 view .LVU694
+.L160:
+	leaq	servo(%rip), %rcx
+	.loc 1 473 18 is_stmt 0 view .LVU695
+	movw	%ax, 12+servo(%rip)
+	addq	$28, %rsi
+.LBB207:
+.LBB208:
+	.loc 1 233 88 view .LVU696
+	movzbl	rxRuntimeConfig(%rip), %r8d
+	leaq	8(%rcx), %rdi
+	.loc 1 234 22 view .LVU697
+	leaq	rcData(%rip), %r9
+	jmp	.L163
+.LVL185:
+	.p2align 4,,10
+	.p2align 3
+.L161:
+	.loc 1 237 5 is_stmt 1 view .LVU698
+	.loc 1 238 9 view .LVU699
+	.loc 1 238 29 is_stmt 0 view .LVU700
+	movzwl	(%rsi), %edx
+.LVL186:
+.L162:
+	.loc 1 238 29 view .LVU701
+.LBE208:
+.LBE207:
+	.loc 1 483 18 view .LVU702
+	addl	%edx, %eax
+	.loc 1 481 19 view .LVU703
+	addq	$2, %rcx
+	addq	$8, %rsi
+.LVL187:
+	.loc 1 483 18 view .LVU704
+	movw	%ax, 4(%rcx)
+	.loc 1 481 25 is_stmt 1 view .LVU705
+.LVL188:
+	.loc 1 481 19 view .LVU706
+	cmpq	%rdi, %rcx
+	je	.L128
+.LVL189:
+.L163:
+	.loc 1 482 9 view .LVU707
+	.loc 1 482 55 is_stmt 0 view .LVU708
+	movswl	6(%rcx), %eax
+	.loc 1 482 21 view .LVU709
+	movsbl	2(%rsi), %edx
+	.loc 1 482 48 view .LVU710
+	imull	%eax, %edx
+	.loc 1 482 18 view .LVU711
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$37, %rax
+	subl	%edx, %eax
+	movw	%ax, 6(%rcx)
+	.loc 1 483 9 is_stmt 1 view .LVU712
+.LVL190:
+.LBB210:
+.LBI207:
+	.loc 1 229 9 view .LVU713
+.LBB209:
+	.loc 1 231 5 view .LVU714
+	.loc 1 231 13 is_stmt 0 view .LVU715
+	movzbl	3(%rsi), %edx
+.LVL191:
+	.loc 1 233 5 is_stmt 1 view .LVU716
+	.loc 1 233 8 is_stmt 0 view .LVU717
+	cmpb	$-1, %dl
+	je	.L161
+	.loc 1 233 47 view .LVU718
+	cmpb	%r8b, %dl
+	jnb	.L161
+	.loc 1 234 9 is_stmt 1 view .LVU719
+	.loc 1 234 22 is_stmt 0 view .LVU720
+	movzwl	(%r9,%rdx,2), %edx
+.LVL192:
+	.loc 1 234 22 view .LVU721
+	jmp	.L162
+.LVL193:
+.L131:
+	.loc 1 234 22 view .LVU722
+.LBE209:
+.LBE210:
+.LBE213:
+.LBE239:
+	.loc 1 619 35 view .LVU723
+	movzwl	2+axisPID(%rip), %edx
+.LBB240:
+.LBB241:
+	.loc 1 252 18 view .LVU724
+	movq	servoConf(%rip), %rax
+.LBE241:
+.LBE240:
+.LBB244:
+.LBB245:
+	.loc 1 233 88 view .LVU725
+	movzbl	rxRuntimeConfig(%rip), %esi
+.LVL194:
+	.loc 1 233 88 view .LVU726
+.LBE245:
+.LBE244:
+	.loc 1 619 17 is_stmt 1 view .LVU727
+	.loc 1 619 26 is_stmt 0 view .LVU728
+	movl	%edx, %ecx
+.LVL195:
+.LBB250:
+.LBI240:
+	.loc 1 244 5 is_stmt 1 view .LVU729
+.LBB242:
+	.loc 1 252 5 view .LVU730
+	.loc 1 252 8 is_stmt 0 view .LVU731
+	testb	$1, 38(%rax)
+	je	.L180
+	negl	%ecx
+.LBE242:
+.LBE250:
+	.loc 1 619 26 view .LVU732
+	movl	%ecx, %edx
+.L180:
+.LVL196:
+	.loc 1 619 26 view .LVU733
+	movw	%dx, 8+servo(%rip)
+	.loc 1 620 17 is_stmt 1 view .LVU734
+.LVL197:
+.LBB251:
+.LBI244:
+	.loc 1 229 9 view .LVU735
+.LBB246:
+	.loc 1 231 5 view .LVU736
+	.loc 1 231 13 is_stmt 0 view .LVU737
+	movzbl	39(%rax), %edx
+.LVL198:
+	.loc 1 233 5 is_stmt 1 view .LVU738
+	.loc 1 233 8 is_stmt 0 view .LVU739
+	cmpb	$-1, %dl
+	je	.L183
+	.loc 1 233 47 view .LVU740
+	cmpb	%sil, %dl
+	jb	.L322
+.L183:
+	.loc 1 237 5 is_stmt 1 view .LVU741
+	.loc 1 238 9 view .LVU742
+	.loc 1 238 29 is_stmt 0 view .LVU743
+	movzwl	36(%rax), %edx
+.LVL199:
+.L182:
+	.loc 1 238 29 view .LVU744
+.LBE246:
+.LBE251:
+	.loc 1 620 26 view .LVU745
+	addl	%ecx, %edx
+	movw	%dx, 8+servo(%rip)
+	.loc 1 618 33 is_stmt 1 view .LVU746
+.LVL200:
+	.loc 1 618 27 view .LVU747
+	.loc 1 619 17 view .LVU748
+	.loc 1 619 35 is_stmt 0 view .LVU749
+	movzwl	axisPID(%rip), %edx
+	.loc 1 619 26 view .LVU750
+	movl	%edx, %ecx
+.LVL201:
+.LBB252:
+	.loc 1 244 5 is_stmt 1 view .LVU751
+.LBB243:
+	.loc 1 252 5 view .LVU752
+	.loc 1 252 8 is_stmt 0 view .LVU753
+	testb	$1, 46(%rax)
+	je	.L184
+	negl	%ecx
+.LBE243:
+.LBE252:
+	.loc 1 619 26 view .LVU754
+	movl	%ecx, %edx
+.L184:
+.LVL202:
+	.loc 1 619 26 view .LVU755
+	movw	%dx, 10+servo(%rip)
+	.loc 1 620 17 is_stmt 1 view .LVU756
+.LVL203:
+.LBB253:
+	.loc 1 229 9 view .LVU757
+.LBB247:
+	.loc 1 231 5 view .LVU758
+	.loc 1 231 13 is_stmt 0 view .LVU759
+	movzbl	47(%rax), %edx
+.LVL204:
+	.loc 1 233 5 is_stmt 1 view .LVU760
+	.loc 1 233 8 is_stmt 0 view .LVU761
+	cmpb	$-1, %dl
+	je	.L185
+	.loc 1 233 47 view .LVU762
+	cmpb	%sil, %dl
+	jb	.L323
+.L185:
+	.loc 1 237 5 is_stmt 1 view .LVU763
+	.loc 1 238 9 view .LVU764
+	.loc 1 238 29 is_stmt 0 view .LVU765
+	movzwl	44(%rax), %eax
+.L186:
+.LVL205:
+	.loc 1 238 29 view .LVU766
+.LBE247:
+.LBE253:
+	.loc 1 620 26 view .LVU767
+	addl	%ecx, %eax
+	movw	%ax, 10+servo(%rip)
+	.loc 1 618 33 is_stmt 1 view .LVU768
+.LVL206:
+	.loc 1 618 27 view .LVU769
+	jmp	.L128
+.LVL207:
+.L129:
+	.loc 1 626 66 is_stmt 0 view .LVU770
+	movzwl	4+axisPID(%rip), %r8d
+.LBB254:
+.LBB255:
+	.loc 1 233 88 view .LVU771
+	movl	$3, %eax
+.LBE255:
+.LBE254:
+.LBB259:
+.LBB194:
+	.loc 1 252 18 view .LVU772
+	movq	servoConf(%rip), %rsi
+	leaq	servo(%rip), %rdi
+.LBE194:
+.LBE259:
+.LBB260:
+.LBB256:
+	.loc 1 233 88 view .LVU773
+	movzbl	rxRuntimeConfig(%rip), %r12d
+	leaq	axisPID(%rip), %r11
+.LBE256:
+.LBE260:
+	.loc 1 626 80 view .LVU774
+	movl	$6, %r9d
+	movl	%r8d, %r10d
+	negl	%r10d
+	jmp	.L192
+.LVL208:
+	.p2align 4,,10
+	.p2align 3
+.L190:
+.LBB261:
+.LBB257:
+	.loc 1 237 5 is_stmt 1 view .LVU775
+	.loc 1 238 9 view .LVU776
+	.loc 1 238 29 is_stmt 0 view .LVU777
+	movzwl	4(%rsi,%rax,8), %ecx
+.LVL209:
+	.loc 1 238 29 view .LVU778
+.LBE257:
+.LBE261:
+	.loc 1 627 26 view .LVU779
+	addl	%ecx, %edx
+	movw	%dx, (%rdi,%rax,2)
+	.loc 1 625 33 is_stmt 1 view .LVU780
+.LVL210:
+	.loc 1 625 27 view .LVU781
+	addq	$1, %rax
+.LVL211:
+	.loc 1 625 27 is_stmt 0 view .LVU782
+	cmpq	$7, %rax
+	je	.L324
+.LVL212:
+.L192:
+	.loc 1 626 17 is_stmt 1 discriminator 3 view .LVU783
+.LBB262:
+.LBI192:
+	.loc 1 244 5 discriminator 3 view .LVU784
+.LBB195:
+	.loc 1 252 5 discriminator 3 view .LVU785
+	.loc 1 252 22 is_stmt 0 discriminator 3 view .LVU786
+	movzbl	6(%rsi,%rax,8), %r13d
+	movl	%r8d, %ecx
+.LBE195:
+.LBE262:
+	.loc 1 626 80 discriminator 3 view .LVU787
+	movl	%r9d, %edx
+	testb	$2, %r13b
+	cmovne	%r10d, %ecx
+.LVL213:
+	.loc 1 626 80 discriminator 3 view .LVU788
+	subl	%eax, %edx
+	.loc 1 626 85 discriminator 3 view .LVU789
+	shrl	%edx
+	.loc 1 626 66 discriminator 3 view .LVU790
+	movzwl	(%r11,%rdx,2), %edx
+.LVL214:
+.LBB263:
+.LBI263:
+	.loc 1 244 5 is_stmt 1 discriminator 3 view .LVU791
+.LBB264:
+	.loc 1 252 5 discriminator 3 view .LVU792
+	movl	%edx, %r14d
+	negl	%r14d
+	andl	$1, %r13d
+	cmovne	%r14d, %edx
+.LVL215:
+	.loc 1 252 5 is_stmt 0 discriminator 3 view .LVU793
+.LBE264:
+.LBE263:
+	.loc 1 626 66 discriminator 3 view .LVU794
+	addl	%ecx, %edx
+	.loc 1 626 26 discriminator 3 view .LVU795
+	movw	%dx, (%rdi,%rax,2)
+	.loc 1 627 17 is_stmt 1 discriminator 3 view .LVU796
+.LVL216:
+.LBB265:
+.LBI254:
+	.loc 1 229 9 discriminator 3 view .LVU797
+.LBB258:
+	.loc 1 231 5 discriminator 3 view .LVU798
+	.loc 1 231 13 is_stmt 0 discriminator 3 view .LVU799
+	movzbl	7(%rsi,%rax,8), %ecx
+.LVL217:
+	.loc 1 233 5 is_stmt 1 discriminator 3 view .LVU800
+	.loc 1 233 8 is_stmt 0 discriminator 3 view .LVU801
+	cmpb	$-1, %cl
+	je	.L190
+	.loc 1 233 47 view .LVU802
+	cmpb	%r12b, %cl
+	jnb	.L190
+	.loc 1 234 9 is_stmt 1 view .LVU803
+	.loc 1 234 22 is_stmt 0 view .LVU804
+	leaq	rcData(%rip), %r13
+	movzwl	0(%r13,%rcx,2), %ecx
+.LVL218:
+	.loc 1 234 22 view .LVU805
+.LBE258:
+.LBE265:
+	.loc 1 627 26 view .LVU806
+	addl	%ecx, %edx
+	movw	%dx, (%rdi,%rax,2)
+	.loc 1 625 33 is_stmt 1 view .LVU807
+.LVL219:
+	.loc 1 625 27 view .LVU808
+	addq	$1, %rax
+.LVL220:
+	.loc 1 625 27 is_stmt 0 view .LVU809
+	cmpq	$7, %rax
+	jne	.L192
+.LVL221:
+.L324:
+	.loc 1 629 13 is_stmt 1 view .LVU810
+	.loc 1 629 22 is_stmt 0 view .LVU811
+	movzwl	6+rcCommand(%rip), %eax
+	movw	%ax, motor(%rip)
+	.loc 1 630 13 is_stmt 1 view .LVU812
+	jmp	.L128
+.L134:
+	.loc 1 590 13 view .LVU813
+	.loc 1 590 44 is_stmt 0 view .LVU814
+	movq	servoConf(%rip), %rcx
+	.loc 1 590 73 view .LVU815
+	movswl	2+inclination(%rip), %eax
+	.loc 1 590 26 view .LVU816
+	movsbl	6(%rcx), %edx
+	.loc 1 590 53 view .LVU817
+	imull	%eax, %edx
+	.loc 1 590 92 view .LVU818
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$36, %rax
+	subl	%edx, %eax
+.LVL222:
+.LBB266:
+.LBI266:
+	.loc 1 229 9 is_stmt 1 view .LVU819
+.LBB267:
+	.loc 1 231 5 view .LVU820
+	.loc 1 231 13 is_stmt 0 view .LVU821
+	movzbl	7(%rcx), %edx
+.LVL223:
+	.loc 1 233 5 is_stmt 1 view .LVU822
+	.loc 1 233 8 is_stmt 0 view .LVU823
+	cmpb	$-1, %dl
+	je	.L148
+	.loc 1 233 47 view .LVU824
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L325
+.L148:
+	.loc 1 237 5 is_stmt 1 view .LVU825
+	.loc 1 238 9 view .LVU826
+	.loc 1 238 29 is_stmt 0 view .LVU827
+	movzwl	4(%rcx), %edx
+.LVL224:
+.L149:
+	.loc 1 238 29 view .LVU828
+.LBE267:
+.LBE266:
+	.loc 1 590 98 view .LVU829
+	addl	%edx, %eax
+	.loc 1 591 26 view .LVU830
+	movsbl	14(%rcx), %edx
+	.loc 1 590 98 view .LVU831
+	movw	%ax, servo(%rip)
+	.loc 1 591 13 is_stmt 1 view .LVU832
+	.loc 1 591 73 is_stmt 0 view .LVU833
+	movswl	inclination(%rip), %eax
+	.loc 1 591 53 view .LVU834
+	imull	%eax, %edx
+	.loc 1 591 91 view .LVU835
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$36, %rax
+	subl	%edx, %eax
+.LVL225:
+.LBB269:
+.LBI269:
+	.loc 1 229 9 is_stmt 1 view .LVU836
+.LBB270:
+	.loc 1 231 5 view .LVU837
+	.loc 1 231 13 is_stmt 0 view .LVU838
+	movzbl	15(%rcx), %edx
+.LVL226:
+	.loc 1 233 5 is_stmt 1 view .LVU839
+	.loc 1 233 8 is_stmt 0 view .LVU840
+	cmpb	$-1, %dl
+	je	.L150
+	.loc 1 233 47 view .LVU841
+	cmpb	rxRuntimeConfig(%rip), %dl
+	jb	.L326
+.L150:
+	.loc 1 237 5 is_stmt 1 view .LVU842
+	.loc 1 238 9 view .LVU843
+	.loc 1 238 29 is_stmt 0 view .LVU844
+	movzwl	12(%rcx), %edx
+.LVL227:
+.L151:
+	.loc 1 238 29 view .LVU845
+.LBE270:
+.LBE269:
+	.loc 1 591 97 view .LVU846
+	addl	%edx, %eax
+	movw	%ax, 2+servo(%rip)
+	.loc 1 592 13 is_stmt 1 view .LVU847
+	jmp	.L128
+.L136:
+	.loc 1 586 13 view .LVU848
+.LVL228:
+.LBB272:
+.LBI272:
+	.loc 1 244 5 view .LVU849
+.LBB273:
+	.loc 1 252 5 view .LVU850
+	.loc 1 252 18 is_stmt 0 view .LVU851
+	movq	servoConf(%rip), %rdx
+	.loc 1 252 8 view .LVU852
+	movzbl	46(%rdx), %eax
+.LBE273:
+.LBE272:
+.LBB275:
+.LBB276:
+	.loc 1 231 13 view .LVU853
+	movzbl	47(%rdx), %ecx
+.LBE276:
+.LBE275:
+.LBB279:
+.LBB274:
+	.loc 1 252 8 view .LVU854
+	andl	$1, %eax
+	cmpb	$1, %al
+	sbbl	%eax, %eax
+	andl	$2, %eax
+	subl	$1, %eax
+.LVL229:
+	.loc 1 252 8 view .LVU855
+.LBE274:
+.LBE279:
+	.loc 1 586 62 view .LVU856
+	imulw	4+axisPID(%rip), %ax
+.LVL230:
+.LBB280:
+.LBI275:
+	.loc 1 229 9 is_stmt 1 view .LVU857
+.LBB277:
+	.loc 1 231 5 view .LVU858
+	.loc 1 233 5 view .LVU859
+	.loc 1 233 8 is_stmt 0 view .LVU860
+	cmpb	$-1, %cl
+	je	.L146
+	.loc 1 233 47 view .LVU861
+	cmpb	rxRuntimeConfig(%rip), %cl
+	jb	.L327
+.L146:
+	.loc 1 237 5 is_stmt 1 view .LVU862
+	.loc 1 238 9 view .LVU863
+	.loc 1 238 29 is_stmt 0 view .LVU864
+	movzwl	44(%rdx), %edx
+	jmp	.L147
+.LVL231:
+	.p2align 4,,10
+	.p2align 3
+.L312:
+	.loc 1 238 29 view .LVU865
+.LBE277:
+.LBE280:
+.LBB281:
+.LBB153:
+	.loc 1 546 5 is_stmt 1 view .LVU866
+	.loc 1 546 8 is_stmt 0 view .LVU867
+	cmpl	%r12d, %r11d
+	jge	.L123
+	.loc 1 547 9 is_stmt 1 view .LVU868
+	.loc 1 548 37 is_stmt 0 view .LVU869
+	addl	$1, 8+mixerSaturation(%rip)
+	.loc 1 547 16 view .LVU870
+	subl	%r12d, %r11d
+.LVL232:
+	.loc 1 548 9 is_stmt 1 view .LVU871
+	.loc 1 554 5 view .LVU872
+	.loc 1 555 23 view .LVU873
+.L124:
+	.loc 1 556 22 is_stmt 0 view .LVU874
+	xorl	%eax, %eax
+.LVL233:
+	.p2align 4,,10
+	.p2align 3
+.L126:
+	.loc 1 556 13 is_stmt 1 view .LVU875
+	.loc 1 556 22 is_stmt 0 view .LVU876
+	addw	%r11w, (%r8,%rax,2)
+	.loc 1 555 39 is_stmt 1 view .LVU877
+.LVL234:
+	.loc 1 555 23 view .LVU878
+	addq	$1, %rax
+.LVL235:
+	.loc 1 555 23 is_stmt 0 view .LVU879
+	cmpl	%ecx, %eax
+	jb	.L126
+	jmp	.L115
+.LVL236:
+	.p2align 4,,10
+	.p2align 3
+.L317:
+	.loc 1 555 23 view .LVU880
+.LBE153:
+.LBE281:
+.LBB282:
+.LBB190:
+	.loc 1 234 9 is_stmt 1 view .LVU881
+	.loc 1 234 22 is_stmt 0 view .LVU882
+	leaq	rcData(%rip), %rcx
+	movzwl	(%rcx,%rdx,2), %r8d
+	jmp	.L198
+.LVL237:
+	.p2align 4,,10
+	.p2align 3
+.L316:
+	.loc 1 234 22 view .LVU883
+.LBE190:
+.LBE282:
+.LBB283:
+.LBB185:
+	.loc 1 234 9 is_stmt 1 view .LVU884
+	.loc 1 234 22 is_stmt 0 view .LVU885
+	leaq	rcData(%rip), %rcx
+	movzwl	(%rcx,%rdx,2), %edi
+	jmp	.L196
+.LVL238:
+	.p2align 4,,10
+	.p2align 3
+.L123:
+	.loc 1 234 22 view .LVU886
+.LBE185:
+.LBE283:
+.LBB284:
+.LBB154:
+	.loc 1 549 12 is_stmt 1 view .LVU887
+	.loc 1 549 15 is_stmt 0 view .LVU888
+	cmpl	%r10d, %esi
+	jle	.L115
+	.loc 1 550 9 is_stmt 1 view .LVU889
+	.loc 1 550 16 is_stmt 0 view .LVU890
+	subl	%r10d, %esi
+	.loc 1 551 36 view .LVU891
+	addl	$1, 12+mixerSaturation(%rip)
+	.loc 1 550 16 view .LVU892
+	movl	%esi, %r11d
+.LVL239:
+	.loc 1 551 9 is_stmt 1 view .LVU893
+	.loc 1 554 5 view .LVU894
+	.loc 1 555 23 view .LVU895
+	jmp	.L124
+.LVL240:
+.L159:
+	.loc 1 555 23 is_stmt 0 view .LVU896
+.LBE154:
+.LBE284:
+.LBB285:
+.LBB214:
+	.loc 1 476 9 is_stmt 1 view .LVU897
+	.loc 1 476 27 is_stmt 0 view .LVU898
+	movd	axisPID(%rip), %xmm0
+	.loc 1 477 9 is_stmt 1 view .LVU899
+	.loc 1 478 18 is_stmt 0 view .LVU900
+	movzwl	4+axisPID(%rip), %eax
+	.loc 1 476 27 view .LVU901
+	pshuflw	$224, %xmm0, %xmm0
+	.loc 1 478 18 view .LVU902
+	movw	%ax, 10+servo(%rip)
+	.loc 1 479 27 view .LVU903
+	movzwl	2+axisPID(%rip), %eax
+	.loc 1 476 18 view .LVU904
+	movd	%xmm0, 6+servo(%rip)
+	.loc 1 478 9 is_stmt 1 view .LVU905
+	.loc 1 479 9 view .LVU906
+.LVL241:
+	.loc 1 481 19 view .LVU907
+	jmp	.L160
+.LVL242:
+.L166:
+	.loc 1 481 19 is_stmt 0 view .LVU908
+.LBE214:
+.LBE285:
+	.loc 1 610 17 is_stmt 1 view .LVU909
+.LBB286:
+.LBI286:
+	.loc 1 244 5 view .LVU910
+.LBB287:
+	.loc 1 252 5 view .LVU911
+	.loc 1 252 5 is_stmt 0 view .LVU912
+.LBE287:
+.LBE286:
+	.loc 1 610 68 view .LVU913
+	movzwl	2+axisPID(%rip), %eax
+.LBB288:
+.LBB289:
+	.loc 1 252 8 view .LVU914
+	andl	$2, %edx
+.LBE289:
+.LBE288:
+	.loc 1 610 68 view .LVU915
+	movzwl	axisPID(%rip), %edi
+	imull	%eax, %ecx
+.LVL243:
+.LBB291:
+.LBI288:
+	.loc 1 244 5 is_stmt 1 view .LVU916
+.LBB290:
+	.loc 1 252 5 view .LVU917
+	.loc 1 252 8 is_stmt 0 view .LVU918
+	cmpb	$1, %dl
+	sbbl	%edx, %edx
+	andl	$2, %edx
+	subl	$1, %edx
+.LVL244:
+	.loc 1 252 8 view .LVU919
+	jmp	.L306
+.LVL245:
+.L321:
+	.loc 1 252 8 view .LVU920
+.LBE290:
+.LBE291:
+.LBB292:
+.LBB215:
+.LBB211:
+	.loc 1 455 9 is_stmt 1 view .LVU921
+	.loc 1 456 9 view .LVU922
+.LBB205:
+.LBI201:
+	.loc 1 229 9 view .LVU923
+.LBB203:
+	.loc 1 231 5 view .LVU924
+	.loc 1 231 13 is_stmt 0 view .LVU925
+	movzbl	23(%rsi), %eax
+.LVL246:
+	.loc 1 233 5 is_stmt 1 view .LVU926
+	.loc 1 233 8 is_stmt 0 view .LVU927
+	cmpb	$-1, %al
+	je	.L155
+	.loc 1 233 47 view .LVU928
+	cmpb	rxRuntimeConfig(%rip), %al
+	jb	.L328
+.L155:
+	.loc 1 237 5 is_stmt 1 view .LVU929
+	.loc 1 238 9 view .LVU930
+	.loc 1 238 29 is_stmt 0 view .LVU931
+	movswl	20(%rsi), %edi
+.L156:
+.LVL247:
+	.loc 1 238 29 view .LVU932
+.LBE203:
+.LBE205:
+	.loc 1 458 9 is_stmt 1 view .LVU933
+	.loc 1 458 17 is_stmt 0 view .LVU934
+	movswl	18(%rsi), %edx
+	movswl	16(%rsi), %esi
+	call	constrain@PLT
+.LVL248:
+	.loc 1 459 9 is_stmt 1 view .LVU935
+	.loc 1 459 25 is_stmt 0 view .LVU936
+	movq	rxConfig(%rip), %rdx
+	movzwl	10(%rdx), %ecx
+	.loc 1 459 33 view .LVU937
+	movl	%ecx, %edx
+	subl	%eax, %edx
+.LVL249:
+	.loc 1 460 9 is_stmt 1 view .LVU938
+	.loc 1 460 25 is_stmt 0 view .LVU939
+	movzwl	slow_LFlaps.0(%rip), %eax
+	.loc 1 460 12 view .LVU940
+	cmpw	%ax, %dx
+	jle	.L157
+	.loc 1 461 13 is_stmt 1 view .LVU941
+	.loc 1 461 42 is_stmt 0 view .LVU942
+	movq	airplaneConfig(%rip), %rdx
+.LVL250:
+	.loc 1 461 42 view .LVU943
+	movzbl	(%rdx), %edx
+	.loc 1 461 25 view .LVU944
+	addl	%edx, %eax
+	movw	%ax, slow_LFlaps.0(%rip)
+.L158:
+	.loc 1 465 9 is_stmt 1 view .LVU945
+	.loc 1 465 39 is_stmt 0 view .LVU946
+	movq	servoConf(%rip), %rsi
+	.loc 1 466 9 is_stmt 1 view .LVU947
+	.loc 1 465 48 is_stmt 0 view .LVU948
+	cwtl
+	.loc 1 465 21 view .LVU949
+	movsbl	22(%rsi), %edx
+	.loc 1 465 48 view .LVU950
+	imull	%eax, %edx
+	.loc 1 465 18 view .LVU951
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$37, %rax
+	subl	%edx, %eax
+	.loc 1 466 18 view .LVU952
+	addl	%eax, %ecx
+	movw	%cx, 4+servo(%rip)
+	jmp	.L154
+.LVL251:
+.L152:
+	.loc 1 466 18 view .LVU953
+.LBE211:
+	.loc 1 449 9 is_stmt 1 view .LVU954
+	.loc 1 449 20 is_stmt 0 view .LVU955
+	movzwl	2(%rax), %edx
+	movzwl	(%rax), %esi
+	movswl	6+rcCommand(%rip), %edi
+	call	constrain@PLT
+.LVL252:
+	jmp	.L153
+.LVL253:
+.L164:
+	.loc 1 449 20 view .LVU956
+.LBE215:
+.LBE292:
+	.loc 1 602 17 is_stmt 1 view .LVU957
+	.loc 1 602 28 is_stmt 0 view .LVU958
+	movzwl	2(%rax), %edx
+	movzwl	(%rax), %esi
+	movswl	6+rcCommand(%rip), %edi
+	call	constrain@PLT
+.LVL254:
+	jmp	.L165
+.LVL255:
+.L322:
+.LBB293:
+.LBB248:
+	.loc 1 234 9 is_stmt 1 view .LVU959
+	.loc 1 234 22 is_stmt 0 view .LVU960
+	leaq	rcData(%rip), %rdi
+	movzwl	(%rdi,%rdx,2), %edx
+.LVL256:
+	.loc 1 234 22 view .LVU961
+	jmp	.L182
+.LVL257:
+.L320:
+	.loc 1 234 22 view .LVU962
+.LBE248:
+.LBE293:
+.LBB294:
+.LBB238:
+	.loc 1 234 9 is_stmt 1 view .LVU963
+	.loc 1 234 22 is_stmt 0 view .LVU964
+	leaq	rcData(%rip), %rcx
+	movzwl	(%rcx,%rdx,2), %edx
+.LVL258:
+	.loc 1 234 22 view .LVU965
+	jmp	.L179
+.LVL259:
+.L319:
+	.loc 1 234 22 view .LVU966
+.LBE238:
+.LBE294:
+.LBB295:
+.LBB234:
+	.loc 1 234 9 is_stmt 1 view .LVU967
+	.loc 1 234 22 is_stmt 0 view .LVU968
+	leaq	rcData(%rip), %rdi
+	movzwl	(%rdi,%rdx,2), %edx
+.LVL260:
+	.loc 1 234 22 view .LVU969
+	jmp	.L177
+.LVL261:
+.L314:
+	.loc 1 234 22 view .LVU970
+.LBE234:
+.LBE295:
+.LBB296:
+.LBB170:
+	.loc 1 234 9 is_stmt 1 view .LVU971
+	.loc 1 234 22 is_stmt 0 view .LVU972
+	leaq	rcData(%rip), %r8
+	movzwl	(%r8,%rdx,2), %edx
+.LVL262:
+	.loc 1 234 22 view .LVU973
+	jmp	.L140
+.LVL263:
+.L323:
+	.loc 1 234 22 view .LVU974
+.LBE170:
+.LBE296:
+.LBB297:
+.LBB249:
+	.loc 1 234 9 is_stmt 1 view .LVU975
+	.loc 1 234 22 is_stmt 0 view .LVU976
+	leaq	rcData(%rip), %rax
+	movzwl	(%rax,%rdx,2), %eax
+	jmp	.L186
+.LVL264:
+.L327:
+	.loc 1 234 22 view .LVU977
+.LBE249:
+.LBE297:
+.LBB298:
+.LBB278:
+	.loc 1 234 9 is_stmt 1 view .LVU978
+	.loc 1 234 22 is_stmt 0 view .LVU979
+	leaq	rcData(%rip), %rdx
+	movzwl	(%rdx,%rcx,2), %edx
+	jmp	.L147
+.LVL265:
+.L326:
+	.loc 1 234 22 view .LVU980
+.LBE278:
+.LBE298:
+.LBB299:
+.LBB271:
+	.loc 1 234 9 is_stmt 1 view .LVU981
+	.loc 1 234 22 is_stmt 0 view .LVU982
+	leaq	rcData(%rip), %rcx
+	movzwl	(%rcx,%rdx,2), %edx
+.LVL266:
+	.loc 1 234 22 view .LVU983
+	jmp	.L151
+.LVL267:
+.L325:
+	.loc 1 234 22 view .LVU984
+.LBE271:
+.LBE299:
+.LBB300:
+.LBB268:
+	.loc 1 234 9 is_stmt 1 view .LVU985
+	.loc 1 234 22 is_stmt 0 view .LVU986
+	leaq	rcData(%rip), %rsi
+	movzwl	(%rsi,%rdx,2), %edx
+.LVL268:
+	.loc 1 234 22 view .LVU987
+	jmp	.L149
+.LVL269:
+.L315:
+	.loc 1 234 22 view .LVU988
+.LBE268:
+.LBE300:
+.LBB301:
+.LBB180:
+	.loc 1 234 9 is_stmt 1 view .LVU989
+	.loc 1 234 22 is_stmt 0 view .LVU990
+	leaq	rcData(%rip), %rcx
+	movzwl	(%rcx,%rdx,2), %edx
+.LVL270:
+	.loc 1 234 22 view .LVU991
+	jmp	.L147
+.LVL271:
+.L157:
+	.loc 1 234 22 view .LVU992
+.LBE180:
+.LBE301:
+.LBB302:
+.LBB216:
+.LBB212:
+	.loc 1 462 14 is_stmt 1 view .LVU993
+	.loc 1 462 17 is_stmt 0 view .LVU994
+	jge	.L158
+	.loc 1 463 13 is_stmt 1 view .LVU995
+	.loc 1 463 42 is_stmt 0 view .LVU996
+	movq	airplaneConfig(%rip), %rdx
+.LVL272:
+	.loc 1 463 42 view .LVU997
+	movzbl	(%rdx), %edx
+	.loc 1 463 25 view .LVU998
+	subl	%edx, %eax
+	movw	%ax, slow_LFlaps.0(%rip)
+	jmp	.L158
+.LVL273:
+.L328:
+.LBB206:
+.LBB204:
+	.loc 1 234 9 is_stmt 1 view .LVU999
+	.loc 1 234 22 is_stmt 0 view .LVU1000
+	leaq	rcData(%rip), %rdx
+	movswl	(%rdx,%rax,2), %edi
+	jmp	.L156
+.LBE204:
+.LBE206:
+.LBE212:
+.LBE216:
+.LBE302:
+	.cfi_endproc
+.LFE27:
+	.size	mixTable, .-mixTable
+	.section	.text.isMixerUsingServos,"ax",@progbits
+	.p2align 4
+	.globl	isMixerUsingServos
+	.type	isMixerUsingServos, @function
+isMixerUsingServos:
+.LFB28:
+	.loc 1 691 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 692 5 view .LVU1002
+	.loc 1 692 12 is_stmt 0 view .LVU1003
+	movl	useServo(%rip), %eax
+	testl	%eax, %eax
+	setne	%al
+	.loc 1 693 1 view .LVU1004
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	isMixerUsingServos, .-isMixerUsingServos
+	.section	.text.getMotorCount,"ax",@progbits
+	.p2align 4
+	.globl	getMotorCount
+	.type	getMotorCount, @function
+getMotorCount:
+.LFB29:
+	.loc 1 696 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 697 5 view .LVU1006
+	.loc 1 698 1 is_stmt 0 view .LVU1007
+	movzbl	numberMotor(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	getMotorCount, .-getMotorCount
+	.section	.text.getMixerSaturation,"ax",@progbits
+	.p2align 4
+	.globl	getMixerSaturation
+	.type	getMixerSaturation, @function
+getMixerSaturation:
+.LFB30:
+	.loc 1 701 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 702 5 view .LVU1009
+	.loc 1 702 12 is_stmt 0 view .LVU1010
+	leaq	mixerSaturation(%rip), %rax
+	.loc 1 703 1 view .LVU1011
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	getMixerSaturation, .-getMixerSaturation
+	.section	.text.mixerResetSaturation,"ax",@progbits
+	.p2align 4
+	.globl	mixerResetSaturation
+	.type	mixerResetSaturation, @function
+mixerResetSaturation:
+.LFB31:
+	.loc 1 706 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 707 5 view .LVU1013
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, mixerSaturation(%rip)
+	.loc 1 708 1 is_stmt 0 view .LVU1014
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	mixerResetSaturation, .-mixerResetSaturation
+	.section	.bss.slow_LFlaps.0,"aw",@nobits
+	.align 2
+	.type	slow_LFlaps.0, @object
+	.size	slow_LFlaps.0, 2
+slow_LFlaps.0:
+	.zero	2
+	.section	.bss.customMixers,"aw",@nobits
+	.align 8
+	.type	customMixers, @object
+	.size	customMixers, 8
+customMixers:
+	.zero	8
+	.globl	mixers
+	.section	.data.rel.ro.local.mixers,"aw"
+	.align 32
+	.type	mixers, @object
+	.size	mixers, 368
+mixers:
+	.byte	0
+	.byte	0
+	.zero	6
+	.quad	0
+	.byte	3
+	.byte	1
+	.zero	6
+	.quad	mixerTri
+	.byte	4
+	.byte	0
+	.zero	6
+	.quad	mixerQuadP
+	.byte	4
+	.byte	0
+	.zero	6
+	.quad	mixerQuadX
+	.byte	2
+	.byte	1
+	.zero	6
+	.quad	mixerBi
+	.byte	0
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	6
+	.byte	0
+	.zero	6
+	.quad	mixerY6
+	.byte	6
+	.byte	0
+	.zero	6
+	.quad	mixerHex6P
+	.byte	1
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	4
+	.byte	0
+	.zero	6
+	.quad	mixerY4
+	.byte	6
+	.byte	0
+	.zero	6
+	.quad	mixerHex6X
+	.byte	8
+	.byte	0
+	.zero	6
+	.quad	mixerOctoX8
+	.byte	8
+	.byte	0
+	.zero	6
+	.quad	mixerOctoFlatP
+	.byte	8
+	.byte	0
+	.zero	6
+	.quad	mixerOctoFlatX
+	.byte	1
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	0
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	0
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	4
+	.byte	0
+	.zero	6
+	.quad	mixerVtail4
+	.byte	6
+	.byte	0
+	.zero	6
+	.quad	mixerHex6H
+	.byte	0
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	2
+	.byte	1
+	.zero	6
+	.quad	mixerDualcopter
+	.byte	1
+	.byte	1
+	.zero	6
+	.quad	0
+	.byte	0
+	.byte	0
+	.zero	6
+	.quad	0
+	.section	.rodata.mixerDualcopter,"a"
+	.align 32
+	.type	mixerDualcopter, @object
+	.size	mixerDualcopter, 32
+mixerDualcopter:
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	-1082130432
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	1065353216
+	.section	.rodata.mixerHex6H,"a"
+	.align 32
+	.type	mixerHex6H, @object
+	.size	mixerHex6H, 96
+mixerHex6H:
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	0
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.mixerVtail4,"a"
+	.align 32
+	.type	mixerVtail4, @object
+	.size	mixerVtail4, 64
+mixerVtail4:
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	0
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-2147483648
+	.section	.rodata.mixerOctoFlatX,"a"
+	.align 32
+	.type	mixerOctoFlatX, @object
+	.size	mixerOctoFlatX, 128
+mixerOctoFlatX:
+	.long	1065353216
+	.long	1065353216
+	.long	-1090519040
+	.long	1065353216
+	.long	1065353216
+	.long	-1090519040
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	1056964608
+	.long	1065353216
+	.long	1065353216
+	.long	1056964608
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1056964608
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1090519040
+	.long	-1082130432
+	.long	1065353216
+	.long	-1090519040
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1056964608
+	.long	-1082130432
+	.section	.rodata.mixerOctoFlatP,"a"
+	.align 32
+	.type	mixerOctoFlatP, @object
+	.size	mixerOctoFlatP, 128
+mixerOctoFlatP:
+	.long	1065353216
+	.long	1060439287
+	.long	-1087044361
+	.long	1065353216
+	.long	1065353216
+	.long	-1087044361
+	.long	-1087044361
+	.long	1065353216
+	.long	1065353216
+	.long	-1087044361
+	.long	1060439287
+	.long	1065353216
+	.long	1065353216
+	.long	1060439287
+	.long	1060439287
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	0
+	.long	-1082130432
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	-1082130432
+	.section	.rodata.mixerOctoX8,"a"
+	.align 32
+	.type	mixerOctoX8, @object
+	.size	mixerOctoX8, 128
+mixerOctoX8:
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.section	.rodata.mixerHex6X,"a"
+	.align 32
+	.type	mixerHex6X, @object
+	.size	mixerHex6X, 96
+mixerHex6X:
+	.long	1065353216
+	.long	-1090519040
+	.long	1063105488
+	.long	1065353216
+	.long	1065353216
+	.long	-1090519040
+	.long	-1084378160
+	.long	1065353216
+	.long	1065353216
+	.long	1056964608
+	.long	1063105488
+	.long	-1082130432
+	.long	1065353216
+	.long	1056964608
+	.long	-1084378160
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	0
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.section	.rodata.mixerY4,"a"
+	.align 32
+	.type	mixerY4, @object
+	.size	mixerY4, 64
+mixerY4:
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	0
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	0
+	.section	.rodata.mixerHex6P,"a"
+	.align 32
+	.type	mixerHex6P, @object
+	.size	mixerHex6P, 96
+mixerHex6P:
+	.long	1065353216
+	.long	-1084378160
+	.long	1056964608
+	.long	1065353216
+	.long	1065353216
+	.long	-1084378160
+	.long	-1090519040
+	.long	-1082130432
+	.long	1065353216
+	.long	1063105488
+	.long	1056964608
+	.long	1065353216
+	.long	1065353216
+	.long	1063105488
+	.long	-1090519040
+	.long	-1082130432
+	.long	1065353216
+	.long	0
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.section	.rodata.mixerY6,"a"
+	.align 32
+	.type	mixerY6, @object
+	.size	mixerY6, 96
+mixerY6:
+	.long	1065353216
+	.long	0
+	.long	1068149416
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1087722832
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	-1087722832
+	.long	-1082130432
+	.long	1065353216
+	.long	0
+	.long	1068149416
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1087722832
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1087722832
+	.long	1065353216
+	.section	.rodata.mixerBi,"a"
+	.align 32
+	.type	mixerBi, @object
+	.size	mixerBi, 32
+mixerBi:
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	0
+	.long	0
+	.section	.rodata.mixerQuadX,"a"
+	.align 32
+	.type	mixerQuadX, @object
+	.size	mixerQuadX, 64
+mixerQuadX:
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	-1082130432
+	.long	-1082130432
+	.section	.rodata.mixerQuadP,"a"
+	.align 32
+	.type	mixerQuadP, @object
+	.size	mixerQuadP, 64
+mixerQuadP:
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	1065353216
+	.long	-1082130432
+	.long	0
+	.long	1065353216
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	1065353216
+	.long	1065353216
+	.long	0
+	.long	-1082130432
+	.long	-1082130432
+	.section	.rodata.mixerTri,"a"
+	.align 32
+	.type	mixerTri, @object
+	.size	mixerTri, 48
+mixerTri:
+	.long	1065353216
+	.long	0
+	.long	1068149416
+	.long	0
+	.long	1065353216
+	.long	-1082130432
+	.long	-1087722832
+	.long	0
+	.long	1065353216
+	.long	1065353216
+	.long	-1087722832
+	.long	0
+	.section	.bss.mixerSaturation,"aw",@nobits
+	.align 16
+	.type	mixerSaturation, @object
+	.size	mixerSaturation, 16
+mixerSaturation:
+	.zero	16
+	.section	.bss.currentMixerConfiguration,"aw",@nobits
+	.align 4
+	.type	currentMixerConfiguration, @object
+	.size	currentMixerConfiguration, 4
+currentMixerConfiguration:
+	.zero	4
+	.section	.bss.motorMixWeights,"aw",@nobits
+	.align 32
+	.type	motorMixWeights, @object
+	.size	motorMixWeights, 192
+motorMixWeights:
+	.zero	192
+	.section	.bss.gimbalConfig,"aw",@nobits
+	.align 8
+	.type	gimbalConfig, @object
+	.size	gimbalConfig, 8
+gimbalConfig:
+	.zero	8
+	.section	.bss.rxConfig,"aw",@nobits
+	.align 8
+	.type	rxConfig, @object
+	.size	rxConfig, 8
+rxConfig:
+	.zero	8
+	.section	.bss.airplaneConfig,"aw",@nobits
+	.align 8
+	.type	airplaneConfig, @object
+	.size	airplaneConfig, 8
+airplaneConfig:
+	.zero	8
+	.section	.bss.escAndServoConfig,"aw",@nobits
+	.align 8
+	.type	escAndServoConfig, @object
+	.size	escAndServoConfig, 8
+escAndServoConfig:
+	.zero	8
+	.section	.bss.flight3DConfig,"aw",@nobits
+	.align 8
+	.type	flight3DConfig, @object
+	.size	flight3DConfig, 8
+flight3DConfig:
+	.zero	8
+	.section	.bss.mixerConfig,"aw",@nobits
+	.align 8
+	.type	mixerConfig, @object
+	.size	mixerConfig, 8
+mixerConfig:
+	.zero	8
+	.section	.bss.servoConf,"aw",@nobits
+	.align 8
+	.type	servoConf, @object
+	.size	servoConf, 8
+servoConf:
+	.zero	8
+	.section	.bss.servoCount,"aw",@nobits
+	.type	servoCount, @object
+	.size	servoCount, 1
+servoCount:
+	.zero	1
+	.section	.bss.useServo,"aw",@nobits
+	.align 4
+	.type	useServo, @object
+	.size	useServo, 4
+useServo:
+	.zero	4
+	.globl	servo
+	.section	.data.servo,"aw"
+	.align 16
+	.type	servo, @object
+	.size	servo, 16
+servo:
+	.value	1500
+	.value	1500
+	.value	1500
+	.value	1500
+	.value	1500
+	.value	1500
+	.value	1500
+	.value	1500
+	.comm	motor_disarmed,24,16
+	.comm	motor,24,16
+	.section	.bss.numberMotor,"aw",@nobits
+	.type	numberMotor, @object
+	.size	numberMotor, 1
+numberMotor:
+	.zero	1
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1166016512
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/drivers/pwm_mapping.h"
+	.file 7 ".//src/main/rx/rx.h"
+	.file 8 ".//src/main/io/gimbal.h"
+	.file 9 ".//src/main/io/escservo.h"
+	.file 10 ".//src/main/io/rc_controls.h"
+	.file 11 ".//src/main/flight/mixer.h"
+	.file 12 ".//src/main/flight/flight.h"
+	.file 13 ".//src/main/config/runtime_config.h"
+	.file 14 ".//src/main/config/config.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 ".//src/main/common/maths.h"
+	.file 17 ".//src/main/drivers/pwm_output.h"
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1dfd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x30
+	.long	.LASF1670
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL123
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1378
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1379
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1380
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1381
+	.uleb128 0x5
+	.long	.LASF1383
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1382
+	.uleb128 0x5
+	.long	.LASF1384
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x5
+	.long	.LASF1385
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1386
+	.uleb128 0x5
+	.long	.LASF1387
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF1388
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1389
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1390
+	.uleb128 0x32
+	.byte	0x8
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1391
+	.uleb128 0x5
+	.long	.LASF1392
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x5
+	.long	.LASF1393
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF1394
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x5
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x5
+	.long	.LASF1396
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x5
+	.long	.LASF1397
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x5
+	.long	.LASF1398
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1399
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1400
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1401
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1402
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1403
+	.uleb128 0xd
+	.long	.LASF1407
+	.byte	0x2
+	.byte	0x6
+	.byte	0x3e
+	.long	0x155
+	.uleb128 0x3
+	.long	.LASF1404
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1405
+	.byte	0x6
+	.byte	0x40
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1406
+	.byte	0x6
+	.byte	0x41
+	.byte	0x3
+	.long	0x12e
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x171
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x11
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1420
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x161
+	.uleb128 0xd
+	.long	.LASF1408
+	.byte	0x12
+	.byte	0x7
+	.byte	0x3d
+	.long	0x1d8
+	.uleb128 0x3
+	.long	.LASF1409
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xd
+	.long	0x1d8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1410
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1411
+	.byte	0x7
+	.byte	0x40
+	.byte	0xe
+	.long	0xe7
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1412
+	.byte	0x7
+	.byte	0x41
+	.byte	0xe
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1413
+	.byte	0x7
+	.byte	0x42
+	.byte	0xe
+	.long	0xe7
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1414
+	.byte	0x7
+	.byte	0x43
+	.byte	0xd
+	.long	0xdb
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0xdb
+	.long	0x1e8
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x7
+	.byte	0x44
+	.byte	0x3
+	.long	0x17d
+	.uleb128 0xd
+	.long	.LASF1416
+	.byte	0x2
+	.byte	0x7
+	.byte	0x48
+	.long	0x21b
+	.uleb128 0x3
+	.long	.LASF1417
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1418
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1419
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x3
+	.long	0x1f4
+	.uleb128 0x10
+	.long	.LASF1421
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x21b
+	.uleb128 0x23
+	.long	.LASF1457
+	.long	0x3c
+	.byte	0x8
+	.byte	0x14
+	.long	0x255
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1425
+	.byte	0x1
+	.byte	0x8
+	.byte	0x1a
+	.long	0x26f
+	.uleb128 0x3
+	.long	.LASF1426
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1427
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x3
+	.long	0x255
+	.uleb128 0xd
+	.long	.LASF1428
+	.byte	0x6
+	.byte	0x9
+	.byte	0x14
+	.long	0x2af
+	.uleb128 0x3
+	.long	.LASF1429
+	.byte	0x9
+	.byte	0x15
+	.byte	0xe
+	.long	0xe7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1430
+	.byte	0x9
+	.byte	0x16
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1431
+	.byte	0x9
+	.byte	0x17
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1432
+	.byte	0x9
+	.byte	0x18
+	.byte	0x3
+	.long	0x27b
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xa
+	.byte	0x14
+	.long	0x351
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1434
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1435
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1437
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1441
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1442
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1444
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1445
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1447
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1448
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1449
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1451
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1452
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x16
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1456
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x11
+	.long	0xf3
+	.uleb128 0x23
+	.long	.LASF1458
+	.long	0x3c
+	.byte	0xa
+	.byte	0x34
+	.long	0x3b5
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x1
+	.uleb128 0x33
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x3c5
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1470
+	.byte	0xa
+	.byte	0x7c
+	.byte	0x10
+	.long	0x3b5
+	.uleb128 0x23
+	.long	.LASF1471
+	.long	0x3c
+	.byte	0xb
+	.byte	0x18
+	.long	0x46b
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1477
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1478
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1480
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1483
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1484
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1485
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1486
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1487
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x17
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1471
+	.byte	0xb
+	.byte	0x31
+	.byte	0x3
+	.long	0x3d1
+	.uleb128 0xd
+	.long	.LASF1495
+	.byte	0x10
+	.byte	0xb
+	.byte	0x34
+	.long	0x4b8
+	.uleb128 0x3
+	.long	.LASF1496
+	.byte	0xb
+	.byte	0x35
+	.byte	0xb
+	.long	0x119
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1497
+	.byte	0xb
+	.byte	0x36
+	.byte	0xb
+	.long	0x119
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0xb
+	.byte	0x37
+	.byte	0xb
+	.long	0x119
+	.byte	0x8
+	.uleb128 0x20
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x38
+	.byte	0xb
+	.long	0x119
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1495
+	.byte	0xb
+	.byte	0x39
+	.byte	0x3
+	.long	0x477
+	.uleb128 0x15
+	.long	0x4b8
+	.uleb128 0xd
+	.long	.LASF1499
+	.byte	0x10
+	.byte	0xb
+	.byte	0x3c
+	.long	0x4fd
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0xb
+	.byte	0x3d
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1501
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x19
+	.long	0x4fd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	0x4c4
+	.uleb128 0x5
+	.long	.LASF1499
+	.byte	0xb
+	.byte	0x40
+	.byte	0x3
+	.long	0x4c9
+	.uleb128 0x15
+	.long	0x502
+	.uleb128 0xd
+	.long	.LASF1503
+	.byte	0x2
+	.byte	0xb
+	.byte	0x42
+	.long	0x53a
+	.uleb128 0x3
+	.long	.LASF1504
+	.byte	0xb
+	.byte	0x43
+	.byte	0xc
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1505
+	.byte	0xb
+	.byte	0x44
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1506
+	.byte	0xb
+	.byte	0x45
+	.byte	0x3
+	.long	0x513
+	.uleb128 0xd
+	.long	.LASF1507
+	.byte	0x8
+	.byte	0xb
+	.byte	0x47
+	.long	0x587
+	.uleb128 0x3
+	.long	.LASF1508
+	.byte	0xb
+	.byte	0x48
+	.byte	0xe
+	.long	0xe7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1509
+	.byte	0xb
+	.byte	0x49
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1510
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1511
+	.byte	0xb
+	.byte	0x4b
+	.byte	0xe
+	.long	0xe7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1512
+	.byte	0xb
+	.byte	0x4c
+	.byte	0x3
+	.long	0x546
+	.uleb128 0xd
+	.long	.LASF1513
+	.byte	0x1
+	.byte	0xb
+	.byte	0x4e
+	.long	0x5ad
+	.uleb128 0x3
+	.long	.LASF1514
+	.byte	0xb
+	.byte	0x4f
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1513
+	.byte	0xb
+	.byte	0x50
+	.byte	0x3
+	.long	0x593
+	.uleb128 0xd
+	.long	.LASF1515
+	.byte	0x8
+	.byte	0xb
+	.byte	0x54
+	.long	0x607
+	.uleb128 0x20
+	.string	"min"
+	.byte	0xb
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x20
+	.string	"max"
+	.byte	0xb
+	.byte	0x56
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1516
+	.byte	0xb
+	.byte	0x57
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1517
+	.byte	0xb
+	.byte	0x58
+	.byte	0xc
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1518
+	.byte	0xb
+	.byte	0x59
+	.byte	0xc
+	.long	0xb7
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1515
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x3
+	.long	0x5b9
+	.uleb128 0xd
+	.long	.LASF1519
+	.byte	0x10
+	.byte	0xb
+	.byte	0x5d
+	.long	0x654
+	.uleb128 0x3
+	.long	.LASF1520
+	.byte	0xb
+	.byte	0x5e
+	.byte	0xe
+	.long	0xf3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1521
+	.byte	0xb
+	.byte	0x5f
+	.byte	0xe
+	.long	0xf3
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1522
+	.byte	0xb
+	.byte	0x60
+	.byte	0xe
+	.long	0xf3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0xb
+	.byte	0x61
+	.byte	0xe
+	.long	0xf3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1524
+	.byte	0xb
+	.byte	0x62
+	.byte	0x3
+	.long	0x613
+	.uleb128 0x15
+	.long	0x654
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x675
+	.uleb128 0xb
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1502
+	.byte	0xb
+	.byte	0x64
+	.byte	0x10
+	.long	0x665
+	.uleb128 0x10
+	.long	.LASF1525
+	.byte	0xb
+	.byte	0x65
+	.byte	0x10
+	.long	0x665
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x69d
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1526
+	.byte	0xb
+	.byte	0x66
+	.byte	0x10
+	.long	0x68d
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xc
+	.byte	0x15
+	.long	0x6f7
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x707
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xc3
+	.long	0x717
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1538
+	.byte	0x4
+	.byte	0xc
+	.byte	0x6c
+	.long	0x73e
+	.uleb128 0x3
+	.long	.LASF1539
+	.byte	0xc
+	.byte	0x6e
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1540
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1541
+	.byte	0xc
+	.byte	0x70
+	.byte	0x3
+	.long	0x717
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0xc
+	.byte	0x72
+	.byte	0x9
+	.long	0x76c
+	.uleb128 0x35
+	.string	"raw"
+	.byte	0xc
+	.byte	0x73
+	.byte	0xd
+	.long	0x707
+	.uleb128 0x36
+	.long	.LASF1542
+	.byte	0xc
+	.byte	0x74
+	.byte	0x23
+	.long	0x73e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1543
+	.byte	0xc
+	.byte	0x75
+	.byte	0x3
+	.long	0x74a
+	.uleb128 0x10
+	.long	.LASF1544
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x22
+	.long	0x76c
+	.uleb128 0x10
+	.long	.LASF1545
+	.byte	0xc
+	.byte	0x82
+	.byte	0x10
+	.long	0x6f7
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xd
+	.byte	0x15
+	.long	0x7ae
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1549
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xd
+	.byte	0x21
+	.long	0x804
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x80
+	.uleb128 0x12
+	.long	.LASF1558
+	.value	0x100
+	.uleb128 0x12
+	.long	.LASF1559
+	.value	0x200
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1560
+	.byte	0xd
+	.byte	0x2e
+	.byte	0x11
+	.long	0xe7
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xd
+	.byte	0x34
+	.long	0x83a
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1566
+	.byte	0xd
+	.byte	0x40
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x18
+	.long	0x3c
+	.byte	0xe
+	.byte	0x14
+	.long	0x8e7
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x80
+	.uleb128 0x12
+	.long	.LASF1575
+	.value	0x100
+	.uleb128 0x12
+	.long	.LASF1576
+	.value	0x200
+	.uleb128 0x12
+	.long	.LASF1577
+	.value	0x400
+	.uleb128 0x12
+	.long	.LASF1578
+	.value	0x800
+	.uleb128 0x12
+	.long	.LASF1579
+	.value	0x1000
+	.uleb128 0x12
+	.long	.LASF1580
+	.value	0x2000
+	.uleb128 0x12
+	.long	.LASF1581
+	.value	0x4000
+	.uleb128 0x12
+	.long	.LASF1582
+	.value	0x8000
+	.uleb128 0x1b
+	.long	.LASF1583
+	.long	0x10000
+	.uleb128 0x1b
+	.long	.LASF1584
+	.long	0x20000
+	.uleb128 0x1b
+	.long	.LASF1585
+	.long	0x40000
+	.uleb128 0x1b
+	.long	.LASF1586
+	.long	0x80000
+	.uleb128 0x1b
+	.long	.LASF1587
+	.long	0x100000
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1500
+	.byte	0x2d
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	numberMotor
+	.uleb128 0x24
+	.long	0x675
+	.byte	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	motor
+	.uleb128 0x24
+	.long	0x681
+	.byte	0x2f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	motor_disarmed
+	.uleb128 0x24
+	.long	0x69d
+	.byte	0x30
+	.uleb128 0x9
+	.byte	0x3
+	.quad	servo
+	.uleb128 0x7
+	.long	.LASF1501
+	.byte	0x32
+	.byte	0xc
+	.long	0x94
+	.uleb128 0x9
+	.byte	0x3
+	.quad	useServo
+	.uleb128 0x7
+	.long	.LASF1404
+	.byte	0x34
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	servoCount
+	.uleb128 0x7
+	.long	.LASF1588
+	.byte	0x36
+	.byte	0x16
+	.long	0x96b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	servoConf
+	.uleb128 0x11
+	.long	0x607
+	.uleb128 0x7
+	.long	.LASF1589
+	.byte	0x37
+	.byte	0x17
+	.long	0x985
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerConfig
+	.uleb128 0x11
+	.long	0x53a
+	.uleb128 0x7
+	.long	.LASF1590
+	.byte	0x38
+	.byte	0x1a
+	.long	0x99f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	flight3DConfig
+	.uleb128 0x11
+	.long	0x587
+	.uleb128 0x7
+	.long	.LASF1591
+	.byte	0x39
+	.byte	0x1d
+	.long	0x9b9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	escAndServoConfig
+	.uleb128 0x11
+	.long	0x2af
+	.uleb128 0x7
+	.long	.LASF1592
+	.byte	0x3a
+	.byte	0x1a
+	.long	0x9d3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	airplaneConfig
+	.uleb128 0x11
+	.long	0x5ad
+	.uleb128 0x7
+	.long	.LASF1593
+	.byte	0x3b
+	.byte	0x14
+	.long	0x9ed
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxConfig
+	.uleb128 0x11
+	.long	0x1e8
+	.uleb128 0x7
+	.long	.LASF1594
+	.byte	0x3c
+	.byte	0x18
+	.long	0xa07
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gimbalConfig
+	.uleb128 0x11
+	.long	0x26f
+	.uleb128 0xd
+	.long	.LASF1595
+	.byte	0x10
+	.byte	0x1
+	.byte	0x41
+	.long	0xa4d
+	.uleb128 0x3
+	.long	.LASF1496
+	.byte	0x1
+	.byte	0x42
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1497
+	.byte	0x1
+	.byte	0x43
+	.byte	0xd
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0x1
+	.byte	0x44
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x20
+	.string	"yaw"
+	.byte	0x1
+	.byte	0x45
+	.byte	0xd
+	.long	0xcf
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1596
+	.byte	0x1
+	.byte	0x46
+	.byte	0x3
+	.long	0xa0c
+	.uleb128 0xa
+	.long	0xa4d
+	.long	0xa69
+	.uleb128 0xb
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1597
+	.byte	0x48
+	.byte	0x1a
+	.long	0xa59
+	.uleb128 0x9
+	.byte	0x3
+	.quad	motorMixWeights
+	.uleb128 0x7
+	.long	.LASF1598
+	.byte	0x49
+	.byte	0x12
+	.long	0x46b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentMixerConfiguration
+	.uleb128 0x7
+	.long	.LASF1599
+	.byte	0x4b
+	.byte	0x1a
+	.long	0x654
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerSaturation
+	.uleb128 0xa
+	.long	0x4c4
+	.long	0xab8
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x15
+	.long	0xaa8
+	.uleb128 0x7
+	.long	.LASF1600
+	.byte	0x4d
+	.byte	0x1b
+	.long	0xab8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerTri
+	.uleb128 0xa
+	.long	0x4c4
+	.long	0xae2
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x3
+	.byte	0
+	.uleb128 0x15
+	.long	0xad2
+	.uleb128 0x7
+	.long	.LASF1601
+	.byte	0x53
+	.byte	0x1b
+	.long	0xae2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerQuadP
+	.uleb128 0x7
+	.long	.LASF1602
+	.byte	0x5a
+	.byte	0x1b
+	.long	0xae2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerQuadX
+	.uleb128 0xa
+	.long	0x4c4
+	.long	0xb21
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	0xb11
+	.uleb128 0x7
+	.long	.LASF1603
+	.byte	0x61
+	.byte	0x1b
+	.long	0xb21
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerBi
+	.uleb128 0xa
+	.long	0x4c4
+	.long	0xb4b
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x5
+	.byte	0
+	.uleb128 0x15
+	.long	0xb3b
+	.uleb128 0x7
+	.long	.LASF1604
+	.byte	0x66
+	.byte	0x1b
+	.long	0xb4b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerY6
+	.uleb128 0x7
+	.long	.LASF1605
+	.byte	0x6f
+	.byte	0x1b
+	.long	0xb4b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerHex6P
+	.uleb128 0x7
+	.long	.LASF1606
+	.byte	0x78
+	.byte	0x1b
+	.long	0xae2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerY4
+	.uleb128 0x7
+	.long	.LASF1607
+	.byte	0x7f
+	.byte	0x1b
+	.long	0xb4b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerHex6X
+	.uleb128 0xa
+	.long	0x4c4
+	.long	0xbb4
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x15
+	.long	0xba4
+	.uleb128 0x7
+	.long	.LASF1608
+	.byte	0x88
+	.byte	0x1b
+	.long	0xbb4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerOctoX8
+	.uleb128 0x7
+	.long	.LASF1609
+	.byte	0x93
+	.byte	0x1b
+	.long	0xbb4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerOctoFlatP
+	.uleb128 0x7
+	.long	.LASF1610
+	.byte	0x9e
+	.byte	0x1b
+	.long	0xbb4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerOctoFlatX
+	.uleb128 0x7
+	.long	.LASF1611
+	.byte	0xa9
+	.byte	0x1b
+	.long	0xae2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerVtail4
+	.uleb128 0x7
+	.long	.LASF1612
+	.byte	0xb0
+	.byte	0x1b
+	.long	0xb4b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerHex6H
+	.uleb128 0x7
+	.long	.LASF1613
+	.byte	0xb9
+	.byte	0x1b
+	.long	0xb21
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerDualcopter
+	.uleb128 0xa
+	.long	0x50e
+	.long	0xc47
+	.uleb128 0xb
+	.long	0x43
+	.byte	0x16
+	.byte	0
+	.uleb128 0x15
+	.long	0xc37
+	.uleb128 0x37
+	.long	.LASF1614
+	.byte	0x1
+	.byte	0xbf
+	.byte	0xf
+	.long	0xc47
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixers
+	.uleb128 0x2b
+	.long	.LASF1615
+	.value	0x102
+	.byte	0x16
+	.long	0xc78
+	.uleb128 0x9
+	.byte	0x3
+	.quad	customMixers
+	.uleb128 0x11
+	.long	0x4b8
+	.uleb128 0x25
+	.long	.LASF1616
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0xc9d
+	.uleb128 0xf
+	.long	0xae
+	.uleb128 0xf
+	.long	0x94
+	.uleb128 0xf
+	.long	0xff
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1617
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x5
+	.long	0x94
+	.long	0xcbd
+	.uleb128 0xf
+	.long	0x94
+	.uleb128 0xf
+	.long	0x94
+	.uleb128 0xf
+	.long	0x94
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1618
+	.byte	0x1b
+	.long	0xccd
+	.uleb128 0xf
+	.long	0xdb
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1619
+	.byte	0x1a
+	.long	0xce2
+	.uleb128 0xf
+	.long	0xdb
+	.uleb128 0xf
+	.long	0xe7
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1620
+	.byte	0x1e
+	.long	0xcf7
+	.uleb128 0xf
+	.long	0xdb
+	.uleb128 0xf
+	.long	0xe7
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1621
+	.byte	0x12
+	.value	0x13d
+	.byte	0x11
+	.long	0xa7
+	.long	0xd0e
+	.uleb128 0xf
+	.long	0x119
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1622
+	.byte	0xe
+	.byte	0x2c
+	.byte	0x5
+	.long	0x127
+	.long	0xd24
+	.uleb128 0xf
+	.long	0xf3
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1671
+	.byte	0x1
+	.value	0x2c1
+	.byte	0x6
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x27
+	.long	.LASF1623
+	.value	0x2bc
+	.byte	0x1a
+	.long	0xd5d
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x11
+	.long	0x660
+	.uleb128 0x27
+	.long	.LASF1624
+	.value	0x2b7
+	.byte	0x9
+	.long	0xdb
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x27
+	.long	.LASF1625
+	.value	0x2b2
+	.byte	0x5
+	.long	0x127
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x16
+	.long	.LASF1645
+	.value	0x230
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1690
+	.uleb128 0x1c
+	.long	.LASF1626
+	.value	0x232
+	.byte	0xd
+	.long	0xc3
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1c
+	.long	.LASF1627
+	.value	0x232
+	.byte	0x18
+	.long	0xc3
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x233
+	.byte	0xe
+	.long	0xf3
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x13
+	.long	.LASF1631
+	.value	0x235
+	.byte	0x9
+	.long	0x127
+	.uleb128 0x3a
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.long	0xe6a
+	.uleb128 0x1c
+	.long	.LASF1628
+	.value	0x295
+	.byte	0x10
+	.long	0xb7
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x1c
+	.long	.LASF1629
+	.value	0x298
+	.byte	0x11
+	.long	0xdb
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x1c
+	.long	.LASF1630
+	.value	0x29a
+	.byte	0x10
+	.long	0xb7
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x19
+	.quad	.LVL150
+	.long	0xce2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x172e
+	.quad	.LBI143
+	.value	.LVU294
+	.long	.LLRL26
+	.value	0x237
+	.byte	0x5
+	.long	0xeb4
+	.uleb128 0x2
+	.long	0x1745
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x2
+	.long	0x1739
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x19
+	.quad	.LVL93
+	.long	0xd0e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1690
+	.quad	.LBI150
+	.value	.LVU337
+	.long	.LLRL29
+	.value	0x240
+	.byte	0x9
+	.long	0xf60
+	.uleb128 0x2
+	.long	0x16a7
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2
+	.long	0x169b
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0xc
+	.long	.LLRL29
+	.uleb128 0x3b
+	.long	0x16b3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x8
+	.long	0x16bf
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x8
+	.long	0x16cb
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x8
+	.long	0x16d7
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x8
+	.long	0x16e3
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x8
+	.long	0x16ef
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x8
+	.long	0x16fb
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x8
+	.long	0x1707
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x8
+	.long	0x1713
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI156
+	.value	.LVU421
+	.long	.LLRL40
+	.value	0x245
+	.byte	0x19
+	.long	0xf95
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI161
+	.value	.LVU429
+	.long	.LLRL43
+	.value	0x245
+	.byte	0x41
+	.long	0xfca
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI168
+	.value	.LVU436
+	.long	.LLRL46
+	.value	0x245
+	.byte	0x6a
+	.long	0x1005
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xc
+	.long	.LLRL46
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI171
+	.value	.LVU450
+	.long	.LLRL49
+	.value	0x246
+	.byte	0x19
+	.long	0x103a
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1cae
+	.quad	.LBI175
+	.value	.LVU453
+	.quad	.LBB175
+	.quad	.LBE175-.LBB175
+	.value	0x246
+	.byte	0x41
+	.long	0x107b
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST53
+	.long	.LVUS53
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI177
+	.value	.LVU458
+	.long	.LLRL54
+	.value	0x246
+	.byte	0x6a
+	.long	0x10b6
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0xc
+	.long	.LLRL54
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI182
+	.value	.LVU475
+	.long	.LLRL57
+	.value	0x27f
+	.byte	0x14
+	.long	0x10f1
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xc
+	.long	.LLRL57
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI187
+	.value	.LVU488
+	.long	.LLRL60
+	.value	0x280
+	.byte	0x14
+	.long	0x112c
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xc
+	.long	.LLRL60
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST62
+	.long	.LVUS62
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI192
+	.value	.LVU784
+	.long	.LLRL63
+	.value	0x272
+	.byte	0x2c
+	.long	0x1161
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x6
+	.long	0x1757
+	.quad	.LBI198
+	.value	.LVU667
+	.long	.LLRL69
+	.value	0x253
+	.byte	0xd
+	.long	0x123f
+	.uleb128 0xc
+	.long	.LLRL69
+	.uleb128 0x3c
+	.long	0x1762
+	.uleb128 0x8
+	.long	0x176e
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x3d
+	.long	0x1778
+	.long	.LLRL71
+	.long	0x11f5
+	.uleb128 0x8
+	.long	0x178f
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI201
+	.value	.LVU923
+	.long	.LLRL73
+	.value	0x1c8
+	.byte	0x19
+	.long	0x11e7
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0xc
+	.long	.LLRL73
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL248
+	.long	0xc9d
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI207
+	.value	.LVU713
+	.long	.LLRL76
+	.value	0x1e3
+	.byte	0x15
+	.long	0x1230
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xc
+	.long	.LLRL76
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL252
+	.long	0xc9d
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI217
+	.value	.LVU621
+	.long	.LLRL79
+	.value	0x25e
+	.byte	0x1d
+	.long	0x1274
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI223
+	.value	.LVU627
+	.long	.LLRL82
+	.value	0x25e
+	.byte	0x49
+	.long	0x12a9
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1cae
+	.quad	.LBI227
+	.value	.LVU633
+	.quad	.LBB227
+	.quad	.LBE227-.LBB227
+	.value	0x263
+	.byte	0x1d
+	.long	0x12ea
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1cae
+	.quad	.LBI229
+	.value	.LVU637
+	.quad	.LBB229
+	.quad	.LBE229-.LBB229
+	.value	0x263
+	.byte	0x47
+	.long	0x132b
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST88
+	.long	.LVUS88
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI231
+	.value	.LVU643
+	.long	.LLRL89
+	.value	0x265
+	.byte	0x19
+	.long	0x1366
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xc
+	.long	.LLRL89
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI236
+	.value	.LVU654
+	.long	.LLRL92
+	.value	0x266
+	.byte	0x19
+	.long	0x13a1
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0xc
+	.long	.LLRL92
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI240
+	.value	.LVU729
+	.long	.LLRL95
+	.value	0x26b
+	.byte	0x2d
+	.long	0x13d6
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI244
+	.value	.LVU735
+	.long	.LLRL98
+	.value	0x26c
+	.byte	0x1d
+	.long	0x1411
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0xc
+	.long	.LLRL98
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI254
+	.value	.LVU797
+	.long	.LLRL101
+	.value	0x273
+	.byte	0x1d
+	.long	0x144c
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0xc
+	.long	.LLRL101
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST103
+	.long	.LVUS103
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1cae
+	.quad	.LBI263
+	.value	.LVU791
+	.quad	.LBB263
+	.quad	.LBE263-.LBB263
+	.value	0x272
+	.byte	0x5d
+	.long	0x148d
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI266
+	.value	.LVU819
+	.long	.LLRL106
+	.value	0x24e
+	.byte	0x64
+	.long	0x14c8
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xc
+	.long	.LLRL106
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI269
+	.value	.LVU836
+	.long	.LLRL109
+	.value	0x24f
+	.byte	0x63
+	.long	0x1503
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0xc
+	.long	.LLRL109
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI272
+	.value	.LVU849
+	.long	.LLRL112
+	.value	0x24a
+	.byte	0x19
+	.long	0x1538
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cd2
+	.quad	.LBI275
+	.value	.LVU857
+	.long	.LLRL115
+	.value	0x24a
+	.byte	0x40
+	.long	0x1573
+	.uleb128 0x2
+	.long	0x1ce1
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0xc
+	.long	.LLRL115
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1cae
+	.quad	.LBI286
+	.value	.LVU910
+	.quad	.LBB286
+	.quad	.LBE286-.LBB286
+	.value	0x262
+	.byte	0x1d
+	.long	0x15b4
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0x6
+	.long	0x1cae
+	.quad	.LBI288
+	.value	.LVU916
+	.long	.LLRL120
+	.value	0x262
+	.byte	0x47
+	.long	0x15e9
+	.uleb128 0x2
+	.long	0x1cc7
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x2
+	.long	0x1cbd
+	.long	.LLST122
+	.long	.LVUS122
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL96
+	.long	0xc9d
+	.uleb128 0x9
+	.quad	.LVL135
+	.long	0xd0e
+	.long	0x160e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL145
+	.long	0xc9d
+	.uleb128 0x9
+	.quad	.LVL158
+	.long	0xc9d
+	.long	0x1639
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL159
+	.long	0xd0e
+	.long	0x1652
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL160
+	.long	0xd0e
+	.long	0x1669
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL168
+	.long	0xd0e
+	.long	0x1682
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x14
+	.quad	.LVL254
+	.long	0xc9d
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1639
+	.value	0x1fe
+	.long	0x171e
+	.uleb128 0x1f
+	.long	.LASF1626
+	.value	0x1fe
+	.byte	0x1f
+	.long	0xc3
+	.uleb128 0x1f
+	.long	.LASF1627
+	.value	0x1fe
+	.byte	0x32
+	.long	0xc3
+	.uleb128 0x13
+	.long	.LASF1632
+	.value	0x200
+	.byte	0xd
+	.long	0x171e
+	.uleb128 0x13
+	.long	.LASF1633
+	.value	0x201
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF1634
+	.value	0x201
+	.byte	0x1c
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF1635
+	.value	0x202
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF1636
+	.value	0x202
+	.byte	0x19
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF1637
+	.value	0x203
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x21
+	.string	"yaw"
+	.value	0x204
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x13
+	.long	.LASF1638
+	.value	0x205
+	.byte	0xd
+	.long	0xcf
+	.uleb128 0x21
+	.string	"i"
+	.value	0x206
+	.byte	0xe
+	.long	0xf3
+	.byte	0
+	.uleb128 0xa
+	.long	0xcf
+	.long	0x172e
+	.uleb128 0xb
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1640
+	.value	0x1e8
+	.long	0x1752
+	.uleb128 0x1f
+	.long	.LASF1626
+	.value	0x1e8
+	.byte	0x2a
+	.long	0x1752
+	.uleb128 0x1f
+	.long	.LASF1627
+	.value	0x1e8
+	.byte	0x3e
+	.long	0x1752
+	.byte	0
+	.uleb128 0x11
+	.long	0xc3
+	.uleb128 0x28
+	.long	.LASF1641
+	.value	0x1b9
+	.long	0x179d
+	.uleb128 0x13
+	.long	.LASF1642
+	.value	0x1bb
+	.byte	0xd
+	.long	0x707
+	.uleb128 0x21
+	.string	"i"
+	.value	0x1bc
+	.byte	0x9
+	.long	0x94
+	.uleb128 0x3e
+	.uleb128 0x2b
+	.long	.LASF1643
+	.value	0x1c7
+	.byte	0x18
+	.long	0xc3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	slow_LFlaps.0
+	.uleb128 0x13
+	.long	.LASF1644
+	.value	0x1c8
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1646
+	.value	0x1af
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17ee
+	.uleb128 0x3f
+	.string	"mc"
+	.byte	0x1
+	.value	0x1af
+	.byte	0x1d
+	.long	0xc3
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x1b1
+	.byte	0xd
+	.long	0xdb
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x2c
+	.quad	.LVL91
+	.long	0x17ee
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1647
+	.value	0x1a2
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x186a
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x1a4
+	.byte	0xd
+	.long	0xdb
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x14
+	.quad	.LVL81
+	.long	0xccd
+	.uleb128 0x9
+	.quad	.LVL83
+	.long	0xd0e
+	.long	0x1843
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL84
+	.long	0xd0e
+	.long	0x185c
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL85
+	.long	0xcbd
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1648
+	.value	0x16b
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19cc
+	.uleb128 0x6
+	.long	0x19cc
+	.quad	.LBI73
+	.value	.LVU236
+	.long	.LLRL19
+	.value	0x19c
+	.byte	0x11
+	.long	0x18cc
+	.uleb128 0x9
+	.quad	.LVL72
+	.long	0xce2
+	.long	0x18b8
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2d
+	.quad	.LVL73
+	.long	0xce2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL65
+	.long	0xd0e
+	.long	0x18e4
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL66
+	.long	0xce2
+	.long	0x18fb
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL67
+	.long	0xce2
+	.long	0x1912
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL68
+	.long	0xce2
+	.long	0x1929
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL69
+	.long	0xce2
+	.long	0x1940
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL70
+	.long	0xce2
+	.long	0x1957
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL71
+	.long	0xce2
+	.long	0x196e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL74
+	.long	0xce2
+	.long	0x1985
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL75
+	.long	0xce2
+	.long	0x199c
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x22
+	.quad	.LVL76
+	.long	0xce2
+	.long	0x19b3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2d
+	.quad	.LVL77
+	.long	0xce2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF1672
+	.byte	0x1
+	.value	0x165
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x16
+	.long	.LASF1649
+	.value	0x154
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a29
+	.uleb128 0x1a
+	.long	.LASF1650
+	.value	0x154
+	.byte	0x17
+	.long	0x94
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x41
+	.long	.LASF1615
+	.byte	0x1
+	.value	0x154
+	.byte	0x2c
+	.long	0xc78
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x156
+	.byte	0x9
+	.long	0x94
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1651
+	.byte	0x1
+	.value	0x14c
+	.byte	0x6
+	.byte	0x1
+	.long	0x1a42
+	.uleb128 0x21
+	.string	"i"
+	.value	0x14e
+	.byte	0x9
+	.long	0x94
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1652
+	.value	0x11e
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b17
+	.uleb128 0x1a
+	.long	.LASF1653
+	.value	0x11e
+	.byte	0x3f
+	.long	0x1b17
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1d
+	.string	"i"
+	.value	0x120
+	.byte	0x9
+	.long	0x94
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x43
+	.long	0x1a29
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.byte	0x1
+	.value	0x149
+	.byte	0x5
+	.long	0x1ac5
+	.uleb128 0x8
+	.long	0x1a37
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x19
+	.quad	.LVL36
+	.long	0xd0e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL24
+	.long	0x1b1c
+	.long	0x1ae3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -16
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL26
+	.long	0xd0e
+	.long	0x1afc
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL43
+	.long	0x1b1c
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -16
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x155
+	.uleb128 0x44
+	.long	.LASF1673
+	.byte	0x1
+	.value	0x116
+	.byte	0xd
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c35
+	.uleb128 0x1a
+	.long	.LASF1650
+	.value	0x116
+	.byte	0x29
+	.long	0xdb
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1a
+	.long	.LASF1654
+	.value	0x116
+	.byte	0x44
+	.long	0x4fd
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x6
+	.long	0x1c35
+	.quad	.LBI43
+	.value	.LVU4
+	.long	.LLRL2
+	.value	0x118
+	.byte	0x27
+	.long	0x1b98
+	.uleb128 0x2
+	.long	0x1c47
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x14
+	.quad	.LVL2
+	.long	0xcf7
+	.byte	0
+	.uleb128 0x6
+	.long	0x1c35
+	.quad	.LBI48
+	.value	.LVU13
+	.long	.LLRL4
+	.value	0x119
+	.byte	0x23
+	.long	0x1bcd
+	.uleb128 0x2
+	.long	0x1c47
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x14
+	.quad	.LVL4
+	.long	0xcf7
+	.byte	0
+	.uleb128 0x6
+	.long	0x1c35
+	.quad	.LBI54
+	.value	.LVU18
+	.long	.LLRL6
+	.value	0x11a
+	.byte	0x24
+	.long	0x1c02
+	.uleb128 0x2
+	.long	0x1c47
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x14
+	.quad	.LVL6
+	.long	0xcf7
+	.byte	0
+	.uleb128 0x45
+	.long	0x1c35
+	.quad	.LBI60
+	.value	.LVU23
+	.long	.LLRL8
+	.byte	0x1
+	.value	0x11b
+	.byte	0x22
+	.uleb128 0x2
+	.long	0x1c47
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x14
+	.quad	.LVL8
+	.long	0xcf7
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF1674
+	.byte	0x1
+	.value	0x111
+	.byte	0x10
+	.long	0xcf
+	.byte	0x1
+	.long	0x1c54
+	.uleb128 0x1f
+	.long	.LASF1655
+	.value	0x111
+	.byte	0x22
+	.long	0x119
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1656
+	.value	0x104
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cae
+	.uleb128 0x1a
+	.long	.LASF1657
+	.value	0x104
+	.byte	0x1a
+	.long	0x46b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1a
+	.long	.LASF1658
+	.value	0x104
+	.byte	0x3c
+	.long	0xc78
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x19
+	.quad	.LVL19
+	.long	0xd0e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1659
+	.byte	0xf4
+	.byte	0x5
+	.long	0x94
+	.long	0x1cd2
+	.uleb128 0x29
+	.string	"nr"
+	.byte	0xf4
+	.byte	0x18
+	.long	0x94
+	.uleb128 0x29
+	.string	"lr"
+	.byte	0xf4
+	.byte	0x20
+	.long	0x94
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1660
+	.byte	0xe5
+	.byte	0x9
+	.long	0xc3
+	.long	0x1cf8
+	.uleb128 0x29
+	.string	"nr"
+	.byte	0xe5
+	.byte	0x36
+	.long	0x94
+	.uleb128 0x47
+	.long	.LASF1661
+	.byte	0x1
+	.byte	0xe7
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1662
+	.byte	0x1
+	.byte	0xda
+	.byte	0x6
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d6c
+	.uleb128 0x17
+	.long	.LASF1663
+	.byte	0x24
+	.long	0x96b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x17
+	.long	.LASF1664
+	.byte	0x46
+	.long	0x99f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x17
+	.long	.LASF1665
+	.byte	0x70
+	.long	0x9b9
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x17
+	.long	.LASF1666
+	.byte	0x97
+	.long	0x985
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x17
+	.long	.LASF1667
+	.byte	0xbb
+	.long	0x9d3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x17
+	.long	.LASF1668
+	.byte	0xdc
+	.long	0x9ed
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x17
+	.long	.LASF1669
+	.byte	0xfb
+	.long	0xa07
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.byte	0
+	.uleb128 0x2f
+	.long	0x1cd2
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d9c
+	.uleb128 0x2a
+	.long	0x1ce1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.long	0x1ceb
+	.long	.LLST10
+	.long	.LVUS10
+	.byte	0
+	.uleb128 0x2f
+	.long	0x1cae
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dc6
+	.uleb128 0x2a
+	.long	0x1cbd
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2a
+	.long	0x1cc7
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x49
+	.long	0x1a29
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x8
+	.long	0x1a37
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x19
+	.quad	.LVL50
+	.long	0xd0e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 218
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS23:
+	.uleb128 .LVU307
+	.uleb128 .LVU323
+	.uleb128 .LVU325
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+	.uleb128 .LVU590
+	.uleb128 .LVU593
+	.uleb128 .LVU600
+	.uleb128 0
+.LLST23:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL97-.LVL94
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL98-.LVL94
+	.uleb128 .LVL148-.LVL94
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL148-.LVL94
+	.uleb128 .LVL153-.LVL94
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.byte	0x4
+	.uleb128 .LVL165-.LVL94
+	.uleb128 .LVL167-.LVL94
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL169-.LVL94
+	.uleb128 .LFE27-.LVL94
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU310
+	.uleb128 .LVU323
+	.uleb128 .LVU327
+	.uleb128 .LVU585
+	.uleb128 .LVU586
+	.uleb128 .LVU588
+	.uleb128 .LVU592
+	.uleb128 .LVU593
+	.uleb128 .LVU600
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL95
+	.byte	0x4
+	.uleb128 .LVL95-.LVL95
+	.uleb128 .LVL97-.LVL95
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL99-.LVL95
+	.uleb128 .LVL162-.LVL95
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL163-.LVL95
+	.uleb128 .LVL164-.LVL95
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL166-.LVL95
+	.uleb128 .LVL167-.LVL95
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL169-.LVL95
+	.uleb128 .LFE27-.LVL95
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU519
+	.uleb128 .LVU520
+	.uleb128 .LVU521
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 .LVU527
+	.uleb128 .LVU527
+	.uleb128 .LVU531
+	.uleb128 .LVU553
+	.uleb128 .LVU559
+	.uleb128 .LVU559
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU566
+	.uleb128 .LVU584
+	.uleb128 .LVU586
+	.uleb128 .LVU588
+	.uleb128 .LVU606
+	.uleb128 .LVU607
+	.uleb128 .LVU726
+	.uleb128 .LVU747
+	.uleb128 .LVU747
+	.uleb128 .LVU769
+	.uleb128 .LVU769
+	.uleb128 .LVU770
+	.uleb128 .LVU775
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU782
+	.uleb128 .LVU783
+	.uleb128 .LVU808
+	.uleb128 .LVU808
+	.uleb128 .LVU809
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+.LLST25:
+	.byte	0x6
+	.quad	.LVL141
+	.byte	0x4
+	.uleb128 .LVL141-.LVL141
+	.uleb128 .LVL141-.LVL141
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.LVL141
+	.uleb128 .LVL143-.LVL141
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL141
+	.uleb128 .LVL144-.LVL141
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL141
+	.uleb128 .LVL146-.LVL141
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL153-.LVL141
+	.uleb128 .LVL154-.LVL141
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.LVL141
+	.uleb128 .LVL155-.LVL141
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL155-.LVL141
+	.uleb128 .LVL156-.LVL141
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL141
+	.uleb128 .LVL161-.LVL141
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL163-.LVL141
+	.uleb128 .LVL164-.LVL141
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL170-.LVL141
+	.uleb128 .LVL171-.LVL141
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.LVL141
+	.uleb128 .LVL200-.LVL141
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL200-.LVL141
+	.uleb128 .LVL206-.LVL141
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL206-.LVL141
+	.uleb128 .LVL207-.LVL141
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.LVL141
+	.uleb128 .LVL210-.LVL141
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL210-.LVL141
+	.uleb128 .LVL211-.LVL141
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL141
+	.uleb128 .LVL219-.LVL141
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL219-.LVL141
+	.uleb128 .LVL220-.LVL141
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.LVL141
+	.uleb128 .LVL257-.LVL141
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.LVL141
+	.uleb128 .LVL264-.LVL141
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU540
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU553
+.LLST66:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL148-.LVL147
+	.uleb128 .LVL153-.LVL147
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU541
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU548
+	.uleb128 .LVU548
+	.uleb128 .LVU550
+	.uleb128 .LVU550
+	.uleb128 .LVU553
+.LLST67:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.LVL147
+	.uleb128 .LVL149-.LVL147
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL149-.LVL147
+	.uleb128 .LVL151-.LVL147
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL151-.LVL147
+	.uleb128 .LVL153-.LVL147
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU543
+	.uleb128 .LVU544
+	.uleb128 .LVU544
+	.uleb128 .LVU551
+	.uleb128 .LVU551
+	.uleb128 .LVU552
+.LLST68:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL148-.LVL147
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.LVL147
+	.uleb128 .LVL151-.LVL147
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.LVL147
+	.uleb128 .LVL152-.LVL147
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x5
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU294
+	.uleb128 .LVU310
+	.uleb128 .LVU323
+	.uleb128 .LVU327
+	.uleb128 .LVU588
+	.uleb128 .LVU593
+.LLST27:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL95-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3535
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL97-.LVL92
+	.uleb128 .LVL99-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3535
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL164-.LVL92
+	.uleb128 .LVL167-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3535
+	.sleb128 0
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU294
+	.uleb128 .LVU310
+	.uleb128 .LVU323
+	.uleb128 .LVU327
+	.uleb128 .LVU588
+	.uleb128 .LVU593
+.LLST28:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL95-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3515
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL97-.LVL92
+	.uleb128 .LVL99-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3515
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL164-.LVL92
+	.uleb128 .LVL167-.LVL92
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3515
+	.sleb128 0
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU337
+	.uleb128 .LVU419
+	.uleb128 .LVU865
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU896
+.LLST30:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL123-.LVL100
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL231-.LVL100
+	.uleb128 .LVL236-.LVL100
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL238-.LVL100
+	.uleb128 .LVL240-.LVL100
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU337
+	.uleb128 .LVU419
+	.uleb128 .LVU865
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU896
+.LLST31:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL123-.LVL100
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL231-.LVL100
+	.uleb128 .LVL236-.LVL100
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL238-.LVL100
+	.uleb128 .LVL240-.LVL100
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU340
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU362
+	.uleb128 .LVU363
+	.uleb128 .LVU379
+	.uleb128 .LVU381
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU387
+.LLST32:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL103-.LVL100
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL100
+	.uleb128 .LVL105-.LVL100
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL105-.LVL100
+	.uleb128 .LVL109-.LVL100
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL110-.LVL100
+	.uleb128 .LVL111-.LVL100
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL111-.LVL100
+	.uleb128 .LVL113-.LVL100
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU340
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU383
+.LLST33:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL103-.LVL100
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL100
+	.uleb128 .LVL112-.LVL100
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU341
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU402
+	.uleb128 .LVU406
+	.uleb128 .LVU418
+	.uleb128 .LVU865
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU896
+.LLST34:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL115-.LVL100
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL100
+	.uleb128 .LVL117-.LVL100
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL119-.LVL100
+	.uleb128 .LVL122-.LVL100
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL231-.LVL100
+	.uleb128 .LVL236-.LVL100
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL238-.LVL100
+	.uleb128 .LVL240-.LVL100
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU341
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU403
+	.uleb128 .LVU404
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU419
+	.uleb128 .LVU865
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU896
+.LLST35:
+	.byte	0x6
+	.quad	.LVL100
+	.byte	0x4
+	.uleb128 .LVL100-.LVL100
+	.uleb128 .LVL115-.LVL100
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL100
+	.uleb128 .LVL118-.LVL100
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL118-.LVL100
+	.uleb128 .LVL119-.LVL100
+	.uleb128 0x1d
+	.byte	0x75
+	.sleb128 0
+	.byte	0x94
+	.byte	0x4
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1e
+	.byte	0x23
+	.uleb128 0x800
+	.byte	0x3c
+	.byte	0x26
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0x22
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.LVL100
+	.uleb128 .LVL123-.LVL100
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL231-.LVL100
+	.uleb128 .LVL236-.LVL100
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL238-.LVL100
+	.uleb128 .LVL240-.LVL100
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU348
+	.uleb128 .LVU419
+	.uleb128 .LVU865
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU896
+.LLST36:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL123-.LVL101
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL231-.LVL101
+	.uleb128 .LVL236-.LVL101
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL238-.LVL101
+	.uleb128 .LVL240-.LVL101
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU354
+	.uleb128 .LVU388
+.LLST37:
+	.byte	0x8
+	.quad	.LVL102
+	.uleb128 .LVL114-.LVL102
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU355
+	.uleb128 .LVU419
+	.uleb128 .LVU865
+	.uleb128 .LVU871
+	.uleb128 .LVU871
+	.uleb128 .LVU880
+	.uleb128 .LVU886
+	.uleb128 .LVU893
+	.uleb128 .LVU893
+	.uleb128 .LVU896
+.LLST38:
+	.byte	0x6
+	.quad	.LVL102
+	.byte	0x4
+	.uleb128 .LVL102-.LVL102
+	.uleb128 .LVL123-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL231-.LVL102
+	.uleb128 .LVL232-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.LVL102
+	.uleb128 .LVL236-.LVL102
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL238-.LVL102
+	.uleb128 .LVL239-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.LVL102
+	.uleb128 .LVL240-.LVL102
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU358
+	.uleb128 .LVU360
+	.uleb128 .LVU360
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU364
+	.uleb128 .LVU365
+	.uleb128 .LVU378
+	.uleb128 .LVU399
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU403
+	.uleb128 .LVU406
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU419
+	.uleb128 .LVU873
+	.uleb128 .LVU875
+	.uleb128 .LVU875
+	.uleb128 .LVU878
+	.uleb128 .LVU878
+	.uleb128 .LVU879
+	.uleb128 .LVU895
+	.uleb128 .LVU896
+.LLST39:
+	.byte	0x6
+	.quad	.LVL102
+	.byte	0x4
+	.uleb128 .LVL102-.LVL102
+	.uleb128 .LVL103-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL102
+	.uleb128 .LVL105-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL105-.LVL102
+	.uleb128 .LVL106-.LVL102
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.LVL102
+	.uleb128 .LVL108-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.LVL102
+	.uleb128 .LVL115-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL102
+	.uleb128 .LVL118-.LVL102
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL119-.LVL102
+	.uleb128 .LVL120-.LVL102
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.LVL102
+	.uleb128 .LVL123-.LVL102
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL232-.LVL102
+	.uleb128 .LVL233-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.LVL102
+	.uleb128 .LVL234-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL234-.LVL102
+	.uleb128 .LVL235-.LVL102
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.LVL102
+	.uleb128 .LVL240-.LVL102
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU421
+	.uleb128 .LVU427
+.LLST41:
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL124-.LVL123
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU421
+	.uleb128 .LVU427
+.LLST42:
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL124-.LVL123
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU429
+	.uleb128 .LVU434
+.LLST44:
+	.byte	0x8
+	.quad	.LVL125
+	.uleb128 .LVL126-.LVL125
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU429
+	.uleb128 .LVU434
+.LLST45:
+	.byte	0x8
+	.quad	.LVL125
+	.uleb128 .LVL126-.LVL125
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU436
+	.uleb128 .LVU445
+	.uleb128 .LVU970
+	.uleb128 .LVU974
+.LLST47:
+	.byte	0x6
+	.quad	.LVL127
+	.byte	0x4
+	.uleb128 .LVL127-.LVL127
+	.uleb128 .LVL129-.LVL127
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL261-.LVL127
+	.uleb128 .LVL263-.LVL127
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+	.uleb128 .LVU970
+	.uleb128 .LVU973
+	.uleb128 .LVU973
+	.uleb128 .LVU974
+.LLST48:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL129-.LVL128
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL261-.LVL128
+	.uleb128 .LVL262-.LVL128
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL262-.LVL128
+	.uleb128 .LVL263-.LVL128
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 39
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU450
+	.uleb128 .LVU452
+.LLST50:
+	.byte	0x8
+	.quad	.LVL130
+	.uleb128 .LVL131-.LVL130
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU450
+	.uleb128 .LVU452
+.LLST51:
+	.byte	0x8
+	.quad	.LVL130
+	.uleb128 .LVL131-.LVL130
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU452
+	.uleb128 .LVU455
+.LLST52:
+	.byte	0x8
+	.quad	.LVL131
+	.uleb128 .LVL132-.LVL131
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU452
+	.uleb128 .LVU455
+.LLST53:
+	.byte	0x8
+	.quad	.LVL131
+	.uleb128 .LVL132-.LVL131
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU458
+	.uleb128 .LVU466
+	.uleb128 .LVU988
+	.uleb128 .LVU992
+.LLST55:
+	.byte	0x6
+	.quad	.LVL133
+	.byte	0x4
+	.uleb128 .LVL133-.LVL133
+	.uleb128 .LVL134-.LVL133
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.LVL133
+	.uleb128 .LVL271-.LVL133
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU460
+	.uleb128 .LVU466
+	.uleb128 .LVU988
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 .LVU992
+.LLST56:
+	.byte	0x6
+	.quad	.LVL133
+	.byte	0x4
+	.uleb128 .LVL133-.LVL133
+	.uleb128 .LVL134-.LVL133
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL269-.LVL133
+	.uleb128 .LVL270-.LVL133
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL270-.LVL133
+	.uleb128 .LVL271-.LVL133
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 47
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU475
+	.uleb128 .LVU484
+	.uleb128 .LVU883
+	.uleb128 .LVU886
+.LLST58:
+	.byte	0x6
+	.quad	.LVL136
+	.byte	0x4
+	.uleb128 .LVL136-.LVL136
+	.uleb128 .LVL138-.LVL136
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.LVL136
+	.uleb128 .LVL238-.LVL136
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU478
+	.uleb128 .LVU484
+	.uleb128 .LVU883
+	.uleb128 .LVU886
+.LLST59:
+	.byte	0x6
+	.quad	.LVL137
+	.byte	0x4
+	.uleb128 .LVL137-.LVL137
+	.uleb128 .LVL138-.LVL137
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL237-.LVL137
+	.uleb128 .LVL238-.LVL137
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU488
+	.uleb128 .LVU496
+	.uleb128 .LVU880
+	.uleb128 .LVU883
+.LLST61:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-.LVL139
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.LVL139
+	.uleb128 .LVL237-.LVL139
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU490
+	.uleb128 .LVU496
+	.uleb128 .LVU880
+	.uleb128 .LVU883
+.LLST62:
+	.byte	0x6
+	.quad	.LVL139
+	.byte	0x4
+	.uleb128 .LVL139-.LVL139
+	.uleb128 .LVL140-.LVL139
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL236-.LVL139
+	.uleb128 .LVL237-.LVL139
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU784
+	.uleb128 .LVU788
+.LLST64:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU784
+	.uleb128 .LVU788
+.LLST65:
+	.byte	0x8
+	.quad	.LVL212
+	.uleb128 .LVL213-.LVL212
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU694
+	.uleb128 .LVU698
+	.uleb128 .LVU698
+	.uleb128 .LVU704
+	.uleb128 .LVU704
+	.uleb128 .LVU706
+	.uleb128 .LVU707
+	.uleb128 .LVU722
+	.uleb128 .LVU907
+	.uleb128 .LVU908
+.LLST70:
+	.byte	0x6
+	.quad	.LVL184
+	.byte	0x4
+	.uleb128 .LVL184-.LVL184
+	.uleb128 .LVL185-.LVL184
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL185-.LVL184
+	.uleb128 .LVL187-.LVL184
+	.uleb128 0x14
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.LVL184
+	.uleb128 .LVL188-.LVL184
+	.uleb128 0x15
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.LVL184
+	.uleb128 .LVL193-.LVL184
+	.uleb128 0x14
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL241-.LVL184
+	.uleb128 .LVL242-.LVL184
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU932
+	.uleb128 .LVU935
+	.uleb128 .LVU935
+	.uleb128 .LVU938
+	.uleb128 .LVU938
+	.uleb128 .LVU943
+	.uleb128 .LVU992
+	.uleb128 .LVU997
+.LLST72:
+	.byte	0x6
+	.quad	.LVL247
+	.byte	0x4
+	.uleb128 .LVL247-.LVL247
+	.uleb128 .LVL248-1-.LVL247
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL248-.LVL247
+	.uleb128 .LVL249-.LVL247
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-.LVL247
+	.uleb128 .LVL250-.LVL247
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL271-.LVL247
+	.uleb128 .LVL272-.LVL247
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU923
+	.uleb128 .LVU932
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST74:
+	.byte	0x6
+	.quad	.LVL245
+	.byte	0x4
+	.uleb128 .LVL245-.LVL245
+	.uleb128 .LVL247-.LVL245
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL273-.LVL245
+	.uleb128 .LFE27-.LVL245
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU926
+	.uleb128 .LVU932
+	.uleb128 .LVU999
+	.uleb128 0
+.LLST75:
+	.byte	0x6
+	.quad	.LVL246
+	.byte	0x4
+	.uleb128 .LVL246-.LVL246
+	.uleb128 .LVL247-.LVL246
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL273-.LVL246
+	.uleb128 .LFE27-.LVL246
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU698
+	.uleb128 .LVU701
+	.uleb128 .LVU713
+	.uleb128 .LVU722
+.LLST77:
+	.byte	0x6
+	.quad	.LVL185
+	.byte	0x4
+	.uleb128 .LVL185-.LVL185
+	.uleb128 .LVL186-.LVL185
+	.uleb128 0x14
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL190-.LVL185
+	.uleb128 .LVL193-.LVL185
+	.uleb128 0x14
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU698
+	.uleb128 .LVU701
+	.uleb128 .LVU716
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU722
+.LLST78:
+	.byte	0x6
+	.quad	.LVL185
+	.byte	0x4
+	.uleb128 .LVL185-.LVL185
+	.uleb128 .LVL186-.LVL185
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL191-.LVL185
+	.uleb128 .LVL192-.LVL185
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL192-.LVL185
+	.uleb128 .LVL193-.LVL185
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 3
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU621
+	.uleb128 .LVU623
+.LLST80:
+	.byte	0x8
+	.quad	.LVL172
+	.uleb128 .LVL172-.LVL172
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU621
+	.uleb128 .LVU623
+.LLST81:
+	.byte	0x8
+	.quad	.LVL172
+	.uleb128 .LVL172-.LVL172
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU627
+	.uleb128 .LVU630
+.LLST83:
+	.byte	0x8
+	.quad	.LVL173
+	.uleb128 .LVL174-.LVL173
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU627
+	.uleb128 .LVU630
+.LLST84:
+	.byte	0x8
+	.quad	.LVL173
+	.uleb128 .LVL174-.LVL173
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+.LLST85:
+	.byte	0x8
+	.quad	.LVL175
+	.uleb128 .LVL176-.LVL175
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU633
+	.uleb128 .LVU636
+.LLST86:
+	.byte	0x8
+	.quad	.LVL175
+	.uleb128 .LVL176-.LVL175
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU636
+	.uleb128 .LVU640
+.LLST87:
+	.byte	0x8
+	.quad	.LVL176
+	.uleb128 .LVL177-.LVL176
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU636
+	.uleb128 .LVU640
+.LLST88:
+	.byte	0x8
+	.quad	.LVL176
+	.uleb128 .LVL177-.LVL176
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU643
+	.uleb128 .LVU651
+	.uleb128 .LVU966
+	.uleb128 .LVU970
+.LLST90:
+	.byte	0x6
+	.quad	.LVL178
+	.byte	0x4
+	.uleb128 .LVL178-.LVL178
+	.uleb128 .LVL179-.LVL178
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL259-.LVL178
+	.uleb128 .LVL261-.LVL178
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU645
+	.uleb128 .LVU651
+	.uleb128 .LVU966
+	.uleb128 .LVU969
+	.uleb128 .LVU969
+	.uleb128 .LVU970
+.LLST91:
+	.byte	0x6
+	.quad	.LVL178
+	.byte	0x4
+	.uleb128 .LVL178-.LVL178
+	.uleb128 .LVL179-.LVL178
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL259-.LVL178
+	.uleb128 .LVL260-.LVL178
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL260-.LVL178
+	.uleb128 .LVL261-.LVL178
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 31
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU654
+	.uleb128 .LVU663
+	.uleb128 .LVU962
+	.uleb128 .LVU966
+.LLST93:
+	.byte	0x6
+	.quad	.LVL180
+	.byte	0x4
+	.uleb128 .LVL180-.LVL180
+	.uleb128 .LVL182-.LVL180
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL257-.LVL180
+	.uleb128 .LVL259-.LVL180
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU657
+	.uleb128 .LVU663
+	.uleb128 .LVU962
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU966
+.LLST94:
+	.byte	0x6
+	.quad	.LVL181
+	.byte	0x4
+	.uleb128 .LVL181-.LVL181
+	.uleb128 .LVL182-.LVL181
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL257-.LVL181
+	.uleb128 .LVL258-.LVL181
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL258-.LVL181
+	.uleb128 .LVL259-.LVL181
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 39
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU729
+	.uleb128 .LVU733
+	.uleb128 .LVU751
+	.uleb128 .LVU755
+.LLST96:
+	.byte	0x6
+	.quad	.LVL195
+	.byte	0x4
+	.uleb128 .LVL195-.LVL195
+	.uleb128 .LVL196-.LVL195
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL195
+	.uleb128 .LVL202-.LVL195
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU729
+	.uleb128 .LVU733
+	.uleb128 .LVU751
+	.uleb128 .LVU755
+.LLST97:
+	.byte	0x6
+	.quad	.LVL195
+	.byte	0x4
+	.uleb128 .LVL195-.LVL195
+	.uleb128 .LVL196-.LVL195
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL201-.LVL195
+	.uleb128 .LVL202-.LVL195
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU735
+	.uleb128 .LVU744
+	.uleb128 .LVU757
+	.uleb128 .LVU766
+	.uleb128 .LVU959
+	.uleb128 .LVU962
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+.LLST99:
+	.byte	0x6
+	.quad	.LVL197
+	.byte	0x4
+	.uleb128 .LVL197-.LVL197
+	.uleb128 .LVL199-.LVL197
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.LVL197
+	.uleb128 .LVL205-.LVL197
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.LVL197
+	.uleb128 .LVL257-.LVL197
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL263-.LVL197
+	.uleb128 .LVL264-.LVL197
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU738
+	.uleb128 .LVU744
+	.uleb128 .LVU760
+	.uleb128 .LVU766
+	.uleb128 .LVU959
+	.uleb128 .LVU961
+	.uleb128 .LVU961
+	.uleb128 .LVU962
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+.LLST100:
+	.byte	0x6
+	.quad	.LVL198
+	.byte	0x4
+	.uleb128 .LVL198-.LVL198
+	.uleb128 .LVL199-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL204-.LVL198
+	.uleb128 .LVL205-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL255-.LVL198
+	.uleb128 .LVL256-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL256-.LVL198
+	.uleb128 .LVL257-.LVL198
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 39
+	.byte	0x4
+	.uleb128 .LVL263-.LVL198
+	.uleb128 .LVL264-.LVL198
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU775
+	.uleb128 .LVU778
+	.uleb128 .LVU797
+	.uleb128 .LVU805
+.LLST102:
+	.byte	0x6
+	.quad	.LVL208
+	.byte	0x4
+	.uleb128 .LVL208-.LVL208
+	.uleb128 .LVL209-.LVL208
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL216-.LVL208
+	.uleb128 .LVL218-.LVL208
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU775
+	.uleb128 .LVU778
+	.uleb128 .LVU800
+	.uleb128 .LVU805
+.LLST103:
+	.byte	0x6
+	.quad	.LVL208
+	.byte	0x4
+	.uleb128 .LVL208-.LVL208
+	.uleb128 .LVL209-.LVL208
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL217-.LVL208
+	.uleb128 .LVL218-.LVL208
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU791
+	.uleb128 .LVU793
+.LLST104:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU791
+	.uleb128 .LVU793
+.LLST105:
+	.byte	0x8
+	.quad	.LVL214
+	.uleb128 .LVL215-.LVL214
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU819
+	.uleb128 .LVU828
+	.uleb128 .LVU984
+	.uleb128 .LVU988
+.LLST107:
+	.byte	0x6
+	.quad	.LVL222
+	.byte	0x4
+	.uleb128 .LVL222-.LVL222
+	.uleb128 .LVL224-.LVL222
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.LVL222
+	.uleb128 .LVL269-.LVL222
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU822
+	.uleb128 .LVU828
+	.uleb128 .LVU984
+	.uleb128 .LVU987
+	.uleb128 .LVU987
+	.uleb128 .LVU988
+.LLST108:
+	.byte	0x6
+	.quad	.LVL223
+	.byte	0x4
+	.uleb128 .LVL223-.LVL223
+	.uleb128 .LVL224-.LVL223
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL267-.LVL223
+	.uleb128 .LVL268-.LVL223
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL268-.LVL223
+	.uleb128 .LVL269-.LVL223
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 7
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU836
+	.uleb128 .LVU845
+	.uleb128 .LVU980
+	.uleb128 .LVU984
+.LLST110:
+	.byte	0x6
+	.quad	.LVL225
+	.byte	0x4
+	.uleb128 .LVL225-.LVL225
+	.uleb128 .LVL227-.LVL225
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL265-.LVL225
+	.uleb128 .LVL267-.LVL225
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU839
+	.uleb128 .LVU845
+	.uleb128 .LVU980
+	.uleb128 .LVU983
+	.uleb128 .LVU983
+	.uleb128 .LVU984
+.LLST111:
+	.byte	0x6
+	.quad	.LVL226
+	.byte	0x4
+	.uleb128 .LVL226-.LVL226
+	.uleb128 .LVL227-.LVL226
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL265-.LVL226
+	.uleb128 .LVL266-.LVL226
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL266-.LVL226
+	.uleb128 .LVL267-.LVL226
+	.uleb128 0xc
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0xf
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU849
+	.uleb128 .LVU855
+.LLST113:
+	.byte	0x8
+	.quad	.LVL228
+	.uleb128 .LVL229-.LVL228
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU849
+	.uleb128 .LVU855
+.LLST114:
+	.byte	0x8
+	.quad	.LVL228
+	.uleb128 .LVL229-.LVL228
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU857
+	.uleb128 .LVU865
+	.uleb128 .LVU977
+	.uleb128 .LVU980
+.LLST116:
+	.byte	0x6
+	.quad	.LVL230
+	.byte	0x4
+	.uleb128 .LVL230-.LVL230
+	.uleb128 .LVL231-.LVL230
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL264-.LVL230
+	.uleb128 .LVL265-.LVL230
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU859
+	.uleb128 .LVU865
+	.uleb128 .LVU977
+	.uleb128 .LVU980
+.LLST117:
+	.byte	0x6
+	.quad	.LVL230
+	.byte	0x4
+	.uleb128 .LVL230-.LVL230
+	.uleb128 .LVL231-.LVL230
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL264-.LVL230
+	.uleb128 .LVL265-.LVL230
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU910
+	.uleb128 .LVU912
+.LLST118:
+	.byte	0x8
+	.quad	.LVL242
+	.uleb128 .LVL242-.LVL242
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU910
+	.uleb128 .LVU912
+.LLST119:
+	.byte	0x8
+	.quad	.LVL242
+	.uleb128 .LVL242-.LVL242
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+.LLST121:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU916
+	.uleb128 .LVU919
+.LLST122:
+	.byte	0x8
+	.quad	.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL91-1-.LVL86
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL91-1-.LVL86
+	.uleb128 .LFE23-.LVL86
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU279
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU285
+.LLST22:
+	.byte	0x6
+	.quad	.LVL86
+	.byte	0x4
+	.uleb128 .LVL86-.LVL86
+	.uleb128 .LVL87-.LVL86
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.LVL86
+	.uleb128 .LVL88-.LVL86
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	motor
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.LVL86
+	.uleb128 .LVL89-.LVL86
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	motor
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.LVL86
+	.uleb128 .LVL90-.LVL86
+	.uleb128 0x11
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	motor+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU257
+	.uleb128 .LVU261
+	.uleb128 .LVU261
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+.LLST20:
+	.byte	0x6
+	.quad	.LVL78
+	.byte	0x4
+	.uleb128 .LVL78-.LVL78
+	.uleb128 .LVL79-.LVL78
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL78
+	.uleb128 .LVL80-.LVL78
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL80-.LVL78
+	.uleb128 .LVL81-1-.LVL78
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL81-.LVL78
+	.uleb128 .LVL82-.LVL78
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL53
+	.byte	0x4
+	.uleb128 .LVL53-.LVL53
+	.uleb128 .LVL54-.LVL53
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.LVL53
+	.uleb128 .LVL59-.LVL53
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL59-.LVL53
+	.uleb128 .LFE19-.LVL53
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU194
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU212
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+.LLST18:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL55-.LVL54
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.LVL54
+	.uleb128 .LVL56-.LVL54
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.LVL54
+	.uleb128 .LVL58-.LVL54
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.LVL54
+	.uleb128 .LVL61-.LVL54
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.LVL54
+	.uleb128 .LVL62-.LVL54
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL54
+	.uleb128 .LVL63-.LVL54
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL54
+	.uleb128 .LVL64-.LVL54
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x34
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL20
+	.byte	0x4
+	.uleb128 .LVL20-.LVL20
+	.uleb128 .LVL22-.LVL20
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.LVL20
+	.uleb128 .LVL39-.LVL20
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL20
+	.uleb128 .LVL41-.LVL20
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-.LVL20
+	.uleb128 .LFE17-.LVL20
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU103
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 .LVU111
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU132
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+	.uleb128 .LVU161
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 .LVU169
+.LLST14:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.LVL21
+	.uleb128 .LVL23-.LVL21
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.LVL21
+	.uleb128 .LVL24-1-.LVL21
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-1-.LVL21
+	.uleb128 .LVL24-.LVL21
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL21
+	.uleb128 .LVL25-.LVL21
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.LVL21
+	.uleb128 .LVL28-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL21
+	.uleb128 .LVL29-.LVL21
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	motorMixWeights+4
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL21
+	.uleb128 .LVL30-.LVL21
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	motorMixWeights+20
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL21
+	.uleb128 .LVL41-.LVL21
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL21
+	.uleb128 .LVL42-.LVL21
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xc0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL21
+	.uleb128 .LVL43-1-.LVL21
+	.uleb128 0xb
+	.byte	0x74
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xc0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-1-.LVL21
+	.uleb128 .LVL44-.LVL21
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xb0
+	.byte	0x34
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU139
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU152
+.LLST15:
+	.byte	0x6
+	.quad	.LVL31
+	.byte	0x4
+	.uleb128 .LVL31-.LVL31
+	.uleb128 .LVL32-.LVL31
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.LVL31
+	.uleb128 .LVL33-.LVL31
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL31
+	.uleb128 .LVL34-.LVL31
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL31
+	.uleb128 .LVL37-.LVL31
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL31
+	.uleb128 .LVL38-.LVL31
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL2-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.LVL0
+	.uleb128 .LFE16-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU28
+	.uleb128 .LVU28
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL2-1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.LVL0
+	.uleb128 .LVL9-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL9-.LVL0
+	.uleb128 .LFE16-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU4
+	.uleb128 .LVU9
+.LLST3:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL2-1-.LVL1
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU13
+	.uleb128 .LVU16
+.LLST5:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL4-1-.LVL3
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 4
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU18
+	.uleb128 .LVU21
+.LLST7:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-1-.LVL5
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 8
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU23
+	.uleb128 .LVU26
+.LLST9:
+	.byte	0x8
+	.quad	.LVL7
+	.uleb128 .LVL8-1-.LVL7
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 12
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL18-.LVL17
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL18-.LVL17
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentMixerConfiguration
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 .LFE14-.LVL17
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 .LFE14-.LVL17
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU50
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.LVL12
+	.uleb128 .LVL14-.LVL12
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 7
+	.byte	0x4
+	.uleb128 .LVL14-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.LVL12
+	.uleb128 .LFE12-.LVL12
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	servoConf
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x7
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU173
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+	.uleb128 .LVU180
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+.LLST16:
+	.byte	0x6
+	.quad	.LVL45
+	.byte	0x4
+	.uleb128 .LVL45-.LVL45
+	.uleb128 .LVL46-.LVL45
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.LVL45
+	.uleb128 .LVL47-.LVL45
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL45
+	.uleb128 .LVL48-.LVL45
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.LVL45
+	.uleb128 .LVL51-.LVL45
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.LVL45
+	.uleb128 .LVL52-.LVL45
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	motor_disarmed+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x11c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x5
+	.quad	.LBB43
+	.byte	0x4
+	.uleb128 .LBB43-.LBB43
+	.uleb128 .LBE43-.LBB43
+	.byte	0x4
+	.uleb128 .LBB47-.LBB43
+	.uleb128 .LBE47-.LBB43
+	.byte	0x4
+	.uleb128 .LBB52-.LBB43
+	.uleb128 .LBE52-.LBB43
+	.byte	0
+.LLRL4:
+	.byte	0x5
+	.quad	.LBB48
+	.byte	0x4
+	.uleb128 .LBB48-.LBB48
+	.uleb128 .LBE48-.LBB48
+	.byte	0x4
+	.uleb128 .LBB53-.LBB48
+	.uleb128 .LBE53-.LBB48
+	.byte	0x4
+	.uleb128 .LBB58-.LBB48
+	.uleb128 .LBE58-.LBB48
+	.byte	0
+.LLRL6:
+	.byte	0x5
+	.quad	.LBB54
+	.byte	0x4
+	.uleb128 .LBB54-.LBB54
+	.uleb128 .LBE54-.LBB54
+	.byte	0x4
+	.uleb128 .LBB59-.LBB54
+	.uleb128 .LBE59-.LBB54
+	.byte	0x4
+	.uleb128 .LBB63-.LBB54
+	.uleb128 .LBE63-.LBB54
+	.byte	0
+.LLRL8:
+	.byte	0x5
+	.quad	.LBB60
+	.byte	0x4
+	.uleb128 .LBB60-.LBB60
+	.uleb128 .LBE60-.LBB60
+	.byte	0x4
+	.uleb128 .LBB64-.LBB60
+	.uleb128 .LBE64-.LBB60
+	.byte	0
+.LLRL19:
+	.byte	0x5
+	.quad	.LBB73
+	.byte	0x4
+	.uleb128 .LBB73-.LBB73
+	.uleb128 .LBE73-.LBB73
+	.byte	0x4
+	.uleb128 .LBB76-.LBB73
+	.uleb128 .LBE76-.LBB73
+	.byte	0
+.LLRL26:
+	.byte	0x5
+	.quad	.LBB143
+	.byte	0x4
+	.uleb128 .LBB143-.LBB143
+	.uleb128 .LBE143-.LBB143
+	.byte	0x4
+	.uleb128 .LBB148-.LBB143
+	.uleb128 .LBE148-.LBB143
+	.byte	0x4
+	.uleb128 .LBB149-.LBB143
+	.uleb128 .LBE149-.LBB143
+	.byte	0x4
+	.uleb128 .LBB197-.LBB143
+	.uleb128 .LBE197-.LBB143
+	.byte	0
+.LLRL29:
+	.byte	0x5
+	.quad	.LBB150
+	.byte	0x4
+	.uleb128 .LBB150-.LBB150
+	.uleb128 .LBE150-.LBB150
+	.byte	0x4
+	.uleb128 .LBB155-.LBB150
+	.uleb128 .LBE155-.LBB150
+	.byte	0x4
+	.uleb128 .LBB281-.LBB150
+	.uleb128 .LBE281-.LBB150
+	.byte	0x4
+	.uleb128 .LBB284-.LBB150
+	.uleb128 .LBE284-.LBB150
+	.byte	0
+.LLRL40:
+	.byte	0x5
+	.quad	.LBB156
+	.byte	0x4
+	.uleb128 .LBB156-.LBB156
+	.uleb128 .LBE156-.LBB156
+	.byte	0x4
+	.uleb128 .LBB160-.LBB156
+	.uleb128 .LBE160-.LBB156
+	.byte	0x4
+	.uleb128 .LBB165-.LBB156
+	.uleb128 .LBE165-.LBB156
+	.byte	0
+.LLRL43:
+	.byte	0x5
+	.quad	.LBB161
+	.byte	0x4
+	.uleb128 .LBB161-.LBB161
+	.uleb128 .LBE161-.LBB161
+	.byte	0x4
+	.uleb128 .LBB166-.LBB161
+	.uleb128 .LBE166-.LBB161
+	.byte	0x4
+	.uleb128 .LBB167-.LBB161
+	.uleb128 .LBE167-.LBB161
+	.byte	0
+.LLRL46:
+	.byte	0x5
+	.quad	.LBB168
+	.byte	0x4
+	.uleb128 .LBB168-.LBB168
+	.uleb128 .LBE168-.LBB168
+	.byte	0x4
+	.uleb128 .LBB296-.LBB168
+	.uleb128 .LBE296-.LBB168
+	.byte	0
+.LLRL49:
+	.byte	0x5
+	.quad	.LBB171
+	.byte	0x4
+	.uleb128 .LBB171-.LBB171
+	.uleb128 .LBE171-.LBB171
+	.byte	0x4
+	.uleb128 .LBB174-.LBB171
+	.uleb128 .LBE174-.LBB171
+	.byte	0
+.LLRL54:
+	.byte	0x5
+	.quad	.LBB177
+	.byte	0x4
+	.uleb128 .LBB177-.LBB177
+	.uleb128 .LBE177-.LBB177
+	.byte	0x4
+	.uleb128 .LBB181-.LBB177
+	.uleb128 .LBE181-.LBB177
+	.byte	0x4
+	.uleb128 .LBB301-.LBB177
+	.uleb128 .LBE301-.LBB177
+	.byte	0
+.LLRL57:
+	.byte	0x5
+	.quad	.LBB182
+	.byte	0x4
+	.uleb128 .LBB182-.LBB182
+	.uleb128 .LBE182-.LBB182
+	.byte	0x4
+	.uleb128 .LBB186-.LBB182
+	.uleb128 .LBE186-.LBB182
+	.byte	0x4
+	.uleb128 .LBB283-.LBB182
+	.uleb128 .LBE283-.LBB182
+	.byte	0
+.LLRL60:
+	.byte	0x5
+	.quad	.LBB187
+	.byte	0x4
+	.uleb128 .LBB187-.LBB187
+	.uleb128 .LBE187-.LBB187
+	.byte	0x4
+	.uleb128 .LBB191-.LBB187
+	.uleb128 .LBE191-.LBB187
+	.byte	0x4
+	.uleb128 .LBB282-.LBB187
+	.uleb128 .LBE282-.LBB187
+	.byte	0
+.LLRL63:
+	.byte	0x5
+	.quad	.LBB192
+	.byte	0x4
+	.uleb128 .LBB192-.LBB192
+	.uleb128 .LBE192-.LBB192
+	.byte	0x4
+	.uleb128 .LBB259-.LBB192
+	.uleb128 .LBE259-.LBB192
+	.byte	0x4
+	.uleb128 .LBB262-.LBB192
+	.uleb128 .LBE262-.LBB192
+	.byte	0
+.LLRL69:
+	.byte	0x5
+	.quad	.LBB198
+	.byte	0x4
+	.uleb128 .LBB198-.LBB198
+	.uleb128 .LBE198-.LBB198
+	.byte	0x4
+	.uleb128 .LBB239-.LBB198
+	.uleb128 .LBE239-.LBB198
+	.byte	0x4
+	.uleb128 .LBB285-.LBB198
+	.uleb128 .LBE285-.LBB198
+	.byte	0x4
+	.uleb128 .LBB292-.LBB198
+	.uleb128 .LBE292-.LBB198
+	.byte	0x4
+	.uleb128 .LBB302-.LBB198
+	.uleb128 .LBE302-.LBB198
+	.byte	0
+.LLRL71:
+	.byte	0x5
+	.quad	.LBB200
+	.byte	0x4
+	.uleb128 .LBB200-.LBB200
+	.uleb128 .LBE200-.LBB200
+	.byte	0x4
+	.uleb128 .LBB211-.LBB200
+	.uleb128 .LBE211-.LBB200
+	.byte	0x4
+	.uleb128 .LBB212-.LBB200
+	.uleb128 .LBE212-.LBB200
+	.byte	0
+.LLRL73:
+	.byte	0x5
+	.quad	.LBB201
+	.byte	0x4
+	.uleb128 .LBB201-.LBB201
+	.uleb128 .LBE201-.LBB201
+	.byte	0x4
+	.uleb128 .LBB205-.LBB201
+	.uleb128 .LBE205-.LBB201
+	.byte	0x4
+	.uleb128 .LBB206-.LBB201
+	.uleb128 .LBE206-.LBB201
+	.byte	0
+.LLRL76:
+	.byte	0x5
+	.quad	.LBB207
+	.byte	0x4
+	.uleb128 .LBB207-.LBB207
+	.uleb128 .LBE207-.LBB207
+	.byte	0x4
+	.uleb128 .LBB210-.LBB207
+	.uleb128 .LBE210-.LBB207
+	.byte	0
+.LLRL79:
+	.byte	0x5
+	.quad	.LBB217
+	.byte	0x4
+	.uleb128 .LBB217-.LBB217
+	.uleb128 .LBE217-.LBB217
+	.byte	0x4
+	.uleb128 .LBB221-.LBB217
+	.uleb128 .LBE221-.LBB217
+	.byte	0x4
+	.uleb128 .LBB222-.LBB217
+	.uleb128 .LBE222-.LBB217
+	.byte	0
+.LLRL82:
+	.byte	0x5
+	.quad	.LBB223
+	.byte	0x4
+	.uleb128 .LBB223-.LBB223
+	.uleb128 .LBE223-.LBB223
+	.byte	0x4
+	.uleb128 .LBB226-.LBB223
+	.uleb128 .LBE226-.LBB223
+	.byte	0
+.LLRL89:
+	.byte	0x5
+	.quad	.LBB231
+	.byte	0x4
+	.uleb128 .LBB231-.LBB231
+	.uleb128 .LBE231-.LBB231
+	.byte	0x4
+	.uleb128 .LBB235-.LBB231
+	.uleb128 .LBE235-.LBB231
+	.byte	0x4
+	.uleb128 .LBB295-.LBB231
+	.uleb128 .LBE295-.LBB231
+	.byte	0
+.LLRL92:
+	.byte	0x5
+	.quad	.LBB236
+	.byte	0x4
+	.uleb128 .LBB236-.LBB236
+	.uleb128 .LBE236-.LBB236
+	.byte	0x4
+	.uleb128 .LBB294-.LBB236
+	.uleb128 .LBE294-.LBB236
+	.byte	0
+.LLRL95:
+	.byte	0x5
+	.quad	.LBB240
+	.byte	0x4
+	.uleb128 .LBB240-.LBB240
+	.uleb128 .LBE240-.LBB240
+	.byte	0x4
+	.uleb128 .LBB250-.LBB240
+	.uleb128 .LBE250-.LBB240
+	.byte	0x4
+	.uleb128 .LBB252-.LBB240
+	.uleb128 .LBE252-.LBB240
+	.byte	0
+.LLRL98:
+	.byte	0x5
+	.quad	.LBB244
+	.byte	0x4
+	.uleb128 .LBB244-.LBB244
+	.uleb128 .LBE244-.LBB244
+	.byte	0x4
+	.uleb128 .LBB251-.LBB244
+	.uleb128 .LBE251-.LBB244
+	.byte	0x4
+	.uleb128 .LBB253-.LBB244
+	.uleb128 .LBE253-.LBB244
+	.byte	0x4
+	.uleb128 .LBB293-.LBB244
+	.uleb128 .LBE293-.LBB244
+	.byte	0x4
+	.uleb128 .LBB297-.LBB244
+	.uleb128 .LBE297-.LBB244
+	.byte	0
+.LLRL101:
+	.byte	0x5
+	.quad	.LBB254
+	.byte	0x4
+	.uleb128 .LBB254-.LBB254
+	.uleb128 .LBE254-.LBB254
+	.byte	0x4
+	.uleb128 .LBB260-.LBB254
+	.uleb128 .LBE260-.LBB254
+	.byte	0x4
+	.uleb128 .LBB261-.LBB254
+	.uleb128 .LBE261-.LBB254
+	.byte	0x4
+	.uleb128 .LBB265-.LBB254
+	.uleb128 .LBE265-.LBB254
+	.byte	0
+.LLRL106:
+	.byte	0x5
+	.quad	.LBB266
+	.byte	0x4
+	.uleb128 .LBB266-.LBB266
+	.uleb128 .LBE266-.LBB266
+	.byte	0x4
+	.uleb128 .LBB300-.LBB266
+	.uleb128 .LBE300-.LBB266
+	.byte	0
+.LLRL109:
+	.byte	0x5
+	.quad	.LBB269
+	.byte	0x4
+	.uleb128 .LBB269-.LBB269
+	.uleb128 .LBE269-.LBB269
+	.byte	0x4
+	.uleb128 .LBB299-.LBB269
+	.uleb128 .LBE299-.LBB269
+	.byte	0
+.LLRL112:
+	.byte	0x5
+	.quad	.LBB272
+	.byte	0x4
+	.uleb128 .LBB272-.LBB272
+	.uleb128 .LBE272-.LBB272
+	.byte	0x4
+	.uleb128 .LBB279-.LBB272
+	.uleb128 .LBE279-.LBB272
+	.byte	0
+.LLRL115:
+	.byte	0x5
+	.quad	.LBB275
+	.byte	0x4
+	.uleb128 .LBB275-.LBB275
+	.uleb128 .LBE275-.LBB275
+	.byte	0x4
+	.uleb128 .LBB280-.LBB275
+	.uleb128 .LBE280-.LBB275
+	.byte	0x4
+	.uleb128 .LBB298-.LBB275
+	.uleb128 .LBE298-.LBB275
+	.byte	0
+.LLRL120:
+	.byte	0x5
+	.quad	.LBB288
+	.byte	0x4
+	.uleb128 .LBB288-.LBB288
+	.uleb128 .LBE288-.LBB288
+	.byte	0x4
+	.uleb128 .LBB291-.LBB288
+	.uleb128 .LBE291-.LBB288
+	.byte	0
+.LLRL123:
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB31
+	.uleb128 .LFE31-.LFB31
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 35 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 45 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 62 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x4
+	.byte	0x4
+	.file 67 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x45
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1183
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 75 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.file 76 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 77 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.file 78 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1306
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1377
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1177
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1185
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1187
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1212
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1215
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1224
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1225
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1226
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1227
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1237
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1276
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1286
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1305
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1313
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pwm_mapping.h.20.6b03fe238617d7e272abe4aa318233de,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1321
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1337
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1359
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1362
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1366
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1375
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1428:
+	.string	"escAndServoConfig_s"
+.LASF1432:
+	.string	"escAndServoConfig_t"
+.LASF1626:
+	.string	"outputMin"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1355:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF939:
+	.string	"__DECL_SIMD_logf "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1193:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1483:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF1642:
+	.string	"flapperons"
+.LASF1608:
+	.string	"mixerOctoX8"
+.LASF1155:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1528:
+	.string	"PIDPITCH"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1360:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF1048:
+	.string	"__DECL_SIMD_sinh "
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1601:
+	.string	"mixerQuadP"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF976:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1567:
+	.string	"FEATURE_RX_PPM"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1248:
+	.string	"FP_NORMAL 4"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1092:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF949:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1646:
+	.string	"writeAllMotors"
+.LASF1665:
+	.string	"escAndServoConfigToUse"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1384:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1403:
+	.string	"_Bool"
+.LASF1074:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF907:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1286:
+	.string	"U_ID_2 0"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1188:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1116:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1044:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1096:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1590:
+	.string	"flight3DConfig"
+.LASF1527:
+	.string	"PIDROLL"
+.LASF1358:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1279:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF1317:
+	.string	"MAX_SERVOS 8"
+.LASF1656:
+	.string	"mixerInit"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1495:
+	.string	"motorMixer_t"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_erff16 "
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1606:
+	.string	"mixerY4"
+.LASF1604:
+	.string	"mixerY6"
+.LASF1045:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF953:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1456:
+	.string	"rcModeActivationMask"
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF1511:
+	.string	"deadband3d_throttle"
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf "
+.LASF924:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1534:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1050:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1252:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF912:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1577:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1396:
+	.string	"uint16_t"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF1587:
+	.string	"FEATURE_DSHOT"
+.LASF1516:
+	.string	"middle"
+.LASF1189:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1492:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1669:
+	.string	"gimbalConfigToUse"
+.LASF931:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1070:
+	.string	"__DECL_SIMD_atan2l "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1251:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF906:
+	.string	"_MATH_H 1"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1033:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF920:
+	.string	"__DECL_SIMD_sinl "
+.LASF1308:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF978:
+	.string	"__DECL_SIMD_atan "
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF1168:
+	.string	"__DECL_SIMD_tan "
+.LASF1563:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF941:
+	.string	"__DECL_SIMD_logf16 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1454:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1592:
+	.string	"airplaneConfig"
+.LASF1536:
+	.string	"PIDVEL"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF997:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF940:
+	.string	"__DECL_SIMD_logl "
+.LASF1310:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1177:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1314:
+	.string	"MAX_PWM_MOTORS 12"
+.LASF948:
+	.string	"__DECL_SIMD_exp "
+.LASF1158:
+	.string	"__DECL_SIMD_erfc "
+.LASF1647:
+	.string	"writeMotors"
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1040:
+	.string	"__DECL_SIMD_expm1l "
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1203:
+	.string	"_Mdouble_"
+.LASF1394:
+	.string	"int32_t"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1324:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1305:
+	.string	"FAST_MATH "
+.LASF1296:
+	.string	"BARO "
+.LASF1249:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1667:
+	.string	"airplaneConfigToUse"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1132:
+	.string	"__DECL_SIMD_erff32 "
+.LASF904:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1027:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1598:
+	.string	"currentMixerConfiguration"
+.LASF950:
+	.string	"__DECL_SIMD_expl "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1416:
+	.string	"rxRuntimeConfig_s"
+.LASF1643:
+	.string	"slow_LFlaps"
+.LASF1594:
+	.string	"gimbalConfig"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF509:
+	.string	"__always_inline"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1133:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1302:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1047:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1260:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1046:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1334:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1542:
+	.string	"values"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1437:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1204:
+	.string	"__MATH_PRECNAME"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF1303:
+	.string	"BLACKBOX "
+.LASF1615:
+	.string	"customMixers"
+.LASF1236:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1207:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1575:
+	.string	"FEATURE_FAILSAFE"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1402:
+	.string	"double"
+.LASF947:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1191:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1376:
+	.string	"AUX_FORWARD_CHANNEL_TO_SERVO_COUNT 4"
+.LASF1197:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshl "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1476:
+	.string	"MULTITYPE_GIMBAL"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1225:
+	.string	"__MATHDECL_1"
+.LASF1368:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1535:
+	.string	"PIDMAG"
+.LASF1415:
+	.string	"rxConfig_t"
+.LASF1650:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1299:
+	.string	"USE_USART2 "
+.LASF1499:
+	.string	"mixer_t"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1129:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF1496:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1316:
+	.string	"MAX_MOTORS 12"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1435:
+	.string	"BOXHORIZON"
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1618:
+	.string	"pwmCompleteMotorUpdate"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF996:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1414:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1026:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1234:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1199:
+	.string	"_Mdouble_ double"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1580:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1530:
+	.string	"PIDALT"
+.LASF1137:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1448:
+	.string	"BOXLLIGHTS"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1576:
+	.string	"FEATURE_SONAR"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1585:
+	.string	"FEATURE_BLACKBOX"
+.LASF1436:
+	.string	"BOXBARO"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1568:
+	.string	"FEATURE_VBAT"
+.LASF1510:
+	.string	"neutral3d"
+.LASF1632:
+	.string	"pidMix"
+.LASF1294:
+	.string	"ACC "
+.LASF1532:
+	.string	"PIDPOSR"
+.LASF1289:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1473:
+	.string	"MULTITYPE_QUADP"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1474:
+	.string	"MULTITYPE_QUADX"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1472:
+	.string	"MULTITYPE_TRI"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF967:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1315:
+	.string	"MAX_PWM_SERVOS 8"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF899:
+	.string	"alloca"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF1497:
+	.string	"roll"
+.LASF1645:
+	.string	"mixTable"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1411:
+	.string	"midrc"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1385:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1387:
+	.string	"__uint16_t"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1351:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF392:
+	.string	"false 0"
+.LASF1034:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1297:
+	.string	"USE_BARO_SITL "
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF358:
+	.string	"__k8 1"
+.LASF1630:
+	.string	"servoOffset"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1340:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1639:
+	.string	"mixMotors"
+.LASF1004:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1262:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF973:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF713:
+	.string	"__size_t "
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1035:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF936:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF964:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1005:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1269:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1238:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1551:
+	.string	"HORIZON_MODE"
+.LASF1378:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1657:
+	.string	"mixerConfiguration"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1571:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1570:
+	.string	"FEATURE_RX_SERIAL"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1356:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1649:
+	.string	"mixerLoadMix"
+.LASF1654:
+	.string	"motorMixer"
+.LASF1338:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1389:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1346:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1401:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1399:
+	.string	"long long int"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1433:
+	.string	"BOXARM"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF1227:
+	.string	"__MATHDECL"
+.LASF1292:
+	.string	"GYRO "
+.LASF1412:
+	.string	"mincheck"
+.LASF1130:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1366:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1280:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF1640:
+	.string	"getMotorOutputRange"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF991:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1449:
+	.string	"BOXCALIB"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1573:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1024:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1266:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1515:
+	.string	"servoParam_t"
+.LASF1087:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF905:
+	.string	"_STRINGS_H 1"
+.LASF1364:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1056:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1445:
+	.string	"BOXBEEPERON"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF508:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1462:
+	.string	"AUX1"
+.LASF1463:
+	.string	"AUX2"
+.LASF981:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1465:
+	.string	"AUX4"
+.LASF1466:
+	.string	"AUX5"
+.LASF1467:
+	.string	"AUX6"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1469:
+	.string	"AUX8"
+.LASF1211:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF1557:
+	.string	"AUTOTUNE_MODE"
+.LASF1638:
+	.string	"offset"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1591:
+	.string	"escAndServoConfig"
+.LASF1522:
+	.string	"loweredCount"
+.LASF1584:
+	.string	"FEATURE_DISPLAY"
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1354:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1426:
+	.string	"gimbal_flags"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1226:
+	.string	"__MATHDECL_ALIAS"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf "
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF376:
+	.string	"unix 1"
+.LASF1328:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1246:
+	.string	"FP_ZERO 2"
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1457:
+	.string	"GimbalFlags"
+.LASF1007:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF1221:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1054:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1609:
+	.string	"mixerOctoFlatP"
+.LASF1636:
+	.string	"mixMax"
+.LASF1637:
+	.string	"outputRange"
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF1541:
+	.string	"rollAndPitchInclination_t_def"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1610:
+	.string	"mixerOctoFlatX"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF917:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1080:
+	.string	"__DECL_SIMD_log10l "
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF957:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1341:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1529:
+	.string	"PIDYAW"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF908:
+	.string	"__DECL_SIMD_cos "
+.LASF1321:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1255:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1484:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1067:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1335:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1086:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF989:
+	.string	"__DECL_SIMD_asinf "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1408:
+	.string	"rxConfig_s"
+.LASF1553:
+	.string	"BARO_MODE"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1215:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF956:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF909:
+	.string	"__DECL_SIMD_cosf "
+.LASF1327:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1293:
+	.string	"USE_GYRO_SITL "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1559:
+	.string	"SONAR_MODE"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1268:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1265:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1398:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1525:
+	.string	"motor_disarmed"
+.LASF1552:
+	.string	"MAG_MODE"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1395:
+	.string	"uint8_t"
+.LASF1595:
+	.string	"motorMixWeights_s"
+.LASF1190:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1491:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1224:
+	.string	"__MATHDECL_1_IMPL"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1464:
+	.string	"AUX3"
+.LASF1548:
+	.string	"ARMED"
+.LASF974:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF961:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1148:
+	.string	"__DECL_SIMD_asinh "
+.LASF1460:
+	.string	"PITCH"
+.LASF1331:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1176:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF975:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1359:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1291:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1245:
+	.string	"FP_INFINITE 1"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1028:
+	.string	"__DECL_SIMD_cosh "
+.LASF1237:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF918:
+	.string	"__DECL_SIMD_sin "
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF1114:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1326:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1348:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1333:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF992:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1180:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1361:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1030:
+	.string	"__DECL_SIMD_coshl "
+.LASF1206:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1486:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF1115:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1420:
+	.string	"rcData"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1493:
+	.string	"MULTITYPE_CUSTOM"
+.LASF1337:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1375:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF914:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1320:
+	.string	"MAX_INPUTS 8"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF946:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1322:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1208:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1288:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF982:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1064:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1423:
+	.string	"GIMBAL_MIXTILT"
+.LASF1518:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1668:
+	.string	"rxConfigToUse"
+.LASF1421:
+	.string	"rxRuntimeConfig"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1597:
+	.string	"motorMixWeights"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1526:
+	.string	"servo"
+.LASF1620:
+	.string	"pwmWriteServo"
+.LASF1065:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1210:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1670:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1523:
+	.string	"raisedCount"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1169:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF1301:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1505:
+	.string	"tri_unarmed_servo"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1635:
+	.string	"mixMin"
+.LASF1619:
+	.string	"pwmWriteMotor"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f "
+.LASF910:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF733:
+	.string	"NULL"
+.LASF1561:
+	.string	"GPS_FIX_HOME"
+.LASF1209:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1352:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF1498:
+	.string	"pitch"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1240:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1418:
+	.string	"auxChannelCount"
+.LASF462:
+	.string	"__PMT"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1136:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1261:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1165:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1089:
+	.string	"__DECL_SIMD_log2f "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1549:
+	.string	"armingFlags"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1138:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF938:
+	.string	"__DECL_SIMD_log "
+.LASF1247:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1186:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1600:
+	.string	"mixerTri"
+.LASF1482:
+	.string	"MULTITYPE_OCTOX8"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1622:
+	.string	"feature"
+.LASF942:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1078:
+	.string	"__DECL_SIMD_log10 "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF987:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF986:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1481:
+	.string	"MULTITYPE_HEX6X"
+.LASF472:
+	.string	"__P(args) args"
+.LASF1353:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1038:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1504:
+	.string	"yaw_direction"
+.LASF1239:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1616:
+	.string	"memset"
+.LASF1218:
+	.string	"_Mdouble_ _Float128"
+.LASF1596:
+	.string	"motorMixWeights_t"
+.LASF1661:
+	.string	"channelToForwardFrom"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1157:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1104:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1278:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1392:
+	.string	"int8_t"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1311:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1100:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1520:
+	.string	"mixCount"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1475:
+	.string	"MULTITYPE_BI"
+.LASF1524:
+	.string	"mixerSaturation_t"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF735:
+	.string	"__need_NULL"
+.LASF1105:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1470:
+	.string	"rcCommand"
+.LASF1644:
+	.string	"lFlap"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1220:
+	.string	"_Mdouble_ _Float32x"
+.LASF1306:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1233:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1183:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF994:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF962:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1093:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1555:
+	.string	"GPS_HOLD_MODE"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1613:
+	.string	"mixerDualcopter"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1599:
+	.string	"mixerSaturation"
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF1545:
+	.string	"axisPID"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1556:
+	.string	"HEADFREE_MODE"
+.LASF995:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1272:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1098:
+	.string	"__DECL_SIMD_log1p "
+.LASF902:
+	.string	"_STRING_H 1"
+.LASF1170:
+	.string	"__DECL_SIMD_tanl "
+.LASF1430:
+	.string	"maxthrottle"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1393:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1379:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1540:
+	.string	"pitchDeciDegrees"
+.LASF1382:
+	.string	"signed char"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF943:
+	.string	"__DECL_SIMD_logf64 "
+.LASF926:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF696:
+	.string	"__size_t__ "
+.LASF1538:
+	.string	"rollAndPitchInclination_s"
+.LASF1543:
+	.string	"rollAndPitchInclination_t"
+.LASF1242:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1372:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1582:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1126:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1307:
+	.string	"sq(x) ((x)*(x))"
+.LASF922:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1094:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1140:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1230:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1662:
+	.string	"mixerUseConfigs"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1544:
+	.string	"inclination"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1273:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1440:
+	.string	"BOXCAMSTAB"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1090:
+	.string	"__DECL_SIMD_log2l "
+.LASF1672:
+	.string	"updateGimbalServos"
+.LASF1624:
+	.string	"getMotorCount"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1345:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1479:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1539:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1410:
+	.string	"serialrx_provider"
+.LASF1212:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF1298:
+	.string	"USE_USART1 "
+.LASF1195:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1634:
+	.string	"pidMixMax"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1257:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF934:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1419:
+	.string	"rxRuntimeConfig_t"
+.LASF1501:
+	.string	"useServo"
+.LASF944:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1431:
+	.string	"mincommand"
+.LASF1066:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1438:
+	.string	"BOXHEADFREE"
+.LASF1471:
+	.string	"MultiType"
+.LASF1264:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1373:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1641:
+	.string	"airplaneMixer"
+.LASF935:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1546:
+	.string	"OK_TO_ARM"
+.LASF1124:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1578:
+	.string	"FEATURE_CURRENT_METER"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF952:
+	.string	"__DECL_SIMD_expf32 "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF951:
+	.string	"__DECL_SIMD_expf16 "
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1629:
+	.string	"channelOffset"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1342:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1095:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1502:
+	.string	"motor"
+.LASF1659:
+	.string	"servoDirection"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1513:
+	.string	"airplaneConfig_t"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1566:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1390:
+	.string	"long int"
+.LASF1350:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1487:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF371:
+	.string	"__linux 1"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1091:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF1127:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1655:
+	.string	"weight"
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1673:
+	.string	"loadMotorMixWeights"
+.LASF1451:
+	.string	"BOXOSD"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1633:
+	.string	"pidMixMin"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1621:
+	.string	"lrintf"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1055:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1488:
+	.string	"MULTITYPE_VTAIL4"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1370:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1295:
+	.string	"USE_ACC_SITL "
+.LASF1318:
+	.string	"MAX_PWM_OUTPUT_PORTS MAX_PWM_MOTORS"
+.LASF1200:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1397:
+	.string	"uint32_t"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF990:
+	.string	"__DECL_SIMD_asinl "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1547:
+	.string	"PREVENT_ARMING"
+.LASF1267:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1088:
+	.string	"__DECL_SIMD_log2 "
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1076:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1107:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1489:
+	.string	"MULTITYPE_HEX6H"
+.LASF1443:
+	.string	"BOXGPSHOLD"
+.LASF1277:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1117:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1146:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF485:
+	.string	"__flexarr []"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF958:
+	.string	"__DECL_SIMD_pow "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1304:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1263:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1439:
+	.string	"BOXHEADADJ"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1319:
+	.string	"PULSE_1MS (1000)"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1569:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF927:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1442:
+	.string	"BOXGPSHOME"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1586:
+	.string	"FEATURE_ONESHOT125"
+.LASF1391:
+	.string	"char"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1531:
+	.string	"PIDPOS"
+.LASF1084:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1603:
+	.string	"mixerBi"
+.LASF1144:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1478:
+	.string	"MULTITYPE_HEX6"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1081:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF998:
+	.string	"__DECL_SIMD_hypot "
+.LASF1611:
+	.string	"mixerVtail4"
+.LASF1185:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1367:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1446:
+	.string	"BOXLEDMAX"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1407:
+	.string	"pwmOutputConfiguration_s"
+.LASF1406:
+	.string	"pwmOutputConfiguration_t"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF913:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1085:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF977:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1627:
+	.string	"outputMax"
+.LASF391:
+	.string	"true 1"
+.LASF915:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1357:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF969:
+	.string	"__DECL_SIMD_acosf "
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1336:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1574:
+	.string	"FEATURE_GPS"
+.LASF955:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF695:
+	.string	"__need_NULL "
+.LASF1057:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1363:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1514:
+	.string	"flaps_speed"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1164:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF993:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1589:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1125:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1554:
+	.string	"GPS_HOME_MODE"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1572:
+	.string	"FEATURE_SERVO_TILT"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1371:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f "
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1434:
+	.string	"BOXANGLE"
+.LASF1550:
+	.string	"ANGLE_MODE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1254:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1179:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF983:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF808:
+	.string	"__off_t_defined "
+.LASF1175:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1118:
+	.string	"__DECL_SIMD_acosh "
+.LASF1174:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1671:
+	.string	"mixerResetSaturation"
+.LASF1347:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1241:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1274:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1244:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF810:
+	.string	"__id_t_defined "
+.LASF1413:
+	.string	"maxcheck"
+.LASF1075:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1031:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1128:
+	.string	"__DECL_SIMD_erf "
+.LASF1425:
+	.string	"gimbalConfig_s"
+.LASF1427:
+	.string	"gimbalConfig_t"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1500:
+	.string	"numberMotor"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1192:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF1461:
+	.string	"THROTTLE"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF968:
+	.string	"__DECL_SIMD_acos "
+.LASF1452:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1344:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1560:
+	.string	"flightModeFlags"
+.LASF945:
+	.string	"__DECL_SIMD_logf32x "
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1271:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1424:
+	.string	"GIMBAL_FORWARDAUX"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF971:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1068:
+	.string	"__DECL_SIMD_atan2 "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1198:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1490:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1581:
+	.string	"FEATURE_RX_MSP"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1369:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1145:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1016:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF1564:
+	.string	"SMALL_ANGLE"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1343:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF1562:
+	.string	"GPS_FIX"
+.LASF1652:
+	.string	"mixerUsePWMOutputConfiguration"
+.LASF1259:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1455:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1388:
+	.string	"__int32_t"
+.LASF1593:
+	.string	"rxConfig"
+.LASF1253:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1450:
+	.string	"BOXGOV"
+.LASF1666:
+	.string	"mixerConfigToUse"
+.LASF979:
+	.string	"__DECL_SIMD_atanf "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1156:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1374:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1232:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1583:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1309:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1287:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF970:
+	.string	"__DECL_SIMD_acosl "
+.LASF1349:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1653:
+	.string	"pwmOutputConfiguration"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1214:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1565:
+	.string	"FIXED_WING"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1106:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF959:
+	.string	"__DECL_SIMD_powf "
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF965:
+	.string	"__DECL_SIMD_powf32x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1519:
+	.string	"mixerSaturation_s"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF988:
+	.string	"__DECL_SIMD_asin "
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1228:
+	.string	"__MATHCALL"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1150:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1312:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1453:
+	.string	"BOXAUTOTUNE"
+.LASF1275:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1588:
+	.string	"servoConf"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1283:
+	.string	"__enable_irq() "
+.LASF1135:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1108:
+	.string	"__DECL_SIMD_atanh "
+.LASF921:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1447:
+	.string	"BOXLEDLOW"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF1468:
+	.string	"AUX7"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1097:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1365:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1458:
+	.string	"rc_alias"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1276:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF801:
+	.string	"__u_char_defined "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1037:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF999:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF933:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1339:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1628:
+	.string	"firstServo"
+.LASF984:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1494:
+	.string	"MULTITYPE_LAST"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1509:
+	.string	"deadband3d_high"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1250:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1222:
+	.string	"_Mdouble_ _Float64x"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1290:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1400:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1077:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF963:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1674:
+	.string	"mixerWeight"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1323:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF985:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF925:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1178:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1503:
+	.string	"mixerConfig_s"
+.LASF1506:
+	.string	"mixerConfig_t"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1281:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1329:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1213:
+	.string	"_Mdouble_ _Float32"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1459:
+	.string	"ROLL"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1036:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1417:
+	.string	"channelCount"
+.LASF1405:
+	.string	"motorCount"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1147:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1032:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1006:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1362:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF923:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1521:
+	.string	"pidScaledCount"
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1507:
+	.string	"flight3DConfig_s"
+.LASF1512:
+	.string	"flight3DConfig_t"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1422:
+	.string	"GIMBAL_NORMAL"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1480:
+	.string	"MULTITYPE_Y4"
+.LASF1477:
+	.string	"MULTITYPE_Y6"
+.LASF966:
+	.string	"__DECL_SIMD_powf64x "
+.LASF916:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF980:
+	.string	"__DECL_SIMD_atanl "
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1663:
+	.string	"servoConfToUse"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1377:
+	.string	"MIXER_WEIGHT_SHIFT 12"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1134:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1017:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF972:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF960:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF937:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1579:
+	.string	"FEATURE_3D"
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1216:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1614:
+	.string	"mixers"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1409:
+	.string	"rcmap"
+.LASF1223:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1612:
+	.string	"mixerHex6H"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1605:
+	.string	"mixerHex6P"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1607:
+	.string	"mixerHex6X"
+.LASF1533:
+	.string	"PIDNAVR"
+.LASF1625:
+	.string	"isMixerUsingServos"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1270:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1631:
+	.string	"motorsMixed"
+.LASF1300:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF911:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1381:
+	.string	"long unsigned int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1660:
+	.string	"determineServoMiddleOrForwardFromChannel"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1285:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1330:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1282:
+	.string	"__disable_irq() "
+.LASF1537:
+	.string	"PID_ITEM_COUNT"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF930:
+	.string	"__DECL_SIMD_sincosl "
+.LASF903:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1184:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1623:
+	.string	"getMixerSaturation"
+.LASF1386:
+	.string	"short int"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1196:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1383:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1325:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf "
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1508:
+	.string	"deadband3d_low"
+.LASF1313:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1380:
+	.string	"unsigned int"
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1167:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1243:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1658:
+	.string	"initialCustomMixers"
+.LASF1664:
+	.string	"flight3DConfigToUse"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1651:
+	.string	"mixerResetMotors"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f "
+.LASF928:
+	.string	"__DECL_SIMD_sincos "
+.LASF1429:
+	.string	"minthrottle"
+.LASF1404:
+	.string	"servoCount"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1444:
+	.string	"BOXPASSTHRU"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1485:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF919:
+	.string	"__DECL_SIMD_sinf "
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF954:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1517:
+	.string	"rate"
+.LASF1441:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1602:
+	.string	"mixerQuadX"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1558:
+	.string	"PASSTHRU_MODE"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1332:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1187:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1160:
+	.string	"__DECL_SIMD_erfcl "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1025:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1617:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1648:
+	.string	"writeServos"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1258:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1154:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1284:
+	.string	"U_ID_0 0x5349544c"
+.LASF1194:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/flight/mixer.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16817 @@
+	.file	"serial.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/io/serial.c"
+	.section	.text.getSerialPortFunctionList,"ax",@progbits
+	.p2align 4
+	.globl	getSerialPortFunctionList
+	.type	getSerialPortFunctionList, @function
+getSerialPortFunctionList:
+.LFB11:
+	.file 1 ".//src/main/io/serial.c"
+	.loc 1 151 1 view -0
+	.cfi_startproc
+	.loc 1 152 5 view .LVU1
+	.loc 1 152 12 is_stmt 0 view .LVU2
+	leaq	serialPortFunctionList(%rip), %rax
+	.loc 1 153 1 view .LVU3
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	getSerialPortFunctionList, .-getSerialPortFunctionList
+	.section	.text.lookupScenarioIndex,"ax",@progbits
+	.p2align 4
+	.globl	lookupScenarioIndex
+	.type	lookupScenarioIndex, @function
+lookupScenarioIndex:
+.LVL0:
+.LFB12:
+	.loc 1 155 68 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 5 view .LVU5
+	.loc 1 157 5 view .LVU6
+	.loc 1 157 27 view .LVU7
+	.loc 1 155 68 is_stmt 0 view .LVU8
+	xorl	%eax, %eax
+	leaq	serialPortScenarios(%rip), %rdx
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.loc 1 158 9 is_stmt 1 view .LVU9
+	.loc 1 158 12 is_stmt 0 view .LVU10
+	cmpl	%edi, (%rdx,%rax,4)
+	je	.L3
+	.loc 1 157 38 is_stmt 1 discriminator 2 view .LVU11
+.LVL2:
+	.loc 1 157 27 discriminator 2 view .LVU12
+	addq	$1, %rax
+.LVL3:
+	.loc 1 157 27 is_stmt 0 discriminator 2 view .LVU13
+	cmpq	$10, %rax
+	jne	.L5
+.LVL4:
+.L3:
+	.loc 1 163 1 view .LVU14
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lookupScenarioIndex, .-lookupScenarioIndex
+	.section	.text.findNextSerialPort,"ax",@progbits
+	.p2align 4
+	.globl	findNextSerialPort
+	.type	findNextSerialPort, @function
+findNextSerialPort:
+.LVL5:
+.LFB19:
+	.loc 1 240 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 241 5 view .LVU16
+	.loc 1 242 5 view .LVU17
+	.loc 1 243 5 view .LVU18
+	.loc 1 240 1 is_stmt 0 view .LVU19
+	movq	%rdx, %rax
+	.loc 1 243 34 view .LVU20
+	movzbl	32(%rdx), %edx
+.LVL6:
+	.loc 1 243 104 is_stmt 1 view .LVU21
+	cmpb	$1, %dl
+	ja	.L14
+	movzbl	%dl, %ecx
+	.loc 1 240 1 is_stmt 0 view .LVU22
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%edi, %r9d
+	movq	%rsi, %rdi
+.LVL7:
+	.loc 1 240 1 view .LVU23
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	(%rcx,%rcx,2), %rcx
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	leaq	serialPortFunctions(%rip), %rbx
+	leaq	(%rbx,%rcx,8), %rcx
+.LVL8:
+.L13:
+.LBB24:
+	.loc 1 244 9 is_stmt 1 view .LVU24
+	.loc 1 246 9 view .LVU25
+	.loc 1 246 44 is_stmt 0 view .LVU26
+	movl	%r9d, %esi
+	andl	16(%rcx), %esi
+	.loc 1 246 12 view .LVU27
+	jne	.L31
+.L10:
+.LBE24:
+	.loc 1 243 132 is_stmt 1 discriminator 2 view .LVU28
+.LVL9:
+	.loc 1 243 104 discriminator 2 view .LVU29
+	addl	$1, %edx
+.LVL10:
+	.loc 1 243 104 is_stmt 0 discriminator 2 view .LVU30
+	addq	$24, %rcx
+	cmpb	$1, %dl
+	jbe	.L13
+	.loc 1 291 1 view .LVU31
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 290 11 view .LVU32
+	xorl	%eax, %eax
+.LVL11:
+	.loc 1 291 1 view .LVU33
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+.LBB31:
+	.loc 1 250 9 is_stmt 1 view .LVU34
+	.loc 1 250 35 is_stmt 0 view .LVU35
+	movl	(%rcx), %r11d
+.LVL13:
+.LBB25:
+.LBI25:
+	.loc 1 165 26 is_stmt 1 view .LVU36
+.LBB26:
+	.loc 1 167 5 view .LVU37
+	.loc 1 168 5 view .LVU38
+	.loc 1 168 35 view .LVU39
+	.loc 1 169 9 view .LVU40
+	.loc 1 169 12 is_stmt 0 view .LVU41
+	testl	%r11d, %r11d
+	je	.L15
+	.loc 1 168 49 is_stmt 1 view .LVU42
+.LVL14:
+	.loc 1 168 35 view .LVU43
+	.loc 1 169 9 view .LVU44
+	.loc 1 169 12 is_stmt 0 view .LVU45
+	cmpl	$1, %r11d
+	je	.L16
+	leaq	32+serialPortConstraints(%rip), %rbp
+	movl	$2, %esi
+	movl	$2, %r11d
+.LVL15:
+	.loc 1 169 12 view .LVU46
+	leaq	-32(%rbp), %r8
+.LVL16:
+.L11:
+	.loc 1 173 5 is_stmt 1 view .LVU47
+	.loc 1 173 5 is_stmt 0 view .LVU48
+.LBE26:
+.LBE25:
+	.loc 1 251 9 is_stmt 1 view .LVU49
+	.loc 1 269 9 view .LVU50
+	.loc 1 269 31 is_stmt 0 view .LVU51
+	movzbl	16(%rdi), %r10d
+	.loc 1 269 12 view .LVU52
+	testb	%r10b, %r10b
+	je	.L12
+	.loc 1 270 13 is_stmt 1 view .LVU53
+	.loc 1 270 39 is_stmt 0 view .LVU54
+	movq	%rsi, %r12
+	salq	$4, %r12
+	.loc 1 270 49 view .LVU55
+	andl	12(%r8,%r12), %r10d
+	.loc 1 270 16 view .LVU56
+	testb	%r10b, %r10b
+	je	.L10
+.L12:
+	.loc 1 275 9 is_stmt 1 view .LVU57
+	.loc 1 275 67 is_stmt 0 view .LVU58
+	salq	$4, %rsi
+	addq	%r8, %rsi
+	.loc 1 275 12 view .LVU59
+	movl	4(%rsi), %r8d
+	cmpl	%r8d, 4(%rdi)
+	jb	.L10
+	.loc 1 275 81 discriminator 2 view .LVU60
+	movl	8(%rdi), %r10d
+	cmpl	%r10d, 8(%rsi)
+	jb	.L10
+	.loc 1 279 9 is_stmt 1 view .LVU61
+	.loc 1 244 28 is_stmt 0 view .LVU62
+	movslq	%edx, %rcx
+	.loc 1 284 17 view .LVU63
+	addl	$1, %edx
+.LVL17:
+	.loc 1 279 33 view .LVU64
+	movl	%r11d, (%rax)
+	.loc 1 280 9 is_stmt 1 view .LVU65
+	.loc 1 244 28 is_stmt 0 view .LVU66
+	leaq	(%rcx,%rcx,2), %rcx
+	.loc 1 280 38 view .LVU67
+	movq	%rbp, 16(%rax)
+	.loc 1 281 9 is_stmt 1 view .LVU68
+	.loc 1 244 28 is_stmt 0 view .LVU69
+	leaq	(%rbx,%rcx,8), %rcx
+	.loc 1 282 42 view .LVU70
+	movq	%rdi, 24(%rax)
+	.loc 1 244 28 view .LVU71
+	movq	%rcx, 8(%rax)
+	.loc 1 282 9 is_stmt 1 view .LVU72
+	.loc 1 284 9 view .LVU73
+	.loc 1 285 9 view .LVU74
+	.loc 1 284 17 is_stmt 0 view .LVU75
+	movb	%dl, 32(%rax)
+	.loc 1 287 9 is_stmt 1 view .LVU76
+.LBE31:
+	.loc 1 291 1 is_stmt 0 view .LVU77
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL18:
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+.LBB32:
+.LBB29:
+.LBB27:
+	.loc 1 169 12 view .LVU78
+	leaq	serialPortConstraints(%rip), %r8
+	xorl	%esi, %esi
+	movq	%r8, %rbp
+	jmp	.L11
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.loc 1 169 12 view .LVU79
+.LBE27:
+.LBE29:
+.LBE32:
+	.loc 1 290 11 view .LVU80
+	xorl	%eax, %eax
+.LVL20:
+	.loc 1 291 1 view .LVU81
+	ret
+.LVL21:
+.L16:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.cfi_offset 6, -24
+	.cfi_offset 12, -16
+.LBB33:
+.LBB30:
+.LBB28:
+	.loc 1 169 12 view .LVU82
+	leaq	16+serialPortConstraints(%rip), %rbp
+	movl	$1, %esi
+	leaq	-16(%rbp), %r8
+	jmp	.L11
+.LBE28:
+.LBE30:
+.LBE33:
+	.cfi_endproc
+.LFE19:
+	.size	findNextSerialPort, .-findNextSerialPort
+	.section	.text.findSerialPort,"ax",@progbits
+	.p2align 4
+	.type	findSerialPort, @function
+findSerialPort:
+.LVL22:
+.LFB20:
+	.loc 1 299 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 300 5 view .LVU84
+	.loc 1 302 5 view .LVU85
+.LBB42:
+.LBB43:
+.LBB44:
+.LBB45:
+	.loc 1 214 30 is_stmt 0 view .LVU86
+	movl	16+serialPortFunctions(%rip), %edx
+.LBE45:
+.LBE44:
+.LBE43:
+.LBE42:
+	.loc 1 302 5 view .LVU87
+	pxor	%xmm0, %xmm0
+.LBB76:
+.LBB68:
+.LBB63:
+.LBB58:
+	.loc 1 214 62 view .LVU88
+	movl	40+serialPortFunctions(%rip), %eax
+.LBE58:
+.LBE63:
+.LBE68:
+.LBE76:
+	.loc 1 299 1 view .LVU89
+	movq	%rsi, %r8
+	.loc 1 302 5 view .LVU90
+	movq	$0, 32+serialPortSearchResult.0(%rip)
+	.loc 1 305 5 is_stmt 1 view .LVU91
+.LBB77:
+.LBI42:
+	.loc 1 217 13 view .LVU92
+.LVL23:
+.LBB69:
+	.loc 1 225 29 view .LVU93
+	.loc 1 226 33 view .LVU94
+	.loc 1 228 13 view .LVU95
+.LBB64:
+.LBI44:
+	.loc 1 209 12 view .LVU96
+.LBB59:
+	.loc 1 211 5 view .LVU97
+	.loc 1 212 5 view .LVU98
+	.loc 1 214 5 view .LVU99
+.LBB46:
+.LBI46:
+	.loc 1 203 16 view .LVU100
+.LBB47:
+	.loc 1 204 3 view .LVU101
+	.loc 1 205 3 view .LVU102
+	.loc 1 205 15 view .LVU103
+.LBE47:
+.LBE46:
+.LBE59:
+.LBE64:
+.LBE69:
+.LBE77:
+	.loc 1 302 5 is_stmt 0 view .LVU104
+	movaps	%xmm0, serialPortSearchResult.0(%rip)
+	movaps	%xmm0, 16+serialPortSearchResult.0(%rip)
+.LBB78:
+.LBB70:
+.LBB65:
+.LBB60:
+.LBB50:
+.LBB48:
+	.loc 1 205 15 view .LVU105
+	testl	%edx, %edx
+	je	.L33
+	.loc 1 205 10 view .LVU106
+	xorl	%esi, %esi
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	.loc 1 206 5 is_stmt 1 view .LVU107
+	.loc 1 206 12 is_stmt 0 view .LVU108
+	leal	-1(%rdx), %ecx
+.LVL25:
+	.loc 1 205 19 is_stmt 1 view .LVU109
+	addl	$1, %esi
+.LVL26:
+	.loc 1 205 15 view .LVU110
+	andl	%ecx, %edx
+.LVL27:
+	.loc 1 205 15 is_stmt 0 view .LVU111
+	jne	.L34
+	.loc 1 207 3 is_stmt 1 view .LVU112
+.LVL28:
+	.loc 1 207 3 is_stmt 0 view .LVU113
+.LBE48:
+.LBE50:
+	.loc 1 214 12 view .LVU114
+	movzbl	%sil, %esi
+.LVL29:
+.LBB51:
+.LBI51:
+	.loc 1 203 16 is_stmt 1 view .LVU115
+.LBB52:
+	.loc 1 205 15 view .LVU116
+	testl	%eax, %eax
+	je	.L38
+.LVL30:
+.L36:
+	.loc 1 205 10 is_stmt 0 view .LVU117
+	xorl	%ecx, %ecx
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.loc 1 206 5 is_stmt 1 view .LVU118
+	.loc 1 206 12 is_stmt 0 view .LVU119
+	leal	-1(%rax), %edx
+.LVL32:
+	.loc 1 205 19 is_stmt 1 view .LVU120
+	addl	$1, %ecx
+.LVL33:
+	.loc 1 205 15 view .LVU121
+	andl	%edx, %eax
+.LVL34:
+	.loc 1 205 15 is_stmt 0 view .LVU122
+	jne	.L39
+	.loc 1 207 3 is_stmt 1 view .LVU123
+.LVL35:
+	.loc 1 207 3 is_stmt 0 view .LVU124
+.LBE52:
+.LBE51:
+.LBE60:
+.LBE65:
+	.loc 1 230 13 is_stmt 1 view .LVU125
+.LBB66:
+.LBB61:
+	.loc 1 214 44 is_stmt 0 view .LVU126
+	movzbl	%cl, %ecx
+	.loc 1 214 44 view .LVU127
+.LBE61:
+.LBE66:
+	.loc 1 230 16 view .LVU128
+	cmpl	%ecx, %esi
+	jg	.L38
+.LVL36:
+.L37:
+	.loc 1 226 64 is_stmt 1 view .LVU129
+	.loc 1 226 33 view .LVU130
+	.loc 1 225 53 view .LVU131
+	.loc 1 225 29 view .LVU132
+	.loc 1 225 29 is_stmt 0 view .LVU133
+.LBE70:
+.LBE78:
+	.loc 1 307 5 is_stmt 1 view .LVU134
+	.loc 1 307 12 is_stmt 0 view .LVU135
+	leaq	serialPortSearchResult.0(%rip), %rdx
+	movq	%r8, %rsi
+	jmp	findNextSerialPort
+.LVL37:
+.L38:
+.LBB79:
+.LBB71:
+	.loc 1 231 17 is_stmt 1 view .LVU136
+	.loc 1 232 17 is_stmt 0 view .LVU137
+	movq	40+serialPortFunctions(%rip), %rdx
+	.loc 1 231 17 view .LVU138
+	movdqa	serialPortFunctions(%rip), %xmm0
+.LBE71:
+.LBE79:
+	.loc 1 307 12 view .LVU139
+	movq	%r8, %rsi
+.LBB80:
+.LBB72:
+	.loc 1 231 17 view .LVU140
+	movq	16+serialPortFunctions(%rip), %rax
+	.loc 1 232 17 is_stmt 1 view .LVU141
+	movdqu	24+serialPortFunctions(%rip), %xmm1
+	movq	%rdx, 16+serialPortFunctions(%rip)
+	.loc 1 233 17 view .LVU142
+.LBE72:
+.LBE80:
+	.loc 1 307 12 is_stmt 0 view .LVU143
+	leaq	serialPortSearchResult.0(%rip), %rdx
+.LBB81:
+.LBB73:
+	.loc 1 233 17 view .LVU144
+	movq	%rax, 40+serialPortFunctions(%rip)
+	.loc 1 226 64 is_stmt 1 view .LVU145
+.LVL38:
+	.loc 1 226 33 view .LVU146
+	.loc 1 225 53 view .LVU147
+	.loc 1 225 29 view .LVU148
+	.loc 1 225 29 is_stmt 0 view .LVU149
+.LBE73:
+.LBE81:
+	.loc 1 307 5 is_stmt 1 view .LVU150
+.LBB82:
+.LBB74:
+	.loc 1 232 17 is_stmt 0 view .LVU151
+	movaps	%xmm1, serialPortFunctions(%rip)
+	.loc 1 233 17 view .LVU152
+	movups	%xmm0, 24+serialPortFunctions(%rip)
+.LBE74:
+.LBE82:
+	.loc 1 307 12 view .LVU153
+	jmp	findNextSerialPort
+.LVL39:
+.L33:
+.LBB83:
+.LBB75:
+.LBB67:
+.LBB62:
+.LBB55:
+.LBB49:
+	.loc 1 207 3 is_stmt 1 view .LVU154
+	.loc 1 207 3 is_stmt 0 view .LVU155
+.LBE49:
+.LBE55:
+.LBB56:
+	.loc 1 203 16 is_stmt 1 view .LVU156
+.LBB53:
+	.loc 1 205 15 view .LVU157
+.LBE53:
+.LBE56:
+	.loc 1 214 12 is_stmt 0 view .LVU158
+	xorl	%esi, %esi
+.LVL40:
+.LBB57:
+.LBB54:
+	.loc 1 205 15 view .LVU159
+	testl	%eax, %eax
+	jne	.L36
+	jmp	.L37
+.LBE54:
+.LBE57:
+.LBE62:
+.LBE67:
+.LBE75:
+.LBE83:
+	.cfi_endproc
+.LFE20:
+	.size	findSerialPort, .-findSerialPort
+	.section	.text.findOpenSerialPort,"ax",@progbits
+	.p2align 4
+	.globl	findOpenSerialPort
+	.type	findOpenSerialPort, @function
+findOpenSerialPort:
+.LVL41:
+.LFB22:
+	.loc 1 340 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 341 5 view .LVU161
+.LBB88:
+.LBI88:
+	.loc 1 311 30 view .LVU162
+.LBB89:
+	.loc 1 313 5 view .LVU163
+	.loc 1 316 5 view .LVU164
+	.loc 1 316 35 view .LVU165
+.LBB90:
+	.loc 1 317 9 view .LVU166
+	.loc 1 318 9 view .LVU167
+	.loc 1 318 31 is_stmt 0 view .LVU168
+	movl	16+serialPortFunctions(%rip), %eax
+	.loc 1 318 42 view .LVU169
+	movzwl	%di, %edi
+	.loc 1 318 12 view .LVU170
+	cmpl	%edi, %eax
+	je	.L52
+.LBE90:
+	.loc 1 316 49 is_stmt 1 view .LVU171
+.LVL42:
+	.loc 1 316 35 view .LVU172
+.LBB91:
+	.loc 1 317 9 view .LVU173
+	.loc 1 318 9 view .LVU174
+	.loc 1 318 31 is_stmt 0 view .LVU175
+	movl	40+serialPortFunctions(%rip), %edx
+	.loc 1 318 12 view .LVU176
+	cmpl	%edx, %edi
+	je	.L51
+.LBE91:
+	.loc 1 316 49 is_stmt 1 view .LVU177
+.LVL43:
+	.loc 1 316 35 view .LVU178
+	.loc 1 324 35 view .LVU179
+.LBB92:
+	.loc 1 325 9 view .LVU180
+	.loc 1 326 9 view .LVU181
+	.loc 1 326 12 is_stmt 0 view .LVU182
+	testl	%edi, %eax
+	jne	.L52
+.LBE92:
+	.loc 1 324 49 is_stmt 1 view .LVU183
+.LVL44:
+	.loc 1 324 35 view .LVU184
+.LBB93:
+	.loc 1 325 9 view .LVU185
+	.loc 1 326 9 view .LVU186
+.LBE93:
+.LBE89:
+.LBE88:
+	.loc 1 343 15 is_stmt 0 view .LVU187
+	xorl	%eax, %eax
+.LBB100:
+.LBB97:
+.LBB94:
+	.loc 1 326 12 view .LVU188
+	testl	%edx, %edi
+	jne	.L51
+.LBE94:
+.LBE97:
+.LBE100:
+	.loc 1 346 1 view .LVU189
+	ret
+.LVL45:
+	.p2align 4,,10
+	.p2align 3
+.L52:
+.LBB101:
+.LBB98:
+.LBB95:
+	.loc 1 317 31 view .LVU190
+	leaq	serialPortFunctions(%rip), %rax
+.LVL46:
+.L48:
+	.loc 1 317 31 view .LVU191
+.LBE95:
+.LBE98:
+.LBE101:
+	.loc 1 345 5 is_stmt 1 view .LVU192
+	.loc 1 345 20 is_stmt 0 view .LVU193
+	movq	8(%rax), %rax
+	.loc 1 346 1 view .LVU194
+	ret
+.LVL47:
+	.p2align 4,,10
+	.p2align 3
+.L51:
+.LBB102:
+.LBB99:
+.LBB96:
+	.loc 1 317 31 view .LVU195
+	leaq	24+serialPortFunctions(%rip), %rax
+.LVL48:
+	.loc 1 317 31 view .LVU196
+	jmp	.L48
+.LBE96:
+.LBE99:
+.LBE102:
+	.cfi_endproc
+.LFE22:
+	.size	findOpenSerialPort, .-findOpenSerialPort
+	.section	.text.unlikely.beginSerialPortFunction,"ax",@progbits
+.LCOLDB0:
+	.section	.text.beginSerialPortFunction,"ax",@progbits
+.LHOTB0:
+	.p2align 4
+	.section	.text.unlikely.beginSerialPortFunction
+.Ltext_cold0:
+	.section	.text.beginSerialPortFunction
+	.globl	beginSerialPortFunction
+	.type	beginSerialPortFunction, @function
+beginSerialPortFunction:
+.LVL49:
+.LFB24:
+	.loc 1 366 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 367 5 view .LVU198
+.LBB103:
+.LBI103:
+	.loc 1 350 31 view .LVU199
+.LBB104:
+	.loc 1 352 5 view .LVU200
+	.loc 1 353 5 view .LVU201
+	.loc 1 355 5 view .LVU202
+	.loc 1 355 43 view .LVU203
+	.loc 1 356 9 view .LVU204
+	.loc 1 357 9 view .LVU205
+	.loc 1 357 12 is_stmt 0 view .LVU206
+	cmpq	8+serialPortFunctions(%rip), %rdi
+	je	.L58
+	.loc 1 355 61 is_stmt 1 view .LVU207
+.LVL50:
+	.loc 1 355 43 view .LVU208
+	.loc 1 356 9 view .LVU209
+	.loc 1 357 9 view .LVU210
+	.loc 1 357 12 is_stmt 0 view .LVU211
+	cmpq	32+serialPortFunctions(%rip), %rdi
+	jne	.L57
+	.loc 1 356 28 view .LVU212
+	leaq	24+serialPortFunctions(%rip), %rax
+.LVL51:
+.L56:
+	.loc 1 356 28 view .LVU213
+.LBE104:
+.LBE103:
+	.loc 1 369 5 is_stmt 1 view .LVU214
+	.loc 1 369 41 is_stmt 0 view .LVU215
+	movl	%esi, 20(%rax)
+	.loc 1 370 1 view .LVU216
+	ret
+.LVL52:
+	.p2align 4,,10
+	.p2align 3
+.L58:
+.LBB107:
+.LBB105:
+	.loc 1 356 28 view .LVU217
+	leaq	serialPortFunctions(%rip), %rax
+	jmp	.L56
+.LVL53:
+	.loc 1 356 28 view .LVU218
+.LBE105:
+.LBE107:
+	.cfi_endproc
+	.section	.text.unlikely.beginSerialPortFunction
+	.cfi_startproc
+	.type	beginSerialPortFunction.cold, @function
+beginSerialPortFunction.cold:
+.LFSB24:
+.LBB108:
+.LBB106:
+.L57:
+	.loc 1 355 61 is_stmt 1 view -0
+.LVL54:
+	.loc 1 355 43 view .LVU220
+	.loc 1 355 43 is_stmt 0 view .LVU221
+.LBE106:
+.LBE108:
+	.loc 1 369 5 is_stmt 1 view .LVU222
+	.loc 1 369 41 is_stmt 0 view .LVU223
+	xorl	%eax, %eax
+	movl	%eax, 20
+	ud2
+	.cfi_endproc
+.LFE24:
+	.section	.text.beginSerialPortFunction
+	.size	beginSerialPortFunction, .-beginSerialPortFunction
+	.section	.text.unlikely.beginSerialPortFunction
+	.size	beginSerialPortFunction.cold, .-beginSerialPortFunction.cold
+.LCOLDE0:
+	.section	.text.beginSerialPortFunction
+.LHOTE0:
+	.section	.text.unlikely.endSerialPortFunction,"ax",@progbits
+.LCOLDB1:
+	.section	.text.endSerialPortFunction,"ax",@progbits
+.LHOTB1:
+	.p2align 4
+	.globl	endSerialPortFunction
+	.type	endSerialPortFunction, @function
+endSerialPortFunction:
+.LVL55:
+.LFB25:
+	.loc 1 373 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 374 5 view .LVU225
+	.loc 1 375 5 view .LVU226
+.LBB109:
+.LBI109:
+	.loc 1 350 31 view .LVU227
+.LBB110:
+	.loc 1 352 5 view .LVU228
+	.loc 1 353 5 view .LVU229
+	.loc 1 355 5 view .LVU230
+	.loc 1 355 43 view .LVU231
+	.loc 1 356 9 view .LVU232
+	.loc 1 357 9 view .LVU233
+	.loc 1 357 12 is_stmt 0 view .LVU234
+	cmpq	8+serialPortFunctions(%rip), %rdi
+	je	.L63
+	.loc 1 355 61 is_stmt 1 view .LVU235
+.LVL56:
+	.loc 1 355 43 view .LVU236
+	.loc 1 356 9 view .LVU237
+	.loc 1 357 9 view .LVU238
+	.loc 1 357 12 is_stmt 0 view .LVU239
+	cmpq	32+serialPortFunctions(%rip), %rdi
+	jne	.L62
+	.loc 1 356 28 view .LVU240
+	leaq	24+serialPortFunctions(%rip), %rax
+.LVL57:
+.L61:
+	.loc 1 356 28 view .LVU241
+.LBE110:
+.LBE109:
+	.loc 1 377 5 is_stmt 1 view .LVU242
+	.loc 1 377 41 is_stmt 0 view .LVU243
+	movl	$0, 20(%rax)
+	.loc 1 378 1 view .LVU244
+	ret
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+.LBB113:
+.LBB111:
+	.loc 1 356 28 view .LVU245
+	leaq	serialPortFunctions(%rip), %rax
+	jmp	.L61
+.LVL59:
+	.loc 1 356 28 view .LVU246
+.LBE111:
+.LBE113:
+	.cfi_endproc
+	.section	.text.unlikely.endSerialPortFunction
+	.cfi_startproc
+	.type	endSerialPortFunction.cold, @function
+endSerialPortFunction.cold:
+.LFSB25:
+.LBB114:
+.LBB112:
+.L62:
+	.loc 1 355 61 is_stmt 1 view -0
+.LVL60:
+	.loc 1 355 43 view .LVU248
+	.loc 1 355 43 is_stmt 0 view .LVU249
+.LBE112:
+.LBE114:
+	.loc 1 377 5 is_stmt 1 view .LVU250
+	.loc 1 377 41 is_stmt 0 view .LVU251
+	xorl	%eax, %eax
+	movl	%eax, 20
+	ud2
+	.cfi_endproc
+.LFE25:
+	.section	.text.endSerialPortFunction
+	.size	endSerialPortFunction, .-endSerialPortFunction
+	.section	.text.unlikely.endSerialPortFunction
+	.size	endSerialPortFunction.cold, .-endSerialPortFunction.cold
+.LCOLDE1:
+	.section	.text.endSerialPortFunction
+.LHOTE1:
+	.section	.text.getConfiguredFunctionConstraint,"ax",@progbits
+	.p2align 4
+	.globl	getConfiguredFunctionConstraint
+	.type	getConfiguredFunctionConstraint, @function
+getConfiguredFunctionConstraint:
+.LVL61:
+.LFB26:
+	.loc 1 381 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 382 5 view .LVU253
+	.loc 1 383 5 view .LVU254
+	.loc 1 385 5 view .LVU255
+.LBB117:
+.LBI117:
+	.loc 1 189 36 view .LVU256
+.LBB118:
+	.loc 1 191 5 view .LVU257
+	.loc 1 192 5 view .LVU258
+	.loc 1 194 5 view .LVU259
+	.loc 1 194 63 view .LVU260
+	leaq	functionConstraints(%rip), %rcx
+.LBE118:
+.LBE117:
+	.loc 1 381 1 is_stmt 0 view .LVU261
+	xorl	%eax, %eax
+	movq	%rcx, %rdx
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+.LBB121:
+.LBB119:
+	.loc 1 195 9 is_stmt 1 view .LVU262
+	.loc 1 196 9 view .LVU263
+	.loc 1 196 12 is_stmt 0 view .LVU264
+	cmpl	(%rdx), %edi
+	je	.L66
+	.loc 1 194 150 is_stmt 1 view .LVU265
+.LVL63:
+	.loc 1 194 63 view .LVU266
+	addl	$1, %eax
+.LVL64:
+	.loc 1 194 63 is_stmt 0 view .LVU267
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L67
+.LBE119:
+.LBE121:
+	.loc 1 387 15 view .LVU268
+	xorl	%eax, %eax
+.LVL65:
+	.loc 1 387 15 view .LVU269
+	ret
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.loc 1 386 5 is_stmt 1 view .LVU270
+	.loc 1 389 5 view .LVU271
+.LBB122:
+.LBB120:
+	.loc 1 195 28 is_stmt 0 view .LVU272
+	cltq
+	.loc 1 195 28 view .LVU273
+.LBE120:
+.LBE122:
+	.loc 1 389 5 view .LVU274
+	leaq	(%rax,%rax,4), %rax
+.LVL67:
+	.loc 1 389 5 view .LVU275
+	leaq	(%rcx,%rax,4), %rax
+	movdqu	(%rax), %xmm1
+	movl	16(%rax), %eax
+	movaps	%xmm1, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU276
+	cmpl	$16, %edi
+	je	.L69
+	ja	.L70
+	cmpl	$1, %edi
+	je	.L71
+	cmpl	$2, %edi
+	jne	.L73
+	.loc 1 397 13 view .LVU277
+	.loc 1 397 68 is_stmt 0 view .LVU278
+	movq	serialConfig(%rip), %rax
+	movd	8(%rax), %xmm0
+	.loc 1 398 13 is_stmt 1 view .LVU279
+	.loc 1 397 54 is_stmt 0 view .LVU280
+	pshufd	$0xe0, %xmm0, %xmm0
+	movq	%xmm0, 4+configuredFunctionConstraint.1(%rip)
+	.loc 1 399 13 is_stmt 1 view .LVU281
+.L73:
+	.loc 1 423 12 is_stmt 0 view .LVU282
+	leaq	configuredFunctionConstraint.1(%rip), %rax
+	.loc 1 424 1 view .LVU283
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.loc 1 391 5 view .LVU284
+	cmpl	$32, %edi
+	jne	.L73
+	.loc 1 402 13 is_stmt 1 view .LVU285
+	.loc 1 402 68 is_stmt 0 view .LVU286
+	movq	serialConfig(%rip), %rax
+	movd	16(%rax), %xmm0
+	.loc 1 403 13 is_stmt 1 view .LVU287
+	.loc 1 423 12 is_stmt 0 view .LVU288
+	leaq	configuredFunctionConstraint.1(%rip), %rax
+	.loc 1 402 54 view .LVU289
+	pshufd	$0xe0, %xmm0, %xmm0
+	movq	%xmm0, 4+configuredFunctionConstraint.1(%rip)
+	.loc 1 404 13 is_stmt 1 view .LVU290
+	.loc 1 424 1 is_stmt 0 view .LVU291
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L69:
+	.loc 1 418 13 is_stmt 1 view .LVU292
+	.loc 1 418 68 is_stmt 0 view .LVU293
+	movq	serialConfig(%rip), %rax
+	.loc 1 418 54 view .LVU294
+	movl	12(%rax), %eax
+	movl	%eax, 8+configuredFunctionConstraint.1(%rip)
+	.loc 1 419 13 is_stmt 1 view .LVU295
+	jmp	.L73
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.loc 1 393 13 view .LVU296
+	.loc 1 393 68 is_stmt 0 view .LVU297
+	movq	serialConfig(%rip), %rax
+	.loc 1 393 54 view .LVU298
+	movl	4(%rax), %eax
+	movl	%eax, 8+configuredFunctionConstraint.1(%rip)
+	.loc 1 394 13 is_stmt 1 view .LVU299
+	jmp	.L73
+	.cfi_endproc
+.LFE26:
+	.size	getConfiguredFunctionConstraint, .-getConfiguredFunctionConstraint
+	.section	.text.isSerialConfigValid,"ax",@progbits
+	.p2align 4
+	.globl	isSerialConfigValid
+	.type	isSerialConfigValid, @function
+isSerialConfigValid:
+.LVL68:
+.LFB27:
+	.loc 1 427 1 view -0
+	.cfi_startproc
+	.loc 1 428 5 view .LVU301
+	.loc 1 429 5 view .LVU302
+	.loc 1 431 5 view .LVU303
+	.loc 1 431 18 is_stmt 0 view .LVU304
+	movq	%rdi, serialConfig(%rip)
+	.loc 1 433 5 is_stmt 1 view .LVU305
+.LVL69:
+.LBB147:
+.LBI147:
+	.loc 1 380 23 view .LVU306
+.LBB148:
+.LBB149:
+.LBB150:
+	.loc 1 194 63 view .LVU307
+.LBE150:
+.LBE149:
+.LBE148:
+.LBE147:
+	.loc 1 431 18 is_stmt 0 view .LVU308
+	xorl	%eax, %eax
+	.loc 1 427 1 view .LVU309
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	functionConstraints(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 431 18 view .LVU310
+	movq	%rbp, %rdx
+	movq	%rbp, %rbx
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+.LBB157:
+.LBB155:
+.LBB153:
+.LBB151:
+	.loc 1 195 9 is_stmt 1 view .LVU311
+	.loc 1 196 9 view .LVU312
+	.loc 1 196 12 is_stmt 0 view .LVU313
+	cmpl	$1, (%rdx)
+	je	.L77
+	.loc 1 194 150 is_stmt 1 view .LVU314
+.LVL71:
+	.loc 1 194 63 view .LVU315
+	addl	$1, %eax
+.LVL72:
+	.loc 1 194 63 is_stmt 0 view .LVU316
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L78
+.LBE151:
+.LBE153:
+	.loc 1 387 15 view .LVU317
+	xorl	%esi, %esi
+.LVL73:
+.L79:
+	.loc 1 387 15 view .LVU318
+.LBE155:
+.LBE157:
+	.loc 1 434 5 is_stmt 1 view .LVU319
+	.loc 1 434 20 is_stmt 0 view .LVU320
+	movl	$1, %edi
+.LVL74:
+	.loc 1 434 20 view .LVU321
+	call	findSerialPort
+.LVL75:
+	.loc 1 435 5 is_stmt 1 view .LVU322
+	.loc 1 435 8 is_stmt 0 view .LVU323
+	testq	%rax, %rax
+	je	.L80
+.LVL76:
+.LBB158:
+.LBB159:
+	.loc 1 386 5 is_stmt 1 view .LVU324
+	.loc 1 389 5 view .LVU325
+	movdqa	functionConstraints(%rip), %xmm2
+	movl	16+functionConstraints(%rip), %eax
+.LVL77:
+	.loc 1 389 5 is_stmt 0 view .LVU326
+.LBE159:
+.LBE158:
+	.loc 1 440 20 view .LVU327
+	movl	$2, %edi
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+.LBB161:
+.LBB160:
+	.loc 1 389 5 view .LVU328
+	movaps	%xmm2, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU329
+	.loc 1 397 13 view .LVU330
+	.loc 1 398 13 view .LVU331
+	.loc 1 397 54 is_stmt 0 view .LVU332
+	movd	8(%r12), %xmm3
+	pshufd	$0xe0, %xmm3, %xmm0
+	movq	%xmm0, 4+configuredFunctionConstraint.1(%rip)
+	.loc 1 399 13 is_stmt 1 view .LVU333
+.LVL78:
+	.loc 1 399 13 is_stmt 0 view .LVU334
+.LBE160:
+.LBE161:
+	.loc 1 440 5 is_stmt 1 view .LVU335
+	.loc 1 440 20 is_stmt 0 view .LVU336
+	call	findSerialPort
+.LVL79:
+	.loc 1 441 5 is_stmt 1 view .LVU337
+	.loc 1 441 8 is_stmt 0 view .LVU338
+	testq	%rax, %rax
+	je	.L80
+	leaq	functionConstraints(%rip), %rdx
+	xorl	%eax, %eax
+.LVL80:
+	.p2align 4,,10
+	.p2align 3
+.L82:
+.LBB162:
+.LBB163:
+.LBB164:
+.LBB165:
+	.loc 1 195 9 is_stmt 1 view .LVU339
+	.loc 1 196 9 view .LVU340
+	.loc 1 196 12 is_stmt 0 view .LVU341
+	cmpl	$16, (%rdx)
+	je	.L81
+	.loc 1 194 150 is_stmt 1 view .LVU342
+.LVL81:
+	.loc 1 194 63 view .LVU343
+	addl	$1, %eax
+.LVL82:
+	.loc 1 194 63 is_stmt 0 view .LVU344
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L82
+.LBE165:
+.LBE164:
+	.loc 1 387 15 view .LVU345
+	xorl	%esi, %esi
+.LVL83:
+.L83:
+	.loc 1 387 15 view .LVU346
+.LBE163:
+.LBE162:
+	.loc 1 446 5 is_stmt 1 view .LVU347
+	.loc 1 446 20 is_stmt 0 view .LVU348
+	movl	$16, %edi
+	call	findSerialPort
+.LVL84:
+	.loc 1 447 9 view .LVU349
+	movl	$128, %edi
+	.loc 1 446 20 view .LVU350
+	movq	%rax, %r12
+.LVL85:
+	.loc 1 447 5 is_stmt 1 view .LVU351
+	.loc 1 447 9 is_stmt 0 view .LVU352
+	call	feature@PLT
+.LVL86:
+	.loc 1 447 30 view .LVU353
+	testq	%r12, %r12
+	jne	.L100
+	testb	%al, %al
+	jne	.L80
+.L100:
+	leaq	functionConstraints(%rip), %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L86:
+.LVL87:
+.LBB169:
+.LBB170:
+.LBB171:
+.LBB172:
+	.loc 1 195 9 is_stmt 1 view .LVU354
+	.loc 1 196 9 view .LVU355
+	.loc 1 196 12 is_stmt 0 view .LVU356
+	cmpl	$8, (%rdx)
+	je	.L85
+	.loc 1 194 150 is_stmt 1 view .LVU357
+.LVL88:
+	.loc 1 194 63 view .LVU358
+	addl	$1, %eax
+.LVL89:
+	.loc 1 194 63 is_stmt 0 view .LVU359
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L86
+.LBE172:
+.LBE171:
+	.loc 1 387 15 view .LVU360
+	xorl	%esi, %esi
+.LVL90:
+.L87:
+	.loc 1 387 15 view .LVU361
+.LBE170:
+.LBE169:
+	.loc 1 452 5 is_stmt 1 view .LVU362
+	.loc 1 452 20 is_stmt 0 view .LVU363
+	movl	$8, %edi
+	call	findSerialPort
+.LVL91:
+	.loc 1 453 9 view .LVU364
+	movl	$8, %edi
+	.loc 1 452 20 view .LVU365
+	movq	%rax, %r12
+.LVL92:
+	.loc 1 453 5 is_stmt 1 view .LVU366
+	.loc 1 453 9 is_stmt 0 view .LVU367
+	call	feature@PLT
+.LVL93:
+	.loc 1 453 36 view .LVU368
+	testq	%r12, %r12
+	jne	.L101
+	testb	%al, %al
+	jne	.L80
+.L101:
+	leaq	functionConstraints(%rip), %rdx
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L90:
+.LVL94:
+.LBB176:
+.LBB177:
+.LBB178:
+.LBB179:
+	.loc 1 195 9 is_stmt 1 view .LVU369
+	.loc 1 196 9 view .LVU370
+	.loc 1 196 12 is_stmt 0 view .LVU371
+	cmpl	$4, (%rdx)
+	je	.L89
+	.loc 1 194 150 is_stmt 1 view .LVU372
+.LVL95:
+	.loc 1 194 63 view .LVU373
+	addl	$1, %eax
+.LVL96:
+	.loc 1 194 63 is_stmt 0 view .LVU374
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L90
+.LBE179:
+.LBE178:
+	.loc 1 387 15 view .LVU375
+	xorl	%esi, %esi
+.LVL97:
+.L91:
+	.loc 1 387 15 view .LVU376
+.LBE177:
+.LBE176:
+	.loc 1 458 5 is_stmt 1 view .LVU377
+	.loc 1 458 20 is_stmt 0 view .LVU378
+	movl	$4, %edi
+	call	findSerialPort
+.LVL98:
+	.loc 1 459 9 view .LVU379
+	movl	$1024, %edi
+	.loc 1 458 20 view .LVU380
+	movq	%rax, %r12
+.LVL99:
+	.loc 1 459 5 is_stmt 1 view .LVU381
+	.loc 1 459 9 is_stmt 0 view .LVU382
+	call	feature@PLT
+.LVL100:
+	.loc 1 459 36 view .LVU383
+	testq	%r12, %r12
+	jne	.L102
+	testb	%al, %al
+	jne	.L80
+.L102:
+	xorl	%eax, %eax
+	.p2align 4,,10
+	.p2align 3
+.L94:
+.LVL101:
+.LBB183:
+.LBB184:
+.LBB185:
+.LBB186:
+	.loc 1 195 9 is_stmt 1 view .LVU384
+	.loc 1 196 9 view .LVU385
+	.loc 1 196 12 is_stmt 0 view .LVU386
+	cmpl	$64, 0(%rbp)
+	je	.L93
+	.loc 1 194 150 is_stmt 1 view .LVU387
+.LVL102:
+	.loc 1 194 63 view .LVU388
+	addl	$1, %eax
+.LVL103:
+	.loc 1 194 63 is_stmt 0 view .LVU389
+	addq	$20, %rbp
+	cmpl	$7, %eax
+	jne	.L94
+.LBE186:
+.LBE185:
+	.loc 1 387 15 view .LVU390
+	xorl	%esi, %esi
+	jmp	.L95
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.loc 1 386 5 is_stmt 1 view .LVU391
+	.loc 1 389 5 view .LVU392
+.LBB188:
+.LBB187:
+	.loc 1 195 28 is_stmt 0 view .LVU393
+	cltq
+	.loc 1 195 28 view .LVU394
+.LBE187:
+.LBE188:
+	.loc 1 423 12 view .LVU395
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+	.loc 1 389 5 view .LVU396
+	leaq	(%rax,%rax,4), %rax
+.LVL105:
+	.loc 1 389 5 view .LVU397
+	leaq	(%rbx,%rax,4), %rax
+	movdqu	(%rax), %xmm7
+	movl	16(%rax), %eax
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU398
+	.loc 1 389 5 is_stmt 0 view .LVU399
+	movaps	%xmm7, configuredFunctionConstraint.1(%rip)
+.LVL106:
+.L95:
+	.loc 1 389 5 view .LVU400
+.LBE184:
+.LBE183:
+	.loc 1 464 5 is_stmt 1 view .LVU401
+	.loc 1 464 20 is_stmt 0 view .LVU402
+	movl	$64, %edi
+	call	findSerialPort
+.LVL107:
+	.loc 1 465 9 view .LVU403
+	movl	$262144, %edi
+	.loc 1 464 20 view .LVU404
+	movq	%rax, %rbx
+.LVL108:
+	.loc 1 465 5 is_stmt 1 view .LVU405
+	.loc 1 465 9 is_stmt 0 view .LVU406
+	call	feature@PLT
+.LVL109:
+	.loc 1 465 35 view .LVU407
+	testq	%rbx, %rbx
+	jne	.L103
+	testb	%al, %al
+	je	.L103
+.LVL110:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 436 15 view .LVU408
+	xorl	%eax, %eax
+.L76:
+	.loc 1 485 1 view .LVU409
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL111:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.cfi_restore_state
+.LBB189:
+.LBB156:
+	.loc 1 386 5 is_stmt 1 view .LVU410
+	.loc 1 389 5 view .LVU411
+.LBB154:
+.LBB152:
+	.loc 1 195 28 is_stmt 0 view .LVU412
+	cltq
+	.loc 1 195 28 view .LVU413
+.LBE152:
+.LBE154:
+	.loc 1 423 12 view .LVU414
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+	.loc 1 389 5 view .LVU415
+	leaq	(%rax,%rax,4), %rax
+.LVL112:
+	.loc 1 389 5 view .LVU416
+	leaq	(%rbx,%rax,4), %rax
+	movdqu	(%rax), %xmm1
+	movl	16(%rax), %eax
+	movaps	%xmm1, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU417
+	.loc 1 393 13 view .LVU418
+	.loc 1 393 54 is_stmt 0 view .LVU419
+	movl	4(%r12), %eax
+	movl	%eax, 8+configuredFunctionConstraint.1(%rip)
+	.loc 1 394 13 is_stmt 1 view .LVU420
+	jmp	.L79
+.LVL113:
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	.loc 1 394 13 is_stmt 0 view .LVU421
+.LBE156:
+.LBE189:
+.LBB190:
+.LBB168:
+	.loc 1 386 5 is_stmt 1 view .LVU422
+	.loc 1 389 5 view .LVU423
+.LBB167:
+.LBB166:
+	.loc 1 195 28 is_stmt 0 view .LVU424
+	cltq
+	.loc 1 195 28 view .LVU425
+.LBE166:
+.LBE167:
+	.loc 1 423 12 view .LVU426
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+	.loc 1 389 5 view .LVU427
+	leaq	(%rax,%rax,4), %rax
+.LVL114:
+	.loc 1 389 5 view .LVU428
+	leaq	(%rbx,%rax,4), %rax
+	movdqu	(%rax), %xmm4
+	movl	16(%rax), %eax
+	movaps	%xmm4, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU429
+	.loc 1 418 13 view .LVU430
+	.loc 1 418 54 is_stmt 0 view .LVU431
+	movl	12(%r12), %eax
+	movl	%eax, 8+configuredFunctionConstraint.1(%rip)
+	.loc 1 419 13 is_stmt 1 view .LVU432
+	jmp	.L83
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	.loc 1 419 13 is_stmt 0 view .LVU433
+.LBE168:
+.LBE190:
+.LBB191:
+.LBB175:
+	.loc 1 386 5 is_stmt 1 view .LVU434
+	.loc 1 389 5 view .LVU435
+.LBB174:
+.LBB173:
+	.loc 1 195 28 is_stmt 0 view .LVU436
+	cltq
+	.loc 1 195 28 view .LVU437
+.LBE173:
+.LBE174:
+	.loc 1 423 12 view .LVU438
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+	.loc 1 389 5 view .LVU439
+	leaq	(%rax,%rax,4), %rax
+.LVL116:
+	.loc 1 389 5 view .LVU440
+	leaq	(%rbx,%rax,4), %rax
+	movdqu	(%rax), %xmm5
+	movl	16(%rax), %eax
+	movaps	%xmm5, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU441
+	jmp	.L87
+.LVL117:
+	.p2align 4,,10
+	.p2align 3
+.L89:
+	.loc 1 391 5 is_stmt 0 view .LVU442
+.LBE175:
+.LBE191:
+.LBB192:
+.LBB182:
+	.loc 1 386 5 is_stmt 1 view .LVU443
+	.loc 1 389 5 view .LVU444
+.LBB181:
+.LBB180:
+	.loc 1 195 28 is_stmt 0 view .LVU445
+	cltq
+	.loc 1 195 28 view .LVU446
+.LBE180:
+.LBE181:
+	.loc 1 423 12 view .LVU447
+	leaq	configuredFunctionConstraint.1(%rip), %rsi
+	.loc 1 389 5 view .LVU448
+	leaq	(%rax,%rax,4), %rax
+.LVL118:
+	.loc 1 389 5 view .LVU449
+	leaq	(%rbx,%rax,4), %rax
+	movdqu	(%rax), %xmm6
+	movl	16(%rax), %eax
+	movaps	%xmm6, configuredFunctionConstraint.1(%rip)
+	movl	%eax, 16+configuredFunctionConstraint.1(%rip)
+	.loc 1 391 5 is_stmt 1 view .LVU450
+	jmp	.L91
+.LVL119:
+	.p2align 4,,10
+	.p2align 3
+.L103:
+	.loc 1 391 5 is_stmt 0 view .LVU451
+.LBE182:
+.LBE192:
+	.loc 1 473 9 is_stmt 1 view .LVU452
+	.loc 1 473 12 is_stmt 0 view .LVU453
+	movl	16+serialPortFunctions(%rip), %eax
+	shrl	%eax
+	movl	%eax, %edx
+	.loc 1 484 11 view .LVU454
+	movl	$1, %eax
+	.loc 1 473 12 view .LVU455
+	andl	$1, %edx
+.LVL120:
+	.loc 1 478 9 is_stmt 1 view .LVU456
+	.loc 1 472 61 view .LVU457
+	.loc 1 472 43 view .LVU458
+	.loc 1 473 9 view .LVU459
+	.loc 1 473 12 is_stmt 0 view .LVU460
+	testb	$2, 40+serialPortFunctions(%rip)
+	je	.L76
+	.loc 1 474 13 is_stmt 1 view .LVU461
+.LVL121:
+	.loc 1 474 16 is_stmt 0 view .LVU462
+	cmpb	$1, %dl
+	je	.L80
+	.loc 1 485 1 view .LVU463
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL122:
+	.loc 1 485 1 view .LVU464
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	isSerialConfigValid, .-isSerialConfigValid
+	.section	.text.doesConfigurationUsePort,"ax",@progbits
+	.p2align 4
+	.globl	doesConfigurationUsePort
+	.type	doesConfigurationUsePort, @function
+doesConfigurationUsePort:
+.LVL123:
+.LFB28:
+	.loc 1 488 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 489 5 view .LVU466
+	.loc 1 490 5 view .LVU467
+	.loc 1 491 5 view .LVU468
+	.loc 1 493 5 view .LVU469
+	.loc 1 494 5 view .LVU470
+	.loc 1 494 27 view .LVU471
+	.loc 1 488 1 is_stmt 0 view .LVU472
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	functionConstraints(%rip), %rbx
+	leaq	140(%rbx), %r12
+	movq	%rbx, %r13
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+.LVL124:
+	.p2align 4,,10
+	.p2align 3
+.L135:
+	.loc 1 495 9 is_stmt 1 view .LVU473
+	.loc 1 495 18 is_stmt 0 view .LVU474
+	movl	0(%r13), %edi
+.LVL125:
+	.loc 1 496 9 is_stmt 1 view .LVU475
+.LBB193:
+.LBI193:
+	.loc 1 189 36 view .LVU476
+.LBB194:
+	.loc 1 191 5 view .LVU477
+	.loc 1 192 5 view .LVU478
+	.loc 1 194 5 view .LVU479
+	.loc 1 194 63 view .LVU480
+.LBE194:
+.LBE193:
+	.loc 1 495 18 is_stmt 0 view .LVU481
+	movq	%rbx, %rdx
+	xorl	%eax, %eax
+.LVL126:
+	.p2align 4,,10
+	.p2align 3
+.L132:
+.LBB197:
+.LBB195:
+	.loc 1 195 9 is_stmt 1 view .LVU482
+	.loc 1 196 9 view .LVU483
+	.loc 1 196 12 is_stmt 0 view .LVU484
+	cmpl	(%rdx), %edi
+	je	.L131
+	.loc 1 194 150 is_stmt 1 view .LVU485
+.LVL127:
+	.loc 1 194 63 view .LVU486
+	addl	$1, %eax
+.LVL128:
+	.loc 1 194 63 is_stmt 0 view .LVU487
+	addq	$20, %rdx
+	cmpl	$7, %eax
+	jne	.L132
+	.loc 1 200 11 view .LVU488
+	xorl	%esi, %esi
+.LVL129:
+	.loc 1 200 11 view .LVU489
+.LBE195:
+.LBE197:
+	.loc 1 497 9 is_stmt 1 view .LVU490
+	.loc 1 497 24 is_stmt 0 view .LVU491
+	call	findSerialPort
+.LVL130:
+	.loc 1 498 9 is_stmt 1 view .LVU492
+	.loc 1 498 41 is_stmt 0 view .LVU493
+	movq	16(%rax), %rax
+.LVL131:
+	.loc 1 498 12 view .LVU494
+	cmpl	%ebp, (%rax)
+	je	.L136
+.LVL132:
+.L140:
+	.loc 1 494 96 is_stmt 1 discriminator 2 view .LVU495
+	.loc 1 494 27 discriminator 2 view .LVU496
+	addq	$20, %r13
+.LVL133:
+	.loc 1 494 27 is_stmt 0 discriminator 2 view .LVU497
+	cmpq	%r12, %r13
+	jne	.L135
+	.loc 1 503 1 view .LVU498
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 502 11 view .LVU499
+	xorl	%eax, %eax
+	.loc 1 503 1 view .LVU500
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL134:
+	.loc 1 503 1 view .LVU501
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL135:
+	.loc 1 503 1 view .LVU502
+	ret
+.LVL136:
+	.p2align 4,,10
+	.p2align 3
+.L131:
+	.cfi_restore_state
+.LBB198:
+.LBB196:
+	.loc 1 195 28 view .LVU503
+	cltq
+.LVL137:
+	.loc 1 195 28 view .LVU504
+	leaq	(%rax,%rax,4), %rax
+.LVL138:
+	.loc 1 195 28 view .LVU505
+	leaq	(%rbx,%rax,4), %rsi
+.LVL139:
+	.loc 1 195 28 view .LVU506
+.LBE196:
+.LBE198:
+	.loc 1 497 9 is_stmt 1 view .LVU507
+	.loc 1 497 24 is_stmt 0 view .LVU508
+	call	findSerialPort
+.LVL140:
+	.loc 1 498 9 is_stmt 1 view .LVU509
+	.loc 1 498 41 is_stmt 0 view .LVU510
+	movq	16(%rax), %rax
+.LVL141:
+	.loc 1 498 12 view .LVU511
+	cmpl	%ebp, (%rax)
+	jne	.L140
+.LVL142:
+.L136:
+	.loc 1 503 1 view .LVU512
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	.loc 1 499 19 view .LVU513
+	movl	$1, %eax
+	.loc 1 503 1 view .LVU514
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL143:
+	.loc 1 503 1 view .LVU515
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL144:
+	.loc 1 503 1 view .LVU516
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	doesConfigurationUsePort, .-doesConfigurationUsePort
+	.section	.text.canOpenSerialPort,"ax",@progbits
+	.p2align 4
+	.globl	canOpenSerialPort
+	.type	canOpenSerialPort, @function
+canOpenSerialPort:
+.LVL145:
+.LFB29:
+	.loc 1 506 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 507 5 view .LVU518
+	.loc 1 506 1 is_stmt 0 view .LVU519
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 507 48 view .LVU520
+	call	getConfiguredFunctionConstraint
+.LVL146:
+	movq	%rax, %rsi
+.LVL147:
+	.loc 1 509 5 is_stmt 1 view .LVU521
+	.loc 1 509 40 is_stmt 0 view .LVU522
+	call	findSerialPort
+.LVL148:
+	.loc 1 510 5 is_stmt 1 view .LVU523
+	.loc 1 510 19 is_stmt 0 view .LVU524
+	testq	%rax, %rax
+	setne	%al
+.LVL149:
+	.loc 1 511 1 view .LVU525
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	canOpenSerialPort, .-canOpenSerialPort
+	.section	.text.isSerialPortFunctionShared,"ax",@progbits
+	.p2align 4
+	.globl	isSerialPortFunctionShared
+	.type	isSerialPortFunctionShared, @function
+isSerialPortFunctionShared:
+.LVL150:
+.LFB30:
+	.loc 1 514 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 515 5 view .LVU527
+	.loc 1 514 1 is_stmt 0 view .LVU528
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 514 1 view .LVU529
+	movl	%esi, %ebx
+	.loc 1 515 48 view .LVU530
+	call	getConfiguredFunctionConstraint
+.LVL151:
+	movq	%rax, %rsi
+.LVL152:
+	.loc 1 516 5 is_stmt 1 view .LVU531
+	.loc 1 516 40 is_stmt 0 view .LVU532
+	call	findSerialPort
+.LVL153:
+	.loc 1 517 5 is_stmt 1 view .LVU533
+	.loc 1 517 8 is_stmt 0 view .LVU534
+	testq	%rax, %rax
+	je	.L145
+	.loc 1 521 5 is_stmt 1 view .LVU535
+	.loc 1 521 32 is_stmt 0 view .LVU536
+	movq	8(%rax), %rax
+.LVL154:
+	.loc 1 521 43 view .LVU537
+	andl	16(%rax), %ebx
+	testw	%bx, %bx
+	.loc 1 522 1 view .LVU538
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 521 43 view .LVU539
+	setne	%al
+	.loc 1 522 1 view .LVU540
+	ret
+.LVL155:
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	.cfi_restore_state
+	.loc 1 518 15 view .LVU541
+	xorl	%eax, %eax
+.LVL156:
+	.loc 1 522 1 view .LVU542
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	isSerialPortFunctionShared, .-isSerialPortFunctionShared
+	.section	.text.applySerialConfigToPortFunctions,"ax",@progbits
+	.p2align 4
+	.globl	applySerialConfigToPortFunctions
+	.type	applySerialConfigToPortFunctions, @function
+applySerialConfigToPortFunctions:
+.LVL157:
+.LFB31:
+	.loc 1 525 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 526 5 view .LVU544
+	.loc 1 528 5 view .LVU545
+	.loc 1 528 61 view .LVU546
+.LBB199:
+.LBB200:
+.LBB201:
+	.loc 1 182 39 is_stmt 0 view .LVU547
+	movl	serialPortFunctions(%rip), %r8d
+	movl	24+serialPortFunctions(%rip), %r9d
+.LBE201:
+.LBE200:
+.LBE199:
+	.loc 1 528 31 view .LVU548
+	xorl	%eax, %eax
+	.loc 1 526 14 view .LVU549
+	xorl	%edx, %edx
+.LBB204:
+	.loc 1 533 53 view .LVU550
+	leaq	serialPortFunctions(%rip), %r11
+	.loc 1 533 74 view .LVU551
+	leaq	serialPortScenarios(%rip), %r10
+.LVL158:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+.LBB203:
+.LBB202:
+	.loc 1 181 27 is_stmt 1 view .LVU552
+	.loc 1 182 9 view .LVU553
+	.loc 1 182 12 is_stmt 0 view .LVU554
+	cmpl	%r8d, %eax
+	je	.L152
+	.loc 1 181 37 is_stmt 1 view .LVU555
+.LVL159:
+	.loc 1 181 27 view .LVU556
+	.loc 1 182 9 view .LVU557
+	.loc 1 182 12 is_stmt 0 view .LVU558
+	cmpl	%r9d, %eax
+	je	.L160
+.LVL160:
+.L151:
+	.loc 1 182 12 view .LVU559
+.LBE202:
+.LBE203:
+.LBE204:
+	.loc 1 528 99 is_stmt 1 discriminator 2 view .LVU560
+	addl	$1, %eax
+.LVL161:
+	.loc 1 528 61 discriminator 2 view .LVU561
+	cmpl	$4, %eax
+	ja	.L147
+	.loc 1 528 61 is_stmt 0 discriminator 2 view .LVU562
+	cmpl	$1, %edx
+	jbe	.L148
+.L147:
+	.loc 1 535 1 view .LVU563
+	ret
+.LVL162:
+	.p2align 4,,10
+	.p2align 3
+.L152:
+.LBB205:
+	.loc 1 529 18 view .LVU564
+	xorl	%ecx, %ecx
+.LVL163:
+.L150:
+	.loc 1 533 9 is_stmt 1 view .LVU565
+	.loc 1 533 109 is_stmt 0 view .LVU566
+	movl	%edx, %esi
+	.loc 1 533 53 view .LVU567
+	leaq	(%rcx,%rcx,2), %rcx
+	.loc 1 533 119 view .LVU568
+	addl	$1, %edx
+.LVL164:
+	.loc 1 533 74 view .LVU569
+	movzbl	(%rdi,%rsi), %esi
+	.loc 1 533 53 view .LVU570
+	movl	(%r10,%rsi,4), %esi
+	movl	%esi, 16(%r11,%rcx,8)
+	jmp	.L151
+.LVL165:
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.loc 1 529 18 view .LVU571
+	movl	$1, %ecx
+	jmp	.L150
+.LBE205:
+	.cfi_endproc
+.LFE31:
+	.size	applySerialConfigToPortFunctions, .-applySerialConfigToPortFunctions
+	.section	.text.unlikely.openSerialPort,"ax",@progbits
+.LCOLDB2:
+	.section	.text.openSerialPort,"ax",@progbits
+.LHOTB2:
+	.p2align 4
+	.globl	openSerialPort
+	.type	openSerialPort, @function
+openSerialPort:
+.LVL166:
+.LFB32:
+	.loc 1 538 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 539 5 view .LVU573
+	.loc 1 541 5 view .LVU574
+	.loc 1 538 1 is_stmt 0 view .LVU575
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%r8d, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movl	%ecx, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movl	%edi, %ebx
+	subq	$56, %rsp
+	.cfi_def_cfa_offset 112
+	.loc 1 541 55 view .LVU576
+	call	getConfiguredFunctionConstraint
+.LVL167:
+	.loc 1 543 5 is_stmt 1 view .LVU577
+	.loc 1 544 5 view .LVU578
+	movdqu	(%rax), %xmm1
+	movaps	%xmm1, 16(%rsp)
+	movl	16(%rax), %edx
+	movl	%edx, 32(%rsp)
+	.loc 1 545 5 view .LVU579
+	.loc 1 545 8 is_stmt 0 view .LVU580
+	movl	12(%rax), %edx
+	testl	%edx, %edx
+	jne	.L162
+	.loc 1 546 9 is_stmt 1 view .LVU581
+	.loc 1 547 9 view .LVU582
+	.loc 1 546 47 is_stmt 0 view .LVU583
+	movd	%r12d, %xmm2
+	pshufd	$0xe0, %xmm2, %xmm0
+	movq	%xmm0, 20(%rsp)
+.L162:
+	.loc 1 549 5 is_stmt 1 view .LVU584
+.LVL168:
+	.loc 1 551 5 view .LVU585
+	.loc 1 551 46 is_stmt 0 view .LVU586
+	leaq	16(%rsp), %rbp
+.LVL169:
+	.loc 1 551 46 view .LVU587
+	movl	%ebx, %edi
+.LVL170:
+	.loc 1 551 46 view .LVU588
+	movq	%rbp, %rsi
+.LVL171:
+	.loc 1 551 46 view .LVU589
+	call	findSerialPort
+.LVL172:
+	.loc 1 551 46 view .LVU590
+	movq	%rax, %r9
+.LVL173:
+	.loc 1 553 5 is_stmt 1 view .LVU591
+	.loc 1 553 24 view .LVU592
+	testq	%rax, %rax
+	jne	.L163
+	jmp	.L164
+.LVL174:
+	.p2align 4,,10
+	.p2align 3
+.L166:
+	.loc 1 555 9 view .LVU593
+	.loc 1 555 24 is_stmt 0 view .LVU594
+	movq	%r9, %rdx
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	findNextSerialPort
+.LVL175:
+	.loc 1 555 24 view .LVU595
+	movq	%rax, %r9
+.LVL176:
+	.loc 1 553 24 is_stmt 1 view .LVU596
+	testq	%rax, %rax
+	je	.L164
+.L163:
+	.loc 1 553 53 is_stmt 0 discriminator 1 view .LVU597
+	movq	8(%r9), %rax
+.LVL177:
+	.loc 1 553 24 discriminator 1 view .LVU598
+	cmpq	$0, 8(%rax)
+	jne	.L166
+	.loc 1 558 5 is_stmt 1 view .LVU599
+	.loc 1 562 5 view .LVU600
+.LVL178:
+	.loc 1 564 5 view .LVU601
+	.loc 1 566 5 view .LVU602
+	.loc 1 566 28 is_stmt 0 view .LVU603
+	movq	16(%r9), %rax
+	movl	(%rax), %ebp
+.LVL179:
+	.loc 1 567 5 is_stmt 1 view .LVU604
+	testl	%ebp, %ebp
+	je	.L186
+	cmpl	$1, %ebp
+	jne	.L164
+	.loc 1 580 26 is_stmt 0 view .LVU605
+	movl	%r15d, %r8d
+	movl	%r14d, %ecx
+	movl	%r12d, %edx
+	movq	%r13, %rsi
+	leaq	1+sitlUsart(%rip), %rdi
+	movq	%r9, 8(%rsp)
+	.loc 1 580 13 is_stmt 1 view .LVU606
+	.loc 1 580 26 is_stmt 0 view .LVU607
+	call	uartOpen@PLT
+.LVL180:
+	.loc 1 580 26 view .LVU608
+	movq	8(%rsp), %r9
+.LVL181:
+	.loc 1 581 13 is_stmt 1 view .LVU609
+.L170:
+	.loc 1 602 5 view .LVU610
+	.loc 1 602 8 is_stmt 0 view .LVU611
+	testq	%rax, %rax
+	je	.L164
+	.loc 1 606 5 is_stmt 1 view .LVU612
+	.loc 1 606 28 is_stmt 0 view .LVU613
+	movb	%bpl, 8(%rax)
+	.loc 1 608 5 is_stmt 1 view .LVU614
+	.loc 1 610 5 view .LVU615
+.LVL182:
+	.loc 1 612 5 view .LVU616
+	.loc 1 612 30 is_stmt 0 view .LVU617
+	movq	8(%r9), %rdx
+	movq	%rax, 8(%rdx)
+	.loc 1 615 5 is_stmt 1 view .LVU618
+.LVL183:
+.LBB206:
+.LBI206:
+	.loc 1 365 6 view .LVU619
+.LBB207:
+	.loc 1 367 5 view .LVU620
+.LBB208:
+.LBI208:
+	.loc 1 350 31 view .LVU621
+.LBB209:
+	.loc 1 352 5 view .LVU622
+	.loc 1 353 5 view .LVU623
+	.loc 1 355 5 view .LVU624
+	.loc 1 355 43 view .LVU625
+	.loc 1 356 9 view .LVU626
+	.loc 1 357 9 view .LVU627
+	.loc 1 357 12 is_stmt 0 view .LVU628
+	cmpq	8+serialPortFunctions(%rip), %rax
+	je	.L175
+	.loc 1 355 61 is_stmt 1 view .LVU629
+.LVL184:
+	.loc 1 355 43 view .LVU630
+	.loc 1 356 9 view .LVU631
+	.loc 1 357 9 view .LVU632
+	.loc 1 357 12 is_stmt 0 view .LVU633
+	cmpq	32+serialPortFunctions(%rip), %rax
+	jne	.L172
+	.loc 1 356 28 view .LVU634
+	leaq	24+serialPortFunctions(%rip), %rdx
+.LVL185:
+.L171:
+	.loc 1 356 28 view .LVU635
+.LBE209:
+.LBE208:
+	.loc 1 369 5 is_stmt 1 view .LVU636
+	.loc 1 369 41 is_stmt 0 view .LVU637
+	movl	%ebx, 20(%rdx)
+.LVL186:
+	.loc 1 369 41 view .LVU638
+.LBE207:
+.LBE206:
+	.loc 1 617 5 is_stmt 1 view .LVU639
+	.loc 1 617 12 is_stmt 0 view .LVU640
+	jmp	.L161
+.LVL187:
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.loc 1 559 15 view .LVU641
+	xorl	%eax, %eax
+.L161:
+	.loc 1 618 1 view .LVU642
+	addq	$56, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL188:
+	.loc 1 618 1 view .LVU643
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL189:
+	.loc 1 618 1 view .LVU644
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL190:
+	.loc 1 618 1 view .LVU645
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL191:
+	.loc 1 618 1 view .LVU646
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL192:
+	.loc 1 618 1 view .LVU647
+	ret
+.LVL193:
+	.p2align 4,,10
+	.p2align 3
+.L186:
+	.cfi_restore_state
+	.loc 1 575 26 view .LVU648
+	movl	%r15d, %r8d
+	movl	%r14d, %ecx
+	movl	%r12d, %edx
+	movq	%r13, %rsi
+	leaq	sitlUsart(%rip), %rdi
+	movq	%r9, 8(%rsp)
+	.loc 1 575 13 is_stmt 1 view .LVU649
+	.loc 1 575 26 is_stmt 0 view .LVU650
+	call	uartOpen@PLT
+.LVL194:
+	.loc 1 576 13 is_stmt 1 view .LVU651
+	movq	8(%rsp), %r9
+	jmp	.L170
+.LVL195:
+.L175:
+.LBB216:
+.LBB214:
+.LBB212:
+.LBB210:
+	.loc 1 356 28 is_stmt 0 view .LVU652
+	leaq	serialPortFunctions(%rip), %rdx
+.LVL196:
+	.loc 1 356 28 view .LVU653
+	jmp	.L171
+.LVL197:
+	.loc 1 356 28 view .LVU654
+.LBE210:
+.LBE212:
+.LBE214:
+.LBE216:
+	.cfi_endproc
+	.section	.text.unlikely.openSerialPort
+	.cfi_startproc
+	.type	openSerialPort.cold, @function
+openSerialPort.cold:
+.LFSB32:
+.LBB217:
+.LBB215:
+.LBB213:
+.LBB211:
+.L172:
+	.cfi_def_cfa_offset 112
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+.LVL198:
+	.loc 1 356 28 view -0
+.LBE211:
+.LBE213:
+	.loc 1 369 5 is_stmt 1 view .LVU656
+	.loc 1 369 41 is_stmt 0 view .LVU657
+	xorl	%eax, %eax
+.LVL199:
+	.loc 1 369 41 view .LVU658
+	movl	%eax, 20
+	ud2
+.LBE215:
+.LBE217:
+	.cfi_endproc
+.LFE32:
+	.section	.text.openSerialPort
+	.size	openSerialPort, .-openSerialPort
+	.section	.text.unlikely.openSerialPort
+	.size	openSerialPort.cold, .-openSerialPort.cold
+.LCOLDE2:
+	.section	.text.openSerialPort
+.LHOTE2:
+	.section	.text.serialInit,"ax",@progbits
+	.p2align 4
+	.globl	serialInit
+	.type	serialInit, @function
+serialInit:
+.LVL200:
+.LFB33:
+	.loc 1 621 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 622 5 view .LVU660
+	.loc 1 621 1 is_stmt 0 view .LVU661
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 622 18 view .LVU662
+	movq	%rdi, serialConfig(%rip)
+	.loc 1 623 5 is_stmt 1 view .LVU663
+	call	applySerialConfigToPortFunctions
+.LVL201:
+	.loc 1 625 5 view .LVU664
+	call	mspInit@PLT
+.LVL202:
+	.loc 1 626 5 view .LVU665
+	movq	serialConfig(%rip), %rdi
+	.loc 1 627 1 is_stmt 0 view .LVU666
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 626 5 view .LVU667
+	jmp	cliInit@PLT
+.LVL203:
+	.cfi_endproc
+.LFE33:
+	.size	serialInit, .-serialInit
+	.section	.text.handleSerial,"ax",@progbits
+	.p2align 4
+	.globl	handleSerial
+	.type	handleSerial, @function
+handleSerial:
+.LFB34:
+	.loc 1 630 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 632 5 view .LVU669
+	.loc 1 632 8 is_stmt 0 view .LVU670
+	cmpb	$0, cliMode(%rip)
+	jne	.L191
+	.loc 1 637 5 is_stmt 1 view .LVU671
+	jmp	mspProcess@PLT
+.LVL204:
+	.p2align 4,,10
+	.p2align 3
+.L191:
+	.loc 1 633 9 view .LVU672
+	jmp	cliProcess@PLT
+.LVL205:
+	.cfi_endproc
+.LFE34:
+	.size	handleSerial, .-handleSerial
+	.section	.text.waitForSerialPortToFinishTransmitting,"ax",@progbits
+	.p2align 4
+	.globl	waitForSerialPortToFinishTransmitting
+	.type	waitForSerialPortToFinishTransmitting, @function
+waitForSerialPortToFinishTransmitting:
+.LVL206:
+.LFB35:
+	.loc 1 641 1 view -0
+	.cfi_startproc
+	.loc 1 642 5 view .LVU674
+	.loc 1 641 1 is_stmt 0 view .LVU675
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 641 1 view .LVU676
+	movq	%rdi, %rbx
+	.loc 1 642 11 view .LVU677
+	jmp	.L193
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L194:
+	.loc 1 643 9 is_stmt 1 view .LVU678
+	movl	$10, %edi
+	call	delay@PLT
+.LVL208:
+.L193:
+	.loc 1 642 12 view .LVU679
+	.loc 1 642 13 is_stmt 0 view .LVU680
+	movq	%rbx, %rdi
+	call	isSerialTransmitBufferEmpty@PLT
+.LVL209:
+	.loc 1 642 12 view .LVU681
+	testb	%al, %al
+	je	.L194
+	.loc 1 645 1 view .LVU682
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL210:
+	.loc 1 645 1 view .LVU683
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	waitForSerialPortToFinishTransmitting, .-waitForSerialPortToFinishTransmitting
+	.section	.text.evaluateOtherData,"ax",@progbits
+	.p2align 4
+	.globl	evaluateOtherData
+	.type	evaluateOtherData, @function
+evaluateOtherData:
+.LVL211:
+.LFB36:
+	.loc 1 649 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 650 5 view .LVU685
+	.loc 1 650 8 is_stmt 0 view .LVU686
+	cmpb	$35, %dil
+	je	.L199
+	.loc 1 652 10 is_stmt 1 view .LVU687
+	.loc 1 652 32 is_stmt 0 view .LVU688
+	movq	serialConfig(%rip), %rax
+	.loc 1 652 13 view .LVU689
+	cmpb	%dil, 20(%rax)
+	je	.L200
+	.loc 1 654 1 view .LVU690
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.loc 1 651 9 is_stmt 1 view .LVU691
+	jmp	cliProcess@PLT
+.LVL212:
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	.loc 1 653 9 view .LVU692
+	jmp	systemResetToBootloader@PLT
+.LVL213:
+	.loc 1 653 9 is_stmt 0 view .LVU693
+	.cfi_endproc
+.LFE36:
+	.size	evaluateOtherData, .-evaluateOtherData
+	.section	.bss.serialPortSearchResult.0,"aw",@nobits
+	.align 32
+	.type	serialPortSearchResult.0, @object
+	.size	serialPortSearchResult.0, 40
+serialPortSearchResult.0:
+	.zero	40
+	.section	.bss.configuredFunctionConstraint.1,"aw",@nobits
+	.align 16
+	.type	configuredFunctionConstraint.1, @object
+	.size	configuredFunctionConstraint.1, 20
+configuredFunctionConstraint.1:
+	.zero	20
+	.section	.data.rel.ro.local.serialPortFunctionList,"aw"
+	.align 16
+	.type	serialPortFunctionList, @object
+	.size	serialPortFunctionList, 16
+serialPortFunctionList:
+	.byte	2
+	.zero	7
+	.quad	serialPortFunctions
+	.globl	functionConstraints
+	.section	.rodata.functionConstraints,"a"
+	.align 32
+	.type	functionConstraints, @object
+	.size	functionConstraints, 140
+functionConstraints:
+	.long	2
+	.long	9600
+	.long	115200
+	.long	0
+	.byte	0
+	.zero	3
+	.long	16
+	.long	9600
+	.long	115200
+	.long	1
+	.byte	0
+	.zero	3
+	.long	32
+	.long	9600
+	.long	115200
+	.long	0
+	.byte	0
+	.zero	3
+	.long	1
+	.long	9600
+	.long	115200
+	.long	0
+	.byte	0
+	.zero	3
+	.long	8
+	.long	9600
+	.long	115200
+	.long	0
+	.byte	3
+	.zero	3
+	.long	4
+	.long	9600
+	.long	19200
+	.long	0
+	.byte	0
+	.zero	3
+	.long	64
+	.long	115200
+	.long	115200
+	.long	0
+	.byte	0
+	.zero	3
+	.section	.rodata.serialPortConstraints,"a"
+	.align 32
+	.type	serialPortConstraints, @object
+	.size	serialPortConstraints, 32
+serialPortConstraints:
+	.long	0
+	.long	9600
+	.long	115200
+	.long	2
+	.long	1
+	.long	9600
+	.long	115200
+	.long	3
+	.section	.data.serialPortFunctions,"aw"
+	.align 32
+	.type	serialPortFunctions, @object
+	.size	serialPortFunctions, 48
+serialPortFunctions:
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.long	0
+	.long	1
+	.zero	4
+	.quad	0
+	.long	0
+	.long	0
+	.section	.bss.serialConfig,"aw",@nobits
+	.align 8
+	.type	serialConfig, @object
+	.size	serialConfig, 8
+serialConfig:
+	.zero	8
+	.globl	serialPortScenarios
+	.section	.rodata.serialPortScenarios,"a"
+	.align 32
+	.type	serialPortScenarios, @object
+	.size	serialPortScenarios, 40
+serialPortScenarios:
+	.long	0
+	.long	39
+	.long	16
+	.long	8
+	.long	4
+	.long	35
+	.long	2
+	.long	32
+	.long	1
+	.long	64
+	.text
+.Letext0:
+	.section	.text.unlikely.beginSerialPortFunction
+.Letext_cold0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 7 ".//src/main/common/ring_buffer.h"
+	.file 8 ".//src/main/drivers/serial.h"
+	.file 9 ".//src/main/io/serial_cli.h"
+	.file 10 ".//src/main/io/serial.h"
+	.file 11 ".//src/main/config/config.h"
+	.file 12 ".//src/main/drivers/system.h"
+	.file 13 ".//src/main/io/serial_msp.h"
+	.file 14 ".//src/main/drivers/serial_uart.h"
+	.file 15 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1b75
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x34
+	.long	.LASF1183
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL132
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF964
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF965
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF966
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF967
+	.uleb128 0x6
+	.long	.LASF969
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF968
+	.uleb128 0x6
+	.long	.LASF970
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF971
+	.uleb128 0x6
+	.long	.LASF972
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF973
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF974
+	.uleb128 0x36
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF975
+	.uleb128 0x6
+	.long	.LASF976
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF977
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x37
+	.long	0xab
+	.uleb128 0xf
+	.long	0xab
+	.uleb128 0x6
+	.long	.LASF978
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF979
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x6
+	.long	.LASF980
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF981
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF982
+	.uleb128 0x7
+	.long	0xf8
+	.uleb128 0x38
+	.uleb128 0x39
+	.byte	0x1
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x9
+	.long	0x110
+	.uleb128 0x1
+	.long	.LASF984
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF983
+	.byte	0x6
+	.byte	0x2c
+	.byte	0x3
+	.long	0xf9
+	.uleb128 0x15
+	.long	0x110
+	.long	0x12c
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1025
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x16
+	.long	0x11c
+	.uleb128 0x10
+	.long	.LASF1001
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x10
+	.long	0x187
+	.uleb128 0x1
+	.long	.LASF985
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x17
+	.long	0x187
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF986
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xe
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF987
+	.byte	0x7
+	.byte	0x1e
+	.byte	0xe
+	.long	0xc1
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF988
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0xc1
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF989
+	.byte	0x7
+	.byte	0x20
+	.byte	0xe
+	.long	0xc1
+	.byte	0xe
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x6
+	.long	.LASF990
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x138
+	.uleb128 0x13
+	.long	0x43
+	.byte	0x8
+	.byte	0x16
+	.long	0x1b0
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF993
+	.byte	0x8
+	.byte	0x19
+	.byte	0x3
+	.long	0x198
+	.uleb128 0x3a
+	.long	.LASF998
+	.byte	0x7
+	.byte	0x4
+	.long	0x43
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xe
+	.long	0x1e7
+	.uleb128 0x2
+	.long	.LASF994
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF995
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF996
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF997
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF998
+	.byte	0x8
+	.byte	0x20
+	.byte	0x3
+	.long	0x1bc
+	.uleb128 0x6
+	.long	.LASF999
+	.byte	0x8
+	.byte	0x22
+	.byte	0x10
+	.long	0x1ff
+	.uleb128 0x7
+	.long	0x204
+	.uleb128 0x18
+	.long	0x20f
+	.uleb128 0x4
+	.long	0xc1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1000
+	.byte	0x8
+	.byte	0x23
+	.byte	0x10
+	.long	0x21b
+	.uleb128 0x7
+	.long	0x220
+	.uleb128 0x18
+	.long	0x230
+	.uleb128 0x4
+	.long	0x230
+	.uleb128 0x4
+	.long	0xab
+	.byte	0
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF1002
+	.byte	0x40
+	.byte	0x8
+	.byte	0x25
+	.byte	0x10
+	.long	0x2ab
+	.uleb128 0x1
+	.long	.LASF1003
+	.byte	0x8
+	.byte	0x27
+	.byte	0x24
+	.long	0x34d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0x8
+	.byte	0x29
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1005
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x10
+	.long	0x1e7
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1006
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x17
+	.long	0x1b0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1007
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xe
+	.long	0xcd
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1008
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x12
+	.long	0x18c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1009
+	.byte	0x8
+	.byte	0x30
+	.byte	0x12
+	.long	0x18c
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1010
+	.byte	0x8
+	.byte	0x33
+	.byte	0x1e
+	.long	0x1f3
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1011
+	.byte	0x58
+	.byte	0x8
+	.byte	0x36
+	.byte	0x8
+	.long	0x348
+	.uleb128 0x1
+	.long	.LASF1012
+	.byte	0x8
+	.byte	0x37
+	.byte	0xc
+	.long	0x373
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1013
+	.byte	0x8
+	.byte	0x39
+	.byte	0x10
+	.long	0x387
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1014
+	.byte	0x8
+	.byte	0x3b
+	.byte	0xf
+	.long	0x39b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1015
+	.byte	0x8
+	.byte	0x3e
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1016
+	.byte	0x8
+	.byte	0x40
+	.byte	0xb
+	.long	0x3cb
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1017
+	.byte	0x8
+	.byte	0x42
+	.byte	0xc
+	.long	0x3e0
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1018
+	.byte	0x8
+	.byte	0x45
+	.byte	0xb
+	.long	0x3f9
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1019
+	.byte	0x8
+	.byte	0x47
+	.byte	0xc
+	.long	0x413
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1020
+	.byte	0x8
+	.byte	0x49
+	.byte	0x10
+	.long	0x436
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1021
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x10
+	.long	0x44f
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1022
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x50
+	.byte	0
+	.uleb128 0xf
+	.long	0x2ab
+	.uleb128 0x7
+	.long	0x348
+	.uleb128 0x6
+	.long	.LASF1023
+	.byte	0x8
+	.byte	0x34
+	.byte	0x3
+	.long	0x235
+	.uleb128 0x18
+	.long	0x36e
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0xab
+	.byte	0
+	.uleb128 0x7
+	.long	0x352
+	.uleb128 0x7
+	.long	0x35e
+	.uleb128 0x19
+	.long	0xcd
+	.long	0x387
+	.uleb128 0x4
+	.long	0x36e
+	.byte	0
+	.uleb128 0x7
+	.long	0x378
+	.uleb128 0x19
+	.long	0xab
+	.long	0x39b
+	.uleb128 0x4
+	.long	0x36e
+	.byte	0
+	.uleb128 0x7
+	.long	0x38c
+	.uleb128 0x18
+	.long	0x3b0
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	0x3a0
+	.uleb128 0x19
+	.long	0x3c4
+	.long	0x3c4
+	.uleb128 0x4
+	.long	0x36e
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1024
+	.uleb128 0x7
+	.long	0x3b5
+	.uleb128 0x18
+	.long	0x3e0
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0x1e7
+	.byte	0
+	.uleb128 0x7
+	.long	0x3d0
+	.uleb128 0x19
+	.long	0x3c4
+	.long	0x3f9
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0x20f
+	.byte	0
+	.uleb128 0x7
+	.long	0x3e5
+	.uleb128 0x18
+	.long	0x413
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0x230
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	0x3fe
+	.uleb128 0x19
+	.long	0xcd
+	.long	0x431
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0x431
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	0xab
+	.uleb128 0x7
+	.long	0x418
+	.uleb128 0x19
+	.long	0x431
+	.long	0x44f
+	.uleb128 0x4
+	.long	0x36e
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x7
+	.long	0x43b
+	.uleb128 0x7
+	.long	0x110
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x9
+	.byte	0x15
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x14
+	.long	0x4a1
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1028
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1035
+	.byte	0xa
+	.byte	0x1d
+	.byte	0x3
+	.long	0x465
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x1f
+	.long	0x4c5
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1038
+	.byte	0xa
+	.byte	0x22
+	.byte	0x3
+	.long	0x4ad
+	.uleb128 0x10
+	.long	.LASF1039
+	.byte	0x14
+	.byte	0xa
+	.byte	0x24
+	.byte	0x10
+	.long	0x520
+	.uleb128 0x1
+	.long	.LASF1040
+	.byte	0xa
+	.byte	0x25
+	.byte	0x1a
+	.long	0x4a1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0xa
+	.byte	0x26
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1042
+	.byte	0xa
+	.byte	0x27
+	.byte	0xe
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1043
+	.byte	0xa
+	.byte	0x28
+	.byte	0x10
+	.long	0x4c5
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1044
+	.byte	0xa
+	.byte	0x29
+	.byte	0xd
+	.long	0xab
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1045
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x3
+	.long	0x4d1
+	.uleb128 0xf
+	.long	0x520
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x2c
+	.long	0x579
+	.uleb128 0x2
+	.long	.LASF1046
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1047
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1048
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1049
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1050
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1051
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF1052
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF1053
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1054
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1055
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1056
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0x531
+	.uleb128 0xf
+	.long	0x579
+	.uleb128 0x15
+	.long	0x585
+	.long	0x59a
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0xf
+	.long	0x58a
+	.uleb128 0x29
+	.long	.LASF1057
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x2b
+	.long	0x59a
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x3e
+	.long	0x5c3
+	.uleb128 0x2
+	.long	.LASF1058
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1059
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1060
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x3
+	.long	0x5ab
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x5a
+	.long	0x5f9
+	.uleb128 0x2
+	.long	.LASF1061
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1062
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1063
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1064
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1065
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1066
+	.byte	0xa
+	.byte	0x60
+	.byte	0x3
+	.long	0x5cf
+	.uleb128 0xf
+	.long	0x5f9
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xa
+	.byte	0x66
+	.long	0x62e
+	.uleb128 0x2
+	.long	.LASF1067
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1068
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1069
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1071
+	.byte	0xa
+	.byte	0x6b
+	.byte	0x3
+	.long	0x60a
+	.uleb128 0x10
+	.long	.LASF1072
+	.byte	0x10
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x10
+	.long	0x67c
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0xa
+	.byte	0x6e
+	.byte	0x22
+	.long	0x605
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0xa
+	.byte	0x6f
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1042
+	.byte	0xa
+	.byte	0x70
+	.byte	0xe
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0xa
+	.byte	0x71
+	.byte	0x19
+	.long	0x62e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1074
+	.byte	0xa
+	.byte	0x72
+	.byte	0x3
+	.long	0x63a
+	.uleb128 0xf
+	.long	0x67c
+	.uleb128 0x10
+	.long	.LASF1075
+	.byte	0x18
+	.byte	0xa
+	.byte	0x74
+	.byte	0x10
+	.long	0x6cf
+	.uleb128 0x1
+	.long	.LASF1004
+	.byte	0xa
+	.byte	0x75
+	.byte	0x1c
+	.long	0x5f9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1076
+	.byte	0xa
+	.byte	0x76
+	.byte	0x13
+	.long	0x36e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1077
+	.byte	0xa
+	.byte	0x77
+	.byte	0x22
+	.long	0x579
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0xa
+	.byte	0x78
+	.byte	0x1a
+	.long	0x4a1
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1079
+	.byte	0xa
+	.byte	0x79
+	.byte	0x3
+	.long	0x68d
+	.uleb128 0x10
+	.long	.LASF1080
+	.byte	0x10
+	.byte	0xa
+	.byte	0x7b
+	.byte	0x10
+	.long	0x703
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0xa
+	.byte	0x7c
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0xa
+	.byte	0x7d
+	.byte	0x1b
+	.long	0x703
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x6cf
+	.uleb128 0x6
+	.long	.LASF1083
+	.byte	0xa
+	.byte	0x7e
+	.byte	0x3
+	.long	0x6db
+	.uleb128 0xf
+	.long	0x708
+	.uleb128 0x10
+	.long	.LASF1084
+	.byte	0x18
+	.byte	0xa
+	.byte	0x80
+	.byte	0x10
+	.long	0x775
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0x775
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0xa
+	.byte	0x82
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0xa
+	.byte	0x83
+	.byte	0xe
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1088
+	.byte	0xa
+	.byte	0x84
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0xa
+	.byte	0x85
+	.byte	0xe
+	.long	0xcd
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0xa
+	.byte	0x87
+	.byte	0xd
+	.long	0xab
+	.byte	0x14
+	.byte	0
+	.uleb128 0x15
+	.long	0xab
+	.long	0x785
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1091
+	.byte	0xa
+	.byte	0x88
+	.byte	0x3
+	.long	0x719
+	.uleb128 0x13
+	.long	0x43
+	.byte	0xb
+	.byte	0x14
+	.long	0x820
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1094
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1095
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1096
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1097
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1098
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1099
+	.byte	0x80
+	.uleb128 0x14
+	.long	.LASF1100
+	.value	0x100
+	.uleb128 0x14
+	.long	.LASF1101
+	.value	0x200
+	.uleb128 0x14
+	.long	.LASF1102
+	.value	0x400
+	.uleb128 0x14
+	.long	.LASF1103
+	.value	0x800
+	.uleb128 0x14
+	.long	.LASF1104
+	.value	0x1000
+	.uleb128 0x14
+	.long	.LASF1105
+	.value	0x2000
+	.uleb128 0x14
+	.long	.LASF1106
+	.value	0x4000
+	.uleb128 0x14
+	.long	.LASF1107
+	.value	0x8000
+	.uleb128 0x2a
+	.long	.LASF1108
+	.long	0x10000
+	.uleb128 0x2a
+	.long	.LASF1109
+	.long	0x20000
+	.uleb128 0x2a
+	.long	.LASF1110
+	.long	0x40000
+	.byte	0
+	.uleb128 0x3b
+	.long	0x59f
+	.byte	0x1
+	.byte	0x30
+	.byte	0x24
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortScenarios
+	.uleb128 0x24
+	.long	.LASF1111
+	.byte	0x41
+	.byte	0x18
+	.long	0x847
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialConfig
+	.uleb128 0x7
+	.long	0x785
+	.uleb128 0x15
+	.long	0x36e
+	.long	0x85c
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1159
+	.byte	0x42
+	.byte	0x16
+	.long	0x84c
+	.uleb128 0x15
+	.long	0x6cf
+	.long	0x877
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1112
+	.byte	0x67
+	.byte	0x1d
+	.long	0x867
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortFunctions
+	.uleb128 0x15
+	.long	0x688
+	.long	0x89c
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0xf
+	.long	0x88c
+	.uleb128 0x24
+	.long	.LASF1113
+	.byte	0x70
+	.byte	0x25
+	.long	0x89c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortConstraints
+	.uleb128 0x15
+	.long	0x52c
+	.long	0x8c6
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.long	0x8b6
+	.uleb128 0x3c
+	.long	.LASF1114
+	.byte	0x1
+	.byte	0x7b
+	.byte	0x1c
+	.long	0x8c6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	functionConstraints
+	.uleb128 0x10
+	.long	.LASF1115
+	.byte	0x28
+	.byte	0x1
+	.byte	0x87
+	.byte	0x10
+	.long	0x930
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0x1
+	.byte	0x88
+	.byte	0x17
+	.long	0x5c3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0x1
+	.byte	0x89
+	.byte	0x1b
+	.long	0x703
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0x1
+	.byte	0x8a
+	.byte	0x23
+	.long	0x930
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x1
+	.byte	0x8b
+	.byte	0x21
+	.long	0x935
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x1
+	.byte	0x8e
+	.byte	0xd
+	.long	0xab
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x688
+	.uleb128 0x7
+	.long	0x52c
+	.uleb128 0x6
+	.long	.LASF1121
+	.byte	0x1
+	.byte	0x8f
+	.byte	0x3
+	.long	0x8e1
+	.uleb128 0x24
+	.long	.LASF1122
+	.byte	0x91
+	.byte	0x27
+	.long	0x714
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortFunctionList
+	.uleb128 0x2b
+	.long	.LASF1123
+	.byte	0xc
+	.byte	0x23
+	.uleb128 0x1b
+	.long	.LASF1016
+	.byte	0x8
+	.byte	0x56
+	.byte	0x5
+	.long	0x3c4
+	.long	0x978
+	.uleb128 0x4
+	.long	0x36e
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1126
+	.byte	0xc
+	.byte	0x16
+	.long	0x989
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1124
+	.byte	0xd
+	.byte	0x1d
+	.uleb128 0x2b
+	.long	.LASF1125
+	.byte	0x9
+	.byte	0x17
+	.uleb128 0x2c
+	.long	.LASF1127
+	.byte	0x1
+	.byte	0x2d
+	.long	0x9a8
+	.uleb128 0x4
+	.long	0x847
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1128
+	.byte	0x1
+	.byte	0x2c
+	.long	0x9b9
+	.uleb128 0x4
+	.long	0x847
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1129
+	.byte	0xe
+	.byte	0x36
+	.byte	0xf
+	.long	0x36e
+	.long	0x9e3
+	.uleb128 0x4
+	.long	0x454
+	.uleb128 0x4
+	.long	0x1f3
+	.uleb128 0x4
+	.long	0xcd
+	.uleb128 0x4
+	.long	0x1e7
+	.uleb128 0x4
+	.long	0x1b0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1130
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xa03
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1073
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x5
+	.long	0x3c4
+	.long	0xa19
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1131
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xe
+	.long	0x96
+	.long	0xa39
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0xf3
+	.uleb128 0x4
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1132
+	.value	0x288
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa85
+	.uleb128 0x3d
+	.string	"sr"
+	.byte	0x1
+	.value	0x288
+	.byte	0x20
+	.long	0xab
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x1d
+	.quad	.LVL212
+	.long	0x990
+	.uleb128 0x1d
+	.quad	.LVL213
+	.long	0x95b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1133
+	.value	0x280
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xae2
+	.uleb128 0xc
+	.long	.LASF1002
+	.value	0x280
+	.byte	0x3a
+	.long	0x36e
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0xa
+	.quad	.LVL208
+	.long	0x978
+	.long	0xacd
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL209
+	.long	0x962
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1134
+	.value	0x275
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb1a
+	.uleb128 0x1d
+	.quad	.LVL204
+	.long	0x989
+	.uleb128 0x1d
+	.quad	.LVL205
+	.long	0x990
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1135
+	.value	0x26c
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb8a
+	.uleb128 0xc
+	.long	.LASF1136
+	.value	0x26c
+	.byte	0x21
+	.long	0x847
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xa
+	.quad	.LVL201
+	.long	0xdee
+	.long	0xb63
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL202
+	.long	0x9a8
+	.long	0xb7c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL203
+	.long	0x997
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1137
+	.byte	0x1
+	.value	0x219
+	.byte	0xf
+	.long	0x36e
+	.long	.LLRL107
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xde4
+	.uleb128 0xc
+	.long	.LASF1040
+	.value	0x219
+	.byte	0x33
+	.long	0x4a1
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0xc
+	.long	.LASF1010
+	.value	0x219
+	.byte	0x56
+	.long	0x1f3
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xc
+	.long	.LASF1007
+	.value	0x219
+	.byte	0x69
+	.long	0xcd
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0xc
+	.long	.LASF1005
+	.value	0x219
+	.byte	0x7e
+	.long	0x1e7
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0xc
+	.long	.LASF1006
+	.value	0x219
+	.byte	0x96
+	.long	0x1b0
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x9
+	.long	.LASF1002
+	.value	0x21b
+	.byte	0x13
+	.long	0x36e
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x9
+	.long	.LASF1138
+	.value	0x21d
+	.byte	0x1b
+	.long	0xde4
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x25
+	.long	.LASF1139
+	.value	0x21f
+	.byte	0x1a
+	.long	0x520
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x225
+	.byte	0x1b
+	.long	0xde4
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x9
+	.long	.LASF1140
+	.value	0x227
+	.byte	0x1f
+	.long	0xde9
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x9
+	.long	.LASF1116
+	.value	0x232
+	.byte	0x17
+	.long	0x5c3
+	.long	.LLST117
+	.long	.LVUS117
+	.uleb128 0x9
+	.long	.LASF1141
+	.value	0x234
+	.byte	0x23
+	.long	0x930
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x9
+	.long	.LASF1004
+	.value	0x236
+	.byte	0x1c
+	.long	0x5f9
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x9
+	.long	.LASF1142
+	.value	0x262
+	.byte	0x1b
+	.long	0x703
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x26
+	.long	0x14f5
+	.quad	.LBI206
+	.byte	.LVU619
+	.long	.LLRL121
+	.value	0x267
+	.byte	0x5
+	.long	0xd3f
+	.uleb128 0xb
+	.long	0x150f
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0xb
+	.long	0x1503
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x8
+	.long	.LLRL121
+	.uleb128 0x3
+	.long	0x151b
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x1f
+	.long	0x1528
+	.quad	.LBI208
+	.byte	.LVU621
+	.long	.LLRL125
+	.value	0x16f
+	.byte	0x30
+	.uleb128 0xb
+	.long	0x1538
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x8
+	.long	.LLRL125
+	.uleb128 0x3
+	.long	0x1544
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x3
+	.long	0x1550
+	.long	.LLST128
+	.long	.LVUS128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL167
+	.long	0x142d
+	.long	0xd57
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL172
+	.long	0x164b
+	.long	0xd75
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL175
+	.long	0x1822
+	.long	0xd93
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL180
+	.long	0x9b9
+	.long	0xdbd
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL194
+	.long	0x9b9
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x520
+	.uleb128 0x7
+	.long	0x93a
+	.uleb128 0x1c
+	.long	.LASF1143
+	.value	0x20c
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe7b
+	.uleb128 0x27
+	.long	.LASF1111
+	.value	0x20c
+	.byte	0x37
+	.long	0x847
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.long	.LASF1116
+	.value	0x20e
+	.byte	0xe
+	.long	0xcd
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x9
+	.long	.LASF1144
+	.value	0x20e
+	.byte	0x1d
+	.long	0xcd
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x8
+	.long	.LLRL104
+	.uleb128 0x25
+	.long	.LASF1145
+	.value	0x211
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1a
+	.long	0x19e9
+	.long	.LLRL105
+	.value	0x211
+	.byte	0x22
+	.uleb128 0xe
+	.long	0x19f8
+	.uleb128 0x8
+	.long	.LLRL105
+	.uleb128 0x3
+	.long	0x1a03
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1149
+	.value	0x201
+	.byte	0x5
+	.long	0x3c4
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf1b
+	.uleb128 0xc
+	.long	.LASF1146
+	.value	0x201
+	.byte	0x35
+	.long	0x4a1
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xc
+	.long	.LASF1147
+	.value	0x201
+	.byte	0x4d
+	.long	0xc1
+	.long	.LLST99
+	.long	.LVUS99
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x203
+	.byte	0x1b
+	.long	0xde4
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x9
+	.long	.LASF1148
+	.value	0x204
+	.byte	0x1f
+	.long	0xde9
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0xa
+	.quad	.LVL151
+	.long	0x142d
+	.long	0xf05
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL153
+	.long	0x164b
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1150
+	.value	0x1f9
+	.byte	0x5
+	.long	0x3c4
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfa7
+	.uleb128 0xc
+	.long	.LASF1040
+	.value	0x1f9
+	.byte	0x2c
+	.long	0x4a1
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x1fb
+	.byte	0x1b
+	.long	0xde4
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x9
+	.long	.LASF1148
+	.value	0x1fd
+	.byte	0x1f
+	.long	0xde9
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0xa
+	.quad	.LVL146
+	.long	0x142d
+	.long	0xf91
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL148
+	.long	0x164b
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1151
+	.value	0x1e7
+	.byte	0x5
+	.long	0x3c4
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1099
+	.uleb128 0xc
+	.long	.LASF1152
+	.value	0x1e7
+	.byte	0x35
+	.long	0x5f9
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x9
+	.long	.LASF1140
+	.value	0x1e9
+	.byte	0x1f
+	.long	0xde9
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x1ea
+	.byte	0x21
+	.long	0x935
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x9
+	.long	.LASF1040
+	.value	0x1eb
+	.byte	0x1a
+	.long	0x4a1
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x9
+	.long	.LASF984
+	.value	0x1ed
+	.byte	0xd
+	.long	0xab
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x26
+	.long	0x19b8
+	.quad	.LBI193
+	.byte	.LVU476
+	.long	.LLRL91
+	.value	0x1f0
+	.byte	0x1e
+	.long	0x1074
+	.uleb128 0xb
+	.long	0x19c7
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x8
+	.long	.LLRL91
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST93
+	.long	.LVUS93
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST94
+	.long	.LVUS94
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL130
+	.long	0x164b
+	.long	0x108b
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3f
+	.quad	.LVL140
+	.long	0x164b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1153
+	.value	0x1aa
+	.byte	0x5
+	.long	0x3c4
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x142d
+	.uleb128 0xc
+	.long	.LASF1154
+	.value	0x1aa
+	.byte	0x29
+	.long	0x847
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x9
+	.long	.LASF1140
+	.value	0x1ac
+	.byte	0x1f
+	.long	0xde9
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x1ad
+	.byte	0x1b
+	.long	0xde4
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x9
+	.long	.LASF1145
+	.value	0x1d5
+	.byte	0xd
+	.long	0xab
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x9
+	.long	.LASF1155
+	.value	0x1d6
+	.byte	0xd
+	.long	0xab
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x9
+	.long	.LASF1156
+	.value	0x1d7
+	.byte	0xd
+	.long	0xab
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x26
+	.long	0x142d
+	.quad	.LBI147
+	.byte	.LVU306
+	.long	.LLRL59
+	.value	0x1b1
+	.byte	0x1a
+	.long	0x119f
+	.uleb128 0xb
+	.long	0x143f
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x8
+	.long	.LLRL59
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x1a
+	.long	0x19b8
+	.long	.LLRL62
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xe
+	.long	0x19c7
+	.uleb128 0x8
+	.long	.LLRL62
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x142d
+	.long	.LLRL65
+	.value	0x1b7
+	.long	0x11c7
+	.uleb128 0xe
+	.long	0x143f
+	.uleb128 0x8
+	.long	.LLRL65
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST66
+	.long	.LVUS66
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x142d
+	.long	.LLRL67
+	.value	0x1bd
+	.long	0x1221
+	.uleb128 0xe
+	.long	0x143f
+	.uleb128 0x8
+	.long	.LLRL67
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x1a
+	.long	0x19b8
+	.long	.LLRL69
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xe
+	.long	0x19c7
+	.uleb128 0x8
+	.long	.LLRL69
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x142d
+	.long	.LLRL72
+	.value	0x1c3
+	.long	0x127b
+	.uleb128 0xe
+	.long	0x143f
+	.uleb128 0x8
+	.long	.LLRL72
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x1a
+	.long	0x19b8
+	.long	.LLRL74
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xe
+	.long	0x19c7
+	.uleb128 0x8
+	.long	.LLRL74
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	0x142d
+	.long	.LLRL77
+	.value	0x1c9
+	.long	0x12d5
+	.uleb128 0xe
+	.long	0x143f
+	.uleb128 0x8
+	.long	.LLRL77
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x1a
+	.long	0x19b8
+	.long	.LLRL79
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xe
+	.long	0x19c7
+	.uleb128 0x8
+	.long	.LLRL79
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	0x142d
+	.quad	.LBB183
+	.quad	.LBE183-.LBB183
+	.byte	0x1
+	.value	0x1cf
+	.byte	0x1a
+	.long	0x1337
+	.uleb128 0xe
+	.long	0x143f
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x1a
+	.long	0x19b8
+	.long	.LLRL83
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xe
+	.long	0x19c7
+	.uleb128 0x8
+	.long	.LLRL83
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST85
+	.long	.LVUS85
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL75
+	.long	0x164b
+	.long	0x134e
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL79
+	.long	0x164b
+	.long	0x1372
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configuredFunctionConstraint.1
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL84
+	.long	0x164b
+	.long	0x1389
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL86
+	.long	0xa03
+	.long	0x13a1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL91
+	.long	0x164b
+	.long	0x13b8
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL93
+	.long	0xa03
+	.long	0x13cf
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL98
+	.long	0x164b
+	.long	0x13e6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL100
+	.long	0xa03
+	.long	0x13ff
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x400
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL107
+	.long	0x164b
+	.long	0x1417
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LVL109
+	.long	0xa03
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3e
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	.LASF1157
+	.byte	0x1
+	.value	0x17c
+	.byte	0x17
+	.long	0xde4
+	.byte	0x1
+	.long	0x146e
+	.uleb128 0x21
+	.long	.LASF1040
+	.value	0x17c
+	.byte	0x4c
+	.long	0x4a1
+	.uleb128 0x25
+	.long	.LASF1158
+	.value	0x17e
+	.byte	0x21
+	.long	0x520
+	.uleb128 0x9
+	.byte	0x3
+	.quad	configuredFunctionConstraint.1
+	.uleb128 0x12
+	.long	.LASF1119
+	.value	0x17f
+	.byte	0x21
+	.long	0x935
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1184
+	.byte	0x1
+	.value	0x174
+	.byte	0x6
+	.long	.LLRL42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14f5
+	.uleb128 0x27
+	.long	.LASF1076
+	.value	0x174
+	.byte	0x2a
+	.long	0x36e
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x27
+	.long	.LASF1040
+	.value	0x174
+	.byte	0x45
+	.long	0x4a1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.long	.LASF1142
+	.value	0x177
+	.byte	0x1b
+	.long	0x703
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x1f
+	.long	0x1528
+	.quad	.LBI109
+	.byte	.LVU227
+	.long	.LLRL44
+	.value	0x177
+	.byte	0x30
+	.uleb128 0xb
+	.long	0x1538
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x8
+	.long	.LLRL44
+	.uleb128 0x3
+	.long	0x1544
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x3
+	.long	0x1550
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1160
+	.byte	0x1
+	.value	0x16d
+	.byte	0x6
+	.byte	0x1
+	.long	0x1528
+	.uleb128 0x21
+	.long	.LASF1076
+	.value	0x16d
+	.byte	0x2c
+	.long	0x36e
+	.uleb128 0x21
+	.long	.LASF1040
+	.value	0x16d
+	.byte	0x47
+	.long	0x4a1
+	.uleb128 0x12
+	.long	.LASF1142
+	.value	0x16f
+	.byte	0x1b
+	.long	0x703
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF1162
+	.value	0x15e
+	.byte	0x1f
+	.long	0x703
+	.long	0x155d
+	.uleb128 0x21
+	.long	.LASF1076
+	.value	0x15e
+	.byte	0x4a
+	.long	0x36e
+	.uleb128 0x12
+	.long	.LASF1142
+	.value	0x160
+	.byte	0x1b
+	.long	0x703
+	.uleb128 0x12
+	.long	.LASF1145
+	.value	0x161
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1161
+	.value	0x153
+	.byte	0xf
+	.long	0x36e
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1602
+	.uleb128 0x27
+	.long	.LASF1147
+	.value	0x153
+	.byte	0x2b
+	.long	0xc1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x12
+	.long	.LASF1040
+	.value	0x155
+	.byte	0x1b
+	.long	0x703
+	.uleb128 0x1f
+	.long	0x1602
+	.quad	.LBI88
+	.byte	.LVU162
+	.long	.LLRL29
+	.value	0x155
+	.byte	0x26
+	.uleb128 0xb
+	.long	0x1612
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x8
+	.long	.LLRL29
+	.uleb128 0x3
+	.long	0x161e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x44
+	.long	0x162a
+	.long	.LLRL32
+	.long	0x15e8
+	.uleb128 0x3
+	.long	0x162f
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0x45
+	.long	0x163c
+	.long	.LLRL34
+	.uleb128 0x3
+	.long	0x163d
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF1163
+	.value	0x137
+	.byte	0x1e
+	.long	0x703
+	.long	0x164b
+	.uleb128 0x21
+	.long	.LASF1147
+	.value	0x137
+	.byte	0x3e
+	.long	0xc1
+	.uleb128 0x12
+	.long	.LASF1116
+	.value	0x139
+	.byte	0x17
+	.long	0x5c3
+	.uleb128 0x46
+	.long	0x163c
+	.uleb128 0x12
+	.long	.LASF1142
+	.value	0x13d
+	.byte	0x1f
+	.long	0x703
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x12
+	.long	.LASF1142
+	.value	0x145
+	.byte	0x1f
+	.long	0x703
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1185
+	.byte	0x1
+	.value	0x12a
+	.byte	0x22
+	.long	0xde9
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1822
+	.uleb128 0xc
+	.long	.LASF1040
+	.value	0x12a
+	.byte	0x46
+	.long	0x4a1
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xc
+	.long	.LASF1119
+	.value	0x12a
+	.byte	0x6c
+	.long	0x935
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x25
+	.long	.LASF1164
+	.value	0x12c
+	.byte	0x25
+	.long	0x93a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortSearchResult.0
+	.uleb128 0x26
+	.long	0x190d
+	.quad	.LBI42
+	.byte	.LVU92
+	.long	.LLRL14
+	.value	0x131
+	.byte	0x5
+	.long	0x17d9
+	.uleb128 0xb
+	.long	0x191a
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xb
+	.long	0x1925
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x8
+	.long	.LLRL14
+	.uleb128 0x2d
+	.long	0x1930
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	0x193b
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x3
+	.long	0x1946
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x3
+	.long	0x1951
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x2e
+	.long	0x195d
+	.quad	.LBI44
+	.byte	.LVU96
+	.long	.LLRL20
+	.byte	0xe4
+	.byte	0x16
+	.uleb128 0xb
+	.long	0x1977
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xb
+	.long	0x196c
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.long	.LLRL20
+	.uleb128 0x2d
+	.long	0x1982
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.uleb128 0x2d
+	.long	0x198b
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.uleb128 0x49
+	.long	0x1995
+	.quad	.LBI46
+	.byte	.LVU100
+	.long	.LLRL23
+	.byte	0x1
+	.byte	0xd6
+	.byte	0xc
+	.long	0x17a0
+	.uleb128 0xb
+	.long	0x19a4
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x8
+	.long	.LLRL23
+	.uleb128 0x3
+	.long	0x19ae
+	.long	.LLST25
+	.long	.LVUS25
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x1995
+	.quad	.LBI51
+	.byte	.LVU115
+	.long	.LLRL26
+	.byte	0xd6
+	.byte	0x2c
+	.uleb128 0xb
+	.long	0x19a4
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x8
+	.long	.LLRL26
+	.uleb128 0x3
+	.long	0x19ae
+	.long	.LLST28
+	.long	.LVUS28
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.quad	.LVL37
+	.long	0x1822
+	.long	0x17ff
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortSearchResult.0
+	.byte	0
+	.uleb128 0x4b
+	.quad	.LVL39
+	.long	0x1822
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortSearchResult.0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1165
+	.byte	0xef
+	.byte	0x1b
+	.long	0xde9
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x190d
+	.uleb128 0x2f
+	.long	.LASF1040
+	.byte	0x43
+	.long	0x4a1
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2f
+	.long	.LASF1119
+	.byte	0x69
+	.long	0x935
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2f
+	.long	.LASF1166
+	.byte	0x97
+	.long	0xde9
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x22
+	.long	.LASF1167
+	.byte	0xf1
+	.byte	0xd
+	.long	0xab
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x22
+	.long	.LASF1142
+	.byte	0xf2
+	.byte	0x1b
+	.long	0x703
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x8
+	.long	.LLRL6
+	.uleb128 0x22
+	.long	.LASF1168
+	.byte	0xfa
+	.byte	0x11
+	.long	0xab
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x22
+	.long	.LASF1141
+	.byte	0xfb
+	.byte	0x27
+	.long	0x930
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x12
+	.long	.LASF1169
+	.value	0x11c
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x2e
+	.long	0x1a0f
+	.quad	.LBI25
+	.byte	.LVU36
+	.long	.LLRL9
+	.byte	0xfa
+	.byte	0x23
+	.uleb128 0xb
+	.long	0x1a1e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x8
+	.long	.LLRL9
+	.uleb128 0x3
+	.long	0x1a29
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF1186
+	.byte	0x1
+	.byte	0xd9
+	.byte	0xd
+	.byte	0x1
+	.long	0x195d
+	.uleb128 0x17
+	.long	.LASF1112
+	.byte	0xd9
+	.byte	0x3b
+	.long	0x703
+	.uleb128 0x17
+	.long	.LASF1170
+	.byte	0xd9
+	.byte	0x58
+	.long	0xab
+	.uleb128 0x11
+	.long	.LASF1171
+	.byte	0xdb
+	.byte	0x1a
+	.long	0x6cf
+	.uleb128 0x11
+	.long	.LASF1172
+	.byte	0xdd
+	.byte	0xc
+	.long	0x9f
+	.uleb128 0x11
+	.long	.LASF1173
+	.byte	0xde
+	.byte	0xc
+	.long	0x9f
+	.uleb128 0x11
+	.long	.LASF1148
+	.byte	0xdf
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1174
+	.byte	0xd1
+	.byte	0xc
+	.long	0x7c
+	.long	0x1995
+	.uleb128 0x17
+	.long	.LASF1175
+	.byte	0xd1
+	.byte	0x46
+	.long	0xf3
+	.uleb128 0x17
+	.long	.LASF1176
+	.byte	0xd1
+	.byte	0x58
+	.long	0xf3
+	.uleb128 0x30
+	.string	"a"
+	.byte	0xd3
+	.byte	0x1b
+	.long	0x703
+	.uleb128 0x30
+	.string	"b"
+	.byte	0xd4
+	.byte	0x1b
+	.long	0x703
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1177
+	.byte	0xcb
+	.byte	0x10
+	.long	0xab
+	.long	0x19b8
+	.uleb128 0x4d
+	.string	"n"
+	.byte	0x1
+	.byte	0xcb
+	.byte	0x2a
+	.long	0xcd
+	.uleb128 0x30
+	.string	"c"
+	.byte	0xcc
+	.byte	0xb
+	.long	0xab
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1178
+	.byte	0xbd
+	.byte	0x24
+	.long	0x935
+	.long	0x19e9
+	.uleb128 0x17
+	.long	.LASF1040
+	.byte	0xbd
+	.byte	0x50
+	.long	0x4a1
+	.uleb128 0x11
+	.long	.LASF1119
+	.byte	0xbf
+	.byte	0x21
+	.long	0x935
+	.uleb128 0x11
+	.long	.LASF1179
+	.byte	0xc0
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1180
+	.byte	0xb2
+	.byte	0x10
+	.long	0xab
+	.long	0x1a0f
+	.uleb128 0x17
+	.long	.LASF1004
+	.byte	0xb2
+	.byte	0x51
+	.long	0x5f9
+	.uleb128 0x11
+	.long	.LASF984
+	.byte	0xb4
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1181
+	.byte	0xa5
+	.byte	0x1a
+	.long	0x5c3
+	.long	0x1a35
+	.uleb128 0x17
+	.long	.LASF1004
+	.byte	0xa5
+	.byte	0x53
+	.long	0x5f9
+	.uleb128 0x11
+	.long	.LASF1116
+	.byte	0xa7
+	.byte	0x17
+	.long	0x5c3
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1182
+	.byte	0x9b
+	.byte	0x9
+	.long	0xab
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a78
+	.uleb128 0x4e
+	.long	.LASF1077
+	.byte	0x1
+	.byte	0x9b
+	.byte	0x3a
+	.long	0x579
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x22
+	.long	.LASF984
+	.byte	0x9c
+	.byte	0xd
+	.long	0xab
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF1187
+	.byte	0x1
+	.byte	0x96
+	.byte	0x21
+	.long	0x1a96
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x7
+	.long	0x714
+	.uleb128 0x50
+	.long	0x14f5
+	.long	.LLRL36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b09
+	.uleb128 0x31
+	.long	0x1503
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x31
+	.long	0x150f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.long	0x151b
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1f
+	.long	0x1528
+	.quad	.LBI103
+	.byte	.LVU199
+	.long	.LLRL38
+	.value	0x16f
+	.byte	0x30
+	.uleb128 0xb
+	.long	0x1538
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x8
+	.long	.LLRL38
+	.uleb128 0x3
+	.long	0x1544
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x3
+	.long	0x1550
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	0x142d
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x31
+	.long	0x143f
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.long	0x1461
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x1f
+	.long	0x19b8
+	.quad	.LBI117
+	.byte	.LVU256
+	.long	.LLRL49
+	.value	0x181
+	.byte	0x1a
+	.uleb128 0xb
+	.long	0x19c7
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x8
+	.long	.LLRL49
+	.uleb128 0x3
+	.long	0x19d2
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x3
+	.long	0x19dd
+	.long	.LLST52
+	.long	.LVUS52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 239
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS131:
+	.uleb128 0
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU692
+	.uleb128 .LVU693
+	.uleb128 .LVU693
+	.uleb128 0
+.LLST131:
+	.byte	0x6
+	.quad	.LVL211
+	.byte	0x4
+	.uleb128 .LVL211-.LVL211
+	.uleb128 .LVL212-1-.LVL211
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL212-1-.LVL211
+	.uleb128 .LVL212-.LVL211
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL211
+	.uleb128 .LVL213-1-.LVL211
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL213-1-.LVL211
+	.uleb128 .LFE36-.LVL211
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 0
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST130:
+	.byte	0x6
+	.quad	.LVL206
+	.byte	0x4
+	.uleb128 .LVL206-.LVL206
+	.uleb128 .LVL207-.LVL206
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL207-.LVL206
+	.uleb128 .LVL210-.LVL206
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL210-.LVL206
+	.uleb128 .LFE35-.LVL206
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 0
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 0
+.LLST129:
+	.byte	0x6
+	.quad	.LVL200
+	.byte	0x4
+	.uleb128 .LVL200-.LVL200
+	.uleb128 .LVL202-1-.LVL200
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL202-1-.LVL200
+	.uleb128 .LFE33-.LVL200
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU588
+	.uleb128 .LVU588
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST108:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL170-.LVL166
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL170-.LVL166
+	.uleb128 .LVL188-.LVL166
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL188-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU589
+	.uleb128 .LVU589
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST109:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL171-.LVL166
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL171-.LVL166
+	.uleb128 .LVL190-.LVL166
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL190-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU644
+	.uleb128 .LVU644
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST110:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL167-1-.LVL166
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL167-1-.LVL166
+	.uleb128 .LVL189-.LVL166
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL189-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU646
+	.uleb128 .LVU646
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST111:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL167-1-.LVL166
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL167-1-.LVL166
+	.uleb128 .LVL191-.LVL166
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL191-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU648
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST112:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL172-1-.LVL166
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL172-1-.LVL166
+	.uleb128 .LVL192-.LVL166
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL192-.LVL166
+	.uleb128 .LVL193-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU574
+	.uleb128 .LVU609
+	.uleb128 .LVU609
+	.uleb128 .LVU640
+	.uleb128 .LVU648
+	.uleb128 .LVU651
+	.uleb128 .LVU651
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 0
+.LLST113:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL181-.LVL166
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL181-.LVL166
+	.uleb128 .LVL186-.LVL166
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL193-.LVL166
+	.uleb128 .LVL194-.LVL166
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL194-.LVL166
+	.uleb128 .LHOTE2-.LVL166
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x6
+	.quad	.LFSB32
+	.byte	0x4
+	.uleb128 .LFSB32-.LFSB32
+	.uleb128 .LVL199-.LFSB32
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-.LFSB32
+	.uleb128 .LFE32-.LFSB32
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 8
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU577
+	.uleb128 .LVU590
+.LLST114:
+	.byte	0x8
+	.quad	.LVL167
+	.uleb128 .LVL172-1-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU585
+	.uleb128 .LVU587
+	.uleb128 .LVU587
+	.uleb128 .LVU604
+	.uleb128 .LVU604
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST115:
+	.byte	0x6
+	.quad	.LVL168
+	.byte	0x4
+	.uleb128 .LVL168-.LVL168
+	.uleb128 .LVL169-.LVL168
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.LVL168
+	.uleb128 .LVL179-.LVL168
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL179-.LVL168
+	.uleb128 .LHOTE2-.LVL168
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU591
+	.uleb128 .LVU593
+	.uleb128 .LVU593
+	.uleb128 .LVU595
+	.uleb128 .LVU596
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU641
+	.uleb128 .LVU648
+	.uleb128 .LVU651
+	.uleb128 .LVU651
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST116:
+	.byte	0x6
+	.quad	.LVL173
+	.byte	0x4
+	.uleb128 .LVL173-.LVL173
+	.uleb128 .LVL174-.LVL173
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL174-.LVL173
+	.uleb128 .LVL175-1-.LVL173
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL176-.LVL173
+	.uleb128 .LVL177-.LVL173
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL177-.LVL173
+	.uleb128 .LVL180-1-.LVL173
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL180-1-.LVL173
+	.uleb128 .LVL187-.LVL173
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x4
+	.uleb128 .LVL193-.LVL173
+	.uleb128 .LVL194-1-.LVL173
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL194-1-.LVL173
+	.uleb128 .LHOTE2-.LVL173
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU601
+	.uleb128 .LVU608
+	.uleb128 .LVU648
+	.uleb128 .LVU651
+.LLST117:
+	.byte	0x6
+	.quad	.LVL178
+	.byte	0x4
+	.uleb128 .LVL178-.LVL178
+	.uleb128 .LVL180-1-.LVL178
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL193-.LVL178
+	.uleb128 .LVL194-1-.LVL178
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 0
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU602
+	.uleb128 .LVU608
+	.uleb128 .LVU648
+	.uleb128 .LVU651
+.LLST118:
+	.byte	0x6
+	.quad	.LVL178
+	.byte	0x4
+	.uleb128 .LVL178-.LVL178
+	.uleb128 .LVL180-1-.LVL178
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL193-.LVL178
+	.uleb128 .LVL194-1-.LVL178
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU604
+	.uleb128 .LVU641
+	.uleb128 .LVU648
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST119:
+	.byte	0x6
+	.quad	.LVL179
+	.byte	0x4
+	.uleb128 .LVL179-.LVL179
+	.uleb128 .LVL187-.LVL179
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL193-.LVL179
+	.uleb128 .LHOTE2-.LVL179
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU616
+	.uleb128 .LVU641
+	.uleb128 .LVU652
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST120:
+	.byte	0x6
+	.quad	.LVL182
+	.byte	0x4
+	.uleb128 .LVL182-.LVL182
+	.uleb128 .LVL187-.LVL182
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL195-.LVL182
+	.uleb128 .LVL196-.LVL182
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL196-.LVL182
+	.uleb128 .LVL197-.LVL182
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL197-.LVL182
+	.uleb128 .LHOTE2-.LVL182
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU619
+	.uleb128 .LVU638
+	.uleb128 .LVU652
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST122:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL186-.LVL183
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL195-.LVL183
+	.uleb128 .LHOTE2-.LVL183
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU619
+	.uleb128 .LVU638
+	.uleb128 .LVU652
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 0
+.LLST123:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL186-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.LVL183
+	.uleb128 .LHOTE2-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x6
+	.quad	.LFSB32
+	.byte	0x4
+	.uleb128 .LFSB32-.LFSB32
+	.uleb128 .LVL199-.LFSB32
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL199-.LFSB32
+	.uleb128 .LFE32-.LFSB32
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 8
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU635
+	.uleb128 .LVU641
+	.uleb128 0
+	.uleb128 0
+.LLST124:
+	.byte	0x8
+	.quad	.LVL185
+	.uleb128 .LVL187-.LVL185
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x8
+	.quad	.LVL198
+	.uleb128 .LFE32-.LVL198
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU621
+	.uleb128 .LVU635
+	.uleb128 .LVU652
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST126:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL185-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-.LVL183
+	.uleb128 .LHOTE2-.LVL183
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LVL198-.LFSB32
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU627
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 .LVU635
+	.uleb128 .LVU652
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST127:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL184-.LVL183
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.LVL183
+	.uleb128 .LVL185-.LVL183
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL183
+	.uleb128 .LVL197-.LVL183
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.LVL183
+	.uleb128 .LHOTE2-.LVL183
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LVL198-.LFSB32
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU625
+	.uleb128 .LVU630
+	.uleb128 .LVU630
+	.uleb128 .LVU635
+	.uleb128 .LVU652
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 0
+	.uleb128 0
+	.uleb128 0
+.LLST128:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL184-.LVL183
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL184-.LVL183
+	.uleb128 .LVL185-.LVL183
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL183
+	.uleb128 .LVL197-.LVL183
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL197-.LVL183
+	.uleb128 .LHOTE2-.LVL183
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB32
+	.uleb128 .LVL198-.LFSB32
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU545
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU569
+	.uleb128 .LVU569
+	.uleb128 0
+.LLST102:
+	.byte	0x6
+	.quad	.LVL157
+	.byte	0x4
+	.uleb128 .LVL157-.LVL157
+	.uleb128 .LVL158-.LVL157
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL157
+	.uleb128 .LVL163-.LVL157
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL163-.LVL157
+	.uleb128 .LVL164-.LVL157
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.LVL157
+	.uleb128 .LFE31-.LVL157
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS103:
+	.uleb128 .LVU546
+	.uleb128 .LVU552
+	.uleb128 .LVU552
+	.uleb128 0
+.LLST103:
+	.byte	0x6
+	.quad	.LVL157
+	.byte	0x4
+	.uleb128 .LVL157-.LVL157
+	.uleb128 .LVL158-.LVL157
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL157
+	.uleb128 .LFE31-.LVL157
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU552
+	.uleb128 .LVU556
+	.uleb128 .LVU556
+	.uleb128 .LVU559
+	.uleb128 .LVU564
+	.uleb128 .LVU565
+	.uleb128 .LVU571
+	.uleb128 0
+.LLST106:
+	.byte	0x6
+	.quad	.LVL158
+	.byte	0x4
+	.uleb128 .LVL158-.LVL158
+	.uleb128 .LVL159-.LVL158
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.LVL158
+	.uleb128 .LVL160-.LVL158
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.LVL158
+	.uleb128 .LVL163-.LVL158
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.LVL158
+	.uleb128 .LFE31-.LVL158
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 0
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 0
+.LLST98:
+	.byte	0x6
+	.quad	.LVL150
+	.byte	0x4
+	.uleb128 .LVL150-.LVL150
+	.uleb128 .LVL153-1-.LVL150
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL153-1-.LVL150
+	.uleb128 .LFE30-.LVL150
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 0
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 0
+.LLST99:
+	.byte	0x6
+	.quad	.LVL150
+	.byte	0x4
+	.uleb128 .LVL150-.LVL150
+	.uleb128 .LVL152-.LVL150
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL152-.LVL150
+	.uleb128 .LFE30-.LVL150
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU531
+	.uleb128 .LVU533
+.LLST100:
+	.byte	0x8
+	.quad	.LVL152
+	.uleb128 .LVL153-1-.LVL152
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU533
+	.uleb128 .LVU537
+	.uleb128 .LVU541
+	.uleb128 .LVU542
+.LLST101:
+	.byte	0x6
+	.quad	.LVL153
+	.byte	0x4
+	.uleb128 .LVL153-.LVL153
+	.uleb128 .LVL154-.LVL153
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL155-.LVL153
+	.uleb128 .LVL156-.LVL153
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS95:
+	.uleb128 0
+	.uleb128 .LVU523
+	.uleb128 .LVU523
+	.uleb128 0
+.LLST95:
+	.byte	0x6
+	.quad	.LVL145
+	.byte	0x4
+	.uleb128 .LVL145-.LVL145
+	.uleb128 .LVL148-1-.LVL145
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL148-1-.LVL145
+	.uleb128 .LFE29-.LVL145
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU521
+	.uleb128 .LVU523
+.LLST96:
+	.byte	0x8
+	.quad	.LVL147
+	.uleb128 .LVL148-1-.LVL147
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU523
+	.uleb128 .LVU525
+.LLST97:
+	.byte	0x8
+	.quad	.LVL148
+	.uleb128 .LVL149-.LVL148
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU501
+	.uleb128 .LVU501
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 0
+.LLST86:
+	.byte	0x6
+	.quad	.LVL123
+	.byte	0x4
+	.uleb128 .LVL123-.LVL123
+	.uleb128 .LVL124-.LVL123
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL124-.LVL123
+	.uleb128 .LVL134-.LVL123
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL134-.LVL123
+	.uleb128 .LVL136-.LVL123
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL123
+	.uleb128 .LVL143-.LVL123
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL143-.LVL123
+	.uleb128 .LFE28-.LVL123
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU492
+	.uleb128 .LVU494
+	.uleb128 .LVU509
+	.uleb128 .LVU511
+.LLST87:
+	.byte	0x6
+	.quad	.LVL130
+	.byte	0x4
+	.uleb128 .LVL130-.LVL130
+	.uleb128 .LVL131-.LVL130
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL140-.LVL130
+	.uleb128 .LVL141-.LVL130
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU489
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU495
+	.uleb128 .LVU506
+	.uleb128 .LVU509
+.LLST88:
+	.byte	0x6
+	.quad	.LVL129
+	.byte	0x4
+	.uleb128 .LVL129-.LVL129
+	.uleb128 .LVL130-1-.LVL129
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL130-1-.LVL129
+	.uleb128 .LVL132-.LVL129
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL139-.LVL129
+	.uleb128 .LVL140-1-.LVL129
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU475
+	.uleb128 .LVU492
+	.uleb128 .LVU503
+	.uleb128 .LVU509
+.LLST89:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL130-1-.LVL125
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-.LVL125
+	.uleb128 .LVL140-1-.LVL125
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU471
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 .LVU497
+	.uleb128 .LVU497
+	.uleb128 .LVU502
+	.uleb128 .LVU503
+	.uleb128 .LVU516
+.LLST90:
+	.byte	0x6
+	.quad	.LVL123
+	.byte	0x4
+	.uleb128 .LVL123-.LVL123
+	.uleb128 .LVL124-.LVL123
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.LVL123
+	.uleb128 .LVL132-.LVL123
+	.uleb128 0x15
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x44
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL132-.LVL123
+	.uleb128 .LVL133-.LVL123
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x44
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.LVL123
+	.uleb128 .LVL135-.LVL123
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	functionConstraints+20
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x44
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL123
+	.uleb128 .LVL144-.LVL123
+	.uleb128 0x15
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x44
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU476
+	.uleb128 .LVU489
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST92:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL129-.LVL125
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-.LVL125
+	.uleb128 .LVL139-.LVL125
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU478
+	.uleb128 .LVU482
+	.uleb128 .LVU483
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU489
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+.LLST93:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL126-.LVL125
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL126-.LVL125
+	.uleb128 .LVL128-.LVL125
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.LVL125
+	.uleb128 .LVL129-.LVL125
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL125
+	.uleb128 .LVL138-.LVL125
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU480
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 .LVU503
+	.uleb128 .LVU504
+.LLST94:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL126-.LVL125
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL126-.LVL125
+	.uleb128 .LVL127-.LVL125
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL127-.LVL125
+	.uleb128 .LVL128-.LVL125
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.LVL125
+	.uleb128 .LVL137-.LVL125
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU321
+	.uleb128 .LVU321
+	.uleb128 .LVU351
+	.uleb128 .LVU351
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU433
+	.uleb128 .LVU433
+	.uleb128 0
+.LLST53:
+	.byte	0x6
+	.quad	.LVL68
+	.byte	0x4
+	.uleb128 .LVL68-.LVL68
+	.uleb128 .LVL74-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL74-.LVL68
+	.uleb128 .LVL85-.LVL68
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL85-.LVL68
+	.uleb128 .LVL111-.LVL68
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.LVL68
+	.uleb128 .LVL113-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL113-.LVL68
+	.uleb128 .LVL115-.LVL68
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL115-.LVL68
+	.uleb128 .LFE27-.LVL68
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU337
+	.uleb128 .LVU339
+	.uleb128 .LVU351
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU381
+	.uleb128 .LVU381
+	.uleb128 .LVU383
+	.uleb128 .LVU383
+	.uleb128 .LVU405
+	.uleb128 .LVU405
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU433
+	.uleb128 .LVU451
+	.uleb128 .LVU451
+	.uleb128 .LVU464
+.LLST54:
+	.byte	0x6
+	.quad	.LVL75
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL77-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL79-.LVL75
+	.uleb128 .LVL80-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.LVL75
+	.uleb128 .LVL86-1-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-1-.LVL75
+	.uleb128 .LVL92-.LVL75
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL92-.LVL75
+	.uleb128 .LVL93-1-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL93-1-.LVL75
+	.uleb128 .LVL99-.LVL75
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL99-.LVL75
+	.uleb128 .LVL100-1-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL100-1-.LVL75
+	.uleb128 .LVL108-.LVL75
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL108-.LVL75
+	.uleb128 .LVL109-1-.LVL75
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL109-1-.LVL75
+	.uleb128 .LVL110-.LVL75
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL115-.LVL75
+	.uleb128 .LVL119-.LVL75
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL119-.LVL75
+	.uleb128 .LVL122-.LVL75
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU318
+	.uleb128 .LVU322
+	.uleb128 .LVU334
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+	.uleb128 .LVU361
+	.uleb128 .LVU364
+	.uleb128 .LVU376
+	.uleb128 .LVU379
+	.uleb128 .LVU400
+	.uleb128 .LVU403
+	.uleb128 .LVU421
+	.uleb128 .LVU433
+.LLST55:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL75-1-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.LVL73
+	.uleb128 .LVL83-.LVL73
+	.uleb128 0xa
+	.byte	0x3
+	.quad	configuredFunctionConstraint.1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL73
+	.uleb128 .LVL84-1-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL90-.LVL73
+	.uleb128 .LVL91-1-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL97-.LVL73
+	.uleb128 .LVL98-1-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.LVL73
+	.uleb128 .LVL107-1-.LVL73
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL113-.LVL73
+	.uleb128 .LVL115-.LVL73
+	.uleb128 0xa
+	.byte	0x3
+	.quad	configuredFunctionConstraint.1
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU451
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 0
+.LLST56:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL120-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.LVL119
+	.uleb128 .LFE27-.LVL119
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU451
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST57:
+	.byte	0x6
+	.quad	.LVL119
+	.byte	0x4
+	.uleb128 .LVL119-.LVL119
+	.uleb128 .LVL120-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL120-.LVL119
+	.uleb128 .LVL121-.LVL119
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL121-.LVL119
+	.uleb128 .LFE27-.LVL119
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU451
+	.uleb128 .LVU457
+.LLST58:
+	.byte	0x8
+	.quad	.LVL119
+	.uleb128 .LVL120-.LVL119
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU306
+	.uleb128 .LVU318
+	.uleb128 .LVU410
+	.uleb128 .LVU421
+.LLST60:
+	.byte	0x6
+	.quad	.LVL69
+	.byte	0x4
+	.uleb128 .LVL69-.LVL69
+	.uleb128 .LVL73-.LVL69
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL111-.LVL69
+	.uleb128 .LVL113-.LVL69
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU410
+	.uleb128 .LVU416
+.LLST61:
+	.byte	0x8
+	.quad	.LVL111
+	.uleb128 .LVL112-.LVL111
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU312
+	.uleb128 .LVU315
+.LLST63:
+	.byte	0x8
+	.quad	.LVL70
+	.uleb128 .LVL71-.LVL70
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU307
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU316
+.LLST64:
+	.byte	0x6
+	.quad	.LVL69
+	.byte	0x4
+	.uleb128 .LVL69-.LVL69
+	.uleb128 .LVL70-.LVL69
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL69
+	.uleb128 .LVL71-.LVL69
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL71-.LVL69
+	.uleb128 .LVL72-.LVL69
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU324
+	.uleb128 .LVU408
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST66:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL110-.LVL76
+	.uleb128 0xa
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.LVL76
+	.uleb128 .LFE27-.LVL76
+	.uleb128 0xa
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU421
+	.uleb128 .LVU428
+.LLST68:
+	.byte	0x8
+	.quad	.LVL113
+	.uleb128 .LVL114-.LVL113
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU340
+	.uleb128 .LVU343
+.LLST70:
+	.byte	0x8
+	.quad	.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU339
+	.uleb128 .LVU343
+	.uleb128 .LVU343
+	.uleb128 .LVU344
+.LLST71:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.LVL80
+	.uleb128 .LVL82-.LVL80
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU433
+	.uleb128 .LVU440
+.LLST73:
+	.byte	0x8
+	.quad	.LVL115
+	.uleb128 .LVL116-.LVL115
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU355
+	.uleb128 .LVU358
+.LLST75:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU354
+	.uleb128 .LVU358
+	.uleb128 .LVU358
+	.uleb128 .LVU359
+.LLST76:
+	.byte	0x6
+	.quad	.LVL87
+	.byte	0x4
+	.uleb128 .LVL87-.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.LVL87
+	.uleb128 .LVL89-.LVL87
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU442
+	.uleb128 .LVU449
+.LLST78:
+	.byte	0x8
+	.quad	.LVL117
+	.uleb128 .LVL118-.LVL117
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU370
+	.uleb128 .LVU373
+.LLST80:
+	.byte	0x8
+	.quad	.LVL94
+	.uleb128 .LVL95-.LVL94
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU369
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU374
+.LLST81:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL95-.LVL94
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL95-.LVL94
+	.uleb128 .LVL96-.LVL94
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU391
+	.uleb128 .LVU397
+.LLST82:
+	.byte	0x8
+	.quad	.LVL104
+	.uleb128 .LVL105-.LVL104
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+.LLST84:
+	.byte	0x8
+	.quad	.LVL101
+	.uleb128 .LVL102-.LVL101
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU384
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU389
+.LLST85:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL102-.LVL101
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.LVL101
+	.uleb128 .LVL103-.LVL101
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST43:
+	.byte	0x8
+	.quad	.LVL57
+	.uleb128 .LVL58-.LVL57
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x8
+	.quad	.LVL60
+	.uleb128 .LFE25-.LVL60
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU227
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU249
+.LLST45:
+	.byte	0x6
+	.quad	.LVL55
+	.byte	0x4
+	.uleb128 .LVL55-.LVL55
+	.uleb128 .LVL57-.LVL55
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-.LVL55
+	.uleb128 .LHOTE1-.LVL55
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.quad	.LFSB25
+	.uleb128 .LVL60-.LFSB25
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU233
+	.uleb128 .LVU238
+	.uleb128 .LVU238
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU249
+.LLST46:
+	.byte	0x6
+	.quad	.LVL55
+	.byte	0x4
+	.uleb128 .LVL55-.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.LVL55
+	.uleb128 .LVL57-.LVL55
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL55
+	.uleb128 .LVL59-.LVL55
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL55
+	.uleb128 .LHOTE1-.LVL55
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB25
+	.uleb128 .LVL60-.LFSB25
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU231
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU246
+	.uleb128 .LVU246
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU249
+.LLST47:
+	.byte	0x6
+	.quad	.LVL55
+	.byte	0x4
+	.uleb128 .LVL55-.LVL55
+	.uleb128 .LVL56-.LVL55
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.LVL55
+	.uleb128 .LVL57-.LVL55
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL55
+	.uleb128 .LVL59-.LVL55
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.LVL55
+	.uleb128 .LHOTE1-.LVL55
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB25
+	.uleb128 .LVL60-.LFSB25
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL60
+	.uleb128 .LVL60-.LVL60
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU162
+	.uleb128 .LVU191
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL46-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL47-.LVL41
+	.uleb128 .LFE22-.LVL41
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU165
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 .LVU191
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST31:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL43-.LVL41
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL41
+	.uleb128 .LVL43-.LVL41
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL41
+	.uleb128 .LVL44-.LVL41
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL41
+	.uleb128 .LVL45-.LVL41
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.LVL41
+	.uleb128 .LVL46-.LVL41
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL41
+	.uleb128 .LFE22-.LVL41
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU167
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU190
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL45-.LVL41
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL41
+	.uleb128 .LVL48-.LVL41
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL41
+	.uleb128 .LFE22-.LVL41
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU181
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU190
+.LLST35:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL43
+	.uleb128 .LVL45-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL37-1-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL37-1-.LVL22
+	.uleb128 .LVL37-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL22
+	.uleb128 .LVL39-1-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-1-.LVL22
+	.uleb128 .LVL39-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL22
+	.uleb128 .LFE20-.LVL22
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL24-.LVL22
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL24-.LVL22
+	.uleb128 .LVL37-1-.LVL22
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL37-1-.LVL22
+	.uleb128 .LVL37-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL22
+	.uleb128 .LVL39-1-.LVL22
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL39-1-.LVL22
+	.uleb128 .LVL39-.LVL22
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL22
+	.uleb128 .LVL40-.LVL22
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL40-.LVL22
+	.uleb128 .LFE20-.LVL22
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU93
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU93
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU93
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU94
+	.uleb128 .LVU130
+	.uleb128 .LVU130
+	.uleb128 .LVU133
+	.uleb128 .LVU136
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU149
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL23
+	.uleb128 .LVL36-.LVL23
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL23
+	.uleb128 .LVL38-.LVL23
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU124
+	.uleb128 .LVU129
+.LLST19:
+	.byte	0x8
+	.quad	.LVL35
+	.uleb128 .LVL36-.LVL35
+	.uleb128 0x9
+	.byte	0x74
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU96
+	.uleb128 .LVU124
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL35-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU96
+	.uleb128 .LVU124
+	.uleb128 .LVU154
+	.uleb128 0
+.LLST22:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL35-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LFE20-.LVL23
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU100
+	.uleb128 .LVU109
+	.uleb128 .LVU109
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 .LVU113
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+.LLST24:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL25-.LVL23
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL25-.LVL23
+	.uleb128 .LVL27-.LVL23
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL23
+	.uleb128 .LVL28-.LVL23
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LVL39-.LVL23
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU103
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+.LLST25:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL24-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL23
+	.uleb128 .LVL28-.LVL23
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.LVL23
+	.uleb128 .LVL39-.LVL23
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU115
+	.uleb128 .LVU117
+	.uleb128 .LVU118
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 .LVU124
+	.uleb128 .LVU155
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL29
+	.byte	0x4
+	.uleb128 .LVL29-.LVL29
+	.uleb128 .LVL30-.LVL29
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortFunctions+40
+	.byte	0x4
+	.uleb128 .LVL31-.LVL29
+	.uleb128 .LVL32-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL32-.LVL29
+	.uleb128 .LVL34-.LVL29
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.LVL29
+	.uleb128 .LVL35-.LVL29
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL39-.LVL29
+	.uleb128 .LFE20-.LVL29
+	.uleb128 0x9
+	.byte	0x3
+	.quad	serialPortFunctions+40
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU116
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 .LVU124
+	.uleb128 .LVU157
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL29
+	.byte	0x4
+	.uleb128 .LVL29-.LVL29
+	.uleb128 .LVL31-.LVL29
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL29
+	.uleb128 .LVL35-.LVL29
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL39-.LVL29
+	.uleb128 .LFE20-.LVL29
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.LVL5
+	.uleb128 .LVL19-.LVL5
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL19-.LVL5
+	.uleb128 .LVL21-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL21-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL8-.LVL5
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.LVL5
+	.uleb128 .LVL19-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.LVL5
+	.uleb128 .LVL21-.LVL5
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL11-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL11-.LVL5
+	.uleb128 .LVL12-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL5
+	.uleb128 .LVL20-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.LVL5
+	.uleb128 .LVL21-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL5
+	.uleb128 .LFE19-.LVL5
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU21
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 .LVU30
+	.uleb128 .LVU34
+	.uleb128 .LVU64
+	.uleb128 .LVU78
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL9-.LVL6
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-.LVL6
+	.uleb128 .LVL10-.LVL6
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL6
+	.uleb128 .LVL17-.LVL6
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL18-.LVL6
+	.uleb128 .LFE19-.LVL6
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU25
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LVL12-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL8
+	.uleb128 .LVL17-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.LVL8
+	.uleb128 .LVL18-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL8
+	.uleb128 .LVL19-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL8
+	.uleb128 .LFE19-.LVL8
+	.uleb128 0x15
+	.byte	0x71
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU48
+	.uleb128 .LVU78
+.LLST7:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL18-.LVL16
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU50
+	.uleb128 .LVU78
+.LLST8:
+	.byte	0x8
+	.quad	.LVL16
+	.uleb128 .LVL18-.LVL16
+	.uleb128 0x15
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	serialPortConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU36
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU48
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL15-.LVL13
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL15-.LVL13
+	.uleb128 .LVL16-.LVL13
+	.uleb128 0x2
+	.byte	0x72
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL18-.LVL13
+	.uleb128 .LVL19-.LVL13
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL21-.LVL13
+	.uleb128 .LFE19-.LVL13
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU39
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU47
+	.uleb128 .LVU78
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.LVL13
+	.uleb128 .LVL16-.LVL13
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL13
+	.uleb128 .LVL19-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL13
+	.uleb128 .LFE19-.LVL13
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU7
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL2-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 .LVU221
+	.uleb128 0
+.LLST37:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x8
+	.quad	.LVL54
+	.uleb128 .LFE24-.LVL54
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU199
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU221
+.LLST39:
+	.byte	0x6
+	.quad	.LVL49
+	.byte	0x4
+	.uleb128 .LVL49-.LVL49
+	.uleb128 .LVL51-.LVL49
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL52-.LVL49
+	.uleb128 .LHOTE0-.LVL49
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.quad	.LFSB24
+	.uleb128 .LVL54-.LFSB24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU205
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU221
+.LLST40:
+	.byte	0x6
+	.quad	.LVL49
+	.byte	0x4
+	.uleb128 .LVL49-.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL49
+	.uleb128 .LVL51-.LVL49
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL49
+	.uleb128 .LVL53-.LVL49
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL49
+	.uleb128 .LHOTE0-.LVL49
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB24
+	.uleb128 .LVL54-.LFSB24
+	.uleb128 0xa
+	.byte	0x3
+	.quad	serialPortFunctions+24
+	.byte	0x9f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU203
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+	.uleb128 0
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU221
+.LLST41:
+	.byte	0x6
+	.quad	.LVL49
+	.byte	0x4
+	.uleb128 .LVL49-.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL49
+	.uleb128 .LVL51-.LVL49
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL49
+	.uleb128 .LVL53-.LVL49
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL49
+	.uleb128 .LHOTE0-.LVL49
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LFSB24
+	.uleb128 .LVL54-.LFSB24
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL54
+	.uleb128 .LVL54-.LVL54
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU270
+	.uleb128 .LVU275
+.LLST48:
+	.byte	0x8
+	.quad	.LVL66
+	.uleb128 .LVL67-.LVL66
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU256
+	.uleb128 .LVU270
+.LLST50:
+	.byte	0x8
+	.quad	.LVL61
+	.uleb128 .LVL66-.LVL61
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU258
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU267
+	.uleb128 .LVU267
+	.uleb128 .LVU269
+.LLST51:
+	.byte	0x6
+	.quad	.LVL61
+	.byte	0x4
+	.uleb128 .LVL61-.LVL61
+	.uleb128 .LVL62-.LVL61
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL61
+	.uleb128 .LVL64-.LVL61
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.LVL61
+	.uleb128 .LVL65-.LVL61
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x44
+	.byte	0x1e
+	.byte	0x3
+	.quad	functionConstraints
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU260
+	.uleb128 .LVU262
+	.uleb128 .LVU262
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU267
+.LLST52:
+	.byte	0x6
+	.quad	.LVL61
+	.byte	0x4
+	.uleb128 .LVL61-.LVL61
+	.uleb128 .LVL62-.LVL61
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL61
+	.uleb128 .LVL63-.LVL61
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.LVL61
+	.uleb128 .LVL64-.LVL61
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x16c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext_cold0
+	.quad	.Letext_cold0-.Ltext_cold0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB24
+	.quad	.LHOTE0-.LFB24
+	.quad	.LFB25
+	.quad	.LHOTE1-.LFB25
+	.quad	.LFSB25
+	.quad	.LCOLDE1-.LFSB25
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.quad	.LFB32
+	.quad	.LHOTE2-.LFB32
+	.quad	.LFSB32
+	.quad	.LCOLDE2-.LFSB32
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x5
+	.quad	.LBB24
+	.byte	0x4
+	.uleb128 .LBB24-.LBB24
+	.uleb128 .LBE24-.LBB24
+	.byte	0x4
+	.uleb128 .LBB31-.LBB24
+	.uleb128 .LBE31-.LBB24
+	.byte	0x4
+	.uleb128 .LBB32-.LBB24
+	.uleb128 .LBE32-.LBB24
+	.byte	0x4
+	.uleb128 .LBB33-.LBB24
+	.uleb128 .LBE33-.LBB24
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB25
+	.byte	0x4
+	.uleb128 .LBB25-.LBB25
+	.uleb128 .LBE25-.LBB25
+	.byte	0x4
+	.uleb128 .LBB29-.LBB25
+	.uleb128 .LBE29-.LBB25
+	.byte	0x4
+	.uleb128 .LBB30-.LBB25
+	.uleb128 .LBE30-.LBB25
+	.byte	0
+.LLRL14:
+	.byte	0x5
+	.quad	.LBB42
+	.byte	0x4
+	.uleb128 .LBB42-.LBB42
+	.uleb128 .LBE42-.LBB42
+	.byte	0x4
+	.uleb128 .LBB76-.LBB42
+	.uleb128 .LBE76-.LBB42
+	.byte	0x4
+	.uleb128 .LBB77-.LBB42
+	.uleb128 .LBE77-.LBB42
+	.byte	0x4
+	.uleb128 .LBB78-.LBB42
+	.uleb128 .LBE78-.LBB42
+	.byte	0x4
+	.uleb128 .LBB79-.LBB42
+	.uleb128 .LBE79-.LBB42
+	.byte	0x4
+	.uleb128 .LBB80-.LBB42
+	.uleb128 .LBE80-.LBB42
+	.byte	0x4
+	.uleb128 .LBB81-.LBB42
+	.uleb128 .LBE81-.LBB42
+	.byte	0x4
+	.uleb128 .LBB82-.LBB42
+	.uleb128 .LBE82-.LBB42
+	.byte	0x4
+	.uleb128 .LBB83-.LBB42
+	.uleb128 .LBE83-.LBB42
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB44
+	.byte	0x4
+	.uleb128 .LBB44-.LBB44
+	.uleb128 .LBE44-.LBB44
+	.byte	0x4
+	.uleb128 .LBB63-.LBB44
+	.uleb128 .LBE63-.LBB44
+	.byte	0x4
+	.uleb128 .LBB64-.LBB44
+	.uleb128 .LBE64-.LBB44
+	.byte	0x4
+	.uleb128 .LBB65-.LBB44
+	.uleb128 .LBE65-.LBB44
+	.byte	0x4
+	.uleb128 .LBB66-.LBB44
+	.uleb128 .LBE66-.LBB44
+	.byte	0x4
+	.uleb128 .LBB67-.LBB44
+	.uleb128 .LBE67-.LBB44
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB46
+	.byte	0x4
+	.uleb128 .LBB46-.LBB46
+	.uleb128 .LBE46-.LBB46
+	.byte	0x4
+	.uleb128 .LBB50-.LBB46
+	.uleb128 .LBE50-.LBB46
+	.byte	0x4
+	.uleb128 .LBB55-.LBB46
+	.uleb128 .LBE55-.LBB46
+	.byte	0
+.LLRL26:
+	.byte	0x5
+	.quad	.LBB51
+	.byte	0x4
+	.uleb128 .LBB51-.LBB51
+	.uleb128 .LBE51-.LBB51
+	.byte	0x4
+	.uleb128 .LBB56-.LBB51
+	.uleb128 .LBE56-.LBB51
+	.byte	0x4
+	.uleb128 .LBB57-.LBB51
+	.uleb128 .LBE57-.LBB51
+	.byte	0
+.LLRL29:
+	.byte	0x5
+	.quad	.LBB88
+	.byte	0x4
+	.uleb128 .LBB88-.LBB88
+	.uleb128 .LBE88-.LBB88
+	.byte	0x4
+	.uleb128 .LBB100-.LBB88
+	.uleb128 .LBE100-.LBB88
+	.byte	0x4
+	.uleb128 .LBB101-.LBB88
+	.uleb128 .LBE101-.LBB88
+	.byte	0x4
+	.uleb128 .LBB102-.LBB88
+	.uleb128 .LBE102-.LBB88
+	.byte	0
+.LLRL32:
+	.byte	0x5
+	.quad	.LBB90
+	.byte	0x4
+	.uleb128 .LBB90-.LBB90
+	.uleb128 .LBE90-.LBB90
+	.byte	0x4
+	.uleb128 .LBB91-.LBB90
+	.uleb128 .LBE91-.LBB90
+	.byte	0x4
+	.uleb128 .LBB95-.LBB90
+	.uleb128 .LBE95-.LBB90
+	.byte	0x4
+	.uleb128 .LBB96-.LBB90
+	.uleb128 .LBE96-.LBB90
+	.byte	0
+.LLRL34:
+	.byte	0x5
+	.quad	.LBB92
+	.byte	0x4
+	.uleb128 .LBB92-.LBB92
+	.uleb128 .LBE92-.LBB92
+	.byte	0x4
+	.uleb128 .LBB93-.LBB92
+	.uleb128 .LBE93-.LBB92
+	.byte	0x4
+	.uleb128 .LBB94-.LBB92
+	.uleb128 .LBE94-.LBB92
+	.byte	0
+.LLRL36:
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LHOTE0-.LFB24
+	.byte	0x7
+	.quad	.LFSB24
+	.uleb128 .LCOLDE0-.LFSB24
+	.byte	0
+.LLRL38:
+	.byte	0x5
+	.quad	.LBB103
+	.byte	0x4
+	.uleb128 .LBB103-.LBB103
+	.uleb128 .LBE103-.LBB103
+	.byte	0x4
+	.uleb128 .LBB107-.LBB103
+	.uleb128 .LBE107-.LBB103
+	.byte	0x7
+	.quad	.LBB108
+	.uleb128 .LBE108-.LBB108
+	.byte	0
+.LLRL42:
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LHOTE1-.LFB25
+	.byte	0x7
+	.quad	.LFSB25
+	.uleb128 .LCOLDE1-.LFSB25
+	.byte	0
+.LLRL44:
+	.byte	0x5
+	.quad	.LBB109
+	.byte	0x4
+	.uleb128 .LBB109-.LBB109
+	.uleb128 .LBE109-.LBB109
+	.byte	0x4
+	.uleb128 .LBB113-.LBB109
+	.uleb128 .LBE113-.LBB109
+	.byte	0x7
+	.quad	.LBB114
+	.uleb128 .LBE114-.LBB114
+	.byte	0
+.LLRL49:
+	.byte	0x5
+	.quad	.LBB117
+	.byte	0x4
+	.uleb128 .LBB117-.LBB117
+	.uleb128 .LBE117-.LBB117
+	.byte	0x4
+	.uleb128 .LBB121-.LBB117
+	.uleb128 .LBE121-.LBB117
+	.byte	0x4
+	.uleb128 .LBB122-.LBB117
+	.uleb128 .LBE122-.LBB117
+	.byte	0
+.LLRL59:
+	.byte	0x5
+	.quad	.LBB147
+	.byte	0x4
+	.uleb128 .LBB147-.LBB147
+	.uleb128 .LBE147-.LBB147
+	.byte	0x4
+	.uleb128 .LBB157-.LBB147
+	.uleb128 .LBE157-.LBB147
+	.byte	0x4
+	.uleb128 .LBB189-.LBB147
+	.uleb128 .LBE189-.LBB147
+	.byte	0
+.LLRL62:
+	.byte	0x5
+	.quad	.LBB149
+	.byte	0x4
+	.uleb128 .LBB149-.LBB149
+	.uleb128 .LBE149-.LBB149
+	.byte	0x4
+	.uleb128 .LBB153-.LBB149
+	.uleb128 .LBE153-.LBB149
+	.byte	0x4
+	.uleb128 .LBB154-.LBB149
+	.uleb128 .LBE154-.LBB149
+	.byte	0
+.LLRL65:
+	.byte	0x5
+	.quad	.LBB158
+	.byte	0x4
+	.uleb128 .LBB158-.LBB158
+	.uleb128 .LBE158-.LBB158
+	.byte	0x4
+	.uleb128 .LBB161-.LBB158
+	.uleb128 .LBE161-.LBB158
+	.byte	0
+.LLRL67:
+	.byte	0x5
+	.quad	.LBB162
+	.byte	0x4
+	.uleb128 .LBB162-.LBB162
+	.uleb128 .LBE162-.LBB162
+	.byte	0x4
+	.uleb128 .LBB190-.LBB162
+	.uleb128 .LBE190-.LBB162
+	.byte	0
+.LLRL69:
+	.byte	0x5
+	.quad	.LBB164
+	.byte	0x4
+	.uleb128 .LBB164-.LBB164
+	.uleb128 .LBE164-.LBB164
+	.byte	0x4
+	.uleb128 .LBB167-.LBB164
+	.uleb128 .LBE167-.LBB164
+	.byte	0
+.LLRL72:
+	.byte	0x5
+	.quad	.LBB169
+	.byte	0x4
+	.uleb128 .LBB169-.LBB169
+	.uleb128 .LBE169-.LBB169
+	.byte	0x4
+	.uleb128 .LBB191-.LBB169
+	.uleb128 .LBE191-.LBB169
+	.byte	0
+.LLRL74:
+	.byte	0x5
+	.quad	.LBB171
+	.byte	0x4
+	.uleb128 .LBB171-.LBB171
+	.uleb128 .LBE171-.LBB171
+	.byte	0x4
+	.uleb128 .LBB174-.LBB171
+	.uleb128 .LBE174-.LBB171
+	.byte	0
+.LLRL77:
+	.byte	0x5
+	.quad	.LBB176
+	.byte	0x4
+	.uleb128 .LBB176-.LBB176
+	.uleb128 .LBE176-.LBB176
+	.byte	0x4
+	.uleb128 .LBB192-.LBB176
+	.uleb128 .LBE192-.LBB176
+	.byte	0
+.LLRL79:
+	.byte	0x5
+	.quad	.LBB178
+	.byte	0x4
+	.uleb128 .LBB178-.LBB178
+	.uleb128 .LBE178-.LBB178
+	.byte	0x4
+	.uleb128 .LBB181-.LBB178
+	.uleb128 .LBE181-.LBB178
+	.byte	0
+.LLRL83:
+	.byte	0x5
+	.quad	.LBB185
+	.byte	0x4
+	.uleb128 .LBB185-.LBB185
+	.uleb128 .LBE185-.LBB185
+	.byte	0x4
+	.uleb128 .LBB188-.LBB185
+	.uleb128 .LBE188-.LBB185
+	.byte	0
+.LLRL91:
+	.byte	0x5
+	.quad	.LBB193
+	.byte	0x4
+	.uleb128 .LBB193-.LBB193
+	.uleb128 .LBE193-.LBB193
+	.byte	0x4
+	.uleb128 .LBB197-.LBB193
+	.uleb128 .LBE197-.LBB193
+	.byte	0x4
+	.uleb128 .LBB198-.LBB193
+	.uleb128 .LBE198-.LBB193
+	.byte	0
+.LLRL104:
+	.byte	0x5
+	.quad	.LBB199
+	.byte	0x4
+	.uleb128 .LBB199-.LBB199
+	.uleb128 .LBE199-.LBB199
+	.byte	0x4
+	.uleb128 .LBB204-.LBB199
+	.uleb128 .LBE204-.LBB199
+	.byte	0x4
+	.uleb128 .LBB205-.LBB199
+	.uleb128 .LBE205-.LBB199
+	.byte	0
+.LLRL105:
+	.byte	0x5
+	.quad	.LBB200
+	.byte	0x4
+	.uleb128 .LBB200-.LBB200
+	.uleb128 .LBE200-.LBB200
+	.byte	0x4
+	.uleb128 .LBB203-.LBB200
+	.uleb128 .LBE203-.LBB200
+	.byte	0
+.LLRL107:
+	.byte	0x7
+	.quad	.LFB32
+	.uleb128 .LHOTE2-.LFB32
+	.byte	0x7
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.byte	0
+.LLRL121:
+	.byte	0x5
+	.quad	.LBB206
+	.byte	0x4
+	.uleb128 .LBB206-.LBB206
+	.uleb128 .LBE206-.LBB206
+	.byte	0x4
+	.uleb128 .LBB216-.LBB206
+	.uleb128 .LBE216-.LBB206
+	.byte	0x7
+	.quad	.LBB217
+	.uleb128 .LBE217-.LBB217
+	.byte	0
+.LLRL125:
+	.byte	0x5
+	.quad	.LBB208
+	.byte	0x4
+	.uleb128 .LBB208-.LBB208
+	.uleb128 .LBE208-.LBB208
+	.byte	0x4
+	.uleb128 .LBB212-.LBB208
+	.uleb128 .LBE212-.LBB208
+	.byte	0x7
+	.quad	.LBB213
+	.uleb128 .LBE213-.LBB213
+	.byte	0
+.LLRL132:
+	.byte	0x7
+	.quad	.Ltext_cold0
+	.uleb128 .Letext_cold0-.Ltext_cold0
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LHOTE0-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LHOTE1-.LFB25
+	.byte	0x7
+	.quad	.LFSB25
+	.uleb128 .LCOLDE1-.LFSB25
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB31
+	.uleb128 .LFE31-.LFB31
+	.byte	0x7
+	.quad	.LFB32
+	.uleb128 .LHOTE2-.LFB32
+	.byte	0x7
+	.quad	.LFSB32
+	.uleb128 .LCOLDE2-.LFSB32
+	.byte	0x7
+	.quad	.LFB33
+	.uleb128 .LFE33-.LFB33
+	.byte	0x7
+	.quad	.LFB34
+	.uleb128 .LFE34-.LFB34
+	.byte	0x7
+	.quad	.LFB35
+	.uleb128 .LFE35-.LFB35
+	.byte	0x7
+	.quad	.LFB36
+	.uleb128 .LFE36-.LFB36
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 32 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 42 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 65 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 66 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 67 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x4
+	.file 68 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 69 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF947
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 70 ".//src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xe
+	.file 71 ".//src/main/drivers/serial_rx_frame.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 72 ".//src/main/drivers/serial_usb_vcp.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF957
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF958
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF963
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF915
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF942
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF946
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial_uart.h.24.1bc399296ceffb0dfdf2f7e2024c7f2a,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF956
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF961
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF1009:
+	.string	"txBuffer"
+.LASF1118:
+	.string	"portConstraint"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1176:
+	.string	"bPtr"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF976:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1044:
+	.string	"requiredSerialPortFeatures"
+.LASF920:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF980:
+	.string	"size_t"
+.LASF1043:
+	.string	"autoBaud"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1087:
+	.string	"cli_baudrate"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF988:
+	.string	"tail"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1062:
+	.string	"SERIAL_PORT_USART2"
+.LASF1095:
+	.string	"FEATURE_RX_SERIAL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1092:
+	.string	"FEATURE_RX_PPM"
+.LASF1069:
+	.string	"SPF_SUPPORTS_SBUS_MODE"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF962:
+	.string	"FUNCTION_CONSTRAINT_COUNT (sizeof(functionConstraints) / sizeof(functionConstraint_t))"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF968:
+	.string	"signed char"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1029:
+	.string	"FUNCTION_CLI"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1175:
+	.string	"aPtr"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF946:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF928:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1006:
+	.string	"inversion"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF922:
+	.string	"USE_GYRO_SITL "
+.LASF810:
+	.string	"__id_t_defined "
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF969:
+	.string	"__int8_t"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF912:
+	.string	"__enable_irq() "
+.LASF1141:
+	.string	"serialPortConstraint"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1056:
+	.string	"serialPortFunctionScenario_e"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1050:
+	.string	"SCENARIO_MSP_ONLY"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF1064:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1065:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF1109:
+	.string	"FEATURE_DISPLAY"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1126:
+	.string	"delay"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF1010:
+	.string	"callback"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1031:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1001:
+	.string	"ringBuffer_s"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF904:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1128:
+	.string	"mspInit"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF914:
+	.string	"U_ID_1 0"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1169:
+	.string	"nextStartIndex"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1150:
+	.string	"canOpenSerialPort"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1148:
+	.string	"result"
+.LASF1101:
+	.string	"FEATURE_SONAR"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1135:
+	.string	"serialInit"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1151:
+	.string	"doesConfigurationUsePort"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF924:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1102:
+	.string	"FEATURE_TELEMETRY"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF958:
+	.string	"MAX_MSP_PORT_COUNT 2"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1137:
+	.string	"openSerialPort"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF974:
+	.string	"long int"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF909:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1034:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1002:
+	.string	"serialPort"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1018:
+	.string	"setRxFrameCallback"
+.LASF941:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF987:
+	.string	"head"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF947:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1108:
+	.string	"FEATURE_LED_STRIP"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1153:
+	.string	"isSerialConfigValid"
+.LASF1097:
+	.string	"FEATURE_SERVO_TILT"
+.LASF977:
+	.string	"uint8_t"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1180:
+	.string	"lookupSerialPortFunctionIndexByIdentifier"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1156:
+	.string	"mspPortCount"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1066:
+	.string	"serialPortIdentifier_e"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF930:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF965:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1166:
+	.string	"resultBuffer"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1030:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF931:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF903:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1177:
+	.string	"countBits_uint32"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF945:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF991:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1024:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF733:
+	.string	"NULL"
+.LASF1115:
+	.string	"serialPortSearchResult_s"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF917:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1119:
+	.string	"functionConstraint"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1099:
+	.string	"FEATURE_GPS"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1103:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1073:
+	.string	"feature"
+.LASF961:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF693:
+	.string	"__need_size_t "
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF957:
+	.string	"CLI_H_ "
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1055:
+	.string	"SCENARIO_BLACKBOX_ONLY"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF972:
+	.string	"__uint16_t"
+.LASF1054:
+	.string	"SCENARIO_TELEMETRY_ONLY"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1058:
+	.string	"SERIAL_PORT_1"
+.LASF1059:
+	.string	"SERIAL_PORT_2"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1178:
+	.string	"findFunctionConstraint"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF919:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1155:
+	.string	"cliPortCount"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF1022:
+	.string	"txCommit"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1016:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF983:
+	.string	"USART_TypeDef"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1060:
+	.string	"serialPortIndex_e"
+.LASF910:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1112:
+	.string	"serialPortFunctions"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1136:
+	.string	"initialSerialConfig"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF999:
+	.string	"serialReceiveCallbackPtr"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF973:
+	.string	"__uint32_t"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF390:
+	.string	"bool _Bool"
+.LASF970:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF985:
+	.string	"buffer"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF954:
+	.string	"UART2_TX_BUFFER_SIZE 64"
+.LASF1013:
+	.string	"serialTotalBytesWaiting"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1149:
+	.string	"isSerialPortFunctionShared"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1040:
+	.string	"function"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF984:
+	.string	"index"
+.LASF1038:
+	.string	"autoBaud_e"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF996:
+	.string	"MODE_RXTX"
+.LASF1061:
+	.string	"SERIAL_PORT_USART1"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1063:
+	.string	"SERIAL_PORT_USART3"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1096:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1067:
+	.string	"SPF_NONE"
+.LASF1008:
+	.string	"rxBuffer"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF990:
+	.string	"ringBuffer_t"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF964:
+	.string	"long unsigned int"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1019:
+	.string	"writeBuf"
+.LASF1127:
+	.string	"cliInit"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF943:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1070:
+	.string	"SPF_IS_SOFTWARE_INVERTABLE"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1140:
+	.string	"searchResult"
+.LASF935:
+	.string	"UNUSED(x) (void)(x)"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF915:
+	.string	"U_ID_2 0"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1094:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF925:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF929:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1187:
+	.string	"getSerialPortFunctionList"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1068:
+	.string	"SPF_SUPPORTS_CALLBACK"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1026:
+	.string	"cliMode"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1132:
+	.string	"evaluateOtherData"
+.LASF1144:
+	.string	"serialPortIdentifier"
+.LASF1045:
+	.string	"functionConstraint_t"
+.LASF1098:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF942:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1152:
+	.string	"portIdentifier"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1114:
+	.string	"functionConstraints"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF981:
+	.string	"long long int"
+.LASF905:
+	.string	"_STRINGS_H 1"
+.LASF997:
+	.string	"MODE_SBUS"
+.LASF1133:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1000:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF956:
+	.string	"UART3_TX_BUFFER_SIZE 64"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF906:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1011:
+	.string	"serialPortVTable"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1100:
+	.string	"FEATURE_FAILSAFE"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1139:
+	.string	"updatedFunctionConstraint"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1106:
+	.string	"FEATURE_RX_MSP"
+.LASF986:
+	.string	"mask"
+.LASF462:
+	.string	"__PMT"
+.LASF955:
+	.string	"UART3_RX_BUFFER_SIZE 128"
+.LASF1047:
+	.string	"SCENARIO_CLI_ONLY"
+.LASF1104:
+	.string	"FEATURE_3D"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF998:
+	.string	"portMode_t"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1084:
+	.string	"serialConfig_s"
+.LASF1091:
+	.string	"serialConfig_t"
+.LASF1125:
+	.string	"cliProcess"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF960:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1134:
+	.string	"handleSerial"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1032:
+	.string	"FUNCTION_GPS"
+.LASF358:
+	.string	"__k8 1"
+.LASF1021:
+	.string	"txReserve"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1078:
+	.string	"currentFunction"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF967:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF938:
+	.string	"UNIT_TESTED "
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1037:
+	.string	"AUTOBAUD"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1039:
+	.string	"functionConstraint_s"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF907:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1027:
+	.string	"FUNCTION_NONE"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1186:
+	.string	"sortSerialPortFunctions"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF899:
+	.string	"alloca"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1014:
+	.string	"serialRead"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF392:
+	.string	"false 0"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF927:
+	.string	"USE_USART1 "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF923:
+	.string	"ACC "
+.LASF1052:
+	.string	"SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1107:
+	.string	"FEATURE_RSSI_ADC"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1025:
+	.string	"sitlUsart"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF933:
+	.string	"PROFILING "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1086:
+	.string	"msp_baudrate"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF735:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1035:
+	.string	"serialPortFunction_e"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1075:
+	.string	"serialPortFunction_s"
+.LASF1079:
+	.string	"serialPortFunction_t"
+.LASF975:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1015:
+	.string	"serialSetBaudRate"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF966:
+	.string	"short unsigned int"
+.LASF1147:
+	.string	"functionMask"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF932:
+	.string	"BLACKBOX "
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF921:
+	.string	"GYRO "
+.LASF911:
+	.string	"__disable_irq() "
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1167:
+	.string	"serialPortFunctionIndex"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1089:
+	.string	"gps_passthrough_baudrate"
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF989:
+	.string	"highWaterMark"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF949:
+	.string	"SOFT_SERIAL_BUFFER_SIZE 256"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1105:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF993:
+	.string	"serialInversion_e"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF982:
+	.string	"long long unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF1171:
+	.string	"swap"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1138:
+	.string	"initialFunctionConstraint"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1007:
+	.string	"baudRate"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF978:
+	.string	"uint16_t"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1182:
+	.string	"lookupScenarioIndex"
+.LASF1120:
+	.string	"startSerialPortFunctionIndex"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF916:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1157:
+	.string	"getConfiguredFunctionConstraint"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1046:
+	.string	"SCENARIO_UNUSED"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1093:
+	.string	"FEATURE_VBAT"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF952:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1082:
+	.string	"functions"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF1057:
+	.string	"serialPortScenarios"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF959:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF1183:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1124:
+	.string	"mspProcess"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1023:
+	.string	"serialPort_t"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1130:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1185:
+	.string	"findSerialPort"
+.LASF1012:
+	.string	"serialWrite"
+.LASF1184:
+	.string	"endSerialPortFunction"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF1042:
+	.string	"maxBaudRate"
+.LASF1158:
+	.string	"configuredFunctionConstraint"
+.LASF1145:
+	.string	"functionIndex"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF902:
+	.string	"_STRING_H 1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF808:
+	.string	"__off_t_defined "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1090:
+	.string	"reboot_character"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF934:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1053:
+	.string	"SCENARIO_SERIAL_RX_ONLY"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF950:
+	.string	"SERIAL_RX_FRAME_MAX_SIZE 40"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1122:
+	.string	"serialPortFunctionList"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1113:
+	.string	"serialPortConstraints"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF1081:
+	.string	"serialPortCount"
+.LASF1172:
+	.string	"index1"
+.LASF1173:
+	.string	"index2"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF951:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF963:
+	.string	"IDENTIFIER_NOT_FOUND 0xFF"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF992:
+	.string	"SERIAL_INVERTED"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1129:
+	.string	"uartOpen"
+.LASF1161:
+	.string	"findOpenSerialPort"
+.LASF1076:
+	.string	"port"
+.LASF1048:
+	.string	"SCENARIO_GPS_ONLY"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1110:
+	.string	"FEATURE_BLACKBOX"
+.LASF948:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF926:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1159:
+	.string	"serialPorts"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF971:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1005:
+	.string	"mode"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1117:
+	.string	"portFunction"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF918:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF994:
+	.string	"MODE_RX"
+.LASF1142:
+	.string	"serialPortFunction"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1071:
+	.string	"serialPortFeature_t"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1121:
+	.string	"serialPortSearchResult_t"
+.LASF939:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF913:
+	.string	"U_ID_0 0x5349544c"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1170:
+	.string	"elements"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1123:
+	.string	"systemResetToBootloader"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF940:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF944:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF1154:
+	.string	"serialConfigToCheck"
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1072:
+	.string	"serialPortConstraint_s"
+.LASF1074:
+	.string	"serialPortConstraint_t"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1088:
+	.string	"gps_baudrate"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1179:
+	.string	"functionConstraintIndex"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF1131:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1049:
+	.string	"SCENARIO_GPS_PASSTHROUGH_ONLY"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1036:
+	.string	"NO_AUTOBAUD"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1085:
+	.string	"serial_port_scenario"
+.LASF1077:
+	.string	"scenario"
+.LASF1143:
+	.string	"applySerialConfigToPortFunctions"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1028:
+	.string	"FUNCTION_MSP"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF995:
+	.string	"MODE_TX"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1116:
+	.string	"portIndex"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF1041:
+	.string	"minBaudRate"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1165:
+	.string	"findNextSerialPort"
+.LASF979:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF1164:
+	.string	"serialPortSearchResult"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1111:
+	.string	"serialConfig"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1017:
+	.string	"setMode"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1020:
+	.string	"readBuf"
+.LASF1051:
+	.string	"SCENARIO_MSP_CLI_GPS_PASTHROUGH"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1080:
+	.string	"serialPortFunctionList_s"
+.LASF1083:
+	.string	"serialPortFunctionList_t"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF953:
+	.string	"UART2_RX_BUFFER_SIZE 128"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1003:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1033:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1181:
+	.string	"lookupSerialPortIndexByIdentifier"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF937:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1162:
+	.string	"findSerialPortFunctionByPort"
+.LASF1146:
+	.string	"functionToUse"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1168:
+	.string	"serialPortIndex"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1004:
+	.string	"identifier"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1174:
+	.string	"serialPortFunctionMostSpecificFirstComparator"
+.LASF1163:
+	.string	"findSerialPortFunction"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1160:
+	.string	"beginSerialPortFunction"
+.LASF908:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	".//src/main/io/serial.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
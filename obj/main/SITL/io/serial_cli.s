@@ -0,0 +1,33724 @@
+	.file	"serial_cli.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/io/serial_cli.c"
+	.section	.rodata.cliVersion.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Cleanflight/%s %s / %s (%s)"
+	.section	.text.cliVersion,"ax",@progbits
+	.p2align 4
+	.type	cliVersion, @function
+cliVersion:
+.LVL0:
+.LFB38:
+	.file 1 ".//src/main/io/serial_cli.c"
+	.loc 1 1083 1 view -0
+	.cfi_startproc
+	.loc 1 1084 5 view .LVU1
+	.loc 1 1086 5 view .LVU2
+	movq	shortGitRevision(%rip), %r8
+	movq	buildTime(%rip), %rcx
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+.LVL1:
+	.loc 1 1086 5 is_stmt 0 view .LVU3
+	movq	buildDate(%rip), %rdx
+	movq	targetName(%rip), %rsi
+	jmp	tfp_printf@PLT
+.LVL2:
+	.cfi_endproc
+.LFE38:
+	.size	cliVersion, .-cliVersion
+	.section	.rodata.cliHelp.str1.1,"aMS",@progbits,1
+.LC1:
+	.string	"Available commands:\r\n"
+.LC2:
+	.string	"%s\t%s\r\n"
+	.section	.text.cliHelp,"ax",@progbits
+	.p2align 4
+	.type	cliHelp, @function
+cliHelp:
+.LVL3:
+.LFB22:
+	.loc 1 658 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 659 5 view .LVU5
+	.loc 1 661 5 view .LVU6
+	.loc 1 663 5 view .LVU7
+.LBB187:
+.LBI187:
+	.loc 1 820 13 view .LVU8
+.LBB188:
+	.loc 1 822 5 view .LVU9
+.LBE188:
+.LBE187:
+	.loc 1 658 1 is_stmt 0 view .LVU10
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB191:
+.LBB189:
+	.loc 1 822 5 view .LVU11
+	movq	cliPort(%rip), %rdi
+.LVL4:
+	.loc 1 822 5 view .LVU12
+	leaq	.LC1(%rip), %rsi
+.LBE189:
+.LBE191:
+	.loc 1 658 1 view .LVU13
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	.LC2(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	leaq	cmdTable(%rip), %rbx
+	leaq	408(%rbx), %r12
+.LBB192:
+.LBB190:
+	.loc 1 822 5 view .LVU14
+	call	serialPrint@PLT
+.LVL5:
+	.loc 1 822 5 view .LVU15
+.LBE190:
+.LBE192:
+	.loc 1 664 5 is_stmt 1 view .LVU16
+	.loc 1 664 19 view .LVU17
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 665 9 discriminator 3 view .LVU18
+	movq	8(%rbx), %rdx
+	movq	(%rbx), %rsi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	.loc 1 664 19 is_stmt 0 discriminator 3 view .LVU19
+	addq	$24, %rbx
+.LVL6:
+	.loc 1 665 9 discriminator 3 view .LVU20
+	call	tfp_printf@PLT
+.LVL7:
+	.loc 1 664 61 is_stmt 1 discriminator 3 view .LVU21
+	.loc 1 664 19 discriminator 3 view .LVU22
+	cmpq	%r12, %rbx
+	jne	.L4
+	.loc 1 666 1 is_stmt 0 view .LVU23
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	cliHelp, .-cliHelp
+	.section	.rodata.cliStatus.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"GYRO"
+	.section	.rodata.cliStatus.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"System Uptime: %d seconds, Voltage: %d * 0.1V (%dS battery)\r\n"
+	.section	.rodata.cliStatus.str1.1
+.LC5:
+	.string	"CPU %dMHz, detected sensors: "
+.LC6:
+	.string	"%s "
+.LC7:
+	.string	"ACCHW: %s"
+.LC8:
+	.string	".%c"
+.LC9:
+	.string	"\r\n"
+.LC10:
+	.string	"Boot:"
+.LC11:
+	.string	" %s %dms"
+	.section	.rodata.cliStatus.str1.8
+	.align 8
+.LC12:
+	.string	"Cycle Time: %d, I2C Errors: %d, config size: %d\r\n"
+	.align 8
+.LC13:
+	.string	"Mixer: %d mixes, corrections scaled %d, motors lowered %d, raised %d\r\n"
+	.align 8
+.LC14:
+	.string	"Serial %d buffers used: rx %d/%d, tx %d/%d\r\n"
+	.section	.text.cliStatus,"ax",@progbits
+	.p2align 4
+	.type	cliStatus, @function
+cliStatus:
+.LVL8:
+.LFB36:
+	.loc 1 936 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 937 5 view .LVU25
+	.loc 1 938 5 view .LVU26
+	.loc 1 940 5 view .LVU27
+	.loc 1 942 5 view .LVU28
+	.loc 1 936 1 is_stmt 0 view .LVU29
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	sensorNames(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 951 13 view .LVU30
+	leaq	.LC6(%rip), %r12
+	.loc 1 936 1 view .LVU31
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 942 5 view .LVU32
+	movzbl	batteryCellCount(%rip), %ebp
+	movzbl	vbat(%rip), %ebx
+	.loc 1 943 9 view .LVU33
+	call	millis@PLT
+.LVL9:
+	.loc 1 942 5 view .LVU34
+	leaq	.LC4(%rip), %rdi
+	movl	%eax, %esi
+	movl	%ebp, %ecx
+	movl	%ebx, %edx
+	xorl	%eax, %eax
+	imulq	$274877907, %rsi, %rsi
+	.loc 1 947 12 view .LVU35
+	xorl	%ebx, %ebx
+	.loc 1 942 5 view .LVU36
+	shrq	$38, %rsi
+	call	tfp_printf@PLT
+.LVL10:
+	.loc 1 944 5 is_stmt 1 view .LVU37
+	.loc 1 944 12 is_stmt 0 view .LVU38
+	call	sensorsMask@PLT
+.LVL11:
+	.loc 1 946 5 view .LVU39
+	movl	SystemCoreClock(%rip), %esi
+	leaq	.LC5(%rip), %rdi
+	.loc 1 944 12 view .LVU40
+	movl	%eax, %ebp
+.LVL12:
+	.loc 1 946 5 is_stmt 1 view .LVU41
+	xorl	%eax, %eax
+.LVL13:
+	.loc 1 946 5 is_stmt 0 view .LVU42
+	imulq	$1125899907, %rsi, %rsi
+	shrq	$50, %rsi
+	call	tfp_printf@PLT
+.LVL14:
+	.loc 1 947 5 is_stmt 1 view .LVU43
+	.loc 1 948 9 view .LVU44
+	.loc 1 948 24 is_stmt 0 view .LVU45
+	leaq	.LC3(%rip), %rsi
+	xorl	%eax, %eax
+	jmp	.L9
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 947 20 is_stmt 1 view .LVU46
+	addl	$1, %ebx
+.LVL16:
+	.loc 1 947 5 view .LVU47
+	.loc 1 948 9 view .LVU48
+	.loc 1 948 24 is_stmt 0 view .LVU49
+	movzbl	%bl, %edx
+	movzbl	%bl, %eax
+	movq	0(%r13,%rdx,8), %rsi
+	.loc 1 948 12 view .LVU50
+	testq	%rsi, %rsi
+	je	.L30
+.LVL17:
+.L9:
+	.loc 1 950 9 is_stmt 1 view .LVU51
+	.loc 1 950 12 is_stmt 0 view .LVU52
+	btl	%eax, %ebp
+	jnc	.L8
+	.loc 1 951 13 is_stmt 1 view .LVU53
+	movq	%r12, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL18:
+	jmp	.L8
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.loc 1 953 5 view .LVU54
+	.loc 1 953 9 is_stmt 0 view .LVU55
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL19:
+	.loc 1 953 8 view .LVU56
+	testb	%al, %al
+	jne	.L31
+.L11:
+	.loc 1 958 5 is_stmt 1 view .LVU57
+.LVL20:
+.LBB193:
+.LBI193:
+	.loc 1 820 13 view .LVU58
+.LBB194:
+	.loc 1 822 5 view .LVU59
+	movq	cliPort(%rip), %rdi
+	leaq	.LC9(%rip), %r13
+.LBE194:
+.LBE193:
+.LBB196:
+.LBB197:
+	xorl	%ebx, %ebx
+.LVL21:
+	.loc 1 822 5 is_stmt 0 view .LVU60
+	leaq	.LC11(%rip), %r12
+.LBE197:
+.LBE196:
+.LBB199:
+.LBB195:
+	movq	%r13, %rsi
+	call	serialPrint@PLT
+.LVL22:
+	.loc 1 822 5 view .LVU61
+.LBE195:
+.LBE199:
+	.loc 1 961 5 is_stmt 1 view .LVU62
+.LBB200:
+.LBI196:
+	.loc 1 820 13 view .LVU63
+.LBB198:
+	.loc 1 822 5 view .LVU64
+	movq	cliPort(%rip), %rdi
+	leaq	.LC10(%rip), %rsi
+	call	serialPrint@PLT
+.LVL23:
+	.loc 1 822 5 is_stmt 0 view .LVU65
+.LBE198:
+.LBE200:
+	.loc 1 962 5 is_stmt 1 view .LVU66
+	.loc 1 962 19 view .LVU67
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 963 9 discriminator 3 view .LVU68
+	movl	%ebx, %edi
+	call	getBootStageMilliseconds@PLT
+.LVL24:
+	movl	%ebx, %edi
+	.loc 1 962 19 is_stmt 0 discriminator 3 view .LVU69
+	addl	$1, %ebx
+.LVL25:
+	.loc 1 963 9 discriminator 3 view .LVU70
+	movl	%eax, %ebp
+	call	getBootStageName@PLT
+.LVL26:
+	movl	%ebp, %edx
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL27:
+	.loc 1 962 40 is_stmt 1 discriminator 3 view .LVU71
+	.loc 1 962 19 discriminator 3 view .LVU72
+	cmpl	$7, %ebx
+	jne	.L13
+	.loc 1 965 5 view .LVU73
+.LVL28:
+.LBB201:
+.LBI201:
+	.loc 1 820 13 view .LVU74
+.LBB202:
+	.loc 1 822 5 view .LVU75
+	movq	cliPort(%rip), %rdi
+	movq	%r13, %rsi
+	call	serialPrint@PLT
+.LVL29:
+	.loc 1 822 5 is_stmt 0 view .LVU76
+.LBE202:
+.LBE201:
+	.loc 1 970 5 is_stmt 1 view .LVU77
+	.loc 1 973 5 view .LVU78
+	movzwl	cycleTime(%rip), %esi
+	xorl	%edx, %edx
+	xorl	%eax, %eax
+	movl	$2012, %ecx
+	leaq	.LC12(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL30:
+	.loc 1 976 5 view .LVU79
+	.loc 1 976 48 is_stmt 0 view .LVU80
+	call	getMixerSaturation@PLT
+.LVL31:
+	.loc 1 977 5 is_stmt 1 view .LVU81
+	leaq	.LC13(%rip), %rdi
+	movl	8(%rax), %ecx
+	movl	4(%rax), %edx
+	movl	(%rax), %esi
+	movl	12(%rax), %r8d
+	xorl	%eax, %eax
+.LVL32:
+	.loc 1 977 5 is_stmt 0 view .LVU82
+	call	tfp_printf@PLT
+.LVL33:
+	.loc 1 982 5 is_stmt 1 view .LVU83
+	.loc 1 982 62 is_stmt 0 view .LVU84
+	call	getSerialPortFunctionList@PLT
+.LVL34:
+	.loc 1 983 19 view .LVU85
+	cmpb	$0, (%rax)
+	.loc 1 982 62 view .LVU86
+	movq	%rax, %r12
+.LVL35:
+	.loc 1 983 5 is_stmt 1 view .LVU87
+	.loc 1 983 19 view .LVU88
+	je	.L7
+	.loc 1 983 12 is_stmt 0 view .LVU89
+	xorl	%ebp, %ebp
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+.LBB203:
+	.loc 1 984 9 is_stmt 1 view .LVU90
+	.loc 1 984 63 is_stmt 0 view .LVU91
+	movzbl	%bpl, %eax
+	leaq	(%rax,%rax,2), %r13
+	.loc 1 984 23 view .LVU92
+	movq	8(%r12), %rax
+	movq	8(%rax,%r13,8), %rbx
+.LVL37:
+	.loc 1 985 9 is_stmt 1 view .LVU93
+	.loc 1 985 12 is_stmt 0 view .LVU94
+	testq	%rbx, %rbx
+	je	.L15
+	.loc 1 988 9 is_stmt 1 view .LVU95
+	.loc 1 991 58 is_stmt 0 view .LVU96
+	leaq	40(%rbx), %rdi
+	.loc 1 991 43 view .LVU97
+	call	ringBufferSize@PLT
+.LVL38:
+	.loc 1 990 58 view .LVU98
+	leaq	24(%rbx), %rdi
+	.loc 1 988 9 view .LVU99
+	movzwl	54(%rbx), %r15d
+	.loc 1 991 43 view .LVU100
+	movl	%eax, %r14d
+	.loc 1 990 43 view .LVU101
+	call	ringBufferSize@PLT
+.LVL39:
+	.loc 1 989 49 view .LVU102
+	movq	8(%r12), %rsi
+	.loc 1 988 9 view .LVU103
+	movzwl	%r14w, %r9d
+	movl	%r15d, %r8d
+	movzwl	%ax, %ecx
+	movzwl	38(%rbx), %eax
+	leaq	.LC14(%rip), %rdi
+	movl	(%rsi,%r13,8), %esi
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL40:
+.L15:
+.LBE203:
+	.loc 1 983 63 is_stmt 1 discriminator 2 view .LVU104
+	addl	$1, %ebp
+.LVL41:
+	.loc 1 983 19 discriminator 2 view .LVU105
+	cmpb	(%r12), %bpl
+	jb	.L16
+.LVL42:
+.L7:
+	.loc 1 994 1 is_stmt 0 view .LVU106
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL43:
+	.loc 1 994 1 view .LVU107
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	.cfi_restore_state
+	.loc 1 954 9 is_stmt 1 view .LVU108
+	.loc 1 954 41 is_stmt 0 view .LVU109
+	movzbl	accHardware(%rip), %edx
+	.loc 1 954 9 view .LVU110
+	leaq	accNames(%rip), %rax
+	leaq	.LC7(%rip), %rdi
+	movq	(%rax,%rdx,8), %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL45:
+	.loc 1 955 9 is_stmt 1 view .LVU111
+	.loc 1 955 16 is_stmt 0 view .LVU112
+	movzbl	16+acc(%rip), %eax
+	.loc 1 955 12 view .LVU113
+	testb	%al, %al
+	je	.L11
+	.loc 1 956 13 is_stmt 1 view .LVU114
+	movsbl	%al, %esi
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL46:
+	jmp	.L11
+	.cfi_endproc
+.LFE36:
+	.size	cliStatus, .-cliStatus
+	.section	.rodata.cliMixer.str1.1,"aMS",@progbits,1
+.LC15:
+	.string	"TRI"
+.LC16:
+	.string	"Current mixer: %s\r\n"
+.LC17:
+	.string	"list"
+.LC18:
+	.string	"Available mixers: "
+.LC19:
+	.string	"Invalid mixer type\r\n"
+.LC20:
+	.string	"Mixer set to %s\r\n"
+	.section	.text.cliMixer,"ax",@progbits
+	.p2align 4
+	.type	cliMixer, @function
+cliMixer:
+.LVL47:
+.LFB24:
+	.loc 1 696 1 view -0
+	.cfi_startproc
+	.loc 1 697 5 view .LVU116
+	.loc 1 698 5 view .LVU117
+	.loc 1 700 5 view .LVU118
+	.loc 1 696 1 is_stmt 0 view .LVU119
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	movq	%rdi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 700 11 view .LVU120
+	call	strlen@PLT
+.LVL48:
+	.loc 1 702 5 is_stmt 1 view .LVU121
+	.loc 1 702 8 is_stmt 0 view .LVU122
+	testl	%eax, %eax
+	je	.L44
+	.loc 1 705 12 is_stmt 1 view .LVU123
+	.loc 1 705 16 is_stmt 0 view .LVU124
+	movslq	%eax, %r12
+	leaq	.LC17(%rip), %rsi
+	movq	%r13, %rdi
+	xorl	%ebp, %ebp
+	movq	%r12, %rdx
+	.loc 1 717 23 view .LVU125
+	leaq	.LC15(%rip), %rbx
+	leaq	mixerNames(%rip), %r14
+	.loc 1 705 16 view .LVU126
+	call	strncasecmp@PLT
+.LVL49:
+	.loc 1 705 15 view .LVU127
+	testl	%eax, %eax
+	jne	.L34
+	jmp	.L45
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.loc 1 716 20 is_stmt 1 view .LVU128
+	.loc 1 716 5 view .LVU129
+	.loc 1 717 9 view .LVU130
+	.loc 1 717 12 is_stmt 0 view .LVU131
+	addq	$1, %rbp
+.LVL51:
+	.loc 1 717 23 view .LVU132
+	movq	(%r14,%rbp,8), %rbx
+	.loc 1 717 12 view .LVU133
+	testq	%rbx, %rbx
+	je	.L46
+.LVL52:
+.L34:
+	.loc 1 721 9 is_stmt 1 view .LVU134
+	.loc 1 721 13 is_stmt 0 view .LVU135
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	strncasecmp@PLT
+.LVL53:
+	.loc 1 721 12 view .LVU136
+	testl	%eax, %eax
+	jne	.L36
+	.loc 1 722 13 is_stmt 1 view .LVU137
+	.loc 1 722 49 is_stmt 0 view .LVU138
+	addl	$1, %ebp
+.LVL54:
+	.loc 1 723 13 view .LVU139
+	movq	%rbx, %rsi
+	leaq	.LC20(%rip), %rdi
+	.loc 1 727 1 view .LVU140
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 722 49 view .LVU141
+	movb	%bpl, masterConfig(%rip)
+	.loc 1 723 13 is_stmt 1 view .LVU142
+	.loc 1 727 1 is_stmt 0 view .LVU143
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL55:
+	.loc 1 727 1 view .LVU144
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL56:
+	.loc 1 727 1 view .LVU145
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL57:
+	.loc 1 727 1 view .LVU146
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	.loc 1 723 13 view .LVU147
+	jmp	tfp_printf@PLT
+.LVL58:
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.cfi_restore_state
+	.loc 1 718 13 is_stmt 1 view .LVU148
+.LBB204:
+.LBI204:
+	.loc 1 820 13 view .LVU149
+.LBB205:
+	.loc 1 822 5 view .LVU150
+	leaq	.LC19(%rip), %rsi
+.LVL59:
+.L43:
+	.loc 1 822 5 is_stmt 0 view .LVU151
+	movq	cliPort(%rip), %rdi
+.LBE205:
+.LBE204:
+	.loc 1 727 1 view .LVU152
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL60:
+	.loc 1 727 1 view .LVU153
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL61:
+	.loc 1 727 1 view .LVU154
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LBB207:
+.LBB206:
+	.loc 1 822 5 view .LVU155
+	jmp	serialPrint@PLT
+.LVL62:
+	.p2align 4,,10
+	.p2align 3
+.L44:
+	.cfi_restore_state
+	.loc 1 822 5 view .LVU156
+.LBE206:
+.LBE207:
+	.loc 1 703 9 is_stmt 1 view .LVU157
+	.loc 1 703 68 is_stmt 0 view .LVU158
+	movzbl	masterConfig(%rip), %eax
+.LVL63:
+	.loc 1 703 9 view .LVU159
+	leaq	mixerNames(%rip), %rdx
+	.loc 1 727 1 view .LVU160
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 703 9 view .LVU161
+	leaq	.LC16(%rip), %rdi
+	.loc 1 727 1 view .LVU162
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	.loc 1 703 88 view .LVU163
+	subl	$1, %eax
+	.loc 1 727 1 view .LVU164
+	popq	%r13
+	.cfi_def_cfa_offset 16
+.LVL64:
+	.loc 1 727 1 view .LVU165
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	.loc 1 703 55 view .LVU166
+	cltq
+	.loc 1 703 9 view .LVU167
+	movq	(%rdx,%rax,8), %rsi
+	xorl	%eax, %eax
+	.loc 1 723 13 view .LVU168
+	jmp	tfp_printf@PLT
+.LVL65:
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	.cfi_restore_state
+	.loc 1 706 9 is_stmt 1 view .LVU169
+.LBB208:
+.LBI208:
+	.loc 1 820 13 view .LVU170
+.LBB209:
+	.loc 1 822 5 view .LVU171
+	movq	cliPort(%rip), %rdi
+	leaq	.LC18(%rip), %rsi
+	leaq	8(%r14), %rbp
+	call	serialPrint@PLT
+.LVL66:
+	.loc 1 822 5 is_stmt 0 view .LVU172
+.LBE209:
+.LBE208:
+	.loc 1 707 9 is_stmt 1 view .LVU173
+	.loc 1 708 13 view .LVU174
+	.loc 1 708 27 is_stmt 0 view .LVU175
+	movq	%rbx, %rsi
+	leaq	.LC6(%rip), %rbx
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L35:
+	.loc 1 710 13 is_stmt 1 view .LVU176
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	.loc 1 708 16 is_stmt 0 view .LVU177
+	addq	$8, %rbp
+.LVL68:
+	.loc 1 710 13 view .LVU178
+	call	tfp_printf@PLT
+.LVL69:
+	.loc 1 707 24 is_stmt 1 view .LVU179
+	.loc 1 707 9 view .LVU180
+	.loc 1 708 13 view .LVU181
+	.loc 1 708 27 is_stmt 0 view .LVU182
+	movq	-8(%rbp), %rsi
+	.loc 1 708 16 view .LVU183
+	testq	%rsi, %rsi
+	jne	.L35
+	.loc 1 712 9 is_stmt 1 view .LVU184
+.LVL70:
+.LBB210:
+.LBI210:
+	.loc 1 820 13 view .LVU185
+.LBB211:
+	.loc 1 822 5 view .LVU186
+	leaq	.LC9(%rip), %rsi
+	jmp	.L43
+.LBE211:
+.LBE210:
+	.cfi_endproc
+.LFE24:
+	.size	cliMixer, .-cliMixer
+	.section	.rodata.cliPrintVar.str1.1,"aMS",@progbits,1
+.LC21:
+	.string	"%s"
+.LC22:
+	.string	" %s"
+.LC23:
+	.string	"%d"
+.LC24:
+	.string	" %d %d"
+	.section	.text.cliPrintVar,"ax",@progbits
+	.p2align 4
+	.type	cliPrintVar, @function
+cliPrintVar:
+.LVL71:
+.LFB32:
+	.loc 1 831 1 view -0
+	.cfi_startproc
+	.loc 1 832 5 view .LVU188
+	.loc 1 831 1 is_stmt 0 view .LVU189
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp
+	.loc 1 832 31 view .LVU190
+	movq	%rdi, %rsi
+.LVL72:
+	.loc 1 831 1 view .LVU191
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	.loc 1 832 31 view .LVU192
+	leaq	masterConfig(%rip), %rdi
+.LVL73:
+	.loc 1 831 1 view .LVU193
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 832 31 view .LVU194
+	movzbl	2008+masterConfig(%rip), %edx
+	call	configValueGet@PLT
+.LVL74:
+	movl	%eax, %esi
+.LVL75:
+	.loc 1 833 5 is_stmt 1 view .LVU195
+	.loc 1 835 5 view .LVU196
+	.loc 1 835 8 is_stmt 0 view .LVU197
+	testb	$32, 10(%rbx)
+	jne	.L56
+	.loc 1 843 5 is_stmt 1 view .LVU198
+	xorl	%eax, %eax
+.LVL76:
+	.loc 1 843 5 is_stmt 0 view .LVU199
+	leaq	.LC23(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL77:
+	.loc 1 844 5 is_stmt 1 view .LVU200
+	.loc 1 844 8 is_stmt 0 view .LVU201
+	testl	%ebp, %ebp
+	jne	.L57
+.L47:
+	.loc 1 846 1 view .LVU202
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL78:
+	.loc 1 846 1 view .LVU203
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL79:
+	.loc 1 846 1 view .LVU204
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL80:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.cfi_restore_state
+	.loc 1 845 9 is_stmt 1 view .LVU205
+	movl	20(%rbx), %edx
+	movl	16(%rbx), %esi
+	.loc 1 846 1 is_stmt 0 view .LVU206
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	.loc 1 845 9 view .LVU207
+	xorl	%eax, %eax
+	.loc 1 846 1 view .LVU208
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL81:
+	.loc 1 845 9 view .LVU209
+	leaq	.LC24(%rip), %rdi
+	.loc 1 846 1 view .LVU210
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL82:
+	.loc 1 846 1 view .LVU211
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	.loc 1 845 9 view .LVU212
+	jmp	tfp_printf@PLT
+.LVL83:
+	.p2align 4,,10
+	.p2align 3
+.L56:
+	.cfi_restore_state
+	.loc 1 836 9 is_stmt 1 view .LVU213
+	leaq	8(%rsp), %r12
+	movd	%eax, %xmm0
+	movq	%r12, %rdi
+	call	ftoa@PLT
+.LVL84:
+	.loc 1 836 9 is_stmt 0 view .LVU214
+	leaq	.LC21(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL85:
+	.loc 1 837 9 is_stmt 1 view .LVU215
+	.loc 1 837 12 is_stmt 0 view .LVU216
+	testl	%ebp, %ebp
+	je	.L47
+	.loc 1 838 13 is_stmt 1 view .LVU217
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rdi
+	leaq	.LC22(%rip), %rbp
+.LVL86:
+	.loc 1 838 13 is_stmt 0 view .LVU218
+	cvtsi2ssl	16(%rbx), %xmm0
+	call	ftoa@PLT
+.LVL87:
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL88:
+	.loc 1 839 13 is_stmt 1 view .LVU219
+	pxor	%xmm0, %xmm0
+	movq	%r12, %rdi
+	cvtsi2ssl	20(%rbx), %xmm0
+	call	ftoa@PLT
+.LVL89:
+	movq	%rbp, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL90:
+	.loc 1 841 9 view .LVU220
+	.loc 1 846 1 is_stmt 0 view .LVU221
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL91:
+	.loc 1 846 1 view .LVU222
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	cliPrintVar, .-cliPrintVar
+	.section	.rodata.dumpValues.str1.1,"aMS",@progbits,1
+.LC25:
+	.string	"set %s = "
+	.section	.text.dumpValues,"ax",@progbits
+	.p2align 4
+	.type	dumpValues, @function
+dumpValues:
+.LVL92:
+.LFB17:
+	.loc 1 412 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 413 5 view .LVU224
+	.loc 1 414 5 view .LVU225
+	.loc 1 415 5 view .LVU226
+	.loc 1 415 19 view .LVU227
+	movzwl	configValueCount(%rip), %edx
+	testw	%dx, %dx
+	je	.L70
+	.loc 1 412 1 is_stmt 0 view .LVU228
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	leal	-1(%rdx), %eax
+	.loc 1 422 9 view .LVU229
+	leaq	.LC25(%rip), %r14
+	.loc 1 412 1 view .LVU230
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	leaq	(%rax,%rax,2), %rdx
+.LBB212:
+.LBB213:
+	.loc 1 822 5 view .LVU231
+	leaq	.LC9(%rip), %r13
+.LBE213:
+.LBE212:
+	.loc 1 412 1 view .LVU232
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movl	%edi, %ebp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	leaq	configValues(%rip), %rbx
+	leaq	24(%rbx), %rax
+	leaq	(%rax,%rdx,8), %r12
+.LVL93:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.loc 1 416 9 is_stmt 1 view .LVU233
+	.loc 1 418 9 view .LVU234
+	.loc 1 418 34 is_stmt 0 view .LVU235
+	movl	%ebp, %eax
+	andb	10(%rbx), %al
+	.loc 1 418 12 view .LVU236
+	je	.L60
+	.loc 1 422 9 is_stmt 1 view .LVU237
+	movq	(%rbx), %rsi
+	movq	%r14, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL94:
+	.loc 1 423 9 view .LVU238
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	cliPrintVar
+.LVL95:
+	.loc 1 424 9 view .LVU239
+.LBB215:
+.LBI212:
+	.loc 1 820 13 view .LVU240
+.LBB214:
+	.loc 1 822 5 view .LVU241
+	movq	cliPort(%rip), %rdi
+	movq	%r13, %rsi
+	call	serialPrint@PLT
+.LVL96:
+.L60:
+	.loc 1 822 5 is_stmt 0 view .LVU242
+.LBE214:
+.LBE215:
+	.loc 1 415 40 is_stmt 1 discriminator 2 view .LVU243
+	.loc 1 415 19 discriminator 2 view .LVU244
+	addq	$24, %rbx
+.LVL97:
+	.loc 1 415 19 is_stmt 0 discriminator 2 view .LVU245
+	cmpq	%r12, %rbx
+	jne	.L61
+	.loc 1 426 1 view .LVU246
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL98:
+	.loc 1 426 1 view .LVU247
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL99:
+	.loc 1 426 1 view .LVU248
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L70:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.loc 1 426 1 view .LVU249
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	dumpValues, .-dumpValues
+	.section	.rodata.cliMap.str1.8,"aMS",@progbits,1
+	.align 8
+.LC26:
+	.string	"Must be any order of AETR1234\r\n"
+	.section	.rodata.cliMap.str1.1,"aMS",@progbits,1
+.LC27:
+	.string	"Current assignment: "
+.LC28:
+	.string	"%s\r\n"
+	.section	.text.cliMap,"ax",@progbits
+	.p2align 4
+	.type	cliMap, @function
+cliMap:
+.LVL101:
+.LFB23:
+	.loc 1 669 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 670 5 view .LVU251
+	.loc 1 671 5 view .LVU252
+	.loc 1 672 5 view .LVU253
+	.loc 1 674 5 view .LVU254
+	.loc 1 669 1 is_stmt 0 view .LVU255
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	leaq	310+masterConfig(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	leaq	rcChannelLetters(%rip), %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 674 11 view .LVU256
+	call	strlen@PLT
+.LVL102:
+	.loc 1 676 5 is_stmt 1 view .LVU257
+	.loc 1 676 8 is_stmt 0 view .LVU258
+	cmpl	$8, %eax
+	jne	.L74
+.LBB216:
+	.loc 1 679 45 view .LVU259
+	call	__ctype_toupper_loc@PLT
+.LVL103:
+	.loc 1 679 45 view .LVU260
+	leaq	8(%rbp), %rdi
+	movq	%rbp, %rdx
+	.p2align 4,,10
+	.p2align 3
+.L75:
+.LVL104:
+	.loc 1 679 45 view .LVU261
+.LBE216:
+	.loc 1 679 13 is_stmt 1 discriminator 2 view .LVU262
+.LBB217:
+	.loc 1 679 43 discriminator 2 view .LVU263
+	.loc 1 679 54 discriminator 2 view .LVU264
+	.loc 1 679 35 discriminator 2 view .LVU265
+	.loc 1 679 29 discriminator 2 view .LVU266
+	.loc 1 679 69 is_stmt 0 discriminator 2 view .LVU267
+	movzbl	(%rdx), %esi
+	.loc 1 679 41 discriminator 2 view .LVU268
+	movq	(%rax), %rcx
+.LBE217:
+	.loc 1 678 23 discriminator 2 view .LVU269
+	addq	$1, %rdx
+.LVL105:
+	.loc 1 679 24 discriminator 2 view .LVU270
+	movl	(%rcx,%rsi,4), %ecx
+	movb	%cl, -1(%rdx)
+.LVL106:
+	.loc 1 678 29 is_stmt 1 discriminator 2 view .LVU271
+	.loc 1 678 23 discriminator 2 view .LVU272
+	cmpq	%rdx, %rdi
+	jne	.L75
+	leaq	1(%rbp), %r12
+	leaq	9(%rbp), %r14
+	leaq	rcChannelLetters(%rip), %rbx
+.L77:
+.LVL107:
+	.loc 1 681 13 view .LVU273
+	.loc 1 681 17 is_stmt 0 view .LVU274
+	movsbl	-1(%r12), %r13d
+	movq	%rbx, %rdi
+	movl	%r13d, %esi
+	call	strchr@PLT
+.LVL108:
+	.loc 1 681 16 view .LVU275
+	testq	%rax, %rax
+	je	.L76
+	.loc 1 681 58 discriminator 1 view .LVU276
+	movl	%r13d, %esi
+	movq	%r12, %rdi
+	call	strchr@PLT
+.LVL109:
+	.loc 1 681 54 discriminator 1 view .LVU277
+	testq	%rax, %rax
+	je	.L90
+.L76:
+	.loc 1 683 13 is_stmt 1 view .LVU278
+.LVL110:
+.LBB218:
+.LBI218:
+	.loc 1 820 13 view .LVU279
+.LBB219:
+	.loc 1 822 5 view .LVU280
+	movq	cliPort(%rip), %rdi
+.LBE219:
+.LBE218:
+	.loc 1 693 1 is_stmt 0 view .LVU281
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+.LBB222:
+.LBB220:
+	.loc 1 822 5 view .LVU282
+	leaq	.LC26(%rip), %rsi
+.LBE220:
+.LBE222:
+	.loc 1 693 1 view .LVU283
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL111:
+	.loc 1 693 1 view .LVU284
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+.LVL112:
+.LBB223:
+.LBB221:
+	.loc 1 822 5 view .LVU285
+	jmp	serialPrint@PLT
+.LVL113:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.cfi_restore_state
+	.loc 1 822 5 view .LVU286
+.LBE221:
+.LBE223:
+	.loc 1 682 17 is_stmt 1 discriminator 2 view .LVU287
+	.loc 1 680 29 discriminator 2 view .LVU288
+	.loc 1 680 23 discriminator 2 view .LVU289
+	addq	$1, %r12
+.LVL114:
+	.loc 1 680 23 is_stmt 0 discriminator 2 view .LVU290
+	cmpq	%r14, %r12
+	jne	.L77
+	.loc 1 686 9 is_stmt 1 view .LVU291
+	leaq	310+masterConfig(%rip), %r12
+	movq	%rbp, %rdi
+	movq	%r12, %rsi
+	call	parseRcChannels@PLT
+.LVL115:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.loc 1 688 5 view .LVU292
+.LBB224:
+.LBI224:
+	.loc 1 820 13 view .LVU293
+.LBB225:
+	.loc 1 822 5 view .LVU294
+	movq	cliPort(%rip), %rdi
+	leaq	.LC27(%rip), %rsi
+	call	serialPrint@PLT
+.LVL116:
+	.loc 1 822 5 is_stmt 0 view .LVU295
+.LBE225:
+.LBE224:
+	.loc 1 689 5 is_stmt 1 view .LVU296
+	.loc 1 689 19 view .LVU297
+.LBB227:
+.LBB226:
+	.loc 1 822 5 is_stmt 0 view .LVU298
+	xorl	%eax, %eax
+.LVL117:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 822 5 view .LVU299
+.LBE226:
+.LBE227:
+	.loc 1 690 9 is_stmt 1 discriminator 3 view .LVU300
+	.loc 1 690 45 is_stmt 0 discriminator 3 view .LVU301
+	movzbl	(%r12,%rax), %edx
+	movzbl	(%rbx,%rax), %ecx
+	.loc 1 689 19 discriminator 3 view .LVU302
+	addq	$1, %rax
+.LVL118:
+	.loc 1 690 45 discriminator 3 view .LVU303
+	movb	%cl, 7(%rsp,%rdx)
+	.loc 1 689 25 is_stmt 1 discriminator 3 view .LVU304
+.LVL119:
+	.loc 1 689 19 discriminator 3 view .LVU305
+	cmpq	$8, %rax
+	jne	.L79
+	.loc 1 691 5 view .LVU306
+	.loc 1 692 5 is_stmt 0 view .LVU307
+	leaq	7(%rsp), %rsi
+	leaq	.LC28(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 691 12 view .LVU308
+	movb	$0, 15(%rsp)
+	.loc 1 692 5 is_stmt 1 view .LVU309
+	call	tfp_printf@PLT
+.LVL120:
+	.loc 1 693 1 is_stmt 0 view .LVU310
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL121:
+	.loc 1 693 1 view .LVU311
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	cliMap, .-cliMap
+	.section	.rodata.cliFeature.str1.1,"aMS",@progbits,1
+.LC29:
+	.string	"RX_PPM"
+.LC30:
+	.string	"Enabled features: "
+.LC31:
+	.string	"Available features: "
+.LC32:
+	.string	"Invalid feature name\r\n"
+.LC33:
+	.string	"GPS unavailable\r\n"
+.LC34:
+	.string	"SONAR unavailable\r\n"
+.LC35:
+	.string	"Disabled "
+.LC36:
+	.string	"Enabled "
+	.section	.text.cliFeature,"ax",@progbits
+	.p2align 4
+	.type	cliFeature, @function
+cliFeature:
+.LVL122:
+.LFB21:
+	.loc 1 565 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 566 5 view .LVU313
+	.loc 1 567 5 view .LVU314
+	.loc 1 568 5 view .LVU315
+	.loc 1 570 5 view .LVU316
+	.loc 1 565 1 is_stmt 0 view .LVU317
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 570 11 view .LVU318
+	call	strlen@PLT
+.LVL123:
+	.loc 1 570 11 view .LVU319
+	movq	%rax, %rbx
+.LVL124:
+	.loc 1 571 5 is_stmt 1 view .LVU320
+	.loc 1 571 12 is_stmt 0 view .LVU321
+	call	featureMask@PLT
+.LVL125:
+	.loc 1 573 5 is_stmt 1 view .LVU322
+	.loc 1 573 8 is_stmt 0 view .LVU323
+	testl	%ebx, %ebx
+	je	.L114
+	.loc 1 582 12 is_stmt 1 view .LVU324
+	movl	%ebx, %r13d
+	.loc 1 582 16 is_stmt 0 view .LVU325
+	leaq	.LC17(%rip), %rsi
+	movq	%r12, %rdi
+	movq	%r13, %rdx
+	call	strncasecmp@PLT
+.LVL126:
+	.loc 1 582 15 view .LVU326
+	testl	%eax, %eax
+	je	.L115
+.LBB228:
+	.loc 1 592 8 is_stmt 1 view .LVU327
+.LVL127:
+	.loc 1 593 9 view .LVU328
+	.loc 1 592 13 is_stmt 0 view .LVU329
+	xorl	%r15d, %r15d
+	.loc 1 593 12 view .LVU330
+	cmpb	$45, (%r12)
+	je	.L116
+.LVL128:
+.L97:
+	.loc 1 600 9 is_stmt 1 view .LVU331
+	.loc 1 601 13 view .LVU332
+	.loc 1 595 20 is_stmt 0 view .LVU333
+	xorl	%ebx, %ebx
+	.loc 1 601 29 view .LVU334
+	leaq	.LC29(%rip), %rbp
+	leaq	featureNames(%rip), %r14
+	jmp	.L98
+.LVL129:
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.loc 1 600 24 is_stmt 1 view .LVU335
+	.loc 1 600 9 view .LVU336
+	.loc 1 601 13 view .LVU337
+	.loc 1 601 16 is_stmt 0 view .LVU338
+	addq	$1, %rbx
+.LVL130:
+	.loc 1 601 29 view .LVU339
+	movq	(%r14,%rbx,8), %rbp
+	.loc 1 601 16 view .LVU340
+	testq	%rbp, %rbp
+	je	.L117
+.LVL131:
+.L98:
+	.loc 1 606 13 is_stmt 1 view .LVU341
+	.loc 1 606 17 is_stmt 0 view .LVU342
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	strncasecmp@PLT
+.LVL132:
+	.loc 1 606 16 view .LVU343
+	testl	%eax, %eax
+	jne	.L99
+	movl	%ebx, %ecx
+	.loc 1 608 17 is_stmt 1 view .LVU344
+.LVL133:
+	.loc 1 610 17 view .LVU345
+.LBB229:
+.LBB230:
+	.loc 1 822 5 is_stmt 0 view .LVU346
+	leaq	.LC33(%rip), %rsi
+.LBE230:
+.LBE229:
+	.loc 1 610 20 view .LVU347
+	cmpl	$7, %ebx
+	je	.L113
+	.loc 1 616 17 is_stmt 1 view .LVU348
+	.loc 1 616 20 is_stmt 0 view .LVU349
+	cmpl	$9, %ebx
+	je	.L118
+	.loc 1 608 26 view .LVU350
+	movl	$1, %edi
+	sall	%cl, %edi
+	.loc 1 621 17 is_stmt 1 view .LVU351
+	.loc 1 621 20 is_stmt 0 view .LVU352
+	testb	%r15b, %r15b
+	je	.L102
+	.loc 1 622 21 is_stmt 1 view .LVU353
+	call	featureClear@PLT
+.LVL134:
+	.loc 1 623 21 view .LVU354
+.LBB231:
+.LBI231:
+	.loc 1 820 13 view .LVU355
+.LBB232:
+	.loc 1 822 5 view .LVU356
+	movq	cliPort(%rip), %rdi
+	leaq	.LC35(%rip), %rsi
+	call	serialPrint@PLT
+.LVL135:
+.L103:
+	.loc 1 822 5 is_stmt 0 view .LVU357
+.LBE232:
+.LBE231:
+	.loc 1 628 17 is_stmt 1 view .LVU358
+.LBE228:
+	.loc 1 633 1 is_stmt 0 view .LVU359
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB243:
+	.loc 1 628 17 view .LVU360
+	movq	%rbp, %rsi
+	leaq	.LC28(%rip), %rdi
+	xorl	%eax, %eax
+.LBE243:
+	.loc 1 633 1 view .LVU361
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL136:
+	.loc 1 633 1 view .LVU362
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL137:
+	.loc 1 633 1 view .LVU363
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL138:
+.LBB244:
+	.loc 1 628 17 view .LVU364
+	jmp	tfp_printf@PLT
+.LVL139:
+	.p2align 4,,10
+	.p2align 3
+.L115:
+	.cfi_restore_state
+	.loc 1 628 17 view .LVU365
+.LBE244:
+	.loc 1 583 9 is_stmt 1 view .LVU366
+.LBB245:
+.LBI245:
+	.loc 1 820 13 view .LVU367
+.LBB246:
+	.loc 1 822 5 view .LVU368
+	movq	cliPort(%rip), %rdi
+	leaq	.LC31(%rip), %rsi
+	leaq	8+featureNames(%rip), %rbx
+.LVL140:
+	.loc 1 822 5 is_stmt 0 view .LVU369
+	leaq	.LC6(%rip), %rbp
+	call	serialPrint@PLT
+.LVL141:
+	.loc 1 822 5 view .LVU370
+.LBE246:
+.LBE245:
+	.loc 1 584 9 is_stmt 1 view .LVU371
+	.loc 1 585 13 view .LVU372
+	.loc 1 585 29 is_stmt 0 view .LVU373
+	leaq	.LC29(%rip), %rsi
+.LVL142:
+	.p2align 4,,10
+	.p2align 3
+.L96:
+	.loc 1 587 13 is_stmt 1 view .LVU374
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	.loc 1 585 16 is_stmt 0 view .LVU375
+	addq	$8, %rbx
+.LVL143:
+	.loc 1 587 13 view .LVU376
+	call	tfp_printf@PLT
+.LVL144:
+	.loc 1 584 24 is_stmt 1 view .LVU377
+	.loc 1 584 9 view .LVU378
+	.loc 1 585 13 view .LVU379
+	.loc 1 585 29 is_stmt 0 view .LVU380
+	movq	-8(%rbx), %rsi
+	.loc 1 585 16 view .LVU381
+	testq	%rsi, %rsi
+	jne	.L96
+.LVL145:
+.L112:
+	.loc 1 589 9 is_stmt 1 view .LVU382
+.LBB247:
+.LBI247:
+	.loc 1 820 13 view .LVU383
+.LBB248:
+	.loc 1 822 5 view .LVU384
+	leaq	.LC9(%rip), %rsi
+.LVL146:
+.L113:
+	.loc 1 822 5 is_stmt 0 view .LVU385
+.LBE248:
+.LBE247:
+.LBB249:
+.LBB233:
+.LBB234:
+	movq	cliPort(%rip), %rdi
+.LBE234:
+.LBE233:
+.LBE249:
+	.loc 1 633 1 view .LVU386
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB250:
+.LBB237:
+.LBB235:
+	.loc 1 822 5 view .LVU387
+	jmp	serialPrint@PLT
+.LVL147:
+	.p2align 4,,10
+	.p2align 3
+.L114:
+	.cfi_restore_state
+	.loc 1 822 5 view .LVU388
+.LBE235:
+.LBE237:
+.LBE250:
+.LBB251:
+.LBB252:
+	movq	cliPort(%rip), %rdi
+	leaq	.LC30(%rip), %rsi
+	movl	%eax, %ebp
+.LBE252:
+.LBE251:
+	.loc 1 574 9 is_stmt 1 view .LVU389
+.LVL148:
+.LBB255:
+.LBI251:
+	.loc 1 820 13 view .LVU390
+.LBB253:
+	.loc 1 822 5 view .LVU391
+	xorl	%ebx, %ebx
+.LVL149:
+	.loc 1 822 5 is_stmt 0 view .LVU392
+	leaq	featureNames(%rip), %r12
+.LVL150:
+	.loc 1 822 5 view .LVU393
+.LBE253:
+.LBE255:
+	.loc 1 579 17 view .LVU394
+	leaq	.LC6(%rip), %r13
+.LBB256:
+.LBB254:
+	.loc 1 822 5 view .LVU395
+	call	serialPrint@PLT
+.LVL151:
+	.loc 1 822 5 view .LVU396
+.LBE254:
+.LBE256:
+	.loc 1 575 9 is_stmt 1 view .LVU397
+	.loc 1 576 13 view .LVU398
+	.loc 1 576 29 is_stmt 0 view .LVU399
+	leaq	.LC29(%rip), %rsi
+	jmp	.L94
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	.loc 1 575 24 is_stmt 1 view .LVU400
+	.loc 1 575 9 view .LVU401
+	.loc 1 576 13 view .LVU402
+	.loc 1 576 16 is_stmt 0 view .LVU403
+	addq	$1, %rbx
+.LVL153:
+	.loc 1 576 29 view .LVU404
+	movq	(%r12,%rbx,8), %rsi
+	.loc 1 576 16 view .LVU405
+	testq	%rsi, %rsi
+	je	.L112
+.LVL154:
+.L94:
+	.loc 1 578 13 is_stmt 1 view .LVU406
+	.loc 1 578 16 is_stmt 0 view .LVU407
+	btl	%ebx, %ebp
+	jnc	.L93
+	.loc 1 579 17 is_stmt 1 view .LVU408
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL155:
+	jmp	.L93
+.LVL156:
+	.p2align 4,,10
+	.p2align 3
+.L117:
+.LBB257:
+	.loc 1 602 17 view .LVU409
+.LBB238:
+.LBI238:
+	.loc 1 820 13 view .LVU410
+.LBB239:
+	.loc 1 822 5 view .LVU411
+	leaq	.LC32(%rip), %rsi
+	jmp	.L113
+.LVL157:
+	.p2align 4,,10
+	.p2align 3
+.L116:
+	.loc 1 822 5 is_stmt 0 view .LVU412
+.LBE239:
+.LBE238:
+	.loc 1 595 13 is_stmt 1 view .LVU413
+	.loc 1 596 13 view .LVU414
+	.loc 1 596 20 is_stmt 0 view .LVU415
+	addq	$1, %r12
+.LVL158:
+	.loc 1 597 13 is_stmt 1 view .LVU416
+	.loc 1 606 17 is_stmt 0 view .LVU417
+	leal	-1(%rbx), %r13d
+	.loc 1 595 20 view .LVU418
+	movl	$1, %r15d
+	jmp	.L97
+.LVL159:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.loc 1 625 21 is_stmt 1 view .LVU419
+	call	featureSet@PLT
+.LVL160:
+	.loc 1 626 21 view .LVU420
+.LBB240:
+.LBI240:
+	.loc 1 820 13 view .LVU421
+.LBB241:
+	.loc 1 822 5 view .LVU422
+	movq	cliPort(%rip), %rdi
+	leaq	.LC36(%rip), %rsi
+	call	serialPrint@PLT
+.LVL161:
+	.loc 1 823 1 is_stmt 0 view .LVU423
+	jmp	.L103
+.LVL162:
+.L118:
+	.loc 1 823 1 view .LVU424
+.LBE241:
+.LBE240:
+	.loc 1 617 21 is_stmt 1 view .LVU425
+.LBB242:
+.LBI233:
+	.loc 1 820 13 view .LVU426
+.LBB236:
+	.loc 1 822 5 view .LVU427
+	leaq	.LC34(%rip), %rsi
+	jmp	.L113
+.LBE236:
+.LBE242:
+.LBE257:
+	.cfi_endproc
+.LFE21:
+	.size	cliFeature, .-cliFeature
+	.section	.rodata.cliCMix.str1.1,"aMS",@progbits,1
+.LC38:
+	.string	"NG\t"
+.LC39:
+	.string	"OK\t"
+	.section	.rodata.cliCMix.str1.8,"aMS",@progbits,1
+	.align 8
+.LC40:
+	.string	"Custom mixer: \r\nMotor\tThr\tRoll\tPitch\tYaw\r\n"
+	.section	.rodata.cliCMix.str1.1
+.LC41:
+	.string	"#%d:\t"
+.LC42:
+	.string	"%s\t"
+.LC43:
+	.string	"Sanity check:\t"
+.LC46:
+	.string	"reset"
+.LC47:
+	.string	"load"
+.LC48:
+	.string	"Loaded %s mix\r\n"
+	.section	.rodata.cliCMix.str1.8
+	.align 8
+.LC49:
+	.string	"Wrong number of arguments, needs idx thr roll pitch yaw\r\n"
+	.align 8
+.LC50:
+	.string	"Motor number must be between 1 and %d\r\n"
+	.section	.text.cliCMix,"ax",@progbits
+	.p2align 4
+	.type	cliCMix, @function
+cliCMix:
+.LVL163:
+.LFB16:
+	.loc 1 268 1 view -0
+	.cfi_startproc
+	.loc 1 268 1 is_stmt 0 view .LVU429
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 276 11 view .LVU430
+	call	strlen@PLT
+.LVL164:
+	.loc 1 269 5 is_stmt 1 view .LVU431
+	.loc 1 270 5 view .LVU432
+	.loc 1 271 5 view .LVU433
+	.loc 1 272 5 view .LVU434
+	.loc 1 273 5 view .LVU435
+	.loc 1 274 5 view .LVU436
+	.loc 1 276 5 view .LVU437
+	.loc 1 278 5 view .LVU438
+	.loc 1 278 8 is_stmt 0 view .LVU439
+	testb	%al, %al
+	je	.L173
+	.loc 1 301 12 is_stmt 1 view .LVU440
+	.loc 1 301 16 is_stmt 0 view .LVU441
+	movl	$5, %edx
+	leaq	.LC46(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strncasecmp@PLT
+.LVL165:
+	.loc 1 301 15 view .LVU442
+	testl	%eax, %eax
+	je	.L174
+	.loc 1 305 12 is_stmt 1 view .LVU443
+	.loc 1 305 16 is_stmt 0 view .LVU444
+	movl	$4, %edx
+	leaq	.LC47(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strncasecmp@PLT
+.LVL166:
+	.loc 1 305 15 view .LVU445
+	testl	%eax, %eax
+	je	.L175
+	.loc 1 323 9 is_stmt 1 view .LVU446
+.LVL167:
+	.loc 1 324 9 view .LVU447
+.LBB258:
+.LBI258:
+	.file 2 "/usr/include/stdlib.h"
+	.loc 2 362 42 view .LVU448
+.LBB259:
+	.loc 2 364 3 view .LVU449
+	.loc 2 364 16 is_stmt 0 view .LVU450
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL168:
+	.loc 2 364 16 view .LVU451
+.LBE259:
+.LBE258:
+	.loc 1 325 9 is_stmt 1 view .LVU452
+	.loc 1 325 12 is_stmt 0 view .LVU453
+	leal	-1(%rax), %ebp
+.LVL169:
+	.loc 1 325 12 view .LVU454
+	cmpl	$11, %ebp
+	jg	.L141
+	.loc 1 326 13 is_stmt 1 view .LVU455
+	.loc 1 326 19 is_stmt 0 view .LVU456
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	.loc 1 269 12 view .LVU457
+	xorl	%r12d, %r12d
+	.loc 1 326 19 view .LVU458
+	call	strchr@PLT
+.LVL170:
+	movq	%rax, %rbx
+.LVL171:
+	.loc 1 327 13 is_stmt 1 view .LVU459
+	.loc 1 327 16 is_stmt 0 view .LVU460
+	testq	%rax, %rax
+	je	.L142
+	.loc 1 328 17 is_stmt 1 view .LVU461
+	.loc 1 328 54 is_stmt 0 view .LVU462
+	addq	$1, %rbx
+.LVL172:
+	.loc 1 329 22 view .LVU463
+	movl	$1, %r12d
+	.loc 1 328 56 view .LVU464
+	movq	%rbx, %rdi
+	call	fastA2F@PLT
+.LVL173:
+	.loc 1 328 54 view .LVU465
+	movslq	%ebp, %rax
+	leaq	masterConfig(%rip), %rdx
+	salq	$4, %rax
+	movss	%xmm0, 16(%rax,%rdx)
+	.loc 1 329 17 is_stmt 1 view .LVU466
+.LVL174:
+.L142:
+	.loc 1 331 13 view .LVU467
+	.loc 1 331 19 is_stmt 0 view .LVU468
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	strchr@PLT
+.LVL175:
+	movq	%rax, %rbx
+.LVL176:
+	.loc 1 332 13 is_stmt 1 view .LVU469
+	.loc 1 332 16 is_stmt 0 view .LVU470
+	testq	%rax, %rax
+	je	.L143
+	.loc 1 333 17 is_stmt 1 view .LVU471
+	.loc 1 333 50 is_stmt 0 view .LVU472
+	addq	$1, %rbx
+.LVL177:
+	.loc 1 334 22 view .LVU473
+	addl	$1, %r12d
+.LVL178:
+	.loc 1 333 52 view .LVU474
+	movq	%rbx, %rdi
+	call	fastA2F@PLT
+.LVL179:
+	.loc 1 333 50 view .LVU475
+	movslq	%ebp, %rax
+	leaq	masterConfig(%rip), %rdx
+	salq	$4, %rax
+	movss	%xmm0, 20(%rax,%rdx)
+	.loc 1 334 17 is_stmt 1 view .LVU476
+.LVL180:
+.L143:
+	.loc 1 336 13 view .LVU477
+	.loc 1 336 19 is_stmt 0 view .LVU478
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	strchr@PLT
+.LVL181:
+	movq	%rax, %rbx
+.LVL182:
+	.loc 1 337 13 is_stmt 1 view .LVU479
+	.loc 1 337 16 is_stmt 0 view .LVU480
+	testq	%rax, %rax
+	je	.L144
+	.loc 1 338 17 is_stmt 1 view .LVU481
+	.loc 1 338 51 is_stmt 0 view .LVU482
+	addq	$1, %rbx
+.LVL183:
+	.loc 1 339 22 view .LVU483
+	addl	$1, %r12d
+.LVL184:
+	.loc 1 338 53 view .LVU484
+	movq	%rbx, %rdi
+	call	fastA2F@PLT
+.LVL185:
+	.loc 1 338 51 view .LVU485
+	movslq	%ebp, %rax
+	leaq	masterConfig(%rip), %rdx
+	salq	$4, %rax
+	movss	%xmm0, 24(%rax,%rdx)
+	.loc 1 339 17 is_stmt 1 view .LVU486
+.LVL186:
+.L144:
+	.loc 1 341 13 view .LVU487
+	.loc 1 341 19 is_stmt 0 view .LVU488
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	call	strchr@PLT
+.LVL187:
+	.loc 1 342 13 is_stmt 1 view .LVU489
+	.loc 1 342 16 is_stmt 0 view .LVU490
+	testq	%rax, %rax
+	je	.L146
+	.loc 1 343 17 is_stmt 1 view .LVU491
+.LVL188:
+	.loc 1 343 49 is_stmt 0 view .LVU492
+	leaq	1(%rax), %rdi
+.LVL189:
+	.loc 1 343 49 view .LVU493
+	movslq	%ebp, %rbp
+	.loc 1 343 51 view .LVU494
+	call	fastA2F@PLT
+.LVL190:
+	.loc 1 343 49 view .LVU495
+	salq	$4, %rbp
+.LVL191:
+	.loc 1 343 49 view .LVU496
+	leaq	masterConfig(%rip), %rax
+	movss	%xmm0, 28(%rbp,%rax)
+	.loc 1 344 17 is_stmt 1 view .LVU497
+.LVL192:
+	.loc 1 346 13 view .LVU498
+	.loc 1 346 16 is_stmt 0 view .LVU499
+	cmpl	$3, %r12d
+	jne	.L146
+	leaq	16(%rax), %r12
+.LVL193:
+.L120:
+	.loc 1 279 9 is_stmt 1 view .LVU500
+.LBB260:
+.LBI260:
+	.loc 1 820 13 view .LVU501
+.LBB261:
+	.loc 1 822 5 view .LVU502
+	movq	cliPort(%rip), %rdi
+	leaq	.LC40(%rip), %rsi
+	movq	%r12, %rbx
+.LBE261:
+.LBE260:
+	.loc 1 280 16 is_stmt 0 view .LVU503
+	xorl	%r13d, %r13d
+	.loc 1 284 13 view .LVU504
+	leaq	.LC41(%rip), %r15
+	.loc 1 285 13 view .LVU505
+	leaq	.LC42(%rip), %r12
+.LBB263:
+.LBB262:
+	.loc 1 822 5 view .LVU506
+	call	serialPrint@PLT
+.LVL194:
+	.loc 1 822 5 view .LVU507
+.LBE262:
+.LBE263:
+	.loc 1 280 9 is_stmt 1 view .LVU508
+	.loc 1 280 23 view .LVU509
+	.loc 1 288 13 is_stmt 0 view .LVU510
+	leaq	.LC28(%rip), %r14
+.LVL195:
+	.p2align 4,,10
+	.p2align 3
+.L124:
+	.loc 1 281 13 is_stmt 1 view .LVU511
+	.loc 1 281 16 is_stmt 0 view .LVU512
+	pxor	%xmm3, %xmm3
+	ucomiss	(%rbx), %xmm3
+	jp	.L150
+	je	.L122
+.L150:
+	.loc 1 283 13 is_stmt 1 discriminator 2 view .LVU513
+	.loc 1 283 23 is_stmt 0 discriminator 2 view .LVU514
+	addl	$1, %r13d
+.LVL196:
+	.loc 1 284 13 is_stmt 1 discriminator 2 view .LVU515
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	.loc 1 280 23 is_stmt 0 discriminator 2 view .LVU516
+	addq	$16, %rbx
+	.loc 1 284 13 discriminator 2 view .LVU517
+	movl	%r13d, %esi
+	.loc 1 285 13 discriminator 2 view .LVU518
+	leaq	16(%rsp), %rbp
+	.loc 1 284 13 discriminator 2 view .LVU519
+	call	tfp_printf@PLT
+.LVL197:
+	.loc 1 285 13 is_stmt 1 discriminator 2 view .LVU520
+	movss	-16(%rbx), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL198:
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL199:
+	.loc 1 286 13 discriminator 2 view .LVU521
+	movss	-12(%rbx), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL200:
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL201:
+	.loc 1 287 13 discriminator 2 view .LVU522
+	movss	-8(%rbx), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL202:
+	movq	%r12, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL203:
+	.loc 1 288 13 discriminator 2 view .LVU523
+	movss	-4(%rbx), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL204:
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL205:
+	.loc 1 280 30 discriminator 2 view .LVU524
+	.loc 1 280 23 discriminator 2 view .LVU525
+	cmpl	$12, %r13d
+	jne	.L124
+.LVL206:
+.L147:
+	.loc 1 280 23 is_stmt 0 discriminator 2 view .LVU526
+	movslq	%r13d, %rdx
+	leaq	20+masterConfig(%rip), %rax
+	.loc 1 280 16 view .LVU527
+	xorps	%xmm1, %xmm1
+	salq	$4, %rdx
+	pxor	%xmm0, %xmm0
+	addq	%rax, %rdx
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L127:
+	.loc 1 292 13 is_stmt 1 discriminator 3 view .LVU528
+	.loc 1 292 53 is_stmt 0 discriminator 3 view .LVU529
+	movq	(%rax), %xmm2
+	.loc 1 294 23 discriminator 3 view .LVU530
+	addss	8(%rax), %xmm0
+	.loc 1 291 23 discriminator 3 view .LVU531
+	addq	$16, %rax
+.LVL208:
+	.loc 1 292 23 discriminator 3 view .LVU532
+	addps	%xmm2, %xmm1
+	.loc 1 293 13 is_stmt 1 discriminator 3 view .LVU533
+	.loc 1 294 13 discriminator 3 view .LVU534
+	.loc 1 291 38 discriminator 3 view .LVU535
+.LVL209:
+	.loc 1 291 23 discriminator 3 view .LVU536
+	cmpq	%rax, %rdx
+	jne	.L127
+	movlps	%xmm1, (%rsp)
+	movss	%xmm0, 8(%rsp)
+.L126:
+	.loc 1 296 9 view .LVU537
+.LVL210:
+.LBB264:
+.LBI264:
+	.loc 1 820 13 view .LVU538
+.LBB265:
+	.loc 1 822 5 view .LVU539
+	movq	cliPort(%rip), %rdi
+	leaq	.LC43(%rip), %rsi
+	movq	%rsp, %rbx
+	leaq	12(%rsp), %r13
+.LVL211:
+	.loc 1 822 5 is_stmt 0 view .LVU540
+.LBE265:
+.LBE264:
+	.loc 1 298 13 view .LVU541
+	leaq	.LC38(%rip), %r12
+	leaq	.LC39(%rip), %rbp
+.LBB267:
+.LBB266:
+	.loc 1 822 5 view .LVU542
+	call	serialPrint@PLT
+.LVL212:
+	.loc 1 822 5 view .LVU543
+.LBE266:
+.LBE267:
+	.loc 1 297 9 is_stmt 1 view .LVU544
+	.loc 1 297 23 view .LVU545
+.L130:
+	.loc 1 298 13 view .LVU546
+	.loc 1 298 22 is_stmt 0 view .LVU547
+	movss	(%rbx), %xmm0
+	andps	.LC44(%rip), %xmm0
+	.loc 1 298 13 view .LVU548
+	movq	%rbp, %rsi
+	comiss	.LC45(%rip), %xmm0
+.LBB268:
+.LBB269:
+	.loc 1 822 5 view .LVU549
+	movq	cliPort(%rip), %rdi
+.LBE269:
+.LBE268:
+	.loc 1 298 13 view .LVU550
+	cmova	%r12, %rsi
+.LVL213:
+.LBB272:
+.LBI268:
+	.loc 1 820 13 is_stmt 1 view .LVU551
+.LBB270:
+	.loc 1 822 5 view .LVU552
+.LBE270:
+.LBE272:
+	.loc 1 297 23 is_stmt 0 view .LVU553
+	addq	$4, %rbx
+.LVL214:
+.LBB273:
+.LBB271:
+	.loc 1 822 5 view .LVU554
+	call	serialPrint@PLT
+.LVL215:
+	.loc 1 822 5 view .LVU555
+.LBE271:
+.LBE273:
+	.loc 1 297 29 is_stmt 1 view .LVU556
+	.loc 1 297 23 view .LVU557
+	cmpq	%rbx, %r13
+	jne	.L130
+	.loc 1 299 9 view .LVU558
+.LVL216:
+.LBB274:
+.LBI274:
+	.loc 1 820 13 view .LVU559
+.LBB275:
+	.loc 1 822 5 view .LVU560
+	movq	cliPort(%rip), %rdi
+	leaq	.LC9(%rip), %rsi
+	call	serialPrint@PLT
+.LVL217:
+	.loc 1 822 5 is_stmt 0 view .LVU561
+.LBE275:
+.LBE274:
+	.loc 1 300 9 is_stmt 1 view .LVU562
+.L119:
+	.loc 1 355 1 is_stmt 0 view .LVU563
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL218:
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	.cfi_restore_state
+	.loc 1 306 9 is_stmt 1 view .LVU564
+	.loc 1 306 15 is_stmt 0 view .LVU565
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	call	strchr@PLT
+.LVL219:
+	.loc 1 307 9 is_stmt 1 view .LVU566
+	.loc 1 307 12 is_stmt 0 view .LVU567
+	testq	%rax, %rax
+	je	.L119
+	.loc 1 308 13 is_stmt 1 view .LVU568
+	.loc 1 308 17 is_stmt 0 view .LVU569
+	leaq	1(%rax), %r12
+.LVL220:
+	.loc 1 308 19 view .LVU570
+	xorl	%ebx, %ebx
+.LVL221:
+	.loc 1 310 31 view .LVU571
+	leaq	.LC15(%rip), %rbp
+	.loc 1 308 19 view .LVU572
+	movq	%r12, %rdi
+	.loc 1 310 31 view .LVU573
+	leaq	mixerNames(%rip), %r14
+	.loc 1 308 19 view .LVU574
+	call	strlen@PLT
+.LVL222:
+	.loc 1 309 13 is_stmt 1 view .LVU575
+	.loc 1 310 17 view .LVU576
+	movzbl	%al, %r13d
+	jmp	.L137
+.LVL223:
+	.p2align 4,,10
+	.p2align 3
+.L138:
+	.loc 1 309 28 view .LVU577
+	.loc 1 309 13 view .LVU578
+	.loc 1 310 17 view .LVU579
+	.loc 1 310 20 is_stmt 0 view .LVU580
+	addq	$1, %rbx
+.LVL224:
+	.loc 1 310 31 view .LVU581
+	movq	(%r14,%rbx,8), %rbp
+	.loc 1 310 20 view .LVU582
+	testq	%rbp, %rbp
+	je	.L176
+.LVL225:
+.L137:
+	.loc 1 314 17 is_stmt 1 view .LVU583
+	.loc 1 314 21 is_stmt 0 view .LVU584
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%r12, %rdi
+	call	strncasecmp@PLT
+.LVL226:
+	.loc 1 314 20 view .LVU585
+	testl	%eax, %eax
+	jne	.L138
+	.loc 1 315 21 is_stmt 1 view .LVU586
+	leaq	16+masterConfig(%rip), %r12
+.LVL227:
+	.loc 1 315 21 is_stmt 0 view .LVU587
+	movl	%ebx, %edi
+	movq	%r12, %rsi
+	call	mixerLoadMix@PLT
+.LVL228:
+	.loc 1 316 21 is_stmt 1 view .LVU588
+	movq	%rbp, %rsi
+	leaq	.LC48(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL229:
+	.loc 1 317 21 view .LVU589
+	.loc 1 318 21 is_stmt 0 view .LVU590
+	jmp	.L120
+.LVL230:
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	.loc 1 347 17 is_stmt 1 view .LVU591
+.LBB276:
+.LBI276:
+	.loc 1 820 13 view .LVU592
+.LBB277:
+	.loc 1 822 5 view .LVU593
+	leaq	.LC49(%rip), %rsi
+.LVL231:
+.L172:
+	.loc 1 822 5 is_stmt 0 view .LVU594
+	movq	cliPort(%rip), %rdi
+.LBE277:
+.LBE276:
+	.loc 1 355 1 view .LVU595
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB279:
+.LBB278:
+	.loc 1 822 5 view .LVU596
+	jmp	serialPrint@PLT
+.LVL232:
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	.cfi_restore_state
+	.loc 1 822 5 view .LVU597
+.LBE278:
+.LBE279:
+	.loc 1 311 21 is_stmt 1 view .LVU598
+.LBB280:
+.LBI280:
+	.loc 1 820 13 view .LVU599
+.LBB281:
+	.loc 1 822 5 view .LVU600
+	leaq	.LC19(%rip), %rsi
+	jmp	.L172
+.LVL233:
+.L174:
+	.loc 1 822 5 is_stmt 0 view .LVU601
+	leaq	16+masterConfig(%rip), %rax
+	leaq	192(%rax), %rdx
+	.p2align 4,,10
+	.p2align 3
+.L133:
+.LVL234:
+	.loc 1 822 5 view .LVU602
+.LBE281:
+.LBE280:
+	.loc 1 304 13 is_stmt 1 discriminator 3 view .LVU603
+	.loc 1 304 50 is_stmt 0 discriminator 3 view .LVU604
+	movl	$0x00000000, (%rax)
+	.loc 1 303 30 is_stmt 1 discriminator 3 view .LVU605
+.LVL235:
+	.loc 1 303 23 discriminator 3 view .LVU606
+	addq	$16, %rax
+.LVL236:
+	.loc 1 303 23 is_stmt 0 discriminator 3 view .LVU607
+	cmpq	%rdx, %rax
+	jne	.L133
+	jmp	.L119
+.LVL237:
+.L122:
+	.loc 1 290 9 is_stmt 1 view .LVU608
+	.loc 1 290 43 is_stmt 0 view .LVU609
+	movl	$0x00000000, 8(%rsp)
+	.loc 1 290 19 view .LVU610
+	movq	$0, (%rsp)
+	.loc 1 291 9 is_stmt 1 view .LVU611
+.LVL238:
+	.loc 1 291 23 view .LVU612
+	testl	%r13d, %r13d
+	jne	.L147
+	jmp	.L126
+.LVL239:
+.L141:
+	.loc 1 352 13 view .LVU613
+	.loc 1 355 1 is_stmt 0 view .LVU614
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 352 13 view .LVU615
+	movl	$12, %esi
+	leaq	.LC50(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 355 1 view .LVU616
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL240:
+	.loc 1 355 1 view .LVU617
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL241:
+	.loc 1 355 1 view .LVU618
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	.loc 1 352 13 view .LVU619
+	jmp	tfp_printf@PLT
+.LVL242:
+.L173:
+	.cfi_restore_state
+	.loc 1 352 13 view .LVU620
+	leaq	16+masterConfig(%rip), %r12
+	jmp	.L120
+	.cfi_endproc
+.LFE16:
+	.size	cliCMix, .-cliCMix
+	.section	.rodata.cliAux.str1.1,"aMS",@progbits,1
+.LC51:
+	.string	"aux %u %u %u %u %u\r\n"
+.LC52:
+	.string	"index: must be < %u\r\n"
+	.section	.text.cliAux,"ax",@progbits
+	.p2align 4
+	.type	cliAux, @function
+cliAux:
+.LVL243:
+.LFB15:
+	.loc 1 200 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 201 5 view .LVU622
+	.loc 1 202 5 view .LVU623
+	.loc 1 203 5 view .LVU624
+	.loc 1 205 5 view .LVU625
+	.loc 1 200 1 is_stmt 0 view .LVU626
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 205 11 view .LVU627
+	call	strlen@PLT
+.LVL244:
+	.loc 1 206 5 is_stmt 1 view .LVU628
+	.loc 1 206 8 is_stmt 0 view .LVU629
+	testb	%al, %al
+	jne	.L178
+	.loc 1 208 16 view .LVU630
+	xorl	%ebx, %ebx
+.LVL245:
+	.loc 1 208 16 view .LVU631
+	leaq	.LC51(%rip), %rbp
+.LVL246:
+	.p2align 4,,10
+	.p2align 3
+.L179:
+.LBB282:
+	.loc 1 209 13 is_stmt 1 discriminator 3 view .LVU632
+	.loc 1 210 13 discriminator 3 view .LVU633
+	movq	currentProfile(%rip), %rax
+	movslq	%ebx, %rdx
+.LVL247:
+	.loc 1 210 13 is_stmt 0 discriminator 3 view .LVU634
+	movq	%rbp, %rdi
+	leaq	(%rax,%rdx,8), %rax
+	.loc 1 215 32 discriminator 3 view .LVU635
+	movzbl	138(%rax), %edx
+.LVL248:
+	.loc 1 210 13 discriminator 3 view .LVU636
+	movzbl	136(%rax), %esi
+	.loc 1 215 27 discriminator 3 view .LVU637
+	leal	(%rdx,%rdx,4), %ecx
+	.loc 1 214 32 discriminator 3 view .LVU638
+	movzbl	137(%rax), %edx
+	.loc 1 210 13 discriminator 3 view .LVU639
+	movl	132(%rax), %eax
+	leal	900(%rcx,%rcx,4), %r9d
+	movl	%esi, %ecx
+	movl	%ebx, %esi
+.LBE282:
+	.loc 1 208 30 discriminator 3 view .LVU640
+	addl	$1, %ebx
+.LVL249:
+.LBB283:
+	.loc 1 214 27 discriminator 3 view .LVU641
+	leal	(%rdx,%rdx,4), %edx
+	.loc 1 210 13 discriminator 3 view .LVU642
+	leal	900(%rdx,%rdx,4), %r8d
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL250:
+	.loc 1 210 13 discriminator 3 view .LVU643
+.LBE283:
+	.loc 1 208 30 is_stmt 1 discriminator 3 view .LVU644
+	.loc 1 208 23 discriminator 3 view .LVU645
+	cmpl	$40, %ebx
+	jne	.L179
+.LVL251:
+.L177:
+	.loc 1 265 1 is_stmt 0 view .LVU646
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL252:
+	.p2align 4,,10
+	.p2align 3
+.L178:
+	.cfi_restore_state
+	.loc 1 219 9 is_stmt 1 view .LVU647
+	.loc 1 220 9 view .LVU648
+.LBB284:
+.LBI284:
+	.loc 2 362 42 view .LVU649
+.LBB285:
+	.loc 2 364 3 view .LVU650
+	.loc 2 364 16 is_stmt 0 view .LVU651
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL253:
+	.loc 2 364 16 view .LVU652
+	movq	%rax, %rbp
+.LVL254:
+	.loc 2 364 16 view .LVU653
+.LBE285:
+.LBE284:
+	.loc 1 221 9 is_stmt 1 view .LVU654
+	.loc 1 221 12 is_stmt 0 view .LVU655
+	cmpl	$39, %eax
+	jg	.L181
+.LBB286:
+	.loc 1 222 13 is_stmt 1 view .LVU656
+.LBE286:
+	.loc 1 220 13 is_stmt 0 view .LVU657
+	leaq	1(%rbx), %rdi
+.LVL255:
+.LBB297:
+	.loc 1 224 19 view .LVU658
+	movl	$32, %esi
+	.loc 1 222 61 view .LVU659
+	movq	currentProfile(%rip), %r12
+.LVL256:
+	.loc 1 223 13 is_stmt 1 view .LVU660
+	.loc 1 224 13 view .LVU661
+	.loc 1 224 19 is_stmt 0 view .LVU662
+	call	strchr@PLT
+.LVL257:
+	.loc 1 224 19 view .LVU663
+	movq	%rax, %rbx
+.LVL258:
+	.loc 1 225 13 is_stmt 1 view .LVU664
+	.loc 1 225 16 is_stmt 0 view .LVU665
+	testq	%rax, %rax
+	je	.L189
+	.loc 1 226 17 is_stmt 1 view .LVU666
+	.loc 1 226 21 is_stmt 0 view .LVU667
+	addq	$1, %rbx
+.LVL259:
+.LBB287:
+.LBI287:
+	.loc 2 362 42 is_stmt 1 view .LVU668
+.LBB288:
+	.loc 2 364 3 view .LVU669
+	.loc 2 364 16 is_stmt 0 view .LVU670
+	xorl	%esi, %esi
+	movl	$10, %edx
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL260:
+	.loc 2 364 16 view .LVU671
+.LBE288:
+.LBE287:
+	.loc 1 227 17 is_stmt 1 view .LVU672
+	.loc 1 227 20 is_stmt 0 view .LVU673
+	cmpl	$21, %eax
+	ja	.L189
+	.loc 1 228 21 is_stmt 1 view .LVU674
+	.loc 1 228 33 is_stmt 0 view .LVU675
+	movslq	%ebp, %rbp
+.LVL261:
+	.loc 1 229 39 view .LVU676
+	movl	$1, %r13d
+	.loc 1 228 33 view .LVU677
+	movl	%eax, 132(%r12,%rbp,8)
+	.loc 1 229 21 is_stmt 1 view .LVU678
+.LVL262:
+.L182:
+	.loc 1 232 13 view .LVU679
+	.loc 1 232 19 is_stmt 0 view .LVU680
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	strchr@PLT
+.LVL263:
+	movq	%rax, %rbx
+.LVL264:
+	.loc 1 233 13 is_stmt 1 view .LVU681
+	.loc 1 233 16 is_stmt 0 view .LVU682
+	testq	%rax, %rax
+	je	.L183
+	.loc 1 234 17 is_stmt 1 view .LVU683
+	.loc 1 234 21 is_stmt 0 view .LVU684
+	addq	$1, %rbx
+.LVL265:
+.LBB289:
+.LBI289:
+	.loc 2 362 42 is_stmt 1 view .LVU685
+.LBB290:
+	.loc 2 364 3 view .LVU686
+	.loc 2 364 16 is_stmt 0 view .LVU687
+	xorl	%esi, %esi
+	movl	$10, %edx
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL266:
+	.loc 2 364 16 view .LVU688
+.LBE290:
+.LBE289:
+	.loc 1 235 17 is_stmt 1 view .LVU689
+	.loc 1 235 20 is_stmt 0 view .LVU690
+	cmpl	$13, %eax
+	ja	.L183
+	.loc 1 236 21 is_stmt 1 view .LVU691
+	.loc 1 236 42 is_stmt 0 view .LVU692
+	movb	%al, 136(%r12,%rbp,8)
+	.loc 1 237 21 is_stmt 1 view .LVU693
+	.loc 1 237 39 is_stmt 0 view .LVU694
+	addl	$1, %r13d
+.LVL267:
+.L183:
+	.loc 1 240 13 is_stmt 1 view .LVU695
+	.loc 1 240 19 is_stmt 0 view .LVU696
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	strchr@PLT
+.LVL268:
+	movq	%rax, %rbx
+.LVL269:
+	.loc 1 241 13 is_stmt 1 view .LVU697
+	.loc 1 241 16 is_stmt 0 view .LVU698
+	testq	%rax, %rax
+	je	.L184
+	.loc 1 242 17 is_stmt 1 view .LVU699
+	.loc 1 242 21 is_stmt 0 view .LVU700
+	addq	$1, %rbx
+.LVL270:
+.LBB291:
+.LBI291:
+	.loc 2 362 42 is_stmt 1 view .LVU701
+.LBB292:
+	.loc 2 364 3 view .LVU702
+	.loc 2 364 16 is_stmt 0 view .LVU703
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL271:
+	.loc 2 364 16 view .LVU704
+.LBE292:
+.LBE291:
+	.loc 1 243 17 is_stmt 1 view .LVU705
+	.loc 1 243 25 is_stmt 0 view .LVU706
+	movl	$2100, %edx
+	movl	$900, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL272:
+	.loc 1 243 51 view .LVU707
+	leal	-900(%rax), %edx
+	.loc 1 243 21 view .LVU708
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$35, %rax
+	subl	%edx, %eax
+.LVL273:
+	.loc 1 244 17 is_stmt 1 view .LVU709
+	.loc 1 244 20 is_stmt 0 view .LVU710
+	cmpl	$48, %eax
+	ja	.L184
+	.loc 1 245 21 is_stmt 1 view .LVU711
+	.loc 1 245 41 is_stmt 0 view .LVU712
+	movb	%al, 137(%r12,%rbp,8)
+	.loc 1 246 21 is_stmt 1 view .LVU713
+	.loc 1 246 39 is_stmt 0 view .LVU714
+	addl	$1, %r13d
+.LVL274:
+.L184:
+	.loc 1 249 13 is_stmt 1 view .LVU715
+	.loc 1 249 19 is_stmt 0 view .LVU716
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	call	strchr@PLT
+.LVL275:
+	.loc 1 250 13 is_stmt 1 view .LVU717
+	.loc 1 250 16 is_stmt 0 view .LVU718
+	testq	%rax, %rax
+	je	.L186
+	.loc 1 251 17 is_stmt 1 view .LVU719
+.LVL276:
+.LBB293:
+.LBI293:
+	.loc 2 362 42 view .LVU720
+.LBB294:
+	.loc 2 364 3 view .LVU721
+.LBE294:
+.LBE293:
+	.loc 1 251 21 is_stmt 0 view .LVU722
+	leaq	1(%rax), %rdi
+.LVL277:
+.LBB296:
+.LBB295:
+	.loc 2 364 16 view .LVU723
+	movl	$10, %edx
+	xorl	%esi, %esi
+	call	strtol@PLT
+.LVL278:
+	.loc 2 364 16 view .LVU724
+.LBE295:
+.LBE296:
+	.loc 1 252 17 is_stmt 1 view .LVU725
+	.loc 1 252 25 is_stmt 0 view .LVU726
+	movl	$2100, %edx
+	movl	$900, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL279:
+	.loc 1 252 51 view .LVU727
+	leal	-900(%rax), %edx
+	.loc 1 252 21 view .LVU728
+	movslq	%edx, %rax
+	sarl	$31, %edx
+	imulq	$1374389535, %rax, %rax
+	sarq	$35, %rax
+	subl	%edx, %eax
+.LVL280:
+	.loc 1 253 17 is_stmt 1 view .LVU729
+	.loc 1 253 20 is_stmt 0 view .LVU730
+	cmpl	$48, %eax
+	ja	.L186
+	.loc 1 254 21 is_stmt 1 view .LVU731
+	.loc 1 254 39 is_stmt 0 view .LVU732
+	movb	%al, 138(%r12,%rbp,8)
+	.loc 1 255 21 is_stmt 1 view .LVU733
+.LVL281:
+	.loc 1 258 13 view .LVU734
+	.loc 1 258 16 is_stmt 0 view .LVU735
+	cmpb	$3, %r13b
+	je	.L177
+.LVL282:
+.L186:
+	.loc 1 259 17 is_stmt 1 view .LVU736
+	movq	$0, 132(%r12,%rbp,8)
+.LBE297:
+	.loc 1 265 1 is_stmt 0 view .LVU737
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	.loc 1 265 1 view .LVU738
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL283:
+.L189:
+	.cfi_restore_state
+.LBB298:
+	.loc 1 223 21 view .LVU739
+	xorl	%r13d, %r13d
+	movslq	%ebp, %rbp
+	.loc 1 223 21 view .LVU740
+	jmp	.L182
+.LVL284:
+.L181:
+	.loc 1 223 21 view .LVU741
+.LBE298:
+	.loc 1 262 13 is_stmt 1 view .LVU742
+	.loc 1 265 1 is_stmt 0 view .LVU743
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	.loc 1 262 13 view .LVU744
+	movl	$40, %esi
+	leaq	.LC52(%rip), %rdi
+	xorl	%eax, %eax
+.LVL285:
+	.loc 1 265 1 view .LVU745
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL286:
+	.loc 1 265 1 view .LVU746
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	.loc 1 262 13 view .LVU747
+	jmp	tfp_printf@PLT
+.LVL287:
+	.cfi_endproc
+.LFE15:
+	.size	cliAux, .-cliAux
+	.section	.rodata.cliTasks.str1.1,"aMS",@progbits,1
+.LC53:
+	.string	"Statistics cleared\r\n"
+.LC54:
+	.string	"System load: %d%%\r\n"
+	.section	.rodata.cliTasks.str1.8,"aMS",@progbits,1
+	.align 8
+.LC55:
+	.string	"Task      period(us)  avg(us)  max(us) load  total(ms)\r\n"
+	.section	.rodata.cliTasks.str1.1
+.LC56:
+	.string	"%9s %10d %8d %8d %3d%% %10d\r\n"
+	.section	.rodata.cliTasks.str1.8
+	.align 8
+.LC57:
+	.string	"\r\nGyro sync: %d samples, %d updates, %d missed, %d timeouts\r\n"
+	.align 8
+.LC58:
+	.string	"Latency(us) min %d avg %d max %d, jitter(us) avg %d max %d\r\n"
+	.align 8
+.LC59:
+	.string	"\r\nStage         count  min(us)  avg(us)  max(us)  histogram <4,<8,<16..<1024,more (us)\r\n"
+	.section	.rodata.cliTasks.str1.1
+.LC60:
+	.string	"%9s %9d %8d %8d %8d "
+.LC61:
+	.string	" %d"
+	.section	.rodata.cliTasks.str1.8
+	.align 8
+.LC62:
+	.string	"\r\nMSP command   count  avg(us)  max(us)\r\n"
+	.section	.rodata.cliTasks.str1.1
+.LC63:
+	.string	"%11d %7d %8d %8d\r\n"
+	.section	.text.cliTasks,"ax",@progbits
+	.p2align 4
+	.type	cliTasks, @function
+cliTasks:
+.LVL288:
+.LFB37:
+	.loc 1 997 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 998 5 view .LVU749
+	.loc 1 999 5 view .LVU750
+	.loc 1 1001 5 view .LVU751
+	.loc 1 997 1 is_stmt 0 view .LVU752
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 1001 9 view .LVU753
+	movl	$5, %edx
+	leaq	.LC46(%rip), %rsi
+	.loc 1 997 1 view .LVU754
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 1001 9 view .LVU755
+	call	strncasecmp@PLT
+.LVL289:
+	.loc 1 1001 8 view .LVU756
+	testl	%eax, %eax
+	je	.L227
+.LBB316:
+.LBI316:
+	.loc 1 996 13 is_stmt 1 view .LVU757
+.LVL290:
+.LBB317:
+	.loc 1 1010 5 view .LVU758
+	movzwl	averageSystemLoadPercent(%rip), %esi
+	xorl	%eax, %eax
+.LBB318:
+.LBB319:
+	.loc 1 822 5 is_stmt 0 view .LVU759
+	xorl	%ebx, %ebx
+	leaq	16(%rsp), %rbp
+.LBE319:
+.LBE318:
+	.loc 1 1010 5 view .LVU760
+	leaq	.LC54(%rip), %rdi
+	.loc 1 1017 9 view .LVU761
+	leaq	.LC56(%rip), %r12
+	.loc 1 1010 5 view .LVU762
+	call	tfp_printf@PLT
+.LVL291:
+	.loc 1 1011 5 is_stmt 1 view .LVU763
+.LBB321:
+.LBI318:
+	.loc 1 820 13 view .LVU764
+.LBB320:
+	.loc 1 822 5 view .LVU765
+	movq	cliPort(%rip), %rdi
+	leaq	.LC55(%rip), %rsi
+	call	serialPrint@PLT
+.LVL292:
+	.loc 1 822 5 is_stmt 0 view .LVU766
+.LBE320:
+.LBE321:
+	.loc 1 1012 5 is_stmt 1 view .LVU767
+	.loc 1 1012 29 view .LVU768
+	.p2align 4,,10
+	.p2align 3
+.L202:
+	.loc 1 1013 9 view .LVU769
+	movq	%rbp, %rsi
+	movl	%ebx, %edi
+	call	getTaskInfo@PLT
+.LVL293:
+	.loc 1 1014 9 view .LVU770
+	.loc 1 1014 12 is_stmt 0 view .LVU771
+	cmpb	$0, 24(%rsp)
+	je	.L200
+	.loc 1 1017 9 is_stmt 1 view .LVU772
+	movl	40(%rsp), %ecx
+	.loc 1 1022 21 is_stmt 0 view .LVU773
+	movl	32(%rsp), %esi
+	.loc 1 1017 9 view .LVU774
+	movl	$100, %r9d
+	.loc 1 1022 47 view .LVU775
+	movl	44(%rsp), %edi
+	.loc 1 1017 9 view .LVU776
+	imulq	$274877907, %rcx, %rcx
+	shrq	$38, %rcx
+	testl	%esi, %esi
+	je	.L201
+	.loc 1 1022 69 view .LVU777
+	imull	$100, %edi, %eax
+	.loc 1 1017 9 view .LVU778
+	xorl	%edx, %edx
+	divl	%esi
+	movl	%eax, %r9d
+.L201:
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 136
+	movl	%esi, %edx
+	xorl	%eax, %eax
+	pushq	%rcx
+	.cfi_def_cfa_offset 144
+	movl	52(%rsp), %r8d
+	movl	%edi, %ecx
+	movq	%r12, %rdi
+	movq	32(%rsp), %rsi
+	call	tfp_printf@PLT
+.LVL294:
+	popq	%rax
+	.cfi_def_cfa_offset 136
+	popq	%rdx
+	.cfi_def_cfa_offset 128
+.L200:
+	.loc 1 1012 49 is_stmt 1 view .LVU779
+.LVL295:
+	.loc 1 1012 29 view .LVU780
+	addl	$1, %ebx
+.LVL296:
+	.loc 1 1012 29 is_stmt 0 view .LVU781
+	cmpl	$8, %ebx
+	jne	.L202
+	.loc 1 1027 5 is_stmt 1 view .LVU782
+	.loc 1 1027 9 is_stmt 0 view .LVU783
+	call	gyroSyncIsEnabled@PLT
+.LVL297:
+	.loc 1 1027 8 view .LVU784
+	testb	%al, %al
+	jne	.L228
+.L203:
+	.loc 1 1044 5 is_stmt 1 view .LVU785
+	.loc 1 1044 37 is_stmt 0 view .LVU786
+	call	getProfileCyclesPerMicrosecond@PLT
+.LVL298:
+.LBB322:
+.LBB323:
+	.loc 1 822 5 view .LVU787
+	movq	cliPort(%rip), %rdi
+	xorl	%r12d, %r12d
+	leaq	.LC59(%rip), %rsi
+.LBE323:
+.LBE322:
+	.loc 1 1044 37 view .LVU788
+	movl	%eax, %r13d
+.LVL299:
+	.loc 1 1045 5 is_stmt 1 view .LVU789
+	.loc 1 1046 5 view .LVU790
+	.loc 1 1048 5 view .LVU791
+.LBB325:
+.LBI322:
+	.loc 1 820 13 view .LVU792
+.LBB324:
+	.loc 1 822 5 view .LVU793
+	leaq	.LC61(%rip), %rbp
+	call	serialPrint@PLT
+.LVL300:
+	.loc 1 822 5 is_stmt 0 view .LVU794
+.LBE324:
+.LBE325:
+	.loc 1 1049 5 is_stmt 1 view .LVU795
+	.loc 1 1049 27 view .LVU796
+	.p2align 4,,10
+	.p2align 3
+.L207:
+.LBB326:
+	.loc 1 1050 9 view .LVU797
+	.loc 1 1050 44 is_stmt 0 view .LVU798
+	movl	%r12d, %edi
+	.loc 1 1051 9 view .LVU799
+	xorl	%ebx, %ebx
+	.loc 1 1050 44 view .LVU800
+	call	getProfileStageStats@PLT
+.LVL301:
+	.loc 1 1051 9 view .LVU801
+	xorl	%edx, %edx
+	.loc 1 1055 13 view .LVU802
+	movl	%r12d, %edi
+	.loc 1 1050 44 view .LVU803
+	movq	%rax, %r14
+.LVL302:
+	.loc 1 1051 9 is_stmt 1 view .LVU804
+	movl	12(%rax), %eax
+.LVL303:
+	.loc 1 1051 9 is_stmt 0 view .LVU805
+	divl	%r13d
+	movl	%eax, 8(%rsp)
+	.loc 1 1055 13 view .LVU806
+	call	getProfileStageAverageCycles@PLT
+.LVL304:
+	.loc 1 1051 9 view .LVU807
+	xorl	%edx, %edx
+	.loc 1 1054 18 view .LVU808
+	movl	4(%r14), %r15d
+	.loc 1 1051 9 view .LVU809
+	divl	%r13d
+	movl	%eax, %r8d
+	testl	%r15d, %r15d
+	je	.L205
+	movl	8(%r14), %eax
+	xorl	%edx, %edx
+	divl	%r13d
+	movl	%eax, %ebx
+.L205:
+	movl	%r12d, %edi
+	movl	%r8d, 12(%rsp)
+	call	getProfileStageName@PLT
+.LVL305:
+	movl	8(%rsp), %r9d
+	movl	%ebx, %ecx
+	movl	%r15d, %edx
+	movl	12(%rsp), %r8d
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	leaq	24(%r14), %r15
+	leaq	.LC60(%rip), %rdi
+	leaq	44(%r14), %rbx
+	call	tfp_printf@PLT
+.LVL306:
+	.loc 1 1058 9 is_stmt 1 view .LVU810
+	.loc 1 1058 33 view .LVU811
+	.p2align 4,,10
+	.p2align 3
+.L206:
+	.loc 1 1059 13 view .LVU812
+	movzwl	(%r15), %esi
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	.loc 1 1058 33 is_stmt 0 view .LVU813
+	addq	$2, %r15
+.LVL307:
+	.loc 1 1059 13 view .LVU814
+	call	tfp_printf@PLT
+.LVL308:
+	.loc 1 1058 45 is_stmt 1 view .LVU815
+	.loc 1 1058 33 view .LVU816
+	cmpq	%rbx, %r15
+	jne	.L206
+	.loc 1 1061 9 view .LVU817
+.LVL309:
+.LBB327:
+.LBI327:
+	.loc 1 820 13 view .LVU818
+.LBB328:
+	.loc 1 822 5 view .LVU819
+	movq	cliPort(%rip), %rdi
+	leaq	.LC9(%rip), %rsi
+.LBE328:
+.LBE327:
+.LBE326:
+	.loc 1 1049 27 is_stmt 0 view .LVU820
+	addl	$1, %r12d
+.LVL310:
+.LBB331:
+.LBB330:
+.LBB329:
+	.loc 1 822 5 view .LVU821
+	call	serialPrint@PLT
+.LVL311:
+	.loc 1 822 5 view .LVU822
+.LBE329:
+.LBE330:
+.LBE331:
+	.loc 1 1049 55 is_stmt 1 view .LVU823
+	.loc 1 1049 27 view .LVU824
+	cmpl	$9, %r12d
+	jne	.L207
+	.loc 1 1064 5 view .LVU825
+	.loc 1 1066 5 view .LVU826
+.LVL312:
+.LBB332:
+.LBI332:
+	.loc 1 820 13 view .LVU827
+.LBB333:
+	.loc 1 822 5 view .LVU828
+	movq	cliPort(%rip), %rdi
+	leaq	.LC62(%rip), %rsi
+.LBE333:
+.LBE332:
+	.loc 1 1067 23 is_stmt 0 view .LVU829
+	xorl	%ebx, %ebx
+.LBB335:
+	.loc 1 1072 9 view .LVU830
+	leaq	.LC63(%rip), %r13
+.LVL313:
+	.loc 1 1072 9 view .LVU831
+.LBE335:
+.LBB336:
+.LBB334:
+	.loc 1 822 5 view .LVU832
+	call	serialPrint@PLT
+.LVL314:
+	.loc 1 822 5 view .LVU833
+.LBE334:
+.LBE336:
+	.loc 1 1067 5 is_stmt 1 view .LVU834
+	.loc 1 1067 5 is_stmt 0 view .LVU835
+	jmp	.L208
+.LVL315:
+	.p2align 4,,10
+	.p2align 3
+.L210:
+.LBB337:
+	.loc 1 1068 9 is_stmt 1 view .LVU836
+	.loc 1 1068 49 is_stmt 0 view .LVU837
+	movzbl	%bl, %r12d
+	movl	%r12d, %edi
+	call	getMspCommandStats@PLT
+.LVL316:
+	.loc 1 1069 9 is_stmt 1 view .LVU838
+	.loc 1 1069 26 is_stmt 0 view .LVU839
+	movl	(%rax), %ebp
+	.loc 1 1069 12 view .LVU840
+	testl	%ebp, %ebp
+	je	.L209
+	.loc 1 1072 9 is_stmt 1 view .LVU841
+	.loc 1 1076 25 is_stmt 0 view .LVU842
+	movl	8(%rax), %r15d
+	.loc 1 1072 9 view .LVU843
+	movl	4(%rax), %eax
+.LVL317:
+	.loc 1 1072 9 view .LVU844
+	xorl	%edx, %edx
+	.loc 1 1073 13 view .LVU845
+	movl	%r12d, %edi
+	.loc 1 1072 9 view .LVU846
+	divl	%ebp
+	movl	%eax, %r14d
+	.loc 1 1073 13 view .LVU847
+	call	getMspCommandId@PLT
+.LVL318:
+	.loc 1 1072 9 view .LVU848
+	movl	%r15d, %r8d
+	movl	%r14d, %ecx
+	movl	%ebp, %edx
+	movzwl	%ax, %esi
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL319:
+.L209:
+	.loc 1 1072 9 view .LVU849
+.LBE337:
+	.loc 1 1067 77 is_stmt 1 view .LVU850
+	addl	$1, %ebx
+.LVL320:
+.L208:
+	.loc 1 1067 41 view .LVU851
+	.loc 1 1067 43 is_stmt 0 view .LVU852
+	call	getMspCommandCount@PLT
+.LVL321:
+	.loc 1 1067 41 view .LVU853
+	cmpb	%al, %bl
+	jb	.L210
+.LBE317:
+.LBE316:
+	.loc 1 1080 1 view .LVU854
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL322:
+	.loc 1 1080 1 view .LVU855
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL323:
+.L228:
+	.cfi_restore_state
+.LBB340:
+.LBB339:
+.LBB338:
+	.loc 1 1028 9 is_stmt 1 view .LVU856
+	.loc 1 1028 44 is_stmt 0 view .LVU857
+	call	getGyroSyncStats@PLT
+.LVL324:
+	.loc 1 1032 9 view .LVU858
+	leaq	.LC57(%rip), %rdi
+	.loc 1 1029 48 view .LVU859
+	movl	12(%rax), %ebp
+	.loc 1 1029 69 view .LVU860
+	movl	8(%rax), %r12d
+	.loc 1 1028 44 view .LVU861
+	movq	%rax, %rbx
+.LVL325:
+	.loc 1 1029 9 is_stmt 1 view .LVU862
+	.loc 1 1030 9 view .LVU863
+	.loc 1 1032 9 view .LVU864
+	movl	4(%rax), %ecx
+	movl	(%rax), %esi
+	xorl	%eax, %eax
+.LVL326:
+	.loc 1 1032 9 is_stmt 0 view .LVU865
+	movl	%ebp, %edx
+	movl	%r12d, %r8d
+	call	tfp_printf@PLT
+.LVL327:
+	.loc 1 1034 9 is_stmt 1 view .LVU866
+	.loc 1 1030 81 is_stmt 0 view .LVU867
+	movl	$2, %eax
+	.loc 1 1037 22 view .LVU868
+	movl	20(%rbx), %esi
+	.loc 1 1039 22 view .LVU869
+	movl	28(%rbx), %r9d
+	.loc 1 1030 81 view .LVU870
+	cmpl	%eax, %ebp
+	cmovnb	%ebp, %eax
+	.loc 1 1034 9 view .LVU871
+	xorl	%edx, %edx
+	.loc 1 1030 18 view .LVU872
+	leal	-1(%rax), %ecx
+	.loc 1 1034 9 view .LVU873
+	movl	32(%rbx), %eax
+	divl	%ecx
+	.loc 1 1029 18 view .LVU874
+	subl	%r12d, %ebp
+.LVL328:
+	.loc 1 1029 18 view .LVU875
+	movl	$1, %ecx
+	cmovne	%ebp, %ecx
+	.loc 1 1034 9 view .LVU876
+	xorl	%edx, %edx
+	xorl	%edi, %edi
+	movl	%eax, %r8d
+	movl	24(%rbx), %eax
+	divl	%ecx
+	testl	%esi, %esi
+	je	.L204
+	movl	16(%rbx), %edi
+.L204:
+	movl	%esi, %ecx
+	movl	%eax, %edx
+	movl	%edi, %esi
+	xorl	%eax, %eax
+	leaq	.LC58(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL329:
+	jmp	.L203
+.LVL330:
+.L227:
+	.loc 1 1034 9 view .LVU877
+.LBE338:
+.LBE339:
+.LBE340:
+	.loc 1 1003 9 is_stmt 1 view .LVU878
+	call	profilingReset@PLT
+.LVL331:
+	.loc 1 1005 9 view .LVU879
+	call	gyroSyncResetStats@PLT
+.LVL332:
+	.loc 1 1006 9 view .LVU880
+.LBB341:
+.LBI341:
+	.loc 1 820 13 view .LVU881
+.LBB342:
+	.loc 1 822 5 view .LVU882
+	movq	cliPort(%rip), %rdi
+.LBE342:
+.LBE341:
+	.loc 1 1080 1 is_stmt 0 view .LVU883
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+.LBB345:
+.LBB343:
+	.loc 1 822 5 view .LVU884
+	leaq	.LC53(%rip), %rsi
+.LBE343:
+.LBE345:
+	.loc 1 1080 1 view .LVU885
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB346:
+.LBB344:
+	.loc 1 822 5 view .LVU886
+	jmp	serialPrint@PLT
+.LVL333:
+.LBE344:
+.LBE346:
+	.cfi_endproc
+.LFE37:
+	.size	cliTasks, .-cliTasks
+	.section	.rodata.cliProfile.str1.1,"aMS",@progbits,1
+.LC64:
+	.string	"profile %d\r\n"
+	.section	.text.cliProfile,"ax",@progbits
+	.p2align 4
+	.type	cliProfile, @function
+cliProfile:
+.LVL334:
+.LFB26:
+	.loc 1 776 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 776 1 is_stmt 0 view .LVU888
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 780 11 view .LVU889
+	movq	%rdi, 8(%rsp)
+	call	strlen@PLT
+.LVL335:
+	.loc 1 777 5 is_stmt 1 view .LVU890
+	.loc 1 778 5 view .LVU891
+	.loc 1 780 5 view .LVU892
+	.loc 1 781 5 view .LVU893
+	.loc 1 781 8 is_stmt 0 view .LVU894
+	movq	8(%rsp), %rdi
+	testb	%al, %al
+	je	.L232
+	.loc 1 785 9 is_stmt 1 view .LVU895
+.LVL336:
+.LBB353:
+.LBI353:
+	.loc 2 362 42 view .LVU896
+.LBB354:
+	.loc 2 364 3 view .LVU897
+	.loc 2 364 16 is_stmt 0 view .LVU898
+	xorl	%esi, %esi
+	movl	$10, %edx
+	call	strtol@PLT
+.LVL337:
+	.loc 2 364 16 view .LVU899
+.LBE354:
+.LBE353:
+	.loc 1 786 9 is_stmt 1 view .LVU900
+	.loc 1 786 12 is_stmt 0 view .LVU901
+	cmpl	$2, %eax
+	ja	.L229
+	.loc 1 787 13 is_stmt 1 view .LVU902
+	.loc 1 787 48 is_stmt 0 view .LVU903
+	movb	%al, 2008+masterConfig(%rip)
+	.loc 1 788 13 is_stmt 1 view .LVU904
+	xorl	%eax, %eax
+.LVL338:
+	.loc 1 788 13 is_stmt 0 view .LVU905
+	call	writeEEPROM@PLT
+.LVL339:
+	.loc 1 789 13 is_stmt 1 view .LVU906
+	call	readEEPROM@PLT
+.LVL340:
+	.loc 1 790 13 view .LVU907
+	.loc 1 777 5 view .LVU908
+	.loc 1 778 5 view .LVU909
+	.loc 1 780 5 view .LVU910
+	.loc 1 781 5 view .LVU911
+.L232:
+.LBB355:
+.LBI355:
+	.loc 1 775 13 view .LVU912
+.LBB356:
+	.loc 1 782 9 view .LVU913
+	movzbl	2008+masterConfig(%rip), %esi
+	leaq	.LC64(%rip), %rdi
+	xorl	%eax, %eax
+.LBE356:
+.LBE355:
+	.loc 1 793 1 is_stmt 0 view .LVU914
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LBB358:
+.LBB357:
+	.loc 1 782 9 view .LVU915
+	jmp	tfp_printf@PLT
+.LVL341:
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	.cfi_restore_state
+	.loc 1 782 9 view .LVU916
+.LBE357:
+.LBE358:
+	.loc 1 793 1 view .LVU917
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	cliProfile, .-cliProfile
+	.section	.rodata.cliMotor.str1.8,"aMS",@progbits,1
+	.align 8
+.LC65:
+	.string	"Usage:\r\nmotor index [value] - show [or set] motor value\r\n"
+	.section	.rodata.cliMotor.str1.1,"aMS",@progbits,1
+.LC66:
+	.string	" "
+	.section	.rodata.cliMotor.str1.8
+	.align 8
+.LC67:
+	.string	"No such motor, use a number [0, %d]\r\n"
+	.section	.rodata.cliMotor.str1.1
+.LC68:
+	.string	"Motor %d is set at %d\r\n"
+	.section	.rodata.cliMotor.str1.8
+	.align 8
+.LC69:
+	.string	"Invalid motor value, 1000..2000\r\n"
+	.section	.rodata.cliMotor.str1.1
+.LC70:
+	.string	"Setting motor %d to %d\r\n"
+	.section	.text.cliMotor,"ax",@progbits
+	.p2align 4
+	.type	cliMotor, @function
+cliMotor:
+.LVL342:
+.LFB25:
+	.loc 1 730 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 731 5 view .LVU919
+	.loc 1 732 5 view .LVU920
+	.loc 1 733 5 view .LVU921
+	.loc 1 734 5 view .LVU922
+	.loc 1 736 5 view .LVU923
+	.loc 1 730 1 is_stmt 0 view .LVU924
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 736 11 view .LVU925
+	call	strlen@PLT
+.LVL343:
+	.loc 1 737 5 is_stmt 1 view .LVU926
+	.loc 1 738 9 is_stmt 0 view .LVU927
+	leaq	.LC65(%rip), %rdi
+	.loc 1 737 8 view .LVU928
+	testl	%eax, %eax
+	je	.L246
+.LVL344:
+.LBB365:
+.LBI365:
+	.loc 1 729 13 is_stmt 1 view .LVU929
+.LBB366:
+	.loc 1 742 5 view .LVU930
+	.loc 1 742 11 is_stmt 0 view .LVU931
+	leaq	.LC66(%rip), %r12
+	movq	%rbx, %rdi
+	movq	%r12, %rsi
+	call	strtok@PLT
+.LVL345:
+	.loc 1 742 11 view .LVU932
+	movq	%rax, %rdi
+.LVL346:
+	.loc 1 743 5 is_stmt 1 view .LVU933
+	.loc 1 743 16 view .LVU934
+	testq	%rax, %rax
+	je	.L244
+	.loc 1 744 9 view .LVU935
+	.loc 1 746 17 view .LVU936
+.LVL347:
+.LBB367:
+.LBI367:
+	.loc 2 362 42 view .LVU937
+.LBB368:
+	.loc 2 364 3 view .LVU938
+	.loc 2 364 16 is_stmt 0 view .LVU939
+	movl	$10, %edx
+	xorl	%esi, %esi
+.LBE368:
+.LBE367:
+	.loc 1 733 14 view .LVU940
+	xorl	%ebx, %ebx
+.LVL348:
+	.loc 1 732 9 view .LVU941
+	xorl	%ebp, %ebp
+.LBB371:
+.LBB369:
+	.loc 2 364 16 view .LVU942
+	call	strtol@PLT
+.LVL349:
+	.loc 2 364 16 view .LVU943
+	movq	%rax, %r13
+.LVL350:
+	.loc 2 364 16 view .LVU944
+.LBE369:
+.LBE371:
+	.loc 1 747 17 is_stmt 1 view .LVU945
+.L240:
+	.loc 1 752 9 view .LVU946
+	.loc 1 753 15 is_stmt 0 view .LVU947
+	xorl	%edi, %edi
+	movq	%r12, %rsi
+	.loc 1 752 14 view .LVU948
+	addl	$1, %ebx
+.LVL351:
+	.loc 1 753 9 is_stmt 1 view .LVU949
+	.loc 1 753 15 is_stmt 0 view .LVU950
+	call	strtok@PLT
+.LVL352:
+	.loc 1 743 16 is_stmt 1 view .LVU951
+	testq	%rax, %rax
+	je	.L238
+	.loc 1 744 9 view .LVU952
+	cmpl	$1, %ebx
+	jne	.L240
+	.loc 1 749 17 view .LVU953
+.LVL353:
+.LBB372:
+.LBI372:
+	.loc 2 362 42 view .LVU954
+.LBB373:
+	.loc 2 364 3 view .LVU955
+	.loc 2 364 16 is_stmt 0 view .LVU956
+	movl	$10, %edx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	call	strtol@PLT
+.LVL354:
+	.loc 2 364 10 view .LVU957
+	movl	%eax, %ebp
+.LVL355:
+	.loc 2 364 10 view .LVU958
+.LBE373:
+.LBE372:
+	.loc 1 750 17 is_stmt 1 view .LVU959
+	jmp	.L240
+.LVL356:
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	.loc 1 756 5 view .LVU960
+	.loc 1 756 8 is_stmt 0 view .LVU961
+	cmpl	$11, %r13d
+	ja	.L247
+.LBB374:
+.LBB370:
+	.loc 2 364 10 view .LVU962
+	movl	%r13d, %esi
+.LBE370:
+.LBE374:
+	.loc 1 761 5 is_stmt 1 view .LVU963
+	.loc 1 761 8 is_stmt 0 view .LVU964
+	cmpl	$1, %ebx
+	je	.L236
+.LVL357:
+	.loc 1 766 5 is_stmt 1 view .LVU965
+	.loc 1 766 28 is_stmt 0 view .LVU966
+	leal	-1000(%rbp), %eax
+.LVL358:
+	.loc 1 766 8 view .LVU967
+	cmpl	$1000, %eax
+	ja	.L248
+	.loc 1 771 5 is_stmt 1 view .LVU968
+	movl	%ebp, %edx
+	xorl	%eax, %eax
+	leaq	.LC70(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL359:
+	.loc 1 772 5 view .LVU969
+	.loc 1 772 33 is_stmt 0 view .LVU970
+	movslq	%r13d, %rax
+	leaq	motor_disarmed(%rip), %rdx
+	movw	%bp, (%rdx,%rax,2)
+.LVL360:
+	.loc 1 772 33 view .LVU971
+.LBE366:
+.LBE365:
+	.loc 1 773 1 view .LVU972
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL361:
+	.p2align 4,,10
+	.p2align 3
+.L248:
+	.cfi_restore_state
+.LBB381:
+.LBB375:
+	.loc 1 767 9 is_stmt 1 view .LVU973
+	leaq	.LC69(%rip), %rdi
+	xorl	%eax, %eax
+.LVL362:
+.L246:
+	.loc 1 767 9 is_stmt 0 view .LVU974
+.LBE375:
+.LBE381:
+	.loc 1 773 1 view .LVU975
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB382:
+.LBB376:
+	.loc 1 767 9 view .LVU976
+	jmp	tfp_printf@PLT
+.LVL363:
+	.p2align 4,,10
+	.p2align 3
+.L247:
+	.cfi_restore_state
+	.loc 1 757 9 is_stmt 1 view .LVU977
+.LBE376:
+.LBE382:
+	.loc 1 773 1 is_stmt 0 view .LVU978
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LBB383:
+.LBB377:
+	.loc 1 757 9 view .LVU979
+	movl	$12, %esi
+	leaq	.LC67(%rip), %rdi
+	xorl	%eax, %eax
+.LVL364:
+	.loc 1 757 9 view .LVU980
+.LBE377:
+.LBE383:
+	.loc 1 773 1 view .LVU981
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL365:
+	.loc 1 773 1 view .LVU982
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL366:
+	.loc 1 773 1 view .LVU983
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL367:
+.LBB384:
+.LBB378:
+	.loc 1 757 9 view .LVU984
+	jmp	tfp_printf@PLT
+.LVL368:
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	.cfi_restore_state
+	.loc 1 731 9 view .LVU985
+	xorl	%esi, %esi
+.LVL369:
+.L236:
+	.loc 1 762 9 is_stmt 1 view .LVU986
+	leaq	motor_disarmed(%rip), %rax
+.LVL370:
+	.loc 1 762 76 is_stmt 0 view .LVU987
+	movslq	%esi, %rdx
+	.loc 1 762 9 view .LVU988
+	leaq	.LC68(%rip), %rdi
+	movswl	(%rax,%rdx,2), %edx
+.LBE378:
+.LBE384:
+	.loc 1 773 1 view .LVU989
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+.LBB385:
+.LBB379:
+	.loc 1 762 9 view .LVU990
+	xorl	%eax, %eax
+.LBE379:
+.LBE385:
+	.loc 1 773 1 view .LVU991
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB386:
+.LBB380:
+	.loc 1 762 9 view .LVU992
+	jmp	tfp_printf@PLT
+.LVL371:
+.LBE380:
+.LBE386:
+	.cfi_endproc
+.LFE25:
+	.size	cliMotor, .-cliMotor
+	.section	.rodata.cliGet.str1.1,"aMS",@progbits,1
+.LC71:
+	.string	"%s = "
+.LC72:
+	.string	"Unknown variable name\r\n"
+	.section	.text.cliGet,"ax",@progbits
+	.p2align 4
+	.type	cliGet, @function
+cliGet:
+.LVL372:
+.LFB35:
+	.loc 1 911 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 912 5 view .LVU994
+	.loc 1 913 5 view .LVU995
+	.loc 1 914 5 view .LVU996
+	.loc 1 916 5 view .LVU997
+	.loc 1 916 19 view .LVU998
+	.loc 1 911 1 is_stmt 0 view .LVU999
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 916 19 view .LVU1000
+	movzwl	configValueCount(%rip), %edx
+	testw	%dx, %dx
+	je	.L250
+	leal	-1(%rdx), %eax
+	leaq	configValues(%rip), %rbx
+	movq	%rdi, %rbp
+	.loc 1 914 9 view .LVU1001
+	xorl	%r12d, %r12d
+	leaq	(%rax,%rax,2), %rdx
+	leaq	24(%rbx), %rax
+	leaq	(%rax,%rdx,8), %r13
+	.loc 1 919 13 view .LVU1002
+	leaq	.LC71(%rip), %r15
+.LVL373:
+	.p2align 4,,10
+	.p2align 3
+.L252:
+	.loc 1 917 9 is_stmt 1 view .LVU1003
+	.loc 1 917 35 is_stmt 0 view .LVU1004
+	movq	(%rbx), %r14
+	.loc 1 917 13 view .LVU1005
+	movq	%rbp, %rsi
+	movq	%r14, %rdi
+	call	strstr@PLT
+.LVL374:
+	.loc 1 917 12 view .LVU1006
+	testq	%rax, %rax
+	je	.L251
+	.loc 1 918 13 is_stmt 1 view .LVU1007
+.LVL375:
+	.loc 1 919 13 view .LVU1008
+	xorl	%eax, %eax
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	.loc 1 923 28 is_stmt 0 view .LVU1009
+	addl	$1, %r12d
+.LVL376:
+	.loc 1 919 13 view .LVU1010
+	call	tfp_printf@PLT
+.LVL377:
+	.loc 1 920 13 is_stmt 1 view .LVU1011
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	cliPrintVar
+.LVL378:
+	.loc 1 921 13 view .LVU1012
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL379:
+	.loc 1 923 13 view .LVU1013
+.L251:
+	.loc 1 916 40 discriminator 2 view .LVU1014
+	.loc 1 916 19 discriminator 2 view .LVU1015
+	addq	$24, %rbx
+	cmpq	%r13, %rbx
+	jne	.L252
+	.loc 1 928 5 view .LVU1016
+	.loc 1 928 8 is_stmt 0 view .LVU1017
+	testl	%r12d, %r12d
+	je	.L250
+	.loc 1 933 1 view .LVU1018
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL380:
+	.loc 1 933 1 view .LVU1019
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL381:
+	.loc 1 933 1 view .LVU1020
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL382:
+	.p2align 4,,10
+	.p2align 3
+.L250:
+	.cfi_restore_state
+	.loc 1 928 5 is_stmt 1 view .LVU1021
+.LBB391:
+.LBI391:
+	.loc 1 910 13 view .LVU1022
+.LBB392:
+	.loc 1 932 5 view .LVU1023
+.LBB393:
+.LBI393:
+	.loc 1 820 13 view .LVU1024
+.LBB394:
+	.loc 1 822 5 view .LVU1025
+	movq	cliPort(%rip), %rdi
+.LBE394:
+.LBE393:
+.LBE392:
+.LBE391:
+	.loc 1 933 1 is_stmt 0 view .LVU1026
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 56
+.LBB401:
+.LBB399:
+.LBB397:
+.LBB395:
+	.loc 1 822 5 view .LVU1027
+	leaq	.LC72(%rip), %rsi
+.LBE395:
+.LBE397:
+.LBE399:
+.LBE401:
+	.loc 1 933 1 view .LVU1028
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB402:
+.LBB400:
+.LBB398:
+.LBB396:
+	.loc 1 822 5 view .LVU1029
+	jmp	serialPrint@PLT
+.LVL383:
+.LBE396:
+.LBE398:
+.LBE400:
+.LBE402:
+	.cfi_endproc
+.LFE35:
+	.size	cliGet, .-cliGet
+	.section	.rodata.cliSet.str1.1,"aMS",@progbits,1
+.LC73:
+	.string	"Current settings: \r\n"
+.LC74:
+	.string	"%s set to "
+	.section	.rodata.cliSet.str1.8,"aMS",@progbits,1
+	.align 8
+.LC75:
+	.string	"Value assignment out of range\r\n"
+	.section	.text.cliSet,"ax",@progbits
+	.p2align 4
+	.type	cliSet, @function
+cliSet:
+.LVL384:
+.LFB34:
+	.loc 1 854 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 855 5 view .LVU1031
+	.loc 1 856 5 view .LVU1032
+	.loc 1 857 5 view .LVU1033
+	.loc 1 858 5 view .LVU1034
+	.loc 1 859 5 view .LVU1035
+	.loc 1 860 5 view .LVU1036
+	.loc 1 862 5 view .LVU1037
+	.loc 1 854 1 is_stmt 0 view .LVU1038
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 862 11 view .LVU1039
+	call	strlen@PLT
+.LVL385:
+	.loc 1 862 9 view .LVU1040
+	movl	%eax, %ebp
+.LVL386:
+	.loc 1 864 5 is_stmt 1 view .LVU1041
+	.loc 1 864 8 is_stmt 0 view .LVU1042
+	testl	%eax, %eax
+	je	.L267
+	.loc 1 864 18 discriminator 1 view .LVU1043
+	cmpl	$1, %eax
+	je	.L295
+.L268:
+	.loc 1 872 12 is_stmt 1 view .LVU1044
+	.loc 1 872 25 is_stmt 0 view .LVU1045
+	movl	$61, %esi
+	movq	%r12, %rdi
+	call	strchr@PLT
+.LVL387:
+	.loc 1 872 15 view .LVU1046
+	testq	%rax, %rax
+	je	.L273
+.LVL388:
+.LBB403:
+	.loc 1 875 45 is_stmt 1 view .LVU1047
+	cmpb	$32, -1(%rax)
+	movq	%rax, %rbp
+.LVL389:
+	.loc 1 875 45 is_stmt 0 view .LVU1048
+	jne	.L274
+.LVL390:
+	.p2align 4,,10
+	.p2align 3
+.L275:
+	.loc 1 876 13 is_stmt 1 view .LVU1049
+	.loc 1 876 34 is_stmt 0 view .LVU1050
+	subq	$1, %rbp
+.LVL391:
+	.loc 1 875 45 is_stmt 1 view .LVU1051
+	cmpb	$32, -1(%rbp)
+	je	.L275
+.L274:
+	.loc 1 878 9 view .LVU1052
+	.loc 1 880 14 is_stmt 0 view .LVU1053
+	leaq	1(%rax), %rbx
+.LBB404:
+.LBB405:
+	.loc 2 364 16 view .LVU1054
+	movl	$10, %edx
+	xorl	%esi, %esi
+.LBE405:
+.LBE404:
+	.loc 1 878 60 view .LVU1055
+	subq	%r12, %rbp
+.LVL392:
+	.loc 1 880 9 is_stmt 1 view .LVU1056
+	.loc 1 881 9 view .LVU1057
+	.loc 1 882 9 view .LVU1058
+.LBB408:
+.LBI404:
+	.loc 2 362 42 view .LVU1059
+.LBB406:
+	.loc 2 364 3 view .LVU1060
+	.loc 2 364 16 is_stmt 0 view .LVU1061
+	movq	%rbx, %rdi
+	call	strtol@PLT
+.LVL393:
+.LBE406:
+.LBE408:
+	.loc 1 883 18 view .LVU1062
+	movq	%rbx, %rdi
+.LBB409:
+.LBB407:
+	.loc 2 364 16 view .LVU1063
+	movq	%rax, 24(%rsp)
+.LVL394:
+	.loc 2 364 16 view .LVU1064
+.LBE407:
+.LBE409:
+	.loc 1 883 9 is_stmt 1 view .LVU1065
+	.loc 1 883 18 is_stmt 0 view .LVU1066
+	call	fastA2F@PLT
+.LVL395:
+	.loc 1 884 23 view .LVU1067
+	movzwl	configValueCount(%rip), %r13d
+	.loc 1 883 18 view .LVU1068
+	movss	%xmm0, 20(%rsp)
+.LVL396:
+	.loc 1 884 9 is_stmt 1 view .LVU1069
+	.loc 1 884 23 view .LVU1070
+	testw	%r13w, %r13w
+	je	.L276
+	.loc 1 887 117 is_stmt 0 view .LVU1071
+	movzbl	%bpl, %eax
+	leaq	configValues(%rip), %r15
+	.loc 1 884 16 view .LVU1072
+	xorl	%r14d, %r14d
+	.loc 1 887 117 view .LVU1073
+	movq	%rax, 8(%rsp)
+.LVL397:
+	.p2align 4,,10
+	.p2align 3
+.L283:
+	.loc 1 885 13 is_stmt 1 view .LVU1074
+	.loc 1 887 13 view .LVU1075
+	.loc 1 887 82 is_stmt 0 view .LVU1076
+	movq	(%r15), %rbx
+	.loc 1 887 17 view .LVU1077
+	movq	%rbx, %rdi
+	call	strlen@PLT
+.LVL398:
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rax, %rbp
+	call	strncasecmp@PLT
+.LVL399:
+	.loc 1 887 16 view .LVU1078
+	testl	%eax, %eax
+	jne	.L277
+	.loc 1 887 95 discriminator 1 view .LVU1079
+	movq	8(%rsp), %rax
+	cmpq	%rax, %rbp
+	je	.L296
+.L277:
+	.loc 1 884 44 is_stmt 1 discriminator 2 view .LVU1080
+	addl	$1, %r14d
+.LVL400:
+	.loc 1 884 23 discriminator 2 view .LVU1081
+	addq	$24, %r15
+	cmpl	%r13d, %r14d
+	jne	.L283
+.LVL401:
+.L276:
+	.loc 1 903 9 view .LVU1082
+.LBB410:
+.LBI410:
+	.loc 1 820 13 view .LVU1083
+.LBB411:
+	.loc 1 822 5 view .LVU1084
+	leaq	.LC72(%rip), %rsi
+.LVL402:
+.L294:
+	.loc 1 822 5 is_stmt 0 view .LVU1085
+	movq	cliPort(%rip), %rdi
+.LBE411:
+.LBE410:
+.LBE403:
+	.loc 1 908 1 view .LVU1086
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL403:
+	.loc 1 908 1 view .LVU1087
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB421:
+.LBB413:
+.LBB412:
+	.loc 1 822 5 view .LVU1088
+	jmp	serialPrint@PLT
+.LVL404:
+	.p2align 4,,10
+	.p2align 3
+.L295:
+	.cfi_restore_state
+	.loc 1 822 5 view .LVU1089
+.LBE412:
+.LBE413:
+.LBE421:
+	.loc 1 864 31 discriminator 2 view .LVU1090
+	cmpb	$42, (%r12)
+	jne	.L268
+	.p2align 4,,10
+	.p2align 3
+.L267:
+	.loc 1 865 9 is_stmt 1 view .LVU1091
+.LVL405:
+.LBB422:
+.LBI422:
+	.loc 1 820 13 view .LVU1092
+.LBB423:
+	.loc 1 822 5 view .LVU1093
+	movq	cliPort(%rip), %rdi
+	leaq	.LC73(%rip), %rsi
+	call	serialPrint@PLT
+.LVL406:
+	.loc 1 822 5 is_stmt 0 view .LVU1094
+.LBE423:
+.LBE422:
+	.loc 1 866 9 is_stmt 1 view .LVU1095
+	.loc 1 866 23 view .LVU1096
+	movzwl	configValueCount(%rip), %edx
+	testw	%dx, %dx
+	je	.L266
+	leal	-1(%rdx), %eax
+	leaq	configValues(%rip), %rbx
+	leaq	(%rax,%rax,2), %rdx
+	leaq	24(%rbx), %rax
+	leaq	(%rax,%rdx,8), %r14
+	leaq	.LC71(%rip), %r13
+	leaq	.LC9(%rip), %r12
+.LVL407:
+	.p2align 4,,10
+	.p2align 3
+.L271:
+	.loc 1 867 13 discriminator 3 view .LVU1097
+	.loc 1 868 13 discriminator 3 view .LVU1098
+	movq	(%rbx), %rsi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	call	tfp_printf@PLT
+.LVL408:
+	.loc 1 869 13 discriminator 3 view .LVU1099
+	movq	%rbx, %rdi
+	movl	%ebp, %esi
+	.loc 1 866 23 is_stmt 0 discriminator 3 view .LVU1100
+	addq	$24, %rbx
+.LVL409:
+	.loc 1 869 13 discriminator 3 view .LVU1101
+	call	cliPrintVar
+.LVL410:
+	.loc 1 870 13 is_stmt 1 discriminator 3 view .LVU1102
+.LBB424:
+.LBI424:
+	.loc 1 820 13 discriminator 3 view .LVU1103
+.LBB425:
+	.loc 1 822 5 discriminator 3 view .LVU1104
+	movq	cliPort(%rip), %rdi
+	movq	%r12, %rsi
+	call	serialPrint@PLT
+.LVL411:
+	.loc 1 822 5 is_stmt 0 discriminator 3 view .LVU1105
+.LBE425:
+.LBE424:
+	.loc 1 866 44 is_stmt 1 discriminator 3 view .LVU1106
+	.loc 1 866 23 discriminator 3 view .LVU1107
+	cmpq	%rbx, %r14
+	jne	.L271
+.LVL412:
+.L266:
+	.loc 1 908 1 is_stmt 0 view .LVU1108
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL413:
+	.loc 1 908 1 view .LVU1109
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL414:
+	.p2align 4,,10
+	.p2align 3
+.L273:
+	.cfi_restore_state
+	.loc 1 906 6 is_stmt 1 view .LVU1110
+	.loc 1 908 1 is_stmt 0 view .LVU1111
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 906 6 view .LVU1112
+	movq	%r12, %rdi
+	.loc 1 908 1 view .LVU1113
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL415:
+	.loc 1 908 1 view .LVU1114
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL416:
+	.loc 1 908 1 view .LVU1115
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	.loc 1 906 6 view .LVU1116
+	jmp	cliGet
+.LVL417:
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	.cfi_restore_state
+.LBB426:
+	.loc 1 888 17 is_stmt 1 view .LVU1117
+	.loc 1 888 46 is_stmt 0 view .LVU1118
+	movl	%r14d, %ecx
+	.loc 1 888 28 view .LVU1119
+	pxor	%xmm0, %xmm0
+	.loc 1 888 20 view .LVU1120
+	movss	20(%rsp), %xmm1
+	.loc 1 888 46 view .LVU1121
+	leaq	(%rcx,%rcx,2), %rax
+	leaq	configValues(%rip), %rcx
+	leaq	(%rcx,%rax,8), %rbp
+	.loc 1 888 28 view .LVU1122
+	cvtsi2ssl	16(%rbp), %xmm0
+	.loc 1 888 20 view .LVU1123
+	comiss	%xmm0, %xmm1
+	jb	.L278
+	.loc 1 888 61 discriminator 1 view .LVU1124
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	20(%rbp), %xmm0
+	.loc 1 888 51 discriminator 1 view .LVU1125
+	comiss	%xmm1, %xmm0
+	jb	.L278
+.LBB414:
+	.loc 1 889 21 is_stmt 1 view .LVU1126
+	.loc 1 890 21 view .LVU1127
+	.loc 1 891 41 is_stmt 0 view .LVU1128
+	testb	$32, 10(%rbp)
+	movd	%xmm1, %ecx
+.LVL418:
+	.loc 1 891 41 view .LVU1129
+	cmove	24(%rsp), %ecx
+.LVL419:
+	.loc 1 894 21 is_stmt 1 view .LVU1130
+.LBB415:
+.LBI415:
+	.loc 1 848 13 view .LVU1131
+.LBB416:
+	.loc 1 850 5 view .LVU1132
+	movq	%rbp, %rsi
+	movzbl	2008+masterConfig(%rip), %edx
+	leaq	masterConfig(%rip), %rdi
+	call	configValueSet@PLT
+.LVL420:
+	.loc 1 850 5 is_stmt 0 view .LVU1133
+.LBE416:
+.LBE415:
+	.loc 1 895 21 is_stmt 1 view .LVU1134
+	movq	%rbx, %rsi
+	leaq	.LC74(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL421:
+	.loc 1 896 21 view .LVU1135
+.LBE414:
+.LBE426:
+	.loc 1 908 1 is_stmt 0 view .LVU1136
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB427:
+.LBB417:
+	.loc 1 896 21 view .LVU1137
+	movq	%rbp, %rdi
+	xorl	%esi, %esi
+.LBE417:
+.LBE427:
+	.loc 1 908 1 view .LVU1138
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL422:
+	.loc 1 908 1 view .LVU1139
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL423:
+	.loc 1 908 1 view .LVU1140
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB428:
+.LBB418:
+	.loc 1 896 21 view .LVU1141
+	jmp	cliPrintVar
+.LVL424:
+	.p2align 4,,10
+	.p2align 3
+.L278:
+	.cfi_restore_state
+	.loc 1 896 21 view .LVU1142
+.LBE418:
+	.loc 1 898 21 is_stmt 1 view .LVU1143
+.LBB419:
+.LBI419:
+	.loc 1 820 13 view .LVU1144
+.LBB420:
+	.loc 1 822 5 view .LVU1145
+	leaq	.LC75(%rip), %rsi
+	jmp	.L294
+.LBE420:
+.LBE419:
+.LBE428:
+	.cfi_endproc
+.LFE34:
+	.size	cliSet, .-cliSet
+	.section	.rodata.cliExit.str1.1,"aMS",@progbits,1
+.LC76:
+	.string	"\r\nLeaving CLI mode\r\n"
+.LC77:
+	.string	"Saving"
+.LC78:
+	.string	"\r\nRebooting"
+	.section	.text.cliExit,"ax",@progbits
+	.p2align 4
+	.type	cliExit, @function
+cliExit:
+.LVL425:
+.LFB20:
+	.loc 1 549 1 view -0
+	.cfi_startproc
+	.loc 1 550 5 view .LVU1147
+.LBB439:
+.LBI439:
+	.loc 1 820 13 view .LVU1148
+.LBB440:
+	.loc 1 822 5 view .LVU1149
+.LBE440:
+.LBE439:
+	.loc 1 549 1 is_stmt 0 view .LVU1150
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB442:
+.LBB441:
+	.loc 1 822 5 view .LVU1151
+	movq	cliPort(%rip), %rdi
+.LVL426:
+	.loc 1 822 5 view .LVU1152
+	leaq	.LC76(%rip), %rsi
+	call	serialPrint@PLT
+.LVL427:
+	.loc 1 822 5 view .LVU1153
+.LBE441:
+.LBE442:
+	.loc 1 551 5 is_stmt 1 view .LVU1154
+	.loc 1 551 16 is_stmt 0 view .LVU1155
+	movb	$0, cliBuffer(%rip)
+	.loc 1 552 5 is_stmt 1 view .LVU1156
+	.loc 1 552 17 is_stmt 0 view .LVU1157
+	movl	$0, bufferIndex(%rip)
+	.loc 1 553 5 is_stmt 1 view .LVU1158
+	.loc 1 553 13 is_stmt 0 view .LVU1159
+	movb	$0, cliMode(%rip)
+	.loc 1 555 5 is_stmt 1 view .LVU1160
+	call	mixerResetMotors@PLT
+.LVL428:
+	.loc 1 558 5 view .LVU1161
+.LBB443:
+.LBI443:
+	.loc 1 801 13 view .LVU1162
+.LBB444:
+	.loc 1 803 5 view .LVU1163
+	.loc 1 805 5 view .LVU1164
+.LBB445:
+.LBI445:
+	.loc 1 820 13 view .LVU1165
+.LBB446:
+	.loc 1 822 5 view .LVU1166
+	movq	cliPort(%rip), %rdi
+	leaq	.LC77(%rip), %rsi
+	call	serialPrint@PLT
+.LVL429:
+	.loc 1 822 5 is_stmt 0 view .LVU1167
+.LBE446:
+.LBE445:
+	.loc 1 807 5 is_stmt 1 view .LVU1168
+	xorl	%eax, %eax
+	call	writeEEPROM@PLT
+.LVL430:
+	.loc 1 808 5 view .LVU1169
+.LBB447:
+.LBI447:
+	.loc 1 795 13 view .LVU1170
+.LBB448:
+	.loc 1 796 5 view .LVU1171
+.LBB449:
+.LBI449:
+	.loc 1 820 13 view .LVU1172
+.LBB450:
+	.loc 1 822 5 view .LVU1173
+	movq	cliPort(%rip), %rdi
+	leaq	.LC78(%rip), %rsi
+	call	serialPrint@PLT
+.LVL431:
+	.loc 1 822 5 is_stmt 0 view .LVU1174
+.LBE450:
+.LBE449:
+	.loc 1 797 5 is_stmt 1 view .LVU1175
+	movq	cliPort(%rip), %rdi
+	call	waitForSerialPortToFinishTransmitting@PLT
+.LVL432:
+	.loc 1 798 5 view .LVU1176
+.LBE448:
+.LBE447:
+.LBE444:
+.LBE443:
+	.loc 1 562 1 is_stmt 0 view .LVU1177
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+.LBB454:
+.LBB453:
+.LBB452:
+.LBB451:
+	.loc 1 798 5 view .LVU1178
+	jmp	systemReset@PLT
+.LVL433:
+.LBE451:
+.LBE452:
+.LBE453:
+.LBE454:
+	.cfi_endproc
+.LFE20:
+	.size	cliExit, .-cliExit
+	.section	.text.cliSave,"ax",@progbits
+	.p2align 4
+	.type	cliSave, @function
+cliSave:
+.LVL434:
+.LFB28:
+	.loc 1 802 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 803 5 view .LVU1180
+	.loc 1 805 5 view .LVU1181
+.LBB461:
+.LBI461:
+	.loc 1 820 13 view .LVU1182
+.LBB462:
+	.loc 1 822 5 view .LVU1183
+.LBE462:
+.LBE461:
+	.loc 1 802 1 is_stmt 0 view .LVU1184
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB464:
+.LBB463:
+	.loc 1 822 5 view .LVU1185
+	movq	cliPort(%rip), %rdi
+.LVL435:
+	.loc 1 822 5 view .LVU1186
+	leaq	.LC77(%rip), %rsi
+	call	serialPrint@PLT
+.LVL436:
+	.loc 1 822 5 view .LVU1187
+.LBE463:
+.LBE464:
+	.loc 1 807 5 is_stmt 1 view .LVU1188
+	xorl	%eax, %eax
+	call	writeEEPROM@PLT
+.LVL437:
+	.loc 1 808 5 view .LVU1189
+.LBB465:
+.LBI465:
+	.loc 1 795 13 view .LVU1190
+.LBB466:
+	.loc 1 796 5 view .LVU1191
+.LBB467:
+.LBI467:
+	.loc 1 820 13 view .LVU1192
+.LBB468:
+	.loc 1 822 5 view .LVU1193
+	movq	cliPort(%rip), %rdi
+	leaq	.LC78(%rip), %rsi
+	call	serialPrint@PLT
+.LVL438:
+	.loc 1 822 5 is_stmt 0 view .LVU1194
+.LBE468:
+.LBE467:
+	.loc 1 797 5 is_stmt 1 view .LVU1195
+	movq	cliPort(%rip), %rdi
+	call	waitForSerialPortToFinishTransmitting@PLT
+.LVL439:
+	.loc 1 798 5 view .LVU1196
+.LBE466:
+.LBE465:
+	.loc 1 809 1 is_stmt 0 view .LVU1197
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+.LBB470:
+.LBB469:
+	.loc 1 798 5 view .LVU1198
+	jmp	systemReset@PLT
+.LVL440:
+.LBE469:
+.LBE470:
+	.cfi_endproc
+.LFE28:
+	.size	cliSave, .-cliSave
+	.section	.rodata.cliDefaults.str1.1,"aMS",@progbits,1
+.LC79:
+	.string	"Resetting to defaults"
+	.section	.text.cliDefaults,"ax",@progbits
+	.p2align 4
+	.type	cliDefaults, @function
+cliDefaults:
+.LVL441:
+.LFB29:
+	.loc 1 812 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 813 5 view .LVU1200
+	.loc 1 815 5 view .LVU1201
+.LBB477:
+.LBI477:
+	.loc 1 820 13 view .LVU1202
+.LBB478:
+	.loc 1 822 5 view .LVU1203
+.LBE478:
+.LBE477:
+	.loc 1 812 1 is_stmt 0 view .LVU1204
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB480:
+.LBB479:
+	.loc 1 822 5 view .LVU1205
+	movq	cliPort(%rip), %rdi
+.LVL442:
+	.loc 1 822 5 view .LVU1206
+	leaq	.LC79(%rip), %rsi
+	call	serialPrint@PLT
+.LVL443:
+	.loc 1 822 5 view .LVU1207
+.LBE479:
+.LBE480:
+	.loc 1 816 5 is_stmt 1 view .LVU1208
+	call	resetEEPROM@PLT
+.LVL444:
+	.loc 1 817 5 view .LVU1209
+.LBB481:
+.LBI481:
+	.loc 1 795 13 view .LVU1210
+.LBB482:
+	.loc 1 796 5 view .LVU1211
+.LBB483:
+.LBI483:
+	.loc 1 820 13 view .LVU1212
+.LBB484:
+	.loc 1 822 5 view .LVU1213
+	movq	cliPort(%rip), %rdi
+	leaq	.LC78(%rip), %rsi
+	call	serialPrint@PLT
+.LVL445:
+	.loc 1 822 5 is_stmt 0 view .LVU1214
+.LBE484:
+.LBE483:
+	.loc 1 797 5 is_stmt 1 view .LVU1215
+	movq	cliPort(%rip), %rdi
+	call	waitForSerialPortToFinishTransmitting@PLT
+.LVL446:
+	.loc 1 798 5 view .LVU1216
+.LBE482:
+.LBE481:
+	.loc 1 818 1 is_stmt 0 view .LVU1217
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+.LBB486:
+.LBB485:
+	.loc 1 798 5 view .LVU1218
+	jmp	systemReset@PLT
+.LVL447:
+.LBE485:
+.LBE486:
+	.cfi_endproc
+.LFE29:
+	.size	cliDefaults, .-cliDefaults
+	.section	.rodata.cliDump.str1.1,"aMS",@progbits,1
+.LC80:
+	.string	"master"
+.LC81:
+	.string	"profile"
+.LC82:
+	.string	"\r\n# dump profile\r\n"
+.LC83:
+	.string	"\r\n# profile\r\n"
+.LC84:
+	.string	""
+.LC85:
+	.string	"\r\n# aux\r\n"
+.LC86:
+	.string	"\r\n# version\r\n"
+.LC87:
+	.string	"\r\n# dump master\r\n"
+.LC88:
+	.string	"\r\n# mixer\r\n"
+.LC89:
+	.string	"mixer %s\r\n"
+.LC90:
+	.string	"cmix %d"
+.LC91:
+	.string	"cmix %d 0 0 0 0\r\n"
+.LC92:
+	.string	"\r\n\r\n# feature\r\n"
+.LC93:
+	.string	"feature -%s\r\n"
+.LC94:
+	.string	"feature %s\r\n"
+.LC95:
+	.string	"\r\n\r\n# map\r\n"
+.LC96:
+	.string	"map %s\r\n"
+	.section	.text.cliDump,"ax",@progbits
+	.p2align 4
+	.type	cliDump, @function
+cliDump:
+.LVL448:
+.LFB18:
+	.loc 1 441 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 442 5 view .LVU1220
+	.loc 1 443 5 view .LVU1221
+	.loc 1 444 5 view .LVU1222
+	.loc 1 445 5 view .LVU1223
+	.loc 1 447 5 view .LVU1224
+	.loc 1 448 5 view .LVU1225
+	.loc 1 441 1 is_stmt 0 view .LVU1226
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 448 9 view .LVU1227
+	leaq	.LC80(%rip), %rsi
+	.loc 1 441 1 view .LVU1228
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 448 9 view .LVU1229
+	call	strcasecmp@PLT
+.LVL449:
+	.loc 1 451 9 view .LVU1230
+	leaq	.LC81(%rip), %rsi
+	movq	%rbx, %rdi
+	.loc 1 447 13 view .LVU1231
+	cmpl	$1, %eax
+	sbbl	%r12d, %r12d
+	andl	$-2, %r12d
+	addl	$3, %r12d
+.LVL450:
+	.loc 1 451 5 is_stmt 1 view .LVU1232
+	.loc 1 451 9 is_stmt 0 view .LVU1233
+	call	strcasecmp@PLT
+.LVL451:
+	.loc 1 451 8 view .LVU1234
+	testl	%eax, %eax
+	jne	.L305
+	leaq	.LC9(%rip), %rbx
+.LVL452:
+.L324:
+	.loc 1 524 9 is_stmt 1 view .LVU1235
+	leaq	.LC82(%rip), %rdi
+	xorl	%eax, %eax
+	.loc 1 527 9 is_stmt 0 view .LVU1236
+	leaq	.LC84(%rip), %rbp
+	.loc 1 524 9 view .LVU1237
+	call	tfp_printf@PLT
+.LVL453:
+	.loc 1 526 9 is_stmt 1 view .LVU1238
+	xorl	%eax, %eax
+	leaq	.LC83(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL454:
+	.loc 1 527 9 view .LVU1239
+	movq	%rbp, %rdi
+	call	cliProfile
+.LVL455:
+	.loc 1 529 9 view .LVU1240
+	xorl	%eax, %eax
+	leaq	.LC85(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL456:
+	.loc 1 531 9 view .LVU1241
+	movq	%rbp, %rdi
+	call	cliAux
+.LVL457:
+	.loc 1 533 9 view .LVU1242
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL458:
+	.loc 1 535 9 view .LVU1243
+	movl	$128, %edi
+	call	dumpValues
+.LVL459:
+	.loc 1 537 1 is_stmt 0 view .LVU1244
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL460:
+	.p2align 4,,10
+	.p2align 3
+.L305:
+	.cfi_restore_state
+	.loc 1 455 5 is_stmt 1 view .LVU1245
+	.loc 1 457 9 view .LVU1246
+	xorl	%eax, %eax
+	leaq	.LC86(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL461:
+	.loc 1 458 9 view .LVU1247
+.LBB489:
+.LBI489:
+	.loc 1 1082 13 view .LVU1248
+.LBB490:
+	.loc 1 1084 5 view .LVU1249
+	.loc 1 1086 5 view .LVU1250
+	movq	shortGitRevision(%rip), %r8
+	xorl	%eax, %eax
+	movq	buildTime(%rip), %rcx
+	movq	buildDate(%rip), %rdx
+	movq	targetName(%rip), %rsi
+	leaq	.LC0(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL462:
+	.loc 1 1086 5 is_stmt 0 view .LVU1251
+.LBE490:
+.LBE489:
+	.loc 1 460 9 is_stmt 1 view .LVU1252
+	xorl	%eax, %eax
+	leaq	.LC87(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL463:
+	.loc 1 461 9 view .LVU1253
+	xorl	%eax, %eax
+	leaq	.LC88(%rip), %rdi
+	call	tfp_printf@PLT
+.LVL464:
+	.loc 1 463 9 view .LVU1254
+	.loc 1 463 59 is_stmt 0 view .LVU1255
+	movzbl	masterConfig(%rip), %eax
+	.loc 1 463 9 view .LVU1256
+	leaq	mixerNames(%rip), %rdx
+	leaq	.LC89(%rip), %rdi
+	.loc 1 463 79 view .LVU1257
+	subl	$1, %eax
+	.loc 1 463 46 view .LVU1258
+	cltq
+	.loc 1 463 9 view .LVU1259
+	movq	(%rdx,%rax,8), %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL465:
+	.loc 1 465 9 is_stmt 1 view .LVU1260
+	.loc 1 465 12 is_stmt 0 view .LVU1261
+	pxor	%xmm0, %xmm0
+	ucomiss	16+masterConfig(%rip), %xmm0
+	jp	.L326
+	leaq	16(%rsp), %rbp
+	je	.L307
+.L326:
+	.loc 1 465 12 view .LVU1262
+	leaq	16+masterConfig(%rip), %rbx
+.LVL466:
+	.loc 1 466 20 view .LVU1263
+	xorl	%r13d, %r13d
+	leaq	16(%rsp), %rbp
+	.loc 1 475 21 view .LVU1264
+	leaq	.LC66(%rip), %r15
+	.loc 1 476 17 view .LVU1265
+	leaq	.LC21(%rip), %r14
+	jmp	.L319
+.LVL467:
+	.p2align 4,,10
+	.p2align 3
+.L311:
+	.loc 1 476 17 is_stmt 1 view .LVU1266
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL468:
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL469:
+	.loc 1 477 17 view .LVU1267
+	.loc 1 477 20 is_stmt 0 view .LVU1268
+	pxor	%xmm0, %xmm0
+	comiss	(%rsp), %xmm0
+	ja	.L341
+.L313:
+	.loc 1 479 17 is_stmt 1 view .LVU1269
+	movss	(%rsp), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL470:
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL471:
+	.loc 1 480 17 view .LVU1270
+	.loc 1 480 20 is_stmt 0 view .LVU1271
+	pxor	%xmm0, %xmm0
+	comiss	4(%rsp), %xmm0
+	ja	.L342
+.L315:
+	.loc 1 482 17 is_stmt 1 view .LVU1272
+	movss	4(%rsp), %xmm0
+	movq	%rbp, %rdi
+	call	ftoa@PLT
+.LVL472:
+	movq	%r14, %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL473:
+	.loc 1 483 17 view .LVU1273
+	.loc 1 483 20 is_stmt 0 view .LVU1274
+	pxor	%xmm0, %xmm0
+	comiss	8(%rsp), %xmm0
+	ja	.L343
+.L317:
+	.loc 1 485 17 is_stmt 1 discriminator 2 view .LVU1275
+	movss	8(%rsp), %xmm0
+	movq	%rbp, %rdi
+	.loc 1 466 27 is_stmt 0 discriminator 2 view .LVU1276
+	addq	$16, %rbx
+	.loc 1 485 17 discriminator 2 view .LVU1277
+	call	ftoa@PLT
+.LVL474:
+	leaq	.LC28(%rip), %rdi
+	movq	%rax, %rsi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL475:
+	.loc 1 466 34 is_stmt 1 discriminator 2 view .LVU1278
+	.loc 1 466 27 discriminator 2 view .LVU1279
+	cmpl	$12, %r13d
+	je	.L344
+.LVL476:
+.L319:
+	.loc 1 467 17 view .LVU1280
+	.loc 1 467 48 is_stmt 0 view .LVU1281
+	movss	(%rbx), %xmm0
+	.loc 1 467 20 view .LVU1282
+	pxor	%xmm1, %xmm1
+	.loc 1 473 17 view .LVU1283
+	addl	$1, %r13d
+.LVL477:
+	.loc 1 467 20 view .LVU1284
+	ucomiss	%xmm1, %xmm0
+	jp	.L327
+	je	.L309
+.L327:
+	.loc 1 470 22 view .LVU1285
+	movss	4(%rbx), %xmm2
+	.loc 1 471 23 view .LVU1286
+	movss	8(%rbx), %xmm3
+	.loc 1 473 17 view .LVU1287
+	xorl	%eax, %eax
+	movl	%r13d, %esi
+	.loc 1 472 21 view .LVU1288
+	movss	12(%rbx), %xmm4
+	.loc 1 473 17 view .LVU1289
+	leaq	.LC90(%rip), %rdi
+	movss	%xmm0, 12(%rsp)
+.LVL478:
+	.loc 1 469 17 is_stmt 1 view .LVU1290
+	.loc 1 470 17 view .LVU1291
+	.loc 1 470 22 is_stmt 0 view .LVU1292
+	movss	%xmm2, (%rsp)
+.LVL479:
+	.loc 1 471 17 is_stmt 1 view .LVU1293
+	.loc 1 471 23 is_stmt 0 view .LVU1294
+	movss	%xmm3, 4(%rsp)
+.LVL480:
+	.loc 1 472 17 is_stmt 1 view .LVU1295
+	.loc 1 472 21 is_stmt 0 view .LVU1296
+	movss	%xmm4, 8(%rsp)
+.LVL481:
+	.loc 1 473 17 is_stmt 1 view .LVU1297
+	call	tfp_printf@PLT
+.LVL482:
+	.loc 1 474 17 view .LVU1298
+	.loc 1 474 20 is_stmt 0 view .LVU1299
+	movss	12(%rsp), %xmm0
+	pxor	%xmm1, %xmm1
+	comiss	%xmm0, %xmm1
+	jbe	.L311
+	.loc 1 475 21 is_stmt 1 view .LVU1300
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL483:
+	movss	12(%rsp), %xmm0
+	jmp	.L311
+.LVL484:
+	.p2align 4,,10
+	.p2align 3
+.L344:
+	.loc 1 475 21 is_stmt 0 view .LVU1301
+	movl	$13, %r13d
+.LVL485:
+.L309:
+	.loc 1 487 13 is_stmt 1 view .LVU1302
+	movl	%r13d, %esi
+	leaq	.LC91(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL486:
+.L307:
+	.loc 1 490 9 view .LVU1303
+	leaq	.LC92(%rip), %rdi
+	xorl	%eax, %eax
+	leaq	8+featureNames(%rip), %rbx
+	call	tfp_printf@PLT
+.LVL487:
+	.loc 1 492 9 view .LVU1304
+	leaq	.LC93(%rip), %r14
+	.loc 1 492 16 is_stmt 0 view .LVU1305
+	call	featureMask@PLT
+.LVL488:
+	.loc 1 494 29 view .LVU1306
+	leaq	.LC29(%rip), %rsi
+	.loc 1 492 16 view .LVU1307
+	movl	%eax, %r13d
+.LVL489:
+	.loc 1 493 9 is_stmt 1 view .LVU1308
+	.loc 1 494 13 view .LVU1309
+	.p2align 4,,10
+	.p2align 3
+.L320:
+	.loc 1 496 13 view .LVU1310
+	movq	%r14, %rdi
+	xorl	%eax, %eax
+	.loc 1 494 16 is_stmt 0 view .LVU1311
+	addq	$8, %rbx
+.LVL490:
+	.loc 1 496 13 view .LVU1312
+	call	tfp_printf@PLT
+.LVL491:
+	.loc 1 493 24 is_stmt 1 view .LVU1313
+	.loc 1 493 9 view .LVU1314
+	.loc 1 494 13 view .LVU1315
+	.loc 1 494 29 is_stmt 0 view .LVU1316
+	movq	-8(%rbx), %rsi
+	.loc 1 494 16 view .LVU1317
+	testq	%rsi, %rsi
+	jne	.L320
+	xorl	%ebx, %ebx
+	.loc 1 499 29 view .LVU1318
+	leaq	.LC29(%rip), %rsi
+	leaq	featureNames(%rip), %r15
+	.loc 1 502 17 view .LVU1319
+	leaq	.LC94(%rip), %r14
+	jmp	.L322
+.LVL492:
+	.p2align 4,,10
+	.p2align 3
+.L321:
+	.loc 1 498 24 is_stmt 1 view .LVU1320
+	.loc 1 498 9 view .LVU1321
+	.loc 1 499 13 view .LVU1322
+	.loc 1 499 16 is_stmt 0 view .LVU1323
+	addq	$1, %rbx
+.LVL493:
+	.loc 1 499 29 view .LVU1324
+	movq	(%r15,%rbx,8), %rsi
+	.loc 1 499 16 view .LVU1325
+	testq	%rsi, %rsi
+	je	.L345
+.LVL494:
+.L322:
+	.loc 1 501 13 is_stmt 1 view .LVU1326
+	.loc 1 501 16 is_stmt 0 view .LVU1327
+	btl	%ebx, %r13d
+	jnc	.L321
+	.loc 1 502 17 is_stmt 1 view .LVU1328
+	movq	%r14, %rdi
+	xorl	%eax, %eax
+	.loc 1 499 16 is_stmt 0 view .LVU1329
+	addq	$1, %rbx
+.LVL495:
+	.loc 1 502 17 view .LVU1330
+	call	tfp_printf@PLT
+.LVL496:
+	.loc 1 498 24 is_stmt 1 view .LVU1331
+	.loc 1 498 9 view .LVU1332
+	.loc 1 499 13 view .LVU1333
+	.loc 1 499 29 is_stmt 0 view .LVU1334
+	movq	(%r15,%rbx,8), %rsi
+	.loc 1 499 16 view .LVU1335
+	testq	%rsi, %rsi
+	jne	.L322
+.L345:
+	.loc 1 505 9 is_stmt 1 view .LVU1336
+	leaq	.LC95(%rip), %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL497:
+	.loc 1 507 9 view .LVU1337
+	.loc 1 507 23 view .LVU1338
+	.loc 1 505 9 is_stmt 0 view .LVU1339
+	xorl	%eax, %eax
+	leaq	310+masterConfig(%rip), %rdi
+	leaq	rcChannelLetters(%rip), %rsi
+.LVL498:
+	.p2align 4,,10
+	.p2align 3
+.L323:
+	.loc 1 508 13 is_stmt 1 discriminator 3 view .LVU1340
+	.loc 1 508 49 is_stmt 0 discriminator 3 view .LVU1341
+	movzbl	(%rdi,%rax), %edx
+	movzbl	(%rsi,%rax), %ecx
+	.loc 1 507 23 discriminator 3 view .LVU1342
+	addq	$1, %rax
+.LVL499:
+	.loc 1 508 49 discriminator 3 view .LVU1343
+	movb	%cl, 16(%rsp,%rdx)
+	.loc 1 507 29 is_stmt 1 discriminator 3 view .LVU1344
+.LVL500:
+	.loc 1 507 23 discriminator 3 view .LVU1345
+	cmpq	$8, %rax
+	jne	.L323
+	.loc 1 509 9 view .LVU1346
+	.loc 1 510 9 is_stmt 0 view .LVU1347
+	movq	%rbp, %rsi
+	xorl	%eax, %eax
+	leaq	.LC96(%rip), %rdi
+	.loc 1 509 16 view .LVU1348
+	movb	$0, 24(%rsp)
+	.loc 1 510 9 is_stmt 1 view .LVU1349
+	call	tfp_printf@PLT
+.LVL501:
+	.loc 1 519 9 view .LVU1350
+	leaq	.LC9(%rip), %rbx
+	xorl	%eax, %eax
+	movq	%rbx, %rdi
+	call	tfp_printf@PLT
+.LVL502:
+	.loc 1 520 9 view .LVU1351
+	movl	$64, %edi
+	call	dumpValues
+.LVL503:
+	.loc 1 523 5 view .LVU1352
+	.loc 1 523 8 is_stmt 0 view .LVU1353
+	andl	$2, %r12d
+.LVL504:
+	.loc 1 523 8 view .LVU1354
+	jne	.L324
+	.loc 1 537 1 view .LVU1355
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL505:
+	.loc 1 537 1 view .LVU1356
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL506:
+	.p2align 4,,10
+	.p2align 3
+.L343:
+	.cfi_restore_state
+	.loc 1 484 21 is_stmt 1 view .LVU1357
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL507:
+	jmp	.L317
+	.p2align 4,,10
+	.p2align 3
+.L342:
+	.loc 1 481 21 view .LVU1358
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL508:
+	jmp	.L315
+	.p2align 4,,10
+	.p2align 3
+.L341:
+	.loc 1 478 21 view .LVU1359
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	tfp_printf@PLT
+.LVL509:
+	jmp	.L313
+	.cfi_endproc
+.LFE18:
+	.size	cliDump, .-cliDump
+	.section	.rodata.cliProcess.str1.8,"aMS",@progbits,1
+	.align 8
+.LC97:
+	.string	"\r\nEntering CLI Mode, type 'exit' to return, or 'help'\r\n"
+	.section	.rodata.cliProcess.str1.1,"aMS",@progbits,1
+.LC98:
+	.string	"\r\n# "
+.LC99:
+	.string	"\r\033[K"
+.LC100:
+	.string	"\033[2J\033[1;1H"
+.LC101:
+	.string	"\b \b"
+.LC102:
+	.string	"Unknown command, try 'help'"
+	.section	.text.cliProcess,"ax",@progbits
+	.p2align 4
+	.globl	cliProcess
+	.type	cliProcess, @function
+cliProcess:
+.LFB39:
+	.loc 1 1090 1 view -0
+	.cfi_startproc
+	.loc 1 1091 5 view .LVU1361
+	.loc 1 1090 1 is_stmt 0 view .LVU1362
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 1091 8 view .LVU1363
+	cmpb	$0, cliMode(%rip)
+	je	.L412
+.L347:
+	movq	cliPort(%rip), %rdi
+	leaq	408+cmdTable(%rip), %r13
+.LBB536:
+.LBB537:
+	.loc 1 1102 37 view .LVU1364
+	leaq	cliBuffer(%rip), %rbp
+	.p2align 4,,10
+	.p2align 3
+.L348:
+.LBE537:
+.LBE536:
+	.loc 1 1095 12 is_stmt 1 view .LVU1365
+	call	serialTotalBytesWaiting@PLT
+.LVL510:
+	testl	%eax, %eax
+	je	.L346
+.L384:
+.LBB599:
+	.loc 1 1096 9 view .LVU1366
+	.loc 1 1096 21 is_stmt 0 view .LVU1367
+	movq	cliPort(%rip), %rdi
+	call	serialRead@PLT
+.LVL511:
+	.loc 1 1097 9 is_stmt 1 view .LVU1368
+	.loc 1 1097 12 is_stmt 0 view .LVU1369
+	cmpb	$9, %al
+	je	.L391
+	cmpb	$63, %al
+	je	.L391
+	.loc 1 1133 16 is_stmt 1 view .LVU1370
+	.loc 1 1133 20 is_stmt 0 view .LVU1371
+	movl	bufferIndex(%rip), %edx
+	.loc 1 1133 19 view .LVU1372
+	testl	%edx, %edx
+	jne	.L367
+	.loc 1 1133 33 discriminator 1 view .LVU1373
+	cmpb	$4, %al
+	je	.L413
+	.loc 1 1136 16 is_stmt 1 view .LVU1374
+	.loc 1 1136 19 is_stmt 0 view .LVU1375
+	cmpb	$12, %al
+	je	.L369
+	.loc 1 1140 16 is_stmt 1 view .LVU1376
+	.loc 1 1166 16 view .LVU1377
+	.loc 1 1166 19 is_stmt 0 view .LVU1378
+	leal	-33(%rax), %ecx
+	movq	cliPort(%rip), %rdi
+	cmpb	$93, %cl
+	ja	.L348
+.L383:
+	.loc 1 1175 13 is_stmt 1 view .LVU1379
+	.loc 1 1175 34 is_stmt 0 view .LVU1380
+	leal	1(%rdx), %ecx
+	.loc 1 1176 13 view .LVU1381
+	movzbl	%al, %esi
+	.loc 1 1175 38 view .LVU1382
+	movb	%al, 0(%rbp,%rdx)
+	.loc 1 1176 13 is_stmt 1 view .LVU1383
+.LVL512:
+.LBB564:
+.LBI564:
+	.loc 1 825 13 view .LVU1384
+.LBB565:
+	.loc 1 827 5 view .LVU1385
+.LBE565:
+.LBE564:
+	.loc 1 1175 34 is_stmt 0 view .LVU1386
+	movl	%ecx, bufferIndex(%rip)
+.LBB567:
+.LBB566:
+	.loc 1 827 5 view .LVU1387
+	call	serialWrite@PLT
+.LVL513:
+.L411:
+	.loc 1 827 5 view .LVU1388
+	movq	cliPort(%rip), %rdi
+.LBE566:
+.LBE567:
+.LBE599:
+	.loc 1 1095 12 is_stmt 1 view .LVU1389
+	call	serialTotalBytesWaiting@PLT
+.LVL514:
+	testl	%eax, %eax
+	jne	.L384
+.LVL515:
+.L346:
+	.loc 1 1179 1 is_stmt 0 view .LVU1390
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL516:
+	.p2align 4,,10
+	.p2align 3
+.L367:
+	.cfi_restore_state
+.LBB600:
+	.loc 1 1136 16 is_stmt 1 view .LVU1391
+	.loc 1 1136 19 is_stmt 0 view .LVU1392
+	cmpb	$12, %al
+	je	.L369
+.LBB568:
+.LBB538:
+.LBB539:
+	.loc 1 822 5 discriminator 1 view .LVU1393
+	movq	cliPort(%rip), %rdi
+.LBE539:
+.LBE538:
+.LBE568:
+	.loc 1 1140 16 is_stmt 1 discriminator 1 view .LVU1394
+	.loc 1 1140 32 is_stmt 0 discriminator 1 view .LVU1395
+	cmpb	$10, %al
+	je	.L392
+	cmpb	$13, %al
+	je	.L392
+	.loc 1 1166 16 is_stmt 1 view .LVU1396
+	.loc 1 1166 19 is_stmt 0 view .LVU1397
+	cmpb	$127, %al
+	je	.L382
+	.loc 1 1172 16 is_stmt 1 view .LVU1398
+	.loc 1 1172 19 is_stmt 0 view .LVU1399
+	cmpl	$47, %edx
+	ja	.L348
+	.loc 1 1172 63 view .LVU1400
+	leal	-32(%rax), %ecx
+	cmpb	$94, %cl
+	jbe	.L383
+	jmp	.L348
+	.p2align 4,,10
+	.p2align 3
+.L391:
+.LBB569:
+	.loc 1 1099 13 is_stmt 1 view .LVU1401
+.LVL517:
+	.loc 1 1100 13 view .LVU1402
+	.loc 1 1100 22 is_stmt 0 view .LVU1403
+	movl	bufferIndex(%rip), %eax
+.LVL518:
+	.loc 1 1099 50 view .LVU1404
+	xorl	%r12d, %r12d
+	.loc 1 1099 35 view .LVU1405
+	xorl	%r14d, %r14d
+	.loc 1 1101 22 view .LVU1406
+	leaq	cmdTable(%rip), %rbx
+	.loc 1 1102 37 view .LVU1407
+	movq	%rax, 8(%rsp)
+	.loc 1 1100 22 view .LVU1408
+	movq	%rax, %r15
+.LVL519:
+	.loc 1 1101 13 is_stmt 1 view .LVU1409
+	.loc 1 1101 38 view .LVU1410
+	jmp	.L353
+.LVL520:
+	.p2align 4,,10
+	.p2align 3
+.L352:
+	.loc 1 1101 93 discriminator 2 view .LVU1411
+	addq	$24, %rbx
+.LVL521:
+	.loc 1 1101 38 discriminator 2 view .LVU1412
+	cmpq	%r13, %rbx
+	je	.L414
+.LVL522:
+.L353:
+	.loc 1 1102 17 view .LVU1413
+	.loc 1 1102 20 is_stmt 0 view .LVU1414
+	testl	%r15d, %r15d
+	je	.L351
+	.loc 1 1102 37 discriminator 1 view .LVU1415
+	movq	(%rbx), %rsi
+	movq	8(%rsp), %rdx
+	movq	%rbp, %rdi
+	call	strncasecmp@PLT
+.LVL523:
+	.loc 1 1102 33 discriminator 1 view .LVU1416
+	testl	%eax, %eax
+	jne	.L352
+.L351:
+	.loc 1 1104 17 is_stmt 1 view .LVU1417
+	movq	%rbx, %r12
+.LVL524:
+	.loc 1 1104 20 is_stmt 0 view .LVU1418
+	testq	%r14, %r14
+	jne	.L352
+	.loc 1 1104 20 view .LVU1419
+	movq	%rbx, %r14
+.LVL525:
+	.loc 1 1101 93 is_stmt 1 view .LVU1420
+	addq	$24, %rbx
+.LVL526:
+	.loc 1 1101 38 view .LVU1421
+	cmpq	%r13, %rbx
+	jne	.L353
+.LVL527:
+.L414:
+	.loc 1 1108 13 view .LVU1422
+	.loc 1 1108 16 is_stmt 0 view .LVU1423
+	testq	%r14, %r14
+	jne	.L415
+	.loc 1 1121 13 is_stmt 1 view .LVU1424
+	.loc 1 1121 30 is_stmt 0 view .LVU1425
+	testq	%r12, %r12
+	jne	.L387
+	.loc 1 1121 30 view .LVU1426
+	testl	%r15d, %r15d
+	jne	.L411
+.L387:
+	.loc 1 1123 17 is_stmt 1 view .LVU1427
+.LVL528:
+.LBB542:
+.LBI538:
+	.loc 1 820 13 view .LVU1428
+.LBB540:
+	.loc 1 822 5 view .LVU1429
+	movq	cliPort(%rip), %rdi
+	leaq	.LC99(%rip), %rsi
+	call	serialPrint@PLT
+.LVL529:
+	.loc 1 822 5 is_stmt 0 view .LVU1430
+.LBE540:
+.LBE542:
+	.loc 1 1124 17 is_stmt 1 view .LVU1431
+	.loc 1 1124 40 view .LVU1432
+	.p2align 4,,10
+	.p2align 3
+.L362:
+	.loc 1 1125 21 discriminator 3 view .LVU1433
+.LBB543:
+.LBI543:
+	.loc 1 820 13 discriminator 3 view .LVU1434
+.LBB544:
+	.loc 1 822 5 discriminator 3 view .LVU1435
+	movq	(%r14), %rsi
+	movq	cliPort(%rip), %rdi
+.LBE544:
+.LBE543:
+	.loc 1 1124 52 is_stmt 0 discriminator 3 view .LVU1436
+	addq	$24, %r14
+.LVL530:
+.LBB546:
+.LBB545:
+	.loc 1 822 5 discriminator 3 view .LVU1437
+	call	serialPrint@PLT
+.LVL531:
+	.loc 1 822 5 discriminator 3 view .LVU1438
+.LBE545:
+.LBE546:
+	.loc 1 1126 21 is_stmt 1 discriminator 3 view .LVU1439
+.LBB547:
+.LBI547:
+	.loc 1 825 13 discriminator 3 view .LVU1440
+.LBB548:
+	.loc 1 827 5 discriminator 3 view .LVU1441
+	movq	cliPort(%rip), %rdi
+	movl	$9, %esi
+	call	serialWrite@PLT
+.LVL532:
+	.loc 1 827 5 is_stmt 0 discriminator 3 view .LVU1442
+.LBE548:
+.LBE547:
+	.loc 1 1124 52 is_stmt 1 discriminator 3 view .LVU1443
+	.loc 1 1124 40 discriminator 3 view .LVU1444
+	cmpq	%r14, %r12
+	jnb	.L362
+.L363:
+	.loc 1 1128 17 view .LVU1445
+.LBB549:
+.LBI549:
+	.loc 1 188 13 view .LVU1446
+.LBB550:
+	.loc 1 190 5 view .LVU1447
+.LVL533:
+.LBB551:
+.LBI551:
+	.loc 1 820 13 view .LVU1448
+.LBB552:
+	.loc 1 822 5 view .LVU1449
+	movq	cliPort(%rip), %rdi
+	leaq	.LC98(%rip), %rsi
+.LBE552:
+.LBE551:
+.LBE550:
+.LBE549:
+	.loc 1 1129 19 is_stmt 0 view .LVU1450
+	xorl	%r15d, %r15d
+.LVL534:
+.LBB556:
+.LBB555:
+.LBB554:
+.LBB553:
+	.loc 1 822 5 view .LVU1451
+	call	serialPrint@PLT
+.LVL535:
+	.loc 1 822 5 view .LVU1452
+.LBE553:
+.LBE554:
+.LBE555:
+.LBE556:
+	.loc 1 1129 17 is_stmt 1 view .LVU1453
+	.loc 1 1131 22 is_stmt 0 view .LVU1454
+	movl	bufferIndex(%rip), %eax
+.LVL536:
+.L359:
+	.loc 1 1131 22 is_stmt 1 discriminator 1 view .LVU1455
+	cmpl	%eax, %r15d
+	jnb	.L411
+	.p2align 4,,10
+	.p2align 3
+.L364:
+	.loc 1 1132 17 discriminator 2 view .LVU1456
+.LVL537:
+.LBB557:
+.LBI557:
+	.loc 1 825 13 discriminator 2 view .LVU1457
+.LBB558:
+	.loc 1 827 5 discriminator 2 view .LVU1458
+.LBE558:
+.LBE557:
+	.loc 1 1132 35 is_stmt 0 discriminator 2 view .LVU1459
+	movl	%r15d, %eax
+.LBB561:
+.LBB559:
+	.loc 1 827 5 discriminator 2 view .LVU1460
+	movq	cliPort(%rip), %rdi
+.LBE559:
+.LBE561:
+	.loc 1 1131 38 discriminator 2 view .LVU1461
+	addl	$1, %r15d
+.LVL538:
+	.loc 1 1132 17 discriminator 2 view .LVU1462
+	movzbl	0(%rbp,%rax), %esi
+.LBB562:
+.LBB560:
+	.loc 1 827 5 discriminator 2 view .LVU1463
+	call	serialWrite@PLT
+.LVL539:
+	.loc 1 827 5 discriminator 2 view .LVU1464
+.LBE560:
+.LBE562:
+	.loc 1 1131 38 is_stmt 1 discriminator 2 view .LVU1465
+	.loc 1 1131 22 discriminator 2 view .LVU1466
+	cmpl	bufferIndex(%rip), %r15d
+	jb	.L364
+	jmp	.L411
+.LVL540:
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	.loc 1 1131 22 is_stmt 0 discriminator 2 view .LVU1467
+.LBE569:
+	.loc 1 1138 13 is_stmt 1 view .LVU1468
+.LBB570:
+.LBI570:
+	.loc 1 820 13 view .LVU1469
+.LBB571:
+	.loc 1 822 5 view .LVU1470
+	movq	cliPort(%rip), %rdi
+	leaq	.LC100(%rip), %rsi
+	call	serialPrint@PLT
+.LVL541:
+	.loc 1 822 5 is_stmt 0 view .LVU1471
+.LBE571:
+.LBE570:
+	.loc 1 1139 13 is_stmt 1 view .LVU1472
+.LBB572:
+.LBI572:
+	.loc 1 188 13 view .LVU1473
+.LBB573:
+	.loc 1 190 5 view .LVU1474
+.LBB574:
+.LBI574:
+	.loc 1 820 13 view .LVU1475
+.LBB575:
+	.loc 1 822 5 view .LVU1476
+	movq	cliPort(%rip), %rdi
+	leaq	.LC98(%rip), %rsi
+	call	serialPrint@PLT
+.LVL542:
+	.loc 1 822 5 is_stmt 0 view .LVU1477
+	movq	cliPort(%rip), %rdi
+.LBE575:
+.LBE574:
+	.loc 1 191 1 view .LVU1478
+	jmp	.L348
+.LVL543:
+	.p2align 4,,10
+	.p2align 3
+.L415:
+	.loc 1 191 1 view .LVU1479
+.LBE573:
+.LBE572:
+.LBB576:
+	.loc 1 1109 17 is_stmt 1 view .LVU1480
+	.loc 1 1110 21 view .LVU1481
+	.loc 1 1110 31 is_stmt 0 view .LVU1482
+	movq	(%r14), %r11
+	.loc 1 1110 58 view .LVU1483
+	movq	(%r12), %r10
+	.loc 1 1110 37 view .LVU1484
+	movl	%r15d, %eax
+	movzbl	(%r11,%rax), %edx
+	.loc 1 1110 24 view .LVU1485
+	cmpb	(%r10,%rax), %dl
+	jne	.L355
+	.loc 1 1110 37 view .LVU1486
+	movl	%r15d, %eax
+	.p2align 4,,10
+	.p2align 3
+.L358:
+	.loc 1 1112 21 is_stmt 1 discriminator 1 view .LVU1487
+	.loc 1 1112 24 is_stmt 0 discriminator 1 view .LVU1488
+	testb	%dl, %dl
+	movl	%eax, %esi
+	sete	%r9b
+	.loc 1 1112 52 discriminator 1 view .LVU1489
+	cmpl	$45, %eax
+	setbe	%dil
+	.loc 1 1109 37 discriminator 1 view .LVU1490
+	addl	$1, %eax
+	.loc 1 1112 52 discriminator 1 view .LVU1491
+	testb	%dil, %r9b
+	jne	.L416
+	.loc 1 1118 21 is_stmt 1 view .LVU1492
+	.loc 1 1118 44 is_stmt 0 view .LVU1493
+	movb	%dl, 0(%rbp,%rsi)
+	.loc 1 1109 37 is_stmt 1 view .LVU1494
+	.loc 1 1109 17 view .LVU1495
+	.loc 1 1109 17 view .LVU1496
+	.loc 1 1110 21 view .LVU1497
+	.loc 1 1110 37 is_stmt 0 view .LVU1498
+	movl	%eax, %esi
+	movzbl	(%r11,%rsi), %edx
+	.loc 1 1110 24 view .LVU1499
+	cmpb	(%r10,%rsi), %dl
+	je	.L358
+	movl	%eax, bufferIndex(%rip)
+.L357:
+	.loc 1 1121 13 is_stmt 1 view .LVU1500
+	.loc 1 1121 30 is_stmt 0 view .LVU1501
+	testl	%eax, %eax
+	je	.L386
+	cmpq	%r12, %r14
+	je	.L359
+.L386:
+	.loc 1 1123 17 is_stmt 1 view .LVU1502
+.LVL544:
+.LBB563:
+	.loc 1 820 13 view .LVU1503
+.LBB541:
+	.loc 1 822 5 view .LVU1504
+	movq	cliPort(%rip), %rdi
+	leaq	.LC99(%rip), %rsi
+	call	serialPrint@PLT
+.LVL545:
+	.loc 1 822 5 is_stmt 0 view .LVU1505
+.LBE541:
+.LBE563:
+	.loc 1 1124 17 is_stmt 1 view .LVU1506
+	.loc 1 1124 40 view .LVU1507
+	cmpq	%r14, %r12
+	jb	.L363
+	jmp	.L362
+.LVL546:
+	.p2align 4,,10
+	.p2align 3
+.L392:
+	.loc 1 1124 40 is_stmt 0 view .LVU1508
+.LBE576:
+.LBB577:
+	.loc 1 1142 13 is_stmt 1 view .LVU1509
+	.loc 1 1143 13 view .LVU1510
+	.loc 1 1144 13 view .LVU1511
+.LBB578:
+.LBI578:
+	.loc 1 820 13 view .LVU1512
+.LBB579:
+	.loc 1 822 5 view .LVU1513
+	leaq	.LC9(%rip), %rsi
+	call	serialPrint@PLT
+.LVL547:
+	.loc 1 822 5 is_stmt 0 view .LVU1514
+.LBE579:
+.LBE578:
+	.loc 1 1145 13 is_stmt 1 view .LVU1515
+	.loc 1 1145 36 is_stmt 0 view .LVU1516
+	movl	bufferIndex(%rip), %eax
+	movb	$0, 0(%rbp,%rax)
+	.loc 1 1147 13 is_stmt 1 view .LVU1517
+	.loc 1 1147 16 is_stmt 0 view .LVU1518
+	cmpb	$35, 0(%rbp)
+	jne	.L417
+.LVL548:
+.L375:
+	.loc 1 1158 13 is_stmt 1 view .LVU1519
+	pxor	%xmm0, %xmm0
+	.loc 1 1162 16 is_stmt 0 view .LVU1520
+	cmpb	$0, cliMode(%rip)
+	.loc 1 1159 25 view .LVU1521
+	movl	$0, bufferIndex(%rip)
+	.loc 1 1158 13 view .LVU1522
+	movaps	%xmm0, 0(%rbp)
+	movaps	%xmm0, 16+cliBuffer(%rip)
+	movaps	%xmm0, 32+cliBuffer(%rip)
+	.loc 1 1159 13 is_stmt 1 view .LVU1523
+	.loc 1 1162 13 view .LVU1524
+	.loc 1 1162 16 is_stmt 0 view .LVU1525
+	je	.L346
+	.loc 1 1165 13 is_stmt 1 view .LVU1526
+.LBB580:
+.LBI580:
+	.loc 1 188 13 view .LVU1527
+.LBB581:
+	.loc 1 190 5 view .LVU1528
+.LVL549:
+.LBB582:
+.LBI582:
+	.loc 1 820 13 view .LVU1529
+.LBB583:
+	.loc 1 822 5 view .LVU1530
+	movq	cliPort(%rip), %rdi
+	leaq	.LC98(%rip), %rsi
+	call	serialPrint@PLT
+.LVL550:
+	.loc 1 822 5 is_stmt 0 view .LVU1531
+	movq	cliPort(%rip), %rdi
+.LBE583:
+.LBE582:
+.LBE581:
+.LBE580:
+.LBE577:
+	.loc 1 1140 61 view .LVU1532
+	jmp	.L348
+.LVL551:
+	.p2align 4,,10
+	.p2align 3
+.L382:
+	.loc 1 1168 13 is_stmt 1 view .LVU1533
+	.loc 1 1169 17 view .LVU1534
+	.loc 1 1169 27 is_stmt 0 view .LVU1535
+	subl	$1, %edx
+	.loc 1 1169 42 view .LVU1536
+	leaq	cliBuffer(%rip), %rax
+.LVL552:
+.LBB592:
+.LBB593:
+	.loc 1 822 5 view .LVU1537
+	leaq	.LC101(%rip), %rsi
+.LBE593:
+.LBE592:
+	.loc 1 1169 42 view .LVU1538
+	movl	%edx, bufferIndex(%rip)
+	movb	$0, (%rax,%rdx)
+	.loc 1 1170 17 is_stmt 1 view .LVU1539
+.LVL553:
+.LBB595:
+.LBI592:
+	.loc 1 820 13 view .LVU1540
+.LBB594:
+	.loc 1 822 5 view .LVU1541
+	call	serialPrint@PLT
+.LVL554:
+	movq	cliPort(%rip), %rdi
+	.loc 1 823 1 is_stmt 0 view .LVU1542
+	jmp	.L348
+.LVL555:
+.L416:
+	.loc 1 823 1 view .LVU1543
+.LBE594:
+.LBE595:
+.LBB596:
+	.loc 1 1114 25 is_stmt 1 view .LVU1544
+	.loc 1 1115 48 is_stmt 0 view .LVU1545
+	movl	%eax, %edx
+	.loc 1 1114 50 view .LVU1546
+	movb	$32, 0(%rbp,%rsi)
+	.loc 1 1115 25 is_stmt 1 view .LVU1547
+	.loc 1 1114 46 is_stmt 0 view .LVU1548
+	movl	%eax, bufferIndex(%rip)
+	.loc 1 1115 48 view .LVU1549
+	movb	$0, 0(%rbp,%rdx)
+	.loc 1 1116 25 is_stmt 1 view .LVU1550
+	jmp	.L357
+.LVL556:
+.L417:
+	.loc 1 1116 25 is_stmt 0 view .LVU1551
+.LBE596:
+.LBB597:
+.LBB584:
+.LBB585:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.loc 3 28 7 view .LVU1552
+	movl	$17, %ebx
+	.loc 3 27 7 view .LVU1553
+	xorl	%r15d, %r15d
+	.p2align 4,,10
+	.p2align 3
+.L376:
+.LVL557:
+	.loc 3 29 14 is_stmt 1 view .LVU1554
+	cmpq	%rbx, %r15
+	jnb	.L418
+.L378:
+	.loc 3 31 7 view .LVU1555
+	.loc 3 31 20 is_stmt 0 view .LVU1556
+	leaq	(%r15,%rbx), %rax
+	.loc 3 31 13 view .LVU1557
+	movq	%rax, %rcx
+	.loc 3 32 62 view .LVU1558
+	andq	$-2, %rax
+	.loc 3 31 13 view .LVU1559
+	shrq	%rcx
+.LVL558:
+	.loc 3 32 7 is_stmt 1 view .LVU1560
+	.loc 3 32 62 is_stmt 0 view .LVU1561
+	addq	%rcx, %rax
+	movq	%rcx, 8(%rsp)
+	.loc 3 32 11 view .LVU1562
+	leaq	cmdTable(%rip), %rcx
+.LVL559:
+	.loc 3 32 11 view .LVU1563
+	leaq	(%rcx,%rax,8), %r14
+.LVL560:
+	.loc 3 33 7 is_stmt 1 view .LVU1564
+.LBB586:
+.LBI586:
+	.loc 1 193 12 view .LVU1565
+.LBB587:
+	.loc 1 195 5 view .LVU1566
+	.loc 1 196 5 view .LVU1567
+	.loc 1 196 53 is_stmt 0 view .LVU1568
+	movq	(%r14), %r12
+	.loc 1 196 12 view .LVU1569
+	movq	%r12, %rdi
+	call	strlen@PLT
+.LVL561:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	movq	%rax, %rdx
+	call	strncasecmp@PLT
+.LVL562:
+	.loc 1 196 12 view .LVU1570
+.LBE587:
+.LBE586:
+	.loc 3 34 7 is_stmt 1 view .LVU1571
+	.loc 3 34 10 is_stmt 0 view .LVU1572
+	movq	8(%rsp), %rcx
+	testl	%eax, %eax
+	js	.L390
+	.loc 3 36 12 is_stmt 1 view .LVU1573
+	.loc 3 36 15 is_stmt 0 view .LVU1574
+	je	.L377
+	.loc 3 37 2 is_stmt 1 view .LVU1575
+	.loc 3 37 6 is_stmt 0 view .LVU1576
+	leaq	1(%rcx), %r15
+.LVL563:
+	.loc 3 29 14 is_stmt 1 view .LVU1577
+	cmpq	%rbx, %r15
+	jb	.L378
+.LVL564:
+.L418:
+	.loc 3 29 14 is_stmt 0 view .LVU1578
+.LBE585:
+.LBE584:
+	.loc 1 1152 17 is_stmt 1 view .LVU1579
+	.loc 1 1155 21 view .LVU1580
+.LBB589:
+.LBI589:
+	.loc 1 820 13 view .LVU1581
+.LBB590:
+	.loc 1 822 5 view .LVU1582
+	movq	cliPort(%rip), %rdi
+	leaq	.LC102(%rip), %rsi
+	call	serialPrint@PLT
+.LVL565:
+	.loc 1 823 1 is_stmt 0 view .LVU1583
+	jmp	.L375
+.LVL566:
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	.loc 1 823 1 view .LVU1584
+.LBE590:
+.LBE589:
+.LBB591:
+.LBB588:
+	.loc 3 31 13 view .LVU1585
+	movq	%rcx, %rbx
+.LVL567:
+	.loc 3 31 13 view .LVU1586
+	jmp	.L376
+.LVL568:
+.L377:
+	.loc 3 31 13 view .LVU1587
+.LBE588:
+.LBE591:
+	.loc 1 1152 17 is_stmt 1 view .LVU1588
+	.loc 1 1153 21 view .LVU1589
+	.loc 1 1153 43 is_stmt 0 view .LVU1590
+	movq	%r12, %rdi
+	call	strlen@PLT
+.LVL569:
+	.loc 1 1153 21 view .LVU1591
+	leaq	1(%rbp,%rax), %rdi
+	call	*16(%r14)
+.LVL570:
+	jmp	.L375
+.LVL571:
+.L412:
+	.loc 1 1153 21 view .LVU1592
+.LBE597:
+.LBE600:
+	.loc 1 1092 9 is_stmt 1 view .LVU1593
+.LBB601:
+.LBI601:
+	.loc 1 539 13 view .LVU1594
+.LBB602:
+	.loc 1 541 5 view .LVU1595
+	.loc 1 542 5 is_stmt 0 view .LVU1596
+	movq	cliPort(%rip), %rdi
+	movl	$2, %esi
+	.loc 1 541 13 view .LVU1597
+	movb	$1, cliMode(%rip)
+	.loc 1 542 5 is_stmt 1 view .LVU1598
+	call	beginSerialPortFunction@PLT
+.LVL572:
+	.loc 1 543 5 view .LVU1599
+	movq	cliPort(%rip), %rdi
+	call	setPrintfSerialPort@PLT
+.LVL573:
+	.loc 1 544 5 view .LVU1600
+.LBB603:
+.LBI603:
+	.loc 1 820 13 view .LVU1601
+.LBB604:
+	.loc 1 822 5 view .LVU1602
+	movq	cliPort(%rip), %rdi
+	leaq	.LC97(%rip), %rsi
+	call	serialPrint@PLT
+.LVL574:
+	.loc 1 822 5 is_stmt 0 view .LVU1603
+.LBE604:
+.LBE603:
+	.loc 1 545 5 is_stmt 1 view .LVU1604
+.LBB605:
+.LBI605:
+	.loc 1 188 13 view .LVU1605
+.LBB606:
+	.loc 1 190 5 view .LVU1606
+.LBB607:
+.LBI607:
+	.loc 1 820 13 view .LVU1607
+.LBB608:
+	.loc 1 822 5 view .LVU1608
+	movq	cliPort(%rip), %rdi
+	leaq	.LC98(%rip), %rsi
+	call	serialPrint@PLT
+.LVL575:
+	.loc 1 822 5 is_stmt 0 view .LVU1609
+.LBE608:
+.LBE607:
+.LBE606:
+.LBE605:
+	.loc 1 546 1 view .LVU1610
+	jmp	.L347
+.LVL576:
+.L413:
+	.loc 1 546 1 view .LVU1611
+.LBE602:
+.LBE601:
+.LBB609:
+	.loc 1 1134 13 is_stmt 1 view .LVU1612
+.LBE609:
+	.loc 1 1179 1 is_stmt 0 view .LVU1613
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+.LBB610:
+	.loc 1 1134 13 view .LVU1614
+	leaq	cliBuffer(%rip), %rdi
+.LBE610:
+	.loc 1 1179 1 view .LVU1615
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LBB611:
+	.loc 1 1134 13 view .LVU1616
+	jmp	cliExit
+.LVL577:
+.L355:
+	.cfi_restore_state
+.LBB598:
+	.loc 1 1121 13 is_stmt 1 view .LVU1617
+	.loc 1 1121 30 is_stmt 0 view .LVU1618
+	cmpq	%r12, %r14
+	jne	.L386
+	testl	%r15d, %r15d
+	je	.L386
+	jmp	.L411
+.LBE598:
+.LBE611:
+	.cfi_endproc
+.LFE39:
+	.size	cliProcess, .-cliProcess
+	.section	.text.cliInit,"ax",@progbits
+	.p2align 4
+	.globl	cliInit
+	.type	cliInit, @function
+cliInit:
+.LVL578:
+.LFB40:
+	.loc 1 1182 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1183 5 view .LVU1620
+	.loc 1 1182 1 is_stmt 0 view .LVU1621
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 1182 1 view .LVU1622
+	movq	%rdi, %rbx
+	.loc 1 1183 15 view .LVU1623
+	movl	$2, %edi
+.LVL579:
+	.loc 1 1183 15 view .LVU1624
+	call	findOpenSerialPort@PLT
+.LVL580:
+	.loc 1 1183 13 view .LVU1625
+	movq	%rax, cliPort(%rip)
+	.loc 1 1184 5 is_stmt 1 view .LVU1626
+	.loc 1 1184 8 is_stmt 0 view .LVU1627
+	testq	%rax, %rax
+	je	.L422
+	.loc 1 1188 1 view .LVU1628
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL581:
+	.loc 1 1188 1 view .LVU1629
+	ret
+.LVL582:
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	.cfi_restore_state
+	.loc 1 1185 9 is_stmt 1 view .LVU1630
+	.loc 1 1185 19 is_stmt 0 view .LVU1631
+	movl	8(%rbx), %edx
+	xorl	%r8d, %r8d
+	movl	$3, %ecx
+	xorl	%esi, %esi
+	movl	$2, %edi
+	call	openSerialPort@PLT
+.LVL583:
+	.loc 1 1188 1 view .LVU1632
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL584:
+	.loc 1 1185 17 view .LVU1633
+	movq	%rax, cliPort(%rip)
+	.loc 1 1188 1 view .LVU1634
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	cliInit, .-cliInit
+	.globl	cmdTable
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC103:
+	.string	"aux"
+.LC104:
+	.string	"show/set aux settings"
+.LC105:
+	.string	"cmix"
+.LC106:
+	.string	"design custom mixer"
+.LC107:
+	.string	"defaults"
+.LC108:
+	.string	"reset to defaults and reboot"
+.LC109:
+	.string	"dump"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC110:
+	.string	"print configurable settings in a pastable form"
+	.section	.rodata.str1.1
+.LC111:
+	.string	"exit"
+.LC112:
+	.string	"feature"
+.LC113:
+	.string	"list or -val or val"
+.LC114:
+	.string	"get"
+.LC115:
+	.string	"get variable value"
+.LC116:
+	.string	"help"
+.LC117:
+	.string	"map"
+.LC118:
+	.string	"mapping of rc channel order"
+.LC119:
+	.string	"mixer"
+.LC120:
+	.string	"mixer name or list"
+.LC121:
+	.string	"motor"
+.LC122:
+	.string	"get/set motor output value"
+.LC123:
+	.string	"index (0 to 2)"
+.LC124:
+	.string	"save"
+.LC125:
+	.string	"save and reboot"
+.LC126:
+	.string	"set"
+	.section	.rodata.str1.8
+	.align 8
+.LC127:
+	.string	"name=value or blank or * for list"
+	.section	.rodata.str1.1
+.LC128:
+	.string	"status"
+.LC129:
+	.string	"show system status"
+.LC130:
+	.string	"tasks"
+	.section	.rodata.str1.8
+	.align 8
+.LC131:
+	.string	"show task execution times, 'reset' to clear"
+	.section	.rodata.str1.1
+.LC132:
+	.string	"version"
+	.section	.data.rel.ro.local.cmdTable,"aw"
+	.align 32
+	.type	cmdTable, @object
+	.size	cmdTable, 408
+cmdTable:
+	.quad	.LC103
+	.quad	.LC104
+	.quad	cliAux
+	.quad	.LC105
+	.quad	.LC106
+	.quad	cliCMix
+	.quad	.LC107
+	.quad	.LC108
+	.quad	cliDefaults
+	.quad	.LC109
+	.quad	.LC110
+	.quad	cliDump
+	.quad	.LC111
+	.quad	.LC84
+	.quad	cliExit
+	.quad	.LC112
+	.quad	.LC113
+	.quad	cliFeature
+	.quad	.LC114
+	.quad	.LC115
+	.quad	cliGet
+	.quad	.LC116
+	.quad	.LC84
+	.quad	cliHelp
+	.quad	.LC117
+	.quad	.LC118
+	.quad	cliMap
+	.quad	.LC119
+	.quad	.LC120
+	.quad	cliMixer
+	.quad	.LC121
+	.quad	.LC122
+	.quad	cliMotor
+	.quad	.LC81
+	.quad	.LC123
+	.quad	cliProfile
+	.quad	.LC124
+	.quad	.LC125
+	.quad	cliSave
+	.quad	.LC126
+	.quad	.LC127
+	.quad	cliSet
+	.quad	.LC128
+	.quad	.LC129
+	.quad	cliStatus
+	.quad	.LC130
+	.quad	.LC131
+	.quad	cliTasks
+	.quad	.LC132
+	.quad	.LC84
+	.quad	cliVersion
+	.section	.rodata.str1.1
+.LC133:
+	.string	"ADXL345"
+.LC134:
+	.string	"MPU6050"
+.LC135:
+	.string	"MMA845x"
+.LC136:
+	.string	"BMA280"
+.LC137:
+	.string	"LSM303DLHC"
+.LC138:
+	.string	"MPU6000"
+.LC139:
+	.string	"MPU6500"
+.LC140:
+	.string	"FAKE"
+.LC141:
+	.string	"None"
+	.section	.data.rel.ro.local.accNames,"aw"
+	.align 32
+	.type	accNames, @object
+	.size	accNames, 88
+accNames:
+	.quad	.LC84
+	.quad	.LC133
+	.quad	.LC134
+	.quad	.LC135
+	.quad	.LC136
+	.quad	.LC137
+	.quad	.LC138
+	.quad	.LC139
+	.quad	.LC140
+	.quad	.LC141
+	.quad	0
+	.section	.rodata.str1.1
+.LC142:
+	.string	"ACC"
+.LC143:
+	.string	"BARO"
+.LC144:
+	.string	"MAG"
+.LC145:
+	.string	"SONAR"
+.LC146:
+	.string	"GPS"
+.LC147:
+	.string	"GPS+MAG"
+	.section	.data.rel.ro.local.sensorNames,"aw"
+	.align 32
+	.type	sensorNames, @object
+	.size	sensorNames, 64
+sensorNames:
+	.quad	.LC3
+	.quad	.LC142
+	.quad	.LC143
+	.quad	.LC144
+	.quad	.LC145
+	.quad	.LC146
+	.quad	.LC147
+	.quad	0
+	.section	.rodata.str1.1
+.LC148:
+	.string	"VBAT"
+.LC149:
+	.string	"INFLIGHT_ACC_CAL"
+.LC150:
+	.string	"RX_SERIAL"
+.LC151:
+	.string	"MOTOR_STOP"
+.LC152:
+	.string	"SERVO_TILT"
+.LC153:
+	.string	"SOFTSERIAL"
+.LC154:
+	.string	"FAILSAFE"
+.LC155:
+	.string	"TELEMETRY"
+.LC156:
+	.string	"CURRENT_METER"
+.LC157:
+	.string	"3D"
+.LC158:
+	.string	"RX_PARALLEL_PWM"
+.LC159:
+	.string	"RX_MSP"
+.LC160:
+	.string	"RSSI_ADC"
+.LC161:
+	.string	"LED_STRIP"
+.LC162:
+	.string	"DISPLAY"
+.LC163:
+	.string	"BLACKBOX"
+.LC164:
+	.string	"ONESHOT125"
+.LC165:
+	.string	"DSHOT"
+	.section	.data.rel.ro.local.featureNames,"aw"
+	.align 32
+	.type	featureNames, @object
+	.size	featureNames, 176
+featureNames:
+	.quad	.LC29
+	.quad	.LC148
+	.quad	.LC149
+	.quad	.LC150
+	.quad	.LC151
+	.quad	.LC152
+	.quad	.LC153
+	.quad	.LC146
+	.quad	.LC154
+	.quad	.LC145
+	.quad	.LC155
+	.quad	.LC156
+	.quad	.LC157
+	.quad	.LC158
+	.quad	.LC159
+	.quad	.LC160
+	.quad	.LC161
+	.quad	.LC162
+	.quad	.LC163
+	.quad	.LC164
+	.quad	.LC165
+	.quad	0
+	.section	.rodata.str1.1
+.LC166:
+	.string	"QUADP"
+.LC167:
+	.string	"QUADX"
+.LC168:
+	.string	"BI"
+.LC169:
+	.string	"GIMBAL"
+.LC170:
+	.string	"Y6"
+.LC171:
+	.string	"HEX6"
+.LC172:
+	.string	"FLYING_WING"
+.LC173:
+	.string	"Y4"
+.LC174:
+	.string	"HEX6X"
+.LC175:
+	.string	"OCTOX8"
+.LC176:
+	.string	"OCTOFLATP"
+.LC177:
+	.string	"OCTOFLATX"
+.LC178:
+	.string	"AIRPLANE"
+.LC179:
+	.string	"HELI_120_CCPM"
+.LC180:
+	.string	"HELI_90_DEG"
+.LC181:
+	.string	"VTAIL4"
+.LC182:
+	.string	"HEX6H"
+.LC183:
+	.string	"PPM_TO_SERVO"
+.LC184:
+	.string	"DUALCOPTER"
+.LC185:
+	.string	"SINGLECOPTER"
+.LC186:
+	.string	"CUSTOM"
+	.section	.data.rel.ro.local.mixerNames,"aw"
+	.align 32
+	.type	mixerNames, @object
+	.size	mixerNames, 184
+mixerNames:
+	.quad	.LC15
+	.quad	.LC166
+	.quad	.LC167
+	.quad	.LC168
+	.quad	.LC169
+	.quad	.LC170
+	.quad	.LC171
+	.quad	.LC172
+	.quad	.LC173
+	.quad	.LC174
+	.quad	.LC175
+	.quad	.LC176
+	.quad	.LC177
+	.quad	.LC178
+	.quad	.LC179
+	.quad	.LC180
+	.quad	.LC181
+	.quad	.LC182
+	.quad	.LC183
+	.quad	.LC184
+	.quad	.LC185
+	.quad	.LC186
+	.quad	0
+	.section	.bss.bufferIndex,"aw",@nobits
+	.align 4
+	.type	bufferIndex, @object
+	.size	bufferIndex, 4
+bufferIndex:
+	.zero	4
+	.section	.bss.cliBuffer,"aw",@nobits
+	.align 32
+	.type	cliBuffer, @object
+	.size	cliBuffer, 48
+cliBuffer:
+	.zero	48
+	.globl	cliMode
+	.section	.bss.cliMode,"aw",@nobits
+	.type	cliMode, @object
+	.size	cliMode, 1
+cliMode:
+	.zero	1
+	.section	.bss.cliPort,"aw",@nobits
+	.align 8
+	.type	cliPort, @object
+	.size	cliPort, 8
+cliPort:
+	.zero	8
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC44:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC45:
+	.long	1008981770
+	.text
+.Letext0:
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 9 ".//src/main/version.h"
+	.file 10 ".//src/main/common/color.h"
+	.file 11 ".//src/main/common/boot_timing.h"
+	.file 12 ".//src/main/common/profiling.h"
+	.file 13 ".//src/main/drivers/accgyro.h"
+	.file 14 ".//src/main/common/ring_buffer.h"
+	.file 15 ".//src/main/drivers/serial.h"
+	.file 16 ".//src/main/drivers/pwm_rx.h"
+	.file 17 ".//src/main/flight/flight.h"
+	.file 18 ".//src/main/flight/mixer.h"
+	.file 19 ".//src/main/flight/failsafe.h"
+	.file 20 ".//src/main/rx/rx.h"
+	.file 21 ".//src/main/io/escservo.h"
+	.file 22 ".//src/main/io/gimbal.h"
+	.file 23 ".//src/main/io/rc_controls.h"
+	.file 24 ".//src/main/io/serial.h"
+	.file 25 ".//src/main/io/serial_msp.h"
+	.file 26 ".//src/main/sensors/battery.h"
+	.file 27 ".//src/main/sensors/boardalignment.h"
+	.file 28 ".//src/main/sensors/sensors.h"
+	.file 29 ".//src/main/sensors/acceleration.h"
+	.file 30 ".//src/main/sensors/gyro.h"
+	.file 31 ".//src/main/sensors/barometer.h"
+	.file 32 ".//src/main/sensors/gyro_sync.h"
+	.file 33 ".//src/main/telemetry/telemetry.h"
+	.file 34 ".//src/main/config/config.h"
+	.file 35 ".//src/main/config/config_profile.h"
+	.file 36 ".//src/main/config/config_master.h"
+	.file 37 ".//src/main/config/config_values.h"
+	.file 38 ".//src/main/scheduler/scheduler.h"
+	.file 39 ".//src/main/io/serial_cli.h"
+	.file 40 ".//src/main/common/printf.h"
+	.file 41 "/usr/include/string.h"
+	.file 42 ".//src/main/common/maths.h"
+	.file 43 "/usr/include/strings.h"
+	.file 44 "/usr/include/ctype.h"
+	.file 45 ".//src/main/drivers/system.h"
+	.file 46 ".//src/main/common/typeconversion.h"
+	.file 47 ".//src/main/config/runtime_config.h"
+	.file 48 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x55d0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x47
+	.long	.LASF2158
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL218
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1521
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1522
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1523
+	.uleb128 0x1a
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1524
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1525
+	.uleb128 0x6
+	.long	.LASF1527
+	.byte	0x4
+	.byte	0x25
+	.byte	0x15
+	.long	0x5d
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1526
+	.uleb128 0x6
+	.long	.LASF1528
+	.byte	0x4
+	.byte	0x26
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x6
+	.long	.LASF1529
+	.byte	0x4
+	.byte	0x27
+	.byte	0x1a
+	.long	0x7c
+	.uleb128 0x1a
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1530
+	.uleb128 0x6
+	.long	.LASF1531
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x43
+	.uleb128 0x6
+	.long	.LASF1532
+	.byte	0x4
+	.byte	0x29
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x10
+	.long	0x8f
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1533
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1534
+	.uleb128 0x6
+	.long	.LASF1535
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x49
+	.byte	0x8
+	.uleb128 0x9
+	.long	0xd2
+	.uleb128 0x39
+	.long	0xc8
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1536
+	.uleb128 0x10
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF1537
+	.byte	0x5
+	.byte	0x18
+	.byte	0x12
+	.long	0x51
+	.uleb128 0x6
+	.long	.LASF1538
+	.byte	0x5
+	.byte	0x19
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1539
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0x10
+	.long	0xf6
+	.uleb128 0x6
+	.long	.LASF1540
+	.byte	0x6
+	.byte	0x18
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x4a
+	.long	0x107
+	.uleb128 0x10
+	.long	0x107
+	.uleb128 0x6
+	.long	.LASF1541
+	.byte	0x6
+	.byte	0x19
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x10
+	.long	0x11d
+	.uleb128 0x6
+	.long	.LASF1542
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa7
+	.uleb128 0x6
+	.long	.LASF1543
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.long	0xba
+	.uleb128 0x6
+	.long	.LASF1544
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1545
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1546
+	.uleb128 0x11
+	.long	0xd2
+	.long	0x170
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x11
+	.long	0xd2
+	.long	0x180
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF1547
+	.byte	0x2
+	.value	0x33d
+	.byte	0xf
+	.long	0x18d
+	.uleb128 0x9
+	.long	0x192
+	.uleb128 0x28
+	.long	0xa0
+	.long	0x1a6
+	.uleb128 0x5
+	.long	0x1a6
+	.uleb128 0x5
+	.long	0x1a6
+	.byte	0
+	.uleb128 0x9
+	.long	0x1ab
+	.uleb128 0x4c
+	.uleb128 0x9
+	.long	0xd9
+	.uleb128 0x10
+	.long	0x1ac
+	.uleb128 0x39
+	.long	0x1ac
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1548
+	.uleb128 0x18
+	.long	.LASF1549
+	.byte	0x8
+	.byte	0x38
+	.byte	0x11
+	.long	0x12e
+	.uleb128 0x18
+	.long	.LASF1550
+	.byte	0x9
+	.byte	0x18
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x18
+	.long	.LASF1551
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x18
+	.long	.LASF1552
+	.byte	0x9
+	.byte	0x1e
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x18
+	.long	.LASF1553
+	.byte	0x9
+	.byte	0x21
+	.byte	0xe
+	.long	0xc8
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0xa
+	.byte	0x15
+	.long	0x21c
+	.uleb128 0x3
+	.long	.LASF1554
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1555
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1556
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0xb
+	.byte	0x15
+	.long	0x258
+	.uleb128 0x3
+	.long	.LASF1557
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1558
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1559
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1560
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1561
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1564
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1565
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x3
+	.long	0x21c
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0xc
+	.byte	0x14
+	.long	0x2ac
+	.uleb128 0x3
+	.long	.LASF1566
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1567
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1568
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1569
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1570
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1573
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1574
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1575
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1576
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x3
+	.long	0x264
+	.uleb128 0xb
+	.long	.LASF1586
+	.byte	0x30
+	.byte	0xc
+	.byte	0x24
+	.byte	0x10
+	.long	0x314
+	.uleb128 0x2
+	.long	.LASF1577
+	.byte	0xc
+	.byte	0x25
+	.byte	0xe
+	.long	0x12e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0xc
+	.byte	0x26
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0xc
+	.byte	0x27
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1580
+	.byte	0xc
+	.byte	0x28
+	.byte	0xe
+	.long	0x12e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1581
+	.byte	0xc
+	.byte	0x29
+	.byte	0xe
+	.long	0x13a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1582
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xe
+	.long	0x314
+	.byte	0x18
+	.byte	0
+	.uleb128 0x11
+	.long	0x11d
+	.long	0x324
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1583
+	.byte	0xc
+	.byte	0x2b
+	.byte	0x3
+	.long	0x2b8
+	.uleb128 0x10
+	.long	0x324
+	.uleb128 0x6
+	.long	.LASF1584
+	.byte	0xd
+	.byte	0x16
+	.byte	0x10
+	.long	0x341
+	.uleb128 0x9
+	.long	0x346
+	.uleb128 0x4d
+	.uleb128 0x6
+	.long	.LASF1585
+	.byte	0xd
+	.byte	0x17
+	.byte	0x10
+	.long	0x353
+	.uleb128 0x9
+	.long	0x358
+	.uleb128 0x23
+	.long	0x363
+	.uleb128 0x5
+	.long	0x363
+	.byte	0
+	.uleb128 0x9
+	.long	0xea
+	.uleb128 0xb
+	.long	.LASF1587
+	.byte	0x18
+	.byte	0xd
+	.byte	0x21
+	.byte	0x10
+	.long	0x39d
+	.uleb128 0x2
+	.long	.LASF1588
+	.byte	0xd
+	.byte	0x22
+	.byte	0x17
+	.long	0x335
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0xd
+	.byte	0x23
+	.byte	0x17
+	.long	0x347
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0xd
+	.byte	0x24
+	.byte	0xa
+	.long	0xd2
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1591
+	.byte	0xd
+	.byte	0x25
+	.byte	0x3
+	.long	0x368
+	.uleb128 0xb
+	.long	.LASF1592
+	.byte	0x10
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x10
+	.long	0x3f8
+	.uleb128 0x2
+	.long	.LASF1593
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x17
+	.long	0x3f8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1595
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xe
+	.long	0x11d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1596
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xe
+	.long	0x11d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1597
+	.byte	0xe
+	.byte	0x20
+	.byte	0xe
+	.long	0x11d
+	.byte	0xe
+	.byte	0
+	.uleb128 0x9
+	.long	0x113
+	.uleb128 0x6
+	.long	.LASF1598
+	.byte	0xe
+	.byte	0x21
+	.byte	0x3
+	.long	0x3a9
+	.uleb128 0x10
+	.long	0x3fd
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0xf
+	.byte	0x16
+	.long	0x426
+	.uleb128 0x3
+	.long	.LASF1599
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1600
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1601
+	.byte	0xf
+	.byte	0x19
+	.byte	0x3
+	.long	0x40e
+	.uleb128 0x4e
+	.long	.LASF1606
+	.byte	0x7
+	.byte	0x4
+	.long	0x4a
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0x45d
+	.uleb128 0x3
+	.long	.LASF1602
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1603
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1604
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1605
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1606
+	.byte	0xf
+	.byte	0x20
+	.byte	0x3
+	.long	0x432
+	.uleb128 0x6
+	.long	.LASF1607
+	.byte	0xf
+	.byte	0x22
+	.byte	0x10
+	.long	0x475
+	.uleb128 0x9
+	.long	0x47a
+	.uleb128 0x23
+	.long	0x485
+	.uleb128 0x5
+	.long	0x11d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1608
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0x491
+	.uleb128 0x9
+	.long	0x496
+	.uleb128 0x23
+	.long	0x4a6
+	.uleb128 0x5
+	.long	0x4a6
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	0x118
+	.uleb128 0xb
+	.long	.LASF1609
+	.byte	0x40
+	.byte	0xf
+	.byte	0x25
+	.byte	0x10
+	.long	0x521
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0xf
+	.byte	0x27
+	.byte	0x24
+	.long	0x5c3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1611
+	.byte	0xf
+	.byte	0x29
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x10
+	.long	0x45d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1613
+	.byte	0xf
+	.byte	0x2b
+	.byte	0x17
+	.long	0x426
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1614
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xe
+	.long	0x12e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1615
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x12
+	.long	0x3fd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0xf
+	.byte	0x30
+	.byte	0x12
+	.long	0x3fd
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0xf
+	.byte	0x33
+	.byte	0x1e
+	.long	0x469
+	.byte	0x38
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1618
+	.byte	0x58
+	.byte	0xf
+	.byte	0x36
+	.byte	0x8
+	.long	0x5be
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0xf
+	.byte	0x37
+	.byte	0xc
+	.long	0x5e9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0xf
+	.byte	0x39
+	.byte	0x10
+	.long	0x5fd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xf
+	.long	0x611
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0xf
+	.byte	0x3e
+	.byte	0xc
+	.long	0x626
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1623
+	.byte	0xf
+	.byte	0x40
+	.byte	0xb
+	.long	0x641
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0xf
+	.byte	0x42
+	.byte	0xc
+	.long	0x656
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1625
+	.byte	0xf
+	.byte	0x45
+	.byte	0xb
+	.long	0x66f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0xf
+	.byte	0x47
+	.byte	0xc
+	.long	0x689
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0xf
+	.byte	0x49
+	.byte	0x10
+	.long	0x6ac
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x10
+	.long	0x6c5
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0xf
+	.byte	0x4e
+	.byte	0xc
+	.long	0x626
+	.byte	0x50
+	.byte	0
+	.uleb128 0x10
+	.long	0x521
+	.uleb128 0x9
+	.long	0x5be
+	.uleb128 0x6
+	.long	.LASF1630
+	.byte	0xf
+	.byte	0x34
+	.byte	0x3
+	.long	0x4ab
+	.uleb128 0x23
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	0x5c8
+	.uleb128 0x9
+	.long	0x5d4
+	.uleb128 0x28
+	.long	0x12e
+	.long	0x5fd
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x9
+	.long	0x5ee
+	.uleb128 0x28
+	.long	0x107
+	.long	0x611
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x9
+	.long	0x602
+	.uleb128 0x23
+	.long	0x626
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x9
+	.long	0x616
+	.uleb128 0x28
+	.long	0x63a
+	.long	0x63a
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x1a
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1631
+	.uleb128 0x9
+	.long	0x62b
+	.uleb128 0x23
+	.long	0x656
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x45d
+	.byte	0
+	.uleb128 0x9
+	.long	0x646
+	.uleb128 0x28
+	.long	0x63a
+	.long	0x66f
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x485
+	.byte	0
+	.uleb128 0x9
+	.long	0x65b
+	.uleb128 0x23
+	.long	0x689
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x4a6
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x9
+	.long	0x674
+	.uleb128 0x28
+	.long	0x12e
+	.long	0x6a7
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x6a7
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x9
+	.long	0x107
+	.uleb128 0x9
+	.long	0x68e
+	.uleb128 0x28
+	.long	0x6a7
+	.long	0x6c5
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x9
+	.long	0x6b1
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x10
+	.byte	0x14
+	.long	0x6e2
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1633
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1634
+	.byte	0x10
+	.byte	0x17
+	.byte	0x3
+	.long	0x6ca
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x11
+	.byte	0x15
+	.long	0x73c
+	.uleb128 0x3
+	.long	.LASF1635
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1637
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1641
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1642
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1644
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1645
+	.byte	0xa
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1646
+	.byte	0x50
+	.byte	0x11
+	.byte	0x23
+	.byte	0x10
+	.long	0x7bc
+	.uleb128 0x19
+	.string	"P8"
+	.byte	0x11
+	.byte	0x24
+	.byte	0xd
+	.long	0x7bc
+	.byte	0
+	.uleb128 0x19
+	.string	"I8"
+	.byte	0x11
+	.byte	0x25
+	.byte	0xd
+	.long	0x7bc
+	.byte	0xa
+	.uleb128 0x19
+	.string	"D8"
+	.byte	0x11
+	.byte	0x26
+	.byte	0xd
+	.long	0x7bc
+	.byte	0x14
+	.uleb128 0x19
+	.string	"P_f"
+	.byte	0x11
+	.byte	0x28
+	.byte	0xb
+	.long	0x7cc
+	.byte	0x20
+	.uleb128 0x19
+	.string	"I_f"
+	.byte	0x11
+	.byte	0x29
+	.byte	0xb
+	.long	0x7cc
+	.byte	0x2c
+	.uleb128 0x19
+	.string	"D_f"
+	.byte	0x11
+	.byte	0x2a
+	.byte	0xb
+	.long	0x7cc
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1647
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xb
+	.long	0x35
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1648
+	.byte	0x11
+	.byte	0x2c
+	.byte	0xb
+	.long	0x35
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1649
+	.byte	0x11
+	.byte	0x2e
+	.byte	0xd
+	.long	0x107
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x11
+	.long	0x107
+	.long	0x7cc
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x11
+	.long	0x35
+	.long	0x7dc
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1650
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x3
+	.long	0x73c
+	.uleb128 0xb
+	.long	.LASF1651
+	.byte	0x6
+	.byte	0x11
+	.byte	0x57
+	.byte	0x10
+	.long	0x81d
+	.uleb128 0x2
+	.long	.LASF1652
+	.byte	0x11
+	.byte	0x58
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1653
+	.byte	0x11
+	.byte	0x59
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x19
+	.string	"yaw"
+	.byte	0x11
+	.byte	0x5a
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0x11
+	.byte	0x5b
+	.byte	0x3
+	.long	0x7e8
+	.uleb128 0x3a
+	.byte	0x6
+	.byte	0x11
+	.byte	0x5d
+	.long	0x848
+	.uleb128 0x3e
+	.string	"raw"
+	.byte	0x5e
+	.long	0x848
+	.uleb128 0x34
+	.long	.LASF1655
+	.byte	0x11
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x81d
+	.byte	0
+	.uleb128 0x11
+	.long	0xea
+	.long	0x858
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1656
+	.byte	0x11
+	.byte	0x60
+	.byte	0x3
+	.long	0x829
+	.uleb128 0xb
+	.long	.LASF1657
+	.byte	0x4
+	.byte	0x11
+	.byte	0x62
+	.byte	0x10
+	.long	0x88c
+	.uleb128 0x2
+	.long	.LASF1652
+	.byte	0x11
+	.byte	0x63
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1653
+	.byte	0x11
+	.byte	0x64
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1658
+	.byte	0x11
+	.byte	0x65
+	.byte	0x3
+	.long	0x864
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x11
+	.byte	0x67
+	.long	0x8b7
+	.uleb128 0x3e
+	.string	"raw"
+	.byte	0x68
+	.long	0x8b7
+	.uleb128 0x34
+	.long	.LASF1655
+	.byte	0x11
+	.byte	0x69
+	.byte	0x1d
+	.long	0x88c
+	.byte	0
+	.uleb128 0x11
+	.long	0xea
+	.long	0x8c7
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1659
+	.byte	0x11
+	.byte	0x6a
+	.byte	0x3
+	.long	0x898
+	.uleb128 0xb
+	.long	.LASF1660
+	.byte	0x10
+	.byte	0x12
+	.byte	0x34
+	.byte	0x10
+	.long	0x915
+	.uleb128 0x2
+	.long	.LASF1661
+	.byte	0x12
+	.byte	0x35
+	.byte	0xb
+	.long	0x35
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1652
+	.byte	0x12
+	.byte	0x36
+	.byte	0xb
+	.long	0x35
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1653
+	.byte	0x12
+	.byte	0x37
+	.byte	0xb
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x19
+	.string	"yaw"
+	.byte	0x12
+	.byte	0x38
+	.byte	0xb
+	.long	0x35
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1660
+	.byte	0x12
+	.byte	0x39
+	.byte	0x3
+	.long	0x8d3
+	.uleb128 0xb
+	.long	.LASF1662
+	.byte	0x2
+	.byte	0x12
+	.byte	0x42
+	.byte	0x10
+	.long	0x949
+	.uleb128 0x2
+	.long	.LASF1663
+	.byte	0x12
+	.byte	0x43
+	.byte	0xc
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1664
+	.byte	0x12
+	.byte	0x44
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1665
+	.byte	0x12
+	.byte	0x45
+	.byte	0x3
+	.long	0x921
+	.uleb128 0xb
+	.long	.LASF1666
+	.byte	0x8
+	.byte	0x12
+	.byte	0x47
+	.byte	0x10
+	.long	0x997
+	.uleb128 0x2
+	.long	.LASF1667
+	.byte	0x12
+	.byte	0x48
+	.byte	0xe
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0x12
+	.byte	0x49
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0x12
+	.byte	0x4a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1670
+	.byte	0x12
+	.byte	0x4b
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1671
+	.byte	0x12
+	.byte	0x4c
+	.byte	0x3
+	.long	0x955
+	.uleb128 0xb
+	.long	.LASF1672
+	.byte	0x1
+	.byte	0x12
+	.byte	0x4e
+	.byte	0x10
+	.long	0x9be
+	.uleb128 0x2
+	.long	.LASF1673
+	.byte	0x12
+	.byte	0x4f
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1672
+	.byte	0x12
+	.byte	0x50
+	.byte	0x3
+	.long	0x9a3
+	.uleb128 0xb
+	.long	.LASF1674
+	.byte	0x8
+	.byte	0x12
+	.byte	0x54
+	.byte	0x10
+	.long	0xa19
+	.uleb128 0x19
+	.string	"min"
+	.byte	0x12
+	.byte	0x55
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x19
+	.string	"max"
+	.byte	0x12
+	.byte	0x56
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1675
+	.byte	0x12
+	.byte	0x57
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1676
+	.byte	0x12
+	.byte	0x58
+	.byte	0xc
+	.long	0xde
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0x12
+	.byte	0x59
+	.byte	0xc
+	.long	0xde
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1674
+	.byte	0x12
+	.byte	0x5a
+	.byte	0x3
+	.long	0x9ca
+	.uleb128 0xb
+	.long	.LASF1678
+	.byte	0x10
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x10
+	.long	0xa67
+	.uleb128 0x2
+	.long	.LASF1679
+	.byte	0x12
+	.byte	0x5e
+	.byte	0xe
+	.long	0x12e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0x12
+	.byte	0x5f
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x12
+	.byte	0x60
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x12
+	.byte	0x61
+	.byte	0xe
+	.long	0x12e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1683
+	.byte	0x12
+	.byte	0x62
+	.byte	0x3
+	.long	0xa25
+	.uleb128 0x10
+	.long	0xa67
+	.uleb128 0x11
+	.long	0xea
+	.long	0xa88
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0xb
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1684
+	.byte	0x12
+	.byte	0x65
+	.byte	0x10
+	.long	0xa78
+	.uleb128 0xb
+	.long	.LASF1685
+	.byte	0x8
+	.byte	0x13
+	.byte	0x16
+	.byte	0x10
+	.long	0xae3
+	.uleb128 0x2
+	.long	.LASF1686
+	.byte	0x13
+	.byte	0x17
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1687
+	.byte	0x13
+	.byte	0x18
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1688
+	.byte	0x13
+	.byte	0x19
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x13
+	.byte	0x1a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1691
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0xa94
+	.uleb128 0x11
+	.long	0xd9
+	.long	0xafa
+	.uleb128 0x3f
+	.byte	0
+	.uleb128 0x10
+	.long	0xaef
+	.uleb128 0x18
+	.long	.LASF1692
+	.byte	0x14
+	.byte	0x37
+	.byte	0x13
+	.long	0xafa
+	.uleb128 0xb
+	.long	.LASF1693
+	.byte	0x12
+	.byte	0x14
+	.byte	0x3d
+	.byte	0x10
+	.long	0xb67
+	.uleb128 0x2
+	.long	.LASF1694
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xd
+	.long	0xb67
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x14
+	.byte	0x40
+	.byte	0xe
+	.long	0x11d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x14
+	.byte	0x41
+	.byte	0xe
+	.long	0x11d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1698
+	.byte	0x14
+	.byte	0x42
+	.byte	0xe
+	.long	0x11d
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x14
+	.byte	0x43
+	.byte	0xd
+	.long	0x107
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0x107
+	.long	0xb77
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1700
+	.byte	0x14
+	.byte	0x44
+	.byte	0x3
+	.long	0xb0b
+	.uleb128 0xb
+	.long	.LASF1701
+	.byte	0x6
+	.byte	0x15
+	.byte	0x14
+	.byte	0x10
+	.long	0xbb8
+	.uleb128 0x2
+	.long	.LASF1702
+	.byte	0x15
+	.byte	0x15
+	.byte	0xe
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1703
+	.byte	0x15
+	.byte	0x16
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0x15
+	.byte	0x17
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1705
+	.byte	0x15
+	.byte	0x18
+	.byte	0x3
+	.long	0xb83
+	.uleb128 0xb
+	.long	.LASF1706
+	.byte	0x1
+	.byte	0x16
+	.byte	0x1a
+	.byte	0x10
+	.long	0xbdf
+	.uleb128 0x2
+	.long	.LASF1707
+	.byte	0x16
+	.byte	0x1b
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1708
+	.byte	0x16
+	.byte	0x1c
+	.byte	0x3
+	.long	0xbc4
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x17
+	.byte	0x14
+	.long	0xc81
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1710
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1711
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1712
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1713
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1715
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1716
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1718
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1719
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1720
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1722
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1723
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1724
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1725
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1726
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1727
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1728
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1729
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1730
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1731
+	.byte	0x16
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1732
+	.byte	0x17
+	.byte	0x2d
+	.byte	0x3
+	.long	0xbeb
+	.uleb128 0xb
+	.long	.LASF1733
+	.byte	0x8
+	.byte	0x17
+	.byte	0x65
+	.byte	0x10
+	.long	0xccf
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0x17
+	.byte	0x66
+	.byte	0xd
+	.long	0xc81
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1735
+	.byte	0x17
+	.byte	0x67
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1736
+	.byte	0x17
+	.byte	0x6d
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1737
+	.byte	0x17
+	.byte	0x6e
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1738
+	.byte	0x17
+	.byte	0x6f
+	.byte	0x3
+	.long	0xc8d
+	.uleb128 0xb
+	.long	.LASF1739
+	.byte	0x6
+	.byte	0x17
+	.byte	0x73
+	.byte	0x10
+	.long	0xd37
+	.uleb128 0x2
+	.long	.LASF1740
+	.byte	0x17
+	.byte	0x74
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0x17
+	.byte	0x75
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0x17
+	.byte	0x76
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0x17
+	.byte	0x77
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1744
+	.byte	0x17
+	.byte	0x78
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1745
+	.byte	0x17
+	.byte	0x79
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1746
+	.byte	0x17
+	.byte	0x7a
+	.byte	0x3
+	.long	0xcdb
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x18
+	.byte	0x14
+	.long	0xd7f
+	.uleb128 0x3
+	.long	.LASF1747
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1748
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1749
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1750
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1751
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1754
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1755
+	.byte	0x18
+	.byte	0x1d
+	.byte	0x3
+	.long	0xd43
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x18
+	.byte	0x2c
+	.long	0xdd3
+	.uleb128 0x3
+	.long	.LASF1756
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1757
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1758
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1759
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1761
+	.byte	0x23
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0x27
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1766
+	.byte	0x18
+	.byte	0x38
+	.byte	0x3
+	.long	0xd8b
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x18
+	.byte	0x5a
+	.long	0xe09
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1770
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1771
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1772
+	.byte	0x18
+	.byte	0x60
+	.byte	0x3
+	.long	0xddf
+	.uleb128 0xb
+	.long	.LASF1773
+	.byte	0x18
+	.byte	0x18
+	.byte	0x74
+	.byte	0x10
+	.long	0xe57
+	.uleb128 0x2
+	.long	.LASF1611
+	.byte	0x18
+	.byte	0x75
+	.byte	0x1c
+	.long	0xe09
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1774
+	.byte	0x18
+	.byte	0x76
+	.byte	0x13
+	.long	0x5e4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1775
+	.byte	0x18
+	.byte	0x77
+	.byte	0x22
+	.long	0xdd3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1776
+	.byte	0x18
+	.byte	0x78
+	.byte	0x1a
+	.long	0xd7f
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1777
+	.byte	0x18
+	.byte	0x79
+	.byte	0x3
+	.long	0xe15
+	.uleb128 0xb
+	.long	.LASF1778
+	.byte	0x10
+	.byte	0x18
+	.byte	0x7b
+	.byte	0x10
+	.long	0xe8b
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x18
+	.byte	0x7c
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x18
+	.byte	0x7d
+	.byte	0x1b
+	.long	0xe8b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0xe57
+	.uleb128 0x6
+	.long	.LASF1781
+	.byte	0x18
+	.byte	0x7e
+	.byte	0x3
+	.long	0xe63
+	.uleb128 0x10
+	.long	0xe90
+	.uleb128 0xb
+	.long	.LASF1782
+	.byte	0x18
+	.byte	0x18
+	.byte	0x80
+	.byte	0x10
+	.long	0xefd
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x18
+	.byte	0x81
+	.byte	0xd
+	.long	0xefd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x18
+	.byte	0x82
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x18
+	.byte	0x83
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x18
+	.byte	0x84
+	.byte	0xe
+	.long	0x12e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x18
+	.byte	0x85
+	.byte	0xe
+	.long	0x12e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x18
+	.byte	0x87
+	.byte	0xd
+	.long	0x107
+	.byte	0x14
+	.byte	0
+	.uleb128 0x11
+	.long	0x107
+	.long	0xf0d
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1789
+	.byte	0x18
+	.byte	0x88
+	.byte	0x3
+	.long	0xea1
+	.uleb128 0xb
+	.long	.LASF1790
+	.byte	0xc
+	.byte	0x19
+	.byte	0x17
+	.byte	0x10
+	.long	0xf4e
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0x19
+	.byte	0x18
+	.byte	0xe
+	.long	0x12e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1791
+	.byte	0x19
+	.byte	0x19
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1792
+	.byte	0x19
+	.byte	0x1a
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1793
+	.byte	0x19
+	.byte	0x1b
+	.byte	0x3
+	.long	0xf19
+	.uleb128 0x10
+	.long	0xf4e
+	.uleb128 0xb
+	.long	.LASF1794
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x18
+	.byte	0x10
+	.long	0xfbb
+	.uleb128 0x2
+	.long	.LASF1795
+	.byte	0x1a
+	.byte	0x19
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1796
+	.byte	0x1a
+	.byte	0x1a
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1797
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x1a
+	.byte	0x1d
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1799
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1800
+	.byte	0x1a
+	.byte	0x21
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1801
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x3
+	.long	0xf5f
+	.uleb128 0x18
+	.long	.LASF1802
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x18
+	.long	.LASF1803
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x10
+	.long	0x107
+	.uleb128 0xb
+	.long	.LASF1804
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x10
+	.long	0x1014
+	.uleb128 0x2
+	.long	.LASF1805
+	.byte	0x1b
+	.byte	0x15
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1806
+	.byte	0x1b
+	.byte	0x16
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1807
+	.byte	0x1b
+	.byte	0x17
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1808
+	.byte	0x1b
+	.byte	0x18
+	.byte	0x3
+	.long	0xfdf
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x1c
+	.byte	0x1c
+	.long	0x1056
+	.uleb128 0x3
+	.long	.LASF1809
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1811
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1813
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1814
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0x40
+	.byte	0
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x1c
+	.byte	0x26
+	.long	0x1098
+	.uleb128 0x3
+	.long	.LASF1816
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1817
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1818
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1819
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1820
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1822
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1823
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1824
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1825
+	.byte	0x1c
+	.byte	0x30
+	.byte	0x3
+	.long	0x1056
+	.uleb128 0xb
+	.long	.LASF1826
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x10
+	.long	0x10d9
+	.uleb128 0x2
+	.long	.LASF1827
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x14
+	.long	0x1098
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1828
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x14
+	.long	0x1098
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1829
+	.byte	0x1c
+	.byte	0x35
+	.byte	0x14
+	.long	0x1098
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1830
+	.byte	0x1c
+	.byte	0x36
+	.byte	0x3
+	.long	0x10a4
+	.uleb128 0xb
+	.long	.LASF1831
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x39
+	.byte	0x10
+	.long	0x1141
+	.uleb128 0x2
+	.long	.LASF1832
+	.byte	0x1c
+	.byte	0x3a
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1833
+	.byte	0x1c
+	.byte	0x3b
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1834
+	.byte	0x1c
+	.byte	0x3c
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1835
+	.byte	0x1c
+	.byte	0x3d
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1836
+	.byte	0x1c
+	.byte	0x3e
+	.byte	0xd
+	.long	0x848
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0x1c
+	.byte	0x3f
+	.byte	0xd
+	.long	0xf6
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1838
+	.byte	0x1c
+	.byte	0x40
+	.byte	0x3
+	.long	0x10e5
+	.uleb128 0x18
+	.long	.LASF1833
+	.byte	0x1d
+	.byte	0x22
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x4f
+	.string	"acc"
+	.byte	0x1d
+	.byte	0x24
+	.byte	0xe
+	.long	0x39d
+	.uleb128 0xb
+	.long	.LASF1839
+	.byte	0x2
+	.byte	0x1d
+	.byte	0x27
+	.byte	0x10
+	.long	0x118a
+	.uleb128 0x19
+	.string	"xy"
+	.byte	0x1d
+	.byte	0x28
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x19
+	.string	"z"
+	.byte	0x1d
+	.byte	0x29
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1840
+	.byte	0x1d
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1165
+	.uleb128 0xb
+	.long	.LASF1841
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x10
+	.long	0x11d8
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0x1e
+	.byte	0x25
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0x1e
+	.byte	0x26
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1844
+	.byte	0x1e
+	.byte	0x27
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0x1e
+	.byte	0x28
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1846
+	.byte	0x1e
+	.byte	0x29
+	.byte	0x3
+	.long	0x1196
+	.uleb128 0xb
+	.long	.LASF1847
+	.byte	0x10
+	.byte	0x1f
+	.byte	0x1f
+	.byte	0x10
+	.long	0x1226
+	.uleb128 0x2
+	.long	.LASF1848
+	.byte	0x1f
+	.byte	0x20
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1849
+	.byte	0x1f
+	.byte	0x21
+	.byte	0xb
+	.long	0x35
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1850
+	.byte	0x1f
+	.byte	0x22
+	.byte	0xb
+	.long	0x35
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1851
+	.byte	0x1f
+	.byte	0x23
+	.byte	0xb
+	.long	0x35
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1852
+	.byte	0x1f
+	.byte	0x24
+	.byte	0x3
+	.long	0x11e4
+	.uleb128 0xb
+	.long	.LASF1853
+	.byte	0x24
+	.byte	0x20
+	.byte	0x17
+	.byte	0x10
+	.long	0x12b5
+	.uleb128 0x2
+	.long	.LASF1854
+	.byte	0x20
+	.byte	0x18
+	.byte	0xe
+	.long	0x12e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1855
+	.byte	0x20
+	.byte	0x19
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1856
+	.byte	0x20
+	.byte	0x1a
+	.byte	0xe
+	.long	0x12e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1857
+	.byte	0x20
+	.byte	0x1b
+	.byte	0xe
+	.long	0x12e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1858
+	.byte	0x20
+	.byte	0x1c
+	.byte	0xe
+	.long	0x12e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1859
+	.byte	0x20
+	.byte	0x1d
+	.byte	0xe
+	.long	0x12e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0x20
+	.byte	0x1e
+	.byte	0xe
+	.long	0x12e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x20
+	.byte	0x1f
+	.byte	0xe
+	.long	0x12e
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1862
+	.byte	0x20
+	.byte	0x20
+	.byte	0xe
+	.long	0x12e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1863
+	.byte	0x20
+	.byte	0x21
+	.byte	0x3
+	.long	0x1232
+	.uleb128 0x10
+	.long	0x12b5
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x21
+	.byte	0x1c
+	.long	0x12ea
+	.uleb128 0x3
+	.long	.LASF1864
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1865
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1866
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1867
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1868
+	.byte	0x21
+	.byte	0x21
+	.byte	0x3
+	.long	0x12c6
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x21
+	.byte	0x23
+	.long	0x130e
+	.uleb128 0x3
+	.long	.LASF1869
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1870
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1871
+	.byte	0x21
+	.byte	0x26
+	.byte	0x3
+	.long	0x12f6
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x21
+	.byte	0x28
+	.long	0x1332
+	.uleb128 0x3
+	.long	.LASF1872
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1873
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1874
+	.byte	0x21
+	.byte	0x2b
+	.byte	0x3
+	.long	0x131a
+	.uleb128 0xb
+	.long	.LASF1875
+	.byte	0x20
+	.byte	0x21
+	.byte	0x2c
+	.byte	0x10
+	.long	0x13b4
+	.uleb128 0x2
+	.long	.LASF1876
+	.byte	0x21
+	.byte	0x2d
+	.byte	0x19
+	.long	0x12ea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1877
+	.byte	0x21
+	.byte	0x2e
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1878
+	.byte	0x21
+	.byte	0x2f
+	.byte	0x17
+	.long	0x426
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0x21
+	.byte	0x30
+	.byte	0x8
+	.long	0x35
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0x21
+	.byte	0x31
+	.byte	0xb
+	.long	0x35
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0x21
+	.byte	0x32
+	.byte	0x1b
+	.long	0x130e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0x21
+	.byte	0x33
+	.byte	0x11
+	.long	0x1332
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1883
+	.byte	0x21
+	.byte	0x34
+	.byte	0xe
+	.long	0x11d
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1884
+	.byte	0x21
+	.byte	0x35
+	.byte	0x3
+	.long	0x133e
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x22
+	.byte	0x14
+	.long	0x1461
+	.uleb128 0x3
+	.long	.LASF1885
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1886
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1887
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1888
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1889
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1890
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1891
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1892
+	.byte	0x80
+	.uleb128 0x24
+	.long	.LASF1893
+	.value	0x100
+	.uleb128 0x24
+	.long	.LASF1894
+	.value	0x200
+	.uleb128 0x24
+	.long	.LASF1895
+	.value	0x400
+	.uleb128 0x24
+	.long	.LASF1896
+	.value	0x800
+	.uleb128 0x24
+	.long	.LASF1897
+	.value	0x1000
+	.uleb128 0x24
+	.long	.LASF1898
+	.value	0x2000
+	.uleb128 0x24
+	.long	.LASF1899
+	.value	0x4000
+	.uleb128 0x24
+	.long	.LASF1900
+	.value	0x8000
+	.uleb128 0x2e
+	.long	.LASF1901
+	.long	0x10000
+	.uleb128 0x2e
+	.long	.LASF1902
+	.long	0x20000
+	.uleb128 0x2e
+	.long	.LASF1903
+	.long	0x40000
+	.uleb128 0x2e
+	.long	.LASF1904
+	.long	0x80000
+	.uleb128 0x2e
+	.long	.LASF1905
+	.long	0x100000
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF1906
+	.value	0x218
+	.byte	0x23
+	.byte	0x14
+	.long	0x15a4
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x23
+	.byte	0x15
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x23
+	.byte	0x17
+	.byte	0x12
+	.long	0x7dc
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x23
+	.byte	0x19
+	.byte	0x19
+	.long	0xd37
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x23
+	.byte	0x1b
+	.byte	0xd
+	.long	0x107
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x23
+	.byte	0x1c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x23
+	.byte	0x1e
+	.byte	0xd
+	.long	0xea
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0x23
+	.byte	0x21
+	.byte	0x19
+	.long	0x8c7
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x23
+	.byte	0x24
+	.byte	0xd
+	.long	0x107
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0x23
+	.byte	0x25
+	.byte	0xb
+	.long	0x35
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1916
+	.byte	0x23
+	.byte	0x26
+	.byte	0x13
+	.long	0x118a
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x23
+	.byte	0x28
+	.byte	0x17
+	.long	0x1226
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x23
+	.byte	0x2b
+	.byte	0xd
+	.long	0x107
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1919
+	.byte	0x23
+	.byte	0x2d
+	.byte	0x1f
+	.long	0x15a4
+	.byte	0x84
+	.uleb128 0xe
+	.long	.LASF1920
+	.byte	0x23
+	.byte	0x30
+	.byte	0xd
+	.long	0x107
+	.value	0x1c4
+	.uleb128 0xe
+	.long	.LASF1921
+	.byte	0x23
+	.byte	0x31
+	.byte	0xd
+	.long	0x107
+	.value	0x1c5
+	.uleb128 0xe
+	.long	.LASF1922
+	.byte	0x23
+	.byte	0x32
+	.byte	0xd
+	.long	0x107
+	.value	0x1c6
+	.uleb128 0xe
+	.long	.LASF1923
+	.byte	0x23
+	.byte	0x33
+	.byte	0xd
+	.long	0x107
+	.value	0x1c7
+	.uleb128 0xe
+	.long	.LASF1924
+	.byte	0x23
+	.byte	0x35
+	.byte	0xe
+	.long	0x11d
+	.value	0x1c8
+	.uleb128 0xe
+	.long	.LASF1925
+	.byte	0x23
+	.byte	0x36
+	.byte	0xd
+	.long	0x107
+	.value	0x1ca
+	.uleb128 0xe
+	.long	.LASF1926
+	.byte	0x23
+	.byte	0x39
+	.byte	0x12
+	.long	0x15b4
+	.value	0x1cc
+	.uleb128 0xe
+	.long	.LASF1927
+	.byte	0x23
+	.byte	0x3c
+	.byte	0x16
+	.long	0xae3
+	.value	0x20c
+	.uleb128 0xe
+	.long	.LASF1928
+	.byte	0x23
+	.byte	0x3f
+	.byte	0x13
+	.long	0x949
+	.value	0x214
+	.uleb128 0xe
+	.long	.LASF1929
+	.byte	0x23
+	.byte	0x42
+	.byte	0x14
+	.long	0xbdf
+	.value	0x216
+	.byte	0
+	.uleb128 0x11
+	.long	0xccf
+	.long	0x15b4
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x27
+	.byte	0
+	.uleb128 0x11
+	.long	0xa19
+	.long	0x15c4
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1930
+	.byte	0x23
+	.byte	0x47
+	.byte	0x3
+	.long	0x1461
+	.uleb128 0x40
+	.long	.LASF1931
+	.value	0x7dc
+	.byte	0x24
+	.byte	0x17
+	.long	0x1807
+	.uleb128 0x2
+	.long	.LASF1932
+	.byte	0x24
+	.byte	0x18
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0x24
+	.byte	0x19
+	.byte	0xe
+	.long	0x12e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1934
+	.byte	0x24
+	.byte	0x1a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0x24
+	.byte	0x1b
+	.byte	0xd
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0x24
+	.byte	0x1c
+	.byte	0xd
+	.long	0x107
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0x24
+	.byte	0x1d
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x24
+	.byte	0x1e
+	.byte	0xd
+	.long	0x107
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0x24
+	.byte	0x20
+	.byte	0x12
+	.long	0x1807
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0x24
+	.byte	0x23
+	.byte	0x19
+	.long	0xbb8
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x24
+	.byte	0x24
+	.byte	0x16
+	.long	0x997
+	.byte	0xd6
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0x24
+	.byte	0x26
+	.byte	0xe
+	.long	0x11d
+	.byte	0xde
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x24
+	.byte	0x27
+	.byte	0xe
+	.long	0x11d
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0x24
+	.byte	0x28
+	.byte	0xe
+	.long	0x11d
+	.byte	0xe2
+	.uleb128 0x2
+	.long	.LASF1945
+	.byte	0x24
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x10d9
+	.byte	0xe4
+	.uleb128 0x2
+	.long	.LASF1946
+	.byte	0x24
+	.byte	0x2d
+	.byte	0x16
+	.long	0x1014
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF1947
+	.byte	0x24
+	.byte	0x2f
+	.byte	0xc
+	.long	0xde
+	.byte	0xf6
+	.uleb128 0x2
+	.long	.LASF1948
+	.byte	0x24
+	.byte	0x30
+	.byte	0xd
+	.long	0x107
+	.byte	0xf7
+	.uleb128 0x2
+	.long	.LASF1949
+	.byte	0x24
+	.byte	0x31
+	.byte	0xe
+	.long	0x11d
+	.byte	0xf8
+	.uleb128 0x2
+	.long	.LASF1950
+	.byte	0x24
+	.byte	0x32
+	.byte	0xe
+	.long	0x11d
+	.byte	0xfa
+	.uleb128 0x2
+	.long	.LASF1951
+	.byte	0x24
+	.byte	0x33
+	.byte	0xe
+	.long	0x11d
+	.byte	0xfc
+	.uleb128 0x2
+	.long	.LASF1952
+	.byte	0x24
+	.byte	0x34
+	.byte	0xd
+	.long	0x107
+	.byte	0xfe
+	.uleb128 0xe
+	.long	.LASF1953
+	.byte	0x24
+	.byte	0x35
+	.byte	0xe
+	.long	0x11d
+	.value	0x100
+	.uleb128 0xe
+	.long	.LASF1954
+	.byte	0x24
+	.byte	0x36
+	.byte	0xe
+	.long	0x11d
+	.value	0x102
+	.uleb128 0xe
+	.long	.LASF1955
+	.byte	0x24
+	.byte	0x38
+	.byte	0x12
+	.long	0x11d8
+	.value	0x104
+	.uleb128 0xe
+	.long	.LASF1956
+	.byte	0x24
+	.byte	0x3a
+	.byte	0xe
+	.long	0x11d
+	.value	0x10c
+	.uleb128 0xe
+	.long	.LASF1957
+	.byte	0x24
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x858
+	.value	0x10e
+	.uleb128 0xe
+	.long	.LASF1958
+	.byte	0x24
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x858
+	.value	0x114
+	.uleb128 0xe
+	.long	.LASF1959
+	.byte	0x24
+	.byte	0x3d
+	.byte	0x14
+	.long	0x1141
+	.value	0x11c
+	.uleb128 0xe
+	.long	.LASF1960
+	.byte	0x24
+	.byte	0x3f
+	.byte	0x15
+	.long	0xfbb
+	.value	0x12c
+	.uleb128 0xe
+	.long	.LASF1961
+	.byte	0x24
+	.byte	0x41
+	.byte	0x10
+	.long	0xb77
+	.value	0x136
+	.uleb128 0xe
+	.long	.LASF1962
+	.byte	0x24
+	.byte	0x42
+	.byte	0x1a
+	.long	0x6e2
+	.value	0x148
+	.uleb128 0xe
+	.long	.LASF1963
+	.byte	0x24
+	.byte	0x44
+	.byte	0xd
+	.long	0x107
+	.value	0x14c
+	.uleb128 0xe
+	.long	.LASF1964
+	.byte	0x24
+	.byte	0x45
+	.byte	0xd
+	.long	0x107
+	.value	0x14d
+	.uleb128 0xe
+	.long	.LASF1965
+	.byte	0x24
+	.byte	0x46
+	.byte	0xd
+	.long	0x107
+	.value	0x14e
+	.uleb128 0xe
+	.long	.LASF1966
+	.byte	0x24
+	.byte	0x48
+	.byte	0x16
+	.long	0x9be
+	.value	0x14f
+	.uleb128 0xe
+	.long	.LASF1967
+	.byte	0x24
+	.byte	0x49
+	.byte	0xc
+	.long	0xde
+	.value	0x150
+	.uleb128 0xe
+	.long	.LASF1968
+	.byte	0x24
+	.byte	0x4f
+	.byte	0x14
+	.long	0xf0d
+	.value	0x154
+	.uleb128 0xe
+	.long	.LASF1969
+	.byte	0x24
+	.byte	0x51
+	.byte	0x17
+	.long	0x13b4
+	.value	0x16c
+	.uleb128 0xe
+	.long	.LASF1970
+	.byte	0x24
+	.byte	0x53
+	.byte	0xd
+	.long	0x107
+	.value	0x18c
+	.uleb128 0xe
+	.long	.LASF1971
+	.byte	0x24
+	.byte	0x5a
+	.byte	0xf
+	.long	0x1817
+	.value	0x190
+	.uleb128 0xe
+	.long	.LASF1972
+	.byte	0x24
+	.byte	0x5b
+	.byte	0xd
+	.long	0x107
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x11
+	.long	0x915
+	.long	0x1817
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0xb
+	.byte	0
+	.uleb128 0x11
+	.long	0x15c4
+	.long	0x1827
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1931
+	.byte	0x24
+	.byte	0x5c
+	.byte	0x3
+	.long	0x15d0
+	.uleb128 0x10
+	.long	0x1827
+	.uleb128 0x18
+	.long	.LASF1973
+	.byte	0x24
+	.byte	0x5e
+	.byte	0x11
+	.long	0x1827
+	.uleb128 0x18
+	.long	.LASF1974
+	.byte	0x24
+	.byte	0x5f
+	.byte	0x13
+	.long	0x1850
+	.uleb128 0x9
+	.long	0x15c4
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x25
+	.byte	0x14
+	.long	0x1891
+	.uleb128 0x3
+	.long	.LASF1975
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1976
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1977
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1978
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1979
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1980
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1981
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1982
+	.byte	0x80
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1983
+	.byte	0x18
+	.byte	0x25
+	.byte	0x23
+	.byte	0x10
+	.long	0x18ec
+	.uleb128 0x2
+	.long	.LASF1984
+	.byte	0x25
+	.byte	0x24
+	.byte	0x11
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x19
+	.string	"id"
+	.byte	0x25
+	.byte	0x25
+	.byte	0x14
+	.long	0x129
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1985
+	.byte	0x25
+	.byte	0x26
+	.byte	0x13
+	.long	0x118
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1986
+	.byte	0x25
+	.byte	0x27
+	.byte	0x14
+	.long	0x129
+	.byte	0xc
+	.uleb128 0x19
+	.string	"min"
+	.byte	0x25
+	.byte	0x28
+	.byte	0x13
+	.long	0x102
+	.byte	0x10
+	.uleb128 0x19
+	.string	"max"
+	.byte	0x25
+	.byte	0x29
+	.byte	0x13
+	.long	0x102
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1987
+	.byte	0x25
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1891
+	.uleb128 0x10
+	.long	0x18ec
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x25
+	.byte	0x2c
+	.long	0x191e
+	.uleb128 0x34
+	.long	.LASF1988
+	.byte	0x25
+	.byte	0x2d
+	.byte	0xd
+	.long	0xf6
+	.uleb128 0x34
+	.long	.LASF1989
+	.byte	0x25
+	.byte	0x2e
+	.byte	0xb
+	.long	0x35
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1990
+	.byte	0x25
+	.byte	0x2f
+	.byte	0x3
+	.long	0x18fd
+	.uleb128 0x10
+	.long	0x191e
+	.uleb128 0x11
+	.long	0x18f8
+	.long	0x193a
+	.uleb128 0x3f
+	.byte	0
+	.uleb128 0x10
+	.long	0x192f
+	.uleb128 0x18
+	.long	.LASF1991
+	.byte	0x25
+	.byte	0x31
+	.byte	0x1c
+	.long	0x193a
+	.uleb128 0x18
+	.long	.LASF1992
+	.byte	0x25
+	.byte	0x32
+	.byte	0x17
+	.long	0x129
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x26
+	.byte	0x14
+	.long	0x1987
+	.uleb128 0x3
+	.long	.LASF1993
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1994
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1995
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1997
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1998
+	.byte	0xff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1999
+	.byte	0x26
+	.byte	0x1b
+	.byte	0x3
+	.long	0x1957
+	.uleb128 0x41
+	.byte	0x28
+	.byte	0x26
+	.byte	0x1d
+	.long	0x1a04
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x12
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0x26
+	.byte	0x1f
+	.byte	0x9
+	.long	0x63a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2002
+	.byte	0x26
+	.byte	0x20
+	.byte	0x16
+	.long	0x1987
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2003
+	.byte	0x26
+	.byte	0x21
+	.byte	0xe
+	.long	0x12e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2004
+	.byte	0x26
+	.byte	0x22
+	.byte	0xe
+	.long	0x12e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2005
+	.byte	0x26
+	.byte	0x23
+	.byte	0xe
+	.long	0x12e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0x26
+	.byte	0x24
+	.byte	0xe
+	.long	0x12e
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2007
+	.byte	0x26
+	.byte	0x25
+	.byte	0xe
+	.long	0x12e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2008
+	.byte	0x26
+	.byte	0x26
+	.byte	0x3
+	.long	0x1993
+	.uleb128 0x16
+	.long	0x4a
+	.byte	0x26
+	.byte	0x28
+	.long	0x1a52
+	.uleb128 0x3
+	.long	.LASF2009
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2010
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2011
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2012
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF2013
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2015
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2016
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF2017
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2018
+	.byte	0x26
+	.byte	0x4d
+	.byte	0x3
+	.long	0x1a10
+	.uleb128 0x18
+	.long	.LASF2019
+	.byte	0x26
+	.byte	0x67
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x18
+	.long	.LASF2020
+	.byte	0x27
+	.byte	0x15
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x18
+	.long	.LASF2021
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x29
+	.long	.LASF2022
+	.byte	0x6d
+	.byte	0x16
+	.long	0x5e4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cliPort
+	.uleb128 0x50
+	.long	0x1a6a
+	.byte	0x1
+	.byte	0x70
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cliMode
+	.uleb128 0x29
+	.long	.LASF2023
+	.byte	0x73
+	.byte	0xd
+	.long	0x160
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cliBuffer
+	.uleb128 0x29
+	.long	.LASF2024
+	.byte	0x74
+	.byte	0x11
+	.long	0x12e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bufferIndex
+	.uleb128 0x11
+	.long	0x1b1
+	.long	0x1ae3
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x16
+	.byte	0
+	.uleb128 0x10
+	.long	0x1ad3
+	.uleb128 0x29
+	.long	.LASF2025
+	.byte	0x77
+	.byte	0x1b
+	.long	0x1ae3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mixerNames
+	.uleb128 0x11
+	.long	0x1b1
+	.long	0x1b0d
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x15
+	.byte	0
+	.uleb128 0x10
+	.long	0x1afd
+	.uleb128 0x29
+	.long	.LASF2026
+	.byte	0x81
+	.byte	0x1b
+	.long	0x1b0d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	featureNames
+	.uleb128 0x11
+	.long	0x1b1
+	.long	0x1b37
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x10
+	.long	0x1b27
+	.uleb128 0x29
+	.long	.LASF2027
+	.byte	0x8a
+	.byte	0x1b
+	.long	0x1b37
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sensorNames
+	.uleb128 0x11
+	.long	0x1b1
+	.long	0x1b61
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0xa
+	.byte	0
+	.uleb128 0x10
+	.long	0x1b51
+	.uleb128 0x29
+	.long	.LASF2028
+	.byte	0x8e
+	.byte	0x1b
+	.long	0x1b61
+	.uleb128 0x9
+	.byte	0x3
+	.quad	accNames
+	.uleb128 0x41
+	.byte	0x18
+	.byte	0x1
+	.byte	0x92
+	.long	0x1bab
+	.uleb128 0x2
+	.long	.LASF1984
+	.byte	0x1
+	.byte	0x93
+	.byte	0x11
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x1
+	.byte	0x94
+	.byte	0x11
+	.long	0x1ac
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x1
+	.byte	0x95
+	.byte	0xc
+	.long	0x1bb6
+	.byte	0x10
+	.byte	0
+	.uleb128 0x23
+	.long	0x1bb6
+	.uleb128 0x5
+	.long	0xc8
+	.byte	0
+	.uleb128 0x9
+	.long	0x1bab
+	.uleb128 0x6
+	.long	.LASF2031
+	.byte	0x1
+	.byte	0x96
+	.byte	0x3
+	.long	0x1b7b
+	.uleb128 0x10
+	.long	0x1bbb
+	.uleb128 0x11
+	.long	0x1bc7
+	.long	0x1bdc
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0x1bcc
+	.uleb128 0x51
+	.long	.LASF2032
+	.byte	0x1
+	.byte	0x99
+	.byte	0x10
+	.long	0x1bdc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cmdTable
+	.uleb128 0x52
+	.byte	0x7
+	.byte	0x4
+	.long	0x4a
+	.byte	0x1
+	.value	0x1ac
+	.byte	0xe
+	.long	0x1c13
+	.uleb128 0x3
+	.long	.LASF2033
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2034
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2089
+	.value	0x1b4
+	.byte	0x1a
+	.long	0x1b1
+	.uleb128 0x13
+	.long	.LASF2035
+	.byte	0x18
+	.byte	0x8d
+	.byte	0xf
+	.long	0x5e4
+	.long	0x1c49
+	.uleb128 0x5
+	.long	0xd7f
+	.uleb128 0x5
+	.long	0x469
+	.uleb128 0x5
+	.long	0x12e
+	.uleb128 0x5
+	.long	0x45d
+	.uleb128 0x5
+	.long	0x426
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2036
+	.byte	0x18
+	.byte	0x8c
+	.byte	0xf
+	.long	0x5e4
+	.long	0x1c5f
+	.uleb128 0x5
+	.long	0x11d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1619
+	.byte	0xf
+	.byte	0x51
+	.long	0x1c75
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2037
+	.byte	0x28
+	.byte	0x76
+	.long	0x1c86
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2038
+	.byte	0x18
+	.byte	0x90
+	.long	0x1c9c
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0xd7f
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1620
+	.byte	0xf
+	.byte	0x52
+	.byte	0xa
+	.long	0x12e
+	.long	0x1cb2
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1621
+	.byte	0xf
+	.byte	0x53
+	.byte	0x9
+	.long	0x107
+	.long	0x1cc8
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2039
+	.byte	0x29
+	.byte	0x3d
+	.byte	0xe
+	.long	0xc6
+	.long	0x1ce8
+	.uleb128 0x5
+	.long	0xc6
+	.uleb128 0x5
+	.long	0xa0
+	.uleb128 0x5
+	.long	0x146
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2040
+	.byte	0x2a
+	.byte	0x2d
+	.byte	0x5
+	.long	0xa0
+	.long	0x1d08
+	.uleb128 0x5
+	.long	0xa0
+	.uleb128 0x5
+	.long	0xa0
+	.uleb128 0x5
+	.long	0xa0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2041
+	.byte	0x12
+	.byte	0x6b
+	.long	0x1d1e
+	.uleb128 0x5
+	.long	0xa0
+	.uleb128 0x5
+	.long	0x1d1e
+	.byte	0
+	.uleb128 0x9
+	.long	0x915
+	.uleb128 0x2b
+	.long	.LASF2043
+	.byte	0x22
+	.byte	0x35
+	.uleb128 0x13
+	.long	.LASF2042
+	.byte	0x2b
+	.byte	0x74
+	.byte	0xc
+	.long	0xa0
+	.long	0x1d45
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2044
+	.byte	0x12
+	.byte	0x6c
+	.uleb128 0x1c
+	.long	.LASF2045
+	.byte	0x22
+	.byte	0x2d
+	.long	0x1d5d
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2046
+	.byte	0x22
+	.byte	0x2e
+	.long	0x1d6e
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2050
+	.byte	0x22
+	.byte	0x30
+	.byte	0xa
+	.long	0x12e
+	.uleb128 0x3b
+	.long	.LASF2047
+	.value	0x15e
+	.byte	0xe
+	.long	0xc8
+	.long	0x1d95
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2048
+	.byte	0x14
+	.byte	0x57
+	.long	0x1dab
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0x1dab
+	.byte	0
+	.uleb128 0x9
+	.long	0xb77
+	.uleb128 0x13
+	.long	.LASF2049
+	.byte	0x29
+	.byte	0xf6
+	.byte	0xe
+	.long	0xc8
+	.long	0x1dcb
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0xa0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2051
+	.byte	0x2c
+	.byte	0x53
+	.byte	0x1a
+	.long	0x1dd7
+	.uleb128 0x9
+	.long	0x1ddc
+	.uleb128 0x9
+	.long	0x9b
+	.uleb128 0x3b
+	.long	.LASF2052
+	.value	0x164
+	.byte	0xe
+	.long	0xc8
+	.long	0x1dfc
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x5
+	.long	0x1b6
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2053
+	.byte	0x22
+	.byte	0x36
+	.uleb128 0x2b
+	.long	.LASF2054
+	.byte	0x2d
+	.byte	0x22
+	.uleb128 0x1c
+	.long	.LASF2055
+	.byte	0x18
+	.byte	0x93
+	.long	0x1e1b
+	.uleb128 0x5
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x53
+	.long	.LASF2159
+	.byte	0x22
+	.byte	0x38
+	.byte	0x6
+	.long	0x1e29
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2056
+	.byte	0x2e
+	.byte	0x18
+	.byte	0x7
+	.long	0xc8
+	.long	0x1e44
+	.uleb128 0x5
+	.long	0x35
+	.uleb128 0x5
+	.long	0xc8
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2057
+	.byte	0x25
+	.byte	0x38
+	.byte	0x13
+	.long	0x191e
+	.long	0x1e64
+	.uleb128 0x5
+	.long	0x1e64
+	.uleb128 0x5
+	.long	0x1e69
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	0x1833
+	.uleb128 0x9
+	.long	0x18f8
+	.uleb128 0x1c
+	.long	.LASF2058
+	.byte	0x25
+	.byte	0x39
+	.long	0x1e8e
+	.uleb128 0x5
+	.long	0x1e8e
+	.uleb128 0x5
+	.long	0x1e69
+	.uleb128 0x5
+	.long	0x107
+	.uleb128 0x5
+	.long	0x191e
+	.byte	0
+	.uleb128 0x9
+	.long	0x1827
+	.uleb128 0x13
+	.long	.LASF2059
+	.byte	0x2
+	.byte	0xb1
+	.byte	0x11
+	.long	0xb3
+	.long	0x1eb3
+	.uleb128 0x5
+	.long	0x1b6
+	.uleb128 0x5
+	.long	0x1eb8
+	.uleb128 0x5
+	.long	0xa0
+	.byte	0
+	.uleb128 0x9
+	.long	0xc8
+	.uleb128 0x39
+	.long	0x1eb3
+	.uleb128 0x13
+	.long	.LASF2060
+	.byte	0x2e
+	.byte	0x19
+	.byte	0x7
+	.long	0x35
+	.long	0x1ed3
+	.uleb128 0x5
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF2061
+	.value	0x197
+	.byte	0xf
+	.long	0x146
+	.long	0x1ee9
+	.uleb128 0x5
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2062
+	.byte	0xe
+	.byte	0x25
+	.byte	0xa
+	.long	0x11d
+	.long	0x1eff
+	.uleb128 0x5
+	.long	0x1eff
+	.byte	0
+	.uleb128 0x9
+	.long	0x409
+	.uleb128 0x20
+	.long	.LASF2063
+	.byte	0x18
+	.byte	0x9a
+	.byte	0x21
+	.long	0x1f10
+	.uleb128 0x9
+	.long	0xe9c
+	.uleb128 0x20
+	.long	.LASF2064
+	.byte	0x12
+	.byte	0x70
+	.byte	0x1a
+	.long	0x1f21
+	.uleb128 0x9
+	.long	0xa73
+	.uleb128 0x13
+	.long	.LASF2065
+	.byte	0xb
+	.byte	0x23
+	.byte	0xd
+	.long	0x1ac
+	.long	0x1f3c
+	.uleb128 0x5
+	.long	0x258
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2066
+	.byte	0xb
+	.byte	0x24
+	.byte	0xa
+	.long	0x12e
+	.long	0x1f52
+	.uleb128 0x5
+	.long	0x258
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2067
+	.byte	0x2f
+	.byte	0x43
+	.byte	0x5
+	.long	0x63a
+	.long	0x1f68
+	.uleb128 0x5
+	.long	0x12e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2068
+	.byte	0x2f
+	.byte	0x46
+	.byte	0xa
+	.long	0x12e
+	.uleb128 0x20
+	.long	.LASF2069
+	.byte	0x2d
+	.byte	0x19
+	.byte	0xa
+	.long	0x12e
+	.uleb128 0x1c
+	.long	.LASF2070
+	.byte	0xf
+	.byte	0x5d
+	.long	0x1f96
+	.uleb128 0x5
+	.long	0x5e4
+	.uleb128 0x5
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2071
+	.byte	0x19
+	.byte	0x23
+	.byte	0x9
+	.long	0x107
+	.uleb128 0x13
+	.long	.LASF2072
+	.byte	0x19
+	.byte	0x24
+	.byte	0xa
+	.long	0x11d
+	.long	0x1fb8
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2073
+	.byte	0x19
+	.byte	0x25
+	.byte	0x1a
+	.long	0x1fce
+	.long	0x1fce
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	0xf5a
+	.uleb128 0x13
+	.long	.LASF2074
+	.byte	0xc
+	.byte	0x34
+	.byte	0xd
+	.long	0x1ac
+	.long	0x1fe9
+	.uleb128 0x5
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2075
+	.byte	0xc
+	.byte	0x36
+	.byte	0xa
+	.long	0x12e
+	.long	0x1fff
+	.uleb128 0x5
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2076
+	.byte	0xc
+	.byte	0x35
+	.byte	0x1c
+	.long	0x2015
+	.long	0x2015
+	.uleb128 0x5
+	.long	0x2ac
+	.byte	0
+	.uleb128 0x9
+	.long	0x330
+	.uleb128 0x20
+	.long	.LASF2077
+	.byte	0xc
+	.byte	0x37
+	.byte	0xa
+	.long	0x12e
+	.uleb128 0x20
+	.long	.LASF2078
+	.byte	0x20
+	.byte	0x2a
+	.byte	0x18
+	.long	0x2032
+	.uleb128 0x9
+	.long	0x12c1
+	.uleb128 0x20
+	.long	.LASF2079
+	.byte	0x20
+	.byte	0x24
+	.byte	0x5
+	.long	0x63a
+	.uleb128 0x1c
+	.long	.LASF2080
+	.byte	0x26
+	.byte	0x69
+	.long	0x2059
+	.uleb128 0x5
+	.long	0x1a52
+	.uleb128 0x5
+	.long	0x2059
+	.byte	0
+	.uleb128 0x9
+	.long	0x1a04
+	.uleb128 0x2b
+	.long	.LASF2081
+	.byte	0x20
+	.byte	0x2b
+	.uleb128 0x2b
+	.long	.LASF2082
+	.byte	0xc
+	.byte	0x30
+	.uleb128 0x13
+	.long	.LASF2083
+	.byte	0x2b
+	.byte	0x78
+	.byte	0xc
+	.long	0xa0
+	.long	0x208c
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0x1ac
+	.uleb128 0x5
+	.long	0x146
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2084
+	.byte	0x28
+	.byte	0x6e
+	.long	0x209e
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0x42
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF2085
+	.byte	0x1
+	.value	0x49d
+	.byte	0x6
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x210b
+	.uleb128 0x1b
+	.long	.LASF1968
+	.value	0x49d
+	.byte	0x1e
+	.long	0x210b
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x4
+	.quad	.LVL580
+	.long	0x1c49
+	.long	0x20e8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL583
+	.long	0x1c1f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xf0d
+	.uleb128 0x55
+	.long	.LASF2086
+	.byte	0x1
+	.value	0x441
+	.byte	0x6
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27fd
+	.uleb128 0x21
+	.long	.LLRL177
+	.long	0x26d6
+	.uleb128 0x12
+	.string	"c"
+	.value	0x448
+	.byte	0x11
+	.long	0x107
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x21
+	.long	.LLRL179
+	.long	0x232b
+	.uleb128 0x12
+	.string	"cmd"
+	.value	0x44b
+	.byte	0x1d
+	.long	0x27fd
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x14
+	.long	.LASF2087
+	.value	0x44b
+	.byte	0x23
+	.long	0x27fd
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x14
+	.long	.LASF2088
+	.value	0x44b
+	.byte	0x32
+	.long	0x27fd
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x12
+	.string	"i"
+	.value	0x44c
+	.byte	0x16
+	.long	0x12e
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI538
+	.value	.LVU1428
+	.long	.LLRL184
+	.value	0x463
+	.byte	0x11
+	.long	0x2203
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x4
+	.quad	.LVL529
+	.long	0x1f80
+	.long	0x21e7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC99
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL545
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC99
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI543
+	.value	.LVU1434
+	.long	.LLRL186
+	.value	0x465
+	.byte	0x15
+	.long	0x2238
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0xc
+	.quad	.LVL531
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x3165
+	.quad	.LBI547
+	.value	.LVU1440
+	.quad	.LBB547
+	.quad	.LBE547-.LBB547
+	.value	0x466
+	.byte	0x15
+	.long	0x227f
+	.uleb128 0x7
+	.long	0x3170
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x8
+	.quad	.LVL532
+	.long	0x1c5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x4af8
+	.quad	.LBI549
+	.value	.LVU1446
+	.long	.LLRL189
+	.value	0x468
+	.byte	0x11
+	.long	0x22d9
+	.uleb128 0x56
+	.long	0x317c
+	.quad	.LBI551
+	.value	.LVU1448
+	.long	.LLRL190
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x5
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x8
+	.quad	.LVL535
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x3165
+	.quad	.LBI557
+	.value	.LVU1457
+	.long	.LLRL192
+	.value	0x46c
+	.byte	0x11
+	.long	0x230e
+	.uleb128 0x7
+	.long	0x3170
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0xc
+	.quad	.LVL539
+	.long	0x1c5f
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL523
+	.long	0x206c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LLRL198
+	.long	0x2574
+	.uleb128 0x12
+	.string	"cmd"
+	.value	0x476
+	.byte	0x17
+	.long	0x2802
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x17
+	.long	.LASF2090
+	.value	0x477
+	.byte	0x16
+	.long	0x1bbb
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI578
+	.value	.LVU1512
+	.quad	.LBB578
+	.quad	.LBE578-.LBB578
+	.value	0x478
+	.byte	0xd
+	.long	0x23a3
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x8
+	.quad	.LVL547
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x4af8
+	.quad	.LBI580
+	.value	.LVU1527
+	.quad	.LBB580
+	.quad	.LBE580-.LBB580
+	.value	0x48d
+	.byte	0xd
+	.long	0x2415
+	.uleb128 0x35
+	.long	0x317c
+	.quad	.LBI582
+	.value	.LVU1529
+	.quad	.LBB582
+	.quad	.LBE582-.LBB582
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x5
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x8
+	.quad	.LVL550
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.long	0x4b01
+	.long	.LLRL202
+	.byte	0x1
+	.value	0x47f
+	.byte	0x17
+	.long	0x2510
+	.uleb128 0x25
+	.long	0x4b3e
+	.uleb128 0x25
+	.long	0x4b33
+	.uleb128 0x25
+	.long	0x4b28
+	.uleb128 0x25
+	.long	0x4b1d
+	.uleb128 0x25
+	.long	0x4b12
+	.uleb128 0x2f
+	.long	.LLRL202
+	.uleb128 0xf
+	.long	0x4b49
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0xf
+	.long	0x4b55
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0xf
+	.long	0x4b61
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0xf
+	.long	0x4b6c
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0xf
+	.long	0x4b78
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x35
+	.long	0x4abe
+	.quad	.LBI586
+	.value	.LVU1565
+	.quad	.LBB586
+	.quad	.LBE586-.LBB586
+	.byte	0x3
+	.byte	0x21
+	.byte	0x17
+	.uleb128 0x7
+	.long	0x4ad8
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0x7
+	.long	0x4acf
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0xf
+	.long	0x4ae1
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0xf
+	.long	0x4aec
+	.long	.LLST211
+	.long	.LVUS211
+	.uleb128 0x4
+	.quad	.LVL561
+	.long	0x1ed3
+	.long	0x24f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL562
+	.long	0x206c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI589
+	.value	.LVU1581
+	.quad	.LBB589
+	.quad	.LBE589-.LBB589
+	.value	0x483
+	.byte	0x15
+	.long	0x255f
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x8
+	.quad	.LVL565
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC102
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL569
+	.long	0x1ed3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x3165
+	.quad	.LBI564
+	.value	.LVU1384
+	.long	.LLRL194
+	.value	0x498
+	.byte	0xd
+	.long	0x25a9
+	.uleb128 0x7
+	.long	0x3170
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0xc
+	.quad	.LVL513
+	.long	0x1c5f
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI570
+	.value	.LVU1469
+	.quad	.LBB570
+	.quad	.LBE570-.LBB570
+	.value	0x472
+	.byte	0xd
+	.long	0x25f8
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x8
+	.quad	.LVL541
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC100
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x4af8
+	.quad	.LBI572
+	.value	.LVU1473
+	.quad	.LBB572
+	.quad	.LBE572-.LBB572
+	.value	0x473
+	.byte	0xd
+	.long	0x266a
+	.uleb128 0x35
+	.long	0x317c
+	.quad	.LBI574
+	.value	.LVU1475
+	.quad	.LBB574
+	.quad	.LBE574-.LBB574
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x5
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x8
+	.quad	.LVL542
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI592
+	.value	.LVU1540
+	.long	.LLRL213
+	.value	0x492
+	.byte	0x11
+	.long	0x26ad
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x8
+	.quad	.LVL554
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC101
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL511
+	.long	0x1cb2
+	.uleb128 0x1f
+	.quad	.LVL577
+	.long	0x3ac7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cliBuffer
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3c51
+	.quad	.LBI601
+	.value	.LVU1594
+	.quad	.LBB601
+	.quad	.LBE601-.LBB601
+	.value	0x444
+	.byte	0x9
+	.long	0x27e2
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI603
+	.value	.LVU1601
+	.quad	.LBB603
+	.quad	.LBE603-.LBB603
+	.value	0x220
+	.byte	0x5
+	.long	0x274b
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST215
+	.long	.LVUS215
+	.uleb128 0x8
+	.quad	.LVL574
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC97
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x4af8
+	.quad	.LBI605
+	.value	.LVU1605
+	.quad	.LBB605
+	.quad	.LBE605-.LBB605
+	.value	0x221
+	.byte	0x5
+	.long	0x27bd
+	.uleb128 0x35
+	.long	0x317c
+	.quad	.LBI607
+	.value	.LVU1607
+	.quad	.LBB607
+	.quad	.LBE607-.LBB607
+	.byte	0x1
+	.byte	0xbe
+	.byte	0x5
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x8
+	.quad	.LVL575
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL572
+	.long	0x1c86
+	.long	0x27d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL573
+	.long	0x1c75
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL510
+	.long	0x1c9c
+	.uleb128 0xc
+	.quad	.LVL514
+	.long	0x1c9c
+	.byte	0
+	.uleb128 0x9
+	.long	0x1bc7
+	.uleb128 0x9
+	.long	0x1bbb
+	.uleb128 0x22
+	.long	.LASF2091
+	.value	0x43a
+	.long	0x2820
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x43a
+	.byte	0x1e
+	.long	0xc8
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2092
+	.value	0x3e4
+	.long	0x28cb
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x3e4
+	.byte	0x1c
+	.long	0xc8
+	.uleb128 0x17
+	.long	.LASF2094
+	.value	0x3e6
+	.byte	0x12
+	.long	0x1a04
+	.uleb128 0x17
+	.long	.LASF2095
+	.value	0x3e7
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x17
+	.long	.LASF2096
+	.value	0x414
+	.byte	0xe
+	.long	0x12e
+	.uleb128 0x17
+	.long	.LASF2097
+	.value	0x415
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x17
+	.long	.LASF2098
+	.value	0x416
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x17
+	.long	.LASF2099
+	.value	0x428
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x3c
+	.long	0x28aa
+	.uleb128 0x17
+	.long	.LASF2100
+	.value	0x404
+	.byte	0x20
+	.long	0x2032
+	.uleb128 0x17
+	.long	.LASF2101
+	.value	0x405
+	.byte	0x12
+	.long	0x12e
+	.uleb128 0x17
+	.long	.LASF2102
+	.value	0x406
+	.byte	0x12
+	.long	0x12e
+	.byte	0
+	.uleb128 0x3c
+	.long	0x28bc
+	.uleb128 0x17
+	.long	.LASF2103
+	.value	0x41a
+	.byte	0x24
+	.long	0x2015
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x17
+	.long	.LASF2104
+	.value	0x42c
+	.byte	0x22
+	.long	0x1fce
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2110
+	.value	0x3a7
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c24
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x3a7
+	.byte	0x1d
+	.long	0xc8
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x12
+	.string	"i"
+	.value	0x3a9
+	.byte	0xd
+	.long	0x107
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x14
+	.long	.LASF1594
+	.value	0x3aa
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x14
+	.long	.LASF2105
+	.value	0x3ca
+	.byte	0xe
+	.long	0x11d
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x14
+	.long	.LASF2106
+	.value	0x3d0
+	.byte	0x1e
+	.long	0x1f21
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x14
+	.long	.LASF2107
+	.value	0x3d6
+	.byte	0x25
+	.long	0x1f10
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x59
+	.quad	.LBB203
+	.quad	.LBE203-.LBB203
+	.long	0x29e3
+	.uleb128 0x14
+	.long	.LASF1774
+	.value	0x3d8
+	.byte	0x17
+	.long	0x5e4
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.quad	.LVL38
+	.long	0x1ee9
+	.long	0x299f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 40
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL39
+	.long	0x1ee9
+	.long	0x29b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 24
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL40
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI193
+	.value	.LVU58
+	.long	.LLRL11
+	.value	0x3be
+	.byte	0x5
+	.long	0x2a1f
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x8
+	.quad	.LVL22
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI196
+	.value	.LVU63
+	.long	.LLRL13
+	.value	0x3c1
+	.byte	0x5
+	.long	0x2a62
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x8
+	.quad	.LVL23
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC10
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI201
+	.value	.LVU74
+	.quad	.LBB201
+	.quad	.LBE201-.LBB201
+	.value	0x3c5
+	.byte	0x5
+	.long	0x2aaa
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x8
+	.quad	.LVL29
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL9
+	.long	0x1f74
+	.uleb128 0x4
+	.quad	.LVL10
+	.long	0x208c
+	.long	0x2adc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL11
+	.long	0x1f68
+	.uleb128 0x4
+	.quad	.LVL14
+	.long	0x208c
+	.long	0x2b08
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL18
+	.long	0x208c
+	.long	0x2b20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL19
+	.long	0x1f52
+	.long	0x2b37
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL24
+	.long	0x1f3c
+	.long	0x2b4f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL26
+	.long	0x1f26
+	.long	0x2b67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL27
+	.long	0x208c
+	.long	0x2b85
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL30
+	.long	0x208c
+	.long	0x2bb0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x7dc
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL31
+	.long	0x1f15
+	.uleb128 0x4
+	.quad	.LVL33
+	.long	0x208c
+	.long	0x2bdc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL34
+	.long	0x1f04
+	.uleb128 0x4
+	.quad	.LVL45
+	.long	0x208c
+	.long	0x2c08
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL46
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2108
+	.value	0x38e
+	.long	0x2c5f
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x38e
+	.byte	0x1a
+	.long	0xc8
+	.uleb128 0x2a
+	.string	"i"
+	.value	0x390
+	.byte	0xe
+	.long	0x12e
+	.uleb128 0x2a
+	.string	"val"
+	.value	0x391
+	.byte	0x1a
+	.long	0x1e69
+	.uleb128 0x17
+	.long	.LASF2109
+	.value	0x392
+	.byte	0x9
+	.long	0xa0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2111
+	.value	0x355
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2fee
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x355
+	.byte	0x1a
+	.long	0xc8
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x12
+	.string	"i"
+	.value	0x357
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x12
+	.string	"len"
+	.value	0x358
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x12
+	.string	"val"
+	.value	0x359
+	.byte	0x1a
+	.long	0x1e69
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x14
+	.long	.LASF2112
+	.value	0x35a
+	.byte	0xb
+	.long	0xc8
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x14
+	.long	.LASF2113
+	.value	0x35b
+	.byte	0xd
+	.long	0xf6
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x14
+	.long	.LASF2114
+	.value	0x35c
+	.byte	0xb
+	.long	0x35
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x21
+	.long	.LLRL139
+	.long	0x2ed5
+	.uleb128 0x14
+	.long	.LASF2115
+	.value	0x36a
+	.byte	0xf
+	.long	0xc8
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x14
+	.long	.LASF2116
+	.value	0x36e
+	.byte	0x11
+	.long	0x107
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x21
+	.long	.LLRL146
+	.long	0x2dd2
+	.uleb128 0x12
+	.string	"tmp"
+	.value	0x379
+	.byte	0x27
+	.long	0x191e
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0xd
+	.long	0x2fee
+	.quad	.LBI415
+	.value	.LVU1131
+	.quad	.LBB415
+	.quad	.LBE415-.LBB415
+	.value	0x37e
+	.byte	0x15
+	.long	0x2d99
+	.uleb128 0x25
+	.long	0x3005
+	.uleb128 0x25
+	.long	0x2ff9
+	.uleb128 0x8
+	.quad	.LVL420
+	.long	0x1e6e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL421
+	.long	0x208c
+	.long	0x2dbe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL424
+	.long	0x3013
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x4b84
+	.quad	.LBI404
+	.value	.LVU1059
+	.long	.LLRL142
+	.value	0x372
+	.byte	0x11
+	.long	0x2e18
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x8
+	.quad	.LVL393
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI410
+	.value	.LVU1083
+	.long	.LLRL144
+	.value	0x387
+	.byte	0x9
+	.long	0x2e4d
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x27
+	.quad	.LVL404
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI419
+	.value	.LVU1144
+	.quad	.LBB419
+	.quad	.LBE419-.LBB419
+	.value	0x382
+	.byte	0x15
+	.long	0x2e84
+	.uleb128 0x30
+	.long	0x3187
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC75
+	.byte	0x9f
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL395
+	.long	0x1ebd
+	.long	0x2e9c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL398
+	.long	0x1ed3
+	.long	0x2eb4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL399
+	.long	0x206c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI422
+	.value	.LVU1092
+	.quad	.LBB422
+	.quad	.LBE422-.LBB422
+	.value	0x361
+	.byte	0x9
+	.long	0x2f24
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x8
+	.quad	.LVL406
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC73
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI424
+	.value	.LVU1103
+	.quad	.LBB424
+	.quad	.LBE424-.LBB424
+	.value	0x366
+	.byte	0xd
+	.long	0x2f6c
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x8
+	.quad	.LVL411
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL385
+	.long	0x1ed3
+	.long	0x2f84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL387
+	.long	0x55c8
+	.long	0x2fa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3d
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL408
+	.long	0x208c
+	.long	0x2fba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL410
+	.long	0x3013
+	.long	0x2fd8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL417
+	.long	0x2c24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2117
+	.value	0x350
+	.long	0x3013
+	.uleb128 0x3d
+	.string	"var"
+	.value	0x350
+	.byte	0x2c
+	.long	0x1e69
+	.uleb128 0x26
+	.long	.LASF2113
+	.byte	0x1
+	.value	0x350
+	.byte	0x49
+	.long	0x192a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2118
+	.value	0x33e
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3165
+	.uleb128 0x5a
+	.string	"var"
+	.byte	0x1
+	.value	0x33e
+	.byte	0x2e
+	.long	0x1e69
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1b
+	.long	.LASF2119
+	.value	0x33e
+	.byte	0x3c
+	.long	0x12e
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x14
+	.long	.LASF2113
+	.value	0x340
+	.byte	0x17
+	.long	0x191e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x36
+	.string	"buf"
+	.value	0x341
+	.long	0x170
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.quad	.LVL74
+	.long	0x1e44
+	.long	0x3093
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL77
+	.long	0x208c
+	.long	0x30b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC23
+	.byte	0
+	.uleb128 0x31
+	.quad	.LVL83
+	.long	0x208c
+	.long	0x30d1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC24
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL84
+	.long	0x1e29
+	.long	0x30e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL85
+	.long	0x208c
+	.long	0x3108
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL87
+	.long	0x1e29
+	.long	0x3120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL88
+	.long	0x208c
+	.long	0x3138
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL89
+	.long	0x1e29
+	.long	0x3150
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL90
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2120
+	.value	0x339
+	.long	0x317c
+	.uleb128 0x3d
+	.string	"ch"
+	.value	0x339
+	.byte	0x1e
+	.long	0x107
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2121
+	.value	0x334
+	.long	0x3194
+	.uleb128 0x3d
+	.string	"str"
+	.value	0x334
+	.byte	0x22
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2122
+	.value	0x32b
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x329a
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x32b
+	.byte	0x1f
+	.long	0xc8
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI477
+	.value	.LVU1202
+	.long	.LLRL164
+	.value	0x32f
+	.byte	0x5
+	.long	0x3208
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x8
+	.quad	.LVL443
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC79
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x32b3
+	.quad	.LBI481
+	.value	.LVU1210
+	.long	.LLRL166
+	.value	0x331
+	.byte	0x5
+	.long	0x328c
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI483
+	.value	.LVU1212
+	.quad	.LBB483
+	.quad	.LBE483-.LBB483
+	.value	0x31c
+	.byte	0x5
+	.long	0x3271
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0x8
+	.quad	.LVL445
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL446
+	.long	0x1e0a
+	.uleb128 0x27
+	.quad	.LVL447
+	.long	0x1e03
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL444
+	.long	0x1d23
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2123
+	.value	0x321
+	.long	0x32b3
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x321
+	.byte	0x1b
+	.long	0xc8
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2136
+	.value	0x31b
+	.uleb128 0x22
+	.long	.LASF2124
+	.value	0x307
+	.long	0x32e9
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x307
+	.byte	0x1e
+	.long	0xc8
+	.uleb128 0x2a
+	.string	"len"
+	.value	0x309
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x2a
+	.string	"i"
+	.value	0x30a
+	.byte	0x9
+	.long	0xa0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2125
+	.value	0x2d9
+	.long	0x333e
+	.uleb128 0x26
+	.long	.LASF2093
+	.byte	0x1
+	.value	0x2d9
+	.byte	0x1c
+	.long	0xc8
+	.uleb128 0x17
+	.long	.LASF2126
+	.value	0x2db
+	.byte	0x9
+	.long	0xa0
+	.uleb128 0x17
+	.long	.LASF2127
+	.value	0x2dc
+	.byte	0x9
+	.long	0xa0
+	.uleb128 0x2a
+	.string	"len"
+	.value	0x2dd
+	.byte	0x9
+	.long	0xa0
+	.uleb128 0x17
+	.long	.LASF2128
+	.value	0x2dd
+	.byte	0xe
+	.long	0xa0
+	.uleb128 0x2a
+	.string	"pch"
+	.value	0x2de
+	.byte	0xb
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2129
+	.value	0x2b7
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x350a
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x2b7
+	.byte	0x1c
+	.long	0xc8
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x12
+	.string	"i"
+	.value	0x2b9
+	.byte	0x9
+	.long	0xa0
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x12
+	.string	"len"
+	.value	0x2ba
+	.byte	0x9
+	.long	0xa0
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI204
+	.value	.LVU149
+	.long	.LLRL20
+	.value	0x2ce
+	.byte	0xd
+	.long	0x33ca
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x27
+	.quad	.LVL62
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI208
+	.value	.LVU170
+	.quad	.LBB208
+	.quad	.LBE208-.LBB208
+	.value	0x2c2
+	.byte	0x9
+	.long	0x3419
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x8
+	.quad	.LVL66
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI210
+	.value	.LVU185
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.value	0x2c8
+	.byte	0x9
+	.long	0x3450
+	.uleb128 0x30
+	.long	0x3187
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL48
+	.long	0x1ed3
+	.long	0x3468
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL49
+	.long	0x206c
+	.long	0x3493
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL53
+	.long	0x206c
+	.long	0x34b7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x31
+	.quad	.LVL58
+	.long	0x208c
+	.long	0x34d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.byte	0
+	.uleb128 0x31
+	.quad	.LVL65
+	.long	0x208c
+	.long	0x34f5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL69
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2130
+	.value	0x29c
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36c6
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x29c
+	.byte	0x1a
+	.long	0xc8
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x12
+	.string	"len"
+	.value	0x29e
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x12
+	.string	"i"
+	.value	0x29f
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x36
+	.string	"out"
+	.value	0x2a0
+	.long	0x36c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -57
+	.uleb128 0x21
+	.long	.LLRL33
+	.long	0x35ac
+	.uleb128 0x14
+	.long	.LASF2131
+	.value	0x2a7
+	.byte	0x2f
+	.long	0xa0
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x3c
+	.long	0x359e
+	.uleb128 0x2a
+	.string	"__c"
+	.value	0x2a7
+	.byte	0x22
+	.long	0xa0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL103
+	.long	0x1dcb
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI218
+	.value	.LVU279
+	.long	.LLRL35
+	.value	0x2ab
+	.byte	0xd
+	.long	0x35ef
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1f
+	.quad	.LVL113
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI224
+	.value	.LVU293
+	.long	.LLRL37
+	.value	0x2b0
+	.byte	0x5
+	.long	0x3632
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x8
+	.quad	.LVL116
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC27
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL102
+	.long	0x1ed3
+	.long	0x364a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL108
+	.long	0x1db0
+	.long	0x3668
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL109
+	.long	0x1db0
+	.long	0x3686
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL115
+	.long	0x1d95
+	.long	0x36a4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL120
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -57
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xd2
+	.long	0x36d6
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2132
+	.value	0x291
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3771
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x291
+	.byte	0x1b
+	.long	0xc8
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.string	"i"
+	.value	0x293
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI187
+	.value	.LVU8
+	.long	.LLRL3
+	.value	0x297
+	.byte	0x5
+	.long	0x375c
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x8
+	.quad	.LVL5
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL7
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2133
+	.value	0x234
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ac7
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x234
+	.byte	0x1e
+	.long	0xc8
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x12
+	.string	"i"
+	.value	0x236
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x12
+	.string	"len"
+	.value	0x237
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x14
+	.long	.LASF1594
+	.value	0x238
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x21
+	.long	.LLRL43
+	.long	0x3984
+	.uleb128 0x14
+	.long	.LASF2134
+	.value	0x250
+	.byte	0xd
+	.long	0x63a
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x5b
+	.long	0x317c
+	.quad	.LBB229
+	.quad	.LBE229-.LBB229
+	.byte	0x1
+	.value	0x263
+	.byte	0x15
+	.long	0x381c
+	.uleb128 0x25
+	.long	0x3187
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI231
+	.value	.LVU355
+	.quad	.LBB231
+	.quad	.LBE231-.LBB231
+	.value	0x26f
+	.byte	0x15
+	.long	0x386b
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x8
+	.quad	.LVL135
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC35
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI233
+	.value	.LVU426
+	.long	.LLRL46
+	.value	0x269
+	.byte	0x15
+	.long	0x38a3
+	.uleb128 0x30
+	.long	0x3187
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC34
+	.byte	0x9f
+	.uleb128 0x27
+	.quad	.LVL147
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI238
+	.value	.LVU410
+	.quad	.LBB238
+	.quad	.LBE238-.LBB238
+	.value	0x25a
+	.byte	0x11
+	.long	0x38d7
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI240
+	.value	.LVU421
+	.quad	.LBB240
+	.quad	.LBE240-.LBB240
+	.value	0x272
+	.byte	0x15
+	.long	0x3926
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x8
+	.quad	.LVL161
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC36
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL132
+	.long	0x206c
+	.long	0x394a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL134
+	.long	0x1d5d
+	.uleb128 0x31
+	.quad	.LVL139
+	.long	0x208c
+	.long	0x3976
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL160
+	.long	0x1d4c
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI245
+	.value	.LVU367
+	.quad	.LBB245
+	.quad	.LBE245-.LBB245
+	.value	0x247
+	.byte	0x9
+	.long	0x39d3
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x8
+	.quad	.LVL141
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC31
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI247
+	.value	.LVU383
+	.quad	.LBB247
+	.quad	.LBE247-.LBB247
+	.value	0x24d
+	.byte	0x9
+	.long	0x3a07
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST50
+	.long	.LVUS50
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI251
+	.value	.LVU390
+	.long	.LLRL51
+	.value	0x23e
+	.byte	0x9
+	.long	0x3a4a
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x8
+	.quad	.LVL151
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC30
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL123
+	.long	0x1ed3
+	.long	0x3a62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL125
+	.long	0x1d6e
+	.uleb128 0x4
+	.quad	.LVL126
+	.long	0x206c
+	.long	0x3a9a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC17
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL144
+	.long	0x208c
+	.long	0x3ab2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL155
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2135
+	.value	0x224
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c51
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x224
+	.byte	0x1b
+	.long	0xc8
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI439
+	.value	.LVU1148
+	.long	.LLRL151
+	.value	0x226
+	.byte	0x5
+	.long	0x3b3b
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x8
+	.quad	.LVL427
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC76
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x329a
+	.quad	.LBI443
+	.value	.LVU1162
+	.long	.LLRL153
+	.value	0x22e
+	.byte	0x5
+	.long	0x3c43
+	.uleb128 0x7
+	.long	0x32a5
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI445
+	.value	.LVU1165
+	.quad	.LBB445
+	.quad	.LBE445-.LBB445
+	.value	0x325
+	.byte	0x5
+	.long	0x3bb1
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x8
+	.quad	.LVL429
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC77
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x32b3
+	.quad	.LBI447
+	.value	.LVU1170
+	.long	.LLRL156
+	.value	0x328
+	.byte	0x5
+	.long	0x3c35
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI449
+	.value	.LVU1172
+	.quad	.LBB449
+	.quad	.LBE449-.LBB449
+	.value	0x31c
+	.byte	0x5
+	.long	0x3c1a
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x8
+	.quad	.LVL431
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL432
+	.long	0x1e0a
+	.uleb128 0x27
+	.quad	.LVL433
+	.long	0x1e03
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL430
+	.long	0x1e1b
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL428
+	.long	0x1d45
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF2137
+	.value	0x21b
+	.uleb128 0x1d
+	.long	.LASF2138
+	.value	0x1b8
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4150
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x1b8
+	.byte	0x1b
+	.long	0xc8
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x12
+	.string	"i"
+	.value	0x1ba
+	.byte	0x12
+	.long	0x4a
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x36
+	.string	"buf"
+	.value	0x1bb
+	.long	0x4150
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x12
+	.string	"thr"
+	.value	0x1bc
+	.byte	0xb
+	.long	0x35
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x14
+	.long	.LASF1652
+	.value	0x1bc
+	.byte	0x10
+	.long	0x35
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x14
+	.long	.LASF1653
+	.value	0x1bc
+	.byte	0x16
+	.long	0x35
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0x12
+	.string	"yaw"
+	.value	0x1bc
+	.byte	0x1d
+	.long	0x35
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x14
+	.long	.LASF1594
+	.value	0x1bd
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x14
+	.long	.LASF2139
+	.value	0x1bf
+	.byte	0xd
+	.long	0x107
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0xd
+	.long	0x2807
+	.quad	.LBI489
+	.value	.LVU1248
+	.quad	.LBB489
+	.quad	.LBE489-.LBB489
+	.value	0x1ca
+	.byte	0x9
+	.long	0x3d71
+	.uleb128 0x7
+	.long	0x2812
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x8
+	.quad	.LVL462
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL449
+	.long	0x1d2a
+	.long	0x3d96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC80
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL451
+	.long	0x1d2a
+	.long	0x3dbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC81
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL453
+	.long	0x208c
+	.long	0x3dda
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC82
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL454
+	.long	0x208c
+	.long	0x3df9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC83
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL455
+	.long	0x32ba
+	.long	0x3e11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL456
+	.long	0x208c
+	.long	0x3e30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC85
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL457
+	.long	0x476a
+	.long	0x3e48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL458
+	.long	0x208c
+	.long	0x3e60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL459
+	.long	0x4160
+	.long	0x3e78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x80
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL461
+	.long	0x208c
+	.long	0x3e97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC86
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL463
+	.long	0x208c
+	.long	0x3eb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC87
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL464
+	.long	0x208c
+	.long	0x3ed5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC88
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL465
+	.long	0x208c
+	.long	0x3ef4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC89
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL468
+	.long	0x1e29
+	.long	0x3f0c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL469
+	.long	0x208c
+	.long	0x3f24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL470
+	.long	0x1e29
+	.long	0x3f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -96
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL471
+	.long	0x208c
+	.long	0x3f5e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL472
+	.long	0x1e29
+	.long	0x3f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -92
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL473
+	.long	0x208c
+	.long	0x3f98
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL474
+	.long	0x1e29
+	.long	0x3fba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -88
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL475
+	.long	0x208c
+	.long	0x3fd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL482
+	.long	0x208c
+	.long	0x3ffe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL483
+	.long	0x208c
+	.long	0x4016
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL486
+	.long	0x208c
+	.long	0x403b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC91
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL487
+	.long	0x208c
+	.long	0x405a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC92
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL488
+	.long	0x1d6e
+	.uleb128 0x4
+	.quad	.LVL491
+	.long	0x208c
+	.long	0x407f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL496
+	.long	0x208c
+	.long	0x4097
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL497
+	.long	0x208c
+	.long	0x40b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC95
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL501
+	.long	0x208c
+	.long	0x40db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL502
+	.long	0x208c
+	.long	0x40f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL503
+	.long	0x4160
+	.long	0x410b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL507
+	.long	0x208c
+	.long	0x4123
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL508
+	.long	0x208c
+	.long	0x413b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL509
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xd2
+	.long	0x4160
+	.uleb128 0x15
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2140
+	.value	0x19b
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x421d
+	.uleb128 0x1b
+	.long	.LASF1594
+	.value	0x19b
+	.byte	0x20
+	.long	0x107
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x12
+	.string	"i"
+	.value	0x19d
+	.byte	0xe
+	.long	0x12e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x17
+	.long	.LASF2113
+	.value	0x19e
+	.byte	0x1a
+	.long	0x1e69
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI212
+	.value	.LVU240
+	.long	.LLRL28
+	.value	0x1a8
+	.byte	0x9
+	.long	0x41eb
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x8
+	.quad	.LVL96
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL94
+	.long	0x208c
+	.long	0x4203
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL95
+	.long	0x3013
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2141
+	.value	0x10b
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x476a
+	.uleb128 0x1b
+	.long	.LASF2093
+	.value	0x10b
+	.byte	0x1b
+	.long	0xc8
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x12
+	.string	"i"
+	.value	0x10d
+	.byte	0x9
+	.long	0xa0
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x14
+	.long	.LASF2142
+	.value	0x10d
+	.byte	0xc
+	.long	0xa0
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x14
+	.long	.LASF2143
+	.value	0x10e
+	.byte	0x9
+	.long	0xa0
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x12
+	.string	"len"
+	.value	0x10f
+	.byte	0xd
+	.long	0x107
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x36
+	.string	"buf"
+	.value	0x110
+	.long	0x4150
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5c
+	.long	.LASF2144
+	.byte	0x1
+	.value	0x111
+	.byte	0xb
+	.long	0x7cc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x12
+	.string	"ptr"
+	.value	0x112
+	.byte	0xb
+	.long	0xc8
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0xd
+	.long	0x4b84
+	.quad	.LBI258
+	.value	.LVU448
+	.quad	.LBB258
+	.quad	.LBE258-.LBB258
+	.value	0x144
+	.byte	0xd
+	.long	0x4322
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x8
+	.quad	.LVL168
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI260
+	.value	.LVU501
+	.long	.LLRL60
+	.value	0x117
+	.byte	0x9
+	.long	0x4365
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x8
+	.quad	.LVL194
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC40
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI264
+	.value	.LVU538
+	.long	.LLRL62
+	.value	0x128
+	.byte	0x9
+	.long	0x43a8
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x8
+	.quad	.LVL212
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC43
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI268
+	.value	.LVU551
+	.long	.LLRL64
+	.value	0x12a
+	.byte	0xd
+	.long	0x43dd
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0xc
+	.quad	.LVL215
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI274
+	.value	.LVU559
+	.quad	.LBB274
+	.quad	.LBE274-.LBB274
+	.value	0x12b
+	.byte	0x9
+	.long	0x442c
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x8
+	.quad	.LVL217
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI276
+	.value	.LVU592
+	.long	.LLRL67
+	.value	0x15b
+	.byte	0x11
+	.long	0x4461
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x27
+	.quad	.LVL232
+	.long	0x1f80
+	.byte	0
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI280
+	.value	.LVU599
+	.quad	.LBB280
+	.quad	.LBE280-.LBB280
+	.value	0x137
+	.byte	0x15
+	.long	0x4495
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST69
+	.long	.LVUS69
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL164
+	.long	0x1ed3
+	.long	0x44ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL165
+	.long	0x206c
+	.long	0x44d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL166
+	.long	0x206c
+	.long	0x4501
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL170
+	.long	0x1db0
+	.long	0x451f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL173
+	.long	0x1ebd
+	.long	0x4537
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL175
+	.long	0x1db0
+	.long	0x4555
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL179
+	.long	0x1ebd
+	.long	0x456d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL181
+	.long	0x1db0
+	.long	0x458b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL185
+	.long	0x1ebd
+	.long	0x45a3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL187
+	.long	0x1db0
+	.long	0x45c1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL190
+	.long	0x1ebd
+	.uleb128 0x4
+	.quad	.LVL197
+	.long	0x208c
+	.long	0x45ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL198
+	.long	0x1e29
+	.long	0x4604
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL199
+	.long	0x208c
+	.long	0x461c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL200
+	.long	0x1e29
+	.long	0x4634
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL201
+	.long	0x208c
+	.long	0x464c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL202
+	.long	0x1e29
+	.long	0x4664
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL203
+	.long	0x208c
+	.long	0x467c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL204
+	.long	0x1e29
+	.long	0x4694
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL205
+	.long	0x208c
+	.long	0x46ac
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL219
+	.long	0x1db0
+	.long	0x46ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL222
+	.long	0x1ed3
+	.long	0x46e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL226
+	.long	0x206c
+	.long	0x4706
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL228
+	.long	0x1d08
+	.long	0x4724
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL229
+	.long	0x208c
+	.long	0x4749
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL242
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.long	.LASF2145
+	.byte	0x1
+	.byte	0xc7
+	.byte	0xd
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4ab9
+	.uleb128 0x5e
+	.long	.LASF2093
+	.byte	0x1
+	.byte	0xc7
+	.byte	0x1a
+	.long	0xc8
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x32
+	.string	"i"
+	.byte	0xc9
+	.byte	0x9
+	.long	0xa0
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x32
+	.string	"val"
+	.byte	0xc9
+	.byte	0xc
+	.long	0xa0
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x32
+	.string	"len"
+	.byte	0xca
+	.byte	0xd
+	.long	0x107
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x32
+	.string	"ptr"
+	.byte	0xcb
+	.byte	0xb
+	.long	0xc8
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x21
+	.long	.LLRL75
+	.long	0x4816
+	.uleb128 0x2c
+	.string	"mac"
+	.byte	0x1
+	.byte	0xd1
+	.byte	0x28
+	.long	0x4ab9
+	.uleb128 0x8
+	.quad	.LVL250
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LLRL77
+	.long	0x4a2e
+	.uleb128 0x32
+	.string	"mac"
+	.byte	0xde
+	.byte	0x28
+	.long	0x4ab9
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x5f
+	.long	.LASF2146
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x15
+	.long	0x107
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x37
+	.long	0x4b84
+	.quad	.LBI287
+	.value	.LVU668
+	.quad	.LBB287
+	.quad	.LBE287-.LBB287
+	.byte	0xe2
+	.byte	0x17
+	.long	0x4897
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x8
+	.quad	.LVL260
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0x4b84
+	.quad	.LBI289
+	.value	.LVU685
+	.quad	.LBB289
+	.quad	.LBE289-.LBB289
+	.byte	0xea
+	.byte	0x17
+	.long	0x48e8
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x8
+	.quad	.LVL266
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0x4b84
+	.quad	.LBI291
+	.value	.LVU701
+	.quad	.LBB291
+	.quad	.LBE291-.LBB291
+	.byte	0xf2
+	.byte	0x17
+	.long	0x4939
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x8
+	.quad	.LVL271
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.long	0x4b84
+	.quad	.LBI293
+	.value	.LVU720
+	.long	.LLRL83
+	.byte	0x1
+	.byte	0xfb
+	.byte	0x17
+	.long	0x4979
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x8
+	.quad	.LVL278
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL257
+	.long	0x1db0
+	.long	0x4997
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL263
+	.long	0x1db0
+	.long	0x49b5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL268
+	.long	0x1db0
+	.long	0x49d3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL272
+	.long	0x1ce8
+	.long	0x49f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x384
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x834
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL275
+	.long	0x1db0
+	.long	0x4a11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL279
+	.long	0x1ce8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x384
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x834
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	0x4b84
+	.quad	.LBI284
+	.value	.LVU649
+	.quad	.LBB284
+	.quad	.LBE284-.LBB284
+	.byte	0xdc
+	.byte	0xd
+	.long	0x4a7f
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x8
+	.quad	.LVL253
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL244
+	.long	0x1ed3
+	.long	0x4a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL287
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x28
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xccf
+	.uleb128 0x61
+	.long	.LASF2160
+	.byte	0x1
+	.byte	0xc1
+	.byte	0xc
+	.long	0xa0
+	.byte	0x1
+	.long	0x4af8
+	.uleb128 0x44
+	.string	"a"
+	.byte	0xc1
+	.byte	0x23
+	.long	0x1a6
+	.uleb128 0x44
+	.string	"b"
+	.byte	0xc1
+	.byte	0x32
+	.long	0x1a6
+	.uleb128 0x2c
+	.string	"ca"
+	.byte	0x1
+	.byte	0xc3
+	.byte	0x15
+	.long	0x27fd
+	.uleb128 0x2c
+	.string	"cb"
+	.byte	0x1
+	.byte	0xc3
+	.byte	0x1e
+	.long	0x27fd
+	.byte	0
+	.uleb128 0x62
+	.long	.LASF2147
+	.byte	0x1
+	.byte	0xbc
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x63
+	.long	.LASF2148
+	.byte	0x3
+	.byte	0x14
+	.byte	0x1
+	.long	0xc6
+	.byte	0x3
+	.long	0x4b84
+	.uleb128 0x33
+	.long	.LASF2149
+	.byte	0x14
+	.byte	0x16
+	.long	0x1a6
+	.uleb128 0x33
+	.long	.LASF2150
+	.byte	0x14
+	.byte	0x29
+	.long	0x1a6
+	.uleb128 0x33
+	.long	.LASF2151
+	.byte	0x14
+	.byte	0x38
+	.long	0x146
+	.uleb128 0x33
+	.long	.LASF2152
+	.byte	0x14
+	.byte	0x48
+	.long	0x146
+	.uleb128 0x33
+	.long	.LASF2153
+	.byte	0x15
+	.byte	0x11
+	.long	0x180
+	.uleb128 0x2c
+	.string	"__l"
+	.byte	0x3
+	.byte	0x17
+	.byte	0xa
+	.long	0x146
+	.uleb128 0x2c
+	.string	"__u"
+	.byte	0x3
+	.byte	0x17
+	.byte	0xf
+	.long	0x146
+	.uleb128 0x45
+	.long	.LASF2154
+	.byte	0x17
+	.byte	0x14
+	.long	0x146
+	.uleb128 0x2c
+	.string	"__p"
+	.byte	0x3
+	.byte	0x18
+	.byte	0xf
+	.long	0x1a6
+	.uleb128 0x45
+	.long	.LASF2155
+	.byte	0x19
+	.byte	0x7
+	.long	0xa0
+	.byte	0
+	.uleb128 0x64
+	.long	.LASF2156
+	.byte	0x2
+	.value	0x16a
+	.byte	0x2a
+	.long	0xa0
+	.byte	0x3
+	.long	0x4ba4
+	.uleb128 0x26
+	.long	.LASF2157
+	.byte	0x2
+	.value	0x16a
+	.byte	0x3c
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x2d
+	.long	0x2807
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4be8
+	.uleb128 0x7
+	.long	0x2812
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1f
+	.quad	.LVL2
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x2820
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5067
+	.uleb128 0x7
+	.long	0x282b
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x1e
+	.long	0x2838
+	.uleb128 0x1e
+	.long	0x2844
+	.uleb128 0x1e
+	.long	0x2850
+	.uleb128 0x1e
+	.long	0x285c
+	.uleb128 0x1e
+	.long	0x2868
+	.uleb128 0x1e
+	.long	0x2874
+	.uleb128 0xa
+	.long	0x2820
+	.quad	.LBI316
+	.value	.LVU757
+	.long	.LLRL86
+	.value	0x3e4
+	.byte	0xd
+	.long	0x4fdb
+	.uleb128 0x7
+	.long	0x282b
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x2f
+	.long	.LLRL86
+	.uleb128 0x65
+	.long	0x2838
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xf
+	.long	0x2844
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xf
+	.long	0x2850
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0xf
+	.long	0x285c
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0xf
+	.long	0x2868
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0xf
+	.long	0x2874
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI318
+	.value	.LVU764
+	.long	.LLRL93
+	.value	0x3f3
+	.byte	0x5
+	.long	0x4ce7
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.quad	.LVL292
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC55
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI322
+	.value	.LVU792
+	.long	.LLRL95
+	.value	0x418
+	.byte	0x5
+	.long	0x4d2a
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x8
+	.quad	.LVL300
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC59
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	0x28aa
+	.long	.LLRL97
+	.long	0x4e15
+	.uleb128 0xf
+	.long	0x28af
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI327
+	.value	.LVU818
+	.long	.LLRL99
+	.value	0x425
+	.byte	0x9
+	.long	0x4d87
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x8
+	.quad	.LVL311
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL301
+	.long	0x1fff
+	.long	0x4d9f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL304
+	.long	0x1fe9
+	.long	0x4db7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL305
+	.long	0x1fd3
+	.long	0x4dcf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL306
+	.long	0x208c
+	.long	0x4e00
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -116
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x59
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL308
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI332
+	.value	.LVU827
+	.long	.LLRL101
+	.value	0x42a
+	.byte	0x5
+	.long	0x4e58
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0x8
+	.quad	.LVL314
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC62
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.long	0x28bc
+	.long	.LLRL103
+	.long	0x4ec9
+	.uleb128 0xf
+	.long	0x28bd
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x4
+	.quad	.LVL316
+	.long	0x1fb8
+	.long	0x4e8a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL318
+	.long	0x1fa2
+	.long	0x4ea2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL319
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.long	0x2880
+	.quad	.LBB338
+	.quad	.LBE338-.LBB338
+	.long	0x4f5d
+	.uleb128 0xf
+	.long	0x2885
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0xf
+	.long	0x2891
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0xf
+	.long	0x289d
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xc
+	.quad	.LVL324
+	.long	0x2026
+	.uleb128 0x4
+	.quad	.LVL327
+	.long	0x208c
+	.long	0x4f41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL329
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC58
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL291
+	.long	0x208c
+	.long	0x4f7c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC54
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL293
+	.long	0x2043
+	.long	0x4f9a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL294
+	.long	0x208c
+	.long	0x4fb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL297
+	.long	0x2037
+	.uleb128 0xc
+	.quad	.LVL298
+	.long	0x201a
+	.uleb128 0xc
+	.quad	.LVL321
+	.long	0x1f96
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI341
+	.value	.LVU881
+	.long	.LLRL108
+	.value	0x3ee
+	.byte	0x9
+	.long	0x5021
+	.uleb128 0x30
+	.long	0x3187
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC53
+	.byte	0x9f
+	.uleb128 0x1f
+	.quad	.LVL333
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC53
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL289
+	.long	0x206c
+	.long	0x504c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL331
+	.long	0x2065
+	.uleb128 0xc
+	.quad	.LVL332
+	.long	0x205e
+	.byte	0
+	.uleb128 0x2d
+	.long	0x32ba
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5183
+	.uleb128 0x7
+	.long	0x32c5
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0xf
+	.long	0x32d2
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0xf
+	.long	0x32de
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0xd
+	.long	0x4b84
+	.quad	.LBI353
+	.value	.LVU896
+	.quad	.LBB353
+	.quad	.LBE353-.LBB353
+	.value	0x311
+	.byte	0xd
+	.long	0x50fc
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x8
+	.quad	.LVL337
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x32ba
+	.quad	.LBI355
+	.value	.LVU912
+	.long	.LLRL113
+	.value	0x307
+	.byte	0xd
+	.long	0x514f
+	.uleb128 0x7
+	.long	0x32c5
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x2f
+	.long	.LLRL113
+	.uleb128 0x1e
+	.long	0x32d2
+	.uleb128 0x1e
+	.long	0x32de
+	.uleb128 0x1f
+	.quad	.LVL341
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL335
+	.long	0x1ed3
+	.long	0x5168
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL339
+	.long	0x1e1b
+	.uleb128 0xc
+	.quad	.LVL340
+	.long	0x1dfc
+	.byte	0
+	.uleb128 0x2d
+	.long	0x32e9
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5387
+	.uleb128 0x7
+	.long	0x32f4
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x38
+	.long	0x3301
+	.uleb128 0x38
+	.long	0x330d
+	.uleb128 0xf
+	.long	0x3319
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x38
+	.long	0x3325
+	.uleb128 0x38
+	.long	0x3331
+	.uleb128 0xa
+	.long	0x32e9
+	.quad	.LBI365
+	.value	.LVU929
+	.long	.LLRL117
+	.value	0x2d9
+	.byte	0xd
+	.long	0x5372
+	.uleb128 0x7
+	.long	0x32f4
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x2f
+	.long	.LLRL117
+	.uleb128 0xf
+	.long	0x3301
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0xf
+	.long	0x330d
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x1e
+	.long	0x3319
+	.uleb128 0xf
+	.long	0x3325
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0xf
+	.long	0x3331
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0xa
+	.long	0x4b84
+	.quad	.LBI367
+	.value	.LVU937
+	.long	.LLRL123
+	.value	0x2ea
+	.byte	0x1f
+	.long	0x5272
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x8
+	.quad	.LVL349
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x4b84
+	.quad	.LBI372
+	.value	.LVU954
+	.quad	.LBB372
+	.quad	.LBE372-.LBB372
+	.value	0x2ed
+	.byte	0x1f
+	.long	0x52be
+	.uleb128 0x7
+	.long	0x4b96
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x8
+	.quad	.LVL354
+	.long	0x1e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL345
+	.long	0x1de1
+	.long	0x52dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL352
+	.long	0x1de1
+	.long	0x52f9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL359
+	.long	0x208c
+	.long	0x5324
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC70
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x27
+	.quad	.LVL363
+	.long	0x208c
+	.uleb128 0x31
+	.quad	.LVL368
+	.long	0x208c
+	.long	0x5355
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3c
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL371
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC68
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL343
+	.long	0x1ed3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x2c24
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x54cb
+	.uleb128 0x7
+	.long	0x2c2f
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0xf
+	.long	0x2c3c
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0xf
+	.long	0x2c46
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0xf
+	.long	0x2c52
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0xa
+	.long	0x2c24
+	.quad	.LBI391
+	.value	.LVU1022
+	.long	.LLRL130
+	.value	0x38e
+	.byte	0xd
+	.long	0x5456
+	.uleb128 0x7
+	.long	0x2c2f
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x2f
+	.long	.LLRL130
+	.uleb128 0x1e
+	.long	0x2c3c
+	.uleb128 0x1e
+	.long	0x2c46
+	.uleb128 0x1e
+	.long	0x2c52
+	.uleb128 0x67
+	.long	0x317c
+	.quad	.LBI393
+	.value	.LVU1024
+	.long	.LLRL130
+	.byte	0x1
+	.value	0x3a4
+	.byte	0x5
+	.uleb128 0x30
+	.long	0x3187
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC72
+	.byte	0x9f
+	.uleb128 0x1f
+	.quad	.LVL383
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC72
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL374
+	.long	0x1d7a
+	.long	0x5474
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL377
+	.long	0x208c
+	.long	0x5492
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL378
+	.long	0x3013
+	.long	0x54af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL379
+	.long	0x208c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x329a
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x55c8
+	.uleb128 0x7
+	.long	0x32a5
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0xa
+	.long	0x317c
+	.quad	.LBI461
+	.value	.LVU1182
+	.long	.LLRL159
+	.value	0x325
+	.byte	0x5
+	.long	0x5536
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x8
+	.quad	.LVL436
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC77
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x32b3
+	.quad	.LBI465
+	.value	.LVU1190
+	.long	.LLRL161
+	.value	0x328
+	.byte	0x5
+	.long	0x55ba
+	.uleb128 0xd
+	.long	0x317c
+	.quad	.LBI467
+	.value	.LVU1192
+	.quad	.LBB467
+	.quad	.LBE467-.LBB467
+	.value	0x31c
+	.byte	0x5
+	.long	0x559f
+	.uleb128 0x7
+	.long	0x3187
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x8
+	.quad	.LVL438
+	.long	0x1f80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC78
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL439
+	.long	0x1e0a
+	.uleb128 0x27
+	.quad	.LVL440
+	.long	0x1e03
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL437
+	.long	0x1e1b
+	.byte	0
+	.uleb128 0x68
+	.long	.LASF2049
+	.long	.LASF2161
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS217:
+	.uleb128 0
+	.uleb128 .LVU1624
+	.uleb128 .LVU1624
+	.uleb128 .LVU1629
+	.uleb128 .LVU1629
+	.uleb128 .LVU1630
+	.uleb128 .LVU1630
+	.uleb128 .LVU1633
+	.uleb128 .LVU1633
+	.uleb128 0
+.LLST217:
+	.byte	0x6
+	.quad	.LVL578
+	.byte	0x4
+	.uleb128 .LVL578-.LVL578
+	.uleb128 .LVL579-.LVL578
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL579-.LVL578
+	.uleb128 .LVL581-.LVL578
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL581-.LVL578
+	.uleb128 .LVL582-.LVL578
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL582-.LVL578
+	.uleb128 .LVL584-.LVL578
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL584-.LVL578
+	.uleb128 .LFE40-.LVL578
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1368
+	.uleb128 .LVU1388
+	.uleb128 .LVU1391
+	.uleb128 .LVU1404
+	.uleb128 .LVU1467
+	.uleb128 .LVU1471
+	.uleb128 .LVU1508
+	.uleb128 .LVU1514
+	.uleb128 .LVU1533
+	.uleb128 .LVU1537
+	.uleb128 .LVU1611
+	.uleb128 .LVU1617
+.LLST178:
+	.byte	0x6
+	.quad	.LVL511
+	.byte	0x4
+	.uleb128 .LVL511-.LVL511
+	.uleb128 .LVL513-1-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL516-.LVL511
+	.uleb128 .LVL518-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL540-.LVL511
+	.uleb128 .LVL541-1-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL546-.LVL511
+	.uleb128 .LVL547-1-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL551-.LVL511
+	.uleb128 .LVL552-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL576-.LVL511
+	.uleb128 .LVL577-1-.LVL511
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU1410
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 .LVU1432
+	.uleb128 .LVU1432
+	.uleb128 .LVU1437
+	.uleb128 .LVU1437
+	.uleb128 .LVU1444
+	.uleb128 .LVU1444
+	.uleb128 .LVU1455
+	.uleb128 .LVU1479
+	.uleb128 .LVU1507
+	.uleb128 .LVU1507
+	.uleb128 .LVU1508
+	.uleb128 .LVU1543
+	.uleb128 .LVU1551
+	.uleb128 .LVU1617
+	.uleb128 0
+.LLST180:
+	.byte	0x6
+	.quad	.LVL519
+	.byte	0x4
+	.uleb128 .LVL519-.LVL519
+	.uleb128 .LVL520-.LVL519
+	.uleb128 0xa
+	.byte	0x3
+	.quad	cmdTable
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL520-.LVL519
+	.uleb128 .LVL529-.LVL519
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL529-.LVL519
+	.uleb128 .LVL530-.LVL519
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL530-.LVL519
+	.uleb128 .LVL532-.LVL519
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL532-.LVL519
+	.uleb128 .LVL536-.LVL519
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL543-.LVL519
+	.uleb128 .LVL545-.LVL519
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL545-.LVL519
+	.uleb128 .LVL546-.LVL519
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL555-.LVL519
+	.uleb128 .LVL556-.LVL519
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL577-.LVL519
+	.uleb128 .LFE39-.LVL519
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1402
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 .LVU1433
+	.uleb128 .LVU1479
+	.uleb128 .LVU1508
+	.uleb128 .LVU1543
+	.uleb128 .LVU1551
+	.uleb128 .LVU1617
+	.uleb128 0
+.LLST181:
+	.byte	0x6
+	.quad	.LVL517
+	.byte	0x4
+	.uleb128 .LVL517-.LVL517
+	.uleb128 .LVL520-.LVL517
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL520-.LVL517
+	.uleb128 .LVL529-.LVL517
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL543-.LVL517
+	.uleb128 .LVL546-.LVL517
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL555-.LVL517
+	.uleb128 .LVL556-.LVL517
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL577-.LVL517
+	.uleb128 .LFE39-.LVL517
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1402
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 .LVU1418
+	.uleb128 .LVU1420
+	.uleb128 .LVU1422
+	.uleb128 .LVU1422
+	.uleb128 .LVU1467
+	.uleb128 .LVU1479
+	.uleb128 .LVU1508
+	.uleb128 .LVU1543
+	.uleb128 .LVU1551
+	.uleb128 .LVU1617
+	.uleb128 0
+.LLST182:
+	.byte	0x6
+	.quad	.LVL517
+	.byte	0x4
+	.uleb128 .LVL517-.LVL517
+	.uleb128 .LVL520-.LVL517
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL520-.LVL517
+	.uleb128 .LVL524-.LVL517
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL525-.LVL517
+	.uleb128 .LVL527-.LVL517
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL527-.LVL517
+	.uleb128 .LVL540-.LVL517
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL543-.LVL517
+	.uleb128 .LVL546-.LVL517
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL555-.LVL517
+	.uleb128 .LVL556-.LVL517
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL577-.LVL517
+	.uleb128 .LFE39-.LVL517
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1409
+	.uleb128 .LVU1411
+	.uleb128 .LVU1411
+	.uleb128 .LVU1451
+	.uleb128 .LVU1451
+	.uleb128 .LVU1454
+	.uleb128 .LVU1454
+	.uleb128 .LVU1455
+	.uleb128 .LVU1455
+	.uleb128 .LVU1462
+	.uleb128 .LVU1462
+	.uleb128 .LVU1466
+	.uleb128 .LVU1466
+	.uleb128 .LVU1467
+	.uleb128 .LVU1479
+	.uleb128 .LVU1508
+	.uleb128 .LVU1543
+	.uleb128 .LVU1551
+	.uleb128 .LVU1617
+	.uleb128 0
+.LLST183:
+	.byte	0x6
+	.quad	.LVL519
+	.byte	0x4
+	.uleb128 .LVL519-.LVL519
+	.uleb128 .LVL520-.LVL519
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL520-.LVL519
+	.uleb128 .LVL534-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL534-.LVL519
+	.uleb128 .LVL535-.LVL519
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL535-.LVL519
+	.uleb128 .LVL536-.LVL519
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL536-.LVL519
+	.uleb128 .LVL538-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL538-.LVL519
+	.uleb128 .LVL539-.LVL519
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL539-.LVL519
+	.uleb128 .LVL540-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL543-.LVL519
+	.uleb128 .LVL546-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL555-.LVL519
+	.uleb128 .LVL556-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL577-.LVL519
+	.uleb128 .LFE39-.LVL519
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1428
+	.uleb128 .LVU1430
+	.uleb128 .LVU1503
+	.uleb128 .LVU1505
+.LLST185:
+	.byte	0x6
+	.quad	.LVL528
+	.byte	0x4
+	.uleb128 .LVL528-.LVL528
+	.uleb128 .LVL529-.LVL528
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC99
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL544-.LVL528
+	.uleb128 .LVL545-.LVL528
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC99
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1434
+	.uleb128 .LVU1437
+	.uleb128 .LVU1437
+	.uleb128 .LVU1438
+.LLST187:
+	.byte	0x6
+	.quad	.LVL529
+	.byte	0x4
+	.uleb128 .LVL529-.LVL529
+	.uleb128 .LVL530-.LVL529
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL530-.LVL529
+	.uleb128 .LVL531-1-.LVL529
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1440
+	.uleb128 .LVU1442
+.LLST188:
+	.byte	0x8
+	.quad	.LVL531
+	.uleb128 .LVL532-.LVL531
+	.uleb128 0x2
+	.byte	0x39
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1448
+	.uleb128 .LVU1452
+.LLST191:
+	.byte	0x8
+	.quad	.LVL533
+	.uleb128 .LVL535-.LVL533
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC98
+	.byte	0x9f
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU1457
+	.uleb128 .LVU1462
+	.uleb128 .LVU1462
+	.uleb128 .LVU1464
+.LLST193:
+	.byte	0x6
+	.quad	.LVL537
+	.byte	0x4
+	.uleb128 .LVL537-.LVL537
+	.uleb128 .LVL538-.LVL537
+	.uleb128 0x12
+	.byte	0x7f
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x3
+	.quad	cliBuffer
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL538-.LVL537
+	.uleb128 .LVL539-1-.LVL537
+	.uleb128 0x12
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x3
+	.quad	cliBuffer
+	.byte	0x22
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1510
+	.uleb128 .LVU1519
+	.uleb128 .LVU1551
+	.uleb128 .LVU1587
+	.uleb128 .LVU1587
+	.uleb128 .LVU1592
+.LLST199:
+	.byte	0x6
+	.quad	.LVL546
+	.byte	0x4
+	.uleb128 .LVL546-.LVL546
+	.uleb128 .LVL548-.LVL546
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL556-.LVL546
+	.uleb128 .LVL568-.LVL546
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL568-.LVL546
+	.uleb128 .LVL571-.LVL546
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1512
+	.uleb128 .LVU1514
+.LLST200:
+	.byte	0x8
+	.quad	.LVL546
+	.uleb128 .LVL547-.LVL546
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1529
+	.uleb128 .LVU1531
+.LLST201:
+	.byte	0x8
+	.quad	.LVL549
+	.uleb128 .LVL550-.LVL549
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC98
+	.byte	0x9f
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1554
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1587
+.LLST203:
+	.byte	0x6
+	.quad	.LVL557
+	.byte	0x4
+	.uleb128 .LVL557-.LVL557
+	.uleb128 .LVL564-.LVL557
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL566-.LVL557
+	.uleb128 .LVL568-.LVL557
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU1554
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1586
+.LLST204:
+	.byte	0x6
+	.quad	.LVL557
+	.byte	0x4
+	.uleb128 .LVL557-.LVL557
+	.uleb128 .LVL564-.LVL557
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL566-.LVL557
+	.uleb128 .LVL567-.LVL557
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU1560
+	.uleb128 .LVU1563
+	.uleb128 .LVU1563
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1587
+.LLST205:
+	.byte	0x6
+	.quad	.LVL558
+	.byte	0x4
+	.uleb128 .LVL558-.LVL558
+	.uleb128 .LVL559-.LVL558
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL559-.LVL558
+	.uleb128 .LVL564-.LVL558
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL566-.LVL558
+	.uleb128 .LVL568-.LVL558
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU1564
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1587
+.LLST206:
+	.byte	0x6
+	.quad	.LVL560
+	.byte	0x4
+	.uleb128 .LVL560-.LVL560
+	.uleb128 .LVL564-.LVL560
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL566-.LVL560
+	.uleb128 .LVL568-.LVL560
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU1570
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1587
+.LLST207:
+	.byte	0x6
+	.quad	.LVL562
+	.byte	0x4
+	.uleb128 .LVL562-.LVL562
+	.uleb128 .LVL564-.LVL562
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL566-.LVL562
+	.uleb128 .LVL568-.LVL562
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU1565
+	.uleb128 .LVU1570
+.LLST208:
+	.byte	0x8
+	.quad	.LVL560
+	.uleb128 .LVL562-.LVL560
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU1565
+	.uleb128 .LVU1570
+.LLST209:
+	.byte	0x8
+	.quad	.LVL560
+	.uleb128 .LVL562-.LVL560
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+9032
+	.sleb128 0
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1567
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1592
+.LLST210:
+	.byte	0x6
+	.quad	.LVL560
+	.byte	0x4
+	.uleb128 .LVL560-.LVL560
+	.uleb128 .LVL564-.LVL560
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+9032
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL566-.LVL560
+	.uleb128 .LVL571-.LVL560
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+9032
+	.sleb128 0
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU1567
+	.uleb128 .LVU1578
+	.uleb128 .LVU1584
+	.uleb128 .LVU1592
+.LLST211:
+	.byte	0x6
+	.quad	.LVL560
+	.byte	0x4
+	.uleb128 .LVL560-.LVL560
+	.uleb128 .LVL564-.LVL560
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL566-.LVL560
+	.uleb128 .LVL571-.LVL560
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1581
+	.uleb128 .LVU1584
+.LLST212:
+	.byte	0x8
+	.quad	.LVL564
+	.uleb128 .LVL566-.LVL564
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC102
+	.byte	0x9f
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU1384
+	.uleb128 .LVU1388
+.LLST195:
+	.byte	0x8
+	.quad	.LVL512
+	.uleb128 .LVL513-1-.LVL512
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU1469
+	.uleb128 .LVU1471
+.LLST196:
+	.byte	0x8
+	.quad	.LVL540
+	.uleb128 .LVL541-.LVL540
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC100
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1475
+	.uleb128 .LVU1477
+.LLST197:
+	.byte	0x8
+	.quad	.LVL541
+	.uleb128 .LVL542-.LVL541
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC98
+	.byte	0x9f
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1540
+	.uleb128 .LVU1543
+.LLST214:
+	.byte	0x8
+	.quad	.LVL553
+	.uleb128 .LVL555-.LVL553
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC101
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1603
+.LLST215:
+	.byte	0x8
+	.quad	.LVL573
+	.uleb128 .LVL574-.LVL573
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC97
+	.byte	0x9f
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU1607
+	.uleb128 .LVU1609
+.LLST216:
+	.byte	0x8
+	.quad	.LVL574
+	.uleb128 .LVL575-.LVL574
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC98
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL9-1-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL8
+	.uleb128 .LFE36-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU60
+	.uleb128 .LVU67
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU70
+	.uleb128 .LVU88
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.LVL14
+	.uleb128 .LVL23-.LVL14
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.LVL14
+	.uleb128 .LVL25-.LVL14
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL35-.LVL14
+	.uleb128 .LVL36-.LVL14
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL14
+	.uleb128 .LVL42-.LVL14
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL44-.LVL14
+	.uleb128 .LFE36-.LVL14
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU41
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU68
+	.uleb128 .LVU108
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.LVL12
+	.uleb128 .LVL23-.LVL12
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL44-.LVL12
+	.uleb128 .LFE36-.LVL12
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU78
+	.uleb128 .LVU108
+.LLST8:
+	.byte	0x8
+	.quad	.LVL29
+	.uleb128 .LVL44-.LVL29
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+.LLST9:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL32-.LVL31
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU107
+.LLST10:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL36-.LVL35
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL36-.LVL35
+	.uleb128 .LVL43-.LVL35
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU93
+	.uleb128 .LVU106
+.LLST16:
+	.byte	0x8
+	.quad	.LVL37
+	.uleb128 .LVL42-.LVL37
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU58
+	.uleb128 .LVU61
+.LLST12:
+	.byte	0x8
+	.quad	.LVL20
+	.uleb128 .LVL22-.LVL20
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU63
+	.uleb128 .LVU65
+.LLST14:
+	.byte	0x8
+	.quad	.LVL22
+	.uleb128 .LVL23-.LVL22
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC10
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU74
+	.uleb128 .LVU76
+.LLST15:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL29-.LVL28
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 0
+	.uleb128 .LVU1040
+	.uleb128 .LVU1040
+	.uleb128 .LVU1087
+	.uleb128 .LVU1087
+	.uleb128 .LVU1089
+	.uleb128 .LVU1089
+	.uleb128 .LVU1097
+	.uleb128 .LVU1097
+	.uleb128 .LVU1110
+	.uleb128 .LVU1110
+	.uleb128 .LVU1115
+	.uleb128 .LVU1115
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 .LVU1139
+	.uleb128 .LVU1139
+	.uleb128 .LVU1142
+	.uleb128 .LVU1142
+	.uleb128 0
+.LLST132:
+	.byte	0x6
+	.quad	.LVL384
+	.byte	0x4
+	.uleb128 .LVL384-.LVL384
+	.uleb128 .LVL385-1-.LVL384
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL385-1-.LVL384
+	.uleb128 .LVL403-.LVL384
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL403-.LVL384
+	.uleb128 .LVL404-.LVL384
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL404-.LVL384
+	.uleb128 .LVL407-.LVL384
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL407-.LVL384
+	.uleb128 .LVL414-.LVL384
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL414-.LVL384
+	.uleb128 .LVL416-.LVL384
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL416-.LVL384
+	.uleb128 .LVL417-1-.LVL384
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL417-1-.LVL384
+	.uleb128 .LVL417-.LVL384
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL417-.LVL384
+	.uleb128 .LVL422-.LVL384
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL422-.LVL384
+	.uleb128 .LVL424-.LVL384
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL424-.LVL384
+	.uleb128 .LFE34-.LVL384
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU1070
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1082
+	.uleb128 .LVU1096
+	.uleb128 .LVU1097
+	.uleb128 .LVU1117
+	.uleb128 .LVU1140
+	.uleb128 .LVU1142
+	.uleb128 0
+.LLST133:
+	.byte	0x6
+	.quad	.LVL396
+	.byte	0x4
+	.uleb128 .LVL396-.LVL396
+	.uleb128 .LVL397-.LVL396
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL397-.LVL396
+	.uleb128 .LVL401-.LVL396
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL406-.LVL396
+	.uleb128 .LVL407-.LVL396
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL417-.LVL396
+	.uleb128 .LVL423-.LVL396
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL424-.LVL396
+	.uleb128 .LFE34-.LVL396
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU1041
+	.uleb128 .LVU1046
+	.uleb128 .LVU1046
+	.uleb128 .LVU1048
+	.uleb128 .LVU1089
+	.uleb128 .LVU1094
+	.uleb128 .LVU1094
+	.uleb128 .LVU1109
+	.uleb128 .LVU1110
+	.uleb128 .LVU1114
+.LLST134:
+	.byte	0x6
+	.quad	.LVL386
+	.byte	0x4
+	.uleb128 .LVL386-.LVL386
+	.uleb128 .LVL387-1-.LVL386
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL387-1-.LVL386
+	.uleb128 .LVL389-.LVL386
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL404-.LVL386
+	.uleb128 .LVL406-1-.LVL386
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL406-1-.LVL386
+	.uleb128 .LVL413-.LVL386
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL414-.LVL386
+	.uleb128 .LVL415-.LVL386
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1098
+	.uleb128 .LVU1101
+	.uleb128 .LVU1101
+	.uleb128 .LVU1102
+	.uleb128 .LVU1102
+	.uleb128 .LVU1108
+.LLST135:
+	.byte	0x6
+	.quad	.LVL407
+	.byte	0x4
+	.uleb128 .LVL407-.LVL407
+	.uleb128 .LVL409-.LVL407
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL409-.LVL407
+	.uleb128 .LVL410-1-.LVL407
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL410-1-.LVL407
+	.uleb128 .LVL412-.LVL407
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1035
+	.uleb128 .LVU1046
+	.uleb128 .LVU1046
+	.uleb128 .LVU1057
+	.uleb128 .LVU1057
+	.uleb128 .LVU1074
+	.uleb128 .LVU1089
+	.uleb128 .LVU1110
+	.uleb128 .LVU1110
+	.uleb128 .LVU1117
+.LLST136:
+	.byte	0x6
+	.quad	.LVL384
+	.byte	0x4
+	.uleb128 .LVL384-.LVL384
+	.uleb128 .LVL387-.LVL384
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL387-.LVL384
+	.uleb128 .LVL392-.LVL384
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL392-.LVL384
+	.uleb128 .LVL397-.LVL384
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL404-.LVL384
+	.uleb128 .LVL414-.LVL384
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL414-.LVL384
+	.uleb128 .LVL417-1-.LVL384
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU1036
+	.uleb128 .LVU1064
+	.uleb128 .LVU1064
+	.uleb128 .LVU1089
+	.uleb128 .LVU1089
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 0
+.LLST137:
+	.byte	0x6
+	.quad	.LVL384
+	.byte	0x4
+	.uleb128 .LVL384-.LVL384
+	.uleb128 .LVL394-.LVL384
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL394-.LVL384
+	.uleb128 .LVL404-.LVL384
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL404-.LVL384
+	.uleb128 .LVL417-.LVL384
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL417-.LVL384
+	.uleb128 .LFE34-.LVL384
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU1037
+	.uleb128 .LVU1069
+	.uleb128 .LVU1069
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1089
+	.uleb128 .LVU1089
+	.uleb128 .LVU1117
+	.uleb128 .LVU1117
+	.uleb128 0
+.LLST138:
+	.byte	0x6
+	.quad	.LVL384
+	.byte	0x4
+	.uleb128 .LVL384-.LVL384
+	.uleb128 .LVL396-.LVL384
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL396-.LVL384
+	.uleb128 .LVL397-.LVL384
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL397-.LVL384
+	.uleb128 .LVL404-.LVL384
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0x4
+	.uleb128 .LVL404-.LVL384
+	.uleb128 .LVL417-.LVL384
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL417-.LVL384
+	.uleb128 .LFE34-.LVL384
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU1047
+	.uleb128 .LVU1049
+	.uleb128 .LVU1049
+	.uleb128 .LVU1056
+.LLST140:
+	.byte	0x6
+	.quad	.LVL388
+	.byte	0x4
+	.uleb128 .LVL388-.LVL388
+	.uleb128 .LVL390-.LVL388
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL390-.LVL388
+	.uleb128 .LVL392-.LVL388
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU1056
+	.uleb128 .LVU1074
+	.uleb128 .LVU1074
+	.uleb128 .LVU1082
+	.uleb128 .LVU1117
+	.uleb128 0
+.LLST141:
+	.byte	0x6
+	.quad	.LVL392
+	.byte	0x4
+	.uleb128 .LVL392-.LVL392
+	.uleb128 .LVL397-.LVL392
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL397-.LVL392
+	.uleb128 .LVL401-.LVL392
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL417-.LVL392
+	.uleb128 .LFE34-.LVL392
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU1129
+	.uleb128 .LVU1130
+.LLST147:
+	.byte	0x8
+	.quad	.LVL418
+	.uleb128 .LVL419-.LVL418
+	.uleb128 0x2
+	.byte	0x52
+	.byte	0xf0
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU1059
+	.uleb128 .LVU1064
+.LLST143:
+	.byte	0x8
+	.quad	.LVL392
+	.uleb128 .LVL394-.LVL392
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU1083
+	.uleb128 .LVU1085
+.LLST145:
+	.byte	0x8
+	.quad	.LVL401
+	.uleb128 .LVL402-.LVL401
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC72
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU1092
+	.uleb128 .LVU1094
+.LLST148:
+	.byte	0x8
+	.quad	.LVL405
+	.uleb128 .LVL406-.LVL405
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC73
+	.byte	0x9f
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU1103
+	.uleb128 .LVU1105
+.LLST149:
+	.byte	0x8
+	.quad	.LVL410
+	.uleb128 .LVL411-.LVL410
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST23:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL73-.LVL71
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.LVL71
+	.uleb128 .LVL78-.LVL71
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.LVL71
+	.uleb128 .LVL80-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.LVL71
+	.uleb128 .LVL81-.LVL71
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL81-.LVL71
+	.uleb128 .LVL83-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL71
+	.uleb128 .LVL91-.LVL71
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL91-.LVL71
+	.uleb128 .LFE32-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU211
+	.uleb128 .LVU211
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL71
+	.byte	0x4
+	.uleb128 .LVL71-.LVL71
+	.uleb128 .LVL72-.LVL71
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL72-.LVL71
+	.uleb128 .LVL79-.LVL71
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL79-.LVL71
+	.uleb128 .LVL80-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.LVL71
+	.uleb128 .LVL82-.LVL71
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL82-.LVL71
+	.uleb128 .LVL83-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.LVL71
+	.uleb128 .LVL86-.LVL71
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL86-.LVL71
+	.uleb128 .LFE32-.LVL71
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU195
+	.uleb128 .LVU199
+	.uleb128 .LVU213
+	.uleb128 .LVU214
+.LLST25:
+	.byte	0x6
+	.quad	.LVL75
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL76-.LVL75
+	.uleb128 0x3
+	.byte	0x50
+	.byte	0x93
+	.uleb128 0x4
+	.byte	0x4
+	.uleb128 .LVL83-.LVL75
+	.uleb128 .LVL84-1-.LVL75
+	.uleb128 0x2
+	.byte	0x50
+	.byte	0xf0
+	.byte	0
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU1206
+	.uleb128 .LVU1206
+	.uleb128 0
+.LLST163:
+	.byte	0x6
+	.quad	.LVL441
+	.byte	0x4
+	.uleb128 .LVL441-.LVL441
+	.uleb128 .LVL442-.LVL441
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL442-.LVL441
+	.uleb128 .LFE29-.LVL441
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1202
+	.uleb128 .LVU1207
+.LLST165:
+	.byte	0x8
+	.quad	.LVL441
+	.uleb128 .LVL443-.LVL441
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC79
+	.byte	0x9f
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU1212
+	.uleb128 .LVU1214
+.LLST167:
+	.byte	0x8
+	.quad	.LVL444
+	.uleb128 .LVL445-.LVL444
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC78
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU156
+	.uleb128 .LVU156
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL47
+	.byte	0x4
+	.uleb128 .LVL47-.LVL47
+	.uleb128 .LVL48-1-.LVL47
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-1-.LVL47
+	.uleb128 .LVL57-.LVL47
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL57-.LVL47
+	.uleb128 .LVL58-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL47
+	.uleb128 .LVL61-.LVL47
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL61-.LVL47
+	.uleb128 .LVL62-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.LVL47
+	.uleb128 .LVL64-.LVL47
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL64-.LVL47
+	.uleb128 .LVL65-.LVL47
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.LVL47
+	.uleb128 .LFE24-.LVL47
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU132
+	.uleb128 .LVU134
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU144
+	.uleb128 .LVU174
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU180
+.LLST18:
+	.byte	0x6
+	.quad	.LVL50
+	.byte	0x4
+	.uleb128 .LVL50-.LVL50
+	.uleb128 .LVL50-.LVL50
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL50-.LVL50
+	.uleb128 .LVL51-.LVL50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL50
+	.uleb128 .LVL54-.LVL50
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL54-.LVL50
+	.uleb128 .LVL55-.LVL50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.LVL50
+	.uleb128 .LVL67-.LVL50
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.LVL50
+	.uleb128 .LVL68-.LVL50
+	.uleb128 0xf
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	mixerNames+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.LVL50
+	.uleb128 .LVL69-.LVL50
+	.uleb128 0xf
+	.byte	0x76
+	.sleb128 0
+	.byte	0x3
+	.quad	mixerNames+16
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU121
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU145
+	.uleb128 .LVU148
+	.uleb128 .LVU153
+	.uleb128 .LVU156
+	.uleb128 .LVU159
+	.uleb128 .LVU169
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL48
+	.byte	0x4
+	.uleb128 .LVL48-.LVL48
+	.uleb128 .LVL49-1-.LVL48
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL49-1-.LVL48
+	.uleb128 .LVL56-.LVL48
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL58-.LVL48
+	.uleb128 .LVL60-.LVL48
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL62-.LVL48
+	.uleb128 .LVL63-.LVL48
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.LVL48
+	.uleb128 .LFE24-.LVL48
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST21:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL59-.LVL58
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC19
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+.LLST22:
+	.byte	0x8
+	.quad	.LVL65
+	.uleb128 .LVL66-.LVL65
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC18
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU257
+	.uleb128 .LVU257
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 0
+.LLST30:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL102-1-.LVL101
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL102-1-.LVL101
+	.uleb128 .LVL111-.LVL101
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL111-.LVL101
+	.uleb128 .LVL112-.LVL101
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -9
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.LVL101
+	.uleb128 .LVL113-.LVL101
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.LVL101
+	.uleb128 .LVL121-.LVL101
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL121-.LVL101
+	.uleb128 .LFE23-.LVL101
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU257
+	.uleb128 .LVU260
+.LLST31:
+	.byte	0x8
+	.quad	.LVL102
+	.uleb128 .LVL103-1-.LVL102
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU261
+	.uleb128 .LVU270
+	.uleb128 .LVU273
+	.uleb128 .LVU284
+	.uleb128 .LVU286
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU290
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+	.uleb128 .LVU299
+	.uleb128 .LVU303
+.LLST32:
+	.byte	0x6
+	.quad	.LVL104
+	.byte	0x4
+	.uleb128 .LVL104-.LVL104
+	.uleb128 .LVL105-.LVL104
+	.uleb128 0x6
+	.byte	0x71
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.LVL104
+	.uleb128 .LVL111-.LVL104
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x20
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.LVL104
+	.uleb128 .LVL113-.LVL104
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 0
+	.byte	0x20
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL113-.LVL104
+	.uleb128 .LVL114-.LVL104
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL116-.LVL104
+	.uleb128 .LVL117-.LVL104
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL117-.LVL104
+	.uleb128 .LVL118-.LVL104
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU266
+	.uleb128 .LVU270
+	.uleb128 .LVU270
+	.uleb128 .LVU271
+.LLST34:
+	.byte	0x6
+	.quad	.LVL104
+	.byte	0x4
+	.uleb128 .LVL104-.LVL104
+	.uleb128 .LVL105-.LVL104
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x6
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL105-.LVL104
+	.uleb128 .LVL106-.LVL104
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x6
+	.byte	0x22
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU279
+	.uleb128 .LVU286
+.LLST36:
+	.byte	0x8
+	.quad	.LVL110
+	.uleb128 .LVL113-.LVL110
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC26
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU293
+	.uleb128 .LVU295
+.LLST38:
+	.byte	0x8
+	.quad	.LVL115
+	.uleb128 .LVL116-.LVL115
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC27
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LFE22-.LVL3
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU6
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU22
+.LLST2:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL5-.LVL3
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.LVL3
+	.uleb128 .LVL6-.LVL3
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	cmdTable
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x48
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.LVL3
+	.uleb128 .LVL7-.LVL3
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	cmdTable+24
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x48
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU8
+	.uleb128 .LVU15
+.LLST4:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL5-.LVL3
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC1
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU363
+	.uleb128 .LVU365
+	.uleb128 .LVU382
+	.uleb128 .LVU382
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 0
+.LLST39:
+	.byte	0x6
+	.quad	.LVL122
+	.byte	0x4
+	.uleb128 .LVL122-.LVL122
+	.uleb128 .LVL123-1-.LVL122
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL123-1-.LVL122
+	.uleb128 .LVL137-.LVL122
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL139-.LVL122
+	.uleb128 .LVL145-.LVL122
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL145-.LVL122
+	.uleb128 .LVL146-.LVL122
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.LVL122
+	.uleb128 .LVL150-.LVL122
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL150-.LVL122
+	.uleb128 .LVL156-.LVL122
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL156-.LVL122
+	.uleb128 .LFE21-.LVL122
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 .LVU339
+	.uleb128 .LVU341
+	.uleb128 .LVU362
+	.uleb128 .LVU372
+	.uleb128 .LVU374
+	.uleb128 .LVU374
+	.uleb128 .LVU376
+	.uleb128 .LVU376
+	.uleb128 .LVU378
+	.uleb128 .LVU398
+	.uleb128 .LVU400
+	.uleb128 .LVU400
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU404
+	.uleb128 .LVU406
+	.uleb128 .LVU409
+	.uleb128 .LVU419
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 0
+.LLST40:
+	.byte	0x6
+	.quad	.LVL128
+	.byte	0x4
+	.uleb128 .LVL128-.LVL128
+	.uleb128 .LVL129-.LVL128
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL129-.LVL128
+	.uleb128 .LVL129-.LVL128
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL129-.LVL128
+	.uleb128 .LVL130-.LVL128
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.LVL128
+	.uleb128 .LVL136-.LVL128
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL141-.LVL128
+	.uleb128 .LVL142-.LVL128
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.LVL128
+	.uleb128 .LVL143-.LVL128
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	featureNames+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL128
+	.uleb128 .LVL144-.LVL128
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	featureNames+16
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL151-.LVL128
+	.uleb128 .LVL152-.LVL128
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL128
+	.uleb128 .LVL152-.LVL128
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL152-.LVL128
+	.uleb128 .LVL153-.LVL128
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.LVL128
+	.uleb128 .LVL156-.LVL128
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL159-.LVL128
+	.uleb128 .LVL160-1-.LVL128
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL160-1-.LVL128
+	.uleb128 .LVL162-.LVL128
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL162-.LVL128
+	.uleb128 .LFE21-.LVL128
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU320
+	.uleb128 .LVU331
+	.uleb128 .LVU365
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU382
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU412
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 .LVU419
+.LLST41:
+	.byte	0x6
+	.quad	.LVL124
+	.byte	0x4
+	.uleb128 .LVL124-.LVL124
+	.uleb128 .LVL128-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL139-.LVL124
+	.uleb128 .LVL140-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL140-.LVL124
+	.uleb128 .LVL145-.LVL124
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL147-.LVL124
+	.uleb128 .LVL149-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL157-.LVL124
+	.uleb128 .LVL158-.LVL124
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL158-.LVL124
+	.uleb128 .LVL159-.LVL124
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU345
+	.uleb128 .LVU362
+	.uleb128 .LVU388
+	.uleb128 .LVU396
+	.uleb128 .LVU396
+	.uleb128 .LVU409
+	.uleb128 .LVU419
+	.uleb128 .LVU420
+	.uleb128 .LVU420
+	.uleb128 .LVU424
+	.uleb128 .LVU424
+	.uleb128 0
+.LLST42:
+	.byte	0x6
+	.quad	.LVL125
+	.byte	0x4
+	.uleb128 .LVL125-.LVL125
+	.uleb128 .LVL126-1-.LVL125
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-.LVL125
+	.uleb128 .LVL136-.LVL125
+	.uleb128 0x5
+	.byte	0x31
+	.byte	0x73
+	.sleb128 0
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.LVL125
+	.uleb128 .LVL151-1-.LVL125
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL151-1-.LVL125
+	.uleb128 .LVL156-.LVL125
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL159-.LVL125
+	.uleb128 .LVL160-1-.LVL125
+	.uleb128 0x5
+	.byte	0x31
+	.byte	0x72
+	.sleb128 0
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL160-1-.LVL125
+	.uleb128 .LVL162-.LVL125
+	.uleb128 0x5
+	.byte	0x31
+	.byte	0x73
+	.sleb128 0
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.LVL125
+	.uleb128 .LFE21-.LVL125
+	.uleb128 0x5
+	.byte	0x31
+	.byte	0x72
+	.sleb128 0
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU328
+	.uleb128 .LVU331
+	.uleb128 .LVU331
+	.uleb128 .LVU364
+	.uleb128 .LVU409
+	.uleb128 .LVU412
+	.uleb128 .LVU412
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU419
+	.uleb128 .LVU419
+	.uleb128 0
+.LLST44:
+	.byte	0x6
+	.quad	.LVL127
+	.byte	0x4
+	.uleb128 .LVL127-.LVL127
+	.uleb128 .LVL128-.LVL127
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.LVL127
+	.uleb128 .LVL138-.LVL127
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL156-.LVL127
+	.uleb128 .LVL157-.LVL127
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL127
+	.uleb128 .LVL157-.LVL127
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL157-.LVL127
+	.uleb128 .LVL159-.LVL127
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.LVL127
+	.uleb128 .LFE21-.LVL127
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU355
+	.uleb128 .LVU357
+.LLST45:
+	.byte	0x8
+	.quad	.LVL134
+	.uleb128 .LVL135-.LVL134
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC35
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU410
+	.uleb128 .LVU412
+.LLST47:
+	.byte	0x8
+	.quad	.LVL156
+	.uleb128 .LVL157-.LVL156
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC32
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU421
+	.uleb128 .LVU424
+.LLST48:
+	.byte	0x8
+	.quad	.LVL160
+	.uleb128 .LVL162-.LVL160
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC36
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU367
+	.uleb128 .LVU370
+.LLST49:
+	.byte	0x8
+	.quad	.LVL139
+	.uleb128 .LVL141-.LVL139
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC31
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+.LLST50:
+	.byte	0x8
+	.quad	.LVL145
+	.uleb128 .LVL146-.LVL145
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU390
+	.uleb128 .LVU396
+.LLST52:
+	.byte	0x8
+	.quad	.LVL148
+	.uleb128 .LVL151-.LVL148
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC30
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 0
+	.uleb128 .LVU1152
+	.uleb128 .LVU1152
+	.uleb128 0
+.LLST150:
+	.byte	0x6
+	.quad	.LVL425
+	.byte	0x4
+	.uleb128 .LVL425-.LVL425
+	.uleb128 .LVL426-.LVL425
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL426-.LVL425
+	.uleb128 .LFE20-.LVL425
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1148
+	.uleb128 .LVU1153
+.LLST152:
+	.byte	0x8
+	.quad	.LVL425
+	.uleb128 .LVL427-.LVL425
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC76
+	.byte	0x9f
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU1162
+	.uleb128 0
+.LLST154:
+	.byte	0x8
+	.quad	.LVL428
+	.uleb128 .LFE20-.LVL428
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU1165
+	.uleb128 .LVU1167
+.LLST155:
+	.byte	0x8
+	.quad	.LVL428
+	.uleb128 .LVL429-.LVL428
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC77
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1172
+	.uleb128 .LVU1174
+.LLST157:
+	.byte	0x8
+	.quad	.LVL430
+	.uleb128 .LVL431-.LVL430
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC78
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 0
+	.uleb128 .LVU1230
+	.uleb128 .LVU1230
+	.uleb128 .LVU1235
+	.uleb128 .LVU1235
+	.uleb128 .LVU1245
+	.uleb128 .LVU1245
+	.uleb128 .LVU1263
+	.uleb128 .LVU1263
+	.uleb128 0
+.LLST168:
+	.byte	0x6
+	.quad	.LVL448
+	.byte	0x4
+	.uleb128 .LVL448-.LVL448
+	.uleb128 .LVL449-1-.LVL448
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL449-1-.LVL448
+	.uleb128 .LVL452-.LVL448
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL452-.LVL448
+	.uleb128 .LVL460-.LVL448
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL460-.LVL448
+	.uleb128 .LVL466-.LVL448
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL466-.LVL448
+	.uleb128 .LFE18-.LVL448
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU1266
+	.uleb128 .LVU1279
+	.uleb128 .LVU1279
+	.uleb128 .LVU1280
+	.uleb128 .LVU1280
+	.uleb128 .LVU1284
+	.uleb128 .LVU1284
+	.uleb128 .LVU1290
+	.uleb128 .LVU1290
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1301
+	.uleb128 .LVU1301
+	.uleb128 .LVU1302
+	.uleb128 .LVU1309
+	.uleb128 .LVU1310
+	.uleb128 .LVU1310
+	.uleb128 .LVU1312
+	.uleb128 .LVU1312
+	.uleb128 .LVU1314
+	.uleb128 .LVU1320
+	.uleb128 .LVU1321
+	.uleb128 .LVU1321
+	.uleb128 .LVU1324
+	.uleb128 .LVU1326
+	.uleb128 .LVU1330
+	.uleb128 .LVU1338
+	.uleb128 .LVU1340
+	.uleb128 .LVU1340
+	.uleb128 .LVU1343
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST169:
+	.byte	0x6
+	.quad	.LVL467
+	.byte	0x4
+	.uleb128 .LVL467-.LVL467
+	.uleb128 .LVL475-.LVL467
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL475-.LVL467
+	.uleb128 .LVL476-.LVL467
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL476-.LVL467
+	.uleb128 .LVL477-.LVL467
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL477-.LVL467
+	.uleb128 .LVL478-.LVL467
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL478-.LVL467
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 .LVL484-.LVL467
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL484-.LVL467
+	.uleb128 .LVL485-.LVL467
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL489-.LVL467
+	.uleb128 .LVL489-.LVL467
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL489-.LVL467
+	.uleb128 .LVL490-.LVL467
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	featureNames+8
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL490-.LVL467
+	.uleb128 .LVL491-.LVL467
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	featureNames+16
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL492-.LVL467
+	.uleb128 .LVL492-.LVL467
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL492-.LVL467
+	.uleb128 .LVL493-.LVL467
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL494-.LVL467
+	.uleb128 .LVL495-.LVL467
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL497-.LVL467
+	.uleb128 .LVL498-.LVL467
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL498-.LVL467
+	.uleb128 .LVL499-.LVL467
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL506-.LVL467
+	.uleb128 .LFE18-.LVL467
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU1266
+	.uleb128 .LVU1280
+	.uleb128 .LVU1291
+	.uleb128 .LVU1302
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST170:
+	.byte	0x6
+	.quad	.LVL467
+	.byte	0x4
+	.uleb128 .LVL467-.LVL467
+	.uleb128 .LVL476-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x4
+	.uleb128 .LVL478-.LVL467
+	.uleb128 .LVL485-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0x4
+	.uleb128 .LVL506-.LVL467
+	.uleb128 .LFE18-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU1266
+	.uleb128 .LVU1280
+	.uleb128 .LVU1293
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1302
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST171:
+	.byte	0x6
+	.quad	.LVL467
+	.byte	0x4
+	.uleb128 .LVL467-.LVL467
+	.uleb128 .LVL476-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL479-.LVL467
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 .LVL485-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x4
+	.uleb128 .LVL506-.LVL467
+	.uleb128 .LFE18-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU1266
+	.uleb128 .LVU1280
+	.uleb128 .LVU1295
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1302
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST172:
+	.byte	0x6
+	.quad	.LVL467
+	.byte	0x4
+	.uleb128 .LVL467-.LVL467
+	.uleb128 .LVL476-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL480-.LVL467
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 .LVL485-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0x4
+	.uleb128 .LVL506-.LVL467
+	.uleb128 .LFE18-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1266
+	.uleb128 .LVU1280
+	.uleb128 .LVU1297
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1302
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST173:
+	.byte	0x6
+	.quad	.LVL467
+	.byte	0x4
+	.uleb128 .LVL467-.LVL467
+	.uleb128 .LVL476-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL481-.LVL467
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL482-1-.LVL467
+	.uleb128 .LVL485-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x4
+	.uleb128 .LVL506-.LVL467
+	.uleb128 .LFE18-.LVL467
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1308
+	.uleb128 .LVU1310
+	.uleb128 .LVU1310
+	.uleb128 .LVU1356
+.LLST174:
+	.byte	0x6
+	.quad	.LVL489
+	.byte	0x4
+	.uleb128 .LVL489-.LVL489
+	.uleb128 .LVL489-.LVL489
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL489-.LVL489
+	.uleb128 .LVL505-.LVL489
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU1225
+	.uleb128 .LVU1232
+	.uleb128 .LVU1232
+	.uleb128 .LVU1235
+	.uleb128 .LVU1245
+	.uleb128 .LVU1354
+	.uleb128 .LVU1357
+	.uleb128 0
+.LLST175:
+	.byte	0x6
+	.quad	.LVL448
+	.byte	0x4
+	.uleb128 .LVL448-.LVL448
+	.uleb128 .LVL450-.LVL448
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL450-.LVL448
+	.uleb128 .LVL452-.LVL448
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL460-.LVL448
+	.uleb128 .LVL504-.LVL448
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL506-.LVL448
+	.uleb128 .LFE18-.LVL448
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1248
+	.uleb128 .LVU1251
+.LLST176:
+	.byte	0x8
+	.quad	.LVL461
+	.uleb128 .LVL462-.LVL461
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU233
+	.uleb128 .LVU233
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST26:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL93-.LVL92
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL93-.LVL92
+	.uleb128 .LVL99-.LVL92
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL99-.LVL92
+	.uleb128 .LVL100-.LVL92
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.LVL92
+	.uleb128 .LFE17-.LVL92
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU227
+	.uleb128 .LVU233
+	.uleb128 .LVU249
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL93-.LVL92
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.LVL92
+	.uleb128 .LFE17-.LVL92
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU240
+	.uleb128 .LVU242
+.LLST29:
+	.byte	0x8
+	.quad	.LVL95
+	.uleb128 .LVL96-.LVL95
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU431
+	.uleb128 .LVU431
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU564
+	.uleb128 .LVU564
+	.uleb128 .LVU571
+	.uleb128 .LVU571
+	.uleb128 .LVU601
+	.uleb128 .LVU601
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST53:
+	.byte	0x6
+	.quad	.LVL163
+	.byte	0x4
+	.uleb128 .LVL163-.LVL163
+	.uleb128 .LVL164-1-.LVL163
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL164-1-.LVL163
+	.uleb128 .LVL171-.LVL163
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL171-.LVL163
+	.uleb128 .LVL218-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.LVL163
+	.uleb128 .LVL221-.LVL163
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL221-.LVL163
+	.uleb128 .LVL233-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.LVL163
+	.uleb128 .LVL237-.LVL163
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL237-.LVL163
+	.uleb128 .LVL239-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.LVL163
+	.uleb128 .LVL240-.LVL163
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL240-.LVL163
+	.uleb128 .LVL242-.LVL163
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL242-.LVL163
+	.uleb128 .LFE16-.LVL163
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU496
+	.uleb128 .LVU509
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU525
+	.uleb128 .LVU525
+	.uleb128 .LVU526
+	.uleb128 .LVU526
+	.uleb128 .LVU528
+	.uleb128 .LVU545
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 .LVU554
+	.uleb128 .LVU554
+	.uleb128 .LVU557
+	.uleb128 .LVU576
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU581
+	.uleb128 .LVU583
+	.uleb128 .LVU591
+	.uleb128 .LVU608
+	.uleb128 .LVU612
+	.uleb128 .LVU612
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 .LVU618
+.LLST54:
+	.byte	0x6
+	.quad	.LVL168
+	.byte	0x4
+	.uleb128 .LVL168-.LVL168
+	.uleb128 .LVL169-.LVL168
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL169-.LVL168
+	.uleb128 .LVL191-.LVL168
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL194-.LVL168
+	.uleb128 .LVL195-.LVL168
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL168
+	.uleb128 .LVL196-.LVL168
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL196-.LVL168
+	.uleb128 .LVL205-.LVL168
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL205-.LVL168
+	.uleb128 .LVL206-.LVL168
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL206-.LVL168
+	.uleb128 .LVL207-.LVL168
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL168
+	.uleb128 .LVL212-.LVL168
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL212-.LVL168
+	.uleb128 .LVL214-.LVL168
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x60
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.LVL168
+	.uleb128 .LVL215-.LVL168
+	.uleb128 0xa
+	.byte	0x73
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x5c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.LVL168
+	.uleb128 .LVL223-.LVL168
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL223-.LVL168
+	.uleb128 .LVL223-.LVL168
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL223-.LVL168
+	.uleb128 .LVL224-.LVL168
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.LVL168
+	.uleb128 .LVL230-.LVL168
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL237-.LVL168
+	.uleb128 .LVL238-.LVL168
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL238-.LVL168
+	.uleb128 .LVL239-.LVL168
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.LVL168
+	.uleb128 .LVL241-.LVL168
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU432
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU498
+	.uleb128 .LVU498
+	.uleb128 .LVU500
+	.uleb128 .LVU564
+	.uleb128 .LVU591
+	.uleb128 .LVU597
+	.uleb128 .LVU608
+	.uleb128 .LVU613
+	.uleb128 0
+.LLST55:
+	.byte	0x6
+	.quad	.LVL164
+	.byte	0x4
+	.uleb128 .LVL164-.LVL164
+	.uleb128 .LVL174-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.LVL164
+	.uleb128 .LVL178-.LVL164
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL178-.LVL164
+	.uleb128 .LVL180-.LVL164
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL180-.LVL164
+	.uleb128 .LVL184-.LVL164
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL184-.LVL164
+	.uleb128 .LVL186-.LVL164
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL186-.LVL164
+	.uleb128 .LVL192-.LVL164
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL192-.LVL164
+	.uleb128 .LVL193-.LVL164
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL218-.LVL164
+	.uleb128 .LVL230-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL232-.LVL164
+	.uleb128 .LVL237-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.LVL164
+	.uleb128 .LFE16-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU433
+	.uleb128 .LVU511
+	.uleb128 .LVU511
+	.uleb128 .LVU540
+	.uleb128 .LVU564
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 .LVU613
+	.uleb128 .LVU613
+	.uleb128 0
+.LLST56:
+	.byte	0x6
+	.quad	.LVL164
+	.byte	0x4
+	.uleb128 .LVL164-.LVL164
+	.uleb128 .LVL195-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.LVL164
+	.uleb128 .LVL211-.LVL164
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL218-.LVL164
+	.uleb128 .LVL237-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.LVL164
+	.uleb128 .LVL239-.LVL164
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL239-.LVL164
+	.uleb128 .LFE16-.LVL164
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU438
+	.uleb128 .LVU442
+	.uleb128 .LVU575
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU591
+	.uleb128 .LVU597
+	.uleb128 .LVU601
+	.uleb128 .LVU620
+	.uleb128 0
+.LLST57:
+	.byte	0x6
+	.quad	.LVL164
+	.byte	0x4
+	.uleb128 .LVL164-.LVL164
+	.uleb128 .LVL165-1-.LVL164
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL222-.LVL164
+	.uleb128 .LVL223-.LVL164
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL223-.LVL164
+	.uleb128 .LVL230-.LVL164
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL232-.LVL164
+	.uleb128 .LVL233-.LVL164
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL242-.LVL164
+	.uleb128 .LFE16-.LVL164
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU447
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU473
+	.uleb128 .LVU473
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU483
+	.uleb128 .LVU483
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+	.uleb128 .LVU566
+	.uleb128 .LVU570
+	.uleb128 .LVU570
+	.uleb128 .LVU587
+	.uleb128 .LVU597
+	.uleb128 .LVU601
+	.uleb128 .LVU613
+	.uleb128 .LVU617
+	.uleb128 .LVU617
+	.uleb128 .LVU620
+.LLST58:
+	.byte	0x6
+	.quad	.LVL167
+	.byte	0x4
+	.uleb128 .LVL167-.LVL167
+	.uleb128 .LVL171-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL171-.LVL167
+	.uleb128 .LVL172-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL172-.LVL167
+	.uleb128 .LVL176-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL176-.LVL167
+	.uleb128 .LVL177-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL177-.LVL167
+	.uleb128 .LVL182-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL182-.LVL167
+	.uleb128 .LVL183-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL183-.LVL167
+	.uleb128 .LVL187-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL187-.LVL167
+	.uleb128 .LVL188-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.LVL167
+	.uleb128 .LVL189-.LVL167
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL189-.LVL167
+	.uleb128 .LVL190-1-.LVL167
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.LVL167
+	.uleb128 .LVL220-.LVL167
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL220-.LVL167
+	.uleb128 .LVL227-.LVL167
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL232-.LVL167
+	.uleb128 .LVL233-.LVL167
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL239-.LVL167
+	.uleb128 .LVL240-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL240-.LVL167
+	.uleb128 .LVL242-.LVL167
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU448
+	.uleb128 .LVU451
+.LLST59:
+	.byte	0x8
+	.quad	.LVL167
+	.uleb128 .LVL168-.LVL167
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU501
+	.uleb128 .LVU507
+.LLST61:
+	.byte	0x8
+	.quad	.LVL193
+	.uleb128 .LVL194-.LVL193
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC40
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU538
+	.uleb128 .LVU543
+.LLST63:
+	.byte	0x8
+	.quad	.LVL210
+	.uleb128 .LVL212-.LVL210
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC43
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU551
+	.uleb128 .LVU555
+.LLST65:
+	.byte	0x8
+	.quad	.LVL213
+	.uleb128 .LVL215-1-.LVL213
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU559
+	.uleb128 .LVU561
+.LLST66:
+	.byte	0x8
+	.quad	.LVL216
+	.uleb128 .LVL217-.LVL216
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU592
+	.uleb128 .LVU594
+.LLST68:
+	.byte	0x8
+	.quad	.LVL230
+	.uleb128 .LVL231-.LVL230
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC49
+	.byte	0x9f
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU599
+	.uleb128 .LVU601
+.LLST69:
+	.byte	0x8
+	.quad	.LVL232
+	.uleb128 .LVL233-.LVL232
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC19
+	.byte	0x9f
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU628
+	.uleb128 .LVU628
+	.uleb128 .LVU631
+	.uleb128 .LVU631
+	.uleb128 .LVU647
+	.uleb128 .LVU647
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 0
+.LLST70:
+	.byte	0x6
+	.quad	.LVL243
+	.byte	0x4
+	.uleb128 .LVL243-.LVL243
+	.uleb128 .LVL244-1-.LVL243
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL244-1-.LVL243
+	.uleb128 .LVL245-.LVL243
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL245-.LVL243
+	.uleb128 .LVL252-.LVL243
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL243
+	.uleb128 .LVL258-.LVL243
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL258-.LVL243
+	.uleb128 .LVL284-.LVL243
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL284-.LVL243
+	.uleb128 .LVL286-.LVL243
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL286-.LVL243
+	.uleb128 .LFE15-.LVL243
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU632
+	.uleb128 .LVU641
+	.uleb128 .LVU641
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU646
+	.uleb128 .LVU653
+	.uleb128 .LVU663
+	.uleb128 .LVU741
+	.uleb128 .LVU745
+.LLST71:
+	.byte	0x6
+	.quad	.LVL246
+	.byte	0x4
+	.uleb128 .LVL246-.LVL246
+	.uleb128 .LVL249-.LVL246
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL249-.LVL246
+	.uleb128 .LVL250-1-.LVL246
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL250-1-.LVL246
+	.uleb128 .LVL250-.LVL246
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.LVL246
+	.uleb128 .LVL251-.LVL246
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL254-.LVL246
+	.uleb128 .LVL257-1-.LVL246
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL284-.LVL246
+	.uleb128 .LVL285-.LVL246
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU623
+	.uleb128 .LVU646
+	.uleb128 .LVU647
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU679
+	.uleb128 .LVU688
+	.uleb128 .LVU695
+	.uleb128 .LVU704
+	.uleb128 .LVU707
+	.uleb128 .LVU709
+	.uleb128 .LVU715
+	.uleb128 .LVU724
+	.uleb128 .LVU727
+	.uleb128 .LVU729
+	.uleb128 .LVU736
+	.uleb128 .LVU741
+	.uleb128 0
+.LLST72:
+	.byte	0x6
+	.quad	.LVL243
+	.byte	0x4
+	.uleb128 .LVL243-.LVL243
+	.uleb128 .LVL251-.LVL243
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.LVL243
+	.uleb128 .LVL260-.LVL243
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL260-.LVL243
+	.uleb128 .LVL262-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.LVL243
+	.uleb128 .LVL267-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL271-.LVL243
+	.uleb128 .LVL272-1-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL273-.LVL243
+	.uleb128 .LVL274-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL278-.LVL243
+	.uleb128 .LVL279-1-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL280-.LVL243
+	.uleb128 .LVL282-.LVL243
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL284-.LVL243
+	.uleb128 .LFE15-.LVL243
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU628
+	.uleb128 .LVU632
+	.uleb128 .LVU647
+	.uleb128 .LVU652
+.LLST73:
+	.byte	0x6
+	.quad	.LVL244
+	.byte	0x4
+	.uleb128 .LVL244-.LVL244
+	.uleb128 .LVL246-.LVL244
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL252-.LVL244
+	.uleb128 .LVL253-1-.LVL244
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU648
+	.uleb128 .LVU649
+	.uleb128 .LVU649
+	.uleb128 .LVU658
+	.uleb128 .LVU658
+	.uleb128 .LVU663
+	.uleb128 .LVU663
+	.uleb128 .LVU664
+	.uleb128 .LVU664
+	.uleb128 .LVU668
+	.uleb128 .LVU668
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU685
+	.uleb128 .LVU685
+	.uleb128 .LVU697
+	.uleb128 .LVU697
+	.uleb128 .LVU701
+	.uleb128 .LVU701
+	.uleb128 .LVU717
+	.uleb128 .LVU717
+	.uleb128 .LVU720
+	.uleb128 .LVU720
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU724
+	.uleb128 .LVU739
+	.uleb128 .LVU741
+	.uleb128 .LVU741
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 0
+.LLST74:
+	.byte	0x6
+	.quad	.LVL252
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL252-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL252-.LVL252
+	.uleb128 .LVL255-.LVL252
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.LVL252
+	.uleb128 .LVL257-1-.LVL252
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL257-1-.LVL252
+	.uleb128 .LVL258-.LVL252
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL258-.LVL252
+	.uleb128 .LVL259-.LVL252
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL259-.LVL252
+	.uleb128 .LVL264-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL264-.LVL252
+	.uleb128 .LVL265-.LVL252
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-.LVL252
+	.uleb128 .LVL269-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL269-.LVL252
+	.uleb128 .LVL270-.LVL252
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL270-.LVL252
+	.uleb128 .LVL275-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL275-.LVL252
+	.uleb128 .LVL276-.LVL252
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL276-.LVL252
+	.uleb128 .LVL277-.LVL252
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.LVL252
+	.uleb128 .LVL278-1-.LVL252
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL283-.LVL252
+	.uleb128 .LVL284-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL284-.LVL252
+	.uleb128 .LVL286-.LVL252
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.LVL252
+	.uleb128 .LFE15-.LVL252
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU660
+	.uleb128 .LVU676
+	.uleb128 .LVU676
+	.uleb128 .LVU679
+	.uleb128 .LVU739
+	.uleb128 .LVU741
+.LLST78:
+	.byte	0x6
+	.quad	.LVL256
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL261-.LVL256
+	.uleb128 0x12
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL261-.LVL256
+	.uleb128 .LVL262-.LVL256
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 16
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL283-.LVL256
+	.uleb128 .LVL284-.LVL256
+	.uleb128 0x12
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU661
+	.uleb128 .LVU679
+	.uleb128 .LVU679
+	.uleb128 .LVU734
+	.uleb128 .LVU734
+	.uleb128 .LVU736
+	.uleb128 .LVU739
+	.uleb128 .LVU741
+.LLST79:
+	.byte	0x6
+	.quad	.LVL256
+	.byte	0x4
+	.uleb128 .LVL256-.LVL256
+	.uleb128 .LVL262-.LVL256
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL262-.LVL256
+	.uleb128 .LVL281-.LVL256
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL281-.LVL256
+	.uleb128 .LVL282-.LVL256
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL283-.LVL256
+	.uleb128 .LVL284-.LVL256
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU668
+	.uleb128 .LVU671
+.LLST80:
+	.byte	0x8
+	.quad	.LVL259
+	.uleb128 .LVL260-.LVL259
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU685
+	.uleb128 .LVU688
+.LLST81:
+	.byte	0x8
+	.quad	.LVL265
+	.uleb128 .LVL266-.LVL265
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU701
+	.uleb128 .LVU704
+.LLST82:
+	.byte	0x8
+	.quad	.LVL270
+	.uleb128 .LVL271-.LVL270
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU720
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU724
+.LLST84:
+	.byte	0x6
+	.quad	.LVL276
+	.byte	0x4
+	.uleb128 .LVL276-.LVL276
+	.uleb128 .LVL277-.LVL276
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL277-.LVL276
+	.uleb128 .LVL278-1-.LVL276
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU649
+	.uleb128 .LVU653
+.LLST76:
+	.byte	0x8
+	.quad	.LVL252
+	.uleb128 .LVL254-.LVL252
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LFE38-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 0
+	.uleb128 .LVU756
+	.uleb128 .LVU756
+	.uleb128 0
+.LLST85:
+	.byte	0x6
+	.quad	.LVL288
+	.byte	0x4
+	.uleb128 .LVL288-.LVL288
+	.uleb128 .LVL289-1-.LVL288
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL289-1-.LVL288
+	.uleb128 .LFE37-.LVL288
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU758
+	.uleb128 .LVU877
+.LLST87:
+	.byte	0x8
+	.quad	.LVL290
+	.uleb128 .LVL330-.LVL290
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU768
+	.uleb128 .LVU769
+	.uleb128 .LVU769
+	.uleb128 .LVU780
+	.uleb128 .LVU780
+	.uleb128 .LVU781
+.LLST88:
+	.byte	0x6
+	.quad	.LVL292
+	.byte	0x4
+	.uleb128 .LVL292-.LVL292
+	.uleb128 .LVL292-.LVL292
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.LVL292
+	.uleb128 .LVL295-.LVL292
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL295-.LVL292
+	.uleb128 .LVL296-.LVL292
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU789
+	.uleb128 .LVU794
+	.uleb128 .LVU794
+	.uleb128 .LVU831
+.LLST89:
+	.byte	0x6
+	.quad	.LVL299
+	.byte	0x4
+	.uleb128 .LVL299-.LVL299
+	.uleb128 .LVL300-1-.LVL299
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL300-1-.LVL299
+	.uleb128 .LVL313-.LVL299
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU796
+	.uleb128 .LVU797
+	.uleb128 .LVU797
+	.uleb128 .LVU821
+.LLST90:
+	.byte	0x6
+	.quad	.LVL300
+	.byte	0x4
+	.uleb128 .LVL300-.LVL300
+	.uleb128 .LVL300-.LVL300
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL300-.LVL300
+	.uleb128 .LVL310-.LVL300
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU811
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU814
+	.uleb128 .LVU814
+	.uleb128 .LVU816
+.LLST91:
+	.byte	0x6
+	.quad	.LVL306
+	.byte	0x4
+	.uleb128 .LVL306-.LVL306
+	.uleb128 .LVL306-.LVL306
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL306-.LVL306
+	.uleb128 .LVL307-.LVL306
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x48
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL307-.LVL306
+	.uleb128 .LVL308-.LVL306
+	.uleb128 0xa
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x4a
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU835
+	.uleb128 .LVU836
+	.uleb128 .LVU836
+	.uleb128 .LVU855
+.LLST92:
+	.byte	0x6
+	.quad	.LVL314
+	.byte	0x4
+	.uleb128 .LVL314-.LVL314
+	.uleb128 .LVL315-.LVL314
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL315-.LVL314
+	.uleb128 .LVL322-.LVL314
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU764
+	.uleb128 .LVU766
+.LLST94:
+	.byte	0x8
+	.quad	.LVL291
+	.uleb128 .LVL292-.LVL291
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC55
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU792
+	.uleb128 .LVU794
+.LLST96:
+	.byte	0x8
+	.quad	.LVL299
+	.uleb128 .LVL300-.LVL299
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC59
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU804
+	.uleb128 .LVU805
+	.uleb128 .LVU805
+	.uleb128 .LVU836
+.LLST98:
+	.byte	0x6
+	.quad	.LVL302
+	.byte	0x4
+	.uleb128 .LVL302-.LVL302
+	.uleb128 .LVL303-.LVL302
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL303-.LVL302
+	.uleb128 .LVL315-.LVL302
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU818
+	.uleb128 .LVU822
+.LLST100:
+	.byte	0x8
+	.quad	.LVL309
+	.uleb128 .LVL311-.LVL309
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU827
+	.uleb128 .LVU833
+.LLST102:
+	.byte	0x8
+	.quad	.LVL312
+	.uleb128 .LVL314-.LVL312
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC62
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU838
+	.uleb128 .LVU844
+.LLST104:
+	.byte	0x8
+	.quad	.LVL316
+	.uleb128 .LVL317-.LVL316
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU862
+	.uleb128 .LVU865
+	.uleb128 .LVU865
+	.uleb128 .LVU877
+.LLST105:
+	.byte	0x6
+	.quad	.LVL325
+	.byte	0x4
+	.uleb128 .LVL325-.LVL325
+	.uleb128 .LVL326-.LVL325
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL326-.LVL325
+	.uleb128 .LVL330-.LVL325
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU863
+	.uleb128 .LVU875
+.LLST106:
+	.byte	0x8
+	.quad	.LVL325
+	.uleb128 .LVL328-.LVL325
+	.uleb128 0x1c
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x12
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x16
+	.byte	0x14
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU864
+	.uleb128 .LVU875
+.LLST107:
+	.byte	0x8
+	.quad	.LVL325
+	.uleb128 .LVL328-.LVL325
+	.uleb128 0x1b
+	.byte	0x76
+	.sleb128 0
+	.byte	0x12
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x16
+	.byte	0x14
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 0
+.LLST109:
+	.byte	0x6
+	.quad	.LVL334
+	.byte	0x4
+	.uleb128 .LVL334-.LVL334
+	.uleb128 .LVL335-1-.LVL334
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL335-1-.LVL334
+	.uleb128 .LFE26-.LVL334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU893
+	.uleb128 .LVU899
+	.uleb128 .LVU911
+	.uleb128 .LVU912
+.LLST110:
+	.byte	0x8
+	.quad	.LVL335
+	.uleb128 .LVL337-1-.LVL335
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x8
+	.quad	.LVL340
+	.uleb128 .LVL340-.LVL340
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU899
+	.uleb128 .LVU905
+	.uleb128 .LVU916
+	.uleb128 0
+.LLST111:
+	.byte	0x6
+	.quad	.LVL337
+	.byte	0x4
+	.uleb128 .LVL337-.LVL337
+	.uleb128 .LVL338-.LVL337
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL341-.LVL337
+	.uleb128 .LFE26-.LVL337
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU896
+	.uleb128 .LVU899
+.LLST112:
+	.byte	0x8
+	.quad	.LVL336
+	.uleb128 .LVL337-.LVL336
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU913
+	.uleb128 .LVU916
+.LLST114:
+	.byte	0x8
+	.quad	.LVL340
+	.uleb128 .LVL341-.LVL340
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU985
+	.uleb128 .LVU985
+	.uleb128 .LVU986
+	.uleb128 .LVU986
+	.uleb128 0
+.LLST115:
+	.byte	0x6
+	.quad	.LVL342
+	.byte	0x4
+	.uleb128 .LVL342-.LVL342
+	.uleb128 .LVL343-1-.LVL342
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL343-1-.LVL342
+	.uleb128 .LVL348-.LVL342
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL348-.LVL342
+	.uleb128 .LVL368-.LVL342
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL368-.LVL342
+	.uleb128 .LVL369-.LVL342
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL369-.LVL342
+	.uleb128 .LFE25-.LVL342
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU926
+	.uleb128 .LVU932
+.LLST116:
+	.byte	0x8
+	.quad	.LVL343
+	.uleb128 .LVL345-1-.LVL343
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU929
+	.uleb128 .LVU941
+	.uleb128 .LVU941
+	.uleb128 .LVU971
+	.uleb128 .LVU973
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+	.uleb128 .LVU985
+	.uleb128 .LVU985
+	.uleb128 .LVU986
+	.uleb128 .LVU986
+	.uleb128 0
+.LLST118:
+	.byte	0x6
+	.quad	.LVL344
+	.byte	0x4
+	.uleb128 .LVL344-.LVL344
+	.uleb128 .LVL348-.LVL344
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL348-.LVL344
+	.uleb128 .LVL360-.LVL344
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL361-.LVL344
+	.uleb128 .LVL362-.LVL344
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL363-.LVL344
+	.uleb128 .LVL368-.LVL344
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL368-.LVL344
+	.uleb128 .LVL369-.LVL344
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL369-.LVL344
+	.uleb128 .LFE25-.LVL344
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU934
+	.uleb128 .LVU944
+	.uleb128 .LVU944
+	.uleb128 .LVU965
+	.uleb128 .LVU965
+	.uleb128 .LVU969
+	.uleb128 .LVU969
+	.uleb128 .LVU971
+	.uleb128 .LVU973
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+	.uleb128 .LVU984
+	.uleb128 .LVU985
+	.uleb128 .LVU986
+.LLST119:
+	.byte	0x6
+	.quad	.LVL346
+	.byte	0x4
+	.uleb128 .LVL346-.LVL346
+	.uleb128 .LVL350-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.LVL346
+	.uleb128 .LVL357-.LVL346
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL357-.LVL346
+	.uleb128 .LVL359-1-.LVL346
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL359-1-.LVL346
+	.uleb128 .LVL360-.LVL346
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL361-.LVL346
+	.uleb128 .LVL362-.LVL346
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL363-.LVL346
+	.uleb128 .LVL367-.LVL346
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL368-.LVL346
+	.uleb128 .LVL369-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU934
+	.uleb128 .LVU946
+	.uleb128 .LVU946
+	.uleb128 .LVU958
+	.uleb128 .LVU958
+	.uleb128 .LVU960
+	.uleb128 .LVU960
+	.uleb128 .LVU971
+	.uleb128 .LVU973
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+	.uleb128 .LVU983
+	.uleb128 .LVU985
+	.uleb128 .LVU986
+.LLST120:
+	.byte	0x6
+	.quad	.LVL346
+	.byte	0x4
+	.uleb128 .LVL346-.LVL346
+	.uleb128 .LVL350-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL350-.LVL346
+	.uleb128 .LVL355-.LVL346
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL355-.LVL346
+	.uleb128 .LVL356-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL356-.LVL346
+	.uleb128 .LVL360-.LVL346
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL361-.LVL346
+	.uleb128 .LVL362-.LVL346
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL363-.LVL346
+	.uleb128 .LVL366-.LVL346
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL368-.LVL346
+	.uleb128 .LVL369-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU934
+	.uleb128 .LVU946
+	.uleb128 .LVU949
+	.uleb128 .LVU971
+	.uleb128 .LVU973
+	.uleb128 .LVU974
+	.uleb128 .LVU977
+	.uleb128 .LVU982
+	.uleb128 .LVU985
+	.uleb128 .LVU986
+.LLST121:
+	.byte	0x6
+	.quad	.LVL346
+	.byte	0x4
+	.uleb128 .LVL346-.LVL346
+	.uleb128 .LVL350-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL351-.LVL346
+	.uleb128 .LVL360-.LVL346
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL361-.LVL346
+	.uleb128 .LVL362-.LVL346
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL363-.LVL346
+	.uleb128 .LVL365-.LVL346
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL368-.LVL346
+	.uleb128 .LVL369-.LVL346
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU933
+	.uleb128 .LVU943
+	.uleb128 .LVU951
+	.uleb128 .LVU957
+	.uleb128 .LVU960
+	.uleb128 .LVU967
+	.uleb128 .LVU977
+	.uleb128 .LVU980
+	.uleb128 .LVU985
+	.uleb128 .LVU987
+.LLST122:
+	.byte	0x6
+	.quad	.LVL346
+	.byte	0x4
+	.uleb128 .LVL346-.LVL346
+	.uleb128 .LVL349-1-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL352-.LVL346
+	.uleb128 .LVL354-1-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL356-.LVL346
+	.uleb128 .LVL358-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL363-.LVL346
+	.uleb128 .LVL364-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL368-.LVL346
+	.uleb128 .LVL370-.LVL346
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU937
+	.uleb128 .LVU943
+.LLST124:
+	.byte	0x8
+	.quad	.LVL347
+	.uleb128 .LVL349-1-.LVL347
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU954
+	.uleb128 .LVU957
+.LLST125:
+	.byte	0x8
+	.quad	.LVL353
+	.uleb128 .LVL354-1-.LVL353
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU1003
+	.uleb128 .LVU1003
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 0
+.LLST126:
+	.byte	0x6
+	.quad	.LVL372
+	.byte	0x4
+	.uleb128 .LVL372-.LVL372
+	.uleb128 .LVL373-.LVL372
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL373-.LVL372
+	.uleb128 .LVL380-.LVL372
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL380-.LVL372
+	.uleb128 .LFE35-.LVL372
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU998
+	.uleb128 .LVU1003
+.LLST127:
+	.byte	0x8
+	.quad	.LVL372
+	.uleb128 .LVL373-.LVL372
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU1008
+	.uleb128 .LVU1014
+.LLST128:
+	.byte	0x8
+	.quad	.LVL375
+	.uleb128 .LVL379-.LVL375
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU997
+	.uleb128 .LVU1003
+	.uleb128 .LVU1003
+	.uleb128 .LVU1010
+	.uleb128 .LVU1010
+	.uleb128 .LVU1014
+	.uleb128 .LVU1014
+	.uleb128 .LVU1020
+.LLST129:
+	.byte	0x6
+	.quad	.LVL372
+	.byte	0x4
+	.uleb128 .LVL372-.LVL372
+	.uleb128 .LVL373-.LVL372
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL373-.LVL372
+	.uleb128 .LVL376-.LVL372
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL376-.LVL372
+	.uleb128 .LVL379-.LVL372
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL379-.LVL372
+	.uleb128 .LVL381-.LVL372
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU1023
+	.uleb128 0
+.LLST131:
+	.byte	0x8
+	.quad	.LVL382
+	.uleb128 .LFE35-.LVL382
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 0
+	.uleb128 .LVU1186
+	.uleb128 .LVU1186
+	.uleb128 0
+.LLST158:
+	.byte	0x6
+	.quad	.LVL434
+	.byte	0x4
+	.uleb128 .LVL434-.LVL434
+	.uleb128 .LVL435-.LVL434
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL435-.LVL434
+	.uleb128 .LFE28-.LVL434
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1182
+	.uleb128 .LVU1187
+.LLST160:
+	.byte	0x8
+	.quad	.LVL434
+	.uleb128 .LVL436-.LVL434
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC77
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1192
+	.uleb128 .LVU1194
+.LLST162:
+	.byte	0x8
+	.quad	.LVL437
+	.uleb128 .LVL438-.LVL437
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC78
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x16c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB187
+	.byte	0x4
+	.uleb128 .LBB187-.LBB187
+	.uleb128 .LBE187-.LBB187
+	.byte	0x4
+	.uleb128 .LBB191-.LBB187
+	.uleb128 .LBE191-.LBB187
+	.byte	0x4
+	.uleb128 .LBB192-.LBB187
+	.uleb128 .LBE192-.LBB187
+	.byte	0
+.LLRL11:
+	.byte	0x5
+	.quad	.LBB193
+	.byte	0x4
+	.uleb128 .LBB193-.LBB193
+	.uleb128 .LBE193-.LBB193
+	.byte	0x4
+	.uleb128 .LBB199-.LBB193
+	.uleb128 .LBE199-.LBB193
+	.byte	0
+.LLRL13:
+	.byte	0x5
+	.quad	.LBB196
+	.byte	0x4
+	.uleb128 .LBB196-.LBB196
+	.uleb128 .LBE196-.LBB196
+	.byte	0x4
+	.uleb128 .LBB200-.LBB196
+	.uleb128 .LBE200-.LBB196
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB204
+	.byte	0x4
+	.uleb128 .LBB204-.LBB204
+	.uleb128 .LBE204-.LBB204
+	.byte	0x4
+	.uleb128 .LBB207-.LBB204
+	.uleb128 .LBE207-.LBB204
+	.byte	0
+.LLRL28:
+	.byte	0x5
+	.quad	.LBB212
+	.byte	0x4
+	.uleb128 .LBB212-.LBB212
+	.uleb128 .LBE212-.LBB212
+	.byte	0x4
+	.uleb128 .LBB215-.LBB212
+	.uleb128 .LBE215-.LBB212
+	.byte	0
+.LLRL33:
+	.byte	0x5
+	.quad	.LBB216
+	.byte	0x4
+	.uleb128 .LBB216-.LBB216
+	.uleb128 .LBE216-.LBB216
+	.byte	0x4
+	.uleb128 .LBB217-.LBB216
+	.uleb128 .LBE217-.LBB216
+	.byte	0
+.LLRL35:
+	.byte	0x5
+	.quad	.LBB218
+	.byte	0x4
+	.uleb128 .LBB218-.LBB218
+	.uleb128 .LBE218-.LBB218
+	.byte	0x4
+	.uleb128 .LBB222-.LBB218
+	.uleb128 .LBE222-.LBB218
+	.byte	0x4
+	.uleb128 .LBB223-.LBB218
+	.uleb128 .LBE223-.LBB218
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB224
+	.byte	0x4
+	.uleb128 .LBB224-.LBB224
+	.uleb128 .LBE224-.LBB224
+	.byte	0x4
+	.uleb128 .LBB227-.LBB224
+	.uleb128 .LBE227-.LBB224
+	.byte	0
+.LLRL43:
+	.byte	0x5
+	.quad	.LBB228
+	.byte	0x4
+	.uleb128 .LBB228-.LBB228
+	.uleb128 .LBE228-.LBB228
+	.byte	0x4
+	.uleb128 .LBB243-.LBB228
+	.uleb128 .LBE243-.LBB228
+	.byte	0x4
+	.uleb128 .LBB244-.LBB228
+	.uleb128 .LBE244-.LBB228
+	.byte	0x4
+	.uleb128 .LBB249-.LBB228
+	.uleb128 .LBE249-.LBB228
+	.byte	0x4
+	.uleb128 .LBB250-.LBB228
+	.uleb128 .LBE250-.LBB228
+	.byte	0x4
+	.uleb128 .LBB257-.LBB228
+	.uleb128 .LBE257-.LBB228
+	.byte	0
+.LLRL46:
+	.byte	0x5
+	.quad	.LBB233
+	.byte	0x4
+	.uleb128 .LBB233-.LBB233
+	.uleb128 .LBE233-.LBB233
+	.byte	0x4
+	.uleb128 .LBB237-.LBB233
+	.uleb128 .LBE237-.LBB233
+	.byte	0x4
+	.uleb128 .LBB242-.LBB233
+	.uleb128 .LBE242-.LBB233
+	.byte	0
+.LLRL51:
+	.byte	0x5
+	.quad	.LBB251
+	.byte	0x4
+	.uleb128 .LBB251-.LBB251
+	.uleb128 .LBE251-.LBB251
+	.byte	0x4
+	.uleb128 .LBB255-.LBB251
+	.uleb128 .LBE255-.LBB251
+	.byte	0x4
+	.uleb128 .LBB256-.LBB251
+	.uleb128 .LBE256-.LBB251
+	.byte	0
+.LLRL60:
+	.byte	0x5
+	.quad	.LBB260
+	.byte	0x4
+	.uleb128 .LBB260-.LBB260
+	.uleb128 .LBE260-.LBB260
+	.byte	0x4
+	.uleb128 .LBB263-.LBB260
+	.uleb128 .LBE263-.LBB260
+	.byte	0
+.LLRL62:
+	.byte	0x5
+	.quad	.LBB264
+	.byte	0x4
+	.uleb128 .LBB264-.LBB264
+	.uleb128 .LBE264-.LBB264
+	.byte	0x4
+	.uleb128 .LBB267-.LBB264
+	.uleb128 .LBE267-.LBB264
+	.byte	0
+.LLRL64:
+	.byte	0x5
+	.quad	.LBB268
+	.byte	0x4
+	.uleb128 .LBB268-.LBB268
+	.uleb128 .LBE268-.LBB268
+	.byte	0x4
+	.uleb128 .LBB272-.LBB268
+	.uleb128 .LBE272-.LBB268
+	.byte	0x4
+	.uleb128 .LBB273-.LBB268
+	.uleb128 .LBE273-.LBB268
+	.byte	0
+.LLRL67:
+	.byte	0x5
+	.quad	.LBB276
+	.byte	0x4
+	.uleb128 .LBB276-.LBB276
+	.uleb128 .LBE276-.LBB276
+	.byte	0x4
+	.uleb128 .LBB279-.LBB276
+	.uleb128 .LBE279-.LBB276
+	.byte	0
+.LLRL75:
+	.byte	0x5
+	.quad	.LBB282
+	.byte	0x4
+	.uleb128 .LBB282-.LBB282
+	.uleb128 .LBE282-.LBB282
+	.byte	0x4
+	.uleb128 .LBB283-.LBB282
+	.uleb128 .LBE283-.LBB282
+	.byte	0
+.LLRL77:
+	.byte	0x5
+	.quad	.LBB286
+	.byte	0x4
+	.uleb128 .LBB286-.LBB286
+	.uleb128 .LBE286-.LBB286
+	.byte	0x4
+	.uleb128 .LBB297-.LBB286
+	.uleb128 .LBE297-.LBB286
+	.byte	0x4
+	.uleb128 .LBB298-.LBB286
+	.uleb128 .LBE298-.LBB286
+	.byte	0
+.LLRL83:
+	.byte	0x5
+	.quad	.LBB293
+	.byte	0x4
+	.uleb128 .LBB293-.LBB293
+	.uleb128 .LBE293-.LBB293
+	.byte	0x4
+	.uleb128 .LBB296-.LBB293
+	.uleb128 .LBE296-.LBB293
+	.byte	0
+.LLRL86:
+	.byte	0x5
+	.quad	.LBB316
+	.byte	0x4
+	.uleb128 .LBB316-.LBB316
+	.uleb128 .LBE316-.LBB316
+	.byte	0x4
+	.uleb128 .LBB340-.LBB316
+	.uleb128 .LBE340-.LBB316
+	.byte	0
+.LLRL93:
+	.byte	0x5
+	.quad	.LBB318
+	.byte	0x4
+	.uleb128 .LBB318-.LBB318
+	.uleb128 .LBE318-.LBB318
+	.byte	0x4
+	.uleb128 .LBB321-.LBB318
+	.uleb128 .LBE321-.LBB318
+	.byte	0
+.LLRL95:
+	.byte	0x5
+	.quad	.LBB322
+	.byte	0x4
+	.uleb128 .LBB322-.LBB322
+	.uleb128 .LBE322-.LBB322
+	.byte	0x4
+	.uleb128 .LBB325-.LBB322
+	.uleb128 .LBE325-.LBB322
+	.byte	0
+.LLRL97:
+	.byte	0x5
+	.quad	.LBB326
+	.byte	0x4
+	.uleb128 .LBB326-.LBB326
+	.uleb128 .LBE326-.LBB326
+	.byte	0x4
+	.uleb128 .LBB331-.LBB326
+	.uleb128 .LBE331-.LBB326
+	.byte	0
+.LLRL99:
+	.byte	0x5
+	.quad	.LBB327
+	.byte	0x4
+	.uleb128 .LBB327-.LBB327
+	.uleb128 .LBE327-.LBB327
+	.byte	0x4
+	.uleb128 .LBB330-.LBB327
+	.uleb128 .LBE330-.LBB327
+	.byte	0
+.LLRL101:
+	.byte	0x5
+	.quad	.LBB332
+	.byte	0x4
+	.uleb128 .LBB332-.LBB332
+	.uleb128 .LBE332-.LBB332
+	.byte	0x4
+	.uleb128 .LBB336-.LBB332
+	.uleb128 .LBE336-.LBB332
+	.byte	0
+.LLRL103:
+	.byte	0x5
+	.quad	.LBB335
+	.byte	0x4
+	.uleb128 .LBB335-.LBB335
+	.uleb128 .LBE335-.LBB335
+	.byte	0x4
+	.uleb128 .LBB337-.LBB335
+	.uleb128 .LBE337-.LBB335
+	.byte	0
+.LLRL108:
+	.byte	0x5
+	.quad	.LBB341
+	.byte	0x4
+	.uleb128 .LBB341-.LBB341
+	.uleb128 .LBE341-.LBB341
+	.byte	0x4
+	.uleb128 .LBB345-.LBB341
+	.uleb128 .LBE345-.LBB341
+	.byte	0x4
+	.uleb128 .LBB346-.LBB341
+	.uleb128 .LBE346-.LBB341
+	.byte	0
+.LLRL113:
+	.byte	0x5
+	.quad	.LBB355
+	.byte	0x4
+	.uleb128 .LBB355-.LBB355
+	.uleb128 .LBE355-.LBB355
+	.byte	0x4
+	.uleb128 .LBB358-.LBB355
+	.uleb128 .LBE358-.LBB355
+	.byte	0
+.LLRL117:
+	.byte	0x5
+	.quad	.LBB365
+	.byte	0x4
+	.uleb128 .LBB365-.LBB365
+	.uleb128 .LBE365-.LBB365
+	.byte	0x4
+	.uleb128 .LBB381-.LBB365
+	.uleb128 .LBE381-.LBB365
+	.byte	0x4
+	.uleb128 .LBB382-.LBB365
+	.uleb128 .LBE382-.LBB365
+	.byte	0x4
+	.uleb128 .LBB383-.LBB365
+	.uleb128 .LBE383-.LBB365
+	.byte	0x4
+	.uleb128 .LBB384-.LBB365
+	.uleb128 .LBE384-.LBB365
+	.byte	0x4
+	.uleb128 .LBB385-.LBB365
+	.uleb128 .LBE385-.LBB365
+	.byte	0x4
+	.uleb128 .LBB386-.LBB365
+	.uleb128 .LBE386-.LBB365
+	.byte	0
+.LLRL123:
+	.byte	0x5
+	.quad	.LBB367
+	.byte	0x4
+	.uleb128 .LBB367-.LBB367
+	.uleb128 .LBE367-.LBB367
+	.byte	0x4
+	.uleb128 .LBB371-.LBB367
+	.uleb128 .LBE371-.LBB367
+	.byte	0x4
+	.uleb128 .LBB374-.LBB367
+	.uleb128 .LBE374-.LBB367
+	.byte	0
+.LLRL130:
+	.byte	0x5
+	.quad	.LBB391
+	.byte	0x4
+	.uleb128 .LBB391-.LBB391
+	.uleb128 .LBE391-.LBB391
+	.byte	0x4
+	.uleb128 .LBB401-.LBB391
+	.uleb128 .LBE401-.LBB391
+	.byte	0x4
+	.uleb128 .LBB402-.LBB391
+	.uleb128 .LBE402-.LBB391
+	.byte	0
+.LLRL139:
+	.byte	0x5
+	.quad	.LBB403
+	.byte	0x4
+	.uleb128 .LBB403-.LBB403
+	.uleb128 .LBE403-.LBB403
+	.byte	0x4
+	.uleb128 .LBB421-.LBB403
+	.uleb128 .LBE421-.LBB403
+	.byte	0x4
+	.uleb128 .LBB426-.LBB403
+	.uleb128 .LBE426-.LBB403
+	.byte	0x4
+	.uleb128 .LBB427-.LBB403
+	.uleb128 .LBE427-.LBB403
+	.byte	0x4
+	.uleb128 .LBB428-.LBB403
+	.uleb128 .LBE428-.LBB403
+	.byte	0
+.LLRL142:
+	.byte	0x5
+	.quad	.LBB404
+	.byte	0x4
+	.uleb128 .LBB404-.LBB404
+	.uleb128 .LBE404-.LBB404
+	.byte	0x4
+	.uleb128 .LBB408-.LBB404
+	.uleb128 .LBE408-.LBB404
+	.byte	0x4
+	.uleb128 .LBB409-.LBB404
+	.uleb128 .LBE409-.LBB404
+	.byte	0
+.LLRL144:
+	.byte	0x5
+	.quad	.LBB410
+	.byte	0x4
+	.uleb128 .LBB410-.LBB410
+	.uleb128 .LBE410-.LBB410
+	.byte	0x4
+	.uleb128 .LBB413-.LBB410
+	.uleb128 .LBE413-.LBB410
+	.byte	0
+.LLRL146:
+	.byte	0x5
+	.quad	.LBB414
+	.byte	0x4
+	.uleb128 .LBB414-.LBB414
+	.uleb128 .LBE414-.LBB414
+	.byte	0x4
+	.uleb128 .LBB417-.LBB414
+	.uleb128 .LBE417-.LBB414
+	.byte	0x4
+	.uleb128 .LBB418-.LBB414
+	.uleb128 .LBE418-.LBB414
+	.byte	0
+.LLRL151:
+	.byte	0x5
+	.quad	.LBB439
+	.byte	0x4
+	.uleb128 .LBB439-.LBB439
+	.uleb128 .LBE439-.LBB439
+	.byte	0x4
+	.uleb128 .LBB442-.LBB439
+	.uleb128 .LBE442-.LBB439
+	.byte	0
+.LLRL153:
+	.byte	0x5
+	.quad	.LBB443
+	.byte	0x4
+	.uleb128 .LBB443-.LBB443
+	.uleb128 .LBE443-.LBB443
+	.byte	0x4
+	.uleb128 .LBB454-.LBB443
+	.uleb128 .LBE454-.LBB443
+	.byte	0
+.LLRL156:
+	.byte	0x5
+	.quad	.LBB447
+	.byte	0x4
+	.uleb128 .LBB447-.LBB447
+	.uleb128 .LBE447-.LBB447
+	.byte	0x4
+	.uleb128 .LBB452-.LBB447
+	.uleb128 .LBE452-.LBB447
+	.byte	0
+.LLRL159:
+	.byte	0x5
+	.quad	.LBB461
+	.byte	0x4
+	.uleb128 .LBB461-.LBB461
+	.uleb128 .LBE461-.LBB461
+	.byte	0x4
+	.uleb128 .LBB464-.LBB461
+	.uleb128 .LBE464-.LBB461
+	.byte	0
+.LLRL161:
+	.byte	0x5
+	.quad	.LBB465
+	.byte	0x4
+	.uleb128 .LBB465-.LBB465
+	.uleb128 .LBE465-.LBB465
+	.byte	0x4
+	.uleb128 .LBB470-.LBB465
+	.uleb128 .LBE470-.LBB465
+	.byte	0
+.LLRL164:
+	.byte	0x5
+	.quad	.LBB477
+	.byte	0x4
+	.uleb128 .LBB477-.LBB477
+	.uleb128 .LBE477-.LBB477
+	.byte	0x4
+	.uleb128 .LBB480-.LBB477
+	.uleb128 .LBE480-.LBB477
+	.byte	0
+.LLRL166:
+	.byte	0x5
+	.quad	.LBB481
+	.byte	0x4
+	.uleb128 .LBB481-.LBB481
+	.uleb128 .LBE481-.LBB481
+	.byte	0x4
+	.uleb128 .LBB486-.LBB481
+	.uleb128 .LBE486-.LBB481
+	.byte	0
+.LLRL177:
+	.byte	0x5
+	.quad	.LBB536
+	.byte	0x4
+	.uleb128 .LBB536-.LBB536
+	.uleb128 .LBE536-.LBB536
+	.byte	0x4
+	.uleb128 .LBB599-.LBB536
+	.uleb128 .LBE599-.LBB536
+	.byte	0x4
+	.uleb128 .LBB600-.LBB536
+	.uleb128 .LBE600-.LBB536
+	.byte	0x4
+	.uleb128 .LBB609-.LBB536
+	.uleb128 .LBE609-.LBB536
+	.byte	0x4
+	.uleb128 .LBB610-.LBB536
+	.uleb128 .LBE610-.LBB536
+	.byte	0x4
+	.uleb128 .LBB611-.LBB536
+	.uleb128 .LBE611-.LBB536
+	.byte	0
+.LLRL179:
+	.byte	0x5
+	.quad	.LBB537
+	.byte	0x4
+	.uleb128 .LBB537-.LBB537
+	.uleb128 .LBE537-.LBB537
+	.byte	0x4
+	.uleb128 .LBB568-.LBB537
+	.uleb128 .LBE568-.LBB537
+	.byte	0x4
+	.uleb128 .LBB569-.LBB537
+	.uleb128 .LBE569-.LBB537
+	.byte	0x4
+	.uleb128 .LBB576-.LBB537
+	.uleb128 .LBE576-.LBB537
+	.byte	0x4
+	.uleb128 .LBB596-.LBB537
+	.uleb128 .LBE596-.LBB537
+	.byte	0x4
+	.uleb128 .LBB598-.LBB537
+	.uleb128 .LBE598-.LBB537
+	.byte	0
+.LLRL184:
+	.byte	0x5
+	.quad	.LBB538
+	.byte	0x4
+	.uleb128 .LBB538-.LBB538
+	.uleb128 .LBE538-.LBB538
+	.byte	0x4
+	.uleb128 .LBB542-.LBB538
+	.uleb128 .LBE542-.LBB538
+	.byte	0x4
+	.uleb128 .LBB563-.LBB538
+	.uleb128 .LBE563-.LBB538
+	.byte	0
+.LLRL186:
+	.byte	0x5
+	.quad	.LBB543
+	.byte	0x4
+	.uleb128 .LBB543-.LBB543
+	.uleb128 .LBE543-.LBB543
+	.byte	0x4
+	.uleb128 .LBB546-.LBB543
+	.uleb128 .LBE546-.LBB543
+	.byte	0
+.LLRL189:
+	.byte	0x5
+	.quad	.LBB549
+	.byte	0x4
+	.uleb128 .LBB549-.LBB549
+	.uleb128 .LBE549-.LBB549
+	.byte	0x4
+	.uleb128 .LBB556-.LBB549
+	.uleb128 .LBE556-.LBB549
+	.byte	0
+.LLRL190:
+	.byte	0x5
+	.quad	.LBB551
+	.byte	0x4
+	.uleb128 .LBB551-.LBB551
+	.uleb128 .LBE551-.LBB551
+	.byte	0x4
+	.uleb128 .LBB554-.LBB551
+	.uleb128 .LBE554-.LBB551
+	.byte	0
+.LLRL192:
+	.byte	0x5
+	.quad	.LBB557
+	.byte	0x4
+	.uleb128 .LBB557-.LBB557
+	.uleb128 .LBE557-.LBB557
+	.byte	0x4
+	.uleb128 .LBB561-.LBB557
+	.uleb128 .LBE561-.LBB557
+	.byte	0x4
+	.uleb128 .LBB562-.LBB557
+	.uleb128 .LBE562-.LBB557
+	.byte	0
+.LLRL194:
+	.byte	0x5
+	.quad	.LBB564
+	.byte	0x4
+	.uleb128 .LBB564-.LBB564
+	.uleb128 .LBE564-.LBB564
+	.byte	0x4
+	.uleb128 .LBB567-.LBB564
+	.uleb128 .LBE567-.LBB564
+	.byte	0
+.LLRL198:
+	.byte	0x5
+	.quad	.LBB577
+	.byte	0x4
+	.uleb128 .LBB577-.LBB577
+	.uleb128 .LBE577-.LBB577
+	.byte	0x4
+	.uleb128 .LBB597-.LBB577
+	.uleb128 .LBE597-.LBB577
+	.byte	0
+.LLRL202:
+	.byte	0x5
+	.quad	.LBB584
+	.byte	0x4
+	.uleb128 .LBB584-.LBB584
+	.uleb128 .LBE584-.LBB584
+	.byte	0x4
+	.uleb128 .LBB591-.LBB584
+	.uleb128 .LBE591-.LBB584
+	.byte	0
+.LLRL213:
+	.byte	0x5
+	.quad	.LBB592
+	.byte	0x4
+	.uleb128 .LBB592-.LBB592
+	.uleb128 .LBE592-.LBB592
+	.byte	0x4
+	.uleb128 .LBB595-.LBB592
+	.uleb128 .LBE595-.LBB592
+	.byte	0
+.LLRL218:
+	.byte	0x7
+	.quad	.LFB38
+	.uleb128 .LFE38-.LFB38
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB36
+	.uleb128 .LFE36-.LFB36
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB32
+	.uleb128 .LFE32-.LFB32
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB37
+	.uleb128 .LFE37-.LFB37
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0x7
+	.quad	.LFB35
+	.uleb128 .LFE35-.LFB35
+	.byte	0x7
+	.quad	.LFB34
+	.uleb128 .LFE34-.LFB34
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB39
+	.uleb128 .LFE39-.LFB39
+	.byte	0x7
+	.quad	.LFB40
+	.uleb128 .LFE40-.LFB40
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 49 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 51 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.file 52 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 54 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 55 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 60 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x3c
+	.file 61 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 69 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 74 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 91 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x5c
+	.byte	0x4
+	.byte	0x4
+	.file 93 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF917
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF918
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 96 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x61
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1197
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 102 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x66
+	.byte	0x4
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 104 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x68
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 105 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 106 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 107 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1394
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1410
+	.byte	0x4
+	.byte	0x4
+	.file 108 ".//src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x6c
+	.byte	0x4
+	.file 109 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 110 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6e
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1415
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 111 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x6f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1423
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x4
+	.file 112 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1472
+	.byte	0x4
+	.file 113 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1495
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1496
+	.byte	0x4
+	.file 114 ".//src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1497
+	.byte	0x4
+	.file 115 ".//src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1509
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1517
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1520
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF915
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1191
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1196
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1199
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1201
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1216
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1216
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1226
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1229
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1229
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1218
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1253
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1290
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ctype.h.23.e4fba624a2c005d3c7022fb9ef0a87ca,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1349
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1359
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1378
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.version.h.18.c03a47f323b169b2f1003239e9abefcc,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1401
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1406
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.profiling.h.34.071b1e95f4ebee26ff29bf11a1e6ac52,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1409
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1414
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1419
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1422
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1439
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1468
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1486
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1489
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1494
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1499
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1508
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_values.h.32.11f6a86bb47beeedafaf69664c3a4228,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1511
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.scheduler.h.115.938f6c2ded084b2afd5b0b59fa60d513,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.printf.h.106.e4436cd231e08efb64f4e6d3908f2921,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1516
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1701:
+	.string	"escAndServoConfig_s"
+.LASF1705:
+	.string	"escAndServoConfig_t"
+.LASF1550:
+	.string	"targetName"
+.LASF926:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1482:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1404:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1405:
+	.string	"HSV_VALUE_MAX 255"
+.LASF953:
+	.string	"__DECL_SIMD_logf "
+.LASF1062:
+	.string	"__DECL_SIMD_sinh "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1341:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1158:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1763:
+	.string	"SCENARIO_SERIAL_RX_ONLY"
+.LASF1619:
+	.string	"serialWrite"
+.LASF899:
+	.string	"alloca"
+.LASF1387:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1492:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1470:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF1415:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1464:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1071:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1704:
+	.string	"mincommand"
+.LASF1636:
+	.string	"PIDPITCH"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2159:
+	.string	"writeEEPROM"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2145:
+	.string	"cliAux"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF990:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1486:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1342:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1624:
+	.string	"setMode"
+.LASF1885:
+	.string	"FEATURE_RX_PPM"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1787:
+	.string	"gps_passthrough_baudrate"
+.LASF1328:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF1311:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1262:
+	.string	"FP_NORMAL 4"
+.LASF1126:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1106:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF963:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1021:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1567:
+	.string	"PROFILE_STAGE_ANNEX"
+.LASF1066:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1182:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1167:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1703:
+	.string	"maxthrottle"
+.LASF1978:
+	.string	"VAR_INT16"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1528:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1610:
+	.string	"vTable"
+.LASF1832:
+	.string	"gyroHardware"
+.LASF1629:
+	.string	"txCommit"
+.LASF1631:
+	.string	"_Bool"
+.LASF1088:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1510:
+	.string	"VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)"
+.LASF921:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1656:
+	.string	"flightDynamicsTrims_t"
+.LASF1359:
+	.string	"U_ID_2 0"
+.LASF1647:
+	.string	"A_level"
+.LASF1305:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1202:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1757:
+	.string	"SCENARIO_CLI_ONLY"
+.LASF1130:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF972:
+	.string	"__DECL_SIMD_pow "
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1110:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1941:
+	.string	"flight3DConfig"
+.LASF1635:
+	.string	"PIDROLL"
+.LASF1467:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1992:
+	.string	"configValueCount"
+.LASF1688:
+	.string	"failsafe_throttle"
+.LASF1336:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1660:
+	.string	"motorMixer_t"
+.LASF1599:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1822:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1027:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1964:
+	.string	"disarm_kill_switch"
+.LASF1483:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF1263:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1824:
+	.string	"CW270_DEG_FLIP"
+.LASF1561:
+	.string	"BOOT_STAGE_OUTPUTS"
+.LASF1059:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF967:
+	.string	"__DECL_SIMD_expf64 "
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF1991:
+	.string	"configValues"
+.LASF1670:
+	.string	"deadband3d_throttle"
+.LASF1807:
+	.string	"yawDegrees"
+.LASF1133:
+	.string	"__DECL_SIMD_acoshf "
+.LASF938:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1105:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1642:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1589:
+	.string	"read"
+.LASF1854:
+	.string	"samples"
+.LASF1586:
+	.string	"profileStageStats_s"
+.LASF1583:
+	.string	"profileStageStats_t"
+.LASF2109:
+	.string	"matchedCommands"
+.LASF1766:
+	.string	"serialPortFunctionScenario_e"
+.LASF1917:
+	.string	"barometerConfig"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2155:
+	.string	"__comparison"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1735:
+	.string	"auxChannelIndex"
+.LASF1895:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1267:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1556:
+	.string	"RGB_BLUE"
+.LASF1541:
+	.string	"uint16_t"
+.LASF964:
+	.string	"__DECL_SIMD_expl "
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1518:
+	.string	"CMD_COUNT (sizeof(cmdTable) / sizeof(clicmd_t))"
+.LASF1675:
+	.string	"middle"
+.LASF1913:
+	.string	"accelerometerTrims"
+.LASF1190:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1965:
+	.string	"small_angle"
+.LASF1633:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF1170:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2102:
+	.string	"intervals"
+.LASF1084:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1331:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1265:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF920:
+	.string	"_MATH_H 1"
+.LASF1315:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF2133:
+	.string	"cliFeature"
+.LASF1243:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF1779:
+	.string	"serialPortCount"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF2080:
+	.string	"getTaskInfo"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1974:
+	.string	"currentProfile"
+.LASF1396:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1866:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF1388:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1187:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2052:
+	.string	"strtok"
+.LASF1921:
+	.string	"yaw_deadband"
+.LASF2001:
+	.string	"isEnabled"
+.LASF984:
+	.string	"__DECL_SIMD_acosl "
+.LASF965:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1594:
+	.string	"mask"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF913:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1427:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1746:
+	.string	"controlRateConfig_t"
+.LASF955:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1955:
+	.string	"gyroConfig"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1730:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1966:
+	.string	"airplaneConfig"
+.LASF1329:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1644:
+	.string	"PIDVEL"
+.LASF1368:
+	.string	"USE_ACC_SITL "
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1722:
+	.string	"BOXLEDMAX"
+.LASF2048:
+	.string	"parseRcChannels"
+.LASF1011:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1956:
+	.string	"max_angle_inclination"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2062:
+	.string	"ringBufferSize"
+.LASF1637:
+	.string	"PIDYAW"
+.LASF1563:
+	.string	"BOOT_STAGE_CALIBRATION"
+.LASF1597:
+	.string	"highWaterMark"
+.LASF2028:
+	.string	"accNames"
+.LASF2072:
+	.string	"getMspCommandId"
+.LASF954:
+	.string	"__DECL_SIMD_logl "
+.LASF1199:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2156:
+	.string	"atoi"
+.LASF1398:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1191:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1491:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1782:
+	.string	"serialConfig_s"
+.LASF1172:
+	.string	"__DECL_SIMD_erfc "
+.LASF1037:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF1539:
+	.string	"int32_t"
+.LASF2139:
+	.string	"dumpMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1426:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1378:
+	.string	"FAST_MATH "
+.LASF1369:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1146:
+	.string	"__DECL_SIMD_erff32 "
+.LASF918:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2087:
+	.string	"pstart"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1937:
+	.string	"pid_process_denom"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2115:
+	.string	"lastNonSpaceCharacter"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF915:
+	.string	"__va_list__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF1028:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2114:
+	.string	"valuef"
+.LASF1338:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF1893:
+	.string	"FEATURE_FAILSAFE"
+.LASF1602:
+	.string	"MODE_RX"
+.LASF1061:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1274:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1060:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1436:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1655:
+	.string	"values"
+.LASF2003:
+	.string	"desiredPeriod"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF934:
+	.string	"__DECL_SIMD_sinl "
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1713:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2121:
+	.string	"cliPrint"
+.LASF1218:
+	.string	"__MATH_PRECNAME"
+.LASF1097:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1608:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1248:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1478:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1228:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1025:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1250:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1029:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1627:
+	.string	"readBuf"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1221:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1837:
+	.string	"baroGroundPressure"
+.LASF1625:
+	.string	"setRxFrameCallback"
+.LASF2131:
+	.string	"__res"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1205:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1330:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF2136:
+	.string	"cliReboot"
+.LASF1211:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1942:
+	.string	"motor_pwm_rate"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1587:
+	.string	"acc_s"
+.LASF1591:
+	.string	"acc_t"
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF982:
+	.string	"__DECL_SIMD_acos "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1245:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1239:
+	.string	"__MATHDECL_1"
+.LASF1501:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1022:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1643:
+	.string	"PIDMAG"
+.LASF1700:
+	.string	"rxConfig_t"
+.LASF2128:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1372:
+	.string	"USE_USART2 "
+.LASF1292:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF2116:
+	.string	"variableNameLength"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1143:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1661:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1751:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1603:
+	.string	"MODE_TX"
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1836:
+	.string	"gyroZero"
+.LASF1711:
+	.string	"BOXHORIZON"
+.LASF1086:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1443:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1938:
+	.string	"emf_avoidance"
+.LASF1853:
+	.string	"gyroSyncStats_s"
+.LASF1863:
+	.string	"gyroSyncStats_t"
+.LASF1821:
+	.string	"CW0_DEG_FLIP"
+.LASF1010:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1132:
+	.string	"__DECL_SIMD_acosh "
+.LASF1699:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF1944:
+	.string	"servo_pwm_rate"
+.LASF1040:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2019:
+	.string	"averageSystemLoadPercent"
+.LASF1649:
+	.string	"dterm_lpf_hz"
+.LASF1687:
+	.string	"failsafe_off_delay"
+.LASF2096:
+	.string	"cyclesPerMicrosecond"
+.LASF1745:
+	.string	"yawRate"
+.LASF1213:
+	.string	"_Mdouble_ double"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1963:
+	.string	"retarded_arm"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1898:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1811:
+	.string	"SENSOR_BARO"
+.LASF1638:
+	.string	"PIDALT"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2022:
+	.string	"cliPort"
+.LASF1724:
+	.string	"BOXLLIGHTS"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2134:
+	.string	"remove"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1318:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF978:
+	.string	"__DECL_SIMD_powf128 "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1903:
+	.string	"FEATURE_BLACKBOX"
+.LASF1712:
+	.string	"BOXBARO"
+.LASF1914:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1886:
+	.string	"FEATURE_VBAT"
+.LASF1622:
+	.string	"serialSetBaudRate"
+.LASF1669:
+	.string	"neutral3d"
+.LASF1304:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1367:
+	.string	"ACC "
+.LASF1640:
+	.string	"PIDPOSR"
+.LASF1791:
+	.string	"totalMicros"
+.LASF1362:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF1295:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1047:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1484:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF1968:
+	.string	"serialConfig"
+.LASF1123:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1569:
+	.string	"PROFILE_STAGE_MIXER"
+.LASF1517:
+	.string	"CLI_H_ "
+.LASF1068:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF981:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1179:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1985:
+	.string	"type"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2061:
+	.string	"strlen"
+.LASF1894:
+	.string	"FEATURE_SONAR"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1817:
+	.string	"CW0_DEG"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF1652:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1696:
+	.string	"midrc"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1081:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1654:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1529:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1531:
+	.string	"__uint16_t"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1460:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF392:
+	.string	"false 0"
+.LASF1048:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1370:
+	.string	"USE_BARO_SITL "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1754:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF1820:
+	.string	"CW270_DEG"
+.LASF1949:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1018:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1879:
+	.string	"gpsNoFixLatitude"
+.LASF995:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1803:
+	.string	"batteryCellCount"
+.LASF1781:
+	.string	"serialPortFunctionList_t"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1145:
+	.string	"__DECL_SIMD_erff16 "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1871:
+	.string	"frskyGpsCoordFormat_e"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF950:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2066:
+	.string	"getBootStageMilliseconds"
+.LASF1019:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1420:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1432:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1912:
+	.string	"mag_declination"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1347:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF1814:
+	.string	"SENSOR_GPS"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF1036:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1075:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1418:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1998:
+	.string	"TASK_PRIORITY_MAX"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1321:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1252:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1333:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1523:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1889:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2057:
+	.string	"configValueGet"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1888:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1354:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2150:
+	.string	"__base"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1465:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2041:
+	.string	"mixerLoadMix"
+.LASF1447:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1014:
+	.string	"__DECL_SIMD_hypotl "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1533:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1455:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1522:
+	.string	"float"
+.LASF1611:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1796:
+	.string	"vbatmaxcellvoltage"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1952:
+	.string	"attitude_estimator"
+.LASF2132:
+	.string	"cliHelp"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF1626:
+	.string	"writeBuf"
+.LASF1241:
+	.string	"__MATHDECL"
+.LASF1365:
+	.string	"GYRO "
+.LASF1697:
+	.string	"mincheck"
+.LASF1444:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2154:
+	.string	"__idx"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1907:
+	.string	"pidController"
+.LASF1856:
+	.string	"timeouts"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1419:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1353:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1005:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1725:
+	.string	"BOXCALIB"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2090:
+	.string	"target"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1446:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF1891:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF2151:
+	.string	"__nmemb"
+.LASF1038:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1552:
+	.string	"buildDate"
+.LASF1747:
+	.string	"FUNCTION_NONE"
+.LASF1280:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1674:
+	.string	"servoParam_t"
+.LASF1101:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1026:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1816:
+	.string	"ALIGN_DEFAULT"
+.LASF919:
+	.string	"_STRINGS_H 1"
+.LASF1417:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1070:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1721:
+	.string	"BOXBEEPERON"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1139:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1176:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF508:
+	.string	"__wur "
+.LASF1780:
+	.string	"functions"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1173:
+	.string	"__DECL_SIMD_erfcf "
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1845:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1269:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1588:
+	.string	"init"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1513:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF2025:
+	.string	"mixerNames"
+.LASF1698:
+	.string	"maxcheck"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF1737:
+	.string	"rangeEndStep"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1620:
+	.string	"serialTotalBytesWaiting"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1940:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1681:
+	.string	"loweredCount"
+.LASF1902:
+	.string	"FEATURE_DISPLAY"
+.LASF1632:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF1017:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1360:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2034:
+	.string	"DUMP_PROFILE"
+.LASF1707:
+	.string	"gimbal_flags"
+.LASF1982:
+	.string	"PROFILE_VALUE"
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1581:
+	.string	"totalCycles"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1043:
+	.string	"__DECL_SIMD_coshf "
+.LASF1052:
+	.string	"__DECL_SIMD_expm1 "
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1124:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1141:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF910:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1430:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1116:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1909:
+	.string	"controlRateConfig"
+.LASF1294:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF944:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1175:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1584:
+	.string	"sensorInitFuncPtr"
+.LASF1408:
+	.string	"PROFILE_STAGE_BEGIN(stage) profileStageBegin(stage)"
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF1235:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2118:
+	.string	"cliPrintVar"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1215:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1385:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1802:
+	.string	"vbat"
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1621:
+	.string	"serialRead"
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF2144:
+	.string	"mixsum"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF903:
+	.string	"_ANSI_STDARG_H_ "
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2113:
+	.string	"value"
+.LASF1560:
+	.string	"BOOT_STAGE_SIGNAL"
+.LASF931:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1094:
+	.string	"__DECL_SIMD_log10l "
+.LASF1873:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF1119:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1859:
+	.string	"maxLatency"
+.LASF1875:
+	.string	"telemetryConfig_s"
+.LASF1884:
+	.string	"telemetryConfig_t"
+.LASF971:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1337:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1134:
+	.string	"__DECL_SIMD_acoshl "
+.LASF911:
+	.string	"_VA_LIST_ "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1577:
+	.string	"startedAt"
+.LASF2147:
+	.string	"cliPrompt"
+.LASF1008:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF2018:
+	.string	"cfTaskId_e"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF922:
+	.string	"__DECL_SIMD_cos "
+.LASF1206:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2050:
+	.string	"featureMask"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1100:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2108:
+	.string	"cliGet"
+.LASF1003:
+	.string	"__DECL_SIMD_asinf "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1972:
+	.string	"current_profile_index"
+.LASF2123:
+	.string	"cliSave"
+.LASF1477:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1943:
+	.string	"dshot_rate"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1835:
+	.string	"calibrated"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1693:
+	.string	"rxConfig_s"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1558:
+	.string	"BOOT_STAGE_BUSES"
+.LASF1216:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1229:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF970:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1127:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1497:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF923:
+	.string	"__DECL_SIMD_cosf "
+.LASF1429:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1366:
+	.string	"USE_GYRO_SITL "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2110:
+	.string	"cliStatus"
+.LASF1282:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1279:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1544:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1684:
+	.string	"motor_disarmed"
+.LASF2071:
+	.string	"getMspCommandCount"
+.LASF2033:
+	.string	"DUMP_MASTER"
+.LASF1317:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF948:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1540:
+	.string	"uint8_t"
+.LASF1204:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1872:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1471:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF1973:
+	.string	"masterConfig"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2097:
+	.string	"stage"
+.LASF1775:
+	.string	"scenario"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1977:
+	.string	"VAR_UINT16"
+.LASF1219:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1842:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF988:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF975:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1180:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1142:
+	.string	"__DECL_SIMD_erf "
+.LASF1054:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2029:
+	.string	"param"
+.LASF1433:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1728:
+	.string	"BOXTELEMETRY"
+.LASF1049:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1293:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1402:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF989:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1468:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1732:
+	.string	"boxId_e"
+.LASF1364:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF376:
+	.string	"unix 1"
+.LASF1259:
+	.string	"FP_INFINITE 1"
+.LASF906:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1042:
+	.string	"__DECL_SIMD_cosh "
+.LASF1251:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1887:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF932:
+	.string	"__DECL_SIMD_sin "
+.LASF1976:
+	.string	"VAR_INT8"
+.LASF1749:
+	.string	"FUNCTION_CLI"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF1768:
+	.string	"SERIAL_PORT_USART2"
+.LASF945:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1566:
+	.string	"PROFILE_STAGE_IMU"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1428:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1457:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1958:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1612:
+	.string	"mode"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1435:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1755:
+	.string	"serialPortFunction_e"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1194:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1979:
+	.string	"VAR_UINT32"
+.LASF1997:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF1044:
+	.string	"__DECL_SIMD_coshl "
+.LASF1773:
+	.string	"serialPortFunction_s"
+.LASF1777:
+	.string	"serialPortFunction_t"
+.LASF1220:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1233:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2082:
+	.string	"profilingReset"
+.LASF1989:
+	.string	"float_value"
+.LASF1392:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1414:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1508:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF928:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1760:
+	.string	"SCENARIO_MSP_ONLY"
+.LASF1562:
+	.string	"BOOT_STAGE_FEATURES"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1169:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF960:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1441:
+	.string	"LON 1"
+.LASF1424:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1439:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF2083:
+	.string	"strncasecmp"
+.LASF1222:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1137:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2058:
+	.string	"configValueSet"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1361:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1390:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2158:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1742:
+	.string	"thrMid8"
+.LASF1078:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1310:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF1677:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1516:
+	.string	"sprintf tfp_sprintf"
+.LASF1479:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1870:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1327:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2137:
+	.string	"cliEnter"
+.LASF1736:
+	.string	"rangeStartStep"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1225:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1260:
+	.string	"FP_ZERO 2"
+.LASF1945:
+	.string	"sensorAlignmentConfig"
+.LASF1776:
+	.string	"currentFunction"
+.LASF1079:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1752:
+	.string	"FUNCTION_GPS"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF1135:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1844:
+	.string	"soft_gyro_notch_hz"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1574:
+	.string	"PROFILE_STAGE_BLACKBOX"
+.LASF1813:
+	.string	"SENSOR_SONAR"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1535:
+	.string	"__uint64_t"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF1519:
+	.string	"DUMP_ALL (DUMP_MASTER | DUMP_PROFILE)"
+.LASF1087:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1788:
+	.string	"reboot_character"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1682:
+	.string	"raisedCount"
+.LASF1927:
+	.string	"failsafeConfig"
+.LASF1323:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1407:
+	.string	"PROFILE_HISTOGRAM_BUCKET_COUNT 10"
+.LASF1183:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF2042:
+	.string	"strcasecmp"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF1374:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF1810:
+	.string	"SENSOR_ACC"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1664:
+	.string	"tri_unarmed_servo"
+.LASF1860:
+	.string	"totalLatency"
+.LASF1076:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1148:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1826:
+	.string	"sensorAlignmentConfig_s"
+.LASF1830:
+	.string	"sensorAlignmentConfig_t"
+.LASF980:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1790:
+	.string	"mspCommandStats_s"
+.LASF1793:
+	.string	"mspCommandStats_t"
+.LASF1520:
+	.string	"printSectionBreak() printf((char *)sectionBreak)"
+.LASF1453:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1935:
+	.string	"gyro_sync"
+.LASF924:
+	.string	"__DECL_SIMD_cosl "
+.LASF1651:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF1576:
+	.string	"profileStage_e"
+.LASF1709:
+	.string	"BOXARM"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1207:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF733:
+	.string	"NULL"
+.LASF1975:
+	.string	"VAR_UINT8"
+.LASF1996:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF2074:
+	.string	"getProfileStageName"
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF1461:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF1653:
+	.string	"pitch"
+.LASF1340:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1254:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2093:
+	.string	"cmdline"
+.LASF462:
+	.string	"__PMT"
+.LASF1120:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1970:
+	.string	"blackbox_rate_denom"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1877:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1646:
+	.string	"pidProfile_s"
+.LASF1650:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1878:
+	.string	"frsky_inversion"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1753:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF1332:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF1275:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1748:
+	.string	"FUNCTION_MSP"
+.LASF1829:
+	.string	"mag_align"
+.LASF1103:
+	.string	"__DECL_SIMD_log2f "
+.LASF1925:
+	.string	"throttle_correction_value"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1208:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1236:
+	.string	"_Mdouble_ _Float64x"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1152:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2051:
+	.string	"__ctype_toupper_loc"
+.LASF2149:
+	.string	"__key"
+.LASF1261:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1157:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1496:
+	.string	"GYRO_SYNC_TIMEOUT_PERIODS 4"
+.LASF1200:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1128:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF808:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1320:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF1185:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2141:
+	.string	"cliCMix"
+.LASF1805:
+	.string	"rollDegrees"
+.LASF2077:
+	.string	"getProfileCyclesPerMicrosecond"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1685:
+	.string	"failsafeConfig_s"
+.LASF1691:
+	.string	"failsafeConfig_t"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1389:
+	.string	"UNIT_TESTED "
+.LASF956:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1001:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1307:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1346:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1000:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1046:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1554:
+	.string	"RGB_RED"
+.LASF472:
+	.string	"__P(args) args"
+.LASF1462:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1571:
+	.string	"PROFILE_STAGE_SERIAL"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1302:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1839:
+	.string	"accDeadband_s"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1663:
+	.string	"yaw_direction"
+.LASF1543:
+	.string	"uint64_t"
+.LASF1509:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2039:
+	.string	"memset"
+.LASF2111:
+	.string	"cliSet"
+.LASF2027:
+	.string	"sensorNames"
+.LASF1980:
+	.string	"VAR_FLOAT"
+.LASF1929:
+	.string	"gimbalConfig"
+.LASF1339:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1442:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1171:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2160:
+	.string	"cliCompare"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF909:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1865:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF1413:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1298:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1118:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1984:
+	.string	"name"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2020:
+	.string	"cliMode"
+.LASF1351:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1489:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1537:
+	.string	"int8_t"
+.LASF1487:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF1765:
+	.string	"SCENARIO_BLACKBOX_ONLY"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2157:
+	.string	"__nptr"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1301:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pl "
+.LASF996:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1679:
+	.string	"mixCount"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1041:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2009:
+	.string	"TASK_SYSTEM"
+.LASF1683:
+	.string	"mixerSaturation_t"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF735:
+	.string	"__need_NULL"
+.LASF2056:
+	.string	"ftoa"
+.LASF1306:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF1253:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1799:
+	.string	"currentMeterOffset"
+.LASF1394:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1063:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1197:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2023:
+	.string	"cliBuffer"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF976:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1485:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF1107:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1604:
+	.string	"MODE_RXTX"
+.LASF992:
+	.string	"__DECL_SIMD_atan "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1572:
+	.string	"PROFILE_STAGE_TELEMETRY"
+.LASF1240:
+	.string	"__MATHDECL_ALIAS"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1969:
+	.string	"telemetryConfig"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1648:
+	.string	"H_level"
+.LASF2106:
+	.string	"mixerSaturation"
+.LASF2054:
+	.string	"systemReset"
+.LASF1924:
+	.string	"throttle_correction_angle"
+.LASF1015:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF1993:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF2000:
+	.string	"taskName"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1009:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1403:
+	.string	"HSV_HUE_MAX 359"
+.LASF1827:
+	.string	"gyro_align"
+.LASF1286:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1112:
+	.string	"__DECL_SIMD_log1p "
+.LASF2104:
+	.string	"commandStats"
+.LASF1849:
+	.string	"baro_noise_lpf"
+.LASF1184:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1270:
+	.string	"MATH_ERREXCEPT 2"
+.LASF993:
+	.string	"__DECL_SIMD_atanf "
+.LASF916:
+	.string	"_STRING_H 1"
+.LASF1538:
+	.string	"int16_t"
+.LASF1138:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1276:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2161:
+	.string	"__builtin_strchr"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1524:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1526:
+	.string	"signed char"
+.LASF1689:
+	.string	"failsafe_min_usec"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF940:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1733:
+	.string	"modeActivationCondition_s"
+.LASF1738:
+	.string	"modeActivationCondition_t"
+.LASF696:
+	.string	"__size_t__ "
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1256:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1382:
+	.string	"MW_VERSION 230"
+.LASF1505:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1196:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2085:
+	.string	"cliInit"
+.LASF1410:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1901:
+	.string	"FEATURE_LED_STRIP"
+.LASF1784:
+	.string	"msp_baudrate"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2010:
+	.string	"TASK_GYROPID"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1900:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1600:
+	.string	"SERIAL_INVERTED"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1140:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1395:
+	.string	"sq(x) ((x)*(x))"
+.LASF936:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2103:
+	.string	"stats"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2094:
+	.string	"taskInfo"
+.LASF2100:
+	.string	"syncStats"
+.LASF2153:
+	.string	"__compar"
+.LASF1578:
+	.string	"count"
+.LASF1244:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1391:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2091:
+	.string	"cliVersion"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1804:
+	.string	"boardAlignment_s"
+.LASF1808:
+	.string	"boardAlignment_t"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1555:
+	.string	"RGB_GREEN"
+.LASF2120:
+	.string	"cliWrite"
+.LASF2046:
+	.string	"featureClear"
+.LASF2063:
+	.string	"getSerialPortFunctionList"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1716:
+	.string	"BOXCAMSTAB"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1785:
+	.string	"cli_baudrate"
+.LASF2119:
+	.string	"full"
+.LASF1104:
+	.string	"__DECL_SIMD_log2l "
+.LASF1319:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF1287:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1628:
+	.string	"txReserve"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1454:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1690:
+	.string	"failsafe_max_usec"
+.LASF1994:
+	.string	"TASK_PRIORITY_LOW"
+.LASF1590:
+	.string	"revisionCode"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1770:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1771:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2125:
+	.string	"cliMotor"
+.LASF1549:
+	.string	"SystemCoreClock"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1987:
+	.string	"configValue_t"
+.LASF1129:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1981:
+	.string	"MASTER_VALUE"
+.LASF1868:
+	.string	"telemetryProvider_e"
+.LASF1226:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2105:
+	.string	"i2cErrorCounter"
+.LASF1174:
+	.string	"__DECL_SIMD_erfcl "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1916:
+	.string	"accDeadband"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1480:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF1376:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2124:
+	.string	"cliProfile"
+.LASF2035:
+	.string	"openSerialPort"
+.LASF1271:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF997:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF958:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1761:
+	.string	"SCENARIO_MSP_CLI_GPS_PASTHROUGH"
+.LASF1758:
+	.string	"SCENARIO_GPS_ONLY"
+.LASF1080:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1831:
+	.string	"knownSensors_s"
+.LASF1838:
+	.string	"knownSensors_t"
+.LASF1381:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF1617:
+	.string	"callback"
+.LASF2117:
+	.string	"cliSetVar"
+.LASF1278:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1506:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1195:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1232:
+	.string	"_Mdouble_ _Float128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF949:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1223:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2140:
+	.string	"dumpValues"
+.LASF1108:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF952:
+	.string	"__DECL_SIMD_log "
+.LASF1795:
+	.string	"vbatscale"
+.LASF2030:
+	.string	"func"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1312:
+	.string	"isascii(c) __isascii (c)"
+.LASF1896:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1995:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF1848:
+	.string	"baro_sample_count"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1345:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1609:
+	.string	"serialPort"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1473:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF1573:
+	.string	"PROFILE_STAGE_LEDSTRIP"
+.LASF2053:
+	.string	"readEEPROM"
+.LASF2135:
+	.string	"cliExit"
+.LASF1861:
+	.string	"maxJitter"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1511:
+	.string	"SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)"
+.LASF1451:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1109:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1734:
+	.string	"modeId"
+.LASF1495:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1767:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1769:
+	.string	"SERIAL_PORT_USART3"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1850:
+	.string	"baro_cf_vel"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2016:
+	.string	"TASK_BLACKBOX"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1035:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1534:
+	.string	"long int"
+.LASF1383:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1494:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF1855:
+	.string	"missedUpdates"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2107:
+	.string	"serialPortFunctionList"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1988:
+	.string	"int_value"
+.LASF941:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF2055:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1933:
+	.string	"enabledFeatures"
+.LASF1559:
+	.string	"BOOT_STAGE_SENSORS"
+.LASF1959:
+	.string	"knownSensors"
+.LASF1727:
+	.string	"BOXOSD"
+.LASF1864:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1881:
+	.string	"frsky_coordinate_format"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1828:
+	.string	"acc_align"
+.LASF2032:
+	.string	"cmdTable"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1386:
+	.string	"UNUSED(x) (void)(x)"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1815:
+	.string	"SENSOR_GPSMAG"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1481:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2078:
+	.string	"getGyroSyncStats"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1069:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1686:
+	.string	"failsafe_delay"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1930:
+	.string	"profile_t"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2012:
+	.string	"TASK_SERIAL"
+.LASF1794:
+	.string	"batteryConfig_s"
+.LASF1801:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2024:
+	.string	"bufferIndex"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1072:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2047:
+	.string	"strstr"
+.LASF2045:
+	.string	"featureSet"
+.LASF1437:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1948:
+	.string	"acc_hardware"
+.LASF912:
+	.string	"_VA_LIST "
+.LASF987:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1214:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1542:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF1004:
+	.string	"__DECL_SIMD_asinl "
+.LASF1553:
+	.string	"buildTime"
+.LASF1932:
+	.string	"mixerConfiguration"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1281:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1692:
+	.string	"rcChannelLetters"
+.LASF1102:
+	.string	"__DECL_SIMD_log2 "
+.LASF1406:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2059:
+	.string	"strtol"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1090:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1300:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1121:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2060:
+	.string	"fastA2F"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1719:
+	.string	"BOXGPSHOLD"
+.LASF1759:
+	.string	"SCENARIO_GPS_PASSTHROUGH_ONLY"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1756:
+	.string	"SCENARIO_UNUSED"
+.LASF1131:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1623:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1946:
+	.string	"boardAlignment"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF1883:
+	.string	"batterySize"
+.LASF1634:
+	.string	"inputFilteringMode_e"
+.LASF485:
+	.string	"__flexarr []"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1570:
+	.string	"PROFILE_STAGE_MOTORS"
+.LASF1344:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1521:
+	.string	"long unsigned int"
+.LASF1377:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1277:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1715:
+	.string	"BOXHEADADJ"
+.LASF1379:
+	.string	"FC_VERSION_MAJOR 1"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1399:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1950:
+	.string	"gyro_cmpf_factor"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF2011:
+	.string	"TASK_RX"
+.LASF1841:
+	.string	"gyroConfig_s"
+.LASF1846:
+	.string	"gyroConfig_t"
+.LASF1412:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1718:
+	.string	"BOXGPSHOME"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2095:
+	.string	"taskId"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2017:
+	.string	"TASK_COUNT"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1217:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1309:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1440:
+	.string	"LAT 0"
+.LASF1858:
+	.string	"minLatency"
+.LASF2127:
+	.string	"motor_value"
+.LASF1904:
+	.string	"FEATURE_ONESHOT125"
+.LASF1371:
+	.string	"USE_USART1 "
+.LASF1536:
+	.string	"char"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1639:
+	.string	"PIDPOS"
+.LASF1592:
+	.string	"ringBuffer_s"
+.LASF1098:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1741:
+	.string	"rcExpo8"
+.LASF1012:
+	.string	"__DECL_SIMD_hypot "
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF2031:
+	.string	"clicmd_t"
+.LASF1564:
+	.string	"BOOT_STAGE_COUNT"
+.LASF1672:
+	.string	"airplaneConfig_t"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1459:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1095:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2084:
+	.string	"tfp_printf"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF1990:
+	.string	"int_float_value_t"
+.LASF1322:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF905:
+	.string	"__GNUC_VA_LIST "
+.LASF1500:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF1659:
+	.string	"rollAndPitchTrims_t"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1851:
+	.string	"baro_cf_alt"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF927:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1099:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF991:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2002:
+	.string	"staticPriority"
+.LASF2101:
+	.string	"signalledUpdates"
+.LASF1291:
+	.string	"_CTYPE_H 1"
+.LASF391:
+	.string	"true 1"
+.LASF929:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1466:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2067:
+	.string	"sensors"
+.LASF2152:
+	.string	"__size"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1438:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1880:
+	.string	"gpsNoFixLongitude"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1812:
+	.string	"SENSOR_MAG"
+.LASF1892:
+	.string	"FEATURE_GPS"
+.LASF969:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1166:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1125:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF713:
+	.string	"__size_t "
+.LASF695:
+	.string	"__need_NULL "
+.LASF2070:
+	.string	"serialPrint"
+.LASF1421:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1416:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1673:
+	.string	"flaps_speed"
+.LASF1585:
+	.string	"sensorReadFuncPtr"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1064:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1325:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1499:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF1178:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1007:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1823:
+	.string	"CW180_DEG_FLIP"
+.LASF1493:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF2146:
+	.string	"validArgumentCount"
+.LASF1928:
+	.string	"mixerConfig"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1163:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2081:
+	.string	"gyroSyncResetStats"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1967:
+	.string	"fixedwing_althold_dir"
+.LASF1593:
+	.string	"buffer"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1231:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1890:
+	.string	"FEATURE_SERVO_TILT"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1268:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2013:
+	.string	"TASK_CONFIG"
+.LASF1582:
+	.string	"histogram"
+.LASF2004:
+	.string	"maxExecutionTime"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1504:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1375:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF1230:
+	.string	"_Mdouble_ _Float64"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1565:
+	.string	"bootStage_e"
+.LASF1033:
+	.string	"__DECL_SIMD_exp10f "
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1117:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1710:
+	.string	"BOXANGLE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2148:
+	.string	"bsearch"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1503:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1030:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1352:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1189:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF908:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF1490:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1658:
+	.string	"rollAndPitchTrims_t_def"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1840:
+	.string	"accDeadband_t"
+.LASF1800:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1857:
+	.string	"updates"
+.LASF1847:
+	.string	"barometerConfig_s"
+.LASF1852:
+	.string	"barometerConfig_t"
+.LASF904:
+	.string	"__need___va_list"
+.LASF371:
+	.string	"__linux 1"
+.LASF1296:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1255:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1288:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1258:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1960:
+	.string	"batteryConfig"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF810:
+	.string	"__id_t_defined "
+.LASF1962:
+	.string	"inputFilteringMode"
+.LASF1089:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1045:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1706:
+	.string	"gimbalConfig_s"
+.LASF1708:
+	.string	"gimbalConfig_t"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1818:
+	.string	"CW90_DEG"
+.LASF1297:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1983:
+	.string	"configValue_s"
+.LASF1825:
+	.string	"sensor_align_e"
+.LASF1326:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1177:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1951:
+	.string	"gyro_cmpfm_factor"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1906:
+	.string	"profile_s"
+.LASF2098:
+	.string	"bucket"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2112:
+	.string	"eqptr"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1557:
+	.string	"BOOT_STAGE_SYSTEM"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1077:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1463:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF959:
+	.string	"__DECL_SIMD_logf32x "
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1806:
+	.string	"pitchDegrees"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1792:
+	.string	"maxMicros"
+.LASF1193:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1147:
+	.string	"__DECL_SIMD_erff64 "
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1285:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1596:
+	.string	"tail"
+.LASF1303:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1548:
+	.string	"double"
+.LASF2026:
+	.string	"featureNames"
+.LASF2021:
+	.string	"cycleTime"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF985:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1869:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1082:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1192:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1743:
+	.string	"thrExpo8"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1212:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1843:
+	.string	"soft_gyro_lpf_hz"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1188:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1155:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1899:
+	.string	"FEATURE_RX_MSP"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1502:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF1159:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1762:
+	.string	"SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1452:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1273:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1867:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1731:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1532:
+	.string	"__int32_t"
+.LASF1961:
+	.string	"rxConfig"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1726:
+	.string	"BOXGOV"
+.LASF1922:
+	.string	"alt_hold_deadband"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1507:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1246:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1397:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1067:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2014:
+	.string	"TASK_BARO"
+.LASF1926:
+	.string	"servoConf"
+.LASF1393:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF1910:
+	.string	"dynThrPID"
+.LASF2079:
+	.string	"gyroSyncIsEnabled"
+.LASF1056:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1595:
+	.string	"head"
+.LASF1614:
+	.string	"baudRate"
+.LASF1458:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1714:
+	.string	"BOXHEADFREE"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1772:
+	.string	"serialPortIdentifier_e"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1423:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1786:
+	.string	"gps_baudrate"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1209:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF973:
+	.string	"__DECL_SIMD_powf "
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1616:
+	.string	"txBuffer"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF1335:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF979:
+	.string	"__DECL_SIMD_powf32x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2015:
+	.string	"TASK_ALTITUDE"
+.LASF1744:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2075:
+	.string	"getProfileStageAverageCycles"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1678:
+	.string	"mixerSaturation_s"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1475:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1002:
+	.string	"__DECL_SIMD_asin "
+.LASF1469:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1874:
+	.string	"frskyUnit_e"
+.LASF1091:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1242:
+	.string	"__MATHCALL"
+.LASF1096:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1164:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1314:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1575:
+	.string	"PROFILE_STAGE_COUNT"
+.LASF2099:
+	.string	"commandIndex"
+.LASF1032:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1400:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1234:
+	.string	"_Mdouble_ _Float32x"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1729:
+	.string	"BOXAUTOTUNE"
+.LASF1289:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1789:
+	.string	"serialConfig_t"
+.LASF1356:
+	.string	"__enable_irq() "
+.LASF1149:
+	.string	"__DECL_SIMD_erff32x "
+.LASF2069:
+	.string	"millis"
+.LASF1122:
+	.string	"__DECL_SIMD_atanh "
+.LASF935:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF1723:
+	.string	"BOXLEDLOW"
+.LASF1334:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1034:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1750:
+	.string	"FUNCTION_TELEMETRY"
+.LASF1783:
+	.string	"serial_port_scenario"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1862:
+	.string	"totalJitter"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1290:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1911:
+	.string	"tpa_breakpoint"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF1618:
+	.string	"serialPortVTable"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1013:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2008:
+	.string	"cfTaskInfo_t"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF947:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1448:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2005:
+	.string	"totalExecutionTime"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF998:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1668:
+	.string	"deadband3d_high"
+.LASF1606:
+	.string	"portMode_t"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1264:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1358:
+	.string	"U_ID_1 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1363:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1150:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1546:
+	.string	"long long unsigned int"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF1986:
+	.string	"offset"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1695:
+	.string	"serialrx_provider"
+.LASF977:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF943:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1547:
+	.string	"__compar_fn_t"
+.LASF1409:
+	.string	"PROFILE_STAGE_END(stage) profileStageEnd(stage)"
+.LASF2126:
+	.string	"motor_index"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF2092:
+	.string	"cliTasks"
+.LASF1954:
+	.string	"dcm_ki"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2130:
+	.string	"cliMap"
+.LASF999:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1953:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1350:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF2122:
+	.string	"cliDefaults"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1023:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF939:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF1283:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1657:
+	.string	"rollAndPitchTrims_s"
+.LASF1662:
+	.string	"mixerConfig_s"
+.LASF1665:
+	.string	"mixerConfig_t"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1607:
+	.string	"serialReceiveCallbackPtr"
+.LASF1882:
+	.string	"frsky_unit"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF962:
+	.string	"__DECL_SIMD_exp "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1431:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1313:
+	.string	"toascii(c) __toascii (c)"
+.LASF1798:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1601:
+	.string	"serialInversion_e"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1227:
+	.string	"_Mdouble_ _Float32"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1936:
+	.string	"gyro_sync_denom"
+.LASF1238:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2086:
+	.string	"cliProcess"
+.LASF1186:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1113:
+	.string	"__DECL_SIMD_log1pf "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1058:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1580:
+	.string	"maxCycles"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1057:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1778:
+	.string	"serialPortFunctionList_s"
+.LASF2142:
+	.string	"check"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2088:
+	.string	"pend"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1348:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1476:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1613:
+	.string	"inversion"
+.LASF1020:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1422:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF914:
+	.string	"_VA_LIST_T_H "
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1739:
+	.string	"controlRateConfig_s"
+.LASF937:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1615:
+	.string	"rxBuffer"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1680:
+	.string	"pidScaledCount"
+.LASF1153:
+	.string	"__DECL_SIMD_tanhf "
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+.LASF1666:
+	.string	"flight3DConfig_s"
+.LASF1671:
+	.string	"flight3DConfig_t"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1299:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1630:
+	.string	"serialPort_t"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1740:
+	.string	"rcRate8"
+.LASF1918:
+	.string	"acc_unarmedcal"
+.LASF930:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2006:
+	.string	"averageExecutionTime"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF983:
+	.string	"__DECL_SIMD_acosf "
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF994:
+	.string	"__DECL_SIMD_atanl "
+.LASF2089:
+	.string	"sectionBreak"
+.LASF1445:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1605:
+	.string	"MODE_SBUS"
+.LASF1380:
+	.string	"FC_VERSION_MINOR 0"
+.LASF1456:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2138:
+	.string	"cliDump"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1512:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF2049:
+	.string	"strchr"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1092:
+	.string	"__DECL_SIMD_log10 "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1764:
+	.string	"SCENARIO_TELEMETRY_ONLY"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1316:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1093:
+	.string	"__DECL_SIMD_log10f "
+.LASF1031:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2065:
+	.string	"getBootStageName"
+.LASF1065:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2129:
+	.string	"cliMixer"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF986:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1411:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1488:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1073:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2037:
+	.string	"setPrintfSerialPort"
+.LASF974:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF1545:
+	.string	"long long int"
+.LASF1249:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1774:
+	.string	"port"
+.LASF951:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1897:
+	.string	"FEATURE_3D"
+.LASF1156:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF907:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1934:
+	.string	"looptime"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF2076:
+	.string	"getProfileStageStats"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2043:
+	.string	"resetEEPROM"
+.LASF1450:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1401:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1308:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1919:
+	.string	"modeActivationConditions"
+.LASF1694:
+	.string	"rcmap"
+.LASF1809:
+	.string	"SENSOR_GYRO"
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1579:
+	.string	"minCycles"
+.LASF1324:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1384:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1343:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1641:
+	.string	"PIDNAVR"
+.LASF1908:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1449:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1923:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1284:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1373:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF1247:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF925:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1834:
+	.string	"baroHardware"
+.LASF1224:
+	.string	"_Mdouble_ long double"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1905:
+	.string	"FEATURE_DSHOT"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2143:
+	.string	"num_motors"
+.LASF1355:
+	.string	"__disable_irq() "
+.LASF1645:
+	.string	"PID_ITEM_COUNT"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF933:
+	.string	"__DECL_SIMD_sinf "
+.LASF1266:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF2073:
+	.string	"getMspCommandStats"
+.LASF1876:
+	.string	"telemetry_provider"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2068:
+	.string	"sensorsMask"
+.LASF917:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1349:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1151:
+	.string	"__DECL_SIMD_erff128x "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1198:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1915:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2064:
+	.string	"getMixerSaturation"
+.LASF2038:
+	.string	"beginSerialPortFunction"
+.LASF1957:
+	.string	"accZero"
+.LASF1833:
+	.string	"accHardware"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1024:
+	.string	"__DECL_SIMD_exp2l "
+.LASF961:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1210:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1947:
+	.string	"yaw_control_direction"
+.LASF1514:
+	.string	"__TFP_PRINTF__ "
+.LASF1527:
+	.string	"__int8_t"
+.LASF966:
+	.string	"__DECL_SIMD_expf32 "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1598:
+	.string	"ringBuffer_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1472:
+	.string	"MAX_MSP_PORT_COUNT 2"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2007:
+	.string	"latestDeltaTime"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1667:
+	.string	"deadband3d_low"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1425:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1136:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1939:
+	.string	"customMixer"
+.LASF1525:
+	.string	"unsigned int"
+.LASF1016:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1181:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1257:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1498:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1474:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2044:
+	.string	"mixerResetMotors"
+.LASF1083:
+	.string	"__DECL_SIMD_atan2f "
+.LASF942:
+	.string	"__DECL_SIMD_sincos "
+.LASF1702:
+	.string	"minthrottle"
+.LASF1154:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1720:
+	.string	"BOXPASSTHRU"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1203:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1530:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1551:
+	.string	"shortGitRevision"
+.LASF1920:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF968:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1676:
+	.string	"rate"
+.LASF1144:
+	.string	"__DECL_SIMD_erfl "
+.LASF1717:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1971:
+	.string	"profile"
+.LASF946:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1434:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1201:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2036:
+	.string	"findOpenSerialPort"
+.LASF1999:
+	.string	"cfTaskPriority_e"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1819:
+	.string	"CW180_DEG"
+.LASF1039:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1931:
+	.string	"master_t"
+.LASF1568:
+	.string	"PROFILE_STAGE_PID"
+.LASF1515:
+	.string	"printf tfp_printf"
+.LASF902:
+	.string	"_STDARG_H "
+.LASF2040:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1272:
+	.string	"M_E 2.7182818284590452354"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF957:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1168:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1797:
+	.string	"vbatmincellvoltage"
+.LASF1357:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1074:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/io/serial_cli.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,47390 @@
+	.file	"serial_msp.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/io/serial_msp.c"
+	.section	.text.mspMagCalibration,"ax",@progbits
+	.p2align 4
+	.type	mspMagCalibration, @function
+mspMagCalibration:
+.LFB74:
+	.file 1 ".//src/main/io/serial_msp.c"
+	.loc 1 1410 1 view -0
+	.cfi_startproc
+	.loc 1 1411 5 view .LVU1
+	.loc 1 1411 17 is_stmt 0 view .LVU2
+	orb	$4, stateFlags(%rip)
+	.loc 1 1412 5 is_stmt 1 view .LVU3
+	.loc 1 1413 1 is_stmt 0 view .LVU4
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE74:
+	.size	mspMagCalibration, .-mspMagCalibration
+	.section	.text.mspReboot,"ax",@progbits
+	.p2align 4
+	.type	mspReboot, @function
+mspReboot:
+.LFB83:
+	.loc 1 1563 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1564 5 view .LVU6
+	.loc 1 1564 23 is_stmt 0 view .LVU7
+	movb	$1, isRebootScheduled(%rip)
+	.loc 1 1565 5 is_stmt 1 view .LVU8
+	.loc 1 1566 1 is_stmt 0 view .LVU9
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE83:
+	.size	mspReboot, .-mspReboot
+	.section	.text.mspEepromWrite,"ax",@progbits
+	.p2align 4
+	.type	mspEepromWrite, @function
+mspEepromWrite:
+.LFB75:
+	.loc 1 1416 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1417 5 view .LVU11
+	.loc 1 1416 1 is_stmt 0 view .LVU12
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 1417 5 view .LVU13
+	xorl	%eax, %eax
+	call	writeEEPROM@PLT
+.LVL0:
+	.loc 1 1418 5 is_stmt 1 view .LVU14
+	call	readEEPROM@PLT
+.LVL1:
+	.loc 1 1419 5 view .LVU15
+	.loc 1 1420 1 is_stmt 0 view .LVU16
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE75:
+	.size	mspEepromWrite, .-mspEepromWrite
+	.section	.text.mspResetConf,"ax",@progbits
+	.p2align 4
+	.type	mspResetConf, @function
+mspResetConf:
+.LFB72:
+	.loc 1 1397 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1398 5 view .LVU18
+	.loc 1 1397 1 is_stmt 0 view .LVU19
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 1398 5 view .LVU20
+	call	resetEEPROM@PLT
+.LVL2:
+	.loc 1 1399 5 is_stmt 1 view .LVU21
+	call	readEEPROM@PLT
+.LVL3:
+	.loc 1 1400 5 view .LVU22
+	.loc 1 1401 1 is_stmt 0 view .LVU23
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE72:
+	.size	mspResetConf, .-mspResetConf
+	.section	.text.mspAccCalibration,"ax",@progbits
+	.p2align 4
+	.type	mspAccCalibration, @function
+mspAccCalibration:
+.LFB73:
+	.loc 1 1404 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1405 5 view .LVU25
+	.loc 1 1404 1 is_stmt 0 view .LVU26
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 1405 5 view .LVU27
+	movl	$400, %edi
+	call	accSetCalibrationCycles@PLT
+.LVL4:
+	.loc 1 1406 5 is_stmt 1 view .LVU28
+	.loc 1 1407 1 is_stmt 0 view .LVU29
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE73:
+	.size	mspAccCalibration, .-mspAccCalibration
+	.section	.text.mspSetRxMap,"ax",@progbits
+	.p2align 4
+	.type	mspSetRxMap, @function
+mspSetRxMap:
+.LFB82:
+	.loc 1 1514 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1515 5 view .LVU31
+	.loc 1 1517 5 view .LVU32
+.LVL5:
+	.loc 1 1517 19 view .LVU33
+.LBB112:
+.LBB113:
+	.loc 1 435 20 is_stmt 0 view .LVU34
+	movq	currentPort(%rip), %rsi
+	leaq	310+masterConfig(%rip), %rdx
+	leaq	8(%rdx), %rdi
+	.loc 1 435 42 view .LVU35
+	movzwl	48(%rsi), %r8d
+.LVL6:
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 435 42 view .LVU36
+.LBE113:
+.LBE112:
+	.loc 1 1518 9 is_stmt 1 view .LVU37
+.LBB115:
+.LBI112:
+	.loc 1 432 9 view .LVU38
+.LBB114:
+	.loc 1 435 5 view .LVU39
+	.loc 1 435 20 is_stmt 0 view .LVU40
+	movzwl	52(%rsi), %eax
+	.loc 1 436 16 view .LVU41
+	xorl	%ecx, %ecx
+	.loc 1 435 8 view .LVU42
+	cmpw	%r8w, %ax
+	jnb	.L11
+	.loc 1 439 5 is_stmt 1 view .LVU43
+	.loc 1 439 49 is_stmt 0 view .LVU44
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rsi)
+	.loc 1 439 53 view .LVU45
+	movzbl	54(%rsi,%rax), %ecx
+.L11:
+.LBE114:
+.LBE115:
+	.loc 1 1518 40 view .LVU46
+	movb	%cl, (%rdx)
+	.loc 1 1517 25 is_stmt 1 view .LVU47
+.LVL7:
+	.loc 1 1517 19 view .LVU48
+	addq	$1, %rdx
+.LVL8:
+	.loc 1 1517 19 is_stmt 0 view .LVU49
+	cmpq	%rdi, %rdx
+	jne	.L12
+	.loc 1 1520 5 is_stmt 1 view .LVU50
+	.loc 1 1521 1 is_stmt 0 view .LVU51
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE82:
+	.size	mspSetRxMap, .-mspSetRxMap
+	.section	.text.mspSetChannelForwarding,"ax",@progbits
+	.p2align 4
+	.type	mspSetChannelForwarding, @function
+mspSetChannelForwarding:
+.LFB71:
+	.loc 1 1387 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1388 5 view .LVU53
+	.loc 1 1390 5 view .LVU54
+.LVL9:
+	.loc 1 1390 19 view .LVU55
+.LBB118:
+.LBB119:
+	.loc 1 435 20 is_stmt 0 view .LVU56
+	movq	currentPort(%rip), %rsi
+.LBE119:
+.LBE118:
+	.loc 1 1391 23 view .LVU57
+	movq	currentProfile(%rip), %rdi
+.LBB122:
+.LBB120:
+	.loc 1 435 42 view .LVU58
+	movzwl	48(%rsi), %r8d
+	leaq	467(%rdi), %rdx
+	addq	$531, %rdi
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 435 42 view .LVU59
+.LBE120:
+.LBE122:
+	.loc 1 1391 9 is_stmt 1 view .LVU60
+.LBB123:
+.LBI118:
+	.loc 1 432 9 view .LVU61
+.LBB121:
+	.loc 1 435 5 view .LVU62
+	.loc 1 435 20 is_stmt 0 view .LVU63
+	movzwl	52(%rsi), %eax
+	xorl	%ecx, %ecx
+	.loc 1 435 8 view .LVU64
+	cmpw	%r8w, %ax
+	jnb	.L16
+	.loc 1 439 5 is_stmt 1 view .LVU65
+	.loc 1 439 49 is_stmt 0 view .LVU66
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rsi)
+.LBE121:
+.LBE123:
+	.loc 1 1391 59 view .LVU67
+	movzbl	54(%rsi,%rax), %ecx
+.L16:
+	.loc 1 1391 57 view .LVU68
+	movb	%cl, (%rdx)
+	.loc 1 1390 25 is_stmt 1 view .LVU69
+.LVL11:
+	.loc 1 1390 19 view .LVU70
+	addq	$8, %rdx
+.LVL12:
+	.loc 1 1390 19 is_stmt 0 view .LVU71
+	cmpq	%rdi, %rdx
+	jne	.L17
+	.loc 1 1393 5 is_stmt 1 view .LVU72
+	.loc 1 1394 1 is_stmt 0 view .LVU73
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE71:
+	.size	mspSetChannelForwarding, .-mspSetChannelForwarding
+	.section	.text.mspSetMotor,"ax",@progbits
+	.p2align 4
+	.type	mspSetMotor, @function
+mspSetMotor:
+.LFB69:
+	.loc 1 1358 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1359 5 view .LVU75
+	.loc 1 1361 5 view .LVU76
+.LVL13:
+	.loc 1 1361 19 view .LVU77
+.LBB130:
+.LBB131:
+.LBB132:
+.LBB133:
+	.loc 1 435 20 is_stmt 0 view .LVU78
+	movq	currentPort(%rip), %rdi
+	leaq	motor_disarmed(%rip), %rdx
+	leaq	16(%rdx), %r9
+	.loc 1 435 42 view .LVU79
+	movzwl	48(%rdi), %r8d
+.LVL14:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.loc 1 435 42 view .LVU80
+.LBE133:
+.LBE132:
+.LBE131:
+.LBE130:
+	.loc 1 1362 9 is_stmt 1 view .LVU81
+.LBB139:
+.LBI130:
+	.loc 1 442 10 view .LVU82
+.LBB138:
+	.loc 1 444 5 view .LVU83
+.LBB135:
+.LBI132:
+	.loc 1 432 9 view .LVU84
+.LBB134:
+	.loc 1 435 5 view .LVU85
+	.loc 1 435 20 is_stmt 0 view .LVU86
+	movzwl	52(%rdi), %eax
+	xorl	%ecx, %ecx
+	.loc 1 435 8 view .LVU87
+	cmpw	%r8w, %ax
+	jnb	.L21
+	.loc 1 439 5 is_stmt 1 view .LVU88
+	.loc 1 439 49 is_stmt 0 view .LVU89
+	leal	1(%rax), %esi
+	.loc 1 439 53 view .LVU90
+	movzwl	%ax, %ecx
+	.loc 1 439 49 view .LVU91
+	movw	%si, 52(%rdi)
+.LBE134:
+.LBE135:
+	.loc 1 444 14 view .LVU92
+	movzbl	54(%rdi,%rcx), %ecx
+.LVL15:
+	.loc 1 445 5 is_stmt 1 view .LVU93
+.LBB136:
+.LBI136:
+	.loc 1 432 9 view .LVU94
+.LBB137:
+	.loc 1 435 5 view .LVU95
+	.loc 1 435 8 is_stmt 0 view .LVU96
+	cmpw	%r8w, %si
+	jnb	.L21
+	.loc 1 439 5 is_stmt 1 view .LVU97
+	.loc 1 439 49 is_stmt 0 view .LVU98
+	addl	$2, %eax
+	.loc 1 439 53 view .LVU99
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU100
+	movw	%ax, 52(%rdi)
+.LBE137:
+.LBE136:
+	.loc 1 445 10 view .LVU101
+	movzbl	54(%rdi,%rsi), %eax
+	.loc 1 445 28 view .LVU102
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU103
+	addl	%eax, %ecx
+.LVL16:
+.L21:
+	.loc 1 446 5 is_stmt 1 view .LVU104
+.LBE138:
+.LBE139:
+	.loc 1 1362 27 is_stmt 0 view .LVU105
+	movw	%cx, (%rdx)
+	.loc 1 1361 25 is_stmt 1 view .LVU106
+.LVL17:
+	.loc 1 1361 19 view .LVU107
+	addq	$2, %rdx
+.LVL18:
+	.loc 1 1361 19 is_stmt 0 view .LVU108
+	cmpq	%rdx, %r9
+	jne	.L23
+	.loc 1 1363 5 is_stmt 1 view .LVU109
+	.loc 1 1364 1 is_stmt 0 view .LVU110
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE69:
+	.size	mspSetMotor, .-mspSetMotor
+	.section	.text.mspSetRawRc,"ax",@progbits
+	.p2align 4
+	.type	mspSetRawRc, @function
+mspSetRawRc:
+.LFB63:
+	.loc 1 1257 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1258 5 view .LVU112
+	.loc 1 1261 5 view .LVU113
+.LVL19:
+	.loc 1 1261 19 view .LVU114
+	.loc 1 1257 1 is_stmt 0 view .LVU115
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB146:
+.LBB147:
+.LBB148:
+.LBB149:
+	.loc 1 435 20 view .LVU116
+	movq	currentPort(%rip), %rdi
+	leaq	rcData(%rip), %rdx
+	leaq	16(%rdx), %r9
+	.loc 1 435 42 view .LVU117
+	movzwl	48(%rdi), %r8d
+.LVL20:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 435 42 view .LVU118
+.LBE149:
+.LBE148:
+.LBE147:
+.LBE146:
+	.loc 1 1262 9 is_stmt 1 view .LVU119
+.LBB155:
+.LBI146:
+	.loc 1 442 10 view .LVU120
+.LBB154:
+	.loc 1 444 5 view .LVU121
+.LBB151:
+.LBI148:
+	.loc 1 432 9 view .LVU122
+.LBB150:
+	.loc 1 435 5 view .LVU123
+	.loc 1 435 20 is_stmt 0 view .LVU124
+	movzwl	52(%rdi), %eax
+	xorl	%ecx, %ecx
+	.loc 1 435 8 view .LVU125
+	cmpw	%r8w, %ax
+	jnb	.L27
+	.loc 1 439 5 is_stmt 1 view .LVU126
+	.loc 1 439 49 is_stmt 0 view .LVU127
+	leal	1(%rax), %esi
+	.loc 1 439 53 view .LVU128
+	movzwl	%ax, %ecx
+	.loc 1 439 49 view .LVU129
+	movw	%si, 52(%rdi)
+.LBE150:
+.LBE151:
+	.loc 1 444 14 view .LVU130
+	movzbl	54(%rdi,%rcx), %ecx
+.LVL21:
+	.loc 1 445 5 is_stmt 1 view .LVU131
+.LBB152:
+.LBI152:
+	.loc 1 432 9 view .LVU132
+.LBB153:
+	.loc 1 435 5 view .LVU133
+	.loc 1 435 8 is_stmt 0 view .LVU134
+	cmpw	%r8w, %si
+	jnb	.L27
+	.loc 1 439 5 is_stmt 1 view .LVU135
+	.loc 1 439 49 is_stmt 0 view .LVU136
+	addl	$2, %eax
+	.loc 1 439 53 view .LVU137
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU138
+	movw	%ax, 52(%rdi)
+.LBE153:
+.LBE152:
+	.loc 1 445 10 view .LVU139
+	movzbl	54(%rdi,%rsi), %eax
+	.loc 1 445 28 view .LVU140
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU141
+	addl	%eax, %ecx
+.LVL22:
+.L27:
+	.loc 1 446 5 is_stmt 1 view .LVU142
+.LBE154:
+.LBE155:
+	.loc 1 1262 19 is_stmt 0 view .LVU143
+	movw	%cx, (%rdx)
+	.loc 1 1261 25 is_stmt 1 view .LVU144
+.LVL23:
+	.loc 1 1261 19 view .LVU145
+	addq	$2, %rdx
+.LVL24:
+	.loc 1 1261 19 is_stmt 0 view .LVU146
+	cmpq	%rdx, %r9
+	jne	.L29
+	.loc 1 1263 5 is_stmt 1 view .LVU147
+	call	rxMspFrameRecieve@PLT
+.LVL25:
+	.loc 1 1264 5 view .LVU148
+	.loc 1 1265 1 is_stmt 0 view .LVU149
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE63:
+	.size	mspSetRawRc, .-mspSetRawRc
+	.section	.text.mspSetServoConf,"ax",@progbits
+	.p2align 4
+	.type	mspSetServoConf, @function
+mspSetServoConf:
+.LFB70:
+	.loc 1 1367 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1368 5 view .LVU151
+	.loc 1 1370 5 view .LVU152
+.LVL26:
+	.loc 1 1370 19 view .LVU153
+.LBB177:
+	.loc 1 1371 23 is_stmt 0 view .LVU154
+	movq	currentProfile(%rip), %r9
+.LBB178:
+.LBB179:
+.LBB180:
+.LBB181:
+	.loc 1 435 20 view .LVU155
+	movq	currentPort(%rip), %rax
+	leaq	460(%r9), %rcx
+	.loc 1 435 42 view .LVU156
+	movzwl	48(%rax), %esi
+	addq	$524, %r9
+	jmp	.L47
+.LVL27:
+	.p2align 4,,10
+	.p2align 3
+.L57:
+	.loc 1 439 5 is_stmt 1 view .LVU157
+	.loc 1 439 49 is_stmt 0 view .LVU158
+	leal	1(%rdx), %r8d
+	.loc 1 439 53 view .LVU159
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU160
+	movw	%r8w, 52(%rax)
+.LBE181:
+.LBE180:
+	.loc 1 444 14 view .LVU161
+	movzbl	54(%rax,%rdi), %r10d
+.LVL28:
+	.loc 1 445 5 is_stmt 1 view .LVU162
+.LBB183:
+.LBI183:
+	.loc 1 432 9 view .LVU163
+.LBB184:
+	.loc 1 435 5 view .LVU164
+	.loc 1 435 8 is_stmt 0 view .LVU165
+	cmpw	%si, %r8w
+	jnb	.L52
+	.loc 1 439 5 is_stmt 1 view .LVU166
+	.loc 1 439 49 is_stmt 0 view .LVU167
+	leal	2(%rdx), %edi
+	.loc 1 439 53 view .LVU168
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU169
+	movw	%di, 52(%rax)
+.LVL29:
+	.loc 1 439 49 view .LVU170
+.LBE184:
+.LBE183:
+	.loc 1 446 5 is_stmt 1 view .LVU171
+	.loc 1 445 10 is_stmt 0 view .LVU172
+	movzbl	54(%rax,%r8), %r8d
+	.loc 1 445 28 view .LVU173
+	sall	$8, %r8d
+	.loc 1 445 7 view .LVU174
+	addl	%r8d, %r10d
+	movw	%r10w, (%rcx)
+.LBE179:
+.LBE178:
+	.loc 1 1372 9 is_stmt 1 view .LVU175
+.LBB188:
+.LBI188:
+	.loc 1 442 10 view .LVU176
+.LBB189:
+	.loc 1 444 5 view .LVU177
+.LBB190:
+.LBI190:
+	.loc 1 432 9 view .LVU178
+.LBB191:
+	.loc 1 435 5 view .LVU179
+	.loc 1 435 8 is_stmt 0 view .LVU180
+	cmpw	%si, %di
+	jnb	.L50
+	.loc 1 439 5 is_stmt 1 view .LVU181
+	.loc 1 439 49 is_stmt 0 view .LVU182
+	leal	3(%rdx), %r8d
+	.loc 1 439 53 view .LVU183
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU184
+	movw	%r8w, 52(%rax)
+.LBE191:
+.LBE190:
+	.loc 1 444 14 view .LVU185
+	movzbl	54(%rax,%rdi), %r10d
+.LVL30:
+	.loc 1 445 5 is_stmt 1 view .LVU186
+.LBB194:
+.LBI194:
+	.loc 1 432 9 view .LVU187
+.LBB195:
+	.loc 1 435 5 view .LVU188
+	.loc 1 435 8 is_stmt 0 view .LVU189
+	cmpw	%si, %r8w
+	jnb	.L53
+	.loc 1 439 5 is_stmt 1 view .LVU190
+	.loc 1 439 49 is_stmt 0 view .LVU191
+	leal	4(%rdx), %edi
+	.loc 1 439 53 view .LVU192
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU193
+	movw	%di, 52(%rax)
+.LVL31:
+	.loc 1 439 49 view .LVU194
+.LBE195:
+.LBE194:
+	.loc 1 446 5 is_stmt 1 view .LVU195
+	.loc 1 445 10 is_stmt 0 view .LVU196
+	movzbl	54(%rax,%r8), %r8d
+	.loc 1 445 28 view .LVU197
+	sall	$8, %r8d
+	.loc 1 445 7 view .LVU198
+	addl	%r8d, %r10d
+	movw	%r10w, 2(%rcx)
+.LBE189:
+.LBE188:
+	.loc 1 1374 9 is_stmt 1 view .LVU199
+.LBB201:
+.LBI201:
+	.loc 1 442 10 view .LVU200
+.LBB202:
+	.loc 1 444 5 view .LVU201
+.LBB203:
+.LBI203:
+	.loc 1 432 9 view .LVU202
+.LBB204:
+	.loc 1 435 5 view .LVU203
+	.loc 1 435 8 is_stmt 0 view .LVU204
+	cmpw	%si, %di
+	jnb	.L51
+	.loc 1 439 5 is_stmt 1 view .LVU205
+	.loc 1 439 49 is_stmt 0 view .LVU206
+	leal	5(%rdx), %r8d
+	.loc 1 439 53 view .LVU207
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU208
+	movw	%r8w, 52(%rax)
+	.loc 1 439 53 view .LVU209
+	movzbl	54(%rax,%rdi), %edi
+.LVL32:
+	.loc 1 439 53 view .LVU210
+.LBE204:
+.LBE203:
+	.loc 1 445 5 is_stmt 1 view .LVU211
+.LBB208:
+.LBI208:
+	.loc 1 432 9 view .LVU212
+.LBB209:
+	.loc 1 435 5 view .LVU213
+	.loc 1 435 8 is_stmt 0 view .LVU214
+	cmpw	%si, %r8w
+	jnb	.L54
+	.loc 1 439 5 is_stmt 1 view .LVU215
+	.loc 1 439 49 is_stmt 0 view .LVU216
+	leal	6(%rdx), %r10d
+	.loc 1 439 53 view .LVU217
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU218
+	movw	%r10w, 52(%rax)
+.LBE209:
+.LBE208:
+	.loc 1 445 10 view .LVU219
+	movzbl	54(%rax,%r8), %r8d
+	.loc 1 445 28 view .LVU220
+	sall	$8, %r8d
+	.loc 1 445 7 view .LVU221
+	addl	%r8d, %edi
+.LVL33:
+	.loc 1 446 5 is_stmt 1 view .LVU222
+	.loc 1 446 5 is_stmt 0 view .LVU223
+.LBE202:
+.LBE201:
+	.loc 1 1375 9 is_stmt 1 view .LVU224
+	.loc 1 1375 12 is_stmt 0 view .LVU225
+	cmpw	$7, %di
+	jbe	.L55
+	.loc 1 1378 9 is_stmt 1 view .LVU226
+	.loc 1 1378 60 is_stmt 0 view .LVU227
+	leal	-1000(%rdi), %r8d
+	.loc 1 1378 12 view .LVU228
+	cmpw	$1000, %r8w
+	ja	.L44
+	.loc 1 1379 13 is_stmt 1 view .LVU229
+	.loc 1 1379 49 is_stmt 0 view .LVU230
+	movw	%di, 4(%rcx)
+.LVL34:
+.L44:
+	.loc 1 1381 9 is_stmt 1 discriminator 2 view .LVU231
+.LBB217:
+.LBI217:
+	.loc 1 432 9 discriminator 2 view .LVU232
+.LBB218:
+	.loc 1 435 5 discriminator 2 view .LVU233
+	.loc 1 435 8 is_stmt 0 discriminator 2 view .LVU234
+	cmpw	%si, %r10w
+	jnb	.L36
+	.loc 1 439 5 is_stmt 1 view .LVU235
+	.loc 1 439 49 is_stmt 0 view .LVU236
+	addl	$7, %edx
+	.loc 1 439 53 view .LVU237
+	movzwl	%r10w, %r10d
+.LBE218:
+.LBE217:
+.LBE177:
+	.loc 1 1370 19 view .LVU238
+	addq	$8, %rcx
+.LVL35:
+.LBB238:
+.LBB224:
+.LBB219:
+	.loc 1 439 49 view .LVU239
+	movw	%dx, 52(%rax)
+.LBE219:
+.LBE224:
+	.loc 1 1381 45 view .LVU240
+	movzbl	54(%rax,%r10), %edx
+	.loc 1 1381 43 view .LVU241
+	movb	%dl, -2(%rcx)
+.LBE238:
+	.loc 1 1370 25 is_stmt 1 view .LVU242
+.LVL36:
+	.loc 1 1370 19 view .LVU243
+	cmpq	%rcx, %r9
+	je	.L56
+.LVL37:
+.L47:
+.LBB239:
+	.loc 1 1371 9 view .LVU244
+.LBB225:
+.LBI178:
+	.loc 1 442 10 view .LVU245
+.LBB186:
+	.loc 1 444 5 view .LVU246
+.LBB185:
+.LBI180:
+	.loc 1 432 9 view .LVU247
+.LBB182:
+	.loc 1 435 5 view .LVU248
+	.loc 1 435 20 is_stmt 0 view .LVU249
+	movzwl	52(%rax), %edx
+	.loc 1 435 8 view .LVU250
+	cmpw	%si, %dx
+	jb	.L57
+.LBE182:
+.LBE185:
+	.loc 1 446 5 is_stmt 1 view .LVU251
+.LBE186:
+.LBE225:
+	.loc 1 1371 42 is_stmt 0 view .LVU252
+	xorl	%edi, %edi
+	movw	%di, (%rcx)
+.L50:
+	.loc 1 1372 9 is_stmt 1 view .LVU253
+.LBB226:
+	.loc 1 442 10 view .LVU254
+.LBB198:
+	.loc 1 444 5 view .LVU255
+.LBB196:
+	.loc 1 432 9 view .LVU256
+.LBB192:
+	.loc 1 435 5 view .LVU257
+.LBE192:
+.LBE196:
+	.loc 1 446 5 view .LVU258
+.LBE198:
+.LBE226:
+	.loc 1 1372 42 is_stmt 0 view .LVU259
+	xorl	%edx, %edx
+	movw	%dx, 2(%rcx)
+.L51:
+	.loc 1 1374 9 is_stmt 1 view .LVU260
+.LBB227:
+	.loc 1 442 10 view .LVU261
+.LBB213:
+	.loc 1 444 5 view .LVU262
+.LBB210:
+	.loc 1 432 9 view .LVU263
+.LBB205:
+	.loc 1 435 5 view .LVU264
+.LBE205:
+.LBE210:
+.LBE213:
+.LBE227:
+	.loc 1 1376 13 view .LVU265
+	.loc 1 1376 61 is_stmt 0 view .LVU266
+	movb	$0, 7(%rcx)
+	.loc 1 1378 9 is_stmt 1 view .LVU267
+	.loc 1 1381 9 view .LVU268
+.LBB228:
+	.loc 1 432 9 view .LVU269
+.LBB220:
+	.loc 1 435 5 view .LVU270
+.L36:
+	.loc 1 435 5 is_stmt 0 view .LVU271
+.LBE220:
+.LBE228:
+.LBE239:
+	.loc 1 1367 1 view .LVU272
+	xorl	%edx, %edx
+.L58:
+.LBB240:
+	.loc 1 1381 43 view .LVU273
+	movb	%dl, 6(%rcx)
+.LBE240:
+	.loc 1 1370 25 is_stmt 1 view .LVU274
+.LVL38:
+	.loc 1 1370 19 view .LVU275
+	addq	$8, %rcx
+.LVL39:
+	.loc 1 1370 19 is_stmt 0 view .LVU276
+	cmpq	%rcx, %r9
+	jne	.L47
+.LVL40:
+.L56:
+	.loc 1 1384 1 view .LVU277
+	movl	$1, %eax
+	ret
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+.LBB241:
+	.loc 1 1376 13 is_stmt 1 view .LVU278
+	.loc 1 1376 61 is_stmt 0 view .LVU279
+	movb	%dil, 7(%rcx)
+	.loc 1 1378 9 is_stmt 1 view .LVU280
+	jmp	.L44
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L54:
+.LBB229:
+.LBB214:
+	.loc 1 446 5 view .LVU281
+	.loc 1 446 5 is_stmt 0 view .LVU282
+.LBE214:
+.LBE229:
+	.loc 1 1375 9 is_stmt 1 view .LVU283
+	.loc 1 1375 12 is_stmt 0 view .LVU284
+	cmpw	$7, %di
+	ja	.L36
+.LVL43:
+	.loc 1 1376 13 is_stmt 1 view .LVU285
+	.loc 1 1376 61 is_stmt 0 view .LVU286
+	movb	%dil, 7(%rcx)
+	.loc 1 1378 9 is_stmt 1 view .LVU287
+	.loc 1 1381 9 view .LVU288
+.LBB230:
+	.loc 1 432 9 view .LVU289
+.LBB221:
+	.loc 1 435 5 view .LVU290
+.LBE221:
+.LBE230:
+.LBE241:
+	.loc 1 1367 1 is_stmt 0 view .LVU291
+	xorl	%edx, %edx
+	jmp	.L58
+.LVL44:
+.L52:
+.LBB242:
+.LBB231:
+.LBB187:
+	.loc 1 446 5 is_stmt 1 view .LVU292
+.LBE187:
+.LBE231:
+	.loc 1 1371 44 is_stmt 0 view .LVU293
+	movw	%r10w, (%rcx)
+	.loc 1 1372 9 is_stmt 1 view .LVU294
+.LBB232:
+	.loc 1 442 10 view .LVU295
+.LBB199:
+	.loc 1 444 5 view .LVU296
+.LBB197:
+	.loc 1 432 9 view .LVU297
+.LBB193:
+	.loc 1 435 5 view .LVU298
+.LBE193:
+.LBE197:
+	.loc 1 446 5 view .LVU299
+.LBE199:
+.LBE232:
+.LBE242:
+	.loc 1 1367 1 is_stmt 0 view .LVU300
+	xorl	%edx, %edx
+.LBB243:
+	.loc 1 1372 42 view .LVU301
+	movw	$0, 2(%rcx)
+	.loc 1 1374 9 is_stmt 1 view .LVU302
+.LBB233:
+	.loc 1 442 10 view .LVU303
+.LBB215:
+	.loc 1 444 5 view .LVU304
+.LBB211:
+	.loc 1 432 9 view .LVU305
+.LBB206:
+	.loc 1 435 5 view .LVU306
+.LBE206:
+.LBE211:
+.LBE215:
+.LBE233:
+	.loc 1 1376 13 view .LVU307
+	.loc 1 1376 61 is_stmt 0 view .LVU308
+	movb	$0, 7(%rcx)
+	.loc 1 1378 9 is_stmt 1 view .LVU309
+	.loc 1 1381 9 view .LVU310
+.LBB234:
+	.loc 1 432 9 view .LVU311
+.LBB222:
+	.loc 1 435 5 view .LVU312
+	jmp	.L58
+.LVL45:
+.L53:
+	.loc 1 435 5 is_stmt 0 view .LVU313
+.LBE222:
+.LBE234:
+.LBB235:
+.LBB200:
+	.loc 1 446 5 is_stmt 1 view .LVU314
+.LBE200:
+.LBE235:
+	.loc 1 1372 44 is_stmt 0 view .LVU315
+	movw	%r10w, 2(%rcx)
+	.loc 1 1374 9 is_stmt 1 view .LVU316
+.LBB236:
+	.loc 1 442 10 view .LVU317
+.LBB216:
+	.loc 1 444 5 view .LVU318
+.LBB212:
+	.loc 1 432 9 view .LVU319
+.LBB207:
+	.loc 1 435 5 view .LVU320
+.LBE207:
+.LBE212:
+.LBE216:
+.LBE236:
+	.loc 1 1376 13 view .LVU321
+.LBE243:
+	.loc 1 1367 1 is_stmt 0 view .LVU322
+	xorl	%edx, %edx
+.LBB244:
+	.loc 1 1376 61 view .LVU323
+	movb	$0, 7(%rcx)
+	.loc 1 1378 9 is_stmt 1 view .LVU324
+	.loc 1 1381 9 view .LVU325
+.LBB237:
+	.loc 1 432 9 view .LVU326
+.LBB223:
+	.loc 1 435 5 view .LVU327
+	jmp	.L58
+.LBE223:
+.LBE237:
+.LBE244:
+	.cfi_endproc
+.LFE70:
+	.size	mspSetServoConf, .-mspSetServoConf
+	.section	.text.mspSetRssiConfig,"ax",@progbits
+	.p2align 4
+	.type	mspSetRssiConfig, @function
+mspSetRssiConfig:
+.LFB81:
+	.loc 1 1508 1 view -0
+	.cfi_startproc
+	.loc 1 1509 5 view .LVU329
+.LBB247:
+.LBI247:
+	.loc 1 432 9 view .LVU330
+.LBB248:
+	.loc 1 435 5 view .LVU331
+	.loc 1 435 20 is_stmt 0 view .LVU332
+	movq	currentPort(%rip), %rdx
+	.loc 1 436 16 view .LVU333
+	xorl	%ecx, %ecx
+	.loc 1 435 20 view .LVU334
+	movzwl	52(%rdx), %eax
+	.loc 1 435 8 view .LVU335
+	cmpw	48(%rdx), %ax
+	jnb	.L60
+	.loc 1 439 5 is_stmt 1 view .LVU336
+	.loc 1 439 49 is_stmt 0 view .LVU337
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rdx)
+	.loc 1 439 53 view .LVU338
+	movzbl	54(%rdx,%rax), %ecx
+.L60:
+.LBE248:
+.LBE247:
+	.loc 1 1509 40 view .LVU339
+	movb	%cl, 326+masterConfig(%rip)
+	.loc 1 1510 5 is_stmt 1 view .LVU340
+	.loc 1 1511 1 is_stmt 0 view .LVU341
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE81:
+	.size	mspSetRssiConfig, .-mspSetRssiConfig
+	.section	.text.mspSetMixer,"ax",@progbits
+	.p2align 4
+	.type	mspSetMixer, @function
+mspSetMixer:
+.LFB79:
+	.loc 1 1493 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1494 5 view .LVU343
+.LBB251:
+.LBI251:
+	.loc 1 432 9 view .LVU344
+.LBB252:
+	.loc 1 435 5 view .LVU345
+	.loc 1 435 20 is_stmt 0 view .LVU346
+	movq	currentPort(%rip), %rdx
+	.loc 1 436 16 view .LVU347
+	xorl	%ecx, %ecx
+	.loc 1 435 20 view .LVU348
+	movzwl	52(%rdx), %eax
+	.loc 1 435 8 view .LVU349
+	cmpw	48(%rdx), %ax
+	jnb	.L63
+	.loc 1 439 5 is_stmt 1 view .LVU350
+	.loc 1 439 49 is_stmt 0 view .LVU351
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rdx)
+	.loc 1 439 53 view .LVU352
+	movzbl	54(%rdx,%rax), %ecx
+.L63:
+.LBE252:
+.LBE251:
+	.loc 1 1494 37 view .LVU353
+	movb	%cl, masterConfig(%rip)
+	.loc 1 1495 5 is_stmt 1 view .LVU354
+	.loc 1 1496 1 is_stmt 0 view .LVU355
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE79:
+	.size	mspSetMixer, .-mspSetMixer
+	.section	.text.mspSelectSetting,"ax",@progbits
+	.p2align 4
+	.type	mspSelectSetting, @function
+mspSelectSetting:
+.LFB61:
+	.loc 1 1240 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1241 5 view .LVU357
+.LBB255:
+.LBI255:
+	.loc 1 432 9 view .LVU358
+.LBB256:
+	.loc 1 435 5 view .LVU359
+.LBE256:
+.LBE255:
+	.loc 1 1240 1 is_stmt 0 view .LVU360
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB258:
+.LBB257:
+	.loc 1 435 20 view .LVU361
+	movq	currentPort(%rip), %rdx
+	movzwl	52(%rdx), %eax
+	.loc 1 435 8 view .LVU362
+	cmpw	48(%rdx), %ax
+	jnb	.L68
+	.loc 1 439 5 is_stmt 1 view .LVU363
+	.loc 1 439 49 is_stmt 0 view .LVU364
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rdx)
+	.loc 1 439 53 view .LVU365
+	movzbl	54(%rdx,%rax), %eax
+.LBE257:
+.LBE258:
+	.loc 1 1241 40 view .LVU366
+	movb	%al, 2008+masterConfig(%rip)
+	.loc 1 1242 5 is_stmt 1 view .LVU367
+	.loc 1 1242 8 is_stmt 0 view .LVU368
+	cmpb	$2, %al
+	jbe	.L67
+.L68:
+	.loc 1 1241 40 view .LVU369
+	movb	$0, 2008+masterConfig(%rip)
+	.loc 1 1242 5 is_stmt 1 view .LVU370
+.L67:
+	.loc 1 1245 5 view .LVU371
+	xorl	%eax, %eax
+	call	writeEEPROM@PLT
+.LVL46:
+	.loc 1 1246 5 view .LVU372
+	call	readEEPROM@PLT
+.LVL47:
+	.loc 1 1247 5 view .LVU373
+	.loc 1 1248 1 is_stmt 0 view .LVU374
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE61:
+	.size	mspSelectSetting, .-mspSelectSetting
+	.section	.text.mspSetHead,"ax",@progbits
+	.p2align 4
+	.type	mspSetHead, @function
+mspSetHead:
+.LFB62:
+	.loc 1 1251 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1252 5 view .LVU376
+.LBB265:
+.LBI265:
+	.loc 1 442 10 view .LVU377
+.LBB266:
+	.loc 1 444 5 view .LVU378
+.LBB267:
+.LBI267:
+	.loc 1 432 9 view .LVU379
+.LBB268:
+	.loc 1 435 5 view .LVU380
+	.loc 1 435 20 is_stmt 0 view .LVU381
+	movq	currentPort(%rip), %rax
+	xorl	%ecx, %ecx
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU382
+	movzwl	48(%rax), %edi
+	.loc 1 435 8 view .LVU383
+	cmpw	%di, %dx
+	jnb	.L71
+	.loc 1 439 5 is_stmt 1 view .LVU384
+	.loc 1 439 49 is_stmt 0 view .LVU385
+	leal	1(%rdx), %esi
+	.loc 1 439 53 view .LVU386
+	movzwl	%dx, %ecx
+	.loc 1 439 49 view .LVU387
+	movw	%si, 52(%rax)
+.LBE268:
+.LBE267:
+	.loc 1 444 14 view .LVU388
+	movzbl	54(%rax,%rcx), %ecx
+.LVL48:
+	.loc 1 445 5 is_stmt 1 view .LVU389
+.LBB269:
+.LBI269:
+	.loc 1 432 9 view .LVU390
+.LBB270:
+	.loc 1 435 5 view .LVU391
+	.loc 1 435 8 is_stmt 0 view .LVU392
+	cmpw	%di, %si
+	jnb	.L71
+	.loc 1 439 5 is_stmt 1 view .LVU393
+	.loc 1 439 49 is_stmt 0 view .LVU394
+	addl	$2, %edx
+	.loc 1 439 53 view .LVU395
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU396
+	movw	%dx, 52(%rax)
+.LBE270:
+.LBE269:
+	.loc 1 445 10 view .LVU397
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU398
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU399
+	addl	%eax, %ecx
+.LVL49:
+.L71:
+	.loc 1 446 5 is_stmt 1 view .LVU400
+.LBE266:
+.LBE265:
+	.loc 1 1252 13 is_stmt 0 view .LVU401
+	movw	%cx, magHold(%rip)
+	.loc 1 1253 5 is_stmt 1 view .LVU402
+	.loc 1 1254 1 is_stmt 0 view .LVU403
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE62:
+	.size	mspSetHead, .-mspSetHead
+	.section	.text.mspSetConfigDump,"ax",@progbits
+	.p2align 4
+	.type	mspSetConfigDump, @function
+mspSetConfigDump:
+.LFB87:
+	.loc 1 1687 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1688 5 view .LVU405
+	.loc 1 1689 5 view .LVU406
+	.loc 1 1691 5 view .LVU407
+.LBB273:
+.LBI273:
+	.loc 1 432 9 view .LVU408
+.LBB274:
+	.loc 1 435 5 view .LVU409
+	.loc 1 435 20 is_stmt 0 view .LVU410
+	movq	currentPort(%rip), %rdx
+	movzwl	52(%rdx), %ecx
+	.loc 1 435 42 view .LVU411
+	movzwl	48(%rdx), %esi
+	.loc 1 435 8 view .LVU412
+	cmpw	%si, %cx
+	jnb	.L86
+	.loc 1 439 5 is_stmt 1 view .LVU413
+	.loc 1 439 49 is_stmt 0 view .LVU414
+	leal	1(%rcx), %eax
+	movw	%ax, 52(%rdx)
+.LBE274:
+.LBE273:
+	.loc 1 1691 8 view .LVU415
+	cmpb	$1, 54(%rdx,%rcx)
+	jne	.L86
+	.loc 1 1695 31 is_stmt 1 view .LVU416
+	.loc 1 1687 1 is_stmt 0 view .LVU417
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 1702 9 view .LVU418
+	leaq	masterConfig(%rip), %rbp
+	.loc 1 1687 1 view .LVU419
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	leaq	8(%rsp), %rbx
+	.loc 1 1695 31 view .LVU420
+	cmpw	%si, %ax
+	jb	.L76
+.L78:
+	.loc 1 1705 1 view .LVU421
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 1704 11 view .LVU422
+	movl	$1, %eax
+	.loc 1 1705 1 view .LVU423
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.cfi_restore_state
+	.loc 1 1700 9 is_stmt 1 view .LVU424
+	.loc 1 1700 20 is_stmt 0 view .LVU425
+	movq	currentPort(%rip), %rdx
+	.loc 1 1700 28 view .LVU426
+	movzbl	%al, %eax
+	.loc 1 1702 9 view .LVU427
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	.loc 1 1700 28 view .LVU428
+	addw	%ax, 52(%rdx)
+	.loc 1 1702 9 is_stmt 1 view .LVU429
+	call	configDumpApplyRecord@PLT
+.LVL51:
+	.loc 1 1695 31 view .LVU430
+	.loc 1 1695 23 is_stmt 0 view .LVU431
+	movq	currentPort(%rip), %rdx
+	movzwl	52(%rdx), %eax
+	.loc 1 1695 44 view .LVU432
+	movzwl	48(%rdx), %esi
+	.loc 1 1695 31 view .LVU433
+	cmpw	%si, %ax
+	jnb	.L78
+.LVL52:
+.L76:
+	.loc 1 1696 9 is_stmt 1 view .LVU434
+	.loc 1 1696 102 is_stmt 0 view .LVU435
+	subl	%eax, %esi
+	.loc 1 1696 39 view .LVU436
+	movzwl	%ax, %eax
+	leaq	54(%rdx,%rax), %rdi
+	.loc 1 1696 16 view .LVU437
+	movzwl	%si, %esi
+	movq	%rbx, %rdx
+	call	configDumpDecodeRecord@PLT
+.LVL53:
+	.loc 1 1697 9 is_stmt 1 view .LVU438
+	.loc 1 1697 12 is_stmt 0 view .LVU439
+	testb	%al, %al
+	jne	.L90
+	.loc 1 1705 1 view .LVU440
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	.loc 1 1692 15 view .LVU441
+	xorl	%eax, %eax
+.LVL54:
+	.loc 1 1705 1 view .LVU442
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L86:
+	.cfi_restore 3
+	.cfi_restore 6
+	.loc 1 1692 15 view .LVU443
+	xorl	%eax, %eax
+	.loc 1 1705 1 view .LVU444
+	ret
+	.cfi_endproc
+.LFE87:
+	.size	mspSetConfigDump, .-mspSetConfigDump
+	.section	.text.mspSetCurrentMeterConfig,"ax",@progbits
+	.p2align 4
+	.type	mspSetCurrentMeterConfig, @function
+mspSetCurrentMeterConfig:
+.LFB78:
+	.loc 1 1486 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1487 5 view .LVU446
+.LBB287:
+.LBI287:
+	.loc 1 442 10 view .LVU447
+.LBB288:
+	.loc 1 444 5 view .LVU448
+.LBB289:
+.LBI289:
+	.loc 1 432 9 view .LVU449
+.LBB290:
+	.loc 1 435 5 view .LVU450
+	.loc 1 435 20 is_stmt 0 view .LVU451
+	movq	currentPort(%rip), %rax
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU452
+	movzwl	48(%rax), %ecx
+	.loc 1 435 8 view .LVU453
+	cmpw	%cx, %dx
+	jnb	.L96
+	.loc 1 439 5 is_stmt 1 view .LVU454
+	.loc 1 439 49 is_stmt 0 view .LVU455
+	leal	1(%rdx), %esi
+	.loc 1 439 53 view .LVU456
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU457
+	movw	%si, 52(%rax)
+.LBE290:
+.LBE289:
+	.loc 1 444 14 view .LVU458
+	movzbl	54(%rax,%rdi), %r8d
+.LVL56:
+	.loc 1 445 5 is_stmt 1 view .LVU459
+.LBB292:
+.LBI292:
+	.loc 1 432 9 view .LVU460
+.LBB293:
+	.loc 1 435 5 view .LVU461
+	.loc 1 435 8 is_stmt 0 view .LVU462
+	cmpw	%cx, %si
+	jnb	.L92
+	.loc 1 439 5 is_stmt 1 view .LVU463
+	.loc 1 439 49 is_stmt 0 view .LVU464
+	leal	2(%rdx), %edi
+	.loc 1 439 53 view .LVU465
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU466
+	movw	%di, 52(%rax)
+.LVL57:
+	.loc 1 439 49 view .LVU467
+.LBE293:
+.LBE292:
+	.loc 1 446 5 is_stmt 1 view .LVU468
+	.loc 1 445 10 is_stmt 0 view .LVU469
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU470
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU471
+	addl	%esi, %r8d
+	movw	%r8w, 304+masterConfig(%rip)
+.LBE288:
+.LBE287:
+	.loc 1 1488 5 is_stmt 1 view .LVU472
+.LBB296:
+.LBI296:
+	.loc 1 442 10 view .LVU473
+.LBB297:
+	.loc 1 444 5 view .LVU474
+.LBB298:
+.LBI298:
+	.loc 1 432 9 view .LVU475
+.LBB299:
+	.loc 1 435 5 view .LVU476
+	.loc 1 435 8 is_stmt 0 view .LVU477
+	cmpw	%cx, %di
+	jnb	.L95
+	.loc 1 439 5 is_stmt 1 view .LVU478
+	.loc 1 439 49 is_stmt 0 view .LVU479
+	leal	3(%rdx), %esi
+	.loc 1 439 53 view .LVU480
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU481
+	movw	%si, 52(%rax)
+.LBE299:
+.LBE298:
+	.loc 1 444 14 view .LVU482
+	movzbl	54(%rax,%rdi), %edi
+.LVL58:
+	.loc 1 445 5 is_stmt 1 view .LVU483
+.LBB301:
+.LBI301:
+	.loc 1 432 9 view .LVU484
+.LBB302:
+	.loc 1 435 5 view .LVU485
+	.loc 1 435 8 is_stmt 0 view .LVU486
+	cmpw	%cx, %si
+	jnb	.L94
+	.loc 1 439 5 is_stmt 1 view .LVU487
+	.loc 1 439 49 is_stmt 0 view .LVU488
+	addl	$4, %edx
+	.loc 1 439 53 view .LVU489
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU490
+	movw	%dx, 52(%rax)
+.LBE302:
+.LBE301:
+	.loc 1 445 10 view .LVU491
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU492
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU493
+	addl	%eax, %edi
+.LVL59:
+.L94:
+	.loc 1 446 5 is_stmt 1 view .LVU494
+.LBE297:
+.LBE296:
+	.loc 1 1488 51 is_stmt 0 view .LVU495
+	movw	%di, 306+masterConfig(%rip)
+	.loc 1 1489 5 is_stmt 1 view .LVU496
+	.loc 1 1490 1 is_stmt 0 view .LVU497
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L96:
+.LBB305:
+.LBB295:
+.LBB294:
+.LBB291:
+	xorl	%r8d, %r8d
+.L92:
+.LBE291:
+.LBE294:
+	.loc 1 446 5 is_stmt 1 view .LVU498
+.LBE295:
+.LBE305:
+	.loc 1 1487 50 is_stmt 0 view .LVU499
+	movw	%r8w, 304+masterConfig(%rip)
+	.loc 1 1488 5 is_stmt 1 view .LVU500
+.LBB306:
+	.loc 1 442 10 view .LVU501
+.LBB304:
+	.loc 1 444 5 view .LVU502
+.LBB303:
+	.loc 1 432 9 view .LVU503
+.LBB300:
+	.loc 1 435 5 view .LVU504
+.L95:
+.LBE300:
+.LBE303:
+.LBE304:
+.LBE306:
+	.loc 1 1486 1 is_stmt 0 view .LVU505
+	xorl	%edi, %edi
+	jmp	.L94
+	.cfi_endproc
+.LFE78:
+	.size	mspSetCurrentMeterConfig, .-mspSetCurrentMeterConfig
+	.section	.text.mspSetAccTrim,"ax",@progbits
+	.p2align 4
+	.type	mspSetAccTrim, @function
+mspSetAccTrim:
+.LFB64:
+	.loc 1 1268 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1269 5 view .LVU507
+.LBB319:
+.LBI319:
+	.loc 1 442 10 view .LVU508
+.LBB320:
+	.loc 1 444 5 view .LVU509
+.LBB321:
+.LBI321:
+	.loc 1 432 9 view .LVU510
+.LBB322:
+	.loc 1 435 5 view .LVU511
+	.loc 1 435 20 is_stmt 0 view .LVU512
+	movq	currentPort(%rip), %rax
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU513
+	movzwl	48(%rax), %ecx
+	.loc 1 435 8 view .LVU514
+	cmpw	%cx, %dx
+	jnb	.L103
+	.loc 1 439 5 is_stmt 1 view .LVU515
+	.loc 1 439 49 is_stmt 0 view .LVU516
+	leal	1(%rdx), %esi
+	.loc 1 439 53 view .LVU517
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU518
+	movw	%si, 52(%rax)
+.LBE322:
+.LBE321:
+	.loc 1 444 14 view .LVU519
+	movzbl	54(%rax,%rdi), %r8d
+.LVL60:
+	.loc 1 445 5 is_stmt 1 view .LVU520
+.LBB324:
+.LBI324:
+	.loc 1 432 9 view .LVU521
+.LBB325:
+	.loc 1 435 5 view .LVU522
+	.loc 1 435 8 is_stmt 0 view .LVU523
+	cmpw	%cx, %si
+	jnb	.L99
+	.loc 1 439 5 is_stmt 1 view .LVU524
+	.loc 1 439 49 is_stmt 0 view .LVU525
+	leal	2(%rdx), %edi
+	.loc 1 439 53 view .LVU526
+	movzwl	%si, %esi
+.LBE325:
+.LBE324:
+.LBE320:
+.LBE319:
+	.loc 1 1269 19 view .LVU527
+	movq	currentProfile(%rip), %r9
+.LBB331:
+.LBB329:
+.LBB327:
+.LBB326:
+	.loc 1 439 49 view .LVU528
+	movw	%di, 52(%rax)
+.LVL61:
+	.loc 1 439 49 view .LVU529
+.LBE326:
+.LBE327:
+	.loc 1 446 5 is_stmt 1 view .LVU530
+	.loc 1 445 10 is_stmt 0 view .LVU531
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU532
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU533
+	addl	%esi, %r8d
+	movw	%r8w, 98(%r9)
+.LBE329:
+.LBE331:
+	.loc 1 1270 5 is_stmt 1 view .LVU534
+.LBB332:
+.LBI332:
+	.loc 1 442 10 view .LVU535
+.LBB333:
+	.loc 1 444 5 view .LVU536
+.LBB334:
+.LBI334:
+	.loc 1 432 9 view .LVU537
+.LBB335:
+	.loc 1 435 5 view .LVU538
+	.loc 1 435 8 is_stmt 0 view .LVU539
+	cmpw	%cx, %di
+	jnb	.L106
+	.loc 1 439 5 is_stmt 1 view .LVU540
+	.loc 1 439 49 is_stmt 0 view .LVU541
+	leal	3(%rdx), %esi
+	.loc 1 439 53 view .LVU542
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU543
+	movw	%si, 52(%rax)
+.LBE335:
+.LBE334:
+	.loc 1 444 14 view .LVU544
+	movzbl	54(%rax,%rdi), %edi
+.LVL62:
+	.loc 1 445 5 is_stmt 1 view .LVU545
+.LBB337:
+.LBI337:
+	.loc 1 432 9 view .LVU546
+.LBB338:
+	.loc 1 435 5 view .LVU547
+	.loc 1 435 8 is_stmt 0 view .LVU548
+	cmpw	%cx, %si
+	jnb	.L107
+	.loc 1 439 5 is_stmt 1 view .LVU549
+	.loc 1 439 49 is_stmt 0 view .LVU550
+	addl	$4, %edx
+	.loc 1 439 53 view .LVU551
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU552
+	movw	%dx, 52(%rax)
+.LBE338:
+.LBE337:
+	.loc 1 445 10 view .LVU553
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU554
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU555
+	addl	%edi, %eax
+.L101:
+.LVL63:
+	.loc 1 446 5 is_stmt 1 view .LVU556
+.LBE333:
+.LBE332:
+	.loc 1 1270 52 is_stmt 0 view .LVU557
+	movw	%ax, 96(%r9)
+	.loc 1 1271 5 is_stmt 1 view .LVU558
+	.loc 1 1272 1 is_stmt 0 view .LVU559
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L103:
+.LBB342:
+.LBB330:
+.LBB328:
+.LBB323:
+	xorl	%r8d, %r8d
+.L99:
+.LBE323:
+.LBE328:
+	.loc 1 446 5 is_stmt 1 view .LVU560
+.LBE330:
+.LBE342:
+	.loc 1 1269 19 is_stmt 0 view .LVU561
+	movq	currentProfile(%rip), %r9
+	.loc 1 1269 53 view .LVU562
+	movw	%r8w, 98(%r9)
+.L106:
+	.loc 1 1270 5 is_stmt 1 view .LVU563
+.LBB343:
+	.loc 1 442 10 view .LVU564
+.LBB340:
+	.loc 1 444 5 view .LVU565
+.LBB339:
+	.loc 1 432 9 view .LVU566
+.LBB336:
+	.loc 1 435 5 view .LVU567
+.LBE336:
+.LBE339:
+.LBE340:
+.LBE343:
+	.loc 1 1269 53 is_stmt 0 view .LVU568
+	xorl	%eax, %eax
+.LBB344:
+.LBB341:
+	.loc 1 446 5 is_stmt 1 view .LVU569
+.LBE341:
+.LBE344:
+	.loc 1 1270 52 is_stmt 0 view .LVU570
+	movw	%ax, 96(%r9)
+	.loc 1 1271 5 is_stmt 1 view .LVU571
+	.loc 1 1272 1 is_stmt 0 view .LVU572
+	movl	$1, %eax
+	ret
+.LVL64:
+.L107:
+	.loc 1 1270 54 view .LVU573
+	movl	%edi, %eax
+	jmp	.L101
+	.cfi_endproc
+.LFE64:
+	.size	mspSetAccTrim, .-mspSetAccTrim
+	.section	.text.mspSetFeature,"ax",@progbits
+	.p2align 4
+	.type	mspSetFeature, @function
+mspSetFeature:
+.LFB76:
+	.loc 1 1471 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1472 5 view .LVU575
+	.loc 1 1471 1 is_stmt 0 view .LVU576
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 1472 5 view .LVU577
+	call	featureClearAll@PLT
+.LVL65:
+	.loc 1 1473 5 is_stmt 1 view .LVU578
+.LBB359:
+.LBI359:
+	.loc 1 449 10 view .LVU579
+.LBB360:
+	.loc 1 451 5 view .LVU580
+.LBB361:
+.LBI361:
+	.loc 1 442 10 view .LVU581
+.LBB362:
+	.loc 1 444 5 view .LVU582
+.LBB363:
+.LBI363:
+	.loc 1 432 9 view .LVU583
+.LBB364:
+	.loc 1 435 5 view .LVU584
+	.loc 1 435 20 is_stmt 0 view .LVU585
+	movq	currentPort(%rip), %rax
+	xorl	%edi, %edi
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU586
+	movzwl	48(%rax), %ecx
+	.loc 1 435 8 view .LVU587
+	cmpw	%cx, %dx
+	jnb	.L113
+	.loc 1 439 5 is_stmt 1 view .LVU588
+	.loc 1 439 49 is_stmt 0 view .LVU589
+	leal	1(%rdx), %r8d
+	.loc 1 439 53 view .LVU590
+	movzwl	%dx, %esi
+	.loc 1 439 49 view .LVU591
+	movw	%r8w, 52(%rax)
+	.loc 1 439 53 view .LVU592
+	movzbl	54(%rax,%rsi), %edi
+.LVL66:
+	.loc 1 439 53 view .LVU593
+.LBE364:
+.LBE363:
+	.loc 1 445 5 is_stmt 1 view .LVU594
+.LBB365:
+.LBI365:
+	.loc 1 432 9 view .LVU595
+.LBB366:
+	.loc 1 435 5 view .LVU596
+	.loc 1 435 8 is_stmt 0 view .LVU597
+	cmpw	%cx, %r8w
+	jnb	.L110
+	.loc 1 439 5 is_stmt 1 view .LVU598
+	.loc 1 439 49 is_stmt 0 view .LVU599
+	leal	2(%rdx), %esi
+	.loc 1 439 53 view .LVU600
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU601
+	movw	%si, 52(%rax)
+.LVL67:
+	.loc 1 439 49 view .LVU602
+.LBE366:
+.LBE365:
+	.loc 1 446 5 is_stmt 1 view .LVU603
+	.loc 1 445 10 is_stmt 0 view .LVU604
+	movzbl	54(%rax,%r8), %r8d
+	.loc 1 445 28 view .LVU605
+	sall	$8, %r8d
+	.loc 1 445 7 view .LVU606
+	addl	%r8d, %edi
+.LBE362:
+.LBE361:
+	.loc 1 451 14 view .LVU607
+	movzwl	%di, %edi
+.LVL68:
+	.loc 1 452 5 is_stmt 1 view .LVU608
+.LBB367:
+.LBI367:
+	.loc 1 442 10 view .LVU609
+.LBB368:
+	.loc 1 444 5 view .LVU610
+.LBB369:
+.LBI369:
+	.loc 1 432 9 view .LVU611
+.LBB370:
+	.loc 1 435 5 view .LVU612
+	.loc 1 435 8 is_stmt 0 view .LVU613
+	cmpw	%cx, %si
+	jnb	.L113
+	.loc 1 439 5 is_stmt 1 view .LVU614
+	.loc 1 439 49 is_stmt 0 view .LVU615
+	leal	3(%rdx), %r8d
+	.loc 1 439 53 view .LVU616
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU617
+	movw	%r8w, 52(%rax)
+	.loc 1 439 53 view .LVU618
+	movzbl	54(%rax,%rsi), %esi
+.LVL69:
+	.loc 1 439 53 view .LVU619
+.LBE370:
+.LBE369:
+	.loc 1 445 5 is_stmt 1 view .LVU620
+.LBB371:
+.LBI371:
+	.loc 1 432 9 view .LVU621
+.LBB372:
+	.loc 1 435 5 view .LVU622
+	.loc 1 435 8 is_stmt 0 view .LVU623
+	cmpw	%cx, %r8w
+	jnb	.L117
+	.loc 1 439 5 is_stmt 1 view .LVU624
+	.loc 1 439 49 is_stmt 0 view .LVU625
+	addl	$4, %edx
+	.loc 1 439 53 view .LVU626
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU627
+	movw	%dx, 52(%rax)
+.LBE372:
+.LBE371:
+	.loc 1 445 10 view .LVU628
+	movzbl	54(%rax,%r8), %eax
+	.loc 1 445 28 view .LVU629
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU630
+	addl	%esi, %eax
+.LBE368:
+.LBE367:
+	.loc 1 452 29 view .LVU631
+	sall	$16, %eax
+	.loc 1 452 7 view .LVU632
+	addl	%eax, %edi
+.LVL70:
+.L113:
+.LBB374:
+.LBB373:
+	.loc 1 446 5 is_stmt 1 view .LVU633
+	.loc 1 446 5 is_stmt 0 view .LVU634
+.LBE373:
+.LBE374:
+	.loc 1 453 5 is_stmt 1 view .LVU635
+.LBE360:
+.LBE359:
+	.loc 1 1473 5 is_stmt 0 view .LVU636
+	call	featureSet@PLT
+.LVL71:
+	.loc 1 1474 5 is_stmt 1 view .LVU637
+	.loc 1 1475 1 is_stmt 0 view .LVU638
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL72:
+.L110:
+	.cfi_restore_state
+.LBB376:
+.LBB375:
+	.loc 1 451 14 view .LVU639
+	movzbl	%dil, %edi
+.LVL73:
+	.loc 1 451 14 view .LVU640
+	jmp	.L113
+.LVL74:
+.L117:
+	.loc 1 452 10 view .LVU641
+	movzbl	%sil, %eax
+	.loc 1 452 29 view .LVU642
+	sall	$16, %eax
+	.loc 1 452 7 view .LVU643
+	addl	%eax, %edi
+.LVL75:
+	.loc 1 452 7 view .LVU644
+	jmp	.L113
+.LBE375:
+.LBE376:
+	.cfi_endproc
+.LFE76:
+	.size	mspSetFeature, .-mspSetFeature
+	.section	.text.mspSetBoardAlignment,"ax",@progbits
+	.p2align 4
+	.type	mspSetBoardAlignment, @function
+mspSetBoardAlignment:
+.LFB77:
+	.loc 1 1478 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1479 5 view .LVU646
+.LBB395:
+.LBI395:
+	.loc 1 442 10 view .LVU647
+.LBB396:
+	.loc 1 444 5 view .LVU648
+.LBB397:
+.LBI397:
+	.loc 1 432 9 view .LVU649
+.LBB398:
+	.loc 1 435 5 view .LVU650
+	.loc 1 435 20 is_stmt 0 view .LVU651
+	movq	currentPort(%rip), %rax
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU652
+	movzwl	48(%rax), %ecx
+	.loc 1 435 8 view .LVU653
+	cmpw	%cx, %dx
+	jnb	.L128
+	.loc 1 439 5 is_stmt 1 view .LVU654
+	.loc 1 439 49 is_stmt 0 view .LVU655
+	leal	1(%rdx), %esi
+	.loc 1 439 53 view .LVU656
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU657
+	movw	%si, 52(%rax)
+.LBE398:
+.LBE397:
+	.loc 1 444 14 view .LVU658
+	movzbl	54(%rax,%rdi), %r8d
+.LVL76:
+	.loc 1 445 5 is_stmt 1 view .LVU659
+.LBB400:
+.LBI400:
+	.loc 1 432 9 view .LVU660
+.LBB401:
+	.loc 1 435 5 view .LVU661
+	.loc 1 435 8 is_stmt 0 view .LVU662
+	cmpw	%cx, %si
+	jnb	.L119
+	.loc 1 439 5 is_stmt 1 view .LVU663
+	.loc 1 439 49 is_stmt 0 view .LVU664
+	leal	2(%rdx), %edi
+	.loc 1 439 53 view .LVU665
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU666
+	movw	%di, 52(%rax)
+.LVL77:
+	.loc 1 439 49 view .LVU667
+.LBE401:
+.LBE400:
+	.loc 1 446 5 is_stmt 1 view .LVU668
+	.loc 1 445 10 is_stmt 0 view .LVU669
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU670
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU671
+	addl	%esi, %r8d
+	movw	%r8w, 240+masterConfig(%rip)
+.LBE396:
+.LBE395:
+	.loc 1 1480 5 is_stmt 1 view .LVU672
+.LBB404:
+.LBI404:
+	.loc 1 442 10 view .LVU673
+.LBB405:
+	.loc 1 444 5 view .LVU674
+.LBB406:
+.LBI406:
+	.loc 1 432 9 view .LVU675
+.LBB407:
+	.loc 1 435 5 view .LVU676
+	.loc 1 435 8 is_stmt 0 view .LVU677
+	cmpw	%cx, %di
+	jnb	.L121
+	.loc 1 439 5 is_stmt 1 view .LVU678
+	.loc 1 439 49 is_stmt 0 view .LVU679
+	leal	3(%rdx), %esi
+	.loc 1 439 53 view .LVU680
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU681
+	movw	%si, 52(%rax)
+.LBE407:
+.LBE406:
+	.loc 1 444 14 view .LVU682
+	movzbl	54(%rax,%rdi), %r8d
+.LVL78:
+	.loc 1 445 5 is_stmt 1 view .LVU683
+.LBB409:
+.LBI409:
+	.loc 1 432 9 view .LVU684
+.LBB410:
+	.loc 1 435 5 view .LVU685
+	.loc 1 435 8 is_stmt 0 view .LVU686
+	cmpw	%cx, %si
+	jnb	.L123
+	.loc 1 439 5 is_stmt 1 view .LVU687
+	.loc 1 439 49 is_stmt 0 view .LVU688
+	leal	4(%rdx), %edi
+	.loc 1 439 53 view .LVU689
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU690
+	movw	%di, 52(%rax)
+.LVL79:
+	.loc 1 439 49 view .LVU691
+.LBE410:
+.LBE409:
+	.loc 1 446 5 is_stmt 1 view .LVU692
+	.loc 1 445 10 is_stmt 0 view .LVU693
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU694
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU695
+	addl	%esi, %r8d
+	movw	%r8w, 242+masterConfig(%rip)
+.LBE405:
+.LBE404:
+	.loc 1 1481 5 is_stmt 1 view .LVU696
+.LBB414:
+.LBI414:
+	.loc 1 442 10 view .LVU697
+.LBB415:
+	.loc 1 444 5 view .LVU698
+.LBB416:
+.LBI416:
+	.loc 1 432 9 view .LVU699
+.LBB417:
+	.loc 1 435 5 view .LVU700
+	.loc 1 435 8 is_stmt 0 view .LVU701
+	cmpw	%cx, %di
+	jnb	.L127
+	.loc 1 439 5 is_stmt 1 view .LVU702
+	.loc 1 439 49 is_stmt 0 view .LVU703
+	leal	5(%rdx), %esi
+	.loc 1 439 53 view .LVU704
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU705
+	movw	%si, 52(%rax)
+.LBE417:
+.LBE416:
+	.loc 1 444 14 view .LVU706
+	movzbl	54(%rax,%rdi), %edi
+.LVL80:
+	.loc 1 445 5 is_stmt 1 view .LVU707
+.LBB419:
+.LBI419:
+	.loc 1 432 9 view .LVU708
+.LBB420:
+	.loc 1 435 5 view .LVU709
+	.loc 1 435 8 is_stmt 0 view .LVU710
+	cmpw	%cx, %si
+	jnb	.L130
+	.loc 1 439 5 is_stmt 1 view .LVU711
+	.loc 1 439 49 is_stmt 0 view .LVU712
+	addl	$6, %edx
+	.loc 1 439 53 view .LVU713
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU714
+	movw	%dx, 52(%rax)
+.LBE420:
+.LBE419:
+	.loc 1 445 10 view .LVU715
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU716
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU717
+	addl	%edi, %eax
+.LVL81:
+.L125:
+	.loc 1 446 5 is_stmt 1 view .LVU718
+.LBE415:
+.LBE414:
+	.loc 1 1481 44 is_stmt 0 view .LVU719
+	movw	%ax, 244+masterConfig(%rip)
+	.loc 1 1482 5 is_stmt 1 view .LVU720
+	.loc 1 1483 1 is_stmt 0 view .LVU721
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L128:
+.LBB423:
+.LBB403:
+.LBB402:
+.LBB399:
+	xorl	%r8d, %r8d
+.L119:
+.LBE399:
+.LBE402:
+	.loc 1 446 5 is_stmt 1 view .LVU722
+.LBE403:
+.LBE423:
+	.loc 1 1479 45 is_stmt 0 view .LVU723
+	movw	%r8w, 240+masterConfig(%rip)
+	.loc 1 1480 5 is_stmt 1 view .LVU724
+.LBB424:
+	.loc 1 442 10 view .LVU725
+.LBB412:
+	.loc 1 444 5 view .LVU726
+.LBB411:
+	.loc 1 432 9 view .LVU727
+.LBB408:
+	.loc 1 435 5 view .LVU728
+.L121:
+.LBE408:
+.LBE411:
+.LBE412:
+.LBE424:
+	.loc 1 1478 1 is_stmt 0 view .LVU729
+	xorl	%r8d, %r8d
+.L123:
+.LBB425:
+.LBB413:
+	.loc 1 446 5 is_stmt 1 view .LVU730
+.LBE413:
+.LBE425:
+	.loc 1 1480 46 is_stmt 0 view .LVU731
+	movw	%r8w, 242+masterConfig(%rip)
+	.loc 1 1481 5 is_stmt 1 view .LVU732
+.LBB426:
+	.loc 1 442 10 view .LVU733
+.LBB422:
+	.loc 1 444 5 view .LVU734
+.LBB421:
+	.loc 1 432 9 view .LVU735
+.LBB418:
+	.loc 1 435 5 view .LVU736
+.L127:
+.LBE418:
+.LBE421:
+.LBE422:
+.LBE426:
+	.loc 1 1478 1 is_stmt 0 view .LVU737
+	xorl	%eax, %eax
+	jmp	.L125
+.LVL82:
+.L130:
+	.loc 1 1481 46 view .LVU738
+	movl	%edi, %eax
+	jmp	.L125
+	.cfi_endproc
+.LFE77:
+	.size	mspSetBoardAlignment, .-mspSetBoardAlignment
+	.section	.text.mspSetRcTuning,"ax",@progbits
+	.p2align 4
+	.type	mspSetRcTuning, @function
+mspSetRcTuning:
+.LFB67:
+	.loc 1 1329 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1330 5 view .LVU740
+.LBB441:
+.LBB442:
+	.loc 1 435 20 is_stmt 0 view .LVU741
+	movq	currentPort(%rip), %rax
+.LBE442:
+.LBE441:
+	.loc 1 1330 19 view .LVU742
+	movq	currentProfile(%rip), %rcx
+.LBB444:
+.LBI441:
+	.loc 1 432 9 is_stmt 1 view .LVU743
+.LBB443:
+	.loc 1 435 5 view .LVU744
+	.loc 1 435 20 is_stmt 0 view .LVU745
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU746
+	movzwl	48(%rax), %esi
+	.loc 1 435 8 view .LVU747
+	cmpw	%si, %dx
+	jnb	.L132
+	.loc 1 439 5 is_stmt 1 view .LVU748
+	.loc 1 439 49 is_stmt 0 view .LVU749
+	leal	1(%rdx), %r8d
+	.loc 1 439 53 view .LVU750
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU751
+	movw	%r8w, 52(%rax)
+.LBE443:
+.LBE444:
+	.loc 1 1330 47 view .LVU752
+	movzbl	54(%rax,%rdi), %edi
+	movb	%dil, 84(%rcx)
+	.loc 1 1331 5 is_stmt 1 view .LVU753
+.LBB445:
+.LBI445:
+	.loc 1 432 9 view .LVU754
+.LBB446:
+	.loc 1 435 5 view .LVU755
+	.loc 1 435 8 is_stmt 0 view .LVU756
+	cmpw	%si, %r8w
+	jnb	.L133
+	.loc 1 439 5 is_stmt 1 view .LVU757
+	.loc 1 439 49 is_stmt 0 view .LVU758
+	leal	2(%rdx), %edi
+	.loc 1 439 53 view .LVU759
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU760
+	movw	%di, 52(%rax)
+.LBE446:
+.LBE445:
+	.loc 1 1331 47 view .LVU761
+	movzbl	54(%rax,%r8), %r8d
+	movb	%r8b, 85(%rcx)
+	.loc 1 1332 5 is_stmt 1 view .LVU762
+.LBB448:
+.LBI448:
+	.loc 1 432 9 view .LVU763
+.LBB449:
+	.loc 1 435 5 view .LVU764
+	.loc 1 435 8 is_stmt 0 view .LVU765
+	cmpw	%si, %di
+	jnb	.L134
+	.loc 1 439 5 is_stmt 1 view .LVU766
+	.loc 1 439 49 is_stmt 0 view .LVU767
+	leal	3(%rdx), %r8d
+	.loc 1 439 53 view .LVU768
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU769
+	movw	%r8w, 52(%rax)
+.LBE449:
+.LBE448:
+	.loc 1 1332 53 view .LVU770
+	movzbl	54(%rax,%rdi), %edi
+	movb	%dil, 88(%rcx)
+	.loc 1 1333 5 is_stmt 1 view .LVU771
+.LBB451:
+.LBI451:
+	.loc 1 432 9 view .LVU772
+.LBB452:
+	.loc 1 435 5 view .LVU773
+	.loc 1 435 8 is_stmt 0 view .LVU774
+	cmpw	%si, %r8w
+	jnb	.L135
+	.loc 1 439 5 is_stmt 1 view .LVU775
+	.loc 1 439 49 is_stmt 0 view .LVU776
+	leal	4(%rdx), %edi
+	.loc 1 439 53 view .LVU777
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU778
+	movw	%di, 52(%rax)
+.LBE452:
+.LBE451:
+	.loc 1 1333 47 view .LVU779
+	movzbl	54(%rax,%r8), %r8d
+	movb	%r8b, 89(%rcx)
+	.loc 1 1334 5 is_stmt 1 view .LVU780
+.LBB454:
+.LBI454:
+	.loc 1 432 9 view .LVU781
+.LBB455:
+	.loc 1 435 5 view .LVU782
+	.loc 1 435 8 is_stmt 0 view .LVU783
+	cmpw	%si, %di
+	jnb	.L136
+	.loc 1 439 5 is_stmt 1 view .LVU784
+	.loc 1 439 49 is_stmt 0 view .LVU785
+	leal	5(%rdx), %r8d
+	.loc 1 439 53 view .LVU786
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU787
+	movw	%r8w, 52(%rax)
+.LBE455:
+.LBE454:
+	.loc 1 1334 31 view .LVU788
+	movzbl	54(%rax,%rdi), %edi
+	movb	%dil, 90(%rcx)
+	.loc 1 1335 5 is_stmt 1 view .LVU789
+.LBB457:
+.LBI457:
+	.loc 1 432 9 view .LVU790
+.LBB458:
+	.loc 1 435 5 view .LVU791
+	.loc 1 435 8 is_stmt 0 view .LVU792
+	cmpw	%si, %r8w
+	jnb	.L137
+	.loc 1 439 5 is_stmt 1 view .LVU793
+	.loc 1 439 49 is_stmt 0 view .LVU794
+	leal	6(%rdx), %edi
+	.loc 1 439 53 view .LVU795
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU796
+	movw	%di, 52(%rax)
+.LBE458:
+.LBE457:
+	.loc 1 1335 47 view .LVU797
+	movzbl	54(%rax,%r8), %r8d
+	movb	%r8b, 86(%rcx)
+	.loc 1 1336 5 is_stmt 1 view .LVU798
+.LBB460:
+.LBI460:
+	.loc 1 432 9 view .LVU799
+.LBB461:
+	.loc 1 435 5 view .LVU800
+	.loc 1 435 8 is_stmt 0 view .LVU801
+	cmpw	%si, %di
+	jnb	.L140
+	.loc 1 439 5 is_stmt 1 view .LVU802
+	.loc 1 439 49 is_stmt 0 view .LVU803
+	addl	$7, %edx
+	.loc 1 439 53 view .LVU804
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU805
+	movw	%dx, 52(%rax)
+	.loc 1 439 53 view .LVU806
+	movzbl	54(%rax,%rdi), %eax
+.L139:
+.LBE461:
+.LBE460:
+	.loc 1 1336 48 view .LVU807
+	movb	%al, 87(%rcx)
+	.loc 1 1337 5 is_stmt 1 view .LVU808
+	.loc 1 1338 1 is_stmt 0 view .LVU809
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L132:
+	.loc 1 1330 47 view .LVU810
+	movb	$0, 84(%rcx)
+	.loc 1 1331 5 is_stmt 1 view .LVU811
+.LBB463:
+	.loc 1 432 9 view .LVU812
+.LBB447:
+	.loc 1 435 5 view .LVU813
+.L133:
+.LBE447:
+.LBE463:
+	.loc 1 1331 47 is_stmt 0 view .LVU814
+	movb	$0, 85(%rcx)
+	.loc 1 1332 5 is_stmt 1 view .LVU815
+.LBB464:
+	.loc 1 432 9 view .LVU816
+.LBB450:
+	.loc 1 435 5 view .LVU817
+.L134:
+.LBE450:
+.LBE464:
+	.loc 1 1332 53 is_stmt 0 view .LVU818
+	movb	$0, 88(%rcx)
+	.loc 1 1333 5 is_stmt 1 view .LVU819
+.LBB465:
+	.loc 1 432 9 view .LVU820
+.LBB453:
+	.loc 1 435 5 view .LVU821
+.L135:
+.LBE453:
+.LBE465:
+	.loc 1 1333 47 is_stmt 0 view .LVU822
+	movb	$0, 89(%rcx)
+	.loc 1 1334 5 is_stmt 1 view .LVU823
+.LBB466:
+	.loc 1 432 9 view .LVU824
+.LBB456:
+	.loc 1 435 5 view .LVU825
+.L136:
+.LBE456:
+.LBE466:
+	.loc 1 1334 31 is_stmt 0 view .LVU826
+	movb	$0, 90(%rcx)
+	.loc 1 1335 5 is_stmt 1 view .LVU827
+.LBB467:
+	.loc 1 432 9 view .LVU828
+.LBB459:
+	.loc 1 435 5 view .LVU829
+.L137:
+.LBE459:
+.LBE467:
+	.loc 1 1335 47 is_stmt 0 view .LVU830
+	movb	$0, 86(%rcx)
+	.loc 1 1336 5 is_stmt 1 view .LVU831
+.LBB468:
+	.loc 1 432 9 view .LVU832
+.LBB462:
+	.loc 1 435 5 view .LVU833
+.L140:
+	.loc 1 436 16 is_stmt 0 view .LVU834
+	xorl	%eax, %eax
+	jmp	.L139
+.LBE462:
+.LBE468:
+	.cfi_endproc
+.LFE67:
+	.size	mspSetRcTuning, .-mspSetRcTuning
+	.section	.text.mspSetRxConfig,"ax",@progbits
+	.p2align 4
+	.type	mspSetRxConfig, @function
+mspSetRxConfig:
+.LFB80:
+	.loc 1 1499 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1500 5 view .LVU836
+.LBB489:
+.LBI489:
+	.loc 1 432 9 view .LVU837
+.LBB490:
+	.loc 1 435 5 view .LVU838
+	.loc 1 435 20 is_stmt 0 view .LVU839
+	movq	currentPort(%rip), %rax
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU840
+	movzwl	48(%rax), %ecx
+	.loc 1 435 8 view .LVU841
+	cmpw	%cx, %dx
+	jnb	.L143
+	.loc 1 439 5 is_stmt 1 view .LVU842
+	.loc 1 439 49 is_stmt 0 view .LVU843
+	leal	1(%rdx), %edi
+	.loc 1 439 53 view .LVU844
+	movzwl	%dx, %esi
+	.loc 1 439 49 view .LVU845
+	movw	%di, 52(%rax)
+.LBE490:
+.LBE489:
+	.loc 1 1500 45 view .LVU846
+	movzbl	54(%rax,%rsi), %esi
+	movb	%sil, 318+masterConfig(%rip)
+	.loc 1 1501 5 is_stmt 1 view .LVU847
+.LBB491:
+.LBI491:
+	.loc 1 442 10 view .LVU848
+.LBB492:
+	.loc 1 444 5 view .LVU849
+.LBB493:
+.LBI493:
+	.loc 1 432 9 view .LVU850
+.LBB494:
+	.loc 1 435 5 view .LVU851
+	.loc 1 435 8 is_stmt 0 view .LVU852
+	cmpw	%cx, %di
+	jnb	.L144
+	.loc 1 439 5 is_stmt 1 view .LVU853
+	.loc 1 439 49 is_stmt 0 view .LVU854
+	leal	2(%rdx), %esi
+	.loc 1 439 53 view .LVU855
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU856
+	movw	%si, 52(%rax)
+.LBE494:
+.LBE493:
+	.loc 1 444 14 view .LVU857
+	movzbl	54(%rax,%rdi), %r8d
+.LVL83:
+	.loc 1 445 5 is_stmt 1 view .LVU858
+.LBB496:
+.LBI496:
+	.loc 1 432 9 view .LVU859
+.LBB497:
+	.loc 1 435 5 view .LVU860
+	.loc 1 435 8 is_stmt 0 view .LVU861
+	cmpw	%cx, %si
+	jnb	.L145
+	.loc 1 439 5 is_stmt 1 view .LVU862
+	.loc 1 439 49 is_stmt 0 view .LVU863
+	leal	3(%rdx), %edi
+	.loc 1 439 53 view .LVU864
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU865
+	movw	%di, 52(%rax)
+.LVL84:
+	.loc 1 439 49 view .LVU866
+.LBE497:
+.LBE496:
+	.loc 1 446 5 is_stmt 1 view .LVU867
+	.loc 1 445 10 is_stmt 0 view .LVU868
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU869
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU870
+	addl	%esi, %r8d
+	movw	%r8w, 324+masterConfig(%rip)
+.LBE492:
+.LBE491:
+	.loc 1 1502 5 is_stmt 1 view .LVU871
+.LBB501:
+.LBI501:
+	.loc 1 442 10 view .LVU872
+.LBB502:
+	.loc 1 444 5 view .LVU873
+.LBB503:
+.LBI503:
+	.loc 1 432 9 view .LVU874
+.LBB504:
+	.loc 1 435 5 view .LVU875
+	.loc 1 435 8 is_stmt 0 view .LVU876
+	cmpw	%cx, %di
+	jnb	.L146
+	.loc 1 439 5 is_stmt 1 view .LVU877
+	.loc 1 439 49 is_stmt 0 view .LVU878
+	leal	4(%rdx), %esi
+	.loc 1 439 53 view .LVU879
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU880
+	movw	%si, 52(%rax)
+.LBE504:
+.LBE503:
+	.loc 1 444 14 view .LVU881
+	movzbl	54(%rax,%rdi), %r8d
+.LVL85:
+	.loc 1 445 5 is_stmt 1 view .LVU882
+.LBB506:
+.LBI506:
+	.loc 1 432 9 view .LVU883
+.LBB507:
+	.loc 1 435 5 view .LVU884
+	.loc 1 435 8 is_stmt 0 view .LVU885
+	cmpw	%cx, %si
+	jnb	.L147
+	.loc 1 439 5 is_stmt 1 view .LVU886
+	.loc 1 439 49 is_stmt 0 view .LVU887
+	leal	5(%rdx), %edi
+	.loc 1 439 53 view .LVU888
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU889
+	movw	%di, 52(%rax)
+.LVL86:
+	.loc 1 439 49 view .LVU890
+.LBE507:
+.LBE506:
+	.loc 1 446 5 is_stmt 1 view .LVU891
+	.loc 1 445 10 is_stmt 0 view .LVU892
+	movzbl	54(%rax,%rsi), %esi
+	.loc 1 445 28 view .LVU893
+	sall	$8, %esi
+	.loc 1 445 7 view .LVU894
+	addl	%esi, %r8d
+	movw	%r8w, 320+masterConfig(%rip)
+.LBE502:
+.LBE501:
+	.loc 1 1503 5 is_stmt 1 view .LVU895
+.LBB511:
+.LBI511:
+	.loc 1 442 10 view .LVU896
+.LBB512:
+	.loc 1 444 5 view .LVU897
+.LBB513:
+.LBI513:
+	.loc 1 432 9 view .LVU898
+.LBB514:
+	.loc 1 435 5 view .LVU899
+	.loc 1 435 8 is_stmt 0 view .LVU900
+	cmpw	%cx, %di
+	jnb	.L150
+	.loc 1 439 5 is_stmt 1 view .LVU901
+	.loc 1 439 49 is_stmt 0 view .LVU902
+	leal	6(%rdx), %esi
+	.loc 1 439 53 view .LVU903
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU904
+	movw	%si, 52(%rax)
+.LBE514:
+.LBE513:
+	.loc 1 444 14 view .LVU905
+	movzbl	54(%rax,%rdi), %edi
+.LVL87:
+	.loc 1 445 5 is_stmt 1 view .LVU906
+.LBB516:
+.LBI516:
+	.loc 1 432 9 view .LVU907
+.LBB517:
+	.loc 1 435 5 view .LVU908
+	.loc 1 435 8 is_stmt 0 view .LVU909
+	cmpw	%cx, %si
+	jnb	.L149
+	.loc 1 439 5 is_stmt 1 view .LVU910
+	.loc 1 439 49 is_stmt 0 view .LVU911
+	addl	$7, %edx
+	.loc 1 439 53 view .LVU912
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU913
+	movw	%dx, 52(%rax)
+.LBE517:
+.LBE516:
+	.loc 1 445 10 view .LVU914
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU915
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU916
+	addl	%eax, %edi
+.LVL88:
+.L149:
+	.loc 1 446 5 is_stmt 1 view .LVU917
+.LBE512:
+.LBE511:
+	.loc 1 1503 36 is_stmt 0 view .LVU918
+	movw	%di, 322+masterConfig(%rip)
+	.loc 1 1504 5 is_stmt 1 view .LVU919
+	.loc 1 1505 1 is_stmt 0 view .LVU920
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L143:
+	.loc 1 1500 45 view .LVU921
+	movb	$0, 318+masterConfig(%rip)
+	.loc 1 1501 5 is_stmt 1 view .LVU922
+.LBB520:
+	.loc 1 442 10 view .LVU923
+.LBB499:
+	.loc 1 444 5 view .LVU924
+.LBB498:
+	.loc 1 432 9 view .LVU925
+.LBB495:
+	.loc 1 435 5 view .LVU926
+.L144:
+.LBE495:
+.LBE498:
+.LBE499:
+.LBE520:
+	.loc 1 1499 1 is_stmt 0 view .LVU927
+	xorl	%r8d, %r8d
+.L145:
+.LBB521:
+.LBB500:
+	.loc 1 446 5 is_stmt 1 view .LVU928
+.LBE500:
+.LBE521:
+	.loc 1 1501 36 is_stmt 0 view .LVU929
+	movw	%r8w, 324+masterConfig(%rip)
+	.loc 1 1502 5 is_stmt 1 view .LVU930
+.LBB522:
+	.loc 1 442 10 view .LVU931
+.LBB509:
+	.loc 1 444 5 view .LVU932
+.LBB508:
+	.loc 1 432 9 view .LVU933
+.LBB505:
+	.loc 1 435 5 view .LVU934
+.L146:
+.LBE505:
+.LBE508:
+.LBE509:
+.LBE522:
+	.loc 1 1499 1 is_stmt 0 view .LVU935
+	xorl	%r8d, %r8d
+.L147:
+.LBB523:
+.LBB510:
+	.loc 1 446 5 is_stmt 1 view .LVU936
+.LBE510:
+.LBE523:
+	.loc 1 1502 33 is_stmt 0 view .LVU937
+	movw	%r8w, 320+masterConfig(%rip)
+	.loc 1 1503 5 is_stmt 1 view .LVU938
+.LBB524:
+	.loc 1 442 10 view .LVU939
+.LBB519:
+	.loc 1 444 5 view .LVU940
+.LBB518:
+	.loc 1 432 9 view .LVU941
+.LBB515:
+	.loc 1 435 5 view .LVU942
+.L150:
+.LBE515:
+.LBE518:
+.LBE519:
+.LBE524:
+	.loc 1 1499 1 is_stmt 0 view .LVU943
+	xorl	%edi, %edi
+	jmp	.L149
+	.cfi_endproc
+.LFE80:
+	.size	mspSetRxConfig, .-mspSetRxConfig
+	.section	.text.mspSetModeRange,"ax",@progbits
+	.p2align 4
+	.type	mspSetModeRange, @function
+mspSetModeRange:
+.LFB66:
+	.loc 1 1306 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1307 5 view .LVU945
+	.loc 1 1309 5 view .LVU946
+.LBB537:
+.LBI537:
+	.loc 1 432 9 view .LVU947
+.LBB538:
+	.loc 1 435 5 view .LVU948
+	.loc 1 435 20 is_stmt 0 view .LVU949
+	movq	currentPort(%rip), %rcx
+	movzwl	52(%rcx), %eax
+	.loc 1 435 42 view .LVU950
+	movzwl	48(%rcx), %edi
+	.loc 1 435 8 view .LVU951
+	cmpw	%di, %ax
+	jnb	.L153
+	.loc 1 439 5 is_stmt 1 view .LVU952
+	.loc 1 439 49 is_stmt 0 view .LVU953
+	leal	1(%rax), %edx
+	.loc 1 439 53 view .LVU954
+	movzwl	%ax, %esi
+	.loc 1 439 49 view .LVU955
+	movw	%dx, 52(%rcx)
+.LBE538:
+.LBE537:
+	.loc 1 1309 7 view .LVU956
+	movzbl	54(%rcx,%rsi), %r8d
+.LVL89:
+	.loc 1 1310 5 is_stmt 1 view .LVU957
+	.loc 1 1310 8 is_stmt 0 view .LVU958
+	cmpl	$39, %r8d
+	jbe	.L154
+.LVL90:
+.L159:
+	.loc 1 1311 15 view .LVU959
+	xorl	%eax, %eax
+	ret
+.LVL91:
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	.loc 1 1314 5 is_stmt 1 view .LVU960
+	.loc 1 1314 53 is_stmt 0 view .LVU961
+	movq	currentProfile(%rip), %r9
+.LVL92:
+	.loc 1 1315 5 is_stmt 1 view .LVU962
+.LBB539:
+.LBI539:
+	.loc 1 432 9 view .LVU963
+.LBB540:
+	.loc 1 435 5 view .LVU964
+	.loc 1 435 8 is_stmt 0 view .LVU965
+	cmpw	%di, %dx
+	jnb	.L165
+	.loc 1 439 5 is_stmt 1 view .LVU966
+	.loc 1 439 49 is_stmt 0 view .LVU967
+	addl	$2, %eax
+	.loc 1 439 53 view .LVU968
+	movzwl	%dx, %edx
+	.loc 1 439 49 view .LVU969
+	movw	%ax, 52(%rcx)
+	.loc 1 439 53 view .LVU970
+	movzbl	54(%rcx,%rdx), %esi
+.LVL93:
+.L156:
+	.loc 1 439 53 view .LVU971
+.LBE540:
+.LBE539:
+	.loc 1 1316 5 is_stmt 1 view .LVU972
+.LBB545:
+.LBI545:
+	.loc 1 541 14 view .LVU973
+.LBB546:
+	.loc 1 543 5 view .LVU974
+	.loc 1 544 5 view .LVU975
+	.loc 1 545 5 view .LVU976
+	.loc 1 545 33 view .LVU977
+	leaq	16+boxes(%rip), %rdx
+.LBE546:
+.LBE545:
+.LBB549:
+.LBB541:
+	.loc 1 436 16 is_stmt 0 view .LVU978
+	xorl	%eax, %eax
+	jmp	.L158
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	.loc 1 436 16 view .LVU979
+.LBE541:
+.LBE549:
+.LBB550:
+.LBB547:
+	.loc 1 545 74 is_stmt 1 view .LVU980
+	.loc 1 545 33 view .LVU981
+	addl	$1, %eax
+.LVL95:
+	.loc 1 545 33 is_stmt 0 view .LVU982
+	addq	$24, %rdx
+	cmpl	$23, %eax
+	je	.L159
+.LVL96:
+.L158:
+	.loc 1 546 9 is_stmt 1 view .LVU983
+	.loc 1 547 9 view .LVU984
+	.loc 1 547 12 is_stmt 0 view .LVU985
+	cmpb	%sil, (%rdx)
+	jne	.L167
+.LVL97:
+	.loc 1 547 12 view .LVU986
+.LBE547:
+.LBE550:
+	.loc 1 1317 5 is_stmt 1 view .LVU987
+	.loc 1 1321 5 view .LVU988
+.LBB551:
+.LBB548:
+	.loc 1 546 19 is_stmt 0 view .LVU989
+	cltq
+	.loc 1 546 19 view .LVU990
+	leaq	(%r9,%r8,8), %rdx
+.LBE548:
+.LBE551:
+	.loc 1 1321 22 view .LVU991
+	leaq	(%rax,%rax,2), %rsi
+.LVL98:
+	.loc 1 1321 22 view .LVU992
+	leaq	boxes(%rip), %rax
+.LVL99:
+	.loc 1 1321 22 view .LVU993
+	movzbl	(%rax,%rsi,8), %eax
+	movl	%eax, 132(%rdx)
+	.loc 1 1322 5 is_stmt 1 view .LVU994
+.LBB552:
+.LBI552:
+	.loc 1 432 9 view .LVU995
+.LBB553:
+	.loc 1 435 5 view .LVU996
+	.loc 1 435 20 is_stmt 0 view .LVU997
+	movzwl	52(%rcx), %eax
+	.loc 1 435 8 view .LVU998
+	cmpw	%di, %ax
+	jnb	.L160
+	.loc 1 439 5 is_stmt 1 view .LVU999
+	.loc 1 439 49 is_stmt 0 view .LVU1000
+	leal	1(%rax), %r8d
+	.loc 1 439 53 view .LVU1001
+	movzwl	%ax, %esi
+	.loc 1 439 49 view .LVU1002
+	movw	%r8w, 52(%rcx)
+.LBE553:
+.LBE552:
+	.loc 1 1322 26 view .LVU1003
+	movzbl	54(%rcx,%rsi), %esi
+	movb	%sil, 136(%rdx)
+	.loc 1 1323 5 is_stmt 1 view .LVU1004
+.LBB554:
+.LBI554:
+	.loc 1 432 9 view .LVU1005
+.LBB555:
+	.loc 1 435 5 view .LVU1006
+	.loc 1 435 8 is_stmt 0 view .LVU1007
+	cmpw	%di, %r8w
+	jnb	.L161
+	.loc 1 439 5 is_stmt 1 view .LVU1008
+	.loc 1 439 49 is_stmt 0 view .LVU1009
+	leal	2(%rax), %esi
+	.loc 1 439 53 view .LVU1010
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU1011
+	movw	%si, 52(%rcx)
+.LBE555:
+.LBE554:
+	.loc 1 1323 25 view .LVU1012
+	movzbl	54(%rcx,%r8), %r8d
+	movb	%r8b, 137(%rdx)
+	.loc 1 1324 5 is_stmt 1 view .LVU1013
+.LBB557:
+.LBI557:
+	.loc 1 432 9 view .LVU1014
+.LBB558:
+	.loc 1 435 5 view .LVU1015
+	.loc 1 435 8 is_stmt 0 view .LVU1016
+	cmpw	%di, %si
+	jnb	.L164
+	.loc 1 439 5 is_stmt 1 view .LVU1017
+	.loc 1 439 49 is_stmt 0 view .LVU1018
+	addl	$3, %eax
+	.loc 1 439 53 view .LVU1019
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU1020
+	movw	%ax, 52(%rcx)
+	.loc 1 439 53 view .LVU1021
+	movzbl	54(%rcx,%rsi), %eax
+.L163:
+.LBE558:
+.LBE557:
+	.loc 1 1324 23 view .LVU1022
+	movb	%al, 138(%rdx)
+	.loc 1 1325 5 is_stmt 1 view .LVU1023
+	.loc 1 1325 11 is_stmt 0 view .LVU1024
+	movl	$1, %eax
+	.loc 1 1326 1 view .LVU1025
+	ret
+.LVL100:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	.loc 1 1314 5 is_stmt 1 view .LVU1026
+	.loc 1 1314 53 is_stmt 0 view .LVU1027
+	movq	currentProfile(%rip), %r9
+.LVL101:
+	.loc 1 1315 5 is_stmt 1 view .LVU1028
+.LBB560:
+	.loc 1 432 9 view .LVU1029
+.LBB542:
+	.loc 1 435 5 view .LVU1030
+.LBE542:
+.LBE560:
+	.loc 1 1309 7 is_stmt 0 view .LVU1031
+	xorl	%r8d, %r8d
+.LBB561:
+.LBB543:
+	.loc 1 436 16 view .LVU1032
+	xorl	%esi, %esi
+	jmp	.L156
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	.loc 1 436 16 view .LVU1033
+.LBE543:
+.LBE561:
+	.loc 1 1322 26 view .LVU1034
+	movb	$0, 136(%rdx)
+	.loc 1 1323 5 is_stmt 1 view .LVU1035
+.LBB562:
+	.loc 1 432 9 view .LVU1036
+.LBB556:
+	.loc 1 435 5 view .LVU1037
+.L161:
+.LBE556:
+.LBE562:
+	.loc 1 1323 25 is_stmt 0 view .LVU1038
+	movb	$0, 137(%rdx)
+	.loc 1 1324 5 is_stmt 1 view .LVU1039
+.LBB563:
+	.loc 1 432 9 view .LVU1040
+.LBB559:
+	.loc 1 435 5 view .LVU1041
+.L164:
+	.loc 1 436 16 is_stmt 0 view .LVU1042
+	xorl	%eax, %eax
+	jmp	.L163
+.LVL103:
+.L165:
+	.loc 1 436 16 view .LVU1043
+.LBE559:
+.LBE563:
+.LBB564:
+.LBB544:
+	xorl	%esi, %esi
+	jmp	.L156
+.LBE544:
+.LBE564:
+	.cfi_endproc
+.LFE66:
+	.size	mspSetModeRange, .-mspSetModeRange
+	.section	.text.mspSetMisc,"ax",@progbits
+	.p2align 4
+	.type	mspSetMisc, @function
+mspSetMisc:
+.LFB68:
+	.loc 1 1341 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1342 5 view .LVU1045
+.LBB629:
+.LBI629:
+	.loc 1 442 10 view .LVU1046
+.LBB630:
+	.loc 1 444 5 view .LVU1047
+.LBB631:
+.LBI631:
+	.loc 1 432 9 view .LVU1048
+.LBB632:
+	.loc 1 435 5 view .LVU1049
+	.loc 1 435 20 is_stmt 0 view .LVU1050
+	movq	currentPort(%rip), %rcx
+	movzwl	52(%rcx), %edx
+	.loc 1 435 42 view .LVU1051
+	movzwl	48(%rcx), %esi
+	.loc 1 435 8 view .LVU1052
+	cmpw	%si, %dx
+	jnb	.L169
+	.loc 1 439 5 is_stmt 1 view .LVU1053
+	.loc 1 439 49 is_stmt 0 view .LVU1054
+	leal	1(%rdx), %eax
+.LVL104:
+	.loc 1 439 49 view .LVU1055
+.LBE632:
+.LBE631:
+	.loc 1 445 5 is_stmt 1 view .LVU1056
+.LBB633:
+.LBI633:
+	.loc 1 432 9 view .LVU1057
+.LBB634:
+	.loc 1 435 5 view .LVU1058
+	.loc 1 435 8 is_stmt 0 view .LVU1059
+	cmpw	%si, %ax
+	jnb	.L172
+	.loc 1 439 5 is_stmt 1 view .LVU1060
+	.loc 1 439 49 is_stmt 0 view .LVU1061
+	leal	2(%rdx), %eax
+	.loc 1 439 49 view .LVU1062
+.LBE634:
+.LBE633:
+	.loc 1 446 5 is_stmt 1 view .LVU1063
+.LVL105:
+	.loc 1 446 5 is_stmt 0 view .LVU1064
+.LBE630:
+.LBE629:
+	.loc 1 1343 5 is_stmt 1 view .LVU1065
+.LBB639:
+.LBI639:
+	.loc 1 442 10 view .LVU1066
+.LBB640:
+	.loc 1 444 5 view .LVU1067
+.LBB641:
+.LBI641:
+	.loc 1 432 9 view .LVU1068
+.LBB642:
+	.loc 1 435 5 view .LVU1069
+	.loc 1 435 8 is_stmt 0 view .LVU1070
+	cmpw	%si, %ax
+	jnb	.L172
+	.loc 1 439 5 is_stmt 1 view .LVU1071
+	.loc 1 439 49 is_stmt 0 view .LVU1072
+	leal	3(%rdx), %edi
+	.loc 1 439 53 view .LVU1073
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1074
+	movw	%di, 52(%rcx)
+.LBE642:
+.LBE641:
+	.loc 1 444 14 view .LVU1075
+	movzbl	54(%rcx,%rax), %r8d
+.LVL106:
+	.loc 1 445 5 is_stmt 1 view .LVU1076
+.LBB644:
+.LBI644:
+	.loc 1 432 9 view .LVU1077
+.LBB645:
+	.loc 1 435 5 view .LVU1078
+	.loc 1 435 8 is_stmt 0 view .LVU1079
+	cmpw	%si, %di
+	jnb	.L173
+	.loc 1 439 5 is_stmt 1 view .LVU1080
+	.loc 1 439 49 is_stmt 0 view .LVU1081
+	leal	4(%rdx), %eax
+	.loc 1 439 53 view .LVU1082
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1083
+	movw	%ax, 52(%rcx)
+.LVL107:
+	.loc 1 439 49 view .LVU1084
+.LBE645:
+.LBE644:
+	.loc 1 446 5 is_stmt 1 view .LVU1085
+	.loc 1 445 10 is_stmt 0 view .LVU1086
+	movzbl	54(%rcx,%rdi), %edi
+	.loc 1 445 28 view .LVU1087
+	sall	$8, %edi
+	.loc 1 445 7 view .LVU1088
+	addl	%edi, %r8d
+	movw	%r8w, 208+masterConfig(%rip)
+.LBE640:
+.LBE639:
+	.loc 1 1344 5 is_stmt 1 view .LVU1089
+.LBB654:
+.LBI654:
+	.loc 1 442 10 view .LVU1090
+.LBB655:
+	.loc 1 444 5 view .LVU1091
+.LBB656:
+.LBI656:
+	.loc 1 432 9 view .LVU1092
+.LBB657:
+	.loc 1 435 5 view .LVU1093
+	.loc 1 435 8 is_stmt 0 view .LVU1094
+	cmpw	%si, %ax
+	jnb	.L191
+	.loc 1 439 5 is_stmt 1 view .LVU1095
+	.loc 1 439 49 is_stmt 0 view .LVU1096
+	leal	5(%rdx), %edi
+	.loc 1 439 53 view .LVU1097
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1098
+	movw	%di, 52(%rcx)
+.LBE657:
+.LBE656:
+	.loc 1 444 14 view .LVU1099
+	movzbl	54(%rcx,%rax), %eax
+.LVL108:
+	.loc 1 445 5 is_stmt 1 view .LVU1100
+.LBB662:
+.LBI662:
+	.loc 1 432 9 view .LVU1101
+.LBB663:
+	.loc 1 435 5 view .LVU1102
+	.loc 1 435 8 is_stmt 0 view .LVU1103
+	cmpw	%si, %di
+	jnb	.L192
+	.loc 1 439 5 is_stmt 1 view .LVU1104
+	.loc 1 439 49 is_stmt 0 view .LVU1105
+	leal	6(%rdx), %r8d
+	.loc 1 439 53 view .LVU1106
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1107
+	movw	%r8w, 52(%rcx)
+.LVL109:
+	.loc 1 439 49 view .LVU1108
+.LBE663:
+.LBE662:
+	.loc 1 446 5 is_stmt 1 view .LVU1109
+	.loc 1 445 10 is_stmt 0 view .LVU1110
+	movzbl	54(%rcx,%rdi), %edi
+	.loc 1 445 28 view .LVU1111
+	sall	$8, %edi
+	.loc 1 445 7 view .LVU1112
+	addl	%edi, %eax
+	movw	%ax, 210+masterConfig(%rip)
+.LBE655:
+.LBE654:
+	.loc 1 1345 5 is_stmt 1 view .LVU1113
+.LBB675:
+.LBI675:
+	.loc 1 442 10 view .LVU1114
+.LBB676:
+	.loc 1 444 5 view .LVU1115
+.LBB677:
+.LBI677:
+	.loc 1 432 9 view .LVU1116
+.LBB678:
+	.loc 1 435 5 view .LVU1117
+	.loc 1 435 8 is_stmt 0 view .LVU1118
+	cmpw	%si, %r8w
+	jnb	.L174
+	.loc 1 439 5 is_stmt 1 view .LVU1119
+	.loc 1 439 49 is_stmt 0 view .LVU1120
+	leal	7(%rdx), %eax
+	.loc 1 439 53 view .LVU1121
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU1122
+	movw	%ax, 52(%rcx)
+.LBE678:
+.LBE677:
+	.loc 1 444 14 view .LVU1123
+	movzbl	54(%rcx,%r8), %r8d
+.LVL110:
+	.loc 1 445 5 is_stmt 1 view .LVU1124
+.LBB680:
+.LBI680:
+	.loc 1 432 9 view .LVU1125
+.LBB681:
+	.loc 1 435 5 view .LVU1126
+	.loc 1 435 8 is_stmt 0 view .LVU1127
+	cmpw	%si, %ax
+	jnb	.L175
+	.loc 1 439 5 is_stmt 1 view .LVU1128
+	.loc 1 439 49 is_stmt 0 view .LVU1129
+	leal	8(%rdx), %edi
+	.loc 1 439 53 view .LVU1130
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1131
+	movw	%di, 52(%rcx)
+.LVL111:
+	.loc 1 439 49 view .LVU1132
+.LBE681:
+.LBE680:
+	.loc 1 446 5 is_stmt 1 view .LVU1133
+	.loc 1 445 10 is_stmt 0 view .LVU1134
+	movzbl	54(%rcx,%rax), %eax
+	.loc 1 445 28 view .LVU1135
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU1136
+	addl	%eax, %r8d
+	movw	%r8w, 212+masterConfig(%rip)
+.LBE676:
+.LBE675:
+	.loc 1 1346 5 is_stmt 1 view .LVU1137
+	.loc 1 1346 19 is_stmt 0 view .LVU1138
+	movq	currentProfile(%rip), %r8
+.LBB686:
+.LBI686:
+	.loc 1 442 10 is_stmt 1 view .LVU1139
+.LBB687:
+	.loc 1 444 5 view .LVU1140
+.LBB688:
+.LBI688:
+	.loc 1 432 9 view .LVU1141
+.LBB689:
+	.loc 1 435 5 view .LVU1142
+	.loc 1 435 8 is_stmt 0 view .LVU1143
+	cmpw	%si, %di
+	jnb	.L176
+	.loc 1 439 5 is_stmt 1 view .LVU1144
+	.loc 1 439 49 is_stmt 0 view .LVU1145
+	leal	9(%rdx), %eax
+	.loc 1 439 53 view .LVU1146
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1147
+	movw	%ax, 52(%rcx)
+.LBE689:
+.LBE688:
+	.loc 1 444 14 view .LVU1148
+	movzbl	54(%rcx,%rdi), %edi
+.LVL112:
+	.loc 1 445 5 is_stmt 1 view .LVU1149
+.LBB693:
+.LBI693:
+	.loc 1 432 9 view .LVU1150
+.LBB694:
+	.loc 1 435 5 view .LVU1151
+	.loc 1 435 8 is_stmt 0 view .LVU1152
+	cmpw	%si, %ax
+	jnb	.L177
+	.loc 1 439 5 is_stmt 1 view .LVU1153
+	.loc 1 439 49 is_stmt 0 view .LVU1154
+	leal	10(%rdx), %r9d
+	.loc 1 439 53 view .LVU1155
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1156
+	movw	%r9w, 52(%rcx)
+.LVL113:
+	.loc 1 439 49 view .LVU1157
+.LBE694:
+.LBE693:
+	.loc 1 446 5 is_stmt 1 view .LVU1158
+	.loc 1 445 10 is_stmt 0 view .LVU1159
+	movzbl	54(%rcx,%rax), %eax
+	.loc 1 445 28 view .LVU1160
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU1161
+	addl	%eax, %edi
+	movw	%di, 526(%r8)
+.LBE687:
+.LBE686:
+	.loc 1 1347 5 is_stmt 1 view .LVU1162
+.LBB703:
+.LBI703:
+	.loc 1 442 10 view .LVU1163
+.LBB704:
+	.loc 1 444 5 view .LVU1164
+.LBB705:
+.LBI705:
+	.loc 1 432 9 view .LVU1165
+.LBB706:
+	.loc 1 435 5 view .LVU1166
+	.loc 1 435 8 is_stmt 0 view .LVU1167
+	cmpw	%si, %r9w
+	jnb	.L194
+	.loc 1 439 5 is_stmt 1 view .LVU1168
+	.loc 1 439 49 is_stmt 0 view .LVU1169
+	leal	11(%rdx), %eax
+.LVL114:
+	.loc 1 439 49 view .LVU1170
+.LBE706:
+.LBE705:
+	.loc 1 445 5 is_stmt 1 view .LVU1171
+.LBB712:
+.LBI712:
+	.loc 1 432 9 view .LVU1172
+.LBB713:
+	.loc 1 435 5 view .LVU1173
+	.loc 1 435 8 is_stmt 0 view .LVU1174
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1175
+	.loc 1 439 49 is_stmt 0 view .LVU1176
+	leal	12(%rdx), %eax
+	.loc 1 439 49 view .LVU1177
+.LBE713:
+.LBE712:
+	.loc 1 446 5 is_stmt 1 view .LVU1178
+.LVL115:
+	.loc 1 446 5 is_stmt 0 view .LVU1179
+.LBE704:
+.LBE703:
+	.loc 1 1348 5 is_stmt 1 view .LVU1180
+.LBB727:
+.LBI727:
+	.loc 1 449 10 view .LVU1181
+.LBB728:
+	.loc 1 451 5 view .LVU1182
+.LBB729:
+.LBI729:
+	.loc 1 442 10 view .LVU1183
+.LBB730:
+	.loc 1 444 5 view .LVU1184
+.LBB731:
+.LBI731:
+	.loc 1 432 9 view .LVU1185
+.LBB732:
+	.loc 1 435 5 view .LVU1186
+	.loc 1 435 8 is_stmt 0 view .LVU1187
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1188
+	.loc 1 439 49 is_stmt 0 view .LVU1189
+	leal	13(%rdx), %eax
+.LVL116:
+	.loc 1 439 49 view .LVU1190
+.LBE732:
+.LBE731:
+	.loc 1 445 5 is_stmt 1 view .LVU1191
+.LBB738:
+.LBI738:
+	.loc 1 432 9 view .LVU1192
+.LBB739:
+	.loc 1 435 5 view .LVU1193
+	.loc 1 435 8 is_stmt 0 view .LVU1194
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1195
+	.loc 1 439 49 is_stmt 0 view .LVU1196
+	leal	14(%rdx), %eax
+	.loc 1 439 49 view .LVU1197
+.LBE739:
+.LBE738:
+	.loc 1 446 5 is_stmt 1 view .LVU1198
+.LVL117:
+	.loc 1 446 5 is_stmt 0 view .LVU1199
+.LBE730:
+.LBE729:
+	.loc 1 452 5 is_stmt 1 view .LVU1200
+.LBB763:
+.LBI763:
+	.loc 1 442 10 view .LVU1201
+.LBB764:
+	.loc 1 444 5 view .LVU1202
+.LBB765:
+.LBI765:
+	.loc 1 432 9 view .LVU1203
+.LBB766:
+	.loc 1 435 5 view .LVU1204
+	.loc 1 435 8 is_stmt 0 view .LVU1205
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1206
+	.loc 1 439 49 is_stmt 0 view .LVU1207
+	leal	15(%rdx), %eax
+.LVL118:
+	.loc 1 439 49 view .LVU1208
+.LBE766:
+.LBE765:
+	.loc 1 445 5 is_stmt 1 view .LVU1209
+.LBB773:
+.LBI773:
+	.loc 1 432 9 view .LVU1210
+.LBB774:
+	.loc 1 435 5 view .LVU1211
+	.loc 1 435 8 is_stmt 0 view .LVU1212
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1213
+	.loc 1 439 49 is_stmt 0 view .LVU1214
+	leal	16(%rdx), %eax
+	.loc 1 439 49 view .LVU1215
+.LBE774:
+.LBE773:
+	.loc 1 446 5 is_stmt 1 view .LVU1216
+.LVL119:
+	.loc 1 446 5 is_stmt 0 view .LVU1217
+.LBE764:
+.LBE763:
+	.loc 1 453 5 is_stmt 1 view .LVU1218
+	.loc 1 453 5 is_stmt 0 view .LVU1219
+.LBE728:
+.LBE727:
+	.loc 1 1349 5 is_stmt 1 view .LVU1220
+.LBB817:
+.LBI817:
+	.loc 1 442 10 view .LVU1221
+.LBB818:
+	.loc 1 444 5 view .LVU1222
+.LBB819:
+.LBI819:
+	.loc 1 432 9 view .LVU1223
+.LBB820:
+	.loc 1 435 5 view .LVU1224
+	.loc 1 435 8 is_stmt 0 view .LVU1225
+	cmpw	%si, %ax
+	jnb	.L181
+	.loc 1 439 5 is_stmt 1 view .LVU1226
+	.loc 1 439 49 is_stmt 0 view .LVU1227
+	leal	17(%rdx), %edi
+	.loc 1 439 53 view .LVU1228
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1229
+	movw	%di, 52(%rcx)
+	.loc 1 439 53 view .LVU1230
+	movzbl	54(%rcx,%rax), %eax
+.LVL120:
+	.loc 1 439 53 view .LVU1231
+.LBE820:
+.LBE819:
+	.loc 1 445 5 is_stmt 1 view .LVU1232
+.LBB827:
+.LBI827:
+	.loc 1 432 9 view .LVU1233
+.LBB828:
+	.loc 1 435 5 view .LVU1234
+	.loc 1 435 8 is_stmt 0 view .LVU1235
+	cmpw	%si, %di
+	jnb	.L195
+	.loc 1 439 5 is_stmt 1 view .LVU1236
+	.loc 1 439 49 is_stmt 0 view .LVU1237
+	addl	$18, %edx
+	.loc 1 439 53 view .LVU1238
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1239
+	movw	%dx, 52(%rcx)
+.LBE828:
+.LBE827:
+	.loc 1 445 10 view .LVU1240
+	movzbl	54(%rcx,%rdi), %edi
+	.loc 1 445 28 view .LVU1241
+	sall	$8, %edi
+	.loc 1 445 7 view .LVU1242
+	addl	%edi, %eax
+.LVL121:
+	.loc 1 445 7 view .LVU1243
+.LBE818:
+.LBE817:
+	.loc 1 1349 37 view .LVU1244
+	leal	(%rax,%rax,4), %eax
+	addl	%eax, %eax
+.LVL122:
+.LBB855:
+.LBB847:
+	.loc 1 446 5 is_stmt 1 view .LVU1245
+.LBE847:
+.LBE855:
+	.loc 1 1349 37 is_stmt 0 view .LVU1246
+	movw	%ax, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1247
+.LBB856:
+.LBI856:
+	.loc 1 432 9 view .LVU1248
+.LBB857:
+	.loc 1 435 5 view .LVU1249
+	.loc 1 435 8 is_stmt 0 view .LVU1250
+	cmpw	%si, %dx
+	jnb	.L180
+.L196:
+	.loc 1 439 5 is_stmt 1 view .LVU1251
+	.loc 1 439 49 is_stmt 0 view .LVU1252
+	leal	1(%rdx), %edi
+	.loc 1 439 53 view .LVU1253
+	movzwl	%dx, %eax
+	.loc 1 439 49 view .LVU1254
+	movw	%di, 52(%rcx)
+.LBE857:
+.LBE856:
+	.loc 1 1350 42 view .LVU1255
+	movzbl	54(%rcx,%rax), %eax
+	movb	%al, 300+masterConfig(%rip)
+	.loc 1 1351 5 is_stmt 1 view .LVU1256
+.LBB865:
+.LBI865:
+	.loc 1 432 9 view .LVU1257
+.LBB866:
+	.loc 1 435 5 view .LVU1258
+	.loc 1 435 8 is_stmt 0 view .LVU1259
+	cmpw	%si, %di
+	jnb	.L187
+	.loc 1 439 5 is_stmt 1 view .LVU1260
+	.loc 1 439 49 is_stmt 0 view .LVU1261
+	leal	2(%rdx), %eax
+	.loc 1 439 53 view .LVU1262
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1263
+	movw	%ax, 52(%rcx)
+.LBE866:
+.LBE865:
+	.loc 1 1351 51 view .LVU1264
+	movzbl	54(%rcx,%rdi), %edi
+	movb	%dil, 302+masterConfig(%rip)
+	.loc 1 1352 5 is_stmt 1 view .LVU1265
+.LBB868:
+.LBI868:
+	.loc 1 432 9 view .LVU1266
+.LBB869:
+	.loc 1 435 5 view .LVU1267
+	.loc 1 435 8 is_stmt 0 view .LVU1268
+	cmpw	%si, %ax
+	jnb	.L188
+	.loc 1 439 5 is_stmt 1 view .LVU1269
+	.loc 1 439 49 is_stmt 0 view .LVU1270
+	leal	3(%rdx), %edi
+	.loc 1 439 53 view .LVU1271
+	movzwl	%ax, %eax
+	.loc 1 439 49 view .LVU1272
+	movw	%di, 52(%rcx)
+.LBE869:
+.LBE868:
+	.loc 1 1352 51 view .LVU1273
+	movzbl	54(%rcx,%rax), %eax
+	movb	%al, 301+masterConfig(%rip)
+	.loc 1 1353 5 is_stmt 1 view .LVU1274
+.LBB871:
+.LBI871:
+	.loc 1 432 9 view .LVU1275
+.LBB872:
+	.loc 1 435 5 view .LVU1276
+	.loc 1 435 8 is_stmt 0 view .LVU1277
+	cmpw	%si, %di
+	jnb	.L193
+	.loc 1 439 5 is_stmt 1 view .LVU1278
+	.loc 1 439 49 is_stmt 0 view .LVU1279
+	addl	$4, %edx
+	movw	%dx, 52(%rcx)
+.L193:
+.LBE872:
+.LBE871:
+	.loc 1 1355 1 view .LVU1280
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L169:
+.LVL123:
+.LBB874:
+.LBB637:
+	.loc 1 446 5 is_stmt 1 view .LVU1281
+	.loc 1 446 5 is_stmt 0 view .LVU1282
+.LBE637:
+.LBE874:
+	.loc 1 1343 5 is_stmt 1 view .LVU1283
+.LBB875:
+	.loc 1 442 10 view .LVU1284
+.LBB651:
+	.loc 1 444 5 view .LVU1285
+.LBB648:
+	.loc 1 432 9 view .LVU1286
+.LBB643:
+	.loc 1 435 5 view .LVU1287
+	.loc 1 435 5 is_stmt 0 view .LVU1288
+.LBE643:
+.LBE648:
+	.loc 1 445 5 is_stmt 1 view .LVU1289
+.LBB649:
+	.loc 1 432 9 view .LVU1290
+.LBB646:
+	.loc 1 435 5 view .LVU1291
+	.loc 1 435 5 is_stmt 0 view .LVU1292
+.LBE646:
+.LBE649:
+	.loc 1 446 5 is_stmt 1 view .LVU1293
+.LBE651:
+.LBE875:
+	.loc 1 1343 48 is_stmt 0 view .LVU1294
+	xorl	%r8d, %r8d
+	xorl	%eax, %eax
+	movw	%r8w, 208+masterConfig(%rip)
+	.loc 1 1344 5 is_stmt 1 view .LVU1295
+.LBB876:
+	.loc 1 442 10 view .LVU1296
+.LBB670:
+	.loc 1 444 5 view .LVU1297
+.LBB665:
+	.loc 1 432 9 view .LVU1298
+.LBB658:
+	.loc 1 435 5 view .LVU1299
+.L171:
+.LBE658:
+.LBE665:
+	.loc 1 446 5 view .LVU1300
+.LBE670:
+.LBE876:
+	.loc 1 1344 48 is_stmt 0 view .LVU1301
+	movw	%ax, 210+masterConfig(%rip)
+	.loc 1 1345 5 is_stmt 1 view .LVU1302
+.LBB877:
+	.loc 1 442 10 view .LVU1303
+.LBB683:
+	.loc 1 444 5 view .LVU1304
+.LBB682:
+	.loc 1 432 9 view .LVU1305
+.LBB679:
+	.loc 1 435 5 view .LVU1306
+.LBE679:
+.LBE682:
+	.loc 1 446 5 view .LVU1307
+.LBE683:
+.LBE877:
+	.loc 1 1346 19 is_stmt 0 view .LVU1308
+	movq	currentProfile(%rip), %r8
+	.loc 1 1345 47 view .LVU1309
+	xorl	%eax, %eax
+	.loc 1 1346 54 view .LVU1310
+	xorl	%edi, %edi
+	.loc 1 1345 47 view .LVU1311
+	movw	%ax, 212+masterConfig(%rip)
+	.loc 1 1346 5 is_stmt 1 view .LVU1312
+.LBB878:
+	.loc 1 442 10 view .LVU1313
+.LBB698:
+	.loc 1 444 5 view .LVU1314
+.LBB695:
+	.loc 1 432 9 view .LVU1315
+.LBB690:
+	.loc 1 435 5 view .LVU1316
+.LBE690:
+.LBE695:
+	.loc 1 446 5 view .LVU1317
+.LBE698:
+.LBE878:
+	.loc 1 1346 54 is_stmt 0 view .LVU1318
+	xorl	%eax, %eax
+	movw	%di, 526(%r8)
+	.loc 1 1347 5 is_stmt 1 view .LVU1319
+.LBB879:
+	.loc 1 442 10 view .LVU1320
+.LBB721:
+	.loc 1 444 5 view .LVU1321
+.LBB715:
+	.loc 1 432 9 view .LVU1322
+.LBB707:
+	.loc 1 435 5 view .LVU1323
+.LVL124:
+	.loc 1 435 5 is_stmt 0 view .LVU1324
+.LBE707:
+.LBE715:
+	.loc 1 446 5 is_stmt 1 view .LVU1325
+	.loc 1 446 5 is_stmt 0 view .LVU1326
+.LBE721:
+.LBE879:
+	.loc 1 1348 5 is_stmt 1 view .LVU1327
+.LBB880:
+	.loc 1 449 10 view .LVU1328
+.LBB811:
+	.loc 1 451 5 view .LVU1329
+.LBB799:
+	.loc 1 442 10 view .LVU1330
+.LBB757:
+	.loc 1 444 5 view .LVU1331
+.LBB746:
+	.loc 1 432 9 view .LVU1332
+.LBB733:
+	.loc 1 435 5 view .LVU1333
+	.loc 1 435 5 is_stmt 0 view .LVU1334
+.LBE733:
+.LBE746:
+	.loc 1 445 5 is_stmt 1 view .LVU1335
+.LBB747:
+	.loc 1 432 9 view .LVU1336
+.LBB740:
+	.loc 1 435 5 view .LVU1337
+	.loc 1 435 5 is_stmt 0 view .LVU1338
+.LBE740:
+.LBE747:
+	.loc 1 446 5 is_stmt 1 view .LVU1339
+	.loc 1 446 5 is_stmt 0 view .LVU1340
+.LBE757:
+.LBE799:
+	.loc 1 452 5 is_stmt 1 view .LVU1341
+.LBB800:
+	.loc 1 442 10 view .LVU1342
+.LBB793:
+	.loc 1 444 5 view .LVU1343
+.LBB781:
+	.loc 1 432 9 view .LVU1344
+.LBB767:
+	.loc 1 435 5 view .LVU1345
+	.loc 1 435 5 is_stmt 0 view .LVU1346
+.LBE767:
+.LBE781:
+	.loc 1 445 5 is_stmt 1 view .LVU1347
+.LBB782:
+	.loc 1 432 9 view .LVU1348
+.LBB775:
+	.loc 1 435 5 view .LVU1349
+	.loc 1 435 5 is_stmt 0 view .LVU1350
+.LBE775:
+.LBE782:
+	.loc 1 446 5 is_stmt 1 view .LVU1351
+	.loc 1 446 5 is_stmt 0 view .LVU1352
+.LBE793:
+.LBE800:
+	.loc 1 453 5 is_stmt 1 view .LVU1353
+	.loc 1 453 5 is_stmt 0 view .LVU1354
+.LBE811:
+.LBE880:
+	.loc 1 1349 5 is_stmt 1 view .LVU1355
+.LBB881:
+	.loc 1 442 10 view .LVU1356
+.LBB848:
+	.loc 1 444 5 view .LVU1357
+.LBB835:
+	.loc 1 432 9 view .LVU1358
+.LBB821:
+	.loc 1 435 5 view .LVU1359
+	.loc 1 435 5 is_stmt 0 view .LVU1360
+.LBE821:
+.LBE835:
+	.loc 1 445 5 is_stmt 1 view .LVU1361
+.LBB836:
+	.loc 1 432 9 view .LVU1362
+.LBB829:
+	.loc 1 435 5 view .LVU1363
+	.loc 1 435 5 is_stmt 0 view .LVU1364
+.LBE829:
+.LBE836:
+	.loc 1 446 5 is_stmt 1 view .LVU1365
+.LBE848:
+.LBE881:
+	.loc 1 1349 37 is_stmt 0 view .LVU1366
+	movw	%ax, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1367
+.LBB882:
+	.loc 1 432 9 view .LVU1368
+.LBB858:
+	.loc 1 435 5 view .LVU1369
+	.loc 1 435 8 is_stmt 0 view .LVU1370
+	cmpw	%si, %dx
+	jb	.L196
+.L180:
+.LBE858:
+.LBE882:
+	.loc 1 1350 42 view .LVU1371
+	movb	$0, 300+masterConfig(%rip)
+	.loc 1 1351 5 is_stmt 1 view .LVU1372
+.LBB883:
+	.loc 1 432 9 view .LVU1373
+.LBB867:
+	.loc 1 435 5 view .LVU1374
+.L187:
+.LBE867:
+.LBE883:
+	.loc 1 1351 51 is_stmt 0 view .LVU1375
+	movb	$0, 302+masterConfig(%rip)
+	.loc 1 1352 5 is_stmt 1 view .LVU1376
+.LBB884:
+	.loc 1 432 9 view .LVU1377
+.LBB870:
+	.loc 1 435 5 view .LVU1378
+.L188:
+.LBE870:
+.LBE884:
+	.loc 1 1352 51 is_stmt 0 view .LVU1379
+	movb	$0, 301+masterConfig(%rip)
+	.loc 1 1353 5 is_stmt 1 view .LVU1380
+.LBB885:
+	.loc 1 432 9 view .LVU1381
+.LBB873:
+	.loc 1 435 5 view .LVU1382
+.LBE873:
+.LBE885:
+	.loc 1 1354 5 view .LVU1383
+	.loc 1 1355 1 is_stmt 0 view .LVU1384
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L191:
+.LBB886:
+.LBB671:
+.LBB666:
+.LBB659:
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	jmp	.L171
+.L174:
+.LBE659:
+.LBE666:
+.LBE671:
+.LBE886:
+.LBB887:
+.LBB684:
+	.loc 1 446 5 is_stmt 1 view .LVU1385
+.LBE684:
+.LBE887:
+	.loc 1 1345 47 is_stmt 0 view .LVU1386
+	movw	$0, 212+masterConfig(%rip)
+	.loc 1 1346 5 is_stmt 1 view .LVU1387
+	.loc 1 1346 19 is_stmt 0 view .LVU1388
+	movq	currentProfile(%rip), %rax
+.LBB888:
+	.loc 1 442 10 is_stmt 1 view .LVU1389
+.LBB699:
+	.loc 1 444 5 view .LVU1390
+.LBB696:
+	.loc 1 432 9 view .LVU1391
+.LBB691:
+	.loc 1 435 5 view .LVU1392
+.LBE691:
+.LBE696:
+	.loc 1 446 5 view .LVU1393
+.LBE699:
+.LBE888:
+	.loc 1 1346 54 is_stmt 0 view .LVU1394
+	movw	$0, 526(%rax)
+	.loc 1 1347 5 is_stmt 1 view .LVU1395
+.LBB889:
+	.loc 1 442 10 view .LVU1396
+.LBB722:
+	.loc 1 444 5 view .LVU1397
+.LBB716:
+	.loc 1 432 9 view .LVU1398
+.LBB708:
+	.loc 1 435 5 view .LVU1399
+.LVL125:
+	.loc 1 435 5 is_stmt 0 view .LVU1400
+.LBE708:
+.LBE716:
+	.loc 1 446 5 is_stmt 1 view .LVU1401
+	.loc 1 446 5 is_stmt 0 view .LVU1402
+.LBE722:
+.LBE889:
+	.loc 1 1348 5 is_stmt 1 view .LVU1403
+.LBB890:
+	.loc 1 449 10 view .LVU1404
+.LBB812:
+	.loc 1 451 5 view .LVU1405
+.LBB801:
+	.loc 1 442 10 view .LVU1406
+.LBB758:
+	.loc 1 444 5 view .LVU1407
+.LBB748:
+	.loc 1 432 9 view .LVU1408
+.LBB734:
+	.loc 1 435 5 view .LVU1409
+	.loc 1 435 5 is_stmt 0 view .LVU1410
+.LBE734:
+.LBE748:
+	.loc 1 445 5 is_stmt 1 view .LVU1411
+.LBB749:
+	.loc 1 432 9 view .LVU1412
+.LBB741:
+	.loc 1 435 5 view .LVU1413
+	.loc 1 435 5 is_stmt 0 view .LVU1414
+.LBE741:
+.LBE749:
+	.loc 1 446 5 is_stmt 1 view .LVU1415
+	.loc 1 446 5 is_stmt 0 view .LVU1416
+.LBE758:
+.LBE801:
+	.loc 1 452 5 is_stmt 1 view .LVU1417
+.LBB802:
+	.loc 1 442 10 view .LVU1418
+.LBB794:
+	.loc 1 444 5 view .LVU1419
+.LBB783:
+	.loc 1 432 9 view .LVU1420
+.LBB768:
+	.loc 1 435 5 view .LVU1421
+	.loc 1 435 5 is_stmt 0 view .LVU1422
+.LBE768:
+.LBE783:
+	.loc 1 445 5 is_stmt 1 view .LVU1423
+.LBB784:
+	.loc 1 432 9 view .LVU1424
+.LBB776:
+	.loc 1 435 5 view .LVU1425
+	.loc 1 435 5 is_stmt 0 view .LVU1426
+.LBE776:
+.LBE784:
+	.loc 1 446 5 is_stmt 1 view .LVU1427
+	.loc 1 446 5 is_stmt 0 view .LVU1428
+.LBE794:
+.LBE802:
+	.loc 1 453 5 is_stmt 1 view .LVU1429
+	.loc 1 453 5 is_stmt 0 view .LVU1430
+.LBE812:
+.LBE890:
+	.loc 1 1349 5 is_stmt 1 view .LVU1431
+.LBB891:
+	.loc 1 442 10 view .LVU1432
+.LBB849:
+	.loc 1 444 5 view .LVU1433
+.LBB837:
+	.loc 1 432 9 view .LVU1434
+.LBB822:
+	.loc 1 435 5 view .LVU1435
+	.loc 1 435 5 is_stmt 0 view .LVU1436
+.LBE822:
+.LBE837:
+	.loc 1 445 5 is_stmt 1 view .LVU1437
+.LBB838:
+	.loc 1 432 9 view .LVU1438
+.LBB830:
+	.loc 1 435 5 view .LVU1439
+	.loc 1 435 5 is_stmt 0 view .LVU1440
+.LBE830:
+.LBE838:
+	.loc 1 446 5 is_stmt 1 view .LVU1441
+.LBE849:
+.LBE891:
+	.loc 1 1349 37 is_stmt 0 view .LVU1442
+	movw	$0, 94(%rax)
+	.loc 1 1350 5 is_stmt 1 view .LVU1443
+.LBB892:
+	.loc 1 432 9 view .LVU1444
+.LBB859:
+	.loc 1 435 5 view .LVU1445
+	jmp	.L180
+.L181:
+.LBE859:
+.LBE892:
+.LBB893:
+.LBB723:
+.LBB717:
+.LBB714:
+	.loc 1 439 49 is_stmt 0 view .LVU1446
+	movw	%ax, 52(%rcx)
+.LVL126:
+	.loc 1 439 49 view .LVU1447
+.LBE714:
+.LBE717:
+.LBE723:
+.LBE893:
+.LBB894:
+.LBB813:
+.LBB803:
+.LBB759:
+	.loc 1 445 5 is_stmt 1 view .LVU1448
+.LBB750:
+	.loc 1 432 9 view .LVU1449
+.LBB742:
+	.loc 1 435 5 view .LVU1450
+	.loc 1 435 5 is_stmt 0 view .LVU1451
+.LBE742:
+.LBE750:
+	.loc 1 446 5 is_stmt 1 view .LVU1452
+	.loc 1 446 5 is_stmt 0 view .LVU1453
+.LBE759:
+.LBE803:
+	.loc 1 452 5 is_stmt 1 view .LVU1454
+.LBB804:
+	.loc 1 442 10 view .LVU1455
+.LBB795:
+	.loc 1 444 5 view .LVU1456
+.LBB785:
+	.loc 1 432 9 view .LVU1457
+.LBB769:
+	.loc 1 435 5 view .LVU1458
+	.loc 1 435 5 is_stmt 0 view .LVU1459
+.LBE769:
+.LBE785:
+	.loc 1 445 5 is_stmt 1 view .LVU1460
+.LBB786:
+	.loc 1 432 9 view .LVU1461
+.LBB777:
+	.loc 1 435 5 view .LVU1462
+	.loc 1 435 5 is_stmt 0 view .LVU1463
+.LBE777:
+.LBE786:
+	.loc 1 446 5 is_stmt 1 view .LVU1464
+	.loc 1 446 5 is_stmt 0 view .LVU1465
+.LBE795:
+.LBE804:
+	.loc 1 453 5 is_stmt 1 view .LVU1466
+	.loc 1 453 5 is_stmt 0 view .LVU1467
+.LBE813:
+.LBE894:
+	.loc 1 1349 5 is_stmt 1 view .LVU1468
+.LBB895:
+	.loc 1 442 10 view .LVU1469
+.LBB850:
+	.loc 1 444 5 view .LVU1470
+.LBB839:
+	.loc 1 432 9 view .LVU1471
+.LBB823:
+	.loc 1 435 5 view .LVU1472
+	.loc 1 435 5 is_stmt 0 view .LVU1473
+.LBE823:
+.LBE839:
+	.loc 1 445 5 is_stmt 1 view .LVU1474
+.LBB840:
+	.loc 1 432 9 view .LVU1475
+.LBB831:
+	.loc 1 435 5 view .LVU1476
+	.loc 1 435 5 is_stmt 0 view .LVU1477
+.LBE831:
+.LBE840:
+	.loc 1 446 5 is_stmt 1 view .LVU1478
+.LBE850:
+.LBE895:
+	.loc 1 1349 37 is_stmt 0 view .LVU1479
+	movw	$0, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1480
+.LBB896:
+	.loc 1 432 9 view .LVU1481
+.LBB860:
+	.loc 1 435 5 view .LVU1482
+	jmp	.L180
+.L176:
+.LBE860:
+.LBE896:
+.LBB897:
+.LBB700:
+	.loc 1 446 5 view .LVU1483
+.LBE700:
+.LBE897:
+	.loc 1 1346 54 is_stmt 0 view .LVU1484
+	movw	$0, 526(%r8)
+.L194:
+	.loc 1 1347 5 is_stmt 1 view .LVU1485
+.LBB898:
+	.loc 1 442 10 view .LVU1486
+.LBB724:
+	.loc 1 444 5 view .LVU1487
+.LBB718:
+	.loc 1 432 9 view .LVU1488
+.LBB709:
+	.loc 1 435 5 view .LVU1489
+.LVL127:
+	.loc 1 435 5 is_stmt 0 view .LVU1490
+.LBE709:
+.LBE718:
+	.loc 1 446 5 is_stmt 1 view .LVU1491
+	.loc 1 446 5 is_stmt 0 view .LVU1492
+.LBE724:
+.LBE898:
+	.loc 1 1348 5 is_stmt 1 view .LVU1493
+.LBB899:
+	.loc 1 449 10 view .LVU1494
+.LBB814:
+	.loc 1 451 5 view .LVU1495
+.LBB805:
+	.loc 1 442 10 view .LVU1496
+.LBB760:
+	.loc 1 444 5 view .LVU1497
+.LBB751:
+	.loc 1 432 9 view .LVU1498
+.LBB735:
+	.loc 1 435 5 view .LVU1499
+	.loc 1 435 5 is_stmt 0 view .LVU1500
+.LBE735:
+.LBE751:
+	.loc 1 445 5 is_stmt 1 view .LVU1501
+.LBB752:
+	.loc 1 432 9 view .LVU1502
+.LBB743:
+	.loc 1 435 5 view .LVU1503
+	.loc 1 435 5 is_stmt 0 view .LVU1504
+.LBE743:
+.LBE752:
+	.loc 1 446 5 is_stmt 1 view .LVU1505
+	.loc 1 446 5 is_stmt 0 view .LVU1506
+.LBE760:
+.LBE805:
+	.loc 1 452 5 is_stmt 1 view .LVU1507
+.LBB806:
+	.loc 1 442 10 view .LVU1508
+.LBB796:
+	.loc 1 444 5 view .LVU1509
+.LBB787:
+	.loc 1 432 9 view .LVU1510
+.LBB770:
+	.loc 1 435 5 view .LVU1511
+	.loc 1 435 5 is_stmt 0 view .LVU1512
+.LBE770:
+.LBE787:
+	.loc 1 445 5 is_stmt 1 view .LVU1513
+.LBB788:
+	.loc 1 432 9 view .LVU1514
+.LBB778:
+	.loc 1 435 5 view .LVU1515
+	.loc 1 435 5 is_stmt 0 view .LVU1516
+.LBE778:
+.LBE788:
+	.loc 1 446 5 is_stmt 1 view .LVU1517
+	.loc 1 446 5 is_stmt 0 view .LVU1518
+.LBE796:
+.LBE806:
+	.loc 1 453 5 is_stmt 1 view .LVU1519
+	.loc 1 453 5 is_stmt 0 view .LVU1520
+.LBE814:
+.LBE899:
+	.loc 1 1349 5 is_stmt 1 view .LVU1521
+.LBB900:
+	.loc 1 442 10 view .LVU1522
+.LBB851:
+	.loc 1 444 5 view .LVU1523
+.LBB841:
+	.loc 1 432 9 view .LVU1524
+.LBB824:
+	.loc 1 435 5 view .LVU1525
+	.loc 1 435 5 is_stmt 0 view .LVU1526
+.LBE824:
+.LBE841:
+	.loc 1 445 5 is_stmt 1 view .LVU1527
+.LBB842:
+	.loc 1 432 9 view .LVU1528
+.LBB832:
+	.loc 1 435 5 view .LVU1529
+	.loc 1 435 5 is_stmt 0 view .LVU1530
+.LBE832:
+.LBE842:
+	.loc 1 446 5 is_stmt 1 view .LVU1531
+.LBE851:
+.LBE900:
+	.loc 1 1349 37 is_stmt 0 view .LVU1532
+	movw	$0, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1533
+.LBB901:
+	.loc 1 432 9 view .LVU1534
+.LBB861:
+	.loc 1 435 5 view .LVU1535
+	jmp	.L180
+.LVL128:
+.L195:
+	.loc 1 435 5 is_stmt 0 view .LVU1536
+.LBE861:
+.LBE901:
+.LBB902:
+.LBB852:
+	.loc 1 446 5 is_stmt 1 view .LVU1537
+.LBE852:
+.LBE902:
+	.loc 1 1349 37 is_stmt 0 view .LVU1538
+	movl	$10, %edx
+	mulb	%dl
+	movw	%ax, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1539
+.LBB903:
+	.loc 1 432 9 view .LVU1540
+.LBB862:
+	.loc 1 435 5 view .LVU1541
+	jmp	.L180
+.LVL129:
+.L192:
+	.loc 1 435 5 is_stmt 0 view .LVU1542
+.LBE862:
+.LBE903:
+.LBB904:
+.LBB672:
+.LBB667:
+.LBB664:
+	movl	%edi, %edx
+	jmp	.L171
+.LVL130:
+.L173:
+	.loc 1 435 5 view .LVU1543
+.LBE664:
+.LBE667:
+.LBE672:
+.LBE904:
+.LBB905:
+.LBB652:
+	.loc 1 446 5 is_stmt 1 view .LVU1544
+.LBE652:
+.LBE905:
+	.loc 1 1343 48 is_stmt 0 view .LVU1545
+	movw	%r8w, 208+masterConfig(%rip)
+	.loc 1 1344 5 is_stmt 1 view .LVU1546
+.LBB906:
+	.loc 1 442 10 view .LVU1547
+.LBB673:
+	.loc 1 444 5 view .LVU1548
+.LBB668:
+	.loc 1 432 9 view .LVU1549
+.LBB660:
+	.loc 1 435 5 view .LVU1550
+.LBE660:
+.LBE668:
+.LBE673:
+.LBE906:
+	.loc 1 1343 48 is_stmt 0 view .LVU1551
+	movl	%edi, %edx
+	xorl	%eax, %eax
+	jmp	.L171
+.L172:
+.LBB907:
+.LBB638:
+.LBB636:
+.LBB635:
+	.loc 1 439 49 view .LVU1552
+	movw	%ax, 52(%rcx)
+.LVL131:
+	.loc 1 439 49 view .LVU1553
+.LBE635:
+.LBE636:
+.LBE638:
+.LBE907:
+.LBB908:
+.LBB653:
+	.loc 1 445 5 is_stmt 1 view .LVU1554
+.LBB650:
+	.loc 1 432 9 view .LVU1555
+.LBB647:
+	.loc 1 435 5 view .LVU1556
+	.loc 1 435 5 is_stmt 0 view .LVU1557
+.LBE647:
+.LBE650:
+	.loc 1 446 5 is_stmt 1 view .LVU1558
+.LBE653:
+.LBE908:
+	.loc 1 1343 48 is_stmt 0 view .LVU1559
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	movw	$0, 208+masterConfig(%rip)
+	.loc 1 1344 5 is_stmt 1 view .LVU1560
+.LBB909:
+	.loc 1 442 10 view .LVU1561
+.LBB674:
+	.loc 1 444 5 view .LVU1562
+.LBB669:
+	.loc 1 432 9 view .LVU1563
+.LBB661:
+	.loc 1 435 5 view .LVU1564
+	jmp	.L171
+.LVL132:
+.L177:
+	.loc 1 435 5 is_stmt 0 view .LVU1565
+.LBE661:
+.LBE669:
+.LBE674:
+.LBE909:
+.LBB910:
+.LBB701:
+	.loc 1 446 5 is_stmt 1 view .LVU1566
+.LBE701:
+.LBE910:
+	.loc 1 1346 54 is_stmt 0 view .LVU1567
+	movw	%di, 526(%r8)
+	.loc 1 1347 5 is_stmt 1 view .LVU1568
+.LBB911:
+	.loc 1 442 10 view .LVU1569
+.LBB725:
+	.loc 1 444 5 view .LVU1570
+.LBB719:
+	.loc 1 432 9 view .LVU1571
+.LBB710:
+	.loc 1 435 5 view .LVU1572
+.LVL133:
+	.loc 1 435 5 is_stmt 0 view .LVU1573
+.LBE710:
+.LBE719:
+	.loc 1 446 5 is_stmt 1 view .LVU1574
+	.loc 1 446 5 is_stmt 0 view .LVU1575
+.LBE725:
+.LBE911:
+	.loc 1 1348 5 is_stmt 1 view .LVU1576
+.LBB912:
+	.loc 1 449 10 view .LVU1577
+.LBB815:
+	.loc 1 451 5 view .LVU1578
+.LBB807:
+	.loc 1 442 10 view .LVU1579
+.LBB761:
+	.loc 1 444 5 view .LVU1580
+.LBB753:
+	.loc 1 432 9 view .LVU1581
+.LBB736:
+	.loc 1 435 5 view .LVU1582
+	.loc 1 435 5 is_stmt 0 view .LVU1583
+.LBE736:
+.LBE753:
+	.loc 1 445 5 is_stmt 1 view .LVU1584
+.LBB754:
+	.loc 1 432 9 view .LVU1585
+.LBB744:
+	.loc 1 435 5 view .LVU1586
+	.loc 1 435 5 is_stmt 0 view .LVU1587
+.LBE744:
+.LBE754:
+	.loc 1 446 5 is_stmt 1 view .LVU1588
+	.loc 1 446 5 is_stmt 0 view .LVU1589
+.LBE761:
+.LBE807:
+	.loc 1 452 5 is_stmt 1 view .LVU1590
+.LBB808:
+	.loc 1 442 10 view .LVU1591
+.LBB797:
+	.loc 1 444 5 view .LVU1592
+.LBB789:
+	.loc 1 432 9 view .LVU1593
+.LBB771:
+	.loc 1 435 5 view .LVU1594
+	.loc 1 435 5 is_stmt 0 view .LVU1595
+.LBE771:
+.LBE789:
+	.loc 1 445 5 is_stmt 1 view .LVU1596
+.LBB790:
+	.loc 1 432 9 view .LVU1597
+.LBB779:
+	.loc 1 435 5 view .LVU1598
+	.loc 1 435 5 is_stmt 0 view .LVU1599
+.LBE779:
+.LBE790:
+	.loc 1 446 5 is_stmt 1 view .LVU1600
+	.loc 1 446 5 is_stmt 0 view .LVU1601
+.LBE797:
+.LBE808:
+	.loc 1 453 5 is_stmt 1 view .LVU1602
+	.loc 1 453 5 is_stmt 0 view .LVU1603
+.LBE815:
+.LBE912:
+	.loc 1 1349 5 is_stmt 1 view .LVU1604
+.LBB913:
+	.loc 1 442 10 view .LVU1605
+.LBB853:
+	.loc 1 444 5 view .LVU1606
+.LBB843:
+	.loc 1 432 9 view .LVU1607
+.LBB825:
+	.loc 1 435 5 view .LVU1608
+	.loc 1 435 5 is_stmt 0 view .LVU1609
+.LBE825:
+.LBE843:
+	.loc 1 445 5 is_stmt 1 view .LVU1610
+.LBB844:
+	.loc 1 432 9 view .LVU1611
+.LBB833:
+	.loc 1 435 5 view .LVU1612
+	.loc 1 435 5 is_stmt 0 view .LVU1613
+.LBE833:
+.LBE844:
+	.loc 1 446 5 is_stmt 1 view .LVU1614
+.LBE853:
+.LBE913:
+	.loc 1 1349 37 is_stmt 0 view .LVU1615
+	movw	$0, 94(%r8)
+	.loc 1 1350 5 is_stmt 1 view .LVU1616
+.LBB914:
+	.loc 1 432 9 view .LVU1617
+.LBB863:
+	.loc 1 435 5 view .LVU1618
+	jmp	.L180
+.LVL134:
+.L175:
+	.loc 1 435 5 is_stmt 0 view .LVU1619
+.LBE863:
+.LBE914:
+.LBB915:
+.LBB685:
+	.loc 1 446 5 is_stmt 1 view .LVU1620
+.LBE685:
+.LBE915:
+	.loc 1 1346 19 is_stmt 0 view .LVU1621
+	movq	currentProfile(%rip), %rax
+	.loc 1 1345 47 view .LVU1622
+	movw	%r8w, 212+masterConfig(%rip)
+	.loc 1 1346 5 is_stmt 1 view .LVU1623
+.LBB916:
+	.loc 1 442 10 view .LVU1624
+.LBB702:
+	.loc 1 444 5 view .LVU1625
+.LBB697:
+	.loc 1 432 9 view .LVU1626
+.LBB692:
+	.loc 1 435 5 view .LVU1627
+.LBE692:
+.LBE697:
+	.loc 1 446 5 view .LVU1628
+.LBE702:
+.LBE916:
+	.loc 1 1346 54 is_stmt 0 view .LVU1629
+	movw	$0, 526(%rax)
+	.loc 1 1347 5 is_stmt 1 view .LVU1630
+.LBB917:
+	.loc 1 442 10 view .LVU1631
+.LBB726:
+	.loc 1 444 5 view .LVU1632
+.LBB720:
+	.loc 1 432 9 view .LVU1633
+.LBB711:
+	.loc 1 435 5 view .LVU1634
+.LVL135:
+	.loc 1 435 5 is_stmt 0 view .LVU1635
+.LBE711:
+.LBE720:
+	.loc 1 446 5 is_stmt 1 view .LVU1636
+	.loc 1 446 5 is_stmt 0 view .LVU1637
+.LBE726:
+.LBE917:
+	.loc 1 1348 5 is_stmt 1 view .LVU1638
+.LBB918:
+	.loc 1 449 10 view .LVU1639
+.LBB816:
+	.loc 1 451 5 view .LVU1640
+.LBB809:
+	.loc 1 442 10 view .LVU1641
+.LBB762:
+	.loc 1 444 5 view .LVU1642
+.LBB755:
+	.loc 1 432 9 view .LVU1643
+.LBB737:
+	.loc 1 435 5 view .LVU1644
+	.loc 1 435 5 is_stmt 0 view .LVU1645
+.LBE737:
+.LBE755:
+	.loc 1 445 5 is_stmt 1 view .LVU1646
+.LBB756:
+	.loc 1 432 9 view .LVU1647
+.LBB745:
+	.loc 1 435 5 view .LVU1648
+	.loc 1 435 5 is_stmt 0 view .LVU1649
+.LBE745:
+.LBE756:
+	.loc 1 446 5 is_stmt 1 view .LVU1650
+	.loc 1 446 5 is_stmt 0 view .LVU1651
+.LBE762:
+.LBE809:
+	.loc 1 452 5 is_stmt 1 view .LVU1652
+.LBB810:
+	.loc 1 442 10 view .LVU1653
+.LBB798:
+	.loc 1 444 5 view .LVU1654
+.LBB791:
+	.loc 1 432 9 view .LVU1655
+.LBB772:
+	.loc 1 435 5 view .LVU1656
+	.loc 1 435 5 is_stmt 0 view .LVU1657
+.LBE772:
+.LBE791:
+	.loc 1 445 5 is_stmt 1 view .LVU1658
+.LBB792:
+	.loc 1 432 9 view .LVU1659
+.LBB780:
+	.loc 1 435 5 view .LVU1660
+	.loc 1 435 5 is_stmt 0 view .LVU1661
+.LBE780:
+.LBE792:
+	.loc 1 446 5 is_stmt 1 view .LVU1662
+	.loc 1 446 5 is_stmt 0 view .LVU1663
+.LBE798:
+.LBE810:
+	.loc 1 453 5 is_stmt 1 view .LVU1664
+	.loc 1 453 5 is_stmt 0 view .LVU1665
+.LBE816:
+.LBE918:
+	.loc 1 1349 5 is_stmt 1 view .LVU1666
+.LBB919:
+	.loc 1 442 10 view .LVU1667
+.LBB854:
+	.loc 1 444 5 view .LVU1668
+.LBB845:
+	.loc 1 432 9 view .LVU1669
+.LBB826:
+	.loc 1 435 5 view .LVU1670
+	.loc 1 435 5 is_stmt 0 view .LVU1671
+.LBE826:
+.LBE845:
+	.loc 1 445 5 is_stmt 1 view .LVU1672
+.LBB846:
+	.loc 1 432 9 view .LVU1673
+.LBB834:
+	.loc 1 435 5 view .LVU1674
+	.loc 1 435 5 is_stmt 0 view .LVU1675
+.LBE834:
+.LBE846:
+	.loc 1 446 5 is_stmt 1 view .LVU1676
+.LBE854:
+.LBE919:
+	.loc 1 1349 37 is_stmt 0 view .LVU1677
+	movw	$0, 94(%rax)
+	.loc 1 1350 5 is_stmt 1 view .LVU1678
+.LBB920:
+	.loc 1 432 9 view .LVU1679
+.LBB864:
+	.loc 1 435 5 view .LVU1680
+	jmp	.L180
+.LBE864:
+.LBE920:
+	.cfi_endproc
+.LFE68:
+	.size	mspSetMisc, .-mspSetMisc
+	.section	.text.mspSetPid,"ax",@progbits
+	.p2align 4
+	.type	mspSetPid, @function
+mspSetPid:
+.LFB65:
+	.loc 1 1275 1 view -0
+	.cfi_startproc
+	.loc 1 1276 5 view .LVU1682
+	.loc 1 1278 5 view .LVU1683
+.LBB945:
+.LBB946:
+	.loc 1 435 20 is_stmt 0 view .LVU1684
+	movq	currentPort(%rip), %rax
+.LBE946:
+.LBE945:
+	.loc 1 1278 23 view .LVU1685
+	movq	currentProfile(%rip), %rdi
+.LBB950:
+.LBB951:
+	.loc 1 435 20 view .LVU1686
+	movzwl	52(%rax), %esi
+.LBE951:
+.LBE950:
+	.loc 1 1278 8 view .LVU1687
+	cmpb	$2, (%rdi)
+	leaq	4(%rdi), %rdx
+	leaq	14(%rdi), %r9
+.LBB955:
+.LBB947:
+	.loc 1 435 42 view .LVU1688
+	movzwl	48(%rax), %r8d
+.LBE947:
+.LBE955:
+.LBB956:
+.LBB952:
+	.loc 1 435 20 view .LVU1689
+	movl	%esi, %ecx
+.LBE952:
+.LBE956:
+	.loc 1 1278 8 view .LVU1690
+	jne	.L216
+	jmp	.L226
+.LVL136:
+	.p2align 4,,10
+	.p2align 3
+.L227:
+.LBB957:
+.LBB953:
+	.loc 1 439 5 is_stmt 1 view .LVU1691
+	.loc 1 439 49 is_stmt 0 view .LVU1692
+	leal	1(%rcx), %edi
+	.loc 1 439 53 view .LVU1693
+	movzwl	%cx, %esi
+	.loc 1 439 49 view .LVU1694
+	movw	%di, 52(%rax)
+	.loc 1 439 53 view .LVU1695
+	movzbl	54(%rax,%rsi), %esi
+.LBE953:
+.LBE957:
+	.loc 1 1297 46 view .LVU1696
+	movb	%sil, (%rdx)
+	.loc 1 1298 13 is_stmt 1 view .LVU1697
+.LBB958:
+.LBI958:
+	.loc 1 432 9 view .LVU1698
+.LBB959:
+	.loc 1 435 5 view .LVU1699
+	.loc 1 435 8 is_stmt 0 view .LVU1700
+	cmpw	%r8w, %di
+	jnb	.L214
+	.loc 1 439 5 is_stmt 1 view .LVU1701
+	.loc 1 439 49 is_stmt 0 view .LVU1702
+	leal	2(%rcx), %esi
+	.loc 1 439 53 view .LVU1703
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU1704
+	movw	%si, 52(%rax)
+	.loc 1 439 53 view .LVU1705
+	movzbl	54(%rax,%rdi), %edi
+.LBE959:
+.LBE958:
+	.loc 1 1298 46 view .LVU1706
+	movb	%dil, 10(%rdx)
+	.loc 1 1299 13 is_stmt 1 view .LVU1707
+.LBB961:
+.LBI961:
+	.loc 1 432 9 view .LVU1708
+.LBB962:
+	.loc 1 435 5 view .LVU1709
+	.loc 1 435 8 is_stmt 0 view .LVU1710
+	cmpw	%r8w, %si
+	jnb	.L221
+	.loc 1 439 5 is_stmt 1 view .LVU1711
+	.loc 1 439 49 is_stmt 0 view .LVU1712
+	addl	$3, %ecx
+	.loc 1 439 53 view .LVU1713
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU1714
+	movw	%cx, 52(%rax)
+	.loc 1 439 53 view .LVU1715
+	movzbl	54(%rax,%rsi), %ecx
+.L215:
+.LBE962:
+.LBE961:
+	.loc 1 1299 46 view .LVU1716
+	movb	%cl, 20(%rdx)
+	.loc 1 1296 42 is_stmt 1 view .LVU1717
+.LVL137:
+	.loc 1 1296 23 view .LVU1718
+	addq	$1, %rdx
+.LVL138:
+	.loc 1 1296 23 is_stmt 0 view .LVU1719
+	cmpq	%rdx, %r9
+	je	.L225
+.LVL139:
+.L228:
+	.loc 1 1296 23 view .LVU1720
+	movzwl	52(%rax), %ecx
+.L216:
+.LVL140:
+	.loc 1 1297 13 is_stmt 1 view .LVU1721
+.LBB966:
+.LBI950:
+	.loc 1 432 9 view .LVU1722
+.LBB954:
+	.loc 1 435 5 view .LVU1723
+	.loc 1 435 8 is_stmt 0 view .LVU1724
+	cmpw	%r8w, %cx
+	jb	.L227
+.LBE954:
+.LBE966:
+	.loc 1 1297 46 view .LVU1725
+	movb	$0, (%rdx)
+	.loc 1 1298 13 is_stmt 1 view .LVU1726
+.LBB967:
+	.loc 1 432 9 view .LVU1727
+.LBB960:
+	.loc 1 435 5 view .LVU1728
+.L214:
+.LBE960:
+.LBE967:
+.LBB968:
+.LBB963:
+	.loc 1 436 16 is_stmt 0 view .LVU1729
+	xorl	%ecx, %ecx
+.LBE963:
+.LBE968:
+	.loc 1 1298 46 view .LVU1730
+	movb	$0, 10(%rdx)
+	.loc 1 1299 13 is_stmt 1 view .LVU1731
+.LBB969:
+	.loc 1 432 9 view .LVU1732
+.LBB964:
+	.loc 1 435 5 view .LVU1733
+.LBE964:
+.LBE969:
+	.loc 1 1296 23 is_stmt 0 view .LVU1734
+	addq	$1, %rdx
+.LVL141:
+	.loc 1 1299 46 view .LVU1735
+	movb	%cl, 19(%rdx)
+	.loc 1 1296 42 is_stmt 1 view .LVU1736
+.LVL142:
+	.loc 1 1296 23 view .LVU1737
+	cmpq	%rdx, %r9
+	jne	.L228
+.L225:
+	.loc 1 1303 1 is_stmt 0 view .LVU1738
+	movl	$1, %eax
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L226:
+	.loc 1 1280 64 view .LVU1739
+	movss	.LC1(%rip), %xmm3
+	.loc 1 1281 64 view .LVU1740
+	movss	.LC2(%rip), %xmm2
+	leaq	36(%rdi), %rdx
+	leaq	48(%rdi), %r10
+	.loc 1 1282 64 view .LVU1741
+	movss	.LC3(%rip), %xmm1
+.L202:
+.LVL143:
+	.loc 1 1280 13 is_stmt 1 view .LVU1742
+.LBB970:
+.LBI945:
+	.loc 1 432 9 view .LVU1743
+.LBB948:
+	.loc 1 435 5 view .LVU1744
+	.loc 1 435 8 is_stmt 0 view .LVU1745
+	cmpw	%r8w, %si
+	jnb	.L199
+	.loc 1 439 5 is_stmt 1 view .LVU1746
+	.loc 1 439 49 is_stmt 0 view .LVU1747
+	leal	1(%rsi), %ecx
+	.loc 1 439 53 view .LVU1748
+	movzwl	%si, %r9d
+.LBE948:
+.LBE970:
+	.loc 1 1280 49 view .LVU1749
+	pxor	%xmm0, %xmm0
+.LBB971:
+.LBB949:
+	.loc 1 439 49 view .LVU1750
+	movw	%cx, 52(%rax)
+.LBE949:
+.LBE971:
+	.loc 1 1280 49 view .LVU1751
+	movzbl	54(%rax,%r9), %r9d
+	cvtsi2ssl	%r9d, %xmm0
+	.loc 1 1280 64 view .LVU1752
+	divss	%xmm3, %xmm0
+	.loc 1 1280 47 view .LVU1753
+	movss	%xmm0, (%rdx)
+	.loc 1 1281 13 is_stmt 1 view .LVU1754
+.LBB972:
+.LBI972:
+	.loc 1 432 9 view .LVU1755
+.LBB973:
+	.loc 1 435 5 view .LVU1756
+	.loc 1 435 8 is_stmt 0 view .LVU1757
+	cmpw	%r8w, %cx
+	jnb	.L219
+	.loc 1 439 5 is_stmt 1 view .LVU1758
+	.loc 1 439 49 is_stmt 0 view .LVU1759
+	leal	2(%rsi), %r9d
+	.loc 1 439 53 view .LVU1760
+	movzwl	%cx, %ecx
+.LBE973:
+.LBE972:
+	.loc 1 1281 49 view .LVU1761
+	pxor	%xmm0, %xmm0
+.LBB977:
+.LBB974:
+	.loc 1 439 49 view .LVU1762
+	movw	%r9w, 52(%rax)
+.LBE974:
+.LBE977:
+	.loc 1 1281 49 view .LVU1763
+	movzbl	54(%rax,%rcx), %ecx
+	cvtsi2ssl	%ecx, %xmm0
+	.loc 1 1281 64 view .LVU1764
+	divss	%xmm2, %xmm0
+	.loc 1 1281 47 view .LVU1765
+	movss	%xmm0, 12(%rdx)
+	.loc 1 1282 13 is_stmt 1 view .LVU1766
+.LBB978:
+.LBI978:
+	.loc 1 432 9 view .LVU1767
+.LBB979:
+	.loc 1 435 5 view .LVU1768
+	.loc 1 435 8 is_stmt 0 view .LVU1769
+	cmpw	%r8w, %r9w
+	jnb	.L220
+	.loc 1 439 5 is_stmt 1 view .LVU1770
+	.loc 1 439 49 is_stmt 0 view .LVU1771
+	addl	$3, %esi
+	.loc 1 439 53 view .LVU1772
+	movzwl	%r9w, %r9d
+.LBE979:
+.LBE978:
+	.loc 1 1282 49 view .LVU1773
+	pxor	%xmm0, %xmm0
+.LBB983:
+.LBB980:
+	.loc 1 439 49 view .LVU1774
+	movw	%si, 52(%rax)
+.LBE980:
+.LBE983:
+	.loc 1 1282 49 view .LVU1775
+	movzbl	54(%rax,%r9), %ecx
+	cvtsi2ssl	%ecx, %xmm0
+	.loc 1 1282 64 view .LVU1776
+	divss	%xmm1, %xmm0
+.L201:
+	.loc 1 1282 47 view .LVU1777
+	movss	%xmm0, 24(%rdx)
+	.loc 1 1279 29 is_stmt 1 view .LVU1778
+.LVL144:
+	.loc 1 1279 23 view .LVU1779
+	addq	$4, %rdx
+.LVL145:
+	.loc 1 1279 23 is_stmt 0 view .LVU1780
+	cmpq	%rdx, %r10
+	jne	.L202
+	.loc 1 1286 69 view .LVU1781
+	movss	.LC1(%rip), %xmm1
+	movl	$3, %edx
+.LVL146:
+	.loc 1 1286 69 view .LVU1782
+	jmp	.L212
+	.p2align 4,,10
+	.p2align 3
+.L230:
+.LBB984:
+.LBB985:
+	.loc 1 439 5 is_stmt 1 view .LVU1783
+	.loc 1 439 49 is_stmt 0 view .LVU1784
+	leal	1(%rsi), %r9d
+	.loc 1 439 53 view .LVU1785
+	movzwl	%si, %ecx
+	.loc 1 439 49 view .LVU1786
+	movw	%r9w, 52(%rax)
+	.loc 1 439 53 view .LVU1787
+	movzbl	54(%rax,%rcx), %ecx
+.LBE985:
+.LBE984:
+	.loc 1 1290 50 view .LVU1788
+	movb	%cl, 4(%rdi,%rdx)
+	.loc 1 1291 17 is_stmt 1 view .LVU1789
+.LBB987:
+.LBI987:
+	.loc 1 432 9 view .LVU1790
+.LBB988:
+	.loc 1 435 5 view .LVU1791
+	.loc 1 435 8 is_stmt 0 view .LVU1792
+	cmpw	%r8w, %r9w
+	jnb	.L208
+	.loc 1 439 5 is_stmt 1 view .LVU1793
+	.loc 1 439 49 is_stmt 0 view .LVU1794
+	leal	2(%rsi), %ecx
+	.loc 1 439 53 view .LVU1795
+	movzwl	%r9w, %r9d
+	.loc 1 439 49 view .LVU1796
+	movw	%cx, 52(%rax)
+	.loc 1 439 53 view .LVU1797
+	movzbl	54(%rax,%r9), %r9d
+.LBE988:
+.LBE987:
+	.loc 1 1291 50 view .LVU1798
+	movb	%r9b, 14(%rdi,%rdx)
+	.loc 1 1292 17 is_stmt 1 view .LVU1799
+.LBB990:
+.LBI990:
+	.loc 1 432 9 view .LVU1800
+.LBB991:
+	.loc 1 435 5 view .LVU1801
+	.loc 1 435 8 is_stmt 0 view .LVU1802
+	cmpw	%r8w, %cx
+	jnb	.L218
+	.loc 1 439 5 is_stmt 1 view .LVU1803
+	.loc 1 439 49 is_stmt 0 view .LVU1804
+	addl	$3, %esi
+	.loc 1 439 53 view .LVU1805
+	movzwl	%cx, %ecx
+	.loc 1 439 49 view .LVU1806
+	movw	%si, 52(%rax)
+	.loc 1 439 53 view .LVU1807
+	movzbl	54(%rax,%rcx), %ecx
+.L210:
+.LBE991:
+.LBE990:
+	.loc 1 1292 50 view .LVU1808
+	movb	%cl, 24(%rdi,%rdx)
+	.loc 1 1284 42 is_stmt 1 view .LVU1809
+	.loc 1 1284 23 view .LVU1810
+.LVL147:
+	.loc 1 1284 23 is_stmt 0 view .LVU1811
+	addq	$1, %rdx
+.LVL148:
+	.loc 1 1284 23 view .LVU1812
+	cmpq	$10, %rdx
+	je	.L225
+.LVL149:
+.L211:
+.LBB993:
+.LBB994:
+	.loc 1 435 20 view .LVU1813
+	movzwl	52(%rax), %esi
+.L212:
+.LVL150:
+	.loc 1 435 20 view .LVU1814
+.LBE994:
+.LBE993:
+	.loc 1 1285 13 is_stmt 1 view .LVU1815
+	.loc 1 1285 16 is_stmt 0 view .LVU1816
+	cmpq	$7, %rdx
+	je	.L229
+	.loc 1 1290 17 is_stmt 1 view .LVU1817
+.LBB997:
+.LBI984:
+	.loc 1 432 9 view .LVU1818
+.LBB986:
+	.loc 1 435 5 view .LVU1819
+	.loc 1 435 8 is_stmt 0 view .LVU1820
+	cmpw	%r8w, %si
+	jb	.L230
+.LBE986:
+.LBE997:
+	.loc 1 1290 50 view .LVU1821
+	movb	$0, 4(%rdi,%rdx)
+	.loc 1 1291 17 is_stmt 1 view .LVU1822
+.LBB998:
+	.loc 1 432 9 view .LVU1823
+.LBB989:
+	.loc 1 435 5 view .LVU1824
+.L208:
+.LBE989:
+.LBE998:
+	.loc 1 1291 50 is_stmt 0 view .LVU1825
+	movb	$0, 14(%rdi,%rdx)
+	.loc 1 1292 17 is_stmt 1 view .LVU1826
+.LBB999:
+	.loc 1 432 9 view .LVU1827
+.LBB992:
+	.loc 1 435 5 view .LVU1828
+.L218:
+	.loc 1 436 16 is_stmt 0 view .LVU1829
+	xorl	%ecx, %ecx
+	jmp	.L210
+	.p2align 4,,10
+	.p2align 3
+.L229:
+.LBE992:
+.LBE999:
+	.loc 1 1286 17 is_stmt 1 view .LVU1830
+.LBB1000:
+.LBI993:
+	.loc 1 432 9 view .LVU1831
+.LBB995:
+	.loc 1 435 5 view .LVU1832
+	.loc 1 435 8 is_stmt 0 view .LVU1833
+	cmpw	%r8w, %si
+	jnb	.L204
+	.loc 1 439 5 is_stmt 1 view .LVU1834
+	.loc 1 439 49 is_stmt 0 view .LVU1835
+	leal	1(%rsi), %edx
+	.loc 1 439 53 view .LVU1836
+	movzwl	%si, %ecx
+.LBE995:
+.LBE1000:
+	.loc 1 1286 54 view .LVU1837
+	pxor	%xmm0, %xmm0
+.LBB1001:
+.LBB996:
+	.loc 1 439 49 view .LVU1838
+	movw	%dx, 52(%rax)
+.LBE996:
+.LBE1001:
+	.loc 1 1286 54 view .LVU1839
+	movzbl	54(%rax,%rcx), %ecx
+	cvtsi2ssl	%ecx, %xmm0
+	.loc 1 1286 69 view .LVU1840
+	divss	%xmm1, %xmm0
+	.loc 1 1286 52 view .LVU1841
+	movss	%xmm0, 72(%rdi)
+	.loc 1 1287 17 is_stmt 1 view .LVU1842
+.LBB1002:
+.LBI1002:
+	.loc 1 432 9 view .LVU1843
+.LBB1003:
+	.loc 1 435 5 view .LVU1844
+	.loc 1 435 8 is_stmt 0 view .LVU1845
+	cmpw	%r8w, %dx
+	jnb	.L205
+	.loc 1 439 5 is_stmt 1 view .LVU1846
+	.loc 1 439 49 is_stmt 0 view .LVU1847
+	leal	2(%rsi), %ecx
+	.loc 1 439 53 view .LVU1848
+	movzwl	%dx, %edx
+.LBE1003:
+.LBE1002:
+	.loc 1 1287 54 view .LVU1849
+	pxor	%xmm0, %xmm0
+.LBB1006:
+.LBB1004:
+	.loc 1 439 49 view .LVU1850
+	movw	%cx, 52(%rax)
+.LBE1004:
+.LBE1006:
+	.loc 1 1287 54 view .LVU1851
+	movzbl	54(%rax,%rdx), %edx
+	cvtsi2ssl	%edx, %xmm0
+	.loc 1 1287 69 view .LVU1852
+	divss	%xmm1, %xmm0
+	.loc 1 1287 52 view .LVU1853
+	movss	%xmm0, 76(%rdi)
+	.loc 1 1288 17 is_stmt 1 view .LVU1854
+.LBB1007:
+.LBI1007:
+	.loc 1 432 9 view .LVU1855
+.LBB1008:
+	.loc 1 435 5 view .LVU1856
+	.loc 1 435 8 is_stmt 0 view .LVU1857
+	cmpw	%r8w, %cx
+	jnb	.L206
+	.loc 1 439 5 is_stmt 1 view .LVU1858
+	.loc 1 439 49 is_stmt 0 view .LVU1859
+	addl	$3, %esi
+	movw	%si, 52(%rax)
+.LBE1008:
+.LBE1007:
+	.loc 1 1284 42 is_stmt 1 view .LVU1860
+	.loc 1 1284 23 view .LVU1861
+.LVL151:
+.L206:
+	.loc 1 1284 23 is_stmt 0 view .LVU1862
+	movl	$8, %edx
+	jmp	.L211
+.LVL152:
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.loc 1 1280 47 view .LVU1863
+	movl	$0x00000000, (%rdx)
+	.loc 1 1281 13 is_stmt 1 view .LVU1864
+.LBB1010:
+	.loc 1 432 9 view .LVU1865
+.LBB975:
+	.loc 1 435 5 view .LVU1866
+.L200:
+	.loc 1 435 5 is_stmt 0 view .LVU1867
+.LBE975:
+.LBE1010:
+	.loc 1 1281 47 view .LVU1868
+	movl	$0x00000000, 12(%rdx)
+	.loc 1 1282 13 is_stmt 1 view .LVU1869
+.LBB1011:
+	.loc 1 432 9 view .LVU1870
+.LBB981:
+	.loc 1 435 5 view .LVU1871
+.LBE981:
+.LBE1011:
+	.loc 1 1281 47 is_stmt 0 view .LVU1872
+	pxor	%xmm0, %xmm0
+	jmp	.L201
+.LVL153:
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	.loc 1 1286 52 view .LVU1873
+	movl	$0x00000000, 72(%rdi)
+	.loc 1 1287 17 is_stmt 1 view .LVU1874
+.LBB1012:
+	.loc 1 432 9 view .LVU1875
+.LBB1005:
+	.loc 1 435 5 view .LVU1876
+.L205:
+.LBE1005:
+.LBE1012:
+	.loc 1 1287 52 is_stmt 0 view .LVU1877
+	movl	$0x00000000, 76(%rdi)
+	.loc 1 1288 17 is_stmt 1 view .LVU1878
+.LBB1013:
+	.loc 1 432 9 view .LVU1879
+.LBB1009:
+	.loc 1 435 5 view .LVU1880
+.LBE1009:
+.LBE1013:
+	.loc 1 1284 42 view .LVU1881
+	.loc 1 1284 23 view .LVU1882
+	jmp	.L206
+.LVL154:
+.L221:
+.LBB1014:
+.LBB965:
+	.loc 1 436 16 is_stmt 0 view .LVU1883
+	xorl	%ecx, %ecx
+	jmp	.L215
+.LVL155:
+.L219:
+	.loc 1 436 16 view .LVU1884
+.LBE965:
+.LBE1014:
+.LBB1015:
+.LBB976:
+	movl	%ecx, %esi
+	jmp	.L200
+.L220:
+.LBE976:
+.LBE1015:
+.LBB1016:
+.LBB982:
+	movl	%r9d, %esi
+	pxor	%xmm0, %xmm0
+	jmp	.L201
+.LBE982:
+.LBE1016:
+	.cfi_endproc
+.LFE65:
+	.size	mspSetPid, .-mspSetPid
+	.section	.text.serialize8,"ax",@progbits
+	.p2align 4
+	.globl	serialize8
+	.type	serialize8, @function
+serialize8:
+.LVL156:
+.LFB12:
+	.loc 1 396 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 397 5 view .LVU1886
+	.loc 1 396 1 is_stmt 0 view .LVU1887
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 397 20 view .LVU1888
+	movq	currentPort(%rip), %rbx
+	.loc 1 397 8 view .LVU1889
+	cmpb	$0, 332(%rbx)
+	jne	.L231
+	.loc 1 397 35 discriminator 1 view .LVU1890
+	cmpl	$1, 336(%rbx)
+	je	.L231
+	.loc 1 401 20 view .LVU1891
+	movq	320(%rbx), %rax
+	movl	%edi, %ebp
+	.loc 1 401 5 is_stmt 1 view .LVU1892
+	.loc 1 401 8 is_stmt 0 view .LVU1893
+	testq	%rax, %rax
+	je	.L233
+	.loc 1 402 9 is_stmt 1 view .LVU1894
+	.loc 1 402 24 is_stmt 0 view .LVU1895
+	movzwl	330(%rbx), %esi
+	.loc 1 402 12 view .LVU1896
+	cmpw	328(%rbx), %si
+	jnb	.L234
+	.loc 1 403 13 is_stmt 1 view .LVU1897
+	.loc 1 403 66 is_stmt 0 view .LVU1898
+	leal	1(%rsi), %edx
+	movw	%dx, 330(%rbx)
+	.loc 1 403 70 view .LVU1899
+	movb	%dil, (%rax,%rsi)
+.LVL157:
+.L235:
+	.loc 1 413 5 is_stmt 1 view .LVU1900
+	.loc 1 413 8 is_stmt 0 view .LVU1901
+	movl	312(%rbx), %eax
+	.loc 1 414 20 view .LVU1902
+	movzbl	50(%rbx), %edi
+	.loc 1 413 8 view .LVU1903
+	testl	%eax, %eax
+	jne	.L236
+	.loc 1 414 9 is_stmt 1 view .LVU1904
+	.loc 1 414 31 is_stmt 0 view .LVU1905
+	xorl	%ebp, %edi
+	movb	%dil, 50(%rbx)
+.L231:
+	.loc 1 418 1 view .LVU1906
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL158:
+	.p2align 4,,10
+	.p2align 3
+.L233:
+	.cfi_restore_state
+	.loc 1 410 9 is_stmt 1 view .LVU1907
+	movzbl	%dil, %esi
+	movq	mspSerialPort(%rip), %rdi
+.LVL159:
+	.loc 1 410 9 is_stmt 0 view .LVU1908
+	call	serialWrite@PLT
+.LVL160:
+	.loc 1 413 20 view .LVU1909
+	movq	currentPort(%rip), %rbx
+	jmp	.L235
+	.p2align 4,,10
+	.p2align 3
+.L236:
+	.loc 1 416 9 is_stmt 1 view .LVU1910
+	.loc 1 416 33 is_stmt 0 view .LVU1911
+	movzbl	%bpl, %esi
+	call	crc8DvbS2@PLT
+.LVL161:
+	.loc 1 416 31 view .LVU1912
+	movb	%al, 50(%rbx)
+	.loc 1 418 1 view .LVU1913
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL162:
+	.p2align 4,,10
+	.p2align 3
+.L234:
+	.cfi_restore_state
+	.loc 1 406 13 is_stmt 1 view .LVU1914
+.LBB1019:
+.LBI1019:
+	.loc 1 387 13 view .LVU1915
+.LBB1020:
+	.loc 1 389 5 view .LVU1916
+	.loc 1 390 9 view .LVU1917
+	movq	mspSerialPort(%rip), %rdi
+.LVL163:
+	.loc 1 390 9 is_stmt 0 view .LVU1918
+	call	serialTxCommit@PLT
+.LVL164:
+	.loc 1 391 9 is_stmt 1 view .LVU1919
+	.loc 1 391 33 is_stmt 0 view .LVU1920
+	movq	currentPort(%rip), %rax
+.LBE1020:
+.LBE1019:
+	.loc 1 407 13 view .LVU1921
+	movq	mspSerialPort(%rip), %rdi
+	movzbl	%bpl, %esi
+.LBB1022:
+.LBB1021:
+	.loc 1 391 33 view .LVU1922
+	movq	$0, 320(%rax)
+.LBE1021:
+.LBE1022:
+	.loc 1 407 13 is_stmt 1 view .LVU1923
+	call	serialWrite@PLT
+.LVL165:
+	.loc 1 413 20 is_stmt 0 view .LVU1924
+	movq	currentPort(%rip), %rbx
+	jmp	.L235
+	.cfi_endproc
+.LFE12:
+	.size	serialize8, .-serialize8
+	.section	.text.serialize16,"ax",@progbits
+	.p2align 4
+	.globl	serialize16
+	.type	serialize16, @function
+serialize16:
+.LVL166:
+.LFB13:
+	.loc 1 421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 422 5 view .LVU1926
+	.loc 1 421 1 is_stmt 0 view .LVU1927
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 421 1 view .LVU1928
+	movl	%edi, %ebx
+	.loc 1 422 5 view .LVU1929
+	movzbl	%dil, %edi
+.LVL167:
+	.loc 1 422 5 view .LVU1930
+	call	serialize8
+.LVL168:
+	.loc 1 423 5 is_stmt 1 view .LVU1931
+	movzbl	%bh, %edi
+	.loc 1 424 1 is_stmt 0 view .LVU1932
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	.loc 1 423 5 view .LVU1933
+	jmp	serialize8
+.LVL169:
+	.cfi_endproc
+.LFE13:
+	.size	serialize16, .-serialize16
+	.section	.text.serialize32,"ax",@progbits
+	.p2align 4
+	.globl	serialize32
+	.type	serialize32, @function
+serialize32:
+.LVL170:
+.LFB14:
+	.loc 1 427 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 428 5 view .LVU1935
+.LBB1027:
+.LBI1027:
+	.loc 1 420 6 view .LVU1936
+.LBB1028:
+	.loc 1 422 5 view .LVU1937
+.LBE1028:
+.LBE1027:
+	.loc 1 427 1 is_stmt 0 view .LVU1938
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 427 1 view .LVU1939
+	movl	%edi, %ebx
+.LBB1031:
+.LBB1029:
+	.loc 1 422 5 view .LVU1940
+	movzbl	%dil, %edi
+.LVL171:
+	.loc 1 422 5 view .LVU1941
+	call	serialize8
+.LVL172:
+	.loc 1 423 5 is_stmt 1 view .LVU1942
+	movzbl	%bh, %edi
+.LBE1029:
+.LBE1031:
+	.loc 1 429 27 is_stmt 0 view .LVU1943
+	shrl	$16, %ebx
+.LVL173:
+.LBB1032:
+.LBB1030:
+	.loc 1 423 5 view .LVU1944
+	call	serialize8
+.LVL174:
+	.loc 1 423 5 view .LVU1945
+.LBE1030:
+.LBE1032:
+	.loc 1 429 5 is_stmt 1 view .LVU1946
+.LBB1033:
+.LBI1033:
+	.loc 1 420 6 view .LVU1947
+.LBB1034:
+	.loc 1 422 5 view .LVU1948
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU1949
+	shrl	$8, %ebx
+.LVL175:
+	.loc 1 422 5 view .LVU1950
+	call	serialize8
+.LVL176:
+	.loc 1 423 5 is_stmt 1 view .LVU1951
+	movl	%ebx, %edi
+.LBE1034:
+.LBE1033:
+	.loc 1 430 1 is_stmt 0 view .LVU1952
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LBB1036:
+.LBB1035:
+	.loc 1 423 5 view .LVU1953
+	jmp	serialize8
+.LVL177:
+.LBE1035:
+.LBE1036:
+	.cfi_endproc
+.LFE14:
+	.size	serialize32, .-serialize32
+	.section	.text.read8,"ax",@progbits
+	.p2align 4
+	.globl	read8
+	.type	read8, @function
+read8:
+.LFB15:
+	.loc 1 433 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 435 5 view .LVU1955
+	.loc 1 435 20 is_stmt 0 view .LVU1956
+	movq	currentPort(%rip), %rdx
+	.loc 1 436 16 view .LVU1957
+	xorl	%ecx, %ecx
+	.loc 1 435 20 view .LVU1958
+	movzwl	52(%rdx), %eax
+	.loc 1 435 8 view .LVU1959
+	cmpw	48(%rdx), %ax
+	jnb	.L242
+	.loc 1 439 5 is_stmt 1 view .LVU1960
+	.loc 1 439 49 is_stmt 0 view .LVU1961
+	leal	1(%rax), %ecx
+	movw	%cx, 52(%rdx)
+	.loc 1 439 53 view .LVU1962
+	movzbl	54(%rdx,%rax), %ecx
+.L242:
+	.loc 1 440 1 view .LVU1963
+	movl	%ecx, %eax
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	read8, .-read8
+	.section	.text.read16,"ax",@progbits
+	.p2align 4
+	.globl	read16
+	.type	read16, @function
+read16:
+.LFB16:
+	.loc 1 443 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 444 5 view .LVU1965
+.LBB1041:
+.LBI1041:
+	.loc 1 432 9 view .LVU1966
+.LBB1042:
+	.loc 1 435 5 view .LVU1967
+	.loc 1 435 20 is_stmt 0 view .LVU1968
+	movq	currentPort(%rip), %rax
+	xorl	%ecx, %ecx
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU1969
+	movzwl	48(%rax), %edi
+	.loc 1 435 8 view .LVU1970
+	cmpw	%di, %dx
+	jnb	.L245
+	.loc 1 439 5 is_stmt 1 view .LVU1971
+	.loc 1 439 49 is_stmt 0 view .LVU1972
+	leal	1(%rdx), %esi
+	.loc 1 439 53 view .LVU1973
+	movzwl	%dx, %ecx
+	.loc 1 439 49 view .LVU1974
+	movw	%si, 52(%rax)
+.LBE1042:
+.LBE1041:
+	.loc 1 444 14 view .LVU1975
+	movzbl	54(%rax,%rcx), %ecx
+.LVL178:
+	.loc 1 445 5 is_stmt 1 view .LVU1976
+.LBB1043:
+.LBI1043:
+	.loc 1 432 9 view .LVU1977
+.LBB1044:
+	.loc 1 435 5 view .LVU1978
+	.loc 1 435 8 is_stmt 0 view .LVU1979
+	cmpw	%di, %si
+	jnb	.L245
+	.loc 1 439 5 is_stmt 1 view .LVU1980
+	.loc 1 439 49 is_stmt 0 view .LVU1981
+	addl	$2, %edx
+	.loc 1 439 53 view .LVU1982
+	movzwl	%si, %esi
+	.loc 1 439 49 view .LVU1983
+	movw	%dx, 52(%rax)
+.LBE1044:
+.LBE1043:
+	.loc 1 445 10 view .LVU1984
+	movzbl	54(%rax,%rsi), %eax
+	.loc 1 445 28 view .LVU1985
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU1986
+	addl	%eax, %ecx
+.LVL179:
+.L245:
+	.loc 1 447 1 view .LVU1987
+	movl	%ecx, %eax
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	read16, .-read16
+	.section	.text.read32,"ax",@progbits
+	.p2align 4
+	.globl	read32
+	.type	read32, @function
+read32:
+.LFB17:
+	.loc 1 450 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 451 5 view .LVU1989
+.LBB1057:
+.LBI1057:
+	.loc 1 442 10 view .LVU1990
+.LBB1058:
+	.loc 1 444 5 view .LVU1991
+.LBB1059:
+.LBI1059:
+	.loc 1 432 9 view .LVU1992
+.LBB1060:
+	.loc 1 435 5 view .LVU1993
+	.loc 1 435 20 is_stmt 0 view .LVU1994
+	movq	currentPort(%rip), %rax
+	xorl	%edx, %edx
+	movzwl	52(%rax), %ecx
+	.loc 1 435 42 view .LVU1995
+	movzwl	48(%rax), %esi
+	.loc 1 435 8 view .LVU1996
+	cmpw	%si, %cx
+	jnb	.L248
+	.loc 1 439 5 is_stmt 1 view .LVU1997
+	.loc 1 439 49 is_stmt 0 view .LVU1998
+	leal	1(%rcx), %r8d
+	.loc 1 439 53 view .LVU1999
+	movzwl	%cx, %edx
+	.loc 1 439 49 view .LVU2000
+	movw	%r8w, 52(%rax)
+	.loc 1 439 53 view .LVU2001
+	movzbl	54(%rax,%rdx), %edx
+.LVL180:
+	.loc 1 439 53 view .LVU2002
+.LBE1060:
+.LBE1059:
+	.loc 1 445 5 is_stmt 1 view .LVU2003
+.LBB1061:
+.LBI1061:
+	.loc 1 432 9 view .LVU2004
+.LBB1062:
+	.loc 1 435 5 view .LVU2005
+	.loc 1 435 8 is_stmt 0 view .LVU2006
+	cmpw	%si, %r8w
+	jnb	.L250
+	.loc 1 439 5 is_stmt 1 view .LVU2007
+	.loc 1 439 49 is_stmt 0 view .LVU2008
+	leal	2(%rcx), %edi
+	.loc 1 439 53 view .LVU2009
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU2010
+	movw	%di, 52(%rax)
+.LVL181:
+	.loc 1 439 49 view .LVU2011
+.LBE1062:
+.LBE1061:
+	.loc 1 446 5 is_stmt 1 view .LVU2012
+	.loc 1 445 10 is_stmt 0 view .LVU2013
+	movzbl	54(%rax,%r8), %r8d
+	.loc 1 445 28 view .LVU2014
+	sall	$8, %r8d
+	.loc 1 445 7 view .LVU2015
+	addl	%r8d, %edx
+.LBE1058:
+.LBE1057:
+	.loc 1 451 14 view .LVU2016
+	movzwl	%dx, %edx
+.LVL182:
+	.loc 1 452 5 is_stmt 1 view .LVU2017
+.LBB1063:
+.LBI1063:
+	.loc 1 442 10 view .LVU2018
+.LBB1064:
+	.loc 1 444 5 view .LVU2019
+.LBB1065:
+.LBI1065:
+	.loc 1 432 9 view .LVU2020
+.LBB1066:
+	.loc 1 435 5 view .LVU2021
+	.loc 1 435 8 is_stmt 0 view .LVU2022
+	cmpw	%si, %di
+	jnb	.L248
+	.loc 1 439 5 is_stmt 1 view .LVU2023
+	.loc 1 439 49 is_stmt 0 view .LVU2024
+	leal	3(%rcx), %r8d
+	.loc 1 439 53 view .LVU2025
+	movzwl	%di, %edi
+	.loc 1 439 49 view .LVU2026
+	movw	%r8w, 52(%rax)
+	.loc 1 439 53 view .LVU2027
+	movzbl	54(%rax,%rdi), %edi
+.LVL183:
+	.loc 1 439 53 view .LVU2028
+.LBE1066:
+.LBE1065:
+	.loc 1 445 5 is_stmt 1 view .LVU2029
+.LBB1067:
+.LBI1067:
+	.loc 1 432 9 view .LVU2030
+.LBB1068:
+	.loc 1 435 5 view .LVU2031
+	.loc 1 435 8 is_stmt 0 view .LVU2032
+	cmpw	%si, %r8w
+	jnb	.L255
+	.loc 1 439 5 is_stmt 1 view .LVU2033
+	.loc 1 439 49 is_stmt 0 view .LVU2034
+	addl	$4, %ecx
+	.loc 1 439 53 view .LVU2035
+	movzwl	%r8w, %r8d
+	.loc 1 439 49 view .LVU2036
+	movw	%cx, 52(%rax)
+.LBE1068:
+.LBE1067:
+	.loc 1 445 10 view .LVU2037
+	movzbl	54(%rax,%r8), %eax
+	.loc 1 445 28 view .LVU2038
+	sall	$8, %eax
+	.loc 1 445 7 view .LVU2039
+	addl	%edi, %eax
+.LBE1064:
+.LBE1063:
+	.loc 1 452 29 view .LVU2040
+	sall	$16, %eax
+	.loc 1 452 7 view .LVU2041
+	addl	%eax, %edx
+.LVL184:
+.LBB1070:
+.LBB1069:
+	.loc 1 446 5 is_stmt 1 view .LVU2042
+	.loc 1 446 5 is_stmt 0 view .LVU2043
+.LBE1069:
+.LBE1070:
+	.loc 1 453 5 is_stmt 1 view .LVU2044
+.L248:
+	.loc 1 454 1 is_stmt 0 view .LVU2045
+	movl	%edx, %eax
+	ret
+.LVL185:
+.L250:
+	.loc 1 451 14 view .LVU2046
+	movzbl	%dl, %edx
+.LVL186:
+	.loc 1 451 14 view .LVU2047
+	jmp	.L248
+.LVL187:
+.L255:
+	.loc 1 452 10 view .LVU2048
+	movzbl	%dil, %eax
+	.loc 1 452 29 view .LVU2049
+	sall	$16, %eax
+	.loc 1 452 7 view .LVU2050
+	addl	%eax, %edx
+.LVL188:
+	.loc 1 452 7 view .LVU2051
+	jmp	.L248
+	.cfi_endproc
+.LFE17:
+	.size	read32, .-read32
+	.section	.text.headSerialResponse,"ax",@progbits
+	.p2align 4
+	.globl	headSerialResponse
+	.type	headSerialResponse, @function
+headSerialResponse:
+.LVL189:
+.LFB18:
+	.loc 1 457 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 458 5 view .LVU2053
+	.loc 1 457 1 is_stmt 0 view .LVU2054
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 458 20 view .LVU2055
+	movq	currentPort(%rip), %rax
+	movl	336(%rax), %edx
+	.loc 1 458 8 view .LVU2056
+	cmpl	$1, %edx
+	je	.L274
+	movl	%edi, %r12d
+	.loc 1 463 5 is_stmt 1 view .LVU2057
+.LBB1083:
+.LBB1084:
+	.loc 1 422 5 is_stmt 0 view .LVU2058
+	movzbl	%sil, %r13d
+.LBE1084:
+.LBE1083:
+	.loc 1 463 8 view .LVU2059
+	cmpl	$2, %edx
+	je	.L275
+.LVL190:
+.LBB1085:
+.LBI1085:
+	.loc 1 456 6 is_stmt 1 view .LVU2060
+.LBB1086:
+	.loc 1 471 5 view .LVU2061
+.LBB1087:
+.LBI1087:
+	.loc 1 387 13 view .LVU2062
+.LBB1088:
+	.loc 1 389 5 view .LVU2063
+	.loc 1 389 8 is_stmt 0 view .LVU2064
+	cmpq	$0, 320(%rax)
+	je	.L260
+	.loc 1 390 9 is_stmt 1 view .LVU2065
+	movzwl	330(%rax), %esi
+.LVL191:
+	.loc 1 390 9 is_stmt 0 view .LVU2066
+	movq	mspSerialPort(%rip), %rdi
+.LVL192:
+	.loc 1 390 9 view .LVU2067
+	call	serialTxCommit@PLT
+.LVL193:
+	.loc 1 391 9 is_stmt 1 view .LVU2068
+	.loc 1 391 20 is_stmt 0 view .LVU2069
+	movq	currentPort(%rip), %rax
+	.loc 1 391 33 view .LVU2070
+	movq	$0, 320(%rax)
+.L260:
+.LBE1088:
+.LBE1087:
+	.loc 1 473 5 is_stmt 1 view .LVU2071
+	.loc 1 473 67 is_stmt 0 view .LVU2072
+	cmpl	$1, 312(%rax)
+	.loc 1 476 33 view .LVU2073
+	movq	mspSerialPort(%rip), %rdi
+	.loc 1 473 67 view .LVU2074
+	sbbl	%eax, %eax
+	andl	$-3, %eax
+	.loc 1 473 14 view .LVU2075
+	leal	9(%rax,%rbx), %ebp
+.LVL194:
+	.loc 1 476 5 is_stmt 1 view .LVU2076
+	.loc 1 476 33 is_stmt 0 view .LVU2077
+	call	serialTxBytesFree@PLT
+.LVL195:
+	.loc 1 476 16 view .LVU2078
+	movq	currentPort(%rip), %rdx
+	.loc 1 476 66 view .LVU2079
+	movzwl	%bp, %esi
+	.loc 1 476 33 view .LVU2080
+	movl	%eax, %ecx
+	.loc 1 479 63 view .LVU2081
+	xorl	%eax, %eax
+	.loc 1 476 66 view .LVU2082
+	cmpl	%esi, %ecx
+	.loc 1 476 31 view .LVU2083
+	setb	332(%rdx)
+	.loc 1 479 5 is_stmt 1 view .LVU2084
+	.loc 1 479 63 is_stmt 0 view .LVU2085
+	jnb	.L276
+.L262:
+	.loc 1 479 29 view .LVU2086
+	movq	%rax, 320(%rdx)
+	.loc 1 480 5 is_stmt 1 view .LVU2087
+	.loc 1 481 35 is_stmt 0 view .LVU2088
+	xorl	%eax, %eax
+	.loc 1 483 5 view .LVU2089
+	movl	$36, %edi
+	.loc 1 481 35 view .LVU2090
+	movw	%ax, 330(%rdx)
+	.loc 1 480 33 view .LVU2091
+	movw	%bp, 328(%rdx)
+	.loc 1 481 5 is_stmt 1 view .LVU2092
+	.loc 1 483 5 view .LVU2093
+	call	serialize8
+.LVL196:
+	.loc 1 484 5 view .LVU2094
+	.loc 1 484 27 is_stmt 0 view .LVU2095
+	movq	currentPort(%rip), %rax
+	.loc 1 484 5 view .LVU2096
+	cmpl	$1, 312(%rax)
+	sbbl	%edi, %edi
+	andl	$-11, %edi
+	addl	$88, %edi
+	call	serialize8
+.LVL197:
+	.loc 1 485 5 is_stmt 1 view .LVU2097
+	cmpb	$1, %r12b
+	sbbl	%edi, %edi
+	andl	$29, %edi
+	addl	$33, %edi
+	call	serialize8
+.LVL198:
+	.loc 1 486 5 view .LVU2098
+	.loc 1 486 16 is_stmt 0 view .LVU2099
+	movq	currentPort(%rip), %rax
+	.loc 1 487 8 view .LVU2100
+	movl	312(%rax), %edx
+	.loc 1 486 27 view .LVU2101
+	movb	$0, 50(%rax)
+	.loc 1 487 5 is_stmt 1 view .LVU2102
+	.loc 1 487 8 is_stmt 0 view .LVU2103
+	testl	%edx, %edx
+	je	.L277
+	.loc 1 491 9 is_stmt 1 view .LVU2104
+	xorl	%edi, %edi
+	call	serialize8
+.LVL199:
+	.loc 1 492 9 view .LVU2105
+	.loc 1 492 32 is_stmt 0 view .LVU2106
+	movq	currentPort(%rip), %rax
+	movzwl	310(%rax), %ebp
+.LVL200:
+.LBB1089:
+.LBI1089:
+	.loc 1 420 6 is_stmt 1 view .LVU2107
+.LBB1090:
+	.loc 1 422 5 view .LVU2108
+	movzbl	%bpl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2109
+	sarw	$8, %bp
+.LVL201:
+	.loc 1 422 5 view .LVU2110
+	call	serialize8
+.LVL202:
+	.loc 1 423 5 is_stmt 1 view .LVU2111
+	movzbl	%bpl, %edi
+.LVL203:
+.L272:
+	.loc 1 423 5 is_stmt 0 view .LVU2112
+	call	serialize8
+.LVL204:
+.LBE1090:
+.LBE1089:
+	.loc 1 493 9 is_stmt 1 view .LVU2113
+.LBB1091:
+.LBI1091:
+	.loc 1 420 6 view .LVU2114
+.LBB1092:
+	.loc 1 422 5 view .LVU2115
+	movl	%r13d, %edi
+	call	serialize8
+.LVL205:
+	.loc 1 423 5 view .LVU2116
+.LBE1092:
+.LBE1091:
+.LBE1086:
+.LBE1085:
+	.loc 1 495 1 is_stmt 0 view .LVU2117
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+.LBB1102:
+.LBB1099:
+.LBB1096:
+.LBB1093:
+	.loc 1 423 5 view .LVU2118
+	movzbl	%bh, %edi
+.LBE1093:
+.LBE1096:
+.LBE1099:
+.LBE1102:
+	.loc 1 495 1 view .LVU2119
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL206:
+	.loc 1 495 1 view .LVU2120
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB1103:
+.LBB1100:
+.LBB1097:
+.LBB1094:
+	.loc 1 423 5 view .LVU2121
+	jmp	serialize8
+.LVL207:
+	.p2align 4,,10
+	.p2align 3
+.L277:
+	.cfi_restore_state
+	.loc 1 423 5 view .LVU2122
+.LBE1094:
+.LBE1097:
+	.loc 1 488 9 is_stmt 1 view .LVU2123
+	movl	%r13d, %edi
+	call	serialize8
+.LVL208:
+	.loc 1 489 9 view .LVU2124
+	movq	currentPort(%rip), %rax
+	movzbl	310(%rax), %edi
+.LBE1100:
+.LBE1103:
+	.loc 1 495 1 is_stmt 0 view .LVU2125
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL209:
+	.loc 1 495 1 view .LVU2126
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL210:
+	.loc 1 495 1 view .LVU2127
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL211:
+	.loc 1 495 1 view .LVU2128
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB1104:
+.LBB1101:
+.LBB1098:
+.LBB1095:
+	.loc 1 423 5 view .LVU2129
+	jmp	serialize8
+.LVL212:
+	.p2align 4,,10
+	.p2align 3
+.L276:
+	.cfi_restore_state
+	.loc 1 423 5 view .LVU2130
+.LBE1095:
+.LBE1098:
+	.loc 1 479 65 view .LVU2131
+	movq	mspSerialPort(%rip), %rdi
+	call	serialTxReserve@PLT
+.LVL213:
+	.loc 1 479 16 view .LVU2132
+	movq	currentPort(%rip), %rdx
+	jmp	.L262
+.LVL214:
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	.loc 1 479 16 view .LVU2133
+.LBE1101:
+.LBE1104:
+	.loc 1 459 9 is_stmt 1 view .LVU2134
+	.loc 1 459 32 is_stmt 0 view .LVU2135
+	movl	340(%rax), %edx
+	movzwl	%si, %ebx
+	leal	5(%rdx,%rbx), %edx
+	movl	%edx, 340(%rax)
+	.loc 1 460 9 is_stmt 1 view .LVU2136
+	.loc 1 495 1 is_stmt 0 view .LVU2137
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L275:
+	.cfi_restore_state
+	.loc 1 464 9 is_stmt 1 view .LVU2138
+	.loc 1 464 32 is_stmt 0 view .LVU2139
+	movzwl	310(%rax), %ebp
+.LVL215:
+.LBB1105:
+.LBI1105:
+	.loc 1 420 6 is_stmt 1 view .LVU2140
+.LBB1106:
+	.loc 1 422 5 view .LVU2141
+	movzbl	%bpl, %edi
+.LVL216:
+	.loc 1 423 5 is_stmt 0 view .LVU2142
+	sarw	$8, %bp
+.LVL217:
+	.loc 1 422 5 view .LVU2143
+	call	serialize8
+.LVL218:
+	.loc 1 423 5 is_stmt 1 view .LVU2144
+	movzbl	%bpl, %edi
+	call	serialize8
+.LVL219:
+	.loc 1 423 5 is_stmt 0 view .LVU2145
+.LBE1106:
+.LBE1105:
+	.loc 1 465 9 is_stmt 1 view .LVU2146
+	movzbl	%r12b, %edi
+	jmp	.L272
+	.cfi_endproc
+.LFE18:
+	.size	headSerialResponse, .-headSerialResponse
+	.section	.text.mspConfigDump,"ax",@progbits
+	.p2align 4
+	.type	mspConfigDump, @function
+mspConfigDump:
+.LFB86:
+	.loc 1 1633 1 view -0
+	.cfi_startproc
+	.loc 1 1634 5 view .LVU2148
+	.loc 1 1635 5 view .LVU2149
+	.loc 1 1636 5 view .LVU2150
+.LBB1117:
+.LBI1117:
+	.loc 1 442 10 view .LVU2151
+.LBB1118:
+	.loc 1 444 5 view .LVU2152
+.LBB1119:
+.LBI1119:
+	.loc 1 432 9 view .LVU2153
+.LBB1120:
+	.loc 1 435 5 view .LVU2154
+.LBE1120:
+.LBE1119:
+.LBE1118:
+.LBE1117:
+	.loc 1 1633 1 is_stmt 0 view .LVU2155
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+.LBB1129:
+.LBB1127:
+.LBB1123:
+.LBB1121:
+	xorl	%ebp, %ebp
+.LBE1121:
+.LBE1123:
+.LBE1127:
+.LBE1129:
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+.LBB1130:
+.LBB1128:
+.LBB1124:
+.LBB1122:
+	.loc 1 435 20 view .LVU2156
+	movq	currentPort(%rip), %rax
+	movzwl	52(%rax), %edx
+	.loc 1 435 42 view .LVU2157
+	movzwl	48(%rax), %esi
+	.loc 1 435 8 view .LVU2158
+	cmpw	%si, %dx
+	jnb	.L279
+	.loc 1 439 5 is_stmt 1 view .LVU2159
+	.loc 1 439 49 is_stmt 0 view .LVU2160
+	leal	1(%rdx), %ecx
+	.loc 1 439 53 view .LVU2161
+	movzwl	%dx, %edi
+	.loc 1 439 49 view .LVU2162
+	movw	%cx, 52(%rax)
+.LBE1122:
+.LBE1124:
+	.loc 1 444 14 view .LVU2163
+	movzbl	54(%rax,%rdi), %ebp
+.LVL220:
+	.loc 1 445 5 is_stmt 1 view .LVU2164
+.LBB1125:
+.LBI1125:
+	.loc 1 432 9 view .LVU2165
+.LBB1126:
+	.loc 1 435 5 view .LVU2166
+	.loc 1 435 8 is_stmt 0 view .LVU2167
+	cmpw	%si, %cx
+	jnb	.L279
+	.loc 1 439 5 is_stmt 1 view .LVU2168
+	.loc 1 439 49 is_stmt 0 view .LVU2169
+	addl	$2, %edx
+	.loc 1 439 53 view .LVU2170
+	movzwl	%cx, %ecx
+	.loc 1 439 49 view .LVU2171
+	movw	%dx, 52(%rax)
+.LBE1126:
+.LBE1125:
+	.loc 1 445 10 view .LVU2172
+	movzbl	54(%rax,%rcx), %eax
+	.loc 1 445 28 view .LVU2173
+	sall	$8, %eax
+.LVL221:
+	.loc 1 445 7 view .LVU2174
+	addl	%eax, %ebp
+.LVL222:
+.L279:
+	.loc 1 446 5 is_stmt 1 view .LVU2175
+	.loc 1 446 5 is_stmt 0 view .LVU2176
+.LBE1128:
+.LBE1130:
+	.loc 1 1637 5 is_stmt 1 view .LVU2177
+	.loc 1 1638 5 view .LVU2178
+	.loc 1 1639 5 view .LVU2179
+	.loc 1 1640 5 view .LVU2180
+	.loc 1 1641 5 view .LVU2181
+	.loc 1 1641 26 is_stmt 0 view .LVU2182
+	movq	mspSerialPort(%rip), %rdi
+	.loc 1 1654 14 view .LVU2183
+	leaq	masterConfig(%rip), %r15
+	.loc 1 1641 26 view .LVU2184
+	call	serialTxBytesFree@PLT
+.LVL223:
+	movl	%eax, %r14d
+.LVL224:
+	.loc 1 1642 5 is_stmt 1 view .LVU2185
+	.loc 1 1644 5 view .LVU2186
+	.loc 1 1644 23 is_stmt 0 view .LVU2187
+	call	configDumpIndexCount@PLT
+.LVL225:
+	.loc 1 1645 20 view .LVU2188
+	cmpw	%ax, %bp
+	movl	$0, %eax
+	cmovnb	%eax, %ebp
+	.loc 1 1648 5 is_stmt 1 view .LVU2189
+	.loc 1 1649 31 is_stmt 0 view .LVU2190
+	movl	$12, %eax
+	cmpl	%eax, %r14d
+	cmovb	%eax, %r14d
+.LVL226:
+	.loc 1 1650 5 is_stmt 1 view .LVU2191
+	.loc 1 1650 52 is_stmt 0 view .LVU2192
+	movl	$240, %eax
+	.loc 1 1653 5 view .LVU2193
+	movl	%ebp, %ebx
+	.loc 1 1648 15 view .LVU2194
+	subl	$12, %r14d
+.LVL227:
+	.loc 1 1650 52 view .LVU2195
+	cmpl	%eax, %r14d
+	cmova	%eax, %r14d
+.LVL228:
+	.loc 1 1653 5 is_stmt 1 view .LVU2196
+	.loc 1 1638 14 is_stmt 0 view .LVU2197
+	xorl	%r13d, %r13d
+	.loc 1 1653 5 view .LVU2198
+	jmp	.L281
+.LVL229:
+	.p2align 4,,10
+	.p2align 3
+.L286:
+	.loc 1 1654 9 is_stmt 1 view .LVU2199
+	.loc 1 1654 14 is_stmt 0 view .LVU2200
+	leaq	16(%rsp), %r12
+	movzwl	%bx, %esi
+	movq	%r15, %rdi
+	movq	%r12, %rdx
+	call	configDumpGetRecord@PLT
+.LVL230:
+	.loc 1 1654 12 view .LVU2201
+	testb	%al, %al
+	je	.L282
+	.loc 1 1657 9 is_stmt 1 view .LVU2202
+	.loc 1 1657 24 is_stmt 0 view .LVU2203
+	movzbl	19(%rsp), %edi
+	call	configDumpValueSize@PLT
+.LVL231:
+	.loc 1 1657 18 view .LVU2204
+	movzwl	%r13w, %edx
+	.loc 1 1657 24 view .LVU2205
+	movzbl	%al, %eax
+	.loc 1 1657 22 view .LVU2206
+	leal	4(%rdx,%rax), %eax
+	.loc 1 1657 12 view .LVU2207
+	cmpl	%r14d, %eax
+	jg	.L287
+	.loc 1 1660 9 is_stmt 1 view .LVU2208
+	.loc 1 1660 21 is_stmt 0 view .LVU2209
+	movzbl	19(%rsp), %edi
+	call	configDumpValueSize@PLT
+.LVL232:
+	movzbl	%al, %eax
+	.loc 1 1660 14 view .LVU2210
+	leal	4(%r13,%rax), %r13d
+.LVL233:
+.L282:
+	.loc 1 1653 76 is_stmt 1 discriminator 2 view .LVU2211
+	addl	$1, %ebx
+.LVL234:
+.L281:
+	.loc 1 1653 42 discriminator 1 view .LVU2212
+	.loc 1 1653 44 is_stmt 0 discriminator 1 view .LVU2213
+	call	configDumpIndexCount@PLT
+.LVL235:
+	.loc 1 1653 42 discriminator 1 view .LVU2214
+	cmpw	%ax, %bx
+	jb	.L286
+.L287:
+	.loc 1 1663 5 is_stmt 1 view .LVU2215
+	.loc 1 1663 8 is_stmt 0 view .LVU2216
+	cmpw	%bx, %bp
+	je	.L315
+	.loc 1 1667 5 is_stmt 1 view .LVU2217
+.LVL236:
+.LBB1131:
+.LBI1131:
+	.loc 1 497 6 view .LVU2218
+.LBB1132:
+	.loc 1 499 5 view .LVU2219
+.LBE1132:
+.LBE1131:
+	.loc 1 1667 23 is_stmt 0 view .LVU2220
+	leal	3(%r13), %esi
+.LBB1138:
+.LBB1133:
+	.loc 1 499 5 view .LVU2221
+	xorl	%edi, %edi
+.LBE1133:
+.LBE1138:
+	.loc 1 1667 5 view .LVU2222
+	movzwl	%si, %esi
+.LBB1139:
+.LBB1134:
+	.loc 1 499 5 view .LVU2223
+	call	headSerialResponse
+.LVL237:
+	.loc 1 499 5 view .LVU2224
+.LBE1134:
+.LBE1139:
+	.loc 1 1668 5 is_stmt 1 view .LVU2225
+	movl	$1, %edi
+	call	serialize8
+.LVL238:
+	.loc 1 1669 5 view .LVU2226
+	.loc 1 1669 28 is_stmt 0 view .LVU2227
+	call	configDumpIndexCount@PLT
+.LVL239:
+	.loc 1 1669 5 view .LVU2228
+	cmpw	%ax, %bx
+	jb	.L298
+	xorl	%edi, %edi
+	xorl	%r12d, %r12d
+.L290:
+.LBB1140:
+.LBI1140:
+	.loc 1 420 6 is_stmt 1 discriminator 4 view .LVU2229
+.LBB1141:
+	.loc 1 422 5 discriminator 4 view .LVU2230
+	call	serialize8
+.LVL240:
+	.loc 1 423 5 discriminator 4 view .LVU2231
+	movl	%r12d, %edi
+	call	serialize8
+.LVL241:
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU2232
+.LBE1141:
+.LBE1140:
+	.loc 1 1670 36 is_stmt 1 discriminator 4 view .LVU2233
+	cmpw	%bx, %bp
+	jnb	.L292
+	.loc 1 1674 16 is_stmt 0 view .LVU2234
+	leaq	24(%rsp), %rax
+	movzwl	%bp, %ebp
+	leaq	16(%rsp), %r12
+	movq	%rax, 8(%rsp)
+	leaq	masterConfig(%rip), %r14
+.LVL242:
+	.loc 1 1674 16 view .LVU2235
+	jmp	.L294
+.LVL243:
+	.p2align 4,,10
+	.p2align 3
+.L296:
+	.loc 1 1670 53 is_stmt 1 view .LVU2236
+	.loc 1 1670 36 view .LVU2237
+	addl	$1, %ebp
+.LVL244:
+	.loc 1 1670 36 is_stmt 0 view .LVU2238
+	cmpw	%bx, %bp
+	jnb	.L292
+.LVL245:
+.L294:
+	.loc 1 1671 9 is_stmt 1 view .LVU2239
+	.loc 1 1671 14 is_stmt 0 view .LVU2240
+	movq	%r12, %rdx
+	movl	%ebp, %esi
+	movq	%r14, %rdi
+	call	configDumpGetRecord@PLT
+.LVL246:
+	.loc 1 1671 12 view .LVU2241
+	testb	%al, %al
+	je	.L296
+	.loc 1 1674 9 is_stmt 1 view .LVU2242
+	.loc 1 1674 16 is_stmt 0 view .LVU2243
+	movq	8(%rsp), %r15
+	movq	%r12, %rsi
+	movq	%r15, %rdi
+	call	configDumpEncodeRecord@PLT
+.LVL247:
+	.loc 1 1675 9 is_stmt 1 view .LVU2244
+	.loc 1 1675 23 view .LVU2245
+	testb	%al, %al
+	je	.L296
+	movzbl	%al, %eax
+	.loc 1 1675 23 is_stmt 0 view .LVU2246
+	leaq	(%r15,%rax), %r13
+.LVL248:
+	.p2align 4,,10
+	.p2align 3
+.L297:
+	.loc 1 1676 13 is_stmt 1 discriminator 3 view .LVU2247
+	movzbl	(%r15), %edi
+	.loc 1 1675 23 is_stmt 0 discriminator 3 view .LVU2248
+	addq	$1, %r15
+.LVL249:
+	.loc 1 1676 13 discriminator 3 view .LVU2249
+	call	serialize8
+.LVL250:
+	.loc 1 1675 32 is_stmt 1 discriminator 3 view .LVU2250
+	.loc 1 1675 23 discriminator 3 view .LVU2251
+	cmpq	%r15, %r13
+	jne	.L297
+	jmp	.L296
+.LVL251:
+	.p2align 4,,10
+	.p2align 3
+.L315:
+	.loc 1 1663 48 is_stmt 0 discriminator 1 view .LVU2252
+	call	configDumpIndexCount@PLT
+.LVL252:
+	movl	%eax, %edx
+	.loc 1 1664 15 discriminator 1 view .LVU2253
+	xorl	%eax, %eax
+	.loc 1 1663 32 discriminator 1 view .LVU2254
+	cmpw	%dx, %bp
+	jb	.L278
+	.loc 1 1667 5 is_stmt 1 view .LVU2255
+.LVL253:
+.LBB1144:
+	.loc 1 497 6 view .LVU2256
+.LBB1135:
+	.loc 1 499 5 view .LVU2257
+.LBE1135:
+.LBE1144:
+	.loc 1 1667 23 is_stmt 0 view .LVU2258
+	leal	3(%r13), %esi
+.LBB1145:
+.LBB1136:
+	.loc 1 499 5 view .LVU2259
+	xorl	%edi, %edi
+.LBE1136:
+.LBE1145:
+	.loc 1 1667 5 view .LVU2260
+	movzwl	%si, %esi
+.LBB1146:
+.LBB1137:
+	.loc 1 499 5 view .LVU2261
+	call	headSerialResponse
+.LVL254:
+	.loc 1 499 5 view .LVU2262
+.LBE1137:
+.LBE1146:
+	.loc 1 1668 5 is_stmt 1 view .LVU2263
+	movl	$1, %edi
+	call	serialize8
+.LVL255:
+	.loc 1 1669 5 view .LVU2264
+	.loc 1 1669 28 is_stmt 0 view .LVU2265
+	call	configDumpIndexCount@PLT
+.LVL256:
+	.loc 1 1669 5 view .LVU2266
+	cmpw	%ax, %bp
+	jnb	.L316
+.L298:
+.LBB1147:
+.LBB1142:
+	.loc 1 423 5 view .LVU2267
+	movl	%ebx, %r12d
+	movzbl	%bl, %edi
+	sarw	$8, %r12w
+	movzbl	%r12b, %r12d
+.LBE1142:
+.LBE1147:
+	jmp	.L290
+.L316:
+.LVL257:
+.LBB1148:
+	.loc 1 420 6 is_stmt 1 view .LVU2268
+.LBB1143:
+	.loc 1 422 5 view .LVU2269
+	xorl	%edi, %edi
+	call	serialize8
+.LVL258:
+	.loc 1 423 5 view .LVU2270
+	xorl	%edi, %edi
+	call	serialize8
+.LVL259:
+	.loc 1 423 5 is_stmt 0 view .LVU2271
+.LBE1143:
+.LBE1148:
+	.loc 1 1670 36 is_stmt 1 view .LVU2272
+	.p2align 4,,10
+	.p2align 3
+.L292:
+	.loc 1 1679 11 is_stmt 0 view .LVU2273
+	movl	$1, %eax
+.L278:
+	.loc 1 1680 1 view .LVU2274
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL260:
+	.loc 1 1680 1 view .LVU2275
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE86:
+	.size	mspConfigDump, .-mspConfigDump
+	.section	.text.processCommand,"ax",@progbits
+	.p2align 4
+	.type	processCommand, @function
+processCommand:
+.LVL261:
+.LFB89:
+	.loc 1 1834 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1835 4 view .LVU2277
+	.loc 1 1837 5 view .LVU2278
+	.loc 1 1837 8 is_stmt 0 view .LVU2279
+	movq	currentPort(%rip), %rax
+	.loc 1 1834 1 view .LVU2280
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	.loc 1 1838 15 view .LVU2281
+	xorl	%ebp, %ebp
+	.loc 1 1834 1 view .LVU2282
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 1837 8 view .LVU2283
+	movzwl	4(%rdi), %esi
+	cmpw	%si, 48(%rax)
+	jb	.L317
+	movq	%rdi, %rbx
+	.loc 1 1841 5 is_stmt 1 view .LVU2284
+	.loc 1 1841 8 is_stmt 0 view .LVU2285
+	testb	$1, 6(%rdi)
+	je	.L319
+	.loc 1 1841 37 discriminator 1 view .LVU2286
+	testb	$4, armingFlags(%rip)
+	jne	.L317
+.L319:
+.LVL262:
+.LBB1154:
+.LBI1154:
+	.loc 1 1833 12 is_stmt 1 view .LVU2287
+.LBB1155:
+	.loc 1 1846 5 view .LVU2288
+	.loc 1 1846 26 is_stmt 0 view .LVU2289
+	call	micros@PLT
+.LVL263:
+	.loc 1 1846 26 view .LVU2290
+	movl	%eax, %r12d
+.LVL264:
+	.loc 1 1849 5 is_stmt 1 view .LVU2291
+	.loc 1 1849 14 is_stmt 0 view .LVU2292
+	call	*8(%rbx)
+.LVL265:
+	.loc 1 1849 14 view .LVU2293
+	movl	%eax, %ebp
+.LVL266:
+	.loc 1 1850 5 is_stmt 1 view .LVU2294
+	.loc 1 1850 8 is_stmt 0 view .LVU2295
+	testb	%al, %al
+	je	.L320
+	.loc 1 1850 16 view .LVU2296
+	cmpb	$1, 2(%rbx)
+	je	.L331
+.LVL267:
+.L320:
+	.loc 1 1856 5 is_stmt 1 view .LVU2297
+	.loc 1 1856 20 is_stmt 0 view .LVU2298
+	movq	currentPort(%rip), %rax
+	.loc 1 1856 8 view .LVU2299
+	cmpl	$1, 336(%rax)
+	jne	.L332
+.LVL268:
+.L317:
+	.loc 1 1856 8 view .LVU2300
+.LBE1155:
+.LBE1154:
+	.loc 1 1869 1 view .LVU2301
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL269:
+	.p2align 4,,10
+	.p2align 3
+.L332:
+	.cfi_restore_state
+.LBB1161:
+.LBB1159:
+.LBB1156:
+	.loc 1 1857 9 is_stmt 1 view .LVU2302
+	.loc 1 1857 61 is_stmt 0 view .LVU2303
+	leaq	mspCommands(%rip), %rax
+	subq	%rax, %rbx
+.LVL270:
+	.loc 1 1858 29 view .LVU2304
+	call	micros@PLT
+.LVL271:
+	.loc 1 1857 61 view .LVU2305
+	sarq	$4, %rbx
+.LVL272:
+	.loc 1 1858 9 is_stmt 1 view .LVU2306
+	.loc 1 1860 21 is_stmt 0 view .LVU2307
+	leaq	mspCommandStats(%rip), %rdx
+	leaq	(%rbx,%rbx,2), %rcx
+	.loc 1 1858 18 view .LVU2308
+	subl	%r12d, %eax
+.LVL273:
+	.loc 1 1860 9 is_stmt 1 view .LVU2309
+	.loc 1 1860 21 is_stmt 0 view .LVU2310
+	leaq	(%rdx,%rcx,4), %rdx
+	addl	$1, (%rdx)
+	.loc 1 1861 9 is_stmt 1 view .LVU2311
+	.loc 1 1861 28 is_stmt 0 view .LVU2312
+	addl	%eax, 4(%rdx)
+	.loc 1 1862 9 is_stmt 1 view .LVU2313
+	.loc 1 1862 12 is_stmt 0 view .LVU2314
+	cmpl	%eax, 8(%rdx)
+	jnb	.L317
+	.loc 1 1863 13 is_stmt 1 view .LVU2315
+	.loc 1 1863 30 is_stmt 0 view .LVU2316
+	movl	%eax, 8(%rdx)
+.LBE1156:
+.LBE1159:
+.LBE1161:
+	.loc 1 1869 1 view .LVU2317
+	movl	%ebp, %eax
+.LVL274:
+	.loc 1 1869 1 view .LVU2318
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL275:
+	.loc 1 1869 1 view .LVU2319
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL276:
+	.loc 1 1869 1 view .LVU2320
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL277:
+	.loc 1 1869 1 view .LVU2321
+	ret
+.LVL278:
+	.p2align 4,,10
+	.p2align 3
+.L331:
+	.cfi_restore_state
+.LBB1162:
+.LBB1160:
+	.loc 1 1851 9 is_stmt 1 view .LVU2322
+.LBB1157:
+.LBI1157:
+	.loc 1 497 6 view .LVU2323
+.LBB1158:
+	.loc 1 499 5 view .LVU2324
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL279:
+	.loc 1 500 1 is_stmt 0 view .LVU2325
+	jmp	.L320
+.LBE1158:
+.LBE1157:
+.LBE1160:
+.LBE1162:
+	.cfi_endproc
+.LFE89:
+	.size	processCommand, .-processCommand
+	.section	.text.mspDebug,"ax",@progbits
+	.p2align 4
+	.type	mspDebug, @function
+mspDebug:
+.LFB50:
+	.loc 1 1093 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1094 5 view .LVU2327
+	.loc 1 1096 5 view .LVU2328
+.LVL280:
+.LBB1167:
+.LBI1167:
+	.loc 1 497 6 view .LVU2329
+.LBB1168:
+	.loc 1 499 5 view .LVU2330
+.LBE1168:
+.LBE1167:
+	.loc 1 1093 1 is_stmt 0 view .LVU2331
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB1171:
+.LBB1169:
+	.loc 1 499 5 view .LVU2332
+	movl	$8, %esi
+	xorl	%edi, %edi
+.LBE1169:
+.LBE1171:
+	.loc 1 1093 1 view .LVU2333
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	debug(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	leaq	8(%rbp), %r12
+.LBB1172:
+.LBB1170:
+	.loc 1 499 5 view .LVU2334
+	call	headSerialResponse
+.LVL281:
+	.loc 1 499 5 view .LVU2335
+.LBE1170:
+.LBE1172:
+	.loc 1 1099 5 is_stmt 1 view .LVU2336
+	.loc 1 1099 19 view .LVU2337
+.L334:
+	.loc 1 1100 9 discriminator 3 view .LVU2338
+	.loc 1 1100 26 is_stmt 0 discriminator 3 view .LVU2339
+	movzwl	0(%rbp), %ebx
+.LVL282:
+.LBB1173:
+.LBI1173:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2340
+.LBB1174:
+	.loc 1 422 5 discriminator 3 view .LVU2341
+.LBE1174:
+.LBE1173:
+	.loc 1 1099 19 is_stmt 0 discriminator 3 view .LVU2342
+	addq	$2, %rbp
+.LVL283:
+.LBB1176:
+.LBB1175:
+	.loc 1 422 5 discriminator 3 view .LVU2343
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU2344
+	sarw	$8, %bx
+.LVL284:
+	.loc 1 422 5 discriminator 3 view .LVU2345
+	call	serialize8
+.LVL285:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2346
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL286:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2347
+.LBE1175:
+.LBE1176:
+	.loc 1 1099 25 is_stmt 1 discriminator 3 view .LVU2348
+	.loc 1 1099 19 discriminator 3 view .LVU2349
+	cmpq	%rbp, %r12
+	jne	.L334
+	.loc 1 1101 5 view .LVU2350
+	.loc 1 1102 1 is_stmt 0 view .LVU2351
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE50:
+	.size	mspDebug, .-mspDebug
+	.section	.text.mspAccTrim,"ax",@progbits
+	.p2align 4
+	.type	mspAccTrim, @function
+mspAccTrim:
+.LFB52:
+	.loc 1 1134 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1135 5 view .LVU2353
+.LVL287:
+.LBB1183:
+.LBI1183:
+	.loc 1 497 6 view .LVU2354
+.LBB1184:
+	.loc 1 499 5 view .LVU2355
+.LBE1184:
+.LBE1183:
+	.loc 1 1134 1 is_stmt 0 view .LVU2356
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1186:
+.LBB1185:
+	.loc 1 499 5 view .LVU2357
+	movl	$4, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL288:
+	.loc 1 499 5 view .LVU2358
+.LBE1185:
+.LBE1186:
+	.loc 1 1136 5 is_stmt 1 view .LVU2359
+	.loc 1 1136 58 is_stmt 0 view .LVU2360
+	movq	currentProfile(%rip), %rax
+	movzwl	98(%rax), %ebx
+.LVL289:
+.LBB1187:
+.LBI1187:
+	.loc 1 420 6 is_stmt 1 view .LVU2361
+.LBB1188:
+	.loc 1 422 5 view .LVU2362
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2363
+	sarw	$8, %bx
+.LVL290:
+	.loc 1 422 5 view .LVU2364
+	call	serialize8
+.LVL291:
+	.loc 1 423 5 is_stmt 1 view .LVU2365
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL292:
+	.loc 1 423 5 is_stmt 0 view .LVU2366
+.LBE1188:
+.LBE1187:
+	.loc 1 1137 5 is_stmt 1 view .LVU2367
+	.loc 1 1137 58 is_stmt 0 view .LVU2368
+	movq	currentProfile(%rip), %rax
+	movzwl	96(%rax), %ebx
+.LVL293:
+.LBB1189:
+.LBI1189:
+	.loc 1 420 6 is_stmt 1 view .LVU2369
+.LBB1190:
+	.loc 1 422 5 view .LVU2370
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2371
+	sarw	$8, %bx
+.LVL294:
+	.loc 1 422 5 view .LVU2372
+	call	serialize8
+.LVL295:
+	.loc 1 423 5 is_stmt 1 view .LVU2373
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL296:
+	.loc 1 423 5 is_stmt 0 view .LVU2374
+.LBE1190:
+.LBE1189:
+	.loc 1 1138 5 is_stmt 1 view .LVU2375
+	.loc 1 1139 1 is_stmt 0 view .LVU2376
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE52:
+	.size	mspAccTrim, .-mspAccTrim
+	.section	.text.mspUid,"ax",@progbits
+	.p2align 4
+	.type	mspUid, @function
+mspUid:
+.LFB53:
+	.loc 1 1142 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1143 5 view .LVU2378
+.LVL297:
+.LBB1211:
+.LBI1211:
+	.loc 1 497 6 view .LVU2379
+.LBB1212:
+	.loc 1 499 5 view .LVU2380
+.LBE1212:
+.LBE1211:
+	.loc 1 1142 1 is_stmt 0 view .LVU2381
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1214:
+.LBB1213:
+	.loc 1 499 5 view .LVU2382
+	movl	$12, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL298:
+	.loc 1 499 5 view .LVU2383
+.LBE1213:
+.LBE1214:
+	.loc 1 1144 5 is_stmt 1 view .LVU2384
+.LBB1215:
+.LBI1215:
+	.loc 1 426 6 view .LVU2385
+	.loc 1 428 5 view .LVU2386
+.LBB1216:
+.LBI1216:
+	.loc 1 420 6 view .LVU2387
+.LBB1217:
+	.loc 1 422 5 view .LVU2388
+	movl	$76, %edi
+	call	serialize8
+.LVL299:
+	.loc 1 423 5 view .LVU2389
+	movl	$84, %edi
+	call	serialize8
+.LVL300:
+	.loc 1 423 5 is_stmt 0 view .LVU2390
+.LBE1217:
+.LBE1216:
+	.loc 1 429 5 is_stmt 1 view .LVU2391
+.LBB1218:
+.LBI1218:
+	.loc 1 420 6 view .LVU2392
+.LBB1219:
+	.loc 1 422 5 view .LVU2393
+	movl	$73, %edi
+	call	serialize8
+.LVL301:
+	.loc 1 423 5 view .LVU2394
+	movl	$83, %edi
+	call	serialize8
+.LVL302:
+	.loc 1 423 5 is_stmt 0 view .LVU2395
+.LBE1219:
+.LBE1218:
+.LBE1215:
+	.loc 1 1145 5 is_stmt 1 view .LVU2396
+.LBB1220:
+.LBI1220:
+	.loc 1 426 6 view .LVU2397
+	.loc 1 428 5 view .LVU2398
+.LBB1221:
+.LBI1221:
+	.loc 1 420 6 view .LVU2399
+.LBB1222:
+	.loc 1 422 5 view .LVU2400
+	xorl	%edi, %edi
+	call	serialize8
+.LVL303:
+	.loc 1 423 5 view .LVU2401
+	xorl	%edi, %edi
+	call	serialize8
+.LVL304:
+	.loc 1 423 5 is_stmt 0 view .LVU2402
+.LBE1222:
+.LBE1221:
+	.loc 1 429 5 is_stmt 1 view .LVU2403
+.LBB1223:
+.LBI1223:
+	.loc 1 420 6 view .LVU2404
+.LBB1224:
+	.loc 1 422 5 view .LVU2405
+	xorl	%edi, %edi
+	call	serialize8
+.LVL305:
+	.loc 1 423 5 view .LVU2406
+	xorl	%edi, %edi
+	call	serialize8
+.LVL306:
+	.loc 1 423 5 is_stmt 0 view .LVU2407
+.LBE1224:
+.LBE1223:
+.LBE1220:
+	.loc 1 1146 5 is_stmt 1 view .LVU2408
+.LBB1225:
+.LBI1225:
+	.loc 1 426 6 view .LVU2409
+	.loc 1 428 5 view .LVU2410
+.LBB1226:
+.LBI1226:
+	.loc 1 420 6 view .LVU2411
+.LBB1227:
+	.loc 1 422 5 view .LVU2412
+	xorl	%edi, %edi
+	call	serialize8
+.LVL307:
+	.loc 1 423 5 view .LVU2413
+	xorl	%edi, %edi
+	call	serialize8
+.LVL308:
+	.loc 1 423 5 is_stmt 0 view .LVU2414
+.LBE1227:
+.LBE1226:
+	.loc 1 429 5 is_stmt 1 view .LVU2415
+.LBB1228:
+.LBI1228:
+	.loc 1 420 6 view .LVU2416
+.LBB1229:
+	.loc 1 422 5 view .LVU2417
+	xorl	%edi, %edi
+	call	serialize8
+.LVL309:
+	.loc 1 423 5 view .LVU2418
+	xorl	%edi, %edi
+	call	serialize8
+.LVL310:
+	.loc 1 423 5 is_stmt 0 view .LVU2419
+.LBE1229:
+.LBE1228:
+.LBE1225:
+	.loc 1 1147 5 is_stmt 1 view .LVU2420
+	.loc 1 1148 1 is_stmt 0 view .LVU2421
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	mspUid, .-mspUid
+	.section	.text.mspServoConf,"ax",@progbits
+	.p2align 4
+	.type	mspServoConf, @function
+mspServoConf:
+.LFB35:
+	.loc 1 839 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 840 5 view .LVU2423
+	.loc 1 842 5 view .LVU2424
+.LVL311:
+.LBB1238:
+.LBI1238:
+	.loc 1 497 6 view .LVU2425
+.LBB1239:
+	.loc 1 499 5 view .LVU2426
+.LBE1239:
+.LBE1238:
+	.loc 1 839 1 is_stmt 0 view .LVU2427
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB1242:
+.LBB1240:
+	.loc 1 499 5 view .LVU2428
+	movl	$56, %esi
+	xorl	%edi, %edi
+.LBE1240:
+.LBE1242:
+	.loc 1 843 12 view .LVU2429
+	xorl	%r12d, %r12d
+	.loc 1 839 1 view .LVU2430
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB1243:
+.LBB1241:
+	.loc 1 499 5 view .LVU2431
+	call	headSerialResponse
+.LVL312:
+	.loc 1 499 5 view .LVU2432
+.LBE1241:
+.LBE1243:
+	.loc 1 843 5 is_stmt 1 view .LVU2433
+	.loc 1 843 19 view .LVU2434
+	.p2align 4,,10
+	.p2align 3
+.L342:
+	.loc 1 844 9 discriminator 3 view .LVU2435
+	.loc 1 844 49 is_stmt 0 discriminator 3 view .LVU2436
+	movq	currentProfile(%rip), %rax
+	movl	%r12d, %ebx
+	.loc 1 843 25 discriminator 3 view .LVU2437
+	addl	$1, %r12d
+.LVL313:
+	.loc 1 844 49 discriminator 3 view .LVU2438
+	addq	$56, %rbx
+	movzwl	12(%rax,%rbx,8), %ebp
+.LVL314:
+.LBB1244:
+.LBI1244:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2439
+.LBB1245:
+	.loc 1 422 5 discriminator 3 view .LVU2440
+	movzbl	%bpl, %edi
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2441
+	sarw	$8, %bp
+.LVL315:
+	.loc 1 422 5 discriminator 3 view .LVU2442
+	call	serialize8
+.LVL316:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2443
+	movzbl	%bpl, %edi
+	call	serialize8
+.LVL317:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2444
+.LBE1245:
+.LBE1244:
+	.loc 1 845 9 is_stmt 1 discriminator 3 view .LVU2445
+	.loc 1 845 49 is_stmt 0 discriminator 3 view .LVU2446
+	movq	currentProfile(%rip), %rax
+	movzwl	14(%rax,%rbx,8), %ebp
+.LVL318:
+.LBB1246:
+.LBI1246:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2447
+.LBB1247:
+	.loc 1 422 5 discriminator 3 view .LVU2448
+	movzbl	%bpl, %edi
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2449
+	sarw	$8, %bp
+.LVL319:
+	.loc 1 422 5 discriminator 3 view .LVU2450
+	call	serialize8
+.LVL320:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2451
+	movzbl	%bpl, %edi
+	call	serialize8
+.LVL321:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2452
+.LBE1247:
+.LBE1246:
+	.loc 1 846 9 is_stmt 1 discriminator 3 view .LVU2453
+	.loc 1 846 49 is_stmt 0 discriminator 3 view .LVU2454
+	movq	currentProfile(%rip), %rax
+	movzwl	16(%rax,%rbx,8), %ebp
+.LVL322:
+.LBB1248:
+.LBI1248:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2455
+.LBB1249:
+	.loc 1 422 5 discriminator 3 view .LVU2456
+	movzbl	%bpl, %edi
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2457
+	sarw	$8, %bp
+.LVL323:
+	.loc 1 422 5 discriminator 3 view .LVU2458
+	call	serialize8
+.LVL324:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2459
+	movzbl	%bpl, %edi
+	call	serialize8
+.LVL325:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2460
+.LBE1249:
+.LBE1248:
+	.loc 1 847 9 is_stmt 1 discriminator 3 view .LVU2461
+	.loc 1 847 48 is_stmt 0 discriminator 3 view .LVU2462
+	movq	currentProfile(%rip), %rax
+	.loc 1 847 9 discriminator 3 view .LVU2463
+	movzbl	18(%rax,%rbx,8), %edi
+	call	serialize8
+.LVL326:
+	.loc 1 843 25 is_stmt 1 discriminator 3 view .LVU2464
+	.loc 1 843 19 discriminator 3 view .LVU2465
+	cmpl	$8, %r12d
+	jne	.L342
+	.loc 1 849 5 view .LVU2466
+	.loc 1 850 1 is_stmt 0 view .LVU2467
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL327:
+	.loc 1 850 1 view .LVU2468
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	mspServoConf, .-mspServoConf
+	.section	.text.mspMotorPins,"ax",@progbits
+	.p2align 4
+	.type	mspMotorPins, @function
+mspMotorPins:
+.LFB49:
+	.loc 1 1020 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1021 5 view .LVU2470
+	.loc 1 1023 5 view .LVU2471
+.LVL328:
+.LBB1250:
+.LBI1250:
+	.loc 1 497 6 view .LVU2472
+.LBB1251:
+	.loc 1 499 5 view .LVU2473
+.LBE1251:
+.LBE1250:
+	.loc 1 1020 1 is_stmt 0 view .LVU2474
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1253:
+.LBB1252:
+	.loc 1 499 5 view .LVU2475
+	movl	$8, %esi
+	xorl	%edi, %edi
+	movl	$1, %ebx
+	call	headSerialResponse
+.LVL329:
+	.loc 1 499 5 view .LVU2476
+.LBE1252:
+.LBE1253:
+	.loc 1 1024 5 is_stmt 1 view .LVU2477
+	.loc 1 1024 19 view .LVU2478
+	.p2align 4,,10
+	.p2align 3
+.L346:
+	.loc 1 1025 9 discriminator 3 view .LVU2479
+	movl	%ebx, %edi
+	.loc 1 1024 19 is_stmt 0 discriminator 3 view .LVU2480
+	addl	$1, %ebx
+.LVL330:
+	.loc 1 1025 9 discriminator 3 view .LVU2481
+	call	serialize8
+.LVL331:
+	.loc 1 1024 25 is_stmt 1 discriminator 3 view .LVU2482
+	.loc 1 1024 19 discriminator 3 view .LVU2483
+	cmpl	$9, %ebx
+	jne	.L346
+	.loc 1 1026 5 view .LVU2484
+	.loc 1 1027 1 is_stmt 0 view .LVU2485
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	mspMotorPins, .-mspMotorPins
+	.section	.text.mspMisc,"ax",@progbits
+	.p2align 4
+	.type	mspMisc, @function
+mspMisc:
+.LFB48:
+	.loc 1 1002 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1003 5 view .LVU2487
+.LVL332:
+.LBB1276:
+.LBI1276:
+	.loc 1 497 6 view .LVU2488
+.LBB1277:
+	.loc 1 499 5 view .LVU2489
+.LBE1277:
+.LBE1276:
+	.loc 1 1002 1 is_stmt 0 view .LVU2490
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1279:
+.LBB1278:
+	.loc 1 499 5 view .LVU2491
+	movl	$22, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL333:
+	.loc 1 499 5 view .LVU2492
+.LBE1278:
+.LBE1279:
+	.loc 1 1004 5 is_stmt 1 view .LVU2493
+.LBB1280:
+.LBI1280:
+	.loc 1 420 6 view .LVU2494
+.LBB1281:
+	.loc 1 422 5 view .LVU2495
+	xorl	%edi, %edi
+	call	serialize8
+.LVL334:
+	.loc 1 423 5 view .LVU2496
+	xorl	%edi, %edi
+	call	serialize8
+.LVL335:
+	.loc 1 423 5 is_stmt 0 view .LVU2497
+.LBE1281:
+.LBE1280:
+	.loc 1 1005 5 is_stmt 1 view .LVU2498
+	.loc 1 1005 47 is_stmt 0 view .LVU2499
+	movzwl	208+masterConfig(%rip), %ebx
+.LVL336:
+.LBB1282:
+.LBI1282:
+	.loc 1 420 6 is_stmt 1 view .LVU2500
+.LBB1283:
+	.loc 1 422 5 view .LVU2501
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2502
+	sarw	$8, %bx
+.LVL337:
+	.loc 1 422 5 view .LVU2503
+	call	serialize8
+.LVL338:
+	.loc 1 423 5 is_stmt 1 view .LVU2504
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL339:
+	.loc 1 423 5 is_stmt 0 view .LVU2505
+.LBE1283:
+.LBE1282:
+	.loc 1 1006 5 is_stmt 1 view .LVU2506
+	.loc 1 1006 47 is_stmt 0 view .LVU2507
+	movzwl	210+masterConfig(%rip), %ebx
+.LVL340:
+.LBB1284:
+.LBI1284:
+	.loc 1 420 6 is_stmt 1 view .LVU2508
+.LBB1285:
+	.loc 1 422 5 view .LVU2509
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2510
+	sarw	$8, %bx
+.LVL341:
+	.loc 1 422 5 view .LVU2511
+	call	serialize8
+.LVL342:
+	.loc 1 423 5 is_stmt 1 view .LVU2512
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL343:
+	.loc 1 423 5 is_stmt 0 view .LVU2513
+.LBE1285:
+.LBE1284:
+	.loc 1 1007 5 is_stmt 1 view .LVU2514
+	.loc 1 1007 47 is_stmt 0 view .LVU2515
+	movzwl	212+masterConfig(%rip), %ebx
+.LVL344:
+.LBB1286:
+.LBI1286:
+	.loc 1 420 6 is_stmt 1 view .LVU2516
+.LBB1287:
+	.loc 1 422 5 view .LVU2517
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2518
+	sarw	$8, %bx
+.LVL345:
+	.loc 1 422 5 view .LVU2519
+	call	serialize8
+.LVL346:
+	.loc 1 423 5 is_stmt 1 view .LVU2520
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL347:
+	.loc 1 423 5 is_stmt 0 view .LVU2521
+.LBE1287:
+.LBE1286:
+	.loc 1 1008 5 is_stmt 1 view .LVU2522
+	.loc 1 1008 47 is_stmt 0 view .LVU2523
+	movq	currentProfile(%rip), %rax
+	movzwl	526(%rax), %ebx
+.LVL348:
+.LBB1288:
+.LBI1288:
+	.loc 1 420 6 is_stmt 1 view .LVU2524
+.LBB1289:
+	.loc 1 422 5 view .LVU2525
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2526
+	sarw	$8, %bx
+.LVL349:
+	.loc 1 422 5 view .LVU2527
+	call	serialize8
+.LVL350:
+	.loc 1 423 5 is_stmt 1 view .LVU2528
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL351:
+	.loc 1 423 5 is_stmt 0 view .LVU2529
+.LBE1289:
+.LBE1288:
+	.loc 1 1009 5 is_stmt 1 view .LVU2530
+.LBB1290:
+.LBI1290:
+	.loc 1 420 6 view .LVU2531
+.LBB1291:
+	.loc 1 422 5 view .LVU2532
+	xorl	%edi, %edi
+	call	serialize8
+.LVL352:
+	.loc 1 423 5 view .LVU2533
+	xorl	%edi, %edi
+	call	serialize8
+.LVL353:
+	.loc 1 423 5 is_stmt 0 view .LVU2534
+.LBE1291:
+.LBE1290:
+	.loc 1 1010 5 is_stmt 1 view .LVU2535
+.LBB1292:
+.LBI1292:
+	.loc 1 426 6 view .LVU2536
+	.loc 1 428 5 view .LVU2537
+.LBB1293:
+.LBI1293:
+	.loc 1 420 6 view .LVU2538
+.LBB1294:
+	.loc 1 422 5 view .LVU2539
+	xorl	%edi, %edi
+	call	serialize8
+.LVL354:
+	.loc 1 423 5 view .LVU2540
+	xorl	%edi, %edi
+	call	serialize8
+.LVL355:
+	.loc 1 423 5 is_stmt 0 view .LVU2541
+.LBE1294:
+.LBE1293:
+	.loc 1 429 5 is_stmt 1 view .LVU2542
+.LBB1295:
+.LBI1295:
+	.loc 1 420 6 view .LVU2543
+.LBB1296:
+	.loc 1 422 5 view .LVU2544
+	xorl	%edi, %edi
+	call	serialize8
+.LVL356:
+	.loc 1 423 5 view .LVU2545
+	xorl	%edi, %edi
+	call	serialize8
+.LVL357:
+	.loc 1 423 5 is_stmt 0 view .LVU2546
+.LBE1296:
+.LBE1295:
+.LBE1292:
+	.loc 1 1011 5 is_stmt 1 view .LVU2547
+	.loc 1 1011 31 is_stmt 0 view .LVU2548
+	movq	currentProfile(%rip), %rax
+	.loc 1 1011 5 view .LVU2549
+	movswl	94(%rax), %ebx
+	movl	%ebx, %eax
+	imull	$26215, %ebx, %ebx
+	sarl	$18, %ebx
+	sarw	$15, %ax
+	subl	%eax, %ebx
+.LVL358:
+.LBB1297:
+.LBI1297:
+	.loc 1 420 6 is_stmt 1 view .LVU2550
+.LBB1298:
+	.loc 1 422 5 view .LVU2551
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2552
+	sarw	$8, %bx
+.LVL359:
+	.loc 1 422 5 view .LVU2553
+	call	serialize8
+.LVL360:
+	.loc 1 423 5 is_stmt 1 view .LVU2554
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL361:
+	.loc 1 423 5 is_stmt 0 view .LVU2555
+.LBE1298:
+.LBE1297:
+	.loc 1 1012 5 is_stmt 1 view .LVU2556
+	movzbl	300+masterConfig(%rip), %edi
+	call	serialize8
+.LVL362:
+	.loc 1 1013 5 view .LVU2557
+	movzbl	302+masterConfig(%rip), %edi
+	call	serialize8
+.LVL363:
+	.loc 1 1014 5 view .LVU2558
+	movzbl	301+masterConfig(%rip), %edi
+	call	serialize8
+.LVL364:
+	.loc 1 1015 5 view .LVU2559
+	xorl	%edi, %edi
+	call	serialize8
+.LVL365:
+	.loc 1 1016 5 view .LVU2560
+	.loc 1 1017 1 is_stmt 0 view .LVU2561
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE48:
+	.size	mspMisc, .-mspMisc
+	.section	.text.mspPid,"ax",@progbits
+	.p2align 4
+	.type	mspPid, @function
+mspPid:
+.LFB43:
+	.loc 1 925 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 926 5 view .LVU2563
+	.loc 1 928 5 view .LVU2564
+.LVL366:
+.LBB1299:
+.LBI1299:
+	.loc 1 497 6 view .LVU2565
+.LBB1300:
+	.loc 1 499 5 view .LVU2566
+.LBE1300:
+.LBE1299:
+	.loc 1 925 1 is_stmt 0 view .LVU2567
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB1303:
+.LBB1301:
+	.loc 1 499 5 view .LVU2568
+	xorl	%edi, %edi
+	movl	$30, %esi
+.LBE1301:
+.LBE1303:
+	.loc 1 925 1 view .LVU2569
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 947 16 view .LVU2570
+	xorl	%ebx, %ebx
+.LBB1304:
+.LBB1302:
+	.loc 1 499 5 view .LVU2571
+	call	headSerialResponse
+.LVL367:
+	.loc 1 499 5 view .LVU2572
+.LBE1302:
+.LBE1304:
+	.loc 1 929 5 is_stmt 1 view .LVU2573
+	.loc 1 929 23 is_stmt 0 view .LVU2574
+	movq	currentProfile(%rip), %rax
+	.loc 1 929 8 view .LVU2575
+	cmpb	$2, (%rax)
+	jne	.L352
+	jmp	.L354
+.LVL368:
+	.p2align 4,,10
+	.p2align 3
+.L369:
+	.loc 1 948 38 view .LVU2576
+	movq	currentProfile(%rip), %rax
+.LVL369:
+.L352:
+	.loc 1 948 13 is_stmt 1 discriminator 3 view .LVU2577
+	.loc 1 948 53 is_stmt 0 discriminator 3 view .LVU2578
+	movl	%ebx, %ebp
+	.loc 1 947 42 discriminator 3 view .LVU2579
+	addl	$1, %ebx
+.LVL370:
+	.loc 1 948 13 discriminator 3 view .LVU2580
+	movzbl	4(%rax,%rbp), %edi
+	call	serialize8
+.LVL371:
+	.loc 1 949 13 is_stmt 1 discriminator 3 view .LVU2581
+	.loc 1 949 53 is_stmt 0 discriminator 3 view .LVU2582
+	movq	currentProfile(%rip), %rax
+	.loc 1 949 13 discriminator 3 view .LVU2583
+	movzbl	14(%rax,%rbp), %edi
+	call	serialize8
+.LVL372:
+	.loc 1 950 13 is_stmt 1 discriminator 3 view .LVU2584
+	.loc 1 950 53 is_stmt 0 discriminator 3 view .LVU2585
+	movq	currentProfile(%rip), %rax
+	.loc 1 950 13 discriminator 3 view .LVU2586
+	movzbl	24(%rax,%rbp), %edi
+	call	serialize8
+.LVL373:
+	.loc 1 947 42 is_stmt 1 discriminator 3 view .LVU2587
+	.loc 1 947 23 discriminator 3 view .LVU2588
+	cmpl	$10, %ebx
+	jne	.L369
+	.loc 1 953 5 view .LVU2589
+	.loc 1 954 1 is_stmt 0 view .LVU2590
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL374:
+	.loc 1 954 1 view .LVU2591
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL375:
+	.loc 1 954 1 view .LVU2592
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL376:
+	.p2align 4,,10
+	.p2align 3
+.L354:
+	.cfi_restore_state
+	.loc 1 931 13 is_stmt 1 discriminator 3 view .LVU2593
+	.loc 1 931 71 is_stmt 0 discriminator 3 view .LVU2594
+	movl	%ebx, %ebp
+	.loc 1 931 34 discriminator 3 view .LVU2595
+	movss	.LC1(%rip), %xmm0
+	.loc 1 930 29 discriminator 3 view .LVU2596
+	addl	$1, %ebx
+.LVL377:
+	.loc 1 931 34 discriminator 3 view .LVU2597
+	mulss	36(%rax,%rbp,4), %xmm0
+	.loc 1 931 71 discriminator 3 view .LVU2598
+	leaq	8(%rbp), %r12
+	.loc 1 931 34 discriminator 3 view .LVU2599
+	call	lrintf@PLT
+.LVL378:
+	.loc 1 931 24 discriminator 3 view .LVU2600
+	movl	$250, %edx
+	xorl	%esi, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL379:
+	.loc 1 931 13 discriminator 3 view .LVU2601
+	movzbl	%al, %edi
+	call	serialize8
+.LVL380:
+	.loc 1 932 13 is_stmt 1 discriminator 3 view .LVU2602
+	.loc 1 932 34 is_stmt 0 discriminator 3 view .LVU2603
+	movq	currentProfile(%rip), %rax
+	movss	.LC2(%rip), %xmm0
+	mulss	16(%rax,%r12,4), %xmm0
+	call	lrintf@PLT
+.LVL381:
+	.loc 1 932 24 discriminator 3 view .LVU2604
+	movl	$250, %edx
+	xorl	%esi, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL382:
+	.loc 1 932 13 discriminator 3 view .LVU2605
+	movzbl	%al, %edi
+	call	serialize8
+.LVL383:
+	.loc 1 933 13 is_stmt 1 discriminator 3 view .LVU2606
+	.loc 1 933 34 is_stmt 0 discriminator 3 view .LVU2607
+	movq	currentProfile(%rip), %rax
+	movss	.LC3(%rip), %xmm0
+	mulss	60(%rax,%rbp,4), %xmm0
+	call	lrintf@PLT
+.LVL384:
+	.loc 1 933 24 discriminator 3 view .LVU2608
+	movl	$100, %edx
+	xorl	%esi, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL385:
+	.loc 1 933 13 discriminator 3 view .LVU2609
+	movzbl	%al, %edi
+	call	serialize8
+.LVL386:
+	.loc 1 930 29 is_stmt 1 discriminator 3 view .LVU2610
+	.loc 1 930 23 discriminator 3 view .LVU2611
+	cmpl	$3, %ebx
+	je	.L353
+	.loc 1 937 59 is_stmt 0 view .LVU2612
+	movq	currentProfile(%rip), %rax
+	jmp	.L354
+	.p2align 4,,10
+	.p2align 3
+.L370:
+	.loc 1 937 17 is_stmt 1 view .LVU2613
+	.loc 1 937 38 is_stmt 0 view .LVU2614
+	movss	.LC1(%rip), %xmm0
+	mulss	72(%rax), %xmm0
+	.loc 1 935 42 view .LVU2615
+	movl	$8, %ebx
+.LVL387:
+	.loc 1 937 38 view .LVU2616
+	call	lrintf@PLT
+.LVL388:
+	.loc 1 937 28 view .LVU2617
+	movl	$250, %edx
+	xorl	%esi, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL389:
+	.loc 1 937 17 view .LVU2618
+	movzbl	%al, %edi
+	call	serialize8
+.LVL390:
+	.loc 1 938 17 is_stmt 1 view .LVU2619
+	.loc 1 938 38 is_stmt 0 view .LVU2620
+	movq	currentProfile(%rip), %rax
+	movss	.LC1(%rip), %xmm0
+	mulss	76(%rax), %xmm0
+	call	lrintf@PLT
+.LVL391:
+	.loc 1 938 28 view .LVU2621
+	movl	$250, %edx
+	xorl	%esi, %esi
+	movl	%eax, %edi
+	call	constrain@PLT
+.LVL392:
+	.loc 1 938 17 view .LVU2622
+	movzbl	%al, %edi
+	call	serialize8
+.LVL393:
+	.loc 1 939 17 is_stmt 1 view .LVU2623
+	xorl	%edi, %edi
+	call	serialize8
+.LVL394:
+	.loc 1 935 42 view .LVU2624
+	.loc 1 935 23 view .LVU2625
+.L353:
+	.loc 1 936 13 view .LVU2626
+	.loc 1 937 59 is_stmt 0 view .LVU2627
+	movq	currentProfile(%rip), %rax
+	.loc 1 936 16 view .LVU2628
+	cmpl	$7, %ebx
+	je	.L370
+	.loc 1 941 17 is_stmt 1 view .LVU2629
+	.loc 1 941 57 is_stmt 0 view .LVU2630
+	movl	%ebx, %ebp
+	.loc 1 935 42 view .LVU2631
+	addl	$1, %ebx
+.LVL395:
+	.loc 1 941 17 view .LVU2632
+	movzbl	4(%rax,%rbp), %edi
+	call	serialize8
+.LVL396:
+	.loc 1 942 17 is_stmt 1 view .LVU2633
+	.loc 1 942 57 is_stmt 0 view .LVU2634
+	movq	currentProfile(%rip), %rax
+	.loc 1 942 17 view .LVU2635
+	movzbl	14(%rax,%rbp), %edi
+	call	serialize8
+.LVL397:
+	.loc 1 943 17 is_stmt 1 view .LVU2636
+	.loc 1 943 57 is_stmt 0 view .LVU2637
+	movq	currentProfile(%rip), %rax
+	.loc 1 943 17 view .LVU2638
+	movzbl	24(%rax,%rbp), %edi
+	call	serialize8
+.LVL398:
+	.loc 1 935 42 is_stmt 1 view .LVU2639
+	.loc 1 935 23 view .LVU2640
+	cmpl	$10, %ebx
+	jne	.L353
+	.loc 1 953 5 view .LVU2641
+	.loc 1 954 1 is_stmt 0 view .LVU2642
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL399:
+	.loc 1 954 1 view .LVU2643
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL400:
+	.loc 1 954 1 view .LVU2644
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	mspPid, .-mspPid
+	.section	.text.mspRcTuning,"ax",@progbits
+	.p2align 4
+	.type	mspRcTuning, @function
+mspRcTuning:
+.LFB42:
+	.loc 1 912 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 913 5 view .LVU2646
+.LVL401:
+.LBB1305:
+.LBI1305:
+	.loc 1 497 6 view .LVU2647
+.LBB1306:
+	.loc 1 499 5 view .LVU2648
+.LBE1306:
+.LBE1305:
+	.loc 1 912 1 is_stmt 0 view .LVU2649
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1308:
+.LBB1307:
+	.loc 1 499 5 view .LVU2650
+	movl	$7, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL402:
+	.loc 1 499 5 view .LVU2651
+.LBE1307:
+.LBE1308:
+	.loc 1 914 5 is_stmt 1 view .LVU2652
+	.loc 1 914 49 is_stmt 0 view .LVU2653
+	movq	currentProfile(%rip), %rax
+	.loc 1 914 5 view .LVU2654
+	movzbl	84(%rax), %edi
+	call	serialize8
+.LVL403:
+	.loc 1 915 5 is_stmt 1 view .LVU2655
+	.loc 1 915 49 is_stmt 0 view .LVU2656
+	movq	currentProfile(%rip), %rax
+	.loc 1 915 5 view .LVU2657
+	movzbl	85(%rax), %edi
+	call	serialize8
+.LVL404:
+	.loc 1 916 5 is_stmt 1 view .LVU2658
+	.loc 1 916 49 is_stmt 0 view .LVU2659
+	movq	currentProfile(%rip), %rax
+	.loc 1 916 5 view .LVU2660
+	movzbl	88(%rax), %edi
+	call	serialize8
+.LVL405:
+	.loc 1 917 5 is_stmt 1 view .LVU2661
+	.loc 1 917 49 is_stmt 0 view .LVU2662
+	movq	currentProfile(%rip), %rax
+	.loc 1 917 5 view .LVU2663
+	movzbl	89(%rax), %edi
+	call	serialize8
+.LVL406:
+	.loc 1 918 5 is_stmt 1 view .LVU2664
+	.loc 1 918 30 is_stmt 0 view .LVU2665
+	movq	currentProfile(%rip), %rax
+	.loc 1 918 5 view .LVU2666
+	movzbl	90(%rax), %edi
+	call	serialize8
+.LVL407:
+	.loc 1 919 5 is_stmt 1 view .LVU2667
+	.loc 1 919 49 is_stmt 0 view .LVU2668
+	movq	currentProfile(%rip), %rax
+	.loc 1 919 5 view .LVU2669
+	movzbl	86(%rax), %edi
+	call	serialize8
+.LVL408:
+	.loc 1 920 5 is_stmt 1 view .LVU2670
+	.loc 1 920 49 is_stmt 0 view .LVU2671
+	movq	currentProfile(%rip), %rax
+	.loc 1 920 5 view .LVU2672
+	movzbl	87(%rax), %edi
+	call	serialize8
+.LVL409:
+	.loc 1 921 5 is_stmt 1 view .LVU2673
+	.loc 1 922 1 is_stmt 0 view .LVU2674
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	mspRcTuning, .-mspRcTuning
+	.section	.text.mspAnalog,"ax",@progbits
+	.p2align 4
+	.type	mspAnalog, @function
+mspAnalog:
+.LFB41:
+	.loc 1 899 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 900 5 view .LVU2676
+.LVL410:
+.LBB1319:
+.LBI1319:
+	.loc 1 497 6 view .LVU2677
+.LBB1320:
+	.loc 1 499 5 view .LVU2678
+.LBE1320:
+.LBE1319:
+	.loc 1 899 1 is_stmt 0 view .LVU2679
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1322:
+.LBB1321:
+	.loc 1 499 5 view .LVU2680
+	xorl	%edi, %edi
+	movl	$7, %esi
+	call	headSerialResponse
+.LVL411:
+	.loc 1 499 5 view .LVU2681
+.LBE1321:
+.LBE1322:
+	.loc 1 901 5 is_stmt 1 view .LVU2682
+	.loc 1 901 25 is_stmt 0 view .LVU2683
+	movzbl	vbat(%rip), %edi
+	xorl	%esi, %esi
+	movl	$255, %edx
+	call	constrain@PLT
+.LVL412:
+	.loc 1 901 5 view .LVU2684
+	movzbl	%al, %edi
+	call	serialize8
+.LVL413:
+	.loc 1 902 5 is_stmt 1 view .LVU2685
+	.loc 1 902 27 is_stmt 0 view .LVU2686
+	movl	mAhDrawn(%rip), %edi
+	xorl	%esi, %esi
+	movl	$65535, %edx
+	call	constrain@PLT
+.LVL414:
+	movl	%eax, %ebx
+.LVL415:
+.LBB1323:
+.LBI1323:
+	.loc 1 420 6 is_stmt 1 view .LVU2687
+.LBB1324:
+	.loc 1 422 5 view .LVU2688
+	movzbl	%al, %edi
+	call	serialize8
+.LVL416:
+	.loc 1 423 5 view .LVU2689
+	movzbl	%bh, %edi
+	call	serialize8
+.LVL417:
+	.loc 1 423 5 is_stmt 0 view .LVU2690
+.LBE1324:
+.LBE1323:
+	.loc 1 903 5 is_stmt 1 view .LVU2691
+	movzwl	rssi(%rip), %ebx
+.LVL418:
+.LBB1325:
+.LBI1325:
+	.loc 1 420 6 view .LVU2692
+.LBB1326:
+	.loc 1 422 5 view .LVU2693
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2694
+	sarw	$8, %bx
+.LVL419:
+	.loc 1 422 5 view .LVU2695
+	call	serialize8
+.LVL420:
+	.loc 1 423 5 is_stmt 1 view .LVU2696
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL421:
+	.loc 1 423 5 is_stmt 0 view .LVU2697
+.LBE1326:
+.LBE1325:
+	.loc 1 904 5 is_stmt 1 view .LVU2698
+	.loc 1 904 7 is_stmt 0 view .LVU2699
+	cmpb	$0, 308+masterConfig(%rip)
+	je	.L374
+	.loc 1 905 9 is_stmt 1 view .LVU2700
+	.loc 1 905 71 is_stmt 0 view .LVU2701
+	movl	amperage(%rip), %edx
+	movl	%edx, %eax
+	negl	%eax
+	cmovs	%edx, %eax
+	.loc 1 905 31 view .LVU2702
+	leal	(%rax,%rax,4), %edi
+	addl	%edi, %edi
+.L377:
+	.loc 1 907 31 view .LVU2703
+	movl	$65535, %edx
+	xorl	%esi, %esi
+	call	constrain@PLT
+.LVL422:
+	movl	%eax, %ebx
+.LVL423:
+.LBB1327:
+.LBI1327:
+	.loc 1 420 6 is_stmt 1 view .LVU2704
+.LBB1328:
+	.loc 1 422 5 view .LVU2705
+	movzbl	%al, %edi
+	call	serialize8
+.LVL424:
+	.loc 1 423 5 view .LVU2706
+	movzbl	%bh, %edi
+	call	serialize8
+.LVL425:
+	.loc 1 423 5 is_stmt 0 view .LVU2707
+.LBE1328:
+.LBE1327:
+	.loc 1 908 5 is_stmt 1 view .LVU2708
+	.loc 1 909 1 is_stmt 0 view .LVU2709
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	.cfi_restore_state
+	.loc 1 907 9 is_stmt 1 view .LVU2710
+	.loc 1 907 31 is_stmt 0 view .LVU2711
+	movl	amperage(%rip), %eax
+	movl	%eax, %edi
+	negl	%edi
+	cmovs	%eax, %edi
+	jmp	.L377
+	.cfi_endproc
+.LFE41:
+	.size	mspAnalog, .-mspAnalog
+	.section	.text.mspAltitude,"ax",@progbits
+	.p2align 4
+	.type	mspAltitude, @function
+mspAltitude:
+.LFB40:
+	.loc 1 891 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 892 5 view .LVU2713
+.LVL426:
+.LBB1339:
+.LBI1339:
+	.loc 1 497 6 view .LVU2714
+.LBB1340:
+	.loc 1 499 5 view .LVU2715
+.LBE1340:
+.LBE1339:
+	.loc 1 891 1 is_stmt 0 view .LVU2716
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1342:
+.LBB1341:
+	.loc 1 499 5 view .LVU2717
+	movl	$6, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL427:
+	.loc 1 499 5 view .LVU2718
+.LBE1341:
+.LBE1342:
+	.loc 1 893 5 is_stmt 1 view .LVU2719
+	movl	EstAlt(%rip), %ebx
+.LVL428:
+.LBB1343:
+.LBI1343:
+	.loc 1 426 6 view .LVU2720
+.LBB1344:
+	.loc 1 428 5 view .LVU2721
+.LBB1345:
+.LBI1345:
+	.loc 1 420 6 view .LVU2722
+.LBB1346:
+	.loc 1 422 5 view .LVU2723
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL429:
+	.loc 1 423 5 view .LVU2724
+	movzbl	%bh, %edi
+.LBE1346:
+.LBE1345:
+	.loc 1 429 27 is_stmt 0 view .LVU2725
+	shrl	$16, %ebx
+.LVL430:
+.LBB1348:
+.LBB1347:
+	.loc 1 423 5 view .LVU2726
+	call	serialize8
+.LVL431:
+	.loc 1 423 5 view .LVU2727
+.LBE1347:
+.LBE1348:
+	.loc 1 429 5 is_stmt 1 view .LVU2728
+.LBB1349:
+.LBI1349:
+	.loc 1 420 6 view .LVU2729
+.LBB1350:
+	.loc 1 422 5 view .LVU2730
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2731
+	shrl	$8, %ebx
+.LVL432:
+	.loc 1 422 5 view .LVU2732
+	call	serialize8
+.LVL433:
+	.loc 1 423 5 is_stmt 1 view .LVU2733
+	movl	%ebx, %edi
+	call	serialize8
+.LVL434:
+	.loc 1 423 5 is_stmt 0 view .LVU2734
+.LBE1350:
+.LBE1349:
+.LBE1344:
+.LBE1343:
+	.loc 1 894 5 is_stmt 1 view .LVU2735
+	movl	vario(%rip), %ebx
+.LVL435:
+.LBB1351:
+.LBI1351:
+	.loc 1 420 6 view .LVU2736
+.LBB1352:
+	.loc 1 422 5 view .LVU2737
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL436:
+	.loc 1 423 5 view .LVU2738
+	movzbl	%bh, %edi
+	call	serialize8
+.LVL437:
+	.loc 1 423 5 is_stmt 0 view .LVU2739
+.LBE1352:
+.LBE1351:
+	.loc 1 895 5 is_stmt 1 view .LVU2740
+	.loc 1 896 1 is_stmt 0 view .LVU2741
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	mspAltitude, .-mspAltitude
+	.section	.text.mspAttitude,"ax",@progbits
+	.p2align 4
+	.type	mspAttitude, @function
+mspAttitude:
+.LFB39:
+	.loc 1 880 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 881 5 view .LVU2743
+	.loc 1 883 5 view .LVU2744
+.LVL438:
+.LBB1359:
+.LBI1359:
+	.loc 1 497 6 view .LVU2745
+.LBB1360:
+	.loc 1 499 5 view .LVU2746
+.LBE1360:
+.LBE1359:
+	.loc 1 880 1 is_stmt 0 view .LVU2747
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1362:
+.LBB1361:
+	.loc 1 499 5 view .LVU2748
+	movl	$6, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL439:
+	.loc 1 499 5 view .LVU2749
+.LBE1361:
+.LBE1362:
+	.loc 1 884 5 is_stmt 1 view .LVU2750
+	.loc 1 884 19 view .LVU2751
+	.loc 1 885 9 view .LVU2752
+	.loc 1 885 36 is_stmt 0 view .LVU2753
+	movzwl	inclination(%rip), %ebx
+.LVL440:
+.LBB1363:
+.LBI1363:
+	.loc 1 420 6 is_stmt 1 view .LVU2754
+.LBB1364:
+	.loc 1 422 5 view .LVU2755
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2756
+	sarw	$8, %bx
+.LVL441:
+	.loc 1 422 5 view .LVU2757
+	call	serialize8
+.LVL442:
+	.loc 1 423 5 is_stmt 1 view .LVU2758
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL443:
+	.loc 1 423 5 is_stmt 0 view .LVU2759
+.LBE1364:
+.LBE1363:
+	.loc 1 884 25 is_stmt 1 view .LVU2760
+	.loc 1 884 19 view .LVU2761
+	.loc 1 885 9 view .LVU2762
+	.loc 1 885 36 is_stmt 0 view .LVU2763
+	movzwl	2+inclination(%rip), %ebx
+.LVL444:
+.LBB1366:
+	.loc 1 420 6 is_stmt 1 view .LVU2764
+.LBB1365:
+	.loc 1 422 5 view .LVU2765
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2766
+	sarw	$8, %bx
+.LVL445:
+	.loc 1 422 5 view .LVU2767
+	call	serialize8
+.LVL446:
+	.loc 1 423 5 is_stmt 1 view .LVU2768
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL447:
+	.loc 1 423 5 is_stmt 0 view .LVU2769
+.LBE1365:
+.LBE1366:
+	.loc 1 884 25 is_stmt 1 view .LVU2770
+	.loc 1 884 19 view .LVU2771
+	.loc 1 886 5 view .LVU2772
+	movzwl	heading(%rip), %ebx
+.LVL448:
+.LBB1367:
+.LBI1367:
+	.loc 1 420 6 view .LVU2773
+.LBB1368:
+	.loc 1 422 5 view .LVU2774
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2775
+	sarw	$8, %bx
+.LVL449:
+	.loc 1 422 5 view .LVU2776
+	call	serialize8
+.LVL450:
+	.loc 1 423 5 is_stmt 1 view .LVU2777
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL451:
+	.loc 1 423 5 is_stmt 0 view .LVU2778
+.LBE1368:
+.LBE1367:
+	.loc 1 887 5 is_stmt 1 view .LVU2779
+	.loc 1 888 1 is_stmt 0 view .LVU2780
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	mspAttitude, .-mspAttitude
+	.section	.text.mspRc,"ax",@progbits
+	.p2align 4
+	.type	mspRc, @function
+mspRc:
+.LFB38:
+	.loc 1 870 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 871 5 view .LVU2782
+	.loc 1 873 5 view .LVU2783
+.LVL452:
+.LBB1373:
+.LBI1373:
+	.loc 1 497 6 view .LVU2784
+.LBB1374:
+	.loc 1 499 5 view .LVU2785
+.LBE1374:
+.LBE1373:
+	.loc 1 870 1 is_stmt 0 view .LVU2786
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+.LBB1377:
+.LBB1375:
+	.loc 1 499 5 view .LVU2787
+	xorl	%edi, %edi
+.LBE1375:
+.LBE1377:
+	.loc 1 870 1 view .LVU2788
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 873 5 view .LVU2789
+	movzbl	rxRuntimeConfig(%rip), %esi
+	addl	%esi, %esi
+	movzwl	%si, %esi
+.LBB1378:
+.LBB1376:
+	.loc 1 499 5 view .LVU2790
+	call	headSerialResponse
+.LVL453:
+	.loc 1 499 5 view .LVU2791
+.LBE1376:
+.LBE1378:
+	.loc 1 874 5 is_stmt 1 view .LVU2792
+	.loc 1 874 19 view .LVU2793
+	cmpb	$0, rxRuntimeConfig(%rip)
+	je	.L383
+	xorl	%ebp, %ebp
+	leaq	rcData(%rip), %r13
+	leaq	rxRuntimeConfig(%rip), %r12
+.LVL454:
+	.p2align 4,,10
+	.p2align 3
+.L384:
+	.loc 1 875 9 discriminator 3 view .LVU2794
+	.loc 1 875 27 is_stmt 0 discriminator 3 view .LVU2795
+	movzwl	0(%r13,%rbp,2), %ebx
+.LVL455:
+.LBB1379:
+.LBI1379:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2796
+.LBB1380:
+	.loc 1 422 5 discriminator 3 view .LVU2797
+.LBE1380:
+.LBE1379:
+	.loc 1 874 19 is_stmt 0 discriminator 3 view .LVU2798
+	addq	$1, %rbp
+.LVL456:
+.LBB1382:
+.LBB1381:
+	.loc 1 422 5 discriminator 3 view .LVU2799
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU2800
+	sarw	$8, %bx
+.LVL457:
+	.loc 1 422 5 discriminator 3 view .LVU2801
+	call	serialize8
+.LVL458:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2802
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL459:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2803
+.LBE1381:
+.LBE1382:
+	.loc 1 874 52 is_stmt 1 discriminator 3 view .LVU2804
+	.loc 1 874 19 discriminator 3 view .LVU2805
+	.loc 1 874 36 is_stmt 0 discriminator 3 view .LVU2806
+	movzbl	(%r12), %eax
+	.loc 1 874 19 discriminator 3 view .LVU2807
+	cmpl	%eax, %ebp
+	jb	.L384
+.L383:
+	.loc 1 876 5 is_stmt 1 view .LVU2808
+	.loc 1 877 1 is_stmt 0 view .LVU2809
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	mspRc, .-mspRc
+	.section	.text.mspRawImu,"ax",@progbits
+	.p2align 4
+	.type	mspRawImu, @function
+mspRawImu:
+.LFB33:
+	.loc 1 813 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 814 5 view .LVU2811
+	.loc 1 816 5 view .LVU2812
+.LVL460:
+.LBB1393:
+.LBI1393:
+	.loc 1 497 6 view .LVU2813
+.LBB1394:
+	.loc 1 499 5 view .LVU2814
+.LBE1394:
+.LBE1393:
+	.loc 1 813 1 is_stmt 0 view .LVU2815
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB1397:
+.LBB1395:
+	.loc 1 499 5 view .LVU2816
+	xorl	%edi, %edi
+	movl	$18, %esi
+.LBE1395:
+.LBE1397:
+	.loc 1 813 1 view .LVU2817
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	leaq	accSmooth(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	leaq	6(%rbp), %r12
+.LBB1398:
+.LBB1396:
+	.loc 1 499 5 view .LVU2818
+	call	headSerialResponse
+.LVL461:
+	.loc 1 499 5 view .LVU2819
+.LBE1396:
+.LBE1398:
+	.loc 1 818 5 is_stmt 1 view .LVU2820
+	.loc 1 818 8 is_stmt 0 view .LVU2821
+	cmpw	$1024, acc_1G(%rip)
+	jbe	.L391
+.L389:
+.LVL462:
+	.loc 1 820 13 is_stmt 1 discriminator 3 view .LVU2822
+	movzwl	0(%rbp), %eax
+	testw	%ax, %ax
+	leal	7(%rax), %ebx
+	cmovns	%eax, %ebx
+	.loc 1 819 23 is_stmt 0 discriminator 3 view .LVU2823
+	addq	$2, %rbp
+.LVL463:
+	.loc 1 820 13 discriminator 3 view .LVU2824
+	movl	%ebx, %edi
+.LBB1399:
+.LBB1400:
+	.loc 1 423 5 discriminator 3 view .LVU2825
+	sarw	$11, %bx
+.LBE1400:
+.LBE1399:
+	.loc 1 820 13 discriminator 3 view .LVU2826
+	sarw	$3, %di
+.LVL464:
+.LBB1402:
+.LBI1399:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2827
+.LBB1401:
+	.loc 1 422 5 discriminator 3 view .LVU2828
+	movzbl	%dil, %edi
+.LVL465:
+	.loc 1 422 5 is_stmt 0 discriminator 3 view .LVU2829
+	call	serialize8
+.LVL466:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2830
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL467:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2831
+.LBE1401:
+.LBE1402:
+	.loc 1 819 29 is_stmt 1 discriminator 3 view .LVU2832
+	.loc 1 819 23 discriminator 3 view .LVU2833
+	cmpq	%rbp, %r12
+	jne	.L389
+.L390:
+	leaq	gyroData(%rip), %rbp
+	leaq	6(%rbp), %r12
+.L392:
+.LVL468:
+	.loc 1 826 9 discriminator 3 view .LVU2834
+	.loc 1 826 29 is_stmt 0 discriminator 3 view .LVU2835
+	movzwl	0(%rbp), %ebx
+.LVL469:
+.LBB1403:
+.LBI1403:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2836
+.LBB1404:
+	.loc 1 422 5 discriminator 3 view .LVU2837
+.LBE1404:
+.LBE1403:
+	.loc 1 825 19 is_stmt 0 discriminator 3 view .LVU2838
+	addq	$2, %rbp
+.LVL470:
+.LBB1406:
+.LBB1405:
+	.loc 1 422 5 discriminator 3 view .LVU2839
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU2840
+	sarw	$8, %bx
+.LVL471:
+	.loc 1 422 5 discriminator 3 view .LVU2841
+	call	serialize8
+.LVL472:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2842
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL473:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2843
+.LBE1405:
+.LBE1406:
+	.loc 1 825 25 is_stmt 1 discriminator 3 view .LVU2844
+	.loc 1 825 19 discriminator 3 view .LVU2845
+	cmpq	%rbp, %r12
+	jne	.L392
+	leaq	magADC(%rip), %rbp
+	leaq	6(%rbp), %r12
+.L393:
+.LVL474:
+	.loc 1 828 9 discriminator 3 view .LVU2846
+	.loc 1 828 27 is_stmt 0 discriminator 3 view .LVU2847
+	movzwl	0(%rbp), %ebx
+.LVL475:
+.LBB1407:
+.LBI1407:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2848
+.LBB1408:
+	.loc 1 422 5 discriminator 3 view .LVU2849
+.LBE1408:
+.LBE1407:
+	.loc 1 827 19 is_stmt 0 discriminator 3 view .LVU2850
+	addq	$2, %rbp
+.LVL476:
+.LBB1410:
+.LBB1409:
+	.loc 1 422 5 discriminator 3 view .LVU2851
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU2852
+	sarw	$8, %bx
+.LVL477:
+	.loc 1 422 5 discriminator 3 view .LVU2853
+	call	serialize8
+.LVL478:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2854
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL479:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2855
+.LBE1409:
+.LBE1410:
+	.loc 1 827 25 is_stmt 1 discriminator 3 view .LVU2856
+	.loc 1 827 19 discriminator 3 view .LVU2857
+	cmpq	%rbp, %r12
+	jne	.L393
+	.loc 1 829 5 view .LVU2858
+	.loc 1 830 1 is_stmt 0 view .LVU2859
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	.cfi_restore_state
+.LVL480:
+	.loc 1 823 13 is_stmt 1 discriminator 3 view .LVU2860
+	.loc 1 823 34 is_stmt 0 discriminator 3 view .LVU2861
+	movzwl	0(%rbp), %ebx
+.LVL481:
+.LBB1411:
+.LBI1411:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU2862
+.LBB1412:
+	.loc 1 422 5 discriminator 3 view .LVU2863
+.LBE1412:
+.LBE1411:
+	.loc 1 822 23 is_stmt 0 discriminator 3 view .LVU2864
+	addq	$2, %rbp
+.LVL482:
+.LBB1414:
+.LBB1413:
+	.loc 1 422 5 discriminator 3 view .LVU2865
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU2866
+	sarw	$8, %bx
+.LVL483:
+	.loc 1 422 5 discriminator 3 view .LVU2867
+	call	serialize8
+.LVL484:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU2868
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL485:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU2869
+.LBE1413:
+.LBE1414:
+	.loc 1 822 29 is_stmt 1 discriminator 3 view .LVU2870
+	.loc 1 822 23 discriminator 3 view .LVU2871
+	cmpq	%rbp, %r12
+	jne	.L391
+	jmp	.L390
+	.cfi_endproc
+.LFE33:
+	.size	mspRawImu, .-mspRawImu
+	.section	.text.mspStatus,"ax",@progbits
+	.p2align 4
+	.type	mspStatus, @function
+mspStatus:
+.LFB32:
+	.loc 1 765 1 view -0
+	.cfi_startproc
+	.loc 1 766 5 view .LVU2873
+	.loc 1 767 5 view .LVU2874
+	.loc 1 769 5 view .LVU2875
+.LVL486:
+.LBB1430:
+.LBI1430:
+	.loc 1 497 6 view .LVU2876
+.LBB1431:
+	.loc 1 499 5 view .LVU2877
+.LBE1431:
+.LBE1430:
+	.loc 1 765 1 is_stmt 0 view .LVU2878
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB1434:
+.LBB1432:
+	.loc 1 499 5 view .LVU2879
+	movl	$11, %esi
+	xorl	%edi, %edi
+.LBE1432:
+.LBE1434:
+	.loc 1 765 1 view .LVU2880
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB1435:
+.LBB1433:
+	.loc 1 499 5 view .LVU2881
+	call	headSerialResponse
+.LVL487:
+	.loc 1 499 5 view .LVU2882
+.LBE1433:
+.LBE1435:
+	.loc 1 770 5 is_stmt 1 view .LVU2883
+	movzwl	cycleTime(%rip), %ebx
+.LVL488:
+.LBB1436:
+.LBI1436:
+	.loc 1 420 6 view .LVU2884
+.LBB1437:
+	.loc 1 422 5 view .LVU2885
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU2886
+	sarw	$8, %bx
+.LVL489:
+	.loc 1 422 5 view .LVU2887
+	call	serialize8
+.LVL490:
+	.loc 1 423 5 is_stmt 1 view .LVU2888
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL491:
+	.loc 1 423 5 is_stmt 0 view .LVU2889
+.LBE1437:
+.LBE1436:
+	.loc 1 774 5 is_stmt 1 view .LVU2890
+.LBB1438:
+.LBI1438:
+	.loc 1 420 6 view .LVU2891
+.LBB1439:
+	.loc 1 422 5 view .LVU2892
+	xorl	%edi, %edi
+	call	serialize8
+.LVL492:
+	.loc 1 423 5 view .LVU2893
+	xorl	%edi, %edi
+	call	serialize8
+.LVL493:
+	.loc 1 423 5 is_stmt 0 view .LVU2894
+.LBE1439:
+.LBE1438:
+	.loc 1 776 5 is_stmt 1 view .LVU2895
+	.loc 1 776 17 is_stmt 0 view .LVU2896
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL494:
+	.loc 1 776 39 view .LVU2897
+	movl	$4, %edi
+	.loc 1 776 17 view .LVU2898
+	movzbl	%al, %ebp
+	.loc 1 776 39 view .LVU2899
+	call	sensors@PLT
+.LVL495:
+	.loc 1 776 67 view .LVU2900
+	movl	$8, %edi
+	.loc 1 776 39 view .LVU2901
+	movzbl	%al, %ebx
+	.loc 1 776 67 view .LVU2902
+	call	sensors@PLT
+.LVL496:
+	.loc 1 776 60 view .LVU2903
+	addl	%ebx, %ebx
+	.loc 1 776 94 view .LVU2904
+	movl	$32, %edi
+	.loc 1 776 67 view .LVU2905
+	movzbl	%al, %eax
+	.loc 1 776 87 view .LVU2906
+	sall	$2, %eax
+	.loc 1 776 65 view .LVU2907
+	orl	%eax, %ebx
+	.loc 1 776 94 view .LVU2908
+	call	sensors@PLT
+.LVL497:
+	.loc 1 776 65 view .LVU2909
+	orl	%ebp, %ebx
+	.loc 1 776 121 view .LVU2910
+	movl	$16, %edi
+	.loc 1 776 94 view .LVU2911
+	movzbl	%al, %eax
+	.loc 1 776 114 view .LVU2912
+	sall	$3, %eax
+	.loc 1 776 92 view .LVU2913
+	orl	%eax, %ebx
+	.loc 1 776 121 view .LVU2914
+	call	sensors@PLT
+.LVL498:
+.LBB1440:
+.LBI1440:
+	.loc 1 420 6 is_stmt 1 view .LVU2915
+.LBB1441:
+	.loc 1 422 5 view .LVU2916
+.LBE1441:
+.LBE1440:
+	.loc 1 776 121 is_stmt 0 view .LVU2917
+	movzbl	%al, %eax
+	.loc 1 776 143 view .LVU2918
+	sall	$4, %eax
+.LVL499:
+	.loc 1 776 119 view .LVU2919
+	orl	%eax, %ebx
+.LBB1443:
+.LBB1442:
+	.loc 1 422 5 view .LVU2920
+	movswl	%bx, %edi
+	call	serialize8
+.LVL500:
+	.loc 1 423 5 is_stmt 1 view .LVU2921
+	xorl	%edi, %edi
+	call	serialize8
+.LVL501:
+	.loc 1 423 5 is_stmt 0 view .LVU2922
+.LBE1442:
+.LBE1443:
+	.loc 1 780 5 is_stmt 1 view .LVU2923
+	.loc 1 781 5 view .LVU2924
+	.loc 1 781 57 is_stmt 0 view .LVU2925
+	movzwl	flightModeFlags(%rip), %edx
+	.loc 1 799 68 view .LVU2926
+	movl	rcModeActivationMask(%rip), %eax
+	.loc 1 802 19 view .LVU2927
+	movzbl	activeBoxIdCount(%rip), %r8d
+	.loc 1 783 54 view .LVU2928
+	movl	%edx, %ecx
+	.loc 1 799 68 view .LVU2929
+	andl	$2077120, %eax
+	.loc 1 789 58 view .LVU2930
+	movl	%edx, %esi
+	.loc 1 783 54 view .LVU2931
+	andl	$8, %ecx
+	.loc 1 789 58 view .LVU2932
+	sall	$5, %esi
+	.loc 1 798 85 view .LVU2933
+	orl	%ecx, %eax
+	.loc 1 781 57 view .LVU2934
+	leal	(%rdx,%rdx), %ecx
+	.loc 1 781 69 view .LVU2935
+	andl	$6, %ecx
+	.loc 1 798 85 view .LVU2936
+	orl	%ecx, %eax
+	.loc 1 784 53 view .LVU2937
+	leal	0(,%rdx,4), %ecx
+	andl	$16, %ecx
+	.loc 1 790 58 view .LVU2938
+	andl	$1536, %esi
+	.loc 1 798 85 view .LVU2939
+	orl	%ecx, %eax
+	.loc 1 785 58 view .LVU2940
+	movl	%edx, %ecx
+	sarl	%ecx
+	andl	$32, %ecx
+	.loc 1 798 85 view .LVU2941
+	orl	%ecx, %eax
+	orl	%eax, %esi
+	.loc 1 791 58 view .LVU2942
+	leal	0(,%rdx,8), %eax
+	.loc 1 800 55 view .LVU2943
+	sall	$12, %edx
+	.loc 1 791 58 view .LVU2944
+	andl	$2048, %eax
+	.loc 1 800 55 view .LVU2945
+	andl	$2097152, %edx
+	.loc 1 798 85 view .LVU2946
+	orl	%eax, %esi
+	.loc 1 801 46 view .LVU2947
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 799 83 view .LVU2948
+	orl	%edx, %esi
+	.loc 1 801 46 view .LVU2949
+	shrb	$2, %al
+	andl	$1, %eax
+	.loc 1 800 67 view .LVU2950
+	orl	%eax, %esi
+.LVL502:
+	.loc 1 802 5 is_stmt 1 view .LVU2951
+	.loc 1 802 19 view .LVU2952
+	testb	%r8b, %r8b
+	je	.L403
+	xorl	%eax, %eax
+	.loc 1 780 10 is_stmt 0 view .LVU2953
+	xorl	%ebx, %ebx
+	leaq	activeBoxIds(%rip), %r10
+.LBB1444:
+	.loc 1 803 30 view .LVU2954
+	movl	$1, %r9d
+.LVL503:
+	.p2align 4,,10
+	.p2align 3
+.L402:
+	.loc 1 803 9 is_stmt 1 view .LVU2955
+	.loc 1 804 9 view .LVU2956
+	.loc 1 803 45 is_stmt 0 view .LVU2957
+	movzbl	(%r10,%rax), %ecx
+	.loc 1 803 30 view .LVU2958
+	movl	%r9d, %edi
+	sall	%cl, %edi
+	.loc 1 805 18 view .LVU2959
+	movl	%ebx, %ecx
+	btsl	%eax, %ecx
+	testl	%esi, %edi
+	cmovne	%ecx, %ebx
+.LVL504:
+	.loc 1 805 18 view .LVU2960
+.LBE1444:
+	.loc 1 802 40 is_stmt 1 view .LVU2961
+	.loc 1 802 19 view .LVU2962
+	addq	$1, %rax
+.LVL505:
+	.loc 1 802 19 is_stmt 0 view .LVU2963
+	cmpl	%r8d, %eax
+	jb	.L402
+.LBB1445:
+.LBB1446:
+	.loc 1 429 27 view .LVU2964
+	movl	%ebx, %ebp
+.LBB1447:
+.LBB1448:
+	.loc 1 422 5 view .LVU2965
+	movzbl	%bl, %edi
+	.loc 1 423 5 view .LVU2966
+	movzbl	%bh, %ebx
+.LVL506:
+	.loc 1 423 5 view .LVU2967
+.LBE1448:
+.LBE1447:
+	.loc 1 429 27 view .LVU2968
+	shrl	$16, %ebp
+.LVL507:
+.L400:
+	.loc 1 429 27 view .LVU2969
+.LBE1446:
+.LBE1445:
+	.loc 1 807 5 is_stmt 1 view .LVU2970
+.LBB1454:
+.LBI1445:
+	.loc 1 426 6 view .LVU2971
+.LBB1453:
+	.loc 1 428 5 view .LVU2972
+.LBB1450:
+.LBI1447:
+	.loc 1 420 6 view .LVU2973
+.LBB1449:
+	.loc 1 422 5 view .LVU2974
+	call	serialize8
+.LVL508:
+	.loc 1 423 5 view .LVU2975
+	movl	%ebx, %edi
+	call	serialize8
+.LVL509:
+.LBE1449:
+.LBE1450:
+	.loc 1 429 5 view .LVU2976
+.LBB1451:
+.LBI1451:
+	.loc 1 420 6 view .LVU2977
+.LBB1452:
+	.loc 1 422 5 view .LVU2978
+	movl	%ebp, %edi
+	call	serialize8
+.LVL510:
+	.loc 1 423 5 view .LVU2979
+	xorl	%edi, %edi
+	call	serialize8
+.LVL511:
+	.loc 1 423 5 is_stmt 0 view .LVU2980
+.LBE1452:
+.LBE1451:
+.LBE1453:
+.LBE1454:
+	.loc 1 808 5 is_stmt 1 view .LVU2981
+	movzbl	2008+masterConfig(%rip), %edi
+	call	serialize8
+.LVL512:
+	.loc 1 809 5 view .LVU2982
+	.loc 1 810 1 is_stmt 0 view .LVU2983
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL513:
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	.cfi_restore_state
+	.loc 1 802 19 view .LVU2984
+	xorl	%ebx, %ebx
+	xorl	%edi, %edi
+	xorl	%ebp, %ebp
+	jmp	.L400
+	.cfi_endproc
+.LFE32:
+	.size	mspStatus, .-mspStatus
+	.section	.text.mspIdent,"ax",@progbits
+	.p2align 4
+	.type	mspIdent, @function
+mspIdent:
+.LFB31:
+	.loc 1 755 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 756 5 view .LVU2986
+.LVL514:
+.LBB1463:
+.LBI1463:
+	.loc 1 497 6 view .LVU2987
+.LBB1464:
+	.loc 1 499 5 view .LVU2988
+.LBE1464:
+.LBE1463:
+	.loc 1 755 1 is_stmt 0 view .LVU2989
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1466:
+.LBB1465:
+	.loc 1 499 5 view .LVU2990
+	movl	$7, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL515:
+	.loc 1 499 5 view .LVU2991
+.LBE1465:
+.LBE1466:
+	.loc 1 757 5 is_stmt 1 view .LVU2992
+	movl	$230, %edi
+	call	serialize8
+.LVL516:
+	.loc 1 758 5 view .LVU2993
+	movzbl	masterConfig(%rip), %edi
+	call	serialize8
+.LVL517:
+	.loc 1 759 5 view .LVU2994
+	xorl	%edi, %edi
+	call	serialize8
+.LVL518:
+	.loc 1 760 5 view .LVU2995
+	cmpb	$1, 335+masterConfig(%rip)
+	sbbl	%edi, %edi
+	andl	$-8, %edi
+	addl	$12, %edi
+.LBB1467:
+.LBI1467:
+	.loc 1 426 6 view .LVU2996
+	.loc 1 428 5 view .LVU2997
+.LBB1468:
+.LBI1468:
+	.loc 1 420 6 view .LVU2998
+.LBB1469:
+	.loc 1 422 5 view .LVU2999
+	call	serialize8
+.LVL519:
+	.loc 1 423 5 view .LVU3000
+	xorl	%edi, %edi
+	call	serialize8
+.LVL520:
+.LBE1469:
+.LBE1468:
+	.loc 1 429 5 view .LVU3001
+.LBB1470:
+.LBI1470:
+	.loc 1 420 6 view .LVU3002
+.LBB1471:
+	.loc 1 422 5 view .LVU3003
+	xorl	%edi, %edi
+	call	serialize8
+.LVL521:
+	.loc 1 423 5 view .LVU3004
+	xorl	%edi, %edi
+	call	serialize8
+.LVL522:
+	.loc 1 423 5 is_stmt 0 view .LVU3005
+.LBE1471:
+.LBE1470:
+.LBE1467:
+	.loc 1 761 5 is_stmt 1 view .LVU3006
+	.loc 1 762 1 is_stmt 0 view .LVU3007
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	mspIdent, .-mspIdent
+	.section	.text.mspRxMap,"ax",@progbits
+	.p2align 4
+	.type	mspRxMap, @function
+mspRxMap:
+.LFB60:
+	.loc 1 1199 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1200 5 view .LVU3009
+	.loc 1 1202 5 view .LVU3010
+.LVL523:
+.LBB1472:
+.LBI1472:
+	.loc 1 497 6 view .LVU3011
+.LBB1473:
+	.loc 1 499 5 view .LVU3012
+.LBE1473:
+.LBE1472:
+	.loc 1 1199 1 is_stmt 0 view .LVU3013
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB1476:
+.LBB1474:
+	.loc 1 499 5 view .LVU3014
+	movl	$8, %esi
+	xorl	%edi, %edi
+.LBE1474:
+.LBE1476:
+	.loc 1 1199 1 view .LVU3015
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	leaq	310+masterConfig(%rip), %rbx
+	leaq	8(%rbx), %rbp
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB1477:
+.LBB1475:
+	.loc 1 499 5 view .LVU3016
+	call	headSerialResponse
+.LVL524:
+	.loc 1 499 5 view .LVU3017
+.LBE1475:
+.LBE1477:
+	.loc 1 1203 5 is_stmt 1 view .LVU3018
+	.loc 1 1203 19 view .LVU3019
+	.p2align 4,,10
+	.p2align 3
+.L413:
+	.loc 1 1204 9 discriminator 3 view .LVU3020
+	movzbl	(%rbx), %edi
+	.loc 1 1203 19 is_stmt 0 discriminator 3 view .LVU3021
+	addq	$1, %rbx
+.LVL525:
+	.loc 1 1204 9 discriminator 3 view .LVU3022
+	call	serialize8
+.LVL526:
+	.loc 1 1203 25 is_stmt 1 discriminator 3 view .LVU3023
+	.loc 1 1203 19 discriminator 3 view .LVU3024
+	cmpq	%rbp, %rbx
+	jne	.L413
+	.loc 1 1205 5 view .LVU3025
+	.loc 1 1206 1 is_stmt 0 view .LVU3026
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE60:
+	.size	mspRxMap, .-mspRxMap
+	.section	.text.mspProfile,"ax",@progbits
+	.p2align 4
+	.type	mspProfile, @function
+mspProfile:
+.LFB51:
+	.loc 1 1106 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1107 5 view .LVU3028
+	.loc 1 1109 5 view .LVU3029
+	.loc 1 1109 20 is_stmt 0 view .LVU3030
+	movq	currentPort(%rip), %rax
+	.loc 1 1106 1 view .LVU3031
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	.loc 1 1109 20 view .LVU3032
+	movzwl	48(%rax), %edx
+	.loc 1 1109 45 view .LVU3033
+	testw	%dx, %dx
+	je	.L422
+.LBB1512:
+.LBI1512:
+	.loc 1 432 9 is_stmt 1 view .LVU3034
+.LBB1513:
+	.loc 1 435 5 view .LVU3035
+	.loc 1 435 20 is_stmt 0 view .LVU3036
+	movzwl	52(%rax), %ecx
+	.loc 1 435 8 view .LVU3037
+	cmpw	%dx, %cx
+	jnb	.L422
+	.loc 1 439 5 is_stmt 1 view .LVU3038
+	.loc 1 439 49 is_stmt 0 view .LVU3039
+	leal	1(%rcx), %edx
+	movw	%dx, 52(%rax)
+.LBE1513:
+.LBE1512:
+	.loc 1 1109 45 view .LVU3040
+	movzbl	54(%rax,%rcx), %ebp
+.LVL527:
+	.loc 1 1110 5 is_stmt 1 view .LVU3041
+	.loc 1 1111 15 is_stmt 0 view .LVU3042
+	xorl	%eax, %eax
+.LBB1515:
+	.loc 1 1116 9 view .LVU3043
+	movl	%ebp, %ebx
+.LBE1515:
+	.loc 1 1110 8 view .LVU3044
+	cmpl	$8, %ebp
+	jbe	.L417
+	.loc 1 1129 1 view .LVU3045
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL528:
+	.loc 1 1129 1 view .LVU3046
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL529:
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	.cfi_restore_state
+.LBB1563:
+.LBB1514:
+	.loc 1 1129 1 view .LVU3047
+	xorl	%ebx, %ebx
+.LBE1514:
+.LBE1563:
+	.loc 1 1109 45 view .LVU3048
+	xorl	%ebp, %ebp
+.L417:
+.LBB1564:
+	.loc 1 1114 9 is_stmt 1 view .LVU3049
+	.loc 1 1114 44 is_stmt 0 view .LVU3050
+	movl	%ebp, %edi
+	call	getProfileStageStats@PLT
+.LVL530:
+.LBB1516:
+.LBB1517:
+	.loc 1 499 5 view .LVU3051
+	movl	$41, %esi
+	xorl	%edi, %edi
+.LBE1517:
+.LBE1516:
+	.loc 1 1114 44 view .LVU3052
+	movq	%rax, %r12
+.LVL531:
+	.loc 1 1115 9 is_stmt 1 view .LVU3053
+.LBB1519:
+.LBI1516:
+	.loc 1 497 6 view .LVU3054
+.LBB1518:
+	.loc 1 499 5 view .LVU3055
+	call	headSerialResponse
+.LVL532:
+	.loc 1 499 5 is_stmt 0 view .LVU3056
+.LBE1518:
+.LBE1519:
+	.loc 1 1116 9 is_stmt 1 view .LVU3057
+	movl	%ebx, %edi
+	call	serialize8
+.LVL533:
+	.loc 1 1117 9 view .LVU3058
+	movl	$9, %edi
+	call	serialize8
+.LVL534:
+	.loc 1 1118 9 view .LVU3059
+	movl	$10, %edi
+	call	serialize8
+.LVL535:
+	.loc 1 1119 9 view .LVU3060
+	.loc 1 1119 21 is_stmt 0 view .LVU3061
+	call	getProfileCyclesPerMicrosecond@PLT
+.LVL536:
+	movl	%eax, %ebx
+.LVL537:
+.LBB1520:
+.LBI1520:
+	.loc 1 420 6 is_stmt 1 view .LVU3062
+.LBB1521:
+	.loc 1 422 5 view .LVU3063
+	movzbl	%al, %edi
+	call	serialize8
+.LVL538:
+	.loc 1 423 5 view .LVU3064
+	movzbl	%bh, %edi
+	call	serialize8
+.LVL539:
+	.loc 1 423 5 is_stmt 0 view .LVU3065
+.LBE1521:
+.LBE1520:
+	.loc 1 1120 9 is_stmt 1 view .LVU3066
+	.loc 1 1120 26 is_stmt 0 view .LVU3067
+	movl	4(%r12), %ebx
+.LVL540:
+.LBB1522:
+.LBI1522:
+	.loc 1 426 6 is_stmt 1 view .LVU3068
+.LBB1523:
+	.loc 1 428 5 view .LVU3069
+.LBB1524:
+.LBI1524:
+	.loc 1 420 6 view .LVU3070
+.LBB1525:
+	.loc 1 422 5 view .LVU3071
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL541:
+	.loc 1 423 5 view .LVU3072
+	movzbl	%bh, %edi
+.LBE1525:
+.LBE1524:
+	.loc 1 429 27 is_stmt 0 view .LVU3073
+	shrl	$16, %ebx
+.LVL542:
+.LBB1527:
+.LBB1526:
+	.loc 1 423 5 view .LVU3074
+	call	serialize8
+.LVL543:
+	.loc 1 423 5 view .LVU3075
+.LBE1526:
+.LBE1527:
+	.loc 1 429 5 is_stmt 1 view .LVU3076
+.LBB1528:
+.LBI1528:
+	.loc 1 420 6 view .LVU3077
+.LBB1529:
+	.loc 1 422 5 view .LVU3078
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3079
+	shrl	$8, %ebx
+.LVL544:
+	.loc 1 422 5 view .LVU3080
+	call	serialize8
+.LVL545:
+	.loc 1 423 5 is_stmt 1 view .LVU3081
+	movl	%ebx, %edi
+	call	serialize8
+.LVL546:
+	.loc 1 423 5 is_stmt 0 view .LVU3082
+.LBE1529:
+.LBE1528:
+.LBE1523:
+.LBE1522:
+	.loc 1 1121 9 is_stmt 1 view .LVU3083
+	movl	4(%r12), %eax
+	testl	%eax, %eax
+	jne	.L427
+	xorl	%ebx, %ebx
+	xorl	%edi, %edi
+	xorl	%r13d, %r13d
+	xorl	%r14d, %r14d
+.L419:
+.LBB1530:
+.LBI1530:
+	.loc 1 426 6 discriminator 4 view .LVU3084
+.LBB1531:
+	.loc 1 428 5 discriminator 4 view .LVU3085
+.LBB1532:
+.LBI1532:
+	.loc 1 420 6 discriminator 4 view .LVU3086
+.LBB1533:
+	.loc 1 422 5 discriminator 4 view .LVU3087
+	call	serialize8
+.LVL547:
+	.loc 1 423 5 discriminator 4 view .LVU3088
+	movl	%ebx, %edi
+	call	serialize8
+.LVL548:
+.LBE1533:
+.LBE1532:
+	.loc 1 429 5 discriminator 4 view .LVU3089
+.LBB1535:
+.LBI1535:
+	.loc 1 420 6 discriminator 4 view .LVU3090
+.LBB1536:
+	.loc 1 422 5 discriminator 4 view .LVU3091
+	movl	%r14d, %edi
+	call	serialize8
+.LVL549:
+	.loc 1 423 5 discriminator 4 view .LVU3092
+	movl	%r13d, %edi
+	call	serialize8
+.LVL550:
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU3093
+.LBE1536:
+.LBE1535:
+.LBE1531:
+.LBE1530:
+	.loc 1 1122 9 is_stmt 1 discriminator 4 view .LVU3094
+	movl	%ebp, %edi
+	leaq	24(%r12), %rbp
+	addq	$44, %r12
+.LVL551:
+	.loc 1 1122 9 is_stmt 0 discriminator 4 view .LVU3095
+	call	getProfileStageAverageCycles@PLT
+.LVL552:
+	movl	%eax, %ebx
+.LVL553:
+.LBB1541:
+.LBI1541:
+	.loc 1 426 6 is_stmt 1 discriminator 4 view .LVU3096
+.LBB1542:
+	.loc 1 428 5 discriminator 4 view .LVU3097
+.LBB1543:
+.LBI1543:
+	.loc 1 420 6 discriminator 4 view .LVU3098
+.LBB1544:
+	.loc 1 422 5 discriminator 4 view .LVU3099
+	movzbl	%al, %edi
+	call	serialize8
+.LVL554:
+	.loc 1 423 5 discriminator 4 view .LVU3100
+	movzbl	%bh, %edi
+.LBE1544:
+.LBE1543:
+	.loc 1 429 27 is_stmt 0 discriminator 4 view .LVU3101
+	shrl	$16, %ebx
+.LVL555:
+.LBB1546:
+.LBB1545:
+	.loc 1 423 5 discriminator 4 view .LVU3102
+	call	serialize8
+.LVL556:
+	.loc 1 423 5 discriminator 4 view .LVU3103
+.LBE1545:
+.LBE1546:
+	.loc 1 429 5 is_stmt 1 discriminator 4 view .LVU3104
+.LBB1547:
+.LBI1547:
+	.loc 1 420 6 discriminator 4 view .LVU3105
+.LBB1548:
+	.loc 1 422 5 discriminator 4 view .LVU3106
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU3107
+	shrl	$8, %ebx
+.LVL557:
+	.loc 1 422 5 discriminator 4 view .LVU3108
+	call	serialize8
+.LVL558:
+	.loc 1 423 5 is_stmt 1 discriminator 4 view .LVU3109
+	movl	%ebx, %edi
+	call	serialize8
+.LVL559:
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU3110
+.LBE1548:
+.LBE1547:
+.LBE1542:
+.LBE1541:
+	.loc 1 1123 9 is_stmt 1 discriminator 4 view .LVU3111
+	.loc 1 1123 26 is_stmt 0 discriminator 4 view .LVU3112
+	movl	-32(%r12), %ebx
+.LVL560:
+.LBB1549:
+.LBI1549:
+	.loc 1 426 6 is_stmt 1 discriminator 4 view .LVU3113
+.LBB1550:
+	.loc 1 428 5 discriminator 4 view .LVU3114
+.LBB1551:
+.LBI1551:
+	.loc 1 420 6 discriminator 4 view .LVU3115
+.LBB1552:
+	.loc 1 422 5 discriminator 4 view .LVU3116
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL561:
+	.loc 1 423 5 discriminator 4 view .LVU3117
+	movzbl	%bh, %edi
+.LBE1552:
+.LBE1551:
+	.loc 1 429 27 is_stmt 0 discriminator 4 view .LVU3118
+	shrl	$16, %ebx
+.LVL562:
+.LBB1554:
+.LBB1553:
+	.loc 1 423 5 discriminator 4 view .LVU3119
+	call	serialize8
+.LVL563:
+	.loc 1 423 5 discriminator 4 view .LVU3120
+.LBE1553:
+.LBE1554:
+	.loc 1 429 5 is_stmt 1 discriminator 4 view .LVU3121
+.LBB1555:
+.LBI1555:
+	.loc 1 420 6 discriminator 4 view .LVU3122
+.LBB1556:
+	.loc 1 422 5 discriminator 4 view .LVU3123
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU3124
+	shrl	$8, %ebx
+.LVL564:
+	.loc 1 422 5 discriminator 4 view .LVU3125
+	call	serialize8
+.LVL565:
+	.loc 1 423 5 is_stmt 1 discriminator 4 view .LVU3126
+	movl	%ebx, %edi
+	call	serialize8
+.LVL566:
+	.loc 1 423 5 is_stmt 0 discriminator 4 view .LVU3127
+.LBE1556:
+.LBE1555:
+.LBE1550:
+.LBE1549:
+.LBB1557:
+	.loc 1 1124 41 is_stmt 1 discriminator 4 view .LVU3128
+	.p2align 4,,10
+	.p2align 3
+.L420:
+	.loc 1 1125 13 discriminator 3 view .LVU3129
+	.loc 1 1125 41 is_stmt 0 discriminator 3 view .LVU3130
+	movzwl	0(%rbp), %ebx
+.LVL567:
+.LBB1558:
+.LBI1558:
+	.loc 1 420 6 is_stmt 1 discriminator 3 view .LVU3131
+.LBB1559:
+	.loc 1 422 5 discriminator 3 view .LVU3132
+.LBE1559:
+.LBE1558:
+	.loc 1 1124 41 is_stmt 0 discriminator 3 view .LVU3133
+	addq	$2, %rbp
+.LVL568:
+.LBB1561:
+.LBB1560:
+	.loc 1 422 5 discriminator 3 view .LVU3134
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 3 view .LVU3135
+	sarw	$8, %bx
+.LVL569:
+	.loc 1 422 5 discriminator 3 view .LVU3136
+	call	serialize8
+.LVL570:
+	.loc 1 423 5 is_stmt 1 discriminator 3 view .LVU3137
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL571:
+	.loc 1 423 5 is_stmt 0 discriminator 3 view .LVU3138
+.LBE1560:
+.LBE1561:
+	.loc 1 1124 53 is_stmt 1 discriminator 3 view .LVU3139
+	.loc 1 1124 41 discriminator 3 view .LVU3140
+	cmpq	%rbp, %r12
+	jne	.L420
+.LBE1557:
+.LBE1564:
+	.loc 1 1129 1 is_stmt 0 view .LVU3141
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 1128 11 view .LVU3142
+	movl	$1, %eax
+	.loc 1 1129 1 view .LVU3143
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL572:
+	.loc 1 1129 1 view .LVU3144
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+.LVL573:
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	.cfi_restore_state
+.LBB1565:
+	.loc 1 1121 9 discriminator 1 view .LVU3145
+	movl	8(%r12), %ebx
+.LBB1562:
+.LBB1540:
+	.loc 1 429 27 discriminator 1 view .LVU3146
+	movl	%ebx, %r13d
+.LBB1538:
+.LBB1534:
+	.loc 1 422 5 discriminator 1 view .LVU3147
+	movzbl	%bl, %edi
+	.loc 1 423 5 discriminator 1 view .LVU3148
+	movzbl	%bh, %ebx
+.LBE1534:
+.LBE1538:
+	.loc 1 429 27 discriminator 1 view .LVU3149
+	shrl	$16, %r13d
+.LBB1539:
+.LBB1537:
+	.loc 1 422 5 discriminator 1 view .LVU3150
+	movzbl	%r13b, %r14d
+	.loc 1 423 5 discriminator 1 view .LVU3151
+	shrl	$8, %r13d
+.LBE1537:
+.LBE1539:
+.LBE1540:
+.LBE1562:
+	jmp	.L419
+.LBE1565:
+	.cfi_endproc
+.LFE51:
+	.size	mspProfile, .-mspProfile
+	.section	.text.mspRssiConfig,"ax",@progbits
+	.p2align 4
+	.type	mspRssiConfig, @function
+mspRssiConfig:
+.LFB59:
+	.loc 1 1192 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1193 5 view .LVU3153
+.LVL574:
+.LBB1566:
+.LBI1566:
+	.loc 1 497 6 view .LVU3154
+.LBB1567:
+	.loc 1 499 5 view .LVU3155
+.LBE1567:
+.LBE1566:
+	.loc 1 1192 1 is_stmt 0 view .LVU3156
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1569:
+.LBB1568:
+	.loc 1 499 5 view .LVU3157
+	movl	$1, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL575:
+	.loc 1 499 5 view .LVU3158
+.LBE1568:
+.LBE1569:
+	.loc 1 1194 5 is_stmt 1 view .LVU3159
+	movzbl	326+masterConfig(%rip), %edi
+	call	serialize8
+.LVL576:
+	.loc 1 1195 5 view .LVU3160
+	.loc 1 1196 1 is_stmt 0 view .LVU3161
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	mspRssiConfig, .-mspRssiConfig
+	.section	.text.mspRxConfig,"ax",@progbits
+	.p2align 4
+	.type	mspRxConfig, @function
+mspRxConfig:
+.LFB58:
+	.loc 1 1182 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1183 5 view .LVU3163
+.LVL577:
+.LBB1578:
+.LBI1578:
+	.loc 1 497 6 view .LVU3164
+.LBB1579:
+	.loc 1 499 5 view .LVU3165
+.LBE1579:
+.LBE1578:
+	.loc 1 1182 1 is_stmt 0 view .LVU3166
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1581:
+.LBB1580:
+	.loc 1 499 5 view .LVU3167
+	movl	$7, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL578:
+	.loc 1 499 5 view .LVU3168
+.LBE1580:
+.LBE1581:
+	.loc 1 1184 5 is_stmt 1 view .LVU3169
+	movzbl	318+masterConfig(%rip), %edi
+	call	serialize8
+.LVL579:
+	.loc 1 1185 5 view .LVU3170
+	.loc 1 1185 38 is_stmt 0 view .LVU3171
+	movzwl	324+masterConfig(%rip), %ebx
+.LVL580:
+.LBB1582:
+.LBI1582:
+	.loc 1 420 6 is_stmt 1 view .LVU3172
+.LBB1583:
+	.loc 1 422 5 view .LVU3173
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3174
+	sarw	$8, %bx
+.LVL581:
+	.loc 1 422 5 view .LVU3175
+	call	serialize8
+.LVL582:
+	.loc 1 423 5 is_stmt 1 view .LVU3176
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL583:
+	.loc 1 423 5 is_stmt 0 view .LVU3177
+.LBE1583:
+.LBE1582:
+	.loc 1 1186 5 is_stmt 1 view .LVU3178
+	.loc 1 1186 38 is_stmt 0 view .LVU3179
+	movzwl	320+masterConfig(%rip), %ebx
+.LVL584:
+.LBB1584:
+.LBI1584:
+	.loc 1 420 6 is_stmt 1 view .LVU3180
+.LBB1585:
+	.loc 1 422 5 view .LVU3181
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3182
+	sarw	$8, %bx
+.LVL585:
+	.loc 1 422 5 view .LVU3183
+	call	serialize8
+.LVL586:
+	.loc 1 423 5 is_stmt 1 view .LVU3184
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL587:
+	.loc 1 423 5 is_stmt 0 view .LVU3185
+.LBE1585:
+.LBE1584:
+	.loc 1 1187 5 is_stmt 1 view .LVU3186
+	.loc 1 1187 38 is_stmt 0 view .LVU3187
+	movzwl	322+masterConfig(%rip), %ebx
+.LVL588:
+.LBB1586:
+.LBI1586:
+	.loc 1 420 6 is_stmt 1 view .LVU3188
+.LBB1587:
+	.loc 1 422 5 view .LVU3189
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3190
+	sarw	$8, %bx
+.LVL589:
+	.loc 1 422 5 view .LVU3191
+	call	serialize8
+.LVL590:
+	.loc 1 423 5 is_stmt 1 view .LVU3192
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL591:
+	.loc 1 423 5 is_stmt 0 view .LVU3193
+.LBE1587:
+.LBE1586:
+	.loc 1 1188 5 is_stmt 1 view .LVU3194
+	.loc 1 1189 1 is_stmt 0 view .LVU3195
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE58:
+	.size	mspRxConfig, .-mspRxConfig
+	.section	.text.mspMixer,"ax",@progbits
+	.p2align 4
+	.type	mspMixer, @function
+mspMixer:
+.LFB57:
+	.loc 1 1175 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1176 5 view .LVU3197
+.LVL592:
+.LBB1588:
+.LBI1588:
+	.loc 1 497 6 view .LVU3198
+.LBB1589:
+	.loc 1 499 5 view .LVU3199
+.LBE1589:
+.LBE1588:
+	.loc 1 1175 1 is_stmt 0 view .LVU3200
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1591:
+.LBB1590:
+	.loc 1 499 5 view .LVU3201
+	movl	$1, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL593:
+	.loc 1 499 5 view .LVU3202
+.LBE1590:
+.LBE1591:
+	.loc 1 1177 5 is_stmt 1 view .LVU3203
+	movzbl	masterConfig(%rip), %edi
+	call	serialize8
+.LVL594:
+	.loc 1 1178 5 view .LVU3204
+	.loc 1 1179 1 is_stmt 0 view .LVU3205
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE57:
+	.size	mspMixer, .-mspMixer
+	.section	.text.mspCurrentMeterConfig,"ax",@progbits
+	.p2align 4
+	.type	mspCurrentMeterConfig, @function
+mspCurrentMeterConfig:
+.LFB56:
+	.loc 1 1167 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1168 5 view .LVU3207
+.LVL595:
+.LBB1598:
+.LBI1598:
+	.loc 1 497 6 view .LVU3208
+.LBB1599:
+	.loc 1 499 5 view .LVU3209
+.LBE1599:
+.LBE1598:
+	.loc 1 1167 1 is_stmt 0 view .LVU3210
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1601:
+.LBB1600:
+	.loc 1 499 5 view .LVU3211
+	movl	$4, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL596:
+	.loc 1 499 5 view .LVU3212
+.LBE1600:
+.LBE1601:
+	.loc 1 1169 5 is_stmt 1 view .LVU3213
+	.loc 1 1169 43 is_stmt 0 view .LVU3214
+	movzwl	304+masterConfig(%rip), %ebx
+.LVL597:
+.LBB1602:
+.LBI1602:
+	.loc 1 420 6 is_stmt 1 view .LVU3215
+.LBB1603:
+	.loc 1 422 5 view .LVU3216
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3217
+	sarw	$8, %bx
+.LVL598:
+	.loc 1 422 5 view .LVU3218
+	call	serialize8
+.LVL599:
+	.loc 1 423 5 is_stmt 1 view .LVU3219
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL600:
+	.loc 1 423 5 is_stmt 0 view .LVU3220
+.LBE1603:
+.LBE1602:
+	.loc 1 1170 5 is_stmt 1 view .LVU3221
+	.loc 1 1170 43 is_stmt 0 view .LVU3222
+	movzwl	306+masterConfig(%rip), %ebx
+.LVL601:
+.LBB1604:
+.LBI1604:
+	.loc 1 420 6 is_stmt 1 view .LVU3223
+.LBB1605:
+	.loc 1 422 5 view .LVU3224
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3225
+	sarw	$8, %bx
+.LVL602:
+	.loc 1 422 5 view .LVU3226
+	call	serialize8
+.LVL603:
+	.loc 1 423 5 is_stmt 1 view .LVU3227
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL604:
+	.loc 1 423 5 is_stmt 0 view .LVU3228
+.LBE1605:
+.LBE1604:
+	.loc 1 1171 5 is_stmt 1 view .LVU3229
+	.loc 1 1172 1 is_stmt 0 view .LVU3230
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	mspCurrentMeterConfig, .-mspCurrentMeterConfig
+	.section	.text.mspBoardAlignment,"ax",@progbits
+	.p2align 4
+	.type	mspBoardAlignment, @function
+mspBoardAlignment:
+.LFB55:
+	.loc 1 1158 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1159 5 view .LVU3232
+.LVL605:
+.LBB1614:
+.LBI1614:
+	.loc 1 497 6 view .LVU3233
+.LBB1615:
+	.loc 1 499 5 view .LVU3234
+.LBE1615:
+.LBE1614:
+	.loc 1 1158 1 is_stmt 0 view .LVU3235
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1617:
+.LBB1616:
+	.loc 1 499 5 view .LVU3236
+	movl	$3, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL606:
+	.loc 1 499 5 view .LVU3237
+.LBE1616:
+.LBE1617:
+	.loc 1 1160 5 is_stmt 1 view .LVU3238
+	.loc 1 1160 44 is_stmt 0 view .LVU3239
+	movzwl	240+masterConfig(%rip), %ebx
+.LVL607:
+.LBB1618:
+.LBI1618:
+	.loc 1 420 6 is_stmt 1 view .LVU3240
+.LBB1619:
+	.loc 1 422 5 view .LVU3241
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3242
+	sarw	$8, %bx
+.LVL608:
+	.loc 1 422 5 view .LVU3243
+	call	serialize8
+.LVL609:
+	.loc 1 423 5 is_stmt 1 view .LVU3244
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL610:
+	.loc 1 423 5 is_stmt 0 view .LVU3245
+.LBE1619:
+.LBE1618:
+	.loc 1 1161 5 is_stmt 1 view .LVU3246
+	.loc 1 1161 44 is_stmt 0 view .LVU3247
+	movzwl	242+masterConfig(%rip), %ebx
+.LVL611:
+.LBB1620:
+.LBI1620:
+	.loc 1 420 6 is_stmt 1 view .LVU3248
+.LBB1621:
+	.loc 1 422 5 view .LVU3249
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3250
+	sarw	$8, %bx
+.LVL612:
+	.loc 1 422 5 view .LVU3251
+	call	serialize8
+.LVL613:
+	.loc 1 423 5 is_stmt 1 view .LVU3252
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL614:
+	.loc 1 423 5 is_stmt 0 view .LVU3253
+.LBE1621:
+.LBE1620:
+	.loc 1 1162 5 is_stmt 1 view .LVU3254
+	.loc 1 1162 44 is_stmt 0 view .LVU3255
+	movzwl	244+masterConfig(%rip), %ebx
+.LVL615:
+.LBB1622:
+.LBI1622:
+	.loc 1 420 6 is_stmt 1 view .LVU3256
+.LBB1623:
+	.loc 1 422 5 view .LVU3257
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3258
+	sarw	$8, %bx
+.LVL616:
+	.loc 1 422 5 view .LVU3259
+	call	serialize8
+.LVL617:
+	.loc 1 423 5 is_stmt 1 view .LVU3260
+	movzbl	%bl, %edi
+	call	serialize8
+.LVL618:
+	.loc 1 423 5 is_stmt 0 view .LVU3261
+.LBE1623:
+.LBE1622:
+	.loc 1 1163 5 is_stmt 1 view .LVU3262
+	.loc 1 1164 1 is_stmt 0 view .LVU3263
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	mspBoardAlignment, .-mspBoardAlignment
+	.section	.text.mspFeature,"ax",@progbits
+	.p2align 4
+	.type	mspFeature, @function
+mspFeature:
+.LFB54:
+	.loc 1 1151 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1152 5 view .LVU3265
+.LVL619:
+.LBB1632:
+.LBI1632:
+	.loc 1 497 6 view .LVU3266
+.LBB1633:
+	.loc 1 499 5 view .LVU3267
+.LBE1633:
+.LBE1632:
+	.loc 1 1151 1 is_stmt 0 view .LVU3268
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1635:
+.LBB1634:
+	.loc 1 499 5 view .LVU3269
+	movl	$4, %esi
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL620:
+	.loc 1 499 5 view .LVU3270
+.LBE1634:
+.LBE1635:
+	.loc 1 1153 5 is_stmt 1 view .LVU3271
+	call	featureMask@PLT
+.LVL621:
+	movl	%eax, %ebx
+.LVL622:
+.LBB1636:
+.LBI1636:
+	.loc 1 426 6 view .LVU3272
+.LBB1637:
+	.loc 1 428 5 view .LVU3273
+.LBB1638:
+.LBI1638:
+	.loc 1 420 6 view .LVU3274
+.LBB1639:
+	.loc 1 422 5 view .LVU3275
+	movzbl	%al, %edi
+	call	serialize8
+.LVL623:
+	.loc 1 423 5 view .LVU3276
+	movzbl	%bh, %edi
+.LBE1639:
+.LBE1638:
+	.loc 1 429 27 is_stmt 0 view .LVU3277
+	shrl	$16, %ebx
+.LVL624:
+.LBB1641:
+.LBB1640:
+	.loc 1 423 5 view .LVU3278
+	call	serialize8
+.LVL625:
+	.loc 1 423 5 view .LVU3279
+.LBE1640:
+.LBE1641:
+	.loc 1 429 5 is_stmt 1 view .LVU3280
+.LBB1642:
+.LBI1642:
+	.loc 1 420 6 view .LVU3281
+.LBB1643:
+	.loc 1 422 5 view .LVU3282
+	movzbl	%bl, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3283
+	shrl	$8, %ebx
+.LVL626:
+	.loc 1 422 5 view .LVU3284
+	call	serialize8
+.LVL627:
+	.loc 1 423 5 is_stmt 1 view .LVU3285
+	movl	%ebx, %edi
+	call	serialize8
+.LVL628:
+	.loc 1 423 5 is_stmt 0 view .LVU3286
+.LBE1643:
+.LBE1642:
+.LBE1637:
+.LBE1636:
+	.loc 1 1154 5 is_stmt 1 view .LVU3287
+	.loc 1 1155 1 is_stmt 0 view .LVU3288
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE54:
+	.size	mspFeature, .-mspFeature
+	.section	.text.mspModeRanges,"ax",@progbits
+	.p2align 4
+	.type	mspModeRanges, @function
+mspModeRanges:
+.LFB45:
+	.loc 1 964 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 965 5 view .LVU3290
+	.loc 1 967 5 view .LVU3291
+.LVL629:
+.LBB1644:
+.LBI1644:
+	.loc 1 497 6 view .LVU3292
+.LBB1645:
+	.loc 1 499 5 view .LVU3293
+.LBE1645:
+.LBE1644:
+	.loc 1 964 1 is_stmt 0 view .LVU3294
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB1648:
+.LBB1646:
+	.loc 1 499 5 view .LVU3295
+	movl	$160, %esi
+	xorl	%edi, %edi
+	leaq	boxes(%rip), %r12
+.LBE1646:
+.LBE1648:
+	.loc 1 964 1 view .LVU3296
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	.loc 1 968 12 view .LVU3297
+	xorl	%ebp, %ebp
+	.loc 1 964 1 view .LVU3298
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB1649:
+.LBB1647:
+	.loc 1 499 5 view .LVU3299
+	call	headSerialResponse
+.LVL630:
+	.loc 1 499 5 view .LVU3300
+.LBE1647:
+.LBE1649:
+	.loc 1 968 5 is_stmt 1 view .LVU3301
+	.loc 1 968 19 view .LVU3302
+	.p2align 4,,10
+	.p2align 3
+.L441:
+.LBB1650:
+	.loc 1 969 9 discriminator 3 view .LVU3303
+	.loc 1 970 9 discriminator 3 view .LVU3304
+	movq	currentProfile(%rip), %rax
+	movl	%ebp, %edx
+.LVL631:
+	.loc 1 970 9 is_stmt 0 discriminator 3 view .LVU3305
+.LBE1650:
+	.loc 1 968 26 discriminator 3 view .LVU3306
+	addl	$1, %ebp
+.LVL632:
+	.loc 1 968 26 discriminator 3 view .LVU3307
+	leaq	(%rax,%rdx,8), %rbx
+.LVL633:
+.LBB1651:
+	.loc 1 971 9 is_stmt 1 discriminator 3 view .LVU3308
+	.loc 1 971 23 is_stmt 0 discriminator 3 view .LVU3309
+	movl	132(%rbx), %eax
+	leaq	(%rax,%rax,2), %rax
+	.loc 1 971 9 discriminator 3 view .LVU3310
+	movzbl	16(%r12,%rax,8), %edi
+	call	serialize8
+.LVL634:
+	.loc 1 972 9 is_stmt 1 discriminator 3 view .LVU3311
+	movzbl	136(%rbx), %edi
+	call	serialize8
+.LVL635:
+	.loc 1 973 9 discriminator 3 view .LVU3312
+	movzbl	137(%rbx), %edi
+	call	serialize8
+.LVL636:
+	.loc 1 974 9 discriminator 3 view .LVU3313
+	movzbl	138(%rbx), %edi
+	call	serialize8
+.LVL637:
+.LBE1651:
+	.loc 1 968 26 discriminator 3 view .LVU3314
+	.loc 1 968 19 discriminator 3 view .LVU3315
+	cmpl	$40, %ebp
+	jne	.L441
+	.loc 1 976 5 view .LVU3316
+	.loc 1 977 1 is_stmt 0 view .LVU3317
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL638:
+	.loc 1 977 1 view .LVU3318
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	mspModeRanges, .-mspModeRanges
+	.section	.text.mspChannelForwarding,"ax",@progbits
+	.p2align 4
+	.type	mspChannelForwarding, @function
+mspChannelForwarding:
+.LFB36:
+	.loc 1 853 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 854 5 view .LVU3320
+	.loc 1 856 5 view .LVU3321
+.LVL639:
+.LBB1652:
+.LBI1652:
+	.loc 1 497 6 view .LVU3322
+.LBB1653:
+	.loc 1 499 5 view .LVU3323
+.LBE1653:
+.LBE1652:
+	.loc 1 853 1 is_stmt 0 view .LVU3324
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1656:
+.LBB1654:
+	.loc 1 499 5 view .LVU3325
+	movl	$8, %esi
+	xorl	%edi, %edi
+.LBE1654:
+.LBE1656:
+	.loc 1 857 12 view .LVU3326
+	xorl	%ebx, %ebx
+.LBB1657:
+.LBB1655:
+	.loc 1 499 5 view .LVU3327
+	call	headSerialResponse
+.LVL640:
+	.loc 1 499 5 view .LVU3328
+.LBE1655:
+.LBE1657:
+	.loc 1 857 5 is_stmt 1 view .LVU3329
+	.loc 1 857 19 view .LVU3330
+	.p2align 4,,10
+	.p2align 3
+.L445:
+	.loc 1 858 9 discriminator 3 view .LVU3331
+	movq	currentProfile(%rip), %rax
+	.loc 1 858 48 is_stmt 0 discriminator 3 view .LVU3332
+	movl	%ebx, %edx
+	.loc 1 857 25 discriminator 3 view .LVU3333
+	addl	$1, %ebx
+.LVL641:
+	.loc 1 858 9 discriminator 3 view .LVU3334
+	movzbl	467(%rax,%rdx,8), %edi
+	call	serialize8
+.LVL642:
+	.loc 1 857 25 is_stmt 1 discriminator 3 view .LVU3335
+	.loc 1 857 19 discriminator 3 view .LVU3336
+	cmpl	$8, %ebx
+	jne	.L445
+	.loc 1 860 5 view .LVU3337
+	.loc 1 861 1 is_stmt 0 view .LVU3338
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL643:
+	.loc 1 861 1 view .LVU3339
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	mspChannelForwarding, .-mspChannelForwarding
+	.section	.text.mspApiVersion,"ax",@progbits
+	.p2align 4
+	.type	mspApiVersion, @function
+mspApiVersion:
+.LFB30:
+	.loc 1 697 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 698 5 view .LVU3341
+	.loc 1 702 5 view .LVU3342
+.LVL644:
+.LBB1658:
+.LBI1658:
+	.loc 1 497 6 view .LVU3343
+.LBB1659:
+	.loc 1 499 5 view .LVU3344
+.LBE1659:
+.LBE1658:
+	.loc 1 697 1 is_stmt 0 view .LVU3345
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1662:
+.LBB1660:
+	.loc 1 499 5 view .LVU3346
+	movl	$44, %esi
+	xorl	%edi, %edi
+.LBE1660:
+.LBE1662:
+	.loc 1 727 5 view .LVU3347
+	xorl	%ebx, %ebx
+.LBB1663:
+.LBB1661:
+	.loc 1 499 5 view .LVU3348
+	call	headSerialResponse
+.LVL645:
+	.loc 1 499 5 view .LVU3349
+.LBE1661:
+.LBE1663:
+	.loc 1 716 5 is_stmt 1 view .LVU3350
+	xorl	%edi, %edi
+	call	serialize8
+.LVL646:
+	.loc 1 718 5 view .LVU3351
+	movl	$1, %edi
+	call	serialize8
+.LVL647:
+	.loc 1 719 5 view .LVU3352
+	movl	$2, %edi
+	call	serialize8
+.LVL648:
+	.loc 1 721 5 view .LVU3353
+	.loc 1 721 19 view .LVU3354
+	.loc 1 722 9 view .LVU3355
+	movl	$67, %edi
+	call	serialize8
+.LVL649:
+	.loc 1 721 25 view .LVU3356
+	.loc 1 721 19 view .LVU3357
+	.loc 1 722 9 view .LVU3358
+	movl	$76, %edi
+	call	serialize8
+.LVL650:
+	.loc 1 721 25 view .LVU3359
+	.loc 1 721 19 view .LVU3360
+	.loc 1 722 9 view .LVU3361
+	movl	$70, %edi
+	call	serialize8
+.LVL651:
+	.loc 1 721 25 view .LVU3362
+	.loc 1 721 19 view .LVU3363
+	.loc 1 722 9 view .LVU3364
+	movl	$76, %edi
+	call	serialize8
+.LVL652:
+	.loc 1 721 25 view .LVU3365
+	.loc 1 721 19 view .LVU3366
+	.loc 1 725 5 view .LVU3367
+	movl	$1, %edi
+	call	serialize8
+.LVL653:
+	.loc 1 726 5 view .LVU3368
+	xorl	%edi, %edi
+	call	serialize8
+.LVL654:
+	.loc 1 727 5 view .LVU3369
+	xorl	%edi, %edi
+	call	serialize8
+.LVL655:
+	.loc 1 729 5 view .LVU3370
+	.loc 1 729 19 view .LVU3371
+.L449:
+	.loc 1 730 9 discriminator 3 view .LVU3372
+	.loc 1 730 35 is_stmt 0 discriminator 3 view .LVU3373
+	movq	boardIdentifier(%rip), %rax
+	.loc 1 730 9 discriminator 3 view .LVU3374
+	movzbl	(%rax,%rbx), %edi
+	.loc 1 729 19 discriminator 3 view .LVU3375
+	addq	$1, %rbx
+.LVL656:
+	.loc 1 730 9 discriminator 3 view .LVU3376
+	call	serialize8
+.LVL657:
+	.loc 1 729 25 is_stmt 1 discriminator 3 view .LVU3377
+	.loc 1 729 19 discriminator 3 view .LVU3378
+	cmpq	$4, %rbx
+	jne	.L449
+	.loc 1 735 5 view .LVU3379
+.LVL658:
+.LBB1664:
+.LBI1664:
+	.loc 1 420 6 view .LVU3380
+.LBB1665:
+	.loc 1 422 5 view .LVU3381
+	xorl	%edi, %edi
+	.loc 1 423 5 is_stmt 0 view .LVU3382
+	xorl	%ebx, %ebx
+	.loc 1 422 5 view .LVU3383
+	call	serialize8
+.LVL659:
+	.loc 1 423 5 is_stmt 1 view .LVU3384
+	xorl	%edi, %edi
+	call	serialize8
+.LVL660:
+	.loc 1 423 5 is_stmt 0 view .LVU3385
+.LBE1665:
+.LBE1664:
+	.loc 1 738 5 is_stmt 1 view .LVU3386
+	.loc 1 738 19 view .LVU3387
+	.p2align 4,,10
+	.p2align 3
+.L450:
+	.loc 1 739 9 discriminator 3 view .LVU3388
+	.loc 1 739 29 is_stmt 0 discriminator 3 view .LVU3389
+	movq	buildDate(%rip), %rax
+	.loc 1 739 9 discriminator 3 view .LVU3390
+	movzbl	(%rax,%rbx), %edi
+	.loc 1 738 19 discriminator 3 view .LVU3391
+	addq	$1, %rbx
+.LVL661:
+	.loc 1 739 9 discriminator 3 view .LVU3392
+	call	serialize8
+.LVL662:
+	.loc 1 738 26 is_stmt 1 discriminator 3 view .LVU3393
+	.loc 1 738 19 discriminator 3 view .LVU3394
+	cmpq	$11, %rbx
+	jne	.L450
+	xorl	%ebx, %ebx
+	.p2align 4,,10
+	.p2align 3
+.L451:
+.LVL663:
+	.loc 1 742 9 discriminator 3 view .LVU3395
+	.loc 1 742 29 is_stmt 0 discriminator 3 view .LVU3396
+	movq	buildTime(%rip), %rax
+	.loc 1 742 9 discriminator 3 view .LVU3397
+	movzbl	(%rax,%rbx), %edi
+	.loc 1 741 19 discriminator 3 view .LVU3398
+	addq	$1, %rbx
+.LVL664:
+	.loc 1 742 9 discriminator 3 view .LVU3399
+	call	serialize8
+.LVL665:
+	.loc 1 741 25 is_stmt 1 discriminator 3 view .LVU3400
+	.loc 1 741 19 discriminator 3 view .LVU3401
+	cmpq	$8, %rbx
+	jne	.L451
+	.loc 1 745 5 view .LVU3402
+	movl	$7, %edi
+	xorl	%ebx, %ebx
+	call	serialize8
+.LVL666:
+	.loc 1 746 5 view .LVU3403
+	.loc 1 746 19 view .LVU3404
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	.loc 1 747 9 discriminator 3 view .LVU3405
+	.loc 1 747 36 is_stmt 0 discriminator 3 view .LVU3406
+	movq	shortGitRevision(%rip), %rax
+	.loc 1 747 9 discriminator 3 view .LVU3407
+	movzbl	(%rax,%rbx), %edi
+	.loc 1 746 19 discriminator 3 view .LVU3408
+	addq	$1, %rbx
+.LVL667:
+	.loc 1 747 9 discriminator 3 view .LVU3409
+	call	serialize8
+.LVL668:
+	.loc 1 746 25 is_stmt 1 discriminator 3 view .LVU3410
+	.loc 1 746 19 discriminator 3 view .LVU3411
+	cmpq	$7, %rbx
+	jne	.L452
+	.loc 1 749 5 view .LVU3412
+	xorl	%edi, %edi
+	call	serialize8
+.LVL669:
+	.loc 1 750 5 view .LVU3413
+	.loc 1 751 1 is_stmt 0 view .LVU3414
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	mspApiVersion, .-mspApiVersion
+	.section	.text.processBatchEntry,"ax",@progbits
+	.p2align 4
+	.type	processBatchEntry, @function
+processBatchEntry:
+.LVL670:
+.LFB84:
+	.loc 1 1571 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1572 5 view .LVU3416
+	.loc 1 1572 52 is_stmt 0 view .LVU3417
+	movzwl	%di, %eax
+	.loc 1 1572 38 view .LVU3418
+	movq	currentPort(%rip), %rdx
+.LBB1675:
+.LBB1676:
+.LBB1677:
+.LBB1678:
+	.loc 1 1815 13 view .LVU3419
+	xorl	%esi, %esi
+.LBB1679:
+	.loc 1 1820 32 view .LVU3420
+	leaq	mspCommands(%rip), %r9
+.LBE1679:
+.LBE1678:
+.LBE1677:
+.LBE1676:
+.LBE1675:
+	.loc 1 1572 52 view .LVU3421
+	addl	%eax, %eax
+	.loc 1 1572 89 view .LVU3422
+	leal	1(%rax), %ecx
+	.loc 1 1572 45 view .LVU3423
+	cltq
+	.loc 1 1572 78 view .LVU3424
+	movslq	%ecx, %rcx
+	.loc 1 1572 45 view .LVU3425
+	movzbl	54(%rdx,%rax), %edi
+.LVL671:
+	.loc 1 1573 24 view .LVU3426
+	movzwl	48(%rdx), %eax
+	.loc 1 1572 78 view .LVU3427
+	movzbl	54(%rdx,%rcx), %ecx
+	.loc 1 1573 24 view .LVU3428
+	movw	%ax, 52(%rdx)
+	.loc 1 1572 94 view .LVU3429
+	sall	$8, %ecx
+	.loc 1 1572 57 view .LVU3430
+	orl	%ecx, %edi
+.LBB1697:
+.LBB1692:
+.LBB1687:
+.LBB1682:
+	.loc 1 1816 13 view .LVU3431
+	movl	$57, %ecx
+.LBE1682:
+.LBE1687:
+.LBE1692:
+.LBE1697:
+	.loc 1 1572 25 view .LVU3432
+	movw	%di, 310(%rdx)
+	.loc 1 1573 5 is_stmt 1 view .LVU3433
+	.loc 1 1575 5 view .LVU3434
+.LVL672:
+.LBB1698:
+.LBI1675:
+	.loc 1 1872 12 view .LVU3435
+.LBB1693:
+	.loc 1 1874 5 view .LVU3436
+.LBB1688:
+.LBI1677:
+	.loc 1 1813 28 view .LVU3437
+.L459:
+.LBB1683:
+.LBB1680:
+	.loc 1 1819 31 is_stmt 0 view .LVU3438
+	movzbl	%sil, %r8d
+	jmp	.L460
+.LVL673:
+	.p2align 4,,10
+	.p2align 3
+.L461:
+	.loc 1 1819 9 is_stmt 1 view .LVU3439
+	.loc 1 1819 31 is_stmt 0 view .LVU3440
+	movzbl	%cl, %eax
+	addl	%r8d, %eax
+	.loc 1 1819 39 view .LVU3441
+	sarl	%eax
+.LVL674:
+	.loc 1 1820 9 is_stmt 1 view .LVU3442
+	.loc 1 1820 32 is_stmt 0 view .LVU3443
+	movslq	%eax, %rdx
+	salq	$4, %rdx
+	.loc 1 1820 12 view .LVU3444
+	cmpw	%di, (%r9,%rdx)
+	jb	.L472
+	.loc 1 1819 17 view .LVU3445
+	movl	%eax, %ecx
+.LVL675:
+.L460:
+	.loc 1 1819 17 view .LVU3446
+.LBE1680:
+	.loc 1 1818 16 is_stmt 1 view .LVU3447
+	cmpb	%cl, %sil
+	jb	.L461
+	.loc 1 1827 5 view .LVU3448
+	.loc 1 1827 8 is_stmt 0 view .LVU3449
+	cmpb	$57, %sil
+	je	.L469
+	.loc 1 1827 81 view .LVU3450
+	movzbl	%sil, %eax
+	leaq	mspCommands(%rip), %rdx
+	salq	$4, %rax
+	addq	%rdx, %rax
+	.loc 1 1827 62 view .LVU3451
+	cmpw	(%rax), %di
+	je	.L473
+.LVL676:
+.L469:
+	.loc 1 1827 62 view .LVU3452
+.LBE1683:
+.LBE1688:
+.LBE1693:
+.LBE1698:
+.LBB1699:
+.LBI1699:
+	.loc 1 1570 13 is_stmt 1 view .LVU3453
+.LBB1700:
+	.loc 1 1576 9 view .LVU3454
+.LBB1701:
+.LBI1701:
+	.loc 1 502 6 view .LVU3455
+.LBB1702:
+	.loc 1 504 5 view .LVU3456
+	xorl	%esi, %esi
+	movl	$1, %edi
+	jmp	headSerialResponse
+.LVL677:
+	.p2align 4,,10
+	.p2align 3
+.L473:
+	.loc 1 504 5 is_stmt 0 view .LVU3457
+.LBE1702:
+.LBE1701:
+.LBE1700:
+.LBE1699:
+.LBB1709:
+.LBB1694:
+.LBB1689:
+.LBB1684:
+	.loc 1 1828 9 is_stmt 1 view .LVU3458
+	.loc 1 1828 9 is_stmt 0 view .LVU3459
+.LBE1684:
+.LBE1689:
+	.loc 1 1876 5 is_stmt 1 view .LVU3460
+	.loc 1 1876 18 is_stmt 0 view .LVU3461
+	cmpb	$0, 2(%rax)
+	jne	.L469
+	.loc 1 1879 5 is_stmt 1 view .LVU3462
+.LBE1694:
+.LBE1709:
+	.loc 1 1571 1 is_stmt 0 view .LVU3463
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1710:
+.LBB1695:
+.LBB1690:
+.LBB1685:
+	.loc 1 1828 16 view .LVU3464
+	movq	%rax, %rdi
+.LVL678:
+	.loc 1 1828 16 view .LVU3465
+.LBE1685:
+.LBE1690:
+	.loc 1 1879 12 view .LVU3466
+	call	processCommand
+.LVL679:
+	.loc 1 1879 12 view .LVU3467
+.LBE1695:
+.LBE1710:
+	.loc 1 1575 8 view .LVU3468
+	testb	%al, %al
+	je	.L463
+	.loc 1 1578 1 view .LVU3469
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL680:
+	.p2align 4,,10
+	.p2align 3
+.L472:
+.LBB1711:
+.LBB1696:
+.LBB1691:
+.LBB1686:
+.LBB1681:
+	.loc 1 1821 13 is_stmt 1 view .LVU3470
+	.loc 1 1821 17 is_stmt 0 view .LVU3471
+	leal	1(%rax), %esi
+.LVL681:
+	.loc 1 1821 17 view .LVU3472
+	jmp	.L459
+.LVL682:
+.L463:
+	.cfi_def_cfa_offset 16
+	.loc 1 1821 17 view .LVU3473
+.LBE1681:
+.LBE1686:
+.LBE1691:
+.LBE1696:
+.LBE1711:
+.LBB1712:
+	.loc 1 1570 13 is_stmt 1 view .LVU3474
+.LBB1707:
+	.loc 1 1576 9 view .LVU3475
+.LBB1705:
+	.loc 1 502 6 view .LVU3476
+.LBB1703:
+	.loc 1 504 5 view .LVU3477
+	xorl	%esi, %esi
+	movl	$1, %edi
+.LBE1703:
+.LBE1705:
+.LBE1707:
+.LBE1712:
+	.loc 1 1578 1 is_stmt 0 view .LVU3478
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+.LBB1713:
+.LBB1708:
+.LBB1706:
+.LBB1704:
+	.loc 1 504 5 view .LVU3479
+	jmp	headSerialResponse
+.LVL683:
+.LBE1704:
+.LBE1706:
+.LBE1708:
+.LBE1713:
+	.cfi_endproc
+.LFE84:
+	.size	processBatchEntry, .-processBatchEntry
+	.section	.text.mspBatch,"ax",@progbits
+	.p2align 4
+	.type	mspBatch, @function
+mspBatch:
+.LFB85:
+	.loc 1 1587 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1588 5 view .LVU3481
+	.loc 1 1587 1 is_stmt 0 view .LVU3482
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 1588 40 view .LVU3483
+	movq	currentPort(%rip), %rax
+	.loc 1 1590 26 view .LVU3484
+	movq	mspSerialPort(%rip), %rdi
+	.loc 1 1588 40 view .LVU3485
+	movzwl	48(%rax), %r15d
+.LVL684:
+	.loc 1 1589 5 is_stmt 1 view .LVU3486
+	.loc 1 1590 5 view .LVU3487
+	.loc 1 1590 26 is_stmt 0 view .LVU3488
+	call	serialTxBytesFree@PLT
+.LVL685:
+	.loc 1 1591 5 is_stmt 1 view .LVU3489
+	.loc 1 1593 5 view .LVU3490
+	.loc 1 1593 20 is_stmt 0 view .LVU3491
+	movq	currentPort(%rip), %rdx
+	xorl	%ecx, %ecx
+	movl	336(%rdx), %ebp
+	.loc 1 1593 8 view .LVU3492
+	testl	%ebp, %ebp
+	jne	.L474
+	.loc 1 1597 5 is_stmt 1 view .LVU3493
+	.loc 1 1597 47 is_stmt 0 view .LVU3494
+	movl	$9, %ecx
+	cmpl	%ecx, %eax
+	cmovb	%ecx, %eax
+.LVL686:
+	.loc 1 1602 37 view .LVU3495
+	shrw	%r15w
+.LVL687:
+	.loc 1 1597 15 view .LVU3496
+	leal	-9(%rax), %r14d
+.LVL688:
+	.loc 1 1600 5 is_stmt 1 view .LVU3497
+	.loc 1 1601 5 view .LVU3498
+	.loc 1 1600 29 is_stmt 0 view .LVU3499
+	movq	.LC4(%rip), %rax
+	movq	%rax, 336(%rdx)
+	.loc 1 1602 5 is_stmt 1 view .LVU3500
+.LVL689:
+	.loc 1 1602 37 view .LVU3501
+	je	.L476
+	movzwl	%r15w, %r15d
+	.loc 1 1602 37 is_stmt 0 view .LVU3502
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	jmp	.L480
+.LVL690:
+	.p2align 4,,10
+	.p2align 3
+.L477:
+	.loc 1 1602 63 is_stmt 1 discriminator 2 view .LVU3503
+	.loc 1 1602 37 discriminator 2 view .LVU3504
+	addl	$1, %ebx
+.LVL691:
+	.loc 1 1602 37 is_stmt 0 discriminator 2 view .LVU3505
+	cmpl	%r15d, %ebx
+	je	.L489
+.LVL692:
+.L480:
+	.loc 1 1604 9 view .LVU3506
+	movl	%ebx, %edi
+	movl	%ebx, %r13d
+.LVL693:
+	.loc 1 1603 9 is_stmt 1 view .LVU3507
+	.loc 1 1604 9 view .LVU3508
+	call	processBatchEntry
+.LVL694:
+	.loc 1 1605 9 view .LVU3509
+	.loc 1 1605 24 is_stmt 0 view .LVU3510
+	movq	currentPort(%rip), %rax
+	movl	%r12d, %esi
+	movl	340(%rax), %r12d
+	.loc 1 1605 12 view .LVU3511
+	cmpl	%r12d, %r14d
+	jnb	.L477
+	.loc 1 1606 13 is_stmt 1 view .LVU3512
+	.loc 1 1613 25 is_stmt 0 view .LVU3513
+	movl	$4096, %edi
+	.loc 1 1606 36 view .LVU3514
+	movl	%esi, 340(%rax)
+	.loc 1 1607 13 is_stmt 1 view .LVU3515
+	.loc 1 1610 5 view .LVU3516
+.LVL695:
+	.loc 1 1612 5 view .LVU3517
+	.loc 1 1614 5 is_stmt 0 view .LVU3518
+	movzwl	%si, %esi
+	.loc 1 1613 25 view .LVU3519
+	movw	%di, 310(%rax)
+.LBB1714:
+.LBB1715:
+	.loc 1 499 5 view .LVU3520
+	xorl	%edi, %edi
+.LBE1715:
+.LBE1714:
+	.loc 1 1612 29 view .LVU3521
+	movl	$0, 336(%rax)
+.LVL696:
+	.loc 1 1613 5 is_stmt 1 view .LVU3522
+	.loc 1 1614 5 view .LVU3523
+.LBB1721:
+.LBI1714:
+	.loc 1 497 6 view .LVU3524
+.LBB1716:
+	.loc 1 499 5 view .LVU3525
+	call	headSerialResponse
+.LVL697:
+	.loc 1 499 5 is_stmt 0 view .LVU3526
+.LBE1716:
+.LBE1721:
+	.loc 1 1616 5 is_stmt 1 view .LVU3527
+	.loc 1 1616 16 is_stmt 0 view .LVU3528
+	movq	currentPort(%rip), %rax
+	.loc 1 1616 29 view .LVU3529
+	movl	$2, 336(%rax)
+	.loc 1 1617 5 is_stmt 1 view .LVU3530
+.LBB1722:
+	.loc 1 1617 10 view .LVU3531
+.LVL698:
+	.loc 1 1617 36 view .LVU3532
+	testw	%bx, %bx
+	je	.L479
+.LVL699:
+.L478:
+	.loc 1 1617 36 is_stmt 0 view .LVU3533
+	movzwl	%r13w, %r13d
+.LVL700:
+	.p2align 4,,10
+	.p2align 3
+.L482:
+	.loc 1 1618 9 is_stmt 1 discriminator 3 view .LVU3534
+	movl	%ebp, %edi
+	.loc 1 1617 36 is_stmt 0 discriminator 3 view .LVU3535
+	addl	$1, %ebp
+.LVL701:
+	.loc 1 1618 9 discriminator 3 view .LVU3536
+	call	processBatchEntry
+.LVL702:
+	.loc 1 1617 55 is_stmt 1 discriminator 3 view .LVU3537
+	.loc 1 1617 36 discriminator 3 view .LVU3538
+	cmpl	%ebp, %r13d
+	jne	.L482
+.LBE1722:
+	.loc 1 1621 16 is_stmt 0 view .LVU3539
+	movq	currentPort(%rip), %rax
+.LVL703:
+.L479:
+	.loc 1 1621 5 is_stmt 1 view .LVU3540
+	.loc 1 1622 25 is_stmt 0 view .LVU3541
+	movl	$4096, %esi
+	.loc 1 1623 11 view .LVU3542
+	movl	$1, %ecx
+	.loc 1 1621 29 view .LVU3543
+	movl	$0, 336(%rax)
+	.loc 1 1622 5 is_stmt 1 view .LVU3544
+	.loc 1 1622 25 is_stmt 0 view .LVU3545
+	movw	%si, 310(%rax)
+	.loc 1 1623 5 is_stmt 1 view .LVU3546
+.LVL704:
+.L474:
+	.loc 1 1624 1 is_stmt 0 view .LVU3547
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ecx, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL705:
+	.p2align 4,,10
+	.p2align 3
+.L489:
+	.cfi_restore_state
+	.loc 1 1613 25 view .LVU3548
+	movl	$4096, %edx
+	.loc 1 1614 5 view .LVU3549
+	movzwl	%r12w, %esi
+.LBB1723:
+.LBB1717:
+	.loc 1 499 5 view .LVU3550
+	xorl	%edi, %edi
+.LBE1717:
+.LBE1723:
+	.loc 1 1602 63 view .LVU3551
+	addl	$1, %r13d
+.LVL706:
+	.loc 1 1610 5 is_stmt 1 view .LVU3552
+	.loc 1 1612 5 view .LVU3553
+	.loc 1 1612 29 is_stmt 0 view .LVU3554
+	movl	$0, 336(%rax)
+.LVL707:
+	.loc 1 1613 5 is_stmt 1 view .LVU3555
+	.loc 1 1613 25 is_stmt 0 view .LVU3556
+	movw	%dx, 310(%rax)
+	.loc 1 1614 5 is_stmt 1 view .LVU3557
+.LVL708:
+.LBB1724:
+	.loc 1 497 6 view .LVU3558
+.LBB1718:
+	.loc 1 499 5 view .LVU3559
+	call	headSerialResponse
+.LVL709:
+	.loc 1 499 5 is_stmt 0 view .LVU3560
+.LBE1718:
+.LBE1724:
+	.loc 1 1616 5 is_stmt 1 view .LVU3561
+	.loc 1 1616 29 is_stmt 0 view .LVU3562
+	movq	currentPort(%rip), %rax
+	movl	$2, 336(%rax)
+	.loc 1 1617 5 is_stmt 1 view .LVU3563
+.LBB1725:
+	.loc 1 1617 10 view .LVU3564
+.LVL710:
+	.loc 1 1617 36 view .LVU3565
+	jmp	.L478
+.LVL711:
+.L476:
+	.loc 1 1617 36 is_stmt 0 view .LVU3566
+.LBE1725:
+	.loc 1 1610 5 is_stmt 1 view .LVU3567
+	.loc 1 1612 5 view .LVU3568
+	.loc 1 1613 25 is_stmt 0 view .LVU3569
+	movl	$4096, %ecx
+.LBB1726:
+.LBB1719:
+	.loc 1 499 5 view .LVU3570
+	xorl	%esi, %esi
+	xorl	%edi, %edi
+.LBE1719:
+.LBE1726:
+	.loc 1 1612 29 view .LVU3571
+	movl	$0, 336(%rdx)
+	.loc 1 1613 5 is_stmt 1 view .LVU3572
+	.loc 1 1613 25 is_stmt 0 view .LVU3573
+	movw	%cx, 310(%rdx)
+	.loc 1 1614 5 is_stmt 1 view .LVU3574
+.LVL712:
+.LBB1727:
+	.loc 1 497 6 view .LVU3575
+.LBB1720:
+	.loc 1 499 5 view .LVU3576
+	call	headSerialResponse
+.LVL713:
+	.loc 1 499 5 is_stmt 0 view .LVU3577
+.LBE1720:
+.LBE1727:
+	.loc 1 1616 5 is_stmt 1 view .LVU3578
+	.loc 1 1616 16 is_stmt 0 view .LVU3579
+	movq	currentPort(%rip), %rax
+	.loc 1 1616 29 view .LVU3580
+	movl	$2, 336(%rax)
+	.loc 1 1617 5 is_stmt 1 view .LVU3581
+.LBB1728:
+	.loc 1 1617 10 view .LVU3582
+.LVL714:
+	.loc 1 1617 36 view .LVU3583
+	jmp	.L479
+.LBE1728:
+	.cfi_endproc
+.LFE85:
+	.size	mspBatch, .-mspBatch
+	.section	.text.mspPidNames,"ax",@progbits
+	.p2align 4
+	.type	mspPidNames, @function
+mspPidNames:
+.LFB44:
+	.loc 1 957 1 view -0
+	.cfi_startproc
+	.loc 1 958 5 view .LVU3585
+.LVL715:
+.LBB1733:
+.LBI1733:
+	.loc 1 497 6 view .LVU3586
+.LBB1734:
+	.loc 1 499 5 view .LVU3587
+.LBE1734:
+.LBE1733:
+	.loc 1 957 1 is_stmt 0 view .LVU3588
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB1737:
+.LBB1735:
+	.loc 1 499 5 view .LVU3589
+	xorl	%edi, %edi
+	movl	$47, %esi
+.LBE1735:
+.LBE1737:
+.LBB1738:
+.LBB1739:
+	.loc 1 524 12 view .LVU3590
+	leaq	pidnames(%rip), %rbx
+.LBE1739:
+.LBE1738:
+.LBB1741:
+.LBB1736:
+	.loc 1 499 5 view .LVU3591
+	call	headSerialResponse
+.LVL716:
+	.loc 1 499 5 view .LVU3592
+.LBE1736:
+.LBE1741:
+	.loc 1 959 5 is_stmt 1 view .LVU3593
+.LBB1742:
+.LBI1738:
+	.loc 1 521 6 view .LVU3594
+.LBB1740:
+	.loc 1 523 5 view .LVU3595
+	.loc 1 524 5 view .LVU3596
+	.loc 1 524 17 view .LVU3597
+	movl	$82, %edi
+.LVL717:
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	.loc 1 525 9 view .LVU3598
+	call	serialize8
+.LVL718:
+	.loc 1 524 22 view .LVU3599
+	.loc 1 524 17 is_stmt 0 view .LVU3600
+	movzbl	1(%rbx), %edi
+	.loc 1 524 22 view .LVU3601
+	addq	$1, %rbx
+.LVL719:
+	.loc 1 524 17 is_stmt 1 view .LVU3602
+	testb	%dil, %dil
+	jne	.L491
+.LVL720:
+	.loc 1 524 17 is_stmt 0 view .LVU3603
+.LBE1740:
+.LBE1742:
+	.loc 1 960 5 is_stmt 1 view .LVU3604
+	.loc 1 961 1 is_stmt 0 view .LVU3605
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	mspPidNames, .-mspPidNames
+	.section	.text.mspBoxIds,"ax",@progbits
+	.p2align 4
+	.type	mspBoxIds, @function
+mspBoxIds:
+.LFB47:
+	.loc 1 987 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 988 5 view .LVU3607
+	.loc 1 990 5 view .LVU3608
+.LVL721:
+.LBB1743:
+.LBI1743:
+	.loc 1 497 6 view .LVU3609
+.LBB1744:
+	.loc 1 499 5 view .LVU3610
+.LBE1744:
+.LBE1743:
+	.loc 1 987 1 is_stmt 0 view .LVU3611
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 990 5 view .LVU3612
+	movzbl	activeBoxIdCount(%rip), %esi
+.LBB1747:
+.LBB1745:
+	.loc 1 499 5 view .LVU3613
+	xorl	%edi, %edi
+.LBE1745:
+.LBE1747:
+	.loc 1 987 1 view .LVU3614
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB1748:
+.LBB1746:
+	.loc 1 499 5 view .LVU3615
+	call	headSerialResponse
+.LVL722:
+	.loc 1 499 5 view .LVU3616
+.LBE1746:
+.LBE1748:
+	.loc 1 991 5 is_stmt 1 view .LVU3617
+	.loc 1 991 19 view .LVU3618
+	cmpb	$0, activeBoxIdCount(%rip)
+	je	.L495
+	xorl	%r12d, %r12d
+	leaq	activeBoxIds(%rip), %rbx
+	leaq	boxes(%rip), %rbp
+.LVL723:
+	.p2align 4,,10
+	.p2align 3
+.L499:
+.LBB1749:
+	.loc 1 992 9 view .LVU3619
+	.loc 1 992 61 is_stmt 0 view .LVU3620
+	movzbl	(%rbx,%r12), %ecx
+.LVL724:
+.LBB1750:
+.LBI1750:
+	.loc 1 528 14 is_stmt 1 view .LVU3621
+.LBB1751:
+	.loc 1 530 5 view .LVU3622
+	.loc 1 531 5 view .LVU3623
+	.loc 1 532 5 view .LVU3624
+	.loc 1 532 33 view .LVU3625
+	leaq	boxes(%rip), %rdx
+.LBE1751:
+.LBE1750:
+	.loc 1 992 61 is_stmt 0 view .LVU3626
+	xorl	%eax, %eax
+	jmp	.L497
+.LVL725:
+	.p2align 4,,10
+	.p2align 3
+.L503:
+.LBB1754:
+.LBB1752:
+	.loc 1 532 74 is_stmt 1 view .LVU3627
+	.loc 1 532 33 view .LVU3628
+	addl	$1, %eax
+.LVL726:
+	.loc 1 532 33 is_stmt 0 view .LVU3629
+	addq	$24, %rdx
+	cmpl	$23, %eax
+	je	.L498
+.LVL727:
+.L497:
+	.loc 1 533 9 is_stmt 1 view .LVU3630
+	.loc 1 534 9 view .LVU3631
+	.loc 1 534 12 is_stmt 0 view .LVU3632
+	cmpb	(%rdx), %cl
+	jne	.L503
+.LVL728:
+	.loc 1 534 12 view .LVU3633
+.LBE1752:
+.LBE1754:
+	.loc 1 993 9 is_stmt 1 view .LVU3634
+	.loc 1 996 9 view .LVU3635
+.LBB1755:
+.LBB1753:
+	.loc 1 533 19 is_stmt 0 view .LVU3636
+	cltq
+	.loc 1 533 19 view .LVU3637
+.LBE1753:
+.LBE1755:
+	.loc 1 996 23 view .LVU3638
+	leaq	(%rax,%rax,2), %rax
+.LVL729:
+	.loc 1 996 9 view .LVU3639
+	movzbl	16(%rbp,%rax,8), %edi
+	call	serialize8
+.LVL730:
+.L498:
+	.loc 1 996 9 view .LVU3640
+.LBE1749:
+	.loc 1 991 40 is_stmt 1 discriminator 2 view .LVU3641
+	.loc 1 991 19 discriminator 2 view .LVU3642
+	movzbl	activeBoxIdCount(%rip), %eax
+	addq	$1, %r12
+.LVL731:
+	.loc 1 991 19 is_stmt 0 discriminator 2 view .LVU3643
+	cmpl	%eax, %r12d
+	jb	.L499
+.LVL732:
+.L495:
+	.loc 1 998 5 is_stmt 1 view .LVU3644
+	.loc 1 999 1 is_stmt 0 view .LVU3645
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	mspBoxIds, .-mspBoxIds
+	.section	.text.mspServo,"ax",@progbits
+	.p2align 4
+	.type	mspServo, @function
+mspServo:
+.LFB34:
+	.loc 1 833 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 834 5 view .LVU3647
+.LVL733:
+.LBB1760:
+.LBI1760:
+	.loc 1 514 6 view .LVU3648
+.LBB1761:
+	.loc 1 516 5 view .LVU3649
+.LBB1762:
+.LBI1762:
+	.loc 1 497 6 view .LVU3650
+.LBB1763:
+	.loc 1 499 5 view .LVU3651
+.LBE1763:
+.LBE1762:
+.LBE1761:
+.LBE1760:
+	.loc 1 833 1 is_stmt 0 view .LVU3652
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB1773:
+.LBB1770:
+.LBB1767:
+.LBB1764:
+	.loc 1 499 5 view .LVU3653
+	movl	$16, %esi
+	xorl	%edi, %edi
+.LBE1764:
+.LBE1767:
+.LBE1770:
+.LBE1773:
+	.loc 1 833 1 view .LVU3654
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+.LBB1774:
+.LBB1771:
+.LBB1768:
+.LBB1765:
+	.loc 1 499 5 view .LVU3655
+	leaq	servo(%rip), %rbx
+	leaq	16(%rbx), %rbp
+.LBE1765:
+.LBE1768:
+.LBE1771:
+.LBE1774:
+	.loc 1 833 1 view .LVU3656
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB1775:
+.LBB1772:
+.LBB1769:
+.LBB1766:
+	.loc 1 499 5 view .LVU3657
+	call	headSerialResponse
+.LVL734:
+	.loc 1 499 5 view .LVU3658
+.LBE1766:
+.LBE1769:
+	.loc 1 517 12 is_stmt 1 view .LVU3659
+	.p2align 4,,10
+	.p2align 3
+.L505:
+	.loc 1 518 9 view .LVU3660
+	movzbl	(%rbx), %edi
+	.loc 1 518 23 is_stmt 0 view .LVU3661
+	addq	$1, %rbx
+.LVL735:
+	.loc 1 518 9 view .LVU3662
+	call	serialize8
+.LVL736:
+	.loc 1 517 12 is_stmt 1 view .LVU3663
+	cmpq	%rbp, %rbx
+	jne	.L505
+.LVL737:
+	.loc 1 517 12 is_stmt 0 view .LVU3664
+.LBE1772:
+.LBE1775:
+	.loc 1 835 5 is_stmt 1 view .LVU3665
+	.loc 1 836 1 is_stmt 0 view .LVU3666
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	mspServo, .-mspServo
+	.section	.text.mspMotor,"ax",@progbits
+	.p2align 4
+	.type	mspMotor, @function
+mspMotor:
+.LFB37:
+	.loc 1 864 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 865 5 view .LVU3668
+.LVL738:
+.LBB1780:
+.LBI1780:
+	.loc 1 514 6 view .LVU3669
+.LBB1781:
+	.loc 1 516 5 view .LVU3670
+.LBB1782:
+.LBI1782:
+	.loc 1 497 6 view .LVU3671
+.LBB1783:
+	.loc 1 499 5 view .LVU3672
+.LBE1783:
+.LBE1782:
+.LBE1781:
+.LBE1780:
+	.loc 1 864 1 is_stmt 0 view .LVU3673
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB1793:
+.LBB1790:
+.LBB1787:
+.LBB1784:
+	.loc 1 499 5 view .LVU3674
+	movl	$16, %esi
+	xorl	%edi, %edi
+.LBE1784:
+.LBE1787:
+.LBE1790:
+.LBE1793:
+	.loc 1 864 1 view .LVU3675
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+.LBB1794:
+.LBB1791:
+.LBB1788:
+.LBB1785:
+	.loc 1 499 5 view .LVU3676
+	leaq	motor(%rip), %rbx
+	leaq	16(%rbx), %rbp
+.LBE1785:
+.LBE1788:
+.LBE1791:
+.LBE1794:
+	.loc 1 864 1 view .LVU3677
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB1795:
+.LBB1792:
+.LBB1789:
+.LBB1786:
+	.loc 1 499 5 view .LVU3678
+	call	headSerialResponse
+.LVL739:
+	.loc 1 499 5 view .LVU3679
+.LBE1786:
+.LBE1789:
+	.loc 1 517 12 is_stmt 1 view .LVU3680
+	.p2align 4,,10
+	.p2align 3
+.L509:
+	.loc 1 518 9 view .LVU3681
+	movzbl	(%rbx), %edi
+	.loc 1 518 23 is_stmt 0 view .LVU3682
+	addq	$1, %rbx
+.LVL740:
+	.loc 1 518 9 view .LVU3683
+	call	serialize8
+.LVL741:
+	.loc 1 517 12 is_stmt 1 view .LVU3684
+	cmpq	%rbp, %rbx
+	jne	.L509
+.LVL742:
+	.loc 1 517 12 is_stmt 0 view .LVU3685
+.LBE1792:
+.LBE1795:
+	.loc 1 866 5 is_stmt 1 view .LVU3686
+	.loc 1 867 1 is_stmt 0 view .LVU3687
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	movl	$1, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	mspMotor, .-mspMotor
+	.section	.text.headSerialReply,"ax",@progbits
+	.p2align 4
+	.globl	headSerialReply
+	.type	headSerialReply, @function
+headSerialReply:
+.LVL743:
+.LFB19:
+	.loc 1 498 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 499 5 view .LVU3689
+	movzwl	%di, %esi
+	xorl	%edi, %edi
+.LVL744:
+	.loc 1 499 5 is_stmt 0 view .LVU3690
+	jmp	headSerialResponse
+.LVL745:
+	.loc 1 499 5 view .LVU3691
+	.cfi_endproc
+.LFE19:
+	.size	headSerialReply, .-headSerialReply
+	.section	.text.headSerialError,"ax",@progbits
+	.p2align 4
+	.globl	headSerialError
+	.type	headSerialError, @function
+headSerialError:
+.LVL746:
+.LFB20:
+	.loc 1 503 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 504 5 view .LVU3693
+	movzwl	%di, %esi
+	movl	$1, %edi
+.LVL747:
+	.loc 1 504 5 is_stmt 0 view .LVU3694
+	jmp	headSerialResponse
+.LVL748:
+	.loc 1 504 5 view .LVU3695
+	.cfi_endproc
+.LFE20:
+	.size	headSerialError, .-headSerialError
+	.section	.text.tailSerialReply,"ax",@progbits
+	.p2align 4
+	.globl	tailSerialReply
+	.type	tailSerialReply, @function
+tailSerialReply:
+.LFB21:
+	.loc 1 508 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 509 5 view .LVU3697
+	.loc 1 508 1 is_stmt 0 view .LVU3698
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 509 27 view .LVU3699
+	movq	currentPort(%rip), %rax
+	.loc 1 509 5 view .LVU3700
+	movzbl	50(%rax), %edi
+	call	serialize8
+.LVL749:
+	.loc 1 510 5 is_stmt 1 view .LVU3701
+.LBB1798:
+.LBI1798:
+	.loc 1 387 13 view .LVU3702
+.LBB1799:
+	.loc 1 389 5 view .LVU3703
+	.loc 1 389 20 is_stmt 0 view .LVU3704
+	movq	currentPort(%rip), %rax
+	.loc 1 389 8 view .LVU3705
+	cmpq	$0, 320(%rax)
+	je	.L515
+	.loc 1 390 9 is_stmt 1 view .LVU3706
+	movzwl	330(%rax), %esi
+	movq	mspSerialPort(%rip), %rdi
+	call	serialTxCommit@PLT
+.LVL750:
+	.loc 1 391 9 view .LVU3707
+	.loc 1 391 20 is_stmt 0 view .LVU3708
+	movq	currentPort(%rip), %rax
+	.loc 1 391 33 view .LVU3709
+	movq	$0, 320(%rax)
+.L515:
+.LBE1799:
+.LBE1798:
+	.loc 1 511 5 is_stmt 1 view .LVU3710
+	.loc 1 511 31 is_stmt 0 view .LVU3711
+	movb	$0, 332(%rax)
+	.loc 1 512 1 view .LVU3712
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	tailSerialReply, .-tailSerialReply
+	.section	.text.s_struct,"ax",@progbits
+	.p2align 4
+	.globl	s_struct
+	.type	s_struct, @function
+s_struct:
+.LVL751:
+.LFB22:
+	.loc 1 515 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 515 1 is_stmt 0 view .LVU3714
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	.loc 1 516 5 is_stmt 1 view .LVU3715
+.LVL752:
+.LBB1800:
+.LBI1800:
+	.loc 1 497 6 view .LVU3716
+.LBB1801:
+	.loc 1 499 5 view .LVU3717
+.LBE1801:
+.LBE1800:
+	.loc 1 516 5 is_stmt 0 view .LVU3718
+	movzbl	%sil, %esi
+	.loc 1 515 1 view .LVU3719
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+.LBB1804:
+.LBB1802:
+	.loc 1 499 5 view .LVU3720
+	xorl	%edi, %edi
+.LVL753:
+	.loc 1 499 5 view .LVU3721
+.LBE1802:
+.LBE1804:
+	.loc 1 515 1 view .LVU3722
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+.LBB1805:
+.LBB1803:
+	.loc 1 499 5 view .LVU3723
+	call	headSerialResponse
+.LVL754:
+	.loc 1 499 5 view .LVU3724
+.LBE1803:
+.LBE1805:
+	.loc 1 517 12 is_stmt 1 view .LVU3725
+	.loc 1 517 12 is_stmt 0 view .LVU3726
+	testb	%bpl, %bpl
+	je	.L517
+	leal	-1(%rbp), %eax
+	movzbl	%al, %eax
+	leaq	1(%rbx,%rax), %rbp
+.LVL755:
+	.p2align 4,,10
+	.p2align 3
+.L519:
+	.loc 1 518 9 is_stmt 1 view .LVU3727
+	movzbl	(%rbx), %edi
+	.loc 1 518 23 is_stmt 0 view .LVU3728
+	addq	$1, %rbx
+.LVL756:
+	.loc 1 518 9 view .LVU3729
+	call	serialize8
+.LVL757:
+	.loc 1 517 12 is_stmt 1 view .LVU3730
+	.loc 1 517 12 is_stmt 0 view .LVU3731
+	cmpq	%rbp, %rbx
+	jne	.L519
+.LVL758:
+.L517:
+	.loc 1 519 1 view .LVU3732
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL759:
+	.loc 1 519 1 view .LVU3733
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	s_struct, .-s_struct
+	.section	.text.serializeNames,"ax",@progbits
+	.p2align 4
+	.globl	serializeNames
+	.type	serializeNames, @function
+serializeNames:
+.LVL760:
+.LFB23:
+	.loc 1 522 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 523 5 view .LVU3735
+	.loc 1 524 5 view .LVU3736
+	.loc 1 524 17 view .LVU3737
+	.loc 1 522 1 is_stmt 0 view .LVU3738
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 522 1 view .LVU3739
+	movq	%rdi, %rbx
+	.loc 1 524 17 view .LVU3740
+	movzbl	(%rdi), %edi
+.LVL761:
+	.loc 1 524 17 view .LVU3741
+	testb	%dil, %dil
+	je	.L522
+.LVL762:
+	.p2align 4,,10
+	.p2align 3
+.L524:
+	.loc 1 525 9 is_stmt 1 discriminator 3 view .LVU3742
+	call	serialize8
+.LVL763:
+	.loc 1 524 22 discriminator 3 view .LVU3743
+	.loc 1 524 17 is_stmt 0 discriminator 3 view .LVU3744
+	movzbl	1(%rbx), %edi
+	.loc 1 524 22 discriminator 3 view .LVU3745
+	addq	$1, %rbx
+.LVL764:
+	.loc 1 524 17 is_stmt 1 discriminator 3 view .LVU3746
+	testb	%dil, %dil
+	jne	.L524
+.L522:
+	.loc 1 526 1 is_stmt 0 view .LVU3747
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL765:
+	.loc 1 526 1 view .LVU3748
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	serializeNames, .-serializeNames
+	.section	.text.findBoxByActiveBoxId,"ax",@progbits
+	.p2align 4
+	.globl	findBoxByActiveBoxId
+	.type	findBoxByActiveBoxId, @function
+findBoxByActiveBoxId:
+.LVL766:
+.LFB24:
+	.loc 1 529 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 530 5 view .LVU3750
+	.loc 1 531 5 view .LVU3751
+	.loc 1 532 5 view .LVU3752
+	.loc 1 532 33 view .LVU3753
+	leaq	boxes(%rip), %rcx
+	.loc 1 529 1 is_stmt 0 view .LVU3754
+	xorl	%eax, %eax
+	movq	%rcx, %rdx
+	jmp	.L532
+.LVL767:
+	.p2align 4,,10
+	.p2align 3
+.L536:
+	.loc 1 532 74 is_stmt 1 discriminator 2 view .LVU3755
+	.loc 1 532 33 discriminator 2 view .LVU3756
+	addl	$1, %eax
+.LVL768:
+	.loc 1 532 33 is_stmt 0 discriminator 2 view .LVU3757
+	addq	$24, %rdx
+	cmpl	$23, %eax
+	je	.L535
+.LVL769:
+.L532:
+	.loc 1 533 9 is_stmt 1 view .LVU3758
+	.loc 1 534 9 view .LVU3759
+	.loc 1 534 12 is_stmt 0 view .LVU3760
+	cmpb	%dil, (%rdx)
+	jne	.L536
+	.loc 1 533 19 view .LVU3761
+	cltq
+.LVL770:
+	.loc 1 533 19 view .LVU3762
+	leaq	(%rax,%rax,2), %rax
+.LVL771:
+	.loc 1 533 19 view .LVU3763
+	leaq	(%rcx,%rax,8), %rax
+	.loc 1 539 1 view .LVU3764
+	ret
+.LVL772:
+	.p2align 4,,10
+	.p2align 3
+.L535:
+	.loc 1 538 11 view .LVU3765
+	xorl	%eax, %eax
+.LVL773:
+	.loc 1 538 11 view .LVU3766
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	findBoxByActiveBoxId, .-findBoxByActiveBoxId
+	.section	.text.findBoxByPermenantId,"ax",@progbits
+	.p2align 4
+	.globl	findBoxByPermenantId
+	.type	findBoxByPermenantId, @function
+findBoxByPermenantId:
+.LVL774:
+.LFB25:
+	.loc 1 542 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 543 5 view .LVU3768
+	.loc 1 544 5 view .LVU3769
+	.loc 1 545 5 view .LVU3770
+	.loc 1 545 33 view .LVU3771
+	leaq	16+boxes(%rip), %rdx
+	.loc 1 542 1 is_stmt 0 view .LVU3772
+	xorl	%eax, %eax
+	jmp	.L539
+.LVL775:
+	.p2align 4,,10
+	.p2align 3
+.L543:
+	.loc 1 545 74 is_stmt 1 discriminator 2 view .LVU3773
+	.loc 1 545 33 discriminator 2 view .LVU3774
+	addl	$1, %eax
+.LVL776:
+	.loc 1 545 33 is_stmt 0 discriminator 2 view .LVU3775
+	addq	$24, %rdx
+	cmpl	$23, %eax
+	je	.L542
+.LVL777:
+.L539:
+	.loc 1 546 9 is_stmt 1 view .LVU3776
+	.loc 1 547 9 view .LVU3777
+	.loc 1 547 12 is_stmt 0 view .LVU3778
+	cmpb	%dil, (%rdx)
+	jne	.L543
+	.loc 1 546 19 view .LVU3779
+	cltq
+.LVL778:
+	.loc 1 546 19 view .LVU3780
+	leaq	(%rax,%rax,2), %rdx
+	leaq	boxes(%rip), %rax
+.LVL779:
+	.loc 1 546 19 view .LVU3781
+	leaq	(%rax,%rdx,8), %rax
+	.loc 1 552 1 view .LVU3782
+	ret
+.LVL780:
+	.p2align 4,,10
+	.p2align 3
+.L542:
+	.loc 1 551 11 view .LVU3783
+	xorl	%eax, %eax
+.LVL781:
+	.loc 1 551 11 view .LVU3784
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	findBoxByPermenantId, .-findBoxByPermenantId
+	.section	.text.serializeBoxNamesReply,"ax",@progbits
+	.p2align 4
+	.globl	serializeBoxNamesReply
+	.type	serializeBoxNamesReply, @function
+serializeBoxNamesReply:
+.LFB26:
+	.loc 1 555 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 556 5 view .LVU3786
+.LDL1:
+.LVL782:
+	.loc 1 557 5 view .LVU3787
+	.loc 1 562 5 view .LVU3788
+	.loc 1 562 19 view .LVU3789
+	.loc 1 555 1 is_stmt 0 view .LVU3790
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 562 19 view .LVU3791
+	cmpb	$0, activeBoxIdCount(%rip)
+	je	.L557
+	.loc 1 556 28 view .LVU3792
+	movl	$1, 12(%rsp)
+	.loc 1 556 38 view .LVU3793
+	xorl	%r13d, %r13d
+.LVL783:
+.L555:
+	.loc 1 556 28 view .LVU3794
+	xorl	%ebx, %ebx
+.LVL784:
+	.p2align 4,,10
+	.p2align 3
+.L553:
+	.loc 1 563 9 is_stmt 1 view .LVU3795
+	.loc 1 563 35 is_stmt 0 view .LVU3796
+	leaq	activeBoxIds(%rip), %rax
+	leaq	boxes(%rip), %rdx
+	movzbl	(%rax,%rbx), %ecx
+.LVL785:
+	.loc 1 565 9 is_stmt 1 view .LVU3797
+.LBB1806:
+.LBI1806:
+	.loc 1 528 14 view .LVU3798
+.LBB1807:
+	.loc 1 530 5 view .LVU3799
+	.loc 1 531 5 view .LVU3800
+	.loc 1 532 5 view .LVU3801
+	.loc 1 532 33 view .LVU3802
+.LBE1807:
+.LBE1806:
+	.loc 1 563 35 is_stmt 0 view .LVU3803
+	xorl	%eax, %eax
+	jmp	.L547
+.LVL786:
+	.p2align 4,,10
+	.p2align 3
+.L561:
+.LBB1809:
+.LBB1808:
+	.loc 1 532 74 is_stmt 1 view .LVU3804
+	.loc 1 532 33 view .LVU3805
+	addl	$1, %eax
+.LVL787:
+	.loc 1 532 33 is_stmt 0 view .LVU3806
+	addq	$24, %rdx
+	cmpl	$23, %eax
+	je	.L551
+.LVL788:
+.L547:
+	.loc 1 533 9 is_stmt 1 view .LVU3807
+	.loc 1 534 9 view .LVU3808
+	.loc 1 534 12 is_stmt 0 view .LVU3809
+	cmpb	(%rdx), %cl
+	jne	.L561
+	.loc 1 533 19 view .LVU3810
+	cltq
+.LVL789:
+	.loc 1 533 19 view .LVU3811
+	leaq	boxes(%rip), %rsi
+	leaq	(%rax,%rax,2), %rax
+.LVL790:
+	.loc 1 533 19 view .LVU3812
+	leaq	(%rsi,%rax,8), %rbp
+.LVL791:
+	.loc 1 533 19 view .LVU3813
+.LBE1808:
+.LBE1809:
+	.loc 1 566 9 is_stmt 1 view .LVU3814
+	.loc 1 570 9 view .LVU3815
+	.loc 1 570 25 is_stmt 0 view .LVU3816
+	movq	8(%rbp), %r14
+	.loc 1 570 15 view .LVU3817
+	movq	%r14, %rdi
+	call	strlen@PLT
+.LVL792:
+	.loc 1 571 9 is_stmt 1 view .LVU3818
+	.loc 1 571 12 is_stmt 0 view .LVU3819
+	movl	12(%rsp), %edx
+	testl	%edx, %edx
+	je	.L562
+	.loc 1 572 13 is_stmt 1 view .LVU3820
+	.loc 1 572 19 is_stmt 0 view .LVU3821
+	addl	%eax, %r13d
+.LVL793:
+.L551:
+	.loc 1 562 40 is_stmt 1 discriminator 2 view .LVU3822
+	.loc 1 562 19 discriminator 2 view .LVU3823
+	movzbl	activeBoxIdCount(%rip), %eax
+	addq	$1, %rbx
+.LVL794:
+	.loc 1 562 19 is_stmt 0 discriminator 2 view .LVU3824
+	cmpl	%ebx, %eax
+	jg	.L553
+	.loc 1 579 5 is_stmt 1 view .LVU3825
+	.loc 1 579 8 is_stmt 0 view .LVU3826
+	movl	12(%rsp), %eax
+	movzwl	%r13w, %esi
+	testl	%eax, %eax
+	je	.L544
+.LVL795:
+.L545:
+	.loc 1 580 9 is_stmt 1 view .LVU3827
+.LBB1810:
+.LBI1810:
+	.loc 1 497 6 view .LVU3828
+.LBB1811:
+	.loc 1 499 5 view .LVU3829
+	xorl	%edi, %edi
+	call	headSerialResponse
+.LVL796:
+	.loc 1 499 5 is_stmt 0 view .LVU3830
+.LBE1811:
+.LBE1810:
+	.loc 1 581 9 is_stmt 1 view .LVU3831
+	.loc 1 582 9 view .LVU3832
+	.loc 1 557 5 view .LVU3833
+	.loc 1 562 5 view .LVU3834
+	.loc 1 562 19 view .LVU3835
+	cmpb	$0, activeBoxIdCount(%rip)
+	.loc 1 581 14 is_stmt 0 view .LVU3836
+	movl	$0, 12(%rsp)
+	.loc 1 562 19 view .LVU3837
+	jne	.L555
+.LVL797:
+.L544:
+	.loc 1 584 1 view .LVU3838
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL798:
+	.loc 1 584 1 view .LVU3839
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL799:
+	.p2align 4,,10
+	.p2align 3
+.L562:
+	.cfi_restore_state
+	.loc 1 574 27 is_stmt 1 view .LVU3840
+	testl	%eax, %eax
+	jle	.L551
+	leal	-1(%rax), %r12d
+	xorl	%r15d, %r15d
+	jmp	.L550
+.LVL800:
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	.loc 1 575 31 is_stmt 0 view .LVU3841
+	movq	8(%rbp), %r14
+	movq	%rcx, %r15
+.LVL801:
+.L550:
+	.loc 1 575 17 is_stmt 1 discriminator 3 view .LVU3842
+	movzbl	(%r14,%r15), %edi
+	call	serialize8
+.LVL802:
+	.loc 1 574 35 discriminator 3 view .LVU3843
+	.loc 1 574 27 discriminator 3 view .LVU3844
+	leaq	1(%r15), %rcx
+	cmpq	%r15, %r12
+	jne	.L563
+	jmp	.L551
+.LVL803:
+.L557:
+	.loc 1 562 19 is_stmt 0 view .LVU3845
+	xorl	%esi, %esi
+	.loc 1 556 38 view .LVU3846
+	xorl	%r13d, %r13d
+	jmp	.L545
+	.cfi_endproc
+.LFE26:
+	.size	serializeBoxNamesReply, .-serializeBoxNamesReply
+	.section	.text.mspBoxNames,"ax",@progbits
+	.p2align 4
+	.type	mspBoxNames, @function
+mspBoxNames:
+.LFB46:
+	.loc 1 980 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 982 5 view .LVU3848
+	.loc 1 980 1 is_stmt 0 view .LVU3849
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 982 5 view .LVU3850
+	call	serializeBoxNamesReply
+.LVL804:
+	.loc 1 983 5 is_stmt 1 view .LVU3851
+	.loc 1 984 1 is_stmt 0 view .LVU3852
+	movl	$1, %eax
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	mspBoxNames, .-mspBoxNames
+	.section	.text.mspInit,"ax",@progbits
+	.p2align 4
+	.globl	mspInit
+	.type	mspInit, @function
+mspInit:
+.LVL805:
+.LFB29:
+	.loc 1 635 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 637 5 view .LVU3854
+	.loc 1 635 1 is_stmt 0 view .LVU3855
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	.loc 1 637 5 view .LVU3856
+	pcmpeqd	%xmm0, %xmm0
+	.loc 1 635 1 view .LVU3857
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	.loc 1 642 9 view .LVU3858
+	movl	$2, %edi
+.LVL806:
+	.loc 1 635 1 view .LVU3859
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 637 5 view .LVU3860
+	leaq	activeBoxIds(%rip), %rbx
+	.loc 1 635 1 view .LVU3861
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 637 5 view .LVU3862
+	movaps	%xmm0, activeBoxIds(%rip)
+	.loc 1 640 34 view .LVU3863
+	movb	$1, activeBoxIdCount(%rip)
+	.loc 1 637 5 view .LVU3864
+	movq	$-1, 14+activeBoxIds(%rip)
+	.loc 1 639 5 is_stmt 1 view .LVU3865
+	.loc 1 640 5 view .LVU3866
+	.loc 1 640 38 is_stmt 0 view .LVU3867
+	movb	$0, activeBoxIds(%rip)
+	.loc 1 642 5 is_stmt 1 view .LVU3868
+	.loc 1 642 9 is_stmt 0 view .LVU3869
+	call	sensors@PLT
+.LVL807:
+	.loc 1 642 8 view .LVU3870
+	testb	%al, %al
+	je	.L567
+	.loc 1 643 9 is_stmt 1 view .LVU3871
+	.loc 1 643 38 is_stmt 0 view .LVU3872
+	movzbl	activeBoxIdCount(%rip), %edx
+	movq	%rdx, %rax
+	.loc 1 643 42 view .LVU3873
+	movb	$1, (%rbx,%rdx)
+	.loc 1 644 9 is_stmt 1 view .LVU3874
+	.loc 1 644 38 is_stmt 0 view .LVU3875
+	leal	2(%rdx), %edx
+	.loc 1 643 38 view .LVU3876
+	addl	$1, %eax
+	.loc 1 644 38 view .LVU3877
+	movb	%dl, activeBoxIdCount(%rip)
+	.loc 1 644 42 view .LVU3878
+	movzbl	%al, %eax
+	movb	$2, (%rbx,%rax)
+.L567:
+	.loc 1 647 5 is_stmt 1 view .LVU3879
+	.loc 1 647 9 is_stmt 0 view .LVU3880
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL808:
+	.loc 1 647 8 view .LVU3881
+	testb	%al, %al
+	je	.L568
+	.loc 1 648 9 is_stmt 1 view .LVU3882
+	.loc 1 648 38 is_stmt 0 view .LVU3883
+	movzbl	activeBoxIdCount(%rip), %eax
+	leal	1(%rax), %edx
+	.loc 1 648 42 view .LVU3884
+	movb	$3, (%rbx,%rax)
+	.loc 1 648 38 view .LVU3885
+	movb	%dl, activeBoxIdCount(%rip)
+.L568:
+	.loc 1 651 5 is_stmt 1 view .LVU3886
+	.loc 1 651 9 is_stmt 0 view .LVU3887
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL809:
+	.loc 1 651 8 view .LVU3888
+	testb	%al, %al
+	je	.L569
+.L571:
+	.loc 1 652 9 is_stmt 1 view .LVU3889
+	.loc 1 652 38 is_stmt 0 view .LVU3890
+	movzbl	activeBoxIdCount(%rip), %edx
+	.loc 1 652 42 view .LVU3891
+	movb	$4, (%rbx,%rdx)
+	.loc 1 653 9 is_stmt 1 view .LVU3892
+	.loc 1 652 38 is_stmt 0 view .LVU3893
+	movq	%rdx, %rax
+	leal	1(%rdx), %edx
+	.loc 1 653 42 view .LVU3894
+	movzbl	%dl, %edx
+	movb	$5, (%rbx,%rdx)
+	.loc 1 654 9 is_stmt 1 view .LVU3895
+	.loc 1 654 38 is_stmt 0 view .LVU3896
+	leal	3(%rax), %edx
+	.loc 1 653 38 view .LVU3897
+	addl	$2, %eax
+	.loc 1 654 42 view .LVU3898
+	movzbl	%al, %eax
+	.loc 1 654 38 view .LVU3899
+	movb	%dl, activeBoxIdCount(%rip)
+	.loc 1 654 42 view .LVU3900
+	movb	$6, (%rbx,%rax)
+.L570:
+	.loc 1 657 5 is_stmt 1 view .LVU3901
+	.loc 1 657 9 is_stmt 0 view .LVU3902
+	movl	$32, %edi
+	call	feature@PLT
+.LVL810:
+	.loc 1 657 8 view .LVU3903
+	testb	%al, %al
+	jne	.L572
+	.loc 1 658 38 view .LVU3904
+	movzbl	activeBoxIdCount(%rip), %eax
+.L573:
+	.loc 1 667 5 is_stmt 1 view .LVU3905
+	.loc 1 667 21 is_stmt 0 view .LVU3906
+	movzbl	masterConfig(%rip), %edx
+	.loc 1 667 8 view .LVU3907
+	cmpb	$8, %dl
+	je	.L586
+	cmpb	$14, %dl
+	je	.L586
+.L574:
+	.loc 1 670 5 is_stmt 1 view .LVU3908
+	.loc 1 670 34 is_stmt 0 view .LVU3909
+	leal	1(%rax), %edx
+	.loc 1 672 9 view .LVU3910
+	movl	$4, %edi
+	.loc 1 670 38 view .LVU3911
+	movzbl	%al, %eax
+	.loc 1 670 34 view .LVU3912
+	movb	%dl, activeBoxIdCount(%rip)
+	.loc 1 670 38 view .LVU3913
+	movb	$12, (%rbx,%rax)
+	.loc 1 672 5 is_stmt 1 view .LVU3914
+	.loc 1 672 9 is_stmt 0 view .LVU3915
+	call	feature@PLT
+.LVL811:
+	.loc 1 672 8 view .LVU3916
+	testb	%al, %al
+	jne	.L576
+	.loc 1 673 38 view .LVU3917
+	movzbl	activeBoxIdCount(%rip), %eax
+.L577:
+	.loc 1 675 5 is_stmt 1 view .LVU3918
+	.loc 1 677 9 is_stmt 0 view .LVU3919
+	xorl	%edi, %edi
+	cmpb	$0, 368+masterConfig(%rip)
+	.loc 1 675 34 view .LVU3920
+	leal	1(%rax), %edx
+	.loc 1 675 38 view .LVU3921
+	movzbl	%al, %eax
+	.loc 1 677 9 view .LVU3922
+	setne	%dil
+	.loc 1 675 34 view .LVU3923
+	movb	%dl, activeBoxIdCount(%rip)
+	.loc 1 675 38 view .LVU3924
+	movb	$18, (%rbx,%rax)
+	.loc 1 677 5 is_stmt 1 view .LVU3925
+	.loc 1 677 9 is_stmt 0 view .LVU3926
+	call	feature@PLT
+.LVL812:
+	.loc 1 677 8 view .LVU3927
+	testb	%al, %al
+	je	.L578
+	.loc 1 678 9 is_stmt 1 view .LVU3928
+	.loc 1 678 38 is_stmt 0 view .LVU3929
+	movzbl	activeBoxIdCount(%rip), %eax
+	leal	1(%rax), %edx
+	.loc 1 678 42 view .LVU3930
+	movb	$19, (%rbx,%rax)
+	.loc 1 678 38 view .LVU3931
+	movb	%dl, activeBoxIdCount(%rip)
+.L578:
+	.loc 1 684 5 is_stmt 1 view .LVU3932
+	.loc 1 684 9 is_stmt 0 view .LVU3933
+	movl	$512, %edi
+	call	feature@PLT
+.LVL813:
+	.loc 1 684 8 view .LVU3934
+	testb	%al, %al
+	je	.L579
+	.loc 1 685 9 is_stmt 1 view .LVU3935
+	.loc 1 685 38 is_stmt 0 view .LVU3936
+	movzbl	activeBoxIdCount(%rip), %eax
+	leal	1(%rax), %edx
+	.loc 1 685 42 view .LVU3937
+	movb	$21, (%rbx,%rax)
+	.loc 1 685 38 view .LVU3938
+	movb	%dl, activeBoxIdCount(%rip)
+.L579:
+	.loc 1 689 5 is_stmt 1 view .LVU3939
+	leaq	mspPorts(%rip), %rbx
+	movl	$86, %ecx
+	xorl	%eax, %eax
+.LBB1818:
+.LBB1819:
+	.loc 1 602 13 is_stmt 0 view .LVU3940
+	xorl	%r12d, %r12d
+.LBE1819:
+.LBE1818:
+	.loc 1 689 5 view .LVU3941
+	movq	%rbx, %rdi
+	rep stosq
+	.loc 1 691 5 is_stmt 1 view .LVU3942
+.LVL814:
+.LBB1834:
+.LBI1818:
+	.loc 1 598 13 view .LVU3943
+.LBB1831:
+	.loc 1 600 5 view .LVU3944
+	.loc 1 602 5 view .LVU3945
+	.p2align 4,,10
+	.p2align 3
+.L585:
+	.loc 1 603 5 view .LVU3946
+.LBB1820:
+	.loc 1 605 9 view .LVU3947
+	.loc 1 607 8 view .LVU3948
+	.loc 1 608 9 view .LVU3949
+	.loc 1 610 13 view .LVU3950
+	.loc 1 610 20 is_stmt 0 view .LVU3951
+	movl	4(%rbp), %edx
+	xorl	%r8d, %r8d
+	movl	$3, %ecx
+	xorl	%esi, %esi
+	movl	$1, %edi
+	call	openSerialPort@PLT
+.LVL815:
+	.loc 1 610 20 view .LVU3952
+	movq	%rax, %rdx
+.LVL816:
+	.loc 1 611 13 is_stmt 1 view .LVU3953
+	.loc 1 611 16 is_stmt 0 view .LVU3954
+	testq	%rax, %rax
+	je	.L604
+.LVL817:
+.L580:
+	.loc 1 621 9 is_stmt 1 view .LVU3955
+	.loc 1 621 12 is_stmt 0 view .LVU3956
+	cmpb	$1, %r12b
+	ja	.L585
+.LBB1821:
+	.loc 1 622 13 is_stmt 1 view .LVU3957
+	movzbl	%r12b, %esi
+.LBB1822:
+.LBB1823:
+	.loc 1 588 5 is_stmt 0 view .LVU3958
+	xorl	%eax, %eax
+.LVL818:
+	.loc 1 588 5 view .LVU3959
+.LBE1823:
+.LBE1822:
+	.loc 1 622 56 view .LVU3960
+	leal	1(%r12), %r13d
+.LVL819:
+.LBB1827:
+.LBB1824:
+	.loc 1 588 5 view .LVU3961
+	movl	$43, %ecx
+	imulq	$344, %rsi, %rsi
+.LVL820:
+	.loc 1 588 5 view .LVU3962
+.LBE1824:
+.LBE1827:
+	.loc 1 624 13 is_stmt 1 view .LVU3963
+.LBB1828:
+.LBI1822:
+	.loc 1 586 13 view .LVU3964
+.LBB1825:
+	.loc 1 588 5 view .LVU3965
+.LBE1825:
+.LBE1828:
+	.loc 1 622 56 is_stmt 0 view .LVU3966
+	movl	%r13d, %r12d
+	.loc 1 622 24 view .LVU3967
+	leaq	(%rbx,%rsi), %r8
+.LBB1829:
+.LBB1826:
+	.loc 1 588 5 view .LVU3968
+	movq	%r8, %rdi
+	rep stosq
+	.loc 1 590 5 is_stmt 1 view .LVU3969
+	.loc 1 592 63 is_stmt 0 view .LVU3970
+	leaq	54(%rbx,%rsi), %rax
+	.loc 1 590 26 view .LVU3971
+	movq	%rdx, (%r8)
+	.loc 1 591 5 is_stmt 1 view .LVU3972
+	.loc 1 592 5 is_stmt 0 view .LVU3973
+	leaq	8(%rbx,%rsi), %rdi
+	movl	$256, %edx
+.LVL821:
+	.loc 1 592 5 view .LVU3974
+	movq	%rax, %rsi
+.LVL822:
+	.loc 1 591 34 view .LVU3975
+	movl	$1, 316(%r8)
+	.loc 1 592 5 is_stmt 1 view .LVU3976
+	call	mspFrameParserInit@PLT
+.LVL823:
+	.loc 1 592 5 is_stmt 0 view .LVU3977
+.LBE1826:
+.LBE1829:
+.LBE1821:
+.LBE1820:
+	.loc 1 627 14 is_stmt 1 view .LVU3978
+	.loc 1 627 14 is_stmt 0 view .LVU3979
+	jmp	.L585
+.LVL824:
+.L586:
+	.loc 1 627 14 view .LVU3980
+.LBE1831:
+.LBE1834:
+	.loc 1 668 9 is_stmt 1 view .LVU3981
+	.loc 1 668 42 is_stmt 0 view .LVU3982
+	movzbl	%al, %edx
+	addl	$1, %eax
+	movb	$11, (%rbx,%rdx)
+	jmp	.L574
+.LVL825:
+	.p2align 4,,10
+	.p2align 3
+.L604:
+.LBB1835:
+.LBB1832:
+.LBB1830:
+	.loc 1 612 17 is_stmt 1 view .LVU3983
+	.loc 1 608 9 view .LVU3984
+	.loc 1 610 13 view .LVU3985
+	.loc 1 610 20 is_stmt 0 view .LVU3986
+	movl	$19200, %edx
+	xorl	%r8d, %r8d
+	movl	$3, %ecx
+	xorl	%esi, %esi
+	movl	$1, %edi
+	call	openSerialPort@PLT
+.LVL826:
+	.loc 1 610 20 view .LVU3987
+	movq	%rax, %rdx
+.LVL827:
+	.loc 1 611 13 is_stmt 1 view .LVU3988
+	.loc 1 611 16 is_stmt 0 view .LVU3989
+	testq	%rax, %rax
+	jne	.L580
+.LVL828:
+	.loc 1 621 9 is_stmt 1 view .LVU3990
+	.loc 1 621 9 is_stmt 0 view .LVU3991
+.LBE1830:
+	.loc 1 627 14 is_stmt 1 view .LVU3992
+	.loc 1 630 5 view .LVU3993
+.LBE1832:
+.LBE1835:
+	.loc 1 692 1 is_stmt 0 view .LVU3994
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL829:
+	.loc 1 692 1 view .LVU3995
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LBB1836:
+.LBB1833:
+	.loc 1 630 62 view .LVU3996
+	jmp	getSerialPortFunctionList@PLT
+.LVL830:
+.L572:
+	.cfi_restore_state
+	.loc 1 630 62 view .LVU3997
+.LBE1833:
+.LBE1836:
+	.loc 1 658 9 is_stmt 1 view .LVU3998
+	.loc 1 658 38 is_stmt 0 view .LVU3999
+	movzbl	activeBoxIdCount(%rip), %edx
+	.loc 1 658 42 view .LVU4000
+	movb	$7, (%rbx,%rdx)
+	.loc 1 658 38 view .LVU4001
+	leal	1(%rdx), %eax
+	jmp	.L573
+.L576:
+	.loc 1 673 9 is_stmt 1 view .LVU4002
+	.loc 1 673 38 is_stmt 0 view .LVU4003
+	movzbl	activeBoxIdCount(%rip), %edx
+	.loc 1 673 42 view .LVU4004
+	movb	$16, (%rbx,%rdx)
+	.loc 1 673 38 view .LVU4005
+	leal	1(%rdx), %eax
+	jmp	.L577
+.L569:
+	.loc 1 651 32 discriminator 1 view .LVU4006
+	movl	$8, %edi
+	call	sensors@PLT
+.LVL831:
+	.loc 1 651 29 discriminator 1 view .LVU4007
+	testb	%al, %al
+	jne	.L571
+	jmp	.L570
+	.cfi_endproc
+.LFE29:
+	.size	mspInit, .-mspInit
+	.section	.text.getMspCommandCount,"ax",@progbits
+	.p2align 4
+	.globl	getMspCommandCount
+	.type	getMspCommandCount, @function
+getMspCommandCount:
+.LFB91:
+	.loc 1 1884 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1885 5 view .LVU4009
+	.loc 1 1886 1 is_stmt 0 view .LVU4010
+	movl	$57, %eax
+	ret
+	.cfi_endproc
+.LFE91:
+	.size	getMspCommandCount, .-getMspCommandCount
+	.section	.text.getMspCommandId,"ax",@progbits
+	.p2align 4
+	.globl	getMspCommandId
+	.type	getMspCommandId, @function
+getMspCommandId:
+.LVL832:
+.LFB92:
+	.loc 1 1889 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1890 5 view .LVU4012
+	.loc 1 1890 30 is_stmt 0 view .LVU4013
+	movzbl	%dil, %edi
+	.loc 1 1890 30 view .LVU4014
+	leaq	mspCommands(%rip), %rax
+	salq	$4, %rdi
+.LVL833:
+	.loc 1 1890 30 view .LVU4015
+	movzwl	(%rax,%rdi), %eax
+	.loc 1 1891 1 view .LVU4016
+	ret
+	.cfi_endproc
+.LFE92:
+	.size	getMspCommandId, .-getMspCommandId
+	.section	.text.getMspCommandStats,"ax",@progbits
+	.p2align 4
+	.globl	getMspCommandStats
+	.type	getMspCommandStats, @function
+getMspCommandStats:
+.LVL834:
+.LFB93:
+	.loc 1 1894 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1895 5 view .LVU4018
+	.loc 1 1895 12 is_stmt 0 view .LVU4019
+	movzbl	%dil, %edi
+	.loc 1 1895 12 view .LVU4020
+	leaq	mspCommandStats(%rip), %rax
+	leaq	(%rdi,%rdi,2), %rdx
+	leaq	(%rax,%rdx,4), %rax
+	.loc 1 1896 1 view .LVU4021
+	ret
+	.cfi_endproc
+.LFE93:
+	.size	getMspCommandStats, .-getMspCommandStats
+	.section	.text.setCurrentPort,"ax",@progbits
+	.p2align 4
+	.globl	setCurrentPort
+	.type	setCurrentPort, @function
+setCurrentPort:
+.LVL835:
+.LFB97:
+	.loc 1 1943 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1944 5 view .LVU4023
+	.loc 1 1945 19 is_stmt 0 view .LVU4024
+	movq	(%rdi), %rax
+	.loc 1 1944 17 view .LVU4025
+	movq	%rdi, currentPort(%rip)
+	.loc 1 1945 5 is_stmt 1 view .LVU4026
+	.loc 1 1945 19 is_stmt 0 view .LVU4027
+	movq	%rax, mspSerialPort(%rip)
+	.loc 1 1946 1 view .LVU4028
+	ret
+	.cfi_endproc
+.LFE97:
+	.size	setCurrentPort, .-setCurrentPort
+	.section	.text.mspProcess,"ax",@progbits
+	.p2align 4
+	.globl	mspProcess
+	.type	mspProcess, @function
+mspProcess:
+.LFB98:
+	.loc 1 1949 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1950 5 view .LVU4030
+	.loc 1 1951 5 view .LVU4031
+	.loc 1 1953 5 view .LVU4032
+.LVL836:
+	.loc 1 1953 35 view .LVU4033
+	.loc 1 1949 1 is_stmt 0 view .LVU4034
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	leaq	mspPorts(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 96
+.LVL837:
+.L625:
+	.loc 1 1954 9 is_stmt 1 view .LVU4035
+	.loc 1 1955 9 view .LVU4036
+	.loc 1 1955 12 is_stmt 0 view .LVU4037
+	cmpl	$1, 316(%r13)
+	je	.L633
+.L611:
+	.loc 1 1953 49 is_stmt 1 discriminator 2 view .LVU4038
+.LVL838:
+	.loc 1 1953 35 discriminator 2 view .LVU4039
+	addq	$344, %r13
+.LVL839:
+	.loc 1 1953 35 is_stmt 0 discriminator 2 view .LVU4040
+	leaq	688+mspPorts(%rip), %rax
+	cmpq	%rax, %r13
+	jne	.L625
+	.loc 1 1966 1 view .LVU4041
+	addq	$40, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL840:
+	.loc 1 1966 1 view .LVU4042
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL841:
+.L633:
+	.cfi_restore_state
+	.loc 1 1959 9 is_stmt 1 view .LVU4043
+.LBB1854:
+.LBI1854:
+	.loc 1 1942 6 view .LVU4044
+.LBB1855:
+	.loc 1 1944 5 view .LVU4045
+	.loc 1 1945 32 is_stmt 0 view .LVU4046
+	movq	0(%r13), %rdi
+	.loc 1 1944 17 view .LVU4047
+	movq	%r13, currentPort(%rip)
+	.loc 1 1945 5 is_stmt 1 view .LVU4048
+	movq	%rsp, %r12
+.LBE1855:
+.LBE1854:
+.LBB1857:
+.LBB1858:
+.LBB1859:
+.LBB1860:
+.LBB1861:
+.LBB1862:
+.LBB1863:
+.LBB1864:
+.LBB1865:
+	.loc 1 1820 32 is_stmt 0 view .LVU4049
+	leaq	mspCommands(%rip), %rbx
+.LBE1865:
+.LBE1864:
+.LBE1863:
+.LBE1862:
+.LBE1861:
+.LBE1860:
+.LBE1859:
+.LBE1858:
+.LBE1857:
+.LBB1899:
+.LBB1856:
+	.loc 1 1945 19 view .LVU4050
+	movq	%rdi, mspSerialPort(%rip)
+.LVL842:
+	.loc 1 1945 19 view .LVU4051
+.LBE1856:
+.LBE1899:
+	.loc 1 1960 9 is_stmt 1 view .LVU4052
+.LBB1900:
+.LBI1857:
+	.loc 1 1929 13 view .LVU4053
+.LBB1898:
+	.loc 1 1931 5 view .LVU4054
+	.loc 1 1932 5 view .LVU4055
+	.loc 1 1933 5 view .LVU4056
+	.loc 1 1935 5 view .LVU4057
+	.p2align 4,,10
+	.p2align 3
+.L612:
+	.loc 1 1935 12 view .LVU4058
+	.loc 1 1935 21 is_stmt 0 view .LVU4059
+	movl	$32, %edx
+	movq	%r12, %rsi
+	call	serialReadBuf@PLT
+.LVL843:
+	.loc 1 1935 12 view .LVU4060
+	testl	%eax, %eax
+	je	.L634
+	movl	%eax, %eax
+	.loc 1 1935 12 view .LVU4061
+	movq	%r12, %r14
+	leaq	(%r12,%rax), %rbp
+	jmp	.L622
+.LVL844:
+	.p2align 4,,10
+	.p2align 3
+.L637:
+.LBB1894:
+.LBB1890:
+	.loc 1 1920 34 view .LVU4062
+	testb	$4, armingFlags(%rip)
+	je	.L635
+.LVL845:
+.L614:
+	.loc 1 1920 34 view .LVU4063
+.LBE1890:
+.LBE1894:
+	.loc 1 1936 45 is_stmt 1 view .LVU4064
+	.loc 1 1936 31 view .LVU4065
+	addq	$1, %r14
+.LVL846:
+	.loc 1 1936 31 is_stmt 0 view .LVU4066
+	cmpq	%r14, %rbp
+	je	.L636
+.LVL847:
+.L622:
+	.loc 1 1937 13 is_stmt 1 view .LVU4067
+	movzbl	(%r14), %r15d
+.LVL848:
+.LBB1895:
+.LBI1859:
+	.loc 1 1916 13 view .LVU4068
+.LBB1891:
+	.loc 1 1918 5 view .LVU4069
+	.loc 1 1918 31 is_stmt 0 view .LVU4070
+	movq	currentPort(%rip), %rax
+	movl	%r15d, %esi
+	leaq	8(%rax), %rdi
+	call	mspFrameParse@PLT
+.LVL849:
+	.loc 1 1920 5 is_stmt 1 view .LVU4071
+	.loc 1 1920 8 is_stmt 0 view .LVU4072
+	testl	%eax, %eax
+	je	.L637
+	.loc 1 1922 12 is_stmt 1 view .LVU4073
+	.loc 1 1922 15 is_stmt 0 view .LVU4074
+	cmpl	$2, %eax
+	jne	.L614
+	.loc 1 1923 9 is_stmt 1 view .LVU4075
+.LBB1887:
+.LBI1861:
+	.loc 1 1899 13 view .LVU4076
+.LBB1884:
+	.loc 1 1901 5 view .LVU4077
+	.loc 1 1903 5 view .LVU4078
+	.loc 1 1903 38 is_stmt 0 view .LVU4079
+	movq	currentPort(%rip), %rax
+.LVL850:
+.LBB1872:
+.LBB1868:
+	.loc 1 1816 13 view .LVU4080
+	movl	$57, %esi
+	.loc 1 1815 13 view .LVU4081
+	xorl	%edi, %edi
+.LBE1868:
+.LBE1872:
+	.loc 1 1904 26 view .LVU4082
+	movl	24(%rax), %edx
+	.loc 1 1903 46 view .LVU4083
+	movzwl	36(%rax), %r8d
+	.loc 1 1904 26 view .LVU4084
+	movl	%edx, 312(%rax)
+	.loc 1 1905 27 view .LVU4085
+	movzwl	38(%rax), %edx
+	.loc 1 1903 25 view .LVU4086
+	movw	%r8w, 310(%rax)
+	.loc 1 1904 5 is_stmt 1 view .LVU4087
+	.loc 1 1905 5 view .LVU4088
+	.loc 1 1905 27 is_stmt 0 view .LVU4089
+	movw	%dx, 48(%rax)
+	.loc 1 1906 5 is_stmt 1 view .LVU4090
+	.loc 1 1906 24 is_stmt 0 view .LVU4091
+	xorl	%edx, %edx
+	movw	%dx, 52(%rax)
+	.loc 1 1908 5 is_stmt 1 view .LVU4092
+.LVL851:
+.LBB1873:
+.LBI1863:
+	.loc 1 1813 28 view .LVU4093
+.LBB1869:
+	.loc 1 1815 5 view .LVU4094
+	.loc 1 1816 5 view .LVU4095
+	.loc 1 1818 5 view .LVU4096
+.L615:
+.LBB1866:
+	.loc 1 1819 31 is_stmt 0 view .LVU4097
+	movzbl	%dil, %r9d
+	jmp	.L616
+.LVL852:
+	.p2align 4,,10
+	.p2align 3
+.L617:
+	.loc 1 1819 9 is_stmt 1 view .LVU4098
+	.loc 1 1819 31 is_stmt 0 view .LVU4099
+	movzbl	%sil, %eax
+	addl	%r9d, %eax
+	.loc 1 1819 39 view .LVU4100
+	sarl	%eax
+.LVL853:
+	.loc 1 1820 9 is_stmt 1 view .LVU4101
+	.loc 1 1820 32 is_stmt 0 view .LVU4102
+	movslq	%eax, %rdx
+	salq	$4, %rdx
+	.loc 1 1820 12 view .LVU4103
+	cmpw	%r8w, (%rbx,%rdx)
+	jb	.L638
+	.loc 1 1819 17 view .LVU4104
+	movl	%eax, %esi
+.LVL854:
+.L616:
+	.loc 1 1819 17 view .LVU4105
+.LBE1866:
+	.loc 1 1818 16 is_stmt 1 view .LVU4106
+	cmpb	%sil, %dil
+	jb	.L617
+	.loc 1 1827 5 view .LVU4107
+	.loc 1 1827 8 is_stmt 0 view .LVU4108
+	cmpb	$57, %dil
+	je	.L620
+	.loc 1 1827 81 view .LVU4109
+	movzbl	%dil, %eax
+	salq	$4, %rax
+	.loc 1 1827 62 view .LVU4110
+	cmpw	(%rbx,%rax), %r8w
+	je	.L639
+.LVL855:
+.L620:
+	.loc 1 1827 62 view .LVU4111
+.LBE1869:
+.LBE1873:
+	.loc 1 1911 9 is_stmt 1 view .LVU4112
+.LBB1874:
+.LBI1874:
+	.loc 1 502 6 view .LVU4113
+.LBB1875:
+	.loc 1 504 5 view .LVU4114
+	xorl	%esi, %esi
+	movl	$1, %edi
+	call	headSerialResponse
+.LVL856:
+.L619:
+	.loc 1 504 5 is_stmt 0 view .LVU4115
+.LBE1875:
+.LBE1874:
+	.loc 1 1913 5 is_stmt 1 view .LVU4116
+.LBB1876:
+.LBI1876:
+	.loc 1 507 6 view .LVU4117
+.LBB1877:
+	.loc 1 509 5 view .LVU4118
+	.loc 1 509 27 is_stmt 0 view .LVU4119
+	movq	currentPort(%rip), %rax
+	.loc 1 509 5 view .LVU4120
+	movzbl	50(%rax), %edi
+	call	serialize8
+.LVL857:
+	.loc 1 510 5 is_stmt 1 view .LVU4121
+.LBB1878:
+.LBI1878:
+	.loc 1 387 13 view .LVU4122
+.LBB1879:
+	.loc 1 389 5 view .LVU4123
+	.loc 1 389 20 is_stmt 0 view .LVU4124
+	movq	currentPort(%rip), %rax
+	.loc 1 389 8 view .LVU4125
+	cmpq	$0, 320(%rax)
+	je	.L621
+	.loc 1 390 9 is_stmt 1 view .LVU4126
+	movzwl	330(%rax), %esi
+	movq	mspSerialPort(%rip), %rdi
+	call	serialTxCommit@PLT
+.LVL858:
+	.loc 1 391 9 view .LVU4127
+	.loc 1 391 20 is_stmt 0 view .LVU4128
+	movq	currentPort(%rip), %rax
+	.loc 1 391 33 view .LVU4129
+	movq	$0, 320(%rax)
+.L621:
+.LBE1879:
+.LBE1878:
+	.loc 1 511 5 is_stmt 1 view .LVU4130
+.LBE1877:
+.LBE1876:
+.LBE1884:
+.LBE1887:
+.LBE1891:
+.LBE1895:
+	.loc 1 1936 31 is_stmt 0 view .LVU4131
+	addq	$1, %r14
+.LVL859:
+.LBB1896:
+.LBB1892:
+.LBB1888:
+.LBB1885:
+.LBB1881:
+.LBB1880:
+	.loc 1 511 31 view .LVU4132
+	movb	$0, 332(%rax)
+.LVL860:
+	.loc 1 511 31 view .LVU4133
+.LBE1880:
+.LBE1881:
+.LBE1885:
+.LBE1888:
+.LBE1892:
+.LBE1896:
+	.loc 1 1936 45 is_stmt 1 view .LVU4134
+	.loc 1 1936 31 view .LVU4135
+	cmpq	%r14, %rbp
+	jne	.L622
+	.p2align 4,,10
+	.p2align 3
+.L636:
+	.loc 1 1935 21 is_stmt 0 view .LVU4136
+	movq	mspSerialPort(%rip), %rdi
+	jmp	.L612
+.LVL861:
+	.p2align 4,,10
+	.p2align 3
+.L635:
+.LBB1897:
+.LBB1893:
+	.loc 1 1921 9 is_stmt 1 view .LVU4137
+	movl	%r15d, %edi
+	call	evaluateOtherData@PLT
+.LVL862:
+	.loc 1 1921 9 is_stmt 0 view .LVU4138
+	jmp	.L614
+.LVL863:
+	.p2align 4,,10
+	.p2align 3
+.L638:
+.LBB1889:
+.LBB1886:
+.LBB1882:
+.LBB1870:
+.LBB1867:
+	.loc 1 1821 13 is_stmt 1 view .LVU4139
+	.loc 1 1821 17 is_stmt 0 view .LVU4140
+	leal	1(%rax), %edi
+.LVL864:
+	.loc 1 1821 17 view .LVU4141
+	jmp	.L615
+.LVL865:
+	.p2align 4,,10
+	.p2align 3
+.L639:
+	.loc 1 1821 17 view .LVU4142
+.LBE1867:
+	.loc 1 1828 9 is_stmt 1 view .LVU4143
+	.loc 1 1828 9 is_stmt 0 view .LVU4144
+.LBE1870:
+.LBE1882:
+	.loc 1 1909 5 is_stmt 1 view .LVU4145
+.LBB1883:
+.LBB1871:
+	.loc 1 1828 16 is_stmt 0 view .LVU4146
+	movq	%rax, %rdi
+	addq	%rbx, %rdi
+.LBE1871:
+.LBE1883:
+	.loc 1 1909 22 view .LVU4147
+	call	processCommand
+.LVL866:
+	.loc 1 1909 18 view .LVU4148
+	testb	%al, %al
+	je	.L620
+	jmp	.L619
+.LVL867:
+.L634:
+	.loc 1 1909 18 view .LVU4149
+.LBE1886:
+.LBE1889:
+.LBE1893:
+.LBE1897:
+.LBE1898:
+.LBE1900:
+	.loc 1 1962 9 is_stmt 1 view .LVU4150
+	.loc 1 1962 12 is_stmt 0 view .LVU4151
+	cmpb	$0, isRebootScheduled(%rip)
+	je	.L611
+	.loc 1 1963 13 is_stmt 1 view .LVU4152
+	call	systemReset@PLT
+.LVL868:
+	jmp	.L611
+	.cfi_endproc
+.LFE98:
+	.size	mspProcess, .-mspProcess
+	.section	.text.mspSetTelemetryPort,"ax",@progbits
+	.p2align 4
+	.globl	mspSetTelemetryPort
+	.type	mspSetTelemetryPort, @function
+mspSetTelemetryPort:
+.LVL869:
+.LFB99:
+	.loc 1 1986 1 view -0
+	.cfi_startproc
+	.loc 1 1987 5 view .LVU4154
+	.loc 1 1988 5 view .LVU4155
+	.loc 1 1989 5 view .LVU4156
+	.loc 1 1992 5 view .LVU4157
+	.loc 1 1992 39 view .LVU4158
+	.loc 1 1993 9 view .LVU4159
+	.loc 1 1994 9 view .LVU4160
+	.loc 1 1994 26 is_stmt 0 view .LVU4161
+	movl	316+mspPorts(%rip), %eax
+	.loc 1 1986 1 view .LVU4162
+	movq	%rdi, %rsi
+	.loc 1 1994 26 view .LVU4163
+	leaq	mspPorts(%rip), %rdx
+	.loc 1 1994 12 view .LVU4164
+	cmpl	$2, %eax
+	je	.L644
+	.loc 1 1992 65 is_stmt 1 view .LVU4165
+.LVL870:
+	.loc 1 1992 39 view .LVU4166
+	.loc 1 1993 9 view .LVU4167
+	.loc 1 1994 9 view .LVU4168
+	.loc 1 1994 12 is_stmt 0 view .LVU4169
+	cmpl	$2, 660+mspPorts(%rip)
+	je	.L648
+.LVL871:
+	.loc 1 1999 5 is_stmt 1 view .LVU4170
+	.loc 1 2002 13 view .LVU4171
+	.loc 1 2003 13 view .LVU4172
+	.loc 1 2002 38 is_stmt 0 view .LVU4173
+	xorl	%ecx, %ecx
+	.loc 1 2003 16 view .LVU4174
+	testl	%eax, %eax
+	jne	.L653
+.LVL872:
+.L642:
+	.loc 1 2002 27 view .LVU4175
+	imulq	$344, %rcx, %rcx
+	addq	%rcx, %rdx
+.LVL873:
+	.loc 1 2008 5 is_stmt 1 view .LVU4176
+	.loc 1 2009 5 view .LVU4177
+.L644:
+.LBB1903:
+.LBB1904:
+	.loc 1 588 5 is_stmt 0 view .LVU4178
+	movq	%rdx, %rdi
+.LVL874:
+	.loc 1 588 5 view .LVU4179
+	movl	$43, %ecx
+	xorl	%eax, %eax
+.LBE1904:
+.LBE1903:
+	.loc 1 2008 22 view .LVU4180
+	movq	%rdx, mspTelemetryPort(%rip)
+	.loc 1 2013 5 is_stmt 1 view .LVU4181
+.LVL875:
+.LBB1906:
+.LBI1903:
+	.loc 1 586 13 view .LVU4182
+.LBB1905:
+	.loc 1 588 5 view .LVU4183
+	rep stosq
+	.loc 1 590 5 view .LVU4184
+	.loc 1 590 26 is_stmt 0 view .LVU4185
+	movq	%rsi, (%rdx)
+	.loc 1 591 5 is_stmt 1 view .LVU4186
+	.loc 1 592 5 is_stmt 0 view .LVU4187
+	leaq	8(%rdx), %rdi
+	.loc 1 592 63 view .LVU4188
+	leaq	54(%rdx), %rsi
+.LVL876:
+	.loc 1 591 34 view .LVU4189
+	movl	$2, 316(%rdx)
+	.loc 1 592 5 is_stmt 1 view .LVU4190
+	movl	$256, %edx
+.LVL877:
+	.loc 1 592 5 is_stmt 0 view .LVU4191
+	jmp	mspFrameParserInit@PLT
+.LVL878:
+	.p2align 4,,10
+	.p2align 3
+.L648:
+	.loc 1 592 5 view .LVU4192
+.LBE1905:
+.LBE1906:
+	.loc 1 1993 23 view .LVU4193
+	leaq	344+mspPorts(%rip), %rdx
+.LVL879:
+	.loc 1 2008 5 is_stmt 1 view .LVU4194
+	.loc 1 2009 5 view .LVU4195
+	jmp	.L644
+.LVL880:
+	.p2align 4,,10
+	.p2align 3
+.L653:
+	.loc 1 2001 69 view .LVU4196
+	.loc 1 2001 43 view .LVU4197
+	.loc 1 2002 13 view .LVU4198
+	.loc 1 2003 13 view .LVU4199
+	.loc 1 2003 16 is_stmt 0 view .LVU4200
+	movl	660+mspPorts(%rip), %ecx
+	testl	%ecx, %ecx
+	je	.L654
+.LVL881:
+	.loc 1 2008 5 is_stmt 1 view .LVU4201
+	.loc 1 2008 22 is_stmt 0 view .LVU4202
+	xorl	%eax, %eax
+	movq	%rax, mspTelemetryPort(%rip)
+	.loc 1 2009 5 is_stmt 1 view .LVU4203
+	.loc 1 2014 1 is_stmt 0 view .LVU4204
+	ret
+.LVL882:
+	.p2align 4,,10
+	.p2align 3
+.L654:
+	.loc 1 2002 38 view .LVU4205
+	movl	$1, %ecx
+	jmp	.L642
+	.cfi_endproc
+.LFE99:
+	.size	mspSetTelemetryPort, .-mspSetTelemetryPort
+	.section	.text.sendMspTelemetry,"ax",@progbits
+	.p2align 4
+	.globl	sendMspTelemetry
+	.type	sendMspTelemetry, @function
+sendMspTelemetry:
+.LFB100:
+	.loc 1 2017 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2018 5 view .LVU4207
+	.loc 1 2020 5 view .LVU4208
+	.loc 1 2020 9 is_stmt 0 view .LVU4209
+	movq	mspTelemetryPort(%rip), %rax
+	.loc 1 2020 8 view .LVU4210
+	testq	%rax, %rax
+	je	.L669
+	.loc 1 2024 5 is_stmt 1 view .LVU4211
+.LVL883:
+.LBB1914:
+.LBI1914:
+	.loc 1 1942 6 view .LVU4212
+.LBB1915:
+	.loc 1 1944 5 view .LVU4213
+.LBE1915:
+.LBE1914:
+	.loc 1 2017 1 is_stmt 0 view .LVU4214
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB1919:
+.LBB1916:
+	.loc 1 1945 19 view .LVU4215
+	movq	(%rax), %rdx
+.LBE1916:
+.LBE1919:
+	.loc 1 2026 54 view .LVU4216
+	leaq	mspTelemetryCommandSequence(%rip), %rcx
+.LBB1920:
+.LBB1917:
+	.loc 1 1944 17 view .LVU4217
+	movq	%rax, currentPort(%rip)
+	.loc 1 1945 5 is_stmt 1 view .LVU4218
+.LBE1917:
+.LBE1920:
+.LBB1921:
+.LBB1922:
+.LBB1923:
+.LBB1924:
+	.loc 1 1815 13 is_stmt 0 view .LVU4219
+	xorl	%esi, %esi
+.LBB1925:
+	.loc 1 1820 32 view .LVU4220
+	leaq	mspCommands(%rip), %r9
+.LBE1925:
+.LBE1924:
+.LBE1923:
+.LBE1922:
+.LBE1921:
+.LBB1939:
+.LBB1918:
+	.loc 1 1945 19 view .LVU4221
+	movq	%rdx, mspSerialPort(%rip)
+.LVL884:
+	.loc 1 1945 19 view .LVU4222
+.LBE1918:
+.LBE1939:
+	.loc 1 2026 5 is_stmt 1 view .LVU4223
+	.loc 1 2026 54 is_stmt 0 view .LVU4224
+	movl	sequenceIndex.0(%rip), %edx
+	movzbl	(%rcx,%rdx), %edi
+.LBB1940:
+.LBB1936:
+.LBB1932:
+.LBB1928:
+	.loc 1 1816 13 view .LVU4225
+	movl	$57, %ecx
+.LBE1928:
+.LBE1932:
+.LBE1936:
+.LBE1940:
+	.loc 1 2026 25 view .LVU4226
+	movw	%di, 310(%rax)
+	.loc 1 2027 5 is_stmt 1 view .LVU4227
+.LVL885:
+.LBB1941:
+.LBI1921:
+	.loc 1 1872 12 view .LVU4228
+.LBB1937:
+	.loc 1 1874 5 view .LVU4229
+.LBB1933:
+.LBI1923:
+	.loc 1 1813 28 view .LVU4230
+.L658:
+.LBB1929:
+.LBB1926:
+	.loc 1 1819 31 is_stmt 0 view .LVU4231
+	movzbl	%sil, %r8d
+	jmp	.L659
+.LVL886:
+	.p2align 4,,10
+	.p2align 3
+.L660:
+	.loc 1 1819 9 is_stmt 1 view .LVU4232
+	.loc 1 1819 31 is_stmt 0 view .LVU4233
+	movzbl	%cl, %eax
+	addl	%r8d, %eax
+	.loc 1 1819 39 view .LVU4234
+	sarl	%eax
+.LVL887:
+	.loc 1 1820 9 is_stmt 1 view .LVU4235
+	.loc 1 1820 32 is_stmt 0 view .LVU4236
+	movslq	%eax, %rdx
+	salq	$4, %rdx
+	.loc 1 1820 12 view .LVU4237
+	cmpw	%di, (%r9,%rdx)
+	jb	.L672
+	.loc 1 1819 17 view .LVU4238
+	movl	%eax, %ecx
+.LVL888:
+.L659:
+	.loc 1 1819 17 view .LVU4239
+.LBE1926:
+	.loc 1 1818 16 is_stmt 1 view .LVU4240
+	cmpb	%cl, %sil
+	jb	.L660
+	.loc 1 1827 5 view .LVU4241
+	.loc 1 1827 8 is_stmt 0 view .LVU4242
+	cmpb	$57, %sil
+	je	.L661
+	.loc 1 1827 81 view .LVU4243
+	movzbl	%sil, %eax
+	leaq	mspCommands(%rip), %rdx
+	salq	$4, %rax
+	addq	%rdx, %rax
+	.loc 1 1827 62 view .LVU4244
+	cmpw	(%rax), %di
+	je	.L673
+.LVL889:
+.L661:
+	.loc 1 1827 62 view .LVU4245
+.LBE1929:
+.LBE1933:
+.LBE1937:
+.LBE1941:
+	.loc 1 2028 5 is_stmt 1 view .LVU4246
+	call	tailSerialReply
+.LVL890:
+	.loc 1 2030 5 view .LVU4247
+	.loc 1 2030 18 is_stmt 0 view .LVU4248
+	movl	sequenceIndex.0(%rip), %eax
+	xorl	%edx, %edx
+	addl	$1, %eax
+	.loc 1 2031 5 is_stmt 1 view .LVU4249
+	.loc 1 2030 18 is_stmt 0 view .LVU4250
+	cmpl	$9, %eax
+	cmova	%edx, %eax
+	movl	%eax, sequenceIndex.0(%rip)
+	.loc 1 2034 1 view .LVU4251
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL891:
+	.p2align 4,,10
+	.p2align 3
+.L672:
+	.cfi_restore_state
+.LBB1942:
+.LBB1938:
+.LBB1934:
+.LBB1930:
+.LBB1927:
+	.loc 1 1821 13 is_stmt 1 view .LVU4252
+	.loc 1 1821 17 is_stmt 0 view .LVU4253
+	leal	1(%rax), %esi
+.LVL892:
+	.loc 1 1821 17 view .LVU4254
+	jmp	.L658
+.LVL893:
+	.p2align 4,,10
+	.p2align 3
+.L673:
+	.loc 1 1821 17 view .LVU4255
+.LBE1927:
+	.loc 1 1828 9 is_stmt 1 view .LVU4256
+	.loc 1 1828 9 is_stmt 0 view .LVU4257
+.LBE1930:
+.LBE1934:
+	.loc 1 1876 5 is_stmt 1 view .LVU4258
+	.loc 1 1876 18 is_stmt 0 view .LVU4259
+	cmpb	$0, 2(%rax)
+	jne	.L661
+	.loc 1 1879 5 is_stmt 1 view .LVU4260
+.LBB1935:
+.LBB1931:
+	.loc 1 1828 16 is_stmt 0 view .LVU4261
+	movq	%rax, %rdi
+.LVL894:
+	.loc 1 1828 16 view .LVU4262
+.LBE1931:
+.LBE1935:
+	.loc 1 1879 12 view .LVU4263
+	call	processCommand
+.LVL895:
+	.loc 1 1879 12 view .LVU4264
+	jmp	.L661
+.LVL896:
+	.p2align 4,,10
+	.p2align 3
+.L669:
+	.cfi_def_cfa_offset 8
+	.loc 1 1879 12 view .LVU4265
+	ret
+.LBE1938:
+.LBE1942:
+	.cfi_endproc
+.LFE100:
+	.size	sendMspTelemetry, .-sendMspTelemetry
+	.section	.bss.sequenceIndex.0,"aw",@nobits
+	.align 4
+	.type	sequenceIndex.0, @object
+	.size	sequenceIndex.0, 4
+sequenceIndex.0:
+	.zero	4
+	.section	.bss.mspTelemetryPort,"aw",@nobits
+	.align 8
+	.type	mspTelemetryPort, @object
+	.size	mspTelemetryPort, 8
+mspTelemetryPort:
+	.zero	8
+	.section	.rodata.mspTelemetryCommandSequence,"a"
+	.align 8
+	.type	mspTelemetryCommandSequence, @object
+	.size	mspTelemetryCommandSequence, 10
+mspTelemetryCommandSequence:
+	.ascii	"tedfmjislg"
+	.section	.bss.mspCommandStats,"aw",@nobits
+	.align 32
+	.type	mspCommandStats, @object
+	.size	mspCommandStats, 684
+mspCommandStats:
+	.zero	684
+	.section	.data.rel.ro.local.mspCommands,"aw"
+	.align 32
+	.type	mspCommands, @object
+	.size	mspCommands, 912
+mspCommands:
+	.value	1
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspApiVersion
+	.value	32
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspChannelForwarding
+	.value	33
+	.byte	1
+	.zero	1
+	.value	8
+	.byte	0
+	.zero	1
+	.quad	mspSetChannelForwarding
+	.value	34
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspModeRanges
+	.value	35
+	.byte	1
+	.zero	1
+	.value	5
+	.byte	0
+	.zero	1
+	.quad	mspSetModeRange
+	.value	36
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspFeature
+	.value	37
+	.byte	1
+	.zero	1
+	.value	4
+	.byte	0
+	.zero	1
+	.quad	mspSetFeature
+	.value	38
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspBoardAlignment
+	.value	39
+	.byte	1
+	.zero	1
+	.value	6
+	.byte	0
+	.zero	1
+	.quad	mspSetBoardAlignment
+	.value	40
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspCurrentMeterConfig
+	.value	41
+	.byte	1
+	.zero	1
+	.value	4
+	.byte	0
+	.zero	1
+	.quad	mspSetCurrentMeterConfig
+	.value	42
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspMixer
+	.value	43
+	.byte	1
+	.zero	1
+	.value	1
+	.byte	0
+	.zero	1
+	.quad	mspSetMixer
+	.value	44
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRxConfig
+	.value	45
+	.byte	1
+	.zero	1
+	.value	7
+	.byte	0
+	.zero	1
+	.quad	mspSetRxConfig
+	.value	50
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRssiConfig
+	.value	51
+	.byte	1
+	.zero	1
+	.value	1
+	.byte	0
+	.zero	1
+	.quad	mspSetRssiConfig
+	.value	52
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspProfile
+	.value	64
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRxMap
+	.value	65
+	.byte	1
+	.zero	1
+	.value	8
+	.byte	0
+	.zero	1
+	.quad	mspSetRxMap
+	.value	68
+	.byte	1
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspReboot
+	.value	100
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspIdent
+	.value	101
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspStatus
+	.value	102
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRawImu
+	.value	103
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspServo
+	.value	104
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspMotor
+	.value	105
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRc
+	.value	108
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspAttitude
+	.value	109
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspAltitude
+	.value	110
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspAnalog
+	.value	111
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspRcTuning
+	.value	112
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspPid
+	.value	114
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspMisc
+	.value	115
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspMotorPins
+	.value	116
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspBoxNames
+	.value	117
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspPidNames
+	.value	119
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspBoxIds
+	.value	120
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspServoConf
+	.value	160
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspUid
+	.value	200
+	.byte	1
+	.zero	1
+	.value	16
+	.byte	0
+	.zero	1
+	.quad	mspSetRawRc
+	.value	202
+	.byte	1
+	.zero	1
+	.value	30
+	.byte	0
+	.zero	1
+	.quad	mspSetPid
+	.value	204
+	.byte	1
+	.zero	1
+	.value	7
+	.byte	0
+	.zero	1
+	.quad	mspSetRcTuning
+	.value	205
+	.byte	1
+	.zero	1
+	.value	0
+	.byte	1
+	.zero	1
+	.quad	mspAccCalibration
+	.value	206
+	.byte	1
+	.zero	1
+	.value	0
+	.byte	1
+	.zero	1
+	.quad	mspMagCalibration
+	.value	207
+	.byte	1
+	.zero	1
+	.value	22
+	.byte	0
+	.zero	1
+	.quad	mspSetMisc
+	.value	208
+	.byte	1
+	.zero	1
+	.value	0
+	.byte	1
+	.zero	1
+	.quad	mspResetConf
+	.value	210
+	.byte	1
+	.zero	1
+	.value	1
+	.byte	1
+	.zero	1
+	.quad	mspSelectSetting
+	.value	211
+	.byte	1
+	.zero	1
+	.value	2
+	.byte	0
+	.zero	1
+	.quad	mspSetHead
+	.value	212
+	.byte	1
+	.zero	1
+	.value	56
+	.byte	0
+	.zero	1
+	.quad	mspSetServoConf
+	.value	214
+	.byte	1
+	.zero	1
+	.value	16
+	.byte	0
+	.zero	1
+	.quad	mspSetMotor
+	.value	239
+	.byte	1
+	.zero	1
+	.value	4
+	.byte	0
+	.zero	1
+	.quad	mspSetAccTrim
+	.value	240
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspAccTrim
+	.value	250
+	.byte	1
+	.zero	1
+	.value	0
+	.byte	1
+	.zero	1
+	.quad	mspEepromWrite
+	.value	254
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspDebug
+	.value	4096
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspBatch
+	.value	4097
+	.byte	0
+	.zero	1
+	.value	0
+	.byte	0
+	.zero	1
+	.quad	mspConfigDump
+	.value	4098
+	.byte	1
+	.zero	1
+	.value	1
+	.byte	1
+	.zero	1
+	.quad	mspSetConfigDump
+	.section	.bss.currentPort,"aw",@nobits
+	.align 8
+	.type	currentPort, @object
+	.size	currentPort, 8
+currentPort:
+	.zero	8
+	.section	.bss.mspPorts,"aw",@nobits
+	.align 32
+	.type	mspPorts, @object
+	.size	mspPorts, 688
+mspPorts:
+	.zero	688
+	.section	.rodata.pidnames,"a"
+	.align 32
+	.type	pidnames, @object
+	.size	pidnames, 48
+pidnames:
+	.string	"ROLL;PITCH;YAW;ALT;Pos;PosR;NavR;LEVEL;MAG;VEL;"
+	.section	.bss.isRebootScheduled,"aw",@nobits
+	.type	isRebootScheduled, @object
+	.size	isRebootScheduled, 1
+isRebootScheduled:
+	.zero	1
+	.section	.bss.activeBoxIdCount,"aw",@nobits
+	.type	activeBoxIdCount, @object
+	.size	activeBoxIdCount, 1
+activeBoxIdCount:
+	.zero	1
+	.section	.bss.activeBoxIds,"aw",@nobits
+	.align 16
+	.type	activeBoxIds, @object
+	.size	activeBoxIds, 22
+activeBoxIds:
+	.zero	22
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC5:
+	.string	"ARM;"
+.LC6:
+	.string	"ANGLE;"
+.LC7:
+	.string	"HORIZON;"
+.LC8:
+	.string	"BARO;"
+.LC9:
+	.string	"MAG;"
+.LC10:
+	.string	"HEADFREE;"
+.LC11:
+	.string	"HEADADJ;"
+.LC12:
+	.string	"CAMSTAB;"
+.LC13:
+	.string	"CAMTRIG;"
+.LC14:
+	.string	"GPS HOME;"
+.LC15:
+	.string	"GPS HOLD;"
+.LC16:
+	.string	"PASSTHRU;"
+.LC17:
+	.string	"BEEPER;"
+.LC18:
+	.string	"LEDMAX;"
+.LC19:
+	.string	"LEDLOW;"
+.LC20:
+	.string	"LLIGHTS;"
+.LC21:
+	.string	"CALIB;"
+.LC22:
+	.string	"GOVERNOR;"
+.LC23:
+	.string	"OSD SW;"
+.LC24:
+	.string	"TELEMETRY;"
+.LC25:
+	.string	"AUTOTUNE;"
+.LC26:
+	.string	"SONAR;"
+	.section	.data.rel.ro.local.boxes,"aw"
+	.align 32
+	.type	boxes, @object
+	.size	boxes, 552
+boxes:
+	.byte	0
+	.zero	7
+	.quad	.LC5
+	.byte	0
+	.zero	7
+	.byte	1
+	.zero	7
+	.quad	.LC6
+	.byte	1
+	.zero	7
+	.byte	2
+	.zero	7
+	.quad	.LC7
+	.byte	2
+	.zero	7
+	.byte	3
+	.zero	7
+	.quad	.LC8
+	.byte	3
+	.zero	7
+	.byte	4
+	.zero	7
+	.quad	.LC9
+	.byte	5
+	.zero	7
+	.byte	5
+	.zero	7
+	.quad	.LC10
+	.byte	6
+	.zero	7
+	.byte	6
+	.zero	7
+	.quad	.LC11
+	.byte	7
+	.zero	7
+	.byte	7
+	.zero	7
+	.quad	.LC12
+	.byte	8
+	.zero	7
+	.byte	8
+	.zero	7
+	.quad	.LC13
+	.byte	9
+	.zero	7
+	.byte	9
+	.zero	7
+	.quad	.LC14
+	.byte	10
+	.zero	7
+	.byte	10
+	.zero	7
+	.quad	.LC15
+	.byte	11
+	.zero	7
+	.byte	11
+	.zero	7
+	.quad	.LC16
+	.byte	12
+	.zero	7
+	.byte	12
+	.zero	7
+	.quad	.LC17
+	.byte	13
+	.zero	7
+	.byte	13
+	.zero	7
+	.quad	.LC18
+	.byte	14
+	.zero	7
+	.byte	14
+	.zero	7
+	.quad	.LC19
+	.byte	15
+	.zero	7
+	.byte	15
+	.zero	7
+	.quad	.LC20
+	.byte	16
+	.zero	7
+	.byte	16
+	.zero	7
+	.quad	.LC21
+	.byte	17
+	.zero	7
+	.byte	17
+	.zero	7
+	.quad	.LC22
+	.byte	18
+	.zero	7
+	.byte	18
+	.zero	7
+	.quad	.LC23
+	.byte	19
+	.zero	7
+	.byte	19
+	.zero	7
+	.quad	.LC24
+	.byte	20
+	.zero	7
+	.byte	20
+	.zero	7
+	.quad	.LC25
+	.byte	21
+	.zero	7
+	.byte	21
+	.zero	7
+	.quad	.LC26
+	.byte	22
+	.zero	7
+	.byte	22
+	.zero	7
+	.quad	0
+	.byte	-1
+	.zero	7
+	.globl	boardIdentifier
+	.section	.rodata.str1.1
+.LC27:
+	.string	"SITL"
+	.section	.data.rel.local.boardIdentifier,"aw"
+	.align 8
+	.type	boardIdentifier, @object
+	.size	boardIdentifier, 8
+boardIdentifier:
+	.quad	.LC27
+	.section	.bss.mspSerialPort,"aw",@nobits
+	.align 8
+	.type	mspSerialPort, @object
+	.size	mspSerialPort, 8
+mspSerialPort:
+	.zero	8
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC1:
+	.long	1092616192
+	.align 4
+.LC2:
+	.long	1120403456
+	.align 4
+.LC3:
+	.long	1148846080
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC4:
+	.long	1
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/common/color.h"
+	.file 7 ".//src/main/common/profiling.h"
+	.file 8 ".//src/main/build_config.h"
+	.file 9 ".//src/main/drivers/accgyro.h"
+	.file 10 ".//src/main/common/ring_buffer.h"
+	.file 11 ".//src/main/drivers/serial.h"
+	.file 12 ".//src/main/drivers/pwm_rx.h"
+	.file 13 ".//src/main/flight/flight.h"
+	.file 14 ".//src/main/flight/mixer.h"
+	.file 15 ".//src/main/flight/failsafe.h"
+	.file 16 ".//src/main/rx/rx.h"
+	.file 17 ".//src/main/io/escservo.h"
+	.file 18 ".//src/main/io/rc_controls.h"
+	.file 19 ".//src/main/io/gimbal.h"
+	.file 20 ".//src/main/io/serial.h"
+	.file 21 ".//src/main/io/msp_frame.h"
+	.file 22 ".//src/main/telemetry/telemetry.h"
+	.file 23 ".//src/main/sensors/boardalignment.h"
+	.file 24 ".//src/main/sensors/sensors.h"
+	.file 25 ".//src/main/sensors/battery.h"
+	.file 26 ".//src/main/sensors/acceleration.h"
+	.file 27 ".//src/main/sensors/barometer.h"
+	.file 28 ".//src/main/sensors/compass.h"
+	.file 29 ".//src/main/sensors/gyro.h"
+	.file 30 ".//src/main/config/runtime_config.h"
+	.file 31 ".//src/main/config/config.h"
+	.file 32 ".//src/main/config/config_profile.h"
+	.file 33 ".//src/main/config/config_master.h"
+	.file 34 ".//src/main/config/config_values.h"
+	.file 35 ".//src/main/config/config_dump.h"
+	.file 36 ".//src/main/version.h"
+	.file 37 ".//src/main/io/serial_msp.h"
+	.file 38 ".//src/main/drivers/system.h"
+	.file 39 ".//src/main/common/maths.h"
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 41 ".//src/main/rx/msp.h"
+	.file 42 "/usr/include/string.h"
+	.file 43 ".//src/main/common/crc.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7a96
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x4a
+	.long	.LASF2278
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL450
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1548
+	.uleb128 0x21
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1549
+	.uleb128 0x21
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1550
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1551
+	.uleb128 0x9
+	.long	.LASF1553
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0x21
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1552
+	.uleb128 0x9
+	.long	.LASF1554
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x9
+	.long	.LASF1555
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0x21
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1556
+	.uleb128 0x9
+	.long	.LASF1557
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x9
+	.long	.LASF1558
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	.LASF1559
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1560
+	.uleb128 0x9
+	.long	.LASF1561
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x4c
+	.byte	0x8
+	.uleb128 0x10
+	.long	0xc1
+	.uleb128 0x21
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1562
+	.uleb128 0x1f
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF1563
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x9
+	.long	.LASF1564
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x9
+	.long	.LASF1565
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x9
+	.long	.LASF1566
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4d
+	.long	0xf1
+	.uleb128 0x1f
+	.long	0xf1
+	.uleb128 0x9
+	.long	.LASF1567
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x9
+	.long	.LASF1568
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x9
+	.long	.LASF1569
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0xae
+	.uleb128 0x9
+	.long	.LASF1570
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1571
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1572
+	.uleb128 0x10
+	.long	0xc8
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1573
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1574
+	.uleb128 0x16
+	.long	0xd9
+	.long	0x168
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1596
+	.byte	0x8
+	.byte	0x26
+	.byte	0x10
+	.long	0x158
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x6
+	.byte	0x15
+	.long	0x192
+	.uleb128 0x3
+	.long	.LASF1575
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1576
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1577
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x7
+	.byte	0x14
+	.long	0x1da
+	.uleb128 0x3
+	.long	.LASF1578
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1579
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1580
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1581
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1582
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1585
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1586
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1587
+	.byte	0x9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1588
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x3
+	.long	0x192
+	.uleb128 0x12
+	.long	.LASF1598
+	.byte	0x30
+	.byte	0x7
+	.byte	0x24
+	.byte	0x10
+	.long	0x242
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0x7
+	.byte	0x25
+	.byte	0xe
+	.long	0x113
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0x7
+	.byte	0x26
+	.byte	0xe
+	.long	0x113
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1591
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0x113
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1592
+	.byte	0x7
+	.byte	0x28
+	.byte	0xe
+	.long	0x113
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1593
+	.byte	0x7
+	.byte	0x29
+	.byte	0xe
+	.long	0x11f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0x7
+	.byte	0x2a
+	.byte	0xe
+	.long	0x242
+	.byte	0x18
+	.byte	0
+	.uleb128 0x16
+	.long	0x107
+	.long	0x252
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1595
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x3
+	.long	0x1e6
+	.uleb128 0x1f
+	.long	0x252
+	.uleb128 0x15
+	.long	.LASF1597
+	.byte	0x9
+	.byte	0x14
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x12
+	.long	.LASF1599
+	.byte	0x10
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x10
+	.long	0x2be
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x17
+	.long	0x2be
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1601
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1602
+	.byte	0xa
+	.byte	0x1e
+	.byte	0xe
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1603
+	.byte	0xa
+	.byte	0x1f
+	.byte	0xe
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1604
+	.byte	0xa
+	.byte	0x20
+	.byte	0xe
+	.long	0x107
+	.byte	0xe
+	.byte	0
+	.uleb128 0x10
+	.long	0xfd
+	.uleb128 0x9
+	.long	.LASF1605
+	.byte	0xa
+	.byte	0x21
+	.byte	0x3
+	.long	0x26f
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0xb
+	.byte	0x16
+	.long	0x2e7
+	.uleb128 0x3
+	.long	.LASF1606
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1607
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1608
+	.byte	0xb
+	.byte	0x19
+	.byte	0x3
+	.long	0x2cf
+	.uleb128 0x43
+	.long	.LASF1613
+	.long	0x43
+	.byte	0xb
+	.byte	0x1b
+	.long	0x31b
+	.uleb128 0x3
+	.long	.LASF1609
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1610
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1611
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1612
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1613
+	.byte	0xb
+	.byte	0x20
+	.byte	0x3
+	.long	0x2f3
+	.uleb128 0x9
+	.long	.LASF1614
+	.byte	0xb
+	.byte	0x22
+	.byte	0x10
+	.long	0x333
+	.uleb128 0x10
+	.long	0x338
+	.uleb128 0x2b
+	.long	0x343
+	.uleb128 0xa
+	.long	0x107
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1615
+	.byte	0xb
+	.byte	0x23
+	.byte	0x10
+	.long	0x34f
+	.uleb128 0x10
+	.long	0x354
+	.uleb128 0x2b
+	.long	0x364
+	.uleb128 0xa
+	.long	0x364
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x10
+	.long	0x102
+	.uleb128 0x12
+	.long	.LASF1616
+	.byte	0x40
+	.byte	0xb
+	.byte	0x25
+	.byte	0x10
+	.long	0x3df
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0xb
+	.byte	0x27
+	.byte	0x24
+	.long	0x481
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0xb
+	.byte	0x29
+	.byte	0xd
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x10
+	.long	0x31b
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0xb
+	.byte	0x2b
+	.byte	0x17
+	.long	0x2e7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xe
+	.long	0x113
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x12
+	.long	0x2c3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1623
+	.byte	0xb
+	.byte	0x30
+	.byte	0x12
+	.long	0x2c3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0xb
+	.byte	0x33
+	.byte	0x1e
+	.long	0x327
+	.byte	0x38
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1625
+	.byte	0x58
+	.byte	0xb
+	.byte	0x36
+	.byte	0x8
+	.long	0x47c
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0xb
+	.byte	0x37
+	.byte	0xc
+	.long	0x4a7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0xb
+	.byte	0x39
+	.byte	0x10
+	.long	0x4bb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xf
+	.long	0x4cf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xc
+	.long	0x4e4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1630
+	.byte	0xb
+	.byte	0x40
+	.byte	0xb
+	.long	0x4ff
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1631
+	.byte	0xb
+	.byte	0x42
+	.byte	0xc
+	.long	0x514
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1632
+	.byte	0xb
+	.byte	0x45
+	.byte	0xb
+	.long	0x52d
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0xb
+	.byte	0x47
+	.byte	0xc
+	.long	0x547
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1634
+	.byte	0xb
+	.byte	0x49
+	.byte	0x10
+	.long	0x56a
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0xb
+	.byte	0x4c
+	.byte	0x10
+	.long	0x583
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1636
+	.byte	0xb
+	.byte	0x4e
+	.byte	0xc
+	.long	0x4e4
+	.byte	0x50
+	.byte	0
+	.uleb128 0x1f
+	.long	0x3df
+	.uleb128 0x10
+	.long	0x47c
+	.uleb128 0x9
+	.long	.LASF1637
+	.byte	0xb
+	.byte	0x34
+	.byte	0x3
+	.long	0x369
+	.uleb128 0x2b
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x10
+	.long	0x486
+	.uleb128 0x10
+	.long	0x492
+	.uleb128 0x2c
+	.long	0x113
+	.long	0x4bb
+	.uleb128 0xa
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x10
+	.long	0x4ac
+	.uleb128 0x2c
+	.long	0xf1
+	.long	0x4cf
+	.uleb128 0xa
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x10
+	.long	0x4c0
+	.uleb128 0x2b
+	.long	0x4e4
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	0x4d4
+	.uleb128 0x2c
+	.long	0x4f8
+	.long	0x4f8
+	.uleb128 0xa
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x21
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1638
+	.uleb128 0x10
+	.long	0x4e9
+	.uleb128 0x2b
+	.long	0x514
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x31b
+	.byte	0
+	.uleb128 0x10
+	.long	0x504
+	.uleb128 0x2c
+	.long	0x4f8
+	.long	0x52d
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x343
+	.byte	0
+	.uleb128 0x10
+	.long	0x519
+	.uleb128 0x2b
+	.long	0x547
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x364
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	0x532
+	.uleb128 0x2c
+	.long	0x113
+	.long	0x565
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x565
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	0xf1
+	.uleb128 0x10
+	.long	0x54c
+	.uleb128 0x2c
+	.long	0x565
+	.long	0x583
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x10
+	.long	0x56f
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0xc
+	.byte	0x14
+	.long	0x5a0
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1641
+	.byte	0xc
+	.byte	0x17
+	.byte	0x3
+	.long	0x588
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0xd
+	.byte	0x15
+	.long	0x5fa
+	.uleb128 0x3
+	.long	.LASF1642
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1644
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1645
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1646
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1648
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1650
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1651
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1652
+	.byte	0xa
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1653
+	.byte	0x50
+	.byte	0xd
+	.byte	0x23
+	.byte	0x10
+	.long	0x67a
+	.uleb128 0x20
+	.string	"P8"
+	.byte	0xd
+	.byte	0x24
+	.byte	0xd
+	.long	0x67a
+	.byte	0
+	.uleb128 0x20
+	.string	"I8"
+	.byte	0xd
+	.byte	0x25
+	.byte	0xd
+	.long	0x67a
+	.byte	0xa
+	.uleb128 0x20
+	.string	"D8"
+	.byte	0xd
+	.byte	0x26
+	.byte	0xd
+	.long	0x67a
+	.byte	0x14
+	.uleb128 0x20
+	.string	"P_f"
+	.byte	0xd
+	.byte	0x28
+	.byte	0xb
+	.long	0x68a
+	.byte	0x20
+	.uleb128 0x20
+	.string	"I_f"
+	.byte	0xd
+	.byte	0x29
+	.byte	0xb
+	.long	0x68a
+	.byte	0x2c
+	.uleb128 0x20
+	.string	"D_f"
+	.byte	0xd
+	.byte	0x2a
+	.byte	0xb
+	.long	0x68a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1654
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xb
+	.long	0x14a
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1655
+	.byte	0xd
+	.byte	0x2c
+	.byte	0xb
+	.long	0x14a
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1656
+	.byte	0xd
+	.byte	0x2e
+	.byte	0xd
+	.long	0xf1
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0x68a
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x16
+	.long	0x14a
+	.long	0x69a
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1657
+	.byte	0xd
+	.byte	0x2f
+	.byte	0x3
+	.long	0x5fa
+	.uleb128 0x12
+	.long	.LASF1658
+	.byte	0x6
+	.byte	0xd
+	.byte	0x57
+	.byte	0x10
+	.long	0x6db
+	.uleb128 0x2
+	.long	.LASF1659
+	.byte	0xd
+	.byte	0x58
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1660
+	.byte	0xd
+	.byte	0x59
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x20
+	.string	"yaw"
+	.byte	0xd
+	.byte	0x5a
+	.byte	0xd
+	.long	0xd9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1661
+	.byte	0xd
+	.byte	0x5b
+	.byte	0x3
+	.long	0x6a6
+	.uleb128 0x37
+	.byte	0x6
+	.byte	0xd
+	.byte	0x5d
+	.long	0x706
+	.uleb128 0x3b
+	.string	"raw"
+	.byte	0x5e
+	.long	0x706
+	.uleb128 0x31
+	.long	.LASF1662
+	.byte	0xd
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x6db
+	.byte	0
+	.uleb128 0x16
+	.long	0xd9
+	.long	0x716
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1663
+	.byte	0xd
+	.byte	0x60
+	.byte	0x3
+	.long	0x6e7
+	.uleb128 0x12
+	.long	.LASF1664
+	.byte	0x4
+	.byte	0xd
+	.byte	0x62
+	.byte	0x10
+	.long	0x74a
+	.uleb128 0x2
+	.long	.LASF1659
+	.byte	0xd
+	.byte	0x63
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1660
+	.byte	0xd
+	.byte	0x64
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1665
+	.byte	0xd
+	.byte	0x65
+	.byte	0x3
+	.long	0x722
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0xd
+	.byte	0x67
+	.long	0x775
+	.uleb128 0x3b
+	.string	"raw"
+	.byte	0x68
+	.long	0x775
+	.uleb128 0x31
+	.long	.LASF1662
+	.byte	0xd
+	.byte	0x69
+	.byte	0x1d
+	.long	0x74a
+	.byte	0
+	.uleb128 0x16
+	.long	0xd9
+	.long	0x785
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1666
+	.byte	0xd
+	.byte	0x6a
+	.byte	0x3
+	.long	0x756
+	.uleb128 0x12
+	.long	.LASF1667
+	.byte	0x4
+	.byte	0xd
+	.byte	0x6c
+	.byte	0x10
+	.long	0x7b9
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0xd
+	.byte	0x6e
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0xd
+	.byte	0x6f
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1670
+	.byte	0xd
+	.byte	0x70
+	.byte	0x3
+	.long	0x791
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0xd
+	.byte	0x72
+	.long	0x7e4
+	.uleb128 0x3b
+	.string	"raw"
+	.byte	0x73
+	.long	0x775
+	.uleb128 0x31
+	.long	.LASF1662
+	.byte	0xd
+	.byte	0x74
+	.byte	0x23
+	.long	0x7b9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1671
+	.byte	0xd
+	.byte	0x75
+	.byte	0x3
+	.long	0x7c5
+	.uleb128 0x15
+	.long	.LASF1672
+	.byte	0xd
+	.byte	0x7b
+	.byte	0x22
+	.long	0x7e4
+	.uleb128 0x15
+	.long	.LASF1673
+	.byte	0xd
+	.byte	0x7d
+	.byte	0x10
+	.long	0x706
+	.uleb128 0x15
+	.long	.LASF1674
+	.byte	0xd
+	.byte	0x80
+	.byte	0x27
+	.long	0x706
+	.uleb128 0x15
+	.long	.LASF1675
+	.byte	0xd
+	.byte	0x84
+	.byte	0x10
+	.long	0xd9
+	.uleb128 0x15
+	.long	.LASF1676
+	.byte	0xd
+	.byte	0x84
+	.byte	0x19
+	.long	0xd9
+	.uleb128 0x15
+	.long	.LASF1677
+	.byte	0xd
+	.byte	0x86
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x15
+	.long	.LASF1678
+	.byte	0xd
+	.byte	0x89
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x43
+	.long	.LASF1679
+	.long	0x43
+	.byte	0xe
+	.byte	0x18
+	.long	0x8de
+	.uleb128 0x3
+	.long	.LASF1680
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1681
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1682
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1683
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1685
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1688
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1689
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1690
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF1691
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1692
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1696
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1697
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1698
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1699
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1700
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1702
+	.byte	0x17
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1703
+	.byte	0x10
+	.byte	0xe
+	.byte	0x34
+	.byte	0x10
+	.long	0x920
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0xe
+	.byte	0x35
+	.byte	0xb
+	.long	0x14a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1659
+	.byte	0xe
+	.byte	0x36
+	.byte	0xb
+	.long	0x14a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1660
+	.byte	0xe
+	.byte	0x37
+	.byte	0xb
+	.long	0x14a
+	.byte	0x8
+	.uleb128 0x20
+	.string	"yaw"
+	.byte	0xe
+	.byte	0x38
+	.byte	0xb
+	.long	0x14a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1703
+	.byte	0xe
+	.byte	0x39
+	.byte	0x3
+	.long	0x8de
+	.uleb128 0x12
+	.long	.LASF1705
+	.byte	0x2
+	.byte	0xe
+	.byte	0x42
+	.byte	0x10
+	.long	0x954
+	.uleb128 0x2
+	.long	.LASF1706
+	.byte	0xe
+	.byte	0x43
+	.byte	0xc
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1707
+	.byte	0xe
+	.byte	0x44
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1708
+	.byte	0xe
+	.byte	0x45
+	.byte	0x3
+	.long	0x92c
+	.uleb128 0x12
+	.long	.LASF1709
+	.byte	0x8
+	.byte	0xe
+	.byte	0x47
+	.byte	0x10
+	.long	0x9a2
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0xe
+	.byte	0x48
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0xe
+	.byte	0x49
+	.byte	0xe
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0xe
+	.byte	0x4a
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0xe
+	.byte	0x4b
+	.byte	0xe
+	.long	0x107
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1714
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x3
+	.long	0x960
+	.uleb128 0x12
+	.long	.LASF1715
+	.byte	0x1
+	.byte	0xe
+	.byte	0x4e
+	.byte	0x10
+	.long	0x9c9
+	.uleb128 0x2
+	.long	.LASF1716
+	.byte	0xe
+	.byte	0x4f
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1715
+	.byte	0xe
+	.byte	0x50
+	.byte	0x3
+	.long	0x9ae
+	.uleb128 0x12
+	.long	.LASF1717
+	.byte	0x8
+	.byte	0xe
+	.byte	0x54
+	.byte	0x10
+	.long	0xa24
+	.uleb128 0x20
+	.string	"min"
+	.byte	0xe
+	.byte	0x55
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x20
+	.string	"max"
+	.byte	0xe
+	.byte	0x56
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0xe
+	.byte	0x57
+	.byte	0xd
+	.long	0xd9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0xe
+	.byte	0x58
+	.byte	0xc
+	.long	0xcd
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0xe
+	.byte	0x59
+	.byte	0xc
+	.long	0xcd
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1717
+	.byte	0xe
+	.byte	0x5a
+	.byte	0x3
+	.long	0x9d5
+	.uleb128 0x16
+	.long	0xd9
+	.long	0xa40
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0xb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1721
+	.byte	0xe
+	.byte	0x64
+	.byte	0x10
+	.long	0xa30
+	.uleb128 0x15
+	.long	.LASF1722
+	.byte	0xe
+	.byte	0x65
+	.byte	0x10
+	.long	0xa30
+	.uleb128 0x16
+	.long	0xd9
+	.long	0xa68
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1723
+	.byte	0xe
+	.byte	0x66
+	.byte	0x10
+	.long	0xa58
+	.uleb128 0x12
+	.long	.LASF1724
+	.byte	0x8
+	.byte	0xf
+	.byte	0x16
+	.byte	0x10
+	.long	0xac3
+	.uleb128 0x2
+	.long	.LASF1725
+	.byte	0xf
+	.byte	0x17
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1726
+	.byte	0xf
+	.byte	0x18
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1727
+	.byte	0xf
+	.byte	0x19
+	.byte	0xe
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1728
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1729
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0x107
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1730
+	.byte	0xf
+	.byte	0x1c
+	.byte	0x3
+	.long	0xa74
+	.uleb128 0x4e
+	.long	0x4f8
+	.uleb128 0x10
+	.long	0xacf
+	.uleb128 0x16
+	.long	0xd9
+	.long	0xae9
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x11
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1731
+	.byte	0x10
+	.byte	0x39
+	.byte	0x10
+	.long	0xad9
+	.uleb128 0x12
+	.long	.LASF1732
+	.byte	0x12
+	.byte	0x10
+	.byte	0x3d
+	.byte	0x10
+	.long	0xb51
+	.uleb128 0x2
+	.long	.LASF1733
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xd
+	.long	0xb51
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xd
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1735
+	.byte	0x10
+	.byte	0x40
+	.byte	0xe
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1736
+	.byte	0x10
+	.byte	0x41
+	.byte	0xe
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1737
+	.byte	0x10
+	.byte	0x42
+	.byte	0xe
+	.long	0x107
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1738
+	.byte	0x10
+	.byte	0x43
+	.byte	0xd
+	.long	0xf1
+	.byte	0x10
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0xb61
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1739
+	.byte	0x10
+	.byte	0x44
+	.byte	0x3
+	.long	0xaf5
+	.uleb128 0x12
+	.long	.LASF1740
+	.byte	0x2
+	.byte	0x10
+	.byte	0x48
+	.byte	0x10
+	.long	0xb95
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0x10
+	.byte	0x49
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0x10
+	.byte	0x4a
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1743
+	.byte	0x10
+	.byte	0x4b
+	.byte	0x3
+	.long	0xb6d
+	.uleb128 0x15
+	.long	.LASF1744
+	.byte	0x10
+	.byte	0x4d
+	.byte	0x1a
+	.long	0xb95
+	.uleb128 0x12
+	.long	.LASF1745
+	.byte	0x6
+	.byte	0x11
+	.byte	0x14
+	.byte	0x10
+	.long	0xbe2
+	.uleb128 0x2
+	.long	.LASF1746
+	.byte	0x11
+	.byte	0x15
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1747
+	.byte	0x11
+	.byte	0x16
+	.byte	0xe
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1748
+	.byte	0x11
+	.byte	0x17
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1749
+	.byte	0x11
+	.byte	0x18
+	.byte	0x3
+	.long	0xbad
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x12
+	.byte	0x14
+	.long	0xc84
+	.uleb128 0x3
+	.long	.LASF1750
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1751
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1754
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1756
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1757
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1758
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1759
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1761
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1766
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1770
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1771
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1772
+	.byte	0x16
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1773
+	.byte	0x12
+	.byte	0x2d
+	.byte	0x3
+	.long	0xbee
+	.uleb128 0x15
+	.long	.LASF1774
+	.byte	0x12
+	.byte	0x2f
+	.byte	0x11
+	.long	0x113
+	.uleb128 0x12
+	.long	.LASF1775
+	.byte	0x8
+	.byte	0x12
+	.byte	0x65
+	.byte	0x10
+	.long	0xcde
+	.uleb128 0x2
+	.long	.LASF1776
+	.byte	0x12
+	.byte	0x66
+	.byte	0xd
+	.long	0xc84
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x12
+	.byte	0x67
+	.byte	0xd
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x12
+	.byte	0x6d
+	.byte	0xd
+	.long	0xf1
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x12
+	.byte	0x6e
+	.byte	0xd
+	.long	0xf1
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1780
+	.byte	0x12
+	.byte	0x6f
+	.byte	0x3
+	.long	0xc9c
+	.uleb128 0x12
+	.long	.LASF1781
+	.byte	0x6
+	.byte	0x12
+	.byte	0x73
+	.byte	0x10
+	.long	0xd46
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x12
+	.byte	0x74
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x12
+	.byte	0x75
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x12
+	.byte	0x76
+	.byte	0xd
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x12
+	.byte	0x77
+	.byte	0xd
+	.long	0xf1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x12
+	.byte	0x78
+	.byte	0xd
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x12
+	.byte	0x79
+	.byte	0xd
+	.long	0xf1
+	.byte	0x5
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1788
+	.byte	0x12
+	.byte	0x7a
+	.byte	0x3
+	.long	0xcea
+	.uleb128 0x12
+	.long	.LASF1789
+	.byte	0x1
+	.byte	0x13
+	.byte	0x1a
+	.byte	0x10
+	.long	0xd6d
+	.uleb128 0x2
+	.long	.LASF1790
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1791
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0xd52
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x14
+	.byte	0x14
+	.long	0xdb5
+	.uleb128 0x3
+	.long	.LASF1792
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1793
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1794
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1795
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1796
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1797
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1799
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1800
+	.byte	0x14
+	.byte	0x1d
+	.byte	0x3
+	.long	0xd79
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x14
+	.byte	0x2c
+	.long	0xe09
+	.uleb128 0x3
+	.long	.LASF1801
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1802
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1803
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1804
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1805
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1806
+	.byte	0x23
+	.uleb128 0x3
+	.long	.LASF1807
+	.byte	0x27
+	.uleb128 0x3
+	.long	.LASF1808
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1809
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1811
+	.byte	0x14
+	.byte	0x38
+	.byte	0x3
+	.long	0xdc1
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x14
+	.byte	0x5a
+	.long	0xe3f
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1813
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1814
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1816
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1817
+	.byte	0x14
+	.byte	0x60
+	.byte	0x3
+	.long	0xe15
+	.uleb128 0x12
+	.long	.LASF1818
+	.byte	0x18
+	.byte	0x14
+	.byte	0x74
+	.byte	0x10
+	.long	0xe8d
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0x14
+	.byte	0x75
+	.byte	0x1c
+	.long	0xe3f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1819
+	.byte	0x14
+	.byte	0x76
+	.byte	0x13
+	.long	0x4a2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1820
+	.byte	0x14
+	.byte	0x77
+	.byte	0x22
+	.long	0xe09
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1821
+	.byte	0x14
+	.byte	0x78
+	.byte	0x1a
+	.long	0xdb5
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1822
+	.byte	0x14
+	.byte	0x79
+	.byte	0x3
+	.long	0xe4b
+	.uleb128 0x12
+	.long	.LASF1823
+	.byte	0x10
+	.byte	0x14
+	.byte	0x7b
+	.byte	0x10
+	.long	0xec1
+	.uleb128 0x2
+	.long	.LASF1824
+	.byte	0x14
+	.byte	0x7c
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1825
+	.byte	0x14
+	.byte	0x7d
+	.byte	0x1b
+	.long	0xec1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0xe8d
+	.uleb128 0x9
+	.long	.LASF1826
+	.byte	0x14
+	.byte	0x7e
+	.byte	0x3
+	.long	0xe99
+	.uleb128 0x1f
+	.long	0xec6
+	.uleb128 0x12
+	.long	.LASF1827
+	.byte	0x18
+	.byte	0x14
+	.byte	0x80
+	.byte	0x10
+	.long	0xf33
+	.uleb128 0x2
+	.long	.LASF1828
+	.byte	0x14
+	.byte	0x81
+	.byte	0xd
+	.long	0xf33
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1829
+	.byte	0x14
+	.byte	0x82
+	.byte	0xe
+	.long	0x113
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1830
+	.byte	0x14
+	.byte	0x83
+	.byte	0xe
+	.long	0x113
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1831
+	.byte	0x14
+	.byte	0x84
+	.byte	0xe
+	.long	0x113
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1832
+	.byte	0x14
+	.byte	0x85
+	.byte	0xe
+	.long	0x113
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1833
+	.byte	0x14
+	.byte	0x87
+	.byte	0xd
+	.long	0xf1
+	.byte	0x14
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0xf43
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1834
+	.byte	0x14
+	.byte	0x88
+	.byte	0x3
+	.long	0xed7
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x15
+	.byte	0x21
+	.long	0xf67
+	.uleb128 0x3
+	.long	.LASF1835
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1836
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1837
+	.byte	0x15
+	.byte	0x24
+	.byte	0x3
+	.long	0xf4f
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x15
+	.byte	0x26
+	.long	0xfaf
+	.uleb128 0x3
+	.long	.LASF1838
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1839
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1840
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1841
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1842
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1844
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1845
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1846
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x3
+	.long	0xf73
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x15
+	.byte	0x31
+	.long	0xfdf
+	.uleb128 0x3
+	.long	.LASF1847
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1848
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1849
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1850
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1851
+	.byte	0x15
+	.byte	0x36
+	.byte	0x3
+	.long	0xfbb
+	.uleb128 0x12
+	.long	.LASF1852
+	.byte	0x28
+	.byte	0x15
+	.byte	0x3a
+	.byte	0x10
+	.long	0x1088
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0x15
+	.byte	0x3b
+	.byte	0xe
+	.long	0x565
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1853
+	.byte	0x15
+	.byte	0x3c
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1854
+	.byte	0x15
+	.byte	0x3e
+	.byte	0x15
+	.long	0xfaf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1855
+	.byte	0x15
+	.byte	0x3f
+	.byte	0x12
+	.long	0xf67
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1856
+	.byte	0x15
+	.byte	0x40
+	.byte	0xd
+	.long	0x1088
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1857
+	.byte	0x15
+	.byte	0x41
+	.byte	0xd
+	.long	0xf1
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF1858
+	.byte	0x15
+	.byte	0x42
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1859
+	.byte	0x15
+	.byte	0x45
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1b
+	.uleb128 0x20
+	.string	"cmd"
+	.byte	0x15
+	.byte	0x46
+	.byte	0xe
+	.long	0x107
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0x15
+	.byte	0x47
+	.byte	0xe
+	.long	0x107
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x15
+	.byte	0x48
+	.byte	0xe
+	.long	0x107
+	.byte	0x20
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0x1098
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1862
+	.byte	0x15
+	.byte	0x49
+	.byte	0x3
+	.long	0xfeb
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x16
+	.byte	0x1c
+	.long	0x10c8
+	.uleb128 0x3
+	.long	.LASF1863
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1864
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1865
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1866
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1867
+	.byte	0x16
+	.byte	0x21
+	.byte	0x3
+	.long	0x10a4
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x16
+	.byte	0x23
+	.long	0x10ec
+	.uleb128 0x3
+	.long	.LASF1868
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1869
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1870
+	.byte	0x16
+	.byte	0x26
+	.byte	0x3
+	.long	0x10d4
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x16
+	.byte	0x28
+	.long	0x1110
+	.uleb128 0x3
+	.long	.LASF1871
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1872
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1873
+	.byte	0x16
+	.byte	0x2b
+	.byte	0x3
+	.long	0x10f8
+	.uleb128 0x12
+	.long	.LASF1874
+	.byte	0x20
+	.byte	0x16
+	.byte	0x2c
+	.byte	0x10
+	.long	0x1192
+	.uleb128 0x2
+	.long	.LASF1875
+	.byte	0x16
+	.byte	0x2d
+	.byte	0x19
+	.long	0x10c8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1876
+	.byte	0x16
+	.byte	0x2e
+	.byte	0xd
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1877
+	.byte	0x16
+	.byte	0x2f
+	.byte	0x17
+	.long	0x2e7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1878
+	.byte	0x16
+	.byte	0x30
+	.byte	0x8
+	.long	0x14a
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0x16
+	.byte	0x31
+	.byte	0xb
+	.long	0x14a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0x16
+	.byte	0x32
+	.byte	0x1b
+	.long	0x10ec
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0x16
+	.byte	0x33
+	.byte	0x11
+	.long	0x1110
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0x16
+	.byte	0x34
+	.byte	0xe
+	.long	0x107
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1883
+	.byte	0x16
+	.byte	0x35
+	.byte	0x3
+	.long	0x111c
+	.uleb128 0x12
+	.long	.LASF1884
+	.byte	0x6
+	.byte	0x17
+	.byte	0x14
+	.byte	0x10
+	.long	0x11d3
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0x17
+	.byte	0x15
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0x17
+	.byte	0x16
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0x17
+	.byte	0x17
+	.byte	0xd
+	.long	0xd9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1888
+	.byte	0x17
+	.byte	0x18
+	.byte	0x3
+	.long	0x119e
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x18
+	.byte	0x1c
+	.long	0x1215
+	.uleb128 0x3
+	.long	.LASF1889
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1890
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1891
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1892
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1893
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1894
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1895
+	.byte	0x40
+	.byte	0
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x18
+	.byte	0x26
+	.long	0x1257
+	.uleb128 0x3
+	.long	.LASF1896
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1897
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1898
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1899
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1900
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1902
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1903
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1904
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1905
+	.byte	0x18
+	.byte	0x30
+	.byte	0x3
+	.long	0x1215
+	.uleb128 0x12
+	.long	.LASF1906
+	.byte	0xc
+	.byte	0x18
+	.byte	0x32
+	.byte	0x10
+	.long	0x1298
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x18
+	.byte	0x33
+	.byte	0x14
+	.long	0x1257
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x18
+	.byte	0x34
+	.byte	0x14
+	.long	0x1257
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x18
+	.byte	0x35
+	.byte	0x14
+	.long	0x1257
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1910
+	.byte	0x18
+	.byte	0x36
+	.byte	0x3
+	.long	0x1263
+	.uleb128 0x12
+	.long	.LASF1911
+	.byte	0x10
+	.byte	0x18
+	.byte	0x39
+	.byte	0x10
+	.long	0x1300
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x18
+	.byte	0x3a
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0x18
+	.byte	0x3b
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x18
+	.byte	0x3c
+	.byte	0xd
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0x18
+	.byte	0x3d
+	.byte	0xd
+	.long	0xf1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1916
+	.byte	0x18
+	.byte	0x3e
+	.byte	0xd
+	.long	0x706
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x18
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1918
+	.byte	0x18
+	.byte	0x40
+	.byte	0x3
+	.long	0x12a4
+	.uleb128 0x12
+	.long	.LASF1919
+	.byte	0xa
+	.byte	0x19
+	.byte	0x18
+	.byte	0x10
+	.long	0x1368
+	.uleb128 0x2
+	.long	.LASF1920
+	.byte	0x19
+	.byte	0x19
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1921
+	.byte	0x19
+	.byte	0x1a
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1922
+	.byte	0x19
+	.byte	0x1b
+	.byte	0xd
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1923
+	.byte	0x19
+	.byte	0x1d
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1924
+	.byte	0x19
+	.byte	0x1e
+	.byte	0xe
+	.long	0x107
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1925
+	.byte	0x19
+	.byte	0x21
+	.byte	0xd
+	.long	0xf1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1926
+	.byte	0x19
+	.byte	0x22
+	.byte	0x3
+	.long	0x130c
+	.uleb128 0x15
+	.long	.LASF1927
+	.byte	0x19
+	.byte	0x24
+	.byte	0x10
+	.long	0xf1
+	.uleb128 0x15
+	.long	.LASF1928
+	.byte	0x19
+	.byte	0x27
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x15
+	.long	.LASF1929
+	.byte	0x19
+	.byte	0x28
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x12
+	.long	.LASF1930
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x27
+	.byte	0x10
+	.long	0x13bd
+	.uleb128 0x20
+	.string	"xy"
+	.byte	0x1a
+	.byte	0x28
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x20
+	.string	"z"
+	.byte	0x1a
+	.byte	0x29
+	.byte	0xd
+	.long	0xf1
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1931
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1398
+	.uleb128 0x12
+	.long	.LASF1932
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x1f
+	.byte	0x10
+	.long	0x140b
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0x1b
+	.byte	0x20
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1934
+	.byte	0x1b
+	.byte	0x21
+	.byte	0xb
+	.long	0x14a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0x1b
+	.byte	0x22
+	.byte	0xb
+	.long	0x14a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0x1b
+	.byte	0x23
+	.byte	0xb
+	.long	0x14a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1937
+	.byte	0x1b
+	.byte	0x24
+	.byte	0x3
+	.long	0x13c9
+	.uleb128 0x15
+	.long	.LASF1938
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x10
+	.long	0x706
+	.uleb128 0x12
+	.long	.LASF1939
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x24
+	.byte	0x10
+	.long	0x1465
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0x1d
+	.byte	0x25
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x1d
+	.byte	0x26
+	.byte	0xe
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0x1d
+	.byte	0x27
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x1d
+	.byte	0x28
+	.byte	0xe
+	.long	0x107
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1944
+	.byte	0x1d
+	.byte	0x29
+	.byte	0x3
+	.long	0x1423
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x1e
+	.byte	0x15
+	.long	0x148f
+	.uleb128 0x3
+	.long	.LASF1945
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1946
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1947
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1948
+	.byte	0x1e
+	.byte	0x1b
+	.byte	0x10
+	.long	0xf1
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x1e
+	.byte	0x21
+	.long	0x14e5
+	.uleb128 0x3
+	.long	.LASF1949
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1950
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1951
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1952
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1953
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1954
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1955
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1956
+	.byte	0x80
+	.uleb128 0x26
+	.long	.LASF1957
+	.value	0x100
+	.uleb128 0x26
+	.long	.LASF1958
+	.value	0x200
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1959
+	.byte	0x1e
+	.byte	0x2e
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x1e
+	.byte	0x34
+	.long	0x151b
+	.uleb128 0x3
+	.long	.LASF1960
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1961
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1962
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1963
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1964
+	.byte	0x10
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1965
+	.byte	0x1e
+	.byte	0x40
+	.byte	0x10
+	.long	0xf1
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x1f
+	.byte	0x14
+	.long	0x15c8
+	.uleb128 0x3
+	.long	.LASF1966
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1967
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1968
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1969
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1970
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1971
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1972
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1973
+	.byte	0x80
+	.uleb128 0x26
+	.long	.LASF1974
+	.value	0x100
+	.uleb128 0x26
+	.long	.LASF1975
+	.value	0x200
+	.uleb128 0x26
+	.long	.LASF1976
+	.value	0x400
+	.uleb128 0x26
+	.long	.LASF1977
+	.value	0x800
+	.uleb128 0x26
+	.long	.LASF1978
+	.value	0x1000
+	.uleb128 0x26
+	.long	.LASF1979
+	.value	0x2000
+	.uleb128 0x26
+	.long	.LASF1980
+	.value	0x4000
+	.uleb128 0x26
+	.long	.LASF1981
+	.value	0x8000
+	.uleb128 0x32
+	.long	.LASF1982
+	.long	0x10000
+	.uleb128 0x32
+	.long	.LASF1983
+	.long	0x20000
+	.uleb128 0x32
+	.long	.LASF1984
+	.long	0x40000
+	.uleb128 0x32
+	.long	.LASF1985
+	.long	0x80000
+	.uleb128 0x32
+	.long	.LASF1986
+	.long	0x100000
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF1987
+	.value	0x218
+	.byte	0x20
+	.byte	0x14
+	.long	0x170b
+	.uleb128 0x2
+	.long	.LASF1988
+	.byte	0x20
+	.byte	0x15
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0x20
+	.byte	0x17
+	.byte	0x12
+	.long	0x69a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1990
+	.byte	0x20
+	.byte	0x19
+	.byte	0x19
+	.long	0xd46
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1991
+	.byte	0x20
+	.byte	0x1b
+	.byte	0xd
+	.long	0xf1
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0x20
+	.byte	0x1c
+	.byte	0xe
+	.long	0x107
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1993
+	.byte	0x20
+	.byte	0x1e
+	.byte	0xd
+	.long	0xd9
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1994
+	.byte	0x20
+	.byte	0x21
+	.byte	0x19
+	.long	0x785
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1995
+	.byte	0x20
+	.byte	0x24
+	.byte	0xd
+	.long	0xf1
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1996
+	.byte	0x20
+	.byte	0x25
+	.byte	0xb
+	.long	0x14a
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0x20
+	.byte	0x26
+	.byte	0x13
+	.long	0x13bd
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1998
+	.byte	0x20
+	.byte	0x28
+	.byte	0x17
+	.long	0x140b
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0x20
+	.byte	0x2b
+	.byte	0xd
+	.long	0xf1
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0x20
+	.byte	0x2d
+	.byte	0x1f
+	.long	0x170b
+	.byte	0x84
+	.uleb128 0x13
+	.long	.LASF2001
+	.byte	0x20
+	.byte	0x30
+	.byte	0xd
+	.long	0xf1
+	.value	0x1c4
+	.uleb128 0x13
+	.long	.LASF2002
+	.byte	0x20
+	.byte	0x31
+	.byte	0xd
+	.long	0xf1
+	.value	0x1c5
+	.uleb128 0x13
+	.long	.LASF2003
+	.byte	0x20
+	.byte	0x32
+	.byte	0xd
+	.long	0xf1
+	.value	0x1c6
+	.uleb128 0x13
+	.long	.LASF2004
+	.byte	0x20
+	.byte	0x33
+	.byte	0xd
+	.long	0xf1
+	.value	0x1c7
+	.uleb128 0x13
+	.long	.LASF2005
+	.byte	0x20
+	.byte	0x35
+	.byte	0xe
+	.long	0x107
+	.value	0x1c8
+	.uleb128 0x13
+	.long	.LASF2006
+	.byte	0x20
+	.byte	0x36
+	.byte	0xd
+	.long	0xf1
+	.value	0x1ca
+	.uleb128 0x13
+	.long	.LASF2007
+	.byte	0x20
+	.byte	0x39
+	.byte	0x12
+	.long	0x171b
+	.value	0x1cc
+	.uleb128 0x13
+	.long	.LASF2008
+	.byte	0x20
+	.byte	0x3c
+	.byte	0x16
+	.long	0xac3
+	.value	0x20c
+	.uleb128 0x13
+	.long	.LASF2009
+	.byte	0x20
+	.byte	0x3f
+	.byte	0x13
+	.long	0x954
+	.value	0x214
+	.uleb128 0x13
+	.long	.LASF2010
+	.byte	0x20
+	.byte	0x42
+	.byte	0x14
+	.long	0xd6d
+	.value	0x216
+	.byte	0
+	.uleb128 0x16
+	.long	0xcde
+	.long	0x171b
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x27
+	.byte	0
+	.uleb128 0x16
+	.long	0xa24
+	.long	0x172b
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2011
+	.byte	0x20
+	.byte	0x47
+	.byte	0x3
+	.long	0x15c8
+	.uleb128 0x44
+	.long	.LASF2012
+	.value	0x7dc
+	.byte	0x21
+	.byte	0x17
+	.long	0x196e
+	.uleb128 0x2
+	.long	.LASF2013
+	.byte	0x21
+	.byte	0x18
+	.byte	0xd
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2014
+	.byte	0x21
+	.byte	0x19
+	.byte	0xe
+	.long	0x113
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0x21
+	.byte	0x1a
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0x21
+	.byte	0x1b
+	.byte	0xd
+	.long	0xf1
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2017
+	.byte	0x21
+	.byte	0x1c
+	.byte	0xd
+	.long	0xf1
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2018
+	.byte	0x21
+	.byte	0x1d
+	.byte	0xd
+	.long	0xf1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2019
+	.byte	0x21
+	.byte	0x1e
+	.byte	0xd
+	.long	0xf1
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2020
+	.byte	0x21
+	.byte	0x20
+	.byte	0x12
+	.long	0x196e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x21
+	.byte	0x23
+	.byte	0x19
+	.long	0xbe2
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0x21
+	.byte	0x24
+	.byte	0x16
+	.long	0x9a2
+	.byte	0xd6
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0x21
+	.byte	0x26
+	.byte	0xe
+	.long	0x107
+	.byte	0xde
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0x21
+	.byte	0x27
+	.byte	0xe
+	.long	0x107
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0x21
+	.byte	0x28
+	.byte	0xe
+	.long	0x107
+	.byte	0xe2
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0x21
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x1298
+	.byte	0xe4
+	.uleb128 0x2
+	.long	.LASF2027
+	.byte	0x21
+	.byte	0x2d
+	.byte	0x16
+	.long	0x11d3
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0x21
+	.byte	0x2f
+	.byte	0xc
+	.long	0xcd
+	.byte	0xf6
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x21
+	.byte	0x30
+	.byte	0xd
+	.long	0xf1
+	.byte	0xf7
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x21
+	.byte	0x31
+	.byte	0xe
+	.long	0x107
+	.byte	0xf8
+	.uleb128 0x2
+	.long	.LASF2031
+	.byte	0x21
+	.byte	0x32
+	.byte	0xe
+	.long	0x107
+	.byte	0xfa
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0x21
+	.byte	0x33
+	.byte	0xe
+	.long	0x107
+	.byte	0xfc
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0x21
+	.byte	0x34
+	.byte	0xd
+	.long	0xf1
+	.byte	0xfe
+	.uleb128 0x13
+	.long	.LASF2034
+	.byte	0x21
+	.byte	0x35
+	.byte	0xe
+	.long	0x107
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF2035
+	.byte	0x21
+	.byte	0x36
+	.byte	0xe
+	.long	0x107
+	.value	0x102
+	.uleb128 0x13
+	.long	.LASF2036
+	.byte	0x21
+	.byte	0x38
+	.byte	0x12
+	.long	0x1465
+	.value	0x104
+	.uleb128 0x13
+	.long	.LASF2037
+	.byte	0x21
+	.byte	0x3a
+	.byte	0xe
+	.long	0x107
+	.value	0x10c
+	.uleb128 0x13
+	.long	.LASF2038
+	.byte	0x21
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x716
+	.value	0x10e
+	.uleb128 0x13
+	.long	.LASF2039
+	.byte	0x21
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x716
+	.value	0x114
+	.uleb128 0x13
+	.long	.LASF2040
+	.byte	0x21
+	.byte	0x3d
+	.byte	0x14
+	.long	0x1300
+	.value	0x11c
+	.uleb128 0x13
+	.long	.LASF2041
+	.byte	0x21
+	.byte	0x3f
+	.byte	0x15
+	.long	0x1368
+	.value	0x12c
+	.uleb128 0x13
+	.long	.LASF2042
+	.byte	0x21
+	.byte	0x41
+	.byte	0x10
+	.long	0xb61
+	.value	0x136
+	.uleb128 0x13
+	.long	.LASF2043
+	.byte	0x21
+	.byte	0x42
+	.byte	0x1a
+	.long	0x5a0
+	.value	0x148
+	.uleb128 0x13
+	.long	.LASF2044
+	.byte	0x21
+	.byte	0x44
+	.byte	0xd
+	.long	0xf1
+	.value	0x14c
+	.uleb128 0x13
+	.long	.LASF2045
+	.byte	0x21
+	.byte	0x45
+	.byte	0xd
+	.long	0xf1
+	.value	0x14d
+	.uleb128 0x13
+	.long	.LASF2046
+	.byte	0x21
+	.byte	0x46
+	.byte	0xd
+	.long	0xf1
+	.value	0x14e
+	.uleb128 0x13
+	.long	.LASF2047
+	.byte	0x21
+	.byte	0x48
+	.byte	0x16
+	.long	0x9c9
+	.value	0x14f
+	.uleb128 0x13
+	.long	.LASF2048
+	.byte	0x21
+	.byte	0x49
+	.byte	0xc
+	.long	0xcd
+	.value	0x150
+	.uleb128 0x13
+	.long	.LASF2049
+	.byte	0x21
+	.byte	0x4f
+	.byte	0x14
+	.long	0xf43
+	.value	0x154
+	.uleb128 0x13
+	.long	.LASF2050
+	.byte	0x21
+	.byte	0x51
+	.byte	0x17
+	.long	0x1192
+	.value	0x16c
+	.uleb128 0x13
+	.long	.LASF2051
+	.byte	0x21
+	.byte	0x53
+	.byte	0xd
+	.long	0xf1
+	.value	0x18c
+	.uleb128 0x13
+	.long	.LASF2052
+	.byte	0x21
+	.byte	0x5a
+	.byte	0xf
+	.long	0x197e
+	.value	0x190
+	.uleb128 0x13
+	.long	.LASF2053
+	.byte	0x21
+	.byte	0x5b
+	.byte	0xd
+	.long	0xf1
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x16
+	.long	0x920
+	.long	0x197e
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0xb
+	.byte	0
+	.uleb128 0x16
+	.long	0x172b
+	.long	0x198e
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2012
+	.byte	0x21
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1737
+	.uleb128 0x1f
+	.long	0x198e
+	.uleb128 0x15
+	.long	.LASF2054
+	.byte	0x21
+	.byte	0x5e
+	.byte	0x11
+	.long	0x198e
+	.uleb128 0x15
+	.long	.LASF2055
+	.byte	0x21
+	.byte	0x5f
+	.byte	0x13
+	.long	0x19b7
+	.uleb128 0x10
+	.long	0x172b
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x22
+	.byte	0x2c
+	.long	0x19dd
+	.uleb128 0x31
+	.long	.LASF2056
+	.byte	0x22
+	.byte	0x2d
+	.byte	0xd
+	.long	0xe5
+	.uleb128 0x31
+	.long	.LASF2057
+	.byte	0x22
+	.byte	0x2e
+	.byte	0xb
+	.long	0x14a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2058
+	.byte	0x22
+	.byte	0x2f
+	.byte	0x3
+	.long	0x19bc
+	.uleb128 0x12
+	.long	.LASF2059
+	.byte	0x8
+	.byte	0x23
+	.byte	0x25
+	.byte	0x10
+	.long	0x1a2a
+	.uleb128 0x20
+	.string	"id"
+	.byte	0x23
+	.byte	0x26
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x23
+	.byte	0x27
+	.byte	0xd
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x23
+	.byte	0x28
+	.byte	0xd
+	.long	0xf1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0x23
+	.byte	0x29
+	.byte	0x17
+	.long	0x19dd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2063
+	.byte	0x23
+	.byte	0x2a
+	.byte	0x3
+	.long	0x19e9
+	.uleb128 0x1f
+	.long	0x1a2a
+	.uleb128 0x1b
+	.long	0x43
+	.byte	0x23
+	.byte	0x2c
+	.long	0x1a59
+	.uleb128 0x3
+	.long	.LASF2064
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2065
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2066
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2067
+	.byte	0x23
+	.byte	0x30
+	.byte	0x3
+	.long	0x1a3b
+	.uleb128 0x15
+	.long	.LASF2068
+	.byte	0x24
+	.byte	0x1b
+	.byte	0xe
+	.long	0xbc
+	.uleb128 0x15
+	.long	.LASF2069
+	.byte	0x24
+	.byte	0x1e
+	.byte	0xe
+	.long	0xbc
+	.uleb128 0x15
+	.long	.LASF2070
+	.byte	0x24
+	.byte	0x21
+	.byte	0xe
+	.long	0xbc
+	.uleb128 0x12
+	.long	.LASF2071
+	.byte	0xc
+	.byte	0x25
+	.byte	0x17
+	.byte	0x10
+	.long	0x1abe
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0x25
+	.byte	0x18
+	.byte	0xe
+	.long	0x113
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2072
+	.byte	0x25
+	.byte	0x19
+	.byte	0xe
+	.long	0x113
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2073
+	.byte	0x25
+	.byte	0x1a
+	.byte	0xe
+	.long	0x113
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2074
+	.byte	0x25
+	.byte	0x1b
+	.byte	0x3
+	.long	0x1a89
+	.uleb128 0x1f
+	.long	0x1abe
+	.uleb128 0x4f
+	.long	.LASF2083
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x16
+	.long	0x4a2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspSerialPort
+	.uleb128 0x15
+	.long	.LASF2075
+	.byte	0x1
+	.byte	0x50
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x15
+	.long	.LASF2076
+	.byte	0x1
+	.byte	0x51
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x50
+	.long	.LASF2165
+	.byte	0x1
+	.byte	0x84
+	.byte	0x14
+	.long	0x145
+	.uleb128 0x51
+	.long	.LASF2077
+	.byte	0x1
+	.byte	0x89
+	.byte	0xd
+	.long	0x145
+	.uleb128 0x9
+	.byte	0x3
+	.quad	boardIdentifier
+	.uleb128 0x45
+	.long	.LASF2078
+	.byte	0x18
+	.value	0x128
+	.long	0x1b53
+	.uleb128 0x22
+	.long	.LASF2079
+	.value	0x129
+	.byte	0x13
+	.long	0x102
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2080
+	.value	0x12a
+	.byte	0x11
+	.long	0x145
+	.byte	0x8
+	.uleb128 0x22
+	.long	.LASF2081
+	.value	0x12b
+	.byte	0x13
+	.long	0x102
+	.byte	0x10
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2082
+	.value	0x12c
+	.long	0x1b1f
+	.uleb128 0x1f
+	.long	0x1b53
+	.uleb128 0x16
+	.long	0x1b5e
+	.long	0x1b73
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x16
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1b63
+	.uleb128 0x1e
+	.long	.LASF2084
+	.value	0x12f
+	.byte	0x1a
+	.long	0x1b73
+	.uleb128 0x9
+	.byte	0x3
+	.quad	boxes
+	.uleb128 0x16
+	.long	0xf1
+	.long	0x1b9e
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x15
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2085
+	.value	0x14b
+	.byte	0x10
+	.long	0x1b8e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	activeBoxIds
+	.uleb128 0x1e
+	.long	.LASF2086
+	.value	0x14d
+	.byte	0x10
+	.long	0xf1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	activeBoxIdCount
+	.uleb128 0x1e
+	.long	.LASF2087
+	.value	0x152
+	.byte	0xc
+	.long	0x4f8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	isRebootScheduled
+	.uleb128 0x16
+	.long	0xc8
+	.long	0x1bf0
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1be0
+	.uleb128 0x1e
+	.long	.LASF2088
+	.value	0x154
+	.byte	0x13
+	.long	0x1bf0
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pidnames
+	.uleb128 0x3c
+	.long	0x43
+	.value	0x160
+	.long	0x1c29
+	.uleb128 0x3
+	.long	.LASF2089
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2090
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2091
+	.byte	0x2
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2092
+	.value	0x164
+	.long	0x1c0b
+	.uleb128 0x3c
+	.long	0x43
+	.value	0x166
+	.long	0x1c52
+	.uleb128 0x3
+	.long	.LASF2093
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2094
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF2095
+	.byte	0x2
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2096
+	.value	0x16a
+	.long	0x1c34
+	.uleb128 0x52
+	.long	.LASF2097
+	.value	0x158
+	.byte	0x1
+	.value	0x16c
+	.byte	0x10
+	.long	0x1d39
+	.uleb128 0x22
+	.long	.LASF1819
+	.value	0x16d
+	.byte	0x13
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2098
+	.value	0x16e
+	.byte	0x16
+	.long	0x1098
+	.byte	0x8
+	.uleb128 0x22
+	.long	.LASF1860
+	.value	0x16f
+	.byte	0xe
+	.long	0x107
+	.byte	0x30
+	.uleb128 0x22
+	.long	.LASF1858
+	.value	0x170
+	.byte	0xd
+	.long	0xf1
+	.byte	0x32
+	.uleb128 0x22
+	.long	.LASF2099
+	.value	0x171
+	.byte	0xe
+	.long	0x107
+	.byte	0x34
+	.uleb128 0x22
+	.long	.LASF2100
+	.value	0x172
+	.byte	0xd
+	.long	0x1d39
+	.byte	0x36
+	.uleb128 0x29
+	.long	.LASF2101
+	.value	0x173
+	.byte	0xe
+	.long	0x107
+	.value	0x136
+	.uleb128 0x29
+	.long	.LASF1855
+	.value	0x174
+	.byte	0x12
+	.long	0xf67
+	.value	0x138
+	.uleb128 0x29
+	.long	.LASF2102
+	.value	0x175
+	.byte	0x14
+	.long	0x1c29
+	.value	0x13c
+	.uleb128 0x29
+	.long	.LASF2103
+	.value	0x176
+	.byte	0xe
+	.long	0x565
+	.value	0x140
+	.uleb128 0x29
+	.long	.LASF2104
+	.value	0x177
+	.byte	0xe
+	.long	0x107
+	.value	0x148
+	.uleb128 0x29
+	.long	.LASF2105
+	.value	0x178
+	.byte	0xe
+	.long	0x107
+	.value	0x14a
+	.uleb128 0x29
+	.long	.LASF2106
+	.value	0x179
+	.byte	0x9
+	.long	0x4f8
+	.value	0x14c
+	.uleb128 0x29
+	.long	.LASF2107
+	.value	0x17a
+	.byte	0x15
+	.long	0x1c52
+	.value	0x150
+	.uleb128 0x29
+	.long	.LASF2108
+	.value	0x17b
+	.byte	0xe
+	.long	0x113
+	.value	0x154
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0x1d49
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2109
+	.value	0x17c
+	.long	0x1c5d
+	.uleb128 0x16
+	.long	0x1d49
+	.long	0x1d64
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2110
+	.value	0x17e
+	.byte	0x12
+	.long	0x1d54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspPorts
+	.uleb128 0x1e
+	.long	.LASF2111
+	.value	0x180
+	.byte	0x13
+	.long	0x1d90
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentPort
+	.uleb128 0x10
+	.long	0x1d49
+	.uleb128 0x3c
+	.long	0x43
+	.value	0x6ab
+	.long	0x1dad
+	.uleb128 0x3
+	.long	.LASF2112
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2113
+	.byte	0x1
+	.byte	0
+	.uleb128 0x45
+	.long	.LASF2114
+	.byte	0x10
+	.value	0x6b2
+	.long	0x1dfc
+	.uleb128 0x53
+	.string	"cmd"
+	.byte	0x1
+	.value	0x6b3
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2115
+	.value	0x6b4
+	.byte	0xd
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x22
+	.long	.LASF2116
+	.value	0x6b5
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x22
+	.long	.LASF1859
+	.value	0x6b6
+	.byte	0xd
+	.long	0xf1
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF2117
+	.value	0x6b7
+	.byte	0xb
+	.long	0xad4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2118
+	.value	0x6b8
+	.long	0x1dad
+	.uleb128 0x1f
+	.long	0x1dfc
+	.uleb128 0x16
+	.long	0x1e07
+	.long	0x1e1c
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1e0c
+	.uleb128 0x1e
+	.long	.LASF2119
+	.value	0x6bb
+	.byte	0x1b
+	.long	0x1e1c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspCommands
+	.uleb128 0x16
+	.long	0x1abe
+	.long	0x1e47
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2120
+	.value	0x712
+	.byte	0x1a
+	.long	0x1e37
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspCommandStats
+	.uleb128 0x16
+	.long	0x102
+	.long	0x1e6d
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x1f
+	.long	0x1e5d
+	.uleb128 0x1e
+	.long	.LASF2121
+	.value	0x7b0
+	.byte	0x16
+	.long	0x1e6d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspTelemetryCommandSequence
+	.uleb128 0x1e
+	.long	.LASF2122
+	.value	0x7bf
+	.byte	0x13
+	.long	0x1d90
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspTelemetryPort
+	.uleb128 0x2d
+	.long	.LASF2125
+	.byte	0x14
+	.byte	0x9c
+	.long	0x1eaf
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2123
+	.byte	0x15
+	.byte	0x4c
+	.byte	0x12
+	.long	0xfdf
+	.long	0x1eca
+	.uleb128 0xa
+	.long	0x1eca
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x10
+	.long	0x1098
+	.uleb128 0x1d
+	.long	.LASF2124
+	.byte	0xb
+	.byte	0x5a
+	.byte	0xa
+	.long	0x113
+	.long	0x1eef
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x565
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2127
+	.byte	0x26
+	.byte	0x22
+	.uleb128 0x35
+	.long	.LASF2130
+	.byte	0x1f
+	.byte	0x30
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x2d
+	.long	.LASF2126
+	.byte	0x1f
+	.byte	0x2d
+	.long	0x1f13
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2128
+	.byte	0x1f
+	.byte	0x2f
+	.uleb128 0x1d
+	.long	.LASF2129
+	.byte	0x7
+	.byte	0x36
+	.byte	0xa
+	.long	0x113
+	.long	0x1f30
+	.uleb128 0xa
+	.long	0x1da
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2131
+	.byte	0x7
+	.byte	0x37
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x1d
+	.long	.LASF2132
+	.byte	0x7
+	.byte	0x35
+	.byte	0x1c
+	.long	0x1f52
+	.long	0x1f52
+	.uleb128 0xa
+	.long	0x1da
+	.byte	0
+	.uleb128 0x10
+	.long	0x25e
+	.uleb128 0x1d
+	.long	.LASF2133
+	.byte	0x27
+	.byte	0x2d
+	.byte	0x5
+	.long	0x94
+	.long	0x1f77
+	.uleb128 0xa
+	.long	0x94
+	.uleb128 0xa
+	.long	0x94
+	.uleb128 0xa
+	.long	0x94
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF2134
+	.byte	0x28
+	.value	0x13d
+	.byte	0x11
+	.long	0xa7
+	.long	0x1f8e
+	.uleb128 0xa
+	.long	0x14a
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2135
+	.byte	0x29
+	.byte	0x15
+	.uleb128 0x2d
+	.long	.LASF2136
+	.byte	0x1a
+	.byte	0x2d
+	.long	0x1fa6
+	.uleb128 0xa
+	.long	0x107
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2137
+	.byte	0x1f
+	.byte	0x35
+	.uleb128 0x34
+	.long	.LASF2138
+	.byte	0x1f
+	.byte	0x36
+	.uleb128 0x54
+	.long	.LASF2279
+	.byte	0x1f
+	.byte	0x38
+	.byte	0x6
+	.long	0x1fc2
+	.uleb128 0x55
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2139
+	.byte	0x26
+	.byte	0x18
+	.byte	0xa
+	.long	0x113
+	.uleb128 0x1d
+	.long	.LASF2140
+	.byte	0x23
+	.byte	0x33
+	.byte	0x9
+	.long	0xf1
+	.long	0x1fe9
+	.uleb128 0xa
+	.long	0x565
+	.uleb128 0xa
+	.long	0x1fe9
+	.byte	0
+	.uleb128 0x10
+	.long	0x1a36
+	.uleb128 0x1d
+	.long	.LASF2141
+	.byte	0x23
+	.byte	0x32
+	.byte	0x9
+	.long	0xf1
+	.long	0x2004
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2142
+	.byte	0x23
+	.byte	0x37
+	.byte	0x5
+	.long	0x4f8
+	.long	0x2024
+	.uleb128 0xa
+	.long	0x2024
+	.uleb128 0xa
+	.long	0x107
+	.uleb128 0xa
+	.long	0x2029
+	.byte	0
+	.uleb128 0x10
+	.long	0x199a
+	.uleb128 0x10
+	.long	0x1a2a
+	.uleb128 0x35
+	.long	.LASF2143
+	.byte	0x23
+	.byte	0x36
+	.byte	0xa
+	.long	0x107
+	.uleb128 0x1d
+	.long	.LASF2144
+	.byte	0x23
+	.byte	0x38
+	.byte	0x14
+	.long	0x1a59
+	.long	0x2055
+	.uleb128 0xa
+	.long	0x2055
+	.uleb128 0xa
+	.long	0x1fe9
+	.byte	0
+	.uleb128 0x10
+	.long	0x198e
+	.uleb128 0x1d
+	.long	.LASF2145
+	.byte	0x23
+	.byte	0x34
+	.byte	0x9
+	.long	0xf1
+	.long	0x207a
+	.uleb128 0xa
+	.long	0x364
+	.uleb128 0xa
+	.long	0x107
+	.uleb128 0xa
+	.long	0x2029
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2146
+	.byte	0x15
+	.byte	0x4b
+	.long	0x2095
+	.uleb128 0xa
+	.long	0x1eca
+	.uleb128 0xa
+	.long	0x565
+	.uleb128 0xa
+	.long	0x107
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2147
+	.byte	0x14
+	.byte	0x9a
+	.byte	0x21
+	.long	0x20a1
+	.uleb128 0x10
+	.long	0xed2
+	.uleb128 0x1d
+	.long	.LASF2148
+	.byte	0x14
+	.byte	0x8d
+	.byte	0xf
+	.long	0x4a2
+	.long	0x20d0
+	.uleb128 0xa
+	.long	0xdb5
+	.uleb128 0xa
+	.long	0x327
+	.uleb128 0xa
+	.long	0x113
+	.uleb128 0xa
+	.long	0x31b
+	.uleb128 0xa
+	.long	0x2e7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2149
+	.byte	0x1f
+	.byte	0x2c
+	.byte	0x5
+	.long	0x4f8
+	.long	0x20e6
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2150
+	.byte	0x1e
+	.byte	0x43
+	.byte	0x5
+	.long	0x4f8
+	.long	0x20fc
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2151
+	.byte	0x2a
+	.byte	0x3d
+	.byte	0xe
+	.long	0xba
+	.long	0x211c
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0xa
+	.long	0x94
+	.uleb128 0xa
+	.long	0x12b
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF2152
+	.byte	0x2a
+	.value	0x197
+	.byte	0xf
+	.long	0x12b
+	.long	0x2133
+	.uleb128 0xa
+	.long	0x145
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2153
+	.byte	0xb
+	.byte	0x5b
+	.byte	0xa
+	.long	0x565
+	.long	0x214e
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2154
+	.byte	0xb
+	.byte	0x58
+	.byte	0xa
+	.long	0x113
+	.long	0x2164
+	.uleb128 0xa
+	.long	0x4a2
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2155
+	.byte	0xb
+	.byte	0x5c
+	.long	0x217a
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0x113
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2156
+	.byte	0x2b
+	.byte	0x14
+	.byte	0x9
+	.long	0xf1
+	.long	0x2195
+	.uleb128 0xa
+	.long	0xf1
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1626
+	.byte	0xb
+	.byte	0x51
+	.long	0x21ab
+	.uleb128 0xa
+	.long	0x4a2
+	.uleb128 0xa
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2158
+	.value	0x7e0
+	.quad	.LFB100
+	.quad	.LFE100-.LFB100
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22bb
+	.uleb128 0x1e
+	.long	.LASF2157
+	.value	0x7e2
+	.byte	0x15
+	.long	0x113
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sequenceIndex.0
+	.uleb128 0x7
+	.long	0x25f6
+	.quad	.LBI1914
+	.value	.LVU4212
+	.long	.LLRL438
+	.value	0x7e8
+	.byte	0x5
+	.long	0x2206
+	.uleb128 0x4
+	.long	0x2601
+	.long	.LLST439
+	.long	.LVUS439
+	.byte	0
+	.uleb128 0x7
+	.long	0x271a
+	.quad	.LBI1921
+	.value	.LVU4228
+	.long	.LLRL440
+	.value	0x7eb
+	.byte	0x5
+	.long	0x22ad
+	.uleb128 0x4
+	.long	0x272a
+	.long	.LLST441
+	.long	.LVUS441
+	.uleb128 0xf
+	.long	.LLRL440
+	.uleb128 0xb
+	.long	0x2736
+	.long	.LLST442
+	.long	.LVUS442
+	.uleb128 0x7
+	.long	0x2797
+	.quad	.LBI1923
+	.value	.LVU4230
+	.long	.LLRL443
+	.value	0x752
+	.byte	0x23
+	.long	0x229e
+	.uleb128 0x4
+	.long	0x27a7
+	.long	.LLST444
+	.long	.LVUS444
+	.uleb128 0xf
+	.long	.LLRL445
+	.uleb128 0xb
+	.long	0x27b3
+	.long	.LLST446
+	.long	.LVUS446
+	.uleb128 0xb
+	.long	0x27bf
+	.long	.LLST447
+	.long	.LVUS447
+	.uleb128 0x3d
+	.long	0x27cb
+	.long	.LLRL448
+	.uleb128 0xb
+	.long	0x27cc
+	.long	.LLST449
+	.long	.LVUS449
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL895
+	.long	0x2743
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL890
+	.long	0x6f3e
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2159
+	.value	0x7c1
+	.quad	.LFB99
+	.quad	.LFE99-.LFB99
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x237c
+	.uleb128 0x3e
+	.long	.LASF1616
+	.value	0x7c1
+	.byte	0x28
+	.long	0x4a2
+	.long	.LLST430
+	.long	.LVUS430
+	.uleb128 0x18
+	.long	.LASF2160
+	.value	0x7c3
+	.byte	0xd
+	.long	0xf1
+	.long	.LLST431
+	.long	.LVUS431
+	.uleb128 0x18
+	.long	.LASF2161
+	.value	0x7c4
+	.byte	0x10
+	.long	0x1d90
+	.long	.LLST432
+	.long	.LVUS432
+	.uleb128 0x18
+	.long	.LASF2162
+	.value	0x7c5
+	.byte	0x10
+	.long	0x1d90
+	.long	.LLST433
+	.long	.LVUS433
+	.uleb128 0x19
+	.long	0x6cf6
+	.quad	.LBI1903
+	.value	.LVU4182
+	.long	.LLRL434
+	.value	0x7dd
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6d19
+	.long	.LLST435
+	.long	.LVUS435
+	.uleb128 0x4
+	.long	0x6d0d
+	.long	.LLST436
+	.long	.LVUS436
+	.uleb128 0x4
+	.long	0x6d01
+	.long	.LLST437
+	.long	.LVUS437
+	.uleb128 0x36
+	.quad	.LVL878
+	.long	0x207a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2163
+	.value	0x79c
+	.quad	.LFB98
+	.quad	.LFE98-.LFB98
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25f6
+	.uleb128 0x18
+	.long	.LASF2160
+	.value	0x79e
+	.byte	0xd
+	.long	0xf1
+	.long	.LLST411
+	.long	.LVUS411
+	.uleb128 0x18
+	.long	.LASF2161
+	.value	0x79f
+	.byte	0x10
+	.long	0x1d90
+	.long	.LLST412
+	.long	.LVUS412
+	.uleb128 0x7
+	.long	0x25f6
+	.quad	.LBI1854
+	.value	.LVU4044
+	.long	.LLRL413
+	.value	0x7a7
+	.byte	0x9
+	.long	0x23e9
+	.uleb128 0x4
+	.long	0x2601
+	.long	.LLST414
+	.long	.LVUS414
+	.byte	0
+	.uleb128 0x7
+	.long	0x260e
+	.quad	.LBI1857
+	.value	.LVU4053
+	.long	.LLRL415
+	.value	0x7a8
+	.byte	0x9
+	.long	0x25e8
+	.uleb128 0xf
+	.long	.LLRL415
+	.uleb128 0x56
+	.long	0x2619
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xb
+	.long	0x2625
+	.long	.LLST416
+	.long	.LVUS416
+	.uleb128 0xb
+	.long	0x2631
+	.long	.LLST417
+	.long	.LVUS417
+	.uleb128 0x7
+	.long	0x264e
+	.quad	.LBI1859
+	.value	.LVU4068
+	.long	.LLRL418
+	.value	0x791
+	.byte	0xd
+	.long	0x25cc
+	.uleb128 0x4
+	.long	0x2659
+	.long	.LLST419
+	.long	.LVUS419
+	.uleb128 0xf
+	.long	.LLRL418
+	.uleb128 0xb
+	.long	0x2663
+	.long	.LLST420
+	.long	.LVUS420
+	.uleb128 0x7
+	.long	0x2670
+	.quad	.LBI1861
+	.value	.LVU4076
+	.long	.LLRL421
+	.value	0x783
+	.byte	0x9
+	.long	0x259e
+	.uleb128 0xf
+	.long	.LLRL421
+	.uleb128 0x24
+	.long	0x267b
+	.uleb128 0x7
+	.long	0x2797
+	.quad	.LBI1863
+	.value	.LVU4093
+	.long	.LLRL422
+	.value	0x774
+	.byte	0xf
+	.long	0x24e7
+	.uleb128 0x4
+	.long	0x27a7
+	.long	.LLST423
+	.long	.LVUS423
+	.uleb128 0xf
+	.long	.LLRL422
+	.uleb128 0xb
+	.long	0x27b3
+	.long	.LLST424
+	.long	.LVUS424
+	.uleb128 0xb
+	.long	0x27bf
+	.long	.LLST425
+	.long	.LVUS425
+	.uleb128 0x3d
+	.long	0x27cb
+	.long	.LLRL426
+	.uleb128 0xb
+	.long	0x27cc
+	.long	.LLST427
+	.long	.LVUS427
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6f48
+	.quad	.LBI1874
+	.value	.LVU4113
+	.quad	.LBB1874
+	.quad	.LBE1874-.LBB1874
+	.value	0x777
+	.byte	0x9
+	.long	0x2533
+	.uleb128 0x4
+	.long	0x6f53
+	.long	.LLST428
+	.long	.LVUS428
+	.uleb128 0x6
+	.quad	.LVL856
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f3e
+	.quad	.LBI1876
+	.value	.LVU4117
+	.long	.LLRL429
+	.value	0x779
+	.byte	0x5
+	.long	0x258f
+	.uleb128 0xe
+	.long	0x70b9
+	.quad	.LBI1878
+	.value	.LVU4122
+	.quad	.LBB1878
+	.quad	.LBE1878-.LBB1878
+	.value	0x1fe
+	.byte	0x5
+	.long	0x2581
+	.uleb128 0x5
+	.quad	.LVL858
+	.long	0x2164
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL857
+	.long	0x7012
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL866
+	.long	0x2743
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL849
+	.long	0x1eaf
+	.long	0x25b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL862
+	.long	0x1e9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL843
+	.long	0x1ecf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL868
+	.long	0x1eef
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2164
+	.value	0x796
+	.long	0x260e
+	.uleb128 0x25
+	.long	.LASF1819
+	.value	0x796
+	.byte	0x20
+	.long	0x1d90
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2167
+	.value	0x789
+	.long	0x263e
+	.uleb128 0x1a
+	.long	.LASF1600
+	.value	0x78b
+	.byte	0xd
+	.long	0x263e
+	.uleb128 0x1a
+	.long	.LASF1590
+	.value	0x78c
+	.byte	0xe
+	.long	0x113
+	.uleb128 0x1a
+	.long	.LASF2166
+	.value	0x78d
+	.byte	0xe
+	.long	0x113
+	.byte	0
+	.uleb128 0x16
+	.long	0xf1
+	.long	0x264e
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2168
+	.value	0x77c
+	.long	0x2670
+	.uleb128 0x27
+	.string	"c"
+	.value	0x77c
+	.byte	0x2c
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2169
+	.value	0x77e
+	.byte	0x16
+	.long	0xfdf
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2170
+	.value	0x76b
+	.long	0x2688
+	.uleb128 0x1a
+	.long	.LASF2171
+	.value	0x76d
+	.byte	0x19
+	.long	0x2688
+	.byte	0
+	.uleb128 0x10
+	.long	0x1e07
+	.uleb128 0x47
+	.long	.LASF2172
+	.value	0x765
+	.byte	0x1a
+	.long	0x26bf
+	.quad	.LFB93
+	.quad	.LFE93-.LFB93
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26bf
+	.uleb128 0x57
+	.long	.LASF2166
+	.byte	0x1
+	.value	0x765
+	.byte	0x35
+	.long	0xf1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x10
+	.long	0x1aca
+	.uleb128 0x47
+	.long	.LASF2173
+	.value	0x760
+	.byte	0xa
+	.long	0x107
+	.quad	.LFB92
+	.quad	.LFE92-.LFB92
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26fb
+	.uleb128 0x3e
+	.long	.LASF2166
+	.value	0x760
+	.byte	0x22
+	.long	0xf1
+	.long	.LLST410
+	.long	.LVUS410
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF2280
+	.byte	0x1
+	.value	0x75b
+	.byte	0x9
+	.long	0xf1
+	.quad	.LFB91
+	.quad	.LFE91-.LFB91
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3f
+	.long	.LASF2174
+	.value	0x750
+	.byte	0xc
+	.long	0x4f8
+	.long	0x2743
+	.uleb128 0x25
+	.long	.LASF2101
+	.value	0x750
+	.byte	0x27
+	.long	0x107
+	.uleb128 0x1a
+	.long	.LASF2171
+	.value	0x752
+	.byte	0x19
+	.long	0x2688
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2175
+	.value	0x729
+	.byte	0xc
+	.long	0x4f8
+	.long	0x2792
+	.uleb128 0x25
+	.long	.LASF2171
+	.value	0x729
+	.byte	0x2f
+	.long	0x2688
+	.uleb128 0x1a
+	.long	.LASF2169
+	.value	0x72b
+	.byte	0x9
+	.long	0x4f8
+	.uleb128 0x1a
+	.long	.LASF1589
+	.value	0x736
+	.byte	0xe
+	.long	0x113
+	.uleb128 0x38
+	.uleb128 0x1a
+	.long	.LASF2176
+	.value	0x741
+	.byte	0x1c
+	.long	0x2792
+	.uleb128 0x1a
+	.long	.LASF2177
+	.value	0x742
+	.byte	0x12
+	.long	0x113
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x1abe
+	.uleb128 0x3f
+	.long	.LASF2178
+	.value	0x715
+	.byte	0x1c
+	.long	0x2688
+	.long	0x27da
+	.uleb128 0x25
+	.long	.LASF2101
+	.value	0x715
+	.byte	0x34
+	.long	0x107
+	.uleb128 0x30
+	.string	"low"
+	.value	0x717
+	.byte	0xd
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2179
+	.value	0x718
+	.byte	0xd
+	.long	0xf1
+	.uleb128 0x38
+	.uleb128 0x1a
+	.long	.LASF1718
+	.value	0x71b
+	.byte	0x11
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2182
+	.value	0x696
+	.long	0x4f8
+	.quad	.LFB87
+	.quad	.LFE87-.LFB87
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2873
+	.uleb128 0x1e
+	.long	.LASF2180
+	.value	0x698
+	.byte	0x18
+	.long	0x1a2a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x18
+	.long	.LASF2181
+	.value	0x699
+	.byte	0xd
+	.long	0xf1
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI273
+	.value	.LVU408
+	.quad	.LBB273
+	.quad	.LBE273-.LBB273
+	.value	0x69b
+	.byte	0x9
+	.uleb128 0x8
+	.quad	.LVL51
+	.long	0x203a
+	.long	0x285e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL53
+	.long	0x205a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2183
+	.value	0x660
+	.long	0x4f8
+	.quad	.LFB86
+	.quad	.LFE86-.LFB86
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b87
+	.uleb128 0x1e
+	.long	.LASF2180
+	.value	0x662
+	.byte	0x18
+	.long	0x1a2a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1e
+	.long	.LASF1600
+	.value	0x663
+	.byte	0xd
+	.long	0xb51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1a
+	.long	.LASF2184
+	.value	0x664
+	.byte	0xe
+	.long	0x107
+	.uleb128 0x18
+	.long	.LASF2185
+	.value	0x665
+	.byte	0xe
+	.long	0x107
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x18
+	.long	.LASF2181
+	.value	0x666
+	.byte	0xe
+	.long	0x107
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x18
+	.long	.LASF2166
+	.value	0x667
+	.byte	0xe
+	.long	0x107
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x14
+	.string	"i"
+	.value	0x668
+	.byte	0xd
+	.long	0xf1
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x18
+	.long	.LASF2186
+	.value	0x669
+	.byte	0xe
+	.long	0x113
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x18
+	.long	.LASF2187
+	.value	0x66a
+	.byte	0xe
+	.long	0x107
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI1117
+	.value	.LVU2151
+	.long	.LLRL157
+	.value	0x664
+	.byte	0x1b
+	.long	0x299c
+	.uleb128 0xf
+	.long	.LLRL157
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI1119
+	.value	.LVU2153
+	.long	.LLRL159
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1125
+	.value	.LVU2165
+	.quad	.LBB1125
+	.quad	.LBE1125-.LBB1125
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1131
+	.value	.LVU2218
+	.long	.LLRL160
+	.value	0x683
+	.byte	0x5
+	.long	0x2a02
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x8
+	.quad	.LVL237
+	.long	0x6f74
+	.long	0x29e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 3
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL254
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7d
+	.sleb128 3
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1140
+	.value	.LVU2229
+	.long	.LLRL162
+	.value	0x685
+	.byte	0x5
+	.long	0x2a79
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x5
+	.quad	.LVL240
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL241
+	.long	0x7012
+	.long	0x2a4e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL258
+	.long	0x7012
+	.long	0x2a65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL259
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL223
+	.long	0x214e
+	.uleb128 0x5
+	.quad	.LVL225
+	.long	0x202e
+	.uleb128 0x8
+	.quad	.LVL230
+	.long	0x2004
+	.long	0x2abb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL231
+	.long	0x1fee
+	.uleb128 0x5
+	.quad	.LVL232
+	.long	0x1fee
+	.uleb128 0x5
+	.quad	.LVL235
+	.long	0x202e
+	.uleb128 0x8
+	.quad	.LVL238
+	.long	0x7012
+	.long	0x2af9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL239
+	.long	0x202e
+	.uleb128 0x8
+	.quad	.LVL246
+	.long	0x2004
+	.long	0x2b2a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL247
+	.long	0x1fce
+	.long	0x2b48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL250
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL252
+	.long	0x202e
+	.uleb128 0x8
+	.quad	.LVL255
+	.long	0x7012
+	.long	0x2b79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL256
+	.long	0x202e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2188
+	.value	0x632
+	.long	0x4f8
+	.quad	.LFB85
+	.quad	.LFE85-.LFB85
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2cc4
+	.uleb128 0x18
+	.long	.LASF2189
+	.value	0x634
+	.byte	0xe
+	.long	0x107
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x18
+	.long	.LASF2190
+	.value	0x635
+	.byte	0xe
+	.long	0x107
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x18
+	.long	.LASF2187
+	.value	0x636
+	.byte	0xe
+	.long	0x113
+	.long	.LLST345
+	.long	.LVUS345
+	.uleb128 0x18
+	.long	.LASF2108
+	.value	0x637
+	.byte	0xe
+	.long	0x113
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0x40
+	.long	.LLRL349
+	.long	0x2c2a
+	.uleb128 0x18
+	.long	.LASF2166
+	.value	0x651
+	.byte	0x13
+	.long	0x107
+	.long	.LLST350
+	.long	.LVUS350
+	.uleb128 0x6
+	.quad	.LVL702
+	.long	0x2cc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1714
+	.value	.LVU3524
+	.long	.LLRL347
+	.value	0x64e
+	.byte	0x5
+	.long	0x2ca2
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST348
+	.long	.LVUS348
+	.uleb128 0x8
+	.quad	.LVL697
+	.long	0x6f74
+	.long	0x2c68
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL709
+	.long	0x6f74
+	.long	0x2c89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL713
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL685
+	.long	0x214e
+	.uleb128 0x6
+	.quad	.LVL694
+	.long	0x2cc4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2191
+	.value	0x622
+	.long	0x2cdc
+	.uleb128 0x25
+	.long	.LASF2166
+	.value	0x622
+	.byte	0x28
+	.long	0x107
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF2200
+	.value	0x61a
+	.long	0x4f8
+	.quad	.LFB83
+	.quad	.LFE83-.LFB83
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF2192
+	.value	0x5e9
+	.long	0x4f8
+	.quad	.LFB82
+	.quad	.LFE82-.LFB82
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d43
+	.uleb128 0x14
+	.string	"i"
+	.value	0x5eb
+	.byte	0xe
+	.long	0x113
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI112
+	.value	.LVU38
+	.long	.LLRL1
+	.value	0x5ee
+	.byte	0x2a
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2193
+	.value	0x5e3
+	.long	0x4f8
+	.quad	.LFB81
+	.quad	.LFE81-.LFB81
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d87
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI247
+	.value	.LVU330
+	.quad	.LBB247
+	.quad	.LBE247-.LBB247
+	.value	0x5e5
+	.byte	0x2a
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2194
+	.value	0x5da
+	.long	0x4f8
+	.quad	.LFB80
+	.quad	.LFE80-.LFB80
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ef9
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI489
+	.value	.LVU837
+	.quad	.LBB489
+	.quad	.LBE489-.LBB489
+	.value	0x5dc
+	.byte	0x2f
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI491
+	.value	.LVU848
+	.long	.LLRL62
+	.value	0x5dd
+	.byte	0x26
+	.long	0x2e30
+	.uleb128 0xf
+	.long	.LLRL62
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI493
+	.value	.LVU850
+	.long	.LLRL64
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI496
+	.value	.LVU859
+	.quad	.LBB496
+	.quad	.LBE496-.LBB496
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI501
+	.value	.LVU872
+	.long	.LLRL65
+	.value	0x5de
+	.byte	0x23
+	.long	0x2e96
+	.uleb128 0xf
+	.long	.LLRL65
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI503
+	.value	.LVU874
+	.long	.LLRL67
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI506
+	.value	.LVU883
+	.quad	.LBB506
+	.quad	.LBE506-.LBB506
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI511
+	.value	.LVU896
+	.long	.LLRL68
+	.value	0x5df
+	.byte	0x26
+	.uleb128 0xf
+	.long	.LLRL68
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI513
+	.value	.LVU898
+	.long	.LLRL70
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI516
+	.value	.LVU907
+	.quad	.LBB516
+	.quad	.LBE516-.LBB516
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2195
+	.value	0x5d4
+	.long	0x4f8
+	.quad	.LFB79
+	.quad	.LFE79-.LFB79
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f3d
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI251
+	.value	.LVU344
+	.quad	.LBB251
+	.quad	.LBE251-.LBB251
+	.value	0x5d6
+	.byte	0x27
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2196
+	.value	0x5cd
+	.long	0x4f8
+	.quad	.LFB78
+	.quad	.LFE78-.LFB78
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3027
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI287
+	.value	.LVU447
+	.long	.LLRL28
+	.value	0x5cf
+	.byte	0x34
+	.long	0x2fc4
+	.uleb128 0xf
+	.long	.LLRL28
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI289
+	.value	.LVU449
+	.long	.LLRL30
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI292
+	.value	.LVU460
+	.quad	.LBB292
+	.quad	.LBE292-.LBB292
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI296
+	.value	.LVU473
+	.long	.LLRL31
+	.value	0x5d0
+	.byte	0x35
+	.uleb128 0xf
+	.long	.LLRL31
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI298
+	.value	.LVU475
+	.long	.LLRL33
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI301
+	.value	.LVU484
+	.quad	.LBB301
+	.quad	.LBE301-.LBB301
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2197
+	.value	0x5c5
+	.long	0x4f8
+	.quad	.LFB77
+	.quad	.LFE77-.LFB77
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3177
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI395
+	.value	.LVU647
+	.long	.LLRL46
+	.value	0x5c7
+	.byte	0x2f
+	.long	0x30ae
+	.uleb128 0xf
+	.long	.LLRL46
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI397
+	.value	.LVU649
+	.long	.LLRL48
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI400
+	.value	.LVU660
+	.quad	.LBB400
+	.quad	.LBE400-.LBB400
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI404
+	.value	.LVU673
+	.long	.LLRL49
+	.value	0x5c8
+	.byte	0x30
+	.long	0x3114
+	.uleb128 0xf
+	.long	.LLRL49
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI406
+	.value	.LVU675
+	.long	.LLRL51
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI409
+	.value	.LVU684
+	.quad	.LBB409
+	.quad	.LBE409-.LBB409
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI414
+	.value	.LVU697
+	.long	.LLRL52
+	.value	0x5c9
+	.byte	0x2e
+	.uleb128 0xf
+	.long	.LLRL52
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI416
+	.value	.LVU699
+	.long	.LLRL54
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI419
+	.value	.LVU708
+	.quad	.LBB419
+	.quad	.LBE419-.LBB419
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2198
+	.value	0x5be
+	.long	0x4f8
+	.quad	.LFB76
+	.quad	.LFE76-.LFB76
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x32c7
+	.uleb128 0x7
+	.long	0x6fa2
+	.quad	.LBI359
+	.value	.LVU579
+	.long	.LLRL41
+	.value	0x5c1
+	.byte	0x5
+	.long	0x32ac
+	.uleb128 0xf
+	.long	.LLRL41
+	.uleb128 0xb
+	.long	0x6fb2
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xe
+	.long	0x6fbd
+	.quad	.LBI361
+	.value	.LVU581
+	.quad	.LBB361
+	.quad	.LBE361-.LBB361
+	.value	0x1c3
+	.byte	0x12
+	.long	0x323c
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI363
+	.value	.LVU583
+	.quad	.LBB363
+	.quad	.LBE363-.LBB363
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI365
+	.value	.LVU595
+	.quad	.LBB365
+	.quad	.LBE365-.LBB365
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI367
+	.value	.LVU609
+	.long	.LLRL44
+	.value	0x1c4
+	.byte	0x14
+	.uleb128 0xf
+	.long	.LLRL44
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI369
+	.value	.LVU611
+	.quad	.LBB369
+	.quad	.LBE369-.LBB369
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI371
+	.value	.LVU621
+	.quad	.LBB371
+	.quad	.LBE371-.LBB371
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL65
+	.long	0x1f13
+	.uleb128 0x5
+	.quad	.LVL71
+	.long	0x1f02
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2199
+	.value	0x587
+	.long	0x4f8
+	.quad	.LFB75
+	.quad	.LFE75-.LFB75
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3303
+	.uleb128 0x5
+	.quad	.LVL0
+	.long	0x1fb4
+	.uleb128 0x5
+	.quad	.LVL1
+	.long	0x1fad
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF2201
+	.value	0x581
+	.long	0x4f8
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF2202
+	.value	0x57b
+	.long	0x4f8
+	.quad	.LFB73
+	.quad	.LFE73-.LFB73
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3357
+	.uleb128 0x6
+	.quad	.LVL4
+	.long	0x1f95
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x190
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2203
+	.value	0x574
+	.long	0x4f8
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3393
+	.uleb128 0x5
+	.quad	.LVL2
+	.long	0x1fa6
+	.uleb128 0x5
+	.quad	.LVL3
+	.long	0x1fad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2204
+	.value	0x56a
+	.long	0x4f8
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x33dd
+	.uleb128 0x14
+	.string	"i"
+	.value	0x56c
+	.byte	0xe
+	.long	0x113
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI118
+	.value	.LVU61
+	.long	.LLRL3
+	.value	0x56f
+	.byte	0x3b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2205
+	.value	0x556
+	.long	0x4f8
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3573
+	.uleb128 0x14
+	.string	"i"
+	.value	0x558
+	.byte	0xe
+	.long	0x113
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xf
+	.long	.LLRL13
+	.uleb128 0x18
+	.long	.LASF2206
+	.value	0x55e
+	.byte	0x12
+	.long	0x107
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI178
+	.value	.LVU245
+	.long	.LLRL15
+	.value	0x55b
+	.byte	0x2c
+	.long	0x348f
+	.uleb128 0xf
+	.long	.LLRL15
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI180
+	.value	.LVU247
+	.long	.LLRL17
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI183
+	.value	.LVU163
+	.quad	.LBB183
+	.quad	.LBE183-.LBB183
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI188
+	.value	.LVU176
+	.long	.LLRL18
+	.value	0x55c
+	.byte	0x2c
+	.long	0x34f5
+	.uleb128 0xf
+	.long	.LLRL18
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI190
+	.value	.LVU178
+	.long	.LLRL20
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI194
+	.value	.LVU187
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI201
+	.value	.LVU200
+	.long	.LLRL21
+	.value	0x55e
+	.byte	0x3b
+	.long	0x355b
+	.uleb128 0xf
+	.long	.LLRL21
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI203
+	.value	.LVU202
+	.long	.LLRL23
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI208
+	.value	.LVU212
+	.quad	.LBB208
+	.quad	.LBE208-.LBB208
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI217
+	.value	.LVU232
+	.long	.LLRL24
+	.value	0x565
+	.byte	0x2d
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2207
+	.value	0x54d
+	.long	0x4f8
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3609
+	.uleb128 0x14
+	.string	"i"
+	.value	0x54f
+	.byte	0xe
+	.long	0x113
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI130
+	.value	.LVU82
+	.long	.LLRL5
+	.value	0x552
+	.byte	0x1d
+	.uleb128 0xf
+	.long	.LLRL5
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI132
+	.value	.LVU84
+	.long	.LLRL7
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI136
+	.value	.LVU94
+	.quad	.LBB136
+	.quad	.LBE136-.LBB136
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2208
+	.value	0x53c
+	.long	0x4f8
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x39d3
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI629
+	.value	.LVU1046
+	.long	.LLRL81
+	.value	0x53e
+	.byte	0x5
+	.long	0x3688
+	.uleb128 0xf
+	.long	.LLRL81
+	.uleb128 0x24
+	.long	0x6fcd
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI631
+	.value	.LVU1048
+	.quad	.LBB631
+	.quad	.LBE631-.LBB631
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI633
+	.value	.LVU1057
+	.long	.LLRL82
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI639
+	.value	.LVU1066
+	.long	.LLRL83
+	.value	0x53f
+	.byte	0x32
+	.long	0x36e2
+	.uleb128 0xf
+	.long	.LLRL83
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI641
+	.value	.LVU1068
+	.long	.LLRL85
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI644
+	.value	.LVU1077
+	.long	.LLRL86
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI654
+	.value	.LVU1090
+	.long	.LLRL87
+	.value	0x540
+	.byte	0x32
+	.long	0x373c
+	.uleb128 0xf
+	.long	.LLRL87
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI656
+	.value	.LVU1092
+	.long	.LLRL89
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI662
+	.value	.LVU1101
+	.long	.LLRL90
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI675
+	.value	.LVU1114
+	.long	.LLRL91
+	.value	0x541
+	.byte	0x31
+	.long	0x37a2
+	.uleb128 0xf
+	.long	.LLRL91
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI677
+	.value	.LVU1116
+	.long	.LLRL93
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI680
+	.value	.LVU1125
+	.quad	.LBB680
+	.quad	.LBE680-.LBB680
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI686
+	.value	.LVU1139
+	.long	.LLRL94
+	.value	0x542
+	.byte	0x38
+	.long	0x3808
+	.uleb128 0xf
+	.long	.LLRL94
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI688
+	.value	.LVU1141
+	.long	.LLRL96
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI693
+	.value	.LVU1150
+	.quad	.LBB693
+	.quad	.LBE693-.LBB693
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI703
+	.value	.LVU1163
+	.long	.LLRL97
+	.value	0x543
+	.byte	0x5
+	.long	0x385a
+	.uleb128 0xf
+	.long	.LLRL97
+	.uleb128 0x24
+	.long	0x6fcd
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI705
+	.value	.LVU1165
+	.long	.LLRL98
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI712
+	.value	.LVU1172
+	.long	.LLRL99
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fa2
+	.quad	.LBI727
+	.value	.LVU1181
+	.long	.LLRL100
+	.value	0x544
+	.byte	0x5
+	.long	0x3920
+	.uleb128 0xf
+	.long	.LLRL100
+	.uleb128 0x24
+	.long	0x6fb2
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI729
+	.value	.LVU1183
+	.long	.LLRL101
+	.value	0x1c3
+	.byte	0x12
+	.long	0x38d0
+	.uleb128 0xf
+	.long	.LLRL101
+	.uleb128 0x24
+	.long	0x6fcd
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI731
+	.value	.LVU1185
+	.long	.LLRL102
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI738
+	.value	.LVU1192
+	.long	.LLRL103
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI763
+	.value	.LVU1201
+	.long	.LLRL104
+	.value	0x1c4
+	.byte	0x14
+	.uleb128 0xf
+	.long	.LLRL104
+	.uleb128 0x24
+	.long	0x6fcd
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI765
+	.value	.LVU1203
+	.long	.LLRL105
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI773
+	.value	.LVU1210
+	.long	.LLRL106
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI817
+	.value	.LVU1221
+	.long	.LLRL107
+	.value	0x545
+	.byte	0x27
+	.long	0x397a
+	.uleb128 0xf
+	.long	.LLRL107
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI819
+	.value	.LVU1223
+	.long	.LLRL109
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI827
+	.value	.LVU1233
+	.long	.LLRL110
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI856
+	.value	.LVU1248
+	.long	.LLRL111
+	.value	0x546
+	.byte	0x2c
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI865
+	.value	.LVU1257
+	.long	.LLRL112
+	.value	0x547
+	.byte	0x35
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI868
+	.value	.LVU1266
+	.long	.LLRL113
+	.value	0x548
+	.byte	0x35
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI871
+	.value	.LVU1275
+	.long	.LLRL114
+	.value	0x549
+	.byte	0x5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2209
+	.value	0x530
+	.long	0x4f8
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3a8f
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI441
+	.value	.LVU743
+	.long	.LLRL55
+	.value	0x532
+	.byte	0x31
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI445
+	.value	.LVU754
+	.long	.LLRL56
+	.value	0x533
+	.byte	0x31
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI448
+	.value	.LVU763
+	.long	.LLRL57
+	.value	0x534
+	.byte	0x37
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI451
+	.value	.LVU772
+	.long	.LLRL58
+	.value	0x535
+	.byte	0x31
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI454
+	.value	.LVU781
+	.long	.LLRL59
+	.value	0x536
+	.byte	0x21
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI457
+	.value	.LVU790
+	.long	.LLRL60
+	.value	0x537
+	.byte	0x31
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI460
+	.value	.LVU799
+	.long	.LLRL61
+	.value	0x538
+	.byte	0x32
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2210
+	.value	0x519
+	.long	0x4f8
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3bb9
+	.uleb128 0x14
+	.string	"i"
+	.value	0x51b
+	.byte	0xe
+	.long	0x113
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x14
+	.string	"mac"
+	.value	0x522
+	.byte	0x20
+	.long	0x3bb9
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x14
+	.string	"box"
+	.value	0x524
+	.byte	0x12
+	.long	0x3bbe
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI537
+	.value	.LVU947
+	.quad	.LBB537
+	.quad	.LBE537-.LBB537
+	.value	0x51d
+	.byte	0x9
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI539
+	.value	.LVU963
+	.long	.LLRL74
+	.value	0x523
+	.byte	0x9
+	.uleb128 0x7
+	.long	0x6e91
+	.quad	.LBI545
+	.value	.LVU973
+	.long	.LLRL75
+	.value	0x524
+	.byte	0x18
+	.long	0x3b6a
+	.uleb128 0x4
+	.long	0x6ea1
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0xf
+	.long	.LLRL75
+	.uleb128 0xb
+	.long	0x6ead
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0xb
+	.long	0x6eb9
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI552
+	.value	.LVU995
+	.quad	.LBB552
+	.quad	.LBE552-.LBB552
+	.value	0x52a
+	.byte	0x1c
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI554
+	.value	.LVU1005
+	.long	.LLRL79
+	.value	0x52b
+	.byte	0x1b
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI557
+	.value	.LVU1014
+	.long	.LLRL80
+	.value	0x52c
+	.byte	0x19
+	.byte	0
+	.uleb128 0x10
+	.long	0xcde
+	.uleb128 0x10
+	.long	0x1b5e
+	.uleb128 0xd
+	.long	.LASF2211
+	.value	0x4fa
+	.long	0x4f8
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3cff
+	.uleb128 0x14
+	.string	"i"
+	.value	0x4fc
+	.byte	0xe
+	.long	0x113
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI945
+	.value	.LVU1743
+	.long	.LLRL116
+	.value	0x500
+	.byte	0x38
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI950
+	.value	.LVU1722
+	.long	.LLRL117
+	.value	0x511
+	.byte	0x30
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI958
+	.value	.LVU1698
+	.long	.LLRL118
+	.value	0x512
+	.byte	0x30
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI961
+	.value	.LVU1708
+	.long	.LLRL119
+	.value	0x513
+	.byte	0x30
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI972
+	.value	.LVU1755
+	.long	.LLRL120
+	.value	0x501
+	.byte	0x38
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI978
+	.value	.LVU1767
+	.long	.LLRL121
+	.value	0x502
+	.byte	0x38
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI984
+	.value	.LVU1818
+	.long	.LLRL122
+	.value	0x50a
+	.byte	0x34
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI987
+	.value	.LVU1790
+	.long	.LLRL123
+	.value	0x50b
+	.byte	0x34
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI990
+	.value	.LVU1800
+	.long	.LLRL124
+	.value	0x50c
+	.byte	0x34
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI993
+	.value	.LVU1831
+	.long	.LLRL125
+	.value	0x506
+	.byte	0x3d
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI1002
+	.value	.LVU1843
+	.long	.LLRL126
+	.value	0x507
+	.byte	0x3d
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI1007
+	.value	.LVU1855
+	.long	.LLRL127
+	.value	0x508
+	.byte	0x11
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2212
+	.value	0x4f3
+	.long	0x4f8
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ddd
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI319
+	.value	.LVU508
+	.long	.LLRL34
+	.value	0x4f5
+	.byte	0x37
+	.long	0x3d7a
+	.uleb128 0xf
+	.long	.LLRL34
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI321
+	.value	.LVU510
+	.long	.LLRL36
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI324
+	.value	.LVU521
+	.long	.LLRL37
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI332
+	.value	.LVU535
+	.long	.LLRL38
+	.value	0x4f6
+	.byte	0x36
+	.uleb128 0xf
+	.long	.LLRL38
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI334
+	.value	.LVU537
+	.long	.LLRL40
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI337
+	.value	.LVU546
+	.quad	.LBB337
+	.quad	.LBE337-.LBB337
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2213
+	.value	0x4e8
+	.long	0x4f8
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3e84
+	.uleb128 0x14
+	.string	"i"
+	.value	0x4ea
+	.byte	0xe
+	.long	0x113
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x7
+	.long	0x6fbd
+	.quad	.LBI146
+	.value	.LVU120
+	.long	.LLRL9
+	.value	0x4ee
+	.byte	0x15
+	.long	0x3e76
+	.uleb128 0xf
+	.long	.LLRL9
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI148
+	.value	.LVU122
+	.long	.LLRL11
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI152
+	.value	.LVU132
+	.quad	.LBB152
+	.quad	.LBE152-.LBB152
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL25
+	.long	0x1f8e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2214
+	.value	0x4e2
+	.long	0x4f8
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f1a
+	.uleb128 0x1c
+	.long	0x6fbd
+	.quad	.LBI265
+	.value	.LVU377
+	.quad	.LBB265
+	.quad	.LBE265-.LBB265
+	.value	0x4e4
+	.byte	0xf
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI267
+	.value	.LVU379
+	.quad	.LBB267
+	.quad	.LBE267-.LBB267
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI269
+	.value	.LVU390
+	.quad	.LBB269
+	.quad	.LBE269-.LBB269
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2215
+	.value	0x4d7
+	.long	0x4f8
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f6c
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI255
+	.value	.LVU358
+	.long	.LLRL25
+	.value	0x4d9
+	.byte	0x2a
+	.uleb128 0x5
+	.quad	.LVL46
+	.long	0x1fb4
+	.uleb128 0x5
+	.quad	.LVL47
+	.long	0x1fad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2216
+	.value	0x4ae
+	.long	0x4f8
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3fed
+	.uleb128 0x14
+	.string	"i"
+	.value	0x4b0
+	.byte	0xe
+	.long	0x113
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1472
+	.value	.LVU3011
+	.long	.LLRL265
+	.value	0x4b2
+	.byte	0x5
+	.long	0x3fdf
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST266
+	.long	.LVUS266
+	.uleb128 0x6
+	.quad	.LVL524
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL526
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2217
+	.value	0x4a7
+	.long	0x4f8
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x405c
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1566
+	.value	.LVU3154
+	.long	.LLRL292
+	.value	0x4a9
+	.byte	0x5
+	.long	0x404e
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST293
+	.long	.LVUS293
+	.uleb128 0x6
+	.quad	.LVL575
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL576
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2218
+	.value	0x49d
+	.long	0x4f8
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x41d3
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1578
+	.value	.LVU3164
+	.long	.LLRL294
+	.value	0x49f
+	.byte	0x5
+	.long	0x40bd
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST295
+	.long	.LVUS295
+	.uleb128 0x6
+	.quad	.LVL578
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1582
+	.value	.LVU3172
+	.quad	.LBB1582
+	.quad	.LBE1582-.LBB1582
+	.value	0x4a1
+	.byte	0x5
+	.long	0x4115
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST296
+	.long	.LVUS296
+	.uleb128 0x5
+	.quad	.LVL582
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL583
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1584
+	.value	.LVU3180
+	.quad	.LBB1584
+	.quad	.LBE1584-.LBB1584
+	.value	0x4a2
+	.byte	0x5
+	.long	0x416d
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x5
+	.quad	.LVL586
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL587
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1586
+	.value	.LVU3188
+	.quad	.LBB1586
+	.quad	.LBE1586-.LBB1586
+	.value	0x4a3
+	.byte	0x5
+	.long	0x41c5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x5
+	.quad	.LVL590
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL591
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL579
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2219
+	.value	0x496
+	.long	0x4f8
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4242
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1588
+	.value	.LVU3198
+	.long	.LLRL299
+	.value	0x498
+	.byte	0x5
+	.long	0x4234
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0x6
+	.quad	.LVL593
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL594
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2220
+	.value	0x48e
+	.long	0x4f8
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4350
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1598
+	.value	.LVU3208
+	.long	.LLRL301
+	.value	0x490
+	.byte	0x5
+	.long	0x42a3
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x6
+	.quad	.LVL596
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1602
+	.value	.LVU3215
+	.quad	.LBB1602
+	.quad	.LBE1602-.LBB1602
+	.value	0x491
+	.byte	0x5
+	.long	0x42fb
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x5
+	.quad	.LVL599
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL600
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1604
+	.value	.LVU3223
+	.quad	.LBB1604
+	.quad	.LBE1604-.LBB1604
+	.value	0x492
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0x5
+	.quad	.LVL603
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL604
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2221
+	.value	0x485
+	.long	0x4f8
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44b6
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1614
+	.value	.LVU3233
+	.long	.LLRL305
+	.value	0x487
+	.byte	0x5
+	.long	0x43b1
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x6
+	.quad	.LVL606
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1618
+	.value	.LVU3240
+	.quad	.LBB1618
+	.quad	.LBE1618-.LBB1618
+	.value	0x488
+	.byte	0x5
+	.long	0x4409
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x5
+	.quad	.LVL609
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL610
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1620
+	.value	.LVU3248
+	.quad	.LBB1620
+	.quad	.LBE1620-.LBB1620
+	.value	0x489
+	.byte	0x5
+	.long	0x4461
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x5
+	.quad	.LVL613
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL614
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1622
+	.value	.LVU3256
+	.quad	.LBB1622
+	.quad	.LBE1622-.LBB1622
+	.value	0x48a
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST309
+	.long	.LVUS309
+	.uleb128 0x5
+	.quad	.LVL617
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL618
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2222
+	.value	0x47e
+	.long	0x4f8
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x45ec
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1632
+	.value	.LVU3266
+	.long	.LLRL310
+	.value	0x480
+	.byte	0x5
+	.long	0x4517
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST311
+	.long	.LVUS311
+	.uleb128 0x6
+	.quad	.LVL620
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1636
+	.value	.LVU3272
+	.quad	.LBB1636
+	.quad	.LBE1636-.LBB1636
+	.value	0x481
+	.byte	0x5
+	.long	0x45de
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1638
+	.value	.LVU3274
+	.long	.LLRL313
+	.value	0x1ac
+	.byte	0x5
+	.long	0x458c
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0x5
+	.quad	.LVL623
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL625
+	.long	0x7012
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1642
+	.value	.LVU3281
+	.quad	.LBB1642
+	.quad	.LBE1642-.LBB1642
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST315
+	.long	.LVUS315
+	.uleb128 0x5
+	.quad	.LVL627
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL628
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL621
+	.long	0x1ef6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2223
+	.value	0x475
+	.long	0x4f8
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4912
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1211
+	.value	.LVU2379
+	.long	.LLRL180
+	.value	0x477
+	.byte	0x5
+	.long	0x464d
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x6
+	.quad	.LVL298
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1215
+	.value	.LVU2385
+	.quad	.LBB1215
+	.quad	.LBE1215-.LBB1215
+	.value	0x478
+	.byte	0x5
+	.long	0x473d
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1216
+	.value	.LVU2387
+	.quad	.LBB1216
+	.quad	.LBE1216-.LBB1216
+	.value	0x1ac
+	.byte	0x5
+	.long	0x46e0
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST183
+	.long	.LVUS183
+	.uleb128 0x8
+	.quad	.LVL299
+	.long	0x7012
+	.long	0x46cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL300
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1218
+	.value	.LVU2392
+	.quad	.LBB1218
+	.quad	.LBE1218-.LBB1218
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x8
+	.quad	.LVL301
+	.long	0x7012
+	.long	0x4727
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x49
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL302
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x53
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1220
+	.value	.LVU2397
+	.quad	.LBB1220
+	.quad	.LBE1220-.LBB1220
+	.value	0x479
+	.byte	0x5
+	.long	0x4829
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1221
+	.value	.LVU2399
+	.quad	.LBB1221
+	.quad	.LBE1221-.LBB1221
+	.value	0x1ac
+	.byte	0x5
+	.long	0x47ce
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x8
+	.quad	.LVL303
+	.long	0x7012
+	.long	0x47ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL304
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1223
+	.value	.LVU2404
+	.quad	.LBB1223
+	.quad	.LBE1223-.LBB1223
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x8
+	.quad	.LVL305
+	.long	0x7012
+	.long	0x4814
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL306
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6fe6
+	.quad	.LBI1225
+	.value	.LVU2409
+	.quad	.LBB1225
+	.quad	.LBE1225-.LBB1225
+	.value	0x47a
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1226
+	.value	.LVU2411
+	.quad	.LBB1226
+	.quad	.LBE1226-.LBB1226
+	.value	0x1ac
+	.byte	0x5
+	.long	0x48b6
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x8
+	.quad	.LVL307
+	.long	0x7012
+	.long	0x48a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL308
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1228
+	.value	.LVU2416
+	.quad	.LBB1228
+	.quad	.LBE1228-.LBB1228
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x8
+	.quad	.LVL309
+	.long	0x7012
+	.long	0x48fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL310
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2224
+	.value	0x46d
+	.long	0x4f8
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4a20
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1183
+	.value	.LVU2354
+	.long	.LLRL176
+	.value	0x46f
+	.byte	0x5
+	.long	0x4973
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST177
+	.long	.LVUS177
+	.uleb128 0x6
+	.quad	.LVL288
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1187
+	.value	.LVU2361
+	.quad	.LBB1187
+	.quad	.LBE1187-.LBB1187
+	.value	0x470
+	.byte	0x5
+	.long	0x49cb
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x5
+	.quad	.LVL291
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL292
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1189
+	.value	.LVU2369
+	.quad	.LBB1189
+	.quad	.LBE1189-.LBB1189
+	.value	0x471
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x5
+	.quad	.LVL295
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL296
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2225
+	.value	0x451
+	.long	0x4f8
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f25
+	.uleb128 0x14
+	.string	"i"
+	.value	0x453
+	.byte	0xe
+	.long	0x113
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0x40
+	.long	.LLRL269
+	.long	0x4f0e
+	.uleb128 0x18
+	.long	.LASF2176
+	.value	0x45a
+	.byte	0x24
+	.long	0x1f52
+	.long	.LLST270
+	.long	.LVUS270
+	.uleb128 0x41
+	.quad	.LBB1557
+	.quad	.LBE1557-.LBB1557
+	.long	0x4ae2
+	.uleb128 0x18
+	.long	.LASF2226
+	.value	0x464
+	.byte	0x16
+	.long	0xf1
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1558
+	.value	.LVU3131
+	.long	.LLRL290
+	.value	0x465
+	.byte	0xd
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x5
+	.quad	.LVL570
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL571
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1516
+	.value	.LVU3054
+	.long	.LLRL271
+	.value	0x45b
+	.byte	0x9
+	.long	0x4b23
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0x6
+	.quad	.LVL532
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1520
+	.value	.LVU3062
+	.quad	.LBB1520
+	.quad	.LBE1520-.LBB1520
+	.value	0x45f
+	.byte	0x9
+	.long	0x4b7b
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST273
+	.long	.LVUS273
+	.uleb128 0x5
+	.quad	.LVL538
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL539
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1522
+	.value	.LVU3068
+	.quad	.LBB1522
+	.quad	.LBE1522-.LBB1522
+	.value	0x460
+	.byte	0x9
+	.long	0x4c50
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST274
+	.long	.LVUS274
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1524
+	.value	.LVU3070
+	.long	.LLRL275
+	.value	0x1ac
+	.byte	0x5
+	.long	0x4bfe
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x8
+	.quad	.LVL541
+	.long	0x7012
+	.long	0x4bf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL543
+	.long	0x7012
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1528
+	.value	.LVU3077
+	.quad	.LBB1528
+	.quad	.LBE1528-.LBB1528
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST277
+	.long	.LVUS277
+	.uleb128 0x5
+	.quad	.LVL545
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL546
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fe6
+	.quad	.LBI1530
+	.value	.LVU3084
+	.long	.LLRL278
+	.value	0x461
+	.byte	0x9
+	.long	0x4cf9
+	.uleb128 0x28
+	.long	0x6ff1
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1532
+	.value	.LVU3086
+	.long	.LLRL279
+	.value	0x1ac
+	.byte	0x5
+	.long	0x4cb0
+	.uleb128 0x28
+	.long	0x7007
+	.uleb128 0x5
+	.quad	.LVL547
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL548
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1535
+	.value	.LVU3090
+	.long	.LLRL280
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x28
+	.long	0x7007
+	.uleb128 0x8
+	.quad	.LVL549
+	.long	0x7012
+	.long	0x4ce3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL550
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1541
+	.value	.LVU3096
+	.quad	.LBB1541
+	.quad	.LBE1541-.LBB1541
+	.value	0x462
+	.byte	0x9
+	.long	0x4dc0
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST281
+	.long	.LVUS281
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1543
+	.value	.LVU3098
+	.long	.LLRL282
+	.value	0x1ac
+	.byte	0x5
+	.long	0x4d6e
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST283
+	.long	.LVUS283
+	.uleb128 0x5
+	.quad	.LVL554
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL556
+	.long	0x7012
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1547
+	.value	.LVU3105
+	.quad	.LBB1547
+	.quad	.LBE1547-.LBB1547
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x5
+	.quad	.LVL558
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL559
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1549
+	.value	.LVU3113
+	.quad	.LBB1549
+	.quad	.LBE1549-.LBB1549
+	.value	0x463
+	.byte	0x9
+	.long	0x4e95
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1551
+	.value	.LVU3115
+	.long	.LLRL286
+	.value	0x1ac
+	.byte	0x5
+	.long	0x4e43
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST287
+	.long	.LVUS287
+	.uleb128 0x8
+	.quad	.LVL561
+	.long	0x7012
+	.long	0x4e35
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL563
+	.long	0x7012
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1555
+	.value	.LVU3122
+	.quad	.LBB1555
+	.quad	.LBE1555-.LBB1555
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x5
+	.quad	.LVL565
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL566
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL530
+	.long	0x1f3c
+	.long	0x4ead
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL533
+	.long	0x7012
+	.long	0x4ec5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL534
+	.long	0x7012
+	.long	0x4edc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x39
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL535
+	.long	0x7012
+	.long	0x4ef3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL536
+	.long	0x1f30
+	.uleb128 0x5
+	.quad	.LVL552
+	.long	0x1f1a
+	.byte	0
+	.uleb128 0xc
+	.long	0x6fd8
+	.quad	.LBI1512
+	.value	.LVU3034
+	.long	.LLRL268
+	.value	0x455
+	.byte	0x25
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2227
+	.value	0x444
+	.long	0x4f8
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4fe1
+	.uleb128 0x14
+	.string	"i"
+	.value	0x446
+	.byte	0xe
+	.long	0x113
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1167
+	.value	.LVU2329
+	.long	.LLRL172
+	.value	0x448
+	.byte	0x5
+	.long	0x4f98
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x6
+	.quad	.LVL281
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1173
+	.value	.LVU2340
+	.long	.LLRL174
+	.value	0x44c
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x5
+	.quad	.LVL285
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL286
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2228
+	.value	0x3fb
+	.long	0x4f8
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5069
+	.uleb128 0x14
+	.string	"i"
+	.value	0x3fd
+	.byte	0xe
+	.long	0x113
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1250
+	.value	.LVU2472
+	.long	.LLRL198
+	.value	0x3ff
+	.byte	0x5
+	.long	0x5054
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0x6
+	.quad	.LVL329
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL331
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2229
+	.value	0x3e9
+	.long	0x4f8
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5465
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1276
+	.value	.LVU2488
+	.long	.LLRL200
+	.value	0x3eb
+	.byte	0x5
+	.long	0x50ca
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x6
+	.quad	.LVL333
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1280
+	.value	.LVU2494
+	.quad	.LBB1280
+	.quad	.LBE1280-.LBB1280
+	.value	0x3ec
+	.byte	0x5
+	.long	0x5128
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x8
+	.quad	.LVL334
+	.long	0x7012
+	.long	0x5114
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL335
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1282
+	.value	.LVU2500
+	.quad	.LBB1282
+	.quad	.LBE1282-.LBB1282
+	.value	0x3ed
+	.byte	0x5
+	.long	0x5180
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0x5
+	.quad	.LVL338
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL339
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1284
+	.value	.LVU2508
+	.quad	.LBB1284
+	.quad	.LBE1284-.LBB1284
+	.value	0x3ee
+	.byte	0x5
+	.long	0x51d8
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x5
+	.quad	.LVL342
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL343
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1286
+	.value	.LVU2516
+	.quad	.LBB1286
+	.quad	.LBE1286-.LBB1286
+	.value	0x3ef
+	.byte	0x5
+	.long	0x5230
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST205
+	.long	.LVUS205
+	.uleb128 0x5
+	.quad	.LVL346
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL347
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1288
+	.value	.LVU2524
+	.quad	.LBB1288
+	.quad	.LBE1288-.LBB1288
+	.value	0x3f0
+	.byte	0x5
+	.long	0x5288
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x5
+	.quad	.LVL350
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL351
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1290
+	.value	.LVU2531
+	.quad	.LBB1290
+	.quad	.LBE1290-.LBB1290
+	.value	0x3f1
+	.byte	0x5
+	.long	0x52e6
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST207
+	.long	.LVUS207
+	.uleb128 0x8
+	.quad	.LVL352
+	.long	0x7012
+	.long	0x52d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL353
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1292
+	.value	.LVU2536
+	.quad	.LBB1292
+	.quad	.LBE1292-.LBB1292
+	.value	0x3f2
+	.byte	0x5
+	.long	0x53d2
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST208
+	.long	.LVUS208
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1293
+	.value	.LVU2538
+	.quad	.LBB1293
+	.quad	.LBE1293-.LBB1293
+	.value	0x1ac
+	.byte	0x5
+	.long	0x5377
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST209
+	.long	.LVUS209
+	.uleb128 0x8
+	.quad	.LVL354
+	.long	0x7012
+	.long	0x5363
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL355
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1295
+	.value	.LVU2543
+	.quad	.LBB1295
+	.quad	.LBE1295-.LBB1295
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST210
+	.long	.LVUS210
+	.uleb128 0x8
+	.quad	.LVL356
+	.long	0x7012
+	.long	0x53bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL357
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1297
+	.value	.LVU2550
+	.quad	.LBB1297
+	.quad	.LBE1297-.LBB1297
+	.value	0x3f3
+	.byte	0x5
+	.long	0x542a
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST211
+	.long	.LVUS211
+	.uleb128 0x5
+	.quad	.LVL360
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL361
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL362
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL363
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL364
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL365
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2230
+	.value	0x3da
+	.long	0x4f8
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x554f
+	.uleb128 0x14
+	.string	"i"
+	.value	0x3dc
+	.byte	0xe
+	.long	0x113
+	.long	.LLST356
+	.long	.LVUS356
+	.uleb128 0x41
+	.quad	.LBB1749
+	.quad	.LBE1749-.LBB1749
+	.long	0x5517
+	.uleb128 0x14
+	.string	"box"
+	.value	0x3e0
+	.byte	0x16
+	.long	0x3bbe
+	.long	.LLST359
+	.long	.LVUS359
+	.uleb128 0x7
+	.long	0x6ec6
+	.quad	.LBI1750
+	.value	.LVU3621
+	.long	.LLRL360
+	.value	0x3e0
+	.byte	0x1c
+	.long	0x5509
+	.uleb128 0x4
+	.long	0x6ed6
+	.long	.LLST361
+	.long	.LVUS361
+	.uleb128 0xf
+	.long	.LLRL360
+	.uleb128 0xb
+	.long	0x6ee2
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0xb
+	.long	0x6eee
+	.long	.LLST363
+	.long	.LVUS363
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL730
+	.long	0x7012
+	.byte	0
+	.uleb128 0x19
+	.long	0x6f5e
+	.quad	.LBI1743
+	.value	.LVU3609
+	.long	.LLRL357
+	.value	0x3de
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST358
+	.long	.LVUS358
+	.uleb128 0x6
+	.quad	.LVL722
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2231
+	.value	0x3d3
+	.long	0x4f8
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x557e
+	.uleb128 0x5
+	.quad	.LVL804
+	.long	0x6d26
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2232
+	.value	0x3c3
+	.long	0x4f8
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x564e
+	.uleb128 0x14
+	.string	"i"
+	.value	0x3c5
+	.byte	0xe
+	.long	0x113
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x40
+	.long	.LLRL319
+	.long	0x560f
+	.uleb128 0x30
+	.string	"mac"
+	.value	0x3c9
+	.byte	0x24
+	.long	0x3bb9
+	.uleb128 0x14
+	.string	"box"
+	.value	0x3ca
+	.byte	0x16
+	.long	0x3bbe
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x5
+	.quad	.LVL634
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL635
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL636
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL637
+	.long	0x7012
+	.byte	0
+	.uleb128 0x19
+	.long	0x6f5e
+	.quad	.LBI1644
+	.value	.LVU3292
+	.long	.LLRL317
+	.value	0x3c7
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST318
+	.long	.LVUS318
+	.uleb128 0x6
+	.quad	.LVL630
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xa0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2233
+	.value	0x3bc
+	.long	0x4f8
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x56f5
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1733
+	.value	.LVU3586
+	.long	.LLRL351
+	.value	0x3be
+	.byte	0x5
+	.long	0x56b0
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST352
+	.long	.LVUS352
+	.uleb128 0x6
+	.quad	.LVL716
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2f
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6efb
+	.quad	.LBI1738
+	.value	.LVU3594
+	.long	.LLRL353
+	.value	0x3bf
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6f06
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0xf
+	.long	.LLRL353
+	.uleb128 0xb
+	.long	0x6f10
+	.long	.LLST355
+	.long	.LVUS355
+	.uleb128 0x5
+	.quad	.LVL718
+	.long	0x7012
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2234
+	.value	0x39c
+	.long	0x4f8
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x58e2
+	.uleb128 0x14
+	.string	"i"
+	.value	0x39e
+	.byte	0xe
+	.long	0x113
+	.long	.LLST212
+	.long	.LVUS212
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1299
+	.value	.LVU2565
+	.long	.LLRL213
+	.value	0x3a0
+	.byte	0x5
+	.long	0x5769
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x6
+	.quad	.LVL367
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x4e
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL371
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL372
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL373
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL378
+	.long	0x1f77
+	.uleb128 0x8
+	.quad	.LVL379
+	.long	0x1f57
+	.long	0x57ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL380
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL381
+	.long	0x1f77
+	.uleb128 0x8
+	.quad	.LVL382
+	.long	0x1f57
+	.long	0x57f1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL383
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL384
+	.long	0x1f77
+	.uleb128 0x8
+	.quad	.LVL385
+	.long	0x1f57
+	.long	0x5828
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL386
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL388
+	.long	0x1f77
+	.uleb128 0x8
+	.quad	.LVL389
+	.long	0x1f57
+	.long	0x585f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL390
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL391
+	.long	0x1f77
+	.uleb128 0x8
+	.quad	.LVL392
+	.long	0x1f57
+	.long	0x5896
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL393
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL394
+	.long	0x7012
+	.long	0x58ba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL396
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL397
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL398
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2235
+	.value	0x38f
+	.long	0x4f8
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x599f
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1305
+	.value	.LVU2647
+	.long	.LLRL215
+	.value	0x391
+	.byte	0x5
+	.long	0x5943
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST216
+	.long	.LVUS216
+	.uleb128 0x6
+	.quad	.LVL402
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL403
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL404
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL405
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL406
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL407
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL408
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL409
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2236
+	.value	0x382
+	.long	0x4f8
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b6b
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1319
+	.value	.LVU2677
+	.long	.LLRL217
+	.value	0x384
+	.byte	0x5
+	.long	0x5a00
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x6
+	.quad	.LVL411
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1323
+	.value	.LVU2687
+	.quad	.LBB1323
+	.quad	.LBE1323-.LBB1323
+	.value	0x386
+	.byte	0x5
+	.long	0x5a58
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x5
+	.quad	.LVL416
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL417
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1325
+	.value	.LVU2692
+	.quad	.LBB1325
+	.quad	.LBE1325-.LBB1325
+	.value	0x387
+	.byte	0x5
+	.long	0x5ab0
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x5
+	.quad	.LVL420
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL421
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1327
+	.value	.LVU2704
+	.quad	.LBB1327
+	.quad	.LBE1327-.LBB1327
+	.value	0x38b
+	.byte	0x9
+	.long	0x5b08
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x5
+	.quad	.LVL424
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL425
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL412
+	.long	0x1f57
+	.long	0x5b25
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL413
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL414
+	.long	0x1f57
+	.long	0x5b50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0xffff
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL422
+	.long	0x1f57
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0xffff
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2237
+	.value	0x37a
+	.long	0x4f8
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5d04
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1339
+	.value	.LVU2714
+	.long	.LLRL222
+	.value	0x37c
+	.byte	0x5
+	.long	0x5bcc
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST223
+	.long	.LVUS223
+	.uleb128 0x6
+	.quad	.LVL427
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1343
+	.value	.LVU2720
+	.quad	.LBB1343
+	.quad	.LBE1343-.LBB1343
+	.value	0x37d
+	.byte	0x5
+	.long	0x5ca1
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1345
+	.value	.LVU2722
+	.long	.LLRL225
+	.value	0x1ac
+	.byte	0x5
+	.long	0x5c4f
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST226
+	.long	.LVUS226
+	.uleb128 0x8
+	.quad	.LVL429
+	.long	0x7012
+	.long	0x5c41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL431
+	.long	0x7012
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1349
+	.value	.LVU2729
+	.quad	.LBB1349
+	.quad	.LBE1349-.LBB1349
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST227
+	.long	.LVUS227
+	.uleb128 0x5
+	.quad	.LVL433
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL434
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1351
+	.value	.LVU2736
+	.quad	.LBB1351
+	.quad	.LBE1351-.LBB1351
+	.value	0x37e
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST228
+	.long	.LVUS228
+	.uleb128 0x8
+	.quad	.LVL436
+	.long	0x7012
+	.long	0x5ceb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL437
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2238
+	.value	0x36f
+	.long	0x4f8
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e40
+	.uleb128 0x14
+	.string	"i"
+	.value	0x371
+	.byte	0xe
+	.long	0x113
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1359
+	.value	.LVU2745
+	.long	.LLRL230
+	.value	0x373
+	.byte	0x5
+	.long	0x5d77
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST231
+	.long	.LVUS231
+	.uleb128 0x6
+	.quad	.LVL439
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1363
+	.value	.LVU2754
+	.long	.LLRL232
+	.value	0x375
+	.byte	0x9
+	.long	0x5deb
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x5
+	.quad	.LVL442
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL443
+	.long	0x7012
+	.long	0x5dc6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL446
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL447
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1367
+	.value	.LVU2773
+	.quad	.LBB1367
+	.quad	.LBE1367-.LBB1367
+	.value	0x376
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0x5
+	.quad	.LVL450
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL451
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2239
+	.value	0x365
+	.long	0x4f8
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5eef
+	.uleb128 0x14
+	.string	"i"
+	.value	0x367
+	.byte	0xe
+	.long	0x113
+	.long	.LLST235
+	.long	.LVUS235
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1373
+	.value	.LVU2784
+	.long	.LLRL236
+	.value	0x369
+	.byte	0x5
+	.long	0x5ea6
+	.uleb128 0x28
+	.long	0x6f69
+	.uleb128 0x6
+	.quad	.LVL453
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1379
+	.value	.LVU2796
+	.long	.LLRL237
+	.value	0x36b
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x5
+	.quad	.LVL458
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL459
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2240
+	.value	0x35f
+	.long	0x4f8
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f8f
+	.uleb128 0x19
+	.long	0x6f1b
+	.quad	.LBI1780
+	.value	.LVU3669
+	.long	.LLRL369
+	.value	0x361
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6f31
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x4
+	.long	0x6f26
+	.long	.LLST371
+	.long	.LVUS371
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1782
+	.value	.LVU3671
+	.long	.LLRL372
+	.value	0x204
+	.byte	0x5
+	.long	0x5f80
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST373
+	.long	.LVUS373
+	.uleb128 0x6
+	.quad	.LVL739
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL741
+	.long	0x7012
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2241
+	.value	0x354
+	.long	0x4f8
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6011
+	.uleb128 0x14
+	.string	"i"
+	.value	0x356
+	.byte	0xe
+	.long	0x113
+	.long	.LLST321
+	.long	.LVUS321
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1652
+	.value	.LVU3322
+	.long	.LLRL322
+	.value	0x358
+	.byte	0x5
+	.long	0x6003
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST323
+	.long	.LVUS323
+	.uleb128 0x6
+	.quad	.LVL640
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL642
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2242
+	.value	0x346
+	.long	0x4f8
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x619c
+	.uleb128 0x14
+	.string	"i"
+	.value	0x348
+	.byte	0xe
+	.long	0x113
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1238
+	.value	.LVU2425
+	.long	.LLRL192
+	.value	0x34a
+	.byte	0x5
+	.long	0x6086
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x6
+	.quad	.LVL312
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1244
+	.value	.LVU2439
+	.quad	.LBB1244
+	.quad	.LBE1244-.LBB1244
+	.value	0x34c
+	.byte	0x9
+	.long	0x60de
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x5
+	.quad	.LVL316
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL317
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1246
+	.value	.LVU2447
+	.quad	.LBB1246
+	.quad	.LBE1246-.LBB1246
+	.value	0x34d
+	.byte	0x9
+	.long	0x6136
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x5
+	.quad	.LVL320
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL321
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1248
+	.value	.LVU2455
+	.quad	.LBB1248
+	.quad	.LBE1248-.LBB1248
+	.value	0x34e
+	.byte	0x9
+	.long	0x618e
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0x5
+	.quad	.LVL324
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL325
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL326
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2243
+	.value	0x340
+	.long	0x4f8
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x623c
+	.uleb128 0x19
+	.long	0x6f1b
+	.quad	.LBI1760
+	.value	.LVU3648
+	.long	.LLRL364
+	.value	0x342
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x6f31
+	.long	.LLST365
+	.long	.LVUS365
+	.uleb128 0x4
+	.long	0x6f26
+	.long	.LLST366
+	.long	.LVUS366
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1762
+	.value	.LVU3650
+	.long	.LLRL367
+	.value	0x204
+	.byte	0x5
+	.long	0x622d
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x6
+	.quad	.LVL734
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL736
+	.long	0x7012
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2244
+	.value	0x32c
+	.long	0x4f8
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x63d4
+	.uleb128 0x30
+	.string	"i"
+	.value	0x32e
+	.byte	0xe
+	.long	0x113
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1393
+	.value	.LVU2813
+	.long	.LLRL239
+	.value	0x330
+	.byte	0x5
+	.long	0x62a7
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST240
+	.long	.LVUS240
+	.uleb128 0x6
+	.quad	.LVL461
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x42
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1399
+	.value	.LVU2827
+	.long	.LLRL241
+	.value	0x334
+	.byte	0xd
+	.long	0x62f3
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST242
+	.long	.LVUS242
+	.uleb128 0x5
+	.quad	.LVL466
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL467
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1403
+	.value	.LVU2836
+	.long	.LLRL243
+	.value	0x33a
+	.byte	0x9
+	.long	0x633f
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x5
+	.quad	.LVL472
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL473
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1407
+	.value	.LVU2848
+	.long	.LLRL245
+	.value	0x33c
+	.byte	0x9
+	.long	0x638b
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x5
+	.quad	.LVL478
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL479
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1411
+	.value	.LVU2862
+	.long	.LLRL247
+	.value	0x337
+	.byte	0xd
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x5
+	.quad	.LVL484
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL485
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2245
+	.value	0x2fc
+	.long	0x4f8
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x66de
+	.uleb128 0x14
+	.string	"i"
+	.value	0x2fe
+	.byte	0xe
+	.long	0x113
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x14
+	.string	"tmp"
+	.value	0x2ff
+	.byte	0xe
+	.long	0x113
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x18
+	.long	.LASF2246
+	.value	0x2ff
+	.byte	0x13
+	.long	0x113
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x41
+	.quad	.LBB1444
+	.quad	.LBE1444-.LBB1444
+	.long	0x6459
+	.uleb128 0x18
+	.long	.LASF2247
+	.value	0x323
+	.byte	0xd
+	.long	0x94
+	.long	.LLST258
+	.long	.LVUS258
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1430
+	.value	.LVU2876
+	.long	.LLRL252
+	.value	0x301
+	.byte	0x5
+	.long	0x6499
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x6
+	.quad	.LVL487
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3b
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1436
+	.value	.LVU2884
+	.quad	.LBB1436
+	.quad	.LBE1436-.LBB1436
+	.value	0x302
+	.byte	0x5
+	.long	0x64f1
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x5
+	.quad	.LVL490
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL491
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1438
+	.value	.LVU2891
+	.quad	.LBB1438
+	.quad	.LBE1438-.LBB1438
+	.value	0x306
+	.byte	0x5
+	.long	0x654f
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST255
+	.long	.LVUS255
+	.uleb128 0x8
+	.quad	.LVL492
+	.long	0x7012
+	.long	0x653b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL493
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1440
+	.value	.LVU2915
+	.long	.LLRL256
+	.value	0x308
+	.byte	0x5
+	.long	0x65a8
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0x8
+	.quad	.LVL500
+	.long	0x7012
+	.long	0x6594
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL501
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x6fe6
+	.quad	.LBI1445
+	.value	.LVU2971
+	.long	.LLRL259
+	.value	0x327
+	.byte	0x5
+	.long	0x665c
+	.uleb128 0x28
+	.long	0x6ff1
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1447
+	.value	.LVU2973
+	.long	.LLRL260
+	.value	0x1ac
+	.byte	0x5
+	.long	0x6608
+	.uleb128 0x28
+	.long	0x7007
+	.uleb128 0x5
+	.quad	.LVL508
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL509
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1451
+	.value	.LVU2977
+	.quad	.LBB1451
+	.quad	.LBE1451-.LBB1451
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x28
+	.long	0x7007
+	.uleb128 0x8
+	.quad	.LVL510
+	.long	0x7012
+	.long	0x6647
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL511
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL494
+	.long	0x20e6
+	.long	0x6673
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL495
+	.long	0x20e6
+	.long	0x668a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL496
+	.long	0x20e6
+	.long	0x66a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL497
+	.long	0x20e6
+	.long	0x66b9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL498
+	.long	0x20e6
+	.long	0x66d0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL512
+	.long	0x7012
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2248
+	.value	0x2f2
+	.long	0x4f8
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x684a
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1463
+	.value	.LVU2987
+	.long	.LLRL261
+	.value	0x2f4
+	.byte	0x5
+	.long	0x673f
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x6
+	.quad	.LVL515
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6fe6
+	.quad	.LBI1467
+	.value	.LVU2996
+	.quad	.LBB1467
+	.quad	.LBE1467-.LBB1467
+	.value	0x2f8
+	.byte	0x5
+	.long	0x6811
+	.uleb128 0x28
+	.long	0x6ff1
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1468
+	.value	.LVU2998
+	.quad	.LBB1468
+	.quad	.LBE1468-.LBB1468
+	.value	0x1ac
+	.byte	0x5
+	.long	0x67b6
+	.uleb128 0x28
+	.long	0x7007
+	.uleb128 0x5
+	.quad	.LVL519
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL520
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1470
+	.value	.LVU3002
+	.quad	.LBB1470
+	.quad	.LBE1470-.LBB1470
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x8
+	.quad	.LVL521
+	.long	0x7012
+	.long	0x67fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL522
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL516
+	.long	0x7012
+	.long	0x6829
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xe6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL517
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL518
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2249
+	.value	0x2b8
+	.long	0x4f8
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a6b
+	.uleb128 0x14
+	.string	"i"
+	.value	0x2ba
+	.byte	0xe
+	.long	0x113
+	.long	.LLST324
+	.long	.LVUS324
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1658
+	.value	.LVU3343
+	.long	.LLRL325
+	.value	0x2be
+	.byte	0x5
+	.long	0x68bf
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x6
+	.quad	.LVL645
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2c
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1664
+	.value	.LVU3380
+	.quad	.LBB1664
+	.quad	.LBE1664-.LBB1664
+	.value	0x2df
+	.byte	0x5
+	.long	0x691f
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x8
+	.quad	.LVL659
+	.long	0x7012
+	.long	0x690a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL660
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL646
+	.long	0x7012
+	.long	0x6937
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL647
+	.long	0x7012
+	.long	0x694e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL648
+	.long	0x7012
+	.long	0x6965
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL649
+	.long	0x7012
+	.long	0x697d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x43
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL650
+	.long	0x7012
+	.long	0x6995
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL651
+	.long	0x7012
+	.long	0x69ad
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x46
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL652
+	.long	0x7012
+	.long	0x69c5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL653
+	.long	0x7012
+	.long	0x69dc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL654
+	.long	0x7012
+	.long	0x69f4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL655
+	.long	0x7012
+	.long	0x6a0c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL657
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL662
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL665
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL666
+	.long	0x7012
+	.long	0x6a4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL668
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL669
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2250
+	.value	0x27a
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6c8d
+	.uleb128 0x3e
+	.long	.LASF2049
+	.value	0x27a
+	.byte	0x1e
+	.long	0x6c8d
+	.long	.LLST398
+	.long	.LVUS398
+	.uleb128 0x7
+	.long	0x6c92
+	.quad	.LBI1818
+	.value	.LVU3943
+	.long	.LLRL399
+	.value	0x2b3
+	.byte	0x5
+	.long	0x6bdf
+	.uleb128 0x4
+	.long	0x6c9d
+	.long	.LLST400
+	.long	.LVUS400
+	.uleb128 0xf
+	.long	.LLRL399
+	.uleb128 0xb
+	.long	0x6ca9
+	.long	.LLST401
+	.long	.LVUS401
+	.uleb128 0xb
+	.long	0x6cb5
+	.long	.LLST402
+	.long	.LVUS402
+	.uleb128 0x24
+	.long	0x6cc1
+	.uleb128 0x59
+	.long	0x6ccd
+	.long	.LLRL403
+	.long	0x6bd0
+	.uleb128 0xb
+	.long	0x6cce
+	.long	.LLST404
+	.long	.LVUS404
+	.uleb128 0x24
+	.long	0x6cda
+	.uleb128 0x49
+	.long	0x6ce6
+	.quad	.LBB1821
+	.quad	.LBE1821-.LBB1821
+	.long	0x6b80
+	.uleb128 0xb
+	.long	0x6ce7
+	.long	.LLST405
+	.long	.LVUS405
+	.uleb128 0x19
+	.long	0x6cf6
+	.quad	.LBI1822
+	.value	.LVU3964
+	.long	.LLRL406
+	.value	0x270
+	.byte	0xd
+	.uleb128 0x4
+	.long	0x6d19
+	.long	.LLST407
+	.long	.LVUS407
+	.uleb128 0x4
+	.long	0x6d0d
+	.long	.LLST408
+	.long	.LVUS408
+	.uleb128 0x4
+	.long	0x6d01
+	.long	.LLST409
+	.long	.LVUS409
+	.uleb128 0x6
+	.quad	.LVL823
+	.long	0x207a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL815
+	.long	0x20a6
+	.long	0x6ba6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL826
+	.long	0x20a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4b00
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL830
+	.long	0x2095
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL807
+	.long	0x20e6
+	.long	0x6bf6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL808
+	.long	0x20e6
+	.long	0x6c0d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL809
+	.long	0x20e6
+	.long	0x6c24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL810
+	.long	0x20d0
+	.long	0x6c3c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL811
+	.long	0x20d0
+	.long	0x6c53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL812
+	.long	0x20d0
+	.uleb128 0x8
+	.quad	.LVL813
+	.long	0x20d0
+	.long	0x6c79
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x200
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL831
+	.long	0x20e6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xf43
+	.uleb128 0x2f
+	.long	.LASF2251
+	.value	0x256
+	.long	0x6cf6
+	.uleb128 0x25
+	.long	.LASF2049
+	.value	0x256
+	.byte	0x33
+	.long	0x6c8d
+	.uleb128 0x1a
+	.long	.LASF1819
+	.value	0x258
+	.byte	0x13
+	.long	0x4a2
+	.uleb128 0x1a
+	.long	.LASF2160
+	.value	0x25a
+	.byte	0xd
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2252
+	.value	0x276
+	.byte	0x25
+	.long	0x20a1
+	.uleb128 0x38
+	.uleb128 0x1a
+	.long	.LASF1621
+	.value	0x25d
+	.byte	0x12
+	.long	0x113
+	.uleb128 0x1a
+	.long	.LASF2253
+	.value	0x25f
+	.byte	0xd
+	.long	0x4f8
+	.uleb128 0x38
+	.uleb128 0x1a
+	.long	.LASF2254
+	.value	0x26e
+	.byte	0x18
+	.long	0x1d90
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2255
+	.value	0x24a
+	.long	0x6d26
+	.uleb128 0x25
+	.long	.LASF2256
+	.value	0x24a
+	.byte	0x25
+	.long	0x1d90
+	.uleb128 0x25
+	.long	.LASF1616
+	.value	0x24a
+	.byte	0x43
+	.long	0x4a2
+	.uleb128 0x25
+	.long	.LASF2257
+	.value	0x24a
+	.byte	0x5e
+	.long	0x1c29
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2258
+	.value	0x22a
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6e91
+	.uleb128 0x14
+	.string	"i"
+	.value	0x22c
+	.byte	0x9
+	.long	0x94
+	.long	.LLST386
+	.long	.LVUS386
+	.uleb128 0x18
+	.long	.LASF2259
+	.value	0x22c
+	.byte	0xc
+	.long	0x94
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x14
+	.string	"j"
+	.value	0x22c
+	.byte	0x19
+	.long	0x94
+	.long	.LLST388
+	.long	.LVUS388
+	.uleb128 0x18
+	.long	.LASF2247
+	.value	0x22c
+	.byte	0x1c
+	.long	0x94
+	.long	.LLST389
+	.long	.LVUS389
+	.uleb128 0x18
+	.long	.LASF1590
+	.value	0x22c
+	.byte	0x26
+	.long	0x94
+	.long	.LLST390
+	.long	.LVUS390
+	.uleb128 0x14
+	.string	"len"
+	.value	0x22c
+	.byte	0x31
+	.long	0x94
+	.long	.LLST391
+	.long	.LVUS391
+	.uleb128 0x14
+	.string	"box"
+	.value	0x22d
+	.byte	0x12
+	.long	0x3bbe
+	.long	.LLST392
+	.long	.LVUS392
+	.uleb128 0x5a
+	.long	.LASF2281
+	.byte	0x1
+	.value	0x22f
+	.byte	0x1
+	.quad	.LDL1
+	.uleb128 0x7
+	.long	0x6ec6
+	.quad	.LBI1806
+	.value	.LVU3798
+	.long	.LLRL393
+	.value	0x235
+	.byte	0xf
+	.long	0x6e24
+	.uleb128 0x4
+	.long	0x6ed6
+	.long	.LLST394
+	.long	.LVUS394
+	.uleb128 0xf
+	.long	.LLRL393
+	.uleb128 0xb
+	.long	0x6ee2
+	.long	.LLST395
+	.long	.LVUS395
+	.uleb128 0xb
+	.long	0x6eee
+	.long	.LLST396
+	.long	.LVUS396
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x6f5e
+	.quad	.LBI1810
+	.value	.LVU3828
+	.quad	.LBB1810
+	.quad	.LBE1810-.LBB1810
+	.value	0x244
+	.byte	0x9
+	.long	0x6e6b
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST397
+	.long	.LVUS397
+	.uleb128 0x6
+	.quad	.LVL796
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL792
+	.long	0x211c
+	.long	0x6e83
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL802
+	.long	0x7012
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2260
+	.value	0x21d
+	.byte	0xe
+	.long	0x3bbe
+	.long	0x6ec6
+	.uleb128 0x25
+	.long	.LASF2261
+	.value	0x21d
+	.byte	0x2b
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2262
+	.value	0x21f
+	.byte	0xd
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2263
+	.value	0x220
+	.byte	0x12
+	.long	0x3bbe
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2264
+	.value	0x210
+	.byte	0xe
+	.long	0x3bbe
+	.long	0x6efb
+	.uleb128 0x25
+	.long	.LASF2259
+	.value	0x210
+	.byte	0x2b
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2262
+	.value	0x212
+	.byte	0xd
+	.long	0xf1
+	.uleb128 0x1a
+	.long	.LASF2263
+	.value	0x213
+	.byte	0x12
+	.long	0x3bbe
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2265
+	.value	0x209
+	.long	0x6f1b
+	.uleb128 0x27
+	.string	"s"
+	.value	0x209
+	.byte	0x21
+	.long	0x145
+	.uleb128 0x30
+	.string	"c"
+	.value	0x20b
+	.byte	0x11
+	.long	0x145
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2266
+	.value	0x202
+	.long	0x6f3e
+	.uleb128 0x27
+	.string	"cb"
+	.value	0x202
+	.byte	0x18
+	.long	0x565
+	.uleb128 0x27
+	.string	"siz"
+	.value	0x202
+	.byte	0x24
+	.long	0xf1
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF2267
+	.byte	0x1
+	.value	0x1fb
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x2a
+	.long	.LASF2268
+	.value	0x1f6
+	.long	0x6f5e
+	.uleb128 0x27
+	.string	"s"
+	.value	0x1f6
+	.byte	0x1f
+	.long	0x107
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2269
+	.value	0x1f1
+	.long	0x6f74
+	.uleb128 0x27
+	.string	"s"
+	.value	0x1f1
+	.byte	0x1f
+	.long	0x107
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2270
+	.value	0x1c8
+	.long	0x6fa2
+	.uleb128 0x27
+	.string	"err"
+	.value	0x1c8
+	.byte	0x21
+	.long	0xf1
+	.uleb128 0x27
+	.string	"s"
+	.value	0x1c8
+	.byte	0x2f
+	.long	0x107
+	.uleb128 0x1a
+	.long	.LASF2271
+	.value	0x1d9
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2272
+	.value	0x1c1
+	.byte	0xa
+	.long	0x113
+	.long	0x6fbd
+	.uleb128 0x30
+	.string	"t"
+	.value	0x1c3
+	.byte	0xe
+	.long	0x113
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2273
+	.value	0x1ba
+	.byte	0xa
+	.long	0x107
+	.long	0x6fd8
+	.uleb128 0x30
+	.string	"t"
+	.value	0x1bc
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF2274
+	.byte	0x1
+	.value	0x1b0
+	.byte	0x9
+	.long	0xf1
+	.byte	0x1
+	.uleb128 0x2a
+	.long	.LASF2275
+	.value	0x1aa
+	.long	0x6ffc
+	.uleb128 0x27
+	.string	"a"
+	.value	0x1aa
+	.byte	0x1b
+	.long	0x113
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2276
+	.value	0x1a4
+	.long	0x7012
+	.uleb128 0x27
+	.string	"a"
+	.value	0x1a4
+	.byte	0x1a
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2277
+	.value	0x18b
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x70b9
+	.uleb128 0x5d
+	.string	"a"
+	.byte	0x1
+	.value	0x18b
+	.byte	0x19
+	.long	0xf1
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x7
+	.long	0x70b9
+	.quad	.LBI1019
+	.value	.LVU1915
+	.long	.LLRL129
+	.value	0x196
+	.byte	0xd
+	.long	0x706a
+	.uleb128 0x5
+	.quad	.LVL164
+	.long	0x2164
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL160
+	.long	0x2195
+	.long	0x7086
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL161
+	.long	0x217a
+	.long	0x70a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL165
+	.long	0x2195
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF2282
+	.byte	0x1
+	.value	0x183
+	.byte	0xd
+	.byte	0x1
+	.uleb128 0x23
+	.long	0x6ffc
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7115
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x8
+	.quad	.LVL168
+	.long	0x7012
+	.long	0x7107
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL169
+	.long	0x7012
+	.byte	0
+	.uleb128 0x23
+	.long	0x6fe6
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71f4
+	.uleb128 0x4
+	.long	0x6ff1
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1027
+	.value	.LVU1936
+	.long	.LLRL132
+	.value	0x1ac
+	.byte	0x5
+	.long	0x7198
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x8
+	.quad	.LVL172
+	.long	0x7012
+	.long	0x717f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL174
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x6ffc
+	.quad	.LBI1033
+	.value	.LVU1947
+	.long	.LLRL134
+	.value	0x1ad
+	.byte	0x5
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x8
+	.quad	.LVL176
+	.long	0x7012
+	.long	0x71d9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x40
+	.byte	0x25
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL177
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x40
+	.byte	0x25
+	.byte	0x38
+	.byte	0x25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.long	0x6fd8
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x23
+	.long	0x6fbd
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7278
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1041
+	.value	.LVU1966
+	.quad	.LBB1041
+	.quad	.LBE1041-.LBB1041
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1043
+	.value	.LVU1977
+	.quad	.LBB1043
+	.quad	.LBE1043-.LBB1043
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.uleb128 0x23
+	.long	0x6fa2
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7387
+	.uleb128 0xb
+	.long	0x6fb2
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0xe
+	.long	0x6fbd
+	.quad	.LBI1057
+	.value	.LVU1990
+	.quad	.LBB1057
+	.quad	.LBE1057-.LBB1057
+	.value	0x1c3
+	.byte	0x12
+	.long	0x7318
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1059
+	.value	.LVU1992
+	.quad	.LBB1059
+	.quad	.LBE1059-.LBB1059
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1061
+	.value	.LVU2004
+	.quad	.LBB1061
+	.quad	.LBE1061-.LBB1061
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.uleb128 0x19
+	.long	0x6fbd
+	.quad	.LBI1063
+	.value	.LVU2018
+	.long	.LLRL139
+	.value	0x1c4
+	.byte	0x14
+	.uleb128 0xf
+	.long	.LLRL139
+	.uleb128 0xb
+	.long	0x6fcd
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1065
+	.value	.LVU2020
+	.quad	.LBB1065
+	.quad	.LBE1065-.LBB1065
+	.value	0x1bc
+	.byte	0x12
+	.uleb128 0x11
+	.long	0x6fd8
+	.quad	.LBI1067
+	.value	.LVU2030
+	.quad	.LBB1067
+	.quad	.LBE1067-.LBB1067
+	.value	0x1bd
+	.byte	0x14
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x6f74
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75f4
+	.uleb128 0x4
+	.long	0x6f7f
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x4
+	.long	0x6f8b
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x24
+	.long	0x6f95
+	.uleb128 0x60
+	.long	0x6ffc
+	.quad	.LBB1083
+	.quad	.LBE1083-.LBB1083
+	.byte	0x1
+	.value	0x1d2
+	.byte	0x9
+	.long	0x73e4
+	.uleb128 0x28
+	.long	0x7007
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f74
+	.quad	.LBI1085
+	.value	.LVU2060
+	.long	.LLRL143
+	.value	0x1c8
+	.byte	0x6
+	.long	0x759f
+	.uleb128 0x4
+	.long	0x6f8b
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x4
+	.long	0x6f7f
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0xf
+	.long	.LLRL143
+	.uleb128 0xb
+	.long	0x6f95
+	.long	.LLST146
+	.long	.LVUS146
+	.uleb128 0xe
+	.long	0x70b9
+	.quad	.LBI1087
+	.value	.LVU2062
+	.quad	.LBB1087
+	.quad	.LBE1087-.LBB1087
+	.value	0x1d7
+	.byte	0x5
+	.long	0x745e
+	.uleb128 0x5
+	.quad	.LVL193
+	.long	0x2164
+	.byte	0
+	.uleb128 0xe
+	.long	0x6ffc
+	.quad	.LBI1089
+	.value	.LVU2107
+	.quad	.LBB1089
+	.quad	.LBE1089-.LBB1089
+	.value	0x1ec
+	.byte	0x9
+	.long	0x74ac
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x5
+	.quad	.LVL202
+	.long	0x7012
+	.uleb128 0x5
+	.quad	.LVL204
+	.long	0x7012
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ffc
+	.quad	.LBI1091
+	.value	.LVU2114
+	.long	.LLRL148
+	.value	0x1ed
+	.byte	0x9
+	.long	0x7506
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x8
+	.quad	.LVL205
+	.long	0x7012
+	.long	0x74eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x39
+	.quad	.LVL207
+	.long	0x7012
+	.uleb128 0x39
+	.quad	.LVL212
+	.long	0x7012
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL195
+	.long	0x214e
+	.uleb128 0x8
+	.quad	.LVL196
+	.long	0x7012
+	.long	0x752b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL197
+	.long	0x7012
+	.uleb128 0x8
+	.quad	.LVL198
+	.long	0x7012
+	.long	0x7561
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x13
+	.byte	0x9
+	.byte	0xff
+	.byte	0x30
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x29
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x4d
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL199
+	.long	0x7012
+	.long	0x7578
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL208
+	.long	0x7012
+	.long	0x7590
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL213
+	.long	0x2133
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x6ffc
+	.quad	.LBI1105
+	.value	.LVU2140
+	.quad	.LBB1105
+	.quad	.LBE1105-.LBB1105
+	.value	0x1d0
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x7007
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x5
+	.quad	.LVL218
+	.long	0x7012
+	.uleb128 0x6
+	.quad	.LVL219
+	.long	0x7012
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.long	0x2743
+	.quad	.LFB89
+	.quad	.LFE89-.LFB89
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x76fe
+	.uleb128 0x4
+	.long	0x2753
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x24
+	.long	0x275f
+	.uleb128 0x24
+	.long	0x276b
+	.uleb128 0x19
+	.long	0x2743
+	.quad	.LBI1154
+	.value	.LVU2287
+	.long	.LLRL165
+	.value	0x729
+	.byte	0xc
+	.uleb128 0x4
+	.long	0x2753
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0xf
+	.long	.LLRL165
+	.uleb128 0xb
+	.long	0x275f
+	.long	.LLST167
+	.long	.LVUS167
+	.uleb128 0xb
+	.long	0x276b
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x49
+	.long	0x2777
+	.quad	.LBB1156
+	.quad	.LBE1156-.LBB1156
+	.long	0x76a9
+	.uleb128 0xb
+	.long	0x2778
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0xb
+	.long	0x2784
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x5
+	.quad	.LVL271
+	.long	0x1fc2
+	.byte	0
+	.uleb128 0xe
+	.long	0x6f5e
+	.quad	.LBI1157
+	.value	.LVU2323
+	.quad	.LBB1157
+	.quad	.LBE1157-.LBB1157
+	.value	0x73b
+	.byte	0x9
+	.long	0x76ee
+	.uleb128 0x62
+	.long	0x6f69
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL279
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL263
+	.long	0x1fc2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x2cc4
+	.quad	.LFB84
+	.quad	.LFE84-.LFB84
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x784a
+	.uleb128 0x4
+	.long	0x2ccf
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x7
+	.long	0x271a
+	.quad	.LBI1675
+	.value	.LVU3435
+	.long	.LLRL329
+	.value	0x627
+	.byte	0xa
+	.long	0x77cd
+	.uleb128 0x4
+	.long	0x272a
+	.long	.LLST330
+	.long	.LVUS330
+	.uleb128 0xf
+	.long	.LLRL329
+	.uleb128 0xb
+	.long	0x2736
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x7
+	.long	0x2797
+	.quad	.LBI1677
+	.value	.LVU3437
+	.long	.LLRL332
+	.value	0x752
+	.byte	0x23
+	.long	0x77be
+	.uleb128 0x4
+	.long	0x27a7
+	.long	.LLST333
+	.long	.LVUS333
+	.uleb128 0xf
+	.long	.LLRL334
+	.uleb128 0xb
+	.long	0x27b3
+	.long	.LLST335
+	.long	.LVUS335
+	.uleb128 0xb
+	.long	0x27bf
+	.long	.LLST336
+	.long	.LVUS336
+	.uleb128 0x3d
+	.long	0x27cb
+	.long	.LLRL337
+	.uleb128 0xb
+	.long	0x27cc
+	.long	.LLST338
+	.long	.LVUS338
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL679
+	.long	0x2743
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x2cc4
+	.quad	.LBI1699
+	.value	.LVU3453
+	.long	.LLRL339
+	.value	0x622
+	.byte	0xd
+	.uleb128 0x4
+	.long	0x2ccf
+	.long	.LLST340
+	.long	.LVUS340
+	.uleb128 0x19
+	.long	0x6f48
+	.quad	.LBI1701
+	.value	.LVU3455
+	.long	.LLRL341
+	.value	0x628
+	.byte	0x9
+	.uleb128 0x4
+	.long	0x6f53
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x63
+	.quad	.LVL677
+	.long	0x6f74
+	.long	0x782f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL683
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x6f5e
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7891
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST374
+	.long	.LVUS374
+	.uleb128 0x36
+	.quad	.LVL745
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x6f48
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x78d8
+	.uleb128 0x4
+	.long	0x6f53
+	.long	.LLST375
+	.long	.LVUS375
+	.uleb128 0x36
+	.quad	.LVL748
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x6f3e
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7935
+	.uleb128 0xe
+	.long	0x70b9
+	.quad	.LBI1798
+	.value	.LVU3702
+	.quad	.LBB1798
+	.quad	.LBE1798-.LBB1798
+	.value	0x1fe
+	.byte	0x5
+	.long	0x7927
+	.uleb128 0x5
+	.quad	.LVL750
+	.long	0x2164
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL749
+	.long	0x7012
+	.byte	0
+	.uleb128 0x23
+	.long	0x6f1b
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79bd
+	.uleb128 0x4
+	.long	0x6f26
+	.long	.LLST376
+	.long	.LVUS376
+	.uleb128 0x4
+	.long	0x6f31
+	.long	.LLST377
+	.long	.LVUS377
+	.uleb128 0x7
+	.long	0x6f5e
+	.quad	.LBI1800
+	.value	.LVU3716
+	.long	.LLRL378
+	.value	0x204
+	.byte	0x5
+	.long	0x79af
+	.uleb128 0x4
+	.long	0x6f69
+	.long	.LLST379
+	.long	.LVUS379
+	.uleb128 0x6
+	.quad	.LVL754
+	.long	0x6f74
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL757
+	.long	0x7012
+	.byte	0
+	.uleb128 0x23
+	.long	0x6efb
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a00
+	.uleb128 0x4
+	.long	0x6f06
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0xb
+	.long	0x6f10
+	.long	.LLST381
+	.long	.LVUS381
+	.uleb128 0x5
+	.quad	.LVL763
+	.long	0x7012
+	.byte	0
+	.uleb128 0x23
+	.long	0x6ec6
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a3d
+	.uleb128 0x42
+	.long	0x6ed6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.long	0x6ee2
+	.long	.LLST382
+	.long	.LVUS382
+	.uleb128 0xb
+	.long	0x6eee
+	.long	.LLST383
+	.long	.LVUS383
+	.byte	0
+	.uleb128 0x23
+	.long	0x6e91
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a7a
+	.uleb128 0x42
+	.long	0x6ea1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xb
+	.long	0x6ead
+	.long	.LLST384
+	.long	.LVUS384
+	.uleb128 0xb
+	.long	0x6eb9
+	.long	.LLST385
+	.long	.LVUS385
+	.byte	0
+	.uleb128 0x64
+	.long	0x25f6
+	.quad	.LFB97
+	.quad	.LFE97-.LFB97
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x42
+	.long	0x2601
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS439:
+	.uleb128 .LVU4212
+	.uleb128 .LVU4222
+.LLST439:
+	.byte	0x8
+	.quad	.LVL883
+	.uleb128 .LVL884-.LVL883
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS441:
+	.uleb128 .LVU4228
+	.uleb128 .LVU4245
+	.uleb128 .LVU4252
+	.uleb128 .LVU4262
+	.uleb128 .LVU4262
+	.uleb128 .LVU4264
+.LLST441:
+	.byte	0x6
+	.quad	.LVL885
+	.byte	0x4
+	.uleb128 .LVL885-.LVL885
+	.uleb128 .LVL889-.LVL885
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL891-.LVL885
+	.uleb128 .LVL894-.LVL885
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL894-.LVL885
+	.uleb128 .LVL895-1-.LVL885
+	.uleb128 0xd
+	.byte	0x3
+	.quad	mspTelemetryPort
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x136
+	.byte	0
+.LVUS442:
+	.uleb128 .LVU4257
+	.uleb128 .LVU4264
+.LLST442:
+	.byte	0x8
+	.quad	.LVL893
+	.uleb128 .LVL895-1-.LVL893
+	.uleb128 0x12
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	mspCommands
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU4230
+	.uleb128 .LVU4245
+	.uleb128 .LVU4252
+	.uleb128 .LVU4257
+.LLST444:
+	.byte	0x6
+	.quad	.LVL885
+	.byte	0x4
+	.uleb128 .LVL885-.LVL885
+	.uleb128 .LVL889-.LVL885
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL891-.LVL885
+	.uleb128 .LVL893-.LVL885
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS446:
+	.uleb128 .LVU4232
+	.uleb128 .LVU4245
+	.uleb128 .LVU4252
+	.uleb128 .LVU4257
+.LLST446:
+	.byte	0x6
+	.quad	.LVL886
+	.byte	0x4
+	.uleb128 .LVL886-.LVL886
+	.uleb128 .LVL889-.LVL886
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL891-.LVL886
+	.uleb128 .LVL893-.LVL886
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS447:
+	.uleb128 .LVU4232
+	.uleb128 .LVU4245
+	.uleb128 .LVU4252
+	.uleb128 .LVU4257
+.LLST447:
+	.byte	0x6
+	.quad	.LVL886
+	.byte	0x4
+	.uleb128 .LVL886-.LVL886
+	.uleb128 .LVL889-.LVL886
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL891-.LVL886
+	.uleb128 .LVL893-.LVL886
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS449:
+	.uleb128 .LVU4235
+	.uleb128 .LVU4239
+	.uleb128 .LVU4252
+	.uleb128 .LVU4255
+.LLST449:
+	.byte	0x6
+	.quad	.LVL887
+	.byte	0x4
+	.uleb128 .LVL887-.LVL887
+	.uleb128 .LVL888-.LVL887
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL891-.LVL887
+	.uleb128 .LVL893-.LVL887
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS430:
+	.uleb128 0
+	.uleb128 .LVU4179
+	.uleb128 .LVU4179
+	.uleb128 .LVU4189
+	.uleb128 .LVU4189
+	.uleb128 .LVU4191
+	.uleb128 .LVU4191
+	.uleb128 .LVU4192
+	.uleb128 .LVU4192
+	.uleb128 .LVU4192
+	.uleb128 .LVU4192
+	.uleb128 0
+.LLST430:
+	.byte	0x6
+	.quad	.LVL869
+	.byte	0x4
+	.uleb128 .LVL869-.LVL869
+	.uleb128 .LVL874-.LVL869
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL874-.LVL869
+	.uleb128 .LVL876-.LVL869
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL876-.LVL869
+	.uleb128 .LVL877-.LVL869
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL877-.LVL869
+	.uleb128 .LVL878-1-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspTelemetryPort
+	.byte	0x6
+	.byte	0x4
+	.uleb128 .LVL878-1-.LVL869
+	.uleb128 .LVL878-.LVL869
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL878-.LVL869
+	.uleb128 .LFE99-.LVL869
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS431:
+	.uleb128 .LVU4158
+	.uleb128 .LVU4166
+	.uleb128 .LVU4166
+	.uleb128 .LVU4170
+	.uleb128 .LVU4171
+	.uleb128 .LVU4175
+	.uleb128 .LVU4192
+	.uleb128 .LVU4194
+	.uleb128 .LVU4197
+	.uleb128 .LVU4201
+	.uleb128 .LVU4205
+	.uleb128 0
+.LLST431:
+	.byte	0x6
+	.quad	.LVL869
+	.byte	0x4
+	.uleb128 .LVL869-.LVL869
+	.uleb128 .LVL870-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL870-.LVL869
+	.uleb128 .LVL871-.LVL869
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL871-.LVL869
+	.uleb128 .LVL872-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL878-.LVL869
+	.uleb128 .LVL879-.LVL869
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL880-.LVL869
+	.uleb128 .LVL881-.LVL869
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL882-.LVL869
+	.uleb128 .LFE99-.LVL869
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS432:
+	.uleb128 .LVU4156
+	.uleb128 .LVU4160
+	.uleb128 .LVU4160
+	.uleb128 .LVU4168
+	.uleb128 .LVU4168
+	.uleb128 .LVU4172
+	.uleb128 .LVU4172
+	.uleb128 .LVU4175
+	.uleb128 .LVU4192
+	.uleb128 .LVU4196
+	.uleb128 .LVU4199
+	.uleb128 0
+.LLST432:
+	.byte	0x6
+	.quad	.LVL869
+	.byte	0x4
+	.uleb128 .LVL869-.LVL869
+	.uleb128 .LVL869-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL869-.LVL869
+	.uleb128 .LVL870-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL870-.LVL869
+	.uleb128 .LVL871-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspPorts+344
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL871-.LVL869
+	.uleb128 .LVL872-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL878-.LVL869
+	.uleb128 .LVL880-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspPorts+344
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL880-.LVL869
+	.uleb128 .LFE99-.LVL869
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspPorts+344
+	.byte	0x9f
+	.byte	0
+.LVUS433:
+	.uleb128 .LVU4157
+	.uleb128 .LVU4170
+	.uleb128 .LVU4171
+	.uleb128 .LVU4176
+	.uleb128 .LVU4176
+	.uleb128 .LVU4178
+	.uleb128 .LVU4192
+	.uleb128 .LVU4194
+	.uleb128 .LVU4194
+	.uleb128 .LVU4196
+	.uleb128 .LVU4196
+	.uleb128 0
+.LLST433:
+	.byte	0x6
+	.quad	.LVL869
+	.byte	0x4
+	.uleb128 .LVL869-.LVL869
+	.uleb128 .LVL871-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL871-.LVL869
+	.uleb128 .LVL873-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL873-.LVL869
+	.uleb128 .LVL873-.LVL869
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL878-.LVL869
+	.uleb128 .LVL879-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL879-.LVL869
+	.uleb128 .LVL880-.LVL869
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL880-.LVL869
+	.uleb128 .LFE99-.LVL869
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS435:
+	.uleb128 .LVU4182
+	.uleb128 .LVU4192
+.LLST435:
+	.byte	0x8
+	.quad	.LVL875
+	.uleb128 .LVL878-.LVL875
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS436:
+	.uleb128 .LVU4182
+	.uleb128 .LVU4189
+	.uleb128 .LVU4189
+	.uleb128 .LVU4191
+	.uleb128 .LVU4191
+	.uleb128 .LVU4192
+	.uleb128 .LVU4192
+	.uleb128 .LVU4192
+.LLST436:
+	.byte	0x6
+	.quad	.LVL875
+	.byte	0x4
+	.uleb128 .LVL875-.LVL875
+	.uleb128 .LVL876-.LVL875
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL876-.LVL875
+	.uleb128 .LVL877-.LVL875
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL877-.LVL875
+	.uleb128 .LVL878-1-.LVL875
+	.uleb128 0xa
+	.byte	0x3
+	.quad	mspTelemetryPort
+	.byte	0x6
+	.byte	0x4
+	.uleb128 .LVL878-1-.LVL875
+	.uleb128 .LVL878-.LVL875
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS437:
+	.uleb128 .LVU4182
+	.uleb128 .LVU4191
+	.uleb128 .LVU4191
+	.uleb128 .LVU4192
+.LLST437:
+	.byte	0x6
+	.quad	.LVL875
+	.byte	0x4
+	.uleb128 .LVL875-.LVL875
+	.uleb128 .LVL877-.LVL875
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL877-.LVL875
+	.uleb128 .LVL878-1-.LVL875
+	.uleb128 0x9
+	.byte	0x3
+	.quad	mspTelemetryPort
+	.byte	0
+.LVUS411:
+	.uleb128 .LVU4033
+	.uleb128 .LVU4035
+	.uleb128 .LVU4035
+	.uleb128 .LVU4039
+	.uleb128 .LVU4039
+	.uleb128 .LVU4040
+	.uleb128 .LVU4040
+	.uleb128 .LVU4042
+	.uleb128 .LVU4043
+	.uleb128 0
+.LLST411:
+	.byte	0x6
+	.quad	.LVL836
+	.byte	0x4
+	.uleb128 .LVL836-.LVL836
+	.uleb128 .LVL837-.LVL836
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL837-.LVL836
+	.uleb128 .LVL838-.LVL836
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL838-.LVL836
+	.uleb128 .LVL839-.LVL836
+	.uleb128 0x19
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL839-.LVL836
+	.uleb128 .LVL840-.LVL836
+	.uleb128 0x19
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts+344
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL841-.LVL836
+	.uleb128 .LFE98-.LVL836
+	.uleb128 0x17
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS412:
+	.uleb128 .LVU4036
+	.uleb128 .LVU4040
+	.uleb128 .LVU4040
+	.uleb128 .LVU4042
+	.uleb128 .LVU4043
+	.uleb128 0
+.LLST412:
+	.byte	0x6
+	.quad	.LVL837
+	.byte	0x4
+	.uleb128 .LVL837-.LVL837
+	.uleb128 .LVL839-.LVL837
+	.uleb128 0x2b
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x158
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL839-.LVL837
+	.uleb128 .LVL840-.LVL837
+	.uleb128 0x2b
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts+344
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x158
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL841-.LVL837
+	.uleb128 .LFE98-.LVL837
+	.uleb128 0x2b
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x158
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS414:
+	.uleb128 .LVU4044
+	.uleb128 .LVU4051
+.LLST414:
+	.byte	0x8
+	.quad	.LVL841
+	.uleb128 .LVL842-.LVL841
+	.uleb128 0x2b
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x158
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x158
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS416:
+	.uleb128 .LVU4060
+	.uleb128 .LVU4062
+.LLST416:
+	.byte	0x8
+	.quad	.LVL843
+	.uleb128 .LVL844-.LVL843
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS417:
+	.uleb128 .LVU4062
+	.uleb128 .LVU4065
+	.uleb128 .LVU4065
+	.uleb128 .LVU4066
+	.uleb128 .LVU4067
+	.uleb128 .LVU4132
+	.uleb128 .LVU4137
+	.uleb128 .LVU4149
+.LLST417:
+	.byte	0x6
+	.quad	.LVL844
+	.byte	0x4
+	.uleb128 .LVL844-.LVL844
+	.uleb128 .LVL845-.LVL844
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL845-.LVL844
+	.uleb128 .LVL846-.LVL844
+	.uleb128 0x8
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL847-.LVL844
+	.uleb128 .LVL859-.LVL844
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL861-.LVL844
+	.uleb128 .LVL867-.LVL844
+	.uleb128 0x6
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS419:
+	.uleb128 .LVU4062
+	.uleb128 .LVU4063
+	.uleb128 .LVU4068
+	.uleb128 .LVU4071
+	.uleb128 .LVU4071
+	.uleb128 .LVU4133
+	.uleb128 .LVU4137
+	.uleb128 .LVU4149
+.LLST419:
+	.byte	0x6
+	.quad	.LVL844
+	.byte	0x4
+	.uleb128 .LVL844-.LVL844
+	.uleb128 .LVL845-.LVL844
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL848-.LVL844
+	.uleb128 .LVL849-1-.LVL844
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL849-1-.LVL844
+	.uleb128 .LVL860-.LVL844
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL861-.LVL844
+	.uleb128 .LVL867-.LVL844
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU4062
+	.uleb128 .LVU4063
+	.uleb128 .LVU4071
+	.uleb128 .LVU4080
+	.uleb128 .LVU4137
+	.uleb128 .LVU4138
+.LLST420:
+	.byte	0x6
+	.quad	.LVL844
+	.byte	0x4
+	.uleb128 .LVL844-.LVL844
+	.uleb128 .LVL845-.LVL844
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL849-.LVL844
+	.uleb128 .LVL850-.LVL844
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL861-.LVL844
+	.uleb128 .LVL862-1-.LVL844
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS423:
+	.uleb128 .LVU4093
+	.uleb128 .LVU4111
+	.uleb128 .LVU4139
+	.uleb128 .LVU4144
+.LLST423:
+	.byte	0x6
+	.quad	.LVL851
+	.byte	0x4
+	.uleb128 .LVL851-.LVL851
+	.uleb128 .LVL855-.LVL851
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL863-.LVL851
+	.uleb128 .LVL865-.LVL851
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU4095
+	.uleb128 .LVU4097
+	.uleb128 .LVU4098
+	.uleb128 .LVU4111
+	.uleb128 .LVU4139
+	.uleb128 .LVU4144
+.LLST424:
+	.byte	0x6
+	.quad	.LVL851
+	.byte	0x4
+	.uleb128 .LVL851-.LVL851
+	.uleb128 .LVL851-.LVL851
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL852-.LVL851
+	.uleb128 .LVL855-.LVL851
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL863-.LVL851
+	.uleb128 .LVL865-.LVL851
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS425:
+	.uleb128 .LVU4096
+	.uleb128 .LVU4097
+	.uleb128 .LVU4098
+	.uleb128 .LVU4111
+	.uleb128 .LVU4139
+	.uleb128 .LVU4144
+.LLST425:
+	.byte	0x6
+	.quad	.LVL851
+	.byte	0x4
+	.uleb128 .LVL851-.LVL851
+	.uleb128 .LVL851-.LVL851
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL852-.LVL851
+	.uleb128 .LVL855-.LVL851
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL863-.LVL851
+	.uleb128 .LVL865-.LVL851
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS427:
+	.uleb128 .LVU4101
+	.uleb128 .LVU4105
+	.uleb128 .LVU4139
+	.uleb128 .LVU4142
+.LLST427:
+	.byte	0x6
+	.quad	.LVL853
+	.byte	0x4
+	.uleb128 .LVL853-.LVL853
+	.uleb128 .LVL854-.LVL853
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL863-.LVL853
+	.uleb128 .LVL865-.LVL853
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS428:
+	.uleb128 .LVU4113
+	.uleb128 .LVU4115
+.LLST428:
+	.byte	0x8
+	.quad	.LVL855
+	.uleb128 .LVL856-.LVL855
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS410:
+	.uleb128 0
+	.uleb128 .LVU4015
+	.uleb128 .LVU4015
+	.uleb128 0
+.LLST410:
+	.byte	0x6
+	.quad	.LVL832
+	.byte	0x4
+	.uleb128 .LVL832-.LVL832
+	.uleb128 .LVL833-.LVL832
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL833-.LVL832
+	.uleb128 .LFE92-.LVL832
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU424
+	.uleb128 .LVU430
+	.uleb128 .LVU438
+	.uleb128 .LVU442
+.LLST27:
+	.byte	0x6
+	.quad	.LVL50
+	.byte	0x4
+	.uleb128 .LVL50-.LVL50
+	.uleb128 .LVL51-1-.LVL50
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL53-.LVL50
+	.uleb128 .LVL54-.LVL50
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU2199
+	.uleb128 .LVU2275
+.LLST151:
+	.byte	0x8
+	.quad	.LVL229
+	.uleb128 .LVL260-.LVL229
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU2179
+	.uleb128 .LVU2199
+	.uleb128 .LVU2199
+	.uleb128 .LVU2236
+	.uleb128 .LVU2244
+	.uleb128 .LVU2247
+	.uleb128 .LVU2252
+	.uleb128 .LVU2273
+.LLST152:
+	.byte	0x6
+	.quad	.LVL222
+	.byte	0x4
+	.uleb128 .LVL222-.LVL222
+	.uleb128 .LVL229-.LVL222
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.LVL222
+	.uleb128 .LVL243-.LVL222
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL247-.LVL222
+	.uleb128 .LVL248-.LVL222
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL251-.LVL222
+	.uleb128 .LVL259-.LVL222
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU2236
+	.uleb128 .LVU2237
+	.uleb128 .LVU2237
+	.uleb128 .LVU2238
+	.uleb128 .LVU2239
+	.uleb128 .LVU2252
+.LLST153:
+	.byte	0x6
+	.quad	.LVL243
+	.byte	0x4
+	.uleb128 .LVL243-.LVL243
+	.uleb128 .LVL243-.LVL243
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL243-.LVL243
+	.uleb128 .LVL244-.LVL243
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL245-.LVL243
+	.uleb128 .LVL251-.LVL243
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU2245
+	.uleb128 .LVU2247
+	.uleb128 .LVU2247
+	.uleb128 .LVU2249
+.LLST154:
+	.byte	0x6
+	.quad	.LVL247
+	.byte	0x4
+	.uleb128 .LVL247-.LVL247
+	.uleb128 .LVL248-.LVL247
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL248-.LVL247
+	.uleb128 .LVL249-.LVL247
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x77
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x48
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU2185
+	.uleb128 .LVU2188
+	.uleb128 .LVU2188
+	.uleb128 .LVU2191
+	.uleb128 .LVU2191
+	.uleb128 .LVU2195
+	.uleb128 .LVU2195
+	.uleb128 .LVU2196
+.LLST155:
+	.byte	0x6
+	.quad	.LVL224
+	.byte	0x4
+	.uleb128 .LVL224-.LVL224
+	.uleb128 .LVL225-1-.LVL224
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL225-1-.LVL224
+	.uleb128 .LVL226-.LVL224
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL226-.LVL224
+	.uleb128 .LVL227-.LVL224
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -12
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL227-.LVL224
+	.uleb128 .LVL228-.LVL224
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU2196
+	.uleb128 .LVU2235
+	.uleb128 .LVU2252
+	.uleb128 .LVU2273
+.LLST156:
+	.byte	0x6
+	.quad	.LVL228
+	.byte	0x4
+	.uleb128 .LVL228-.LVL228
+	.uleb128 .LVL242-.LVL228
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL251-.LVL228
+	.uleb128 .LVL259-.LVL228
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU2174
+	.uleb128 .LVU2175
+.LLST158:
+	.byte	0x8
+	.quad	.LVL221
+	.uleb128 .LVL222-.LVL221
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 .LVU2218
+	.uleb128 .LVU2224
+	.uleb128 .LVU2256
+	.uleb128 .LVU2262
+.LLST161:
+	.byte	0x6
+	.quad	.LVL236
+	.byte	0x4
+	.uleb128 .LVL236-.LVL236
+	.uleb128 .LVL237-.LVL236
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.LVL236
+	.uleb128 .LVL254-.LVL236
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 3
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU2268
+	.uleb128 .LVU2271
+.LLST163:
+	.byte	0x8
+	.quad	.LVL257
+	.uleb128 .LVL259-.LVL257
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU3486
+	.uleb128 .LVU3496
+	.uleb128 .LVU3496
+	.uleb128 .LVU3540
+	.uleb128 .LVU3548
+	.uleb128 0
+.LLST343:
+	.byte	0x6
+	.quad	.LVL684
+	.byte	0x4
+	.uleb128 .LVL684-.LVL684
+	.uleb128 .LVL687-.LVL684
+	.uleb128 0x5
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL687-.LVL684
+	.uleb128 .LVL703-.LVL684
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL705-.LVL684
+	.uleb128 .LFE85-.LVL684
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU3501
+	.uleb128 .LVU3503
+	.uleb128 .LVU3503
+	.uleb128 .LVU3504
+	.uleb128 .LVU3504
+	.uleb128 .LVU3505
+	.uleb128 .LVU3505
+	.uleb128 .LVU3506
+	.uleb128 .LVU3507
+	.uleb128 .LVU3533
+	.uleb128 .LVU3548
+	.uleb128 .LVU3552
+	.uleb128 .LVU3566
+	.uleb128 0
+.LLST344:
+	.byte	0x6
+	.quad	.LVL689
+	.byte	0x4
+	.uleb128 .LVL689-.LVL689
+	.uleb128 .LVL690-.LVL689
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL690-.LVL689
+	.uleb128 .LVL690-.LVL689
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL690-.LVL689
+	.uleb128 .LVL691-.LVL689
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL691-.LVL689
+	.uleb128 .LVL692-.LVL689
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL693-.LVL689
+	.uleb128 .LVL699-.LVL689
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL705-.LVL689
+	.uleb128 .LVL706-.LVL689
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL711-.LVL689
+	.uleb128 .LFE85-.LVL689
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS345:
+	.uleb128 .LVU3489
+	.uleb128 .LVU3495
+	.uleb128 .LVU3497
+	.uleb128 .LVU3547
+	.uleb128 .LVU3548
+	.uleb128 0
+.LLST345:
+	.byte	0x6
+	.quad	.LVL685
+	.byte	0x4
+	.uleb128 .LVL685-.LVL685
+	.uleb128 .LVL686-.LVL685
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL688-.LVL685
+	.uleb128 .LVL704-.LVL685
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL705-.LVL685
+	.uleb128 .LFE85-.LVL685
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU3508
+	.uleb128 .LVU3509
+	.uleb128 .LVU3517
+	.uleb128 .LVU3522
+	.uleb128 .LVU3533
+	.uleb128 .LVU3534
+	.uleb128 .LVU3553
+	.uleb128 .LVU3555
+	.uleb128 .LVU3568
+	.uleb128 0
+.LLST346:
+	.byte	0x6
+	.quad	.LVL693
+	.byte	0x4
+	.uleb128 .LVL693-.LVL693
+	.uleb128 .LVL694-1-.LVL693
+	.uleb128 0xd
+	.byte	0x3
+	.quad	currentPort
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x154
+	.byte	0x4
+	.uleb128 .LVL695-.LVL693
+	.uleb128 .LVL696-.LVL693
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 340
+	.byte	0x4
+	.uleb128 .LVL699-.LVL693
+	.uleb128 .LVL700-.LVL693
+	.uleb128 0xd
+	.byte	0x3
+	.quad	currentPort
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x154
+	.byte	0x4
+	.uleb128 .LVL706-.LVL693
+	.uleb128 .LVL707-.LVL693
+	.uleb128 0xd
+	.byte	0x3
+	.quad	currentPort
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x154
+	.byte	0x4
+	.uleb128 .LVL711-.LVL693
+	.uleb128 .LFE85-.LVL693
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU3532
+	.uleb128 .LVU3534
+	.uleb128 .LVU3534
+	.uleb128 .LVU3536
+	.uleb128 .LVU3565
+	.uleb128 .LVU3566
+	.uleb128 .LVU3583
+	.uleb128 0
+.LLST350:
+	.byte	0x6
+	.quad	.LVL698
+	.byte	0x4
+	.uleb128 .LVL698-.LVL698
+	.uleb128 .LVL700-.LVL698
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL700-.LVL698
+	.uleb128 .LVL701-.LVL698
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL710-.LVL698
+	.uleb128 .LVL711-.LVL698
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL714-.LVL698
+	.uleb128 .LFE85-.LVL698
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS348:
+	.uleb128 .LVU3575
+	.uleb128 .LVU3577
+.LLST348:
+	.byte	0x8
+	.quad	.LVL712
+	.uleb128 .LVL713-.LVL712
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU33
+	.uleb128 .LVU36
+.LLST0:
+	.byte	0x8
+	.quad	.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU858
+	.uleb128 .LVU866
+.LLST63:
+	.byte	0x8
+	.quad	.LVL83
+	.uleb128 .LVL84-.LVL83
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU882
+	.uleb128 .LVU890
+.LLST66:
+	.byte	0x8
+	.quad	.LVL85
+	.uleb128 .LVL86-.LVL85
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU906
+	.uleb128 .LVU917
+.LLST69:
+	.byte	0x8
+	.quad	.LVL87
+	.uleb128 .LVL88-.LVL87
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU459
+	.uleb128 .LVU467
+.LLST29:
+	.byte	0x8
+	.quad	.LVL56
+	.uleb128 .LVL57-.LVL56
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU483
+	.uleb128 .LVU494
+.LLST32:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL59-.LVL58
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU659
+	.uleb128 .LVU667
+.LLST47:
+	.byte	0x8
+	.quad	.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU683
+	.uleb128 .LVU691
+.LLST50:
+	.byte	0x8
+	.quad	.LVL78
+	.uleb128 .LVL79-.LVL78
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU707
+	.uleb128 .LVU718
+	.uleb128 .LVU738
+	.uleb128 0
+.LLST53:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL82-.LVL80
+	.uleb128 .LFE77-.LVL80
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU608
+	.uleb128 .LVU633
+	.uleb128 .LVU641
+	.uleb128 .LVU644
+.LLST42:
+	.byte	0x6
+	.quad	.LVL68
+	.byte	0x4
+	.uleb128 .LVL68-.LVL68
+	.uleb128 .LVL70-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL74-.LVL68
+	.uleb128 .LVL75-.LVL68
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU593
+	.uleb128 .LVU602
+	.uleb128 .LVU639
+	.uleb128 .LVU640
+	.uleb128 .LVU640
+	.uleb128 .LVU641
+.LLST43:
+	.byte	0x6
+	.quad	.LVL66
+	.byte	0x4
+	.uleb128 .LVL66-.LVL66
+	.uleb128 .LVL67-.LVL66
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL72-.LVL66
+	.uleb128 .LVL73-.LVL66
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL73-.LVL66
+	.uleb128 .LVL74-.LVL66
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU619
+	.uleb128 .LVU633
+	.uleb128 .LVU641
+	.uleb128 0
+.LLST45:
+	.byte	0x6
+	.quad	.LVL69
+	.byte	0x4
+	.uleb128 .LVL69-.LVL69
+	.uleb128 .LVL70-.LVL69
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL74-.LVL69
+	.uleb128 .LFE76-.LVL69
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU55
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL9
+	.uleb128 .LVL11-.LVL9
+	.uleb128 0xa
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL9
+	.uleb128 .LVL12-.LVL9
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL9
+	.uleb128 .LFE71-.LVL9
+	.uleb128 0xc
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU153
+	.uleb128 .LVU157
+	.uleb128 .LVU157
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU243
+	.uleb128 .LVU244
+	.uleb128 .LVU275
+	.uleb128 .LVU275
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU277
+	.uleb128 .LVU278
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL26
+	.uleb128 .LVL35-.LVL26
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL26
+	.uleb128 .LVL36-.LVL26
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL26
+	.uleb128 .LVL38-.LVL26
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL26
+	.uleb128 .LVL39-.LVL26
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.LVL26
+	.uleb128 .LVL40-.LVL26
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x38
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL26
+	.uleb128 .LFE70-.LVL26
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x40
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU223
+	.uleb128 .LVU231
+	.uleb128 .LVU282
+	.uleb128 .LVU285
+.LLST14:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL42-.LVL33
+	.uleb128 .LVL43-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU162
+	.uleb128 .LVU170
+.LLST16:
+	.byte	0x8
+	.quad	.LVL28
+	.uleb128 .LVL29-.LVL28
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU186
+	.uleb128 .LVU194
+.LLST19:
+	.byte	0x8
+	.quad	.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU210
+	.uleb128 .LVU223
+	.uleb128 .LVU281
+	.uleb128 .LVU282
+.LLST22:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.quad	.LVL42
+	.uleb128 .LVL42-.LVL42
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU77
+	.uleb128 .LVU80
+.LLST4:
+	.byte	0x8
+	.quad	.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU93
+	.uleb128 .LVU104
+.LLST6:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU1076
+	.uleb128 .LVU1084
+	.uleb128 .LVU1288
+	.uleb128 .LVU1292
+	.uleb128 .LVU1553
+	.uleb128 .LVU1557
+.LLST84:
+	.byte	0x8
+	.quad	.LVL106
+	.uleb128 .LVL107-.LVL106
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x8
+	.quad	.LVL123
+	.uleb128 .LVL123-.LVL123
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL131
+	.uleb128 .LVL131-.LVL131
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU1100
+	.uleb128 .LVU1108
+	.uleb128 .LVU1542
+	.uleb128 .LVU1543
+.LLST88:
+	.byte	0x6
+	.quad	.LVL108
+	.byte	0x4
+	.uleb128 .LVL108-.LVL108
+	.uleb128 .LVL109-.LVL108
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL129-.LVL108
+	.uleb128 .LVL130-.LVL108
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU1124
+	.uleb128 .LVU1132
+.LLST92:
+	.byte	0x8
+	.quad	.LVL110
+	.uleb128 .LVL111-.LVL110
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU1149
+	.uleb128 .LVU1157
+.LLST95:
+	.byte	0x8
+	.quad	.LVL112
+	.uleb128 .LVL113-.LVL112
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU1231
+	.uleb128 .LVU1243
+	.uleb128 .LVU1360
+	.uleb128 .LVU1364
+	.uleb128 .LVU1436
+	.uleb128 .LVU1440
+	.uleb128 .LVU1473
+	.uleb128 .LVU1477
+	.uleb128 .LVU1526
+	.uleb128 .LVU1530
+	.uleb128 .LVU1609
+	.uleb128 .LVU1613
+	.uleb128 .LVU1671
+	.uleb128 .LVU1675
+.LLST108:
+	.byte	0x8
+	.quad	.LVL120
+	.uleb128 .LVL121-.LVL120
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x8
+	.quad	.LVL124
+	.uleb128 .LVL124-.LVL124
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL125
+	.uleb128 .LVL125-.LVL125
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL126
+	.uleb128 .LVL126-.LVL126
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL127
+	.uleb128 .LVL127-.LVL127
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL133
+	.uleb128 .LVL133-.LVL133
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x8
+	.quad	.LVL135
+	.uleb128 .LVL135-.LVL135
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU957
+	.uleb128 .LVU959
+	.uleb128 .LVU971
+	.uleb128 .LVU992
+.LLST71:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL90-.LVL89
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL93-.LVL89
+	.uleb128 .LVL98-.LVL89
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU962
+	.uleb128 .LVU971
+	.uleb128 .LVU1028
+	.uleb128 .LVU1033
+	.uleb128 .LVU1043
+	.uleb128 0
+.LLST72:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL93-.LVL92
+	.uleb128 0x12
+	.byte	0x78
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x24
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.LVL92
+	.uleb128 .LVL102-.LVL92
+	.uleb128 0x4
+	.byte	0x79
+	.sleb128 132
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL103-.LVL92
+	.uleb128 .LFE66-.LVL92
+	.uleb128 0x12
+	.byte	0x78
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x33
+	.byte	0x24
+	.byte	0x79
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU986
+	.uleb128 .LVU993
+.LLST73:
+	.byte	0x8
+	.quad	.LVL97
+	.uleb128 .LVL99-.LVL97
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU973
+	.uleb128 .LVU986
+.LLST76:
+	.byte	0x8
+	.quad	.LVL93
+	.uleb128 .LVL97-.LVL93
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU977
+	.uleb128 .LVU979
+	.uleb128 .LVU979
+	.uleb128 .LVU981
+	.uleb128 .LVU981
+	.uleb128 .LVU982
+	.uleb128 .LVU983
+	.uleb128 .LVU986
+.LLST77:
+	.byte	0x6
+	.quad	.LVL93
+	.byte	0x4
+	.uleb128 .LVL93-.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.LVL93
+	.uleb128 .LVL94-.LVL93
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL94-.LVL93
+	.uleb128 .LVL95-.LVL93
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.LVL93
+	.uleb128 .LVL97-.LVL93
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU979
+	.uleb128 .LVU982
+	.uleb128 .LVU982
+	.uleb128 .LVU983
+	.uleb128 .LVU984
+	.uleb128 .LVU986
+.LLST78:
+	.byte	0x6
+	.quad	.LVL94
+	.byte	0x4
+	.uleb128 .LVL94-.LVL94
+	.uleb128 .LVL95-.LVL94
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL95-.LVL94
+	.uleb128 .LVL96-.LVL94
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.LVL94
+	.uleb128 .LVL97-.LVL94
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU1691
+	.uleb128 .LVU1718
+	.uleb128 .LVU1718
+	.uleb128 .LVU1719
+	.uleb128 .LVU1721
+	.uleb128 .LVU1735
+	.uleb128 .LVU1742
+	.uleb128 .LVU1779
+	.uleb128 .LVU1779
+	.uleb128 .LVU1780
+	.uleb128 .LVU1780
+	.uleb128 .LVU1782
+	.uleb128 .LVU1811
+	.uleb128 .LVU1812
+	.uleb128 .LVU1812
+	.uleb128 .LVU1813
+	.uleb128 .LVU1863
+	.uleb128 .LVU1873
+	.uleb128 .LVU1883
+	.uleb128 .LVU1884
+	.uleb128 .LVU1884
+	.uleb128 0
+.LLST115:
+	.byte	0x6
+	.quad	.LVL136
+	.byte	0x4
+	.uleb128 .LVL136-.LVL136
+	.uleb128 .LVL137-.LVL136
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xa
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL137-.LVL136
+	.uleb128 .LVL138-.LVL136
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xb
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.LVL136
+	.uleb128 .LVL141-.LVL136
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xa
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.LVL136
+	.uleb128 .LVL144-.LVL136
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.LVL136
+	.uleb128 .LVL145-.LVL136
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL145-.LVL136
+	.uleb128 .LVL146-.LVL136
+	.uleb128 0xd
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x28
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL147-.LVL136
+	.uleb128 .LVL148-.LVL136
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.LVL136
+	.uleb128 .LVL149-.LVL136
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL152-.LVL136
+	.uleb128 .LVL153-.LVL136
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL154-.LVL136
+	.uleb128 .LVL155-.LVL136
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x79
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0xa
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.LVL136
+	.uleb128 .LFE65-.LVL136
+	.uleb128 0xb
+	.byte	0x71
+	.sleb128 0
+	.byte	0x75
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU520
+	.uleb128 .LVU529
+.LLST35:
+	.byte	0x8
+	.quad	.LVL60
+	.uleb128 .LVL61-.LVL60
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU545
+	.uleb128 .LVU556
+	.uleb128 .LVU573
+	.uleb128 0
+.LLST39:
+	.byte	0x6
+	.quad	.LVL62
+	.byte	0x4
+	.uleb128 .LVL62-.LVL62
+	.uleb128 .LVL63-.LVL62
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL64-.LVL62
+	.uleb128 .LFE64-.LVL62
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU114
+	.uleb128 .LVU118
+.LLST8:
+	.byte	0x8
+	.quad	.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU131
+	.uleb128 .LVU142
+.LLST10:
+	.byte	0x8
+	.quad	.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU389
+	.uleb128 .LVU400
+.LLST26:
+	.byte	0x8
+	.quad	.LVL48
+	.uleb128 .LVL49-.LVL48
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU3019
+	.uleb128 .LVU3020
+.LLST264:
+	.byte	0x8
+	.quad	.LVL524
+	.uleb128 .LVL524-.LVL524
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS266:
+	.uleb128 .LVU3011
+	.uleb128 .LVU3017
+.LLST266:
+	.byte	0x8
+	.quad	.LVL523
+	.uleb128 .LVL524-.LVL523
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU3154
+	.uleb128 .LVU3158
+.LLST293:
+	.byte	0x8
+	.quad	.LVL574
+	.uleb128 .LVL575-.LVL574
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU3164
+	.uleb128 .LVU3168
+.LLST295:
+	.byte	0x8
+	.quad	.LVL577
+	.uleb128 .LVL578-.LVL577
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS296:
+	.uleb128 .LVU3172
+	.uleb128 .LVU3175
+.LLST296:
+	.byte	0x8
+	.quad	.LVL580
+	.uleb128 .LVL581-.LVL580
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS297:
+	.uleb128 .LVU3180
+	.uleb128 .LVU3183
+.LLST297:
+	.byte	0x8
+	.quad	.LVL584
+	.uleb128 .LVL585-.LVL584
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU3188
+	.uleb128 .LVU3191
+.LLST298:
+	.byte	0x8
+	.quad	.LVL588
+	.uleb128 .LVL589-.LVL588
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS300:
+	.uleb128 .LVU3198
+	.uleb128 .LVU3202
+.LLST300:
+	.byte	0x8
+	.quad	.LVL592
+	.uleb128 .LVL593-.LVL592
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU3208
+	.uleb128 .LVU3212
+.LLST302:
+	.byte	0x8
+	.quad	.LVL595
+	.uleb128 .LVL596-.LVL595
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU3215
+	.uleb128 .LVU3218
+.LLST303:
+	.byte	0x8
+	.quad	.LVL597
+	.uleb128 .LVL598-.LVL597
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU3223
+	.uleb128 .LVU3226
+.LLST304:
+	.byte	0x8
+	.quad	.LVL601
+	.uleb128 .LVL602-.LVL601
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU3233
+	.uleb128 .LVU3237
+.LLST306:
+	.byte	0x8
+	.quad	.LVL605
+	.uleb128 .LVL606-.LVL605
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU3240
+	.uleb128 .LVU3243
+.LLST307:
+	.byte	0x8
+	.quad	.LVL607
+	.uleb128 .LVL608-.LVL607
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU3248
+	.uleb128 .LVU3251
+.LLST308:
+	.byte	0x8
+	.quad	.LVL611
+	.uleb128 .LVL612-.LVL611
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU3256
+	.uleb128 .LVU3259
+.LLST309:
+	.byte	0x8
+	.quad	.LVL615
+	.uleb128 .LVL616-.LVL615
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU3266
+	.uleb128 .LVU3270
+.LLST311:
+	.byte	0x8
+	.quad	.LVL619
+	.uleb128 .LVL620-.LVL619
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU3272
+	.uleb128 .LVU3276
+	.uleb128 .LVU3276
+	.uleb128 .LVU3278
+.LLST312:
+	.byte	0x6
+	.quad	.LVL622
+	.byte	0x4
+	.uleb128 .LVL622-.LVL622
+	.uleb128 .LVL623-1-.LVL622
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL623-1-.LVL622
+	.uleb128 .LVL624-.LVL622
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU3274
+	.uleb128 .LVU3276
+.LLST314:
+	.byte	0x8
+	.quad	.LVL622
+	.uleb128 .LVL623-1-.LVL622
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS315:
+	.uleb128 .LVU3281
+	.uleb128 .LVU3284
+.LLST315:
+	.byte	0x8
+	.quad	.LVL625
+	.uleb128 .LVL626-.LVL625
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU2379
+	.uleb128 .LVU2383
+.LLST181:
+	.byte	0x8
+	.quad	.LVL297
+	.uleb128 .LVL298-.LVL297
+	.uleb128 0x2
+	.byte	0x3c
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU2385
+	.uleb128 .LVU2395
+.LLST182:
+	.byte	0x8
+	.quad	.LVL298
+	.uleb128 .LVL302-.LVL298
+	.uleb128 0x6
+	.byte	0xc
+	.long	0x5349544c
+	.byte	0x9f
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU2387
+	.uleb128 .LVU2390
+.LLST183:
+	.byte	0x8
+	.quad	.LVL298
+	.uleb128 .LVL300-.LVL298
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x544c
+	.byte	0x9f
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU2392
+	.uleb128 .LVU2395
+.LLST184:
+	.byte	0x8
+	.quad	.LVL300
+	.uleb128 .LVL302-.LVL300
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x5349
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU2397
+	.uleb128 .LVU2407
+.LLST185:
+	.byte	0x8
+	.quad	.LVL302
+	.uleb128 .LVL306-.LVL302
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 .LVU2399
+	.uleb128 .LVU2402
+.LLST186:
+	.byte	0x8
+	.quad	.LVL302
+	.uleb128 .LVL304-.LVL302
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU2404
+	.uleb128 .LVU2407
+.LLST187:
+	.byte	0x8
+	.quad	.LVL304
+	.uleb128 .LVL306-.LVL304
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU2409
+	.uleb128 .LVU2419
+.LLST188:
+	.byte	0x8
+	.quad	.LVL306
+	.uleb128 .LVL310-.LVL306
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 .LVU2411
+	.uleb128 .LVU2414
+.LLST189:
+	.byte	0x8
+	.quad	.LVL306
+	.uleb128 .LVL308-.LVL306
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 .LVU2416
+	.uleb128 .LVU2419
+.LLST190:
+	.byte	0x8
+	.quad	.LVL308
+	.uleb128 .LVL310-.LVL308
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU2354
+	.uleb128 .LVU2358
+.LLST177:
+	.byte	0x8
+	.quad	.LVL287
+	.uleb128 .LVL288-.LVL287
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU2361
+	.uleb128 .LVU2364
+	.uleb128 .LVU2364
+	.uleb128 .LVU2365
+.LLST178:
+	.byte	0x6
+	.quad	.LVL289
+	.byte	0x4
+	.uleb128 .LVL289-.LVL289
+	.uleb128 .LVL290-.LVL289
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL290-.LVL289
+	.uleb128 .LVL291-1-.LVL289
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 98
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU2369
+	.uleb128 .LVU2372
+	.uleb128 .LVU2372
+	.uleb128 .LVU2373
+.LLST179:
+	.byte	0x6
+	.quad	.LVL293
+	.byte	0x4
+	.uleb128 .LVL293-.LVL293
+	.uleb128 .LVL294-.LVL293
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL294-.LVL293
+	.uleb128 .LVL295-1-.LVL293
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 96
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU3041
+	.uleb128 .LVU3046
+	.uleb128 .LVU3046
+	.uleb128 .LVU3047
+.LLST267:
+	.byte	0x6
+	.quad	.LVL527
+	.byte	0x4
+	.uleb128 .LVL527-.LVL527
+	.uleb128 .LVL528-.LVL527
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL528-.LVL527
+	.uleb128 .LVL529-.LVL527
+	.uleb128 0x15
+	.byte	0x3
+	.quad	currentPort
+	.byte	0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS270:
+	.uleb128 .LVU3053
+	.uleb128 .LVU3056
+	.uleb128 .LVU3056
+	.uleb128 .LVU3095
+	.uleb128 .LVU3095
+	.uleb128 .LVU3144
+	.uleb128 .LVU3145
+	.uleb128 0
+.LLST270:
+	.byte	0x6
+	.quad	.LVL531
+	.byte	0x4
+	.uleb128 .LVL531-.LVL531
+	.uleb128 .LVL532-1-.LVL531
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL532-1-.LVL531
+	.uleb128 .LVL551-.LVL531
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL551-.LVL531
+	.uleb128 .LVL572-.LVL531
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL573-.LVL531
+	.uleb128 .LFE51-.LVL531
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU3127
+	.uleb128 .LVU3129
+	.uleb128 .LVU3129
+	.uleb128 .LVU3134
+	.uleb128 .LVU3134
+	.uleb128 .LVU3140
+.LLST289:
+	.byte	0x6
+	.quad	.LVL566
+	.byte	0x4
+	.uleb128 .LVL566-.LVL566
+	.uleb128 .LVL566-.LVL566
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL566-.LVL566
+	.uleb128 .LVL568-.LVL566
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x14
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL568-.LVL566
+	.uleb128 .LVL571-.LVL566
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x12
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU3131
+	.uleb128 .LVU3136
+	.uleb128 .LVU3136
+	.uleb128 .LVU3137
+.LLST291:
+	.byte	0x6
+	.quad	.LVL567
+	.byte	0x4
+	.uleb128 .LVL567-.LVL567
+	.uleb128 .LVL569-.LVL567
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL569-.LVL567
+	.uleb128 .LVL570-1-.LVL567
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -2
+	.byte	0
+.LVUS272:
+	.uleb128 .LVU3054
+	.uleb128 .LVU3056
+.LLST272:
+	.byte	0x8
+	.quad	.LVL531
+	.uleb128 .LVL532-.LVL531
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x29
+	.byte	0x9f
+	.byte	0
+.LVUS273:
+	.uleb128 .LVU3062
+	.uleb128 .LVU3064
+.LLST273:
+	.byte	0x8
+	.quad	.LVL537
+	.uleb128 .LVL538-1-.LVL537
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS274:
+	.uleb128 .LVU3068
+	.uleb128 .LVU3074
+.LLST274:
+	.byte	0x8
+	.quad	.LVL540
+	.uleb128 .LVL542-.LVL540
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU3070
+	.uleb128 .LVU3074
+.LLST276:
+	.byte	0x8
+	.quad	.LVL540
+	.uleb128 .LVL542-.LVL540
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU3077
+	.uleb128 .LVU3080
+.LLST277:
+	.byte	0x8
+	.quad	.LVL543
+	.uleb128 .LVL544-.LVL543
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU3096
+	.uleb128 .LVU3100
+	.uleb128 .LVU3100
+	.uleb128 .LVU3102
+.LLST281:
+	.byte	0x6
+	.quad	.LVL553
+	.byte	0x4
+	.uleb128 .LVL553-.LVL553
+	.uleb128 .LVL554-1-.LVL553
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL554-1-.LVL553
+	.uleb128 .LVL555-.LVL553
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU3098
+	.uleb128 .LVU3100
+.LLST283:
+	.byte	0x8
+	.quad	.LVL553
+	.uleb128 .LVL554-1-.LVL553
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU3105
+	.uleb128 .LVU3108
+.LLST284:
+	.byte	0x8
+	.quad	.LVL556
+	.uleb128 .LVL557-.LVL556
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU3113
+	.uleb128 .LVU3119
+.LLST285:
+	.byte	0x8
+	.quad	.LVL560
+	.uleb128 .LVL562-.LVL560
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS287:
+	.uleb128 .LVU3115
+	.uleb128 .LVU3119
+.LLST287:
+	.byte	0x8
+	.quad	.LVL560
+	.uleb128 .LVL562-.LVL560
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU3122
+	.uleb128 .LVU3125
+.LLST288:
+	.byte	0x8
+	.quad	.LVL563
+	.uleb128 .LVL564-.LVL563
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU2337
+	.uleb128 .LVU2338
+.LLST171:
+	.byte	0x8
+	.quad	.LVL281
+	.uleb128 .LVL281-.LVL281
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU2329
+	.uleb128 .LVU2335
+.LLST173:
+	.byte	0x8
+	.quad	.LVL280
+	.uleb128 .LVL281-.LVL280
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU2340
+	.uleb128 .LVU2345
+	.uleb128 .LVU2345
+	.uleb128 .LVU2346
+.LLST175:
+	.byte	0x6
+	.quad	.LVL282
+	.byte	0x4
+	.uleb128 .LVL282-.LVL282
+	.uleb128 .LVL284-.LVL282
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL284-.LVL282
+	.uleb128 .LVL285-1-.LVL282
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -2
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU2478
+	.uleb128 .LVU2479
+	.uleb128 .LVU2479
+	.uleb128 .LVU2481
+	.uleb128 .LVU2481
+	.uleb128 .LVU2482
+	.uleb128 .LVU2482
+	.uleb128 .LVU2483
+.LLST197:
+	.byte	0x6
+	.quad	.LVL329
+	.byte	0x4
+	.uleb128 .LVL329-.LVL329
+	.uleb128 .LVL329-.LVL329
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL329-.LVL329
+	.uleb128 .LVL330-.LVL329
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL330-.LVL329
+	.uleb128 .LVL331-1-.LVL329
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL331-1-.LVL329
+	.uleb128 .LVL331-.LVL329
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU2472
+	.uleb128 .LVU2476
+.LLST199:
+	.byte	0x8
+	.quad	.LVL328
+	.uleb128 .LVL329-.LVL328
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU2488
+	.uleb128 .LVU2492
+.LLST201:
+	.byte	0x8
+	.quad	.LVL332
+	.uleb128 .LVL333-.LVL332
+	.uleb128 0x2
+	.byte	0x46
+	.byte	0x9f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU2494
+	.uleb128 .LVU2497
+.LLST202:
+	.byte	0x8
+	.quad	.LVL333
+	.uleb128 .LVL335-.LVL333
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU2500
+	.uleb128 .LVU2503
+.LLST203:
+	.byte	0x8
+	.quad	.LVL336
+	.uleb128 .LVL337-.LVL336
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU2508
+	.uleb128 .LVU2511
+.LLST204:
+	.byte	0x8
+	.quad	.LVL340
+	.uleb128 .LVL341-.LVL340
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS205:
+	.uleb128 .LVU2516
+	.uleb128 .LVU2519
+.LLST205:
+	.byte	0x8
+	.quad	.LVL344
+	.uleb128 .LVL345-.LVL344
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU2524
+	.uleb128 .LVU2527
+	.uleb128 .LVU2527
+	.uleb128 .LVU2528
+.LLST206:
+	.byte	0x6
+	.quad	.LVL348
+	.byte	0x4
+	.uleb128 .LVL348-.LVL348
+	.uleb128 .LVL349-.LVL348
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL349-.LVL348
+	.uleb128 .LVL350-1-.LVL348
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 526
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU2531
+	.uleb128 .LVU2534
+.LLST207:
+	.byte	0x8
+	.quad	.LVL351
+	.uleb128 .LVL353-.LVL351
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS208:
+	.uleb128 .LVU2536
+	.uleb128 .LVU2546
+.LLST208:
+	.byte	0x8
+	.quad	.LVL353
+	.uleb128 .LVL357-.LVL353
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU2538
+	.uleb128 .LVU2541
+.LLST209:
+	.byte	0x8
+	.quad	.LVL353
+	.uleb128 .LVL355-.LVL353
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU2543
+	.uleb128 .LVU2546
+.LLST210:
+	.byte	0x8
+	.quad	.LVL355
+	.uleb128 .LVL357-.LVL355
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS211:
+	.uleb128 .LVU2550
+	.uleb128 .LVU2553
+.LLST211:
+	.byte	0x8
+	.quad	.LVL358
+	.uleb128 .LVL359-.LVL358
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU3618
+	.uleb128 .LVU3619
+	.uleb128 .LVU3619
+	.uleb128 .LVU3642
+	.uleb128 .LVU3642
+	.uleb128 .LVU3643
+.LLST356:
+	.byte	0x6
+	.quad	.LVL722
+	.byte	0x4
+	.uleb128 .LVL722-.LVL722
+	.uleb128 .LVL723-.LVL722
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL723-.LVL722
+	.uleb128 .LVL730-.LVL722
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL730-.LVL722
+	.uleb128 .LVL731-.LVL722
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU3633
+	.uleb128 .LVU3639
+.LLST359:
+	.byte	0x8
+	.quad	.LVL728
+	.uleb128 .LVL729-.LVL728
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU3621
+	.uleb128 .LVU3633
+.LLST361:
+	.byte	0x8
+	.quad	.LVL724
+	.uleb128 .LVL728-.LVL724
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU3625
+	.uleb128 .LVU3627
+	.uleb128 .LVU3627
+	.uleb128 .LVU3628
+	.uleb128 .LVU3628
+	.uleb128 .LVU3629
+	.uleb128 .LVU3630
+	.uleb128 .LVU3633
+.LLST362:
+	.byte	0x6
+	.quad	.LVL724
+	.byte	0x4
+	.uleb128 .LVL724-.LVL724
+	.uleb128 .LVL725-.LVL724
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL725-.LVL724
+	.uleb128 .LVL725-.LVL724
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL725-.LVL724
+	.uleb128 .LVL726-.LVL724
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL727-.LVL724
+	.uleb128 .LVL728-.LVL724
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU3627
+	.uleb128 .LVU3629
+	.uleb128 .LVU3629
+	.uleb128 .LVU3630
+	.uleb128 .LVU3631
+	.uleb128 .LVU3633
+.LLST363:
+	.byte	0x6
+	.quad	.LVL725
+	.byte	0x4
+	.uleb128 .LVL725-.LVL725
+	.uleb128 .LVL726-.LVL725
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL726-.LVL725
+	.uleb128 .LVL727-.LVL725
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL727-.LVL725
+	.uleb128 .LVL728-.LVL725
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU3609
+	.uleb128 .LVU3616
+.LLST358:
+	.byte	0x8
+	.quad	.LVL721
+	.uleb128 .LVL722-1-.LVL721
+	.uleb128 0xf
+	.byte	0x3
+	.quad	activeBoxIdCount
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU3302
+	.uleb128 .LVU3303
+	.uleb128 .LVU3303
+	.uleb128 .LVU3307
+	.uleb128 .LVU3307
+	.uleb128 .LVU3315
+	.uleb128 .LVU3315
+	.uleb128 .LVU3318
+.LLST316:
+	.byte	0x6
+	.quad	.LVL630
+	.byte	0x4
+	.uleb128 .LVL630-.LVL630
+	.uleb128 .LVL630-.LVL630
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL630-.LVL630
+	.uleb128 .LVL632-.LVL630
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL632-.LVL630
+	.uleb128 .LVL637-.LVL630
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL637-.LVL630
+	.uleb128 .LVL638-.LVL630
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU3308
+	.uleb128 .LVU3311
+.LLST320:
+	.byte	0x8
+	.quad	.LVL633
+	.uleb128 .LVL634-1-.LVL633
+	.uleb128 0x18
+	.byte	0x73
+	.sleb128 132
+	.byte	0x94
+	.byte	0x4
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS318:
+	.uleb128 .LVU3292
+	.uleb128 .LVU3300
+.LLST318:
+	.byte	0x8
+	.quad	.LVL629
+	.uleb128 .LVL630-.LVL629
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU3586
+	.uleb128 .LVU3592
+.LLST352:
+	.byte	0x8
+	.quad	.LVL715
+	.uleb128 .LVL716-.LVL715
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x9f
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU3594
+	.uleb128 .LVU3603
+.LLST354:
+	.byte	0x8
+	.quad	.LVL716
+	.uleb128 .LVL720-.LVL716
+	.uleb128 0xa
+	.byte	0x3
+	.quad	pidnames
+	.byte	0x9f
+	.byte	0
+.LVUS355:
+	.uleb128 .LVU3597
+	.uleb128 .LVU3598
+	.uleb128 .LVU3598
+	.uleb128 .LVU3603
+.LLST355:
+	.byte	0x6
+	.quad	.LVL716
+	.byte	0x4
+	.uleb128 .LVL716-.LVL716
+	.uleb128 .LVL717-.LVL716
+	.uleb128 0xa
+	.byte	0x3
+	.quad	pidnames
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL717-.LVL716
+	.uleb128 .LVL720-.LVL716
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU2576
+	.uleb128 .LVU2580
+	.uleb128 .LVU2580
+	.uleb128 .LVU2588
+	.uleb128 .LVU2588
+	.uleb128 .LVU2591
+	.uleb128 .LVU2591
+	.uleb128 .LVU2592
+	.uleb128 .LVU2593
+	.uleb128 .LVU2597
+	.uleb128 .LVU2597
+	.uleb128 .LVU2611
+	.uleb128 .LVU2611
+	.uleb128 .LVU2616
+	.uleb128 .LVU2625
+	.uleb128 .LVU2626
+	.uleb128 .LVU2626
+	.uleb128 .LVU2632
+	.uleb128 .LVU2632
+	.uleb128 .LVU2640
+	.uleb128 .LVU2640
+	.uleb128 .LVU2643
+	.uleb128 .LVU2643
+	.uleb128 .LVU2644
+.LLST212:
+	.byte	0x6
+	.quad	.LVL368
+	.byte	0x4
+	.uleb128 .LVL368-.LVL368
+	.uleb128 .LVL370-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL370-.LVL368
+	.uleb128 .LVL373-.LVL368
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL373-.LVL368
+	.uleb128 .LVL374-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL374-.LVL368
+	.uleb128 .LVL375-.LVL368
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL376-.LVL368
+	.uleb128 .LVL377-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL377-.LVL368
+	.uleb128 .LVL386-.LVL368
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL386-.LVL368
+	.uleb128 .LVL387-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL394-.LVL368
+	.uleb128 .LVL394-.LVL368
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL394-.LVL368
+	.uleb128 .LVL395-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL395-.LVL368
+	.uleb128 .LVL398-.LVL368
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL398-.LVL368
+	.uleb128 .LVL399-.LVL368
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL399-.LVL368
+	.uleb128 .LVL400-.LVL368
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU2565
+	.uleb128 .LVU2572
+.LLST214:
+	.byte	0x8
+	.quad	.LVL366
+	.uleb128 .LVL367-.LVL366
+	.uleb128 0x2
+	.byte	0x4e
+	.byte	0x9f
+	.byte	0
+.LVUS216:
+	.uleb128 .LVU2647
+	.uleb128 .LVU2651
+.LLST216:
+	.byte	0x8
+	.quad	.LVL401
+	.uleb128 .LVL402-.LVL401
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU2677
+	.uleb128 .LVU2681
+.LLST218:
+	.byte	0x8
+	.quad	.LVL410
+	.uleb128 .LVL411-.LVL410
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU2687
+	.uleb128 .LVU2689
+.LLST219:
+	.byte	0x8
+	.quad	.LVL415
+	.uleb128 .LVL416-1-.LVL415
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU2692
+	.uleb128 .LVU2695
+.LLST220:
+	.byte	0x8
+	.quad	.LVL418
+	.uleb128 .LVL419-.LVL418
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU2704
+	.uleb128 .LVU2706
+.LLST221:
+	.byte	0x8
+	.quad	.LVL423
+	.uleb128 .LVL424-1-.LVL423
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS223:
+	.uleb128 .LVU2714
+	.uleb128 .LVU2718
+.LLST223:
+	.byte	0x8
+	.quad	.LVL426
+	.uleb128 .LVL427-.LVL426
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU2720
+	.uleb128 .LVU2726
+.LLST224:
+	.byte	0x8
+	.quad	.LVL428
+	.uleb128 .LVL430-.LVL428
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS226:
+	.uleb128 .LVU2722
+	.uleb128 .LVU2726
+.LLST226:
+	.byte	0x8
+	.quad	.LVL428
+	.uleb128 .LVL430-.LVL428
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU2729
+	.uleb128 .LVU2732
+.LLST227:
+	.byte	0x8
+	.quad	.LVL431
+	.uleb128 .LVL432-.LVL431
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS228:
+	.uleb128 .LVU2736
+	.uleb128 .LVU2739
+.LLST228:
+	.byte	0x8
+	.quad	.LVL435
+	.uleb128 .LVL437-.LVL435
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU2751
+	.uleb128 .LVU2761
+	.uleb128 .LVU2761
+	.uleb128 .LVU2771
+	.uleb128 .LVU2771
+	.uleb128 0
+.LLST229:
+	.byte	0x6
+	.quad	.LVL439
+	.byte	0x4
+	.uleb128 .LVL439-.LVL439
+	.uleb128 .LVL443-.LVL439
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL443-.LVL439
+	.uleb128 .LVL447-.LVL439
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL447-.LVL439
+	.uleb128 .LFE39-.LVL439
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU2745
+	.uleb128 .LVU2749
+.LLST231:
+	.byte	0x8
+	.quad	.LVL438
+	.uleb128 .LVL439-.LVL438
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU2754
+	.uleb128 .LVU2757
+	.uleb128 .LVU2764
+	.uleb128 .LVU2767
+.LLST233:
+	.byte	0x6
+	.quad	.LVL440
+	.byte	0x4
+	.uleb128 .LVL440-.LVL440
+	.uleb128 .LVL441-.LVL440
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL444-.LVL440
+	.uleb128 .LVL445-.LVL440
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU2773
+	.uleb128 .LVU2776
+.LLST234:
+	.byte	0x8
+	.quad	.LVL448
+	.uleb128 .LVL449-.LVL448
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS235:
+	.uleb128 .LVU2793
+	.uleb128 .LVU2794
+	.uleb128 .LVU2794
+	.uleb128 .LVU2799
+.LLST235:
+	.byte	0x6
+	.quad	.LVL453
+	.byte	0x4
+	.uleb128 .LVL453-.LVL453
+	.uleb128 .LVL454-.LVL453
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.LVL453
+	.uleb128 .LVL456-.LVL453
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU2796
+	.uleb128 .LVU2801
+	.uleb128 .LVU2801
+	.uleb128 .LVU2802
+.LLST238:
+	.byte	0x6
+	.quad	.LVL455
+	.byte	0x4
+	.uleb128 .LVL455-.LVL455
+	.uleb128 .LVL457-.LVL455
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL457-.LVL455
+	.uleb128 .LVL458-1-.LVL455
+	.uleb128 0x7
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS370:
+	.uleb128 .LVU3669
+	.uleb128 .LVU3681
+.LLST370:
+	.byte	0x8
+	.quad	.LVL738
+	.uleb128 .LVL739-.LVL738
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU3681
+	.uleb128 .LVU3685
+.LLST371:
+	.byte	0x8
+	.quad	.LVL739
+	.uleb128 .LVL742-.LVL739
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS373:
+	.uleb128 .LVU3671
+	.uleb128 .LVU3679
+.LLST373:
+	.byte	0x8
+	.quad	.LVL738
+	.uleb128 .LVL739-.LVL738
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU3330
+	.uleb128 .LVU3331
+	.uleb128 .LVU3331
+	.uleb128 .LVU3334
+	.uleb128 .LVU3334
+	.uleb128 .LVU3336
+	.uleb128 .LVU3336
+	.uleb128 .LVU3339
+.LLST321:
+	.byte	0x6
+	.quad	.LVL640
+	.byte	0x4
+	.uleb128 .LVL640-.LVL640
+	.uleb128 .LVL640-.LVL640
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL640-.LVL640
+	.uleb128 .LVL641-.LVL640
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL641-.LVL640
+	.uleb128 .LVL642-.LVL640
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL642-.LVL640
+	.uleb128 .LVL643-.LVL640
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU3322
+	.uleb128 .LVU3328
+.LLST323:
+	.byte	0x8
+	.quad	.LVL639
+	.uleb128 .LVL640-.LVL639
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU2434
+	.uleb128 .LVU2435
+	.uleb128 .LVU2435
+	.uleb128 .LVU2438
+	.uleb128 .LVU2438
+	.uleb128 .LVU2465
+	.uleb128 .LVU2465
+	.uleb128 .LVU2468
+.LLST191:
+	.byte	0x6
+	.quad	.LVL312
+	.byte	0x4
+	.uleb128 .LVL312-.LVL312
+	.uleb128 .LVL312-.LVL312
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL312-.LVL312
+	.uleb128 .LVL313-.LVL312
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL313-.LVL312
+	.uleb128 .LVL326-.LVL312
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL326-.LVL312
+	.uleb128 .LVL327-.LVL312
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS193:
+	.uleb128 .LVU2425
+	.uleb128 .LVU2432
+.LLST193:
+	.byte	0x8
+	.quad	.LVL311
+	.uleb128 .LVL312-.LVL311
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 .LVU2439
+	.uleb128 .LVU2442
+	.uleb128 .LVU2442
+	.uleb128 .LVU2443
+.LLST194:
+	.byte	0x6
+	.quad	.LVL314
+	.byte	0x4
+	.uleb128 .LVL314-.LVL314
+	.uleb128 .LVL315-.LVL314
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL315-.LVL314
+	.uleb128 .LVL316-1-.LVL314
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xc
+	.byte	0
+.LVUS195:
+	.uleb128 .LVU2447
+	.uleb128 .LVU2450
+	.uleb128 .LVU2450
+	.uleb128 .LVU2451
+.LLST195:
+	.byte	0x6
+	.quad	.LVL318
+	.byte	0x4
+	.uleb128 .LVL318-.LVL318
+	.uleb128 .LVL319-.LVL318
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL319-.LVL318
+	.uleb128 .LVL320-1-.LVL318
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xe
+	.byte	0
+.LVUS196:
+	.uleb128 .LVU2455
+	.uleb128 .LVU2458
+	.uleb128 .LVU2458
+	.uleb128 .LVU2459
+.LLST196:
+	.byte	0x6
+	.quad	.LVL322
+	.byte	0x4
+	.uleb128 .LVL322-.LVL322
+	.uleb128 .LVL323-.LVL322
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL323-.LVL322
+	.uleb128 .LVL324-1-.LVL322
+	.uleb128 0x9
+	.byte	0x73
+	.sleb128 0
+	.byte	0x33
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU3648
+	.uleb128 .LVU3660
+.LLST365:
+	.byte	0x8
+	.quad	.LVL733
+	.uleb128 .LVL734-.LVL733
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS366:
+	.uleb128 .LVU3660
+	.uleb128 .LVU3664
+.LLST366:
+	.byte	0x8
+	.quad	.LVL734
+	.uleb128 .LVL737-.LVL734
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS368:
+	.uleb128 .LVU3650
+	.uleb128 .LVU3658
+.LLST368:
+	.byte	0x8
+	.quad	.LVL733
+	.uleb128 .LVL734-.LVL733
+	.uleb128 0x2
+	.byte	0x40
+	.byte	0x9f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU2813
+	.uleb128 .LVU2819
+.LLST240:
+	.byte	0x8
+	.quad	.LVL460
+	.uleb128 .LVL461-.LVL460
+	.uleb128 0x2
+	.byte	0x42
+	.byte	0x9f
+	.byte	0
+.LVUS242:
+	.uleb128 .LVU2827
+	.uleb128 .LVU2829
+	.uleb128 .LVU2829
+	.uleb128 .LVU2830
+.LLST242:
+	.byte	0x6
+	.quad	.LVL464
+	.byte	0x4
+	.uleb128 .LVL464-.LVL464
+	.uleb128 .LVL465-.LVL464
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL465-.LVL464
+	.uleb128 .LVL466-1-.LVL464
+	.uleb128 0x13
+	.byte	0x70
+	.sleb128 7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2d
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x33
+	.byte	0x26
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU2836
+	.uleb128 .LVU2841
+	.uleb128 .LVU2841
+	.uleb128 .LVU2842
+.LLST244:
+	.byte	0x6
+	.quad	.LVL469
+	.byte	0x4
+	.uleb128 .LVL469-.LVL469
+	.uleb128 .LVL471-.LVL469
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL471-.LVL469
+	.uleb128 .LVL472-1-.LVL469
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -2
+	.byte	0
+.LVUS246:
+	.uleb128 .LVU2848
+	.uleb128 .LVU2853
+	.uleb128 .LVU2853
+	.uleb128 .LVU2854
+.LLST246:
+	.byte	0x6
+	.quad	.LVL475
+	.byte	0x4
+	.uleb128 .LVL475-.LVL475
+	.uleb128 .LVL477-.LVL475
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL477-.LVL475
+	.uleb128 .LVL478-1-.LVL475
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -2
+	.byte	0
+.LVUS248:
+	.uleb128 .LVU2862
+	.uleb128 .LVU2867
+	.uleb128 .LVU2867
+	.uleb128 .LVU2868
+.LLST248:
+	.byte	0x6
+	.quad	.LVL481
+	.byte	0x4
+	.uleb128 .LVL481-.LVL481
+	.uleb128 .LVL483-.LVL481
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL483-.LVL481
+	.uleb128 .LVL484-1-.LVL481
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -2
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU2952
+	.uleb128 .LVU2955
+	.uleb128 .LVU2955
+	.uleb128 .LVU2962
+	.uleb128 .LVU2962
+	.uleb128 .LVU2963
+	.uleb128 .LVU2984
+	.uleb128 0
+.LLST249:
+	.byte	0x6
+	.quad	.LVL502
+	.byte	0x4
+	.uleb128 .LVL502-.LVL502
+	.uleb128 .LVL503-.LVL502
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL503-.LVL502
+	.uleb128 .LVL504-.LVL502
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL504-.LVL502
+	.uleb128 .LVL505-.LVL502
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL513-.LVL502
+	.uleb128 .LFE32-.LVL502
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU2951
+	.uleb128 .LVU2975
+	.uleb128 .LVU2984
+	.uleb128 0
+.LLST250:
+	.byte	0x6
+	.quad	.LVL502
+	.byte	0x4
+	.uleb128 .LVL502-.LVL502
+	.uleb128 .LVL508-1-.LVL502
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL513-.LVL502
+	.uleb128 .LFE32-.LVL502
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU2924
+	.uleb128 .LVU2955
+	.uleb128 .LVU2955
+	.uleb128 .LVU2967
+	.uleb128 .LVU2967
+	.uleb128 .LVU2969
+	.uleb128 .LVU2984
+	.uleb128 0
+.LLST251:
+	.byte	0x6
+	.quad	.LVL501
+	.byte	0x4
+	.uleb128 .LVL501-.LVL501
+	.uleb128 .LVL503-.LVL501
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL503-.LVL501
+	.uleb128 .LVL506-.LVL501
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL506-.LVL501
+	.uleb128 .LVL507-.LVL501
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL513-.LVL501
+	.uleb128 .LFE32-.LVL501
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS258:
+	.uleb128 .LVU2956
+	.uleb128 .LVU2963
+	.uleb128 .LVU2963
+	.uleb128 .LVU2969
+.LLST258:
+	.byte	0x6
+	.quad	.LVL503
+	.byte	0x4
+	.uleb128 .LVL503-.LVL503
+	.uleb128 .LVL505-.LVL503
+	.uleb128 0x17
+	.byte	0x31
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	activeBoxIds
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL505-.LVL503
+	.uleb128 .LVL507-.LVL503
+	.uleb128 0x17
+	.byte	0x31
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	activeBoxIds-1
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU2876
+	.uleb128 .LVU2882
+.LLST253:
+	.byte	0x8
+	.quad	.LVL486
+	.uleb128 .LVL487-.LVL486
+	.uleb128 0x2
+	.byte	0x3b
+	.byte	0x9f
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU2884
+	.uleb128 .LVU2887
+.LLST254:
+	.byte	0x8
+	.quad	.LVL488
+	.uleb128 .LVL489-.LVL488
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU2891
+	.uleb128 .LVU2894
+.LLST255:
+	.byte	0x8
+	.quad	.LVL491
+	.uleb128 .LVL493-.LVL491
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU2915
+	.uleb128 .LVU2919
+.LLST257:
+	.byte	0x8
+	.quad	.LVL498
+	.uleb128 .LVL499-.LVL498
+	.uleb128 0xb
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x24
+	.byte	0x73
+	.sleb128 0
+	.byte	0x21
+	.byte	0x9f
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU2987
+	.uleb128 .LVU2991
+.LLST262:
+	.byte	0x8
+	.quad	.LVL514
+	.uleb128 .LVL515-.LVL514
+	.uleb128 0x2
+	.byte	0x37
+	.byte	0x9f
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU3002
+	.uleb128 .LVU3005
+.LLST263:
+	.byte	0x8
+	.quad	.LVL520
+	.uleb128 .LVL522-.LVL520
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS324:
+	.uleb128 .LVU3354
+	.uleb128 .LVU3357
+	.uleb128 .LVU3357
+	.uleb128 .LVU3360
+	.uleb128 .LVU3360
+	.uleb128 .LVU3363
+	.uleb128 .LVU3363
+	.uleb128 .LVU3366
+	.uleb128 .LVU3366
+	.uleb128 .LVU3371
+	.uleb128 .LVU3371
+	.uleb128 .LVU3372
+	.uleb128 .LVU3372
+	.uleb128 .LVU3376
+	.uleb128 .LVU3387
+	.uleb128 .LVU3388
+	.uleb128 .LVU3388
+	.uleb128 .LVU3392
+	.uleb128 .LVU3395
+	.uleb128 .LVU3399
+	.uleb128 .LVU3404
+	.uleb128 .LVU3405
+	.uleb128 .LVU3405
+	.uleb128 .LVU3409
+.LLST324:
+	.byte	0x6
+	.quad	.LVL648
+	.byte	0x4
+	.uleb128 .LVL648-.LVL648
+	.uleb128 .LVL649-.LVL648
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL649-.LVL648
+	.uleb128 .LVL650-.LVL648
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL650-.LVL648
+	.uleb128 .LVL651-.LVL648
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL651-.LVL648
+	.uleb128 .LVL652-.LVL648
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL652-.LVL648
+	.uleb128 .LVL655-.LVL648
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL655-.LVL648
+	.uleb128 .LVL655-.LVL648
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL655-.LVL648
+	.uleb128 .LVL656-.LVL648
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL660-.LVL648
+	.uleb128 .LVL660-.LVL648
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL660-.LVL648
+	.uleb128 .LVL661-.LVL648
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL663-.LVL648
+	.uleb128 .LVL664-.LVL648
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL666-.LVL648
+	.uleb128 .LVL666-.LVL648
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL666-.LVL648
+	.uleb128 .LVL667-.LVL648
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU3343
+	.uleb128 .LVU3349
+.LLST326:
+	.byte	0x8
+	.quad	.LVL644
+	.uleb128 .LVL645-.LVL644
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x9f
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU3380
+	.uleb128 .LVU3385
+.LLST327:
+	.byte	0x8
+	.quad	.LVL658
+	.uleb128 .LVL660-.LVL658
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS398:
+	.uleb128 0
+	.uleb128 .LVU3859
+	.uleb128 .LVU3859
+	.uleb128 .LVU3995
+	.uleb128 .LVU3995
+	.uleb128 .LVU3997
+	.uleb128 .LVU3997
+	.uleb128 0
+.LLST398:
+	.byte	0x6
+	.quad	.LVL805
+	.byte	0x4
+	.uleb128 .LVL805-.LVL805
+	.uleb128 .LVL806-.LVL805
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL806-.LVL805
+	.uleb128 .LVL829-.LVL805
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL829-.LVL805
+	.uleb128 .LVL830-.LVL805
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL830-.LVL805
+	.uleb128 .LFE29-.LVL805
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS400:
+	.uleb128 .LVU3943
+	.uleb128 .LVU3980
+	.uleb128 .LVU3983
+	.uleb128 .LVU3995
+	.uleb128 .LVU3995
+	.uleb128 .LVU3997
+.LLST400:
+	.byte	0x6
+	.quad	.LVL814
+	.byte	0x4
+	.uleb128 .LVL814-.LVL814
+	.uleb128 .LVL824-.LVL814
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL825-.LVL814
+	.uleb128 .LVL829-.LVL814
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL829-.LVL814
+	.uleb128 .LVL830-.LVL814
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS401:
+	.uleb128 .LVU3953
+	.uleb128 .LVU3959
+	.uleb128 .LVU3959
+	.uleb128 .LVU3974
+	.uleb128 .LVU3974
+	.uleb128 .LVU3977
+	.uleb128 .LVU3983
+	.uleb128 .LVU3987
+	.uleb128 .LVU3988
+	.uleb128 .LVU3997
+.LLST401:
+	.byte	0x6
+	.quad	.LVL816
+	.byte	0x4
+	.uleb128 .LVL816-.LVL816
+	.uleb128 .LVL818-.LVL816
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL818-.LVL816
+	.uleb128 .LVL821-.LVL816
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL821-.LVL816
+	.uleb128 .LVL823-1-.LVL816
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL825-.LVL816
+	.uleb128 .LVL826-1-.LVL816
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL827-.LVL816
+	.uleb128 .LVL830-1-.LVL816
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS402:
+	.uleb128 .LVU3961
+	.uleb128 .LVU3979
+.LLST402:
+	.byte	0x8
+	.quad	.LVL819
+	.uleb128 .LVL823-.LVL819
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU3948
+	.uleb128 .LVU3952
+	.uleb128 .LVU3984
+	.uleb128 .LVU3990
+.LLST404:
+	.byte	0x6
+	.quad	.LVL814
+	.byte	0x4
+	.uleb128 .LVL814-.LVL814
+	.uleb128 .LVL815-1-.LVL814
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 4
+	.byte	0x4
+	.uleb128 .LVL825-.LVL814
+	.uleb128 .LVL828-.LVL814
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x4b00
+	.byte	0x9f
+	.byte	0
+.LVUS405:
+	.uleb128 .LVU3962
+	.uleb128 .LVU3975
+.LLST405:
+	.byte	0x8
+	.quad	.LVL820
+	.uleb128 .LVL822-.LVL820
+	.uleb128 0xd
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU3964
+	.uleb128 .LVU3977
+.LLST407:
+	.byte	0x8
+	.quad	.LVL820
+	.uleb128 .LVL823-.LVL820
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS408:
+	.uleb128 .LVU3964
+	.uleb128 .LVU3974
+	.uleb128 .LVU3974
+	.uleb128 .LVU3977
+.LLST408:
+	.byte	0x6
+	.quad	.LVL820
+	.byte	0x4
+	.uleb128 .LVL820-.LVL820
+	.uleb128 .LVL821-.LVL820
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL821-.LVL820
+	.uleb128 .LVL823-1-.LVL820
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS409:
+	.uleb128 .LVU3964
+	.uleb128 .LVU3975
+.LLST409:
+	.byte	0x8
+	.quad	.LVL820
+	.uleb128 .LVL822-.LVL820
+	.uleb128 0xd
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3
+	.quad	mspPorts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS386:
+	.uleb128 .LVU3789
+	.uleb128 .LVU3795
+	.uleb128 .LVU3795
+	.uleb128 .LVU3823
+	.uleb128 .LVU3823
+	.uleb128 .LVU3824
+	.uleb128 .LVU3835
+	.uleb128 .LVU3838
+	.uleb128 .LVU3840
+	.uleb128 .LVU3845
+	.uleb128 .LVU3845
+	.uleb128 0
+.LLST386:
+	.byte	0x6
+	.quad	.LVL782
+	.byte	0x4
+	.uleb128 .LVL782-.LVL782
+	.uleb128 .LVL784-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL784-.LVL782
+	.uleb128 .LVL793-.LVL782
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL793-.LVL782
+	.uleb128 .LVL794-.LVL782
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL796-.LVL782
+	.uleb128 .LVL797-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL799-.LVL782
+	.uleb128 .LVL803-.LVL782
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL803-.LVL782
+	.uleb128 .LFE26-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU3797
+	.uleb128 .LVU3818
+.LLST387:
+	.byte	0x8
+	.quad	.LVL785
+	.uleb128 .LVL792-1-.LVL785
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU3840
+	.uleb128 .LVU3841
+	.uleb128 .LVU3841
+	.uleb128 .LVU3842
+	.uleb128 .LVU3842
+	.uleb128 .LVU3844
+	.uleb128 .LVU3844
+	.uleb128 .LVU3845
+.LLST388:
+	.byte	0x6
+	.quad	.LVL799
+	.byte	0x4
+	.uleb128 .LVL799-.LVL799
+	.uleb128 .LVL800-.LVL799
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL800-.LVL799
+	.uleb128 .LVL801-.LVL799
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL801-.LVL799
+	.uleb128 .LVL802-.LVL799
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL802-.LVL799
+	.uleb128 .LVL803-.LVL799
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS389:
+	.uleb128 .LVU3787
+	.uleb128 .LVU3794
+	.uleb128 .LVU3832
+	.uleb128 .LVU3838
+	.uleb128 .LVU3845
+	.uleb128 0
+.LLST389:
+	.byte	0x6
+	.quad	.LVL782
+	.byte	0x4
+	.uleb128 .LVL782-.LVL782
+	.uleb128 .LVL783-.LVL782
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL796-.LVL782
+	.uleb128 .LVL797-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL803-.LVL782
+	.uleb128 .LFE26-.LVL782
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS390:
+	.uleb128 .LVU3787
+	.uleb128 .LVU3794
+	.uleb128 .LVU3795
+	.uleb128 .LVU3827
+	.uleb128 .LVU3833
+	.uleb128 .LVU3839
+	.uleb128 .LVU3840
+	.uleb128 .LVU3845
+	.uleb128 .LVU3845
+	.uleb128 0
+.LLST390:
+	.byte	0x6
+	.quad	.LVL782
+	.byte	0x4
+	.uleb128 .LVL782-.LVL782
+	.uleb128 .LVL783-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL784-.LVL782
+	.uleb128 .LVL795-.LVL782
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL796-.LVL782
+	.uleb128 .LVL798-.LVL782
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL799-.LVL782
+	.uleb128 .LVL803-.LVL782
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL803-.LVL782
+	.uleb128 .LFE26-.LVL782
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU3818
+	.uleb128 .LVU3822
+	.uleb128 .LVU3840
+	.uleb128 .LVU3841
+.LLST391:
+	.byte	0x6
+	.quad	.LVL792
+	.byte	0x4
+	.uleb128 .LVL792-.LVL792
+	.uleb128 .LVL793-.LVL792
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL799-.LVL792
+	.uleb128 .LVL800-.LVL792
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS392:
+	.uleb128 .LVU3813
+	.uleb128 .LVU3822
+	.uleb128 .LVU3840
+	.uleb128 .LVU3845
+.LLST392:
+	.byte	0x6
+	.quad	.LVL791
+	.byte	0x4
+	.uleb128 .LVL791-.LVL791
+	.uleb128 .LVL793-.LVL791
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL799-.LVL791
+	.uleb128 .LVL803-.LVL791
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU3798
+	.uleb128 .LVU3813
+.LLST394:
+	.byte	0x8
+	.quad	.LVL785
+	.uleb128 .LVL791-.LVL785
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS395:
+	.uleb128 .LVU3802
+	.uleb128 .LVU3804
+	.uleb128 .LVU3804
+	.uleb128 .LVU3805
+	.uleb128 .LVU3805
+	.uleb128 .LVU3806
+	.uleb128 .LVU3807
+	.uleb128 .LVU3811
+.LLST395:
+	.byte	0x6
+	.quad	.LVL785
+	.byte	0x4
+	.uleb128 .LVL785-.LVL785
+	.uleb128 .LVL786-.LVL785
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL786-.LVL785
+	.uleb128 .LVL786-.LVL785
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL786-.LVL785
+	.uleb128 .LVL787-.LVL785
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL788-.LVL785
+	.uleb128 .LVL789-.LVL785
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS396:
+	.uleb128 .LVU3804
+	.uleb128 .LVU3806
+	.uleb128 .LVU3806
+	.uleb128 .LVU3807
+	.uleb128 .LVU3808
+	.uleb128 .LVU3812
+.LLST396:
+	.byte	0x6
+	.quad	.LVL786
+	.byte	0x4
+	.uleb128 .LVL786-.LVL786
+	.uleb128 .LVL787-.LVL786
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL787-.LVL786
+	.uleb128 .LVL788-.LVL786
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL788-.LVL786
+	.uleb128 .LVL790-.LVL786
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS397:
+	.uleb128 .LVU3828
+	.uleb128 .LVU3830
+.LLST397:
+	.byte	0x8
+	.quad	.LVL795
+	.uleb128 .LVL796-.LVL795
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU1900
+	.uleb128 .LVU1900
+	.uleb128 .LVU1907
+	.uleb128 .LVU1907
+	.uleb128 .LVU1908
+	.uleb128 .LVU1908
+	.uleb128 .LVU1909
+	.uleb128 .LVU1909
+	.uleb128 .LVU1914
+	.uleb128 .LVU1914
+	.uleb128 .LVU1918
+	.uleb128 .LVU1918
+	.uleb128 0
+.LLST128:
+	.byte	0x6
+	.quad	.LVL156
+	.byte	0x4
+	.uleb128 .LVL156-.LVL156
+	.uleb128 .LVL157-.LVL156
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL157-.LVL156
+	.uleb128 .LVL158-.LVL156
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL158-.LVL156
+	.uleb128 .LVL159-.LVL156
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL159-.LVL156
+	.uleb128 .LVL160-1-.LVL156
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL160-1-.LVL156
+	.uleb128 .LVL162-.LVL156
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.LVL156
+	.uleb128 .LVL163-.LVL156
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL163-.LVL156
+	.uleb128 .LFE12-.LVL156
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 0
+	.uleb128 .LVU1930
+	.uleb128 .LVU1930
+	.uleb128 0
+.LLST130:
+	.byte	0x6
+	.quad	.LVL166
+	.byte	0x4
+	.uleb128 .LVL166-.LVL166
+	.uleb128 .LVL167-.LVL166
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL167-.LVL166
+	.uleb128 .LFE13-.LVL166
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 0
+	.uleb128 .LVU1941
+	.uleb128 .LVU1941
+	.uleb128 .LVU1944
+	.uleb128 .LVU1944
+	.uleb128 0
+.LLST131:
+	.byte	0x6
+	.quad	.LVL170
+	.byte	0x4
+	.uleb128 .LVL170-.LVL170
+	.uleb128 .LVL171-.LVL170
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL171-.LVL170
+	.uleb128 .LVL173-.LVL170
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL173-.LVL170
+	.uleb128 .LFE14-.LVL170
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU1936
+	.uleb128 .LVU1941
+	.uleb128 .LVU1941
+	.uleb128 .LVU1944
+	.uleb128 .LVU1944
+	.uleb128 .LVU1945
+.LLST133:
+	.byte	0x6
+	.quad	.LVL170
+	.byte	0x4
+	.uleb128 .LVL170-.LVL170
+	.uleb128 .LVL171-.LVL170
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL171-.LVL170
+	.uleb128 .LVL173-.LVL170
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL173-.LVL170
+	.uleb128 .LVL174-.LVL170
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 .LVU1947
+	.uleb128 .LVU1950
+	.uleb128 .LVU1950
+	.uleb128 0
+.LLST135:
+	.byte	0x6
+	.quad	.LVL174
+	.byte	0x4
+	.uleb128 .LVL174-.LVL174
+	.uleb128 .LVL175-.LVL174
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL175-.LVL174
+	.uleb128 .LFE14-.LVL174
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x40
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU1976
+	.uleb128 .LVU1987
+.LLST136:
+	.byte	0x8
+	.quad	.LVL178
+	.uleb128 .LVL179-.LVL178
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU2017
+	.uleb128 .LVU2042
+	.uleb128 .LVU2048
+	.uleb128 .LVU2051
+.LLST137:
+	.byte	0x6
+	.quad	.LVL182
+	.byte	0x4
+	.uleb128 .LVL182-.LVL182
+	.uleb128 .LVL184-.LVL182
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL187-.LVL182
+	.uleb128 .LVL188-.LVL182
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU2002
+	.uleb128 .LVU2011
+	.uleb128 .LVU2046
+	.uleb128 .LVU2047
+	.uleb128 .LVU2047
+	.uleb128 .LVU2048
+.LLST138:
+	.byte	0x6
+	.quad	.LVL180
+	.byte	0x4
+	.uleb128 .LVL180-.LVL180
+	.uleb128 .LVL181-.LVL180
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL185-.LVL180
+	.uleb128 .LVL186-.LVL180
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL186-.LVL180
+	.uleb128 .LVL187-.LVL180
+	.uleb128 0x11
+	.byte	0x72
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x36
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU2028
+	.uleb128 .LVU2042
+	.uleb128 .LVU2048
+	.uleb128 0
+.LLST140:
+	.byte	0x6
+	.quad	.LVL183
+	.byte	0x4
+	.uleb128 .LVL183-.LVL183
+	.uleb128 .LVL184-.LVL183
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL187-.LVL183
+	.uleb128 .LFE17-.LVL183
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS141:
+	.uleb128 0
+	.uleb128 .LVU2067
+	.uleb128 .LVU2067
+	.uleb128 .LVU2133
+	.uleb128 .LVU2133
+	.uleb128 .LVU2142
+	.uleb128 .LVU2142
+	.uleb128 0
+.LLST141:
+	.byte	0x6
+	.quad	.LVL189
+	.byte	0x4
+	.uleb128 .LVL189-.LVL189
+	.uleb128 .LVL192-.LVL189
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL192-.LVL189
+	.uleb128 .LVL214-.LVL189
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.LVL189
+	.uleb128 .LVL216-.LVL189
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-.LVL189
+	.uleb128 .LFE18-.LVL189
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 0
+	.uleb128 .LVU2066
+	.uleb128 .LVU2066
+	.uleb128 .LVU2133
+	.uleb128 .LVU2133
+	.uleb128 .LVU2144
+	.uleb128 .LVU2144
+	.uleb128 0
+.LLST142:
+	.byte	0x6
+	.quad	.LVL189
+	.byte	0x4
+	.uleb128 .LVL189-.LVL189
+	.uleb128 .LVL191-.LVL189
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL191-.LVL189
+	.uleb128 .LVL214-.LVL189
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL214-.LVL189
+	.uleb128 .LVL218-1-.LVL189
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL218-1-.LVL189
+	.uleb128 .LFE18-.LVL189
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU2060
+	.uleb128 .LVU2112
+	.uleb128 .LVU2122
+	.uleb128 .LVU2126
+	.uleb128 .LVU2130
+	.uleb128 .LVU2133
+.LLST144:
+	.byte	0x6
+	.quad	.LVL190
+	.byte	0x4
+	.uleb128 .LVL190-.LVL190
+	.uleb128 .LVL203-.LVL190
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL207-.LVL190
+	.uleb128 .LVL209-.LVL190
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL212-.LVL190
+	.uleb128 .LVL214-.LVL190
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU2060
+	.uleb128 .LVU2112
+	.uleb128 .LVU2122
+	.uleb128 .LVU2128
+	.uleb128 .LVU2130
+	.uleb128 .LVU2133
+.LLST145:
+	.byte	0x6
+	.quad	.LVL190
+	.byte	0x4
+	.uleb128 .LVL190-.LVL190
+	.uleb128 .LVL203-.LVL190
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL207-.LVL190
+	.uleb128 .LVL211-.LVL190
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL212-.LVL190
+	.uleb128 .LVL214-.LVL190
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS146:
+	.uleb128 .LVU2076
+	.uleb128 .LVU2107
+	.uleb128 .LVU2122
+	.uleb128 .LVU2127
+	.uleb128 .LVU2130
+	.uleb128 .LVU2133
+.LLST146:
+	.byte	0x6
+	.quad	.LVL194
+	.byte	0x4
+	.uleb128 .LVL194-.LVL194
+	.uleb128 .LVL200-.LVL194
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL207-.LVL194
+	.uleb128 .LVL210-.LVL194
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL212-.LVL194
+	.uleb128 .LVL214-.LVL194
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU2107
+	.uleb128 .LVU2110
+	.uleb128 .LVU2110
+	.uleb128 .LVU2111
+.LLST147:
+	.byte	0x6
+	.quad	.LVL200
+	.byte	0x4
+	.uleb128 .LVL200-.LVL200
+	.uleb128 .LVL201-.LVL200
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL201-.LVL200
+	.uleb128 .LVL202-1-.LVL200
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 310
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU2114
+	.uleb128 .LVU2120
+.LLST149:
+	.byte	0x8
+	.quad	.LVL204
+	.uleb128 .LVL206-.LVL204
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU2140
+	.uleb128 .LVU2143
+	.uleb128 .LVU2143
+	.uleb128 .LVU2144
+.LLST150:
+	.byte	0x6
+	.quad	.LVL215
+	.byte	0x4
+	.uleb128 .LVL215-.LVL215
+	.uleb128 .LVL217-.LVL215
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL217-.LVL215
+	.uleb128 .LVL218-1-.LVL215
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 310
+	.byte	0
+.LVUS164:
+	.uleb128 0
+	.uleb128 .LVU2290
+	.uleb128 .LVU2290
+	.uleb128 .LVU2300
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+	.uleb128 .LVU2302
+	.uleb128 .LVU2304
+	.uleb128 .LVU2304
+	.uleb128 .LVU2306
+	.uleb128 .LVU2306
+	.uleb128 .LVU2322
+	.uleb128 .LVU2322
+	.uleb128 0
+.LLST164:
+	.byte	0x6
+	.quad	.LVL261
+	.byte	0x4
+	.uleb128 .LVL261-.LVL261
+	.uleb128 .LVL263-1-.LVL261
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-1-.LVL261
+	.uleb128 .LVL268-.LVL261
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL268-.LVL261
+	.uleb128 .LVL269-.LVL261
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL269-.LVL261
+	.uleb128 .LVL270-.LVL261
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL270-.LVL261
+	.uleb128 .LVL272-.LVL261
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	mspCommands
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.LVL261
+	.uleb128 .LVL278-.LVL261
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.LVL261
+	.uleb128 .LFE89-.LVL261
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU2287
+	.uleb128 .LVU2290
+	.uleb128 .LVU2290
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+	.uleb128 .LVU2304
+	.uleb128 .LVU2304
+	.uleb128 .LVU2306
+	.uleb128 .LVU2306
+	.uleb128 .LVU2322
+	.uleb128 .LVU2322
+	.uleb128 0
+.LLST166:
+	.byte	0x6
+	.quad	.LVL262
+	.byte	0x4
+	.uleb128 .LVL262-.LVL262
+	.uleb128 .LVL263-1-.LVL262
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-1-.LVL262
+	.uleb128 .LVL268-.LVL262
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL269-.LVL262
+	.uleb128 .LVL270-.LVL262
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL270-.LVL262
+	.uleb128 .LVL272-.LVL262
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	mspCommands
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.LVL262
+	.uleb128 .LVL278-.LVL262
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL278-.LVL262
+	.uleb128 .LFE89-.LVL262
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU2294
+	.uleb128 .LVU2297
+	.uleb128 .LVU2297
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+	.uleb128 .LVU2320
+	.uleb128 .LVU2320
+	.uleb128 .LVU2325
+	.uleb128 .LVU2325
+	.uleb128 0
+.LLST167:
+	.byte	0x6
+	.quad	.LVL266
+	.byte	0x4
+	.uleb128 .LVL266-.LVL266
+	.uleb128 .LVL267-.LVL266
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL267-.LVL266
+	.uleb128 .LVL268-.LVL266
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL269-.LVL266
+	.uleb128 .LVL276-.LVL266
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL276-.LVL266
+	.uleb128 .LVL279-1-.LVL266
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL279-1-.LVL266
+	.uleb128 .LFE89-.LVL266
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU2291
+	.uleb128 .LVU2293
+	.uleb128 .LVU2293
+	.uleb128 .LVU2300
+	.uleb128 .LVU2302
+	.uleb128 .LVU2321
+	.uleb128 .LVU2322
+	.uleb128 0
+.LLST168:
+	.byte	0x6
+	.quad	.LVL264
+	.byte	0x4
+	.uleb128 .LVL264-.LVL264
+	.uleb128 .LVL265-1-.LVL264
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL265-1-.LVL264
+	.uleb128 .LVL268-.LVL264
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL269-.LVL264
+	.uleb128 .LVL277-.LVL264
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL278-.LVL264
+	.uleb128 .LFE89-.LVL264
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU2306
+	.uleb128 .LVU2319
+	.uleb128 .LVU2319
+	.uleb128 .LVU2322
+.LLST169:
+	.byte	0x6
+	.quad	.LVL272
+	.byte	0x4
+	.uleb128 .LVL272-.LVL272
+	.uleb128 .LVL275-.LVL272
+	.uleb128 0xf
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3c
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspCommandStats
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL275-.LVL272
+	.uleb128 .LVL278-.LVL272
+	.uleb128 0x1c
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x3
+	.quad	mspCommands
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x26
+	.byte	0x3c
+	.byte	0x1e
+	.byte	0x3
+	.quad	mspCommandStats
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU2309
+	.uleb128 .LVU2318
+	.uleb128 .LVU2318
+	.uleb128 .LVU2322
+.LLST170:
+	.byte	0x6
+	.quad	.LVL273
+	.byte	0x4
+	.uleb128 .LVL273-.LVL273
+	.uleb128 .LVL274-.LVL273
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL274-.LVL273
+	.uleb128 .LVL278-.LVL273
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 8
+	.byte	0
+.LVUS328:
+	.uleb128 0
+	.uleb128 .LVU3426
+	.uleb128 .LVU3426
+	.uleb128 0
+.LLST328:
+	.byte	0x6
+	.quad	.LVL670
+	.byte	0x4
+	.uleb128 .LVL670-.LVL670
+	.uleb128 .LVL671-.LVL670
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL671-.LVL670
+	.uleb128 .LFE84-.LVL670
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU3435
+	.uleb128 .LVU3452
+	.uleb128 .LVU3457
+	.uleb128 .LVU3465
+	.uleb128 .LVU3465
+	.uleb128 .LVU3467
+	.uleb128 .LVU3470
+	.uleb128 .LVU3473
+.LLST330:
+	.byte	0x6
+	.quad	.LVL672
+	.byte	0x4
+	.uleb128 .LVL672-.LVL672
+	.uleb128 .LVL676-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL677-.LVL672
+	.uleb128 .LVL678-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL678-.LVL672
+	.uleb128 .LVL679-1-.LVL672
+	.uleb128 0xd
+	.byte	0x3
+	.quad	currentPort
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x136
+	.byte	0x4
+	.uleb128 .LVL680-.LVL672
+	.uleb128 .LVL682-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU3459
+	.uleb128 .LVU3467
+.LLST331:
+	.byte	0x8
+	.quad	.LVL677
+	.uleb128 .LVL679-1-.LVL677
+	.uleb128 0x12
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x24
+	.byte	0x3
+	.quad	mspCommands
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS333:
+	.uleb128 .LVU3437
+	.uleb128 .LVU3452
+	.uleb128 .LVU3457
+	.uleb128 .LVU3459
+	.uleb128 .LVU3470
+	.uleb128 .LVU3473
+.LLST333:
+	.byte	0x6
+	.quad	.LVL672
+	.byte	0x4
+	.uleb128 .LVL672-.LVL672
+	.uleb128 .LVL676-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL677-.LVL672
+	.uleb128 .LVL677-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL680-.LVL672
+	.uleb128 .LVL682-.LVL672
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU3439
+	.uleb128 .LVU3452
+	.uleb128 .LVU3457
+	.uleb128 .LVU3459
+	.uleb128 .LVU3470
+	.uleb128 .LVU3473
+.LLST335:
+	.byte	0x6
+	.quad	.LVL673
+	.byte	0x4
+	.uleb128 .LVL673-.LVL673
+	.uleb128 .LVL676-.LVL673
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL677-.LVL673
+	.uleb128 .LVL677-.LVL673
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL680-.LVL673
+	.uleb128 .LVL682-.LVL673
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS336:
+	.uleb128 .LVU3439
+	.uleb128 .LVU3452
+	.uleb128 .LVU3457
+	.uleb128 .LVU3459
+	.uleb128 .LVU3470
+	.uleb128 .LVU3473
+.LLST336:
+	.byte	0x6
+	.quad	.LVL673
+	.byte	0x4
+	.uleb128 .LVL673-.LVL673
+	.uleb128 .LVL676-.LVL673
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL677-.LVL673
+	.uleb128 .LVL677-.LVL673
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL680-.LVL673
+	.uleb128 .LVL682-.LVL673
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS338:
+	.uleb128 .LVU3442
+	.uleb128 .LVU3446
+	.uleb128 .LVU3470
+	.uleb128 .LVU3473
+.LLST338:
+	.byte	0x6
+	.quad	.LVL674
+	.byte	0x4
+	.uleb128 .LVL674-.LVL674
+	.uleb128 .LVL675-.LVL674
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL680-.LVL674
+	.uleb128 .LVL682-.LVL674
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS340:
+	.uleb128 .LVU3454
+	.uleb128 .LVU3457
+	.uleb128 .LVU3475
+	.uleb128 0
+.LLST340:
+	.byte	0x6
+	.quad	.LVL676
+	.byte	0x4
+	.uleb128 .LVL676-.LVL676
+	.uleb128 .LVL677-.LVL676
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL682-.LVL676
+	.uleb128 .LFE84-.LVL676
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU3455
+	.uleb128 .LVU3457
+	.uleb128 .LVU3476
+	.uleb128 0
+.LLST342:
+	.byte	0x6
+	.quad	.LVL676
+	.byte	0x4
+	.uleb128 .LVL676-.LVL676
+	.uleb128 .LVL677-.LVL676
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL682-.LVL676
+	.uleb128 .LFE84-.LVL676
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS374:
+	.uleb128 0
+	.uleb128 .LVU3690
+	.uleb128 .LVU3690
+	.uleb128 .LVU3691
+	.uleb128 .LVU3691
+	.uleb128 0
+.LLST374:
+	.byte	0x6
+	.quad	.LVL743
+	.byte	0x4
+	.uleb128 .LVL743-.LVL743
+	.uleb128 .LVL744-.LVL743
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL744-.LVL743
+	.uleb128 .LVL745-1-.LVL743
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL745-1-.LVL743
+	.uleb128 .LFE19-.LVL743
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS375:
+	.uleb128 0
+	.uleb128 .LVU3694
+	.uleb128 .LVU3694
+	.uleb128 .LVU3695
+	.uleb128 .LVU3695
+	.uleb128 0
+.LLST375:
+	.byte	0x6
+	.quad	.LVL746
+	.byte	0x4
+	.uleb128 .LVL746-.LVL746
+	.uleb128 .LVL747-.LVL746
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL747-.LVL746
+	.uleb128 .LVL748-1-.LVL746
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL748-1-.LVL746
+	.uleb128 .LFE20-.LVL746
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS376:
+	.uleb128 0
+	.uleb128 .LVU3721
+	.uleb128 .LVU3721
+	.uleb128 .LVU3733
+.LLST376:
+	.byte	0x6
+	.quad	.LVL751
+	.byte	0x4
+	.uleb128 .LVL751-.LVL751
+	.uleb128 .LVL753-.LVL751
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL753-.LVL751
+	.uleb128 .LVL759-.LVL751
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS377:
+	.uleb128 0
+	.uleb128 .LVU3724
+	.uleb128 .LVU3724
+	.uleb128 .LVU3726
+	.uleb128 .LVU3726
+	.uleb128 .LVU3727
+	.uleb128 .LVU3727
+	.uleb128 .LVU3732
+.LLST377:
+	.byte	0x6
+	.quad	.LVL751
+	.byte	0x4
+	.uleb128 .LVL751-.LVL751
+	.uleb128 .LVL754-1-.LVL751
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL754-1-.LVL751
+	.uleb128 .LVL754-.LVL751
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL754-.LVL751
+	.uleb128 .LVL755-.LVL751
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL755-.LVL751
+	.uleb128 .LVL758-.LVL751
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS379:
+	.uleb128 .LVU3716
+	.uleb128 .LVU3724
+	.uleb128 .LVU3724
+	.uleb128 .LVU3724
+.LLST379:
+	.byte	0x6
+	.quad	.LVL752
+	.byte	0x4
+	.uleb128 .LVL752-.LVL752
+	.uleb128 .LVL754-1-.LVL752
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL754-1-.LVL752
+	.uleb128 .LVL754-.LVL752
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS380:
+	.uleb128 0
+	.uleb128 .LVU3741
+	.uleb128 .LVU3741
+	.uleb128 .LVU3742
+	.uleb128 .LVU3742
+	.uleb128 0
+.LLST380:
+	.byte	0x6
+	.quad	.LVL760
+	.byte	0x4
+	.uleb128 .LVL760-.LVL760
+	.uleb128 .LVL761-.LVL760
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL761-.LVL760
+	.uleb128 .LVL762-.LVL760
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL762-.LVL760
+	.uleb128 .LFE23-.LVL760
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU3737
+	.uleb128 .LVU3741
+	.uleb128 .LVU3741
+	.uleb128 .LVU3748
+.LLST381:
+	.byte	0x6
+	.quad	.LVL760
+	.byte	0x4
+	.uleb128 .LVL760-.LVL760
+	.uleb128 .LVL761-.LVL760
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL761-.LVL760
+	.uleb128 .LVL765-.LVL760
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU3753
+	.uleb128 .LVU3755
+	.uleb128 .LVU3755
+	.uleb128 .LVU3756
+	.uleb128 .LVU3756
+	.uleb128 .LVU3757
+	.uleb128 .LVU3758
+	.uleb128 .LVU3762
+.LLST382:
+	.byte	0x6
+	.quad	.LVL766
+	.byte	0x4
+	.uleb128 .LVL766-.LVL766
+	.uleb128 .LVL767-.LVL766
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL767-.LVL766
+	.uleb128 .LVL767-.LVL766
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL767-.LVL766
+	.uleb128 .LVL768-.LVL766
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL769-.LVL766
+	.uleb128 .LVL770-.LVL766
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS383:
+	.uleb128 .LVU3755
+	.uleb128 .LVU3757
+	.uleb128 .LVU3757
+	.uleb128 .LVU3758
+	.uleb128 .LVU3759
+	.uleb128 .LVU3763
+	.uleb128 .LVU3765
+	.uleb128 .LVU3766
+.LLST383:
+	.byte	0x6
+	.quad	.LVL767
+	.byte	0x4
+	.uleb128 .LVL767-.LVL767
+	.uleb128 .LVL768-.LVL767
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL768-.LVL767
+	.uleb128 .LVL769-.LVL767
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL769-.LVL767
+	.uleb128 .LVL771-.LVL767
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL772-.LVL767
+	.uleb128 .LVL773-.LVL767
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS384:
+	.uleb128 .LVU3771
+	.uleb128 .LVU3773
+	.uleb128 .LVU3773
+	.uleb128 .LVU3774
+	.uleb128 .LVU3774
+	.uleb128 .LVU3775
+	.uleb128 .LVU3776
+	.uleb128 .LVU3780
+.LLST384:
+	.byte	0x6
+	.quad	.LVL774
+	.byte	0x4
+	.uleb128 .LVL774-.LVL774
+	.uleb128 .LVL775-.LVL774
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL775-.LVL774
+	.uleb128 .LVL775-.LVL774
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL775-.LVL774
+	.uleb128 .LVL776-.LVL774
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL777-.LVL774
+	.uleb128 .LVL778-.LVL774
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU3773
+	.uleb128 .LVU3775
+	.uleb128 .LVU3775
+	.uleb128 .LVU3776
+	.uleb128 .LVU3777
+	.uleb128 .LVU3781
+	.uleb128 .LVU3783
+	.uleb128 .LVU3784
+.LLST385:
+	.byte	0x6
+	.quad	.LVL775
+	.byte	0x4
+	.uleb128 .LVL775-.LVL775
+	.uleb128 .LVL776-.LVL775
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL776-.LVL775
+	.uleb128 .LVL777-.LVL775
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL777-.LVL775
+	.uleb128 .LVL779-.LVL775
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL780-.LVL775
+	.uleb128 .LVL781-.LVL775
+	.uleb128 0x15
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x48
+	.byte	0x1e
+	.byte	0x3
+	.quad	boxes
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x53c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB74
+	.quad	.LFE74-.LFB74
+	.quad	.LFB83
+	.quad	.LFE83-.LFB83
+	.quad	.LFB75
+	.quad	.LFE75-.LFB75
+	.quad	.LFB72
+	.quad	.LFE72-.LFB72
+	.quad	.LFB73
+	.quad	.LFE73-.LFB73
+	.quad	.LFB82
+	.quad	.LFE82-.LFB82
+	.quad	.LFB71
+	.quad	.LFE71-.LFB71
+	.quad	.LFB69
+	.quad	.LFE69-.LFB69
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.quad	.LFB70
+	.quad	.LFE70-.LFB70
+	.quad	.LFB81
+	.quad	.LFE81-.LFB81
+	.quad	.LFB79
+	.quad	.LFE79-.LFB79
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.quad	.LFB87
+	.quad	.LFE87-.LFB87
+	.quad	.LFB78
+	.quad	.LFE78-.LFB78
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.quad	.LFB76
+	.quad	.LFE76-.LFB76
+	.quad	.LFB77
+	.quad	.LFE77-.LFB77
+	.quad	.LFB67
+	.quad	.LFE67-.LFB67
+	.quad	.LFB80
+	.quad	.LFE80-.LFB80
+	.quad	.LFB66
+	.quad	.LFE66-.LFB66
+	.quad	.LFB68
+	.quad	.LFE68-.LFB68
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB86
+	.quad	.LFE86-.LFB86
+	.quad	.LFB89
+	.quad	.LFE89-.LFB89
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB84
+	.quad	.LFE84-.LFB84
+	.quad	.LFB85
+	.quad	.LFE85-.LFB85
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB91
+	.quad	.LFE91-.LFB91
+	.quad	.LFB92
+	.quad	.LFE92-.LFB92
+	.quad	.LFB93
+	.quad	.LFE93-.LFB93
+	.quad	.LFB97
+	.quad	.LFE97-.LFB97
+	.quad	.LFB98
+	.quad	.LFE98-.LFB98
+	.quad	.LFB99
+	.quad	.LFE99-.LFB99
+	.quad	.LFB100
+	.quad	.LFE100-.LFB100
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL1:
+	.byte	0x5
+	.quad	.LBB112
+	.byte	0x4
+	.uleb128 .LBB112-.LBB112
+	.uleb128 .LBE112-.LBB112
+	.byte	0x4
+	.uleb128 .LBB115-.LBB112
+	.uleb128 .LBE115-.LBB112
+	.byte	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB118
+	.byte	0x4
+	.uleb128 .LBB118-.LBB118
+	.uleb128 .LBE118-.LBB118
+	.byte	0x4
+	.uleb128 .LBB122-.LBB118
+	.uleb128 .LBE122-.LBB118
+	.byte	0x4
+	.uleb128 .LBB123-.LBB118
+	.uleb128 .LBE123-.LBB118
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB130
+	.byte	0x4
+	.uleb128 .LBB130-.LBB130
+	.uleb128 .LBE130-.LBB130
+	.byte	0x4
+	.uleb128 .LBB139-.LBB130
+	.uleb128 .LBE139-.LBB130
+	.byte	0
+.LLRL7:
+	.byte	0x5
+	.quad	.LBB132
+	.byte	0x4
+	.uleb128 .LBB132-.LBB132
+	.uleb128 .LBE132-.LBB132
+	.byte	0x4
+	.uleb128 .LBB135-.LBB132
+	.uleb128 .LBE135-.LBB132
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB146
+	.byte	0x4
+	.uleb128 .LBB146-.LBB146
+	.uleb128 .LBE146-.LBB146
+	.byte	0x4
+	.uleb128 .LBB155-.LBB146
+	.uleb128 .LBE155-.LBB146
+	.byte	0
+.LLRL11:
+	.byte	0x5
+	.quad	.LBB148
+	.byte	0x4
+	.uleb128 .LBB148-.LBB148
+	.uleb128 .LBE148-.LBB148
+	.byte	0x4
+	.uleb128 .LBB151-.LBB148
+	.uleb128 .LBE151-.LBB148
+	.byte	0
+.LLRL13:
+	.byte	0x5
+	.quad	.LBB177
+	.byte	0x4
+	.uleb128 .LBB177-.LBB177
+	.uleb128 .LBE177-.LBB177
+	.byte	0x4
+	.uleb128 .LBB238-.LBB177
+	.uleb128 .LBE238-.LBB177
+	.byte	0x4
+	.uleb128 .LBB239-.LBB177
+	.uleb128 .LBE239-.LBB177
+	.byte	0x4
+	.uleb128 .LBB240-.LBB177
+	.uleb128 .LBE240-.LBB177
+	.byte	0x4
+	.uleb128 .LBB241-.LBB177
+	.uleb128 .LBE241-.LBB177
+	.byte	0x4
+	.uleb128 .LBB242-.LBB177
+	.uleb128 .LBE242-.LBB177
+	.byte	0x4
+	.uleb128 .LBB243-.LBB177
+	.uleb128 .LBE243-.LBB177
+	.byte	0x4
+	.uleb128 .LBB244-.LBB177
+	.uleb128 .LBE244-.LBB177
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB178
+	.byte	0x4
+	.uleb128 .LBB178-.LBB178
+	.uleb128 .LBE178-.LBB178
+	.byte	0x4
+	.uleb128 .LBB225-.LBB178
+	.uleb128 .LBE225-.LBB178
+	.byte	0x4
+	.uleb128 .LBB231-.LBB178
+	.uleb128 .LBE231-.LBB178
+	.byte	0
+.LLRL17:
+	.byte	0x5
+	.quad	.LBB180
+	.byte	0x4
+	.uleb128 .LBB180-.LBB180
+	.uleb128 .LBE180-.LBB180
+	.byte	0x4
+	.uleb128 .LBB185-.LBB180
+	.uleb128 .LBE185-.LBB180
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB188
+	.byte	0x4
+	.uleb128 .LBB188-.LBB188
+	.uleb128 .LBE188-.LBB188
+	.byte	0x4
+	.uleb128 .LBB226-.LBB188
+	.uleb128 .LBE226-.LBB188
+	.byte	0x4
+	.uleb128 .LBB232-.LBB188
+	.uleb128 .LBE232-.LBB188
+	.byte	0x4
+	.uleb128 .LBB235-.LBB188
+	.uleb128 .LBE235-.LBB188
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB190
+	.byte	0x4
+	.uleb128 .LBB190-.LBB190
+	.uleb128 .LBE190-.LBB190
+	.byte	0x4
+	.uleb128 .LBB196-.LBB190
+	.uleb128 .LBE196-.LBB190
+	.byte	0x4
+	.uleb128 .LBB197-.LBB190
+	.uleb128 .LBE197-.LBB190
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB201
+	.byte	0x4
+	.uleb128 .LBB201-.LBB201
+	.uleb128 .LBE201-.LBB201
+	.byte	0x4
+	.uleb128 .LBB227-.LBB201
+	.uleb128 .LBE227-.LBB201
+	.byte	0x4
+	.uleb128 .LBB229-.LBB201
+	.uleb128 .LBE229-.LBB201
+	.byte	0x4
+	.uleb128 .LBB233-.LBB201
+	.uleb128 .LBE233-.LBB201
+	.byte	0x4
+	.uleb128 .LBB236-.LBB201
+	.uleb128 .LBE236-.LBB201
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB203
+	.byte	0x4
+	.uleb128 .LBB203-.LBB203
+	.uleb128 .LBE203-.LBB203
+	.byte	0x4
+	.uleb128 .LBB210-.LBB203
+	.uleb128 .LBE210-.LBB203
+	.byte	0x4
+	.uleb128 .LBB211-.LBB203
+	.uleb128 .LBE211-.LBB203
+	.byte	0x4
+	.uleb128 .LBB212-.LBB203
+	.uleb128 .LBE212-.LBB203
+	.byte	0
+.LLRL24:
+	.byte	0x5
+	.quad	.LBB217
+	.byte	0x4
+	.uleb128 .LBB217-.LBB217
+	.uleb128 .LBE217-.LBB217
+	.byte	0x4
+	.uleb128 .LBB224-.LBB217
+	.uleb128 .LBE224-.LBB217
+	.byte	0x4
+	.uleb128 .LBB228-.LBB217
+	.uleb128 .LBE228-.LBB217
+	.byte	0x4
+	.uleb128 .LBB230-.LBB217
+	.uleb128 .LBE230-.LBB217
+	.byte	0x4
+	.uleb128 .LBB234-.LBB217
+	.uleb128 .LBE234-.LBB217
+	.byte	0x4
+	.uleb128 .LBB237-.LBB217
+	.uleb128 .LBE237-.LBB217
+	.byte	0
+.LLRL25:
+	.byte	0x5
+	.quad	.LBB255
+	.byte	0x4
+	.uleb128 .LBB255-.LBB255
+	.uleb128 .LBE255-.LBB255
+	.byte	0x4
+	.uleb128 .LBB258-.LBB255
+	.uleb128 .LBE258-.LBB255
+	.byte	0
+.LLRL28:
+	.byte	0x5
+	.quad	.LBB287
+	.byte	0x4
+	.uleb128 .LBB287-.LBB287
+	.uleb128 .LBE287-.LBB287
+	.byte	0x4
+	.uleb128 .LBB305-.LBB287
+	.uleb128 .LBE305-.LBB287
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB289
+	.byte	0x4
+	.uleb128 .LBB289-.LBB289
+	.uleb128 .LBE289-.LBB289
+	.byte	0x4
+	.uleb128 .LBB294-.LBB289
+	.uleb128 .LBE294-.LBB289
+	.byte	0
+.LLRL31:
+	.byte	0x5
+	.quad	.LBB296
+	.byte	0x4
+	.uleb128 .LBB296-.LBB296
+	.uleb128 .LBE296-.LBB296
+	.byte	0x4
+	.uleb128 .LBB306-.LBB296
+	.uleb128 .LBE306-.LBB296
+	.byte	0
+.LLRL33:
+	.byte	0x5
+	.quad	.LBB298
+	.byte	0x4
+	.uleb128 .LBB298-.LBB298
+	.uleb128 .LBE298-.LBB298
+	.byte	0x4
+	.uleb128 .LBB303-.LBB298
+	.uleb128 .LBE303-.LBB298
+	.byte	0
+.LLRL34:
+	.byte	0x5
+	.quad	.LBB319
+	.byte	0x4
+	.uleb128 .LBB319-.LBB319
+	.uleb128 .LBE319-.LBB319
+	.byte	0x4
+	.uleb128 .LBB331-.LBB319
+	.uleb128 .LBE331-.LBB319
+	.byte	0x4
+	.uleb128 .LBB342-.LBB319
+	.uleb128 .LBE342-.LBB319
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB321
+	.byte	0x4
+	.uleb128 .LBB321-.LBB321
+	.uleb128 .LBE321-.LBB321
+	.byte	0x4
+	.uleb128 .LBB328-.LBB321
+	.uleb128 .LBE328-.LBB321
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB324
+	.byte	0x4
+	.uleb128 .LBB324-.LBB324
+	.uleb128 .LBE324-.LBB324
+	.byte	0x4
+	.uleb128 .LBB327-.LBB324
+	.uleb128 .LBE327-.LBB324
+	.byte	0
+.LLRL38:
+	.byte	0x5
+	.quad	.LBB332
+	.byte	0x4
+	.uleb128 .LBB332-.LBB332
+	.uleb128 .LBE332-.LBB332
+	.byte	0x4
+	.uleb128 .LBB343-.LBB332
+	.uleb128 .LBE343-.LBB332
+	.byte	0x4
+	.uleb128 .LBB344-.LBB332
+	.uleb128 .LBE344-.LBB332
+	.byte	0
+.LLRL40:
+	.byte	0x5
+	.quad	.LBB334
+	.byte	0x4
+	.uleb128 .LBB334-.LBB334
+	.uleb128 .LBE334-.LBB334
+	.byte	0x4
+	.uleb128 .LBB339-.LBB334
+	.uleb128 .LBE339-.LBB334
+	.byte	0
+.LLRL41:
+	.byte	0x5
+	.quad	.LBB359
+	.byte	0x4
+	.uleb128 .LBB359-.LBB359
+	.uleb128 .LBE359-.LBB359
+	.byte	0x4
+	.uleb128 .LBB376-.LBB359
+	.uleb128 .LBE376-.LBB359
+	.byte	0
+.LLRL44:
+	.byte	0x5
+	.quad	.LBB367
+	.byte	0x4
+	.uleb128 .LBB367-.LBB367
+	.uleb128 .LBE367-.LBB367
+	.byte	0x4
+	.uleb128 .LBB374-.LBB367
+	.uleb128 .LBE374-.LBB367
+	.byte	0
+.LLRL46:
+	.byte	0x5
+	.quad	.LBB395
+	.byte	0x4
+	.uleb128 .LBB395-.LBB395
+	.uleb128 .LBE395-.LBB395
+	.byte	0x4
+	.uleb128 .LBB423-.LBB395
+	.uleb128 .LBE423-.LBB395
+	.byte	0
+.LLRL48:
+	.byte	0x5
+	.quad	.LBB397
+	.byte	0x4
+	.uleb128 .LBB397-.LBB397
+	.uleb128 .LBE397-.LBB397
+	.byte	0x4
+	.uleb128 .LBB402-.LBB397
+	.uleb128 .LBE402-.LBB397
+	.byte	0
+.LLRL49:
+	.byte	0x5
+	.quad	.LBB404
+	.byte	0x4
+	.uleb128 .LBB404-.LBB404
+	.uleb128 .LBE404-.LBB404
+	.byte	0x4
+	.uleb128 .LBB424-.LBB404
+	.uleb128 .LBE424-.LBB404
+	.byte	0x4
+	.uleb128 .LBB425-.LBB404
+	.uleb128 .LBE425-.LBB404
+	.byte	0
+.LLRL51:
+	.byte	0x5
+	.quad	.LBB406
+	.byte	0x4
+	.uleb128 .LBB406-.LBB406
+	.uleb128 .LBE406-.LBB406
+	.byte	0x4
+	.uleb128 .LBB411-.LBB406
+	.uleb128 .LBE411-.LBB406
+	.byte	0
+.LLRL52:
+	.byte	0x5
+	.quad	.LBB414
+	.byte	0x4
+	.uleb128 .LBB414-.LBB414
+	.uleb128 .LBE414-.LBB414
+	.byte	0x4
+	.uleb128 .LBB426-.LBB414
+	.uleb128 .LBE426-.LBB414
+	.byte	0
+.LLRL54:
+	.byte	0x5
+	.quad	.LBB416
+	.byte	0x4
+	.uleb128 .LBB416-.LBB416
+	.uleb128 .LBE416-.LBB416
+	.byte	0x4
+	.uleb128 .LBB421-.LBB416
+	.uleb128 .LBE421-.LBB416
+	.byte	0
+.LLRL55:
+	.byte	0x5
+	.quad	.LBB441
+	.byte	0x4
+	.uleb128 .LBB441-.LBB441
+	.uleb128 .LBE441-.LBB441
+	.byte	0x4
+	.uleb128 .LBB444-.LBB441
+	.uleb128 .LBE444-.LBB441
+	.byte	0
+.LLRL56:
+	.byte	0x5
+	.quad	.LBB445
+	.byte	0x4
+	.uleb128 .LBB445-.LBB445
+	.uleb128 .LBE445-.LBB445
+	.byte	0x4
+	.uleb128 .LBB463-.LBB445
+	.uleb128 .LBE463-.LBB445
+	.byte	0
+.LLRL57:
+	.byte	0x5
+	.quad	.LBB448
+	.byte	0x4
+	.uleb128 .LBB448-.LBB448
+	.uleb128 .LBE448-.LBB448
+	.byte	0x4
+	.uleb128 .LBB464-.LBB448
+	.uleb128 .LBE464-.LBB448
+	.byte	0
+.LLRL58:
+	.byte	0x5
+	.quad	.LBB451
+	.byte	0x4
+	.uleb128 .LBB451-.LBB451
+	.uleb128 .LBE451-.LBB451
+	.byte	0x4
+	.uleb128 .LBB465-.LBB451
+	.uleb128 .LBE465-.LBB451
+	.byte	0
+.LLRL59:
+	.byte	0x5
+	.quad	.LBB454
+	.byte	0x4
+	.uleb128 .LBB454-.LBB454
+	.uleb128 .LBE454-.LBB454
+	.byte	0x4
+	.uleb128 .LBB466-.LBB454
+	.uleb128 .LBE466-.LBB454
+	.byte	0
+.LLRL60:
+	.byte	0x5
+	.quad	.LBB457
+	.byte	0x4
+	.uleb128 .LBB457-.LBB457
+	.uleb128 .LBE457-.LBB457
+	.byte	0x4
+	.uleb128 .LBB467-.LBB457
+	.uleb128 .LBE467-.LBB457
+	.byte	0
+.LLRL61:
+	.byte	0x5
+	.quad	.LBB460
+	.byte	0x4
+	.uleb128 .LBB460-.LBB460
+	.uleb128 .LBE460-.LBB460
+	.byte	0x4
+	.uleb128 .LBB468-.LBB460
+	.uleb128 .LBE468-.LBB460
+	.byte	0
+.LLRL62:
+	.byte	0x5
+	.quad	.LBB491
+	.byte	0x4
+	.uleb128 .LBB491-.LBB491
+	.uleb128 .LBE491-.LBB491
+	.byte	0x4
+	.uleb128 .LBB520-.LBB491
+	.uleb128 .LBE520-.LBB491
+	.byte	0x4
+	.uleb128 .LBB521-.LBB491
+	.uleb128 .LBE521-.LBB491
+	.byte	0
+.LLRL64:
+	.byte	0x5
+	.quad	.LBB493
+	.byte	0x4
+	.uleb128 .LBB493-.LBB493
+	.uleb128 .LBE493-.LBB493
+	.byte	0x4
+	.uleb128 .LBB498-.LBB493
+	.uleb128 .LBE498-.LBB493
+	.byte	0
+.LLRL65:
+	.byte	0x5
+	.quad	.LBB501
+	.byte	0x4
+	.uleb128 .LBB501-.LBB501
+	.uleb128 .LBE501-.LBB501
+	.byte	0x4
+	.uleb128 .LBB522-.LBB501
+	.uleb128 .LBE522-.LBB501
+	.byte	0x4
+	.uleb128 .LBB523-.LBB501
+	.uleb128 .LBE523-.LBB501
+	.byte	0
+.LLRL67:
+	.byte	0x5
+	.quad	.LBB503
+	.byte	0x4
+	.uleb128 .LBB503-.LBB503
+	.uleb128 .LBE503-.LBB503
+	.byte	0x4
+	.uleb128 .LBB508-.LBB503
+	.uleb128 .LBE508-.LBB503
+	.byte	0
+.LLRL68:
+	.byte	0x5
+	.quad	.LBB511
+	.byte	0x4
+	.uleb128 .LBB511-.LBB511
+	.uleb128 .LBE511-.LBB511
+	.byte	0x4
+	.uleb128 .LBB524-.LBB511
+	.uleb128 .LBE524-.LBB511
+	.byte	0
+.LLRL70:
+	.byte	0x5
+	.quad	.LBB513
+	.byte	0x4
+	.uleb128 .LBB513-.LBB513
+	.uleb128 .LBE513-.LBB513
+	.byte	0x4
+	.uleb128 .LBB518-.LBB513
+	.uleb128 .LBE518-.LBB513
+	.byte	0
+.LLRL74:
+	.byte	0x5
+	.quad	.LBB539
+	.byte	0x4
+	.uleb128 .LBB539-.LBB539
+	.uleb128 .LBE539-.LBB539
+	.byte	0x4
+	.uleb128 .LBB549-.LBB539
+	.uleb128 .LBE549-.LBB539
+	.byte	0x4
+	.uleb128 .LBB560-.LBB539
+	.uleb128 .LBE560-.LBB539
+	.byte	0x4
+	.uleb128 .LBB561-.LBB539
+	.uleb128 .LBE561-.LBB539
+	.byte	0x4
+	.uleb128 .LBB564-.LBB539
+	.uleb128 .LBE564-.LBB539
+	.byte	0
+.LLRL75:
+	.byte	0x5
+	.quad	.LBB545
+	.byte	0x4
+	.uleb128 .LBB545-.LBB545
+	.uleb128 .LBE545-.LBB545
+	.byte	0x4
+	.uleb128 .LBB550-.LBB545
+	.uleb128 .LBE550-.LBB545
+	.byte	0x4
+	.uleb128 .LBB551-.LBB545
+	.uleb128 .LBE551-.LBB545
+	.byte	0
+.LLRL79:
+	.byte	0x5
+	.quad	.LBB554
+	.byte	0x4
+	.uleb128 .LBB554-.LBB554
+	.uleb128 .LBE554-.LBB554
+	.byte	0x4
+	.uleb128 .LBB562-.LBB554
+	.uleb128 .LBE562-.LBB554
+	.byte	0
+.LLRL80:
+	.byte	0x5
+	.quad	.LBB557
+	.byte	0x4
+	.uleb128 .LBB557-.LBB557
+	.uleb128 .LBE557-.LBB557
+	.byte	0x4
+	.uleb128 .LBB563-.LBB557
+	.uleb128 .LBE563-.LBB557
+	.byte	0
+.LLRL81:
+	.byte	0x5
+	.quad	.LBB629
+	.byte	0x4
+	.uleb128 .LBB629-.LBB629
+	.uleb128 .LBE629-.LBB629
+	.byte	0x4
+	.uleb128 .LBB874-.LBB629
+	.uleb128 .LBE874-.LBB629
+	.byte	0x4
+	.uleb128 .LBB907-.LBB629
+	.uleb128 .LBE907-.LBB629
+	.byte	0
+.LLRL82:
+	.byte	0x5
+	.quad	.LBB633
+	.byte	0x4
+	.uleb128 .LBB633-.LBB633
+	.uleb128 .LBE633-.LBB633
+	.byte	0x4
+	.uleb128 .LBB636-.LBB633
+	.uleb128 .LBE636-.LBB633
+	.byte	0
+.LLRL83:
+	.byte	0x5
+	.quad	.LBB639
+	.byte	0x4
+	.uleb128 .LBB639-.LBB639
+	.uleb128 .LBE639-.LBB639
+	.byte	0x4
+	.uleb128 .LBB875-.LBB639
+	.uleb128 .LBE875-.LBB639
+	.byte	0x4
+	.uleb128 .LBB905-.LBB639
+	.uleb128 .LBE905-.LBB639
+	.byte	0x4
+	.uleb128 .LBB908-.LBB639
+	.uleb128 .LBE908-.LBB639
+	.byte	0
+.LLRL85:
+	.byte	0x5
+	.quad	.LBB641
+	.byte	0x4
+	.uleb128 .LBB641-.LBB641
+	.uleb128 .LBE641-.LBB641
+	.byte	0x4
+	.uleb128 .LBB648-.LBB641
+	.uleb128 .LBE648-.LBB641
+	.byte	0
+.LLRL86:
+	.byte	0x5
+	.quad	.LBB644
+	.byte	0x4
+	.uleb128 .LBB644-.LBB644
+	.uleb128 .LBE644-.LBB644
+	.byte	0x4
+	.uleb128 .LBB649-.LBB644
+	.uleb128 .LBE649-.LBB644
+	.byte	0x4
+	.uleb128 .LBB650-.LBB644
+	.uleb128 .LBE650-.LBB644
+	.byte	0
+.LLRL87:
+	.byte	0x5
+	.quad	.LBB654
+	.byte	0x4
+	.uleb128 .LBB654-.LBB654
+	.uleb128 .LBE654-.LBB654
+	.byte	0x4
+	.uleb128 .LBB876-.LBB654
+	.uleb128 .LBE876-.LBB654
+	.byte	0x4
+	.uleb128 .LBB886-.LBB654
+	.uleb128 .LBE886-.LBB654
+	.byte	0x4
+	.uleb128 .LBB904-.LBB654
+	.uleb128 .LBE904-.LBB654
+	.byte	0x4
+	.uleb128 .LBB906-.LBB654
+	.uleb128 .LBE906-.LBB654
+	.byte	0x4
+	.uleb128 .LBB909-.LBB654
+	.uleb128 .LBE909-.LBB654
+	.byte	0
+.LLRL89:
+	.byte	0x5
+	.quad	.LBB656
+	.byte	0x4
+	.uleb128 .LBB656-.LBB656
+	.uleb128 .LBE656-.LBB656
+	.byte	0x4
+	.uleb128 .LBB665-.LBB656
+	.uleb128 .LBE665-.LBB656
+	.byte	0x4
+	.uleb128 .LBB666-.LBB656
+	.uleb128 .LBE666-.LBB656
+	.byte	0x4
+	.uleb128 .LBB668-.LBB656
+	.uleb128 .LBE668-.LBB656
+	.byte	0x4
+	.uleb128 .LBB669-.LBB656
+	.uleb128 .LBE669-.LBB656
+	.byte	0
+.LLRL90:
+	.byte	0x5
+	.quad	.LBB662
+	.byte	0x4
+	.uleb128 .LBB662-.LBB662
+	.uleb128 .LBE662-.LBB662
+	.byte	0x4
+	.uleb128 .LBB667-.LBB662
+	.uleb128 .LBE667-.LBB662
+	.byte	0
+.LLRL91:
+	.byte	0x5
+	.quad	.LBB675
+	.byte	0x4
+	.uleb128 .LBB675-.LBB675
+	.uleb128 .LBE675-.LBB675
+	.byte	0x4
+	.uleb128 .LBB877-.LBB675
+	.uleb128 .LBE877-.LBB675
+	.byte	0x4
+	.uleb128 .LBB887-.LBB675
+	.uleb128 .LBE887-.LBB675
+	.byte	0x4
+	.uleb128 .LBB915-.LBB675
+	.uleb128 .LBE915-.LBB675
+	.byte	0
+.LLRL93:
+	.byte	0x5
+	.quad	.LBB677
+	.byte	0x4
+	.uleb128 .LBB677-.LBB677
+	.uleb128 .LBE677-.LBB677
+	.byte	0x4
+	.uleb128 .LBB682-.LBB677
+	.uleb128 .LBE682-.LBB677
+	.byte	0
+.LLRL94:
+	.byte	0x5
+	.quad	.LBB686
+	.byte	0x4
+	.uleb128 .LBB686-.LBB686
+	.uleb128 .LBE686-.LBB686
+	.byte	0x4
+	.uleb128 .LBB878-.LBB686
+	.uleb128 .LBE878-.LBB686
+	.byte	0x4
+	.uleb128 .LBB888-.LBB686
+	.uleb128 .LBE888-.LBB686
+	.byte	0x4
+	.uleb128 .LBB897-.LBB686
+	.uleb128 .LBE897-.LBB686
+	.byte	0x4
+	.uleb128 .LBB910-.LBB686
+	.uleb128 .LBE910-.LBB686
+	.byte	0x4
+	.uleb128 .LBB916-.LBB686
+	.uleb128 .LBE916-.LBB686
+	.byte	0
+.LLRL96:
+	.byte	0x5
+	.quad	.LBB688
+	.byte	0x4
+	.uleb128 .LBB688-.LBB688
+	.uleb128 .LBE688-.LBB688
+	.byte	0x4
+	.uleb128 .LBB695-.LBB688
+	.uleb128 .LBE695-.LBB688
+	.byte	0x4
+	.uleb128 .LBB696-.LBB688
+	.uleb128 .LBE696-.LBB688
+	.byte	0x4
+	.uleb128 .LBB697-.LBB688
+	.uleb128 .LBE697-.LBB688
+	.byte	0
+.LLRL97:
+	.byte	0x5
+	.quad	.LBB703
+	.byte	0x4
+	.uleb128 .LBB703-.LBB703
+	.uleb128 .LBE703-.LBB703
+	.byte	0x4
+	.uleb128 .LBB879-.LBB703
+	.uleb128 .LBE879-.LBB703
+	.byte	0x4
+	.uleb128 .LBB889-.LBB703
+	.uleb128 .LBE889-.LBB703
+	.byte	0x4
+	.uleb128 .LBB893-.LBB703
+	.uleb128 .LBE893-.LBB703
+	.byte	0x4
+	.uleb128 .LBB898-.LBB703
+	.uleb128 .LBE898-.LBB703
+	.byte	0x4
+	.uleb128 .LBB911-.LBB703
+	.uleb128 .LBE911-.LBB703
+	.byte	0x4
+	.uleb128 .LBB917-.LBB703
+	.uleb128 .LBE917-.LBB703
+	.byte	0
+.LLRL98:
+	.byte	0x5
+	.quad	.LBB705
+	.byte	0x4
+	.uleb128 .LBB705-.LBB705
+	.uleb128 .LBE705-.LBB705
+	.byte	0x4
+	.uleb128 .LBB715-.LBB705
+	.uleb128 .LBE715-.LBB705
+	.byte	0x4
+	.uleb128 .LBB716-.LBB705
+	.uleb128 .LBE716-.LBB705
+	.byte	0x4
+	.uleb128 .LBB718-.LBB705
+	.uleb128 .LBE718-.LBB705
+	.byte	0x4
+	.uleb128 .LBB719-.LBB705
+	.uleb128 .LBE719-.LBB705
+	.byte	0x4
+	.uleb128 .LBB720-.LBB705
+	.uleb128 .LBE720-.LBB705
+	.byte	0
+.LLRL99:
+	.byte	0x5
+	.quad	.LBB712
+	.byte	0x4
+	.uleb128 .LBB712-.LBB712
+	.uleb128 .LBE712-.LBB712
+	.byte	0x4
+	.uleb128 .LBB717-.LBB712
+	.uleb128 .LBE717-.LBB712
+	.byte	0
+.LLRL100:
+	.byte	0x5
+	.quad	.LBB727
+	.byte	0x4
+	.uleb128 .LBB727-.LBB727
+	.uleb128 .LBE727-.LBB727
+	.byte	0x4
+	.uleb128 .LBB880-.LBB727
+	.uleb128 .LBE880-.LBB727
+	.byte	0x4
+	.uleb128 .LBB890-.LBB727
+	.uleb128 .LBE890-.LBB727
+	.byte	0x4
+	.uleb128 .LBB894-.LBB727
+	.uleb128 .LBE894-.LBB727
+	.byte	0x4
+	.uleb128 .LBB899-.LBB727
+	.uleb128 .LBE899-.LBB727
+	.byte	0x4
+	.uleb128 .LBB912-.LBB727
+	.uleb128 .LBE912-.LBB727
+	.byte	0x4
+	.uleb128 .LBB918-.LBB727
+	.uleb128 .LBE918-.LBB727
+	.byte	0
+.LLRL101:
+	.byte	0x5
+	.quad	.LBB729
+	.byte	0x4
+	.uleb128 .LBB729-.LBB729
+	.uleb128 .LBE729-.LBB729
+	.byte	0x4
+	.uleb128 .LBB799-.LBB729
+	.uleb128 .LBE799-.LBB729
+	.byte	0x4
+	.uleb128 .LBB801-.LBB729
+	.uleb128 .LBE801-.LBB729
+	.byte	0x4
+	.uleb128 .LBB803-.LBB729
+	.uleb128 .LBE803-.LBB729
+	.byte	0x4
+	.uleb128 .LBB805-.LBB729
+	.uleb128 .LBE805-.LBB729
+	.byte	0x4
+	.uleb128 .LBB807-.LBB729
+	.uleb128 .LBE807-.LBB729
+	.byte	0x4
+	.uleb128 .LBB809-.LBB729
+	.uleb128 .LBE809-.LBB729
+	.byte	0
+.LLRL102:
+	.byte	0x5
+	.quad	.LBB731
+	.byte	0x4
+	.uleb128 .LBB731-.LBB731
+	.uleb128 .LBE731-.LBB731
+	.byte	0x4
+	.uleb128 .LBB746-.LBB731
+	.uleb128 .LBE746-.LBB731
+	.byte	0x4
+	.uleb128 .LBB748-.LBB731
+	.uleb128 .LBE748-.LBB731
+	.byte	0x4
+	.uleb128 .LBB751-.LBB731
+	.uleb128 .LBE751-.LBB731
+	.byte	0x4
+	.uleb128 .LBB753-.LBB731
+	.uleb128 .LBE753-.LBB731
+	.byte	0x4
+	.uleb128 .LBB755-.LBB731
+	.uleb128 .LBE755-.LBB731
+	.byte	0
+.LLRL103:
+	.byte	0x5
+	.quad	.LBB738
+	.byte	0x4
+	.uleb128 .LBB738-.LBB738
+	.uleb128 .LBE738-.LBB738
+	.byte	0x4
+	.uleb128 .LBB747-.LBB738
+	.uleb128 .LBE747-.LBB738
+	.byte	0x4
+	.uleb128 .LBB749-.LBB738
+	.uleb128 .LBE749-.LBB738
+	.byte	0x4
+	.uleb128 .LBB750-.LBB738
+	.uleb128 .LBE750-.LBB738
+	.byte	0x4
+	.uleb128 .LBB752-.LBB738
+	.uleb128 .LBE752-.LBB738
+	.byte	0x4
+	.uleb128 .LBB754-.LBB738
+	.uleb128 .LBE754-.LBB738
+	.byte	0x4
+	.uleb128 .LBB756-.LBB738
+	.uleb128 .LBE756-.LBB738
+	.byte	0
+.LLRL104:
+	.byte	0x5
+	.quad	.LBB763
+	.byte	0x4
+	.uleb128 .LBB763-.LBB763
+	.uleb128 .LBE763-.LBB763
+	.byte	0x4
+	.uleb128 .LBB800-.LBB763
+	.uleb128 .LBE800-.LBB763
+	.byte	0x4
+	.uleb128 .LBB802-.LBB763
+	.uleb128 .LBE802-.LBB763
+	.byte	0x4
+	.uleb128 .LBB804-.LBB763
+	.uleb128 .LBE804-.LBB763
+	.byte	0x4
+	.uleb128 .LBB806-.LBB763
+	.uleb128 .LBE806-.LBB763
+	.byte	0x4
+	.uleb128 .LBB808-.LBB763
+	.uleb128 .LBE808-.LBB763
+	.byte	0x4
+	.uleb128 .LBB810-.LBB763
+	.uleb128 .LBE810-.LBB763
+	.byte	0
+.LLRL105:
+	.byte	0x5
+	.quad	.LBB765
+	.byte	0x4
+	.uleb128 .LBB765-.LBB765
+	.uleb128 .LBE765-.LBB765
+	.byte	0x4
+	.uleb128 .LBB781-.LBB765
+	.uleb128 .LBE781-.LBB765
+	.byte	0x4
+	.uleb128 .LBB783-.LBB765
+	.uleb128 .LBE783-.LBB765
+	.byte	0x4
+	.uleb128 .LBB785-.LBB765
+	.uleb128 .LBE785-.LBB765
+	.byte	0x4
+	.uleb128 .LBB787-.LBB765
+	.uleb128 .LBE787-.LBB765
+	.byte	0x4
+	.uleb128 .LBB789-.LBB765
+	.uleb128 .LBE789-.LBB765
+	.byte	0x4
+	.uleb128 .LBB791-.LBB765
+	.uleb128 .LBE791-.LBB765
+	.byte	0
+.LLRL106:
+	.byte	0x5
+	.quad	.LBB773
+	.byte	0x4
+	.uleb128 .LBB773-.LBB773
+	.uleb128 .LBE773-.LBB773
+	.byte	0x4
+	.uleb128 .LBB782-.LBB773
+	.uleb128 .LBE782-.LBB773
+	.byte	0x4
+	.uleb128 .LBB784-.LBB773
+	.uleb128 .LBE784-.LBB773
+	.byte	0x4
+	.uleb128 .LBB786-.LBB773
+	.uleb128 .LBE786-.LBB773
+	.byte	0x4
+	.uleb128 .LBB788-.LBB773
+	.uleb128 .LBE788-.LBB773
+	.byte	0x4
+	.uleb128 .LBB790-.LBB773
+	.uleb128 .LBE790-.LBB773
+	.byte	0x4
+	.uleb128 .LBB792-.LBB773
+	.uleb128 .LBE792-.LBB773
+	.byte	0
+.LLRL107:
+	.byte	0x5
+	.quad	.LBB817
+	.byte	0x4
+	.uleb128 .LBB817-.LBB817
+	.uleb128 .LBE817-.LBB817
+	.byte	0x4
+	.uleb128 .LBB855-.LBB817
+	.uleb128 .LBE855-.LBB817
+	.byte	0x4
+	.uleb128 .LBB881-.LBB817
+	.uleb128 .LBE881-.LBB817
+	.byte	0x4
+	.uleb128 .LBB891-.LBB817
+	.uleb128 .LBE891-.LBB817
+	.byte	0x4
+	.uleb128 .LBB895-.LBB817
+	.uleb128 .LBE895-.LBB817
+	.byte	0x4
+	.uleb128 .LBB900-.LBB817
+	.uleb128 .LBE900-.LBB817
+	.byte	0x4
+	.uleb128 .LBB902-.LBB817
+	.uleb128 .LBE902-.LBB817
+	.byte	0x4
+	.uleb128 .LBB913-.LBB817
+	.uleb128 .LBE913-.LBB817
+	.byte	0x4
+	.uleb128 .LBB919-.LBB817
+	.uleb128 .LBE919-.LBB817
+	.byte	0
+.LLRL109:
+	.byte	0x5
+	.quad	.LBB819
+	.byte	0x4
+	.uleb128 .LBB819-.LBB819
+	.uleb128 .LBE819-.LBB819
+	.byte	0x4
+	.uleb128 .LBB835-.LBB819
+	.uleb128 .LBE835-.LBB819
+	.byte	0x4
+	.uleb128 .LBB837-.LBB819
+	.uleb128 .LBE837-.LBB819
+	.byte	0x4
+	.uleb128 .LBB839-.LBB819
+	.uleb128 .LBE839-.LBB819
+	.byte	0x4
+	.uleb128 .LBB841-.LBB819
+	.uleb128 .LBE841-.LBB819
+	.byte	0x4
+	.uleb128 .LBB843-.LBB819
+	.uleb128 .LBE843-.LBB819
+	.byte	0x4
+	.uleb128 .LBB845-.LBB819
+	.uleb128 .LBE845-.LBB819
+	.byte	0
+.LLRL110:
+	.byte	0x5
+	.quad	.LBB827
+	.byte	0x4
+	.uleb128 .LBB827-.LBB827
+	.uleb128 .LBE827-.LBB827
+	.byte	0x4
+	.uleb128 .LBB836-.LBB827
+	.uleb128 .LBE836-.LBB827
+	.byte	0x4
+	.uleb128 .LBB838-.LBB827
+	.uleb128 .LBE838-.LBB827
+	.byte	0x4
+	.uleb128 .LBB840-.LBB827
+	.uleb128 .LBE840-.LBB827
+	.byte	0x4
+	.uleb128 .LBB842-.LBB827
+	.uleb128 .LBE842-.LBB827
+	.byte	0x4
+	.uleb128 .LBB844-.LBB827
+	.uleb128 .LBE844-.LBB827
+	.byte	0x4
+	.uleb128 .LBB846-.LBB827
+	.uleb128 .LBE846-.LBB827
+	.byte	0
+.LLRL111:
+	.byte	0x5
+	.quad	.LBB856
+	.byte	0x4
+	.uleb128 .LBB856-.LBB856
+	.uleb128 .LBE856-.LBB856
+	.byte	0x4
+	.uleb128 .LBB882-.LBB856
+	.uleb128 .LBE882-.LBB856
+	.byte	0x4
+	.uleb128 .LBB892-.LBB856
+	.uleb128 .LBE892-.LBB856
+	.byte	0x4
+	.uleb128 .LBB896-.LBB856
+	.uleb128 .LBE896-.LBB856
+	.byte	0x4
+	.uleb128 .LBB901-.LBB856
+	.uleb128 .LBE901-.LBB856
+	.byte	0x4
+	.uleb128 .LBB903-.LBB856
+	.uleb128 .LBE903-.LBB856
+	.byte	0x4
+	.uleb128 .LBB914-.LBB856
+	.uleb128 .LBE914-.LBB856
+	.byte	0x4
+	.uleb128 .LBB920-.LBB856
+	.uleb128 .LBE920-.LBB856
+	.byte	0
+.LLRL112:
+	.byte	0x5
+	.quad	.LBB865
+	.byte	0x4
+	.uleb128 .LBB865-.LBB865
+	.uleb128 .LBE865-.LBB865
+	.byte	0x4
+	.uleb128 .LBB883-.LBB865
+	.uleb128 .LBE883-.LBB865
+	.byte	0
+.LLRL113:
+	.byte	0x5
+	.quad	.LBB868
+	.byte	0x4
+	.uleb128 .LBB868-.LBB868
+	.uleb128 .LBE868-.LBB868
+	.byte	0x4
+	.uleb128 .LBB884-.LBB868
+	.uleb128 .LBE884-.LBB868
+	.byte	0
+.LLRL114:
+	.byte	0x5
+	.quad	.LBB871
+	.byte	0x4
+	.uleb128 .LBB871-.LBB871
+	.uleb128 .LBE871-.LBB871
+	.byte	0x4
+	.uleb128 .LBB885-.LBB871
+	.uleb128 .LBE885-.LBB871
+	.byte	0
+.LLRL116:
+	.byte	0x5
+	.quad	.LBB945
+	.byte	0x4
+	.uleb128 .LBB945-.LBB945
+	.uleb128 .LBE945-.LBB945
+	.byte	0x4
+	.uleb128 .LBB955-.LBB945
+	.uleb128 .LBE955-.LBB945
+	.byte	0x4
+	.uleb128 .LBB970-.LBB945
+	.uleb128 .LBE970-.LBB945
+	.byte	0x4
+	.uleb128 .LBB971-.LBB945
+	.uleb128 .LBE971-.LBB945
+	.byte	0
+.LLRL117:
+	.byte	0x5
+	.quad	.LBB950
+	.byte	0x4
+	.uleb128 .LBB950-.LBB950
+	.uleb128 .LBE950-.LBB950
+	.byte	0x4
+	.uleb128 .LBB956-.LBB950
+	.uleb128 .LBE956-.LBB950
+	.byte	0x4
+	.uleb128 .LBB957-.LBB950
+	.uleb128 .LBE957-.LBB950
+	.byte	0x4
+	.uleb128 .LBB966-.LBB950
+	.uleb128 .LBE966-.LBB950
+	.byte	0
+.LLRL118:
+	.byte	0x5
+	.quad	.LBB958
+	.byte	0x4
+	.uleb128 .LBB958-.LBB958
+	.uleb128 .LBE958-.LBB958
+	.byte	0x4
+	.uleb128 .LBB967-.LBB958
+	.uleb128 .LBE967-.LBB958
+	.byte	0
+.LLRL119:
+	.byte	0x5
+	.quad	.LBB961
+	.byte	0x4
+	.uleb128 .LBB961-.LBB961
+	.uleb128 .LBE961-.LBB961
+	.byte	0x4
+	.uleb128 .LBB968-.LBB961
+	.uleb128 .LBE968-.LBB961
+	.byte	0x4
+	.uleb128 .LBB969-.LBB961
+	.uleb128 .LBE969-.LBB961
+	.byte	0x4
+	.uleb128 .LBB1014-.LBB961
+	.uleb128 .LBE1014-.LBB961
+	.byte	0
+.LLRL120:
+	.byte	0x5
+	.quad	.LBB972
+	.byte	0x4
+	.uleb128 .LBB972-.LBB972
+	.uleb128 .LBE972-.LBB972
+	.byte	0x4
+	.uleb128 .LBB977-.LBB972
+	.uleb128 .LBE977-.LBB972
+	.byte	0x4
+	.uleb128 .LBB1010-.LBB972
+	.uleb128 .LBE1010-.LBB972
+	.byte	0x4
+	.uleb128 .LBB1015-.LBB972
+	.uleb128 .LBE1015-.LBB972
+	.byte	0
+.LLRL121:
+	.byte	0x5
+	.quad	.LBB978
+	.byte	0x4
+	.uleb128 .LBB978-.LBB978
+	.uleb128 .LBE978-.LBB978
+	.byte	0x4
+	.uleb128 .LBB983-.LBB978
+	.uleb128 .LBE983-.LBB978
+	.byte	0x4
+	.uleb128 .LBB1011-.LBB978
+	.uleb128 .LBE1011-.LBB978
+	.byte	0x4
+	.uleb128 .LBB1016-.LBB978
+	.uleb128 .LBE1016-.LBB978
+	.byte	0
+.LLRL122:
+	.byte	0x5
+	.quad	.LBB984
+	.byte	0x4
+	.uleb128 .LBB984-.LBB984
+	.uleb128 .LBE984-.LBB984
+	.byte	0x4
+	.uleb128 .LBB997-.LBB984
+	.uleb128 .LBE997-.LBB984
+	.byte	0
+.LLRL123:
+	.byte	0x5
+	.quad	.LBB987
+	.byte	0x4
+	.uleb128 .LBB987-.LBB987
+	.uleb128 .LBE987-.LBB987
+	.byte	0x4
+	.uleb128 .LBB998-.LBB987
+	.uleb128 .LBE998-.LBB987
+	.byte	0
+.LLRL124:
+	.byte	0x5
+	.quad	.LBB990
+	.byte	0x4
+	.uleb128 .LBB990-.LBB990
+	.uleb128 .LBE990-.LBB990
+	.byte	0x4
+	.uleb128 .LBB999-.LBB990
+	.uleb128 .LBE999-.LBB990
+	.byte	0
+.LLRL125:
+	.byte	0x5
+	.quad	.LBB993
+	.byte	0x4
+	.uleb128 .LBB993-.LBB993
+	.uleb128 .LBE993-.LBB993
+	.byte	0x4
+	.uleb128 .LBB1000-.LBB993
+	.uleb128 .LBE1000-.LBB993
+	.byte	0x4
+	.uleb128 .LBB1001-.LBB993
+	.uleb128 .LBE1001-.LBB993
+	.byte	0
+.LLRL126:
+	.byte	0x5
+	.quad	.LBB1002
+	.byte	0x4
+	.uleb128 .LBB1002-.LBB1002
+	.uleb128 .LBE1002-.LBB1002
+	.byte	0x4
+	.uleb128 .LBB1006-.LBB1002
+	.uleb128 .LBE1006-.LBB1002
+	.byte	0x4
+	.uleb128 .LBB1012-.LBB1002
+	.uleb128 .LBE1012-.LBB1002
+	.byte	0
+.LLRL127:
+	.byte	0x5
+	.quad	.LBB1007
+	.byte	0x4
+	.uleb128 .LBB1007-.LBB1007
+	.uleb128 .LBE1007-.LBB1007
+	.byte	0x4
+	.uleb128 .LBB1013-.LBB1007
+	.uleb128 .LBE1013-.LBB1007
+	.byte	0
+.LLRL129:
+	.byte	0x5
+	.quad	.LBB1019
+	.byte	0x4
+	.uleb128 .LBB1019-.LBB1019
+	.uleb128 .LBE1019-.LBB1019
+	.byte	0x4
+	.uleb128 .LBB1022-.LBB1019
+	.uleb128 .LBE1022-.LBB1019
+	.byte	0
+.LLRL132:
+	.byte	0x5
+	.quad	.LBB1027
+	.byte	0x4
+	.uleb128 .LBB1027-.LBB1027
+	.uleb128 .LBE1027-.LBB1027
+	.byte	0x4
+	.uleb128 .LBB1031-.LBB1027
+	.uleb128 .LBE1031-.LBB1027
+	.byte	0x4
+	.uleb128 .LBB1032-.LBB1027
+	.uleb128 .LBE1032-.LBB1027
+	.byte	0
+.LLRL134:
+	.byte	0x5
+	.quad	.LBB1033
+	.byte	0x4
+	.uleb128 .LBB1033-.LBB1033
+	.uleb128 .LBE1033-.LBB1033
+	.byte	0x4
+	.uleb128 .LBB1036-.LBB1033
+	.uleb128 .LBE1036-.LBB1033
+	.byte	0
+.LLRL139:
+	.byte	0x5
+	.quad	.LBB1063
+	.byte	0x4
+	.uleb128 .LBB1063-.LBB1063
+	.uleb128 .LBE1063-.LBB1063
+	.byte	0x4
+	.uleb128 .LBB1070-.LBB1063
+	.uleb128 .LBE1070-.LBB1063
+	.byte	0
+.LLRL143:
+	.byte	0x5
+	.quad	.LBB1085
+	.byte	0x4
+	.uleb128 .LBB1085-.LBB1085
+	.uleb128 .LBE1085-.LBB1085
+	.byte	0x4
+	.uleb128 .LBB1102-.LBB1085
+	.uleb128 .LBE1102-.LBB1085
+	.byte	0x4
+	.uleb128 .LBB1103-.LBB1085
+	.uleb128 .LBE1103-.LBB1085
+	.byte	0x4
+	.uleb128 .LBB1104-.LBB1085
+	.uleb128 .LBE1104-.LBB1085
+	.byte	0
+.LLRL148:
+	.byte	0x5
+	.quad	.LBB1091
+	.byte	0x4
+	.uleb128 .LBB1091-.LBB1091
+	.uleb128 .LBE1091-.LBB1091
+	.byte	0x4
+	.uleb128 .LBB1096-.LBB1091
+	.uleb128 .LBE1096-.LBB1091
+	.byte	0x4
+	.uleb128 .LBB1097-.LBB1091
+	.uleb128 .LBE1097-.LBB1091
+	.byte	0x4
+	.uleb128 .LBB1098-.LBB1091
+	.uleb128 .LBE1098-.LBB1091
+	.byte	0
+.LLRL157:
+	.byte	0x5
+	.quad	.LBB1117
+	.byte	0x4
+	.uleb128 .LBB1117-.LBB1117
+	.uleb128 .LBE1117-.LBB1117
+	.byte	0x4
+	.uleb128 .LBB1129-.LBB1117
+	.uleb128 .LBE1129-.LBB1117
+	.byte	0x4
+	.uleb128 .LBB1130-.LBB1117
+	.uleb128 .LBE1130-.LBB1117
+	.byte	0
+.LLRL159:
+	.byte	0x5
+	.quad	.LBB1119
+	.byte	0x4
+	.uleb128 .LBB1119-.LBB1119
+	.uleb128 .LBE1119-.LBB1119
+	.byte	0x4
+	.uleb128 .LBB1123-.LBB1119
+	.uleb128 .LBE1123-.LBB1119
+	.byte	0x4
+	.uleb128 .LBB1124-.LBB1119
+	.uleb128 .LBE1124-.LBB1119
+	.byte	0
+.LLRL160:
+	.byte	0x5
+	.quad	.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1131-.LBB1131
+	.uleb128 .LBE1131-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1138-.LBB1131
+	.uleb128 .LBE1138-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1139-.LBB1131
+	.uleb128 .LBE1139-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1144-.LBB1131
+	.uleb128 .LBE1144-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1145-.LBB1131
+	.uleb128 .LBE1145-.LBB1131
+	.byte	0x4
+	.uleb128 .LBB1146-.LBB1131
+	.uleb128 .LBE1146-.LBB1131
+	.byte	0
+.LLRL162:
+	.byte	0x5
+	.quad	.LBB1140
+	.byte	0x4
+	.uleb128 .LBB1140-.LBB1140
+	.uleb128 .LBE1140-.LBB1140
+	.byte	0x4
+	.uleb128 .LBB1147-.LBB1140
+	.uleb128 .LBE1147-.LBB1140
+	.byte	0x4
+	.uleb128 .LBB1148-.LBB1140
+	.uleb128 .LBE1148-.LBB1140
+	.byte	0
+.LLRL165:
+	.byte	0x5
+	.quad	.LBB1154
+	.byte	0x4
+	.uleb128 .LBB1154-.LBB1154
+	.uleb128 .LBE1154-.LBB1154
+	.byte	0x4
+	.uleb128 .LBB1161-.LBB1154
+	.uleb128 .LBE1161-.LBB1154
+	.byte	0x4
+	.uleb128 .LBB1162-.LBB1154
+	.uleb128 .LBE1162-.LBB1154
+	.byte	0
+.LLRL172:
+	.byte	0x5
+	.quad	.LBB1167
+	.byte	0x4
+	.uleb128 .LBB1167-.LBB1167
+	.uleb128 .LBE1167-.LBB1167
+	.byte	0x4
+	.uleb128 .LBB1171-.LBB1167
+	.uleb128 .LBE1171-.LBB1167
+	.byte	0x4
+	.uleb128 .LBB1172-.LBB1167
+	.uleb128 .LBE1172-.LBB1167
+	.byte	0
+.LLRL174:
+	.byte	0x5
+	.quad	.LBB1173
+	.byte	0x4
+	.uleb128 .LBB1173-.LBB1173
+	.uleb128 .LBE1173-.LBB1173
+	.byte	0x4
+	.uleb128 .LBB1176-.LBB1173
+	.uleb128 .LBE1176-.LBB1173
+	.byte	0
+.LLRL176:
+	.byte	0x5
+	.quad	.LBB1183
+	.byte	0x4
+	.uleb128 .LBB1183-.LBB1183
+	.uleb128 .LBE1183-.LBB1183
+	.byte	0x4
+	.uleb128 .LBB1186-.LBB1183
+	.uleb128 .LBE1186-.LBB1183
+	.byte	0
+.LLRL180:
+	.byte	0x5
+	.quad	.LBB1211
+	.byte	0x4
+	.uleb128 .LBB1211-.LBB1211
+	.uleb128 .LBE1211-.LBB1211
+	.byte	0x4
+	.uleb128 .LBB1214-.LBB1211
+	.uleb128 .LBE1214-.LBB1211
+	.byte	0
+.LLRL192:
+	.byte	0x5
+	.quad	.LBB1238
+	.byte	0x4
+	.uleb128 .LBB1238-.LBB1238
+	.uleb128 .LBE1238-.LBB1238
+	.byte	0x4
+	.uleb128 .LBB1242-.LBB1238
+	.uleb128 .LBE1242-.LBB1238
+	.byte	0x4
+	.uleb128 .LBB1243-.LBB1238
+	.uleb128 .LBE1243-.LBB1238
+	.byte	0
+.LLRL198:
+	.byte	0x5
+	.quad	.LBB1250
+	.byte	0x4
+	.uleb128 .LBB1250-.LBB1250
+	.uleb128 .LBE1250-.LBB1250
+	.byte	0x4
+	.uleb128 .LBB1253-.LBB1250
+	.uleb128 .LBE1253-.LBB1250
+	.byte	0
+.LLRL200:
+	.byte	0x5
+	.quad	.LBB1276
+	.byte	0x4
+	.uleb128 .LBB1276-.LBB1276
+	.uleb128 .LBE1276-.LBB1276
+	.byte	0x4
+	.uleb128 .LBB1279-.LBB1276
+	.uleb128 .LBE1279-.LBB1276
+	.byte	0
+.LLRL213:
+	.byte	0x5
+	.quad	.LBB1299
+	.byte	0x4
+	.uleb128 .LBB1299-.LBB1299
+	.uleb128 .LBE1299-.LBB1299
+	.byte	0x4
+	.uleb128 .LBB1303-.LBB1299
+	.uleb128 .LBE1303-.LBB1299
+	.byte	0x4
+	.uleb128 .LBB1304-.LBB1299
+	.uleb128 .LBE1304-.LBB1299
+	.byte	0
+.LLRL215:
+	.byte	0x5
+	.quad	.LBB1305
+	.byte	0x4
+	.uleb128 .LBB1305-.LBB1305
+	.uleb128 .LBE1305-.LBB1305
+	.byte	0x4
+	.uleb128 .LBB1308-.LBB1305
+	.uleb128 .LBE1308-.LBB1305
+	.byte	0
+.LLRL217:
+	.byte	0x5
+	.quad	.LBB1319
+	.byte	0x4
+	.uleb128 .LBB1319-.LBB1319
+	.uleb128 .LBE1319-.LBB1319
+	.byte	0x4
+	.uleb128 .LBB1322-.LBB1319
+	.uleb128 .LBE1322-.LBB1319
+	.byte	0
+.LLRL222:
+	.byte	0x5
+	.quad	.LBB1339
+	.byte	0x4
+	.uleb128 .LBB1339-.LBB1339
+	.uleb128 .LBE1339-.LBB1339
+	.byte	0x4
+	.uleb128 .LBB1342-.LBB1339
+	.uleb128 .LBE1342-.LBB1339
+	.byte	0
+.LLRL225:
+	.byte	0x5
+	.quad	.LBB1345
+	.byte	0x4
+	.uleb128 .LBB1345-.LBB1345
+	.uleb128 .LBE1345-.LBB1345
+	.byte	0x4
+	.uleb128 .LBB1348-.LBB1345
+	.uleb128 .LBE1348-.LBB1345
+	.byte	0
+.LLRL230:
+	.byte	0x5
+	.quad	.LBB1359
+	.byte	0x4
+	.uleb128 .LBB1359-.LBB1359
+	.uleb128 .LBE1359-.LBB1359
+	.byte	0x4
+	.uleb128 .LBB1362-.LBB1359
+	.uleb128 .LBE1362-.LBB1359
+	.byte	0
+.LLRL232:
+	.byte	0x5
+	.quad	.LBB1363
+	.byte	0x4
+	.uleb128 .LBB1363-.LBB1363
+	.uleb128 .LBE1363-.LBB1363
+	.byte	0x4
+	.uleb128 .LBB1366-.LBB1363
+	.uleb128 .LBE1366-.LBB1363
+	.byte	0
+.LLRL236:
+	.byte	0x5
+	.quad	.LBB1373
+	.byte	0x4
+	.uleb128 .LBB1373-.LBB1373
+	.uleb128 .LBE1373-.LBB1373
+	.byte	0x4
+	.uleb128 .LBB1377-.LBB1373
+	.uleb128 .LBE1377-.LBB1373
+	.byte	0x4
+	.uleb128 .LBB1378-.LBB1373
+	.uleb128 .LBE1378-.LBB1373
+	.byte	0
+.LLRL237:
+	.byte	0x5
+	.quad	.LBB1379
+	.byte	0x4
+	.uleb128 .LBB1379-.LBB1379
+	.uleb128 .LBE1379-.LBB1379
+	.byte	0x4
+	.uleb128 .LBB1382-.LBB1379
+	.uleb128 .LBE1382-.LBB1379
+	.byte	0
+.LLRL239:
+	.byte	0x5
+	.quad	.LBB1393
+	.byte	0x4
+	.uleb128 .LBB1393-.LBB1393
+	.uleb128 .LBE1393-.LBB1393
+	.byte	0x4
+	.uleb128 .LBB1397-.LBB1393
+	.uleb128 .LBE1397-.LBB1393
+	.byte	0x4
+	.uleb128 .LBB1398-.LBB1393
+	.uleb128 .LBE1398-.LBB1393
+	.byte	0
+.LLRL241:
+	.byte	0x5
+	.quad	.LBB1399
+	.byte	0x4
+	.uleb128 .LBB1399-.LBB1399
+	.uleb128 .LBE1399-.LBB1399
+	.byte	0x4
+	.uleb128 .LBB1402-.LBB1399
+	.uleb128 .LBE1402-.LBB1399
+	.byte	0
+.LLRL243:
+	.byte	0x5
+	.quad	.LBB1403
+	.byte	0x4
+	.uleb128 .LBB1403-.LBB1403
+	.uleb128 .LBE1403-.LBB1403
+	.byte	0x4
+	.uleb128 .LBB1406-.LBB1403
+	.uleb128 .LBE1406-.LBB1403
+	.byte	0
+.LLRL245:
+	.byte	0x5
+	.quad	.LBB1407
+	.byte	0x4
+	.uleb128 .LBB1407-.LBB1407
+	.uleb128 .LBE1407-.LBB1407
+	.byte	0x4
+	.uleb128 .LBB1410-.LBB1407
+	.uleb128 .LBE1410-.LBB1407
+	.byte	0
+.LLRL247:
+	.byte	0x5
+	.quad	.LBB1411
+	.byte	0x4
+	.uleb128 .LBB1411-.LBB1411
+	.uleb128 .LBE1411-.LBB1411
+	.byte	0x4
+	.uleb128 .LBB1414-.LBB1411
+	.uleb128 .LBE1414-.LBB1411
+	.byte	0
+.LLRL252:
+	.byte	0x5
+	.quad	.LBB1430
+	.byte	0x4
+	.uleb128 .LBB1430-.LBB1430
+	.uleb128 .LBE1430-.LBB1430
+	.byte	0x4
+	.uleb128 .LBB1434-.LBB1430
+	.uleb128 .LBE1434-.LBB1430
+	.byte	0x4
+	.uleb128 .LBB1435-.LBB1430
+	.uleb128 .LBE1435-.LBB1430
+	.byte	0
+.LLRL256:
+	.byte	0x5
+	.quad	.LBB1440
+	.byte	0x4
+	.uleb128 .LBB1440-.LBB1440
+	.uleb128 .LBE1440-.LBB1440
+	.byte	0x4
+	.uleb128 .LBB1443-.LBB1440
+	.uleb128 .LBE1443-.LBB1440
+	.byte	0
+.LLRL259:
+	.byte	0x5
+	.quad	.LBB1445
+	.byte	0x4
+	.uleb128 .LBB1445-.LBB1445
+	.uleb128 .LBE1445-.LBB1445
+	.byte	0x4
+	.uleb128 .LBB1454-.LBB1445
+	.uleb128 .LBE1454-.LBB1445
+	.byte	0
+.LLRL260:
+	.byte	0x5
+	.quad	.LBB1447
+	.byte	0x4
+	.uleb128 .LBB1447-.LBB1447
+	.uleb128 .LBE1447-.LBB1447
+	.byte	0x4
+	.uleb128 .LBB1450-.LBB1447
+	.uleb128 .LBE1450-.LBB1447
+	.byte	0
+.LLRL261:
+	.byte	0x5
+	.quad	.LBB1463
+	.byte	0x4
+	.uleb128 .LBB1463-.LBB1463
+	.uleb128 .LBE1463-.LBB1463
+	.byte	0x4
+	.uleb128 .LBB1466-.LBB1463
+	.uleb128 .LBE1466-.LBB1463
+	.byte	0
+.LLRL265:
+	.byte	0x5
+	.quad	.LBB1472
+	.byte	0x4
+	.uleb128 .LBB1472-.LBB1472
+	.uleb128 .LBE1472-.LBB1472
+	.byte	0x4
+	.uleb128 .LBB1476-.LBB1472
+	.uleb128 .LBE1476-.LBB1472
+	.byte	0x4
+	.uleb128 .LBB1477-.LBB1472
+	.uleb128 .LBE1477-.LBB1472
+	.byte	0
+.LLRL268:
+	.byte	0x5
+	.quad	.LBB1512
+	.byte	0x4
+	.uleb128 .LBB1512-.LBB1512
+	.uleb128 .LBE1512-.LBB1512
+	.byte	0x4
+	.uleb128 .LBB1563-.LBB1512
+	.uleb128 .LBE1563-.LBB1512
+	.byte	0
+.LLRL269:
+	.byte	0x5
+	.quad	.LBB1515
+	.byte	0x4
+	.uleb128 .LBB1515-.LBB1515
+	.uleb128 .LBE1515-.LBB1515
+	.byte	0x4
+	.uleb128 .LBB1564-.LBB1515
+	.uleb128 .LBE1564-.LBB1515
+	.byte	0x4
+	.uleb128 .LBB1565-.LBB1515
+	.uleb128 .LBE1565-.LBB1515
+	.byte	0
+.LLRL271:
+	.byte	0x5
+	.quad	.LBB1516
+	.byte	0x4
+	.uleb128 .LBB1516-.LBB1516
+	.uleb128 .LBE1516-.LBB1516
+	.byte	0x4
+	.uleb128 .LBB1519-.LBB1516
+	.uleb128 .LBE1519-.LBB1516
+	.byte	0
+.LLRL275:
+	.byte	0x5
+	.quad	.LBB1524
+	.byte	0x4
+	.uleb128 .LBB1524-.LBB1524
+	.uleb128 .LBE1524-.LBB1524
+	.byte	0x4
+	.uleb128 .LBB1527-.LBB1524
+	.uleb128 .LBE1527-.LBB1524
+	.byte	0
+.LLRL278:
+	.byte	0x5
+	.quad	.LBB1530
+	.byte	0x4
+	.uleb128 .LBB1530-.LBB1530
+	.uleb128 .LBE1530-.LBB1530
+	.byte	0x4
+	.uleb128 .LBB1562-.LBB1530
+	.uleb128 .LBE1562-.LBB1530
+	.byte	0
+.LLRL279:
+	.byte	0x5
+	.quad	.LBB1532
+	.byte	0x4
+	.uleb128 .LBB1532-.LBB1532
+	.uleb128 .LBE1532-.LBB1532
+	.byte	0x4
+	.uleb128 .LBB1538-.LBB1532
+	.uleb128 .LBE1538-.LBB1532
+	.byte	0
+.LLRL280:
+	.byte	0x5
+	.quad	.LBB1535
+	.byte	0x4
+	.uleb128 .LBB1535-.LBB1535
+	.uleb128 .LBE1535-.LBB1535
+	.byte	0x4
+	.uleb128 .LBB1539-.LBB1535
+	.uleb128 .LBE1539-.LBB1535
+	.byte	0
+.LLRL282:
+	.byte	0x5
+	.quad	.LBB1543
+	.byte	0x4
+	.uleb128 .LBB1543-.LBB1543
+	.uleb128 .LBE1543-.LBB1543
+	.byte	0x4
+	.uleb128 .LBB1546-.LBB1543
+	.uleb128 .LBE1546-.LBB1543
+	.byte	0
+.LLRL286:
+	.byte	0x5
+	.quad	.LBB1551
+	.byte	0x4
+	.uleb128 .LBB1551-.LBB1551
+	.uleb128 .LBE1551-.LBB1551
+	.byte	0x4
+	.uleb128 .LBB1554-.LBB1551
+	.uleb128 .LBE1554-.LBB1551
+	.byte	0
+.LLRL290:
+	.byte	0x5
+	.quad	.LBB1558
+	.byte	0x4
+	.uleb128 .LBB1558-.LBB1558
+	.uleb128 .LBE1558-.LBB1558
+	.byte	0x4
+	.uleb128 .LBB1561-.LBB1558
+	.uleb128 .LBE1561-.LBB1558
+	.byte	0
+.LLRL292:
+	.byte	0x5
+	.quad	.LBB1566
+	.byte	0x4
+	.uleb128 .LBB1566-.LBB1566
+	.uleb128 .LBE1566-.LBB1566
+	.byte	0x4
+	.uleb128 .LBB1569-.LBB1566
+	.uleb128 .LBE1569-.LBB1566
+	.byte	0
+.LLRL294:
+	.byte	0x5
+	.quad	.LBB1578
+	.byte	0x4
+	.uleb128 .LBB1578-.LBB1578
+	.uleb128 .LBE1578-.LBB1578
+	.byte	0x4
+	.uleb128 .LBB1581-.LBB1578
+	.uleb128 .LBE1581-.LBB1578
+	.byte	0
+.LLRL299:
+	.byte	0x5
+	.quad	.LBB1588
+	.byte	0x4
+	.uleb128 .LBB1588-.LBB1588
+	.uleb128 .LBE1588-.LBB1588
+	.byte	0x4
+	.uleb128 .LBB1591-.LBB1588
+	.uleb128 .LBE1591-.LBB1588
+	.byte	0
+.LLRL301:
+	.byte	0x5
+	.quad	.LBB1598
+	.byte	0x4
+	.uleb128 .LBB1598-.LBB1598
+	.uleb128 .LBE1598-.LBB1598
+	.byte	0x4
+	.uleb128 .LBB1601-.LBB1598
+	.uleb128 .LBE1601-.LBB1598
+	.byte	0
+.LLRL305:
+	.byte	0x5
+	.quad	.LBB1614
+	.byte	0x4
+	.uleb128 .LBB1614-.LBB1614
+	.uleb128 .LBE1614-.LBB1614
+	.byte	0x4
+	.uleb128 .LBB1617-.LBB1614
+	.uleb128 .LBE1617-.LBB1614
+	.byte	0
+.LLRL310:
+	.byte	0x5
+	.quad	.LBB1632
+	.byte	0x4
+	.uleb128 .LBB1632-.LBB1632
+	.uleb128 .LBE1632-.LBB1632
+	.byte	0x4
+	.uleb128 .LBB1635-.LBB1632
+	.uleb128 .LBE1635-.LBB1632
+	.byte	0
+.LLRL313:
+	.byte	0x5
+	.quad	.LBB1638
+	.byte	0x4
+	.uleb128 .LBB1638-.LBB1638
+	.uleb128 .LBE1638-.LBB1638
+	.byte	0x4
+	.uleb128 .LBB1641-.LBB1638
+	.uleb128 .LBE1641-.LBB1638
+	.byte	0
+.LLRL317:
+	.byte	0x5
+	.quad	.LBB1644
+	.byte	0x4
+	.uleb128 .LBB1644-.LBB1644
+	.uleb128 .LBE1644-.LBB1644
+	.byte	0x4
+	.uleb128 .LBB1648-.LBB1644
+	.uleb128 .LBE1648-.LBB1644
+	.byte	0x4
+	.uleb128 .LBB1649-.LBB1644
+	.uleb128 .LBE1649-.LBB1644
+	.byte	0
+.LLRL319:
+	.byte	0x5
+	.quad	.LBB1650
+	.byte	0x4
+	.uleb128 .LBB1650-.LBB1650
+	.uleb128 .LBE1650-.LBB1650
+	.byte	0x4
+	.uleb128 .LBB1651-.LBB1650
+	.uleb128 .LBE1651-.LBB1650
+	.byte	0
+.LLRL322:
+	.byte	0x5
+	.quad	.LBB1652
+	.byte	0x4
+	.uleb128 .LBB1652-.LBB1652
+	.uleb128 .LBE1652-.LBB1652
+	.byte	0x4
+	.uleb128 .LBB1656-.LBB1652
+	.uleb128 .LBE1656-.LBB1652
+	.byte	0x4
+	.uleb128 .LBB1657-.LBB1652
+	.uleb128 .LBE1657-.LBB1652
+	.byte	0
+.LLRL325:
+	.byte	0x5
+	.quad	.LBB1658
+	.byte	0x4
+	.uleb128 .LBB1658-.LBB1658
+	.uleb128 .LBE1658-.LBB1658
+	.byte	0x4
+	.uleb128 .LBB1662-.LBB1658
+	.uleb128 .LBE1662-.LBB1658
+	.byte	0x4
+	.uleb128 .LBB1663-.LBB1658
+	.uleb128 .LBE1663-.LBB1658
+	.byte	0
+.LLRL329:
+	.byte	0x5
+	.quad	.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1675-.LBB1675
+	.uleb128 .LBE1675-.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1697-.LBB1675
+	.uleb128 .LBE1697-.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1698-.LBB1675
+	.uleb128 .LBE1698-.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1709-.LBB1675
+	.uleb128 .LBE1709-.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1710-.LBB1675
+	.uleb128 .LBE1710-.LBB1675
+	.byte	0x4
+	.uleb128 .LBB1711-.LBB1675
+	.uleb128 .LBE1711-.LBB1675
+	.byte	0
+.LLRL332:
+	.byte	0x5
+	.quad	.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1677-.LBB1677
+	.uleb128 .LBE1677-.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1687-.LBB1677
+	.uleb128 .LBE1687-.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1688-.LBB1677
+	.uleb128 .LBE1688-.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1689-.LBB1677
+	.uleb128 .LBE1689-.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1690-.LBB1677
+	.uleb128 .LBE1690-.LBB1677
+	.byte	0x4
+	.uleb128 .LBB1691-.LBB1677
+	.uleb128 .LBE1691-.LBB1677
+	.byte	0
+.LLRL334:
+	.byte	0x5
+	.quad	.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1678-.LBB1678
+	.uleb128 .LBE1678-.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1682-.LBB1678
+	.uleb128 .LBE1682-.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1683-.LBB1678
+	.uleb128 .LBE1683-.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1684-.LBB1678
+	.uleb128 .LBE1684-.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1685-.LBB1678
+	.uleb128 .LBE1685-.LBB1678
+	.byte	0x4
+	.uleb128 .LBB1686-.LBB1678
+	.uleb128 .LBE1686-.LBB1678
+	.byte	0
+.LLRL337:
+	.byte	0x5
+	.quad	.LBB1679
+	.byte	0x4
+	.uleb128 .LBB1679-.LBB1679
+	.uleb128 .LBE1679-.LBB1679
+	.byte	0x4
+	.uleb128 .LBB1680-.LBB1679
+	.uleb128 .LBE1680-.LBB1679
+	.byte	0x4
+	.uleb128 .LBB1681-.LBB1679
+	.uleb128 .LBE1681-.LBB1679
+	.byte	0
+.LLRL339:
+	.byte	0x5
+	.quad	.LBB1699
+	.byte	0x4
+	.uleb128 .LBB1699-.LBB1699
+	.uleb128 .LBE1699-.LBB1699
+	.byte	0x4
+	.uleb128 .LBB1712-.LBB1699
+	.uleb128 .LBE1712-.LBB1699
+	.byte	0x4
+	.uleb128 .LBB1713-.LBB1699
+	.uleb128 .LBE1713-.LBB1699
+	.byte	0
+.LLRL341:
+	.byte	0x5
+	.quad	.LBB1701
+	.byte	0x4
+	.uleb128 .LBB1701-.LBB1701
+	.uleb128 .LBE1701-.LBB1701
+	.byte	0x4
+	.uleb128 .LBB1705-.LBB1701
+	.uleb128 .LBE1705-.LBB1701
+	.byte	0x4
+	.uleb128 .LBB1706-.LBB1701
+	.uleb128 .LBE1706-.LBB1701
+	.byte	0
+.LLRL347:
+	.byte	0x5
+	.quad	.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1714-.LBB1714
+	.uleb128 .LBE1714-.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1721-.LBB1714
+	.uleb128 .LBE1721-.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1723-.LBB1714
+	.uleb128 .LBE1723-.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1724-.LBB1714
+	.uleb128 .LBE1724-.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1726-.LBB1714
+	.uleb128 .LBE1726-.LBB1714
+	.byte	0x4
+	.uleb128 .LBB1727-.LBB1714
+	.uleb128 .LBE1727-.LBB1714
+	.byte	0
+.LLRL349:
+	.byte	0x5
+	.quad	.LBB1722
+	.byte	0x4
+	.uleb128 .LBB1722-.LBB1722
+	.uleb128 .LBE1722-.LBB1722
+	.byte	0x4
+	.uleb128 .LBB1725-.LBB1722
+	.uleb128 .LBE1725-.LBB1722
+	.byte	0x4
+	.uleb128 .LBB1728-.LBB1722
+	.uleb128 .LBE1728-.LBB1722
+	.byte	0
+.LLRL351:
+	.byte	0x5
+	.quad	.LBB1733
+	.byte	0x4
+	.uleb128 .LBB1733-.LBB1733
+	.uleb128 .LBE1733-.LBB1733
+	.byte	0x4
+	.uleb128 .LBB1737-.LBB1733
+	.uleb128 .LBE1737-.LBB1733
+	.byte	0x4
+	.uleb128 .LBB1741-.LBB1733
+	.uleb128 .LBE1741-.LBB1733
+	.byte	0
+.LLRL353:
+	.byte	0x5
+	.quad	.LBB1738
+	.byte	0x4
+	.uleb128 .LBB1738-.LBB1738
+	.uleb128 .LBE1738-.LBB1738
+	.byte	0x4
+	.uleb128 .LBB1742-.LBB1738
+	.uleb128 .LBE1742-.LBB1738
+	.byte	0
+.LLRL357:
+	.byte	0x5
+	.quad	.LBB1743
+	.byte	0x4
+	.uleb128 .LBB1743-.LBB1743
+	.uleb128 .LBE1743-.LBB1743
+	.byte	0x4
+	.uleb128 .LBB1747-.LBB1743
+	.uleb128 .LBE1747-.LBB1743
+	.byte	0x4
+	.uleb128 .LBB1748-.LBB1743
+	.uleb128 .LBE1748-.LBB1743
+	.byte	0
+.LLRL360:
+	.byte	0x5
+	.quad	.LBB1750
+	.byte	0x4
+	.uleb128 .LBB1750-.LBB1750
+	.uleb128 .LBE1750-.LBB1750
+	.byte	0x4
+	.uleb128 .LBB1754-.LBB1750
+	.uleb128 .LBE1754-.LBB1750
+	.byte	0x4
+	.uleb128 .LBB1755-.LBB1750
+	.uleb128 .LBE1755-.LBB1750
+	.byte	0
+.LLRL364:
+	.byte	0x5
+	.quad	.LBB1760
+	.byte	0x4
+	.uleb128 .LBB1760-.LBB1760
+	.uleb128 .LBE1760-.LBB1760
+	.byte	0x4
+	.uleb128 .LBB1773-.LBB1760
+	.uleb128 .LBE1773-.LBB1760
+	.byte	0x4
+	.uleb128 .LBB1774-.LBB1760
+	.uleb128 .LBE1774-.LBB1760
+	.byte	0x4
+	.uleb128 .LBB1775-.LBB1760
+	.uleb128 .LBE1775-.LBB1760
+	.byte	0
+.LLRL367:
+	.byte	0x5
+	.quad	.LBB1762
+	.byte	0x4
+	.uleb128 .LBB1762-.LBB1762
+	.uleb128 .LBE1762-.LBB1762
+	.byte	0x4
+	.uleb128 .LBB1767-.LBB1762
+	.uleb128 .LBE1767-.LBB1762
+	.byte	0x4
+	.uleb128 .LBB1768-.LBB1762
+	.uleb128 .LBE1768-.LBB1762
+	.byte	0x4
+	.uleb128 .LBB1769-.LBB1762
+	.uleb128 .LBE1769-.LBB1762
+	.byte	0
+.LLRL369:
+	.byte	0x5
+	.quad	.LBB1780
+	.byte	0x4
+	.uleb128 .LBB1780-.LBB1780
+	.uleb128 .LBE1780-.LBB1780
+	.byte	0x4
+	.uleb128 .LBB1793-.LBB1780
+	.uleb128 .LBE1793-.LBB1780
+	.byte	0x4
+	.uleb128 .LBB1794-.LBB1780
+	.uleb128 .LBE1794-.LBB1780
+	.byte	0x4
+	.uleb128 .LBB1795-.LBB1780
+	.uleb128 .LBE1795-.LBB1780
+	.byte	0
+.LLRL372:
+	.byte	0x5
+	.quad	.LBB1782
+	.byte	0x4
+	.uleb128 .LBB1782-.LBB1782
+	.uleb128 .LBE1782-.LBB1782
+	.byte	0x4
+	.uleb128 .LBB1787-.LBB1782
+	.uleb128 .LBE1787-.LBB1782
+	.byte	0x4
+	.uleb128 .LBB1788-.LBB1782
+	.uleb128 .LBE1788-.LBB1782
+	.byte	0x4
+	.uleb128 .LBB1789-.LBB1782
+	.uleb128 .LBE1789-.LBB1782
+	.byte	0
+.LLRL378:
+	.byte	0x5
+	.quad	.LBB1800
+	.byte	0x4
+	.uleb128 .LBB1800-.LBB1800
+	.uleb128 .LBE1800-.LBB1800
+	.byte	0x4
+	.uleb128 .LBB1804-.LBB1800
+	.uleb128 .LBE1804-.LBB1800
+	.byte	0x4
+	.uleb128 .LBB1805-.LBB1800
+	.uleb128 .LBE1805-.LBB1800
+	.byte	0
+.LLRL393:
+	.byte	0x5
+	.quad	.LBB1806
+	.byte	0x4
+	.uleb128 .LBB1806-.LBB1806
+	.uleb128 .LBE1806-.LBB1806
+	.byte	0x4
+	.uleb128 .LBB1809-.LBB1806
+	.uleb128 .LBE1809-.LBB1806
+	.byte	0
+.LLRL399:
+	.byte	0x5
+	.quad	.LBB1818
+	.byte	0x4
+	.uleb128 .LBB1818-.LBB1818
+	.uleb128 .LBE1818-.LBB1818
+	.byte	0x4
+	.uleb128 .LBB1834-.LBB1818
+	.uleb128 .LBE1834-.LBB1818
+	.byte	0x4
+	.uleb128 .LBB1835-.LBB1818
+	.uleb128 .LBE1835-.LBB1818
+	.byte	0x4
+	.uleb128 .LBB1836-.LBB1818
+	.uleb128 .LBE1836-.LBB1818
+	.byte	0
+.LLRL403:
+	.byte	0x5
+	.quad	.LBB1820
+	.byte	0x4
+	.uleb128 .LBB1820-.LBB1820
+	.uleb128 .LBE1820-.LBB1820
+	.byte	0x4
+	.uleb128 .LBB1830-.LBB1820
+	.uleb128 .LBE1830-.LBB1820
+	.byte	0
+.LLRL406:
+	.byte	0x5
+	.quad	.LBB1822
+	.byte	0x4
+	.uleb128 .LBB1822-.LBB1822
+	.uleb128 .LBE1822-.LBB1822
+	.byte	0x4
+	.uleb128 .LBB1827-.LBB1822
+	.uleb128 .LBE1827-.LBB1822
+	.byte	0x4
+	.uleb128 .LBB1828-.LBB1822
+	.uleb128 .LBE1828-.LBB1822
+	.byte	0x4
+	.uleb128 .LBB1829-.LBB1822
+	.uleb128 .LBE1829-.LBB1822
+	.byte	0
+.LLRL413:
+	.byte	0x5
+	.quad	.LBB1854
+	.byte	0x4
+	.uleb128 .LBB1854-.LBB1854
+	.uleb128 .LBE1854-.LBB1854
+	.byte	0x4
+	.uleb128 .LBB1899-.LBB1854
+	.uleb128 .LBE1899-.LBB1854
+	.byte	0
+.LLRL415:
+	.byte	0x5
+	.quad	.LBB1857
+	.byte	0x4
+	.uleb128 .LBB1857-.LBB1857
+	.uleb128 .LBE1857-.LBB1857
+	.byte	0x4
+	.uleb128 .LBB1900-.LBB1857
+	.uleb128 .LBE1900-.LBB1857
+	.byte	0
+.LLRL418:
+	.byte	0x5
+	.quad	.LBB1859
+	.byte	0x4
+	.uleb128 .LBB1859-.LBB1859
+	.uleb128 .LBE1859-.LBB1859
+	.byte	0x4
+	.uleb128 .LBB1894-.LBB1859
+	.uleb128 .LBE1894-.LBB1859
+	.byte	0x4
+	.uleb128 .LBB1895-.LBB1859
+	.uleb128 .LBE1895-.LBB1859
+	.byte	0x4
+	.uleb128 .LBB1896-.LBB1859
+	.uleb128 .LBE1896-.LBB1859
+	.byte	0x4
+	.uleb128 .LBB1897-.LBB1859
+	.uleb128 .LBE1897-.LBB1859
+	.byte	0
+.LLRL421:
+	.byte	0x5
+	.quad	.LBB1861
+	.byte	0x4
+	.uleb128 .LBB1861-.LBB1861
+	.uleb128 .LBE1861-.LBB1861
+	.byte	0x4
+	.uleb128 .LBB1887-.LBB1861
+	.uleb128 .LBE1887-.LBB1861
+	.byte	0x4
+	.uleb128 .LBB1888-.LBB1861
+	.uleb128 .LBE1888-.LBB1861
+	.byte	0x4
+	.uleb128 .LBB1889-.LBB1861
+	.uleb128 .LBE1889-.LBB1861
+	.byte	0
+.LLRL422:
+	.byte	0x5
+	.quad	.LBB1863
+	.byte	0x4
+	.uleb128 .LBB1863-.LBB1863
+	.uleb128 .LBE1863-.LBB1863
+	.byte	0x4
+	.uleb128 .LBB1872-.LBB1863
+	.uleb128 .LBE1872-.LBB1863
+	.byte	0x4
+	.uleb128 .LBB1873-.LBB1863
+	.uleb128 .LBE1873-.LBB1863
+	.byte	0x4
+	.uleb128 .LBB1882-.LBB1863
+	.uleb128 .LBE1882-.LBB1863
+	.byte	0x4
+	.uleb128 .LBB1883-.LBB1863
+	.uleb128 .LBE1883-.LBB1863
+	.byte	0
+.LLRL426:
+	.byte	0x5
+	.quad	.LBB1865
+	.byte	0x4
+	.uleb128 .LBB1865-.LBB1865
+	.uleb128 .LBE1865-.LBB1865
+	.byte	0x4
+	.uleb128 .LBB1866-.LBB1865
+	.uleb128 .LBE1866-.LBB1865
+	.byte	0x4
+	.uleb128 .LBB1867-.LBB1865
+	.uleb128 .LBE1867-.LBB1865
+	.byte	0
+.LLRL429:
+	.byte	0x5
+	.quad	.LBB1876
+	.byte	0x4
+	.uleb128 .LBB1876-.LBB1876
+	.uleb128 .LBE1876-.LBB1876
+	.byte	0x4
+	.uleb128 .LBB1881-.LBB1876
+	.uleb128 .LBE1881-.LBB1876
+	.byte	0
+.LLRL434:
+	.byte	0x5
+	.quad	.LBB1903
+	.byte	0x4
+	.uleb128 .LBB1903-.LBB1903
+	.uleb128 .LBE1903-.LBB1903
+	.byte	0x4
+	.uleb128 .LBB1906-.LBB1903
+	.uleb128 .LBE1906-.LBB1903
+	.byte	0
+.LLRL438:
+	.byte	0x5
+	.quad	.LBB1914
+	.byte	0x4
+	.uleb128 .LBB1914-.LBB1914
+	.uleb128 .LBE1914-.LBB1914
+	.byte	0x4
+	.uleb128 .LBB1919-.LBB1914
+	.uleb128 .LBE1919-.LBB1914
+	.byte	0x4
+	.uleb128 .LBB1920-.LBB1914
+	.uleb128 .LBE1920-.LBB1914
+	.byte	0x4
+	.uleb128 .LBB1939-.LBB1914
+	.uleb128 .LBE1939-.LBB1914
+	.byte	0
+.LLRL440:
+	.byte	0x5
+	.quad	.LBB1921
+	.byte	0x4
+	.uleb128 .LBB1921-.LBB1921
+	.uleb128 .LBE1921-.LBB1921
+	.byte	0x4
+	.uleb128 .LBB1940-.LBB1921
+	.uleb128 .LBE1940-.LBB1921
+	.byte	0x4
+	.uleb128 .LBB1941-.LBB1921
+	.uleb128 .LBE1941-.LBB1921
+	.byte	0x4
+	.uleb128 .LBB1942-.LBB1921
+	.uleb128 .LBE1942-.LBB1921
+	.byte	0
+.LLRL443:
+	.byte	0x5
+	.quad	.LBB1923
+	.byte	0x4
+	.uleb128 .LBB1923-.LBB1923
+	.uleb128 .LBE1923-.LBB1923
+	.byte	0x4
+	.uleb128 .LBB1932-.LBB1923
+	.uleb128 .LBE1932-.LBB1923
+	.byte	0x4
+	.uleb128 .LBB1933-.LBB1923
+	.uleb128 .LBE1933-.LBB1923
+	.byte	0x4
+	.uleb128 .LBB1934-.LBB1923
+	.uleb128 .LBE1934-.LBB1923
+	.byte	0x4
+	.uleb128 .LBB1935-.LBB1923
+	.uleb128 .LBE1935-.LBB1923
+	.byte	0
+.LLRL445:
+	.byte	0x5
+	.quad	.LBB1924
+	.byte	0x4
+	.uleb128 .LBB1924-.LBB1924
+	.uleb128 .LBE1924-.LBB1924
+	.byte	0x4
+	.uleb128 .LBB1928-.LBB1924
+	.uleb128 .LBE1928-.LBB1924
+	.byte	0x4
+	.uleb128 .LBB1929-.LBB1924
+	.uleb128 .LBE1929-.LBB1924
+	.byte	0x4
+	.uleb128 .LBB1930-.LBB1924
+	.uleb128 .LBE1930-.LBB1924
+	.byte	0x4
+	.uleb128 .LBB1931-.LBB1924
+	.uleb128 .LBE1931-.LBB1924
+	.byte	0
+.LLRL448:
+	.byte	0x5
+	.quad	.LBB1925
+	.byte	0x4
+	.uleb128 .LBB1925-.LBB1925
+	.uleb128 .LBE1925-.LBB1925
+	.byte	0x4
+	.uleb128 .LBB1926-.LBB1925
+	.uleb128 .LBE1926-.LBB1925
+	.byte	0x4
+	.uleb128 .LBB1927-.LBB1925
+	.uleb128 .LBE1927-.LBB1925
+	.byte	0
+.LLRL450:
+	.byte	0x7
+	.quad	.LFB74
+	.uleb128 .LFE74-.LFB74
+	.byte	0x7
+	.quad	.LFB83
+	.uleb128 .LFE83-.LFB83
+	.byte	0x7
+	.quad	.LFB75
+	.uleb128 .LFE75-.LFB75
+	.byte	0x7
+	.quad	.LFB72
+	.uleb128 .LFE72-.LFB72
+	.byte	0x7
+	.quad	.LFB73
+	.uleb128 .LFE73-.LFB73
+	.byte	0x7
+	.quad	.LFB82
+	.uleb128 .LFE82-.LFB82
+	.byte	0x7
+	.quad	.LFB71
+	.uleb128 .LFE71-.LFB71
+	.byte	0x7
+	.quad	.LFB69
+	.uleb128 .LFE69-.LFB69
+	.byte	0x7
+	.quad	.LFB63
+	.uleb128 .LFE63-.LFB63
+	.byte	0x7
+	.quad	.LFB70
+	.uleb128 .LFE70-.LFB70
+	.byte	0x7
+	.quad	.LFB81
+	.uleb128 .LFE81-.LFB81
+	.byte	0x7
+	.quad	.LFB79
+	.uleb128 .LFE79-.LFB79
+	.byte	0x7
+	.quad	.LFB61
+	.uleb128 .LFE61-.LFB61
+	.byte	0x7
+	.quad	.LFB62
+	.uleb128 .LFE62-.LFB62
+	.byte	0x7
+	.quad	.LFB87
+	.uleb128 .LFE87-.LFB87
+	.byte	0x7
+	.quad	.LFB78
+	.uleb128 .LFE78-.LFB78
+	.byte	0x7
+	.quad	.LFB64
+	.uleb128 .LFE64-.LFB64
+	.byte	0x7
+	.quad	.LFB76
+	.uleb128 .LFE76-.LFB76
+	.byte	0x7
+	.quad	.LFB77
+	.uleb128 .LFE77-.LFB77
+	.byte	0x7
+	.quad	.LFB67
+	.uleb128 .LFE67-.LFB67
+	.byte	0x7
+	.quad	.LFB80
+	.uleb128 .LFE80-.LFB80
+	.byte	0x7
+	.quad	.LFB66
+	.uleb128 .LFE66-.LFB66
+	.byte	0x7
+	.quad	.LFB68
+	.uleb128 .LFE68-.LFB68
+	.byte	0x7
+	.quad	.LFB65
+	.uleb128 .LFE65-.LFB65
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB86
+	.uleb128 .LFE86-.LFB86
+	.byte	0x7
+	.quad	.LFB89
+	.uleb128 .LFE89-.LFB89
+	.byte	0x7
+	.quad	.LFB50
+	.uleb128 .LFE50-.LFB50
+	.byte	0x7
+	.quad	.LFB52
+	.uleb128 .LFE52-.LFB52
+	.byte	0x7
+	.quad	.LFB53
+	.uleb128 .LFE53-.LFB53
+	.byte	0x7
+	.quad	.LFB35
+	.uleb128 .LFE35-.LFB35
+	.byte	0x7
+	.quad	.LFB49
+	.uleb128 .LFE49-.LFB49
+	.byte	0x7
+	.quad	.LFB48
+	.uleb128 .LFE48-.LFB48
+	.byte	0x7
+	.quad	.LFB43
+	.uleb128 .LFE43-.LFB43
+	.byte	0x7
+	.quad	.LFB42
+	.uleb128 .LFE42-.LFB42
+	.byte	0x7
+	.quad	.LFB41
+	.uleb128 .LFE41-.LFB41
+	.byte	0x7
+	.quad	.LFB40
+	.uleb128 .LFE40-.LFB40
+	.byte	0x7
+	.quad	.LFB39
+	.uleb128 .LFE39-.LFB39
+	.byte	0x7
+	.quad	.LFB38
+	.uleb128 .LFE38-.LFB38
+	.byte	0x7
+	.quad	.LFB33
+	.uleb128 .LFE33-.LFB33
+	.byte	0x7
+	.quad	.LFB32
+	.uleb128 .LFE32-.LFB32
+	.byte	0x7
+	.quad	.LFB31
+	.uleb128 .LFE31-.LFB31
+	.byte	0x7
+	.quad	.LFB60
+	.uleb128 .LFE60-.LFB60
+	.byte	0x7
+	.quad	.LFB51
+	.uleb128 .LFE51-.LFB51
+	.byte	0x7
+	.quad	.LFB59
+	.uleb128 .LFE59-.LFB59
+	.byte	0x7
+	.quad	.LFB58
+	.uleb128 .LFE58-.LFB58
+	.byte	0x7
+	.quad	.LFB57
+	.uleb128 .LFE57-.LFB57
+	.byte	0x7
+	.quad	.LFB56
+	.uleb128 .LFE56-.LFB56
+	.byte	0x7
+	.quad	.LFB55
+	.uleb128 .LFE55-.LFB55
+	.byte	0x7
+	.quad	.LFB54
+	.uleb128 .LFE54-.LFB54
+	.byte	0x7
+	.quad	.LFB45
+	.uleb128 .LFE45-.LFB45
+	.byte	0x7
+	.quad	.LFB36
+	.uleb128 .LFE36-.LFB36
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB84
+	.uleb128 .LFE84-.LFB84
+	.byte	0x7
+	.quad	.LFB85
+	.uleb128 .LFE85-.LFB85
+	.byte	0x7
+	.quad	.LFB44
+	.uleb128 .LFE44-.LFB44
+	.byte	0x7
+	.quad	.LFB47
+	.uleb128 .LFE47-.LFB47
+	.byte	0x7
+	.quad	.LFB34
+	.uleb128 .LFE34-.LFB34
+	.byte	0x7
+	.quad	.LFB37
+	.uleb128 .LFE37-.LFB37
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB46
+	.uleb128 .LFE46-.LFB46
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB91
+	.uleb128 .LFE91-.LFB91
+	.byte	0x7
+	.quad	.LFB92
+	.uleb128 .LFE92-.LFB92
+	.byte	0x7
+	.quad	.LFB93
+	.uleb128 .LFE93-.LFB93
+	.byte	0x7
+	.quad	.LFB97
+	.uleb128 .LFE97-.LFB97
+	.byte	0x7
+	.quad	.LFB98
+	.uleb128 .LFE98-.LFB98
+	.byte	0x7
+	.quad	.LFB99
+	.uleb128 .LFE99-.LFB99
+	.byte	0x7
+	.quad	.LFB100
+	.uleb128 .LFE100-.LFB100
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 44 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 45 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 46 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.file 47 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 49 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 50 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 53 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 55 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 60 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 65 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 70 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 87 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x58
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x4
+	.byte	0x4
+	.file 92 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 93 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5e
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1183
+	.byte	0x4
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 100 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x64
+	.file 101 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 102 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.file 103 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1314
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1320
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1331
+	.byte	0x4
+	.byte	0x4
+	.file 104 ".//src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x68
+	.byte	0x4
+	.file 105 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 106 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1336
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1344
+	.byte	0x4
+	.file 107 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 108 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 109 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1410
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1419
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1429
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1442
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x6b0
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x70f
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x787
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x7bd
+	.long	.LASF1547
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1177
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1185
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1187
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1202
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1212
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1215
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1204
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1205
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1224
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1225
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1226
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1227
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1237
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1276
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1284
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1294
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1313
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1319
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1327
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.profiling.h.34.071b1e95f4ebee26ff29bf11a1e6ac52,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1330
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1335
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1340
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1343
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1360
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1382
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1389
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1392
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.msp_frame.h.30.34a67eeee13e5ce8eee8d2ecfa265b98,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1409
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1415
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1418
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1428
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_values.h.32.11f6a86bb47beeedafaf69664c3a4228,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1431
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.config_dump.h.32.5e23d98a241c71458dcd7c8003f01eee,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1434
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.version.h.18.c03a47f323b169b2f1003239e9abefcc,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1441
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1745:
+	.string	"escAndServoConfig_s"
+.LASF1749:
+	.string	"escAndServoConfig_t"
+.LASF1405:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1378:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1318:
+	.string	"HSV_VALUE_MAX 255"
+.LASF939:
+	.string	"__DECL_SIMD_logf "
+.LASF983:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1144:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1808:
+	.string	"SCENARIO_SERIAL_RX_ONLY"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF899:
+	.string	"alloca"
+.LASF1278:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1413:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1691:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF1336:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2090:
+	.string	"FOR_GENERAL_MSP"
+.LASF1748:
+	.string	"mincommand"
+.LASF1643:
+	.string	"PIDPITCH"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2279:
+	.string	"writeEEPROM"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2055:
+	.string	"currentProfile"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1845:
+	.string	"MSP_CHECKSUM"
+.LASF1327:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2225:
+	.string	"mspProfile"
+.LASF2168:
+	.string	"mspProcessReceivedByte"
+.LASF1833:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF976:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1409:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1257:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1631:
+	.string	"setMode"
+.LASF1966:
+	.string	"FEATURE_RX_PPM"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1832:
+	.string	"gps_passthrough_baudrate"
+.LASF1437:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF1399:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF1248:
+	.string	"FP_NORMAL 4"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1092:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF2254:
+	.string	"newMspPort"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF1543:
+	.string	"IS_ENABLED(mask) (mask == 0 ? 0 : 1)"
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1579:
+	.string	"PROFILE_STAGE_ANNEX"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1168:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1554:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1617:
+	.string	"vTable"
+.LASF1912:
+	.string	"gyroHardware"
+.LASF1636:
+	.string	"txCommit"
+.LASF1638:
+	.string	"_Bool"
+.LASF1074:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1430:
+	.string	"VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)"
+.LASF907:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1663:
+	.string	"flightDynamicsTrims_t"
+.LASF1294:
+	.string	"U_ID_2 0"
+.LASF1654:
+	.string	"A_level"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1188:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2167:
+	.string	"mspProcessPort"
+.LASF1802:
+	.string	"SCENARIO_CLI_ONLY"
+.LASF1116:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF958:
+	.string	"__DECL_SIMD_pow "
+.LASF2218:
+	.string	"mspRxConfig"
+.LASF2088:
+	.string	"pidnames"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1096:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2022:
+	.string	"flight3DConfig"
+.LASF1642:
+	.string	"PIDROLL"
+.LASF1381:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1727:
+	.string	"failsafe_throttle"
+.LASF1857:
+	.string	"headerLength"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1703:
+	.string	"motorMixer_t"
+.LASF1606:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1902:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2098:
+	.string	"parser"
+.LASF2045:
+	.string	"disarm_kill_switch"
+.LASF1406:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF1249:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1904:
+	.string	"CW270_DEG_FLIP"
+.LASF1045:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF953:
+	.string	"__DECL_SIMD_expf64 "
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF2222:
+	.string	"mspFeature"
+.LASF1713:
+	.string	"deadband3d_throttle"
+.LASF1090:
+	.string	"__DECL_SIMD_log2l "
+.LASF1887:
+	.string	"yawDegrees"
+.LASF1851:
+	.string	"mspFrameResult_e"
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf "
+.LASF924:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1649:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1050:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1598:
+	.string	"profileStageStats_s"
+.LASF1595:
+	.string	"profileStageStats_t"
+.LASF1252:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1811:
+	.string	"serialPortFunctionScenario_e"
+.LASF1488:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1998:
+	.string	"barometerConfig"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1961:
+	.string	"GPS_FIX"
+.LASF2197:
+	.string	"mspSetBoardAlignment"
+.LASF1755:
+	.string	"BOXHEADFREE"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1777:
+	.string	"auxChannelIndex"
+.LASF1976:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2104:
+	.string	"replyFrameSize"
+.LASF1477:
+	.string	"MSP_SET_MIXER 43"
+.LASF1577:
+	.string	"RGB_BLUE"
+.LASF1567:
+	.string	"uint16_t"
+.LASF950:
+	.string	"__DECL_SIMD_expl "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1626:
+	.string	"serialWrite"
+.LASF2123:
+	.string	"mspFrameParse"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF1986:
+	.string	"FEATURE_DSHOT"
+.LASF1718:
+	.string	"middle"
+.LASF1994:
+	.string	"accelerometerTrims"
+.LASF2221:
+	.string	"mspBoardAlignment"
+.LASF1700:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2046:
+	.string	"small_angle"
+.LASF1512:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF1640:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF1156:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1070:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1251:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF906:
+	.string	"_MATH_H 1"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1524:
+	.string	"MSP_SET_HEAD 211"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF1824:
+	.string	"serialPortCount"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1033:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1520:
+	.string	"MSP_SET_MISC 207"
+.LASF920:
+	.string	"__DECL_SIMD_sinl "
+.LASF1322:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1865:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF922:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1279:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1540:
+	.string	"MSP_CONFIG_DUMP_CHUNK_SIZE 240"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1492:
+	.string	"MSP_RAW_IMU 102"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2002:
+	.string	"yaw_deadband"
+.LASF970:
+	.string	"__DECL_SIMD_acosl "
+.LASF1501:
+	.string	"MSP_RC_TUNING 111"
+.LASF978:
+	.string	"__DECL_SIMD_atan "
+.LASF1601:
+	.string	"mask"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2092:
+	.string	"mspPortUsage_e"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1348:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1962:
+	.string	"CALIBRATE_MAG"
+.LASF1519:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1788:
+	.string	"controlRateConfig_t"
+.LASF941:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2036:
+	.string	"gyroConfig"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1435:
+	.string	"FC_VERSION_MAJOR 1"
+.LASF2091:
+	.string	"FOR_TELEMETRY"
+.LASF1771:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2250:
+	.string	"mspInit"
+.LASF1387:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1651:
+	.string	"PIDVEL"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1763:
+	.string	"BOXLEDMAX"
+.LASF2261:
+	.string	"permenantId"
+.LASF2212:
+	.string	"mspSetAccTrim"
+.LASF997:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1644:
+	.string	"PIDYAW"
+.LASF1604:
+	.string	"highWaterMark"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF940:
+	.string	"__DECL_SIMD_logl "
+.LASF2196:
+	.string	"mspSetCurrentMeterConfig"
+.LASF1324:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1673:
+	.string	"gyroData"
+.LASF1677:
+	.string	"EstAlt"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2159:
+	.string	"mspSetTelemetryPort"
+.LASF1177:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1534:
+	.string	"MSP_GPSSVINFO 164"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2241:
+	.string	"mspChannelForwarding"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1412:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1827:
+	.string	"serialConfig_s"
+.LASF1158:
+	.string	"__DECL_SIMD_erfc "
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF1565:
+	.string	"int32_t"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2262:
+	.string	"boxIndex"
+.LASF1347:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1313:
+	.string	"FAST_MATH "
+.LASF1304:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1515:
+	.string	"MSP_SET_PID 202"
+.LASF1132:
+	.string	"__DECL_SIMD_erff32 "
+.LASF904:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF1130:
+	.string	"__DECL_SIMD_erfl "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF2018:
+	.string	"pid_process_denom"
+.LASF1740:
+	.string	"rxRuntimeConfig_s"
+.LASF1485:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF2231:
+	.string	"mspBoxNames"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2100:
+	.string	"inBuf"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1545:
+	.string	"MSP_COMMAND_COUNT (sizeof(mspCommands) / sizeof(mspCommands[0]))"
+.LASF1464:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF1014:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1447:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1310:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1047:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1443:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF1260:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1046:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1357:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1662:
+	.string	"values"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1754:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1204:
+	.string	"__MATH_PRECNAME"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1615:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1234:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1401:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1517:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1532:
+	.string	"MSP_ACC_TRIM 240"
+.LASF1214:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1236:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1015:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1634:
+	.string	"readBuf"
+.LASF1537:
+	.string	"MSP_SET_CONFIG_DUMP 0x1002"
+.LASF1227:
+	.string	"__MATHDECL"
+.LASF1207:
+	.string	"_Mdouble_ float"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2255:
+	.string	"resetMspPort"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1917:
+	.string	"baroGroundPressure"
+.LASF1632:
+	.string	"setRxFrameCallback"
+.LASF1974:
+	.string	"FEATURE_FAILSAFE"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1191:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1506:
+	.string	"MSP_BOXNAMES 116"
+.LASF2207:
+	.string	"mspSetMotor"
+.LASF1849:
+	.string	"MSP_FRAME_RECEIVED"
+.LASF2023:
+	.string	"motor_pwm_rate"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1702:
+	.string	"MULTITYPE_LAST"
+.LASF2116:
+	.string	"minDataSize"
+.LASF1684:
+	.string	"MULTITYPE_GIMBAL"
+.LASF2182:
+	.string	"mspSetConfigDump"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"PROFILE_STAGE_END(stage) profileStageEnd(stage)"
+.LASF2178:
+	.string	"findMspCommand"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1444:
+	.string	"API_VERSION_MAJOR 1"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1225:
+	.string	"__MATHDECL_1"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1421:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1650:
+	.string	"PIDMAG"
+.LASF1739:
+	.string	"rxConfig_t"
+.LASF1813:
+	.string	"SERIAL_PORT_USART2"
+.LASF2166:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1307:
+	.string	"USE_USART2 "
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1129:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1846:
+	.string	"mspFrameState_e"
+.LASF1704:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1796:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1610:
+	.string	"MODE_TX"
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1916:
+	.string	"gyroZero"
+.LASF1491:
+	.string	"MSP_STATUS 101"
+.LASF1432:
+	.string	"CONFIG_DUMP_FORMAT_VERSION 1"
+.LASF1752:
+	.string	"BOXHORIZON"
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1416:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF1386:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF2019:
+	.string	"emf_avoidance"
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1901:
+	.string	"CW0_DEG_FLIP"
+.LASF996:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1738:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1026:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1656:
+	.string	"dterm_lpf_hz"
+.LASF1726:
+	.string	"failsafe_off_delay"
+.LASF1787:
+	.string	"yawRate"
+.LASF1199:
+	.string	"_Mdouble_ double"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1844:
+	.string	"MSP_PAYLOAD"
+.LASF2044:
+	.string	"retarded_arm"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1979:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1891:
+	.string	"SENSOR_BARO"
+.LASF1645:
+	.string	"PIDALT"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1514:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF1765:
+	.string	"BOXLLIGHTS"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1975:
+	.string	"FEATURE_SONAR"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1466:
+	.string	"MSP_CHANNEL_FORWARDING 32"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1984:
+	.string	"FEATURE_BLACKBOX"
+.LASF1753:
+	.string	"BOXBARO"
+.LASF1995:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1967:
+	.string	"FEATURE_VBAT"
+.LASF1469:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1629:
+	.string	"serialSetBaudRate"
+.LASF1712:
+	.string	"neutral3d"
+.LASF1302:
+	.string	"ACC "
+.LASF1768:
+	.string	"BOXOSD"
+.LASF2273:
+	.string	"read16"
+.LASF1647:
+	.string	"PIDPOSR"
+.LASF2072:
+	.string	"totalMicros"
+.LASF1297:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1474:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF1459:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1681:
+	.string	"MULTITYPE_QUADP"
+.LASF2118:
+	.string	"mspCommand_t"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1407:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF2153:
+	.string	"serialTxReserve"
+.LASF1682:
+	.string	"MULTITYPE_QUADX"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2269:
+	.string	"headSerialReply"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1680:
+	.string	"MULTITYPE_TRI"
+.LASF1194:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF2232:
+	.string	"mspModeRanges"
+.LASF1054:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF967:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2061:
+	.string	"type"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2113:
+	.string	"MSP_DIRECTION_IN"
+.LASF2152:
+	.string	"strlen"
+.LASF1548:
+	.string	"long unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1897:
+	.string	"CW0_DEG"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1659:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1735:
+	.string	"midrc"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1661:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1483:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF1555:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1542:
+	.string	"MSP_FALLBACK_BAUDRATE 19200"
+.LASF1557:
+	.string	"__uint16_t"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1374:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF2270:
+	.string	"headSerialResponse"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF392:
+	.string	"false 0"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1305:
+	.string	"USE_BARO_SITL "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1799:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF1900:
+	.string	"CW270_DEG"
+.LASF2030:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1004:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1878:
+	.string	"gpsNoFixLatitude"
+.LASF1489:
+	.string	"MSP_REBOOT 68"
+.LASF981:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2210:
+	.string	"mspSetModeRange"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF713:
+	.string	"__size_t "
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1839:
+	.string	"MSP_HEADER_START"
+.LASF1826:
+	.string	"serialPortFunctionList_t"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1131:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1522:
+	.string	"MSP_SET_WP 209"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1831:
+	.string	"gps_baudrate"
+.LASF2185:
+	.string	"endIndex"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1870:
+	.string	"frskyGpsCoordFormat_e"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF936:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF964:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1005:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1341:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1993:
+	.string	"mag_declination"
+.LASF1894:
+	.string	"SENSOR_GPS"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1224:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1454:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF1582:
+	.string	"PROFILE_STAGE_MOTORS"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1498:
+	.string	"MSP_ATTITUDE 108"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1410:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1238:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2115:
+	.string	"direction"
+.LASF349:
+	.string	"__amd64 1"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1950:
+	.string	"HORIZON_MODE"
+.LASF1549:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2272:
+	.string	"read32"
+.LASF2013:
+	.string	"mixerConfiguration"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1970:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1767:
+	.string	"BOXGOV"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2211:
+	.string	"mspSetPid"
+.LASF1969:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1470:
+	.string	"MSP_FEATURE 36"
+.LASF1289:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2038:
+	.string	"accZero"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF1504:
+	.string	"MSP_MISC 114"
+.LASF1379:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1676:
+	.string	"magHold"
+.LASF1361:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotl "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF1559:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1369:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1573:
+	.string	"float"
+.LASF1618:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1921:
+	.string	"vbatmaxcellvoltage"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2141:
+	.string	"configDumpValueSize"
+.LASF1936:
+	.string	"baro_cf_alt"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1633:
+	.string	"writeBuf"
+.LASF2198:
+	.string	"mspSetFeature"
+.LASF1300:
+	.string	"GYRO "
+.LASF1736:
+	.string	"mincheck"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1988:
+	.string	"pidController"
+.LASF1535:
+	.string	"MSP_BATCH 0x1000"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2219:
+	.string	"mspMixer"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2251:
+	.string	"openAllMSPSerialPorts"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF2233:
+	.string	"mspPidNames"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF2145:
+	.string	"configDumpDecodeRecord"
+.LASF1766:
+	.string	"BOXCALIB"
+.LASF1500:
+	.string	"MSP_ANALOG 110"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1389:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF1972:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1024:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2069:
+	.string	"buildDate"
+.LASF1792:
+	.string	"FUNCTION_NONE"
+.LASF1266:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF2086:
+	.string	"activeBoxIdCount"
+.LASF1087:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2162:
+	.string	"matchedPort"
+.LASF2001:
+	.string	"deadband"
+.LASF1896:
+	.string	"ALIGN_DEFAULT"
+.LASF905:
+	.string	"_STRINGS_H 1"
+.LASF1338:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1056:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1762:
+	.string	"BOXBEEPERON"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF1860:
+	.string	"dataSize"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1125:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF508:
+	.string	"__wur "
+.LASF1825:
+	.string	"functions"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf "
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF1943:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1255:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1530:
+	.string	"MSP_DEBUG 254"
+.LASF1953:
+	.string	"GPS_HOME_MODE"
+.LASF2179:
+	.string	"high"
+.LASF1737:
+	.string	"maxcheck"
+.LASF2082:
+	.string	"box_t"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF1779:
+	.string	"rangeEndStep"
+.LASF1861:
+	.string	"offset"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1627:
+	.string	"serialTotalBytesWaiting"
+.LASF2256:
+	.string	"mspPortToReset"
+.LASF991:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2021:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1353:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1983:
+	.string	"FEATURE_DISPLAY"
+.LASF1639:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1377:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1790:
+	.string	"gimbal_flags"
+.LASF2208:
+	.string	"mspSetMisc"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2192:
+	.string	"mspSetRxMap"
+.LASF1593:
+	.string	"totalCycles"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1471:
+	.string	"MSP_SET_FEATURE 37"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf "
+.LASF2190:
+	.string	"replyCount"
+.LASF2180:
+	.string	"record"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1127:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1351:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1990:
+	.string	"controlRateConfig"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2154:
+	.string	"serialTxBytesFree"
+.LASF2177:
+	.string	"duration"
+.LASF1494:
+	.string	"MSP_MOTOR 104"
+.LASF930:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1007:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1329:
+	.string	"PROFILE_STAGE_BEGIN(stage) profileStageBegin(stage)"
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF1221:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF2191:
+	.string	"processBatchEntry"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1619:
+	.string	"mode"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1453:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2142:
+	.string	"configDumpGetRecord"
+.LASF1441:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF2099:
+	.string	"indRX"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1927:
+	.string	"vbat"
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1628:
+	.string	"serialRead"
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF1670:
+	.string	"rollAndPitchInclination_t_def"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF917:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1080:
+	.string	"__DECL_SIMD_log10l "
+.LASF1596:
+	.string	"debug"
+.LASF2143:
+	.string	"configDumpIndexCount"
+.LASF2235:
+	.string	"mspRcTuning"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1874:
+	.string	"telemetryConfig_s"
+.LASF1883:
+	.string	"telemetryConfig_t"
+.LASF1495:
+	.string	"MSP_RC 105"
+.LASF1393:
+	.string	"MSP_V1_FRAME_OVERHEAD 6"
+.LASF957:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1717:
+	.string	"servoParam_t"
+.LASF1364:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1589:
+	.string	"startedAt"
+.LASF1622:
+	.string	"rxBuffer"
+.LASF1583:
+	.string	"PROFILE_STAGE_SERIAL"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF2140:
+	.string	"configDumpEncodeRecord"
+.LASF2265:
+	.string	"serializeNames"
+.LASF2266:
+	.string	"s_struct"
+.LASF1192:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1692:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1439:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF1067:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2130:
+	.string	"featureMask"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1086:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF989:
+	.string	"__DECL_SIMD_asinf "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2053:
+	.string	"current_profile_index"
+.LASF2224:
+	.string	"mspAccTrim"
+.LASF1400:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF2024:
+	.string	"dshot_rate"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1915:
+	.string	"calibrated"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1732:
+	.string	"rxConfig_s"
+.LASF1952:
+	.string	"BARO_MODE"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1027:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1478:
+	.string	"MSP_RX_CONFIG 44"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1850:
+	.string	"MSP_FRAME_INVALID"
+.LASF951:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1481:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF2097:
+	.string	"mspPort_s"
+.LASF2109:
+	.string	"mspPort_t"
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1215:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF956:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF909:
+	.string	"__DECL_SIMD_cosf "
+.LASF1350:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1301:
+	.string	"USE_GYRO_SITL "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1958:
+	.string	"SONAR_MODE"
+.LASF1452:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF1842:
+	.string	"MSP_HEADER_V1"
+.LASF1843:
+	.string	"MSP_HEADER_V2"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1268:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2131:
+	.string	"getProfileCyclesPerMicrosecond"
+.LASF1570:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1722:
+	.string	"motor_disarmed"
+.LASF2280:
+	.string	"getMspCommandCount"
+.LASF1222:
+	.string	"_Mdouble_ _Float64x"
+.LASF1951:
+	.string	"MAG_MODE"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF934:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1566:
+	.string	"uint8_t"
+.LASF1190:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2206:
+	.string	"potentialServoMiddleOrChannelToForward"
+.LASF1320:
+	.string	"CRC32_STM32_INIT 0xFFFFFFFF"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1699:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF1871:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1392:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF1451:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF2054:
+	.string	"masterConfig"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1820:
+	.string	"scenario"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2041:
+	.string	"batteryConfig"
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1352:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1947:
+	.string	"ARMED"
+.LASF974:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF2026:
+	.string	"sensorAlignmentConfig"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF961:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1128:
+	.string	"__DECL_SIMD_erf "
+.LASF1040:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1303:
+	.string	"USE_ACC_SITL "
+.LASF1354:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2136:
+	.string	"accSetCalibrationCycles"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1769:
+	.string	"BOXTELEMETRY"
+.LASF1544:
+	.string	"MSP_DISARMED_ONLY (1 << 0)"
+.LASF1035:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1171:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1340:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF1714:
+	.string	"flight3DConfig_t"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1315:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF975:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1508:
+	.string	"MSP_WP 118"
+.LASF1382:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1773:
+	.string	"boxId_e"
+.LASF1299:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF376:
+	.string	"unix 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF1774:
+	.string	"rcModeActivationMask"
+.LASF1237:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1968:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2189:
+	.string	"requestCount"
+.LASF1794:
+	.string	"FUNCTION_CLI"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2084:
+	.string	"boxes"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF931:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1578:
+	.string	"PROFILE_STAGE_IMU"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1349:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1371:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2039:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1837:
+	.string	"mspVersion_e"
+.LASF1356:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1800:
+	.string	"serialPortFunction_e"
+.LASF2078:
+	.string	"box_e"
+.LASF2171:
+	.string	"command"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF992:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1180:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1342:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF2096:
+	.string	"mspBatchState_e"
+.LASF1030:
+	.string	"__DECL_SIMD_coshl "
+.LASF1818:
+	.string	"serialPortFunction_s"
+.LASF1822:
+	.string	"serialPortFunction_t"
+.LASF1206:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1694:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF2057:
+	.string	"float_value"
+.LASF1731:
+	.string	"rcData"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1701:
+	.string	"MULTITYPE_CUSTOM"
+.LASF1335:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1428:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF914:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1805:
+	.string	"SCENARIO_MSP_ONLY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1155:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF946:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1384:
+	.string	"LON 1"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1345:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1360:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1484:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF2093:
+	.string	"MSP_BATCH_NONE"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1458:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1527:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF2214:
+	.string	"mspSetHead"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1296:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF2278:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF2063:
+	.string	"configDumpRecord_t"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1784:
+	.string	"thrMid8"
+.LASF1064:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1720:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1607:
+	.string	"SERIAL_INVERTED"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1744:
+	.string	"rxRuntimeConfig"
+.LASF1402:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1869:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1403:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1505:
+	.string	"MSP_MOTOR_PINS 115"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1778:
+	.string	"rangeStartStep"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1723:
+	.string	"servo"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1246:
+	.string	"FP_ZERO 2"
+.LASF948:
+	.string	"__DECL_SIMD_exp "
+.LASF1821:
+	.string	"currentFunction"
+.LASF1065:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1982:
+	.string	"FEATURE_LED_STRIP"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1942:
+	.string	"soft_gyro_notch_hz"
+.LASF1496:
+	.string	"MSP_RAW_GPS 106"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1518:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF2155:
+	.string	"serialTxCommit"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1586:
+	.string	"PROFILE_STAGE_BLACKBOX"
+.LASF1893:
+	.string	"SENSOR_SONAR"
+.LASF2186:
+	.string	"bytesFree"
+.LASF1479:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2062:
+	.string	"value"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF1757:
+	.string	"BOXCAMSTAB"
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2260:
+	.string	"findBoxByPermenantId"
+.LASF1507:
+	.string	"MSP_PIDNAMES 117"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2008:
+	.string	"failsafeConfig"
+.LASF1328:
+	.string	"PROFILE_HISTOGRAM_BUCKET_COUNT 10"
+.LASF1169:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF1309:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1890:
+	.string	"SENSOR_ACC"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1707:
+	.string	"tri_unarmed_servo"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1472:
+	.string	"MSP_BOARD_ALIGNMENT 38"
+.LASF1134:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1209:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1906:
+	.string	"sensorAlignmentConfig_s"
+.LASF1910:
+	.string	"sensorAlignmentConfig_t"
+.LASF966:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2071:
+	.string	"mspCommandStats_s"
+.LASF2074:
+	.string	"mspCommandStats_t"
+.LASF1367:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1445:
+	.string	"API_VERSION_MINOR 2"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1210:
+	.string	"_Mdouble_ long double"
+.LASF2016:
+	.string	"gyro_sync"
+.LASF910:
+	.string	"__DECL_SIMD_cosl "
+.LASF1028:
+	.string	"__DECL_SIMD_cosh "
+.LASF1658:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF1903:
+	.string	"CW180_DEG_FLIP"
+.LASF1750:
+	.string	"BOXARM"
+.LASF1193:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF373:
+	.string	"linux 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF733:
+	.string	"NULL"
+.LASF1960:
+	.string	"GPS_FIX_HOME"
+.LASF1135:
+	.string	"__DECL_SIMD_erff32x "
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF1375:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF1660:
+	.string	"pitch"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1240:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF1742:
+	.string	"auxChannelCount"
+.LASF462:
+	.string	"__PMT"
+.LASF1106:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2051:
+	.string	"blackbox_rate_denom"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2237:
+	.string	"mspAltitude"
+.LASF1876:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1457:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1653:
+	.string	"pidProfile_s"
+.LASF1657:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1877:
+	.string	"frsky_inversion"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1034:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1798:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF2245:
+	.string	"mspStatus"
+.LASF1261:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1793:
+	.string	"FUNCTION_MSP"
+.LASF1909:
+	.string	"mag_align"
+.LASF1089:
+	.string	"__DECL_SIMD_log2f "
+.LASF2059:
+	.string	"configDumpRecord_s"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1948:
+	.string	"armingFlags"
+.LASF2194:
+	.string	"mspSetRxConfig"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1138:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2238:
+	.string	"mspAttitude"
+.LASF1391:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1247:
+	.string	"FP_SUBNORMAL 3"
+.LASF2175:
+	.string	"processCommand"
+.LASF1630:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2081:
+	.string	"permanentId"
+.LASF1186:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1114:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF808:
+	.string	"__off_t_defined "
+.LASF2271:
+	.string	"frameSize"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1690:
+	.string	"MULTITYPE_OCTOX8"
+.LASF2252:
+	.string	"serialPortFunctionList"
+.LASF1885:
+	.string	"rollDegrees"
+.LASF2258:
+	.string	"serializeBoxNamesReply"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1724:
+	.string	"failsafeConfig_s"
+.LASF1730:
+	.string	"failsafeConfig_t"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF2195:
+	.string	"mspSetMixer"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1280:
+	.string	"UNIT_TESTED "
+.LASF2149:
+	.string	"feature"
+.LASF942:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2161:
+	.string	"candidatePort"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1674:
+	.string	"accSmooth"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF987:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF2223:
+	.string	"mspUid"
+.LASF1455:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF986:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1032:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF472:
+	.string	"__P(args) args"
+.LASF1376:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2277:
+	.string	"serialize8"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1930:
+	.string	"accDeadband_s"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1706:
+	.string	"yaw_direction"
+.LASF1569:
+	.string	"uint64_t"
+.LASF1429:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2151:
+	.string	"memset"
+.LASF1218:
+	.string	"_Mdouble_ _Float128"
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2010:
+	.string	"gimbalConfig"
+.LASF1187:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1157:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2107:
+	.string	"batchState"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF2169:
+	.string	"result"
+.LASF1864:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF1334:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1104:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1286:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1418:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1563:
+	.string	"int8_t"
+.LASF2257:
+	.string	"usage"
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1810:
+	.string	"SCENARIO_BLACKBOX_ONLY"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF1461:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1325:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1100:
+	.string	"__DECL_SIMD_log1pl "
+.LASF982:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1394:
+	.string	"MSP_V2_FRAME_OVERHEAD 9"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1683:
+	.string	"MULTITYPE_BI"
+.LASF1475:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF2121:
+	.string	"mspTelemetryCommandSequence"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF735:
+	.string	"__need_NULL"
+.LASF1105:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2101:
+	.string	"cmdMSP"
+.LASF1511:
+	.string	"MSP_NAV_STATUS 121"
+.LASF1239:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2253:
+	.string	"triedFallbackRate"
+.LASF1924:
+	.string	"currentMeterOffset"
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1233:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1183:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF994:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF962:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1408:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF1093:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1611:
+	.string	"MODE_RXTX"
+.LASF1954:
+	.string	"GPS_HOLD_MODE"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1584:
+	.string	"PROFILE_STAGE_TELEMETRY"
+.LASF1226:
+	.string	"__MATHDECL_ALIAS"
+.LASF1446:
+	.string	"API_VERSION_LENGTH 2"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1655:
+	.string	"H_level"
+.LASF2281:
+	.string	"reset"
+.LASF2127:
+	.string	"systemReset"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2005:
+	.string	"throttle_correction_angle"
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1955:
+	.string	"HEADFREE_MODE"
+.LASF995:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1316:
+	.string	"HSV_HUE_MAX 359"
+.LASF1907:
+	.string	"gyro_align"
+.LASF1272:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1098:
+	.string	"__DECL_SIMD_log1p "
+.LASF1463:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF902:
+	.string	"_STRING_H 1"
+.LASF1934:
+	.string	"baro_noise_lpf"
+.LASF1170:
+	.string	"__DECL_SIMD_tanl "
+.LASF1747:
+	.string	"maxthrottle"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2188:
+	.string	"mspBatch"
+.LASF1564:
+	.string	"int16_t"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1124:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1262:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1550:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1669:
+	.string	"pitchDeciDegrees"
+.LASF1552:
+	.string	"signed char"
+.LASF1728:
+	.string	"failsafe_min_usec"
+.LASF1852:
+	.string	"mspFrameParser_s"
+.LASF1862:
+	.string	"mspFrameParser_t"
+.LASF943:
+	.string	"__DECL_SIMD_logf64 "
+.LASF926:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1533:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF1775:
+	.string	"modeActivationCondition_s"
+.LASF1780:
+	.string	"modeActivationCondition_t"
+.LASF696:
+	.string	"__size_t__ "
+.LASF1667:
+	.string	"rollAndPitchInclination_s"
+.LASF1671:
+	.string	"rollAndPitchInclination_t"
+.LASF1242:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1438:
+	.string	"MW_VERSION 230"
+.LASF1425:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1331:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1829:
+	.string	"msp_baudrate"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF1828:
+	.string	"serial_port_scenario"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1981:
+	.string	"FEATURE_RSSI_ADC"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF2094:
+	.string	"MSP_BATCH_MEASURE"
+.LASF1321:
+	.string	"sq(x) ((x)*(x))"
+.LASF2264:
+	.string	"findBoxByActiveBoxId"
+.LASF2176:
+	.string	"stats"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1590:
+	.string	"count"
+.LASF1230:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1282:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2050:
+	.string	"telemetryConfig"
+.LASF1772:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2217:
+	.string	"mspRssiConfig"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1884:
+	.string	"boardAlignment_s"
+.LASF1888:
+	.string	"boardAlignment_t"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1672:
+	.string	"inclination"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1576:
+	.string	"RGB_GREEN"
+.LASF2147:
+	.string	"getSerialPortFunctionList"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1830:
+	.string	"cli_baudrate"
+.LASF2158:
+	.string	"sendMspTelemetry"
+.LASF1273:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1635:
+	.string	"txReserve"
+.LASF1594:
+	.string	"histogram"
+.LASF1368:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1503:
+	.string	"MSP_BOX 113"
+.LASF1729:
+	.string	"failsafe_max_usec"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1815:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1816:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1687:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2170:
+	.string	"mspProcessReceivedFrame"
+.LASF1795:
+	.string	"FUNCTION_TELEMETRY"
+.LASF1668:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1734:
+	.string	"serialrx_provider"
+.LASF1867:
+	.string	"telemetryProvider_e"
+.LASF1212:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1854:
+	.string	"state"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1333:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF1997:
+	.string	"accDeadband"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1311:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1547:
+	.string	"MSP_TELEMETRY_COMMAND_SEQUENCE_ENTRY_COUNT (sizeof(mspTelemetryCommandSequence) / sizeof(mspTelemetryCommandSequence[0]))"
+.LASF2148:
+	.string	"openSerialPort"
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1743:
+	.string	"rxRuntimeConfig_t"
+.LASF2087:
+	.string	"isRebootScheduled"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF944:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1806:
+	.string	"SCENARIO_MSP_CLI_GPS_PASTHROUGH"
+.LASF1803:
+	.string	"SCENARIO_GPS_ONLY"
+.LASF1066:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2282:
+	.string	"commitReplyFrame"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1911:
+	.string	"knownSensors_s"
+.LASF1918:
+	.string	"knownSensors_t"
+.LASF1624:
+	.string	"callback"
+.LASF1679:
+	.string	"MultiType"
+.LASF1264:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1460:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1426:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2220:
+	.string	"mspCurrentMeterConfig"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF935:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1037:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1945:
+	.string	"OK_TO_ARM"
+.LASF1094:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1879:
+	.string	"gpsNoFixLongitude"
+.LASF938:
+	.string	"__DECL_SIMD_log "
+.LASF1920:
+	.string	"vbatscale"
+.LASF2202:
+	.string	"mspAccCalibration"
+.LASF1840:
+	.string	"MSP_HEADER_M"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2199:
+	.string	"mspEepromWrite"
+.LASF1977:
+	.string	"FEATURE_CURRENT_METER"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1841:
+	.string	"MSP_HEADER_X"
+.LASF1933:
+	.string	"baro_sample_count"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1097:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1616:
+	.string	"serialPort"
+.LASF952:
+	.string	"__DECL_SIMD_expf32 "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1396:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF1585:
+	.string	"PROFILE_STAGE_LEDSTRIP"
+.LASF2138:
+	.string	"readEEPROM"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1581:
+	.string	"PROFILE_STAGE_MIXER"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1431:
+	.string	"SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)"
+.LASF1365:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1095:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1721:
+	.string	"motor"
+.LASF1419:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1847:
+	.string	"MSP_FRAME_NONE"
+.LASF1812:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1814:
+	.string	"SERIAL_PORT_USART3"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1935:
+	.string	"baro_cf_vel"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1965:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1176:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF2230:
+	.string	"mspBoxIds"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1560:
+	.string	"long int"
+.LASF1373:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF2203:
+	.string	"mspResetConf"
+.LASF1415:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF1434:
+	.string	"CONFIG_DUMP_RECORD_MAX_SIZE (CONFIG_DUMP_RECORD_HEADER_SIZE + 4)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1091:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF2056:
+	.string	"int_value"
+.LASF927:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2124:
+	.string	"serialReadBuf"
+.LASF1465:
+	.string	"MSP_API_VERSION 1"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1450:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2014:
+	.string	"enabledFeatures"
+.LASF2040:
+	.string	"knownSensors"
+.LASF2247:
+	.string	"flag"
+.LASF1863:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1880:
+	.string	"frsky_coordinate_format"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1908:
+	.string	"acc_align"
+.LASF379:
+	.string	"SITL 1"
+.LASF2085:
+	.string	"activeBoxIds"
+.LASF1277:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1213:
+	.string	"_Mdouble_ _Float32"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2134:
+	.string	"lrintf"
+.LASF1404:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1055:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1696:
+	.string	"MULTITYPE_VTAIL4"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2011:
+	.string	"profile_t"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1919:
+	.string	"batteryConfig_s"
+.LASF1926:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2268:
+	.string	"headSerialError"
+.LASF2126:
+	.string	"featureSet"
+.LASF1467:
+	.string	"MSP_SET_CHANNEL_FORWARDING 33"
+.LASF1358:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1448:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF2029:
+	.string	"acc_hardware"
+.LASF973:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1561:
+	.string	"__uint64_t"
+.LASF1200:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1568:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF990:
+	.string	"__DECL_SIMD_asinl "
+.LASF2070:
+	.string	"buildTime"
+.LASF2227:
+	.string	"mspDebug"
+.LASF1946:
+	.string	"PREVENT_ARMING"
+.LASF1267:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1044:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1088:
+	.string	"__DECL_SIMD_log2 "
+.LASF2077:
+	.string	"boardIdentifier"
+.LASF1319:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1536:
+	.string	"MSP_CONFIG_DUMP 0x1001"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1541:
+	.string	"MSP_CONFIG_DUMP_REPLY_HEADER_SIZE 3"
+.LASF1076:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1482:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1107:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1697:
+	.string	"MULTITYPE_HEX6H"
+.LASF1760:
+	.string	"BOXGPSHOLD"
+.LASF1804:
+	.string	"SCENARIO_GPS_PASSTHROUGH_ONLY"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1801:
+	.string	"SCENARIO_UNUSED"
+.LASF1117:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2080:
+	.string	"boxName"
+.LASF2027:
+	.string	"boardAlignment"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1689:
+	.string	"MULTITYPE_HEX6X"
+.LASF1882:
+	.string	"batterySize"
+.LASF1641:
+	.string	"inputFilteringMode_e"
+.LASF485:
+	.string	"__flexarr []"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF2164:
+	.string	"setCurrentPort"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1312:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1263:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1756:
+	.string	"BOXHEADADJ"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1497:
+	.string	"MSP_COMP_GPS 107"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2031:
+	.string	"gyro_cmpf_factor"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2239:
+	.string	"mspRc"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1939:
+	.string	"gyroConfig_s"
+.LASF1944:
+	.string	"gyroConfig_t"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2112:
+	.string	"MSP_DIRECTION_OUT"
+.LASF1759:
+	.string	"BOXGPSHOME"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF1245:
+	.string	"FP_INFINITE 1"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1597:
+	.string	"acc_1G"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF998:
+	.string	"__DECL_SIMD_hypot "
+.LASF1395:
+	.string	"MSP_V2_HEADER_SIZE 5"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1203:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1383:
+	.string	"LAT 0"
+.LASF2025:
+	.string	"servo_pwm_rate"
+.LASF1985:
+	.string	"FEATURE_ONESHOT125"
+.LASF1306:
+	.string	"USE_USART1 "
+.LASF1562:
+	.string	"char"
+.LASF2200:
+	.string	"mspReboot"
+.LASF2275:
+	.string	"serialize32"
+.LASF1646:
+	.string	"PIDPOS"
+.LASF1599:
+	.string	"ringBuffer_s"
+.LASF1084:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1783:
+	.string	"rcExpo8"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2267:
+	.string	"tailSerialReply"
+.LASF2173:
+	.string	"getMspCommandId"
+.LASF2204:
+	.string	"mspSetChannelForwarding"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1146:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1686:
+	.string	"MULTITYPE_HEX6"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF2095:
+	.string	"MSP_BATCH_WRITE"
+.LASF1715:
+	.string	"airplaneConfig_t"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1081:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1211:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF2058:
+	.string	"int_float_value_t"
+.LASF2244:
+	.string	"mspRawImu"
+.LASF1185:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1420:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF1666:
+	.string	"rollAndPitchTrims_t"
+.LASF1613:
+	.string	"portMode_t"
+.LASF1929:
+	.string	"mAhDrawn"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF913:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1085:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF977:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1588:
+	.string	"profileStage_e"
+.LASF1499:
+	.string	"MSP_ALTITUDE 109"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2160:
+	.string	"portIndex"
+.LASF2089:
+	.string	"UNUSED_PORT"
+.LASF2157:
+	.string	"sequenceIndex"
+.LASF1490:
+	.string	"MSP_IDENT 100"
+.LASF391:
+	.string	"true 1"
+.LASF915:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1380:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2229:
+	.string	"mspMisc"
+.LASF2150:
+	.string	"sensors"
+.LASF969:
+	.string	"__DECL_SIMD_acosf "
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1359:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2125:
+	.string	"evaluateOtherData"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1892:
+	.string	"SENSOR_MAG"
+.LASF955:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2228:
+	.string	"mspMotorPins"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF2076:
+	.string	"rssi"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF695:
+	.string	"__need_NULL "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1057:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1337:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1716:
+	.string	"flaps_speed"
+.LASF1525:
+	.string	"MSP_SET_SERVO_CONF 212"
+.LASF949:
+	.string	"__DECL_SIMD_expf "
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1164:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF993:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1493:
+	.string	"MSP_SERVO 103"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2234:
+	.string	"mspPid"
+.LASF1414:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF2009:
+	.string	"mixerConfig"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2048:
+	.string	"fixedwing_althold_dir"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1600:
+	.string	"buffer"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1971:
+	.string	"FEATURE_SERVO_TILT"
+.LASF1174:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2049:
+	.string	"serialConfig"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2065:
+	.string	"CONFIG_DUMP_UNKNOWN_VALUE"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1424:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2193:
+	.string	"mspSetRssiConfig"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF1216:
+	.string	"_Mdouble_ _Float64"
+.LASF1165:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2128:
+	.string	"featureClearAll"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f "
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1751:
+	.string	"BOXANGLE"
+.LASF1949:
+	.string	"ANGLE_MODE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1254:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1423:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1016:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1287:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1175:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1118:
+	.string	"__DECL_SIMD_acosh "
+.LASF1411:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF2105:
+	.string	"replyFrameLength"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1931:
+	.string	"accDeadband_t"
+.LASF1925:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF1370:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1932:
+	.string	"barometerConfig_s"
+.LASF1937:
+	.string	"barometerConfig_t"
+.LASF371:
+	.string	"__linux 1"
+.LASF1241:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2181:
+	.string	"size"
+.LASF1776:
+	.string	"modeId"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1274:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1244:
+	.string	"FP_NAN 0"
+.LASF1872:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF810:
+	.string	"__id_t_defined "
+.LASF2043:
+	.string	"inputFilteringMode"
+.LASF1075:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1031:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1115:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1789:
+	.string	"gimbalConfig_s"
+.LASF1791:
+	.string	"gimbalConfig_t"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1898:
+	.string	"CW90_DEG"
+.LASF2047:
+	.string	"airplaneConfig"
+.LASF2209:
+	.string	"mspSetRcTuning"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1905:
+	.string	"sensor_align_e"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1516:
+	.string	"MSP_SET_BOX 203"
+.LASF1665:
+	.string	"rollAndPitchTrims_t_def"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2274:
+	.string	"read8"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2032:
+	.string	"gyro_cmpfm_factor"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1987:
+	.string	"profile_s"
+.LASF2226:
+	.string	"bucket"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF968:
+	.string	"__DECL_SIMD_acos "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1688:
+	.string	"MULTITYPE_Y4"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2110:
+	.string	"mspPorts"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2205:
+	.string	"mspSetServoConf"
+.LASF945:
+	.string	"__DECL_SIMD_logf32x "
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1521:
+	.string	"MSP_RESET_CONF 208"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1835:
+	.string	"MSP_V1"
+.LASF1836:
+	.string	"MSP_V2"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2073:
+	.string	"maxMicros"
+.LASF1258:
+	.string	"M_E 2.7182818284590452354"
+.LASF1179:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1133:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2187:
+	.string	"sizeLimit"
+.LASF1271:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1603:
+	.string	"tail"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1574:
+	.string	"double"
+.LASF1197:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2075:
+	.string	"cycleTime"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF971:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1868:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1068:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1178:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1785:
+	.string	"thrExpo8"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1198:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1941:
+	.string	"soft_gyro_lpf_hz"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2242:
+	.string	"mspServoConf"
+.LASF1698:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1980:
+	.string	"FEATURE_RX_MSP"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1422:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF2103:
+	.string	"replyFrame"
+.LASF1145:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1807:
+	.string	"SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH"
+.LASF2236:
+	.string	"mspAnalog"
+.LASF1265:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2135:
+	.string	"rxMspFrameRecieve"
+.LASF2119:
+	.string	"mspCommands"
+.LASF1973:
+	.string	"FEATURE_GPS"
+.LASF1963:
+	.string	"SMALL_ANGLE"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1366:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1433:
+	.string	"CONFIG_DUMP_RECORD_HEADER_SIZE 4"
+.LASF1259:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1866:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1695:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF1558:
+	.string	"__int32_t"
+.LASF2042:
+	.string	"rxConfig"
+.LASF1253:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2066:
+	.string	"CONFIG_DUMP_OUT_OF_RANGE"
+.LASF2003:
+	.string	"alt_hold_deadband"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF2083:
+	.string	"mspSerialPort"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1427:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1232:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2122:
+	.string	"mspTelemetryPort"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1323:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1486:
+	.string	"MSP_PROFILE 52"
+.LASF1314:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1991:
+	.string	"dynThrPID"
+.LASF1283:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF1295:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1602:
+	.string	"head"
+.LASF1621:
+	.string	"baudRate"
+.LASF1372:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1284:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF2246:
+	.string	"junk"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1817:
+	.string	"serialPortIdentifier_e"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1344:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1964:
+	.string	"FIXED_WING"
+.LASF1148:
+	.string	"__DECL_SIMD_asinh "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1195:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1956:
+	.string	"AUTOTUNE_MODE"
+.LASF959:
+	.string	"__DECL_SIMD_powf "
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1623:
+	.string	"txBuffer"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF965:
+	.string	"__DECL_SIMD_powf32x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1786:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2129:
+	.string	"getProfileStageAverageCycles"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1398:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF988:
+	.string	"__DECL_SIMD_asin "
+.LASF1390:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1873:
+	.string	"frskyUnit_e"
+.LASF1077:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1228:
+	.string	"__MATHCALL"
+.LASF2263:
+	.string	"candidate"
+.LASF1678:
+	.string	"vario"
+.LASF1150:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1928:
+	.string	"amperage"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1587:
+	.string	"PROFILE_STAGE_COUNT"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1326:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1220:
+	.string	"_Mdouble_ _Float32x"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1770:
+	.string	"BOXAUTOTUNE"
+.LASF1275:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2007:
+	.string	"servoConf"
+.LASF1834:
+	.string	"serialConfig_t"
+.LASF1291:
+	.string	"__enable_irq() "
+.LASF1848:
+	.string	"MSP_FRAME_PENDING"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1108:
+	.string	"__DECL_SIMD_atanh "
+.LASF921:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1764:
+	.string	"BOXLEDLOW"
+.LASF2006:
+	.string	"throttle_correction_value"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1959:
+	.string	"flightModeFlags"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1339:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1276:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1741:
+	.string	"channelCount"
+.LASF1992:
+	.string	"tpa_breakpoint"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1625:
+	.string	"serialPortVTable"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF2106:
+	.string	"replyDropped"
+.LASF999:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF933:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1362:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1797:
+	.string	"FUNCTION_GPS"
+.LASF2216:
+	.string	"mspRxMap"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF2249:
+	.string	"mspApiVersion"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1711:
+	.string	"deadband3d_high"
+.LASF2111:
+	.string	"currentPort"
+.LASF1250:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2163:
+	.string	"mspProcess"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1298:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1136:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1572:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1886:
+	.string	"pitchDegrees"
+.LASF1940:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF2037:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF963:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2064:
+	.string	"CONFIG_DUMP_APPLIED"
+.LASF1208:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1346:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2035:
+	.string	"dcm_ki"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF985:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2034:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1285:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF925:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF1269:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1664:
+	.string	"rollAndPitchTrims_s"
+.LASF1705:
+	.string	"mixerConfig_s"
+.LASF1708:
+	.string	"mixerConfig_t"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1614:
+	.string	"serialReceiveCallbackPtr"
+.LASF1725:
+	.string	"failsafe_delay"
+.LASF1881:
+	.string	"frsky_unit"
+.LASF2117:
+	.string	"handler"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1126:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1923:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2017:
+	.string	"gyro_sync_denom"
+.LASF1858:
+	.string	"checksum"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf "
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1546:
+	.string	"MSP_READ_CHUNK_SIZE 32"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1449:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1592:
+	.string	"maxCycles"
+.LASF1036:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1823:
+	.string	"serialPortFunctionList_s"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1526:
+	.string	"MSP_SET_MOTOR 214"
+.LASF1147:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1531:
+	.string	"MSP_UID 160"
+.LASF2215:
+	.string	"mspSelectSetting"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1620:
+	.string	"inversion"
+.LASF1006:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1343:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1781:
+	.string	"controlRateConfig_s"
+.LASF923:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1575:
+	.string	"RGB_RED"
+.LASF984:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2184:
+	.string	"startIndex"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+.LASF1709:
+	.string	"flight3DConfig_s"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2259:
+	.string	"activeBoxId"
+.LASF2156:
+	.string	"crc8DvbS2"
+.LASF1637:
+	.string	"serialPort_t"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1685:
+	.string	"MULTITYPE_Y6"
+.LASF1782:
+	.string	"rcRate8"
+.LASF1999:
+	.string	"acc_unarmedcal"
+.LASF916:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF980:
+	.string	"__DECL_SIMD_atanl "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1612:
+	.string	"MODE_SBUS"
+.LASF1436:
+	.string	"FC_VERSION_MINOR 0"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1856:
+	.string	"header"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1288:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1528:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1078:
+	.string	"__DECL_SIMD_log10 "
+.LASF2144:
+	.string	"configDumpApplyRecord"
+.LASF1809:
+	.string	"SCENARIO_TELEMETRY_ONLY"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f "
+.LASF1017:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF919:
+	.string	"__DECL_SIMD_sinf "
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF908:
+	.string	"__DECL_SIMD_cos "
+.LASF1038:
+	.string	"__DECL_SIMD_expm1 "
+.LASF972:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1332:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF2114:
+	.string	"mspCommand_s"
+.LASF1523:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF1417:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF960:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF1571:
+	.string	"long long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1819:
+	.string	"port"
+.LASF937:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1456:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF1978:
+	.string	"FEATURE_3D"
+.LASF2248:
+	.string	"mspIdent"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF2015:
+	.string	"looptime"
+.LASF2243:
+	.string	"mspServo"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1538:
+	.string	"INBUF_SIZE 256"
+.LASF2132:
+	.string	"getProfileStageStats"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2137:
+	.string	"resetEEPROM"
+.LASF1513:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1281:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2000:
+	.string	"modeActivationConditions"
+.LASF1733:
+	.string	"rcmap"
+.LASF1889:
+	.string	"SENSOR_GYRO"
+.LASF1223:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1591:
+	.string	"minCycles"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1388:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1440:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF2079:
+	.string	"boxId"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1539:
+	.string	"MSP_BATCH_ENTRY_OVERHEAD 5"
+.LASF1648:
+	.string	"PIDNAVR"
+.LASF1853:
+	.string	"bufferSize"
+.LASF1989:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1363:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2004:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1270:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1308:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1608:
+	.string	"serialInversion_e"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF911:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2240:
+	.string	"mspMotor"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1473:
+	.string	"MSP_SET_BOARD_ALIGNMENT 39"
+.LASF1914:
+	.string	"baroHardware"
+.LASF2213:
+	.string	"mspSetRawRc"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1293:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1385:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1290:
+	.string	"__disable_irq() "
+.LASF1652:
+	.string	"PID_ITEM_COUNT"
+.LASF2146:
+	.string	"mspFrameParserInit"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2172:
+	.string	"getMspCommandStats"
+.LASF1462:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF1875:
+	.string	"telemetry_provider"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2201:
+	.string	"mspMagCalibration"
+.LASF1510:
+	.string	"MSP_SERVO_CONF 120"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF903:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1137:
+	.string	"__DECL_SIMD_erff128x "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1184:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1996:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF382:
+	.string	"__REVISION__ \"429af00\""
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2033:
+	.string	"attitude_estimator"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1838:
+	.string	"MSP_IDLE"
+.LASF2174:
+	.string	"processOutCommand"
+.LASF1913:
+	.string	"accHardware"
+.LASF2276:
+	.string	"serialize16"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2l "
+.LASF947:
+	.string	"__DECL_SIMD_logf128x "
+.LASF2067:
+	.string	"configDumpResult_e"
+.LASF1196:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1487:
+	.string	"MSP_RX_MAP 64"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF2028:
+	.string	"yaw_control_direction"
+.LASF1553:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1605:
+	.string	"ringBuffer_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF2120:
+	.string	"mspCommandStats"
+.LASF1938:
+	.string	"magADC"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1442:
+	.string	"MAX_MSP_PORT_COUNT 2"
+.LASF1480:
+	.string	"MSP_LED_COLORS 46"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1855:
+	.string	"version"
+.LASF1710:
+	.string	"deadband3d_low"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1317:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1675:
+	.string	"heading"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1468:
+	.string	"MSP_MODE_RANGES 34"
+.LASF2020:
+	.string	"customMixer"
+.LASF1551:
+	.string	"unsigned int"
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF979:
+	.string	"__DECL_SIMD_atanf "
+.LASF1167:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1243:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1048:
+	.string	"__DECL_SIMD_sinh "
+.LASF1502:
+	.string	"MSP_PID 112"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1397:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f "
+.LASF928:
+	.string	"__DECL_SIMD_sincos "
+.LASF1746:
+	.string	"minthrottle"
+.LASF1140:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1761:
+	.string	"BOXPASSTHRU"
+.LASF1895:
+	.string	"SENSOR_GPSMAG"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF918:
+	.string	"__DECL_SIMD_sin "
+.LASF1189:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1556:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2165:
+	.string	"flightControllerIdentifier"
+.LASF2068:
+	.string	"shortGitRevision"
+.LASF1693:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF954:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1719:
+	.string	"rate"
+.LASF2060:
+	.string	"profileIndex"
+.LASF1758:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2052:
+	.string	"profile"
+.LASF2183:
+	.string	"mspConfigDump"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1957:
+	.string	"PASSTHRU_MODE"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1355:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1609:
+	.string	"MODE_RX"
+.LASF912:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1160:
+	.string	"__DECL_SIMD_erfcl "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1899:
+	.string	"CW180_DEG"
+.LASF1025:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2139:
+	.string	"micros"
+.LASF2012:
+	.string	"master_t"
+.LASF1580:
+	.string	"PROFILE_STAGE_PID"
+.LASF2133:
+	.string	"constrain"
+.LASF2108:
+	.string	"batchSize"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF2102:
+	.string	"mspPortUsage"
+.LASF1859:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1529:
+	.string	"MSP_DEBUGMSG 253"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1154:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1922:
+	.string	"vbatmincellvoltage"
+.LASF1292:
+	.string	"U_ID_0 0x5349544c"
+.LASF1476:
+	.string	"MSP_MIXER 42"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1509:
+	.string	"MSP_BOXIDS 119"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/io/serial_msp.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
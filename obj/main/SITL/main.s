@@ -0,0 +1,12712 @@
+	.file	"main.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/main.c"
+	.section	.text.init,"ax",@progbits
+	.p2align 4
+	.globl	init
+	.type	init, @function
+init:
+.LFB11:
+	.file 1 ".//src/main/main.c"
+	.loc 1 198 1 view -0
+	.cfi_startproc
+	.loc 1 199 5 view .LVU1
+	.loc 1 200 5 view .LVU2
+	.loc 1 201 5 view .LVU3
+	.loc 1 202 4 view .LVU4
+.LVL0:
+	.loc 1 204 5 view .LVU5
+	.loc 1 198 1 is_stmt 0 view .LVU6
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$48, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 204 5 view .LVU7
+	call	initPrintfSupport@PLT
+.LVL1:
+	.loc 1 206 5 is_stmt 1 view .LVU8
+	call	initEEPROM@PLT
+.LVL2:
+	.loc 1 208 5 view .LVU9
+	call	ensureEEPROMContainsValidData@PLT
+.LVL3:
+	.loc 1 209 5 view .LVU10
+	call	readEEPROM@PLT
+.LVL4:
+	.loc 1 229 5 view .LVU11
+	call	systemInit@PLT
+.LVL5:
+	.loc 1 231 5 view .LVU12
+	movl	$100, %edi
+	call	delay@PLT
+.LVL6:
+	.loc 1 233 5 view .LVU13
+	call	ledInit@PLT
+.LVL7:
+	.loc 1 258 5 view .LVU14
+	xorl	%edi, %edi
+	call	bootStageEnd@PLT
+.LVL8:
+	.loc 1 280 5 view .LVU15
+	.loc 1 280 29 is_stmt 0 view .LVU16
+	movl	$32768, %edi
+	call	feature@PLT
+.LVL9:
+	.loc 1 281 37 view .LVU17
+	movl	$2048, %edi
+	.loc 1 280 27 view .LVU18
+	movb	%al, 13(%rsp)
+	.loc 1 281 5 is_stmt 1 view .LVU19
+	.loc 1 281 37 is_stmt 0 view .LVU20
+	call	feature@PLT
+.LVL10:
+	.loc 1 291 5 view .LVU21
+	leaq	13(%rsp), %rdi
+	.loc 1 282 32 view .LVU22
+	movb	$0, 15(%rsp)
+	.loc 1 281 35 view .LVU23
+	movb	%al, 14(%rsp)
+	.loc 1 282 5 is_stmt 1 view .LVU24
+	.loc 1 291 5 view .LVU25
+	call	adcInit@PLT
+.LVL11:
+	.loc 1 293 5 view .LVU26
+	movl	$1, %edi
+	call	bootStageEnd@PLT
+.LVL12:
+	.loc 1 295 5 view .LVU27
+	leaq	240+masterConfig(%rip), %rdi
+	call	initBoardAlignment@PLT
+.LVL13:
+	.loc 1 304 5 view .LVU28
+	movl	$6, %edi
+	call	sensorsSet@PLT
+.LVL14:
+	.loc 1 306 5 view .LVU29
+	.loc 1 306 136 is_stmt 0 view .LVU30
+	movq	currentProfile(%rip), %rax
+	.loc 1 306 17 view .LVU31
+	leaq	284+masterConfig(%rip), %r8
+	movzbl	247+masterConfig(%rip), %edx
+	movzwl	248+masterConfig(%rip), %esi
+	leaq	-56(%r8), %rdi
+	movswl	94(%rax), %ecx
+	call	sensorsAutodetect@PLT
+.LVL15:
+	.loc 1 314 5 is_stmt 1 view .LVU32
+	.loc 1 314 8 is_stmt 0 view .LVU33
+	testb	%al, %al
+	je	.L27
+.LVL16:
+.L2:
+	.loc 1 325 5 is_stmt 1 view .LVU34
+	movl	$2, %edi
+	movl	$10, %ebx
+	call	bootStageEnd@PLT
+.LVL17:
+	.loc 1 327 5 view .LVU35
+	.loc 1 328 5 view .LVU36
+	.loc 1 329 5 view .LVU37
+	.loc 1 329 19 view .LVU38
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	.loc 1 330 9 discriminator 3 view .LVU39
+	.loc 1 331 9 discriminator 3 view .LVU40
+	.loc 1 332 9 discriminator 3 view .LVU41
+	movl	$25, %edi
+	call	delay@PLT
+.LVL18:
+	.loc 1 333 9 discriminator 3 view .LVU42
+	.loc 1 334 9 discriminator 3 view .LVU43
+	movl	$25, %edi
+	call	delay@PLT
+.LVL19:
+	.loc 1 335 9 discriminator 3 view .LVU44
+	.loc 1 329 26 discriminator 3 view .LVU45
+	.loc 1 329 19 discriminator 3 view .LVU46
+	subb	$1, %bl
+	jne	.L3
+	.loc 1 337 5 view .LVU47
+	.loc 1 338 5 view .LVU48
+	.loc 1 340 5 view .LVU49
+	movl	$3, %edi
+	call	bootStageEnd@PLT
+.LVL20:
+	.loc 1 342 5 view .LVU50
+	call	imuInit@PLT
+.LVL21:
+	.loc 1 343 5 view .LVU51
+	movzbl	masterConfig(%rip), %edi
+	leaq	16+masterConfig(%rip), %rsi
+	call	mixerInit@PLT
+.LVL22:
+	.loc 1 350 5 view .LVU52
+	call	timerInit@PLT
+.LVL23:
+	.loc 1 352 5 view .LVU53
+	leaq	340+masterConfig(%rip), %rdi
+	call	serialInit@PLT
+.LVL24:
+	.loc 1 354 5 view .LVU54
+	.loc 1 356 21 is_stmt 0 view .LVU55
+	movzbl	masterConfig(%rip), %eax
+	.loc 1 354 5 view .LVU56
+	pxor	%xmm0, %xmm0
+	movaps	%xmm0, 16(%rsp)
+	movq	$0, 30(%rsp)
+	.loc 1 356 5 is_stmt 1 view .LVU57
+	.loc 1 356 8 is_stmt 0 view .LVU58
+	cmpb	$14, %al
+	je	.L11
+	cmpb	$8, %al
+	je	.L11
+.L4:
+	.loc 1 364 5 is_stmt 1 view .LVU59
+	.loc 1 364 26 is_stmt 0 view .LVU60
+	movl	$2, %edi
+	call	feature@PLT
+.LVL25:
+	.loc 1 365 32 view .LVU61
+	movl	$64, %edi
+	.loc 1 364 24 view .LVU62
+	movb	%al, 19(%rsp)
+	.loc 1 365 5 is_stmt 1 view .LVU63
+	.loc 1 365 32 is_stmt 0 view .LVU64
+	call	feature@PLT
+.LVL26:
+	.loc 1 366 33 view .LVU65
+	movl	$8192, %edi
+	.loc 1 365 30 view .LVU66
+	movb	%al, 20(%rsp)
+	.loc 1 366 5 is_stmt 1 view .LVU67
+	.loc 1 366 33 is_stmt 0 view .LVU68
+	call	feature@PLT
+.LVL27:
+	.loc 1 367 29 view .LVU69
+	movl	$32768, %edi
+	.loc 1 366 31 view .LVU70
+	movb	%al, 16(%rsp)
+	.loc 1 367 5 is_stmt 1 view .LVU71
+	.loc 1 367 29 is_stmt 0 view .LVU72
+	call	feature@PLT
+.LVL28:
+	.loc 1 368 30 view .LVU73
+	movl	$65536, %edi
+	.loc 1 367 27 view .LVU74
+	movb	%al, 18(%rsp)
+	.loc 1 368 5 is_stmt 1 view .LVU75
+	.loc 1 368 30 is_stmt 0 view .LVU76
+	call	feature@PLT
+.LVL29:
+	.loc 1 369 25 view .LVU77
+	movl	$1, %edi
+	.loc 1 368 28 view .LVU78
+	movb	%al, 21(%rsp)
+	.loc 1 369 5 is_stmt 1 view .LVU79
+	.loc 1 369 25 is_stmt 0 view .LVU80
+	call	feature@PLT
+.LVL30:
+	.loc 1 369 23 view .LVU81
+	movb	%al, 17(%rsp)
+	.loc 1 370 5 is_stmt 1 view .LVU82
+	.loc 1 370 28 is_stmt 0 view .LVU83
+	call	isMixerUsingServos@PLT
+.LVL31:
+	.loc 1 373 29 view .LVU84
+	movl	$524288, %edi
+	.loc 1 370 26 view .LVU85
+	movb	%al, 22(%rsp)
+	.loc 1 371 5 is_stmt 1 view .LVU86
+	.loc 1 371 58 is_stmt 0 view .LVU87
+	movq	currentProfile(%rip), %rax
+	.loc 1 371 72 view .LVU88
+	movzbl	534(%rax), %eax
+	shrb	$2, %al
+	andl	$1, %eax
+	movb	%al, 23(%rsp)
+	.loc 1 372 5 is_stmt 1 view .LVU89
+	.loc 1 372 29 is_stmt 0 view .LVU90
+	movzwl	222+masterConfig(%rip), %eax
+	movw	%ax, 26(%rsp)
+	.loc 1 373 5 is_stmt 1 view .LVU91
+	.loc 1 373 29 is_stmt 0 view .LVU92
+	call	feature@PLT
+.LVL32:
+	.loc 1 374 27 view .LVU93
+	movl	$1048576, %edi
+	.loc 1 373 27 view .LVU94
+	movb	%al, 28(%rsp)
+	.loc 1 374 5 is_stmt 1 view .LVU95
+	.loc 1 374 27 is_stmt 0 view .LVU96
+	call	feature@PLT
+.LVL33:
+	.loc 1 377 26 view .LVU97
+	movl	$1000, %edx
+	.loc 1 378 9 view .LVU98
+	movl	$4096, %edi
+	.loc 1 374 25 view .LVU99
+	movb	%al, 29(%rsp)
+	.loc 1 375 5 is_stmt 1 view .LVU100
+	.loc 1 376 5 view .LVU101
+	.loc 1 375 26 is_stmt 0 view .LVU102
+	movl	224+masterConfig(%rip), %eax
+	.loc 1 377 26 view .LVU103
+	movw	%dx, 34(%rsp)
+	.loc 1 375 26 view .LVU104
+	movl	%eax, 30(%rsp)
+	.loc 1 377 5 is_stmt 1 view .LVU105
+	.loc 1 378 5 view .LVU106
+	.loc 1 378 9 is_stmt 0 view .LVU107
+	call	feature@PLT
+.LVL34:
+	.loc 1 378 8 view .LVU108
+	testb	%al, %al
+	je	.L6
+	.loc 1 379 9 is_stmt 1 view .LVU109
+	.loc 1 379 30 is_stmt 0 view .LVU110
+	movzwl	218+masterConfig(%rip), %eax
+	movw	%ax, 34(%rsp)
+.L6:
+	.loc 1 380 5 is_stmt 1 view .LVU111
+	.loc 1 380 8 is_stmt 0 view .LVU112
+	cmpw	$500, 26(%rsp)
+	jbe	.L7
+	.loc 1 381 9 is_stmt 1 view .LVU113
+	.loc 1 381 30 is_stmt 0 view .LVU114
+	xorl	%eax, %eax
+	movw	%ax, 34(%rsp)
+.L7:
+	.loc 1 382 5 is_stmt 1 view .LVU115
+	.loc 1 382 33 is_stmt 0 view .LVU116
+	movzwl	320+masterConfig(%rip), %eax
+	.loc 1 384 5 view .LVU117
+	movl	328+masterConfig(%rip), %edi
+	.loc 1 392 16 view .LVU118
+	leaq	310+masterConfig(%rip), %rbx
+	.loc 1 382 33 view .LVU119
+	movw	%ax, 36(%rsp)
+	.loc 1 384 5 is_stmt 1 view .LVU120
+	call	pwmRxInit@PLT
+.LVL35:
+	.loc 1 386 5 view .LVU121
+	.loc 1 386 56 is_stmt 0 view .LVU122
+	leaq	16(%rsp), %rdi
+	call	pwmInit@PLT
+.LVL36:
+	movq	%rax, %rdi
+.LVL37:
+	.loc 1 388 5 is_stmt 1 view .LVU123
+	call	mixerUsePWMOutputConfiguration@PLT
+.LVL38:
+	.loc 1 390 5 view .LVU124
+	movl	$4, %edi
+	call	bootStageEnd@PLT
+.LVL39:
+	.loc 1 392 5 view .LVU125
+	.loc 1 392 16 is_stmt 0 view .LVU126
+	movq	%rbx, %rdi
+	call	failsafeInit@PLT
+.LVL40:
+	movq	%rax, %rdi
+	.loc 1 392 14 view .LVU127
+	movq	%rax, failsafe(%rip)
+	.loc 1 393 5 is_stmt 1 view .LVU128
+	call	beepcodeInit@PLT
+.LVL41:
+	.loc 1 394 5 view .LVU129
+	movq	failsafe(%rip), %rsi
+	movq	%rbx, %rdi
+	call	rxInit@PLT
+.LVL42:
+	.loc 1 429 5 view .LVU130
+	.loc 1 429 9 is_stmt 0 view .LVU131
+	movl	$262144, %edi
+	call	feature@PLT
+.LVL43:
+	.loc 1 429 8 view .LVU132
+	testb	%al, %al
+	jne	.L28
+.L8:
+	.loc 1 433 5 is_stmt 1 view .LVU133
+	.loc 1 433 20 is_stmt 0 view .LVU134
+	call	micros@PLT
+.LVL44:
+	.loc 1 435 8 view .LVU135
+	cmpb	$5, masterConfig(%rip)
+	.loc 1 433 18 view .LVU136
+	movl	%eax, previousTime(%rip)
+	.loc 1 435 5 is_stmt 1 view .LVU137
+	.loc 1 435 8 is_stmt 0 view .LVU138
+	je	.L29
+.L9:
+	.loc 1 438 5 is_stmt 1 view .LVU139
+	leaq	284+masterConfig(%rip), %rbx
+	movq	%rbx, %rdi
+	call	gyroStartBootCalibration@PLT
+.LVL45:
+	.loc 1 440 5 view .LVU140
+	movq	%rbx, %rdi
+	call	baroStartBootCalibration@PLT
+.LVL46:
+	.loc 1 443 5 view .LVU141
+	.loc 1 458 9 is_stmt 0 view .LVU142
+	movl	$2, %edi
+	.loc 1 443 17 view .LVU143
+	orb	$8, stateFlags(%rip)
+	.loc 1 444 5 is_stmt 1 view .LVU144
+	.loc 1 444 18 is_stmt 0 view .LVU145
+	andb	$-3, armingFlags(%rip)
+	.loc 1 458 5 is_stmt 1 view .LVU146
+	.loc 1 458 9 is_stmt 0 view .LVU147
+	call	feature@PLT
+.LVL47:
+	.loc 1 458 8 view .LVU148
+	testb	%al, %al
+	jne	.L30
+.L10:
+	.loc 1 468 5 is_stmt 1 view .LVU149
+	call	profilingInit@PLT
+.LVL48:
+	.loc 1 471 5 view .LVU150
+	movl	$5, %edi
+	call	bootStageEnd@PLT
+.LVL49:
+	.loc 1 472 1 is_stmt 0 view .LVU151
+	addq	$48, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.LVL50:
+	.p2align 4,,10
+	.p2align 3
+.L11:
+	.cfi_restore_state
+	.loc 1 357 9 is_stmt 1 view .LVU152
+	.loc 1 357 29 is_stmt 0 view .LVU153
+	movb	$1, 24(%rsp)
+	jmp	.L4
+.LVL51:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 315 9 is_stmt 1 view .LVU154
+	movl	$3, %edi
+	call	failureMode@PLT
+.LVL52:
+	.loc 1 315 9 is_stmt 0 view .LVU155
+	jmp	.L2
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L30:
+	.loc 1 459 9 is_stmt 1 view .LVU156
+	leaq	16(%rbx), %rdi
+	call	batteryInit@PLT
+.LVL54:
+	jmp	.L10
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.loc 1 430 9 view .LVU157
+	call	blackboxInit@PLT
+.LVL55:
+	jmp	.L8
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 436 9 view .LVU158
+	movl	$400, %edi
+	call	accSetCalibrationCycles@PLT
+.LVL56:
+	jmp	.L9
+	.cfi_endproc
+.LFE11:
+	.size	init, .-init
+	.section	.text.configureScheduler,"ax",@progbits
+	.p2align 4
+	.globl	configureScheduler
+	.type	configureScheduler, @function
+configureScheduler:
+.LFB12:
+	.loc 1 475 1 view -0
+	.cfi_startproc
+	.loc 1 476 5 view .LVU160
+	.loc 1 475 1 is_stmt 0 view .LVU161
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 476 5 view .LVU162
+	call	schedulerInit@PLT
+.LVL57:
+	.loc 1 478 5 is_stmt 1 view .LVU163
+	.loc 1 478 29 is_stmt 0 view .LVU164
+	call	gyroSyncIsEnabled@PLT
+.LVL58:
+	.loc 1 478 75 view .LVU165
+	testb	%al, %al
+	jne	.L37
+	.loc 1 478 75 discriminator 2 view .LVU166
+	movzwl	8+masterConfig(%rip), %ebx
+.L33:
+.LVL59:
+	.loc 1 480 5 is_stmt 1 discriminator 4 view .LVU167
+	movl	%ebx, %esi
+	movl	$1, %edi
+	call	rescheduleTask@PLT
+.LVL60:
+	.loc 1 481 5 discriminator 4 view .LVU168
+	.loc 1 481 52 is_stmt 0 discriminator 4 view .LVU169
+	movzbl	12+masterConfig(%rip), %eax
+	.loc 1 483 5 discriminator 4 view .LVU170
+	movl	$1, %esi
+	xorl	%edi, %edi
+	.loc 1 481 38 discriminator 4 view .LVU171
+	imull	%ebx, %eax
+	.loc 1 481 23 discriminator 4 view .LVU172
+	movl	%eax, targetPidLooptime(%rip)
+	.loc 1 483 5 is_stmt 1 discriminator 4 view .LVU173
+	call	setTaskEnabled@PLT
+.LVL61:
+	.loc 1 484 5 discriminator 4 view .LVU174
+	movl	$1, %esi
+	movl	$1, %edi
+	call	setTaskEnabled@PLT
+.LVL62:
+	.loc 1 485 5 discriminator 4 view .LVU175
+	movl	$1, %esi
+	movl	$2, %edi
+	call	setTaskEnabled@PLT
+.LVL63:
+	.loc 1 486 5 discriminator 4 view .LVU176
+	movl	$1, %esi
+	movl	$3, %edi
+	call	setTaskEnabled@PLT
+.LVL64:
+	.loc 1 487 5 discriminator 4 view .LVU177
+	movl	$1, %esi
+	movl	$4, %edi
+	call	setTaskEnabled@PLT
+.LVL65:
+	.loc 1 495 5 discriminator 4 view .LVU178
+	.loc 1 495 31 is_stmt 0 discriminator 4 view .LVU179
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL66:
+	.loc 1 495 5 discriminator 4 view .LVU180
+	movl	$5, %edi
+	movzbl	%al, %esi
+	call	setTaskEnabled@PLT
+.LVL67:
+	.loc 1 501 5 is_stmt 1 discriminator 4 view .LVU181
+	.loc 1 501 35 is_stmt 0 discriminator 4 view .LVU182
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL68:
+	.loc 1 501 56 discriminator 4 view .LVU183
+	movl	$1, %esi
+	testb	%al, %al
+	je	.L38
+.L34:
+	.loc 1 501 5 discriminator 6 view .LVU184
+	movl	$6, %edi
+	call	setTaskEnabled@PLT
+.LVL69:
+	.loc 1 513 5 is_stmt 1 discriminator 6 view .LVU185
+	.loc 1 513 35 is_stmt 0 discriminator 6 view .LVU186
+	movl	$262144, %edi
+	call	feature@PLT
+.LVL70:
+	.loc 1 513 5 discriminator 6 view .LVU187
+	movl	$7, %edi
+	.loc 1 515 1 discriminator 6 view .LVU188
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL71:
+	.loc 1 513 5 discriminator 6 view .LVU189
+	movzbl	%al, %esi
+	jmp	setTaskEnabled@PLT
+.LVL72:
+	.p2align 4,,10
+	.p2align 3
+.L37:
+	.cfi_restore_state
+	.loc 1 478 51 discriminator 1 view .LVU190
+	call	gyroSyncGetLoopPeriod@PLT
+.LVL73:
+	movl	%eax, %ebx
+	jmp	.L33
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L38:
+	.loc 1 501 59 discriminator 2 view .LVU191
+	movl	$16, %edi
+	call	sensors@PLT
+.LVL75:
+	.loc 1 501 56 discriminator 2 view .LVU192
+	movzbl	%al, %esi
+	jmp	.L34
+	.cfi_endproc
+.LFE12:
+	.size	configureScheduler, .-configureScheduler
+	.section	.text.startup.main,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB13:
+	.loc 1 531 16 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 532 5 view .LVU194
+	.loc 1 531 16 is_stmt 0 view .LVU195
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 532 5 view .LVU196
+	call	init
+.LVL76:
+	.loc 1 534 5 is_stmt 1 view .LVU197
+	call	configureScheduler
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.loc 1 536 5 discriminator 1 view .LVU198
+	.loc 1 537 9 discriminator 1 view .LVU199
+	call	scheduler@PLT
+.LVL78:
+	.loc 1 538 9 discriminator 1 view .LVU200
+	.loc 1 536 11 discriminator 1 view .LVU201
+	jmp	.L40
+	.cfi_endproc
+.LFE13:
+	.size	main, .-main
+	.section	.text.HardFault_Handler,"ax",@progbits
+	.p2align 4
+	.globl	HardFault_Handler
+	.type	HardFault_Handler, @function
+HardFault_Handler:
+.LFB14:
+	.loc 1 543 1 view -0
+	.cfi_startproc
+	.loc 1 545 5 view .LVU203
+	.loc 1 543 1 is_stmt 0 view .LVU204
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 545 5 view .LVU205
+	movswl	212+masterConfig(%rip), %edi
+	call	writeAllMotors@PLT
+.LVL79:
+.L43:
+	.loc 1 546 5 is_stmt 1 discriminator 1 view .LVU206
+	.loc 1 546 11 discriminator 1 view .LVU207
+	.loc 1 546 5 discriminator 1 view .LVU208
+	.loc 1 546 11 discriminator 1 view .LVU209
+	jmp	.L43
+	.cfi_endproc
+.LFE14:
+	.size	HardFault_Handler, .-HardFault_Handler
+	.comm	failsafe,8,8
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/common/color.h"
+	.file 7 ".//src/main/common/boot_timing.h"
+	.file 8 ".//src/main/drivers/serial.h"
+	.file 9 ".//src/main/drivers/pwm_mapping.h"
+	.file 10 ".//src/main/drivers/pwm_rx.h"
+	.file 11 ".//src/main/drivers/adc.h"
+	.file 12 ".//src/main/flight/flight.h"
+	.file 13 ".//src/main/flight/mixer.h"
+	.file 14 ".//src/main/io/serial.h"
+	.file 15 ".//src/main/flight/failsafe.h"
+	.file 16 ".//src/main/rx/rx.h"
+	.file 17 ".//src/main/io/escservo.h"
+	.file 18 ".//src/main/io/rc_controls.h"
+	.file 19 ".//src/main/io/gimbal.h"
+	.file 20 ".//src/main/sensors/sensors.h"
+	.file 21 ".//src/main/sensors/barometer.h"
+	.file 22 ".//src/main/sensors/acceleration.h"
+	.file 23 ".//src/main/sensors/gyro.h"
+	.file 24 ".//src/main/telemetry/telemetry.h"
+	.file 25 ".//src/main/sensors/battery.h"
+	.file 26 ".//src/main/sensors/boardalignment.h"
+	.file 27 ".//src/main/config/runtime_config.h"
+	.file 28 ".//src/main/config/config.h"
+	.file 29 ".//src/main/config/config_profile.h"
+	.file 30 ".//src/main/config/config_master.h"
+	.file 31 ".//src/main/scheduler/scheduler.h"
+	.file 32 ".//src/main/sensors/gyro_sync.h"
+	.file 33 ".//src/main/common/profiling.h"
+	.file 34 ".//src/main/drivers/system.h"
+	.file 35 ".//src/main/blackbox/blackbox.h"
+	.file 36 "/usr/include/string.h"
+	.file 37 ".//src/main/drivers/light_led.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1db7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1557
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL4
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1084
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1085
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1086
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1087
+	.uleb128 0x3
+	.long	.LASF1089
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1088
+	.uleb128 0x3
+	.long	.LASF1090
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1091
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1092
+	.uleb128 0x3
+	.long	.LASF1093
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1094
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1095
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1096
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1097
+	.uleb128 0x3
+	.long	.LASF1098
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x3
+	.long	.LASF1099
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x3
+	.long	.LASF1100
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF1101
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1102
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1103
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x3
+	.long	.LASF1104
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x43
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1105
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1106
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x6
+	.byte	0x15
+	.long	0x137
+	.uleb128 0x2
+	.long	.LASF1107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1108
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1109
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x7
+	.byte	0x15
+	.long	0x173
+	.uleb128 0x2
+	.long	.LASF1110
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1111
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1113
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1114
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1117
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1118
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x3
+	.long	0x137
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1119
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x8
+	.byte	0x16
+	.long	0x19e
+	.uleb128 0x2
+	.long	.LASF1120
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1121
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1122
+	.byte	0x8
+	.byte	0x19
+	.byte	0x3
+	.long	0x186
+	.uleb128 0xb
+	.long	0x1af
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1123
+	.uleb128 0x8
+	.long	.LASF1140
+	.byte	0x16
+	.byte	0x9
+	.byte	0x26
+	.long	0x294
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x9
+	.byte	0x27
+	.byte	0x9
+	.long	0x17f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x9
+	.byte	0x28
+	.byte	0x9
+	.long	0x17f
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x9
+	.byte	0x29
+	.byte	0x9
+	.long	0x17f
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x9
+	.byte	0x2d
+	.byte	0x9
+	.long	0x17f
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x9
+	.long	0x17f
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x9
+	.long	0x17f
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x9
+	.byte	0x30
+	.byte	0x9
+	.long	0x17f
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x9
+	.byte	0x31
+	.byte	0x9
+	.long	0x17f
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x9
+	.byte	0x32
+	.byte	0x9
+	.long	0x17f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1133
+	.byte	0x9
+	.byte	0x33
+	.byte	0xe
+	.long	0xe7
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0x9
+	.byte	0x34
+	.byte	0x9
+	.long	0x17f
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x9
+	.byte	0x35
+	.byte	0x9
+	.long	0x17f
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x9
+	.byte	0x36
+	.byte	0xe
+	.long	0xe7
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x9
+	.byte	0x37
+	.byte	0xe
+	.long	0xe7
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x9
+	.byte	0x38
+	.byte	0xe
+	.long	0xe7
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x9
+	.byte	0x3a
+	.byte	0xe
+	.long	0xe7
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1140
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x3
+	.long	0x1b7
+	.uleb128 0x8
+	.long	.LASF1141
+	.byte	0x2
+	.byte	0x9
+	.byte	0x3e
+	.long	0x2c7
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x9
+	.byte	0x40
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1144
+	.byte	0x9
+	.byte	0x41
+	.byte	0x3
+	.long	0x2a0
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0xa
+	.byte	0x14
+	.long	0x2eb
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1147
+	.byte	0xa
+	.byte	0x17
+	.byte	0x3
+	.long	0x2d3
+	.uleb128 0x8
+	.long	.LASF1148
+	.byte	0x3
+	.byte	0xb
+	.byte	0x25
+	.long	0x32b
+	.uleb128 0x1
+	.long	.LASF1149
+	.byte	0xb
+	.byte	0x26
+	.byte	0x9
+	.long	0x17f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0xb
+	.byte	0x27
+	.byte	0x9
+	.long	0x17f
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0xb
+	.byte	0x28
+	.byte	0x9
+	.long	0x17f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1148
+	.byte	0xb
+	.byte	0x29
+	.byte	0x3
+	.long	0x2f7
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0xc
+	.byte	0x15
+	.long	0x385
+	.uleb128 0x2
+	.long	.LASF1152
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1153
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1154
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1155
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1159
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1160
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1161
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1162
+	.byte	0xa
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1163
+	.byte	0x50
+	.byte	0xc
+	.byte	0x23
+	.long	0x404
+	.uleb128 0xe
+	.string	"P8"
+	.byte	0xc
+	.byte	0x24
+	.byte	0xd
+	.long	0x404
+	.byte	0
+	.uleb128 0xe
+	.string	"I8"
+	.byte	0xc
+	.byte	0x25
+	.byte	0xd
+	.long	0x404
+	.byte	0xa
+	.uleb128 0xe
+	.string	"D8"
+	.byte	0xc
+	.byte	0x26
+	.byte	0xd
+	.long	0x404
+	.byte	0x14
+	.uleb128 0xe
+	.string	"P_f"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xb
+	.long	0x414
+	.byte	0x20
+	.uleb128 0xe
+	.string	"I_f"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xb
+	.long	0x414
+	.byte	0x2c
+	.uleb128 0xe
+	.string	"D_f"
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xb
+	.long	0x414
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xd
+	.long	0xdb
+	.byte	0x4c
+	.byte	0
+	.uleb128 0x10
+	.long	0xdb
+	.long	0x414
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x9
+	.byte	0
+	.uleb128 0x10
+	.long	0x1b0
+	.long	0x424
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1167
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x385
+	.uleb128 0x8
+	.long	.LASF1168
+	.byte	0x6
+	.byte	0xc
+	.byte	0x57
+	.long	0x464
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0xc
+	.byte	0x58
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0xc
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1171
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x3
+	.long	0x430
+	.uleb128 0x17
+	.byte	0x6
+	.byte	0x5d
+	.long	0x48d
+	.uleb128 0x18
+	.string	"raw"
+	.byte	0x5e
+	.long	0x48d
+	.uleb128 0x19
+	.long	.LASF1172
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x464
+	.byte	0
+	.uleb128 0x10
+	.long	0xc3
+	.long	0x49d
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1173
+	.byte	0xc
+	.byte	0x60
+	.byte	0x3
+	.long	0x470
+	.uleb128 0x8
+	.long	.LASF1174
+	.byte	0x4
+	.byte	0xc
+	.byte	0x62
+	.long	0x4d0
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0xc
+	.byte	0x63
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0xc
+	.byte	0x64
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1175
+	.byte	0xc
+	.byte	0x65
+	.byte	0x3
+	.long	0x4a9
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x67
+	.long	0x4f9
+	.uleb128 0x18
+	.string	"raw"
+	.byte	0x68
+	.long	0x4f9
+	.uleb128 0x19
+	.long	.LASF1172
+	.byte	0x69
+	.byte	0x1d
+	.long	0x4d0
+	.byte	0
+	.uleb128 0x10
+	.long	0xc3
+	.long	0x509
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1176
+	.byte	0xc
+	.byte	0x6a
+	.byte	0x3
+	.long	0x4dc
+	.uleb128 0x1a
+	.long	.LASF1200
+	.long	0x3c
+	.byte	0xd
+	.byte	0x18
+	.long	0x5af
+	.uleb128 0x2
+	.long	.LASF1177
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1178
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1182
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1183
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1189
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1190
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1192
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1198
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1199
+	.byte	0x17
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1200
+	.byte	0xd
+	.byte	0x31
+	.byte	0x3
+	.long	0x515
+	.uleb128 0x8
+	.long	.LASF1201
+	.byte	0x10
+	.byte	0xd
+	.byte	0x34
+	.long	0x5fc
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0xd
+	.byte	0x35
+	.byte	0xb
+	.long	0x1b0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0xd
+	.byte	0x36
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0xd
+	.byte	0x37
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x8
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0xd
+	.byte	0x38
+	.byte	0xb
+	.long	0x1b0
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1201
+	.byte	0xd
+	.byte	0x39
+	.byte	0x3
+	.long	0x5bb
+	.uleb128 0x8
+	.long	.LASF1203
+	.byte	0x2
+	.byte	0xd
+	.byte	0x42
+	.long	0x62f
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0xd
+	.byte	0x43
+	.byte	0xc
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0xd
+	.byte	0x44
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1206
+	.byte	0xd
+	.byte	0x45
+	.byte	0x3
+	.long	0x608
+	.uleb128 0x8
+	.long	.LASF1207
+	.byte	0x8
+	.byte	0xd
+	.byte	0x47
+	.long	0x67c
+	.uleb128 0x1
+	.long	.LASF1208
+	.byte	0xd
+	.byte	0x48
+	.byte	0xe
+	.long	0xe7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0xd
+	.byte	0x49
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0xd
+	.byte	0x4a
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0xd
+	.byte	0x4b
+	.byte	0xe
+	.long	0xe7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1212
+	.byte	0xd
+	.byte	0x4c
+	.byte	0x3
+	.long	0x63b
+	.uleb128 0x8
+	.long	.LASF1213
+	.byte	0x1
+	.byte	0xd
+	.byte	0x4e
+	.long	0x6a2
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0xd
+	.byte	0x4f
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1213
+	.byte	0xd
+	.byte	0x50
+	.byte	0x3
+	.long	0x688
+	.uleb128 0x8
+	.long	.LASF1215
+	.byte	0x8
+	.byte	0xd
+	.byte	0x54
+	.long	0x6fc
+	.uleb128 0xe
+	.string	"min"
+	.byte	0xd
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0xe
+	.string	"max"
+	.byte	0xd
+	.byte	0x56
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0xd
+	.byte	0x57
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0xd
+	.byte	0x58
+	.byte	0xc
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0xd
+	.byte	0x59
+	.byte	0xc
+	.long	0xb7
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1215
+	.byte	0xd
+	.byte	0x5a
+	.byte	0x3
+	.long	0x6ae
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0xe
+	.byte	0x14
+	.long	0x744
+	.uleb128 0x2
+	.long	.LASF1219
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1220
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1221
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1222
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1223
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1224
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1225
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1226
+	.byte	0x40
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1227
+	.byte	0x18
+	.byte	0xe
+	.byte	0x80
+	.long	0x79f
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0xe
+	.byte	0x81
+	.byte	0xd
+	.long	0x79f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0xe
+	.byte	0x82
+	.byte	0xe
+	.long	0xf3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0xe
+	.byte	0x83
+	.byte	0xe
+	.long	0xf3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0xe
+	.byte	0x84
+	.byte	0xe
+	.long	0xf3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1232
+	.byte	0xe
+	.byte	0x85
+	.byte	0xe
+	.long	0xf3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1233
+	.byte	0xe
+	.byte	0x87
+	.byte	0xd
+	.long	0xdb
+	.byte	0x14
+	.byte	0
+	.uleb128 0x10
+	.long	0xdb
+	.long	0x7af
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1234
+	.byte	0xe
+	.byte	0x88
+	.byte	0x3
+	.long	0x744
+	.uleb128 0x8
+	.long	.LASF1235
+	.byte	0x8
+	.byte	0xf
+	.byte	0x16
+	.long	0x809
+	.uleb128 0x1
+	.long	.LASF1236
+	.byte	0xf
+	.byte	0x17
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1237
+	.byte	0xf
+	.byte	0x18
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1238
+	.byte	0xf
+	.byte	0x19
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1239
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1240
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0xe7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1241
+	.byte	0xf
+	.byte	0x1c
+	.byte	0x3
+	.long	0x7bb
+	.uleb128 0x8
+	.long	.LASF1242
+	.byte	0x50
+	.byte	0xf
+	.byte	0x1e
+	.long	0x8a4
+	.uleb128 0x1
+	.long	.LASF1243
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xc
+	.long	0x1aa
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1244
+	.byte	0xf
+	.byte	0x20
+	.byte	0xb
+	.long	0x8b3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0xf
+	.byte	0x21
+	.byte	0xb
+	.long	0x8bd
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0xf
+	.byte	0x22
+	.byte	0xb
+	.long	0x8bd
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1247
+	.byte	0xf
+	.byte	0x23
+	.byte	0xc
+	.long	0x1aa
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1248
+	.byte	0xf
+	.byte	0x24
+	.byte	0xc
+	.long	0x1aa
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1249
+	.byte	0xf
+	.byte	0x25
+	.byte	0xb
+	.long	0x8bd
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1250
+	.byte	0xf
+	.byte	0x26
+	.byte	0xc
+	.long	0x8d2
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1251
+	.byte	0xf
+	.byte	0x27
+	.byte	0xb
+	.long	0x8bd
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1252
+	.byte	0xf
+	.byte	0x28
+	.byte	0xc
+	.long	0x1aa
+	.byte	0x48
+	.byte	0
+	.uleb128 0x24
+	.long	0x17f
+	.long	0x8b3
+	.uleb128 0x6
+	.long	0x17f
+	.byte	0
+	.uleb128 0xb
+	.long	0x8a4
+	.uleb128 0x25
+	.long	0x17f
+	.uleb128 0xb
+	.long	0x8b8
+	.uleb128 0x26
+	.long	0x8d2
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x6
+	.long	0xe7
+	.byte	0
+	.uleb128 0xb
+	.long	0x8c2
+	.uleb128 0x3
+	.long	.LASF1253
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x3
+	.long	0x815
+	.uleb128 0x27
+	.long	0x8d7
+	.uleb128 0x8
+	.long	.LASF1254
+	.byte	0x10
+	.byte	0xf
+	.byte	0x2c
+	.long	0x929
+	.uleb128 0x1
+	.long	.LASF1255
+	.byte	0xf
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x929
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1256
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1257
+	.byte	0xf
+	.byte	0x30
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0xf
+	.byte	0x31
+	.byte	0x9
+	.long	0x17f
+	.byte	0xc
+	.byte	0
+	.uleb128 0xb
+	.long	0x8e3
+	.uleb128 0x3
+	.long	.LASF1259
+	.byte	0xf
+	.byte	0x32
+	.byte	0x3
+	.long	0x8e8
+	.uleb128 0x8
+	.long	.LASF1260
+	.byte	0x12
+	.byte	0x10
+	.byte	0x3d
+	.long	0x995
+	.uleb128 0x1
+	.long	.LASF1261
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xd
+	.long	0x995
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1262
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1263
+	.byte	0x10
+	.byte	0x40
+	.byte	0xe
+	.long	0xe7
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1264
+	.byte	0x10
+	.byte	0x41
+	.byte	0xe
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1265
+	.byte	0x10
+	.byte	0x42
+	.byte	0xe
+	.long	0xe7
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1266
+	.byte	0x10
+	.byte	0x43
+	.byte	0xd
+	.long	0xdb
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0xdb
+	.long	0x9a5
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1267
+	.byte	0x10
+	.byte	0x44
+	.byte	0x3
+	.long	0x93a
+	.uleb128 0x8
+	.long	.LASF1268
+	.byte	0x6
+	.byte	0x11
+	.byte	0x14
+	.long	0x9e5
+	.uleb128 0x1
+	.long	.LASF1269
+	.byte	0x11
+	.byte	0x15
+	.byte	0xe
+	.long	0xe7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1270
+	.byte	0x11
+	.byte	0x16
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1271
+	.byte	0x11
+	.byte	0x17
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1272
+	.byte	0x11
+	.byte	0x18
+	.byte	0x3
+	.long	0x9b1
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x12
+	.byte	0x14
+	.long	0xa87
+	.uleb128 0x2
+	.long	.LASF1273
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1274
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1275
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1276
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1277
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1280
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1281
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1282
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1283
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1284
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1285
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1286
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1287
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1288
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1289
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1290
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1291
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1292
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1293
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1294
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1295
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1296
+	.byte	0x12
+	.byte	0x2d
+	.byte	0x3
+	.long	0x9f1
+	.uleb128 0x8
+	.long	.LASF1297
+	.byte	0x8
+	.byte	0x12
+	.byte	0x65
+	.long	0xad4
+	.uleb128 0x1
+	.long	.LASF1298
+	.byte	0x12
+	.byte	0x66
+	.byte	0xd
+	.long	0xa87
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1299
+	.byte	0x12
+	.byte	0x67
+	.byte	0xd
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1300
+	.byte	0x12
+	.byte	0x6d
+	.byte	0xd
+	.long	0xdb
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1301
+	.byte	0x12
+	.byte	0x6e
+	.byte	0xd
+	.long	0xdb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1302
+	.byte	0x12
+	.byte	0x6f
+	.byte	0x3
+	.long	0xa93
+	.uleb128 0x8
+	.long	.LASF1303
+	.byte	0x6
+	.byte	0x12
+	.byte	0x73
+	.long	0xb3b
+	.uleb128 0x1
+	.long	.LASF1304
+	.byte	0x12
+	.byte	0x74
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1305
+	.byte	0x12
+	.byte	0x75
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1306
+	.byte	0x12
+	.byte	0x76
+	.byte	0xd
+	.long	0xdb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1307
+	.byte	0x12
+	.byte	0x77
+	.byte	0xd
+	.long	0xdb
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1308
+	.byte	0x12
+	.byte	0x78
+	.byte	0xd
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1309
+	.byte	0x12
+	.byte	0x79
+	.byte	0xd
+	.long	0xdb
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1310
+	.byte	0x12
+	.byte	0x7a
+	.byte	0x3
+	.long	0xae0
+	.uleb128 0x1a
+	.long	.LASF1311
+	.long	0x3c
+	.byte	0x13
+	.byte	0x14
+	.long	0xb69
+	.uleb128 0x2
+	.long	.LASF1312
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1313
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1314
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1315
+	.byte	0x1
+	.byte	0x13
+	.byte	0x1a
+	.long	0xb83
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1317
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0xb69
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x14
+	.byte	0x1c
+	.long	0xbc5
+	.uleb128 0x2
+	.long	.LASF1318
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1319
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1320
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1321
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1322
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1324
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x14
+	.byte	0x26
+	.long	0xc07
+	.uleb128 0x2
+	.long	.LASF1325
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1326
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1327
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1328
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1329
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1332
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1333
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1334
+	.byte	0x14
+	.byte	0x30
+	.byte	0x3
+	.long	0xbc5
+	.uleb128 0x8
+	.long	.LASF1335
+	.byte	0xc
+	.byte	0x14
+	.byte	0x32
+	.long	0xc47
+	.uleb128 0x1
+	.long	.LASF1336
+	.byte	0x14
+	.byte	0x33
+	.byte	0x14
+	.long	0xc07
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1337
+	.byte	0x14
+	.byte	0x34
+	.byte	0x14
+	.long	0xc07
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1338
+	.byte	0x14
+	.byte	0x35
+	.byte	0x14
+	.long	0xc07
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1339
+	.byte	0x14
+	.byte	0x36
+	.byte	0x3
+	.long	0xc13
+	.uleb128 0x8
+	.long	.LASF1340
+	.byte	0x10
+	.byte	0x14
+	.byte	0x39
+	.long	0xcae
+	.uleb128 0x1
+	.long	.LASF1341
+	.byte	0x14
+	.byte	0x3a
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1342
+	.byte	0x14
+	.byte	0x3b
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1343
+	.byte	0x14
+	.byte	0x3c
+	.byte	0xd
+	.long	0xdb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1344
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xd
+	.long	0xdb
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1345
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xd
+	.long	0x48d
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1346
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xd
+	.long	0xcf
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1347
+	.byte	0x14
+	.byte	0x40
+	.byte	0x3
+	.long	0xc53
+	.uleb128 0x8
+	.long	.LASF1348
+	.byte	0x10
+	.byte	0x15
+	.byte	0x1f
+	.long	0xcfb
+	.uleb128 0x1
+	.long	.LASF1349
+	.byte	0x15
+	.byte	0x20
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0x15
+	.byte	0x21
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1351
+	.byte	0x15
+	.byte	0x22
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1352
+	.byte	0x15
+	.byte	0x23
+	.byte	0xb
+	.long	0x1b0
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1353
+	.byte	0x15
+	.byte	0x24
+	.byte	0x3
+	.long	0xcba
+	.uleb128 0x8
+	.long	.LASF1354
+	.byte	0x2
+	.byte	0x16
+	.byte	0x27
+	.long	0xd2b
+	.uleb128 0xe
+	.string	"xy"
+	.byte	0x16
+	.byte	0x28
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0xe
+	.string	"z"
+	.byte	0x16
+	.byte	0x29
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1355
+	.byte	0x16
+	.byte	0x2a
+	.byte	0x3
+	.long	0xd07
+	.uleb128 0x8
+	.long	.LASF1356
+	.byte	0x8
+	.byte	0x17
+	.byte	0x24
+	.long	0xd78
+	.uleb128 0x1
+	.long	.LASF1357
+	.byte	0x17
+	.byte	0x25
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1358
+	.byte	0x17
+	.byte	0x26
+	.byte	0xe
+	.long	0xe7
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1359
+	.byte	0x17
+	.byte	0x27
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0x17
+	.byte	0x28
+	.byte	0xe
+	.long	0xe7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1361
+	.byte	0x17
+	.byte	0x29
+	.byte	0x3
+	.long	0xd37
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x18
+	.byte	0x1c
+	.long	0xda8
+	.uleb128 0x2
+	.long	.LASF1362
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1363
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1364
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1365
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1366
+	.byte	0x18
+	.byte	0x21
+	.byte	0x3
+	.long	0xd84
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x18
+	.byte	0x23
+	.long	0xdcc
+	.uleb128 0x2
+	.long	.LASF1367
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1368
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1369
+	.byte	0x18
+	.byte	0x26
+	.byte	0x3
+	.long	0xdb4
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x18
+	.byte	0x28
+	.long	0xdf0
+	.uleb128 0x2
+	.long	.LASF1370
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1371
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1372
+	.byte	0x18
+	.byte	0x2b
+	.byte	0x3
+	.long	0xdd8
+	.uleb128 0x8
+	.long	.LASF1373
+	.byte	0x20
+	.byte	0x18
+	.byte	0x2c
+	.long	0xe71
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x18
+	.byte	0x2d
+	.byte	0x19
+	.long	0xda8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x18
+	.byte	0x2e
+	.byte	0xd
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x17
+	.long	0x19e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x18
+	.byte	0x30
+	.byte	0x8
+	.long	0x1b0
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x18
+	.byte	0x31
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x18
+	.byte	0x32
+	.byte	0x1b
+	.long	0xdcc
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x18
+	.byte	0x33
+	.byte	0x11
+	.long	0xdf0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x18
+	.byte	0x34
+	.byte	0xe
+	.long	0xe7
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1382
+	.byte	0x18
+	.byte	0x35
+	.byte	0x3
+	.long	0xdfc
+	.uleb128 0x8
+	.long	.LASF1383
+	.byte	0xa
+	.byte	0x19
+	.byte	0x18
+	.long	0xed8
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x19
+	.byte	0x19
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x19
+	.byte	0x1a
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x19
+	.byte	0x1b
+	.byte	0xd
+	.long	0xdb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x19
+	.byte	0x1d
+	.byte	0xe
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x19
+	.byte	0x1e
+	.byte	0xe
+	.long	0xe7
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0x19
+	.byte	0x21
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1390
+	.byte	0x19
+	.byte	0x22
+	.byte	0x3
+	.long	0xe7d
+	.uleb128 0x8
+	.long	.LASF1391
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x14
+	.long	0xf18
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0x1a
+	.byte	0x15
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0x1a
+	.byte	0x16
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x1a
+	.byte	0x17
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1395
+	.byte	0x1a
+	.byte	0x18
+	.byte	0x3
+	.long	0xee4
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x1b
+	.byte	0x15
+	.long	0xf42
+	.uleb128 0x2
+	.long	.LASF1396
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1397
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1398
+	.byte	0x4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1404
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x1b
+	.byte	0x34
+	.long	0xf78
+	.uleb128 0x2
+	.long	.LASF1399
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1400
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1401
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1403
+	.byte	0x10
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1405
+	.byte	0x1b
+	.byte	0x40
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x1c
+	.byte	0x14
+	.long	0x1025
+	.uleb128 0x2
+	.long	.LASF1406
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1408
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1409
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1410
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1411
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1412
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1413
+	.byte	0x80
+	.uleb128 0x12
+	.long	.LASF1414
+	.value	0x100
+	.uleb128 0x12
+	.long	.LASF1415
+	.value	0x200
+	.uleb128 0x12
+	.long	.LASF1416
+	.value	0x400
+	.uleb128 0x12
+	.long	.LASF1417
+	.value	0x800
+	.uleb128 0x12
+	.long	.LASF1418
+	.value	0x1000
+	.uleb128 0x12
+	.long	.LASF1419
+	.value	0x2000
+	.uleb128 0x12
+	.long	.LASF1420
+	.value	0x4000
+	.uleb128 0x12
+	.long	.LASF1421
+	.value	0x8000
+	.uleb128 0x15
+	.long	.LASF1422
+	.long	0x10000
+	.uleb128 0x15
+	.long	.LASF1423
+	.long	0x20000
+	.uleb128 0x15
+	.long	.LASF1424
+	.long	0x40000
+	.uleb128 0x15
+	.long	.LASF1425
+	.long	0x80000
+	.uleb128 0x15
+	.long	.LASF1426
+	.long	0x100000
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1427
+	.value	0x218
+	.byte	0x1d
+	.byte	0x14
+	.long	0x1168
+	.uleb128 0x1
+	.long	.LASF1428
+	.byte	0x1d
+	.byte	0x15
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1429
+	.byte	0x1d
+	.byte	0x17
+	.byte	0x12
+	.long	0x424
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x1d
+	.byte	0x19
+	.byte	0x19
+	.long	0xb3b
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0x1d
+	.byte	0x1b
+	.byte	0xd
+	.long	0xdb
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF1432
+	.byte	0x1d
+	.byte	0x1c
+	.byte	0xe
+	.long	0xe7
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF1434
+	.byte	0x1d
+	.byte	0x21
+	.byte	0x19
+	.long	0x509
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1435
+	.byte	0x1d
+	.byte	0x24
+	.byte	0xd
+	.long	0xdb
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x1d
+	.byte	0x25
+	.byte	0xb
+	.long	0x1b0
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1437
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x13
+	.long	0xd2b
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x17
+	.long	0xcfb
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xdb
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0x1f
+	.long	0x1168
+	.byte	0x84
+	.uleb128 0x7
+	.long	.LASF1441
+	.byte	0x1d
+	.byte	0x30
+	.byte	0xd
+	.long	0xdb
+	.value	0x1c4
+	.uleb128 0x7
+	.long	.LASF1442
+	.byte	0x1d
+	.byte	0x31
+	.byte	0xd
+	.long	0xdb
+	.value	0x1c5
+	.uleb128 0x7
+	.long	.LASF1443
+	.byte	0x1d
+	.byte	0x32
+	.byte	0xd
+	.long	0xdb
+	.value	0x1c6
+	.uleb128 0x7
+	.long	.LASF1444
+	.byte	0x1d
+	.byte	0x33
+	.byte	0xd
+	.long	0xdb
+	.value	0x1c7
+	.uleb128 0x7
+	.long	.LASF1445
+	.byte	0x1d
+	.byte	0x35
+	.byte	0xe
+	.long	0xe7
+	.value	0x1c8
+	.uleb128 0x7
+	.long	.LASF1446
+	.byte	0x1d
+	.byte	0x36
+	.byte	0xd
+	.long	0xdb
+	.value	0x1ca
+	.uleb128 0x7
+	.long	.LASF1447
+	.byte	0x1d
+	.byte	0x39
+	.byte	0x12
+	.long	0x1178
+	.value	0x1cc
+	.uleb128 0x7
+	.long	.LASF1448
+	.byte	0x1d
+	.byte	0x3c
+	.byte	0x16
+	.long	0x809
+	.value	0x20c
+	.uleb128 0x7
+	.long	.LASF1449
+	.byte	0x1d
+	.byte	0x3f
+	.byte	0x13
+	.long	0x62f
+	.value	0x214
+	.uleb128 0x7
+	.long	.LASF1450
+	.byte	0x1d
+	.byte	0x42
+	.byte	0x14
+	.long	0xb83
+	.value	0x216
+	.byte	0
+	.uleb128 0x10
+	.long	0xad4
+	.long	0x1178
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x27
+	.byte	0
+	.uleb128 0x10
+	.long	0x6fc
+	.long	0x1188
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1451
+	.byte	0x1d
+	.byte	0x47
+	.byte	0x3
+	.long	0x1025
+	.uleb128 0x1b
+	.long	.LASF1452
+	.value	0x7dc
+	.byte	0x1e
+	.byte	0x17
+	.long	0x13cb
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x1e
+	.byte	0x18
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x1e
+	.byte	0x19
+	.byte	0xe
+	.long	0xf3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x1e
+	.byte	0x1a
+	.byte	0xe
+	.long	0xe7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x1e
+	.byte	0x1b
+	.byte	0xd
+	.long	0xdb
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0xd
+	.long	0xdb
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x1e
+	.byte	0x1d
+	.byte	0xd
+	.long	0xdb
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0x1e
+	.byte	0x1e
+	.byte	0xd
+	.long	0xdb
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x1e
+	.byte	0x20
+	.byte	0x12
+	.long	0x13cb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x1e
+	.byte	0x23
+	.byte	0x19
+	.long	0x9e5
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x16
+	.long	0x67c
+	.byte	0xd6
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x1e
+	.byte	0x26
+	.byte	0xe
+	.long	0xe7
+	.byte	0xde
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x1e
+	.byte	0x27
+	.byte	0xe
+	.long	0xe7
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x1e
+	.byte	0x28
+	.byte	0xe
+	.long	0xe7
+	.byte	0xe2
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x1e
+	.byte	0x2c
+	.byte	0x1d
+	.long	0xc47
+	.byte	0xe4
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x1e
+	.byte	0x2d
+	.byte	0x16
+	.long	0xf18
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0xc
+	.long	0xb7
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0x1e
+	.byte	0x30
+	.byte	0xd
+	.long	0xdb
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF1470
+	.byte	0x1e
+	.byte	0x31
+	.byte	0xe
+	.long	0xe7
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF1471
+	.byte	0x1e
+	.byte	0x32
+	.byte	0xe
+	.long	0xe7
+	.byte	0xfa
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0x1e
+	.byte	0x33
+	.byte	0xe
+	.long	0xe7
+	.byte	0xfc
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x1e
+	.byte	0x34
+	.byte	0xd
+	.long	0xdb
+	.byte	0xfe
+	.uleb128 0x7
+	.long	.LASF1474
+	.byte	0x1e
+	.byte	0x35
+	.byte	0xe
+	.long	0xe7
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1475
+	.byte	0x1e
+	.byte	0x36
+	.byte	0xe
+	.long	0xe7
+	.value	0x102
+	.uleb128 0x7
+	.long	.LASF1476
+	.byte	0x1e
+	.byte	0x38
+	.byte	0x12
+	.long	0xd78
+	.value	0x104
+	.uleb128 0x7
+	.long	.LASF1477
+	.byte	0x1e
+	.byte	0x3a
+	.byte	0xe
+	.long	0xe7
+	.value	0x10c
+	.uleb128 0x7
+	.long	.LASF1478
+	.byte	0x1e
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x49d
+	.value	0x10e
+	.uleb128 0x7
+	.long	.LASF1479
+	.byte	0x1e
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x49d
+	.value	0x114
+	.uleb128 0x7
+	.long	.LASF1480
+	.byte	0x1e
+	.byte	0x3d
+	.byte	0x14
+	.long	0xcae
+	.value	0x11c
+	.uleb128 0x7
+	.long	.LASF1481
+	.byte	0x1e
+	.byte	0x3f
+	.byte	0x15
+	.long	0xed8
+	.value	0x12c
+	.uleb128 0x7
+	.long	.LASF1482
+	.byte	0x1e
+	.byte	0x41
+	.byte	0x10
+	.long	0x9a5
+	.value	0x136
+	.uleb128 0x7
+	.long	.LASF1483
+	.byte	0x1e
+	.byte	0x42
+	.byte	0x1a
+	.long	0x2eb
+	.value	0x148
+	.uleb128 0x7
+	.long	.LASF1484
+	.byte	0x1e
+	.byte	0x44
+	.byte	0xd
+	.long	0xdb
+	.value	0x14c
+	.uleb128 0x7
+	.long	.LASF1485
+	.byte	0x1e
+	.byte	0x45
+	.byte	0xd
+	.long	0xdb
+	.value	0x14d
+	.uleb128 0x7
+	.long	.LASF1486
+	.byte	0x1e
+	.byte	0x46
+	.byte	0xd
+	.long	0xdb
+	.value	0x14e
+	.uleb128 0x7
+	.long	.LASF1487
+	.byte	0x1e
+	.byte	0x48
+	.byte	0x16
+	.long	0x6a2
+	.value	0x14f
+	.uleb128 0x7
+	.long	.LASF1488
+	.byte	0x1e
+	.byte	0x49
+	.byte	0xc
+	.long	0xb7
+	.value	0x150
+	.uleb128 0x7
+	.long	.LASF1489
+	.byte	0x1e
+	.byte	0x4f
+	.byte	0x14
+	.long	0x7af
+	.value	0x154
+	.uleb128 0x7
+	.long	.LASF1490
+	.byte	0x1e
+	.byte	0x51
+	.byte	0x17
+	.long	0xe71
+	.value	0x16c
+	.uleb128 0x7
+	.long	.LASF1491
+	.byte	0x1e
+	.byte	0x53
+	.byte	0xd
+	.long	0xdb
+	.value	0x18c
+	.uleb128 0x7
+	.long	.LASF1492
+	.byte	0x1e
+	.byte	0x5a
+	.byte	0xf
+	.long	0x13db
+	.value	0x190
+	.uleb128 0x7
+	.long	.LASF1493
+	.byte	0x1e
+	.byte	0x5b
+	.byte	0xd
+	.long	0xdb
+	.value	0x7d8
+	.byte	0
+	.uleb128 0x10
+	.long	0x5fc
+	.long	0x13db
+	.uleb128 0x11
+	.long	0x43
+	.byte	0xb
+	.byte	0
+	.uleb128 0x10
+	.long	0x1188
+	.long	0x13eb
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1452
+	.byte	0x1e
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1194
+	.uleb128 0x13
+	.long	.LASF1494
+	.byte	0x1e
+	.byte	0x5e
+	.byte	0x11
+	.long	0x13eb
+	.uleb128 0x13
+	.long	.LASF1495
+	.byte	0x1e
+	.byte	0x5f
+	.byte	0x13
+	.long	0x140f
+	.uleb128 0xb
+	.long	0x1188
+	.uleb128 0xc
+	.long	0x3c
+	.byte	0x1f
+	.byte	0x28
+	.long	0x1456
+	.uleb128 0x2
+	.long	.LASF1496
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1497
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1498
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1499
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1500
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1502
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1503
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1504
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1505
+	.byte	0x1f
+	.byte	0x4d
+	.byte	0x3
+	.long	0x1414
+	.uleb128 0x13
+	.long	.LASF1506
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x11
+	.long	0xf3
+	.uleb128 0x13
+	.long	.LASF1507
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x11
+	.long	0xf3
+	.uleb128 0x28
+	.long	.LASF1508
+	.byte	0x1
+	.byte	0x61
+	.byte	0xd
+	.long	0x1490
+	.uleb128 0x9
+	.byte	0x3
+	.quad	failsafe
+	.uleb128 0xb
+	.long	0x92e
+	.uleb128 0xa
+	.long	.LASF1509
+	.byte	0xd
+	.byte	0x6a
+	.long	0x14a6
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1514
+	.byte	0x1f
+	.byte	0x6f
+	.uleb128 0x14
+	.long	.LASF1525
+	.byte	0x1b
+	.byte	0x43
+	.byte	0x5
+	.long	0x17f
+	.long	0x14c3
+	.uleb128 0x6
+	.long	0xf3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1510
+	.byte	0x1f
+	.byte	0x6b
+	.long	0x14d9
+	.uleb128 0x6
+	.long	0x1456
+	.uleb128 0x6
+	.long	0x17f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1511
+	.byte	0x1f
+	.byte	0x6a
+	.long	0x14ef
+	.uleb128 0x6
+	.long	0x1456
+	.uleb128 0x6
+	.long	0xf3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1512
+	.byte	0x20
+	.byte	0x25
+	.byte	0xa
+	.long	0xf3
+	.uleb128 0x16
+	.long	.LASF1513
+	.byte	0x20
+	.byte	0x24
+	.byte	0x5
+	.long	0x17f
+	.uleb128 0xf
+	.long	.LASF1515
+	.byte	0x1f
+	.byte	0x6e
+	.uleb128 0xf
+	.long	.LASF1516
+	.byte	0x21
+	.byte	0x2f
+	.uleb128 0xa
+	.long	.LASF1517
+	.byte	0x19
+	.byte	0x2d
+	.long	0x1526
+	.uleb128 0x6
+	.long	0x1526
+	.byte	0
+	.uleb128 0xb
+	.long	0xed8
+	.uleb128 0xa
+	.long	.LASF1518
+	.byte	0x15
+	.byte	0x2e
+	.long	0x153c
+	.uleb128 0x6
+	.long	0x153c
+	.byte	0
+	.uleb128 0xb
+	.long	0xcae
+	.uleb128 0xa
+	.long	.LASF1519
+	.byte	0x17
+	.byte	0x2d
+	.long	0x1552
+	.uleb128 0x6
+	.long	0x153c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1520
+	.byte	0x16
+	.byte	0x2d
+	.long	0x1563
+	.uleb128 0x6
+	.long	0xe7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1521
+	.byte	0x22
+	.byte	0x18
+	.byte	0xa
+	.long	0xf3
+	.uleb128 0xf
+	.long	.LASF1522
+	.byte	0x23
+	.byte	0x17
+	.uleb128 0xa
+	.long	.LASF1523
+	.byte	0x1
+	.byte	0x6b
+	.long	0x158c
+	.uleb128 0x6
+	.long	0x158c
+	.uleb128 0x6
+	.long	0x1490
+	.byte	0
+	.uleb128 0xb
+	.long	0x9a5
+	.uleb128 0xa
+	.long	.LASF1524
+	.byte	0x1
+	.byte	0x6c
+	.long	0x15a2
+	.uleb128 0x6
+	.long	0x1490
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1526
+	.byte	0x1
+	.byte	0x67
+	.byte	0xd
+	.long	0x1490
+	.long	0x15b8
+	.uleb128 0x6
+	.long	0x158c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1527
+	.byte	0x1
+	.byte	0x6a
+	.long	0x15c9
+	.uleb128 0x6
+	.long	0x15c9
+	.byte	0
+	.uleb128 0xb
+	.long	0x2c7
+	.uleb128 0x14
+	.long	.LASF1528
+	.byte	0x1
+	.byte	0x68
+	.byte	0x1b
+	.long	0x15c9
+	.long	0x15e4
+	.uleb128 0x6
+	.long	0x15e4
+	.byte	0
+	.uleb128 0xb
+	.long	0x294
+	.uleb128 0xa
+	.long	.LASF1529
+	.byte	0xa
+	.byte	0x24
+	.long	0x15fa
+	.uleb128 0x6
+	.long	0x2eb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1530
+	.byte	0xd
+	.byte	0x68
+	.byte	0x5
+	.long	0x17f
+	.uleb128 0x14
+	.long	.LASF1531
+	.byte	0x24
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0x1626
+	.uleb128 0x6
+	.long	0xae
+	.uleb128 0x6
+	.long	0x94
+	.uleb128 0x6
+	.long	0xff
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1532
+	.byte	0x1
+	.byte	0x66
+	.long	0x1637
+	.uleb128 0x6
+	.long	0x1637
+	.byte	0
+	.uleb128 0xb
+	.long	0x7af
+	.uleb128 0xf
+	.long	.LASF1533
+	.byte	0x1
+	.byte	0x64
+	.uleb128 0xa
+	.long	.LASF1534
+	.byte	0x1
+	.byte	0x69
+	.long	0x1659
+	.uleb128 0x6
+	.long	0x5af
+	.uleb128 0x6
+	.long	0x1659
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fc
+	.uleb128 0xf
+	.long	.LASF1535
+	.byte	0x1
+	.byte	0x70
+	.uleb128 0xa
+	.long	.LASF1536
+	.byte	0x22
+	.byte	0x1f
+	.long	0x1676
+	.uleb128 0x6
+	.long	0xdb
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1537
+	.byte	0x1
+	.byte	0x6f
+	.byte	0x5
+	.long	0x17f
+	.long	0x16a0
+	.uleb128 0x6
+	.long	0x16a0
+	.uleb128 0x6
+	.long	0xe7
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x6
+	.long	0xc3
+	.uleb128 0x6
+	.long	0x153c
+	.byte	0
+	.uleb128 0xb
+	.long	0xc47
+	.uleb128 0xa
+	.long	.LASF1538
+	.byte	0x1b
+	.byte	0x44
+	.long	0x16b6
+	.uleb128 0x6
+	.long	0xf3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1539
+	.byte	0x1a
+	.byte	0x1b
+	.long	0x16c7
+	.uleb128 0x6
+	.long	0x16c7
+	.byte	0
+	.uleb128 0xb
+	.long	0xf18
+	.uleb128 0xa
+	.long	.LASF1540
+	.byte	0xb
+	.byte	0x2b
+	.long	0x16dd
+	.uleb128 0x6
+	.long	0x16dd
+	.byte	0
+	.uleb128 0xb
+	.long	0x32b
+	.uleb128 0x14
+	.long	.LASF1541
+	.byte	0x1c
+	.byte	0x2c
+	.byte	0x5
+	.long	0x17f
+	.long	0x16f8
+	.uleb128 0x6
+	.long	0xf3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1542
+	.byte	0x7
+	.byte	0x20
+	.long	0x1709
+	.uleb128 0x6
+	.long	0x173
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1543
+	.byte	0x25
+	.byte	0x33
+	.uleb128 0xa
+	.long	.LASF1544
+	.byte	0x22
+	.byte	0x16
+	.long	0x1721
+	.uleb128 0x6
+	.long	0xf3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1545
+	.byte	0x22
+	.byte	0x14
+	.uleb128 0xf
+	.long	.LASF1546
+	.byte	0x1c
+	.byte	0x36
+	.uleb128 0xf
+	.long	.LASF1547
+	.byte	0x1c
+	.byte	0x3c
+	.uleb128 0xf
+	.long	.LASF1548
+	.byte	0x1c
+	.byte	0x34
+	.uleb128 0xf
+	.long	.LASF1549
+	.byte	0x1
+	.byte	0x63
+	.uleb128 0x1c
+	.long	.LASF1550
+	.value	0x21e
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x176f
+	.uleb128 0x9
+	.quad	.LVL79
+	.long	0x1495
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1558
+	.byte	0x1
+	.value	0x213
+	.byte	0x5
+	.long	0x94
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17ba
+	.uleb128 0x9
+	.quad	.LVL76
+	.long	0x195b
+	.uleb128 0x9
+	.quad	.LVL77
+	.long	0x17ba
+	.uleb128 0x9
+	.quad	.LVL78
+	.long	0x14a6
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1551
+	.value	0x1da
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x195b
+	.uleb128 0x1d
+	.long	.LASF1552
+	.value	0x1de
+	.byte	0xe
+	.long	0xf3
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x9
+	.quad	.LVL57
+	.long	0x1507
+	.uleb128 0x9
+	.quad	.LVL58
+	.long	0x14fb
+	.uleb128 0x5
+	.quad	.LVL60
+	.long	0x14d9
+	.long	0x1822
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL61
+	.long	0x14c3
+	.long	0x183e
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL62
+	.long	0x14c3
+	.long	0x185a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL63
+	.long	0x14c3
+	.long	0x1876
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL64
+	.long	0x14c3
+	.long	0x1892
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL65
+	.long	0x14c3
+	.long	0x18ae
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL66
+	.long	0x14ad
+	.long	0x18c5
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL67
+	.long	0x14c3
+	.long	0x18dc
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL68
+	.long	0x14ad
+	.long	0x18f3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL69
+	.long	0x14c3
+	.long	0x190a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL70
+	.long	0x16e2
+	.long	0x1923
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3e
+	.byte	0x24
+	.byte	0
+	.uleb128 0x2a
+	.quad	.LVL72
+	.long	0x14c3
+	.long	0x193a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x37
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL73
+	.long	0x14ef
+	.uleb128 0x1e
+	.quad	.LVL75
+	.long	0x14ad
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1559
+	.byte	0x1
+	.byte	0xc5
+	.byte	0x6
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2c
+	.string	"i"
+	.byte	0x1
+	.byte	0xc7
+	.byte	0xd
+	.long	0xdb
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1f
+	.long	.LASF1553
+	.byte	0xc8
+	.long	0x294
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1f
+	.long	.LASF1554
+	.byte	0xc9
+	.long	0x32b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -51
+	.uleb128 0x2d
+	.long	.LASF1555
+	.byte	0x1
+	.byte	0xca
+	.byte	0x9
+	.long	0x17f
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1d
+	.long	.LASF1556
+	.value	0x182
+	.byte	0x1f
+	.long	0x15c9
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x9
+	.quad	.LVL1
+	.long	0x173d
+	.uleb128 0x9
+	.quad	.LVL2
+	.long	0x1736
+	.uleb128 0x9
+	.quad	.LVL3
+	.long	0x172f
+	.uleb128 0x9
+	.quad	.LVL4
+	.long	0x1728
+	.uleb128 0x9
+	.quad	.LVL5
+	.long	0x1721
+	.uleb128 0x5
+	.quad	.LVL6
+	.long	0x1710
+	.long	0x1a22
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL7
+	.long	0x1709
+	.uleb128 0x5
+	.quad	.LVL8
+	.long	0x16f8
+	.long	0x1a46
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL9
+	.long	0x16e2
+	.long	0x1a5f
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL10
+	.long	0x16e2
+	.long	0x1a78
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x800
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL11
+	.long	0x16cc
+	.long	0x1a90
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -51
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL12
+	.long	0x16f8
+	.long	0x1aa7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL13
+	.long	0x16b6
+	.uleb128 0x5
+	.quad	.LVL14
+	.long	0x16a5
+	.long	0x1acb
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL15
+	.long	0x1676
+	.uleb128 0x5
+	.quad	.LVL17
+	.long	0x16f8
+	.long	0x1aef
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL18
+	.long	0x1710
+	.long	0x1b06
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x49
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL19
+	.long	0x1710
+	.long	0x1b1d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x49
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL20
+	.long	0x16f8
+	.long	0x1b34
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL21
+	.long	0x165e
+	.uleb128 0x9
+	.quad	.LVL22
+	.long	0x1643
+	.uleb128 0x9
+	.quad	.LVL23
+	.long	0x163c
+	.uleb128 0x9
+	.quad	.LVL24
+	.long	0x1626
+	.uleb128 0x5
+	.quad	.LVL25
+	.long	0x16e2
+	.long	0x1b7f
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL26
+	.long	0x16e2
+	.long	0x1b97
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL27
+	.long	0x16e2
+	.long	0x1bb0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2000
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL28
+	.long	0x16e2
+	.long	0x1bc9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL29
+	.long	0x16e2
+	.long	0x1be2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL30
+	.long	0x16e2
+	.long	0x1bf9
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL31
+	.long	0x15fa
+	.uleb128 0x5
+	.quad	.LVL32
+	.long	0x16e2
+	.long	0x1c1f
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3f
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL33
+	.long	0x16e2
+	.long	0x1c38
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x40
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL34
+	.long	0x16e2
+	.long	0x1c51
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL35
+	.long	0x15e9
+	.uleb128 0x5
+	.quad	.LVL36
+	.long	0x15ce
+	.long	0x1c76
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL38
+	.long	0x15b8
+	.uleb128 0x5
+	.quad	.LVL39
+	.long	0x16f8
+	.long	0x1c9a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL40
+	.long	0x15a2
+	.long	0x1cb2
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL41
+	.long	0x1591
+	.uleb128 0x5
+	.quad	.LVL42
+	.long	0x1576
+	.long	0x1cd7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL43
+	.long	0x16e2
+	.long	0x1cf0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x40
+	.byte	0x3e
+	.byte	0x24
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL44
+	.long	0x1563
+	.uleb128 0x5
+	.quad	.LVL45
+	.long	0x1541
+	.long	0x1d15
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL46
+	.long	0x152b
+	.long	0x1d2d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL47
+	.long	0x16e2
+	.long	0x1d44
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL48
+	.long	0x150e
+	.uleb128 0x5
+	.quad	.LVL49
+	.long	0x16f8
+	.long	0x1d68
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL52
+	.long	0x1665
+	.long	0x1d7f
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL54
+	.long	0x1515
+	.long	0x1d97
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL55
+	.long	0x156f
+	.uleb128 0x1e
+	.quad	.LVL56
+	.long	0x1552
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x190
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS3:
+	.uleb128 .LVU167
+	.uleb128 .LVU189
+	.uleb128 .LVU191
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL59
+	.byte	0x4
+	.uleb128 .LVL59-.LVL59
+	.uleb128 .LVL71-.LVL59
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL74-.LVL59
+	.uleb128 .LFE12-.LVL59
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+.LLST0:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL17-.LVL17
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU5
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU34
+	.uleb128 .LVU154
+	.uleb128 .LVU155
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL15-.LVL0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL15-.LVL0
+	.uleb128 .LVL16-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.LVL0
+	.uleb128 .LVL52-1-.LVL0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU123
+	.uleb128 .LVU124
+.LLST2:
+	.byte	0x8
+	.quad	.LVL37
+	.uleb128 .LVL38-1-.LVL37
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x5c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL4:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 38 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x28
+	.file 41 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 43 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 44 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2c
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 47 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 49 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x31
+	.file 50 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 54 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 59 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 64 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 81 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 87 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x57
+	.file 88 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 89 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 90 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF935
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x22
+	.byte	0x4
+	.file 91 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 92 ".//src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 93 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5d
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF957
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.file 94 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF958
+	.byte	0x4
+	.byte	0x4
+	.file 95 ".//src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF959
+	.byte	0x4
+	.file 96 ".//src/main/drivers/serial_uart.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x60
+	.file 97 ".//src/main/drivers/serial_rx_frame.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF960
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 98 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 ".//src/main/drivers/accgyro_mpu_int.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF975
+	.byte	0x4
+	.file 100 ".//src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x64
+	.byte	0x4
+	.file 101 ".//src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 102 ".//src/main/drivers/inverter.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x4
+	.file 103 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 104 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x13
+	.byte	0x4
+	.file 105 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 106 ".//src/main/io/display.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 107 ".//src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1055
+	.byte	0x4
+	.file 108 ".//src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x6c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1056
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1057
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1072
+	.byte	0x4
+	.file 109 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1083
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF915
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF940
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.profiling.h.34.071b1e95f4ebee26ff29bf11a1e6ac52,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF943
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF947
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.light_led.h.31.b89a67316a7f14886dd5be52d67e7dfa,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF953
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sound_beeper.h.25.ab784dc9914902476e7be0a6c6051d91,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF956
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial_uart.h.24.1bc399296ceffb0dfdf2f7e2024c7f2a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF966
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pwm_mapping.h.20.6b03fe238617d7e272abe4aa318233de,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.bus_spi.h.20.f74498dce050797d118a429c4c8cce5d,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF977
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.inverter.h.24.a838876c479c2df1fb50bed937a4639a,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF979
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF983
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF986
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF989
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1006
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1013
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1035
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1049
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1054
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1062
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1071
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1080
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.scheduler.h.115.938f6c2ded084b2afd5b0b59fa60d513,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1082
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1426:
+	.string	"FEATURE_DSHOT"
+.LASF1272:
+	.string	"escAndServoConfig_t"
+.LASF1045:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1031:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF939:
+	.string	"HSV_VALUE_MAX 255"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF988:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF1188:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF957:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF1108:
+	.string	"RGB_GREEN"
+.LASF1153:
+	.string	"PIDPITCH"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1233:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1049:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1406:
+	.string	"FEATURE_RX_PPM"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1535:
+	.string	"imuInit"
+.LASF1538:
+	.string	"sensorsSet"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF964:
+	.string	"UART2_TX_BUFFER_SIZE 64"
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1509:
+	.string	"writeAllMotors"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1090:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1255:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1119:
+	.string	"_Bool"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1173:
+	.string	"flightDynamicsTrims_t"
+.LASF915:
+	.string	"U_ID_2 0"
+.LASF1164:
+	.string	"A_level"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF947:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1152:
+	.string	"PIDROLL"
+.LASF1034:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1238:
+	.string	"failsafe_throttle"
+.LASF970:
+	.string	"MAX_SERVOS 8"
+.LASF1534:
+	.string	"mixerInit"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1201:
+	.string	"motorMixer_t"
+.LASF1120:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1331:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1485:
+	.string	"disarm_kill_switch"
+.LASF1046:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF1333:
+	.string	"CW270_DEG_FLIP"
+.LASF1114:
+	.string	"BOOT_STAGE_OUTPUTS"
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF1211:
+	.string	"deadband3d_throttle"
+.LASF1394:
+	.string	"yawDegrees"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1159:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1124:
+	.string	"useParallelPWM"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1438:
+	.string	"barometerConfig"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1400:
+	.string	"GPS_FIX"
+.LASF1540:
+	.string	"adcInit"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1416:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1109:
+	.string	"RGB_BLUE"
+.LASF1102:
+	.string	"uint16_t"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1514:
+	.string	"scheduler"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1216:
+	.string	"middle"
+.LASF1434:
+	.string	"accelerometerTrims"
+.LASF1197:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1486:
+	.string	"small_angle"
+.LASF1146:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF1256:
+	.string	"counter"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1495:
+	.string	"currentProfile"
+.LASF1364:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1442:
+	.string	"yaw_deadband"
+.LASF1251:
+	.string	"isEnabled"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1126:
+	.string	"useRSSIADC"
+.LASF966:
+	.string	"UART3_TX_BUFFER_SIZE 64"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1140:
+	.string	"drv_pwm_config_t"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1401:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF989:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1310:
+	.string	"controlRateConfig_t"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1476:
+	.string	"gyroConfig"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1506:
+	.string	"previousTime"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1294:
+	.string	"BOXSONAR"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1161:
+	.string	"PIDVEL"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1116:
+	.string	"BOOT_STAGE_CALIBRATION"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF960:
+	.string	"SERIAL_RX_FRAME_MAX_SIZE 40"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF967:
+	.string	"MAX_PWM_MOTORS 12"
+.LASF1051:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1227:
+	.string	"serialConfig_s"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF1100:
+	.string	"int32_t"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF993:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF934:
+	.string	"FAST_MATH "
+.LASF925:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF953:
+	.string	"LED1_ON "
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF904:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1458:
+	.string	"pid_process_denom"
+.LASF1536:
+	.string	"failureMode"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1539:
+	.string	"initBoardAlignment"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1471:
+	.string	"gyro_cmpf_factor"
+.LASF931:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1003:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1172:
+	.string	"values"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1010:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1277:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1543:
+	.string	"ledInit"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1041:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1507:
+	.string	"targetPidLooptime"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1346:
+	.string	"baroGroundPressure"
+.LASF1414:
+	.string	"FEATURE_FAILSAFE"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF958:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1463:
+	.string	"motor_pwm_rate"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1181:
+	.string	"MULTITYPE_GIMBAL"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF943:
+	.string	"PROFILE_STAGE_END(stage) profileStageEnd(stage)"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1064:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1025:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1160:
+	.string	"PIDMAG"
+.LASF1267:
+	.string	"rxConfig_t"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF919:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF1202:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF969:
+	.string	"MAX_MOTORS 12"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1345:
+	.string	"gyroZero"
+.LASF1275:
+	.string	"BOXHORIZON"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1459:
+	.string	"emf_avoidance"
+.LASF1330:
+	.string	"CW0_DEG_FLIP"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1266:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1136:
+	.string	"dshotRate"
+.LASF1039:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF1516:
+	.string	"profilingInit"
+.LASF1528:
+	.string	"pwmInit"
+.LASF1166:
+	.string	"dterm_lpf_hz"
+.LASF1237:
+	.string	"failsafe_off_delay"
+.LASF1309:
+	.string	"yawRate"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1484:
+	.string	"retarded_arm"
+.LASF922:
+	.string	"USE_GYRO_SITL "
+.LASF1419:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1320:
+	.string	"SENSOR_BARO"
+.LASF1155:
+	.string	"PIDALT"
+.LASF977:
+	.string	"SPI_18MHZ_CLOCK_DIVIDER 2"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1288:
+	.string	"BOXLLIGHTS"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF965:
+	.string	"UART3_RX_BUFFER_SIZE 128"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1424:
+	.string	"FEATURE_BLACKBOX"
+.LASF1276:
+	.string	"BOXBARO"
+.LASF1435:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1407:
+	.string	"FEATURE_VBAT"
+.LASF1210:
+	.string	"neutral3d"
+.LASF923:
+	.string	"ACC "
+.LASF1157:
+	.string	"PIDPOSR"
+.LASF918:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1178:
+	.string	"MULTITYPE_QUADP"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1047:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF1489:
+	.string	"serialConfig"
+.LASF1179:
+	.string	"MULTITYPE_QUADX"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1177:
+	.string	"MULTITYPE_TRI"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF968:
+	.string	"MAX_PWM_SERVOS 8"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1415:
+	.string	"FEATURE_SONAR"
+.LASF899:
+	.string	"alloca"
+.LASF1549:
+	.string	"initPrintfSupport"
+.LASF1326:
+	.string	"CW0_DEG"
+.LASF1059:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF1169:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1244:
+	.string	"shouldForceLanding"
+.LASF1263:
+	.string	"midrc"
+.LASF1246:
+	.string	"shouldHaveCausedLandingByNow"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1052:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1171:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1091:
+	.string	"__int16_t"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1093:
+	.string	"__uint16_t"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF392:
+	.string	"false 0"
+.LASF978:
+	.string	"INVERTER_OFF ;"
+.LASF926:
+	.string	"USE_BARO_SITL "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1226:
+	.string	"FUNCTION_BLACKBOX"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF1150:
+	.string	"enableCurrentMeter"
+.LASF1470:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1377:
+	.string	"gpsNoFixLatitude"
+.LASF1056:
+	.string	"GYRO_SYNC_TIMEOUT_PERIODS 4"
+.LASF1526:
+	.string	"failsafeInit"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF713:
+	.string	"__size_t "
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF959:
+	.string	"SOFT_SERIAL_BUFFER_SIZE 256"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1369:
+	.string	"frskyGpsCoordFormat_e"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1252:
+	.string	"enable"
+.LASF1433:
+	.string	"mag_declination"
+.LASF1323:
+	.string	"SENSOR_GPS"
+.LASF935:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1069:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF1084:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1453:
+	.string	"mixerConfiguration"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1410:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1409:
+	.string	"FEATURE_RX_SERIAL"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1032:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1235:
+	.string	"failsafeConfig_s"
+.LASF358:
+	.string	"__k8 1"
+.LASF1095:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1022:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF956:
+	.string	"BEEP_ON "
+.LASF1123:
+	.string	"float"
+.LASF948:
+	.string	"LED0_TOGGLE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1105:
+	.string	"long long int"
+.LASF1385:
+	.string	"vbatmaxcellvoltage"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1273:
+	.string	"BOXARM"
+.LASF373:
+	.string	"linux 1"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1515:
+	.string	"schedulerInit"
+.LASF921:
+	.string	"GYRO "
+.LASF1264:
+	.string	"mincheck"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1428:
+	.string	"pidController"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF983:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF909:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1289:
+	.string	"BOXCALIB"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1013:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF1412:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1075:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1219:
+	.string	"FUNCTION_NONE"
+.LASF930:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1215:
+	.string	"servoParam_t"
+.LASF1524:
+	.string	"beepcodeInit"
+.LASF1441:
+	.string	"deadband"
+.LASF1134:
+	.string	"useOneshot"
+.LASF1325:
+	.string	"ALIGN_DEFAULT"
+.LASF981:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1285:
+	.string	"BOXBEEPERON"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1519:
+	.string	"gyroStartBootCalibration"
+.LASF508:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1360:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1559:
+	.string	"init"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1082:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF1265:
+	.string	"maxcheck"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF1301:
+	.string	"rangeEndStep"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1132:
+	.string	"airplane"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1461:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF999:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1423:
+	.string	"FEATURE_DISPLAY"
+.LASF1145:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF1240:
+	.string	"failsafe_max_usec"
+.LASF1030:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1316:
+	.string	"gimbal_flags"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF376:
+	.string	"unix 1"
+.LASF997:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1430:
+	.string	"controlRateConfig"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1311:
+	.string	"GimbalFlags"
+.LASF942:
+	.string	"PROFILE_STAGE_BEGIN(stage) profileStageBegin(stage)"
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF940:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1432:
+	.string	"tpa_breakpoint"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1138:
+	.string	"idlePulse"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF916:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1113:
+	.string	"BOOT_STAGE_SIGNAL"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1133:
+	.string	"motorPwmRate"
+.LASF1371:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1373:
+	.string	"telemetryConfig_s"
+.LASF1382:
+	.string	"telemetryConfig_t"
+.LASF1017:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1154:
+	.string	"PIDYAW"
+.LASF954:
+	.string	"BEEP_TOGGLE "
+.LASF1505:
+	.string	"cfTaskId_e"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1245:
+	.string	"hasTimerElapsed"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1189:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1127:
+	.string	"useVbat"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1493:
+	.string	"current_profile_index"
+.LASF1040:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1464:
+	.string	"dshot_rate"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1344:
+	.string	"calibrated"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1260:
+	.string	"rxConfig_s"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1111:
+	.string	"BOOT_STAGE_BUSES"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF996:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF961:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF908:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF1104:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1101:
+	.string	"uint8_t"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1196:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF1370:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1494:
+	.string	"masterConfig"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1481:
+	.string	"batteryConfig"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1357:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF1398:
+	.string	"ARMED"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1466:
+	.string	"sensorAlignmentConfig"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1000:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1248:
+	.string	"updateState"
+.LASF1520:
+	.string	"accSetCalibrationCycles"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1292:
+	.string	"BOXTELEMETRY"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1296:
+	.string	"boxId_e"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1036:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF936:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1408:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1221:
+	.string	"FUNCTION_CLI"
+.LASF1512:
+	.string	"gyroSyncGetLoopPeriod"
+.LASF975:
+	.string	"ADC_CHANNEL_COUNT (ADC_CHANNEL_MAX + 1)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF995:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1024:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1479:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1002:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1137:
+	.string	"servoPwmRate"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1268:
+	.string	"escAndServoConfig_s"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF985:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1074:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1191:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF1079:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1198:
+	.string	"MULTITYPE_CUSTOM"
+.LASF1006:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1071:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1148:
+	.string	"drv_adc_config_t"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1115:
+	.string	"BOOT_STAGE_FEATURES"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF991:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF917:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1557:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1306:
+	.string	"thrMid8"
+.LASF1313:
+	.string	"GIMBAL_MIXTILT"
+.LASF1218:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1042:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF1368:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1043:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1213:
+	.string	"airplaneConfig_t"
+.LASF1300:
+	.string	"rangeStartStep"
+.LASF982:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF1359:
+	.string	"soft_gyro_notch_hz"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF973:
+	.string	"MAX_INPUTS 8"
+.LASF1322:
+	.string	"SENSOR_SONAR"
+.LASF963:
+	.string	"UART2_RX_BUFFER_SIZE 128"
+.LASF976:
+	.string	"SPI_0_5625MHZ_CLOCK_DIVIDER 128"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF1522:
+	.string	"blackboxInit"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1448:
+	.string	"failsafeConfig"
+.LASF941:
+	.string	"PROFILE_HISTOGRAM_BUCKET_COUNT 10"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF1319:
+	.string	"SENSOR_ACC"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1205:
+	.string	"tri_unarmed_servo"
+.LASF1335:
+	.string	"sensorAlignmentConfig_s"
+.LASF1339:
+	.string	"sensorAlignmentConfig_t"
+.LASF1020:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1456:
+	.string	"gyro_sync"
+.LASF1168:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1078:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF733:
+	.string	"NULL"
+.LASF1399:
+	.string	"GPS_FIX_HOME"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF1028:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF1170:
+	.string	"pitch"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF1278:
+	.string	"BOXHEADFREE"
+.LASF462:
+	.string	"__PMT"
+.LASF1491:
+	.string	"blackbox_rate_denom"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1375:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1163:
+	.string	"pidProfile_s"
+.LASF1167:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1550:
+	.string	"HardFault_Handler"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1225:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF1220:
+	.string	"FUNCTION_MSP"
+.LASF1338:
+	.string	"mag_align"
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1404:
+	.string	"armingFlags"
+.LASF1523:
+	.string	"rxInit"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF808:
+	.string	"__off_t_defined "
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1187:
+	.string	"MULTITYPE_OCTOX8"
+.LASF1392:
+	.string	"rollDegrees"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1125:
+	.string	"usePPM"
+.LASF1241:
+	.string	"failsafeConfig_t"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1076:
+	.string	"UNIT_TESTED "
+.LASF1541:
+	.string	"feature"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1149:
+	.string	"enableRSSI"
+.LASF1542:
+	.string	"bootStageEnd"
+.LASF472:
+	.string	"__P(args) args"
+.LASF1029:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1027:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1287:
+	.string	"BOXLEDLOW"
+.LASF1354:
+	.string	"accDeadband_s"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1204:
+	.string	"yaw_direction"
+.LASF1072:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1531:
+	.string	"memset"
+.LASF1450:
+	.string	"gimbalConfig"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1363:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF946:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1065:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF907:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1062:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1098:
+	.string	"int8_t"
+.LASF1060:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1180:
+	.string	"MULTITYPE_BI"
+.LASF1496:
+	.string	"TASK_SYSTEM"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF735:
+	.string	"__need_NULL"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1388:
+	.string	"currentMeterOffset"
+.LASF937:
+	.string	"HSV_HUE_MAX 359"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1048:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1165:
+	.string	"H_level"
+.LASF1243:
+	.string	"reset"
+.LASF1445:
+	.string	"throttle_correction_angle"
+.LASF1545:
+	.string	"systemInit"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1336:
+	.string	"gyro_align"
+.LASF902:
+	.string	"_STRING_H 1"
+.LASF1350:
+	.string	"baro_noise_lpf"
+.LASF1518:
+	.string	"baroStartBootCalibration"
+.LASF1270:
+	.string	"maxthrottle"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1099:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1085:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1088:
+	.string	"signed char"
+.LASF1239:
+	.string	"failsafe_min_usec"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1297:
+	.string	"modeActivationCondition_s"
+.LASF1302:
+	.string	"modeActivationCondition_t"
+.LASF696:
+	.string	"__size_t__ "
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1068:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1203:
+	.string	"mixerConfig_s"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1478:
+	.string	"accZero"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1497:
+	.string	"TASK_GYROPID"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1421:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1121:
+	.string	"SERIAL_INVERTED"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1490:
+	.string	"telemetryConfig"
+.LASF1295:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1391:
+	.string	"boardAlignment_s"
+.LASF1395:
+	.string	"boardAlignment_t"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1280:
+	.string	"BOXCAMSTAB"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1230:
+	.string	"cli_baudrate"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1021:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1533:
+	.string	"timerInit"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1184:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1262:
+	.string	"serialrx_provider"
+.LASF1366:
+	.string	"telemetryProvider_e"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF927:
+	.string	"USE_USART1 "
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF932:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1537:
+	.string	"sensorsAutodetect"
+.LASF1271:
+	.string	"mincommand"
+.LASF1023:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1340:
+	.string	"knownSensors_s"
+.LASF1347:
+	.string	"knownSensors_t"
+.LASF974:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1200:
+	.string	"MultiType"
+.LASF1552:
+	.string	"gyroLooptime"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF928:
+	.string	"USE_USART2 "
+.LASF1396:
+	.string	"OK_TO_ARM"
+.LASF1242:
+	.string	"failsafeVTable_s"
+.LASF1253:
+	.string	"failsafeVTable_t"
+.LASF1384:
+	.string	"vbatscale"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1417:
+	.string	"FEATURE_CURRENT_METER"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1349:
+	.string	"baro_sample_count"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1546:
+	.string	"readEEPROM"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1018:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF984:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1055:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1351:
+	.string	"baro_cf_vel"
+.LASF1551:
+	.string	"configureScheduler"
+.LASF1405:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1232:
+	.string	"gps_passthrough_baudrate"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1096:
+	.string	"long int"
+.LASF1026:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1054:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1329:
+	.string	"CW270_DEG"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1454:
+	.string	"enabledFeatures"
+.LASF1112:
+	.string	"BOOT_STAGE_SENSORS"
+.LASF1480:
+	.string	"knownSensors"
+.LASF1291:
+	.string	"BOXOSD"
+.LASF1362:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1379:
+	.string	"frsky_coordinate_format"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1337:
+	.string	"acc_align"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1324:
+	.string	"SENSOR_GPSMAG"
+.LASF1044:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1193:
+	.string	"MULTITYPE_VTAIL4"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1451:
+	.string	"profile_t"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1131:
+	.string	"extraServos"
+.LASF1499:
+	.string	"TASK_SERIAL"
+.LASF1383:
+	.string	"batteryConfig_s"
+.LASF1390:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1429:
+	.string	"pidProfile"
+.LASF1469:
+	.string	"acc_hardware"
+.LASF924:
+	.string	"USE_ACC_SITL "
+.LASF971:
+	.string	"MAX_PWM_OUTPUT_PORTS MAX_PWM_MOTORS"
+.LASF1103:
+	.string	"uint32_t"
+.LASF1376:
+	.string	"frsky_inversion"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1129:
+	.string	"useLEDStrip"
+.LASF1139:
+	.string	"servoCenterPulse"
+.LASF990:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1397:
+	.string	"PREVENT_ARMING"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF952:
+	.string	"LED1_OFF "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1194:
+	.string	"MULTITYPE_HEX6H"
+.LASF1283:
+	.string	"BOXGPSHOLD"
+.LASF906:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1467:
+	.string	"boardAlignment"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1186:
+	.string	"MULTITYPE_HEX6X"
+.LASF1381:
+	.string	"batterySize"
+.LASF1147:
+	.string	"inputFilteringMode_e"
+.LASF485:
+	.string	"__flexarr []"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1087:
+	.string	"long unsigned int"
+.LASF933:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1279:
+	.string	"BOXHEADADJ"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1452:
+	.string	"master_t"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF949:
+	.string	"LED0_OFF "
+.LASF972:
+	.string	"PULSE_1MS (1000)"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1498:
+	.string	"TASK_RX"
+.LASF1356:
+	.string	"gyroConfig_s"
+.LASF1361:
+	.string	"gyroConfig_t"
+.LASF945:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1282:
+	.string	"BOXGPSHOME"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1504:
+	.string	"TASK_COUNT"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF912:
+	.string	"__enable_irq() "
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1007:
+	.string	"LAT 0"
+.LASF1555:
+	.string	"sensorsOK"
+.LASF1465:
+	.string	"servo_pwm_rate"
+.LASF1511:
+	.string	"rescheduleTask"
+.LASF1425:
+	.string	"FEATURE_ONESHOT125"
+.LASF1097:
+	.string	"char"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1156:
+	.string	"PIDPOS"
+.LASF1250:
+	.string	"checkPulse"
+.LASF1305:
+	.string	"rcExpo8"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1258:
+	.string	"enabled"
+.LASF1183:
+	.string	"MULTITYPE_HEX6"
+.LASF1057:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF1117:
+	.string	"BOOT_STAGE_COUNT"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF1014:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF1063:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF920:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF1358:
+	.string	"soft_gyro_lpf_hz"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1141:
+	.string	"pwmOutputConfiguration_s"
+.LASF1144:
+	.string	"pwmOutputConfiguration_t"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF391:
+	.string	"true 1"
+.LASF1128:
+	.string	"useSoftSerial"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1033:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1525:
+	.string	"sensors"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF1005:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1378:
+	.string	"gpsNoFixLongitude"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1321:
+	.string	"SENSOR_MAG"
+.LASF1413:
+	.string	"FEATURE_GPS"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF695:
+	.string	"__need_NULL "
+.LASF980:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1214:
+	.string	"flaps_speed"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1332:
+	.string	"CW180_DEG_FLIP"
+.LASF1053:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF1449:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1488:
+	.string	"fixedwing_althold_dir"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1411:
+	.string	"FEATURE_SERVO_TILT"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1500:
+	.string	"TASK_CONFIG"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1067:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1118:
+	.string	"bootStage_e"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1274:
+	.string	"BOXANGLE"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1066:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1353:
+	.string	"barometerConfig_t"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1050:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1175:
+	.string	"rollAndPitchTrims_t_def"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1355:
+	.string	"accDeadband_t"
+.LASF1389:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF1348:
+	.string	"barometerConfig_s"
+.LASF1130:
+	.string	"useServos"
+.LASF1083:
+	.string	"processLoopback() "
+.LASF371:
+	.string	"__linux 1"
+.LASF1298:
+	.string	"modeId"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF810:
+	.string	"__id_t_defined "
+.LASF1483:
+	.string	"inputFilteringMode"
+.LASF1315:
+	.string	"gimbalConfig_s"
+.LASF1317:
+	.string	"gimbalConfig_t"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1327:
+	.string	"CW90_DEG"
+.LASF1487:
+	.string	"airplaneConfig"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1334:
+	.string	"sensor_align_e"
+.LASF1151:
+	.string	"enableExternal1"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1247:
+	.string	"incrementCounter"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1472:
+	.string	"gyro_cmpfm_factor"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1427:
+	.string	"profile_s"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1110:
+	.string	"BOOT_STAGE_SYSTEM"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1073:
+	.string	"UNUSED(x) (void)(x)"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF955:
+	.string	"BEEP_OFF "
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1393:
+	.string	"pitchDegrees"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1314:
+	.string	"GIMBAL_FORWARDAUX"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1367:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1307:
+	.string	"thrExpo8"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1195:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1420:
+	.string	"FEATURE_RX_MSP"
+.LASF962:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF1402:
+	.string	"SMALL_ANGLE"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1019:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1527:
+	.string	"mixerUsePWMOutputConfiguration"
+.LASF1365:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1192:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF1094:
+	.string	"__int32_t"
+.LASF1482:
+	.string	"rxConfig"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1290:
+	.string	"BOXGOV"
+.LASF1443:
+	.string	"alt_hold_deadband"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1070:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1422:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1501:
+	.string	"TASK_BARO"
+.LASF1447:
+	.string	"servoConf"
+.LASF1431:
+	.string	"dynThrPID"
+.LASF1513:
+	.string	"gyroSyncIsEnabled"
+.LASF1249:
+	.string	"isIdle"
+.LASF1080:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF1556:
+	.string	"pwmOutputConfiguration"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1231:
+	.string	"gps_baudrate"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1403:
+	.string	"FIXED_WING"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1547:
+	.string	"ensureEEPROMContainsValidData"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1502:
+	.string	"TASK_ALTITUDE"
+.LASF1308:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1038:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF987:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1372:
+	.string	"frskyUnit_e"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1462:
+	.string	"flight3DConfig"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1293:
+	.string	"BOXAUTOTUNE"
+.LASF1352:
+	.string	"baro_cf_alt"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1234:
+	.string	"serialConfig_t"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1011:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1446:
+	.string	"throttle_correction_value"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1222:
+	.string	"FUNCTION_TELEMETRY"
+.LASF1228:
+	.string	"serial_port_scenario"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1548:
+	.string	"initEEPROM"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF801:
+	.string	"__u_char_defined "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1015:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1224:
+	.string	"FUNCTION_GPS"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF1199:
+	.string	"MULTITYPE_LAST"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1209:
+	.string	"deadband3d_high"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1529:
+	.string	"pwmRxInit"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1106:
+	.string	"long long unsigned int"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1477:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF992:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF979:
+	.string	"INVERTER_ON ;"
+.LASF1475:
+	.string	"dcm_ki"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1474:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1008:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF1174:
+	.string	"rollAndPitchTrims_s"
+.LASF1176:
+	.string	"rollAndPitchTrims_t"
+.LASF1206:
+	.string	"mixerConfig_t"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1236:
+	.string	"failsafe_delay"
+.LASF910:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF998:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1387:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1122:
+	.string	"serialInversion_e"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1457:
+	.string	"gyro_sync_denom"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1299:
+	.string	"auxChannelIndex"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1143:
+	.string	"motorCount"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF905:
+	.string	"_STRINGS_H 1"
+.LASF1229:
+	.string	"msp_baudrate"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF986:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1303:
+	.string	"controlRateConfig_s"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1107:
+	.string	"RGB_RED"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+.LASF1207:
+	.string	"flight3DConfig_s"
+.LASF1212:
+	.string	"flight3DConfig_t"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1312:
+	.string	"GIMBAL_NORMAL"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1185:
+	.string	"MULTITYPE_Y4"
+.LASF1182:
+	.string	"MULTITYPE_Y6"
+.LASF1532:
+	.string	"serialInit"
+.LASF1304:
+	.string	"rcRate8"
+.LASF1439:
+	.string	"acc_unarmedcal"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1510:
+	.string	"setTaskEnabled"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1081:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1286:
+	.string	"BOXLEDMAX"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF944:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1061:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF950:
+	.string	"LED0_ON "
+.LASF1418:
+	.string	"FEATURE_3D"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF1455:
+	.string	"looptime"
+.LASF1135:
+	.string	"useDshot"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1553:
+	.string	"pwm_params"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1077:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1440:
+	.string	"modeActivationConditions"
+.LASF1261:
+	.string	"rcmap"
+.LASF1318:
+	.string	"SENSOR_GYRO"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1341:
+	.string	"gyroHardware"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1012:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1158:
+	.string	"PIDNAVR"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1530:
+	.string	"isMixerUsingServos"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1016:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1444:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF929:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1254:
+	.string	"failsafe_s"
+.LASF1259:
+	.string	"failsafe_t"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1343:
+	.string	"baroHardware"
+.LASF951:
+	.string	"LED1_TOGGLE "
+.LASF1554:
+	.string	"adc_params"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF914:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1009:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1437:
+	.string	"accDeadband"
+.LASF911:
+	.string	"__disable_irq() "
+.LASF1162:
+	.string	"PID_ITEM_COUNT"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1374:
+	.string	"telemetry_provider"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF903:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1508:
+	.string	"failsafe"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1436:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1473:
+	.string	"attitude_estimator"
+.LASF1342:
+	.string	"accHardware"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1468:
+	.string	"yaw_control_direction"
+.LASF1089:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF994:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1558:
+	.string	"main"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1035:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1223:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1544:
+	.string	"delay"
+.LASF1208:
+	.string	"deadband3d_low"
+.LASF938:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1257:
+	.string	"events"
+.LASF1460:
+	.string	"customMixer"
+.LASF1086:
+	.string	"unsigned int"
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1058:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1037:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1503:
+	.string	"TASK_BLACKBOX"
+.LASF1269:
+	.string	"minthrottle"
+.LASF1142:
+	.string	"servoCount"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1284:
+	.string	"BOXPASSTHRU"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1380:
+	.string	"frsky_unit"
+.LASF1092:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1190:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1217:
+	.string	"rate"
+.LASF1281:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1492:
+	.string	"profile"
+.LASF1004:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1001:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1328:
+	.string	"CW180_DEG"
+.LASF1521:
+	.string	"micros"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1386:
+	.string	"vbatmincellvoltage"
+.LASF913:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1517:
+	.string	"batteryInit"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	".//src/main/main.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
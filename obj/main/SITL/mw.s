@@ -0,0 +1,17681 @@
+	.file	"mw.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/mw.c"
+	.section	.text.applyAndSaveAccelerometerTrimsDelta,"ax",@progbits
+	.p2align 4
+	.globl	applyAndSaveAccelerometerTrimsDelta
+	.type	applyAndSaveAccelerometerTrimsDelta, @function
+applyAndSaveAccelerometerTrimsDelta:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/mw.c"
+	.loc 1 108 1 view -0
+	.cfi_startproc
+	.loc 1 109 5 view .LVU1
+	.loc 1 109 19 is_stmt 0 view .LVU2
+	movq	currentProfile(%rip), %rax
+	.loc 1 110 5 is_stmt 1 view .LVU3
+	.loc 1 109 85 is_stmt 0 view .LVU4
+	movd	(%rdi), %xmm0
+	.loc 1 109 52 view .LVU5
+	movd	96(%rax), %xmm1
+	paddw	%xmm1, %xmm0
+	movd	%xmm0, 96(%rax)
+	.loc 1 112 5 is_stmt 1 view .LVU6
+	jmp	saveConfigAndNotify@PLT
+.LVL1:
+	.loc 1 112 5 is_stmt 0 view .LVU7
+	.cfi_endproc
+.LFE11:
+	.size	applyAndSaveAccelerometerTrimsDelta, .-applyAndSaveAccelerometerTrimsDelta
+	.section	.text.isCalibrating,"ax",@progbits
+	.p2align 4
+	.globl	isCalibrating
+	.type	isCalibrating, @function
+isCalibrating:
+.LFB12:
+	.loc 1 154 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 5 view .LVU9
+	.loc 1 154 1 is_stmt 0 view .LVU10
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 156 9 view .LVU11
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL2:
+	.loc 1 156 8 view .LVU12
+	testb	%al, %al
+	je	.L7
+	.loc 1 156 33 discriminator 1 view .LVU13
+	call	isBaroCalibrationComplete@PLT
+.LVL3:
+	.loc 1 156 29 discriminator 1 view .LVU14
+	testb	%al, %al
+	je	.L3
+.L7:
+	.loc 1 163 5 is_stmt 1 view .LVU15
+	.loc 1 163 14 is_stmt 0 view .LVU16
+	call	isAccelerationCalibrationComplete@PLT
+.LVL4:
+	.loc 1 163 74 view .LVU17
+	testb	%al, %al
+	je	.L15
+.L5:
+	.loc 1 163 79 view .LVU18
+	call	isGyroCalibrationComplete@PLT
+.LVL5:
+	.loc 1 163 74 view .LVU19
+	xorl	$1, %eax
+.L3:
+	.loc 1 164 1 view .LVU20
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.cfi_restore_state
+	.loc 1 163 53 discriminator 1 view .LVU21
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL6:
+	.loc 1 163 50 discriminator 1 view .LVU22
+	testb	%al, %al
+	je	.L5
+	.loc 1 164 1 view .LVU23
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	isCalibrating, .-isCalibrating
+	.section	.text.annexCode,"ax",@progbits
+	.p2align 4
+	.globl	annexCode
+	.type	annexCode, @function
+annexCode:
+.LFB14:
+	.loc 1 178 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 179 5 view .LVU25
+	.loc 1 180 5 view .LVU26
+	.loc 1 182 5 view .LVU27
+	.loc 1 183 5 view .LVU28
+	.loc 1 184 5 view .LVU29
+	.loc 1 187 5 view .LVU30
+	.loc 1 178 1 is_stmt 0 view .LVU31
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 188 15 view .LVU32
+	movl	$100, %r12d
+	.loc 1 178 1 view .LVU33
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 187 42 view .LVU34
+	movq	currentProfile(%rip), %rcx
+	.loc 1 187 15 view .LVU35
+	movswl	6+rcData(%rip), %ebp
+	.loc 1 187 42 view .LVU36
+	movzwl	92(%rcx), %esi
+	.loc 1 187 8 view .LVU37
+	cmpl	%esi, %ebp
+	jl	.L17
+	.loc 1 190 9 is_stmt 1 view .LVU38
+	.loc 1 191 27 is_stmt 0 view .LVU39
+	movzbl	90(%rcx), %edi
+	.loc 1 190 12 view .LVU40
+	cmpw	$1999, %bp
+	jg	.L18
+	.loc 1 191 13 is_stmt 1 view .LVU41
+	.loc 1 191 83 is_stmt 0 view .LVU42
+	movl	%ebp, %eax
+	subl	%esi, %eax
+	.loc 1 191 63 view .LVU43
+	imull	%edi, %eax
+	.loc 1 191 125 view .LVU44
+	movl	$2000, %edi
+	subl	%esi, %edi
+	.loc 1 191 117 view .LVU45
+	cltd
+	idivl	%edi
+	.loc 1 191 19 view .LVU46
+	subl	%eax, %r12d
+.LVL7:
+.L17:
+	.loc 1 197 5 is_stmt 1 view .LVU47
+	.loc 1 197 25 view .LVU48
+	.loc 1 209 48 is_stmt 0 view .LVU49
+	movl	%ebp, 8(%rsp)
+	.loc 1 198 106 view .LVU50
+	movzwl	320+masterConfig(%rip), %r10d
+	leaq	rcCommand(%rip), %rdi
+	xorl	%eax, %eax
+	leaq	rcData(%rip), %r15
+	leaq	dynP8(%rip), %r14
+	leaq	dynI8(%rip), %r13
+	.loc 1 209 48 view .LVU51
+	leaq	lookupPitchRollRC(%rip), %rbx
+.LVL8:
+.L30:
+	.loc 1 198 9 is_stmt 1 view .LVU52
+	.loc 1 198 76 is_stmt 0 view .LVU53
+	movswl	(%r15,%rax,2), %r9d
+	.loc 1 198 83 view .LVU54
+	movl	%r9d, %edx
+	subl	%r10d, %edx
+	.loc 1 198 164 view .LVU55
+	leal	499(%rdx), %esi
+	.loc 1 198 322 view .LVU56
+	cmpl	$998, %esi
+	jbe	.L19
+.LVL9:
+	.loc 1 199 9 is_stmt 1 view .LVU57
+	.loc 1 199 12 is_stmt 0 view .LVU58
+	cmpq	$2, %rax
+	je	.L20
+	.loc 1 200 13 is_stmt 1 view .LVU59
+	.loc 1 200 31 is_stmt 0 view .LVU60
+	movzbl	452(%rcx), %edx
+	.loc 1 198 322 view .LVU61
+	movl	$500, %esi
+	.loc 1 200 16 view .LVU62
+	testb	%dl, %dl
+	jne	.L22
+	movl	$6, %edx
+	xorl	%r11d, %r11d
+	movl	$5, %r8d
+	.loc 1 198 322 view .LVU63
+	movl	$500, %esi
+.LVL10:
+.L21:
+	.loc 1 208 13 is_stmt 1 view .LVU64
+	.loc 1 209 13 view .LVU65
+	.loc 1 209 48 is_stmt 0 view .LVU66
+	movslq	%r8d, %r8
+	.loc 1 209 96 view .LVU67
+	movslq	%edx, %rdx
+	.loc 1 209 48 view .LVU68
+	movswl	(%rbx,%r8,2), %ebp
+	.loc 1 209 96 view .LVU69
+	movswl	(%rbx,%rdx,2), %edx
+	.loc 1 209 107 view .LVU70
+	subl	%ebp, %edx
+	.loc 1 209 48 view .LVU71
+	movl	%ebp, %r8d
+	.loc 1 209 76 view .LVU72
+	imull	%r11d, %edx
+	.loc 1 209 134 view .LVU73
+	movslq	%edx, %r11
+	sarl	$31, %edx
+	imulq	$1374389535, %r11, %r11
+	sarq	$37, %r11
+	subl	%edx, %r11d
+	.loc 1 209 55 view .LVU74
+	addl	%r11d, %r8d
+	movw	%r8w, (%rdi)
+	.loc 1 210 13 is_stmt 1 view .LVU75
+.LVL11:
+	.loc 1 211 13 view .LVU76
+	.loc 1 210 27 is_stmt 0 view .LVU77
+	movzbl	88(%rcx), %edx
+	.loc 1 210 85 view .LVU78
+	imull	%esi, %edx
+	.loc 1 210 91 view .LVU79
+	movslq	%edx, %rsi
+	sarl	$31, %edx
+	imulq	$274877907, %rsi, %rsi
+	sarq	$37, %rsi
+	subl	%esi, %edx
+	.loc 1 210 19 view .LVU80
+	addl	$100, %edx
+	.loc 1 211 37 view .LVU81
+	movzwl	%dx, %edx
+	imull	%r12d, %edx
+	.loc 1 211 19 view .LVU82
+	movslq	%edx, %rsi
+	sarl	$31, %edx
+	imulq	$1374389535, %rsi, %rsi
+	sarq	$37, %rsi
+	subl	%edx, %esi
+.LVL12:
+	.loc 1 213 9 is_stmt 1 view .LVU83
+.L25:
+	.loc 1 225 9 view .LVU84
+	.loc 1 225 23 is_stmt 0 view .LVU85
+	movzbl	4(%rcx,%rax), %r8d
+	.loc 1 225 69 view .LVU86
+	imull	%esi, %r8d
+	.loc 1 225 77 view .LVU87
+	movslq	%r8d, %rdx
+	sarl	$31, %r8d
+	imulq	$1374389535, %rdx, %rdx
+	sarq	$37, %rdx
+	subl	%r8d, %edx
+	.loc 1 225 21 view .LVU88
+	movb	%dl, (%r14,%rax)
+	.loc 1 226 9 is_stmt 1 view .LVU89
+	.loc 1 226 23 is_stmt 0 view .LVU90
+	movzbl	14(%rcx,%rax), %r8d
+	.loc 1 226 69 view .LVU91
+	imull	%esi, %r8d
+	.loc 1 226 77 view .LVU92
+	movslq	%r8d, %rdx
+	sarl	$31, %r8d
+	imulq	$1374389535, %rdx, %rdx
+	sarq	$37, %rdx
+	subl	%r8d, %edx
+	.loc 1 226 21 view .LVU93
+	movb	%dl, 0(%r13,%rax)
+	.loc 1 227 9 is_stmt 1 view .LVU94
+	.loc 1 227 23 is_stmt 0 view .LVU95
+	movzbl	24(%rcx,%rax), %edx
+	.loc 1 227 69 view .LVU96
+	imull	%edx, %esi
+.LVL13:
+	.loc 1 227 77 view .LVU97
+	movslq	%esi, %rdx
+	sarl	$31, %esi
+	imulq	$1374389535, %rdx, %rdx
+	sarq	$37, %rdx
+	subl	%esi, %edx
+	.loc 1 227 21 view .LVU98
+	leaq	dynD8(%rip), %rsi
+	movb	%dl, (%rsi,%rax)
+	.loc 1 229 9 is_stmt 1 view .LVU99
+	.loc 1 229 12 is_stmt 0 view .LVU100
+	cmpl	%r10d, %r9d
+	jge	.L29
+	.loc 1 230 13 is_stmt 1 view .LVU101
+	.loc 1 230 29 is_stmt 0 view .LVU102
+	negw	(%rdi)
+.L29:
+	.loc 1 197 34 is_stmt 1 discriminator 2 view .LVU103
+.LVL14:
+	.loc 1 197 25 discriminator 2 view .LVU104
+	addq	$1, %rax
+.LVL15:
+	.loc 1 197 25 is_stmt 0 discriminator 2 view .LVU105
+	addq	$2, %rdi
+	cmpq	$3, %rax
+	jne	.L30
+	.loc 1 233 11 view .LVU106
+	movl	8(%rsp), %ebp
+	.loc 1 233 5 is_stmt 1 view .LVU107
+	.loc 1 233 11 is_stmt 0 view .LVU108
+	movzwl	322+masterConfig(%rip), %esi
+	movl	$2000, %edx
+	movl	%ebp, %edi
+	call	constrain@PLT
+.LVL16:
+	.loc 1 234 5 is_stmt 1 view .LVU109
+	.loc 1 234 49 is_stmt 0 view .LVU110
+	movzwl	322+masterConfig(%rip), %edx
+	.loc 1 234 75 view .LVU111
+	movl	$2000, %ecx
+	.loc 1 236 43 view .LVU112
+	leaq	lookupThrottleRC(%rip), %rdi
+	.loc 1 234 26 view .LVU113
+	subl	%edx, %eax
+.LVL17:
+	.loc 1 234 75 view .LVU114
+	subl	%edx, %ecx
+	.loc 1 234 67 view .LVU115
+	xorl	%edx, %edx
+	.loc 1 234 60 view .LVU116
+	imull	$1000, %eax, %eax
+	.loc 1 234 67 view .LVU117
+	divl	%ecx
+.LVL18:
+	.loc 1 235 5 is_stmt 1 view .LVU118
+	.loc 1 235 10 is_stmt 0 view .LVU119
+	movslq	%eax, %rdx
+	movl	%eax, %ecx
+	imulq	$1374389535, %rdx, %rdx
+	sarl	$31, %ecx
+	sarq	$37, %rdx
+	subl	%ecx, %edx
+.LVL19:
+	.loc 1 236 5 is_stmt 1 view .LVU120
+	.loc 1 236 43 is_stmt 0 view .LVU121
+	movslq	%edx, %rcx
+	movzwl	(%rdi,%rcx,2), %esi
+	.loc 1 236 96 view .LVU122
+	leal	1(%rdx), %ecx
+	.loc 1 236 90 view .LVU123
+	movslq	%ecx, %rcx
+	.loc 1 236 64 view .LVU124
+	imull	$-100, %edx, %edx
+.LVL20:
+	.loc 1 236 90 view .LVU125
+	movswl	(%rdi,%rcx,2), %ecx
+.LVL21:
+	.loc 1 236 119 view .LVU126
+	movswl	%si, %edi
+	.loc 1 236 101 view .LVU127
+	subl	%edi, %ecx
+	.loc 1 236 57 view .LVU128
+	addl	%eax, %edx
+	.loc 1 236 71 view .LVU129
+	movl	%ecx, %eax
+.LVL22:
+	.loc 1 236 71 view .LVU130
+	imull	%edx, %eax
+	.loc 1 236 127 view .LVU131
+	movslq	%eax, %rdx
+	sarl	$31, %eax
+	imulq	$1374389535, %rdx, %rdx
+	sarq	$37, %rdx
+	subl	%eax, %edx
+	.loc 1 236 50 view .LVU132
+	leal	(%rsi,%rdx), %eax
+	movw	%ax, 6+rcCommand(%rip)
+	.loc 1 238 5 is_stmt 1 view .LVU133
+	.loc 1 238 8 is_stmt 0 view .LVU134
+	testb	$64, flightModeFlags(%rip)
+	jne	.L63
+.L31:
+	.loc 1 247 5 is_stmt 1 view .LVU135
+	.loc 1 247 9 is_stmt 0 view .LVU136
+	movl	$2050, %edi
+	call	feature@PLT
+.LVL23:
+	.loc 1 247 8 view .LVU137
+	testb	%al, %al
+	je	.L33
+	.loc 1 248 9 is_stmt 1 view .LVU138
+	.loc 1 248 23 is_stmt 0 view .LVU139
+	movzwl	cycleTime(%rip), %eax
+	addl	%eax, vbatCycleTime.3(%rip)
+	.loc 1 249 9 is_stmt 1 view .LVU140
+	.loc 1 249 12 is_stmt 0 view .LVU141
+	movl	$-85, %edx
+	.loc 1 249 15 view .LVU142
+	movzbl	vbatTimer.2(%rip), %eax
+	addl	$1, %eax
+	.loc 1 249 12 view .LVU143
+	movb	%al, vbatTimer.2(%rip)
+	imull	%edx, %eax
+	rorb	%al
+	cmpb	$42, %al
+	jbe	.L64
+.L33:
+	.loc 1 263 5 is_stmt 1 view .LVU144
+	xorl	%edi, %edi
+	cmpb	$0, batteryWarningEnabled.1(%rip)
+	setne	%dil
+	call	beepcodeUpdateState@PLT
+.LVL24:
+	.loc 1 265 5 view .LVU145
+	.loc 1 265 22 is_stmt 0 view .LVU146
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 265 8 view .LVU147
+	testb	$4, %al
+	jne	.L37
+	.loc 1 268 9 is_stmt 1 view .LVU148
+	.loc 1 268 12 is_stmt 0 view .LVU149
+	testb	$1, rcModeActivationMask(%rip)
+	jne	.L38
+	.loc 1 269 13 is_stmt 1 view .LVU150
+	.loc 1 269 26 is_stmt 0 view .LVU151
+	orl	$1, %eax
+	movb	%al, armingFlags(%rip)
+.L38:
+	.loc 1 272 9 is_stmt 1 view .LVU152
+	.loc 1 272 13 is_stmt 0 view .LVU153
+	xorl	%eax, %eax
+	call	isCalibrating
+.LVL25:
+	.loc 1 272 12 view .LVU154
+	testb	%al, %al
+	.loc 1 274 26 view .LVU155
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 272 12 view .LVU156
+	je	.L40
+	.loc 1 273 13 is_stmt 1 view .LVU157
+	.loc 1 274 13 view .LVU158
+	.loc 1 274 26 is_stmt 0 view .LVU159
+	andl	$-2, %eax
+	movb	%al, armingFlags(%rip)
+.L40:
+	.loc 1 277 9 is_stmt 1 view .LVU160
+	.loc 1 277 12 is_stmt 0 view .LVU161
+	testb	$8, stateFlags(%rip)
+	jne	.L41
+	.loc 1 278 13 is_stmt 1 view .LVU162
+	.loc 1 278 26 is_stmt 0 view .LVU163
+	andl	$-2, %eax
+	movb	%al, armingFlags(%rip)
+.L41:
+	.loc 1 281 9 is_stmt 1 view .LVU164
+	.loc 1 281 12 is_stmt 0 view .LVU165
+	testb	$16, 2+rcModeActivationMask(%rip)
+	jne	.L42
+	.loc 1 285 9 is_stmt 1 view .LVU166
+	.loc 1 285 12 is_stmt 0 view .LVU167
+	testb	$1, %al
+	je	.L44
+	.loc 1 286 13 is_stmt 1 view .LVU168
+	call	disableWarningLed@PLT
+.LVL26:
+.L45:
+	.loc 1 291 9 view .LVU169
+	movl	currentTime(%rip), %edi
+	call	updateWarningLed@PLT
+.LVL27:
+.L37:
+	.loc 1 309 5 view .LVU170
+	.loc 1 309 13 is_stmt 0 view .LVU171
+	movq	16+gyro(%rip), %rax
+	.loc 1 309 8 view .LVU172
+	testq	%rax, %rax
+	je	.L16
+	.loc 1 310 9 is_stmt 1 view .LVU173
+	.loc 1 311 1 is_stmt 0 view .LVU174
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 310 9 view .LVU175
+	leaq	telemTemperature1(%rip), %rdi
+	.loc 1 311 1 view .LVU176
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL28:
+	.loc 1 311 1 view .LVU177
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	.loc 1 310 9 view .LVU178
+	jmp	*%rax
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.cfi_restore_state
+	.loc 1 198 322 discriminator 1 view .LVU179
+	movl	%edx, %esi
+	negl	%esi
+	cmovs	%edx, %esi
+.LVL30:
+	.loc 1 199 9 is_stmt 1 discriminator 1 view .LVU180
+	.loc 1 199 12 is_stmt 0 discriminator 1 view .LVU181
+	cmpq	$2, %rax
+	je	.L23
+	.loc 1 200 13 is_stmt 1 view .LVU182
+	.loc 1 200 31 is_stmt 0 view .LVU183
+	movzbl	452(%rcx), %edx
+.LVL31:
+	.loc 1 200 16 view .LVU184
+	testb	%dl, %dl
+	jne	.L24
+	.loc 1 208 18 view .LVU185
+	movl	%esi, %r8d
+	imulq	$1374389535, %r8, %r8
+	shrq	$37, %r8
+	.loc 1 209 69 view .LVU186
+	imull	$-100, %r8d, %r11d
+	.loc 1 209 102 view .LVU187
+	leal	1(%r8), %edx
+	.loc 1 209 62 view .LVU188
+	addl	%esi, %r11d
+	jmp	.L21
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.loc 1 201 17 is_stmt 1 view .LVU189
+	.loc 1 201 20 is_stmt 0 view .LVU190
+	cmpl	%esi, %edx
+	jge	.L49
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.loc 1 202 21 is_stmt 1 view .LVU191
+	.loc 1 202 25 is_stmt 0 view .LVU192
+	subl	%edx, %esi
+.LVL33:
+	.loc 1 208 18 view .LVU193
+	movslq	%esi, %r8
+	movl	%esi, %edx
+	imulq	$1374389535, %r8, %r8
+	sarl	$31, %edx
+	sarq	$37, %r8
+	subl	%edx, %r8d
+	.loc 1 209 69 view .LVU194
+	imull	$-100, %r8d, %r11d
+	.loc 1 209 102 view .LVU195
+	leal	1(%r8), %edx
+	.loc 1 209 62 view .LVU196
+	addl	%esi, %r11d
+	jmp	.L21
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L49:
+	.loc 1 209 62 view .LVU197
+	movl	$1, %edx
+	xorl	%r11d, %r11d
+	xorl	%r8d, %r8d
+.LVL35:
+	.loc 1 204 25 view .LVU198
+	xorl	%esi, %esi
+	jmp	.L21
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L42:
+	.loc 1 282 13 is_stmt 1 view .LVU199
+	.loc 1 282 26 is_stmt 0 view .LVU200
+	andl	$-2, %eax
+	movb	%al, armingFlags(%rip)
+	.loc 1 285 9 is_stmt 1 view .LVU201
+.L44:
+	.loc 1 288 13 view .LVU202
+	movl	currentTime(%rip), %edi
+	call	enableWarningLed@PLT
+.LVL37:
+	jmp	.L45
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.loc 1 193 13 view .LVU203
+	.loc 1 193 19 is_stmt 0 view .LVU204
+	subl	%edi, %r12d
+.LVL39:
+	.loc 1 193 19 view .LVU205
+	jmp	.L17
+.LVL40:
+	.p2align 4,,10
+	.p2align 3
+.L23:
+	.loc 1 214 13 is_stmt 1 view .LVU206
+	.loc 1 214 31 is_stmt 0 view .LVU207
+	movzbl	453(%rcx), %edx
+	.loc 1 221 29 view .LVU208
+	movl	%esi, %r8d
+	.loc 1 214 16 view .LVU209
+	testb	%dl, %dl
+	je	.L26
+	.loc 1 215 17 is_stmt 1 view .LVU210
+	.loc 1 215 20 is_stmt 0 view .LVU211
+	cmpl	%esi, %edx
+	jl	.L27
+	xorl	%esi, %esi
+	xorl	%r8d, %r8d
+.L26:
+	.loc 1 221 13 is_stmt 1 view .LVU212
+	.loc 1 221 50 is_stmt 0 view .LVU213
+	movsbl	246+masterConfig(%rip), %edx
+	.loc 1 221 37 view .LVU214
+	negl	%edx
+	.loc 1 221 29 view .LVU215
+	imull	%r8d, %edx
+	movw	%dx, 4+rcCommand(%rip)
+	.loc 1 222 13 is_stmt 1 view .LVU216
+	.loc 1 222 27 is_stmt 0 view .LVU217
+	movzbl	89(%rcx), %edx
+	.loc 1 222 79 view .LVU218
+	imull	%edx, %esi
+	.loc 1 222 110 view .LVU219
+	movslq	%esi, %rdx
+	sarl	$31, %esi
+	imulq	$274877907, %rdx, %rdx
+	sarq	$37, %rdx
+	subl	%edx, %esi
+	.loc 1 222 19 view .LVU220
+	addl	$100, %esi
+.LVL41:
+	.loc 1 222 19 view .LVU221
+	jmp	.L25
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.loc 1 214 13 is_stmt 1 view .LVU222
+	.loc 1 214 31 is_stmt 0 view .LVU223
+	movzbl	453(%rcx), %edx
+	.loc 1 198 322 view .LVU224
+	movl	$500, %esi
+	.loc 1 214 16 view .LVU225
+	movl	$500, %r8d
+	testb	%dl, %dl
+	je	.L26
+.L27:
+	.loc 1 216 21 is_stmt 1 view .LVU226
+	.loc 1 216 25 is_stmt 0 view .LVU227
+	subl	%edx, %esi
+.LVL43:
+	.loc 1 222 100 view .LVU228
+	movl	%esi, %edx
+	.loc 1 221 29 view .LVU229
+	movl	%esi, %r8d
+	.loc 1 222 100 view .LVU230
+	negl	%edx
+	cmovns	%edx, %esi
+.LVL44:
+	.loc 1 222 100 view .LVU231
+	jmp	.L26
+.LVL45:
+	.p2align 4,,10
+	.p2align 3
+.L63:
+.LBB4:
+	.loc 1 239 9 is_stmt 1 view .LVU232
+	.loc 1 239 50 is_stmt 0 view .LVU233
+	movzwl	heading(%rip), %edi
+	subw	headFreeModeHold(%rip), %di
+	.loc 1 239 25 view .LVU234
+	movswl	%di, %edi
+	call	degreesToRadians@PLT
+.LVL46:
+	.loc 1 240 9 is_stmt 1 view .LVU235
+	.loc 1 240 25 is_stmt 0 view .LVU236
+	movss	%xmm0, 12(%rsp)
+	call	cos_approx@PLT
+.LVL47:
+	.loc 1 241 25 view .LVU237
+	movss	12(%rsp), %xmm1
+	.loc 1 240 25 view .LVU238
+	movss	%xmm0, 8(%rsp)
+.LVL48:
+	.loc 1 241 9 is_stmt 1 view .LVU239
+	.loc 1 241 25 is_stmt 0 view .LVU240
+	movaps	%xmm1, %xmm0
+.LVL49:
+	.loc 1 241 25 view .LVU241
+	call	sin_approx@PLT
+.LVL50:
+	.loc 1 242 9 is_stmt 1 view .LVU242
+	.loc 1 242 52 is_stmt 0 view .LVU243
+	movswl	2+rcCommand(%rip), %eax
+	pxor	%xmm1, %xmm1
+	.loc 1 242 80 view .LVU244
+	pxor	%xmm2, %xmm2
+	.loc 1 243 43 view .LVU245
+	movss	8(%rsp), %xmm3
+	.loc 1 242 52 view .LVU246
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 242 80 view .LVU247
+	movswl	rcCommand(%rip), %eax
+	cvtsi2ssl	%eax, %xmm2
+.LVL51:
+	.loc 1 243 9 is_stmt 1 view .LVU248
+	.loc 1 243 72 is_stmt 0 view .LVU249
+	movaps	%xmm1, %xmm5
+	mulss	%xmm0, %xmm5
+	.loc 1 242 52 view .LVU250
+	mulss	%xmm3, %xmm1
+.LVL52:
+	.loc 1 243 43 view .LVU251
+	movaps	%xmm2, %xmm4
+	mulss	%xmm3, %xmm4
+	.loc 1 242 80 view .LVU252
+	mulss	%xmm0, %xmm2
+	.loc 1 243 53 view .LVU253
+	subss	%xmm5, %xmm4
+	.loc 1 242 62 view .LVU254
+	addss	%xmm2, %xmm1
+	.loc 1 243 25 view .LVU255
+	cvttss2sil	%xmm4, %eax
+	movw	%ax, rcCommand(%rip)
+	.loc 1 244 9 is_stmt 1 view .LVU256
+	.loc 1 242 17 is_stmt 0 view .LVU257
+	cvttss2sil	%xmm1, %eax
+	movw	%ax, 2+rcCommand(%rip)
+	jmp	.L31
+.LVL53:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 242 17 view .LVU258
+.LBE4:
+	.loc 1 311 1 view .LVU259
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL54:
+	.loc 1 311 1 view .LVU260
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL55:
+	.p2align 4,,10
+	.p2align 3
+.L64:
+	.cfi_restore_state
+	.loc 1 251 10 is_stmt 1 view .LVU261
+	.loc 1 251 14 is_stmt 0 view .LVU262
+	movl	$2, %edi
+	call	feature@PLT
+.LVL56:
+	.loc 1 251 13 view .LVU263
+	testb	%al, %al
+	jne	.L65
+.L35:
+	.loc 1 256 10 is_stmt 1 view .LVU264
+	.loc 1 256 14 is_stmt 0 view .LVU265
+	movl	$2048, %edi
+	call	feature@PLT
+.LVL57:
+	.loc 1 256 13 view .LVU266
+	testb	%al, %al
+	jne	.L66
+.L36:
+	.loc 1 259 10 is_stmt 1 view .LVU267
+	.loc 1 259 24 is_stmt 0 view .LVU268
+	movl	$0, vbatCycleTime.3(%rip)
+	jmp	.L33
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	.loc 1 252 11 is_stmt 1 view .LVU269
+	call	updateBatteryVoltage@PLT
+.LVL58:
+	.loc 1 253 17 view .LVU270
+	.loc 1 253 41 is_stmt 0 view .LVU271
+	call	shouldSoundBatteryAlarm@PLT
+.LVL59:
+	.loc 1 253 39 view .LVU272
+	movb	%al, batteryWarningEnabled.1(%rip)
+	jmp	.L35
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.loc 1 257 11 is_stmt 1 view .LVU273
+	movl	vbatCycleTime.3(%rip), %edi
+	call	updateCurrentMeter@PLT
+.LVL60:
+	jmp	.L36
+	.cfi_endproc
+.LFE14:
+	.size	annexCode, .-annexCode
+	.section	.text.mwDisarm,"ax",@progbits
+	.p2align 4
+	.globl	mwDisarm
+	.type	mwDisarm, @function
+mwDisarm:
+.LFB15:
+	.loc 1 314 1 view -0
+	.cfi_startproc
+	.loc 1 315 5 view .LVU275
+	.loc 1 315 22 is_stmt 0 view .LVU276
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 315 8 view .LVU277
+	testb	$4, %al
+	je	.L67
+	.loc 1 316 9 is_stmt 1 view .LVU278
+	.loc 1 316 22 is_stmt 0 view .LVU279
+	andl	$-5, %eax
+	movb	%al, armingFlags(%rip)
+.L67:
+	.loc 1 317 1 view .LVU280
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	mwDisarm, .-mwDisarm
+	.section	.text.mwArm,"ax",@progbits
+	.p2align 4
+	.globl	mwArm
+	.type	mwArm, @function
+mwArm:
+.LFB16:
+	.loc 1 320 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 321 5 view .LVU282
+	.loc 1 321 22 is_stmt 0 view .LVU283
+	movzbl	armingFlags(%rip), %eax
+	movl	%eax, %edx
+	andl	$4, %edx
+	.loc 1 321 8 view .LVU284
+	testb	$1, %al
+	je	.L73
+	.loc 1 322 9 is_stmt 1 view .LVU285
+	.loc 1 322 12 is_stmt 0 view .LVU286
+	testb	%dl, %dl
+	jne	.L72
+	.loc 1 325 9 is_stmt 1 view .LVU287
+	.loc 1 325 12 is_stmt 0 view .LVU288
+	testb	$2, %al
+	je	.L76
+.L75:
+	.loc 1 334 9 is_stmt 1 view .LVU289
+	movl	$1, %edx
+	movl	$255, %esi
+	movl	$2, %edi
+	jmp	blinkLedAndSoundBeeper@PLT
+.LVL61:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.loc 1 333 5 view .LVU290
+	.loc 1 333 8 is_stmt 0 view .LVU291
+	testb	%dl, %dl
+	je	.L75
+.L72:
+	.loc 1 336 1 view .LVU292
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.loc 1 326 13 is_stmt 1 view .LVU293
+	.loc 1 326 26 is_stmt 0 view .LVU294
+	orl	$4, %eax
+	movb	%al, armingFlags(%rip)
+	.loc 1 327 13 is_stmt 1 view .LVU295
+	.loc 1 327 30 is_stmt 0 view .LVU296
+	movzwl	heading(%rip), %eax
+	movw	%ax, headFreeModeHold(%rip)
+	.loc 1 328 13 is_stmt 1 view .LVU297
+	jmp	mixerResetSaturation@PLT
+.LVL62:
+	.cfi_endproc
+.LFE16:
+	.size	mwArm, .-mwArm
+	.section	.text.handleInflightCalibrationStickPosition,"ax",@progbits
+	.p2align 4
+	.globl	handleInflightCalibrationStickPosition
+	.type	handleInflightCalibrationStickPosition, @function
+handleInflightCalibrationStickPosition:
+.LFB17:
+	.loc 1 346 1 view -0
+	.cfi_startproc
+	.loc 1 347 5 view .LVU299
+	.loc 1 347 8 is_stmt 0 view .LVU300
+	cmpb	$0, AccInflightCalibrationMeasurementDone(%rip)
+	je	.L78
+	.loc 1 349 9 is_stmt 1 view .LVU301
+	.loc 1 349 47 is_stmt 0 view .LVU302
+	movb	$0, AccInflightCalibrationMeasurementDone(%rip)
+	.loc 1 350 9 is_stmt 1 view .LVU303
+	.loc 1 350 44 is_stmt 0 view .LVU304
+	movb	$1, AccInflightCalibrationSavetoEEProm(%rip)
+	.loc 1 359 1 view .LVU305
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 352 9 is_stmt 1 view .LVU306
+	.loc 1 353 12 is_stmt 0 view .LVU307
+	xorb	$1, AccInflightCalibrationArmed(%rip)
+	je	.L80
+	.loc 1 354 13 is_stmt 1 view .LVU308
+	movl	$2, %edi
+	jmp	queueConfirmationBeep@PLT
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 356 13 view .LVU309
+	movl	$3, %edi
+	jmp	queueConfirmationBeep@PLT
+.LVL64:
+	.cfi_endproc
+.LFE17:
+	.size	handleInflightCalibrationStickPosition, .-handleInflightCalibrationStickPosition
+	.section	.text.updateInflightCalibrationState,"ax",@progbits
+	.p2align 4
+	.globl	updateInflightCalibrationState
+	.type	updateInflightCalibrationState, @function
+updateInflightCalibrationState:
+.LFB18:
+	.loc 1 362 1 view -0
+	.cfi_startproc
+	.loc 1 363 5 view .LVU311
+	.loc 1 363 8 is_stmt 0 view .LVU312
+	cmpb	$0, AccInflightCalibrationArmed(%rip)
+	.loc 1 363 134 view .LVU313
+	movl	rcModeActivationMask(%rip), %eax
+	.loc 1 363 8 view .LVU314
+	je	.L83
+	.loc 1 363 37 discriminator 1 view .LVU315
+	testb	$4, armingFlags(%rip)
+	jne	.L90
+.L83:
+	.loc 1 367 5 is_stmt 1 view .LVU316
+	.loc 1 367 8 is_stmt 0 view .LVU317
+	testl	$65536, %eax
+	je	.L84
+	.loc 1 368 9 is_stmt 1 view .LVU318
+	.loc 1 368 12 is_stmt 0 view .LVU319
+	cmpb	$0, AccInflightCalibrationActive(%rip)
+	jne	.L85
+	.loc 1 368 43 discriminator 1 view .LVU320
+	cmpb	$0, AccInflightCalibrationMeasurementDone(%rip)
+	jne	.L85
+	.loc 1 369 13 is_stmt 1 view .LVU321
+	.loc 1 369 34 is_stmt 0 view .LVU322
+	movl	$50, %eax
+	movw	%ax, InflightcalibratingA(%rip)
+.L85:
+	.loc 1 370 9 is_stmt 1 view .LVU323
+	.loc 1 370 38 is_stmt 0 view .LVU324
+	movb	$1, AccInflightCalibrationActive(%rip)
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L84:
+	.loc 1 371 12 is_stmt 1 view .LVU325
+	.loc 1 371 15 is_stmt 0 view .LVU326
+	cmpb	$0, AccInflightCalibrationMeasurementDone(%rip)
+	je	.L82
+	.loc 1 371 54 discriminator 1 view .LVU327
+	testb	$4, armingFlags(%rip)
+	jne	.L82
+	.loc 1 372 9 is_stmt 1 view .LVU328
+	.loc 1 372 47 is_stmt 0 view .LVU329
+	movb	$0, AccInflightCalibrationMeasurementDone(%rip)
+	.loc 1 373 9 is_stmt 1 view .LVU330
+	.loc 1 373 44 is_stmt 0 view .LVU331
+	movb	$1, AccInflightCalibrationSavetoEEProm(%rip)
+.L82:
+	.loc 1 375 1 view .LVU332
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L90:
+	.loc 1 363 71 discriminator 2 view .LVU333
+	movswl	6+rcData(%rip), %ecx
+	.loc 1 363 105 discriminator 2 view .LVU334
+	movzwl	322+masterConfig(%rip), %edx
+	.loc 1 363 62 discriminator 2 view .LVU335
+	cmpl	%edx, %ecx
+	jle	.L83
+	.loc 1 363 115 discriminator 3 view .LVU336
+	testb	$1, %al
+	jne	.L83
+	.loc 1 364 9 is_stmt 1 view .LVU337
+	.loc 1 364 30 is_stmt 0 view .LVU338
+	movl	$50, %edx
+	.loc 1 365 37 view .LVU339
+	movb	$0, AccInflightCalibrationArmed(%rip)
+	.loc 1 364 30 view .LVU340
+	movw	%dx, InflightcalibratingA(%rip)
+	.loc 1 365 9 is_stmt 1 view .LVU341
+	jmp	.L83
+	.cfi_endproc
+.LFE18:
+	.size	updateInflightCalibrationState, .-updateInflightCalibrationState
+	.section	.text.updateMagHold,"ax",@progbits
+	.p2align 4
+	.globl	updateMagHold
+	.type	updateMagHold, @function
+updateMagHold:
+.LFB19:
+	.loc 1 378 1 view -0
+	.cfi_startproc
+	.loc 1 379 5 view .LVU343
+	.loc 1 379 43 is_stmt 0 view .LVU344
+	movzwl	4+rcCommand(%rip), %edx
+.LBB5:
+	.loc 1 380 31 view .LVU345
+	movzwl	heading(%rip), %eax
+.LBE5:
+	.loc 1 379 50 view .LVU346
+	movl	%edx, %ecx
+	negw	%cx
+	cmovs	%edx, %ecx
+	.loc 1 379 8 view .LVU347
+	cmpw	$69, %cx
+	ja	.L92
+	.loc 1 379 76 discriminator 1 view .LVU348
+	testb	$4, flightModeFlags(%rip)
+	je	.L92
+.LBB6:
+	.loc 1 380 9 is_stmt 1 view .LVU349
+	.loc 1 380 31 is_stmt 0 view .LVU350
+	subw	magHold(%rip), %ax
+.LVL65:
+	.loc 1 381 9 is_stmt 1 view .LVU351
+	.loc 1 382 17 is_stmt 0 view .LVU352
+	leal	360(%rax), %ecx
+	cmpw	$-179, %ax
+	cmovl	%ecx, %eax
+.LVL66:
+	.loc 1 383 9 is_stmt 1 view .LVU353
+	.loc 1 384 17 is_stmt 0 view .LVU354
+	leal	-360(%rax), %ecx
+	cmpw	$179, %ax
+	cmovg	%ecx, %eax
+.LVL67:
+	.loc 1 385 9 is_stmt 1 view .LVU355
+	.loc 1 386 9 view .LVU356
+	.loc 1 386 12 is_stmt 0 view .LVU357
+	testb	$8, stateFlags(%rip)
+	je	.L91
+	.loc 1 387 13 is_stmt 1 view .LVU358
+	.loc 1 385 29 is_stmt 0 view .LVU359
+	movsbl	246+masterConfig(%rip), %ecx
+	.loc 1 385 16 view .LVU360
+	negl	%ecx
+	.loc 1 385 13 view .LVU361
+	imull	%ecx, %eax
+.LVL68:
+	.loc 1 387 66 view .LVU362
+	movq	currentProfile(%rip), %rcx
+	movzbl	12(%rcx), %ecx
+	.loc 1 387 35 view .LVU363
+	cwtl
+	imull	%ecx, %eax
+	.loc 1 387 75 view .LVU364
+	movslq	%eax, %rcx
+	imulq	$-2004318071, %rcx, %rcx
+	shrq	$32, %rcx
+	addl	%eax, %ecx
+	sarl	$31, %eax
+	sarl	$4, %ecx
+	subl	%ecx, %eax
+	.loc 1 387 28 view .LVU365
+	addl	%eax, %edx
+	movw	%dx, 4+rcCommand(%rip)
+	ret
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L92:
+	.loc 1 387 28 view .LVU366
+.LBE6:
+	.loc 1 389 9 is_stmt 1 view .LVU367
+	.loc 1 389 17 is_stmt 0 view .LVU368
+	movw	%ax, magHold(%rip)
+.L91:
+	.loc 1 390 1 view .LVU369
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	updateMagHold, .-updateMagHold
+	.section	.text.processRx,"ax",@progbits
+	.p2align 4
+	.globl	processRx
+	.type	processRx, @function
+processRx:
+.LFB20:
+	.loc 1 393 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 394 5 view .LVU371
+	.loc 1 393 1 is_stmt 0 view .LVU372
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 394 5 view .LVU373
+	movl	currentTime(%rip), %edi
+	call	calculateRxChannelsAndUpdateFailsafe@PLT
+.LVL70:
+	.loc 1 397 5 is_stmt 1 view .LVU374
+	.loc 1 397 9 is_stmt 0 view .LVU375
+	movl	$4096, %edi
+	call	feature@PLT
+.LVL71:
+	.loc 1 397 8 view .LVU376
+	testb	%al, %al
+	je	.L103
+	.loc 1 398 9 is_stmt 1 view .LVU377
+	.loc 1 398 12 is_stmt 0 view .LVU378
+	testb	$1, rcModeActivationMask(%rip)
+	je	.L145
+.L103:
+	.loc 1 402 5 is_stmt 1 view .LVU379
+	movl	currentTime(%rip), %edi
+	call	updateRSSI@PLT
+.LVL72:
+	.loc 1 404 5 view .LVU380
+	.loc 1 404 9 is_stmt 0 view .LVU381
+	movl	$256, %edi
+	call	feature@PLT
+.LVL73:
+	.loc 1 404 8 view .LVU382
+	testb	%al, %al
+	je	.L104
+	.loc 1 406 9 is_stmt 1 view .LVU383
+	.loc 1 406 57 is_stmt 0 view .LVU384
+	movq	failsafe(%rip), %rax
+	.loc 1 406 12 view .LVU385
+	cmpl	$5000000, currentTime(%rip)
+	.loc 1 406 57 view .LVU386
+	movq	(%rax), %rdx
+	.loc 1 406 12 view .LVU387
+	ja	.L146
+.L106:
+	.loc 1 410 9 is_stmt 1 view .LVU388
+	.loc 1 410 25 is_stmt 0 view .LVU389
+	movq	(%rax), %rax
+	.loc 1 410 9 view .LVU390
+	call	*40(%rax)
+.LVL74:
+.L104:
+	.loc 1 413 5 is_stmt 1 view .LVU391
+	.loc 1 413 39 is_stmt 0 view .LVU392
+	movzwl	220+masterConfig(%rip), %esi
+	leaq	310+masterConfig(%rip), %rbp
+	movq	%rbp, %rdi
+	call	calculateThrottleStatus@PLT
+.LVL75:
+	movl	%eax, %ebx
+.LVL76:
+	.loc 1 415 5 is_stmt 1 view .LVU393
+	.loc 1 415 8 is_stmt 0 view .LVU394
+	testl	%eax, %eax
+	je	.L147
+.LVL77:
+.L108:
+	.loc 1 420 5 is_stmt 1 view .LVU395
+	xorl	%ecx, %ecx
+	cmpb	$0, 333+masterConfig(%rip)
+	movq	%rbp, %rdi
+	movl	%ebx, %esi
+	setne	%cl
+	xorl	%edx, %edx
+	cmpb	$0, 332+masterConfig(%rip)
+	setne	%dl
+	call	processRcStickPositions@PLT
+.LVL78:
+	.loc 1 422 5 view .LVU396
+	.loc 1 422 9 is_stmt 0 view .LVU397
+	movl	$4, %edi
+	call	feature@PLT
+.LVL79:
+	.loc 1 422 8 view .LVU398
+	testb	%al, %al
+	jne	.L148
+.L109:
+	.loc 1 426 5 is_stmt 1 view .LVU399
+	.loc 1 426 40 is_stmt 0 view .LVU400
+	movq	currentProfile(%rip), %rax
+	leaq	132(%rax), %rdi
+	.loc 1 426 5 view .LVU401
+	call	updateActivatedModes@PLT
+.LVL80:
+	.loc 1 428 4 is_stmt 1 view .LVU402
+	.loc 1 430 5 view .LVU403
+	.loc 1 430 8 is_stmt 0 view .LVU404
+	testb	$2, rcModeActivationMask(%rip)
+	jne	.L113
+	.loc 1 430 55 discriminator 2 view .LVU405
+	movl	$256, %edi
+	call	feature@PLT
+.LVL81:
+	.loc 1 430 51 discriminator 2 view .LVU406
+	testb	%al, %al
+	je	.L112
+	.loc 1 430 92 discriminator 3 view .LVU407
+	movq	failsafe(%rip), %rax
+	.loc 1 430 100 discriminator 3 view .LVU408
+	movq	(%rax), %rax
+	.loc 1 430 84 discriminator 3 view .LVU409
+	call	*16(%rax)
+.LVL82:
+	.loc 1 430 81 discriminator 3 view .LVU410
+	testb	%al, %al
+	je	.L112
+.L113:
+	.loc 1 430 126 view .LVU411
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL83:
+	.loc 1 430 122 view .LVU412
+	testb	%al, %al
+	je	.L112
+	.loc 1 432 6 is_stmt 1 view .LVU413
+.LVL84:
+	.loc 1 434 9 view .LVU414
+	.loc 1 434 31 is_stmt 0 view .LVU415
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 489 29 view .LVU416
+	movl	rcModeActivationMask(%rip), %edx
+	.loc 1 434 12 view .LVU417
+	testb	$1, %al
+	je	.L149
+.LVL85:
+.L115:
+	.loc 1 451 3 is_stmt 1 view .LVU418
+	.loc 1 451 20 is_stmt 0 view .LVU419
+	andl	$-3, %eax
+.L116:
+	.loc 1 454 5 is_stmt 1 view .LVU420
+	.loc 1 457 9 view .LVU421
+	.loc 1 489 5 view .LVU422
+	.loc 1 490 26 is_stmt 0 view .LVU423
+	movl	%eax, %ecx
+	andb	$-2, %ah
+	orb	$1, %ch
+	andb	$8, %dh
+	.loc 1 495 21 view .LVU424
+	movzbl	masterConfig(%rip), %edx
+	.loc 1 490 26 view .LVU425
+	cmovne	%ecx, %eax
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 495 5 is_stmt 1 view .LVU426
+	.loc 1 495 8 is_stmt 0 view .LVU427
+	cmpb	$8, %dl
+	je	.L121
+	cmpb	$14, %dl
+	je	.L121
+	.loc 1 498 1 view .LVU428
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL86:
+	.loc 1 498 1 view .LVU429
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL87:
+	.p2align 4,,10
+	.p2align 3
+.L112:
+	.cfi_restore_state
+	.loc 1 439 9 is_stmt 1 view .LVU430
+	.loc 1 439 26 is_stmt 0 view .LVU431
+	movzwl	flightModeFlags(%rip), %ecx
+	.loc 1 442 25 view .LVU432
+	movl	rcModeActivationMask(%rip), %edx
+	.loc 1 439 26 view .LVU433
+	movl	%ecx, %eax
+	andl	$-2, %eax
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 442 2 is_stmt 1 view .LVU434
+	.loc 1 442 5 is_stmt 0 view .LVU435
+	testb	$4, %dl
+	je	.L115
+	.loc 1 444 3 is_stmt 1 view .LVU436
+	.loc 1 446 3 view .LVU437
+	.loc 1 446 6 is_stmt 0 view .LVU438
+	andl	$2, %ecx
+	jne	.L116
+	.loc 1 447 4 is_stmt 1 view .LVU439
+	call	resetErrorAngle@PLT
+.LVL88:
+	.loc 1 448 4 view .LVU440
+	.loc 1 448 21 is_stmt 0 view .LVU441
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 489 29 view .LVU442
+	movl	rcModeActivationMask(%rip), %edx
+	.loc 1 448 21 view .LVU443
+	orl	$2, %eax
+	jmp	.L116
+.LVL89:
+	.p2align 4,,10
+	.p2align 3
+.L121:
+	.loc 1 496 9 is_stmt 1 view .LVU444
+	.loc 1 496 26 is_stmt 0 view .LVU445
+	andl	$-65, %eax
+	movw	%ax, flightModeFlags(%rip)
+	.loc 1 498 1 view .LVU446
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL90:
+	.loc 1 498 1 view .LVU447
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL91:
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	.cfi_restore_state
+	.loc 1 399 13 is_stmt 1 view .LVU448
+.LBB7:
+.LBI7:
+	.loc 1 313 6 view .LVU449
+.LBB8:
+	.loc 1 315 5 view .LVU450
+	.loc 1 315 22 is_stmt 0 view .LVU451
+	movzbl	armingFlags(%rip), %eax
+	.loc 1 315 8 view .LVU452
+	testb	$4, %al
+	je	.L103
+	.loc 1 316 9 is_stmt 1 view .LVU453
+	.loc 1 316 22 is_stmt 0 view .LVU454
+	andl	$-5, %eax
+	movb	%al, armingFlags(%rip)
+	jmp	.L103
+	.p2align 4,,10
+	.p2align 3
+.L146:
+.LBE8:
+.LBE7:
+	.loc 1 406 49 discriminator 1 view .LVU455
+	call	*64(%rdx)
+.LVL92:
+	movl	%eax, %edx
+	movq	failsafe(%rip), %rax
+	.loc 1 406 45 discriminator 1 view .LVU456
+	testb	%dl, %dl
+	jne	.L106
+	.loc 1 407 13 is_stmt 1 view .LVU457
+	.loc 1 407 29 is_stmt 0 view .LVU458
+	movq	(%rax), %rax
+	.loc 1 407 13 view .LVU459
+	call	*72(%rax)
+.LVL93:
+	movq	failsafe(%rip), %rax
+	jmp	.L106
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	.loc 1 423 9 is_stmt 1 view .LVU460
+	call	updateInflightCalibrationState
+.LVL95:
+	jmp	.L109
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L147:
+	.loc 1 416 9 view .LVU461
+	call	resetErrorAngle@PLT
+.LVL97:
+	.loc 1 417 9 view .LVU462
+	call	resetErrorGyro@PLT
+.LVL98:
+	jmp	.L108
+.LVL99:
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.loc 1 435 13 view .LVU463
+	call	resetErrorAngle@PLT
+.LVL100:
+	.loc 1 436 13 view .LVU464
+	.loc 1 436 30 is_stmt 0 view .LVU465
+	movzwl	flightModeFlags(%rip), %eax
+	.loc 1 489 29 view .LVU466
+	movl	rcModeActivationMask(%rip), %edx
+	.loc 1 436 30 view .LVU467
+	orl	$1, %eax
+	.loc 1 442 2 is_stmt 1 view .LVU468
+	jmp	.L115
+	.cfi_endproc
+.LFE20:
+	.size	processRx, .-processRx
+	.section	.text.taskMainPidLoopCheck,"ax",@progbits
+	.p2align 4
+	.globl	taskMainPidLoopCheck
+	.type	taskMainPidLoopCheck, @function
+taskMainPidLoopCheck:
+.LVL101:
+.LFB21:
+	.loc 1 505 1 view -0
+	.cfi_startproc
+	.loc 1 506 5 view .LVU470
+	.loc 1 505 1 is_stmt 0 view .LVU471
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 505 1 view .LVU472
+	movl	%edi, %ebx
+	.loc 1 506 9 view .LVU473
+	call	gyroSyncIsEnabled@PLT
+.LVL102:
+	.loc 1 506 8 view .LVU474
+	testb	%al, %al
+	jne	.L153
+	.loc 1 509 5 is_stmt 1 view .LVU475
+	.loc 1 509 44 is_stmt 0 view .LVU476
+	movzwl	8+masterConfig(%rip), %eax
+	.loc 1 509 29 view .LVU477
+	cmpl	%eax, %ebx
+	.loc 1 510 1 view .LVU478
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL103:
+	.loc 1 509 29 view .LVU479
+	setnb	%al
+	.loc 1 510 1 view .LVU480
+	ret
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L153:
+	.cfi_restore_state
+	.loc 1 507 9 is_stmt 1 view .LVU481
+	.loc 1 507 16 is_stmt 0 view .LVU482
+	call	micros@PLT
+.LVL105:
+	.loc 1 510 1 view .LVU483
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL106:
+	.loc 1 507 16 view .LVU484
+	movl	%eax, %edi
+	jmp	gyroSyncCheckUpdate@PLT
+.LVL107:
+	.cfi_endproc
+.LFE21:
+	.size	taskMainPidLoopCheck, .-taskMainPidLoopCheck
+	.section	.text.taskMainPidLoop,"ax",@progbits
+	.p2align 4
+	.globl	taskMainPidLoop
+	.type	taskMainPidLoop, @function
+taskMainPidLoop:
+.LFB22:
+	.loc 1 513 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 514 5 view .LVU486
+	.loc 1 516 5 view .LVU487
+	.loc 1 513 1 is_stmt 0 view .LVU488
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 516 10 view .LVU489
+	call	isBootComplete@PLT
+.LVL108:
+	.loc 1 516 8 view .LVU490
+	testb	%al, %al
+	je	.L176
+.L156:
+	.loc 1 521 5 is_stmt 1 view .LVU491
+	.loc 1 521 8 is_stmt 0 view .LVU492
+	cmpb	$1, 12+masterConfig(%rip)
+	jbe	.L161
+	.loc 1 522 9 is_stmt 1 view .LVU493
+	call	gyroAccumulateSample@PLT
+.LVL109:
+	.loc 1 523 9 view .LVU494
+	.loc 1 523 13 is_stmt 0 view .LVU495
+	movzbl	gyroSamplesSincePid.0(%rip), %eax
+	addl	$1, %eax
+	.loc 1 523 12 view .LVU496
+	cmpb	12+masterConfig(%rip), %al
+	movb	%al, gyroSamplesSincePid.0(%rip)
+	jb	.L154
+	.loc 1 526 9 is_stmt 1 view .LVU497
+	.loc 1 526 29 is_stmt 0 view .LVU498
+	movb	$0, gyroSamplesSincePid.0(%rip)
+.L161:
+	.loc 1 529 5 is_stmt 1 view .LVU499
+	xorl	%edi, %edi
+	call	profileStageBegin@PLT
+.LVL110:
+	.loc 1 530 5 view .LVU500
+	movq	currentProfile(%rip), %rax
+	movzbl	masterConfig(%rip), %esi
+	leaq	96(%rax), %rdi
+	call	computeIMU@PLT
+.LVL111:
+	.loc 1 531 5 view .LVU501
+	xorl	%edi, %edi
+	call	profileStageEnd@PLT
+.LVL112:
+	.loc 1 534 5 view .LVU502
+	.loc 1 534 19 is_stmt 0 view .LVU503
+	call	micros@PLT
+.LVL113:
+	.loc 1 538 5 view .LVU504
+	movl	$1, %edi
+	.loc 1 535 39 view .LVU505
+	movl	%eax, %edx
+	subw	previousTime(%rip), %dx
+	.loc 1 534 17 view .LVU506
+	movl	%eax, currentTime(%rip)
+	.loc 1 535 5 is_stmt 1 view .LVU507
+	.loc 1 535 39 is_stmt 0 view .LVU508
+	movw	%dx, cycleTime(%rip)
+	.loc 1 536 5 is_stmt 1 view .LVU509
+	.loc 1 536 18 is_stmt 0 view .LVU510
+	movl	%eax, previousTime(%rip)
+	.loc 1 538 5 is_stmt 1 view .LVU511
+	call	profileStageBegin@PLT
+.LVL114:
+	.loc 1 539 5 view .LVU512
+	call	annexCode
+.LVL115:
+	.loc 1 540 5 view .LVU513
+	movl	$1, %edi
+	call	profileStageEnd@PLT
+.LVL116:
+	.loc 1 542 5 view .LVU514
+	.loc 1 556 9 is_stmt 0 view .LVU515
+	movl	$4, %edi
+	.loc 1 542 32 view .LVU516
+	movb	$1, haveProcessedAnnexCodeOnce(%rip)
+	.loc 1 556 5 is_stmt 1 view .LVU517
+	.loc 1 556 9 is_stmt 0 view .LVU518
+	call	sensors@PLT
+.LVL117:
+	.loc 1 556 8 view .LVU519
+	testb	%al, %al
+	je	.L163
+.L166:
+	.loc 1 557 9 is_stmt 1 view .LVU520
+	.loc 1 557 12 is_stmt 0 view .LVU521
+	testw	$520, flightModeFlags(%rip)
+	jne	.L177
+.L167:
+	.loc 1 563 5 is_stmt 1 view .LVU522
+	.loc 1 563 23 is_stmt 0 view .LVU523
+	movq	currentProfile(%rip), %rax
+	movzbl	458(%rax), %edi
+	.loc 1 563 8 view .LVU524
+	testb	%dil, %dil
+	je	.L168
+	.loc 1 563 51 discriminator 1 view .LVU525
+	testb	$3, flightModeFlags(%rip)
+	jne	.L178
+.L168:
+	.loc 1 576 5 is_stmt 1 view .LVU526
+	movl	$2, %edi
+	call	profileStageBegin@PLT
+.LVL118:
+	.loc 1 577 5 view .LVU527
+	.loc 1 581 24 is_stmt 0 view .LVU528
+	movq	currentProfile(%rip), %rdi
+	.loc 1 577 5 view .LVU529
+	movzwl	268+masterConfig(%rip), %edx
+	leaq	96(%rdi), %rcx
+	leaq	84(%rdi), %rsi
+	addq	$4, %rdi
+	call	*pid_controller(%rip)
+.LVL119:
+	.loc 1 583 5 is_stmt 1 view .LVU530
+	movl	$2, %edi
+	call	profileStageEnd@PLT
+.LVL120:
+	.loc 1 585 5 view .LVU531
+	movl	$3, %edi
+	call	profileStageBegin@PLT
+.LVL121:
+	.loc 1 586 5 view .LVU532
+	call	mixTable@PLT
+.LVL122:
+	.loc 1 587 5 view .LVU533
+	movl	$3, %edi
+	call	profileStageEnd@PLT
+.LVL123:
+	.loc 1 589 5 view .LVU534
+	call	writeServos@PLT
+.LVL124:
+	.loc 1 591 5 view .LVU535
+	movl	$4, %edi
+	call	profileStageBegin@PLT
+.LVL125:
+	.loc 1 592 5 view .LVU536
+	call	writeMotors@PLT
+.LVL126:
+	.loc 1 593 5 view .LVU537
+	movl	$4, %edi
+	call	profileStageEnd@PLT
+.LVL127:
+	.loc 1 596 5 view .LVU538
+	movl	currentTime(%rip), %edi
+	.loc 1 598 1 is_stmt 0 view .LVU539
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 596 5 view .LVU540
+	jmp	blackboxLogIteration@PLT
+.LVL128:
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	.cfi_restore_state
+	.loc 1 558 13 is_stmt 1 view .LVU541
+	call	applyAltHold@PLT
+.LVL129:
+	jmp	.L167
+	.p2align 4,,10
+	.p2align 3
+.L154:
+	.loc 1 598 1 is_stmt 0 view .LVU542
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	.cfi_restore_state
+.LBB11:
+.LBI11:
+	.loc 1 166 12 is_stmt 1 view .LVU543
+.LBB12:
+	.loc 1 169 5 view .LVU544
+	.loc 1 169 9 is_stmt 0 view .LVU545
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL130:
+	.loc 1 169 8 view .LVU546
+	testb	%al, %al
+	je	.L160
+	.loc 1 169 34 view .LVU547
+	call	isBaroCalibrationComplete@PLT
+.LVL131:
+	.loc 1 169 30 view .LVU548
+	testb	%al, %al
+	je	.L156
+.L160:
+	.loc 1 174 5 is_stmt 1 view .LVU549
+	.loc 1 174 12 is_stmt 0 view .LVU550
+	call	isGyroCalibrationComplete@PLT
+.LVL132:
+.LBE12:
+.LBE11:
+	.loc 1 516 27 view .LVU551
+	testb	%al, %al
+	je	.L156
+	.loc 1 517 9 is_stmt 1 view .LVU552
+	movl	$6, %edi
+	call	bootStageEnd@PLT
+.LVL133:
+	jmp	.L156
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.loc 1 556 33 is_stmt 0 discriminator 1 view .LVU553
+	movl	$16, %edi
+	call	sensors@PLT
+.LVL134:
+	.loc 1 556 30 discriminator 1 view .LVU554
+	testb	%al, %al
+	jne	.L166
+	jmp	.L167
+	.p2align 4,,10
+	.p2align 3
+.L178:
+	.loc 1 564 9 is_stmt 1 view .LVU555
+	.loc 1 564 32 is_stmt 0 view .LVU556
+	call	calculateThrottleAngleCorrection@PLT
+.LVL135:
+	.loc 1 564 29 view .LVU557
+	addw	%ax, 6+rcCommand(%rip)
+	jmp	.L168
+	.cfi_endproc
+.LFE22:
+	.size	taskMainPidLoop, .-taskMainPidLoop
+	.section	.text.taskUpdateRxCheck,"ax",@progbits
+	.p2align 4
+	.globl	taskUpdateRxCheck
+	.type	taskUpdateRxCheck, @function
+taskUpdateRxCheck:
+.LVL136:
+.LFB23:
+	.loc 1 601 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 602 5 view .LVU559
+	.loc 1 604 5 view .LVU560
+	.loc 1 601 1 is_stmt 0 view .LVU561
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 604 5 view .LVU562
+	call	updateRx@PLT
+.LVL137:
+	.loc 1 605 5 is_stmt 1 view .LVU563
+	.loc 1 605 12 is_stmt 0 view .LVU564
+	call	micros@PLT
+.LVL138:
+	.loc 1 606 1 view .LVU565
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 605 12 view .LVU566
+	movl	%eax, %edi
+	jmp	shouldProcessRx@PLT
+.LVL139:
+	.cfi_endproc
+.LFE23:
+	.size	taskUpdateRxCheck, .-taskUpdateRxCheck
+	.section	.text.taskUpdateRxMain,"ax",@progbits
+	.p2align 4
+	.globl	taskUpdateRxMain
+	.type	taskUpdateRxMain, @function
+taskUpdateRxMain:
+.LFB24:
+	.loc 1 609 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 610 5 view .LVU568
+	.loc 1 609 1 is_stmt 0 view .LVU569
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 610 19 view .LVU570
+	call	micros@PLT
+.LVL140:
+	.loc 1 610 17 view .LVU571
+	movl	%eax, currentTime(%rip)
+	.loc 1 612 5 is_stmt 1 view .LVU572
+	call	processRx
+.LVL141:
+	.loc 1 616 5 view .LVU573
+	.loc 1 616 8 is_stmt 0 view .LVU574
+	cmpb	$0, haveProcessedAnnexCodeOnce(%rip)
+	jne	.L189
+.L181:
+	.loc 1 631 1 view .LVU575
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L189:
+	.cfi_restore_state
+	.loc 1 617 9 is_stmt 1 view .LVU576
+	.loc 1 617 13 is_stmt 0 view .LVU577
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL142:
+	.loc 1 617 12 view .LVU578
+	testb	%al, %al
+	je	.L181
+	.loc 1 618 13 is_stmt 1 view .LVU579
+	.loc 1 631 1 is_stmt 0 view .LVU580
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 618 13 view .LVU581
+	jmp	updateAltHoldState@PLT
+.LVL143:
+	.cfi_endproc
+.LFE24:
+	.size	taskUpdateRxMain, .-taskUpdateRxMain
+	.section	.text.taskHandleSerial,"ax",@progbits
+	.p2align 4
+	.globl	taskHandleSerial
+	.type	taskHandleSerial, @function
+taskHandleSerial:
+.LFB25:
+	.loc 1 634 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 635 5 view .LVU583
+	.loc 1 634 1 is_stmt 0 view .LVU584
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 635 5 view .LVU585
+	movl	$5, %edi
+	call	profileStageBegin@PLT
+.LVL144:
+	.loc 1 636 5 is_stmt 1 view .LVU586
+	call	handleSerial@PLT
+.LVL145:
+	.loc 1 637 5 view .LVU587
+	movl	$5, %edi
+	.loc 1 638 1 is_stmt 0 view .LVU588
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 637 5 view .LVU589
+	jmp	profileStageEnd@PLT
+.LVL146:
+	.cfi_endproc
+.LFE25:
+	.size	taskHandleSerial, .-taskHandleSerial
+	.section	.text.taskSaveConfigCheck,"ax",@progbits
+	.p2align 4
+	.globl	taskSaveConfigCheck
+	.type	taskSaveConfigCheck, @function
+taskSaveConfigCheck:
+.LVL147:
+.LFB26:
+	.loc 1 641 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 642 5 view .LVU591
+	.loc 1 644 5 view .LVU592
+	.loc 1 644 12 is_stmt 0 view .LVU593
+	jmp	isEEPROMWritePending@PLT
+.LVL148:
+	.loc 1 644 12 view .LVU594
+	.cfi_endproc
+.LFE26:
+	.size	taskSaveConfigCheck, .-taskSaveConfigCheck
+	.section	.text.taskSaveConfig,"ax",@progbits
+	.p2align 4
+	.globl	taskSaveConfig
+	.type	taskSaveConfig, @function
+taskSaveConfig:
+.LFB27:
+	.loc 1 648 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 649 5 view .LVU596
+	jmp	processEEPROMWrite@PLT
+.LVL149:
+	.cfi_endproc
+.LFE27:
+	.size	taskSaveConfig, .-taskSaveConfig
+	.section	.text.taskUpdateBaro,"ax",@progbits
+	.p2align 4
+	.globl	taskUpdateBaro
+	.type	taskUpdateBaro, @function
+taskUpdateBaro:
+.LFB28:
+	.loc 1 671 1 view -0
+	.cfi_startproc
+	.loc 1 672 5 view .LVU598
+	.loc 1 671 1 is_stmt 0 view .LVU599
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 672 19 view .LVU600
+	call	micros@PLT
+.LVL150:
+	.loc 1 672 17 view .LVU601
+	movl	%eax, currentTime(%rip)
+	.loc 1 673 5 is_stmt 1 view .LVU602
+	.loc 1 672 19 is_stmt 0 view .LVU603
+	movl	%eax, %edi
+	.loc 1 674 1 view .LVU604
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 673 5 view .LVU605
+	jmp	baroUpdate@PLT
+.LVL151:
+	.cfi_endproc
+.LFE28:
+	.size	taskUpdateBaro, .-taskUpdateBaro
+	.section	.text.taskCalculateAltitude,"ax",@progbits
+	.p2align 4
+	.globl	taskCalculateAltitude
+	.type	taskCalculateAltitude, @function
+taskCalculateAltitude:
+.LFB29:
+	.loc 1 686 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 688 5 view .LVU607
+	.loc 1 686 1 is_stmt 0 view .LVU608
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 688 9 view .LVU609
+	movl	$4, %edi
+	call	sensors@PLT
+.LVL152:
+	.loc 1 688 8 view .LVU610
+	testb	%al, %al
+	jne	.L204
+.L196:
+	.loc 1 699 1 view .LVU611
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L204:
+	.cfi_restore_state
+	.loc 1 688 33 discriminator 1 view .LVU612
+	call	isBaroReady@PLT
+.LVL153:
+	.loc 1 688 30 discriminator 1 view .LVU613
+	testb	%al, %al
+	je	.L196
+	.loc 1 696 9 is_stmt 1 view .LVU614
+	.loc 1 696 23 is_stmt 0 view .LVU615
+	call	micros@PLT
+.LVL154:
+	.loc 1 696 21 view .LVU616
+	movl	%eax, currentTime(%rip)
+	.loc 1 697 9 is_stmt 1 view .LVU617
+	.loc 1 696 23 is_stmt 0 view .LVU618
+	movl	%eax, %edi
+	.loc 1 699 1 view .LVU619
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 697 9 view .LVU620
+	jmp	calculateEstimatedAltitude@PLT
+.LVL155:
+	.cfi_endproc
+.LFE29:
+	.size	taskCalculateAltitude, .-taskCalculateAltitude
+	.section	.text.taskBlackbox,"ax",@progbits
+	.p2align 4
+	.globl	taskBlackbox
+	.type	taskBlackbox, @function
+taskBlackbox:
+.LFB30:
+	.loc 1 731 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 732 5 view .LVU622
+	.loc 1 731 1 is_stmt 0 view .LVU623
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 732 5 view .LVU624
+	movl	$8, %edi
+	call	profileStageBegin@PLT
+.LVL156:
+	.loc 1 733 5 is_stmt 1 view .LVU625
+	call	handleBlackbox@PLT
+.LVL157:
+	.loc 1 734 5 view .LVU626
+	movl	$8, %edi
+	.loc 1 735 1 is_stmt 0 view .LVU627
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 734 5 view .LVU628
+	jmp	profileStageEnd@PLT
+.LVL158:
+	.cfi_endproc
+.LFE30:
+	.size	taskBlackbox, .-taskBlackbox
+	.section	.bss.gyroSamplesSincePid.0,"aw",@nobits
+	.type	gyroSamplesSincePid.0, @object
+	.size	gyroSamplesSincePid.0, 1
+gyroSamplesSincePid.0:
+	.zero	1
+	.section	.bss.batteryWarningEnabled.1,"aw",@nobits
+	.type	batteryWarningEnabled.1, @object
+	.size	batteryWarningEnabled.1, 1
+batteryWarningEnabled.1:
+	.zero	1
+	.section	.bss.vbatTimer.2,"aw",@nobits
+	.type	vbatTimer.2, @object
+	.size	vbatTimer.2, 1
+vbatTimer.2:
+	.zero	1
+	.section	.bss.vbatCycleTime.3,"aw",@nobits
+	.align 4
+	.type	vbatCycleTime.3, @object
+	.size	vbatCycleTime.3, 4
+vbatCycleTime.3:
+	.zero	4
+	.section	.bss.haveProcessedAnnexCodeOnce,"aw",@nobits
+	.type	haveProcessedAnnexCodeOnce, @object
+	.size	haveProcessedAnnexCodeOnce, 1
+haveProcessedAnnexCodeOnce:
+	.zero	1
+	.globl	InflightcalibratingA
+	.section	.bss.InflightcalibratingA,"aw",@nobits
+	.align 2
+	.type	InflightcalibratingA, @object
+	.size	InflightcalibratingA, 2
+InflightcalibratingA:
+	.zero	2
+	.globl	AccInflightCalibrationActive
+	.section	.bss.AccInflightCalibrationActive,"aw",@nobits
+	.type	AccInflightCalibrationActive, @object
+	.size	AccInflightCalibrationActive, 1
+AccInflightCalibrationActive:
+	.zero	1
+	.globl	AccInflightCalibrationSavetoEEProm
+	.section	.bss.AccInflightCalibrationSavetoEEProm,"aw",@nobits
+	.type	AccInflightCalibrationSavetoEEProm, @object
+	.size	AccInflightCalibrationSavetoEEProm, 1
+AccInflightCalibrationSavetoEEProm:
+	.zero	1
+	.globl	AccInflightCalibrationMeasurementDone
+	.section	.bss.AccInflightCalibrationMeasurementDone,"aw",@nobits
+	.type	AccInflightCalibrationMeasurementDone, @object
+	.size	AccInflightCalibrationMeasurementDone, 1
+AccInflightCalibrationMeasurementDone:
+	.zero	1
+	.globl	AccInflightCalibrationArmed
+	.section	.bss.AccInflightCalibrationArmed,"aw",@nobits
+	.type	AccInflightCalibrationArmed, @object
+	.size	AccInflightCalibrationArmed, 1
+AccInflightCalibrationArmed:
+	.zero	1
+	.comm	telemTemperature1,2,2
+	.comm	headFreeModeHold,2,2
+	.globl	targetPidLooptime
+	.section	.bss.targetPidLooptime,"aw",@nobits
+	.align 4
+	.type	targetPidLooptime, @object
+	.size	targetPidLooptime, 4
+targetPidLooptime:
+	.zero	4
+	.globl	cycleTime
+	.section	.bss.cycleTime,"aw",@nobits
+	.align 2
+	.type	cycleTime, @object
+	.size	cycleTime, 2
+cycleTime:
+	.zero	2
+	.globl	previousTime
+	.section	.bss.previousTime,"aw",@nobits
+	.align 4
+	.type	previousTime, @object
+	.size	previousTime, 4
+previousTime:
+	.zero	4
+	.globl	currentTime
+	.section	.bss.currentTime,"aw",@nobits
+	.align 4
+	.type	currentTime, @object
+	.size	currentTime, 4
+currentTime:
+	.zero	4
+	.comm	debug,8,8
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/common/color.h"
+	.file 6 ".//src/main/common/boot_timing.h"
+	.file 7 ".//src/main/common/profiling.h"
+	.file 8 ".//src/main/drivers/accgyro.h"
+	.file 9 ".//src/main/drivers/serial.h"
+	.file 10 ".//src/main/drivers/pwm_rx.h"
+	.file 11 ".//src/main/flight/flight.h"
+	.file 12 ".//src/main/sensors/sensors.h"
+	.file 13 ".//src/main/sensors/boardalignment.h"
+	.file 14 ".//src/main/sensors/acceleration.h"
+	.file 15 ".//src/main/sensors/barometer.h"
+	.file 16 ".//src/main/sensors/gyro.h"
+	.file 17 ".//src/main/sensors/battery.h"
+	.file 18 ".//src/main/io/escservo.h"
+	.file 19 ".//src/main/flight/failsafe.h"
+	.file 20 ".//src/main/flight/mixer.h"
+	.file 21 ".//src/main/io/gimbal.h"
+	.file 22 ".//src/main/io/serial.h"
+	.file 23 ".//src/main/rx/rx.h"
+	.file 24 ".//src/main/io/rc_controls.h"
+	.file 25 ".//src/main/io/rc_curves.h"
+	.file 26 ".//src/main/telemetry/telemetry.h"
+	.file 27 ".//src/main/config/runtime_config.h"
+	.file 28 ".//src/main/config/config.h"
+	.file 29 ".//src/main/config/config_profile.h"
+	.file 30 ".//src/main/config/config_master.h"
+	.file 31 ".//src/main/build_config.h"
+	.file 32 ".//src/main/scheduler/scheduler.h"
+	.file 33 ".//src/main/flight/imu.h"
+	.file 34 ".//src/main/blackbox/blackbox.h"
+	.file 35 ".//src/main/flight/altitudehold.h"
+	.file 36 ".//src/main/sensors/gyro_sync.h"
+	.file 37 ".//src/main/drivers/system.h"
+	.file 38 ".//src/main/io/beeper.h"
+	.file 39 ".//src/main/io/statusindicator.h"
+	.file 40 ".//src/main/common/maths.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2461
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2c
+	.long	.LASF1988
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL17
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1437
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1438
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1439
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1440
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1441
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1442
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1443
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1444
+	.uleb128 0x3
+	.long	.LASF1446
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x79
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1445
+	.uleb128 0x3
+	.long	.LASF1447
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1448
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1449
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x5f
+	.uleb128 0x3
+	.long	.LASF1450
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x43
+	.uleb128 0x3
+	.long	.LASF1451
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x66
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1452
+	.uleb128 0x3
+	.long	.LASF1453
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x6d
+	.uleb128 0x3
+	.long	.LASF1454
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x8c
+	.uleb128 0x3
+	.long	.LASF1455
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0xa4
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1456
+	.uleb128 0x3
+	.long	.LASF1457
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x80
+	.uleb128 0x3
+	.long	.LASF1458
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x98
+	.uleb128 0x3
+	.long	.LASF1459
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xb0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1460
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x5
+	.byte	0x15
+	.long	0x137
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0xee
+	.long	0x147
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x6
+	.byte	0x15
+	.long	0x183
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1470
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1471
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1472
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x147
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x7
+	.byte	0x14
+	.long	0x1d7
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1477
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1480
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1483
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x3
+	.long	0x18f
+	.uleb128 0x3
+	.long	.LASF1484
+	.byte	0x8
+	.byte	0x16
+	.byte	0x10
+	.long	0x1ef
+	.uleb128 0x10
+	.long	0x1f4
+	.uleb128 0x2e
+	.uleb128 0x3
+	.long	.LASF1485
+	.byte	0x8
+	.byte	0x17
+	.byte	0x10
+	.long	0x201
+	.uleb128 0x10
+	.long	0x206
+	.uleb128 0x1c
+	.long	0x211
+	.uleb128 0x4
+	.long	0x211
+	.byte	0
+	.uleb128 0x10
+	.long	0xcf
+	.uleb128 0x9
+	.long	.LASF1510
+	.byte	0x20
+	.byte	0x8
+	.byte	0x19
+	.long	0x264
+	.uleb128 0x2
+	.long	.LASF1486
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x17
+	.long	0x1e3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1487
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x17
+	.long	0x1f5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1488
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x17
+	.long	0x1f5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1489
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xb
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1490
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xe
+	.long	0x106
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1491
+	.byte	0x8
+	.byte	0x1f
+	.byte	0x3
+	.long	0x216
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x9
+	.byte	0x16
+	.long	0x288
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1494
+	.byte	0x9
+	.byte	0x19
+	.byte	0x3
+	.long	0x270
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1495
+	.uleb128 0xa
+	.long	0x66
+	.byte	0xa
+	.byte	0x14
+	.long	0x2b3
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0xa
+	.byte	0x17
+	.byte	0x3
+	.long	0x29b
+	.uleb128 0xa
+	.long	0x66
+	.byte	0xb
+	.byte	0x15
+	.long	0x30d
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1511
+	.byte	0x50
+	.byte	0xb
+	.byte	0x23
+	.long	0x38c
+	.uleb128 0x12
+	.string	"P8"
+	.byte	0xb
+	.byte	0x24
+	.byte	0xd
+	.long	0x38c
+	.byte	0
+	.uleb128 0x12
+	.string	"I8"
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x38c
+	.byte	0xa
+	.uleb128 0x12
+	.string	"D8"
+	.byte	0xb
+	.byte	0x26
+	.byte	0xd
+	.long	0x38c
+	.byte	0x14
+	.uleb128 0x12
+	.string	"P_f"
+	.byte	0xb
+	.byte	0x28
+	.byte	0xb
+	.long	0x39c
+	.byte	0x20
+	.uleb128 0x12
+	.string	"I_f"
+	.byte	0xb
+	.byte	0x29
+	.byte	0xb
+	.long	0x39c
+	.byte	0x2c
+	.uleb128 0x12
+	.string	"D_f"
+	.byte	0xb
+	.byte	0x2a
+	.byte	0xb
+	.long	0x39c
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xb
+	.long	0x2e
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xb
+	.long	0x2e
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1514
+	.byte	0xb
+	.byte	0x2e
+	.byte	0xd
+	.long	0xee
+	.byte	0x4c
+	.byte	0
+	.uleb128 0xe
+	.long	0xee
+	.long	0x39c
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x9
+	.byte	0
+	.uleb128 0xe
+	.long	0x2e
+	.long	0x3ac
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1515
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x3
+	.long	0x30d
+	.uleb128 0x9
+	.long	.LASF1516
+	.byte	0x6
+	.byte	0xb
+	.byte	0x57
+	.long	0x3ec
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0xb
+	.byte	0x58
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1518
+	.byte	0xb
+	.byte	0x59
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x12
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x5a
+	.byte	0xd
+	.long	0xcf
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1519
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x3
+	.long	0x3b8
+	.uleb128 0x21
+	.byte	0x6
+	.byte	0x5d
+	.long	0x415
+	.uleb128 0x22
+	.string	"raw"
+	.byte	0x5e
+	.long	0x415
+	.uleb128 0x23
+	.long	.LASF1520
+	.byte	0x5f
+	.byte	0x1f
+	.long	0x3ec
+	.byte	0
+	.uleb128 0xe
+	.long	0xcf
+	.long	0x425
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1521
+	.byte	0xb
+	.byte	0x60
+	.byte	0x3
+	.long	0x3f8
+	.uleb128 0x9
+	.long	.LASF1522
+	.byte	0x4
+	.byte	0xb
+	.byte	0x62
+	.long	0x458
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0xb
+	.byte	0x63
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1518
+	.byte	0xb
+	.byte	0x64
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0xb
+	.byte	0x65
+	.byte	0x3
+	.long	0x431
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x67
+	.long	0x481
+	.uleb128 0x22
+	.string	"raw"
+	.byte	0x68
+	.long	0x481
+	.uleb128 0x23
+	.long	.LASF1520
+	.byte	0x69
+	.byte	0x1d
+	.long	0x458
+	.byte	0
+	.uleb128 0xe
+	.long	0xcf
+	.long	0x491
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1524
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x3
+	.long	0x464
+	.uleb128 0xb
+	.long	.LASF1525
+	.byte	0xb
+	.byte	0x84
+	.byte	0x10
+	.long	0xcf
+	.uleb128 0xb
+	.long	.LASF1526
+	.byte	0xb
+	.byte	0x84
+	.byte	0x19
+	.long	0xcf
+	.uleb128 0xa
+	.long	0x66
+	.byte	0xc
+	.byte	0x1c
+	.long	0x4eb
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x40
+	.byte	0
+	.uleb128 0xa
+	.long	0x66
+	.byte	0xc
+	.byte	0x26
+	.long	0x52d
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1543
+	.byte	0xc
+	.byte	0x30
+	.byte	0x3
+	.long	0x4eb
+	.uleb128 0x9
+	.long	.LASF1544
+	.byte	0xc
+	.byte	0xc
+	.byte	0x32
+	.long	0x56d
+	.uleb128 0x2
+	.long	.LASF1545
+	.byte	0xc
+	.byte	0x33
+	.byte	0x14
+	.long	0x52d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0xc
+	.byte	0x34
+	.byte	0x14
+	.long	0x52d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1547
+	.byte	0xc
+	.byte	0x35
+	.byte	0x14
+	.long	0x52d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1548
+	.byte	0xc
+	.byte	0x36
+	.byte	0x3
+	.long	0x539
+	.uleb128 0x9
+	.long	.LASF1549
+	.byte	0x10
+	.byte	0xc
+	.byte	0x39
+	.long	0x5d4
+	.uleb128 0x2
+	.long	.LASF1550
+	.byte	0xc
+	.byte	0x3a
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0xc
+	.byte	0x3b
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1552
+	.byte	0xc
+	.byte	0x3c
+	.byte	0xd
+	.long	0xee
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1553
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xd
+	.long	0xee
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1554
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xd
+	.long	0x415
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1555
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1556
+	.byte	0xc
+	.byte	0x40
+	.byte	0x3
+	.long	0x579
+	.uleb128 0x9
+	.long	.LASF1557
+	.byte	0x6
+	.byte	0xd
+	.byte	0x14
+	.long	0x614
+	.uleb128 0x2
+	.long	.LASF1558
+	.byte	0xd
+	.byte	0x15
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1559
+	.byte	0xd
+	.byte	0x16
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1560
+	.byte	0xd
+	.byte	0x17
+	.byte	0xd
+	.long	0xcf
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1561
+	.byte	0xd
+	.byte	0x18
+	.byte	0x3
+	.long	0x5e0
+	.uleb128 0x9
+	.long	.LASF1562
+	.byte	0x2
+	.byte	0xe
+	.byte	0x27
+	.long	0x644
+	.uleb128 0x12
+	.string	"xy"
+	.byte	0xe
+	.byte	0x28
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x12
+	.string	"z"
+	.byte	0xe
+	.byte	0x29
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1563
+	.byte	0xe
+	.byte	0x2a
+	.byte	0x3
+	.long	0x620
+	.uleb128 0x9
+	.long	.LASF1564
+	.byte	0x10
+	.byte	0xf
+	.byte	0x1f
+	.long	0x691
+	.uleb128 0x2
+	.long	.LASF1565
+	.byte	0xf
+	.byte	0x20
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1566
+	.byte	0xf
+	.byte	0x21
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0xf
+	.byte	0x22
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0xf
+	.byte	0x23
+	.byte	0xb
+	.long	0x2e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1569
+	.byte	0xf
+	.byte	0x24
+	.byte	0x3
+	.long	0x650
+	.uleb128 0xb
+	.long	.LASF1570
+	.byte	0x10
+	.byte	0x20
+	.byte	0xf
+	.long	0x264
+	.uleb128 0x9
+	.long	.LASF1571
+	.byte	0x8
+	.byte	0x10
+	.byte	0x24
+	.long	0x6ea
+	.uleb128 0x2
+	.long	.LASF1572
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1573
+	.byte	0x10
+	.byte	0x26
+	.byte	0xe
+	.long	0xfa
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x10
+	.byte	0x27
+	.byte	0xe
+	.long	0xfa
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1575
+	.byte	0x10
+	.byte	0x28
+	.byte	0xe
+	.long	0xfa
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1576
+	.byte	0x10
+	.byte	0x29
+	.byte	0x3
+	.long	0x6a9
+	.uleb128 0x9
+	.long	.LASF1577
+	.byte	0xa
+	.byte	0x11
+	.byte	0x18
+	.long	0x751
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0x11
+	.byte	0x19
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1580
+	.byte	0x11
+	.byte	0x1b
+	.byte	0xd
+	.long	0xee
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1581
+	.byte	0x11
+	.byte	0x1d
+	.byte	0xe
+	.long	0xfa
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1582
+	.byte	0x11
+	.byte	0x1e
+	.byte	0xe
+	.long	0xfa
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1583
+	.byte	0x11
+	.byte	0x21
+	.byte	0xd
+	.long	0xee
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1584
+	.byte	0x11
+	.byte	0x22
+	.byte	0x3
+	.long	0x6f6
+	.uleb128 0x9
+	.long	.LASF1585
+	.byte	0x6
+	.byte	0x12
+	.byte	0x14
+	.long	0x791
+	.uleb128 0x2
+	.long	.LASF1586
+	.byte	0x12
+	.byte	0x15
+	.byte	0xe
+	.long	0xfa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1587
+	.byte	0x12
+	.byte	0x16
+	.byte	0xe
+	.long	0xfa
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1588
+	.byte	0x12
+	.byte	0x17
+	.byte	0xe
+	.long	0xfa
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1589
+	.byte	0x12
+	.byte	0x18
+	.byte	0x3
+	.long	0x75d
+	.uleb128 0x9
+	.long	.LASF1590
+	.byte	0x8
+	.byte	0x13
+	.byte	0x16
+	.long	0x7eb
+	.uleb128 0x2
+	.long	.LASF1591
+	.byte	0x13
+	.byte	0x17
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1592
+	.byte	0x13
+	.byte	0x18
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1593
+	.byte	0x13
+	.byte	0x19
+	.byte	0xe
+	.long	0xfa
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0x13
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfa
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1595
+	.byte	0x13
+	.byte	0x1b
+	.byte	0xe
+	.long	0xfa
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1596
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x3
+	.long	0x79d
+	.uleb128 0x9
+	.long	.LASF1597
+	.byte	0x50
+	.byte	0x13
+	.byte	0x1e
+	.long	0x886
+	.uleb128 0x2
+	.long	.LASF1598
+	.byte	0x13
+	.byte	0x1f
+	.byte	0xc
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1599
+	.byte	0x13
+	.byte	0x20
+	.byte	0xb
+	.long	0x895
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0x13
+	.byte	0x21
+	.byte	0xb
+	.long	0x89f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1601
+	.byte	0x13
+	.byte	0x22
+	.byte	0xb
+	.long	0x89f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1602
+	.byte	0x13
+	.byte	0x23
+	.byte	0xc
+	.long	0x1ef
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1603
+	.byte	0x13
+	.byte	0x24
+	.byte	0xc
+	.long	0x1ef
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1604
+	.byte	0x13
+	.byte	0x25
+	.byte	0xb
+	.long	0x89f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0x13
+	.byte	0x26
+	.byte	0xc
+	.long	0x8b4
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1606
+	.byte	0x13
+	.byte	0x27
+	.byte	0xb
+	.long	0x89f
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1607
+	.byte	0x13
+	.byte	0x28
+	.byte	0xc
+	.long	0x1ef
+	.byte	0x48
+	.byte	0
+	.uleb128 0x2f
+	.long	0x294
+	.long	0x895
+	.uleb128 0x4
+	.long	0x294
+	.byte	0
+	.uleb128 0x10
+	.long	0x886
+	.uleb128 0x30
+	.long	0x294
+	.uleb128 0x10
+	.long	0x89a
+	.uleb128 0x1c
+	.long	0x8b4
+	.uleb128 0x4
+	.long	0xee
+	.uleb128 0x4
+	.long	0xfa
+	.byte	0
+	.uleb128 0x10
+	.long	0x8a4
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0x13
+	.byte	0x2a
+	.byte	0x3
+	.long	0x7f7
+	.uleb128 0x31
+	.long	0x8b9
+	.uleb128 0x9
+	.long	.LASF1609
+	.byte	0x10
+	.byte	0x13
+	.byte	0x2c
+	.long	0x90b
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0x13
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x90b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1611
+	.byte	0x13
+	.byte	0x2f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0x13
+	.byte	0x30
+	.byte	0xd
+	.long	0xcf
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1613
+	.byte	0x13
+	.byte	0x31
+	.byte	0x9
+	.long	0x294
+	.byte	0xc
+	.byte	0
+	.uleb128 0x10
+	.long	0x8c5
+	.uleb128 0x3
+	.long	.LASF1614
+	.byte	0x13
+	.byte	0x32
+	.byte	0x3
+	.long	0x8ca
+	.uleb128 0x24
+	.long	.LASF1709
+	.long	0x66
+	.byte	0x14
+	.byte	0x18
+	.long	0x9b6
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x17
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1638
+	.byte	0x10
+	.byte	0x14
+	.byte	0x34
+	.long	0x9f7
+	.uleb128 0x2
+	.long	.LASF1639
+	.byte	0x14
+	.byte	0x35
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x14
+	.byte	0x36
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1518
+	.byte	0x14
+	.byte	0x37
+	.byte	0xb
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x12
+	.string	"yaw"
+	.byte	0x14
+	.byte	0x38
+	.byte	0xb
+	.long	0x2e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x14
+	.byte	0x39
+	.byte	0x3
+	.long	0x9b6
+	.uleb128 0x9
+	.long	.LASF1640
+	.byte	0x2
+	.byte	0x14
+	.byte	0x42
+	.long	0xa2a
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x14
+	.byte	0x43
+	.byte	0xc
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1642
+	.byte	0x14
+	.byte	0x44
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0x14
+	.byte	0x45
+	.byte	0x3
+	.long	0xa03
+	.uleb128 0x9
+	.long	.LASF1644
+	.byte	0x8
+	.byte	0x14
+	.byte	0x47
+	.long	0xa77
+	.uleb128 0x2
+	.long	.LASF1645
+	.byte	0x14
+	.byte	0x48
+	.byte	0xe
+	.long	0xfa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1646
+	.byte	0x14
+	.byte	0x49
+	.byte	0xe
+	.long	0xfa
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1647
+	.byte	0x14
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfa
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1648
+	.byte	0x14
+	.byte	0x4b
+	.byte	0xe
+	.long	0xfa
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x14
+	.byte	0x4c
+	.byte	0x3
+	.long	0xa36
+	.uleb128 0x9
+	.long	.LASF1650
+	.byte	0x1
+	.byte	0x14
+	.byte	0x4e
+	.long	0xa9d
+	.uleb128 0x2
+	.long	.LASF1651
+	.byte	0x14
+	.byte	0x4f
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1650
+	.byte	0x14
+	.byte	0x50
+	.byte	0x3
+	.long	0xa83
+	.uleb128 0x9
+	.long	.LASF1652
+	.byte	0x8
+	.byte	0x14
+	.byte	0x54
+	.long	0xaf7
+	.uleb128 0x12
+	.string	"min"
+	.byte	0x14
+	.byte	0x55
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x12
+	.string	"max"
+	.byte	0x14
+	.byte	0x56
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1653
+	.byte	0x14
+	.byte	0x57
+	.byte	0xd
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1654
+	.byte	0x14
+	.byte	0x58
+	.byte	0xc
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1655
+	.byte	0x14
+	.byte	0x59
+	.byte	0xc
+	.long	0xc3
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1652
+	.byte	0x14
+	.byte	0x5a
+	.byte	0x3
+	.long	0xaa9
+	.uleb128 0xe
+	.long	0xcf
+	.long	0xb13
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1656
+	.byte	0x1
+	.byte	0x15
+	.byte	0x1a
+	.long	0xb2d
+	.uleb128 0x2
+	.long	.LASF1657
+	.byte	0x15
+	.byte	0x1b
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1658
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x3
+	.long	0xb13
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x16
+	.byte	0x14
+	.long	0xb75
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1667
+	.byte	0x18
+	.byte	0x16
+	.byte	0x80
+	.long	0xbd0
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0x16
+	.byte	0x81
+	.byte	0xd
+	.long	0xbd0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0x16
+	.byte	0x82
+	.byte	0xe
+	.long	0x106
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1670
+	.byte	0x16
+	.byte	0x83
+	.byte	0xe
+	.long	0x106
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1671
+	.byte	0x16
+	.byte	0x84
+	.byte	0xe
+	.long	0x106
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1672
+	.byte	0x16
+	.byte	0x85
+	.byte	0xe
+	.long	0x106
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1673
+	.byte	0x16
+	.byte	0x87
+	.byte	0xd
+	.long	0xee
+	.byte	0x14
+	.byte	0
+	.uleb128 0xe
+	.long	0xee
+	.long	0xbe0
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1674
+	.byte	0x16
+	.byte	0x88
+	.byte	0x3
+	.long	0xb75
+	.uleb128 0xe
+	.long	0xcf
+	.long	0xbfc
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1675
+	.byte	0x17
+	.byte	0x39
+	.byte	0x10
+	.long	0xbec
+	.uleb128 0x9
+	.long	.LASF1676
+	.byte	0x12
+	.byte	0x17
+	.byte	0x3d
+	.long	0xc63
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xd
+	.long	0xc63
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1678
+	.byte	0x17
+	.byte	0x3f
+	.byte	0xd
+	.long	0xee
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1679
+	.byte	0x17
+	.byte	0x40
+	.byte	0xe
+	.long	0xfa
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0x17
+	.byte	0x41
+	.byte	0xe
+	.long	0xfa
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x17
+	.byte	0x42
+	.byte	0xe
+	.long	0xfa
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x17
+	.byte	0x43
+	.byte	0xd
+	.long	0xee
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0xee
+	.long	0xc73
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1683
+	.byte	0x17
+	.byte	0x44
+	.byte	0x3
+	.long	0xc08
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x18
+	.byte	0x14
+	.long	0xd15
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1707
+	.byte	0x18
+	.byte	0x2d
+	.byte	0x3
+	.long	0xc7f
+	.uleb128 0xb
+	.long	.LASF1708
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x11
+	.long	0x106
+	.uleb128 0x24
+	.long	.LASF1710
+	.long	0x66
+	.byte	0x18
+	.byte	0x34
+	.long	0xd85
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x1
+	.uleb128 0x32
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x18
+	.byte	0x43
+	.long	0xd9d
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1724
+	.byte	0x18
+	.byte	0x46
+	.byte	0x3
+	.long	0xd85
+	.uleb128 0x9
+	.long	.LASF1725
+	.byte	0x8
+	.byte	0x18
+	.byte	0x65
+	.long	0xdea
+	.uleb128 0x2
+	.long	.LASF1726
+	.byte	0x18
+	.byte	0x66
+	.byte	0xd
+	.long	0xd15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1727
+	.byte	0x18
+	.byte	0x67
+	.byte	0xd
+	.long	0xee
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1728
+	.byte	0x18
+	.byte	0x6d
+	.byte	0xd
+	.long	0xee
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1729
+	.byte	0x18
+	.byte	0x6e
+	.byte	0xd
+	.long	0xee
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1730
+	.byte	0x18
+	.byte	0x6f
+	.byte	0x3
+	.long	0xda9
+	.uleb128 0x9
+	.long	.LASF1731
+	.byte	0x6
+	.byte	0x18
+	.byte	0x73
+	.long	0xe51
+	.uleb128 0x2
+	.long	.LASF1732
+	.byte	0x18
+	.byte	0x74
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1733
+	.byte	0x18
+	.byte	0x75
+	.byte	0xd
+	.long	0xee
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0x18
+	.byte	0x76
+	.byte	0xd
+	.long	0xee
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1735
+	.byte	0x18
+	.byte	0x77
+	.byte	0xd
+	.long	0xee
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1736
+	.byte	0x18
+	.byte	0x78
+	.byte	0xd
+	.long	0xee
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1737
+	.byte	0x18
+	.byte	0x79
+	.byte	0xd
+	.long	0xee
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1738
+	.byte	0x18
+	.byte	0x7a
+	.byte	0x3
+	.long	0xdf6
+	.uleb128 0xe
+	.long	0xcf
+	.long	0xe6d
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1739
+	.byte	0x18
+	.byte	0x7c
+	.byte	0x10
+	.long	0xe5d
+	.uleb128 0xe
+	.long	0xcf
+	.long	0xe89
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1740
+	.byte	0x19
+	.byte	0x16
+	.byte	0x10
+	.long	0xe79
+	.uleb128 0xb
+	.long	.LASF1741
+	.byte	0x19
+	.byte	0x17
+	.byte	0x10
+	.long	0xb03
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1a
+	.byte	0x1c
+	.long	0xec5
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1746
+	.byte	0x1a
+	.byte	0x21
+	.byte	0x3
+	.long	0xea1
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1a
+	.byte	0x23
+	.long	0xee9
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1749
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x3
+	.long	0xed1
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1a
+	.byte	0x28
+	.long	0xf0d
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0x3
+	.long	0xef5
+	.uleb128 0x9
+	.long	.LASF1753
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x2c
+	.long	0xf8e
+	.uleb128 0x2
+	.long	.LASF1754
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x19
+	.long	0xec5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1755
+	.byte	0x1a
+	.byte	0x2e
+	.byte	0xd
+	.long	0xee
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x17
+	.long	0x288
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1757
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x8
+	.long	0x2e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0x1a
+	.byte	0x31
+	.byte	0xb
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x1a
+	.byte	0x32
+	.byte	0x1b
+	.long	0xee9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1760
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x11
+	.long	0xf0d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0x1a
+	.byte	0x34
+	.byte	0xe
+	.long	0xfa
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0x1a
+	.byte	0x35
+	.byte	0x3
+	.long	0xf19
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1b
+	.byte	0x15
+	.long	0xfb8
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1766
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x10
+	.long	0xee
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1b
+	.byte	0x21
+	.long	0x100e
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF1775
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF1776
+	.value	0x200
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1777
+	.byte	0x1b
+	.byte	0x2e
+	.byte	0x11
+	.long	0xfa
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1b
+	.byte	0x34
+	.long	0x1044
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1783
+	.byte	0x1b
+	.byte	0x40
+	.byte	0x10
+	.long	0xee
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x1c
+	.byte	0x14
+	.long	0x10f1
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x80
+	.uleb128 0x13
+	.long	.LASF1792
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF1793
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF1794
+	.value	0x400
+	.uleb128 0x13
+	.long	.LASF1795
+	.value	0x800
+	.uleb128 0x13
+	.long	.LASF1796
+	.value	0x1000
+	.uleb128 0x13
+	.long	.LASF1797
+	.value	0x2000
+	.uleb128 0x13
+	.long	.LASF1798
+	.value	0x4000
+	.uleb128 0x13
+	.long	.LASF1799
+	.value	0x8000
+	.uleb128 0x1a
+	.long	.LASF1800
+	.long	0x10000
+	.uleb128 0x1a
+	.long	.LASF1801
+	.long	0x20000
+	.uleb128 0x1a
+	.long	.LASF1802
+	.long	0x40000
+	.uleb128 0x1a
+	.long	.LASF1803
+	.long	0x80000
+	.uleb128 0x1a
+	.long	.LASF1804
+	.long	0x100000
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1805
+	.value	0x218
+	.byte	0x1d
+	.byte	0x14
+	.long	0x1234
+	.uleb128 0x2
+	.long	.LASF1806
+	.byte	0x1d
+	.byte	0x15
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1807
+	.byte	0x1d
+	.byte	0x17
+	.byte	0x12
+	.long	0x3ac
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1808
+	.byte	0x1d
+	.byte	0x19
+	.byte	0x19
+	.long	0xe51
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1809
+	.byte	0x1d
+	.byte	0x1b
+	.byte	0xd
+	.long	0xee
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1810
+	.byte	0x1d
+	.byte	0x1c
+	.byte	0xe
+	.long	0xfa
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1811
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0xd
+	.long	0xcf
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1812
+	.byte	0x1d
+	.byte	0x21
+	.byte	0x19
+	.long	0x491
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1813
+	.byte	0x1d
+	.byte	0x24
+	.byte	0xd
+	.long	0xee
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1814
+	.byte	0x1d
+	.byte	0x25
+	.byte	0xb
+	.long	0x2e
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1815
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x13
+	.long	0x644
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1816
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x17
+	.long	0x691
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1817
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xee
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1818
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0x1f
+	.long	0x1234
+	.byte	0x84
+	.uleb128 0x8
+	.long	.LASF1819
+	.byte	0x1d
+	.byte	0x30
+	.byte	0xd
+	.long	0xee
+	.value	0x1c4
+	.uleb128 0x8
+	.long	.LASF1820
+	.byte	0x1d
+	.byte	0x31
+	.byte	0xd
+	.long	0xee
+	.value	0x1c5
+	.uleb128 0x8
+	.long	.LASF1821
+	.byte	0x1d
+	.byte	0x32
+	.byte	0xd
+	.long	0xee
+	.value	0x1c6
+	.uleb128 0x8
+	.long	.LASF1822
+	.byte	0x1d
+	.byte	0x33
+	.byte	0xd
+	.long	0xee
+	.value	0x1c7
+	.uleb128 0x8
+	.long	.LASF1823
+	.byte	0x1d
+	.byte	0x35
+	.byte	0xe
+	.long	0xfa
+	.value	0x1c8
+	.uleb128 0x8
+	.long	.LASF1824
+	.byte	0x1d
+	.byte	0x36
+	.byte	0xd
+	.long	0xee
+	.value	0x1ca
+	.uleb128 0x8
+	.long	.LASF1825
+	.byte	0x1d
+	.byte	0x39
+	.byte	0x12
+	.long	0x1244
+	.value	0x1cc
+	.uleb128 0x8
+	.long	.LASF1826
+	.byte	0x1d
+	.byte	0x3c
+	.byte	0x16
+	.long	0x7eb
+	.value	0x20c
+	.uleb128 0x8
+	.long	.LASF1827
+	.byte	0x1d
+	.byte	0x3f
+	.byte	0x13
+	.long	0xa2a
+	.value	0x214
+	.uleb128 0x8
+	.long	.LASF1828
+	.byte	0x1d
+	.byte	0x42
+	.byte	0x14
+	.long	0xb2d
+	.value	0x216
+	.byte	0
+	.uleb128 0xe
+	.long	0xdea
+	.long	0x1244
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x27
+	.byte	0
+	.uleb128 0xe
+	.long	0xaf7
+	.long	0x1254
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1829
+	.byte	0x1d
+	.byte	0x47
+	.byte	0x3
+	.long	0x10f1
+	.uleb128 0x25
+	.long	.LASF1830
+	.value	0x7dc
+	.byte	0x1e
+	.byte	0x17
+	.long	0x1497
+	.uleb128 0x2
+	.long	.LASF1831
+	.byte	0x1e
+	.byte	0x18
+	.byte	0xd
+	.long	0xee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1832
+	.byte	0x1e
+	.byte	0x19
+	.byte	0xe
+	.long	0x106
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1833
+	.byte	0x1e
+	.byte	0x1a
+	.byte	0xe
+	.long	0xfa
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1834
+	.byte	0x1e
+	.byte	0x1b
+	.byte	0xd
+	.long	0xee
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1835
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0xd
+	.long	0xee
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1836
+	.byte	0x1e
+	.byte	0x1d
+	.byte	0xd
+	.long	0xee
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0x1e
+	.byte	0x1e
+	.byte	0xd
+	.long	0xee
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1838
+	.byte	0x1e
+	.byte	0x20
+	.byte	0x12
+	.long	0x1497
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1839
+	.byte	0x1e
+	.byte	0x23
+	.byte	0x19
+	.long	0x791
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF1840
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x16
+	.long	0xa77
+	.byte	0xd6
+	.uleb128 0x2
+	.long	.LASF1841
+	.byte	0x1e
+	.byte	0x26
+	.byte	0xe
+	.long	0xfa
+	.byte	0xde
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0x1e
+	.byte	0x27
+	.byte	0xe
+	.long	0xfa
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0x1e
+	.byte	0x28
+	.byte	0xe
+	.long	0xfa
+	.byte	0xe2
+	.uleb128 0x2
+	.long	.LASF1844
+	.byte	0x1e
+	.byte	0x2c
+	.byte	0x1d
+	.long	0x56d
+	.byte	0xe4
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0x1e
+	.byte	0x2d
+	.byte	0x16
+	.long	0x614
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF1846
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0xc
+	.long	0xc3
+	.byte	0xf6
+	.uleb128 0x2
+	.long	.LASF1847
+	.byte	0x1e
+	.byte	0x30
+	.byte	0xd
+	.long	0xee
+	.byte	0xf7
+	.uleb128 0x2
+	.long	.LASF1848
+	.byte	0x1e
+	.byte	0x31
+	.byte	0xe
+	.long	0xfa
+	.byte	0xf8
+	.uleb128 0x2
+	.long	.LASF1849
+	.byte	0x1e
+	.byte	0x32
+	.byte	0xe
+	.long	0xfa
+	.byte	0xfa
+	.uleb128 0x2
+	.long	.LASF1850
+	.byte	0x1e
+	.byte	0x33
+	.byte	0xe
+	.long	0xfa
+	.byte	0xfc
+	.uleb128 0x2
+	.long	.LASF1851
+	.byte	0x1e
+	.byte	0x34
+	.byte	0xd
+	.long	0xee
+	.byte	0xfe
+	.uleb128 0x8
+	.long	.LASF1852
+	.byte	0x1e
+	.byte	0x35
+	.byte	0xe
+	.long	0xfa
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF1853
+	.byte	0x1e
+	.byte	0x36
+	.byte	0xe
+	.long	0xfa
+	.value	0x102
+	.uleb128 0x8
+	.long	.LASF1854
+	.byte	0x1e
+	.byte	0x38
+	.byte	0x12
+	.long	0x6ea
+	.value	0x104
+	.uleb128 0x8
+	.long	.LASF1855
+	.byte	0x1e
+	.byte	0x3a
+	.byte	0xe
+	.long	0xfa
+	.value	0x10c
+	.uleb128 0x8
+	.long	.LASF1856
+	.byte	0x1e
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x425
+	.value	0x10e
+	.uleb128 0x8
+	.long	.LASF1857
+	.byte	0x1e
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x425
+	.value	0x114
+	.uleb128 0x8
+	.long	.LASF1858
+	.byte	0x1e
+	.byte	0x3d
+	.byte	0x14
+	.long	0x5d4
+	.value	0x11c
+	.uleb128 0x8
+	.long	.LASF1859
+	.byte	0x1e
+	.byte	0x3f
+	.byte	0x15
+	.long	0x751
+	.value	0x12c
+	.uleb128 0x8
+	.long	.LASF1860
+	.byte	0x1e
+	.byte	0x41
+	.byte	0x10
+	.long	0xc73
+	.value	0x136
+	.uleb128 0x8
+	.long	.LASF1861
+	.byte	0x1e
+	.byte	0x42
+	.byte	0x1a
+	.long	0x2b3
+	.value	0x148
+	.uleb128 0x8
+	.long	.LASF1862
+	.byte	0x1e
+	.byte	0x44
+	.byte	0xd
+	.long	0xee
+	.value	0x14c
+	.uleb128 0x8
+	.long	.LASF1863
+	.byte	0x1e
+	.byte	0x45
+	.byte	0xd
+	.long	0xee
+	.value	0x14d
+	.uleb128 0x8
+	.long	.LASF1864
+	.byte	0x1e
+	.byte	0x46
+	.byte	0xd
+	.long	0xee
+	.value	0x14e
+	.uleb128 0x8
+	.long	.LASF1865
+	.byte	0x1e
+	.byte	0x48
+	.byte	0x16
+	.long	0xa9d
+	.value	0x14f
+	.uleb128 0x8
+	.long	.LASF1866
+	.byte	0x1e
+	.byte	0x49
+	.byte	0xc
+	.long	0xc3
+	.value	0x150
+	.uleb128 0x8
+	.long	.LASF1867
+	.byte	0x1e
+	.byte	0x4f
+	.byte	0x14
+	.long	0xbe0
+	.value	0x154
+	.uleb128 0x8
+	.long	.LASF1868
+	.byte	0x1e
+	.byte	0x51
+	.byte	0x17
+	.long	0xf8e
+	.value	0x16c
+	.uleb128 0x8
+	.long	.LASF1869
+	.byte	0x1e
+	.byte	0x53
+	.byte	0xd
+	.long	0xee
+	.value	0x18c
+	.uleb128 0x8
+	.long	.LASF1870
+	.byte	0x1e
+	.byte	0x5a
+	.byte	0xf
+	.long	0x14a7
+	.value	0x190
+	.uleb128 0x8
+	.long	.LASF1871
+	.byte	0x1e
+	.byte	0x5b
+	.byte	0xd
+	.long	0xee
+	.value	0x7d8
+	.byte	0
+	.uleb128 0xe
+	.long	0x9f7
+	.long	0x14a7
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0xe
+	.long	0x1254
+	.long	0x14b7
+	.uleb128 0xf
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1830
+	.byte	0x1e
+	.byte	0x5c
+	.byte	0x3
+	.long	0x1260
+	.uleb128 0xb
+	.long	.LASF1872
+	.byte	0x1e
+	.byte	0x5e
+	.byte	0x11
+	.long	0x14b7
+	.uleb128 0xb
+	.long	.LASF1873
+	.byte	0x1e
+	.byte	0x5f
+	.byte	0x13
+	.long	0x14db
+	.uleb128 0x10
+	.long	0x1254
+	.uleb128 0xb
+	.long	.LASF1874
+	.byte	0x1f
+	.byte	0x26
+	.byte	0x10
+	.long	0xe5d
+	.uleb128 0xa
+	.long	0x66
+	.byte	0x20
+	.byte	0x28
+	.long	0x152e
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x8
+	.byte	0
+	.uleb128 0x33
+	.long	0x14e0
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	debug
+	.uleb128 0x19
+	.long	.LASF1884
+	.byte	0x5c
+	.byte	0xa
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentTime
+	.uleb128 0x19
+	.long	.LASF1885
+	.byte	0x5d
+	.byte	0xa
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	previousTime
+	.uleb128 0x19
+	.long	.LASF1886
+	.byte	0x5e
+	.byte	0xa
+	.long	0xfa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	cycleTime
+	.uleb128 0x19
+	.long	.LASF1887
+	.byte	0x5f
+	.byte	0xa
+	.long	0x106
+	.uleb128 0x9
+	.byte	0x3
+	.quad	targetPidLooptime
+	.uleb128 0x19
+	.long	.LASF1888
+	.byte	0x60
+	.byte	0x9
+	.long	0xcf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	headFreeModeHold
+	.uleb128 0x19
+	.long	.LASF1889
+	.byte	0x62
+	.byte	0x9
+	.long	0xcf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	telemTemperature1
+	.uleb128 0xb
+	.long	.LASF1890
+	.byte	0x1
+	.byte	0x64
+	.byte	0x10
+	.long	0x137
+	.uleb128 0xb
+	.long	.LASF1891
+	.byte	0x1
+	.byte	0x64
+	.byte	0x1a
+	.long	0x137
+	.uleb128 0xb
+	.long	.LASF1892
+	.byte	0x1
+	.byte	0x64
+	.byte	0x24
+	.long	0x137
+	.uleb128 0xb
+	.long	.LASF1893
+	.byte	0x1
+	.byte	0x65
+	.byte	0x14
+	.long	0x15ee
+	.uleb128 0x10
+	.long	0x910
+	.uleb128 0x3
+	.long	.LASF1894
+	.byte	0x1
+	.byte	0x67
+	.byte	0x10
+	.long	0x15ff
+	.uleb128 0x10
+	.long	0x1604
+	.uleb128 0x1c
+	.long	0x161e
+	.uleb128 0x4
+	.long	0x161e
+	.uleb128 0x4
+	.long	0x1623
+	.uleb128 0x4
+	.long	0xfa
+	.uleb128 0x4
+	.long	0x1628
+	.byte	0
+	.uleb128 0x10
+	.long	0x3ac
+	.uleb128 0x10
+	.long	0xe51
+	.uleb128 0x10
+	.long	0x491
+	.uleb128 0xb
+	.long	.LASF1895
+	.byte	0x1
+	.byte	0x69
+	.byte	0x1d
+	.long	0x15f3
+	.uleb128 0x1b
+	.long	.LASF1896
+	.value	0x153
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x9
+	.byte	0x3
+	.quad	AccInflightCalibrationArmed
+	.uleb128 0x1b
+	.long	.LASF1897
+	.value	0x154
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x9
+	.byte	0x3
+	.quad	AccInflightCalibrationMeasurementDone
+	.uleb128 0x1b
+	.long	.LASF1898
+	.value	0x155
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x9
+	.byte	0x3
+	.quad	AccInflightCalibrationSavetoEEProm
+	.uleb128 0x1b
+	.long	.LASF1899
+	.value	0x156
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x9
+	.byte	0x3
+	.quad	AccInflightCalibrationActive
+	.uleb128 0x1b
+	.long	.LASF1900
+	.value	0x157
+	.byte	0xa
+	.long	0xfa
+	.uleb128 0x9
+	.byte	0x3
+	.quad	InflightcalibratingA
+	.uleb128 0x26
+	.long	.LASF1963
+	.value	0x1f5
+	.byte	0xc
+	.long	0x294
+	.uleb128 0x9
+	.byte	0x3
+	.quad	haveProcessedAnnexCodeOnce
+	.uleb128 0xd
+	.long	.LASF1903
+	.byte	0x22
+	.byte	0x19
+	.uleb128 0xc
+	.long	.LASF1901
+	.byte	0x21
+	.byte	0x30
+	.long	0x16d5
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1905
+	.byte	0xf
+	.byte	0x30
+	.byte	0x5
+	.long	0x294
+	.uleb128 0xc
+	.long	.LASF1902
+	.byte	0xf
+	.byte	0x2f
+	.long	0x16f2
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1904
+	.byte	0x1c
+	.byte	0x3b
+	.uleb128 0x16
+	.long	.LASF1906
+	.byte	0x1c
+	.byte	0x3a
+	.byte	0x5
+	.long	0x294
+	.uleb128 0xd
+	.long	.LASF1907
+	.byte	0x16
+	.byte	0x9d
+	.uleb128 0xd
+	.long	.LASF1908
+	.byte	0x23
+	.byte	0x15
+	.uleb128 0x14
+	.long	.LASF1914
+	.byte	0x17
+	.byte	0x54
+	.byte	0x5
+	.long	0x294
+	.long	0x1729
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1909
+	.byte	0x17
+	.byte	0x53
+	.uleb128 0xc
+	.long	.LASF1910
+	.byte	0x22
+	.byte	0x18
+	.long	0x1741
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1911
+	.byte	0x14
+	.byte	0x6f
+	.uleb128 0xd
+	.long	.LASF1912
+	.byte	0x14
+	.byte	0x6e
+	.uleb128 0xd
+	.long	.LASF1913
+	.byte	0x14
+	.byte	0x6d
+	.uleb128 0x14
+	.long	.LASF1915
+	.byte	0x21
+	.byte	0x33
+	.byte	0x9
+	.long	0xcf
+	.long	0x176c
+	.uleb128 0x4
+	.long	0xee
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1916
+	.byte	0x23
+	.byte	0x14
+	.uleb128 0xc
+	.long	.LASF1917
+	.byte	0x7
+	.byte	0x32
+	.long	0x1784
+	.uleb128 0x4
+	.long	0x1d7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1918
+	.byte	0x21
+	.byte	0x31
+	.long	0x179a
+	.uleb128 0x4
+	.long	0x1628
+	.uleb128 0x4
+	.long	0xee
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1919
+	.byte	0x7
+	.byte	0x31
+	.long	0x17ab
+	.uleb128 0x4
+	.long	0x1d7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1920
+	.byte	0x10
+	.byte	0x2e
+	.uleb128 0xc
+	.long	.LASF1921
+	.byte	0x6
+	.byte	0x20
+	.long	0x17c3
+	.uleb128 0x4
+	.long	0x183
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1922
+	.byte	0x6
+	.byte	0x21
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x14
+	.long	.LASF1923
+	.byte	0x24
+	.byte	0x28
+	.byte	0x5
+	.long	0x294
+	.long	0x17e5
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1924
+	.byte	0x25
+	.byte	0x18
+	.byte	0xa
+	.long	0x106
+	.uleb128 0x16
+	.long	.LASF1925
+	.byte	0x24
+	.byte	0x24
+	.byte	0x5
+	.long	0x294
+	.uleb128 0xc
+	.long	.LASF1926
+	.byte	0x18
+	.byte	0x83
+	.long	0x180e
+	.uleb128 0x4
+	.long	0x180e
+	.byte	0
+	.uleb128 0x10
+	.long	0xdea
+	.uleb128 0xc
+	.long	.LASF1927
+	.byte	0x18
+	.byte	0x80
+	.long	0x1833
+	.uleb128 0x4
+	.long	0x1833
+	.uleb128 0x4
+	.long	0xd9d
+	.uleb128 0x4
+	.long	0x294
+	.uleb128 0x4
+	.long	0x294
+	.byte	0
+	.uleb128 0x10
+	.long	0xc73
+	.uleb128 0xd
+	.long	.LASF1928
+	.byte	0xb
+	.byte	0x8e
+	.uleb128 0xd
+	.long	.LASF1929
+	.byte	0xb
+	.byte	0x8d
+	.uleb128 0x14
+	.long	.LASF1930
+	.byte	0x18
+	.byte	0x7f
+	.byte	0x12
+	.long	0xd9d
+	.long	0x1861
+	.uleb128 0x4
+	.long	0x1833
+	.uleb128 0x4
+	.long	0xfa
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1931
+	.byte	0x17
+	.byte	0x5a
+	.long	0x1872
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1932
+	.byte	0x17
+	.byte	0x55
+	.long	0x1883
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1933
+	.byte	0x26
+	.byte	0x15
+	.long	0x1894
+	.uleb128 0x4
+	.long	0xee
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1934
+	.byte	0x27
+	.byte	0x14
+	.long	0x18af
+	.uleb128 0x4
+	.long	0xee
+	.uleb128 0x4
+	.long	0xee
+	.uleb128 0x4
+	.long	0xee
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1935
+	.byte	0x14
+	.byte	0x71
+	.uleb128 0xc
+	.long	.LASF1936
+	.byte	0x27
+	.byte	0x18
+	.long	0x18c7
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1937
+	.byte	0x27
+	.byte	0x16
+	.long	0x18d8
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1938
+	.byte	0x27
+	.byte	0x17
+	.uleb128 0xc
+	.long	.LASF1939
+	.byte	0x26
+	.byte	0x14
+	.long	0x18f0
+	.uleb128 0x4
+	.long	0x294
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1940
+	.byte	0x11
+	.byte	0x2f
+	.long	0x1901
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1941
+	.byte	0x11
+	.byte	0x2b
+	.byte	0x5
+	.long	0x294
+	.uleb128 0xd
+	.long	.LASF1942
+	.byte	0x11
+	.byte	0x2c
+	.uleb128 0x14
+	.long	.LASF1943
+	.byte	0x1c
+	.byte	0x2c
+	.byte	0x5
+	.long	0x294
+	.long	0x192a
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1944
+	.byte	0x28
+	.byte	0x41
+	.byte	0x7
+	.long	0x2e
+	.long	0x1940
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1945
+	.byte	0x28
+	.byte	0x42
+	.byte	0x7
+	.long	0x2e
+	.long	0x1956
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1946
+	.byte	0x28
+	.byte	0x34
+	.byte	0x7
+	.long	0x2e
+	.long	0x196c
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1947
+	.byte	0x28
+	.byte	0x2d
+	.byte	0x5
+	.long	0x43
+	.long	0x198c
+	.uleb128 0x4
+	.long	0x43
+	.uleb128 0x4
+	.long	0x43
+	.uleb128 0x4
+	.long	0x43
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1948
+	.byte	0x10
+	.byte	0x30
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x16
+	.long	.LASF1949
+	.byte	0xe
+	.byte	0x2c
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x16
+	.long	.LASF1950
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x5
+	.long	0x294
+	.uleb128 0x14
+	.long	.LASF1951
+	.byte	0x1b
+	.byte	0x43
+	.byte	0x5
+	.long	0x294
+	.long	0x19c6
+	.uleb128 0x4
+	.long	0x106
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1952
+	.byte	0x1c
+	.byte	0x3d
+	.uleb128 0x17
+	.long	.LASF1953
+	.value	0x2da
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a22
+	.uleb128 0x7
+	.quad	.LVL156
+	.long	0x179a
+	.long	0x1a01
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL157
+	.long	0x16bd
+	.uleb128 0x1d
+	.quad	.LVL158
+	.long	0x1773
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1954
+	.value	0x2ad
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a7e
+	.uleb128 0x7
+	.quad	.LVL152
+	.long	0x19b0
+	.long	0x1a56
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL153
+	.long	0x16d5
+	.uleb128 0x6
+	.quad	.LVL154
+	.long	0x17e5
+	.uleb128 0x15
+	.quad	.LVL155
+	.long	0x16c4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1955
+	.value	0x29e
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ab6
+	.uleb128 0x6
+	.quad	.LVL150
+	.long	0x17e5
+	.uleb128 0x15
+	.quad	.LVL151
+	.long	0x16e1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1956
+	.value	0x287
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ae1
+	.uleb128 0x15
+	.quad	.LVL149
+	.long	0x16f2
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1959
+	.value	0x280
+	.long	0x294
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b24
+	.uleb128 0x1f
+	.long	.LASF1961
+	.value	0x280
+	.byte	0x22
+	.long	0x106
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x15
+	.quad	.LVL148
+	.long	0x16f9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1957
+	.value	0x279
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b79
+	.uleb128 0x7
+	.quad	.LVL144
+	.long	0x179a
+	.long	0x1b58
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL145
+	.long	0x1705
+	.uleb128 0x1d
+	.quad	.LVL146
+	.long	0x1773
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1958
+	.value	0x260
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1bd5
+	.uleb128 0x6
+	.quad	.LVL140
+	.long	0x17e5
+	.uleb128 0x6
+	.quad	.LVL141
+	.long	0x1ed5
+	.uleb128 0x7
+	.quad	.LVL142
+	.long	0x19b0
+	.long	0x1bc7
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL143
+	.long	0x170c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1960
+	.value	0x258
+	.long	0x294
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c32
+	.uleb128 0x1f
+	.long	.LASF1961
+	.value	0x258
+	.byte	0x20
+	.long	0x106
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x6
+	.quad	.LVL137
+	.long	0x1729
+	.uleb128 0x6
+	.quad	.LVL138
+	.long	0x17e5
+	.uleb128 0x15
+	.quad	.LVL139
+	.long	0x1713
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1962
+	.value	0x200
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e78
+	.uleb128 0x26
+	.long	.LASF1964
+	.value	0x202
+	.byte	0x14
+	.long	0xee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroSamplesSincePid.0
+	.uleb128 0x34
+	.long	0x238e
+	.quad	.LBI11
+	.byte	.LVU543
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.byte	0x1
+	.value	0x204
+	.byte	0x1e
+	.long	0x1cbd
+	.uleb128 0x7
+	.quad	.LVL130
+	.long	0x19b0
+	.long	0x1ca2
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL131
+	.long	0x19a4
+	.uleb128 0x6
+	.quad	.LVL132
+	.long	0x198c
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL108
+	.long	0x17c3
+	.uleb128 0x6
+	.quad	.LVL109
+	.long	0x17ab
+	.uleb128 0x7
+	.quad	.LVL110
+	.long	0x179a
+	.long	0x1cee
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL111
+	.long	0x1784
+	.uleb128 0x7
+	.quad	.LVL112
+	.long	0x1773
+	.long	0x1d12
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL113
+	.long	0x17e5
+	.uleb128 0x7
+	.quad	.LVL114
+	.long	0x179a
+	.long	0x1d36
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL115
+	.long	0x2147
+	.uleb128 0x7
+	.quad	.LVL116
+	.long	0x1773
+	.long	0x1d5a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL117
+	.long	0x19b0
+	.long	0x1d71
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL118
+	.long	0x179a
+	.long	0x1d88
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL120
+	.long	0x1773
+	.long	0x1d9f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL121
+	.long	0x179a
+	.long	0x1db6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL122
+	.long	0x174f
+	.uleb128 0x7
+	.quad	.LVL123
+	.long	0x1773
+	.long	0x1dda
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL124
+	.long	0x1748
+	.uleb128 0x7
+	.quad	.LVL125
+	.long	0x179a
+	.long	0x1dfe
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL126
+	.long	0x1741
+	.uleb128 0x7
+	.quad	.LVL127
+	.long	0x1773
+	.long	0x1e22
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL128
+	.long	0x1730
+	.uleb128 0x6
+	.quad	.LVL129
+	.long	0x176c
+	.uleb128 0x7
+	.quad	.LVL133
+	.long	0x17b2
+	.long	0x1e53
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x36
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL134
+	.long	0x19b0
+	.long	0x1e6a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL135
+	.long	0x1756
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1965
+	.value	0x1f8
+	.long	0x294
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ed5
+	.uleb128 0x1f
+	.long	.LASF1961
+	.value	0x1f8
+	.byte	0x23
+	.long	0x106
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x6
+	.quad	.LVL102
+	.long	0x17f1
+	.uleb128 0x6
+	.quad	.LVL105
+	.long	0x17e5
+	.uleb128 0x15
+	.quad	.LVL107
+	.long	0x17cf
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1966
+	.value	0x188
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2054
+	.uleb128 0x28
+	.long	.LASF1967
+	.value	0x19d
+	.byte	0x16
+	.long	0xd9d
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x28
+	.long	.LASF1968
+	.value	0x1ac
+	.byte	0x9
+	.long	0x294
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x35
+	.long	0x213d
+	.quad	.LBI7
+	.byte	.LVU449
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.byte	0x1
+	.value	0x18f
+	.byte	0xd
+	.uleb128 0x6
+	.quad	.LVL70
+	.long	0x1872
+	.uleb128 0x7
+	.quad	.LVL71
+	.long	0x1914
+	.long	0x1f62
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1000
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL72
+	.long	0x1861
+	.uleb128 0x7
+	.quad	.LVL73
+	.long	0x1914
+	.long	0x1f88
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL75
+	.long	0x1846
+	.long	0x1fa0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL78
+	.long	0x1813
+	.long	0x1fbe
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL79
+	.long	0x1914
+	.long	0x1fd5
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL80
+	.long	0x17fd
+	.uleb128 0x7
+	.quad	.LVL81
+	.long	0x1914
+	.long	0x1ffb
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL83
+	.long	0x19b0
+	.long	0x2012
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL88
+	.long	0x183f
+	.uleb128 0x6
+	.quad	.LVL95
+	.long	0x208d
+	.uleb128 0x6
+	.quad	.LVL97
+	.long	0x183f
+	.uleb128 0x6
+	.quad	.LVL98
+	.long	0x1838
+	.uleb128 0x6
+	.quad	.LVL100
+	.long	0x183f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1969
+	.value	0x179
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x208d
+	.uleb128 0x36
+	.long	.LLRL10
+	.uleb128 0x37
+	.string	"dif"
+	.byte	0x1
+	.value	0x17c
+	.byte	0x11
+	.long	0xcf
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1989
+	.byte	0x1
+	.value	0x169
+	.byte	0x6
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x17
+	.long	.LASF1970
+	.value	0x159
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x20f0
+	.uleb128 0x29
+	.quad	.LVL63
+	.long	0x1883
+	.long	0x20dc
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL64
+	.long	0x1883
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1971
+	.value	0x13f
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x213d
+	.uleb128 0x29
+	.quad	.LVL61
+	.long	0x1894
+	.long	0x212f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xff
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL62
+	.long	0x18af
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF1972
+	.byte	0x1
+	.value	0x139
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x2a
+	.long	.LASF1973
+	.byte	0xb1
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x238e
+	.uleb128 0x3a
+	.string	"tmp"
+	.byte	0x1
+	.byte	0xb3
+	.byte	0xd
+	.long	0xdb
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x18
+	.long	.LASF1974
+	.byte	0xb3
+	.byte	0x12
+	.long	0xdb
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.long	.LASF1975
+	.byte	0xb4
+	.byte	0xd
+	.long	0xdb
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x18
+	.long	.LASF1976
+	.byte	0xb4
+	.byte	0x13
+	.long	0xdb
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x18
+	.long	.LASF1977
+	.byte	0xb4
+	.byte	0x1a
+	.long	0xdb
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x20
+	.long	.LASF1978
+	.byte	0xb6
+	.long	0xee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	batteryWarningEnabled.1
+	.uleb128 0x20
+	.long	.LASF1979
+	.byte	0xb7
+	.long	0xee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vbatTimer.2
+	.uleb128 0x20
+	.long	.LASF1980
+	.byte	0xb8
+	.long	0xdb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vbatCycleTime.3
+	.uleb128 0x3b
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x22a2
+	.uleb128 0x18
+	.long	.LASF1981
+	.byte	0xef
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x18
+	.long	.LASF1982
+	.byte	0xf0
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x18
+	.long	.LASF1983
+	.byte	0xf1
+	.byte	0xf
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x18
+	.long	.LASF1984
+	.byte	0xf2
+	.byte	0x11
+	.long	0xcf
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x6
+	.quad	.LVL46
+	.long	0x1956
+	.uleb128 0x7
+	.quad	.LVL47
+	.long	0x1940
+	.long	0x2289
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -68
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL50
+	.long	0x192a
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x6
+	.byte	0x91
+	.sleb128 -68
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL16
+	.long	0x196c
+	.long	0x22c1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x7d0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL23
+	.long	0x1914
+	.long	0x22da
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x802
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL24
+	.long	0x18df
+	.uleb128 0x6
+	.quad	.LVL25
+	.long	0x239b
+	.uleb128 0x6
+	.quad	.LVL26
+	.long	0x18d8
+	.uleb128 0x6
+	.quad	.LVL27
+	.long	0x18b6
+	.uleb128 0x3c
+	.quad	.LVL29
+	.long	0x2329
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	telemTemperature1
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL37
+	.long	0x18c7
+	.uleb128 0x7
+	.quad	.LVL56
+	.long	0x1914
+	.long	0x234d
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL57
+	.long	0x1914
+	.long	0x2366
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x800
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL58
+	.long	0x190d
+	.uleb128 0x6
+	.quad	.LVL59
+	.long	0x1901
+	.uleb128 0x6
+	.quad	.LVL60
+	.long	0x18f0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF1990
+	.byte	0x1
+	.byte	0xa6
+	.byte	0xc
+	.long	0x294
+	.byte	0x1
+	.uleb128 0x3e
+	.long	.LASF1985
+	.byte	0x1
+	.byte	0x99
+	.byte	0x5
+	.long	0x294
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x240f
+	.uleb128 0x7
+	.quad	.LVL2
+	.long	0x19b0
+	.long	0x23d4
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL3
+	.long	0x19a4
+	.uleb128 0x6
+	.quad	.LVL4
+	.long	0x1998
+	.uleb128 0x6
+	.quad	.LVL5
+	.long	0x198c
+	.uleb128 0x2b
+	.quad	.LVL6
+	.long	0x19b0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1986
+	.byte	0x6b
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x244d
+	.uleb128 0x3f
+	.long	.LASF1987
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x3f
+	.long	0x1628
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x15
+	.quad	.LVL1
+	.long	0x19c6
+	.byte	0
+	.uleb128 0x40
+	.long	0x213d
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU594
+	.uleb128 .LVU594
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL147
+	.byte	0x4
+	.uleb128 .LVL147-.LVL147
+	.uleb128 .LVL148-1-.LVL147
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL148-1-.LVL147
+	.uleb128 .LFE26-.LVL147
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU563
+	.uleb128 .LVU563
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL136
+	.byte	0x4
+	.uleb128 .LVL136-.LVL136
+	.uleb128 .LVL137-1-.LVL136
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-1-.LVL136
+	.uleb128 .LFE23-.LVL136
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU481
+	.uleb128 .LVU481
+	.uleb128 .LVU484
+	.uleb128 .LVU484
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL101
+	.byte	0x4
+	.uleb128 .LVL101-.LVL101
+	.uleb128 .LVL102-1-.LVL101
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL102-1-.LVL101
+	.uleb128 .LVL103-.LVL101
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL103-.LVL101
+	.uleb128 .LVL104-.LVL101
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.LVL101
+	.uleb128 .LVL106-.LVL101
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL106-.LVL101
+	.uleb128 .LFE21-.LVL101
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU393
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU429
+	.uleb128 .LVU430
+	.uleb128 .LVU447
+	.uleb128 .LVU460
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-.LVL76
+	.uleb128 .LVL86-.LVL76
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL87-.LVL76
+	.uleb128 .LVL90-.LVL76
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL94-.LVL76
+	.uleb128 .LVL96-.LVL76
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL96-.LVL76
+	.uleb128 .LVL97-1-.LVL76
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL97-1-.LVL76
+	.uleb128 .LFE20-.LVL76
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU403
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU418
+	.uleb128 .LVU430
+	.uleb128 .LVU444
+	.uleb128 .LVU463
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL84-.LVL80
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.LVL80
+	.uleb128 .LVL85-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.LVL80
+	.uleb128 .LVL89-.LVL80
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.LVL80
+	.uleb128 .LFE20-.LVL80
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU351
+	.uleb128 .LVU355
+.LLST11:
+	.byte	0x8
+	.quad	.LVL65
+	.uleb128 .LVL67-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU57
+	.uleb128 .LVU64
+	.uleb128 .LVU109
+	.uleb128 .LVU114
+	.uleb128 .LVU118
+	.uleb128 .LVU130
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU191
+	.uleb128 .LVU193
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU228
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU232
+.LLST1:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x1f4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL9
+	.uleb128 .LVL17-.LVL9
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL18-.LVL9
+	.uleb128 .LVL22-.LVL9
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL30-.LVL9
+	.uleb128 .LVL31-.LVL9
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x19
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL9
+	.uleb128 .LVL32-.LVL9
+	.uleb128 0x7
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.LVL9
+	.uleb128 .LVL34-.LVL9
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.LVL9
+	.uleb128 .LVL35-.LVL9
+	.uleb128 0x7
+	.byte	0x79
+	.sleb128 0
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL9
+	.uleb128 .LVL36-.LVL9
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.LVL9
+	.uleb128 .LVL44-.LVL9
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL44-.LVL9
+	.uleb128 .LVL45-.LVL9
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU120
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU130
+.LLST2:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL20-.LVL19
+	.uleb128 .LVL21-.LVL19
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL19
+	.uleb128 .LVL22-.LVL19
+	.uleb128 0x17
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xc
+	.long	0x51eb851f
+	.byte	0x1e
+	.byte	0x8
+	.byte	0x25
+	.byte	0x26
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4f
+	.byte	0x26
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU48
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU179
+	.uleb128 .LVU199
+	.uleb128 .LVU206
+	.uleb128 .LVU232
+.LLST3:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL8-.LVL7
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL7
+	.uleb128 .LVL14-.LVL7
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL14-.LVL7
+	.uleb128 .LVL15-.LVL7
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL7
+	.uleb128 .LVL36-.LVL7
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL40-.LVL7
+	.uleb128 .LVL45-.LVL7
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU83
+	.uleb128 .LVU97
+	.uleb128 .LVU221
+	.uleb128 .LVU222
+.LLST4:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.LVL12
+	.uleb128 .LVL42-.LVL12
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU47
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU260
+	.uleb128 .LVU261
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL28-.LVL7
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL29-.LVL7
+	.uleb128 .LVL38-.LVL7
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL39-.LVL7
+	.uleb128 .LVL54-.LVL7
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL55-.LVL7
+	.uleb128 .LFE14-.LVL7
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU235
+	.uleb128 .LVU237
+	.uleb128 .LVU237
+	.uleb128 .LVU258
+.LLST6:
+	.byte	0x6
+	.quad	.LVL46
+	.byte	0x4
+	.uleb128 .LVL46-.LVL46
+	.uleb128 .LVL47-1-.LVL46
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL47-1-.LVL46
+	.uleb128 .LVL53-.LVL46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU258
+.LLST7:
+	.byte	0x6
+	.quad	.LVL48
+	.byte	0x4
+	.uleb128 .LVL48-.LVL48
+	.uleb128 .LVL49-.LVL48
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL49-.LVL48
+	.uleb128 .LVL53-.LVL48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU242
+	.uleb128 .LVU258
+.LLST8:
+	.byte	0x8
+	.quad	.LVL50
+	.uleb128 .LVL53-.LVL50
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU248
+	.uleb128 .LVU251
+.LLST9:
+	.byte	0x8
+	.quad	.LVL51
+	.uleb128 .LVL52-.LVL51
+	.uleb128 0x14
+	.byte	0xa5
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0xa5
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.LVL0
+	.uleb128 .LFE11-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x14c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x5
+	.quad	.LBB5
+	.byte	0x4
+	.uleb128 .LBB5-.LBB5
+	.uleb128 .LBE5-.LBB5
+	.byte	0x4
+	.uleb128 .LBB6-.LBB5
+	.uleb128 .LBE6-.LBB5
+	.byte	0
+.LLRL17:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 41 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 43 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 45 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 46 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 49 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 51 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x33
+	.file 52 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 53 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF606
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF642
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF670
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF671
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF745
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF747
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF749
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF750
+	.file 65 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF751
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF781
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF790
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF807
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF808
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF809
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF821
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF828
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF829
+	.byte	0x4
+	.byte	0x4
+	.file 82 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF833
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x4
+	.file 85 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.file 86 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF838
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF901
+	.byte	0x4
+	.file 88 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x59
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1179
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 96 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.file 97 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 98 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 99 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1309
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x4
+	.file 100 ".//src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 101 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.file 102 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1328
+	.byte	0x4
+	.byte	0x4
+	.file 103 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1329
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0x4
+	.file 104 ".//src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x68
+	.byte	0x4
+	.file 105 ".//src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1339
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1340
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x26
+	.byte	0x4
+	.file 106 ".//src/main/io/display.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1344
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x21
+	.byte	0x4
+	.file 107 ".//src/main/flight/autotune.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 108 ".//src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x6c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x15
+	.byte	0x4
+	.file 109 ".//src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 110 ".//src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 111 ".//src/main/io/serial_cli.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1369
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 112 ".//src/main/rx/msp.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1413
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1425
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1436
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF565
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF602
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF604
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF605
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF615
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF634
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF641
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF663
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF669
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF686
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF728
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF744
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF605
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF755
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF759
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF767
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF780
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF785
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF788
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF791
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF802
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF806
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF820
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF832
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF837
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1178
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1181
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1183
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1208
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1211
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1223
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1233
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1272
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1282
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1301
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1308
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1314
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.profiling.h.34.071b1e95f4ebee26ff29bf11a1e6ac52,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1317
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.light_led.h.31.b89a67316a7f14886dd5be52d67e7dfa,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1323
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1327
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1333
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1338
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.battery.h.20.f5fac9d1aa9fbbdfd4a60367a274e38f,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1343
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.mixer.h.20.12f41fd3a0267c5fc91fbc71196be1fb,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1347
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gps.h.20.02d215f7ed968ac4ec18ad72a869b32f,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1354
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.ledstrip.h.20.b5928f44975fa5758ee1f27924410c86,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1368
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1372
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_controls.h.49.c657927ffd6d571e1dc7c545656f57ed,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1410
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rc_curves.h.20.bb55f38eb1f046d20ce020bb2f322596,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.blackbox.h.20.937bb5fa7fb44cc76a986a0c90da47bd,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1415
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1424
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1433
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.scheduler.h.115.938f6c2ded084b2afd5b0b59fa60d513,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1435
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1585:
+	.string	"escAndServoConfig_s"
+.LASF1589:
+	.string	"escAndServoConfig_t"
+.LASF1960:
+	.string	"taskUpdateRxCheck"
+.LASF1364:
+	.string	"LED_DIRECTION_BIT_OFFSET 0"
+.LASF664:
+	.string	"__ldiv_t_defined 1"
+.LASF1406:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1313:
+	.string	"HSV_VALUE_MAX 255"
+.LASF935:
+	.string	"__DECL_SIMD_logf "
+.LASF1044:
+	.string	"__DECL_SIMD_sinh "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1941:
+	.string	"shouldSoundBatteryAlarm"
+.LASF1140:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1168:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1371:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF1626:
+	.string	"MULTITYPE_OCTOFLATP"
+.LASF1329:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF1462:
+	.string	"RGB_GREEN"
+.LASF1627:
+	.string	"MULTITYPE_OCTOFLATX"
+.LASF1500:
+	.string	"PIDPITCH"
+.LASF594:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1345:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1873:
+	.string	"currentProfile"
+.LASF759:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1606:
+	.string	"isEnabled"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF972:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1368:
+	.string	"CONFIGURABLE_COLOR_COUNT 16"
+.LASF678:
+	.string	"__SQUAD_TYPE long int"
+.LASF1784:
+	.string	"FEATURE_RX_PPM"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF753:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1672:
+	.string	"gps_passthrough_baudrate"
+.LASF1358:
+	.string	"LED_XY_MASK (0x0F)"
+.LASF1244:
+	.string	"FP_NORMAL 4"
+.LASF1108:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1088:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF945:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF740:
+	.string	"__pid_t_defined "
+.LASF752:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1474:
+	.string	"PROFILE_STAGE_ANNEX"
+.LASF1048:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1164:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF612:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1587:
+	.string	"maxthrottle"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1447:
+	.string	"__uint8_t"
+.LASF835:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1974:
+	.string	"tmp2"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1610:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1426:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1495:
+	.string	"_Bool"
+.LASF1070:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF903:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1521:
+	.string	"flightDynamicsTrims_t"
+.LASF1282:
+	.string	"U_ID_2 0"
+.LASF1512:
+	.string	"A_level"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1184:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF798:
+	.string	"NFDBITS __NFDBITS"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF736:
+	.string	"__mode_t_defined "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1092:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1840:
+	.string	"flight3DConfig"
+.LASF1499:
+	.string	"PIDROLL"
+.LASF1409:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1593:
+	.string	"failsafe_throttle"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1638:
+	.string	"motorMixer_t"
+.LASF1492:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1540:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1962:
+	.string	"taskMainPidLoop"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1863:
+	.string	"disarm_kill_switch"
+.LASF1365:
+	.string	"LED_DIRECTION_MASK 0x3F"
+.LASF1245:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1542:
+	.string	"CW270_DEG_FLIP"
+.LASF1468:
+	.string	"BOOT_STAGE_OUTPUTS"
+.LASF1490:
+	.string	"samplePeriod"
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF949:
+	.string	"__DECL_SIMD_expf64 "
+.LASF586:
+	.string	"__WCHAR_T__ "
+.LASF606:
+	.string	"_STDLIB_H 1"
+.LASF1648:
+	.string	"deadband3d_throttle"
+.LASF1560:
+	.string	"yawDegrees"
+.LASF1922:
+	.string	"isBootComplete"
+.LASF1115:
+	.string	"__DECL_SIMD_acoshf "
+.LASF920:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1506:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1487:
+	.string	"read"
+.LASF1046:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1248:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1779:
+	.string	"GPS_FIX"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1794:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1249:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1463:
+	.string	"RGB_BLUE"
+.LASF1458:
+	.string	"uint16_t"
+.LASF656:
+	.string	"__f32(x) x ##f32"
+.LASF764:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF728:
+	.string	"__FD_SETSIZE 1024"
+.LASF686:
+	.string	"__STD_TYPE typedef"
+.LASF1653:
+	.string	"middle"
+.LASF1812:
+	.string	"accelerometerTrims"
+.LASF1635:
+	.string	"MULTITYPE_SINGLECOPTER"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1864:
+	.string	"small_angle"
+.LASF1889:
+	.string	"telemTemperature1"
+.LASF1497:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF1066:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1611:
+	.string	"counter"
+.LASF902:
+	.string	"_MATH_H 1"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1225:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF738:
+	.string	"__uid_t_defined "
+.LASF1915:
+	.string	"calculateThrottleAngleCorrection"
+.LASF868:
+	.string	"INT_FAST8_MAX (127)"
+.LASF675:
+	.string	"__U32_TYPE unsigned int"
+.LASF916:
+	.string	"__DECL_SIMD_sinl "
+.LASF1303:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1744:
+	.string	"TELEMETRY_PROVIDER_MSP"
+.LASF1326:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF1169:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1820:
+	.string	"yaw_deadband"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF974:
+	.string	"__DECL_SIMD_atan "
+.LASF1155:
+	.string	"__DECL_SIMD_erfcf "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1909:
+	.string	"updateRx"
+.LASF624:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF737:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1780:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF585:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1738:
+	.string	"controlRateConfig_t"
+.LASF937:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1981:
+	.string	"radDiff"
+.LASF1854:
+	.string	"gyroConfig"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1885:
+	.string	"previousTime"
+.LASF895:
+	.string	"UINT8_C(c) c"
+.LASF1705:
+	.string	"BOXSONAR"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1865:
+	.string	"airplaneConfig"
+.LASF1352:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1508:
+	.string	"PIDVEL"
+.LASF659:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1340:
+	.string	"GYRO_SYNC_TIMEOUT_PERIODS 4"
+.LASF993:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1884:
+	.string	"currentTime"
+.LASF1470:
+	.string	"BOOT_STAGE_CALIBRATION"
+.LASF655:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF936:
+	.string	"__DECL_SIMD_logl "
+.LASF1305:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF724:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1958:
+	.string	"taskUpdateRxMain"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF577:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1335:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF944:
+	.string	"__DECL_SIMD_exp "
+.LASF1667:
+	.string	"serialConfig_s"
+.LASF1154:
+	.string	"__DECL_SIMD_erfc "
+.LASF1911:
+	.string	"writeMotors"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF781:
+	.string	"_SYS_SELECT_H 1"
+.LASF1455:
+	.string	"int32_t"
+.LASF637:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF793:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1375:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1301:
+	.string	"FAST_MATH "
+.LASF1292:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1323:
+	.string	"LED1_ON "
+.LASF1128:
+	.string	"__DECL_SIMD_erff32 "
+.LASF596:
+	.string	"___int_wchar_t_h "
+.LASF1126:
+	.string	"__DECL_SIMD_erfl "
+.LASF946:
+	.string	"__DECL_SIMD_expl "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF1836:
+	.string	"pid_process_denom"
+.LASF1442:
+	.string	"unsigned char"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF766:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1294:
+	.string	"USE_USART1 "
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF508:
+	.string	"__always_inline"
+.LASF1010:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF643:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1298:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1256:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1385:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1520:
+	.string	"values"
+.LASF842:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF810:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1688:
+	.string	"BOXMAG"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1200:
+	.string	"__MATH_PRECNAME"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF836:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1230:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1982:
+	.string	"cosDiff"
+.LASF1360:
+	.string	"GET_LED_Y(ledConfig) ((ledConfig->xy >> LED_Y_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1940:
+	.string	"updateCurrentMeter"
+.LASF1887:
+	.string	"targetPidLooptime"
+.LASF1232:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1203:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1555:
+	.string	"baroGroundPressure"
+.LASF864:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1460:
+	.string	"double"
+.LASF705:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1187:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF768:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF570:
+	.string	"_T_SIZE_ "
+.LASF1193:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1841:
+	.string	"motor_pwm_rate"
+.LASF777:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1637:
+	.string	"MULTITYPE_LAST"
+.LASF1792:
+	.string	"FEATURE_FAILSAFE"
+.LASF1619:
+	.string	"MULTITYPE_GIMBAL"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1317:
+	.string	"PROFILE_STAGE_END(stage) profileStageEnd(stage)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1221:
+	.string	"__MATHDECL_1"
+.LASF1147:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1417:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1004:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1507:
+	.string	"PIDMAG"
+.LASF1683:
+	.string	"rxConfig_t"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1295:
+	.string	"USE_USART2 "
+.LASF1952:
+	.string	"saveConfigAndNotify"
+.LASF392:
+	.string	"false 0"
+.LASF1125:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF608:
+	.string	"WUNTRACED 2"
+.LASF1639:
+	.string	"throttle"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1663:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF581:
+	.string	"_GCC_SIZE_T "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF647:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1554:
+	.string	"gyroZero"
+.LASF1686:
+	.string	"BOXHORIZON"
+.LASF1068:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1767:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF548:
+	.string	"__stub_stty "
+.LASF1351:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1837:
+	.string	"emf_avoidance"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1038:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1539:
+	.string	"CW0_DEG_FLIP"
+.LASF992:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1682:
+	.string	"rssi_channel"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF893:
+	.string	"INT32_C(c) c"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1514:
+	.string	"dterm_lpf_hz"
+.LASF1592:
+	.string	"failsafe_off_delay"
+.LASF1737:
+	.string	"yawRate"
+.LASF1195:
+	.string	"_Mdouble_ double"
+.LASF620:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1862:
+	.string	"retarded_arm"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1797:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1529:
+	.string	"SENSOR_BARO"
+.LASF1502:
+	.string	"PIDALT"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1699:
+	.string	"BOXLLIGHTS"
+.LASF639:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF578:
+	.string	"_SIZE_T_DECLARED "
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF841:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1802:
+	.string	"FEATURE_BLACKBOX"
+.LASF1687:
+	.string	"BOXBARO"
+.LASF1813:
+	.string	"acc_lpf_hz"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1785:
+	.string	"FEATURE_VBAT"
+.LASF1647:
+	.string	"neutral3d"
+.LASF1903:
+	.string	"handleBlackbox"
+.LASF1702:
+	.string	"BOXOSD"
+.LASF1504:
+	.string	"PIDPOSR"
+.LASF1285:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1616:
+	.string	"MULTITYPE_QUADP"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF763:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF587:
+	.string	"_WCHAR_T "
+.LASF1366:
+	.string	"LED_FUNCTION_BIT_OFFSET 6"
+.LASF1867:
+	.string	"serialConfig"
+.LASF1617:
+	.string	"MULTITYPE_QUADX"
+.LASF1105:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1615:
+	.string	"MULTITYPE_TRI"
+.LASF1190:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1050:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF963:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF756:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1793:
+	.string	"FEATURE_SONAR"
+.LASF1948:
+	.string	"isGyroCalibrationComplete"
+.LASF831:
+	.string	"alloca"
+.LASF701:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF669:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1535:
+	.string	"CW0_DEG"
+.LASF789:
+	.string	"__timeval_defined 1"
+.LASF1517:
+	.string	"roll"
+.LASF1913:
+	.string	"mixTable"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1599:
+	.string	"shouldForceLanding"
+.LASF1972:
+	.string	"mwDisarm"
+.LASF1601:
+	.string	"shouldHaveCausedLandingByNow"
+.LASF873:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1336:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1519:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1448:
+	.string	"__int16_t"
+.LASF890:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1449:
+	.string	"__uint16_t"
+.LASF662:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1402:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1030:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1293:
+	.string	"USE_BARO_SITL "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1666:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF597:
+	.string	"__INT_WCHAR_T_H "
+.LASF735:
+	.string	"__gid_t_defined "
+.LASF1538:
+	.string	"CW270_DEG"
+.LASF1848:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1757:
+	.string	"gpsNoFixLatitude"
+.LASF977:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF782:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF583:
+	.string	"__size_t "
+.LASF871:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1938:
+	.string	"disableWarningLed"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF776:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1127:
+	.string	"__DECL_SIMD_erff16 "
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1671:
+	.string	"gps_baudrate"
+.LASF633:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1749:
+	.string	"frskyGpsCoordFormat_e"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1722:
+	.string	"THROTTLE_LOW"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF960:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1607:
+	.string	"enable"
+.LASF1811:
+	.string	"mag_declination"
+.LASF1532:
+	.string	"SENSOR_GPS"
+.LASF658:
+	.string	"__f32x(x) x ##f32x"
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1220:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1477:
+	.string	"PROFILE_STAGE_MOTORS"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1918:
+	.string	"computeIMU"
+.LASF1057:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1413:
+	.string	"TELEMETRY_COMMON_H_ "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1234:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF855:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF574:
+	.string	"_BSD_SIZE_T_ "
+.LASF1768:
+	.string	"HORIZON_MODE"
+.LASF1489:
+	.string	"scale"
+.LASF838:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1831:
+	.string	"mixerConfiguration"
+.LASF961:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1788:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1787:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1989:
+	.string	"updateInflightCalibrationState"
+.LASF1277:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF869:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1816:
+	.string	"barometerConfig"
+.LASF1856:
+	.string	"accZero"
+.LASF1407:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1957:
+	.string	"taskHandleSerial"
+.LASF1389:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << modeId) & rcModeActivationMask)"
+.LASF996:
+	.string	"__DECL_SIMD_hypotl "
+.LASF689:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1451:
+	.string	"__uint32_t"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1545:
+	.string	"gyro_align"
+.LASF1928:
+	.string	"resetErrorGyro"
+.LASF1437:
+	.string	"float"
+.LASF1318:
+	.string	"LED0_TOGGLE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1579:
+	.string	"vbatmaxcellvoltage"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF1684:
+	.string	"BOXARM"
+.LASF373:
+	.string	"linux 1"
+.LASF892:
+	.string	"INT16_C(c) c"
+.LASF1223:
+	.string	"__MATHDECL"
+.LASF1288:
+	.string	"GYRO "
+.LASF1680:
+	.string	"mincheck"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1806:
+	.string	"pidController"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1333:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1276:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF749:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF987:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1933:
+	.string	"queueConfirmationBeep"
+.LASF1700:
+	.string	"BOXCALIB"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1320:
+	.string	"LED0_ON "
+.LASF761:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF1354:
+	.string	"GPS_MESSAGE_STATE_ENTRY_COUNT (GPS_MESSAGE_STATE_MAX + 1)"
+.LASF1790:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1659:
+	.string	"FUNCTION_NONE"
+.LASF1262:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1652:
+	.string	"servoParam_t"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1819:
+	.string	"deadband"
+.LASF1534:
+	.string	"ALIGN_DEFAULT"
+.LASF1331:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1696:
+	.string	"BOXBEEPERON"
+.LASF779:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF860:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF507:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1714:
+	.string	"AUX1"
+.LASF1715:
+	.string	"AUX2"
+.LASF622:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1717:
+	.string	"AUX4"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1486:
+	.string	"init"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1721:
+	.string	"AUX8"
+.LASF984:
+	.string	"__DECL_SIMD_asin "
+.LASF1681:
+	.string	"maxcheck"
+.LASF745:
+	.string	"__clock_t_defined 1"
+.LASF1729:
+	.string	"rangeEndStep"
+.LASF1711:
+	.string	"ROLL"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF593:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF697:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1839:
+	.string	"escAndServoConfig"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1381:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1801:
+	.string	"FEATURE_DISPLAY"
+.LASF1496:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF999:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1950:
+	.string	"isBaroCalibrationComplete"
+.LASF1405:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1657:
+	.string	"gimbal_flags"
+.LASF792:
+	.string	"__NFDBITS"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF839:
+	.string	"__intptr_t_defined "
+.LASF847:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF858:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1025:
+	.string	"__DECL_SIMD_coshf "
+.LASF1034:
+	.string	"__DECL_SIMD_expm1 "
+.LASF625:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1106:
+	.string	"__DECL_SIMD_atanhl "
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF376:
+	.string	"unix 1"
+.LASF1379:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1098:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1808:
+	.string	"controlRateConfig"
+.LASF679:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1242:
+	.string	"FP_ZERO 2"
+.LASF1157:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1484:
+	.string	"sensorInitFuncPtr"
+.LASF1316:
+	.string	"PROFILE_STAGE_BEGIN(stage) profileStageBegin(stage)"
+.LASF748:
+	.string	"__timer_t_defined 1"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1314:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF875:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1707:
+	.string	"boxId_e"
+.LASF648:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF595:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1197:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1810:
+	.string	"tpa_breakpoint"
+.LASF1892:
+	.string	"dynD8"
+.LASF1828:
+	.string	"gimbalConfig"
+.LASF787:
+	.string	"____sigset_t_defined "
+.LASF1283:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF751:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1467:
+	.string	"BOOT_STAGE_SIGNAL"
+.LASF913:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF897:
+	.string	"UINT32_C(c) c ## U"
+.LASF1076:
+	.string	"__DECL_SIMD_log10l "
+.LASF1874:
+	.string	"debug"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF851:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1753:
+	.string	"telemetryConfig_s"
+.LASF1762:
+	.string	"telemetryConfig_t"
+.LASF953:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1392:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1501:
+	.string	"PIDYAW"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF650:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF894:
+	.string	"INT64_C(c) c ## L"
+.LASF904:
+	.string	"__DECL_SIMD_cos "
+.LASF1978:
+	.string	"batteryWarningEnabled"
+.LASF1600:
+	.string	"hasTimerElapsed"
+.LASF1251:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF833:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF685:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF729:
+	.string	"_BITS_TIME64_H 1"
+.LASF820:
+	.string	"__ONCE_ALIGNMENT "
+.LASF870:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1386:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF709:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF985:
+	.string	"__DECL_SIMD_asinf "
+.LASF616:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1871:
+	.string	"current_profile_index"
+.LASF1359:
+	.string	"GET_LED_X(ledConfig) ((ledConfig->xy >> LED_X_BIT_OFFSET) & LED_XY_MASK)"
+.LASF1842:
+	.string	"dshot_rate"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF803:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF750:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1553:
+	.string	"calibrated"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1676:
+	.string	"rxConfig_s"
+.LASF1770:
+	.string	"BARO_MODE"
+.LASF673:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF773:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1465:
+	.string	"BOOT_STAGE_BUSES"
+.LASF1198:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1211:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1888:
+	.string	"headFreeModeHold"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF952:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF905:
+	.string	"__DECL_SIMD_cosf "
+.LASF1378:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1289:
+	.string	"USE_GYRO_SITL "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1776:
+	.string	"SONAR_MODE"
+.LASF645:
+	.string	"__HAVE_FLOAT64 1"
+.LASF580:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1264:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF575:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1261:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF762:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1769:
+	.string	"MAG_MODE"
+.LASF711:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1457:
+	.string	"uint8_t"
+.LASF1135:
+	.string	"__DECL_SIMD_tanhf "
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF1634:
+	.string	"MULTITYPE_DUALCOPTER"
+.LASF1750:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1372:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF1872:
+	.string	"masterConfig"
+.LASF677:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF821:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1572:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF970:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF1929:
+	.string	"resetErrorAngle"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF957:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1897:
+	.string	"AccInflightCalibrationMeasurementDone"
+.LASF1712:
+	.string	"PITCH"
+.LASF1291:
+	.string	"USE_ACC_SITL "
+.LASF1382:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1603:
+	.string	"updateState"
+.LASF734:
+	.string	"__dev_t_defined "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF598:
+	.string	"_GCC_WCHAR_T "
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1703:
+	.string	"BOXTELEMETRY"
+.LASF1896:
+	.string	"AccInflightCalibrationArmed"
+.LASF1031:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1167:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF690:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF627:
+	.string	"__WCOREFLAG 0x80"
+.LASF887:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1310:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF971:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1410:
+	.string	"IS_MODE_RANGE_USABLE(modeActivationCondition) (modeActivationCondition->rangeStartStep < modeActivationCondition->rangeEndStep)"
+.LASF1287:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF563:
+	.string	"__need_size_t "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1708:
+	.string	"rcModeActivationMask"
+.LASF1233:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1786:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF914:
+	.string	"__DECL_SIMD_sin "
+.LASF1954:
+	.string	"taskCalculateAltitude"
+.LASF1661:
+	.string	"FUNCTION_CLI"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF601:
+	.string	"_BSD_WCHAR_T_"
+.LASF1985:
+	.string	"isCalibrating"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1473:
+	.string	"PROFILE_STAGE_IMU"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF641:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1377:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF573:
+	.string	"_SIZE_T_ "
+.LASF1399:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1857:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF584:
+	.string	"__need_size_t"
+.LASF1384:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1906:
+	.string	"isEEPROMWritePending"
+.LASF765:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1891:
+	.string	"dynI8"
+.LASF988:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1176:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1346:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1026:
+	.string	"__DECL_SIMD_coshl "
+.LASF1427:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1975:
+	.string	"axis"
+.LASF1215:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1629:
+	.string	"MULTITYPE_HELI_120_CCPM"
+.LASF1927:
+	.string	"processRcStickPositions"
+.LASF1675:
+	.string	"rcData"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1953:
+	.string	"taskBlackbox"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1636:
+	.string	"MULTITYPE_CUSTOM"
+.LASF1327:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1424:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1007:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1469:
+	.string	"BOOT_STAGE_FEATURES"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF901:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF900:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF942:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1349:
+	.string	"LON 1"
+.LASF1373:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1388:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1949:
+	.string	"isAccelerationCalibrationComplete"
+.LASF1204:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF695:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF630:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1968:
+	.string	"canUseHorizonMode"
+.LASF1284:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1988:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1734:
+	.string	"thrMid8"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1655:
+	.string	"forwardFromChannel"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF723:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF784:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1923:
+	.string	"gyroSyncCheckUpdate"
+.LASF1361:
+	.string	"CALCULATE_LED_X(x) ((x & LED_XY_MASK) << LED_X_BIT_OFFSET)"
+.LASF1097:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1748:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1362:
+	.string	"CALCULATE_LED_Y(y) ((y & LED_XY_MASK) << LED_Y_BIT_OFFSET)"
+.LASF642:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1037:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF754:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1728:
+	.string	"rangeStartStep"
+.LASF852:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF725:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1207:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF865:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1844:
+	.string	"sensorAlignmentConfig"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF898:
+	.string	"UINT64_C(c) c ## UL"
+.LASF640:
+	.string	"__f128(x) x ##f128"
+.LASF1117:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1574:
+	.string	"soft_gyro_notch_hz"
+.LASF917:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF853:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1901:
+	.string	"calculateEstimatedAltitude"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF760:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1481:
+	.string	"PROFILE_STAGE_BLACKBOX"
+.LASF1531:
+	.string	"SENSOR_SONAR"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1158:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF806:
+	.string	"__fsfilcnt_t_defined "
+.LASF607:
+	.string	"WNOHANG 1"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1186:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1826:
+	.string	"failsafeConfig"
+.LASF1315:
+	.string	"PROFILE_HISTOGRAM_BUCKET_COUNT 10"
+.LASF1165:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF1297:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF1528:
+	.string	"SENSOR_ACC"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF1642:
+	.string	"tri_unarmed_servo"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1397:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1130:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1544:
+	.string	"sensorAlignmentConfig_s"
+.LASF1548:
+	.string	"sensorAlignmentConfig_t"
+.LASF962:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1395:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1834:
+	.string	"gyro_sync"
+.LASF906:
+	.string	"__DECL_SIMD_cosl "
+.LASF1024:
+	.string	"__DECL_SIMD_cosh "
+.LASF1516:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF862:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF746:
+	.string	"__clockid_t_defined 1"
+.LASF1916:
+	.string	"applyAltHold"
+.LASF1541:
+	.string	"CW180_DEG_FLIP"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1189:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF609:
+	.string	"WSTOPPED 2"
+.LASF603:
+	.string	"NULL"
+.LASF1778:
+	.string	"GPS_FIX_HOME"
+.LASF1328:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF1583:
+	.string	"multiwiiCurrentMeterOutput"
+.LASF829:
+	.string	"__have_pthread_attr_t 1"
+.LASF1518:
+	.string	"pitch"
+.LASF610:
+	.string	"WEXITED 4"
+.LASF1236:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF702:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF461:
+	.string	"__PMT"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1869:
+	.string	"blackbox_rate_denom"
+.LASF599:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1755:
+	.string	"telemetry_switch"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF819:
+	.string	"__LOCK_ALIGNMENT "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1511:
+	.string	"pidProfile_s"
+.LASF1515:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1665:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF1920:
+	.string	"gyroAccumulateSample"
+.LASF1930:
+	.string	"calculateThrottleStatus"
+.LASF1257:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1660:
+	.string	"FUNCTION_MSP"
+.LASF1547:
+	.string	"mag_align"
+.LASF1085:
+	.string	"__DECL_SIMD_log2f "
+.LASF796:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1766:
+	.string	"armingFlags"
+.LASF1218:
+	.string	"_Mdouble_ _Float64x"
+.LASF899:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1134:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF934:
+	.string	"__DECL_SIMD_log "
+.LASF1243:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF638:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1182:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF739:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1625:
+	.string	"MULTITYPE_OCTOX8"
+.LASF975:
+	.string	"__DECL_SIMD_atanf "
+.LASF1558:
+	.string	"rollDegrees"
+.LASF772:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1980:
+	.string	"vbatCycleTime"
+.LASF1590:
+	.string	"failsafeConfig_s"
+.LASF1596:
+	.string	"failsafeConfig_t"
+.LASF611:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF676:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1188:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1429:
+	.string	"UNIT_TESTED "
+.LASF1943:
+	.string	"feature"
+.LASF938:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF879:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF866:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF983:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF846:
+	.string	"INT32_MAX (2147483647)"
+.LASF591:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1247:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1921:
+	.string	"bootStageEnd"
+.LASF982:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF471:
+	.string	"__P(args) args"
+.LASF1404:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF654:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1478:
+	.string	"PROFILE_STAGE_SERIAL"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF878:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF856:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1562:
+	.string	"accDeadband_s"
+.LASF1563:
+	.string	"accDeadband_t"
+.LASF1641:
+	.string	"yaw_direction"
+.LASF1425:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1679:
+	.string	"midrc"
+.LASF1214:
+	.string	"_Mdouble_ _Float128"
+.LASF1178:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1898:
+	.string	"AccInflightCalibrationSavetoEEProm"
+.LASF1183:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1350:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1743:
+	.string	"TELEMETRY_PROVIDER_HOTT"
+.LASF1969:
+	.string	"updateMagHold"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1100:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1939:
+	.string	"beepcodeUpdateState"
+.LASF1895:
+	.string	"pid_controller"
+.LASF1274:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1343:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1453:
+	.string	"int8_t"
+.LASF1341:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF1966:
+	.string	"processRx"
+.LASF791:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1890:
+	.string	"dynP8"
+.LASF712:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF844:
+	.string	"INT8_MAX (127)"
+.LASF1956:
+	.string	"taskSaveConfig"
+.LASF1976:
+	.string	"prop1"
+.LASF1977:
+	.string	"prop2"
+.LASF800:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1096:
+	.string	"__DECL_SIMD_log1pl "
+.LASF978:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF886:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1618:
+	.string	"MULTITYPE_BI"
+.LASF1875:
+	.string	"TASK_SYSTEM"
+.LASF928:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF783:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF713:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF605:
+	.string	"__need_NULL"
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1739:
+	.string	"rcCommand"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1582:
+	.string	"currentMeterOffset"
+.LASF785:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1045:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1179:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF990:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF958:
+	.string	"__DECL_SIMD_powf32 "
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1367:
+	.string	"LED_FUNCTION_MASK 0x7C0"
+.LASF1089:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1772:
+	.string	"GPS_HOLD_MODE"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1479:
+	.string	"PROFILE_STAGE_TELEMETRY"
+.LASF1222:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1899:
+	.string	"AccInflightCalibrationActive"
+.LASF1984:
+	.string	"rcCommand_PITCH"
+.LASF1513:
+	.string	"H_level"
+.LASF1598:
+	.string	"reset"
+.LASF1823:
+	.string	"throttle_correction_angle"
+.LASF872:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF997:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1773:
+	.string	"HEADFREE_MODE"
+.LASF991:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1311:
+	.string	"HSV_HUE_MAX 359"
+.LASF1570:
+	.string	"gyro"
+.LASF1268:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1094:
+	.string	"__DECL_SIMD_log1p "
+.LASF1566:
+	.string	"baro_noise_lpf"
+.LASF1166:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF698:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1252:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1454:
+	.string	"int16_t"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1258:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1443:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1445:
+	.string	"signed char"
+.LASF1594:
+	.string	"failsafe_min_usec"
+.LASF939:
+	.string	"__DECL_SIMD_logf64 "
+.LASF922:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1725:
+	.string	"modeActivationCondition_s"
+.LASF1730:
+	.string	"modeActivationCondition_t"
+.LASF566:
+	.string	"__size_t__ "
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF1238:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1421:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF1640:
+	.string	"mixerConfig_s"
+.LASF808:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1669:
+	.string	"msp_baudrate"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1876:
+	.string	"TASK_GYROPID"
+.LASF747:
+	.string	"__time_t_defined 1"
+.LASF775:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF767:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1799:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1493:
+	.string	"SERIAL_INVERTED"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1302:
+	.string	"sq(x) ((x)*(x))"
+.LASF918:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF880:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1226:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1431:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1868:
+	.string	"telemetryConfig"
+.LASF1706:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF828:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF657:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1557:
+	.string	"boardAlignment_s"
+.LASF1561:
+	.string	"boardAlignment_t"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1269:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF807:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1691:
+	.string	"BOXCAMSTAB"
+.LASF615:
+	.string	"__WCLONE 0x80000000"
+.LASF1133:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1670:
+	.string	"cli_baudrate"
+.LASF1086:
+	.string	"__DECL_SIMD_log2l "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1396:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF802:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1595:
+	.string	"failsafe_max_usec"
+.LASF631:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF699:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF646:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1622:
+	.string	"MULTITYPE_FLYING_WING"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1678:
+	.string	"serialrx_provider"
+.LASF1746:
+	.string	"telemetryProvider_e"
+.LASF1208:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1986:
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1526:
+	.string	"magHold"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1815:
+	.string	"accDeadband"
+.LASF691:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1299:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1971:
+	.string	"mwArm"
+.LASF1919:
+	.string	"profileStageBegin"
+.LASF1575:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1253:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF930:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF979:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF940:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1588:
+	.string	"mincommand"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1549:
+	.string	"knownSensors_s"
+.LASF1556:
+	.string	"knownSensors_t"
+.LASF1689:
+	.string	"BOXHEADFREE"
+.LASF1709:
+	.string	"MultiType"
+.LASF1260:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1422:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1177:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF867:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1967:
+	.string	"throttleStatus"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF931:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1763:
+	.string	"OK_TO_ARM"
+.LASF1090:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1597:
+	.string	"failsafeVTable_s"
+.LASF1608:
+	.string	"failsafeVTable_t"
+.LASF1578:
+	.string	"vbatscale"
+.LASF1132:
+	.string	"__DECL_SIMD_erff64x "
+.LASF693:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF636:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1795:
+	.string	"FEATURE_CURRENT_METER"
+.LASF770:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1432:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF1565:
+	.string	"baro_sample_count"
+.LASF692:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1093:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1917:
+	.string	"profileStageEnd"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1355:
+	.string	"MAX_LED_STRIP_LENGTH 32"
+.LASF1480:
+	.string	"PROFILE_STAGE_LEDSTRIP"
+.LASF947:
+	.string	"__DECL_SIMD_expf16 "
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1476:
+	.string	"PROFILE_STAGE_MIXER"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF1393:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1091:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1740:
+	.string	"lookupPitchRollRC"
+.LASF1339:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF682:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF850:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1567:
+	.string	"baro_cf_vel"
+.LASF1321:
+	.string	"LED1_TOGGLE "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1783:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1882:
+	.string	"TASK_BLACKBOX"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1440:
+	.string	"long int"
+.LASF1401:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1338:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1087:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF840:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF848:
+	.string	"UINT8_MAX (255)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1036:
+	.string	"__DECL_SIMD_expm1l "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1832:
+	.string	"enabledFeatures"
+.LASF1466:
+	.string	"BOOT_STAGE_SENSORS"
+.LASF1858:
+	.string	"knownSensors"
+.LASF812:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1742:
+	.string	"TELEMETRY_PROVIDER_FRSKY"
+.LASF1759:
+	.string	"frsky_coordinate_format"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF1546:
+	.string	"acc_align"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF857:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1533:
+	.string	"SENSOR_GPSMAG"
+.LASF1363:
+	.string	"CALCULATE_LED_XY(x,y) (CALCULATE_LED_X(x) | CALCULATE_LED_Y(y))"
+.LASF790:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF668:
+	.string	"EXIT_SUCCESS 0"
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1983:
+	.string	"sinDiff"
+.LASF1631:
+	.string	"MULTITYPE_VTAIL4"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF568:
+	.string	"_SIZE_T "
+.LASF715:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF660:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1878:
+	.string	"TASK_SERIAL"
+.LASF1577:
+	.string	"batteryConfig_s"
+.LASF1584:
+	.string	"batteryConfig_t"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1054:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1926:
+	.string	"updateActivatedModes"
+.LASF1847:
+	.string	"acc_hardware"
+.LASF824:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF969:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1196:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1459:
+	.string	"uint32_t"
+.LASF1756:
+	.string	"frsky_inversion"
+.LASF572:
+	.string	"__SIZE_T "
+.LASF720:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF986:
+	.string	"__DECL_SIMD_asinl "
+.LASF1344:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1764:
+	.string	"PREVENT_ARMING"
+.LASF1263:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1040:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1084:
+	.string	"__DECL_SIMD_log2 "
+.LASF703:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF719:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1322:
+	.string	"LED1_OFF "
+.LASF571:
+	.string	"_T_SIZE "
+.LASF1632:
+	.string	"MULTITYPE_HEX6H"
+.LASF1694:
+	.string	"BOXGPSHOLD"
+.LASF1273:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF661:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF794:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1845:
+	.string	"boardAlignment"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF1624:
+	.string	"MULTITYPE_HEX6X"
+.LASF1761:
+	.string	"batterySize"
+.LASF1498:
+	.string	"inputFilteringMode_e"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF484:
+	.string	"__flexarr []"
+.LASF663:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF954:
+	.string	"__DECL_SIMD_pow "
+.LASF671:
+	.string	"_BITS_TYPES_H 1"
+.LASF1910:
+	.string	"blackboxLogIteration"
+.LASF1439:
+	.string	"long unsigned int"
+.LASF1300:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF861:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1259:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1690:
+	.string	"BOXHEADADJ"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF788:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF588:
+	.string	"_T_WCHAR_ "
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1306:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1319:
+	.string	"LED0_OFF "
+.LASF1849:
+	.string	"gyro_cmpf_factor"
+.LASF854:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF1877:
+	.string	"TASK_RX"
+.LASF923:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1576:
+	.string	"gyroConfig_t"
+.LASF1325:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF666:
+	.string	"RAND_MAX 2147483647"
+.LASF1693:
+	.string	"BOXGPSHOME"
+.LASF600:
+	.string	"__DEFINED_wchar_t "
+.LASF1241:
+	.string	"FP_INFINITE 1"
+.LASF674:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1959:
+	.string	"taskSaveConfigCheck"
+.LASF1883:
+	.string	"TASK_COUNT"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1902:
+	.string	"baroUpdate"
+.LASF1199:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1348:
+	.string	"LAT 0"
+.LASF1843:
+	.string	"servo_pwm_rate"
+.LASF1803:
+	.string	"FEATURE_ONESHOT125"
+.LASF1452:
+	.string	"char"
+.LASF813:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1503:
+	.string	"PIDPOS"
+.LASF1605:
+	.string	"checkPulse"
+.LASF1080:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1733:
+	.string	"rcExpo8"
+.LASF694:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF649:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1613:
+	.string	"enabled"
+.LASF1621:
+	.string	"MULTITYPE_HEX6"
+.LASF632:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1471:
+	.string	"BOOT_STAGE_COUNT"
+.LASF910:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1369:
+	.string	"CLI_H_ "
+.LASF1077:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF672:
+	.string	"__S16_TYPE short int"
+.LASF994:
+	.string	"__DECL_SIMD_hypot "
+.LASF1723:
+	.string	"THROTTLE_HIGH"
+.LASF1181:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1416:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF716:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1697:
+	.string	"BOXLEDMAX"
+.LASF1573:
+	.string	"soft_gyro_lpf_hz"
+.LASF778:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1015:
+	.string	"__DECL_SIMD_exp10f "
+.LASF909:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1081:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF973:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1483:
+	.string	"profileStage_e"
+.LASF837:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1937:
+	.string	"enableWarningLed"
+.LASF391:
+	.string	"true 1"
+.LASF911:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1408:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1951:
+	.string	"sensors"
+.LASF965:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF706:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF576:
+	.string	"_SIZE_T_DEFINED "
+.LASF1387:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1758:
+	.string	"gpsNoFixLongitude"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1530:
+	.string	"SENSOR_MAG"
+.LASF1791:
+	.string	"FEATURE_GPS"
+.LASF951:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1148:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1428:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1905:
+	.string	"isBaroReady"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF731:
+	.string	"__STD_TYPE"
+.LASF717:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF891:
+	.string	"INT8_C(c) c"
+.LASF863:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF629:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF683:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF644:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1107:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF565:
+	.string	"__need_NULL "
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1330:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1651:
+	.string	"flaps_speed"
+.LASF1056:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1485:
+	.string	"sensorReadFuncPtr"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1415:
+	.string	"BLACKBOX_RATE_DENOM_MAX 32"
+.LASF1160:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF989:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF604:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1907:
+	.string	"handleSerial"
+.LASF1337:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF653:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1827:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1145:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1866:
+	.string	"fixedwing_althold_dir"
+.LASF1771:
+	.string	"GPS_HOME_MODE"
+.LASF827:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1213:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1789:
+	.string	"FEATURE_SERVO_TILT"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1879:
+	.string	"TASK_CONFIG"
+.LASF843:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1420:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF888:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF786:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1472:
+	.string	"bootStage_e"
+.LASF927:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF948:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1685:
+	.string	"BOXANGLE"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1250:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF602:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF877:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1419:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1275:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF822:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1114:
+	.string	"__DECL_SIMD_acosh "
+.LASF1334:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1523:
+	.string	"rollAndPitchTrims_t_def"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1935:
+	.string	"mixerResetSaturation"
+.LASF1398:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1564:
+	.string	"barometerConfig_s"
+.LASF1569:
+	.string	"barometerConfig_t"
+.LASF371:
+	.string	"__linux 1"
+.LASF1237:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1726:
+	.string	"modeId"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1270:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1240:
+	.string	"FP_NAN 0"
+.LASF1751:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF1859:
+	.string	"batteryConfig"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF741:
+	.string	"__id_t_defined "
+.LASF1861:
+	.string	"inputFilteringMode"
+.LASF1990:
+	.string	"isBootCalibrationComplete"
+.LASF1027:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1124:
+	.string	"__DECL_SIMD_erf "
+.LASF1656:
+	.string	"gimbalConfig_s"
+.LASF1658:
+	.string	"gimbalConfig_t"
+.LASF825:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF569:
+	.string	"_SYS_SIZE_T_H "
+.LASF1536:
+	.string	"CW90_DEG"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1741:
+	.string	"lookupThrottleRC"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1170:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1543:
+	.string	"sensor_align_e"
+.LASF1900:
+	.string	"InflightcalibratingA"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1602:
+	.string	"incrementCounter"
+.LASF1307:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF743:
+	.string	"__daddr_t_defined "
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1850:
+	.string	"gyro_cmpfm_factor"
+.LASF614:
+	.string	"__WALL 0x40000000"
+.LASF1713:
+	.string	"THROTTLE"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1805:
+	.string	"profile_s"
+.LASF757:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF771:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1934:
+	.string	"blinkLedAndSoundBeeper"
+.LASF964:
+	.string	"__DECL_SIMD_acos "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1464:
+	.string	"BOOT_STAGE_SYSTEM"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1035:
+	.string	"__DECL_SIMD_expm1f "
+.LASF681:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF941:
+	.string	"__DECL_SIMD_logf32x "
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1559:
+	.string	"pitchDegrees"
+.LASF626:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1765:
+	.string	"ARMED"
+.LASF1175:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1129:
+	.string	"__DECL_SIMD_erff64 "
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1267:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF670:
+	.string	"_SYS_TYPES_H 1"
+.LASF1886:
+	.string	"cycleTime"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF967:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1747:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF774:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1174:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF704:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1735:
+	.string	"thrExpo8"
+.LASF755:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1194:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1633:
+	.string	"MULTITYPE_PPM_TO_SERVO"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF758:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1137:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF714:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1798:
+	.string	"FEATURE_RX_MSP"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1418:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF1979:
+	.string	"vbatTimer"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF592:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1904:
+	.string	"processEEPROMWrite"
+.LASF665:
+	.string	"__lldiv_t_defined 1"
+.LASF1781:
+	.string	"SMALL_ANGLE"
+.LASF859:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1394:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1255:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1745:
+	.string	"TELEMETRY_PROVIDER_MAX"
+.LASF1630:
+	.string	"MULTITYPE_HELI_90_DEG"
+.LASF1450:
+	.string	"__int32_t"
+.LASF1860:
+	.string	"rxConfig"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1701:
+	.string	"BOXGOV"
+.LASF1821:
+	.string	"alt_hold_deadband"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF621:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF1423:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1228:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1800:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1304:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1880:
+	.string	"TASK_BARO"
+.LASF1309:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1809:
+	.string	"dynThrPID"
+.LASF1925:
+	.string	"gyroSyncIsEnabled"
+.LASF1604:
+	.string	"isIdle"
+.LASF966:
+	.string	"__DECL_SIMD_acosl "
+.LASF1400:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1433:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1210:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF680:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF845:
+	.string	"INT16_MAX (32767)"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1782:
+	.string	"FIXED_WING"
+.LASF1144:
+	.string	"__DECL_SIMD_asinh "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF874:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1191:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF804:
+	.string	"__blkcnt_t_defined "
+.LASF1774:
+	.string	"AUTOTUNE_MODE"
+.LASF955:
+	.string	"__DECL_SIMD_powf "
+.LASF613:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF589:
+	.string	"_T_WCHAR "
+.LASF582:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF849:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1881:
+	.string	"TASK_ALTITUDE"
+.LASF1736:
+	.string	"rollPitchRate"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF623:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF722:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF730:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1357:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1571:
+	.string	"gyroConfig_s"
+.LASF1370:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF687:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1752:
+	.string	"frskyUnit_e"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1224:
+	.string	"__MATHCALL"
+.LASF1078:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1146:
+	.string	"__DECL_SIMD_asinhl "
+.LASF726:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF896:
+	.string	"UINT16_C(c) c"
+.LASF811:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1482:
+	.string	"PROFILE_STAGE_COUNT"
+.LASF830:
+	.string	"_ALLOCA_H 1"
+.LASF1014:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1914:
+	.string	"shouldProcessRx"
+.LASF1216:
+	.string	"_Mdouble_ _Float32x"
+.LASF882:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1704:
+	.string	"BOXAUTOTUNE"
+.LASF1568:
+	.string	"baro_cf_alt"
+.LASF1825:
+	.string	"servoConf"
+.LASF1674:
+	.string	"serialConfig_t"
+.LASF1279:
+	.string	"__enable_irq() "
+.LASF1131:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1965:
+	.string	"taskMainPidLoopCheck"
+.LASF1104:
+	.string	"__DECL_SIMD_atanh "
+.LASF1716:
+	.string	"AUX3"
+.LASF1698:
+	.string	"BOXLEDLOW"
+.LASF1718:
+	.string	"AUX5"
+.LASF1824:
+	.string	"throttle_correction_value"
+.LASF1719:
+	.string	"AUX6"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF1720:
+	.string	"AUX7"
+.LASF884:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1724:
+	.string	"throttleStatus_e"
+.LASF1777:
+	.string	"flightModeFlags"
+.LASF1662:
+	.string	"FUNCTION_TELEMETRY"
+.LASF1668:
+	.string	"serial_port_scenario"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1332:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1710:
+	.string	"rc_alias"
+.LASF590:
+	.string	"__WCHAR_T "
+.LASF1272:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF732:
+	.string	"__u_char_defined "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1033:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF995:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF619:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF795:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1390:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1664:
+	.string	"FUNCTION_GPS"
+.LASF564:
+	.string	"__need_wchar_t "
+.LASF980:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1646:
+	.string	"deadband3d_high"
+.LASF1973:
+	.string	"annexCode"
+.LASF651:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1246:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1281:
+	.string	"U_ID_1 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1286:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1908:
+	.string	"updateAltHoldState"
+.LASF1456:
+	.string	"long long unsigned int"
+.LASF733:
+	.string	"__ino_t_defined "
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF727:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1855:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF959:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1290:
+	.string	"ACC "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF925:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1963:
+	.string	"haveProcessedAnnexCodeOnce"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1374:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1853:
+	.string	"dcm_ki"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF981:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1852:
+	.string	"dcm_kp"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1673:
+	.string	"reboot_character"
+.LASF1961:
+	.string	"currentDeltaTime"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF1005:
+	.string	"__DECL_SIMD_exp2f "
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF921:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF834:
+	.string	"_STDINT_H 1"
+.LASF1265:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1522:
+	.string	"rollAndPitchTrims_s"
+.LASF1524:
+	.string	"rollAndPitchTrims_t"
+.LASF1643:
+	.string	"mixerConfig_t"
+.LASF635:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1591:
+	.string	"failsafe_delay"
+.LASF1760:
+	.string	"frsky_unit"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF1380:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1581:
+	.string	"currentMeterScale"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1209:
+	.string	"_Mdouble_ _Float32"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1835:
+	.string	"gyro_sync_denom"
+.LASF617:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1095:
+	.string	"__DECL_SIMD_log1pf "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1727:
+	.string	"auxChannelIndex"
+.LASF1032:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1970:
+	.string	"handleInflightCalibrationStickPosition"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1987:
+	.string	"rollAndPitchTrimsDelta"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF634:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF721:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1028:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1347:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF742:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1731:
+	.string	"controlRateConfig_s"
+.LASF919:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF1461:
+	.string	"RGB_RED"
+.LASF1650:
+	.string	"airplaneConfig_t"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF805:
+	.string	"__fsblkcnt_t_defined "
+.LASF1644:
+	.string	"flight3DConfig_s"
+.LASF1649:
+	.string	"flight3DConfig_t"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1944:
+	.string	"sin_approx"
+.LASF801:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1829:
+	.string	"profile_t"
+.LASF1942:
+	.string	"updateBatteryVoltage"
+.LASF1932:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF1623:
+	.string	"MULTITYPE_Y4"
+.LASF1620:
+	.string	"MULTITYPE_Y6"
+.LASF1732:
+	.string	"rcRate8"
+.LASF1817:
+	.string	"acc_unarmedcal"
+.LASF912:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1946:
+	.string	"degreesToRadians"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1936:
+	.string	"updateWarningLed"
+.LASF976:
+	.string	"__DECL_SIMD_atanl "
+.LASF809:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF832:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF881:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1434:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1074:
+	.string	"__DECL_SIMD_log10 "
+.LASF1494:
+	.string	"serialInversion_e"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF718:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1488:
+	.string	"temperature"
+.LASF1075:
+	.string	"__DECL_SIMD_log10f "
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1510:
+	.string	"gyro_s"
+.LASF1491:
+	.string	"gyro_t"
+.LASF1047:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1894:
+	.string	"pidControllerFuncPtr"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF799:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF968:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1324:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1342:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF769:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1055:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF956:
+	.string	"__DECL_SIMD_powl "
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF744:
+	.string	"__key_t_defined "
+.LASF1441:
+	.string	"long long int"
+.LASF708:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF889:
+	.string	"WINT_MIN (0u)"
+.LASF933:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1796:
+	.string	"FEATURE_3D"
+.LASF1138:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF667:
+	.string	"EXIT_FAILURE 1"
+.LASF1833:
+	.string	"looptime"
+.LASF628:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1212:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1308:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1430:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1818:
+	.string	"modeActivationConditions"
+.LASF1677:
+	.string	"rcmap"
+.LASF1527:
+	.string	"SENSOR_GYRO"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF579:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1550:
+	.string	"gyroHardware"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF823:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1353:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF618:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF885:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1505:
+	.string	"PIDNAVR"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1807:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1391:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1822:
+	.string	"alt_hold_fast_change"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1266:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1296:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF1436:
+	.string	"VBATFREQ 6"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF826:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1609:
+	.string	"failsafe_s"
+.LASF1614:
+	.string	"failsafe_t"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1552:
+	.string	"baroHardware"
+.LASF1206:
+	.string	"_Mdouble_ long double"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF876:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF883:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1804:
+	.string	"FEATURE_DSHOT"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1278:
+	.string	"__disable_irq() "
+.LASF1509:
+	.string	"PID_ITEM_COUNT"
+.LASF710:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF915:
+	.string	"__DECL_SIMD_sinf "
+.LASF1955:
+	.string	"taskUpdateBaro"
+.LASF1754:
+	.string	"telemetry_provider"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF926:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1411:
+	.string	"PITCH_LOOKUP_LENGTH 7"
+.LASF1893:
+	.string	"failsafe"
+.LASF707:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1180:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1814:
+	.string	"accz_lpf_cutoff"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1851:
+	.string	"attitude_estimator"
+.LASF1227:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1551:
+	.string	"accHardware"
+.LASF700:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1006:
+	.string	"__DECL_SIMD_exp2l "
+.LASF943:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1412:
+	.string	"THROTTLE_LOOKUP_LENGTH 12"
+.LASF1403:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 40"
+.LASF1192:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1846:
+	.string	"yaw_control_direction"
+.LASF1446:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1376:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF567:
+	.string	"__SIZE_T__ "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF696:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF1435:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF1645:
+	.string	"deadband3d_low"
+.LASF1964:
+	.string	"gyroSamplesSincePid"
+.LASF1312:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1612:
+	.string	"events"
+.LASF1525:
+	.string	"heading"
+.LASF1118:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1838:
+	.string	"customMixer"
+.LASF1444:
+	.string	"unsigned int"
+.LASF998:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF780:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1271:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1239:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1414:
+	.string	"BLACKBOX_BAUDRATE 115200"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1356:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2f "
+.LASF924:
+	.string	"__DECL_SIMD_sincos "
+.LASF1586:
+	.string	"minthrottle"
+.LASF1136:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1695:
+	.string	"BOXPASSTHRU"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF688:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1185:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1438:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1628:
+	.string	"MULTITYPE_AIRPLANE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF950:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1654:
+	.string	"rate"
+.LASF1692:
+	.string	"BOXCAMTRIG"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1870:
+	.string	"profile"
+.LASF684:
+	.string	"__S64_TYPE long int"
+.LASF1775:
+	.string	"PASSTHRU_MODE"
+.LASF797:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1383:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1931:
+	.string	"updateRSSI"
+.LASF1156:
+	.string	"__DECL_SIMD_erfcl "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1537:
+	.string	"CW180_DEG"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1924:
+	.string	"micros"
+.LASF1830:
+	.string	"master_t"
+.LASF1475:
+	.string	"PROFILE_STAGE_PID"
+.LASF1947:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1912:
+	.string	"writeServos"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF1254:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1150:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1580:
+	.string	"vbatmincellvoltage"
+.LASF1280:
+	.string	"U_ID_0 0x5349544c"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1945:
+	.string	"cos_approx"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/mw.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10929 @@
+	.file	"rx.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/rx/rx.c"
+	.section	.text.useRxConfig,"ax",@progbits
+	.p2align 4
+	.globl	useRxConfig
+	.type	useRxConfig, @function
+useRxConfig:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/rx/rx.c"
+	.loc 1 82 1 view -0
+	.cfi_startproc
+	.loc 1 83 5 view .LVU1
+	.loc 1 83 14 is_stmt 0 view .LVU2
+	movq	%rdi, rxConfig(%rip)
+	.loc 1 84 1 view .LVU3
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	useRxConfig, .-useRxConfig
+	.section	.text.rxInit,"ax",@progbits
+	.p2align 4
+	.globl	rxInit
+	.type	rxInit, @function
+rxInit:
+.LVL1:
+.LFB12:
+	.loc 1 110 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 111 5 view .LVU5
+	.loc 1 112 5 view .LVU6
+.LBB15:
+.LBI15:
+	.loc 1 81 6 view .LVU7
+.LBB16:
+	.loc 1 83 5 view .LVU8
+	.loc 1 83 14 is_stmt 0 view .LVU9
+	movq	%rdi, rxConfig(%rip)
+.LVL2:
+	.loc 1 83 14 view .LVU10
+.LBE16:
+.LBE15:
+	.loc 1 114 5 is_stmt 1 view .LVU11
+	.loc 1 114 19 view .LVU12
+	leaq	rcData(%rip), %rax
+	.loc 1 110 1 is_stmt 0 view .LVU13
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	leaq	36(%rax), %rcx
+	.loc 1 110 1 view .LVU14
+	movq	%rdi, %rbx
+.LVL3:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 115 9 is_stmt 1 discriminator 3 view .LVU15
+	.loc 1 115 19 is_stmt 0 discriminator 3 view .LVU16
+	movzwl	10(%rbx), %edx
+	.loc 1 114 19 discriminator 3 view .LVU17
+	addq	$2, %rax
+.LVL4:
+	.loc 1 115 19 discriminator 3 view .LVU18
+	movw	%dx, -2(%rax)
+	.loc 1 114 28 is_stmt 1 discriminator 3 view .LVU19
+.LVL5:
+	.loc 1 114 19 discriminator 3 view .LVU20
+	cmpq	%rcx, %rax
+	jne	.L4
+	.loc 1 118 5 view .LVU21
+	.loc 1 126 9 is_stmt 0 view .LVU22
+	movl	$16384, %edi
+.LVL6:
+	.loc 1 118 14 view .LVU23
+	movq	%rsi, failsafe(%rip)
+	.loc 1 126 5 is_stmt 1 view .LVU24
+	.loc 1 126 9 is_stmt 0 view .LVU25
+	call	feature@PLT
+.LVL7:
+	.loc 1 126 8 view .LVU26
+	testb	%al, %al
+	jne	.L14
+.L5:
+	.loc 1 130 5 is_stmt 1 view .LVU27
+	.loc 1 130 9 is_stmt 0 view .LVU28
+	movl	$1, %edi
+	call	feature@PLT
+.LVL8:
+	.loc 1 130 8 view .LVU29
+	testb	%al, %al
+	jne	.L8
+	.loc 1 130 36 discriminator 1 view .LVU30
+	movl	$8192, %edi
+	call	feature@PLT
+.LVL9:
+	.loc 1 130 33 discriminator 1 view .LVU31
+	testb	%al, %al
+	je	.L7
+.L8:
+	.loc 1 131 9 is_stmt 1 view .LVU32
+	leaq	rcReadRawFunc(%rip), %rsi
+	leaq	rxRuntimeConfig(%rip), %rdi
+	call	rxPwmInit@PLT
+.LVL10:
+.L7:
+	.loc 1 134 5 view .LVU33
+	.loc 1 134 68 is_stmt 0 view .LVU34
+	movzbl	rxRuntimeConfig(%rip), %eax
+	.loc 1 135 1 view .LVU35
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL11:
+	.loc 1 134 68 view .LVU36
+	subl	$4, %eax
+	.loc 1 134 37 view .LVU37
+	movb	%al, 1+rxRuntimeConfig(%rip)
+	.loc 1 135 1 view .LVU38
+	ret
+.LVL12:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+	.loc 1 127 9 is_stmt 1 view .LVU39
+	leaq	rcReadRawFunc(%rip), %rdx
+	leaq	rxRuntimeConfig(%rip), %rsi
+	movq	%rbx, %rdi
+	call	rxMspInit@PLT
+.LVL13:
+	jmp	.L5
+	.cfi_endproc
+.LFE12:
+	.size	rxInit, .-rxInit
+	.section	.text.calculateChannelRemapping,"ax",@progbits
+	.p2align 4
+	.globl	calculateChannelRemapping
+	.type	calculateChannelRemapping, @function
+calculateChannelRemapping:
+.LVL14:
+.LFB13:
+	.loc 1 181 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU41
+	.loc 1 181 1 is_stmt 0 view .LVU42
+	movl	%edx, %eax
+	.loc 1 182 8 view .LVU43
+	cmpb	%sil, %dl
+	jb	.L17
+	.loc 1 186 1 view .LVU44
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 183 9 is_stmt 1 view .LVU45
+	.loc 1 183 26 is_stmt 0 view .LVU46
+	movzbl	%dl, %edx
+.LVL15:
+	.loc 1 183 26 view .LVU47
+	movzbl	(%rdi,%rdx), %eax
+.LVL16:
+	.loc 1 186 1 view .LVU48
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	calculateChannelRemapping, .-calculateChannelRemapping
+	.section	.text.updateRx,"ax",@progbits
+	.p2align 4
+	.globl	updateRx
+	.type	updateRx, @function
+updateRx:
+.LFB14:
+	.loc 1 193 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 194 5 view .LVU50
+	.loc 1 193 1 is_stmt 0 view .LVU51
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 203 9 view .LVU52
+	movl	$16384, %edi
+	.loc 1 194 20 view .LVU53
+	movb	$0, rcDataReceived(%rip)
+	.loc 1 203 5 is_stmt 1 view .LVU54
+	.loc 1 203 9 is_stmt 0 view .LVU55
+	call	feature@PLT
+.LVL17:
+	.loc 1 203 8 view .LVU56
+	testb	%al, %al
+	jne	.L19
+	.loc 1 207 9 view .LVU57
+	movzbl	rcDataReceived(%rip), %eax
+	.loc 1 207 5 is_stmt 1 view .LVU58
+	.loc 1 207 8 is_stmt 0 view .LVU59
+	testb	%al, %al
+	jne	.L28
+.L18:
+	.loc 1 212 1 view .LVU60
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L19:
+	.cfi_restore_state
+	.loc 1 204 9 is_stmt 1 view .LVU61
+	.loc 1 204 26 is_stmt 0 view .LVU62
+	call	rxMspFrameComplete@PLT
+.LVL18:
+	.loc 1 204 24 view .LVU63
+	movb	%al, rcDataReceived(%rip)
+	.loc 1 207 5 is_stmt 1 view .LVU64
+	.loc 1 207 8 is_stmt 0 view .LVU65
+	testb	%al, %al
+	je	.L18
+.L28:
+	.loc 1 208 9 is_stmt 1 view .LVU66
+	.loc 1 208 13 is_stmt 0 view .LVU67
+	movl	$256, %edi
+	call	feature@PLT
+.LVL19:
+	.loc 1 208 12 view .LVU68
+	testb	%al, %al
+	je	.L18
+	.loc 1 209 13 is_stmt 1 view .LVU69
+	.loc 1 209 21 is_stmt 0 view .LVU70
+	movq	failsafe(%rip), %rax
+	.loc 1 209 29 view .LVU71
+	movq	(%rax), %rax
+	.loc 1 209 13 view .LVU72
+	movq	(%rax), %rax
+	.loc 1 212 1 view .LVU73
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 209 13 view .LVU74
+	jmp	*%rax
+.LVL20:
+	.cfi_endproc
+.LFE14:
+	.size	updateRx, .-updateRx
+	.section	.text.shouldProcessRx,"ax",@progbits
+	.p2align 4
+	.globl	shouldProcessRx
+	.type	shouldProcessRx, @function
+shouldProcessRx:
+.LVL21:
+.LFB15:
+	.loc 1 215 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 216 5 view .LVU76
+	.loc 1 216 12 is_stmt 0 view .LVU77
+	movzbl	rcDataReceived(%rip), %eax
+	.loc 1 216 27 view .LVU78
+	testb	%al, %al
+	jne	.L29
+	.loc 1 216 53 discriminator 2 view .LVU79
+	subl	rxUpdateAt(%rip), %edi
+.LVL22:
+	.loc 1 216 27 discriminator 2 view .LVU80
+	notl	%edi
+	shrl	$31, %edi
+	movl	%edi, %eax
+.L29:
+	.loc 1 217 1 view .LVU81
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	shouldProcessRx, .-shouldProcessRx
+	.section	.text.calculateNonDataDrivenChannel,"ax",@progbits
+	.p2align 4
+	.globl	calculateNonDataDrivenChannel
+	.type	calculateNonDataDrivenChannel, @function
+calculateNonDataDrivenChannel:
+.LVL23:
+.LFB17:
+	.loc 1 226 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 227 5 view .LVU83
+	.loc 1 228 5 view .LVU84
+	.loc 1 229 5 view .LVU85
+	.loc 1 231 5 view .LVU86
+	.loc 1 231 48 is_stmt 0 view .LVU87
+	movzbl	rcSampleIndex(%rip), %r8d
+.LVL24:
+	.loc 1 234 5 is_stmt 1 view .LVU88
+	.loc 1 234 41 is_stmt 0 view .LVU89
+	movzbl	%dil, %ecx
+	leaq	rcSamples.5(%rip), %rdx
+	movq	%r8, %rax
+	andl	$3, %eax
+	.loc 1 237 8 view .LVU90
+	cmpb	$0, rxSamplesCollected.4(%rip)
+	.loc 1 234 41 view .LVU91
+	leaq	(%rax,%rcx,4), %rax
+	movw	%si, (%rdx,%rax,2)
+	.loc 1 237 5 is_stmt 1 view .LVU92
+	.loc 1 237 8 is_stmt 0 view .LVU93
+	jne	.L32
+	.loc 1 238 9 is_stmt 1 view .LVU94
+	.loc 1 239 20 is_stmt 0 view .LVU95
+	movl	%esi, %eax
+	.loc 1 238 12 view .LVU96
+	cmpb	$3, %r8b
+	jbe	.L31
+	.loc 1 241 9 is_stmt 1 view .LVU97
+	.loc 1 241 28 is_stmt 0 view .LVU98
+	movb	$1, rxSamplesCollected.4(%rip)
+.L32:
+	.loc 1 244 5 is_stmt 1 view .LVU99
+	.loc 1 246 5 view .LVU100
+	.loc 1 247 5 view .LVU101
+.LVL25:
+	.loc 1 247 39 view .LVU102
+	.loc 1 248 9 view .LVU103
+	.loc 1 247 55 view .LVU104
+	.loc 1 247 39 view .LVU105
+	.loc 1 248 44 is_stmt 0 view .LVU106
+	movzbl	%dil, %edi
+	.loc 1 248 44 view .LVU107
+	leaq	rcDataMean.3(%rip), %rax
+	movq	(%rdx,%rdi,8), %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$32, %xmm1
+	paddw	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrlq	$16, %xmm1
+	paddw	%xmm1, %xmm0
+	pextrw	$0, %xmm0, %edx
+	.loc 1 250 29 view .LVU108
+	testw	%dx, %dx
+	movw	%dx, (%rax,%rcx,2)
+	.loc 1 250 5 is_stmt 1 view .LVU109
+	.loc 1 250 29 is_stmt 0 view .LVU110
+	movl	%edx, %esi
+.LVL26:
+	.loc 1 250 29 view .LVU111
+	leal	3(%rdx), %eax
+	cmovs	%eax, %esi
+	movl	%esi, %eax
+	sarw	$2, %ax
+.LVL27:
+.L31:
+	.loc 1 251 1 view .LVU112
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	calculateNonDataDrivenChannel, .-calculateNonDataDrivenChannel
+	.section	.text.processRxChannels,"ax",@progbits
+	.p2align 4
+	.globl	processRxChannels
+	.type	processRxChannels, @function
+processRxChannels:
+.LFB18:
+	.loc 1 254 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 255 5 view .LVU114
+	.loc 1 257 4 view .LVU115
+.LVL28:
+	.loc 1 259 5 view .LVU116
+	.loc 1 254 1 is_stmt 0 view .LVU117
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 259 9 view .LVU118
+	movl	$256, %edi
+	.loc 1 254 1 view .LVU119
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 259 9 view .LVU120
+	call	feature@PLT
+.LVL29:
+	.loc 1 259 8 view .LVU121
+	testb	%al, %al
+	jne	.L36
+.L38:
+	.loc 1 257 9 view .LVU122
+	movb	$1, 15(%rsp)
+.LVL30:
+.L37:
+	.loc 1 264 5 is_stmt 1 view .LVU123
+	.loc 1 264 25 view .LVU124
+	.loc 1 264 15 is_stmt 0 view .LVU125
+	xorl	%r15d, %r15d
+	.loc 1 264 25 view .LVU126
+	cmpb	$0, rxRuntimeConfig(%rip)
+	leaq	rxRuntimeConfig(%rip), %r12
+	leaq	rcData(%rip), %r13
+	jne	.L39
+	jmp	.L35
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L41:
+.LBB17:
+	.loc 1 267 26 discriminator 2 view .LVU127
+	movw	%bx, 0(%r13,%rbp,2)
+.LBE17:
+	.loc 1 264 61 is_stmt 1 discriminator 2 view .LVU128
+	addl	$1, %r15d
+.LVL32:
+	.loc 1 264 25 discriminator 2 view .LVU129
+	cmpb	(%r12), %r15b
+	jnb	.L35
+.LVL33:
+.L39:
+.LBB22:
+	.loc 1 266 9 view .LVU130
+	.loc 1 266 13 is_stmt 0 view .LVU131
+	movq	rcReadRawFunc(%rip), %rax
+	.loc 1 267 36 view .LVU132
+	movq	rxConfig(%rip), %rcx
+	.loc 1 267 19 view .LVU133
+	movzbl	%r15b, %ebp
+	.loc 1 266 12 view .LVU134
+	testq	%rax, %rax
+	je	.L61
+	.loc 1 271 9 is_stmt 1 view .LVU135
+.LVL34:
+.LBB18:
+.LBI18:
+	.loc 1 180 9 view .LVU136
+.LBB19:
+	.loc 1 182 5 view .LVU137
+	movl	%ebp, %r14d
+	.loc 1 182 8 is_stmt 0 view .LVU138
+	cmpb	$7, %r15b
+	ja	.L42
+	.loc 1 183 9 is_stmt 1 view .LVU139
+	.loc 1 183 26 is_stmt 0 view .LVU140
+	movzbl	%r15b, %edx
+.LBE19:
+.LBE18:
+	.loc 1 274 27 view .LVU141
+	movzbl	(%rcx,%rdx), %r14d
+.L42:
+.LVL35:
+	.loc 1 274 9 is_stmt 1 view .LVU142
+	.loc 1 274 27 is_stmt 0 view .LVU143
+	movq	%r12, %rdi
+	movl	%r14d, %esi
+	call	*%rax
+.LVL36:
+	.loc 1 276 13 view .LVU144
+	movl	$256, %edi
+	.loc 1 274 27 view .LVU145
+	movl	%eax, %ebx
+.LVL37:
+	.loc 1 276 9 is_stmt 1 view .LVU146
+	.loc 1 276 13 is_stmt 0 view .LVU147
+	call	feature@PLT
+.LVL38:
+	.loc 1 276 39 view .LVU148
+	testb	%al, %al
+	je	.L43
+	cmpb	$0, 15(%rsp)
+	je	.L43
+	.loc 1 277 13 is_stmt 1 view .LVU149
+	.loc 1 277 21 is_stmt 0 view .LVU150
+	movq	failsafe(%rip), %rax
+	.loc 1 277 13 view .LVU151
+	movzwl	%bx, %esi
+	movl	%r14d, %edi
+	.loc 1 277 29 view .LVU152
+	movq	(%rax), %rax
+	.loc 1 277 13 view .LVU153
+	call	*56(%rax)
+.LVL39:
+.L43:
+	.loc 1 281 9 is_stmt 1 view .LVU154
+	.loc 1 281 26 is_stmt 0 view .LVU155
+	leal	-750(%rbx), %eax
+	.loc 1 281 12 view .LVU156
+	cmpw	$1500, %ax
+	jbe	.L44
+	.loc 1 282 13 is_stmt 1 view .LVU157
+	.loc 1 282 20 is_stmt 0 view .LVU158
+	movq	rxConfig(%rip), %rax
+	movzwl	10(%rax), %ebx
+.LVL40:
+.L44:
+	.loc 1 284 9 is_stmt 1 view .LVU159
+.LBB20:
+.LBI20:
+	.loc 1 219 12 view .LVU160
+.LBB21:
+	.loc 1 220 5 view .LVU161
+	.loc 1 220 14 is_stmt 0 view .LVU162
+	movl	$8193, %edi
+	call	feature@PLT
+.LVL41:
+.LBE21:
+.LBE20:
+	.loc 1 284 12 view .LVU163
+	testb	%al, %al
+	je	.L41
+	.loc 1 287 13 is_stmt 1 view .LVU164
+	.loc 1 287 28 is_stmt 0 view .LVU165
+	movzwl	%bx, %esi
+	movl	%ebp, %edi
+.LBE22:
+	.loc 1 264 61 view .LVU166
+	addl	$1, %r15d
+.LVL42:
+.LBB23:
+	.loc 1 287 28 view .LVU167
+	call	calculateNonDataDrivenChannel
+.LVL43:
+	movl	%eax, %ebx
+.LVL44:
+	.loc 1 267 26 view .LVU168
+	movw	%bx, 0(%r13,%rbp,2)
+.LBE23:
+	.loc 1 264 61 is_stmt 1 view .LVU169
+.LVL45:
+	.loc 1 264 25 view .LVU170
+	cmpb	(%r12), %r15b
+	jb	.L39
+.LVL46:
+.L35:
+	.loc 1 290 1 is_stmt 0 view .LVU171
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL47:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.cfi_restore_state
+.LBB24:
+	.loc 1 267 13 is_stmt 1 discriminator 1 view .LVU172
+	.loc 1 267 36 is_stmt 0 discriminator 1 view .LVU173
+	movzwl	10(%rcx), %ebx
+	.loc 1 268 13 is_stmt 1 discriminator 1 view .LVU174
+	jmp	.L41
+.LVL48:
+	.p2align 4,,10
+	.p2align 3
+.L36:
+	.loc 1 268 13 is_stmt 0 discriminator 1 view .LVU175
+.LBE24:
+	.loc 1 259 38 discriminator 1 view .LVU176
+	movl	$1, %edi
+	call	feature@PLT
+.LVL49:
+	.loc 1 259 35 discriminator 1 view .LVU177
+	testb	%al, %al
+	je	.L38
+	.loc 1 260 9 is_stmt 1 view .LVU178
+	.loc 1 260 28 is_stmt 0 view .LVU179
+	call	isPPMDataBeingReceived@PLT
+.LVL50:
+	movb	%al, 15(%rsp)
+.LVL51:
+	.loc 1 261 9 is_stmt 1 view .LVU180
+	call	resetPPMDataReceivedState@PLT
+.LVL52:
+	.loc 1 261 9 is_stmt 0 view .LVU181
+	jmp	.L37
+	.cfi_endproc
+.LFE18:
+	.size	processRxChannels, .-processRxChannels
+	.section	.text.processDataDrivenRx,"ax",@progbits
+	.p2align 4
+	.globl	processDataDrivenRx
+	.type	processDataDrivenRx, @function
+processDataDrivenRx:
+.LFB19:
+	.loc 1 293 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 294 5 view .LVU183
+	.loc 1 294 8 is_stmt 0 view .LVU184
+	cmpb	$0, rcDataReceived(%rip)
+	je	.L65
+.LBB27:
+.LBI27:
+	.loc 1 292 6 is_stmt 1 view .LVU185
+.LBB28:
+	.loc 1 298 5 view .LVU186
+.LBE28:
+.LBE27:
+	.loc 1 293 1 is_stmt 0 view .LVU187
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB30:
+.LBB29:
+	.loc 1 298 13 view .LVU188
+	movq	failsafe(%rip), %rax
+	.loc 1 298 21 view .LVU189
+	movq	(%rax), %rax
+	.loc 1 298 5 view .LVU190
+	call	*(%rax)
+.LVL53:
+	.loc 1 300 5 is_stmt 1 view .LVU191
+	call	processRxChannels
+.LVL54:
+	.loc 1 302 5 view .LVU192
+	.loc 1 302 20 is_stmt 0 view .LVU193
+	movb	$0, rcDataReceived(%rip)
+.LBE29:
+.LBE30:
+	.loc 1 303 1 view .LVU194
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L65:
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	processDataDrivenRx, .-processDataDrivenRx
+	.section	.text.processNonDataDrivenRx,"ax",@progbits
+	.p2align 4
+	.globl	processNonDataDrivenRx
+	.type	processNonDataDrivenRx, @function
+processNonDataDrivenRx:
+.LFB20:
+	.loc 1 306 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 307 5 view .LVU196
+	.loc 1 307 18 is_stmt 0 view .LVU197
+	addb	$1, rcSampleIndex(%rip)
+	.loc 1 309 5 is_stmt 1 view .LVU198
+	jmp	processRxChannels
+.LVL55:
+	.cfi_endproc
+.LFE20:
+	.size	processNonDataDrivenRx, .-processNonDataDrivenRx
+	.section	.text.calculateRxChannelsAndUpdateFailsafe,"ax",@progbits
+	.p2align 4
+	.globl	calculateRxChannelsAndUpdateFailsafe
+	.type	calculateRxChannelsAndUpdateFailsafe, @function
+calculateRxChannelsAndUpdateFailsafe:
+.LVL56:
+.LFB21:
+	.loc 1 313 1 view -0
+	.cfi_startproc
+	.loc 1 314 5 view .LVU200
+	.loc 1 314 30 is_stmt 0 view .LVU201
+	addl	$20000, %edi
+.LVL57:
+	.loc 1 313 1 view .LVU202
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 314 30 view .LVU203
+	movl	%edi, rxUpdateAt(%rip)
+	.loc 1 316 5 is_stmt 1 view .LVU204
+	.loc 1 316 9 is_stmt 0 view .LVU205
+	movl	$256, %edi
+.LVL58:
+	.loc 1 316 9 view .LVU206
+	call	feature@PLT
+.LVL59:
+	.loc 1 316 8 view .LVU207
+	testb	%al, %al
+	je	.L70
+	.loc 1 317 9 is_stmt 1 view .LVU208
+	.loc 1 317 17 is_stmt 0 view .LVU209
+	movq	failsafe(%rip), %rax
+	.loc 1 317 25 view .LVU210
+	movq	(%rax), %rax
+	.loc 1 317 9 view .LVU211
+	call	*32(%rax)
+.LVL60:
+.L70:
+	.loc 1 320 5 is_stmt 1 view .LVU212
+.LBB39:
+.LBI39:
+	.loc 1 219 12 view .LVU213
+.LBB40:
+	.loc 1 220 5 view .LVU214
+	.loc 1 220 14 is_stmt 0 view .LVU215
+	movl	$8193, %edi
+	call	feature@PLT
+.LVL61:
+.LBE40:
+.LBE39:
+	.loc 1 320 8 view .LVU216
+	testb	%al, %al
+	jne	.L71
+	.loc 1 321 9 is_stmt 1 view .LVU217
+.LBB41:
+.LBI41:
+	.loc 1 292 6 view .LVU218
+.LBB42:
+	.loc 1 294 5 view .LVU219
+	.loc 1 294 8 is_stmt 0 view .LVU220
+	cmpb	$0, rcDataReceived(%rip)
+	je	.L69
+.LBB43:
+.LBI43:
+	.loc 1 292 6 is_stmt 1 view .LVU221
+.LBB44:
+	.loc 1 298 5 view .LVU222
+	.loc 1 298 13 is_stmt 0 view .LVU223
+	movq	failsafe(%rip), %rax
+	.loc 1 298 21 view .LVU224
+	movq	(%rax), %rax
+	.loc 1 298 5 view .LVU225
+	call	*(%rax)
+.LVL62:
+	.loc 1 300 5 is_stmt 1 view .LVU226
+	call	processRxChannels
+.LVL63:
+	.loc 1 302 5 view .LVU227
+	.loc 1 302 20 is_stmt 0 view .LVU228
+	movb	$0, rcDataReceived(%rip)
+.L69:
+.LBE44:
+.LBE43:
+.LBE42:
+.LBE41:
+	.loc 1 325 1 view .LVU229
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L71:
+	.cfi_restore_state
+	.loc 1 323 9 is_stmt 1 view .LVU230
+.LBB45:
+.LBI45:
+	.loc 1 305 6 view .LVU231
+.LBB46:
+	.loc 1 307 5 view .LVU232
+	.loc 1 307 18 is_stmt 0 view .LVU233
+	addb	$1, rcSampleIndex(%rip)
+	.loc 1 309 5 is_stmt 1 view .LVU234
+.LBE46:
+.LBE45:
+	.loc 1 325 1 is_stmt 0 view .LVU235
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+.LBB48:
+.LBB47:
+	.loc 1 309 5 view .LVU236
+	jmp	processRxChannels
+.LVL64:
+.LBE47:
+.LBE48:
+	.cfi_endproc
+.LFE21:
+	.size	calculateRxChannelsAndUpdateFailsafe, .-calculateRxChannelsAndUpdateFailsafe
+	.section	.text.parseRcChannels,"ax",@progbits
+	.p2align 4
+	.globl	parseRcChannels
+	.type	parseRcChannels, @function
+parseRcChannels:
+.LVL65:
+.LFB22:
+	.loc 1 328 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 329 5 view .LVU238
+	.loc 1 331 5 view .LVU239
+	.loc 1 331 21 view .LVU240
+	.loc 1 328 1 is_stmt 0 view .LVU241
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 331 21 view .LVU242
+	movsbl	(%rdi), %esi
+.LVL66:
+	.loc 1 331 21 view .LVU243
+	testb	%sil, %sil
+	je	.L77
+	movq	%rdi, %rbp
+	.loc 1 331 12 view .LVU244
+	movq	%rdi, %r13
+	leaq	rcChannelLetters(%rip), %rbx
+.LVL67:
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	.loc 1 332 9 is_stmt 1 view .LVU245
+	.loc 1 332 13 is_stmt 0 view .LVU246
+	movq	%rbx, %rdi
+	call	strchr@PLT
+.LVL68:
+	.loc 1 333 9 is_stmt 1 view .LVU247
+	.loc 1 333 12 is_stmt 0 view .LVU248
+	testq	%rax, %rax
+	je	.L79
+	.loc 1 334 13 is_stmt 1 view .LVU249
+	.loc 1 334 55 is_stmt 0 view .LVU250
+	movq	%r13, %rdx
+	.loc 1 334 31 view .LVU251
+	subq	%rbx, %rax
+.LVL69:
+	.loc 1 334 55 view .LVU252
+	subq	%rbp, %rdx
+	.loc 1 334 51 view .LVU253
+	movb	%dl, (%r12,%rax)
+.L79:
+	.loc 1 331 26 is_stmt 1 discriminator 2 view .LVU254
+	.loc 1 331 21 is_stmt 0 discriminator 2 view .LVU255
+	movsbl	1(%r13), %esi
+	.loc 1 331 26 discriminator 2 view .LVU256
+	addq	$1, %r13
+.LVL70:
+	.loc 1 331 21 is_stmt 1 discriminator 2 view .LVU257
+	testb	%sil, %sil
+	jne	.L80
+.LVL71:
+.L77:
+	.loc 1 336 1 is_stmt 0 view .LVU258
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL72:
+	.loc 1 336 1 view .LVU259
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	parseRcChannels, .-parseRcChannels
+	.section	.text.updateRSSIPWM,"ax",@progbits
+	.p2align 4
+	.globl	updateRSSIPWM
+	.type	updateRSSIPWM, @function
+updateRSSIPWM:
+.LFB23:
+	.loc 1 339 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 340 5 view .LVU261
+.LVL73:
+	.loc 1 342 5 view .LVU262
+	.loc 1 346 5 view .LVU263
+	.loc 1 339 1 is_stmt 0 view .LVU264
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 342 30 view .LVU265
+	movq	rxConfig(%rip), %rax
+	.loc 1 346 24 view .LVU266
+	leaq	rcData(%rip), %rdx
+	xorl	%esi, %esi
+	.loc 1 342 30 view .LVU267
+	movzbl	16(%rax), %eax
+	.loc 1 342 45 view .LVU268
+	subl	$1, %eax
+	.loc 1 342 13 view .LVU269
+	cltq
+	.loc 1 346 24 view .LVU270
+	movswl	(%rdx,%rax,2), %edi
+	movl	$1000, %edx
+	subl	$1000, %edi
+	call	constrain@PLT
+.LVL74:
+	.loc 1 346 59 view .LVU271
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	divss	.LC0(%rip), %xmm0
+	.loc 1 346 70 view .LVU272
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 346 12 view .LVU273
+	cvttss2sil	%xmm0, %eax
+	movw	%ax, rssi(%rip)
+	.loc 1 347 1 view .LVU274
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	updateRSSIPWM, .-updateRSSIPWM
+	.section	.text.updateRSSIADC,"ax",@progbits
+	.p2align 4
+	.globl	updateRSSIADC
+	.type	updateRSSIADC, @function
+updateRSSIADC:
+.LVL75:
+.LFB24:
+	.loc 1 353 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 354 5 view .LVU276
+	.loc 1 355 5 view .LVU277
+	.loc 1 356 5 view .LVU278
+	.loc 1 358 5 view .LVU279
+	.loc 1 358 8 is_stmt 0 view .LVU280
+	cmpl	rssiUpdateAt.2(%rip), %edi
+	js	.L94
+.LVL76:
+.LBB51:
+.LBI51:
+	.loc 1 352 6 is_stmt 1 view .LVU281
+.LBB52:
+	.loc 1 361 5 view .LVU282
+	.loc 1 361 32 is_stmt 0 view .LVU283
+	addl	$20000, %edi
+.LVL77:
+	.loc 1 361 32 view .LVU284
+.LBE52:
+.LBE51:
+	.loc 1 353 1 view .LVU285
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+.LBB54:
+.LBB53:
+	.loc 1 361 32 view .LVU286
+	movl	%edi, rssiUpdateAt.2(%rip)
+	.loc 1 363 5 is_stmt 1 view .LVU287
+.LVL78:
+	.loc 1 364 5 view .LVU288
+	.loc 1 364 30 is_stmt 0 view .LVU289
+	movl	$1, %edi
+.LVL79:
+	.loc 1 364 30 view .LVU290
+	call	adcGetChannel@PLT
+.LVL80:
+	.loc 1 365 44 view .LVU291
+	pxor	%xmm0, %xmm0
+	.loc 1 374 38 view .LVU292
+	pxor	%xmm1, %xmm1
+	.loc 1 364 30 view .LVU293
+	movzwl	%ax, %edx
+.LVL81:
+	.loc 1 365 5 is_stmt 1 view .LVU294
+	.loc 1 367 5 view .LVU295
+	.loc 1 367 46 is_stmt 0 view .LVU296
+	movzbl	adcRssiSampleIndex.1(%rip), %eax
+	.loc 1 365 44 view .LVU297
+	cvtsi2ssl	%edx, %xmm0
+	divss	.LC2(%rip), %xmm0
+	.loc 1 365 13 view .LVU298
+	leaq	adcRssiSamples.0(%rip), %rdx
+.LVL82:
+	.loc 1 365 13 view .LVU299
+	cvttss2sil	%xmm0, %ecx
+	.loc 1 367 46 view .LVU300
+	addl	$1, %eax
+	.loc 1 367 51 view .LVU301
+	andl	$15, %eax
+	.loc 1 367 24 view .LVU302
+	movb	%al, adcRssiSampleIndex.1(%rip)
+	.loc 1 369 5 is_stmt 1 view .LVU303
+	.loc 1 369 40 is_stmt 0 view .LVU304
+	cltq
+	.loc 1 365 13 view .LVU305
+	movb	%cl, (%rdx,%rax)
+	.loc 1 371 5 is_stmt 1 view .LVU306
+	.loc 1 373 5 view .LVU307
+.LVL83:
+	.loc 1 373 39 view .LVU308
+	.loc 1 374 9 view .LVU309
+	.loc 1 374 38 is_stmt 0 view .LVU310
+	movdqa	adcRssiSamples.0(%rip), %xmm0
+.LVL84:
+	.loc 1 373 56 is_stmt 1 view .LVU311
+	.loc 1 373 39 view .LVU312
+	.loc 1 379 24 is_stmt 0 view .LVU313
+	movl	$100, %edx
+	.loc 1 374 38 view .LVU314
+	movdqa	%xmm0, %xmm2
+	punpckhbw	%xmm1, %xmm0
+	punpcklbw	%xmm1, %xmm2
+	paddw	%xmm2, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrldq	$8, %xmm1
+	paddw	%xmm1, %xmm0
+	movdqa	%xmm0, %xmm1
+	psrldq	$4, %xmm1
+	paddw	%xmm1, %xmm0
+	.loc 1 377 5 is_stmt 1 view .LVU315
+.LVL85:
+	.loc 1 379 5 view .LVU316
+	.loc 1 377 17 is_stmt 0 view .LVU317
+	movdqa	%xmm0, %xmm1
+	psrldq	$2, %xmm1
+	paddw	%xmm1, %xmm0
+	pextrw	$0, %xmm0, %eax
+	testw	%ax, %ax
+	leal	15(%rax), %edi
+	cmovns	%eax, %edi
+	.loc 1 379 24 view .LVU318
+	xorl	%esi, %esi
+	.loc 1 377 17 view .LVU319
+	sarw	$4, %di
+	.loc 1 379 24 view .LVU320
+	movswl	%di, %edi
+	call	constrain@PLT
+.LVL86:
+	.loc 1 379 55 view .LVU321
+	pxor	%xmm0, %xmm0
+	cvtsi2ssl	%eax, %xmm0
+	divss	.LC3(%rip), %xmm0
+	.loc 1 379 65 view .LVU322
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 379 12 view .LVU323
+	cvttss2sil	%xmm0, %eax
+	movw	%ax, rssi(%rip)
+.LVL87:
+	.loc 1 379 12 view .LVU324
+.LBE53:
+.LBE54:
+	.loc 1 380 1 view .LVU325
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL88:
+	.p2align 4,,10
+	.p2align 3
+.L94:
+	.loc 1 380 1 view .LVU326
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	updateRSSIADC, .-updateRSSIADC
+	.section	.text.updateRSSI,"ax",@progbits
+	.p2align 4
+	.globl	updateRSSI
+	.type	updateRSSI, @function
+updateRSSI:
+.LVL89:
+.LFB25:
+	.loc 1 383 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 385 5 view .LVU328
+	.loc 1 385 17 is_stmt 0 view .LVU329
+	movq	rxConfig(%rip), %rax
+	.loc 1 385 8 view .LVU330
+	cmpb	$0, 16(%rax)
+	je	.L98
+	.loc 1 386 9 is_stmt 1 view .LVU331
+	jmp	updateRSSIPWM
+.LVL90:
+	.p2align 4,,10
+	.p2align 3
+.L98:
+	.loc 1 383 1 is_stmt 0 view .LVU332
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	%edi, %ebx
+	.loc 1 387 12 is_stmt 1 view .LVU333
+	.loc 1 387 16 is_stmt 0 view .LVU334
+	movl	$32768, %edi
+.LVL91:
+	.loc 1 387 16 view .LVU335
+	call	feature@PLT
+.LVL92:
+	.loc 1 387 15 view .LVU336
+	testb	%al, %al
+	jne	.L102
+	.loc 1 390 1 view .LVU337
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+.LVL93:
+	.loc 1 390 1 view .LVU338
+	ret
+.LVL94:
+	.p2align 4,,10
+	.p2align 3
+.L102:
+	.cfi_restore_state
+	.loc 1 388 9 is_stmt 1 view .LVU339
+	movl	%ebx, %edi
+	.loc 1 390 1 is_stmt 0 view .LVU340
+	popq	%rbx
+	.cfi_restore 3
+	.cfi_def_cfa_offset 8
+.LVL95:
+	.loc 1 388 9 view .LVU341
+	jmp	updateRSSIADC
+.LVL96:
+	.loc 1 388 9 view .LVU342
+	.cfi_endproc
+.LFE25:
+	.size	updateRSSI, .-updateRSSI
+	.section	.bss.adcRssiSamples.0,"aw",@nobits
+	.align 16
+	.type	adcRssiSamples.0, @object
+	.size	adcRssiSamples.0, 16
+adcRssiSamples.0:
+	.zero	16
+	.section	.bss.adcRssiSampleIndex.1,"aw",@nobits
+	.type	adcRssiSampleIndex.1, @object
+	.size	adcRssiSampleIndex.1, 1
+adcRssiSampleIndex.1:
+	.zero	1
+	.section	.bss.rssiUpdateAt.2,"aw",@nobits
+	.align 4
+	.type	rssiUpdateAt.2, @object
+	.size	rssiUpdateAt.2, 4
+rssiUpdateAt.2:
+	.zero	4
+	.section	.bss.rcDataMean.3,"aw",@nobits
+	.align 16
+	.type	rcDataMean.3, @object
+	.size	rcDataMean.3, 24
+rcDataMean.3:
+	.zero	24
+	.section	.bss.rxSamplesCollected.4,"aw",@nobits
+	.type	rxSamplesCollected.4, @object
+	.size	rxSamplesCollected.4, 1
+rxSamplesCollected.4:
+	.zero	1
+	.section	.bss.rcSamples.5,"aw",@nobits
+	.align 32
+	.type	rcSamples.5, @object
+	.size	rcSamples.5, 96
+rcSamples.5:
+	.zero	96
+	.section	.bss.rcSampleIndex,"aw",@nobits
+	.type	rcSampleIndex, @object
+	.size	rcSampleIndex, 1
+rcSampleIndex:
+	.zero	1
+	.section	.bss.rxUpdateAt,"aw",@nobits
+	.align 4
+	.type	rxUpdateAt, @object
+	.size	rxUpdateAt, 4
+rxUpdateAt:
+	.zero	4
+	.section	.bss.rcDataReceived,"aw",@nobits
+	.type	rcDataReceived, @object
+	.size	rcDataReceived, 1
+rcDataReceived:
+	.zero	1
+	.section	.bss.failsafe,"aw",@nobits
+	.align 8
+	.type	failsafe, @object
+	.size	failsafe, 8
+failsafe:
+	.zero	8
+	.section	.bss.rxConfig,"aw",@nobits
+	.align 8
+	.type	rxConfig, @object
+	.size	rxConfig, 8
+rxConfig:
+	.zero	8
+	.comm	rxRuntimeConfig,2,1
+	.section	.bss.rcReadRawFunc,"aw",@nobits
+	.align 8
+	.type	rcReadRawFunc, @object
+	.size	rcReadRawFunc, 8
+rcReadRawFunc:
+	.zero	8
+	.comm	rcData,36,32
+	.comm	rssi,2,2
+	.globl	rcChannelLetters
+	.section	.rodata.rcChannelLetters,"a"
+	.align 8
+	.type	rcChannelLetters, @object
+	.size	rcChannelLetters, 9
+rcChannelLetters:
+	.string	"AERT1234"
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1148846080
+	.align 4
+.LC1:
+	.long	1149222912
+	.align 4
+.LC2:
+	.long	1109642445
+	.align 4
+.LC3:
+	.long	1120403456
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/config/config.h"
+	.file 6 ".//src/main/drivers/adc.h"
+	.file 7 ".//src/main/io/serial.h"
+	.file 8 ".//src/main/flight/failsafe.h"
+	.file 9 ".//src/main/rx/rx.h"
+	.file 10 ".//src/main/common/maths.h"
+	.file 11 "/usr/include/string.h"
+	.file 12 ".//src/main/drivers/pwm_rx.h"
+	.file 13 ".//src/main/rx/msp.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xee9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2d
+	.long	.LASF1117
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL33
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF977
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF978
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF979
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF980
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF981
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF982
+	.uleb128 0x5
+	.long	.LASF983
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x5
+	.long	.LASF984
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x77
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF985
+	.uleb128 0x5
+	.long	.LASF986
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x43
+	.uleb128 0x5
+	.long	.LASF987
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF988
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF989
+	.uleb128 0x6
+	.long	0xae
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF990
+	.uleb128 0x13
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF991
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF992
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x5
+	.long	.LASF993
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF994
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x5
+	.long	.LASF995
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF996
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF997
+	.uleb128 0x6
+	.long	0xb5
+	.uleb128 0x1a
+	.long	0x4a
+	.byte	0x5
+	.long	0x197
+	.uleb128 0x3
+	.long	.LASF998
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF999
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1000
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1001
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1002
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1003
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1004
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1005
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF1006
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF1007
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF1008
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF1009
+	.value	0x800
+	.uleb128 0xb
+	.long	.LASF1010
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF1011
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF1012
+	.value	0x4000
+	.uleb128 0xb
+	.long	.LASF1013
+	.value	0x8000
+	.uleb128 0x1b
+	.long	.LASF1014
+	.long	0x10000
+	.uleb128 0x1b
+	.long	.LASF1015
+	.long	0x20000
+	.uleb128 0x1b
+	.long	.LASF1016
+	.long	0x40000
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1017
+	.uleb128 0x6
+	.long	0xd2
+	.uleb128 0x1a
+	.long	0x4a
+	.byte	0x6
+	.long	0x1cc
+	.uleb128 0x3
+	.long	.LASF1018
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1019
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1020
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1021
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1022
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	0x4a
+	.byte	0x7
+	.long	0x207
+	.uleb128 0x3
+	.long	.LASF1023
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1024
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1025
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1026
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1027
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1028
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1029
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1030
+	.byte	0x40
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1042
+	.byte	0x50
+	.byte	0x8
+	.byte	0x1e
+	.long	0x296
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xc
+	.long	0x297
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x8
+	.byte	0x20
+	.byte	0xb
+	.long	0x2ab
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x8
+	.byte	0x21
+	.byte	0xb
+	.long	0x2b5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x8
+	.byte	0x22
+	.byte	0xb
+	.long	0x2b5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1035
+	.byte	0x8
+	.byte	0x23
+	.byte	0xc
+	.long	0x297
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0x8
+	.byte	0x24
+	.byte	0xc
+	.long	0x297
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x8
+	.byte	0x25
+	.byte	0xb
+	.long	0x2b5
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1038
+	.byte	0x8
+	.byte	0x26
+	.byte	0xc
+	.long	0x2ca
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1039
+	.byte	0x8
+	.byte	0x27
+	.byte	0xb
+	.long	0x2b5
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1040
+	.byte	0x8
+	.byte	0x28
+	.byte	0xc
+	.long	0x297
+	.byte	0x48
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x6
+	.long	0x296
+	.uleb128 0x24
+	.long	0x197
+	.long	0x2ab
+	.uleb128 0x4
+	.long	0x197
+	.byte	0
+	.uleb128 0x6
+	.long	0x29c
+	.uleb128 0x30
+	.long	0x197
+	.uleb128 0x6
+	.long	0x2b0
+	.uleb128 0x31
+	.long	0x2ca
+	.uleb128 0x4
+	.long	0xd2
+	.uleb128 0x4
+	.long	0xde
+	.byte	0
+	.uleb128 0x6
+	.long	0x2ba
+	.uleb128 0x5
+	.long	.LASF1041
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x3
+	.long	0x207
+	.uleb128 0x13
+	.long	0x2cf
+	.uleb128 0x14
+	.long	.LASF1043
+	.byte	0x10
+	.byte	0x8
+	.byte	0x2c
+	.long	0x321
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x1d
+	.long	0x321
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1045
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xd
+	.long	0xba
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1046
+	.byte	0x8
+	.byte	0x30
+	.byte	0xd
+	.long	0xba
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1047
+	.byte	0x8
+	.byte	0x31
+	.byte	0x9
+	.long	0x197
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	0x2db
+	.uleb128 0x5
+	.long	.LASF1048
+	.byte	0x8
+	.byte	0x32
+	.byte	0x3
+	.long	0x2e0
+	.uleb128 0xc
+	.long	0xb5
+	.long	0x33d
+	.uleb128 0x32
+	.byte	0
+	.uleb128 0x13
+	.long	0x332
+	.uleb128 0x1c
+	.long	.LASF1049
+	.byte	0x37
+	.byte	0x13
+	.long	0x33d
+	.uleb128 0xc
+	.long	0xba
+	.long	0x35d
+	.uleb128 0xd
+	.long	0x51
+	.byte	0x11
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1050
+	.byte	0x39
+	.byte	0x10
+	.long	0x34d
+	.uleb128 0x14
+	.long	.LASF1051
+	.byte	0x12
+	.byte	0x9
+	.byte	0x3d
+	.long	0x3c3
+	.uleb128 0x2
+	.long	.LASF1052
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0x3c3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1053
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1054
+	.byte	0x9
+	.byte	0x40
+	.byte	0xe
+	.long	0xde
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1055
+	.byte	0x9
+	.byte	0x41
+	.byte	0xe
+	.long	0xde
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1056
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xde
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1057
+	.byte	0x9
+	.byte	0x43
+	.byte	0xd
+	.long	0xd2
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	0xd2
+	.long	0x3d3
+	.uleb128 0xd
+	.long	0x51
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1058
+	.byte	0x9
+	.byte	0x44
+	.byte	0x3
+	.long	0x368
+	.uleb128 0x14
+	.long	.LASF1059
+	.byte	0x2
+	.byte	0x9
+	.byte	0x48
+	.long	0x406
+	.uleb128 0x2
+	.long	.LASF1060
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0xd2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1061
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xd
+	.long	0xd2
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1062
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x3
+	.long	0x3df
+	.uleb128 0x1c
+	.long	.LASF1063
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x406
+	.uleb128 0x5
+	.long	.LASF1064
+	.byte	0x9
+	.byte	0x51
+	.byte	0x14
+	.long	0x429
+	.uleb128 0x6
+	.long	0x42e
+	.uleb128 0x24
+	.long	0xde
+	.long	0x442
+	.uleb128 0x4
+	.long	0x442
+	.uleb128 0x4
+	.long	0xd2
+	.byte	0
+	.uleb128 0x6
+	.long	0x406
+	.uleb128 0xc
+	.long	0xb5
+	.long	0x457
+	.uleb128 0xd
+	.long	0x51
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	0x447
+	.uleb128 0x33
+	.long	0x342
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xc
+	.long	0x457
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcChannelLetters
+	.uleb128 0x34
+	.long	.LASF1065
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xa
+	.long	0xde
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rssi
+	.uleb128 0x25
+	.long	0x35d
+	.byte	0x3f
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcData
+	.uleb128 0x9
+	.long	.LASF1066
+	.byte	0x48
+	.byte	0x19
+	.long	0x41d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcReadRawFunc
+	.uleb128 0x25
+	.long	0x412
+	.byte	0x4a
+	.byte	0x13
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxRuntimeConfig
+	.uleb128 0x9
+	.long	.LASF1067
+	.byte	0x4b
+	.byte	0x14
+	.long	0x4d4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxConfig
+	.uleb128 0x6
+	.long	0x3d3
+	.uleb128 0x9
+	.long	.LASF1068
+	.byte	0x4f
+	.byte	0x14
+	.long	0x4ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	failsafe
+	.uleb128 0x6
+	.long	0x326
+	.uleb128 0x9
+	.long	.LASF1069
+	.byte	0xbc
+	.byte	0xc
+	.long	0x197
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcDataReceived
+	.uleb128 0x9
+	.long	.LASF1070
+	.byte	0xbd
+	.byte	0x11
+	.long	0xea
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxUpdateAt
+	.uleb128 0x9
+	.long	.LASF1071
+	.byte	0xdf
+	.byte	0x10
+	.long	0xd2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcSampleIndex
+	.uleb128 0xf
+	.long	.LASF1072
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xa
+	.long	0xde
+	.long	0x548
+	.uleb128 0x4
+	.long	0xd2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1073
+	.byte	0xa
+	.byte	0x2d
+	.byte	0x5
+	.long	0x35
+	.long	0x568
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x4
+	.long	0x35
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1074
+	.byte	0xb
+	.byte	0xf6
+	.byte	0xe
+	.long	0xa9
+	.long	0x583
+	.uleb128 0x4
+	.long	0x104
+	.uleb128 0x4
+	.long	0x35
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1095
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x6
+	.uleb128 0x26
+	.long	.LASF1075
+	.byte	0xc
+	.byte	0x1e
+	.long	0x197
+	.uleb128 0x26
+	.long	.LASF1076
+	.byte	0xd
+	.byte	0x14
+	.long	0x197
+	.uleb128 0x36
+	.long	.LASF1079
+	.byte	0x1
+	.byte	0x32
+	.byte	0x6
+	.long	0x5b8
+	.uleb128 0x4
+	.long	0x442
+	.uleb128 0x4
+	.long	0x5b8
+	.byte	0
+	.uleb128 0x6
+	.long	0x41d
+	.uleb128 0xf
+	.long	.LASF1077
+	.byte	0x1
+	.byte	0x39
+	.byte	0x5
+	.long	0x197
+	.long	0x5dd
+	.uleb128 0x4
+	.long	0x4d4
+	.uleb128 0x4
+	.long	0x442
+	.uleb128 0x4
+	.long	0x5b8
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1078
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x5
+	.long	0x197
+	.long	0x5f3
+	.uleb128 0x4
+	.long	0xea
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1088
+	.value	0x17e
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x660
+	.uleb128 0x15
+	.long	.LASF1092
+	.value	0x17e
+	.byte	0x1a
+	.long	0xea
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1e
+	.quad	.LVL90
+	.long	0x6fe
+	.uleb128 0x8
+	.quad	.LVL92
+	.long	0x5dd
+	.long	0x64a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x8000
+	.byte	0
+	.uleb128 0x37
+	.quad	.LVL96
+	.long	0x660
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1080
+	.byte	0x1
+	.value	0x160
+	.byte	0x6
+	.byte	0x1
+	.long	0x6ee
+	.uleb128 0x39
+	.long	.LASF1092
+	.byte	0x1
+	.value	0x160
+	.byte	0x1d
+	.long	0xea
+	.uleb128 0x1f
+	.long	.LASF1081
+	.value	0x162
+	.byte	0x14
+	.long	0x6ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	adcRssiSamples.0
+	.uleb128 0x1f
+	.long	.LASF1082
+	.value	0x163
+	.byte	0x14
+	.long	0xd2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	adcRssiSampleIndex.1
+	.uleb128 0x1f
+	.long	.LASF1083
+	.value	0x164
+	.byte	0x15
+	.long	0xea
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rssiUpdateAt.2
+	.uleb128 0x10
+	.long	.LASF1084
+	.value	0x16b
+	.byte	0xd
+	.long	0xba
+	.uleb128 0x10
+	.long	.LASF1085
+	.value	0x16c
+	.byte	0xe
+	.long	0xde
+	.uleb128 0x10
+	.long	.LASF1086
+	.value	0x16d
+	.byte	0xd
+	.long	0xd2
+	.uleb128 0x10
+	.long	.LASF1087
+	.value	0x173
+	.byte	0xd
+	.long	0xd2
+	.byte	0
+	.uleb128 0xc
+	.long	0xd2
+	.long	0x6fe
+	.uleb128 0xd
+	.long	0x51
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1089
+	.value	0x152
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x74a
+	.uleb128 0x20
+	.long	.LASF1090
+	.value	0x154
+	.byte	0xd
+	.long	0xba
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xa
+	.quad	.LVL74
+	.long	0x548
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1091
+	.value	0x147
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7c4
+	.uleb128 0x15
+	.long	.LASF1093
+	.value	0x147
+	.byte	0x22
+	.long	0x104
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x15
+	.long	.LASF1067
+	.value	0x147
+	.byte	0x35
+	.long	0x4d4
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x27
+	.string	"c"
+	.byte	0x11
+	.long	0x104
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x27
+	.string	"s"
+	.byte	0x15
+	.long	0x104
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0xa
+	.quad	.LVL68
+	.long	0x568
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1094
+	.byte	0x1
+	.value	0x138
+	.byte	0x6
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8c6
+	.uleb128 0x15
+	.long	.LASF1092
+	.value	0x138
+	.byte	0x34
+	.long	0xea
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x16
+	.long	0xb53
+	.quad	.LBI39
+	.byte	.LVU213
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.value	0x140
+	.byte	0x9
+	.long	0x832
+	.uleb128 0xa
+	.quad	.LVL61
+	.long	0x5dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2001
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x8cd
+	.quad	.LBI41
+	.byte	.LVU218
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.value	0x141
+	.byte	0x9
+	.long	0x888
+	.uleb128 0x3b
+	.long	0x8cd
+	.quad	.LBI43
+	.byte	.LVU221
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0x1
+	.value	0x124
+	.byte	0x6
+	.uleb128 0x11
+	.quad	.LVL63
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	0x8c6
+	.quad	.LBI45
+	.byte	.LVU231
+	.long	.LLRL19
+	.byte	0x1
+	.value	0x143
+	.byte	0x9
+	.long	0x8b0
+	.uleb128 0x1e
+	.quad	.LVL64
+	.long	0x8d4
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL59
+	.long	0x5dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1096
+	.value	0x131
+	.uleb128 0x28
+	.long	.LASF1097
+	.value	0x124
+	.uleb128 0x29
+	.long	.LASF1098
+	.byte	0xfd
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa82
+	.uleb128 0x21
+	.long	.LASF1099
+	.byte	0xff
+	.long	0xd2
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x20
+	.long	.LASF1100
+	.value	0x101
+	.byte	0x9
+	.long	0x197
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x3d
+	.long	.LLRL12
+	.long	0xa37
+	.uleb128 0x10
+	.long	.LASF1101
+	.value	0x10f
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x20
+	.long	.LASF1102
+	.value	0x112
+	.byte	0x12
+	.long	0xde
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x16
+	.long	0xbef
+	.quad	.LBI18
+	.byte	.LVU136
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.value	0x10f
+	.byte	0x1e
+	.long	0x98c
+	.uleb128 0xe
+	.long	0xc16
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xe
+	.long	0xc0b
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xe
+	.long	0xc00
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x16
+	.long	0xb53
+	.quad	.LBI20
+	.byte	.LVU160
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.value	0x11c
+	.byte	0xd
+	.long	0x9c7
+	.uleb128 0xa
+	.quad	.LVL41
+	.long	0x5dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2001
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.quad	.LVL36
+	.long	0x9e1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL38
+	.long	0x5dd
+	.long	0x9fa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x2a
+	.quad	.LVL39
+	.long	0xa18
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL43
+	.long	0xa82
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL29
+	.long	0x5dd
+	.long	0xa50
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL49
+	.long	0x5dd
+	.long	0xa67
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL50
+	.long	0x58b
+	.uleb128 0x11
+	.quad	.LVL52
+	.long	0x583
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1107
+	.byte	0xe1
+	.byte	0xa
+	.long	0xde
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb2d
+	.uleb128 0x12
+	.long	.LASF1099
+	.byte	0xe1
+	.byte	0x30
+	.long	0xd2
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x12
+	.long	.LASF1102
+	.byte	0xe1
+	.byte	0x3f
+	.long	0xde
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.long	.LASF1103
+	.byte	0xe3
+	.byte	0x14
+	.long	0xb2d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcSamples.5
+	.uleb128 0x9
+	.long	.LASF1104
+	.byte	0xe4
+	.byte	0x14
+	.long	0xb43
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcDataMean.3
+	.uleb128 0x9
+	.long	.LASF1105
+	.byte	0xe5
+	.byte	0x10
+	.long	0x197
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxSamplesCollected.4
+	.uleb128 0x21
+	.long	.LASF1106
+	.byte	0xe7
+	.long	0xd2
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x21
+	.long	.LASF1087
+	.byte	0xf6
+	.long	0xd2
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0xc
+	.long	0xba
+	.long	0xb43
+	.uleb128 0xd
+	.long	0x51
+	.byte	0xb
+	.uleb128 0xd
+	.long	0x51
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0xba
+	.long	0xb53
+	.uleb128 0xd
+	.long	0x51
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1118
+	.byte	0x1
+	.byte	0xdb
+	.byte	0xc
+	.long	0x197
+	.byte	0x1
+	.uleb128 0x2b
+	.long	.LASF1108
+	.byte	0xd6
+	.byte	0x5
+	.long	0x197
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb95
+	.uleb128 0x12
+	.long	.LASF1092
+	.byte	0xd6
+	.byte	0x1e
+	.long	0xea
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1119
+	.byte	0x1
+	.byte	0xc0
+	.byte	0x6
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbef
+	.uleb128 0x8
+	.quad	.LVL17
+	.long	0x5dd
+	.long	0xbcc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4000
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL18
+	.long	0x596
+	.uleb128 0xa
+	.quad	.LVL19
+	.long	0x5dd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.long	.LASF1109
+	.byte	0x1
+	.byte	0xb4
+	.byte	0x9
+	.long	0xd2
+	.byte	0x1
+	.long	0xc22
+	.uleb128 0x17
+	.long	.LASF1110
+	.byte	0xb4
+	.byte	0x2c
+	.long	0x19e
+	.uleb128 0x17
+	.long	.LASF1111
+	.byte	0xb4
+	.byte	0x40
+	.long	0xd2
+	.uleb128 0x17
+	.long	.LASF1112
+	.byte	0xb4
+	.byte	0x5e
+	.long	0xd2
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1113
+	.byte	0x6d
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd4d
+	.uleb128 0x12
+	.long	.LASF1067
+	.byte	0x6d
+	.byte	0x19
+	.long	0x4d4
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x12
+	.long	.LASF1114
+	.byte	0x6d
+	.byte	0x2f
+	.long	0x4ee
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x41
+	.string	"i"
+	.byte	0x1
+	.byte	0x6f
+	.byte	0xd
+	.long	0xd2
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x42
+	.long	0xd4d
+	.quad	.LBI15
+	.byte	.LVU7
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.byte	0x1
+	.byte	0x70
+	.byte	0x5
+	.long	0xca9
+	.uleb128 0xe
+	.long	0xd5a
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL7
+	.long	0x5dd
+	.long	0xcc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4000
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL8
+	.long	0x5dd
+	.long	0xcd9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL9
+	.long	0x5dd
+	.long	0xcf2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x2000
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL10
+	.long	0x5a1
+	.long	0xd1e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxRuntimeConfig
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcReadRawFunc
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL13
+	.long	0x5bd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rxRuntimeConfig
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcReadRawFunc
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1115
+	.byte	0x1
+	.byte	0x51
+	.byte	0x6
+	.byte	0x1
+	.long	0xd66
+	.uleb128 0x17
+	.long	.LASF1116
+	.byte	0x51
+	.byte	0x1e
+	.long	0x4d4
+	.byte	0
+	.uleb128 0x22
+	.long	0xd4d
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd89
+	.uleb128 0x23
+	.long	0xd5a
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x22
+	.long	0xbef
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdc0
+	.uleb128 0x23
+	.long	0xc00
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x23
+	.long	0xc0b
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0xe
+	.long	0xc16
+	.long	.LLST4
+	.long	.LVUS4
+	.byte	0
+	.uleb128 0x44
+	.long	0x8cd
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdfe
+	.uleb128 0x2c
+	.long	0x8cd
+	.quad	.LBI27
+	.byte	.LVU185
+	.long	.LLRL17
+	.value	0x124
+	.uleb128 0x11
+	.quad	.LVL54
+	.long	0x8d4
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x8c6
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe27
+	.uleb128 0x1e
+	.quad	.LVL55
+	.long	0x8d4
+	.byte	0
+	.uleb128 0x45
+	.long	0x660
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xe
+	.long	0x66e
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x18
+	.long	0x6bd
+	.uleb128 0x18
+	.long	0x6c9
+	.uleb128 0x18
+	.long	0x6d5
+	.uleb128 0x18
+	.long	0x6e1
+	.uleb128 0x2c
+	.long	0x660
+	.quad	.LBI51
+	.byte	.LVU281
+	.long	.LLRL26
+	.value	0x160
+	.uleb128 0xe
+	.long	0x66e
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x46
+	.long	.LLRL26
+	.uleb128 0x19
+	.long	0x6bd
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x19
+	.long	0x6c9
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x19
+	.long	0x6d5
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.long	0x6e1
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.quad	.LVL80
+	.long	0x532
+	.long	0xed0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xa
+	.quad	.LVL86
+	.long	0x548
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 329
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 6
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 .LVU338
+	.uleb128 .LVU338
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU341
+	.uleb128 .LVU341
+	.uleb128 .LVU342
+	.uleb128 .LVU342
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL89
+	.byte	0x4
+	.uleb128 .LVL89-.LVL89
+	.uleb128 .LVL90-1-.LVL89
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-1-.LVL89
+	.uleb128 .LVL90-.LVL89
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL89
+	.uleb128 .LVL91-.LVL89
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL91-.LVL89
+	.uleb128 .LVL93-.LVL89
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL93-.LVL89
+	.uleb128 .LVL94-.LVL89
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-.LVL89
+	.uleb128 .LVL95-.LVL89
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL95-.LVL89
+	.uleb128 .LVL96-1-.LVL89
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL96-1-.LVL89
+	.uleb128 .LFE25-.LVL89
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU262
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU271
+.LLST24:
+	.byte	0x6
+	.quad	.LVL73
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL73-.LVL73
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.LVL73
+	.uleb128 .LVL74-1-.LVL73
+	.uleb128 0x25
+	.byte	0x3
+	.quad	rxConfig
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x10
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x1c
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	rcData
+	.byte	0x22
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL65
+	.byte	0x4
+	.uleb128 .LVL65-.LVL65
+	.uleb128 .LVL67-.LVL65
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.LVL65
+	.uleb128 .LVL71-.LVL65
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL71-.LVL65
+	.uleb128 .LFE22-.LVL65
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 0
+.LLST21:
+	.byte	0x6
+	.quad	.LVL65
+	.byte	0x4
+	.uleb128 .LVL65-.LVL65
+	.uleb128 .LVL66-.LVL65
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.LVL65
+	.uleb128 .LVL72-.LVL65
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL72-.LVL65
+	.uleb128 .LFE22-.LVL65
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU240
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 .LVU258
+.LLST22:
+	.byte	0x6
+	.quad	.LVL65
+	.byte	0x4
+	.uleb128 .LVL65-.LVL65
+	.uleb128 .LVL67-.LVL65
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.LVL65
+	.uleb128 .LVL71-.LVL65
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU247
+	.uleb128 .LVU252
+.LLST23:
+	.byte	0x8
+	.quad	.LVL68
+	.uleb128 .LVL69-.LVL68
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU202
+	.uleb128 .LVU202
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 0
+.LLST18:
+	.byte	0x6
+	.quad	.LVL56
+	.byte	0x4
+	.uleb128 .LVL56-.LVL56
+	.uleb128 .LVL57-.LVL56
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL57-.LVL56
+	.uleb128 .LVL58-.LVL56
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 -20000
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.LVL56
+	.uleb128 .LVL59-1-.LVL56
+	.uleb128 0x10
+	.byte	0x3
+	.quad	rxUpdateAt
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x4e20
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-1-.LVL56
+	.uleb128 .LFE21-.LVL56
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU124
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU171
+	.uleb128 .LVU172
+	.uleb128 .LVU175
+.LLST10:
+	.byte	0x6
+	.quad	.LVL30
+	.byte	0x4
+	.uleb128 .LVL30-.LVL30
+	.uleb128 .LVL31-.LVL30
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL30
+	.uleb128 .LVL42-.LVL30
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL30
+	.uleb128 .LVL45-.LVL30
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL45-.LVL30
+	.uleb128 .LVL46-.LVL30
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL30
+	.uleb128 .LVL48-.LVL30
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU116
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU180
+	.uleb128 .LVU180
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL30-.LVL28
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.LVL28
+	.uleb128 .LVL48-.LVL28
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0x4
+	.uleb128 .LVL48-.LVL28
+	.uleb128 .LVL51-.LVL28
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.LVL28
+	.uleb128 .LVL52-1-.LVL28
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-1-.LVL28
+	.uleb128 .LFE18-.LVL28
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -65
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU168
+.LLST13:
+	.byte	0x6
+	.quad	.LVL37
+	.byte	0x4
+	.uleb128 .LVL37-.LVL37
+	.uleb128 .LVL38-1-.LVL37
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL38-1-.LVL37
+	.uleb128 .LVL44-.LVL37
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+.LLST14:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+.LLST15:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x2
+	.byte	0x38
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU136
+	.uleb128 .LVU142
+.LLST16:
+	.byte	0x8
+	.quad	.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL27-.LVL23
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.LVL23
+	.uleb128 .LFE17-.LVL23
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU111
+	.uleb128 .LVU111
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL23
+	.byte	0x4
+	.uleb128 .LVL23-.LVL23
+	.uleb128 .LVL26-.LVL23
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.LVL23
+	.uleb128 .LFE17-.LVL23
+	.uleb128 0x15
+	.byte	0x78
+	.sleb128 0
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x72
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x22
+	.byte	0x31
+	.byte	0x24
+	.byte	0x3
+	.quad	rcSamples.5
+	.byte	0x22
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU88
+	.uleb128 0
+.LLST8:
+	.byte	0x8
+	.quad	.LVL24
+	.uleb128 .LFE17-.LVL24
+	.uleb128 0x5
+	.byte	0x78
+	.sleb128 0
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU102
+	.uleb128 .LVU103
+.LLST9:
+	.byte	0x8
+	.quad	.LVL25
+	.uleb128 .LVL25-.LVL25
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL21
+	.byte	0x4
+	.uleb128 .LVL21-.LVL21
+	.uleb128 .LVL22-.LVL21
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-.LVL21
+	.uleb128 .LFE15-.LVL21
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL6-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL1
+	.uleb128 .LVL11-.LVL1
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL11-.LVL1
+	.uleb128 .LVL12-.LVL1
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL1
+	.uleb128 .LFE12-.LVL1
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL7-1-.LVL1
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL7-1-.LVL1
+	.uleb128 .LFE12-.LVL1
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU12
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU20
+.LLST2:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL2
+	.uleb128 .LVL4-.LVL2
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rcData
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL2
+	.uleb128 .LVL5-.LVL2
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rcData+2
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU7
+	.uleb128 .LVU10
+.LLST3:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL15-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-.LVL14
+	.uleb128 .LVL16-.LVL14
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL16-.LVL14
+	.uleb128 .LFE13-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST25:
+	.byte	0x6
+	.quad	.LVL75
+	.byte	0x4
+	.uleb128 .LVL75-.LVL75
+	.uleb128 .LVL77-.LVL75
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.LVL75
+	.uleb128 .LVL79-.LVL75
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 -20000
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL75
+	.uleb128 .LVL80-1-.LVL75
+	.uleb128 0x10
+	.byte	0x3
+	.quad	rssiUpdateAt.2
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x4e20
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-1-.LVL75
+	.uleb128 .LVL88-.LVL75
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL88-.LVL75
+	.uleb128 .LFE24-.LVL75
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU281
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 .LVU324
+.LLST27:
+	.byte	0x6
+	.quad	.LVL76
+	.byte	0x4
+	.uleb128 .LVL76-.LVL76
+	.uleb128 .LVL77-.LVL76
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL77-.LVL76
+	.uleb128 .LVL79-.LVL76
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 -20000
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.LVL76
+	.uleb128 .LVL80-1-.LVL76
+	.uleb128 0x10
+	.byte	0x3
+	.quad	rssiUpdateAt.2
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x4e20
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-1-.LVL76
+	.uleb128 .LVL87-.LVL76
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU288
+	.uleb128 .LVU309
+.LLST28:
+	.byte	0x8
+	.quad	.LVL78
+	.uleb128 .LVL83-.LVL78
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU294
+	.uleb128 .LVU299
+.LLST29:
+	.byte	0x8
+	.quad	.LVL81
+	.uleb128 .LVL82-.LVL81
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU295
+	.uleb128 .LVU299
+.LLST30:
+	.byte	0x8
+	.quad	.LVL81
+	.uleb128 .LVL82-.LVL81
+	.uleb128 0x17
+	.byte	0x71
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x4223cccd
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0x3c
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU308
+	.uleb128 .LVU309
+.LLST31:
+	.byte	0x8
+	.quad	.LVL83
+	.uleb128 .LVL83-.LVL83
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0xfc
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB17
+	.byte	0x4
+	.uleb128 .LBB17-.LBB17
+	.uleb128 .LBE17-.LBB17
+	.byte	0x4
+	.uleb128 .LBB22-.LBB17
+	.uleb128 .LBE22-.LBB17
+	.byte	0x4
+	.uleb128 .LBB23-.LBB17
+	.uleb128 .LBE23-.LBB17
+	.byte	0x4
+	.uleb128 .LBB24-.LBB17
+	.uleb128 .LBE24-.LBB17
+	.byte	0
+.LLRL17:
+	.byte	0x5
+	.quad	.LBB27
+	.byte	0x4
+	.uleb128 .LBB27-.LBB27
+	.uleb128 .LBE27-.LBB27
+	.byte	0x4
+	.uleb128 .LBB30-.LBB27
+	.uleb128 .LBE30-.LBB27
+	.byte	0
+.LLRL19:
+	.byte	0x5
+	.quad	.LBB45
+	.byte	0x4
+	.uleb128 .LBB45-.LBB45
+	.uleb128 .LBE45-.LBB45
+	.byte	0x4
+	.uleb128 .LBB48-.LBB45
+	.uleb128 .LBE48-.LBB45
+	.byte	0
+.LLRL26:
+	.byte	0x5
+	.quad	.LBB51
+	.byte	0x4
+	.uleb128 .LBB51-.LBB51
+	.uleb128 .LBE51-.LBB51
+	.byte	0x4
+	.uleb128 .LBB54-.LBB51
+	.uleb128 .LBE54-.LBB51
+	.byte	0
+.LLRL33:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB22
+	.uleb128 .LFE22-.LFB22
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 30 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 36 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 41 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF903
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF904
+	.byte	0x4
+	.byte	0x4
+	.file 63 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 64 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x40
+	.file 65 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 66 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x4
+	.file 67 ".//src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x43
+	.file 68 ".//src/main/common/ring_buffer.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF943
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF944
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x4
+	.file 69 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 70 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF953
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x4
+	.file 71 ".//src/main/rx/pwm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 ".//src/main/rx/sbus.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x48
+	.byte	0x4
+	.file 73 ".//src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x49
+	.byte	0x4
+	.file 74 ".//src/main/rx/sumd.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 ".//src/main/rx/sumh.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF976
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF915
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.21a8e51ff4e49de8dae92488305a5e6a,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF942
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial.h.58.47030f37f24ffc56ce34354987bbd5f1,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF947
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF952
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rx.h.20.b229c7600607cdac8bf93320bea4cdcd,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF969
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF971:
+	.string	"PULSE_MIN 750"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1115:
+	.string	"useRxConfig"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1109:
+	.string	"calculateChannelRemapping"
+.LASF1084:
+	.string	"adcRssiMean"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1001:
+	.string	"FEATURE_RX_SERIAL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF998:
+	.string	"FEATURE_RX_PPM"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF992:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1025:
+	.string	"FUNCTION_CLI"
+.LASF966:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1091:
+	.string	"parseRcChannels"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF918:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF991:
+	.string	"int16_t"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF952:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF1053:
+	.string	"serialrx_provider"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF956:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF922:
+	.string	"USE_GYRO_SITL "
+.LASF810:
+	.string	"__id_t_defined "
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF912:
+	.string	"__enable_irq() "
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1082:
+	.string	"adcRssiSampleIndex"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF964:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT (18)"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1015:
+	.string	"FEATURE_DISPLAY"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1086:
+	.string	"rssiPercentage"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1027:
+	.string	"FUNCTION_SERIAL_RX"
+.LASF1062:
+	.string	"rxRuntimeConfig_t"
+.LASF1070:
+	.string	"rxUpdateAt"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF904:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF938:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF733:
+	.string	"NULL"
+.LASF914:
+	.string	"U_ID_1 0"
+.LASF1107:
+	.string	"calculateNonDataDrivenChannel"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1007:
+	.string	"FEATURE_SONAR"
+.LASF1034:
+	.string	"shouldHaveCausedLandingByNow"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1011:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF967:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1080:
+	.string	"updateRSSIADC"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF924:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1008:
+	.string	"FEATURE_TELEMETRY"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF989:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1018:
+	.string	"ADC_BATTERY"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF909:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF939:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1042:
+	.string	"failsafeVTable_s"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF906:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1030:
+	.string	"FUNCTION_BLACKBOX"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF960:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF714:
+	.string	"__need_size_t"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF953:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1014:
+	.string	"FEATURE_LED_STRIP"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1118:
+	.string	"isRxDataDriven"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1111:
+	.string	"channelMapEntryCount"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1019:
+	.string	"ADC_RSSI"
+.LASF982:
+	.string	"signed char"
+.LASF1003:
+	.string	"FEATURE_SERVO_TILT"
+.LASF993:
+	.string	"uint8_t"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1057:
+	.string	"rssi_channel"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1100:
+	.string	"shouldCheckPulse"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1036:
+	.string	"updateState"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF930:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF978:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1026:
+	.string	"FUNCTION_TELEMETRY"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF931:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF903:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1063:
+	.string	"rxRuntimeConfig"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF1043:
+	.string	"failsafe_s"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1017:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1110:
+	.string	"channelMap"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1073:
+	.string	"constrain"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1099:
+	.string	"chan"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1005:
+	.string	"FEATURE_GPS"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF373:
+	.string	"linux 1"
+.LASF1009:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1079:
+	.string	"rxPwmInit"
+.LASF1078:
+	.string	"feature"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF693:
+	.string	"__need_size_t "
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1000:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1101:
+	.string	"rawChannel"
+.LASF986:
+	.string	"__uint16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF919:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF974:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF696:
+	.string	"__size_t__ "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1055:
+	.string	"mincheck"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF940:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1032:
+	.string	"shouldForceLanding"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF371:
+	.string	"__linux 1"
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1102:
+	.string	"sample"
+.LASF910:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF948:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF961:
+	.string	"SERIALRX_PROVIDER_COUNT (SERIALRX_PROVIDER_MAX + 1)"
+.LASF1093:
+	.string	"input"
+.LASF1088:
+	.string	"updateRSSI"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF962:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1108:
+	.string	"shouldProcessRx"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF390:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF983:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF920:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF1067:
+	.string	"rxConfig"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF947:
+	.string	"SERIAL_PORT_IDENTIFIER_COUNT 5"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1038:
+	.string	"checkPulse"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1002:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1074:
+	.string	"strchr"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF949:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF1114:
+	.string	"initialFailsafe"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1047:
+	.string	"enabled"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF915:
+	.string	"U_ID_2 0"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF973:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1059:
+	.string	"rxRuntimeConfig_s"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF925:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF929:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1098:
+	.string	"processRxChannels"
+.LASF945:
+	.string	"SERIAL_PORT_SCENARIO_COUNT 10"
+.LASF1113:
+	.string	"rxInit"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1066:
+	.string	"rcReadRawFunc"
+.LASF1010:
+	.string	"FEATURE_3D"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1004:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF970:
+	.string	"PPM_AND_PWM_SAMPLE_COUNT 4"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF988:
+	.string	"__uint32_t"
+.LASF936:
+	.string	"M_PI 3.14159265358979323846f"
+.LASF1049:
+	.string	"rcChannelLetters"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF996:
+	.string	"long long int"
+.LASF905:
+	.string	"_STRINGS_H 1"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1033:
+	.string	"hasTimerElapsed"
+.LASF1045:
+	.string	"counter"
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1071:
+	.string	"rcSampleIndex"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1012:
+	.string	"FEATURE_RX_MSP"
+.LASF944:
+	.string	"ADC_CHANNEL_COUNT (ADC_CHANNEL_MAX + 1)"
+.LASF462:
+	.string	"__PMT"
+.LASF976:
+	.string	"RSSI_SCALE (0xFFF / 100.0f)"
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF946:
+	.string	"SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1104:
+	.string	"rcDataMean"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1052:
+	.string	"rcmap"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1035:
+	.string	"incrementCounter"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF980:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF958:
+	.string	"DEFAULT_SERVO_MIN 1020"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF963:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF907:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1023:
+	.string	"FUNCTION_NONE"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF899:
+	.string	"alloca"
+.LASF959:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1097:
+	.string	"processDataDrivenRx"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF392:
+	.string	"false 0"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF927:
+	.string	"USE_USART1 "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF969:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF923:
+	.string	"ACC "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1013:
+	.string	"FEATURE_RSSI_ADC"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1105:
+	.string	"rxSamplesCollected"
+.LASF935:
+	.string	"sq(x) ((x)*(x))"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF933:
+	.string	"PROFILING "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1116:
+	.string	"rxConfigToUse"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF950:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF990:
+	.string	"char"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF1006:
+	.string	"FEATURE_FAILSAFE"
+.LASF965:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF917:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1085:
+	.string	"adcRssiSample"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF979:
+	.string	"short unsigned int"
+.LASF1081:
+	.string	"adcRssiSamples"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF932:
+	.string	"BLACKBOX "
+.LASF1096:
+	.string	"processNonDataDrivenRx"
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF921:
+	.string	"GYRO "
+.LASF911:
+	.string	"__disable_irq() "
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1039:
+	.string	"isEnabled"
+.LASF1054:
+	.string	"midrc"
+.LASF1106:
+	.string	"currentSampleIndex"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF1040:
+	.string	"enable"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF928:
+	.string	"USE_USART2 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF972:
+	.string	"PULSE_MAX 2250"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1048:
+	.string	"failsafe_t"
+.LASF1069:
+	.string	"rcDataReceived"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF997:
+	.string	"long long unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1112:
+	.string	"channelToRemap"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF994:
+	.string	"uint16_t"
+.LASF1072:
+	.string	"adcGetChannel"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF916:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1056:
+	.string	"maxcheck"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF999:
+	.string	"FEATURE_VBAT"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1117:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF735:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1041:
+	.string	"failsafeVTable_t"
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF984:
+	.string	"__int16_t"
+.LASF957:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF902:
+	.string	"_STRING_H 1"
+.LASF1020:
+	.string	"ADC_EXTERNAL1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1061:
+	.string	"auxChannelCount"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1119:
+	.string	"updateRx"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF808:
+	.string	"__off_t_defined "
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1051:
+	.string	"rxConfig_s"
+.LASF934:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1022:
+	.string	"ADC_CHANNEL_MAX"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1076:
+	.string	"rxMspFrameComplete"
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF954:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF1089:
+	.string	"updateRSSIPWM"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1031:
+	.string	"reset"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF968:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF1037:
+	.string	"isIdle"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1083:
+	.string	"rssiUpdateAt"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1016:
+	.string	"FEATURE_BLACKBOX"
+.LASF943:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF926:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF942:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF985:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1075:
+	.string	"isPPMDataBeingReceived"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF955:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF913:
+	.string	"U_ID_0 0x5349544c"
+.LASF1087:
+	.string	"sampleIndex"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1092:
+	.string	"currentTime"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF1068:
+	.string	"failsafe"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF975:
+	.string	"RSSI_ADC_SAMPLE_COUNT 16"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1077:
+	.string	"rxMspInit"
+.LASF1095:
+	.string	"resetPPMDataReceivedState"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF1024:
+	.string	"FUNCTION_MSP"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF995:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF1050:
+	.string	"rcData"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1090:
+	.string	"pwmRssi"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF977:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1064:
+	.string	"rcReadRawDataPtr"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1058:
+	.string	"rxConfig_t"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1103:
+	.string	"rcSamples"
+.LASF1021:
+	.string	"ADC_CURRENT"
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1060:
+	.string	"channelCount"
+.LASF987:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF951:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1044:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1029:
+	.string	"FUNCTION_GPS_PASSTHROUGH"
+.LASF941:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1065:
+	.string	"rssi"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1046:
+	.string	"events"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1028:
+	.string	"FUNCTION_GPS"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF937:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF981:
+	.string	"long unsigned int"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF908:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF1094:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/rx/rx.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10259 @@
+	.file	"barometer.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/sensors/barometer.c"
+	.section	.text.useBarometerConfig,"ax",@progbits
+	.p2align 4
+	.globl	useBarometerConfig
+	.type	useBarometerConfig, @function
+useBarometerConfig:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/sensors/barometer.c"
+	.loc 1 56 1 view -0
+	.cfi_startproc
+	.loc 1 57 5 view .LVU1
+	.loc 1 57 21 is_stmt 0 view .LVU2
+	movq	%rdi, barometerConfig(%rip)
+	.loc 1 58 1 view .LVU3
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	useBarometerConfig, .-useBarometerConfig
+	.section	.text.isBaroCalibrationComplete,"ax",@progbits
+	.p2align 4
+	.globl	isBaroCalibrationComplete
+	.type	isBaroCalibrationComplete, @function
+isBaroCalibrationComplete:
+.LFB12:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU5
+	.loc 1 62 25 is_stmt 0 view .LVU6
+	cmpw	$0, calibratingB(%rip)
+	sete	%al
+	.loc 1 63 1 view .LVU7
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	isBaroCalibrationComplete, .-isBaroCalibrationComplete
+	.section	.text.baroSetCalibrationCycles,"ax",@progbits
+	.p2align 4
+	.globl	baroSetCalibrationCycles
+	.type	baroSetCalibrationCycles, @function
+baroSetCalibrationCycles:
+.LVL1:
+.LFB13:
+	.loc 1 66 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 67 5 view .LVU9
+	.loc 1 67 18 is_stmt 0 view .LVU10
+	movw	%di, calibratingB(%rip)
+	.loc 1 68 5 is_stmt 1 view .LVU11
+	.loc 1 68 33 is_stmt 0 view .LVU12
+	movb	$0, checkingKnownGroundPressure(%rip)
+	.loc 1 69 5 is_stmt 1 view .LVU13
+	.loc 1 69 21 is_stmt 0 view .LVU14
+	movb	$0, bootCalibration(%rip)
+	.loc 1 70 1 view .LVU15
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	baroSetCalibrationCycles, .-baroSetCalibrationCycles
+	.section	.text.baroStartBootCalibration,"ax",@progbits
+	.p2align 4
+	.globl	baroStartBootCalibration
+	.type	baroStartBootCalibration, @function
+baroStartBootCalibration:
+.LVL2:
+.LFB14:
+	.loc 1 78 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 79 5 view .LVU17
+	.loc 1 79 18 is_stmt 0 view .LVU18
+	movq	%rdi, knownSensors(%rip)
+	.loc 1 81 5 is_stmt 1 view .LVU19
+.LBB6:
+.LBB7:
+	.loc 1 68 33 is_stmt 0 view .LVU20
+	xorl	%edx, %edx
+	.loc 1 67 18 view .LVU21
+	movl	$200, %eax
+.LBE7:
+.LBE6:
+	.loc 1 81 8 view .LVU22
+	testb	$4, 3(%rdi)
+	je	.L6
+	.loc 1 81 50 discriminator 1 view .LVU23
+	movzbl	baroHardware(%rip), %ecx
+	cmpb	%cl, 2(%rdi)
+	je	.L9
+.L6:
+	movb	%dl, checkingKnownGroundPressure(%rip)
+	movw	%ax, calibratingB(%rip)
+	.loc 1 88 5 is_stmt 1 view .LVU24
+	.loc 1 88 21 is_stmt 0 view .LVU25
+	movb	$1, bootCalibration(%rip)
+	.loc 1 89 1 view .LVU26
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L9:
+	.loc 1 82 9 is_stmt 1 view .LVU27
+.LVL3:
+.LBB8:
+.LBI8:
+	.loc 1 65 6 view .LVU28
+.LBB9:
+	.loc 1 67 5 view .LVU29
+	.loc 1 68 5 view .LVU30
+	.loc 1 69 5 view .LVU31
+	.loc 1 69 5 is_stmt 0 view .LVU32
+.LBE9:
+.LBE8:
+	.loc 1 83 9 is_stmt 1 view .LVU33
+	.loc 1 83 63 is_stmt 0 view .LVU34
+	movl	12(%rdi), %eax
+	.loc 1 84 37 view .LVU35
+	movl	$1, %edx
+	.loc 1 83 63 view .LVU36
+	sall	$3, %eax
+	.loc 1 83 28 view .LVU37
+	movl	%eax, baroGroundPressure(%rip)
+	.loc 1 84 9 is_stmt 1 view .LVU38
+.LBB11:
+.LBB10:
+	.loc 1 67 18 is_stmt 0 view .LVU39
+	movl	$40, %eax
+.LBE10:
+.LBE11:
+	.loc 1 84 37 view .LVU40
+	jmp	.L6
+	.cfi_endproc
+.LFE14:
+	.size	baroStartBootCalibration, .-baroStartBootCalibration
+	.section	.text.isBaroReady,"ax",@progbits
+	.p2align 4
+	.globl	isBaroReady
+	.type	isBaroReady, @function
+isBaroReady:
+.LFB16:
+	.loc 1 126 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 2 view .LVU42
+	.loc 1 128 1 is_stmt 0 view .LVU43
+	movzbl	baroReady(%rip), %eax
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	isBaroReady, .-isBaroReady
+	.section	.text.baroUpdate,"ax",@progbits
+	.p2align 4
+	.globl	baroUpdate
+	.type	baroUpdate, @function
+baroUpdate:
+.LVL4:
+.LFB17:
+	.loc 1 131 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 132 5 view .LVU45
+	.loc 1 133 5 view .LVU46
+	.loc 1 135 5 view .LVU47
+	.loc 1 135 8 is_stmt 0 view .LVU48
+	cmpl	baroDeadline.3(%rip), %edi
+	js	.L17
+	.loc 1 138 5 is_stmt 1 view .LVU49
+	.loc 1 131 1 is_stmt 0 view .LVU50
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 140 5 view .LVU51
+	movl	state.2(%rip), %eax
+	.loc 1 138 18 view .LVU52
+	movl	%edi, baroDeadline.3(%rip)
+	.loc 1 140 5 is_stmt 1 view .LVU53
+	cmpl	$1, %eax
+	je	.L13
+	cmpl	$2, %eax
+	je	.L14
+	testl	%eax, %eax
+	je	.L20
+	.loc 1 161 1 is_stmt 0 view .LVU54
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 161 1 view .LVU55
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L20:
+	.cfi_def_cfa_offset 16
+	.loc 1 142 13 is_stmt 1 view .LVU56
+	call	*16+baro(%rip)
+.LVL5:
+	.loc 1 143 13 view .LVU57
+	call	*24+baro(%rip)
+.LVL6:
+	.loc 1 144 13 view .LVU58
+	.loc 1 145 33 is_stmt 0 view .LVU59
+	movzwl	2+baro(%rip), %eax
+	.loc 1 144 19 view .LVU60
+	movl	$1, state.2(%rip)
+	.loc 1 145 13 is_stmt 1 view .LVU61
+	.loc 1 145 26 is_stmt 0 view .LVU62
+	addl	%eax, baroDeadline.3(%rip)
+	.loc 1 146 9 is_stmt 1 view .LVU63
+	.loc 1 161 1 is_stmt 0 view .LVU64
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL7:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+	.loc 1 157 13 is_stmt 1 view .LVU65
+	.loc 1 158 72 is_stmt 0 view .LVU66
+	movq	barometerConfig(%rip), %rsi
+.LBB14:
+.LBB15:
+	.loc 1 102 43 view .LVU67
+	movslq	currentSampleIndex.1(%rip), %rdx
+.LBE15:
+.LBE14:
+	.loc 1 157 19 view .LVU68
+	movl	$0, state.2(%rip)
+	.loc 1 158 13 is_stmt 1 view .LVU69
+	.loc 1 158 31 is_stmt 0 view .LVU70
+	movl	baroPressure(%rip), %eax
+	movl	baroPressureSum(%rip), %edi
+.LVL8:
+.LBB18:
+.LBI14:
+	.loc 1 95 17 is_stmt 1 view .LVU71
+.LBB16:
+	.loc 1 97 5 view .LVU72
+	.loc 1 98 5 view .LVU73
+	.loc 1 99 5 view .LVU74
+	.loc 1 102 5 view .LVU75
+.LBE16:
+.LBE18:
+	.loc 1 158 31 is_stmt 0 view .LVU76
+	movzbl	(%rsi), %esi
+.LVL9:
+.LBB19:
+.LBB17:
+	.loc 1 102 21 view .LVU77
+	leal	1(%rdx), %ecx
+.LVL10:
+	.loc 1 103 5 is_stmt 1 view .LVU78
+	.loc 1 103 8 is_stmt 0 view .LVU79
+	cmpl	%ecx, %esi
+	jne	.L15
+	.loc 1 104 9 is_stmt 1 view .LVU80
+.LVL11:
+	.loc 1 105 9 view .LVU81
+	.loc 1 105 19 is_stmt 0 view .LVU82
+	movb	$1, baroReady(%rip)
+	.loc 1 104 25 view .LVU83
+	xorl	%ecx, %ecx
+.LVL12:
+.L15:
+	.loc 1 107 5 is_stmt 1 view .LVU84
+	.loc 1 107 42 is_stmt 0 view .LVU85
+	leaq	barometerSamples.0(%rip), %rsi
+	.loc 1 114 24 view .LVU86
+	movl	%ecx, currentSampleIndex.1(%rip)
+	.loc 1 107 42 view .LVU87
+	movl	%eax, (%rsi,%rdx,4)
+	.loc 1 111 5 is_stmt 1 view .LVU88
+	.loc 1 112 38 is_stmt 0 view .LVU89
+	movslq	%ecx, %rdx
+	.loc 1 111 19 view .LVU90
+	addl	%edi, %eax
+.LVL13:
+	.loc 1 112 5 is_stmt 1 view .LVU91
+	.loc 1 112 19 is_stmt 0 view .LVU92
+	subl	(%rsi,%rdx,4), %eax
+.LVL14:
+	.loc 1 114 5 is_stmt 1 view .LVU93
+	.loc 1 116 5 view .LVU94
+	.loc 1 116 5 is_stmt 0 view .LVU95
+.LBE17:
+.LBE19:
+	.loc 1 158 29 view .LVU96
+	movl	%eax, baroPressureSum(%rip)
+	.loc 1 159 9 is_stmt 1 view .LVU97
+	.loc 1 161 1 is_stmt 0 view .LVU98
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL15:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.cfi_restore_state
+	.loc 1 149 13 is_stmt 1 view .LVU99
+	call	*32+baro(%rip)
+.LVL16:
+	.loc 1 150 13 view .LVU100
+	call	*8+baro(%rip)
+.LVL17:
+	.loc 1 151 13 view .LVU101
+	.loc 1 151 33 is_stmt 0 view .LVU102
+	movzwl	baro(%rip), %eax
+	.loc 1 152 13 view .LVU103
+	leaq	baroTemperature(%rip), %rsi
+	.loc 1 151 26 view .LVU104
+	addl	%eax, baroDeadline.3(%rip)
+	.loc 1 152 13 is_stmt 1 view .LVU105
+	leaq	baroPressure(%rip), %rdi
+	call	*40+baro(%rip)
+.LVL18:
+	.loc 1 153 13 view .LVU106
+	.loc 1 153 19 is_stmt 0 view .LVU107
+	movl	$2, state.2(%rip)
+	.loc 1 154 9 is_stmt 1 view .LVU108
+	.loc 1 161 1 is_stmt 0 view .LVU109
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	baroUpdate, .-baroUpdate
+	.section	.text.baroCalculateAltitude,"ax",@progbits
+	.p2align 4
+	.globl	baroCalculateAltitude
+	.type	baroCalculateAltitude, @function
+baroCalculateAltitude:
+.LFB18:
+	.loc 1 164 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 165 5 view .LVU111
+	.loc 1 169 5 view .LVU112
+	.loc 1 164 1 is_stmt 0 view .LVU113
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 169 87 view .LVU114
+	movq	barometerConfig(%rip), %rax
+	.loc 1 169 19 view .LVU115
+	xorl	%edx, %edx
+	pxor	%xmm0, %xmm0
+	.loc 1 169 87 view .LVU116
+	movzbl	(%rax), %ecx
+	.loc 1 169 69 view .LVU117
+	movl	baroPressureSum(%rip), %eax
+	.loc 1 169 107 view .LVU118
+	subl	$1, %ecx
+	.loc 1 169 19 view .LVU119
+	divl	%ecx
+	cvtsi2ssq	%rax, %xmm0
+	call	pressureToAltitude@PLT
+.LVL19:
+	call	lrintf@PLT
+.LVL20:
+	.loc 1 170 5 is_stmt 1 view .LVU120
+	.loc 1 171 5 view .LVU121
+	.loc 1 171 54 is_stmt 0 view .LVU122
+	movq	barometerConfig(%rip), %rdx
+	.loc 1 171 73 view .LVU123
+	pxor	%xmm0, %xmm0
+	.loc 1 171 100 view .LVU124
+	movss	.LC0(%rip), %xmm1
+	.loc 1 170 17 view .LVU125
+	subl	baroGroundAltitude(%rip), %eax
+.LVL21:
+	.loc 1 171 54 view .LVU126
+	movss	4(%rdx), %xmm2
+	.loc 1 171 73 view .LVU127
+	cvtsi2ssl	%eax, %xmm0
+	.loc 1 171 100 view .LVU128
+	subss	%xmm2, %xmm1
+	.loc 1 171 92 view .LVU129
+	mulss	%xmm1, %xmm0
+	.loc 1 171 22 view .LVU130
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	BaroAlt(%rip), %xmm1
+	.loc 1 171 37 view .LVU131
+	mulss	%xmm2, %xmm1
+	.loc 1 171 15 view .LVU132
+	addss	%xmm1, %xmm0
+	call	lrintf@PLT
+.LVL22:
+	.loc 1 171 13 view .LVU133
+	movl	%eax, BaroAlt(%rip)
+	.loc 1 173 5 is_stmt 1 view .LVU134
+	.loc 1 174 1 is_stmt 0 view .LVU135
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	baroCalculateAltitude, .-baroCalculateAltitude
+	.section	.text.performBaroCalibrationCycle,"ax",@progbits
+	.p2align 4
+	.globl	performBaroCalibrationCycle
+	.type	performBaroCalibrationCycle, @function
+performBaroCalibrationCycle:
+.LFB19:
+	.loc 1 177 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 178 5 view .LVU137
+	.loc 1 177 1 is_stmt 0 view .LVU138
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 179 43 view .LVU139
+	xorl	%edx, %edx
+	.loc 1 178 46 view .LVU140
+	movl	baroGroundPressure(%rip), %ecx
+	.loc 1 179 5 is_stmt 1 view .LVU141
+	.loc 1 180 26 is_stmt 0 view .LVU142
+	pxor	%xmm0, %xmm0
+	.loc 1 179 61 view .LVU143
+	movq	barometerConfig(%rip), %rax
+	movzbl	(%rax), %esi
+	.loc 1 179 43 view .LVU144
+	movl	baroPressureSum(%rip), %eax
+	.loc 1 179 81 view .LVU145
+	subl	$1, %esi
+	.loc 1 179 43 view .LVU146
+	divl	%esi
+	.loc 1 178 46 view .LVU147
+	testl	%ecx, %ecx
+	leal	7(%rcx), %edx
+	cmovns	%ecx, %edx
+	sarl	$3, %edx
+	.loc 1 178 24 view .LVU148
+	subl	%edx, %ecx
+	.loc 1 179 24 view .LVU149
+	addl	%ecx, %eax
+	.loc 1 180 64 view .LVU150
+	leal	7(%rax), %edx
+	.loc 1 179 24 view .LVU151
+	movl	%eax, baroGroundPressure(%rip)
+	.loc 1 180 5 is_stmt 1 view .LVU152
+	.loc 1 180 64 is_stmt 0 view .LVU153
+	cmovs	%edx, %eax
+	sarl	$3, %eax
+	.loc 1 180 26 view .LVU154
+	cvtsi2ssl	%eax, %xmm0
+	call	pressureToAltitude@PLT
+.LVL23:
+	.loc 1 183 8 view .LVU155
+	subw	$1, calibratingB(%rip)
+	.loc 1 180 24 view .LVU156
+	cvttss2sil	%xmm0, %eax
+	movl	%eax, baroGroundAltitude(%rip)
+	.loc 1 182 5 is_stmt 1 view .LVU157
+	.loc 1 183 8 is_stmt 0 view .LVU158
+	jne	.L25
+	.loc 1 183 26 discriminator 1 view .LVU159
+	cmpb	$0, bootCalibration(%rip)
+	je	.L25
+	.loc 1 187 5 is_stmt 1 view .LVU160
+	.loc 1 188 34 is_stmt 0 view .LVU161
+	movl	baroGroundPressure(%rip), %edx
+	.loc 1 188 52 view .LVU162
+	movq	knownSensors(%rip), %rcx
+	.loc 1 188 34 view .LVU163
+	testl	%edx, %edx
+	leal	7(%rdx), %eax
+	cmovns	%edx, %eax
+	sarl	$3, %eax
+	.loc 1 187 8 view .LVU164
+	cmpb	$0, checkingKnownGroundPressure(%rip)
+	je	.L27
+	.loc 1 188 9 is_stmt 1 view .LVU165
+	.loc 1 188 52 is_stmt 0 view .LVU166
+	movl	12(%rcx), %edx
+	.loc 1 188 38 view .LVU167
+	movl	%eax, %ecx
+	subl	%edx, %ecx
+	.loc 1 188 204 view .LVU168
+	testl	%ecx, %ecx
+	jle	.L28
+	.loc 1 188 12 discriminator 1 view .LVU169
+	cmpl	$50, %ecx
+	jle	.L25
+.L29:
+	.loc 1 190 13 is_stmt 1 view .LVU170
+	.loc 1 190 26 is_stmt 0 view .LVU171
+	movl	$200, %eax
+	.loc 1 191 41 view .LVU172
+	movb	$0, checkingKnownGroundPressure(%rip)
+	.loc 1 190 26 view .LVU173
+	movw	%ax, calibratingB(%rip)
+	.loc 1 191 13 is_stmt 1 view .LVU174
+.L25:
+	.loc 1 200 1 is_stmt 0 view .LVU175
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.cfi_restore_state
+	.loc 1 196 5 is_stmt 1 view .LVU176
+	.loc 1 198 30 is_stmt 0 view .LVU177
+	movzbl	3(%rcx), %edx
+	.loc 1 196 38 view .LVU178
+	movl	%eax, 12(%rcx)
+	.loc 1 197 5 is_stmt 1 view .LVU179
+	.loc 1 198 5 view .LVU180
+	.loc 1 197 32 is_stmt 0 view .LVU181
+	movzbl	baroHardware(%rip), %eax
+	.loc 1 198 30 view .LVU182
+	orl	$4, %edx
+	.loc 1 197 32 view .LVU183
+	movb	%dl, %ah
+	movw	%ax, 2(%rcx)
+	.loc 1 199 5 is_stmt 1 view .LVU184
+	.loc 1 200 1 is_stmt 0 view .LVU185
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 199 5 view .LVU186
+	jmp	requestEEPROMWrite@PLT
+.LVL24:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+	.cfi_restore_state
+	.loc 1 188 12 discriminator 2 view .LVU187
+	subl	%eax, %edx
+	cmpl	$50, %edx
+	jle	.L25
+	jmp	.L29
+	.cfi_endproc
+.LFE19:
+	.size	performBaroCalibrationCycle, .-performBaroCalibrationCycle
+	.section	.bss.barometerSamples.0,"aw",@nobits
+	.align 32
+	.type	barometerSamples.0, @object
+	.size	barometerSamples.0, 192
+barometerSamples.0:
+	.zero	192
+	.section	.bss.currentSampleIndex.1,"aw",@nobits
+	.align 4
+	.type	currentSampleIndex.1, @object
+	.size	currentSampleIndex.1, 4
+currentSampleIndex.1:
+	.zero	4
+	.section	.bss.state.2,"aw",@nobits
+	.align 4
+	.type	state.2, @object
+	.size	state.2, 4
+state.2:
+	.zero	4
+	.section	.bss.baroDeadline.3,"aw",@nobits
+	.align 4
+	.type	baroDeadline.3, @object
+	.size	baroDeadline.3, 4
+baroDeadline.3:
+	.zero	4
+	.section	.bss.baroReady,"aw",@nobits
+	.type	baroReady, @object
+	.size	baroReady, 1
+baroReady:
+	.zero	1
+	.comm	barometerConfig,8,8
+	.section	.bss.knownSensors,"aw",@nobits
+	.align 8
+	.type	knownSensors, @object
+	.size	knownSensors, 8
+knownSensors:
+	.zero	8
+	.section	.bss.bootCalibration,"aw",@nobits
+	.type	bootCalibration, @object
+	.size	bootCalibration, 1
+bootCalibration:
+	.zero	1
+	.section	.bss.checkingKnownGroundPressure,"aw",@nobits
+	.type	checkingKnownGroundPressure, @object
+	.size	checkingKnownGroundPressure, 1
+checkingKnownGroundPressure:
+	.zero	1
+	.section	.bss.baroPressureSum,"aw",@nobits
+	.align 4
+	.type	baroPressureSum, @object
+	.size	baroPressureSum, 4
+baroPressureSum:
+	.zero	4
+	.section	.bss.baroGroundPressure,"aw",@nobits
+	.align 4
+	.type	baroGroundPressure, @object
+	.size	baroGroundPressure, 4
+baroGroundPressure:
+	.zero	4
+	.section	.bss.baroGroundAltitude,"aw",@nobits
+	.align 4
+	.type	baroGroundAltitude, @object
+	.size	baroGroundAltitude, 4
+baroGroundAltitude:
+	.zero	4
+	.globl	BaroAlt
+	.section	.bss.BaroAlt,"aw",@nobits
+	.align 4
+	.type	BaroAlt, @object
+	.size	BaroAlt, 4
+BaroAlt:
+	.zero	4
+	.globl	baroTemperature
+	.section	.bss.baroTemperature,"aw",@nobits
+	.align 4
+	.type	baroTemperature, @object
+	.size	baroTemperature, 4
+baroTemperature:
+	.zero	4
+	.globl	baroPressure
+	.section	.bss.baroPressure,"aw",@nobits
+	.align 4
+	.type	baroPressure, @object
+	.size	baroPressure, 4
+baroPressure:
+	.zero	4
+	.globl	calibratingB
+	.section	.bss.calibratingB,"aw",@nobits
+	.align 2
+	.type	calibratingB, @object
+	.size	calibratingB, 2
+calibratingB:
+	.zero	2
+	.globl	baroHardware
+	.section	.bss.baroHardware,"aw",@nobits
+	.type	baroHardware, @object
+	.size	baroHardware, 1
+baroHardware:
+	.zero	1
+	.comm	baro,48,32
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1065353216
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/drivers/barometer.h"
+	.file 6 ".//src/main/sensors/sensors.h"
+	.file 7 ".//src/main/sensors/barometer.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 9 ".//src/main/common/maths.h"
+	.file 10 ".//src/main/config/config.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x75f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF1411
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL9
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1317
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1318
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1319
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1320
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1321
+	.uleb128 0x2
+	.long	.LASF1322
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x2
+	.long	.LASF1323
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1324
+	.uleb128 0x2
+	.long	.LASF1325
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x2
+	.long	.LASF1326
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1327
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1328
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1329
+	.uleb128 0x2
+	.long	.LASF1330
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x2
+	.long	.LASF1331
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x2
+	.long	.LASF1332
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1333
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1334
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1335
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1336
+	.uleb128 0x6
+	.long	0xb5
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1337
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1338
+	.uleb128 0x2
+	.long	.LASF1339
+	.byte	0x5
+	.byte	0x14
+	.byte	0x10
+	.long	0x112
+	.uleb128 0x6
+	.long	0x117
+	.uleb128 0x18
+	.uleb128 0x2
+	.long	.LASF1340
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0x124
+	.uleb128 0x6
+	.long	0x129
+	.uleb128 0x19
+	.long	0x139
+	.uleb128 0x7
+	.long	0xf3
+	.uleb128 0x7
+	.long	0xf3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1348
+	.byte	0x30
+	.byte	0x5
+	.byte	0x17
+	.long	0x1a1
+	.uleb128 0x1
+	.long	.LASF1341
+	.byte	0x5
+	.byte	0x18
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1342
+	.byte	0x5
+	.byte	0x19
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1343
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x13
+	.long	0x106
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1344
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x106
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1345
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x13
+	.long	0x106
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1346
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x13
+	.long	0x106
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1347
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x118
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1348
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x3
+	.long	0x139
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0x6
+	.byte	0x1c
+	.long	0x1e3
+	.uleb128 0x3
+	.long	.LASF1349
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1350
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1351
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1352
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1353
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1354
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1355
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1356
+	.byte	0x10
+	.byte	0x6
+	.byte	0x39
+	.long	0x23e
+	.uleb128 0x1
+	.long	.LASF1357
+	.byte	0x6
+	.byte	0x3a
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1358
+	.byte	0x6
+	.byte	0x3b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1359
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xd
+	.long	0x23e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1362
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x11
+	.long	0xa9
+	.long	0x24e
+	.uleb128 0x12
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1363
+	.byte	0x6
+	.byte	0x40
+	.byte	0x3
+	.long	0x1e3
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0x7
+	.byte	0x17
+	.long	0x284
+	.uleb128 0x3
+	.long	.LASF1364
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1365
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1366
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1367
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1368
+	.byte	0x4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1369
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1f
+	.long	0x2c5
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0x7
+	.byte	0x20
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0x7
+	.byte	0x21
+	.byte	0xb
+	.long	0xf8
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0x7
+	.byte	0x22
+	.byte	0xb
+	.long	0xf8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x7
+	.byte	0x23
+	.byte	0xb
+	.long	0xf8
+	.byte	0xc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1374
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x284
+	.uleb128 0xe
+	.long	.LASF1359
+	.byte	0x26
+	.long	0xc1
+	.uleb128 0xe
+	.long	.LASF1375
+	.byte	0x27
+	.long	0xb5
+	.uleb128 0xe
+	.long	.LASF1376
+	.byte	0x28
+	.long	0xb5
+	.uleb128 0x8
+	.long	.LASF1377
+	.byte	0x21
+	.byte	0x8
+	.long	0x1a1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baro
+	.uleb128 0xf
+	.long	0x2d1
+	.byte	0x22
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroHardware
+	.uleb128 0x8
+	.long	.LASF1378
+	.byte	0x23
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	calibratingB
+	.uleb128 0x8
+	.long	.LASF1379
+	.byte	0x24
+	.byte	0x9
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroPressure
+	.uleb128 0xf
+	.long	0x2e5
+	.byte	0x25
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroTemperature
+	.uleb128 0xf
+	.long	0x2db
+	.byte	0x26
+	.uleb128 0x9
+	.byte	0x3
+	.quad	BaroAlt
+	.uleb128 0x5
+	.long	.LASF1380
+	.byte	0x2d
+	.byte	0x10
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroGroundAltitude
+	.uleb128 0x5
+	.long	.LASF1362
+	.byte	0x2e
+	.byte	0x10
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroGroundPressure
+	.uleb128 0x5
+	.long	.LASF1381
+	.byte	0x2f
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroPressureSum
+	.uleb128 0x5
+	.long	.LASF1382
+	.byte	0x31
+	.byte	0xc
+	.long	0x3b2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	checkingKnownGroundPressure
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1383
+	.uleb128 0x5
+	.long	.LASF1384
+	.byte	0x32
+	.byte	0xc
+	.long	0x3b2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	bootCalibration
+	.uleb128 0x5
+	.long	.LASF1385
+	.byte	0x33
+	.byte	0x18
+	.long	0x3e3
+	.uleb128 0x9
+	.byte	0x3
+	.quad	knownSensors
+	.uleb128 0x6
+	.long	0x24e
+	.uleb128 0x8
+	.long	.LASF1386
+	.byte	0x35
+	.byte	0x14
+	.long	0x3fd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	barometerConfig
+	.uleb128 0x6
+	.long	0x2c5
+	.uleb128 0x5
+	.long	.LASF1387
+	.byte	0x5b
+	.byte	0xc
+	.long	0x3b2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroReady
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0x1
+	.byte	0x77
+	.long	0x435
+	.uleb128 0x3
+	.long	.LASF1388
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1389
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1390
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1391
+	.byte	0x1
+	.byte	0x7b
+	.byte	0x3
+	.long	0x417
+	.uleb128 0x1a
+	.long	.LASF1412
+	.byte	0xa
+	.byte	0x39
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1392
+	.byte	0x8
+	.value	0x13d
+	.byte	0x11
+	.long	0x9b
+	.long	0x460
+	.uleb128 0x7
+	.long	0xf8
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1393
+	.byte	0x9
+	.byte	0x39
+	.byte	0x7
+	.long	0xf8
+	.long	0x476
+	.uleb128 0x7
+	.long	0xf8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1395
+	.byte	0xb0
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4ad
+	.uleb128 0x9
+	.quad	.LVL23
+	.long	0x460
+	.uleb128 0x1d
+	.quad	.LVL24
+	.long	0x441
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1413
+	.byte	0x1
+	.byte	0xa3
+	.byte	0x9
+	.long	0xb5
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x50b
+	.uleb128 0x1f
+	.long	.LASF1394
+	.byte	0x1
+	.byte	0xa5
+	.byte	0xd
+	.long	0xb5
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x9
+	.quad	.LVL19
+	.long	0x460
+	.uleb128 0x9
+	.quad	.LVL20
+	.long	0x449
+	.uleb128 0x9
+	.quad	.LVL22
+	.long	0x449
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1396
+	.byte	0x1
+	.byte	0x82
+	.byte	0x6
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e0
+	.uleb128 0x21
+	.long	.LASF1414
+	.byte	0x1
+	.byte	0x82
+	.byte	0x1a
+	.long	0xd9
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x5
+	.long	.LASF1397
+	.byte	0x84
+	.byte	0x15
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroDeadline.3
+	.uleb128 0x5
+	.long	.LASF1398
+	.byte	0x85
+	.byte	0x1d
+	.long	0x435
+	.uleb128 0x9
+	.byte	0x3
+	.quad	state.2
+	.uleb128 0x22
+	.long	0x5fc
+	.quad	.LBI14
+	.byte	.LVU71
+	.long	.LLRL3
+	.byte	0x1
+	.byte	0x9e
+	.byte	0x1f
+	.long	0x5bb
+	.uleb128 0xa
+	.long	0x623
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xa
+	.long	0x618
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xa
+	.long	0x60d
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x23
+	.long	.LLRL3
+	.uleb128 0x24
+	.long	0x658
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.quad	.LVL18
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroPressure
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroTemperature
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1406
+	.byte	0x7e
+	.long	0x3b2
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x26
+	.long	.LASF1415
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x11
+	.long	0xd9
+	.byte	0x1
+	.long	0x665
+	.uleb128 0xb
+	.long	.LASF1399
+	.byte	0x5f
+	.byte	0x33
+	.long	0xc1
+	.uleb128 0xb
+	.long	.LASF1400
+	.byte	0x5f
+	.byte	0x4d
+	.long	0xd9
+	.uleb128 0xb
+	.long	.LASF1401
+	.byte	0x5f
+	.byte	0x64
+	.long	0xb5
+	.uleb128 0x5
+	.long	.LASF1402
+	.byte	0x61
+	.byte	0x14
+	.long	0x665
+	.uleb128 0x9
+	.byte	0x3
+	.quad	barometerSamples.0
+	.uleb128 0x5
+	.long	.LASF1403
+	.byte	0x62
+	.byte	0x10
+	.long	0x88
+	.uleb128 0x9
+	.byte	0x3
+	.quad	currentSampleIndex.1
+	.uleb128 0x27
+	.long	.LASF1416
+	.byte	0x1
+	.byte	0x63
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	0xb5
+	.long	0x675
+	.uleb128 0x12
+	.long	0x43
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1404
+	.byte	0x4d
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6e4
+	.uleb128 0x15
+	.long	.LASF1409
+	.byte	0x4d
+	.byte	0x2f
+	.long	0x3e3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x28
+	.long	0x6e4
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.byte	0x1
+	.byte	0x56
+	.byte	0x9
+	.long	0x6c0
+	.uleb128 0x29
+	.long	0x6f1
+	.byte	0
+	.uleb128 0x2a
+	.long	0x6e4
+	.quad	.LBI8
+	.byte	.LVU28
+	.long	.LLRL0
+	.byte	0x1
+	.byte	0x52
+	.byte	0x9
+	.uleb128 0xa
+	.long	0x6f1
+	.long	.LLST1
+	.long	.LVUS1
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1417
+	.byte	0x1
+	.byte	0x41
+	.byte	0x6
+	.byte	0x1
+	.long	0x6fd
+	.uleb128 0xb
+	.long	.LASF1405
+	.byte	0x41
+	.byte	0x28
+	.long	0xcd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1407
+	.byte	0x3c
+	.long	0x3b2
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x10
+	.long	.LASF1408
+	.byte	0x37
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x743
+	.uleb128 0x15
+	.long	.LASF1410
+	.byte	0x37
+	.byte	0x2c
+	.long	0x3fd
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x2c
+	.long	0x6e4
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2d
+	.long	0x6f1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS8:
+	.uleb128 .LVU120
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU133
+.LLST8:
+	.byte	0x6
+	.quad	.LVL20
+	.byte	0x4
+	.uleb128 .LVL20-.LVL20
+	.uleb128 .LVL20-.LVL20
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.LVL20
+	.uleb128 .LVL21-.LVL20
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	baroGroundAltitude
+	.byte	0x94
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL20
+	.uleb128 .LVL22-1-.LVL20
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU57
+	.uleb128 .LVU57
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL4
+	.byte	0x4
+	.uleb128 .LVL4-.LVL4
+	.uleb128 .LVL5-1-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-1-.LVL4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL4
+	.uleb128 .LVL8-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.LVL4
+	.uleb128 .LVL15-.LVL4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroDeadline.3
+	.byte	0x4
+	.uleb128 .LVL15-.LVL4
+	.uleb128 .LVL16-1-.LVL4
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-1-.LVL4
+	.uleb128 .LFE17-.LVL4
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU71
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU95
+.LLST4:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL13-.LVL8
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.LVL8
+	.uleb128 .LVL14-.LVL8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	baroPressure
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU71
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU95
+.LLST5:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL13-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL13-.LVL8
+	.uleb128 .LVL14-.LVL8
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU71
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU95
+.LLST6:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL9-.LVL8
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL9-.LVL8
+	.uleb128 .LVL14-.LVL8
+	.uleb128 0xa
+	.byte	0x3
+	.quad	barometerConfig
+	.byte	0x6
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU78
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU95
+.LLST7:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL12-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL12-.LVL10
+	.uleb128 .LVL14-.LVL10
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU28
+	.uleb128 .LVU32
+.LLST1:
+	.byte	0x8
+	.quad	.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x28
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x9c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x5
+	.quad	.LBB8
+	.byte	0x4
+	.uleb128 .LBB8-.LBB8
+	.uleb128 .LBE8-.LBB8
+	.byte	0x4
+	.uleb128 .LBB11-.LBB8
+	.uleb128 .LBE11-.LBB8
+	.byte	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB14
+	.byte	0x4
+	.uleb128 .LBB14-.LBB14
+	.uleb128 .LBE14-.LBB14
+	.byte	0x4
+	.uleb128 .LBB18-.LBB14
+	.uleb128 .LBE18-.LBB14
+	.byte	0x4
+	.uleb128 .LBB19-.LBB14
+	.uleb128 .LBE19-.LBB14
+	.byte	0
+.LLRL9:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 27 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 38 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3b
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1179
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 65 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.file 66 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 67 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1314
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1316
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1178
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1181
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1183
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1208
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1211
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1223
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1233
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1272
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1282
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1301
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1308
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1313
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF981:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1248:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF906:
+	.string	"__DECL_SIMD_cosl "
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF974:
+	.string	"__DECL_SIMD_atan "
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF937:
+	.string	"__DECL_SIMD_logf16 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1035:
+	.string	"__DECL_SIMD_expm1f "
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1193:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1030:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF996:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1331:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF956:
+	.string	"__DECL_SIMD_powl "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1096:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1015:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF988:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1263:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1330:
+	.string	"int16_t"
+.LASF1388:
+	.string	"BAROMETER_NEEDS_SAMPLES"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1176:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF959:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF942:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1311:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1272:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1024:
+	.string	"__DECL_SIMD_cosh "
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1281:
+	.string	"U_ID_1 0"
+.LASF1279:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1289:
+	.string	"USE_GYRO_SITL "
+.LASF810:
+	.string	"__id_t_defined "
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1158:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1262:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1107:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1266:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF1189:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1165:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF972:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF984:
+	.string	"__DECL_SIMD_asin "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1358:
+	.string	"accHardware"
+.LASF1341:
+	.string	"ut_delay"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1371:
+	.string	"baro_noise_lpf"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1256:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF926:
+	.string	"__DECL_SIMD_sincosl "
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1192:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1094:
+	.string	"__DECL_SIMD_log1p "
+.LASF1236:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1261:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF963:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1148:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF733:
+	.string	"NULL"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF1277:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1032:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1216:
+	.string	"_Mdouble_ _Float32x"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1315:
+	.string	"BARO_KNOWN_GROUND_PRESSURE_TOLERANCE 50"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1240:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1291:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1348:
+	.string	"baro_t"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1031:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF983:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1328:
+	.string	"long int"
+.LASF1351:
+	.string	"SENSOR_BARO"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1125:
+	.string	"__DECL_SIMD_erff "
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1181:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1223:
+	.string	"__MATHDECL"
+.LASF1366:
+	.string	"BARO_BMP085"
+.LASF1252:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1203:
+	.string	"_Mdouble_ float"
+.LASF1134:
+	.string	"__DECL_SIMD_tanh "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1105:
+	.string	"__DECL_SIMD_atanhf "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF1416:
+	.string	"nextSampleIndex"
+.LASF1197:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10l "
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF994:
+	.string	"__DECL_SIMD_hypot "
+.LASF1088:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1028:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1050:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1095:
+	.string	"__DECL_SIMD_log1pf "
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1247:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1253:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1357:
+	.string	"gyroHardware"
+.LASF912:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1389:
+	.string	"BAROMETER_NEEDS_CALCULATION"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1087:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF1406:
+	.string	"isBaroReady"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF930:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1321:
+	.string	"signed char"
+.LASF1085:
+	.string	"__DECL_SIMD_log2f "
+.LASF1332:
+	.string	"uint8_t"
+.LASF1409:
+	.string	"knownSensorsToUse"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1359:
+	.string	"baroHardware"
+.LASF1375:
+	.string	"BaroAlt"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1222:
+	.string	"__MATHDECL_ALIAS"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1230:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF967:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1093:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1249:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF801:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1297:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1206:
+	.string	"_Mdouble_ long double"
+.LASF1317:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF944:
+	.string	"__DECL_SIMD_exp "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1298:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1260:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1410:
+	.string	"barometerConfigToUse"
+.LASF1199:
+	.string	"_Mdouble_"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1303:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF973:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1271:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1175:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1178:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1383:
+	.string	"_Bool"
+.LASF993:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1074:
+	.string	"__DECL_SIMD_log10 "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1037:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1258:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF969:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1380:
+	.string	"baroGroundAltitude"
+.LASF1065:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1006:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1246:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1078:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1211:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1147:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1084:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1325:
+	.string	"__uint16_t"
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF915:
+	.string	"__DECL_SIMD_sinf "
+.LASF1355:
+	.string	"SENSOR_GPSMAG"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1401:
+	.string	"newPressureReading"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1286:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1241:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF696:
+	.string	"__size_t__ "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF1394:
+	.string	"BaroAlt_tmp"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF908:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1238:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1145:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1367:
+	.string	"BARO_MS5611"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1347:
+	.string	"calculate"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1400:
+	.string	"pressureTotal"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1025:
+	.string	"__DECL_SIMD_coshf "
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1118:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1126:
+	.string	"__DECL_SIMD_erfl "
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1242:
+	.string	"FP_ZERO 2"
+.LASF1372:
+	.string	"baro_cf_vel"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1198:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1268:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1243:
+	.string	"FP_SUBNORMAL 3"
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1396:
+	.string	"baroUpdate"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1369:
+	.string	"barometerConfig_s"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1306:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1370:
+	.string	"baro_sample_count"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF693:
+	.string	"__need_size_t "
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1382:
+	.string	"checkingKnownGroundPressure"
+.LASF1090:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1186:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1156:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1044:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1322:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1287:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1106:
+	.string	"__DECL_SIMD_atanhl "
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1187:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF907:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1091:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1195:
+	.string	"_Mdouble_ double"
+.LASF1138:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1218:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1155:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1364:
+	.string	"BARO_DEFAULT"
+.LASF931:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF979:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF1210:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1092:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1397:
+	.string	"baroDeadline"
+.LASF1395:
+	.string	"performBaroCalibrationCycle"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF949:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1208:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1299:
+	.string	"BLACKBOX "
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1182:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2 "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1033:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1005:
+	.string	"__DECL_SIMD_exp2f "
+.LASF860:
+	.string	"__NFDBITS"
+.LASF962:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1305:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1179:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1057:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1180:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF913:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF961:
+	.string	"__DECL_SIMD_powf32x "
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1014:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1170:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1245:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1346:
+	.string	"get_up"
+.LASF910:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1344:
+	.string	"get_ut"
+.LASF958:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1115:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1356:
+	.string	"knownSensors_s"
+.LASF1363:
+	.string	"knownSensors_t"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1264:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1077:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF947:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1237:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1387:
+	.string	"baroReady"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1251:
+	.string	"MATH_ERRNO 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1157:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1316:
+	.string	"PRESSURE_SAMPLE_COUNT (barometerConfig->baro_sample_count - 1)"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1276:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1296:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF919:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1172:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1283:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF965:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF935:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1075:
+	.string	"__DECL_SIMD_log10f "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1257:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1269:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1188:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1076:
+	.string	"__DECL_SIMD_log10l "
+.LASF1066:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1221:
+	.string	"__MATHDECL_1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF916:
+	.string	"__DECL_SIMD_sinl "
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1327:
+	.string	"__uint32_t"
+.LASF1140:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1313:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF1335:
+	.string	"long long int"
+.LASF1255:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1259:
+	.string	"M_PI 3.14159265358979323846"
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1054:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1010:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1200:
+	.string	"__MATH_PRECNAME"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF904:
+	.string	"__DECL_SIMD_cos "
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1349:
+	.string	"SENSOR_GYRO"
+.LASF1055:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1273:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1338:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF978:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1365:
+	.string	"BARO_NONE"
+.LASF1381:
+	.string	"baroPressureSum"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF933:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF955:
+	.string	"__DECL_SIMD_powf "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1386:
+	.string	"barometerConfig"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF462:
+	.string	"__PMT"
+.LASF936:
+	.string	"__DECL_SIMD_logl "
+.LASF1385:
+	.string	"knownSensors"
+.LASF1114:
+	.string	"__DECL_SIMD_acosh "
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1081:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1213:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF982:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1209:
+	.string	"_Mdouble_ _Float32"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF951:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1228:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1034:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1100:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF964:
+	.string	"__DECL_SIMD_acos "
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1368:
+	.string	"BARO_FAKE"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1319:
+	.string	"unsigned int"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1413:
+	.string	"baroCalculateAltitude"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1220:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1392:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1194:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1270:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1324:
+	.string	"short int"
+.LASF943:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1169:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1274:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF991:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF950:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1089:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF925:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF899:
+	.string	"alloca"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1233:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF392:
+	.string	"false 0"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1294:
+	.string	"USE_USART1 "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1204:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF957:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1290:
+	.string	"ACC "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1235:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF917:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1373:
+	.string	"baro_cf_alt"
+.LASF1302:
+	.string	"sq(x) ((x)*(x))"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF952:
+	.string	"__DECL_SIMD_expf64x "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF939:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF1137:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1350:
+	.string	"SENSOR_ACC"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF921:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1007:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1116:
+	.string	"__DECL_SIMD_acoshl "
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1040:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1133:
+	.string	"__DECL_SIMD_erff128x "
+.LASF546:
+	.string	"__stub_revoke "
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF1361:
+	.string	"gyroZero"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1329:
+	.string	"char"
+.LASF946:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF698:
+	.string	"_SIZE_T "
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF940:
+	.string	"__DECL_SIMD_logf128 "
+.LASF960:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1362:
+	.string	"baroGroundPressure"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1284:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF970:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF990:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1318:
+	.string	"short unsigned int"
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1098:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1288:
+	.string	"GYRO "
+.LASF934:
+	.string	"__DECL_SIMD_log "
+.LASF966:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1129:
+	.string	"__DECL_SIMD_erff64 "
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1265:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1403:
+	.string	"currentSampleIndex"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF902:
+	.string	"_MATH_H 1"
+.LASF1295:
+	.string	"USE_USART2 "
+.LASF1168:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1353:
+	.string	"SENSOR_SONAR"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1080:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1399:
+	.string	"baroSampleCount"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1167:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF992:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1407:
+	.string	"isBaroCalibrationComplete"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1097:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1378:
+	.string	"calibratingB"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1336:
+	.string	"long long unsigned int"
+.LASF1135:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1292:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF1333:
+	.string	"uint16_t"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1239:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1250:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1320:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1046:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1068:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF923:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1183:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1225:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1127:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1417:
+	.string	"baroSetCalibrationCycles"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1391:
+	.string	"barometerState_e"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1190:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF713:
+	.string	"__size_t "
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1004:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1278:
+	.string	"__disable_irq() "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF999:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1411:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1404:
+	.string	"baroStartBootCalibration"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF735:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF1160:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1309:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF903:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1323:
+	.string	"__int16_t"
+.LASF1280:
+	.string	"U_ID_0 0x5349544c"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1036:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF945:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF927:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1177:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF954:
+	.string	"__DECL_SIMD_pow "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF808:
+	.string	"__off_t_defined "
+.LASF1056:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1384:
+	.string	"bootCalibration"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1301:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF998:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF987:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1150:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF1244:
+	.string	"FP_NORMAL 4"
+.LASF905:
+	.string	"__DECL_SIMD_cosf "
+.LASF1379:
+	.string	"baroPressure"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1144:
+	.string	"__DECL_SIMD_asinh "
+.LASF1174:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1408:
+	.string	"useBarometerConfig"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1226:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF928:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1415:
+	.string	"recalculateBarometerTotal"
+.LASF1293:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1207:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF918:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF975:
+	.string	"__DECL_SIMD_atanf "
+.LASF1308:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1104:
+	.string	"__DECL_SIMD_atanh "
+.LASF1214:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1402:
+	.string	"barometerSamples"
+.LASF1345:
+	.string	"start_up"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1166:
+	.string	"__DECL_SIMD_tanl "
+.LASF1343:
+	.string	"start_ut"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1047:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1398:
+	.string	"state"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1130:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1070:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1026:
+	.string	"__DECL_SIMD_coshl "
+.LASF995:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1285:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1267:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1354:
+	.string	"SENSOR_GPS"
+.LASF1117:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1414:
+	.string	"currentTime"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF953:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF989:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1154:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1224:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1124:
+	.string	"__DECL_SIMD_erf "
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1304:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF1132:
+	.string	"__DECL_SIMD_erff64x "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1339:
+	.string	"baroOpFuncPtr"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1191:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1164:
+	.string	"__DECL_SIMD_tan "
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF986:
+	.string	"__DECL_SIMD_asinl "
+.LASF1232:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1376:
+	.string	"baroTemperature"
+.LASF1310:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1405:
+	.string	"calibrationCyclesRequired"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1136:
+	.string	"__DECL_SIMD_tanhl "
+.LASF980:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1374:
+	.string	"barometerConfig_t"
+.LASF1342:
+	.string	"up_delay"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1038:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1027:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1334:
+	.string	"uint32_t"
+.LASF1307:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1227:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1377:
+	.string	"baro"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1184:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1128:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF914:
+	.string	"__DECL_SIMD_sin "
+.LASF1185:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF968:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF922:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF1146:
+	.string	"__DECL_SIMD_asinhl "
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1337:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1312:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF1212:
+	.string	"_Mdouble_ _Float64"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF924:
+	.string	"__DECL_SIMD_sincos "
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF920:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF948:
+	.string	"__DECL_SIMD_expf32 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1314:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF985:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF976:
+	.string	"__DECL_SIMD_atanl "
+.LASF938:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1131:
+	.string	"__DECL_SIMD_erff32x "
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF911:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF1196:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1326:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF1045:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1412:
+	.string	"requestEEPROMWrite"
+.LASF1340:
+	.string	"baroCalculateFuncPtr"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1282:
+	.string	"U_ID_2 0"
+.LASF1048:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1086:
+	.string	"__DECL_SIMD_log2l "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF971:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF997:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1234:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF941:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1393:
+	.string	"pressureToAltitude"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1215:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1352:
+	.string	"SENSOR_MAG"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1360:
+	.string	"calibrated"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1254:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1300:
+	.string	"PROFILING "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1275:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF909:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1390:
+	.string	"BAROMETER_NEEDS_PROCESSING"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/sensors/barometer.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
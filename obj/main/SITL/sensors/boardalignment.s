@@ -0,0 +1,8870 @@
+	.file	"boardalignment.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/sensors/boardalignment.c"
+	.section	.text.initBoardAlignment,"ax",@progbits
+	.p2align 4
+	.globl	initBoardAlignment
+	.type	initBoardAlignment, @function
+initBoardAlignment:
+.LVL0:
+.LFB1:
+	.file 1 ".//src/main/sensors/boardalignment.c"
+	.loc 1 39 1 view -0
+	.cfi_startproc
+	.loc 1 40 5 view .LVU1
+	.loc 1 41 5 view .LVU2
+	.loc 1 42 5 view .LVU3
+	.loc 1 44 5 view .LVU4
+.LBB4:
+.LBI4:
+	.loc 1 33 12 view .LVU5
+.LBB5:
+	.loc 1 35 5 view .LVU6
+.LBE5:
+.LBE4:
+	.loc 1 39 1 is_stmt 0 view .LVU7
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+.LBB8:
+.LBB6:
+	.loc 1 35 27 view .LVU8
+	movswl	(%rdi), %edi
+.LVL1:
+	.loc 1 35 74 view .LVU9
+	testw	%di, %di
+	jne	.L2
+	.loc 1 35 41 view .LVU10
+	cmpw	$0, 2(%rbx)
+	je	.L7
+.L2:
+.LVL2:
+	.loc 1 35 41 view .LVU11
+.LBE6:
+.LBE8:
+	.loc 1 48 5 is_stmt 1 view .LVU12
+	leaq	28(%rsp), %rbp
+	leaq	24(%rsp), %r12
+	.loc 1 48 28 is_stmt 0 view .LVU13
+	movb	$0, standardBoardAlignment(%rip)
+	.loc 1 50 5 is_stmt 1 view .LVU14
+	.loc 1 50 12 is_stmt 0 view .LVU15
+	call	degreesToRadians@PLT
+.LVL3:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	sincosf@PLT
+.LVL4:
+	movss	24(%rsp), %xmm4
+	movss	28(%rsp), %xmm2
+	.loc 1 51 13 view .LVU16
+	movswl	2(%rbx), %edi
+	movss	%xmm4, 20(%rsp)
+	movss	%xmm2, 16(%rsp)
+.LVL5:
+	.loc 1 51 5 is_stmt 1 view .LVU17
+	.loc 1 51 13 is_stmt 0 view .LVU18
+	call	degreesToRadians@PLT
+.LVL6:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	sincosf@PLT
+.LVL7:
+	movss	24(%rsp), %xmm5
+	movss	28(%rsp), %xmm1
+	.loc 1 52 11 view .LVU19
+	movswl	4(%rbx), %edi
+	movss	%xmm5, 12(%rsp)
+	movss	%xmm1, 8(%rsp)
+.LVL8:
+	.loc 1 52 5 is_stmt 1 view .LVU20
+	.loc 1 52 11 is_stmt 0 view .LVU21
+	call	degreesToRadians@PLT
+.LVL9:
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	sincosf@PLT
+.LVL10:
+	.loc 1 64 14 view .LVU22
+	movss	16(%rsp), %xmm2
+	movss	24(%rsp), %xmm0
+	.loc 1 69 27 view .LVU23
+	movss	.LC0(%rip), %xmm11
+	.loc 1 62 14 view .LVU24
+	movss	12(%rsp), %xmm5
+	.loc 1 61 14 view .LVU25
+	movss	20(%rsp), %xmm4
+	.loc 1 64 14 view .LVU26
+	movaps	%xmm2, %xmm7
+	.loc 1 72 48 view .LVU27
+	movss	8(%rsp), %xmm1
+	movss	28(%rsp), %xmm10
+.LVL11:
+	.loc 1 54 5 is_stmt 1 view .LVU28
+	.loc 1 55 5 view .LVU29
+	.loc 1 56 5 view .LVU30
+	.loc 1 57 5 view .LVU31
+	.loc 1 58 5 view .LVU32
+	.loc 1 59 5 view .LVU33
+	.loc 1 61 5 view .LVU34
+	.loc 1 65 14 is_stmt 0 view .LVU35
+	movaps	%xmm2, %xmm3
+	.loc 1 64 14 view .LVU36
+	mulss	%xmm0, %xmm7
+	.loc 1 69 27 view .LVU37
+	movaps	%xmm5, %xmm9
+	.loc 1 63 14 view .LVU38
+	movaps	%xmm4, %xmm8
+	.loc 1 69 27 view .LVU39
+	xorps	%xmm11, %xmm9
+	.loc 1 61 14 view .LVU40
+	movaps	%xmm4, %xmm6
+	.loc 1 68 25 view .LVU41
+	movaps	%xmm1, %xmm12
+	.loc 1 63 14 view .LVU42
+	mulss	%xmm10, %xmm8
+	.loc 1 74 27 view .LVU43
+	xorps	%xmm11, %xmm2
+.LVL12:
+	.loc 1 65 14 view .LVU44
+	mulss	%xmm10, %xmm3
+.LVL13:
+	.loc 1 69 33 view .LVU45
+	mulss	%xmm10, %xmm9
+	.loc 1 72 48 view .LVU46
+	movaps	%xmm1, %xmm10
+.LVL14:
+	.loc 1 72 48 view .LVU47
+	mulss	%xmm7, %xmm10
+	.loc 1 61 14 view .LVU48
+	mulss	%xmm0, %xmm6
+.LVL15:
+	.loc 1 62 5 is_stmt 1 view .LVU49
+	.loc 1 63 5 view .LVU50
+	.loc 1 64 5 view .LVU51
+	.loc 1 65 5 view .LVU52
+	.loc 1 68 5 view .LVU53
+	.loc 1 69 5 view .LVU54
+	.loc 1 70 5 view .LVU55
+	.loc 1 72 5 view .LVU56
+	.loc 1 73 5 view .LVU57
+	.loc 1 74 5 view .LVU58
+	.loc 1 76 5 view .LVU59
+	.loc 1 77 5 view .LVU60
+	.loc 1 62 14 is_stmt 0 view .LVU61
+	mulss	%xmm5, %xmm0
+.LVL16:
+	.loc 1 74 33 view .LVU62
+	mulss	%xmm5, %xmm2
+	.loc 1 78 32 view .LVU63
+	mulss	%xmm5, %xmm4
+.LVL17:
+	.loc 1 72 36 view .LVU64
+	addss	%xmm8, %xmm10
+	.loc 1 68 25 view .LVU65
+	unpcklps	%xmm9, %xmm0
+.LVL18:
+	.loc 1 73 48 view .LVU66
+	movaps	%xmm1, %xmm9
+	mulss	%xmm3, %xmm9
+	.loc 1 68 25 view .LVU67
+	unpcklps	%xmm10, %xmm12
+	movlhps	%xmm12, %xmm0
+	.loc 1 78 25 view .LVU68
+	movss	%xmm4, 32+boardRotation(%rip)
+	.loc 1 68 25 view .LVU69
+	movaps	%xmm0, boardRotation(%rip)
+	.loc 1 73 36 view .LVU70
+	movaps	%xmm6, %xmm0
+	.loc 1 76 50 view .LVU71
+	mulss	%xmm1, %xmm6
+.LVL19:
+	.loc 1 77 50 view .LVU72
+	mulss	%xmm8, %xmm1
+.LVL20:
+	.loc 1 73 36 view .LVU73
+	subss	%xmm9, %xmm0
+.LVL21:
+	.loc 1 76 38 view .LVU74
+	subss	%xmm6, %xmm3
+.LVL22:
+	.loc 1 68 25 view .LVU75
+	unpcklps	%xmm2, %xmm0
+	.loc 1 77 38 view .LVU76
+	addss	%xmm7, %xmm1
+	.loc 1 68 25 view .LVU77
+	unpcklps	%xmm1, %xmm3
+	movlhps	%xmm3, %xmm0
+	movaps	%xmm0, 16+boardRotation(%rip)
+	.loc 1 78 5 is_stmt 1 view .LVU78
+	.loc 1 79 1 is_stmt 0 view .LVU79
+	addq	$32, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL23:
+	.loc 1 79 1 view .LVU80
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 79 1 view .LVU81
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL25:
+	.loc 1 79 1 view .LVU82
+	ret
+.LVL26:
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	.cfi_restore_state
+.LBB9:
+.LBB7:
+	.loc 1 35 74 view .LVU83
+	cmpw	$0, 4(%rbx)
+	jne	.L2
+.LBE7:
+.LBE9:
+	.loc 1 79 1 view .LVU84
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL27:
+	.loc 1 79 1 view .LVU85
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	initBoardAlignment, .-initBoardAlignment
+	.section	.text.alignSensors,"ax",@progbits
+	.p2align 4
+	.globl	alignSensors
+	.type	alignSensors, @function
+alignSensors:
+.LVL28:
+.LFB3:
+	.loc 1 93 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 94 5 view .LVU87
+	.loc 1 95 5 view .LVU88
+	.loc 1 93 1 is_stmt 0 view .LVU89
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rsi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 95 5 view .LVU90
+	movl	(%rdi), %eax
+	movl	%eax, swap.0(%rip)
+	movzwl	4(%rdi), %eax
+	movw	%ax, 4+swap.0(%rip)
+	.loc 1 97 5 is_stmt 1 view .LVU91
+	cmpb	$8, %dl
+	ja	.L9
+	leaq	.L11(%rip), %rcx
+	movzbl	%dl, %edx
+	.loc 1 97 5 is_stmt 0 view .LVU92
+	movslq	(%rcx,%rdx,4), %rax
+	addq	%rcx, %rax
+	jmp	*%rax
+	.section	.rodata.alignSensors,"a",@progbits
+	.align 4
+	.align 4
+.L11:
+	.long	.L9-.L11
+	.long	.L18-.L11
+	.long	.L17-.L11
+	.long	.L16-.L11
+	.long	.L15-.L11
+	.long	.L14-.L11
+	.long	.L13-.L11
+	.long	.L12-.L11
+	.long	.L10-.L11
+	.section	.text.alignSensors
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.loc 1 134 13 is_stmt 1 view .LVU93
+	.loc 1 134 21 is_stmt 0 view .LVU94
+	movzwl	2+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, (%rsi)
+	.loc 1 135 13 is_stmt 1 view .LVU95
+	.loc 1 135 21 is_stmt 0 view .LVU96
+	movzwl	swap.0(%rip), %eax
+.LVL29:
+.L21:
+	.loc 1 135 21 view .LVU97
+	negl	%eax
+	movw	%ax, 2(%rbx)
+	.loc 1 136 13 is_stmt 1 view .LVU98
+	.loc 1 136 21 is_stmt 0 view .LVU99
+	movzwl	4+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, 4(%rbx)
+	.loc 1 137 13 is_stmt 1 view .LVU100
+.LVL30:
+.L9:
+	.loc 1 142 5 view .LVU101
+	.loc 1 142 8 is_stmt 0 view .LVU102
+	cmpb	$0, standardBoardAlignment(%rip)
+	je	.L22
+	.loc 1 144 1 view .LVU103
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL31:
+	.loc 1 144 1 view .LVU104
+	ret
+.LVL32:
+	.p2align 4,,10
+	.p2align 3
+.L22:
+	.cfi_restore_state
+	.loc 1 143 9 is_stmt 1 view .LVU105
+.LBB12:
+.LBI12:
+	.loc 1 81 13 view .LVU106
+.LBB13:
+	.loc 1 83 5 view .LVU107
+	.loc 1 84 5 view .LVU108
+	.loc 1 85 5 view .LVU109
+	.loc 1 87 5 view .LVU110
+	.loc 1 87 41 is_stmt 0 view .LVU111
+	movswl	(%rbx), %eax
+	pxor	%xmm1, %xmm1
+	.loc 1 87 67 view .LVU112
+	pxor	%xmm3, %xmm3
+	.loc 1 87 93 view .LVU113
+	pxor	%xmm2, %xmm2
+	.loc 1 87 41 view .LVU114
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 87 67 view .LVU115
+	movswl	2(%rbx), %eax
+	cvtsi2ssl	%eax, %xmm3
+	.loc 1 87 93 view .LVU116
+	movswl	4(%rbx), %eax
+	.loc 1 87 41 view .LVU117
+	movaps	%xmm1, %xmm0
+	.loc 1 87 93 view .LVU118
+	cvtsi2ssl	%eax, %xmm2
+	.loc 1 87 41 view .LVU119
+	movss	%xmm1, 12(%rsp)
+	mulss	boardRotation(%rip), %xmm0
+	.loc 1 87 67 view .LVU120
+	movaps	%xmm3, %xmm4
+	movss	%xmm3, 8(%rsp)
+	mulss	12+boardRotation(%rip), %xmm4
+	.loc 1 87 93 view .LVU121
+	movss	%xmm2, 4(%rsp)
+	.loc 1 87 45 view .LVU122
+	addss	%xmm4, %xmm0
+	.loc 1 87 93 view .LVU123
+	movaps	%xmm2, %xmm4
+	mulss	24+boardRotation(%rip), %xmm4
+	.loc 1 87 14 view .LVU124
+	addss	%xmm4, %xmm0
+	call	lrintf@PLT
+.LVL33:
+	.loc 1 88 41 view .LVU125
+	movss	12(%rsp), %xmm1
+	.loc 1 88 67 view .LVU126
+	movss	8(%rsp), %xmm3
+	.loc 1 88 41 view .LVU127
+	movss	4+boardRotation(%rip), %xmm0
+	.loc 1 88 67 view .LVU128
+	movss	16+boardRotation(%rip), %xmm4
+	.loc 1 87 12 view .LVU129
+	movw	%ax, (%rbx)
+	.loc 1 88 5 is_stmt 1 view .LVU130
+	.loc 1 88 93 is_stmt 0 view .LVU131
+	movss	4(%rsp), %xmm2
+	.loc 1 88 67 view .LVU132
+	mulss	%xmm3, %xmm4
+	.loc 1 88 41 view .LVU133
+	mulss	%xmm1, %xmm0
+	.loc 1 88 45 view .LVU134
+	addss	%xmm4, %xmm0
+	.loc 1 88 93 view .LVU135
+	movss	28+boardRotation(%rip), %xmm4
+	mulss	%xmm2, %xmm4
+	.loc 1 88 14 view .LVU136
+	addss	%xmm4, %xmm0
+	call	lrintf@PLT
+.LVL34:
+	.loc 1 89 41 view .LVU137
+	movss	12(%rsp), %xmm1
+	.loc 1 89 67 view .LVU138
+	movss	8(%rsp), %xmm3
+	.loc 1 89 41 view .LVU139
+	mulss	8+boardRotation(%rip), %xmm1
+	.loc 1 89 93 view .LVU140
+	movss	4(%rsp), %xmm2
+	.loc 1 88 12 view .LVU141
+	movw	%ax, 2(%rbx)
+	.loc 1 89 5 is_stmt 1 view .LVU142
+	.loc 1 89 67 is_stmt 0 view .LVU143
+	mulss	20+boardRotation(%rip), %xmm3
+	.loc 1 89 93 view .LVU144
+	mulss	32+boardRotation(%rip), %xmm2
+	.loc 1 89 45 view .LVU145
+	addss	%xmm3, %xmm1
+	.loc 1 89 14 view .LVU146
+	addss	%xmm2, %xmm1
+	movaps	%xmm1, %xmm0
+	call	lrintf@PLT
+.LVL35:
+	.loc 1 89 12 view .LVU147
+	movw	%ax, 4(%rbx)
+.LVL36:
+	.loc 1 89 12 view .LVU148
+.LBE13:
+.LBE12:
+	.loc 1 144 1 view .LVU149
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL37:
+	.loc 1 144 1 view .LVU150
+	ret
+.LVL38:
+	.p2align 4,,10
+	.p2align 3
+.L18:
+	.cfi_restore_state
+	.loc 1 99 13 is_stmt 1 view .LVU151
+	.loc 1 99 21 is_stmt 0 view .LVU152
+	movzwl	swap.0(%rip), %eax
+	movw	%ax, (%rsi)
+	.loc 1 100 13 is_stmt 1 view .LVU153
+	.loc 1 100 21 is_stmt 0 view .LVU154
+	movzwl	2+swap.0(%rip), %eax
+	movw	%ax, 2(%rsi)
+	.loc 1 101 13 is_stmt 1 view .LVU155
+	.loc 1 101 21 is_stmt 0 view .LVU156
+	movzwl	4+swap.0(%rip), %eax
+	movw	%ax, 4(%rsi)
+	.loc 1 102 13 is_stmt 1 view .LVU157
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L17:
+	.loc 1 104 13 view .LVU158
+	.loc 1 104 21 is_stmt 0 view .LVU159
+	movzwl	2+swap.0(%rip), %eax
+	movw	%ax, (%rsi)
+	.loc 1 105 13 is_stmt 1 view .LVU160
+	.loc 1 105 21 is_stmt 0 view .LVU161
+	movzwl	swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, 2(%rsi)
+	.loc 1 106 13 is_stmt 1 view .LVU162
+	.loc 1 106 21 is_stmt 0 view .LVU163
+	movzwl	4+swap.0(%rip), %eax
+	movw	%ax, 4(%rsi)
+	.loc 1 107 13 is_stmt 1 view .LVU164
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 109 13 view .LVU165
+	.loc 1 109 21 is_stmt 0 view .LVU166
+	movzwl	swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, (%rsi)
+	.loc 1 110 13 is_stmt 1 view .LVU167
+	.loc 1 110 21 is_stmt 0 view .LVU168
+	movzwl	2+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, 2(%rsi)
+	.loc 1 111 13 is_stmt 1 view .LVU169
+	.loc 1 111 21 is_stmt 0 view .LVU170
+	movzwl	4+swap.0(%rip), %eax
+	movw	%ax, 4(%rsi)
+	.loc 1 112 13 is_stmt 1 view .LVU171
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L15:
+	.loc 1 114 13 view .LVU172
+	.loc 1 114 21 is_stmt 0 view .LVU173
+	movzwl	2+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, (%rsi)
+	.loc 1 115 13 is_stmt 1 view .LVU174
+	.loc 1 115 21 is_stmt 0 view .LVU175
+	movzwl	swap.0(%rip), %eax
+	movw	%ax, 2(%rsi)
+	.loc 1 116 13 is_stmt 1 view .LVU176
+	.loc 1 116 21 is_stmt 0 view .LVU177
+	movzwl	4+swap.0(%rip), %eax
+	movw	%ax, 4(%rsi)
+	.loc 1 117 13 is_stmt 1 view .LVU178
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.loc 1 119 13 view .LVU179
+	.loc 1 119 21 is_stmt 0 view .LVU180
+	movzwl	swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, (%rsi)
+	.loc 1 120 13 is_stmt 1 view .LVU181
+	.loc 1 120 21 is_stmt 0 view .LVU182
+	movzwl	2+swap.0(%rip), %eax
+	movw	%ax, 2(%rsi)
+	.loc 1 121 13 is_stmt 1 view .LVU183
+	.loc 1 121 21 is_stmt 0 view .LVU184
+	movzwl	4+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, 4(%rsi)
+	.loc 1 122 13 is_stmt 1 view .LVU185
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 124 13 view .LVU186
+	.loc 1 124 21 is_stmt 0 view .LVU187
+	movzwl	2+swap.0(%rip), %eax
+	movw	%ax, (%rsi)
+	.loc 1 125 13 is_stmt 1 view .LVU188
+	.loc 1 125 21 is_stmt 0 view .LVU189
+	movzwl	swap.0(%rip), %eax
+	movw	%ax, 2(%rsi)
+	.loc 1 126 13 is_stmt 1 view .LVU190
+	.loc 1 126 21 is_stmt 0 view .LVU191
+	movzwl	4+swap.0(%rip), %eax
+	negl	%eax
+	movw	%ax, 4(%rsi)
+	.loc 1 127 13 is_stmt 1 view .LVU192
+	jmp	.L9
+	.p2align 4,,10
+	.p2align 3
+.L12:
+	.loc 1 129 13 view .LVU193
+	.loc 1 129 21 is_stmt 0 view .LVU194
+	movzwl	swap.0(%rip), %eax
+	movw	%ax, (%rsi)
+	.loc 1 130 13 is_stmt 1 view .LVU195
+	.loc 1 130 21 is_stmt 0 view .LVU196
+	movzwl	2+swap.0(%rip), %eax
+	jmp	.L21
+	.cfi_endproc
+.LFE3:
+	.size	alignSensors, .-alignSensors
+	.section	.bss.swap.0,"aw",@nobits
+	.align 2
+	.type	swap.0, @object
+	.size	swap.0, 6
+swap.0:
+	.zero	6
+	.section	.bss.boardRotation,"aw",@nobits
+	.align 32
+	.type	boardRotation, @object
+	.size	boardRotation, 36
+boardRotation:
+	.zero	36
+	.section	.data.standardBoardAlignment,"aw"
+	.type	standardBoardAlignment, @object
+	.size	standardBoardAlignment, 1
+standardBoardAlignment:
+	.byte	1
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 ".//src/main/common/axis.h"
+	.file 7 ".//src/main/sensors/sensors.h"
+	.file 8 ".//src/main/sensors/boardalignment.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 ".//src/main/common/maths.h"
+	.file 12 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x54b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1194
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL21
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1137
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1138
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1139
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1140
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1141
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1142
+	.uleb128 0x4
+	.long	.LASF1143
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x4
+	.long	.LASF1144
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x70
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1145
+	.uleb128 0x4
+	.long	.LASF1146
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1147
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1148
+	.uleb128 0x4
+	.long	.LASF1149
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1150
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF1151
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1152
+	.uleb128 0x4
+	.long	.LASF1153
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x4a
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x6
+	.byte	0x14
+	.long	0xe9
+	.uleb128 0xa
+	.string	"X"
+	.byte	0
+	.uleb128 0xa
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xa
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x7
+	.byte	0x22
+	.long	0x12b
+	.uleb128 0x3
+	.long	.LASF1154
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1155
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1156
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1157
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1158
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1160
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1161
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1162
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1195
+	.byte	0x6
+	.byte	0x8
+	.byte	0x14
+	.byte	0x10
+	.long	0x15a
+	.uleb128 0xb
+	.long	.LASF1163
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1164
+	.byte	0x16
+	.long	0x9a
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF1165
+	.byte	0x17
+	.long	0x9a
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1166
+	.byte	0x8
+	.byte	0x18
+	.byte	0x3
+	.long	0x12b
+	.uleb128 0xc
+	.long	.LASF1168
+	.byte	0x1e
+	.byte	0xc
+	.long	0x17b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	standardBoardAlignment
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1167
+	.uleb128 0x12
+	.long	0x2e
+	.long	0x196
+	.uleb128 0xd
+	.long	0x4a
+	.uleb128 0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1169
+	.byte	0x1f
+	.byte	0xe
+	.long	0x182
+	.uleb128 0x9
+	.byte	0x3
+	.quad	boardRotation
+	.uleb128 0x1b
+	.long	.LASF1170
+	.byte	0x9
+	.value	0x13d
+	.byte	0x11
+	.long	0x8a
+	.long	0x1c2
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1171
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0x91
+	.long	0x1e2
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x5
+	.long	0x1e2
+	.uleb128 0x5
+	.long	0xc5
+	.byte	0
+	.uleb128 0xe
+	.long	0x1e7
+	.uleb128 0x1c
+	.uleb128 0x8
+	.long	.LASF1172
+	.byte	0x9
+	.byte	0x40
+	.byte	0xf
+	.long	0x2e
+	.long	0x1fe
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1173
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xf
+	.long	0x2e
+	.long	0x214
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1174
+	.byte	0xb
+	.byte	0x34
+	.byte	0x7
+	.long	0x2e
+	.long	0x22a
+	.uleb128 0x5
+	.long	0x9a
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1178
+	.byte	0x5c
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x313
+	.uleb128 0x1d
+	.string	"src"
+	.byte	0x1
+	.byte	0x5c
+	.byte	0x1c
+	.long	0x313
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xf
+	.long	.LASF1175
+	.byte	0x5c
+	.byte	0x2a
+	.long	0x313
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xf
+	.long	.LASF1176
+	.byte	0x5c
+	.byte	0x38
+	.long	0xa6
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xc
+	.long	.LASF1177
+	.byte	0x5e
+	.byte	0x15
+	.long	0x318
+	.uleb128 0x9
+	.byte	0x3
+	.quad	swap.0
+	.uleb128 0x1e
+	.long	0x327
+	.quad	.LBI12
+	.byte	.LVU106
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.byte	0x1
+	.byte	0x8f
+	.byte	0x9
+	.uleb128 0x14
+	.long	0x334
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x10
+	.long	0x340
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x10
+	.long	0x349
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x10
+	.long	0x352
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x6
+	.quad	.LVL33
+	.long	0x1ab
+	.uleb128 0x6
+	.quad	.LVL34
+	.long	0x1ab
+	.uleb128 0x6
+	.quad	.LVL35
+	.long	0x1ab
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x9a
+	.uleb128 0x12
+	.long	0xb2
+	.long	0x327
+	.uleb128 0xd
+	.long	0x4a
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1196
+	.byte	0x1
+	.byte	0x51
+	.byte	0xd
+	.byte	0x1
+	.long	0x35c
+	.uleb128 0x20
+	.string	"vec"
+	.byte	0x1
+	.byte	0x51
+	.byte	0x21
+	.long	0x313
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x53
+	.byte	0xd
+	.long	0x9a
+	.uleb128 0x9
+	.string	"y"
+	.byte	0x54
+	.byte	0xd
+	.long	0x9a
+	.uleb128 0x9
+	.string	"z"
+	.byte	0x55
+	.byte	0xd
+	.long	0x9a
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1179
+	.byte	0x26
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x520
+	.uleb128 0xf
+	.long	.LASF1180
+	.byte	0x26
+	.byte	0x2b
+	.long	0x520
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x15
+	.long	.LASF1182
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x9
+	.string	"yaw"
+	.byte	0x28
+	.byte	0x18
+	.long	0x2e
+	.uleb128 0x2
+	.long	.LASF1183
+	.byte	0x29
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x29
+	.byte	0x11
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x29
+	.byte	0x17
+	.long	0x2e
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x29
+	.byte	0x1d
+	.long	0x2e
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0x29
+	.byte	0x23
+	.long	0x2e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0x29
+	.byte	0x29
+	.long	0x2e
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x2
+	.long	.LASF1189
+	.byte	0x2a
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x2
+	.long	.LASF1190
+	.byte	0x2a
+	.byte	0x15
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x2a
+	.byte	0x1f
+	.long	0x2e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x2
+	.long	.LASF1192
+	.byte	0x2a
+	.byte	0x29
+	.long	0x2e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x2a
+	.byte	0x33
+	.long	0x2e
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x21
+	.long	0x525
+	.quad	.LBI4
+	.byte	.LVU5
+	.long	.LLRL12
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x9
+	.long	0x4a2
+	.uleb128 0x14
+	.long	0x536
+	.long	.LLST13
+	.long	.LVUS13
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL3
+	.long	0x214
+	.uleb128 0x16
+	.quad	.LVL4
+	.long	0x543
+	.long	0x4cd
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL6
+	.long	0x214
+	.uleb128 0x16
+	.quad	.LVL7
+	.long	0x543
+	.long	0x4f8
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x6
+	.quad	.LVL9
+	.long	0x214
+	.uleb128 0x22
+	.quad	.LVL10
+	.long	0x543
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x15a
+	.uleb128 0x23
+	.long	.LASF1197
+	.byte	0x1
+	.byte	0x21
+	.byte	0xc
+	.long	0x17b
+	.byte	0x1
+	.long	0x543
+	.uleb128 0x24
+	.long	.LASF1180
+	.byte	0x1
+	.byte	0x21
+	.byte	0x37
+	.long	0x520
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1198
+	.long	.LASF1199
+	.byte	0xc
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 40
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU125
+	.uleb128 .LVU125
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST14:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL33-1-.LVL28
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-1-.LVL28
+	.uleb128 .LVL38-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL28
+	.uleb128 .LFE3-.LVL28
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 0
+.LLST15:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL29-.LVL28
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL29-.LVL28
+	.uleb128 .LVL31-.LVL28
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.LVL28
+	.uleb128 .LVL32-.LVL28
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.LVL28
+	.uleb128 .LVL37-.LVL28
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.LVL28
+	.uleb128 .LVL38-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL28
+	.uleb128 .LFE3-.LVL28
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 0
+.LLST16:
+	.byte	0x6
+	.quad	.LVL28
+	.byte	0x4
+	.uleb128 .LVL28-.LVL28
+	.uleb128 .LVL30-.LVL28
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL30-.LVL28
+	.uleb128 .LFE3-.LVL28
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU106
+	.uleb128 .LVU148
+.LLST17:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL36-.LVL32
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU108
+	.uleb128 .LVU125
+.LLST18:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-1-.LVL32
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU109
+	.uleb128 .LVU125
+.LLST19:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-1-.LVL32
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 2
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU110
+	.uleb128 .LVU125
+.LLST20:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-1-.LVL32
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 4
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL23-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL23-.LVL0
+	.uleb128 .LVL26-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL0
+	.uleb128 .LVL27-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.LVL0
+	.uleb128 .LFE1-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU29
+	.uleb128 .LVU64
+	.uleb128 .LVU64
+	.uleb128 .LVU83
+.LLST1:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL17-.LVL11
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL17-.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU30
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU83
+.LLST2:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL12-.LVL11
+	.uleb128 .LVL13-.LVL11
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL13-.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU31
+	.uleb128 .LVU83
+.LLST3:
+	.byte	0x8
+	.quad	.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x1
+	.byte	0x66
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU32
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU83
+.LLST4:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL20-.LVL11
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL20-.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU33
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+.LLST5:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL16-.LVL11
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL16-.LVL11
+	.uleb128 .LVL25-.LVL11
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL25-.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU34
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+.LLST6:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL14-.LVL11
+	.uleb128 0x1
+	.byte	0x6b
+	.byte	0x4
+	.uleb128 .LVL14-.LVL11
+	.uleb128 .LVL24-.LVL11
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL24-.LVL11
+	.uleb128 .LVL26-.LVL11
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU49
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+.LLST7:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL19-.LVL15
+	.uleb128 0x1
+	.byte	0x67
+	.byte	0x4
+	.uleb128 .LVL19-.LVL15
+	.uleb128 .LVL21-.LVL15
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL21-.LVL15
+	.uleb128 .LVL25-.LVL15
+	.uleb128 0xc
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0xc
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU50
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+.LLST8:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x8
+	.byte	0xa5
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0xa5
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL18-.LVL15
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL18-.LVL15
+	.uleb128 .LVL25-.LVL15
+	.uleb128 0xa
+	.byte	0xa5
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0xa
+	.byte	0xa5
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU51
+	.uleb128 .LVU83
+.LLST9:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0x1
+	.byte	0x69
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU52
+	.uleb128 .LVU83
+.LLST10:
+	.byte	0x8
+	.quad	.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU53
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU83
+.LLST11:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL22-.LVL15
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL22-.LVL15
+	.uleb128 .LVL24-.LVL15
+	.uleb128 0xc
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL15
+	.uleb128 .LVL26-.LVL15
+	.uleb128 0xc
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU5
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU11
+	.uleb128 .LVU83
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL2-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.LVL0
+	.uleb128 .LVL27-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.LVL0
+	.uleb128 .LFE1-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x3c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB4
+	.byte	0x4
+	.uleb128 .LBB4-.LBB4
+	.uleb128 .LBE4-.LBB4
+	.byte	0x4
+	.uleb128 .LBB8-.LBB4
+	.uleb128 .LBE8-.LBB4
+	.byte	0x4
+	.uleb128 .LBB9-.LBB4
+	.uleb128 .LBE9-.LBB4
+	.byte	0
+.LLRL21:
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 29 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF972
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF999
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1118
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1119
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1133
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF964
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF971
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF993
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF998
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1001
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1003
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1018
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1018
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1028
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1092
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1095
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1117
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1094
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1117
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.df293132ceab5572a941cf7402f7191e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1132
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.99147b604c3c17d87d371a4dbbfdb583,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1136
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF772:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1176:
+	.string	"rotation"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF967:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF935:
+	.string	"__DECL_SIMD_asinh "
+.LASF1153:
+	.string	"size_t"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1068:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF980:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF933:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF987:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1197:
+	.string	"isBoardAlignmentStandard"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1157:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF900:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF821:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF791:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF855:
+	.string	"__DECL_SIMD_atan2 "
+.LASF747:
+	.string	"__DECL_SIMD_powl "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF806:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF779:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1083:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1149:
+	.string	"int16_t"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF996:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1154:
+	.string	"ALIGN_DEFAULT"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF793:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF750:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1092:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF823:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF774:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1076:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF895:
+	.string	"__DECL_SIMD_atanh "
+.LASF949:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1082:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1124:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF731:
+	.string	"__DECL_SIMD_logf128 "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF898:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1131:
+	.string	"acos_approx(x) acosf(x)"
+.LASF1086:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF962:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1058:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1195:
+	.string	"boardAlignment_s"
+.LASF1166:
+	.string	"boardAlignment_t"
+.LASF974:
+	.string	"__HAVE_FLOAT32 1"
+.LASF956:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1111:
+	.string	"_GCC_SIZE_T "
+.LASF763:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1101:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF733:
+	.string	"__DECL_SIMD_logf64x "
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF885:
+	.string	"__DECL_SIMD_log1p "
+.LASF1056:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1119:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1162:
+	.string	"CW270_DEG_FLIP"
+.LASF1049:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1081:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF754:
+	.string	"__DECL_SIMD_powf128x "
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF939:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF937:
+	.string	"__DECL_SIMD_asinhl "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1036:
+	.string	"_Mdouble_ _Float32x"
+.LASF1159:
+	.string	"CW0_DEG_FLIP"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1060:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF777:
+	.string	"__DECL_SIMD_asinl "
+.LASF822:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1008:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF717:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF981:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1147:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1001:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1048:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1043:
+	.string	"__MATHDECL"
+.LASF1137:
+	.string	"float"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1072:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1023:
+	.string	"_Mdouble_ float"
+.LASF925:
+	.string	"__DECL_SIMD_tanh "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF896:
+	.string	"__DECL_SIMD_atanhf "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1017:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1020:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF785:
+	.string	"__DECL_SIMD_hypot "
+.LASF1051:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF819:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF841:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1165:
+	.string	"yawDegrees"
+.LASF697:
+	.string	"__DECL_SIMD_cosl "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1063:
+	.string	"FP_SUBNORMAL 3"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1042:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF985:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF727:
+	.string	"__DECL_SIMD_logl "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF874:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF721:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1142:
+	.string	"signed char"
+.LASF876:
+	.string	"__DECL_SIMD_log2f "
+.LASF1150:
+	.string	"uint8_t"
+.LASF1022:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF989:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF803:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1180:
+	.string	"boardAlignment"
+.LASF758:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF884:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1069:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF870:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1026:
+	.string	"_Mdouble_ long double"
+.LASF1138:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF735:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1132:
+	.string	"invSqrt_approx(x) (1.0f / sqrtf(x))"
+.LASF789:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF807:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1019:
+	.string	"_Mdouble_"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF893:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1091:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF995:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF998:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1198:
+	.string	"sincosf"
+.LASF1167:
+	.string	"_Bool"
+.LASF784:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1136:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1105:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1115:
+	.string	"NULL"
+.LASF1155:
+	.string	"CW0_DEG"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1173:
+	.string	"cosf"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF828:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1169:
+	.string	"boardRotation"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF971:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1078:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1183:
+	.string	"cosx"
+.LASF1185:
+	.string	"cosy"
+.LASF1187:
+	.string	"cosz"
+.LASF760:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1007:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF765:
+	.string	"__DECL_SIMD_atan "
+.LASF856:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1066:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1031:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF938:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF875:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1146:
+	.string	"__uint16_t"
+.LASF943:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF706:
+	.string	"__DECL_SIMD_sinf "
+.LASF1193:
+	.string	"sinzsinx"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1172:
+	.string	"sinf"
+.LASF1061:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF811:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF761:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF801:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1184:
+	.string	"sinx"
+.LASF1186:
+	.string	"siny"
+.LASF1188:
+	.string	"sinz"
+.LASF699:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1122:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1108:
+	.string	"_SIZE_T_DECLARED "
+.LASF936:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF799:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1125:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF990:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF909:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF917:
+	.string	"__DECL_SIMD_erfl "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1062:
+	.string	"FP_ZERO 2"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF1018:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1088:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF739:
+	.string	"__DECL_SIMD_expf32 "
+.LASF850:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF782:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF813:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1179:
+	.string	"initBoardAlignment"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1107:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1114:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1094:
+	.string	"__need_size_t "
+.LASF910:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF881:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF947:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1143:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF903:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF769:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF897:
+	.string	"__DECL_SIMD_atanhl "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF698:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1021:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF882:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1015:
+	.string	"_Mdouble_ double"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1038:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF946:
+	.string	"__DECL_SIMD_erfcf "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF887:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1116:
+	.string	"NULL ((void *)0)"
+.LASF1164:
+	.string	"pitchDegrees"
+.LASF883:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF740:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF775:
+	.string	"__DECL_SIMD_asin "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1174:
+	.string	"degreesToRadians"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1028:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF860:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF824:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1163:
+	.string	"rollDegrees"
+.LASF796:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1067:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF753:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF877:
+	.string	"__DECL_SIMD_log2l "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF901:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF932:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF999:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF704:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF805:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1039:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF978:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF961:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF701:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF749:
+	.string	"__DECL_SIMD_powf32 "
+.LASF906:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF830:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1178:
+	.string	"alignSensors"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF868:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1095:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF738:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1009:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1057:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1071:
+	.string	"MATH_ERRNO 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF948:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF848:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1158:
+	.string	"CW270_DEG"
+.LASF963:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1013:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF964:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF992:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF756:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF726:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1077:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1089:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF866:
+	.string	"__DECL_SIMD_log10f "
+.LASF867:
+	.string	"__DECL_SIMD_log10l "
+.LASF857:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1041:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF745:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF991:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF707:
+	.string	"__DECL_SIMD_sinl "
+.LASF1192:
+	.string	"coszsinx"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF849:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1080:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF1100:
+	.string	"_T_SIZE_ "
+.LASF1103:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF908:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1075:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1099:
+	.string	"_SYS_SIZE_T_H "
+.LASF845:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF810:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1011:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF695:
+	.string	"__DECL_SIMD_cos "
+.LASF1129:
+	.string	"cos_approx(x) cosf(x)"
+.LASF984:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF711:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF846:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF836:
+	.string	"__DECL_SIMD_sinhf "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1152:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF724:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1199:
+	.string	"__builtin_sincosf"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF462:
+	.string	"__PMT"
+.LASF1050:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF752:
+	.string	"__DECL_SIMD_powf32x "
+.LASF905:
+	.string	"__DECL_SIMD_acosh "
+.LASF1025:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF872:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF954:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1033:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF970:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1096:
+	.string	"__size_t__ "
+.LASF773:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1029:
+	.string	"_Mdouble_ _Float32"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF953:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF742:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1079:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF825:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF899:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF891:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF826:
+	.string	"__DECL_SIMD_expm1f "
+.LASF966:
+	.string	"__HAVE_FLOAT128 1"
+.LASF869:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF808:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1140:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF940:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF930:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1037:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1040:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1170:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1014:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1090:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF734:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF960:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1191:
+	.string	"sinzcosx"
+.LASF865:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF741:
+	.string	"__DECL_SIMD_expf128 "
+.LASF880:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF716:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF797:
+	.string	"__DECL_SIMD_exp2l "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF746:
+	.string	"__DECL_SIMD_powf "
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF748:
+	.string	"__DECL_SIMD_powf16 "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1121:
+	.string	"sq(x) ((x)*(x))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF743:
+	.string	"__DECL_SIMD_expf64x "
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF730:
+	.string	"__DECL_SIMD_logf64 "
+.LASF833:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF983:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF723:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1110:
+	.string	"___int_size_t_h "
+.LASF928:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1120:
+	.string	"_STRINGS_H 1"
+.LASF712:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF977:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1055:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF890:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF907:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1128:
+	.string	"sin_approx(x) sinf(x)"
+.LASF911:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF831:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF794:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF546:
+	.string	"__stub_revoke "
+.LASF1148:
+	.string	"char"
+.LASF737:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1098:
+	.string	"_SIZE_T "
+.LASF920:
+	.string	"__DECL_SIMD_erff64 "
+.LASF816:
+	.string	"__DECL_SIMD_coshf "
+.LASF751:
+	.string	"__DECL_SIMD_powf128 "
+.LASF878:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF840:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF781:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF800:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1102:
+	.string	"__SIZE_T "
+.LASF889:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF725:
+	.string	"__DECL_SIMD_log "
+.LASF757:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1085:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF693:
+	.string	"_MATH_H 1"
+.LASF969:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF957:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF871:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF728:
+	.string	"__DECL_SIMD_logf16 "
+.LASF755:
+	.string	"__DECL_SIMD_acos "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF958:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF783:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF888:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1065:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF926:
+	.string	"__DECL_SIMD_tanhf "
+.LASF379:
+	.string	"SITL 1"
+.LASF768:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1177:
+	.string	"swap"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1106:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1151:
+	.string	"uint16_t"
+.LASF720:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1059:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1070:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1141:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF873:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF837:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF714:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1003:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1045:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF918:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1012:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1133:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1010:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1113:
+	.string	"__size_t "
+.LASF859:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF795:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1109:
+	.string	"__DEFINED_size_t "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF790:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1194:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF979:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF809:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1104:
+	.string	"_BSD_SIZE_T_ "
+.LASF1117:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF703:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF975:
+	.string	"__HAVE_FLOAT64 1"
+.LASF951:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF694:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1144:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF827:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1093:
+	.string	"_STRING_H 1"
+.LASF736:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF718:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF997:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1175:
+	.string	"dest"
+.LASF924:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1030:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF965:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF764:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF847:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1134:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF843:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF916:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1196:
+	.string	"alignBoard"
+.LASF778:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF968:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1189:
+	.string	"coszcosx"
+.LASF1190:
+	.string	"coszcosy"
+.LASF941:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1112:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF705:
+	.string	"__DECL_SIMD_sin "
+.LASF1064:
+	.string	"FP_NORMAL 4"
+.LASF1130:
+	.string	"atan2_approx(y,x) atan2f(y, x)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF994:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF972:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF976:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF986:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1046:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF834:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF696:
+	.string	"__DECL_SIMD_cosf "
+.LASF719:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1027:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF709:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF766:
+	.string	"__DECL_SIMD_atanf "
+.LASF1127:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF886:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1034:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1145:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1073:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF915:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF814:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF798:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF921:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF861:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF817:
+	.string	"__DECL_SIMD_coshl "
+.LASF786:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1087:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1006:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF820:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1160:
+	.string	"CW90_DEG_FLIP"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF744:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF780:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1118:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1097:
+	.string	"__SIZE_T__ "
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF945:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1044:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF710:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF988:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1123:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF923:
+	.string	"__DECL_SIMD_erff64x "
+.LASF863:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1161:
+	.string	"CW180_DEG_FLIP"
+.LASF770:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1000:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF815:
+	.string	"__DECL_SIMD_cosh "
+.LASF858:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF982:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF955:
+	.string	"__DECL_SIMD_tan "
+.LASF1171:
+	.string	"memcpy"
+.LASF1052:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1053:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1135:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF931:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF927:
+	.string	"__DECL_SIMD_tanhl "
+.LASF771:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF929:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1139:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF829:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF818:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF973:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1126:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1047:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF715:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF879:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF959:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1004:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF708:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF919:
+	.string	"__DECL_SIMD_erff32 "
+.LASF902:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1005:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF759:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF713:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1032:
+	.string	"_Mdouble_ _Float64"
+.LASF1182:
+	.string	"pitch"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1181:
+	.string	"roll"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF950:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF776:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF767:
+	.string	"__DECL_SIMD_atanl "
+.LASF729:
+	.string	"__DECL_SIMD_logf32 "
+.LASF922:
+	.string	"__DECL_SIMD_erff32x "
+.LASF862:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF702:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1016:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF993:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1084:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF762:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF788:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1054:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF732:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1168:
+	.string	"standardBoardAlignment"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1002:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1035:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF839:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1024:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1156:
+	.string	"CW90_DEG"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1074:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF913:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF700:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	".//src/main/sensors/boardalignment.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
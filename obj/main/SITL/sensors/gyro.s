@@ -0,0 +1,11832 @@
+	.file	"gyro.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/sensors/gyro.c"
+	.section	.text.useGyroConfig,"ax",@progbits
+	.p2align 4
+	.globl	useGyroConfig
+	.type	useGyroConfig, @function
+useGyroConfig:
+.LVL0:
+.LFB11:
+	.file 1 ".//src/main/sensors/gyro.c"
+	.loc 1 64 1 view -0
+	.cfi_startproc
+	.loc 1 65 5 view .LVU1
+	.loc 1 65 16 is_stmt 0 view .LVU2
+	movq	%rdi, gyroConfig(%rip)
+	.loc 1 66 5 is_stmt 1 view .LVU3
+	.loc 1 66 27 is_stmt 0 view .LVU4
+	movb	$0, gyroFilterInitialised(%rip)
+	.loc 1 67 1 view .LVU5
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	useGyroConfig, .-useGyroConfig
+	.section	.text.gyroSetCalibrationCycles,"ax",@progbits
+	.p2align 4
+	.globl	gyroSetCalibrationCycles
+	.type	gyroSetCalibrationCycles, @function
+gyroSetCalibrationCycles:
+.LVL1:
+.LFB14:
+	.loc 1 101 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 102 5 view .LVU7
+	.loc 1 102 18 is_stmt 0 view .LVU8
+	movw	%di, calibratingG(%rip)
+	.loc 1 103 5 is_stmt 1 view .LVU9
+	.loc 1 103 23 is_stmt 0 view .LVU10
+	movw	%di, calibrationCycles(%rip)
+	.loc 1 104 5 is_stmt 1 view .LVU11
+	.loc 1 104 23 is_stmt 0 view .LVU12
+	movb	$0, checkingKnownZero(%rip)
+	.loc 1 105 1 view .LVU13
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	gyroSetCalibrationCycles, .-gyroSetCalibrationCycles
+	.section	.text.gyroStartBootCalibration,"ax",@progbits
+	.p2align 4
+	.globl	gyroStartBootCalibration
+	.type	gyroStartBootCalibration, @function
+gyroStartBootCalibration:
+.LVL2:
+.LFB15:
+	.loc 1 113 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 114 5 view .LVU15
+	.loc 1 114 18 is_stmt 0 view .LVU16
+	movq	%rdi, knownSensors(%rip)
+	.loc 1 116 5 is_stmt 1 view .LVU17
+	.loc 1 116 8 is_stmt 0 view .LVU18
+	testb	$1, 3(%rdi)
+	je	.L6
+	.loc 1 116 50 discriminator 1 view .LVU19
+	movzbl	gyroHardware(%rip), %eax
+	movl	$100, %edx
+	cmpb	%al, (%rdi)
+	movl	$1000, %eax
+	cmove	%edx, %eax
+	sete	%dl
+.L5:
+.LBB17:
+.LBB18:
+	.loc 1 102 18 view .LVU20
+	movw	%ax, calibratingG(%rip)
+	.loc 1 103 23 view .LVU21
+	movw	%ax, calibrationCycles(%rip)
+.LBE18:
+.LBE17:
+	.loc 1 118 27 view .LVU22
+	movb	%dl, checkingKnownZero(%rip)
+	.loc 1 122 1 view .LVU23
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L6:
+	movl	$1000, %eax
+	xorl	%edx, %edx
+	jmp	.L5
+	.cfi_endproc
+.LFE15:
+	.size	gyroStartBootCalibration, .-gyroStartBootCalibration
+	.section	.text.isGyroCalibrationComplete,"ax",@progbits
+	.p2align 4
+	.globl	isGyroCalibrationComplete
+	.type	isGyroCalibrationComplete, @function
+isGyroCalibrationComplete:
+.LFB16:
+	.loc 1 125 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 126 5 view .LVU25
+	.loc 1 126 25 is_stmt 0 view .LVU26
+	cmpw	$0, calibratingG(%rip)
+	sete	%al
+	.loc 1 127 1 view .LVU27
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	isGyroCalibrationComplete, .-isGyroCalibrationComplete
+	.section	.text.isOnFinalGyroCalibrationCycle,"ax",@progbits
+	.p2align 4
+	.globl	isOnFinalGyroCalibrationCycle
+	.type	isOnFinalGyroCalibrationCycle, @function
+isOnFinalGyroCalibrationCycle:
+.LFB17:
+	.loc 1 130 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 5 view .LVU29
+	.loc 1 131 25 is_stmt 0 view .LVU30
+	cmpw	$1, calibratingG(%rip)
+	sete	%al
+	.loc 1 132 1 view .LVU31
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	isOnFinalGyroCalibrationCycle, .-isOnFinalGyroCalibrationCycle
+	.section	.text.isOnFirstGyroCalibrationCycle,"ax",@progbits
+	.p2align 4
+	.globl	isOnFirstGyroCalibrationCycle
+	.type	isOnFirstGyroCalibrationCycle, @function
+isOnFirstGyroCalibrationCycle:
+.LFB18:
+	.loc 1 135 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 136 5 view .LVU33
+	.loc 1 136 25 is_stmt 0 view .LVU34
+	movzwl	calibrationCycles(%rip), %eax
+	cmpw	%ax, calibratingG(%rip)
+	sete	%al
+	.loc 1 137 1 view .LVU35
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	isOnFirstGyroCalibrationCycle, .-isOnFirstGyroCalibrationCycle
+	.section	.text.gyroAccumulateSample,"ax",@progbits
+	.p2align 4
+	.globl	gyroAccumulateSample
+	.type	gyroAccumulateSample, @function
+gyroAccumulateSample:
+.LFB24:
+	.loc 1 234 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 235 5 view .LVU37
+	.loc 1 236 5 view .LVU38
+	.loc 1 239 5 view .LVU39
+	.loc 1 234 1 is_stmt 0 view .LVU40
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 239 5 view .LVU41
+	leaq	10(%rsp), %rdi
+	call	*8+gyro(%rip)
+.LVL3:
+	.loc 1 240 5 is_stmt 1 view .LVU42
+	.loc 1 240 25 view .LVU43
+	.loc 1 241 9 view .LVU44
+	.loc 1 240 34 view .LVU45
+	.loc 1 240 25 view .LVU46
+	.loc 1 241 9 view .LVU47
+	.loc 1 241 35 is_stmt 0 view .LVU48
+	movswl	10(%rsp), %eax
+	.loc 1 241 26 view .LVU49
+	movq	gyroADCSum(%rip), %xmm1
+	.loc 1 243 20 view .LVU50
+	addb	$1, gyroADCSumCount(%rip)
+	.loc 1 241 35 view .LVU51
+	movd	%eax, %xmm0
+	movswl	12(%rsp), %eax
+	.loc 1 241 26 view .LVU52
+	movd	%eax, %xmm2
+	.loc 1 241 35 view .LVU53
+	movswl	14(%rsp), %eax
+	.loc 1 241 26 view .LVU54
+	addl	%eax, 8+gyroADCSum(%rip)
+	punpckldq	%xmm2, %xmm0
+	paddd	%xmm1, %xmm0
+	movq	%xmm0, gyroADCSum(%rip)
+	.loc 1 240 34 is_stmt 1 view .LVU55
+.LVL4:
+	.loc 1 240 25 view .LVU56
+	.loc 1 241 9 view .LVU57
+	.loc 1 240 34 view .LVU58
+	.loc 1 240 25 view .LVU59
+	.loc 1 243 5 view .LVU60
+	.loc 1 244 1 is_stmt 0 view .LVU61
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	gyroAccumulateSample, .-gyroAccumulateSample
+	.section	.text.gyroGetADC,"ax",@progbits
+	.p2align 4
+	.globl	gyroGetADC
+	.type	gyroGetADC, @function
+gyroGetADC:
+.LFB25:
+	.loc 1 247 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 5 view .LVU63
+	.loc 1 250 5 view .LVU64
+	.loc 1 247 1 is_stmt 0 view .LVU65
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 250 25 view .LVU66
+	movzbl	gyroADCSumCount(%rip), %ecx
+	.loc 1 250 8 view .LVU67
+	testb	%cl, %cl
+	je	.L46
+.L14:
+.LVL5:
+	.loc 1 255 9 is_stmt 1 view .LVU68
+	.loc 1 255 42 is_stmt 0 view .LVU69
+	movl	gyroADCSum(%rip), %eax
+	.loc 1 255 23 view .LVU70
+	leaq	gyroADC(%rip), %r15
+	.loc 1 258 21 view .LVU71
+	movb	$0, gyroADCSumCount(%rip)
+	.loc 1 260 5 view .LVU72
+	movq	%r15, %rsi
+	movq	%r15, %rdi
+	.loc 1 255 42 view .LVU73
+	cltd
+	idivl	%ecx
+	.loc 1 255 23 view .LVU74
+	movw	%ax, gyroADC(%rip)
+	.loc 1 256 9 is_stmt 1 view .LVU75
+	.loc 1 254 34 view .LVU76
+.LVL6:
+	.loc 1 254 25 view .LVU77
+	.loc 1 255 9 view .LVU78
+	.loc 1 255 42 is_stmt 0 view .LVU79
+	movl	4+gyroADCSum(%rip), %eax
+	.loc 1 256 26 view .LVU80
+	movq	$0, gyroADCSum(%rip)
+	.loc 1 255 42 view .LVU81
+	cltd
+	idivl	%ecx
+	.loc 1 255 23 view .LVU82
+	movw	%ax, 2+gyroADC(%rip)
+	.loc 1 256 9 is_stmt 1 view .LVU83
+	.loc 1 254 34 view .LVU84
+.LVL7:
+	.loc 1 254 25 view .LVU85
+	.loc 1 255 9 view .LVU86
+	.loc 1 255 42 is_stmt 0 view .LVU87
+	movl	8+gyroADCSum(%rip), %eax
+	.loc 1 256 26 view .LVU88
+	movl	$0, 8+gyroADCSum(%rip)
+	.loc 1 255 42 view .LVU89
+	cltd
+	idivl	%ecx
+	.loc 1 260 5 view .LVU90
+	movzbl	gyroAlign(%rip), %edx
+	.loc 1 255 23 view .LVU91
+	movw	%ax, 4+gyroADC(%rip)
+	.loc 1 256 9 is_stmt 1 view .LVU92
+	.loc 1 254 34 view .LVU93
+.LVL8:
+	.loc 1 254 25 view .LVU94
+	.loc 1 258 5 view .LVU95
+	.loc 1 260 5 view .LVU96
+	call	alignSensors@PLT
+.LVL9:
+	.loc 1 262 5 view .LVU97
+.LBB44:
+.LBI44:
+	.loc 1 124 5 view .LVU98
+.LBB45:
+	.loc 1 126 5 view .LVU99
+	.loc 1 126 25 is_stmt 0 view .LVU100
+	movzwl	calibratingG(%rip), %eax
+.LBE45:
+.LBE44:
+	.loc 1 262 8 view .LVU101
+	testw	%ax, %ax
+	jne	.L47
+.L15:
+.LVL10:
+.LBB46:
+.LBB47:
+	.loc 1 224 9 is_stmt 1 view .LVU102
+	.loc 1 223 34 view .LVU103
+	.loc 1 223 25 view .LVU104
+	.loc 1 224 9 view .LVU105
+	.loc 1 224 23 is_stmt 0 view .LVU106
+	movd	gyroADC(%rip), %xmm0
+	movd	gyroZero(%rip), %xmm1
+	movzwl	4+gyroADC(%rip), %eax
+	subw	4+gyroZero(%rip), %ax
+	psubw	%xmm1, %xmm0
+.LBE47:
+.LBE46:
+.LBB53:
+.LBB54:
+	.loc 1 86 8 view .LVU107
+	cmpb	$0, gyroFilterInitialised(%rip)
+.LBE54:
+.LBE53:
+.LBB60:
+.LBB48:
+	.loc 1 224 23 view .LVU108
+	movw	%ax, 4+gyroADC(%rip)
+.LBE48:
+.LBE60:
+.LBB61:
+.LBB57:
+	.loc 1 86 58 view .LVU109
+	movl	targetPidLooptime(%rip), %edx
+.LBE57:
+.LBE61:
+.LBB62:
+.LBB49:
+	.loc 1 224 23 view .LVU110
+	movd	%xmm0, gyroADC(%rip)
+	.loc 1 223 34 is_stmt 1 view .LVU111
+.LVL11:
+	.loc 1 223 25 view .LVU112
+	.loc 1 224 9 view .LVU113
+	.loc 1 223 34 view .LVU114
+	.loc 1 223 25 view .LVU115
+	.loc 1 223 25 is_stmt 0 view .LVU116
+.LBE49:
+.LBE62:
+	.loc 1 267 5 is_stmt 1 view .LVU117
+.LBB63:
+.LBI53:
+	.loc 1 81 13 view .LVU118
+.LBB58:
+	.loc 1 83 5 view .LVU119
+	.loc 1 84 5 view .LVU120
+	.loc 1 86 5 view .LVU121
+	.loc 1 86 8 is_stmt 0 view .LVU122
+	je	.L25
+	.loc 1 86 32 view .LVU123
+	cmpl	%edx, gyroFilterSamplePeriod(%rip)
+	je	.L26
+.L25:
+	leaq	gyroFilterLPF(%rip), %rbx
+	leaq	gyroFilterNotch(%rip), %rbp
+	leaq	84(%rbx), %r12
+.L28:
+.LVL12:
+.LBB55:
+.LBB56:
+	.loc 1 74 9 is_stmt 1 view .LVU124
+	.loc 1 74 61 is_stmt 0 view .LVU125
+	movq	gyroConfig(%rip), %rax
+	.loc 1 74 9 view .LVU126
+	movq	%rbx, %rdi
+	.loc 1 73 25 view .LVU127
+	addq	$28, %rbx
+.LVL13:
+	.loc 1 74 9 view .LVU128
+	movzwl	2(%rax), %esi
+	call	biquadFilterInitLPF@PLT
+.LVL14:
+	.loc 1 75 9 is_stmt 1 view .LVU129
+	.loc 1 75 97 is_stmt 0 view .LVU130
+	movq	gyroConfig(%rip), %rax
+	.loc 1 75 9 view .LVU131
+	movl	targetPidLooptime(%rip), %ecx
+	movq	%rbp, %rdi
+	.loc 1 73 25 view .LVU132
+	addq	$28, %rbp
+	.loc 1 75 9 view .LVU133
+	movzwl	6(%rax), %edx
+	movzwl	4(%rax), %esi
+	call	biquadFilterInitNotch@PLT
+.LVL15:
+	.loc 1 73 34 is_stmt 1 view .LVU134
+	.loc 1 73 25 view .LVU135
+	cmpq	%rbx, %r12
+	je	.L27
+	.loc 1 77 28 is_stmt 0 view .LVU136
+	movl	targetPidLooptime(%rip), %edx
+	jmp	.L28
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 77 5 is_stmt 1 view .LVU137
+	.loc 1 77 28 is_stmt 0 view .LVU138
+	movl	targetPidLooptime(%rip), %eax
+	.loc 1 78 27 view .LVU139
+	movb	$1, gyroFilterInitialised(%rip)
+	.loc 1 77 28 view .LVU140
+	movl	%eax, gyroFilterSamplePeriod(%rip)
+	.loc 1 78 5 is_stmt 1 view .LVU141
+.L26:
+.LBE56:
+.LBE55:
+	.loc 1 90 5 view .LVU142
+	.loc 1 90 20 is_stmt 0 view .LVU143
+	movq	gyroConfig(%rip), %rax
+	.loc 1 90 8 view .LVU144
+	cmpw	$0, 2(%rax)
+	jne	.L29
+	.loc 1 90 39 view .LVU145
+	cmpw	$0, 4(%rax)
+	je	.L13
+.L29:
+	leaq	gyroADC(%rip), %rbp
+.LBE58:
+.LBE63:
+.LBB64:
+.LBB65:
+.LBB66:
+.LBB67:
+	xorl	%ebx, %ebx
+	leaq	gyroFilterLPF(%rip), %r13
+	leaq	gyroFilterNotch(%rip), %r12
+.L30:
+.LVL16:
+	.loc 1 90 39 view .LVU146
+.LBE67:
+.LBE66:
+.LBE65:
+.LBE64:
+.LBB93:
+.LBB59:
+	.loc 1 95 9 is_stmt 1 view .LVU147
+	.loc 1 95 18 is_stmt 0 view .LVU148
+	movswl	0(%rbp), %eax
+	pxor	%xmm0, %xmm0
+	leaq	(%r12,%rbx), %rdi
+	.loc 1 94 25 view .LVU149
+	addq	$2, %rbp
+	.loc 1 95 18 view .LVU150
+	cvtsi2ssl	%eax, %xmm0
+	call	biquadFilterApply@PLT
+.LVL17:
+	.loc 1 96 9 is_stmt 1 view .LVU151
+	.loc 1 96 25 is_stmt 0 view .LVU152
+	leaq	0(%r13,%rbx), %rdi
+	.loc 1 94 25 view .LVU153
+	addq	$28, %rbx
+.LVL18:
+	.loc 1 96 25 view .LVU154
+	call	biquadFilterApply@PLT
+.LVL19:
+	.loc 1 96 25 view .LVU155
+	call	lrintf@PLT
+.LVL20:
+	.loc 1 96 23 view .LVU156
+	movw	%ax, -2(%rbp)
+	.loc 1 94 34 is_stmt 1 view .LVU157
+.LVL21:
+	.loc 1 94 25 view .LVU158
+	cmpq	$84, %rbx
+	jne	.L30
+.LVL22:
+.L13:
+	.loc 1 94 25 is_stmt 0 view .LVU159
+.LBE59:
+.LBE93:
+	.loc 1 268 1 view .LVU160
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L46:
+	.cfi_restore_state
+	.loc 1 251 9 is_stmt 1 view .LVU161
+	call	gyroAccumulateSample
+.LVL24:
+	.loc 1 254 25 view .LVU162
+	.loc 1 255 42 is_stmt 0 view .LVU163
+	movzbl	gyroADCSumCount(%rip), %ecx
+	jmp	.L14
+.LVL25:
+	.p2align 4,,10
+	.p2align 3
+.L47:
+	.loc 1 263 9 is_stmt 1 view .LVU164
+	.loc 1 263 49 is_stmt 0 view .LVU165
+	movq	gyroConfig(%rip), %rdx
+	leaq	g.1(%rip), %r14
+	leaq	var.0(%rip), %rbx
+	leaq	gyroZero(%rip), %rbp
+	leaq	12(%r14), %r12
+	movzbl	(%rdx), %ecx
+	.loc 1 263 9 view .LVU166
+	movl	%ecx, 12(%rsp)
+	.loc 1 263 49 view .LVU167
+	movl	%ecx, %r13d
+.LVL26:
+.LBB94:
+.LBI64:
+	.loc 1 180 13 is_stmt 1 view .LVU168
+.LBB90:
+	.loc 1 182 5 view .LVU169
+	.loc 1 183 5 view .LVU170
+	.loc 1 184 5 view .LVU171
+	.loc 1 186 5 view .LVU172
+	.loc 1 186 25 view .LVU173
+.L20:
+	.loc 1 189 9 view .LVU174
+.LBB76:
+.LBI76:
+	.loc 1 134 5 view .LVU175
+.LBB77:
+	.loc 1 136 5 view .LVU176
+.LBE77:
+.LBE76:
+	.loc 1 189 12 is_stmt 0 view .LVU177
+	cmpw	%ax, calibrationCycles(%rip)
+	je	.L48
+.L16:
+	.loc 1 195 9 is_stmt 1 view .LVU178
+	.loc 1 195 27 is_stmt 0 view .LVU179
+	movswl	(%r15), %eax
+	.loc 1 196 9 view .LVU180
+	pxor	%xmm0, %xmm0
+	.loc 1 195 17 view .LVU181
+	addl	%eax, (%r14)
+	.loc 1 196 9 is_stmt 1 view .LVU182
+	movq	%rbx, %rdi
+	cvtsi2ssl	%eax, %xmm0
+	call	devPush@PLT
+.LVL27:
+	.loc 1 199 9 view .LVU183
+.LBB78:
+.LBB79:
+	.loc 1 131 25 is_stmt 0 view .LVU184
+	movzwl	calibratingG(%rip), %eax
+.LBE79:
+.LBE78:
+	.loc 1 199 23 view .LVU185
+	xorl	%ecx, %ecx
+	.loc 1 200 24 view .LVU186
+	xorl	%esi, %esi
+	.loc 1 199 23 view .LVU187
+	movw	%cx, (%r15)
+	.loc 1 200 9 is_stmt 1 view .LVU188
+	.loc 1 200 24 is_stmt 0 view .LVU189
+	movw	%si, 0(%rbp)
+	.loc 1 202 9 is_stmt 1 view .LVU190
+.LBB81:
+.LBI78:
+	.loc 1 129 5 view .LVU191
+.LBB80:
+	.loc 1 131 5 view .LVU192
+.LBE80:
+.LBE81:
+	.loc 1 202 12 is_stmt 0 view .LVU193
+	cmpw	$1, %ax
+	je	.L49
+.L17:
+	.loc 1 186 34 is_stmt 1 view .LVU194
+.LVL28:
+	.loc 1 186 25 view .LVU195
+	addq	$4, %r14
+.LVL29:
+	.loc 1 186 25 is_stmt 0 view .LVU196
+	addq	$2, %r15
+	addq	$20, %rbx
+	addq	$2, %rbp
+	cmpq	%r14, %r12
+	jne	.L20
+	.loc 1 214 5 is_stmt 1 view .LVU197
+.LBB82:
+.LBI82:
+	.loc 1 129 5 view .LVU198
+.LBB83:
+	.loc 1 131 5 view .LVU199
+.LBE83:
+.LBE82:
+	.loc 1 214 8 is_stmt 0 view .LVU200
+	cmpw	$1, %ax
+	je	.L50
+.L21:
+	.loc 1 217 5 is_stmt 1 view .LVU201
+	.loc 1 217 17 is_stmt 0 view .LVU202
+	subl	$1, %eax
+	movw	%ax, calibratingG(%rip)
+.LVL30:
+	.loc 1 217 17 view .LVU203
+.LBE90:
+.LBE94:
+.LBB95:
+.LBB50:
+	.loc 1 223 25 is_stmt 1 view .LVU204
+	jmp	.L15
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L48:
+	.loc 1 223 25 is_stmt 0 view .LVU205
+.LBE50:
+.LBE95:
+.LBB96:
+.LBB91:
+	.loc 1 190 13 is_stmt 1 view .LVU206
+	.loc 1 190 21 is_stmt 0 view .LVU207
+	movl	$0, (%r14)
+	.loc 1 191 13 is_stmt 1 view .LVU208
+	movq	%rbx, %rdi
+	call	devClear@PLT
+.LVL32:
+	jmp	.L16
+	.p2align 4,,10
+	.p2align 3
+.L49:
+.LBB85:
+	.loc 1 203 13 view .LVU209
+	.loc 1 203 25 is_stmt 0 view .LVU210
+	movq	%rbx, %rdi
+	call	devStandardDeviation@PLT
+.LVL33:
+	.loc 1 205 13 is_stmt 1 view .LVU211
+	.loc 1 205 16 is_stmt 0 view .LVU212
+	testb	%r13b, %r13b
+	je	.L18
+	.loc 1 205 57 view .LVU213
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	12(%rsp), %xmm1
+	.loc 1 205 50 view .LVU214
+	comiss	%xmm1, %xmm0
+	ja	.L51
+.L18:
+	.loc 1 209 13 is_stmt 1 view .LVU215
+	.loc 1 209 60 is_stmt 0 view .LVU216
+	movzwl	calibrationCycles(%rip), %esi
+	.loc 1 210 13 view .LVU217
+	movl	$10, %edi
+	.loc 1 209 60 view .LVU218
+	movl	%esi, %eax
+	shrw	%ax
+	movzwl	%ax, %eax
+	.loc 1 209 39 view .LVU219
+	addl	(%r14), %eax
+	.loc 1 209 66 view .LVU220
+	cltd
+	idivl	%esi
+	.loc 1 210 13 view .LVU221
+	movl	$1, %edx
+	movl	$15, %esi
+	.loc 1 209 28 view .LVU222
+	movw	%ax, 0(%rbp)
+	.loc 1 210 13 is_stmt 1 view .LVU223
+	call	blinkLedAndSoundBeeper@PLT
+.LVL34:
+	.loc 1 210 13 is_stmt 0 view .LVU224
+.LBE85:
+.LBB86:
+.LBB84:
+	.loc 1 131 25 view .LVU225
+	movzwl	calibratingG(%rip), %eax
+	jmp	.L17
+.LVL35:
+	.p2align 4,,10
+	.p2align 3
+.L50:
+	.loc 1 131 25 view .LVU226
+.LBE84:
+.LBE86:
+.LBB87:
+.LBI66:
+	.loc 1 164 12 is_stmt 1 view .LVU227
+.LBB74:
+	.loc 1 166 5 view .LVU228
+	.loc 1 166 8 is_stmt 0 view .LVU229
+	cmpb	$0, checkingKnownZero(%rip)
+	.loc 1 174 9 view .LVU230
+	movq	knownSensors(%rip), %rdi
+	.loc 1 166 8 view .LVU231
+	je	.L22
+	xorl	%ecx, %ecx
+.L24:
+.LVL36:
+.LBB68:
+.LBB69:
+	.loc 1 144 9 is_stmt 1 view .LVU232
+	.loc 1 144 77 is_stmt 0 view .LVU233
+	leaq	gyroZero(%rip), %rsi
+	movswl	(%rsi,%rcx), %edx
+	.loc 1 144 108 view .LVU234
+	movswl	4(%rdi,%rcx), %esi
+	.loc 1 144 84 view .LVU235
+	subl	%esi, %edx
+	.loc 1 144 116 view .LVU236
+	movl	%edx, %esi
+	negl	%esi
+	cmovns	%esi, %edx
+	.loc 1 144 12 view .LVU237
+	cmpl	$16, %edx
+	jg	.L23
+	.loc 1 143 34 is_stmt 1 view .LVU238
+.LVL37:
+	.loc 1 143 25 view .LVU239
+	addq	$2, %rcx
+.LVL38:
+	.loc 1 143 25 is_stmt 0 view .LVU240
+	cmpq	$6, %rcx
+	jne	.L24
+	jmp	.L21
+.LVL39:
+.L22:
+	.loc 1 143 25 view .LVU241
+.LBE69:
+.LBE68:
+	.loc 1 174 5 is_stmt 1 view .LVU242
+	.loc 1 174 8 is_stmt 0 view .LVU243
+	testq	%rdi, %rdi
+	je	.L21
+	.loc 1 174 22 view .LVU244
+	cmpw	$1000, calibrationCycles(%rip)
+	jne	.L21
+.LVL40:
+.LBB70:
+.LBB71:
+	.loc 1 155 25 is_stmt 1 view .LVU245
+	.loc 1 156 9 view .LVU246
+	.loc 1 155 34 view .LVU247
+	.loc 1 155 25 view .LVU248
+	.loc 1 156 9 view .LVU249
+	.loc 1 156 38 is_stmt 0 view .LVU250
+	movl	gyroZero(%rip), %eax
+	movl	%eax, 4(%rdi)
+	.loc 1 155 34 is_stmt 1 view .LVU251
+.LVL41:
+	.loc 1 155 25 view .LVU252
+	.loc 1 156 9 view .LVU253
+	.loc 1 156 38 is_stmt 0 view .LVU254
+	movzwl	4+gyroZero(%rip), %eax
+	.loc 1 159 30 view .LVU255
+	orb	$1, 3(%rdi)
+	.loc 1 156 38 view .LVU256
+	movw	%ax, 8(%rdi)
+	.loc 1 155 34 is_stmt 1 view .LVU257
+.LVL42:
+	.loc 1 155 25 view .LVU258
+	.loc 1 158 5 view .LVU259
+	.loc 1 158 32 is_stmt 0 view .LVU260
+	movzbl	gyroHardware(%rip), %eax
+	movb	%al, (%rdi)
+	.loc 1 159 5 is_stmt 1 view .LVU261
+	.loc 1 160 5 view .LVU262
+	call	requestEEPROMWrite@PLT
+.LVL43:
+	.loc 1 160 5 is_stmt 0 view .LVU263
+.LBE71:
+.LBE70:
+.LBE74:
+.LBE87:
+	.loc 1 217 17 view .LVU264
+	movzwl	calibratingG(%rip), %eax
+	jmp	.L21
+.LVL44:
+.L23:
+.LBB88:
+.LBB75:
+	.loc 1 170 9 is_stmt 1 view .LVU265
+.LBB72:
+.LBI72:
+	.loc 1 100 6 view .LVU266
+.LBB73:
+	.loc 1 102 5 view .LVU267
+	.loc 1 102 18 is_stmt 0 view .LVU268
+	movl	$1000, %eax
+	.loc 1 103 23 view .LVU269
+	movl	$1000, %edx
+	.loc 1 104 23 view .LVU270
+	movb	$0, checkingKnownZero(%rip)
+	.loc 1 102 18 view .LVU271
+	movw	%ax, calibratingG(%rip)
+	.loc 1 103 5 is_stmt 1 view .LVU272
+	.loc 1 103 23 is_stmt 0 view .LVU273
+	movw	%dx, calibrationCycles(%rip)
+	.loc 1 104 5 is_stmt 1 view .LVU274
+.LVL45:
+	.loc 1 104 5 is_stmt 0 view .LVU275
+.LBE73:
+.LBE72:
+	.loc 1 171 9 is_stmt 1 view .LVU276
+	.loc 1 171 9 is_stmt 0 view .LVU277
+.LBE75:
+.LBE88:
+.LBE91:
+.LBE96:
+.LBB97:
+.LBB51:
+	.loc 1 223 25 is_stmt 1 view .LVU278
+	jmp	.L15
+.LVL46:
+.L51:
+	.loc 1 223 25 is_stmt 0 view .LVU279
+.LBE51:
+.LBE97:
+.LBB98:
+.LBB92:
+.LBB89:
+	.loc 1 206 17 is_stmt 1 view .LVU280
+	.loc 1 206 30 is_stmt 0 view .LVU281
+	movzwl	calibrationCycles(%rip), %eax
+	movw	%ax, calibratingG(%rip)
+	.loc 1 207 17 is_stmt 1 view .LVU282
+.LVL47:
+	.loc 1 207 17 is_stmt 0 view .LVU283
+.LBE89:
+.LBE92:
+.LBE98:
+.LBB99:
+.LBB52:
+	.loc 1 223 25 is_stmt 1 view .LVU284
+	jmp	.L15
+.LBE52:
+.LBE99:
+	.cfi_endproc
+.LFE25:
+	.size	gyroGetADC, .-gyroGetADC
+	.section	.bss.var.0,"aw",@nobits
+	.align 32
+	.type	var.0, @object
+	.size	var.0, 60
+var.0:
+	.zero	60
+	.section	.bss.g.1,"aw",@nobits
+	.align 8
+	.type	g.1, @object
+	.size	g.1, 12
+g.1:
+	.zero	12
+	.section	.bss.gyroFilterInitialised,"aw",@nobits
+	.type	gyroFilterInitialised, @object
+	.size	gyroFilterInitialised, 1
+gyroFilterInitialised:
+	.zero	1
+	.section	.bss.gyroFilterSamplePeriod,"aw",@nobits
+	.align 4
+	.type	gyroFilterSamplePeriod, @object
+	.size	gyroFilterSamplePeriod, 4
+gyroFilterSamplePeriod:
+	.zero	4
+	.section	.bss.gyroFilterNotch,"aw",@nobits
+	.align 32
+	.type	gyroFilterNotch, @object
+	.size	gyroFilterNotch, 84
+gyroFilterNotch:
+	.zero	84
+	.section	.bss.gyroFilterLPF,"aw",@nobits
+	.align 32
+	.type	gyroFilterLPF, @object
+	.size	gyroFilterLPF, 84
+gyroFilterLPF:
+	.zero	84
+	.section	.bss.gyroADCSumCount,"aw",@nobits
+	.type	gyroADCSumCount, @object
+	.size	gyroADCSumCount, 1
+gyroADCSumCount:
+	.zero	1
+	.section	.bss.gyroADCSum,"aw",@nobits
+	.align 8
+	.type	gyroADCSum, @object
+	.size	gyroADCSum, 12
+gyroADCSum:
+	.zero	12
+	.globl	gyroAlign
+	.section	.bss.gyroAlign,"aw",@nobits
+	.align 4
+	.type	gyroAlign, @object
+	.size	gyroAlign, 4
+gyroAlign:
+	.zero	4
+	.globl	gyroHardware
+	.section	.bss.gyroHardware,"aw",@nobits
+	.type	gyroHardware, @object
+	.size	gyroHardware, 1
+gyroHardware:
+	.zero	1
+	.comm	gyro,32,32
+	.section	.bss.knownSensors,"aw",@nobits
+	.align 8
+	.type	knownSensors, @object
+	.size	knownSensors, 8
+knownSensors:
+	.zero	8
+	.section	.bss.gyroConfig,"aw",@nobits
+	.align 8
+	.type	gyroConfig, @object
+	.size	gyroConfig, 8
+gyroConfig:
+	.zero	8
+	.section	.bss.checkingKnownZero,"aw",@nobits
+	.type	checkingKnownZero, @object
+	.size	checkingKnownZero, 1
+checkingKnownZero:
+	.zero	1
+	.section	.data.calibrationCycles,"aw"
+	.align 2
+	.type	calibrationCycles, @object
+	.size	calibrationCycles, 2
+calibrationCycles:
+	.value	1000
+	.globl	calibratingG
+	.section	.bss.calibratingG,"aw",@nobits
+	.align 2
+	.type	calibratingG, @object
+	.size	calibratingG, 2
+calibratingG:
+	.zero	2
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/common/maths.h"
+	.file 6 ".//src/main/common/filter.h"
+	.file 7 ".//src/main/drivers/accgyro.h"
+	.file 8 ".//src/main/flight/flight.h"
+	.file 9 ".//src/main/sensors/sensors.h"
+	.file 10 ".//src/main/sensors/gyro.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 12 ".//src/main/io/statusindicator.h"
+	.file 13 ".//src/main/sensors/boardalignment.h"
+	.file 14 ".//src/main/config/config.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc28
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF1453
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL19
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1320
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1321
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1322
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1323
+	.uleb128 0x3
+	.long	.LASF1325
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x56
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1324
+	.uleb128 0x3
+	.long	.LASF1326
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1327
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x75
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1328
+	.uleb128 0x3
+	.long	.LASF1329
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x3
+	.long	.LASF1330
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1331
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1332
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1333
+	.uleb128 0x3
+	.long	.LASF1334
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x4a
+	.uleb128 0x3
+	.long	.LASF1335
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x3
+	.long	.LASF1336
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF1337
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1338
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1339
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1340
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1341
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1342
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1343
+	.uleb128 0xf
+	.long	.LASF1348
+	.byte	0x14
+	.byte	0x5
+	.byte	0x25
+	.long	0x167
+	.uleb128 0x4
+	.long	.LASF1344
+	.byte	0x5
+	.byte	0x27
+	.byte	0xb
+	.long	0x10b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1345
+	.byte	0x5
+	.byte	0x27
+	.byte	0x13
+	.long	0x10b
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1346
+	.byte	0x5
+	.byte	0x27
+	.byte	0x1b
+	.long	0x10b
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1347
+	.byte	0x5
+	.byte	0x27
+	.byte	0x23
+	.long	0x10b
+	.byte	0xc
+	.uleb128 0x8
+	.string	"m_n"
+	.byte	0x5
+	.byte	0x28
+	.byte	0x9
+	.long	0x94
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1348
+	.byte	0x5
+	.byte	0x29
+	.byte	0x3
+	.long	0x119
+	.uleb128 0xf
+	.long	.LASF1349
+	.byte	0x1c
+	.byte	0x6
+	.byte	0x1a
+	.long	0x1d4
+	.uleb128 0x8
+	.string	"b0"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xb
+	.long	0x10b
+	.byte	0
+	.uleb128 0x8
+	.string	"b1"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xf
+	.long	0x10b
+	.byte	0x4
+	.uleb128 0x8
+	.string	"b2"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0x10b
+	.byte	0x8
+	.uleb128 0x8
+	.string	"a1"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x17
+	.long	0x10b
+	.byte	0xc
+	.uleb128 0x8
+	.string	"a2"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x10b
+	.byte	0x10
+	.uleb128 0x8
+	.string	"d1"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xb
+	.long	0x10b
+	.byte	0x14
+	.uleb128 0x8
+	.string	"d2"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xf
+	.long	0x10b
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1350
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x3
+	.long	0x173
+	.uleb128 0x3
+	.long	.LASF1351
+	.byte	0x7
+	.byte	0x16
+	.byte	0x10
+	.long	0x1ec
+	.uleb128 0xa
+	.long	0x1f1
+	.uleb128 0x26
+	.uleb128 0x3
+	.long	.LASF1352
+	.byte	0x7
+	.byte	0x17
+	.byte	0x10
+	.long	0x1fe
+	.uleb128 0xa
+	.long	0x203
+	.uleb128 0x27
+	.long	0x20e
+	.uleb128 0x2
+	.long	0x20e
+	.byte	0
+	.uleb128 0xa
+	.long	0xc1
+	.uleb128 0xf
+	.long	.LASF1353
+	.byte	0x20
+	.byte	0x7
+	.byte	0x19
+	.long	0x261
+	.uleb128 0x4
+	.long	.LASF1354
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x17
+	.long	0x1e0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1355
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x17
+	.long	0x1f2
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1356
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x17
+	.long	0x1f2
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1357
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xb
+	.long	0x10b
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1358
+	.byte	0x7
+	.byte	0x1e
+	.byte	0xe
+	.long	0xf1
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1359
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x3
+	.long	0x213
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x8
+	.byte	0x15
+	.long	0x2bb
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1362
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1363
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1368
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0xa
+	.byte	0
+	.uleb128 0x12
+	.long	0xc1
+	.long	0x2ca
+	.uleb128 0x13
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1371
+	.byte	0x8
+	.byte	0x7e
+	.byte	0x10
+	.long	0x2bb
+	.uleb128 0xc
+	.long	.LASF1372
+	.byte	0x8
+	.byte	0x80
+	.byte	0x10
+	.long	0x2bb
+	.uleb128 0x12
+	.long	0xcd
+	.long	0x2f1
+	.uleb128 0x13
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x9
+	.byte	0x1c
+	.long	0x327
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x40
+	.byte	0
+	.uleb128 0x11
+	.long	0x43
+	.byte	0x9
+	.byte	0x26
+	.long	0x369
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1389
+	.byte	0x9
+	.byte	0x30
+	.byte	0x3
+	.long	0x327
+	.uleb128 0xf
+	.long	.LASF1390
+	.byte	0x10
+	.byte	0x9
+	.byte	0x39
+	.long	0x3d0
+	.uleb128 0x4
+	.long	.LASF1391
+	.byte	0x9
+	.byte	0x3a
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1392
+	.byte	0x9
+	.byte	0x3b
+	.byte	0xd
+	.long	0xd9
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1393
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1394
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xd
+	.long	0xd9
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1371
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2bb
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1395
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xcd
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1396
+	.byte	0x9
+	.byte	0x40
+	.byte	0x3
+	.long	0x375
+	.uleb128 0x11
+	.long	0x43
+	.byte	0xa
+	.byte	0x15
+	.long	0x418
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1398
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1399
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1405
+	.byte	0xa
+	.byte	0x20
+	.byte	0xf
+	.long	0x261
+	.uleb128 0xc
+	.long	.LASF1391
+	.byte	0xa
+	.byte	0x21
+	.byte	0x10
+	.long	0xd9
+	.uleb128 0xc
+	.long	.LASF1406
+	.byte	0xa
+	.byte	0x22
+	.byte	0x17
+	.long	0x369
+	.uleb128 0xf
+	.long	.LASF1407
+	.byte	0x8
+	.byte	0xa
+	.byte	0x24
+	.long	0x47d
+	.uleb128 0x4
+	.long	.LASF1408
+	.byte	0xa
+	.byte	0x25
+	.byte	0xd
+	.long	0xd9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1409
+	.byte	0xa
+	.byte	0x26
+	.byte	0xe
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1410
+	.byte	0xa
+	.byte	0x27
+	.byte	0xe
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1411
+	.byte	0xa
+	.byte	0x28
+	.byte	0xe
+	.long	0xe5
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1412
+	.byte	0xa
+	.byte	0x29
+	.byte	0x3
+	.long	0x43c
+	.uleb128 0xc
+	.long	.LASF1413
+	.byte	0x1
+	.byte	0x26
+	.byte	0x11
+	.long	0xf1
+	.uleb128 0x28
+	.long	.LASF1414
+	.byte	0x1
+	.byte	0x2b
+	.byte	0xa
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	calibratingG
+	.uleb128 0x7
+	.long	.LASF1415
+	.byte	0x2c
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	calibrationCycles
+	.uleb128 0x7
+	.long	.LASF1416
+	.byte	0x2d
+	.byte	0xc
+	.long	0x4d5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	checkingKnownZero
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1417
+	.uleb128 0x7
+	.long	.LASF1418
+	.byte	0x2f
+	.byte	0x16
+	.long	0x4f1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroConfig
+	.uleb128 0xa
+	.long	0x47d
+	.uleb128 0x7
+	.long	.LASF1419
+	.byte	0x30
+	.byte	0x18
+	.long	0x50b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	knownSensors
+	.uleb128 0xa
+	.long	0x3d0
+	.uleb128 0x15
+	.long	0x418
+	.byte	0x32
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyro
+	.uleb128 0x15
+	.long	0x424
+	.byte	0x33
+	.byte	0x9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroHardware
+	.uleb128 0x15
+	.long	0x430
+	.byte	0x34
+	.byte	0x10
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroAlign
+	.uleb128 0x7
+	.long	.LASF1420
+	.byte	0x37
+	.byte	0x10
+	.long	0x2e2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroADCSum
+	.uleb128 0x7
+	.long	.LASF1421
+	.byte	0x38
+	.byte	0x10
+	.long	0xd9
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroADCSumCount
+	.uleb128 0x12
+	.long	0x1d4
+	.long	0x57c
+	.uleb128 0x13
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1422
+	.byte	0x3a
+	.byte	0x17
+	.long	0x56d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroFilterLPF
+	.uleb128 0x7
+	.long	.LASF1423
+	.byte	0x3b
+	.byte	0x17
+	.long	0x56d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroFilterNotch
+	.uleb128 0x7
+	.long	.LASF1424
+	.byte	0x3c
+	.byte	0x11
+	.long	0xf1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroFilterSamplePeriod
+	.uleb128 0x7
+	.long	.LASF1425
+	.byte	0x3d
+	.byte	0xc
+	.long	0x4d5
+	.uleb128 0x9
+	.byte	0x3
+	.quad	gyroFilterInitialised
+	.uleb128 0xd
+	.long	.LASF1426
+	.byte	0x6
+	.byte	0x23
+	.long	0x5f0
+	.uleb128 0x2
+	.long	0x5f0
+	.uleb128 0x2
+	.long	0xe5
+	.uleb128 0x2
+	.long	0xe5
+	.uleb128 0x2
+	.long	0xf1
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d4
+	.uleb128 0xd
+	.long	.LASF1427
+	.byte	0x6
+	.byte	0x22
+	.long	0x610
+	.uleb128 0x2
+	.long	0x5f0
+	.uleb128 0x2
+	.long	0xe5
+	.uleb128 0x2
+	.long	0xf1
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1428
+	.byte	0xb
+	.value	0x13d
+	.byte	0x11
+	.long	0xa7
+	.long	0x627
+	.uleb128 0x2
+	.long	0x10b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1429
+	.byte	0x6
+	.byte	0x24
+	.long	0x10b
+	.long	0x641
+	.uleb128 0x2
+	.long	0x5f0
+	.uleb128 0x2
+	.long	0x10b
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1454
+	.byte	0xe
+	.byte	0x39
+	.byte	0x6
+	.uleb128 0xd
+	.long	.LASF1430
+	.byte	0xc
+	.byte	0x14
+	.long	0x664
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1431
+	.byte	0x5
+	.byte	0x33
+	.long	0x10b
+	.long	0x679
+	.uleb128 0x2
+	.long	0x679
+	.byte	0
+	.uleb128 0xa
+	.long	0x167
+	.uleb128 0xd
+	.long	.LASF1432
+	.byte	0x5
+	.byte	0x31
+	.long	0x694
+	.uleb128 0x2
+	.long	0x679
+	.uleb128 0x2
+	.long	0x10b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1433
+	.byte	0x5
+	.byte	0x30
+	.long	0x6a5
+	.uleb128 0x2
+	.long	0x679
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1434
+	.byte	0xd
+	.byte	0x1a
+	.long	0x6c0
+	.uleb128 0x2
+	.long	0x20e
+	.uleb128 0x2
+	.long	0x20e
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1436
+	.byte	0xf6
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9dc
+	.uleb128 0x1d
+	.long	.LASF1435
+	.byte	0xf8
+	.long	0xb5
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2b
+	.long	0xaf7
+	.quad	.LBI44
+	.byte	.LVU98
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.byte	0x1
+	.value	0x106
+	.byte	0xa
+	.uleb128 0x2c
+	.long	0xa29
+	.long	.LLRL2
+	.byte	0x1
+	.value	0x10a
+	.byte	0x5
+	.long	0x735
+	.uleb128 0x16
+	.long	.LLRL2
+	.uleb128 0x9
+	.long	0xa33
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0xb62
+	.quad	.LBI53
+	.byte	.LVU118
+	.long	.LLRL4
+	.value	0x10b
+	.byte	0x5
+	.long	0x809
+	.uleb128 0x16
+	.long	.LLRL4
+	.uleb128 0x9
+	.long	0xb6c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x9
+	.long	0xb77
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x17
+	.long	0xb83
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.byte	0x57
+	.byte	0x9
+	.long	0x7c2
+	.uleb128 0x9
+	.long	0xb8d
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xe
+	.quad	.LVL14
+	.long	0x5f5
+	.long	0x7ad
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL15
+	.long	0x5d0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL17
+	.long	0x627
+	.long	0x7dd
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL19
+	.long	0x627
+	.long	0x7fa
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4c
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL20
+	.long	0x610
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0xa3f
+	.quad	.LBI64
+	.byte	.LVU168
+	.long	.LLRL8
+	.value	0x107
+	.byte	0x9
+	.long	0x9b0
+	.uleb128 0x1f
+	.long	0xa49
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x16
+	.long	.LLRL8
+	.uleb128 0x9
+	.long	0xa54
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2d
+	.long	0xaa3
+	.quad	.LBI66
+	.byte	.LVU227
+	.long	.LLRL11
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x2d
+	.long	0x8e9
+	.uleb128 0x17
+	.long	0xac6
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.byte	0xa7
+	.byte	0xd
+	.long	0x883
+	.uleb128 0x9
+	.long	0xad7
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x17
+	.long	0xab0
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.byte	0xaf
+	.byte	0x9
+	.long	0x8b9
+	.uleb128 0x9
+	.long	0xaba
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x19
+	.quad	.LVL43
+	.long	0x641
+	.byte	0
+	.uleb128 0x2e
+	.long	0xb49
+	.quad	.LBI72
+	.byte	.LVU266
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0x1
+	.byte	0xaa
+	.byte	0x9
+	.uleb128 0x1f
+	.long	0xb56
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	0xae3
+	.quad	.LBI76
+	.byte	.LVU175
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0x1
+	.byte	0xbd
+	.byte	0xd
+	.uleb128 0x20
+	.long	0xaed
+	.quad	.LBI78
+	.byte	.LVU191
+	.long	.LLRL15
+	.byte	0xca
+	.byte	0xd
+	.uleb128 0x20
+	.long	0xaed
+	.quad	.LBI82
+	.byte	.LVU198
+	.long	.LLRL16
+	.byte	0xd6
+	.byte	0x9
+	.uleb128 0x30
+	.long	0xa85
+	.long	.LLRL17
+	.long	0x982
+	.uleb128 0x9
+	.long	0xa86
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0xe
+	.quad	.LVL33
+	.long	0x664
+	.long	0x964
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL34
+	.long	0x649
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x3f
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL27
+	.long	0x67e
+	.long	0x99a
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL32
+	.long	0x694
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LVL9
+	.long	0x6a5
+	.long	0x9ce
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL24
+	.long	0x9dc
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1437
+	.byte	0xe9
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa29
+	.uleb128 0x7
+	.long	.LASF1438
+	.byte	0xeb
+	.byte	0xd
+	.long	0x2bb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -22
+	.uleb128 0x1d
+	.long	.LASF1435
+	.byte	0xec
+	.long	0xb5
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x31
+	.quad	.LVL3
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -22
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1439
+	.byte	0xdc
+	.long	0xa3f
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0xde
+	.byte	0xc
+	.long	0xb5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1440
+	.byte	0xb4
+	.long	0xa94
+	.uleb128 0x21
+	.long	.LASF1408
+	.byte	0xb4
+	.byte	0x33
+	.long	0xd9
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0xb6
+	.byte	0xc
+	.long	0xb5
+	.uleb128 0x22
+	.string	"g"
+	.byte	0xb7
+	.long	0x2e2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	g.1
+	.uleb128 0x22
+	.string	"var"
+	.byte	0xb8
+	.long	0xa94
+	.uleb128 0x9
+	.byte	0x3
+	.quad	var.0
+	.uleb128 0x32
+	.uleb128 0x33
+	.string	"dev"
+	.byte	0x1
+	.byte	0xcb
+	.byte	0x13
+	.long	0x10b
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x167
+	.long	0xaa3
+	.uleb128 0x13
+	.long	0x2e
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF1455
+	.byte	0x1
+	.byte	0xa4
+	.byte	0xc
+	.long	0x4d5
+	.byte	0x1
+	.uleb128 0x10
+	.long	.LASF1441
+	.byte	0x97
+	.long	0xac6
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0x99
+	.byte	0xc
+	.long	0xb5
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1456
+	.byte	0x1
+	.byte	0x8b
+	.byte	0xc
+	.long	0x4d5
+	.byte	0x1
+	.long	0xae3
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0x8d
+	.byte	0xc
+	.long	0xb5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1442
+	.byte	0x86
+	.long	0x4d5
+	.uleb128 0x1a
+	.long	.LASF1443
+	.byte	0x81
+	.long	0x4d5
+	.uleb128 0x1a
+	.long	.LASF1444
+	.byte	0x7c
+	.long	0x4d5
+	.uleb128 0x14
+	.long	.LASF1445
+	.byte	0x70
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb49
+	.uleb128 0x23
+	.long	.LASF1451
+	.byte	0x70
+	.byte	0x2f
+	.long	0x50b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x36
+	.long	0xb49
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.byte	0x1
+	.byte	0x75
+	.byte	0x9
+	.uleb128 0x37
+	.long	0xb56
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1446
+	.byte	0x1
+	.byte	0x64
+	.byte	0x6
+	.byte	0x1
+	.long	0xb62
+	.uleb128 0x21
+	.long	.LASF1447
+	.byte	0x64
+	.byte	0x28
+	.long	0xe5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1448
+	.byte	0x51
+	.long	0xb83
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0x53
+	.byte	0xc
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF1438
+	.byte	0x54
+	.byte	0xb
+	.long	0x10b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1449
+	.byte	0x45
+	.long	0xb99
+	.uleb128 0xb
+	.long	.LASF1435
+	.byte	0x47
+	.byte	0xc
+	.long	0xb5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1450
+	.byte	0x3f
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbc3
+	.uleb128 0x23
+	.long	.LASF1452
+	.byte	0x3f
+	.byte	0x22
+	.long	0x4f1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x39
+	.long	0xb49
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbe6
+	.uleb128 0x3a
+	.long	0xb56
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x1b
+	.long	0xaf7
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1b
+	.long	0xaed
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1b
+	.long	0xae3
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS1:
+	.uleb128 .LVU68
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 .LVU161
+	.uleb128 .LVU162
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL7-.LVL5
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.LVL5
+	.uleb128 .LVL8-.LVL5
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.LVL5
+	.uleb128 .LVL23-.LVL5
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.LVL5
+	.uleb128 .LVL25-.LVL5
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL25-.LVL5
+	.uleb128 .LFE25-.LVL5
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+	.uleb128 .LVU283
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL10
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL10-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.LVL10
+	.uleb128 .LVL11-.LVL10
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.LVL10
+	.uleb128 .LVL31-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL45-.LVL10
+	.uleb128 .LVL46-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL10
+	.uleb128 .LFE25-.LVL10
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU146
+	.uleb128 .LVU154
+	.uleb128 .LVU154
+	.uleb128 .LVU158
+.LLST5:
+	.byte	0x6
+	.quad	.LVL16
+	.byte	0x4
+	.uleb128 .LVL16-.LVL16
+	.uleb128 .LVL18-.LVL16
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x4c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.LVL16
+	.uleb128 .LVL21-.LVL16
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 -28
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x4c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU151
+	.uleb128 .LVU155
+.LLST6:
+	.byte	0x8
+	.quad	.LVL17
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU124
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU135
+.LLST7:
+	.byte	0x6
+	.quad	.LVL12
+	.byte	0x4
+	.uleb128 .LVL12-.LVL12
+	.uleb128 .LVL13-.LVL12
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	gyroFilterLPF
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x4c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.LVL12
+	.uleb128 .LVL14-1-.LVL12
+	.uleb128 0x15
+	.byte	0x75
+	.sleb128 0
+	.byte	0x3
+	.quad	gyroFilterLPF
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x4c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-1-.LVL12
+	.uleb128 .LVL15-.LVL12
+	.uleb128 0x15
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	gyroFilterLPF+28
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x4c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU168
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+	.uleb128 .LVU283
+.LLST9:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL31-.LVL26
+	.uleb128 .LVL45-.LVL26
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL46-.LVL26
+	.uleb128 .LVL47-.LVL26
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU173
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+	.uleb128 .LVU205
+	.uleb128 .LVU226
+	.uleb128 .LVU226
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+	.uleb128 .LVU283
+.LLST10:
+	.byte	0x6
+	.quad	.LVL26
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL26-.LVL26
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.LVL26
+	.uleb128 .LVL28-.LVL26
+	.uleb128 0xf
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.LVL26
+	.uleb128 .LVL29-.LVL26
+	.uleb128 0x11
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL26
+	.uleb128 .LVL30-.LVL26
+	.uleb128 0x11
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.LVL26
+	.uleb128 .LVL35-.LVL26
+	.uleb128 0xf
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL26
+	.uleb128 .LVL45-.LVL26
+	.uleb128 0x11
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL46-.LVL26
+	.uleb128 .LVL47-.LVL26
+	.uleb128 0xf
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x3
+	.quad	g.1
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU232
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU241
+.LLST12:
+	.byte	0x6
+	.quad	.LVL36
+	.byte	0x4
+	.uleb128 .LVL36-.LVL36
+	.uleb128 .LVL37-.LVL36
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.LVL36
+	.uleb128 .LVL38-.LVL36
+	.uleb128 0x7
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL38-.LVL36
+	.uleb128 .LVL39-.LVL36
+	.uleb128 0x7
+	.byte	0x72
+	.sleb128 -2
+	.byte	0x31
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU245
+	.uleb128 .LVU248
+	.uleb128 .LVU248
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU258
+	.uleb128 .LVU258
+	.uleb128 .LVU263
+.LLST13:
+	.byte	0x6
+	.quad	.LVL40
+	.byte	0x4
+	.uleb128 .LVL40-.LVL40
+	.uleb128 .LVL40-.LVL40
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL40
+	.uleb128 .LVL41-.LVL40
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL40
+	.uleb128 .LVL42-.LVL40
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL40
+	.uleb128 .LVL43-.LVL40
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU266
+	.uleb128 .LVU275
+.LLST14:
+	.byte	0x8
+	.quad	.LVL44
+	.uleb128 .LVL45-.LVL44
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x3e8
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU211
+	.uleb128 .LVU224
+	.uleb128 .LVU279
+	.uleb128 .LVU283
+.LLST18:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-1-.LVL33
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL46-.LVL33
+	.uleb128 .LVL47-.LVL33
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU43
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU56
+	.uleb128 .LVU56
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL3
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL3-.LVL3
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LVL4-.LVL3
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.LVL3
+	.uleb128 .LFE24-.LVL3
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x9c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL2:
+	.byte	0x5
+	.quad	.LBB46
+	.byte	0x4
+	.uleb128 .LBB46-.LBB46
+	.uleb128 .LBE46-.LBB46
+	.byte	0x4
+	.uleb128 .LBB60-.LBB46
+	.uleb128 .LBE60-.LBB46
+	.byte	0x4
+	.uleb128 .LBB62-.LBB46
+	.uleb128 .LBE62-.LBB46
+	.byte	0x4
+	.uleb128 .LBB95-.LBB46
+	.uleb128 .LBE95-.LBB46
+	.byte	0x4
+	.uleb128 .LBB97-.LBB46
+	.uleb128 .LBE97-.LBB46
+	.byte	0x4
+	.uleb128 .LBB99-.LBB46
+	.uleb128 .LBE99-.LBB46
+	.byte	0
+.LLRL4:
+	.byte	0x5
+	.quad	.LBB53
+	.byte	0x4
+	.uleb128 .LBB53-.LBB53
+	.uleb128 .LBE53-.LBB53
+	.byte	0x4
+	.uleb128 .LBB61-.LBB53
+	.uleb128 .LBE61-.LBB53
+	.byte	0x4
+	.uleb128 .LBB63-.LBB53
+	.uleb128 .LBE63-.LBB53
+	.byte	0x4
+	.uleb128 .LBB93-.LBB53
+	.uleb128 .LBE93-.LBB53
+	.byte	0
+.LLRL8:
+	.byte	0x5
+	.quad	.LBB64
+	.byte	0x4
+	.uleb128 .LBB64-.LBB64
+	.uleb128 .LBE64-.LBB64
+	.byte	0x4
+	.uleb128 .LBB94-.LBB64
+	.uleb128 .LBE94-.LBB64
+	.byte	0x4
+	.uleb128 .LBB96-.LBB64
+	.uleb128 .LBE96-.LBB64
+	.byte	0x4
+	.uleb128 .LBB98-.LBB64
+	.uleb128 .LBE98-.LBB64
+	.byte	0
+.LLRL11:
+	.byte	0x5
+	.quad	.LBB66
+	.byte	0x4
+	.uleb128 .LBB66-.LBB66
+	.uleb128 .LBE66-.LBB66
+	.byte	0x4
+	.uleb128 .LBB87-.LBB66
+	.uleb128 .LBE87-.LBB66
+	.byte	0x4
+	.uleb128 .LBB88-.LBB66
+	.uleb128 .LBE88-.LBB66
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB78
+	.byte	0x4
+	.uleb128 .LBB78-.LBB78
+	.uleb128 .LBE78-.LBB78
+	.byte	0x4
+	.uleb128 .LBB81-.LBB78
+	.uleb128 .LBE81-.LBB78
+	.byte	0
+.LLRL16:
+	.byte	0x5
+	.quad	.LBB82
+	.byte	0x4
+	.uleb128 .LBB82-.LBB82
+	.uleb128 .LBE82-.LBB82
+	.byte	0x4
+	.uleb128 .LBB86-.LBB82
+	.uleb128 .LBE86-.LBB82
+	.byte	0
+.LLRL17:
+	.byte	0x5
+	.quad	.LBB85
+	.byte	0x4
+	.uleb128 .LBB85-.LBB85
+	.uleb128 .LBE85-.LBB85
+	.byte	0x4
+	.uleb128 .LBB89-.LBB85
+	.uleb128 .LBE89-.LBB85
+	.byte	0
+.LLRL19:
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB14
+	.uleb128 .LFE14-.LFB14
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 15 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.file 18 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 31 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF772
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF814
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF815
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF816
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF693
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.file 42 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF819
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF849
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF854
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF857
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF858
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF875
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF876
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF877
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF889
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF896
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF897
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF901
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x4
+	.file 62 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3f
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1179
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 69 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.file 70 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 71 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.file 72 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1302
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1319
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF730
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF771
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF793
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF799
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF813
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF827
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF835
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF853
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF870
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1178
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1181
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1183
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1198
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1208
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1211
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1211
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1200
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1223
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1232
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1233
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1234
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1272
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1282
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1301
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1309
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1313
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1318
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF806:
+	.string	"__nlink_t_defined "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF1440:
+	.string	"performAcclerationCalibration"
+.LASF981:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1248:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF906:
+	.string	"__DECL_SIMD_cosl "
+.LASF874:
+	.string	"__fsfilcnt_t_defined "
+.LASF1099:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1334:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF974:
+	.string	"__DECL_SIMD_atan "
+.LASF767:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1429:
+	.string	"biquadFilterApply"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF775:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1220:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1082:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF780:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1142:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF840:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF787:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF991:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1147:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1035:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1178:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1383:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1109:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF843:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1030:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF815:
+	.string	"__clockid_t_defined 1"
+.LASF1000:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF996:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1336:
+	.string	"int32_t"
+.LASF1361:
+	.string	"PIDPITCH"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF852:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF956:
+	.string	"__DECL_SIMD_powl "
+.LASF1162:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1018:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1096:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1015:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF988:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1263:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1335:
+	.string	"int16_t"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF764:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1176:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1380:
+	.string	"ALIGN_DEFAULT"
+.LASF739:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1002:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1105:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1073:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1295:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF959:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF942:
+	.string	"__DECL_SIMD_logf64x "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1272:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1024:
+	.string	"__DECL_SIMD_cosh "
+.LASF748:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1279:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1289:
+	.string	"USE_GYRO_SITL "
+.LASF810:
+	.string	"__id_t_defined "
+.LASF862:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1325:
+	.string	"__int8_t"
+.LASF850:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF818:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1158:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1262:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1211:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF812:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1107:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF732:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1402:
+	.string	"GYRO_SPI_MPU6000"
+.LASF1266:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1189:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF865:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF774:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1165:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1313:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF972:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF984:
+	.string	"__DECL_SIMD_asin "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1392:
+	.string	"accHardware"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1202:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1360:
+	.string	"PIDROLL"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF821:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1256:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF816:
+	.string	"__time_t_defined 1"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1367:
+	.string	"PIDLEVEL"
+.LASF1293:
+	.string	"USE_BARO_SITL "
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF1399:
+	.string	"GYRO_L3G4200D"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF829:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1094:
+	.string	"__DECL_SIMD_log1p "
+.LASF1236:
+	.string	"__MATHCALL_NARROW"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1450:
+	.string	"useGyroConfig"
+.LASF1388:
+	.string	"CW270_DEG_FLIP"
+.LASF1229:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1261:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1198:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1433:
+	.string	"devClear"
+.LASF963:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1148:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF733:
+	.string	"NULL"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1143:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1032:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF876:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1427:
+	.string	"biquadFilterInitLPF"
+.LASF1385:
+	.string	"CW0_DEG_FLIP"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF890:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1240:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF763:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1314:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1291:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF1223:
+	.string	"__MATHDECL"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1031:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF983:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF820:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1416:
+	.string	"checkingKnownZero"
+.LASF1389:
+	.string	"sensor_align_e"
+.LASF781:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1332:
+	.string	"long int"
+.LASF1375:
+	.string	"SENSOR_BARO"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1125:
+	.string	"__DECL_SIMD_erff "
+.LASF834:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF854:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1181:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1228:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1252:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1203:
+	.string	"_Mdouble_ float"
+.LASF1134:
+	.string	"__DECL_SIMD_tanh "
+.LASF696:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1362:
+	.string	"PIDYAW"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1197:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1455:
+	.string	"acceptGyroZero"
+.LASF823:
+	.string	"__PDP_ENDIAN 3412"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF994:
+	.string	"__DECL_SIMD_hypot "
+.LASF1088:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF751:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1028:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1050:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1095:
+	.string	"__DECL_SIMD_log1pf "
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1247:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1251:
+	.string	"MATH_ERRNO 1"
+.LASF1222:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1391:
+	.string	"gyroHardware"
+.LASF860:
+	.string	"__NFDBITS"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1083:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF855:
+	.string	"____sigset_t_defined "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1120:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF798:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF889:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF930:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1324:
+	.string	"signed char"
+.LASF1085:
+	.string	"__DECL_SIMD_log2f "
+.LASF1337:
+	.string	"uint8_t"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1451:
+	.string	"knownSensorsToUse"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF789:
+	.string	"__f64x(x) x ##f64x"
+.LASF1393:
+	.string	"baroHardware"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1012:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1230:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1344:
+	.string	"m_oldM"
+.LASF1093:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1357:
+	.string	"scale"
+.LASF1160:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF801:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1297:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1079:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1206:
+	.string	"_Mdouble_ long double"
+.LASF1321:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF943:
+	.string	"__DECL_SIMD_logf128x "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1298:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1403:
+	.string	"GYRO_SPI_MPU6500"
+.LASF1260:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1311:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF861:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1436:
+	.string	"gyroGetADC"
+.LASF1199:
+	.string	"_Mdouble_"
+.LASF881:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1011:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1153:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1304:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF863:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1102:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF973:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1271:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1175:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF809:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF926:
+	.string	"__DECL_SIMD_sincosl "
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1151:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF869:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1417:
+	.string	"_Bool"
+.LASF993:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1316:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1431:
+	.string	"devStandardDeviation"
+.LASF1381:
+	.string	"CW0_DEG"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1434:
+	.string	"alignSensors"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1161:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1037:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1370:
+	.string	"PID_ITEM_COUNT"
+.LASF1387:
+	.string	"CW180_DEG_FLIP"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF771:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF694:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1258:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1405:
+	.string	"gyro"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF750:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF969:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF875:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1065:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1006:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1246:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1078:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1346:
+	.string	"m_oldS"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1329:
+	.string	"__uint16_t"
+.LASF1152:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF915:
+	.string	"__DECL_SIMD_sinf "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1166:
+	.string	"__DECL_SIMD_tanl "
+.LASF857:
+	.string	"__timeval_defined 1"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF743:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1043:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1286:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1241:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF795:
+	.string	"__lldiv_t_defined 1"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1231:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1020:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF891:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF908:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1238:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1145:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1008:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1139:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF762:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF791:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF790:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1025:
+	.string	"__DECL_SIMD_coshf "
+.LASF756:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1001:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1126:
+	.string	"__DECL_SIMD_erfl "
+.LASF802:
+	.string	"__ino_t_defined "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1242:
+	.string	"FP_ZERO 2"
+.LASF1438:
+	.string	"sample"
+.LASF1277:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF1365:
+	.string	"PIDPOSR"
+.LASF1118:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF837:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF878:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF864:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF841:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1243:
+	.string	"FP_SUBNORMAL 3"
+.LASF1059:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF1022:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1307:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF727:
+	.string	"__INT_WCHAR_T_H "
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF717:
+	.string	"_WCHAR_T "
+.LASF1169:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF858:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1278:
+	.string	"__disable_irq() "
+.LASF1119:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1090:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF814:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1186:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1156:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF1044:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1326:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1053:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1441:
+	.string	"storeKnownGyroZero"
+.LASF722:
+	.string	"_BSD_WCHAR_T_ "
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1106:
+	.string	"__DECL_SIMD_atanhl "
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF796:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF907:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF992:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1091:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF1138:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1218:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF848:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1023:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF931:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF979:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF734:
+	.string	"NULL ((void *)0)"
+.LASF1210:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1092:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF967:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1287:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF949:
+	.string	"__DECL_SIMD_expf64 "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF879:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1060:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1089:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF849:
+	.string	"_SYS_SELECT_H 1"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF1398:
+	.string	"GYRO_MPU6050"
+.LASF839:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1064:
+	.string	"__DECL_SIMD_atan2 "
+.LASF779:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1069:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1033:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1005:
+	.string	"__DECL_SIMD_exp2f "
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1423:
+	.string	"gyroFilterNotch"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF866:
+	.string	"NFDBITS __NFDBITS"
+.LASF1306:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1110:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1141:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1179:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF738:
+	.string	"WUNTRACED 2"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1057:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1372:
+	.string	"gyroADC"
+.LASF1021:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1180:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1456:
+	.string	"isGyroZeroKnown"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF944:
+	.string	"__DECL_SIMD_exp "
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF913:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF961:
+	.string	"__DECL_SIMD_powf32x "
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1014:
+	.string	"__DECL_SIMD_exp10 "
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1379:
+	.string	"SENSOR_GPSMAG"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF778:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1352:
+	.string	"sensorReadFuncPtr"
+.LASF1245:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF910:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF958:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1421:
+	.string	"gyroADCSumCount"
+.LASF1115:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1390:
+	.string	"knownSensors_s"
+.LASF1396:
+	.string	"knownSensors_t"
+.LASF859:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1039:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1077:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF947:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF740:
+	.string	"WEXITED 4"
+.LASF1237:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1249:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1386:
+	.string	"CW90_DEG_FLIP"
+.LASF962:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1364:
+	.string	"PIDPOS"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1157:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1276:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1087:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF845:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1350:
+	.string	"biquadFilter_t"
+.LASF919:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1384:
+	.string	"CW270_DEG"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF921:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1193:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF792:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF965:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF935:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1075:
+	.string	"__DECL_SIMD_log10f "
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1257:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1269:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1188:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1076:
+	.string	"__DECL_SIMD_log10l "
+.LASF1066:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1422:
+	.string	"gyroFilterLPF"
+.LASF1221:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF761:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF718:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1063:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF916:
+	.string	"__DECL_SIMD_sinl "
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1058:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF824:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF896:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1331:
+	.string	"__uint32_t"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1415:
+	.string	"calibrationCycles"
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF813:
+	.string	"__key_t_defined "
+.LASF1340:
+	.string	"long long int"
+.LASF1255:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1054:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1010:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1019:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF715:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1200:
+	.string	"__MATH_PRECNAME"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF904:
+	.string	"__DECL_SIMD_cos "
+.LASF833:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF784:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1373:
+	.string	"SENSOR_GYRO"
+.LASF1055:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1273:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF720:
+	.string	"__WCHAR_T "
+.LASF1343:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF978:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1394:
+	.string	"calibrated"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF933:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF955:
+	.string	"__DECL_SIMD_powf "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1354:
+	.string	"init"
+.LASF828:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF462:
+	.string	"__PMT"
+.LASF936:
+	.string	"__DECL_SIMD_logl "
+.LASF1419:
+	.string	"knownSensors"
+.LASF1114:
+	.string	"__DECL_SIMD_acosh "
+.LASF1205:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1081:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF844:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1213:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF770:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1310:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF982:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1209:
+	.string	"_Mdouble_ _Float32"
+.LASF1312:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1159:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF897:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF951:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF846:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1259:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1034:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1072:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1100:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1216:
+	.string	"_Mdouble_ _Float32x"
+.LASF1284:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1355:
+	.string	"read"
+.LASF776:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF766:
+	.string	"__HAVE_FLOAT128 1"
+.LASF847:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1445:
+	.string	"gyroStartBootCalibration"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF753:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1323:
+	.string	"unsigned int"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1446:
+	.string	"gyroSetCalibrationCycles"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1149:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1418:
+	.string	"gyroConfig"
+.LASF1217:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1084:
+	.string	"__DECL_SIMD_log2 "
+.LASF1428:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1194:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF1170:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1270:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF977:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1447:
+	.string	"calibrationCyclesRequired"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1274:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1074:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF950:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1071:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF925:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF899:
+	.string	"alloca"
+.LASF1366:
+	.string	"PIDNAVR"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1233:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF392:
+	.string	"false 0"
+.LASF785:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1294:
+	.string	"USE_USART1 "
+.LASF853:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1204:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF391:
+	.string	"true 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF957:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1290:
+	.string	"ACC "
+.LASF1235:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF917:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1132:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1303:
+	.string	"sq(x) ((x)*(x))"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF747:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1351:
+	.string	"sensorInitFuncPtr"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF952:
+	.string	"__DECL_SIMD_expf64x "
+.LASF746:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF939:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1042:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF760:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF932:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF1137:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1374:
+	.string	"SENSOR_ACC"
+.LASF729:
+	.string	"_WCHAR_T_DECLARED "
+.LASF777:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1007:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1016:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1116:
+	.string	"__DECL_SIMD_acoshl "
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1040:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF938:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1003:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1133:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1349:
+	.string	"biquadFilter_s"
+.LASF1371:
+	.string	"gyroZero"
+.LASF1333:
+	.string	"char"
+.LASF946:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1171:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF698:
+	.string	"_SIZE_T "
+.LASF725:
+	.string	"_WCHAR_T_H "
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1017:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF940:
+	.string	"__DECL_SIMD_logf128 "
+.LASF960:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1395:
+	.string	"baroGroundPressure"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF835:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF898:
+	.string	"_ALLOCA_H 1"
+.LASF970:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1408:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF1283:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF888:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1254:
+	.string	"M_E 2.7182818284590452354"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1411:
+	.string	"soft_gyro_notch_cutoff_hz"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1322:
+	.string	"short unsigned int"
+.LASF1009:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF1299:
+	.string	"BLACKBOX "
+.LASF1098:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF819:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1288:
+	.string	"GYRO "
+.LASF934:
+	.string	"__DECL_SIMD_log "
+.LASF966:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1129:
+	.string	"__DECL_SIMD_erff64 "
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1265:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1359:
+	.string	"gyro_t"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF902:
+	.string	"_MATH_H 1"
+.LASF1168:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF758:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1406:
+	.string	"gyroAlign"
+.LASF769:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1377:
+	.string	"SENSOR_SONAR"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF752:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF912:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF937:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1264:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF728:
+	.string	"_GCC_WCHAR_T "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF741:
+	.string	"WCONTINUED 8"
+.LASF1167:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1369:
+	.string	"PIDVEL"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1363:
+	.string	"PIDALT"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1121:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1097:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1140:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1341:
+	.string	"long long unsigned int"
+.LASF1135:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1414:
+	.string	"calibratingG"
+.LASF1292:
+	.string	"BARO "
+.LASF379:
+	.string	"SITL 1"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF757:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF811:
+	.string	"__ssize_t_defined "
+.LASF1338:
+	.string	"uint16_t"
+.LASF929:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1051:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1239:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1207:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1250:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1320:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF851:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF817:
+	.string	"__timer_t_defined 1"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1443:
+	.string	"isOnFinalGyroCalibrationCycle"
+.LASF803:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1046:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1068:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1080:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF822:
+	.string	"__BIG_ENDIAN 4321"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF1353:
+	.string	"gyro_s"
+.LASF923:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1183:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1225:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF893:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1127:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1136:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1192:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1302:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1190:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF713:
+	.string	"__size_t "
+.LASF868:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF724:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1452:
+	.string	"gyroConfigToUse"
+.LASF1413:
+	.string	"targetPidLooptime"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1004:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1201:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1187:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF999:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1453:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1368:
+	.string	"PIDMAG"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF736:
+	.string	"_STDLIB_H 1"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1281:
+	.string	"U_ID_1 0"
+.LASF735:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF901:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF877:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1013:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF719:
+	.string	"_T_WCHAR "
+.LASF1437:
+	.string	"gyroAccumulateSample"
+.LASF1435:
+	.string	"axis"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF903:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF745:
+	.string	"__WCLONE 0x80000000"
+.LASF1327:
+	.string	"__int16_t"
+.LASF1280:
+	.string	"U_ID_0 0x5349544c"
+.LASF1356:
+	.string	"temperature"
+.LASF1036:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF945:
+	.string	"__DECL_SIMD_expf "
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF927:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1177:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF870:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF836:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF954:
+	.string	"__DECL_SIMD_pow "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF765:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF721:
+	.string	"_WCHAR_T_ "
+.LASF808:
+	.string	"__off_t_defined "
+.LASF1056:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1407:
+	.string	"gyroConfig_s"
+.LASF1412:
+	.string	"gyroConfig_t"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1301:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF998:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1358:
+	.string	"samplePeriod"
+.LASF1052:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF723:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF887:
+	.string	"__LOCK_ALIGNMENT "
+.LASF987:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1062:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF768:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1112:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1150:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF1101:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1424:
+	.string	"gyroFilterSamplePeriod"
+.LASF807:
+	.string	"__uid_t_defined "
+.LASF1244:
+	.string	"FP_NORMAL 4"
+.LASF905:
+	.string	"__DECL_SIMD_cosf "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF831:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1144:
+	.string	"__DECL_SIMD_asinh "
+.LASF1174:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF772:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1268:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1215:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF786:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1226:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF755:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF742:
+	.string	"WNOWAIT 0x01000000"
+.LASF928:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1155:
+	.string	"__DECL_SIMD_erfcf "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF990:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF918:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF975:
+	.string	"__DECL_SIMD_atanf "
+.LASF1309:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF1104:
+	.string	"__DECL_SIMD_atanh "
+.LASF1214:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1328:
+	.string	"short int"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1253:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1124:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1047:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF872:
+	.string	"__blkcnt_t_defined "
+.LASF1448:
+	.string	"applyGyroFilters"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF842:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF871:
+	.string	"__blksize_t_defined "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1426:
+	.string	"biquadFilterInitNotch"
+.LASF1130:
+	.string	"__DECL_SIMD_erff128 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1070:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1425:
+	.string	"gyroFilterInitialised"
+.LASF1026:
+	.string	"__DECL_SIMD_coshl "
+.LASF995:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1285:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1267:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF737:
+	.string	"WNOHANG 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF800:
+	.string	"_SYS_TYPES_H 1"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1378:
+	.string	"SENSOR_GPS"
+.LASF1117:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1420:
+	.string	"gyroADCSum"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1029:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1401:
+	.string	"GYRO_L3GD20"
+.LASF953:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF989:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF716:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1154:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF1061:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1224:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF730:
+	.string	"__DEFINED_wchar_t "
+.LASF799:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF788:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1305:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF894:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF759:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF892:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1191:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF832:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF838:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1067:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1400:
+	.string	"GYRO_MPU3050"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1195:
+	.string	"_Mdouble_ double"
+.LASF1164:
+	.string	"__DECL_SIMD_tan "
+.LASF726:
+	.string	"___int_wchar_t_h "
+.LASF986:
+	.string	"__DECL_SIMD_asinl "
+.LASF1232:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF830:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1315:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1442:
+	.string	"isOnFirstGyroCalibrationCycle"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1410:
+	.string	"soft_gyro_notch_hz"
+.LASF980:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF794:
+	.string	"__ldiv_t_defined 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1103:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF773:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1430:
+	.string	"blinkLedAndSoundBeeper"
+.LASF1038:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF731:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1027:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF825:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1339:
+	.string	"uint32_t"
+.LASF1308:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1404:
+	.string	"GYRO_FAKE"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF895:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1449:
+	.string	"initGyroFilters"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF827:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF754:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1208:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1184:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF805:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1128:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1111:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1444:
+	.string	"isGyroCalibrationComplete"
+.LASF914:
+	.string	"__DECL_SIMD_sin "
+.LASF1185:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1345:
+	.string	"m_newM"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF968:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF922:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF1347:
+	.string	"m_newS"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1342:
+	.string	"float"
+.LASF1439:
+	.string	"applyGyroZero"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1317:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF1212:
+	.string	"_Mdouble_ _Float64"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1319:
+	.string	"GYRO_KNOWN_ZERO_TOLERANCE 16"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF924:
+	.string	"__DECL_SIMD_sincos "
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1048:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF920:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF948:
+	.string	"__DECL_SIMD_expf32 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF749:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF985:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF976:
+	.string	"__DECL_SIMD_atanl "
+.LASF1409:
+	.string	"soft_gyro_lpf_hz"
+.LASF1131:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1227:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1348:
+	.string	"stdev_t"
+.LASF964:
+	.string	"__DECL_SIMD_acos "
+.LASF911:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF804:
+	.string	"__gid_t_defined "
+.LASF1196:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1330:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF797:
+	.string	"EXIT_FAILURE 1"
+.LASF1045:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1454:
+	.string	"requestEEPROMWrite"
+.LASF793:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1282:
+	.string	"U_ID_2 0"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1086:
+	.string	"__DECL_SIMD_log2l "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF971:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF997:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1049:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1234:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF941:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF744:
+	.string	"__WALL 0x40000000"
+.LASF1146:
+	.string	"__DECL_SIMD_asinhl "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF826:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1182:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1376:
+	.string	"SENSOR_MAG"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF867:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1432:
+	.string	"devPush"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1318:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF1041:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF900:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1382:
+	.string	"CW90_DEG"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF880:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1397:
+	.string	"GYRO_DEFAULT"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1300:
+	.string	"PROFILING "
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1275:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF909:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1296:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF873:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/sensors/gyro.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8903 @@
+	.file	"initialisation.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/sensors/initialisation.c"
+	.section	.text.selectMPU6050Config,"ax",@progbits
+	.p2align 4
+	.globl	selectMPU6050Config
+	.type	selectMPU6050Config, @function
+selectMPU6050Config:
+.LFB0:
+	.file 1 ".//src/main/sensors/initialisation.c"
+	.loc 1 75 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU1
+	.loc 1 97 1 is_stmt 0 view .LVU2
+	xorl	%eax, %eax
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	selectMPU6050Config, .-selectMPU6050Config
+	.section	.text.detectGyro,"ax",@progbits
+	.p2align 4
+	.globl	detectGyro
+	.type	detectGyro, @function
+detectGyro:
+.LVL0:
+.LFB1:
+	.loc 1 135 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 135 1 is_stmt 0 view .LVU4
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	leaq	gyro(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	.loc 1 205 17 view .LVU5
+	movzwl	%si, %ebp
+	.loc 1 135 1 view .LVU6
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 135 1 view .LVU7
+	movl	%edi, %ebx
+.LVL1:
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	.loc 1 137 5 is_stmt 1 view .LVU8
+	.loc 1 205 17 is_stmt 0 view .LVU9
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	.loc 1 137 15 view .LVU10
+	movl	$0, gyroAlign(%rip)
+	.loc 1 138 5 is_stmt 1 view .LVU11
+	.loc 1 138 18 is_stmt 0 view .LVU12
+	movb	$0, gyroHardware(%rip)
+	.loc 1 140 5 is_stmt 1 view .LVU13
+	.loc 1 205 13 view .LVU14
+	.loc 1 205 17 is_stmt 0 view .LVU15
+	call	sitlGyroDetect@PLT
+.LVL2:
+	.loc 1 205 16 view .LVU16
+	testb	%al, %al
+	je	.L5
+	.loc 1 206 17 is_stmt 1 view .LVU17
+	.loc 1 206 30 is_stmt 0 view .LVU18
+	movb	$7, gyroHardware(%rip)
+	.loc 1 207 17 is_stmt 1 view .LVU19
+	.loc 1 217 13 view .LVU20
+	.loc 1 220 5 view .LVU21
+.L6:
+	.loc 1 222 27 is_stmt 0 view .LVU22
+	movl	$1, %eax
+	.loc 1 226 5 is_stmt 1 view .LVU23
+.L3:
+	.loc 1 227 1 is_stmt 0 view .LVU24
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL3:
+	.loc 1 227 1 view .LVU25
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL4:
+	.loc 1 227 1 view .LVU26
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+.LVL5:
+	.p2align 4,,10
+	.p2align 3
+.L5:
+	.cfi_restore_state
+	.loc 1 217 13 is_stmt 1 view .LVU27
+	.loc 1 220 5 view .LVU28
+	.loc 1 220 8 is_stmt 0 view .LVU29
+	cmpb	$0, gyroHardware(%rip)
+	jne	.L6
+	.loc 1 220 38 discriminator 1 view .LVU30
+	testb	%bl, %bl
+	je	.L3
+	.loc 1 222 27 view .LVU31
+	xorl	%ebx, %ebx
+.LVL6:
+	.loc 1 222 27 view .LVU32
+	jmp	.L4
+	.cfi_endproc
+.LFE1:
+	.size	detectGyro, .-detectGyro
+	.section	.text.reconfigureAlignment,"ax",@progbits
+	.p2align 4
+	.globl	reconfigureAlignment
+	.type	reconfigureAlignment, @function
+reconfigureAlignment:
+.LVL7:
+.LFB4:
+	.loc 1 447 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 448 5 view .LVU34
+	.loc 1 448 30 is_stmt 0 view .LVU35
+	movl	(%rdi), %eax
+	.loc 1 448 8 view .LVU36
+	testl	%eax, %eax
+	je	.L11
+	.loc 1 449 9 is_stmt 1 view .LVU37
+	.loc 1 449 19 is_stmt 0 view .LVU38
+	movl	%eax, gyroAlign(%rip)
+.L11:
+	.loc 1 451 5 is_stmt 1 view .LVU39
+	.loc 1 451 30 is_stmt 0 view .LVU40
+	movl	4(%rdi), %eax
+	.loc 1 451 8 view .LVU41
+	testl	%eax, %eax
+	je	.L12
+	.loc 1 452 9 is_stmt 1 view .LVU42
+	.loc 1 452 18 is_stmt 0 view .LVU43
+	movl	%eax, accAlign(%rip)
+.L12:
+	.loc 1 454 5 is_stmt 1 view .LVU44
+	.loc 1 454 30 is_stmt 0 view .LVU45
+	movl	8(%rdi), %eax
+	.loc 1 454 8 view .LVU46
+	testl	%eax, %eax
+	je	.L10
+	.loc 1 455 9 is_stmt 1 view .LVU47
+	.loc 1 455 18 is_stmt 0 view .LVU48
+	movl	%eax, magAlign(%rip)
+.L10:
+	.loc 1 457 1 view .LVU49
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	reconfigureAlignment, .-reconfigureAlignment
+	.section	.text.sensorsAutodetect,"ax",@progbits
+	.p2align 4
+	.globl	sensorsAutodetect
+	.type	sensorsAutodetect, @function
+sensorsAutodetect:
+.LVL8:
+.LFB6:
+	.loc 1 475 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 475 1 is_stmt 0 view .LVU51
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%edx, %r15d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rdi, %r14
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r8, %r13
+	.loc 1 476 5 is_stmt 1 view .LVU52
+	.loc 1 477 5 view .LVU53
+	.loc 1 478 5 view .LVU54
+	.loc 1 480 5 view .LVU55
+	.loc 1 475 1 is_stmt 0 view .LVU56
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	leaq	gyro(%rip), %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 480 10 view .LVU57
+	movzwl	%si, %ebp
+	.loc 1 475 1 view .LVU58
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 480 33 view .LVU59
+	movzbl	(%r8), %ebx
+.LVL9:
+.LBB12:
+.LBI12:
+	.loc 1 134 5 is_stmt 1 view .LVU60
+.LBE12:
+	.loc 1 475 1 is_stmt 0 view .LVU61
+	movl	%ecx, 12(%rsp)
+.LVL10:
+	.p2align 4,,10
+	.p2align 3
+.L24:
+.LBB15:
+.LBB13:
+	.loc 1 137 5 is_stmt 1 view .LVU62
+	.loc 1 205 17 is_stmt 0 view .LVU63
+	movl	%ebp, %esi
+	movq	%r12, %rdi
+	.loc 1 137 15 view .LVU64
+	movl	$0, gyroAlign(%rip)
+	.loc 1 138 5 is_stmt 1 view .LVU65
+	.loc 1 138 18 is_stmt 0 view .LVU66
+	movb	$0, gyroHardware(%rip)
+	.loc 1 140 5 is_stmt 1 view .LVU67
+	.loc 1 205 13 view .LVU68
+	.loc 1 205 17 is_stmt 0 view .LVU69
+	call	sitlGyroDetect@PLT
+.LVL11:
+	.loc 1 205 16 view .LVU70
+	testb	%al, %al
+	je	.L25
+	.loc 1 206 17 is_stmt 1 view .LVU71
+	.loc 1 206 30 is_stmt 0 view .LVU72
+	movb	$7, gyroHardware(%rip)
+	.loc 1 207 17 is_stmt 1 view .LVU73
+	.loc 1 217 13 view .LVU74
+	.loc 1 220 5 view .LVU75
+	.loc 1 226 5 view .LVU76
+.LVL12:
+.L26:
+	.loc 1 226 5 is_stmt 0 view .LVU77
+.LBE13:
+.LBE15:
+	.loc 1 483 5 is_stmt 1 view .LVU78
+	.loc 1 483 8 is_stmt 0 view .LVU79
+	testb	%r15b, %r15b
+	jne	.L76
+	.loc 1 484 9 is_stmt 1 view .LVU80
+	.loc 1 484 26 is_stmt 0 view .LVU81
+	movzbl	1(%r13), %eax
+.LDL1:
+.LVL13:
+.LBB16:
+.LBB17:
+	.loc 1 236 5 is_stmt 1 view .LVU82
+	.loc 1 236 14 is_stmt 0 view .LVU83
+	movl	$0, accAlign(%rip)
+	.loc 1 238 5 is_stmt 1 view .LVU84
+	cmpb	$8, %al
+	je	.L29
+	cmpb	$9, %al
+	je	.L30
+	leaq	acc(%rip), %rbx
+	testb	%al, %al
+	je	.L34
+.LVL14:
+.L31:
+	.loc 1 351 13 view .LVU85
+	.loc 1 353 13 view .LVU86
+	.loc 1 357 5 view .LVU87
+	.loc 1 357 8 is_stmt 0 view .LVU88
+	cmpb	$0, accHardware(%rip)
+	jne	.L36
+.L75:
+	leaq	acc(%rip), %rbx
+.LVL15:
+.L35:
+	.loc 1 236 5 is_stmt 1 view .LVU89
+	.loc 1 236 14 is_stmt 0 view .LVU90
+	movl	$0, accAlign(%rip)
+	.loc 1 238 5 is_stmt 1 view .LVU91
+.LVL16:
+.L34:
+	.loc 1 238 5 is_stmt 0 view .LVU92
+.LBE17:
+.LBE16:
+.LBB21:
+.LBB14:
+	.loc 1 222 27 view .LVU93
+	xorl	%ebp, %ebp
+	jmp	.L33
+.LVL17:
+	.p2align 4,,10
+	.p2align 3
+.L25:
+	.loc 1 217 13 is_stmt 1 view .LVU94
+	.loc 1 220 5 view .LVU95
+	.loc 1 220 8 is_stmt 0 view .LVU96
+	cmpb	$0, gyroHardware(%rip)
+	jne	.L26
+	.loc 1 220 38 view .LVU97
+	testb	%bl, %bl
+	je	.L23
+	.loc 1 222 27 view .LVU98
+	xorl	%ebx, %ebx
+.LVL18:
+	.loc 1 222 27 view .LVU99
+	jmp	.L24
+.LVL19:
+	.p2align 4,,10
+	.p2align 3
+.L29:
+	.loc 1 222 27 view .LVU100
+	movl	$8, %ebp
+	leaq	acc(%rip), %rbx
+.L33:
+.LBE14:
+.LBE21:
+.LBB22:
+.LBB18:
+	.loc 1 346 13 is_stmt 1 view .LVU101
+	.loc 1 346 17 is_stmt 0 view .LVU102
+	movq	%rbx, %rdi
+	call	sitlAccDetect@PLT
+.LVL20:
+	.loc 1 346 16 view .LVU103
+	testb	%al, %al
+	jne	.L77
+	.loc 1 351 13 is_stmt 1 view .LVU104
+	.loc 1 353 13 view .LVU105
+	.loc 1 357 5 view .LVU106
+	.loc 1 357 8 is_stmt 0 view .LVU107
+	cmpb	$0, accHardware(%rip)
+	jne	.L36
+	.loc 1 358 9 is_stmt 1 view .LVU108
+	.loc 1 358 12 is_stmt 0 view .LVU109
+	testb	%bpl, %bpl
+	jne	.L35
+	.loc 1 364 13 is_stmt 1 view .LVU110
+	movl	$2, %edi
+	call	sensorsClear@PLT
+.LVL21:
+.L36:
+.LBE18:
+.LBE22:
+	.loc 1 487 5 view .LVU111
+.LBB23:
+.LBB24:
+	.loc 1 374 18 is_stmt 0 view .LVU112
+	movb	$1, baroHardware(%rip)
+.LBE24:
+.LBE23:
+	.loc 1 487 28 view .LVU113
+	movzbl	2(%r13), %ebx
+.LVL22:
+.LBB28:
+.LBI23:
+	.loc 1 370 13 is_stmt 1 view .LVU114
+.LBB25:
+	.loc 1 374 5 view .LVU115
+	leaq	baro(%rip), %rbp
+.LVL23:
+	.p2align 4,,10
+	.p2align 3
+.L39:
+	.loc 1 401 5 view .LVU116
+	.loc 1 404 13 view .LVU117
+	.loc 1 423 13 view .LVU118
+	.loc 1 423 17 is_stmt 0 view .LVU119
+	movq	%rbp, %rdi
+	call	sitlBaroDetect@PLT
+.LVL24:
+	.loc 1 423 16 view .LVU120
+	testb	%al, %al
+	je	.L40
+	.loc 1 424 17 is_stmt 1 view .LVU121
+	.loc 1 424 30 is_stmt 0 view .LVU122
+	movb	$4, baroHardware(%rip)
+	.loc 1 425 17 is_stmt 1 view .LVU123
+	.loc 1 427 13 view .LVU124
+	.loc 1 429 13 view .LVU125
+	.loc 1 432 5 view .LVU126
+	.loc 1 441 5 view .LVU127
+.L41:
+.LVL25:
+	.loc 1 441 5 is_stmt 0 view .LVU128
+.LBE25:
+.LBE28:
+	.loc 1 488 5 is_stmt 1 view .LVU129
+.LBB29:
+.LBI29:
+	.loc 1 463 13 view .LVU130
+.LBB30:
+	.loc 1 465 5 view .LVU131
+	.loc 1 465 36 is_stmt 0 view .LVU132
+	movzbl	gyroHardware(%rip), %eax
+	.loc 1 465 8 view .LVU133
+	cmpb	%al, 0(%r13)
+	je	.L78
+.L43:
+	.loc 1 467 9 is_stmt 1 view .LVU134
+	.loc 1 467 34 is_stmt 0 view .LVU135
+	movb	$0, 3(%r13)
+.L44:
+	.loc 1 469 5 is_stmt 1 view .LVU136
+	.loc 1 469 32 is_stmt 0 view .LVU137
+	movb	%al, 0(%r13)
+	.loc 1 470 5 is_stmt 1 view .LVU138
+	.loc 1 470 31 is_stmt 0 view .LVU139
+	movzbl	accHardware(%rip), %eax
+	movb	%al, 1(%r13)
+	.loc 1 471 5 is_stmt 1 view .LVU140
+	.loc 1 471 32 is_stmt 0 view .LVU141
+	movzbl	baroHardware(%rip), %eax
+	movb	%al, 2(%r13)
+.LVL26:
+	.loc 1 471 32 view .LVU142
+.LBE30:
+.LBE29:
+	.loc 1 490 5 is_stmt 1 view .LVU143
+.LBB32:
+.LBI32:
+	.loc 1 446 6 view .LVU144
+.LBB33:
+	.loc 1 448 5 view .LVU145
+	.loc 1 448 30 is_stmt 0 view .LVU146
+	movl	(%r14), %eax
+	.loc 1 448 8 view .LVU147
+	testl	%eax, %eax
+	je	.L45
+	.loc 1 449 9 is_stmt 1 view .LVU148
+	.loc 1 449 19 is_stmt 0 view .LVU149
+	movl	%eax, gyroAlign(%rip)
+.L45:
+	.loc 1 451 5 is_stmt 1 view .LVU150
+	.loc 1 451 30 is_stmt 0 view .LVU151
+	movl	4(%r14), %eax
+	.loc 1 451 8 view .LVU152
+	testl	%eax, %eax
+	je	.L46
+	.loc 1 452 9 is_stmt 1 view .LVU153
+	.loc 1 452 18 is_stmt 0 view .LVU154
+	movl	%eax, accAlign(%rip)
+.L46:
+	.loc 1 454 5 is_stmt 1 view .LVU155
+	.loc 1 454 30 is_stmt 0 view .LVU156
+	movl	8(%r14), %eax
+	.loc 1 454 8 view .LVU157
+	testl	%eax, %eax
+	je	.L47
+	.loc 1 455 9 is_stmt 1 view .LVU158
+	.loc 1 455 18 is_stmt 0 view .LVU159
+	movl	%eax, magAlign(%rip)
+.L47:
+.LVL27:
+	.loc 1 455 18 view .LVU160
+.LBE33:
+.LBE32:
+	.loc 1 493 5 is_stmt 1 view .LVU161
+	.loc 1 493 9 is_stmt 0 view .LVU162
+	movl	$2, %edi
+	call	sensors@PLT
+.LVL28:
+	.loc 1 493 8 view .LVU163
+	testb	%al, %al
+	je	.L48
+	.loc 1 494 9 is_stmt 1 view .LVU164
+	call	*acc(%rip)
+.LVL29:
+.L48:
+	.loc 1 496 5 view .LVU165
+	call	*gyro(%rip)
+.LVL30:
+	.loc 1 507 5 view .LVU166
+	.loc 1 507 9 is_stmt 0 view .LVU167
+	movl	$8, %edi
+	call	sensors@PLT
+.LVL31:
+	pxor	%xmm0, %xmm0
+	.loc 1 507 8 view .LVU168
+	testb	%al, %al
+	je	.L49
+	.loc 1 509 9 is_stmt 1 view .LVU169
+.LVL32:
+	.loc 1 510 9 view .LVU170
+	.loc 1 512 9 view .LVU171
+	.loc 1 510 13 is_stmt 0 view .LVU172
+	movl	12(%rsp), %ecx
+	.loc 1 512 39 view .LVU173
+	pxor	%xmm0, %xmm0
+	.loc 1 512 36 view .LVU174
+	pxor	%xmm1, %xmm1
+	.loc 1 510 13 view .LVU175
+	movswl	%cx, %eax
+	movl	%ecx, %edx
+	imull	$5243, %eax, %eax
+	sarw	$15, %dx
+	sarl	$19, %eax
+	subl	%edx, %eax
+	leal	(%rax,%rax,4), %edx
+	.loc 1 512 36 view .LVU176
+	cwtl
+	cvtsi2ssl	%eax, %xmm1
+	.loc 1 510 13 view .LVU177
+	leal	(%rdx,%rdx,4), %edx
+	sall	$2, %edx
+	subl	%edx, %ecx
+	.loc 1 512 39 view .LVU178
+	movswl	%cx, %edx
+	cvtsi2ssl	%edx, %xmm0
+	.loc 1 512 50 view .LVU179
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 512 36 view .LVU180
+	addss	%xmm1, %xmm0
+	.loc 1 512 69 view .LVU181
+	mulss	.LC2(%rip), %xmm0
+.LVL33:
+.L49:
+	.loc 1 512 29 view .LVU182
+	movss	%xmm0, magneticDeclination(%rip)
+	.loc 1 517 11 view .LVU183
+	movl	$1, %eax
+.L23:
+	.loc 1 518 1 view .LVU184
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL34:
+	.loc 1 518 1 view .LVU185
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL35:
+	.loc 1 518 1 view .LVU186
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL36:
+	.p2align 4,,10
+	.p2align 3
+.L76:
+	.cfi_restore_state
+.LBB34:
+.LBB19:
+	.loc 1 236 5 is_stmt 1 view .LVU187
+	.loc 1 236 14 is_stmt 0 view .LVU188
+	movl	$0, accAlign(%rip)
+	.loc 1 238 5 is_stmt 1 view .LVU189
+	cmpb	$8, %r15b
+	je	.L29
+	cmpb	$9, %r15b
+	jne	.L31
+.LVL37:
+.L30:
+	.loc 1 248 13 view .LVU190
+	movl	$2, %edi
+	call	sensorsClear@PLT
+.LVL38:
+	.loc 1 249 13 view .LVU191
+	.loc 1 351 13 view .LVU192
+	.loc 1 353 13 view .LVU193
+	.loc 1 357 5 view .LVU194
+	.loc 1 357 8 is_stmt 0 view .LVU195
+	cmpb	$0, accHardware(%rip)
+	je	.L75
+	jmp	.L36
+.LVL39:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+	.loc 1 357 8 view .LVU196
+.LBE19:
+.LBE34:
+.LBB35:
+.LBB26:
+	.loc 1 427 13 is_stmt 1 view .LVU197
+	.loc 1 429 13 view .LVU198
+	.loc 1 432 5 view .LVU199
+	.loc 1 432 8 is_stmt 0 view .LVU200
+	cmpb	$1, baroHardware(%rip)
+	jne	.L41
+	.loc 1 432 35 view .LVU201
+	testb	%bl, %bl
+	je	.L79
+	.loc 1 434 27 view .LVU202
+	xorl	%ebx, %ebx
+.LVL40:
+	.loc 1 434 27 view .LVU203
+	jmp	.L39
+.LVL41:
+	.p2align 4,,10
+	.p2align 3
+.L78:
+	.loc 1 434 27 view .LVU204
+.LBE26:
+.LBE35:
+.LBB36:
+.LBB31:
+	.loc 1 465 52 view .LVU205
+	movzbl	accHardware(%rip), %ecx
+	cmpb	%cl, 1(%r13)
+	jne	.L43
+	.loc 1 465 96 view .LVU206
+	movzbl	baroHardware(%rip), %ecx
+	cmpb	%cl, 2(%r13)
+	jne	.L43
+	jmp	.L44
+.LVL42:
+	.p2align 4,,10
+	.p2align 3
+.L79:
+	.loc 1 465 96 view .LVU207
+.LBE31:
+.LBE36:
+.LBB37:
+.LBB27:
+	.loc 1 441 5 is_stmt 1 view .LVU208
+	.loc 1 442 9 view .LVU209
+	movl	$4, %edi
+	call	sensorsClear@PLT
+.LVL43:
+	jmp	.L41
+.LVL44:
+	.p2align 4,,10
+	.p2align 3
+.L77:
+	.loc 1 442 9 is_stmt 0 view .LVU210
+.LBE27:
+.LBE37:
+.LBB38:
+.LBB20:
+	.loc 1 347 17 is_stmt 1 view .LVU211
+	.loc 1 347 29 is_stmt 0 view .LVU212
+	movb	$8, accHardware(%rip)
+	.loc 1 348 17 is_stmt 1 view .LVU213
+	.loc 1 351 13 view .LVU214
+	.loc 1 353 13 view .LVU215
+	.loc 1 357 5 view .LVU216
+	jmp	.L36
+.LBE20:
+.LBE38:
+	.cfi_endproc
+.LFE6:
+	.size	sensorsAutodetect, .-sensorsAutodetect
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC1:
+	.long	1015580809
+	.align 4
+.LC2:
+	.long	1092616192
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 6 ".//src/main/drivers/accgyro.h"
+	.file 7 ".//src/main/drivers/accgyro_mpu6050.h"
+	.file 8 ".//src/main/drivers/barometer.h"
+	.file 9 ".//src/main/sensors/sensors.h"
+	.file 10 ".//src/main/sensors/acceleration.h"
+	.file 11 ".//src/main/sensors/barometer.h"
+	.file 12 ".//src/main/sensors/gyro.h"
+	.file 13 ".//src/main/sensors/compass.h"
+	.file 14 ".//src/main/target/SITL/sitl.h"
+	.file 15 ".//src/main/config/runtime_config.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x97d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1127
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL20
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1001
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1002
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1003
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1004
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1005
+	.uleb128 0x3
+	.long	.LASF1006
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x2e
+	.uleb128 0x3
+	.long	.LASF1007
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1008
+	.uleb128 0x3
+	.long	.LASF1009
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1010
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1011
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x3c
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1012
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1013
+	.uleb128 0x3
+	.long	.LASF1014
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1015
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1016
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1017
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1018
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x1b
+	.byte	0x10
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x9
+	.long	0x11d
+	.uleb128 0x2
+	.long	.LASF1019
+	.byte	0x5
+	.byte	0x1f
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x10
+	.string	"BRR"
+	.byte	0x20
+	.long	0xd9
+	.byte	0x4
+	.uleb128 0x10
+	.string	"ODR"
+	.byte	0x21
+	.long	0xd9
+	.byte	0x8
+	.uleb128 0x10
+	.string	"IDR"
+	.byte	0x22
+	.long	0xd9
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1020
+	.byte	0x5
+	.byte	0x23
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF1021
+	.byte	0x6
+	.byte	0x16
+	.byte	0x10
+	.long	0x135
+	.uleb128 0x4
+	.long	0x13a
+	.uleb128 0x1c
+	.uleb128 0x3
+	.long	.LASF1022
+	.byte	0x6
+	.byte	0x17
+	.byte	0x10
+	.long	0x147
+	.uleb128 0x4
+	.long	0x14c
+	.uleb128 0x16
+	.long	0x157
+	.uleb128 0x7
+	.long	0x157
+	.byte	0
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0xa
+	.long	.LASF1030
+	.byte	0x20
+	.byte	0x6
+	.byte	0x19
+	.long	0x1aa
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x17
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x17
+	.long	0x13b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1025
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x17
+	.long	0x13b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1026
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xb
+	.long	0x1aa
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1027
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1028
+	.uleb128 0x3
+	.long	.LASF1029
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x3
+	.long	0x15c
+	.uleb128 0xa
+	.long	.LASF1031
+	.byte	0x18
+	.byte	0x6
+	.byte	0x21
+	.long	0x1f1
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x6
+	.byte	0x22
+	.byte	0x17
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x6
+	.byte	0x23
+	.byte	0x17
+	.long	0x13b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x6
+	.byte	0x24
+	.byte	0xa
+	.long	0xa2
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1033
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3
+	.long	0x1bd
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1034
+	.uleb128 0xa
+	.long	.LASF1035
+	.byte	0x10
+	.byte	0x7
+	.byte	0x14
+	.long	0x238
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0x7
+	.byte	0x15
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x7
+	.byte	0x16
+	.byte	0xe
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1038
+	.byte	0x7
+	.byte	0x17
+	.byte	0x13
+	.long	0x238
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x11d
+	.uleb128 0x3
+	.long	.LASF1039
+	.byte	0x7
+	.byte	0x18
+	.byte	0x3
+	.long	0x204
+	.uleb128 0x1d
+	.long	0x23d
+	.uleb128 0x3
+	.long	.LASF1040
+	.byte	0x8
+	.byte	0x14
+	.byte	0x10
+	.long	0x135
+	.uleb128 0x3
+	.long	.LASF1041
+	.byte	0x8
+	.byte	0x15
+	.byte	0x10
+	.long	0x266
+	.uleb128 0x4
+	.long	0x26b
+	.uleb128 0x16
+	.long	0x27b
+	.uleb128 0x7
+	.long	0x27b
+	.uleb128 0x7
+	.long	0x27b
+	.byte	0
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0xa
+	.long	.LASF1042
+	.byte	0x30
+	.byte	0x8
+	.byte	0x17
+	.long	0x2e8
+	.uleb128 0x2
+	.long	.LASF1043
+	.byte	0x8
+	.byte	0x18
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0x8
+	.byte	0x19
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1045
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x13
+	.long	0x24e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1046
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x13
+	.long	0x24e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1047
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x13
+	.long	0x24e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1048
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x13
+	.long	0x24e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1049
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x25a
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1042
+	.byte	0x8
+	.byte	0x1f
+	.byte	0x3
+	.long	0x280
+	.uleb128 0x1e
+	.long	0xa9
+	.long	0x304
+	.uleb128 0x1f
+	.long	0x43
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0x9
+	.byte	0x1c
+	.long	0x33a
+	.uleb128 0x1
+	.long	.LASF1050
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1051
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1052
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0x40
+	.byte	0
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0x9
+	.byte	0x26
+	.long	0x37c
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1059
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1060
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1066
+	.byte	0x9
+	.byte	0x30
+	.byte	0x3
+	.long	0x33a
+	.uleb128 0xa
+	.long	.LASF1067
+	.byte	0xc
+	.byte	0x9
+	.byte	0x32
+	.long	0x3bc
+	.uleb128 0x2
+	.long	.LASF1068
+	.byte	0x9
+	.byte	0x33
+	.byte	0x14
+	.long	0x37c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1069
+	.byte	0x9
+	.byte	0x34
+	.byte	0x14
+	.long	0x37c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0x9
+	.byte	0x35
+	.byte	0x14
+	.long	0x37c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1071
+	.byte	0x9
+	.byte	0x36
+	.byte	0x3
+	.long	0x388
+	.uleb128 0xa
+	.long	.LASF1072
+	.byte	0x10
+	.byte	0x9
+	.byte	0x39
+	.long	0x423
+	.uleb128 0x2
+	.long	.LASF1073
+	.byte	0x9
+	.byte	0x3a
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1074
+	.byte	0x9
+	.byte	0x3b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1077
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2f4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1078
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1079
+	.byte	0x9
+	.byte	0x40
+	.byte	0x3
+	.long	0x3c8
+	.uleb128 0x20
+	.long	.LASF1128
+	.byte	0x7
+	.byte	0x4
+	.long	0x3c
+	.byte	0xa
+	.byte	0x15
+	.byte	0xe
+	.long	0x47e
+	.uleb128 0x1
+	.long	.LASF1080
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1088
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0x9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1074
+	.byte	0xa
+	.byte	0x22
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x8
+	.long	.LASF1090
+	.byte	0xa
+	.byte	0x23
+	.byte	0x17
+	.long	0x37c
+	.uleb128 0x21
+	.string	"acc"
+	.byte	0xa
+	.byte	0x24
+	.byte	0xe
+	.long	0x1f1
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0xb
+	.byte	0x17
+	.long	0x4cc
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1095
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1075
+	.byte	0xb
+	.byte	0x26
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0xd
+	.long	0x3c
+	.byte	0xc
+	.byte	0x15
+	.long	0x514
+	.uleb128 0x1
+	.long	.LASF1096
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1098
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1099
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1100
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1103
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1104
+	.byte	0xc
+	.byte	0x20
+	.byte	0xf
+	.long	0x1b1
+	.uleb128 0x8
+	.long	.LASF1073
+	.byte	0xc
+	.byte	0x21
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x8
+	.long	.LASF1105
+	.byte	0xc
+	.byte	0x22
+	.byte	0x17
+	.long	0x37c
+	.uleb128 0x8
+	.long	.LASF1106
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x17
+	.long	0x37c
+	.uleb128 0x8
+	.long	.LASF1107
+	.byte	0x1
+	.byte	0x44
+	.byte	0xe
+	.long	0x1aa
+	.uleb128 0x8
+	.long	.LASF1108
+	.byte	0x1
+	.byte	0x47
+	.byte	0xf
+	.long	0x2e8
+	.uleb128 0xe
+	.long	.LASF1109
+	.byte	0xe
+	.byte	0x36
+	.long	0x1fd
+	.long	0x571
+	.uleb128 0x7
+	.long	0x571
+	.byte	0
+	.uleb128 0x4
+	.long	0x2e8
+	.uleb128 0xe
+	.long	.LASF1110
+	.byte	0xe
+	.byte	0x35
+	.long	0x1fd
+	.long	0x58b
+	.uleb128 0x7
+	.long	0x58b
+	.byte	0
+	.uleb128 0x4
+	.long	0x1f1
+	.uleb128 0x22
+	.long	.LASF1118
+	.byte	0xf
+	.byte	0x45
+	.byte	0x6
+	.long	0x5a2
+	.uleb128 0x7
+	.long	0xd9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1111
+	.byte	0xf
+	.byte	0x43
+	.long	0x1fd
+	.long	0x5b7
+	.uleb128 0x7
+	.long	0xd9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1112
+	.byte	0xe
+	.byte	0x34
+	.long	0x1fd
+	.long	0x5d1
+	.uleb128 0x7
+	.long	0x5d1
+	.uleb128 0x7
+	.long	0xcd
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b1
+	.uleb128 0x23
+	.long	.LASF1129
+	.byte	0x1
+	.value	0x1da
+	.byte	0x5
+	.long	0x1fd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x837
+	.uleb128 0xb
+	.long	.LASF1113
+	.byte	0x30
+	.long	0x837
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xb
+	.long	.LASF1114
+	.byte	0x50
+	.long	0xcd
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xb
+	.long	.LASF1115
+	.byte	0x61
+	.long	0xc1
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xb
+	.long	.LASF1116
+	.byte	0x7b
+	.long	0xa9
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xb
+	.long	.LASF1117
+	.byte	0xa5
+	.long	0x83c
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x17
+	.string	"deg"
+	.byte	0xd
+	.long	0xa9
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x17
+	.string	"min"
+	.byte	0x12
+	.long	0xa9
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x11
+	.long	0x8b6
+	.quad	.LBI12
+	.byte	.LVU60
+	.long	.LLRL9
+	.value	0x1e0
+	.byte	0xa
+	.long	0x6d8
+	.uleb128 0x9
+	.long	0x8d2
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x9
+	.long	0x8c7
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x12
+	.long	.LLRL12
+	.uleb128 0x13
+	.long	0x8dd
+	.quad	.L24
+	.uleb128 0xc
+	.quad	.LVL11
+	.long	0x5b7
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	0x895
+	.long	.LLRL13
+	.byte	0x1
+	.value	0x1e6
+	.byte	0x5
+	.long	0x74c
+	.uleb128 0x9
+	.long	0x8a2
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x12
+	.long	.LLRL13
+	.uleb128 0x13
+	.long	0x8ad
+	.quad	.LDL1
+	.uleb128 0xf
+	.quad	.LVL20
+	.long	0x576
+	.long	0x720
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL21
+	.long	0x590
+	.long	0x737
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL38
+	.long	0x590
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x874
+	.quad	.LBI23
+	.byte	.LVU114
+	.long	.LLRL15
+	.value	0x1e7
+	.byte	0x5
+	.long	0x7b1
+	.uleb128 0x9
+	.long	0x87f
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x12
+	.long	.LLRL15
+	.uleb128 0x13
+	.long	0x88b
+	.quad	.L39
+	.uleb128 0xf
+	.quad	.LVL24
+	.long	0x55c
+	.long	0x79c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL43
+	.long	0x590
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x841
+	.quad	.LBI29
+	.byte	.LVU130
+	.long	.LLRL17
+	.value	0x1e8
+	.byte	0x5
+	.long	0x7d8
+	.uleb128 0x9
+	.long	0x84c
+	.long	.LLST18
+	.long	.LVUS18
+	.byte	0
+	.uleb128 0x25
+	.long	0x859
+	.quad	.LBI32
+	.byte	.LVU144
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.byte	0x1
+	.value	0x1ea
+	.byte	0x5
+	.long	0x80c
+	.uleb128 0x9
+	.long	0x867
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL28
+	.long	0x5a2
+	.long	0x823
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL31
+	.long	0x5a2
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x3bc
+	.uleb128 0x4
+	.long	0x423
+	.uleb128 0x18
+	.long	.LASF1120
+	.value	0x1cf
+	.long	0x859
+	.uleb128 0x14
+	.long	.LASF1117
+	.value	0x1cf
+	.byte	0x30
+	.long	0x83c
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1119
+	.byte	0x1
+	.value	0x1be
+	.byte	0x6
+	.byte	0x1
+	.long	0x874
+	.uleb128 0x14
+	.long	.LASF1113
+	.value	0x1be
+	.byte	0x34
+	.long	0x837
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1121
+	.value	0x172
+	.long	0x895
+	.uleb128 0x14
+	.long	.LASF1122
+	.value	0x172
+	.byte	0x20
+	.long	0xc1
+	.uleb128 0x27
+	.long	.LASF1124
+	.byte	0x1
+	.value	0x190
+	.byte	0x1
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1123
+	.byte	0x1
+	.byte	0xe5
+	.byte	0xd
+	.byte	0x1
+	.long	0x8b6
+	.uleb128 0x15
+	.long	.LASF1115
+	.byte	0xe5
+	.byte	0x1f
+	.long	0xc1
+	.uleb128 0x29
+	.long	.LASF1124
+	.byte	0x1
+	.byte	0xeb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1125
+	.byte	0x1
+	.byte	0x86
+	.byte	0x5
+	.long	0x1fd
+	.byte	0x1
+	.long	0x8ee
+	.uleb128 0x15
+	.long	.LASF1126
+	.byte	0x86
+	.byte	0x18
+	.long	0xc1
+	.uleb128 0x15
+	.long	.LASF1114
+	.byte	0x86
+	.byte	0x34
+	.long	0xcd
+	.uleb128 0x2b
+	.long	.LASF1124
+	.byte	0x1
+	.byte	0x88
+	.byte	0x1
+	.quad	.L4
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1130
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x18
+	.long	0x90c
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x4
+	.long	0x249
+	.uleb128 0x2d
+	.long	0x8b6
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x961
+	.uleb128 0x9
+	.long	0x8c7
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x9
+	.long	0x8d2
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xc
+	.quad	.LVL2
+	.long	0x5b7
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x859
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2f
+	.long	0x867
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 474
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 476
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LVL35-.LVL8
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL35-.LVL8
+	.uleb128 .LVL36-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL8
+	.uleb128 .LFE6-.LVL8
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LVL15-.LVL8
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL15-.LVL8
+	.uleb128 .LFE6-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU82
+	.uleb128 .LVU94
+	.uleb128 .LVU100
+.LLST4:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LVL13-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.LVL8
+	.uleb128 .LVL19-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LFE6-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU185
+	.uleb128 .LVU185
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL10-.LVL8
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL10-.LVL8
+	.uleb128 .LVL34-.LVL8
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL34-.LVL8
+	.uleb128 .LVL36-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL8
+	.uleb128 .LFE6-.LVL8
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU170
+	.uleb128 .LVU182
+.LLST7:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU171
+	.uleb128 .LVU182
+.LLST8:
+	.byte	0x8
+	.quad	.LVL32
+	.uleb128 .LVL33-.LVL32
+	.uleb128 0xd
+	.byte	0x91
+	.sleb128 -68
+	.byte	0x94
+	.byte	0x2
+	.byte	0x8
+	.byte	0x64
+	.byte	0x14
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU77
+	.uleb128 .LVU94
+	.uleb128 .LVU100
+.LLST10:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL10-.LVL9
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.LVL9
+	.uleb128 .LVL12-.LVL9
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL17-.LVL9
+	.uleb128 .LVL19-.LVL9
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU60
+	.uleb128 .LVU77
+	.uleb128 .LVU94
+	.uleb128 .LVU99
+.LLST11:
+	.byte	0x6
+	.quad	.LVL9
+	.byte	0x4
+	.uleb128 .LVL9-.LVL9
+	.uleb128 .LVL12-.LVL9
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.LVL9
+	.uleb128 .LVL18-.LVL9
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU82
+	.uleb128 .LVU85
+	.uleb128 .LVU89
+	.uleb128 .LVU92
+	.uleb128 .LVU187
+	.uleb128 .LVU190
+.LLST14:
+	.byte	0x6
+	.quad	.LVL13
+	.byte	0x4
+	.uleb128 .LVL13-.LVL13
+	.uleb128 .LVL14-.LVL13
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.LVL13
+	.uleb128 .LVL16-.LVL13
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL13
+	.uleb128 .LVL37-.LVL13
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU114
+	.uleb128 .LVU128
+	.uleb128 .LVU196
+	.uleb128 .LVU203
+	.uleb128 .LVU207
+	.uleb128 .LVU210
+.LLST16:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL25-.LVL22
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL39-.LVL22
+	.uleb128 .LVL40-.LVL22
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL42-.LVL22
+	.uleb128 .LVL44-.LVL22
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU130
+	.uleb128 .LVU142
+	.uleb128 .LVU204
+	.uleb128 .LVU207
+.LLST18:
+	.byte	0x6
+	.quad	.LVL25
+	.byte	0x4
+	.uleb128 .LVL25-.LVL25
+	.uleb128 .LVL26-.LVL25
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL41-.LVL25
+	.uleb128 .LVL42-.LVL25
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU144
+	.uleb128 .LVU160
+.LLST19:
+	.byte	0x8
+	.quad	.LVL26
+	.uleb128 .LVL27-.LVL26
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU25
+	.uleb128 .LVU27
+	.uleb128 .LVU32
+.LLST0:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL3-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.LVL0
+	.uleb128 .LVL6-.LVL0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL0
+	.byte	0x4
+	.uleb128 .LVL0-.LVL0
+	.uleb128 .LVL1-.LVL0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.LVL0
+	.uleb128 .LVL4-.LVL0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL4-.LVL0
+	.uleb128 .LFE1-.LVL0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x5c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB0
+	.quad	.LFE0-.LFB0
+	.quad	.LFB1
+	.quad	.LFE1-.LFB1
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x7
+	.quad	.LBB12
+	.uleb128 .LBE12-.LBB12
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB15
+	.byte	0x4
+	.uleb128 .LBB15-.LBB15
+	.uleb128 .LBE15-.LBB15
+	.byte	0x4
+	.uleb128 .LBB21-.LBB15
+	.uleb128 .LBE21-.LBB15
+	.byte	0
+.LLRL13:
+	.byte	0x5
+	.quad	.LBB16
+	.byte	0x4
+	.uleb128 .LBB16-.LBB16
+	.uleb128 .LBE16-.LBB16
+	.byte	0x4
+	.uleb128 .LBB22-.LBB16
+	.uleb128 .LBE22-.LBB16
+	.byte	0x4
+	.uleb128 .LBB34-.LBB16
+	.uleb128 .LBE34-.LBB16
+	.byte	0x4
+	.uleb128 .LBB38-.LBB16
+	.uleb128 .LBE38-.LBB16
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB23
+	.byte	0x4
+	.uleb128 .LBB23-.LBB23
+	.uleb128 .LBE23-.LBB23
+	.byte	0x4
+	.uleb128 .LBB28-.LBB23
+	.uleb128 .LBE28-.LBB23
+	.byte	0x4
+	.uleb128 .LBB35-.LBB23
+	.uleb128 .LBE35-.LBB23
+	.byte	0x4
+	.uleb128 .LBB37-.LBB23
+	.uleb128 .LBE37-.LBB23
+	.byte	0
+.LLRL17:
+	.byte	0x5
+	.quad	.LBB29
+	.byte	0x4
+	.uleb128 .LBB29-.LBB29
+	.uleb128 .LBE29-.LBB29
+	.byte	0x4
+	.uleb128 .LBB36-.LBB29
+	.uleb128 .LBE36-.LBB29
+	.byte	0
+.LLRL20:
+	.byte	0x7
+	.quad	.LFB0
+	.uleb128 .LFE0-.LFB0
+	.byte	0x7
+	.quad	.LFB1
+	.uleb128 .LFE1-.LFB1
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 32 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x4
+	.file 36 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 37 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 38 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 39 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 40 ".//src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF758
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x4
+	.file 41 ".//src/main/drivers/accgyro_adxl345.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 ".//src/main/drivers/accgyro_bma280.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 ".//src/main/drivers/accgyro_l3g4200d.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 ".//src/main/drivers/accgyro_mma845x.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 ".//src/main/drivers/accgyro_mpu3050.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x4
+	.file 46 ".//src/main/drivers/accgyro_l3gd20.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 47 ".//src/main/drivers/accgyro_lsm303dlhc.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 48 ".//src/main/drivers/accgyro_spi_mpu6000.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 49 ".//src/main/drivers/accgyro_spi_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.byte	0x4
+	.file 50 ".//src/main/drivers/barometer_bmp085.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 ".//src/main/drivers/barometer_ms5611.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 ".//src/main/drivers/compass_hmc5883l.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 ".//src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 55 ".//src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 ".//src/main/flight/flight.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF999
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0xd
+	.byte	0x4
+	.file 57 ".//src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1000
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF730
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF749
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.accgyro_l3gd20.h.20.f8af08250ce600dbcea215d8ed57a601,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF762
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.accgyro_lsm303dlhc.h.60.954ef06b8dd3a4bb77543cdbc8a4a6cd,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF957
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.accgyro_spi_mpu6000.h.4.76b8c2f98e7c7faf05d1dc8a8c41705d,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF963
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.accgyro_spi_mpu6500.h.18.9a9a19b583fa1f964359315b33eafebc,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF976
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF980
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF984
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF993
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sensors.h.20.55bdf0ed4707b865ea2c641d55bb0698,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF998
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF818:
+	.string	"LSM303DLHC_INT1_THS_A 0x32"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF998:
+	.string	"CHECKING_BARO_CYCLES 40"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF770:
+	.string	"LSM303DLHC_I2C_SCK_GPIO_PORT GPIOB"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF985:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF921:
+	.string	"LSM303DLHC_INT1INTERRUPT_ENABLE ((uint8_t)0x80)"
+.LASF960:
+	.string	"BITS_DLPF_CFG_188HZ 0x01"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF941:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_2_5Ga 670"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF738:
+	.string	"ACC "
+.LASF1080:
+	.string	"ACC_DEFAULT"
+.LASF1035:
+	.string	"mpu6050Config_s"
+.LASF1039:
+	.string	"mpu6050Config_t"
+.LASF790:
+	.string	"LSM303DLHC_I2C_INT1_EXTI_PORT_SOURCE EXTI_PortSourceGPIOE"
+.LASF762:
+	.string	"L3GD20_CS_GPIO_CLK RCC_AHBPeriph_GPIOE"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF722:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF801:
+	.string	"LSM303DLHC_CTRL_REG2_A 0x21"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1060:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF989:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF997:
+	.string	"CHECKING_GYRO_CYCLES 100"
+.LASF509:
+	.string	"__always_inline"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF772:
+	.string	"LSM303DLHC_I2C_SCK_SOURCE GPIO_PinSource6"
+.LASF485:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1015:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF958:
+	.string	"MPU6000_CONFIG 0x1A"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF775:
+	.string	"LSM303DLHC_I2C_SDA_GPIO_PORT GPIOB"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1014:
+	.string	"int16_t"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1125:
+	.string	"detectGyro"
+.LASF980:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF1110:
+	.string	"sitlAccDetect"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF815:
+	.string	"LSM303DLHC_FIFO_SRC_REG_A 0x2F"
+.LASF1057:
+	.string	"ALIGN_DEFAULT"
+.LASF773:
+	.string	"LSM303DLHC_I2C_SCK_AF GPIO_AF_4"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF743:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF783:
+	.string	"LSM303DLHC_DRDY_EXTI_PORT_SOURCE EXTI_PortSourceGPIOE"
+.LASF974:
+	.string	"MPU6500_RA_INT_ENABLE (0x38)"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF800:
+	.string	"LSM303DLHC_CTRL_REG1_A 0x20"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF737:
+	.string	"USE_GYRO_SITL "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF858:
+	.string	"LSM303DLHC_X_ENABLE ((uint8_t)0x01)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF727:
+	.string	"__enable_irq() "
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF779:
+	.string	"LSM303DLHC_DRDY_PIN GPIO_Pin_2"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1130:
+	.string	"selectMPU6050Config"
+.LASF930:
+	.string	"LSM303DLHC_ODR_75_HZ ((uint8_t) 0x18)"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1101:
+	.string	"GYRO_SPI_MPU6000"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1114:
+	.string	"gyroLpf"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF984:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF1074:
+	.string	"accHardware"
+.LASF1043:
+	.string	"ut_delay"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1032:
+	.string	"revisionCode"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF868:
+	.string	"LSM303DLHC_FULLSCALE_16G ((uint8_t)0x30)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF1098:
+	.string	"GYRO_L3G4200D"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF920:
+	.string	"LSM303DLHC_INT1INTERRUPT_DISABLE ((uint8_t)0x00)"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF719:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1065:
+	.string	"CW270_DEG_FLIP"
+.LASF939:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_3Ga 1100"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1122:
+	.string	"baroHardwareToUse"
+.LASF729:
+	.string	"U_ID_1 0"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF791:
+	.string	"LSM303DLHC_I2C_INT1_EXTI_PIN_SOURCE EXTI_PinSource4"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF830:
+	.string	"LSM303DLHC_CRA_REG_M 0x00"
+.LASF923:
+	.string	"LSM303DLHC_INT1INTERRUPT_HIGH_EDGE ((uint8_t)0x00)"
+.LASF948:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_2_5Ga 600"
+.LASF953:
+	.string	"LSM303DLHC_CONTINUOS_CONVERSION ((uint8_t) 0x00)"
+.LASF952:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_8_1Ga 205"
+.LASF908:
+	.string	"LSM303DLHC_Z_HIGH ((uint8_t)0x20)"
+.LASF1062:
+	.string	"CW0_DEG_FLIP"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF829:
+	.string	"LSM303DLHC_TIME_WINDOW_A 0x3D"
+.LASF840:
+	.string	"LSM303DLHC_IRA_REG_M 0x0A"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF756:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF739:
+	.string	"USE_ACC_SITL "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1042:
+	.string	"baro_t"
+.LASF990:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1066:
+	.string	"sensor_align_e"
+.LASF1012:
+	.string	"long int"
+.LASF1052:
+	.string	"SENSOR_BARO"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF789:
+	.string	"LSM303DLHC_I2C_INT1_EXTI_LINE EXTI_Line4"
+.LASF1067:
+	.string	"sensorAlignmentConfig_s"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF925:
+	.string	"LSM303DLHC_ODR_1_5_HZ ((uint8_t) 0x04)"
+.LASF915:
+	.string	"LSM303DLHC_Z_SINGLE_CLICK ((uint8_t)0x10)"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1107:
+	.string	"magneticDeclination"
+.LASF1093:
+	.string	"BARO_BMP085"
+.LASF996:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF724:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF954:
+	.string	"LSM303DLHC_SINGLE_CONVERSION ((uint8_t) 0x01)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1089:
+	.string	"ACC_NONE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1081:
+	.string	"ACC_ADXL345"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF760:
+	.string	"L3GD20_CS_GPIO GPIOE"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF879:
+	.string	"LSM303DLHC_HPFCF_8 ((uint8_t)0x00)"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF988:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF798:
+	.string	"LSM303DLHC_I2C_INT2_EXTI_PIN_SOURCE EXTI_PinSource5ss"
+.LASF904:
+	.string	"LSM303DLHC_OR_COMBINATION ((uint8_t)0x00)"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1031:
+	.string	"acc_s"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF782:
+	.string	"LSM303DLHC_DRDY_EXTI_LINE EXTI_Line2"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1116:
+	.string	"magDeclinationFromConfig"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1088:
+	.string	"ACC_FAKE"
+.LASF778:
+	.string	"LSM303DLHC_I2C_SDA_AF GPIO_AF_4"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF849:
+	.string	"LSM303DLHC_ODR_1_HZ ((uint8_t)0x10)"
+.LASF945:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_8_1Ga 230"
+.LASF1005:
+	.string	"signed char"
+.LASF767:
+	.string	"LSM303DLHC_I2C I2C1"
+.LASF1016:
+	.string	"uint8_t"
+.LASF967:
+	.string	"MPU6500_RA_BANK_SEL (0x6D)"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1075:
+	.string	"baroHardware"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1026:
+	.string	"scale"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF796:
+	.string	"LSM303DLHC_I2C_INT2_EXTI_LINE EXTI_Line5"
+.LASF932:
+	.string	"LSM303DLHC_FS_1_3_GA ((uint8_t) 0x20)"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1024:
+	.string	"read"
+.LASF1001:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF833:
+	.string	"LSM303DLHC_OUT_X_H_M 0x03"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF922:
+	.string	"LSM303DLHC_INT1INTERRUPT_LOW_EDGE ((uint8_t)0x20)"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF846:
+	.string	"MAG_I2C_ADDRESS 0x3C"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF746:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF982:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF950:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4_7Ga 355"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF718:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF970:
+	.string	"MPU6500_RA_PWR_MGMT_1 (0x6B)"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF742:
+	.string	"USE_USART1 "
+.LASF821:
+	.string	"LSM303DLHC_INT2_SOURCE_A 0x35"
+.LASF831:
+	.string	"LSM303DLHC_CRB_REG_M 0x01"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1086:
+	.string	"ACC_SPI_MPU6000"
+.LASF976:
+	.string	"MPU6500_BIT_RESET (0x80)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF887:
+	.string	"LSM303DLHC_HPF_AOI1_DISABLE ((uint8_t)0x00)"
+.LASF1034:
+	.string	"_Bool"
+.LASF1087:
+	.string	"ACC_SPI_MPU6500"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF715:
+	.string	"NULL"
+.LASF1058:
+	.string	"CW0_DEG"
+.LASF894:
+	.string	"LSM303DLHC_IT1_DRY1 ((uint8_t)0x10)"
+.LASF865:
+	.string	"LSM303DLHC_FULLSCALE_2G ((uint8_t)0x00)"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF732:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1064:
+	.string	"CW180_DEG_FLIP"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1104:
+	.string	"gyro"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1084:
+	.string	"ACC_BMA280"
+.LASF694:
+	.string	"__need_size_t "
+.LASF905:
+	.string	"LSM303DLHC_AND_COMBINATION ((uint8_t)0x80)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF902:
+	.string	"LSM303DLHC_IT2_ACT ((uint8_t)0x08)"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1009:
+	.string	"__uint16_t"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1056:
+	.string	"SENSOR_GPSMAG"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF734:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF803:
+	.string	"LSM303DLHC_CTRL_REG4_A 0x23"
+.LASF781:
+	.string	"LSM303DLHC_DRDY_GPIO_CLK RCC_AHBPeriph_GPIOE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF696:
+	.string	"__size_t__ "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1119:
+	.string	"reconfigureAlignment"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF807:
+	.string	"LSM303DLHC_STATUS_REG_A 0x27"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1094:
+	.string	"BARO_MS5611"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1049:
+	.string	"calculate"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF828:
+	.string	"LSM303DLHC_TIME_LATENCY_A 0x3C"
+.LASF766:
+	.string	"LSM303DLHC_LONG_TIMEOUT ((uint32_t)(10 * LSM303DLHC_FLAG_TIMEOUT))"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF898:
+	.string	"LSM303DLHC_IT2_CLICK ((uint8_t)0x80)"
+.LASF825:
+	.string	"LSM303DLHC_CLICK_SOURCE_A 0x39"
+.LASF900:
+	.string	"LSM303DLHC_IT2_INT2 ((uint8_t)0x20)"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF947:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_9Ga 760"
+.LASF725:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF731:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF951:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_5_6Ga 295"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF940:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_9Ga 855"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF867:
+	.string	"LSM303DLHC_FULLSCALE_8G ((uint8_t)0x20)"
+.LASF714:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF875:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE_RES ((uint8_t)0x00)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF981:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF946:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_3Ga 980"
+.LASF390:
+	.string	"bool _Bool"
+.LASF919:
+	.string	"LSM303DLHC_X_SINGLE_CLICK ((uint8_t)0x01)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1006:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF839:
+	.string	"LSM303DLHC_SR_REG_M 0x09"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF735:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF892:
+	.string	"LSM303DLHC_IT1_AOI1 ((uint8_t)0x40)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1115:
+	.string	"accHardwareToUse"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF926:
+	.string	"LSM303DLHC_ODR_3_0_HZ ((uint8_t) 0x08)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF797:
+	.string	"LSM303DLHC_I2C_INT2_EXTI_PORT_SOURCE EXTI_PortSourceGPIOE"
+.LASF793:
+	.string	"LSM303DLHC_I2C_INT2_PIN GPIO_Pin_5"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF862:
+	.string	"LSM303DLHC_AXES_DISABLE ((uint8_t)0x00)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF851:
+	.string	"LSM303DLHC_ODR_25_HZ ((uint8_t)0x30)"
+.LASF1091:
+	.string	"BARO_DEFAULT"
+.LASF824:
+	.string	"LSM303DLHC_CLICK_CFG_A 0x38"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF1002:
+	.string	"short unsigned int"
+.LASF1083:
+	.string	"ACC_MMA8452"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF961:
+	.string	"BITS_DLPF_CFG_98HZ 0x02"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF935:
+	.string	"LSM303DLHC_FS_4_0_GA ((uint8_t) 0x80)"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF897:
+	.string	"LSM303DLHC_IT1_OVERRUN ((uint8_t)0x02)"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF1097:
+	.string	"GYRO_MPU6050"
+.LASF826:
+	.string	"LSM303DLHC_CLICK_THS_A 0x3A"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF382:
+	.string	"__REVISION__ \"a640789\""
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF827:
+	.string	"LSM303DLHC_TIME_LIMIT_A 0x3B"
+.LASF884:
+	.string	"LSM303DLHC_HIGHPASSFILTER_ENABLE ((uint8_t)0x08)"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF863:
+	.string	"LSM303DLHC_HR_ENABLE ((uint8_t)0x08)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF873:
+	.string	"LSM303DLHC_BOOT_NORMALMODE ((uint8_t)0x00)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF876:
+	.string	"LSM303DLHC_HPM_REF_SIGNAL ((uint8_t)0x40)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF860:
+	.string	"LSM303DLHC_Z_ENABLE ((uint8_t)0x04)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1128:
+	.string	"AccelSensors"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1068:
+	.string	"gyro_align"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1124:
+	.string	"retry"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1022:
+	.string	"sensorReadFuncPtr"
+.LASF956:
+	.string	"LSM303DLHC_TEMPSENSOR_ENABLE ((uint8_t) 0x80)"
+.LASF1048:
+	.string	"get_up"
+.LASF750:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1046:
+	.string	"get_ut"
+.LASF730:
+	.string	"U_ID_2 0"
+.LASF1072:
+	.string	"knownSensors_s"
+.LASF1079:
+	.string	"knownSensors_t"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF816:
+	.string	"LSM303DLHC_INT1_CFG_A 0x30"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF811:
+	.string	"LSM303DLHC_OUT_Y_H_A 0x2B"
+.LASF695:
+	.string	"__need_NULL "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1113:
+	.string	"sensorAlignmentConfig"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF931:
+	.string	"LSM303DLHC_ODR_220_HZ ((uint8_t) 0x1C)"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1070:
+	.string	"mag_align"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF795:
+	.string	"LSM303DLHC_I2C_INT2_GPIO_CLK RCC_AHBPeriph_GPIOE"
+.LASF740:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF861:
+	.string	"LSM303DLHC_AXES_ENABLE ((uint8_t)0x07)"
+.LASF744:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF942:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4Ga 450"
+.LASF933:
+	.string	"LSM303DLHC_FS_1_9_GA ((uint8_t) 0x40)"
+.LASF1061:
+	.string	"CW270_DEG"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1000:
+	.string	"SITL_MOTOR_COUNT 4"
+.LASF962:
+	.string	"BITS_DLPF_CFG_42HZ 0x03"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1118:
+	.string	"sensorsClear"
+.LASF991:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF844:
+	.string	"LSM303DLHC_TEMP_OUT_L_M 0x32"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF973:
+	.string	"MPU6500_RA_RATE_DIV (0x19)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF929:
+	.string	"LSM303DLHC_ODR_30_HZ ((uint8_t) 0x14)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF757:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF871:
+	.string	"LSM303DLHC_BLE_LSB ((uint8_t)0x00)"
+.LASF808:
+	.string	"LSM303DLHC_OUT_X_L_A 0x28"
+.LASF965:
+	.string	"MPU6500_RA_ACCEL_XOUT_H (0x3B)"
+.LASF806:
+	.string	"LSM303DLHC_REFERENCE_A 0x26"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF969:
+	.string	"MPU6500_RA_GYRO_CFG (0x1B)"
+.LASF993:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1011:
+	.string	"__uint32_t"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF837:
+	.string	"LSM303DLHC_OUT_Y_H_M 0x07"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF823:
+	.string	"LSM303DLHC_INT2_DURATION_A 0x37"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF845:
+	.string	"ACC_I2C_ADDRESS 0x32"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF883:
+	.string	"LSM303DLHC_HIGHPASSFILTER_DISABLE ((uint8_t)0x00)"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1050:
+	.string	"SENSOR_GYRO"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF721:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1092:
+	.string	"BARO_NONE"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1111:
+	.string	"sensors"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1023:
+	.string	"init"
+.LASF462:
+	.string	"__PMT"
+.LASF874:
+	.string	"LSM303DLHC_BOOT_REBOOTMEMORY ((uint8_t)0x80)"
+.LASF1117:
+	.string	"knownSensors"
+.LASF955:
+	.string	"LSM303DLHC_SLEEP ((uint8_t) 0x02)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF907:
+	.string	"LSM303DLHC_POS_RECOGNITION ((uint8_t)0xC0)"
+.LASF819:
+	.string	"LSM303DLHC_INT1_DURATION_A 0x33"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF857:
+	.string	"LSM303DLHC_ODR_1344_HZ ((uint8_t)0x90)"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF847:
+	.string	"LSM303DLHC_NORMAL_MODE ((uint8_t)0x00)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF906:
+	.string	"LSM303DLHC_MOV_RECOGNITION ((uint8_t)0x40)"
+.LASF794:
+	.string	"LSM303DLHC_I2C_INT2_GPIO_PORT GPIOE"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF983:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1071:
+	.string	"sensorAlignmentConfig_t"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF975:
+	.string	"MPU6500_WHO_AM_I_CONST (0x70)"
+.LASF358:
+	.string	"__k8 1"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1073:
+	.string	"gyroHardware"
+.LASF913:
+	.string	"LSM303DLHC_X_LOW ((uint8_t)0x01)"
+.LASF1095:
+	.string	"BARO_FAKE"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF909:
+	.string	"LSM303DLHC_Z_LOW ((uint8_t)0x10)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1003:
+	.string	"unsigned int"
+.LASF949:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4Ga 400"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF753:
+	.string	"UNIT_TESTED "
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF891:
+	.string	"LSM303DLHC_IT1_CLICK ((uint8_t)0x80)"
+.LASF764:
+	.string	"LSM303DLHC_FAIL ((uint32_t) 0)"
+.LASF1037:
+	.string	"gpioPin"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF792:
+	.string	"LSM303DLHC_I2C_INT1_EXTI_IRQn EXTI4_IRQn"
+.LASF805:
+	.string	"LSM303DLHC_CTRL_REG6_A 0x25"
+.LASF959:
+	.string	"BITS_DLPF_CFG_256HZ 0x00"
+.LASF1126:
+	.string	"gyroHardwareToUse"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1008:
+	.string	"short int"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF963:
+	.string	"GYRO_SCALE_FACTOR 0.00053292f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF814:
+	.string	"LSM303DLHC_FIFO_CTRL_REG_A 0x2E"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1036:
+	.string	"gpioAPB2Peripherals"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF836:
+	.string	"LSM303DLHC_OUT_Z_L_M 0x06"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF838:
+	.string	"LSM303DLHC_OUT_Y_L_M 0x08"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF872:
+	.string	"LSM303DLHC_BLE_MSB ((uint8_t)0x40)"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF855:
+	.string	"LSM303DLHC_ODR_400_HZ ((uint8_t)0x70)"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF968:
+	.string	"MPU6500_RA_MEM_RW (0x6F)"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF788:
+	.string	"LSM303DLHC_I2C_INT1_GPIO_CLK RCC_AHBPeriph_GPIOE"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1021:
+	.string	"sensorInitFuncPtr"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF748:
+	.string	"PROFILING "
+.LASF878:
+	.string	"LSM303DLHC_HPM_AUTORESET_INT ((uint8_t)0xC0)"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF899:
+	.string	"LSM303DLHC_IT2_INT1 ((uint8_t)0x40)"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF957:
+	.string	"LSM303DLHC_TEMPSENSOR_DISABLE ((uint8_t) 0x00)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF1051:
+	.string	"SENSOR_ACC"
+.LASF786:
+	.string	"LSM303DLHC_I2C_INT1_PIN GPIO_Pin_4"
+.LASF745:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF986:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF978:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF1077:
+	.string	"gyroZero"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1013:
+	.string	"char"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF763:
+	.string	"LSM303DLHC_OK ((uint32_t) 0)"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF1038:
+	.string	"gpioPort"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF901:
+	.string	"LSM303DLHC_IT2_BOOT ((uint8_t)0x10)"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF917:
+	.string	"LSM303DLHC_Y_SINGLE_CLICK ((uint8_t)0x04)"
+.LASF1078:
+	.string	"baroGroundPressure"
+.LASF912:
+	.string	"LSM303DLHC_X_HIGH ((uint8_t)0x02)"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF866:
+	.string	"LSM303DLHC_FULLSCALE_4G ((uint8_t)0x10)"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF841:
+	.string	"LSM303DLHC_IRB_REG_M 0x0B"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF761:
+	.string	"L3GD20_CS_PIN GPIO_Pin_3"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF747:
+	.string	"BLACKBOX "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF736:
+	.string	"GYRO "
+.LASF726:
+	.string	"__disable_irq() "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1029:
+	.string	"gyro_t"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1102:
+	.string	"GYRO_SPI_MPU6500"
+.LASF776:
+	.string	"LSM303DLHC_I2C_SDA_GPIO_CLK RCC_AHBPeriph_GPIOB"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1105:
+	.string	"gyroAlign"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1054:
+	.string	"SENSOR_SONAR"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF885:
+	.string	"LSM303DLHC_HPF_CLICK_DISABLE ((uint8_t)0x00)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1033:
+	.string	"acc_t"
+.LASF889:
+	.string	"LSM303DLHC_HPF_AOI2_DISABLE ((uint8_t)0x00)"
+.LASF890:
+	.string	"LSM303DLHC_HPF_AOI2_ENABLE ((uint8_t)0x02)"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1109:
+	.string	"sitlBaroDetect"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF881:
+	.string	"LSM303DLHC_HPFCF_32 ((uint8_t)0x20)"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1121:
+	.string	"detectBaro"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF870:
+	.string	"LSM303DLHC_BlockUpdate_Single ((uint8_t)0x80)"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF852:
+	.string	"LSM303DLHC_ODR_50_HZ ((uint8_t)0x40)"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF928:
+	.string	"LSM303DLHC_ODR_15_HZ ((uint8_t) 0x10)"
+.LASF1017:
+	.string	"uint16_t"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF877:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE ((uint8_t)0x80)"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1004:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF848:
+	.string	"LSM303DLHC_LOWPOWER_MODE ((uint8_t)0x08)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF777:
+	.string	"LSM303DLHC_I2C_SDA_SOURCE GPIO_PinSource7"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF768:
+	.string	"LSM303DLHC_I2C_CLK RCC_APB1Periph_I2C1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF1030:
+	.string	"gyro_s"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF971:
+	.string	"MPU6500_RA_ACCEL_CFG (0x1C)"
+.LASF758:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF713:
+	.string	"__size_t "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF817:
+	.string	"LSM303DLHC_INT1_SOURCE_A 0x31"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1127:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF966:
+	.string	"MPU6500_RA_GYRO_XOUT_H (0x43)"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF717:
+	.string	"__need_NULL"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF943:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4_7Ga 400"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF765:
+	.string	"LSM303DLHC_FLAG_TIMEOUT ((uint32_t)0x1000)"
+.LASF914:
+	.string	"LSM303DLHC_Z_DOUBLE_CLICK ((uint8_t)0x20)"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1007:
+	.string	"__int16_t"
+.LASF1025:
+	.string	"temperature"
+.LASF934:
+	.string	"LSM303DLHC_FS_2_5_GA ((uint8_t) 0x60)"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF693:
+	.string	"_STRING_H 1"
+.LASF888:
+	.string	"LSM303DLHC_HPF_AOI1_ENABLE ((uint8_t)0x01)"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF880:
+	.string	"LSM303DLHC_HPFCF_16 ((uint8_t)0x10)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF910:
+	.string	"LSM303DLHC_Y_HIGH ((uint8_t)0x08)"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF723:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF977:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF994:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1112:
+	.string	"sitlGyroDetect"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF903:
+	.string	"LSM303DLHC_IT2_HLACTIVE ((uint8_t)0x02)"
+.LASF749:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1027:
+	.string	"samplePeriod"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF769:
+	.string	"LSM303DLHC_I2C_SCK_PIN GPIO_Pin_6"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF834:
+	.string	"LSM303DLHC_OUT_X_L_M 0x04"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF785:
+	.string	"LSM303DLHC_DRDY_EXTI_IRQn EXTI2_TS_IRQn"
+.LASF938:
+	.string	"LSM303DLHC_FS_8_1_GA ((uint8_t) 0xE0)"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF850:
+	.string	"LSM303DLHC_ODR_10_HZ ((uint8_t)0x20)"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF771:
+	.string	"LSM303DLHC_I2C_SCK_GPIO_CLK RCC_AHBPeriph_GPIOB"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF813:
+	.string	"LSM303DLHC_OUT_Z_H_A 0x2D"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF895:
+	.string	"LSM303DLHC_IT1_DRY2 ((uint8_t)0x08)"
+.LASF812:
+	.string	"LSM303DLHC_OUT_Z_L_A 0x2C"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF893:
+	.string	"LSM303DLHC_IT1_AOI2 ((uint8_t)0x20)"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF741:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF842:
+	.string	"LSM303DLHC_IRC_REG_M 0x0C"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1047:
+	.string	"start_up"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1045:
+	.string	"start_ut"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF924:
+	.string	"LSM303DLHC_ODR_0_75_HZ ((uint8_t) 0x00)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF937:
+	.string	"LSM303DLHC_FS_5_6_GA ((uint8_t) 0xC0)"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF754:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF728:
+	.string	"U_ID_0 0x5349544c"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF733:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF787:
+	.string	"LSM303DLHC_I2C_INT1_GPIO_PORT GPIOE"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1055:
+	.string	"SENSOR_GPS"
+.LASF755:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1063:
+	.string	"CW90_DEG_FLIP"
+.LASF1100:
+	.string	"GYRO_L3GD20"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF809:
+	.string	"LSM303DLHC_OUT_X_H_A 0x29"
+.LASF1106:
+	.string	"magAlign"
+.LASF1123:
+	.string	"detectAcc"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1019:
+	.string	"BSRR"
+.LASF856:
+	.string	"LSM303DLHC_ODR_1620_HZ_LP ((uint8_t)0x80)"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF784:
+	.string	"LSM303DLHC_DRDY_EXTI_PIN_SOURCE EXTI_PinSource2"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF964:
+	.string	"MPU6500_RA_WHOAMI (0x75)"
+.LASF911:
+	.string	"LSM303DLHC_Y_LOW ((uint8_t)0x04)"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF751:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1020:
+	.string	"GPIO_TypeDef"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1040:
+	.string	"baroOpFuncPtr"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF820:
+	.string	"LSM303DLHC_INT2_CFG_A 0x34"
+.LASF1069:
+	.string	"acc_align"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF864:
+	.string	"LSM303DLHC_HR_DISABLE ((uint8_t)0x00)"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1099:
+	.string	"GYRO_MPU3050"
+.LASF1082:
+	.string	"ACC_MPU6050"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF835:
+	.string	"LSM303DLHC_OUT_Z_H_M 0x05"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF995:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF822:
+	.string	"LSM303DLHC_INT2_THS_A 0x36"
+.LASF1090:
+	.string	"accAlign"
+.LASF936:
+	.string	"LSM303DLHC_FS_4_7_GA ((uint8_t) 0xA0)"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1085:
+	.string	"ACC_LSM303DLHC"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF927:
+	.string	"LSM303DLHC_ODR_7_5_HZ ((uint8_t) 0x0C)"
+.LASF1044:
+	.string	"up_delay"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF869:
+	.string	"LSM303DLHC_BlockUpdate_Continous ((uint8_t)0x00)"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1018:
+	.string	"uint32_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1103:
+	.string	"GYRO_FAKE"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1108:
+	.string	"baro"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF896:
+	.string	"LSM303DLHC_IT1_WTM ((uint8_t)0x04)"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF992:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF843:
+	.string	"LSM303DLHC_TEMP_OUT_H_M 0x31"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF759:
+	.string	"L3GD20_SPI SPI1"
+.LASF832:
+	.string	"LSM303DLHC_MR_REG_M 0x02"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1028:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF804:
+	.string	"LSM303DLHC_CTRL_REG5_A 0x24"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF802:
+	.string	"LSM303DLHC_CTRL_REG3_A 0x22"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF774:
+	.string	"LSM303DLHC_I2C_SDA_PIN GPIO_Pin_7"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF999:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF780:
+	.string	"LSM303DLHC_DRDY_GPIO_PORT GPIOE"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF918:
+	.string	"LSM303DLHC_X_DOUBLE_CLICK ((uint8_t)0x02)"
+.LASF1010:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF886:
+	.string	"LSM303DLHC_HPF_CLICK_ENABLE ((uint8_t)0x04)"
+.LASF1041:
+	.string	"baroCalculateFuncPtr"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF979:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF916:
+	.string	"LSM303DLHC_Y_DOUBLE_CLICK ((uint8_t)0x08)"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF799:
+	.string	"LSM303DLHC_I2C_INT2_EXTI_IRQn EXTI9_5_IRQn"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF853:
+	.string	"LSM303DLHC_ODR_100_HZ ((uint8_t)0x50)"
+.LASF1129:
+	.string	"sensorsAutodetect"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1120:
+	.string	"updateKnownSensors"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF752:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF972:
+	.string	"MPU6500_RA_LPF (0x1A)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1053:
+	.string	"SENSOR_MAG"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF720:
+	.string	"_STRINGS_H 1"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1076:
+	.string	"calibrated"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF810:
+	.string	"LSM303DLHC_OUT_Y_L_A 0x2A"
+.LASF1059:
+	.string	"CW90_DEG"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1096:
+	.string	"GYRO_DEFAULT"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF854:
+	.string	"LSM303DLHC_ODR_200_HZ ((uint8_t)0x60)"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF944:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_5_6Ga 330"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF859:
+	.string	"LSM303DLHC_Y_ENABLE ((uint8_t)0x02)"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF987:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF882:
+	.string	"LSM303DLHC_HPFCF_64 ((uint8_t)0x30)"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/sensors/initialisation.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
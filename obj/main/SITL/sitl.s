@@ -0,0 +1,15196 @@
+	.file	"sitl.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/target/SITL/sitl.c"
+	.section	.text.rotateBodyToEarth,"ax",@progbits
+	.p2align 4
+	.type	rotateBodyToEarth, @function
+rotateBodyToEarth:
+.LVL0:
+.LFB23:
+	.file 1 ".//src/main/target/SITL/sitl.c"
+	.loc 1 116 1 view -0
+	.cfi_startproc
+	.loc 1 117 5 view .LVU1
+	.loc 1 117 31 is_stmt 0 view .LVU2
+	movss	8(%rdi), %xmm1
+	.loc 1 117 41 view .LVU3
+	movss	12(%rdi), %xmm11
+	.loc 1 117 21 view .LVU4
+	movss	4(%rdi), %xmm9
+	.loc 1 117 11 view .LVU5
+	movss	(%rdi), %xmm7
+.LVL1:
+	.loc 1 119 5 is_stmt 1 view .LVU6
+	.loc 1 119 26 is_stmt 0 view .LVU7
+	movaps	%xmm1, %xmm4
+	.loc 1 119 34 view .LVU8
+	movaps	%xmm11, %xmm6
+	.loc 1 119 26 view .LVU9
+	mulss	%xmm1, %xmm4
+	.loc 1 119 56 view .LVU10
+	movaps	%xmm9, %xmm2
+	.loc 1 119 64 view .LVU11
+	movaps	%xmm7, %xmm10
+	.loc 1 119 34 view .LVU12
+	mulss	%xmm11, %xmm6
+	.loc 1 119 85 view .LVU13
+	movaps	%xmm9, %xmm0
+	.loc 1 119 93 view .LVU14
+	movaps	%xmm7, %xmm8
+	.loc 1 119 56 view .LVU15
+	mulss	%xmm1, %xmm2
+	.loc 1 119 64 view .LVU16
+	mulss	%xmm11, %xmm10
+	.loc 1 119 85 view .LVU17
+	mulss	%xmm11, %xmm0
+	.loc 1 119 93 view .LVU18
+	mulss	%xmm1, %xmm8
+	.loc 1 119 30 view .LVU19
+	movaps	%xmm4, %xmm3
+	addss	%xmm6, %xmm3
+	.loc 1 120 93 view .LVU20
+	mulss	%xmm9, %xmm7
+.LVL2:
+	.loc 1 120 85 view .LVU21
+	mulss	%xmm11, %xmm1
+.LVL3:
+	.loc 1 119 21 view .LVU22
+	addss	%xmm3, %xmm3
+	movaps	%xmm3, %xmm12
+	.loc 1 119 17 view .LVU23
+	movss	.LC0(%rip), %xmm3
+	movaps	%xmm3, %xmm5
+	subss	%xmm12, %xmm5
+	.loc 1 119 40 view .LVU24
+	mulss	(%rsi), %xmm5
+	.loc 1 119 60 view .LVU25
+	movaps	%xmm2, %xmm12
+	subss	%xmm10, %xmm12
+	.loc 1 120 25 view .LVU26
+	addss	%xmm10, %xmm2
+	.loc 1 119 51 view .LVU27
+	addss	%xmm12, %xmm12
+	.loc 1 119 69 view .LVU28
+	mulss	4(%rsi), %xmm12
+	.loc 1 120 16 view .LVU29
+	addss	%xmm2, %xmm2
+	.loc 1 119 47 view .LVU30
+	addss	%xmm12, %xmm5
+	.loc 1 119 89 view .LVU31
+	movaps	%xmm0, %xmm12
+	.loc 1 121 25 view .LVU32
+	subss	%xmm8, %xmm0
+	.loc 1 119 89 view .LVU33
+	addss	%xmm8, %xmm12
+	.loc 1 121 16 view .LVU34
+	addss	%xmm0, %xmm0
+	.loc 1 119 80 view .LVU35
+	addss	%xmm12, %xmm12
+	.loc 1 119 98 view .LVU36
+	mulss	8(%rsi), %xmm12
+	.loc 1 119 76 view .LVU37
+	addss	%xmm12, %xmm5
+	.loc 1 119 12 view .LVU38
+	movss	%xmm5, (%rdx)
+.LVL4:
+	.loc 1 120 5 is_stmt 1 view .LVU39
+	.loc 1 120 34 is_stmt 0 view .LVU40
+	mulss	(%rsi), %xmm2
+	.loc 1 120 55 view .LVU41
+	movaps	%xmm9, %xmm5
+	mulss	%xmm9, %xmm5
+	.loc 1 120 59 view .LVU42
+	addss	%xmm5, %xmm6
+	.loc 1 121 88 view .LVU43
+	addss	%xmm5, %xmm4
+	.loc 1 120 50 view .LVU44
+	addss	%xmm6, %xmm6
+	movaps	%xmm6, %xmm9
+.LVL5:
+	.loc 1 120 46 view .LVU45
+	movaps	%xmm3, %xmm6
+	subss	%xmm9, %xmm6
+	.loc 1 120 69 view .LVU46
+	mulss	4(%rsi), %xmm6
+	.loc 1 120 41 view .LVU47
+	addss	%xmm6, %xmm2
+	.loc 1 120 89 view .LVU48
+	movaps	%xmm1, %xmm6
+	.loc 1 121 54 view .LVU49
+	addss	%xmm7, %xmm1
+	.loc 1 120 89 view .LVU50
+	subss	%xmm7, %xmm6
+	.loc 1 121 45 view .LVU51
+	addss	%xmm1, %xmm1
+	.loc 1 120 80 view .LVU52
+	addss	%xmm6, %xmm6
+	.loc 1 120 98 view .LVU53
+	mulss	8(%rsi), %xmm6
+	.loc 1 120 76 view .LVU54
+	addss	%xmm6, %xmm2
+	.loc 1 120 12 view .LVU55
+	movss	%xmm2, 4(%rdx)
+	.loc 1 121 5 is_stmt 1 view .LVU56
+	.loc 1 121 63 is_stmt 0 view .LVU57
+	mulss	4(%rsi), %xmm1
+	.loc 1 121 34 view .LVU58
+	mulss	(%rsi), %xmm0
+	.loc 1 121 41 view .LVU59
+	addss	%xmm1, %xmm0
+	.loc 1 121 88 view .LVU60
+	movaps	%xmm4, %xmm1
+	.loc 1 121 79 view .LVU61
+	addss	%xmm4, %xmm1
+	.loc 1 121 75 view .LVU62
+	subss	%xmm1, %xmm3
+	.loc 1 121 98 view .LVU63
+	mulss	8(%rsi), %xmm3
+	.loc 1 121 70 view .LVU64
+	addss	%xmm3, %xmm0
+	.loc 1 121 12 view .LVU65
+	movss	%xmm0, 8(%rdx)
+	.loc 1 122 1 view .LVU66
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	rotateBodyToEarth, .-rotateBodyToEarth
+	.section	.text.sitlGetEulerAngles,"ax",@progbits
+	.p2align 4
+	.globl	sitlGetEulerAngles
+	.type	sitlGetEulerAngles, @function
+sitlGetEulerAngles:
+.LVL6:
+.LFB25:
+	.loc 1 131 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 132 5 view .LVU68
+	.loc 1 131 1 is_stmt 0 view .LVU69
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdx, %rbx
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 132 31 view .LVU70
+	movss	28+sitlState(%rip), %xmm2
+	.loc 1 132 51 view .LVU71
+	movss	32+sitlState(%rip), %xmm3
+	.loc 1 132 11 view .LVU72
+	movss	24+sitlState(%rip), %xmm7
+.LVL7:
+	.loc 1 132 71 view .LVU73
+	movss	36+sitlState(%rip), %xmm4
+.LVL8:
+	.loc 1 133 5 is_stmt 1 view .LVU74
+	.loc 1 135 5 view .LVU75
+	.loc 1 135 60 is_stmt 0 view .LVU76
+	movaps	%xmm3, %xmm5
+	.loc 1 135 52 view .LVU77
+	movaps	%xmm2, %xmm0
+	.loc 1 135 35 view .LVU78
+	movaps	%xmm3, %xmm6
+	.loc 1 135 27 view .LVU79
+	movss	%xmm2, 24(%rsp)
+	.loc 1 135 60 view .LVU80
+	mulss	%xmm3, %xmm5
+	.loc 1 135 27 view .LVU81
+	movss	%xmm7, 8(%rsp)
+	.loc 1 135 52 view .LVU82
+	mulss	%xmm2, %xmm0
+	.loc 1 135 35 view .LVU83
+	movss	%xmm3, 16(%rsp)
+	mulss	%xmm4, %xmm6
+	movss	%xmm4, 12(%rsp)
+	.loc 1 135 56 view .LVU84
+	movss	%xmm5, 28(%rsp)
+	addss	%xmm5, %xmm0
+	.loc 1 135 47 view .LVU85
+	movaps	%xmm0, %xmm1
+	addss	%xmm0, %xmm1
+	.loc 1 135 27 view .LVU86
+	movaps	%xmm7, %xmm0
+	mulss	%xmm2, %xmm0
+	.loc 1 135 31 view .LVU87
+	addss	%xmm6, %xmm0
+	.loc 1 135 13 view .LVU88
+	movss	.LC0(%rip), %xmm6
+	subss	%xmm1, %xmm6
+	addss	%xmm0, %xmm0
+	movaps	%xmm6, %xmm1
+	call	atan2f@PLT
+.LVL9:
+	.loc 1 135 66 view .LVU89
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 136 60 view .LVU90
+	movss	24(%rsp), %xmm2
+	.loc 1 136 52 view .LVU91
+	movss	16(%rsp), %xmm3
+	.loc 1 136 60 view .LVU92
+	movss	12(%rsp), %xmm4
+	movaps	%xmm2, %xmm1
+	movss	%xmm2, 16(%rsp)
+.LVL10:
+	.loc 1 136 60 view .LVU93
+	mulss	%xmm4, %xmm1
+	.loc 1 136 52 view .LVU94
+	movss	%xmm3, 20(%rsp)
+	.loc 1 135 11 view .LVU95
+	movss	%xmm0, (%r12)
+	.loc 1 136 5 is_stmt 1 view .LVU96
+	.loc 1 136 52 is_stmt 0 view .LVU97
+	movss	8(%rsp), %xmm0
+	mulss	%xmm3, %xmm0
+	.loc 1 136 56 view .LVU98
+	subss	%xmm1, %xmm0
+	.loc 1 136 14 view .LVU99
+	movss	.LC0(%rip), %xmm1
+	addss	%xmm0, %xmm0
+	call	fminf@PLT
+.LVL11:
+	movss	.LC2(%rip), %xmm1
+	call	fmaxf@PLT
+.LVL12:
+	call	asinf@PLT
+.LVL13:
+	.loc 1 137 59 view .LVU100
+	movss	12(%rsp), %xmm4
+	.loc 1 136 68 view .LVU101
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 137 34 view .LVU102
+	movss	16(%rsp), %xmm2
+	movss	20(%rsp), %xmm3
+	.loc 1 137 59 view .LVU103
+	movaps	%xmm4, %xmm5
+	.loc 1 137 12 view .LVU104
+	movss	.LC0(%rip), %xmm7
+	.loc 1 137 59 view .LVU105
+	mulss	%xmm4, %xmm5
+	.loc 1 137 34 view .LVU106
+	mulss	%xmm3, %xmm2
+	.loc 1 136 12 view .LVU107
+	movss	%xmm0, 0(%rbp)
+	.loc 1 137 5 is_stmt 1 view .LVU108
+	.loc 1 137 59 is_stmt 0 view .LVU109
+	movaps	%xmm5, %xmm0
+	.loc 1 137 55 view .LVU110
+	movss	28(%rsp), %xmm5
+	addss	%xmm5, %xmm0
+	.loc 1 137 46 view .LVU111
+	movaps	%xmm0, %xmm1
+	addss	%xmm0, %xmm1
+	.loc 1 137 26 view .LVU112
+	movss	8(%rsp), %xmm0
+	mulss	%xmm4, %xmm0
+	.loc 1 137 12 view .LVU113
+	subss	%xmm1, %xmm7
+	movaps	%xmm7, %xmm1
+	.loc 1 137 30 view .LVU114
+	addss	%xmm2, %xmm0
+	.loc 1 137 12 view .LVU115
+	addss	%xmm0, %xmm0
+	call	atan2f@PLT
+.LVL14:
+	.loc 1 137 65 view .LVU116
+	mulss	.LC1(%rip), %xmm0
+	.loc 1 137 10 view .LVU117
+	movss	%xmm0, (%rbx)
+	.loc 1 138 1 view .LVU118
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL15:
+	.loc 1 138 1 view .LVU119
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL16:
+	.loc 1 138 1 view .LVU120
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 138 1 view .LVU121
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	sitlGetEulerAngles, .-sitlGetEulerAngles
+	.section	.rodata.sitlInit.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"SITL_DURATION"
+.LC4:
+	.string	"SITL_LOG_INTERVAL"
+	.section	.text.sitlInit,"ax",@progbits
+	.p2align 4
+	.globl	sitlInit
+	.type	sitlInit, @function
+sitlInit:
+.LFB29:
+	.loc 1 271 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 272 5 view .LVU123
+	.loc 1 271 1 is_stmt 0 view .LVU124
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 272 5 view .LVU125
+	pxor	%xmm0, %xmm0
+.LBB6:
+.LBB7:
+	.loc 1 108 25 view .LVU126
+	leaq	.LC3(%rip), %rdi
+.LBE7:
+.LBE6:
+	.loc 1 276 22 view .LVU127
+	movq	$0, simulatedUntilUs(%rip)
+	.loc 1 272 5 view .LVU128
+	movups	%xmm0, 16+sitlState(%rip)
+	movups	%xmm0, sitlState(%rip)
+	.loc 1 273 20 view .LVU129
+	movl	$0x3f800000, 24+sitlState(%rip)
+	.loc 1 272 5 view .LVU130
+	movups	%xmm0, 32+sitlState(%rip)
+	movups	%xmm0, 48+sitlState(%rip)
+	movups	%xmm0, 64+sitlState(%rip)
+	.loc 1 273 5 is_stmt 1 view .LVU131
+	.loc 1 274 5 view .LVU132
+	movaps	%xmm0, motorCommand(%rip)
+	.loc 1 276 5 view .LVU133
+	.loc 1 277 5 view .LVU134
+.LVL18:
+.LBB11:
+.LBI6:
+	.loc 1 106 17 view .LVU135
+.LBB8:
+	.loc 1 108 5 view .LVU136
+	.loc 1 108 25 is_stmt 0 view .LVU137
+	call	getenv@PLT
+.LVL19:
+	.loc 1 109 5 is_stmt 1 view .LVU138
+	.loc 1 109 8 is_stmt 0 view .LVU139
+	testq	%rax, %rax
+	je	.L8
+	movq	%rax, %rdi
+	movl	$20000000, %eax
+.LVL20:
+	.loc 1 109 16 view .LVU140
+	cmpb	$0, (%rdi)
+	jne	.L13
+.LVL21:
+.L6:
+	.loc 1 109 16 view .LVU141
+.LBE8:
+.LBE11:
+.LBB12:
+.LBB13:
+	.loc 1 108 25 view .LVU142
+	leaq	.LC4(%rip), %rdi
+.LBE13:
+.LBE12:
+	.loc 1 277 16 view .LVU143
+	movq	%rax, durationUs(%rip)
+	.loc 1 278 5 is_stmt 1 view .LVU144
+.LVL22:
+.LBB17:
+.LBI12:
+	.loc 1 106 17 view .LVU145
+.LBB14:
+	.loc 1 108 5 view .LVU146
+	.loc 1 108 25 is_stmt 0 view .LVU147
+	call	getenv@PLT
+.LVL23:
+	movq	%rax, %rdi
+.LVL24:
+	.loc 1 109 5 is_stmt 1 view .LVU148
+	movl	$100000, %eax
+.LVL25:
+	.loc 1 109 8 is_stmt 0 view .LVU149
+	testq	%rdi, %rdi
+	je	.L7
+	.loc 1 109 16 view .LVU150
+	cmpb	$0, (%rdi)
+	jne	.L14
+.LVL26:
+.L7:
+	.loc 1 109 16 view .LVU151
+.LBE14:
+.LBE17:
+	.loc 1 278 19 view .LVU152
+	movq	%rax, logIntervalUs(%rip)
+	.loc 1 279 5 is_stmt 1 view .LVU153
+	.loc 1 279 17 is_stmt 0 view .LVU154
+	movq	$0, nextLogAtUs(%rip)
+	.loc 1 280 5 is_stmt 1 view .LVU155
+	.loc 1 280 24 is_stmt 0 view .LVU156
+	movq	$0, nextSerialPollAtUs(%rip)
+	.loc 1 281 1 view .LVU157
+	addq	$8, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret
+.LVL27:
+	.p2align 4,,10
+	.p2align 3
+.L14:
+	.cfi_restore_state
+.LBB18:
+.LBB15:
+	.loc 1 112 5 is_stmt 1 view .LVU158
+	.loc 1 112 12 is_stmt 0 view .LVU159
+	movl	$10, %edx
+	xorl	%esi, %esi
+	call	strtoul@PLT
+.LVL28:
+	.loc 1 112 12 view .LVU160
+.LBE15:
+.LBE18:
+	.loc 1 278 70 view .LVU161
+	movl	%eax, %eax
+	imulq	$1000, %rax, %rax
+.LBB19:
+.LBB16:
+	.loc 1 112 12 view .LVU162
+	jmp	.L7
+.LVL29:
+	.p2align 4,,10
+	.p2align 3
+.L13:
+	.loc 1 112 12 view .LVU163
+.LBE16:
+.LBE19:
+.LBB20:
+.LBB9:
+	.loc 1 112 5 is_stmt 1 view .LVU164
+	.loc 1 112 12 is_stmt 0 view .LVU165
+	movl	$10, %edx
+	xorl	%esi, %esi
+	call	strtoul@PLT
+.LVL30:
+	.loc 1 112 12 view .LVU166
+.LBE9:
+.LBE20:
+	.loc 1 277 62 view .LVU167
+	movl	%eax, %eax
+	imulq	$1000000, %rax, %rax
+.LBB21:
+.LBB10:
+	.loc 1 112 12 view .LVU168
+	jmp	.L6
+.LVL31:
+	.p2align 4,,10
+	.p2align 3
+.L8:
+	.loc 1 112 12 view .LVU169
+	movl	$20000000, %eax
+.LVL32:
+	.loc 1 112 12 view .LVU170
+	jmp	.L6
+.LBE10:
+.LBE21:
+	.cfi_endproc
+.LFE29:
+	.size	sitlInit, .-sitlInit
+	.section	.rodata.sitlAdvanceTo.str1.8,"aMS",@progbits,1
+	.align 8
+.LC25:
+	.string	"t=%8.3f armed=%d alt=%7.2f att=%7.1f,%7.1f,%7.1f est=%6.1f,%6.1f motors=%4.2f,%4.2f,%4.2f,%4.2f\n"
+	.align 8
+.LC26:
+	.string	"\nTask list          period/us  max/us  avg/us  total/ms"
+	.section	.rodata.sitlAdvanceTo.str1.1,"aMS",@progbits,1
+.LC27:
+	.string	"%-16s %11u %7u %7u %9u\n"
+	.section	.rodata.sitlAdvanceTo.str1.8
+	.align 8
+.LC28:
+	.string	"\nStage (host)       count  avg/ns  max/ns"
+	.section	.rodata.sitlAdvanceTo.str1.1
+.LC29:
+	.string	"%-16s %8u %7u %7u\n"
+	.section	.text.sitlAdvanceTo,"ax",@progbits
+	.p2align 4
+	.globl	sitlAdvanceTo
+	.type	sitlAdvanceTo, @function
+sitlAdvanceTo:
+.LVL33:
+.LFB30:
+	.loc 1 284 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 285 5 view .LVU172
+	.loc 1 285 35 view .LVU173
+	.loc 1 285 29 is_stmt 0 view .LVU174
+	movq	simulatedUntilUs(%rip), %rax
+	leaq	250(%rax), %r11
+	.loc 1 285 35 view .LVU175
+	cmpq	%r11, %rdi
+	jb	.L50
+	.loc 1 284 1 view .LVU176
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leaq	40+sitlState(%rip), %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leaq	-28(%rbp), %r15
+	subq	$232, %rsp
+	.cfi_def_cfa_offset 288
+	movss	.LC8(%rip), %xmm8
+	leaq	120(%rsp), %rax
+.LBB31:
+.LBB32:
+	.loc 1 227 89 view .LVU177
+	movq	%rdi, 40(%rsp)
+	leaq	88(%rsp), %r13
+	movq	%rax, 32(%rsp)
+	leaq	104(%rsp), %rax
+	leaq	152(%rsp), %r12
+	movq	%rax, 24(%rsp)
+	leaq	136(%rsp), %rax
+	movq	%r12, %rbx
+	leaq	164(%rsp), %r14
+	movq	%rax, 16(%rsp)
+	leaq	176(%rsp), %rax
+	movq	%r13, %r12
+	movq	%r11, %r13
+	movq	%rax, 8(%rsp)
+.LVL34:
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.loc 1 227 89 view .LVU178
+.LBE32:
+.LBE31:
+	.loc 1 286 9 is_stmt 1 view .LVU179
+.LBB35:
+.LBI35:
+	.loc 1 140 13 view .LVU180
+.LBB36:
+	.loc 1 142 5 view .LVU181
+	.loc 1 143 5 view .LVU182
+	.loc 1 144 5 view .LVU183
+	.loc 1 145 5 view .LVU184
+	.loc 1 146 5 view .LVU185
+	.loc 1 148 5 view .LVU186
+	.loc 1 148 19 view .LVU187
+	leaq	sitlState(%rip), %rax
+.LBE36:
+.LBE35:
+	.loc 1 284 1 is_stmt 0 view .LVU188
+	pxor	%xmm3, %xmm3
+	xorps	%xmm0, %xmm0
+	leaq	motorCommand(%rip), %rdi
+	leaq	motorLayout(%rip), %rsi
+.LBB45:
+.LBB41:
+	.loc 1 143 11 view .LVU189
+	movaps	%xmm3, %xmm2
+.LBE41:
+.LBE45:
+	.loc 1 284 1 view .LVU190
+	movq	%rax, %rdx
+.LVL35:
+.L17:
+.LBB46:
+.LBB42:
+	.loc 1 149 9 is_stmt 1 view .LVU191
+	.loc 1 149 53 is_stmt 0 view .LVU192
+	movss	(%rdi), %xmm1
+	.loc 1 148 19 view .LVU193
+	addq	$4, %rdx
+.LVL36:
+	.loc 1 148 19 view .LVU194
+	addq	$4, %rdi
+	addq	$12, %rsi
+	.loc 1 149 29 view .LVU195
+	movss	60(%rdx), %xmm4
+	.loc 1 150 26 view .LVU196
+	movss	.LC10(%rip), %xmm5
+	.loc 1 149 53 view .LVU197
+	subss	%xmm4, %xmm1
+	.loc 1 149 80 view .LVU198
+	mulss	%xmm8, %xmm1
+	.loc 1 149 85 view .LVU199
+	divss	.LC9(%rip), %xmm1
+	.loc 1 149 33 view .LVU200
+	addss	%xmm4, %xmm1
+	.loc 1 150 26 view .LVU201
+	mulss	%xmm1, %xmm5
+	.loc 1 149 33 view .LVU202
+	movss	%xmm1, 60(%rdx)
+	.loc 1 150 9 is_stmt 1 view .LVU203
+	.loc 1 154 36 is_stmt 0 view .LVU204
+	movq	-12(%rsi), %xmm4
+	.loc 1 156 42 view .LVU205
+	movsbl	-4(%rsi), %ecx
+	.loc 1 150 52 view .LVU206
+	mulss	%xmm1, %xmm5
+	.loc 1 151 9 is_stmt 1 view .LVU207
+	.loc 1 154 39 is_stmt 0 view .LVU208
+	movq	.LC11(%rip), %xmm1
+	mulps	%xmm4, %xmm1
+	.loc 1 154 51 view .LVU209
+	movaps	%xmm5, %xmm4
+	.loc 1 151 21 view .LVU210
+	addss	%xmm5, %xmm2
+.LVL37:
+	.loc 1 154 9 is_stmt 1 view .LVU211
+	.loc 1 154 51 is_stmt 0 view .LVU212
+	shufps	$0xe0, %xmm4, %xmm4
+	mulps	%xmm4, %xmm1
+	.loc 1 154 19 view .LVU213
+	movaps	%xmm0, %xmm4
+	shufps	$0xe1, %xmm1, %xmm1
+	subps	%xmm1, %xmm4
+	.loc 1 155 19 view .LVU214
+	addps	%xmm1, %xmm0
+	.loc 1 156 42 view .LVU215
+	pxor	%xmm1, %xmm1
+	cvtsi2ssl	%ecx, %xmm1
+	mulss	.LC12(%rip), %xmm1
+	.loc 1 148 19 view .LVU216
+	leaq	16+sitlState(%rip), %rcx
+	movss	%xmm4, %xmm0
+	.loc 1 155 9 is_stmt 1 view .LVU217
+	.loc 1 156 9 view .LVU218
+	.loc 1 156 51 is_stmt 0 view .LVU219
+	mulss	%xmm5, %xmm1
+	.loc 1 156 19 view .LVU220
+	subss	%xmm1, %xmm3
+	.loc 1 148 25 is_stmt 1 view .LVU221
+.LVL38:
+	.loc 1 148 19 view .LVU222
+	cmpq	%rcx, %rdx
+	jne	.L17
+	movlps	%xmm0, 88(%rsp)
+	.loc 1 165 35 is_stmt 0 view .LVU223
+	pxor	%xmm7, %xmm7
+	.loc 1 162 17 view .LVU224
+	movq	24(%rsp), %rcx
+	xorl	%edx, %edx
+	.loc 1 163 41 view .LVU225
+	movq	44+sitlState(%rip), %xmm1
+	.loc 1 164 51 view .LVU226
+	movss	40+sitlState(%rip), %xmm0
+	movss	%xmm3, 96(%rsp)
+	.loc 1 160 5 is_stmt 1 view .LVU227
+	.loc 1 163 45 is_stmt 0 view .LVU228
+	movss	48+sitlState(%rip), %xmm4
+	.loc 1 160 17 view .LVU229
+	movq	.LC13(%rip), %rdi
+	movl	$0x3c1ba5e3, 112(%rsp)
+	.loc 1 161 5 is_stmt 1 view .LVU230
+.LVL39:
+	.loc 1 162 5 view .LVU231
+	.loc 1 163 35 is_stmt 0 view .LVU232
+	movq	.LC15(%rip), %xmm3
+	.loc 1 162 17 view .LVU233
+	movq	32(%rsp), %rsi
+	.loc 1 163 45 view .LVU234
+	unpcklps	%xmm0, %xmm4
+	.loc 1 160 17 view .LVU235
+	movq	%rdi, 104(%rsp)
+	.loc 1 163 35 view .LVU236
+	mulps	%xmm1, %xmm3
+	.loc 1 165 35 view .LVU237
+	mulss	%xmm7, %xmm0
+	.loc 1 163 45 view .LVU238
+	mulps	%xmm4, %xmm3
+	.loc 1 165 45 view .LVU239
+	mulss	%xmm1, %xmm0
+	.loc 1 162 17 view .LVU240
+	movlps	%xmm3, 120(%rsp)
+	movss	%xmm0, 128(%rsp)
+	.loc 1 167 5 is_stmt 1 view .LVU241
+.LVL40:
+	.loc 1 167 19 view .LVU242
+.L18:
+	.loc 1 168 9 view .LVU243
+	.loc 1 168 31 is_stmt 0 view .LVU244
+	movss	(%r12,%rdx), %xmm1
+	movss	(%rsi,%rdx), %xmm0
+	.loc 1 168 13 view .LVU245
+	movss	0(%rbp,%rdx), %xmm3
+	.loc 1 168 31 view .LVU246
+	addss	%xmm1, %xmm0
+	.loc 1 168 57 view .LVU247
+	movss	.LC16(%rip), %xmm1
+	mulss	%xmm3, %xmm1
+	.loc 1 168 47 view .LVU248
+	subss	%xmm1, %xmm0
+	.loc 1 168 68 view .LVU249
+	divss	(%rcx,%rdx), %xmm0
+	.loc 1 168 81 view .LVU250
+	mulss	%xmm8, %xmm0
+	.loc 1 168 17 view .LVU251
+	addss	%xmm3, %xmm0
+	movss	%xmm0, 0(%rbp,%rdx)
+	.loc 1 167 25 is_stmt 1 view .LVU252
+.LVL41:
+	.loc 1 167 19 view .LVU253
+	addq	$4, %rdx
+.LVL42:
+	.loc 1 167 19 is_stmt 0 view .LVU254
+	cmpq	$12, %rdx
+	jne	.L18
+	.loc 1 171 5 is_stmt 1 view .LVU255
+.LVL43:
+	.loc 1 172 5 view .LVU256
+	.loc 1 173 19 is_stmt 0 view .LVU257
+	movss	28+sitlState(%rip), %xmm5
+	.loc 1 173 36 view .LVU258
+	movss	32+sitlState(%rip), %xmm7
+	.loc 1 173 29 view .LVU259
+	movss	40+sitlState(%rip), %xmm4
+	.loc 1 173 53 view .LVU260
+	movss	36+sitlState(%rip), %xmm6
+	.loc 1 173 46 view .LVU261
+	movss	44+sitlState(%rip), %xmm9
+	.loc 1 173 17 view .LVU262
+	movaps	%xmm5, %xmm1
+	.loc 1 173 40 view .LVU263
+	movaps	%xmm7, %xmm3
+	.loc 1 173 17 view .LVU264
+	xorps	.LC17(%rip), %xmm1
+	.loc 1 173 63 view .LVU265
+	movss	48+sitlState(%rip), %xmm0
+	.loc 1 174 23 view .LVU266
+	movaps	%xmm4, %xmm11
+	.loc 1 175 40 view .LVU267
+	movaps	%xmm5, %xmm12
+	.loc 1 174 19 view .LVU268
+	movss	24+sitlState(%rip), %xmm10
+	.loc 1 178 5 is_stmt 1 view .LVU269
+.LVL44:
+	.loc 1 179 5 view .LVU270
+	.loc 1 179 19 view .LVU271
+	.loc 1 180 9 view .LVU272
+	.loc 1 173 23 is_stmt 0 view .LVU273
+	mulss	%xmm4, %xmm1
+	.loc 1 173 40 view .LVU274
+	mulss	%xmm9, %xmm3
+	.loc 1 174 23 view .LVU275
+	mulss	%xmm10, %xmm11
+	.loc 1 175 40 view .LVU276
+	mulss	%xmm0, %xmm12
+	.loc 1 176 40 view .LVU277
+	mulss	%xmm9, %xmm5
+	.loc 1 173 33 view .LVU278
+	subss	%xmm3, %xmm1
+	.loc 1 173 57 view .LVU279
+	movaps	%xmm6, %xmm3
+	mulss	%xmm0, %xmm3
+	.loc 1 173 50 view .LVU280
+	subss	%xmm3, %xmm1
+	.loc 1 174 40 view .LVU281
+	movaps	%xmm7, %xmm3
+	mulss	%xmm0, %xmm3
+	.loc 1 176 23 view .LVU282
+	mulss	%xmm10, %xmm0
+	.loc 1 174 33 view .LVU283
+	addss	%xmm3, %xmm11
+	.loc 1 174 57 view .LVU284
+	movaps	%xmm9, %xmm3
+	mulss	%xmm6, %xmm3
+	.loc 1 176 33 view .LVU285
+	addss	%xmm5, %xmm0
+	.loc 1 175 57 view .LVU286
+	mulss	%xmm4, %xmm6
+	.loc 1 176 57 view .LVU287
+	mulss	%xmm7, %xmm4
+	.loc 1 180 14 view .LVU288
+	movups	24+sitlState(%rip), %xmm7
+	.loc 1 174 50 view .LVU289
+	subss	%xmm3, %xmm11
+	.loc 1 175 23 view .LVU290
+	movaps	%xmm9, %xmm3
+	mulss	%xmm10, %xmm3
+	.loc 1 176 50 view .LVU291
+	subss	%xmm4, %xmm0
+	.loc 1 173 14 view .LVU292
+	unpcklps	%xmm11, %xmm1
+	.loc 1 175 33 view .LVU293
+	subss	%xmm12, %xmm3
+	.loc 1 175 50 view .LVU294
+	addss	%xmm6, %xmm3
+	pxor	%xmm6, %xmm6
+	.loc 1 173 14 view .LVU295
+	unpcklps	%xmm0, %xmm3
+	movlhps	%xmm3, %xmm1
+	mulps	.LC18(%rip), %xmm1
+	.loc 1 180 23 view .LVU296
+	mulps	.LC20(%rip), %xmm1
+	.loc 1 180 14 view .LVU297
+	addps	%xmm7, %xmm1
+	.loc 1 181 9 is_stmt 1 view .LVU298
+	.loc 1 181 22 is_stmt 0 view .LVU299
+	movaps	%xmm1, %xmm3
+	mulps	%xmm1, %xmm3
+	movaps	%xmm3, %xmm0
+	movaps	%xmm3, %xmm4
+	addss	%xmm6, %xmm0
+	shufps	$85, %xmm3, %xmm4
+	addss	%xmm0, %xmm4
+	movaps	%xmm3, %xmm0
+	unpckhps	%xmm3, %xmm0
+	.loc 1 181 14 view .LVU300
+	shufps	$255, %xmm3, %xmm3
+	addss	%xmm4, %xmm0
+	addss	%xmm3, %xmm0
+.LVL45:
+	.loc 1 179 25 is_stmt 1 view .LVU301
+	.loc 1 179 19 view .LVU302
+	.loc 1 183 5 view .LVU303
+	ucomiss	%xmm0, %xmm6
+	ja	.L48
+	.loc 1 183 19 is_stmt 0 view .LVU304
+	sqrtss	%xmm0, %xmm0
+.LVL46:
+.L21:
+	.loc 1 189 40 view .LVU305
+	xorps	.LC17(%rip), %xmm2
+	.loc 1 191 5 view .LVU306
+	movq	16(%rsp), %rsi
+	movq	%rbx, %rdx
+	leaq	24+sitlState(%rip), %rdi
+.LVL47:
+	.loc 1 183 10 view .LVU307
+	movss	.LC0(%rip), %xmm13
+	.loc 1 189 17 view .LVU308
+	movq	$0, 136(%rsp)
+	movss	%xmm2, 144(%rsp)
+	.loc 1 183 10 view .LVU309
+	divss	%xmm0, %xmm13
+.LVL48:
+	.loc 1 184 5 is_stmt 1 view .LVU310
+	.loc 1 184 19 view .LVU311
+	.loc 1 185 9 view .LVU312
+	.loc 1 185 14 is_stmt 0 view .LVU313
+	movaps	%xmm13, %xmm0
+	shufps	$0, %xmm0, %xmm0
+	mulps	%xmm1, %xmm0
+	movaps	%xmm0, %xmm13
+.LVL49:
+	.loc 1 185 14 view .LVU314
+	movups	%xmm0, 24+sitlState(%rip)
+	.loc 1 184 25 is_stmt 1 view .LVU315
+	.loc 1 184 19 view .LVU316
+	.loc 1 189 5 view .LVU317
+	.loc 1 190 5 view .LVU318
+	.loc 1 191 5 view .LVU319
+	call	rotateBodyToEarth
+.LVL50:
+	.loc 1 193 5 view .LVU320
+	.loc 1 194 5 view .LVU321
+	.loc 1 194 19 view .LVU322
+	.loc 1 191 5 is_stmt 0 view .LVU323
+	xorl	%edx, %edx
+	movss	.LC8(%rip), %xmm8
+.LVL51:
+.L22:
+	.loc 1 195 9 is_stmt 1 view .LVU324
+	.loc 1 195 55 is_stmt 0 view .LVU325
+	movss	.LC21(%rip), %xmm1
+	mulss	(%r15,%rdx), %xmm1
+	.loc 1 195 80 view .LVU326
+	movss	(%rbx,%rdx), %xmm0
+	subss	%xmm1, %xmm0
+	.loc 1 195 30 view .LVU327
+	movss	%xmm0, (%r14,%rdx)
+	.loc 1 194 25 is_stmt 1 view .LVU328
+.LVL52:
+	.loc 1 194 19 view .LVU329
+	addq	$4, %rdx
+.LVL53:
+	.loc 1 194 19 is_stmt 0 view .LVU330
+	cmpq	$12, %rdx
+	jne	.L22
+	.loc 1 197 5 is_stmt 1 view .LVU331
+	.loc 1 197 26 is_stmt 0 view .LVU332
+	movss	.LC22(%rip), %xmm1
+	movq	%r14, %rdx
+.LVL54:
+	.loc 1 197 26 view .LVU333
+	addss	172(%rsp), %xmm1
+	movss	%xmm1, 172(%rsp)
+	.loc 1 199 5 is_stmt 1 view .LVU334
+.LVL55:
+	.loc 1 199 19 view .LVU335
+.L23:
+	.loc 1 200 9 view .LVU336
+	.loc 1 200 55 is_stmt 0 view .LVU337
+	movss	(%rdx), %xmm0
+	.loc 1 199 19 view .LVU338
+	addq	$4, %rax
+.LVL56:
+	.loc 1 199 19 view .LVU339
+	addq	$4, %rdx
+	.loc 1 200 55 view .LVU340
+	mulss	%xmm8, %xmm0
+	.loc 1 200 31 view .LVU341
+	addss	8(%rax), %xmm0
+	movss	%xmm0, 8(%rax)
+	.loc 1 201 9 is_stmt 1 view .LVU342
+	.loc 1 201 56 is_stmt 0 view .LVU343
+	mulss	%xmm8, %xmm0
+	.loc 1 201 31 view .LVU344
+	addss	-4(%rax), %xmm0
+	movss	%xmm0, -4(%rax)
+	.loc 1 199 25 is_stmt 1 view .LVU345
+.LVL57:
+	.loc 1 199 19 view .LVU346
+	cmpq	%rax, %r15
+	jne	.L23
+	.loc 1 205 5 view .LVU347
+	.loc 1 205 8 is_stmt 0 view .LVU348
+	movss	8+sitlState(%rip), %xmm0
+	pxor	%xmm6, %xmm6
+	comiss	%xmm6, %xmm0
+	jnb	.L24
+	.loc 1 213 26 view .LVU349
+	subss	.LC22(%rip), %xmm1
+.L25:
+	.loc 1 213 5 is_stmt 1 view .LVU350
+.LBB37:
+.LBB38:
+	.loc 1 126 40 is_stmt 0 view .LVU351
+	movaps	%xmm13, %xmm0
+	.loc 1 127 5 view .LVU352
+	movq	8(%rsp), %rdi
+.LVL58:
+	.loc 1 127 5 view .LVU353
+	movq	%r14, %rsi
+.LBE38:
+.LBE37:
+	.loc 1 213 26 view .LVU354
+	movss	%xmm1, 172(%rsp)
+	.loc 1 214 5 is_stmt 1 view .LVU355
+.LVL59:
+.LBB40:
+.LBI37:
+	.loc 1 124 13 view .LVU356
+.LBB39:
+	.loc 1 126 5 view .LVU357
+	.loc 1 126 40 is_stmt 0 view .LVU358
+	shufps	$85, %xmm13, %xmm0
+	movaps	%xmm0, %xmm3
+	.loc 1 126 47 view .LVU359
+	movaps	%xmm13, %xmm0
+	.loc 1 126 40 view .LVU360
+	xorps	.LC17(%rip), %xmm3
+	.loc 1 126 47 view .LVU361
+	unpckhps	%xmm13, %xmm0
+	.loc 1 127 5 view .LVU362
+	leaq	52+sitlState(%rip), %rdx
+.LVL60:
+	.loc 1 126 47 view .LVU363
+	movaps	%xmm0, %xmm1
+	.loc 1 126 54 view .LVU364
+	movaps	%xmm13, %xmm0
+	.loc 1 126 47 view .LVU365
+	xorps	.LC17(%rip), %xmm1
+	.loc 1 126 54 view .LVU366
+	shufps	$255, %xmm13, %xmm0
+	xorps	.LC17(%rip), %xmm0
+	.loc 1 126 17 view .LVU367
+	unpcklps	%xmm0, %xmm1
+	movaps	%xmm13, %xmm0
+	unpcklps	%xmm3, %xmm0
+	movlhps	%xmm1, %xmm0
+	movaps	%xmm0, 176(%rsp)
+	.loc 1 127 5 is_stmt 1 view .LVU368
+	call	rotateBodyToEarth
+.LVL61:
+	.loc 1 127 5 is_stmt 0 view .LVU369
+.LBE39:
+.LBE40:
+.LBE42:
+.LBE46:
+	.loc 1 287 9 is_stmt 1 view .LVU370
+	.loc 1 289 12 is_stmt 0 view .LVU371
+	cmpq	nextSerialPollAtUs(%rip), %r13
+	.loc 1 287 26 view .LVU372
+	movq	%r13, simulatedUntilUs(%rip)
+	.loc 1 289 9 is_stmt 1 view .LVU373
+	.loc 1 289 12 is_stmt 0 view .LVU374
+	movss	.LC8(%rip), %xmm8
+	jnb	.L53
+.L26:
+	.loc 1 294 9 is_stmt 1 view .LVU375
+	.loc 1 294 12 is_stmt 0 view .LVU376
+	cmpq	$0, logIntervalUs(%rip)
+	je	.L27
+	.loc 1 294 27 discriminator 1 view .LVU377
+	cmpq	nextLogAtUs(%rip), %r13
+	jnb	.L54
+.L27:
+	.loc 1 299 9 is_stmt 1 view .LVU378
+	.loc 1 299 13 is_stmt 0 view .LVU379
+	movq	durationUs(%rip), %rax
+	.loc 1 299 12 view .LVU380
+	testq	%rax, %rax
+	je	.L30
+	.loc 1 299 24 discriminator 1 view .LVU381
+	cmpq	%rax, %r13
+	jnb	.L55
+.L30:
+	.loc 1 285 35 is_stmt 1 view .LVU382
+	.loc 1 285 29 is_stmt 0 view .LVU383
+	addq	$250, %r13
+	.loc 1 285 35 view .LVU384
+	cmpq	%r13, 40(%rsp)
+	jnb	.L16
+	.loc 1 305 1 view .LVU385
+	addq	$232, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL62:
+	.loc 1 305 1 view .LVU386
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L24:
+	.cfi_restore_state
+.LBB47:
+.LBB43:
+	.loc 1 206 9 is_stmt 1 view .LVU387
+	.loc 1 206 31 is_stmt 0 view .LVU388
+	movl	$0x00000000, 8+sitlState(%rip)
+	.loc 1 207 9 is_stmt 1 view .LVU389
+	.loc 1 209 9 is_stmt 0 view .LVU390
+	movss	.LC7(%rip), %xmm1
+	.loc 1 207 9 view .LVU391
+	movq	$0, 12+sitlState(%rip)
+	movl	$0, 20+sitlState(%rip)
+	.loc 1 208 9 is_stmt 1 view .LVU392
+	movq	$0, 40+sitlState(%rip)
+	movl	$0, 48+sitlState(%rip)
+	.loc 1 209 9 view .LVU393
+	movq	$0, (%r14)
+	jmp	.L25
+.LVL64:
+	.p2align 4,,10
+	.p2align 3
+.L53:
+	.loc 1 209 9 is_stmt 0 view .LVU394
+.LBE43:
+.LBE47:
+	.loc 1 290 13 is_stmt 1 view .LVU395
+	call	sitlSerialPoll@PLT
+.LVL65:
+	.loc 1 291 13 view .LVU396
+	.loc 1 291 51 is_stmt 0 view .LVU397
+	movq	simulatedUntilUs(%rip), %r13
+	movss	.LC8(%rip), %xmm8
+	leaq	1000(%r13), %rax
+	movq	%rax, nextSerialPollAtUs(%rip)
+	jmp	.L26
+	.p2align 4,,10
+	.p2align 3
+.L54:
+	.loc 1 295 13 is_stmt 1 view .LVU398
+.LVL66:
+.LBB48:
+.LBI31:
+	.loc 1 217 13 view .LVU399
+.LBB33:
+	.loc 1 219 5 view .LVU400
+	.loc 1 220 5 view .LVU401
+	movq	8(%rsp), %rdx
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	sitlGetEulerAngles
+.LVL67:
+	.loc 1 222 5 view .LVU402
+	.loc 1 227 89 is_stmt 0 view .LVU403
+	movswl	2+inclination(%rip), %eax
+	.loc 1 224 35 view .LVU404
+	movzbl	armingFlags(%rip), %esi
+	.loc 1 227 89 view .LVU405
+	pxor	%xmm6, %xmm6
+	.loc 1 225 14 view .LVU406
+	pxor	%xmm1, %xmm1
+	subss	8+sitlState(%rip), %xmm1
+	.loc 1 222 5 view .LVU407
+	pxor	%xmm7, %xmm7
+	.loc 1 227 89 view .LVU408
+	cvtsi2ssl	%eax, %xmm6
+	.loc 1 227 44 view .LVU409
+	pxor	%xmm5, %xmm5
+	.loc 1 222 5 view .LVU410
+	pxor	%xmm4, %xmm4
+	.loc 1 224 35 view .LVU411
+	sarl	$2, %esi
+	.loc 1 227 44 view .LVU412
+	movswl	inclination(%rip), %eax
+	.loc 1 222 5 view .LVU413
+	pxor	%xmm3, %xmm3
+	pxor	%xmm2, %xmm2
+	.loc 1 227 89 view .LVU414
+	divss	.LC23(%rip), %xmm6
+	.loc 1 222 5 view .LVU415
+	andl	$1, %esi
+	cvtss2sd	%xmm6, %xmm6
+	cvtss2sd	64+sitlState(%rip), %xmm7
+	cvtss2sd	176(%rsp), %xmm4
+	.loc 1 227 44 view .LVU416
+	cvtsi2ssl	%eax, %xmm5
+	.loc 1 222 5 view .LVU417
+	cvtss2sd	%xmm1, %xmm1
+	.loc 1 227 44 view .LVU418
+	divss	.LC23(%rip), %xmm5
+	.loc 1 222 5 view .LVU419
+	cvtss2sd	164(%rsp), %xmm3
+	cvtss2sd	152(%rsp), %xmm2
+	cvtss2sd	%xmm5, %xmm5
+	testq	%r13, %r13
+	js	.L28
+	pxor	%xmm0, %xmm0
+	cvtsi2sdq	%r13, %xmm0
+.L29:
+	subq	$32, %rsp
+	.cfi_def_cfa_offset 320
+	pxor	%xmm9, %xmm9
+	leaq	.LC25(%rip), %rdi
+	movl	$8, %eax
+	cvtss2sd	76+sitlState(%rip), %xmm9
+	movsd	%xmm9, 16(%rsp)
+	pxor	%xmm9, %xmm9
+	divsd	.LC24(%rip), %xmm0
+	cvtss2sd	72+sitlState(%rip), %xmm9
+	movsd	%xmm9, 8(%rsp)
+	pxor	%xmm9, %xmm9
+	cvtss2sd	68+sitlState(%rip), %xmm9
+	movsd	%xmm9, (%rsp)
+	call	printf@PLT
+.LVL68:
+	.loc 1 222 5 view .LVU420
+.LBE33:
+.LBE48:
+	.loc 1 296 13 is_stmt 1 view .LVU421
+	.loc 1 296 44 is_stmt 0 view .LVU422
+	movq	simulatedUntilUs(%rip), %r13
+	movq	logIntervalUs(%rip), %rax
+	.loc 1 296 25 view .LVU423
+	addq	$32, %rsp
+	.cfi_def_cfa_offset 288
+	movss	.LC8(%rip), %xmm8
+	.loc 1 296 44 view .LVU424
+	addq	%r13, %rax
+	.loc 1 296 25 view .LVU425
+	movq	%rax, nextLogAtUs(%rip)
+	jmp	.L27
+.LVL69:
+	.p2align 4,,10
+	.p2align 3
+.L28:
+.LBB49:
+.LBB34:
+	.loc 1 222 5 view .LVU426
+	movq	%r13, %rax
+	movq	%r13, %r11
+	pxor	%xmm0, %xmm0
+	shrq	%rax
+	andl	$1, %r11d
+	orq	%r11, %rax
+	cvtsi2sdq	%rax, %xmm0
+	addsd	%xmm0, %xmm0
+	jmp	.L29
+.LVL70:
+.L55:
+	.loc 1 222 5 view .LVU427
+.LBE34:
+.LBE49:
+	.loc 1 300 13 is_stmt 1 view .LVU428
+.LBB50:
+.LBI50:
+	.loc 1 232 13 view .LVU429
+.LBB51:
+	.loc 1 234 5 view .LVU430
+	.loc 1 235 5 view .LVU431
+	.loc 1 237 5 view .LVU432
+	leaq	.LC26(%rip), %rdi
+	.loc 1 238 17 is_stmt 0 view .LVU433
+	xorl	%ebx, %ebx
+	.loc 1 243 9 view .LVU434
+	leaq	.LC27(%rip), %rbp
+.LVL71:
+	.loc 1 237 5 view .LVU435
+	call	puts@PLT
+.LVL72:
+	.loc 1 238 5 is_stmt 1 view .LVU436
+	.loc 1 238 29 view .LVU437
+	.loc 1 243 9 is_stmt 0 view .LVU438
+	movq	8(%rsp), %r12
+.LVL73:
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 239 9 is_stmt 1 view .LVU439
+	movq	%r12, %rsi
+	movl	%ebx, %edi
+	call	getTaskInfo@PLT
+.LVL74:
+	.loc 1 240 9 view .LVU440
+	.loc 1 240 12 is_stmt 0 view .LVU441
+	cmpb	$0, 184(%rsp)
+	je	.L31
+	.loc 1 243 9 is_stmt 1 view .LVU442
+	movl	196(%rsp), %ecx
+	movl	192(%rsp), %edx
+	movq	%rbp, %rdi
+	xorl	%eax, %eax
+	movl	200(%rsp), %r9d
+	movl	204(%rsp), %r8d
+	movq	176(%rsp), %rsi
+	imulq	$274877907, %r9, %r9
+	shrq	$38, %r9
+	call	printf@PLT
+.LVL75:
+.L31:
+	.loc 1 238 49 view .LVU443
+	addl	$1, %ebx
+.LVL76:
+	.loc 1 238 29 view .LVU444
+	cmpl	$8, %ebx
+	jne	.L32
+	.loc 1 253 5 view .LVU445
+	.loc 1 254 5 view .LVU446
+	leaq	.LC28(%rip), %rdi
+	.loc 1 255 16 is_stmt 0 view .LVU447
+	xorl	%ebx, %ebx
+.LVL77:
+.LBB52:
+	.loc 1 260 9 view .LVU448
+	leaq	.LC29(%rip), %r12
+.LBE52:
+	.loc 1 254 5 view .LVU449
+	call	puts@PLT
+.LVL78:
+	.loc 1 255 5 is_stmt 1 view .LVU450
+	.loc 1 255 27 view .LVU451
+	.p2align 4,,10
+	.p2align 3
+.L34:
+.LBB53:
+	.loc 1 256 9 view .LVU452
+	.loc 1 256 44 is_stmt 0 view .LVU453
+	movl	%ebx, %edi
+	call	getProfileStageStats@PLT
+.LVL79:
+	movq	%rax, %rbp
+.LVL80:
+	.loc 1 257 9 is_stmt 1 view .LVU454
+	.loc 1 257 12 is_stmt 0 view .LVU455
+	movl	4(%rax), %eax
+.LVL81:
+	.loc 1 257 12 view .LVU456
+	testl	%eax, %eax
+	je	.L33
+	.loc 1 260 9 is_stmt 1 view .LVU457
+	movl	%ebx, %edi
+	.loc 1 264 18 is_stmt 0 view .LVU458
+	movl	12(%rbp), %r14d
+	.loc 1 260 9 view .LVU459
+	call	getProfileStageAverageCycles@PLT
+.LVL82:
+	.loc 1 262 18 view .LVU460
+	movl	4(%rbp), %ebp
+.LVL83:
+	.loc 1 260 9 view .LVU461
+	movl	%ebx, %edi
+	movl	%eax, %r13d
+	call	getProfileStageName@PLT
+.LVL84:
+	movl	%r14d, %r8d
+	movl	%r13d, %ecx
+	movl	%ebp, %edx
+	movq	%rax, %rsi
+	movq	%r12, %rdi
+	xorl	%eax, %eax
+	call	printf@PLT
+.LVL85:
+.L33:
+.LBE53:
+	.loc 1 255 55 is_stmt 1 view .LVU462
+	addl	$1, %ebx
+.LVL86:
+	.loc 1 255 27 view .LVU463
+	cmpl	$9, %ebx
+	jne	.L34
+.LVL87:
+	.loc 1 255 27 is_stmt 0 view .LVU464
+.LBE51:
+.LBE50:
+	.loc 1 301 13 is_stmt 1 view .LVU465
+	movq	stdout(%rip), %rdi
+	call	fflush@PLT
+.LVL88:
+	.loc 1 302 13 view .LVU466
+	xorl	%edi, %edi
+	call	exit@PLT
+.LVL89:
+.L50:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 302 13 is_stmt 0 view .LVU467
+	ret
+.LVL90:
+.L48:
+	.cfi_def_cfa_offset 288
+	.cfi_offset 3, -56
+	.cfi_offset 6, -48
+	.cfi_offset 12, -40
+	.cfi_offset 13, -32
+	.cfi_offset 14, -24
+	.cfi_offset 15, -16
+	.loc 1 302 13 view .LVU468
+	movq	%rax, 56(%rsp)
+	movaps	%xmm1, 64(%rsp)
+	movss	%xmm2, 52(%rsp)
+.LBB54:
+.LBB44:
+	.loc 1 183 19 view .LVU469
+	call	sqrtf@PLT
+.LVL91:
+	.loc 1 183 19 view .LVU470
+	movaps	64(%rsp), %xmm1
+	movq	56(%rsp), %rax
+	movss	52(%rsp), %xmm2
+	jmp	.L21
+.LBE44:
+.LBE54:
+	.cfi_endproc
+.LFE30:
+	.size	sitlAdvanceTo, .-sitlAdvanceTo
+	.section	.text.sitlSetMotor,"ax",@progbits
+	.p2align 4
+	.globl	sitlSetMotor
+	.type	sitlSetMotor, @function
+sitlSetMotor:
+.LVL92:
+.LFB31:
+	.loc 1 308 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 309 5 view .LVU472
+	.loc 1 309 8 is_stmt 0 view .LVU473
+	cmpb	$3, %dil
+	ja	.L59
+	.loc 1 308 1 view .LVU474
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 313 27 view .LVU475
+	movss	.LC0(%rip), %xmm1
+	.loc 1 312 28 view .LVU476
+	movzwl	%si, %esi
+	.loc 1 312 36 view .LVU477
+	pxor	%xmm0, %xmm0
+	.loc 1 312 28 view .LVU478
+	subl	$1000, %esi
+.LVL93:
+	.loc 1 312 28 view .LVU479
+	movl	%edi, %ebx
+	.loc 1 312 5 is_stmt 1 view .LVU480
+	.loc 1 313 5 view .LVU481
+	.loc 1 312 36 is_stmt 0 view .LVU482
+	cvtsi2ssl	%esi, %xmm0
+	.loc 1 312 11 view .LVU483
+	divss	.LC30(%rip), %xmm0
+	.loc 1 313 25 view .LVU484
+	movzbl	%bl, %ebx
+	.loc 1 313 27 view .LVU485
+	call	fminf@PLT
+.LVL94:
+	.loc 1 313 27 view .LVU486
+	pxor	%xmm1, %xmm1
+	call	fmaxf@PLT
+.LVL95:
+	.loc 1 313 25 view .LVU487
+	leaq	motorCommand(%rip), %rax
+	movss	%xmm0, (%rax,%rbx,4)
+	.loc 1 314 1 view .LVU488
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+.LVL96:
+	.p2align 4,,10
+	.p2align 3
+.L59:
+	.cfi_restore 3
+	.loc 1 314 1 view .LVU489
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	sitlSetMotor, .-sitlSetMotor
+	.section	.text.sitlGetRcChannel,"ax",@progbits
+	.p2align 4
+	.globl	sitlGetRcChannel
+	.type	sitlGetRcChannel, @function
+sitlGetRcChannel:
+.LVL97:
+.LFB32:
+	.loc 1 317 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 318 5 view .LVU491
+	.loc 1 319 5 view .LVU492
+	.loc 1 319 39 is_stmt 0 view .LVU493
+	movq	simulatedUntilUs(%rip), %rdx
+	movabsq	$2361183241434822607, %rax
+	shrq	$3, %rdx
+	mulq	%rdx
+	.loc 1 318 25 view .LVU494
+	leaq	rcScript(%rip), %rax
+	.loc 1 322 62 view .LVU495
+	leaq	144(%rax), %rcx
+	.loc 1 319 39 view .LVU496
+	shrq	$4, %rdx
+.LVL98:
+	.loc 1 320 5 is_stmt 1 view .LVU497
+	.loc 1 322 5 view .LVU498
+	.loc 1 322 62 view .LVU499
+	.p2align 4,,10
+	.p2align 3
+.L63:
+	.loc 1 322 62 is_stmt 0 discriminator 3 view .LVU500
+	cmpl	12(%rax), %edx
+	jb	.L64
+	.loc 1 323 9 is_stmt 1 discriminator 4 view .LVU501
+	.loc 1 323 14 is_stmt 0 discriminator 4 view .LVU502
+	addq	$12, %rax
+.LVL99:
+	.loc 1 322 93 is_stmt 1 discriminator 4 view .LVU503
+	.loc 1 322 62 discriminator 4 view .LVU504
+	cmpq	%rcx, %rax
+	jne	.L63
+.LVL100:
+.L64:
+	.loc 1 326 5 view .LVU505
+	cmpb	$2, %dil
+	je	.L66
+	ja	.L67
+	testb	%dil, %dil
+	je	.L73
+	.loc 1 330 13 view .LVU506
+	.loc 1 330 24 is_stmt 0 view .LVU507
+	movzwl	6(%rax), %eax
+.LVL101:
+	.loc 1 330 24 view .LVU508
+	ret
+.LVL102:
+	.p2align 4,,10
+	.p2align 3
+.L67:
+	.loc 1 326 5 view .LVU509
+	cmpb	$3, %dil
+	jne	.L74
+	.loc 1 334 13 is_stmt 1 view .LVU510
+	.loc 1 334 24 is_stmt 0 view .LVU511
+	movzwl	10(%rax), %eax
+.LVL103:
+	.loc 1 338 1 view .LVU512
+	ret
+.LVL104:
+	.p2align 4,,10
+	.p2align 3
+.L73:
+	.loc 1 328 13 is_stmt 1 view .LVU513
+	.loc 1 328 24 is_stmt 0 view .LVU514
+	movzwl	4(%rax), %eax
+.LVL105:
+	.loc 1 328 24 view .LVU515
+	ret
+.LVL106:
+	.p2align 4,,10
+	.p2align 3
+.L74:
+	.loc 1 326 5 view .LVU516
+	movl	$1000, %eax
+.LVL107:
+	.loc 1 326 5 view .LVU517
+	ret
+.LVL108:
+	.p2align 4,,10
+	.p2align 3
+.L66:
+	.loc 1 332 13 is_stmt 1 view .LVU518
+	.loc 1 332 24 is_stmt 0 view .LVU519
+	movzwl	8(%rax), %eax
+.LVL109:
+	.loc 1 332 24 view .LVU520
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	sitlGetRcChannel, .-sitlGetRcChannel
+	.section	.bss.nextSerialPollAtUs,"aw",@nobits
+	.align 8
+	.type	nextSerialPollAtUs, @object
+	.size	nextSerialPollAtUs, 8
+nextSerialPollAtUs:
+	.zero	8
+	.section	.bss.nextLogAtUs,"aw",@nobits
+	.align 8
+	.type	nextLogAtUs, @object
+	.size	nextLogAtUs, 8
+nextLogAtUs:
+	.zero	8
+	.section	.bss.logIntervalUs,"aw",@nobits
+	.align 8
+	.type	logIntervalUs, @object
+	.size	logIntervalUs, 8
+logIntervalUs:
+	.zero	8
+	.section	.bss.durationUs,"aw",@nobits
+	.align 8
+	.type	durationUs, @object
+	.size	durationUs, 8
+durationUs:
+	.zero	8
+	.section	.bss.simulatedUntilUs,"aw",@nobits
+	.align 8
+	.type	simulatedUntilUs, @object
+	.size	simulatedUntilUs, 8
+simulatedUntilUs:
+	.zero	8
+	.section	.bss.motorCommand,"aw",@nobits
+	.align 16
+	.type	motorCommand, @object
+	.size	motorCommand, 16
+motorCommand:
+	.zero	16
+	.comm	sitlState,80,32
+	.section	.rodata.rcScript,"a"
+	.align 32
+	.type	rcScript, @object
+	.size	rcScript, 156
+rcScript:
+	.long	0
+	.value	1500
+	.value	1500
+	.value	1000
+	.value	1500
+	.long	8000
+	.value	1500
+	.value	1500
+	.value	1000
+	.value	2000
+	.long	9500
+	.value	1500
+	.value	1500
+	.value	1000
+	.value	1500
+	.long	10000
+	.value	1500
+	.value	1500
+	.value	1700
+	.value	1500
+	.long	11000
+	.value	1500
+	.value	1500
+	.value	1620
+	.value	1500
+	.long	13000
+	.value	1600
+	.value	1500
+	.value	1620
+	.value	1500
+	.long	13300
+	.value	1400
+	.value	1500
+	.value	1620
+	.value	1500
+	.long	13600
+	.value	1500
+	.value	1500
+	.value	1620
+	.value	1500
+	.long	15000
+	.value	1500
+	.value	1600
+	.value	1620
+	.value	1500
+	.long	15300
+	.value	1500
+	.value	1400
+	.value	1620
+	.value	1500
+	.long	15600
+	.value	1500
+	.value	1500
+	.value	1620
+	.value	1500
+	.long	17000
+	.value	1500
+	.value	1500
+	.value	1620
+	.value	1600
+	.long	17500
+	.value	1500
+	.value	1500
+	.value	1620
+	.value	1500
+	.section	.rodata.motorLayout,"a"
+	.align 32
+	.type	motorLayout, @object
+	.size	motorLayout, 48
+motorLayout:
+	.long	-1082130432
+	.long	1065353216
+	.byte	1
+	.zero	3
+	.long	1065353216
+	.long	1065353216
+	.byte	-1
+	.zero	3
+	.long	-1082130432
+	.long	-1082130432
+	.byte	-1
+	.zero	3
+	.long	1065353216
+	.long	-1082130432
+	.byte	1
+	.zero	3
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC0:
+	.long	1065353216
+	.align 4
+.LC1:
+	.long	1113927392
+	.align 4
+.LC2:
+	.long	-1082130432
+	.align 4
+.LC7:
+	.long	-1055070198
+	.set	.LC8,.LC20
+	.align 4
+.LC9:
+	.long	1017370378
+	.align 4
+.LC10:
+	.long	1090519040
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	1039069710
+	.long	1039069710
+	.section	.rodata.cst4
+	.align 4
+.LC12:
+	.long	1015222895
+	.section	.rodata.cst8
+	.align 8
+.LC13:
+	.long	1001666904
+	.long	1001666904
+	.align 8
+.LC15:
+	.long	-1149037970
+	.long	998445678
+	.section	.rodata.cst4
+	.align 4
+.LC16:
+	.long	973279855
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC17:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 16
+.LC18:
+	.long	1056964608
+	.long	1056964608
+	.long	1056964608
+	.long	1056964608
+	.align 16
+.LC20:
+	.long	964891247
+	.long	964891247
+	.long	964891247
+	.long	964891247
+	.section	.rodata.cst4
+	.align 4
+.LC21:
+	.long	1048576000
+	.align 4
+.LC22:
+	.long	1092413450
+	.align 4
+.LC23:
+	.long	1092616192
+	.section	.rodata.cst8
+	.align 8
+.LC24:
+	.long	0
+	.long	1093567616
+	.section	.rodata.cst4
+	.align 4
+.LC30:
+	.long	1148846080
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 ".//src/main/common/axis.h"
+	.file 9 ".//src/main/common/profiling.h"
+	.file 10 ".//src/main/config/runtime_config.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 ".//src/main/flight/flight.h"
+	.file 13 ".//src/main/scheduler/scheduler.h"
+	.file 14 ".//src/main/target/SITL/sitl.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 16 "/usr/include/stdlib.h"
+	.file 17 "/usr/include/string.h"
+	.file 18 "<built-in>"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x13af
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2b
+	.long	.LASF1585
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL43
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1384
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1385
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1386
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1387
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1388
+	.uleb128 0x4
+	.long	.LASF1390
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1389
+	.uleb128 0x4
+	.long	.LASF1391
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x3c
+	.uleb128 0x4
+	.long	.LASF1392
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x7c
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1393
+	.uleb128 0x4
+	.long	.LASF1394
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x43
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1395
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1396
+	.uleb128 0x4
+	.long	.LASF1397
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x4
+	.long	.LASF1398
+	.byte	0x2
+	.byte	0x98
+	.byte	0x12
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF1399
+	.byte	0x2
+	.byte	0x99
+	.byte	0x12
+	.long	0xa2
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0x7
+	.long	0xd4
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1400
+	.uleb128 0x13
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF1401
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF1402
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1403
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1404
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1405
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF1406
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF1407
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x15
+	.long	.LASF1455
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x8
+	.long	0x2bb
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x8f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1411
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xcf
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1412
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xcf
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1413
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcf
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xcf
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1415
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xcf
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1416
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xcf
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1417
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xcf
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1418
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xcf
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1419
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xcf
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1420
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x2d4
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1421
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x2d9
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x8f
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x8f
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0xb5
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x43
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1426
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x5d
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF1427
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2de
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF1428
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x2ee
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF1429
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0xc1
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2f8
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x302
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF1432
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2d9
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0xcd
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF1434
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x128
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF1435
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x8f
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x307
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1437
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x134
+	.uleb128 0x2e
+	.long	.LASF1586
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1e
+	.long	.LASF1438
+	.uleb128 0x7
+	.long	0x2cf
+	.uleb128 0x7
+	.long	0x134
+	.uleb128 0xc
+	.long	0xd4
+	.long	0x2ee
+	.uleb128 0xd
+	.long	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c7
+	.uleb128 0x1e
+	.long	.LASF1439
+	.uleb128 0x7
+	.long	0x2f3
+	.uleb128 0x1e
+	.long	.LASF1440
+	.uleb128 0x7
+	.long	0x2fd
+	.uleb128 0xc
+	.long	0xd4
+	.long	0x317
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x13
+	.byte	0
+	.uleb128 0x7
+	.long	0x2bb
+	.uleb128 0x17
+	.long	.LASF1467
+	.byte	0xb
+	.byte	0x90
+	.byte	0xe
+	.long	0x317
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1441
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1442
+	.uleb128 0x7
+	.long	0xdb
+	.uleb128 0x25
+	.long	0x336
+	.uleb128 0x13
+	.long	0x2e
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1443
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x8
+	.byte	0x14
+	.long	0x364
+	.uleb128 0x1f
+	.string	"X"
+	.byte	0
+	.uleb128 0x1f
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1f
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0x9
+	.byte	0x14
+	.long	0x3ac
+	.uleb128 0x2
+	.long	.LASF1444
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1445
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1446
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1447
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1448
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1450
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1451
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1452
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1453
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1454
+	.byte	0x9
+	.byte	0x1f
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x15
+	.long	.LASF1456
+	.byte	0x30
+	.byte	0x9
+	.byte	0x24
+	.byte	0x10
+	.long	0x414
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0x9
+	.byte	0x25
+	.byte	0xe
+	.long	0x110
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x9
+	.byte	0x26
+	.byte	0xe
+	.long	0x110
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0x9
+	.byte	0x27
+	.byte	0xe
+	.long	0x110
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x9
+	.byte	0x28
+	.byte	0xe
+	.long	0x110
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x9
+	.byte	0x29
+	.byte	0xe
+	.long	0x11c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x9
+	.byte	0x2a
+	.byte	0xe
+	.long	0x414
+	.byte	0x18
+	.byte	0
+	.uleb128 0xc
+	.long	0x104
+	.long	0x424
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1463
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x3
+	.long	0x3b8
+	.uleb128 0x13
+	.long	0x424
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xa
+	.byte	0x15
+	.long	0x453
+	.uleb128 0x2
+	.long	.LASF1464
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1465
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1466
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1468
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x10
+	.long	0xf8
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xc
+	.byte	0x15
+	.long	0x4ad
+	.uleb128 0x2
+	.long	.LASF1469
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1470
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1471
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1472
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1473
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1476
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1477
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1478
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1479
+	.byte	0xa
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e
+	.long	0x4bd
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	0xec
+	.long	0x4cd
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1480
+	.byte	0x4
+	.byte	0xc
+	.byte	0x6c
+	.byte	0x10
+	.long	0x4f5
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0xc
+	.byte	0x6e
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xd
+	.long	0xec
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1483
+	.byte	0xc
+	.byte	0x70
+	.byte	0x3
+	.long	0x4cd
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0xc
+	.byte	0x72
+	.byte	0x9
+	.long	0x523
+	.uleb128 0x30
+	.string	"raw"
+	.byte	0xc
+	.byte	0x73
+	.byte	0xd
+	.long	0x4bd
+	.uleb128 0x31
+	.long	.LASF1484
+	.byte	0xc
+	.byte	0x74
+	.byte	0x23
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1485
+	.byte	0xc
+	.byte	0x75
+	.byte	0x3
+	.long	0x501
+	.uleb128 0x17
+	.long	.LASF1486
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x22
+	.long	0x523
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xd
+	.byte	0x14
+	.long	0x56b
+	.uleb128 0x2
+	.long	.LASF1487
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1488
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1489
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1492
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1493
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x3
+	.long	0x53b
+	.uleb128 0x26
+	.byte	0x28
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x9
+	.long	0x5e9
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x12
+	.long	0x336
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0xd
+	.byte	0x1f
+	.byte	0x9
+	.long	0x5e9
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0xd
+	.byte	0x20
+	.byte	0x16
+	.long	0x56b
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0xd
+	.byte	0x21
+	.byte	0xe
+	.long	0x110
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0xd
+	.byte	0x22
+	.byte	0xe
+	.long	0x110
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0xd
+	.byte	0x23
+	.byte	0xe
+	.long	0x110
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0xd
+	.byte	0x24
+	.byte	0xe
+	.long	0x110
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0xd
+	.byte	0x25
+	.byte	0xe
+	.long	0x110
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1502
+	.uleb128 0x4
+	.long	.LASF1503
+	.byte	0xd
+	.byte	0x26
+	.byte	0x3
+	.long	0x577
+	.uleb128 0x14
+	.long	0x4a
+	.byte	0xd
+	.byte	0x28
+	.long	0x63e
+	.uleb128 0x2
+	.long	.LASF1504
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1505
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1507
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1508
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1511
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1513
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x3
+	.long	0x5fc
+	.uleb128 0x15
+	.long	.LASF1514
+	.byte	0x50
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x10
+	.long	0x6a4
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xb
+	.long	0x4ad
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0xe
+	.byte	0x20
+	.byte	0xb
+	.long	0x4ad
+	.byte	0xc
+	.uleb128 0x18
+	.string	"q"
+	.byte	0xe
+	.byte	0x21
+	.byte	0xb
+	.long	0x6a4
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0xe
+	.byte	0x22
+	.byte	0xb
+	.long	0x4ad
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0xe
+	.byte	0x23
+	.byte	0xb
+	.long	0x4ad
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0xe
+	.byte	0x24
+	.byte	0xb
+	.long	0x6a4
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e
+	.long	0x6b4
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1520
+	.byte	0xe
+	.byte	0x25
+	.byte	0x3
+	.long	0x64a
+	.uleb128 0x17
+	.long	.LASF1521
+	.byte	0xe
+	.byte	0x27
+	.byte	0x14
+	.long	0x6b4
+	.uleb128 0x26
+	.byte	0xc
+	.byte	0x1
+	.byte	0x3b
+	.byte	0xe
+	.long	0x6f9
+	.uleb128 0x18
+	.string	"x"
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xb
+	.long	0x2e
+	.byte	0
+	.uleb128 0x18
+	.string	"y"
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xb
+	.long	0x2e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xc
+	.long	0xe0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	0x6cc
+	.uleb128 0xc
+	.long	0x6f9
+	.long	0x70e
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	0x6fe
+	.uleb128 0x11
+	.long	.LASF1529
+	.byte	0x3f
+	.byte	0x3
+	.long	0x70e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	motorLayout
+	.uleb128 0x15
+	.long	.LASF1523
+	.byte	0xc
+	.byte	0x1
+	.byte	0x47
+	.byte	0x10
+	.long	0x777
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x1
+	.byte	0x48
+	.byte	0xe
+	.long	0x110
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x1
+	.byte	0x49
+	.byte	0xe
+	.long	0x104
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x1
+	.byte	0x4a
+	.byte	0xe
+	.long	0x104
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xe
+	.long	0x104
+	.byte	0x8
+	.uleb128 0x18
+	.string	"yaw"
+	.byte	0x1
+	.byte	0x4c
+	.byte	0xe
+	.long	0x104
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1528
+	.byte	0x1
+	.byte	0x4d
+	.byte	0x3
+	.long	0x728
+	.uleb128 0x13
+	.long	0x777
+	.uleb128 0xc
+	.long	0x783
+	.long	0x798
+	.uleb128 0xd
+	.long	0x35
+	.byte	0xc
+	.byte	0
+	.uleb128 0x13
+	.long	0x788
+	.uleb128 0x11
+	.long	.LASF1530
+	.byte	0x4f
+	.byte	0x1b
+	.long	0x798
+	.uleb128 0x9
+	.byte	0x3
+	.quad	rcScript
+	.uleb128 0x32
+	.long	0x6c0
+	.byte	0x1
+	.byte	0x61
+	.byte	0xd
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sitlState
+	.uleb128 0x11
+	.long	.LASF1531
+	.byte	0x63
+	.byte	0xe
+	.long	0x6a4
+	.uleb128 0x9
+	.byte	0x3
+	.quad	motorCommand
+	.uleb128 0x11
+	.long	.LASF1532
+	.byte	0x64
+	.byte	0x11
+	.long	0x11c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	simulatedUntilUs
+	.uleb128 0x11
+	.long	.LASF1533
+	.byte	0x65
+	.byte	0x11
+	.long	0x11c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	durationUs
+	.uleb128 0x11
+	.long	.LASF1534
+	.byte	0x66
+	.byte	0x11
+	.long	0x11c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	logIntervalUs
+	.uleb128 0x11
+	.long	.LASF1535
+	.byte	0x67
+	.byte	0x11
+	.long	0x11c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	nextLogAtUs
+	.uleb128 0x11
+	.long	.LASF1536
+	.byte	0x68
+	.byte	0x11
+	.long	0x11c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	nextSerialPollAtUs
+	.uleb128 0xe
+	.long	.LASF1537
+	.byte	0x9
+	.byte	0x34
+	.byte	0xd
+	.long	0x336
+	.long	0x858
+	.uleb128 0x5
+	.long	0x3ac
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1538
+	.byte	0x9
+	.byte	0x36
+	.byte	0xa
+	.long	0x110
+	.long	0x86e
+	.uleb128 0x5
+	.long	0x3ac
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1539
+	.byte	0x9
+	.byte	0x35
+	.byte	0x1c
+	.long	0x884
+	.long	0x884
+	.uleb128 0x5
+	.long	0x3ac
+	.byte	0
+	.uleb128 0x7
+	.long	0x430
+	.uleb128 0x33
+	.long	.LASF1587
+	.byte	0xd
+	.byte	0x69
+	.byte	0x6
+	.long	0x8a0
+	.uleb128 0x5
+	.long	0x63e
+	.uleb128 0x5
+	.long	0x8a0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5f0
+	.uleb128 0x19
+	.long	.LASF1540
+	.byte	0xb
+	.value	0x164
+	.byte	0xc
+	.long	0x8f
+	.long	0x8bd
+	.uleb128 0x5
+	.long	0x336
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1541
+	.byte	0xf
+	.byte	0x8f
+	.byte	0xe
+	.long	0x2e
+	.long	0x8d3
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1542
+	.byte	0x10
+	.value	0x27d
+	.byte	0xd
+	.long	0x8e6
+	.uleb128 0x5
+	.long	0x8f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1543
+	.byte	0xb
+	.byte	0xe6
+	.byte	0xc
+	.long	0x8f
+	.long	0x8fc
+	.uleb128 0x5
+	.long	0x317
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1588
+	.byte	0xe
+	.byte	0x32
+	.byte	0x6
+	.uleb128 0xe
+	.long	.LASF1544
+	.byte	0x10
+	.byte	0xb5
+	.byte	0x1a
+	.long	0x35
+	.long	0x924
+	.uleb128 0x5
+	.long	0x33b
+	.uleb128 0x5
+	.long	0x929
+	.uleb128 0x5
+	.long	0x8f
+	.byte	0
+	.uleb128 0x7
+	.long	0xcf
+	.uleb128 0x25
+	.long	0x924
+	.uleb128 0x19
+	.long	.LASF1545
+	.byte	0x10
+	.value	0x28e
+	.byte	0xe
+	.long	0xcf
+	.long	0x945
+	.uleb128 0x5
+	.long	0x336
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1546
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xe
+	.long	0xcd
+	.long	0x965
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x5
+	.long	0x8f
+	.uleb128 0x5
+	.long	0x128
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1547
+	.byte	0xf
+	.byte	0x37
+	.byte	0xf
+	.long	0x2e
+	.long	0x97b
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1548
+	.byte	0xf
+	.value	0x14d
+	.byte	0xe
+	.long	0x2e
+	.long	0x997
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1549
+	.byte	0xf
+	.value	0x150
+	.byte	0xe
+	.long	0x2e
+	.long	0x9b3
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1550
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xf
+	.long	0x2e
+	.long	0x9ce
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1589
+	.byte	0x1
+	.value	0x13c
+	.byte	0xa
+	.long	0x104
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa3c
+	.uleb128 0x38
+	.long	.LASF1581
+	.byte	0x1
+	.value	0x13c
+	.byte	0x23
+	.long	0xf8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x27
+	.long	.LASF1551
+	.value	0x13e
+	.byte	0x19
+	.long	0xa3c
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x27
+	.long	.LASF1552
+	.value	0x13f
+	.byte	0xe
+	.long	0x110
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x39
+	.string	"i"
+	.byte	0x1
+	.value	0x140
+	.byte	0xd
+	.long	0xf8
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x7
+	.long	0x783
+	.uleb128 0x20
+	.long	.LASF1555
+	.value	0x133
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xac9
+	.uleb128 0x21
+	.long	.LASF1553
+	.value	0x133
+	.byte	0x1b
+	.long	0xf8
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x21
+	.long	.LASF1554
+	.value	0x133
+	.byte	0x2b
+	.long	0x104
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x28
+	.long	.LASF1559
+	.value	0x138
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x8
+	.quad	.LVL94
+	.long	0x997
+	.long	0xaaf
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL95
+	.long	0x97b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1556
+	.value	0x11b
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe54
+	.uleb128 0x21
+	.long	.LASF1557
+	.value	0x11b
+	.byte	0x1d
+	.long	0x11c
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x22
+	.long	0xfa7
+	.quad	.LBI31
+	.value	.LVU399
+	.long	.LLRL20
+	.value	0x127
+	.byte	0xd
+	.long	0xb84
+	.uleb128 0x10
+	.long	0xfb1
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x16
+	.long	.LLRL20
+	.uleb128 0xa
+	.long	0xfbc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0xa
+	.long	0xfc7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0xa
+	.long	0xfd2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x8
+	.quad	.LVL67
+	.long	0x10ad
+	.long	0xb67
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -280
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL68
+	.long	0x8a5
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC25
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0xfde
+	.quad	.LBI35
+	.value	.LVU180
+	.long	.LLRL22
+	.value	0x11e
+	.byte	0x9
+	.long	0xce2
+	.uleb128 0x10
+	.long	0xfe8
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x16
+	.long	.LLRL22
+	.uleb128 0x29
+	.long	0xff2
+	.uleb128 0xb
+	.long	0xffd
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0xa
+	.long	0x1008
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0xb
+	.long	0x1013
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xb
+	.long	0x101e
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0xa
+	.long	0x1027
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0xb
+	.long	0x1032
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0xa
+	.long	0x103d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0xb
+	.long	0x1048
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x29
+	.long	0x1051
+	.uleb128 0xb
+	.long	0x105b
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0xa
+	.long	0x1066
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0xa
+	.long	0x1071
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0xa
+	.long	0x107c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x3a
+	.long	0x12b9
+	.quad	.LBI37
+	.value	.LVU356
+	.long	.LLRL30
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x5
+	.long	0xcaf
+	.uleb128 0x10
+	.long	0x12c3
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x10
+	.long	0x12d5
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x10
+	.long	0x12cc
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x16
+	.long	.LLRL30
+	.uleb128 0xa
+	.long	0x12e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xf
+	.quad	.LVL61
+	.long	0x12f1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL50
+	.long	0x12f1
+	.long	0xcd3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL91
+	.long	0x8bd
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	0xf6d
+	.quad	.LBI50
+	.value	.LVU429
+	.quad	.LBB50
+	.quad	.LBE50-.LBB50
+	.byte	0x1
+	.value	0x12c
+	.byte	0xd
+	.long	0xe26
+	.uleb128 0xa
+	.long	0xf77
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xb
+	.long	0xf82
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0xb
+	.long	0xf8d
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x3c
+	.long	0xf98
+	.long	.LLRL36
+	.long	0xdb5
+	.uleb128 0xb
+	.long	0xf99
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x8
+	.quad	.LVL79
+	.long	0x86e
+	.long	0xd5e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL82
+	.long	0x858
+	.long	0xd76
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL84
+	.long	0x842
+	.long	0xd8e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL85
+	.long	0x8a5
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL72
+	.long	0x13a7
+	.long	0xdd4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC26
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL74
+	.long	0x889
+	.long	0xdf2
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL75
+	.long	0x8a5
+	.long	0xe0a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL78
+	.long	0x13a7
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC28
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL65
+	.long	0x8fc
+	.uleb128 0x1a
+	.quad	.LVL88
+	.long	0x8e6
+	.uleb128 0xf
+	.quad	.LVL89
+	.long	0x8d3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1558
+	.value	0x10e
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf6d
+	.uleb128 0x22
+	.long	0x1374
+	.quad	.LBI6
+	.value	.LVU135
+	.long	.LLRL11
+	.value	0x115
+	.byte	0x1c
+	.long	0xef0
+	.uleb128 0x10
+	.long	0x1390
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x10
+	.long	0x1385
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x16
+	.long	.LLRL11
+	.uleb128 0xb
+	.long	0x139b
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x8
+	.quad	.LVL19
+	.long	0x92e
+	.long	0xed6
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL30
+	.long	0x904
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0x1374
+	.quad	.LBI12
+	.value	.LVU145
+	.long	.LLRL15
+	.byte	0x1
+	.value	0x116
+	.byte	0x1f
+	.uleb128 0x10
+	.long	0x1390
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x10
+	.long	0x1385
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x16
+	.long	.LLRL15
+	.uleb128 0xb
+	.long	0x139b
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x8
+	.quad	.LVL23
+	.long	0x92e
+	.long	0xf52
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.byte	0
+	.uleb128 0xf
+	.quad	.LVL28
+	.long	0x904
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1564
+	.byte	0xe8
+	.long	0xfa7
+	.uleb128 0x6
+	.long	.LASF1560
+	.byte	0xea
+	.byte	0x12
+	.long	0x5f0
+	.uleb128 0x6
+	.long	.LASF1561
+	.byte	0xeb
+	.byte	0x10
+	.long	0x63e
+	.uleb128 0x6
+	.long	.LASF1562
+	.byte	0xfd
+	.byte	0x14
+	.long	0x3ac
+	.uleb128 0x3e
+	.uleb128 0x28
+	.long	.LASF1563
+	.value	0x100
+	.byte	0x24
+	.long	0x884
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1565
+	.byte	0xd9
+	.long	0xfde
+	.uleb128 0x23
+	.long	.LASF1557
+	.byte	0xd9
+	.byte	0x1f
+	.long	0x11c
+	.uleb128 0x6
+	.long	.LASF1525
+	.byte	0xdb
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF1526
+	.byte	0xdb
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x1c
+	.string	"yaw"
+	.byte	0xdb
+	.byte	0x18
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1566
+	.byte	0x8c
+	.long	0x1088
+	.uleb128 0x1d
+	.string	"dT"
+	.byte	0x8c
+	.byte	0x1d
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF1567
+	.byte	0x8e
+	.byte	0xb
+	.long	0x6a4
+	.uleb128 0x6
+	.long	.LASF1568
+	.byte	0x8f
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF1569
+	.byte	0x90
+	.byte	0xb
+	.long	0x4ad
+	.uleb128 0x6
+	.long	.LASF1570
+	.byte	0x91
+	.byte	0x11
+	.long	0x340
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0x92
+	.byte	0x9
+	.long	0x8f
+	.uleb128 0x6
+	.long	.LASF1571
+	.byte	0xa0
+	.byte	0x11
+	.long	0x1088
+	.uleb128 0x6
+	.long	.LASF1517
+	.byte	0xa1
+	.byte	0xc
+	.long	0x1098
+	.uleb128 0x6
+	.long	.LASF1572
+	.byte	0xa2
+	.byte	0x11
+	.long	0x1088
+	.uleb128 0x1c
+	.string	"q"
+	.byte	0xab
+	.byte	0xc
+	.long	0x1098
+	.uleb128 0x1c
+	.string	"dq"
+	.byte	0xac
+	.byte	0x11
+	.long	0x109d
+	.uleb128 0x6
+	.long	.LASF1573
+	.byte	0xb2
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x6
+	.long	.LASF1574
+	.byte	0xbd
+	.byte	0x11
+	.long	0x1088
+	.uleb128 0x6
+	.long	.LASF1575
+	.byte	0xbe
+	.byte	0xb
+	.long	0x4ad
+	.uleb128 0x6
+	.long	.LASF1576
+	.byte	0xc1
+	.byte	0xb
+	.long	0x4ad
+	.byte	0
+	.uleb128 0xc
+	.long	0x340
+	.long	0x1098
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x2e
+	.uleb128 0xc
+	.long	0x340
+	.long	0x10ad
+	.uleb128 0xd
+	.long	0x35
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1577
+	.byte	0x1
+	.byte	0x82
+	.byte	0x6
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12b9
+	.uleb128 0x2a
+	.long	.LASF1525
+	.byte	0x82
+	.byte	0x20
+	.long	0x1098
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2a
+	.long	.LASF1526
+	.byte	0x82
+	.byte	0x2d
+	.long	0x1098
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x40
+	.string	"yaw"
+	.byte	0x1
+	.byte	0x82
+	.byte	0x3b
+	.long	0x1098
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x12
+	.string	"w"
+	.byte	0x84
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x12
+	.string	"x"
+	.byte	0x84
+	.byte	0x1f
+	.long	0x2e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x12
+	.string	"y"
+	.byte	0x84
+	.byte	0x33
+	.long	0x2e
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x12
+	.string	"z"
+	.byte	0x84
+	.byte	0x47
+	.long	0x2e
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x41
+	.long	.LASF1578
+	.byte	0x1
+	.byte	0x85
+	.byte	0x11
+	.long	0x340
+	.byte	0x4
+	.long	0x42652ee0
+	.uleb128 0x8
+	.quad	.LVL9
+	.long	0x9b3
+	.long	0x11ce
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x2f
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x22
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x2b
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x22
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL11
+	.long	0x997
+	.long	0x121e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x2f
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -40
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x1c
+	.byte	0x22
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0
+	.uleb128 0x8
+	.quad	.LVL12
+	.long	0x97b
+	.long	0x123b
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xbf800000
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LVL13
+	.long	0x965
+	.uleb128 0xf
+	.quad	.LVL14
+	.long	0x9b3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x2f
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x91
+	.sleb128 -56
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -48
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -44
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x22
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x2b
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x3f800000
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x91
+	.sleb128 -52
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x1e
+	.byte	0x91
+	.sleb128 -36
+	.byte	0xa6
+	.byte	0x4
+	.uleb128 0x2e
+	.byte	0x22
+	.byte	0x22
+	.byte	0x1c
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1579
+	.byte	0x7c
+	.long	0x12ec
+	.uleb128 0x1d
+	.string	"q"
+	.byte	0x7c
+	.byte	0x2c
+	.long	0x12ec
+	.uleb128 0x1d
+	.string	"v"
+	.byte	0x7c
+	.byte	0x3c
+	.long	0x12ec
+	.uleb128 0x1d
+	.string	"out"
+	.byte	0x7c
+	.byte	0x46
+	.long	0x1098
+	.uleb128 0x6
+	.long	.LASF1580
+	.byte	0x7e
+	.byte	0x11
+	.long	0x109d
+	.byte	0
+	.uleb128 0x7
+	.long	0x340
+	.uleb128 0x42
+	.long	.LASF1590
+	.byte	0x1
+	.byte	0x73
+	.byte	0xd
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1374
+	.uleb128 0x24
+	.string	"q"
+	.byte	0x2c
+	.long	0x12ec
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x24
+	.string	"v"
+	.byte	0x3c
+	.long	0x12ec
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x24
+	.string	"out"
+	.byte	0x46
+	.long	0x1098
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x12
+	.string	"w"
+	.byte	0x75
+	.byte	0xb
+	.long	0x2e
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x12
+	.string	"x"
+	.byte	0x75
+	.byte	0x15
+	.long	0x2e
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x12
+	.string	"y"
+	.byte	0x75
+	.byte	0x1f
+	.long	0x2e
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x12
+	.string	"z"
+	.byte	0x75
+	.byte	0x29
+	.long	0x2e
+	.long	.LLST3
+	.long	.LVUS3
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1591
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x11
+	.long	0x110
+	.byte	0x1
+	.long	0x13a7
+	.uleb128 0x23
+	.long	.LASF1582
+	.byte	0x6a
+	.byte	0x2a
+	.long	0x336
+	.uleb128 0x23
+	.long	.LASF1583
+	.byte	0x6a
+	.byte	0x39
+	.long	0x110
+	.uleb128 0x6
+	.long	.LASF1584
+	.byte	0x6c
+	.byte	0x11
+	.long	0x336
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF1592
+	.long	.LASF1593
+	.byte	0x12
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 115
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS40:
+	.uleb128 .LVU492
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU508
+	.uleb128 .LVU509
+	.uleb128 .LVU512
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+	.uleb128 .LVU516
+	.uleb128 .LVU517
+	.uleb128 .LVU518
+	.uleb128 .LVU520
+.LLST40:
+	.byte	0x6
+	.quad	.LVL97
+	.byte	0x4
+	.uleb128 .LVL97-.LVL97
+	.uleb128 .LVL98-.LVL97
+	.uleb128 0xa
+	.byte	0x3
+	.quad	rcScript
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.LVL97
+	.uleb128 .LVL101-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.LVL97
+	.uleb128 .LVL103-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL104-.LVL97
+	.uleb128 .LVL105-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL106-.LVL97
+	.uleb128 .LVL107-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.LVL97
+	.uleb128 .LVL109-.LVL97
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU497
+	.uleb128 0
+.LLST41:
+	.byte	0x8
+	.quad	.LVL98
+	.uleb128 .LFE32-.LVL98
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU499
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU505
+.LLST42:
+	.byte	0x6
+	.quad	.LVL98
+	.byte	0x4
+	.uleb128 .LVL98-.LVL98
+	.uleb128 .LVL98-.LVL98
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL98-.LVL98
+	.uleb128 .LVL99-.LVL98
+	.uleb128 0x17
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rcScript
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x3c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.LVL98
+	.uleb128 .LVL99-.LVL98
+	.uleb128 0x17
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rcScript+12
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x3c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.LVL98
+	.uleb128 .LVL100-.LVL98
+	.uleb128 0x17
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	rcScript+12
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x3c
+	.byte	0xa8
+	.uleb128 0x35
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 0
+.LLST38:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL94-1-.LVL92
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL94-1-.LVL92
+	.uleb128 .LVL96-.LVL92
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.LVL92
+	.uleb128 .LFE31-.LVL92
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU479
+	.uleb128 .LVU479
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU489
+	.uleb128 .LVU489
+	.uleb128 0
+.LLST39:
+	.byte	0x6
+	.quad	.LVL92
+	.byte	0x4
+	.uleb128 .LVL92-.LVL92
+	.uleb128 .LVL93-.LVL92
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL93-.LVL92
+	.uleb128 .LVL94-1-.LVL92
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 1000
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL94-1-.LVL92
+	.uleb128 .LVL96-.LVL92
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL96-.LVL92
+	.uleb128 .LFE31-.LVL92
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU467
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL33
+	.byte	0x4
+	.uleb128 .LVL33-.LVL33
+	.uleb128 .LVL34-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL34-.LVL33
+	.uleb128 .LVL89-.LVL33
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0x4
+	.uleb128 .LVL89-.LVL33
+	.uleb128 .LVL90-.LVL33
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL90-.LVL33
+	.uleb128 .LFE30-.LVL33
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU399
+	.uleb128 .LVU402
+.LLST21:
+	.byte	0x8
+	.quad	.LVL66
+	.uleb128 .LVL67-1-.LVL66
+	.uleb128 0x9
+	.byte	0x3
+	.quad	simulatedUntilUs
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU181
+	.uleb128 .LVU369
+	.uleb128 .LVU387
+	.uleb128 .LVU394
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST23:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL61-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3983126f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL34
+	.uleb128 .LVL64-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3983126f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL34
+	.uleb128 .LFE30-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3983126f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU183
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU305
+	.uleb128 .LVU468
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 0
+.LLST24:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL35-.LVL34
+	.uleb128 .LVL46-.LVL34
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL90-.LVL34
+	.uleb128 .LVL91-1-.LVL34
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL91-1-.LVL34
+	.uleb128 .LFE30-.LVL34
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU185
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST25:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL89-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3deef20e
+	.byte	0x4
+	.uleb128 .LVL90-.LVL34
+	.uleb128 .LFE30-.LVL34
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0x3deef20e
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU187
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU222
+	.uleb128 .LVU242
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU272
+	.uleb128 .LVU311
+	.uleb128 .LVU312
+	.uleb128 .LVU322
+	.uleb128 .LVU324
+	.uleb128 .LVU324
+	.uleb128 .LVU329
+	.uleb128 .LVU329
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 .LVU339
+	.uleb128 .LVU339
+	.uleb128 .LVU346
+.LLST26:
+	.byte	0x6
+	.quad	.LVL34
+	.byte	0x4
+	.uleb128 .LVL34-.LVL34
+	.uleb128 .LVL35-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL34
+	.uleb128 .LVL36-.LVL34
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlState
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.LVL34
+	.uleb128 .LVL38-.LVL34
+	.uleb128 0xf
+	.byte	0x71
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlState+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL34
+	.uleb128 .LVL40-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.LVL34
+	.uleb128 .LVL41-.LVL34
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.LVL34
+	.uleb128 .LVL42-.LVL34
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL34
+	.uleb128 .LVL44-.LVL34
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL44-.LVL34
+	.uleb128 .LVL44-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.LVL34
+	.uleb128 .LVL48-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL34
+	.uleb128 .LVL51-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.LVL34
+	.uleb128 .LVL52-.LVL34
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.LVL34
+	.uleb128 .LVL53-.LVL34
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.LVL34
+	.uleb128 .LVL54-.LVL34
+	.uleb128 0x7
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x32
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.LVL34
+	.uleb128 .LVL55-.LVL34
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.LVL34
+	.uleb128 .LVL56-.LVL34
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlState
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.LVL34
+	.uleb128 .LVL57-.LVL34
+	.uleb128 0xf
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlState+4
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x25
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU231
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU435
+	.uleb128 .LVU435
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST27:
+	.byte	0x6
+	.quad	.LVL39
+	.byte	0x4
+	.uleb128 .LVL39-.LVL39
+	.uleb128 .LVL62-.LVL39
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL62-.LVL39
+	.uleb128 .LVL63-.LVL39
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL39
+	.uleb128 .LVL71-.LVL39
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL71-.LVL39
+	.uleb128 .LVL89-.LVL39
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL39
+	.uleb128 .LFE30-.LVL39
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU256
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU353
+	.uleb128 .LVU353
+	.uleb128 .LVU387
+	.uleb128 .LVU387
+	.uleb128 .LVU394
+	.uleb128 .LVU394
+	.uleb128 .LVU467
+	.uleb128 .LVU468
+	.uleb128 0
+.LLST28:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL47-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.LVL43
+	.uleb128 .LVL58-.LVL43
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-.LVL43
+	.uleb128 .LVL63-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL43
+	.uleb128 .LVL64-.LVL43
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL64-.LVL43
+	.uleb128 .LVL89-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.LVL43
+	.uleb128 .LFE30-.LVL43
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+24
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU270
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+	.uleb128 .LVU310
+	.uleb128 .LVU314
+	.uleb128 .LVU468
+	.uleb128 .LVU470
+.LLST29:
+	.byte	0x6
+	.quad	.LVL44
+	.byte	0x4
+	.uleb128 .LVL44-.LVL44
+	.uleb128 .LVL45-.LVL44
+	.uleb128 0x6
+	.byte	0x9e
+	.uleb128 0x4
+	.long	0
+	.byte	0x4
+	.uleb128 .LVL45-.LVL44
+	.uleb128 .LVL46-.LVL44
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL48-.LVL44
+	.uleb128 .LVL49-.LVL44
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL90-.LVL44
+	.uleb128 .LVL91-1-.LVL44
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU357
+	.uleb128 .LVU369
+.LLST31:
+	.byte	0x8
+	.quad	.LVL59
+	.uleb128 .LVL61-.LVL59
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+24
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU357
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU369
+.LLST32:
+	.byte	0x6
+	.quad	.LVL59
+	.byte	0x4
+	.uleb128 .LVL59-.LVL59
+	.uleb128 .LVL60-.LVL59
+	.uleb128 0xa
+	.byte	0x3
+	.quad	sitlState+52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.LVL59
+	.uleb128 .LVL61-.LVL59
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU356
+	.uleb128 .LVU369
+.LLST33:
+	.byte	0x8
+	.quad	.LVL59
+	.uleb128 .LVL61-.LVL59
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU448
+.LLST34:
+	.byte	0x6
+	.quad	.LVL72
+	.byte	0x4
+	.uleb128 .LVL72-.LVL72
+	.uleb128 .LVL73-.LVL72
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.LVL72
+	.uleb128 .LVL77-.LVL72
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU451
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU464
+.LLST35:
+	.byte	0x6
+	.quad	.LVL78
+	.byte	0x4
+	.uleb128 .LVL78-.LVL78
+	.uleb128 .LVL78-.LVL78
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.LVL78
+	.uleb128 .LVL87-.LVL78
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU454
+	.uleb128 .LVU456
+	.uleb128 .LVU456
+	.uleb128 .LVU461
+.LLST37:
+	.byte	0x6
+	.quad	.LVL80
+	.byte	0x4
+	.uleb128 .LVL80-.LVL80
+	.uleb128 .LVL81-.LVL80
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL81-.LVL80
+	.uleb128 .LVL83-.LVL80
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU135
+	.uleb128 .LVU141
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL21-.LVL18
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL18
+	.uleb128 .LFE29-.LVL18
+	.uleb128 0x2
+	.byte	0x44
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU135
+	.uleb128 .LVU141
+	.uleb128 .LVU163
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL18
+	.byte	0x4
+	.uleb128 .LVL18-.LVL18
+	.uleb128 .LVL21-.LVL18
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.LVL18
+	.uleb128 .LFE29-.LVL18
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU138
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+	.uleb128 .LVU169
+	.uleb128 .LVU170
+.LLST14:
+	.byte	0x6
+	.quad	.LVL19
+	.byte	0x4
+	.uleb128 .LVL19-.LVL19
+	.uleb128 .LVL20-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL20-.LVL19
+	.uleb128 .LVL21-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-.LVL19
+	.uleb128 .LVL30-1-.LVL19
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-.LVL19
+	.uleb128 .LVL32-.LVL19
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU145
+	.uleb128 .LVU151
+	.uleb128 .LVU158
+	.uleb128 .LVU163
+.LLST16:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL26-.LVL22
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL22
+	.uleb128 .LVL29-.LVL22
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x64
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU145
+	.uleb128 .LVU151
+	.uleb128 .LVU158
+	.uleb128 .LVU163
+.LLST17:
+	.byte	0x6
+	.quad	.LVL22
+	.byte	0x4
+	.uleb128 .LVL22-.LVL22
+	.uleb128 .LVL26-.LVL22
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.LVL22
+	.uleb128 .LVL29-.LVL22
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC4
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+	.uleb128 .LVU158
+	.uleb128 .LVU160
+.LLST18:
+	.byte	0x6
+	.quad	.LVL24
+	.byte	0x4
+	.uleb128 .LVL24-.LVL24
+	.uleb128 .LVL25-.LVL24
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL25-.LVL24
+	.uleb128 .LVL26-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-.LVL24
+	.uleb128 .LVL28-1-.LVL24
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 .LVL17-.LVL6
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.LVL6
+	.uleb128 .LFE25-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU120
+	.uleb128 .LVU120
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 .LVL16-.LVL6
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.LVL6
+	.uleb128 .LFE25-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU119
+	.uleb128 .LVU119
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL6
+	.uleb128 .LVL15-.LVL6
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.LVL6
+	.uleb128 .LFE25-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU73
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 .LFE25-.LVL7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU73
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 .LFE25-.LVL7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU73
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU93
+.LLST9:
+	.byte	0x6
+	.quad	.LVL7
+	.byte	0x4
+	.uleb128 .LVL7-.LVL7
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL7
+	.uleb128 .LVL10-.LVL7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU74
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL9-1-.LVL8
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0x4
+	.uleb128 .LVL9-1-.LVL8
+	.uleb128 .LFE25-.LVL8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU6
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 .LVU39
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-.LVL1
+	.uleb128 0x1
+	.byte	0x68
+	.byte	0x4
+	.uleb128 .LVL2-.LVL1
+	.uleb128 .LVL4-.LVL1
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU6
+	.uleb128 .LVU45
+.LLST1:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LVL5-.LVL1
+	.uleb128 0x1
+	.byte	0x6a
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU6
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 .LVU39
+.LLST2:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL3-.LVL1
+	.uleb128 0x1
+	.byte	0x62
+	.byte	0x4
+	.uleb128 .LVL3-.LVL1
+	.uleb128 .LVL4-.LVL1
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST3:
+	.byte	0x8
+	.quad	.LVL1
+	.uleb128 .LFE23-.LVL1
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x7c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL11:
+	.byte	0x5
+	.quad	.LBB6
+	.byte	0x4
+	.uleb128 .LBB6-.LBB6
+	.uleb128 .LBE6-.LBB6
+	.byte	0x4
+	.uleb128 .LBB11-.LBB6
+	.uleb128 .LBE11-.LBB6
+	.byte	0x4
+	.uleb128 .LBB20-.LBB6
+	.uleb128 .LBE20-.LBB6
+	.byte	0x4
+	.uleb128 .LBB21-.LBB6
+	.uleb128 .LBE21-.LBB6
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB12
+	.byte	0x4
+	.uleb128 .LBB12-.LBB12
+	.uleb128 .LBE12-.LBB12
+	.byte	0x4
+	.uleb128 .LBB17-.LBB12
+	.uleb128 .LBE17-.LBB12
+	.byte	0x4
+	.uleb128 .LBB18-.LBB12
+	.uleb128 .LBE18-.LBB12
+	.byte	0x4
+	.uleb128 .LBB19-.LBB12
+	.uleb128 .LBE19-.LBB12
+	.byte	0
+.LLRL20:
+	.byte	0x5
+	.quad	.LBB31
+	.byte	0x4
+	.uleb128 .LBB31-.LBB31
+	.uleb128 .LBE31-.LBB31
+	.byte	0x4
+	.uleb128 .LBB48-.LBB31
+	.uleb128 .LBE48-.LBB31
+	.byte	0x4
+	.uleb128 .LBB49-.LBB31
+	.uleb128 .LBE49-.LBB31
+	.byte	0
+.LLRL22:
+	.byte	0x5
+	.quad	.LBB35
+	.byte	0x4
+	.uleb128 .LBB35-.LBB35
+	.uleb128 .LBE35-.LBB35
+	.byte	0x4
+	.uleb128 .LBB45-.LBB35
+	.uleb128 .LBE45-.LBB35
+	.byte	0x4
+	.uleb128 .LBB46-.LBB35
+	.uleb128 .LBE46-.LBB35
+	.byte	0x4
+	.uleb128 .LBB47-.LBB35
+	.uleb128 .LBE47-.LBB35
+	.byte	0x4
+	.uleb128 .LBB54-.LBB35
+	.uleb128 .LBE54-.LBB35
+	.byte	0
+.LLRL30:
+	.byte	0x5
+	.quad	.LBB37
+	.byte	0x4
+	.uleb128 .LBB37-.LBB37
+	.uleb128 .LBE37-.LBB37
+	.byte	0x4
+	.uleb128 .LBB40-.LBB37
+	.uleb128 .LBE40-.LBB37
+	.byte	0
+.LLRL36:
+	.byte	0x5
+	.quad	.LBB52
+	.byte	0x4
+	.uleb128 .LBB52-.LBB52
+	.uleb128 .LBE52-.LBB52
+	.byte	0x4
+	.uleb128 .LBB53-.LBB52
+	.uleb128 .LBE53-.LBB52
+	.byte	0
+.LLRL43:
+	.byte	0x7
+	.quad	.LFB23
+	.uleb128 .LFE23-.LFB23
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB31
+	.uleb128 .LFE31-.LFB31
+	.byte	0x7
+	.quad	.LFB32
+	.uleb128 .LFE32-.LFB32
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF718
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF721
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF722
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF723
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF724
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF765
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF811
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF860
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF694
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF862
+	.file 51 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF863
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF880
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF893
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF898
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF901
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF919
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF920
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF921
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF933
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF941
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF945
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF947
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 74 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4b
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1227
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 81 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x51
+	.file 82 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 83 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1350
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 84 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x54
+	.byte	0x4
+	.file 85 ".//src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1369
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1383
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF720
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF733
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF752
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF786
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF791
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF808
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF809
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF810
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF820
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF832
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.fc9d051d38577d71bf2818359e56065c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.882ecbf54662e1f16e101552381a65da,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF857
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF869
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF871
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF875
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF879
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF897
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF900
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF914
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF918
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF932
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF939
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF944
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1221
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1226
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1229
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1231
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1246
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1246
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1256
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1259
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1320
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1330
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1349
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.profiling.h.34.071b1e95f4ebee26ff29bf11a1e6ac52,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1353
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.runtime_config.h.29.b12f5bd4f39b1d8afbd6516a4fad49b9,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1362
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.flight.h.54.7911941542bf685aa95791f80e16dbdf,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1366
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.scheduler.h.115.938f6c2ded084b2afd5b0b59fa60d513,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1368
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1578:
+	.string	"toDegrees"
+.LASF983:
+	.string	"__DECL_SIMD_logf "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1237:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1216:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF928:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1436:
+	.string	"_unused2"
+.LASF1199:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1470:
+	.string	"PIDPITCH"
+.LASF802:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1422:
+	.string	"_fileno"
+.LASF893:
+	.string	"_SYS_SELECT_H 1"
+.LASF1092:
+	.string	"__DECL_SIMD_sinh "
+.LASF736:
+	.string	"__ssize_t_defined "
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1495:
+	.string	"isEnabled"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1020:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1558:
+	.string	"sitlInit"
+.LASF865:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1156:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1136:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF993:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF854:
+	.string	"__pid_t_defined "
+.LASF864:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1445:
+	.string	"PROFILE_STAGE_ANNEX"
+.LASF1096:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1212:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1197:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF817:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1391:
+	.string	"__uint8_t"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1502:
+	.string	"_Bool"
+.LASF1118:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF951:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1330:
+	.string	"U_ID_2 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1232:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF726:
+	.string	"__struct_FILE_defined 1"
+.LASF1160:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1563:
+	.string	"stats"
+.LASF1556:
+	.string	"sitlAdvanceTo"
+.LASF1469:
+	.string	"PIDROLL"
+.LASF1567:
+	.string	"thrust"
+.LASF1323:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF727:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1175:
+	.string	"__DECL_SIMD_erff16 "
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF997:
+	.string	"__DECL_SIMD_expf64 "
+.LASF794:
+	.string	"__WCHAR_T__ "
+.LASF811:
+	.string	"_STDLIB_H 1"
+.LASF719:
+	.string	"__need___va_list"
+.LASF1163:
+	.string	"__DECL_SIMD_acoshf "
+.LASF968:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1476:
+	.string	"PIDLEVEL"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1570:
+	.string	"armOffset"
+.LASF1463:
+	.string	"profileStageStats_t"
+.LASF728:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF1551:
+	.string	"step"
+.LASF956:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF981:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1434:
+	.string	"__pad5"
+.LASF1404:
+	.string	"uint16_t"
+.LASF876:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF1233:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1408:
+	.string	"_flags"
+.LASF975:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1114:
+	.string	"__DECL_SIMD_atan2l "
+.LASF746:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF950:
+	.string	"_MATH_H 1"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1338:
+	.string	"ACC "
+.LASF1273:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1350:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1398:
+	.string	"__off_t"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1587:
+	.string	"getTaskInfo"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF964:
+	.string	"__DECL_SIMD_sinl "
+.LASF733:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1310:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF742:
+	.string	"SEEK_SET 0"
+.LASF1203:
+	.string	"__DECL_SIMD_erfcf "
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF734:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF852:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF793:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF985:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1428:
+	.string	"_lock"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF747:
+	.string	"L_tmpnam 20"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1478:
+	.string	"PIDVEL"
+.LASF782:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1560:
+	.string	"taskInfo"
+.LASF1041:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1471:
+	.string	"PIDYAW"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF984:
+	.string	"__DECL_SIMD_logl "
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1549:
+	.string	"fminf"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1221:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF992:
+	.string	"__DECL_SIMD_exp "
+.LASF1437:
+	.string	"FILE"
+.LASF1202:
+	.string	"__DECL_SIMD_erfc "
+.LASF1067:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1084:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1247:
+	.string	"_Mdouble_"
+.LASF760:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF905:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1349:
+	.string	"FAST_MATH "
+.LASF1340:
+	.string	"BARO "
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1176:
+	.string	"__DECL_SIMD_erff32 "
+.LASF948:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF901:
+	.string	"__timeval_defined 1"
+.LASF994:
+	.string	"__DECL_SIMD_expl "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF790:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF878:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF1058:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1177:
+	.string	"__DECL_SIMD_erff64 "
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1346:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1381:
+	.string	"SITL_DEFAULT_DURATION_S 20"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1484:
+	.string	"values"
+.LASF1497:
+	.string	"desiredPeriod"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1248:
+	.string	"__MATH_PRECNAME"
+.LASF1127:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF827:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF783:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1258:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1059:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1414:
+	.string	"_IO_write_end"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1251:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1443:
+	.string	"double"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1235:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF880:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1241:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF889:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1164:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1353:
+	.string	"PROFILE_STAGE_END(stage) profileStageEnd(stage)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF543:
+	.string	"__stub_chflags "
+.LASF1269:
+	.string	"__MATHDECL_1"
+.LASF1355:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= mask)"
+.LASF1477:
+	.string	"PIDMAG"
+.LASF1553:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1343:
+	.string	"USE_USART2 "
+.LASF722:
+	.string	"____mbstate_t_defined 1"
+.LASF1261:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1173:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1527:
+	.string	"throttle"
+.LASF789:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF770:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1410:
+	.string	"_IO_read_end"
+.LASF791:
+	.string	"__STDIO_INLINE"
+.LASF1116:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1040:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1052:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF853:
+	.string	"__uid_t_defined "
+.LASF1070:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF825:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1337:
+	.string	"USE_GYRO_SITL "
+.LASF1472:
+	.string	"PIDALT"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1369:
+	.string	"SITL_MOTOR_COUNT 4"
+.LASF762:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF1577:
+	.string	"sitlGetEulerAngles"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1378:
+	.string	"SITL_ANGULAR_DRAG 0.0005f"
+.LASF1523:
+	.string	"sitlRcStep_s"
+.LASF1528:
+	.string	"sitlRcStep_t"
+.LASF745:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1474:
+	.string	"PIDPOSR"
+.LASF1333:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF1311:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1077:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF875:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF795:
+	.string	"_WCHAR_T "
+.LASF1153:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1447:
+	.string	"PROFILE_STAGE_MIXER"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1011:
+	.string	"__DECL_SIMD_powf128x "
+.LASF868:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF943:
+	.string	"alloca"
+.LASF845:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1525:
+	.string	"roll"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1392:
+	.string	"__int16_t"
+.LASF1106:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1394:
+	.string	"__uint16_t"
+.LASF785:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF926:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF392:
+	.string	"false 0"
+.LASF1078:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1371:
+	.string	"SITL_ARM_LENGTH 0.165f"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1341:
+	.string	"USE_BARO_SITL "
+.LASF1045:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF358:
+	.string	"__k8 1"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF805:
+	.string	"__INT_WCHAR_T_H "
+.LASF850:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1048:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1306:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF894:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1017:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF911:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1375:
+	.string	"SITL_MOTOR_TIME_CONSTANT 0.02f"
+.LASF1079:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF888:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1555:
+	.string	"sitlSetMotor"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF838:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1187:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF980:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1008:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1049:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1421:
+	.string	"_chain"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF781:
+	.string	"__f32x(x) x ##f32x"
+.LASF1448:
+	.string	"PROFILE_STAGE_MOTORS"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1313:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1579:
+	.string	"rotateEarthToBody"
+.LASF1307:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1492:
+	.string	"TASK_PRIORITY_MAX"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1386:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1568:
+	.string	"totalThrust"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1226:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF851:
+	.string	"__mode_t_defined "
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1384:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1441:
+	.string	"long long int"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF804:
+	.string	"___int_wchar_t_h "
+.LASF1271:
+	.string	"__MATHDECL"
+.LASF1336:
+	.string	"GYRO "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1174:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1366:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10.0f)"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1324:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1035:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF873:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1345:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF949:
+	.string	"_STRINGS_H 1"
+.LASF1364:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1100:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF891:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1531:
+	.string	"motorCommand"
+.LASF1415:
+	.string	"_IO_buf_base"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF508:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF947:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF857:
+	.string	"__key_t_defined "
+.LASF1025:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1564:
+	.string	"printReport"
+.LASF1255:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF858:
+	.string	"__clock_t_defined 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF801:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1278:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1243:
+	.string	"_Mdouble_ double"
+.LASF1047:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1383:
+	.string	"RC_SCRIPT_LENGTH (sizeof(rcScript) / sizeof(rcScript[0]))"
+.LASF904:
+	.string	"__NFDBITS"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1461:
+	.string	"totalCycles"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1073:
+	.string	"__DECL_SIMD_coshf "
+.LASF830:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1154:
+	.string	"__DECL_SIMD_atanhl "
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF376:
+	.string	"unix 1"
+.LASF1146:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1205:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1051:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1352:
+	.string	"PROFILE_STAGE_BEGIN(stage) profileStageBegin(stage)"
+.LASF861:
+	.string	"__timer_t_defined 1"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1593:
+	.string	"__builtin_puts"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1098:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF718:
+	.string	"__need___va_list "
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1430:
+	.string	"_codecvt"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1245:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1105:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF899:
+	.string	"____sigset_t_defined "
+.LASF1331:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF863:
+	.string	"_ENDIAN_H 1"
+.LASF1483:
+	.string	"rollAndPitchInclination_t_def"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1584:
+	.string	"value"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF961:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1124:
+	.string	"__DECL_SIMD_log10l "
+.LASF1486:
+	.string	"inclination"
+.LASF1591:
+	.string	"envOrDefault"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1001:
+	.string	"__DECL_SIMD_expf128x "
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1457:
+	.string	"startedAt"
+.LASF1542:
+	.string	"exit"
+.LASF1513:
+	.string	"cfTaskId_e"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF952:
+	.string	"__DECL_SIMD_cos "
+.LASF882:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF945:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1217:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF932:
+	.string	"__ONCE_ALIGNMENT "
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1111:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF917:
+	.string	"__fsblkcnt_t_defined "
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1130:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1033:
+	.string	"__DECL_SIMD_asinf "
+.LASF821:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF756:
+	.string	"__attr_dealloc_fclose"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF915:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF862:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF885:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1246:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1259:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1000:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1571:
+	.string	"inertia"
+.LASF1157:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF991:
+	.string	"__DECL_SIMD_logf128x "
+.LASF953:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF725:
+	.string	"__FILE_defined 1"
+.LASF1097:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1312:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1309:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1407:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF874:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1403:
+	.string	"uint8_t"
+.LASF1183:
+	.string	"__DECL_SIMD_tanhf "
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF750:
+	.string	"L_ctermid 9"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1562:
+	.string	"stage"
+.LASF715:
+	.string	"NULL"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1249:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF933:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1456:
+	.string	"profileStageStats_s"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF1018:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1005:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1210:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1172:
+	.string	"__DECL_SIMD_erf "
+.LASF849:
+	.string	"__dev_t_defined "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF806:
+	.string	"_GCC_WCHAR_T "
+.LASF1488:
+	.string	"TASK_PRIORITY_LOW"
+.LASF1220:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF832:
+	.string	"__WCOREFLAG 0x80"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1417:
+	.string	"_IO_save_base"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1019:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1335:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF694:
+	.string	"__need_size_t "
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1072:
+	.string	"__DECL_SIMD_cosh "
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF962:
+	.string	"__DECL_SIMD_sin "
+.LASF934:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF809:
+	.string	"_BSD_WCHAR_T_"
+.LASF1158:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1120:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1444:
+	.string	"PROFILE_STAGE_IMU"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF764:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1590:
+	.string	"rotateBodyToEarth"
+.LASF1370:
+	.string	"SITL_MASS 1.0f"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1413:
+	.string	"_IO_write_ptr"
+.LASF1559:
+	.string	"command"
+.LASF877:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1036:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1224:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1427:
+	.string	"_shortbuf"
+.LASF1491:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF1074:
+	.string	"__DECL_SIMD_coshl "
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1159:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1532:
+	.string	"simulatedUntilUs"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1362:
+	.string	"STATE(mask) (stateFlags & mask)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1566:
+	.string	"stepModel"
+.LASF1055:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF1575:
+	.string	"earthForce"
+.LASF990:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1431:
+	.string	"_wide_data"
+.LASF1516:
+	.string	"velocity"
+.LASF1252:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF835:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1332:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1026:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1108:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF896:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1534:
+	.string	"logIntervalUs"
+.LASF1149:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1085:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF866:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF1109:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF763:
+	.string	"__f128(x) x ##f128"
+.LASF1165:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1254:
+	.string	"_Mdouble_ long double"
+.LASF965:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF872:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1452:
+	.string	"PROFILE_STAGE_BLACKBOX"
+.LASF720:
+	.string	"__GNUC_VA_LIST "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1206:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF918:
+	.string	"__fsfilcnt_t_defined "
+.LASF812:
+	.string	"WNOHANG 1"
+.LASF1117:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF927:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1585:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1351:
+	.string	"PROFILE_HISTOGRAM_BUCKET_COUNT 10"
+.LASF1213:
+	.string	"__DECL_SIMD_tanf "
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF777:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1123:
+	.string	"__DECL_SIMD_log10f "
+.LASF954:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1454:
+	.string	"profileStage_e"
+.LASF748:
+	.string	"TMP_MAX 238328"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF814:
+	.string	"WSTOPPED 2"
+.LASF1514:
+	.string	"sitlState_s"
+.LASF1520:
+	.string	"sitlState_t"
+.LASF1490:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF1537:
+	.string	"getProfileStageName"
+.LASF941:
+	.string	"__have_pthread_attr_t 1"
+.LASF1526:
+	.string	"pitch"
+.LASF1544:
+	.string	"strtoul"
+.LASF815:
+	.string	"WEXITED 4"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1581:
+	.string	"channel"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF462:
+	.string	"__PMT"
+.LASF807:
+	.string	"_WCHAR_T_DECLARED "
+.LASF828:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF931:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1533:
+	.string	"durationUs"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1180:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1305:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1209:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1133:
+	.string	"__DECL_SIMD_log2f "
+.LASF908:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1468:
+	.string	"armingFlags"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1182:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1583:
+	.string	"defaultValue"
+.LASF982:
+	.string	"__DECL_SIMD_log "
+.LASF1550:
+	.string	"atan2f"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF761:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF735:
+	.string	"__off_t_defined "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1023:
+	.string	"__DECL_SIMD_atanf "
+.LASF884:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF816:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF986:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF1122:
+	.string	"__DECL_SIMD_log10 "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1031:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF799:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1592:
+	.string	"puts"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF472:
+	.string	"__P(args) args"
+.LASF744:
+	.string	"SEEK_END 2"
+.LASF1449:
+	.string	"PROFILE_STAGE_SERIAL"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF1082:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1406:
+	.string	"uint64_t"
+.LASF1546:
+	.string	"memset"
+.LASF1262:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1201:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF729:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF930:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1148:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1582:
+	.string	"name"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1322:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1521:
+	.string	"sitlState"
+.LASF1401:
+	.string	"int8_t"
+.LASF1419:
+	.string	"_IO_save_end"
+.LASF903:
+	.string	"__suseconds_t_defined "
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF920:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF912:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pl "
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF693:
+	.string	"_STDIO_H 1"
+.LASF1071:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1504:
+	.string	"TASK_SYSTEM"
+.LASF976:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF895:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF717:
+	.string	"__need_NULL"
+.LASF1192:
+	.string	"__DECL_SIMD_asinh "
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1467:
+	.string	"stdout"
+.LASF897:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1093:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1227:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1038:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1006:
+	.string	"__DECL_SIMD_powf32 "
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1137:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1022:
+	.string	"__DECL_SIMD_atan "
+.LASF1068:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1270:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1433:
+	.string	"_freeres_buf"
+.LASF723:
+	.string	"_____fpos64_t_defined 1"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1056:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF1487:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF1494:
+	.string	"taskName"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF749:
+	.string	"FILENAME_MAX 4096"
+.LASF1039:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1316:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p "
+.LASF946:
+	.string	"_STRING_H 1"
+.LASF1214:
+	.string	"__DECL_SIMD_tanl "
+.LASF1069:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1402:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1387:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1482:
+	.string	"pitchDeciDegrees"
+.LASF1389:
+	.string	"signed char"
+.LASF778:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF987:
+	.string	"__DECL_SIMD_logf64 "
+.LASF970:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1086:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1450:
+	.string	"PROFILE_STAGE_TELEMETRY"
+.LASF696:
+	.string	"__size_t__ "
+.LASF1480:
+	.string	"rollAndPitchInclination_s"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1359:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & mask)"
+.LASF803:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1524:
+	.string	"atMs"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1505:
+	.string	"TASK_GYROPID"
+.LASF860:
+	.string	"__time_t_defined 1"
+.LASF887:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF879:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF741:
+	.string	"EOF (-1)"
+.LASF1166:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1170:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF966:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1138:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1458:
+	.string	"count"
+.LASF1274:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1446:
+	.string	"PROFILE_STAGE_PID"
+.LASF940:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF780:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1317:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF919:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF820:
+	.string	"__WCLONE 0x80000000"
+.LASF1399:
+	.string	"__off64_t"
+.LASF1134:
+	.string	"__DECL_SIMD_log2l "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF914:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1411:
+	.string	"_IO_read_base"
+.LASF836:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF769:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1429:
+	.string	"_offset"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1481:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1256:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1416:
+	.string	"_IO_buf_end"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1342:
+	.string	"USE_USART1 "
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1347:
+	.string	"BLACKBOX "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1195:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1301:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF978:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF988:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1110:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1320:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1308:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1360:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1234:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1412:
+	.string	"_IO_write_base"
+.LASF916:
+	.string	"__blkcnt_t_defined "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF979:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1253:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1464:
+	.string	"OK_TO_ARM"
+.LASF1168:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF779:
+	.string	"__f32(x) x ##f32"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF944:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF759:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF1489:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF871:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1451:
+	.string	"PROFILE_STAGE_LEDSTRIP"
+.LASF995:
+	.string	"__DECL_SIMD_expf16 "
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF1368:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF752:
+	.string	"FOPEN_MAX 16"
+.LASF1169:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1536:
+	.string	"nextSerialPollAtUs"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF768:
+	.string	"__HAVE_FLOAT64 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1511:
+	.string	"TASK_BLACKBOX"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1396:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF731:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1135:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF1171:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF1438:
+	.string	"_IO_marker"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF753:
+	.string	"stdin stdin"
+.LASF1147:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF924:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF902:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF844:
+	.string	"EXIT_SUCCESS 0"
+.LASF1099:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1238:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF1529:
+	.string	"motorLayout"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1507:
+	.string	"TASK_SERIAL"
+.LASF1357:
+	.string	"DISABLE_FLIGHT_MODE(mask) (flightModeFlags &= ~(mask))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1102:
+	.string	"__DECL_SIMD_cbrt "
+.LASF754:
+	.string	"stdout stdout"
+.LASF751:
+	.string	"FOPEN_MAX"
+.LASF1339:
+	.string	"USE_ACC_SITL "
+.LASF1397:
+	.string	"__uint64_t"
+.LASF1244:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1405:
+	.string	"uint32_t"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1034:
+	.string	"__DECL_SIMD_asinl "
+.LASF1439:
+	.string	"_IO_codecvt"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1465:
+	.string	"PREVENT_ARMING"
+.LASF1572:
+	.string	"gyroscopic"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1132:
+	.string	"__DECL_SIMD_log2 "
+.LASF732:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1552:
+	.string	"nowMs"
+.LASF1151:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF1321:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF784:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF906:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1161:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1515:
+	.string	"position"
+.LASF1190:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF485:
+	.string	"__flexarr []"
+.LASF786:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1002:
+	.string	"__DECL_SIMD_pow "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1385:
+	.string	"long unsigned int"
+.LASF1348:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1519:
+	.string	"motorSpeed"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF900:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF796:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1506:
+	.string	"TASK_RX"
+.LASF971:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF842:
+	.string	"RAND_MAX 2147483647"
+.LASF808:
+	.string	"__DEFINED_wchar_t "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1561:
+	.string	"taskId"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1512:
+	.string	"TASK_COUNT"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF787:
+	.string	"_BITS_STDIO_H 1"
+.LASF1400:
+	.string	"char"
+.LASF925:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1473:
+	.string	"PIDPOS"
+.LASF1128:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1188:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF772:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1377:
+	.string	"SITL_LINEAR_DRAG 0.25f"
+.LASF958:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1125:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF1042:
+	.string	"__DECL_SIMD_hypot "
+.LASF1229:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1354:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF813:
+	.string	"WUNTRACED 2"
+.LASF1547:
+	.string	"asinf"
+.LASF890:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF957:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1129:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1021:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1496:
+	.string	"staticPriority"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF391:
+	.string	"true 1"
+.LASF959:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1013:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF999:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1196:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1435:
+	.string	"_mode"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1518:
+	.string	"specificForce"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF767:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1455:
+	.string	"_IO_FILE"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF713:
+	.string	"__size_t "
+.LASF695:
+	.string	"__need_NULL "
+.LASF1101:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1363:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1440:
+	.string	"_IO_wide_data"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1208:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1037:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1193:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF939:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1508:
+	.string	"TASK_CONFIG"
+.LASF1462:
+	.string	"histogram"
+.LASF1498:
+	.string	"maxExecutionTime"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1358:
+	.string	"ENABLE_FLIGHT_MODE(mask) (flightModeFlags |= mask)"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1554:
+	.string	"pulse"
+.LASF898:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1063:
+	.string	"__DECL_SIMD_exp10f "
+.LASF996:
+	.string	"__DECL_SIMD_expf32 "
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF810:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1223:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF840:
+	.string	"__ldiv_t_defined 1"
+.LASF1027:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1219:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1162:
+	.string	"__DECL_SIMD_acosh "
+.LASF1218:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1522:
+	.string	"spin"
+.LASF371:
+	.string	"__linux 1"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1318:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF775:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF855:
+	.string	"__id_t_defined "
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1119:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1075:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1304:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF937:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF829:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1236:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF936:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF856:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1207:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1376:
+	.string	"SITL_YAW_TORQUE_PER_THRUST 0.016f"
+.LASF1548:
+	.string	"fmaxf"
+.LASF1420:
+	.string	"_markers"
+.LASF819:
+	.string	"__WALL 0x40000000"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF869:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF883:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1012:
+	.string	"__DECL_SIMD_acos "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1569:
+	.string	"torque"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1083:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1107:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF989:
+	.string	"__DECL_SIMD_logf32x "
+.LASF922:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF831:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1466:
+	.string	"ARMED"
+.LASF755:
+	.string	"stderr stderr"
+.LASF1315:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF846:
+	.string	"_SYS_TYPES_H 1"
+.LASF1541:
+	.string	"sqrtf"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1015:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF886:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1112:
+	.string	"__DECL_SIMD_atan2 "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF788:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF867:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1242:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF870:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1185:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1356:
+	.string	"ARMING_FLAG(mask) (armingFlags & mask)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1189:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF800:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1060:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF757:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF841:
+	.string	"__lldiv_t_defined 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1303:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF929:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1230:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1395:
+	.string	"__uint32_t"
+.LASF1540:
+	.string	"printf"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF1066:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1200:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF826:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF1361:
+	.string	"ENABLE_STATE(mask) (stateFlags |= mask)"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1509:
+	.string	"TASK_BARO"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1014:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF792:
+	.string	"__need_wchar_t "
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF765:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1239:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1150:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1003:
+	.string	"__DECL_SIMD_powf "
+.LASF818:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF797:
+	.string	"_T_WCHAR "
+.LASF1009:
+	.string	"__DECL_SIMD_powf32x "
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1373:
+	.string	"SITL_INERTIA_Z 0.0095f"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1510:
+	.string	"TASK_ALTITUDE"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1538:
+	.string	"getProfileStageAverageCycles"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1032:
+	.string	"__DECL_SIMD_asin "
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1272:
+	.string	"__MATHCALL"
+.LASF1126:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1194:
+	.string	"__DECL_SIMD_asinhl "
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF923:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1453:
+	.string	"PROFILE_STAGE_COUNT"
+.LASF942:
+	.string	"_ALLOCA_H 1"
+.LASF1062:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1264:
+	.string	"_Mdouble_ _Float32x"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1319:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1327:
+	.string	"__enable_irq() "
+.LASF1179:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1152:
+	.string	"__DECL_SIMD_atanh "
+.LASF1379:
+	.string	"SITL_GRAVITY 9.80665f"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1064:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1365:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF798:
+	.string	"__WCHAR_T "
+.LASF1588:
+	.string	"sitlSerialPoll"
+.LASF847:
+	.string	"__u_char_defined "
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1081:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1043:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF1503:
+	.string	"cfTaskInfo_t"
+.LASF824:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF977:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF907:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1499:
+	.string	"totalExecutionTime"
+.LASF1028:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF774:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1266:
+	.string	"_Mdouble_ _Float64x"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1334:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF1442:
+	.string	"long long unsigned int"
+.LASF848:
+	.string	"__ino_t_defined "
+.LASF1121:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1425:
+	.string	"_cur_column"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1007:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF973:
+	.string	"__DECL_SIMD_sincosf "
+.LASF721:
+	.string	"_____fpos_t_defined 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1029:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF1057:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1053:
+	.string	"__DECL_SIMD_exp2f "
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF969:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1222:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF758:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1325:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1257:
+	.string	"_Mdouble_ _Float32"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF822:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1143:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1418:
+	.string	"_IO_backup_base"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1460:
+	.string	"maxCycles"
+.LASF1080:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1087:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1409:
+	.string	"_IO_read_ptr"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF740:
+	.string	"BUFSIZ 8192"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF1191:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF839:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1076:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1050:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1539:
+	.string	"getProfileStageStats"
+.LASF1167:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF967:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF1545:
+	.string	"getenv"
+.LASF1432:
+	.string	"_freeres_list"
+.LASF724:
+	.string	"____FILE_defined 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1215:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF913:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF776:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1010:
+	.string	"__DECL_SIMD_powf64x "
+.LASF960:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1500:
+	.string	"averageExecutionTime"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1024:
+	.string	"__DECL_SIMD_atanl "
+.LASF921:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1372:
+	.string	"SITL_INERTIA_XY 0.0055f"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1424:
+	.string	"_old_offset"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1367:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1155:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1178:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1061:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1095:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1574:
+	.string	"bodyForce"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF881:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1103:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1004:
+	.string	"__DECL_SIMD_powl "
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF910:
+	.string	"NFDBITS __NFDBITS"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1557:
+	.string	"timeUs"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1423:
+	.string	"_flags2"
+.LASF1186:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF843:
+	.string	"EXIT_FAILURE 1"
+.LASF382:
+	.string	"__REVISION__ \"3713bc5\""
+.LASF833:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1260:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1565:
+	.string	"logState"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF730:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF859:
+	.string	"__clockid_t_defined 1"
+.LASF1459:
+	.string	"minCycles"
+.LASF1382:
+	.string	"SITL_DEFAULT_LOG_INTERVAL_MS 100"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF935:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF823:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1374:
+	.string	"SITL_MOTOR_MAX_THRUST 8.0f"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1475:
+	.string	"PIDNAVR"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF738:
+	.string	"_IOLBF 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1314:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1344:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF938:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1044:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF955:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF834:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1380:
+	.string	"SITL_STEP_US 250"
+.LASF737:
+	.string	"_IOFBF 0"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1329:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1326:
+	.string	"__disable_irq() "
+.LASF1479:
+	.string	"PID_ITEM_COUNT"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1573:
+	.string	"norm"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF974:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1181:
+	.string	"__DECL_SIMD_erff128x "
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1228:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1225:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1393:
+	.string	"short int"
+.LASF1485:
+	.string	"rollAndPitchInclination_t"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1054:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1240:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF1390:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1501:
+	.string	"latestDeltaTime"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF743:
+	.string	"SEEK_CUR 1"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1589:
+	.string	"sitlGetRcChannel"
+.LASF1388:
+	.string	"unsigned int"
+.LASF1046:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF892:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1211:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1576:
+	.string	"earthAcceleration"
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1543:
+	.string	"fflush"
+.LASF1250:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1530:
+	.string	"rcScript"
+.LASF1113:
+	.string	"__DECL_SIMD_atan2f "
+.LASF972:
+	.string	"__DECL_SIMD_sincos "
+.LASF1184:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1065:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_sinf "
+.LASF1115:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF998:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1517:
+	.string	"rate"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1426:
+	.string	"_vtable_offset"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1268:
+	.string	"__MATHDECL_1_IMPL"
+.LASF909:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1535:
+	.string	"nextLogAtUs"
+.LASF1231:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1204:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1493:
+	.string	"cfTaskPriority_e"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1586:
+	.string	"_IO_lock_t"
+.LASF766:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1016:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF739:
+	.string	"_IONBF 2"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF837:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1302:
+	.string	"M_E 2.7182818284590452354"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1580:
+	.string	"conjugate"
+.LASF1198:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1328:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1104:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/target/SITL/sitl.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10094 @@
+	.file	"sitl_drivers.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/target/SITL/sitl_drivers.c"
+	.section	.text.sitlGyroReadTemp,"ax",@progbits
+	.p2align 4
+	.type	sitlGyroReadTemp, @function
+sitlGyroReadTemp:
+.LVL0:
+.LFB3:
+	.file 1 ".//src/main/target/SITL/sitl_drivers.c"
+	.loc 1 74 1 view -0
+	.cfi_startproc
+	.loc 1 75 5 view .LVU1
+	.loc 1 75 15 is_stmt 0 view .LVU2
+	movl	$250, %eax
+	movw	%ax, (%rdi)
+	.loc 1 76 1 view .LVU3
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	sitlGyroReadTemp, .-sitlGyroReadTemp
+	.section	.text.sitlAccInit,"ax",@progbits
+	.p2align 4
+	.type	sitlAccInit, @function
+sitlAccInit:
+.LFB5:
+	.loc 1 91 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 92 5 view .LVU5
+	.loc 1 92 12 is_stmt 0 view .LVU6
+	movl	$4096, %eax
+	movw	%ax, acc_1G(%rip)
+	.loc 1 93 1 view .LVU7
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	sitlAccInit, .-sitlAccInit
+	.section	.text.sitlBaroCalculate,"ax",@progbits
+	.p2align 4
+	.type	sitlBaroCalculate, @function
+sitlBaroCalculate:
+.LVL1:
+.LFB9:
+	.loc 1 117 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 119 5 view .LVU9
+	.loc 1 120 5 view .LVU10
+	.loc 1 117 1 is_stmt 0 view .LVU11
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbx
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 120 8 view .LVU12
+	testq	%rdi, %rdi
+	je	.L5
+	.loc 1 121 64 view .LVU13
+	movss	.LC5(%rip), %xmm1
+	mulss	8+sitlState(%rip), %xmm1
+	movq	%rdi, %rbp
+	.loc 1 121 9 is_stmt 1 view .LVU14
+	.loc 1 121 40 is_stmt 0 view .LVU15
+	movss	.LC2(%rip), %xmm0
+	subss	%xmm1, %xmm0
+	movss	.LC3(%rip), %xmm1
+	call	powf@PLT
+.LVL2:
+	.loc 1 121 21 view .LVU16
+	mulss	.LC4(%rip), %xmm0
+	call	lrintf@PLT
+.LVL3:
+	.loc 1 121 19 view .LVU17
+	movl	%eax, 0(%rbp)
+.LVL4:
+.L5:
+	.loc 1 123 5 is_stmt 1 view .LVU18
+	.loc 1 123 8 is_stmt 0 view .LVU19
+	testq	%rbx, %rbx
+	je	.L4
+	.loc 1 124 9 is_stmt 1 view .LVU20
+	.loc 1 124 22 is_stmt 0 view .LVU21
+	movl	$2500, (%rbx)
+.L4:
+	.loc 1 126 1 view .LVU22
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL5:
+	.loc 1 126 1 view .LVU23
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	sitlBaroCalculate, .-sitlBaroCalculate
+	.section	.text.sitlGyroInit,"ax",@progbits
+	.p2align 4
+	.type	sitlGyroInit, @function
+sitlGyroInit:
+.LFB26:
+	.cfi_startproc
+	.loc 1 60 13 is_stmt 1 view -0
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	sitlGyroInit, .-sitlGyroInit
+	.section	.text.sitlBaroNop,"ax",@progbits
+	.p2align 4
+	.type	sitlBaroNop, @function
+sitlBaroNop:
+.LFB28:
+	.cfi_startproc
+	.loc 1 112 13 view -0
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	sitlBaroNop, .-sitlBaroNop
+	.section	.text.sitlGyroRead,"ax",@progbits
+	.p2align 4
+	.type	sitlGyroRead, @function
+sitlGyroRead:
+.LVL6:
+.LFB2:
+	.loc 1 65 1 view -0
+	.cfi_startproc
+	.loc 1 66 5 view .LVU27
+	.loc 1 68 5 view .LVU28
+.LBB8:
+.LBI8:
+	.loc 1 55 16 view .LVU29
+.LBB9:
+	.loc 1 57 5 view .LVU30
+.LBE9:
+.LBE8:
+	.loc 1 68 18 is_stmt 0 view .LVU31
+	movss	.LC6(%rip), %xmm0
+	mulss	40+sitlState(%rip), %xmm0
+.LVL7:
+	.loc 1 65 1 view .LVU32
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 65 1 view .LVU33
+	movq	%rdi, %rbx
+.LBB13:
+.LBB10:
+	.loc 1 57 23 view .LVU34
+	call	lrintf@PLT
+.LVL8:
+	.loc 1 57 12 view .LVU35
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL9:
+	.loc 1 57 12 view .LVU36
+.LBE10:
+.LBE13:
+	.loc 1 69 32 view .LVU37
+	movss	.LC0(%rip), %xmm3
+.LBB14:
+.LBB11:
+	.loc 1 57 12 view .LVU38
+	cvttss2sil	%xmm0, %eax
+.LBE11:
+.LBE14:
+	.loc 1 69 32 view .LVU39
+	movss	44+sitlState(%rip), %xmm0
+	xorps	%xmm3, %xmm0
+	.loc 1 69 18 view .LVU40
+	mulss	.LC6(%rip), %xmm0
+.LBB15:
+.LBB12:
+	.loc 1 57 12 view .LVU41
+	movw	%ax, (%rbx)
+.LBE12:
+.LBE15:
+	.loc 1 69 5 is_stmt 1 view .LVU42
+.LVL10:
+.LBB16:
+.LBI16:
+	.loc 1 55 16 view .LVU43
+.LBB17:
+	.loc 1 57 5 view .LVU44
+	.loc 1 57 23 is_stmt 0 view .LVU45
+	call	lrintf@PLT
+.LVL11:
+	.loc 1 57 12 view .LVU46
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL12:
+	.loc 1 57 12 view .LVU47
+.LBE17:
+.LBE16:
+	.loc 1 70 32 view .LVU48
+	movss	.LC0(%rip), %xmm3
+.LBB20:
+.LBB18:
+	.loc 1 57 12 view .LVU49
+	cvttss2sil	%xmm0, %eax
+.LBE18:
+.LBE20:
+	.loc 1 70 32 view .LVU50
+	movss	48+sitlState(%rip), %xmm0
+	xorps	%xmm3, %xmm0
+	.loc 1 70 18 view .LVU51
+	mulss	.LC6(%rip), %xmm0
+.LBB21:
+.LBB19:
+	.loc 1 57 12 view .LVU52
+	movw	%ax, 2(%rbx)
+.LBE19:
+.LBE21:
+	.loc 1 70 5 is_stmt 1 view .LVU53
+.LVL13:
+.LBB22:
+.LBI22:
+	.loc 1 55 16 view .LVU54
+.LBB23:
+	.loc 1 57 5 view .LVU55
+	.loc 1 57 23 is_stmt 0 view .LVU56
+	call	lrintf@PLT
+.LVL14:
+	.loc 1 57 12 view .LVU57
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL15:
+	.loc 1 57 12 view .LVU58
+	cvttss2sil	%xmm0, %eax
+	movw	%ax, 4(%rbx)
+.LBE23:
+.LBE22:
+	.loc 1 71 1 view .LVU59
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL16:
+	.loc 1 71 1 view .LVU60
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	sitlGyroRead, .-sitlGyroRead
+	.section	.text.sitlAccRead,"ax",@progbits
+	.p2align 4
+	.type	sitlAccRead, @function
+sitlAccRead:
+.LVL17:
+.LFB6:
+	.loc 1 96 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 97 5 view .LVU62
+	.loc 1 99 5 view .LVU63
+.LBB30:
+.LBI30:
+	.loc 1 55 16 view .LVU64
+.LBB31:
+	.loc 1 57 5 view .LVU65
+.LBE31:
+.LBE30:
+	.loc 1 99 17 is_stmt 0 view .LVU66
+	movss	.LC9(%rip), %xmm0
+	mulss	52+sitlState(%rip), %xmm0
+.LVL18:
+	.loc 1 96 1 view .LVU67
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 96 1 view .LVU68
+	movq	%rdi, %rbx
+.LBB35:
+.LBB32:
+	.loc 1 57 23 view .LVU69
+	call	lrintf@PLT
+.LVL19:
+	.loc 1 57 12 view .LVU70
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL20:
+	.loc 1 57 12 view .LVU71
+.LBE32:
+.LBE35:
+	.loc 1 100 31 view .LVU72
+	movss	.LC0(%rip), %xmm3
+.LBB36:
+.LBB33:
+	.loc 1 57 12 view .LVU73
+	cvttss2sil	%xmm0, %eax
+.LBE33:
+.LBE36:
+	.loc 1 100 31 view .LVU74
+	movss	56+sitlState(%rip), %xmm0
+	xorps	%xmm3, %xmm0
+	.loc 1 100 17 view .LVU75
+	mulss	.LC9(%rip), %xmm0
+.LBB37:
+.LBB34:
+	.loc 1 57 12 view .LVU76
+	movw	%ax, (%rbx)
+.LBE34:
+.LBE37:
+	.loc 1 100 5 is_stmt 1 view .LVU77
+.LVL21:
+.LBB38:
+.LBI38:
+	.loc 1 55 16 view .LVU78
+.LBB39:
+	.loc 1 57 5 view .LVU79
+	.loc 1 57 23 is_stmt 0 view .LVU80
+	call	lrintf@PLT
+.LVL22:
+	.loc 1 57 12 view .LVU81
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL23:
+	.loc 1 57 12 view .LVU82
+.LBE39:
+.LBE38:
+	.loc 1 101 31 view .LVU83
+	movss	.LC0(%rip), %xmm3
+.LBB42:
+.LBB40:
+	.loc 1 57 12 view .LVU84
+	cvttss2sil	%xmm0, %eax
+.LBE40:
+.LBE42:
+	.loc 1 101 31 view .LVU85
+	movss	60+sitlState(%rip), %xmm0
+	xorps	%xmm3, %xmm0
+	.loc 1 101 17 view .LVU86
+	mulss	.LC9(%rip), %xmm0
+.LBB43:
+.LBB41:
+	.loc 1 57 12 view .LVU87
+	movw	%ax, 2(%rbx)
+.LBE41:
+.LBE43:
+	.loc 1 101 5 is_stmt 1 view .LVU88
+.LVL24:
+.LBB44:
+.LBI44:
+	.loc 1 55 16 view .LVU89
+.LBB45:
+	.loc 1 57 5 view .LVU90
+	.loc 1 57 23 is_stmt 0 view .LVU91
+	call	lrintf@PLT
+.LVL25:
+	.loc 1 57 12 view .LVU92
+	pxor	%xmm0, %xmm0
+	movss	.LC7(%rip), %xmm2
+	movss	.LC8(%rip), %xmm1
+	cvtsi2ssq	%rax, %xmm0
+	call	constrainf@PLT
+.LVL26:
+	.loc 1 57 12 view .LVU93
+	cvttss2sil	%xmm0, %eax
+	movw	%ax, 4(%rbx)
+.LBE45:
+.LBE44:
+	.loc 1 102 1 view .LVU94
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL27:
+	.loc 1 102 1 view .LVU95
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	sitlAccRead, .-sitlAccRead
+	.section	.text.sitlGyroDetect,"ax",@progbits
+	.p2align 4
+	.globl	sitlGyroDetect
+	.type	sitlGyroDetect, @function
+sitlGyroDetect:
+.LVL28:
+.LFB4:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 5 view .LVU97
+	.loc 1 82 5 view .LVU98
+	.loc 1 83 5 view .LVU99
+	.loc 1 82 16 is_stmt 0 view .LVU100
+	leaq	sitlGyroRead(%rip), %rax
+	leaq	sitlGyroInit(%rip), %rdx
+	.loc 1 85 17 view .LVU101
+	movq	$1031389584, 24(%rdi)
+	.loc 1 82 16 view .LVU102
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	.loc 1 84 23 view .LVU103
+	leaq	sitlGyroReadTemp(%rip), %rax
+	.loc 1 82 16 view .LVU104
+	punpcklqdq	%xmm1, %xmm0
+	.loc 1 84 23 view .LVU105
+	movq	%rax, 16(%rdi)
+	.loc 1 88 1 view .LVU106
+	movl	$1, %eax
+	.loc 1 82 16 view .LVU107
+	movups	%xmm0, (%rdi)
+	.loc 1 84 5 is_stmt 1 view .LVU108
+	.loc 1 85 5 view .LVU109
+	.loc 1 86 5 view .LVU110
+	.loc 1 87 5 view .LVU111
+	.loc 1 88 1 is_stmt 0 view .LVU112
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	sitlGyroDetect, .-sitlGyroDetect
+	.section	.text.sitlAccDetect,"ax",@progbits
+	.p2align 4
+	.globl	sitlAccDetect
+	.type	sitlAccDetect, @function
+sitlAccDetect:
+.LVL29:
+.LFB7:
+	.loc 1 105 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 106 5 view .LVU114
+	.loc 1 107 5 view .LVU115
+	.loc 1 106 15 is_stmt 0 view .LVU116
+	leaq	sitlAccRead(%rip), %rax
+	leaq	sitlAccInit(%rip), %rdx
+	.loc 1 108 23 view .LVU117
+	movb	$0, 16(%rdi)
+	.loc 1 106 15 view .LVU118
+	movq	%rax, %xmm1
+	movq	%rdx, %xmm0
+	.loc 1 110 1 view .LVU119
+	movl	$1, %eax
+	.loc 1 106 15 view .LVU120
+	punpcklqdq	%xmm1, %xmm0
+	movups	%xmm0, (%rdi)
+	.loc 1 108 5 is_stmt 1 view .LVU121
+	.loc 1 109 5 view .LVU122
+	.loc 1 110 1 is_stmt 0 view .LVU123
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	sitlAccDetect, .-sitlAccDetect
+	.section	.text.sitlBaroDetect,"ax",@progbits
+	.p2align 4
+	.globl	sitlBaroDetect
+	.type	sitlBaroDetect, @function
+sitlBaroDetect:
+.LVL30:
+.LFB10:
+	.loc 1 129 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 129 1 is_stmt 0 view .LVU125
+	leaq	sitlBaroNop(%rip), %rax
+	movq	%rax, %xmm0
+	.loc 1 130 20 view .LVU126
+	movl	.LC10(%rip), %eax
+	punpcklqdq	%xmm0, %xmm0
+	.loc 1 130 5 is_stmt 1 view .LVU127
+	.loc 1 131 5 view .LVU128
+	.loc 1 130 20 is_stmt 0 view .LVU129
+	movl	%eax, (%rdi)
+	.loc 1 132 5 is_stmt 1 view .LVU130
+	.loc 1 133 5 view .LVU131
+	.loc 1 134 5 view .LVU132
+	.loc 1 135 5 view .LVU133
+	.loc 1 136 21 is_stmt 0 view .LVU134
+	leaq	sitlBaroCalculate(%rip), %rax
+	movq	%rax, 40(%rdi)
+	.loc 1 138 1 view .LVU135
+	movl	$1, %eax
+	.loc 1 132 20 view .LVU136
+	movups	%xmm0, 8(%rdi)
+	movups	%xmm0, 24(%rdi)
+	.loc 1 136 5 is_stmt 1 view .LVU137
+	.loc 1 137 5 view .LVU138
+	.loc 1 138 1 is_stmt 0 view .LVU139
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	sitlBaroDetect, .-sitlBaroDetect
+	.section	.text.adcInit,"ax",@progbits
+	.p2align 4
+	.globl	adcInit
+	.type	adcInit, @function
+adcInit:
+.LVL31:
+.LFB11:
+	.loc 1 141 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 142 5 view .LVU141
+	.loc 1 143 1 is_stmt 0 view .LVU142
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	adcInit, .-adcInit
+	.section	.text.adcGetChannel,"ax",@progbits
+	.p2align 4
+	.globl	adcGetChannel
+	.type	adcGetChannel, @function
+adcGetChannel:
+.LVL32:
+.LFB12:
+	.loc 1 146 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 147 5 view .LVU144
+	.loc 1 147 8 is_stmt 0 view .LVU145
+	testb	%dil, %dil
+	je	.L32
+	xorl	%eax, %eax
+	.loc 1 152 1 view .LVU146
+	ret
+	.p2align 4,,10
+	.p2align 3
+.L32:
+	.loc 1 151 5 is_stmt 1 view .LVU147
+	.loc 1 146 1 is_stmt 0 view .LVU148
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 151 12 view .LVU149
+	movss	.LC11(%rip), %xmm0
+	call	lrintf@PLT
+.LVL33:
+	.loc 1 152 1 view .LVU150
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	adcGetChannel, .-adcGetChannel
+	.section	.text.ledInit,"ax",@progbits
+	.p2align 4
+	.globl	ledInit
+	.type	ledInit, @function
+ledInit:
+.LFB13:
+	.loc 1 155 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 1 view .LVU152
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	ledInit, .-ledInit
+	.section	.text.timerInit,"ax",@progbits
+	.p2align 4
+	.globl	timerInit
+	.type	timerInit, @function
+timerInit:
+.LFB30:
+	.cfi_startproc
+	.loc 1 158 6 view -0
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	timerInit, .-timerInit
+	.section	.text.pwmInit,"ax",@progbits
+	.p2align 4
+	.globl	pwmInit
+	.type	pwmInit, @function
+pwmInit:
+.LVL34:
+.LFB15:
+	.loc 1 163 1 view -0
+	.cfi_startproc
+	.loc 1 164 5 view .LVU155
+	.loc 1 166 5 view .LVU156
+	.loc 1 168 5 view .LVU157
+	.loc 1 169 5 view .LVU158
+	.loc 1 169 39 is_stmt 0 view .LVU159
+	movzwl	.LC12(%rip), %eax
+	movw	%ax, pwmOutputConfiguration.0(%rip)
+	.loc 1 170 5 is_stmt 1 view .LVU160
+	.loc 1 171 1 is_stmt 0 view .LVU161
+	leaq	pwmOutputConfiguration.0(%rip), %rax
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	pwmInit, .-pwmInit
+	.section	.text.pwmWriteMotor,"ax",@progbits
+	.p2align 4
+	.globl	pwmWriteMotor
+	.type	pwmWriteMotor, @function
+pwmWriteMotor:
+.LVL35:
+.LFB16:
+	.loc 1 174 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 175 5 view .LVU163
+	movzwl	%si, %esi
+	.loc 1 175 5 is_stmt 0 view .LVU164
+	movzbl	%dil, %edi
+	.loc 1 175 5 view .LVU165
+	jmp	sitlSetMotor@PLT
+.LVL36:
+	.loc 1 175 5 view .LVU166
+	.cfi_endproc
+.LFE16:
+	.size	pwmWriteMotor, .-pwmWriteMotor
+	.section	.text.pwmCompleteMotorUpdate,"ax",@progbits
+	.p2align 4
+	.globl	pwmCompleteMotorUpdate
+	.type	pwmCompleteMotorUpdate, @function
+pwmCompleteMotorUpdate:
+.LVL37:
+.LFB17:
+	.loc 1 179 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 180 5 view .LVU168
+	.loc 1 181 1 is_stmt 0 view .LVU169
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	pwmCompleteMotorUpdate, .-pwmCompleteMotorUpdate
+	.section	.text.pwmWriteServo,"ax",@progbits
+	.p2align 4
+	.globl	pwmWriteServo
+	.type	pwmWriteServo, @function
+pwmWriteServo:
+.LVL38:
+.LFB18:
+	.loc 1 184 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 185 5 view .LVU171
+	.loc 1 186 5 view .LVU172
+	.loc 1 187 1 is_stmt 0 view .LVU173
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	pwmWriteServo, .-pwmWriteServo
+	.section	.text.pwmRxInit,"ax",@progbits
+	.p2align 4
+	.globl	pwmRxInit
+	.type	pwmRxInit, @function
+pwmRxInit:
+.LVL39:
+.LFB19:
+	.loc 1 190 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 191 5 view .LVU175
+	.loc 1 192 1 is_stmt 0 view .LVU176
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	pwmRxInit, .-pwmRxInit
+	.section	.text.pwmRead,"ax",@progbits
+	.p2align 4
+	.globl	pwmRead
+	.type	pwmRead, @function
+pwmRead:
+.LVL40:
+.LFB20:
+	.loc 1 195 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 196 5 view .LVU178
+	.loc 1 196 12 is_stmt 0 view .LVU179
+	movzbl	%dil, %edi
+	.loc 1 196 12 view .LVU180
+	jmp	sitlGetRcChannel@PLT
+.LVL41:
+	.loc 1 196 12 view .LVU181
+	.cfi_endproc
+.LFE20:
+	.size	pwmRead, .-pwmRead
+	.section	.text.isPPMDataBeingReceived,"ax",@progbits
+	.p2align 4
+	.globl	isPPMDataBeingReceived
+	.type	isPPMDataBeingReceived, @function
+isPPMDataBeingReceived:
+.LFB21:
+	.loc 1 200 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 201 5 view .LVU183
+	.loc 1 202 1 is_stmt 0 view .LVU184
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	isPPMDataBeingReceived, .-isPPMDataBeingReceived
+	.section	.text.resetPPMDataReceivedState,"ax",@progbits
+	.p2align 4
+	.globl	resetPPMDataReceivedState
+	.type	resetPPMDataReceivedState, @function
+resetPPMDataReceivedState:
+.LFB24:
+	.cfi_startproc
+	.loc 1 204 6 is_stmt 1 view -0
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	resetPPMDataReceivedState, .-resetPPMDataReceivedState
+	.section	.bss.pwmOutputConfiguration.0,"aw",@nobits
+	.align 2
+	.type	pwmOutputConfiguration.0, @object
+	.size	pwmOutputConfiguration.0, 2
+pwmOutputConfiguration.0:
+	.zero	2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.section	.rodata.cst4,"aM",@progbits,4
+	.align 4
+.LC2:
+	.long	1065353216
+	.align 4
+.LC3:
+	.long	1084764203
+	.align 4
+.LC4:
+	.long	1204151936
+	.align 4
+.LC5:
+	.long	-1212335541
+	.align 4
+.LC6:
+	.long	1147857318
+	.align 4
+.LC7:
+	.long	1191181824
+	.align 4
+.LC8:
+	.long	-956301312
+	.align 4
+.LC9:
+	.long	1137759871
+	.align 4
+.LC10:
+	.value	10000
+	.value	10000
+	.align 4
+.LC11:
+	.long	1151385870
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC12:
+	.byte	0
+	.byte	4
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 ".//src/main/drivers/accgyro.h"
+	.file 6 ".//src/main/drivers/barometer.h"
+	.file 7 ".//src/main/common/axis.h"
+	.file 8 ".//src/main/drivers/adc.h"
+	.file 9 ".//src/main/drivers/pwm_mapping.h"
+	.file 10 ".//src/main/drivers/pwm_rx.h"
+	.file 11 ".//src/main/target/SITL/sitl.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 13 ".//src/main/common/maths.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xba6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1285
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL14
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1164
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1165
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1166
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1167
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1168
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1169
+	.uleb128 0x2
+	.long	.LASF1170
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x2
+	.long	.LASF1171
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x70
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1172
+	.uleb128 0x2
+	.long	.LASF1173
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1174
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1175
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1176
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1177
+	.uleb128 0x2
+	.long	.LASF1178
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x2
+	.long	.LASF1182
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x22
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1183
+	.uleb128 0x12
+	.long	0x43
+	.byte	0x7
+	.long	0x10f
+	.uleb128 0x13
+	.string	"X"
+	.byte	0
+	.uleb128 0x13
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x13
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1247
+	.byte	0x5
+	.byte	0x14
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x5
+	.byte	0x16
+	.byte	0x10
+	.long	0x127
+	.uleb128 0x6
+	.long	0x12c
+	.uleb128 0x23
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x5
+	.byte	0x17
+	.byte	0x10
+	.long	0x139
+	.uleb128 0x6
+	.long	0x13e
+	.uleb128 0x16
+	.long	0x149
+	.uleb128 0x4
+	.long	0x149
+	.byte	0
+	.uleb128 0x6
+	.long	0xb0
+	.uleb128 0x9
+	.long	.LASF1192
+	.byte	0x20
+	.byte	0x5
+	.byte	0x19
+	.long	0x19c
+	.uleb128 0x1
+	.long	.LASF1186
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x17
+	.long	0x11b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x17
+	.long	0x12d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x17
+	.long	0x12d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x5
+	.byte	0x1d
+	.byte	0xb
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x5
+	.byte	0x1e
+	.byte	0xe
+	.long	0xe0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x3
+	.long	0x14e
+	.uleb128 0x9
+	.long	.LASF1193
+	.byte	0x18
+	.byte	0x5
+	.byte	0x21
+	.long	0x1dc
+	.uleb128 0x1
+	.long	.LASF1186
+	.byte	0x5
+	.byte	0x22
+	.byte	0x17
+	.long	0x11b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x5
+	.byte	0x23
+	.byte	0x17
+	.long	0x12d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x5
+	.byte	0x24
+	.byte	0xa
+	.long	0xa9
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3
+	.long	0x1a8
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x6
+	.byte	0x14
+	.byte	0x10
+	.long	0x127
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x6
+	.byte	0x15
+	.byte	0x10
+	.long	0x200
+	.uleb128 0x6
+	.long	0x205
+	.uleb128 0x16
+	.long	0x215
+	.uleb128 0x4
+	.long	0x215
+	.uleb128 0x4
+	.long	0x215
+	.byte	0
+	.uleb128 0x6
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF1198
+	.byte	0x30
+	.byte	0x6
+	.byte	0x17
+	.long	0x282
+	.uleb128 0x1
+	.long	.LASF1199
+	.byte	0x6
+	.byte	0x18
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1200
+	.byte	0x6
+	.byte	0x19
+	.byte	0xe
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x13
+	.long	0x1e8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0x1e8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x13
+	.long	0x1e8
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x13
+	.long	0x1e8
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x1f4
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1198
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x3
+	.long	0x21a
+	.uleb128 0x12
+	.long	0x43
+	.byte	0x8
+	.long	0x2b7
+	.uleb128 0xa
+	.long	.LASF1206
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1207
+	.byte	0x1
+	.uleb128 0xa
+	.long	.LASF1208
+	.byte	0x2
+	.uleb128 0xa
+	.long	.LASF1209
+	.byte	0x3
+	.uleb128 0xa
+	.long	.LASF1210
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1211
+	.uleb128 0x9
+	.long	.LASF1212
+	.byte	0x3
+	.byte	0x8
+	.byte	0x25
+	.long	0x2f2
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x8
+	.byte	0x26
+	.byte	0x9
+	.long	0x2b7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0x27
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0x8
+	.byte	0x28
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1212
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3
+	.long	0x2be
+	.uleb128 0x9
+	.long	.LASF1216
+	.byte	0x16
+	.byte	0x9
+	.byte	0x26
+	.long	0x3db
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x9
+	.byte	0x27
+	.byte	0x9
+	.long	0x2b7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x9
+	.byte	0x28
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x9
+	.byte	0x29
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0x9
+	.byte	0x2d
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x9
+	.byte	0x30
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x9
+	.byte	0x31
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0x9
+	.byte	0x32
+	.byte	0x9
+	.long	0x2b7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1226
+	.byte	0x9
+	.byte	0x33
+	.byte	0xe
+	.long	0xd4
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1227
+	.byte	0x9
+	.byte	0x34
+	.byte	0x9
+	.long	0x2b7
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0x9
+	.byte	0x35
+	.byte	0x9
+	.long	0x2b7
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0x9
+	.byte	0x36
+	.byte	0xe
+	.long	0xd4
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x9
+	.byte	0x37
+	.byte	0xe
+	.long	0xd4
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x9
+	.byte	0x38
+	.byte	0xe
+	.long	0xd4
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1232
+	.byte	0x9
+	.byte	0x3a
+	.byte	0xe
+	.long	0xd4
+	.byte	0x14
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1216
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x3
+	.long	0x2fe
+	.uleb128 0x9
+	.long	.LASF1233
+	.byte	0x2
+	.byte	0x9
+	.byte	0x3e
+	.long	0x40e
+	.uleb128 0x1
+	.long	.LASF1234
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1235
+	.byte	0x9
+	.byte	0x40
+	.byte	0xd
+	.long	0xc8
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1236
+	.byte	0x9
+	.byte	0x41
+	.byte	0x3
+	.long	0x3e7
+	.uleb128 0x12
+	.long	0x43
+	.byte	0xa
+	.long	0x431
+	.uleb128 0xa
+	.long	.LASF1237
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1238
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1239
+	.byte	0xa
+	.byte	0x17
+	.byte	0x3
+	.long	0x41a
+	.uleb128 0x9
+	.long	.LASF1240
+	.byte	0x50
+	.byte	0xb
+	.byte	0x1e
+	.long	0x496
+	.uleb128 0x1
+	.long	.LASF1241
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xb
+	.long	0x496
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1242
+	.byte	0xb
+	.byte	0x20
+	.byte	0xb
+	.long	0x496
+	.byte	0xc
+	.uleb128 0x24
+	.string	"q"
+	.byte	0xb
+	.byte	0x21
+	.byte	0xb
+	.long	0x4a6
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1243
+	.byte	0xb
+	.byte	0x22
+	.byte	0xb
+	.long	0x496
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1244
+	.byte	0xb
+	.byte	0x23
+	.byte	0xb
+	.long	0x496
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0xb
+	.byte	0x24
+	.byte	0xb
+	.long	0x4a6
+	.byte	0x40
+	.byte	0
+	.uleb128 0x17
+	.long	0x2e
+	.long	0x4a6
+	.uleb128 0x18
+	.long	0x4a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	0x2e
+	.long	0x4b6
+	.uleb128 0x18
+	.long	0x4a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1246
+	.byte	0xb
+	.byte	0x25
+	.byte	0x3
+	.long	0x43d
+	.uleb128 0x15
+	.long	.LASF1248
+	.byte	0xb
+	.byte	0x27
+	.byte	0x14
+	.long	0x4b6
+	.uleb128 0x14
+	.long	.LASF1249
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xa
+	.long	0xd4
+	.long	0x4e4
+	.uleb128 0x4
+	.long	0xc8
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1286
+	.byte	0xb
+	.byte	0x2b
+	.byte	0x6
+	.long	0x4fb
+	.uleb128 0x4
+	.long	0xc8
+	.uleb128 0x4
+	.long	0xd4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1250
+	.byte	0xc
+	.byte	0x8c
+	.byte	0xf
+	.long	0x2e
+	.long	0x516
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1251
+	.byte	0xd
+	.byte	0x2e
+	.byte	0x7
+	.long	0x2e
+	.long	0x536
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1252
+	.byte	0xc
+	.value	0x13d
+	.byte	0x11
+	.long	0xa2
+	.long	0x54d
+	.uleb128 0x4
+	.long	0x2e
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1263
+	.byte	0xcc
+	.uleb128 0x27
+	.long	.LASF1287
+	.byte	0x1
+	.byte	0xc7
+	.byte	0x5
+	.long	0x2b7
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF1261
+	.byte	0xc2
+	.byte	0xa
+	.long	0xd4
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5be
+	.uleb128 0x8
+	.long	.LASF1260
+	.byte	0xc2
+	.byte	0x1a
+	.long	0xc8
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1a
+	.quad	.LVL41
+	.long	0x4ce
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1253
+	.byte	0xbd
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5e8
+	.uleb128 0x7
+	.long	.LASF1255
+	.byte	0xbd
+	.byte	0x25
+	.long	0x431
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1254
+	.byte	0xb7
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x61f
+	.uleb128 0x7
+	.long	.LASF1256
+	.byte	0xb7
+	.byte	0x1c
+	.long	0xc8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.long	.LASF1257
+	.byte	0xb7
+	.byte	0x2c
+	.long	0xd4
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1258
+	.byte	0xb2
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x649
+	.uleb128 0x7
+	.long	.LASF1235
+	.byte	0xb2
+	.byte	0x25
+	.long	0xc8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1259
+	.byte	0xad
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6af
+	.uleb128 0x8
+	.long	.LASF1256
+	.byte	0xad
+	.byte	0x1c
+	.long	0xc8
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x8
+	.long	.LASF1257
+	.byte	0xad
+	.byte	0x2c
+	.long	0xd4
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1a
+	.quad	.LVL36
+	.long	0x4e4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1262
+	.byte	0xa2
+	.byte	0x1b
+	.long	0x6f4
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f4
+	.uleb128 0x7
+	.long	.LASF1186
+	.byte	0xa2
+	.byte	0x35
+	.long	0x6f9
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x28
+	.long	.LASF1274
+	.byte	0x1
+	.byte	0xa4
+	.byte	0x25
+	.long	0x40e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	pwmOutputConfiguration.0
+	.byte	0
+	.uleb128 0x6
+	.long	0x40e
+	.uleb128 0x6
+	.long	0x3db
+	.uleb128 0x19
+	.long	.LASF1264
+	.byte	0x9e
+	.uleb128 0x29
+	.long	.LASF1288
+	.byte	0x1
+	.byte	0x9a
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0xd
+	.long	.LASF1265
+	.byte	0x91
+	.byte	0xa
+	.long	0xd4
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x75b
+	.uleb128 0x8
+	.long	.LASF1260
+	.byte	0x91
+	.byte	0x20
+	.long	0xc8
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xb
+	.quad	.LVL33
+	.long	0x536
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x61
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x44a0c10e
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1266
+	.byte	0x8c
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x785
+	.uleb128 0x7
+	.long	.LASF1186
+	.byte	0x8c
+	.byte	0x20
+	.long	0x785
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x6
+	.long	0x2f2
+	.uleb128 0xd
+	.long	.LASF1267
+	.byte	0x80
+	.byte	0x5
+	.long	0x2b7
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b9
+	.uleb128 0x7
+	.long	.LASF1268
+	.byte	0x80
+	.byte	0x1c
+	.long	0x7b9
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x6
+	.long	0x282
+	.uleb128 0xf
+	.long	.LASF1271
+	.byte	0x74
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x837
+	.uleb128 0x8
+	.long	.LASF1269
+	.byte	0x74
+	.byte	0x28
+	.long	0x215
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x8
+	.long	.LASF1188
+	.byte	0x74
+	.byte	0x3b
+	.long	0x215
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x2a
+	.long	.LASF1289
+	.byte	0x1
+	.byte	0x77
+	.byte	0xb
+	.long	0x2e
+	.uleb128 0x2b
+	.quad	.LVL2
+	.long	0x4fb
+	.long	0x829
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x40a8302b
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL3
+	.long	0x536
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1283
+	.byte	0x70
+	.uleb128 0xd
+	.long	.LASF1270
+	.byte	0x68
+	.byte	0x5
+	.long	0x2b7
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x86c
+	.uleb128 0x1c
+	.string	"acc"
+	.byte	0x68
+	.byte	0x1a
+	.long	0x86c
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x6
+	.long	0x1dc
+	.uleb128 0xf
+	.long	.LASF1272
+	.byte	0x5f
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ad
+	.uleb128 0x8
+	.long	.LASF1273
+	.byte	0x5f
+	.byte	0x22
+	.long	0x149
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1d
+	.long	.LASF1275
+	.byte	0x61
+	.long	0xec
+	.byte	0x4
+	.long	0x43d0d67f
+	.uleb128 0x10
+	.long	0xb74
+	.quad	.LBI30
+	.byte	.LVU64
+	.long	.LLRL7
+	.byte	0x63
+	.byte	0x11
+	.long	0x906
+	.uleb128 0x1e
+	.long	0xb85
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xc
+	.quad	.LVL19
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL20
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xb74
+	.quad	.LBI38
+	.byte	.LVU78
+	.long	.LLRL9
+	.byte	0x64
+	.byte	0x11
+	.long	0x955
+	.uleb128 0x11
+	.long	0xb85
+	.uleb128 0xc
+	.quad	.LVL22
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL23
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0xb74
+	.quad	.LBI44
+	.byte	.LVU89
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.byte	0x65
+	.byte	0x11
+	.uleb128 0x11
+	.long	0xb85
+	.uleb128 0xc
+	.quad	.LVL25
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL26
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1290
+	.byte	0x1
+	.byte	0x5a
+	.byte	0xd
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF1276
+	.byte	0x4e
+	.byte	0x5
+	.long	0x2b7
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa03
+	.uleb128 0x7
+	.long	.LASF1277
+	.byte	0x4e
+	.byte	0x1c
+	.long	0xa03
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1c
+	.string	"lpf"
+	.byte	0x4e
+	.byte	0x2b
+	.long	0xd4
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x6
+	.long	0x19c
+	.uleb128 0xf
+	.long	.LASF1278
+	.byte	0x49
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa32
+	.uleb128 0x7
+	.long	.LASF1279
+	.byte	0x49
+	.byte	0x27
+	.long	0x149
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1280
+	.byte	0x40
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb6e
+	.uleb128 0x8
+	.long	.LASF1281
+	.byte	0x40
+	.byte	0x23
+	.long	0x149
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x1d
+	.long	.LASF1282
+	.byte	0x42
+	.long	0xec
+	.byte	0x4
+	.long	0x446ae9a6
+	.uleb128 0x10
+	.long	0xb74
+	.quad	.LBI8
+	.byte	.LVU29
+	.long	.LLRL3
+	.byte	0x44
+	.byte	0x12
+	.long	0xac7
+	.uleb128 0x1e
+	.long	0xb85
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xc
+	.quad	.LVL8
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL9
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xb74
+	.quad	.LBI16
+	.byte	.LVU43
+	.long	.LLRL5
+	.byte	0x45
+	.byte	0x12
+	.long	0xb16
+	.uleb128 0x11
+	.long	0xb85
+	.uleb128 0xc
+	.quad	.LVL11
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL12
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0xb74
+	.quad	.LBI22
+	.byte	.LVU54
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.byte	0x46
+	.byte	0x12
+	.uleb128 0x11
+	.long	0xb85
+	.uleb128 0xc
+	.quad	.LVL14
+	.long	0x536
+	.uleb128 0xb
+	.quad	.LVL15
+	.long	0x516
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x62
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0xc7000000
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x63
+	.uleb128 0x7
+	.byte	0xa4
+	.uleb128 0x2e
+	.byte	0x4
+	.long	0x46fffe00
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1284
+	.byte	0x3c
+	.uleb128 0x2d
+	.long	.LASF1291
+	.byte	0x1
+	.byte	0x37
+	.byte	0x10
+	.long	0xb0
+	.byte	0x1
+	.long	0xb92
+	.uleb128 0x2e
+	.long	.LASF1257
+	.byte	0x1
+	.byte	0x37
+	.byte	0x24
+	.long	0x2e
+	.byte	0
+	.uleb128 0x2f
+	.long	0x704
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL40
+	.byte	0x4
+	.uleb128 .LVL40-.LVL40
+	.uleb128 .LVL41-1-.LVL40
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL41-1-.LVL40
+	.uleb128 .LFE20-.LVL40
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL36-1-.LVL35
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-1-.LVL35
+	.uleb128 .LFE16-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU166
+	.uleb128 .LVU166
+	.uleb128 0
+.LLST12:
+	.byte	0x6
+	.quad	.LVL35
+	.byte	0x4
+	.uleb128 .LVL35-.LVL35
+	.uleb128 .LVL36-1-.LVL35
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-1-.LVL35
+	.uleb128 .LFE16-.LVL35
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL32
+	.byte	0x4
+	.uleb128 .LVL32-.LVL32
+	.uleb128 .LVL33-1-.LVL32
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-1-.LVL32
+	.uleb128 .LFE12-.LVL32
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-1-.LVL1
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.LVL1
+	.uleb128 .LVL4-.LVL1
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL4-.LVL1
+	.uleb128 .LFE9-.LVL1
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU16
+	.uleb128 .LVU16
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL1
+	.byte	0x4
+	.uleb128 .LVL1-.LVL1
+	.uleb128 .LVL2-1-.LVL1
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-1-.LVL1
+	.uleb128 .LVL5-.LVL1
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL5-.LVL1
+	.uleb128 .LFE9-.LVL1
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL17
+	.byte	0x4
+	.uleb128 .LVL17-.LVL17
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-1-.LVL17
+	.uleb128 .LVL27-.LVL17
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.LVL17
+	.uleb128 .LFE6-.LVL17
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+.LLST8:
+	.byte	0x8
+	.quad	.LVL18
+	.uleb128 .LVL19-1-.LVL18
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL6
+	.byte	0x4
+	.uleb128 .LVL6-.LVL6
+	.uleb128 .LVL8-1-.LVL6
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-1-.LVL6
+	.uleb128 .LVL16-.LVL6
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL16-.LVL6
+	.uleb128 .LFE2-.LVL6
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU32
+	.uleb128 .LVU35
+.LLST4:
+	.byte	0x8
+	.quad	.LVL7
+	.uleb128 .LVL8-1-.LVL7
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x17c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x5
+	.quad	.LBB8
+	.byte	0x4
+	.uleb128 .LBB8-.LBB8
+	.uleb128 .LBE8-.LBB8
+	.byte	0x4
+	.uleb128 .LBB13-.LBB8
+	.uleb128 .LBE13-.LBB8
+	.byte	0x4
+	.uleb128 .LBB14-.LBB8
+	.uleb128 .LBE14-.LBB8
+	.byte	0x4
+	.uleb128 .LBB15-.LBB8
+	.uleb128 .LBE15-.LBB8
+	.byte	0
+.LLRL5:
+	.byte	0x5
+	.quad	.LBB16
+	.byte	0x4
+	.uleb128 .LBB16-.LBB16
+	.uleb128 .LBE16-.LBB16
+	.byte	0x4
+	.uleb128 .LBB20-.LBB16
+	.uleb128 .LBE20-.LBB16
+	.byte	0x4
+	.uleb128 .LBB21-.LBB16
+	.uleb128 .LBE21-.LBB16
+	.byte	0
+.LLRL7:
+	.byte	0x5
+	.quad	.LBB30
+	.byte	0x4
+	.uleb128 .LBB30-.LBB30
+	.uleb128 .LBE30-.LBB30
+	.byte	0x4
+	.uleb128 .LBB35-.LBB30
+	.uleb128 .LBE35-.LBB30
+	.byte	0x4
+	.uleb128 .LBB36-.LBB30
+	.uleb128 .LBE36-.LBB30
+	.byte	0x4
+	.uleb128 .LBB37-.LBB30
+	.uleb128 .LBE37-.LBB30
+	.byte	0
+.LLRL9:
+	.byte	0x5
+	.quad	.LBB38
+	.byte	0x4
+	.uleb128 .LBB38-.LBB38
+	.uleb128 .LBE38-.LBB38
+	.byte	0x4
+	.uleb128 .LBB42-.LBB38
+	.uleb128 .LBE42-.LBB38
+	.byte	0x4
+	.uleb128 .LBB43-.LBB38
+	.uleb128 .LBE43-.LBB38
+	.byte	0
+.LLRL14:
+	.byte	0x7
+	.quad	.LFB3
+	.uleb128 .LFE3-.LFB3
+	.byte	0x7
+	.quad	.LFB5
+	.uleb128 .LFE5-.LFB5
+	.byte	0x7
+	.quad	.LFB9
+	.uleb128 .LFE9-.LFB9
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB2
+	.uleb128 .LFE2-.LFB2
+	.byte	0x7
+	.quad	.LFB6
+	.uleb128 .LFE6-.LFB6
+	.byte	0x7
+	.quad	.LFB4
+	.uleb128 .LFE4-.LFB4
+	.byte	0x7
+	.quad	.LFB7
+	.uleb128 .LFE7-.LFB7
+	.byte	0x7
+	.quad	.LFB10
+	.uleb128 .LFE10-.LFB10
+	.byte	0x7
+	.quad	.LFB11
+	.uleb128 .LFE11-.LFB11
+	.byte	0x7
+	.quad	.LFB12
+	.uleb128 .LFE12-.LFB12
+	.byte	0x7
+	.quad	.LFB13
+	.uleb128 .LFE13-.LFB13
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB15
+	.uleb128 .LFE15-.LFB15
+	.byte	0x7
+	.quad	.LFB16
+	.uleb128 .LFE16-.LFB16
+	.byte	0x7
+	.quad	.LFB17
+	.uleb128 .LFE17-.LFB17
+	.byte	0x7
+	.quad	.LFB18
+	.uleb128 .LFE18-.LFB18
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB20
+	.uleb128 .LFE20-.LFB20
+	.byte	0x7
+	.quad	.LFB21
+	.uleb128 .LFE21-.LFB21
+	.byte	0x7
+	.quad	.LFB24
+	.uleb128 .LFE24-.LFB24
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.file 30 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF972
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF999
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 39 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.file 40 ".//src/main/target/SITL/sitl_mcu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 41 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 42 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1130
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1138
+	.byte	0x4
+	.file 43 ".//src/main/drivers/gpio.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 44 ".//src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 45 ".//src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1149
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 46 ".//src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1158
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1163
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF964
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF971
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF993
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF998
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1001
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1003
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1018
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1018
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1028
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1019
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1020
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1021
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1092
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1102
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1121
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1129
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.maths.h.21.a376a4b68aeaa854a629a7684dd42ec9,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1137
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.gpio.h.109.7121d5cc57a281698f107996f4593bb2,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1142
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.light_led.h.31.b89a67316a7f14886dd5be52d67e7dfa,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1148
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pwm_mapping.h.20.6b03fe238617d7e272abe4aa318233de,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1157
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF772:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1068:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1259:
+	.string	"pwmWriteMotor"
+.LASF697:
+	.string	"__DECL_SIMD_cosl "
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF967:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF935:
+	.string	"__DECL_SIMD_asinh "
+.LASF975:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1040:
+	.string	"__MATHDECL_1_IMPL"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF980:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF933:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF802:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF987:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF728:
+	.string	"__DECL_SIMD_logf16 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1230:
+	.string	"servoPwmRate"
+.LASF826:
+	.string	"__DECL_SIMD_expm1f "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1013:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF900:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF821:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1245:
+	.string	"motorSpeed"
+.LASF791:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF485:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"__DECL_SIMD_hypotl "
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1179:
+	.string	"int32_t"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1242:
+	.string	"velocity"
+.LASF855:
+	.string	"__DECL_SIMD_atan2 "
+.LASF747:
+	.string	"__DECL_SIMD_powl "
+.LASF953:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF806:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1237:
+	.string	"INPUT_FILTERING_DISABLED"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1083:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1178:
+	.string	"int16_t"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1222:
+	.string	"useLEDStrip"
+.LASF1270:
+	.string	"sitlAccDetect"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF996:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF793:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF864:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1115:
+	.string	"USE_USART2 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF750:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1092:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF823:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1271:
+	.string	"sitlBaroCalculate"
+.LASF774:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1140:
+	.string	"digitalLo(p,i) { p->BRR = i; }"
+.LASF1161:
+	.string	"SITL_SEA_LEVEL_PRESSURE 101325.0f"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1099:
+	.string	"__enable_irq() "
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1109:
+	.string	"USE_GYRO_SITL "
+.LASF1228:
+	.string	"useDshot"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1076:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF721:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF472:
+	.string	"__P(args) args"
+.LASF949:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1082:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1134:
+	.string	"DEG2RAD(degrees) (degrees * RAD)"
+.LASF731:
+	.string	"__DECL_SIMD_logf128 "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1214:
+	.string	"enableCurrentMeter"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1139:
+	.string	"digitalHi(p,i) { p->BSRR = i; }"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF898:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1086:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF962:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1058:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1221:
+	.string	"useSoftSerial"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF974:
+	.string	"__HAVE_FLOAT32 1"
+.LASF956:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF763:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1199:
+	.string	"ut_delay"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1194:
+	.string	"revisionCode"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1220:
+	.string	"useVbat"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF733:
+	.string	"__DECL_SIMD_logf64x "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF885:
+	.string	"__DECL_SIMD_log1p "
+.LASF1227:
+	.string	"useOneshot"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1049:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1081:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1123:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF754:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1239:
+	.string	"inputFilteringMode_e"
+.LASF1036:
+	.string	"_Mdouble_ _Float32x"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF1273:
+	.string	"accADC"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1060:
+	.string	"FP_NAN 0"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF950:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1198:
+	.string	"baro_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1264:
+	.string	"timerInit"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF509:
+	.string	"__always_inline"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF822:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1008:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF717:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1234:
+	.string	"servoCount"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF981:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1176:
+	.string	"long int"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1001:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1048:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1043:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1072:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1023:
+	.string	"_Mdouble_ float"
+.LASF925:
+	.string	"__DECL_SIMD_tanh "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1035:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF896:
+	.string	"__DECL_SIMD_atanhf "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1017:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF807:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1020:
+	.string	"__MATH_PRECNAME"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF785:
+	.string	"__DECL_SIMD_hypot "
+.LASF1051:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF803:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF819:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF841:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1158:
+	.string	"SITL_MOTOR_COUNT 4"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1149:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 14"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF985:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF727:
+	.string	"__DECL_SIMD_logl "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1207:
+	.string	"ADC_RSSI"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1169:
+	.string	"signed char"
+.LASF876:
+	.string	"__DECL_SIMD_log2f "
+.LASF1180:
+	.string	"uint8_t"
+.LASF1022:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF989:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1042:
+	.string	"__MATHDECL_ALIAS"
+.LASF1160:
+	.string	"SITL_ACC_1G (512 * 8)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF758:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF884:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1148:
+	.string	"LED1_ON "
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1189:
+	.string	"scale"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1117:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF870:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1026:
+	.string	"_Mdouble_ long double"
+.LASF1165:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF735:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1118:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF789:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF856:
+	.string	"__DECL_SIMD_atan2f "
+.LASF730:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1019:
+	.string	"_Mdouble_"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1132:
+	.string	"RADX10 (M_PI / 1800.0f)"
+.LASF1156:
+	.string	"MAX_INPUTS 8"
+.LASF893:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1091:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1141:
+	.string	"digitalToggle(p,i) { p->ODR ^= i; }"
+.LASF995:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1097:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF998:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1211:
+	.string	"_Bool"
+.LASF784:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1223:
+	.string	"useServos"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1272:
+	.string	"sitlAccRead"
+.LASF1217:
+	.string	"useParallelPWM"
+.LASF1257:
+	.string	"value"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1269:
+	.string	"pressure"
+.LASF1218:
+	.string	"usePPM"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF828:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF971:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1078:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1277:
+	.string	"gyro"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1246:
+	.string	"sitlState_t"
+.LASF760:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1007:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF765:
+	.string	"__DECL_SIMD_atan "
+.LASF1274:
+	.string	"pwmOutputConfiguration"
+.LASF1069:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1066:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1031:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF938:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1151:
+	.string	"MAX_PWM_SERVOS 8"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF875:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1173:
+	.string	"__uint16_t"
+.LASF943:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF706:
+	.string	"__DECL_SIMD_sinf "
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF834:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF805:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1061:
+	.string	"FP_INFINITE 1"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF811:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF761:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF801:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1106:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF699:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1096:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1163:
+	.string	"SITL_BATTERY_VOLTAGE 11.4f"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF799:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1135:
+	.string	"min(a,b) ((a) < (b) ? (a) : (b))"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1205:
+	.string	"calculate"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF990:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF909:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF917:
+	.string	"__DECL_SIMD_erfl "
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1062:
+	.string	"FP_ZERO 2"
+.LASF1284:
+	.string	"sitlGyroInit"
+.LASF1018:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF1162:
+	.string	"SITL_TEMPERATURE 2500"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1088:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1103:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF739:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1063:
+	.string	"FP_SUBNORMAL 3"
+.LASF782:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF813:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1229:
+	.string	"dshotRate"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1143:
+	.string	"LED0_TOGGLE "
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1215:
+	.string	"enableExternal1"
+.LASF773:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF910:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1029:
+	.string	"_Mdouble_ _Float32"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1213:
+	.string	"enableRSSI"
+.LASF881:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF947:
+	.string	"__DECL_SIMD_erfcl "
+.LASF390:
+	.string	"bool _Bool"
+.LASF835:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1170:
+	.string	"__uint8_t"
+.LASF1266:
+	.string	"adcInit"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1107:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF769:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF897:
+	.string	"__DECL_SIMD_atanhl "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1021:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF882:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1225:
+	.string	"airplane"
+.LASF1015:
+	.string	"_Mdouble_ double"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1038:
+	.string	"_Mdouble_ _Float64x"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF946:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1243:
+	.string	"rate"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1145:
+	.string	"LED0_ON "
+.LASF887:
+	.string	"__DECL_SIMD_log1pl "
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1102:
+	.string	"U_ID_2 0"
+.LASF1153:
+	.string	"MAX_SERVOS 8"
+.LASF883:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF740:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1286:
+	.string	"sitlSetMotor"
+.LASF775:
+	.string	"__DECL_SIMD_asin "
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1028:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1282:
+	.string	"lsbPerRadian"
+.LASF1275:
+	.string	"lsbPerMss"
+.LASF979:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF860:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF824:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF796:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1067:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF850:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF877:
+	.string	"__DECL_SIMD_log2l "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF901:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF932:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF999:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1281:
+	.string	"gyroADC"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1000:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF704:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF752:
+	.string	"__DECL_SIMD_powf32x "
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF1291:
+	.string	"toSensorRange"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1039:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF978:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1185:
+	.string	"sensorReadFuncPtr"
+.LASF1065:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1204:
+	.string	"get_up"
+.LASF1260:
+	.string	"channel"
+.LASF701:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1202:
+	.string	"get_ut"
+.LASF749:
+	.string	"__DECL_SIMD_powf32 "
+.LASF906:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1004:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF830:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF868:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF738:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1009:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1057:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF753:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1071:
+	.string	"MATH_ERRNO 1"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF948:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1136:
+	.string	"max(a,b) ((a) > (b) ? (a) : (b))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1112:
+	.string	"BARO "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1116:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF848:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF963:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF964:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF814:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF756:
+	.string	"__DECL_SIMD_acosf "
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF726:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1224:
+	.string	"extraServos"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1089:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1206:
+	.string	"ADC_BATTERY"
+.LASF866:
+	.string	"__DECL_SIMD_log10f "
+.LASF867:
+	.string	"__DECL_SIMD_log10l "
+.LASF857:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1041:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1129:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF745:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF991:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF707:
+	.string	"__DECL_SIMD_sinl "
+.LASF1248:
+	.string	"sitlState"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF849:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1279:
+	.string	"tempData"
+.LASF1080:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1175:
+	.string	"__uint32_t"
+.LASF1251:
+	.string	"constrainf"
+.LASF1155:
+	.string	"PULSE_1MS (1000)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF908:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1075:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF845:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF810:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF695:
+	.string	"__DECL_SIMD_cos "
+.LASF984:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF846:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1093:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1183:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1077:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1262:
+	.string	"pwmInit"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF724:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1226:
+	.string	"motorPwmRate"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1186:
+	.string	"init"
+.LASF1138:
+	.string	"ADC_CHANNEL_COUNT (ADC_CHANNEL_MAX + 1)"
+.LASF462:
+	.string	"__PMT"
+.LASF1050:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF905:
+	.string	"__DECL_SIMD_acosh "
+.LASF936:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1025:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF872:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF954:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1033:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF970:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1233:
+	.string	"pwmOutputConfiguration_s"
+.LASF992:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1236:
+	.string	"pwmOutputConfiguration_t"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF939:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1150:
+	.string	"MAX_PWM_MOTORS 12"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF742:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1079:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF825:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF899:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF863:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF891:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1187:
+	.string	"read"
+.LASF1247:
+	.string	"acc_1G"
+.LASF966:
+	.string	"__HAVE_FLOAT128 1"
+.LASF869:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF808:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1167:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1125:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF940:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF930:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1037:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1231:
+	.string	"idlePulse"
+.LASF1252:
+	.string	"lrintf"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF1014:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF961:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1241:
+	.string	"position"
+.LASF1090:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1172:
+	.string	"short int"
+.LASF734:
+	.string	"__DECL_SIMD_logf128x "
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF960:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF1094:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF865:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF741:
+	.string	"__DECL_SIMD_expf128 "
+.LASF880:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF716:
+	.string	"__DECL_SIMD_sincosf "
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1238:
+	.string	"INPUT_FILTERING_ENABLED"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF797:
+	.string	"__DECL_SIMD_exp2l "
+.LASF508:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF746:
+	.string	"__DECL_SIMD_powf "
+.LASF392:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1114:
+	.string	"USE_USART1 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF391:
+	.string	"true 1"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1147:
+	.string	"LED1_OFF "
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF748:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1110:
+	.string	"ACC "
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1131:
+	.string	"sq(x) ((x)*(x))"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1184:
+	.string	"sensorInitFuncPtr"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF743:
+	.string	"__DECL_SIMD_expf64x "
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF833:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF983:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF723:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF928:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1128:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF712:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF977:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1055:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF890:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF907:
+	.string	"__DECL_SIMD_acoshl "
+.LASF911:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF831:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF794:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1177:
+	.string	"char"
+.LASF737:
+	.string	"__DECL_SIMD_expl "
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF920:
+	.string	"__DECL_SIMD_erff64 "
+.LASF816:
+	.string	"__DECL_SIMD_coshf "
+.LASF751:
+	.string	"__DECL_SIMD_powf128 "
+.LASF878:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1104:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF874:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1100:
+	.string	"U_ID_0 0x5349544c"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF840:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1146:
+	.string	"LED1_TOGGLE "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF781:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1166:
+	.string	"short unsigned int"
+.LASF800:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1119:
+	.string	"BLACKBOX "
+.LASF889:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1108:
+	.string	"GYRO "
+.LASF725:
+	.string	"__DECL_SIMD_log "
+.LASF757:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1144:
+	.string	"LED0_OFF "
+.LASF1085:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1191:
+	.string	"gyro_t"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF693:
+	.string	"_MATH_H 1"
+.LASF969:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF957:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF871:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1193:
+	.string	"acc_s"
+.LASF1195:
+	.string	"acc_t"
+.LASF755:
+	.string	"__DECL_SIMD_acos "
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1267:
+	.string	"sitlBaroDetect"
+.LASF958:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF783:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF888:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1288:
+	.string	"ledInit"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF926:
+	.string	"__DECL_SIMD_tanhf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF379:
+	.string	"SITL 1"
+.LASF768:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF934:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1181:
+	.string	"uint16_t"
+.LASF720:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1265:
+	.string	"adcGetChannel"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1059:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1235:
+	.string	"motorCount"
+.LASF1290:
+	.string	"sitlAccInit"
+.LASF1070:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1168:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF873:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF838:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1126:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1255:
+	.string	"initialInputFilteringMode"
+.LASF837:
+	.string	"__DECL_SIMD_sinhl "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF993:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1152:
+	.string	"MAX_MOTORS 12"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF1192:
+	.string	"gyro_s"
+.LASF714:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1003:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1045:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF918:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1012:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1130:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1010:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF859:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF549:
+	.string	"__stub_stty "
+.LASF795:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1122:
+	.string	"UNUSED(x) (void)(x)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1098:
+	.string	"__disable_irq() "
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF790:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1285:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF937:
+	.string	"__DECL_SIMD_asinhl "
+.LASF809:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1101:
+	.string	"U_ID_1 0"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF703:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF851:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF951:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF694:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1171:
+	.string	"__int16_t"
+.LASF1188:
+	.string	"temperature"
+.LASF827:
+	.string	"__DECL_SIMD_expm1l "
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF736:
+	.string	"__DECL_SIMD_expf "
+.LASF1208:
+	.string	"ADC_EXTERNAL1"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF698:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF997:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF924:
+	.string	"__DECL_SIMD_erff128x "
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1030:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF965:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF764:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1258:
+	.string	"pwmCompleteMotorUpdate"
+.LASF847:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1276:
+	.string	"sitlGyroDetect"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1121:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1190:
+	.string	"samplePeriod"
+.LASF843:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF916:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1210:
+	.string	"ADC_CHANNEL_MAX"
+.LASF778:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF968:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF903:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF941:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF419:
+	.string	"__USE_GNU"
+.LASF1280:
+	.string	"sitlGyroRead"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF705:
+	.string	"__DECL_SIMD_sin "
+.LASF1064:
+	.string	"FP_NORMAL 4"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF994:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF972:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF976:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF986:
+	.string	"__f32(x) x ##f32"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1046:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1219:
+	.string	"useRSSIADC"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF696:
+	.string	"__DECL_SIMD_cosf "
+.LASF719:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1113:
+	.string	"USE_BARO_SITL "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1027:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF709:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF766:
+	.string	"__DECL_SIMD_atanf "
+.LASF1137:
+	.string	"abs(x) ((x) > 0 ? (x) : -(x))"
+.LASF895:
+	.string	"__DECL_SIMD_atanh "
+.LASF1283:
+	.string	"sitlBaroNop"
+.LASF886:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1034:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1203:
+	.string	"start_up"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1073:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1201:
+	.string	"start_ut"
+.LASF1287:
+	.string	"isPPMDataBeingReceived"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1111:
+	.string	"USE_ACC_SITL "
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF779:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF798:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF921:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF861:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF817:
+	.string	"__DECL_SIMD_coshl "
+.LASF786:
+	.string	"__DECL_SIMD_hypotf "
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF1105:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1087:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1256:
+	.string	"index"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1006:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1127:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF820:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF1254:
+	.string	"pwmWriteServo"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF744:
+	.string	"__DECL_SIMD_expf128x "
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF780:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF945:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1044:
+	.string	"__MATHCALL"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF915:
+	.string	"__DECL_SIMD_erf "
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF710:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF988:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1244:
+	.string	"specificForce"
+.LASF1133:
+	.string	"RAD (M_PI / 180.0f)"
+.LASF923:
+	.string	"__DECL_SIMD_erff64x "
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1196:
+	.string	"baroOpFuncPtr"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1056:
+	.string	"__MATHCALL_NARROW"
+.LASF1011:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF770:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF718:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1263:
+	.string	"resetPPMDataReceivedState"
+.LASF815:
+	.string	"__DECL_SIMD_cosh "
+.LASF858:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF982:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF955:
+	.string	"__DECL_SIMD_tan "
+.LASF777:
+	.string	"__DECL_SIMD_asinl "
+.LASF1052:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1053:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1142:
+	.string	"digitalIn(p,i) (p->IDR & i)"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1249:
+	.string	"sitlGetRcChannel"
+.LASF931:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF927:
+	.string	"__DECL_SIMD_tanhl "
+.LASF771:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF929:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1200:
+	.string	"up_delay"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF829:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1240:
+	.string	"sitlState_s"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1289:
+	.string	"altitude"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF818:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF973:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1182:
+	.string	"uint32_t"
+.LASF1216:
+	.string	"drv_pwm_config_t"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1047:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF715:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1268:
+	.string	"baro"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF879:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF959:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1253:
+	.string	"pwmRxInit"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF708:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF919:
+	.string	"__DECL_SIMD_erff32 "
+.LASF902:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1005:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF759:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF713:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1164:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1032:
+	.string	"_Mdouble_ _Float64"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF839:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF711:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1232:
+	.string	"servoCenterPulse"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF776:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF767:
+	.string	"__DECL_SIMD_atanl "
+.LASF729:
+	.string	"__DECL_SIMD_logf32 "
+.LASF922:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1209:
+	.string	"ADC_CURRENT"
+.LASF702:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1016:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1174:
+	.string	"__int32_t"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF836:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1197:
+	.string	"baroCalculateFuncPtr"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1157:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1084:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1250:
+	.string	"powf"
+.LASF762:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1212:
+	.string	"drv_adc_config_t"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF788:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1054:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF732:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1278:
+	.string	"sitlGyroReadTemp"
+.LASF1159:
+	.string	"SITL_GYRO_LSB_PER_DPS 16.4f"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1124:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1002:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1261:
+	.string	"pwmRead"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1024:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1154:
+	.string	"MAX_PWM_OUTPUT_PORTS MAX_PWM_MOTORS"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1074:
+	.string	"M_E 2.7182818284590452354"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF913:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1120:
+	.string	"PROFILING "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1095:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF700:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/target/SITL/sitl_drivers.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19231 @@
+	.file	"sitl_serial.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" ".//src/main/target/SITL/sitl_serial.c"
+	.section	.text.uartSetBaudRate,"ax",@progbits
+	.p2align 4
+	.globl	uartSetBaudRate
+	.type	uartSetBaudRate, @function
+uartSetBaudRate:
+.LVL0:
+.LFB26:
+	.file 1 ".//src/main/target/SITL/sitl_serial.c"
+	.loc 1 232 1 view -0
+	.cfi_startproc
+	.loc 1 233 5 view .LVU1
+	.loc 1 233 24 is_stmt 0 view .LVU2
+	movl	%esi, 20(%rdi)
+	.loc 1 234 1 view .LVU3
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	uartSetBaudRate, .-uartSetBaudRate
+	.section	.text.uartSetMode,"ax",@progbits
+	.p2align 4
+	.globl	uartSetMode
+	.type	uartSetMode, @function
+uartSetMode:
+.LVL1:
+.LFB27:
+	.loc 1 237 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 238 5 view .LVU5
+	.loc 1 238 20 is_stmt 0 view .LVU6
+	movl	%esi, 12(%rdi)
+	.loc 1 239 1 view .LVU7
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	uartSetMode, .-uartSetMode
+	.section	.text.uartTotalBytesWaiting,"ax",@progbits
+	.p2align 4
+	.globl	uartTotalBytesWaiting
+	.type	uartTotalBytesWaiting, @function
+uartTotalBytesWaiting:
+.LVL2:
+.LFB28:
+	.loc 1 242 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 243 5 view .LVU9
+	.loc 1 242 1 is_stmt 0 view .LVU10
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 243 28 view .LVU11
+	addq	$24, %rdi
+.LVL3:
+	.loc 1 243 12 view .LVU12
+	call	ringBufferCount@PLT
+.LVL4:
+	.loc 1 244 1 view .LVU13
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 243 12 view .LVU14
+	movzwl	%ax, %eax
+	.loc 1 244 1 view .LVU15
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	uartTotalBytesWaiting, .-uartTotalBytesWaiting
+	.section	.text.isUartTransmitBufferEmpty,"ax",@progbits
+	.p2align 4
+	.globl	isUartTransmitBufferEmpty
+	.type	isUartTransmitBufferEmpty, @function
+isUartTransmitBufferEmpty:
+.LVL5:
+.LFB29:
+	.loc 1 247 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 5 view .LVU17
+	.loc 1 247 1 is_stmt 0 view .LVU18
+	subq	$8, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 248 28 view .LVU19
+	addq	$40, %rdi
+.LVL6:
+	.loc 1 248 12 view .LVU20
+	call	ringBufferCount@PLT
+.LVL7:
+	.loc 1 248 49 view .LVU21
+	testw	%ax, %ax
+	sete	%al
+	.loc 1 249 1 view .LVU22
+	addq	$8, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	isUartTransmitBufferEmpty, .-isUartTransmitBufferEmpty
+	.section	.text.uartRead,"ax",@progbits
+	.p2align 4
+	.globl	uartRead
+	.type	uartRead, @function
+uartRead:
+.LVL8:
+.LFB30:
+	.loc 1 252 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 253 5 view .LVU24
+	.loc 1 252 1 is_stmt 0 view .LVU25
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 255 5 view .LVU26
+	addq	$24, %rdi
+.LVL9:
+	.loc 1 255 5 view .LVU27
+	leaq	15(%rsp), %rsi
+	.loc 1 253 13 view .LVU28
+	movb	$0, 15(%rsp)
+	.loc 1 255 5 is_stmt 1 view .LVU29
+	call	ringBufferGet@PLT
+.LVL10:
+	.loc 1 256 5 view .LVU30
+	.loc 1 257 1 is_stmt 0 view .LVU31
+	movzbl	15(%rsp), %eax
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	uartRead, .-uartRead
+	.section	.text.uartWrite,"ax",@progbits
+	.p2align 4
+	.globl	uartWrite
+	.type	uartWrite, @function
+uartWrite:
+.LVL11:
+.LFB31:
+	.loc 1 261 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 262 5 view .LVU33
+	movzbl	%sil, %esi
+	.loc 1 262 5 is_stmt 0 view .LVU34
+	addq	$40, %rdi
+.LVL12:
+	.loc 1 262 5 view .LVU35
+	jmp	ringBufferPut@PLT
+.LVL13:
+	.loc 1 262 5 view .LVU36
+	.cfi_endproc
+.LFE31:
+	.size	uartWrite, .-uartWrite
+	.section	.rodata.uartOpen.str1.8,"aMS",@progbits,1
+	.align 8
+.LC0:
+	.string	"SITL: UART unavailable, cannot listen on port %u: %s\n"
+	.align 8
+.LC1:
+	.string	"SITL: UART%u listening on port %u\n"
+	.section	.text.uartOpen,"ax",@progbits
+	.p2align 4
+	.globl	uartOpen
+	.type	uartOpen, @function
+uartOpen:
+.LVL14:
+.LFB19:
+	.loc 1 89 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 90 5 view .LVU38
+	.loc 1 92 5 view .LVU39
+	.loc 1 89 1 is_stmt 0 view .LVU40
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	xorl	%r14d, %r14d
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 92 15 view .LVU41
+	movzbl	(%rdi), %eax
+	.loc 1 89 1 view .LVU42
+	movq	%rsi, 8(%rsp)
+	movl	%ecx, 16(%rsp)
+	.loc 1 92 8 view .LVU43
+	cmpb	$1, %al
+	ja	.L11
+	movzbl	%al, %r10d
+	.loc 1 97 17 view .LVU44
+	leaq	sitlUarts(%rip), %r12
+	movq	%rdi, %rbx
+	movl	%edx, %r13d
+	.loc 1 96 5 is_stmt 1 view .LVU45
+.LVL15:
+	.loc 1 97 5 view .LVU46
+	imulq	$712, %r10, %rbp
+	.loc 1 99 14 is_stmt 0 view .LVU47
+	movq	%r10, %r15
+	.loc 1 99 8 view .LVU48
+	cmpb	$0, 184(%r12,%rbp)
+	.loc 1 97 17 view .LVU49
+	leaq	(%r12,%rbp), %r14
+.LVL16:
+	.loc 1 99 5 is_stmt 1 view .LVU50
+	.loc 1 99 8 is_stmt 0 view .LVU51
+	je	.L21
+.LVL17:
+.L13:
+	.loc 1 105 5 is_stmt 1 view .LVU52
+	.loc 1 105 20 is_stmt 0 view .LVU53
+	imulq	$712, %r15, %r15
+	.loc 1 110 5 view .LVU54
+	leaq	24(%r12,%rbp), %rdi
+	movl	$256, %edx
+	.loc 1 105 20 view .LVU55
+	leaq	uartVTable(%rip), %rax
+	.loc 1 110 43 view .LVU56
+	leaq	196(%r12,%rbp), %rsi
+	.loc 1 105 20 view .LVU57
+	addq	%r12, %r15
+	movq	%rax, (%r15)
+	.loc 1 106 5 is_stmt 1 view .LVU58
+	.loc 1 107 18 is_stmt 0 view .LVU59
+	movl	16(%rsp), %eax
+	.loc 1 106 22 view .LVU60
+	movl	%r13d, 20(%r15)
+	.loc 1 107 5 is_stmt 1 view .LVU61
+	.loc 1 107 18 is_stmt 0 view .LVU62
+	movl	%eax, 12(%r15)
+	.loc 1 108 5 is_stmt 1 view .LVU63
+	.loc 1 108 22 is_stmt 0 view .LVU64
+	movq	8(%rsp), %rax
+	movq	%rax, 56(%r15)
+	.loc 1 110 5 is_stmt 1 view .LVU65
+	call	ringBufferInit@PLT
+.LVL18:
+	.loc 1 111 5 view .LVU66
+	leaq	40(%r12,%rbp), %rdi
+	movl	$256, %edx
+	.loc 1 111 43 is_stmt 0 view .LVU67
+	leaq	452(%r12,%rbp), %rsi
+	.loc 1 111 5 view .LVU68
+	call	ringBufferInit@PLT
+.LVL19:
+	.loc 1 113 5 is_stmt 1 view .LVU69
+	.loc 1 113 15 is_stmt 0 view .LVU70
+	movq	%rbx, 112(%r15)
+	.loc 1 115 5 is_stmt 1 view .LVU71
+.LVL20:
+.L11:
+	.loc 1 116 1 is_stmt 0 view .LVU72
+	addq	$72, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%r14, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL21:
+	.p2align 4,,10
+	.p2align 3
+.L21:
+	.cfi_restore_state
+	.loc 1 100 9 is_stmt 1 view .LVU73
+	.loc 1 100 52 is_stmt 0 view .LVU74
+	addw	$5761, %ax
+.LBB15:
+.LBB16:
+	.loc 1 64 14 view .LVU75
+	xorl	%edx, %edx
+.LVL22:
+	.loc 1 64 14 view .LVU76
+	movl	$1, %esi
+.LVL23:
+	.loc 1 64 14 view .LVU77
+	movl	$2, %edi
+.LBE16:
+.LBE15:
+	.loc 1 100 26 view .LVU78
+	movzwl	%ax, %ecx
+.LVL24:
+	.loc 1 100 26 view .LVU79
+	movw	%ax, 30(%rsp)
+	movl	%ecx, 24(%rsp)
+.LVL25:
+.LBB25:
+.LBI15:
+	.loc 1 60 12 is_stmt 1 view .LVU80
+.LBB23:
+	.loc 1 62 5 view .LVU81
+	.loc 1 63 5 view .LVU82
+	.loc 1 63 9 is_stmt 0 view .LVU83
+	movl	$1, 44(%rsp)
+	.loc 1 64 5 is_stmt 1 view .LVU84
+	.loc 1 64 14 is_stmt 0 view .LVU85
+	call	socket@PLT
+.LVL26:
+	.loc 1 64 14 view .LVU86
+	movl	%eax, 20(%rsp)
+.LVL27:
+	.loc 1 66 5 is_stmt 1 view .LVU87
+	.loc 1 66 8 is_stmt 0 view .LVU88
+	testl	%eax, %eax
+	js	.L14
+	.loc 1 70 5 is_stmt 1 view .LVU89
+	leaq	44(%rsp), %rcx
+	movl	$4, %r8d
+	movl	$2, %edx
+	movl	%eax, %edi
+	movl	$1, %esi
+	call	setsockopt@PLT
+.LVL28:
+	.loc 1 71 5 view .LVU90
+	.loc 1 71 23 is_stmt 0 view .LVU91
+	movl	20(%rsp), %edi
+	movl	$3, %esi
+	xorl	%eax, %eax
+	call	fcntl@PLT
+.LVL29:
+	.loc 1 71 5 view .LVU92
+	movl	20(%rsp), %edi
+	movl	$4, %esi
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	orb	$8, %dh
+	call	fcntl@PLT
+.LVL30:
+	.loc 1 73 5 is_stmt 1 view .LVU93
+	.loc 1 74 24 is_stmt 0 view .LVU94
+	movl	$2, %eax
+	.loc 1 78 9 view .LVU95
+	movl	20(%rsp), %edi
+	.loc 1 73 5 view .LVU96
+	leaq	48(%rsp), %rsi
+	.loc 1 74 24 view .LVU97
+	movw	%ax, 48(%rsp)
+.LBB17:
+.LBB18:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.loc 2 37 10 view .LVU98
+	movzwl	30(%rsp), %eax
+.LBE18:
+.LBE17:
+	.loc 1 78 9 view .LVU99
+	movl	$16, %edx
+	.loc 1 73 5 view .LVU100
+	movq	$0, 56(%rsp)
+	.loc 1 74 5 is_stmt 1 view .LVU101
+	.loc 1 75 5 view .LVU102
+.LBB21:
+.LBB19:
+	.loc 2 37 10 is_stmt 0 view .LVU103
+	rolw	$8, %ax
+.LBE19:
+.LBE21:
+	.loc 1 75 29 view .LVU104
+	movl	$16777343, 52(%rsp)
+	.loc 1 76 5 is_stmt 1 view .LVU105
+.LVL31:
+.LBB22:
+.LBI17:
+	.loc 2 34 1 view .LVU106
+.LBB20:
+	.loc 2 37 3 view .LVU107
+	.loc 2 37 3 is_stmt 0 view .LVU108
+.LBE20:
+.LBE22:
+	.loc 1 76 22 view .LVU109
+	movw	%ax, 50(%rsp)
+	.loc 1 78 5 is_stmt 1 view .LVU110
+	.loc 1 78 9 is_stmt 0 view .LVU111
+	call	bind@PLT
+.LVL32:
+	.loc 1 78 8 view .LVU112
+	testl	%eax, %eax
+	js	.L17
+	.loc 1 78 71 view .LVU113
+	movl	20(%rsp), %edi
+	movl	$1, %esi
+	call	listen@PLT
+.LVL33:
+	.loc 1 78 68 view .LVU114
+	testl	%eax, %eax
+	js	.L17
+	.loc 1 84 5 is_stmt 1 view .LVU115
+	movl	24(%rsp), %edx
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	leal	-5760(%rdx), %esi
+	call	printf@PLT
+.LVL34:
+	.loc 1 85 5 view .LVU116
+.L16:
+	.loc 1 85 5 is_stmt 0 view .LVU117
+.LBE23:
+.LBE25:
+	.loc 1 100 24 view .LVU118
+	imulq	$712, %r15, %rax
+	movl	20(%rsp), %ecx
+	addq	%r12, %rax
+	movl	%ecx, 188(%rax)
+	.loc 1 101 9 is_stmt 1 view .LVU119
+	.loc 1 101 24 is_stmt 0 view .LVU120
+	movl	$-1, 192(%rax)
+	.loc 1 102 9 is_stmt 1 view .LVU121
+	.loc 1 102 22 is_stmt 0 view .LVU122
+	movb	$1, 184(%rax)
+	jmp	.L13
+.LVL35:
+.L17:
+.LBB26:
+.LBB24:
+	.loc 1 79 9 is_stmt 1 view .LVU123
+	.loc 1 79 102 is_stmt 0 view .LVU124
+	call	__errno_location@PLT
+.LVL36:
+	.loc 1 79 9 view .LVU125
+	movl	(%rax), %edi
+	call	strerror@PLT
+.LVL37:
+	movq	stderr(%rip), %rdi
+	movl	24(%rsp), %edx
+	leaq	.LC0(%rip), %rsi
+	movq	%rax, %rcx
+	xorl	%eax, %eax
+	call	fprintf@PLT
+.LVL38:
+	.loc 1 80 9 is_stmt 1 view .LVU126
+	movl	20(%rsp), %edi
+	call	close@PLT
+.LVL39:
+	.loc 1 81 9 view .LVU127
+.L14:
+	.loc 1 67 16 is_stmt 0 view .LVU128
+	movl	$-1, 20(%rsp)
+.LVL40:
+	.loc 1 67 16 view .LVU129
+	jmp	.L16
+.LBE24:
+.LBE26:
+	.cfi_endproc
+.LFE19:
+	.size	uartOpen, .-uartOpen
+	.section	.text.sitlSerialPoll,"ax",@progbits
+	.p2align 4
+	.globl	sitlSerialPoll
+	.type	sitlSerialPoll, @function
+sitlSerialPoll:
+.LFB25:
+	.loc 1 202 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 203 5 view .LVU131
+	.loc 1 205 5 view .LVU132
+.LVL41:
+	.loc 1 205 19 view .LVU133
+	.loc 1 202 1 is_stmt 0 view .LVU134
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	40+sitlUarts(%rip), %rbx
+	leaq	1424(%rbx), %r12
+	subq	$264, %rsp
+	.cfi_def_cfa_offset 304
+.LVL42:
+.L43:
+.LBB43:
+	.loc 1 206 9 is_stmt 1 view .LVU135
+	.loc 1 207 9 view .LVU136
+	.loc 1 209 9 view .LVU137
+	.loc 1 209 12 is_stmt 0 view .LVU138
+	cmpb	$0, 144(%rbx)
+	je	.L28
+	.loc 1 209 34 discriminator 2 view .LVU139
+	movl	148(%rbx), %edi
+	.loc 1 209 27 discriminator 2 view .LVU140
+	testl	%edi, %edi
+	js	.L28
+	.loc 1 215 9 is_stmt 1 view .LVU141
+	.loc 1 215 12 is_stmt 0 view .LVU142
+	movl	152(%rbx), %edx
+	testl	%edx, %edx
+	js	.L60
+.L26:
+	.loc 1 219 9 is_stmt 1 view .LVU143
+	.loc 1 219 33 is_stmt 0 view .LVU144
+	testb	$1, -28(%rbx)
+	jne	.L61
+.L31:
+	.loc 1 223 17 view .LVU145
+	movl	152(%rbx), %eax
+.L29:
+	.loc 1 223 9 is_stmt 1 view .LVU146
+	.loc 1 223 12 is_stmt 0 view .LVU147
+	testl	%eax, %eax
+	js	.L28
+	movq	%rsp, %rbp
+	jmp	.L42
+.LVL43:
+	.p2align 4,,10
+	.p2align 3
+.L40:
+.LBB44:
+.LBB45:
+.LBB46:
+	.loc 1 191 9 is_stmt 1 view .LVU148
+	movzwl	%ax, %esi
+	movq	%rbx, %rdi
+	call	ringBufferConsume@PLT
+.LVL44:
+	.loc 1 191 9 is_stmt 0 view .LVU149
+.LBE46:
+	.loc 1 178 11 is_stmt 1 view .LVU150
+.L42:
+	.loc 1 175 5 view .LVU151
+	.loc 1 176 5 view .LVU152
+	.loc 1 178 5 view .LVU153
+.LBB51:
+	.loc 1 179 9 view .LVU154
+	.loc 1 179 16 is_stmt 0 view .LVU155
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	ringBufferReadPointer@PLT
+.LVL45:
+	.loc 1 180 13 view .LVU156
+	movzwl	(%rsp), %edx
+	.loc 1 179 16 view .LVU157
+	movq	%rax, %rsi
+.LVL46:
+	.loc 1 180 9 is_stmt 1 view .LVU158
+	.loc 1 180 12 is_stmt 0 view .LVU159
+	testw	%dx, %dx
+	je	.L25
+	.loc 1 184 9 is_stmt 1 view .LVU160
+	.loc 1 184 24 is_stmt 0 view .LVU161
+	movl	152(%rbx), %edi
+	movl	$16384, %ecx
+	call	send@PLT
+.LVL47:
+	.loc 1 185 9 is_stmt 1 view .LVU162
+	.loc 1 185 12 is_stmt 0 view .LVU163
+	testq	%rax, %rax
+	jg	.L40
+	.loc 1 186 13 is_stmt 1 view .LVU164
+	.loc 1 186 18 is_stmt 0 view .LVU165
+	call	__errno_location@PLT
+.LVL48:
+	.loc 1 186 16 view .LVU166
+	cmpl	$11, (%rax)
+	je	.L25
+	.loc 1 187 17 is_stmt 1 view .LVU167
+.LVL49:
+.LBB47:
+.LBI47:
+	.loc 1 131 13 view .LVU168
+.LBB48:
+	.loc 1 133 5 view .LVU169
+	movl	152(%rbx), %edi
+.LBE48:
+.LBE47:
+.LBE51:
+.LBE45:
+.LBE44:
+.LBE43:
+	.loc 1 205 19 is_stmt 0 view .LVU170
+	addq	$712, %rbx
+.LVL50:
+.LBB77:
+.LBB54:
+.LBB53:
+.LBB52:
+.LBB50:
+.LBB49:
+	.loc 1 133 5 view .LVU171
+	call	close@PLT
+.LVL51:
+	.loc 1 134 5 is_stmt 1 view .LVU172
+	.loc 1 134 20 is_stmt 0 view .LVU173
+	movl	$-1, -560(%rbx)
+.LVL52:
+	.loc 1 134 20 view .LVU174
+.LBE49:
+.LBE50:
+.LBE52:
+.LBE53:
+.LBE54:
+.LBE77:
+	.loc 1 205 25 is_stmt 1 view .LVU175
+	.loc 1 205 19 view .LVU176
+	cmpq	%r12, %rbx
+	jne	.L43
+	.loc 1 229 1 is_stmt 0 view .LVU177
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL53:
+	.loc 1 229 1 view .LVU178
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL54:
+	.p2align 4,,10
+	.p2align 3
+.L60:
+	.cfi_restore_state
+.LBB78:
+	.loc 1 216 13 is_stmt 1 view .LVU179
+.LBB55:
+.LBI55:
+	.loc 1 118 13 view .LVU180
+.LBB56:
+	.loc 1 120 5 view .LVU181
+	.loc 1 120 14 is_stmt 0 view .LVU182
+	xorl	%edx, %edx
+	xorl	%esi, %esi
+	call	accept@PLT
+.LVL55:
+	movl	%eax, %r13d
+.LVL56:
+	.loc 1 121 5 is_stmt 1 view .LVU183
+	.loc 1 121 8 is_stmt 0 view .LVU184
+	testl	%eax, %eax
+	jns	.L27
+	.loc 1 122 9 is_stmt 1 view .LVU185
+.LVL57:
+	.loc 1 122 9 is_stmt 0 view .LVU186
+.LBE56:
+.LBE55:
+	.loc 1 219 9 is_stmt 1 view .LVU187
+	.loc 1 219 12 is_stmt 0 view .LVU188
+	movl	152(%rbx), %eax
+	testl	%eax, %eax
+	jns	.L26
+.L28:
+	.loc 1 226 13 is_stmt 1 view .LVU189
+.LVL58:
+.LBB58:
+.LBI58:
+	.loc 1 196 13 view .LVU190
+.LBB59:
+	.loc 1 198 5 view .LVU191
+	.loc 1 198 40 is_stmt 0 view .LVU192
+	movq	%rbx, %rdi
+	call	ringBufferCount@PLT
+.LVL59:
+	.loc 1 198 5 view .LVU193
+	movq	%rbx, %rdi
+	movzwl	%ax, %esi
+	call	ringBufferConsume@PLT
+.LVL60:
+.L25:
+	.loc 1 198 5 view .LVU194
+.LBE59:
+.LBE58:
+.LBE78:
+	.loc 1 205 25 is_stmt 1 discriminator 2 view .LVU195
+	.loc 1 205 19 discriminator 2 view .LVU196
+	addq	$712, %rbx
+.LVL61:
+	.loc 1 205 19 is_stmt 0 discriminator 2 view .LVU197
+	cmpq	%r12, %rbx
+	jne	.L43
+	.loc 1 229 1 view .LVU198
+	addq	$264, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL62:
+	.loc 1 229 1 view .LVU199
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+.LVL63:
+	.p2align 4,,10
+	.p2align 3
+.L61:
+	.cfi_restore_state
+.LBB79:
+	.loc 1 220 13 is_stmt 1 view .LVU200
+.LBB60:
+.LBI60:
+	.loc 1 137 13 view .LVU201
+.LBB61:
+	.loc 1 139 5 view .LVU202
+	.loc 1 140 5 view .LVU203
+	.loc 1 141 5 view .LVU204
+	.loc 1 143 5 view .LVU205
+	.loc 1 143 8 is_stmt 0 view .LVU206
+	cmpq	$0, 16(%rbx)
+	.loc 1 141 12 view .LVU207
+	movl	$256, %edx
+	.loc 1 143 8 view .LVU208
+	je	.L62
+.LVL64:
+.L30:
+	.loc 1 151 5 is_stmt 1 view .LVU209
+	.loc 1 151 24 is_stmt 0 view .LVU210
+	movq	%rsp, %rbp
+	movl	152(%rbx), %edi
+	xorl	%ecx, %ecx
+	movq	%rbp, %rsi
+	call	recv@PLT
+.LVL65:
+	.loc 1 153 5 is_stmt 1 view .LVU211
+	.loc 1 153 8 is_stmt 0 view .LVU212
+	testq	%rax, %rax
+	je	.L32
+	.loc 1 153 23 view .LVU213
+	js	.L33
+	.loc 1 158 5 is_stmt 1 view .LVU214
+	.loc 1 158 14 is_stmt 0 view .LVU215
+	movq	16(%rbx), %rdx
+	.loc 1 158 8 view .LVU216
+	testq	%rdx, %rdx
+	je	.L34
+	leaq	0(%rbp,%rax), %r13
+	jmp	.L35
+.LVL66:
+	.p2align 4,,10
+	.p2align 3
+.L55:
+	.loc 1 167 13 view .LVU217
+	movq	16(%rbx), %rdx
+.L35:
+.LVL67:
+	.loc 1 167 9 is_stmt 1 view .LVU218
+	movzbl	0(%rbp), %edi
+	.loc 1 166 19 is_stmt 0 view .LVU219
+	addq	$1, %rbp
+.LVL68:
+	.loc 1 167 9 view .LVU220
+	call	*%rdx
+.LVL69:
+	.loc 1 166 32 is_stmt 1 view .LVU221
+	.loc 1 166 19 view .LVU222
+	cmpq	%rbp, %r13
+	jne	.L55
+	movl	152(%rbx), %edx
+.LBE61:
+.LBE60:
+	.loc 1 223 17 is_stmt 0 view .LVU223
+	movl	%edx, %eax
+.LBB72:
+.LBB68:
+	jmp	.L29
+.LVL70:
+	.p2align 4,,10
+	.p2align 3
+.L27:
+	.loc 1 223 17 view .LVU224
+.LBE68:
+.LBE72:
+.LBB73:
+.LBB57:
+	.loc 1 125 5 is_stmt 1 view .LVU225
+	.loc 1 126 5 is_stmt 0 view .LVU226
+	movq	%rsp, %rbp
+	movl	$4, %r8d
+	movl	$1, %edx
+	movl	%eax, %edi
+	movq	%rbp, %rcx
+	movl	$6, %esi
+	.loc 1 125 9 view .LVU227
+	movl	$1, (%rsp)
+	.loc 1 126 5 is_stmt 1 view .LVU228
+	call	setsockopt@PLT
+.LVL71:
+	.loc 1 127 5 view .LVU229
+	.loc 1 127 23 is_stmt 0 view .LVU230
+	movl	$3, %esi
+	movl	%r13d, %edi
+	xorl	%eax, %eax
+	call	fcntl@PLT
+.LVL72:
+	.loc 1 127 5 view .LVU231
+	movl	$4, %esi
+	movl	%r13d, %edi
+	orb	$8, %ah
+	movl	%eax, %edx
+	xorl	%eax, %eax
+	call	fcntl@PLT
+.LVL73:
+	.loc 1 128 5 is_stmt 1 view .LVU232
+	.loc 1 128 20 is_stmt 0 view .LVU233
+	movl	%r13d, 152(%rbx)
+	jmp	.L26
+.LVL74:
+	.p2align 4,,10
+	.p2align 3
+.L62:
+	.loc 1 128 20 view .LVU234
+.LBE57:
+.LBE73:
+.LBB74:
+.LBB69:
+	.loc 1 145 9 is_stmt 1 view .LVU235
+	.loc 1 145 35 is_stmt 0 view .LVU236
+	leaq	-16(%rbx), %rdi
+	.loc 1 145 20 view .LVU237
+	call	ringBufferFree@PLT
+.LVL75:
+	.loc 1 145 18 view .LVU238
+	movzwl	%ax, %edx
+.LVL76:
+	.loc 1 146 9 is_stmt 1 view .LVU239
+	.loc 1 146 12 is_stmt 0 view .LVU240
+	testq	%rdx, %rdx
+	jne	.L30
+	jmp	.L31
+.LVL77:
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	.loc 1 153 44 view .LVU241
+	call	__errno_location@PLT
+.LVL78:
+	.loc 1 153 40 view .LVU242
+	cmpl	$11, (%rax)
+	je	.L36
+.L32:
+	.loc 1 154 9 is_stmt 1 view .LVU243
+.LVL79:
+.LBB62:
+.LBI62:
+	.loc 1 131 13 view .LVU244
+.LBB63:
+	.loc 1 133 5 view .LVU245
+	movl	152(%rbx), %edi
+	call	close@PLT
+.LVL80:
+	.loc 1 134 5 view .LVU246
+	.loc 1 134 20 is_stmt 0 view .LVU247
+	movl	$-1, 152(%rbx)
+.LVL81:
+	.loc 1 134 20 view .LVU248
+.LBE63:
+.LBE62:
+	.loc 1 155 9 is_stmt 1 view .LVU249
+	.loc 1 155 9 is_stmt 0 view .LVU250
+.LBE69:
+.LBE74:
+	.loc 1 223 9 is_stmt 1 view .LVU251
+	jmp	.L28
+.LVL82:
+.L36:
+.LBB75:
+.LBB70:
+.LBB66:
+.LBB64:
+	.loc 1 133 5 is_stmt 0 view .LVU252
+	movl	152(%rbx), %edx
+.LBE64:
+.LBE66:
+	.loc 1 158 8 view .LVU253
+	cmpq	$0, 16(%rbx)
+.LBB67:
+.LBB65:
+	.loc 1 133 5 view .LVU254
+	movl	%edx, %eax
+.LBE65:
+.LBE67:
+	.loc 1 158 5 is_stmt 1 view .LVU255
+	.loc 1 158 8 is_stmt 0 view .LVU256
+	je	.L29
+.LBE70:
+.LBE75:
+	.loc 1 223 17 view .LVU257
+	movl	%edx, %eax
+	jmp	.L29
+.LVL83:
+.L34:
+.LBB76:
+.LBB71:
+	.loc 1 159 9 is_stmt 1 view .LVU258
+	.loc 1 160 13 view .LVU259
+	movzwl	%ax, %edx
+	leaq	-16(%rbx), %rdi
+	movq	%rbp, %rsi
+	call	ringBufferWrite@PLT
+.LVL84:
+	.loc 1 160 13 is_stmt 0 view .LVU260
+.LBE71:
+.LBE76:
+	.loc 1 223 17 view .LVU261
+	movl	152(%rbx), %eax
+	jmp	.L29
+.LBE79:
+	.cfi_endproc
+.LFE25:
+	.size	sitlSerialPoll, .-sitlSerialPoll
+	.globl	uartVTable
+	.section	.data.rel.ro.uartVTable,"aw"
+	.align 32
+	.type	uartVTable, @object
+	.size	uartVTable, 88
+uartVTable:
+	.quad	uartWrite
+	.quad	uartTotalBytesWaiting
+	.quad	uartRead
+	.quad	uartSetBaudRate
+	.quad	isUartTransmitBufferEmpty
+	.quad	uartSetMode
+	.quad	0
+	.quad	serialBufferWrite
+	.quad	serialBufferRead
+	.quad	serialBufferTxReserve
+	.quad	serialBufferTxCommit
+	.section	.bss.sitlUarts,"aw",@nobits
+	.align 32
+	.type	sitlUarts, @object
+	.size	sitlUarts, 1424
+sitlUarts:
+	.zero	1424
+	.text
+.Letext0:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/stdio.h"
+	.file 9 "/usr/include/unistd.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.file 12 "/usr/include/netinet/in.h"
+	.file 13 ".//src/main/target/SITL/sitl_mcu.h"
+	.file 14 ".//src/main/common/ring_buffer.h"
+	.file 15 ".//src/main/drivers/serial.h"
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.file 17 ".//src/main/drivers/serial_rx_frame.h"
+	.file 18 ".//src/main/drivers/serial_uart.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.file 20 "/usr/include/string.h"
+	.file 21 "/usr/include/fcntl.h"
+	.file 22 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x179a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2e
+	.long	.LASF2471
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.LLRL39
+	.quad	0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2217
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2218
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2219
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2220
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2221
+	.uleb128 0x6
+	.long	.LASF2223
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x35
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2222
+	.uleb128 0x6
+	.long	.LASF2224
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF2225
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2226
+	.uleb128 0x6
+	.long	.LASF2227
+	.byte	0x3
+	.byte	0x98
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x6
+	.long	.LASF2228
+	.byte	0x3
+	.byte	0x99
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x30
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF2229
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x5
+	.long	0xb5
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2230
+	.uleb128 0x13
+	.long	0xb5
+	.uleb128 0x6
+	.long	.LASF2231
+	.byte	0x3
+	.byte	0xd2
+	.byte	0x16
+	.long	0x43
+	.uleb128 0x6
+	.long	.LASF2232
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x28
+	.long	0xcd
+	.uleb128 0x13
+	.long	0xcd
+	.uleb128 0x6
+	.long	.LASF2233
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF2234
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x6
+	.long	.LASF2235
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0xe
+	.long	.LASF2283
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.byte	0x8
+	.long	0x28e
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0xb0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0xb0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0xb0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0xb0
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0xb0
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0xb0
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0xb0
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0xb0
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0xb0
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0xb0
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0xb0
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x2a7
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x2ac
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x70
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x70
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8a
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x3c
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x4a
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2b1
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x2c1
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0x96
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2cb
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2d5
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2ac
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0xa2
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0xfb
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x70
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x2da
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2265
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x107
+	.uleb128 0x31
+	.long	.LASF2472
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x22
+	.long	.LASF2266
+	.uleb128 0x5
+	.long	0x2a2
+	.uleb128 0x5
+	.long	0x107
+	.uleb128 0xc
+	.long	0xb5
+	.long	0x2c1
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x29a
+	.uleb128 0x22
+	.long	.LASF2267
+	.uleb128 0x5
+	.long	0x2c6
+	.uleb128 0x22
+	.long	.LASF2268
+	.uleb128 0x5
+	.long	0x2d0
+	.uleb128 0xc
+	.long	0xb5
+	.long	0x2ea
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2269
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x13
+	.long	0xa4
+	.uleb128 0x5
+	.long	0x28e
+	.uleb128 0x1e
+	.long	0x2f6
+	.uleb128 0x29
+	.long	.LASF2409
+	.byte	0x8
+	.byte	0x91
+	.byte	0xe
+	.long	0x2f6
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x1e
+	.long	0x30c
+	.uleb128 0x32
+	.long	.LASF2270
+	.byte	0x9
+	.value	0x112
+	.byte	0x15
+	.long	0xc1
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2271
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2272
+	.uleb128 0x2a
+	.long	.LASF2360
+	.long	0x43
+	.byte	0x10
+	.byte	0x18
+	.byte	0x6
+	.long	0x37c
+	.uleb128 0x4
+	.long	.LASF2273
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2274
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2275
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF2276
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2278
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF2279
+	.byte	0xa
+	.uleb128 0x16
+	.long	.LASF2280
+	.long	0x80000
+	.uleb128 0xa
+	.long	.LASF2281
+	.value	0x800
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2282
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0xe
+	.long	.LASF2284
+	.byte	0x10
+	.byte	0xb
+	.byte	0xb7
+	.byte	0x8
+	.long	0x3b0
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xb
+	.byte	0xb9
+	.byte	0x11
+	.long	0x37c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0xb
+	.byte	0xba
+	.byte	0xa
+	.long	0x3b5
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.long	0x388
+	.uleb128 0xc
+	.long	0xb5
+	.long	0x3c5
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0xd
+	.byte	0
+	.uleb128 0x23
+	.long	0x43
+	.byte	0xb
+	.byte	0xce
+	.byte	0x3
+	.long	0x467
+	.uleb128 0x4
+	.long	.LASF2287
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2288
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2289
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2290
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2291
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF2292
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF2293
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF2294
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2295
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF2296
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2297
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2298
+	.value	0x800
+	.uleb128 0xa
+	.long	.LASF2299
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2300
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2301
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF2302
+	.value	0x8000
+	.uleb128 0x16
+	.long	.LASF2303
+	.long	0x10000
+	.uleb128 0x16
+	.long	.LASF2304
+	.long	0x40000
+	.uleb128 0x16
+	.long	.LASF2305
+	.long	0x4000000
+	.uleb128 0x16
+	.long	.LASF2306
+	.long	0x20000000
+	.uleb128 0x16
+	.long	.LASF2307
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2308
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x12
+	.long	0xef
+	.uleb128 0xe
+	.long	.LASF2309
+	.byte	0x4
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x8
+	.long	0x48e
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0xc
+	.byte	0x21
+	.byte	0xf
+	.long	0x467
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	0x43
+	.byte	0xc
+	.byte	0x29
+	.byte	0x3
+	.long	0x545
+	.uleb128 0x4
+	.long	.LASF2311
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2312
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2313
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2314
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2315
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF2316
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2317
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF2318
+	.byte	0x11
+	.uleb128 0x4
+	.long	.LASF2319
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2320
+	.byte	0x1d
+	.uleb128 0x4
+	.long	.LASF2321
+	.byte	0x21
+	.uleb128 0x4
+	.long	.LASF2322
+	.byte	0x29
+	.uleb128 0x4
+	.long	.LASF2323
+	.byte	0x2e
+	.uleb128 0x4
+	.long	.LASF2324
+	.byte	0x2f
+	.uleb128 0x4
+	.long	.LASF2325
+	.byte	0x32
+	.uleb128 0x4
+	.long	.LASF2326
+	.byte	0x33
+	.uleb128 0x4
+	.long	.LASF2327
+	.byte	0x5c
+	.uleb128 0x4
+	.long	.LASF2328
+	.byte	0x5e
+	.uleb128 0x4
+	.long	.LASF2329
+	.byte	0x62
+	.uleb128 0x4
+	.long	.LASF2330
+	.byte	0x67
+	.uleb128 0x4
+	.long	.LASF2331
+	.byte	0x6c
+	.uleb128 0x4
+	.long	.LASF2332
+	.byte	0x84
+	.uleb128 0x4
+	.long	.LASF2333
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF2334
+	.byte	0x89
+	.uleb128 0x4
+	.long	.LASF2335
+	.byte	0x8f
+	.uleb128 0x4
+	.long	.LASF2336
+	.byte	0xff
+	.uleb128 0xa
+	.long	.LASF2337
+	.value	0x106
+	.uleb128 0xa
+	.long	.LASF2338
+	.value	0x107
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2339
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0xe
+	.long	.LASF2340
+	.byte	0x10
+	.byte	0xc
+	.byte	0xf5
+	.byte	0x8
+	.long	0x593
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0xc
+	.byte	0xf7
+	.byte	0x11
+	.long	0x37c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0xc
+	.byte	0xf8
+	.byte	0xf
+	.long	0x545
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0xc
+	.byte	0xf9
+	.byte	0x14
+	.long	0x473
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0xc
+	.byte	0xfc
+	.byte	0x13
+	.long	0x593
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x35
+	.long	0x5a3
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0xd
+	.byte	0x2a
+	.long	0x5b9
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2346
+	.byte	0xd
+	.byte	0x2c
+	.byte	0x3
+	.long	0x5a3
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0xd
+	.byte	0x32
+	.long	0x5db
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0xd
+	.byte	0x33
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2348
+	.byte	0xd
+	.byte	0x34
+	.byte	0x2a
+	.long	0x5c5
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2349
+	.uleb128 0xe
+	.long	.LASF2350
+	.byte	0x10
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x10
+	.long	0x63d
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x17
+	.long	0x63d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xe
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xe
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xe
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0xe
+	.byte	0x20
+	.byte	0xe
+	.long	0xe3
+	.byte	0xe
+	.byte	0
+	.uleb128 0x5
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF2356
+	.byte	0xe
+	.byte	0x21
+	.byte	0x3
+	.long	0x5ee
+	.uleb128 0x13
+	.long	0x642
+	.uleb128 0x23
+	.long	0x43
+	.byte	0xf
+	.byte	0x16
+	.byte	0xe
+	.long	0x66c
+	.uleb128 0x4
+	.long	.LASF2357
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2359
+	.byte	0xf
+	.byte	0x19
+	.byte	0x3
+	.long	0x653
+	.uleb128 0x2a
+	.long	.LASF2361
+	.long	0x43
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0x6a1
+	.uleb128 0x4
+	.long	.LASF2362
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2363
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2364
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF2365
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2361
+	.byte	0xf
+	.byte	0x20
+	.byte	0x3
+	.long	0x678
+	.uleb128 0x6
+	.long	.LASF2366
+	.byte	0xf
+	.byte	0x22
+	.byte	0x10
+	.long	0x6b9
+	.uleb128 0x5
+	.long	0x6be
+	.uleb128 0x17
+	.long	0x6c9
+	.uleb128 0x2
+	.long	0xe3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2367
+	.byte	0xf
+	.byte	0x23
+	.byte	0x10
+	.long	0x6d5
+	.uleb128 0x5
+	.long	0x6da
+	.uleb128 0x17
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0xe
+	.long	.LASF2368
+	.byte	0x40
+	.byte	0xf
+	.byte	0x25
+	.byte	0x10
+	.long	0x765
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0xf
+	.byte	0x27
+	.byte	0x24
+	.long	0x807
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0xf
+	.byte	0x29
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x10
+	.long	0x6a1
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0xf
+	.byte	0x2b
+	.byte	0x17
+	.long	0x66c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xe
+	.long	0xef
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x12
+	.long	0x642
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0xf
+	.byte	0x30
+	.byte	0x12
+	.long	0x642
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0xf
+	.byte	0x33
+	.byte	0x1e
+	.long	0x6ad
+	.byte	0x38
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2377
+	.byte	0x58
+	.byte	0xf
+	.byte	0x36
+	.byte	0x8
+	.long	0x802
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0xf
+	.byte	0x37
+	.byte	0xc
+	.long	0x82d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0xf
+	.byte	0x39
+	.byte	0x10
+	.long	0x841
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xf
+	.long	0x855
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0xf
+	.byte	0x3e
+	.byte	0xc
+	.long	0x86a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0xf
+	.byte	0x40
+	.byte	0xb
+	.long	0x885
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0xf
+	.byte	0x42
+	.byte	0xc
+	.long	0x89a
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0xf
+	.byte	0x45
+	.byte	0xb
+	.long	0x8b3
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0xf
+	.byte	0x47
+	.byte	0xc
+	.long	0x8cd
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0xf
+	.byte	0x49
+	.byte	0x10
+	.long	0x8f0
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x10
+	.long	0x909
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0xf
+	.byte	0x4e
+	.byte	0xc
+	.long	0x86a
+	.byte	0x50
+	.byte	0
+	.uleb128 0x13
+	.long	0x765
+	.uleb128 0x5
+	.long	0x802
+	.uleb128 0x6
+	.long	.LASF2389
+	.byte	0xf
+	.byte	0x34
+	.byte	0x3
+	.long	0x6ef
+	.uleb128 0x17
+	.long	0x828
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	0x80c
+	.uleb128 0x5
+	.long	0x818
+	.uleb128 0x18
+	.long	0xef
+	.long	0x841
+	.uleb128 0x2
+	.long	0x828
+	.byte	0
+	.uleb128 0x5
+	.long	0x832
+	.uleb128 0x18
+	.long	0xcd
+	.long	0x855
+	.uleb128 0x2
+	.long	0x828
+	.byte	0
+	.uleb128 0x5
+	.long	0x846
+	.uleb128 0x17
+	.long	0x86a
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x5
+	.long	0x85a
+	.uleb128 0x18
+	.long	0x87e
+	.long	0x87e
+	.uleb128 0x2
+	.long	0x828
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2390
+	.uleb128 0x5
+	.long	0x86f
+	.uleb128 0x17
+	.long	0x89a
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x6a1
+	.byte	0
+	.uleb128 0x5
+	.long	0x88a
+	.uleb128 0x18
+	.long	0x87e
+	.long	0x8b3
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x6c9
+	.byte	0
+	.uleb128 0x5
+	.long	0x89f
+	.uleb128 0x17
+	.long	0x8cd
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x5
+	.long	0x8b8
+	.uleb128 0x18
+	.long	0xef
+	.long	0x8eb
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x8eb
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x5
+	.long	0x8d2
+	.uleb128 0x18
+	.long	0x8eb
+	.long	0x909
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x5
+	.long	0x8f5
+	.uleb128 0xe
+	.long	.LASF2391
+	.byte	0x40
+	.byte	0x11
+	.byte	0x16
+	.byte	0x10
+	.long	0x95d
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x11
+	.byte	0x17
+	.byte	0x23
+	.long	0x6c9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x11
+	.byte	0x19
+	.byte	0x17
+	.long	0x63d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xe
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x11
+	.byte	0x1b
+	.byte	0xe
+	.long	0xe3
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x11
+	.byte	0x1d
+	.byte	0xd
+	.long	0x95d
+	.byte	0x14
+	.byte	0
+	.uleb128 0xc
+	.long	0xcd
+	.long	0x96d
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0x27
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2395
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x3
+	.long	0x90e
+	.uleb128 0x24
+	.byte	0xb8
+	.byte	0x12
+	.byte	0x1f
+	.long	0xa1e
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x12
+	.byte	0x20
+	.byte	0x12
+	.long	0x80c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x12
+	.byte	0x22
+	.byte	0x1a
+	.long	0xa1e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x12
+	.byte	0x23
+	.byte	0x1a
+	.long	0xa1e
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x12
+	.byte	0x24
+	.byte	0x1a
+	.long	0xa1e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x12
+	.byte	0x26
+	.byte	0xe
+	.long	0xef
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x12
+	.byte	0x27
+	.byte	0xe
+	.long	0xef
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x12
+	.byte	0x29
+	.byte	0xe
+	.long	0xe3
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x9
+	.long	0x87e
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x12
+	.byte	0x2c
+	.byte	0xe
+	.long	0xef
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x12
+	.byte	0x2d
+	.byte	0xe
+	.long	0xef
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x12
+	.byte	0x2f
+	.byte	0x14
+	.long	0xa23
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x12
+	.byte	0x31
+	.byte	0x15
+	.long	0x96d
+	.byte	0x78
+	.byte	0
+	.uleb128 0x5
+	.long	0x5db
+	.uleb128 0x5
+	.long	0x5b9
+	.uleb128 0x6
+	.long	.LASF2408
+	.byte	0x12
+	.byte	0x32
+	.byte	0x3
+	.long	0x979
+	.uleb128 0xc
+	.long	0x802
+	.long	0xa3f
+	.uleb128 0x33
+	.byte	0
+	.uleb128 0x13
+	.long	0xa34
+	.uleb128 0x29
+	.long	.LASF2410
+	.byte	0x12
+	.byte	0x34
+	.byte	0x26
+	.long	0xa3f
+	.uleb128 0x34
+	.long	.LASF2411
+	.value	0x2c8
+	.byte	0x1
+	.byte	0x31
+	.byte	0x10
+	.long	0xaae
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x1
+	.byte	0x32
+	.byte	0x10
+	.long	0xa28
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x1
+	.byte	0x33
+	.byte	0x9
+	.long	0x87e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x1
+	.byte	0x34
+	.byte	0x9
+	.long	0x70
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x1
+	.byte	0x35
+	.byte	0x9
+	.long	0x70
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x1
+	.byte	0x36
+	.byte	0x16
+	.long	0xabe
+	.byte	0xc4
+	.uleb128 0x35
+	.long	.LASF2375
+	.byte	0x1
+	.byte	0x37
+	.byte	0x16
+	.long	0xabe
+	.value	0x1c4
+	.byte	0
+	.uleb128 0xc
+	.long	0xd9
+	.long	0xabe
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x28
+	.long	0xaae
+	.uleb128 0x6
+	.long	.LASF2416
+	.byte	0x1
+	.byte	0x38
+	.byte	0x3
+	.long	0xa50
+	.uleb128 0xc
+	.long	0xac3
+	.long	0xadf
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2443
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x13
+	.long	0xacf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sitlUarts
+	.uleb128 0xc
+	.long	0x802
+	.long	0xb05
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xaf5
+	.uleb128 0x37
+	.long	0xa44
+	.byte	0x1
+	.value	0x109
+	.byte	0x1f
+	.long	0xb05
+	.uleb128 0x9
+	.byte	0x3
+	.quad	uartVTable
+	.uleb128 0x1f
+	.long	.LASF2419
+	.byte	0xf
+	.byte	0x64
+	.long	0xb37
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2417
+	.byte	0xf
+	.byte	0x63
+	.byte	0xa
+	.long	0x8eb
+	.long	0xb52
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2418
+	.byte	0xf
+	.byte	0x62
+	.byte	0xa
+	.long	0xef
+	.long	0xb72
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x8eb
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2420
+	.byte	0xf
+	.byte	0x61
+	.long	0xb8d
+	.uleb128 0x2
+	.long	0x828
+	.uleb128 0x2
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0xef
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2421
+	.byte	0xe
+	.byte	0x2c
+	.byte	0x5
+	.long	0x87e
+	.long	0xba8
+	.uleb128 0x2
+	.long	0xba8
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	0x642
+	.uleb128 0x8
+	.long	.LASF2422
+	.byte	0xe
+	.byte	0x33
+	.byte	0x5
+	.long	0x87e
+	.long	0xbc8
+	.uleb128 0x2
+	.long	0xba8
+	.uleb128 0x2
+	.long	0x8eb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2423
+	.byte	0xe
+	.byte	0x28
+	.byte	0xa
+	.long	0xe3
+	.long	0xbde
+	.uleb128 0x2
+	.long	0xbde
+	.byte	0
+	.uleb128 0x5
+	.long	0x64e
+	.uleb128 0x1f
+	.long	.LASF2424
+	.byte	0xe
+	.byte	0x36
+	.long	0xbf9
+	.uleb128 0x2
+	.long	0xba8
+	.uleb128 0x2
+	.long	0xe3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2425
+	.byte	0x13
+	.byte	0x8a
+	.byte	0x10
+	.long	0x2ea
+	.long	0xc1e
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xc1e
+	.uleb128 0x2
+	.long	0xfb
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	0xc23
+	.uleb128 0x38
+	.uleb128 0x8
+	.long	.LASF2426
+	.byte	0xe
+	.byte	0x35
+	.byte	0x10
+	.long	0x6ea
+	.long	0xc3f
+	.uleb128 0x2
+	.long	0xbde
+	.uleb128 0x2
+	.long	0xc3f
+	.byte	0
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x8
+	.long	.LASF2427
+	.byte	0xe
+	.byte	0x2d
+	.byte	0xa
+	.long	0xe3
+	.long	0xc64
+	.uleb128 0x2
+	.long	0xba8
+	.uleb128 0x2
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0xe3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2428
+	.byte	0x13
+	.byte	0x91
+	.byte	0x10
+	.long	0x2ea
+	.long	0xc89
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xa2
+	.uleb128 0x2
+	.long	0xfb
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2429
+	.byte	0xe
+	.byte	0x29
+	.byte	0xa
+	.long	0xe3
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0xbde
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2430
+	.byte	0x13
+	.value	0x132
+	.byte	0xc
+	.long	0x70
+	.long	0xcc0
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xcc5
+	.uleb128 0x2
+	.long	0xccf
+	.byte	0
+	.uleb128 0x5
+	.long	0x388
+	.uleb128 0x1e
+	.long	0xcc0
+	.uleb128 0x5
+	.long	0x316
+	.uleb128 0x1e
+	.long	0xcca
+	.uleb128 0x14
+	.long	.LASF2431
+	.byte	0x8
+	.value	0x164
+	.byte	0xc
+	.long	0x70
+	.long	0xcec
+	.uleb128 0x2
+	.long	0x30c
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2432
+	.byte	0x9
+	.value	0x166
+	.byte	0xc
+	.long	0x70
+	.long	0xd03
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2433
+	.byte	0x8
+	.value	0x15e
+	.byte	0xc
+	.long	0x70
+	.long	0xd20
+	.uleb128 0x2
+	.long	0x2fb
+	.uleb128 0x2
+	.long	0x311
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2434
+	.byte	0x14
+	.value	0x1a3
+	.byte	0xe
+	.long	0xb0
+	.long	0xd37
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF2473
+	.byte	0x16
+	.byte	0x25
+	.byte	0xd
+	.long	0xd43
+	.uleb128 0x5
+	.long	0x70
+	.uleb128 0x14
+	.long	.LASF2435
+	.byte	0x13
+	.value	0x128
+	.byte	0xc
+	.long	0x70
+	.long	0xd64
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2436
+	.byte	0x13
+	.byte	0x70
+	.byte	0xc
+	.long	0x70
+	.long	0xd84
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xd84
+	.uleb128 0x2
+	.long	0x316
+	.byte	0
+	.uleb128 0x5
+	.long	0x3b0
+	.uleb128 0x8
+	.long	.LASF2437
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa2
+	.long	0xda9
+	.uleb128 0x2
+	.long	0xa2
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xfb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2438
+	.byte	0x15
+	.byte	0x95
+	.byte	0xc
+	.long	0x70
+	.long	0xdc5
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2439
+	.byte	0x13
+	.value	0x115
+	.byte	0xc
+	.long	0x70
+	.long	0xdf0
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xc1e
+	.uleb128 0x2
+	.long	0x316
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2440
+	.byte	0x13
+	.byte	0x66
+	.byte	0xc
+	.long	0x70
+	.long	0xe10
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2441
+	.byte	0xe
+	.byte	0x23
+	.long	0xe2b
+	.uleb128 0x2
+	.long	0xba8
+	.uleb128 0x2
+	.long	0x63d
+	.uleb128 0x2
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2447
+	.byte	0x1
+	.value	0x104
+	.byte	0x6
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe95
+	.uleb128 0x3b
+	.long	.LASF2442
+	.byte	0x1
+	.value	0x104
+	.byte	0x1e
+	.long	0x828
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x3c
+	.string	"ch"
+	.byte	0x1
+	.value	0x104
+	.byte	0x30
+	.long	0xcd
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x3d
+	.quad	.LVL13
+	.long	0xb8d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x28
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2444
+	.byte	0xfb
+	.byte	0x9
+	.long	0xcd
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xef5
+	.uleb128 0xf
+	.long	.LASF2442
+	.byte	0xfb
+	.byte	0x20
+	.long	0x828
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3e
+	.string	"ch"
+	.byte	0x1
+	.byte	0xfd
+	.byte	0xd
+	.long	0xcd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0x10
+	.quad	.LVL10
+	.long	0xbad
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x18
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2445
+	.byte	0xf6
+	.byte	0x5
+	.long	0x87e
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf41
+	.uleb128 0xf
+	.long	.LASF2442
+	.byte	0xf6
+	.byte	0x2d
+	.long	0x828
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x10
+	.quad	.LVL7
+	.long	0xbc8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x28
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2446
+	.byte	0xf1
+	.byte	0xa
+	.long	0xef
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf8d
+	.uleb128 0xf
+	.long	.LASF2442
+	.byte	0xf1
+	.byte	0x2e
+	.long	0x828
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x10
+	.quad	.LVL4
+	.long	0xbc8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2448
+	.byte	0xec
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfc4
+	.uleb128 0x21
+	.long	.LASF2442
+	.byte	0xec
+	.byte	0x20
+	.long	0x828
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x21
+	.long	.LASF2371
+	.byte	0xec
+	.byte	0x35
+	.long	0x6a1
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2449
+	.byte	0xe7
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xffb
+	.uleb128 0x21
+	.long	.LASF2442
+	.byte	0xe7
+	.byte	0x24
+	.long	0x828
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x21
+	.long	.LASF2373
+	.byte	0xe7
+	.byte	0x37
+	.long	0xef
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2450
+	.byte	0x1
+	.byte	0xc9
+	.byte	0x6
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1349
+	.uleb128 0x2c
+	.string	"i"
+	.byte	0xcb
+	.byte	0xd
+	.long	0xcd
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x1a
+	.long	.LLRL18
+	.uleb128 0x26
+	.long	.LASF2451
+	.byte	0xce
+	.byte	0x15
+	.long	0x1349
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x26
+	.long	.LASF2396
+	.byte	0xcf
+	.byte	0x17
+	.long	0x828
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x40
+	.long	0x1365
+	.long	.LLRL21
+	.byte	0x1
+	.byte	0xe0
+	.byte	0xd
+	.long	0x1132
+	.uleb128 0x41
+	.long	0x136f
+	.uleb128 0x1a
+	.long	.LLRL21
+	.uleb128 0x42
+	.long	0x137b
+	.uleb128 0x1b
+	.long	0x1386
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x11
+	.long	0x1391
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x43
+	.long	0x139c
+	.long	.LLRL23
+	.uleb128 0x11
+	.long	0x139d
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1c
+	.long	0x1406
+	.quad	.LBI47
+	.byte	.LVU168
+	.long	.LLRL25
+	.byte	0xbb
+	.byte	0x11
+	.long	0x10d3
+	.uleb128 0x15
+	.long	0x1410
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x19
+	.quad	.LVL51
+	.long	0xcec
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL44
+	.long	0xbe3
+	.long	0x10eb
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL45
+	.long	0xc24
+	.long	0x1109
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL47
+	.long	0xbf9
+	.long	0x1122
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x4000
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL48
+	.long	0xd37
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x141d
+	.quad	.LBI55
+	.byte	.LVU180
+	.long	.LLRL27
+	.byte	0xd8
+	.byte	0xd
+	.long	0x11f3
+	.uleb128 0x15
+	.long	0x1427
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x1a
+	.long	.LLRL27
+	.uleb128 0x11
+	.long	0x1433
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1b
+	.long	0x143d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x7
+	.quad	.LVL55
+	.long	0xc9f
+	.long	0x118e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL71
+	.long	0xdc5
+	.long	0x11bb
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x36
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL72
+	.long	0xda9
+	.long	0x11d8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL73
+	.long	0xda9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.long	0x134e
+	.quad	.LBI58
+	.byte	.LVU190
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.byte	0x1
+	.byte	0xe2
+	.byte	0xd
+	.long	0x1252
+	.uleb128 0x15
+	.long	0x1358
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x7
+	.quad	.LVL59
+	.long	0xbc8
+	.long	0x123d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL60
+	.long	0xbe3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.long	0x13aa
+	.quad	.LBI60
+	.byte	.LVU201
+	.long	.LLRL31
+	.byte	0x1
+	.byte	0xdc
+	.byte	0xd
+	.uleb128 0x15
+	.long	0x13b4
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x1a
+	.long	.LLRL31
+	.uleb128 0x11
+	.long	0x13c0
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1b
+	.long	0x13cb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x11
+	.long	0x13d6
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x11
+	.long	0x13e1
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x11
+	.long	0x13ec
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x1c
+	.long	0x1406
+	.quad	.LBI62
+	.byte	.LVU244
+	.long	.LLRL37
+	.byte	0x9a
+	.byte	0x9
+	.long	0x12e9
+	.uleb128 0x15
+	.long	0x1410
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x19
+	.quad	.LVL80
+	.long	0xcec
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL65
+	.long	0xc64
+	.long	0x1306
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL75
+	.long	0xc89
+	.long	0x131e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -16
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL78
+	.long	0xd37
+	.uleb128 0x10
+	.quad	.LVL84
+	.long	0xc44
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -16
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xac3
+	.uleb128 0x1d
+	.long	.LASF2452
+	.byte	0xc4
+	.long	0x1365
+	.uleb128 0x12
+	.long	.LASF2396
+	.byte	0x1
+	.byte	0xc4
+	.byte	0x31
+	.long	0x828
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2453
+	.byte	0xab
+	.long	0x13aa
+	.uleb128 0x12
+	.long	.LASF2451
+	.byte	0x1
+	.byte	0xab
+	.byte	0x22
+	.long	0x1349
+	.uleb128 0xb
+	.long	.LASF2396
+	.byte	0xad
+	.byte	0x13
+	.long	0x828
+	.uleb128 0xb
+	.long	.LASF2454
+	.byte	0xaf
+	.byte	0xe
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF2455
+	.byte	0xb0
+	.byte	0x14
+	.long	0x6ea
+	.uleb128 0x46
+	.uleb128 0xb
+	.long	.LASF2456
+	.byte	0xb8
+	.byte	0x11
+	.long	0x2ea
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2457
+	.byte	0x89
+	.long	0x13f6
+	.uleb128 0x12
+	.long	.LASF2451
+	.byte	0x1
+	.byte	0x89
+	.byte	0x21
+	.long	0x1349
+	.uleb128 0xb
+	.long	.LASF2396
+	.byte	0x8b
+	.byte	0x13
+	.long	0x828
+	.uleb128 0xb
+	.long	.LASF2351
+	.byte	0x8c
+	.byte	0xd
+	.long	0x13f6
+	.uleb128 0xb
+	.long	.LASF2458
+	.byte	0x8d
+	.byte	0xc
+	.long	0xfb
+	.uleb128 0xb
+	.long	.LASF2459
+	.byte	0x97
+	.byte	0xd
+	.long	0x2ea
+	.uleb128 0x27
+	.string	"i"
+	.byte	0xa5
+	.byte	0xd
+	.long	0x2ea
+	.byte	0
+	.uleb128 0xc
+	.long	0xcd
+	.long	0x1406
+	.uleb128 0xd
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2460
+	.byte	0x83
+	.long	0x141d
+	.uleb128 0x12
+	.long	.LASF2451
+	.byte	0x1
+	.byte	0x83
+	.byte	0x2a
+	.long	0x1349
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2461
+	.byte	0x76
+	.long	0x1449
+	.uleb128 0x12
+	.long	.LASF2451
+	.byte	0x1
+	.byte	0x76
+	.byte	0x26
+	.long	0x1349
+	.uleb128 0x27
+	.string	"fd"
+	.byte	0x78
+	.byte	0x9
+	.long	0x70
+	.uleb128 0xb
+	.long	.LASF2462
+	.byte	0x7d
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2463
+	.byte	0x58
+	.byte	0xf
+	.long	0x828
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1722
+	.uleb128 0xf
+	.long	.LASF2406
+	.byte	0x58
+	.byte	0x27
+	.long	0xa23
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0xf
+	.long	.LASF2376
+	.byte	0x58
+	.byte	0x48
+	.long	0x6ad
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xf
+	.long	.LASF2373
+	.byte	0x58
+	.byte	0x5b
+	.long	0xef
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xf
+	.long	.LASF2371
+	.byte	0x58
+	.byte	0x70
+	.long	0x6a1
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0xf
+	.long	.LASF2372
+	.byte	0x58
+	.byte	0x88
+	.long	0x66c
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x26
+	.long	.LASF2451
+	.byte	0x60
+	.byte	0x11
+	.long	0x1349
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x2c
+	.string	"s"
+	.byte	0x61
+	.byte	0x11
+	.long	0x1722
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1c
+	.long	0x1727
+	.quad	.LBI15
+	.byte	.LVU80
+	.long	.LLRL12
+	.byte	0x64
+	.byte	0x1a
+	.long	0x16c5
+	.uleb128 0x15
+	.long	0x1738
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1a
+	.long	.LLRL12
+	.uleb128 0x1b
+	.long	0x1744
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1b
+	.long	0x174f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x11
+	.long	0x175a
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1c
+	.long	0x1783
+	.quad	.LBI17
+	.byte	.LVU106
+	.long	.LLRL15
+	.byte	0x4c
+	.byte	0x17
+	.long	0x155c
+	.uleb128 0x15
+	.long	0x1790
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL26
+	.long	0xdf0
+	.long	0x157d
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL28
+	.long	0xdc5
+	.long	0x15ae
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL29
+	.long	0xda9
+	.long	0x15ce
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL30
+	.long	0xda9
+	.long	0x15ee
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL32
+	.long	0xd64
+	.long	0x1615
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL33
+	.long	0xd48
+	.long	0x1635
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL34
+	.long	0xcd4
+	.long	0x166a
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x94
+	.byte	0x4
+	.byte	0xa
+	.value	0x1680
+	.byte	0x1c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x19
+	.quad	.LVL36
+	.long	0xd37
+	.uleb128 0x19
+	.quad	.LVL37
+	.long	0xd20
+	.uleb128 0x7
+	.quad	.LVL38
+	.long	0xd03
+	.long	0x16ac
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL39
+	.long	0xcec
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL18
+	.long	0xe10
+	.long	0x16f5
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x18
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0xc4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL19
+	.long	0xe10
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x28
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x1c4
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa28
+	.uleb128 0x2d
+	.long	.LASF2467
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xc
+	.long	0x70
+	.byte	0x1
+	.long	0x1765
+	.uleb128 0x12
+	.long	.LASF2464
+	.byte	0x1
+	.byte	0x3c
+	.byte	0x26
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF2465
+	.byte	0x3e
+	.byte	0x18
+	.long	0x551
+	.uleb128 0xb
+	.long	.LASF2466
+	.byte	0x3f
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x27
+	.string	"fd"
+	.byte	0x40
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2468
+	.byte	0x2
+	.byte	0x31
+	.byte	0x1
+	.long	0x77
+	.byte	0x3
+	.long	0x1783
+	.uleb128 0x12
+	.long	.LASF2469
+	.byte	0x2
+	.byte	0x31
+	.byte	0x18
+	.long	0x77
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF2470
+	.byte	0x2
+	.byte	0x22
+	.byte	0x1
+	.long	0x64
+	.byte	0x3
+	.uleb128 0x12
+	.long	.LASF2469
+	.byte	0x2
+	.byte	0x22
+	.byte	0x18
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 0
+.LLST3:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL12-.LVL11
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.LVL11
+	.uleb128 .LVL13-1-.LVL11
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-1-.LVL11
+	.uleb128 .LFE31-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 0
+.LLST4:
+	.byte	0x6
+	.quad	.LVL11
+	.byte	0x4
+	.uleb128 .LVL11-.LVL11
+	.uleb128 .LVL13-1-.LVL11
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-1-.LVL11
+	.uleb128 .LFE31-.LVL11
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST2:
+	.byte	0x6
+	.quad	.LVL8
+	.byte	0x4
+	.uleb128 .LVL8-.LVL8
+	.uleb128 .LVL9-.LVL8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.LVL8
+	.uleb128 .LVL10-1-.LVL8
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL10-1-.LVL8
+	.uleb128 .LFE30-.LVL8
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU20
+	.uleb128 .LVU20
+	.uleb128 .LVU21
+	.uleb128 .LVU21
+	.uleb128 0
+.LLST1:
+	.byte	0x6
+	.quad	.LVL5
+	.byte	0x4
+	.uleb128 .LVL5-.LVL5
+	.uleb128 .LVL6-.LVL5
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-.LVL5
+	.uleb128 .LVL7-1-.LVL5
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-1-.LVL5
+	.uleb128 .LFE29-.LVL5
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST0:
+	.byte	0x6
+	.quad	.LVL2
+	.byte	0x4
+	.uleb128 .LVL2-.LVL2
+	.uleb128 .LVL3-.LVL2
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.LVL2
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-1-.LVL2
+	.uleb128 .LFE28-.LVL2
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU133
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST17:
+	.byte	0x6
+	.quad	.LVL41
+	.byte	0x4
+	.uleb128 .LVL41-.LVL41
+	.uleb128 .LVL42-.LVL41
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.LVL41
+	.uleb128 .LVL50-.LVL41
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL41
+	.uleb128 .LVL52-.LVL41
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+752
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.LVL41
+	.uleb128 .LVL60-.LVL41
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.LVL41
+	.uleb128 .LVL61-.LVL41
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.LVL41
+	.uleb128 .LVL62-.LVL41
+	.uleb128 0x19
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+752
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL41
+	.uleb128 .LFE25-.LVL41
+	.uleb128 0x17
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU136
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+	.uleb128 .LVU179
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST19:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL50-.LVL42
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL42
+	.uleb128 .LVL53-.LVL42
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -752
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.LVL42
+	.uleb128 .LVL61-.LVL42
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.LVL42
+	.uleb128 .LVL62-.LVL42
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -752
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL42
+	.uleb128 .LFE25-.LVL42
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU137
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+	.uleb128 .LVU179
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 0
+.LLST20:
+	.byte	0x6
+	.quad	.LVL42
+	.byte	0x4
+	.uleb128 .LVL42-.LVL42
+	.uleb128 .LVL50-.LVL42
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL42
+	.uleb128 .LVL53-.LVL42
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+752
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL54-.LVL42
+	.uleb128 .LVL61-.LVL42
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.LVL42
+	.uleb128 .LVL62-.LVL42
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+752
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.LVL42
+	.uleb128 .LFE25-.LVL42
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU158
+	.uleb128 .LVU162
+.LLST22:
+	.byte	0x8
+	.quad	.LVL46
+	.uleb128 .LVL47-1-.LVL46
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU162
+	.uleb128 .LVU166
+.LLST24:
+	.byte	0x6
+	.quad	.LVL43
+	.byte	0x4
+	.uleb128 .LVL43-.LVL43
+	.uleb128 .LVL44-1-.LVL43
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.LVL43
+	.uleb128 .LVL48-1-.LVL43
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU168
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 .LVU178
+.LLST26:
+	.byte	0x6
+	.quad	.LVL49
+	.byte	0x4
+	.uleb128 .LVL49-.LVL49
+	.uleb128 .LVL50-.LVL49
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.LVL49
+	.uleb128 .LVL53-.LVL49
+	.uleb128 0x4
+	.byte	0x73
+	.sleb128 -752
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU180
+	.uleb128 .LVU186
+	.uleb128 .LVU224
+	.uleb128 .LVU234
+.LLST28:
+	.byte	0x6
+	.quad	.LVL54
+	.byte	0x4
+	.uleb128 .LVL54-.LVL54
+	.uleb128 .LVL57-.LVL54
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.LVL54
+	.uleb128 .LVL74-.LVL54
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU183
+	.uleb128 .LVU186
+	.uleb128 .LVU224
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU234
+.LLST29:
+	.byte	0x6
+	.quad	.LVL56
+	.byte	0x4
+	.uleb128 .LVL56-.LVL56
+	.uleb128 .LVL57-.LVL56
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.LVL56
+	.uleb128 .LVL71-1-.LVL56
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL71-1-.LVL56
+	.uleb128 .LVL74-.LVL56
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU190
+	.uleb128 .LVU194
+.LLST30:
+	.byte	0x8
+	.quad	.LVL58
+	.uleb128 .LVL60-.LVL58
+	.uleb128 0x2b
+	.byte	0x73
+	.sleb128 0
+	.byte	0x3
+	.quad	sitlUarts+40
+	.byte	0x1c
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0xa
+	.value	0x2c8
+	.byte	0xa8
+	.uleb128 0x2e
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU201
+	.uleb128 .LVU224
+	.uleb128 .LVU234
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+	.uleb128 0
+.LLST32:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL70-.LVL63
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.LVL63
+	.uleb128 .LVL81-.LVL63
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.LVL63
+	.uleb128 .LFE25-.LVL63
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU203
+	.uleb128 .LVU224
+	.uleb128 .LVU234
+	.uleb128 0
+.LLST33:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL70-.LVL63
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.LVL63
+	.uleb128 .LFE25-.LVL63
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU205
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 .LVU211
+	.uleb128 .LVU234
+	.uleb128 .LVU239
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+.LLST34:
+	.byte	0x6
+	.quad	.LVL63
+	.byte	0x4
+	.uleb128 .LVL63-.LVL63
+	.uleb128 .LVL64-.LVL63
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x100
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.LVL63
+	.uleb128 .LVL65-1-.LVL63
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.LVL63
+	.uleb128 .LVL76-.LVL63
+	.uleb128 0x4
+	.byte	0xa
+	.value	0x100
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.LVL63
+	.uleb128 .LVL77-.LVL63
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU211
+	.uleb128 .LVU217
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+.LLST35:
+	.byte	0x6
+	.quad	.LVL65
+	.byte	0x4
+	.uleb128 .LVL65-.LVL65
+	.uleb128 .LVL66-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-.LVL65
+	.uleb128 .LVL78-1-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.LVL65
+	.uleb128 .LVL84-1-.LVL65
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU218
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU222
+.LLST36:
+	.byte	0x6
+	.quad	.LVL67
+	.byte	0x4
+	.uleb128 .LVL67-.LVL67
+	.uleb128 .LVL68-.LVL67
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x130
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL68-.LVL67
+	.uleb128 .LVL69-.LVL67
+	.uleb128 0x9
+	.byte	0x76
+	.sleb128 0
+	.byte	0x91
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x23
+	.uleb128 0x12f
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU244
+	.uleb128 .LVU248
+.LLST38:
+	.byte	0x8
+	.quad	.LVL79
+	.uleb128 .LVL81-.LVL79
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -40
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST5:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LVL20-.LVL14
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL20-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL14
+	.uleb128 .LFE19-.LVL14
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 0
+.LLST6:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL21-.LVL14
+	.uleb128 .LVL23-.LVL14
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.LVL14
+	.uleb128 .LFE19-.LVL14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU76
+	.uleb128 .LVU76
+	.uleb128 0
+.LLST7:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LVL20-.LVL14
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL20-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL14
+	.uleb128 .LVL22-.LVL14
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL22-.LVL14
+	.uleb128 .LFE19-.LVL14
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU79
+	.uleb128 .LVU79
+	.uleb128 0
+.LLST8:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x4
+	.uleb128 .LVL21-.LVL14
+	.uleb128 .LVL24-.LVL14
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL24-.LVL14
+	.uleb128 .LFE19-.LVL14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 0
+.LLST9:
+	.byte	0x6
+	.quad	.LVL14
+	.byte	0x4
+	.uleb128 .LVL14-.LVL14
+	.uleb128 .LVL17-.LVL14
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL17-.LVL14
+	.uleb128 .LVL21-.LVL14
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.LVL14
+	.uleb128 .LVL26-1-.LVL14
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL26-1-.LVL14
+	.uleb128 .LFE19-.LVL14
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU46
+	.uleb128 .LVU50
+	.uleb128 .LVU50
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST10:
+	.byte	0x6
+	.quad	.LVL15
+	.byte	0x4
+	.uleb128 .LVL15-.LVL15
+	.uleb128 .LVL16-.LVL15
+	.uleb128 0x14
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0xa
+	.value	0x2c8
+	.byte	0x1e
+	.byte	0x3
+	.quad	sitlUarts
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.LVL15
+	.uleb128 .LVL20-.LVL15
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL21-.LVL15
+	.uleb128 .LFE19-.LVL15
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU50
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST11:
+	.byte	0x6
+	.quad	.LVL16
+	.byte	0x4
+	.uleb128 .LVL16-.LVL16
+	.uleb128 .LVL20-.LVL16
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL21-.LVL16
+	.uleb128 .LFE19-.LVL16
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU80
+	.uleb128 .LVU86
+	.uleb128 .LVU86
+	.uleb128 .LVU117
+	.uleb128 .LVU123
+	.uleb128 0
+.LLST13:
+	.byte	0x6
+	.quad	.LVL25
+	.byte	0x4
+	.uleb128 .LVL25-.LVL25
+	.uleb128 .LVL26-1-.LVL25
+	.uleb128 0x9
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x1681
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-1-.LVL25
+	.uleb128 .LVL34-.LVL25
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x1681
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.LVL25
+	.uleb128 .LFE19-.LVL25
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x1681
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU87
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 .LVU117
+	.uleb128 .LVU123
+	.uleb128 .LVU129
+.LLST14:
+	.byte	0x6
+	.quad	.LVL27
+	.byte	0x4
+	.uleb128 .LVL27-.LVL27
+	.uleb128 .LVL28-1-.LVL27
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL28-1-.LVL27
+	.uleb128 .LVL34-.LVL27
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0x4
+	.uleb128 .LVL35-.LVL27
+	.uleb128 .LVL40-.LVL27
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU106
+	.uleb128 .LVU108
+.LLST16:
+	.byte	0x8
+	.quad	.LVL31
+	.uleb128 .LVL31-.LVL31
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x1681
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x9c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL12:
+	.byte	0x5
+	.quad	.LBB15
+	.byte	0x4
+	.uleb128 .LBB15-.LBB15
+	.uleb128 .LBE15-.LBB15
+	.byte	0x4
+	.uleb128 .LBB25-.LBB15
+	.uleb128 .LBE25-.LBB15
+	.byte	0x4
+	.uleb128 .LBB26-.LBB15
+	.uleb128 .LBE26-.LBB15
+	.byte	0
+.LLRL15:
+	.byte	0x5
+	.quad	.LBB17
+	.byte	0x4
+	.uleb128 .LBB17-.LBB17
+	.uleb128 .LBE17-.LBB17
+	.byte	0x4
+	.uleb128 .LBB21-.LBB17
+	.uleb128 .LBE21-.LBB17
+	.byte	0x4
+	.uleb128 .LBB22-.LBB17
+	.uleb128 .LBE22-.LBB17
+	.byte	0
+.LLRL18:
+	.byte	0x5
+	.quad	.LBB43
+	.byte	0x4
+	.uleb128 .LBB43-.LBB43
+	.uleb128 .LBE43-.LBB43
+	.byte	0x4
+	.uleb128 .LBB77-.LBB43
+	.uleb128 .LBE77-.LBB43
+	.byte	0x4
+	.uleb128 .LBB78-.LBB43
+	.uleb128 .LBE78-.LBB43
+	.byte	0x4
+	.uleb128 .LBB79-.LBB43
+	.uleb128 .LBE79-.LBB43
+	.byte	0
+.LLRL21:
+	.byte	0x5
+	.quad	.LBB44
+	.byte	0x4
+	.uleb128 .LBB44-.LBB44
+	.uleb128 .LBE44-.LBB44
+	.byte	0x4
+	.uleb128 .LBB54-.LBB44
+	.uleb128 .LBE54-.LBB44
+	.byte	0
+.LLRL23:
+	.byte	0x5
+	.quad	.LBB46
+	.byte	0x4
+	.uleb128 .LBB46-.LBB46
+	.uleb128 .LBE46-.LBB46
+	.byte	0x4
+	.uleb128 .LBB51-.LBB46
+	.uleb128 .LBE51-.LBB46
+	.byte	0x4
+	.uleb128 .LBB52-.LBB46
+	.uleb128 .LBE52-.LBB46
+	.byte	0
+.LLRL25:
+	.byte	0x5
+	.quad	.LBB47
+	.byte	0x4
+	.uleb128 .LBB47-.LBB47
+	.uleb128 .LBE47-.LBB47
+	.byte	0x4
+	.uleb128 .LBB50-.LBB47
+	.uleb128 .LBE50-.LBB47
+	.byte	0
+.LLRL27:
+	.byte	0x5
+	.quad	.LBB55
+	.byte	0x4
+	.uleb128 .LBB55-.LBB55
+	.uleb128 .LBE55-.LBB55
+	.byte	0x4
+	.uleb128 .LBB73-.LBB55
+	.uleb128 .LBE73-.LBB55
+	.byte	0
+.LLRL31:
+	.byte	0x5
+	.quad	.LBB60
+	.byte	0x4
+	.uleb128 .LBB60-.LBB60
+	.uleb128 .LBE60-.LBB60
+	.byte	0x4
+	.uleb128 .LBB72-.LBB60
+	.uleb128 .LBE72-.LBB60
+	.byte	0x4
+	.uleb128 .LBB74-.LBB60
+	.uleb128 .LBE74-.LBB60
+	.byte	0x4
+	.uleb128 .LBB75-.LBB60
+	.uleb128 .LBE75-.LBB60
+	.byte	0x4
+	.uleb128 .LBB76-.LBB60
+	.uleb128 .LBE76-.LBB60
+	.byte	0
+.LLRL37:
+	.byte	0x5
+	.quad	.LBB62
+	.byte	0x4
+	.uleb128 .LBB62-.LBB62
+	.uleb128 .LBE62-.LBB62
+	.byte	0x4
+	.uleb128 .LBB66-.LBB62
+	.uleb128 .LBE66-.LBB62
+	.byte	0x4
+	.uleb128 .LBB67-.LBB62
+	.uleb128 .LBE67-.LBB62
+	.byte	0
+.LLRL39:
+	.byte	0x7
+	.quad	.LFB26
+	.uleb128 .LFE26-.LFB26
+	.byte	0x7
+	.quad	.LFB27
+	.uleb128 .LFE27-.LFB27
+	.byte	0x7
+	.quad	.LFB28
+	.uleb128 .LFE28-.LFB28
+	.byte	0x7
+	.quad	.LFB29
+	.uleb128 .LFE29-.LFB29
+	.byte	0x7
+	.quad	.LFB30
+	.uleb128 .LFE30-.LFB30
+	.byte	0x7
+	.quad	.LFB31
+	.uleb128 .LFE31-.LFB31
+	.byte	0x7
+	.quad	.LFB19
+	.uleb128 .LFE19-.LFB19
+	.byte	0x7
+	.quad	.LFB25
+	.uleb128 .LFE25-.LFB25
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF541
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF564
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF450
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF624
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF692
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF718
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF721
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF722
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF723
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF724
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF765
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF523
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF796
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF797
+	.file 53 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.file 54 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x36
+	.file 55 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF798
+	.file 56 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF933
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF935
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/fcntl.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1015
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x4
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/stat.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1025
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1490
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1491
+	.byte	0x4
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1492
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1493
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF694
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1504
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1505
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF694
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1507
+	.file 76 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1517
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1530
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1535
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1555
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1556
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1557
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1569
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1576
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1577
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 89 "/usr/include/x86_64-linux-gnu/asm/socket.h"
+	.byte	0x3
+	.uleb128 0x181
+	.uleb128 0x59
+	.file 90 "/usr/include/asm-generic/socket.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1751
+	.file 91 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1752
+	.file 92 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 93 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x5d
+	.file 94 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 95 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1761
+	.file 96 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 97 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 98 "/usr/include/x86_64-linux-gnu/asm/sockios.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x62
+	.file 99 "/usr/include/asm-generic/sockios.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 102 "/usr/include/netinet/tcp.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 103 ".//src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x67
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 104 ".//src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.file 105 ".//src/main/build_config.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 106 ".//src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6a
+	.byte	0x4
+	.file 107 ".//src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2206
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2207
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 108 ".//src/main/target/SITL/sitl.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2214
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2216
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF388
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF393
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF446
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF460
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF461
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF522
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF549
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF691
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF720
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF733
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF745
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF752
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF764
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF786
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF791
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF395
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF716
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF833
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF932
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntl.h.24.62c7e777a8b210e920ccbb92cfe8b9d8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF939
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntllinux.h.42.e9717a30ed0267ac6624070dc46eadc7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1011
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntl.h.40.4f7e26502dfa87273d18668eb9c6dc33,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1014
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1019
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1023
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_stat.h.24.58804b9fde232cb81d58c44500307576,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1032
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stat.h.29.cab33b67e546bcdba0ebb7d142404f85,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1051
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fcntl.h.80.34001020898245d8535bf89fc94e0aa0,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1082
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1099
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1161
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1173
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.210.b40c6c15db1d0b653f8dce03f258da9c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.233.b2a3d412932fd0d11e894d2fa61f02a7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1183
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1489
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.5e14431b902bc8f1e53bbf71898fdbe4,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1503
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.19.9d1901280ec9eab2830e2d550d553924,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1512
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1516
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1529
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1534
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1537
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1539
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1550
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1554
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1568
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1572
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1575
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1586
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1714
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket.h.192.eb10e7be020a473ce84a66db81ce6bec,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1750
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1756
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF621
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1760
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sockios.h.3.7ae89caef44885f67ccfdec206df4325,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1772
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket.h.9.ad61275896734f9826c69c5bb28c7264,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1860
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.socket.h.44.faa1ad965e926697db19cbab56850849,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1866
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.in.h.41.6a59d6a1707661b231dcfea9d9f6951a,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1997
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.in.h.43.4df33bb59d312ed38c2a8849594b8e72,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2069
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2086
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.tcp.h.33.467c8aca6d7abc3c3f84efd4517c587f,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2168
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.sitl_mcu.h.38.34f3ff01f3ddf3d692559e9b2f59bdc2,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2178
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.target.h.20.5cc5cacd333952e534f71caa99a41e3a,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2197
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.build_config.h.20.d35f33455f8f03101668b6ab1965b475,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2205
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.serial_uart.h.24.1bc399296ceffb0dfdf2f7e2024c7f2a,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2213
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1761:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF1336:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF1116:
+	.string	"_POSIX_THREADS 200809L"
+.LASF1034:
+	.string	"__S_IFDIR 0040000"
+.LASF1601:
+	.string	"PF_DECnet 12"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1806:
+	.string	"SO_PEERSEC 31"
+.LASF1813:
+	.string	"SCM_WIFI_STATUS SO_WIFI_STATUS"
+.LASF1908:
+	.string	"IP_PASSSEC 18"
+.LASF1768:
+	.string	"FIOGETOWN 0x8903"
+.LASF2199:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1889:
+	.string	"MCAST_JOIN_SOURCE_GROUP 46"
+.LASF1564:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1168:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF2093:
+	.string	"TCP_KEEPCNT 6"
+.LASF1875:
+	.string	"IP_MULTICAST_IF 32"
+.LASF1600:
+	.string	"PF_ROSE 11"
+.LASF1012:
+	.string	"__OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2264:
+	.string	"_unused2"
+.LASF1479:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF1422:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF1699:
+	.string	"SOL_RXRPC 272"
+.LASF1865:
+	.string	"__SOCKADDR_ARG struct sockaddr *__restrict"
+.LASF1249:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1297:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF2445:
+	.string	"isUartTransmitBufferEmpty"
+.LASF2250:
+	.string	"_fileno"
+.LASF1914:
+	.string	"IP_CHECKSUM 23"
+.LASF463:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1207:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF1205:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF1745:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF2305:
+	.string	"MSG_ZEROCOPY"
+.LASF1587:
+	.string	"PF_UNSPEC 0"
+.LASF1529:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2013:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF490:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF923:
+	.string	"EMEDIUMTYPE 124"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2025:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1688:
+	.string	"SOL_DECNET 261"
+.LASF1244:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF571:
+	.string	"__SQUAD_TYPE long int"
+.LASF1731:
+	.string	"MSG_SYN MSG_SYN"
+.LASF2019:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF1795:
+	.string	"SO_RCVTIMEO_OLD 20"
+.LASF2383:
+	.string	"setMode"
+.LASF1591:
+	.string	"PF_INET 2"
+.LASF451:
+	.string	"__USE_MISC 1"
+.LASF1017:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1147:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF2323:
+	.string	"IPPROTO_RSVP"
+.LASF989:
+	.string	"F_SHLCK 8"
+.LASF1878:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF1094:
+	.string	"_XOPEN_XPG2 1"
+.LASF1693:
+	.string	"SOL_IRDA 266"
+.LASF1335:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1014:
+	.string	"__pid_t_defined "
+.LASF1016:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1957:
+	.string	"IPV6_HDRINCL 36"
+.LASF1276:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF2391:
+	.string	"serialRxFrame_s"
+.LASF514:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1826:
+	.string	"SO_CNX_ADVICE 53"
+.LASF2068:
+	.string	"IP_MSFILTER_SIZE(numsrc) (sizeof (struct ip_msfilter) - sizeof (struct in_addr) + (numsrc) * sizeof (struct in_addr))"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2030:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1162:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF1643:
+	.string	"AF_IPX PF_IPX"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2223:
+	.string	"__uint8_t"
+.LASF1269:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF2320:
+	.string	"IPPROTO_TP"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1821:
+	.string	"SO_INCOMING_CPU 49"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2369:
+	.string	"vTable"
+.LASF2234:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2388:
+	.string	"txCommit"
+.LASF2390:
+	.string	"_Bool"
+.LASF525:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2178:
+	.string	"U_ID_2 0"
+.LASF1966:
+	.string	"IPV6_RTHDR 57"
+.LASF1236:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1982:
+	.string	"IPV6_FREEBIND 78"
+.LASF2126:
+	.string	"TCP_REPAIR_ON 1"
+.LASF1633:
+	.string	"PF_SMC 43"
+.LASF931:
+	.string	"ERFKILL 132"
+.LASF1546:
+	.string	"NFDBITS __NFDBITS"
+.LASF1562:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2060:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF467:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1763:
+	.string	"__BITS_PER_LONG 64"
+.LASF1531:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1742:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF1359:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1406:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF1505:
+	.string	"__clockid_t_defined 1"
+.LASF1237:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF2171:
+	.string	"GPIOC (&sitlGpio[2])"
+.LASF1866:
+	.string	"__CONST_SOCKADDR_ARG const struct sockaddr *"
+.LASF727:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1260:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF891:
+	.string	"ENOPROTOOPT 92"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2357:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF2340:
+	.string	"sockaddr_in"
+.LASF2282:
+	.string	"sa_family_t"
+.LASF418:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1275:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF1075:
+	.string	"R_OK 4"
+.LASF2278:
+	.string	"SOCK_DCCP"
+.LASF1818:
+	.string	"SO_BUSY_POLL 46"
+.LASF2311:
+	.string	"IPPROTO_IP"
+.LASF840:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF2023:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF2151:
+	.string	"SOL_TCP 6"
+.LASF2168:
+	.string	"TCP_MSS_DESIRED 1220U"
+.LASF1753:
+	.string	"_LINUX_STDDEF_H "
+.LASF904:
+	.string	"ENOBUFS 105"
+.LASF851:
+	.string	"EBADE 52"
+.LASF1370:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF2446:
+	.string	"uartTotalBytesWaiting"
+.LASF2363:
+	.string	"MODE_TX"
+.LASF719:
+	.string	"__need___va_list"
+.LASF2113:
+	.string	"TCP_CC_INFO 26"
+.LASF1857:
+	.string	"SO_SNDTIMEO SO_SNDTIMEO_OLD"
+.LASF1634:
+	.string	"PF_XDP 44"
+.LASF823:
+	.string	"EMFILE 24"
+.LASF2015:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF2144:
+	.string	"TCPOPT_TIMESTAMP 8"
+.LASF389:
+	.string	"_STDBOOL_H "
+.LASF799:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF1615:
+	.string	"PF_WANPIPE 25"
+.LASF875:
+	.string	"ENOTUNIQ 76"
+.LASF728:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF1382:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF488:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1691:
+	.string	"SOL_ATM 264"
+.LASF1451:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF1697:
+	.string	"SOL_NETLINK 270"
+.LASF1218:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2149:
+	.string	"TCP_MAXWIN 65535"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2233:
+	.string	"uint16_t"
+.LASF1115:
+	.string	"_XOPEN_SHM 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF621:
+	.string	"__FD_SETSIZE 1024"
+.LASF1126:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF2164:
+	.string	"TCP_COOKIE_OUT_NEVER (1 << 1)"
+.LASF2318:
+	.string	"IPPROTO_UDP"
+.LASF1727:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF2344:
+	.string	"sin_zero"
+.LASF2072:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF469:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1903:
+	.string	"IP_RECVTOS 13"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2236:
+	.string	"_flags"
+.LASF1785:
+	.string	"SO_OOBINLINE 10"
+.LASF1794:
+	.string	"SO_SNDLOWAT 19"
+.LASF1264:
+	.string	"_SC_POLL _SC_POLL"
+.LASF1623:
+	.string	"PF_RXRPC 33"
+.LASF746:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1365:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF1694:
+	.string	"SOL_NETBEUI 267"
+.LASF2042:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF817:
+	.string	"EXDEV 18"
+.LASF2011:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF1449:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF1867:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF1178:
+	.string	"__uid_t_defined "
+.LASF1188:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF2005:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF822:
+	.string	"ENFILE 23"
+.LASF659:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1069:
+	.string	"S_IXGRP (S_IXUSR >> 3)"
+.LASF568:
+	.string	"__U32_TYPE unsigned int"
+.LASF726:
+	.string	"__struct_FILE_defined 1"
+.LASF2412:
+	.string	"uartPort"
+.LASF733:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF908:
+	.string	"ETOOMANYREFS 109"
+.LASF1486:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1067:
+	.string	"S_IRGRP (S_IRUSR >> 3)"
+.LASF867:
+	.string	"EADV 68"
+.LASF1478:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF1153:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF2134:
+	.string	"TH_URG 0x20"
+.LASF742:
+	.string	"SEEK_SET 0"
+.LASF919:
+	.string	"EISNAM 120"
+.LASF2352:
+	.string	"mask"
+.LASF1804:
+	.string	"SO_PEERNAME 28"
+.LASF416:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF884:
+	.string	"ERESTART 85"
+.LASF1245:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF734:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1500:
+	.string	"__nlink_t_defined "
+.LASF883:
+	.string	"EILSEQ 84"
+.LASF1141:
+	.string	"_POSIX_SHELL 1"
+.LASF1111:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1774:
+	.string	"SO_DEBUG 1"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1216:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF2256:
+	.string	"_lock"
+.LASF1613:
+	.string	"PF_IRDA 23"
+.LASF2071:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF407:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1947:
+	.string	"IPV6_MTU 24"
+.LASF686:
+	.string	"UINT8_C(c) c"
+.LASF1626:
+	.string	"PF_IEEE802154 36"
+.LASF1163:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF1833:
+	.string	"SO_ZEROCOPY 60"
+.LASF1719:
+	.string	"__ss_aligntype unsigned long int"
+.LASF636:
+	.string	"INT16_MAX (32767)"
+.LASF526:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF747:
+	.string	"L_tmpnam 20"
+.LASF588:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2290:
+	.string	"MSG_CTRUNC"
+.LASF782:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1672:
+	.string	"AF_IUCV PF_IUCV"
+.LASF2303:
+	.string	"MSG_WAITFORONE"
+.LASF1086:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF1637:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF945:
+	.string	"O_EXCL 0200"
+.LASF1604:
+	.string	"PF_KEY 15"
+.LASF1484:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF1247:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1005:
+	.string	"POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2355:
+	.string	"highWaterMark"
+.LASF2022:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF1333:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2090:
+	.string	"TCP_CORK 3"
+.LASF1358:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1393:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF617:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF966:
+	.string	"O_NOFOLLOW __O_NOFOLLOW"
+.LASF486:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1577:
+	.string	"__have_pthread_attr_t 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2207:
+	.string	"SERIAL_RX_FRAME_MAX_SIZE 40"
+.LASF417:
+	.string	"__USE_ATFILE"
+.LASF1716:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF1002:
+	.string	"POSIX_FADV_RANDOM 1"
+.LASF2158:
+	.string	"TCP_MD5SIG_MAXKEYLEN 80"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2124:
+	.string	"TCP_CM_INQ TCP_INQ"
+.LASF707:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1644:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF2145:
+	.string	"TCPOLEN_TIMESTAMP 10"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1730:
+	.string	"MSG_FIN MSG_FIN"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1579:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF663:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2265:
+	.string	"FILE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF382:
+	.string	"__REVISION__ \"954f0a5\""
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1157:
+	.string	"_POSIX_TRACE -1"
+.LASF1671:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF838:
+	.string	"ENOTEMPTY 39"
+.LASF760:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF465:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2285:
+	.string	"sa_family"
+.LASF1217:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF2197:
+	.string	"FAST_MATH "
+.LASF2188:
+	.string	"BARO "
+.LASF2073:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF1832:
+	.string	"SO_PEERGROUPS 59"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1608:
+	.string	"PF_ASH 18"
+.LASF1713:
+	.string	"SOL_SMC 286"
+.LASF2107:
+	.string	"TCP_REPAIR_QUEUE 20"
+.LASF1958:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF794:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF973:
+	.string	"F_GETFL 3"
+.LASF808:
+	.string	"EBADF 9"
+.LASF816:
+	.string	"EEXIST 17"
+.LASF2157:
+	.string	"TCPI_OPT_SYN_DATA 32"
+.LASF1181:
+	.string	"L_SET SEEK_SET"
+.LASF398:
+	.string	"__USE_ISOC11"
+.LASF1930:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2288:
+	.string	"MSG_PEEK"
+.LASF2062:
+	.string	"s6_addr16 __in6_u.__u6_addr16"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1025:
+	.string	"_BITS_STAT_H 1"
+.LASF2166:
+	.string	"TCP_S_DATA_OUT (1 << 3)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1515:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2190:
+	.string	"USE_USART1 "
+.LASF1814:
+	.string	"SO_PEEK_OFF 42"
+.LASF1084:
+	.string	"_POSIX_VERSION 200809L"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1073:
+	.string	"S_IXOTH (S_IXGRP >> 3)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF509:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF766:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1402:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF2194:
+	.string	"SENSORS_SET (SENSOR_ACC | SENSOR_BARO)"
+.LASF1267:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1071:
+	.string	"S_IROTH (S_IRGRP >> 3)"
+.LASF1256:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1717:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF2001:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF633:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF855:
+	.string	"EBADRQC 56"
+.LASF1103:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1936:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1133:
+	.string	"_LFS_LARGEFILE 1"
+.LASF2293:
+	.string	"MSG_DONTWAIT"
+.LASF2037:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF1074:
+	.string	"S_IRWXO (S_IRWXG >> 3)"
+.LASF626:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1274:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1659:
+	.string	"AF_ECONET PF_ECONET"
+.LASF1828:
+	.string	"SO_MEMINFO 55"
+.LASF2081:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF2386:
+	.string	"readBuf"
+.LASF2242:
+	.string	"_IO_write_end"
+.LASF2109:
+	.string	"TCP_REPAIR_OPTIONS 22"
+.LASF1148:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF1416:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1888:
+	.string	"MCAST_LEAVE_GROUP 45"
+.LASF2384:
+	.string	"setRxFrameCallback"
+.LASF979:
+	.string	"__F_SETSIG 10"
+.LASF655:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1279:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF2310:
+	.string	"s_addr"
+.LASF598:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1325:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF1517:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF492:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF865:
+	.string	"EREMOTE 66"
+.LASF700:
+	.string	"_T_SIZE_ "
+.LASF1412:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF1339:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF1526:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF952:
+	.string	"O_FSYNC O_SYNC"
+.LASF1609:
+	.string	"PF_ECONET 19"
+.LASF899:
+	.string	"ENETDOWN 100"
+.LASF1534:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1392:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF482:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1839:
+	.string	"SO_TIMESTAMPING_OLD 37"
+.LASF1827:
+	.string	"SCM_TIMESTAMPING_OPT_STATS 54"
+.LASF1825:
+	.string	"SO_ATTACH_REUSEPORT_EBPF 52"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1892:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF956:
+	.string	"__O_CLOEXEC 02000000"
+.LASF2334:
+	.string	"IPPROTO_MPLS"
+.LASF2345:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1617:
+	.string	"PF_IB 27"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF722:
+	.string	"____mbstate_t_defined 1"
+.LASF821:
+	.string	"EINVAL 22"
+.LASF381:
+	.string	"__TARGET__ \"SITL\""
+.LASF2337:
+	.string	"IPPROTO_MPTCP"
+.LASF392:
+	.string	"false 0"
+.LASF1396:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1840:
+	.string	"SO_TIMESTAMP_NEW 63"
+.LASF790:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF789:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF842:
+	.string	"EIDRM 43"
+.LASF711:
+	.string	"_GCC_SIZE_T "
+.LASF547:
+	.string	"__stub_setlogin "
+.LASF1863:
+	.string	"SHUT_WR SHUT_WR"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF770:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2238:
+	.string	"_IO_read_end"
+.LASF791:
+	.string	"__STDIO_INLINE"
+.LASF990:
+	.string	"LOCK_SH 1"
+.LASF1424:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1377:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF1646:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF1029:
+	.string	"st_ctime st_ctim.tv_sec"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF549:
+	.string	"__stub_stty "
+.LASF2012:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF447:
+	.string	"__WORDSIZE 64"
+.LASF1143:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF1835:
+	.string	"SCM_TXTIME SO_TXTIME"
+.LASF535:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1433:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF1155:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF882:
+	.string	"ELIBEXEC 83"
+.LASF2420:
+	.string	"serialBufferWrite"
+.LASF684:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF917:
+	.string	"ENOTNAM 118"
+.LASF2201:
+	.string	"UNIT_TESTED "
+.LASF2301:
+	.string	"MSG_NOSIGNAL"
+.LASF992:
+	.string	"LOCK_NB 4"
+.LASF802:
+	.string	"ESRCH 3"
+.LASF1862:
+	.string	"SHUT_RD SHUT_RD"
+.LASF903:
+	.string	"ECONNRESET 104"
+.LASF1164:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF1104:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF1757:
+	.string	"__FD_SETSIZE"
+.LASF1841:
+	.string	"SO_TIMESTAMPNS_NEW 64"
+.LASF1052:
+	.string	"S_IFMT __S_IFMT"
+.LASF2069:
+	.string	"GROUP_FILTER_SIZE(numsrc) (sizeof (struct group_filter) - sizeof (struct sockaddr_storage) + ((numsrc) * sizeof (struct sockaddr_storage)))"
+.LASF1255:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF2211:
+	.string	"UART2_TX_BUFFER_SIZE 64"
+.LASF1756:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF963:
+	.string	"F_SETLK F_SETLK64"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2341:
+	.string	"sin_family"
+.LASF1663:
+	.string	"AF_IRDA PF_IRDA"
+.LASF1580:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF2056:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF1175:
+	.string	"STDOUT_FILENO 1"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2214:
+	.string	"SITL_MOTOR_COUNT 4"
+.LASF1847:
+	.string	"SO_BUSY_POLL_BUDGET 70"
+.LASF961:
+	.string	"__O_TMPFILE (020000000 | __O_DIRECTORY)"
+.LASF2014:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1886:
+	.string	"MCAST_BLOCK_SOURCE 43"
+.LASF1058:
+	.string	"S_IFLNK __S_IFLNK"
+.LASF2299:
+	.string	"MSG_RST"
+.LASF708:
+	.string	"_SIZE_T_DECLARED "
+.LASF453:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1680:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF1812:
+	.string	"SO_WIFI_STATUS 41"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF632:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1461:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2381:
+	.string	"serialSetBaudRate"
+.LASF745:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1729:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF1519:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF2275:
+	.string	"SOCK_RAW"
+.LASF2114:
+	.string	"TCP_SAVE_SYN 27"
+.LASF567:
+	.string	"__S32_TYPE int"
+.LASF2419:
+	.string	"serialBufferTxCommit"
+.LASF2103:
+	.string	"TCP_THIN_LINEAR_TIMEOUTS 16"
+.LASF2182:
+	.string	"FLASH_TO_RESERVE_FOR_CONFIG 0x2000"
+.LASF502:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF850:
+	.string	"EL2HLT 51"
+.LASF2280:
+	.string	"SOCK_CLOEXEC"
+.LASF1296:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF1594:
+	.string	"PF_APPLETALK 5"
+.LASF1498:
+	.string	"__ino_t_defined "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1512:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF913:
+	.string	"EALREADY 114"
+.LASF1388:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1042:
+	.string	"__S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF2123:
+	.string	"TCP_INQ 36"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1746:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF1381:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2467:
+	.string	"openListenSocket"
+.LASF1079:
+	.string	"F_ULOCK 0"
+.LASF1020:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1720:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF936:
+	.string	"__O_LARGEFILE 0"
+.LASF1606:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1026:
+	.string	"_BITS_STRUCT_STAT_H 1"
+.LASF1559:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1283:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1431:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF1967:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1737:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF1923:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF664:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1464:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF681:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1649:
+	.string	"AF_INET6 PF_INET6"
+.LASF964:
+	.string	"F_SETLKW F_SETLKW64"
+.LASF1906:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF2032:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF2224:
+	.string	"__uint16_t"
+.LASF785:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1766:
+	.string	"FIOSETOWN 0x8901"
+.LASF796:
+	.string	"_ERRNO_H 1"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1154:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2342:
+	.string	"sin_port"
+.LASF1872:
+	.string	"IP_RECVOPTS 6"
+.LASF862:
+	.string	"ENOSR 63"
+.LASF1083:
+	.string	"_UNISTD_H 1"
+.LASF358:
+	.string	"__k8 1"
+.LASF2286:
+	.string	"sa_data"
+.LASF1096:
+	.string	"_XOPEN_XPG4 1"
+.LASF402:
+	.string	"__USE_POSIX"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2428:
+	.string	"recv"
+.LASF1323:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1387:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF1177:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF818:
+	.string	"ENODEV 19"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1450:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF959:
+	.string	"__O_PATH 010000000"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1689:
+	.string	"SOL_X25 262"
+.LASF1952:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF1940:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF1348:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF1769:
+	.string	"SIOCGPGRP 0x8904"
+.LASF533:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF2007:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF1197:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF435:
+	.string	"_POSIX_SOURCE"
+.LASF713:
+	.string	"__size_t "
+.LASF662:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF876:
+	.string	"EBADFD 77"
+.LASF1361:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF1547:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1494:
+	.string	"__iovec_defined 1"
+.LASF2371:
+	.string	"mode"
+.LASF1007:
+	.string	"AT_FDCWD -100"
+.LASF1525:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF2154:
+	.string	"TCPI_OPT_WSCALE 4"
+.LASF1082:
+	.string	"F_TEST 3"
+.LASF2092:
+	.string	"TCP_KEEPINTVL 5"
+.LASF1470:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF484:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1629:
+	.string	"PF_NFC 39"
+.LASF1462:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF1938:
+	.string	"IPV6_AUTHHDR 10"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1652:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF1809:
+	.string	"SO_PROTOCOL 38"
+.LASF1927:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF1858:
+	.string	"SCM_TIMESTAMP SO_TIMESTAMP"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1605:
+	.string	"PF_NETLINK 16"
+.LASF2249:
+	.string	"_chain"
+.LASF519:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF984:
+	.string	"FD_CLOEXEC 1"
+.LASF1013:
+	.string	"__mode_t_defined "
+.LASF943:
+	.string	"O_RDWR 02"
+.LASF2427:
+	.string	"ringBufferWrite"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2036:
+	.string	"IN_CLASSA_MAX 128"
+.LASF781:
+	.string	"__f32x(x) x ##f32x"
+.LASF1321:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF1541:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1819:
+	.string	"SO_MAX_PACING_RATE 47"
+.LASF1306:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2281:
+	.string	"SOCK_NONBLOCK"
+.LASF1299:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF1329:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF642:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1597:
+	.string	"PF_ATMPVC 8"
+.LASF2117:
+	.string	"TCP_FASTOPEN_CONNECT 30"
+.LASF1823:
+	.string	"SO_DETACH_BPF SO_DETACH_FILTER"
+.LASF646:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1876:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF2218:
+	.string	"unsigned char"
+.LASF629:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF656:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1353:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF534:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1970:
+	.string	"IPV6_PATHMTU 61"
+.LASF2338:
+	.string	"IPPROTO_MAX"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1233:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF2274:
+	.string	"SOCK_DGRAM"
+.LASF2067:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF2472:
+	.string	"_IO_lock_t"
+.LASF1399:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF806:
+	.string	"E2BIG 7"
+.LASF2464:
+	.string	"tcpPort"
+.LASF2349:
+	.string	"float"
+.LASF2370:
+	.string	"identifier"
+.LASF1635:
+	.string	"PF_MCTP 45"
+.LASF2331:
+	.string	"IPPROTO_COMP"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1032:
+	.string	"_STATBUF_ST_NSEC "
+.LASF400:
+	.string	"__USE_ISOC95"
+.LASF1854:
+	.string	"SO_TIMESTAMPNS SO_TIMESTAMPNS_OLD"
+.LASF399:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1190:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF1614:
+	.string	"PF_PPPOX 24"
+.LASF683:
+	.string	"INT16_C(c) c"
+.LASF1514:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1685:
+	.string	"AF_MCTP PF_MCTP"
+.LASF2385:
+	.string	"writeBuf"
+.LASF1118:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF2184:
+	.string	"GYRO "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1902:
+	.string	"IP_RECVTTL 12"
+.LASF1357:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF805:
+	.string	"ENXIO 6"
+.LASF1898:
+	.string	"IP_PKTOPTIONS 9"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1751:
+	.string	"__ASM_GENERIC_SOCKET_H "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2172:
+	.string	"USART1 (&sitlUsart[0])"
+.LASF1582:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF628:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1973:
+	.string	"IPV6_TCLASS 67"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1521:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1885:
+	.string	"MCAST_JOIN_GROUP 42"
+.LASF1426:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF530:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1510:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF409:
+	.string	"__USE_XOPEN2K"
+.LASF1946:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF2409:
+	.string	"stderr"
+.LASF405:
+	.string	"__USE_POSIX199506"
+.LASF1942:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF2200:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2193:
+	.string	"SITL_TCP_BASE_PORT 5760"
+.LASF470:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF888:
+	.string	"EDESTADDRREQ 89"
+.LASF1041:
+	.string	"__S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1971:
+	.string	"IPV6_DONTFRAG 62"
+.LASF429:
+	.string	"_DEFAULT_SOURCE"
+.LASF2216:
+	.string	"SITL_UART_BUFFER_SIZE 256"
+.LASF983:
+	.string	"F_DUPFD_CLOEXEC 1030"
+.LASF1193:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1492:
+	.string	"_NETINET_IN_H 1"
+.LASF1100:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF1493:
+	.string	"_SYS_SOCKET_H 1"
+.LASF651:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1441:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF508:
+	.string	"__wur "
+.LASF1965:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF693:
+	.string	"_STDIO_H 1"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF793:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2411:
+	.string	"sitlUart_s"
+.LASF2416:
+	.string	"sitlUart_t"
+.LASF471:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1499:
+	.string	"__dev_t_defined "
+.LASF2179:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1845:
+	.string	"SO_DETACH_REUSEPORT_BPF 68"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1673:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1950:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF1138:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF1901:
+	.string	"IP_RECVERR 11"
+.LASF1969:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF1281:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF1924:
+	.string	"SOL_IP 0"
+.LASF1504:
+	.string	"__clock_t_defined 1"
+.LASF2050:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF430:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1507:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2379:
+	.string	"serialTotalBytesWaiting"
+.LASF951:
+	.string	"O_SYNC 04010000"
+.LASF2405:
+	.string	"rxDMAPeripheralBaseAddr"
+.LASF2079:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF1250:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1369:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1714:
+	.string	"SOMAXCONN 4096"
+.LASF1686:
+	.string	"AF_MAX PF_MAX"
+.LASF1294:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF2170:
+	.string	"GPIOB (&sitlGpio[1])"
+.LASF1166:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF1107:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF1540:
+	.string	"__NFDBITS"
+.LASF468:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1495:
+	.string	"__BITS_SOCKET_H "
+.LASF630:
+	.string	"__intptr_t_defined "
+.LASF638:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF649:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF524:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2430:
+	.string	"accept"
+.LASF1974:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF481:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2167:
+	.string	"TCP_MSS_DEFAULT 536U"
+.LASF1087:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF376:
+	.string	"unix 1"
+.LASF1764:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF887:
+	.string	"ENOTSOCK 88"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2057:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF1782:
+	.string	"SO_SNDBUFFORCE 32"
+.LASF572:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2423:
+	.string	"ringBufferCount"
+.LASF2198:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1789:
+	.string	"SO_BSDCOMPAT 14"
+.LASF1009:
+	.string	"AT_REMOVEDIR 0x200"
+.LASF412:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF869:
+	.string	"ECOMM 70"
+.LASF1919:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF2133:
+	.string	"TH_ACK 0x10"
+.LASF1453:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF1506:
+	.string	"__timer_t_defined 1"
+.LASF1286:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF834:
+	.string	"EDEADLK 35"
+.LASF2291:
+	.string	"MSG_PROXY"
+.LASF666:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1741:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF718:
+	.string	"__need___va_list "
+.LASF880:
+	.string	"ELIBSCN 81"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF450:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2241:
+	.string	"_IO_write_ptr"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF744:
+	.string	"SEEK_END 2"
+.LASF2047:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1855:
+	.string	"SO_TIMESTAMPING SO_TIMESTAMPING_OLD"
+.LASF1536:
+	.string	"____sigset_t_defined "
+.LASF2380:
+	.string	"serialRead"
+.LASF1508:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF870:
+	.string	"EPROTO 71"
+.LASF2329:
+	.string	"IPPROTO_ENCAP"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2045:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1262:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF1987:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF688:
+	.string	"UINT32_C(c) c ## U"
+.LASF1598:
+	.string	"PF_X25 9"
+.LASF1797:
+	.string	"SO_SECURITY_AUTHENTICATION 22"
+.LASF1595:
+	.string	"PF_NETROM 6"
+.LASF1105:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1337:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF579:
+	.string	"__STD_TYPE typedef"
+.LASF809:
+	.string	"ECHILD 10"
+.LASF2295:
+	.string	"MSG_WAITALL"
+.LASF1743:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF852:
+	.string	"EBADR 53"
+.LASF1585:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF1018:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1776:
+	.string	"SO_TYPE 3"
+.LASF2374:
+	.string	"rxBuffer"
+.LASF1090:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF2403:
+	.string	"txDMAEmpty"
+.LASF773:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1315:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF685:
+	.string	"INT64_C(c) c ## L"
+.LASF1625:
+	.string	"PF_PHONET 35"
+.LASF1999:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF1864:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF1376:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF421:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF622:
+	.string	"_BITS_TIME64_H 1"
+.LASF1415:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF1972:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF1195:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF661:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF602:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF494:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF2046:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF1004:
+	.string	"POSIX_FADV_WILLNEED 3"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF994:
+	.string	"FAPPEND O_APPEND"
+.LASF756:
+	.string	"__attr_dealloc_fclose"
+.LASF414:
+	.string	"__USE_LARGEFILE64"
+.LASF1142:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF698:
+	.string	"_SIZE_T "
+.LASF1918:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF510:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2035:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF972:
+	.string	"F_SETFD 2"
+.LASF566:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2085:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF1522:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF505:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1362:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF695:
+	.string	"__need_NULL "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF999:
+	.string	"__POSIX_FADV_DONTNEED 4"
+.LASF1384:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF495:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF759:
+	.string	"__HAVE_FLOAT128 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2082:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2038:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF900:
+	.string	"ENETUNREACH 101"
+.LASF1174:
+	.string	"STDIN_FILENO 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2089:
+	.string	"TCP_MAXSEG 2"
+.LASF393:
+	.string	"__bool_true_false_are_defined 1"
+.LASF725:
+	.string	"__FILE_defined 1"
+.LASF768:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1389:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF1331:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF1001:
+	.string	"POSIX_FADV_NORMAL 0"
+.LASF710:
+	.string	"___int_size_t_h "
+.LASF2061:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF2397:
+	.string	"rxDMAChannel"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF705:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2008:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF2235:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1511:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1465:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF953:
+	.string	"O_ASYNC 020000"
+.LASF861:
+	.string	"ETIME 62"
+.LASF833:
+	.string	"ERANGE 34"
+.LASF896:
+	.string	"EAFNOSUPPORT 97"
+.LASF1808:
+	.string	"SO_MARK 36"
+.LASF604:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2232:
+	.string	"uint8_t"
+.LASF1037:
+	.string	"__S_IFREG 0100000"
+.LASF1204:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF1934:
+	.string	"IPV6_CHECKSUM 7"
+.LASF2429:
+	.string	"ringBufferFree"
+.LASF544:
+	.string	"__stub_fchflags "
+.LASF750:
+	.string	"L_ctermid 9"
+.LASF456:
+	.string	"__GNU_LIBRARY__"
+.LASF570:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1173:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1799:
+	.string	"SO_SECURITY_ENCRYPTION_NETWORK 24"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2141:
+	.string	"TCPOPT_SACK_PERMITTED 4"
+.LASF1569:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1214:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF1994:
+	.string	"SOL_ICMPV6 58"
+.LASF1624:
+	.string	"PF_ISDN 34"
+.LASF2347:
+	.string	"unused"
+.LASF1744:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF406:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF2043:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF428:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2458:
+	.string	"maxCount"
+.LASF1314:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF448:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2026:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1132:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF537:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1853:
+	.string	"SO_TIMESTAMP SO_TIMESTAMP_OLD"
+.LASF522:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1760:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF1271:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF1287:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF2313:
+	.string	"IPPROTO_IGMP"
+.LASF583:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF800:
+	.string	"EPERM 1"
+.LASF678:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2454:
+	.string	"length"
+.LASF2245:
+	.string	"_IO_save_base"
+.LASF529:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF901:
+	.string	"ENETRESET 102"
+.LASF694:
+	.string	"__need_size_t "
+.LASF2297:
+	.string	"MSG_SYN"
+.LASF1690:
+	.string	"SOL_PACKET 263"
+.LASF1998:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF2270:
+	.string	"socklen_t"
+.LASF1992:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF1472:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF940:
+	.string	"O_ACCMODE 0003"
+.LASF1134:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF432:
+	.string	"__USE_ISOC99 1"
+.LASF1354:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF1280:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1578:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2322:
+	.string	"IPPROTO_IPV6"
+.LASF764:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2155:
+	.string	"TCPI_OPT_ECN 8"
+.LASF528:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF703:
+	.string	"_SIZE_T_ "
+.LASF1509:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1110:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF1272:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF1076:
+	.string	"W_OK 2"
+.LASF1240:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF714:
+	.string	"__need_size_t"
+.LASF1701:
+	.string	"SOL_BLUETOOTH 274"
+.LASF1558:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1954:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF1425:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1380:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF2447:
+	.string	"uartWrite"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF845:
+	.string	"EL3HLT 46"
+.LASF2255:
+	.string	"_shortbuf"
+.LASF1448:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF2002:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF1455:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1050:
+	.string	"UTIME_NOW ((1l << 30) - 1l)"
+.LASF2204:
+	.string	"TIME_SECTION_BEGIN(index) {}"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF676:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1983:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2451:
+	.string	"uart"
+.LASF692:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2029:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF691:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF408:
+	.string	"__USE_UNIX98"
+.LASF2262:
+	.string	"__pad5"
+.LASF2259:
+	.string	"_wide_data"
+.LASF1887:
+	.string	"MCAST_UNBLOCK_SOURCE 44"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1891:
+	.string	"MCAST_MSFILTER 48"
+.LASF474:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF857:
+	.string	"EDEADLOCK EDEADLK"
+.LASF980:
+	.string	"__F_GETSIG 11"
+.LASF1653:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF2389:
+	.string	"serialPort_t"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1932:
+	.string	"IPV6_2292RTHDR 5"
+.LASF2180:
+	.string	"FLASH_PAGE_COUNT 4"
+.LASF1191:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF970:
+	.string	"F_DUPFD 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF545:
+	.string	"__stub_gtty "
+.LASF1838:
+	.string	"SO_TIMESTAMPNS_OLD 35"
+.LASF1109:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF616:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2321:
+	.string	"IPPROTO_DCCP"
+.LASF1639:
+	.string	"AF_UNIX PF_UNIX"
+.LASF1593:
+	.string	"PF_IPX 4"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2424:
+	.string	"ringBufferConsume"
+.LASF1676:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF1334:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF2438:
+	.string	"fcntl"
+.LASF2099:
+	.string	"TCP_QUICKACK 12"
+.LASF765:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2039:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF1062:
+	.string	"S_ISVTX __S_ISVTX"
+.LASF1122:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF2442:
+	.string	"instance"
+.LASF1669:
+	.string	"AF_CAN PF_CAN"
+.LASF1440:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF643:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF618:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1824:
+	.string	"SO_ATTACH_REUSEPORT_CBPF 51"
+.LASF1259:
+	.string	"_SC_PII _SC_PII"
+.LASF2304:
+	.string	"MSG_BATCH"
+.LASF1645:
+	.string	"AF_NETROM PF_NETROM"
+.LASF689:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1755:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF763:
+	.string	"__f128(x) x ##f128"
+.LASF1758:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF1553:
+	.string	"__fsblkcnt_t_defined "
+.LASF1340:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF644:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1135:
+	.string	"_LFS64_STDIO 1"
+.LASF1648:
+	.string	"AF_X25 PF_X25"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1307:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF1747:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF720:
+	.string	"__GNUC_VA_LIST "
+.LASF1589:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF2210:
+	.string	"UART2_RX_BUFFER_SIZE 128"
+.LASF985:
+	.string	"F_RDLCK 0"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1429:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1627:
+	.string	"PF_CAIF 37"
+.LASF1265:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF2195:
+	.string	"BLACKBOX "
+.LASF1460:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF1230:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF1728:
+	.string	"MSG_EOR MSG_EOR"
+.LASF948:
+	.string	"O_APPEND 02000"
+.LASF1563:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2471:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -ffunction-sections -fdata-sections -fcommon -fasynchronous-unwind-tables"
+.LASF1679:
+	.string	"AF_NFC PF_NFC"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1458:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF1810:
+	.string	"SO_DOMAIN 39"
+.LASF1883:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF387:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1097:
+	.string	"_XOPEN_UNIX 1"
+.LASF2394:
+	.string	"readPosition"
+.LASF1860:
+	.string	"SCM_TIMESTAMPING SO_TIMESTAMPING"
+.LASF1678:
+	.string	"AF_ALG PF_ALG"
+.LASF1430:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF580:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1423:
+	.string	"_CS_PATH _CS_PATH"
+.LASF2231:
+	.string	"__socklen_t"
+.LASF859:
+	.string	"ENOSTR 60"
+.LASF1261:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF2315:
+	.string	"IPPROTO_TCP"
+.LASF739:
+	.string	"_IONBF 2"
+.LASF2465:
+	.string	"address"
+.LASF837:
+	.string	"ENOSYS 38"
+.LASF2213:
+	.string	"UART3_TX_BUFFER_SIZE 64"
+.LASF2418:
+	.string	"serialBufferRead"
+.LASF1055:
+	.string	"S_IFBLK __S_IFBLK"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1796:
+	.string	"SO_SNDTIMEO_OLD 21"
+.LASF1180:
+	.string	"__socklen_t_defined "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF653:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1962:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF489:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2433:
+	.string	"fprintf"
+.LASF1391:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF748:
+	.string	"TMP_MAX 238328"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1078:
+	.string	"F_OK 0"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF715:
+	.string	"NULL"
+.LASF1092:
+	.string	"_XOPEN_VERSION 700"
+.LASF906:
+	.string	"ENOTCONN 107"
+.LASF1803:
+	.string	"SO_GET_FILTER SO_ATTACH_FILTER"
+.LASF2206:
+	.string	"RING_BUFFER_MAX_SIZE 32768"
+.LASF1551:
+	.string	"__blksize_t_defined "
+.LASF1554:
+	.string	"__fsfilcnt_t_defined "
+.LASF2229:
+	.string	"__ssize_t"
+.LASF1196:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF1603:
+	.string	"PF_SECURITY 14"
+.LASF2406:
+	.string	"USARTx"
+.LASF1301:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF922:
+	.string	"ENOMEDIUM 123"
+.LASF595:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1800:
+	.string	"SO_BINDTODEVICE 25"
+.LASF892:
+	.string	"EPROTONOSUPPORT 93"
+.LASF1112:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF462:
+	.string	"__PMT"
+.LASF1722:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF1910:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF1735:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF1189:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2434:
+	.string	"strerror"
+.LASF1567:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2410:
+	.string	"uartVTable"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1856:
+	.string	"SO_RCVTIMEO SO_RCVTIMEO_OLD"
+.LASF811:
+	.string	"ENOMEM 12"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1905:
+	.string	"IP_FREEBIND 15"
+.LASF1692:
+	.string	"SOL_AAL 265"
+.LASF1106:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2398:
+	.string	"txDMAChannel"
+.LASF1759:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF1420:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF1586:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF1405:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF1273:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF1544:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1332:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF1341:
+	.string	"_SC_BASE _SC_BASE"
+.LASF807:
+	.string	"ENOEXEC 8"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF690:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1145:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1485:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1483:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1612:
+	.string	"PF_SNA 22"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF2105:
+	.string	"TCP_USER_TIMEOUT 18"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF761:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF735:
+	.string	"__off_t_defined "
+.LASF543:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1311:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF1968:
+	.string	"IPV6_DSTOPTS 59"
+.LASF1610:
+	.string	"PF_ATMSVC 20"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF986:
+	.string	"F_WRLCK 1"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1696:
+	.string	"SOL_DCCP 269"
+.LASF1031:
+	.string	"_STATBUF_ST_RDEV "
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF2463:
+	.string	"uartOpen"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1124:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1467:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF569:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF836:
+	.string	"ENOLCK 37"
+.LASF885:
+	.string	"ESTRPIPE 86"
+.LASF1487:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1203:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF670:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC__ 2"
+.LASF2086:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF657:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF637:
+	.string	"INT32_MAX (2147483647)"
+.LASF1630:
+	.string	"PF_VSOCK 40"
+.LASF1128:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF2441:
+	.string	"ringBufferInit"
+.LASF1977:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF1238:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF2227:
+	.string	"__off_t"
+.LASF1409:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF2083:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF472:
+	.string	"__P(args) args"
+.LASF777:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1837:
+	.string	"SO_TIMESTAMP_OLD 29"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1674:
+	.string	"AF_ISDN PF_ISDN"
+.LASF669:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF647:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF699:
+	.string	"_SYS_SIZE_T_H "
+.LASF594:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF893:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF1179:
+	.string	"__useconds_t_defined "
+.LASF2437:
+	.string	"memset"
+.LASF1836:
+	.string	"SO_BINDTOIFINDEX 62"
+.LASF1981:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF2393:
+	.string	"ringSize"
+.LASF1740:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF1488:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1482:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF729:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF982:
+	.string	"__F_GETOWN_EX 16"
+.LASF1767:
+	.string	"SIOCSPGRP 0x8902"
+.LASF1243:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF2063:
+	.string	"s6_addr32 __in6_u.__u6_addr32"
+.LASF889:
+	.string	"EMSGSIZE 90"
+.LASF1185:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF1468:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF1851:
+	.string	"SO_TXREHASH 74"
+.LASF420:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1882:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF1989:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF937:
+	.string	"F_GETLK64 5"
+.LASF2054:
+	.string	"IN_LOOPBACKNET 127"
+.LASF2436:
+	.string	"bind"
+.LASF1995:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF2289:
+	.string	"MSG_DONTROUTE"
+.LASF1917:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF2247:
+	.string	"_IO_save_end"
+.LASF1539:
+	.string	"__suseconds_t_defined "
+.LASF976:
+	.string	"__F_GETOWN 9"
+.LASF1781:
+	.string	"SO_RCVBUF 8"
+.LASF1820:
+	.string	"SO_BPF_EXTENSIONS 48"
+.LASF674:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF605:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF635:
+	.string	"INT8_MAX (127)"
+.LASF1556:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF925:
+	.string	"ENOKEY 126"
+.LASF1548:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1006:
+	.string	"POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE"
+.LASF1363:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF1899:
+	.string	"IP_PMTUDISC 10"
+.LASF411:
+	.string	"__USE_XOPEN2K8"
+.LASF677:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF895:
+	.string	"EPFNOSUPPORT 96"
+.LASF1703:
+	.string	"SOL_RDS 276"
+.LASF1367:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1532:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF606:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF717:
+	.string	"__need_NULL"
+.LASF1212:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF1683:
+	.string	"AF_SMC PF_SMC"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1231:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF1151:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF449:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF413:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2185:
+	.string	"USE_GYRO_SITL "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF573:
+	.string	"__SWORD_TYPE long int"
+.LASF1102:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF902:
+	.string	"ECONNABORTED 103"
+.LASF1170:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF2450:
+	.string	"sitlSerialPoll"
+.LASF2364:
+	.string	"MODE_RXTX"
+.LASF441:
+	.string	"__USE_POSIX199309 1"
+.LASF927:
+	.string	"EKEYREVOKED 128"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2065:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF1246:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF1715:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF497:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1251:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF623:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF968:
+	.string	"O_DSYNC __O_DSYNC"
+.LASF723:
+	.string	"_____fpos64_t_defined 1"
+.LASF1712:
+	.string	"SOL_MCTP 285"
+.LASF1788:
+	.string	"SO_LINGER 13"
+.LASF2077:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF965:
+	.string	"O_DIRECTORY __O_DIRECTORY"
+.LASF832:
+	.string	"EDOM 33"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF749:
+	.string	"FILENAME_MAX 4096"
+.LASF1928:
+	.string	"IPV6_ADDRFORM 1"
+.LASF1327:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF1355:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF1628:
+	.string	"PF_ALG 38"
+.LASF792:
+	.string	"_STRING_H 1"
+.LASF1419:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF762:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2115:
+	.string	"TCP_SAVED_SYN 28"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1491:
+	.string	"_GETOPT_CORE_H 1"
+.LASF591:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1573:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1146:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF905:
+	.string	"EISCONN 106"
+.LASF2127:
+	.string	"TCP_REPAIR_OFF 0"
+.LASF1308:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF2097:
+	.string	"TCP_WINDOW_CLAMP 10"
+.LASF1130:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF532:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1976:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1407:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF2219:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2078:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF1660:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF2087:
+	.string	"_NETINET_TCP_H 1"
+.LASF2221:
+	.string	"signed char"
+.LASF778:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1347:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1749:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF847:
+	.string	"ELNRNG 48"
+.LASF1030:
+	.string	"_STATBUF_ST_BLKSIZE "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2132:
+	.string	"TH_PUSH 0x08"
+.LASF696:
+	.string	"__size_t__ "
+.LASF1937:
+	.string	"IPV6_NEXTHOP 9"
+.LASF443:
+	.string	"__USE_XOPEN2K 1"
+.LASF1397:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF2273:
+	.string	"SOCK_STREAM"
+.LASF2300:
+	.string	"MSG_ERRQUEUE"
+.LASF2120:
+	.string	"TCP_FASTOPEN_KEY 33"
+.LASF1395:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1725:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF1959:
+	.string	"IPV6_PKTINFO 50"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1829:
+	.string	"SO_INCOMING_NAPI_ID 56"
+.LASF498:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1024:
+	.string	"__time_t_defined 1"
+.LASF1524:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1516:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1752:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF741:
+	.string	"EOF (-1)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1114:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF2135:
+	.string	"TCPOPT_EOL 0"
+.LASF671:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF542:
+	.string	"__stub___compat_bdflush "
+.LASF1513:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1791:
+	.string	"SO_PASSCRED 16"
+.LASF1900:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF1390:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF1254:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1343:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF2327:
+	.string	"IPPROTO_MTP"
+.LASF1665:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF1576:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1215:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF397:
+	.string	"_FEATURES_H 1"
+.LASF780:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2426:
+	.string	"ringBufferReadPointer"
+.LASF704:
+	.string	"_BSD_SIZE_T_ "
+.LASF516:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2095:
+	.string	"TCP_LINGER2 8"
+.LASF2139:
+	.string	"TCPOPT_WINDOW 3"
+.LASF1884:
+	.string	"IP_MSFILTER 41"
+.LASF500:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1235:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF1160:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF1225:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF1555:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2152:
+	.string	"TCPI_OPT_TIMESTAMPS 1"
+.LASF1201:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1489:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF1257:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF1101:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF946:
+	.string	"O_NOCTTY 0400"
+.LASF1473:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF1010:
+	.string	"AT_SYMLINK_FOLLOW 0x400"
+.LASF2387:
+	.string	"txReserve"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF541:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1550:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1811:
+	.string	"SO_RXQ_OVFL 40"
+.LASF1043:
+	.string	"__S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF2239:
+	.string	"_IO_read_base"
+.LASF1765:
+	.string	"__ASM_GENERIC_SOCKIOS_H "
+.LASF592:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF798:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF769:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2257:
+	.string	"_offset"
+.LASF2316:
+	.string	"IPPROTO_EGP"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1780:
+	.string	"SO_SNDBUF 7"
+.LASF1003:
+	.string	"POSIX_FADV_SEQUENTIAL 2"
+.LASF2284:
+	.string	"sockaddr"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2076:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF536:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1065:
+	.string	"S_IXUSR __S_IEXEC"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2244:
+	.string	"_IO_buf_end"
+.LASF2041:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF2102:
+	.string	"TCP_COOKIE_TRANSACTIONS 15"
+.LASF1346:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF1724:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF871:
+	.string	"EMULTIHOP 72"
+.LASF969:
+	.string	"O_RSYNC O_SYNC"
+.LASF2181:
+	.string	"FLASH_PAGE_SIZE ((uint16_t)0x800)"
+.LASF584:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF439:
+	.string	"__USE_POSIX 1"
+.LASF1080:
+	.string	"F_LOCK 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1897:
+	.string	"IP_PKTINFO 8"
+.LASF2024:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF1916:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF466:
+	.string	"__LEAF , __leaf__"
+.LASF2049:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF1466:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF1786:
+	.string	"SO_NO_CHECK 11"
+.LASF2028:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF2118:
+	.string	"TCP_ULP 31"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1241:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF1915:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF1011:
+	.string	"AT_EACCESS 0x200"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF977:
+	.string	"F_SETOWN __F_SETOWN"
+.LASF2376:
+	.string	"callback"
+.LASF1208:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF844:
+	.string	"EL2NSYNC 45"
+.LASF2066:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF1599:
+	.string	"PF_INET6 10"
+.LASF1063:
+	.string	"S_IRUSR __S_IREAD"
+.LASF1417:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF941:
+	.string	"O_RDONLY 00"
+.LASF531:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1098:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF1165:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF658:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1322:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF2240:
+	.string	"_IO_write_base"
+.LASF1360:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF2027:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF1303:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF949:
+	.string	"O_NONBLOCK 04000"
+.LASF787:
+	.string	"_BITS_STDIO_H 1"
+.LASF1700:
+	.string	"SOL_PPPOL2TP 273"
+.LASF779:
+	.string	"__f32(x) x ##f32"
+.LASF1183:
+	.string	"L_XTND SEEK_END"
+.LASF909:
+	.string	"ETIMEDOUT 110"
+.LASF586:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1263:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF743:
+	.string	"SEEK_CUR 1"
+.LASF2000:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF1328:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF2448:
+	.string	"uartSetMode"
+.LASF585:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2276:
+	.string	"SOCK_RDM"
+.LASF2368:
+	.string	"serialPort"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1038:
+	.string	"__S_IFIFO 0010000"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1953:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF1801:
+	.string	"SO_ATTACH_FILTER 26"
+.LASF910:
+	.string	"ECONNREFUSED 111"
+.LASF1447:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF2146:
+	.string	"TCPOLEN_TSTAMP_APPA (TCPOLEN_TIMESTAMP+2)"
+.LASF933:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF2453:
+	.string	"transmit"
+.LASF2298:
+	.string	"MSG_CONFIRM"
+.LASF1802:
+	.string	"SO_DETACH_FILTER 27"
+.LASF476:
+	.string	"__ptr_t void *"
+.LASF752:
+	.string	"FOPEN_MAX 16"
+.LASF2432:
+	.string	"close"
+.LASF575:
+	.string	"__SLONG32_TYPE int"
+.LASF2112:
+	.string	"TCP_NOTSENT_LOWAT 25"
+.LASF1929:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF1089:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF958:
+	.string	"__O_NOATIME 01000000"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2346:
+	.string	"USART_TypeDef"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF434:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1574:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1951:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF2153:
+	.string	"TCPI_OPT_SACK 2"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF401:
+	.string	"__USE_ISOCXX11"
+.LASF1695:
+	.string	"SOL_LLC 268"
+.LASF1921:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF2226:
+	.string	"long int"
+.LASF1528:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1221:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF1209:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF2003:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF2279:
+	.string	"SOCK_PACKET"
+.LASF731:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1202:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1446:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF1721:
+	.string	"MSG_OOB MSG_OOB"
+.LASF1702:
+	.string	"SOL_PNPIPE 275"
+.LASF427:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1298:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF631:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF639:
+	.string	"UINT8_MAX (255)"
+.LASF2266:
+	.string	"_IO_marker"
+.LASF2208:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF868:
+	.string	"ESRMNT 69"
+.LASF1684:
+	.string	"AF_XDP PF_XDP"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF753:
+	.string	"stdin stdin"
+.LASF1944:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF878:
+	.string	"ELIBACC 79"
+.LASF1560:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF843:
+	.string	"ECHRNG 44"
+.LASF1859:
+	.string	"SCM_TIMESTAMPNS SO_TIMESTAMPNS"
+.LASF473:
+	.string	"__PMT(args) args"
+.LASF1662:
+	.string	"AF_SNA PF_SNA"
+.LASF1710:
+	.string	"SOL_XDP 283"
+.LASF1161:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF1616:
+	.string	"PF_LLC 26"
+.LASF379:
+	.string	"SITL 1"
+.LASF1868:
+	.string	"IP_OPTIONS 4"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1779:
+	.string	"SO_BROADCAST 6"
+.LASF648:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1798:
+	.string	"SO_SECURITY_ENCRYPTION_TRANSPORT 23"
+.LASF998:
+	.string	"FNDELAY O_NDELAY"
+.LASF1284:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF935:
+	.string	"_FCNTL_H 1"
+.LASF1288:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF1533:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1015:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF385:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1427:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF2070:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF858:
+	.string	"EBFONT 59"
+.LASF825:
+	.string	"ETXTBSY 26"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2186:
+	.string	"ACC "
+.LASF1658:
+	.string	"AF_ASH PF_ASH"
+.LASF1121:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF1979:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF461:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1538:
+	.string	"__timeval_defined 1"
+.LASF479:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1790:
+	.string	"SO_REUSEPORT 15"
+.LASF754:
+	.string	"stdout stdout"
+.LASF2307:
+	.string	"MSG_CMSG_CLOEXEC"
+.LASF751:
+	.string	"FOPEN_MAX"
+.LASF1815:
+	.string	"SO_NOFCS 43"
+.LASF2187:
+	.string	"USE_ACC_SITL "
+.LASF2402:
+	.string	"txDMALength"
+.LASF2309:
+	.string	"in_addr"
+.LASF2277:
+	.string	"SOCK_SEQPACKET"
+.LASF2367:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF702:
+	.string	"__SIZE_T "
+.LASF2017:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF613:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1496:
+	.string	"_SYS_TYPES_H 1"
+.LASF2143:
+	.string	"TCPOPT_SACK 5"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2267:
+	.string	"_IO_codecvt"
+.LASF1913:
+	.string	"IP_NODEFRAG 22"
+.LASF1158:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF1379:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF783:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1584:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF1846:
+	.string	"SO_PREFER_BUSY_POLL 69"
+.LASF971:
+	.string	"F_GETFD 1"
+.LASF975:
+	.string	"__F_SETOWN 8"
+.LASF596:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF612:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2058:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF2064:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF1039:
+	.string	"__S_IFLNK 0120000"
+.LASF1400:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF1200:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF701:
+	.string	"_T_SIZE "
+.LASF1199:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF2306:
+	.string	"MSG_FASTOPEN"
+.LASF2169:
+	.string	"GPIOA (&sitlGpio[0])"
+.LASF784:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1117:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF1428:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1291:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF1956:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF2382:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF440:
+	.string	"__USE_POSIX2 1"
+.LASF1159:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF2392:
+	.string	"ring"
+.LASF1871:
+	.string	"IP_TTL 2"
+.LASF485:
+	.string	"__flexarr []"
+.LASF786:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF426:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF564:
+	.string	"_BITS_TYPES_H 1"
+.LASF1726:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF1706:
+	.string	"SOL_ALG 279"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2196:
+	.string	"PROFILING "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF652:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1770:
+	.string	"SIOCATMARK 0x8905"
+.LASF2202:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF487:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1537:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF2330:
+	.string	"IPPROTO_PIM"
+.LASF1931:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF1295:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1061:
+	.string	"S_ISGID __S_ISGID"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1622:
+	.string	"PF_IUCV 32"
+.LASF1667:
+	.string	"AF_IB PF_IB"
+.LASF645:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1783:
+	.string	"SO_RCVBUFFORCE 33"
+.LASF437:
+	.string	"_POSIX_C_SOURCE"
+.LASF1085:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1943:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF1459:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF795:
+	.string	"_STRINGS_H 1"
+.LASF1150:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF987:
+	.string	"F_UNLCK 2"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1319:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2407:
+	.string	"rxFrame"
+.LASF1372:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF1687:
+	.string	"SOL_RAW 255"
+.LASF2162:
+	.string	"TCP_COOKIE_PAIR_SIZE (2*TCP_COOKIE_MAX)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2473:
+	.string	"__errno_location"
+.LASF1242:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF1091:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF1378:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1127:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1253:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF660:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2212:
+	.string	"UART3_RX_BUFFER_SIZE 128"
+.LASF1198:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF2150:
+	.string	"TCP_MAX_WINSHIFT 14"
+.LASF1239:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF2230:
+	.string	"char"
+.LASF1561:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF974:
+	.string	"F_SETFL 4"
+.LASF1611:
+	.string	"PF_RDS 21"
+.LASF1053:
+	.string	"S_IFDIR __S_IFDIR"
+.LASF1963:
+	.string	"IPV6_HOPOPTS 54"
+.LASF1438:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF2326:
+	.string	"IPPROTO_AH"
+.LASF587:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF548:
+	.string	"__stub_sigreturn "
+.LASF1258:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF1933:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF772:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2160:
+	.string	"TCP_COOKIE_MIN 8"
+.LASF2343:
+	.string	"sin_addr"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1278:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF507:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF967:
+	.string	"O_CLOEXEC __O_CLOEXEC"
+.LASF1964:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF2034:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF1309:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF609:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2183:
+	.string	"CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)"
+.LASF1848:
+	.string	"SO_NETNS_COOKIE 71"
+.LASF2243:
+	.string	"_IO_buf_base"
+.LASF1093:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF1527:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF438:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF504:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1739:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF921:
+	.string	"EDQUOT 122"
+.LASF1948:
+	.string	"IPV6_RECVERR 25"
+.LASF627:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF848:
+	.string	"EUNATCH 49"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2399:
+	.string	"rxFrameDMAChannel"
+.LASF1852:
+	.string	"SO_RCVMARK 75"
+.LASF391:
+	.string	"true 1"
+.LASF1330:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1463:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF511:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF820:
+	.string	"EISDIR 21"
+.LASF1152:
+	.string	"_POSIX_IPV6 200809L"
+.LASF1352:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF1475:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1176:
+	.string	"STDERR_FILENO 2"
+.LASF1705:
+	.string	"SOL_CAIF 278"
+.LASF599:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"_SIZE_T_DEFINED "
+.LASF2084:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF835:
+	.string	"ENAMETOOLONG 36"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1008:
+	.string	"AT_SYMLINK_NOFOLLOW 0x100"
+.LASF1410:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF2020:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF1831:
+	.string	"SCM_TIMESTAMPING_PKTINFO 58"
+.LASF2156:
+	.string	"TCPI_OPT_ECN_SEEN 16"
+.LASF1316:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF624:
+	.string	"__STD_TYPE"
+.LASF1310:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF610:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF939:
+	.string	"F_SETLKW64 7"
+.LASF2263:
+	.string	"_mode"
+.LASF654:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF582:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2163:
+	.string	"TCP_COOKIE_IN_ALWAYS (1 << 0)"
+.LASF576:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF767:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2283:
+	.string	"_IO_FILE"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2006:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF2308:
+	.string	"in_addr_t"
+.LASF590:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1476:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF2110:
+	.string	"TCP_FASTOPEN 23"
+.LASF2268:
+	.string	"_IO_wide_data"
+.LASF993:
+	.string	"LOCK_UN 8"
+.LASF1119:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF2040:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1066:
+	.string	"S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)"
+.LASF1980:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF881:
+	.string	"ELIBMAX 82"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1223:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF716:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1830:
+	.string	"SO_COOKIE 57"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1342:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF2351:
+	.string	"buffer"
+.LASF1575:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1305:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF1047:
+	.string	"__S_IREAD 0400"
+.LASF1457:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1356:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF797:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1313:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF634:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF814:
+	.string	"ENOTBLK 15"
+.LASF1248:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF815:
+	.string	"EBUSY 16"
+.LASF1194:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF1469:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1873:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF386:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1210:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF679:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1535:
+	.string	"__sigset_t_defined 1"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1444:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF2129:
+	.string	"TH_FIN 0x01"
+.LASF527:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1817:
+	.string	"SO_SELECT_ERR_QUEUE 45"
+.LASF2191:
+	.string	"USE_USART2 "
+.LASF1040:
+	.string	"__S_IFSOCK 0140000"
+.LASF1877:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF512:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2336:
+	.string	"IPPROTO_RAW"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF668:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF950:
+	.string	"O_NDELAY O_NONBLOCK"
+.LASF1677:
+	.string	"AF_CAIF PF_CAIF"
+.LASF464:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF874:
+	.string	"EOVERFLOW 75"
+.LASF1570:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1631:
+	.string	"PF_KCM 41"
+.LASF1736:
+	.string	"MSG_MORE MSG_MORE"
+.LASF1057:
+	.string	"S_IFIFO __S_IFIFO"
+.LASF1784:
+	.string	"SO_KEEPALIVE 9"
+.LASF1414:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF854:
+	.string	"ENOANO 55"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1894:
+	.string	"MCAST_EXCLUDE 0"
+.LASF824:
+	.string	"ENOTTY 25"
+.LASF1682:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF929:
+	.string	"EOWNERDEAD 130"
+.LASF371:
+	.string	"__linux 1"
+.LASF1711:
+	.string	"SOL_MPTCP 284"
+.LASF460:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF853:
+	.string	"EXFULL 54"
+.LASF2413:
+	.string	"isOpen"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1907:
+	.string	"IP_XFRM_POLICY 17"
+.LASF538:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF540:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF775:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1620:
+	.string	"PF_TIPC 30"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1501:
+	.string	"__id_t_defined "
+.LASF2137:
+	.string	"TCPOPT_MAXSEG 2"
+.LASF916:
+	.string	"EUCLEAN 117"
+.LASF1844:
+	.string	"SO_SNDTIMEO_NEW 67"
+.LASF1338:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF1481:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF2048:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF897:
+	.string	"EADDRINUSE 98"
+.LASF1734:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF614:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1302:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2018:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF1607:
+	.string	"PF_PACKET 17"
+.LASF810:
+	.string	"EAGAIN 11"
+.LASF1364:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF1893:
+	.string	"IP_UNICAST_IF 50"
+.LASF1572:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF383:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1581:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF1373:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF2435:
+	.string	"listen"
+.LASF813:
+	.string	"EFAULT 14"
+.LASF1502:
+	.string	"__daddr_t_defined "
+.LASF513:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF846:
+	.string	"EL3RST 47"
+.LASF2425:
+	.string	"send"
+.LASF1113:
+	.string	"_XOPEN_REALTIME 1"
+.LASF1300:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF2248:
+	.string	"_markers"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1374:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF1035:
+	.string	"__S_IFCHR 0020000"
+.LASF480:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2456:
+	.string	"sent"
+.LASF1021:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1520:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2136:
+	.string	"TCPOPT_NOP 1"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1324:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1590:
+	.string	"PF_FILE PF_LOCAL"
+.LASF1775:
+	.string	"SO_REUSEADDR 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1698:
+	.string	"SOL_TIPC 271"
+.LASF1149:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2258:
+	.string	"_codecvt"
+.LASF415:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1834:
+	.string	"SO_TXTIME 61"
+.LASF1027:
+	.string	"st_atime st_atim.tv_sec"
+.LASF1733:
+	.string	"MSG_RST MSG_RST"
+.LASF2325:
+	.string	"IPPROTO_ESP"
+.LASF2400:
+	.string	"rxDMAIrq"
+.LASF938:
+	.string	"F_SETLK64 6"
+.LASF2142:
+	.string	"TCPOLEN_SACK_PERMITTED 2"
+.LASF1171:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF755:
+	.string	"stderr stderr"
+.LASF1843:
+	.string	"SO_RCVTIMEO_NEW 66"
+.LASF2203:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2354:
+	.string	"tail"
+.LASF1227:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF1349:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF1282:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF926:
+	.string	"EKEYEXPIRED 127"
+.LASF2457:
+	.string	"receive"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1523:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2116:
+	.string	"TCP_REPAIR_WINDOW 29"
+.LASF1285:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF597:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF788:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF1182:
+	.string	"L_INCR SEEK_CUR"
+.LASF1019:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1477:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1986:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF1985:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF1108:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2269:
+	.string	"ssize_t"
+.LASF1172:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF1000:
+	.string	"__POSIX_FADV_NOREUSE 5"
+.LASF607:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1880:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF2096:
+	.string	"TCP_DEFER_ACCEPT 9"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2074:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1046:
+	.string	"__S_ISVTX 01000"
+.LASF2314:
+	.string	"IPPROTO_IPIP"
+.LASF1326:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF757:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1807:
+	.string	"SO_PASSSEC 34"
+.LASF650:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF499:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2395:
+	.string	"serialRxFrame_t"
+.LASF1383:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1738:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF1371:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1565:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1054:
+	.string	"S_IFCHR __S_IFCHR"
+.LASF732:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1805:
+	.string	"SO_ACCEPTCONN 30"
+.LASF829:
+	.string	"EROFS 30"
+.LASF1978:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF2225:
+	.string	"__uint32_t"
+.LASF2431:
+	.string	"printf"
+.LASF419:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF942:
+	.string	"O_WRONLY 01"
+.LASF403:
+	.string	"__USE_POSIX2"
+.LASF2455:
+	.string	"data"
+.LASF934:
+	.string	"errno (*__errno_location ())"
+.LASF886:
+	.string	"EUSERS 87"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2444:
+	.string	"uartRead"
+.LASF1304:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF1070:
+	.string	"S_IRWXG (S_IRWXU >> 3)"
+.LASF1232:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF2333:
+	.string	"IPPROTO_UDPLITE"
+.LASF1060:
+	.string	"S_ISUID __S_ISUID"
+.LASF1869:
+	.string	"IP_HDRINCL 3"
+.LASF877:
+	.string	"EREMCHG 78"
+.LASF947:
+	.string	"O_TRUNC 01000"
+.LASF2108:
+	.string	"TCP_QUEUE_SEQ 21"
+.LASF2353:
+	.string	"head"
+.LASF1975:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF1408:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF1344:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF1909:
+	.string	"IP_TRANSPARENT 19"
+.LASF2373:
+	.string	"baudRate"
+.LASF1619:
+	.string	"PF_CAN 29"
+.LASF1596:
+	.string	"PF_BRIDGE 7"
+.LASF2205:
+	.string	"TIME_SECTION_END(index) {}"
+.LASF1960:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF1229:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF894:
+	.string	"EOPNOTSUPP 95"
+.LASF1650:
+	.string	"AF_ROSE PF_ROSE"
+.LASF1045:
+	.string	"__S_ISGID 02000"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF960:
+	.string	"__O_DSYNC 010000"
+.LASF410:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1925:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF1044:
+	.string	"__S_ISUID 04000"
+.LASF665:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1290:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF1552:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1224:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF1023:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2375:
+	.string	"txBuffer"
+.LASF1787:
+	.string	"SO_PRIORITY 12"
+.LASF712:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF640:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF826:
+	.string	"EFBIG 27"
+.LASF2104:
+	.string	"TCP_THIN_DUPACK 17"
+.LASF930:
+	.string	"ENOTRECOVERABLE 131"
+.LASF2401:
+	.string	"txDMAIrq"
+.LASF2106:
+	.string	"TCP_REPAIR 19"
+.LASF615:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1077:
+	.string	"X_OK 1"
+.LASF446:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1793:
+	.string	"SO_RCVLOWAT 18"
+.LASF738:
+	.string	"_IOLBF 1"
+.LASF1169:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF849:
+	.string	"ENOCSI 50"
+.LASF866:
+	.string	"ENOLINK 67"
+.LASF1404:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1675:
+	.string	"AF_PHONET PF_PHONET"
+.LASF2080:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF981:
+	.string	"__F_SETOWN_EX 15"
+.LASF619:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF687:
+	.string	"UINT16_C(c) c"
+.LASF2440:
+	.string	"socket"
+.LASF856:
+	.string	"EBADSLT 57"
+.LASF2021:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF2010:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF673:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1926:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF2417:
+	.string	"serialBufferTxReserve"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF2175:
+	.string	"__enable_irq() "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1920:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF1632:
+	.string	"PF_QIPCRTR 42"
+.LASF404:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2287:
+	.string	"MSG_OOB"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF890:
+	.string	"EPROTOTYPE 91"
+.LASF1592:
+	.string	"PF_AX25 3"
+.LASF1268:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF2052:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1474:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF2469:
+	.string	"__bsx"
+.LASF1621:
+	.string	"PF_BLUETOOTH 31"
+.LASF2009:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF1187:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1490:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF1896:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF2358:
+	.string	"SERIAL_INVERTED"
+.LASF1036:
+	.string	"__S_IFBLK 0060000"
+.LASF1497:
+	.string	"__u_char_defined "
+.LASF2460:
+	.string	"disconnectClient"
+.LASF2377:
+	.string	"serialPortVTable"
+.LASF2125:
+	.string	"TCP_TX_DELAY 37"
+.LASF384:
+	.string	"__STDC_IEC_559__ 1"
+.LASF2261:
+	.string	"_freeres_buf"
+.LASF2075:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF2339:
+	.string	"in_port_t"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF436:
+	.string	"_POSIX_SOURCE 1"
+.LASF1640:
+	.string	"AF_FILE PF_FILE"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2422:
+	.string	"ringBufferGet"
+.LASF625:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1543:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2361:
+	.string	"portMode_t"
+.LASF774:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1252:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF1773:
+	.string	"SOL_SOCKET 1"
+.LASF1068:
+	.string	"S_IWGRP (S_IWUSR >> 3)"
+.LASF1125:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF2271:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF620:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1641:
+	.string	"AF_INET PF_INET"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2253:
+	.string	"_cur_column"
+.LASF1707:
+	.string	"SOL_NFC 280"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2189:
+	.string	"USE_BARO_SITL "
+.LASF1401:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF1099:
+	.string	"_XOPEN_LEGACY 1"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2228:
+	.string	"__off64_t"
+.LASF1206:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF721:
+	.string	"_____fpos_t_defined 1"
+.LASF920:
+	.string	"EREMOTEIO 121"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2159:
+	.string	"TCP_MD5SIG_FLAG_PREFIX 1"
+.LASF1403:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF672:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2348:
+	.string	"DMA_Channel_TypeDef"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1993:
+	.string	"SOL_IPV6 41"
+.LASF2328:
+	.string	"IPPROTO_BEETPH"
+.LASF2147:
+	.string	"TCPOPT_TSTAMP_HDR (TCPOPT_NOP<<24|TCPOPT_NOP<<16|TCPOPT_TIMESTAMP<<8|TCPOLEN_TIMESTAMP)"
+.LASF1211:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1777:
+	.string	"SO_ERROR 4"
+.LASF1435:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF2360:
+	.string	"__socket_type"
+.LASF477:
+	.string	"__BEGIN_DECLS "
+.LASF1366:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF517:
+	.string	"__restrict_arr __restrict"
+.LASF2004:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1997:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF1480:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF2140:
+	.string	"TCPOLEN_WINDOW 3"
+.LASF394:
+	.string	"_STDINT_H 1"
+.LASF957:
+	.string	"__O_DIRECT 040000"
+.LASF2470:
+	.string	"__bswap_16"
+.LASF758:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2366:
+	.string	"serialReceiveCallbackPtr"
+.LASF2302:
+	.string	"MSG_MORE"
+.LASF2173:
+	.string	"USART2 (&sitlUsart[1])"
+.LASF2051:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF918:
+	.string	"ENAVAIL 119"
+.LASF1911:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF442:
+	.string	"__USE_POSIX199506 1"
+.LASF1184:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF1266:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2296:
+	.string	"MSG_FIN"
+.LASF1566:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF521:
+	.string	"__attribute_copy__"
+.LASF2408:
+	.string	"uartPort_t"
+.LASF546:
+	.string	"__stub_revoke "
+.LASF608:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF518:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF804:
+	.string	"EIO 5"
+.LASF2294:
+	.string	"MSG_EOR"
+.LASF2317:
+	.string	"IPPROTO_PUP"
+.LASF914:
+	.string	"EINPROGRESS 115"
+.LASF1437:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1234:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF1861:
+	.string	"__osockaddr_defined 1"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2246:
+	.string	"_IO_backup_base"
+.LASF444:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2449:
+	.string	"uartSetBaudRate"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1345:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF2237:
+	.string	"_IO_read_ptr"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF740:
+	.string	"BUFSIZ 8192"
+.LASF830:
+	.string	"EMLINK 31"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2101:
+	.string	"TCP_MD5SIG 14"
+.LASF1939:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF1059:
+	.string	"S_IFSOCK __S_IFSOCK"
+.LASF1139:
+	.string	"_POSIX_REGEXP 1"
+.LASF944:
+	.string	"O_CREAT 0100"
+.LASF2372:
+	.string	"inversion"
+.LASF1386:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF380:
+	.string	"__FORKNAME__ \"cleanflight\""
+.LASF2414:
+	.string	"listenFd"
+.LASF736:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1317:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF445:
+	.string	"_ATFILE_SOURCE"
+.LASF932:
+	.string	"EHWPOISON 133"
+.LASF2122:
+	.string	"TCP_ZEROCOPY_RECEIVE 35"
+.LASF2260:
+	.string	"_freeres_list"
+.LASF724:
+	.string	"____FILE_defined 1"
+.LASF539:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1318:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF2335:
+	.string	"IPPROTO_ETHERNET"
+.LASF1668:
+	.string	"AF_MPLS PF_MPLS"
+.LASF1213:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF776:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2148:
+	.string	"TCP_MSS 512"
+.LASF1941:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF997:
+	.string	"FNONBLOCK O_NONBLOCK"
+.LASF1398:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF1064:
+	.string	"S_IWUSR __S_IWRITE"
+.LASF2128:
+	.string	"TCP_REPAIR_OFF_NO_WP -1"
+.LASF682:
+	.string	"INT8_C(c) c"
+.LASF1651:
+	.string	"AF_DECnet PF_DECnet"
+.LASF1704:
+	.string	"SOL_IUCV 277"
+.LASF2468:
+	.string	"__bswap_32"
+.LASF493:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2443:
+	.string	"sitlUarts"
+.LASF1226:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF1568:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1136:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1350:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF827:
+	.string	"ENOSPC 28"
+.LASF1557:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1048:
+	.string	"__S_IWRITE 0200"
+.LASF2365:
+	.string	"MODE_SBUS"
+.LASF1072:
+	.string	"S_IWOTH (S_IWGRP >> 3)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2094:
+	.string	"TCP_SYNCNT 7"
+.LASF1413:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF2462:
+	.string	"noDelay"
+.LASF2252:
+	.string	"_old_offset"
+.LASF1750:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF390:
+	.string	"bool _Bool"
+.LASF1439:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1123:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF520:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF611:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1095:
+	.string	"_XOPEN_XPG3 1"
+.LASF819:
+	.string	"ENOTDIR 20"
+.LASF1990:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF2404:
+	.string	"txDMAPeripheralBaseAddr"
+.LASF1961:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF2100:
+	.string	"TCP_CONGESTION 13"
+.LASF839:
+	.string	"ELOOP 40"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1655:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF1670:
+	.string	"AF_TIPC PF_TIPC"
+.LASF1583:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF1518:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1984:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF2215:
+	.string	"SITL_UART_COUNT 2"
+.LASF457:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1503:
+	.string	"__key_t_defined "
+.LASF2272:
+	.string	"long long int"
+.LASF863:
+	.string	"ENONET 64"
+.LASF1638:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF601:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"WINT_MIN (0u)"
+.LASF1385:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF2396:
+	.string	"port"
+.LASF1432:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF2319:
+	.string	"IPPROTO_IDP"
+.LASF2251:
+	.string	"_flags2"
+.LASF1375:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF1277:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF1792:
+	.string	"SO_PEERCRED 17"
+.LASF2055:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF911:
+	.string	"EHOSTDOWN 112"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF478:
+	.string	"__END_DECLS "
+.LASF1530:
+	.string	"_SYS_SELECT_H 1"
+.LASF1144:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF1368:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1137:
+	.string	"_POSIX_CPUTIME 0"
+.LASF730:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1456:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF709:
+	.string	"__DEFINED_size_t "
+.LASF1657:
+	.string	"AF_PACKET PF_PACKET"
+.LASF1754:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF1454:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF2031:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF879:
+	.string	"ELIBBAD 80"
+.LASF1292:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF1912:
+	.string	"IP_MINTTL 21"
+.LASF1571:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1056:
+	.string	"S_IFREG __S_IFREG"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1904:
+	.string	"IP_MTU 14"
+.LASF1732:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF1709:
+	.string	"SOL_TLS 282"
+.LASF1312:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF1542:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF501:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF873:
+	.string	"EBADMSG 74"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF803:
+	.string	"EINTR 4"
+.LASF1935:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF864:
+	.string	"ENOPKG 65"
+.LASF1442:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF2332:
+	.string	"IPPROTO_SCTP"
+.LASF1870:
+	.string	"IP_TOS 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2088:
+	.string	"TCP_NODELAY 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1618:
+	.string	"PF_MPLS 28"
+.LASF1991:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF2439:
+	.string	"setsockopt"
+.LASF1421:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1088:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF928:
+	.string	"EKEYREJECTED 129"
+.LASF2192:
+	.string	"SERIAL_PORT_COUNT 2"
+.LASF1028:
+	.string	"st_mtime st_mtim.tv_sec"
+.LASF2415:
+	.string	"clientFd"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1293:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF2359:
+	.string	"serialInversion_e"
+.LASF1394:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF374:
+	.string	"__unix 1"
+.LASF523:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1436:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF1222:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF801:
+	.string	"ENOENT 2"
+.LASF503:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1842:
+	.string	"SO_TIMESTAMPING_NEW 65"
+.LASF2217:
+	.string	"long unsigned int"
+.LASF1049:
+	.string	"__S_IEXEC 0100"
+.LASF737:
+	.string	"_IOFBF 0"
+.LASF667:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1881:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF828:
+	.string	"ESPIPE 29"
+.LASF907:
+	.string	"ESHUTDOWN 108"
+.LASF924:
+	.string	"ECANCELED 125"
+.LASF1129:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF2177:
+	.string	"U_ID_1 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2111:
+	.string	"TCP_TIMESTAMP 24"
+.LASF2174:
+	.string	"__disable_irq() "
+.LASF1949:
+	.string	"IPV6_V6ONLY 26"
+.LASF603:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2324:
+	.string	"IPPROTO_GRE"
+.LASF1471:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1443:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1708:
+	.string	"SOL_KCM 281"
+.LASF1186:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2098:
+	.string	"TCP_INFO 11"
+.LASF600:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2466:
+	.string	"reuse"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1822:
+	.string	"SO_ATTACH_BPF 50"
+.LASF1140:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2016:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1922:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF1850:
+	.string	"SO_RESERVE_MEM 73"
+.LASF1192:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF2378:
+	.string	"serialWrite"
+.LASF2091:
+	.string	"TCP_KEEPIDLE 4"
+.LASF1771:
+	.string	"SIOCGSTAMP_OLD 0x8906"
+.LASF593:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1945:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF2059:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF1351:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF1167:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF1602:
+	.string	"PF_NETBEUI 13"
+.LASF1874:
+	.string	"IP_RETOPTS 7"
+.LASF2044:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF1228:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF996:
+	.string	"FASYNC O_ASYNC"
+.LASF955:
+	.string	"__O_NOFOLLOW 0400000"
+.LASF452:
+	.string	"__USE_ATFILE 1"
+.LASF1816:
+	.string	"SO_LOCK_FILTER 44"
+.LASF1220:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF2350:
+	.string	"ringBuffer_s"
+.LASF2356:
+	.string	"ringBuffer_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1647:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF1434:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF831:
+	.string	"EPIPE 32"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF697:
+	.string	"__SIZE_T__ "
+.LASF1270:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF1131:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF2119:
+	.string	"TCP_MD5SIG_EXT 32"
+.LASF2461:
+	.string	"acceptClient"
+.LASF1654:
+	.string	"AF_KEY PF_KEY"
+.LASF1849:
+	.string	"SO_BUF_LOCK 72"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF589:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF388:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF988:
+	.string	"F_EXLCK 4"
+.LASF2033:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF483:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF475:
+	.string	"__STRING(x) #x"
+.LASF1955:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF991:
+	.string	"LOCK_EX 2"
+.LASF1418:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2053:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF1681:
+	.string	"AF_KCM PF_KCM"
+.LASF1120:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF2220:
+	.string	"unsigned int"
+.LASF2421:
+	.string	"ringBufferPut"
+.LASF1996:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF2138:
+	.string	"TCPOLEN_MAXSEG 4"
+.LASF898:
+	.string	"EADDRNOTAVAIL 99"
+.LASF872:
+	.string	"EDOTDOT 73"
+.LASF1642:
+	.string	"AF_AX25 PF_AX25"
+.LASF860:
+	.string	"ENODATA 61"
+.LASF2292:
+	.string	"MSG_TRUNC"
+.LASF1636:
+	.string	"PF_MAX 46"
+.LASF1320:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF1452:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF496:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1033:
+	.string	"__S_IFMT 0170000"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2130:
+	.string	"TH_SYN 0x02"
+.LASF506:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1988:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF1022:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1718:
+	.string	"_SS_SIZE 128"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1549:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF581:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF459:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF978:
+	.string	"F_GETOWN __F_GETOWN"
+.LASF1156:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF962:
+	.string	"F_GETLK F_GETLK64"
+.LASF2222:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2161:
+	.string	"TCP_COOKIE_MAX 16"
+.LASF565:
+	.string	"__S16_TYPE short int"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2452:
+	.string	"discardTransmitBuffer"
+.LASF2459:
+	.string	"received"
+.LASF1289:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1656:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF1890:
+	.string	"MCAST_LEAVE_SOURCE_GROUP 47"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2254:
+	.string	"_vtable_offset"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1664:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF1762:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF1588:
+	.string	"PF_LOCAL 1"
+.LASF577:
+	.string	"__S64_TYPE long int"
+.LASF1411:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF1545:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2312:
+	.string	"IPPROTO_ICMP"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2362:
+	.string	"MODE_RX"
+.LASF954:
+	.string	"__O_DIRECTORY 0200000"
+.LASF1661:
+	.string	"AF_RDS PF_RDS"
+.LASF1219:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF995:
+	.string	"FFSYNC O_FSYNC"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1081:
+	.string	"F_TLOCK 2"
+.LASF2121:
+	.string	"TCP_FASTOPEN_NO_COOKIE 34"
+.LASF2165:
+	.string	"TCP_S_DATA_IN (1 << 2)"
+.LASF1723:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF1895:
+	.string	"MCAST_INCLUDE 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF912:
+	.string	"EHOSTUNREACH 113"
+.LASF1666:
+	.string	"AF_LLC PF_LLC"
+.LASF1445:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1748:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF1051:
+	.string	"UTIME_OMIT ((1l << 30) - 2l)"
+.LASF433:
+	.string	"__USE_ISOC95 1"
+.LASF915:
+	.string	"ESTALE 116"
+.LASF1778:
+	.string	"SO_DONTROUTE 5"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1772:
+	.string	"SIOCGSTAMPNS_OLD 0x8907"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF812:
+	.string	"EACCES 13"
+.LASF2176:
+	.string	"U_ID_0 0x5349544c"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2131:
+	.string	"TH_RST 0x04"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1879:
+	.string	"IP_DROP_MEMBERSHIP 36"
+.LASF841:
+	.string	"ENOMSG 42"
+.LASF2209:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	".//src/main/target/SITL/sitl_serial.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,244 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Flight data recorder.
+ *
+ * The pid loop copies its state into a small queue of frames, the blackbox task encodes them (see
+ * blackbox_encoding.c) and writes them to the port with the BLACKBOX function. A frame is only written when it fits
+ * into the transmit buffer, when the port can not keep up frames are dropped from the queue, never bytes from a
+ * frame. Logging starts with a header on arming and stops on disarming.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef BLACKBOX
+
+#include "common/axis.h"
+#include "common/color.h"
+#include "flight/flight.h"
+
+#include "drivers/system.h"
+#include "drivers/accgyro.h"
+#include "drivers/serial.h"
+#include "drivers/gpio.h"
+#include "drivers/timer.h"
+#include "drivers/pwm_rx.h"
+
+#include "common/printf.h"
+
+#include "sensors/sensors.h"
+#include "sensors/acceleration.h"
+#include "sensors/barometer.h"
+#include "sensors/boardalignment.h"
+#include "sensors/battery.h"
+#include "sensors/gyro.h"
+
+#include "io/serial.h"
+#include "io/escservo.h"
+#include "io/gimbal.h"
+#include "io/gps.h"
+#include "io/ledstrip.h"
+#include "rx/rx.h"
+#include "io/rc_controls.h"
+
+#include "telemetry/telemetry.h"
+
+#include "flight/mixer.h"
+#include "flight/failsafe.h"
+#include "flight/navigation.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "blackbox/blackbox.h"
+#include "blackbox/blackbox_encoding.h"
+
+#define BLACKBOX_QUEUE_SIZE 8           // frames, must be a power of 2
+#define BLACKBOX_HEADER_SIZE 128
+
+extern uint32_t targetPidLooptime;
+
+typedef enum {
+    BLACKBOX_STATE_DISABLED = 0,
+    BLACKBOX_STATE_STOPPED,
+    BLACKBOX_STATE_SEND_HEADER,
+    BLACKBOX_STATE_RUNNING
+} blackboxState_e;
+
+static blackboxState_e blackboxState = BLACKBOX_STATE_DISABLED;
+static serialPort_t *blackboxPort;
+
+static blackboxFrame_t frameQueue[BLACKBOX_QUEUE_SIZE];
+static uint8_t frameQueueHead;
+static uint8_t frameQueueTail;
+static uint32_t loopIteration;
+
+static blackboxEncoder_t encoder;
+static uint8_t encodedFrame[BLACKBOX_MAX_FRAME_SIZE];
+static uint8_t encodedFrameLength;      // 0 when there is no frame waiting for space in the transmit buffer
+
+static char header[BLACKBOX_HEADER_SIZE];
+static uint8_t headerLength;
+static uint8_t headerPosition;
+
+void blackboxInit(void)
+{
+    blackboxPort = openSerialPort(FUNCTION_BLACKBOX, NULL, BLACKBOX_BAUDRATE, MODE_TX, SERIAL_NOT_INVERTED);
+
+    blackboxState = blackboxPort ? BLACKBOX_STATE_STOPPED : BLACKBOX_STATE_DISABLED;
+}
+
+static void startBlackbox(void)
+{
+    blackboxEncoderInit(&encoder, getMotorCount());
+
+    tfp_sprintf(header,
+        "H Product:Cleanflight\n"
+        "H Data version:%d\n"
+        "H I interval:%d\n"
+        "H Looptime:%d\n"
+        "H Rate denom:%d\n"
+        "H Motors:%d\n",
+        BLACKBOX_DATA_VERSION,
+        BLACKBOX_I_INTERVAL,
+        targetPidLooptime,
+        masterConfig.blackbox_rate_denom,
+        encoder.motorCount
+    );
+    headerLength = strlen(header);
+    headerPosition = 0;
+
+    frameQueueHead = frameQueueTail = 0;
+    encodedFrameLength = 0;
+    loopIteration = 0;
+
+    blackboxState = BLACKBOX_STATE_SEND_HEADER;
+}
+
+static void sendHeader(void)
+{
+    uint32_t count = headerLength - headerPosition;
+    uint32_t bytesFree = serialTxBytesFree(blackboxPort);
+
+    if (count > bytesFree) {
+        count = bytesFree;
+    }
+
+    serialWriteBuf(blackboxPort, (const uint8_t *)&header[headerPosition], count);
+    headerPosition += count;
+
+    if (headerPosition == headerLength) {
+        blackboxState = BLACKBOX_STATE_RUNNING;
+    }
+}
+
+static void sendQueuedFrames(void)
+{
+    while (true) {
+        if (!encodedFrameLength) {
+            if (frameQueueTail == frameQueueHead) {
+                return;
+            }
+            encodedFrameLength = blackboxEncodeFrame(&encoder, &frameQueue[frameQueueTail], encodedFrame);
+            frameQueueTail = (frameQueueTail + 1) & (BLACKBOX_QUEUE_SIZE - 1);
+        }
+
+        if (serialTxBytesFree(blackboxPort) < encodedFrameLength) {
+            return;
+        }
+
+        serialWriteBuf(blackboxPort, encodedFrame, encodedFrameLength);
+        encodedFrameLength = 0;
+    }
+}
+
+/*
+ * Called by the pid loop after the motors have been written, must stay cheap.
+ */
+void blackboxLogIteration(uint32_t currentTime)
+{
+    blackboxFrame_t *frame;
+    uint8_t nextHead;
+    uint8_t index;
+
+    if (blackboxState != BLACKBOX_STATE_RUNNING) {
+        return;
+    }
+
+    if (loopIteration++ % masterConfig.blackbox_rate_denom) {
+        return;
+    }
+
+    nextHead = (frameQueueHead + 1) & (BLACKBOX_QUEUE_SIZE - 1);
+    if (nextHead == frameQueueTail) {
+        // the port is not keeping up, drop the frame, the decoder sees the gap in the loop iteration
+        return;
+    }
+
+    frame = &frameQueue[frameQueueHead];
+
+    frame->loopIteration = loopIteration - 1;
+    frame->time = currentTime;
+    memcpy(frame->axisPID, axisPID, sizeof(frame->axisPID));
+    memcpy(frame->rcCommand, rcCommand, sizeof(frame->rcCommand));
+    memcpy(frame->gyroData, gyroData, sizeof(frame->gyroData));
+    memcpy(frame->accSmooth, accSmooth, sizeof(frame->accSmooth));
+    for (index = 0; index < encoder.motorCount; index++) {
+        frame->motor[index] = motor[index];
+    }
+
+    frameQueueHead = nextHead;
+}
+
+void handleBlackbox(void)
+{
+    switch (blackboxState) {
+        case BLACKBOX_STATE_DISABLED:
+            break;
+
+        case BLACKBOX_STATE_STOPPED:
+            if (ARMING_FLAG(ARMED)) {
+                startBlackbox();
+            }
+            break;
+
+        case BLACKBOX_STATE_SEND_HEADER:
+            // always completed, even when disarmed meanwhile, so the next log starts on a new header line
+            sendHeader();
+            break;
+
+        case BLACKBOX_STATE_RUNNING:
+            if (!ARMING_FLAG(ARMED)) {
+                // frames still queued are dropped, the log stays decodable as only whole frames are written
+                blackboxState = BLACKBOX_STATE_STOPPED;
+                break;
+            }
+
+            sendQueuedFrames();
+            break;
+    }
+}
+
+#endif
@@ -0,0 +1,275 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Every frame starts with a marker byte. Values are written as variable length integers, 7 bits per byte least
+ * significant first with the top bit set on all but the last byte, signed values are zig-zag encoded first so small
+ * negative numbers stay short.
+ *
+ * An intra frame ('I') holds the absolute values. An inter frame ('P') holds the difference to a prediction made from
+ * the frames before it: the loop iteration and the 16 bit fields are predicted to be unchanged from the previous frame,
+ * the time is predicted on a straight line through the previous two frames.
+ *
+ * A frame must be followed by another marker, the decoder uses that to detect lost bytes. After an error it skips all
+ * inter frames until the next intra frame, so a lost byte costs at most BLACKBOX_I_INTERVAL frames.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "blackbox/blackbox_encoding.h"
+
+#define VB_MAX_BYTES 5
+
+typedef struct blackboxReader_s {
+    const uint8_t *data;
+    uint32_t length;
+    uint32_t position;
+    bool overrun;                   // the data ended inside a value
+    bool malformed;                 // a value can not have been written by the encoder
+} blackboxReader_t;
+
+static blackboxFrame_t zeroFrame;      // prediction of intra frames, never written
+
+static uint8_t *writeUnsignedVB(uint8_t *buffer, uint32_t value)
+{
+    while (value > 127) {
+        *buffer++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *buffer++ = value;
+
+    return buffer;
+}
+
+static uint8_t *writeSignedVB(uint8_t *buffer, int32_t value)
+{
+    // zig-zag: 0, -1, 1, -2, 2 ... become 0, 1, 2, 3, 4 ...
+    return writeUnsignedVB(buffer, ((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+static uint8_t *writeFieldDeltas(uint8_t *buffer, const int16_t *values, const int16_t *predictions, uint8_t count)
+{
+    uint8_t index;
+
+    for (index = 0; index < count; index++) {
+        buffer = writeSignedVB(buffer, values[index] - predictions[index]);
+    }
+
+    return buffer;
+}
+
+static uint8_t *writeFields(uint8_t *buffer, const blackboxFrame_t *frame, const blackboxFrame_t *prediction, uint8_t motorCount)
+{
+    buffer = writeFieldDeltas(buffer, frame->axisPID, prediction->axisPID, 3);
+    buffer = writeFieldDeltas(buffer, frame->rcCommand, prediction->rcCommand, 4);
+    buffer = writeFieldDeltas(buffer, frame->gyroData, prediction->gyroData, 3);
+    buffer = writeFieldDeltas(buffer, frame->accSmooth, prediction->accSmooth, 3);
+    buffer = writeFieldDeltas(buffer, frame->motor, prediction->motor, motorCount);
+
+    return buffer;
+}
+
+static uint32_t readUnsignedVB(blackboxReader_t *reader)
+{
+    uint32_t value = 0;
+    uint8_t byteIndex;
+    uint8_t byte;
+
+    for (byteIndex = 0; byteIndex < VB_MAX_BYTES; byteIndex++) {
+        if (reader->position >= reader->length) {
+            reader->overrun = true;
+            return 0;
+        }
+
+        byte = reader->data[reader->position++];
+        value |= (uint32_t)(byte & 0x7F) << (byteIndex * 7);
+
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+
+    reader->malformed = true;
+    return 0;
+}
+
+static int32_t readSignedVB(blackboxReader_t *reader)
+{
+    uint32_t value = readUnsignedVB(reader);
+
+    return (int32_t)((value >> 1) ^ -(value & 1));
+}
+
+static void readFieldDeltas(blackboxReader_t *reader, int16_t *values, const int16_t *predictions, uint8_t count)
+{
+    int32_t value;
+    uint8_t index;
+
+    for (index = 0; index < count; index++) {
+        value = predictions[index] + readSignedVB(reader);
+        if (value < INT16_MIN || value > INT16_MAX) {
+            reader->malformed = true;
+        }
+        values[index] = value;
+    }
+}
+
+static void readFields(blackboxReader_t *reader, blackboxFrame_t *frame, const blackboxFrame_t *prediction, uint8_t motorCount)
+{
+    readFieldDeltas(reader, frame->axisPID, prediction->axisPID, 3);
+    readFieldDeltas(reader, frame->rcCommand, prediction->rcCommand, 4);
+    readFieldDeltas(reader, frame->gyroData, prediction->gyroData, 3);
+    readFieldDeltas(reader, frame->accSmooth, prediction->accSmooth, 3);
+    readFieldDeltas(reader, frame->motor, prediction->motor, motorCount);
+}
+
+static uint32_t predictTime(const blackboxFrame_t *history, uint8_t historyLength)
+{
+    if (historyLength < 2) {
+        return history[0].time;
+    }
+
+    return history[0].time + (history[0].time - history[1].time);
+}
+
+static void pushHistory(blackboxFrame_t *history, uint8_t *historyLength, const blackboxFrame_t *frame)
+{
+    history[1] = history[0];
+    history[0] = *frame;
+
+    if (*historyLength < 2) {
+        (*historyLength)++;
+    }
+}
+
+static bool isMarker(uint8_t byte)
+{
+    return byte == BLACKBOX_MARKER_INTRA_FRAME || byte == BLACKBOX_MARKER_INTER_FRAME || byte == BLACKBOX_MARKER_HEADER;
+}
+
+void blackboxEncoderInit(blackboxEncoder_t *encoder, uint8_t motorCount)
+{
+    memset(encoder, 0, sizeof(*encoder));
+    encoder->motorCount = motorCount < BLACKBOX_MAX_MOTORS ? motorCount : BLACKBOX_MAX_MOTORS;
+}
+
+/*
+ * Encodes frame into buffer, which must hold BLACKBOX_MAX_FRAME_SIZE bytes, and returns the length written.
+ */
+uint8_t blackboxEncodeFrame(blackboxEncoder_t *encoder, const blackboxFrame_t *frame, uint8_t *buffer)
+{
+    const blackboxFrame_t *previous = &encoder->history[0];
+    uint8_t *position = buffer;
+
+    if (encoder->historyLength == 0 || encoder->frameIndex % BLACKBOX_I_INTERVAL == 0) {
+        *position++ = BLACKBOX_MARKER_INTRA_FRAME;
+        position = writeUnsignedVB(position, frame->loopIteration);
+        position = writeUnsignedVB(position, frame->time);
+        position = writeFields(position, frame, &zeroFrame, encoder->motorCount);
+
+        encoder->historyLength = 0;
+    } else {
+        *position++ = BLACKBOX_MARKER_INTER_FRAME;
+        position = writeUnsignedVB(position, frame->loopIteration - previous->loopIteration);
+        position = writeSignedVB(position, frame->time - predictTime(encoder->history, encoder->historyLength));
+        position = writeFields(position, frame, previous, encoder->motorCount);
+    }
+
+    pushHistory(encoder->history, &encoder->historyLength, frame);
+    encoder->frameIndex++;
+
+    return position - buffer;
+}
+
+void blackboxDecoderInit(blackboxDecoder_t *decoder, uint8_t motorCount)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->motorCount = motorCount < BLACKBOX_MAX_MOTORS ? motorCount : BLACKBOX_MAX_MOTORS;
+}
+
+/*
+ * Decodes the frame at the start of data. consumed is set to the number of bytes to skip before the next call, it is
+ * 0 when more data is needed.
+ */
+blackboxDecodeResult_e blackboxDecodeFrame(blackboxDecoder_t *decoder, const uint8_t *data, uint32_t length,
+        blackboxFrame_t *frame, uint32_t *consumed)
+{
+    blackboxReader_t reader;
+    const blackboxFrame_t *previous = &decoder->history[0];
+    uint32_t iterationDelta;
+    uint8_t marker;
+
+    *consumed = 0;
+
+    if (length == 0) {
+        return BLACKBOX_DECODE_INCOMPLETE;
+    }
+
+    memset(&reader, 0, sizeof(reader));
+    reader.data = data;
+    reader.length = length;
+    reader.position = 1;
+
+    memset(frame, 0, sizeof(*frame));
+    marker = data[0];
+
+    switch (marker) {
+        case BLACKBOX_MARKER_INTRA_FRAME:
+            frame->loopIteration = readUnsignedVB(&reader);
+            frame->time = readUnsignedVB(&reader);
+            readFields(&reader, frame, &zeroFrame, decoder->motorCount);
+            break;
+
+        case BLACKBOX_MARKER_INTER_FRAME:
+            iterationDelta = readUnsignedVB(&reader);
+            if (iterationDelta == 0) {
+                reader.malformed = true;
+            }
+            frame->loopIteration = previous->loopIteration + iterationDelta;
+            frame->time = predictTime(decoder->history, decoder->historyLength) + readSignedVB(&reader);
+            readFields(&reader, frame, previous, decoder->motorCount);
+            break;
+
+        default:
+            reader.malformed = true;
+            break;
+    }
+
+    if (reader.malformed || (!reader.overrun && reader.position < length && !isMarker(data[reader.position]))) {
+        decoder->historyLength = 0;
+        *consumed = 1;
+        return BLACKBOX_DECODE_CORRUPT;
+    }
+
+    if (reader.overrun) {
+        return BLACKBOX_DECODE_INCOMPLETE;
+    }
+
+    *consumed = reader.position;
+
+    if (marker == BLACKBOX_MARKER_INTRA_FRAME) {
+        decoder->historyLength = 0;
+    } else if (decoder->historyLength == 0) {
+        return BLACKBOX_DECODE_SKIPPED;
+    }
+
+    pushHistory(decoder->history, &decoder->historyLength, frame);
+
+    return BLACKBOX_DECODE_FRAME;
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Frame encoding of the blackbox log, shared by the firmware and the host decoder. See docs/Blackbox.md.
+
+#define BLACKBOX_DATA_VERSION 1
+
+#define BLACKBOX_MAX_MOTORS 8
+#define BLACKBOX_I_INTERVAL 32          // every n'th frame is an intra frame that does not depend on the frames before it
+
+#define BLACKBOX_MARKER_HEADER 'H'
+#define BLACKBOX_MARKER_INTRA_FRAME 'I'
+#define BLACKBOX_MARKER_INTER_FRAME 'P'
+
+// marker, loop iteration and time take up to 5 bytes, every 16 bit field up to 3
+#define BLACKBOX_MAX_FRAME_SIZE (1 + 5 + 5 + (3 + 4 + 3 + 3 + BLACKBOX_MAX_MOTORS) * 3)
+
+typedef struct blackboxFrame_s {
+    uint32_t loopIteration;
+    uint32_t time;                  // microseconds
+    int16_t axisPID[3];
+    int16_t rcCommand[4];
+    int16_t gyroData[3];
+    int16_t accSmooth[3];
+    int16_t motor[BLACKBOX_MAX_MOTORS];
+} blackboxFrame_t;
+
+typedef struct blackboxEncoder_s {
+    uint8_t motorCount;
+    uint8_t historyLength;          // number of valid frames in history, 0 forces an intra frame
+    uint32_t frameIndex;            // frames encoded since blackboxEncoderInit()
+    blackboxFrame_t history[2];     // previous frame and the one before it, the predictors use them
+} blackboxEncoder_t;
+
+typedef enum {
+    BLACKBOX_DECODE_FRAME = 0,      // a frame was decoded
+    BLACKBOX_DECODE_SKIPPED,        // an inter frame was read but the frames it depends on were lost
+    BLACKBOX_DECODE_INCOMPLETE,     // the data ends inside the frame
+    BLACKBOX_DECODE_CORRUPT         // not a valid frame, skip the consumed bytes and try again
+} blackboxDecodeResult_e;
+
+typedef struct blackboxDecoder_s {
+    uint8_t motorCount;
+    uint8_t historyLength;
+    blackboxFrame_t history[2];
+} blackboxDecoder_t;
+
+void blackboxEncoderInit(blackboxEncoder_t *encoder, uint8_t motorCount);
+uint8_t blackboxEncodeFrame(blackboxEncoder_t *encoder, const blackboxFrame_t *frame, uint8_t *buffer);
+
+void blackboxDecoderInit(blackboxDecoder_t *decoder, uint8_t motorCount);
+blackboxDecodeResult_e blackboxDecodeFrame(blackboxDecoder_t *decoder, const uint8_t *data, uint32_t length,
+        blackboxFrame_t *frame, uint32_t *consumed);
@@ -0,0 +1,72 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "drivers/system.h"
+
+#include "boot_timing.h"
+
+static const char * const bootStageNames[BOOT_STAGE_COUNT] = {
+    "system",
+    "buses",
+    "sensors",
+    "signal",
+    "outputs",
+    "features",
+    "calibration"
+};
+
+static uint32_t bootStageEndedAt[BOOT_STAGE_COUNT];
+static bool bootComplete = false;
+
+/*
+ * Records the time the stage ended at, the stage took the time since the previous one ended. The first stage starts
+ * when millis() starts counting, in systemInit(), so reading the config before that is not counted.
+ */
+void bootStageEnd(bootStage_e stage)
+{
+    bootStageEndedAt[stage] = millis();
+
+    if (stage == BOOT_STAGE_COUNT - 1) {
+        bootComplete = true;
+    }
+}
+
+bool isBootComplete(void)
+{
+    return bootComplete;
+}
+
+const char *getBootStageName(bootStage_e stage)
+{
+    return bootStageNames[stage];
+}
+
+uint32_t getBootStageMilliseconds(bootStage_e stage)
+{
+    if (stage == BOOT_STAGE_SYSTEM) {
+        return bootStageEndedAt[stage];
+    }
+    if (bootStageEndedAt[stage] < bootStageEndedAt[stage - 1]) {
+        return 0;   // not ended yet
+    }
+    return bootStageEndedAt[stage] - bootStageEndedAt[stage - 1];
+}
@@ -0,0 +1,36 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// the stages of the boot in the order they complete
+typedef enum {
+    BOOT_STAGE_SYSTEM = 0,      // clocks, LEDs and beeper
+    BOOT_STAGE_BUSES,           // SPI, I2C and ADC
+    BOOT_STAGE_SENSORS,         // sensor detection
+    BOOT_STAGE_SIGNAL,          // blinking the LEDs to show the board is up
+    BOOT_STAGE_OUTPUTS,         // mixer, timers, serial ports and PWM
+    BOOT_STAGE_FEATURES,        // receiver, GPS, telemetry and the other features
+    BOOT_STAGE_CALIBRATION,     // the gyro and baro calibrations, they run in the main loop
+    BOOT_STAGE_COUNT
+} bootStage_e;
+
+void bootStageEnd(bootStage_e stage);
+bool isBootComplete(void);
+
+const char *getBootStageName(bootStage_e stage);
+uint32_t getBootStageMilliseconds(bootStage_e stage);
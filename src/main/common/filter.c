@@ -0,0 +1,178 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "filter.h"
+
+#define BIQUAD_BUTTERWORTH_Q 0.70710678f  // 1 / sqrt(2)
+
+#ifndef M_PI_F
+#define M_PI_F 3.14159265358979323846f
+#endif
+
+/*
+ * A cutoff of zero, or one the sample rate cannot represent, turns the filter into a pass through so callers
+ * don't have to special case disabled filters or a sample period that is not known yet.
+ */
+static bool isCutoffUsable(uint16_t cutoffHz, uint32_t samplePeriodUs)
+{
+    return cutoffHz > 0 && samplePeriodUs > 0 && 2.0f * cutoffHz * samplePeriodUs < 1000000.0f;
+}
+
+void pt1FilterInit(pt1Filter_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs)
+{
+    filter->state = 0.0f;
+
+    if (!isCutoffUsable(cutoffHz, samplePeriodUs)) {
+        filter->k = 1.0f;
+        return;
+    }
+
+    float dT = samplePeriodUs * 0.000001f;
+    float RC = 1.0f / (2.0f * M_PI_F * cutoffHz);
+    filter->k = dT / (RC + dT);
+}
+
+float pt1FilterApply(pt1Filter_t *filter, float input)
+{
+    filter->state += filter->k * (input - filter->state);
+    return filter->state;
+}
+
+static void biquadFilterSetPassThrough(biquadFilter_t *filter)
+{
+    filter->b0 = 1.0f;
+    filter->b1 = 0.0f;
+    filter->b2 = 0.0f;
+    filter->a1 = 0.0f;
+    filter->a2 = 0.0f;
+}
+
+/*
+ * Coefficients from the RBJ audio EQ cookbook, b0..b2 are passed un-normalised.
+ */
+static void biquadFilterSetCoefficients(biquadFilter_t *filter, float b0, float b1, float b2, float cs, float alpha)
+{
+    float a0 = 1.0f + alpha;
+
+    filter->b0 = b0 / a0;
+    filter->b1 = b1 / a0;
+    filter->b2 = b2 / a0;
+    filter->a1 = (-2.0f * cs) / a0;
+    filter->a2 = (1.0f - alpha) / a0;
+}
+
+void biquadFilterInitLPF(biquadFilter_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs)
+{
+    filter->d1 = 0.0f;
+    filter->d2 = 0.0f;
+
+    if (!isCutoffUsable(cutoffHz, samplePeriodUs)) {
+        biquadFilterSetPassThrough(filter);
+        return;
+    }
+
+    float omega = 2.0f * M_PI_F * cutoffHz * samplePeriodUs * 0.000001f;
+    float sn = sinf(omega);
+    float cs = cosf(omega);
+    float alpha = sn / (2.0f * BIQUAD_BUTTERWORTH_Q);
+
+    biquadFilterSetCoefficients(filter, (1.0f - cs) / 2.0f, 1.0f - cs, (1.0f - cs) / 2.0f, cs, alpha);
+}
+
+/*
+ * cutoffHz is the lower -3dB edge of the notch, it must be below centerHz.
+ */
+void biquadFilterInitNotch(biquadFilter_t *filter, uint16_t centerHz, uint16_t cutoffHz, uint32_t samplePeriodUs)
+{
+    filter->d1 = 0.0f;
+    filter->d2 = 0.0f;
+
+    if (!isCutoffUsable(centerHz, samplePeriodUs) || cutoffHz == 0 || cutoffHz >= centerHz) {
+        biquadFilterSetPassThrough(filter);
+        return;
+    }
+
+    float Q = ((float)centerHz * cutoffHz) / ((float)centerHz * centerHz - (float)cutoffHz * cutoffHz);
+    float omega = 2.0f * M_PI_F * centerHz * samplePeriodUs * 0.000001f;
+    float sn = sinf(omega);
+    float cs = cosf(omega);
+    float alpha = sn / (2.0f * Q);
+
+    biquadFilterSetCoefficients(filter, 1.0f, -2.0f * cs, 1.0f, cs, alpha);
+}
+
+float biquadFilterApply(biquadFilter_t *filter, float input)
+{
+    float result = filter->b0 * input + filter->d1;
+
+    filter->d1 = filter->b1 * input - filter->a1 * result + filter->d2;
+    filter->d2 = filter->b2 * input - filter->a2 * result;
+
+    return result;
+}
+
+static int32_t biquadCoefficientToFixed(float coefficient)
+{
+    return lrintf(coefficient * (1 << BIQUAD_FIXED_FRACTION_BITS));
+}
+
+/*
+ * The coefficients are computed in float and rounded to Q30, the ones of a low pass for the usual cutoffs and loop
+ * times have no bits below 2^-30 so the fixed point filter has the coefficients of the float one.
+ */
+void biquadFilterFixedInitLPF(biquadFilterFixed_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs)
+{
+    biquadFilter_t coefficients;
+
+    biquadFilterInitLPF(&coefficients, cutoffHz, samplePeriodUs);
+
+    filter->b0 = biquadCoefficientToFixed(coefficients.b0);
+    filter->b1 = biquadCoefficientToFixed(coefficients.b1);
+    filter->b2 = biquadCoefficientToFixed(coefficients.b2);
+    filter->a1 = biquadCoefficientToFixed(coefficients.a1);
+    filter->a2 = biquadCoefficientToFixed(coefficients.a2);
+    filter->d1 = 0;
+    filter->d2 = 0;
+}
+
+// coefficient * value >> 30 without overflowing, the value may use up to 61 bits
+static int64_t biquadMultiplyFixed(int32_t coefficient, int64_t value)
+{
+    int32_t high = (int32_t)(value >> 32);
+    uint32_t low = (uint32_t)value;
+
+    return (int64_t)coefficient * high * (1 << (32 - BIQUAD_FIXED_FRACTION_BITS)) +
+            (((int64_t)coefficient * low) >> BIQUAD_FIXED_FRACTION_BITS);
+}
+
+/*
+ * The input must stay within +-2^30, the result has 30 more fractional bits than the input. Only the feedback
+ * products are rounded, to 2^-30 of an input unit.
+ */
+int64_t biquadFilterFixedApply(biquadFilterFixed_t *filter, int32_t input)
+{
+    int64_t result = (int64_t)filter->b0 * input + filter->d1;
+
+    filter->d1 = (int64_t)filter->b1 * input - biquadMultiplyFixed(filter->a1, result) + filter->d2;
+    filter->d2 = (int64_t)filter->b2 * input - biquadMultiplyFixed(filter->a2, result);
+
+    return result;
+}
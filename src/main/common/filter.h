@@ -0,0 +1,47 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+typedef struct pt1Filter_s {
+    float state;
+    float k;
+} pt1Filter_t;
+
+// transposed direct form II, the coefficients are normalised to a0
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float d1, d2;
+} biquadFilter_t;
+
+#define BIQUAD_FIXED_FRACTION_BITS 30
+
+// the same filter in fixed point, the coefficients are Q30 and the state carries 30 fractional bits more than the input
+typedef struct biquadFilterFixed_s {
+    int32_t b0, b1, b2, a1, a2;
+    int64_t d1, d2;
+} biquadFilterFixed_t;
+
+void pt1FilterInit(pt1Filter_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+
+void biquadFilterInitLPF(biquadFilter_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs);
+void biquadFilterInitNotch(biquadFilter_t *filter, uint16_t centerHz, uint16_t cutoffHz, uint32_t samplePeriodUs);
+float biquadFilterApply(biquadFilter_t *filter, float input);
+
+void biquadFilterFixedInitLPF(biquadFilterFixed_t *filter, uint16_t cutoffHz, uint32_t samplePeriodUs);
+int64_t biquadFilterFixedApply(biquadFilterFixed_t *filter, int32_t input);
@@ -15,9 +15,13 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 
+#include "platform.h"
+
 #include "maths.h"
 
 int32_t applyDeadband(int32_t value, int32_t deadband)
@@ -92,3 +96,153 @@ int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax) {
     return ((a / b) - (destMax - destMin)) + destMax;
 }
 
+#ifdef FAST_MATH
+
+// float constants, M_PI from math.h is a double
+#define M_PI_F      3.14159265358979323846f
+#define M_PI_2_F    (M_PI_F / 2.0f)
+#define M_2PI_F     (2.0f * M_PI_F)
+#define M_LN2_F     0.69314718f
+
+// odd polynomial fitted to sin on [-pi/2, pi/2]
+#define SIN_POLY_COEF3 -1.666568107e-1f
+#define SIN_POLY_COEF5  8.312366210e-3f
+#define SIN_POLY_COEF7 -1.849218155e-4f
+
+float sin_approx(float x)
+{
+    // wrap into [-pi, pi], then fold into [-pi/2, pi/2]
+    int32_t turns = (int32_t)(x * (1.0f / M_2PI_F) + (x >= 0.0f ? 0.5f : -0.5f));
+    x -= turns * M_2PI_F;
+    if (x > M_PI_2_F) {
+        x = M_PI_F - x;
+    } else if (x < -M_PI_2_F) {
+        x = -M_PI_F - x;
+    }
+
+    float x2 = x * x;
+    return x + x * x2 * (SIN_POLY_COEF3 + x2 * (SIN_POLY_COEF5 + x2 * SIN_POLY_COEF7));
+}
+
+float cos_approx(float x)
+{
+    return sin_approx(x + M_PI_2_F);
+}
+
+// rational approximation of atan on [0, 1]
+#define ATAN_POLY_COEF1 3.14551665884836e-07f
+#define ATAN_POLY_COEF2 0.99997356613987f
+#define ATAN_POLY_COEF3 0.14744007058297684f
+#define ATAN_POLY_COEF4 0.3099814292351353f
+#define ATAN_POLY_COEF5 0.05030176425872175f
+#define ATAN_POLY_COEF6 0.1471039133652469f
+#define ATAN_POLY_COEF7 0.6444640676891548f
+
+float atan2_approx(float y, float x)
+{
+    float absX = fabsf(x);
+    float absY = fabsf(y);
+    float ratio = absX > absY ? absX : absY;
+    float result;
+
+    if (ratio > 0.0f) {
+        ratio = (absX < absY ? absX : absY) / ratio;
+    }
+
+    result = -((((ATAN_POLY_COEF5 * ratio - ATAN_POLY_COEF4) * ratio - ATAN_POLY_COEF3) * ratio - ATAN_POLY_COEF2) * ratio - ATAN_POLY_COEF1)
+            / ((ATAN_POLY_COEF7 * ratio + ATAN_POLY_COEF6) * ratio + 1.0f);
+
+    if (absY > absX) {
+        result = M_PI_2_F - result;
+    }
+    if (x < 0.0f) {
+        result = M_PI_F - result;
+    }
+    if (y < 0.0f) {
+        result = -result;
+    }
+    return result;
+}
+
+// Abramowitz and Stegun 4.4.45
+float acos_approx(float x)
+{
+    float absX = fabsf(x);
+    float result = sqrtf(1.0f - absX) * (1.5707288f + absX * (-0.2121144f + absX * (0.0742610f + (-0.0187293f * absX))));
+
+    if (x < 0.0f) {
+        return M_PI_F - result;
+    }
+    return result;
+}
+
+// initial guess from the float bit pattern, refined by two Newton-Raphson iterations
+float invSqrt_approx(float x)
+{
+    float halfX = 0.5f * x;
+    float y;
+    uint32_t bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5F3759DF - (bits >> 1);
+    memcpy(&y, &bits, sizeof(y));
+
+    y = y * (1.5f - halfX * y * y);
+    y = y * (1.5f - halfX * y * y);
+    return y;
+}
+
+/*
+ * ln(x) = e * ln(2) + ln(m) with x = m * 2^e and m in [sqrt(0.5), sqrt(2)),
+ * ln(m) = 2 * atanh(z) with z = (m - 1) / (m + 1), |z| < 0.172 so four terms of the atanh series are enough.
+ */
+static float log_approx(float x)
+{
+    uint32_t bits;
+    int32_t exponent;
+    float m, z, z2;
+
+    memcpy(&bits, &x, sizeof(bits));
+    exponent = (int32_t)((bits >> 23) & 0xFF) - 127;
+    bits = (bits & 0x007FFFFF) | 0x3F800000;
+    memcpy(&m, &bits, sizeof(m));
+
+    if (m > 1.41421356f) {
+        m *= 0.5f;
+        exponent++;
+    }
+
+    z = (m - 1.0f) / (m + 1.0f);
+    z2 = z * z;
+    return 2.0f * z * (1.0f + z2 * (1.0f / 3.0f + z2 * (1.0f / 5.0f + z2 * (1.0f / 7.0f)))) + exponent * M_LN2_F;
+}
+
+/*
+ * e^x = 2^k * e^r with |r| <= ln(2) / 2, e^r from its taylor series.
+ */
+static float exp_approx(float x)
+{
+    int32_t k = (int32_t)(x * (1.0f / M_LN2_F) + (x >= 0.0f ? 0.5f : -0.5f));
+    float r = x - k * M_LN2_F;
+    float result = 1.0f + r * (1.0f + r * (1.0f / 2 + r * (1.0f / 6 + r * (1.0f / 24 + r * (1.0f / 120 + r * (1.0f / 720 + r * (1.0f / 5040)))))));
+    uint32_t bits;
+
+    memcpy(&bits, &result, sizeof(bits));
+    bits += (uint32_t)k << 23;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+float pressureToAltitude(float pressure)
+{
+    return (1.0f - exp_approx(0.190295f * log_approx(pressure / 101325.0f))) * 4433000.0f;
+}
+
+#else
+
+float pressureToAltitude(float pressure)
+{
+    return (1.0f - powf(pressure / 101325.0f, 0.190295f)) * 4433000.0f;
+}
+
+#endif
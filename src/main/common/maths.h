@@ -52,3 +52,25 @@ float devStandardDeviation(stdev_t *dev);
 float degreesToRadians(int16_t degrees);
 
 int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+
+// altitude in cm above the 101325Pa standard pressure level for a pressure in Pa
+float pressureToAltitude(float pressure);
+
+/*
+ * Polynomial approximations of the libm functions used in the flight loop, for targets without an FPU where
+ * libm is very slow. Targets select them by defining FAST_MATH, platform.h must be included before this header.
+ * Maximum errors: sin/cos 2e-6, atan2 1e-6 rad, acos 7e-5 rad, invSqrt 5e-6 relative, see maths_unittest.
+ */
+#ifdef FAST_MATH
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+float invSqrt_approx(float x);
+#else
+#define sin_approx(x)       sinf(x)
+#define cos_approx(x)       cosf(x)
+#define atan2_approx(y, x)  atan2f(y, x)
+#define acos_approx(x)      acosf(x)
+#define invSqrt_approx(x)   (1.0f / sqrtf(x))
+#endif
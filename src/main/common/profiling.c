@@ -0,0 +1,136 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef PROFILING
+
+#include "drivers/system.h"
+
+#include "profiling.h"
+
+#ifdef UNIT_TEST
+// the host has no cycle counter, time stages in microseconds instead
+#define profilingClock() micros()
+#define profilingClockFrequencyMHz() 1
+#else
+#define profilingClock() getCycleCounter()
+#define profilingClockFrequencyMHz() getCycleCounterFrequencyMHz()
+#endif
+
+static const char * const profileStageNames[PROFILE_STAGE_COUNT] = {
+    "IMU",
+    "ANNEX",
+    "PID",
+    "MIXER",
+    "MOTORS",
+    "SERIAL",
+    "TELEMETRY",
+    "LEDSTRIP",
+    "BLACKBOX"
+};
+
+static profileStageStats_t profileStages[PROFILE_STAGE_COUNT];
+static uint32_t cyclesPerMicrosecond = 1;
+
+void profilingReset(void)
+{
+    memset(profileStages, 0, sizeof(profileStages));
+    for (uint8_t stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        profileStages[stage].minCycles = UINT32_MAX;
+    }
+}
+
+void profilingInit(void)
+{
+    cyclesPerMicrosecond = profilingClockFrequencyMHz();
+    if (cyclesPerMicrosecond == 0) {
+        cyclesPerMicrosecond = 1;
+    }
+    profilingReset();
+}
+
+static uint8_t histogramBucketFor(uint32_t cycles)
+{
+    uint32_t us = cycles / cyclesPerMicrosecond;
+    uint8_t bucket = 0;
+
+    while (us >= 4 && bucket < PROFILE_HISTOGRAM_BUCKET_COUNT - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void profileStageBegin(profileStage_e stage)
+{
+    profileStages[stage].startedAt = profilingClock();
+}
+
+void profileStageEnd(profileStage_e stage)
+{
+    profileStageStats_t *stats = &profileStages[stage];
+    uint32_t cycles = profilingClock() - stats->startedAt;
+
+    stats->count++;
+    stats->totalCycles += cycles;
+    if (cycles < stats->minCycles) {
+        stats->minCycles = cycles;
+    }
+    if (cycles > stats->maxCycles) {
+        stats->maxCycles = cycles;
+    }
+
+    uint8_t bucket = histogramBucketFor(cycles);
+    if (stats->histogram[bucket] == UINT16_MAX) {
+        // halve every bucket so the shape of the distribution is kept instead of clipping the busiest one
+        for (uint8_t index = 0; index < PROFILE_HISTOGRAM_BUCKET_COUNT; index++) {
+            stats->histogram[index] >>= 1;
+        }
+    }
+    stats->histogram[bucket]++;
+}
+
+const char *getProfileStageName(profileStage_e stage)
+{
+    return profileStageNames[stage];
+}
+
+const profileStageStats_t *getProfileStageStats(profileStage_e stage)
+{
+    return &profileStages[stage];
+}
+
+uint32_t getProfileStageAverageCycles(profileStage_e stage)
+{
+    const profileStageStats_t *stats = &profileStages[stage];
+    if (stats->count == 0) {
+        return 0;
+    }
+    return stats->totalCycles / stats->count;
+}
+
+uint32_t getProfileCyclesPerMicrosecond(void)
+{
+    return cyclesPerMicrosecond;
+}
+
+#endif
@@ -0,0 +1,198 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ring_buffer.h"
+
+/*
+ * A side reads the index of the other side with acquire and publishes its own with release, so the bytes are in the
+ * buffer before the producer's head says so and have been read before the consumer's tail frees them.
+ */
+#define loadIndex(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define publishIndex(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+
+void ringBufferInit(ringBuffer_t *ringBuffer, volatile uint8_t *buffer, uint16_t size)
+{
+    ringBuffer->buffer = buffer;
+    ringBuffer->mask = size - 1;
+    ringBufferReset(ringBuffer);
+}
+
+// only while neither side is using the buffer
+void ringBufferReset(ringBuffer_t *ringBuffer)
+{
+    ringBuffer->head = 0;
+    ringBuffer->tail = 0;
+    ringBuffer->highWaterMark = 0;
+}
+
+uint16_t ringBufferSize(const ringBuffer_t *ringBuffer)
+{
+    return ringBuffer->mask + 1;
+}
+
+uint16_t ringBufferCount(const ringBuffer_t *ringBuffer)
+{
+    return (uint16_t)(loadIndex(ringBuffer->head) - loadIndex(ringBuffer->tail));
+}
+
+uint16_t ringBufferFree(const ringBuffer_t *ringBuffer)
+{
+    return ringBufferSize(ringBuffer) - ringBufferCount(ringBuffer);
+}
+
+static void updateHighWaterMark(ringBuffer_t *ringBuffer, uint16_t head)
+{
+    uint16_t count = head - loadIndex(ringBuffer->tail);
+
+    if (count > ringBuffer->highWaterMark) {
+        ringBuffer->highWaterMark = count;
+    }
+}
+
+bool ringBufferPut(ringBuffer_t *ringBuffer, uint8_t data)
+{
+    uint16_t head = ringBuffer->head;
+
+    if ((uint16_t)(head - loadIndex(ringBuffer->tail)) > ringBuffer->mask) {
+        return false;
+    }
+
+    ringBuffer->buffer[head & ringBuffer->mask] = data;
+    publishIndex(ringBuffer->head, head + 1);
+    updateHighWaterMark(ringBuffer, head + 1);
+
+    return true;
+}
+
+uint16_t ringBufferWrite(ringBuffer_t *ringBuffer, const uint8_t *data, uint16_t count)
+{
+    uint16_t head = ringBuffer->head;
+    uint16_t bytesFree = ringBufferSize(ringBuffer) - (uint16_t)(head - loadIndex(ringBuffer->tail));
+    uint16_t index = head & ringBuffer->mask;
+    uint16_t chunk;
+
+    if (count > bytesFree) {
+        count = bytesFree;
+    }
+
+    chunk = ringBufferSize(ringBuffer) - index;
+    if (chunk > count) {
+        chunk = count;
+    }
+
+    memcpy((uint8_t *)&ringBuffer->buffer[index], data, chunk);
+    memcpy((uint8_t *)ringBuffer->buffer, data + chunk, count - chunk);
+
+    publishIndex(ringBuffer->head, head + count);
+    updateHighWaterMark(ringBuffer, head + count);
+
+    return count;
+}
+
+// the free space from head up to the end of the buffer, to be filled in place and published by ringBufferProduce()
+uint8_t *ringBufferWritePointer(ringBuffer_t *ringBuffer, uint16_t *contiguous)
+{
+    uint16_t head = ringBuffer->head;
+    uint16_t bytesFree = ringBufferSize(ringBuffer) - (uint16_t)(head - loadIndex(ringBuffer->tail));
+    uint16_t index = head & ringBuffer->mask;
+
+    *contiguous = ringBufferSize(ringBuffer) - index;
+    if (*contiguous > bytesFree) {
+        *contiguous = bytesFree;
+    }
+
+    return (uint8_t *)&ringBuffer->buffer[index];
+}
+
+void ringBufferProduce(ringBuffer_t *ringBuffer, uint16_t count)
+{
+    uint16_t head = ringBuffer->head + count;
+
+    publishIndex(ringBuffer->head, head);
+    updateHighWaterMark(ringBuffer, head);
+}
+
+/*
+ * For a producer that does not maintain head itself, e.g. a circular DMA: publishes everything up to the buffer index
+ * the producer will write next. Called by the consumer, which makes it the only writer of head.
+ */
+void ringBufferProduceUpTo(ringBuffer_t *ringBuffer, uint16_t index)
+{
+    ringBufferProduce(ringBuffer, (index - ringBuffer->head) & ringBuffer->mask);
+}
+
+bool ringBufferGet(ringBuffer_t *ringBuffer, uint8_t *data)
+{
+    uint16_t tail = ringBuffer->tail;
+
+    if (loadIndex(ringBuffer->head) == tail) {
+        return false;
+    }
+
+    *data = ringBuffer->buffer[tail & ringBuffer->mask];
+    publishIndex(ringBuffer->tail, tail + 1);
+
+    return true;
+}
+
+uint16_t ringBufferRead(ringBuffer_t *ringBuffer, uint8_t *data, uint16_t maxCount)
+{
+    uint16_t tail = ringBuffer->tail;
+    uint16_t count = loadIndex(ringBuffer->head) - tail;
+    uint16_t index = tail & ringBuffer->mask;
+    uint16_t chunk;
+
+    if (count > maxCount) {
+        count = maxCount;
+    }
+
+    chunk = ringBufferSize(ringBuffer) - index;
+    if (chunk > count) {
+        chunk = count;
+    }
+
+    memcpy(data, (const uint8_t *)&ringBuffer->buffer[index], chunk);
+    memcpy(data + chunk, (const uint8_t *)ringBuffer->buffer, count - chunk);
+
+    publishIndex(ringBuffer->tail, tail + count);
+
+    return count;
+}
+
+// the bytes waiting from tail up to the end of the buffer, to be used in place and freed by ringBufferConsume()
+const uint8_t *ringBufferReadPointer(const ringBuffer_t *ringBuffer, uint16_t *contiguous)
+{
+    uint16_t tail = ringBuffer->tail;
+    uint16_t count = loadIndex(ringBuffer->head) - tail;
+    uint16_t index = tail & ringBuffer->mask;
+
+    *contiguous = ringBufferSize(ringBuffer) - index;
+    if (*contiguous > count) {
+        *contiguous = count;
+    }
+
+    return (const uint8_t *)&ringBuffer->buffer[index];
+}
+
+void ringBufferConsume(ringBuffer_t *ringBuffer, uint16_t count)
+{
+    publishIndex(ringBuffer->tail, ringBuffer->tail + count);
+}
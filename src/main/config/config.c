@@ -16,6 +16,7 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -32,6 +33,7 @@
 #include "drivers/gpio.h"
 #include "drivers/timer.h"
 #include "drivers/pwm_rx.h"
+#include "drivers/pwm_dshot.h"
 
 #include "sensors/sensors.h"
 #include "sensors/gyro.h"
@@ -62,6 +64,7 @@
 #include "config/config.h"
 #include "config/config_profile.h"
 #include "config/config_master.h"
+#include "config/config_storage.h"
 
 #define BRUSHED_MOTORS_PWM_RATE 16000
 #define BRUSHLESS_MOTORS_PWM_RATE 400
@@ -71,7 +74,11 @@ void mixerUseConfigs(servoParam_t *servoConfToUse, flight3DConfig_t *flight3DCon
         escAndServoConfig_t *escAndServoConfigToUse, mixerConfig_t *mixerConfigToUse,
         airplaneConfig_t *airplaneConfigToUse, rxConfig_t *rxConfig, gimbalConfig_t *gimbalConfigToUse);
 
-#define FLASH_TO_RESERVE_FOR_CONFIG 0x800
+// two slots for the log of config records, see config_storage.h
+#ifndef FLASH_TO_RESERVE_FOR_CONFIG
+#define FLASH_TO_RESERVE_FOR_CONFIG 0x1000
+#endif
+#define CONFIG_SLOT_SIZE (FLASH_TO_RESERVE_FOR_CONFIG / CONFIG_STORAGE_SLOT_COUNT)
 
 #ifndef FLASH_PAGE_COUNT
 #ifdef STM32F303xC
@@ -95,12 +102,65 @@ void mixerUseConfigs(servoParam_t *servoConfToUse, flight3DConfig_t *flight3DCon
 #endif
 
 // use the last flash pages for storage
+#ifndef CONFIG_START_FLASH_ADDRESS
 #define CONFIG_START_FLASH_ADDRESS (0x08000000 + (uint32_t)((FLASH_PAGE_SIZE * FLASH_PAGE_COUNT) - FLASH_TO_RESERVE_FOR_CONFIG))
+#endif
 
 master_t masterConfig;      // master config struct with data independent from profiles
 profile_t *currentProfile;   // profile config struct
 
-static const uint8_t EEPROM_CONF_VERSION = 82;
+#define EEPROM_CONF_VERSION 90
+
+// slots written by firmware with another config version or size hold no sections
+#define CONFIG_LAYOUT (EEPROM_CONF_VERSION | (uint32_t)sizeof(master_t) << 16)
+
+// ids of the stored sections, they must not be reused for other parts of the config
+typedef enum {
+    CONFIG_SECTION_SYSTEM = 0,
+    CONFIG_SECTION_MIXER,
+    CONFIG_SECTION_ESC_AND_SERVO,
+    CONFIG_SECTION_SENSORS,
+    CONFIG_SECTION_CALIBRATION,
+    CONFIG_SECTION_BATTERY,
+    CONFIG_SECTION_RX,
+    CONFIG_SECTION_AIRPLANE,
+    CONFIG_SECTION_GPS,
+    CONFIG_SECTION_SERIAL,
+    CONFIG_SECTION_TELEMETRY,
+    CONFIG_SECTION_LED_STRIP,
+    CONFIG_SECTION_PROFILE_1,
+    CONFIG_SECTION_PROFILE_2,
+    CONFIG_SECTION_PROFILE_3,
+    CONFIG_SECTION_PROFILE_SELECTION
+} configSectionId_e;
+
+// in the order of master_t, a section ends where the next one starts
+static const configStorageSection_t configSections[] = {
+    { CONFIG_SECTION_SYSTEM,            0 },
+    { CONFIG_SECTION_MIXER,             offsetof(master_t, customMixer) },
+    { CONFIG_SECTION_ESC_AND_SERVO,     offsetof(master_t, escAndServoConfig) },
+    { CONFIG_SECTION_SENSORS,           offsetof(master_t, sensorAlignmentConfig) },
+    { CONFIG_SECTION_CALIBRATION,       offsetof(master_t, accZero) },     // saved by the stick trims and calibrations
+    { CONFIG_SECTION_BATTERY,           offsetof(master_t, batteryConfig) },
+    { CONFIG_SECTION_RX,                offsetof(master_t, rxConfig) },
+    { CONFIG_SECTION_AIRPLANE,          offsetof(master_t, airplaneConfig) },
+#ifdef GPS
+    { CONFIG_SECTION_GPS,               offsetof(master_t, gpsConfig) },
+#endif
+    { CONFIG_SECTION_SERIAL,            offsetof(master_t, serialConfig) },
+    { CONFIG_SECTION_TELEMETRY,         offsetof(master_t, telemetryConfig) },
+#ifdef LED_STRIP
+    { CONFIG_SECTION_LED_STRIP,         offsetof(master_t, ledConfigs) },
+#endif
+    { CONFIG_SECTION_PROFILE_1,         offsetof(master_t, profile[0]) },
+    { CONFIG_SECTION_PROFILE_2,         offsetof(master_t, profile[1]) },
+    { CONFIG_SECTION_PROFILE_3,         offsetof(master_t, profile[2]) },
+    { CONFIG_SECTION_PROFILE_SELECTION, offsetof(master_t, current_profile_index) },
+};
+
+#define CONFIG_SECTION_COUNT (sizeof(configSections) / sizeof(configSections[0]))
+
+static configStorage_t configStorage;
 
 static void resetAccelerometerTrims(flightDynamicsTrims_t *accelerometerTrims)
 {
@@ -151,6 +211,8 @@ static void resetPidProfile(pidProfile_t *pidProfile)
     pidProfile->D_f[YAW] = 0.05f;
     pidProfile->A_level = 5.0f;
     pidProfile->H_level = 3.0f;
+
+    pidProfile->dterm_lpf_hz = 0;
 }
 
 #ifdef GPS
@@ -246,7 +308,6 @@ static void resetConf(void)
     memset(&masterConfig, 0, sizeof(master_t));
     setProfile(0);
 
-    masterConfig.version = EEPROM_CONF_VERSION;
     masterConfig.mixerConfiguration = MULTITYPE_QUADX;
     featureClearAll();
 #ifdef CJMCU
@@ -258,6 +319,9 @@ static void resetConf(void)
     masterConfig.current_profile_index = 0;     // default profile
     masterConfig.gyro_cmpf_factor = 600;        // default MWC
     masterConfig.gyro_cmpfm_factor = 250;       // default MWC
+    masterConfig.attitude_estimator = ATTITUDE_ESTIMATOR_COMPLEMENTARY;
+    masterConfig.dcm_kp = 2500;                 // 0.25 * 10000
+    masterConfig.dcm_ki = 50;                   // 0.005 * 10000
     masterConfig.gyro_lpf = 42;                 // supported by all gyro drivers now. In case of ST gyro, will default to 32Hz instead
 
     resetAccelerometerTrims(&masterConfig.accZero);
@@ -271,6 +335,9 @@ static void resetConf(void)
     masterConfig.max_angle_inclination = 500;    // 50 degrees
     masterConfig.yaw_control_direction = 1;
     masterConfig.gyroConfig.gyroMovementCalibrationThreshold = 32;
+    masterConfig.gyroConfig.soft_gyro_lpf_hz = 0;
+    masterConfig.gyroConfig.soft_gyro_notch_hz = 0;
+    masterConfig.gyroConfig.soft_gyro_notch_cutoff_hz = 0;
 
     masterConfig.batteryConfig.vbatscale = VBAT_SCALE_DEFAULT;
     masterConfig.batteryConfig.vbatmaxcellvoltage = 43;
@@ -304,6 +371,7 @@ static void resetConf(void)
 #else
     masterConfig.motor_pwm_rate = BRUSHLESS_MOTORS_PWM_RATE;
 #endif
+    masterConfig.dshot_rate = DSHOT_DEFAULT_RATE;
     masterConfig.servo_pwm_rate = 50;
 
 #ifdef GPS
@@ -316,8 +384,13 @@ static void resetConf(void)
     resetSerialConfig(&masterConfig.serialConfig);
 
     masterConfig.looptime = 3500;
+    masterConfig.gyro_sync = 0;
+    masterConfig.gyro_sync_denom = 1;
+    masterConfig.pid_process_denom = 1;
     masterConfig.emf_avoidance = 0;
 
+    masterConfig.blackbox_rate_denom = 1;
+
     currentProfile->pidController = 0;
     resetPidProfile(&currentProfile->pidProfile);
 
@@ -336,7 +409,7 @@ static void resetConf(void)
     resetRollAndPitchTrims(&currentProfile->accelerometerTrims);
 
     currentProfile->mag_declination = 0;
-    currentProfile->acc_lpf_factor = 4;
+    currentProfile->acc_lpf_hz = 15;
     currentProfile->accz_lpf_cutoff = 5.0f;
     currentProfile->accDeadband.xy = 40;
     currentProfile->accDeadband.z = 40;
@@ -394,36 +467,10 @@ static void resetConf(void)
         memcpy(&masterConfig.profile[i], currentProfile, sizeof(profile_t));
 }
 
-static uint8_t calculateChecksum(const uint8_t *data, uint32_t length)
-{
-    uint8_t checksum = 0;
-    const uint8_t *byteOffset;
-
-    for (byteOffset = data; byteOffset < (data + length); byteOffset++)
-        checksum ^= *byteOffset;
-    return checksum;
-}
-
+// every section has an intact record of the current layout
 static bool isEEPROMContentValid(void)
 {
-    const master_t *temp = (const master_t *) CONFIG_START_FLASH_ADDRESS;
-    uint8_t checksum = 0;
-
-    // check version number
-    if (EEPROM_CONF_VERSION != temp->version)
-        return false;
-
-    // check size and magic numbers
-    if (temp->size != sizeof(master_t) || temp->magic_be != 0xBE || temp->magic_ef != 0xEF)
-        return false;
-
-    // verify integrity of temporary copy
-    checksum = calculateChecksum((const uint8_t *) temp, sizeof(master_t));
-    if (checksum != 0)
-        return false;
-
-    // looks good, let's roll!
-    return true;
+    return configStorageStoredSectionCount(&configStorage) == CONFIG_SECTION_COUNT;
 }
 
 void activateConfig(void)
@@ -457,7 +504,10 @@ void activateConfig(void)
 
     imuRuntimeConfig.gyro_cmpf_factor = masterConfig.gyro_cmpf_factor;
     imuRuntimeConfig.gyro_cmpfm_factor = masterConfig.gyro_cmpfm_factor;
-    imuRuntimeConfig.acc_lpf_factor = currentProfile->acc_lpf_factor;
+    imuRuntimeConfig.attitude_estimator = masterConfig.attitude_estimator;
+    imuRuntimeConfig.dcm_kp = masterConfig.dcm_kp / 10000.0f;
+    imuRuntimeConfig.dcm_ki = masterConfig.dcm_ki / 10000.0f;
+    imuRuntimeConfig.acc_lpf_hz = currentProfile->acc_lpf_hz;
     imuRuntimeConfig.acc_unarmedcal = currentProfile->acc_unarmedcal;;
     imuRuntimeConfig.small_angle = masterConfig.small_angle;
 
@@ -542,16 +592,16 @@ void validateAndFixConfig(void)
 
 void initEEPROM(void)
 {
+    // Generate compile time error if the config does not fit in a slot of the reserved area of flash.
+    BUILD_BUG_ON(CONFIG_STORAGE_COMPACTED_SIZE(sizeof(master_t), CONFIG_SECTION_COUNT) > CONFIG_SLOT_SIZE);
+    BUILD_BUG_ON(CONFIG_SECTION_COUNT > CONFIG_STORAGE_MAX_SECTIONS);
+
+    configStorageInit(&configStorage, CONFIG_START_FLASH_ADDRESS, CONFIG_SLOT_SIZE, FLASH_PAGE_SIZE,
+            CONFIG_LAYOUT, configSections, CONFIG_SECTION_COUNT, sizeof(master_t));
 }
 
-void readEEPROM(void)
+static void applyConfig(void)
 {
-    // Sanity check
-    if (!isEEPROMContentValid())
-        failureMode(10);
-
-    // Read flash
-    memcpy(&masterConfig, (char *) CONFIG_START_FLASH_ADDRESS, sizeof(master_t));
     // Copy current profile
     if (masterConfig.current_profile_index > 2) // sanity check
         masterConfig.current_profile_index = 0;
@@ -562,6 +612,18 @@ void readEEPROM(void)
     activateConfig();
 }
 
+void readEEPROM(void)
+{
+    // Sanity check
+    if (!isEEPROMContentValid())
+        failureMode(10);
+
+    // Read flash
+    configStorageLoad(&configStorage, &masterConfig);
+
+    applyConfig();
+}
+
 void readEEPROMAndNotify(void)
 {
     // re-read written data
@@ -571,63 +633,57 @@ void readEEPROMAndNotify(void)
 
 void writeEEPROM(void)
 {
-    // Generate compile time error if the config does not fit in the reserved area of flash.
-    BUILD_BUG_ON(sizeof(master_t) > FLASH_TO_RESERVE_FOR_CONFIG);
-
-    FLASH_Status status = 0;
-    uint32_t wordOffset;
-    int8_t attemptsRemaining = 3;
-
-    // prepare checksum/version constants
-    masterConfig.version = EEPROM_CONF_VERSION;
-    masterConfig.size = sizeof(master_t);
-    masterConfig.magic_be = 0xBE;
-    masterConfig.magic_ef = 0xEF;
-    masterConfig.chk = 0; // erase checksum before recalculating
-    masterConfig.chk = calculateChecksum((const uint8_t *) &masterConfig, sizeof(master_t));
-
-    // write it
-    FLASH_Unlock();
-    while (attemptsRemaining--) {
-#ifdef STM32F303
-        FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
-#endif
-#ifdef STM32F10X
-        FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
-#endif
-        for (wordOffset = 0; wordOffset < sizeof(master_t); wordOffset += 4) {
-            if (wordOffset % FLASH_PAGE_SIZE == 0) {
-                status = FLASH_ErasePage(CONFIG_START_FLASH_ADDRESS + wordOffset);
-                if (status != FLASH_COMPLETE) {
-                    break;
-                }
-            }
-
-            status = FLASH_ProgramWord(CONFIG_START_FLASH_ADDRESS + wordOffset,
-                    *(uint32_t *) ((char *) &masterConfig + wordOffset));
-            if (status != FLASH_COMPLETE) {
-                break;
-            }
-        }
-        if (status == FLASH_COMPLETE) {
-            break;
-        }
+    configStorageStartSave(&configStorage, &masterConfig);
+    while (configStorageIsSaving(&configStorage)) {
+        configStorageProcess(&configStorage, true);
     }
-    FLASH_Lock();
 
     // Flash write failed - just die now
-    if (status != FLASH_COMPLETE || !isEEPROMContentValid()) {
+    if (configStorage.state == CONFIG_STORAGE_FAILED || !isEEPROMContentValid()) {
         failureMode(10);
     }
 }
 
+// saves masterConfig in the background, a step at a time in processEEPROMWrite()
+void requestEEPROMWrite(void)
+{
+    configStorageStartSave(&configStorage, &masterConfig);
+}
+
+// true while a save, or erasing the previous copy after a save, can make progress in processEEPROMWrite()
+bool isEEPROMWritePending(void)
+{
+    bool eraseAllowed = !ARMING_FLAG(ARMED);
+
+    switch (configStorage.state) {
+        case CONFIG_STORAGE_IDLE:
+            return !configStorage.spareErased && eraseAllowed;
+        case CONFIG_STORAGE_ERASING:
+            return eraseAllowed;
+        case CONFIG_STORAGE_WRITING:
+            return true;
+        case CONFIG_STORAGE_FAILED:
+            break;
+    }
+    return false;
+}
+
+// erasing a page stalls the cpu for milliseconds, it waits until disarmed
+void processEEPROMWrite(void)
+{
+    configStorageProcess(&configStorage, !ARMING_FLAG(ARMED));
+}
+
+// only the sections without an intact record are reset, all of them when the flash holds no config of this layout
 void ensureEEPROMContainsValidData(void)
 {
     if (isEEPROMContentValid()) {
         return;
     }
 
-    resetEEPROM();
+    resetConf();
+    configStorageLoad(&configStorage, &masterConfig);
+    writeEEPROM();
 }
 
 void resetEEPROM(void)
@@ -636,10 +692,12 @@ void resetEEPROM(void)
     writeEEPROM();
 }
 
+// the callers may be flying, the config is used straight away and written to flash in the background
 void saveConfigAndNotify(void)
 {
-    writeEEPROM();
-    readEEPROMAndNotify();
+    applyConfig();
+    requestEEPROMWrite();
+    blinkLedAndSoundBeeper(15, 20, 1);
 }
 
 void changeProfile(uint8_t profileIndex)
@@ -35,7 +35,10 @@ typedef enum {
     FEATURE_RX_MSP = 1 << 14,
     FEATURE_RSSI_ADC = 1 << 15,
     FEATURE_LED_STRIP = 1 << 16,
-    FEATURE_DISPLAY = 1 << 17
+    FEATURE_DISPLAY = 1 << 17,
+    FEATURE_BLACKBOX = 1 << 18,
+    FEATURE_ONESHOT125 = 1 << 19,
+    FEATURE_DSHOT = 1 << 20
 } features_e;
 
 bool feature(uint32_t mask);
@@ -51,6 +54,9 @@ void resetEEPROM(void);
 void readEEPROM(void);
 void readEEPROMAndNotify(void);
 void writeEEPROM();
+void requestEEPROMWrite(void);
+bool isEEPROMWritePending(void);
+void processEEPROMWrite(void);
 void ensureEEPROMContainsValidData(void);
 void saveConfigAndNotify(void);
 void changeProfile(uint8_t profileIndex);
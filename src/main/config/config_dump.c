@@ -0,0 +1,198 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/color.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/serial.h"
+#include "drivers/pwm_rx.h"
+#include "flight/flight.h"
+#include "flight/mixer.h"
+#include "flight/navigation.h"
+#include "flight/failsafe.h"
+#include "rx/rx.h"
+#include "io/escservo.h"
+#include "io/gps.h"
+#include "io/gimbal.h"
+#include "io/rc_controls.h"
+#include "io/serial.h"
+#include "io/ledstrip.h"
+#include "sensors/battery.h"
+#include "sensors/boardalignment.h"
+#include "sensors/sensors.h"
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+#include "sensors/barometer.h"
+#include "flight/imu.h"
+#include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "config/config_values.h"
+#include "config/config_dump.h"
+
+// 0 for an unknown type, the record cannot be skipped then
+uint8_t configDumpValueSize(uint8_t type)
+{
+    switch (type) {
+        case VAR_UINT8:
+        case VAR_INT8:
+            return 1;
+
+        case VAR_UINT16:
+        case VAR_INT16:
+            return 2;
+
+        case VAR_UINT32:
+        case VAR_FLOAT:
+            return 4;
+    }
+    return 0;
+}
+
+// returns the size of the record
+uint8_t configDumpEncodeRecord(uint8_t *buffer, const configDumpRecord_t *record)
+{
+    uint8_t size = configDumpValueSize(record->type);
+    uint32_t bits;
+    uint8_t i;
+
+    if (record->type == VAR_FLOAT) {
+        memcpy(&bits, &record->value.float_value, sizeof(bits));
+    } else {
+        bits = record->value.int_value;
+    }
+
+    buffer[0] = record->id & 0xff;
+    buffer[1] = record->id >> 8;
+    buffer[2] = record->profileIndex;
+    buffer[3] = record->type;
+    for (i = 0; i < size; i++) {
+        buffer[CONFIG_DUMP_RECORD_HEADER_SIZE + i] = (bits >> (i * 8)) & 0xff;
+    }
+
+    return CONFIG_DUMP_RECORD_HEADER_SIZE + size;
+}
+
+// returns the size of the record, 0 when length does not hold all of it or the type is not known
+uint8_t configDumpDecodeRecord(const uint8_t *buffer, uint16_t length, configDumpRecord_t *record)
+{
+    uint32_t bits = 0;
+    uint8_t size;
+    uint8_t i;
+
+    if (length < CONFIG_DUMP_RECORD_HEADER_SIZE) {
+        return 0;
+    }
+
+    size = configDumpValueSize(buffer[3]);
+    if (size == 0 || length < CONFIG_DUMP_RECORD_HEADER_SIZE + size) {
+        return 0;
+    }
+
+    record->id = buffer[0] | (buffer[1] << 8);
+    record->profileIndex = buffer[2];
+    record->type = buffer[3];
+
+    for (i = 0; i < size; i++) {
+        bits |= (uint32_t)buffer[CONFIG_DUMP_RECORD_HEADER_SIZE + i] << (i * 8);
+    }
+
+    switch (record->type) {
+        case VAR_INT8:
+            record->value.int_value = (int8_t)bits;
+            break;
+
+        case VAR_INT16:
+            record->value.int_value = (int16_t)bits;
+            break;
+
+        case VAR_FLOAT:
+            memcpy(&record->value.float_value, &bits, sizeof(bits));
+            break;
+
+        default:
+            record->value.int_value = bits;
+            break;
+    }
+
+    return CONFIG_DUMP_RECORD_HEADER_SIZE + size;
+}
+
+// the dump walks every value of every profile, see configDumpGetRecord()
+uint16_t configDumpIndexCount(void)
+{
+    return configValueCount * MAX_PROFILE_COUNT;
+}
+
+// returns false when there is no record at the index, master values are only at the indexes of the first profile
+bool configDumpGetRecord(const master_t *config, uint16_t index, configDumpRecord_t *record)
+{
+    uint8_t profileIndex = index / configValueCount;
+    const configValue_t *value = &configValues[index % configValueCount];
+
+    if (profileIndex >= MAX_PROFILE_COUNT || ((value->type & MASTER_VALUE) && profileIndex > 0)) {
+        return false;
+    }
+
+    record->id = value->id;
+    record->profileIndex = (value->type & PROFILE_VALUE) ? profileIndex : 0;
+    record->type = value->type & VALUE_TYPE_MASK;
+    record->value = configValueGet(config, value, profileIndex);
+    return true;
+}
+
+configDumpResult_e configDumpApplyRecord(master_t *config, const configDumpRecord_t *record)
+{
+    const configValue_t *value = findConfigValueById(record->id);
+    int_float_value_t newValue = record->value;
+
+    if (!value) {
+        return CONFIG_DUMP_UNKNOWN_VALUE;
+    }
+
+    if (record->profileIndex >= MAX_PROFILE_COUNT || ((value->type & MASTER_VALUE) && record->profileIndex > 0)) {
+        return CONFIG_DUMP_OUT_OF_RANGE;
+    }
+
+    // the type of a value may change between firmware versions
+    if ((value->type & VAR_FLOAT) && record->type != VAR_FLOAT) {
+        newValue.float_value = record->value.int_value;
+    } else if (!(value->type & VAR_FLOAT) && record->type == VAR_FLOAT) {
+        newValue.int_value = lrintf(record->value.float_value);
+    }
+
+    if (!isConfigValueInRange(value, newValue)) {
+        return CONFIG_DUMP_OUT_OF_RANGE;
+    }
+
+    configValueSet(config, value, record->profileIndex, newValue);
+    return CONFIG_DUMP_APPLIED;
+}
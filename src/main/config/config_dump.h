@@ -0,0 +1,56 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * A binary dump of the config values, see configValues[]. It survives a change of the config layout, every value is
+ * stored with its id and type: values of ids the firmware does not know are skipped, values of another type are
+ * converted to the type of the firmware.
+ *
+ * Dump:   format version (8 bits), records...
+ * Record: id (16 bits), profile (8 bits, 0 for master values), type (8 bits, VAR_UINT8..VAR_FLOAT), value (1, 2 or
+ *         4 bytes by type)
+ *
+ * All fields are little endian. The master values come first, then the profile values of each profile.
+ */
+
+#define CONFIG_DUMP_FORMAT_VERSION 1
+
+#define CONFIG_DUMP_RECORD_HEADER_SIZE 4
+#define CONFIG_DUMP_RECORD_MAX_SIZE (CONFIG_DUMP_RECORD_HEADER_SIZE + 4)
+
+typedef struct configDumpRecord_s {
+    uint16_t id;
+    uint8_t profileIndex;
+    uint8_t type;               // one of VALUE_TYPE_MASK
+    int_float_value_t value;
+} configDumpRecord_t;
+
+typedef enum {
+    CONFIG_DUMP_APPLIED = 0,
+    CONFIG_DUMP_UNKNOWN_VALUE,      // from firmware that has a value this one does not
+    CONFIG_DUMP_OUT_OF_RANGE        // the value or its profile
+} configDumpResult_e;
+
+uint8_t configDumpValueSize(uint8_t type);
+uint8_t configDumpEncodeRecord(uint8_t *buffer, const configDumpRecord_t *record);
+uint8_t configDumpDecodeRecord(const uint8_t *buffer, uint16_t length, configDumpRecord_t *record);
+
+uint16_t configDumpIndexCount(void);
+bool configDumpGetRecord(const master_t *config, uint16_t index, configDumpRecord_t *record);
+configDumpResult_e configDumpApplyRecord(master_t *config, const configDumpRecord_t *record);
@@ -17,15 +17,16 @@
 
 #pragma once
 
+#define MAX_PROFILE_COUNT 3
+
 // System-wide
 typedef struct master_t {
-    uint8_t version;
-    uint16_t size;
-    uint8_t magic_be;                       // magic number, should be 0xBE
-
     uint8_t mixerConfiguration;
     uint32_t enabledFeatures;
     uint16_t looptime;                      // imu loop time in us
+    uint8_t gyro_sync;                      // run the imu loop from the gyro data ready interrupt instead of looptime
+    uint8_t gyro_sync_denom;                // run the imu loop on every nth gyro sample when gyro_sync is enabled
+    uint8_t pid_process_denom;              // run the pid loop on every nth imu loop, the gyro samples in between are averaged
     uint8_t emf_avoidance;                   // change pll settings to avoid noise in the uhf band
 
     motorMixer_t customMixer[MAX_SUPPORTED_MOTORS]; // custom mixtable
@@ -35,6 +36,7 @@ typedef struct master_t {
     flight3DConfig_t flight3DConfig;
 
     uint16_t motor_pwm_rate;                // The update rate of motor outputs (50-498Hz)
+    uint16_t dshot_rate;                    // bit rate of the DShot frames in kbit/s, 150, 300 or 600
     uint16_t servo_pwm_rate;                // The update rate of servo outputs (50-498Hz)
 
     // global sensor-related stuff
@@ -47,12 +49,16 @@ typedef struct master_t {
     uint16_t gyro_lpf;                      // gyro LPF setting - values are driver specific, in case of invalid number, a reasonable default ~30-40HZ is chosen.
     uint16_t gyro_cmpf_factor;              // Set the Gyro Weight for Gyro/Acc complementary filter. Increasing this value would reduce and delay Acc influence on the output of the filter.
     uint16_t gyro_cmpfm_factor;             // Set the Gyro Weight for Gyro/Magnetometer complementary filter. Increasing this value would reduce and delay Magnetometer influence on the output of the filter
+    uint8_t attitude_estimator;             // 0 = complementary filter, 1 = quaternion (Mahony) estimator
+    uint16_t dcm_kp;                        // quaternion estimator drift correction, proportional gain * 10000
+    uint16_t dcm_ki;                        // quaternion estimator drift correction, integral (gyro bias) gain * 10000
 
     gyroConfig_t gyroConfig;
 
     uint16_t max_angle_inclination;         // max inclination allowed in angle (level) mode. default 500 (50 degrees).
     flightDynamicsTrims_t accZero;
     flightDynamicsTrims_t magZero;
+    knownSensors_t knownSensors;
 
     batteryConfig_t batteryConfig;
 
@@ -74,16 +80,15 @@ typedef struct master_t {
 
     telemetryConfig_t telemetryConfig;
 
+    uint8_t blackbox_rate_denom;            // log every nth pid loop iteration to the blackbox
+
 #ifdef LED_STRIP
     ledConfig_t ledConfigs[MAX_LED_STRIP_LENGTH];
     hsvColor_t colors[CONFIGURABLE_COLOR_COUNT];
 #endif
 
-    profile_t profile[3];                   // 3 separate profiles
+    profile_t profile[MAX_PROFILE_COUNT];   // 3 separate profiles
     uint8_t current_profile_index;          // currently loaded profile
-
-    uint8_t magic_ef;                       // magic number, should be 0xEF
-    uint8_t chk;                            // XOR checksum
 } master_t;
 
 extern master_t masterConfig;
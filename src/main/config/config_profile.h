@@ -33,7 +33,7 @@ typedef struct profile_s {
     rollAndPitchTrims_t accelerometerTrims; // accelerometer trim
 
     // sensor-related stuff
-    uint8_t acc_lpf_factor;                 // Set the Low Pass Filter factor for ACC. Increasing this value would reduce ACC noise (visible in GUI), but would increase ACC lag time. Zero = no filter
+    uint8_t acc_lpf_hz;                     // cutoff of the PT1 low pass filter for ACC in Hz. Lowering this value reduces ACC noise (visible in GUI), but increases ACC lag time. Zero = no filter
     float accz_lpf_cutoff;                  // cutoff frequency for the low pass filter used on the acc z-axis for althold in Hz
     accDeadband_t accDeadband;
 
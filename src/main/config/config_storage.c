@@ -0,0 +1,540 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/crc.h"
+#include "common/maths.h"
+
+#include "config/config_storage.h"
+
+#define CONFIG_STORAGE_WRITE_ATTEMPTS 3
+
+#define COMMIT_WORD_OFFSET 0
+#define LAYOUT_WORD_OFFSET 4
+
+#define RECORD_CRC_OFFSET 4
+
+#define RECORD_ID_MASK 0x7F
+#define RECORD_LAST 0x80        // the last record of a save
+
+// the CRC unit computes the same CRC as crc32Stm32()
+#if defined(STM32F10X) || defined(STM32F303)
+#define USE_CRC_UNIT
+#endif
+
+static uintptr_t slotAddress(const configStorage_t *storage, uint8_t slot)
+{
+    return storage->address + slot * storage->slotSize;
+}
+
+static uint8_t spareSlot(const configStorage_t *storage)
+{
+    return storage->activeSlot == 1 ? 0 : 1;
+}
+
+static uintptr_t targetAddress(const configStorage_t *storage)
+{
+    return slotAddress(storage, storage->compacting ? spareSlot(storage) : storage->activeSlot);
+}
+
+static uint16_t sectionSize(const configStorage_t *storage, uint8_t index)
+{
+    uint16_t end = index + 1 < storage->sectionCount ? storage->sections[index + 1].offset : storage->size;
+
+    return end - storage->sections[index].offset;
+}
+
+static uint32_t recordSize(uint16_t size)
+{
+    return CONFIG_STORAGE_RECORD_HEADER_SIZE + ((size + 3) & ~3);
+}
+
+static uint32_t recordHeader(uint8_t idAndFlags, uint16_t size)
+{
+    return idAndFlags | (uint32_t)size << 16;
+}
+
+// data is the record in flash, the padding of its last word is part of the CRC
+static uint32_t recordCrc(uint32_t header, const uint8_t *data, uint16_t size)
+{
+    const uint32_t *word = (const uint32_t *)data;
+    uint32_t wordCount = (size + 3) / sizeof(*word);
+
+#ifdef USE_CRC_UNIT
+    CRC->CR = CRC_CR_RESET;
+    CRC->DR = header;
+    while (wordCount--) {
+        CRC->DR = *word++;
+    }
+    return CRC->DR;
+#else
+    return crc32Stm32(crc32Stm32(CRC32_STM32_INIT, &header, 1), word, wordCount);
+#endif
+}
+
+static uint32_t commitWord(uint16_t sequence)
+{
+    return sequence | ((uint32_t)(uint16_t)~sequence << 16);
+}
+
+/*
+ * The flash programs a word as two half words, low half first, so a word cut short by a power loss still has the
+ * erased high half. Sequence 0 is never used, its low half would match the erased high half.
+ */
+static bool readCommitWord(const configStorage_t *storage, uint8_t slot, uint16_t *sequence)
+{
+    uint32_t word = *(const uint32_t *)(slotAddress(storage, slot) + COMMIT_WORD_OFFSET);
+
+    if (word != commitWord(word & 0xFFFF) || (word & 0xFFFF) == 0) {
+        return false;
+    }
+
+    *sequence = word & 0xFFFF;
+    return true;
+}
+
+static bool isErased(uintptr_t address, uint32_t length)
+{
+    const uint32_t *word = (const uint32_t *)address;
+
+    for (length /= sizeof(*word); length; length--) {
+        if (*word++ != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int8_t findSection(const configStorage_t *storage, uint8_t id)
+{
+    uint8_t index;
+
+    for (index = 0; index < storage->sectionCount; index++) {
+        if (storage->sections[index].id == id) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Walks the log of the active slot. The records of a save are collected until its last record, a save cut short by
+ * a power loss is dropped and the log is not appended to, the next save compacts it.
+ */
+static void scanLog(configStorage_t *storage)
+{
+    uintptr_t slot = slotAddress(storage, storage->activeSlot);
+    const uint8_t *group[CONFIG_STORAGE_MAX_SECTIONS];
+    bool groupPending = false;
+    uint32_t offset = CONFIG_STORAGE_HEADER_SIZE;
+    uint8_t index;
+
+    memset(group, 0, sizeof(group));
+
+    if (*(const uint32_t *)(slot + LAYOUT_WORD_OFFSET) != storage->layout) {
+        return;
+    }
+
+    while (offset + CONFIG_STORAGE_RECORD_HEADER_SIZE <= storage->slotSize) {
+        uint32_t header = *(const uint32_t *)(slot + offset);
+        uint32_t crc = *(const uint32_t *)(slot + offset + RECORD_CRC_OFFSET);
+        const uint8_t *data = (const uint8_t *)(slot + offset + CONFIG_STORAGE_RECORD_HEADER_SIZE);
+        uint16_t size = header >> 16;
+
+        if (header == 0xFFFFFFFF) {
+            storage->endOffset = offset;
+            storage->appendable = !groupPending && isErased(slot + offset, storage->slotSize - offset);
+            return;
+        }
+
+        // the log after a damaged header can not be walked
+        if (size == 0 || offset + recordSize(size) > storage->slotSize) {
+            return;
+        }
+
+        if (recordCrc(header, data, size) == crc) {
+            int8_t section = findSection(storage, header & RECORD_ID_MASK);
+            if (section >= 0 && size == sectionSize(storage, section)) {
+                group[section] = data;
+                groupPending = true;
+            }
+        }
+
+        // a save is complete even if its last record went bad since
+        if (header & RECORD_LAST) {
+            for (index = 0; index < storage->sectionCount; index++) {
+                if (group[index]) {
+                    storage->stored[index] = group[index];
+                }
+            }
+            memset(group, 0, sizeof(group));
+            groupPending = false;
+        }
+
+        offset += recordSize(size);
+    }
+}
+
+void configStorageInit(configStorage_t *storage, uintptr_t address, uint32_t slotSize, uint16_t pageSize,
+        uint32_t layout, const configStorageSection_t *sections, uint8_t sectionCount, uint16_t size)
+{
+    uint16_t sequence;
+    uint8_t slot;
+
+    memset(storage, 0, sizeof(*storage));
+    storage->address = address;
+    storage->slotSize = slotSize;
+    storage->pageSize = pageSize;
+    storage->layout = layout;
+    storage->sections = sections;
+    storage->sectionCount = min(sectionCount, CONFIG_STORAGE_MAX_SECTIONS);
+    storage->size = size;
+    storage->activeSlot = -1;
+
+#ifdef USE_CRC_UNIT
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+#endif
+
+    for (slot = 0; slot < CONFIG_STORAGE_SLOT_COUNT; slot++) {
+        if (!readCommitWord(storage, slot, &sequence)) {
+            continue;
+        }
+
+        if (storage->activeSlot < 0 || (int16_t)(sequence - storage->sequence) > 0) {
+            storage->activeSlot = slot;
+            storage->sequence = sequence;
+        }
+    }
+
+    if (storage->activeSlot >= 0) {
+        scanLog(storage);
+    }
+
+    storage->spareErased = isErased(slotAddress(storage, spareSlot(storage)), slotSize);
+    storage->state = CONFIG_STORAGE_IDLE;
+}
+
+// the number of sections found in the log, a section whose records are all damaged is missing
+uint8_t configStorageStoredSectionCount(const configStorage_t *storage)
+{
+    uint8_t count = 0;
+    uint8_t index;
+
+    for (index = 0; index < storage->sectionCount; index++) {
+        if (storage->stored[index]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// copies the stored sections into data, missing sections are left as they are
+void configStorageLoad(const configStorage_t *storage, void *data)
+{
+    uint8_t index;
+
+    for (index = 0; index < storage->sectionCount; index++) {
+        if (storage->stored[index]) {
+            memcpy((uint8_t *)data + storage->sections[index].offset, storage->stored[index], sectionSize(storage, index));
+        }
+    }
+}
+
+static bool isSectionChanged(const configStorage_t *storage, uint8_t index)
+{
+    return !storage->stored[index]
+        || memcmp(storage->stored[index], storage->data + storage->sections[index].offset, sectionSize(storage, index)) != 0;
+}
+
+// the index of the next section to write from index on, sectionCount when there is none
+static uint8_t nextSectionToWrite(const configStorage_t *storage, uint8_t index)
+{
+    while (index < storage->sectionCount && !storage->compacting && !isSectionChanged(storage, index)) {
+        index++;
+    }
+    return index;
+}
+
+static void completeSave(configStorage_t *storage)
+{
+    uint8_t index;
+
+    for (index = 0; index < storage->sectionCount; index++) {
+        if (storage->written[index]) {
+            storage->stored[index] = storage->written[index];
+        }
+    }
+
+    storage->endOffset = storage->recordOffset;
+    storage->data = NULL;
+    storage->state = CONFIG_STORAGE_IDLE;
+}
+
+static void beginSave(configStorage_t *storage)
+{
+    uint32_t appendSize = 0;
+    uint8_t index;
+
+    memset(storage->written, 0, sizeof(storage->written));
+    storage->dataOffset = 0;
+
+    storage->compacting = false;
+    if (storage->appendable) {
+        for (index = 0; index < storage->sectionCount; index++) {
+            if (isSectionChanged(storage, index)) {
+                appendSize += recordSize(sectionSize(storage, index));
+            }
+        }
+        storage->compacting = storage->endOffset + appendSize > storage->slotSize;
+    } else {
+        storage->compacting = true;
+    }
+
+    if (!storage->compacting) {
+        storage->recordOffset = storage->endOffset;
+        storage->sectionIndex = nextSectionToWrite(storage, 0);
+        if (storage->sectionIndex == storage->sectionCount) {
+            completeSave(storage);      // nothing changed
+        } else {
+            storage->state = CONFIG_STORAGE_WRITING;
+        }
+        return;
+    }
+
+    storage->recordOffset = CONFIG_STORAGE_HEADER_SIZE;
+    storage->sectionIndex = 0;
+    if (storage->spareErased) {
+        storage->state = CONFIG_STORAGE_WRITING;
+    } else {
+        if (storage->state != CONFIG_STORAGE_ERASING) {
+            storage->eraseOffset = 0;
+        }
+        storage->state = CONFIG_STORAGE_ERASING;
+    }
+}
+
+// the slot written to may hold part of a record, it is not used again before it is erased
+static void restartSave(configStorage_t *storage)
+{
+    if (storage->compacting) {
+        storage->spareErased = false;
+        storage->eraseOffset = 0;
+    } else {
+        storage->appendable = false;
+    }
+
+    if (storage->attemptsRemaining == 0) {
+        storage->state = CONFIG_STORAGE_FAILED;
+        return;
+    }
+
+    storage->attemptsRemaining--;
+    beginSave(storage);
+}
+
+/*
+ * Starts to save the sections of data that differ from the stored ones, a save that is in progress starts over.
+ * data is read until the save is complete, changes to a section are noticed when its record was written.
+ */
+void configStorageStartSave(configStorage_t *storage, const void *data)
+{
+    storage->data = (const uint8_t *)data;
+    storage->attemptsRemaining = CONFIG_STORAGE_WRITE_ATTEMPTS;
+
+    beginSave(storage);
+}
+
+static void unlockFlash(void)
+{
+    FLASH_Unlock();
+#ifdef STM32F303
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
+#endif
+#ifdef STM32F10X
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+#endif
+}
+
+static bool programWord(uintptr_t address, uint32_t word)
+{
+    FLASH_Status status;
+
+    unlockFlash();
+    status = FLASH_ProgramWord(address, word);
+    FLASH_Lock();
+
+    return status == FLASH_COMPLETE && *(const uint32_t *)address == word;
+}
+
+static void eraseStep(configStorage_t *storage)
+{
+    FLASH_Status status;
+
+    unlockFlash();
+    status = FLASH_ErasePage(slotAddress(storage, spareSlot(storage)) + storage->eraseOffset);
+    FLASH_Lock();
+
+    if (status != FLASH_COMPLETE) {
+        if (storage->data) {
+            restartSave(storage);
+        } else {
+            storage->state = CONFIG_STORAGE_FAILED;
+        }
+        return;
+    }
+
+    storage->eraseOffset += storage->pageSize;
+    if (storage->eraseOffset < storage->slotSize) {
+        return;
+    }
+
+    storage->spareErased = true;
+    storage->state = storage->data ? CONFIG_STORAGE_WRITING : CONFIG_STORAGE_IDLE;
+}
+
+// the layout word and then the commit word make the spare slot the active one
+static void commitCompactedSlot(configStorage_t *storage)
+{
+    uint8_t slot = spareSlot(storage);
+    uint16_t sequence = storage->activeSlot < 0 ? 1 : storage->sequence + 1;
+
+    if (sequence == 0) {
+        sequence = 1;
+    }
+
+    if (!programWord(slotAddress(storage, slot) + LAYOUT_WORD_OFFSET, storage->layout)
+            || !programWord(slotAddress(storage, slot) + COMMIT_WORD_OFFSET, commitWord(sequence))) {
+        restartSave(storage);
+        return;
+    }
+
+    storage->activeSlot = slot;
+    storage->sequence = sequence;
+    storage->appendable = true;
+    storage->spareErased = false;
+    memset(storage->stored, 0, sizeof(storage->stored));
+    completeSave(storage);
+}
+
+static void writeStep(configStorage_t *storage)
+{
+    uint8_t index = storage->sectionIndex;
+    const uint8_t *section = storage->data + storage->sections[index].offset;
+    uint16_t size = sectionSize(storage, index);
+    uintptr_t record = targetAddress(storage) + storage->recordOffset;
+    const uint8_t *recordData = (const uint8_t *)(record + CONFIG_STORAGE_RECORD_HEADER_SIZE);
+    uint32_t header;
+    uint8_t next;
+
+    if (storage->dataOffset == 0 && storage->recordOffset + recordSize(size) > storage->slotSize) {
+        if (storage->compacting) {
+            storage->state = CONFIG_STORAGE_FAILED;     // the slots are too small for the config
+            return;
+        }
+
+        // sections changed since the save started and no longer fit, the records written so far are dropped
+        storage->appendable = false;
+        beginSave(storage);
+        return;
+    }
+
+    if (storage->dataOffset < size) {
+        uint32_t word = 0xFFFFFFFF;
+
+        memcpy(&word, section + storage->dataOffset, min(size - storage->dataOffset, sizeof(word)));
+        if (!programWord((uintptr_t)recordData + storage->dataOffset, word)) {
+            restartSave(storage);
+            return;
+        }
+        storage->dataOffset += sizeof(word);
+        return;
+    }
+
+    // a mismatch is a section that changed while it was written
+    if (memcmp(recordData, section, size) != 0) {
+        restartSave(storage);
+        return;
+    }
+
+    next = nextSectionToWrite(storage, index + 1);
+    header = recordHeader(storage->sections[index].id | (next == storage->sectionCount ? RECORD_LAST : 0), size);
+
+    if (!programWord(record + RECORD_CRC_OFFSET, recordCrc(header, recordData, size)) || !programWord(record, header)) {
+        restartSave(storage);
+        return;
+    }
+
+    storage->written[index] = recordData;
+    storage->recordOffset += recordSize(size);
+    storage->sectionIndex = next;
+    storage->dataOffset = 0;
+
+    if (next < storage->sectionCount) {
+        return;
+    }
+
+    if (storage->compacting) {
+        commitCompactedSlot(storage);
+    } else {
+        completeSave(storage);
+    }
+}
+
+/*
+ * Does one step of the save or of erasing the spare slot after a compacting save, returns the state after the step.
+ * A step erases one page or programs a word, the step that completes a record also verifies it and programs its CRC
+ * and header words. Erasing a page stalls the cpu for many milliseconds, it waits while eraseAllowed is false.
+ */
+configStorageState_e configStorageProcess(configStorage_t *storage, bool eraseAllowed)
+{
+    switch (storage->state) {
+        case CONFIG_STORAGE_IDLE:
+            if (storage->spareErased || !eraseAllowed) {
+                break;
+            }
+            storage->eraseOffset = 0;
+            storage->state = CONFIG_STORAGE_ERASING;
+            eraseStep(storage);
+            break;
+
+        case CONFIG_STORAGE_ERASING:
+            if (eraseAllowed) {
+                eraseStep(storage);
+            }
+            break;
+
+        case CONFIG_STORAGE_WRITING:
+            writeStep(storage);
+            break;
+
+        case CONFIG_STORAGE_FAILED:
+            break;
+    }
+
+    return storage->state;
+}
+
+// true from configStorageStartSave() until the save is complete or failed
+bool configStorageIsSaving(const configStorage_t *storage)
+{
+    return storage->data && storage->state != CONFIG_STORAGE_FAILED;
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * The config is stored as a log of records in one of two slots of flash. A record holds one section of the config,
+ * a save appends records for the sections that changed since they were last stored, so most saves erase nothing.
+ * When the log is full the newest copy of every section is written into the other slot, which then becomes the
+ * active one. The slot that is not in use is erased in the background.
+ *
+ * Slot:   commit word, layout word, records...
+ * Record: header word, CRC word, section data padded to a whole word
+ *
+ * The commit word holds a 16 bit sequence number in the low half and its complement in the high half, it is
+ * programmed after the records and the layout word of a compacted slot. The slot with the newest valid commit word is
+ * the active one. A slot written for another config layout holds no sections.
+ *
+ * The header of a record holds the section id, a flag for the last record of a save and the size of the data. The
+ * CRC word holds a CRC-32 of the header and the data, computed by the CRC unit of the STM32 where there is one, see
+ * crc32Stm32(). Both are programmed after the data, records of a save are only used once the last one is complete,
+ * so a power loss never leaves a mix of old and new sections. A section whose records are all damaged is missing
+ * from the log, the other sections are still loaded.
+ *
+ * A save is split into steps that each erase one page or program a word, see configStorageProcess().
+ */
+
+#define CONFIG_STORAGE_SLOT_COUNT 2
+#define CONFIG_STORAGE_HEADER_SIZE 8            // commit and layout word
+#define CONFIG_STORAGE_RECORD_HEADER_SIZE 8     // header and CRC word
+#define CONFIG_STORAGE_MAX_SECTIONS 16
+
+// the size of the log when it holds every section once, the slots should have room for more records to save erases
+#define CONFIG_STORAGE_COMPACTED_SIZE(size, sectionCount) \
+    (CONFIG_STORAGE_HEADER_SIZE + (size) + (sectionCount) * (CONFIG_STORAGE_RECORD_HEADER_SIZE + 3))
+
+typedef struct configStorageSection_s {
+    uint8_t id;                 // stored in the records, must not change between firmware versions
+    uint16_t offset;            // in the config, the section ends where the next one starts
+} configStorageSection_t;
+
+typedef enum {
+    CONFIG_STORAGE_IDLE,
+    CONFIG_STORAGE_ERASING,     // erasing the spare slot, before a compacting save or after one
+    CONFIG_STORAGE_WRITING,     // programming records
+    CONFIG_STORAGE_FAILED       // the flash could not be programmed
+} configStorageState_e;
+
+typedef struct configStorage_s {
+    uintptr_t address;          // first slot, the second follows it
+    uint32_t slotSize;          // a multiple of the page size
+    uint16_t pageSize;
+    uint32_t layout;            // identifies the config format, slots of another layout are not used
+    const configStorageSection_t *sections;
+    uint8_t sectionCount;
+    uint16_t size;              // of the config
+
+    int8_t activeSlot;          // -1 when no slot holds a committed log
+    uint16_t sequence;          // of the active slot
+    uint32_t endOffset;         // where the next record is appended to the active slot
+    bool appendable;            // false when the end of the log is damaged or the slot is of another layout
+    const uint8_t *stored[CONFIG_STORAGE_MAX_SECTIONS];     // data of the newest record of each section
+
+    configStorageState_e state;
+    bool spareErased;
+    uint32_t eraseOffset;       // next page of the spare slot to erase
+    uint8_t attemptsRemaining;
+
+    // the save in progress
+    const uint8_t *data;
+    bool compacting;            // writing every section into the spare slot
+    uint8_t sectionIndex;       // of the record being written
+    uint32_t recordOffset;      // in the slot written to
+    uint32_t dataOffset;        // next byte of the section to program
+    const uint8_t *written[CONFIG_STORAGE_MAX_SECTIONS];    // replace stored once the save is complete
+} configStorage_t;
+
+void configStorageInit(configStorage_t *storage, uintptr_t address, uint32_t slotSize, uint16_t pageSize,
+        uint32_t layout, const configStorageSection_t *sections, uint8_t sectionCount, uint16_t size);
+uint8_t configStorageStoredSectionCount(const configStorage_t *storage);
+void configStorageLoad(const configStorage_t *storage, void *data);
+
+void configStorageStartSave(configStorage_t *storage, const void *data);
+configStorageState_e configStorageProcess(configStorage_t *storage, bool eraseAllowed);
+bool configStorageIsSaving(const configStorage_t *storage);
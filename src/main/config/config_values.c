@@ -0,0 +1,363 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/color.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/serial.h"
+#include "drivers/pwm_rx.h"
+#include "flight/flight.h"
+#include "flight/mixer.h"
+#include "flight/navigation.h"
+#include "flight/failsafe.h"
+#include "rx/rx.h"
+#include "io/escservo.h"
+#include "io/gps.h"
+#include "io/gimbal.h"
+#include "io/rc_controls.h"
+#include "io/serial.h"
+#include "io/ledstrip.h"
+#include "sensors/battery.h"
+#include "sensors/boardalignment.h"
+#include "sensors/sensors.h"
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+#include "sensors/barometer.h"
+#include "flight/imu.h"
+#include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "config/config_values.h"
+
+// the settings of the CLI and the binary config dump, new values get the next free id
+const configValue_t configValues[] = {
+    { "looptime",                     1, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, looptime), 0, 9000 },
+    { "gyro_sync",                    2, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gyro_sync), 0, 1 },
+    { "gyro_sync_denom",              3, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gyro_sync_denom), 1, 32 },
+    { "pid_process_denom",            4, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, pid_process_denom), 1, 16 },
+    { "emf_avoidance",                5, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, emf_avoidance), 0, 1 },
+
+    { "mid_rc",                       6, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, rxConfig.midrc), 1200, 1700 },
+    { "min_check",                    7, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, rxConfig.mincheck), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+    { "max_check",                    8, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, rxConfig.maxcheck), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+    { "rssi_channel",                 9, VAR_INT8   | MASTER_VALUE,  offsetof(master_t, rxConfig.rssi_channel), 0, MAX_SUPPORTED_RC_CHANNEL_COUNT },
+    { "input_filtering_mode",        10, VAR_INT8   | MASTER_VALUE,  offsetof(master_t, inputFilteringMode), 0, 1 },
+
+    { "min_throttle",                11, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, escAndServoConfig.minthrottle), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+    { "max_throttle",                12, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, escAndServoConfig.maxthrottle), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+    { "min_command",                 13, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, escAndServoConfig.mincommand), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+
+    { "3d_deadband_low",             14, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, flight3DConfig.deadband3d_low), PWM_RANGE_ZERO, PWM_RANGE_MAX }, // FIXME upper limit should match code in the mixer, 1500 currently
+    { "3d_deadband_high",            15, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, flight3DConfig.deadband3d_high), PWM_RANGE_ZERO, PWM_RANGE_MAX }, // FIXME lower limit should match code in the mixer, 1500 currently,
+    { "3d_neutral",                  16, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, flight3DConfig.neutral3d), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+    { "3d_deadband_throttle",        17, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, flight3DConfig.deadband3d_throttle), PWM_RANGE_ZERO, PWM_RANGE_MAX },
+
+    { "motor_pwm_rate",              18, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, motor_pwm_rate), 50, 32000 },
+    { "dshot_rate",                 152, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, dshot_rate), 150, 1200 },
+    { "servo_pwm_rate",              19, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, servo_pwm_rate), 50, 498 },
+
+    { "retarded_arm",                20, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, retarded_arm), 0, 1 },
+    { "disarm_kill_switch",          21, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, disarm_kill_switch), 0, 1 },
+    { "small_angle",                 22, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, small_angle), 0, 180 },
+
+    { "flaps_speed",                 23, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, airplaneConfig.flaps_speed), 0, 100 },
+
+    { "fixedwing_althold_dir",       24, VAR_INT8   | MASTER_VALUE,  offsetof(master_t, fixedwing_althold_dir), -1, 1 },
+
+    { "serial_port_1_scenario",      25, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.serial_port_scenario[0]), 0, SERIAL_PORT_SCENARIO_MAX },
+    { "serial_port_2_scenario",      26, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.serial_port_scenario[1]), 0, SERIAL_PORT_SCENARIO_MAX },
+#if (SERIAL_PORT_COUNT > 2)
+    { "serial_port_3_scenario",      27, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.serial_port_scenario[2]), 0, SERIAL_PORT_SCENARIO_MAX },
+    { "serial_port_4_scenario",      28, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.serial_port_scenario[3]), 0, SERIAL_PORT_SCENARIO_MAX },
+#if (SERIAL_PORT_COUNT > 4)
+    { "serial_port_5_scenario",      29, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.serial_port_scenario[4]), 0, SERIAL_PORT_SCENARIO_MAX },
+#endif
+#endif
+
+    { "reboot_character",            30, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, serialConfig.reboot_character), 48, 126 },
+    { "msp_baudrate",                31, VAR_UINT32 | MASTER_VALUE,  offsetof(master_t, serialConfig.msp_baudrate), 1200, 115200 },
+    { "cli_baudrate",                32, VAR_UINT32 | MASTER_VALUE,  offsetof(master_t, serialConfig.cli_baudrate), 1200, 115200 },
+
+#ifdef GPS
+    { "gps_baudrate",                33, VAR_UINT32 | MASTER_VALUE,  offsetof(master_t, serialConfig.gps_baudrate), 0, 115200 },
+    { "gps_passthrough_baudrate",    34, VAR_UINT32 | MASTER_VALUE,  offsetof(master_t, serialConfig.gps_passthrough_baudrate), 1200, 115200 },
+
+    { "gps_provider",                35, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gpsConfig.provider), 0, GPS_PROVIDER_MAX },
+    { "gps_sbas_mode",               36, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gpsConfig.sbasMode), 0, SBAS_MODE_MAX },
+    { "gps_auto_config",             37, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gpsConfig.gpsAutoConfig), 0, GPS_AUTOCONFIG_OFF },
+
+
+    { "gps_pos_p",                   38, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDPOS]), 0, 200 },
+    { "gps_pos_i",                   39, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDPOS]), 0, 200 },
+    { "gps_pos_d",                   40, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDPOS]), 0, 200 },
+    { "gps_posr_p",                  41, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDPOSR]), 0, 200 },
+    { "gps_posr_i",                  42, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDPOSR]), 0, 200 },
+    { "gps_posr_d",                  43, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDPOSR]), 0, 200 },
+    { "gps_nav_p",                   44, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDNAVR]), 0, 200 },
+    { "gps_nav_i",                   45, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDNAVR]), 0, 200 },
+    { "gps_nav_d",                   46, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDNAVR]), 0, 200 },
+    { "gps_wp_radius",               47, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].gpsProfile.gps_wp_radius), 0, 2000 },
+    { "nav_controls_heading",        48, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].gpsProfile.nav_controls_heading), 0, 1 },
+    { "nav_speed_min",               49, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].gpsProfile.nav_speed_min), 10, 2000 },
+    { "nav_speed_max",               50, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].gpsProfile.nav_speed_max), 10, 2000 },
+    { "nav_slew_rate",               51, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].gpsProfile.nav_slew_rate), 0, 100 },
+#endif
+
+    { "serialrx_provider",           52, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, rxConfig.serialrx_provider), 0, SERIALRX_PROVIDER_MAX },
+
+    { "telemetry_provider",          53, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.telemetry_provider), 0, TELEMETRY_PROVIDER_MAX },
+    { "telemetry_switch",            54, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.telemetry_switch), 0, 1 },
+    { "frsky_inversion",             55, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.frsky_inversion), 0, 1 },
+    { "frsky_default_lattitude",     56, VAR_FLOAT  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.gpsNoFixLatitude), -90, 90 },
+    { "frsky_default_longitude",     57, VAR_FLOAT  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.gpsNoFixLongitude), -180, 180 },
+    { "frsky_coordinates_format",    58, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.frsky_coordinate_format), 0, FRSKY_FORMAT_NMEA },
+    { "frsky_unit",                  59, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, telemetryConfig.frsky_unit), 0, FRSKY_UNIT_IMPERIALS },
+    { "frsky_battery_size",          60, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, telemetryConfig.batterySize), 0, 20000 },
+
+    { "blackbox_rate_denom",         61, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, blackbox_rate_denom), 1, BLACKBOX_RATE_DENOM_MAX },
+
+    { "vbat_scale",                  62, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, batteryConfig.vbatscale), VBAT_SCALE_MIN, VBAT_SCALE_MAX },
+    { "vbat_max_cell_voltage",       63, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, batteryConfig.vbatmaxcellvoltage), 10, 50 },
+    { "vbat_min_cell_voltage",       64, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, batteryConfig.vbatmincellvoltage), 10, 50 },
+    { "current_meter_scale",         65, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, batteryConfig.currentMeterScale), 1, 10000 },
+    { "current_meter_offset",        66, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, batteryConfig.currentMeterOffset), 0, 1650 },
+    { "multiwii_current_meter_output",  67, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, batteryConfig.multiwiiCurrentMeterOutput), 0, 1 },
+
+
+    { "align_gyro",                  68, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, sensorAlignmentConfig.gyro_align), 0, 8 },
+    { "align_acc",                   69, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, sensorAlignmentConfig.acc_align), 0, 8 },
+    { "align_mag",                   70, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, sensorAlignmentConfig.mag_align), 0, 8 },
+
+    { "align_board_roll",            71, VAR_INT16  | MASTER_VALUE,  offsetof(master_t, boardAlignment.rollDegrees), -180, 360 },
+    { "align_board_pitch",           72, VAR_INT16  | MASTER_VALUE,  offsetof(master_t, boardAlignment.pitchDegrees), -180, 360 },
+    { "align_board_yaw",             73, VAR_INT16  | MASTER_VALUE,  offsetof(master_t, boardAlignment.yawDegrees), -180, 360 },
+
+    { "max_angle_inclination",       74, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, max_angle_inclination), 100, 900 },
+
+    { "gyro_lpf",                    75, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyro_lpf), 0, 256 },
+    { "moron_threshold",             76, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, gyroConfig.gyroMovementCalibrationThreshold), 0, 128 },
+    { "gyro_soft_lpf_hz",            77, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyroConfig.soft_gyro_lpf_hz), 0, 500 },
+    { "gyro_notch_hz",               78, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyroConfig.soft_gyro_notch_hz), 0, 500 },
+    { "gyro_notch_cutoff_hz",        79, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyroConfig.soft_gyro_notch_cutoff_hz), 0, 500 },
+    { "gyro_cmpf_factor",            80, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyro_cmpf_factor), 100, 1000 },
+    { "gyro_cmpfm_factor",           81, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, gyro_cmpfm_factor), 100, 1000 },
+    { "attitude_estimator",          82, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, attitude_estimator), 0, ATTITUDE_ESTIMATOR_COUNT - 1 },
+    { "dcm_kp",                      83, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, dcm_kp), 0, 20000 },
+    { "dcm_ki",                      84, VAR_UINT16 | MASTER_VALUE,  offsetof(master_t, dcm_ki), 0, 20000 },
+
+    { "alt_hold_deadband",           85, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].alt_hold_deadband), 1, 250 },
+    { "alt_hold_fast_change",        86, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].alt_hold_fast_change), 0, 1 },
+
+    { "throttle_correction_value",   87, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].throttle_correction_value), 0, 150 },
+    { "throttle_correction_angle",   88, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].throttle_correction_angle), 1, 900 },
+
+    { "deadband",                    89, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].deadband), 0, 32 },
+    { "yaw_deadband",                90, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].yaw_deadband), 0, 100 },
+    { "yaw_control_direction",       91, VAR_INT8   | MASTER_VALUE,  offsetof(master_t, yaw_control_direction), -1, 1 },
+
+    { "yaw_direction",               92, VAR_INT8   | PROFILE_VALUE, offsetof(master_t, profile[0].mixerConfig.yaw_direction), -1, 1 },
+    { "tri_unarmed_servo",           93, VAR_INT8   | PROFILE_VALUE, offsetof(master_t, profile[0].mixerConfig.tri_unarmed_servo), 0, 1 },
+
+    { "rc_rate",                     94, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.rcRate8), 0, 250 },
+    { "rc_expo",                     95, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.rcExpo8), 0, 100 },
+    { "thr_mid",                     96, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.thrMid8), 0, 100 },
+    { "thr_expo",                    97, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.thrExpo8), 0, 100 },
+    { "roll_pitch_rate",             98, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.rollPitchRate), 0, 100 },
+    { "yaw_rate",                    99, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].controlRateConfig.yawRate), 0, 100 },
+    { "tpa_rate",                   100, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].dynThrPID), 0, 100},
+    { "tpa_breakpoint",             101, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].tpa_breakpoint), PWM_RANGE_MIN, PWM_RANGE_MAX},
+
+    { "failsafe_delay",             102, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].failsafeConfig.failsafe_delay), 0, 200 },
+    { "failsafe_off_delay",         103, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].failsafeConfig.failsafe_off_delay), 0, 200 },
+    { "failsafe_throttle",          104, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].failsafeConfig.failsafe_throttle), PWM_RANGE_MIN, PWM_RANGE_MAX },
+    { "failsafe_min_usec",          105, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].failsafeConfig.failsafe_min_usec), 100, PWM_RANGE_MAX },
+    { "failsafe_max_usec",          106, VAR_UINT16 | PROFILE_VALUE, offsetof(master_t, profile[0].failsafeConfig.failsafe_max_usec), 100, PWM_RANGE_MAX + (PWM_RANGE_MAX - PWM_RANGE_MIN) },
+
+    { "gimbal_flags",               107, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].gimbalConfig.gimbal_flags), 0, 255},
+
+    { "acc_hardware",               108, VAR_UINT8  | MASTER_VALUE,  offsetof(master_t, acc_hardware), 0, 5 },
+    { "acc_lpf_hz",                 109, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].acc_lpf_hz), 0, 250 },
+    { "accxy_deadband",             110, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].accDeadband.xy), 0, 100 },
+    { "accz_deadband",              111, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].accDeadband.z), 0, 100 },
+    { "accz_lpf_cutoff",            112, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].accz_lpf_cutoff), 1, 20 },
+    { "acc_unarmedcal",             113, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].acc_unarmedcal), 0, 1 },
+    { "acc_trim_pitch",             114, VAR_INT16  | PROFILE_VALUE, offsetof(master_t, profile[0].accelerometerTrims.values.pitch), -300, 300 },
+    { "acc_trim_roll",              115, VAR_INT16  | PROFILE_VALUE, offsetof(master_t, profile[0].accelerometerTrims.values.roll), -300, 300 },
+
+    { "baro_tab_size",              116, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].barometerConfig.baro_sample_count), 0, BARO_SAMPLE_COUNT_MAX },
+    { "baro_noise_lpf",             117, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].barometerConfig.baro_noise_lpf), 0, 1 },
+    { "baro_cf_vel",                118, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].barometerConfig.baro_cf_vel), 0, 1 },
+    { "baro_cf_alt",                119, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].barometerConfig.baro_cf_alt), 0, 1 },
+
+    { "mag_declination",            120, VAR_INT16  | PROFILE_VALUE, offsetof(master_t, profile[0].mag_declination), -18000, 18000 },
+
+    { "pid_controller",             121, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidController), 0, 2 },
+
+    { "p_pitch",                    122, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PITCH]), 0, 200 },
+    { "i_pitch",                    123, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PITCH]), 0, 200 },
+    { "d_pitch",                    124, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PITCH]), 0, 200 },
+    { "p_roll",                     125, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[ROLL]), 0, 200 },
+    { "i_roll",                     126, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[ROLL]), 0, 200 },
+    { "d_roll",                     127, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[ROLL]), 0, 200 },
+    { "p_yaw",                      128, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[YAW]), 0, 200 },
+    { "i_yaw",                      129, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[YAW]), 0, 200 },
+    { "d_yaw",                      130, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[YAW]), 0, 200 },
+
+    { "p_pitchf",                   131, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P_f[PITCH]), 0, 100 },
+    { "i_pitchf",                   132, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I_f[PITCH]), 0, 100 },
+    { "d_pitchf",                   133, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D_f[PITCH]), 0, 100 },
+    { "p_rollf",                    134, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P_f[ROLL]), 0, 100 },
+    { "i_rollf",                    135, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I_f[ROLL]), 0, 100 },
+    { "d_rollf",                    136, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D_f[ROLL]), 0, 100 },
+    { "p_yawf",                     137, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P_f[YAW]), 0, 100 },
+    { "i_yawf",                     138, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I_f[YAW]), 0, 100 },
+    { "d_yawf",                     139, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D_f[YAW]), 0, 100 },
+
+    { "dterm_lpf_hz",               140, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.dterm_lpf_hz), 0, 250 },
+
+    { "level_horizon",              141, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.H_level), 0, 10 },
+    { "level_angle",                142, VAR_FLOAT  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.A_level), 0, 10 },
+
+    { "p_alt",                      143, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDALT]), 0, 200 },
+    { "i_alt",                      144, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDALT]), 0, 200 },
+    { "d_alt",                      145, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDALT]), 0, 200 },
+
+    { "p_level",                    146, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDLEVEL]), 0, 200 },
+    { "i_level",                    147, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDLEVEL]), 0, 200 },
+    { "d_level",                    148, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDLEVEL]), 0, 200 },
+
+    { "p_vel",                      149, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.P8[PIDVEL]), 0, 200 },
+    { "i_vel",                      150, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.I8[PIDVEL]), 0, 200 },
+    { "d_vel",                      151, VAR_UINT8  | PROFILE_VALUE, offsetof(master_t, profile[0].pidProfile.D8[PIDVEL]), 0, 200 },
+};
+
+const uint16_t configValueCount = sizeof(configValues) / sizeof(configValue_t);
+
+const configValue_t *findConfigValueById(uint16_t id)
+{
+    uint16_t i;
+
+    for (i = 0; i < configValueCount; i++) {
+        if (configValues[i].id == id) {
+            return &configValues[i];
+        }
+    }
+    return NULL;
+}
+
+const configValue_t *findConfigValueByName(const char *name)
+{
+    uint16_t i;
+
+    for (i = 0; i < configValueCount; i++) {
+        if (strcasecmp(configValues[i].name, name) == 0) {
+            return &configValues[i];
+        }
+    }
+    return NULL;
+}
+
+void *configValuePointer(master_t *config, const configValue_t *value, uint8_t profileIndex)
+{
+    uint8_t *ptr = (uint8_t *)config + value->offset;
+
+    if (value->type & PROFILE_VALUE) {
+        ptr += sizeof(profile_t) * profileIndex;
+    }
+    return ptr;
+}
+
+int_float_value_t configValueGet(const master_t *config, const configValue_t *value, uint8_t profileIndex)
+{
+    int_float_value_t result;
+    const void *ptr = configValuePointer((master_t *)config, value, profileIndex);
+
+    switch (value->type & VALUE_TYPE_MASK) {
+        case VAR_UINT8:
+            result.int_value = *(uint8_t *)ptr;
+            break;
+
+        case VAR_INT8:
+            result.int_value = *(int8_t *)ptr;
+            break;
+
+        case VAR_UINT16:
+            result.int_value = *(uint16_t *)ptr;
+            break;
+
+        case VAR_INT16:
+            result.int_value = *(int16_t *)ptr;
+            break;
+
+        case VAR_UINT32:
+            result.int_value = *(uint32_t *)ptr;
+            break;
+
+        case VAR_FLOAT:
+        default:
+            result.float_value = *(float *)ptr;
+            break;
+    }
+    return result;
+}
+
+void configValueSet(master_t *config, const configValue_t *value, uint8_t profileIndex, int_float_value_t newValue)
+{
+    void *ptr = configValuePointer(config, value, profileIndex);
+
+    switch (value->type & VALUE_TYPE_MASK) {
+        case VAR_UINT8:
+        case VAR_INT8:
+            *(char *)ptr = (char)newValue.int_value;
+            break;
+
+        case VAR_UINT16:
+        case VAR_INT16:
+            *(short *)ptr = (short)newValue.int_value;
+            break;
+
+        case VAR_UINT32:
+            *(int *)ptr = (int)newValue.int_value;
+            break;
+
+        case VAR_FLOAT:
+            *(float *)ptr = (float)newValue.float_value;
+            break;
+    }
+}
+
+bool isConfigValueInRange(const configValue_t *value, int_float_value_t newValue)
+{
+    if (value->type & VAR_FLOAT) {
+        return newValue.float_value >= value->min && newValue.float_value <= value->max;
+    }
+    return newValue.int_value >= value->min && newValue.int_value <= value->max;
+}
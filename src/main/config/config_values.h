@@ -0,0 +1,58 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+typedef enum {
+    VAR_UINT8 = (1 << 0),
+    VAR_INT8 = (1 << 1),
+    VAR_UINT16 = (1 << 2),
+    VAR_INT16 = (1 << 3),
+    VAR_UINT32 = (1 << 4),
+    VAR_FLOAT = (1 << 5),
+
+    MASTER_VALUE = (1 << 6),
+    PROFILE_VALUE = (1 << 7)
+} configValueFlag_e;
+
+#define VALUE_TYPE_MASK (VAR_UINT8 | VAR_INT8 | VAR_UINT16 | VAR_INT16 | VAR_UINT32 | VAR_FLOAT)
+#define SECTION_MASK (MASTER_VALUE | PROFILE_VALUE)
+
+typedef struct configValue_s {
+    const char *name;
+    const uint16_t id;          // identifies the value in binary dumps, must not change or be reused for another value
+    const uint8_t type;         // configValueFlag_e - specify one of each from VALUE_TYPE_MASK and SECTION_MASK
+    const uint16_t offset;      // in master_t, in the first profile for profile values
+    const int32_t min;
+    const int32_t max;
+} configValue_t;
+
+typedef union {
+    int32_t int_value;
+    float float_value;
+} int_float_value_t;
+
+extern const configValue_t configValues[];
+extern const uint16_t configValueCount;
+
+const configValue_t *findConfigValueById(uint16_t id);
+const configValue_t *findConfigValueByName(const char *name);
+
+void *configValuePointer(master_t *config, const configValue_t *value, uint8_t profileIndex);
+int_float_value_t configValueGet(const master_t *config, const configValue_t *value, uint8_t profileIndex);
+void configValueSet(master_t *config, const configValue_t *value, uint8_t profileIndex, int_float_value_t newValue);
+bool isConfigValueInRange(const configValue_t *value, int_float_value_t newValue);
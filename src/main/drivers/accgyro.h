@@ -27,6 +27,7 @@ typedef struct gyro_s {
     sensorReadFuncPtr read;                                 // read 3 axis data function
     sensorReadFuncPtr temperature;                          // read temperature if available
     float scale;                                            // scalefactor
+    uint32_t samplePeriod;                                  // time between new samples in us, 0 if not known
 } gyro_t;
 
 typedef struct acc_s {
@@ -26,6 +26,7 @@
 #include "system.h"
 #include "gpio.h"
 #include "bus_i2c.h"
+#include "bus_i2c_queue.h"
 
 #include "accgyro.h"
 #include "accgyro_mpu6050.h"
@@ -174,6 +175,22 @@ static mpu6050Resolution_e mpuAccelTrim;
 
 static const mpu6050Config_t *mpu6050Config = NULL;
 
+/*
+ * Accel, temperature and gyro are read by one burst from MPU_RA_ACCEL_XOUT_H.  Each gyro read starts a burst and waits
+ * for it, so the loop always runs on the sample the read fetched.  The accel read uses the accel values of the same
+ * burst.
+ */
+#define MPU6050_BURST_LENGTH 14
+#define MPU6050_BURST_GYRO_OFFSET 8
+
+static uint8_t burstBuffer[MPU6050_BURST_LENGTH];
+static i2cTransfer_t burstTransfer = { MPU6050_ADDRESS, MPU_RA_ACCEL_XOUT_H, MPU6050_BURST_LENGTH, burstBuffer, I2C_TRANSFER_IDLE, 0 };
+
+// last sample read successfully, kept when a burst fails
+static int16_t burstAccel[3];
+static int16_t burstGyro[3];
+static bool burstSampleValid = false;
+
 void mpu6050GpioInit(void) {
     gpio_config_t gpio;
 
@@ -270,6 +287,9 @@ bool mpu6050GyroDetect(const mpu6050Config_t *configToUse, gyro_t *gyro, uint16_
     // 16.4 dps/lsb scalefactor
     gyro->scale = 1.0f / 16.4f;
 
+    // 1kHz, the DLPF is always enabled
+    gyro->samplePeriod = 1000;
+
     if (lpf >= 188)
         mpuLowPassFilter = INV_FILTER_188HZ;
     else if (lpf >= 98)
@@ -303,14 +323,35 @@ static void mpu6050AccInit(void)
     }
 }
 
+static void mpu6050DecodeBurst(void)
+{
+    uint8_t *buf = burstBuffer;
+    uint8_t axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        burstAccel[axis] = (int16_t)((buf[axis * 2] << 8) | buf[axis * 2 + 1]);
+        burstGyro[axis] = (int16_t)((buf[MPU6050_BURST_GYRO_OFFSET + axis * 2] << 8) | buf[MPU6050_BURST_GYRO_OFFSET + axis * 2 + 1]);
+    }
+    burstSampleValid = true;
+}
+
+// reads a burst and waits for it, the last good sample is kept when it fails
+static void mpu6050ReadBurst(void)
+{
+    if (i2cQueueSubmit(&burstTransfer) && i2cQueueWait(&burstTransfer)) {
+        mpu6050DecodeBurst();
+    }
+}
+
 static void mpu6050AccRead(int16_t *accData)
 {
-    uint8_t buf[6];
+    if (!burstSampleValid) {
+        mpu6050ReadBurst();
+    }
 
-    i2cRead(MPU6050_ADDRESS, MPU_RA_ACCEL_XOUT_H, 6, buf);
-    accData[0] = (int16_t)((buf[0] << 8) | buf[1]);
-    accData[1] = (int16_t)((buf[2] << 8) | buf[3]);
-    accData[2] = (int16_t)((buf[4] << 8) | buf[5]);
+    accData[0] = burstAccel[0];
+    accData[1] = burstAccel[1];
+    accData[2] = burstAccel[2];
 }
 
 static void mpu6050GyroInit(void)
@@ -328,6 +369,7 @@ static void mpu6050GyroInit(void)
             0 << 7 | 0 << 6 | 0 << 5 | 0 << 4 | 0 << 3 | 0 << 2 | 1 << 1 | 0 << 0); // INT_PIN_CFG   -- INT_LEVEL_HIGH, INT_OPEN_DIS, LATCH_INT_DIS, INT_RD_CLEAR_DIS, FSYNC_INT_LEVEL_HIGH, FSYNC_INT_DIS, I2C_BYPASS_EN, CLOCK_DIS
     i2cWrite(MPU6050_ADDRESS, MPU_RA_CONFIG, mpuLowPassFilter); //CONFIG        -- EXT_SYNC_SET 0 (disable input pin for data sync) ; default DLPF_CFG = 0 => ACC bandwidth = 260Hz  GYRO bandwidth = 256Hz)
     i2cWrite(MPU6050_ADDRESS, MPU_RA_GYRO_CONFIG, INV_FSR_2000DPS << 3);   //GYRO_CONFIG   -- FS_SEL = 3: Full scale set to 2000 deg/sec
+    i2cWrite(MPU6050_ADDRESS, MPU_RA_INT_ENABLE, 0x01); //INT_ENABLE    -- DATA_RDY_EN, pulse MPU_INT on every new sample
 
     // ACC Init stuff. Moved into gyro init because the reset above would screw up accel config. Oops.
     // Accel scale 8g (4096 LSB/g)
@@ -336,11 +378,9 @@ static void mpu6050GyroInit(void)
 
 static void mpu6050GyroRead(int16_t *gyroData)
 {
-    uint8_t buf[6];
-
-    i2cRead(MPU6050_ADDRESS, MPU_RA_GYRO_XOUT_H, 6, buf);
+    mpu6050ReadBurst();
 
-    gyroData[0] = (int16_t)((buf[0] << 8) | buf[1]);
-    gyroData[1] = (int16_t)((buf[2] << 8) | buf[3]);
-    gyroData[2] = (int16_t)((buf[4] << 8) | buf[5]);
+    gyroData[0] = burstGyro[0];
+    gyroData[1] = burstGyro[1];
+    gyroData[2] = burstGyro[2];
 }
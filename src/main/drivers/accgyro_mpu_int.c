@@ -0,0 +1,90 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "platform.h"
+
+#include "system.h"
+#include "gpio.h"
+
+#include "accgyro_mpu_int.h"
+
+// MPU6050/MPU6000/MPU6500 INT pin, configured by the gyro drivers to pulse on every new sample
+
+static const mpuIntExtiConfig_t *mpuIntExtiConfig = NULL;
+static mpuDataReadyCallbackPtr *mpuDataReadyCallback = NULL;
+
+void mpuIntExtiHandler(void)
+{
+    if (!mpuIntExtiConfig || EXTI_GetITStatus(mpuIntExtiConfig->exti_line) != SET) {
+        return;
+    }
+
+    EXTI_ClearITPendingBit(mpuIntExtiConfig->exti_line);
+    mpuDataReadyCallback(micros());
+}
+
+// the Naze32 MPU INT pin is on EXTI13, that IRQ is shared with the BMP085 and handled in barometer_bmp085.c
+#ifdef CC3D
+void EXTI3_IRQHandler(void)
+{
+    mpuIntExtiHandler();
+}
+#endif
+
+void mpuIntExtiInit(const mpuIntExtiConfig_t *config, mpuDataReadyCallbackPtr *callback)
+{
+    gpio_config_t gpio;
+    EXTI_InitTypeDef EXTIInit;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    if (!config) {
+        return;
+    }
+
+    if (config->gpioAPB2Peripherals) {
+        RCC_APB2PeriphClockCmd(config->gpioAPB2Peripherals, ENABLE);
+    }
+
+    gpio.pin = config->gpioPin;
+    gpio.speed = Speed_2MHz;
+    gpio.mode = Mode_IN_FLOATING;
+    gpioInit(config->gpioPort, &gpio);
+
+    mpuDataReadyCallback = callback;
+    mpuIntExtiConfig = config;
+
+    gpioExtiLineConfig(config->exti_port_source, config->exti_pin_source);
+
+    EXTI_ClearITPendingBit(config->exti_line);
+
+    EXTIInit.EXTI_Line = config->exti_line;
+    EXTIInit.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTIInit.EXTI_Trigger = EXTI_Trigger_Rising;
+    EXTIInit.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTIInit);
+
+    // the handler only takes a timestamp, run it ahead of the low priority interrupts so the timestamp is accurate
+    NVIC_InitStructure.NVIC_IRQChannel = config->exti_irqn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
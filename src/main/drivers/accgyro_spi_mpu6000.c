@@ -238,6 +238,20 @@ void mpu6000AccAndGyroInit() {
     spiTransferByte(MPU6000_SPI_INSTANCE, BITS_FS_2000DPS);
     DISABLE_MPU6000;
 
+    delayMicroseconds(1);
+
+    ENABLE_MPU6000;
+    spiTransferByte(MPU6000_SPI_INSTANCE, MPU6000_INT_PIN_CFG);         // INT pin cleared by any read
+    spiTransferByte(MPU6000_SPI_INSTANCE, BIT_INT_ANYRD_2CLEAR);
+    DISABLE_MPU6000;
+
+    delayMicroseconds(1);
+
+    ENABLE_MPU6000;
+    spiTransferByte(MPU6000_SPI_INSTANCE, MPU6000_INT_ENABLE);          // Data ready interrupt on every new sample
+    spiTransferByte(MPU6000_SPI_INSTANCE, BIT_RAW_RDY_EN);
+    DISABLE_MPU6000;
+
     initDone = true;
 }
 
@@ -320,6 +334,13 @@ bool mpu6000SpiGyroDetect(gyro_t *gyro, uint16_t lpf)
     // 16.4 dps/lsb scalefactor
     gyro->scale = 1.0f / 16.4f;
     //gyro->scale = (4.0f / 16.4f) * (M_PI / 180.0f) * 0.000001f;
+
+    // gyro output rate is 8kHz with the DLPF disabled, 1kHz otherwise
+    if (mpuLowPassFilter == BITS_DLPF_CFG_256HZ || mpuLowPassFilter == BITS_DLPF_CFG_2100HZ_NOLPF) {
+        gyro->samplePeriod = 125;
+    } else {
+        gyro->samplePeriod = 1000;
+    }
     delay(100);
     return true;
 }
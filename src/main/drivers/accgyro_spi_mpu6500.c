@@ -129,6 +129,9 @@ bool mpu6500SpiGyroDetect(gyro_t *gyro, uint16_t lpf)
     gyro->scale = 1.0f / 16.4f;
     //gyro->scale = (4.0f / 16.4f) * (M_PI / 180.0f) * 0.000001f;
 
+    // 1kHz, the DLPF is always enabled
+    gyro->samplePeriod = 1000;
+
     // default lpf is 42Hz
     if (lpf >= 188)
         mpuLowPassFilter = INV_FILTER_188HZ;
@@ -185,6 +188,7 @@ static void mpu6500GyroInit(void)
     mpu6500WriteRegister(MPU6500_RA_ACCEL_CFG, INV_FSR_8G << 3);
     mpu6500WriteRegister(MPU6500_RA_LPF, mpuLowPassFilter);
     mpu6500WriteRegister(MPU6500_RA_RATE_DIV, 0); // 1kHz S/R
+    mpu6500WriteRegister(MPU6500_RA_INT_ENABLE, 0x01); // RAW_RDY_EN, pulse MPU_INT on every new sample
 }
 
 static void mpu6500GyroRead(int16_t *gyroData)
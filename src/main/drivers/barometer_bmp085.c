@@ -30,17 +30,24 @@
 
 #include "barometer_bmp085.h"
 
+#ifdef USE_MPU_DATA_READY_SIGNAL
+#include "accgyro_mpu_int.h"
+#endif
+
 // BMP085, Standard address 0x77
 static bool convDone = false;
 static uint16_t convOverrun = 0;
 
-// EXTI14 for BMP085 End of Conversion Interrupt
+// EXTI14 for BMP085 End of Conversion Interrupt, EXTI13 for the MPU data ready interrupt
 void EXTI15_10_IRQHandler(void)
 {
     if (EXTI_GetITStatus(EXTI_Line14) == SET) {
         EXTI_ClearITPendingBit(EXTI_Line14);
         convDone = true;
     }
+#ifdef USE_MPU_DATA_READY_SIGNAL
+    mpuIntExtiHandler();
+#endif
 }
 
 typedef struct {
@@ -28,3 +28,7 @@ bool i2cWriteBuffer(uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
 bool i2cWrite(uint8_t addr_, uint8_t reg, uint8_t data);
 bool i2cRead(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
 uint16_t i2cGetErrorCounter(void);
+
+// used by the transfer queue, see bus_i2c_queue.h
+bool i2cReadStart(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf);
+void i2cRecover(void);
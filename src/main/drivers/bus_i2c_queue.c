@@ -0,0 +1,149 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Queue of I2C read transfers.  A submitted transfer is handed to the bus driver by i2cReadStart() as soon as the bus
+ * is free and the caller carries on while the bus driver completes it from its interrupt handler, so the CPU is not
+ * spent polling the bus for the duration of the transfer.
+ *
+ * Transfers are submitted and the queue is serviced from the main loop only, the bus driver interrupt only ends the
+ * active transfer.  A failed or timed out transfer makes the queue recover the bus before the next transfer starts.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "system.h"
+
+#include "bus_i2c.h"
+#include "bus_i2c_queue.h"
+
+static i2cTransfer_t *queue[I2C_QUEUE_LENGTH];
+static uint8_t queueHead = 0;
+static uint8_t queueCount = 0;
+
+static i2cTransfer_t * volatile activeTransfer = NULL;
+static volatile bool recoveryPending = false;
+
+void i2cQueueInit(void)
+{
+    queueHead = 0;
+    queueCount = 0;
+    activeTransfer = NULL;
+    recoveryPending = false;
+}
+
+bool i2cTransferIsPending(const i2cTransfer_t *transfer)
+{
+    return transfer->state == I2C_TRANSFER_QUEUED || transfer->state == I2C_TRANSFER_BUSY;
+}
+
+bool i2cQueueIsIdle(void)
+{
+    return !activeTransfer && queueCount == 0;
+}
+
+void i2cQueueTransferComplete(bool success)
+{
+    i2cTransfer_t *transfer = activeTransfer;
+
+    if (!transfer) {
+        return; // completion of a transfer that was already timed out
+    }
+
+    if (!success) {
+        recoveryPending = true;
+    }
+    transfer->state = success ? I2C_TRANSFER_DONE : I2C_TRANSFER_FAILED;
+    activeTransfer = NULL;
+}
+
+static void startNextTransfer(void)
+{
+    i2cTransfer_t *transfer;
+
+    // a bus driver which reads synchronously completes the transfer before i2cReadStart() returns
+    while (!activeTransfer && !recoveryPending && queueCount > 0) {
+        transfer = queue[queueHead];
+        queueHead = (queueHead + 1) % I2C_QUEUE_LENGTH;
+        queueCount--;
+
+        transfer->state = I2C_TRANSFER_BUSY;
+        transfer->startedAt = micros();
+        activeTransfer = transfer;
+
+        if (!i2cReadStart(transfer->address, transfer->reg, transfer->length, transfer->buffer)) {
+            recoveryPending = true;
+            transfer->state = I2C_TRANSFER_FAILED;
+            activeTransfer = NULL;
+        }
+    }
+}
+
+bool i2cQueueSubmit(i2cTransfer_t *transfer)
+{
+    if (i2cTransferIsPending(transfer) || queueCount == I2C_QUEUE_LENGTH) {
+        return false;
+    }
+
+    transfer->state = I2C_TRANSFER_QUEUED;
+    queue[(queueHead + queueCount) % I2C_QUEUE_LENGTH] = transfer;
+    queueCount++;
+
+    startNextTransfer();
+    return true;
+}
+
+void i2cQueueUpdate(void)
+{
+    i2cTransfer_t *transfer = activeTransfer;
+
+    if (transfer && micros() - transfer->startedAt >= I2C_TRANSFER_TIMEOUT) {
+        // recovering reinitialises the bus, the transfer can not complete from the interrupt after this
+        i2cRecover();
+        recoveryPending = false;
+        if (activeTransfer) {
+            activeTransfer->state = I2C_TRANSFER_FAILED;
+            activeTransfer = NULL;
+        }
+    }
+
+    if (recoveryPending) {
+        i2cRecover();
+        recoveryPending = false;
+    }
+
+    startNextTransfer();
+}
+
+// returns true when the transfer completed successfully
+bool i2cQueueWait(i2cTransfer_t *transfer)
+{
+    while (i2cTransferIsPending(transfer)) {
+        i2cQueueUpdate();
+    }
+    return transfer->state == I2C_TRANSFER_DONE;
+}
+
+// used by the blocking bus functions so they do not start while a queued transfer is using the bus
+void i2cQueueWaitIdle(void)
+{
+    while (!i2cQueueIsIdle()) {
+        i2cQueueUpdate();
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define I2C_QUEUE_LENGTH 4
+
+// microseconds, a 14 byte read takes about 0.5ms at 400kHz
+#define I2C_TRANSFER_TIMEOUT 3000
+
+typedef enum {
+    I2C_TRANSFER_IDLE = 0,
+    I2C_TRANSFER_QUEUED,
+    I2C_TRANSFER_BUSY,
+    I2C_TRANSFER_DONE,
+    I2C_TRANSFER_FAILED
+} i2cTransferState_e;
+
+typedef struct i2cTransfer_s {
+    uint8_t address;
+    uint8_t reg;
+    uint8_t length;
+    uint8_t *buffer;
+    volatile i2cTransferState_e state;
+    uint32_t startedAt;
+} i2cTransfer_t;
+
+void i2cQueueInit(void);
+bool i2cQueueSubmit(i2cTransfer_t *transfer);
+void i2cQueueUpdate(void);
+bool i2cQueueWait(i2cTransfer_t *transfer);
+void i2cQueueWaitIdle(void);
+bool i2cQueueIsIdle(void);
+bool i2cTransferIsPending(const i2cTransfer_t *transfer);
+
+// called by the bus driver when the transfer it was given by i2cReadStart() ended, may be called from its interrupt handler
+void i2cQueueTransferComplete(bool success);
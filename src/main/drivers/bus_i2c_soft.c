@@ -24,6 +24,8 @@
 
 #include "gpio.h"
 
+#include "bus_i2c_queue.h"
+
 // Software I2C driver, using same pins as hardware I2C, with hw i2c module disabled.
 // Can be configured for I2C2 pinout (SCL: PB10, SDA: PB11) or I2C1 pinout (SCL: PB6, SDA: PB7)
 
@@ -257,6 +259,17 @@ bool i2cRead(uint8_t addr, uint8_t reg, uint8_t len, uint8_t *buf)
     return true;
 }
 
+bool i2cReadStart(uint8_t addr, uint8_t reg, uint8_t len, uint8_t *buf)
+{
+    i2cQueueTransferComplete(i2cRead(addr, reg, len, buf));
+    return true;
+}
+
+void i2cRecover(void)
+{
+    I2C_Stop();
+}
+
 uint16_t i2cGetErrorCounter(void)
 {
     // TODO maybe fix this, but since this is test code, doesn't matter.
@@ -27,6 +27,7 @@
 #include "system.h"
 
 #include "bus_i2c.h"
+#include "bus_i2c_queue.h"
 
 #ifndef SOFT_I2C
 
@@ -86,6 +87,7 @@ static volatile uint16_t i2cErrorCount = 0;
 
 static volatile bool error = false;
 static volatile bool busy;
+static volatile bool asyncRead = false;
 
 static volatile uint8_t addr;
 static volatile uint8_t reg;
@@ -103,35 +105,28 @@ static bool i2cHandleHardwareFailure(void)
     return false;
 }
 
-bool i2cWriteBuffer(uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data)
+// returns false when the bus is stuck, the job set up in the globals above is then not started
+static bool i2cStartJob(void)
 {
     uint32_t timeout = I2C_DEFAULT_TIMEOUT;
 
-    addr = addr_ << 1;
-    reg = reg_;
-    writing = 1;
-    reading = 0;
-    write_p = data;
-    read_p = data;
-    bytes = len_;
-    busy = 1;
-    error = false;
-
-    if (!I2Cx)
-        return false;
-
     if (!(I2Cx->CR2 & I2C_IT_EVT)) {                                    // if we are restarting the driver
         if (!(I2Cx->CR1 & 0x0100)) {                                    // ensure sending a start
             while (I2Cx->CR1 & 0x0200 && --timeout > 0) { ; }           // wait for any stop to finish sending
             if (timeout == 0) {
-                return i2cHandleHardwareFailure();
+                return false;
             }
             I2C_GenerateSTART(I2Cx, ENABLE);                            // send the start for the new job
         }
         I2C_ITConfig(I2Cx, I2C_IT_EVT | I2C_IT_ERR, ENABLE);            // allow the interrupts to fire off again
     }
+    return true;
+}
+
+static bool i2cWaitJob(void)
+{
+    uint32_t timeout = I2C_DEFAULT_TIMEOUT;
 
-    timeout = I2C_DEFAULT_TIMEOUT;
     while (busy && --timeout > 0) { ; }
     if (timeout == 0) {
         return i2cHandleHardwareFailure();
@@ -140,6 +135,39 @@ bool i2cWriteBuffer(uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data)
     return !error;
 }
 
+// ends the job started by i2cReadStart(), called by the interrupt handlers where the blocking functions stop waiting
+static void i2cCompleteAsyncRead(void)
+{
+    if (asyncRead) {
+        asyncRead = false;
+        i2cQueueTransferComplete(!error);
+    }
+}
+
+bool i2cWriteBuffer(uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data)
+{
+    if (!I2Cx)
+        return false;
+
+    i2cQueueWaitIdle();
+
+    addr = addr_ << 1;
+    reg = reg_;
+    writing = 1;
+    reading = 0;
+    write_p = data;
+    read_p = data;
+    bytes = len_;
+    busy = 1;
+    error = false;
+
+    if (!i2cStartJob()) {
+        return i2cHandleHardwareFailure();
+    }
+
+    return i2cWaitJob();
+}
+
 bool i2cWrite(uint8_t addr_, uint8_t reg_, uint8_t data)
 {
     return i2cWriteBuffer(addr_, reg_, 1, &data);
@@ -147,7 +175,10 @@ bool i2cWrite(uint8_t addr_, uint8_t reg_, uint8_t data)
 
 bool i2cRead(uint8_t addr_, uint8_t reg_, uint8_t len, uint8_t* buf)
 {
-    uint32_t timeout = I2C_DEFAULT_TIMEOUT;
+    if (!I2Cx)
+        return false;
+
+    i2cQueueWaitIdle();
 
     addr = addr_ << 1;
     reg = reg_;
@@ -159,25 +190,43 @@ bool i2cRead(uint8_t addr_, uint8_t reg_, uint8_t len, uint8_t* buf)
     busy = 1;
     error = false;
 
+    if (!i2cStartJob())
+        return i2cHandleHardwareFailure();
+
+    return i2cWaitJob();
+}
+
+/*
+ * Starts a read without waiting for it, the interrupt handlers pass the result to i2cQueueTransferComplete().
+ * Only the transfer queue calls this, it keeps the blocking functions above off the bus until the read ended.
+ */
+bool i2cReadStart(uint8_t addr_, uint8_t reg_, uint8_t len, uint8_t* buf)
+{
     if (!I2Cx)
         return false;
 
-    if (!(I2Cx->CR2 & I2C_IT_EVT)) {                                    // if we are restarting the driver
-        if (!(I2Cx->CR1 & 0x0100)) {                                    // ensure sending a start
-            while (I2Cx->CR1 & 0x0200 && --timeout > 0) { ; }           // wait for any stop to finish sending
-            if (timeout == 0)
-                return i2cHandleHardwareFailure();
-            I2C_GenerateSTART(I2Cx, ENABLE);                            // send the start for the new job
-        }
-        I2C_ITConfig(I2Cx, I2C_IT_EVT | I2C_IT_ERR, ENABLE);            // allow the interrupts to fire off again
-    }
+    addr = addr_ << 1;
+    reg = reg_;
+    writing = 0;
+    reading = 1;
+    read_p = buf;
+    write_p = buf;
+    bytes = len;
+    busy = 1;
+    error = false;
+    asyncRead = true;
 
-    timeout = I2C_DEFAULT_TIMEOUT;
-    while (busy && --timeout > 0) { ; }
-    if (timeout == 0)
-        return i2cHandleHardwareFailure();
+    if (!i2cStartJob()) {
+        asyncRead = false;
+        return false;
+    }
+    return true;
+}
 
-    return !error;
+void i2cRecover(void)
+{
+    asyncRead = false;
+    i2cHandleHardwareFailure();
 }
 
 static void i2c_er_handler(void)
@@ -207,6 +256,7 @@ static void i2c_er_handler(void)
     }
     I2Cx->SR1 &= ~0x0F00;                                               // reset all the error bits to clear the interrupt
     busy = 0;
+    i2cCompleteAsyncRead();
 }
 
 void i2c_ev_handler(void)
@@ -306,6 +356,7 @@ void i2c_ev_handler(void)
         if (final_stop)                                                 // If there is a final stop and no more jobs, bus is inactive, disable interrupts to prevent BTF
             I2C_ITConfig(I2Cx, I2C_IT_EVT | I2C_IT_ERR, DISABLE);       // Disable EVT and ERR interrupts while bus inactive
         busy = 0;
+        i2cCompleteAsyncRead();
     }
 }
 
@@ -26,6 +26,7 @@
 #include "system.h"
 
 #include "bus_i2c.h"
+#include "bus_i2c_queue.h"
 
 #ifndef SOFT_I2C
 
@@ -308,4 +309,16 @@ bool i2cRead(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf)
     return true;
 }
 
+// this driver polls the bus, the transfer is complete when it returns
+bool i2cReadStart(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf)
+{
+    i2cQueueTransferComplete(i2cRead(addr_, reg, len, buf));
+    return true;
+}
+
+void i2cRecover(void)
+{
+    i2cInitPort(I2C1);
+}
+
 #endif
@@ -0,0 +1,76 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pwm_dshot.h"
+
+// the standard pulse range of the mixer, fixed in the protocol so there is no ESC calibration
+#define DSHOT_PULSE_MIN 1000
+#define DSHOT_PULSE_MAX 2000
+
+void dshotBitTimingInit(dshotBitTiming_t *timing, uint32_t timerClockHz, uint16_t rateKbit)
+{
+    uint32_t bitRate = (uint32_t)rateKbit * 1000;
+
+    timing->period = (timerClockHz + bitRate / 2) / bitRate;
+    timing->bit1 = (timing->period * 3 + 2) / 4;
+    timing->bit0 = (timing->period * 3 + 4) / 8;
+}
+
+// pulses at or below 1000us stop the motor, 1000..2000us maps onto the whole throttle range of the ESC
+uint16_t dshotThrottleFromPulse(uint16_t pulse)
+{
+    if (pulse <= DSHOT_PULSE_MIN) {
+        return DSHOT_DISARMED;
+    }
+    if (pulse >= DSHOT_PULSE_MAX) {
+        return DSHOT_MAX_THROTTLE;
+    }
+    return DSHOT_MIN_THROTTLE + (uint32_t)(pulse - DSHOT_PULSE_MIN) * (DSHOT_MAX_THROTTLE - DSHOT_MIN_THROTTLE) / (DSHOT_PULSE_MAX - DSHOT_PULSE_MIN);
+}
+
+/*
+ * The 11 bit throttle, the telemetry request bit and a checksum of 4 bits, the XOR of the three nibbles before it.
+ */
+uint16_t dshotPacket(uint16_t throttle, bool telemetry)
+{
+    uint16_t packet = (throttle << 1) | (telemetry ? 1 : 0);
+    uint16_t checksum = packet ^ (packet >> 4) ^ (packet >> 8);
+
+    return (packet << 4) | (checksum & 0x0F);
+}
+
+/*
+ * Writes the compare value of each bit, most significant first, to every stride-th slot followed by the trailing
+ * slots.  A timer drives several motors from one buffer when the stride is its number of channels.
+ */
+void dshotEncodePacket(uint16_t *slots, uint8_t stride, uint16_t packet, const dshotBitTiming_t *timing)
+{
+    uint8_t bit;
+
+    for (bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+        *slots = (packet & 0x8000) ? timing->bit1 : timing->bit0;
+        slots += stride;
+        packet <<= 1;
+    }
+    for (bit = 0; bit < DSHOT_FRAME_TRAILING_SLOTS; bit++) {
+        *slots = 0;
+        slots += stride;
+    }
+}
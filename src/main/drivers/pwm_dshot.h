@@ -0,0 +1,39 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define DSHOT_FRAME_BITS 16
+#define DSHOT_FRAME_TRAILING_SLOTS 2    // compare values of 0 after the frame keep the line low until the next one
+#define DSHOT_FRAME_SLOTS (DSHOT_FRAME_BITS + DSHOT_FRAME_TRAILING_SLOTS)
+
+#define DSHOT_DISARMED 0
+#define DSHOT_MIN_THROTTLE 48           // 1..47 are ESC commands
+#define DSHOT_MAX_THROTTLE 2047
+
+#define DSHOT_DEFAULT_RATE 600          // kbit/s
+
+typedef struct dshotBitTiming_s {
+    uint16_t period;                    // timer ticks per bit
+    uint16_t bit1;                      // timer ticks high for a 1, 3/4 of the bit
+    uint16_t bit0;                      // timer ticks high for a 0, 3/8 of the bit
+} dshotBitTiming_t;
+
+void dshotBitTimingInit(dshotBitTiming_t *timing, uint32_t timerClockHz, uint16_t rateKbit);
+uint16_t dshotThrottleFromPulse(uint16_t pulse);
+uint16_t dshotPacket(uint16_t throttle, bool telemetry);
+void dshotEncodePacket(uint16_t *slots, uint8_t stride, uint16_t packet, const dshotBitTiming_t *timing);
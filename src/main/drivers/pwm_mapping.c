@@ -243,63 +243,45 @@ static const uint16_t * const hardwareMaps[] = {
     airPPM,
 };
 
-pwmOutputConfiguration_t *pwmInit(drv_pwm_config_t *init)
-{
-    int i = 0;
-    const uint16_t *setup;
-
-    int channelIndex = 0;
-
-    static pwmOutputConfiguration_t pwmOutputConfiguration;
-
-    memset(&pwmOutputConfiguration, 0, sizeof(pwmOutputConfiguration));
-
-    // this is pretty hacky shit, but it will do for now. array of 4 config maps, [ multiPWM multiPPM airPWM airPPM ]
-    if (init->airplane)
-        i = 2; // switch to air hardware config
-    if (init->usePPM)
-        i++; // next index is for PPM
-
-    setup = hardwareMaps[i];
-
-    for (i = 0; i < USABLE_TIMER_CHANNEL_COUNT; i++) {
-        uint8_t timerIndex = setup[i] & 0x00FF;
-        uint8_t type = (setup[i] & 0xFF00) >> 8;
-
-        if (setup[i] == 0xFFFF) // terminator
-            break;
+#if defined(STM32F303)
+// the LED strip uses the DMA channel of the TIM3 update events
+#define LED_STRIP_DMA_TIMER TIM3
+#endif
 
-        const timerHardware_t *timerHardwarePtr = &timerHardware[timerIndex];
+// returns what the channel is used for with this configuration, 0 when it is not used
+static uint8_t channelType(drv_pwm_config_t *init, uint8_t timerIndex, uint8_t type)
+{
+    const timerHardware_t *timerHardwarePtr = &timerHardware[timerIndex];
 
 #ifdef OLIMEXINO_UNCUT_LED2_E_JUMPER
-        // PWM2 is connected to LED2 on the board and cannot be connected unless you cut LED2_E
-        if (timerIndex == PWM2)
-            continue;
+    // PWM2 is connected to LED2 on the board and cannot be connected unless you cut LED2_E
+    if (timerIndex == PWM2)
+        return 0;
 #endif
 
 #ifdef STM32F10X
-        // skip UART2 ports
-        if (init->useUART2 && (timerIndex == PWM3 || timerIndex == PWM4))
-            continue;
+    // skip UART2 ports
+    if (init->useUART2 && (timerIndex == PWM3 || timerIndex == PWM4))
+        return 0;
 #endif
 
 #ifdef STM32F10X
-        // skip softSerial ports
-        if (init->useSoftSerial && (timerIndex == PWM5 || timerIndex == PWM6 || timerIndex == PWM7 || timerIndex == PWM8))
-            continue;
+    // skip softSerial ports
+    if (init->useSoftSerial && (timerIndex == PWM5 || timerIndex == PWM6 || timerIndex == PWM7 || timerIndex == PWM8))
+        return 0;
 #endif
 
 #ifdef CHEBUZZF3
-        // skip softSerial ports
-        // PWM4 can no-longer be used since it uses the same timer as PWM5 and PWM6
-        if (init->useSoftSerial && (timerIndex == PWM4 || timerIndex == PWM5 || timerIndex == PWM6 || timerIndex == PWM7 || timerIndex == PWM8))
-            continue;
+    // skip softSerial ports
+    // PWM4 can no-longer be used since it uses the same timer as PWM5 and PWM6
+    if (init->useSoftSerial && (timerIndex == PWM4 || timerIndex == PWM5 || timerIndex == PWM6 || timerIndex == PWM7 || timerIndex == PWM8))
+        return 0;
 #endif
 
 #if defined(STM32F3DISCOVERY) && !defined(CHEBUZZF3)
-        // skip softSerial ports
-        if (init->useSoftSerial && (timerIndex == PWM9 || timerIndex == PWM10 || timerIndex == PWM11 || timerIndex == PWM12))
-            continue;
+    // skip softSerial ports
+    if (init->useSoftSerial && (timerIndex == PWM9 || timerIndex == PWM10 || timerIndex == PWM11 || timerIndex == PWM12))
+        return 0;
 #endif
 
 #if defined(STM32F10X) && !defined(CC3D)
@@ -315,53 +297,114 @@ pwmOutputConfiguration_t *pwmInit(drv_pwm_config_t *init)
 #endif
 
 #ifdef LED_STRIP_TIMER
-        // skip LED Strip output
-        if (init->useLEDStrip && timerHardwarePtr->tim == LED_STRIP_TIMER)
-            continue;
+    // skip LED Strip output
+    if (init->useLEDStrip && timerHardwarePtr->tim == LED_STRIP_TIMER)
+        return 0;
 #endif
 
 #ifdef STM32F10X
-        // skip ADC for RSSI
-        if (init->useRSSIADC && timerIndex == PWM2)
-            continue;
+    // skip ADC for RSSI
+    if (init->useRSSIADC && timerIndex == PWM2)
+        return 0;
 #endif
 
 #ifdef CC3D
-        if (init->useVbat && timerIndex == PWM5) {
-            continue;
-        }
+    if (init->useVbat && timerIndex == PWM5) {
+        return 0;
+    }
 #endif
-        // hacks to allow current functionality
-        if (type == MAP_TO_PWM_INPUT && !init->useParallelPWM)
-            type = 0;
+    // hacks to allow current functionality
+    if (type == MAP_TO_PWM_INPUT && !init->useParallelPWM)
+        type = 0;
 
-        if (type == MAP_TO_PPM_INPUT && !init->usePPM)
-            type = 0;
+    if (type == MAP_TO_PPM_INPUT && !init->usePPM)
+        type = 0;
 
-        if (init->useServos && !init->airplane) {
+    if (init->useServos && !init->airplane) {
 #if defined(STM32F10X) || defined(CHEBUZZF3)
-            // remap PWM9+10 as servos
+        // remap PWM9+10 as servos
+        if (timerIndex == PWM9 || timerIndex == PWM10)
+            type = MAP_TO_SERVO_OUTPUT;
+#endif
+
+#if (defined(STM32F303xC) || defined(STM32F3DISCOVERY)) && !defined(CHEBUZZF3)
+        // remap PWM 5+6 or 9+10 as servos - softserial pin pairs require timer ports that use the same timer
+        if (init->useSoftSerial) {
+            if (timerIndex == PWM5 || timerIndex == PWM6)
+                type = MAP_TO_SERVO_OUTPUT;
+        } else {
             if (timerIndex == PWM9 || timerIndex == PWM10)
                 type = MAP_TO_SERVO_OUTPUT;
+        }
 #endif
+    }
 
-#if (defined(STM32F303xC) || defined(STM32F3DISCOVERY)) && !defined(CHEBUZZF3)
-            // remap PWM 5+6 or 9+10 as servos - softserial pin pairs require timer ports that use the same timer
-            if (init->useSoftSerial) {
-                if (timerIndex == PWM5 || timerIndex == PWM6)
-                    type = MAP_TO_SERVO_OUTPUT;
-            } else {
-                if (timerIndex == PWM9 || timerIndex == PWM10)
-                    type = MAP_TO_SERVO_OUTPUT;
-            }
+    if (init->extraServos && !init->airplane) {
+        // remap PWM5..8 as servos when used in extended servo mode
+        if (timerIndex >= PWM5 && timerIndex <= PWM8)
+            type = MAP_TO_SERVO_OUTPUT;
+    }
+
+    return type;
+}
+
+/*
+ * Inputs and servos count at PWM_TIMER_MHZ, a motor sharing the timer with them must not change its clock or period
+ * for oneshot125 or DShot.
+ */
+static bool isTimerSharedWithPwmClock(drv_pwm_config_t *init, const uint16_t *setup, TIM_TypeDef *tim)
+{
+    int i;
+
+    for (i = 0; i < USABLE_TIMER_CHANNEL_COUNT && setup[i] != 0xFFFF; i++) {
+        uint8_t timerIndex = setup[i] & 0x00FF;
+        uint8_t type = channelType(init, timerIndex, (setup[i] & 0xFF00) >> 8);
+
+        if ((type == MAP_TO_PPM_INPUT || type == MAP_TO_PWM_INPUT || type == MAP_TO_SERVO_OUTPUT) && timerHardware[timerIndex].tim == tim)
+            return true;
+    }
+    return false;
+}
+
+// returns false when the timer of the motor has no DMA channel free for DShot
+static bool configureDshotMotor(drv_pwm_config_t *init, const timerHardware_t *timerHardwarePtr, uint8_t motorIndex)
+{
+#ifdef LED_STRIP_DMA_TIMER
+    if (init->useLEDStrip && timerHardwarePtr->tim == LED_STRIP_DMA_TIMER)
+        return false;
 #endif
-        }
+    return pwmDshotMotorConfig(timerHardwarePtr, motorIndex, init->dshotRate);
+}
 
-        if (init->extraServos && !init->airplane) {
-            // remap PWM5..8 as servos when used in extended servo mode
-            if (timerIndex >= PWM5 && timerIndex <= PWM8)
-                type = MAP_TO_SERVO_OUTPUT;
-        }
+pwmOutputConfiguration_t *pwmInit(drv_pwm_config_t *init)
+{
+    int i = 0;
+    const uint16_t *setup;
+
+    int channelIndex = 0;
+
+    static pwmOutputConfiguration_t pwmOutputConfiguration;
+
+    memset(&pwmOutputConfiguration, 0, sizeof(pwmOutputConfiguration));
+
+    // this is pretty hacky shit, but it will do for now. array of 4 config maps, [ multiPWM multiPPM airPWM airPPM ]
+    if (init->airplane)
+        i = 2; // switch to air hardware config
+    if (init->usePPM)
+        i++; // next index is for PPM
+
+    setup = hardwareMaps[i];
+
+    for (i = 0; i < USABLE_TIMER_CHANNEL_COUNT; i++) {
+        uint8_t timerIndex = setup[i] & 0x00FF;
+        uint8_t type = (setup[i] & 0xFF00) >> 8;
+
+        if (setup[i] == 0xFFFF) // terminator
+            break;
+
+        const timerHardware_t *timerHardwarePtr = &timerHardware[timerIndex];
+
+        type = channelType(init, timerIndex, type);
 
         if (type == MAP_TO_PPM_INPUT) {
             ppmInConfig(timerHardwarePtr);
@@ -369,10 +412,13 @@ pwmOutputConfiguration_t *pwmInit(drv_pwm_config_t *init)
             pwmInConfig(timerHardwarePtr, channelIndex);
             channelIndex++;
         } else if (type == MAP_TO_MOTOR_OUTPUT) {
+            bool keepPwmClock = isTimerSharedWithPwmClock(init, setup, timerHardwarePtr->tim);
+
             if (init->motorPwmRate > 500) {
                 pwmBrushedMotorConfig(timerHardwarePtr, pwmOutputConfiguration.motorCount, init->motorPwmRate, init->idlePulse);
-            } else {
-                pwmBrushlessMotorConfig(timerHardwarePtr, pwmOutputConfiguration.motorCount, init->motorPwmRate, init->idlePulse);
+            } else if (!init->useDshot || keepPwmClock || !configureDshotMotor(init, timerHardwarePtr, pwmOutputConfiguration.motorCount)) {
+                // DShot ESCs accept oneshot125 and PWM as well, motors on a timer shared with inputs or servos keep sending PWM
+                pwmBrushlessMotorConfig(timerHardwarePtr, pwmOutputConfiguration.motorCount, init->motorPwmRate, init->idlePulse, (init->useOneshot || init->useDshot) && !keepPwmClock);
             }
             pwmOutputConfiguration.motorCount++;
         } else if (type == MAP_TO_SERVO_OUTPUT) {
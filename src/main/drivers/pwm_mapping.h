@@ -49,6 +49,9 @@ typedef struct drv_pwm_config_t {
     bool extraServos;    // configure additional 4 channels in PPM mode as servos, not motors
     bool airplane;       // fixed wing hardware config, lots of servos etc
     uint16_t motorPwmRate;
+    bool useOneshot;     // oneshot125 pulses sent once per loop instead of motorPwmRate, ignored for brushed motors and on timers shared with inputs or servos
+    bool useDshot;       // DShot frames sent once per loop, oneshot125 on timers without a DMA channel for it, PWM on timers shared with inputs or servos
+    uint16_t dshotRate;  // kbit/s
     uint16_t servoPwmRate;
     uint16_t idlePulse;  // PWM value to use when initializing the driver. set this to either PULSE_1MS (regular pwm), 
                          // some higher value (used by 3d mode), or 0, for brushed pwm drivers.
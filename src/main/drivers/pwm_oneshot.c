@@ -0,0 +1,44 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pwm_oneshot.h"
+
+/*
+ * Returns the fastest timer clock, in MHz, that the prescaler can derive from timerClockHz without rounding.  The
+ * timer clock differs between targets, 72MHz normally, 64MHz when the F1 falls back to its internal oscillator and
+ * 80 or 84MHz when it is overclocked, a fixed 24MHz clock would only be exact on the first.
+ */
+uint8_t oneshot125TimerMhz(uint32_t timerClockHz)
+{
+    uint8_t mhz;
+
+    for (mhz = ONESHOT125_TIMER_MAX_MHZ; mhz > 1; mhz--) {
+        if (timerClockHz % (mhz * 1000000) == 0) {
+            break;
+        }
+    }
+    return mhz;
+}
+
+// the oneshot pulse is 1/8 of the standard pulse, 1000..2000 becomes 125..250us, rounded to the nearest tick
+uint16_t oneshot125PulseTicks(uint16_t value, uint8_t timerMhz)
+{
+    return ((uint32_t)value * timerMhz + 4) / 8;
+}
@@ -0,0 +1,24 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// fastest timer clock for the oneshot pulses, a 2000us pulse is 6000 ticks and the 16 bit timer wraps after 2.7ms
+#define ONESHOT125_TIMER_MAX_MHZ 24
+
+uint8_t oneshot125TimerMhz(uint32_t timerClockHz);
+uint16_t oneshot125PulseTicks(uint16_t value, uint8_t timerMhz);
@@ -22,17 +22,60 @@
 
 #include "platform.h"
 
+#include "common/maths.h"
+
 #include "gpio.h"
 #include "timer.h"
 
 #include "flight/failsafe.h" // FIXME dependency into the main code from a driver
 
 #include "pwm_mapping.h"
+#include "pwm_oneshot.h"
+#include "pwm_dshot.h"
 
 #include "pwm_output.h"
 
 typedef void (*pwmWriteFuncPtr)(uint8_t index, uint16_t value);  // function pointer used to write motors
 
+#define DSHOT_MAX_TIMER_CHANNELS 4
+
+typedef struct {
+    TIM_TypeDef *tim;
+    DMA_Channel_TypeDef *dmaChannel;
+} dshotTimerDMA_t;
+
+/*
+ * The DMA channels of the timer update events.  Timers whose channel is taken by a serial port or the ADC are not
+ * listed, their motors fall back to oneshot125.
+ */
+static const dshotTimerDMA_t dshotTimerDMAs[] = {
+#ifdef STM32F10X
+    // TIM1 update shares DMA1 channel 5 with USART1 rx, TIM3 update channel 3 with USART3 rx frames
+    { TIM2, DMA1_Channel2 },
+    { TIM4, DMA1_Channel7 },
+#endif
+#ifdef STM32F303xC
+    // TIM1 and TIM15 update share DMA1 channel 5 with USART1 rx, TIM17 update channel 1 with the ADC
+    { TIM2, DMA1_Channel2 },
+    { TIM3, DMA1_Channel3 },    // shared with the LED strip, see pwm_mapping.c
+#ifndef USE_USART2_TX_DMA
+    // DMA1 channel 7 is USART2 tx, see serial_uart_stm32f30x.c
+    { TIM4, DMA1_Channel7 },
+#endif
+    { TIM8, DMA2_Channel1 },
+#endif
+};
+
+#define DSHOT_TIMER_DMA_COUNT (sizeof(dshotTimerDMAs) / sizeof(dshotTimerDMAs[0]))
+
+// the DMA burst writes the compare registers from the first to the last motor channel of the timer on each update
+typedef struct {
+    const dshotTimerDMA_t *timerDMA;
+    uint8_t firstChannel;
+    uint8_t lastChannel;
+    uint16_t slots[DSHOT_FRAME_SLOTS * DSHOT_MAX_TIMER_CHANNELS];
+} dshotTimer_t;
+
 typedef struct {
 #ifdef STM32F303xC
     volatile uint32_t *ccr;
@@ -42,7 +85,10 @@ typedef struct {
     volatile uint16_t *ccr;
 #endif
     uint16_t period;
+    TIM_TypeDef *tim;
     pwmWriteFuncPtr pwmWritePtr;
+    dshotTimer_t *dshotTimer;
+    uint8_t channelIndex;
 } pwmOutputPort_t;
 
 static pwmOutputPort_t pwmOutputPorts[MAX_PWM_OUTPUT_PORTS];
@@ -54,6 +100,12 @@ static pwmOutputPort_t *servos[MAX_PWM_SERVOS];
 
 static uint8_t allocatedOutputPortCount = 0;
 
+static uint8_t oneshotTimerMhz;
+
+static dshotTimer_t dshotTimers[DSHOT_TIMER_DMA_COUNT];
+static uint8_t dshotTimerCount = 0;
+static dshotBitTiming_t dshotBitTiming;
+
 static void pwmOCConfig(TIM_TypeDef *tim, uint8_t channel, uint16_t value)
 {
     TIM_OCInitTypeDef  TIM_OCInitStructure;
@@ -122,6 +174,7 @@ static pwmOutputPort_t *pwmOutConfig(const timerHardware_t *timerHardware, uint8
             break;
     }
     p->period = period;
+    p->tim = timerHardware->tim;
 
     return p;
 }
@@ -136,6 +189,24 @@ static void pwmWriteStandard(uint8_t index, uint16_t value)
     *motors[index]->ccr = value;
 }
 
+static void pwmWriteOneshot(uint8_t index, uint16_t value)
+{
+    *motors[index]->ccr = oneshot125PulseTicks(value, oneshotTimerMhz);
+}
+
+static uint8_t dshotBurstLength(const dshotTimer_t *dshotTimer)
+{
+    return dshotTimer->lastChannel - dshotTimer->firstChannel + 1;
+}
+
+static void pwmWriteDshot(uint8_t index, uint16_t value)
+{
+    dshotTimer_t *dshotTimer = motors[index]->dshotTimer;
+    uint16_t packet = dshotPacket(dshotThrottleFromPulse(value), false);
+
+    dshotEncodePacket(&dshotTimer->slots[motors[index]->channelIndex - dshotTimer->firstChannel], dshotBurstLength(dshotTimer), packet, &dshotBitTiming);
+}
+
 void pwmWriteMotor(uint8_t index, uint16_t value)
 {
     if (motors[index] && index < MAX_MOTORS)
@@ -157,13 +228,168 @@ void pwmBrushedMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIn
 
 }
 
-void pwmBrushlessMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse)
+void pwmBrushlessMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse, bool useOneshot)
 {
 	uint32_t hz = PWM_TIMER_MHZ * 1000000;
+
+	if (useOneshot) {
+		// the timer runs free and only pulses when pwmCompleteOneshotMotorUpdate() restarts it, no pulse before the first write
+		oneshotTimerMhz = oneshot125TimerMhz(SystemCoreClock);
+		motors[motorIndex] = pwmOutConfig(timerHardware, oneshotTimerMhz, 0xFFFF, 0);
+		motors[motorIndex]->pwmWritePtr = pwmWriteOneshot;
+		return;
+	}
+
 	motors[motorIndex] = pwmOutConfig(timerHardware, PWM_TIMER_MHZ, hz / motorPwmRate, idlePulse);
 	motors[motorIndex]->pwmWritePtr = pwmWriteStandard;
 }
 
+static bool isOneshotTimerUpdated(uint8_t index)
+{
+    uint8_t earlierIndex;
+
+    for (earlierIndex = 0; earlierIndex < index; earlierIndex++) {
+        if (motors[earlierIndex] && motors[earlierIndex]->tim == motors[index]->tim) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static const dshotTimerDMA_t *findDshotTimerDMA(TIM_TypeDef *tim)
+{
+    uint8_t index;
+
+    for (index = 0; index < DSHOT_TIMER_DMA_COUNT; index++) {
+        if (dshotTimerDMAs[index].tim == tim) {
+            return &dshotTimerDMAs[index];
+        }
+    }
+    return NULL;
+}
+
+static dshotTimer_t *findDshotTimer(TIM_TypeDef *tim)
+{
+    uint8_t index;
+
+    for (index = 0; index < dshotTimerCount; index++) {
+        if (dshotTimers[index].timerDMA->tim == tim) {
+            return &dshotTimers[index];
+        }
+    }
+    return NULL;
+}
+
+static void dshotDMAConfig(dshotTimer_t *dshotTimer)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+    TIM_TypeDef *tim = dshotTimer->timerDMA->tim;
+    DMA_Channel_TypeDef *dmaChannel = dshotTimer->timerDMA->dmaChannel;
+    uint8_t burstLength = dshotBurstLength(dshotTimer);
+
+    // TIM_DMABase_CCR2..4 and TIM_DMABurstLength_2Transfers..4Transfers follow on from these
+    TIM_DMAConfig(tim, TIM_DMABase_CCR1 + dshotTimer->firstChannel, TIM_DMABurstLength_1Transfer + ((burstLength - 1) << 8));
+
+    DMA_DeInit(dmaChannel);
+
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&tim->DMAR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)dshotTimer->slots;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_BufferSize = DSHOT_FRAME_SLOTS * burstLength;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+
+    DMA_Init(dmaChannel, &DMA_InitStructure);
+
+    TIM_DMACmd(tim, TIM_DMA_Update, ENABLE);
+}
+
+/*
+ * Returns false when the timer of the motor has no DMA channel for DShot, the motor is not configured then.
+ */
+bool pwmDshotMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, uint16_t dshotRate)
+{
+    const dshotTimerDMA_t *timerDMA = findDshotTimerDMA(timerHardware->tim);
+    dshotTimer_t *dshotTimer;
+    uint8_t channelIndex = timerHardware->channel >> 2; // TIM_Channel_1..4 are 0, 4, 8 and 12
+
+    if (!timerDMA) {
+        return false;
+    }
+
+    dshotTimer = findDshotTimer(timerHardware->tim);
+    if (!dshotTimer) {
+        dshotTimer = &dshotTimers[dshotTimerCount++];
+        dshotTimer->timerDMA = timerDMA;
+        dshotTimer->firstChannel = channelIndex;
+        dshotTimer->lastChannel = channelIndex;
+    }
+    dshotTimer->firstChannel = min(dshotTimer->firstChannel, channelIndex);
+    dshotTimer->lastChannel = max(dshotTimer->lastChannel, channelIndex);
+
+#ifdef STM32F303xC
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1 | RCC_AHBPeriph_DMA2, ENABLE);
+#else
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+#endif
+
+    // the timer counts at the timer clock, a bit is 120 ticks at 600kbit/s and 72MHz
+    dshotBitTimingInit(&dshotBitTiming, SystemCoreClock, dshotRate);
+    motors[motorIndex] = pwmOutConfig(timerHardware, SystemCoreClock / 1000000, dshotBitTiming.period, 0);
+    motors[motorIndex]->pwmWritePtr = pwmWriteDshot;
+    motors[motorIndex]->dshotTimer = dshotTimer;
+    motors[motorIndex]->channelIndex = channelIndex;
+
+    dshotDMAConfig(dshotTimer);
+    return true;
+}
+
+static void pwmCompleteDshotMotorUpdate(void)
+{
+    DMA_Channel_TypeDef *dmaChannel;
+    uint8_t index;
+
+    // the frames go out from the next update event on, as the DMA burst writes them into the compare registers
+    for (index = 0; index < dshotTimerCount; index++) {
+        dmaChannel = dshotTimers[index].timerDMA->dmaChannel;
+        DMA_Cmd(dmaChannel, DISABLE);
+        DMA_SetCurrDataCounter(dmaChannel, DSHOT_FRAME_SLOTS * dshotBurstLength(&dshotTimers[index]));
+        DMA_Cmd(dmaChannel, ENABLE);
+    }
+}
+
+/*
+ * Sends the pulses and frames written since the last call.  For oneshot the update event restarts each motor timer
+ * once and loads the preloaded pulse widths, the zeroes written afterwards load on the overflow so a late loop sends
+ * no second pulse.
+ */
+void pwmCompleteMotorUpdate(uint8_t motorCount)
+{
+    uint8_t index;
+
+    for (index = 0; index < motorCount && index < MAX_MOTORS; index++) {
+        if (!motors[index] || motors[index]->pwmWritePtr != pwmWriteOneshot) {
+            continue;
+        }
+        if (!isOneshotTimerUpdated(index)) {
+            TIM_GenerateEvent(motors[index]->tim, TIM_EventSource_Update);
+        }
+    }
+
+    for (index = 0; index < motorCount && index < MAX_MOTORS; index++) {
+        if (motors[index] && motors[index]->pwmWritePtr == pwmWriteOneshot) {
+            *motors[index]->ccr = 0;
+        }
+    }
+
+    pwmCompleteDshotMotorUpdate();
+}
+
 void pwmServoConfig(const timerHardware_t *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse)
 {
 	servos[servoIndex] = pwmOutConfig(timerHardware, PWM_TIMER_MHZ, 1000000 / servoPwmRate, servoCenterPulse);
@@ -17,9 +17,14 @@
 
 #pragma once
 
-void pwmBrushedMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse);
-void pwmBrushlessMotorConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse);
+// see timer.h, the mixer only needs the write functions from this header
+struct timerHardware_s;
+
+void pwmBrushedMotorConfig(const struct timerHardware_s *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse);
+void pwmBrushlessMotorConfig(const struct timerHardware_s *timerHardware, uint8_t motorIndex, uint16_t motorPwmRate, uint16_t idlePulse, bool useOneshot);
+bool pwmDshotMotorConfig(const struct timerHardware_s *timerHardware, uint8_t motorIndex, uint16_t dshotRate);
 void pwmWriteMotor(uint8_t index, uint16_t value);
+void pwmCompleteMotorUpdate(uint8_t motorCount);
 
-void pwmServoConfig(const timerHardware_t *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
+void pwmServoConfig(const struct timerHardware_s *timerHardware, uint8_t servoIndex, uint16_t servoPwmRate, uint16_t servoCenterPulse);
 void pwmWriteServo(uint8_t index, uint16_t value);
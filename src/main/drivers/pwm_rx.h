@@ -22,8 +22,11 @@ typedef enum {
     INPUT_FILTERING_ENABLED
 } inputFilteringMode_e;
 
-void ppmInConfig(const timerHardware_t *timerHardwarePtr);
-void pwmInConfig(const timerHardware_t *timerHardwarePtr, uint8_t channel);
+// see timer.h, the config only needs inputFilteringMode_e from this header
+struct timerHardware_s;
+
+void ppmInConfig(const struct timerHardware_s *timerHardwarePtr);
+void pwmInConfig(const struct timerHardware_s *timerHardwarePtr, uint8_t channel);
 
 uint16_t pwmRead(uint8_t channel);
 
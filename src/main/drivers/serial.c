@@ -17,6 +17,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -24,10 +25,7 @@
 
 void serialPrint(serialPort_t *instance, const char *str)
 {
-    uint8_t ch;
-    while ((ch = *(str++)) != 0) {
-        serialWrite(instance, ch);
-    }
+    serialWriteBuf(instance, (const uint8_t *)str, strlen(str));
 }
 
 uint32_t serialGetBaudRate(serialPort_t *instance)
@@ -40,7 +38,7 @@ void serialWrite(serialPort_t *instance, uint8_t ch)
     instance->vTable->serialWrite(instance, ch);
 }
 
-uint8_t serialTotalBytesWaiting(serialPort_t *instance)
+uint32_t serialTotalBytesWaiting(serialPort_t *instance)
 {
     return instance->vTable->serialTotalBytesWaiting(instance);
 }
@@ -60,8 +58,91 @@ bool isSerialTransmitBufferEmpty(serialPort_t *instance)
     return instance->vTable->isSerialTransmitBufferEmpty(instance);
 }
 
+/*
+ * Asks the port to pass whole frames to callback instead of single bytes to the callback given when it was opened.
+ * Returns false when the port can not, the byte callback stays in use then.
+ */
+bool serialSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback)
+{
+    if (!instance->vTable->setRxFrameCallback) {
+        return false;
+    }
+
+    return instance->vTable->setRxFrameCallback(instance, callback);
+}
+
+// the free space of the transmit buffer, so callers can avoid splitting a message when the buffer is nearly full
+uint32_t serialTxBytesFree(serialPort_t *instance)
+{
+    return ringBufferFree(&instance->txBuffer);
+}
+
 void serialSetMode(serialPort_t *instance, portMode_t mode)
 {
     instance->vTable->setMode(instance, mode);
 }
 
+// writes count bytes with one call into the driver, instead of one serialWrite() per byte
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count)
+{
+    instance->vTable->writeBuf(instance, data, count);
+}
+
+// reads up to maxCount of the bytes waiting, returns the number of bytes read
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount)
+{
+    return instance->vTable->readBuf(instance, data, maxCount);
+}
+
+/*
+ * Returns count bytes of the transmit buffer to build a message in place, the message is sent by serialTxCommit().
+ * Returns NULL when the port has no room for count bytes in one piece, the caller writes the message with
+ * serialWrite()/serialWriteBuf() then. Nothing else may be written to the port until the space is committed.
+ */
+uint8_t *serialTxReserve(serialPort_t *instance, uint32_t count)
+{
+    return instance->vTable->txReserve(instance, count);
+}
+
+// sends the first count bytes of the space returned by serialTxReserve(), count may be less than was reserved
+void serialTxCommit(serialPort_t *instance, uint32_t count)
+{
+    instance->vTable->txCommit(instance, count);
+}
+
+// bytes that do not fit into the transmit buffer are dropped
+void serialBufferWrite(serialPort_t *instance, const uint8_t *data, uint32_t count)
+{
+    if (count > RING_BUFFER_MAX_SIZE) {
+        count = RING_BUFFER_MAX_SIZE;
+    }
+
+    ringBufferWrite(&instance->txBuffer, data, count);
+}
+
+uint32_t serialBufferRead(serialPort_t *instance, uint8_t *data, uint32_t maxCount)
+{
+    if (maxCount > RING_BUFFER_MAX_SIZE) {
+        maxCount = RING_BUFFER_MAX_SIZE;
+    }
+
+    return ringBufferRead(&instance->rxBuffer, data, maxCount);
+}
+
+uint8_t *serialBufferTxReserve(serialPort_t *instance, uint32_t count)
+{
+    uint16_t contiguous;
+    uint8_t *space = ringBufferWritePointer(&instance->txBuffer, &contiguous);
+
+    // the space must not wrap around the end of the buffer
+    if (contiguous < count) {
+        return NULL;
+    }
+
+    return space;
+}
+
+void serialBufferTxCommit(serialPort_t *instance, uint32_t count)
+{
+    ringBufferProduce(&instance->txBuffer, count);
+}
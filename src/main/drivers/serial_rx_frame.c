@@ -0,0 +1,80 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Frame assembly for ports that receive by circular DMA.
+ *
+ * The serial rx protocols send a frame as one burst of bytes followed by a gap, so the receive line going idle marks
+ * the end of a frame. The DMA writes the bytes into the ring without an interrupt per byte, when the line goes idle
+ * everything written since the previous idle is passed to the callback as one frame. A frame that does not wrap around
+ * the end of the ring is passed in place.
+ *
+ * Nothing here touches the hardware, the uart driver passes the DMA write position, so this can be tested on the host.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "serial.h"
+#include "serial_rx_frame.h"
+
+void serialRxFrameInit(serialRxFrame_t *rxFrame, volatile uint8_t *ring, uint16_t ringSize, serialReceiveFrameCallbackPtr callback)
+{
+    rxFrame->ring = ring;
+    rxFrame->ringSize = ringSize;
+    rxFrame->readPosition = 0;
+    rxFrame->callback = callback;
+}
+
+/*
+ * Called from the idle line interrupt, writePosition is the index the DMA writes the next byte to.
+ *
+ * More than ringSize bytes without an idle line can not be detected, the ring must be larger than the longest burst.
+ * Longer frames than SERIAL_RX_FRAME_MAX_SIZE are dropped, they are noise or two frames without a gap.
+ */
+void serialRxFrameIdle(serialRxFrame_t *rxFrame, uint16_t writePosition)
+{
+    uint16_t readPosition = rxFrame->readPosition;
+    uint16_t length;
+    uint16_t index;
+
+    rxFrame->readPosition = writePosition;
+
+    if (writePosition >= readPosition) {
+        length = writePosition - readPosition;
+        if (length == 0 || length > SERIAL_RX_FRAME_MAX_SIZE) {
+            return;
+        }
+
+        // the DMA writes behind the frame only, it does not change until the ring wraps around
+        rxFrame->callback((const uint8_t *)&rxFrame->ring[readPosition], length);
+        return;
+    }
+
+    length = rxFrame->ringSize - readPosition + writePosition;
+    if (length > SERIAL_RX_FRAME_MAX_SIZE) {
+        return;
+    }
+
+    for (index = 0; index < length; index++) {
+        rxFrame->buffer[index] = rxFrame->ring[(readPosition + index) % rxFrame->ringSize];
+    }
+
+    rxFrame->callback(rxFrame->buffer, length);
+}
@@ -0,0 +1,33 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define SERIAL_RX_FRAME_MAX_SIZE 40     // longest frame of the serial rx protocols, SUMD with 16 channels is 37 bytes
+
+typedef struct serialRxFrame_s {
+    serialReceiveFrameCallbackPtr callback;     // NULL when the port is delivering single bytes
+
+    volatile uint8_t *ring;                     // written by a circular DMA
+    uint16_t ringSize;
+    uint16_t readPosition;                      // start of the frame being received
+
+    uint8_t buffer[SERIAL_RX_FRAME_MAX_SIZE];   // frames that wrap around the end of the ring are copied here
+} serialRxFrame_t;
+
+void serialRxFrameInit(serialRxFrame_t *rxFrame, volatile uint8_t *ring, uint16_t ringSize, serialReceiveFrameCallbackPtr callback);
+void serialRxFrameIdle(serialRxFrame_t *rxFrame, uint16_t writePosition);
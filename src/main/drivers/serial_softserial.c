@@ -138,15 +138,8 @@ static void serialOutputPortConfig(const timerHardware_t *timerHardwarePtr)
 
 static void resetBuffers(softSerial_t *softSerial)
 {
-    softSerial->port.rxBufferSize = SOFT_SERIAL_BUFFER_SIZE;
-    softSerial->port.rxBuffer = softSerial->rxBuffer;
-    softSerial->port.rxBufferTail = 0;
-    softSerial->port.rxBufferHead = 0;
-
-    softSerial->port.txBuffer = softSerial->txBuffer;
-    softSerial->port.txBufferSize = SOFT_SERIAL_BUFFER_SIZE;
-    softSerial->port.txBufferTail = 0;
-    softSerial->port.txBufferHead = 0;
+    ringBufferInit(&softSerial->port.rxBuffer, softSerial->rxBuffer, SOFT_SERIAL_BUFFER_SIZE);
+    ringBufferInit(&softSerial->port.txBuffer, softSerial->txBuffer, SOFT_SERIAL_BUFFER_SIZE);
 }
 
 serialPort_t *openSoftSerial(softSerialPortIndex_e portIndex, serialReceiveCallbackPtr callback, uint32_t baud, serialInversion_e inversion)
@@ -200,17 +193,11 @@ void processTxState(softSerial_t *softSerial)
     uint8_t mask;
 
     if (!softSerial->isTransmittingData) {
-        char byteToSend;
-        if (isSoftSerialTransmitBufferEmpty((serialPort_t *)softSerial)) {
+        uint8_t byteToSend;
+        if (!ringBufferGet(&softSerial->port.txBuffer, &byteToSend)) {
             return;
         }
 
-        // data to send
-        byteToSend = softSerial->port.txBuffer[softSerial->port.txBufferTail++];
-        if (softSerial->port.txBufferTail >= softSerial->port.txBufferSize) {
-            softSerial->port.txBufferTail = 0;
-        }
-
         // build internal buffer, MSB = Stop Bit (1) + data bits (MSB to LSB) + start bit(0) LSB
         softSerial->internalTxBuffer = (1 << (TX_TOTAL_BITS - 1)) | (byteToSend << 1);
         softSerial->bitsLeftToTransmit = TX_TOTAL_BITS;
@@ -285,8 +272,7 @@ void extractAndStoreRxByte(softSerial_t *softSerial)
     if (softSerial->port.callback) {
         softSerial->port.callback(rxByte);
     } else {
-        softSerial->port.rxBuffer[softSerial->port.rxBufferHead] = rxByte;
-        softSerial->port.rxBufferHead = (softSerial->port.rxBufferHead + 1) % softSerial->port.rxBufferSize;
+        ringBufferPut(&softSerial->port.rxBuffer, rxByte);
     }
 }
 
@@ -367,31 +353,24 @@ void onSerialRxPinChange(uint8_t portIndex, captureCompare_t capture)
     }
 }
 
-uint8_t softSerialTotalBytesWaiting(serialPort_t *instance)
+uint32_t softSerialTotalBytesWaiting(serialPort_t *instance)
 {
     if ((instance->mode & MODE_RX) == 0) {
         return 0;
     }
 
-    softSerial_t *s = (softSerial_t *)instance;
-
-    return (s->port.rxBufferHead - s->port.rxBufferTail) & (s->port.txBufferSize - 1);
+    return ringBufferCount(&instance->rxBuffer);
 }
 
 uint8_t softSerialReadByte(serialPort_t *instance)
 {
-    uint8_t ch;
+    uint8_t ch = 0;
 
     if ((instance->mode & MODE_RX) == 0) {
         return 0;
     }
 
-    if (softSerialTotalBytesWaiting(instance) == 0) {
-        return 0;
-    }
-
-    ch = instance->rxBuffer[instance->rxBufferTail];
-    instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
+    ringBufferGet(&instance->rxBuffer, &ch);
     return ch;
 }
 
@@ -401,8 +380,34 @@ void softSerialWriteByte(serialPort_t *s, uint8_t ch)
         return;
     }
 
-    s->txBuffer[s->txBufferHead] = ch;
-    s->txBufferHead = (s->txBufferHead + 1) % s->txBufferSize;
+    ringBufferPut(&s->txBuffer, ch);
+}
+
+void softSerialWriteBuf(serialPort_t *s, const uint8_t *data, uint32_t count)
+{
+    if ((s->mode & MODE_TX) == 0) {
+        return;
+    }
+
+    serialBufferWrite(s, data, count);
+}
+
+uint32_t softSerialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount)
+{
+    if ((instance->mode & MODE_RX) == 0) {
+        return 0;
+    }
+
+    return serialBufferRead(instance, data, maxCount);
+}
+
+uint8_t *softSerialTxReserve(serialPort_t *s, uint32_t count)
+{
+    if ((s->mode & MODE_TX) == 0) {
+        return NULL;
+    }
+
+    return serialBufferTxReserve(s, count);
 }
 
 void softSerialSetBaudRate(serialPort_t *s, uint32_t baudRate)
@@ -418,7 +423,7 @@ void softSerialSetMode(serialPort_t *instance, portMode_t mode)
 
 bool isSoftSerialTransmitBufferEmpty(serialPort_t *instance)
 {
-    return instance->txBufferHead == instance->txBufferTail;
+    return ringBufferCount(&instance->txBuffer) == 0;
 }
 
 const struct serialPortVTable softSerialVTable[] = {
@@ -429,6 +434,11 @@ const struct serialPortVTable softSerialVTable[] = {
         softSerialSetBaudRate,
         isSoftSerialTransmitBufferEmpty,
         softSerialSetMode,
+        NULL,
+        softSerialWriteBuf,
+        softSerialReadBuf,
+        softSerialTxReserve,
+        serialBufferTxCommit,
     }
 };
 
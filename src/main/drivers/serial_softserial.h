@@ -59,8 +59,11 @@ serialPort_t *openSoftSerial(softSerialPortIndex_e portIndex, serialReceiveCallb
 
 // serialPort API
 void softSerialWriteByte(serialPort_t *instance, uint8_t ch);
-uint8_t softSerialTotalBytesWaiting(serialPort_t *instance);
+uint32_t softSerialTotalBytesWaiting(serialPort_t *instance);
 uint8_t softSerialReadByte(serialPort_t *instance);
+void softSerialWriteBuf(serialPort_t *s, const uint8_t *data, uint32_t count);
+uint32_t softSerialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+uint8_t *softSerialTxReserve(serialPort_t *s, uint32_t count);
 void softSerialSetBaudRate(serialPort_t *s, uint32_t baudRate);
 bool isSoftSerialTransmitBufferEmpty(serialPort_t *s);
 
@@ -89,12 +89,14 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
         return (serialPort_t *)s;
     }
     s->txDMAEmpty = true;
+    s->txDMALength = 0;
 
     // common serial initialisation code should move to serialPort::init()
-    s->port.rxBufferHead = s->port.rxBufferTail = 0;
-    s->port.txBufferHead = s->port.txBufferTail = 0;
+    ringBufferReset(&s->port.rxBuffer);
+    ringBufferReset(&s->port.txBuffer);
     // callback works for IRQ-based RX ONLY
     s->port.callback = callback;
+    s->rxFrame.callback = NULL;
     s->port.mode = mode;
     s->port.baudRate = baudRate;
 
@@ -106,6 +108,13 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
 
     uartReconfigure(s);
 
+    // stop delivering frames if the port did before, see uartSetRxFrameCallback()
+    USART_ITConfig(s->USARTx, USART_IT_IDLE, DISABLE);
+    if (s->rxFrameDMAChannel && s->rxFrameDMAChannel != s->rxDMAChannel) {
+        USART_DMACmd(s->USARTx, USART_DMAReq_Rx, DISABLE);
+        DMA_Cmd(s->rxFrameDMAChannel, DISABLE);
+    }
+
     DMA_StructInit(&DMA_InitStructure);
     DMA_InitStructure.DMA_PeripheralBaseAddr = s->rxDMAPeripheralBaseAddr;
     DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
@@ -118,15 +127,14 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
     // Receive DMA or IRQ
     if (mode & MODE_RX) {
         if (s->rxDMAChannel) {
-            DMA_InitStructure.DMA_BufferSize = s->port.rxBufferSize;
+            DMA_InitStructure.DMA_BufferSize = ringBufferSize(&s->port.rxBuffer);
             DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
             DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
-            DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)s->port.rxBuffer;
+            DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)s->port.rxBuffer.buffer;
             DMA_DeInit(s->rxDMAChannel);
             DMA_Init(s->rxDMAChannel, &DMA_InitStructure);
             DMA_Cmd(s->rxDMAChannel, ENABLE);
             USART_DMACmd(s->USARTx, USART_DMAReq_Rx, ENABLE);
-            s->rxDMAPos = DMA_GetCurrDataCounter(s->rxDMAChannel);
         } else {
             USART_ClearITPendingBit(s->USARTx, USART_IT_RXNE);
             USART_ITConfig(s->USARTx, USART_IT_RXNE, ENABLE);
@@ -145,7 +153,7 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
     // Transmit DMA or IRQ
     if (mode & MODE_TX) {
         if (s->txDMAChannel) {
-            DMA_InitStructure.DMA_BufferSize = s->port.txBufferSize;
+            DMA_InitStructure.DMA_BufferSize = ringBufferSize(&s->port.txBuffer);
             DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
             DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
             DMA_DeInit(s->txDMAChannel);
@@ -164,6 +172,19 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
     return (serialPort_t *)s;
 }
 
+#ifdef STM32F303xC
+static void uartReopen(uartPort_t *uartPort)
+{
+    serialReceiveFrameCallbackPtr rxFrameCallback = uartPort->rxFrame.callback;
+
+    uartOpen(uartPort->USARTx, uartPort->port.callback, uartPort->port.baudRate, uartPort->port.mode, uartPort->port.inversion);
+
+    if (rxFrameCallback) {
+        uartSetRxFrameCallback(&uartPort->port, rxFrameCallback);
+    }
+}
+#endif
+
 void uartSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     uartPort_t *uartPort = (uartPort_t *)instance;
@@ -171,7 +192,7 @@ void uartSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 #ifndef STM32F303xC // FIXME this doesnt seem to work, for now re-open the port from scratch, perhaps clearing some uart flags may help?
     uartReconfigure(uartPort);
 #else
-    uartOpen(uartPort->USARTx, uartPort->port.callback, uartPort->port.baudRate, uartPort->port.mode, uartPort->port.inversion);
+    uartReopen(uartPort);
 #endif
 }
 
@@ -182,74 +203,184 @@ void uartSetMode(serialPort_t *instance, portMode_t mode)
 #ifndef STM32F303xC // FIXME this doesnt seem to work, for now re-open the port from scratch, perhaps clearing some uart flags may help?
     uartReconfigure(uartPort);
 #else
-    uartOpen(uartPort->USARTx, uartPort->port.callback, uartPort->port.baudRate, uartPort->port.mode, uartPort->port.inversion);
+    uartReopen(uartPort);
 #endif
 }
 
+/*
+ * Sends the bytes from the tail up to the end of the buffer, the rest follows from the transfer complete interrupt.
+ * The bytes stay in the buffer until the transfer is complete, see uartTxDMAComplete().
+ */
 void uartStartTxDMA(uartPort_t *s)
 {
-    s->txDMAChannel->CMAR = (uint32_t)&s->port.txBuffer[s->port.txBufferTail];
-    if (s->port.txBufferHead > s->port.txBufferTail) {
-        s->txDMAChannel->CNDTR = s->port.txBufferHead - s->port.txBufferTail;
-        s->port.txBufferTail = s->port.txBufferHead;
-    } else {
-        s->txDMAChannel->CNDTR = s->port.txBufferSize - s->port.txBufferTail;
-        s->port.txBufferTail = 0;
-    }
+    uint16_t length;
+    const uint8_t *data = ringBufferReadPointer(&s->port.txBuffer, &length);
+
+    s->txDMAChannel->CMAR = (uint32_t)data;
+    s->txDMAChannel->CNDTR = length;
+    s->txDMALength = length;
     s->txDMAEmpty = false;
     DMA_Cmd(s->txDMAChannel, ENABLE);
 }
 
-uint8_t uartTotalBytesWaiting(serialPort_t *instance)
+// Called by the tx DMA interrupt handlers after the channel was disabled
+void uartTxDMAComplete(uartPort_t *s)
 {
-    uartPort_t *s = (uartPort_t*)instance;
-    if (s->rxDMAChannel)
-        return (s->rxDMAChannel->CNDTR - s->rxDMAPos) & (s->port.txBufferSize - 1);
-    else {
-        return (s->port.rxBufferHead - s->port.rxBufferTail) & (s->port.txBufferSize - 1);
+    ringBufferConsume(&s->port.txBuffer, s->txDMALength);
+    s->txDMALength = 0;
+
+    if (ringBufferCount(&s->port.txBuffer))
+        uartStartTxDMA(s);
+    else
+        s->txDMAEmpty = true;
+}
+
+// publishes the bytes the rx DMA wrote since the last call
+static void uartUpdateRxDMAHead(uartPort_t *s)
+{
+    if (s->rxDMAChannel) {
+        ringBufferProduceUpTo(&s->port.rxBuffer, ringBufferSize(&s->port.rxBuffer) - s->rxDMAChannel->CNDTR);
     }
 }
 
+uint32_t uartTotalBytesWaiting(serialPort_t *instance)
+{
+    uartPort_t *s = (uartPort_t*)instance;
+
+    uartUpdateRxDMAHead(s);
+
+    return ringBufferCount(&s->port.rxBuffer);
+}
+
 bool isUartTransmitBufferEmpty(serialPort_t *instance)
 {
     uartPort_t *s = (uartPort_t *)instance;
     if (s->txDMAChannel)
         return s->txDMAEmpty;
     else
-        return s->port.txBufferTail == s->port.txBufferHead;
+        return ringBufferCount(&s->port.txBuffer) == 0;
 }
 
 uint8_t uartRead(serialPort_t *instance)
 {
-    uint8_t ch;
+    uint8_t ch = 0;
     uartPort_t *s = (uartPort_t *)instance;
 
-    if (s->rxDMAChannel) {
-        ch = s->port.rxBuffer[s->port.rxBufferSize - s->rxDMAPos];
-        if (--s->rxDMAPos == 0)
-            s->rxDMAPos = s->port.rxBufferSize;
-    } else {
-        ch = s->port.rxBuffer[s->port.rxBufferTail];
-        s->port.rxBufferTail = (s->port.rxBufferTail + 1) % s->port.rxBufferSize;
-    }
+    uartUpdateRxDMAHead(s);
+    ringBufferGet(&s->port.rxBuffer, &ch);
 
     return ch;
 }
 
-void uartWrite(serialPort_t *instance, uint8_t ch)
+uint32_t uartReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount)
 {
-    uartPort_t *s = (uartPort_t *)instance;
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-    s->port.txBufferHead = (s->port.txBufferHead + 1) % s->port.txBufferSize;
+    uartUpdateRxDMAHead((uartPort_t *)instance);
+
+    return serialBufferRead(instance, data, maxCount);
+}
 
+static void uartStartTx(uartPort_t *s)
+{
     if (s->txDMAChannel) {
-        if (!(s->txDMAChannel->CCR & 1))
+        if (!(s->txDMAChannel->CCR & 1) && ringBufferCount(&s->port.txBuffer))
             uartStartTxDMA(s);
     } else {
         USART_ITConfig(s->USARTx, USART_IT_TXE, ENABLE);
     }
 }
 
+void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    ringBufferPut(&s->port.txBuffer, ch);
+
+    uartStartTx(s);
+}
+
+void uartWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count)
+{
+    serialBufferWrite(instance, data, count);
+    uartStartTx((uartPort_t *)instance);
+}
+
+void uartTxCommit(serialPort_t *instance, uint32_t count)
+{
+    serialBufferTxCommit(instance, count);
+    uartStartTx((uartPort_t *)instance);
+}
+
+/*
+ * Switches the receiver to deliver every burst of bytes as one frame to callback when the receive line goes idle,
+ * instead of passing single bytes to the callback given to uartOpen().
+ *
+ * The bytes are received by a circular DMA into the receive buffer. Ports without a DMA channel for this fill the
+ * receive buffer from the receive interrupt, the frame is still delivered in one call.
+ */
+bool uartSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+    DMA_InitTypeDef DMA_InitStructure;
+
+    if (!(s->port.mode & MODE_RX)) {
+        return false;
+    }
+
+    if (s->rxFrameDMAChannel) {
+        USART_ITConfig(s->USARTx, USART_IT_RXNE, DISABLE);
+
+        DMA_StructInit(&DMA_InitStructure);
+        DMA_InitStructure.DMA_PeripheralBaseAddr = s->rxDMAPeripheralBaseAddr;
+        DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+        DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+        DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+        DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+        DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+        DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+        DMA_InitStructure.DMA_BufferSize = ringBufferSize(&s->port.rxBuffer);
+        DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+        DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+        DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)s->port.rxBuffer.buffer;
+        DMA_DeInit(s->rxFrameDMAChannel);
+        DMA_Init(s->rxFrameDMAChannel, &DMA_InitStructure);
+
+        serialRxFrameInit(&s->rxFrame, s->port.rxBuffer.buffer, ringBufferSize(&s->port.rxBuffer), callback);
+
+        DMA_Cmd(s->rxFrameDMAChannel, ENABLE);
+        USART_DMACmd(s->USARTx, USART_DMAReq_Rx, ENABLE);
+    } else {
+        USART_ITConfig(s->USARTx, USART_IT_RXNE, DISABLE);
+        ringBufferReset(&s->port.rxBuffer);
+        serialRxFrameInit(&s->rxFrame, s->port.rxBuffer.buffer, ringBufferSize(&s->port.rxBuffer), callback);
+        USART_ITConfig(s->USARTx, USART_IT_RXNE, ENABLE);
+    }
+
+    USART_ITConfig(s->USARTx, USART_IT_IDLE, ENABLE);
+
+    return true;
+}
+
+// Called by the usart interrupt handlers when the receive line went idle
+void uartRxFrameIdle(uartPort_t *s)
+{
+    uint16_t writePosition;
+
+    if (!s->rxFrame.callback) {
+        return;
+    }
+
+    if (s->rxFrameDMAChannel) {
+        writePosition = ringBufferSize(&s->port.rxBuffer) - s->rxFrameDMAChannel->CNDTR;
+        serialRxFrameIdle(&s->rxFrame, writePosition);
+        return;
+    }
+
+    // the receive interrupt fills the ring buffer, the frame has been delivered so the bytes are not needed anymore
+    writePosition = s->port.rxBuffer.head & s->port.rxBuffer.mask;
+    serialRxFrameIdle(&s->rxFrame, writePosition);
+    ringBufferConsume(&s->port.rxBuffer, ringBufferCount(&s->port.rxBuffer));
+}
+
 const struct serialPortVTable uartVTable[] = {
     {
         uartWrite,
@@ -258,5 +389,10 @@ const struct serialPortVTable uartVTable[] = {
         uartSetBaudRate,
         isUartTransmitBufferEmpty,
         uartSetMode,
+        uartSetRxFrameCallback,
+        uartWriteBuf,
+        uartReadBuf,
+        serialBufferTxReserve,
+        uartTxCommit,
     }
 };
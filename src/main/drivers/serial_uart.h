@@ -17,31 +17,37 @@
 
 #pragma once
 
+#include "serial_rx_frame.h"
+
 // FIXME since serial ports can be used for any function these buffer sizes probably need normalising.
-// Code is optimal when buffer sizes are powers of 2 due to use of % and / operators.
+// Buffer sizes must be powers of 2, see ringBufferInit().
+// The transmit buffers hold a whole MSP reply, a reply that does not fit is dropped, see headSerialResponse().
 #define UART1_RX_BUFFER_SIZE    256
 #define UART1_TX_BUFFER_SIZE    256
 #define UART2_RX_BUFFER_SIZE    128
-#define UART2_TX_BUFFER_SIZE    64
+#define UART2_TX_BUFFER_SIZE    256
 #define UART3_RX_BUFFER_SIZE    128
-#define UART3_TX_BUFFER_SIZE    64
+#define UART3_TX_BUFFER_SIZE    256
 
 typedef struct {
     serialPort_t port;
 
     DMA_Channel_TypeDef *rxDMAChannel;
     DMA_Channel_TypeDef *txDMAChannel;
+    DMA_Channel_TypeDef *rxFrameDMAChannel;     // receives while delivering frames, see uartSetRxFrameCallback()
 
     uint32_t rxDMAIrq;
     uint32_t txDMAIrq;
 
-    uint32_t rxDMAPos;
+    uint16_t txDMALength;   // bytes being sent by the tx DMA, they are consumed from the buffer when the transfer completes
     bool txDMAEmpty;
 
     uint32_t txDMAPeripheralBaseAddr;
     uint32_t rxDMAPeripheralBaseAddr;
 
     USART_TypeDef *USARTx;
+
+    serialRxFrame_t rxFrame;
 } uartPort_t;
 
 extern const struct serialPortVTable uartVTable[];
@@ -50,7 +56,14 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback,
 
 // serialPort API
 void uartWrite(serialPort_t *instance, uint8_t ch);
-uint8_t uartTotalBytesWaiting(serialPort_t *instance);
+uint32_t uartTotalBytesWaiting(serialPort_t *instance);
 uint8_t uartRead(serialPort_t *instance);
 void uartSetBaudRate(serialPort_t *s, uint32_t baudRate);
 bool isUartTransmitBufferEmpty(serialPort_t *s);
+bool uartSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
+void uartWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count);
+uint32_t uartReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+void uartTxCommit(serialPort_t *instance, uint32_t count);
+
+void uartTxDMAComplete(uartPort_t *s);
+void uartRxFrameIdle(uartPort_t *s);
@@ -46,29 +46,30 @@ static uartPort_t uartPort2;
 static uartPort_t uartPort3;
 #endif
 
-void uartStartTxDMA(uartPort_t *s);
-
 void usartIrqCallback(uartPort_t *s)
 {
     uint16_t SR = s->USARTx->SR;
 
-    if (SR & USART_FLAG_RXNE) {
-        // If we registered a callback, pass crap there
-        if (s->port.callback) {
+    if ((SR & USART_FLAG_RXNE) && (s->USARTx->CR1 & USART_CR1_RXNEIE)) {
+        // If we registered a callback, pass crap there, unless frames are delivered from the buffer on an idle line
+        if (s->port.callback && !s->rxFrame.callback) {
             s->port.callback(s->USARTx->DR);
         } else {
-            s->port.rxBuffer[s->port.rxBufferHead] = s->USARTx->DR;
-            s->port.rxBufferHead = (s->port.rxBufferHead + 1) % s->port.rxBufferSize;
+            ringBufferPut(&s->port.rxBuffer, s->USARTx->DR);
         }
     }
     if (SR & USART_FLAG_TXE) {
-        if (s->port.txBufferTail != s->port.txBufferHead) {
-            s->USARTx->DR = s->port.txBuffer[s->port.txBufferTail];
-            s->port.txBufferTail = (s->port.txBufferTail + 1) % s->port.txBufferSize;
+        uint8_t ch;
+        if (ringBufferGet(&s->port.txBuffer, &ch)) {
+            s->USARTx->DR = ch;
         } else {
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
     }
+    if ((SR & USART_FLAG_IDLE) && (s->USARTx->CR1 & USART_CR1_IDLEIE)) {
+        (void)s->USARTx->DR; // reading SR then DR clears the idle flag
+        uartRxFrameIdle(s);
+    }
 }
 
 #ifdef USE_USART1
@@ -86,10 +87,8 @@ uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
     
     s->port.baudRate = baudRate;
     
-    s->port.rxBuffer = rx1Buffer;
-    s->port.txBuffer = tx1Buffer;
-    s->port.rxBufferSize = UART1_RX_BUFFER_SIZE;
-    s->port.txBufferSize = UART1_TX_BUFFER_SIZE;
+    ringBufferInit(&s->port.rxBuffer, rx1Buffer, UART1_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, tx1Buffer, UART1_TX_BUFFER_SIZE);
     
     s->USARTx = USART1;
 
@@ -98,6 +97,7 @@ uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
 
     s->rxDMAChannel = DMA1_Channel5;
     s->txDMAChannel = DMA1_Channel4;
+    s->rxFrameDMAChannel = DMA1_Channel5;
 
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE);
     RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
@@ -121,6 +121,13 @@ uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
     NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStructure);
 
+    // Idle line Interrupt
+    NVIC_InitStructure.NVIC_IRQChannel = USART1_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
     return s;
 }
 
@@ -132,26 +139,27 @@ void DMA1_Channel4_IRQHandler(void)
     DMA_ClearITPendingBit(DMA1_IT_TC4);
     DMA_Cmd(s->txDMAChannel, DISABLE);
 
-    if (s->port.txBufferHead != s->port.txBufferTail)
-        uartStartTxDMA(s);
-    else
-        s->txDMAEmpty = true;
+    uartTxDMAComplete(s);
 }
 
-// USART1 Tx IRQ Handler
+// USART1 Tx and idle line IRQ Handler
 void USART1_IRQHandler(void)
 {
     uartPort_t *s = &uartPort1;
     uint16_t SR = s->USARTx->SR;
 
     if (SR & USART_FLAG_TXE) {
-        if (s->port.txBufferTail != s->port.txBufferHead) {
-            s->USARTx->DR = s->port.txBuffer[s->port.txBufferTail];
-            s->port.txBufferTail = (s->port.txBufferTail + 1) % s->port.txBufferSize;
+        uint8_t ch;
+        if (ringBufferGet(&s->port.txBuffer, &ch)) {
+            s->USARTx->DR = ch;
         } else {
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
     }
+    if ((SR & USART_FLAG_IDLE) && (s->USARTx->CR1 & USART_CR1_IDLEIE)) {
+        (void)s->USARTx->DR; // reading SR then DR clears the idle flag
+        uartRxFrameIdle(s);
+    }
 }
 
 #endif
@@ -171,16 +179,19 @@ uartPort_t *serialUSART2(uint32_t baudRate, portMode_t mode)
     
     s->port.baudRate = baudRate;
     
-    s->port.rxBufferSize = UART2_RX_BUFFER_SIZE;
-    s->port.txBufferSize = UART2_TX_BUFFER_SIZE;
-    s->port.rxBuffer = rx2Buffer;
-    s->port.txBuffer = tx2Buffer;
+    ringBufferInit(&s->port.rxBuffer, rx2Buffer, UART2_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, tx2Buffer, UART2_TX_BUFFER_SIZE);
     
     s->USARTx = USART2;
 
     s->txDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->DR;
     s->rxDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->DR;
 
+#ifndef LED_STRIP
+    // DMA1 channel 6 drives the led strip when it is used
+    s->rxFrameDMAChannel = DMA1_Channel6;
+#endif
+
     RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
     RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
 
@@ -231,22 +242,23 @@ uartPort_t *serialUSART3(uint32_t baudRate, portMode_t mode)
 
     s->port.baudRate = baudRate;
 
-    s->port.rxBuffer = rx3Buffer;
-    s->port.txBuffer = tx3Buffer;
-    s->port.rxBufferSize = UART3_RX_BUFFER_SIZE;
-    s->port.txBufferSize = UART3_TX_BUFFER_SIZE;
+    ringBufferInit(&s->port.rxBuffer, rx3Buffer, UART3_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, tx3Buffer, UART3_TX_BUFFER_SIZE);
 
     s->USARTx = USART3;
 
     s->txDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->DR;
     s->rxDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->DR;
 
+    s->rxFrameDMAChannel = DMA1_Channel3;
+
 #ifdef USART3_APB1_PERIPHERALS
     RCC_APB1PeriphClockCmd(USART3_APB1_PERIPHERALS, ENABLE);
 #endif
 #ifdef USART3_APB2_PERIPHERALS
     RCC_APB2PeriphClockCmd(USART3_APB2_PERIPHERALS, ENABLE);
 #endif
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
 
     gpio.speed = Speed_2MHz;
     gpio.pin = USART3_TX_PIN;
@@ -38,7 +38,7 @@
 // Using RX DMA disables the use of receive callbacks
 #define USE_USART1_RX_DMA
 //#define USE_USART2_RX_DMA
-//#define USE_USART2_TX_DMA
+//#define USE_USART2_TX_DMA    // define in the target.h instead, DShot on TIM4 needs the channel when it is not
 
 #define UART1_TX_PIN GPIO_Pin_9  // PA9
 #define UART1_RX_PIN GPIO_Pin_10 // PA10
@@ -55,8 +55,6 @@
 static uartPort_t uartPort1;
 static uartPort_t uartPort2;
 
-void uartStartTxDMA(uartPort_t *s);
-
 uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
 {
     uartPort_t *s;
@@ -70,15 +68,14 @@ uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
     
     s->port.baudRate = baudRate;
     
-    s->port.rxBuffer = rx1Buffer;
-    s->port.txBuffer = tx1Buffer;
-    s->port.rxBufferSize = UART1_RX_BUFFER_SIZE;
-    s->port.txBufferSize = UART1_TX_BUFFER_SIZE;
+    ringBufferInit(&s->port.rxBuffer, rx1Buffer, UART1_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, tx1Buffer, UART1_TX_BUFFER_SIZE);
     
 #ifdef USE_USART1_RX_DMA
     s->rxDMAChannel = DMA1_Channel5;
 #endif
     s->txDMAChannel = DMA1_Channel4;
+    s->rxFrameDMAChannel = DMA1_Channel5;
 
     s->USARTx = USART1;
 
@@ -112,13 +109,12 @@ uartPort_t *serialUSART1(uint32_t baudRate, portMode_t mode)
     NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStructure);
 
-#ifndef USE_USART1_RX_DMA
+    // RX IRQ or idle line with RX DMA
     NVIC_InitStructure.NVIC_IRQChannel = USART1_IRQn;
     NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
     NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
     NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStructure);
-#endif
 
     return s;
 }
@@ -136,17 +132,16 @@ uartPort_t *serialUSART2(uint32_t baudRate, portMode_t mode)
     
     s->port.baudRate = baudRate;
     
-    s->port.rxBufferSize = UART2_RX_BUFFER_SIZE;
-    s->port.txBufferSize = UART2_TX_BUFFER_SIZE;
-    s->port.rxBuffer = rx2Buffer;
-    s->port.txBuffer = tx2Buffer;
+    ringBufferInit(&s->port.rxBuffer, rx2Buffer, UART2_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, tx2Buffer, UART2_TX_BUFFER_SIZE);
 
     s->USARTx = USART2;
     
 #ifdef USE_USART2_RX_DMA
     s->rxDMAChannel = DMA1_Channel6;
-    s->rxDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->RDR;
 #endif
+    s->rxFrameDMAChannel = DMA1_Channel6;
+    s->rxDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->RDR;
 #ifdef USE_USART2_TX_DMA
     s->txDMAChannel = DMA1_Channel7;
     s->txDMAPeripheralBaseAddr = (uint32_t)&s->USARTx->TDR;
@@ -154,9 +149,7 @@ uartPort_t *serialUSART2(uint32_t baudRate, portMode_t mode)
 
     RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
 
-#if defined(USE_USART2_TX_DMA) || defined(USE_USART2_RX_DMA)
     RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
-#endif
 
     GPIO_InitStructure.GPIO_Mode  = GPIO_Mode_AF;
     GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
@@ -184,13 +177,12 @@ uartPort_t *serialUSART2(uint32_t baudRate, portMode_t mode)
     NVIC_Init(&NVIC_InitStructure);
 #endif
 
-#ifndef USE_USART2_RX_DMA
+    // RX IRQ or idle line with RX DMA
     NVIC_InitStructure.NVIC_IRQChannel = USART2_IRQn;
     NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
     NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
     NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
     NVIC_Init(&NVIC_InitStructure);
-#endif
 
     return s;
 }
@@ -199,10 +191,7 @@ static void handleUsartTxDma(uartPort_t *s)
 {
     DMA_Cmd(s->txDMAChannel, DISABLE);
 
-    if (s->port.txBufferHead != s->port.txBufferTail)
-        uartStartTxDMA(s);
-    else
-        s->txDMAEmpty = true;
+    uartTxDMAComplete(s);
 }
 
 // USART1 Tx DMA Handler
@@ -227,19 +216,19 @@ void usartIrqHandler(uartPort_t *s)
 {
     uint32_t ISR = s->USARTx->ISR;
 
-    if (!s->rxDMAChannel && (ISR & USART_FLAG_RXNE)) {
-        if (s->port.callback) {
+    if (!s->rxDMAChannel && (ISR & USART_FLAG_RXNE) && (s->USARTx->CR1 & USART_CR1_RXNEIE)) {
+        // frames are delivered from the buffer on an idle line, see uartSetRxFrameCallback()
+        if (s->port.callback && !s->rxFrame.callback) {
             s->port.callback(s->USARTx->RDR);
         } else {
-            s->port.rxBuffer[s->port.rxBufferHead] = s->USARTx->RDR;
-            s->port.rxBufferHead = (s->port.rxBufferHead + 1) % s->port.rxBufferSize;
+            ringBufferPut(&s->port.rxBuffer, s->USARTx->RDR);
         }
     }
 
     if (!s->txDMAChannel && (ISR & USART_FLAG_TXE)) {
-        if (s->port.txBufferTail != s->port.txBufferHead) {
-            USART_SendData(s->USARTx, s->port.txBuffer[s->port.txBufferTail]);
-            s->port.txBufferTail = (s->port.txBufferTail + 1) % s->port.txBufferSize;
+        uint8_t ch;
+        if (ringBufferGet(&s->port.txBuffer, &ch)) {
+            USART_SendData(s->USARTx, ch);
         } else {
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
@@ -249,6 +238,11 @@ void usartIrqHandler(uartPort_t *s)
     {
         USART_ClearITPendingBit (s->USARTx, USART_IT_ORE);
     }
+
+    if (ISR & USART_FLAG_IDLE) {
+        USART_ClearITPendingBit(s->USARTx, USART_IT_IDLE);
+        uartRxFrameIdle(s);
+    }
 }
 
 void USART1_IRQHandler(void)
@@ -36,7 +36,25 @@
 
 #define USB_TIMEOUT  50
 
+#define USB_VCP_RX_BUFFER_SIZE 256
+#define USB_VCP_TX_BUFFER_SIZE 256
+
 static vcpPort_t vcpPort;
+static volatile uint8_t vcpRxBuffer[USB_VCP_RX_BUFFER_SIZE];
+static volatile uint8_t vcpTxBuffer[USB_VCP_TX_BUFFER_SIZE];
+
+static bool usbVcpIsReady(void)
+{
+    return usbIsConnected() && usbIsConfigured();
+}
+
+// the IN endpoint interrupt sends the rest of the transmit buffer once a packet is on its way
+static void usbVcpStartTx(void)
+{
+    if (!packetSent) {
+        CDC_Send_Next();
+    }
+}
 
 void usbVcpSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
@@ -50,54 +68,96 @@ void usbVcpSetMode(serialPort_t *instance, portMode_t mode)
 
 bool isUsbVcpTransmitBufferEmpty(serialPort_t *instance)
 {
-    return true;
+    // nothing is sent without a host
+    return !usbVcpIsReady() || ringBufferCount(&instance->txBuffer) == 0;
 }
 
-uint8_t usbVcpAvailable(serialPort_t *instance)
+uint32_t usbVcpAvailable(serialPort_t *instance)
 {
-    return receiveLength & 0xFF; // FIXME use uint32_t return type everywhere
+    return ringBufferCount(&instance->rxBuffer);
 }
 
 uint8_t usbVcpRead(serialPort_t *instance)
 {
-    uint8_t buf[1];
+    uint8_t ch = 0;
 
-    uint32_t rxed = 0;
+    ringBufferGet(&instance->rxBuffer, &ch);
+    CDC_Receive_Next();
 
-    while (rxed < 1) {
-        rxed += CDC_Receive_DATA((uint8_t*)buf + rxed, 1 - rxed);
-    }
+    return ch;
+}
+
+uint32_t usbVcpReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount)
+{
+    uint32_t count = serialBufferRead(instance, data, maxCount);
+
+    CDC_Receive_Next();
 
-    return buf[0];
+    return count;
 }
 
-void usbVcpWrite(serialPort_t *instance, uint8_t c)
+// waits while the transmit buffer is full, gives up when no byte could be buffered for USB_TIMEOUT
+void usbVcpWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count)
 {
-    uint32_t txed;
+    uint16_t written;
     uint32_t start = millis();
 
-    if (!(usbIsConnected() && usbIsConfigured())) {
+    if (!usbVcpIsReady()) {
         return;
     }
 
-    do {
-        txed = CDC_Send_DATA((uint8_t*)&c, 1);
-    } while (txed < 1 && (millis() - start < USB_TIMEOUT));
+    while (count && (millis() - start < USB_TIMEOUT)) {
+        written = ringBufferWrite(&instance->txBuffer, data, count > RING_BUFFER_MAX_SIZE ? RING_BUFFER_MAX_SIZE : count);
+        if (written) {
+            data += written;
+            count -= written;
+            start = millis();
+        }
+        usbVcpStartTx();
+    }
+}
+
+void usbVcpWrite(serialPort_t *instance, uint8_t c)
+{
+    usbVcpWriteBuf(instance, &c, 1);
+}
 
+void usbVcpTxCommit(serialPort_t *instance, uint32_t count)
+{
+    serialBufferTxCommit(instance, count);
+    usbVcpStartTx();
 }
 
-const struct serialPortVTable usbVTable[] = { { usbVcpWrite, usbVcpAvailable, usbVcpRead, usbVcpSetBaudRate, isUsbVcpTransmitBufferEmpty, usbVcpSetMode } };
+const struct serialPortVTable usbVTable[] = {
+    {
+        usbVcpWrite,
+        usbVcpAvailable,
+        usbVcpRead,
+        usbVcpSetBaudRate,
+        isUsbVcpTransmitBufferEmpty,
+        usbVcpSetMode,
+        NULL,
+        usbVcpWriteBuf,
+        usbVcpReadBuf,
+        serialBufferTxReserve,
+        usbVcpTxCommit,
+    }
+};
 
 serialPort_t *usbVcpOpen(void)
 {
     vcpPort_t *s;
 
+    s = &vcpPort;
+    ringBufferInit(&s->port.rxBuffer, vcpRxBuffer, USB_VCP_RX_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, vcpTxBuffer, USB_VCP_TX_BUFFER_SIZE);
+    CDC_Set_Buffers(&s->port.rxBuffer, &s->port.txBuffer);
+
     Set_System();
     Set_USBClock();
     USB_Interrupts_Config();
     USB_Init();
 
-    s = &vcpPort;
     s->port.vTable = usbVTable;
 
     return (serialPort_t *)s;
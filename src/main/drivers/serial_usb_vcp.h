@@ -26,9 +26,11 @@ typedef struct {
 
 serialPort_t *usbVcpOpen(void);
 
-uint8_t usbVcpAvailable(serialPort_t *instance);
+uint32_t usbVcpAvailable(serialPort_t *instance);
 
 uint8_t usbVcpRead(serialPort_t *instance);
 
 void usbVcpWrite(serialPort_t *instance, uint8_t ch);
+uint32_t usbVcpReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount);
+void usbVcpWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count);
 void usbPrintStr(const char *str);
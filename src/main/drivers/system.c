@@ -29,6 +29,11 @@
 
 #include "system.h"
 
+// DWT cycle counter registers, not described by the Cortex-M3 CMSIS headers in lib/main
+#define DWT_CONTROL                 (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCLE_COUNTER           (*(volatile uint32_t *)0xE0001004)
+#define DWT_CONTROL_CYCCNTENA       (1 << 0)
+
 // cycles per microsecond
 static volatile uint32_t usTicks = 0;
 // current uptime for 1kHz systick timer. will rollover after 49 days. hopefully we won't care.
@@ -39,6 +44,22 @@ static void cycleCounterInit(void)
     RCC_ClocksTypeDef clocks;
     RCC_GetClocksFreq(&clocks);
     usTicks = clocks.SYSCLK_Frequency / 1000000;
+
+    // enable the free running core cycle counter, used for execution time profiling
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT_CYCLE_COUNTER = 0;
+    DWT_CONTROL |= DWT_CONTROL_CYCCNTENA;
+}
+
+// Return the core cycle counter, wraps every 2^32 cycles (~59 seconds at 72MHz)
+uint32_t getCycleCounter(void)
+{
+    return DWT_CYCLE_COUNTER;
+}
+
+uint32_t getCycleCounterFrequencyMHz(void)
+{
+    return usTicks;
 }
 
 // SysTick
@@ -24,6 +24,9 @@ void delay(uint32_t ms);
 uint32_t micros(void);
 uint32_t millis(void);
 
+uint32_t getCycleCounter(void);
+uint32_t getCycleCounterFrequencyMHz(void);
+
 // failure
 void failureMode(uint8_t mode);
 
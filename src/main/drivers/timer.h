@@ -32,13 +32,13 @@
 #ifdef STM32F303xC
 typedef uint32_t captureCompare_t;
 #endif
-#ifdef STM32F10X
+#if defined(STM32F10X) || defined(SITL)
 typedef uint16_t captureCompare_t;
 #endif
 
 typedef void timerCCCallbackPtr(uint8_t port, captureCompare_t capture);
 
-typedef struct {
+typedef struct timerHardware_s {
     TIM_TypeDef *tim;
     GPIO_TypeDef *gpio;
     uint32_t pin;
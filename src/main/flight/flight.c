@@ -17,6 +17,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 
 #include <platform.h>
@@ -25,6 +26,7 @@
 
 #include "common/axis.h"
 #include "common/maths.h"
+#include "common/filter.h"
 
 #include "config/runtime_config.h"
 
@@ -39,15 +41,107 @@
 #include "io/gps.h"
 
 extern uint16_t cycleTime;
+extern uint32_t targetPidLooptime;
 
 int16_t heading, magHold;
 int16_t axisPID[3];
 uint8_t dynP8[3], dynI8[3], dynD8[3];
 
-static int32_t errorGyroI[3] = { 0, 0, 0 };
-static float errorGyroIf[3] = { 0.0f, 0.0f, 0.0f };
+typedef enum {
+    PID_CONTROLLER_MULTIWII = 0,
+    PID_CONTROLLER_REWRITE,
+    PID_CONTROLLER_BASEFLIGHT
+} pidControllerType_e;
+
+// where the rate an axis is controlled to comes from
+typedef enum {
+    PID_SETPOINT_RATE = 0,      // the stick commands a rotation rate, ACRO and always on YAW
+    PID_SETPOINT_ANGLE,         // the stick commands an inclination
+    PID_SETPOINT_HORIZON        // the stick commands a rotation rate, the inclination error is mixed in
+} pidSetpoint_e;
+
+typedef struct pidAxisSetpoint_s {
+    uint8_t setpoint;           // pidSetpoint_e
+    bool autotune;              // the inclination error is passed through autotune()
+} pidAxisSetpoint_t;
+
+typedef enum {
+    PID_ROUND_DOWN = 0,         // like >>
+    PID_ROUND_TOWARDS_ZERO,     // like /
+    PID_ROUND_NEAREST           // halves away from zero
+} pidRounding_e;
+
+// value * gain / 2^shift, the product must fit in 63 bits
+typedef struct pidScale_s {
+    int64_t bias;               // added to the product before the shift
+    int64_t negativeBias;       // added as well when the product is negative
+    int32_t gain;
+    uint8_t shift;
+} pidScale_t;
+
+/*
+ * The rate loop of every controller is the same kernel run on a per axis description of its arithmetic. The values
+ * have the fractional bits the controller computes with, none for MultiWii and Rewrite and 24 for Baseflight. Every
+ * step is a pidScale_t, with the rounding chosen so the integer controllers see exactly their >> and /.
+ */
+typedef struct pidRateKernel_s {
+    pidScale_t measurement;         // gyroData to the measured rate
+    pidScale_t P;
+    pidScale_t integratorStep[2];   // rate error to the integrator increment
+    pidScale_t integratorOutput[2]; // integrator to I
+    pidScale_t deltaStep[2];        // change of the D input to the difference that is smoothed, in between the time correction
+    pidScale_t D;
+    pidScale_t blend;               // divides the weighted sum of the level and the rate loop terms
+    pidScale_t output;
+    int64_t integratorStepLimit;    // after integratorStep[0]
+    int64_t integratorLimit;
+    int64_t deltaStepLimit;         // after deltaStep[0]
+    int64_t DLimit;
+    int32_t outputLimit;
+    int32_t integratorResetGyro;    // the integrator is emptied when gyroData or rcCommand go beyond these
+    int32_t integratorResetStick;
+    int8_t pSetpointWeight;         // 0 when P acts on the measured rate only
+    int8_t dSetpointWeight;         // the D input is the weighted sum of setpoint, measured rate and gyroData
+    int8_t dMeasurementWeight;
+    int8_t dGyroWeight;
+} pidRateKernel_t;
+
+// what the controller hands the kernel every loop
+typedef struct pidAxisInput_s {
+    int64_t setpoint;           // in the units of the measured rate
+    int32_t feedForward;        // added to P, weighted like the rate loop terms
+    int32_t levelP;             // the terms of a separate level loop
+    int32_t levelI;
+    int16_t levelWeight;
+    int16_t rateWeight;
+} pidAxisInput_t;
+
+typedef struct pidAxisState_s {
+    int64_t integrator;
+    int64_t lastDInput;
+    int64_t delta1, delta2;
+    biquadFilterFixed_t dtermFilter;
+} pidAxisState_t;
+
+static pidRateKernel_t rateKernels[FLIGHT_DYNAMICS_INDEX_COUNT];
+static pidAxisState_t axisStates[FLIGHT_DYNAMICS_INDEX_COUNT];
+
 static int32_t errorAngleI[2] = { 0, 0 };
 
+static uint8_t dtermFilterCutoff = 0;
+static uint32_t dtermFilterSamplePeriod = 0;
+
+// the filter takes inputs within +-2^30, larger differences are clipped
+#define DTERM_FILTER_INPUT_LIMIT (1 << 30)
+
+static uint8_t pidControllerType = PID_CONTROLLER_MULTIWII;
+
+// the setpoints only change with the flight modes, they are resolved again when the modes or the controller change
+static pidAxisSetpoint_t axisSetpoints[FLIGHT_DYNAMICS_INDEX_COUNT];
+static bool axisSetpointsValid = false;
+static uint16_t setpointFlightModes;
+static uint8_t setpointArmingFlags;
+
 static void pidMultiWii(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
         uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim);
 
@@ -70,17 +164,124 @@ void resetErrorAngle(void)
 
 void resetErrorGyro(void)
 {
-    errorGyroI[ROLL] = 0;
-    errorGyroI[PITCH] = 0;
-    errorGyroI[YAW] = 0;
-
-    errorGyroIf[ROLL] = 0;
-    errorGyroIf[PITCH] = 0;
-    errorGyroIf[YAW] = 0;
+    axisStates[ROLL].integrator = 0;
+    axisStates[PITCH].integrator = 0;
+    axisStates[YAW].integrator = 0;
 }
 
 const angle_index_t rcAliasToAngleIndexMap[] = { AI_ROLL, AI_PITCH };
 
+static int64_t constrain64(int64_t amt, int64_t low, int64_t high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static void pidScaleInit(pidScale_t *scale, int32_t gain, uint8_t shift, pidRounding_e rounding)
+{
+    int64_t lowBits = ((int64_t)1 << shift) - 1;
+
+    scale->gain = gain;
+    scale->shift = shift;
+    scale->bias = 0;
+    scale->negativeBias = 0;
+
+    if (rounding == PID_ROUND_TOWARDS_ZERO) {
+        scale->negativeBias = lowBits;
+    } else if (rounding == PID_ROUND_NEAREST && shift > 0) {
+        scale->bias = (lowBits + 1) / 2;
+        scale->negativeBias = -1;
+    }
+}
+
+// the gain is x / 1 and rounds like the integer arithmetic it replaces when it is not changed
+static void pidScaleInitIdentity(pidScale_t *scale)
+{
+    pidScaleInit(scale, 1, 0, PID_ROUND_DOWN);
+}
+
+/*
+ * Rounded up 2^shift / divisor, multiplying by it and shifting divides exactly as long as value * (reciprocal *
+ * divisor - 2^shift) stays below 2^shift.
+ */
+#define PID_RECIPROCAL(divisor, shift) ((int32_t)((((int64_t)1 << (shift)) + (divisor) - 1) / (divisor)))
+
+/*
+ * A float gain keeps all of its 24 significant bits, fractionBitsAdded is how many more fractional bits the result
+ * has than the value it is applied to.
+ */
+static void pidScaleInitFloat(pidScale_t *scale, float gain, int fractionBitsAdded)
+{
+    int exponent;
+    float mantissa = frexpf(gain, &exponent);  // gain = mantissa * 2^exponent, mantissa within [0.5, 1)
+    int shift = 24 - exponent - fractionBitsAdded;
+
+    if (gain == 0.0f || shift > 62) {
+        pidScaleInit(scale, 0, 0, PID_ROUND_DOWN);
+    } else if (shift < 0) {
+        pidScaleInit(scale, lrintf(ldexpf(mantissa, 24 + shift)), 0, PID_ROUND_NEAREST);
+    } else {
+        pidScaleInit(scale, lrintf(ldexpf(mantissa, 24)), shift, PID_ROUND_NEAREST);
+    }
+}
+
+static uint8_t bitLength(uint32_t value)
+{
+    uint8_t length = 0;
+
+    while (value) {
+        length++;
+        value >>= 1;
+    }
+    return length;
+}
+
+/*
+ * numerator / denominator, the gain is normalised to between 2^(gainBits - 2) and 2^gainBits so it keeps its
+ * precision whatever the loop time is.
+ */
+static void pidScaleInitRatio(pidScale_t *scale, uint32_t numerator, uint32_t denominator, uint8_t gainBits,
+        int fractionBitsAdded)
+{
+    int shift = gainBits + bitLength(denominator) - bitLength(numerator) - 1;
+
+    pidScaleInit(scale, (((uint64_t)numerator << shift) + denominator / 2) / denominator, shift - fractionBitsAdded,
+            PID_ROUND_NEAREST);
+}
+
+static int64_t pidScale(int64_t value, const pidScale_t *scale)
+{
+    int64_t product = value * scale->gain;
+
+    return (product + scale->bias + ((product >> 63) & scale->negativeBias)) >> scale->shift;
+}
+
+/*
+ * Returns true when the D-term low pass filter replaces the moving average, (re)computes the filter coefficients
+ * when the cutoff or the loop time changed.
+ */
+static bool updateDTermFilter(pidProfile_t *pidProfile)
+{
+    int axis;
+
+    if (!pidProfile->dterm_lpf_hz || !targetPidLooptime) {
+        return false;
+    }
+
+    if (dtermFilterCutoff != pidProfile->dterm_lpf_hz || dtermFilterSamplePeriod != targetPidLooptime) {
+        for (axis = 0; axis < 3; axis++) {
+            biquadFilterFixedInitLPF(&axisStates[axis].dtermFilter, pidProfile->dterm_lpf_hz, targetPidLooptime);
+        }
+        dtermFilterCutoff = pidProfile->dterm_lpf_hz;
+        dtermFilterSamplePeriod = targetPidLooptime;
+    }
+    return true;
+}
+
 #ifdef AUTOTUNE
 bool shouldAutotune(void)
 {
@@ -88,259 +289,523 @@ bool shouldAutotune(void)
 }
 #endif
 
+/*
+ * Resolves the setpoint of every axis for the current flight modes. MultiWii lets HORIZON win over ANGLE when both
+ * are active and only autotunes in the modes relying on the accelerometer, the other controllers let ANGLE win.
+ * Returns true when they were resolved again, the controller then specialises its kernels for them.
+ */
+static bool resolveAxisSetpoints(void)
+{
+    bool autotuning = false;
+    uint8_t setpoint;
+    int axis;
+
+    if (axisSetpointsValid && setpointFlightModes == flightModeFlags && setpointArmingFlags == armingFlags) {
+        return false;
+    }
+
+#ifdef AUTOTUNE
+    autotuning = shouldAutotune();
+#endif
+
+    for (axis = FD_ROLL; axis <= FD_PITCH; axis++) {
+        setpoint = PID_SETPOINT_RATE;
+        if (pidControllerType == PID_CONTROLLER_MULTIWII) {
+            if (FLIGHT_MODE(HORIZON_MODE)) {
+                setpoint = PID_SETPOINT_HORIZON;
+            } else if (FLIGHT_MODE(ANGLE_MODE)) {
+                setpoint = PID_SETPOINT_ANGLE;
+            }
+        } else {
+            if (FLIGHT_MODE(ANGLE_MODE)) {
+                setpoint = PID_SETPOINT_ANGLE;
+            } else if (FLIGHT_MODE(HORIZON_MODE)) {
+                setpoint = PID_SETPOINT_HORIZON;
+            }
+        }
+        axisSetpoints[axis].setpoint = setpoint;
+        axisSetpoints[axis].autotune = autotuning &&
+                (pidControllerType != PID_CONTROLLER_MULTIWII || setpoint != PID_SETPOINT_RATE);
+    }
+
+    // YAW is always gyro-controlled (MAG correction is applied to rcCommand)
+    axisSetpoints[FD_YAW].setpoint = PID_SETPOINT_RATE;
+    axisSetpoints[FD_YAW].autotune = false;
+
+    setpointFlightModes = flightModeFlags;
+    setpointArmingFlags = armingFlags;
+    axisSetpointsValid = true;
+    return true;
+}
+
+// the inclination error of a ROLL or PITCH axis in 0.1 degrees, the stick is scaled to the inclination first
+static int32_t getErrorAngle(int axis, int stickScale, uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim)
+{
+    int32_t stick = stickScale * rcCommand[axis];
+
+#ifdef GPS
+    stick += GPS_angle[axis];
+#endif
+
+    return constrain(stick, -((int) max_angle_inclination), +max_angle_inclination)
+            - inclination.raw[axis] + angleTrim->raw[axis]; // 16 bits is ok here
+}
+
+#ifdef AUTOTUNE
+static int32_t autotuneErrorAngle(int axis, int32_t errorAngle)
+{
+    return DEGREES_TO_DECIDEGREES(autotune(rcAliasToAngleIndexMap[axis], &inclination, DECIDEGREES_TO_DEGREES(errorAngle)));
+}
+#endif
+
+/*
+ * Returns the sum of the last three differences of an axis, or three times the low pass filtered difference rounded
+ * to the units of the differences. The D gains of all controllers are tuned against the sum.
+ */
+static int64_t smoothDelta(pidAxisState_t *state, int64_t delta, bool useDTermFilter)
+{
+    int64_t deltaSum;
+
+    if (useDTermFilter) {
+        deltaSum = 3 * biquadFilterFixedApply(&state->dtermFilter,
+                constrain64(delta, -DTERM_FILTER_INPUT_LIMIT, DTERM_FILTER_INPUT_LIMIT));
+        return (deltaSum + (1 << (BIQUAD_FIXED_FRACTION_BITS - 1)) - (deltaSum < 0)) >> BIQUAD_FIXED_FRACTION_BITS;
+    }
+
+    // add moving average here to reduce noise
+    deltaSum = state->delta1 + state->delta2 + delta;
+    state->delta2 = state->delta1;
+    state->delta1 = delta;
+    return deltaSum;
+}
+
+/*
+ * The rate loop shared by all controllers. P, I and D of the rate error are blended with the terms of a level loop
+ * the way MultiWii does it in HORIZON, the other controllers pass only the rate terms.
+ */
+static int16_t pidRateKernel(int axis, const pidAxisInput_t *input, bool useDTermFilter)
+{
+    const pidRateKernel_t *kernel = &rateKernels[axis];
+    pidAxisState_t *state = &axisStates[axis];
+    int64_t measured, error, increment, dInput, delta, deltaSum;
+    int64_t PTerm, ITerm, DTerm;
+
+    measured = pidScale(gyroData[axis], &kernel->measurement);
+    error = input->setpoint - measured;
+
+    // -----calculate P component
+    PTerm = pidScale(kernel->pSetpointWeight * input->setpoint - measured, &kernel->P);
+
+    // -----calculate I component
+    // limit maximum integrator value to prevent WindUp - accumulating extreme values when system is saturated.
+    increment = constrain64(pidScale(error, &kernel->integratorStep[0]),
+            -kernel->integratorStepLimit, kernel->integratorStepLimit);
+    state->integrator = constrain64(state->integrator + pidScale(increment, &kernel->integratorStep[1]),
+            -kernel->integratorLimit, kernel->integratorLimit);
+    if (abs(gyroData[axis]) > kernel->integratorResetGyro || abs(rcCommand[axis]) > kernel->integratorResetStick) {
+        state->integrator = 0;
+    }
+    ITerm = pidScale(pidScale(state->integrator, &kernel->integratorOutput[0]), &kernel->integratorOutput[1]);
+
+    PTerm += pidScale((int64_t)input->levelP * input->levelWeight + (int64_t)input->feedForward * input->rateWeight,
+            &kernel->blend);
+    ITerm = pidScale((int64_t)input->levelI * input->levelWeight + ITerm * input->rateWeight, &kernel->blend);
+
+    //-----calculate D-term
+    dInput = kernel->dSetpointWeight * input->setpoint + kernel->dMeasurementWeight * measured
+            + kernel->dGyroWeight * gyroData[axis];
+    delta = constrain64(pidScale(dInput - state->lastDInput, &kernel->deltaStep[0]),
+            -kernel->deltaStepLimit, kernel->deltaStepLimit);
+    delta = pidScale(delta, &kernel->deltaStep[1]);
+    state->lastDInput = dInput;
+
+    deltaSum = smoothDelta(state, delta, useDTermFilter);
+    DTerm = constrain64(pidScale(deltaSum, &kernel->D), -kernel->DLimit, kernel->DLimit);
+
+    // -----calculate total PID output
+    return constrain64(pidScale(PTerm + ITerm + DTerm, &kernel->output), -kernel->outputLimit, kernel->outputLimit);
+}
+
+// a kernel for the integer controllers, nothing is limited beyond what their 32 bit arithmetic would
+static void initIntegerRateKernel(pidRateKernel_t *kernel)
+{
+    pidScaleInitIdentity(&kernel->measurement);
+    pidScaleInitIdentity(&kernel->P);
+    pidScaleInitIdentity(&kernel->integratorStep[0]);
+    pidScaleInitIdentity(&kernel->integratorStep[1]);
+    pidScaleInitIdentity(&kernel->integratorOutput[0]);
+    pidScaleInitIdentity(&kernel->integratorOutput[1]);
+    pidScaleInitIdentity(&kernel->deltaStep[0]);
+    pidScaleInitIdentity(&kernel->deltaStep[1]);
+    pidScaleInitIdentity(&kernel->D);
+    pidScaleInitIdentity(&kernel->blend);
+    pidScaleInitIdentity(&kernel->output);
+    kernel->integratorStepLimit = INT32_MAX;
+    kernel->integratorLimit = INT32_MAX;
+    kernel->deltaStepLimit = INT32_MAX;
+    kernel->DLimit = INT32_MAX;
+    kernel->outputLimit = INT32_MAX;
+    kernel->integratorResetGyro = INT32_MAX;
+    kernel->integratorResetStick = INT32_MAX;
+    kernel->pSetpointWeight = 1;
+    kernel->dSetpointWeight = 0;
+    kernel->dMeasurementWeight = 0;
+    kernel->dGyroWeight = 0;
+}
+
+static void resetAxisStates(void)
+{
+    memset(axisStates, 0, sizeof(axisStates));
+    dtermFilterCutoff = 0;
+}
+
+/*
+ * The Baseflight controller computes in fixed point, rates and terms are Q24 (1 << 24 is 1 deg/s or one unit of
+ * output). The float gains keep all their bits and are converted when they change. Increments of the integrator
+ * beyond 4096 units per second and changes of the rate beyond 2^22 deg/s/s are clipped, they saturate the terms
+ * anyway.
+ */
+#define Q24_ONE (1 << 24)
+
+typedef struct baseflightGains_s {
+    float P_f[3];
+    float I_f[3];
+    float D_f[3];
+    float A_level;
+    float H_level;
+    float gyroScale;
+} baseflightGains_t;
+
+static baseflightGains_t baseflightGainsConverted;
+static bool baseflightGainsValid = false;
+static pidScale_t baseflightALevel, baseflightHLevel;
+static pidScale_t baseflightStickScale, baseflightAngleScale;
+
+static void initBaseflightKernels(void)
+{
+    pidRateKernel_t *kernel;
+    int axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        kernel = &rateKernels[axis];
+        initIntegerRateKernel(kernel);
+
+        // integratorStep[1] and deltaStep[0] follow the cycle time, the gains are converted when they change.
+        // The integrator sums the Q24 increments times the cycle time in microseconds, it is divided by 1000000 when
+        // it is read so the rounding does not accumulate.
+        pidScaleInit(&kernel->integratorOutput[0], 1, 21, PID_ROUND_NEAREST);
+        pidScaleInit(&kernel->integratorOutput[1], 1125899907, 29, PID_ROUND_NEAREST);     // 2^50 / 1000000
+        // average of three Q20 differences, the D input is the measured rate and the D-term is subtracted
+        pidScaleInit(&kernel->D, -PID_RECIPROCAL(3, 32), 28, PID_ROUND_NEAREST);
+        pidScaleInit(&kernel->output, 1, 24, PID_ROUND_NEAREST);
+        kernel->integratorStepLimit = (int64_t)4096 * Q24_ONE;
+        kernel->integratorLimit = (int64_t)250 * 1000000 * Q24_ONE;
+        kernel->deltaStepLimit = (int64_t)1 << 38;
+        kernel->DLimit = (int64_t)300 * Q24_ONE;
+        kernel->outputLimit = 1000;
+        kernel->dMeasurementWeight = 1;
+    }
+
+    pidScaleInit(&baseflightStickScale, 1374389535, 12, PID_ROUND_NEAREST);    // 2^36 / 50, to Q24
+    pidScaleInit(&baseflightAngleScale, 214748365, 7, PID_ROUND_NEAREST);      // 2^31 / 10, to Q24
+
+    baseflightGainsValid = false;
+}
+
+static void convertBaseflightGains(pidProfile_t *pidProfile)
+{
+    baseflightGains_t gains;
+    pidRateKernel_t *kernel;
+    int axis;
+
+    memcpy(gains.P_f, pidProfile->P_f, sizeof(gains.P_f));
+    memcpy(gains.I_f, pidProfile->I_f, sizeof(gains.I_f));
+    memcpy(gains.D_f, pidProfile->D_f, sizeof(gains.D_f));
+    gains.A_level = pidProfile->A_level;
+    gains.H_level = pidProfile->H_level;
+    gains.gyroScale = gyro.scale;
+
+    if (baseflightGainsValid && memcmp(&gains, &baseflightGainsConverted, sizeof(gains)) == 0) {
+        return;
+    }
+
+    for (axis = 0; axis < 3; axis++) {
+        kernel = &rateKernels[axis];
+        pidScaleInitFloat(&kernel->measurement, gains.gyroScale, 24);
+        pidScaleInitFloat(&kernel->P, gains.P_f[axis], 0);
+        pidScaleInitFloat(&kernel->integratorStep[0], gains.I_f[axis], 0);
+        pidScaleInitFloat(&kernel->deltaStep[1], gains.D_f[axis], 4);           // Q16 deg/s/s to Q20
+    }
+    pidScaleInitFloat(&baseflightALevel, gains.A_level, 0);
+    pidScaleInitFloat(&baseflightHLevel, gains.H_level, 0);
+
+    baseflightGainsConverted = gains;
+    baseflightGainsValid = true;
+}
+
 static void pidBaseflight(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
         uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim)
 {
-    float RateError, errorAngle, AngleRate, gyroRate;
-    float ITerm,PTerm,DTerm;
-    static float lastGyroRate[3];
-    static float delta1[3], delta2[3];
-    float delta, deltaSum;
-    float dT;
+    pidAxisInput_t input;
+    pidScale_t inverseDT;
+    int64_t errorAngle;
     int axis;
+    bool useDTermFilter = updateDTermFilter(pidProfile);
+
+    if (resolveAxisSetpoints()) {
+        initBaseflightKernels();
+    }
+    convertBaseflightGains(pidProfile);
+
+    pidScaleInitRatio(&inverseDT, 1000000, cycleTime, 26, -8);  // Q24 deg/s to Q16 deg/s/s
 
-    dT = (float)cycleTime * 0.000001f;
+    memset(&input, 0, sizeof(input));
+    input.rateWeight = 1;
 
     // ----------PID controller----------
     for (axis = 0; axis < 3; axis++) {
         // -----Get the desired angle rate depending on flight mode
-        if (axis == FD_YAW) {
-            // YAW is always gyro-controlled (MAG correction is applied to rcCommand) 100dps to 1100dps max yaw rate
-            AngleRate = (float)((controlRateConfig->yawRate + 10) * rcCommand[YAW]) / 50.0f;
-         } else {
-            // calculate error and limit the angle to the max inclination
-#ifdef GPS
-            errorAngle = (constrain(rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]) / 10.0f; // 16 bits is ok here
-#else
-            errorAngle = (constrain(rcCommand[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]) / 10.0f; // 16 bits is ok here
-#endif
+        const pidAxisSetpoint_t *setpoint = &axisSetpoints[axis];
 
+        if (axis == FD_YAW) {
+            // 100dps to 1100dps max yaw rate
+            input.setpoint = pidScale((int32_t)(controlRateConfig->yawRate + 10) * rcCommand[YAW], &baseflightStickScale);
+        } else {
+            if (setpoint->setpoint != PID_SETPOINT_RATE || setpoint->autotune) {
+                // calculate error and limit the angle to the max inclination, in degrees
+                errorAngle = pidScale(getErrorAngle(axis, 1, max_angle_inclination, angleTrim), &baseflightAngleScale);
 #ifdef AUTOTUNE
-            if (shouldAutotune()) {
-                errorAngle = autotune(rcAliasToAngleIndexMap[axis], &inclination, errorAngle);
-            }
+                if (setpoint->autotune) {
+                    // Q8 first, Q24 degrees do not fit a long
+                    errorAngle = (int64_t)lrintf(autotune(rcAliasToAngleIndexMap[axis], &inclination,
+                            (float)errorAngle / Q24_ONE) * 256) * 65536;
+                }
 #endif
+            } else {
+                errorAngle = 0;
+            }
 
-            if (FLIGHT_MODE(ANGLE_MODE)) {
+            if (setpoint->setpoint == PID_SETPOINT_ANGLE) {
                 // it's the ANGLE mode - control is angle based, so control loop is needed
-                AngleRate = errorAngle * pidProfile->A_level;
+                input.setpoint = pidScale(errorAngle, &baseflightALevel);
             } else {
                 //control is GYRO based (ACRO and HORIZON - direct sticks control is applied to rate PID
-                AngleRate = (float)((controlRateConfig->rollPitchRate + 20) * rcCommand[axis]) / 50.0f; // 200dps to 1200dps max yaw rate
-                if (FLIGHT_MODE(HORIZON_MODE)) {
+                input.setpoint = pidScale((int32_t)(controlRateConfig->rollPitchRate + 20) * rcCommand[axis],
+                        &baseflightStickScale); // 200dps to 1200dps max yaw rate
+                if (setpoint->setpoint == PID_SETPOINT_HORIZON) {
                     // mix up angle error to desired AngleRate to add a little auto-level feel
-                    AngleRate += errorAngle * pidProfile->H_level;
+                    input.setpoint += pidScale(errorAngle, &baseflightHLevel);
                 }
             }
         }
 
-        gyroRate = gyroData[axis] * gyro.scale; // gyro output scaled to dps
+        // Correct the integration and the difference by cycle time. Cycle time is jittery (can be different 2 times),
+        // so the difference would be scaled by different dt each time. Division by dT fixes that.
+        rateKernels[axis].integratorStep[1].gain = cycleTime;
+        rateKernels[axis].deltaStep[0] = inverseDT;
 
-        // --------low-level gyro-based PID. ----------
-        // Used in stand-alone mode for ACRO, controlled by higher level regulators in other modes
-        // -----calculate scaled error.AngleRates
-        // multiplication of rcCommand corresponds to changing the sticks scaling here
-        RateError = AngleRate - gyroRate;
-
-        // -----calculate P component
-        PTerm = RateError * pidProfile->P_f[axis];
-        // -----calculate I component
-        errorGyroIf[axis] = constrainf(errorGyroIf[axis] + RateError * dT * pidProfile->I_f[axis], -250.0f, 250.0f);
+        axisPID[axis] = pidRateKernel(axis, &input, useDTermFilter);
+    }
+}
 
-        // limit maximum integrator value to prevent WindUp - accumulating extreme values when system is saturated.
-        // I coefficient (I8) moved before integration to make limiting independent from PID settings
-        ITerm = errorGyroIf[axis];
+// MultiWii's gyro P divides by 10 * 8, exactly for |gyroData / 4 * dynP8| below 2^22
+#define MULTIWII_P_SHIFT 28
 
-        //-----calculate D-term
-        delta = gyroRate - lastGyroRate[axis];  // 16 bits is ok here, the dif between 2 consecutive gyro reads is limited to 800
-        lastGyroRate[axis] = gyroRate;
+static void initMultiWiiKernels(void)
+{
+    pidRateKernel_t *kernel;
+    int axis;
 
-        // Correct difference by cycle time. Cycle time is jittery (can be different 2 times), so calculated difference
-        // would be scaled by different dt each time. Division by dT fixes that.
-        delta *= (1.0f / dT);
-        // add moving average here to reduce noise
-        deltaSum = delta1[axis] + delta2[axis] + delta;
-        delta2[axis] = delta1[axis];
-        delta1[axis] = delta;
-        DTerm = constrainf((deltaSum / 3.0f) * pidProfile->D_f[axis], -300.0f, 300.0f);
-
-        // -----calculate total PID output
-        axisPID[axis] = constrain(lrintf(PTerm + ITerm - DTerm), -1000, 1000);
+    for (axis = 0; axis < 3; axis++) {
+        // the gyro loop is not run in ANGLE mode, its integrator keeps its value
+        bool gyroLoop = axisSetpoints[axis].setpoint != PID_SETPOINT_ANGLE;
+
+        kernel = &rateKernels[axis];
+        initIntegerRateKernel(kernel);
+
+        // P, integratorOutput[1] and D follow the gains
+        pidScaleInit(&kernel->measurement, 1, 2, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->P, 0, MULTIWII_P_SHIFT, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->integratorStep[0], gyroLoop ? 1 : 0, 0, PID_ROUND_DOWN);
+        pidScaleInit(&kernel->integratorOutput[0], PID_RECIPROCAL(125, 32), 32, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->integratorOutput[1], 0, 6, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->deltaStep[0], 1, 2, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->D, 0, 5, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->blend, PID_RECIPROCAL(500, 32), 32, PID_ROUND_TOWARDS_ZERO);
+        kernel->integratorLimit = 16000;
+        kernel->integratorResetGyro = gyroLoop ? 640 * 4 : INT32_MAX;
+        kernel->integratorResetStick = gyroLoop && axis == FD_YAW ? 100 : INT32_MAX;
+        kernel->pSetpointWeight = 0;
+        kernel->dGyroWeight = 1;    // the D-term is subtracted, D follows -dynD8
     }
-
 }
 
 static void pidMultiWii(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
         uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim)
 {
     int axis, prop;
-    int32_t error, errorAngle;
-    int32_t PTerm, ITerm, PTermACC = 0, ITermACC = 0, PTermGYRO = 0, ITermGYRO = 0, DTerm;
-    static int16_t lastGyro[3] = { 0, 0, 0 };
-    static int32_t delta1[3], delta2[3];
-    int32_t deltaSum;
-    int32_t delta;
+    int32_t errorAngle;
+    pidAxisInput_t input;
+    bool useDTermFilter = updateDTermFilter(pidProfile);
 
     UNUSED(controlRateConfig);
 
+    if (resolveAxisSetpoints()) {
+        initMultiWiiKernels();
+    }
+
+    memset(&input, 0, sizeof(input));
+
     // **** PITCH & ROLL & YAW PID ****
     prop = max(abs(rcCommand[PITCH]), abs(rcCommand[ROLL])); // range [0;500]
     for (axis = 0; axis < 3; axis++) {
-        if ((FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE)) && (axis == FD_ROLL || axis == FD_PITCH)) { // MODE relying on ACC
+        const pidAxisSetpoint_t *setpoint = &axisSetpoints[axis];
+
+        if (setpoint->setpoint != PID_SETPOINT_RATE) { // MODE relying on ACC
             // observe max inclination
-#ifdef GPS
-            errorAngle = constrain(2 * rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis];
-#else
-            errorAngle = constrain(2 * rcCommand[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis];
-#endif
+            errorAngle = getErrorAngle(axis, 2, max_angle_inclination, angleTrim);
 
 #ifdef AUTOTUNE
-            if (shouldAutotune()) {
-                errorAngle = DEGREES_TO_DECIDEGREES(autotune(rcAliasToAngleIndexMap[axis], &inclination, DECIDEGREES_TO_DEGREES(errorAngle)));
+            if (setpoint->autotune) {
+                errorAngle = autotuneErrorAngle(axis, errorAngle);
             }
 #endif
 
-            PTermACC = errorAngle * pidProfile->P8[PIDLEVEL] / 100; // 32 bits is needed for calculation: errorAngle*P8[PIDLEVEL] could exceed 32768   16 bits is ok for result
-            PTermACC = constrain(PTermACC, -pidProfile->D8[PIDLEVEL] * 5, +pidProfile->D8[PIDLEVEL] * 5);
+            input.levelP = errorAngle * pidProfile->P8[PIDLEVEL] / 100; // 32 bits is needed for calculation: errorAngle*P8[PIDLEVEL] could exceed 32768   16 bits is ok for result
+            input.levelP = constrain(input.levelP, -pidProfile->D8[PIDLEVEL] * 5, +pidProfile->D8[PIDLEVEL] * 5);
 
             errorAngleI[axis] = constrain(errorAngleI[axis] + errorAngle, -10000, +10000); // WindUp
-            ITermACC = (errorAngleI[axis] * pidProfile->I8[PIDLEVEL]) >> 12;
+            input.levelI = (errorAngleI[axis] * pidProfile->I8[PIDLEVEL]) >> 12;
         }
-        if (!FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE) || axis == FD_YAW) { // MODE relying on GYRO or YAW axis
-            error = (int32_t) rcCommand[axis] * 10 * 8 / pidProfile->P8[axis];
-            error -= gyroData[axis] / 4;
-
-            PTermGYRO = rcCommand[axis];
-
-            errorGyroI[axis] = constrain(errorGyroI[axis] + error, -16000, +16000); // WindUp
-            if ((abs(gyroData[axis]) > (640 * 4)) || (axis == FD_YAW && abs(rcCommand[axis]) > 100))
-                errorGyroI[axis] = 0;
-
-            ITermGYRO = (errorGyroI[axis] / 125 * pidProfile->I8[axis]) / 64;
+        if (setpoint->setpoint != PID_SETPOINT_ANGLE) { // MODE relying on GYRO or YAW axis
+            input.setpoint = (int32_t) rcCommand[axis] * 10 * 8 / pidProfile->P8[axis];
+            input.feedForward = rcCommand[axis];
         }
-        if (FLIGHT_MODE(HORIZON_MODE) && (axis == FD_ROLL || axis == FD_PITCH)) {
-            PTerm = (PTermACC * (500 - prop) + PTermGYRO * prop) / 500;
-            ITerm = (ITermACC * (500 - prop) + ITermGYRO * prop) / 500;
-        } else {
-            if (FLIGHT_MODE(ANGLE_MODE) && (axis == FD_ROLL || axis == FD_PITCH)) {
-                PTerm = PTermACC;
-                ITerm = ITermACC;
-            } else {
-                PTerm = PTermGYRO;
-                ITerm = ITermGYRO;
-            }
+        switch (setpoint->setpoint) {
+            case PID_SETPOINT_HORIZON:
+                input.levelWeight = 500 - prop;
+                input.rateWeight = prop;
+                break;
+            case PID_SETPOINT_ANGLE:
+                input.levelWeight = 500;
+                input.rateWeight = 0;
+                break;
+            default:
+                input.levelWeight = 0;
+                input.rateWeight = 500;
+                break;
         }
 
-        PTerm -= ((int32_t)gyroData[axis] / 4) * dynP8[axis] / 10 / 8; // 32 bits is needed for calculation
-        delta = (gyroData[axis] - lastGyro[axis]) / 4;
-        lastGyro[axis] = gyroData[axis];
-        deltaSum = delta1[axis] + delta2[axis] + delta;
-        delta2[axis] = delta1[axis];
-        delta1[axis] = delta;
-        DTerm = (deltaSum * dynD8[axis]) / 32;
-        axisPID[axis] = PTerm + ITerm - DTerm;
+        rateKernels[axis].P.gain = dynP8[axis] * PID_RECIPROCAL(10 * 8, MULTIWII_P_SHIFT);
+        rateKernels[axis].integratorOutput[1].gain = pidProfile->I8[axis];
+        rateKernels[axis].D.gain = -dynD8[axis];
+
+        axisPID[axis] = pidRateKernel(axis, &input, useDTermFilter);
     }
 }
 
 #define GYRO_I_MAX 256
 
+static void initRewriteKernels(void)
+{
+    pidRateKernel_t *kernel;
+    int axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        kernel = &rateKernels[axis];
+        initIntegerRateKernel(kernel);
+
+        // P, integratorStep, deltaStep[0] and D follow the gains and the cycle time
+        pidScaleInit(&kernel->measurement, 1, 2, PID_ROUND_TOWARDS_ZERO);
+        pidScaleInit(&kernel->P, 0, 7, PID_ROUND_DOWN);
+        // Time correction (to avoid different I scaling for different builds based on average cycle time)
+        // is normalized to cycle time = 2048.
+        pidScaleInit(&kernel->integratorStep[0], 0, 11, PID_ROUND_DOWN);
+        pidScaleInit(&kernel->integratorStep[1], 0, 0, PID_ROUND_DOWN);
+        pidScaleInit(&kernel->integratorOutput[0], 1, 13, PID_ROUND_DOWN);
+        pidScaleInit(&kernel->deltaStep[0], 0, 6, PID_ROUND_DOWN);
+        pidScaleInit(&kernel->D, 0, 8, PID_ROUND_DOWN);
+        kernel->integratorLimit = (int32_t) GYRO_I_MAX << 13;
+        kernel->dSetpointWeight = 1;
+        kernel->dMeasurementWeight = -1;   // D on the rate error
+    }
+}
+
 static void pidRewrite(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig, uint16_t max_angle_inclination,
         rollAndPitchTrims_t *angleTrim)
 {
     int32_t errorAngle;
     int axis;
-    int32_t delta, deltaSum;
-    static int32_t delta1[3], delta2[3];
-    int32_t PTerm, ITerm, DTerm;
-    static int32_t lastError[3] = { 0, 0, 0 };
-    int32_t AngleRateTmp, RateError;
+    pidAxisInput_t input;
+    bool useDTermFilter = updateDTermFilter(pidProfile);
+
+    if (resolveAxisSetpoints()) {
+        initRewriteKernels();
+    }
+
+    memset(&input, 0, sizeof(input));
+    input.rateWeight = 1;
 
     // ----------PID controller----------
     for (axis = 0; axis < 3; axis++) {
         // -----Get the desired angle rate depending on flight mode
-        if (axis == FD_YAW) { // YAW is always gyro-controlled (MAG correction is applied to rcCommand)
-            AngleRateTmp = (((int32_t)(controlRateConfig->yawRate + 27) * rcCommand[YAW]) >> 5);
-        } else {
-            // calculate error and limit the angle to max configured inclination
-#ifdef GPS
-            errorAngle = constrain(2 * rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]; // 16 bits is ok here
-#else
-            errorAngle = constrain(2 * rcCommand[axis], -((int) max_angle_inclination),
-                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]; // 16 bits is ok here
-#endif
+        const pidAxisSetpoint_t *setpoint = &axisSetpoints[axis];
 
+        if (axis == FD_YAW) {
+            input.setpoint = (((int32_t)(controlRateConfig->yawRate + 27) * rcCommand[YAW]) >> 5);
+        } else {
+            errorAngle = 0;
+            if (setpoint->setpoint != PID_SETPOINT_RATE || setpoint->autotune) {
+                // calculate error and limit the angle to max configured inclination
+                errorAngle = getErrorAngle(axis, 2, max_angle_inclination, angleTrim);
 #ifdef AUTOTUNE
-            if (shouldAutotune()) {
-                errorAngle = DEGREES_TO_DECIDEGREES(autotune(rcAliasToAngleIndexMap[axis], &inclination, DECIDEGREES_TO_DEGREES(errorAngle)));
-            }
+                if (setpoint->autotune) {
+                    errorAngle = autotuneErrorAngle(axis, errorAngle);
+                }
 #endif
+            }
 
-            if (!FLIGHT_MODE(ANGLE_MODE)) { //control is GYRO based (ACRO and HORIZON - direct sticks control is applied to rate PID
-                AngleRateTmp = ((int32_t)(controlRateConfig->rollPitchRate + 27) * rcCommand[axis]) >> 4;
-                if (FLIGHT_MODE(HORIZON_MODE)) {
+            if (setpoint->setpoint != PID_SETPOINT_ANGLE) { //control is GYRO based (ACRO and HORIZON - direct sticks control is applied to rate PID
+                input.setpoint = ((int32_t)(controlRateConfig->rollPitchRate + 27) * rcCommand[axis]) >> 4;
+                if (setpoint->setpoint == PID_SETPOINT_HORIZON) {
                     // mix up angle error to desired AngleRateTmp to add a little auto-level feel
-                    AngleRateTmp += (errorAngle * pidProfile->I8[PIDLEVEL]) >> 8;
+                    input.setpoint += (errorAngle * pidProfile->I8[PIDLEVEL]) >> 8;
                 }
             } else { // it's the ANGLE mode - control is angle based, so control loop is needed
-                AngleRateTmp = (errorAngle * pidProfile->P8[PIDLEVEL]) >> 4;
+                input.setpoint = (errorAngle * pidProfile->P8[PIDLEVEL]) >> 4;
             }
         }
 
-        // --------low-level gyro-based PID. ----------
-        // Used in stand-alone mode for ACRO, controlled by higher level regulators in other modes
-        // -----calculate scaled error.AngleRates
-        // multiplication of rcCommand corresponds to changing the sticks scaling here
-        RateError = AngleRateTmp - (gyroData[axis] / 4);
-
-        // -----calculate P component
-        PTerm = (RateError * pidProfile->P8[axis]) >> 7;
-        // -----calculate I component
-        // there should be no division before accumulating the error to integrator, because the precision would be reduced.
-        // Precision is critical, as I prevents from long-time drift. Thus, 32 bits integrator is used.
-        // Time correction (to avoid different I scaling for different builds based on average cycle time)
-        // is normalized to cycle time = 2048.
-        errorGyroI[axis] = errorGyroI[axis] + ((RateError * cycleTime) >> 11) * pidProfile->I8[axis];
-
-        // limit maximum integrator value to prevent WindUp - accumulating extreme values when system is saturated.
-        // I coefficient (I8) moved before integration to make limiting independent from PID settings
-        errorGyroI[axis] = constrain(errorGyroI[axis], (int32_t) - GYRO_I_MAX << 13, (int32_t) + GYRO_I_MAX << 13);
-        ITerm = errorGyroI[axis] >> 13;
-
-        //-----calculate D-term
-        delta = RateError - lastError[axis]; // 16 bits is ok here, the dif between 2 consecutive gyro reads is limited to 800
-        lastError[axis] = RateError;
-
+        rateKernels[axis].P.gain = pidProfile->P8[axis];
+        rateKernels[axis].integratorStep[0].gain = cycleTime;
+        rateKernels[axis].integratorStep[1].gain = pidProfile->I8[axis];
         // Correct difference by cycle time. Cycle time is jittery (can be different 2 times), so calculated difference
         // would be scaled by different dt each time. Division by dT fixes that.
-        delta = (delta * ((uint16_t) 0xFFFF / (cycleTime >> 4))) >> 6;
-        // add moving average here to reduce noise
-        deltaSum = delta1[axis] + delta2[axis] + delta;
-        delta2[axis] = delta1[axis];
-        delta1[axis] = delta;
-        DTerm = (deltaSum * pidProfile->D8[axis]) >> 8;
-
-        // -----calculate total PID output
-        axisPID[axis] = PTerm + ITerm + DTerm;
+        rateKernels[axis].deltaStep[0].gain = (uint16_t) 0xFFFF / (cycleTime >> 4);
+        rateKernels[axis].D.gain = pidProfile->D8[axis];
+
+        axisPID[axis] = pidRateKernel(axis, &input, useDTermFilter);
     }
 }
 
 void setPIDController(int type)
 {
     switch (type) {
-        case 0:
+        case PID_CONTROLLER_MULTIWII:
         default:
             pid_controller = pidMultiWii;
+            pidControllerType = PID_CONTROLLER_MULTIWII;
             break;
-        case 1:
+        case PID_CONTROLLER_REWRITE:
             pid_controller = pidRewrite;
+            pidControllerType = PID_CONTROLLER_REWRITE;
             break;
-        case 2:
+        case PID_CONTROLLER_BASEFLIGHT:
             pid_controller = pidBaseflight;
+            pidControllerType = PID_CONTROLLER_BASEFLIGHT;
     }
-}
+    axisSetpointsValid = false;
 
+    // the kernel state is in the units of the controller
+    resetAxisStates();
+}
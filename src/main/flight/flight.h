@@ -42,6 +42,8 @@ typedef struct pidProfile_s {
     float D_f[3];
     float A_level;
     float H_level;
+
+    uint8_t dterm_lpf_hz;                   // D-term biquad low pass cutoff in Hz, 0 = use the 3 sample moving average
 } pidProfile_t;
 
 typedef enum {
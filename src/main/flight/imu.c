@@ -19,13 +19,14 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 
-#include "common/maths.h"
-
 #include <platform.h>
 
+#include "common/maths.h"
 #include "common/axis.h"
+#include "common/filter.h"
 #include "flight/flight.h"
 
 #include "drivers/system.h"
@@ -41,9 +42,11 @@
 #include "config/runtime_config.h"
 
 #include "flight/mixer.h"
+#include "flight/mahony.h"
 #include "flight/imu.h"
 
 extern int16_t debug[4];
+extern uint32_t targetPidLooptime;
 
 int16_t gyroADC[XYZ_AXIS_COUNT], accADC[XYZ_AXIS_COUNT], accSmooth[XYZ_AXIS_COUNT];
 int32_t accSum[XYZ_AXIS_COUNT];
@@ -69,6 +72,13 @@ int32_t altHoldThrottleAdjustment = 0;
 
 float magneticDeclination = 0.0f;       // calculated at startup from config
 float gyroScaleRad;
+static float gyroScaleRadPerSecond;
+
+// body to earth frame rotation of the current attitude, rows are the earth axes in body coordinates
+float rMat[3][3];
+
+static mahonyEstimator_t mahonyEstimator;
+static bool mahonyAligned = false;
 
 // **************
 // gyro+acc IMU
@@ -85,11 +95,37 @@ imuRuntimeConfig_t *imuRuntimeConfig;
 pidProfile_t *pidProfile;
 accDeadband_t *accDeadband;
 
+// roughly the (2 * previous + current) / 3 smoothing tricopters used to get at the default looptime
+#define TRICOPTER_YAW_GYRO_LPF_HZ 23
+
+static pt1Filter_t accFilter[XYZ_AXIS_COUNT];
+static pt1Filter_t triYawGyroFilter;
+static uint32_t imuFilterSamplePeriod = 0;
+static bool imuFilterInitialised = false;
+
 void configureImu(imuRuntimeConfig_t *initialImuRuntimeConfig, pidProfile_t *initialPidProfile, accDeadband_t *initialAccDeadband)
 {
     imuRuntimeConfig = initialImuRuntimeConfig;
     pidProfile = initialPidProfile;
     accDeadband = initialAccDeadband;
+    imuFilterInitialised = false;
+}
+
+static void updateImuFilters(void)
+{
+    int axis;
+
+    if (imuFilterInitialised && imuFilterSamplePeriod == targetPidLooptime) {
+        return;
+    }
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&accFilter[axis], imuRuntimeConfig->acc_lpf_hz, targetPidLooptime);
+    }
+    pt1FilterInit(&triYawGyroFilter, TRICOPTER_YAW_GYRO_LPF_HZ, targetPidLooptime);
+
+    imuFilterSamplePeriod = targetPidLooptime;
+    imuFilterInitialised = true;
 }
 
 void imuInit()
@@ -97,6 +133,9 @@ void imuInit()
     smallAngle = lrintf(acc_1G * cosf(RAD * imuRuntimeConfig->small_angle));
     accVelScale = 9.80665f / acc_1G / 10000.0f;
     gyroScaleRad = gyro.scale * (M_PI / 180.0f) * 0.000001f;
+    gyroScaleRadPerSecond = gyro.scale * (M_PI / 180.0f);
+    mahonyReset(&mahonyEstimator);
+    mahonyAligned = false;
 }
 
 void calculateThrottleAngleScale(uint16_t throttle_correction_angle)
@@ -111,7 +150,7 @@ void calculateAccZLowPassFilterRCTimeConstant(float accz_lpf_cutoff)
 
 void computeIMU(rollAndPitchTrims_t *accelerometerTrims, uint8_t mixerConfiguration)
 {
-    static int16_t gyroYawSmooth = 0;
+    updateImuFilters();
 
     gyroGetADC();
     if (sensors(SENSOR_ACC)) {
@@ -127,8 +166,7 @@ void computeIMU(rollAndPitchTrims_t *accelerometerTrims, uint8_t mixerConfigurat
     gyroData[FD_PITCH] = gyroADC[FD_PITCH];
 
     if (mixerConfiguration == MULTITYPE_TRI) {
-        gyroData[FD_YAW] = (gyroYawSmooth * 2 + gyroADC[FD_YAW]) / 3;
-        gyroYawSmooth = gyroData[FD_YAW];
+        gyroData[FD_YAW] = lrintf(pt1FilterApply(&triYawGyroFilter, gyroADC[FD_YAW]));
     } else {
         gyroData[FD_YAW] = gyroADC[FD_YAW];
     }
@@ -154,13 +192,13 @@ t_fp_vector EstG;
 // Normalize a vector
 void normalizeV(struct fp_vector *src, struct fp_vector *dest)
 {
-    float length;
+    float lengthSquared = src->X * src->X + src->Y * src->Y + src->Z * src->Z;
 
-    length = sqrtf(src->X * src->X + src->Y * src->Y + src->Z * src->Z);
-    if (length != 0) {
-        dest->X = src->X / length;
-        dest->Y = src->Y / length;
-        dest->Z = src->Z / length;
+    if (lengthSquared != 0) {
+        float invLength = invSqrt_approx(lengthSquared);
+        dest->X = src->X * invLength;
+        dest->Y = src->Y * invLength;
+        dest->Z = src->Z * invLength;
     }
 }
 
@@ -174,12 +212,12 @@ void rotateV(struct fp_vector *v, fp_angles_t *delta)
     float cosx, sinx, cosy, siny, cosz, sinz;
     float coszcosx, sinzcosx, coszsinx, sinzsinx;
 
-    cosx = cosf(delta->angles.roll);
-    sinx = sinf(delta->angles.roll);
-    cosy = cosf(delta->angles.pitch);
-    siny = sinf(delta->angles.pitch);
-    cosz = cosf(delta->angles.yaw);
-    sinz = sinf(delta->angles.yaw);
+    cosx = cos_approx(delta->angles.roll);
+    sinx = sin_approx(delta->angles.roll);
+    cosy = cos_approx(delta->angles.pitch);
+    siny = sin_approx(delta->angles.pitch);
+    cosz = cos_approx(delta->angles.yaw);
+    sinz = sin_approx(delta->angles.yaw);
 
     coszcosx = cosz * cosx;
     sinzcosx = sinz * cosx;
@@ -210,28 +248,57 @@ void accSum_reset(void)
     accTimeSum = 0;
 }
 
+// rotation matrix of roll and pitch only, the complementary filter adds yaw once the heading is known
+static void computeTiltRotationMatrix(float roll, float pitch)
+{
+    float cosineRoll = cos_approx(roll);
+    float sineRoll = sin_approx(roll);
+    float cosinePitch = cos_approx(pitch);
+    float sinePitch = sin_approx(pitch);
+
+    rMat[0][0] = cosinePitch;
+    rMat[0][1] = sinePitch * sineRoll;
+    rMat[0][2] = sinePitch * cosineRoll;
+
+    rMat[1][0] = 0.0f;
+    rMat[1][1] = cosineRoll;
+    rMat[1][2] = -sineRoll;
+
+    rMat[2][0] = -sinePitch;
+    rMat[2][1] = cosinePitch * sineRoll;
+    rMat[2][2] = cosinePitch * cosineRoll;
+}
+
+// rotate the earth frame of rMat counter clockwise around its z axis
+static void rotateRotationMatrixAroundZ(float yaw)
+{
+    float cosineYaw = cos_approx(yaw);
+    float sineYaw = sin_approx(yaw);
+    int axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        float x = rMat[0][axis];
+        float y = rMat[1][axis];
+        rMat[0][axis] = cosineYaw * x - sineYaw * y;
+        rMat[1][axis] = sineYaw * x + cosineYaw * y;
+    }
+}
+
 // rotate acc into Earth frame and calculate acceleration in it
 void acc_calc(uint32_t deltaT)
 {
     static int32_t accZoffset = 0;
     static float accz_smooth = 0;
     float dT;
-    fp_angles_t rpy;
     t_fp_vector accel_ned;
 
     // deltaT is measured in us ticks
     dT = (float)deltaT * 1e-6f;
 
     // the accel values have to be rotated into the earth frame
-    rpy.angles.roll = -(float)anglerad[AI_ROLL];
-    rpy.angles.pitch = -(float)anglerad[AI_PITCH];
-    rpy.angles.yaw = -(float)heading * RAD;
-
-    accel_ned.V.X = accSmooth[0];
-    accel_ned.V.Y = accSmooth[1];
-    accel_ned.V.Z = accSmooth[2];
-
-    rotateV(&accel_ned.V, &rpy);
+    accel_ned.V.X = rMat[0][0] * accSmooth[X] + rMat[0][1] * accSmooth[Y] + rMat[0][2] * accSmooth[Z];
+    accel_ned.V.Y = rMat[1][0] * accSmooth[X] + rMat[1][1] * accSmooth[Y] + rMat[1][2] * accSmooth[Z];
+    accel_ned.V.Z = rMat[2][0] * accSmooth[X] + rMat[2][1] * accSmooth[Y] + rMat[2][2] * accSmooth[Z];
 
     if (imuRuntimeConfig->acc_unarmedcal == 1) {
         if (!ARMING_FLAG(ARMED)) {
@@ -254,18 +321,11 @@ void acc_calc(uint32_t deltaT)
     accSumCount++;
 }
 
-// baseflight calculation by Luggi09 originates from arducopter
-static int16_t calculateHeading(t_fp_vector *vec)
+static int16_t headingFromRadians(float headingRad)
 {
     int16_t head;
 
-    float cosineRoll = cosf(anglerad[AI_ROLL]);
-    float sineRoll = sinf(anglerad[AI_ROLL]);
-    float cosinePitch = cosf(anglerad[AI_PITCH]);
-    float sinePitch = sinf(anglerad[AI_PITCH]);
-    float Xh = vec->A[X] * cosinePitch + vec->A[Y] * sineRoll * sinePitch + vec->A[Z] * sinePitch * cosineRoll;
-    float Yh = vec->A[Y] * cosineRoll - vec->A[Z] * sineRoll;
-    float hd = (atan2f(Yh, Xh) * 1800.0f / M_PI + magneticDeclination) / 10.0f;
+    float hd = (headingRad * 1800.0f / M_PI + magneticDeclination) / 10.0f;
     head = lrintf(hd);
     if (head < 0)
         head += 360;
@@ -273,13 +333,78 @@ static int16_t calculateHeading(t_fp_vector *vec)
     return head;
 }
 
+// baseflight calculation by Luggi09 originates from arducopter
+// the vector is rotated into the earth frame with the roll/pitch only rMat, the heading is the angle of its horizontal part
+static int16_t calculateHeading(t_fp_vector *vec)
+{
+    float Xh = rMat[0][0] * vec->A[X] + rMat[0][1] * vec->A[Y] + rMat[0][2] * vec->A[Z];
+    float Yh = rMat[1][0] * vec->A[X] + rMat[1][1] * vec->A[Y] + rMat[1][2] * vec->A[Z];
+
+    return headingFromRadians(atan2_approx(Yh, Xh));
+}
+
+static void updateSmallAngleState(void)
+{
+    if (EstG.A[Z] > smallAngle) {
+        ENABLE_STATE(SMALL_ANGLE);
+    } else {
+        DISABLE_STATE(SMALL_ANGLE);
+    }
+}
+
+static void updateInclination(void)
+{
+    inclination.values.rollDeciDegrees = lrintf(anglerad[AI_ROLL] * (1800.0f / M_PI));
+    inclination.values.pitchDeciDegrees = lrintf(anglerad[AI_PITCH] * (1800.0f / M_PI));
+}
+
+/*
+ * Quaternion alternative to the complementary filter, the attitude is integrated without any trigonometry and
+ * the euler angles are only extracted for the rest of the code. rMat comes straight from the quaternion.
+ */
+static void getEstimatedAttitudeQuaternion(uint32_t deltaT, int32_t accMag)
+{
+    float gyroRate[XYZ_AXIS_COUNT];
+    float acc[XYZ_AXIS_COUNT];
+    float mag[XYZ_AXIS_COUNT];
+    bool useAcc = 72 < (uint16_t)accMag && (uint16_t)accMag < 133;
+    bool useMag = sensors(SENSOR_MAG);
+    int axis;
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroRate[axis] = gyroADC[axis] * gyroScaleRadPerSecond;
+        acc[axis] = accSmooth[axis];
+        mag[axis] = magADC[axis];
+    }
+
+    if (!mahonyAligned && useAcc) {
+        mahonyAlignToAccelerometer(&mahonyEstimator, acc);
+        mahonyAligned = true;
+    } else {
+        mahonyUpdate(&mahonyEstimator, deltaT * 1e-6f, imuRuntimeConfig->dcm_kp, imuRuntimeConfig->dcm_ki, gyroRate,
+                useAcc ? acc : NULL, useMag ? mag : NULL);
+    }
+
+    memcpy(rMat, mahonyEstimator.rMat, sizeof(rMat));
+
+    // keep the estimated gravity vector up to date for the small angle and throttle angle correction
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EstG.A[axis] = rMat[2][axis] * acc_1G;
+    }
+
+    anglerad[AI_ROLL] = mahonyGetRoll(&mahonyEstimator);
+    anglerad[AI_PITCH] = mahonyGetPitch(&mahonyEstimator);
+
+    // yaw is counter clockwise, heading is clockwise
+    heading = headingFromRadians(-mahonyGetYaw(&mahonyEstimator));
+}
+
 static void getEstimatedAttitude(void)
 {
     int32_t axis;
     int32_t accMag = 0;
     static t_fp_vector EstM;
     static t_fp_vector EstN = { .A = { 1.0f, 0.0f, 0.0f } };
-    static float accLPF[3];
     static uint32_t previousT;
     uint32_t currentT = micros();
     uint32_t deltaT;
@@ -292,9 +417,8 @@ static void getEstimatedAttitude(void)
     // Initialization
     for (axis = 0; axis < 3; axis++) {
         deltaGyroAngle.raw[axis] = gyroADC[axis] * scale;
-        if (imuRuntimeConfig->acc_lpf_factor > 0) {
-            accLPF[axis] = accLPF[axis] * (1.0f - (1.0f / imuRuntimeConfig->acc_lpf_factor)) + accADC[axis] * (1.0f / imuRuntimeConfig->acc_lpf_factor);
-            accSmooth[axis] = accLPF[axis];
+        if (imuRuntimeConfig->acc_lpf_hz > 0) {
+            accSmooth[axis] = lrintf(pt1FilterApply(&accFilter[axis], accADC[axis]));
         } else {
             accSmooth[axis] = accADC[axis];
         }
@@ -302,6 +426,14 @@ static void getEstimatedAttitude(void)
     }
     accMag = accMag * 100 / ((int32_t)acc_1G * acc_1G);
 
+    if (imuRuntimeConfig->attitude_estimator == ATTITUDE_ESTIMATOR_QUATERNION) {
+        getEstimatedAttitudeQuaternion(deltaT, accMag);
+        updateSmallAngleState();
+        updateInclination();
+        acc_calc(deltaT);
+        return;
+    }
+
     rotateV(&EstG.V, &deltaGyroAngle);
 
     // Apply complimentary filter (Gyro drift correction)
@@ -315,17 +447,14 @@ static void getEstimatedAttitude(void)
             EstG.A[axis] = (EstG.A[axis] * imuRuntimeConfig->gyro_cmpf_factor + accSmooth[axis]) * invGyroComplimentaryFilterFactor;
     }
 
-    if (EstG.A[Z] > smallAngle) {
-        ENABLE_STATE(SMALL_ANGLE);
-    } else {
-        DISABLE_STATE(SMALL_ANGLE);
-    }
+    updateSmallAngleState();
 
     // Attitude of the estimated vector
-    anglerad[AI_ROLL] = atan2f(EstG.V.Y, EstG.V.Z);
-    anglerad[AI_PITCH] = atan2f(-EstG.V.X, sqrtf(EstG.V.Y * EstG.V.Y + EstG.V.Z * EstG.V.Z));
-    inclination.values.rollDeciDegrees = lrintf(anglerad[AI_ROLL] * (1800.0f / M_PI));
-    inclination.values.pitchDeciDegrees = lrintf(anglerad[AI_PITCH] * (1800.0f / M_PI));
+    anglerad[AI_ROLL] = atan2_approx(EstG.V.Y, EstG.V.Z);
+    anglerad[AI_PITCH] = atan2_approx(-EstG.V.X, sqrtf(EstG.V.Y * EstG.V.Y + EstG.V.Z * EstG.V.Z));
+    updateInclination();
+
+    computeTiltRotationMatrix(anglerad[AI_ROLL], anglerad[AI_PITCH]);
 
     if (sensors(SENSOR_MAG)) {
         rotateV(&EstM.V, &deltaGyroAngle);
@@ -341,19 +470,21 @@ static void getEstimatedAttitude(void)
         heading = calculateHeading(&EstN);
     }
 
+    rotateRotationMatrixAroundZ(-(float)heading * RAD);
+
     acc_calc(deltaT); // rotate acc vector into earth frame
 }
 
 // correction of throttle in lateral wind,
 int16_t calculateThrottleAngleCorrection(uint8_t throttle_correction_value)
 {
-    float cosZ = EstG.V.Z / sqrtf(EstG.V.X * EstG.V.X + EstG.V.Y * EstG.V.Y + EstG.V.Z * EstG.V.Z);
+    float cosZ = EstG.V.Z * invSqrt_approx(EstG.V.X * EstG.V.X + EstG.V.Y * EstG.V.Y + EstG.V.Z * EstG.V.Z);
 
     if (cosZ <= 0.015f) { // we are inverted, vertical or with a small angle < 0.86 deg
         return 0;
     }
-    int angle = lrintf(acosf(cosZ) * throttleAngleScale);
+    int angle = lrintf(acos_approx(cosZ) * throttleAngleScale);
     if (angle > 900)
         angle = 900;
-    return lrintf(throttle_correction_value * sinf(angle / (900.0f * M_PI / 2.0f)));
+    return lrintf(throttle_correction_value * sin_approx(angle / (900.0f * M_PI / 2.0f)));
 }
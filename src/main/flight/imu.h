@@ -26,11 +26,20 @@ extern uint32_t accTimeSum;
 extern int accSumCount;
 extern float accVelScale;
 
+typedef enum {
+    ATTITUDE_ESTIMATOR_COMPLEMENTARY = 0,
+    ATTITUDE_ESTIMATOR_QUATERNION,
+    ATTITUDE_ESTIMATOR_COUNT
+} attitudeEstimator_e;
+
 typedef struct imuRuntimeConfig_s {
-    uint8_t acc_lpf_factor;
+    uint8_t acc_lpf_hz;
     uint8_t acc_unarmedcal;
     float gyro_cmpf_factor;
     float gyro_cmpfm_factor;
+    uint8_t attitude_estimator;
+    float dcm_kp;
+    float dcm_ki;
     int8_t small_angle;
 } imuRuntimeConfig_t;
 
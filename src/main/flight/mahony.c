@@ -0,0 +1,187 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+
+#include "flight/mahony.h"
+
+static void mahonyComputeRotationMatrix(mahonyEstimator_t *estimator)
+{
+    float q1q1 = estimator->q1 * estimator->q1;
+    float q2q2 = estimator->q2 * estimator->q2;
+    float q3q3 = estimator->q3 * estimator->q3;
+
+    float q0q1 = estimator->q0 * estimator->q1;
+    float q0q2 = estimator->q0 * estimator->q2;
+    float q0q3 = estimator->q0 * estimator->q3;
+    float q1q2 = estimator->q1 * estimator->q2;
+    float q1q3 = estimator->q1 * estimator->q3;
+    float q2q3 = estimator->q2 * estimator->q3;
+
+    estimator->rMat[0][0] = 1.0f - 2.0f * q2q2 - 2.0f * q3q3;
+    estimator->rMat[0][1] = 2.0f * (q1q2 - q0q3);
+    estimator->rMat[0][2] = 2.0f * (q1q3 + q0q2);
+
+    estimator->rMat[1][0] = 2.0f * (q1q2 + q0q3);
+    estimator->rMat[1][1] = 1.0f - 2.0f * q1q1 - 2.0f * q3q3;
+    estimator->rMat[1][2] = 2.0f * (q2q3 - q0q1);
+
+    estimator->rMat[2][0] = 2.0f * (q1q3 - q0q2);
+    estimator->rMat[2][1] = 2.0f * (q2q3 + q0q1);
+    estimator->rMat[2][2] = 1.0f - 2.0f * q1q1 - 2.0f * q2q2;
+}
+
+void mahonyReset(mahonyEstimator_t *estimator)
+{
+    estimator->q0 = 1.0f;
+    estimator->q1 = 0.0f;
+    estimator->q2 = 0.0f;
+    estimator->q3 = 0.0f;
+
+    estimator->integralX = 0.0f;
+    estimator->integralY = 0.0f;
+    estimator->integralZ = 0.0f;
+
+    mahonyComputeRotationMatrix(estimator);
+}
+
+/*
+ * Starts from the roll and pitch the accelerometer measures instead of waiting for the drift correction to
+ * converge from level, which could take a long time when starting out close to upside down.
+ */
+void mahonyAlignToAccelerometer(mahonyEstimator_t *estimator, const float *acc)
+{
+    float halfRoll = 0.5f * atan2f(acc[Y], acc[Z]);
+    float halfPitch = 0.5f * atan2f(-acc[X], sqrtf(acc[Y] * acc[Y] + acc[Z] * acc[Z]));
+    float cosineRoll = cosf(halfRoll);
+    float sineRoll = sinf(halfRoll);
+    float cosinePitch = cosf(halfPitch);
+    float sinePitch = sinf(halfPitch);
+
+    mahonyReset(estimator);
+
+    // yaw stays zero
+    estimator->q0 = cosineRoll * cosinePitch;
+    estimator->q1 = sineRoll * cosinePitch;
+    estimator->q2 = cosineRoll * sinePitch;
+    estimator->q3 = -sineRoll * sinePitch;
+
+    mahonyComputeRotationMatrix(estimator);
+}
+
+void mahonyUpdate(mahonyEstimator_t *estimator, float dT, float kp, float ki, const float *gyro, const float *acc, const float *mag)
+{
+    float gx = gyro[X];
+    float gy = gyro[Y];
+    float gz = gyro[Z];
+    float ex = 0.0f, ey = 0.0f, ez = 0.0f;
+    float recipNorm;
+    bool haveCorrection = false;
+
+    // the magnetometer only corrects yaw: rotate it into the earth frame, the error is the angle between
+    // its horizontal part and the earth x axis (magnetic north), rotated back into the body frame
+    if (mag && (mag[X] != 0.0f || mag[Y] != 0.0f || mag[Z] != 0.0f)) {
+        float hx = estimator->rMat[0][0] * mag[X] + estimator->rMat[0][1] * mag[Y] + estimator->rMat[0][2] * mag[Z];
+        float hy = estimator->rMat[1][0] * mag[X] + estimator->rMat[1][1] * mag[Y] + estimator->rMat[1][2] * mag[Z];
+        float bxSquared = hx * hx + hy * hy;
+
+        if (bxSquared > 0.0f) {
+            float ezEarth = -hy * invSqrt_approx(bxSquared);
+
+            ex += estimator->rMat[2][0] * ezEarth;
+            ey += estimator->rMat[2][1] * ezEarth;
+            ez += estimator->rMat[2][2] * ezEarth;
+            haveCorrection = true;
+        }
+    }
+
+    // the accelerometer corrects roll and pitch: the error is the cross product of the measured and the estimated
+    // direction of gravity, the estimated direction is the earth z axis in body coordinates
+    if (acc && (acc[X] != 0.0f || acc[Y] != 0.0f || acc[Z] != 0.0f)) {
+        recipNorm = invSqrt_approx(acc[X] * acc[X] + acc[Y] * acc[Y] + acc[Z] * acc[Z]);
+        float ax = acc[X] * recipNorm;
+        float ay = acc[Y] * recipNorm;
+        float az = acc[Z] * recipNorm;
+
+        ex += (ay * estimator->rMat[2][2] - az * estimator->rMat[2][1]);
+        ey += (az * estimator->rMat[2][0] - ax * estimator->rMat[2][2]);
+        ez += (ax * estimator->rMat[2][1] - ay * estimator->rMat[2][0]);
+        haveCorrection = true;
+    }
+
+    if (haveCorrection) {
+        // the integral converges on the gyro bias
+        if (ki > 0.0f) {
+            estimator->integralX += ki * ex * dT;
+            estimator->integralY += ki * ey * dT;
+            estimator->integralZ += ki * ez * dT;
+        }
+
+        gx += kp * ex;
+        gy += kp * ey;
+        gz += kp * ez;
+    }
+
+    gx += estimator->integralX;
+    gy += estimator->integralY;
+    gz += estimator->integralZ;
+
+    // integrate the rate of change of the quaternion, q' = 0.5 * q * omega
+    gx *= 0.5f * dT;
+    gy *= 0.5f * dT;
+    gz *= 0.5f * dT;
+
+    float qa = estimator->q0;
+    float qb = estimator->q1;
+    float qc = estimator->q2;
+    estimator->q0 += (-qb * gx - qc * gy - estimator->q3 * gz);
+    estimator->q1 += (qa * gx + qc * gz - estimator->q3 * gy);
+    estimator->q2 += (qa * gy - qb * gz + estimator->q3 * gx);
+    estimator->q3 += (qa * gz + qb * gy - qc * gx);
+
+    recipNorm = invSqrt_approx(estimator->q0 * estimator->q0 + estimator->q1 * estimator->q1 + estimator->q2 * estimator->q2 + estimator->q3 * estimator->q3);
+    estimator->q0 *= recipNorm;
+    estimator->q1 *= recipNorm;
+    estimator->q2 *= recipNorm;
+    estimator->q3 *= recipNorm;
+
+    mahonyComputeRotationMatrix(estimator);
+}
+
+float mahonyGetRoll(const mahonyEstimator_t *estimator)
+{
+    return atan2_approx(estimator->rMat[2][1], estimator->rMat[2][2]);
+}
+
+float mahonyGetPitch(const mahonyEstimator_t *estimator)
+{
+    return atan2_approx(-estimator->rMat[2][0], sqrtf(estimator->rMat[2][1] * estimator->rMat[2][1] + estimator->rMat[2][2] * estimator->rMat[2][2]));
+}
+
+// counter clockwise around the earth z axis, zero is the earth x axis
+float mahonyGetYaw(const mahonyEstimator_t *estimator)
+{
+    return atan2_approx(estimator->rMat[1][0], estimator->rMat[0][0]);
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Mahony style attitude estimator, the attitude is kept as a quaternion that rotates the body frame into the earth frame
+typedef struct mahonyEstimator_s {
+    float q0, q1, q2, q3;
+    float integralX, integralY, integralZ;  // gyro bias correction in rad/s
+    float rMat[3][3];                       // rotation matrix of the quaternion, rows are the earth axes in body coordinates
+} mahonyEstimator_t;
+
+void mahonyReset(mahonyEstimator_t *estimator);
+void mahonyAlignToAccelerometer(mahonyEstimator_t *estimator, const float *acc);
+/*
+ * gyro is in rad/s, acc and mag are in any unit and can be NULL when the sample should not be used for correction.
+ * kp and ki are the proportional and integral gains of the drift correction.
+ */
+void mahonyUpdate(mahonyEstimator_t *estimator, float dT, float kp, float ki, const float *gyro, const float *acc, const float *mag);
+
+float mahonyGetRoll(const mahonyEstimator_t *estimator);
+float mahonyGetPitch(const mahonyEstimator_t *estimator);
+float mahonyGetYaw(const mahonyEstimator_t *estimator);
@@ -18,14 +18,14 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
 
 #include "platform.h"
 
 #include "common/axis.h"
 #include "common/maths.h"
 
-#include "drivers/gpio.h"
-#include "drivers/timer.h"
 #include "drivers/pwm_output.h"
 #include "drivers/pwm_mapping.h"
 
@@ -59,9 +59,21 @@ static airplaneConfig_t *airplaneConfig;
 static rxConfig_t *rxConfig;
 static gimbalConfig_t *gimbalConfig;
 
-static motorMixer_t currentMixer[MAX_SUPPORTED_MOTORS];
+// the weights of the current mixer as integers, 1 << MIXER_WEIGHT_SHIFT is a weight of 1.0
+#define MIXER_WEIGHT_SHIFT 12
+
+typedef struct motorMixWeights_s {
+    int32_t throttle;
+    int32_t roll;
+    int32_t pitch;
+    int32_t yaw;
+} motorMixWeights_t;
+
+static motorMixWeights_t motorMixWeights[MAX_SUPPORTED_MOTORS];
 static MultiType currentMixerConfiguration;
 
+static mixerSaturation_t mixerSaturation;
+
 static const motorMixer_t mixerTri[] = {
     { 1.0f,  0.0f,  1.333333f,  0.0f },     // REAR
     { 1.0f, -1.0f, -0.666667f,  0.0f },     // RIGHT
@@ -258,6 +270,19 @@ void mixerInit(MultiType mixerConfiguration, motorMixer_t *initialCustomMixers)
         useServo = 1;
 }
 
+static int32_t mixerWeight(float weight)
+{
+    return lrintf(weight * (1 << MIXER_WEIGHT_SHIFT));
+}
+
+static void loadMotorMixWeights(uint8_t index, const motorMixer_t *motorMixer)
+{
+    motorMixWeights[index].throttle = mixerWeight(motorMixer->throttle);
+    motorMixWeights[index].roll = mixerWeight(motorMixer->roll);
+    motorMixWeights[index].pitch = mixerWeight(motorMixer->pitch);
+    motorMixWeights[index].yaw = mixerWeight(motorMixer->yaw);
+}
+
 void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfiguration)
 {
     int i;
@@ -265,12 +290,13 @@ void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfigura
     servoCount = pwmOutputConfiguration->servoCount;
 
     if (currentMixerConfiguration == MULTITYPE_CUSTOM) {
-        // load custom mixer into currentMixer
+        // load custom mixer into the weights
+        numberMotor = 0;
         for (i = 0; i < MAX_SUPPORTED_MOTORS; i++) {
             // check if done
             if (customMixers[i].throttle == 0.0f)
                 break;
-            currentMixer[i] = customMixers[i];
+            loadMotorMixWeights(numberMotor, &customMixers[i]);
             numberMotor++;
         }
     } else {
@@ -278,7 +304,7 @@ void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfigura
         // copy motor-based mixers
         if (mixers[currentMixerConfiguration].motor) {
             for (i = 0; i < numberMotor; i++)
-                currentMixer[i] = mixers[currentMixerConfiguration].motor[i];
+                loadMotorMixWeights(i, &mixers[currentMixerConfiguration].motor[i]);
         }
     }
 
@@ -286,9 +312,9 @@ void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfigura
     if (feature(FEATURE_3D)) {
         if (numberMotor > 1) {
             for (i = 0; i < numberMotor; i++) {
-                currentMixer[i].pitch *= 0.5f;
-                currentMixer[i].roll *= 0.5f;
-                currentMixer[i].yaw *= 0.5f;
+                motorMixWeights[i].pitch /= 2;
+                motorMixWeights[i].roll /= 2;
+                motorMixWeights[i].yaw /= 2;
             }
         }
     }
@@ -395,6 +421,11 @@ void writeMotors(void)
 
     for (i = 0; i < numberMotor; i++)
         pwmWriteMotor(i, motor[i]);
+
+    // oneshot and DShot ESCs get the pulses now, right after mixTable(), instead of on the next PWM period
+    if (feature(FEATURE_ONESHOT125) || feature(FEATURE_DSHOT)) {
+        pwmCompleteMotorUpdate(numberMotor);
+    }
 }
 
 void writeAllMotors(int16_t mc)
@@ -453,10 +484,87 @@ static void airplaneMixer(void)
     }
 }
 
+// the range the motors are driven in while armed, it depends on the direction in 3D mode
+static void getMotorOutputRange(int16_t *outputMin, int16_t *outputMax)
+{
+    if (feature(FEATURE_3D)) {
+        if ((rcData[THROTTLE]) > rxConfig->midrc) {
+            *outputMin = flight3DConfig->deadband3d_high;
+            *outputMax = escAndServoConfig->maxthrottle;
+        } else {
+            *outputMin = escAndServoConfig->mincommand;
+            *outputMax = flight3DConfig->deadband3d_low;
+        }
+    } else {
+        *outputMin = escAndServoConfig->minthrottle;
+        *outputMax = escAndServoConfig->maxthrottle;
+    }
+}
+
+/*
+ * Mixes the throttle and the PID corrections into the motors so that all of them stay within the output range. When
+ * the corrections alone span more than the range they are scaled down to fit, then all motors are moved down or up
+ * together until none is beyond either end, so the corrections keep their full effect at low and high throttle
+ * instead of being cut off by the limits.
+ */
+static void mixMotors(int16_t outputMin, int16_t outputMax)
+{
+    int32_t pidMix[MAX_SUPPORTED_MOTORS];
+    int32_t pidMixMin = 0, pidMixMax = 0;
+    int32_t mixMin = 0, mixMax = 0;
+    int32_t outputRange = outputMax - outputMin;
+    int32_t yaw = -mixerConfig->yaw_direction * axisPID[YAW];
+    int32_t offset = 0;
+    uint32_t i;
+
+    mixerSaturation.mixCount++;
+
+    for (i = 0; i < numberMotor; i++) {
+        pidMix[i] = (axisPID[PITCH] * motorMixWeights[i].pitch + axisPID[ROLL] * motorMixWeights[i].roll
+                + yaw * motorMixWeights[i].yaw + (1 << (MIXER_WEIGHT_SHIFT - 1))) >> MIXER_WEIGHT_SHIFT;
+        if (i == 0 || pidMix[i] < pidMixMin)
+            pidMixMin = pidMix[i];
+        if (i == 0 || pidMix[i] > pidMixMax)
+            pidMixMax = pidMix[i];
+    }
+
+    if (pidMixMax - pidMixMin > outputRange) {
+        for (i = 0; i < numberMotor; i++)
+            pidMix[i] = pidMix[i] * outputRange / (pidMixMax - pidMixMin);
+        mixerSaturation.pidScaledCount++;
+    }
+
+    for (i = 0; i < numberMotor; i++) {
+        motor[i] = ((rcCommand[THROTTLE] * motorMixWeights[i].throttle + (1 << (MIXER_WEIGHT_SHIFT - 1))) >> MIXER_WEIGHT_SHIFT)
+                + pidMix[i];
+        if (i == 0 || motor[i] < mixMin)
+            mixMin = motor[i];
+        if (i == 0 || motor[i] > mixMax)
+            mixMax = motor[i];
+    }
+
+    if (mixMax > outputMax) {
+        offset = outputMax - mixMax;
+        mixerSaturation.loweredCount++;
+    } else if (mixMin < outputMin) {
+        offset = outputMin - mixMin;
+        mixerSaturation.raisedCount++;
+    }
+
+    if (offset) {
+        for (i = 0; i < numberMotor; i++)
+            motor[i] += offset;
+    }
+}
+
 void mixTable(void)
 {
-    int16_t maxMotor;
+    int16_t outputMin, outputMax;
     uint32_t i;
+    // the motors are not mixed when they are stopped or idle below the throttle check anyway
+    bool motorsMixed = ARMING_FLAG(ARMED) && (feature(FEATURE_3D) || rcData[THROTTLE] >= rxConfig->mincheck);
+
+    getMotorOutputRange(&outputMin, &outputMax);
 
     if (numberMotor > 3) {
         // prevent "yaw jump" during yaw correction
@@ -464,9 +572,8 @@ void mixTable(void)
     }
 
     // motors for non-servo mixes
-    if (numberMotor > 1)
-        for (i = 0; i < numberMotor; i++)
-            motor[i] = rcCommand[THROTTLE] * currentMixer[i].throttle + axisPID[PITCH] * currentMixer[i].pitch + axisPID[ROLL] * currentMixer[i].roll + -mixerConfig->yaw_direction * axisPID[YAW] * currentMixer[i].yaw;
+    if (numberMotor > 1 && motorsMixed)
+        mixMotors(outputMin, outputMax);
 
     // airplane / servo mixes
     switch (currentMixerConfiguration) {
@@ -565,27 +672,13 @@ void mixTable(void)
         }
     }
 
-    maxMotor = motor[0];
-    for (i = 1; i < numberMotor; i++)
-        if (motor[i] > maxMotor)
-            maxMotor = motor[i];
     for (i = 0; i < numberMotor; i++) {
-        if (maxMotor > escAndServoConfig->maxthrottle)     // this is a way to still have good gyro corrections if at least one motor reaches its max.
-            motor[i] -= maxMotor - escAndServoConfig->maxthrottle;
-        if (feature(FEATURE_3D)) {
-            if ((rcData[THROTTLE]) > rxConfig->midrc) {
-                motor[i] = constrain(motor[i], flight3DConfig->deadband3d_high, escAndServoConfig->maxthrottle);
-            } else {
-                motor[i] = constrain(motor[i], escAndServoConfig->mincommand, flight3DConfig->deadband3d_low);
-            }
-        } else {
-            motor[i] = constrain(motor[i], escAndServoConfig->minthrottle, escAndServoConfig->maxthrottle);
-            if ((rcData[THROTTLE]) < rxConfig->mincheck) {
-                if (!feature(FEATURE_MOTOR_STOP))
-                    motor[i] = escAndServoConfig->minthrottle;
-                else
-                    motor[i] = escAndServoConfig->mincommand;
-            }
+        motor[i] = constrain(motor[i], outputMin, outputMax);
+        if (!feature(FEATURE_3D) && (rcData[THROTTLE]) < rxConfig->mincheck) {
+            if (!feature(FEATURE_MOTOR_STOP))
+                motor[i] = escAndServoConfig->minthrottle;
+            else
+                motor[i] = escAndServoConfig->mincommand;
         }
         if (!ARMING_FLAG(ARMED)) {
             motor[i] = motor_disarmed[i];
@@ -598,3 +691,18 @@ bool isMixerUsingServos(void)
 {
     return useServo;
 }
+
+uint8_t getMotorCount(void)
+{
+    return numberMotor;
+}
+
+const mixerSaturation_t *getMixerSaturation(void)
+{
+    return &mixerSaturation;
+}
+
+void mixerResetSaturation(void)
+{
+    memset(&mixerSaturation, 0, sizeof(mixerSaturation));
+}
@@ -89,14 +89,25 @@ typedef struct servoParam_t {
     int8_t forwardFromChannel;              // RX channel index, 0 based.  See CHANNEL_FORWARDING_DISABLED
 } servoParam_t;
 
+// how often the motors did not fit the output range, counted from arming
+typedef struct mixerSaturation_s {
+    uint32_t mixCount;                      // mixes of the motors
+    uint32_t pidScaledCount;                // the corrections alone did not fit and were scaled down
+    uint32_t loweredCount;                  // all motors were moved down to fit below maxthrottle
+    uint32_t raisedCount;                   // all motors were moved up to fit above minthrottle
+} mixerSaturation_t;
+
 extern int16_t motor[MAX_SUPPORTED_MOTORS];
 extern int16_t motor_disarmed[MAX_SUPPORTED_MOTORS];
 extern int16_t servo[MAX_SUPPORTED_SERVOS];
 
 bool isMixerUsingServos(void);
+uint8_t getMotorCount(void);
 void writeAllMotors(int16_t mc);
 void mixerLoadMix(int index, motorMixer_t *customMixers);
 void mixerResetMotors(void);
 void mixTable(void);
 void writeServos(void);
 void writeMotors(void);
+const mixerSaturation_t *getMixerSaturation(void);
+void mixerResetSaturation(void);
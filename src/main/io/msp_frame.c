@@ -0,0 +1,124 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "common/crc.h"
+
+#include "msp_frame.h"
+
+void mspFrameParserInit(mspFrameParser_t *parser, uint8_t *buffer, uint16_t bufferSize)
+{
+    memset(parser, 0, sizeof(mspFrameParser_t));
+    parser->buffer = buffer;
+    parser->bufferSize = bufferSize;
+    parser->state = MSP_IDLE;
+}
+
+static void updateChecksum(mspFrameParser_t *parser, uint8_t c)
+{
+    if (parser->version == MSP_V1) {
+        parser->checksum ^= c;
+    } else {
+        parser->checksum = crc8DvbS2(parser->checksum, c);
+    }
+}
+
+// called when the header is complete, the payload or the checksum follows
+static mspFrameResult_e startPayload(mspFrameParser_t *parser)
+{
+    if (parser->dataSize > parser->bufferSize) {
+        parser->state = MSP_IDLE;
+        return MSP_FRAME_INVALID;
+    }
+
+    parser->offset = 0;
+    parser->state = parser->dataSize > 0 ? MSP_PAYLOAD : MSP_CHECKSUM;
+    return MSP_FRAME_PENDING;
+}
+
+mspFrameResult_e mspFrameParse(mspFrameParser_t *parser, uint8_t c)
+{
+    switch (parser->state) {
+    case MSP_IDLE:
+        if (c != '$') {
+            return MSP_FRAME_NONE;
+        }
+        parser->state = MSP_HEADER_START;
+        break;
+
+    case MSP_HEADER_START:
+        if (c == 'M') {
+            parser->state = MSP_HEADER_M;
+        } else if (c == 'X') {
+            parser->state = MSP_HEADER_X;
+        } else if (c != '$') {
+            parser->state = MSP_IDLE;
+        }
+        break;
+
+    case MSP_HEADER_M:
+    case MSP_HEADER_X:
+        if (c != '<') {
+            parser->state = (c == '$') ? MSP_HEADER_START : MSP_IDLE;
+            break;
+        }
+        parser->version = (parser->state == MSP_HEADER_M) ? MSP_V1 : MSP_V2;
+        parser->state = (parser->version == MSP_V1) ? MSP_HEADER_V1 : MSP_HEADER_V2;
+        parser->headerLength = 0;
+        parser->checksum = 0;
+        break;
+
+    case MSP_HEADER_V1:
+        updateChecksum(parser, c);
+        parser->header[parser->headerLength++] = c;
+        if (parser->headerLength == 2) {
+            parser->flags = 0;
+            parser->dataSize = parser->header[0];
+            parser->cmd = parser->header[1];
+            return startPayload(parser);
+        }
+        break;
+
+    case MSP_HEADER_V2:
+        updateChecksum(parser, c);
+        parser->header[parser->headerLength++] = c;
+        if (parser->headerLength == MSP_V2_HEADER_SIZE) {
+            parser->flags = parser->header[0];
+            parser->cmd = parser->header[1] | (parser->header[2] << 8);
+            parser->dataSize = parser->header[3] | (parser->header[4] << 8);
+            return startPayload(parser);
+        }
+        break;
+
+    case MSP_PAYLOAD:
+        updateChecksum(parser, c);
+        parser->buffer[parser->offset++] = c;
+        if (parser->offset == parser->dataSize) {
+            parser->state = MSP_CHECKSUM;
+        }
+        break;
+
+    case MSP_CHECKSUM:
+        parser->state = MSP_IDLE;
+        return (parser->checksum == c) ? MSP_FRAME_RECEIVED : MSP_FRAME_INVALID;
+    }
+
+    return MSP_FRAME_PENDING;
+}
@@ -0,0 +1,76 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * MSP frames, parsed one byte at a time.
+ *
+ * v1: '$' 'M' '<' size8 cmd8 payload checksum, the checksum is the xor of size, cmd and payload.
+ * v2: '$' 'X' '<' flags cmd16 size16 payload crc8, 16 bit values are little endian, the crc is CRC-8/DVB-S2 of flags,
+ *     cmd, size and payload.
+ *
+ * Replies use the same framing with '>' instead of '<', or '!' when the command failed.
+ */
+
+#define MSP_V1_FRAME_OVERHEAD 6     // '$', 'M', '>', size, cmd and checksum
+#define MSP_V2_FRAME_OVERHEAD 9     // '$', 'X', '>', flags, cmd, size and crc
+
+typedef enum {
+    MSP_V1 = 0,
+    MSP_V2
+} mspVersion_e;
+
+typedef enum {
+    MSP_IDLE,
+    MSP_HEADER_START,   // '$'
+    MSP_HEADER_M,       // "$M"
+    MSP_HEADER_X,       // "$X"
+    MSP_HEADER_V1,      // "$M<", receiving size and cmd
+    MSP_HEADER_V2,      // "$X<", receiving flags, cmd and size
+    MSP_PAYLOAD,
+    MSP_CHECKSUM
+} mspFrameState_e;
+
+typedef enum {
+    MSP_FRAME_NONE,         // the byte is not part of a frame, other protocols may use it
+    MSP_FRAME_PENDING,      // the byte is part of a frame that is not complete yet
+    MSP_FRAME_RECEIVED,     // a frame with a valid checksum is in the parser
+    MSP_FRAME_INVALID       // a bad checksum or a payload larger than the buffer, the frame was dropped
+} mspFrameResult_e;
+
+#define MSP_V2_HEADER_SIZE 5    // flags, cmd and size
+
+typedef struct mspFrameParser_s {
+    uint8_t *buffer;            // receives the payload
+    uint16_t bufferSize;
+
+    mspFrameState_e state;
+    mspVersion_e version;
+    uint8_t header[MSP_V2_HEADER_SIZE];
+    uint8_t headerLength;
+    uint8_t checksum;           // xor for v1, crc for v2
+
+    // valid when a frame was received
+    uint8_t flags;
+    uint16_t cmd;
+    uint16_t dataSize;
+    uint16_t offset;
+} mspFrameParser_t;
+
+void mspFrameParserInit(mspFrameParser_t *parser, uint8_t *buffer, uint16_t bufferSize);
+mspFrameResult_e mspFrameParse(mspFrameParser_t *parser, uint8_t c);
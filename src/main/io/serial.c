@@ -58,7 +58,8 @@ const serialPortFunctionScenario_e serialPortScenarios[SERIAL_PORT_SCENARIO_COUN
     SCENARIO_MSP_CLI_GPS_PASTHROUGH,
     SCENARIO_CLI_ONLY,
     SCENARIO_GPS_PASSTHROUGH_ONLY,
-    SCENARIO_MSP_ONLY
+    SCENARIO_MSP_ONLY,
+    SCENARIO_BLACKBOX_ONLY
 };
 
 static serialConfig_t *serialConfig;
@@ -125,7 +126,8 @@ const functionConstraint_t functionConstraints[] = {
         { FUNCTION_GPS_PASSTHROUGH, 9600, 115200, NO_AUTOBAUD, SPF_NONE },
         { FUNCTION_MSP,             9600, 115200, NO_AUTOBAUD, SPF_NONE },
         { FUNCTION_SERIAL_RX,       9600, 115200, NO_AUTOBAUD, SPF_SUPPORTS_SBUS_MODE | SPF_SUPPORTS_CALLBACK },
-        { FUNCTION_TELEMETRY,       9600, 19200,  NO_AUTOBAUD, SPF_NONE }
+        { FUNCTION_TELEMETRY,       9600, 19200,  NO_AUTOBAUD, SPF_NONE },
+        { FUNCTION_BLACKBOX,        115200, 115200, NO_AUTOBAUD, SPF_NONE }
 };
 
 #define FUNCTION_CONSTRAINT_COUNT (sizeof(functionConstraints) / sizeof(functionConstraint_t))
@@ -458,6 +460,12 @@ bool isSerialConfigValid(serialConfig_t *serialConfigToCheck)
         return false;
     }
 
+    functionConstraint = getConfiguredFunctionConstraint(FUNCTION_BLACKBOX);
+    searchResult = findSerialPort(FUNCTION_BLACKBOX, functionConstraint);
+    if (feature(FEATURE_BLACKBOX) && !searchResult) {
+        return false;
+    }
+
     uint8_t functionIndex;
     uint8_t cliPortCount = 0;
     uint8_t mspPortCount = 0;
@@ -24,7 +24,8 @@ typedef enum {
     FUNCTION_TELEMETRY          = (1 << 2),
     FUNCTION_SERIAL_RX          = (1 << 3),
     FUNCTION_GPS                = (1 << 4),
-    FUNCTION_GPS_PASSTHROUGH    = (1 << 5)
+    FUNCTION_GPS_PASSTHROUGH    = (1 << 5),
+    FUNCTION_BLACKBOX           = (1 << 6)
 } serialPortFunction_e;
 
 typedef enum {
@@ -51,9 +52,10 @@ typedef enum {
     SCENARIO_MSP_CLI_TELEMETRY_GPS_PASTHROUGH   = FUNCTION_MSP | FUNCTION_CLI | FUNCTION_TELEMETRY | FUNCTION_GPS_PASSTHROUGH,
     SCENARIO_SERIAL_RX_ONLY                     = FUNCTION_SERIAL_RX,
     SCENARIO_TELEMETRY_ONLY                     = FUNCTION_TELEMETRY,
+    SCENARIO_BLACKBOX_ONLY                      = FUNCTION_BLACKBOX,
 } serialPortFunctionScenario_e;
 
-#define SERIAL_PORT_SCENARIO_COUNT 9
+#define SERIAL_PORT_SCENARIO_COUNT 10
 #define SERIAL_PORT_SCENARIO_MAX (SERIAL_PORT_SCENARIO_COUNT - 1)
 extern const serialPortFunctionScenario_e serialPortScenarios[SERIAL_PORT_SCENARIO_COUNT];
 
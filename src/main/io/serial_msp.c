@@ -27,7 +27,9 @@
 
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/crc.h"
 #include "common/maths.h"
+#include "common/profiling.h"
 
 #include "drivers/system.h"
 #include "drivers/accgyro.h"
@@ -48,6 +50,7 @@
 #include "io/gps.h"
 #include "io/gimbal.h"
 #include "io/serial.h"
+#include "io/msp_frame.h"
 #include "io/ledstrip.h"
 #include "telemetry/telemetry.h"
 #include "sensors/boardalignment.h"
@@ -62,6 +65,8 @@
 #include "config/config.h"
 #include "config/config_profile.h"
 #include "config/config_master.h"
+#include "config/config_values.h"
+#include "config/config_dump.h"
 
 #include "version.h"
 #ifdef NAZE
@@ -115,7 +120,7 @@ extern int16_t debug[4]; // FIXME dependency on mw.c
 #define MSP_PROTOCOL_VERSION                0
 
 #define API_VERSION_MAJOR                   1 // increment when major changes are made
-#define API_VERSION_MINOR                   0 // increment when any change is made, reset to zero when major changes are released after changing API_VERSION_MAJOR
+#define API_VERSION_MINOR                   2 // increment when any change is made, reset to zero when major changes are released after changing API_VERSION_MAJOR
 
 #define API_VERSION_LENGTH                  2
 
@@ -197,6 +202,8 @@ const char *boardIdentifier = TARGET_BOARD_IDENTIFIER;
 #define MSP_RSSI_CONFIG                 50
 #define MSP_SET_RSSI_CONFIG             51
 
+#define MSP_PROFILE                     52    //out message         Returns execution time statistics for the profiling stage given in the payload
+
 //
 // Baseflight MSP commands (if enabled they exist in Cleanflight)
 //
@@ -272,7 +279,19 @@ const char *boardIdentifier = TARGET_BOARD_IDENTIFIER;
 #define MSP_SET_ACC_TRIM         239    //in message          set acc angle trim values
 #define MSP_GPSSVINFO            164    //out message         get Signal Strength (only U-Blox)
 
-#define INBUF_SIZE 64
+//
+// MSP v2 commands, the command IDs do not fit into a v1 frame
+//
+#define MSP_BATCH                0x1000 //out message       replies of several out messages, see processBatchCommand()
+#define MSP_CONFIG_DUMP          0x1001 //out message       binary dump of the config values, see mspConfigDump()
+#define MSP_SET_CONFIG_DUMP      0x1002 //in message        restores config values from a binary dump
+
+#define INBUF_SIZE 256
+
+#define MSP_BATCH_ENTRY_OVERHEAD 5  // command, result and size of each reply in a batch
+
+#define MSP_CONFIG_DUMP_CHUNK_SIZE 240  // most bytes of records in one reply to MSP_CONFIG_DUMP
+#define MSP_CONFIG_DUMP_REPLY_HEADER_SIZE 3 // format version and the index to ask for next
 
 typedef struct box_e {
     const uint8_t boxId;         // see boxId_e
@@ -330,73 +349,93 @@ static const char pidnames[] =
     "MAG;"
     "VEL;";
 
-typedef enum {
-    IDLE,
-    HEADER_START,
-    HEADER_M,
-    HEADER_ARROW,
-    HEADER_SIZE,
-    HEADER_CMD,
-} mspState_e;
-
 typedef enum {
     UNUSED_PORT = 0,
     FOR_GENERAL_MSP,
     FOR_TELEMETRY
 } mspPortUsage_e;
 
+typedef enum {
+    MSP_BATCH_NONE = 0,
+    MSP_BATCH_MEASURE,      // the replies are only counted
+    MSP_BATCH_WRITE         // the replies are written as entries of the batch reply
+} mspBatchState_e;
+
 typedef struct mspPort_s {
     serialPort_t *port;
-    uint8_t offset;
-    uint8_t dataSize;
-    uint8_t checksum;
-    uint8_t indRX;
+    mspFrameParser_t parser;
+    uint16_t dataSize;
+    uint8_t checksum;           // of the reply, xor for v1 and crc for v2
+    uint16_t indRX;
     uint8_t inBuf[INBUF_SIZE];
-    mspState_e c_state;
-    uint8_t cmdMSP;
+    uint16_t cmdMSP;
+    mspVersion_e version;       // of the request, the reply is framed the same way
     mspPortUsage_e mspPortUsage;
+    uint8_t *replyFrame;        // in the transmit buffer of the port, NULL when the reply is written byte by byte
+    uint16_t replyFrameSize;
+    uint16_t replyFrameLength;
+    bool replyDropped;          // the reply did not fit into the transmit buffer
+    mspBatchState_e batchState;
+    uint32_t batchSize;
 } mspPort_t;
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
 static mspPort_t *currentPort;
 
-void serialize32(uint32_t a)
+// sends the reply built in place so far, see headSerialResponse()
+static void commitReplyFrame(void)
+{
+    if (currentPort->replyFrame) {
+        serialTxCommit(mspSerialPort, currentPort->replyFrameLength);
+        currentPort->replyFrame = NULL;
+    }
+}
+
+void serialize8(uint8_t a)
 {
-    static uint8_t t;
-    t = a;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
-    t = a >> 8;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
-    t = a >> 16;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
-    t = a >> 24;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
+    if (currentPort->replyDropped || currentPort->batchState == MSP_BATCH_MEASURE) {
+        return;
+    }
+
+    if (currentPort->replyFrame) {
+        if (currentPort->replyFrameLength < currentPort->replyFrameSize) {
+            currentPort->replyFrame[currentPort->replyFrameLength++] = a;
+        } else {
+            // longer than the size given in the header, the rest goes byte by byte
+            commitReplyFrame();
+            serialWrite(mspSerialPort, a);
+        }
+    } else {
+        serialWrite(mspSerialPort, a);
+    }
+
+    if (currentPort->version == MSP_V1) {
+        currentPort->checksum ^= a;
+    } else {
+        currentPort->checksum = crc8DvbS2(currentPort->checksum, a);
+    }
 }
 
 void serialize16(int16_t a)
 {
-    static uint8_t t;
-    t = a;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
-    t = a >> 8 & 0xff;
-    serialWrite(mspSerialPort, t);
-    currentPort->checksum ^= t;
+    serialize8(a & 0xff);
+    serialize8((a >> 8) & 0xff);
 }
 
-void serialize8(uint8_t a)
+void serialize32(uint32_t a)
 {
-    serialWrite(mspSerialPort, a);
-    currentPort->checksum ^= a;
+    serialize16(a & 0xffff);
+    serialize16((a >> 16) & 0xffff);
 }
 
 uint8_t read8(void)
 {
+    // a command given less payload than it reads gets zeros
+    if (currentPort->indRX >= currentPort->dataSize) {
+        return 0;
+    }
+
     return currentPort->inBuf[currentPort->indRX++] & 0xff;
 }
 
@@ -414,22 +453,53 @@ uint32_t read32(void)
     return t;
 }
 
-void headSerialResponse(uint8_t err, uint8_t s)
+void headSerialResponse(uint8_t err, uint16_t s)
 {
+    if (currentPort->batchState == MSP_BATCH_MEASURE) {
+        currentPort->batchSize += MSP_BATCH_ENTRY_OVERHEAD + s;
+        return;
+    }
+
+    if (currentPort->batchState == MSP_BATCH_WRITE) {
+        serialize16(currentPort->cmdMSP);
+        serialize8(err);
+        serialize16(s);
+        return;
+    }
+
+    // a reply may follow the header of a reply that was never finished
+    commitReplyFrame();
+
+    uint16_t frameSize = (currentPort->version == MSP_V1 ? MSP_V1_FRAME_OVERHEAD : MSP_V2_FRAME_OVERHEAD) + s;
+
+    // a full transmit buffer drops the newest bytes, drop the whole reply rather than send the start of it
+    currentPort->replyDropped = serialTxBytesFree(mspSerialPort) < frameSize;
+
+    // build the whole reply in the transmit buffer, byte by byte when there is no room for it in one piece
+    currentPort->replyFrame = currentPort->replyDropped ? NULL : serialTxReserve(mspSerialPort, frameSize);
+    currentPort->replyFrameSize = frameSize;
+    currentPort->replyFrameLength = 0;
+
     serialize8('$');
-    serialize8('M');
+    serialize8(currentPort->version == MSP_V1 ? 'M' : 'X');
     serialize8(err ? '!' : '>');
     currentPort->checksum = 0;               // start calculating a new checksum
-    serialize8(s);
-    serialize8(currentPort->cmdMSP);
+    if (currentPort->version == MSP_V1) {
+        serialize8(s);
+        serialize8(currentPort->cmdMSP);
+    } else {
+        serialize8(0);                       // flags
+        serialize16(currentPort->cmdMSP);
+        serialize16(s);
+    }
 }
 
-void headSerialReply(uint8_t s)
+void headSerialReply(uint16_t s)
 {
     headSerialResponse(0, s);
 }
 
-void headSerialError(uint8_t s)
+void headSerialError(uint16_t s)
 {
     headSerialResponse(1, s);
 }
@@ -437,6 +507,8 @@ void headSerialError(uint8_t s)
 void tailSerialReply(void)
 {
     serialize8(currentPort->checksum);
+    commitReplyFrame();
+    currentPort->replyDropped = false;
 }
 
 void s_struct(uint8_t *cb, uint8_t siz)
@@ -517,6 +589,7 @@ static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort, ms
 
     mspPortToReset->port = serialPort;
     mspPortToReset->mspPortUsage = usage;
+    mspFrameParserInit(&mspPortToReset->parser, mspPortToReset->inBuf, sizeof(mspPortToReset->inBuf));
 }
 
 // This rate is chosen since softserial supports it.
@@ -620,723 +693,1248 @@ void mspInit(serialConfig_t *serialConfig)
 
 #define IS_ENABLED(mask) (mask == 0 ? 0 : 1)
 
-static bool processOutCommand(uint8_t cmdMSP)
+static bool mspApiVersion(void)
 {
-    uint32_t i, tmp, junk;
-
-
-#ifdef GPS
-    uint8_t wp_no;
-    int32_t lat = 0, lon = 0;
-#endif
+    uint32_t i;
 
-    switch (cmdMSP) {
-    case MSP_API_VERSION:
-        // the components of this command are in an order such that future changes could be made to it without breaking clients.
-        // i.e. most important first.
-        headSerialReply(
-            1 + // protocol version length
-            API_VERSION_LENGTH +
-            FLIGHT_CONTROLLER_IDENTIFIER_LENGTH +
-            FLIGHT_CONTROLLER_VERSION_LENGTH +
-            BOARD_IDENTIFIER_LENGTH +
-            BOARD_HARDWARE_REVISION_LENGTH +
-            BUILD_DATE_LENGTH +
-            BUILD_TIME_LENGTH +
-            1 + // scm reference length
-            GIT_SHORT_REVISION_LENGTH +
-            1 // additional FC specific length
-            // no addition FC specific data yet.
-        );
-        serialize8(MSP_PROTOCOL_VERSION);
-
-        serialize8(API_VERSION_MAJOR);
-        serialize8(API_VERSION_MINOR);
-
-        for (i = 0; i < FLIGHT_CONTROLLER_IDENTIFIER_LENGTH; i++) {
-            serialize8(flightControllerIdentifier[i]);
-        }
+    // the components of this command are in an order such that future changes could be made to it without breaking clients.
+    // i.e. most important first.
+    headSerialReply(
+        1 + // protocol version length
+        API_VERSION_LENGTH +
+        FLIGHT_CONTROLLER_IDENTIFIER_LENGTH +
+        FLIGHT_CONTROLLER_VERSION_LENGTH +
+        BOARD_IDENTIFIER_LENGTH +
+        BOARD_HARDWARE_REVISION_LENGTH +
+        BUILD_DATE_LENGTH +
+        BUILD_TIME_LENGTH +
+        1 + // scm reference length
+        GIT_SHORT_REVISION_LENGTH +
+        1 // additional FC specific length
+        // no addition FC specific data yet.
+    );
+    serialize8(MSP_PROTOCOL_VERSION);
+
+    serialize8(API_VERSION_MAJOR);
+    serialize8(API_VERSION_MINOR);
+
+    for (i = 0; i < FLIGHT_CONTROLLER_IDENTIFIER_LENGTH; i++) {
+        serialize8(flightControllerIdentifier[i]);
+    }
 
-        serialize8(FC_VERSION_MAJOR);
-        serialize8(FC_VERSION_MINOR);
-        serialize8(FC_VERSION_PATCH_LEVEL);
+    serialize8(FC_VERSION_MAJOR);
+    serialize8(FC_VERSION_MINOR);
+    serialize8(FC_VERSION_PATCH_LEVEL);
 
-        for (i = 0; i < BOARD_IDENTIFIER_LENGTH; i++) {
-            serialize8(boardIdentifier[i]);
-        }
+    for (i = 0; i < BOARD_IDENTIFIER_LENGTH; i++) {
+        serialize8(boardIdentifier[i]);
+    }
 #ifdef NAZE
-        serialize16(hardwareRevision);
+    serialize16(hardwareRevision);
 #else
-        serialize16(0); // No other build targets currently have hardware revision detection.
+    serialize16(0); // No other build targets currently have hardware revision detection.
 #endif
 
-        for (i = 0; i < BUILD_DATE_LENGTH; i++) {
-            serialize8(buildDate[i]);
-        }
-        for (i = 0; i < BUILD_TIME_LENGTH; i++) {
-            serialize8(buildTime[i]);
-        }
+    for (i = 0; i < BUILD_DATE_LENGTH; i++) {
+        serialize8(buildDate[i]);
+    }
+    for (i = 0; i < BUILD_TIME_LENGTH; i++) {
+        serialize8(buildTime[i]);
+    }
 
-        serialize8(GIT_SHORT_REVISION_LENGTH);
-        for (i = 0; i < GIT_SHORT_REVISION_LENGTH; i++) {
-            serialize8(shortGitRevision[i]);
-        }
-        serialize8(0); // No flight controller specific information to follow.
-        break;
-
-    // DEPRECATED - Use MSP_API_VERSION
-    case MSP_IDENT:
-        headSerialReply(7);
-        serialize8(MW_VERSION);
-        serialize8(masterConfig.mixerConfiguration); // type of multicopter
-        serialize8(MSP_PROTOCOL_VERSION);
-        serialize32(CAP_DYNBALANCE | (masterConfig.airplaneConfig.flaps_speed ? CAP_FLAPS : 0)); // "capability"
-        break;
-
-    case MSP_STATUS:
-        headSerialReply(11);
-        serialize16(cycleTime);
+    serialize8(GIT_SHORT_REVISION_LENGTH);
+    for (i = 0; i < GIT_SHORT_REVISION_LENGTH; i++) {
+        serialize8(shortGitRevision[i]);
+    }
+    serialize8(0); // No flight controller specific information to follow.
+    return true;
+}
+
+// DEPRECATED - Use MSP_API_VERSION
+static bool mspIdent(void)
+{
+    headSerialReply(7);
+    serialize8(MW_VERSION);
+    serialize8(masterConfig.mixerConfiguration); // type of multicopter
+    serialize8(MSP_PROTOCOL_VERSION);
+    serialize32(CAP_DYNBALANCE | (masterConfig.airplaneConfig.flaps_speed ? CAP_FLAPS : 0)); // "capability"
+    return true;
+}
+
+static bool mspStatus(void)
+{
+    uint32_t i;
+    uint32_t tmp, junk;
+
+    headSerialReply(11);
+    serialize16(cycleTime);
 #ifdef USE_I2C
-        serialize16(i2cGetErrorCounter());
+    serialize16(i2cGetErrorCounter());
 #else
-        serialize16(0);
+    serialize16(0);
 #endif
-        serialize16(sensors(SENSOR_ACC) | sensors(SENSOR_BARO) << 1 | sensors(SENSOR_MAG) << 2 | sensors(SENSOR_GPS) << 3 | sensors(SENSOR_SONAR) << 4);
-        // OK, so you waste all the fucking time to have BOXNAMES and BOXINDEXES etc, and then you go ahead and serialize enabled shit simply by stuffing all
-        // the bits in order, instead of setting the enabled bits based on BOXINDEX. WHERE IS THE FUCKING LOGIC IN THIS, FUCKWADS.
-        // Serialize the boxes in the order we delivered them, until multiwii retards fix their shit
-        junk = 0;
-        tmp = IS_ENABLED(FLIGHT_MODE(ANGLE_MODE)) << BOXANGLE |
-            IS_ENABLED(FLIGHT_MODE(HORIZON_MODE)) << BOXHORIZON |
-            IS_ENABLED(FLIGHT_MODE(BARO_MODE)) << BOXBARO |
-            IS_ENABLED(FLIGHT_MODE(MAG_MODE)) << BOXMAG |
-            IS_ENABLED(FLIGHT_MODE(HEADFREE_MODE)) << BOXHEADFREE |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXHEADADJ)) << BOXHEADADJ |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCAMSTAB)) << BOXCAMSTAB |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCAMTRIG)) << BOXCAMTRIG |
-            IS_ENABLED(FLIGHT_MODE(GPS_HOME_MODE)) << BOXGPSHOME |
-            IS_ENABLED(FLIGHT_MODE(GPS_HOLD_MODE)) << BOXGPSHOLD |
-            IS_ENABLED(FLIGHT_MODE(PASSTHRU_MODE)) << BOXPASSTHRU |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXBEEPERON)) << BOXBEEPERON |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXLEDMAX)) << BOXLEDMAX |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXLLIGHTS)) << BOXLLIGHTS |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCALIB)) << BOXCALIB |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXGOV)) << BOXGOV |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXOSD)) << BOXOSD |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXTELEMETRY)) << BOXTELEMETRY |
-            IS_ENABLED(IS_RC_MODE_ACTIVE(BOXAUTOTUNE)) << BOXAUTOTUNE |
-            IS_ENABLED(FLIGHT_MODE(SONAR_MODE)) << BOXSONAR |
-            IS_ENABLED(ARMING_FLAG(ARMED)) << BOXARM;
-        for (i = 0; i < activeBoxIdCount; i++) {
-            int flag = (tmp & (1 << activeBoxIds[i]));
-            if (flag)
-                junk |= 1 << i;
-        }
-        serialize32(junk);
-        serialize8(masterConfig.current_profile_index);
-        break;
-    case MSP_RAW_IMU:
-        headSerialReply(18);
-        // Retarded hack until multiwiidorks start using real units for sensor data
-        if (acc_1G > 1024) {
-            for (i = 0; i < 3; i++)
-                serialize16(accSmooth[i] / 8);
-        } else {
-            for (i = 0; i < 3; i++)
-                serialize16(accSmooth[i]);
-        }
+    serialize16(sensors(SENSOR_ACC) | sensors(SENSOR_BARO) << 1 | sensors(SENSOR_MAG) << 2 | sensors(SENSOR_GPS) << 3 | sensors(SENSOR_SONAR) << 4);
+    // OK, so you waste all the fucking time to have BOXNAMES and BOXINDEXES etc, and then you go ahead and serialize enabled shit simply by stuffing all
+    // the bits in order, instead of setting the enabled bits based on BOXINDEX. WHERE IS THE FUCKING LOGIC IN THIS, FUCKWADS.
+    // Serialize the boxes in the order we delivered them, until multiwii retards fix their shit
+    junk = 0;
+    tmp = IS_ENABLED(FLIGHT_MODE(ANGLE_MODE)) << BOXANGLE |
+        IS_ENABLED(FLIGHT_MODE(HORIZON_MODE)) << BOXHORIZON |
+        IS_ENABLED(FLIGHT_MODE(BARO_MODE)) << BOXBARO |
+        IS_ENABLED(FLIGHT_MODE(MAG_MODE)) << BOXMAG |
+        IS_ENABLED(FLIGHT_MODE(HEADFREE_MODE)) << BOXHEADFREE |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXHEADADJ)) << BOXHEADADJ |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCAMSTAB)) << BOXCAMSTAB |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCAMTRIG)) << BOXCAMTRIG |
+        IS_ENABLED(FLIGHT_MODE(GPS_HOME_MODE)) << BOXGPSHOME |
+        IS_ENABLED(FLIGHT_MODE(GPS_HOLD_MODE)) << BOXGPSHOLD |
+        IS_ENABLED(FLIGHT_MODE(PASSTHRU_MODE)) << BOXPASSTHRU |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXBEEPERON)) << BOXBEEPERON |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXLEDMAX)) << BOXLEDMAX |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXLLIGHTS)) << BOXLLIGHTS |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXCALIB)) << BOXCALIB |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXGOV)) << BOXGOV |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXOSD)) << BOXOSD |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXTELEMETRY)) << BOXTELEMETRY |
+        IS_ENABLED(IS_RC_MODE_ACTIVE(BOXAUTOTUNE)) << BOXAUTOTUNE |
+        IS_ENABLED(FLIGHT_MODE(SONAR_MODE)) << BOXSONAR |
+        IS_ENABLED(ARMING_FLAG(ARMED)) << BOXARM;
+    for (i = 0; i < activeBoxIdCount; i++) {
+        int flag = (tmp & (1 << activeBoxIds[i]));
+        if (flag)
+            junk |= 1 << i;
+    }
+    serialize32(junk);
+    serialize8(masterConfig.current_profile_index);
+    return true;
+}
+
+static bool mspRawImu(void)
+{
+    uint32_t i;
+
+    headSerialReply(18);
+    // Retarded hack until multiwiidorks start using real units for sensor data
+    if (acc_1G > 1024) {
         for (i = 0; i < 3; i++)
-            serialize16(gyroData[i]);
+            serialize16(accSmooth[i] / 8);
+    } else {
         for (i = 0; i < 3; i++)
-            serialize16(magADC[i]);
-        break;
-    case MSP_SERVO:
-        s_struct((uint8_t *)&servo, 16);
-        break;
-    case MSP_SERVO_CONF:
-        headSerialReply(56);
-        for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
-            serialize16(currentProfile->servoConf[i].min);
-            serialize16(currentProfile->servoConf[i].max);
-            serialize16(currentProfile->servoConf[i].middle);
-            serialize8(currentProfile->servoConf[i].rate);
-        }
-        break;
-    case MSP_CHANNEL_FORWARDING:
-        headSerialReply(8);
-        for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
-            serialize8(currentProfile->servoConf[i].forwardFromChannel);
+            serialize16(accSmooth[i]);
+    }
+    for (i = 0; i < 3; i++)
+        serialize16(gyroData[i]);
+    for (i = 0; i < 3; i++)
+        serialize16(magADC[i]);
+    return true;
+}
+
+static bool mspServo(void)
+{
+    s_struct((uint8_t *)&servo, 16);
+    return true;
+}
+
+static bool mspServoConf(void)
+{
+    uint32_t i;
+
+    headSerialReply(56);
+    for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        serialize16(currentProfile->servoConf[i].min);
+        serialize16(currentProfile->servoConf[i].max);
+        serialize16(currentProfile->servoConf[i].middle);
+        serialize8(currentProfile->servoConf[i].rate);
+    }
+    return true;
+}
+
+static bool mspChannelForwarding(void)
+{
+    uint32_t i;
+
+    headSerialReply(8);
+    for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        serialize8(currentProfile->servoConf[i].forwardFromChannel);
+    }
+    return true;
+}
+
+static bool mspMotor(void)
+{
+    s_struct((uint8_t *)motor, 16);
+    return true;
+}
+
+static bool mspRc(void)
+{
+    uint32_t i;
+
+    headSerialReply(2 * rxRuntimeConfig.channelCount);
+    for (i = 0; i < rxRuntimeConfig.channelCount; i++)
+        serialize16(rcData[i]);
+    return true;
+}
+
+static bool mspAttitude(void)
+{
+    uint32_t i;
+
+    headSerialReply(6);
+    for (i = 0; i < 2; i++)
+        serialize16(inclination.raw[i]);
+    serialize16(heading);
+    return true;
+}
+
+static bool mspAltitude(void)
+{
+    headSerialReply(6);
+    serialize32(EstAlt);
+    serialize16(vario);
+    return true;
+}
+
+static bool mspAnalog(void)
+{
+    headSerialReply(7);
+    serialize8((uint8_t)constrain(vbat, 0, 255));
+    serialize16((uint16_t)constrain(mAhDrawn, 0, 0xFFFF)); // milliamphours drawn from battery
+    serialize16(rssi);
+    if(masterConfig.batteryConfig.multiwiiCurrentMeterOutput) {
+        serialize16((uint16_t)constrain((abs(amperage) * 10), 0, 0xFFFF)); // send amperage in 0.001 A steps
+    } else
+        serialize16((uint16_t)constrain(abs(amperage), 0, 0xFFFF)); // send amperage in 0.01 A steps
+    return true;
+}
+
+static bool mspRcTuning(void)
+{
+    headSerialReply(7);
+    serialize8(currentProfile->controlRateConfig.rcRate8);
+    serialize8(currentProfile->controlRateConfig.rcExpo8);
+    serialize8(currentProfile->controlRateConfig.rollPitchRate);
+    serialize8(currentProfile->controlRateConfig.yawRate);
+    serialize8(currentProfile->dynThrPID);
+    serialize8(currentProfile->controlRateConfig.thrMid8);
+    serialize8(currentProfile->controlRateConfig.thrExpo8);
+    return true;
+}
+
+static bool mspPid(void)
+{
+    uint32_t i;
+
+    headSerialReply(3 * PID_ITEM_COUNT);
+    if (currentProfile->pidController == 2) { // convert float stuff into uint8_t to keep backwards compatability with all 8-bit shit with new pid
+        for (i = 0; i < 3; i++) {
+            serialize8(constrain(lrintf(currentProfile->pidProfile.P_f[i] * 10.0f), 0, 250));
+            serialize8(constrain(lrintf(currentProfile->pidProfile.I_f[i] * 100.0f), 0, 250));
+            serialize8(constrain(lrintf(currentProfile->pidProfile.D_f[i] * 1000.0f), 0, 100));
         }
-        break;
-    case MSP_MOTOR:
-        s_struct((uint8_t *)motor, 16);
-        break;
-    case MSP_RC:
-        headSerialReply(2 * rxRuntimeConfig.channelCount);
-        for (i = 0; i < rxRuntimeConfig.channelCount; i++)
-            serialize16(rcData[i]);
-        break;
-    case MSP_ATTITUDE:
-        headSerialReply(6);
-        for (i = 0; i < 2; i++)
-            serialize16(inclination.raw[i]);
-        serialize16(heading);
-        break;
-    case MSP_ALTITUDE:
-        headSerialReply(6);
-        serialize32(EstAlt);
-        serialize16(vario);
-        break;
-    case MSP_ANALOG:
-        headSerialReply(7);
-        serialize8((uint8_t)constrain(vbat, 0, 255));
-        serialize16((uint16_t)constrain(mAhDrawn, 0, 0xFFFF)); // milliamphours drawn from battery
-        serialize16(rssi);
-        if(masterConfig.batteryConfig.multiwiiCurrentMeterOutput) {
-            serialize16((uint16_t)constrain((abs(amperage) * 10), 0, 0xFFFF)); // send amperage in 0.001 A steps
-        } else
-            serialize16((uint16_t)constrain(abs(amperage), 0, 0xFFFF)); // send amperage in 0.01 A steps
-        break;
-    case MSP_RC_TUNING:
-        headSerialReply(7);
-        serialize8(currentProfile->controlRateConfig.rcRate8);
-        serialize8(currentProfile->controlRateConfig.rcExpo8);
-        serialize8(currentProfile->controlRateConfig.rollPitchRate);
-        serialize8(currentProfile->controlRateConfig.yawRate);
-        serialize8(currentProfile->dynThrPID);
-        serialize8(currentProfile->controlRateConfig.thrMid8);
-        serialize8(currentProfile->controlRateConfig.thrExpo8);
-        break;
-    case MSP_PID:
-        headSerialReply(3 * PID_ITEM_COUNT);
-        if (currentProfile->pidController == 2) { // convert float stuff into uint8_t to keep backwards compatability with all 8-bit shit with new pid
-            for (i = 0; i < 3; i++) {
-                serialize8(constrain(lrintf(currentProfile->pidProfile.P_f[i] * 10.0f), 0, 250));
-                serialize8(constrain(lrintf(currentProfile->pidProfile.I_f[i] * 100.0f), 0, 250));
-                serialize8(constrain(lrintf(currentProfile->pidProfile.D_f[i] * 1000.0f), 0, 100));
-            }
-            for (i = 3; i < PID_ITEM_COUNT; i++) {
-                if (i == PIDLEVEL) {
-                    serialize8(constrain(lrintf(currentProfile->pidProfile.A_level * 10.0f), 0, 250));
-                    serialize8(constrain(lrintf(currentProfile->pidProfile.H_level * 10.0f), 0, 250));
-                    serialize8(0);
-                } else {
-                    serialize8(currentProfile->pidProfile.P8[i]);
-                    serialize8(currentProfile->pidProfile.I8[i]);
-                    serialize8(currentProfile->pidProfile.D8[i]);
-                }
-            }
-        } else {
-            for (i = 0; i < PID_ITEM_COUNT; i++) {
+        for (i = 3; i < PID_ITEM_COUNT; i++) {
+            if (i == PIDLEVEL) {
+                serialize8(constrain(lrintf(currentProfile->pidProfile.A_level * 10.0f), 0, 250));
+                serialize8(constrain(lrintf(currentProfile->pidProfile.H_level * 10.0f), 0, 250));
+                serialize8(0);
+            } else {
                 serialize8(currentProfile->pidProfile.P8[i]);
                 serialize8(currentProfile->pidProfile.I8[i]);
                 serialize8(currentProfile->pidProfile.D8[i]);
             }
         }
-        break;
-    case MSP_PIDNAMES:
-        headSerialReply(sizeof(pidnames) - 1);
-        serializeNames(pidnames);
-        break;
-    case MSP_MODE_RANGES:
-        headSerialReply(4 * MAX_MODE_ACTIVATION_CONDITION_COUNT);
-        for (i = 0; i < MAX_MODE_ACTIVATION_CONDITION_COUNT; i++) {
-            modeActivationCondition_t *mac = &currentProfile->modeActivationConditions[i];
-            const box_t *box = &boxes[mac->modeId];
-            serialize8(box->permanentId);
-            serialize8(mac->auxChannelIndex);
-            serialize8(mac->rangeStartStep);
-            serialize8(mac->rangeEndStep);
+    } else {
+        for (i = 0; i < PID_ITEM_COUNT; i++) {
+            serialize8(currentProfile->pidProfile.P8[i]);
+            serialize8(currentProfile->pidProfile.I8[i]);
+            serialize8(currentProfile->pidProfile.D8[i]);
         }
-        break;
-    case MSP_BOXNAMES:
-        // headSerialReply(sizeof(boxnames) - 1);
-        serializeBoxNamesReply();
-        break;
-    case MSP_BOXIDS:
-        headSerialReply(activeBoxIdCount);
-        for (i = 0; i < activeBoxIdCount; i++) {
-            const box_t *box = findBoxByActiveBoxId(activeBoxIds[i]);
-            if (!box) {
-                continue;
-            }
-            serialize8(box->permanentId);
-        }
-        break;
-    case MSP_MISC:
-        headSerialReply(2 * 6 + 4 + 2 + 4);
-        serialize16(0); // intPowerTrigger1 (aka useless trash)
-        serialize16(masterConfig.escAndServoConfig.minthrottle);
-        serialize16(masterConfig.escAndServoConfig.maxthrottle);
-        serialize16(masterConfig.escAndServoConfig.mincommand);
-        serialize16(currentProfile->failsafeConfig.failsafe_throttle);
-        serialize16(0); // plog useless shit
-        serialize32(0); // plog useless shit
-        serialize16(currentProfile->mag_declination / 10); // TODO check this shit
-        serialize8(masterConfig.batteryConfig.vbatscale);
-        serialize8(masterConfig.batteryConfig.vbatmincellvoltage);
-        serialize8(masterConfig.batteryConfig.vbatmaxcellvoltage);
-        serialize8(0);
-        break;
-    case MSP_MOTOR_PINS:
-        headSerialReply(8);
-        for (i = 0; i < 8; i++)
-            serialize8(i + 1);
-        break;
-#ifdef GPS
-    case MSP_RAW_GPS:
-        headSerialReply(16);
-        serialize8(STATE(GPS_FIX));
-        serialize8(GPS_numSat);
-        serialize32(GPS_coord[LAT]);
-        serialize32(GPS_coord[LON]);
-        serialize16(GPS_altitude);
-        serialize16(GPS_speed);
-        serialize16(GPS_ground_course);
-        break;
-    case MSP_COMP_GPS:
-        headSerialReply(5);
-        serialize16(GPS_distanceToHome);
-        serialize16(GPS_directionToHome);
-        serialize8(GPS_update & 1);
-        break;
-    case MSP_WP:
-        wp_no = read8();    // get the wp number
-        headSerialReply(18);
-        if (wp_no == 0) {
-            lat = GPS_home[LAT];
-            lon = GPS_home[LON];
-        } else if (wp_no == 16) {
-            lat = GPS_hold[LAT];
-            lon = GPS_hold[LON];
-        }
-        serialize8(wp_no);
-        serialize32(lat);
-        serialize32(lon);
-        serialize32(AltHold);           // altitude (cm) will come here -- temporary implementation to test feature with apps
-        serialize16(0);                 // heading  will come here (deg)
-        serialize16(0);                 // time to stay (ms) will come here
-        serialize8(0);                  // nav flag will come here
-        break;
-    case MSP_GPSSVINFO:
-        headSerialReply(1 + (GPS_numCh * 4));
-        serialize8(GPS_numCh);
-           for (i = 0; i < GPS_numCh; i++){
-               serialize8(GPS_svinfo_chn[i]);
-               serialize8(GPS_svinfo_svid[i]);
-               serialize8(GPS_svinfo_quality[i]);
-               serialize8(GPS_svinfo_cno[i]);
-            }
-        break;
-#endif
-    case MSP_DEBUG:
-        headSerialReply(8);
-        // make use of this crap, output some useful QA statistics
-        //debug[3] = ((hse_value / 1000000) * 1000) + (SystemCoreClock / 1000000);         // XX0YY [crystal clock : core clock]
-        for (i = 0; i < 4; i++)
-            serialize16(debug[i]);      // 4 variables are here for general monitoring purpose
-        break;
-
-    // Additional commands that are not compatible with MultiWii
-    case MSP_ACC_TRIM:
-        headSerialReply(4);
-        serialize16(currentProfile->accelerometerTrims.values.pitch);
-        serialize16(currentProfile->accelerometerTrims.values.roll);
-        break;
-
-    case MSP_UID:
-        headSerialReply(12);
-        serialize32(U_ID_0);
-        serialize32(U_ID_1);
-        serialize32(U_ID_2);
-        break;
-
-    case MSP_FEATURE:
-        headSerialReply(4);
-        serialize32(featureMask());
-        break;
-
-    case MSP_BOARD_ALIGNMENT:
-        headSerialReply(3);
-        serialize16(masterConfig.boardAlignment.rollDegrees);
-        serialize16(masterConfig.boardAlignment.pitchDegrees);
-        serialize16(masterConfig.boardAlignment.yawDegrees);
-        break;
-
-    case MSP_CURRENT_METER_CONFIG:
-        headSerialReply(4);
-        serialize16(masterConfig.batteryConfig.currentMeterScale);
-        serialize16(masterConfig.batteryConfig.currentMeterOffset);
-        break;
-
-    case MSP_MIXER:
-        headSerialReply(1);
-        serialize8(masterConfig.mixerConfiguration);
-        break;
-
-    case MSP_RX_CONFIG:
-        headSerialReply(7);
-        serialize8(masterConfig.rxConfig.serialrx_provider);
-        serialize16(masterConfig.rxConfig.maxcheck);
-        serialize16(masterConfig.rxConfig.midrc);
-        serialize16(masterConfig.rxConfig.mincheck);
-
-    case MSP_RSSI_CONFIG:
-        headSerialReply(1);
-        serialize8(masterConfig.rxConfig.rssi_channel);
-        break;
-
-    case MSP_RX_MAP:
-        headSerialReply(MAX_MAPPABLE_RX_INPUTS);
-        for (i = 0; i < MAX_MAPPABLE_RX_INPUTS; i++)
-            serialize8(masterConfig.rxConfig.rcmap[i]);
-        break;
+    }
+    return true;
+}
 
-#ifdef LED_STRIP
-    case MSP_LED_COLORS:
-        headSerialReply(CONFIGURABLE_COLOR_COUNT * 4);
-        for (i = 0; i < CONFIGURABLE_COLOR_COUNT; i++) {
-            hsvColor_t *color = &masterConfig.colors[i];
-            serialize16(color->h);
-            serialize8(color->s);
-            serialize8(color->v);
-        }
-        break;
-
-    case MSP_LED_STRIP_CONFIG:
-        headSerialReply(MAX_LED_STRIP_LENGTH * 4);
-        for (i = 0; i < MAX_LED_STRIP_LENGTH; i++) {
-            ledConfig_t *ledConfig = &masterConfig.ledConfigs[i];
-            serialize16((ledConfig->flags & LED_DIRECTION_MASK) >> LED_DIRECTION_BIT_OFFSET);
-            serialize16((ledConfig->flags & LED_FUNCTION_MASK) >> LED_FUNCTION_BIT_OFFSET);
-            serialize8(GET_LED_X(ledConfig));
-            serialize8(GET_LED_Y(ledConfig));
-        }
-        break;
-#endif
+static bool mspPidNames(void)
+{
+    headSerialReply(sizeof(pidnames) - 1);
+    serializeNames(pidnames);
+    return true;
+}
 
-    default:
-        return false;
+static bool mspModeRanges(void)
+{
+    uint32_t i;
+
+    headSerialReply(4 * MAX_MODE_ACTIVATION_CONDITION_COUNT);
+    for (i = 0; i < MAX_MODE_ACTIVATION_CONDITION_COUNT; i++) {
+        modeActivationCondition_t *mac = &currentProfile->modeActivationConditions[i];
+        const box_t *box = &boxes[mac->modeId];
+        serialize8(box->permanentId);
+        serialize8(mac->auxChannelIndex);
+        serialize8(mac->rangeStartStep);
+        serialize8(mac->rangeEndStep);
     }
     return true;
 }
 
-static bool processInCommand(void)
+static bool mspBoxNames(void)
+{
+    // headSerialReply(sizeof(boxnames) - 1);
+    serializeBoxNamesReply();
+    return true;
+}
+
+static bool mspBoxIds(void)
 {
     uint32_t i;
-#ifdef GPS
-    uint8_t wp_no;
-    int32_t lat = 0, lon = 0, alt = 0;
-#endif
 
-    switch (currentPort->cmdMSP) {
-    case MSP_SELECT_SETTING:
-        if (!ARMING_FLAG(ARMED)) {
-            masterConfig.current_profile_index = read8();
-            if (masterConfig.current_profile_index > 2) {
-                masterConfig.current_profile_index = 0;
-            }
-            writeEEPROM();
-            readEEPROM();
-        }
-        break;
-    case MSP_SET_HEAD:
-        magHold = read16();
-        break;
-    case MSP_SET_RAW_RC:
-        // FIXME need support for more than 8 channels
-        for (i = 0; i < 8; i++)
-            rcData[i] = read16();
-        rxMspFrameRecieve();
-        break;
-    case MSP_SET_ACC_TRIM:
-        currentProfile->accelerometerTrims.values.pitch = read16();
-        currentProfile->accelerometerTrims.values.roll  = read16();
-        break;
-    case MSP_SET_PID:
-        if (currentProfile->pidController == 2) {
-            for (i = 0; i < 3; i++) {
-                currentProfile->pidProfile.P_f[i] = (float)read8() / 10.0f;
-                currentProfile->pidProfile.I_f[i] = (float)read8() / 100.0f;
-                currentProfile->pidProfile.D_f[i] = (float)read8() / 1000.0f;
-            }
-            for (i = 3; i < PID_ITEM_COUNT; i++) {
-                if (i == PIDLEVEL) {
-                    currentProfile->pidProfile.A_level = (float)read8() / 10.0f;
-                    currentProfile->pidProfile.H_level = (float)read8() / 10.0f;
-                    read8();
-                } else {
-                    currentProfile->pidProfile.P8[i] = read8();
-                    currentProfile->pidProfile.I8[i] = read8();
-                    currentProfile->pidProfile.D8[i] = read8();
-                }
-            }
-        } else {
-            for (i = 0; i < PID_ITEM_COUNT; i++) {
-                currentProfile->pidProfile.P8[i] = read8();
-                currentProfile->pidProfile.I8[i] = read8();
-                currentProfile->pidProfile.D8[i] = read8();
-            }
-        }
-        break;
-    case MSP_SET_MODE_RANGE:
-        i = read8();
-        if (i < MAX_MODE_ACTIVATION_CONDITION_COUNT) {
-            modeActivationCondition_t *mac = &currentProfile->modeActivationConditions[i];
-            i = read8();
-            const box_t *box = findBoxByPermenantId(i);
-            if (box) {
-                mac->modeId = box->boxId;
-                mac->auxChannelIndex = read8();
-                mac->rangeStartStep = read8();
-                mac->rangeEndStep = read8();
-            } else {
-                headSerialError(0);
-            }
-        } else {
-            headSerialError(0);
-        }
-        break;
-    case MSP_SET_RC_TUNING:
-        currentProfile->controlRateConfig.rcRate8 = read8();
-        currentProfile->controlRateConfig.rcExpo8 = read8();
-        currentProfile->controlRateConfig.rollPitchRate = read8();
-        currentProfile->controlRateConfig.yawRate = read8();
-        currentProfile->dynThrPID = read8();
-        currentProfile->controlRateConfig.thrMid8 = read8();
-        currentProfile->controlRateConfig.thrExpo8 = read8();
-        break;
-    case MSP_SET_MISC:
-        read16(); // powerfailmeter
-        masterConfig.escAndServoConfig.minthrottle = read16();
-        masterConfig.escAndServoConfig.maxthrottle = read16();
-        masterConfig.escAndServoConfig.mincommand = read16();
-        currentProfile->failsafeConfig.failsafe_throttle = read16();
-        read16();
-        read32();
-        currentProfile->mag_declination = read16() * 10;
-        masterConfig.batteryConfig.vbatscale = read8();           // actual vbatscale as intended
-        masterConfig.batteryConfig.vbatmincellvoltage = read8();  // vbatlevel_warn1 in MWC2.3 GUI
-        masterConfig.batteryConfig.vbatmaxcellvoltage = read8();  // vbatlevel_warn2 in MWC2.3 GUI
-        read8();                            // vbatlevel_crit (unused)
-        break;
-    case MSP_SET_MOTOR:
-        for (i = 0; i < 8; i++) // FIXME should this use MAX_MOTORS or MAX_SUPPORTED_MOTORS instead of 8
-            motor_disarmed[i] = read16();
-        break;
-    case MSP_SET_SERVO_CONF:
-        for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
-            currentProfile->servoConf[i].min = read16();
-            currentProfile->servoConf[i].max = read16();
-            // provide temporary support for old clients that try and send a channel index instead of a servo middle
-            uint16_t potentialServoMiddleOrChannelToForward = read16();
-            if (potentialServoMiddleOrChannelToForward < MAX_SUPPORTED_SERVOS) {
-                currentProfile->servoConf[i].forwardFromChannel = potentialServoMiddleOrChannelToForward;
-            }
-            if (potentialServoMiddleOrChannelToForward >= PWM_RANGE_MIN && potentialServoMiddleOrChannelToForward <= PWM_RANGE_MAX) {
-                currentProfile->servoConf[i].middle = potentialServoMiddleOrChannelToForward;
-            }
-            currentProfile->servoConf[i].rate = read8();
-        }
-        break;
-    case MSP_SET_CHANNEL_FORWARDING:
-        for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
-            currentProfile->servoConf[i].forwardFromChannel = read8();
-        }
-        break;
-    case MSP_RESET_CONF:
-        if (!ARMING_FLAG(ARMED)) {
-            resetEEPROM();
-            readEEPROM();
-        }
-        break;
-    case MSP_ACC_CALIBRATION:
-        if (!ARMING_FLAG(ARMED))
-            accSetCalibrationCycles(CALIBRATING_ACC_CYCLES);
-        break;
-    case MSP_MAG_CALIBRATION:
-        if (!ARMING_FLAG(ARMED))
-            ENABLE_STATE(CALIBRATE_MAG);
-        break;
-    case MSP_EEPROM_WRITE:
-        if (ARMING_FLAG(ARMED)) {
-            headSerialError(0);
-            return true;
-        }
-        writeEEPROM();
-        readEEPROM();
-        break;
-#ifdef GPS
-    case MSP_SET_RAW_GPS:
-        if (read8()) {
-            ENABLE_STATE(GPS_FIX);
-        } else {
-            DISABLE_STATE(GPS_FIX);
-        }
-        GPS_numSat = read8();
-        GPS_coord[LAT] = read32();
-        GPS_coord[LON] = read32();
-        GPS_altitude = read16();
-        GPS_speed = read16();
-        GPS_update |= 2;        // New data signalisation to GPS functions // FIXME Magic Numbers
-        break;
-    case MSP_SET_WP:
-        wp_no = read8();    //get the wp number
-        lat = read32();
-        lon = read32();
-        alt = read32();     // to set altitude (cm)
-        read16();           // future: to set heading (deg)
-        read16();           // future: to set time to stay (ms)
-        read8();            // future: to set nav flag
-        if (wp_no == 0) {
-            GPS_home[LAT] = lat;
-            GPS_home[LON] = lon;
-            DISABLE_FLIGHT_MODE(GPS_HOME_MODE);        // with this flag, GPS_set_next_wp will be called in the next loop -- OK with SERIAL GPS / OK with I2C GPS
-            ENABLE_STATE(GPS_FIX_HOME);
-            if (alt != 0)
-                AltHold = alt;          // temporary implementation to test feature with apps
-        } else if (wp_no == 16) {       // OK with SERIAL GPS  --  NOK for I2C GPS / needs more code dev in order to inject GPS coord inside I2C GPS
-            GPS_hold[LAT] = lat;
-            GPS_hold[LON] = lon;
-            if (alt != 0)
-                AltHold = alt;          // temporary implementation to test feature with apps
-            nav_mode = NAV_MODE_WP;
-            GPS_set_next_wp(&GPS_hold[LAT], &GPS_hold[LON]);
+    headSerialReply(activeBoxIdCount);
+    for (i = 0; i < activeBoxIdCount; i++) {
+        const box_t *box = findBoxByActiveBoxId(activeBoxIds[i]);
+        if (!box) {
+            continue;
         }
-        break;
-#endif
-    case MSP_SET_FEATURE:
-        headSerialReply(0);
-        featureClearAll();
-        featureSet(read32()); // features bitmap
-        break;
+        serialize8(box->permanentId);
+    }
+    return true;
+}
 
-    case MSP_SET_BOARD_ALIGNMENT:
-        headSerialReply(0);
-        masterConfig.boardAlignment.rollDegrees = read16();
-        masterConfig.boardAlignment.pitchDegrees = read16();
-        masterConfig.boardAlignment.yawDegrees = read16();
-        break;
+static bool mspMisc(void)
+{
+    headSerialReply(2 * 6 + 4 + 2 + 4);
+    serialize16(0); // intPowerTrigger1 (aka useless trash)
+    serialize16(masterConfig.escAndServoConfig.minthrottle);
+    serialize16(masterConfig.escAndServoConfig.maxthrottle);
+    serialize16(masterConfig.escAndServoConfig.mincommand);
+    serialize16(currentProfile->failsafeConfig.failsafe_throttle);
+    serialize16(0); // plog useless shit
+    serialize32(0); // plog useless shit
+    serialize16(currentProfile->mag_declination / 10); // TODO check this shit
+    serialize8(masterConfig.batteryConfig.vbatscale);
+    serialize8(masterConfig.batteryConfig.vbatmincellvoltage);
+    serialize8(masterConfig.batteryConfig.vbatmaxcellvoltage);
+    serialize8(0);
+    return true;
+}
 
-    case MSP_SET_CURRENT_METER_CONFIG:
-        headSerialReply(0);
-        masterConfig.batteryConfig.currentMeterScale = read16();
-        masterConfig.batteryConfig.currentMeterOffset = read16();
-        break;
+static bool mspMotorPins(void)
+{
+    uint32_t i;
 
-    case MSP_SET_MIXER:
-        headSerialReply(0);
-        masterConfig.mixerConfiguration = read8();
-        break;
+    headSerialReply(8);
+    for (i = 0; i < 8; i++)
+        serialize8(i + 1);
+    return true;
+}
 
-    case MSP_SET_RX_CONFIG:
-        headSerialReply(0);
-        masterConfig.rxConfig.serialrx_provider = read8();
-        masterConfig.rxConfig.maxcheck = read16();
-        masterConfig.rxConfig.midrc = read16();
-        masterConfig.rxConfig.mincheck = read16();
-        break;
+#ifdef GPS
+static bool mspRawGps(void)
+{
+    headSerialReply(16);
+    serialize8(STATE(GPS_FIX));
+    serialize8(GPS_numSat);
+    serialize32(GPS_coord[LAT]);
+    serialize32(GPS_coord[LON]);
+    serialize16(GPS_altitude);
+    serialize16(GPS_speed);
+    serialize16(GPS_ground_course);
+    return true;
+}
 
-    case MSP_SET_RSSI_CONFIG:
-        headSerialReply(0);
-        masterConfig.rxConfig.rssi_channel = read8();
-        break;
+static bool mspCompGps(void)
+{
+    headSerialReply(5);
+    serialize16(GPS_distanceToHome);
+    serialize16(GPS_directionToHome);
+    serialize8(GPS_update & 1);
+    return true;
+}
 
+static bool mspWp(void)
+{
+    uint8_t wp_no;
+    int32_t lat = 0, lon = 0;
 
-    case MSP_SET_RX_MAP:
-        headSerialReply(0);
-        for (i = 0; i < MAX_MAPPABLE_RX_INPUTS; i++) {
-            masterConfig.rxConfig.rcmap[i] = read8();
-        }
-        break;
+    wp_no = read8();    // get the wp number
+    headSerialReply(18);
+    if (wp_no == 0) {
+        lat = GPS_home[LAT];
+        lon = GPS_home[LON];
+    } else if (wp_no == 16) {
+        lat = GPS_hold[LAT];
+        lon = GPS_hold[LON];
+    }
+    serialize8(wp_no);
+    serialize32(lat);
+    serialize32(lon);
+    serialize32(AltHold);           // altitude (cm) will come here -- temporary implementation to test feature with apps
+    serialize16(0);                 // heading  will come here (deg)
+    serialize16(0);                 // time to stay (ms) will come here
+    serialize8(0);                  // nav flag will come here
+    return true;
+}
 
-#ifdef LED_STRIP
-    case MSP_SET_LED_COLORS:
-        headSerialReply(0);
-        for (i = 0; i < CONFIGURABLE_COLOR_COUNT; i++) {
-            hsvColor_t *color = &masterConfig.colors[i];
-            color->h = read16();
-            color->s = read8();
-            color->v = read8();
-        }
-        break;
-
-    case MSP_SET_LED_STRIP_CONFIG:
-        headSerialReply(MAX_LED_STRIP_LENGTH * 6);
-        for (i = 0; i < MAX_LED_STRIP_LENGTH; i++) {
-            ledConfig_t *ledConfig = &masterConfig.ledConfigs[i];
-            uint16_t mask;
-            // currently we're storing directions and functions in a uint16 (flags)
-            // the msp uses 2 x uint16_t to cater for future expansion
-            mask = read16();
-            ledConfig->flags = (mask << LED_DIRECTION_BIT_OFFSET) & LED_DIRECTION_MASK;
-
-            mask = read16();
-            ledConfig->flags |= (mask << LED_FUNCTION_BIT_OFFSET) & LED_FUNCTION_MASK;
-
-            mask = read8();
-            ledConfig->xy = CALCULATE_LED_X(mask);
-
-            mask = read8();
-            ledConfig->xy |= CALCULATE_LED_Y(mask);
-        }
-        break;
+static bool mspGpsSvInfo(void)
+{
+    uint32_t i;
+
+    headSerialReply(1 + (GPS_numCh * 4));
+    serialize8(GPS_numCh);
+    for (i = 0; i < GPS_numCh; i++) {
+        serialize8(GPS_svinfo_chn[i]);
+        serialize8(GPS_svinfo_svid[i]);
+        serialize8(GPS_svinfo_quality[i]);
+        serialize8(GPS_svinfo_cno[i]);
+    }
+    return true;
+}
 #endif
-    case MSP_REBOOT:
-        headSerialReply(0);
-        isRebootScheduled = true;
-        break;
 
-    default:
-        // we do not know how to handle the (valid) message, indicate error MSP $M!
+static bool mspDebug(void)
+{
+    uint32_t i;
+
+    headSerialReply(8);
+    // make use of this crap, output some useful QA statistics
+    //debug[3] = ((hse_value / 1000000) * 1000) + (SystemCoreClock / 1000000);         // XX0YY [crystal clock : core clock]
+    for (i = 0; i < 4; i++)
+        serialize16(debug[i]);      // 4 variables are here for general monitoring purpose
+    return true;
+}
+
+#ifdef PROFILING
+static bool mspProfile(void)
+{
+    uint32_t i;
+
+    i = currentPort->dataSize > 0 ? read8() : 0;
+    if (i >= PROFILE_STAGE_COUNT) {
         return false;
     }
-    headSerialReply(0);
+    {
+        const profileStageStats_t *stats = getProfileStageStats(i);
+        headSerialReply(1 + 1 + 1 + 2 + 4 * 4 + PROFILE_HISTOGRAM_BUCKET_COUNT * 2);
+        serialize8(i);
+        serialize8(PROFILE_STAGE_COUNT);
+        serialize8(PROFILE_HISTOGRAM_BUCKET_COUNT);
+        serialize16(getProfileCyclesPerMicrosecond());
+        serialize32(stats->count);
+        serialize32(stats->count ? stats->minCycles : 0);
+        serialize32(getProfileStageAverageCycles(i));
+        serialize32(stats->maxCycles);
+        for (uint8_t bucket = 0; bucket < PROFILE_HISTOGRAM_BUCKET_COUNT; bucket++) {
+            serialize16(stats->histogram[bucket]);
+        }
+    }
     return true;
 }
+#endif
 
-static void mspProcessPort(void)
+// Additional commands that are not compatible with MultiWii
+static bool mspAccTrim(void)
 {
-    uint8_t c;
-
-    while (serialTotalBytesWaiting(mspSerialPort)) {
-        c = serialRead(mspSerialPort);
-
-        if (currentPort->c_state == IDLE) {
-            currentPort->c_state = (c == '$') ? HEADER_START : IDLE;
-            if (currentPort->c_state == IDLE && !ARMING_FLAG(ARMED))
-                evaluateOtherData(c); // if not armed evaluate all other incoming serial data
-        } else if (currentPort->c_state == HEADER_START) {
-            currentPort->c_state = (c == 'M') ? HEADER_M : IDLE;
-        } else if (currentPort->c_state == HEADER_M) {
-            currentPort->c_state = (c == '<') ? HEADER_ARROW : IDLE;
-        } else if (currentPort->c_state == HEADER_ARROW) {
-            if (c > INBUF_SIZE) {       // now we are expecting the payload size
-                currentPort->c_state = IDLE;
-                continue;
-            }
-            currentPort->dataSize = c;
-            currentPort->offset = 0;
-            currentPort->checksum = 0;
-            currentPort->indRX = 0;
-            currentPort->checksum ^= c;
-            currentPort->c_state = HEADER_SIZE;      // the command is to follow
-        } else if (currentPort->c_state == HEADER_SIZE) {
-            currentPort->cmdMSP = c;
-            currentPort->checksum ^= c;
-            currentPort->c_state = HEADER_CMD;
-        } else if (currentPort->c_state == HEADER_CMD && currentPort->offset < currentPort->dataSize) {
-            currentPort->checksum ^= c;
-            currentPort->inBuf[currentPort->offset++] = c;
-        } else if (currentPort->c_state == HEADER_CMD && currentPort->offset >= currentPort->dataSize) {
-            if (currentPort->checksum == c) {        // compare calculated and transferred checksum
-                // we got a valid packet, evaluate it
-                if (!(processOutCommand(currentPort->cmdMSP) || processInCommand())) {
-                    headSerialError(0);
-                }
-                tailSerialReply();
-            }
-            currentPort->c_state = IDLE;
+    headSerialReply(4);
+    serialize16(currentProfile->accelerometerTrims.values.pitch);
+    serialize16(currentProfile->accelerometerTrims.values.roll);
+    return true;
+}
+
+static bool mspUid(void)
+{
+    headSerialReply(12);
+    serialize32(U_ID_0);
+    serialize32(U_ID_1);
+    serialize32(U_ID_2);
+    return true;
+}
+
+static bool mspFeature(void)
+{
+    headSerialReply(4);
+    serialize32(featureMask());
+    return true;
+}
+
+static bool mspBoardAlignment(void)
+{
+    headSerialReply(3);
+    serialize16(masterConfig.boardAlignment.rollDegrees);
+    serialize16(masterConfig.boardAlignment.pitchDegrees);
+    serialize16(masterConfig.boardAlignment.yawDegrees);
+    return true;
+}
+
+static bool mspCurrentMeterConfig(void)
+{
+    headSerialReply(4);
+    serialize16(masterConfig.batteryConfig.currentMeterScale);
+    serialize16(masterConfig.batteryConfig.currentMeterOffset);
+    return true;
+}
+
+static bool mspMixer(void)
+{
+    headSerialReply(1);
+    serialize8(masterConfig.mixerConfiguration);
+    return true;
+}
+
+static bool mspRxConfig(void)
+{
+    headSerialReply(7);
+    serialize8(masterConfig.rxConfig.serialrx_provider);
+    serialize16(masterConfig.rxConfig.maxcheck);
+    serialize16(masterConfig.rxConfig.midrc);
+    serialize16(masterConfig.rxConfig.mincheck);
+    return true;
+}
+
+static bool mspRssiConfig(void)
+{
+    headSerialReply(1);
+    serialize8(masterConfig.rxConfig.rssi_channel);
+    return true;
+}
+
+static bool mspRxMap(void)
+{
+    uint32_t i;
+
+    headSerialReply(MAX_MAPPABLE_RX_INPUTS);
+    for (i = 0; i < MAX_MAPPABLE_RX_INPUTS; i++)
+        serialize8(masterConfig.rxConfig.rcmap[i]);
+    return true;
+}
+
+#ifdef LED_STRIP
+static bool mspLedColors(void)
+{
+    uint32_t i;
+
+    headSerialReply(CONFIGURABLE_COLOR_COUNT * 4);
+    for (i = 0; i < CONFIGURABLE_COLOR_COUNT; i++) {
+        hsvColor_t *color = &masterConfig.colors[i];
+        serialize16(color->h);
+        serialize8(color->s);
+        serialize8(color->v);
+    }
+    return true;
+}
+
+static bool mspLedStripConfig(void)
+{
+    uint32_t i;
+
+    headSerialReply(MAX_LED_STRIP_LENGTH * 4);
+    for (i = 0; i < MAX_LED_STRIP_LENGTH; i++) {
+        ledConfig_t *ledConfig = &masterConfig.ledConfigs[i];
+        serialize16((ledConfig->flags & LED_DIRECTION_MASK) >> LED_DIRECTION_BIT_OFFSET);
+        serialize16((ledConfig->flags & LED_FUNCTION_MASK) >> LED_FUNCTION_BIT_OFFSET);
+        serialize8(GET_LED_X(ledConfig));
+        serialize8(GET_LED_Y(ledConfig));
+    }
+    return true;
+}
+#endif
+
+static bool mspSelectSetting(void)
+{
+    masterConfig.current_profile_index = read8();
+    if (masterConfig.current_profile_index > 2) {
+        masterConfig.current_profile_index = 0;
+    }
+    writeEEPROM();
+    readEEPROM();
+    return true;
+}
+
+static bool mspSetHead(void)
+{
+    magHold = read16();
+    return true;
+}
+
+static bool mspSetRawRc(void)
+{
+    uint32_t i;
+
+    // FIXME need support for more than 8 channels
+    for (i = 0; i < 8; i++)
+        rcData[i] = read16();
+    rxMspFrameRecieve();
+    return true;
+}
+
+static bool mspSetAccTrim(void)
+{
+    currentProfile->accelerometerTrims.values.pitch = read16();
+    currentProfile->accelerometerTrims.values.roll  = read16();
+    return true;
+}
+
+static bool mspSetPid(void)
+{
+    uint32_t i;
+
+    if (currentProfile->pidController == 2) {
+        for (i = 0; i < 3; i++) {
+            currentProfile->pidProfile.P_f[i] = (float)read8() / 10.0f;
+            currentProfile->pidProfile.I_f[i] = (float)read8() / 100.0f;
+            currentProfile->pidProfile.D_f[i] = (float)read8() / 1000.0f;
+        }
+        for (i = 3; i < PID_ITEM_COUNT; i++) {
+            if (i == PIDLEVEL) {
+                currentProfile->pidProfile.A_level = (float)read8() / 10.0f;
+                currentProfile->pidProfile.H_level = (float)read8() / 10.0f;
+                read8();
+            } else {
+                currentProfile->pidProfile.P8[i] = read8();
+                currentProfile->pidProfile.I8[i] = read8();
+                currentProfile->pidProfile.D8[i] = read8();
+            }
+        }
+    } else {
+        for (i = 0; i < PID_ITEM_COUNT; i++) {
+            currentProfile->pidProfile.P8[i] = read8();
+            currentProfile->pidProfile.I8[i] = read8();
+            currentProfile->pidProfile.D8[i] = read8();
+        }
+    }
+    return true;
+}
+
+static bool mspSetModeRange(void)
+{
+    uint32_t i;
+
+    i = read8();
+    if (i >= MAX_MODE_ACTIVATION_CONDITION_COUNT) {
+        return false;
+    }
+
+    modeActivationCondition_t *mac = &currentProfile->modeActivationConditions[i];
+    i = read8();
+    const box_t *box = findBoxByPermenantId(i);
+    if (!box) {
+        return false;
+    }
+
+    mac->modeId = box->boxId;
+    mac->auxChannelIndex = read8();
+    mac->rangeStartStep = read8();
+    mac->rangeEndStep = read8();
+    return true;
+}
+
+static bool mspSetRcTuning(void)
+{
+    currentProfile->controlRateConfig.rcRate8 = read8();
+    currentProfile->controlRateConfig.rcExpo8 = read8();
+    currentProfile->controlRateConfig.rollPitchRate = read8();
+    currentProfile->controlRateConfig.yawRate = read8();
+    currentProfile->dynThrPID = read8();
+    currentProfile->controlRateConfig.thrMid8 = read8();
+    currentProfile->controlRateConfig.thrExpo8 = read8();
+    return true;
+}
+
+static bool mspSetMisc(void)
+{
+    read16(); // powerfailmeter
+    masterConfig.escAndServoConfig.minthrottle = read16();
+    masterConfig.escAndServoConfig.maxthrottle = read16();
+    masterConfig.escAndServoConfig.mincommand = read16();
+    currentProfile->failsafeConfig.failsafe_throttle = read16();
+    read16();
+    read32();
+    currentProfile->mag_declination = read16() * 10;
+    masterConfig.batteryConfig.vbatscale = read8();           // actual vbatscale as intended
+    masterConfig.batteryConfig.vbatmincellvoltage = read8();  // vbatlevel_warn1 in MWC2.3 GUI
+    masterConfig.batteryConfig.vbatmaxcellvoltage = read8();  // vbatlevel_warn2 in MWC2.3 GUI
+    read8();                            // vbatlevel_crit (unused)
+    return true;
+}
+
+static bool mspSetMotor(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < 8; i++) // FIXME should this use MAX_MOTORS or MAX_SUPPORTED_MOTORS instead of 8
+        motor_disarmed[i] = read16();
+    return true;
+}
+
+static bool mspSetServoConf(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        currentProfile->servoConf[i].min = read16();
+        currentProfile->servoConf[i].max = read16();
+        // provide temporary support for old clients that try and send a channel index instead of a servo middle
+        uint16_t potentialServoMiddleOrChannelToForward = read16();
+        if (potentialServoMiddleOrChannelToForward < MAX_SUPPORTED_SERVOS) {
+            currentProfile->servoConf[i].forwardFromChannel = potentialServoMiddleOrChannelToForward;
+        }
+        if (potentialServoMiddleOrChannelToForward >= PWM_RANGE_MIN && potentialServoMiddleOrChannelToForward <= PWM_RANGE_MAX) {
+            currentProfile->servoConf[i].middle = potentialServoMiddleOrChannelToForward;
+        }
+        currentProfile->servoConf[i].rate = read8();
+    }
+    return true;
+}
+
+static bool mspSetChannelForwarding(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        currentProfile->servoConf[i].forwardFromChannel = read8();
+    }
+    return true;
+}
+
+static bool mspResetConf(void)
+{
+    resetEEPROM();
+    readEEPROM();
+    return true;
+}
+
+static bool mspAccCalibration(void)
+{
+    accSetCalibrationCycles(CALIBRATING_ACC_CYCLES);
+    return true;
+}
+
+static bool mspMagCalibration(void)
+{
+    ENABLE_STATE(CALIBRATE_MAG);
+    return true;
+}
+
+static bool mspEepromWrite(void)
+{
+    writeEEPROM();
+    readEEPROM();
+    return true;
+}
+
+#ifdef GPS
+static bool mspSetRawGps(void)
+{
+    if (read8()) {
+        ENABLE_STATE(GPS_FIX);
+    } else {
+        DISABLE_STATE(GPS_FIX);
+    }
+    GPS_numSat = read8();
+    GPS_coord[LAT] = read32();
+    GPS_coord[LON] = read32();
+    GPS_altitude = read16();
+    GPS_speed = read16();
+    GPS_update |= 2;        // New data signalisation to GPS functions // FIXME Magic Numbers
+    return true;
+}
+
+static bool mspSetWp(void)
+{
+    uint8_t wp_no;
+    int32_t lat = 0, lon = 0, alt = 0;
+
+    wp_no = read8();    //get the wp number
+    lat = read32();
+    lon = read32();
+    alt = read32();     // to set altitude (cm)
+    read16();           // future: to set heading (deg)
+    read16();           // future: to set time to stay (ms)
+    read8();            // future: to set nav flag
+    if (wp_no == 0) {
+        GPS_home[LAT] = lat;
+        GPS_home[LON] = lon;
+        DISABLE_FLIGHT_MODE(GPS_HOME_MODE);        // with this flag, GPS_set_next_wp will be called in the next loop -- OK with SERIAL GPS / OK with I2C GPS
+        ENABLE_STATE(GPS_FIX_HOME);
+        if (alt != 0)
+            AltHold = alt;          // temporary implementation to test feature with apps
+    } else if (wp_no == 16) {       // OK with SERIAL GPS  --  NOK for I2C GPS / needs more code dev in order to inject GPS coord inside I2C GPS
+        GPS_hold[LAT] = lat;
+        GPS_hold[LON] = lon;
+        if (alt != 0)
+            AltHold = alt;          // temporary implementation to test feature with apps
+        nav_mode = NAV_MODE_WP;
+        GPS_set_next_wp(&GPS_hold[LAT], &GPS_hold[LON]);
+    }
+    return true;
+}
+#endif
+
+static bool mspSetFeature(void)
+{
+    featureClearAll();
+    featureSet(read32()); // features bitmap
+    return true;
+}
+
+static bool mspSetBoardAlignment(void)
+{
+    masterConfig.boardAlignment.rollDegrees = read16();
+    masterConfig.boardAlignment.pitchDegrees = read16();
+    masterConfig.boardAlignment.yawDegrees = read16();
+    return true;
+}
+
+static bool mspSetCurrentMeterConfig(void)
+{
+    masterConfig.batteryConfig.currentMeterScale = read16();
+    masterConfig.batteryConfig.currentMeterOffset = read16();
+    return true;
+}
+
+static bool mspSetMixer(void)
+{
+    masterConfig.mixerConfiguration = read8();
+    return true;
+}
+
+static bool mspSetRxConfig(void)
+{
+    masterConfig.rxConfig.serialrx_provider = read8();
+    masterConfig.rxConfig.maxcheck = read16();
+    masterConfig.rxConfig.midrc = read16();
+    masterConfig.rxConfig.mincheck = read16();
+    return true;
+}
+
+static bool mspSetRssiConfig(void)
+{
+    masterConfig.rxConfig.rssi_channel = read8();
+    return true;
+}
+
+static bool mspSetRxMap(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < MAX_MAPPABLE_RX_INPUTS; i++) {
+        masterConfig.rxConfig.rcmap[i] = read8();
+    }
+    return true;
+}
+
+#ifdef LED_STRIP
+static bool mspSetLedColors(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < CONFIGURABLE_COLOR_COUNT; i++) {
+        hsvColor_t *color = &masterConfig.colors[i];
+        color->h = read16();
+        color->s = read8();
+        color->v = read8();
+    }
+    return true;
+}
+
+static bool mspSetLedStripConfig(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < MAX_LED_STRIP_LENGTH; i++) {
+        ledConfig_t *ledConfig = &masterConfig.ledConfigs[i];
+        uint16_t mask;
+        // currently we're storing directions and functions in a uint16 (flags)
+        // the msp uses 2 x uint16_t to cater for future expansion
+        mask = read16();
+        ledConfig->flags = (mask << LED_DIRECTION_BIT_OFFSET) & LED_DIRECTION_MASK;
+
+        mask = read16();
+        ledConfig->flags |= (mask << LED_FUNCTION_BIT_OFFSET) & LED_FUNCTION_MASK;
+
+        mask = read8();
+        ledConfig->xy = CALCULATE_LED_X(mask);
+
+        mask = read8();
+        ledConfig->xy |= CALCULATE_LED_Y(mask);
+    }
+    return true;
+}
+#endif
+
+static bool mspReboot(void)
+{
+    isRebootScheduled = true;
+    return true;
+}
+
+static bool processOutCommand(uint16_t cmdMSP);
+
+static void processBatchEntry(uint16_t index)
+{
+    currentPort->cmdMSP = currentPort->inBuf[index * 2] | (currentPort->inBuf[index * 2 + 1] << 8);
+    currentPort->indRX = currentPort->dataSize;     // the listed commands get no payload
+
+    if (!processOutCommand(currentPort->cmdMSP)) {
+        headSerialError(0);
+    }
+}
+
+/*
+ * Answers the out messages listed in the payload, 16 bit command IDs, with one frame instead of one each. The reply is
+ * a sequence of entries, command (16 bits), result (8 bits, non zero when the command failed), size (16 bits) and the
+ * payload of the reply. The entries are in the order of the request and end before the first that does not fit into
+ * the transmit buffer, the client asks again for the rest.
+ */
+static bool mspBatch(void)
+{
+    uint16_t requestCount = currentPort->dataSize / 2;
+    uint16_t replyCount;
+    uint32_t sizeLimit = serialTxBytesFree(mspSerialPort);
+    uint32_t batchSize;
+
+    if (currentPort->batchState != MSP_BATCH_NONE) {
+        return false;   // a batch in a batch
+    }
+
+    sizeLimit = sizeLimit > MSP_V2_FRAME_OVERHEAD ? sizeLimit - MSP_V2_FRAME_OVERHEAD : 0;
+
+    // the size of the whole reply goes into the header, so the replies are measured before they are written
+    currentPort->batchState = MSP_BATCH_MEASURE;
+    currentPort->batchSize = 0;
+    for (replyCount = 0; replyCount < requestCount; replyCount++) {
+        batchSize = currentPort->batchSize;
+        processBatchEntry(replyCount);
+        if (currentPort->batchSize > sizeLimit) {
+            currentPort->batchSize = batchSize;
+            break;
+        }
+    }
+    batchSize = currentPort->batchSize;
+
+    currentPort->batchState = MSP_BATCH_NONE;
+    currentPort->cmdMSP = MSP_BATCH;
+    headSerialReply(batchSize);
+
+    currentPort->batchState = MSP_BATCH_WRITE;
+    for (uint16_t index = 0; index < replyCount; index++) {
+        processBatchEntry(index);
+    }
+
+    currentPort->batchState = MSP_BATCH_NONE;
+    currentPort->cmdMSP = MSP_BATCH;
+    return true;
+}
+
+/*
+ * Replies a part of the binary config dump, see config_dump.h. The payload gives the index to start at, 0 for the
+ * first part. The reply holds the format version of the dump, the index to ask for next and the records, the index
+ * to ask for next is 0 after the last part. A part is no larger than what fits into the transmit buffer, the reply is
+ * an error when not even one record fits and the client asks for the same index again.
+ */
+static bool mspConfigDump(void)
+{
+    configDumpRecord_t record;
+    uint8_t buffer[CONFIG_DUMP_RECORD_MAX_SIZE];
+    uint16_t startIndex = read16();
+    uint16_t endIndex;
+    uint16_t size = 0;
+    uint16_t index;
+    uint8_t i;
+    uint32_t bytesFree = serialTxBytesFree(mspSerialPort);
+    uint16_t sizeLimit;
+
+    if (startIndex >= configDumpIndexCount()) {
+        startIndex = 0;
+    }
+
+    bytesFree = bytesFree > MSP_V2_FRAME_OVERHEAD + MSP_CONFIG_DUMP_REPLY_HEADER_SIZE ?
+            bytesFree - MSP_V2_FRAME_OVERHEAD - MSP_CONFIG_DUMP_REPLY_HEADER_SIZE : 0;
+    sizeLimit = min(bytesFree, MSP_CONFIG_DUMP_CHUNK_SIZE);
+
+    // the records of the reply are counted first, the size goes into the header
+    for (endIndex = startIndex; endIndex < configDumpIndexCount(); endIndex++) {
+        if (!configDumpGetRecord(&masterConfig, endIndex, &record)) {
+            continue;
+        }
+        if (size + CONFIG_DUMP_RECORD_HEADER_SIZE + configDumpValueSize(record.type) > sizeLimit) {
+            break;
+        }
+        size += CONFIG_DUMP_RECORD_HEADER_SIZE + configDumpValueSize(record.type);
+    }
+
+    if (endIndex == startIndex && startIndex < configDumpIndexCount()) {
+        return false;
+    }
+
+    headSerialReply(MSP_CONFIG_DUMP_REPLY_HEADER_SIZE + size);
+    serialize8(CONFIG_DUMP_FORMAT_VERSION);
+    serialize16(endIndex < configDumpIndexCount() ? endIndex : 0);
+    for (index = startIndex; index < endIndex; index++) {
+        if (!configDumpGetRecord(&masterConfig, index, &record)) {
+            continue;
+        }
+        size = configDumpEncodeRecord(buffer, &record);
+        for (i = 0; i < size; i++) {
+            serialize8(buffer[i]);
+        }
+    }
+    return true;
+}
+
+/*
+ * Applies the records of a binary config dump, the payload is the format version followed by whole records. Values
+ * the firmware does not have and values out of range are skipped, the others are used once the config is saved.
+ */
+static bool mspSetConfigDump(void)
+{
+    configDumpRecord_t record;
+    uint8_t size;
+
+    if (read8() != CONFIG_DUMP_FORMAT_VERSION) {
+        return false;
+    }
+
+    while (currentPort->indRX < currentPort->dataSize) {
+        size = configDumpDecodeRecord(&currentPort->inBuf[currentPort->indRX], currentPort->dataSize - currentPort->indRX, &record);
+        if (size == 0) {
+            return false;
+        }
+        currentPort->indRX += size;
+
+        configDumpApplyRecord(&masterConfig, &record);
+    }
+    return true;
+}
+
+typedef enum {
+    MSP_DIRECTION_OUT,      // the handler writes the reply
+    MSP_DIRECTION_IN        // the handler reads the payload, the reply is empty
+} mspDirection_e;
+
+#define MSP_DISARMED_ONLY   (1 << 0)    // refused while armed
+
+typedef struct mspCommand_s {
+    uint16_t cmd;
+    uint8_t direction;          // see mspDirection_e
+    uint16_t minDataSize;       // shorter requests are refused
+    uint8_t flags;
+    bool (*handler)(void);      // returns false when the command failed, the reply is an error then
+} mspCommand_t;
+
+// sorted by command, see findMspCommand()
+static const mspCommand_t mspCommands[] = {
+    { MSP_API_VERSION, MSP_DIRECTION_OUT, 0, 0, mspApiVersion },
+    { MSP_CHANNEL_FORWARDING, MSP_DIRECTION_OUT, 0, 0, mspChannelForwarding },
+    { MSP_SET_CHANNEL_FORWARDING, MSP_DIRECTION_IN, MAX_SUPPORTED_SERVOS, 0, mspSetChannelForwarding },
+    { MSP_MODE_RANGES, MSP_DIRECTION_OUT, 0, 0, mspModeRanges },
+    { MSP_SET_MODE_RANGE, MSP_DIRECTION_IN, 5, 0, mspSetModeRange },
+    { MSP_FEATURE, MSP_DIRECTION_OUT, 0, 0, mspFeature },
+    { MSP_SET_FEATURE, MSP_DIRECTION_IN, 4, 0, mspSetFeature },
+    { MSP_BOARD_ALIGNMENT, MSP_DIRECTION_OUT, 0, 0, mspBoardAlignment },
+    { MSP_SET_BOARD_ALIGNMENT, MSP_DIRECTION_IN, 6, 0, mspSetBoardAlignment },
+    { MSP_CURRENT_METER_CONFIG, MSP_DIRECTION_OUT, 0, 0, mspCurrentMeterConfig },
+    { MSP_SET_CURRENT_METER_CONFIG, MSP_DIRECTION_IN, 4, 0, mspSetCurrentMeterConfig },
+    { MSP_MIXER, MSP_DIRECTION_OUT, 0, 0, mspMixer },
+    { MSP_SET_MIXER, MSP_DIRECTION_IN, 1, 0, mspSetMixer },
+    { MSP_RX_CONFIG, MSP_DIRECTION_OUT, 0, 0, mspRxConfig },
+    { MSP_SET_RX_CONFIG, MSP_DIRECTION_IN, 7, 0, mspSetRxConfig },
+#ifdef LED_STRIP
+    { MSP_LED_COLORS, MSP_DIRECTION_OUT, 0, 0, mspLedColors },
+    { MSP_SET_LED_COLORS, MSP_DIRECTION_IN, CONFIGURABLE_COLOR_COUNT * 4, 0, mspSetLedColors },
+    { MSP_LED_STRIP_CONFIG, MSP_DIRECTION_OUT, 0, 0, mspLedStripConfig },
+    { MSP_SET_LED_STRIP_CONFIG, MSP_DIRECTION_IN, MAX_LED_STRIP_LENGTH * 6, 0, mspSetLedStripConfig },
+#endif
+    { MSP_RSSI_CONFIG, MSP_DIRECTION_OUT, 0, 0, mspRssiConfig },
+    { MSP_SET_RSSI_CONFIG, MSP_DIRECTION_IN, 1, 0, mspSetRssiConfig },
+#ifdef PROFILING
+    { MSP_PROFILE, MSP_DIRECTION_OUT, 0, 0, mspProfile },
+#endif
+    { MSP_RX_MAP, MSP_DIRECTION_OUT, 0, 0, mspRxMap },
+    { MSP_SET_RX_MAP, MSP_DIRECTION_IN, MAX_MAPPABLE_RX_INPUTS, 0, mspSetRxMap },
+    { MSP_REBOOT, MSP_DIRECTION_IN, 0, 0, mspReboot },
+    { MSP_IDENT, MSP_DIRECTION_OUT, 0, 0, mspIdent },
+    { MSP_STATUS, MSP_DIRECTION_OUT, 0, 0, mspStatus },
+    { MSP_RAW_IMU, MSP_DIRECTION_OUT, 0, 0, mspRawImu },
+    { MSP_SERVO, MSP_DIRECTION_OUT, 0, 0, mspServo },
+    { MSP_MOTOR, MSP_DIRECTION_OUT, 0, 0, mspMotor },
+    { MSP_RC, MSP_DIRECTION_OUT, 0, 0, mspRc },
+#ifdef GPS
+    { MSP_RAW_GPS, MSP_DIRECTION_OUT, 0, 0, mspRawGps },
+    { MSP_COMP_GPS, MSP_DIRECTION_OUT, 0, 0, mspCompGps },
+#endif
+    { MSP_ATTITUDE, MSP_DIRECTION_OUT, 0, 0, mspAttitude },
+    { MSP_ALTITUDE, MSP_DIRECTION_OUT, 0, 0, mspAltitude },
+    { MSP_ANALOG, MSP_DIRECTION_OUT, 0, 0, mspAnalog },
+    { MSP_RC_TUNING, MSP_DIRECTION_OUT, 0, 0, mspRcTuning },
+    { MSP_PID, MSP_DIRECTION_OUT, 0, 0, mspPid },
+    { MSP_MISC, MSP_DIRECTION_OUT, 0, 0, mspMisc },
+    { MSP_MOTOR_PINS, MSP_DIRECTION_OUT, 0, 0, mspMotorPins },
+    { MSP_BOXNAMES, MSP_DIRECTION_OUT, 0, 0, mspBoxNames },
+    { MSP_PIDNAMES, MSP_DIRECTION_OUT, 0, 0, mspPidNames },
+#ifdef GPS
+    { MSP_WP, MSP_DIRECTION_OUT, 1, 0, mspWp },
+#endif
+    { MSP_BOXIDS, MSP_DIRECTION_OUT, 0, 0, mspBoxIds },
+    { MSP_SERVO_CONF, MSP_DIRECTION_OUT, 0, 0, mspServoConf },
+    { MSP_UID, MSP_DIRECTION_OUT, 0, 0, mspUid },
+#ifdef GPS
+    { MSP_GPSSVINFO, MSP_DIRECTION_OUT, 0, 0, mspGpsSvInfo },
+#endif
+    { MSP_SET_RAW_RC, MSP_DIRECTION_IN, 16, 0, mspSetRawRc },
+#ifdef GPS
+    { MSP_SET_RAW_GPS, MSP_DIRECTION_IN, 14, 0, mspSetRawGps },
+#endif
+    { MSP_SET_PID, MSP_DIRECTION_IN, 3 * PID_ITEM_COUNT, 0, mspSetPid },
+    { MSP_SET_RC_TUNING, MSP_DIRECTION_IN, 7, 0, mspSetRcTuning },
+    { MSP_ACC_CALIBRATION, MSP_DIRECTION_IN, 0, MSP_DISARMED_ONLY, mspAccCalibration },
+    { MSP_MAG_CALIBRATION, MSP_DIRECTION_IN, 0, MSP_DISARMED_ONLY, mspMagCalibration },
+    { MSP_SET_MISC, MSP_DIRECTION_IN, 22, 0, mspSetMisc },
+    { MSP_RESET_CONF, MSP_DIRECTION_IN, 0, MSP_DISARMED_ONLY, mspResetConf },
+#ifdef GPS
+    { MSP_SET_WP, MSP_DIRECTION_IN, 18, 0, mspSetWp },
+#endif
+    { MSP_SELECT_SETTING, MSP_DIRECTION_IN, 1, MSP_DISARMED_ONLY, mspSelectSetting },
+    { MSP_SET_HEAD, MSP_DIRECTION_IN, 2, 0, mspSetHead },
+    { MSP_SET_SERVO_CONF, MSP_DIRECTION_IN, 7 * MAX_SUPPORTED_SERVOS, 0, mspSetServoConf },
+    { MSP_SET_MOTOR, MSP_DIRECTION_IN, 16, 0, mspSetMotor },
+    { MSP_SET_ACC_TRIM, MSP_DIRECTION_IN, 4, 0, mspSetAccTrim },
+    { MSP_ACC_TRIM, MSP_DIRECTION_OUT, 0, 0, mspAccTrim },
+    { MSP_EEPROM_WRITE, MSP_DIRECTION_IN, 0, MSP_DISARMED_ONLY, mspEepromWrite },
+    { MSP_DEBUG, MSP_DIRECTION_OUT, 0, 0, mspDebug },
+    { MSP_BATCH, MSP_DIRECTION_OUT, 0, 0, mspBatch },
+    { MSP_CONFIG_DUMP, MSP_DIRECTION_OUT, 0, 0, mspConfigDump },
+    { MSP_SET_CONFIG_DUMP, MSP_DIRECTION_IN, 1, MSP_DISARMED_ONLY, mspSetConfigDump },
+};
+
+#define MSP_COMMAND_COUNT (sizeof(mspCommands) / sizeof(mspCommands[0]))
+
+#ifdef PROFILING
+static mspCommandStats_t mspCommandStats[MSP_COMMAND_COUNT];
+#endif
+
+static const mspCommand_t *findMspCommand(uint16_t cmdMSP)
+{
+    uint8_t low = 0;
+    uint8_t high = MSP_COMMAND_COUNT;
+
+    while (low < high) {
+        uint8_t middle = (low + high) / 2;
+        if (mspCommands[middle].cmd < cmdMSP) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low < MSP_COMMAND_COUNT && mspCommands[low].cmd == cmdMSP) {
+        return &mspCommands[low];
+    }
+    return NULL;
+}
+
+static bool processCommand(const mspCommand_t *command)
+{
+    bool result;
+
+    if (currentPort->dataSize < command->minDataSize) {
+        return false;
+    }
+
+    if ((command->flags & MSP_DISARMED_ONLY) && ARMING_FLAG(ARMED)) {
+        return false;
+    }
+
+#ifdef PROFILING
+    uint32_t startedAt = micros();
+#endif
+
+    result = command->handler();
+    if (result && command->direction == MSP_DIRECTION_IN) {
+        headSerialReply(0);
+    }
+
+#ifdef PROFILING
+    // the replies of a batch are measured before they are written, count them once
+    if (currentPort->batchState != MSP_BATCH_MEASURE) {
+        mspCommandStats_t *stats = &mspCommandStats[command - mspCommands];
+        uint32_t duration = micros() - startedAt;
+
+        stats->count++;
+        stats->totalMicros += duration;
+        if (duration > stats->maxMicros) {
+            stats->maxMicros = duration;
+        }
+    }
+#endif
+
+    return result;
+}
+
+// only out messages, they do not change any state
+static bool processOutCommand(uint16_t cmdMSP)
+{
+    const mspCommand_t *command = findMspCommand(cmdMSP);
+
+    if (!command || command->direction != MSP_DIRECTION_OUT) {
+        return false;
+    }
+    return processCommand(command);
+}
+
+#ifdef PROFILING
+uint8_t getMspCommandCount(void)
+{
+    return MSP_COMMAND_COUNT;
+}
+
+uint16_t getMspCommandId(uint8_t index)
+{
+    return mspCommands[index].cmd;
+}
+
+const mspCommandStats_t *getMspCommandStats(uint8_t index)
+{
+    return &mspCommandStats[index];
+}
+#endif
+
+static void mspProcessReceivedFrame(void)
+{
+    const mspCommand_t *command;
+
+    currentPort->cmdMSP = currentPort->parser.cmd;
+    currentPort->version = currentPort->parser.version;
+    currentPort->dataSize = currentPort->parser.dataSize;
+    currentPort->indRX = 0;
+
+    command = findMspCommand(currentPort->cmdMSP);
+    if (!command || !processCommand(command)) {
+        // we do not know how to handle the (valid) message, indicate error MSP $M!
+        headSerialError(0);
+    }
+    tailSerialReply();
+}
+
+static void mspProcessReceivedByte(uint8_t c)
+{
+    mspFrameResult_e result = mspFrameParse(&currentPort->parser, c);
+
+    if (result == MSP_FRAME_NONE && !ARMING_FLAG(ARMED)) {
+        evaluateOtherData(c); // if not armed evaluate all other incoming serial data
+    } else if (result == MSP_FRAME_RECEIVED) {
+        mspProcessReceivedFrame();
+    }
+}
+
+#define MSP_READ_CHUNK_SIZE 32
+
+static void mspProcessPort(void)
+{
+    uint8_t buffer[MSP_READ_CHUNK_SIZE];
+    uint32_t count;
+    uint32_t index;
+
+    while ((count = serialReadBuf(mspSerialPort, buffer, sizeof(buffer)))) {
+        for (index = 0; index < count; index++) {
+            mspProcessReceivedByte(buffer[index]);
         }
     }
 }
@@ -1425,6 +2023,7 @@ void sendMspTelemetry(void)
 
     setCurrentPort(mspTelemetryPort);
 
+    currentPort->cmdMSP = mspTelemetryCommandSequence[sequenceIndex];
     processOutCommand(mspTelemetryCommandSequence[sequenceIndex]);
     tailSerialReply();
 
@@ -20,6 +20,19 @@
 // Each MSP port requires state and a receive buffer, revisit this default if someone needs more than 2 MSP ports.
 #define MAX_MSP_PORT_COUNT 2
 
+typedef struct mspCommandStats_s {
+    uint32_t count;
+    uint32_t totalMicros;
+    uint32_t maxMicros;
+} mspCommandStats_t;
+
 void mspProcess(void);
 void sendMspTelemetry(void);
 void mspSetTelemetryPort(serialPort_t *mspTelemetryPort);
+
+#ifdef PROFILING
+// per command statistics, index is 0 to getMspCommandCount() - 1
+uint8_t getMspCommandCount(void);
+uint16_t getMspCommandId(uint8_t index);
+const mspCommandStats_t *getMspCommandStats(uint8_t index);
+#endif
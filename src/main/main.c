@@ -24,6 +24,8 @@
 
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/boot_timing.h"
+#include "common/profiling.h"
 
 #include "drivers/system.h"
 #include "drivers/gpio.h"
@@ -34,6 +36,7 @@
 #include "drivers/serial_softserial.h"
 #include "drivers/serial_uart.h"
 #include "drivers/accgyro.h"
+#include "drivers/accgyro_mpu_int.h"
 #include "drivers/pwm_mapping.h"
 #include "drivers/pwm_rx.h"
 #include "drivers/adc.h"
@@ -64,7 +67,9 @@
 #include "sensors/compass.h"
 #include "sensors/acceleration.h"
 #include "sensors/gyro.h"
+#include "sensors/gyro_sync.h"
 #include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
 #include "sensors/battery.h"
 #include "sensors/boardalignment.h"
 #include "config/runtime_config.h"
@@ -77,11 +82,13 @@
 #endif
 
 #include "build_config.h"
+#include "scheduler/scheduler.h"
 
 #ifdef DEBUG_SECTION_TIMES
 uint32_t sectionTimes[2][4];
 #endif
 extern uint32_t previousTime;
+extern uint32_t targetPidLooptime;
 
 #ifdef SOFTSERIAL_LOOPBACK
 serialPort_t *loopbackPort;
@@ -101,13 +108,61 @@ void rxInit(rxConfig_t *rxConfig, failsafe_t *failsafe);
 void beepcodeInit(failsafe_t *initialFailsafe);
 void gpsInit(serialConfig_t *serialConfig, gpsConfig_t *initialGpsConfig);
 void navigationInit(gpsProfile_t *initialGpsProfile, pidProfile_t *pidProfile);
-bool sensorsAutodetect(sensorAlignmentConfig_t *sensorAlignmentConfig, uint16_t gyroLpf, uint8_t accHardwareToUse, int16_t magDeclinationFromConfig);
+bool sensorsAutodetect(sensorAlignmentConfig_t *sensorAlignmentConfig, uint16_t gyroLpf, uint8_t accHardwareToUse, int16_t magDeclinationFromConfig, knownSensors_t *knownSensors);
 void imuInit(void);
 void displayInit(rxConfig_t *intialRxConfig);
 void ledStripInit(ledConfig_t *ledConfigsToUse, hsvColor_t *colorsToUse, failsafe_t* failsafeToUse);
-void loop(void);
 
 
+#ifdef USE_MPU_DATA_READY_SIGNAL
+static const mpuIntExtiConfig_t *selectMPUIntExtiConfig(void)
+{
+#ifdef NAZE
+    // MPU_INT output on rev4 PB13, rev5 PC13
+    static const mpuIntExtiConfig_t nazeRev4MPUIntExtiConfig = {
+        .gpioAPB2Peripherals = RCC_APB2Periph_GPIOB,
+        .gpioPort = GPIOB,
+        .gpioPin = Pin_13,
+        .exti_port_source = GPIO_PortSourceGPIOB,
+        .exti_pin_source = GPIO_PinSource13,
+        .exti_line = EXTI_Line13,
+        .exti_irqn = EXTI15_10_IRQn
+    };
+    static const mpuIntExtiConfig_t nazeRev5MPUIntExtiConfig = {
+        .gpioAPB2Peripherals = RCC_APB2Periph_GPIOC,
+        .gpioPort = GPIOC,
+        .gpioPin = Pin_13,
+        .exti_port_source = GPIO_PortSourceGPIOC,
+        .exti_pin_source = GPIO_PinSource13,
+        .exti_line = EXTI_Line13,
+        .exti_irqn = EXTI15_10_IRQn
+    };
+
+    if (hardwareRevision < NAZE32_REV5) {
+        return &nazeRev4MPUIntExtiConfig;
+    } else {
+        return &nazeRev5MPUIntExtiConfig;
+    }
+#endif
+
+#ifdef CC3D
+    // MPU6000 INT on PA3
+    static const mpuIntExtiConfig_t cc3dMPUIntExtiConfig = {
+        .gpioAPB2Peripherals = RCC_APB2Periph_GPIOA,
+        .gpioPort = GPIOA,
+        .gpioPin = Pin_3,
+        .exti_port_source = GPIO_PortSourceGPIOA,
+        .exti_pin_source = GPIO_PinSource3,
+        .exti_line = EXTI_Line3,
+        .exti_irqn = EXTI3_IRQn
+    };
+    return &cc3dMPUIntExtiConfig;
+#endif
+
+    return NULL;
+}
+#endif
+
 #ifdef STM32F303xC
 // from system_stm32f30x.c
 void SetSysClock(void);
@@ -200,6 +255,7 @@ void init(void)
     initInverter();
 #endif
 
+    bootStageEnd(BOOT_STAGE_SYSTEM);
 
 #ifdef USE_SPI
     spiInit(SPI1);
@@ -234,6 +290,8 @@ void init(void)
 
     adcInit(&adc_params);
 
+    bootStageEnd(BOOT_STAGE_BUSES);
+
     initBoardAlignment(&masterConfig.boardAlignment);
 
 #ifdef DISPLAY
@@ -245,7 +303,7 @@ void init(void)
     // We have these sensors; SENSORS_SET defined in board.h depending on hardware platform
     sensorsSet(SENSORS_SET);
     // drop out any sensors that don't seem to work, init all the others. halt if gyro is dead.
-    sensorsOK = sensorsAutodetect(&masterConfig.sensorAlignmentConfig, masterConfig.gyro_lpf, masterConfig.acc_hardware, currentProfile->mag_declination);
+    sensorsOK = sensorsAutodetect(&masterConfig.sensorAlignmentConfig, masterConfig.gyro_lpf, masterConfig.acc_hardware, currentProfile->mag_declination, &masterConfig.knownSensors);
 
     // production debug output
 #ifdef PROD_DEBUG
@@ -256,6 +314,16 @@ void init(void)
     if (!sensorsOK)
         failureMode(3);
 
+#ifdef USE_MPU_DATA_READY_SIGNAL
+    // only the MPU drivers know their sample period, other gyros keep using looptime
+    if (masterConfig.gyro_sync && gyro.samplePeriod) {
+        gyroSyncInit(gyro.samplePeriod, masterConfig.gyro_sync_denom);
+        mpuIntExtiInit(selectMPUIntExtiConfig(), gyroSyncDataReady);
+    }
+#endif
+
+    bootStageEnd(BOOT_STAGE_SENSORS);
+
     LED1_ON;
     LED0_OFF;
     for (i = 0; i < 10; i++) {
@@ -269,6 +337,8 @@ void init(void)
     LED0_OFF;
     LED1_OFF;
 
+    bootStageEnd(BOOT_STAGE_SIGNAL);
+
     imuInit();
     mixerInit(masterConfig.mixerConfiguration, masterConfig.customMixer);
 
@@ -288,7 +358,9 @@ void init(void)
     else
         pwm_params.airplane = false;
 
+#ifdef STM32F10X
     pwm_params.useUART2 = doesConfigurationUsePort(SERIAL_PORT_USART2);
+#endif
     pwm_params.useVbat = feature(FEATURE_VBAT);
     pwm_params.useSoftSerial = feature(FEATURE_SOFTSERIAL);
     pwm_params.useParallelPWM = feature(FEATURE_RX_PARALLEL_PWM);
@@ -298,6 +370,9 @@ void init(void)
     pwm_params.useServos = isMixerUsingServos();
     pwm_params.extraServos = currentProfile->gimbalConfig.gimbal_flags & GIMBAL_FORWARDAUX;
     pwm_params.motorPwmRate = masterConfig.motor_pwm_rate;
+    pwm_params.useOneshot = feature(FEATURE_ONESHOT125);
+    pwm_params.useDshot = feature(FEATURE_DSHOT);
+    pwm_params.dshotRate = masterConfig.dshot_rate;
     pwm_params.servoPwmRate = masterConfig.servo_pwm_rate;
     pwm_params.idlePulse = PULSE_1MS; // standard PWM for brushless ESC (default, overridden below)
     if (feature(FEATURE_3D))
@@ -312,6 +387,8 @@ void init(void)
 
     mixerUsePWMOutputConfiguration(pwmOutputConfiguration);
 
+    bootStageEnd(BOOT_STAGE_OUTPUTS);
+
     failsafe = failsafeInit(&masterConfig.rxConfig);
     beepcodeInit(failsafe);
     rxInit(&masterConfig.rxConfig, failsafe);
@@ -348,14 +425,19 @@ void init(void)
         initTelemetry();
 #endif
 
+#ifdef BLACKBOX
+    if (feature(FEATURE_BLACKBOX))
+        blackboxInit();
+#endif
+
     previousTime = micros();
 
     if (masterConfig.mixerConfiguration == MULTITYPE_GIMBAL) {
         accSetCalibrationCycles(CALIBRATING_ACC_CYCLES);
     }
-    gyroSetCalibrationCycles(CALIBRATING_GYRO_CYCLES);
+    gyroStartBootCalibration(&masterConfig.knownSensors);
 #ifdef BARO
-    baroSetCalibrationCycles(CALIBRATING_BARO_CYCLES);
+    baroStartBootCalibration(&masterConfig.knownSensors);
 #endif
 
     ENABLE_STATE(SMALL_ANGLE);
@@ -381,6 +463,55 @@ void init(void)
         displayEnablePageCycling();
     }
 #endif
+
+#ifdef PROFILING
+    profilingInit();
+#endif
+
+    bootStageEnd(BOOT_STAGE_FEATURES);
+}
+
+void configureScheduler(void)
+{
+    schedulerInit();
+
+    uint32_t gyroLooptime = gyroSyncIsEnabled() ? gyroSyncGetLoopPeriod() : masterConfig.looptime;
+
+    rescheduleTask(TASK_GYROPID, gyroLooptime);
+    targetPidLooptime = gyroLooptime * masterConfig.pid_process_denom;
+
+    setTaskEnabled(TASK_SYSTEM, true);
+    setTaskEnabled(TASK_GYROPID, true);
+    setTaskEnabled(TASK_RX, true);
+    setTaskEnabled(TASK_SERIAL, true);
+    setTaskEnabled(TASK_CONFIG, true);
+#ifdef GPS
+    setTaskEnabled(TASK_GPS, feature(FEATURE_GPS));
+#endif
+#ifdef MAG
+    setTaskEnabled(TASK_COMPASS, sensors(SENSOR_MAG));
+#endif
+#ifdef BARO
+    setTaskEnabled(TASK_BARO, sensors(SENSOR_BARO));
+#endif
+#ifdef SONAR
+    setTaskEnabled(TASK_SONAR, sensors(SENSOR_SONAR));
+#endif
+#if defined(BARO) || defined(SONAR)
+    setTaskEnabled(TASK_ALTITUDE, sensors(SENSOR_BARO) || sensors(SENSOR_SONAR));
+#endif
+#ifdef DISPLAY
+    setTaskEnabled(TASK_DISPLAY, feature(FEATURE_DISPLAY));
+#endif
+#ifdef TELEMETRY
+    setTaskEnabled(TASK_TELEMETRY, feature(FEATURE_TELEMETRY));
+#endif
+#ifdef LED_STRIP
+    setTaskEnabled(TASK_LEDSTRIP, feature(FEATURE_LED_STRIP));
+#endif
+#ifdef BLACKBOX
+    setTaskEnabled(TASK_BLACKBOX, feature(FEATURE_BLACKBOX));
+#endif
 }
 
 #ifdef SOFTSERIAL_LOOPBACK
@@ -400,8 +531,10 @@ void processLoopback(void) {
 int main(void) {
     init();
 
+    configureScheduler();
+
     while (1) {
-        loop();
+        scheduler();
         processLoopback();
     }
 }
@@ -25,6 +25,8 @@
 #include "common/maths.h"
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/boot_timing.h"
+#include "common/profiling.h"
 
 #include "drivers/accgyro.h"
 #include "drivers/light_led.h"
@@ -43,6 +45,7 @@
 #include "sensors/acceleration.h"
 #include "sensors/barometer.h"
 #include "sensors/gyro.h"
+#include "sensors/gyro_sync.h"
 #include "sensors/battery.h"
 #include "io/beeper.h"
 #include "io/display.h"
@@ -64,12 +67,16 @@
 #include "io/rc_curves.h"
 #include "rx/msp.h"
 #include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
 
 #include "config/runtime_config.h"
 #include "config/config.h"
 #include "config/config_profile.h"
 #include "config/config_master.h"
 
+#include "build_config.h"
+#include "scheduler/scheduler.h"
+
 // June 2013     V2.2-dev
 
 enum {
@@ -85,6 +92,7 @@ int16_t debug[4];
 uint32_t currentTime = 0;
 uint32_t previousTime = 0;
 uint16_t cycleTime = 0;         // this is the number in micro second to achieve a full loop, it can differ a little and is taken into account in the PID loop
+uint32_t targetPidLooptime = 0; // nominal PID loop period in us, the software filters compute their coefficients from it
 int16_t headFreeModeHold;
 
 int16_t telemTemperature1;      // gyro sensor temperature
@@ -155,6 +163,17 @@ bool isCalibrating()
     return (!isAccelerationCalibrationComplete() && sensors(SENSOR_ACC)) || (!isGyroCalibrationComplete());
 }
 
+static bool isBootCalibrationComplete(void)
+{
+#ifdef BARO
+    if (sensors(SENSOR_BARO) && !isBaroCalibrationComplete()) {
+        return false;
+    }
+#endif
+
+    return isGyroCalibrationComplete();
+}
+
 void annexCode(void)
 {
     int32_t tmp, tmp2;
@@ -218,8 +237,8 @@ void annexCode(void)
 
     if (FLIGHT_MODE(HEADFREE_MODE)) {
         float radDiff = degreesToRadians(heading - headFreeModeHold);
-        float cosDiff = cosf(radDiff);
-        float sinDiff = sinf(radDiff);
+        float cosDiff = cos_approx(radDiff);
+        float sinDiff = sin_approx(radDiff);
         int16_t rcCommand_PITCH = rcCommand[PITCH] * cosDiff + rcCommand[ROLL] * sinDiff;
         rcCommand[ROLL] = rcCommand[ROLL] * cosDiff - rcCommand[PITCH] * sinDiff;
         rcCommand[PITCH] = rcCommand_PITCH;
@@ -280,8 +299,6 @@ void annexCode(void)
     checkTelemetryState();
 #endif
 
-    handleSerial();
-
 #ifdef GPS
     if (sensors(SENSOR_GPS)) {
         updateGpsIndicator(currentTime);
@@ -308,6 +325,7 @@ void mwArm(void)
         if (!ARMING_FLAG(PREVENT_ARMING)) {
             ENABLE_ARMING_FLAG(ARMED);
             headFreeModeHold = heading;
+            mixerResetSaturation();
             return;
         }
     }
@@ -371,95 +389,6 @@ void updateMagHold(void)
         magHold = heading;
 }
 
-typedef enum {
-#ifdef MAG
-    UPDATE_COMPASS_TASK,
-#endif
-#ifdef BARO
-    UPDATE_BARO_TASK,
-#endif
-#ifdef SONAR
-    UPDATE_SONAR_TASK,
-#endif
-#if defined(BARO) || defined(SONAR)
-    CALCULATE_ALTITUDE_TASK,
-#endif
-    UPDATE_GPS_TASK,
-    UPDATE_DISPLAY_TASK
-} periodicTasks;
-
-#define PERIODIC_TASK_COUNT (UPDATE_DISPLAY_TASK + 1)
-
-
-void executePeriodicTasks(void)
-{
-    static int periodicTaskIndex = 0;
-
-    switch (periodicTaskIndex++) {
-#ifdef MAG
-    case UPDATE_COMPASS_TASK:
-        if (sensors(SENSOR_MAG)) {
-            updateCompass(&masterConfig.magZero);
-        }
-        break;
-#endif
-
-#ifdef BARO
-    case UPDATE_BARO_TASK:
-        if (sensors(SENSOR_BARO)) {
-            baroUpdate(currentTime);
-        }
-        break;
-#endif
-
-#if defined(BARO) || defined(SONAR)
-    case CALCULATE_ALTITUDE_TASK:
-
-#if defined(BARO) && !defined(SONAR)
-        if (sensors(SENSOR_BARO) && isBaroReady()) {
-#endif
-#if defined(BARO) && defined(SONAR)
-        if ((sensors(SENSOR_BARO) && isBaroReady()) || sensors(SENSOR_SONAR)) {
-#endif
-#if !defined(BARO) && defined(SONAR)
-        if (sensors(SENSOR_SONAR)) {
-#endif
-            calculateEstimatedAltitude(currentTime);
-        }
-        break;
-#endif
-
-#ifdef GPS
-    case UPDATE_GPS_TASK:
-        // if GPS feature is enabled, gpsThread() will be called at some intervals to check for stuck
-        // hardware, wrong baud rates, init GPS if needed, etc. Don't use SENSOR_GPS here as gpsThread() can and will
-        // change this based on available hardware
-        if (feature(FEATURE_GPS)) {
-            gpsThread();
-        }
-        break;
-#endif
-#ifdef SONAR
-    case UPDATE_SONAR_TASK:
-        if (sensors(SENSOR_SONAR)) {
-            Sonar_update();
-        }
-        break;
-#endif
-#ifdef DISPLAY
-    case UPDATE_DISPLAY_TASK:
-        if (feature(FEATURE_DISPLAY)) {
-            updateDisplay();
-        }
-        break;
-#endif
-    }
-
-    if (periodicTaskIndex >= PERIODIC_TASK_COUNT) {
-        periodicTaskIndex = 0;
-    }
-}
-
 void processRx(void)
 {
     calculateRxChannelsAndUpdateFailsafe(currentTime);
@@ -568,109 +497,240 @@ void processRx(void)
     }
 }
 
-void loop(void)
-{
-    static uint32_t loopTime;
 #if defined(BARO) || defined(SONAR)
-    static bool haveProcessedAnnexCodeOnce = false;
+static bool haveProcessedAnnexCodeOnce = false;
 #endif
 
-    updateRx();
+bool taskMainPidLoopCheck(uint32_t currentDeltaTime)
+{
+    if (gyroSyncIsEnabled()) {
+        return gyroSyncCheckUpdate(micros());
+    }
+    return currentDeltaTime >= masterConfig.looptime;
+}
 
-    if (shouldProcessRx(currentTime)) {
-        processRx();
+void taskMainPidLoop(void)
+{
+    static uint8_t gyroSamplesSincePid = 0;
 
-#ifdef BARO
-        // the 'annexCode' initialses rcCommand, updateAltHoldState depends on valid rcCommand data.
-        if (haveProcessedAnnexCodeOnce) {
-            if (sensors(SENSOR_BARO)) {
-                updateAltHoldState();
-            }
-        }
-#endif
+    if (!isBootComplete() && isBootCalibrationComplete()) {
+        bootStageEnd(BOOT_STAGE_CALIBRATION);
+    }
 
-#ifdef SONAR
-        // the 'annexCode' initialses rcCommand, updateAltHoldState depends on valid rcCommand data.
-        if (haveProcessedAnnexCodeOnce) {
-            if (sensors(SENSOR_SONAR)) {
-                updateSonarAltHoldState();
-            }
+    // the task runs at the gyro sampling rate, everything below it only on every pid_process_denom'th sample
+    if (masterConfig.pid_process_denom > 1) {
+        gyroAccumulateSample();
+        if (++gyroSamplesSincePid < masterConfig.pid_process_denom) {
+            return;
         }
-#endif
-
-    } else {
-        // not processing rx this iteration
-        executePeriodicTasks();
+        gyroSamplesSincePid = 0;
     }
 
-    currentTime = micros();
-    if (masterConfig.looptime == 0 || (int32_t)(currentTime - loopTime) >= 0) {
-        loopTime = currentTime + masterConfig.looptime;
-
-        computeIMU(&currentProfile->accelerometerTrims, masterConfig.mixerConfiguration);
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_IMU);
+    computeIMU(&currentProfile->accelerometerTrims, masterConfig.mixerConfiguration);
+    PROFILE_STAGE_END(PROFILE_STAGE_IMU);
 
-        // Measure loop rate just after reading the sensors
-        currentTime = micros();
-        cycleTime = (int32_t)(currentTime - previousTime);
-        previousTime = currentTime;
+    // Measure loop rate just after reading the sensors
+    currentTime = micros();
+    cycleTime = (int32_t)(currentTime - previousTime);
+    previousTime = currentTime;
 
-        annexCode();
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_ANNEX);
+    annexCode();
+    PROFILE_STAGE_END(PROFILE_STAGE_ANNEX);
 #if defined(BARO) || defined(SONAR)
-        haveProcessedAnnexCodeOnce = true;
+    haveProcessedAnnexCodeOnce = true;
 #endif
 
 #ifdef AUTOTUNE
-        updateAutotuneState();
+    updateAutotuneState();
 #endif
 
 #ifdef MAG
-        if (sensors(SENSOR_MAG)) {
-        	updateMagHold();
-        }
+    if (sensors(SENSOR_MAG)) {
+        updateMagHold();
+    }
 #endif
 
 #if defined(BARO) || defined(SONAR)
-        if (sensors(SENSOR_BARO) || sensors(SENSOR_SONAR)) {
-            if (FLIGHT_MODE(BARO_MODE) || FLIGHT_MODE(SONAR_MODE)) {
-                applyAltHold();
-            }
+    if (sensors(SENSOR_BARO) || sensors(SENSOR_SONAR)) {
+        if (FLIGHT_MODE(BARO_MODE) || FLIGHT_MODE(SONAR_MODE)) {
+            applyAltHold();
         }
+    }
 #endif
 
-        if (currentProfile->throttle_correction_value && (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE))) {
-            rcCommand[THROTTLE] += calculateThrottleAngleCorrection(currentProfile->throttle_correction_value);
-        }
+    if (currentProfile->throttle_correction_value && (FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE))) {
+        rcCommand[THROTTLE] += calculateThrottleAngleCorrection(currentProfile->throttle_correction_value);
+    }
 
 #ifdef GPS
-        if (sensors(SENSOR_GPS)) {
-            if ((FLIGHT_MODE(GPS_HOME_MODE) || FLIGHT_MODE(GPS_HOLD_MODE)) && STATE(GPS_FIX_HOME)) {
-                updateGpsStateForHomeAndHoldMode();
-            }
+    if (sensors(SENSOR_GPS)) {
+        if ((FLIGHT_MODE(GPS_HOME_MODE) || FLIGHT_MODE(GPS_HOLD_MODE)) && STATE(GPS_FIX_HOME)) {
+            updateGpsStateForHomeAndHoldMode();
         }
+    }
 #endif
 
-        // PID - note this is function pointer set by setPIDController()
-        pid_controller(
-            &currentProfile->pidProfile,
-            &currentProfile->controlRateConfig,
-            masterConfig.max_angle_inclination,
-            &currentProfile->accelerometerTrims
-        );
+    // PID - note this is function pointer set by setPIDController()
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_PID);
+    pid_controller(
+        &currentProfile->pidProfile,
+        &currentProfile->controlRateConfig,
+        masterConfig.max_angle_inclination,
+        &currentProfile->accelerometerTrims
+    );
+    PROFILE_STAGE_END(PROFILE_STAGE_PID);
+
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_MIXER);
+    mixTable();
+    PROFILE_STAGE_END(PROFILE_STAGE_MIXER);
+
+    writeServos();
+
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_MOTORS);
+    writeMotors();
+    PROFILE_STAGE_END(PROFILE_STAGE_MOTORS);
+
+#ifdef BLACKBOX
+    blackboxLogIteration(currentTime);
+#endif
+}
+
+bool taskUpdateRxCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+
+    updateRx();
+    return shouldProcessRx(micros());
+}
+
+void taskUpdateRxMain(void)
+{
+    currentTime = micros();
+
+    processRx();
+
+#ifdef BARO
+    // the 'annexCode' initialses rcCommand, updateAltHoldState depends on valid rcCommand data.
+    if (haveProcessedAnnexCodeOnce) {
+        if (sensors(SENSOR_BARO)) {
+            updateAltHoldState();
+        }
+    }
+#endif
 
-        mixTable();
-        writeServos();
-        writeMotors();
+#ifdef SONAR
+    // the 'annexCode' initialses rcCommand, updateAltHoldState depends on valid rcCommand data.
+    if (haveProcessedAnnexCodeOnce) {
+        if (sensors(SENSOR_SONAR)) {
+            updateSonarAltHoldState();
+        }
     }
+#endif
+}
+
+void taskHandleSerial(void)
+{
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_SERIAL);
+    handleSerial();
+    PROFILE_STAGE_END(PROFILE_STAGE_SERIAL);
+}
+
+bool taskSaveConfigCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+
+    return isEEPROMWritePending();
+}
+
+void taskSaveConfig(void)
+{
+    processEEPROMWrite();
+}
+
+#ifdef GPS
+void taskUpdateGps(void)
+{
+    // gpsThread() checks for stuck hardware, wrong baud rates, init GPS if needed, etc. The task is enabled by
+    // FEATURE_GPS rather than SENSOR_GPS as gpsThread() can and will change SENSOR_GPS based on available hardware.
+    gpsThread();
+}
+#endif
+
+#ifdef MAG
+void taskUpdateCompass(void)
+{
+    currentTime = micros();
+    updateCompass(&masterConfig.magZero);
+}
+#endif
+
+#ifdef BARO
+void taskUpdateBaro(void)
+{
+    currentTime = micros();
+    baroUpdate(currentTime);
+}
+#endif
+
+#ifdef SONAR
+void taskUpdateSonar(void)
+{
+    Sonar_update();
+}
+#endif
+
+#if defined(BARO) || defined(SONAR)
+void taskCalculateAltitude(void)
+{
+#if defined(BARO) && !defined(SONAR)
+    if (sensors(SENSOR_BARO) && isBaroReady()) {
+#endif
+#if defined(BARO) && defined(SONAR)
+    if ((sensors(SENSOR_BARO) && isBaroReady()) || sensors(SENSOR_SONAR)) {
+#endif
+#if !defined(BARO) && defined(SONAR)
+    if (sensors(SENSOR_SONAR)) {
+#endif
+        currentTime = micros();
+        calculateEstimatedAltitude(currentTime);
+    }
+}
+#endif
+
+#ifdef DISPLAY
+void taskUpdateDisplay(void)
+{
+    updateDisplay();
+}
+#endif
 
 #ifdef TELEMETRY
-    if (!cliMode && feature(FEATURE_TELEMETRY)) {
+void taskTelemetry(void)
+{
+    if (!cliMode) {
+        PROFILE_STAGE_BEGIN(PROFILE_STAGE_TELEMETRY);
         handleTelemetry();
+        PROFILE_STAGE_END(PROFILE_STAGE_TELEMETRY);
     }
+}
 #endif
 
 #ifdef LED_STRIP
-    if (feature(FEATURE_LED_STRIP)) {
-        updateLedStrip();
-    }
+void taskLedStrip(void)
+{
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_LEDSTRIP);
+    updateLedStrip();
+    PROFILE_STAGE_END(PROFILE_STAGE_LEDSTRIP);
+}
 #endif
+
+#ifdef BLACKBOX
+void taskBlackbox(void)
+{
+    PROFILE_STAGE_BEGIN(PROFILE_STAGE_BLACKBOX);
+    handleBlackbox();
+    PROFILE_STAGE_END(PROFILE_STAGE_BLACKBOX);
 }
+#endif
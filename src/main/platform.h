@@ -43,5 +43,12 @@
 
 #endif // STM32F10X
 
+#ifdef SITL
+
+// host build, see target/SITL
+#include "sitl_mcu.h"
+
+#endif // SITL
+
 #include "target.h"
 
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -44,6 +45,7 @@
 
 static bool sbusFrameDone = false;
 static void sbusDataReceive(uint16_t c);
+static void sbusFrameReceive(const uint8_t *frame, uint8_t length);
 static uint16_t sbusReadRawRC(rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
 
 static uint32_t sbusChannelData[SBUS_MAX_CHANNEL];
@@ -62,6 +64,9 @@ bool sbusInit(rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig, rcReadRa
     int b;
 
     sBusPort = openSerialPort(FUNCTION_SERIAL_RX, sbusDataReceive, SBUS_BAUDRATE, (portMode_t)(MODE_RX | MODE_SBUS), SERIAL_INVERTED);
+    if (sBusPort) {
+        serialSetRxFrameCallback(sBusPort, sbusFrameReceive);
+    }
 
     for (b = 0; b < SBUS_MAX_CHANNEL; b++)
         sbusChannelData[b] = 2 * (rxConfig->midrc - SBUS_OFFSET);
@@ -121,6 +126,17 @@ static void sbusDataReceive(uint16_t c)
     }
 }
 
+// Receive ISR callback of ports that detect the end of a frame
+static void sbusFrameReceive(const uint8_t *frame, uint8_t length)
+{
+    if (length != SBUS_FRAME_SIZE || frame[0] != SBUS_SYNCBYTE) {
+        return;
+    }
+
+    memcpy(sbus.in, &frame[1], SBUS_FRAME_SIZE - 1);
+    sbusFrameDone = true;
+}
+
 bool sbusFrameComplete(void)
 {
     if (!sbusFrameDone) {
@@ -49,6 +49,7 @@ static bool spekDataIncoming = false;
 static volatile uint8_t spekFrame[SPEK_FRAME_SIZE];
 
 static void spektrumDataReceive(uint16_t c);
+static void spektrumFrameReceive(const uint8_t *frame, uint8_t length);
 static uint16_t spektrumReadRawRC(rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
 
 static serialPort_t *spektrumPort;
@@ -80,6 +81,9 @@ bool spektrumInit(rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig, rcRe
     }
 
     spektrumPort = openSerialPort(FUNCTION_SERIAL_RX, spektrumDataReceive, SPEKTRUM_BAUDRATE, MODE_RX, SERIAL_NOT_INVERTED);
+    if (spektrumPort) {
+        serialSetRxFrameCallback(spektrumPort, spektrumFrameReceive);
+    }
     if (callback)
         *callback = spektrumReadRawRC;
 
@@ -107,6 +111,22 @@ static void spektrumDataReceive(uint16_t c)
     }
 }
 
+// Receive ISR callback of ports that detect the end of a frame
+static void spektrumFrameReceive(const uint8_t *frame, uint8_t length)
+{
+    uint8_t index;
+
+    if (length != SPEK_FRAME_SIZE) {
+        return;
+    }
+
+    spekDataIncoming = true;
+    for (index = 0; index < SPEK_FRAME_SIZE; index++) {
+        spekFrame[index] = frame[index];
+    }
+    rcFrameComplete = true;
+}
+
 bool spektrumFrameComplete(void)
 {
     return rcFrameComplete;
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -47,6 +48,7 @@ static uint32_t sumdChannels[SUMD_MAX_CHANNEL];
 static serialPort_t *sumdPort;
 
 static void sumdDataReceive(uint16_t c);
+static void sumdFrameReceive(const uint8_t *frame, uint8_t length);
 static uint16_t sumdReadRawRC(rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
 
 void sumdUpdateSerialRxFunctionConstraint(functionConstraint_t *functionConstraint)
@@ -60,6 +62,9 @@ bool sumdInit(rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig, rcReadRa
 {
     UNUSED(rxConfig);
     sumdPort = openSerialPort(FUNCTION_SERIAL_RX, sumdDataReceive, SUMD_BAUDRATE, MODE_RX, SERIAL_NOT_INVERTED);
+    if (sumdPort) {
+        serialSetRxFrameCallback(sumdPort, sumdFrameReceive);
+    }
     if (callback)
         *callback = sumdReadRawRC;
 
@@ -100,6 +105,18 @@ static void sumdDataReceive(uint16_t c)
     }
 }
 
+// Receive ISR callback of ports that detect the end of a frame
+static void sumdFrameReceive(const uint8_t *frame, uint8_t length)
+{
+    if (length < 3 || length > SUMD_BUFFSIZE || frame[0] != SUMD_SYNCBYTE || length != frame[2] * 2 + 5) {
+        return;
+    }
+
+    memcpy(sumd, frame, length);
+    sumdChannelCount = frame[2];
+    sumdFrameDone = true;
+}
+
 #define SUMD_OFFSET_CHANNEL_1_HIGH 3
 #define SUMD_OFFSET_CHANNEL_1_LOW 4
 #define SUMD_BYTES_PER_CHANNEL 2
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -45,6 +46,7 @@ static uint8_t sumhFrame[SUMH_FRAME_SIZE];
 static uint32_t sumhChannels[SUMH_MAX_CHANNEL_COUNT];
 
 static void sumhDataReceive(uint16_t c);
+static void sumhFrameReceive(const uint8_t *frame, uint8_t length);
 static uint16_t sumhReadRawRC(rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
 
 static serialPort_t *sumhPort;
@@ -65,6 +67,9 @@ bool sumhInit(rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig, rcReadRa
 {
     UNUSED(rxConfig);
     sumhPort = openSerialPort(FUNCTION_SERIAL_RX, sumhDataReceive, SUMH_BAUDRATE, MODE_RX, SERIAL_NOT_INVERTED);
+    if (sumhPort) {
+        serialSetRxFrameCallback(sumhPort, sumhFrameReceive);
+    }
     if (callback)
         *callback = sumhReadRawRC;
 
@@ -96,6 +101,17 @@ static void sumhDataReceive(uint16_t c)
     }
 }
 
+// Receive ISR callback of ports that detect the end of a frame
+static void sumhFrameReceive(const uint8_t *frame, uint8_t length)
+{
+    if (length != SUMH_FRAME_SIZE) {
+        return;
+    }
+
+    memcpy(sumhFrame, frame, SUMH_FRAME_SIZE);
+    sumhFrameDone = true;
+}
+
 bool sumhFrameComplete(void)
 {
     uint8_t channelIndex;
@@ -0,0 +1,243 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+
+#include "drivers/system.h"
+
+#include "scheduler/scheduler.h"
+
+#define TASK_AVERAGE_EXECUTE_SAMPLES 32
+#define TASK_MAX_AGE_CYCLES ((UINT16_MAX - 1) / TASK_PRIORITY_MAX)
+
+static cfTask_t *lastExecutedTask = NULL;
+
+static uint32_t totalWaitingTasks;
+static uint32_t totalWaitingTasksSamples;
+
+uint16_t averageSystemLoadPercent = 0;
+
+void taskSystem(void)
+{
+    // Calculate system load, i.e. the average number of tasks that were waiting on each scheduler pass
+    if (totalWaitingTasksSamples > 0) {
+        averageSystemLoadPercent = 100 * totalWaitingTasks / totalWaitingTasksSamples;
+        totalWaitingTasksSamples = 0;
+        totalWaitingTasks = 0;
+    }
+}
+
+void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t * taskInfo)
+{
+    taskInfo->taskName = cfTasks[taskId].taskName;
+    taskInfo->isEnabled = cfTasks[taskId].isEnabled;
+    taskInfo->desiredPeriod = cfTasks[taskId].desiredPeriod;
+    taskInfo->staticPriority = cfTasks[taskId].staticPriority;
+    taskInfo->maxExecutionTime = cfTasks[taskId].maxExecutionTime;
+    taskInfo->totalExecutionTime = cfTasks[taskId].totalExecutionTime;
+    taskInfo->averageExecutionTime = cfTasks[taskId].averageExecutionTime;
+    taskInfo->latestDeltaTime = cfTasks[taskId].taskLatestDeltaTime;
+}
+
+/*
+ * A period of 0 means 'as fast as possible', in which case the task gives way to one other waiting task after
+ * each execution instead of pre-empting them.
+ */
+void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros)
+{
+    if (taskId < TASK_COUNT) {
+        cfTasks[taskId].desiredPeriod = newPeriodMicros;
+    }
+}
+
+void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState)
+{
+    if (taskId < TASK_COUNT) {
+        cfTasks[taskId].isEnabled = newEnabledState;
+    }
+}
+
+uint32_t getTaskDeltaTime(cfTaskId_e taskId)
+{
+    if (taskId < TASK_COUNT) {
+        return cfTasks[taskId].taskLatestDeltaTime;
+    }
+    return 0;
+}
+
+void schedulerInit(void)
+{
+    uint8_t taskId;
+    uint32_t currentTime = micros();
+
+    for (taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTask_t *task = &cfTasks[taskId];
+
+        task->dynamicPriority = 0;
+        task->taskAgeCycles = 0;
+        task->lastExecutedAt = currentTime;
+        task->lastSignaledAt = currentTime;
+        task->movingSumExecutionTime = 0;
+        task->averageExecutionTime = 0;
+        task->taskLatestDeltaTime = 0;
+        task->maxExecutionTime = 0;
+        task->totalExecutionTime = 0;
+    }
+
+    lastExecutedTask = NULL;
+    totalWaitingTasks = 0;
+    totalWaitingTasksSamples = 0;
+    averageSystemLoadPercent = 0;
+}
+
+static uint16_t calculateTaskAgeCycles(cfTask_t *task, uint32_t timeSinceEvent)
+{
+    uint32_t ageCycles;
+
+    if (task->desiredPeriod == 0) {
+        return 1;
+    }
+
+    ageCycles = timeSinceEvent / task->desiredPeriod;
+    return min(ageCycles, TASK_MAX_AGE_CYCLES);
+}
+
+static bool isRealtimeTask(cfTask_t *task)
+{
+    return task->staticPriority == TASK_PRIORITY_REALTIME && task->desiredPeriod > 0;
+}
+
+/*
+ * Runs at most one task per call.
+ *
+ * Each task accumulates priority in steps of its static priority for every period it is overdue, so lower priority
+ * tasks eventually get their turn.  A due realtime task (the PID loop) always wins, and any other task is held back
+ * if its average execution time would make the realtime task late.
+ */
+void scheduler(void)
+{
+    uint8_t taskId;
+    uint8_t waitingTasks = 0;
+    uint16_t selectedTaskDynamicPriority = 0;
+    cfTask_t *selectedTask = NULL;
+    cfTask_t *dueRealtimeTask = NULL;
+    cfTask_t *yieldingTask = NULL;
+    int32_t realtimeGuardInterval = INT32_MAX;
+    uint32_t realtimePeriod = 0;
+
+    uint32_t currentTime = micros();
+
+    for (taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTask_t *task = &cfTasks[taskId];
+
+        if (!task->isEnabled) {
+            continue;
+        }
+
+        if (task->checkFunc) {
+            // Event driven task, ages from the moment the event was signalled
+            if (task->dynamicPriority > 0) {
+                task->taskAgeCycles = 1 + calculateTaskAgeCycles(task, currentTime - task->lastSignaledAt);
+                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                waitingTasks++;
+            } else if (task->checkFunc(currentTime - task->lastExecutedAt)) {
+                task->lastSignaledAt = currentTime;
+                task->taskAgeCycles = 1;
+                task->dynamicPriority = 1 + task->staticPriority;
+                waitingTasks++;
+            } else {
+                task->taskAgeCycles = 0;
+            }
+        } else {
+            // Periodic task, ages from the last time it was executed
+            task->taskAgeCycles = calculateTaskAgeCycles(task, currentTime - task->lastExecutedAt);
+            if (task->taskAgeCycles > 0) {
+                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+                waitingTasks++;
+            } else {
+                task->dynamicPriority = 0;
+            }
+        }
+
+        if (isRealtimeTask(task)) {
+            int32_t timeUntilDue = (int32_t)(task->lastExecutedAt + task->desiredPeriod - currentTime);
+            if (timeUntilDue < realtimeGuardInterval) {
+                realtimeGuardInterval = timeUntilDue;
+                realtimePeriod = task->desiredPeriod;
+            }
+            if (task->taskAgeCycles > 0 && !dueRealtimeTask) {
+                dueRealtimeTask = task;
+            }
+        }
+
+        if (task->desiredPeriod == 0 && task == lastExecutedTask) {
+            yieldingTask = task;
+            continue;
+        }
+
+        if (task->dynamicPriority > selectedTaskDynamicPriority) {
+            selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+        }
+    }
+
+    totalWaitingTasksSamples++;
+    totalWaitingTasks += waitingTasks;
+
+    if (dueRealtimeTask) {
+        selectedTask = dueRealtimeTask;
+    } else if (!selectedTask) {
+        selectedTask = yieldingTask;
+    } else if (realtimePeriod > 0) {
+        // Hold the task back if it would not finish before the realtime task is due.  Tasks that cannot fit into
+        // any realtime period are run anyway, otherwise they would never run at all.
+        if ((int32_t)selectedTask->averageExecutionTime > realtimeGuardInterval && selectedTask->averageExecutionTime < realtimePeriod) {
+            selectedTask = NULL;
+        }
+    }
+
+    lastExecutedTask = selectedTask;
+
+    if (selectedTask) {
+        uint32_t taskStartedAt;
+        uint32_t taskExecutionTime;
+
+        selectedTask->taskLatestDeltaTime = currentTime - selectedTask->lastExecutedAt;
+        selectedTask->lastExecutedAt = currentTime;
+        selectedTask->dynamicPriority = 0;
+
+        taskStartedAt = micros();
+        selectedTask->taskFunc();
+        taskExecutionTime = micros() - taskStartedAt;
+
+        if (selectedTask->movingSumExecutionTime == 0) {
+            // first execution, seed the average so the guard interval is useful straight away
+            selectedTask->movingSumExecutionTime = taskExecutionTime * TASK_AVERAGE_EXECUTE_SAMPLES;
+        } else {
+            selectedTask->movingSumExecutionTime += taskExecutionTime - selectedTask->movingSumExecutionTime / TASK_AVERAGE_EXECUTE_SAMPLES;
+        }
+        selectedTask->averageExecutionTime = selectedTask->movingSumExecutionTime / TASK_AVERAGE_EXECUTE_SAMPLES;
+        selectedTask->totalExecutionTime += taskExecutionTime;
+        selectedTask->maxExecutionTime = max(selectedTask->maxExecutionTime, taskExecutionTime);
+    }
+}
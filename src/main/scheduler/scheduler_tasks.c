@@ -0,0 +1,111 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "platform.h"
+
+#include "scheduler/scheduler.h"
+
+// from mw.c
+bool taskMainPidLoopCheck(uint32_t currentDeltaTime);
+void taskMainPidLoop(void);
+bool taskUpdateRxCheck(uint32_t currentDeltaTime);
+void taskUpdateRxMain(void);
+void taskHandleSerial(void);
+bool taskSaveConfigCheck(uint32_t currentDeltaTime);
+void taskSaveConfig(void);
+void taskUpdateGps(void);
+void taskUpdateCompass(void);
+void taskUpdateBaro(void);
+void taskUpdateSonar(void);
+void taskCalculateAltitude(void);
+void taskUpdateDisplay(void);
+void taskTelemetry(void);
+void taskLedStrip(void);
+void taskBlackbox(void);
+
+// every field is given, the unit tests build this as C++ which warns about the missing ones
+#define DEFINE_TASK(name, check, task, period, priority) { \
+    .taskName = name, \
+    .checkFunc = check, \
+    .taskFunc = task, \
+    .isEnabled = false, \
+    .desiredPeriod = period, \
+    .staticPriority = priority, \
+    .dynamicPriority = 0, \
+    .taskAgeCycles = 0, \
+    .lastExecutedAt = 0, \
+    .lastSignaledAt = 0, \
+    .movingSumExecutionTime = 0, \
+    .averageExecutionTime = 0, \
+    .taskLatestDeltaTime = 0, \
+    .maxExecutionTime = 0, \
+    .totalExecutionTime = 0 \
+}
+
+cfTask_t cfTasks[TASK_COUNT] = {
+    [TASK_SYSTEM] = DEFINE_TASK("SYSTEM", NULL, taskSystem, TASK_PERIOD_HZ(10), TASK_PRIORITY_HIGH),
+
+    // the period is replaced by masterConfig.looptime or the gyro sync period at boot
+    [TASK_GYROPID] = DEFINE_TASK("GYRO/PID", taskMainPidLoopCheck, taskMainPidLoop, 3500, TASK_PRIORITY_REALTIME),
+
+    [TASK_RX] = DEFINE_TASK("RX", taskUpdateRxCheck, taskUpdateRxMain, TASK_PERIOD_HZ(50), TASK_PRIORITY_HIGH),
+
+    [TASK_SERIAL] = DEFINE_TASK("SERIAL", NULL, taskHandleSerial, TASK_PERIOD_HZ(100), TASK_PRIORITY_LOW),
+
+    [TASK_CONFIG] = DEFINE_TASK("CONFIG", taskSaveConfigCheck, taskSaveConfig, TASK_PERIOD_HZ(1000), TASK_PRIORITY_LOW),
+
+#ifdef GPS
+    [TASK_GPS] = DEFINE_TASK("GPS", NULL, taskUpdateGps, TASK_PERIOD_HZ(10), TASK_PRIORITY_MEDIUM),
+#endif
+
+#ifdef MAG
+    [TASK_COMPASS] = DEFINE_TASK("COMPASS", NULL, taskUpdateCompass, TASK_PERIOD_HZ(10), TASK_PRIORITY_LOW),
+#endif
+
+#ifdef BARO
+    [TASK_BARO] = DEFINE_TASK("BARO", NULL, taskUpdateBaro, TASK_PERIOD_HZ(20), TASK_PRIORITY_LOW),
+#endif
+
+#ifdef SONAR
+    [TASK_SONAR] = DEFINE_TASK("SONAR", NULL, taskUpdateSonar, TASK_PERIOD_HZ(20), TASK_PRIORITY_LOW),
+#endif
+
+#if defined(BARO) || defined(SONAR)
+    [TASK_ALTITUDE] = DEFINE_TASK("ALTITUDE", NULL, taskCalculateAltitude, TASK_PERIOD_HZ(40), TASK_PRIORITY_LOW),
+#endif
+
+#ifdef DISPLAY
+    [TASK_DISPLAY] = DEFINE_TASK("DISPLAY", NULL, taskUpdateDisplay, TASK_PERIOD_HZ(10), TASK_PRIORITY_LOW),
+#endif
+
+#ifdef TELEMETRY
+    [TASK_TELEMETRY] = DEFINE_TASK("TELEMETRY", NULL, taskTelemetry, TASK_PERIOD_HZ(250), TASK_PRIORITY_LOW),
+#endif
+
+#ifdef LED_STRIP
+    [TASK_LEDSTRIP] = DEFINE_TASK("LEDSTRIP", NULL, taskLedStrip, TASK_PERIOD_HZ(100), TASK_PRIORITY_IDLE),
+#endif
+
+#ifdef BLACKBOX
+    // often enough to keep the transmit buffer busy at 115200
+    [TASK_BLACKBOX] = DEFINE_TASK("BLACKBOX", NULL, taskBlackbox, TASK_PERIOD_HZ(500), TASK_PRIORITY_LOW),
+#endif
+};
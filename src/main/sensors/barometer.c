@@ -17,6 +17,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <math.h>
 
 #include "platform.h"
@@ -26,9 +27,11 @@
 #include "drivers/barometer.h"
 #include "config/config.h"
 
+#include "sensors/sensors.h"
 #include "sensors/barometer.h"
 
 baro_t baro;                        // barometer access functions
+uint8_t baroHardware = BARO_DEFAULT;
 uint16_t calibratingB = 0;      // baro calibration = get new ground pressure value
 int32_t baroPressure = 0;
 int32_t baroTemperature = 0;
@@ -36,10 +39,17 @@ int32_t BaroAlt = 0;
 
 #ifdef BARO
 
+// how far the ground pressure may be from the known one for the known calibration to be used, about 4 m
+#define BARO_KNOWN_GROUND_PRESSURE_TOLERANCE 50
+
 static int32_t baroGroundAltitude = 0;
 static int32_t baroGroundPressure = 0;
 static uint32_t baroPressureSum = 0;
 
+static bool checkingKnownGroundPressure = false;
+static bool bootCalibration = false;
+static knownSensors_t *knownSensors;
+
 barometerConfig_t *barometerConfig;
 
 void useBarometerConfig(barometerConfig_t *barometerConfigToUse)
@@ -55,6 +65,27 @@ bool isBaroCalibrationComplete(void)
 void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired)
 {
     calibratingB = calibrationCyclesRequired;
+    checkingKnownGroundPressure = false;
+    bootCalibration = false;
+}
+
+/*
+ * Starts the calibration at boot. When the ground pressure of this barometer is known from an earlier full
+ * calibration the filter starts from it and is checked after CHECKING_BARO_CYCLES, a full calibration follows when
+ * the pressure has moved away from the known one since. A full calibration is stored in knownSensorsToUse.
+ */
+void baroStartBootCalibration(knownSensors_t *knownSensorsToUse)
+{
+    knownSensors = knownSensorsToUse;
+
+    if ((knownSensors->calibrated & SENSOR_BARO) && knownSensors->baroHardware == baroHardware) {
+        baroSetCalibrationCycles(CHECKING_BARO_CYCLES);
+        baroGroundPressure = knownSensors->baroGroundPressure * 8;
+        checkingKnownGroundPressure = true;
+    } else {
+        baroSetCalibrationCycles(CALIBRATING_BARO_CYCLES);
+    }
+    bootCalibration = true;
 }
 
 static bool baroReady = false;
@@ -135,7 +166,7 @@ int32_t baroCalculateAltitude(void)
 
     // calculates height from ground via baro readings
     // see: https://github.com/diydrones/ardupilot/blob/master/libraries/AP_Baro/AP_Baro.cpp#L140
-    BaroAlt_tmp = lrintf((1.0f - powf((float)(baroPressureSum / PRESSURE_SAMPLE_COUNT) / 101325.0f, 0.190295f)) * 4433000.0f); // in cm
+    BaroAlt_tmp = lrintf(pressureToAltitude((float)(baroPressureSum / PRESSURE_SAMPLE_COUNT))); // in cm
     BaroAlt_tmp -= baroGroundAltitude;
     BaroAlt = lrintf((float)BaroAlt * barometerConfig->baro_noise_lpf + (float)BaroAlt_tmp * (1.0f - barometerConfig->baro_noise_lpf)); // additional LPF to reduce baro noise
 
@@ -146,9 +177,26 @@ void performBaroCalibrationCycle(void)
 {
     baroGroundPressure -= baroGroundPressure / 8;
     baroGroundPressure += baroPressureSum / PRESSURE_SAMPLE_COUNT;
-    baroGroundAltitude = (1.0f - powf((baroGroundPressure / 8) / 101325.0f, 0.190295f)) * 4433000.0f;
+    baroGroundAltitude = pressureToAltitude(baroGroundPressure / 8);
 
     calibratingB--;
+    if (calibratingB > 0 || !bootCalibration) {
+        return;
+    }
+
+    if (checkingKnownGroundPressure) {
+        if (abs(baroGroundPressure / 8 - knownSensors->baroGroundPressure) > BARO_KNOWN_GROUND_PRESSURE_TOLERANCE) {
+            // the filter carries on from the pressure reached
+            calibratingB = CALIBRATING_BARO_CYCLES;
+            checkingKnownGroundPressure = false;
+        }
+        return;
+    }
+
+    knownSensors->baroGroundPressure = baroGroundPressure / 8;
+    knownSensors->baroHardware = baroHardware;
+    knownSensors->calibrated |= SENSOR_BARO;
+    requestEEPROMWrite();
 }
 
 #endif /* BARO */
@@ -19,6 +19,15 @@
 
 #define BARO_SAMPLE_COUNT_MAX   48
 
+// Type of barometer used/detected
+typedef enum {
+    BARO_DEFAULT = 0,
+    BARO_NONE,
+    BARO_BMP085,
+    BARO_MS5611,
+    BARO_FAKE
+} baroSensor_e;
+
 typedef struct barometerConfig_s {
     uint8_t baro_sample_count;              // size of baro filter array
     float baro_noise_lpf;                   // additional LPF to reduce baro noise
@@ -26,6 +35,7 @@ typedef struct barometerConfig_s {
     float baro_cf_alt;                      // apply CF to use ACC for height estimation
 } barometerConfig_t;
 
+extern uint8_t baroHardware;
 extern int32_t BaroAlt;
 extern int32_t baroTemperature;             // Use temperature for telemetry
 
@@ -33,6 +43,7 @@ extern int32_t baroTemperature;             // Use temperature for telemetry
 void useBarometerConfig(barometerConfig_t *barometerConfigToUse);
 bool isBaroCalibrationComplete(void);
 void baroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void baroStartBootCalibration(knownSensors_t *knownSensorsToUse);
 void baroUpdate(uint32_t currentTime);
 bool isBaroReady(void);
 int32_t baroCalculateAltitude(void);
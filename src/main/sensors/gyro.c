@@ -17,35 +17,108 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
 
 #include "platform.h"
 
 #include "common/axis.h"
 #include "common/maths.h"
+#include "common/filter.h"
 
 #include "drivers/accgyro.h"
 #include "flight/flight.h"
 #include "sensors/sensors.h"
 #include "io/statusindicator.h"
 #include "sensors/boardalignment.h"
+#include "config/config.h"
 
 #include "sensors/gyro.h"
 
+extern uint32_t targetPidLooptime;
+
+// a zero measured at boot may differ this much from the known one, in the raw units of the gyro
+#define GYRO_KNOWN_ZERO_TOLERANCE 16
+
 uint16_t calibratingG = 0;
+static uint16_t calibrationCycles = CALIBRATING_GYRO_CYCLES;   // of the calibration in progress
+static bool checkingKnownZero = false;
 
 static gyroConfig_t *gyroConfig;
+static knownSensors_t *knownSensors;
 
 gyro_t gyro;                      // gyro access functions
-sensor_align_e gyroAlign = 0;
+uint8_t gyroHardware = GYRO_DEFAULT;
+sensor_align_e gyroAlign = ALIGN_DEFAULT;
+
+// raw samples accumulated between two gyroGetADC() calls
+static int32_t gyroADCSum[XYZ_AXIS_COUNT];
+static uint8_t gyroADCSumCount = 0;
+
+static biquadFilter_t gyroFilterLPF[XYZ_AXIS_COUNT];
+static biquadFilter_t gyroFilterNotch[XYZ_AXIS_COUNT];
+static uint32_t gyroFilterSamplePeriod = 0;
+static bool gyroFilterInitialised = false;
 
 void useGyroConfig(gyroConfig_t *gyroConfigToUse)
 {
     gyroConfig = gyroConfigToUse;
+    gyroFilterInitialised = false;
+}
+
+static void initGyroFilters(void)
+{
+    int8_t axis;
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        biquadFilterInitLPF(&gyroFilterLPF[axis], gyroConfig->soft_gyro_lpf_hz, targetPidLooptime);
+        biquadFilterInitNotch(&gyroFilterNotch[axis], gyroConfig->soft_gyro_notch_hz, gyroConfig->soft_gyro_notch_cutoff_hz, targetPidLooptime);
+    }
+    gyroFilterSamplePeriod = targetPidLooptime;
+    gyroFilterInitialised = true;
+}
+
+static void applyGyroFilters(void)
+{
+    int8_t axis;
+    float sample;
+
+    if (!gyroFilterInitialised || gyroFilterSamplePeriod != targetPidLooptime) {
+        initGyroFilters();
+    }
+
+    if (!gyroConfig->soft_gyro_lpf_hz && !gyroConfig->soft_gyro_notch_hz) {
+        return;
+    }
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sample = biquadFilterApply(&gyroFilterNotch[axis], gyroADC[axis]);
+        gyroADC[axis] = lrintf(biquadFilterApply(&gyroFilterLPF[axis], sample));
+    }
 }
 
 void gyroSetCalibrationCycles(uint16_t calibrationCyclesRequired)
 {
     calibratingG = calibrationCyclesRequired;
+    calibrationCycles = calibrationCyclesRequired;
+    checkingKnownZero = false;
+}
+
+/*
+ * Starts the calibration at boot. When the zero of this gyro is known from an earlier full calibration, it is only
+ * checked over CHECKING_GYRO_CYCLES: the measured zero is used when it is close to the known one, otherwise a full
+ * calibration follows. A full calibration is stored in knownSensorsToUse.
+ */
+void gyroStartBootCalibration(knownSensors_t *knownSensorsToUse)
+{
+    knownSensors = knownSensorsToUse;
+
+    if ((knownSensors->calibrated & SENSOR_GYRO) && knownSensors->gyroHardware == gyroHardware) {
+        gyroSetCalibrationCycles(CHECKING_GYRO_CYCLES);
+        checkingKnownZero = true;
+    } else {
+        gyroSetCalibrationCycles(CALIBRATING_GYRO_CYCLES);
+    }
 }
 
 bool isGyroCalibrationComplete(void)
@@ -60,7 +133,48 @@ bool isOnFinalGyroCalibrationCycle(void)
 
 bool isOnFirstGyroCalibrationCycle(void)
 {
-    return calibratingG == CALIBRATING_GYRO_CYCLES;
+    return calibratingG == calibrationCycles;
+}
+
+static bool isGyroZeroKnown(void)
+{
+    int8_t axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        if (abs(gyroZero[axis] - knownSensors->gyroZero[axis]) > GYRO_KNOWN_ZERO_TOLERANCE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void storeKnownGyroZero(void)
+{
+    int8_t axis;
+
+    for (axis = 0; axis < 3; axis++) {
+        knownSensors->gyroZero[axis] = gyroZero[axis];
+    }
+    knownSensors->gyroHardware = gyroHardware;
+    knownSensors->calibrated |= SENSOR_GYRO;
+    requestEEPROMWrite();
+}
+
+// returns false when the zero measured to check the known one is not close to it, a full calibration follows then
+static bool acceptGyroZero(void)
+{
+    if (checkingKnownZero) {
+        if (isGyroZeroKnown()) {
+            return true;
+        }
+        gyroSetCalibrationCycles(CALIBRATING_GYRO_CYCLES);
+        return false;
+    }
+
+    if (knownSensors && calibrationCycles == CALIBRATING_GYRO_CYCLES) {
+        storeKnownGyroZero();
+    }
+    return true;
 }
 
 static void performAcclerationCalibration(uint8_t gyroMovementCalibrationThreshold)
@@ -77,7 +191,7 @@ static void performAcclerationCalibration(uint8_t gyroMovementCalibrationThresho
             devClear(&var[axis]);
         }
 
-        // Sum up CALIBRATING_GYRO_CYCLES readings
+        // Sum up calibrationCycles readings
         g[axis] += gyroADC[axis];
         devPush(&var[axis], gyroADC[axis]);
 
@@ -89,13 +203,17 @@ static void performAcclerationCalibration(uint8_t gyroMovementCalibrationThresho
             float dev = devStandardDeviation(&var[axis]);
             // check deviation and startover if idiot was moving the model
             if (gyroMovementCalibrationThreshold && dev > gyroMovementCalibrationThreshold) {
-                gyroSetCalibrationCycles(CALIBRATING_GYRO_CYCLES);
+                calibratingG = calibrationCycles;
                 return;
             }
-            gyroZero[axis] = (g[axis] + (CALIBRATING_GYRO_CYCLES / 2)) / CALIBRATING_GYRO_CYCLES;
+            gyroZero[axis] = (g[axis] + (calibrationCycles / 2)) / calibrationCycles;
             blinkLedAndSoundBeeper(10, 15, 1);
         }
     }
+
+    if (isOnFinalGyroCalibrationCycle() && !acceptGyroZero()) {
+        return;
+    }
     calibratingG--;
 }
 
@@ -107,10 +225,38 @@ static void applyGyroZero(void)
     }
 }
 
-void gyroGetADC(void)
+/*
+ * Reads one gyro sample into the accumulator.  Used to sample the gyro faster than the PID loop runs, the next
+ * gyroGetADC() averages all accumulated samples, which low pass filters the gyro before it is decimated to the
+ * PID rate instead of letting noise above the PID rate alias into the loop.
+ */
+void gyroAccumulateSample(void)
 {
+    int16_t sample[XYZ_AXIS_COUNT];
+    int8_t axis;
+
     // range: +/- 8192; +/- 2000 deg/sec
-    gyro.read(gyroADC);
+    gyro.read(sample);
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroADCSum[axis] += sample[axis];
+    }
+    gyroADCSumCount++;
+}
+
+void gyroGetADC(void)
+{
+    int8_t axis;
+
+    if (gyroADCSumCount == 0) {
+        gyroAccumulateSample();
+    }
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroADC[axis] = gyroADCSum[axis] / gyroADCSumCount;
+        gyroADCSum[axis] = 0;
+    }
+    gyroADCSumCount = 0;
+
     alignSensors(gyroADC, gyroADC, gyroAlign);
 
     if (!isGyroCalibrationComplete()) {
@@ -118,4 +264,5 @@ void gyroGetADC(void)
     }
 
     applyGyroZero();
+    applyGyroFilters();
 }
@@ -17,15 +17,33 @@
 
 #pragma once
 
+// Type of gyro used/detected
+typedef enum {
+    GYRO_DEFAULT = 0,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_SPI_MPU6000,
+    GYRO_SPI_MPU6500,
+    GYRO_FAKE
+} gyroSensor_e;
+
 extern gyro_t gyro;
+extern uint8_t gyroHardware;
 extern sensor_align_e gyroAlign;
 
 typedef struct gyroConfig_s {
     uint8_t gyroMovementCalibrationThreshold; // people keep forgetting that moving model while init results in wrong gyro offsets. and then they never reset gyro. so this is now on by default.
+    uint16_t soft_gyro_lpf_hz;              // software biquad low pass filter cutoff in Hz, applied at the PID rate, 0 = off
+    uint16_t soft_gyro_notch_hz;            // software notch filter center frequency in Hz, 0 = off
+    uint16_t soft_gyro_notch_cutoff_hz;     // lower -3dB edge of the notch, must be below soft_gyro_notch_hz
 } gyroConfig_t;
 
 void useGyroConfig(gyroConfig_t *gyroConfigToUse);
 void gyroSetCalibrationCycles(uint16_t calibrationCyclesRequired);
+void gyroStartBootCalibration(knownSensors_t *knownSensorsToUse);
+void gyroAccumulateSample(void);
 void gyroGetADC(void);
 bool isGyroCalibrationComplete(void);
 
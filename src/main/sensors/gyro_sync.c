@@ -0,0 +1,181 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs the PID loop in phase with the gyro instead of from a free running looptime.
+ *
+ * The gyro data ready interrupt calls gyroSyncDataReady() with the time of the sample, every denominator'th sample is
+ * passed on to the PID loop task via gyroSyncCheckUpdate().  Latency from data ready to the loop starting and jitter
+ * of the loop period are recorded so the benefit can be verified in flight.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "drivers/system.h"
+
+#include "sensors/gyro_sync.h"
+
+static bool gyroSyncEnabled = false;
+static uint32_t loopPeriod;
+static uint8_t sampleDenominator;
+
+static volatile uint8_t samplesUntilUpdate;
+static volatile uint32_t updateSequence;    // counts the updates signalled by the interrupt
+static volatile uint32_t updateSampleTime;  // time of the sample of the last signalled update
+static uint32_t handledSequence;
+
+static uint32_t lastUpdateAt;
+static bool haveLastUpdate;             // no jitter for the first update
+static bool timedOut;
+static uint32_t fallbackDeadline;       // next loop update while running without the data ready signal
+
+static gyroSyncStats_t gyroSyncStats;
+
+void gyroSyncResetStats(void)
+{
+    memset(&gyroSyncStats, 0, sizeof(gyroSyncStats));
+    gyroSyncStats.minLatency = UINT32_MAX;
+}
+
+void gyroSyncInit(uint32_t samplePeriod, uint8_t denominator)
+{
+    if (denominator == 0) {
+        denominator = 1;
+    }
+
+    sampleDenominator = denominator;
+    loopPeriod = samplePeriod * denominator;
+    samplesUntilUpdate = denominator;
+    handledSequence = updateSequence;
+    lastUpdateAt = micros();
+    haveLastUpdate = false;
+    timedOut = false;
+    gyroSyncEnabled = samplePeriod > 0;
+
+    gyroSyncResetStats();
+}
+
+bool gyroSyncIsEnabled(void)
+{
+    return gyroSyncEnabled;
+}
+
+uint32_t gyroSyncGetLoopPeriod(void)
+{
+    return loopPeriod;
+}
+
+// Called from the data ready interrupt handler
+void gyroSyncDataReady(uint32_t sampleTime)
+{
+    gyroSyncStats.samples++;
+
+    if (--samplesUntilUpdate > 0) {
+        return;
+    }
+    samplesUntilUpdate = sampleDenominator;
+
+    // the time is written first, gyroSyncCheckUpdate() reads it again when the sequence changed meanwhile
+    updateSampleTime = sampleTime;
+    updateSequence++;
+}
+
+static void recordLoopStart(uint32_t currentTime)
+{
+    if (haveLastUpdate) {
+        int32_t jitter = (int32_t)(currentTime - lastUpdateAt - loopPeriod);
+        uint32_t absoluteJitter = jitter < 0 ? -jitter : jitter;
+
+        gyroSyncStats.totalJitter += absoluteJitter;
+        if (absoluteJitter > gyroSyncStats.maxJitter) {
+            gyroSyncStats.maxJitter = absoluteJitter;
+        }
+    }
+    lastUpdateAt = currentTime;
+    haveLastUpdate = true;
+    gyroSyncStats.updates++;
+}
+
+// the data ready signal has stopped, keep flying at the loop period until it returns
+static bool checkTimeout(uint32_t currentTime)
+{
+    if (!timedOut) {
+        if (currentTime - lastUpdateAt < loopPeriod * GYRO_SYNC_TIMEOUT_PERIODS) {
+            return false;
+        }
+        timedOut = true;
+        fallbackDeadline = currentTime;
+    } else if ((int32_t)(currentTime - fallbackDeadline) < 0) {
+        return false;
+    }
+
+    fallbackDeadline += loopPeriod;
+    if ((int32_t)(currentTime - fallbackDeadline) >= 0) {
+        // more than a period late, do not catch up with a burst of loop updates
+        fallbackDeadline = currentTime + loopPeriod;
+    }
+
+    gyroSyncStats.timeouts++;
+    recordLoopStart(currentTime);
+    return true;
+}
+
+/*
+ * Returns true when the PID loop should run.  The update is consumed, so call this once per scheduler check.
+ */
+bool gyroSyncCheckUpdate(uint32_t currentTime)
+{
+    uint32_t sequence;
+    uint32_t sampleTime;
+    uint32_t latency;
+
+    // an update signalled while reading changes the sequence, the time is then read again so it belongs to the sequence
+    do {
+        sequence = updateSequence;
+        sampleTime = updateSampleTime;
+    } while (sequence != updateSequence);
+
+    if (sequence == handledSequence) {
+        return checkTimeout(currentTime);
+    }
+
+    // every update signalled before the previous one was handled is missed, only the latest one runs the loop
+    gyroSyncStats.missedUpdates += sequence - handledSequence - 1;
+    handledSequence = sequence;
+    timedOut = false;
+
+    latency = currentTime - sampleTime;
+    gyroSyncStats.totalLatency += latency;
+    if (latency < gyroSyncStats.minLatency) {
+        gyroSyncStats.minLatency = latency;
+    }
+    if (latency > gyroSyncStats.maxLatency) {
+        gyroSyncStats.maxLatency = latency;
+    }
+
+    recordLoopStart(currentTime);
+    return true;
+}
+
+const gyroSyncStats_t *getGyroSyncStats(void)
+{
+    return &gyroSyncStats;
+}
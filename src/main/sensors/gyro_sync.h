@@ -0,0 +1,43 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// the PID loop falls back to running without a data ready signal after this many missing loop periods
+#define GYRO_SYNC_TIMEOUT_PERIODS 4
+
+typedef struct gyroSyncStats_s {
+    uint32_t samples;               // data ready signals received
+    uint32_t missedUpdates;         // loop updates that were signalled again before the previous one was handled
+    uint32_t timeouts;              // loop updates triggered by the timeout instead of a data ready signal
+    uint32_t updates;               // loop updates handed to the PID loop
+    uint32_t minLatency;            // time from data ready to the PID loop starting, in us
+    uint32_t maxLatency;
+    uint32_t totalLatency;
+    uint32_t maxJitter;             // deviation of the time between loop updates from the loop period, in us
+    uint32_t totalJitter;
+} gyroSyncStats_t;
+
+void gyroSyncInit(uint32_t samplePeriod, uint8_t denominator);
+bool gyroSyncIsEnabled(void);
+uint32_t gyroSyncGetLoopPeriod(void);
+
+void gyroSyncDataReady(uint32_t sampleTime);
+bool gyroSyncCheckUpdate(uint32_t currentTime);
+
+const gyroSyncStats_t *getGyroSyncStats(void);
+void gyroSyncResetStats(void);
@@ -57,6 +57,10 @@
 #include "sensors/compass.h"
 #include "sensors/sonar.h"
 
+#ifdef SITL
+#include "target/SITL/sitl.h"
+#endif
+
 #ifdef NAZE
 #include "hardware_revision.h"
 #endif
@@ -126,72 +130,100 @@ bool fakeAccDetect(acc_t *acc)
 }
 #endif
 
-bool detectGyro(uint16_t gyroLpf)
+// tries gyroHardwareToUse first, the known gyro, and the others only when it is not found
+bool detectGyro(uint8_t gyroHardwareToUse, uint16_t gyroLpf)
 {
+retry:
     gyroAlign = ALIGN_DEFAULT;
+    gyroHardware = GYRO_DEFAULT;
 
+    switch (gyroHardwareToUse) {
+        default:
+        case GYRO_DEFAULT: // autodetect
 #ifdef USE_GYRO_MPU6050
-    if (mpu6050GyroDetect(selectMPU6050Config(), &gyro, gyroLpf)) {
+        case GYRO_MPU6050:
+            if (mpu6050GyroDetect(selectMPU6050Config(), &gyro, gyroLpf)) {
+                gyroHardware = GYRO_MPU6050;
 #ifdef NAZE
-        gyroAlign = CW0_DEG;
+                gyroAlign = CW0_DEG;
 #endif
-        return true;
-    }
+                break;
+            }
 #endif
-
 #ifdef USE_GYRO_L3G4200D
-    if (l3g4200dDetect(&gyro, gyroLpf)) {
+        case GYRO_L3G4200D:
+            if (l3g4200dDetect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_L3G4200D;
 #ifdef NAZE
-        gyroAlign = CW0_DEG;
+                gyroAlign = CW0_DEG;
 #endif
-        return true;
-    }
+                break;
+            }
 #endif
-
 #ifdef USE_GYRO_MPU3050
-    if (mpu3050Detect(&gyro, gyroLpf)) {
+        case GYRO_MPU3050:
+            if (mpu3050Detect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_MPU3050;
 #ifdef NAZE
-        gyroAlign = CW0_DEG;
+                gyroAlign = CW0_DEG;
 #endif
-        return true;
-    }
+                break;
+            }
 #endif
-
 #ifdef USE_GYRO_L3GD20
-    if (l3gd20Detect(&gyro, gyroLpf)) {
-        return true;
-    }
+        case GYRO_L3GD20:
+            if (l3gd20Detect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_L3GD20;
+                break;
+            }
 #endif
-
 #ifdef USE_GYRO_SPI_MPU6000
-    if (mpu6000SpiGyroDetect(&gyro, gyroLpf)) {
+        case GYRO_SPI_MPU6000:
+            if (mpu6000SpiGyroDetect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_SPI_MPU6000;
 #ifdef CC3D
-        gyroAlign = CW270_DEG;
+                gyroAlign = CW270_DEG;
 #endif
-        return true;
-    }
+                break;
+            }
 #endif
-
 #ifdef USE_GYRO_SPI_MPU6500
+        case GYRO_SPI_MPU6500:
 #ifdef NAZE
-    if (hardwareRevision == NAZE32_SP && mpu6500SpiGyroDetect(&gyro, gyroLpf)) {
-        gyroAlign = CW0_DEG;
-        return true;
-    }
+            if (hardwareRevision == NAZE32_SP && mpu6500SpiGyroDetect(&gyro, gyroLpf)) {
 #else
-    if (mpu6500SpiGyroDetect(&gyro, gyroLpf)) {
-        gyroAlign = CW0_DEG;
-        return true;
-    }
+            if (mpu6500SpiGyroDetect(&gyro, gyroLpf)) {
 #endif
+                gyroHardware = GYRO_SPI_MPU6500;
+                gyroAlign = CW0_DEG;
+                break;
+            }
+#endif
+#if defined(USE_GYRO_SITL) || defined(USE_FAKE_GYRO)
+        case GYRO_FAKE:
+#ifdef USE_GYRO_SITL
+            if (sitlGyroDetect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_FAKE;
+                break;
+            }
 #endif
-
 #ifdef USE_FAKE_GYRO
-    if (fakeGyroDetect(&gyro, gyroLpf)) {
-        return true;
-    }
+            if (fakeGyroDetect(&gyro, gyroLpf)) {
+                gyroHardware = GYRO_FAKE;
+                break;
+            }
+#endif
 #endif
-    return false;
+            ; // prevent compiler error
+    }
+
+    if (gyroHardware == GYRO_DEFAULT && gyroHardwareToUse != GYRO_DEFAULT) {
+        // the known gyro is gone, the ones before it were not tried yet
+        gyroHardwareToUse = GYRO_DEFAULT;
+        goto retry;
+    }
+
+    return gyroHardware != GYRO_DEFAULT;
 }
 
 static void detectAcc(uint8_t accHardwareToUse)
@@ -308,6 +340,15 @@ retry:
                     break;
             }
             ; // fallthrough
+#endif
+#ifdef USE_ACC_SITL
+        case ACC_FAKE:
+            if (sitlAccDetect(&acc)) {
+                accHardware = ACC_FAKE;
+                if (accHardwareToUse == ACC_FAKE)
+                    break;
+            }
+            ; // fallthrough
 #endif
             ; // prevent compiler error
     }
@@ -325,11 +366,14 @@ retry:
     }
 }
 
-static void detectBaro()
+// tries baroHardwareToUse first, the known barometer, and the others only when it is not found
+static void detectBaro(uint8_t baroHardwareToUse)
 {
     // Detect what pressure sensors are available. baro->update() is set to sensor-specific update function
 
-    #ifdef BARO
+    baroHardware = BARO_NONE;
+
+#ifdef BARO
 #ifdef USE_BARO_BMP085
 
     const bmp085Config_t *bmp085Config = NULL;
@@ -353,19 +397,50 @@ static void detectBaro()
 
 #endif
 
+retry:
+    switch (baroHardwareToUse) {
+        default:
+        case BARO_DEFAULT: // autodetect
+            ; // fallthrough
 #ifdef USE_BARO_MS5611
-    if (ms5611Detect(&baro)) {
-        return;
-    }
+        case BARO_MS5611:
+            if (ms5611Detect(&baro)) {
+                baroHardware = BARO_MS5611;
+                break;
+            }
+            ; // fallthrough
 #endif
-
 #ifdef USE_BARO_BMP085
-    if (bmp085Detect(bmp085Config, &baro)) {
-        return;
-    }
+        case BARO_BMP085:
+            if (bmp085Detect(bmp085Config, &baro)) {
+                baroHardware = BARO_BMP085;
+                break;
+            }
+            ; // fallthrough
 #endif
+#ifdef USE_BARO_SITL
+        case BARO_FAKE:
+            if (sitlBaroDetect(&baro)) {
+                baroHardware = BARO_FAKE;
+                break;
+            }
+            ; // fallthrough
+#endif
+            ; // prevent compiler error
+    }
+
+    if (baroHardware == BARO_NONE && baroHardwareToUse != BARO_DEFAULT) {
+        // the known barometer is gone, the ones before it were not tried yet
+        baroHardwareToUse = BARO_DEFAULT;
+        goto retry;
+    }
+#else
+    UNUSED(baroHardwareToUse);
 #endif
-    sensorsClear(SENSOR_BARO);
+
+    if (baroHardware == BARO_NONE) {
+        sensorsClear(SENSOR_BARO);
+    }
 }
 
 void reconfigureAlignment(sensorAlignmentConfig_t *sensorAlignmentConfig)
@@ -381,17 +456,36 @@ void reconfigureAlignment(sensorAlignmentConfig_t *sensorAlignmentConfig)
     }
 }
 
-bool sensorsAutodetect(sensorAlignmentConfig_t *sensorAlignmentConfig, uint16_t gyroLpf, uint8_t accHardwareToUse, int16_t magDeclinationFromConfig)
+/*
+ * The sensors found are stored in knownSensors, they are tried first at the next boot. When a sensor differs from the
+ * known one its calibrations are no longer known.
+ */
+static void updateKnownSensors(knownSensors_t *knownSensors)
+{
+    if (knownSensors->gyroHardware != gyroHardware || knownSensors->accHardware != accHardware ||
+            knownSensors->baroHardware != baroHardware) {
+        knownSensors->calibrated = 0;
+    }
+    knownSensors->gyroHardware = gyroHardware;
+    knownSensors->accHardware = accHardware;
+    knownSensors->baroHardware = baroHardware;
+}
+
+bool sensorsAutodetect(sensorAlignmentConfig_t *sensorAlignmentConfig, uint16_t gyroLpf, uint8_t accHardwareToUse, int16_t magDeclinationFromConfig, knownSensors_t *knownSensors)
 {
     int16_t deg, min;
     memset(&acc, sizeof(acc), 0);
     memset(&gyro, sizeof(gyro), 0);
 
-    if (!detectGyro(gyroLpf)) {
+    if (!detectGyro(knownSensors->gyroHardware, gyroLpf)) {
         return false;
     }
+    if (accHardwareToUse == ACC_DEFAULT) {
+        accHardwareToUse = knownSensors->accHardware;
+    }
     detectAcc(accHardwareToUse);
-    detectBaro();
+    detectBaro(knownSensors->baroHardware);
+    updateKnownSensors(knownSensors);
 
     reconfigureAlignment(sensorAlignmentConfig);
 
@@ -21,6 +21,10 @@
 #define CALIBRATING_ACC_CYCLES              400
 #define CALIBRATING_BARO_CYCLES             200 // 10 seconds init_delay + 200 * 25 ms = 15 seconds before ground pressure settles
 
+// at boot a known calibration is checked in fewer cycles, see gyroStartBootCalibration() and baroStartBootCalibration()
+#define CHECKING_GYRO_CYCLES                100
+#define CHECKING_BARO_CYCLES                40
+
 typedef enum {
     SENSOR_GYRO = 1 << 0, // always present
     SENSOR_ACC = 1 << 1,
@@ -49,4 +53,14 @@ typedef struct sensorAlignmentConfig_s {
     sensor_align_e mag_align;               // mag alignment
 } sensorAlignmentConfig_t;
 
+// the sensors found by the last full detection and their last full calibration, used to shorten the next boot
+typedef struct knownSensors_s {
+    uint8_t gyroHardware;                   // gyroSensor_e, GYRO_DEFAULT when not known
+    uint8_t accHardware;                    // AccelSensors, ACC_DEFAULT when not known
+    uint8_t baroHardware;                   // baroSensor_e, BARO_DEFAULT when not known
+    uint8_t calibrated;                     // sensors_e of the calibrations below that are known
+    int16_t gyroZero[3];
+    int32_t baroGroundPressure;             // in Pa
+} knownSensors_t;
+
 extern int16_t heading;
@@ -40,6 +40,7 @@
 
 #define GYRO
 #define USE_GYRO_SPI_MPU6000
+#define USE_MPU_DATA_READY_SIGNAL
 
 #define INVERTER
 #define BEEPER
@@ -65,5 +66,8 @@
 #define GPS
 #define LED_STRIP
 #define TELEMETRY
+#define BLACKBOX
 #define SERIAL_RX
 #define AUTOTUNE
+#define PROFILING
+#define FAST_MATH
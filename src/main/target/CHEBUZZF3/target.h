@@ -56,6 +56,8 @@
 #define GPS
 #define LED_STRIP
 #define TELEMETRY
+#define BLACKBOX
 #define SOFT_SERIAL
 #define SERIAL_RX
 #define AUTOTUNE
+#define PROFILING
@@ -61,3 +61,4 @@
 #define SENSORS_SET (SENSOR_ACC | SENSOR_MAG)
 
 #define SERIAL_RX
+#define FAST_MATH
@@ -71,7 +71,10 @@
 #define GPS
 #define LED_STRIP
 #define TELEMETRY
+#define BLACKBOX
 #define SOFT_SERIAL
 #define SERIAL_RX
 #define AUTOTUNE
+#define PROFILING
+#define FAST_MATH
 
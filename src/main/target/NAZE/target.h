@@ -61,6 +61,7 @@
 
 #define GYRO
 #define USE_GYRO_MPU6050
+#define USE_MPU_DATA_READY_SIGNAL
 
 #define ACC
 #define USE_ACC_ADXL345
@@ -103,6 +104,9 @@
 
 #define LED_STRIP
 #define TELEMETRY
+#define BLACKBOX
 #define SOFT_SERIAL
 #define SERIAL_RX
 #define AUTOTUNE
+#define PROFILING
+#define FAST_MATH
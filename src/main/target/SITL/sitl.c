@@ -0,0 +1,338 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/profiling.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/barometer.h"
+
+#include "config/runtime_config.h"
+
+#include "flight/flight.h"
+
+#include "scheduler/scheduler.h"
+
+#include "sitl.h"
+
+// airframe, roughly a 1kg 330mm quad on 3S
+#define SITL_MASS                   1.0f        // kg
+#define SITL_ARM_LENGTH             0.165f      // m, centre to motor
+#define SITL_INERTIA_XY             0.0055f     // kg m^2
+#define SITL_INERTIA_Z              0.0095f     // kg m^2
+#define SITL_MOTOR_MAX_THRUST       8.0f        // N per motor
+#define SITL_MOTOR_TIME_CONSTANT    0.02f       // s
+#define SITL_YAW_TORQUE_PER_THRUST  0.016f      // m
+#define SITL_LINEAR_DRAG            0.25f       // N per m/s
+#define SITL_ANGULAR_DRAG           0.0005f     // Nm per rad/s
+#define SITL_GRAVITY                9.80665f    // m/s/s
+
+#define SITL_STEP_US                250
+
+#define SITL_DEFAULT_DURATION_S     20
+#define SITL_DEFAULT_LOG_INTERVAL_MS 100
+
+// x forward, y right, propeller spin seen from above: 1 is clockwise
+static const struct {
+    float x;
+    float y;
+    int8_t spin;
+} motorLayout[SITL_MOTOR_COUNT] = {
+    { -1.0f,  1.0f,  1 },   // rear right, CW
+    {  1.0f,  1.0f, -1 },   // front right, CCW
+    { -1.0f, -1.0f, -1 },   // rear left, CCW
+    {  1.0f, -1.0f,  1 },   // front left, CW
+};
+
+// pilot inputs over time, in AETR channel order like the default rcmap
+typedef struct sitlRcStep_s {
+    uint32_t atMs;
+    uint16_t roll;
+    uint16_t pitch;
+    uint16_t throttle;
+    uint16_t yaw;
+} sitlRcStep_t;
+
+static const sitlRcStep_t rcScript[] = {
+    {     0, 1500, 1500, 1000, 1500 },  // sensors calibrate
+    {  8000, 1500, 1500, 1000, 2000 },  // arm with the sticks
+    {  9500, 1500, 1500, 1000, 1500 },
+    { 10000, 1500, 1500, 1700, 1500 },  // lift off
+    { 11000, 1500, 1500, 1620, 1500 },  // about hover
+    { 13000, 1600, 1500, 1620, 1500 },  // roll right and back
+    { 13300, 1400, 1500, 1620, 1500 },
+    { 13600, 1500, 1500, 1620, 1500 },
+    { 15000, 1500, 1600, 1620, 1500 },  // pitch forward and back
+    { 15300, 1500, 1400, 1620, 1500 },
+    { 15600, 1500, 1500, 1620, 1500 },
+    { 17000, 1500, 1500, 1620, 1600 },  // yaw right
+    { 17500, 1500, 1500, 1620, 1500 },
+};
+
+#define RC_SCRIPT_LENGTH (sizeof(rcScript) / sizeof(rcScript[0]))
+
+sitlState_t sitlState;
+
+static float motorCommand[SITL_MOTOR_COUNT];
+static uint64_t simulatedUntilUs;
+static uint64_t durationUs;
+static uint64_t logIntervalUs;
+static uint64_t nextLogAtUs;
+static uint64_t nextSerialPollAtUs;
+
+static uint32_t envOrDefault(const char *name, uint32_t defaultValue)
+{
+    const char *value = getenv(name);
+    if (!value || !*value) {
+        return defaultValue;
+    }
+    return strtoul(value, NULL, 10);
+}
+
+static void rotateBodyToEarth(const float *q, const float *v, float *out)
+{
+    float w = q[0], x = q[1], y = q[2], z = q[3];
+
+    out[0] = (1 - 2 * (y * y + z * z)) * v[0] + 2 * (x * y - w * z) * v[1] + 2 * (x * z + w * y) * v[2];
+    out[1] = 2 * (x * y + w * z) * v[0] + (1 - 2 * (x * x + z * z)) * v[1] + 2 * (y * z - w * x) * v[2];
+    out[2] = 2 * (x * z - w * y) * v[0] + 2 * (y * z + w * x) * v[1] + (1 - 2 * (x * x + y * y)) * v[2];
+}
+
+static void rotateEarthToBody(const float *q, const float *v, float *out)
+{
+    const float conjugate[4] = { q[0], -q[1], -q[2], -q[3] };
+    rotateBodyToEarth(conjugate, v, out);
+}
+
+void sitlGetEulerAngles(float *roll, float *pitch, float *yaw)
+{
+    float w = sitlState.q[0], x = sitlState.q[1], y = sitlState.q[2], z = sitlState.q[3];
+    const float toDegrees = 180.0f / (float)M_PI;
+
+    *roll = atan2f(2 * (w * x + y * z), 1 - 2 * (x * x + y * y)) * toDegrees;
+    *pitch = asinf(fmaxf(-1.0f, fminf(1.0f, 2 * (w * y - z * x)))) * toDegrees;
+    *yaw = atan2f(2 * (w * z + x * y), 1 - 2 * (y * y + z * z)) * toDegrees;
+}
+
+static void stepModel(float dT)
+{
+    float thrust[SITL_MOTOR_COUNT];
+    float totalThrust = 0;
+    float torque[3] = { 0, 0, 0 };
+    const float armOffset = SITL_ARM_LENGTH * 0.70710678f;
+    int i;
+
+    for (i = 0; i < SITL_MOTOR_COUNT; i++) {
+        sitlState.motorSpeed[i] += (motorCommand[i] - sitlState.motorSpeed[i]) * dT / SITL_MOTOR_TIME_CONSTANT;
+        thrust[i] = SITL_MOTOR_MAX_THRUST * sitlState.motorSpeed[i] * sitlState.motorSpeed[i];
+        totalThrust += thrust[i];
+
+        // thrust acts along -z, a clockwise propeller yaws the frame anticlockwise
+        torque[X] -= motorLayout[i].y * armOffset * thrust[i];
+        torque[Y] += motorLayout[i].x * armOffset * thrust[i];
+        torque[Z] -= motorLayout[i].spin * SITL_YAW_TORQUE_PER_THRUST * thrust[i];
+    }
+
+    // rotation, Euler's equations with a little aerodynamic damping
+    const float inertia[3] = { SITL_INERTIA_XY, SITL_INERTIA_XY, SITL_INERTIA_Z };
+    float *rate = sitlState.rate;
+    const float gyroscopic[3] = {
+        (inertia[Y] - inertia[Z]) * rate[Y] * rate[Z],
+        (inertia[Z] - inertia[X]) * rate[Z] * rate[X],
+        (inertia[X] - inertia[Y]) * rate[X] * rate[Y],
+    };
+    for (i = 0; i < 3; i++) {
+        rate[i] += (torque[i] + gyroscopic[i] - SITL_ANGULAR_DRAG * rate[i]) / inertia[i] * dT;
+    }
+
+    float *q = sitlState.q;
+    const float dq[4] = {
+        0.5f * (-q[1] * rate[X] - q[2] * rate[Y] - q[3] * rate[Z]),
+        0.5f * ( q[0] * rate[X] + q[2] * rate[Z] - q[3] * rate[Y]),
+        0.5f * ( q[0] * rate[Y] - q[1] * rate[Z] + q[3] * rate[X]),
+        0.5f * ( q[0] * rate[Z] + q[1] * rate[Y] - q[2] * rate[X]),
+    };
+    float norm = 0;
+    for (i = 0; i < 4; i++) {
+        q[i] += dq[i] * dT;
+        norm += q[i] * q[i];
+    }
+    norm = 1.0f / sqrtf(norm);
+    for (i = 0; i < 4; i++) {
+        q[i] *= norm;
+    }
+
+    // translation
+    const float bodyForce[3] = { 0, 0, -totalThrust };
+    float earthForce[3];
+    rotateBodyToEarth(q, bodyForce, earthForce);
+
+    float earthAcceleration[3];
+    for (i = 0; i < 3; i++) {
+        earthAcceleration[i] = (earthForce[i] - SITL_LINEAR_DRAG * sitlState.velocity[i]) / SITL_MASS;
+    }
+    earthAcceleration[Z] += SITL_GRAVITY;
+
+    for (i = 0; i < 3; i++) {
+        sitlState.velocity[i] += earthAcceleration[i] * dT;
+        sitlState.position[i] += sitlState.velocity[i] * dT;
+    }
+
+    // sitting on the ground, which holds the frame still until it lifts off
+    if (sitlState.position[Z] >= 0) {
+        sitlState.position[Z] = 0;
+        memset(sitlState.velocity, 0, sizeof(sitlState.velocity));
+        memset(sitlState.rate, 0, sizeof(sitlState.rate));
+        memset(earthAcceleration, 0, sizeof(earthAcceleration));
+    }
+
+    // an accelerometer measures everything but gravity
+    earthAcceleration[Z] -= SITL_GRAVITY;
+    rotateEarthToBody(q, earthAcceleration, sitlState.specificForce);
+}
+
+static void logState(uint64_t timeUs)
+{
+    float roll, pitch, yaw;
+    sitlGetEulerAngles(&roll, &pitch, &yaw);
+
+    printf("t=%8.3f armed=%d alt=%7.2f att=%7.1f,%7.1f,%7.1f est=%6.1f,%6.1f motors=%4.2f,%4.2f,%4.2f,%4.2f\n",
+        timeUs / 1e6,
+        ARMING_FLAG(ARMED) ? 1 : 0,
+        0.0f - sitlState.position[Z],
+        roll, pitch, yaw,
+        inclination.values.rollDeciDegrees / 10.0f, inclination.values.pitchDeciDegrees / 10.0f,
+        sitlState.motorSpeed[0], sitlState.motorSpeed[1], sitlState.motorSpeed[2], sitlState.motorSpeed[3]
+    );
+}
+
+static void printReport(void)
+{
+    cfTaskInfo_t taskInfo;
+    cfTaskId_e taskId;
+
+    printf("\nTask list          period/us  max/us  avg/us  total/ms\n");
+    for (taskId = 0; taskId < TASK_COUNT; taskId++) {
+        getTaskInfo(taskId, &taskInfo);
+        if (!taskInfo.isEnabled) {
+            continue;
+        }
+        printf("%-16s %11u %7u %7u %9u\n",
+            taskInfo.taskName,
+            taskInfo.desiredPeriod,
+            taskInfo.maxExecutionTime,
+            taskInfo.averageExecutionTime,
+            taskInfo.totalExecutionTime / 1000
+        );
+    }
+
+#ifdef PROFILING
+    profileStage_e stage;
+    printf("\nStage (host)       count  avg/ns  max/ns\n");
+    for (stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        const profileStageStats_t *stats = getProfileStageStats(stage);
+        if (!stats->count) {
+            continue;
+        }
+        printf("%-16s %8u %7u %7u\n",
+            getProfileStageName(stage),
+            stats->count,
+            getProfileStageAverageCycles(stage),
+            stats->maxCycles
+        );
+    }
+#endif
+}
+
+void sitlInit(void)
+{
+    memset(&sitlState, 0, sizeof(sitlState));
+    sitlState.q[0] = 1.0f;
+    memset(motorCommand, 0, sizeof(motorCommand));
+
+    simulatedUntilUs = 0;
+    durationUs = (uint64_t)envOrDefault("SITL_DURATION", SITL_DEFAULT_DURATION_S) * 1000000;
+    logIntervalUs = (uint64_t)envOrDefault("SITL_LOG_INTERVAL", SITL_DEFAULT_LOG_INTERVAL_MS) * 1000;
+    nextLogAtUs = 0;
+    nextSerialPollAtUs = 0;
+}
+
+void sitlAdvanceTo(uint64_t timeUs)
+{
+    while (simulatedUntilUs + SITL_STEP_US <= timeUs) {
+        stepModel(SITL_STEP_US * 1e-6f);
+        simulatedUntilUs += SITL_STEP_US;
+
+        if (simulatedUntilUs >= nextSerialPollAtUs) {
+            sitlSerialPoll();
+            nextSerialPollAtUs = simulatedUntilUs + 1000;
+        }
+
+        if (logIntervalUs && simulatedUntilUs >= nextLogAtUs) {
+            logState(simulatedUntilUs);
+            nextLogAtUs = simulatedUntilUs + logIntervalUs;
+        }
+
+        if (durationUs && simulatedUntilUs >= durationUs) {
+            printReport();
+            fflush(stdout);
+            exit(0);
+        }
+    }
+}
+
+void sitlSetMotor(uint8_t index, uint16_t pulse)
+{
+    if (index >= SITL_MOTOR_COUNT) {
+        return;
+    }
+    float command = (pulse - 1000) / 1000.0f;
+    motorCommand[index] = fmaxf(0.0f, fminf(1.0f, command));
+}
+
+uint16_t sitlGetRcChannel(uint8_t channel)
+{
+    const sitlRcStep_t *step = &rcScript[0];
+    uint32_t nowMs = simulatedUntilUs / 1000;
+    uint8_t i;
+
+    for (i = 1; i < RC_SCRIPT_LENGTH && rcScript[i].atMs <= nowMs; i++) {
+        step = &rcScript[i];
+    }
+
+    switch (channel) {
+        case 0:
+            return step->roll;
+        case 1:
+            return step->pitch;
+        case 2:
+            return step->throttle;
+        case 3:
+            return step->yaw;
+        default:
+            return 1000; // aux switches low
+    }
+}
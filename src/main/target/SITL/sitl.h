@@ -0,0 +1,54 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * Rigid body quad model the SITL drivers read their sensors from.
+ *
+ * The model uses a body frame of x forward, y right, z down and an earth frame
+ * of north, east, down. Motors are numbered like the QUADX mixer, 1 rear right,
+ * 2 front right, 3 rear left and 4 front left.
+ */
+
+#define SITL_MOTOR_COUNT 4
+
+typedef struct sitlState_s {
+    float position[3];      // m, NED
+    float velocity[3];      // m/s, NED
+    float q[4];             // body to earth rotation, w x y z
+    float rate[3];          // rad/s, body frame
+    float specificForce[3]; // m/s/s, body frame, what an accelerometer measures
+    float motorSpeed[SITL_MOTOR_COUNT]; // 0..1 of full thrust
+} sitlState_t;
+
+extern sitlState_t sitlState;
+
+void sitlInit(void);
+void sitlAdvanceTo(uint64_t timeUs);
+void sitlSetMotor(uint8_t index, uint16_t pulse);
+uint16_t sitlGetRcChannel(uint8_t channel);
+
+// attitude of the model in degrees, for reporting
+void sitlGetEulerAngles(float *roll, float *pitch, float *yaw);
+
+// serial ports are serviced from the simulation step, like the UART interrupts on hardware
+void sitlSerialPoll(void);
+
+bool sitlGyroDetect(gyro_t *gyro, uint16_t lpf);
+bool sitlAccDetect(acc_t *acc);
+bool sitlBaroDetect(baro_t *baro);
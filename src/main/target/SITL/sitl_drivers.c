@@ -0,0 +1,206 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "build_config.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/barometer.h"
+#include "drivers/adc.h"
+#include "drivers/gpio.h"
+#include "drivers/light_led.h"
+#include "drivers/timer.h"
+#include "drivers/pwm_mapping.h"
+#include "drivers/pwm_output.h"
+#include "drivers/pwm_rx.h"
+
+#include "sitl.h"
+
+/*
+ * The sensors report the model like an MPU6050 and an MS5611 would. Their axes
+ * are x forward, y left, z up, so the model's y and z body axes are flipped.
+ */
+
+#define SITL_GYRO_LSB_PER_DPS   16.4f
+#define SITL_ACC_1G             (512 * 8)
+
+#define SITL_SEA_LEVEL_PRESSURE 101325.0f   // Pa
+#define SITL_TEMPERATURE        2500        // 0.01 degC
+
+// 3S pack at storage voltage
+#define SITL_BATTERY_VOLTAGE    11.4f
+
+static int16_t toSensorRange(float value)
+{
+    return constrainf(lrintf(value), -32768, 32767);
+}
+
+static void sitlGyroInit(void)
+{
+}
+
+static void sitlGyroRead(int16_t *gyroADC)
+{
+    const float lsbPerRadian = SITL_GYRO_LSB_PER_DPS / RAD;
+
+    gyroADC[X] = toSensorRange(sitlState.rate[X] * lsbPerRadian);
+    gyroADC[Y] = toSensorRange(-sitlState.rate[Y] * lsbPerRadian);
+    gyroADC[Z] = toSensorRange(-sitlState.rate[Z] * lsbPerRadian);
+}
+
+static void sitlGyroReadTemp(int16_t *tempData)
+{
+    *tempData = SITL_TEMPERATURE / 10;
+}
+
+bool sitlGyroDetect(gyro_t *gyro, uint16_t lpf)
+{
+    UNUSED(lpf);
+
+    gyro->init = sitlGyroInit;
+    gyro->read = sitlGyroRead;
+    gyro->temperature = sitlGyroReadTemp;
+    gyro->scale = 1.0f / SITL_GYRO_LSB_PER_DPS;
+    gyro->samplePeriod = 0;
+    return true;
+}
+
+static void sitlAccInit(void)
+{
+    acc_1G = SITL_ACC_1G;
+}
+
+static void sitlAccRead(int16_t *accADC)
+{
+    const float lsbPerMss = SITL_ACC_1G / 9.80665f;
+
+    accADC[X] = toSensorRange(sitlState.specificForce[X] * lsbPerMss);
+    accADC[Y] = toSensorRange(-sitlState.specificForce[Y] * lsbPerMss);
+    accADC[Z] = toSensorRange(-sitlState.specificForce[Z] * lsbPerMss);
+}
+
+bool sitlAccDetect(acc_t *acc)
+{
+    acc->init = sitlAccInit;
+    acc->read = sitlAccRead;
+    acc->revisionCode = 0;
+    return true;
+}
+
+static void sitlBaroNop(void)
+{
+}
+
+static void sitlBaroCalculate(int32_t *pressure, int32_t *temperature)
+{
+    // international standard atmosphere, the inverse of pressureToAltitude()
+    float altitude = -sitlState.position[Z];
+    if (pressure) {
+        *pressure = lrintf(SITL_SEA_LEVEL_PRESSURE * powf(1.0f - 2.25577e-5f * altitude, 5.25588f));
+    }
+    if (temperature) {
+        *temperature = SITL_TEMPERATURE;
+    }
+}
+
+bool sitlBaroDetect(baro_t *baro)
+{
+    baro->ut_delay = 10000;
+    baro->up_delay = 10000;
+    baro->start_ut = sitlBaroNop;
+    baro->get_ut = sitlBaroNop;
+    baro->start_up = sitlBaroNop;
+    baro->get_up = sitlBaroNop;
+    baro->calculate = sitlBaroCalculate;
+    return true;
+}
+
+void adcInit(drv_adc_config_t *init)
+{
+    UNUSED(init);
+}
+
+uint16_t adcGetChannel(uint8_t channel)
+{
+    if (channel != ADC_BATTERY) {
+        return 0;
+    }
+    // 12 bit conversion behind the default 1:11 divider
+    return lrintf(SITL_BATTERY_VOLTAGE / 11.0f / 3.3f * 4095);
+}
+
+void ledInit(void)
+{
+}
+
+void timerInit(void)
+{
+}
+
+pwmOutputConfiguration_t *pwmInit(drv_pwm_config_t *init)
+{
+    static pwmOutputConfiguration_t pwmOutputConfiguration;
+
+    UNUSED(init);
+
+    pwmOutputConfiguration.motorCount = SITL_MOTOR_COUNT;
+    pwmOutputConfiguration.servoCount = 0;
+    return &pwmOutputConfiguration;
+}
+
+void pwmWriteMotor(uint8_t index, uint16_t value)
+{
+    sitlSetMotor(index, value);
+}
+
+void pwmCompleteMotorUpdate(uint8_t motorCount)
+{
+    UNUSED(motorCount);
+}
+
+void pwmWriteServo(uint8_t index, uint16_t value)
+{
+    UNUSED(index);
+    UNUSED(value);
+}
+
+void pwmRxInit(inputFilteringMode_e initialInputFilteringMode)
+{
+    UNUSED(initialInputFilteringMode);
+}
+
+uint16_t pwmRead(uint8_t channel)
+{
+    return sitlGetRcChannel(channel);
+}
+
+bool isPPMDataBeingReceived(void)
+{
+    return true;
+}
+
+void resetPPMDataReceivedState(void)
+{
+}
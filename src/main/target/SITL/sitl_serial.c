@@ -0,0 +1,279 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * UARTs for the simulator, each one is a TCP server on localhost that a
+ * configurator or terminal can connect to. The sockets are serviced from the
+ * simulation step, standing in for the UART interrupts.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include "platform.h"
+
+#include "build_config.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/barometer.h"
+#include "drivers/serial.h"
+#include "drivers/serial_uart.h"
+
+#include "sitl.h"
+
+#define SITL_UART_COUNT 2
+#define SITL_UART_BUFFER_SIZE 256
+
+typedef struct sitlUart_s {
+    uartPort_t uartPort;
+    bool isOpen;
+    int listenFd;
+    int clientFd;
+    volatile uint8_t rxBuffer[SITL_UART_BUFFER_SIZE];
+    volatile uint8_t txBuffer[SITL_UART_BUFFER_SIZE];
+} sitlUart_t;
+
+static sitlUart_t sitlUarts[SITL_UART_COUNT];
+
+static int openListenSocket(uint16_t tcpPort)
+{
+    struct sockaddr_in address;
+    int reuse = 1;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd < 0) {
+        return -1;
+    }
+
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(tcpPort);
+
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(fd, 1) < 0) {
+        fprintf(stderr, "SITL: UART unavailable, cannot listen on port %u: %s\n", tcpPort, strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    printf("SITL: UART%u listening on port %u\n", tcpPort - SITL_TCP_BASE_PORT, tcpPort);
+    return fd;
+}
+
+serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr callback, uint32_t baudRate, portMode_t mode, serialInversion_e inversion)
+{
+    UNUSED(inversion);
+
+    if (USARTx->index >= SITL_UART_COUNT) {
+        return NULL;
+    }
+
+    sitlUart_t *uart = &sitlUarts[USARTx->index];
+    uartPort_t *s = &uart->uartPort;
+
+    if (!uart->isOpen) {
+        uart->listenFd = openListenSocket(SITL_TCP_BASE_PORT + 1 + USARTx->index);
+        uart->clientFd = -1;
+        uart->isOpen = true;
+    }
+
+    s->port.vTable = uartVTable;
+    s->port.baudRate = baudRate;
+    s->port.mode = mode;
+    s->port.callback = callback;
+
+    ringBufferInit(&s->port.rxBuffer, uart->rxBuffer, SITL_UART_BUFFER_SIZE);
+    ringBufferInit(&s->port.txBuffer, uart->txBuffer, SITL_UART_BUFFER_SIZE);
+
+    s->USARTx = USARTx;
+
+    return (serialPort_t *)s;
+}
+
+static void acceptClient(sitlUart_t *uart)
+{
+    int fd = accept(uart->listenFd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+
+    int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    uart->clientFd = fd;
+}
+
+static void disconnectClient(sitlUart_t *uart)
+{
+    close(uart->clientFd);
+    uart->clientFd = -1;
+}
+
+static void receive(sitlUart_t *uart)
+{
+    serialPort_t *port = &uart->uartPort.port;
+    uint8_t buffer[SITL_UART_BUFFER_SIZE];
+    size_t maxCount = sizeof(buffer);
+
+    if (!port->callback) {
+        // what does not fit stays in the socket until the firmware has read the buffer
+        maxCount = ringBufferFree(&port->rxBuffer);
+        if (!maxCount) {
+            return;
+        }
+    }
+
+    ssize_t received = recv(uart->clientFd, buffer, maxCount, 0);
+
+    if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        disconnectClient(uart);
+        return;
+    }
+
+    if (!port->callback) {
+        if (received > 0) {
+            ringBufferWrite(&port->rxBuffer, buffer, received);
+        }
+        return;
+    }
+
+    ssize_t i;
+    for (i = 0; i < received; i++) {
+        port->callback(buffer[i]);
+    }
+}
+
+static void transmit(sitlUart_t *uart)
+{
+    serialPort_t *port = &uart->uartPort.port;
+
+    uint16_t length;
+    const uint8_t *data;
+
+    while (true) {
+        data = ringBufferReadPointer(&port->txBuffer, &length);
+        if (!length) {
+            return;
+        }
+
+        ssize_t sent = send(uart->clientFd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                disconnectClient(uart);
+            }
+            return;
+        }
+        ringBufferConsume(&port->txBuffer, sent);
+    }
+}
+
+// the bytes are gone, like those of a UART nobody is listening to
+static void discardTransmitBuffer(serialPort_t *port)
+{
+    ringBufferConsume(&port->txBuffer, ringBufferCount(&port->txBuffer));
+}
+
+void sitlSerialPoll(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < SITL_UART_COUNT; i++) {
+        sitlUart_t *uart = &sitlUarts[i];
+        serialPort_t *port = &uart->uartPort.port;
+
+        if (!uart->isOpen || uart->listenFd < 0) {
+            // nobody can ever connect, behave like an unplugged UART
+            discardTransmitBuffer(port);
+            continue;
+        }
+
+        if (uart->clientFd < 0) {
+            acceptClient(uart);
+        }
+
+        if (uart->clientFd >= 0 && (port->mode & MODE_RX)) {
+            receive(uart);
+        }
+
+        if (uart->clientFd >= 0) {
+            transmit(uart);
+        } else {
+            discardTransmitBuffer(port);
+        }
+    }
+}
+
+void uartSetBaudRate(serialPort_t *instance, uint32_t baudRate)
+{
+    instance->baudRate = baudRate;
+}
+
+void uartSetMode(serialPort_t *instance, portMode_t mode)
+{
+    instance->mode = mode;
+}
+
+uint32_t uartTotalBytesWaiting(serialPort_t *instance)
+{
+    return ringBufferCount(&instance->rxBuffer);
+}
+
+bool isUartTransmitBufferEmpty(serialPort_t *instance)
+{
+    return ringBufferCount(&instance->txBuffer) == 0;
+}
+
+uint8_t uartRead(serialPort_t *instance)
+{
+    uint8_t ch = 0;
+
+    ringBufferGet(&instance->rxBuffer, &ch);
+    return ch;
+}
+
+// a full buffer drops the byte, like a UART whose transmitter can not keep up
+void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    ringBufferPut(&instance->txBuffer, ch);
+}
+
+const struct serialPortVTable uartVTable[] = {
+    {
+        uartWrite,
+        uartTotalBytesWaiting,
+        uartRead,
+        uartSetBaudRate,
+        isUartTransmitBufferEmpty,
+        uartSetMode,
+        NULL,
+        serialBufferWrite,
+        serialBufferRead,
+        serialBufferTxReserve,
+        serialBufferTxCommit,
+    }
+};
@@ -0,0 +1,134 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "platform.h"
+
+#include "drivers/system.h"
+#include "drivers/accgyro.h"
+#include "drivers/barometer.h"
+
+#include "sitl.h"
+
+GPIO_TypeDef sitlGpio[3];
+USART_TypeDef sitlUsart[2] = { { 0 }, { 1 } };
+
+// reported by the CLI status command, the loop has the budget of an F1 at 72MHz
+uint32_t SystemCoreClock = 72000000;
+
+uint8_t sitlFlash[FLASH_PAGE_COUNT * FLASH_PAGE_SIZE] __attribute__((aligned(4)));
+
+// Every clock read costs this much simulated time, so busy waits and an idle
+// scheduler make progress without a wall clock. Runs are fully deterministic.
+#define SITL_US_PER_CLOCK_READ 1
+
+static uint64_t simulatedTimeUs = 0;
+
+// Return the host monotonic clock in nanoseconds, so profiling reports what the
+// code costs on the host rather than the simulated time.
+uint32_t getCycleCounter(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+uint32_t getCycleCounterFrequencyMHz(void)
+{
+    return 1000;
+}
+
+uint32_t micros(void)
+{
+    simulatedTimeUs += SITL_US_PER_CLOCK_READ;
+    sitlAdvanceTo(simulatedTimeUs);
+    return (uint32_t)simulatedTimeUs;
+}
+
+uint32_t millis(void)
+{
+    micros();
+    return (uint32_t)(simulatedTimeUs / 1000);
+}
+
+void systemInit(void)
+{
+    sitlInit();
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    simulatedTimeUs += us;
+    sitlAdvanceTo(simulatedTimeUs);
+}
+
+void delay(uint32_t ms)
+{
+    while (ms--)
+        delayMicroseconds(1000);
+}
+
+void failureMode(uint8_t mode)
+{
+    fprintf(stderr, "SITL: failure mode %d at %.3fs\n", mode, simulatedTimeUs / 1e6);
+    exit(mode);
+}
+
+void systemReset(void)
+{
+    printf("SITL: reset requested, exiting\n");
+    exit(0);
+}
+
+void systemResetToBootloader(void)
+{
+    systemReset();
+}
+
+void FLASH_Unlock(void)
+{
+}
+
+void FLASH_Lock(void)
+{
+}
+
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress)
+{
+    uintptr_t offset = pageAddress - (uintptr_t)sitlFlash;
+    if (offset + FLASH_PAGE_SIZE > sizeof(sitlFlash)) {
+        return FLASH_ERROR_PG;
+    }
+    memset(&sitlFlash[offset], 0xFF, FLASH_PAGE_SIZE);
+    return FLASH_COMPLETE;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data)
+{
+    uintptr_t offset = address - (uintptr_t)sitlFlash;
+    if (offset + sizeof(data) > sizeof(sitlFlash)) {
+        return FLASH_ERROR_PG;
+    }
+    memcpy(&sitlFlash[offset], &data, sizeof(data));
+    return FLASH_COMPLETE;
+}
@@ -0,0 +1,47 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define TARGET_BOARD_IDENTIFIER "SITL" // Software In The Loop
+
+// emulated config storage, see sitl_system.c
+#define FLASH_PAGE_COUNT 4
+#define FLASH_PAGE_SIZE                 ((uint16_t)0x800)
+#define FLASH_TO_RESERVE_FOR_CONFIG 0x2000      // the config of the host build is larger, 4KB slots
+#define CONFIG_START_FLASH_ADDRESS ((uintptr_t)sitlFlash)
+
+#define GYRO
+#define USE_GYRO_SITL
+
+#define ACC
+#define USE_ACC_SITL
+
+#define BARO
+#define USE_BARO_SITL
+
+// serial ports are TCP sockets, UART1 on SITL_TCP_BASE_PORT + 1, UART2 on SITL_TCP_BASE_PORT + 2
+#define USE_USART1
+#define USE_USART2
+#define SERIAL_PORT_COUNT 2
+#define SITL_TCP_BASE_PORT 5760
+
+#define SENSORS_SET (SENSOR_ACC | SENSOR_BARO)
+
+#define BLACKBOX
+#define PROFILING
+#define FAST_MATH
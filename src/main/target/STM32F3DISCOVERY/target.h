@@ -59,5 +59,7 @@
 #define GPS
 #define LED_STRIP
 #define TELEMETRY
+#define BLACKBOX
 #define SERIAL_RX
 #define AUTOTUNE
+#define PROFILING
@@ -110,10 +110,30 @@ extern int16_t telemTemperature1; // FIXME dependency on mw.c
 
 static uint32_t lastCycleTime = 0;
 static uint8_t cycleNum = 0;
+
+// every value is sent as a data frame built in place in the transmit buffer, see sendDataHead()
+#define FRSKY_DATA_FRAME_MAX_SIZE (2 + 2 * 2)   // header, id and two bytes which may be stuffed
+
+static uint8_t *dataFrame;
+static uint8_t dataFrameLength;
+
+static void frskyWrite(uint8_t data)
+{
+    if (dataFrame) {
+        dataFrame[dataFrameLength++] = data;
+    } else {
+        serialWrite(frskyPort, data);
+    }
+}
+
 static void sendDataHead(uint8_t id)
 {
-    serialWrite(frskyPort, PROTOCOL_HEADER);
-    serialWrite(frskyPort, id);
+    // byte by byte when there is no room for the frame
+    dataFrame = serialTxReserve(frskyPort, FRSKY_DATA_FRAME_MAX_SIZE);
+    dataFrameLength = 0;
+
+    frskyWrite(PROTOCOL_HEADER);
+    frskyWrite(id);
 }
 
 static void sendTelemetryTail(void)
@@ -125,15 +145,16 @@ static void serializeFrsky(uint8_t data)
 {
     // take care of byte stuffing
     if (data == 0x5e) {
-        serialWrite(frskyPort, 0x5d);
-        serialWrite(frskyPort, 0x3e);
+        frskyWrite(0x5d);
+        frskyWrite(0x3e);
     } else if (data == 0x5d) {
-        serialWrite(frskyPort, 0x5d);
-        serialWrite(frskyPort, 0x3d);
+        frskyWrite(0x5d);
+        frskyWrite(0x3d);
     } else
-        serialWrite(frskyPort, data);
+        frskyWrite(data);
 }
 
+// the value of a data frame, ends the frame
 static void serialize16(int16_t a)
 {
     uint8_t t;
@@ -141,6 +162,11 @@ static void serialize16(int16_t a)
     serializeFrsky(t);
     t = a >> 8 & 0xff;
     serializeFrsky(t);
+
+    if (dataFrame) {
+        serialTxCommit(frskyPort, dataFrameLength);
+        dataFrame = NULL;
+    }
 }
 
 static void sendAccel(void)
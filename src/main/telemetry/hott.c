@@ -337,8 +337,10 @@ static void processBinaryModeRequest(uint8_t address) {
 
 static void flushHottRxBuffer(void)
 {
-    while (serialTotalBytesWaiting(hottPort) > 0) {
-        serialRead(hottPort);
+    uint8_t discarded[16];
+
+    while (serialReadBuf(hottPort, discarded, sizeof(discarded)) > 0) {
+        // the bytes are thrown away
     }
 }
 
@@ -371,11 +373,11 @@ static void hottCheckSerialData(uint32_t currentMicros) {
         lookingForRequest = true;
     }
 
-    uint8_t requestId = serialRead(hottPort);
-    uint8_t address = serialRead(hottPort);
+    uint8_t request[2];    // id and address
+    serialReadBuf(hottPort, request, sizeof(request));
 
-    if (requestId == HOTT_BINARY_MODE_REQUEST_ID) {
-        processBinaryModeRequest(address);
+    if (request[0] == HOTT_BINARY_MODE_REQUEST_ID) {
+        processBinaryModeRequest(request[1]);
     }
 }
 
@@ -37,6 +37,7 @@
 
 #include <stdbool.h>
 #include "drivers/system.h"
+#include "common/ring_buffer.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -45,10 +46,10 @@
 ErrorStatus HSEStartUpStatus;
 EXTI_InitTypeDef EXTI_InitStructure;
 __IO uint32_t packetSent;                                     // HJI
-extern __IO uint32_t receiveLength;                          // HJI
 
 uint8_t receiveBuffer[64];                                   // HJI
-uint32_t sendLength;                                          // HJI
+static ringBuffer_t *rxBuffer;                                // filled from the OUT endpoint
+static ringBuffer_t *txBuffer;                                // emptied into the IN endpoint
 static void IntToUnicode(uint32_t value, uint8_t *pbuf, uint8_t len);
 /* Extern variables ----------------------------------------------------------*/
 
@@ -264,66 +265,97 @@ static void IntToUnicode(uint32_t value, uint8_t *pbuf, uint8_t len)
 }
 
 /*******************************************************************************
- * Function Name  : Send DATA .
- * Description    : send the data received from the STM32 to the PC through USB  
+ * Function Name  : CDC_Set_Buffers.
+ * Description    : sets the ring buffers the endpoints are copied from and to,
+ *                  must be called before USB_Init()
  * Input          : None.
  * Output         : None.
  * Return         : None.
  *******************************************************************************/
-uint32_t CDC_Send_DATA(uint8_t *ptrBuffer, uint8_t sendLength)
+void CDC_Set_Buffers(ringBuffer_t *rx, ringBuffer_t *tx)
 {
-    /* Last transmission hasn't finished, abort */
-    if (packetSent) {
-        return 0;
-    }
+    rxBuffer = rx;
+    txBuffer = tx;
+}
+
+/*******************************************************************************
+ * Function Name  : CDC_Send_Next.
+ * Description    : send the next bytes of the transmit buffer to the PC through USB,
+ *                  called while no packet is being sent only
+ * Input          : None.
+ * Output         : None.
+ * Return         : None.
+ *******************************************************************************/
+void CDC_Send_Next(void)
+{
+    uint16_t sendLength;
+    const uint8_t *data = ringBufferReadPointer(txBuffer, &sendLength);
 
     // We can only put 64 bytes in the buffer
     if (sendLength > 64 / 2) {
         sendLength = 64 / 2;
     }
 
-    // Try to load some bytes if we can
-    if (sendLength) {
-        UserToPMABufferCopy(ptrBuffer, ENDP1_TXADDR, sendLength);
-        SetEPTxCount(ENDP1, sendLength);
-        packetSent += sendLength;
-        SetEPTxValid(ENDP1);
+    if (!sendLength) {
+        return;
     }
 
-    return sendLength;
+    // the bytes stay in the transmit buffer until the packet has been sent, see CDC_Send_Complete()
+    UserToPMABufferCopy((uint8_t *)data, ENDP1_TXADDR, sendLength);
+    SetEPTxCount(ENDP1, sendLength);
+    packetSent = sendLength;
+    SetEPTxValid(ENDP1);
 }
 
 /*******************************************************************************
- * Function Name  : Receive DATA .
- * Description    : receive the data from the PC to STM32 and send it through USB
+ * Function Name  : CDC_Send_Complete.
+ * Description    : called from the IN endpoint interrupt when the packet was sent
  * Input          : None.
  * Output         : None.
  * Return         : None.
  *******************************************************************************/
-uint32_t CDC_Receive_DATA(uint8_t* recvBuf, uint32_t len)
+void CDC_Send_Complete(void)
 {
-    static uint8_t offset = 0;
-    uint8_t i;
+    ringBufferConsume(txBuffer, packetSent);
+    packetSent = 0;
 
-    if (len > receiveLength) {
-        len = receiveLength;
-    }
+    CDC_Send_Next();
+}
 
-    for (i = 0; i < len; i++) {
-        recvBuf[i] = (uint8_t)(receiveBuffer[i + offset]);
-    }
+/*******************************************************************************
+ * Function Name  : CDC_Receive_Packet.
+ * Description    : called from the OUT endpoint interrupt, copies the packet
+ *                  received from the PC into the receive buffer
+ * Input          : None.
+ * Output         : None.
+ * Return         : None.
+ *******************************************************************************/
+void CDC_Receive_Packet(void)
+{
+    uint16_t receiveLength = GetEPRxCount(ENDP3);
+
+    PMAToUserBufferCopy(receiveBuffer, ENDP3_RXADDR, receiveLength);
+    ringBufferWrite(rxBuffer, receiveBuffer, receiveLength);
 
-    receiveLength -= len;
-    offset += len;
+    CDC_Receive_Next();
+}
 
-    /* re-enable the rx endpoint which we had set to receive 0 bytes */
-    if (receiveLength == 0) {
-        SetEPRxCount(ENDP3, 64);
-        SetEPRxStatus(ENDP3, EP_RX_VALID);
-        offset = 0;
+/*******************************************************************************
+ * Function Name  : CDC_Receive_Next.
+ * Description    : re-enables the rx endpoint, which NAKs after every packet,
+ *                  once the receive buffer has room for another packet
+ * Input          : None.
+ * Output         : None.
+ * Return         : None.
+ *******************************************************************************/
+void CDC_Receive_Next(void)
+{
+    if (GetEPRxStatus(ENDP3) != EP_RX_NAK || ringBufferFree(rxBuffer) < VIRTUAL_COM_PORT_DATA_SIZE) {
+        return;
     }
 
-    return len;
+    SetEPRxCount(ENDP3, VIRTUAL_COM_PORT_DATA_SIZE);
+    SetEPRxStatus(ENDP3, EP_RX_VALID);
 }
 
 /*******************************************************************************
@@ -35,6 +35,7 @@
 #include "stm32f30x.h"
 
 /* Exported types ------------------------------------------------------------*/
+struct ringBuffer_s;
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 /* Exported define -----------------------------------------------------------*/
@@ -49,13 +50,15 @@ void Leave_LowPowerMode(void);
 void USB_Interrupts_Config(void);
 void USB_Cable_Config(FunctionalState NewState);
 void Get_SerialNum(void);
-uint32_t CDC_Send_DATA(uint8_t *ptrBuffer, uint8_t sendLength);  // HJI
-uint32_t CDC_Receive_DATA(uint8_t* recvBuf, uint32_t len);       // HJI
+void CDC_Set_Buffers(struct ringBuffer_s *rxBuffer, struct ringBuffer_s *txBuffer);
+void CDC_Send_Next(void);
+void CDC_Send_Complete(void);
+void CDC_Receive_Packet(void);
+void CDC_Receive_Next(void);
 uint8_t usbIsConfigured(void);  // HJI
 uint8_t usbIsConnected(void);   // HJI
 /* External variables --------------------------------------------------------*/
 
-extern __IO uint32_t receiveLength;  // HJI
 extern __IO uint32_t packetSent;     // HJI
 
 #endif  /*__HW_CONFIG_H*/
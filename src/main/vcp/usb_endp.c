@@ -40,9 +40,6 @@
 #define VCOMPORT_IN_FRAME_INTERVAL             5
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-extern __IO uint32_t packetSent;         // HJI
-extern __IO uint8_t receiveBuffer[64];  // HJI
-__IO uint32_t receiveLength;             // HJI
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -56,7 +53,7 @@ __IO uint32_t receiveLength;             // HJI
 
 void EP1_IN_Callback(void)
 {
-    packetSent = 0;  // HJI
+    CDC_Send_Complete();
 }
 
 /*******************************************************************************
@@ -68,8 +65,7 @@ void EP1_IN_Callback(void)
  *******************************************************************************/
 void EP3_OUT_Callback(void)
 {
-    receiveLength = GetEPRxCount(ENDP3);                                              // HJI
-    PMAToUserBufferCopy((unsigned char*)receiveBuffer, ENDP3_RXADDR, receiveLength);  // HJI
+    CDC_Receive_Packet();
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
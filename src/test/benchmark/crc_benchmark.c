@@ -0,0 +1,132 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+ * Host benchmark of the checks of the stored config.
+ *
+ * The XOR checksum that validated the whole config before, the CRC-8 of the MSP frames and the CRC-32 of the config
+ * records are computed over a buffer the size of the config, the CRC-32 with the table of crc32Stm32() and bit at a
+ * time, and the throughput is printed in bytes/us. Targets with a CRC unit do not run crc32Stm32(), the unit takes a
+ * word every four cycles of the AHB clock.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common/crc.h"
+
+#define BENCHMARK_WARMUP_ITERATIONS 100
+#define BENCHMARK_ITERATIONS 20000
+
+#define CRC32_POLYNOMIAL 0x04C11DB7
+
+#define CONFIG_SIZE 2048
+
+static uint32_t config[CONFIG_SIZE / sizeof(uint32_t)];
+
+static volatile uint32_t sink;
+
+static uint64_t nanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// calculateChecksum() of config.c before the config was stored as records
+static void stepXorChecksum(void)
+{
+    const uint8_t *data = (const uint8_t *)config;
+    uint8_t checksum = 0;
+    uint32_t index;
+
+    for (index = 0; index < CONFIG_SIZE; index++) {
+        checksum ^= data[index];
+    }
+    sink = checksum;
+}
+
+static void stepCrc8(void)
+{
+    sink = crc8DvbS2Buffer(0, (const uint8_t *)config, CONFIG_SIZE);
+}
+
+static void stepCrc32Table(void)
+{
+    sink = crc32Stm32(CRC32_STM32_INIT, config, CONFIG_SIZE / sizeof(uint32_t));
+}
+
+static void stepCrc32Bitwise(void)
+{
+    uint32_t crc = CRC32_STM32_INIT;
+    uint32_t index;
+    int bit;
+
+    for (index = 0; index < CONFIG_SIZE / sizeof(uint32_t); index++) {
+        crc ^= config[index];
+        for (bit = 0; bit < 32; bit++) {
+            crc = crc & 0x80000000 ? (crc << 1) ^ CRC32_POLYNOMIAL : crc << 1;
+        }
+    }
+    sink = crc;
+}
+
+static void runBenchmark(const char *name, void (*step)(void))
+{
+    uint32_t iteration;
+    uint64_t startedAt;
+    uint64_t elapsed;
+
+    for (iteration = 0; iteration < BENCHMARK_WARMUP_ITERATIONS; iteration++) {
+        step();
+    }
+
+    startedAt = nanoseconds();
+
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        step();
+    }
+
+    elapsed = nanoseconds() - startedAt;
+
+    printf("%-32s %8.1f bytes/us %8.2f us/config\n",
+        name,
+        (double)CONFIG_SIZE * BENCHMARK_ITERATIONS * 1000 / elapsed,
+        (double)elapsed / BENCHMARK_ITERATIONS / 1000
+    );
+}
+
+int main(void)
+{
+    uint32_t index;
+
+    for (index = 0; index < CONFIG_SIZE / sizeof(uint32_t); index++) {
+        config[index] = index * 2654435761u;
+    }
+
+    printf("%u iterations, %u byte config\n", BENCHMARK_ITERATIONS, CONFIG_SIZE);
+
+    runBenchmark("XOR checksum", stepXorChecksum);
+    runBenchmark("CRC-8 DVB-S2", stepCrc8);
+    runBenchmark("CRC-32 crc32Stm32", stepCrc32Table);
+    runBenchmark("CRC-32 bit at a time", stepCrc32Bitwise);
+
+    return EXIT_SUCCESS;
+}
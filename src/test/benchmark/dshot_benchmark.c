@@ -0,0 +1,126 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*
+ * Host benchmark of the motor output encoding done in writeMotors().
+ *
+ * The oneshot125 pulse is one multiplication per motor, a DShot frame is the throttle, the checksum and 18 compare
+ * values written interleaved into the DMA buffer of the timer.  The motor values are taken from a table sweeping the
+ * throttle range and the cost is printed per motor.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "drivers/pwm_oneshot.h"
+#include "drivers/pwm_dshot.h"
+
+#define BENCHMARK_WARMUP_ITERATIONS 1000
+#define BENCHMARK_ITERATIONS 200000
+
+#define MOTOR_COUNT 8
+#define TIMER_CHANNELS 4
+
+#define TIMER_CLOCK_HZ 72000000
+
+#define SWEEP_LENGTH 256
+
+static uint16_t motorSweep[SWEEP_LENGTH][MOTOR_COUNT];
+static uint16_t slots[MOTOR_COUNT / TIMER_CHANNELS][DSHOT_FRAME_SLOTS * TIMER_CHANNELS];
+static dshotBitTiming_t timing;
+static uint8_t oneshotMhz;
+
+static volatile uint16_t sink;
+
+static uint64_t nanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void stepOneshot(uint32_t iteration)
+{
+    const uint16_t *motor = motorSweep[iteration % SWEEP_LENGTH];
+    uint8_t index;
+
+    for (index = 0; index < MOTOR_COUNT; index++) {
+        sink = oneshot125PulseTicks(motor[index], oneshotMhz);
+    }
+}
+
+static void stepDshot(uint32_t iteration)
+{
+    const uint16_t *motor = motorSweep[iteration % SWEEP_LENGTH];
+    uint8_t index;
+
+    for (index = 0; index < MOTOR_COUNT; index++) {
+        uint16_t packet = dshotPacket(dshotThrottleFromPulse(motor[index]), false);
+        dshotEncodePacket(&slots[index / TIMER_CHANNELS][index % TIMER_CHANNELS], TIMER_CHANNELS, packet, &timing);
+    }
+    sink = slots[0][0];
+}
+
+static void runBenchmark(const char *name, void (*step)(uint32_t iteration))
+{
+    uint32_t iteration;
+    uint64_t startedAt;
+    uint64_t elapsed;
+
+    for (iteration = 0; iteration < BENCHMARK_WARMUP_ITERATIONS; iteration++) {
+        step(iteration);
+    }
+
+    startedAt = nanoseconds();
+
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        step(iteration);
+    }
+
+    elapsed = nanoseconds() - startedAt;
+
+    printf("%-32s %8.1f ns/motor %8.1f ns/loop\n",
+        name,
+        (double)elapsed / BENCHMARK_ITERATIONS / MOTOR_COUNT,
+        (double)elapsed / BENCHMARK_ITERATIONS
+    );
+}
+
+int main(void)
+{
+    uint32_t iteration;
+    uint8_t index;
+
+    for (iteration = 0; iteration < SWEEP_LENGTH; iteration++) {
+        for (index = 0; index < MOTOR_COUNT; index++) {
+            motorSweep[iteration][index] = 1000 + (iteration * 7 + index * 131) % 1001;
+        }
+    }
+
+    oneshotMhz = oneshot125TimerMhz(TIMER_CLOCK_HZ);
+    dshotBitTimingInit(&timing, TIMER_CLOCK_HZ, DSHOT_DEFAULT_RATE);
+
+    printf("%u iterations, %u motors\n", BENCHMARK_ITERATIONS, MOTOR_COUNT);
+
+    runBenchmark("oneshot125 pulse", stepOneshot);
+    runBenchmark("DShot frame", stepDshot);
+
+    return EXIT_SUCCESS;
+}
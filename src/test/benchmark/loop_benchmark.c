@@ -0,0 +1,449 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host benchmark of the flight loop stages.
+ *
+ * The firmware sources are compiled for the SITL target and fed with a recorded flight, every stage is run on its
+ * own with the inputs it saw in the real loop so the numbers can be compared between commits. Only the cost on the
+ * host is measured, use it to spot regressions and to compare implementations, not to predict the time on the MCU.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "platform.h"
+
+#include "build_config.h"
+
+#include "common/color.h"
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/boot_timing.h"
+#include "common/profiling.h"
+#include "flight/flight.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/gpio.h"
+#include "drivers/timer.h"
+#include "drivers/pwm_rx.h"
+#include "drivers/pwm_mapping.h"
+
+#include "sensors/sensors.h"
+#include "sensors/gyro.h"
+
+#include "io/statusindicator.h"
+#include "sensors/acceleration.h"
+#include "sensors/barometer.h"
+#include "drivers/serial.h"
+#include "io/serial.h"
+#include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
+
+#include "flight/mixer.h"
+#include "sensors/boardalignment.h"
+#include "sensors/battery.h"
+#include "io/gimbal.h"
+#include "io/escservo.h"
+#include "rx/rx.h"
+#include "io/rc_controls.h"
+#include "io/rc_curves.h"
+#include "io/ledstrip.h"
+#include "io/gps.h"
+#include "flight/failsafe.h"
+#include "flight/altitudehold.h"
+#include "flight/imu.h"
+#include "flight/navigation.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "recorded_flight.h"
+
+#define BENCHMARK_WARMUP_ITERATIONS 1000
+#define BENCHMARK_ITERATIONS 200000
+
+#define RECORDED_SAMPLE_COUNT (sizeof(recordedFlight) / sizeof(recordedFlight[0]))
+
+void annexCode(void);
+void mixerInit(MultiType mixerConfiguration, motorMixer_t *initialCustomMixers);
+void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfiguration);
+void imuInit(void);
+void activateConfig(void);
+
+typedef void (*pidControllerFuncPtr)(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
+        uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim);
+
+extern pidControllerFuncPtr pid_controller;
+extern uint32_t targetPidLooptime;
+extern uint16_t cycleTime;
+
+// loop state recorded by running the complete loop over the flight, used as the input of the individual stages
+typedef struct loopState_s {
+    int16_t gyroData[FLIGHT_DYNAMICS_INDEX_COUNT];
+    int16_t rcCommand[4];
+    rollAndPitchInclination_t inclination;
+    int16_t axisPID[XYZ_AXIS_COUNT];
+} loopState_t;
+
+static loopState_t loopStates[RECORDED_SAMPLE_COUNT];
+
+static const recordedSample_t *currentSample = &recordedFlight[0];
+static const loopState_t *currentLoopState = &loopStates[0];
+static uint32_t simulatedTime = 0;
+
+static uint32_t allocationCount = 0;
+
+static const char * const mixerNames[] = {
+    "TRI", "QUADP", "QUADX", "BI", "GIMBAL", "Y6", "HEX6", "FLYING_WING", "Y4", "HEX6X", "OCTOX8", "OCTOFLATP",
+    "OCTOFLATX", "AIRPLANE", "HELI_120_CCPM", "HELI_90_DEG", "VTAIL4", "HEX6H", "PPM_TO_SERVO", "DUALCOPTER",
+    "SINGLECOPTER", "CUSTOM"
+};
+
+static const char * const pidControllerNames[] = { "MultiWii", "Rewrite", "Baseflight" };
+
+// allocation counting, the firmware must never allocate so anything other than 0 is a bug
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocationCount++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocationCount++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    allocationCount++;
+    return __real_realloc(ptr, size);
+}
+
+static uint64_t nanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// advances the loop to the next recorded sample, the rc data is always replayed as annexCode() reads it
+static void replaySample(uint32_t iteration)
+{
+    uint32_t index = iteration % RECORDED_SAMPLE_COUNT;
+    int axis;
+
+    currentSample = &recordedFlight[index];
+    currentLoopState = &loopStates[index];
+
+    for (axis = 0; axis < 4; axis++) {
+        rcData[axis] = currentSample->rc[axis];
+    }
+
+    simulatedTime += targetPidLooptime;
+}
+
+static void restoreLoopState(void)
+{
+    memcpy(gyroData, currentLoopState->gyroData, sizeof(gyroData));
+    memcpy(rcCommand, currentLoopState->rcCommand, sizeof(currentLoopState->rcCommand));
+    inclination = currentLoopState->inclination;
+    memcpy(axisPID, currentLoopState->axisPID, sizeof(axisPID));
+}
+
+static void runPidController(void)
+{
+    pid_controller(
+        &currentProfile->pidProfile,
+        &currentProfile->controlRateConfig,
+        masterConfig.max_angle_inclination,
+        &currentProfile->accelerometerTrims
+    );
+}
+
+static void recordLoopStates(void)
+{
+    uint32_t index;
+
+    for (index = 0; index < RECORDED_SAMPLE_COUNT; index++) {
+        replaySample(index);
+
+        computeIMU(&currentProfile->accelerometerTrims, masterConfig.mixerConfiguration);
+        annexCode();
+        runPidController();
+
+        memcpy(loopStates[index].gyroData, gyroData, sizeof(gyroData));
+        memcpy(loopStates[index].rcCommand, rcCommand, sizeof(loopStates[index].rcCommand));
+        loopStates[index].inclination = inclination;
+        memcpy(loopStates[index].axisPID, axisPID, sizeof(axisPID));
+    }
+}
+
+static void stepReplay(void)
+{
+}
+
+static void stepComputeImu(void)
+{
+    computeIMU(&currentProfile->accelerometerTrims, masterConfig.mixerConfiguration);
+}
+
+static void stepAnnexCode(void)
+{
+    annexCode();
+}
+
+static void stepPidController(void)
+{
+    restoreLoopState();
+    runPidController();
+}
+
+static void stepMixTable(void)
+{
+    restoreLoopState();
+    mixTable();
+}
+
+static void runBenchmark(const char *name, void (*step)(void))
+{
+    uint32_t iteration;
+    uint32_t allocationsBefore;
+    uint64_t startedAt;
+    uint64_t elapsed;
+
+    for (iteration = 0; iteration < BENCHMARK_WARMUP_ITERATIONS; iteration++) {
+        replaySample(iteration);
+        step();
+    }
+
+    allocationsBefore = allocationCount;
+    startedAt = nanoseconds();
+
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        replaySample(iteration);
+        step();
+    }
+
+    elapsed = nanoseconds() - startedAt;
+
+    printf("%-32s %10.1f ns/iteration %6u allocations\n",
+        name,
+        (double)elapsed / BENCHMARK_ITERATIONS,
+        allocationCount - allocationsBefore
+    );
+}
+
+static void benchmarkComputeImu(void)
+{
+    static const char * const estimatorNames[] = { "complementary", "quaternion" };
+    char name[64];
+    uint8_t estimator;
+
+    for (estimator = 0; estimator < ATTITUDE_ESTIMATOR_COUNT; estimator++) {
+        masterConfig.attitude_estimator = estimator;
+        activateConfig();
+        imuInit();
+
+        snprintf(name, sizeof(name), "computeIMU %s", estimatorNames[estimator]);
+        runBenchmark(name, stepComputeImu);
+    }
+
+    masterConfig.attitude_estimator = ATTITUDE_ESTIMATOR_COMPLEMENTARY;
+    activateConfig();
+    imuInit();
+}
+
+static void benchmarkPidControllers(void)
+{
+    static const char * const modeNames[] = { "ACRO", "ANGLE", "HORIZON" };
+    static const uint16_t modes[] = { 0, ANGLE_MODE, HORIZON_MODE };
+    char name[64];
+    int type;
+    int mode;
+
+    for (type = 0; type < (int)(sizeof(pidControllerNames) / sizeof(pidControllerNames[0])); type++) {
+        setPIDController(type);
+
+        for (mode = 0; mode < (int)(sizeof(modes) / sizeof(modes[0])); mode++) {
+            flightModeFlags = modes[mode];
+
+            snprintf(name, sizeof(name), "pid %s %s", pidControllerNames[type], modeNames[mode]);
+            runBenchmark(name, stepPidController);
+        }
+    }
+
+    flightModeFlags = 0;
+    setPIDController(currentProfile->pidController);
+}
+
+static void benchmarkMixers(void)
+{
+    pwmOutputConfiguration_t pwmOutputConfiguration = { .servoCount = 8, .motorCount = MAX_SUPPORTED_MOTORS };
+    char name[64];
+    MultiType mixerConfiguration;
+
+    mixerLoadMix(MULTITYPE_QUADX - 1, masterConfig.customMixer);
+    mixerInit(MULTITYPE_CUSTOM, masterConfig.customMixer);
+    mixerUsePWMOutputConfiguration(&pwmOutputConfiguration);
+    runBenchmark("mixTable CUSTOM", stepMixTable);
+
+    for (mixerConfiguration = MULTITYPE_TRI; mixerConfiguration < MULTITYPE_CUSTOM; mixerConfiguration++) {
+        mixerInit(mixerConfiguration, masterConfig.customMixer);
+        mixerUsePWMOutputConfiguration(&pwmOutputConfiguration);
+
+        snprintf(name, sizeof(name), "mixTable %s", mixerNames[mixerConfiguration - 1]);
+        runBenchmark(name, stepMixTable);
+    }
+}
+
+int main(void)
+{
+    initEEPROM();
+    resetEEPROM();
+
+    targetPidLooptime = masterConfig.looptime * masterConfig.pid_process_denom;
+    cycleTime = targetPidLooptime;
+
+    readEEPROM();
+    imuInit();
+    mixerInit(masterConfig.mixerConfiguration, masterConfig.customMixer);
+
+    sensorsSet(SENSOR_ACC);
+    ENABLE_ARMING_FLAG(ARMED);
+
+    recordLoopStates();
+
+    printf("%u recorded samples, %u iterations per stage, %u us loop\n",
+        (unsigned)RECORDED_SAMPLE_COUNT, BENCHMARK_ITERATIONS, targetPidLooptime);
+
+    runBenchmark("trace replay", stepReplay);
+    benchmarkComputeImu();
+    runBenchmark("annexCode", stepAnnexCode);
+    benchmarkPidControllers();
+    benchmarkMixers();
+
+    return allocationCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// STUBS
+
+gyro_t gyro = { .scale = 1.0f / 16.4f };
+uint16_t acc_1G = 512 * 8;
+int16_t magADC[XYZ_AXIS_COUNT];
+failsafe_t *failsafe;
+uint8_t sitlFlash[FLASH_PAGE_COUNT * FLASH_PAGE_SIZE] __attribute__((aligned(4)));
+
+uint32_t micros(void) { return simulatedTime; }
+void failureMode(uint8_t mode) { fprintf(stderr, "failure mode %u\n", mode); exit(EXIT_FAILURE); }
+
+void FLASH_Unlock(void) {}
+void FLASH_Lock(void) {}
+
+FLASH_Status FLASH_ErasePage(uintptr_t address)
+{
+    memset((void *)address, 0xFF, FLASH_PAGE_SIZE);
+    return FLASH_COMPLETE;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data)
+{
+    memcpy((void *)address, &data, sizeof(data));
+    return FLASH_COMPLETE;
+}
+
+void gyroGetADC(void)
+{
+    int axis;
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroADC[axis] = currentSample->gyro[axis];
+    }
+}
+
+void updateAccelerationReadings(rollAndPitchTrims_t *rollAndPitchTrims)
+{
+    int axis;
+
+    UNUSED(rollAndPitchTrims);
+
+    for (axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        accADC[axis] = currentSample->acc[axis];
+    }
+}
+
+void gyroAccumulateSample(void) {}
+bool isGyroCalibrationComplete(void) { return true; }
+void gyroSetCalibrationCycles(uint16_t calibrationCyclesRequired) { UNUSED(calibrationCyclesRequired); }
+void useGyroConfig(gyroConfig_t *gyroConfigToUse) { UNUSED(gyroConfigToUse); }
+bool gyroSyncIsEnabled(void) { return false; }
+bool gyroSyncCheckUpdate(uint32_t currentTime) { UNUSED(currentTime); return true; }
+bool isAccelerationCalibrationComplete(void) { return true; }
+void accSetCalibrationCycles(uint16_t calibrationCyclesRequired) { UNUSED(calibrationCyclesRequired); }
+void setAccelerationTrims(flightDynamicsTrims_t *accelerationTrimsToUse) { UNUSED(accelerationTrimsToUse); }
+bool isBaroCalibrationComplete(void) { return true; }
+bool isBaroReady(void) { return false; }
+void baroUpdate(uint32_t currentTime) { UNUSED(currentTime); }
+void useBarometerConfig(barometerConfig_t *barometerConfigToUse) { UNUSED(barometerConfigToUse); }
+void calculateEstimatedAltitude(uint32_t currentTime) { UNUSED(currentTime); }
+void configureAltitudeHold(pidProfile_t *initialPidProfile, barometerConfig_t *intialBarometerConfig) { UNUSED(initialPidProfile); UNUSED(intialBarometerConfig); }
+void applyAltHold(void) {}
+void updateAltHoldState(void) {}
+void updateBatteryVoltage(void) {}
+bool shouldSoundBatteryAlarm(void) { return false; }
+void updateCurrentMeter(int32_t lastUpdateAt) { UNUSED(lastUpdateAt); }
+void beepcodeUpdateState(bool warn_vbat) { UNUSED(warn_vbat); }
+void queueConfirmationBeep(uint8_t duration) { UNUSED(duration); }
+void blinkLedAndSoundBeeper(uint8_t num, uint8_t wait, uint8_t repeat) { UNUSED(num); UNUSED(wait); UNUSED(repeat); }
+void enableWarningLed(uint32_t currentTime) { UNUSED(currentTime); }
+void disableWarningLed(void) {}
+void updateWarningLed(uint32_t currentTime) { UNUSED(currentTime); }
+void profileStageBegin(profileStage_e stage) { UNUSED(stage); }
+void profileStageEnd(profileStage_e stage) { UNUSED(stage); }
+void bootStageEnd(bootStage_e stage) { UNUSED(stage); }
+bool isBootComplete(void) { return true; }
+void pwmWriteMotor(uint8_t index, uint16_t value) { UNUSED(index); UNUSED(value); }
+void pwmCompleteMotorUpdate(uint8_t motorCount) { UNUSED(motorCount); }
+void pwmWriteServo(uint8_t index, uint16_t value) { UNUSED(index); UNUSED(value); }
+void useFailsafeConfig(failsafeConfig_t *failsafeConfigToUse) { UNUSED(failsafeConfigToUse); }
+void useRxConfig(rxConfig_t *rxConfigToUse) { UNUSED(rxConfigToUse); }
+void parseRcChannels(const char *input, rxConfig_t *rxConfig) { UNUSED(input); UNUSED(rxConfig); }
+void updateRx(void) {}
+bool shouldProcessRx(uint32_t currentTime) { UNUSED(currentTime); return false; }
+void calculateRxChannelsAndUpdateFailsafe(uint32_t currentTime) { UNUSED(currentTime); }
+void updateRSSI(uint32_t currentTime) { UNUSED(currentTime); }
+void handleSerial(void) {}
+void blackboxLogIteration(uint32_t currentTime) { UNUSED(currentTime); }
+void handleBlackbox(void) {}
+bool isSerialConfigValid(serialConfig_t *serialConfig) { UNUSED(serialConfig); return true; }
+void applySerialConfigToPortFunctions(serialConfig_t *serialConfig) { UNUSED(serialConfig); }
+uint8_t lookupScenarioIndex(serialPortFunctionScenario_e scenario) { UNUSED(scenario); return 0; }
+
+rxRuntimeConfig_t rxRuntimeConfig;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
@@ -0,0 +1,330 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// Recorded from the SITL target (MPU6050 scaling, acc_1G 4096) while hovering and stepping the roll stick,
+// one sample per PID loop. Axes are in the firmware sensor frame, rc is in roll, pitch, yaw, throttle order.
+
+typedef struct recordedSample_s {
+    int16_t gyro[3];
+    int16_t acc[3];
+    int16_t rc[4];
+} recordedSample_t;
+
+static const recordedSample_t recordedFlight[] = {
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3963 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1600, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3964 }, { 1600, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 2, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 6, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 14, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 22, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 31, 0, 0 }, { 0, 0, 3965 }, { 1600, 1500, 1500, 1620 } },
+    { { 40, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 52, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 64, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 75, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 86, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 95, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 105, 0, 0 }, { 0, 0, 3966 }, { 1600, 1500, 1500, 1620 } },
+    { { 117, 0, 0 }, { 0, 0, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 129, 0, 0 }, { 0, 0, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 141, 0, 0 }, { 0, 0, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 151, 0, 0 }, { 0, 0, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 160, 0, 0 }, { 0, 0, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 170, 0, 0 }, { 0, -1, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 181, 0, 0 }, { 0, -1, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 194, 0, 0 }, { 0, -1, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 206, 0, 0 }, { 0, -1, 3967 }, { 1600, 1500, 1500, 1620 } },
+    { { 218, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 229, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 239, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 247, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 254, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 260, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 269, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 271, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 273, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 275, 0, 0 }, { 0, -1, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 277, 0, 0 }, { 0, -2, 3968 }, { 1600, 1500, 1500, 1620 } },
+    { { 278, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 279, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 280, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 280, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 280, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 280, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 279, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 278, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 277, 0, 0 }, { 0, -2, 3969 }, { 1600, 1500, 1500, 1620 } },
+    { { 277, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 276, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 276, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 275, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 275, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 274, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 273, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 271, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 270, 0, 0 }, { 0, -2, 3970 }, { 1600, 1500, 1500, 1620 } },
+    { { 269, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 268, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 267, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -2, 3971 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 263, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 263, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 264, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, -1, 3972 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, -1, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, -1, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, -1, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3973 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3974 }, { 1600, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 0, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 1, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 266, 0, 0 }, { 0, 1, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 265, 0, 0 }, { 0, 1, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 262, 0, 0 }, { 0, 1, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 252, 0, 0 }, { 0, 1, 3974 }, { 1400, 1500, 1500, 1620 } },
+    { { 238, 0, 0 }, { 0, 1, 3975 }, { 1400, 1500, 1500, 1620 } },
+    { { 221, 0, 0 }, { 0, 1, 3975 }, { 1400, 1500, 1500, 1620 } },
+    { { 204, 0, 0 }, { 0, 2, 3975 }, { 1400, 1500, 1500, 1620 } },
+    { { 189, 0, 0 }, { 0, 2, 3975 }, { 1400, 1500, 1500, 1620 } },
+    { { 172, 0, 0 }, { 0, 2, 3975 }, { 1400, 1500, 1500, 1620 } },
+    { { 152, 0, 0 }, { 0, 2, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 130, 0, 0 }, { 0, 2, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 109, 0, 0 }, { 0, 3, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 89, 0, 0 }, { 0, 3, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 72, 0, 0 }, { 0, 3, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 54, 0, 0 }, { 0, 3, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 33, 0, 0 }, { 0, 4, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { 11, 0, 0 }, { 0, 4, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { -11, 0, 0 }, { 0, 4, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -32, 0, 0 }, { 0, 5, 3976 }, { 1400, 1500, 1500, 1620 } },
+    { { -54, 0, 0 }, { 0, 5, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -80, 0, 0 }, { 0, 5, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -107, 0, 0 }, { 0, 5, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -135, 0, 0 }, { 0, 6, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -160, 0, 0 }, { 0, 6, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -182, 0, 0 }, { 0, 6, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -201, 0, 0 }, { 0, 7, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -217, 0, 0 }, { 0, 7, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -230, 0, 0 }, { 0, 8, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -240, 0, 0 }, { 0, 8, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -247, 0, 0 }, { 0, 8, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -253, 0, 0 }, { 0, 9, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -259, 0, 0 }, { 0, 9, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -263, 0, 0 }, { 0, 9, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -267, 0, 0 }, { 0, 10, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -270, 0, 0 }, { 0, 10, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 10, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 11, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -276, 0, 0 }, { 0, 11, 3977 }, { 1400, 1500, 1500, 1620 } },
+    { { -277, 0, 0 }, { 0, 11, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -278, 0, 0 }, { 0, 12, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -279, 0, 0 }, { 0, 12, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -280, 0, 0 }, { 0, 12, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -280, 0, 0 }, { 0, 13, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -280, 0, 0 }, { 0, 13, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -280, 0, 0 }, { 0, 13, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -279, 0, 0 }, { 0, 14, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -278, 0, 0 }, { 0, 14, 3978 }, { 1400, 1500, 1500, 1620 } },
+    { { -277, 0, 0 }, { 0, 14, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -277, 0, 0 }, { 0, 14, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -276, 0, 0 }, { 0, 15, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -276, 0, 0 }, { 0, 15, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -275, 0, 0 }, { 0, 15, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -275, 0, 0 }, { 0, 16, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 16, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 16, 3979 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 16, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 17, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -274, 0, 0 }, { 0, 17, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 17, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 17, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 18, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 18, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 18, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 18, 3980 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 19, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 19, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 19, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 19, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 19, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 20, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 20, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 20, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 20, 3981 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 20, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -271, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 21, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -272, 0, 0 }, { 0, 22, 3982 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 22, 3983 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 22, 3983 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 22, 3983 }, { 1400, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 22, 3983 }, { 1500, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 22, 3983 }, { 1500, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 23, 3983 }, { 1500, 1500, 1500, 1620 } },
+    { { -273, 0, 0 }, { 0, 23, 3983 }, { 1500, 1500, 1500, 1620 } },
+    { { -270, 0, 0 }, { 0, 23, 3983 }, { 1500, 1500, 1500, 1620 } },
+    { { -265, 0, 0 }, { 0, 23, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -258, 0, 0 }, { 0, 23, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -248, 0, 0 }, { 0, 23, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -238, 0, 0 }, { 0, 23, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -228, 0, 0 }, { 0, 23, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -217, 0, 0 }, { 0, 24, 3984 }, { 1500, 1500, 1500, 1620 } },
+    { { -205, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -193, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -182, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -171, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -161, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -148, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -136, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -123, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -112, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -102, 0, 0 }, { 0, 24, 3985 }, { 1500, 1500, 1500, 1620 } },
+    { { -92, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -81, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -69, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -57, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -46, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -37, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -29, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -23, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -18, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -14, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -12, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -9, 0, 0 }, { 0, 24, 3986 }, { 1500, 1500, 1500, 1620 } },
+    { { -7, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { -5, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { -4, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { -2, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { -1, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 0, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 1, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 1, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 2, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 3, 0, 0 }, { 0, 24, 3987 }, { 1500, 1500, 1500, 1620 } },
+    { { 3, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 3, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 4, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 24, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3988 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3989 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3990 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3991 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 23, 3992 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3993 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3994 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3994 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3994 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3994 }, { 1500, 1500, 1500, 1620 } },
+    { { 5, 0, 0 }, { 0, 22, 3994 }, { 1500, 1500, 1500, 1620 } },
+};
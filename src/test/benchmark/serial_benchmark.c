@@ -0,0 +1,288 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host benchmark of the serial port API.
+ *
+ * drivers/serial.c is driven through a port that works like an interrupt driven UART: the bytes go into the
+ * ring buffers and every write starts the transmitter. The same messages are sent byte by byte, the way MSP,
+ * telemetry and the CLI wrote them before, and with the bulk and in place operations, and the throughput is printed
+ * in bytes/us. Only the cost on the host is measured, compare the numbers between the variants and between commits.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "platform.h"
+
+#include "drivers/serial.h"
+
+#define BENCHMARK_WARMUP_ITERATIONS 10000
+#define BENCHMARK_ITERATIONS 2000000
+
+#define BENCHMARK_BUFFER_SIZE 256       // as UART1
+
+#define MSP_PAYLOAD_SIZE 18             // MSP_RAW_IMU
+#define MSP_REPLY_OVERHEAD 6
+#define MSP_RAW_IMU 102
+
+static volatile uint8_t rxBuffer[BENCHMARK_BUFFER_SIZE];
+static volatile uint8_t txBuffer[BENCHMARK_BUFFER_SIZE];
+
+static serialPort_t port;
+
+// stands in for enabling the transmit interrupt or starting the transmit DMA
+static volatile uint32_t transmitterStarts;
+
+static const int16_t imuValues[MSP_PAYLOAD_SIZE / 2] = { -12, 7, 4096, 3, -2, 1, 210, -35, 402 };
+static const char cliLine[] = "set gyro_lpf = 42\r\nset moron_threshold = 32\r\n";
+static uint8_t received[BENCHMARK_BUFFER_SIZE];
+
+static uint8_t checksum;
+static volatile uint8_t sink;
+
+static void benchmarkWrite(serialPort_t *instance, uint8_t ch)
+{
+    ringBufferPut(&instance->txBuffer, ch);
+    transmitterStarts++;
+}
+
+static uint32_t benchmarkTotalBytesWaiting(serialPort_t *instance)
+{
+    return ringBufferCount(&instance->rxBuffer);
+}
+
+static uint8_t benchmarkRead(serialPort_t *instance)
+{
+    uint8_t ch = 0;
+
+    ringBufferGet(&instance->rxBuffer, &ch);
+    return ch;
+}
+
+static void benchmarkSetBaudRate(serialPort_t *instance, uint32_t baudRate)
+{
+    instance->baudRate = baudRate;
+}
+
+static bool isBenchmarkTransmitBufferEmpty(serialPort_t *instance)
+{
+    return ringBufferCount(&instance->txBuffer) == 0;
+}
+
+static void benchmarkSetMode(serialPort_t *instance, portMode_t mode)
+{
+    instance->mode = mode;
+}
+
+static void benchmarkWriteBuf(serialPort_t *instance, const uint8_t *data, uint32_t count)
+{
+    serialBufferWrite(instance, data, count);
+    transmitterStarts++;
+}
+
+static void benchmarkTxCommit(serialPort_t *instance, uint32_t count)
+{
+    serialBufferTxCommit(instance, count);
+    transmitterStarts++;
+}
+
+static const struct serialPortVTable benchmarkVTable[] = {
+    {
+        benchmarkWrite,
+        benchmarkTotalBytesWaiting,
+        benchmarkRead,
+        benchmarkSetBaudRate,
+        isBenchmarkTransmitBufferEmpty,
+        benchmarkSetMode,
+        NULL,
+        benchmarkWriteBuf,
+        serialBufferRead,
+        serialBufferTxReserve,
+        benchmarkTxCommit,
+    }
+};
+
+static uint64_t nanoseconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// the transmitter sent everything
+static void drainTransmitBuffer(void)
+{
+    sink = port.txBuffer.buffer[(port.txBuffer.head - 1) & port.txBuffer.mask];
+    ringBufferConsume(&port.txBuffer, ringBufferCount(&port.txBuffer));
+}
+
+// the receiver got count bytes
+static void fillReceiveBuffer(uint32_t count)
+{
+    ringBufferProduce(&port.rxBuffer, count);
+}
+
+// the MSP reply as serialize8() wrote it before, one serialWrite() per byte
+static void bytewiseSerialize8(uint8_t a)
+{
+    serialWrite(&port, a);
+    checksum ^= a;
+}
+
+static void stepMspReplyBytewise(void)
+{
+    uint8_t index;
+
+    bytewiseSerialize8('$');
+    bytewiseSerialize8('M');
+    bytewiseSerialize8('>');
+    checksum = 0;
+    bytewiseSerialize8(MSP_PAYLOAD_SIZE);
+    bytewiseSerialize8(MSP_RAW_IMU);
+    for (index = 0; index < MSP_PAYLOAD_SIZE / 2; index++) {
+        bytewiseSerialize8(imuValues[index] & 0xff);
+        bytewiseSerialize8((imuValues[index] >> 8) & 0xff);
+    }
+    bytewiseSerialize8(checksum);
+
+    drainTransmitBuffer();
+}
+
+// the MSP reply as serial_msp.c builds it now, in place in the transmit buffer
+static void stepMspReplyInPlace(void)
+{
+    uint8_t *frame = serialTxReserve(&port, MSP_REPLY_OVERHEAD + MSP_PAYLOAD_SIZE);
+    uint8_t length = 0;
+    uint8_t index;
+
+    if (!frame) {
+        // no room before the end of the buffer
+        stepMspReplyBytewise();
+        return;
+    }
+
+    frame[length++] = '$';
+    frame[length++] = 'M';
+    frame[length++] = '>';
+    checksum = 0;
+    checksum ^= frame[length++] = MSP_PAYLOAD_SIZE;
+    checksum ^= frame[length++] = MSP_RAW_IMU;
+    for (index = 0; index < MSP_PAYLOAD_SIZE / 2; index++) {
+        checksum ^= frame[length++] = imuValues[index] & 0xff;
+        checksum ^= frame[length++] = (imuValues[index] >> 8) & 0xff;
+    }
+    frame[length++] = checksum;
+
+    serialTxCommit(&port, length);
+
+    drainTransmitBuffer();
+}
+
+static void stepPrintBytewise(void)
+{
+    const char *str = cliLine;
+
+    while (*str) {
+        serialWrite(&port, *(str++));
+    }
+
+    drainTransmitBuffer();
+}
+
+static void stepPrint(void)
+{
+    serialPrint(&port, cliLine);
+
+    drainTransmitBuffer();
+}
+
+static void stepReadBytewise(void)
+{
+    uint32_t count = 0;
+
+    fillReceiveBuffer(sizeof(cliLine));
+
+    while (serialTotalBytesWaiting(&port)) {
+        received[count++] = serialRead(&port);
+    }
+
+    sink = received[count - 1];
+}
+
+static void stepReadBuf(void)
+{
+    uint32_t count;
+
+    fillReceiveBuffer(sizeof(cliLine));
+
+    count = serialReadBuf(&port, received, sizeof(received));
+
+    sink = received[count - 1];
+}
+
+static void runBenchmark(const char *name, void (*step)(void), uint32_t bytesPerStep)
+{
+    uint32_t iteration;
+    uint32_t startsBefore;
+    uint64_t startedAt;
+    uint64_t elapsed;
+
+    for (iteration = 0; iteration < BENCHMARK_WARMUP_ITERATIONS; iteration++) {
+        step();
+    }
+
+    startsBefore = transmitterStarts;
+    startedAt = nanoseconds();
+
+    for (iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        step();
+    }
+
+    elapsed = nanoseconds() - startedAt;
+
+    printf("%-32s %8.1f bytes/us %8.2f transmitter starts/message\n",
+        name,
+        (double)bytesPerStep * BENCHMARK_ITERATIONS * 1000 / elapsed,
+        (double)(transmitterStarts - startsBefore) / BENCHMARK_ITERATIONS
+    );
+}
+
+int main(void)
+{
+    memset(&port, 0, sizeof(port));
+    port.vTable = benchmarkVTable;
+    port.mode = MODE_RXTX;
+    ringBufferInit(&port.rxBuffer, rxBuffer, BENCHMARK_BUFFER_SIZE);
+    ringBufferInit(&port.txBuffer, txBuffer, BENCHMARK_BUFFER_SIZE);
+
+    printf("%u iterations, %u byte buffers\n", BENCHMARK_ITERATIONS, BENCHMARK_BUFFER_SIZE);
+
+    runBenchmark("MSP reply serialWrite", stepMspReplyBytewise, MSP_REPLY_OVERHEAD + MSP_PAYLOAD_SIZE);
+    runBenchmark("MSP reply serialTxReserve", stepMspReplyInPlace, MSP_REPLY_OVERHEAD + MSP_PAYLOAD_SIZE);
+    runBenchmark("print serialWrite", stepPrintBytewise, strlen(cliLine));
+    runBenchmark("print serialWriteBuf", stepPrint, strlen(cliLine));
+    runBenchmark("receive serialRead", stepReadBytewise, sizeof(cliLine));
+    runBenchmark("receive serialReadBuf", stepReadBuf, sizeof(cliLine));
+
+    return EXIT_SUCCESS;
+}
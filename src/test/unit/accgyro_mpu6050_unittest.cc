@@ -0,0 +1,246 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "drivers/gpio.h"
+#include "drivers/bus_i2c.h"
+#include "drivers/bus_i2c_queue.h"
+#include "drivers/accgyro.h"
+#include "drivers/accgyro_mpu6050.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define MPU6050_WHO_AM_I 0x68
+
+uint16_t acc_1G;
+
+// fake bus, a started read completes after a few calls to micros() like one ended by the interrupt handler
+typedef struct fakeI2cBus_s {
+    uint8_t *buffer;
+    uint8_t length;
+    uint8_t pollsUntilComplete;
+    bool failNext;
+    uint16_t startCount;    // the burst filled in by a transfer is numbered by the transfer that read it
+} fakeI2cBus_t;
+
+static fakeI2cBus_t bus;
+static uint32_t simulatedTime;
+
+static const mpu6050Config_t config = { 0, 0, NULL };
+static gyro_t gyro;
+static acc_t acc;
+
+static void putValue(uint8_t *buf, int16_t value)
+{
+    buf[0] = (uint16_t)value >> 8;
+    buf[1] = value & 0xff;
+}
+
+static int16_t accelSample(uint16_t transfer, uint8_t axis)
+{
+    return transfer * 100 + axis;
+}
+
+static int16_t gyroSample(uint16_t transfer, uint8_t axis)
+{
+    return -(transfer * 100 + axis);
+}
+
+static void completeTransfer(void)
+{
+    uint8_t axis;
+
+    if (bus.failNext) {
+        bus.failNext = false;
+        bus.buffer = NULL;
+        i2cQueueTransferComplete(false);
+        return;
+    }
+
+    for (axis = 0; axis < 3; axis++) {
+        putValue(bus.buffer + axis * 2, accelSample(bus.startCount, axis));
+        putValue(bus.buffer + 8 + axis * 2, gyroSample(bus.startCount, axis));
+    }
+    bus.buffer = NULL;
+    i2cQueueTransferComplete(true);
+}
+
+static void detectSensor(void)
+{
+    i2cQueueWaitIdle(); // a transfer left running by the previous test would never complete after the reset
+
+    memset(&bus, 0, sizeof(bus));
+    simulatedTime = 0;
+    i2cQueueInit();
+
+    EXPECT_TRUE(mpu6050AccDetect(&config, &acc));
+    EXPECT_TRUE(mpu6050GyroDetect(&config, &gyro, 42));
+}
+
+// the sample is kept by the driver between tests, the first read of the accel has to come first
+TEST(AccgyroMpu6050Test, TestAccelReadBeforeGyroReadsBurst)
+{
+    // given
+    int16_t accData[3];
+    detectSensor();
+
+    // when
+    acc.read(accData);
+
+    // then
+    EXPECT_EQ(1, bus.startCount);
+    EXPECT_TRUE(i2cQueueIsIdle());
+    EXPECT_EQ(accelSample(1, 0), accData[0]);
+    EXPECT_EQ(accelSample(1, 1), accData[1]);
+    EXPECT_EQ(accelSample(1, 2), accData[2]);
+}
+
+TEST(AccgyroMpu6050Test, TestGyroReadReturnsSampleOfItsOwnTransfer)
+{
+    // given
+    int16_t gyroData[3];
+    uint16_t read;
+    detectSensor();
+
+    for (read = 1; read <= 5; read++) {
+        // when
+        gyro.read(gyroData);
+
+        // then
+        EXPECT_EQ(read, bus.startCount);
+        EXPECT_TRUE(i2cQueueIsIdle()); // no transfer is left running for the next read to collect
+        EXPECT_EQ(gyroSample(read, 0), gyroData[0]);
+        EXPECT_EQ(gyroSample(read, 1), gyroData[1]);
+        EXPECT_EQ(gyroSample(read, 2), gyroData[2]);
+    }
+}
+
+TEST(AccgyroMpu6050Test, TestAccelReadUsesBurstOfGyroRead)
+{
+    // given
+    int16_t gyroData[3];
+    int16_t accData[3];
+    detectSensor();
+
+    // when
+    gyro.read(gyroData);
+    gyro.read(gyroData);
+    acc.read(accData);
+
+    // then
+    EXPECT_EQ(2, bus.startCount);
+    EXPECT_EQ(accelSample(2, 0), accData[0]);
+    EXPECT_EQ(accelSample(2, 1), accData[1]);
+    EXPECT_EQ(accelSample(2, 2), accData[2]);
+}
+
+TEST(AccgyroMpu6050Test, TestFailedTransferKeepsLastSample)
+{
+    // given
+    int16_t gyroData[3];
+    int16_t accData[3];
+    detectSensor();
+    gyro.read(gyroData);
+
+    // when
+    bus.failNext = true;
+    gyro.read(gyroData);
+    acc.read(accData);
+
+    // then
+    EXPECT_EQ(2, bus.startCount);
+    EXPECT_EQ(gyroSample(1, 0), gyroData[0]);
+    EXPECT_EQ(gyroSample(1, 2), gyroData[2]);
+    EXPECT_EQ(accelSample(1, 0), accData[0]);
+
+    // when the bus works again
+    gyro.read(gyroData);
+
+    // then
+    EXPECT_EQ(gyroSample(3, 0), gyroData[0]);
+}
+
+// STUBS
+
+uint32_t micros(void)
+{
+    simulatedTime += 10;
+    if (bus.buffer && --bus.pollsUntilComplete == 0) {
+        completeTransfer();
+    }
+    return simulatedTime;
+}
+
+void delay(uint32_t ms)
+{
+    UNUSED(ms);
+}
+
+void failureMode(uint8_t mode)
+{
+    UNUSED(mode);
+}
+
+void gpioInit(GPIO_TypeDef *gpio, gpio_config_t *config)
+{
+    UNUSED(gpio);
+    UNUSED(config);
+}
+
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState)
+{
+    UNUSED(RCC_APB2Periph);
+    UNUSED(NewState);
+}
+
+bool i2cWrite(uint8_t addr_, uint8_t reg, uint8_t data)
+{
+    UNUSED(addr_);
+    UNUSED(reg);
+    UNUSED(data);
+    return true;
+}
+
+bool i2cRead(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf)
+{
+    UNUSED(addr_);
+    UNUSED(reg);
+    memset(buf, MPU6050_WHO_AM_I, len);
+    return true;
+}
+
+bool i2cReadStart(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf)
+{
+    UNUSED(addr_);
+    UNUSED(reg);
+
+    bus.startCount++;
+    bus.buffer = buf;
+    bus.length = len;
+    bus.pollsUntilComplete = 3;
+    return true;
+}
+
+void i2cRecover(void)
+{
+}
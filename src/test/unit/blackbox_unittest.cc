@@ -0,0 +1,282 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "blackbox/blackbox_encoding.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_MOTOR_COUNT 4
+#define TEST_FRAME_COUNT 100
+#define TEST_LOG_SIZE (TEST_FRAME_COUNT * BLACKBOX_MAX_FRAME_SIZE)
+
+static blackboxFrame_t frames[TEST_FRAME_COUNT];
+static blackboxFrame_t decodedFrames[TEST_FRAME_COUNT];
+static uint8_t logBuffer[TEST_LOG_SIZE];
+static uint32_t frameOffsets[TEST_FRAME_COUNT];
+
+static void makeFrames(void)
+{
+    uint32_t index;
+    uint8_t axis;
+
+    memset(frames, 0, sizeof(frames));
+
+    for (index = 0; index < TEST_FRAME_COUNT; index++) {
+        frames[index].loopIteration = index;
+        frames[index].time = 1000000 + index * 3500 + (index % 3);     // some jitter on the loop time
+        for (axis = 0; axis < 3; axis++) {
+            frames[index].axisPID[axis] = (int16_t)(index * 7 * (axis + 1)) - 300;
+            frames[index].gyroData[axis] = (int16_t)((index * 13) % 50) - 25;
+            frames[index].accSmooth[axis] = axis == 2 ? 512 : -(int16_t)index;
+        }
+        frames[index].rcCommand[0] = 12;
+        frames[index].rcCommand[1] = -12;
+        frames[index].rcCommand[2] = 0;
+        frames[index].rcCommand[3] = 1150 + index;
+        for (axis = 0; axis < TEST_MOTOR_COUNT; axis++) {
+            frames[index].motor[axis] = 1150 + index * (axis + 1);
+        }
+    }
+}
+
+static uint32_t encodeFrames(void)
+{
+    blackboxEncoder_t encoder;
+    uint32_t length = 0;
+    uint32_t index;
+
+    blackboxEncoderInit(&encoder, TEST_MOTOR_COUNT);
+
+    for (index = 0; index < TEST_FRAME_COUNT; index++) {
+        frameOffsets[index] = length;
+        length += blackboxEncodeFrame(&encoder, &frames[index], &logBuffer[length]);
+    }
+
+    return length;
+}
+
+typedef struct decodeResult_s {
+    uint32_t frames;
+    uint32_t skipped;
+    uint32_t corruptBytes;
+} decodeResult_t;
+
+static decodeResult_t decodeLog(const uint8_t *data, uint32_t length)
+{
+    blackboxDecoder_t decoder;
+    decodeResult_t result;
+    blackboxFrame_t frame;
+    uint32_t position = 0;
+    uint32_t consumed;
+
+    memset(&result, 0, sizeof(result));
+    blackboxDecoderInit(&decoder, TEST_MOTOR_COUNT);
+
+    while (position < length) {
+        switch (blackboxDecodeFrame(&decoder, &data[position], length - position, &frame, &consumed)) {
+            case BLACKBOX_DECODE_FRAME:
+                if (result.frames < TEST_FRAME_COUNT) {
+                    decodedFrames[result.frames] = frame;
+                }
+                result.frames++;
+                break;
+            case BLACKBOX_DECODE_SKIPPED:
+                result.skipped++;
+                break;
+            case BLACKBOX_DECODE_CORRUPT:
+                result.corruptBytes += consumed;
+                break;
+            case BLACKBOX_DECODE_INCOMPLETE:
+                return result;
+        }
+        position += consumed;
+    }
+
+    return result;
+}
+
+TEST(BlackboxTest, RoundTrip)
+{
+    // given
+    makeFrames();
+    uint32_t length = encodeFrames();
+
+    // when
+    decodeResult_t result = decodeLog(logBuffer, length);
+
+    // then
+    EXPECT_EQ(TEST_FRAME_COUNT, result.frames);
+    EXPECT_EQ(0, result.skipped);
+    EXPECT_EQ(0, result.corruptBytes);
+    EXPECT_EQ(0, memcmp(frames, decodedFrames, sizeof(frames)));
+}
+
+TEST(BlackboxTest, IntraFrameInterval)
+{
+    // given
+    makeFrames();
+    encodeFrames();
+
+    // then
+    for (uint32_t index = 0; index < TEST_FRAME_COUNT; index++) {
+        uint8_t expectedMarker = index % BLACKBOX_I_INTERVAL == 0 ? BLACKBOX_MARKER_INTRA_FRAME : BLACKBOX_MARKER_INTER_FRAME;
+        EXPECT_EQ(expectedMarker, logBuffer[frameOffsets[index]]);
+    }
+}
+
+TEST(BlackboxTest, InterFramesAreSmall)
+{
+    // given
+    makeFrames();
+    uint32_t length = encodeFrames();
+
+    // then
+    // 19 fields that change a little per frame should not take more than 2 bytes each
+    EXPECT_LT(length, TEST_FRAME_COUNT * (1 + 2 + 19 * 2));
+    EXPECT_LT(frameOffsets[2] - frameOffsets[1], frameOffsets[1] - frameOffsets[0]);
+}
+
+TEST(BlackboxTest, ExtremeValues)
+{
+    // given
+    blackboxEncoder_t encoder;
+    uint8_t buffer[2 * BLACKBOX_MAX_FRAME_SIZE];
+    uint32_t length;
+
+    memset(frames, 0, sizeof(frames));
+    frames[0].loopIteration = UINT32_MAX;
+    frames[0].time = UINT32_MAX;
+    frames[1].loopIteration = 0;        // wraps
+    frames[1].time = 5;
+    for (uint8_t index = 0; index < 3; index++) {
+        frames[0].axisPID[index] = INT16_MIN;
+        frames[1].axisPID[index] = INT16_MAX;
+    }
+    for (uint8_t index = 0; index < BLACKBOX_MAX_MOTORS; index++) {
+        frames[0].motor[index] = INT16_MAX;
+        frames[1].motor[index] = INT16_MIN;
+    }
+
+    blackboxEncoderInit(&encoder, BLACKBOX_MAX_MOTORS);
+    length = blackboxEncodeFrame(&encoder, &frames[0], buffer);
+    EXPECT_LE(length, BLACKBOX_MAX_FRAME_SIZE);
+    length += blackboxEncodeFrame(&encoder, &frames[1], &buffer[length]);
+
+    // when
+    blackboxDecoder_t decoder;
+    blackboxFrame_t frame;
+    uint32_t consumed;
+
+    blackboxDecoderInit(&decoder, BLACKBOX_MAX_MOTORS);
+
+    // then
+    EXPECT_EQ(BLACKBOX_DECODE_FRAME, blackboxDecodeFrame(&decoder, buffer, length, &frame, &consumed));
+    EXPECT_EQ(0, memcmp(&frames[0], &frame, sizeof(frame)));
+
+    EXPECT_EQ(BLACKBOX_DECODE_FRAME, blackboxDecodeFrame(&decoder, &buffer[consumed], length - consumed, &frame, &consumed));
+    EXPECT_EQ(0, memcmp(&frames[1], &frame, sizeof(frame)));
+}
+
+TEST(BlackboxTest, IncompleteFrame)
+{
+    // given
+    makeFrames();
+    encodeFrames();
+
+    blackboxDecoder_t decoder;
+    blackboxFrame_t frame;
+    uint32_t consumed;
+
+    blackboxDecoderInit(&decoder, TEST_MOTOR_COUNT);
+
+    // when
+    blackboxDecodeResult_e result = blackboxDecodeFrame(&decoder, logBuffer, frameOffsets[1] - 1, &frame, &consumed);
+
+    // then
+    EXPECT_EQ(BLACKBOX_DECODE_INCOMPLETE, result);
+    EXPECT_EQ(0, consumed);
+}
+
+TEST(BlackboxTest, OverlongValueIsCorrupt)
+{
+    // given
+    uint8_t buffer[] = { BLACKBOX_MARKER_INTRA_FRAME, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+    blackboxDecoder_t decoder;
+    blackboxFrame_t frame;
+    uint32_t consumed;
+
+    blackboxDecoderInit(&decoder, TEST_MOTOR_COUNT);
+
+    // when
+    blackboxDecodeResult_e result = blackboxDecodeFrame(&decoder, buffer, sizeof(buffer), &frame, &consumed);
+
+    // then
+    EXPECT_EQ(BLACKBOX_DECODE_CORRUPT, result);
+    EXPECT_EQ(1, consumed);
+}
+
+TEST(BlackboxTest, LostByteResynchronisesOnIntraFrame)
+{
+    // given
+    makeFrames();
+    uint32_t length = encodeFrames();
+
+    // a byte from the middle of frame 5 is lost
+    uint32_t lostByte = frameOffsets[5] + 3;
+    memmove(&logBuffer[lostByte], &logBuffer[lostByte + 1], length - lostByte - 1);
+    length--;
+
+    // when
+    decodeResult_t result = decodeLog(logBuffer, length);
+
+    // then
+    // frames 0 to 4 decode, the rest of the first intra frame interval is lost, from frame 32 on everything decodes
+    EXPECT_EQ(5 + TEST_FRAME_COUNT - BLACKBOX_I_INTERVAL, result.frames);
+    EXPECT_GT(result.corruptBytes, 0);
+    EXPECT_EQ(0, memcmp(&frames[0], &decodedFrames[0], 5 * sizeof(blackboxFrame_t)));
+    EXPECT_EQ(0, memcmp(&frames[BLACKBOX_I_INTERVAL], &decodedFrames[5],
+        (TEST_FRAME_COUNT - BLACKBOX_I_INTERVAL) * sizeof(blackboxFrame_t)));
+}
+
+TEST(BlackboxTest, DroppedFramesLeaveIterationGap)
+{
+    // given
+    makeFrames();
+
+    blackboxEncoder_t encoder;
+    uint32_t length = 0;
+
+    blackboxEncoderInit(&encoder, TEST_MOTOR_COUNT);
+    length += blackboxEncodeFrame(&encoder, &frames[0], &logBuffer[length]);
+    length += blackboxEncodeFrame(&encoder, &frames[1], &logBuffer[length]);
+    // frames 2 to 9 were dropped by the firmware before they were encoded
+    length += blackboxEncodeFrame(&encoder, &frames[10], &logBuffer[length]);
+
+    // when
+    decodeResult_t result = decodeLog(logBuffer, length);
+
+    // then
+    EXPECT_EQ(3, result.frames);
+    EXPECT_EQ(0, result.corruptBytes);
+    EXPECT_EQ(10, decodedFrames[2].loopIteration);
+    EXPECT_EQ(frames[10].time, decodedFrames[2].time);
+    EXPECT_EQ(0, memcmp(&frames[10], &decodedFrames[2], sizeof(blackboxFrame_t)));
+}
@@ -0,0 +1,294 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "drivers/bus_i2c.h"
+#include "drivers/bus_i2c_queue.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// fake bus, completes the started read when the test says so unless it completes synchronously like a polled driver
+typedef struct fakeI2cBus_s {
+    bool synchronous;
+    bool refuseStart;
+    uint8_t startCount;
+    uint8_t recoverCount;
+    uint8_t lastReg;
+    uint8_t data;
+} fakeI2cBus_t;
+
+static fakeI2cBus_t bus;
+static uint32_t simulatedTime;
+static uint32_t timeStep;   // time passing with every call to micros(), so waiting can time out
+
+static uint8_t bufferA[4];
+static uint8_t bufferB[4];
+static i2cTransfer_t transferA;
+static i2cTransfer_t transferB;
+
+static void initTransfer(i2cTransfer_t *transfer, uint8_t reg, uint8_t *buffer)
+{
+    memset(transfer, 0, sizeof(*transfer));
+    transfer->address = 0x68;
+    transfer->reg = reg;
+    transfer->length = 4;
+    transfer->buffer = buffer;
+}
+
+static void resetQueue(void)
+{
+    memset(&bus, 0, sizeof(bus));
+    bus.data = 0x55;
+    simulatedTime = 0;
+    timeStep = 0;
+    memset(bufferA, 0, sizeof(bufferA));
+    memset(bufferB, 0, sizeof(bufferB));
+    initTransfer(&transferA, 0x3B, bufferA);
+    initTransfer(&transferB, 0x0C, bufferB);
+    i2cQueueInit();
+}
+
+TEST(BusI2cQueueTest, TestTransferCompletesAsynchronously)
+{
+    // given
+    resetQueue();
+
+    // when
+    EXPECT_TRUE(i2cQueueSubmit(&transferA));
+
+    // then
+    EXPECT_EQ(1, bus.startCount);
+    EXPECT_EQ(I2C_TRANSFER_BUSY, transferA.state);
+    EXPECT_TRUE(i2cTransferIsPending(&transferA));
+    EXPECT_FALSE(i2cQueueIsIdle());
+
+    // when
+    i2cQueueTransferComplete(true);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_DONE, transferA.state);
+    EXPECT_TRUE(i2cQueueIsIdle());
+    EXPECT_TRUE(i2cQueueWait(&transferA));
+    EXPECT_EQ(0, bus.recoverCount);
+}
+
+TEST(BusI2cQueueTest, TestTransfersRunInSubmissionOrder)
+{
+    // given
+    resetQueue();
+
+    // when
+    i2cQueueSubmit(&transferA);
+    i2cQueueSubmit(&transferB);
+
+    // then
+    EXPECT_EQ(1, bus.startCount);
+    EXPECT_EQ(0x3B, bus.lastReg);
+    EXPECT_EQ(I2C_TRANSFER_QUEUED, transferB.state);
+
+    // when
+    i2cQueueTransferComplete(true);
+    i2cQueueUpdate();
+
+    // then
+    EXPECT_EQ(2, bus.startCount);
+    EXPECT_EQ(0x0C, bus.lastReg);
+    EXPECT_EQ(I2C_TRANSFER_BUSY, transferB.state);
+}
+
+TEST(BusI2cQueueTest, TestPendingTransferIsNotSubmittedTwice)
+{
+    // given
+    resetQueue();
+    i2cQueueSubmit(&transferA);
+
+    // expect
+    EXPECT_FALSE(i2cQueueSubmit(&transferA));
+    EXPECT_EQ(1, bus.startCount);
+
+    // and
+    i2cQueueTransferComplete(true);
+    EXPECT_TRUE(i2cQueueSubmit(&transferA));
+    EXPECT_EQ(2, bus.startCount);
+}
+
+TEST(BusI2cQueueTest, TestSubmitFailsWhenQueueIsFull)
+{
+    // given
+    resetQueue();
+    i2cTransfer_t transfers[I2C_QUEUE_LENGTH + 1];
+    uint8_t buffer[4];
+
+    // the first one is started straight away and leaves the queue
+    for (int i = 0; i < I2C_QUEUE_LENGTH + 1; i++) {
+        initTransfer(&transfers[i], i, buffer);
+        EXPECT_TRUE(i2cQueueSubmit(&transfers[i]));
+    }
+
+    // expect
+    EXPECT_FALSE(i2cQueueSubmit(&transferA));
+}
+
+TEST(BusI2cQueueTest, TestSynchronousBusRunsWholeQueue)
+{
+    // given
+    resetQueue();
+    bus.synchronous = true;
+
+    // when
+    i2cQueueSubmit(&transferA);
+    i2cQueueSubmit(&transferB);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_DONE, transferA.state);
+    EXPECT_EQ(I2C_TRANSFER_DONE, transferB.state);
+    EXPECT_EQ(0x55, bufferA[3]);
+    EXPECT_EQ(0x55, bufferB[0]);
+    EXPECT_TRUE(i2cQueueIsIdle());
+}
+
+TEST(BusI2cQueueTest, TestFailedTransferRecoversBusBeforeNext)
+{
+    // given
+    resetQueue();
+    i2cQueueSubmit(&transferA);
+    i2cQueueSubmit(&transferB);
+
+    // when
+    i2cQueueTransferComplete(false);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferA.state);
+    EXPECT_FALSE(i2cQueueWait(&transferA));
+    EXPECT_EQ(0, bus.recoverCount);
+
+    // when
+    i2cQueueUpdate();
+
+    // then
+    EXPECT_EQ(1, bus.recoverCount);
+    EXPECT_EQ(2, bus.startCount);
+    EXPECT_EQ(I2C_TRANSFER_BUSY, transferB.state);
+}
+
+TEST(BusI2cQueueTest, TestTransferThatCanNotStartFails)
+{
+    // given
+    resetQueue();
+    bus.refuseStart = true;
+
+    // when
+    i2cQueueSubmit(&transferA);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferA.state);
+    EXPECT_TRUE(i2cQueueIsIdle());
+
+    // when
+    bus.refuseStart = false;
+    i2cQueueSubmit(&transferB);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_QUEUED, transferB.state);
+
+    // when
+    i2cQueueUpdate();
+
+    // then
+    EXPECT_EQ(1, bus.recoverCount);
+    EXPECT_EQ(I2C_TRANSFER_BUSY, transferB.state);
+}
+
+TEST(BusI2cQueueTest, TestStuckTransferTimesOut)
+{
+    // given
+    resetQueue();
+    i2cQueueSubmit(&transferA);
+
+    // when
+    simulatedTime += I2C_TRANSFER_TIMEOUT - 1;
+    i2cQueueUpdate();
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_BUSY, transferA.state);
+    EXPECT_EQ(0, bus.recoverCount);
+
+    // when
+    simulatedTime += 1;
+    i2cQueueUpdate();
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferA.state);
+    EXPECT_EQ(1, bus.recoverCount);
+    EXPECT_TRUE(i2cQueueIsIdle());
+
+    // when the bus still ends the transfer after it timed out
+    i2cQueueTransferComplete(true);
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferA.state);
+}
+
+TEST(BusI2cQueueTest, TestWaitingGivesUpOnStuckBus)
+{
+    // given
+    resetQueue();
+    timeStep = 10;
+    i2cQueueSubmit(&transferA);
+    i2cQueueSubmit(&transferB);
+
+    // when
+    i2cQueueWaitIdle();
+
+    // then
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferA.state);
+    EXPECT_EQ(I2C_TRANSFER_FAILED, transferB.state);
+    EXPECT_EQ(2, bus.recoverCount);
+}
+
+// STUBS
+
+uint32_t micros(void)
+{
+    simulatedTime += timeStep;
+    return simulatedTime;
+}
+
+bool i2cReadStart(uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf)
+{
+    UNUSED(addr_);
+
+    if (bus.refuseStart) {
+        return false;
+    }
+
+    bus.startCount++;
+    bus.lastReg = reg;
+    if (bus.synchronous) {
+        memset(buf, bus.data, len);
+        i2cQueueTransferComplete(true);
+    }
+    return true;
+}
+
+void i2cRecover(void)
+{
+    bus.recoverCount++;
+}
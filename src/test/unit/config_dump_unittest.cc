@@ -0,0 +1,275 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/color.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/serial.h"
+#include "drivers/pwm_rx.h"
+#include "flight/flight.h"
+#include "flight/mixer.h"
+#include "flight/navigation.h"
+#include "flight/failsafe.h"
+#include "rx/rx.h"
+#include "io/escservo.h"
+#include "io/gps.h"
+#include "io/gimbal.h"
+#include "io/rc_controls.h"
+#include "io/serial.h"
+#include "io/ledstrip.h"
+#include "sensors/battery.h"
+#include "sensors/boardalignment.h"
+#include "sensors/sensors.h"
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+#include "sensors/barometer.h"
+#include "flight/imu.h"
+#include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "config/config_values.h"
+#include "config/config_dump.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static master_t testConfig;
+static master_t restoredConfig;
+static uint8_t dump[4096];
+
+// a value of every config value that is in range and differs between values and profiles
+static int_float_value_t testValue(const configValue_t *value, uint8_t profileIndex)
+{
+    int_float_value_t result;
+    int32_t span = value->max - value->min;
+
+    if (value->type & VAR_FLOAT) {
+        result.float_value = value->min + span * (0.25f + 0.25f * profileIndex);
+    } else {
+        result.int_value = value->min + (span ? (value->id + profileIndex) % (span + 1) : 0);
+    }
+    return result;
+}
+
+static void fillTestConfig(void)
+{
+    memset(&testConfig, 0, sizeof(testConfig));
+    for (uint16_t i = 0; i < configValueCount; i++) {
+        for (uint8_t profileIndex = 0; profileIndex < MAX_PROFILE_COUNT; profileIndex++) {
+            configValueSet(&testConfig, &configValues[i], profileIndex, testValue(&configValues[i], profileIndex));
+        }
+    }
+}
+
+static uint32_t writeDump(const master_t *config)
+{
+    configDumpRecord_t record;
+    uint32_t length = 0;
+
+    dump[length++] = CONFIG_DUMP_FORMAT_VERSION;
+    for (uint16_t index = 0; index < configDumpIndexCount(); index++) {
+        if (configDumpGetRecord(config, index, &record)) {
+            length += configDumpEncodeRecord(&dump[length], &record);
+        }
+    }
+    return length;
+}
+
+static uint16_t applyDump(master_t *config, uint32_t length)
+{
+    configDumpRecord_t record;
+    uint32_t position = 1;
+    uint16_t applied = 0;
+    uint8_t size;
+
+    while ((size = configDumpDecodeRecord(&dump[position], length - position, &record))) {
+        if (configDumpApplyRecord(config, &record) == CONFIG_DUMP_APPLIED) {
+            applied++;
+        }
+        position += size;
+    }
+    EXPECT_EQ(length, position);
+    return applied;
+}
+
+TEST(ConfigDumpTest, IdsAreUnique)
+{
+    for (uint16_t i = 0; i < configValueCount; i++) {
+        EXPECT_NE(0, configValues[i].id);
+        EXPECT_EQ(&configValues[i], findConfigValueById(configValues[i].id));
+        EXPECT_EQ(&configValues[i], findConfigValueByName(configValues[i].name));
+    }
+}
+
+TEST(ConfigDumpTest, DumpRestoresEveryValueOfEveryProfile)
+{
+    // given
+    fillTestConfig();
+    uint32_t length = writeDump(&testConfig);
+
+    // when
+    memset(&restoredConfig, 0, sizeof(restoredConfig));
+    uint16_t applied = applyDump(&restoredConfig, length);
+
+    // then
+    uint16_t expectedRecords = 0;
+    for (uint16_t i = 0; i < configValueCount; i++) {
+        const configValue_t *value = &configValues[i];
+        uint8_t profileCount = (value->type & PROFILE_VALUE) ? MAX_PROFILE_COUNT : 1;
+
+        for (uint8_t profileIndex = 0; profileIndex < profileCount; profileIndex++) {
+            int_float_value_t expected = configValueGet(&testConfig, value, profileIndex);
+            int_float_value_t actual = configValueGet(&restoredConfig, value, profileIndex);
+
+            if (value->type & VAR_FLOAT) {
+                EXPECT_EQ(expected.float_value, actual.float_value) << value->name;
+            } else {
+                EXPECT_EQ(expected.int_value, actual.int_value) << value->name;
+            }
+            expectedRecords++;
+        }
+    }
+    EXPECT_EQ(expectedRecords, applied);
+}
+
+TEST(ConfigDumpTest, RecordIsLittleEndian)
+{
+    // given
+    configDumpRecord_t record = { 0x0102, 2, VAR_UINT16, { 0 } };
+    record.value.int_value = 0x0304;
+    uint8_t buffer[CONFIG_DUMP_RECORD_MAX_SIZE];
+
+    // when
+    uint8_t size = configDumpEncodeRecord(buffer, &record);
+
+    // then
+    uint8_t expected[] = { 0x02, 0x01, 2, VAR_UINT16, 0x04, 0x03 };
+    EXPECT_EQ(sizeof(expected), size);
+    EXPECT_EQ(0, memcmp(expected, buffer, sizeof(expected)));
+}
+
+TEST(ConfigDumpTest, SignedValuesAreSignExtended)
+{
+    // given
+    configDumpRecord_t record = { 1, 0, VAR_INT16, { 0 } };
+    record.value.int_value = -300;
+    uint8_t buffer[CONFIG_DUMP_RECORD_MAX_SIZE];
+    configDumpEncodeRecord(buffer, &record);
+
+    // when
+    configDumpRecord_t decoded;
+    configDumpDecodeRecord(buffer, sizeof(buffer), &decoded);
+
+    // then
+    EXPECT_EQ(-300, decoded.value.int_value);
+}
+
+TEST(ConfigDumpTest, TruncatedRecordIsNotDecoded)
+{
+    // given
+    configDumpRecord_t record = { 1, 0, VAR_UINT32, { 0 } };
+    uint8_t buffer[CONFIG_DUMP_RECORD_MAX_SIZE];
+    uint8_t size = configDumpEncodeRecord(buffer, &record);
+
+    // when
+    configDumpRecord_t decoded;
+
+    // then
+    EXPECT_EQ(0, configDumpDecodeRecord(buffer, size - 1, &decoded));
+    EXPECT_EQ(size, configDumpDecodeRecord(buffer, size, &decoded));
+}
+
+TEST(ConfigDumpTest, UnknownTypeIsNotDecoded)
+{
+    // given
+    uint8_t buffer[] = { 1, 0, 0, 0x40, 0, 0, 0, 0 };
+
+    // when
+    configDumpRecord_t decoded;
+
+    // then
+    EXPECT_EQ(0, configDumpDecodeRecord(buffer, sizeof(buffer), &decoded));
+}
+
+TEST(ConfigDumpTest, UnknownIdIsSkipped)
+{
+    // given
+    memset(&restoredConfig, 0, sizeof(restoredConfig));
+    configDumpRecord_t record = { 0xFFFF, 0, VAR_UINT8, { 0 } };
+    record.value.int_value = 1;
+
+    // expect
+    EXPECT_EQ(CONFIG_DUMP_UNKNOWN_VALUE, configDumpApplyRecord(&restoredConfig, &record));
+}
+
+TEST(ConfigDumpTest, OutOfRangeValueIsSkipped)
+{
+    // given
+    const configValue_t *looptime = findConfigValueByName("looptime");
+    memset(&restoredConfig, 0, sizeof(restoredConfig));
+    restoredConfig.looptime = 3500;
+    configDumpRecord_t record = { looptime->id, 0, VAR_UINT16, { 0 } };
+    record.value.int_value = looptime->max + 1;
+
+    // expect
+    EXPECT_EQ(CONFIG_DUMP_OUT_OF_RANGE, configDumpApplyRecord(&restoredConfig, &record));
+    EXPECT_EQ(3500, restoredConfig.looptime);
+}
+
+TEST(ConfigDumpTest, MasterValueOfAnotherProfileIsSkipped)
+{
+    // given
+    const configValue_t *looptime = findConfigValueByName("looptime");
+    memset(&restoredConfig, 0, sizeof(restoredConfig));
+    configDumpRecord_t record = { looptime->id, 1, VAR_UINT16, { 0 } };
+    record.value.int_value = 2000;
+
+    // expect
+    EXPECT_EQ(CONFIG_DUMP_OUT_OF_RANGE, configDumpApplyRecord(&restoredConfig, &record));
+    EXPECT_EQ(0, restoredConfig.looptime);
+}
+
+TEST(ConfigDumpTest, ValueOfAnotherTypeIsConverted)
+{
+    // given - values dumped by firmware where looptime was 8 bits and p_pitch was a float
+    const configValue_t *looptime = findConfigValueByName("looptime");
+    const configValue_t *pPitch = findConfigValueByName("p_pitch");
+    memset(&restoredConfig, 0, sizeof(restoredConfig));
+    configDumpRecord_t narrow = { looptime->id, 0, VAR_UINT8, { 0 } };
+    narrow.value.int_value = 200;
+    configDumpRecord_t floating = { pPitch->id, 2, VAR_FLOAT, { 0 } };
+    floating.value.float_value = 39.6f;
+
+    // when
+    EXPECT_EQ(CONFIG_DUMP_APPLIED, configDumpApplyRecord(&restoredConfig, &narrow));
+    EXPECT_EQ(CONFIG_DUMP_APPLIED, configDumpApplyRecord(&restoredConfig, &floating));
+
+    // then
+    EXPECT_EQ(200, restoredConfig.looptime);
+    EXPECT_EQ(40, restoredConfig.profile[2].pidProfile.P8[PITCH]);
+}
@@ -0,0 +1,569 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "config/config_storage.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// two slots of two pages, like the 1KB pages of an F1
+#define TEST_PAGE_SIZE 0x400
+#define TEST_SLOT_SIZE 0x800
+#define TEST_LAYOUT 0x00010203
+
+// sections that are not a whole number of words
+typedef struct testConfig_s {
+    uint8_t system[37];
+    uint8_t trims[6];
+    uint8_t profile[3][201];
+    uint8_t profileIndex;
+} testConfig_t;
+
+#define TEST_SECTION_COUNT 6
+#define TRIMS_INDEX 1
+#define PROFILE_INDEX 2
+
+static const configStorageSection_t sections[TEST_SECTION_COUNT] = {
+    { 0, offsetof(testConfig_t, system) },
+    { 4, offsetof(testConfig_t, trims) },
+    { 12, offsetof(testConfig_t, profile[0]) },
+    { 13, offsetof(testConfig_t, profile[1]) },
+    { 14, offsetof(testConfig_t, profile[2]) },
+    { 15, offsetof(testConfig_t, profileIndex) },
+};
+
+/*
+ * Emulated flash, a word is programmed as two half words like on the STM32. A half word can only be programmed when
+ * it is erased. The power can be cut after a number of operations, the operation it is cut in is left half done and
+ * all later ones fail.
+ */
+static uint8_t flash[CONFIG_STORAGE_SLOT_COUNT * TEST_SLOT_SIZE] __attribute__((aligned(4)));
+static int32_t operationsUntilPowerLoss;
+static bool powerLost;
+static uint32_t eraseCount;
+static uint32_t programCount;
+static bool programFails;
+
+static configStorage_t storage;
+static testConfig_t config;
+
+static bool cutPower(void)
+{
+    if (powerLost) {
+        return true;
+    }
+
+    if (operationsUntilPowerLoss > 0 && --operationsUntilPowerLoss == 0) {
+        powerLost = true;
+    }
+    return false;
+}
+
+void FLASH_Unlock(void) {}
+void FLASH_Lock(void) {}
+
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress)
+{
+    uintptr_t offset = pageAddress - (uintptr_t)flash;
+
+    if (offset % TEST_PAGE_SIZE || offset >= sizeof(flash) || cutPower()) {
+        return FLASH_TIMEOUT;
+    }
+
+    eraseCount++;
+    memset(&flash[offset], 0xFF, powerLost ? TEST_PAGE_SIZE / 2 : TEST_PAGE_SIZE);
+    return FLASH_COMPLETE;
+}
+
+static bool programHalfWord(uintptr_t offset, uint16_t data)
+{
+    uint16_t *halfWord = (uint16_t *)&flash[offset];
+
+    if (*halfWord != 0xFFFF) {
+        return false;
+    }
+    *halfWord = data;
+    return true;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data)
+{
+    uintptr_t offset = address - (uintptr_t)flash;
+
+    if (offset % 4 || offset >= sizeof(flash) || cutPower()) {
+        return FLASH_TIMEOUT;
+    }
+
+    programCount++;
+    if (programFails) {
+        return FLASH_ERROR_PG;
+    }
+    if (!programHalfWord(offset, data & 0xFFFF)) {
+        return FLASH_ERROR_PG;
+    }
+    if (powerLost) {
+        return FLASH_TIMEOUT;
+    }
+    if (!programHalfWord(offset + 2, data >> 16)) {
+        return FLASH_ERROR_PG;
+    }
+    return FLASH_COMPLETE;
+}
+
+static void fillConfig(testConfig_t *testConfig, uint8_t seed)
+{
+    uint8_t *data = (uint8_t *)testConfig;
+
+    for (unsigned index = 0; index < sizeof(*testConfig); index++) {
+        data[index] = seed + index * 7;
+    }
+}
+
+static void initStorage(uint32_t layout = TEST_LAYOUT)
+{
+    configStorageInit(&storage, (uintptr_t)flash, TEST_SLOT_SIZE, TEST_PAGE_SIZE, layout, sections, TEST_SECTION_COUNT,
+            sizeof(testConfig_t));
+}
+
+static void resetFlash(void)
+{
+    memset(flash, 0xFF, sizeof(flash));
+    operationsUntilPowerLoss = 0;
+    powerLost = false;
+    eraseCount = 0;
+    programCount = 0;
+    programFails = false;
+
+    fillConfig(&config, 1);
+
+    initStorage();
+}
+
+// runs the save like the config task, returns the number of steps
+static uint32_t save(bool eraseAllowed = true, uint32_t maxSteps = UINT32_MAX)
+{
+    uint32_t steps = 0;
+
+    configStorageStartSave(&storage, &config);
+    while (configStorageIsSaving(&storage) && !powerLost && steps < maxSteps) {
+        configStorageProcess(&storage, eraseAllowed);
+        steps++;
+    }
+    return steps;
+}
+
+static void eraseSpare(void)
+{
+    while (!storage.spareErased && !powerLost) {
+        configStorageProcess(&storage, true);
+    }
+}
+
+static bool storedEquals(const testConfig_t *expected)
+{
+    testConfig_t loaded;
+
+    memset(&loaded, 0, sizeof(loaded));
+    configStorageLoad(&storage, &loaded);
+    return configStorageStoredSectionCount(&storage) == TEST_SECTION_COUNT && memcmp(&loaded, expected, sizeof(loaded)) == 0;
+}
+
+// saves changed profiles until the next save has to compact
+static void fillLog(void)
+{
+    int8_t slot = storage.activeSlot;
+    uint32_t available;
+
+    do {
+        config.profile[0][0]++;
+        save();
+        available = TEST_SLOT_SIZE - storage.endOffset;
+    } while (available >= CONFIG_STORAGE_RECORD_HEADER_SIZE + sizeof(config.profile[0]) + 3);
+
+    EXPECT_EQ(slot, storage.activeSlot);
+}
+
+TEST(ConfigStorageTest, TestErasedFlashHoldsNoSections)
+{
+    // given
+    resetFlash();
+
+    // then
+    EXPECT_EQ(0, configStorageStoredSectionCount(&storage));
+    EXPECT_TRUE(storage.spareErased);
+    EXPECT_FALSE(configStorageIsSaving(&storage));
+}
+
+TEST(ConfigStorageTest, TestFirstSaveStoresEverySection)
+{
+    // given
+    resetFlash();
+
+    // when
+    save();
+    initStorage();
+
+    // then
+    EXPECT_TRUE(storedEquals(&config));
+    EXPECT_TRUE(storage.appendable);
+    EXPECT_EQ(CONFIG_STORAGE_IDLE, storage.state);
+}
+
+TEST(ConfigStorageTest, TestSaveAppendsOnlyChangedSections)
+{
+    // given
+    resetFlash();
+    save();
+    int8_t slot = storage.activeSlot;
+    uint32_t endOffset = storage.endOffset;
+    eraseSpare();
+    eraseCount = 0;
+    programCount = 0;
+
+    // when
+    config.trims[5]++;
+    uint32_t steps = save(false);
+
+    // then the record of the trims is two words of data, the CRC and the header
+    EXPECT_EQ(3u, steps);
+    EXPECT_EQ(4u, programCount);
+    EXPECT_EQ(0u, eraseCount);
+    EXPECT_EQ(endOffset + 16, storage.endOffset);
+
+    // and
+    initStorage();
+    EXPECT_EQ(slot, storage.activeSlot);
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestUnchangedSaveWritesNothing)
+{
+    // given
+    resetFlash();
+    save();
+    programCount = 0;
+
+    // when
+    save();
+
+    // then
+    EXPECT_EQ(0u, programCount);
+    EXPECT_FALSE(configStorageIsSaving(&storage));
+}
+
+TEST(ConfigStorageTest, TestFullLogIsCompactedIntoTheOtherSlot)
+{
+    // given
+    resetFlash();
+    save();
+    int8_t slot = storage.activeSlot;
+    fillLog();
+
+    // when
+    config.profile[0][0]++;
+    save();
+    eraseSpare();
+
+    // then
+    EXPECT_NE(slot, storage.activeSlot);
+    EXPECT_EQ(2, storage.sequence);
+    EXPECT_TRUE(storedEquals(&config));
+
+    // and
+    initStorage();
+    EXPECT_NE(slot, storage.activeSlot);
+    EXPECT_TRUE(storedEquals(&config));
+    EXPECT_TRUE(storage.appendable);
+}
+
+TEST(ConfigStorageTest, TestAppendsSaveErases)
+{
+    // given
+    resetFlash();
+    save();
+
+    // when
+    for (int count = 0; count < 120; count++) {
+        config.trims[count % 6]++;
+        save();
+    }
+
+    // then the log was compacted once, erasing the two pages of a slot
+    EXPECT_EQ(2u, eraseCount);
+    initStorage();
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestSequenceWrapsAround)
+{
+    // given
+    resetFlash();
+    save();
+    storage.sequence = 0xFFFE;
+    fillLog();
+    config.profile[0][0]++;
+    save();
+    EXPECT_EQ(0xFFFF, storage.sequence);
+
+    // when
+    fillLog();
+    config.profile[0][0]++;
+    save();
+    initStorage();
+
+    // then
+    EXPECT_EQ(1, storage.sequence);
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestEraseWaitsUntilAllowed)
+{
+    // given
+    resetFlash();
+    save();
+    fillLog();
+    testConfig_t stored = config;
+    eraseCount = 0;
+
+    // when
+    config.profile[0][0]++;
+    save(false, 100);
+
+    // then
+    EXPECT_EQ(CONFIG_STORAGE_ERASING, storage.state);
+    EXPECT_EQ(0u, eraseCount);
+    EXPECT_TRUE(storedEquals(&stored));
+
+    // when
+    save();
+
+    // then
+    EXPECT_EQ((uint32_t)(TEST_SLOT_SIZE / TEST_PAGE_SIZE), eraseCount);
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestSectionChangedDuringSaveIsWrittenAgain)
+{
+    // given
+    resetFlash();
+    save();
+
+    // when
+    config.profile[1][0]++;
+    configStorageStartSave(&storage, &config);
+    for (int step = 0; step < 10; step++) {
+        configStorageProcess(&storage, true);
+    }
+    config.profile[1][1]++;
+    while (configStorageIsSaving(&storage)) {
+        configStorageProcess(&storage, true);
+    }
+
+    // then
+    EXPECT_TRUE(storedEquals(&config));
+    initStorage();
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestProgramErrorFailsAfterRetries)
+{
+    // given
+    resetFlash();
+    save();
+    testConfig_t stored = config;
+    programFails = true;
+
+    // when the append fails and so do the compactions it is retried with
+    config.trims[0]++;
+    save();
+
+    // then
+    EXPECT_EQ(CONFIG_STORAGE_FAILED, storage.state);
+    EXPECT_FALSE(configStorageIsSaving(&storage));
+    initStorage();
+    EXPECT_TRUE(storedEquals(&stored));
+
+    // and the next save starts over
+    programFails = false;
+    save();
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestDamagedRecordFallsBackToThePreviousOne)
+{
+    // given
+    resetFlash();
+    save();
+    testConfig_t previous = config;
+    config.profile[0][10]++;
+    config.trims[0]++;
+    save();
+
+    // when
+    uint8_t *profile = (uint8_t *)storage.stored[PROFILE_INDEX];
+    profile[100] ^= 0x10;
+    initStorage();
+
+    // then the profile is the previous one, the trims of the same save are kept
+    previous.trims[0] = config.trims[0];
+    EXPECT_TRUE(storedEquals(&previous));
+    EXPECT_TRUE(storage.appendable);
+}
+
+TEST(ConfigStorageTest, TestSectionWithoutIntactRecordIsMissing)
+{
+    // given
+    resetFlash();
+    save();
+
+    // when the only record of the trims is damaged
+    uint8_t *trims = (uint8_t *)storage.stored[TRIMS_INDEX];
+    trims[2] ^= 0x01;
+    initStorage();
+
+    // then the other sections are loaded
+    testConfig_t loaded;
+    memset(&loaded, 0, sizeof(loaded));
+    configStorageLoad(&storage, &loaded);
+    EXPECT_EQ(TEST_SECTION_COUNT - 1, configStorageStoredSectionCount(&storage));
+    EXPECT_EQ(NULL, storage.stored[TRIMS_INDEX]);
+    EXPECT_EQ(0, memcmp(loaded.system, config.system, sizeof(config.system)));
+    EXPECT_EQ(0, memcmp(loaded.profile, config.profile, sizeof(config.profile)));
+    EXPECT_EQ(0, loaded.trims[2]);
+
+    // and saving the reset section stores it again
+    memset(config.trims, 0, sizeof(config.trims));
+    save();
+    initStorage();
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestDamagedHeaderEndsTheLog)
+{
+    // given
+    resetFlash();
+    save();
+    testConfig_t previous = config;
+    config.trims[0]++;
+    save();
+    config.profile[2][0]++;
+    save();
+
+    // when the size of the trims record is damaged, the records after it can not be found
+    uint8_t *header = (uint8_t *)storage.stored[TRIMS_INDEX] - CONFIG_STORAGE_RECORD_HEADER_SIZE;
+    header[3] = 0x40;
+    initStorage();
+
+    // then
+    EXPECT_TRUE(storedEquals(&previous));
+    EXPECT_FALSE(storage.appendable);
+
+    // and the next save compacts the log
+    int8_t slot = storage.activeSlot;
+    save();
+    initStorage();
+    EXPECT_NE(slot, storage.activeSlot);
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+TEST(ConfigStorageTest, TestSlotOfAnotherLayoutHoldsNoSections)
+{
+    // given
+    resetFlash();
+    save();
+
+    // when
+    initStorage(TEST_LAYOUT + 1);
+
+    // then
+    EXPECT_EQ(0, configStorageStoredSectionCount(&storage));
+    EXPECT_FALSE(storage.appendable);
+
+    // and the first save writes every section
+    save();
+    initStorage(TEST_LAYOUT + 1);
+    EXPECT_TRUE(storedEquals(&config));
+}
+
+static void checkPowerLossAtEveryOperation(void (*prepare)(void), void (*change)(void))
+{
+    // given
+    resetFlash();
+    prepare();
+    uint32_t operationsBefore = eraseCount + programCount;
+    change();
+    save();
+    eraseSpare();
+    uint32_t operations = eraseCount + programCount - operationsBefore;
+
+    for (uint32_t operation = 1; operation <= operations; operation++) {
+        resetFlash();
+        prepare();
+        testConfig_t previous = config;
+        change();
+        testConfig_t changed = config;
+
+        // when
+        operationsUntilPowerLoss = operation;
+        save();
+        eraseSpare();
+        powerLost = false;
+        operationsUntilPowerLoss = 0;
+        initStorage();
+
+        // then
+        EXPECT_TRUE(storedEquals(&previous) || storedEquals(&changed)) << "power lost at operation " << operation;
+
+        // and the storage recovers
+        save();
+        initStorage();
+        EXPECT_TRUE(storedEquals(&changed)) << "power lost at operation " << operation;
+    }
+}
+
+static void saveOnce(void)
+{
+    save();
+}
+
+static void saveAndFillLog(void)
+{
+    save();
+    fillLog();
+}
+
+static void changeTwoSections(void)
+{
+    config.trims[1]++;
+    config.profile[1][7]++;
+}
+
+TEST(ConfigStorageTest, TestPowerLossDuringAppendKeepsWholeSaves)
+{
+    checkPowerLossAtEveryOperation(saveOnce, changeTwoSections);
+}
+
+TEST(ConfigStorageTest, TestPowerLossDuringCompactionKeepsWholeSaves)
+{
+    checkPowerLossAtEveryOperation(saveAndFillLog, changeTwoSections);
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+
+#include "common/crc.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define CRC32_POLYNOMIAL 0x04C11DB7
+
+// bit at a time, as the reference manual describes the CRC unit
+static uint32_t crc32Bitwise(uint32_t crc, const uint32_t *data, uint32_t wordCount)
+{
+    while (wordCount--) {
+        crc ^= *data++;
+        for (int bit = 0; bit < 32; bit++) {
+            crc = crc & 0x80000000 ? (crc << 1) ^ CRC32_POLYNOMIAL : crc << 1;
+        }
+    }
+    return crc;
+}
+
+TEST(CrcTest, TestCrc32Stm32MatchesTheCrcUnit)
+{
+    // given
+    const uint32_t word = 0x12345678;
+
+    // expect the result of CRC_CalcCRC(0x12345678) after CRC_ResetDR()
+    EXPECT_EQ(0xDF8A8A2B, crc32Stm32(CRC32_STM32_INIT, &word, 1));
+}
+
+TEST(CrcTest, TestCrc32Stm32MatchesBitwiseCrc)
+{
+    // given
+    uint32_t data[64];
+    uint32_t value = 1;
+
+    for (unsigned index = 0; index < sizeof(data) / sizeof(data[0]); index++) {
+        value = value * 1103515245 + 12345;
+        data[index] = value;
+    }
+
+    // expect
+    for (uint32_t count = 0; count <= sizeof(data) / sizeof(data[0]); count++) {
+        EXPECT_EQ(crc32Bitwise(CRC32_STM32_INIT, data, count), crc32Stm32(CRC32_STM32_INIT, data, count));
+    }
+}
+
+TEST(CrcTest, TestCrc32Stm32Continues)
+{
+    // given
+    const uint32_t data[] = { 0xFFFFFFFF, 0x00000000, 0xDEADBEEF, 0x01020304 };
+
+    // when
+    uint32_t crc = crc32Stm32(CRC32_STM32_INIT, data, 1);
+    crc = crc32Stm32(crc, &data[1], 3);
+
+    // then
+    EXPECT_EQ(crc32Stm32(CRC32_STM32_INIT, data, 4), crc);
+}
+
+TEST(CrcTest, TestCrc32Stm32DetectsSingleBitErrors)
+{
+    // given
+    uint32_t data[8] = { 0 };
+    uint32_t crc = crc32Stm32(CRC32_STM32_INIT, data, 8);
+
+    // expect
+    for (int bit = 0; bit < 8 * 32; bit++) {
+        data[bit / 32] ^= 1u << (bit % 32);
+        EXPECT_NE(crc, crc32Stm32(CRC32_STM32_INIT, data, 8));
+        data[bit / 32] ^= 1u << (bit % 32);
+    }
+}
@@ -0,0 +1,203 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+#include "common/filter.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_SAMPLE_PERIOD_US 1000     // 1kHz PID loop
+#define TEST_PI 3.14159265358979323846
+
+typedef float (*filterApplyFuncPtr)(void *filter, float input);
+
+static float applyPt1(void *filter, float input)
+{
+    return pt1FilterApply((pt1Filter_t *)filter, input);
+}
+
+static float applyBiquad(void *filter, float input)
+{
+    return biquadFilterApply((biquadFilter_t *)filter, input);
+}
+
+/*
+ * Feeds a unit sine through the filter and returns the peak output once the filter has settled.
+ */
+static float measureGain(filterApplyFuncPtr apply, void *filter, float frequencyHz)
+{
+    const int settleSamples = 2000;
+    const int measureSamples = 2000;
+    float peak = 0.0f;
+
+    for (int i = 0; i < settleSamples + measureSamples; i++) {
+        float input = sin(2.0 * TEST_PI * frequencyHz * i * TEST_SAMPLE_PERIOD_US / 1000000.0);
+        float output = apply(filter, input);
+        if (i >= settleSamples && fabsf(output) > peak) {
+            peak = fabsf(output);
+        }
+    }
+    return peak;
+}
+
+TEST(FilterUnittest, Pt1PassesDcAndIsThreeDbDownAtCutoff)
+{
+    // given
+    pt1Filter_t filter;
+    pt1FilterInit(&filter, 50, TEST_SAMPLE_PERIOD_US);
+
+    // when
+    float output = 0.0f;
+    for (int i = 0; i < 1000; i++) {
+        output = pt1FilterApply(&filter, 100.0f);
+    }
+
+    // then
+    EXPECT_NEAR(100.0f, output, 0.01f);
+
+    // and - the discretised RC filter ends up slightly below -3dB at the cutoff
+    pt1FilterInit(&filter, 50, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(0.707f, measureGain(applyPt1, &filter, 50), 0.06f);
+
+    pt1FilterInit(&filter, 50, TEST_SAMPLE_PERIOD_US);
+    EXPECT_LT(measureGain(applyPt1, &filter, 400), 0.2f);
+}
+
+TEST(FilterUnittest, BiquadLowPassFrequencyResponse)
+{
+    // given
+    biquadFilter_t filter;
+
+    // then - flat pass band
+    biquadFilterInitLPF(&filter, 100, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(1.0f, measureGain(applyBiquad, &filter, 10), 0.01f);
+
+    // and - butterworth, -3dB at the cutoff
+    biquadFilterInitLPF(&filter, 100, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(0.707f, measureGain(applyBiquad, &filter, 100), 0.02f);
+
+    // and - second order roll off, at least -12dB one octave above the cutoff
+    biquadFilterInitLPF(&filter, 100, TEST_SAMPLE_PERIOD_US);
+    EXPECT_LT(measureGain(applyBiquad, &filter, 200), 0.25f);
+
+    biquadFilterInitLPF(&filter, 100, TEST_SAMPLE_PERIOD_US);
+    EXPECT_LT(measureGain(applyBiquad, &filter, 400), 0.05f);
+}
+
+TEST(FilterUnittest, BiquadNotchRemovesCenterFrequencyOnly)
+{
+    // given
+    biquadFilter_t filter;
+
+    // then
+    biquadFilterInitNotch(&filter, 200, 150, TEST_SAMPLE_PERIOD_US);
+    EXPECT_LT(measureGain(applyBiquad, &filter, 200), 0.01f);
+
+    // and - about -3dB at the lower cutoff, frequency warping narrows the notch a little this close to nyquist
+    biquadFilterInitNotch(&filter, 200, 150, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(0.707f, measureGain(applyBiquad, &filter, 150), 0.08f);
+
+    // and - the rest of the spectrum passes
+    biquadFilterInitNotch(&filter, 200, 150, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(1.0f, measureGain(applyBiquad, &filter, 20), 0.02f);
+
+    biquadFilterInitNotch(&filter, 200, 150, TEST_SAMPLE_PERIOD_US);
+    EXPECT_NEAR(1.0f, measureGain(applyBiquad, &filter, 450), 0.05f);
+}
+
+TEST(FilterUnittest, UnusableCutoffsPassSamplesThrough)
+{
+    // given
+    biquadFilter_t lowPass;
+    biquadFilter_t notch;
+    pt1Filter_t pt1;
+
+    // when - disabled, above nyquist, unknown sample period and a notch without a valid cutoff
+    biquadFilterInitLPF(&lowPass, 0, TEST_SAMPLE_PERIOD_US);
+    pt1FilterInit(&pt1, 600, TEST_SAMPLE_PERIOD_US);
+    biquadFilterInitNotch(&notch, 200, 250, TEST_SAMPLE_PERIOD_US);
+
+    // then
+    EXPECT_EQ(123.0f, biquadFilterApply(&lowPass, 123.0f));
+    EXPECT_EQ(-45.0f, biquadFilterApply(&lowPass, -45.0f));
+    EXPECT_EQ(123.0f, pt1FilterApply(&pt1, 123.0f));
+    EXPECT_EQ(123.0f, biquadFilterApply(&notch, 123.0f));
+
+    // when
+    biquadFilterInitLPF(&lowPass, 100, 0);
+
+    // then
+    EXPECT_EQ(77.0f, biquadFilterApply(&lowPass, 77.0f));
+}
+
+TEST(FilterUnittest, FixedBiquadTracksFloatBiquad)
+{
+    // given
+    biquadFilter_t filter;
+    biquadFilterFixed_t fixedFilter;
+    biquadFilterInitLPF(&filter, 40, 3500);
+    biquadFilterFixedInitLPF(&fixedFilter, 40, 3500);
+
+    // then - same coefficients, the fixed point state only loses bits below 2^-30 of a unit
+    EXPECT_EQ(lrintf(filter.b0 * (1 << BIQUAD_FIXED_FRACTION_BITS)), fixedFilter.b0);
+    EXPECT_EQ(lrintf(filter.a2 * (1 << BIQUAD_FIXED_FRACTION_BITS)), fixedFilter.a2);
+
+    for (int i = 0; i < 2000; i++) {
+        int32_t input = (i * 7919) % 2001 - 1000;
+        float expected = biquadFilterApply(&filter, input);
+        double output = (double)biquadFilterFixedApply(&fixedFilter, input) / (1 << BIQUAD_FIXED_FRACTION_BITS);
+
+        EXPECT_NEAR(expected, output, 0.001);
+    }
+}
+
+TEST(FilterUnittest, FixedBiquadUnusableCutoffPassesSamplesThrough)
+{
+    // given
+    biquadFilterFixed_t filter;
+
+    // when
+    biquadFilterFixedInitLPF(&filter, 0, TEST_SAMPLE_PERIOD_US);
+
+    // then
+    EXPECT_EQ((int64_t)123 << BIQUAD_FIXED_FRACTION_BITS, biquadFilterFixedApply(&filter, 123));
+    EXPECT_EQ(-((int64_t)45 << BIQUAD_FIXED_FRACTION_BITS), biquadFilterFixedApply(&filter, -45));
+}
+
+TEST(FilterUnittest, PerSampleCostIsSmall)
+{
+    // given
+    const int sampleCount = 1000000;
+    biquadFilter_t filter;
+    biquadFilterInitLPF(&filter, 100, TEST_SAMPLE_PERIOD_US);
+    volatile float sink = 0.0f;
+
+    // when
+    clock_t startedAt = clock();
+    for (int i = 0; i < sampleCount; i++) {
+        sink = biquadFilterApply(&filter, (float)(i & 0xFF));
+    }
+    double nanosecondsPerSample = (double)(clock() - startedAt) * 1e9 / CLOCKS_PER_SEC / sampleCount;
+
+    // then - five multiplies and four adds, generous bound to stay stable on a loaded host
+    EXPECT_LT(nanosecondsPerSample, 200.0);
+    UNUSED(sink);
+}
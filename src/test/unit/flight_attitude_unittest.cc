@@ -0,0 +1,300 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+#include <limits.h>
+
+#include "common/axis.h"
+#include "flight/flight.h"
+
+#include "sensors/sensors.h"
+#include "drivers/accgyro.h"
+#include "sensors/gyro.h"
+#include "sensors/acceleration.h"
+
+#include "config/runtime_config.h"
+
+#include "flight/mixer.h"
+#include "flight/mahony.h"
+#include "flight/imu.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_PI 3.14159265358979323846f
+#define TEST_DEG2RAD(degrees) ((degrees) * TEST_PI / 180.0f)
+#define TEST_RAD2DEG(radians) ((radians) * 180.0f / TEST_PI)
+
+#define TEST_LOOPTIME 1000
+#define TEST_ACC_1G 512
+#define TEST_GYRO_SCALE (1.0f / 16.4f)  // MPU6050 at 2000 deg/s
+
+extern float rMat[3][3];
+extern float anglerad[2];
+extern int16_t gyroADC[XYZ_AXIS_COUNT];
+extern int16_t accADC[XYZ_AXIS_COUNT];
+
+void imuInit(void);
+
+// fake sensors, the stubs below feed these into computeIMU()
+
+static uint32_t simulatedTime = 0;
+static int16_t fakeGyro[XYZ_AXIS_COUNT];
+static int16_t fakeAcc[XYZ_AXIS_COUNT];
+static bool haveMag = false;
+
+static void accForAttitude(float rollDegrees, float pitchDegrees)
+{
+    // earth z axis (gravity as seen by the accelerometer) in body coordinates
+    float roll = TEST_DEG2RAD(rollDegrees);
+    float pitch = TEST_DEG2RAD(pitchDegrees);
+    fakeAcc[X] = lrintf(-sinf(pitch) * TEST_ACC_1G);
+    fakeAcc[Y] = lrintf(cosf(pitch) * sinf(roll) * TEST_ACC_1G);
+    fakeAcc[Z] = lrintf(cosf(pitch) * cosf(roll) * TEST_ACC_1G);
+}
+
+static imuRuntimeConfig_t testImuRuntimeConfig;
+static pidProfile_t testPidProfile;
+static accDeadband_t testAccDeadband;
+static rollAndPitchTrims_t testTrims;
+
+static void resetImu(attitudeEstimator_e estimator)
+{
+    memset(&testImuRuntimeConfig, 0, sizeof(testImuRuntimeConfig));
+    testImuRuntimeConfig.gyro_cmpf_factor = 600;
+    testImuRuntimeConfig.gyro_cmpfm_factor = 250;
+    testImuRuntimeConfig.small_angle = 25;
+    testImuRuntimeConfig.attitude_estimator = estimator;
+    testImuRuntimeConfig.dcm_kp = 0.25f;
+    testImuRuntimeConfig.dcm_ki = 0.005f;
+
+    simulatedTime = 0;
+    memset(fakeGyro, 0, sizeof(fakeGyro));
+    memset(fakeAcc, 0, sizeof(fakeAcc));
+    haveMag = false;
+
+    acc_1G = TEST_ACC_1G;
+    gyro.scale = TEST_GYRO_SCALE;
+    configureImu(&testImuRuntimeConfig, &testPidProfile, &testAccDeadband);
+    imuInit();
+}
+
+static void runImu(uint32_t loops)
+{
+    while (loops--) {
+        simulatedTime += TEST_LOOPTIME;
+        computeIMU(&testTrims, MULTITYPE_QUADX);
+    }
+}
+
+TEST(FlightAttitudeTest, MahonyConvergesOnAccelerometerAttitude)
+{
+    // given
+    mahonyEstimator_t estimator;
+    mahonyReset(&estimator);
+    float gyro[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, 0.0f };
+    float acc[XYZ_AXIS_COUNT] = { 0.0f, sinf(TEST_DEG2RAD(20)), cosf(TEST_DEG2RAD(20)) };
+
+    // when - 10 seconds at 1kHz with a strong correction gain
+    for (int i = 0; i < 10000; i++) {
+        mahonyUpdate(&estimator, 0.001f, 1.0f, 0.0f, gyro, acc, NULL);
+    }
+
+    // then
+    EXPECT_NEAR(20.0f, TEST_RAD2DEG(mahonyGetRoll(&estimator)), 0.1f);
+    EXPECT_NEAR(0.0f, TEST_RAD2DEG(mahonyGetPitch(&estimator)), 0.1f);
+}
+
+TEST(FlightAttitudeTest, MahonyIntegratesGyroWithoutCorrection)
+{
+    // given
+    mahonyEstimator_t estimator;
+    mahonyReset(&estimator);
+    float gyro[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, TEST_DEG2RAD(90) };
+
+    // when - one second of yaw at 90 deg/s
+    for (int i = 0; i < 1000; i++) {
+        mahonyUpdate(&estimator, 0.001f, 0.25f, 0.0f, gyro, NULL, NULL);
+    }
+
+    // then
+    EXPECT_NEAR(90.0f, TEST_RAD2DEG(mahonyGetYaw(&estimator)), 0.1f);
+    EXPECT_NEAR(0.0f, TEST_RAD2DEG(mahonyGetRoll(&estimator)), 0.01f);
+    EXPECT_NEAR(0.0f, TEST_RAD2DEG(mahonyGetPitch(&estimator)), 0.01f);
+}
+
+TEST(FlightAttitudeTest, MahonyIntegralCancelsGyroBias)
+{
+    // given - level, but the gyro reports 2 deg/s of roll
+    mahonyEstimator_t estimator;
+    mahonyReset(&estimator);
+    float gyro[XYZ_AXIS_COUNT] = { TEST_DEG2RAD(2), 0.0f, 0.0f };
+    float acc[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, 1.0f };
+
+    // when
+    for (int i = 0; i < 60000; i++) {
+        mahonyUpdate(&estimator, 0.001f, 0.25f, 0.05f, gyro, acc, NULL);
+    }
+
+    // then - the integral has learned the bias and the estimate has no standing error left
+    EXPECT_NEAR(-TEST_DEG2RAD(2), estimator.integralX, TEST_DEG2RAD(0.05f));
+    EXPECT_NEAR(0.0f, TEST_RAD2DEG(mahonyGetRoll(&estimator)), 0.1f);
+}
+
+TEST(FlightAttitudeTest, MahonyYawFollowsMagnetometer)
+{
+    // given - level, magnetic north 30 degrees counter clockwise of the nose, dipping down
+    mahonyEstimator_t estimator;
+    mahonyReset(&estimator);
+    float gyro[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, 0.0f };
+    float acc[XYZ_AXIS_COUNT] = { 0.0f, 0.0f, 1.0f };
+    float mag[XYZ_AXIS_COUNT] = { cosf(TEST_DEG2RAD(30)), sinf(TEST_DEG2RAD(30)), -1.0f };
+
+    // when
+    for (int i = 0; i < 20000; i++) {
+        mahonyUpdate(&estimator, 0.001f, 1.0f, 0.0f, gyro, acc, mag);
+    }
+
+    // then - the nose points 30 degrees clockwise of north
+    EXPECT_NEAR(-30.0f, TEST_RAD2DEG(mahonyGetYaw(&estimator)), 0.5f);
+    EXPECT_NEAR(0.0f, TEST_RAD2DEG(mahonyGetRoll(&estimator)), 0.1f);
+}
+
+TEST(FlightAttitudeTest, MahonyRotationMatrixStaysOrthonormal)
+{
+    // given
+    mahonyEstimator_t estimator;
+    mahonyReset(&estimator);
+    float gyro[XYZ_AXIS_COUNT] = { TEST_DEG2RAD(400), TEST_DEG2RAD(-250), TEST_DEG2RAD(130) };
+
+    // when - tumble for 10 seconds
+    for (int i = 0; i < 10000; i++) {
+        mahonyUpdate(&estimator, 0.001f, 0.25f, 0.0f, gyro, NULL, NULL);
+    }
+
+    // then
+    for (int row = 0; row < 3; row++) {
+        for (int column = 0; column < 3; column++) {
+            float dot = 0.0f;
+            for (int i = 0; i < 3; i++) {
+                dot += estimator.rMat[row][i] * estimator.rMat[column][i];
+            }
+            EXPECT_NEAR(row == column ? 1.0f : 0.0f, dot, 0.0001f);
+        }
+    }
+}
+
+TEST(FlightAttitudeTest, BothEstimatorsAgreeOnStaticAttitude)
+{
+    float roll[ATTITUDE_ESTIMATOR_COUNT];
+    float pitch[ATTITUDE_ESTIMATOR_COUNT];
+
+    for (int estimator = 0; estimator < ATTITUDE_ESTIMATOR_COUNT; estimator++) {
+        // given
+        resetImu((attitudeEstimator_e)estimator);
+        testImuRuntimeConfig.dcm_kp = 2.0f;
+        accForAttitude(15, -10);
+
+        // when
+        runImu(20000);
+
+        // then
+        roll[estimator] = TEST_RAD2DEG(anglerad[AI_ROLL]);
+        pitch[estimator] = TEST_RAD2DEG(anglerad[AI_PITCH]);
+        EXPECT_NEAR(15.0f, roll[estimator], 0.5f);
+        EXPECT_NEAR(-10.0f, pitch[estimator], 0.5f);
+
+        // and - rMat maps the measured gravity onto the earth z axis
+        float earthZ = rMat[2][X] * fakeAcc[X] + rMat[2][Y] * fakeAcc[Y] + rMat[2][Z] * fakeAcc[Z];
+        EXPECT_NEAR(TEST_ACC_1G, earthZ, TEST_ACC_1G * 0.01f);
+        EXPECT_TRUE(STATE(SMALL_ANGLE));
+    }
+}
+
+TEST(FlightAttitudeTest, QuaternionEstimatorIsCheaperThanComplementaryFilter)
+{
+    const uint32_t loops = 200000;
+    double nanosecondsPerLoop[ATTITUDE_ESTIMATOR_COUNT];
+
+    for (int estimator = 0; estimator < ATTITUDE_ESTIMATOR_COUNT; estimator++) {
+        // given
+        resetImu((attitudeEstimator_e)estimator);
+        accForAttitude(5, 5);
+        fakeGyro[X] = 30;
+        fakeGyro[Y] = -20;
+        fakeGyro[Z] = 10;
+        haveMag = true;
+
+        // when
+        clock_t startedAt = clock();
+        runImu(loops);
+        nanosecondsPerLoop[estimator] = (double)(clock() - startedAt) * 1e9 / CLOCKS_PER_SEC / loops;
+    }
+
+    // then
+    printf("complementary filter: %.0fns/loop, quaternion: %.0fns/loop\n",
+            nanosecondsPerLoop[ATTITUDE_ESTIMATOR_COMPLEMENTARY], nanosecondsPerLoop[ATTITUDE_ESTIMATOR_QUATERNION]);
+    EXPECT_LT(nanosecondsPerLoop[ATTITUDE_ESTIMATOR_QUATERNION], nanosecondsPerLoop[ATTITUDE_ESTIMATOR_COMPLEMENTARY]);
+}
+
+// STUBS
+
+uint16_t acc_1G;
+int16_t heading;
+gyro_t gyro;
+int16_t magADC[XYZ_AXIS_COUNT];
+int32_t BaroAlt;
+int16_t debug[4];
+uint32_t targetPidLooptime = TEST_LOOPTIME;
+
+uint8_t stateFlags;
+uint16_t flightModeFlags;
+uint8_t armingFlags;
+
+int32_t sonarAlt;
+
+void gyroGetADC(void)
+{
+    memcpy(gyroADC, fakeGyro, sizeof(gyroADC));
+}
+
+bool sensors(uint32_t mask)
+{
+    if (mask == SENSOR_MAG) {
+        if (haveMag) {
+            magADC[X] = 200;
+            magADC[Y] = -50;
+            magADC[Z] = -400;
+        }
+        return haveMag;
+    }
+    return mask == SENSOR_ACC;
+}
+
+void updateAccelerationReadings(rollAndPitchTrims_t *rollAndPitchTrims)
+{
+    UNUSED(rollAndPitchTrims);
+    memcpy(accADC, fakeAcc, sizeof(accADC));
+}
+
+uint32_t micros(void) { return simulatedTime; }
+bool isBaroCalibrationComplete(void) { return true; }
+void performBaroCalibrationCycle(void) {}
+int32_t baroCalculateAltitude(void) { return 0; }
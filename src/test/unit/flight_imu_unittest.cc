@@ -88,6 +88,7 @@ gyro_t gyro;
 int16_t magADC[XYZ_AXIS_COUNT];
 int32_t BaroAlt;
 int16_t debug[4];
+uint32_t targetPidLooptime;
 
 uint8_t stateFlags;
 uint16_t flightModeFlags;
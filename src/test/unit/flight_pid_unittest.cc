@@ -0,0 +1,541 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <limits.h>
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#include "build_config.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/filter.h"
+
+#include "config/runtime_config.h"
+
+#include "rx/rx.h"
+#include "drivers/accgyro.h"
+#include "sensors/sensors.h"
+#include "sensors/gyro.h"
+#include "io/rc_controls.h"
+#include "flight/flight.h"
+#include "flight/navigation.h"
+
+
+#define TEST_MAX_ANGLE_INCLINATION 500
+#define TEST_ITERATIONS 4000
+#define TEST_MODE_SWITCH_ITERATIONS 150
+
+#define GYRO_I_MAX 256
+
+typedef void (*pidControllerFuncPtr)(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
+        uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim);
+
+extern pidControllerFuncPtr pid_controller;
+extern uint8_t dynP8[3], dynI8[3], dynD8[3];
+
+uint16_t cycleTime;
+uint32_t targetPidLooptime = 3500;
+
+/*
+ * The controllers as they were before they shared one rate loop and the Baseflight controller computed in fixed
+ * point, the new ones must produce the same output. The Baseflight controller and the D-term filter are evaluated in
+ * double, float rounds differently at every step and would not give one exact answer to compare against. The fixed
+ * point terms are within about 2^-20 of a unit of the exact ones, an output could only round the other way when it
+ * lies that close to a half, none of the test inputs does.
+ */
+int16_t referencePID[3];
+
+static int32_t referenceErrorGyroI[3] = { 0, 0, 0 };
+static double referenceErrorGyroIf[3] = { 0.0, 0.0, 0.0 };
+static int32_t referenceErrorAngleI[2] = { 0, 0 };
+
+// the coefficients of the float filter, the state in double
+typedef struct referenceBiquadFilter_s {
+    double b0, b1, b2, a1, a2;
+    double d1, d2;
+} referenceBiquadFilter_t;
+
+static referenceBiquadFilter_t referenceDTermFilter[3];
+static uint8_t referenceDTermFilterCutoff = 0;
+static uint32_t referenceDTermFilterSamplePeriod = 0;
+
+/*
+ * Returns true when the D-term low pass filter replaces the moving average, (re)computes the filter coefficients
+ * when the cutoff or the loop time changed.
+ */
+static bool referenceUpdateDTermFilter(pidProfile_t *pidProfile)
+{
+    int axis;
+
+    if (!pidProfile->dterm_lpf_hz || !targetPidLooptime) {
+        return false;
+    }
+
+    if (referenceDTermFilterCutoff != pidProfile->dterm_lpf_hz || referenceDTermFilterSamplePeriod != targetPidLooptime) {
+        for (axis = 0; axis < 3; axis++) {
+            biquadFilter_t filter;
+
+            biquadFilterInitLPF(&filter, pidProfile->dterm_lpf_hz, targetPidLooptime);
+            referenceDTermFilter[axis].b0 = filter.b0;
+            referenceDTermFilter[axis].b1 = filter.b1;
+            referenceDTermFilter[axis].b2 = filter.b2;
+            referenceDTermFilter[axis].a1 = filter.a1;
+            referenceDTermFilter[axis].a2 = filter.a2;
+            referenceDTermFilter[axis].d1 = 0.0;
+            referenceDTermFilter[axis].d2 = 0.0;
+        }
+        referenceDTermFilterCutoff = pidProfile->dterm_lpf_hz;
+        referenceDTermFilterSamplePeriod = targetPidLooptime;
+    }
+    return true;
+}
+
+static double referenceBiquadFilterApply(referenceBiquadFilter_t *filter, double input)
+{
+    double result = filter->b0 * input + filter->d1;
+
+    filter->d1 = filter->b1 * input - filter->a1 * result + filter->d2;
+    filter->d2 = filter->b2 * input - filter->a2 * result;
+    return result;
+}
+
+static void referenceBaseflight(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
+        uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim)
+{
+    double RateError, errorAngle, AngleRate, gyroRate;
+    double ITerm,PTerm,DTerm;
+    static double lastGyroRate[3];
+    static double delta1[3], delta2[3];
+    double delta, deltaSum;
+    double dT;
+    int axis;
+    bool useDTermFilter = referenceUpdateDTermFilter(pidProfile);
+
+    dT = cycleTime * 0.000001;
+
+    // ----------PID controller----------
+    for (axis = 0; axis < 3; axis++) {
+        // -----Get the desired angle rate depending on flight mode
+        if (axis == FD_YAW) {
+            // YAW is always gyro-controlled (MAG correction is applied to rcCommand) 100dps to 1100dps max yaw rate
+            AngleRate = (controlRateConfig->yawRate + 10) * rcCommand[YAW] / 50.0;
+         } else {
+            // calculate error and limit the angle to the max inclination
+            errorAngle = (constrain(rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
+                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]) / 10.0; // 16 bits is ok here
+
+            if (FLIGHT_MODE(ANGLE_MODE)) {
+                // it's the ANGLE mode - control is angle based, so control loop is needed
+                AngleRate = errorAngle * pidProfile->A_level;
+            } else {
+                //control is GYRO based (ACRO and HORIZON - direct sticks control is applied to rate PID
+                AngleRate = (controlRateConfig->rollPitchRate + 20) * rcCommand[axis] / 50.0; // 200dps to 1200dps max yaw rate
+                if (FLIGHT_MODE(HORIZON_MODE)) {
+                    // mix up angle error to desired AngleRate to add a little auto-level feel
+                    AngleRate += errorAngle * pidProfile->H_level;
+                }
+            }
+        }
+
+        gyroRate = gyroData[axis] * (double)gyro.scale; // gyro output scaled to dps
+
+        // --------low-level gyro-based PID. ----------
+        // Used in stand-alone mode for ACRO, controlled by higher level regulators in other modes
+        // -----calculate scaled error.AngleRates
+        // multiplication of rcCommand corresponds to changing the sticks scaling here
+        RateError = AngleRate - gyroRate;
+
+        // -----calculate P component
+        PTerm = RateError * pidProfile->P_f[axis];
+        // -----calculate I component
+        referenceErrorGyroIf[axis] = referenceErrorGyroIf[axis] + RateError * dT * pidProfile->I_f[axis];
+        referenceErrorGyroIf[axis] = referenceErrorGyroIf[axis] < -250.0 ? -250.0 :
+                (referenceErrorGyroIf[axis] > 250.0 ? 250.0 : referenceErrorGyroIf[axis]);
+
+        // limit maximum integrator value to prevent WindUp - accumulating extreme values when system is saturated.
+        // I coefficient (I8) moved before integration to make limiting independent from PID settings
+        ITerm = referenceErrorGyroIf[axis];
+
+        //-----calculate D-term
+        delta = gyroRate - lastGyroRate[axis];  // 16 bits is ok here, the dif between 2 consecutive gyro reads is limited to 800
+        lastGyroRate[axis] = gyroRate;
+
+        // Correct difference by cycle time. Cycle time is jittery (can be different 2 times), so calculated difference
+        // would be scaled by different dt each time. Division by dT fixes that.
+        delta /= dT;
+        if (useDTermFilter) {
+            delta = referenceBiquadFilterApply(&referenceDTermFilter[axis], delta);
+        } else {
+            // add moving average here to reduce noise
+            deltaSum = delta1[axis] + delta2[axis] + delta;
+            delta2[axis] = delta1[axis];
+            delta1[axis] = delta;
+            delta = deltaSum / 3.0;
+        }
+        DTerm = delta * pidProfile->D_f[axis];
+        DTerm = DTerm < -300.0 ? -300.0 : (DTerm > 300.0 ? 300.0 : DTerm);
+
+        // -----calculate total PID output
+        referencePID[axis] = constrain(lround(PTerm + ITerm - DTerm), -1000, 1000);
+    }
+}
+
+static void referenceMultiWii(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig,
+        uint16_t max_angle_inclination, rollAndPitchTrims_t *angleTrim)
+{
+    int axis, prop;
+    int32_t error, errorAngle;
+    int32_t PTerm, ITerm, PTermACC = 0, ITermACC = 0, PTermGYRO = 0, ITermGYRO = 0, DTerm;
+    static int16_t lastGyro[3] = { 0, 0, 0 };
+    static int32_t delta1[3], delta2[3];
+    int32_t deltaSum;
+    int32_t delta;
+    bool useDTermFilter = referenceUpdateDTermFilter(pidProfile);
+
+    UNUSED(controlRateConfig);
+
+    // **** PITCH & ROLL & YAW PID ****
+    prop = max(abs(rcCommand[PITCH]), abs(rcCommand[ROLL])); // range [0;500]
+    for (axis = 0; axis < 3; axis++) {
+        if ((FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE)) && (axis == FD_ROLL || axis == FD_PITCH)) { // MODE relying on ACC
+            // observe max inclination
+            errorAngle = constrain(2 * rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
+                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis];
+
+            PTermACC = errorAngle * pidProfile->P8[PIDLEVEL] / 100; // 32 bits is needed for calculation: errorAngle*P8[PIDLEVEL] could exceed 32768   16 bits is ok for result
+            PTermACC = constrain(PTermACC, -pidProfile->D8[PIDLEVEL] * 5, +pidProfile->D8[PIDLEVEL] * 5);
+
+            referenceErrorAngleI[axis] = constrain(referenceErrorAngleI[axis] + errorAngle, -10000, +10000); // WindUp
+            ITermACC = (referenceErrorAngleI[axis] * pidProfile->I8[PIDLEVEL]) >> 12;
+        }
+        if (!FLIGHT_MODE(ANGLE_MODE) || FLIGHT_MODE(HORIZON_MODE) || axis == FD_YAW) { // MODE relying on GYRO or YAW axis
+            error = (int32_t) rcCommand[axis] * 10 * 8 / pidProfile->P8[axis];
+            error -= gyroData[axis] / 4;
+
+            PTermGYRO = rcCommand[axis];
+
+            referenceErrorGyroI[axis] = constrain(referenceErrorGyroI[axis] + error, -16000, +16000); // WindUp
+            if ((abs(gyroData[axis]) > (640 * 4)) || (axis == FD_YAW && abs(rcCommand[axis]) > 100))
+                referenceErrorGyroI[axis] = 0;
+
+            ITermGYRO = (referenceErrorGyroI[axis] / 125 * pidProfile->I8[axis]) / 64;
+        }
+        if (FLIGHT_MODE(HORIZON_MODE) && (axis == FD_ROLL || axis == FD_PITCH)) {
+            PTerm = (PTermACC * (500 - prop) + PTermGYRO * prop) / 500;
+            ITerm = (ITermACC * (500 - prop) + ITermGYRO * prop) / 500;
+        } else {
+            if (FLIGHT_MODE(ANGLE_MODE) && (axis == FD_ROLL || axis == FD_PITCH)) {
+                PTerm = PTermACC;
+                ITerm = ITermACC;
+            } else {
+                PTerm = PTermGYRO;
+                ITerm = ITermGYRO;
+            }
+        }
+
+        PTerm -= ((int32_t)gyroData[axis] / 4) * dynP8[axis] / 10 / 8; // 32 bits is needed for calculation
+        delta = (gyroData[axis] - lastGyro[axis]) / 4;
+        lastGyro[axis] = gyroData[axis];
+        if (useDTermFilter) {
+            // the D gains are tuned against the sum of three samples
+            deltaSum = lround(3.0 * referenceBiquadFilterApply(&referenceDTermFilter[axis], delta));
+        } else {
+            deltaSum = delta1[axis] + delta2[axis] + delta;
+            delta2[axis] = delta1[axis];
+            delta1[axis] = delta;
+        }
+        DTerm = (deltaSum * dynD8[axis]) / 32;
+        referencePID[axis] = PTerm + ITerm - DTerm;
+    }
+}
+
+static void referenceRewrite(pidProfile_t *pidProfile, controlRateConfig_t *controlRateConfig, uint16_t max_angle_inclination,
+        rollAndPitchTrims_t *angleTrim)
+{
+    int32_t errorAngle;
+    int axis;
+    int32_t delta, deltaSum;
+    static int32_t delta1[3], delta2[3];
+    int32_t PTerm, ITerm, DTerm;
+    static int32_t lastError[3] = { 0, 0, 0 };
+    int32_t AngleRateTmp, RateError;
+    bool useDTermFilter = referenceUpdateDTermFilter(pidProfile);
+
+    // ----------PID controller----------
+    for (axis = 0; axis < 3; axis++) {
+        // -----Get the desired angle rate depending on flight mode
+        if (axis == FD_YAW) { // YAW is always gyro-controlled (MAG correction is applied to rcCommand)
+            AngleRateTmp = (((int32_t)(controlRateConfig->yawRate + 27) * rcCommand[YAW]) >> 5);
+        } else {
+            // calculate error and limit the angle to max configured inclination
+            errorAngle = constrain(2 * rcCommand[axis] + GPS_angle[axis], -((int) max_angle_inclination),
+                    +max_angle_inclination) - inclination.raw[axis] + angleTrim->raw[axis]; // 16 bits is ok here
+
+            if (!FLIGHT_MODE(ANGLE_MODE)) { //control is GYRO based (ACRO and HORIZON - direct sticks control is applied to rate PID
+                AngleRateTmp = ((int32_t)(controlRateConfig->rollPitchRate + 27) * rcCommand[axis]) >> 4;
+                if (FLIGHT_MODE(HORIZON_MODE)) {
+                    // mix up angle error to desired AngleRateTmp to add a little auto-level feel
+                    AngleRateTmp += (errorAngle * pidProfile->I8[PIDLEVEL]) >> 8;
+                }
+            } else { // it's the ANGLE mode - control is angle based, so control loop is needed
+                AngleRateTmp = (errorAngle * pidProfile->P8[PIDLEVEL]) >> 4;
+            }
+        }
+
+        // --------low-level gyro-based PID. ----------
+        // Used in stand-alone mode for ACRO, controlled by higher level regulators in other modes
+        // -----calculate scaled error.AngleRates
+        // multiplication of rcCommand corresponds to changing the sticks scaling here
+        RateError = AngleRateTmp - (gyroData[axis] / 4);
+
+        // -----calculate P component
+        PTerm = (RateError * pidProfile->P8[axis]) >> 7;
+        // -----calculate I component
+        // there should be no division before accumulating the error to integrator, because the precision would be reduced.
+        // Precision is critical, as I prevents from long-time drift. Thus, 32 bits integrator is used.
+        // Time correction (to avoid different I scaling for different builds based on average cycle time)
+        // is normalized to cycle time = 2048.
+        referenceErrorGyroI[axis] = referenceErrorGyroI[axis] + ((RateError * cycleTime) >> 11) * pidProfile->I8[axis];
+
+        // limit maximum integrator value to prevent WindUp - accumulating extreme values when system is saturated.
+        // I coefficient (I8) moved before integration to make limiting independent from PID settings
+        referenceErrorGyroI[axis] = constrain(referenceErrorGyroI[axis], -((int32_t)GYRO_I_MAX << 13), (int32_t)GYRO_I_MAX << 13);
+        ITerm = referenceErrorGyroI[axis] >> 13;
+
+        //-----calculate D-term
+        delta = RateError - lastError[axis]; // 16 bits is ok here, the dif between 2 consecutive gyro reads is limited to 800
+        lastError[axis] = RateError;
+
+        // Correct difference by cycle time. Cycle time is jittery (can be different 2 times), so calculated difference
+        // would be scaled by different dt each time. Division by dT fixes that.
+        delta = (delta * ((uint16_t) 0xFFFF / (cycleTime >> 4))) >> 6;
+        if (useDTermFilter) {
+            // the D gains are tuned against the sum of three samples
+            deltaSum = lround(3.0 * referenceBiquadFilterApply(&referenceDTermFilter[axis], delta));
+        } else {
+            // add moving average here to reduce noise
+            deltaSum = delta1[axis] + delta2[axis] + delta;
+            delta2[axis] = delta1[axis];
+            delta1[axis] = delta;
+        }
+        DTerm = (deltaSum * pidProfile->D8[axis]) >> 8;
+
+        // -----calculate total PID output
+        referencePID[axis] = PTerm + ITerm + DTerm;
+    }
+}
+
+static void referenceResetErrors(void)
+{
+    memset(referenceErrorGyroI, 0, sizeof(referenceErrorGyroI));
+    memset(referenceErrorGyroIf, 0, sizeof(referenceErrorGyroIf));
+    memset(referenceErrorAngleI, 0, sizeof(referenceErrorAngleI));
+}
+
+static pidProfile_t testPidProfile;
+static controlRateConfig_t testControlRateConfig;
+static rollAndPitchTrims_t testAngleTrim;
+
+static uint32_t randomState;
+
+static int32_t randomBetween(int32_t low, int32_t high)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return low + (int32_t)((randomState >> 8) % (uint32_t)(high - low + 1));
+}
+
+static void resetTestProfile(void)
+{
+    memset(&testPidProfile, 0, sizeof(testPidProfile));
+    testPidProfile.P8[ROLL] = 40;
+    testPidProfile.I8[ROLL] = 30;
+    testPidProfile.D8[ROLL] = 23;
+    testPidProfile.P8[PITCH] = 40;
+    testPidProfile.I8[PITCH] = 30;
+    testPidProfile.D8[PITCH] = 23;
+    testPidProfile.P8[YAW] = 85;
+    testPidProfile.I8[YAW] = 45;
+    testPidProfile.D8[YAW] = 0;
+    testPidProfile.P8[PIDLEVEL] = 90;
+    testPidProfile.I8[PIDLEVEL] = 10;
+    testPidProfile.D8[PIDLEVEL] = 100;
+
+    testPidProfile.P_f[ROLL] = 2.5f;
+    testPidProfile.I_f[ROLL] = 0.6f;
+    testPidProfile.D_f[ROLL] = 0.06f;
+    testPidProfile.P_f[PITCH] = 2.5f;
+    testPidProfile.I_f[PITCH] = 0.6f;
+    testPidProfile.D_f[PITCH] = 0.06f;
+    testPidProfile.P_f[YAW] = 8.0f;
+    testPidProfile.I_f[YAW] = 0.5f;
+    testPidProfile.D_f[YAW] = 0.05f;
+    testPidProfile.A_level = 5.0f;
+    testPidProfile.H_level = 3.0f;
+
+    testControlRateConfig.rollPitchRate = 40;
+    testControlRateConfig.yawRate = 20;
+
+    testAngleTrim.values.roll = 5;
+    testAngleTrim.values.pitch = -3;
+
+    for (int axis = 0; axis < 3; axis++) {
+        dynP8[axis] = testPidProfile.P8[axis];
+        dynI8[axis] = testPidProfile.I8[axis];
+        dynD8[axis] = testPidProfile.D8[axis];
+    }
+}
+
+static void runBoth(pidControllerFuncPtr reference)
+{
+    pid_controller(&testPidProfile, &testControlRateConfig, TEST_MAX_ANGLE_INCLINATION, &testAngleTrim);
+    reference(&testPidProfile, &testControlRateConfig, TEST_MAX_ANGLE_INCLINATION, &testAngleTrim);
+}
+
+/*
+ * Brings the state of both implementations to the same point: the D-term filters are initialised again by the next
+ * call with another cutoff, the moving averages and the last samples are flushed with zeros, the integrators reset.
+ */
+static void startComparison(int controllerType, pidControllerFuncPtr reference)
+{
+    resetTestProfile();
+    setPIDController(controllerType);
+    gyro.scale = 1.0f / 16.4f;
+
+    flightModeFlags = 0;
+    armingFlags = 0;
+    cycleTime = targetPidLooptime;
+    memset(gyroData, 0, sizeof(gyroData));
+    memset(rcCommand, 0, sizeof(rcCommand));
+    memset(&inclination, 0, sizeof(inclination));
+    memset(GPS_angle, 0, sizeof(GPS_angle));
+
+    testPidProfile.dterm_lpf_hz = 1;
+    runBoth(reference);
+    testPidProfile.dterm_lpf_hz = 0;
+    for (int iteration = 0; iteration < 4; iteration++) {
+        runBoth(reference);
+    }
+
+    resetErrorAngle();
+    resetErrorGyro();
+    referenceResetErrors();
+
+    randomState = 0x12345678;
+}
+
+static void randomLoopInputs(void)
+{
+    for (int axis = 0; axis < 3; axis++) {
+        gyroData[axis] = constrain(gyroData[axis] + randomBetween(-300, 300), -4000, 4000);
+    }
+    for (int axis = 0; axis < 3; axis++) {
+        rcCommand[axis] = constrain(rcCommand[axis] + randomBetween(-60, 60), -500, 500);
+    }
+    for (int axis = 0; axis < ANGLE_INDEX_COUNT; axis++) {
+        inclination.raw[axis] = constrain(inclination.raw[axis] + randomBetween(-40, 40), -900, 900);
+        GPS_angle[axis] = randomBetween(-20, 20);
+    }
+    cycleTime = targetPidLooptime + randomBetween(-150, 150);
+}
+
+static const uint16_t modeCombinations[] = { 0, ANGLE_MODE, HORIZON_MODE, ANGLE_MODE | HORIZON_MODE };
+
+#define MODE_COMBINATION_COUNT (sizeof(modeCombinations) / sizeof(modeCombinations[0]))
+
+/*
+ * Runs both implementations over random inputs with the modes switched every TEST_MODE_SWITCH_ITERATIONS and returns
+ * the largest difference of the outputs.
+ */
+static int compareControllers(int controllerType, pidControllerFuncPtr reference, uint8_t dtermLpfHz)
+{
+    int largestDifference = 0;
+
+    startComparison(controllerType, reference);
+    testPidProfile.dterm_lpf_hz = dtermLpfHz;
+
+    for (int iteration = 0; iteration < TEST_ITERATIONS; iteration++) {
+        flightModeFlags = modeCombinations[(iteration / TEST_MODE_SWITCH_ITERATIONS) % MODE_COMBINATION_COUNT];
+        randomLoopInputs();
+
+        runBoth(reference);
+
+        for (int axis = 0; axis < 3; axis++) {
+            largestDifference = max(largestDifference, abs(axisPID[axis] - referencePID[axis]));
+        }
+    }
+    return largestDifference;
+}
+
+TEST(FlightPidTest, MultiWiiMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(0, referenceMultiWii, 0));
+}
+
+TEST(FlightPidTest, MultiWiiWithDTermFilterMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(0, referenceMultiWii, 40));
+}
+
+TEST(FlightPidTest, RewriteMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(1, referenceRewrite, 0));
+}
+
+TEST(FlightPidTest, RewriteWithDTermFilterMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(1, referenceRewrite, 40));
+}
+
+TEST(FlightPidTest, BaseflightMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(2, referenceBaseflight, 0));
+}
+
+TEST(FlightPidTest, BaseflightWithDTermFilterMatchesReference)
+{
+    EXPECT_EQ(0, compareControllers(2, referenceBaseflight, 40));
+}
+
+TEST(FlightPidTest, BaseflightSaturates)
+{
+    startComparison(2, referenceBaseflight);
+
+    // full stick against a fast rotation the other way
+    rcCommand[ROLL] = 500;
+    gyroData[ROLL] = -4000;
+    runBoth(referenceBaseflight);
+
+    EXPECT_EQ(1000, axisPID[ROLL]);
+    EXPECT_EQ(referencePID[ROLL], axisPID[ROLL]);
+}
+
+// STUBS
+
+uint8_t armingFlags;
+uint16_t flightModeFlags;
+int16_t rcCommand[4];
+int16_t gyroData[FLIGHT_DYNAMICS_INDEX_COUNT];
+int16_t GPS_angle[ANGLE_INDEX_COUNT];
+rollAndPitchInclination_t inclination;
+gyro_t gyro;
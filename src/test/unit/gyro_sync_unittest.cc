@@ -0,0 +1,282 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <limits.h>
+
+#include "platform.h"
+#include "scheduler/scheduler.h"
+#include "sensors/gyro_sync.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// simulated gyro with a data ready interrupt, the clock only moves forward through advanceTime()
+
+static uint32_t simulatedTime = 0;
+static uint32_t gyroSamplePeriod = 0;       // 0 means the interrupt source is disconnected
+static uint32_t nextSampleAt = 0;
+static uint32_t taskCost[TASK_COUNT];
+static uint32_t taskRunCount[TASK_COUNT];
+static uint32_t pidStartedAt[4096];
+
+#define SCHEDULER_PASS_OVERHEAD 2
+
+static void advanceTime(uint32_t duration)
+{
+    uint32_t endAt = simulatedTime + duration;
+
+    while (gyroSamplePeriod && nextSampleAt <= endAt) {
+        simulatedTime = nextSampleAt;
+        gyroSyncDataReady(nextSampleAt);
+        nextSampleAt += gyroSamplePeriod;
+    }
+    simulatedTime = endAt;
+}
+
+static void resetSimulation(uint32_t samplePeriod, uint8_t denominator)
+{
+    simulatedTime = 100;
+    gyroSamplePeriod = samplePeriod;
+    nextSampleAt = simulatedTime + samplePeriod;
+    memset(taskCost, 0, sizeof(taskCost));
+    memset(taskRunCount, 0, sizeof(taskRunCount));
+
+    gyroSyncInit(samplePeriod, denominator);
+
+    schedulerInit();
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; taskId++) {
+        setTaskEnabled((cfTaskId_e)taskId, true);
+    }
+    rescheduleTask(TASK_GYROPID, gyroSyncGetLoopPeriod());
+}
+
+static void runTask(cfTaskId_e taskId)
+{
+    if (taskId == TASK_GYROPID && taskRunCount[taskId] < sizeof(pidStartedAt) / sizeof(pidStartedAt[0])) {
+        pidStartedAt[taskRunCount[taskId]] = simulatedTime;
+    }
+    taskRunCount[taskId]++;
+    advanceTime(taskCost[taskId]);
+}
+
+static void runSchedulerFor(uint32_t duration)
+{
+    uint32_t endAt = simulatedTime + duration;
+    while (simulatedTime < endAt) {
+        scheduler();
+        advanceTime(SCHEDULER_PASS_OVERHEAD);
+    }
+}
+
+TEST(GyroSyncUnittest, PidLoopRunsOncePerSampleInPhaseWithTheGyro)
+{
+    // given
+    resetSimulation(1000, 1);
+    taskCost[TASK_GYROPID] = 300;
+    taskCost[TASK_SERIAL] = 150;
+    taskCost[TASK_GPS] = 200;
+    taskCost[TASK_TELEMETRY] = 100;
+
+    // when
+    runSchedulerFor(1000000);
+
+    // then
+    EXPECT_GE(taskRunCount[TASK_GYROPID], 999u);
+    EXPECT_LE(taskRunCount[TASK_GYROPID], 1000u);
+
+    // and - each loop starts shortly after its sample, sample n arrives at 100 + n * 1000
+    for (uint32_t i = 0; i < taskRunCount[TASK_GYROPID]; i++) {
+        uint32_t sampleAt = 100 + (i + 1) * 1000;
+        EXPECT_GE(pidStartedAt[i], sampleAt);
+        EXPECT_LE(pidStartedAt[i], sampleAt + 2 * SCHEDULER_PASS_OVERHEAD);
+    }
+
+    // and
+    const gyroSyncStats_t *stats = getGyroSyncStats();
+    EXPECT_EQ(0u, stats->missedUpdates);
+    EXPECT_EQ(0u, stats->timeouts);
+    EXPECT_LE(stats->maxLatency, 2u * SCHEDULER_PASS_OVERHEAD);
+    EXPECT_LE(stats->maxJitter, 2u * SCHEDULER_PASS_OVERHEAD);
+
+    // and - the other tasks still run
+    EXPECT_GE(taskRunCount[TASK_SERIAL], 90u);
+    EXPECT_GE(taskRunCount[TASK_GPS], 9u);
+}
+
+TEST(GyroSyncUnittest, DenominatorSkipsSamples)
+{
+    // given
+    resetSimulation(125, 4);
+    taskCost[TASK_GYROPID] = 300;
+
+    // when
+    runSchedulerFor(100000);
+
+    // then
+    EXPECT_EQ(500u, gyroSyncGetLoopPeriod());
+    EXPECT_GE(taskRunCount[TASK_GYROPID], 199u);
+    EXPECT_LE(taskRunCount[TASK_GYROPID], 200u);
+    EXPECT_EQ(800u, getGyroSyncStats()->samples);
+    EXPECT_EQ(0u, getGyroSyncStats()->missedUpdates);
+}
+
+TEST(GyroSyncUnittest, SlowLoopCountsMissedUpdates)
+{
+    // given
+    resetSimulation(1000, 1);
+    taskCost[TASK_GYROPID] = 1500;
+
+    // when
+    runSchedulerFor(100000);
+
+    // then
+    const gyroSyncStats_t *stats = getGyroSyncStats();
+    EXPECT_GT(stats->missedUpdates, 0u);
+    EXPECT_LT(stats->updates, stats->samples);
+    EXPECT_GE(stats->maxJitter, 500u);
+}
+
+TEST(GyroSyncUnittest, PidLoopKeepsRunningWhenTheInterruptStops)
+{
+    // given
+    resetSimulation(1000, 1);
+    taskCost[TASK_GYROPID] = 200;
+    runSchedulerFor(10000);
+    uint32_t pidRunCount = taskRunCount[TASK_GYROPID];
+
+    // when
+    gyroSamplePeriod = 0;
+    runSchedulerFor(100000);
+
+    // then - after the timeout the loop runs at the full rate again
+    EXPECT_GE(taskRunCount[TASK_GYROPID] - pidRunCount, 100000 / 1000 - GYRO_SYNC_TIMEOUT_PERIODS - 1);
+    EXPECT_LE(taskRunCount[TASK_GYROPID] - pidRunCount, 100000 / 1000);
+    EXPECT_GT(getGyroSyncStats()->timeouts, 0u);
+
+    // and - one period apart, from the first update after the timeout
+    for (uint32_t i = pidRunCount + 2; i < taskRunCount[TASK_GYROPID]; i++) {
+        EXPECT_GE(pidStartedAt[i] - pidStartedAt[i - 1], 1000u - 2 * SCHEDULER_PASS_OVERHEAD);
+        EXPECT_LE(pidStartedAt[i] - pidStartedAt[i - 1], 1000u + 2 * SCHEDULER_PASS_OVERHEAD);
+    }
+}
+
+TEST(GyroSyncUnittest, PidLoopReturnsToTheGyroWhenTheInterruptResumes)
+{
+    // given
+    resetSimulation(1000, 1);
+    taskCost[TASK_GYROPID] = 200;
+    gyroSamplePeriod = 0;
+    runSchedulerFor(10000);
+    EXPECT_GT(getGyroSyncStats()->timeouts, 0u);
+
+    // when
+    gyroSamplePeriod = 1000;
+    nextSampleAt = simulatedTime + 500;
+    runSchedulerFor(10000);
+    uint32_t timeouts = getGyroSyncStats()->timeouts;
+    uint32_t pidRunCount = taskRunCount[TASK_GYROPID];
+    runSchedulerFor(10000);
+
+    // then - no more timeouts and the loop follows the samples again
+    EXPECT_EQ(timeouts, getGyroSyncStats()->timeouts);
+    EXPECT_EQ(0u, getGyroSyncStats()->missedUpdates);
+    EXPECT_EQ(10u, taskRunCount[TASK_GYROPID] - pidRunCount);
+    EXPECT_LE(pidStartedAt[taskRunCount[TASK_GYROPID] - 1] - (nextSampleAt - 1000), 2u * SCHEDULER_PASS_OVERHEAD);
+}
+
+TEST(GyroSyncUnittest, UpdatesSignalledBeforeTheCheckAreCountedAsMissed)
+{
+    // given
+    resetSimulation(1000, 1);
+
+    // when
+    gyroSyncDataReady(1000);
+    gyroSyncDataReady(2000);
+    gyroSyncDataReady(3000);
+
+    // then
+    EXPECT_TRUE(gyroSyncCheckUpdate(3010));
+    EXPECT_FALSE(gyroSyncCheckUpdate(3020));
+
+    // and - the latency is that of the latest sample
+    const gyroSyncStats_t *stats = getGyroSyncStats();
+    EXPECT_EQ(2u, stats->missedUpdates);
+    EXPECT_EQ(1u, stats->updates);
+    EXPECT_EQ(10u, stats->maxLatency);
+}
+
+TEST(GyroSyncUnittest, ResetClearsStatistics)
+{
+    // given
+    resetSimulation(1000, 1);
+    runSchedulerFor(10000);
+    EXPECT_GT(getGyroSyncStats()->updates, 0u);
+
+    // when
+    gyroSyncResetStats();
+
+    // then
+    const gyroSyncStats_t *stats = getGyroSyncStats();
+    EXPECT_EQ(0u, stats->samples);
+    EXPECT_EQ(0u, stats->updates);
+    EXPECT_EQ(0u, stats->maxLatency);
+    EXPECT_EQ(UINT32_MAX, stats->minLatency);
+}
+
+TEST(GyroSyncUnittest, DisabledWithoutSamplePeriod)
+{
+    // when
+    gyroSyncInit(0, 1);
+
+    // then
+    EXPECT_FALSE(gyroSyncIsEnabled());
+}
+
+// STUBS
+
+uint32_t micros(void)
+{
+    return simulatedTime;
+}
+
+bool taskMainPidLoopCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+    return gyroSyncCheckUpdate(micros());
+}
+void taskMainPidLoop(void) { runTask(TASK_GYROPID); }
+bool taskUpdateRxCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+    return false;
+}
+void taskUpdateRxMain(void) { runTask(TASK_RX); }
+void taskHandleSerial(void) { runTask(TASK_SERIAL); }
+bool taskSaveConfigCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+    return false;
+}
+void taskSaveConfig(void) { runTask(TASK_CONFIG); }
+void taskUpdateGps(void) { runTask(TASK_GPS); }
+void taskUpdateBaro(void) { runTask(TASK_BARO); }
+void taskCalculateAltitude(void) { runTask(TASK_ALTITUDE); }
+void taskTelemetry(void) { runTask(TASK_TELEMETRY); }
+void taskLedStrip(void) { runTask(TASK_LEDSTRIP); }
@@ -0,0 +1,274 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <limits.h>
+
+#include "common/axis.h"
+
+#include "drivers/accgyro.h"
+#include "flight/flight.h"
+#include "sensors/sensors.h"
+#include "sensors/gyro.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+uint32_t targetPidLooptime = 1000;
+int16_t gyroADC[XYZ_AXIS_COUNT];
+int16_t gyroZero[FLIGHT_DYNAMICS_INDEX_COUNT];
+
+static int16_t fakeGyroSamples[64][XYZ_AXIS_COUNT];
+static uint8_t fakeGyroSampleIndex = 0;
+static uint8_t fakeGyroReadCount = 0;
+
+static void fakeGyroRead(int16_t *gyroData)
+{
+    gyroData[X] = fakeGyroSamples[fakeGyroSampleIndex][X];
+    gyroData[Y] = fakeGyroSamples[fakeGyroSampleIndex][Y];
+    gyroData[Z] = fakeGyroSamples[fakeGyroSampleIndex][Z];
+    fakeGyroSampleIndex++;
+    fakeGyroReadCount++;
+}
+
+static gyroConfig_t testGyroConfig = { 0, 0, 0, 0 };
+
+static void resetFakeGyro(void)
+{
+    memset(fakeGyroSamples, 0, sizeof(fakeGyroSamples));
+    fakeGyroSampleIndex = 0;
+    fakeGyroReadCount = 0;
+    gyro.read = fakeGyroRead;
+    useGyroConfig(&testGyroConfig);
+}
+
+TEST(GyroUnittest, SingleSampleIsUsedDirectlyWithoutOversampling)
+{
+    // given
+    resetFakeGyro();
+    fakeGyroSamples[0][X] = 100;
+    fakeGyroSamples[0][Y] = -200;
+    fakeGyroSamples[0][Z] = 300;
+
+    // when
+    gyroGetADC();
+
+    // then
+    EXPECT_EQ(1, fakeGyroReadCount);
+    EXPECT_EQ(100, gyroADC[X]);
+    EXPECT_EQ(-200, gyroADC[Y]);
+    EXPECT_EQ(300, gyroADC[Z]);
+}
+
+TEST(GyroUnittest, AccumulatedSamplesAreAveraged)
+{
+    // given
+    resetFakeGyro();
+    int16_t xSamples[4] = { 100, 110, 120, 130 };
+    for (int i = 0; i < 4; i++) {
+        fakeGyroSamples[i][X] = xSamples[i];
+        fakeGyroSamples[i][Y] = -xSamples[i];
+        fakeGyroSamples[i][Z] = 8000;
+    }
+
+    // when
+    for (int i = 0; i < 4; i++) {
+        gyroAccumulateSample();
+    }
+    gyroGetADC();
+
+    // then - no extra read, the average of the accumulated samples is used
+    EXPECT_EQ(4, fakeGyroReadCount);
+    EXPECT_EQ(115, gyroADC[X]);
+    EXPECT_EQ(-115, gyroADC[Y]);
+    EXPECT_EQ(8000, gyroADC[Z]);
+}
+
+TEST(GyroUnittest, NoiseAtTheSampleRateDoesNotAliasIntoThePidRate)
+{
+    // given - a steady rate with noise alternating every sample
+    resetFakeGyro();
+    for (int i = 0; i < 8; i++) {
+        fakeGyroSamples[i][X] = 500 + ((i & 1) ? 400 : -400);
+    }
+
+    // when - the pid loop runs at a quarter of the gyro rate
+    for (int i = 0; i < 4; i++) {
+        gyroAccumulateSample();
+    }
+    gyroGetADC();
+    int16_t firstPidSample = gyroADC[X];
+
+    for (int i = 0; i < 4; i++) {
+        gyroAccumulateSample();
+    }
+    gyroGetADC();
+
+    // then
+    EXPECT_EQ(500, firstPidSample);
+    EXPECT_EQ(500, gyroADC[X]);
+}
+
+TEST(GyroUnittest, AccumulatorIsClearedAfterEachRead)
+{
+    // given
+    resetFakeGyro();
+    fakeGyroSamples[0][X] = 1000;
+    fakeGyroSamples[1][X] = 1000;
+    fakeGyroSamples[2][X] = 10;
+    gyroAccumulateSample();
+    gyroAccumulateSample();
+    gyroGetADC();
+
+    // when
+    gyroGetADC();
+
+    // then
+    EXPECT_EQ(3, fakeGyroReadCount);
+    EXPECT_EQ(10, gyroADC[X]);
+}
+
+static knownSensors_t testKnownSensors;
+static uint8_t eepromWriteRequests = 0;
+
+static void feedSteadyGyro(int16_t x, int16_t y, int16_t z, int cycles)
+{
+    for (int i = 0; i < cycles; i++) {
+        fakeGyroSampleIndex = 0;
+        fakeGyroSamples[0][X] = x;
+        fakeGyroSamples[0][Y] = y;
+        fakeGyroSamples[0][Z] = z;
+        gyroGetADC();
+    }
+}
+
+static void resetKnownSensors(void)
+{
+    memset(&testKnownSensors, 0, sizeof(testKnownSensors));
+    eepromWriteRequests = 0;
+    gyroHardware = GYRO_FAKE;
+}
+
+TEST(GyroUnittest, UnknownGyroIsFullyCalibratedAndStored)
+{
+    // given
+    resetFakeGyro();
+    resetKnownSensors();
+
+    // when
+    gyroStartBootCalibration(&testKnownSensors);
+    feedSteadyGyro(10, 5, 3, CALIBRATING_GYRO_CYCLES);
+
+    // then
+    EXPECT_TRUE(isGyroCalibrationComplete());
+    EXPECT_EQ(10, gyroZero[X]);
+    EXPECT_EQ(5, gyroZero[Y]);
+    EXPECT_EQ(3, gyroZero[Z]);
+    EXPECT_TRUE(testKnownSensors.calibrated & SENSOR_GYRO);
+    EXPECT_EQ(GYRO_FAKE, testKnownSensors.gyroHardware);
+    EXPECT_EQ(10, testKnownSensors.gyroZero[X]);
+    EXPECT_EQ(5, testKnownSensors.gyroZero[Y]);
+    EXPECT_EQ(3, testKnownSensors.gyroZero[Z]);
+    EXPECT_EQ(1, eepromWriteRequests);
+}
+
+TEST(GyroUnittest, KnownGyroZeroIsOnlyChecked)
+{
+    // given
+    resetFakeGyro();
+    resetKnownSensors();
+    testKnownSensors.gyroHardware = GYRO_FAKE;
+    testKnownSensors.calibrated = SENSOR_GYRO;
+    testKnownSensors.gyroZero[X] = 12;
+    testKnownSensors.gyroZero[Y] = 4;
+    testKnownSensors.gyroZero[Z] = 3;
+
+    // when
+    gyroStartBootCalibration(&testKnownSensors);
+    feedSteadyGyro(10, 5, 3, CHECKING_GYRO_CYCLES);
+
+    // then - the zero measured is used, the known one is kept
+    EXPECT_TRUE(isGyroCalibrationComplete());
+    EXPECT_EQ(10, gyroZero[X]);
+    EXPECT_EQ(12, testKnownSensors.gyroZero[X]);
+    EXPECT_EQ(0, eepromWriteRequests);
+}
+
+TEST(GyroUnittest, MovedGyroZeroIsFullyCalibrated)
+{
+    // given
+    resetFakeGyro();
+    resetKnownSensors();
+    testKnownSensors.gyroHardware = GYRO_FAKE;
+    testKnownSensors.calibrated = SENSOR_GYRO;
+    testKnownSensors.gyroZero[X] = 100;
+
+    // when
+    gyroStartBootCalibration(&testKnownSensors);
+    feedSteadyGyro(10, 5, 3, CHECKING_GYRO_CYCLES);
+
+    // then
+    EXPECT_FALSE(isGyroCalibrationComplete());
+
+    // when
+    feedSteadyGyro(10, 5, 3, CALIBRATING_GYRO_CYCLES);
+
+    // then
+    EXPECT_TRUE(isGyroCalibrationComplete());
+    EXPECT_EQ(10, testKnownSensors.gyroZero[X]);
+    EXPECT_EQ(1, eepromWriteRequests);
+}
+
+TEST(GyroUnittest, GyroOfAnotherTypeIsFullyCalibrated)
+{
+    // given
+    resetFakeGyro();
+    resetKnownSensors();
+    testKnownSensors.gyroHardware = GYRO_MPU6050;
+    testKnownSensors.calibrated = SENSOR_GYRO;
+
+    // when
+    gyroStartBootCalibration(&testKnownSensors);
+    feedSteadyGyro(0, 0, 0, CHECKING_GYRO_CYCLES);
+
+    // then
+    EXPECT_FALSE(isGyroCalibrationComplete());
+}
+
+// STUBS
+
+void alignSensors(int16_t *src, int16_t *dest, uint8_t rotation)
+{
+    UNUSED(rotation);
+    dest[X] = src[X];
+    dest[Y] = src[Y];
+    dest[Z] = src[Z];
+}
+
+void blinkLedAndSoundBeeper(uint8_t num_blinks, uint8_t wait, uint8_t repeat)
+{
+    UNUSED(num_blinks);
+    UNUSED(wait);
+    UNUSED(repeat);
+}
+
+void requestEEPROMWrite(void)
+{
+    eepromWriteRequests++;
+}
@@ -0,0 +1,156 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+#include <limits.h>
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// maths.h defines min/max/abs macros that break the C++ headers gtest pulls in, so it goes last
+#include "platform.h"
+#include "common/maths.h"
+
+#define TEST_PI 3.14159265358979323846
+
+typedef float (*unaryFuncPtr)(float x);
+
+static float libmSin(float x) { return sinf(x); }
+static float libmCos(float x) { return cosf(x); }
+static float libmAcos(float x) { return acosf(x); }
+static float libmInvSqrt(float x) { return 1.0f / sqrtf(x); }
+static float approxSin(float x) { return sin_approx(x); }
+static float approxCos(float x) { return cos_approx(x); }
+static float approxAcos(float x) { return acos_approx(x); }
+static float approxInvSqrt(float x) { return invSqrt_approx(x); }
+static float libmPressureToAltitude(float pressure) { return (1.0 - pow(pressure / 101325.0, 0.190295)) * 4433000.0; }
+
+static double maxError(unaryFuncPtr approximation, unaryFuncPtr reference, float from, float to, bool relative)
+{
+    const int steps = 100000;
+    double worst = 0.0;
+
+    for (int i = 0; i <= steps; i++) {
+        float x = from + (to - from) * i / steps;
+        double expected = reference(x);
+        double error = fabs(approximation(x) - expected);
+        if (relative) {
+            error /= fabs(expected);
+        }
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    return worst;
+}
+
+// runs the function over the range and returns the average time per call
+static double nanosecondsPerCall(unaryFuncPtr function, float from, float to)
+{
+    const int calls = 1000000;
+    volatile float sink = 0.0f;
+
+    clock_t startedAt = clock();
+    for (int i = 0; i < calls; i++) {
+        sink = function(from + (to - from) * (i & 0xFFF) / 0xFFF);
+    }
+    UNUSED(sink);
+    return (double)(clock() - startedAt) * 1e9 / CLOCKS_PER_SEC / calls;
+}
+
+static void reportBenchmark(const char *name, unaryFuncPtr approximation, unaryFuncPtr reference, float from, float to)
+{
+    printf("%-20s approximation %6.1fns/call, libm %6.1fns/call\n", name,
+            nanosecondsPerCall(approximation, from, to), nanosecondsPerCall(reference, from, to));
+}
+
+TEST(MathsUnittest, SinAndCosErrorIsBounded)
+{
+    // expect - the range used in the flight code and a few turns beyond it
+    double sinError = maxError(approxSin, libmSin, -4 * TEST_PI, 4 * TEST_PI, false);
+    double cosError = maxError(approxCos, libmCos, -4 * TEST_PI, 4 * TEST_PI, false);
+    printf("sin max error %.2e, cos max error %.2e\n", sinError, cosError);
+    EXPECT_LT(sinError, 2e-6);
+    EXPECT_LT(cosError, 2e-6);
+}
+
+TEST(MathsUnittest, Atan2ErrorIsBoundedInAllQuadrants)
+{
+    // given
+    double worst = 0.0;
+
+    // when - go around the unit circle and some points off it
+    for (int i = 0; i < 36000; i++) {
+        double angle = -TEST_PI + 2 * TEST_PI * i / 36000;
+        for (float radius = 0.01f; radius < 1000.0f; radius *= 10.0f) {
+            float y = radius * sin(angle);
+            float x = radius * cos(angle);
+            double error = fabs(atan2_approx(y, x) - atan2(y, x));
+            if (error > TEST_PI) {
+                error = fabs(error - 2 * TEST_PI); // +pi and -pi are the same angle
+            }
+            if (error > worst) {
+                worst = error;
+            }
+        }
+    }
+
+    // then
+    printf("atan2 max error %.2e rad\n", worst);
+    EXPECT_LT(worst, 1e-6);
+    EXPECT_NEAR(0.0f, atan2_approx(0.0f, 0.0f), 1e-6);
+}
+
+TEST(MathsUnittest, AcosErrorIsBounded)
+{
+    double error = maxError(approxAcos, libmAcos, -1.0f, 1.0f, false);
+    printf("acos max error %.2e rad\n", error);
+    EXPECT_LT(error, 7e-5);
+}
+
+TEST(MathsUnittest, InvSqrtRelativeErrorIsBounded)
+{
+    double error = maxError(approxInvSqrt, libmInvSqrt, 1e-3f, 1e6f, true);
+    printf("invSqrt max relative error %.2e\n", error);
+    EXPECT_LT(error, 5e-6);
+}
+
+TEST(MathsUnittest, PressureToAltitudeMatchesTheBarometricFormula)
+{
+    // expect - from below the dead sea to above 9000m, in cm
+    double error = maxError(pressureToAltitude, libmPressureToAltitude, 30000.0f, 108000.0f, false);
+    printf("pressure to altitude max error %.2fcm\n", error);
+    EXPECT_LT(error, 5.0);
+
+    // and
+    EXPECT_NEAR(0.0f, pressureToAltitude(101325.0f), 1.0f);
+    EXPECT_NEAR(100000.0f, pressureToAltitude(89875.0f), 100.0f);
+}
+
+TEST(MathsUnittest, Benchmark)
+{
+    // with a hardware FPU and an optimised libm the host is no reference, the approximations avoid the
+    // double precision range reduction and iterations libm does in soft float on the F1 targets
+    reportBenchmark("sin", approxSin, libmSin, -TEST_PI, TEST_PI);
+    reportBenchmark("cos", approxCos, libmCos, -TEST_PI, TEST_PI);
+    reportBenchmark("acos", approxAcos, libmAcos, -1.0f, 1.0f);
+    reportBenchmark("invSqrt", approxInvSqrt, libmInvSqrt, 0.1f, 1000.0f);
+    reportBenchmark("pressureToAltitude", pressureToAltitude, libmPressureToAltitude, 30000.0f, 108000.0f);
+}
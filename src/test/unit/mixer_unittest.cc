@@ -0,0 +1,354 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <limits.h>
+
+#include "common/axis.h"
+#include "flight/flight.h"
+
+#include "drivers/pwm_mapping.h"
+#include "drivers/pwm_output.h"
+
+#include "rx/rx.h"
+#include "io/gimbal.h"
+#include "io/escservo.h"
+#include "io/rc_controls.h"
+
+#include "flight/mixer.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_MIN_COMMAND 1000
+#define TEST_MIN_THROTTLE 1150
+#define TEST_MAX_THROTTLE 1850
+#define TEST_MIN_CHECK 1100
+#define TEST_MID_RC 1500
+
+void mixerInit(MultiType mixerConfiguration, motorMixer_t *initialCustomMixers);
+void mixerUseConfigs(servoParam_t *servoConfToUse, flight3DConfig_t *flight3DConfigToUse,
+        escAndServoConfig_t *escAndServoConfigToUse, mixerConfig_t *mixerConfigToUse,
+        airplaneConfig_t *airplaneConfigToUse, rxConfig_t *rxConfigToUse, gimbalConfig_t *gimbalConfigToUse);
+void mixerUsePWMOutputConfiguration(pwmOutputConfiguration_t *pwmOutputConfiguration);
+
+static uint32_t enabledFeatures;
+
+static servoParam_t testServoConf[MAX_SUPPORTED_SERVOS];
+static flight3DConfig_t testFlight3DConfig;
+static escAndServoConfig_t testEscAndServoConfig;
+static mixerConfig_t testMixerConfig;
+static airplaneConfig_t testAirplaneConfig;
+static rxConfig_t testRxConfig;
+static gimbalConfig_t testGimbalConfig;
+
+static motorMixer_t customMixers[MAX_SUPPORTED_MOTORS];
+static motorMixer_t layoutWeights[MAX_SUPPORTED_MOTORS];
+
+static void useLayout(MultiType layout)
+{
+    pwmOutputConfiguration_t pwmOutputConfiguration = { 8, MAX_SUPPORTED_MOTORS };
+
+    memset(&testEscAndServoConfig, 0, sizeof(testEscAndServoConfig));
+    testEscAndServoConfig.minthrottle = TEST_MIN_THROTTLE;
+    testEscAndServoConfig.maxthrottle = TEST_MAX_THROTTLE;
+    testEscAndServoConfig.mincommand = TEST_MIN_COMMAND;
+
+    memset(&testRxConfig, 0, sizeof(testRxConfig));
+    testRxConfig.mincheck = TEST_MIN_CHECK;
+    testRxConfig.midrc = TEST_MID_RC;
+
+    testFlight3DConfig.deadband3d_low = 1406;
+    testFlight3DConfig.deadband3d_high = 1514;
+    testFlight3DConfig.neutral3d = 1460;
+
+    for (int i = 0; i < MAX_SUPPORTED_SERVOS; i++) {
+        testServoConf[i].min = 1020;
+        testServoConf[i].max = 2000;
+        testServoConf[i].middle = 1500;
+        testServoConf[i].rate = 100;
+        testServoConf[i].forwardFromChannel = CHANNEL_FORWARDING_DISABLED;
+    }
+
+    testMixerConfig.yaw_direction = 1;
+
+    mixerUseConfigs(testServoConf, &testFlight3DConfig, &testEscAndServoConfig, &testMixerConfig,
+            &testAirplaneConfig, &testRxConfig, &testGimbalConfig);
+
+    // the table of the layout, as the CLI loads it into the custom mixer
+    mixerLoadMix(layout == MULTITYPE_CUSTOM ? MULTITYPE_HEX6X - 1 : layout - 1, layoutWeights);
+    memcpy(customMixers, layoutWeights, sizeof(customMixers));
+
+    mixerInit(layout, customMixers);
+    mixerUsePWMOutputConfiguration(&pwmOutputConfiguration);
+
+    ENABLE_ARMING_FLAG(ARMED);
+    mixerResetSaturation();
+}
+
+static void setLoopInputs(int16_t throttle, int16_t roll, int16_t pitch, int16_t yaw)
+{
+    rcData[THROTTLE] = throttle;
+    rcCommand[THROTTLE] = throttle;
+    rcCommand[YAW] = 0;
+    axisPID[ROLL] = roll;
+    axisPID[PITCH] = pitch;
+    axisPID[YAW] = yaw;
+}
+
+// the correction the float weights of the layout ask for
+static float expectedCorrection(int motorIndex)
+{
+    return axisPID[PITCH] * layoutWeights[motorIndex].pitch + axisPID[ROLL] * layoutWeights[motorIndex].roll
+            - testMixerConfig.yaw_direction * axisPID[YAW] * layoutWeights[motorIndex].yaw;
+}
+
+static bool isMultirotor(MultiType layout)
+{
+    return getMotorCount() > 1 && layout != MULTITYPE_GIMBAL;
+}
+
+static void expectMotorsInRange(void)
+{
+    for (int i = 0; i < getMotorCount(); i++) {
+        EXPECT_LE(TEST_MIN_THROTTLE, motor[i]);
+        EXPECT_GE(TEST_MAX_THROTTLE, motor[i]);
+    }
+}
+
+// every motor must be offset from its correction by the same amount, the corrections were neither cut nor scaled
+static void expectCorrectionsKept(void)
+{
+    float offset = motor[0] - expectedCorrection(0);
+
+    for (int i = 1; i < getMotorCount(); i++) {
+        EXPECT_NEAR(offset, motor[i] - expectedCorrection(i), 1.5f);
+    }
+}
+
+TEST(MixerTest, MultirotorLayoutsMatchTheirWeights)
+{
+    for (int layout = MULTITYPE_TRI; layout < MULTITYPE_LAST; layout++) {
+        SCOPED_TRACE(layout);
+        useLayout((MultiType)layout);
+        if (!isMultirotor((MultiType)layout)) {
+            continue;
+        }
+
+        setLoopInputs(1500, 60, -45, 30);
+        mixTable();
+
+        for (int i = 0; i < getMotorCount(); i++) {
+            EXPECT_NEAR(1500 + expectedCorrection(i), motor[i], 1.0f);
+        }
+        EXPECT_EQ(1u, getMixerSaturation()->mixCount);
+        EXPECT_EQ(0u, getMixerSaturation()->loweredCount);
+        EXPECT_EQ(0u, getMixerSaturation()->raisedCount);
+        EXPECT_EQ(0u, getMixerSaturation()->pidScaledCount);
+    }
+}
+
+TEST(MixerTest, MotorsAreLoweredAtFullThrottle)
+{
+    for (int layout = MULTITYPE_TRI; layout < MULTITYPE_LAST; layout++) {
+        SCOPED_TRACE(layout);
+        useLayout((MultiType)layout);
+        if (!isMultirotor((MultiType)layout)) {
+            continue;
+        }
+
+        setLoopInputs(2000, 150, -100, 50);
+        mixTable();
+
+        expectMotorsInRange();
+        expectCorrectionsKept();
+        EXPECT_EQ(1u, getMixerSaturation()->loweredCount);
+    }
+}
+
+TEST(MixerTest, MotorsAreRaisedAtLowThrottle)
+{
+    for (int layout = MULTITYPE_TRI; layout < MULTITYPE_LAST; layout++) {
+        SCOPED_TRACE(layout);
+        useLayout((MultiType)layout);
+        if (!isMultirotor((MultiType)layout)) {
+            continue;
+        }
+
+        setLoopInputs(TEST_MIN_THROTTLE + 10, -150, 100, -50);
+        mixTable();
+
+        expectMotorsInRange();
+        expectCorrectionsKept();
+        EXPECT_EQ(1u, getMixerSaturation()->raisedCount);
+    }
+}
+
+TEST(MixerTest, CorrectionsWiderThanTheRangeAreScaled)
+{
+    for (int layout = MULTITYPE_TRI; layout < MULTITYPE_LAST; layout++) {
+        SCOPED_TRACE(layout);
+        useLayout((MultiType)layout);
+        if (!isMultirotor((MultiType)layout)) {
+            continue;
+        }
+
+        setLoopInputs(1500, 1000, -1000, 1000);
+        mixTable();
+
+        expectMotorsInRange();
+        EXPECT_EQ(1u, getMixerSaturation()->pidScaledCount);
+
+        // the motor that wants the most gets maxthrottle, the one that wants the least minthrottle
+        int16_t lowest = motor[0], highest = motor[0];
+        for (int i = 1; i < getMotorCount(); i++) {
+            lowest = std::min(lowest, motor[i]);
+            highest = std::max(highest, motor[i]);
+        }
+        EXPECT_GE(TEST_MIN_THROTTLE + 2, lowest);
+        EXPECT_LE(TEST_MAX_THROTTLE - 2, highest);
+    }
+}
+
+TEST(MixerTest, SingleMotorLayoutsFollowTheThrottle)
+{
+    static const MultiType layouts[] = { MULTITYPE_FLYING_WING, MULTITYPE_AIRPLANE, MULTITYPE_SINGLECOPTER };
+
+    for (unsigned i = 0; i < sizeof(layouts) / sizeof(layouts[0]); i++) {
+        SCOPED_TRACE(layouts[i]);
+        useLayout(layouts[i]);
+        EXPECT_EQ(1, getMotorCount());
+
+        setLoopInputs(1600, 100, 100, 100);
+        mixTable();
+        EXPECT_EQ(1600, motor[0]);
+
+        setLoopInputs(1990, 100, 100, 100);
+        mixTable();
+        EXPECT_EQ(TEST_MAX_THROTTLE, motor[0]);
+        EXPECT_EQ(0u, getMixerSaturation()->mixCount);
+    }
+}
+
+TEST(MixerTest, LayoutsWithoutMotorsMixNothing)
+{
+    static const MultiType layouts[] = {
+        MULTITYPE_GIMBAL, MULTITYPE_HELI_120_CCPM, MULTITYPE_HELI_90_DEG, MULTITYPE_PPM_TO_SERVO
+    };
+
+    for (unsigned i = 0; i < sizeof(layouts) / sizeof(layouts[0]); i++) {
+        SCOPED_TRACE(layouts[i]);
+        useLayout(layouts[i]);
+        EXPECT_EQ(0, getMotorCount());
+
+        setLoopInputs(1600, 100, 100, 100);
+        mixTable();
+        EXPECT_EQ(0u, getMixerSaturation()->mixCount);
+    }
+}
+
+TEST(MixerTest, ThrottleBelowMinCheckIdlesTheMotors)
+{
+    useLayout(MULTITYPE_QUADX);
+
+    setLoopInputs(TEST_MIN_CHECK - 10, 200, 0, 0);
+    mixTable();
+    for (int i = 0; i < getMotorCount(); i++) {
+        EXPECT_EQ(TEST_MIN_THROTTLE, motor[i]);
+    }
+
+    enabledFeatures = FEATURE_MOTOR_STOP;
+    mixTable();
+    for (int i = 0; i < getMotorCount(); i++) {
+        EXPECT_EQ(TEST_MIN_COMMAND, motor[i]);
+    }
+    enabledFeatures = 0;
+
+    EXPECT_EQ(0u, getMixerSaturation()->mixCount);
+}
+
+TEST(MixerTest, DisarmedMotorsAreStopped)
+{
+    useLayout(MULTITYPE_OCTOX8);
+    DISABLE_ARMING_FLAG(ARMED);
+
+    setLoopInputs(1600, 200, 0, 0);
+    mixTable();
+    for (int i = 0; i < getMotorCount(); i++) {
+        EXPECT_EQ(TEST_MIN_COMMAND, motor[i]);
+    }
+    EXPECT_EQ(0u, getMixerSaturation()->mixCount);
+}
+
+TEST(MixerTest, ReversedMotorsFitTheLower3DRange)
+{
+    enabledFeatures = FEATURE_3D;
+    useLayout(MULTITYPE_QUADX);
+
+    // the weights are halved in 3D mode
+    setLoopInputs(1400, 200, 0, 0);
+    mixTable();
+
+    for (int i = 0; i < getMotorCount(); i++) {
+        EXPECT_LE(TEST_MIN_COMMAND, motor[i]);
+        EXPECT_GE(testFlight3DConfig.deadband3d_low, motor[i]);
+    }
+    EXPECT_EQ(200, abs(motor[0] - motor[2]));
+    EXPECT_EQ(1u, getMixerSaturation()->loweredCount);
+
+    enabledFeatures = 0;
+}
+
+// STUBS
+
+uint8_t armingFlags;
+uint8_t stateFlags;
+uint16_t flightModeFlags;
+uint32_t rcModeActivationMask;
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+int16_t rcCommand[4];
+int16_t axisPID[XYZ_AXIS_COUNT];
+rollAndPitchInclination_t inclination;
+rxRuntimeConfig_t rxRuntimeConfig;
+
+bool feature(uint32_t mask)
+{
+    return enabledFeatures & mask;
+}
+
+void pwmWriteMotor(uint8_t index, uint16_t value)
+{
+    UNUSED(index);
+    UNUSED(value);
+}
+
+void pwmCompleteMotorUpdate(uint8_t motorCount)
+{
+    UNUSED(motorCount);
+}
+
+void pwmWriteServo(uint8_t index, uint16_t value)
+{
+    UNUSED(index);
+    UNUSED(value);
+}
@@ -0,0 +1,327 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/crc.h"
+#include "io/msp_frame.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_BUFFER_SIZE 128
+#define TEST_GUARD_SIZE 16
+#define TEST_GUARD_BYTE 0xA5
+#define TEST_FRAME_MAX_SIZE (TEST_BUFFER_SIZE + MSP_V2_FRAME_OVERHEAD)
+
+#define FUZZ_ITERATIONS 20000
+
+static uint8_t buffer[TEST_BUFFER_SIZE + TEST_GUARD_SIZE];
+static mspFrameParser_t parser;
+
+// a fixed sequence, so a failure can be reproduced
+static uint32_t randomState;
+
+static uint8_t randomByte(void)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return randomState >> 16;
+}
+
+static void initParser(void)
+{
+    memset(buffer, TEST_GUARD_BYTE, sizeof(buffer));
+    mspFrameParserInit(&parser, buffer, TEST_BUFFER_SIZE);
+}
+
+static bool guardIntact(void)
+{
+    for (int index = TEST_BUFFER_SIZE; index < TEST_BUFFER_SIZE + TEST_GUARD_SIZE; index++) {
+        if (buffer[index] != TEST_GUARD_BYTE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t buildV1Frame(uint8_t *frame, uint8_t cmd, const uint8_t *payload, uint8_t size)
+{
+    uint8_t checksum = size ^ cmd;
+
+    frame[0] = '$';
+    frame[1] = 'M';
+    frame[2] = '<';
+    frame[3] = size;
+    frame[4] = cmd;
+    for (int index = 0; index < size; index++) {
+        frame[5 + index] = payload[index];
+        checksum ^= payload[index];
+    }
+    frame[5 + size] = checksum;
+    return MSP_V1_FRAME_OVERHEAD + size;
+}
+
+static uint16_t buildV2Frame(uint8_t *frame, uint16_t cmd, const uint8_t *payload, uint16_t size)
+{
+    frame[0] = '$';
+    frame[1] = 'X';
+    frame[2] = '<';
+    frame[3] = 0;
+    frame[4] = cmd & 0xFF;
+    frame[5] = cmd >> 8;
+    frame[6] = size & 0xFF;
+    frame[7] = size >> 8;
+    memcpy(&frame[8], payload, size);
+    frame[8 + size] = crc8DvbS2Buffer(0, &frame[3], 5 + size);
+    return MSP_V2_FRAME_OVERHEAD + size;
+}
+
+// returns the number of frames received
+static int parseAll(const uint8_t *data, uint16_t length)
+{
+    int received = 0;
+    for (int index = 0; index < length; index++) {
+        if (mspFrameParse(&parser, data[index]) == MSP_FRAME_RECEIVED) {
+            received++;
+        }
+    }
+    return received;
+}
+
+TEST(MspFrameTest, Crc8DvbS2)
+{
+    // check value of the CRC-8/DVB-S2 catalogue entry
+    const uint8_t data[] = "123456789";
+    EXPECT_EQ(0xBC, crc8DvbS2Buffer(0, data, 9));
+}
+
+TEST(MspFrameTest, ReceiveV1Frame)
+{
+    // given
+    uint8_t payload[] = { 0x01, 0x02, 0x03 };
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    uint16_t length = buildV1Frame(frame, 210, payload, sizeof(payload));
+    initParser();
+
+    // when
+    int received = parseAll(frame, length);
+
+    // then
+    EXPECT_EQ(1, received);
+    EXPECT_EQ(MSP_V1, parser.version);
+    EXPECT_EQ(210, parser.cmd);
+    EXPECT_EQ(sizeof(payload), parser.dataSize);
+    EXPECT_EQ(0, memcmp(payload, buffer, sizeof(payload)));
+}
+
+TEST(MspFrameTest, ReceiveV2FrameWithLargeCommandAndPayload)
+{
+    // given
+    uint8_t payload[TEST_BUFFER_SIZE];
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    for (int index = 0; index < TEST_BUFFER_SIZE; index++) {
+        payload[index] = index * 7;
+    }
+    uint16_t length = buildV2Frame(frame, 0x1234, payload, sizeof(payload));
+    initParser();
+
+    // when
+    int received = parseAll(frame, length);
+
+    // then
+    EXPECT_EQ(1, received);
+    EXPECT_EQ(MSP_V2, parser.version);
+    EXPECT_EQ(0x1234, parser.cmd);
+    EXPECT_EQ(TEST_BUFFER_SIZE, parser.dataSize);
+    EXPECT_EQ(0, memcmp(payload, buffer, sizeof(payload)));
+    EXPECT_TRUE(guardIntact());
+}
+
+TEST(MspFrameTest, ReceiveFrameWithoutPayload)
+{
+    // given
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    uint16_t length = buildV2Frame(frame, 100, NULL, 0);
+    initParser();
+
+    // when
+    int received = parseAll(frame, length);
+
+    // then
+    EXPECT_EQ(1, received);
+    EXPECT_EQ(0, parser.dataSize);
+}
+
+TEST(MspFrameTest, BytesOutsideOfFramesAreLeftToOtherProtocols)
+{
+    // given
+    initParser();
+
+    // expect
+    EXPECT_EQ(MSP_FRAME_NONE, mspFrameParse(&parser, '#'));
+    EXPECT_EQ(MSP_FRAME_PENDING, mspFrameParse(&parser, '$'));
+    EXPECT_EQ(MSP_FRAME_PENDING, mspFrameParse(&parser, 'Q'));
+    EXPECT_EQ(MSP_FRAME_NONE, mspFrameParse(&parser, '#'));
+}
+
+TEST(MspFrameTest, BadChecksumIsRejected)
+{
+    // given
+    uint8_t payload[] = { 0x10, 0x20 };
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    uint16_t length = buildV2Frame(frame, 0x1000, payload, sizeof(payload));
+    frame[length - 1] ^= 0x01;
+    initParser();
+
+    // when
+    for (int index = 0; index < length - 1; index++) {
+        EXPECT_EQ(MSP_FRAME_PENDING, mspFrameParse(&parser, frame[index]));
+    }
+
+    // then
+    EXPECT_EQ(MSP_FRAME_INVALID, mspFrameParse(&parser, frame[length - 1]));
+    EXPECT_EQ(MSP_IDLE, parser.state);
+}
+
+TEST(MspFrameTest, PayloadLargerThanTheBufferIsRejected)
+{
+    // given
+    uint8_t header[] = { '$', 'X', '<', 0, 100, 0, TEST_BUFFER_SIZE + 1, 0 };
+    uint8_t payload[] = { 0x01 };
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    uint16_t length = buildV2Frame(frame, 101, payload, sizeof(payload));
+    initParser();
+
+    // when
+    for (unsigned index = 0; index < sizeof(header) - 1; index++) {
+        EXPECT_EQ(MSP_FRAME_PENDING, mspFrameParse(&parser, header[index]));
+    }
+    EXPECT_EQ(MSP_FRAME_INVALID, mspFrameParse(&parser, header[sizeof(header) - 1]));
+
+    // then
+    EXPECT_TRUE(guardIntact());
+    // the next frame is received
+    EXPECT_EQ(1, parseAll(frame, length));
+    EXPECT_EQ(101, parser.cmd);
+}
+
+TEST(MspFrameTest, RepeatedStartResynchronizes)
+{
+    // given
+    uint8_t frame[TEST_FRAME_MAX_SIZE + 2];
+    frame[0] = '$';
+    frame[1] = '$';
+    uint16_t length = 2 + buildV1Frame(&frame[2], 100, NULL, 0);
+    initParser();
+
+    // expect
+    EXPECT_EQ(1, parseAll(frame, length));
+}
+
+TEST(MspFrameTest, FuzzRandomBytes)
+{
+    // given
+    randomState = 1;
+    initParser();
+
+    // when
+    for (int iteration = 0; iteration < FUZZ_ITERATIONS * 10; iteration++) {
+        // bias the noise towards frame headers so the payload and checksum states are reached too
+        uint8_t c = randomByte();
+        switch (c & 0x0F) {
+        case 0: c = '$'; break;
+        case 1: c = (c & 0x10) ? 'M' : 'X'; break;
+        case 2: c = '<'; break;
+        case 3: c &= 0x1F; break;
+        }
+
+        mspFrameResult_e result = mspFrameParse(&parser, c);
+
+        // then
+        ASSERT_LE(parser.offset, TEST_BUFFER_SIZE);
+        ASSERT_TRUE(guardIntact());
+        if (result == MSP_FRAME_RECEIVED) {
+            ASSERT_LE(parser.dataSize, TEST_BUFFER_SIZE);
+            ASSERT_EQ(parser.dataSize, parser.offset);
+        }
+    }
+}
+
+TEST(MspFrameTest, FuzzFramesBackToBack)
+{
+    // given
+    uint8_t payload[TEST_BUFFER_SIZE];
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    randomState = 2;
+    initParser();
+
+    for (int iteration = 0; iteration < FUZZ_ITERATIONS; iteration++) {
+        bool v2 = randomByte() & 1;
+        uint16_t size = randomByte() % (TEST_BUFFER_SIZE + 1);
+        uint16_t cmd = v2 ? (randomByte() << 8 | randomByte()) : randomByte();
+        for (int index = 0; index < size; index++) {
+            payload[index] = randomByte();
+        }
+        uint16_t length = v2 ? buildV2Frame(frame, cmd, payload, size) : buildV1Frame(frame, cmd, payload, size);
+
+        // when
+        int received = parseAll(frame, length);
+
+        // then
+        ASSERT_EQ(1, received);
+        ASSERT_EQ(v2 ? MSP_V2 : MSP_V1, parser.version);
+        ASSERT_EQ(cmd, parser.cmd);
+        ASSERT_EQ(size, parser.dataSize);
+        ASSERT_EQ(0, memcmp(payload, buffer, size));
+        ASSERT_TRUE(guardIntact());
+    }
+}
+
+TEST(MspFrameTest, FuzzSingleBitErrorsAreDetected)
+{
+    // given
+    uint8_t payload[TEST_BUFFER_SIZE];
+    uint8_t frame[TEST_FRAME_MAX_SIZE];
+    randomState = 3;
+
+    for (int iteration = 0; iteration < FUZZ_ITERATIONS; iteration++) {
+        bool v2 = randomByte() & 1;
+        uint16_t size = 1 + randomByte() % TEST_BUFFER_SIZE;
+        for (int index = 0; index < size; index++) {
+            payload[index] = randomByte();
+        }
+        uint16_t length = v2 ? buildV2Frame(frame, 0x1000, payload, size) : buildV1Frame(frame, 101, payload, size);
+
+        // flip a bit of the payload or the checksum, and for v2 also of the flags or the command
+        uint16_t first = v2 ? 3 : 5;
+        uint16_t sizeOffset = v2 ? 6 : 3;
+        uint16_t position;
+        do {
+            position = first + (randomByte() << 8 | randomByte()) % (length - first);
+        } while (position == sizeOffset || position == sizeOffset + 1);
+        frame[position] ^= 1 << (randomByte() & 7);
+        initParser();
+
+        // when
+        int received = parseAll(frame, length);
+
+        // then
+        ASSERT_EQ(0, received);
+        ASSERT_TRUE(guardIntact());
+    }
+}
@@ -21,6 +21,32 @@
 #define GPS
 #define TELEMETRY
 #define LED_STRIP
+#define PROFILING
+#define FAST_MATH
 
 #define SERIAL_PORT_COUNT 4
 
+
+// stand-ins for the flash driver used by the config storage, the tests emulate the flash
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+
+// stand-ins for the MCU types used by the sensor drivers, the tests emulate the bus and do not drive any pins
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef struct {
+    uint32_t IDR;
+    uint32_t ODR;
+} GPIO_TypeDef;
+
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
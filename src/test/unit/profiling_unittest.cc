@@ -0,0 +1,137 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <limits.h>
+
+#include "platform.h"
+#include "common/profiling.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint32_t simulatedTime = 0;
+
+static void timeStage(profileStage_e stage, uint32_t duration)
+{
+    PROFILE_STAGE_BEGIN(stage);
+    simulatedTime += duration;
+    PROFILE_STAGE_END(stage);
+}
+
+TEST(ProfilingUnittest, RecordsMinAverageAndMax)
+{
+    // given
+    profilingInit();
+
+    // when
+    timeStage(PROFILE_STAGE_PID, 100);
+    timeStage(PROFILE_STAGE_PID, 300);
+    timeStage(PROFILE_STAGE_PID, 200);
+
+    // then
+    const profileStageStats_t *stats = getProfileStageStats(PROFILE_STAGE_PID);
+    EXPECT_EQ(3u, stats->count);
+    EXPECT_EQ(100u, stats->minCycles);
+    EXPECT_EQ(300u, stats->maxCycles);
+    EXPECT_EQ(600u, stats->totalCycles);
+    EXPECT_EQ(200u, getProfileStageAverageCycles(PROFILE_STAGE_PID));
+
+    // and - other stages are untouched
+    EXPECT_EQ(0u, getProfileStageStats(PROFILE_STAGE_IMU)->count);
+    EXPECT_EQ(0u, getProfileStageAverageCycles(PROFILE_STAGE_IMU));
+}
+
+TEST(ProfilingUnittest, SortsSamplesIntoLog2Buckets)
+{
+    // given
+    profilingInit();
+
+    // when
+    timeStage(PROFILE_STAGE_MIXER, 0);
+    timeStage(PROFILE_STAGE_MIXER, 3);
+    timeStage(PROFILE_STAGE_MIXER, 4);
+    timeStage(PROFILE_STAGE_MIXER, 7);
+    timeStage(PROFILE_STAGE_MIXER, 8);
+    timeStage(PROFILE_STAGE_MIXER, 1023);
+    timeStage(PROFILE_STAGE_MIXER, 1024);
+    timeStage(PROFILE_STAGE_MIXER, 100000);
+
+    // then
+    const profileStageStats_t *stats = getProfileStageStats(PROFILE_STAGE_MIXER);
+    EXPECT_EQ(2, stats->histogram[0]);
+    EXPECT_EQ(2, stats->histogram[1]);
+    EXPECT_EQ(1, stats->histogram[2]);
+    EXPECT_EQ(1, stats->histogram[PROFILE_HISTOGRAM_BUCKET_COUNT - 2]);
+    EXPECT_EQ(2, stats->histogram[PROFILE_HISTOGRAM_BUCKET_COUNT - 1]);
+}
+
+TEST(ProfilingUnittest, FullHistogramBucketHalvesAllBuckets)
+{
+    // given
+    profilingInit();
+    timeStage(PROFILE_STAGE_SERIAL, 10);
+    timeStage(PROFILE_STAGE_SERIAL, 10);
+    for (uint32_t i = 0; i < UINT16_MAX; i++) {
+        timeStage(PROFILE_STAGE_SERIAL, 1);
+    }
+
+    // when
+    timeStage(PROFILE_STAGE_SERIAL, 1);
+
+    // then
+    const profileStageStats_t *stats = getProfileStageStats(PROFILE_STAGE_SERIAL);
+    EXPECT_EQ(UINT16_MAX / 2 + 1, stats->histogram[0]);
+    EXPECT_EQ(1, stats->histogram[2]);
+    EXPECT_EQ(UINT16_MAX + 3u, stats->count);
+}
+
+TEST(ProfilingUnittest, ResetClearsStatistics)
+{
+    // given
+    profilingInit();
+    timeStage(PROFILE_STAGE_LEDSTRIP, 50);
+
+    // when
+    profilingReset();
+
+    // then
+    const profileStageStats_t *stats = getProfileStageStats(PROFILE_STAGE_LEDSTRIP);
+    EXPECT_EQ(0u, stats->count);
+    EXPECT_EQ(0u, stats->maxCycles);
+    EXPECT_EQ(0, stats->histogram[PROFILE_HISTOGRAM_BUCKET_COUNT - 2]);
+
+    // and - the first sample after a reset is the minimum
+    timeStage(PROFILE_STAGE_LEDSTRIP, 5000);
+    EXPECT_EQ(5000u, stats->minCycles);
+}
+
+TEST(ProfilingUnittest, HostClockIsMicroseconds)
+{
+    // expect
+    profilingInit();
+    EXPECT_EQ(1u, getProfileCyclesPerMicrosecond());
+    EXPECT_STREQ("TELEMETRY", getProfileStageName(PROFILE_STAGE_TELEMETRY));
+}
+
+// STUBS
+
+uint32_t micros(void)
+{
+    return simulatedTime;
+}
@@ -0,0 +1,132 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "drivers/pwm_dshot.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+static uint16_t decodeSlots(const uint16_t *slots, uint8_t stride, const dshotBitTiming_t *timing)
+{
+    uint16_t packet = 0;
+
+    for (int bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+        packet = (packet << 1) | (slots[bit * stride] == timing->bit1 ? 1 : 0);
+    }
+    return packet;
+}
+
+TEST(PwmDshotTest, TestPacketOfKnownFrames)
+{
+    // expect throttle, telemetry bit and the XOR of the nibbles
+    EXPECT_EQ(0x0000, dshotPacket(0, false));
+    EXPECT_EQ(0x0011, dshotPacket(0, true));
+    EXPECT_EQ(0x0606, dshotPacket(48, false));
+    EXPECT_EQ(0x8008, dshotPacket(1024, false));
+    EXPECT_EQ(0xFFEE, dshotPacket(DSHOT_MAX_THROTTLE, false));
+    EXPECT_EQ(0xFFFF, dshotPacket(DSHOT_MAX_THROTTLE, true));
+}
+
+TEST(PwmDshotTest, TestPacketChecksumCoversEveryBit)
+{
+    for (uint16_t throttle = 0; throttle <= DSHOT_MAX_THROTTLE; throttle++) {
+        // given
+        uint16_t packet = dshotPacket(throttle, throttle & 1);
+
+        // expect
+        EXPECT_EQ(throttle, packet >> 5);
+        EXPECT_EQ(0, (packet ^ (packet >> 4) ^ (packet >> 8) ^ (packet >> 12)) & 0x0F);
+
+        // and a single flipped bit to fail the check
+        for (int bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+            uint16_t corrupted = packet ^ (1 << bit);
+            EXPECT_NE(0, (corrupted ^ (corrupted >> 4) ^ (corrupted >> 8) ^ (corrupted >> 12)) & 0x0F);
+        }
+    }
+}
+
+TEST(PwmDshotTest, TestThrottleFromPulse)
+{
+    // expect
+    EXPECT_EQ(DSHOT_DISARMED, dshotThrottleFromPulse(900));
+    EXPECT_EQ(DSHOT_DISARMED, dshotThrottleFromPulse(1000));
+    EXPECT_EQ(DSHOT_MIN_THROTTLE + 1, dshotThrottleFromPulse(1001));
+    EXPECT_EQ(1047, dshotThrottleFromPulse(1500));
+    EXPECT_EQ(DSHOT_MAX_THROTTLE, dshotThrottleFromPulse(2000));
+    EXPECT_EQ(DSHOT_MAX_THROTTLE, dshotThrottleFromPulse(2100));
+
+    for (uint16_t pulse = 1001; pulse < 2000; pulse++) {
+        EXPECT_LT(dshotThrottleFromPulse(pulse), dshotThrottleFromPulse(pulse + 1));
+    }
+}
+
+TEST(PwmDshotTest, TestBitTimingForEachRate)
+{
+    // given
+    dshotBitTiming_t timing;
+
+    // expect at 72MHz
+    dshotBitTimingInit(&timing, 72000000, 600);
+    EXPECT_EQ(120, timing.period);
+    EXPECT_EQ(90, timing.bit1);
+    EXPECT_EQ(45, timing.bit0);
+
+    dshotBitTimingInit(&timing, 72000000, 300);
+    EXPECT_EQ(240, timing.period);
+    EXPECT_EQ(180, timing.bit1);
+    EXPECT_EQ(90, timing.bit0);
+
+    dshotBitTimingInit(&timing, 72000000, 150);
+    EXPECT_EQ(480, timing.period);
+
+    // and the F1 internal oscillator within 1% of the bit rate
+    dshotBitTimingInit(&timing, 64000000, 600);
+    EXPECT_EQ(107, timing.period);
+    EXPECT_EQ(80, timing.bit1);
+    EXPECT_EQ(40, timing.bit0);
+}
+
+TEST(PwmDshotTest, TestEncodeInterleavesMotorsOfATimer)
+{
+    // given
+    dshotBitTiming_t timing;
+    uint16_t slots[DSHOT_FRAME_SLOTS * 4];
+    const uint16_t packets[4] = { dshotPacket(48, false), dshotPacket(1024, true), dshotPacket(0, false), dshotPacket(2047, false) };
+
+    dshotBitTimingInit(&timing, 72000000, 600);
+    memset(slots, 0xFF, sizeof(slots));
+
+    // when
+    for (int channel = 0; channel < 4; channel++) {
+        dshotEncodePacket(&slots[channel], 4, packets[channel], &timing);
+    }
+
+    // then
+    for (int channel = 0; channel < 4; channel++) {
+        EXPECT_EQ(packets[channel], decodeSlots(&slots[channel], 4, &timing));
+        for (int bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+            uint16_t slot = slots[bit * 4 + channel];
+            EXPECT_TRUE(slot == timing.bit0 || slot == timing.bit1);
+        }
+        for (int trailing = DSHOT_FRAME_BITS; trailing < DSHOT_FRAME_SLOTS; trailing++) {
+            EXPECT_EQ(0, slots[trailing * 4 + channel]);
+        }
+    }
+}
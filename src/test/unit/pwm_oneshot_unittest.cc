@@ -0,0 +1,95 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "drivers/pwm_oneshot.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// timer clocks of the targets: F1 and F3 from the crystal, F1 on its internal oscillator, F1 overclocked
+static const uint32_t timerClocksHz[] = { 72000000, 64000000, 80000000, 84000000 };
+
+#define TIMER_CLOCK_COUNT (sizeof(timerClocksHz) / sizeof(timerClocksHz[0]))
+
+TEST(PwmOneshotTest, TestTimerMhzForEachTargetClock)
+{
+    // expect
+    EXPECT_EQ(24, oneshot125TimerMhz(72000000));
+    EXPECT_EQ(16, oneshot125TimerMhz(64000000));
+    EXPECT_EQ(20, oneshot125TimerMhz(80000000));
+    EXPECT_EQ(21, oneshot125TimerMhz(84000000));
+}
+
+TEST(PwmOneshotTest, TestTimerMhzNeedsNoRoundingInThePrescaler)
+{
+    for (unsigned clockIndex = 0; clockIndex < TIMER_CLOCK_COUNT; clockIndex++) {
+        // given
+        uint32_t timerClockHz = timerClocksHz[clockIndex];
+        uint8_t mhz = oneshot125TimerMhz(timerClockHz);
+
+        // when, as configTimeBase() computes it
+        uint32_t prescaler = timerClockHz / (mhz * 1000000) - 1;
+
+        // then
+        EXPECT_LE(mhz, ONESHOT125_TIMER_MAX_MHZ);
+        EXPECT_EQ((uint32_t)mhz * 1000000, timerClockHz / (prescaler + 1));
+    }
+}
+
+TEST(PwmOneshotTest, TestPulseWidthForEachTargetClock)
+{
+    for (unsigned clockIndex = 0; clockIndex < TIMER_CLOCK_COUNT; clockIndex++) {
+        // given
+        uint8_t mhz = oneshot125TimerMhz(timerClocksHz[clockIndex]);
+
+        // expect 125us to 250us
+        EXPECT_EQ(125 * mhz, oneshot125PulseTicks(1000, mhz));
+        EXPECT_EQ(250 * mhz, oneshot125PulseTicks(2000, mhz));
+
+        // and every value within half a tick of value / 8 microseconds
+        for (uint16_t value = 1000; value <= 2000; value++) {
+            int32_t errorInEighthTicks = oneshot125PulseTicks(value, mhz) * 8 - value * mhz;
+            EXPECT_LE(abs(errorInEighthTicks), 4);
+        }
+    }
+}
+
+TEST(PwmOneshotTest, TestEveryThrottleStepChangesThePulse)
+{
+    for (unsigned clockIndex = 0; clockIndex < TIMER_CLOCK_COUNT; clockIndex++) {
+        // given
+        uint8_t mhz = oneshot125TimerMhz(timerClocksHz[clockIndex]);
+
+        // expect
+        for (uint16_t value = 1000; value < 2000; value++) {
+            EXPECT_LT(oneshot125PulseTicks(value, mhz), oneshot125PulseTicks(value + 1, mhz));
+        }
+    }
+}
+
+TEST(PwmOneshotTest, TestLongestPulseEndsBeforeTheTimerWraps)
+{
+    for (unsigned clockIndex = 0; clockIndex < TIMER_CLOCK_COUNT; clockIndex++) {
+        // given
+        uint8_t mhz = oneshot125TimerMhz(timerClocksHz[clockIndex]);
+
+        // expect the 3D and calibration range as well
+        EXPECT_LT(oneshot125PulseTicks(2500, mhz), 0xFFFF);
+    }
+}
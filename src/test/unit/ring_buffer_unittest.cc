@@ -0,0 +1,365 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "common/ring_buffer.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_BUFFER_SIZE 16
+
+static volatile uint8_t storage[TEST_BUFFER_SIZE];
+static ringBuffer_t ringBuffer;
+
+static void makeData(uint8_t *data, uint16_t length, uint8_t seed)
+{
+    uint16_t index;
+
+    for (index = 0; index < length; index++) {
+        data[index] = seed + index;
+    }
+}
+
+TEST(RingBufferTest, EmptyAfterInit)
+{
+    // given
+    uint8_t data;
+
+    // when
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // then
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferSize(&ringBuffer));
+    EXPECT_EQ(0, ringBufferCount(&ringBuffer));
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferFree(&ringBuffer));
+    EXPECT_FALSE(ringBufferGet(&ringBuffer, &data));
+}
+
+TEST(RingBufferTest, PutAndGetInOrder)
+{
+    // given
+    uint8_t data;
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    EXPECT_TRUE(ringBufferPut(&ringBuffer, 0x12));
+    EXPECT_TRUE(ringBufferPut(&ringBuffer, 0x34));
+
+    // then
+    EXPECT_EQ(2, ringBufferCount(&ringBuffer));
+    EXPECT_TRUE(ringBufferGet(&ringBuffer, &data));
+    EXPECT_EQ(0x12, data);
+    EXPECT_TRUE(ringBufferGet(&ringBuffer, &data));
+    EXPECT_EQ(0x34, data);
+    EXPECT_EQ(0, ringBufferCount(&ringBuffer));
+}
+
+TEST(RingBufferTest, AllBytesOfTheBufferAreUsed)
+{
+    // given
+    uint8_t index;
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    for (index = 0; index < TEST_BUFFER_SIZE; index++) {
+        EXPECT_TRUE(ringBufferPut(&ringBuffer, index));
+    }
+
+    // then
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferCount(&ringBuffer));
+    EXPECT_EQ(0, ringBufferFree(&ringBuffer));
+    // a full buffer drops the byte
+    EXPECT_FALSE(ringBufferPut(&ringBuffer, 0xFF));
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferCount(&ringBuffer));
+}
+
+TEST(RingBufferTest, BulkWriteAndReadAroundTheEnd)
+{
+    // given
+    uint8_t written[12];
+    uint8_t read[12];
+    uint8_t filler[10];
+    makeData(written, sizeof(written), 0x40);
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+    ringBufferWrite(&ringBuffer, filler, sizeof(filler));
+    ringBufferRead(&ringBuffer, filler, sizeof(filler));
+
+    // when
+    EXPECT_EQ(sizeof(written), ringBufferWrite(&ringBuffer, written, sizeof(written)));
+
+    // then
+    EXPECT_EQ(sizeof(read), ringBufferRead(&ringBuffer, read, sizeof(read)));
+    EXPECT_EQ(0, memcmp(written, read, sizeof(read)));
+    EXPECT_EQ(0, ringBufferCount(&ringBuffer));
+}
+
+TEST(RingBufferTest, BulkWriteDropsWhatDoesNotFit)
+{
+    // given
+    uint8_t written[TEST_BUFFER_SIZE + 4];
+    uint8_t read[TEST_BUFFER_SIZE + 4];
+    makeData(written, sizeof(written), 1);
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    uint16_t count = ringBufferWrite(&ringBuffer, written, sizeof(written));
+
+    // then
+    EXPECT_EQ(TEST_BUFFER_SIZE, count);
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferRead(&ringBuffer, read, sizeof(read)));
+    EXPECT_EQ(0, memcmp(written, read, TEST_BUFFER_SIZE));
+}
+
+TEST(RingBufferTest, ReadPointerStopsAtTheEnd)
+{
+    // given
+    uint8_t filler[12];
+    uint8_t written[8];
+    uint16_t contiguous;
+    makeData(written, sizeof(written), 0x80);
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+    ringBufferWrite(&ringBuffer, filler, sizeof(filler));
+    ringBufferRead(&ringBuffer, filler, sizeof(filler));
+    ringBufferWrite(&ringBuffer, written, sizeof(written));
+
+    // when
+    const uint8_t *data = ringBufferReadPointer(&ringBuffer, &contiguous);
+
+    // then
+    EXPECT_EQ(TEST_BUFFER_SIZE - sizeof(filler), contiguous);
+    EXPECT_EQ(0, memcmp(written, data, contiguous));
+
+    // and the rest is at the start once consumed
+    ringBufferConsume(&ringBuffer, contiguous);
+    data = ringBufferReadPointer(&ringBuffer, &contiguous);
+    EXPECT_EQ(sizeof(written) - (TEST_BUFFER_SIZE - sizeof(filler)), contiguous);
+    EXPECT_EQ((const uint8_t *)storage, data);
+}
+
+TEST(RingBufferTest, WritePointerFilledInPlace)
+{
+    // given
+    uint16_t contiguous;
+    uint8_t data;
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    uint8_t *space = ringBufferWritePointer(&ringBuffer, &contiguous);
+    space[0] = 0xA5;
+    space[1] = 0x5A;
+    ringBufferProduce(&ringBuffer, 2);
+
+    // then
+    EXPECT_EQ(TEST_BUFFER_SIZE, contiguous);
+    EXPECT_EQ(2, ringBufferCount(&ringBuffer));
+    EXPECT_TRUE(ringBufferGet(&ringBuffer, &data));
+    EXPECT_EQ(0xA5, data);
+}
+
+TEST(RingBufferTest, ProduceUpToFollowsACircularDma)
+{
+    // given
+    uint8_t read[TEST_BUFFER_SIZE];
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    // the DMA wrote 10 bytes, they were read, then 10 more wrapping around the end
+    ringBufferProduceUpTo(&ringBuffer, 10);
+    EXPECT_EQ(10, ringBufferRead(&ringBuffer, read, sizeof(read)));
+    ringBufferProduceUpTo(&ringBuffer, 4);
+
+    // then
+    EXPECT_EQ(10, ringBufferCount(&ringBuffer));
+}
+
+TEST(RingBufferTest, HighWaterMark)
+{
+    // given
+    uint8_t data[TEST_BUFFER_SIZE];
+    makeData(data, sizeof(data), 0);
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    ringBufferWrite(&ringBuffer, data, 5);
+    ringBufferRead(&ringBuffer, data, 5);
+    ringBufferWrite(&ringBuffer, data, 3);
+
+    // then
+    EXPECT_EQ(5, ringBuffer.highWaterMark);
+
+    // and
+    ringBufferWrite(&ringBuffer, data, 9);
+    EXPECT_EQ(12, ringBuffer.highWaterMark);
+}
+
+TEST(RingBufferTest, IndexesWrapAt16Bits)
+{
+    // given
+    uint8_t data[7];
+    uint8_t read[7];
+    uint32_t iteration;
+    ringBufferInit(&ringBuffer, storage, TEST_BUFFER_SIZE);
+
+    // when
+    for (iteration = 0; iteration < 20000; iteration++) {
+        makeData(data, sizeof(data), iteration);
+        ASSERT_EQ(sizeof(data), ringBufferWrite(&ringBuffer, data, sizeof(data)));
+        ASSERT_EQ(sizeof(read), ringBufferRead(&ringBuffer, read, sizeof(read)));
+        ASSERT_EQ(0, memcmp(data, read, sizeof(read)));
+    }
+
+    // then
+    EXPECT_EQ(0, ringBufferCount(&ringBuffer));
+    EXPECT_EQ(TEST_BUFFER_SIZE, ringBufferFree(&ringBuffer));
+}
+
+/*
+ * A producer and a consumer thread, standing in for an interrupt handler and the main loop, pass a long sequence of
+ * bytes through a small buffer with every combination of single byte, bulk and in place operations. Any byte lost,
+ * duplicated or read before it was written breaks the sequence.
+ */
+
+#define STRESS_BUFFER_SIZE 64
+#define STRESS_BYTE_COUNT 1000000
+
+static volatile uint8_t stressStorage[STRESS_BUFFER_SIZE];
+static ringBuffer_t stressBuffer;
+
+static uint8_t sequenceByte(uint32_t position)
+{
+    return (position * 7) ^ (position >> 8);
+}
+
+static void *stressProducer(void *arg)
+{
+    uint32_t position = 0;
+    uint8_t chunk[23];
+    uint16_t count;
+    uint16_t contiguous;
+    uint8_t *space;
+
+    UNUSED(arg);
+
+    while (position < STRESS_BYTE_COUNT) {
+        if (ringBufferFree(&stressBuffer) == 0) {
+            // let the consumer run when both share a cpu
+            sched_yield();
+            continue;
+        }
+
+        switch (position % 3) {
+            case 0:
+                if (ringBufferPut(&stressBuffer, sequenceByte(position))) {
+                    position++;
+                }
+                break;
+            case 1:
+                count = 1 + position % sizeof(chunk);
+                if (count > STRESS_BYTE_COUNT - position) {
+                    count = STRESS_BYTE_COUNT - position;
+                }
+                for (uint16_t index = 0; index < count; index++) {
+                    chunk[index] = sequenceByte(position + index);
+                }
+                position += ringBufferWrite(&stressBuffer, chunk, count);
+                break;
+            default:
+                space = ringBufferWritePointer(&stressBuffer, &contiguous);
+                if (contiguous > STRESS_BYTE_COUNT - position) {
+                    contiguous = STRESS_BYTE_COUNT - position;
+                }
+                for (uint16_t index = 0; index < contiguous; index++) {
+                    space[index] = sequenceByte(position + index);
+                }
+                ringBufferProduce(&stressBuffer, contiguous);
+                position += contiguous;
+                break;
+        }
+    }
+
+    return NULL;
+}
+
+static void *stressConsumer(void *arg)
+{
+    uint32_t *errors = (uint32_t *)arg;
+    uint32_t position = 0;
+    uint8_t chunk[29];
+    uint8_t data;
+    uint16_t count;
+    uint16_t contiguous;
+    const uint8_t *bytes;
+
+    while (position < STRESS_BYTE_COUNT) {
+        if (ringBufferCount(&stressBuffer) == 0) {
+            sched_yield();
+            continue;
+        }
+
+        switch (position % 3) {
+            case 0:
+                if (ringBufferGet(&stressBuffer, &data)) {
+                    *errors += data != sequenceByte(position);
+                    position++;
+                }
+                break;
+            case 1:
+                count = ringBufferRead(&stressBuffer, chunk, 1 + position % sizeof(chunk));
+                for (uint16_t index = 0; index < count; index++) {
+                    *errors += chunk[index] != sequenceByte(position + index);
+                }
+                position += count;
+                break;
+            default:
+                bytes = ringBufferReadPointer(&stressBuffer, &contiguous);
+                for (uint16_t index = 0; index < contiguous; index++) {
+                    *errors += bytes[index] != sequenceByte(position + index);
+                }
+                ringBufferConsume(&stressBuffer, contiguous);
+                position += contiguous;
+                break;
+        }
+    }
+
+    return NULL;
+}
+
+TEST(RingBufferTest, ConcurrentProducerAndConsumer)
+{
+    // given
+    pthread_t producer;
+    pthread_t consumer;
+    uint32_t errors = 0;
+    ringBufferInit(&stressBuffer, stressStorage, STRESS_BUFFER_SIZE);
+
+    // when
+    ASSERT_EQ(0, pthread_create(&consumer, NULL, stressConsumer, &errors));
+    ASSERT_EQ(0, pthread_create(&producer, NULL, stressProducer, NULL));
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    // then
+    EXPECT_EQ(0, errors);
+    EXPECT_EQ(0, ringBufferCount(&stressBuffer));
+    EXPECT_LE(stressBuffer.highWaterMark, STRESS_BUFFER_SIZE);
+}
@@ -0,0 +1,293 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <limits.h>
+
+#include "platform.h"
+#include "scheduler/scheduler.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// fake clock and scripted task costs
+
+static uint32_t simulatedTime = 0;
+static uint32_t taskCost[TASK_COUNT];
+static uint32_t taskRunCount[TASK_COUNT];
+static uint32_t taskLastRunAt[TASK_COUNT];
+static uint32_t taskMaxInterval[TASK_COUNT];
+static bool rxFrameReady = false;
+static uint32_t rxFrameInterval = 0;
+
+#define SCHEDULER_PASS_OVERHEAD 2
+
+static void resetSimulation(void)
+{
+    simulatedTime = 0;
+    memset(taskCost, 0, sizeof(taskCost));
+    memset(taskRunCount, 0, sizeof(taskRunCount));
+    memset(taskLastRunAt, 0, sizeof(taskLastRunAt));
+    memset(taskMaxInterval, 0, sizeof(taskMaxInterval));
+    rxFrameReady = false;
+    rxFrameInterval = 0;
+
+    schedulerInit();
+
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; taskId++) {
+        setTaskEnabled((cfTaskId_e)taskId, true);
+    }
+    rescheduleTask(TASK_GYROPID, 1000);
+}
+
+static void runTask(cfTaskId_e taskId)
+{
+    if (taskRunCount[taskId] > 0) {
+        uint32_t interval = simulatedTime - taskLastRunAt[taskId];
+        if (interval > taskMaxInterval[taskId]) {
+            taskMaxInterval[taskId] = interval;
+        }
+    }
+    taskLastRunAt[taskId] = simulatedTime;
+    taskRunCount[taskId]++;
+    simulatedTime += taskCost[taskId];
+}
+
+static void runSchedulerFor(uint32_t duration)
+{
+    uint32_t endAt = simulatedTime + duration;
+    while (simulatedTime < endAt) {
+        scheduler();
+        simulatedTime += SCHEDULER_PASS_OVERHEAD;
+    }
+}
+
+TEST(SchedulerUnittest, RealtimeTaskRunsOnTimeWhenOtherTasksFitInTheSlack)
+{
+    // given
+    resetSimulation();
+    taskCost[TASK_GYROPID] = 350;
+    taskCost[TASK_RX] = 120;
+    taskCost[TASK_SERIAL] = 200;
+    taskCost[TASK_GPS] = 300;
+    taskCost[TASK_BARO] = 150;
+    taskCost[TASK_ALTITUDE] = 100;
+    taskCost[TASK_TELEMETRY] = 250;
+    taskCost[TASK_LEDSTRIP] = 400;
+    rxFrameReady = true;
+    rxFrameInterval = 20000;
+
+    // and - let the averages settle
+    runSchedulerFor(100000);
+    memset(taskMaxInterval, 0, sizeof(taskMaxInterval));
+
+    // when
+    runSchedulerFor(1000000);
+
+    // then
+    uint32_t worstCaseScheduling = 2 * SCHEDULER_PASS_OVERHEAD;
+    EXPECT_LE(taskMaxInterval[TASK_GYROPID], 1000 + worstCaseScheduling);
+    EXPECT_GE(taskRunCount[TASK_GYROPID], 1100u - 20);
+
+    // and - every other task still runs at roughly its desired rate
+    EXPECT_GE(taskRunCount[TASK_RX], 50u);
+    EXPECT_GE(taskRunCount[TASK_SERIAL], 90u);
+    EXPECT_GE(taskRunCount[TASK_GPS], 10u);
+    EXPECT_GE(taskRunCount[TASK_BARO], 20u);
+    EXPECT_GE(taskRunCount[TASK_ALTITUDE], 40u);
+}
+
+TEST(SchedulerUnittest, TaskThatCannotFitIntoAnyPeriodIsNotStarved)
+{
+    // given
+    resetSimulation();
+    taskCost[TASK_GYROPID] = 300;
+    taskCost[TASK_GPS] = 1500;
+
+    // when
+    runSchedulerFor(1000000);
+
+    // then
+    EXPECT_GE(taskRunCount[TASK_GPS], 9u);
+    EXPECT_EQ(1500u, cfTasks[TASK_GPS].maxExecutionTime);
+}
+
+TEST(SchedulerUnittest, TaskIsHeldBackWhenItWouldDelayTheRealtimeTask)
+{
+    // given
+    resetSimulation();
+    taskCost[TASK_GYROPID] = 100;
+    taskCost[TASK_LEDSTRIP] = 600;
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; taskId++) {
+        setTaskEnabled((cfTaskId_e)taskId, taskId == TASK_GYROPID || taskId == TASK_LEDSTRIP);
+    }
+
+    // and - the led strip task has a known average execution time
+    runSchedulerFor(1000000);
+    EXPECT_EQ(600u, cfTasks[TASK_LEDSTRIP].averageExecutionTime);
+
+    // when - only 500us remain until the realtime task is due
+    simulatedTime = cfTasks[TASK_GYROPID].lastExecutedAt + 500;
+    cfTasks[TASK_LEDSTRIP].lastExecutedAt = simulatedTime - 20000;
+    uint32_t ledStripRunCount = taskRunCount[TASK_LEDSTRIP];
+    scheduler();
+
+    // then
+    EXPECT_EQ(ledStripRunCount, taskRunCount[TASK_LEDSTRIP]);
+
+    // when - the realtime task has just run
+    simulatedTime = cfTasks[TASK_GYROPID].lastExecutedAt + 1000;
+    scheduler();
+    scheduler();
+
+    // then
+    EXPECT_EQ(ledStripRunCount + 1, taskRunCount[TASK_LEDSTRIP]);
+}
+
+TEST(SchedulerUnittest, OverdueLowPriorityTaskEventuallyBeatsHigherPriorityTask)
+{
+    // given
+    resetSimulation();
+    setTaskEnabled(TASK_GYROPID, false);
+
+    // and - serial (low priority) is 5 periods late, gps (medium priority) is just due
+    simulatedTime = 1000000;
+    cfTasks[TASK_SERIAL].lastExecutedAt = simulatedTime - 5 * cfTasks[TASK_SERIAL].desiredPeriod;
+    cfTasks[TASK_GPS].lastExecutedAt = simulatedTime - cfTasks[TASK_GPS].desiredPeriod;
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (taskId != TASK_SERIAL && taskId != TASK_GPS) {
+            setTaskEnabled((cfTaskId_e)taskId, false);
+        }
+    }
+
+    // when
+    scheduler();
+
+    // then
+    EXPECT_EQ(1u, taskRunCount[TASK_SERIAL]);
+    EXPECT_EQ(0u, taskRunCount[TASK_GPS]);
+    EXPECT_EQ(0, cfTasks[TASK_SERIAL].dynamicPriority);
+    EXPECT_EQ(1 + TASK_PRIORITY_MEDIUM, cfTasks[TASK_GPS].dynamicPriority);
+}
+
+TEST(SchedulerUnittest, EventDrivenTaskOnlyRunsWhenSignalled)
+{
+    // given
+    resetSimulation();
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; taskId++) {
+        setTaskEnabled((cfTaskId_e)taskId, taskId == TASK_RX);
+    }
+
+    // when
+    rxFrameReady = false;
+    runSchedulerFor(100000);
+
+    // then
+    EXPECT_EQ(0u, taskRunCount[TASK_RX]);
+
+    // when
+    rxFrameReady = true;
+    scheduler();
+
+    // then
+    EXPECT_EQ(1u, taskRunCount[TASK_RX]);
+}
+
+TEST(SchedulerUnittest, ZeroLooptimeInterleavesRealtimeTaskWithOthers)
+{
+    // given
+    resetSimulation();
+    rescheduleTask(TASK_GYROPID, 0);
+    taskCost[TASK_GYROPID] = 500;
+    taskCost[TASK_SERIAL] = 100;
+    taskCost[TASK_GPS] = 100;
+
+    // when
+    runSchedulerFor(1000000);
+
+    // then
+    EXPECT_GE(taskRunCount[TASK_GYROPID], 1000u);
+    EXPECT_GE(taskRunCount[TASK_SERIAL], 50u);
+    EXPECT_GE(taskRunCount[TASK_GPS], 5u);
+}
+
+TEST(SchedulerUnittest, DisabledTaskNeverRuns)
+{
+    // given
+    resetSimulation();
+    setTaskEnabled(TASK_GPS, false);
+
+    // when
+    runSchedulerFor(1000000);
+
+    // then
+    EXPECT_EQ(0u, taskRunCount[TASK_GPS]);
+    EXPECT_GT(taskRunCount[TASK_SERIAL], 0u);
+}
+
+TEST(SchedulerUnittest, TaskInfoReportsExecutionStatistics)
+{
+    // given
+    resetSimulation();
+    taskCost[TASK_GYROPID] = 250;
+
+    // when
+    runSchedulerFor(200000);
+
+    // then
+    cfTaskInfo_t taskInfo;
+    getTaskInfo(TASK_GYROPID, &taskInfo);
+    EXPECT_STREQ("GYRO/PID", taskInfo.taskName);
+    EXPECT_TRUE(taskInfo.isEnabled);
+    EXPECT_EQ(1000u, taskInfo.desiredPeriod);
+    EXPECT_EQ(250u, taskInfo.averageExecutionTime);
+    EXPECT_EQ(250u, taskInfo.maxExecutionTime);
+    EXPECT_EQ(250u * taskRunCount[TASK_GYROPID], taskInfo.totalExecutionTime);
+    EXPECT_GE(taskInfo.latestDeltaTime, 1000u);
+}
+
+// STUBS
+
+uint32_t micros(void)
+{
+    return simulatedTime;
+}
+
+bool taskMainPidLoopCheck(uint32_t currentDeltaTime)
+{
+    return currentDeltaTime >= cfTasks[TASK_GYROPID].desiredPeriod;
+}
+void taskMainPidLoop(void) { runTask(TASK_GYROPID); }
+bool taskUpdateRxCheck(uint32_t currentDeltaTime)
+{
+    return rxFrameReady && currentDeltaTime >= rxFrameInterval;
+}
+void taskUpdateRxMain(void) { runTask(TASK_RX); }
+void taskHandleSerial(void) { runTask(TASK_SERIAL); }
+bool taskSaveConfigCheck(uint32_t currentDeltaTime)
+{
+    UNUSED(currentDeltaTime);
+    return false;
+}
+void taskSaveConfig(void) { runTask(TASK_CONFIG); }
+void taskUpdateGps(void) { runTask(TASK_GPS); }
+void taskUpdateBaro(void) { runTask(TASK_BARO); }
+void taskCalculateAltitude(void) { runTask(TASK_ALTITUDE); }
+void taskTelemetry(void) { runTask(TASK_TELEMETRY); }
+void taskLedStrip(void) { runTask(TASK_LEDSTRIP); }
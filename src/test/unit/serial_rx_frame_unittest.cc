@@ -0,0 +1,242 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "drivers/serial.h"
+#include "drivers/serial_rx_frame.h"
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define TEST_RING_SIZE 64
+#define TEST_MAX_FRAMES 4
+
+// A circular DMA writing into the ring, remaining counts down like the CNDTR register.
+static volatile uint8_t ring[TEST_RING_SIZE];
+static uint16_t remaining;
+
+static serialRxFrame_t rxFrame;
+
+static uint8_t receivedFrames[TEST_MAX_FRAMES][SERIAL_RX_FRAME_MAX_SIZE];
+static uint8_t receivedLengths[TEST_MAX_FRAMES];
+static const uint8_t *receivedPointers[TEST_MAX_FRAMES];
+static uint8_t receivedFrameCount;
+
+static void frameReceive(const uint8_t *frame, uint8_t length)
+{
+    if (receivedFrameCount < TEST_MAX_FRAMES) {
+        memcpy(receivedFrames[receivedFrameCount], frame, length);
+        receivedLengths[receivedFrameCount] = length;
+        receivedPointers[receivedFrameCount] = frame;
+    }
+    receivedFrameCount++;
+}
+
+static void fakeDmaInit(void)
+{
+    memset((void *)ring, 0, sizeof(ring));
+    remaining = TEST_RING_SIZE;
+    receivedFrameCount = 0;
+
+    serialRxFrameInit(&rxFrame, ring, TEST_RING_SIZE, frameReceive);
+}
+
+static void fakeDmaReceive(const uint8_t *data, uint16_t length)
+{
+    uint16_t index;
+
+    for (index = 0; index < length; index++) {
+        ring[TEST_RING_SIZE - remaining] = data[index];
+        if (--remaining == 0) {
+            remaining = TEST_RING_SIZE;
+        }
+    }
+}
+
+static void fakeIdleLine(void)
+{
+    serialRxFrameIdle(&rxFrame, TEST_RING_SIZE - remaining);
+}
+
+static void makeFrame(uint8_t *frame, uint8_t length, uint8_t seed)
+{
+    uint8_t index;
+
+    for (index = 0; index < length; index++) {
+        frame[index] = seed + index;
+    }
+}
+
+TEST(SerialRxFrameTest, FrameDeliveredInOneCall)
+{
+    // given
+    uint8_t frame[25];
+    makeFrame(frame, sizeof(frame), 0x0F);
+    fakeDmaInit();
+
+    // when
+    fakeDmaReceive(frame, sizeof(frame));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(1, receivedFrameCount);
+    EXPECT_EQ(sizeof(frame), receivedLengths[0]);
+    EXPECT_EQ(0, memcmp(frame, receivedFrames[0], sizeof(frame)));
+}
+
+TEST(SerialRxFrameTest, FrameIsPassedInPlace)
+{
+    // given
+    uint8_t frame[16];
+    makeFrame(frame, sizeof(frame), 1);
+    fakeDmaInit();
+
+    // when
+    fakeDmaReceive(frame, sizeof(frame));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ((const uint8_t *)&ring[0], receivedPointers[0]);
+}
+
+TEST(SerialRxFrameTest, NothingDeliveredWithoutData)
+{
+    // given
+    fakeDmaInit();
+
+    // when
+    fakeIdleLine();
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(0, receivedFrameCount);
+}
+
+TEST(SerialRxFrameTest, ConsecutiveFrames)
+{
+    // given
+    uint8_t first[25];
+    uint8_t second[16];
+    makeFrame(first, sizeof(first), 0x10);
+    makeFrame(second, sizeof(second), 0x80);
+    fakeDmaInit();
+
+    // when
+    fakeDmaReceive(first, sizeof(first));
+    fakeIdleLine();
+    fakeDmaReceive(second, sizeof(second));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(2, receivedFrameCount);
+    EXPECT_EQ(sizeof(first), receivedLengths[0]);
+    EXPECT_EQ(0, memcmp(first, receivedFrames[0], sizeof(first)));
+    EXPECT_EQ(sizeof(second), receivedLengths[1]);
+    EXPECT_EQ(0, memcmp(second, receivedFrames[1], sizeof(second)));
+}
+
+TEST(SerialRxFrameTest, FrameWrappingAroundTheRing)
+{
+    // given
+    uint8_t filler[TEST_RING_SIZE - 10];
+    uint8_t frame[25];
+    makeFrame(filler, sizeof(filler), 0);
+    makeFrame(frame, sizeof(frame), 0xA8);
+    fakeDmaInit();
+
+    fakeDmaReceive(filler, sizeof(filler));
+    fakeIdleLine();
+    receivedFrameCount = 0;
+
+    // when
+    fakeDmaReceive(frame, sizeof(frame));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(1, receivedFrameCount);
+    EXPECT_EQ(sizeof(frame), receivedLengths[0]);
+    EXPECT_EQ(0, memcmp(frame, receivedFrames[0], sizeof(frame)));
+    EXPECT_EQ(rxFrame.buffer, receivedPointers[0]);
+}
+
+TEST(SerialRxFrameTest, FrameEndingAtTheEndOfTheRing)
+{
+    // given
+    uint8_t filler[TEST_RING_SIZE - 16];
+    uint8_t frame[16];
+    makeFrame(filler, sizeof(filler), 0);
+    makeFrame(frame, sizeof(frame), 0x40);
+    fakeDmaInit();
+
+    fakeDmaReceive(filler, sizeof(filler));
+    fakeIdleLine();
+    receivedFrameCount = 0;
+
+    // when
+    fakeDmaReceive(frame, sizeof(frame));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(1, receivedFrameCount);
+    EXPECT_EQ(sizeof(frame), receivedLengths[0]);
+    EXPECT_EQ(0, memcmp(frame, receivedFrames[0], sizeof(frame)));
+}
+
+TEST(SerialRxFrameTest, OversizedBurstIsDropped)
+{
+    // given
+    uint8_t burst[SERIAL_RX_FRAME_MAX_SIZE + 1];
+    uint8_t frame[16];
+    makeFrame(burst, sizeof(burst), 0);
+    makeFrame(frame, sizeof(frame), 0x20);
+    fakeDmaInit();
+
+    // when
+    fakeDmaReceive(burst, sizeof(burst));
+    fakeIdleLine();
+    fakeDmaReceive(frame, sizeof(frame));
+    fakeIdleLine();
+
+    // then
+    // the following frame is received normally
+    EXPECT_EQ(1, receivedFrameCount);
+    EXPECT_EQ(sizeof(frame), receivedLengths[0]);
+    EXPECT_EQ(0, memcmp(frame, receivedFrames[0], sizeof(frame)));
+}
+
+TEST(SerialRxFrameTest, OversizedBurstWrappingAroundTheRingIsDropped)
+{
+    // given
+    uint8_t filler[TEST_RING_SIZE - 8];
+    uint8_t burst[SERIAL_RX_FRAME_MAX_SIZE + 1];
+    makeFrame(filler, sizeof(filler), 0);
+    makeFrame(burst, sizeof(burst), 0);
+    fakeDmaInit();
+
+    fakeDmaReceive(filler, sizeof(filler));
+    fakeIdleLine();
+    receivedFrameCount = 0;
+
+    // when
+    fakeDmaReceive(burst, sizeof(burst));
+    fakeIdleLine();
+
+    // then
+    EXPECT_EQ(0, receivedFrameCount);
+}
@@ -160,13 +160,15 @@ int16_t GPS_directionToHome;        // direction to home or hol point in degrees
 
 uint32_t micros(void) { return 0; }
 
-uint8_t serialTotalBytesWaiting(serialPort_t *instance) {
+uint32_t serialTotalBytesWaiting(serialPort_t *instance) {
     UNUSED(instance);
     return 0;
 }
 
-uint8_t serialRead(serialPort_t *instance) {
+uint32_t serialReadBuf(serialPort_t *instance, uint8_t *data, uint32_t maxCount) {
     UNUSED(instance);
+    UNUSED(data);
+    UNUSED(maxCount);
     return 0;
 }
 
@@ -0,0 +1,254 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Converts a blackbox log captured from the serial port to CSV, one row per frame. A capture can hold several logs,
+ * one per arming, each one starts with a new column header row. A summary of every log is written to stderr.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "blackbox/blackbox_encoding.h"
+
+#define HEADER_LINE_MAX 128
+
+typedef struct logStats_s {
+    uint32_t frames;
+    uint32_t skippedFrames;         // inter frames after lost data, before the next intra frame
+    uint32_t droppedFrames;         // frames the firmware dropped because the port did not keep up
+    uint32_t corruptBytes;
+} logStats_t;
+
+typedef struct logState_s {
+    bool started;
+    bool headerPrinted;
+    uint32_t index;
+    uint8_t motorCount;
+    uint32_t rateDenom;
+    bool haveLastIteration;
+    uint32_t lastIteration;
+    blackboxDecoder_t decoder;
+    logStats_t stats;
+} logState_t;
+
+static uint8_t *readFile(const char *filename, uint32_t *length)
+{
+    FILE *file = fopen(filename, "rb");
+    uint8_t *data;
+    long size;
+
+    if (!file) {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc(size > 0 ? size : 1);
+    if (data && fread(data, 1, size, file) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+
+    *length = size;
+    return data;
+}
+
+static void printSummary(const logState_t *log)
+{
+    if (!log->started) {
+        return;
+    }
+
+    fprintf(stderr, "log %u: %u frames, %u dropped by the firmware, %u skipped after %u corrupt bytes\n",
+        log->index, log->stats.frames, log->stats.droppedFrames, log->stats.skippedFrames, log->stats.corruptBytes);
+}
+
+static void startLog(logState_t *log)
+{
+    printSummary(log);
+
+    log->index++;
+    log->started = true;
+    log->headerPrinted = false;
+    log->motorCount = 0;
+    log->rateDenom = 1;
+    log->haveLastIteration = false;
+    memset(&log->stats, 0, sizeof(log->stats));
+    blackboxDecoderInit(&log->decoder, 0);
+}
+
+static void parseHeaderLine(logState_t *log, const char *line)
+{
+    const char *value = strchr(line, ':');
+
+    if (strncmp(line, "H ", 2) != 0 || !value) {
+        return;
+    }
+    value++;
+
+    if (strncmp(line, "H Product:", 10) == 0) {
+        startLog(log);
+    } else if (strncmp(line, "H Data version:", 15) == 0 && atoi(value) != BLACKBOX_DATA_VERSION) {
+        fprintf(stderr, "log %u: data version %d is not supported\n", log->index, atoi(value));
+    } else if (strncmp(line, "H Rate denom:", 13) == 0) {
+        log->rateDenom = atoi(value) > 0 ? atoi(value) : 1;
+    } else if (strncmp(line, "H Motors:", 9) == 0) {
+        log->motorCount = atoi(value);
+        blackboxDecoderInit(&log->decoder, log->motorCount);
+    }
+}
+
+static void printFieldNames(const logState_t *log)
+{
+    uint8_t index;
+
+    if (log->index > 1) {
+        printf("\n");
+    }
+
+    printf("loopIteration,time,axisPID[0],axisPID[1],axisPID[2],rcCommand[0],rcCommand[1],rcCommand[2],rcCommand[3],"
+        "gyroData[0],gyroData[1],gyroData[2],accSmooth[0],accSmooth[1],accSmooth[2]");
+    for (index = 0; index < log->motorCount; index++) {
+        printf(",motor[%u]", index);
+    }
+    printf("\n");
+}
+
+static void printFrame(logState_t *log, const blackboxFrame_t *frame)
+{
+    uint8_t index;
+
+    if (!log->headerPrinted) {
+        printFieldNames(log);
+        log->headerPrinted = true;
+    }
+
+    printf("%u,%u", frame->loopIteration, frame->time);
+    for (index = 0; index < 3; index++) {
+        printf(",%d", frame->axisPID[index]);
+    }
+    for (index = 0; index < 4; index++) {
+        printf(",%d", frame->rcCommand[index]);
+    }
+    for (index = 0; index < 3; index++) {
+        printf(",%d", frame->gyroData[index]);
+    }
+    for (index = 0; index < 3; index++) {
+        printf(",%d", frame->accSmooth[index]);
+    }
+    for (index = 0; index < log->motorCount; index++) {
+        printf(",%d", frame->motor[index]);
+    }
+    printf("\n");
+}
+
+static void countDroppedFrames(logState_t *log, uint32_t loopIteration)
+{
+    if (log->haveLastIteration && loopIteration > log->lastIteration + log->rateDenom) {
+        log->stats.droppedFrames += (loopIteration - log->lastIteration) / log->rateDenom - 1;
+    }
+    log->lastIteration = loopIteration;
+    log->haveLastIteration = true;
+}
+
+static void decode(const uint8_t *data, uint32_t length)
+{
+    logState_t log;
+    blackboxFrame_t frame;
+    char line[HEADER_LINE_MAX];
+    uint32_t position = 0;
+    uint32_t consumed;
+    uint32_t lineLength;
+
+    memset(&log, 0, sizeof(log));
+
+    while (position < length) {
+        if (data[position] == BLACKBOX_MARKER_HEADER) {
+            for (lineLength = 0; position < length && data[position] != '\n'; position++) {
+                if (lineLength < HEADER_LINE_MAX - 1) {
+                    line[lineLength++] = data[position];
+                }
+            }
+            line[lineLength] = '\0';
+            position++;
+
+            parseHeaderLine(&log, line);
+            continue;
+        }
+
+        if (!log.started) {
+            position++;
+            continue;
+        }
+
+        switch (blackboxDecodeFrame(&log.decoder, &data[position], length - position, &frame, &consumed)) {
+            case BLACKBOX_DECODE_FRAME:
+                countDroppedFrames(&log, frame.loopIteration);
+                printFrame(&log, &frame);
+                log.stats.frames++;
+                break;
+
+            case BLACKBOX_DECODE_SKIPPED:
+                log.stats.skippedFrames++;
+                log.haveLastIteration = false;
+                break;
+
+            case BLACKBOX_DECODE_CORRUPT:
+                log.stats.corruptBytes += consumed;
+                log.haveLastIteration = false;
+                break;
+
+            case BLACKBOX_DECODE_INCOMPLETE:
+                // the capture ended inside a frame
+                consumed = length - position;
+                break;
+        }
+
+        position += consumed;
+    }
+
+    printSummary(&log);
+}
+
+int main(int argc, char *argv[])
+{
+    uint8_t *data;
+    uint32_t length;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <log file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    data = readFile(argv[1], &length);
+    if (!data) {
+        fprintf(stderr, "could not read %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    decode(data, length);
+
+    free(data);
+    return EXIT_SUCCESS;
+}
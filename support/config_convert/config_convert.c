@@ -0,0 +1,277 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Converts a binary config dump, see config_dump.h, to the "profile" and "set" commands of the CLI and back. The text
+ * can be pasted into the CLI, the binary dump is restored with MSP_SET_CONFIG_DUMP.
+ *
+ *   config_convert <dump file>                       prints the CLI commands
+ *   config_convert -b <CLI text file> <dump file>    writes the dump, lines other than "profile" and "set" are skipped
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/color.h"
+
+#include "drivers/accgyro.h"
+#include "drivers/serial.h"
+#include "drivers/pwm_rx.h"
+#include "flight/flight.h"
+#include "flight/mixer.h"
+#include "flight/navigation.h"
+#include "flight/failsafe.h"
+#include "rx/rx.h"
+#include "io/escservo.h"
+#include "io/gps.h"
+#include "io/gimbal.h"
+#include "io/rc_controls.h"
+#include "io/serial.h"
+#include "io/ledstrip.h"
+#include "sensors/battery.h"
+#include "sensors/boardalignment.h"
+#include "sensors/sensors.h"
+#include "sensors/acceleration.h"
+#include "sensors/gyro.h"
+#include "sensors/barometer.h"
+#include "flight/imu.h"
+#include "telemetry/telemetry.h"
+#include "blackbox/blackbox.h"
+
+#include "config/runtime_config.h"
+#include "config/config.h"
+#include "config/config_profile.h"
+#include "config/config_master.h"
+
+#include "config/config_values.h"
+#include "config/config_dump.h"
+
+#define LINE_MAX_LENGTH 256
+
+static uint8_t *readFile(const char *filename, uint32_t *length)
+{
+    FILE *file = fopen(filename, "rb");
+    uint8_t *data;
+    long size;
+
+    if (!file) {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc(size > 0 ? size : 1);
+    if (data && fread(data, 1, size, file) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+
+    *length = size;
+    return data;
+}
+
+static void printRecord(const configDumpRecord_t *record, const configValue_t *value)
+{
+    if (record->type == VAR_FLOAT) {
+        printf("set %s = %.7g\n", value->name, record->value.float_value);
+    } else {
+        printf("set %s = %d\n", value->name, record->value.int_value);
+    }
+}
+
+static int dumpToText(const char *dumpFilename)
+{
+    configDumpRecord_t record;
+    const configValue_t *value;
+    uint8_t *data;
+    uint32_t length;
+    uint32_t position;
+    uint8_t size;
+    int profileIndex = -1;
+    uint32_t unknown = 0;
+
+    data = readFile(dumpFilename, &length);
+    if (!data) {
+        fprintf(stderr, "could not read %s\n", dumpFilename);
+        return EXIT_FAILURE;
+    }
+
+    if (length < 1 || data[0] != CONFIG_DUMP_FORMAT_VERSION) {
+        fprintf(stderr, "%s is not a config dump of format version %d\n", dumpFilename, CONFIG_DUMP_FORMAT_VERSION);
+        free(data);
+        return EXIT_FAILURE;
+    }
+
+    printf("# config dump format %d\n", data[0]);
+
+    for (position = 1; position < length; position += size) {
+        size = configDumpDecodeRecord(&data[position], length - position, &record);
+        if (size == 0) {
+            fprintf(stderr, "corrupt record at offset %u\n", position);
+            free(data);
+            return EXIT_FAILURE;
+        }
+
+        value = findConfigValueById(record.id);
+        if (!value) {
+            unknown++;
+            continue;
+        }
+
+        if ((value->type & PROFILE_VALUE) && record.profileIndex != profileIndex) {
+            profileIndex = record.profileIndex;
+            printf("\nprofile %d\n", profileIndex);
+        }
+        printRecord(&record, value);
+    }
+
+    if (profileIndex > 0) {
+        printf("\nprofile 0\n");
+    }
+
+    if (unknown) {
+        fprintf(stderr, "%u values of newer firmware skipped\n", unknown);
+    }
+
+    free(data);
+    return EXIT_SUCCESS;
+}
+
+static char *trim(char *s)
+{
+    char *end;
+
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+// returns false when the line is a "set" of a value that is not known or out of range
+static bool parseSetLine(char *arguments, uint8_t profileIndex, configDumpRecord_t *record)
+{
+    const configValue_t *value;
+    char *equals = strchr(arguments, '=');
+
+    if (!equals) {
+        return false;
+    }
+    *equals = '\0';
+
+    value = findConfigValueByName(trim(arguments));
+    if (!value) {
+        return false;
+    }
+
+    record->id = value->id;
+    record->profileIndex = (value->type & PROFILE_VALUE) ? profileIndex : 0;
+    record->type = value->type & VALUE_TYPE_MASK;
+    if (value->type & VAR_FLOAT) {
+        record->value.float_value = strtof(equals + 1, NULL);
+    } else {
+        record->value.int_value = strtol(equals + 1, NULL, 10);
+    }
+    return isConfigValueInRange(value, record->value);
+}
+
+static int textToDump(const char *textFilename, const char *dumpFilename)
+{
+    configDumpRecord_t record;
+    uint8_t buffer[CONFIG_DUMP_RECORD_MAX_SIZE];
+    char line[LINE_MAX_LENGTH];
+    char *command;
+    uint8_t profileIndex = 0;
+    uint32_t lineNumber = 0;
+    uint32_t skipped = 0;
+    FILE *text;
+    FILE *dump;
+
+    text = fopen(textFilename, "r");
+    if (!text) {
+        fprintf(stderr, "could not read %s\n", textFilename);
+        return EXIT_FAILURE;
+    }
+
+    dump = fopen(dumpFilename, "wb");
+    if (!dump) {
+        fprintf(stderr, "could not write %s\n", dumpFilename);
+        fclose(text);
+        return EXIT_FAILURE;
+    }
+
+    fputc(CONFIG_DUMP_FORMAT_VERSION, dump);
+
+    while (fgets(line, sizeof(line), text)) {
+        lineNumber++;
+        command = trim(line);
+
+        if (strncasecmp(command, "profile ", 8) == 0) {
+            profileIndex = atoi(command + 8);
+            if (profileIndex >= MAX_PROFILE_COUNT) {
+                fprintf(stderr, "line %u: no profile %d\n", lineNumber, profileIndex);
+                profileIndex = 0;
+            }
+            continue;
+        }
+
+        if (strncasecmp(command, "set ", 4) != 0) {
+            continue;
+        }
+
+        if (!parseSetLine(command + 4, profileIndex, &record)) {
+            fprintf(stderr, "line %u: unknown value or out of range, skipped\n", lineNumber);
+            skipped++;
+            continue;
+        }
+
+        fwrite(buffer, 1, configDumpEncodeRecord(buffer, &record), dump);
+    }
+
+    fclose(text);
+    fclose(dump);
+
+    return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc == 2) {
+        return dumpToText(argv[1]);
+    }
+
+    if (argc == 4 && strcmp(argv[1], "-b") == 0) {
+        return textToDump(argv[2], argv[3]);
+    }
+
+    fprintf(stderr, "usage: %s <dump file>\n", argv[0]);
+    fprintf(stderr, "       %s -b <CLI text file> <dump file>\n", argv[0]);
+    return EXIT_FAILURE;
+}